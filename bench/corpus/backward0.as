@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 1
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+inc L314
+L0: rts
+L1: sub r7, *r3
+bne L1
+jsr L0
+L2: stop
+L3: prn r1
+cmp r1, #-87
+L4: mov L3, *r1
+L5: mov *r1, r5
+
+dec *r2
+L6: .string "ycouglxdfqblmmgtmnfwzbe"
+L7: lea L3, *r6
+stop
+L8: red r0
+rts
+cmp r1, *r3
+jsr *r2
+mov *r4, L1
+dec L8
+L9: .string "sbdnnhsxxvecpjapfzgm"
+L10: add #-32, *r4
+not *r6
+dec L5
+sub #187, r1
+L11: add L8, *r7
+mov #8, L1
+L12: .data 842, -776, -697, -230
+L13: prn r2
+red *r2
+mov r0, *r2
+L14: .data -21
+stop
+sub r3, r2
+L15: sub #-185, L10
+jmp L1
+lea L0, L4
+not *r7
+jmp L10
+red L2
+L16: bne L14
+jmp L12
+L17: lea L12, *r5
+cmp L7, #-189
+not r6
+rts
+clr r2
+L18: inc L4
+L19: red L6
+prn #122
+L20: .data 121, -730
+L21: add *r4, L21
+clr L15
+rts
+mov L17, L10
+L22: not *r3
+dec L21
+L23: bne *r1
+L24: add *r1, L20
+mov r4, *r5
+bne *r0
+
+inc L6
+L25: clr r6
+cmp r7, r0
+mov *r4, *r6
+L26: add r2, *r4
+L27: rts
+L28: inc L18
+add L9, *r5
+dec L3
+L29: .data -1000, 190, -995, 638, 139, -510, 225, 809
+dec r0
+clr *r6
+L30: cmp L9, #12
+L31: prn #-230
+L32: .data 659, -374
+jmp L28
+L33: prn *r5
+lea L28, r7
+bne *r0
+sub r4, *r7
+L34: .data -526, 822
+clr L21
+prn r0
+prn r3
+bne L28
+lea L19, r7
+lea L2, r3
+add *r4, *r5
+L35: rts
+L36: prn #70
+stop
+rts
+bne L17
+L37: .string "hsydhrulmbnniozjrqozxjz"
+L38: bne *r6
+not *r5
+; comment
+L39: sub r1, L2
+L40: .string "ginrlgsq"
+red L34
+inc L2
+jsr *r6
+not *r1
+jsr *r5
+inc L40
+prn r1
+L41: clr *r5
+jmp *r3
+prn #242
+L42: bne L26
+inc r2
+sub L37, L33
+sub L34, L29
+not L1
+red *r3
+bne L22
+red L24
+L43: bne L41
+L44: .string "xatyfdgnmjunyiy"
+prn L0
+mov *r6, r6
+dec L17
+bne *r2
+L45: mov *r0, L4
+not r7
+not *r6
+add r6, L2
+not *r0
+mov *r1, *r5
+jsr *r4
+
+prn L21
+L46: sub r7, r4
+L47: jmp L12
+jmp L21
+add L27, L10
+add #-192, r7
+L48: inc L18
+L49: .string "ekkvrrdensh"
+clr *r7
+prn *r4
+L50: mov #245, L5
+L51: clr *r3
+red r3
+L52: jmp L23
+add #-127, L49
+L53: .string "dvhweaqnbpaqv"
+L54: stop
+bne *r0
+L55: dec r5
+inc L31
+jsr *r3
+stop
+; comment
+L56: lea L9, L25
+L57: inc L2
+L58: prn *r0
+not r1
+L59: .string "vnqqmjlhqcmtoc"
+jsr *r0
+red L1
+cmp L7, *r2
+jsr *r1
+rts
+; comment
+jsr L53
+L60: .string "lon"
+stop
+lea L18, L35
+L61: clr *r1
+cmp #-240, r1
+L62: prn *r5
+L63: jmp *r6
+red *r3
+L64: jmp L32
+L65: .string "z"
+jmp L6
+L66: clr L9
+not *r1
+L67: jsr *r6
+
+add *r0, r1
+L68: add r1, L46
+L69: mov *r2, L62
+red r2
+inc r6
+L70: rts
+L71: mov #149, r7
+jmp L24
+L72: .data 660, -812, 205, 885, -263
+inc *r0
+sub #166, r4
+lea L69, *r6
+add *r5, *r7
+L73: cmp #25, *r4
+lea L27, L54
+L74: .string "spfp"
+lea L19, *r0
+L75: red L28
+bne *r0
+jmp *r7
+add #-82, r3
+mov r1, *r7
+; comment
+L76: inc *r0
+add L2, *r2
+bne L54
+not r6
+lea L62, *r7
+prn #67
+L77: .string "yovroznct"
+L78: .string "rralazdgspt"
+L79: .string "i"
+jmp L2
+; comment
+red L1
+sub L51, L11
+
+lea L35, L51
+; comment
+cmp L53, *r3
+red r2
+rts
+L80: stop
+L81: mov #-184, L12
+cmp *r1, #129
+L82: bne L17
+add L22, L76
+L83: prn #29
+lea L71, L28
+; comment
+L84: jsr L64
+lea L75, L54
+add r1, L26
+L85: inc r0
+lea L42, L85
+; comment
+stop
+not r4
+L86: rts
+mov r1, L76
+L87: .string "rpfzbqzgvz"
+red r7
+red L61
+L88: bne L0
+
+stop
+sub *r7, r5
+L89: prn r3
+L90: rts
+L91: .string "wdsm"
+rts
+jsr *r4
+sub L34, r5
+rts
+L92: .data -9, -494, -633, -177, -770
+prn L2
+stop
+cmp #-76, L75
+clr *r4
+jsr L78
+L93: jmp *r4
+L94: red *r3
+L95: cmp *r3, #-134
+jsr *r3
+jsr L58
+L96: dec r1
+jsr *r3
+L97: .string "ayrlncgbndiugnepp"
+jsr *r7
+L98: bne *r3
+clr *r7
+L99: dec r4
+rts
+sub *r2, L29
+prn *r0
+dec L56
+jmp L31
+red L15
+add L98, *r1
+cmp L91, #-195
+not L39
+jmp *r0
+L100: inc r7
+rts
+L101: inc r7
+stop
+sub L73, *r6
+clr L33
+prn *r6
+mov r1, *r4
+bne L96
+L102: clr r2
+stop
+L103: inc L66
+L104: lea L70, r0
+clr L39
+jmp *r5
+rts
+L105: inc r1
+L106: bne L91
+clr r7
+
+jmp *r3
+L107: bne L14
+bne *r0
+; comment
+L108: .data -455, -663, 185, -179, -313, 905, 477
+L109: mov #217, L6
+clr L7
+L110: jmp L106
+L111: dec L34
+not r4
+jmp *r6
+red *r4
+L112: prn #174
+L113: dec L97
+dec *r6
+jmp *r4
+rts
+cmp L93, #232
+L114: add *r5, L15
+add r5, *r2
+prn *r3
+jsr L57
+mov #86, r2
+add *r3, *r5
+L115: add #-52, r0
+; comment
+L116: .string "pntzopuhwffinnawklfw"
+stop
+lea L112, r5
+L117: stop
+jmp L34
+L118: sub *r2, r7
+L119: red L97
+dec L47
+jmp *r3
+sub *r2, *r4
+stop
+cmp #52, *r4
+L120: red r4
+L121: rts
+L122: .data 455, -965, 247, 292
+L123: .string "pv"
+jmp L104
+L124: add r6, *r5
+dec *r0
+clr L67
+clr r0
+L125: bne L88
+bne *r2
+L126: dec L53
+not L78
+jmp *r7
+lea L80, *r6
+; comment
+L127: clr *r1
+L128: .data -637, 667, 856, 724, -134, -524, 693
+inc *r4
+L129: .string "lelkyjadpugna"
+L130: red r3
+cmp r5, r4
+jmp *r4
+dec *r1
+jmp *r6
+L131: .data 795
+stop
+L132: .string "dskevryfyfadgodxphasc"
+clr *r2
+lea L61, *r0
+L133: .string "shdikincrmjkzkmbyqxuc"
+lea L115, *r4
+L134: .data -30, 992, -236
+L135: jsr L121
+dec *r2
+jmp *r2
+prn *r2
+L136: rts
+L137: .string "geg"
+L138: sub r4, *r0
+prn r5
+stop
+rts
+jmp L17
+jmp *r0
+mov #-80, *r1
+stop
+clr L94
+L139: add #-34, L105
+bne L55
+L140: sub r4, r6
+not *r0
+L141: not *r4
+L142: lea L63, *r5
+L143: .data -439, -663, 697, -247, 471, 613, -972
+jsr L102
+not *r5
+rts
+bne *r1
+sub L100, *r0
+L144: mov #132, r3
+L145: bne L105
+sub #-156, r0
+lea L48, *r7
+L146: jsr *r3
+L147: .data -980, -249, 492, -197
+L148: .string "mnljrskjrecicvtuhiue"
+dec r5
+red L98
+lea L78, r0
+sub #-221, L129
+L149: stop
+L150: clr *r3
+inc L115
+L151: mov L64, L86
+L152: .data -292, -204, -872
+L153: stop
+sub L26, r6
+mov r4, r2
+bne *r2
+L154: jmp *r2
+prn r2
+rts
+cmp L20, *r0
+clr *r0
+rts
+stop
+L155: not r3
+L156: stop
+red *r4
+cmp #-194, L43
+L157: prn r0
+jmp *r4
+L158: clr r4
+rts
+L159: prn L132
+rts
+bne L150
+prn L43
+clr r4
+L160: .data 981, 853, 146, -564, -524, -346
+prn L69
+L161: stop
+mov r0, L139
+L162: red *r5
+cmp #-168, *r7
+lea L76, L45
+L163: mov r7, L163
+bne L124
+
+add r7, *r5
+jsr *r3
+jmp *r7
+L164: .string "xbmalzdkibnbrz"
+L165: .data 251, 131, 892, 102
+rts
+L166: sub r3, r3
+add *r3, L138
+L167: .string "ipydrzmyyewnloakwzcly"
+L168: not *r6
+add *r6, *r0
+L169: .data 277, 342
+
+not L2
+L170: mov #-131, r4
+; comment
+L171: jsr L3
+L172: red *r3
+mov L0, r5
+jmp *r6
+L173: inc r5
+bne L90
+L174: clr L99
+L175: jsr L72
+sub *r3, r4
+clr L104
+lea L173, L48
+L176: sub *r3, r7
+lea L92, *r1
+add *r4, r2
+cmp *r7, #-125
+; comment
+L177: .string "zcuootgbxwudpqqebdxozz"
+
+L178: not r3
+L179: stop
+L180: rts
+jmp L73
+red r4
+L181: mov #-214, *r3
+inc *r7
+L182: rts
+L183: jmp L16
+L184: .string "vlselgbhjcptsdkcboceu"
+bne *r5
+L185: jmp *r1
+
+red r0
+L186: jmp L23
+jsr *r0
+dec L186
+mov *r5, L20
+rts
+lea L118, r3
+L187: jsr *r7
+L188: clr *r4
+not r4
+add #-128, r2
+L189: .string "oftezeilbbfqzlypdfqwu"
+rts
+jsr L28
+red *r6
+L190: rts
+dec *r5
+not *r3
+cmp L173, *r6
+clr r5
+prn r6
+add L50, *r3
+cmp r2, L27
+rts
+rts
+inc *r2
+L191: jmp *r7
+mov L119, r7
+clr L68
+add r6, *r3
+L192: .string "vukqtzybebprhdgnranae"
+rts
+
+sub r5, *r1
+L193: .data 684, 776, -570
+L194: prn *r0
+add L123, L183
+L195: inc r1
+clr r6
+L196: lea L181, *r2
+L197: .data -204, 888, 741, 643, 760
+not L98
+L198: red *r5
+L199: jmp *r0
+L200: .string "bthc"
+dec L77
+mov #-211, L90
+L201: jsr *r3
+L202: cmp r4, #-103
+cmp L91, r5
+
+L203: prn *r7
+L204: .string "cnsljrjbqilp"
+not r4
+red L16
+L205: cmp L163, r7
+bne *r3
+L206: inc r4
+not *r4
+L207: clr *r4
+L208: dec L126
+L209: .data 361, -322
+L210: cmp r6, *r3
+L211: dec r1
+prn L177
+red L23
+dec r7
+L212: mov #-71, *r2
+L213: .data 232, -301, -751, 171, -668, 680
+L214: red *r1
+L215: jsr L147
+rts
+rts
+L216: not L192
+clr r6
+L217: .data -76
+cmp L195, r7
+L218: .data 247, 831, 681, -908, -692, -237
+stop
+L219: lea L157, *r3
+add #96, L23
+prn #-92
+rts
+lea L49, r2
+lea L28, L18
+L220: clr *r2
+L221: stop
+inc r2
+L222: jmp L2
+L223: not L26
+dec L75
+L224: cmp r1, L73
+red *r0
+cmp #-176, L89
+L225: red r5
+bne L45
+clr *r3
+; comment
+mov #174, *r6
+bne *r4
+prn *r7
+; comment
+
+red L186
+
+prn *r3
+lea L207, *r0
+L226: not L125
+; comment
+cmp #20, L64
+L227: .data -567, 337, -578
+jmp L107
+L228: dec r0
+L229: .string "uoy"
+L230: add L166, *r0
+jsr *r6
+L231: inc *r0
+L232: red r0
+stop
+L233: inc r1
+L234: cmp L73, #132
+L235: mov *r7, r0
+sub *r3, r6
+prn L185
+L236: .data 238, 465, 585
+L237: .data 83, 396, -637, -705
+prn L183
+
+dec L1
+; comment
+L238: lea L30, *r1
+lea L174, r4
+cmp L172, #125
+cmp *r4, *r1
+L239: lea L217, L54
+rts
+L240: dec L31
+add #43, r0
+L241: jmp *r0
+sub *r6, r4
+jmp *r0
+L242: lea L195, L91
+cmp #-236, L202
+jsr L27
+prn r5
+L243: sub *r6, r3
+cmp L238, *r6
+clr L66
+sub r7, *r2
+dec L22
+L244: add L130, r1
+L245: sub #117, r4
+lea L194, *r5
+inc r1
+clr r3
+red *r6
+stop
+stop
+cmp #30, r7
+
+dec *r5
+sub *r6, r4
+bne L55
+L246: .data -307, 996, 798
+mov r6, L200
+jsr *r3
+L247: red L145
+L248: jmp *r4
+add #178, *r4
+L249: .string "biaodeigdqtrwgcbyunwr"
+L250: red r5
+clr r6
+sub L113, r5
+L251: dec *r4
+L252: not r5
+mov r3, L155
+red L162
+L253: add r6, L33
+
+mov #-204, *r6
+L254: .data -442, 154, 436, 875, -802
+L255: .data 627, 935
+L256: .string "sexhewwbkwaz"
+prn #1
+mov L162, r2
+jsr L72
+sub r3, L138
+inc *r0
+L257: bne L54
+clr *r1
+red *r7
+bne *r0
+prn r4
+mov L84, L214
+L258: .data -542, -191, 589, -328, 884, 340
+L259: inc L203
+L260: red r4
+
+lea L175, *r3
+L261: not *r1
+stop
+L262: red *r2
+add *r1, *r3
+L263: cmp #-100, #-4
+rts
+L264: lea L32, *r5
+red *r0
+L265: .data 990, 832, -297, -54, -164, 78
+L266: .data 291, -287, -390, 686
+L267: add L42, *r0
+red r6
+L268: red L78
+L269: not *r3
+bne L162
+red L103
+
+bne *r7
+L270: not *r4
+L271: add *r1, r5
+jsr L220
+clr *r6
+rts
+clr L92
+prn L90
+stop
+not L237
+L272: .data 879, -834
+mov L193, r2
+jsr *r7
+red L127
+mov *r4, r7
+red *r4
+prn *r6
+rts
+L273: rts
+cmp L109, *r0
+L274: .string "hvzje"
+L275: inc *r2
+lea L147, r4
+stop
+mov *r1, *r4
+bne *r3
+prn #-3
+L276: sub *r2, *r1
+L277: .string "adskmpqnciu"
+mov *r5, L3
+jsr L162
+clr L267
+L278: not r1
+bne *r2
+L279: jsr L95
+clr r4
+L280: .string "ht"
+stop
+dec *r1
+L281: lea L281, *r6
+; comment
+L282: stop
+prn L236
+
+rts
+dec *r5
+stop
+L283: inc r7
+L284: red *r5
+L285: clr *r5
+jmp *r4
+rts
+rts
+L286: jmp *r5
+rts
+L287: clr r5
+cmp L109, #133
+L288: clr r1
+clr r3
+mov r3, *r7
+L289: .string "cgdnnmwhlfjqsgyp"
+jmp *r4
+L290: .data 769, -844, -282, 781, 131, -877
+L291: add *r3, *r1
+sub #-48, r3
+mov *r6, r1
+lea L200, *r2
+prn r3
+
+jsr L104
+lea L283, L249
+bne L286
+rts
+L292: clr *r4
+stop
+mov L201, L141
+inc L112
+L293: cmp L164, L126
+red L4
+L294: inc *r2
+stop
+stop
+stop
+mov *r1, r1
+L295: jsr *r1
+
+L296: .string "wzoyerztupqbpfeghgkje"
+L297: bne *r2
+sub r1, *r3
+L298: .string "wnvgsfljgk"
+red r6
+sub L275, *r7
+add r6, *r3
+L299: stop
+clr L240
+jsr L134
+red *r5
+mov *r1, *r6
+bne L292
+dec L43
+inc *r4
+cmp L135, r7
+prn *r0
+not *r0
+cmp *r4, #-18
+jmp L272
+bne *r0
+dec *r6
+jsr *r0
+inc r2
+; comment
+L300: mov #185, *r7
+add r7, r6
+jsr L192
+L301: .string "ugsgk"
+inc L228
+prn *r0
+not L7
+L302: stop
+jsr L114
+L303: clr r2
+jmp *r5
+sub *r6, L290
+prn *r5
+clr L97
+add r0, L26
+L304: .string "ijityqb"
+L305: jmp L63
+add r3, L293
+L306: .string "pyovglcdkimvugmc"
+L307: lea L153, L97
+jmp *r0
+L308: .data 507, -978, -108, -498, 393, -396, 4, -287
+cmp *r3, r6
+inc *r3
+jmp *r2
+mov L268, *r4
+L309: .string "inkekjqvmvjqj"
+L310: .string "npck"
+inc r2
+L311: bne L61
+clr r2
+bne *r3
+clr *r7
+prn #-3
+stop
+L312: prn *r2
+L313: .data 965, 281, -928, 930, 405, 962, 330
+dec *r1
+lea L57, L118
+L314: clr r7
+mov #-196, *r3
+jsr L166
+L315: lea L225, *r4
+L316: .data -738, 117, 371, 692, 607
+L317: bne *r0
+sub #179, L200
+not *r3
+rts
+stop
+L318: mov #-97, L233
+L319: jmp *r2
+
+L320: jmp L80
+prn #249
+not r6
+L321: add L321, L139
+L322: .data 890, 100, -760, -278, 31
+L323: jmp *r1
+sub L214, L6
+L324: .string "gamntjbofcwciu"
+L325: not L226
+L326: prn *r5
+not L31
+inc L98
+L327: dec L88
+lea L163, L231
+L328: bne L58
+L329: jsr L210
+prn *r0
+L330: .string "ohdpbqvv"
+inc *r3
+rts
+lea L125, L217
+mov L67, L173
+L331: mov *r2, r6
+L332: jmp L1
+stop
+clr r4
+sub #-222, L28
+dec L9
+bne *r4
+clr L283
+cmp *r0, *r1
+L333: dec L72
+inc *r4
+prn L309
+red *r5
+bne *r5
+
+L334: red r3
+jsr *r4
+L335: sub #-198, *r5
+bne *r4
+prn L55
+stop
+L336: rts
+rts
+L337: add L181, r6
+inc *r7
+prn #151
+L338: add #-249, *r3
+L339: add L306, L169
+red L281
+red L37
+L340: bne *r5
+L341: jsr *r1
+stop
+L342: mov #106, r2
+inc r2
+sub r4, L262
+stop
+L343: jmp *r1
+; comment
+; comment
+rts
+L344: sub *r4, L343
+L345: mov #241, L280
+lea L158, *r1
+mov *r0, L209
+jmp L291
+rts
+L346: stop
+jsr *r6
+L347: stop
+L348: .data 995, -490, -656, 522, -927, 277
+L349: not L58
+jmp L44
+stop
+prn L231
+mov #-196, r4
+clr L334
+
+L350: rts
+add *r0, r2
+L351: lea L163, *r0
+L352: cmp r5, L282
+stop
+not r3
+inc r6
+L353: cmp r3, r7
+; comment
+not r6
+dec r4
+stop
+jmp L314
+jmp L134
+L354: prn *r5
+L355: not L110
+add *r7, L199
+stop
+rts
+mov *r4, r2
+L356: not r7
+not r2
+L357: stop
+lea L196, L247
+inc *r7
+L358: jsr L204
+not *r5
+bne *r1
+inc L196
+lea L207, r1
+
+L359: jmp L320
+jmp *r6
+red r3
+L360: dec *r6
+L361: jmp L0
+inc r3
+L362: jmp *r2
+rts
+L363: dec *r4
+stop
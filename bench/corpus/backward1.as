@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 2
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+rts
+dec r6
+lea L257, r4
+lea L12, *r6
+mov *r0, *r4
+rts
+lea L2, L191
+L0: jmp L0
+sub L0, L0
+dec *r1
+sub #14, r6
+add L0, r1
+prn r1
+jsr L0
+bne L0
+dec *r5
+L1: jsr *r3
+
+L2: .string "zfskpgplnkl"
+not r1
+bne *r1
+L3: .string "todxwvttdilmofvgldzh"
+clr r2
+L4: .string "pkmmbhqgpopalewwtnnnysss"
+bne *r6
+L5: inc *r6
+L6: jsr *r2
+L7: rts
+L8: dec L7
+stop
+L9: bne *r4
+prn r1
+stop
+sub r7, *r0
+L10: jmp L8
+
+jmp *r1
+L11: red *r3
+L12: red *r6
+cmp r2, #138
+lea L10, r1
+cmp #67, *r2
+L13: rts
+L14: .string "aylnfssnzkjidgewmzozl"
+jmp *r0
+L15: dec L15
+sub L12, r6
+cmp #198, #-201
+L16: prn r6
+L17: inc L14
+L18: .string "yzscjmchsxw"
+cmp #44, L17
+; comment
+L19: clr L13
+prn #-101
+L20: sub L12, *r7
+rts
+add r4, r7
+L21: add #-207, L14
+cmp #215, *r6
+bne *r4
+L22: rts
+L23: add *r7, r2
+sub L18, *r1
+jsr *r7
+L24: red L24
+lea L11, *r1
+not r7
+cmp *r2, L14
+L25: dec *r3
+L26: red r6
+stop
+L27: sub #-182, *r4
+red *r1
+L28: mov L3, r6
+not r2
+L29: add *r0, r0
+clr *r0
+; comment
+lea L14, *r2
+L30: jmp *r3
+L31: stop
+; comment
+not r2
+mov *r7, r4
+L32: jsr *r0
+sub r6, *r5
+lea L3, L5
+cmp *r3, *r0
+bne L6
+prn #-195
+rts
+L33: jsr *r1
+stop
+L34: rts
+sub *r1, r1
+L35: rts
+sub *r2, r2
+
+lea L14, *r4
+rts
+L36: .data -632, 661, -548
+inc L27
+L37: prn #36
+L38: .data 263, -216
+red L24
+add r2, r2
+stop
+L39: prn L27
+L40: .data 908, 632, -453, -330, -570, 72, 795, 381
+clr *r5
+L41: .data 772, 719, -43, -162, 860, 447, -821, -506
+cmp L22, r2
+dec r3
+L42: stop
+jmp *r5
+inc L40
+L43: .data 742, 116, 616, 492, 548
+clr r6
+red L29
+not *r5
+clr r7
+cmp L30, #-182
+L44: jsr *r3
+L45: cmp #-35, #249
+L46: .data 686, 57, -729, 130, -301, 168
+L47: stop
+jsr *r5
+L48: lea L11, L31
+L49: dec L34
+lea L14, L21
+L50: stop
+L51: cmp r1, *r6
+L52: bne *r4
+mov r2, L33
+add #-44, r1
+jmp L14
+L53: red r3
+dec L20
+sub *r7, *r0
+inc *r2
+L54: .data 915, -816, 931, 497
+; comment
+jmp *r3
+L55: prn r0
+bne *r5
+red r7
+stop
+cmp *r4, L37
+lea L47, r0
+jmp *r2
+L56: add *r6, L28
+rts
+stop
+not L12
+mov #124, r7
+L57: cmp r6, L23
+jsr *r6
+L58: add r3, *r6
+sub #-122, *r6
+not *r2
+L59: rts
+clr r6
+inc *r4
+not r3
+jmp *r4
+L60: mov #73, *r7
+rts
+not r1
+lea L45, L4
+L61: .data -177, -220, 960, 193
+cmp #219, #-225
+stop
+L62: .string "bhhczaidoccqcyu"
+prn #50
+L63: lea L34, r7
+L64: jmp L23
+dec r4
+red L44
+lea L46, *r1
+red r3
+L65: lea L50, *r3
+sub r6, r7
+jmp L7
+add r1, r5
+L66: lea L58, L50
+mov *r0, *r7
+L67: cmp L16, r7
+inc L41
+jmp *r4
+L68: jmp *r7
+L69: cmp *r2, *r3
+L70: .string "knoricng"
+lea L15, r5
+red *r1
+add r2, L6
+bne *r7
+L71: red L12
+L72: add L46, *r2
+red L56
+not *r2
+red *r1
+L73: red L14
+inc r4
+dec *r2
+L74: .string "aodazocodulc"
+add #240, *r6
+mov L58, L39
+red L55
+rts
+prn *r2
+L75: .data -488, -346, 282, -825, -674, 434
+inc r4
+rts
+; comment
+lea L3, L64
+jsr *r0
+add *r6, L49
+stop
+L76: .string "adrcqxglg"
+L77: prn L39
+L78: inc *r5
+L79: red *r3
+jmp L28
+lea L63, L10
+add *r7, L35
+L80: .data -878, -915, 874
+cmp L30, r5
+cmp r6, L12
+mov #-212, L41
+not r0
+bne *r4
+not *r5
+L81: red L48
+inc r7
+stop
+cmp #220, *r5
+jsr L53
+jsr *r1
+L82: cmp *r5, L6
+sub #-147, *r7
+inc L81
+inc r6
+not L31
+L83: red L47
+L84: prn r0
+cmp r6, *r7
+add #5, r4
+dec r7
+lea L5, r5
+mov #101, *r0
+jsr *r4
+add r4, *r2
+L85: dec L42
+clr r6
+L86: .string "zqmwdexgnnerryiunbr"
+L87: .string "jvilwnnculzzztitlhojmblx"
+jsr *r1
+lea L24, *r7
+L88: .data -916, -142, -456, 832
+L89: stop
+cmp r7, r5
+lea L81, *r6
+add L28, *r3
+L90: stop
+add L31, L48
+lea L54, r3
+; comment
+L91: add L28, *r7
+L92: cmp r3, L7
+L93: add r3, L42
+L94: add L54, *r7
+inc *r5
+clr r3
+L95: add #-158, L32
+cmp *r0, L59
+L96: lea L49, r1
+not L89
+clr r6
+red r6
+not L96
+L97: lea L30, L41
+sub r5, r4
+not r2
+dec *r2
+jsr L18
+dec L90
+L98: mov L56, L58
+L99: .data 110, -556
+L100: .data 655, 245, 115, 817, 992, -669, 791
+stop
+L101: add #201, *r7
+L102: .string "iz"
+sub #22, r2
+L103: .string "lizfkvaitjv"
+L104: .string "uguhyhioxttfka"
+bne L56
+prn #205
+sub #52, *r2
+mov #218, *r7
+dec r0
+add #-195, L3
+L105: sub *r3, r5
+L106: .data 615
+jsr *r6
+bne *r5
+inc L17
+L107: inc *r6
+L108: cmp #-193, L90
+inc *r6
+add #151, *r0
+L109: cmp r4, r4
+stop
+inc *r0
+L110: .data 996, -896, -590, 418
+not *r7
+L111: stop
+bne L12
+cmp #238, r1
+L112: .string "tbldszlhczmiwnaufgaiypvt"
+dec r4
+prn L52
+; comment
+L113: bne *r7
+L114: .data 32, -472, 31, 874, 979, -893, 522, 800
+L115: jmp *r1
+jmp L96
+rts
+L116: .string "zfepavgblnndk"
+L117: jsr L48
+not r6
+inc L83
+jsr L46
+lea L115, L26
+rts
+L118: inc r2
+sub #190, r6
+L119: stop
+mov *r7, *r4
+; comment
+L120: cmp r5, r7
+rts
+L121: rts
+sub *r7, *r5
+bne *r5
+
+jsr L94
+dec L1
+clr r4
+add #56, *r4
+L122: mov L83, L37
+L123: jsr *r1
+L124: red *r7
+L125: inc r4
+add r3, *r1
+inc r0
+not *r6
+jmp *r7
+red r2
+cmp #-234, r7
+rts
+stop
+L126: red L47
+L127: mov L11, r0
+dec *r1
+jsr *r6
+cmp *r0, #-135
+L128: lea L27, L59
+sub *r4, L36
+dec *r0
+L129: red r1
+L130: inc *r7
+L131: inc r0
+mov r3, r0
+L132: rts
+sub *r4, L95
+jmp *r5
+L133: jmp L124
+
+lea L104, *r6
+red L104
+L134: .string "jxxxxjcpkrlhymuprzqccc"
+mov r6, L20
+stop
+L135: cmp L70, r5
+not r2
+rts
+
+not L84
+rts
+L136: .string "vb"
+jmp *r7
+L137: dec L22
+prn *r6
+add *r4, L69
+dec r2
+L138: stop
+L139: .string "icrpcdgbjbqtnem"
+stop
+prn r2
+L140: .string "njeges"
+add L54, *r2
+
+lea L114, *r0
+L141: rts
+L142: .string "ocfenibjqzcdlkiptlgge"
+L143: not *r0
+dec r7
+L144: .data -608, -68, -414, -912, -9, 314
+L145: .string "lcg"
+stop
+jsr L4
+cmp r1, r0
+bne *r7
+L146: lea L35, *r4
+L147: red r7
+prn r5
+not L76
+sub *r4, L103
+L148: sub #-189, L49
+stop
+L149: stop
+stop
+inc L149
+lea L18, r6
+lea L124, *r7
+jmp *r1
+L150: dec *r6
+rts
+jmp *r5
+bne *r6
+jmp L1
+prn L65
+dec L123
+L151: rts
+clr L36
+L152: add L35, L100
+L153: .string "dsgjlpz"
+mov *r6, L119
+L154: bne *r6
+sub #-163, L83
+not L52
+clr L148
+stop
+L155: jsr L17
+lea L63, L85
+L156: .data 786, 590, 992, -437, -279
+L157: .data -797, 462, -668, 916, 633, -613, -489, -114
+add *r4, r3
+bne L67
+red *r5
+bne L120
+mov L9, r5
+L158: clr r1
+red r7
+mov r7, L94
+cmp #-228, #199
+jmp L116
+clr L52
+L159: sub r6, r3
+clr *r2
+red *r3
+L160: .data -878, 366, -216, -809, -976, -861, -553, -159
+lea L73, *r7
+bne L137
+not *r4
+add L116, L57
+jmp L137
+L161: not L134
+sub #-48, L87
+L162: .data -19, -408, -468, 894, 189
+sub L43, L70
+jsr *r3
+clr L61
+prn #-253
+jmp L66
+jmp L28
+red r6
+L163: inc L27
+L164: jsr *r6
+not L136
+bne *r7
+L165: prn *r1
+L166: not r6
+sub *r5, *r2
+inc L75
+bne L57
+clr L55
+red L61
+stop
+add L33, *r3
+L167: clr *r1
+inc *r2
+L168: cmp *r6, L146
+prn L0
+red r7
+L169: .string "ffghbsws"
+rts
+red *r2
+L170: .data 495, -571, -447, 599
+L171: mov r4, r7
+prn #73
+L172: not L4
+
+not r5
+L173: clr r1
+L174: .string "ktiuufmpm"
+bne *r1
+not *r4
+L175: .string "dnlhfnnnxeiaov"
+jmp L32
+stop
+sub #-244, r0
+L176: stop
+jmp L1
+L177: add *r7, *r5
+prn #255
+bne *r6
+clr *r3
+dec L87
+mov L40, *r5
+clr *r1
+prn #-67
+L178: stop
+cmp L156, L85
+sub L175, r6
+add r4, *r7
+L179: lea L11, *r6
+; comment
+L180: bne L14
+L181: .data -534, 69, 82, -55, -532
+cmp r6, r1
+not *r1
+inc r7
+mov *r7, *r7
+jsr *r0
+L182: .string "lctxhvmjhqutnecuewcuz"
+stop
+prn L30
+L183: not r6
+jsr L149
+L184: clr *r6
+rts
+stop
+bne L38
+L185: prn r7
+L186: not r5
+L187: .string "rcvgpyqrcbigu"
+L188: stop
+L189: .string "yqbjtyx"
+jsr L104
+inc r2
+lea L37, *r5
+add #-181, *r3
+prn *r4
+L190: .data 702, 364
+rts
+cmp #99, r4
+bne L174
+dec L157
+jmp *r1
+L191: .data 292, -202, -522, 645, 835, -322, -117, 424
+bne L65
+mov r1, L168
+inc L1
+not r6
+L192: add L178, *r1
+L193: cmp #86, L189
+L194: .data -100, 923, -276, 205, -879, -944
+L195: .data 570, -459, -795, 625, 849, -641, -287, 162
+mov #30, *r6
+jsr L23
+red L143
+inc L46
+red *r3
+jsr *r2
+lea L6, r6
+red L68
+; comment
+L196: cmp L131, r4
+L197: inc L54
+red r1
+; comment
+rts
+lea L18, *r7
+L198: cmp *r4, L105
+clr r5
+mov r5, L192
+; comment
+add *r4, L79
+L199: .string "sb"
+L200: jmp L47
+L201: sub r2, L46
+L202: sub #179, r0
+L203: .data -903, 433, 472, 112, 317, 333
+
+inc L202
+jmp *r4
+L204: bne L39
+jsr *r7
+stop
+jsr L130
+rts
+sub *r5, *r5
+dec L185
+L205: .string "wcaumymnq"
+L206: add *r6, r0
+clr *r6
+inc L139
+add *r4, r0
+mov #-171, L143
+L207: prn r7
+L208: stop
+jsr *r6
+lea L20, L70
+red r7
+; comment
+dec L174
+mov #107, L183
+lea L58, r0
+red r4
+L209: dec r6
+dec L40
+L210: cmp L77, #-206
+L211: jsr *r6
+jsr *r7
+L212: not r3
+bne L172
+L213: .string "uniexsjarls"
+dec r6
+jsr L13
+
+jsr L86
+clr *r5
+clr r2
+L214: mov #-189, *r0
+red L40
+L215: sub r2, *r3
+L216: inc r0
+mov *r3, L65
+L217: lea L35, r7
+stop
+red r0
+L218: mov #-22, *r7
+red r3
+L219: not *r4
+L220: bne *r2
+L221: stop
+L222: bne L86
+prn r2
+bne L71
+L223: rts
+L224: lea L34, L156
+L225: lea L224, r2
+bne *r5
+rts
+clr *r6
+L226: mov #-38, L23
+jsr L57
+L227: not *r4
+not L19
+bne L193
+not L177
+; comment
+lea L216, *r7
+add #184, *r1
+rts
+lea L96, L43
+red r3
+L228: inc r4
+bne L204
+bne *r5
+jmp L188
+bne *r2
+L229: jsr *r3
+add L147, L121
+stop
+L230: bne *r0
+L231: stop
+jsr L108
+L232: red L73
+L233: clr *r4
+cmp *r5, #-254
+not L54
+add *r5, r7
+sub L165, L110
+L234: .data 502, -727, -128
+stop
+add #4, L23
+mov L4, *r4
+rts
+inc L209
+lea L165, *r4
+; comment
+lea L68, *r7
+not L144
+L235: jsr L156
+L236: prn #-59
+L237: sub *r6, *r6
+cmp L127, *r6
+L238: red L20
+L239: .data -267, -674, -214, -670, -26, 624, -405
+add #103, r1
+sub r6, r7
+L240: rts
+lea L11, *r3
+; comment
+prn L172
+L241: red r7
+dec r1
+L242: .string "ix"
+not *r6
+not *r4
+L243: prn #175
+L244: .data 954, 577, 499, -792, -960, 844, -3
+L245: .data 208, 105
+stop
+L246: mov #-50, *r2
+rts
+L247: .data 944, -870, -425, 389, 605, -259
+lea L237, *r4
+add L103, L58
+L248: .string "s"
+add #-60, r3
+not r2
+rts
+jmp *r2
+L249: jmp L169
+L250: rts
+; comment
+mov r2, L239
+L251: .string "u"
+L252: dec r6
+bne L227
+rts
+L253: .data -305, 981, -518, 140
+clr L68
+cmp r4, #-1
+lea L52, *r3
+L254: clr *r0
+L255: sub L47, L253
+L256: dec r7
+prn L243
+L257: .data 230, 433, -373, -449, -349
+jsr *r2
+not L209
+dec L2
+L258: sub *r1, *r6
+L259: rts
+add r7, r0
+L260: cmp *r2, *r3
+rts
+rts
+prn #-127
+L261: prn *r1
+lea L96, r4
+L262: .string "bhlcxselkshxlcqfftu"
+red *r5
+L263: cmp r3, L166
+L264: stop
+cmp r1, r4
+L265: .string "ktb"
+rts
+L266: jsr *r3
+clr L202
+rts
+L267: .data -204, -880, -690, 208, -550, 648, -685, -441
+stop
+lea L169, r1
+L268: inc r6
+jmp L2
+stop
+L269: not *r3
+lea L24, L256
+red r2
+lea L131, L108
+not *r7
+mov r3, L260
+L270: clr L72
+L271: cmp L250, r3
+inc L51
+dec L85
+L272: cmp L110, *r3
+mov #-142, *r4
+L273: clr *r4
+bne L26
+sub *r4, L120
+L274: prn r3
+L275: jmp L261
+add L32, *r3
+add #1, L44
+clr *r5
+lea L24, *r4
+L276: bne *r2
+inc *r5
+jmp *r4
+not r5
+jmp L245
+jsr L5
+jmp L14
+cmp r7, *r4
+L277: .string "ntcnjwxelrgrqwtcdtxl"
+; comment
+L278: bne *r3
+rts
+L279: .data -776, 686, 435, 568, -351, -235
+red r0
+L280: lea L157, *r3
+L281: cmp r6, #-95
+rts
+inc L233
+L282: clr L241
+L283: prn *r7
+L284: .data 233, -299, 75, -872
+sub r0, L280
+lea L35, *r2
+clr *r5
+jmp *r2
+
+; comment
+red r3
+dec L46
+inc r5
+lea L18, L113
+add *r4, r1
+
+add r0, *r7
+L285: .string "unbkntxez"
+cmp #-87, *r2
+L286: .data 630, 181, -668, 381, 907, 320, -297, 149
+inc L49
+L287: .string "uilvcsjaosfiwrp"
+not r3
+red r5
+red L7
+clr *r3
+cmp #-68, r4
+L288: .string "dptrew"
+inc *r3
+mov L80, L76
+rts
+not r6
+L289: clr *r2
+dec r7
+add *r1, L267
+L290: clr r7
+prn r7
+dec *r4
+red L202
+L291: cmp r5, *r1
+L292: .string "uxesegsh"
+red r5
+L293: .string "ljookrjsoibycbzyk"
+stop
+dec L216
+L294: .data -137, -921, 922, -727, 617, -484
+L295: lea L224, L186
+inc *r7
+mov *r4, r3
+L296: .data -651, -438, 479, -786, -143, 197, 314
+L297: .data 389, -369, 14, 829, 730, 769
+inc *r4
+jsr *r6
+inc L107
+bne L79
+L298: stop
+L299: prn L173
+mov r6, L41
+rts
+
+mov *r1, r0
+red r1
+sub L209, *r4
+L300: dec *r5
+L301: prn L4
+stop
+L302: .data -449, -722, -343, 973, -379, -688, -536
+mov L230, *r0
+L303: not L177
+L304: sub *r0, r4
+jsr *r3
+L305: .string "eukohmvotcgdsvojlcz"
+add L141, L141
+L306: add r7, r0
+L307: .data 987, 945, 677, -473, 906
+L308: cmp *r5, #-155
+red r7
+rts
+jmp L285
+sub L84, L79
+jsr L232
+sub *r1, r7
+
+clr *r0
+bne *r2
+L309: .string "svca"
+cmp L265, L67
+L310: rts
+inc L287
+lea L100, L197
+clr L38
+L311: red L37
+L312: lea L80, r6
+L313: rts
+L314: .data 923
+L315: mov L267, L3
+L316: prn #-228
+prn r1
+dec L205
+inc L60
+L317: cmp r4, #-144
+L318: .data 959, 854, 478
+L319: inc *r5
+rts
+add L67, *r7
+not L94
+bne L5
+bne *r0
+L320: prn #-193
+add L258, r6
+lea L315, *r4
+L321: cmp L243, #159
+jmp L75
+rts
+L322: .string "rvgkdnidarspjodjhptho"
+L323: not r3
+rts
+L324: red *r6
+L325: .string "oiprwcaj"
+dec r3
+L326: dec L296
+red r2
+red r7
+sub *r5, r1
+L327: .string "apr"
+add *r4, r1
+stop
+jmp *r6
+L328: cmp L162, #-85
+cmp *r3, #-177
+cmp *r3, r1
+red *r1
+L329: red r5
+bne *r2
+stop
+L330: .data -239, -457, 611, 909, 983, 908, 680, -834
+red *r6
+cmp L106, #-144
+L331: cmp L183, *r3
+add L170, r2
+inc L27
+mov #75, r2
+L332: .string "jvzvailazbrgckstqxqcfcz"
+L333: red L167
+stop
+cmp *r3, L187
+L334: rts
+dec *r5
+cmp r4, r6
+L335: .data 984, 89, 977, 102, 110, 127
+L336: not r7
+L337: sub #133, *r6
+
+L338: inc r5
+not L36
+L339: dec *r5
+jsr *r5
+L340: bne *r3
+dec r3
+; comment
+L341: prn L70
+L342: red L33
+rts
+L343: rts
+rts
+sub #26, *r6
+lea L69, r4
+sub r2, *r5
+mov r4, *r4
+L344: dec *r1
+L345: .string "fkzehkdeiqkfdvbaomenm"
+L346: .data -708, -141, -728, -43, 58, -703, -183, -21
+jmp L297
+sub L335, *r5
+jsr L153
+L347: lea L123, *r0
+L348: inc *r4
+jmp L75
+L349: clr L130
+L350: red L275
+L351: not *r7
+mov r2, L26
+add L66, *r4
+L352: clr *r0
+L353: cmp *r7, #-255
+stop
+add r6, r2
+dec *r4
+mov *r6, r2
+cmp #-41, *r3
+stop
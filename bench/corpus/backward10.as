@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 11
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+clr L80
+add L90, *r6
+not *r7
+clr r4
+L0: jmp L0
+mov *r1, L0
+not L0
+L1: clr L1
+sub #-173, L0
+stop
+prn r4
+; comment
+not *r7
+jsr *r4
+L2: jmp *r7
+prn #-221
+L3: not L2
+rts
+clr r4
+cmp r1, L1
+L4: .string "owxuxrmawixrideakq"
+lea L3, *r4
+L5: .string "rcgsjqhfcdljxvmwzys"
+mov L4, *r3
+bne *r0
+inc *r7
+L6: jmp *r7
+prn L6
+L7: .string "svwztmqj"
+L8: .data -666, 216
+cmp #-244, #151
+mov r5, L5
+L9: red L5
+; comment
+add *r6, *r4
+L10: .data 925, -80, -534
+L11: jsr *r2
+L12: .data 839, -172
+sub #-151, L10
+clr L4
+jmp *r2
+add *r4, r3
+rts
+L13: not *r2
+bne L5
+L14: stop
+prn r7
+prn L9
+lea L12, r2
+inc r3
+L15: lea L15, r4
+add L8, r0
+L16: rts
+prn *r4
+not *r3
+L17: dec *r3
+sub *r5, *r6
+jsr L8
+not *r5
+L18: bne *r0
+red *r7
+
+jmp *r2
+L19: .data -777, -868
+L20: bne *r7
+L21: prn *r7
+
+lea L17, L4
+not r1
+red L7
+L22: dec *r0
+lea L7, r5
+L23: mov *r1, *r2
+L24: .string "rqxgcuilebfccgnvyic"
+L25: red r5
+L26: .data -426, 948, 574
+jsr *r4
+jsr *r3
+jsr *r2
+add #212, *r2
+jmp L5
+; comment
+L27: .string "d"
+jmp L24
+L28: inc *r1
+
+L29: lea L5, L18
+lea L12, L1
+lea L1, r5
+L30: .data -539, 382, 664, 293
+L31: inc L24
+mov L12, L19
+stop
+red L2
+rts
+clr r5
+L32: inc L9
+jsr *r7
+L33: .data -470, 388, 526, -302, 91, -873, 699, -512
+
+stop
+jsr L24
+L34: bne *r3
+not L6
+sub r1, *r3
+rts
+inc *r3
+L35: red r2
+clr *r0
+clr L17
+not L25
+L36: jsr L31
+L37: .string "aobokejhudstpytlo"
+L38: inc r6
+bne L13
+prn #220
+L39: dec *r1
+bne L14
+bne L31
+rts
+cmp *r0, L31
+L40: .data -502, -174, -471, 44, -683, -971, 573
+L41: lea L20, r6
+bne *r4
+clr L8
+dec r2
+rts
+L42: .string "goyplvjvdpcwxtkzfbrnnd"
+jsr L11
+L43: .string "bzhpuwrwlxvwfjgdvypoqsba"
+L44: cmp r4, r5
+
+L45: clr *r3
+L46: .data 782
+dec *r0
+stop
+mov *r3, *r5
+sub #83, L44
+not r2
+; comment
+stop
+L47: dec L29
+mov *r6, *r2
+L48: rts
+jsr L5
+stop
+inc r5
+stop
+L49: jsr *r0
+lea L13, L47
+L50: cmp *r6, *r7
+sub #-170, r6
+not *r0
+L51: rts
+rts
+L52: jsr *r7
+rts
+lea L10, r7
+L53: .data -891, -156, -427, -646, -58, -363, -322
+L54: .string "rycvet"
+bne L24
+L55: rts
+not r7
+prn *r2
+L56: cmp r3, *r0
+L57: lea L33, r6
+L58: .data 77
+L59: .string "c"
+mov L29, L19
+prn #125
+sub *r1, *r4
+red L55
+L60: .string "hipbarvvh"
+add r4, *r3
+L61: jmp *r3
+mov L59, r0
+mov r5, L15
+L62: rts
+L63: bne L57
+jsr *r0
+bne *r5
+cmp r1, *r7
+L64: .data 798, 65, 576, 628
+mov r7, L38
+L65: bne *r6
+L66: prn r6
+stop
+rts
+jmp L9
+lea L46, *r2
+mov #152, L19
+stop
+rts
+sub *r2, L15
+; comment
+jmp L53
+L67: clr *r6
+sub r1, L5
+L68: not r3
+stop
+inc *r4
+inc r4
+L69: dec r7
+rts
+
+L70: not r4
+lea L32, *r2
+inc L44
+L71: rts
+L72: add L3, r2
+; comment
+rts
+stop
+L73: lea L65, *r2
+not *r5
+bne *r0
+L74: stop
+red *r0
+rts
+L75: .string "iiiqweyublekwv"
+bne L54
+prn #-45
+inc r5
+bne L51
+L76: .string "olnuydalon"
+L77: inc r4
+L78: not L70
+L79: .data -909, -161
+L80: sub *r7, r0
+L81: jsr *r5
+dec r0
+inc L50
+prn r5
+bne *r0
+L82: jsr L40
+mov r2, *r4
+
+prn L28
+inc r0
+jmp L23
+sub #117, L0
+L83: .data 921
+L84: cmp *r5, *r1
+cmp #-132, *r0
+L85: .data -631, 800, 564, -443, 527, 991, 987
+jmp L18
+L86: .data 458, 973, 24, -95, 577, -245, 316, 645
+not *r4
+lea L76, *r1
+L87: .string "cqxlq"
+jmp *r2
+L88: red *r4
+clr r7
+L89: .string "obqc"
+L90: stop
+cmp r0, #2
+red r3
+L91: lea L84, *r3
+mov r4, r5
+L92: not L32
+L93: .string "qqj"
+prn #-220
+L94: .string "zirzupdtcwtygewtycbx"
+L95: jsr L66
+mov *r2, r2
+rts
+L96: .string "alkikorkxhkjijdpwwvume"
+inc *r6
+clr L23
+L97: jmp L33
+prn r7
+rts
+rts
+mov *r2, *r4
+L98: jsr *r2
+prn r5
+L99: dec L20
+L100: cmp *r5, r5
+L101: lea L50, r4
+L102: mov r5, L16
+stop
+L103: clr L91
+stop
+L104: cmp *r3, #255
+stop
+clr r0
+jmp L14
+mov #-20, L55
+L105: red L76
+lea L61, L98
+dec r4
+not L93
+cmp L5, *r6
+mov L6, r7
+L106: bne L70
+sub L28, *r0
+jmp *r1
+stop
+clr L7
+prn *r4
+mov L54, *r3
+L107: not L52
+jmp *r5
+jmp *r3
+L108: not *r3
+stop
+L109: .data -467
+lea L65, r5
+jmp L12
+L110: .string "ukatvkxhbtrvzndcwcg"
+dec r0
+L111: .string "sk"
+add #-210, *r7
+inc L42
+cmp r0, L37
+not L56
+mov r4, r6
+rts
+inc L32
+L112: not r3
+red *r0
+sub *r5, L107
+L113: inc *r7
+not r6
+lea L87, L84
+L114: rts
+L115: .data -306, -792, -715, 790, 793, -832, 547
+inc *r1
+L116: jmp *r3
+stop
+L117: dec r5
+L118: stop
+cmp L58, L12
+jsr L18
+lea L47, r0
+L119: lea L50, *r0
+L120: inc L43
+inc *r0
+jmp L40
+; comment
+inc r0
+; comment
+bne L36
+bne L3
+clr L9
+rts
+
+L121: jmp *r5
+L122: .string "gywvz"
+bne L54
+cmp #-96, r7
+not *r1
+inc L81
+red L92
+L123: .data 744, -324, -363, -911, 982, 335, -852, -636
+dec L9
+not *r1
+rts
+L124: bne L54
+L125: .data -840, -197, 547
+add *r1, *r4
+L126: red *r2
+mov r6, *r1
+
+L127: lea L112, L45
+red *r3
+lea L65, L6
+L128: .string "klugcv"
+L129: .string "q"
+prn L87
+
+jsr L90
+dec L124
+L130: .string "iduvvmqm"
+L131: sub r7, r4
+add r3, L15
+dec *r0
+L132: add L105, L11
+L133: mov L89, r0
+mov L132, L20
+red *r7
+mov L16, *r7
+L134: .data 347, 834
+red r2
+red r3
+inc r5
+red L6
+L135: prn *r4
+rts
+clr L2
+L136: add r1, L115
+red L21
+L137: clr *r7
+L138: prn #-255
+L139: not L42
+L140: inc L137
+dec r4
+L141: lea L72, *r6
+cmp L85, L78
+; comment
+prn *r0
+L142: prn r2
+inc L28
+
+jmp *r1
+jmp *r0
+L143: inc *r4
+clr L75
+jsr L49
+L144: lea L112, r0
+L145: bne *r1
+L146: jsr *r7
+lea L40, L20
+L147: not r2
+lea L1, L116
+L148: sub r7, r6
+inc r1
+clr *r4
+L149: sub r0, L124
+dec *r1
+sub *r7, r4
+jmp *r0
+L150: .data -1000, -575, 504, 870
+lea L29, *r6
+L151: .string "yklleqfi"
+inc r7
+jmp *r3
+L152: stop
+red L144
+L153: clr *r7
+rts
+L154: jmp L145
+add *r5, r2
+L155: mov L51, r2
+stop
+rts
+add L144, r7
+clr r4
+L156: clr r3
+L157: cmp r0, *r2
+clr L7
+L158: dec L106
+L159: .data -548, -582, 517, 152, 416, 968, -52
+inc *r4
+prn *r1
+L160: prn r4
+cmp r2, r2
+L161: .string "yorackgcmqglf"
+L162: .data -467, -456, 79, -898, 459, -326
+L163: mov *r1, r2
+add #-99, L102
+bne L15
+jsr L36
+L164: .string "dmiugtnkdglpubixrczqm"
+lea L18, r2
+mov L70, r4
+cmp *r0, r4
+sub r7, r3
+L165: .data -64, 146, 263, -937, 149, 81
+L166: inc L130
+L167: lea L78, r3
+L168: jmp *r7
+L169: lea L21, r5
+clr r7
+L170: .string "iykwhkljsshxnxzfezqktron"
+cmp L47, #149
+dec L163
+clr L42
+L171: clr r4
+L172: jsr L49
+red *r1
+L173: inc r7
+L174: cmp L23, *r3
+red r0
+inc L161
+L175: mov #108, r6
+not L92
+L176: .data -328, 273, -743
+bne *r4
+jmp *r4
+jsr *r5
+not L22
+lea L19, *r2
+
+L177: bne L82
+; comment
+dec r0
+red *r2
+sub *r5, *r6
+prn *r6
+L178: inc r4
+clr r5
+prn *r0
+inc r2
+L179: dec L111
+L180: jsr *r6
+L181: sub #-63, r7
+inc r2
+L182: .string "emnalyluwp"
+jmp *r5
+dec L130
+L183: sub L133, L73
+prn *r5
+L184: prn #184
+cmp #-217, #85
+bne L153
+cmp *r6, *r2
+bne L61
+bne *r3
+L185: lea L37, L98
+L186: red r6
+add r5, *r0
+cmp #129, *r7
+L187: red *r4
+mov r2, r7
+add L155, *r2
+jmp *r7
+inc *r2
+L188: .string "omzqrtedcvzg"
+L189: bne *r5
+prn r2
+sub L2, L23
+stop
+L190: rts
+red r3
+L191: prn L174
+L192: .data -195, -159, -118, -382
+inc *r7
+
+prn r5
+cmp #-184, *r3
+prn #-56
+prn #137
+L193: mov r5, r0
+L194: lea L170, *r5
+rts
+L195: jmp L170
+L196: inc *r0
+; comment
+L197: dec *r0
+jmp L187
+sub *r7, r4
+; comment
+prn #214
+rts
+jsr L172
+L198: .data 322, -392, -679, 366, -483, -325, 792, 573
+clr *r4
+red *r4
+bne *r6
+; comment
+L199: .string "nverbpw"
+bne *r1
+stop
+L200: clr r2
+red *r1
+L201: add *r3, r2
+dec *r4
+L202: dec *r6
+prn *r4
+sub L42, r5
+L203: .string "onboqiseadzqnyfjsmqcyfm"
+mov #-197, r4
+L204: lea L176, *r0
+lea L108, r5
+L205: .string "icncbhqwtimxlqymc"
+L206: not *r2
+not *r5
+cmp L91, L149
+L207: prn r0
+L208: clr L12
+prn *r7
+inc *r2
+stop
+add *r3, L127
+mov r4, L139
+L209: not *r3
+cmp #-112, r2
+bne *r5
+
+not r4
+L210: inc *r2
+L211: .string "zbbncchtpbsnt"
+clr r4
+stop
+sub L202, L17
+inc r7
+lea L96, L20
+L212: bne *r5
+bne *r3
+L213: .data 72, 643, 12, 168
+L214: sub r6, *r6
+inc *r6
+red L12
+dec r5
+red L160
+L215: add r2, *r5
+red *r5
+red L28
+L216: cmp L11, L99
+L217: sub L172, r2
+jmp *r0
+dec L175
+sub *r4, *r0
+dec *r3
+L218: rts
+cmp L189, L197
+add r4, L43
+L219: dec L174
+add r6, L152
+jsr L81
+red r3
+L220: inc r1
+cmp #-77, r1
+L221: not r0
+L222: .string "t"
+L223: stop
+rts
+add L217, r0
+L224: not *r2
+L225: stop
+; comment
+clr r0
+L226: inc L155
+red r3
+stop
+L227: jmp L10
+L228: bne L81
+bne L141
+jmp *r0
+jsr L161
+not L94
+add #58, *r4
+
+mov #-210, r4
+L229: not r2
+mov L227, L59
+add *r5, L213
+red r4
+L230: mov r4, *r3
+mov #166, L144
+not L211
+red L127
+L231: bne *r7
+L232: .string "fulhdmmj"
+inc L108
+rts
+jmp L48
+prn r4
+inc L114
+dec r3
+dec L160
+L233: not *r6
+L234: .string "akmqenyabbjhphbnhugy"
+not r0
+L235: lea L186, *r0
+jmp *r4
+L236: inc *r1
+mov L57, L78
+L237: not *r4
+L238: dec *r3
+L239: add L113, r7
+prn r6
+jmp L65
+L240: jsr *r0
+L241: .data 963, 270, 873, -877, 48
+inc L227
+red *r7
+add L236, *r4
+L242: .data 913, 493, -581
+L243: inc r5
+lea L181, L165
+L244: lea L173, r0
+L245: stop
+L246: .data -80, -242, 755
+
+not L187
+; comment
+L247: .data 940
+jmp L55
+L248: not *r0
+L249: .string "btbtoixzfctiulj"
+red r7
+jmp L226
+L250: .string "wzxbvoovmxcoteei"
+bne L202
+L251: cmp L139, #249
+L252: lea L111, L2
+clr r4
+L253: sub L201, L43
+L254: bne *r6
+L255: not *r4
+L256: inc *r1
+L257: .string "tkkjds"
+L258: dec r5
+inc r3
+jmp *r1
+L259: jmp *r7
+L260: .string "wiawhjfijelotpwna"
+
+cmp L194, r5
+stop
+inc *r2
+not r5
+dec *r3
+
+L261: rts
+jsr *r7
+stop
+lea L123, L64
+L262: inc *r2
+; comment
+not *r3
+dec L124
+L263: cmp *r3, #138
+L264: mov r1, L120
+mov r6, *r1
+cmp L120, r3
+L265: sub *r1, *r7
+L266: prn *r3
+rts
+
+sub r0, r0
+clr L240
+add r2, L32
+L267: .string "anfqmdxksqwnejivudiintiz"
+lea L256, r5
+L268: .data -599, -508, -838, -184, -28, -586, 793, 753
+L269: not r7
+rts
+; comment
+L270: .string "lhktwnjqdfvgetzaxojkr"
+sub #201, *r6
+
+L271: inc r7
+; comment
+L272: stop
+inc *r3
+L273: inc *r7
+not L245
+L274: jmp *r2
+dec L245
+add *r7, L78
+L275: red *r5
+jsr *r3
+red L23
+not r4
+L276: inc *r5
+
+red r0
+L277: cmp #29, *r2
+red L247
+stop
+jmp L59
+clr *r2
+add #248, *r3
+L278: sub #-124, L103
+not *r0
+jmp *r2
+stop
+L279: stop
+; comment
+L280: rts
+mov L104, L262
+not r0
+
+dec *r7
+L281: prn r0
+inc *r1
+L282: .string "cfuoe"
+jsr *r2
+clr *r6
+L283: .string "ricdfrmjcmdhcc"
+lea L195, L108
+L284: jsr *r0
+dec L283
+add r4, r4
+jmp *r3
+sub r3, L147
+clr r7
+clr r1
+
+jsr L190
+prn r1
+L285: clr L114
+lea L92, r5
+L286: mov r5, L227
+jmp *r1
+sub r4, L224
+jsr L260
+
+prn #-74
+L287: .data -658, -462, -861, -970, 812, 752, -194, -418
+cmp r4, #-62
+L288: dec r2
+prn *r2
+; comment
+clr L55
+jsr *r3
+sub L253, L26
+stop
+inc L40
+L289: stop
+L290: .data 687, -221, 796, -31
+add *r7, *r4
+L291: red *r7
+jmp *r0
+
+L292: rts
+not *r1
+cmp #-237, r7
+lea L40, L240
+prn #-125
+add *r2, L146
+stop
+rts
+L293: add L165, *r1
+prn *r4
+prn #-106
+stop
+L294: stop
+rts
+L295: .string "e"
+add L167, *r2
+L296: .data -291, 64, -75, 943, 588
+L297: jsr L16
+cmp r3, r6
+
+; comment
+bne L245
+cmp L74, L253
+L298: add #21, *r0
+inc *r2
+cmp #171, r2
+inc L102
+mov *r6, r5
+L299: .data 942, -624, -452, -963, 269
+stop
+jsr L217
+bne *r2
+
+L300: clr r0
+cmp L176, r1
+stop
+L301: clr r1
+jmp *r0
+add *r3, r4
+prn L51
+L302: sub *r2, *r1
+cmp r6, r3
+L303: jmp L174
+dec *r3
+jsr *r4
+cmp #0, #23
+inc L115
+L304: dec *r3
+L305: .string "qz"
+
+dec r6
+L306: mov #-221, *r2
+L307: .string "jvl"
+not L90
+L308: .string "ehfy"
+stop
+stop
+mov *r5, r7
+mov #-63, *r4
+sub L59, *r0
+L309: .data -860, -242, 263, -810, 798, -141
+sub *r4, *r4
+L310: .string "e"
+add r1, r3
+L311: dec L181
+sub r5, r6
+not *r1
+L312: .data -683, -459, 134, 533
+L313: stop
+L314: red L42
+L315: sub *r0, L133
+stop
+dec r1
+jmp L76
+inc *r2
+L316: dec L10
+L317: clr r2
+stop
+rts
+rts
+rts
+jmp L9
+bne *r2
+L318: stop
+jsr L84
+L319: prn r5
+L320: lea L54, *r0
+mov L145, L302
+L321: clr L76
+L322: .data 954, -699, -105, -949, -579, -162
+lea L209, *r1
+dec *r1
+stop
+L323: .string "r"
+jmp *r3
+mov *r2, L292
+dec L170
+L324: .string "ffy"
+cmp *r1, L99
+not L277
+cmp L289, *r7
+add r2, r7
+clr r6
+; comment
+jmp L180
+stop
+not *r0
+
+L325: red L164
+add r6, *r0
+dec r4
+not *r3
+; comment
+prn #63
+L326: .string "ivsvlyvfgeiknnsoowqf"
+not *r7
+L327: clr r7
+jsr L322
+jsr *r7
+jmp L301
+L328: inc L289
+add L71, r4
+add *r3, L311
+clr r2
+
+not r2
+prn L187
+prn r2
+bne L171
+L329: .string "etszxyb"
+jmp L70
+not L48
+inc *r2
+prn #-178
+
+lea L23, L219
+rts
+inc r1
+L330: inc L236
+L331: add *r3, r7
+L332: .string "izbcsacjgvigfcuszgezxyof"
+prn #-184
+jmp L205
+prn r7
+inc L47
+
+L333: clr *r2
+bne *r5
+jmp L304
+L334: .string "aunm"
+L335: red *r0
+stop
+L336: not L157
+dec *r2
+stop
+L337: inc L133
+L338: cmp L223, L334
+L339: bne L76
+L340: prn *r5
+stop
+L341: .string "zfvixmugsilzier"
+L342: jsr L309
+stop
+stop
+stop
+L343: mov *r5, r0
+jmp *r7
+not *r7
+lea L25, L232
+cmp r0, *r4
+
+L344: jmp L108
+dec L307
+L345: stop
+L346: bne *r4
+bne L217
+L347: lea L345, r4
+L348: .string "iuccrwqqyjkamtx"
+mov L342, L73
+stop
+stop
+jsr L303
+lea L179, L300
+L349: cmp #-18, *r6
+bne L239
+L350: stop
+prn L64
+L351: rts
+jsr L234
+rts
+; comment
+red L4
+stop
@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 12
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+jmp *r6
+bne L39
+prn #132
+add *r0, L337
+clr *r7
+mov #117, *r1
+red L239
+clr *r3
+L0: .data -764, -500, 679, 918, -126, -367, 711, 704
+rts
+
+mov r4, L0
+prn #248
+mov #85, *r2
+L1: red *r0
+rts
+cmp *r1, *r4
+add #106, r5
+cmp L0, r5
+mov #-254, *r3
+L2: mov *r5, L2
+L3: .string "ehnycdsncueqerbhldcyv"
+lea L2, L3
+L4: jmp *r4
+add *r4, r6
+cmp r2, #161
+stop
+; comment
+dec *r2
+clr *r6
+prn L2
+L5: .string "flwohuwbx"
+; comment
+L6: sub L2, L0
+lea L0, r6
+prn r6
+stop
+prn #-16
+L7: jsr *r3
+L8: .string "agyifdkmfxcwbnzfn"
+L9: stop
+clr *r4
+L10: .data 250, -170, -454, 438, 910, 797
+cmp *r3, r2
+mov L7, r4
+mov r2, r5
+sub *r6, r1
+L11: bne L2
+not r6
+; comment
+bne L4
+
+jmp *r7
+jsr L6
+L12: jsr L1
+L13: add #-24, *r4
+add r2, *r5
+not r6
+L14: .string "yqnfkadgfkhfxswdbzsnu"
+not L10
+jsr L1
+sub L5, L11
+L15: mov #-242, r3
+L16: jmp L4
+stop
+stop
+jsr L10
+L17: prn r4
+red r2
+L18: cmp #249, r4
+add #38, L7
+L19: cmp L4, *r6
+; comment
+rts
+dec L15
+L20: cmp *r1, *r0
+L21: prn r0
+L22: lea L18, *r2
+L23: rts
+L24: stop
+not *r7
+red L6
+stop
+L25: prn *r4
+bne L21
+L26: lea L7, r0
+clr r1
+prn *r1
+jsr *r6
+prn L1
+rts
+not L1
+L27: .string "rylfgqacscekekqzps"
+L28: red L18
+L29: mov *r4, *r1
+stop
+L30: cmp *r6, r4
+L31: add r5, L18
+jsr *r3
+rts
+jmp *r4
+L32: mov #-117, r1
+clr r6
+clr r4
+add *r4, r2
+lea L23, r2
+mov *r5, *r4
+cmp #-156, L15
+rts
+L33: jsr *r4
+
+jsr *r7
+stop
+L34: .data -979, 509
+jmp L15
+; comment
+clr r1
+L35: .data -964, -850, 63, 215, 309, -664
+bne L28
+rts
+L36: sub #114, L8
+jsr *r6
+jmp *r6
+jmp *r4
+mov #-20, r2
+; comment
+L37: cmp #-228, r3
+sub #163, r6
+not r7
+not L7
+clr r6
+L38: .data -991, 344
+L39: .string "paedsjpjrnagxhngnwstjv"
+inc r1
+prn r2
+stop
+jmp L1
+L40: bne *r0
+bne L4
+L41: jmp L27
+sub #-11, *r5
+L42: cmp r1, #236
+L43: inc L18
+stop
+L44: red r1
+lea L13, *r5
+cmp #-88, L8
+L45: dec *r2
+L46: jsr *r7
+L47: sub #-13, L13
+inc L14
+L48: bne L38
+; comment
+; comment
+rts
+
+L49: .data 568
+bne L0
+L50: add *r3, L22
+bne *r3
+cmp *r1, L7
+jmp L25
+L51: add *r6, L1
+not *r3
+sub #232, *r0
+red L17
+cmp #-251, *r4
+cmp *r0, L46
+L52: .string "ocmndgnbdxtfmiwskqv"
+L53: add r4, *r3
+
+not L21
+L54: add *r1, *r1
+jsr *r4
+inc L13
+inc L6
+; comment
+L55: .data 392, 713, -187, -470, -687, -354, 519
+L56: .string "frlszyjfqwmldgaxolljtvsz"
+lea L5, *r5
+inc r4
+jsr *r6
+jmp L30
+prn #-85
+bne L24
+stop
+
+not r0
+
+L57: clr r2
+L58: .data 23, 808, 972
+mov L47, *r0
+L59: .string "xgxnqlorfae"
+prn *r1
+lea L55, r1
+bne *r6
+L60: .data 979, 833
+L61: .string "ynlwjujcskwpkxsktlxplq"
+L62: stop
+L63: jsr L27
+jmp L5
+L64: .string "ucdusrvzbjnebz"
+L65: .data -319, -790, 110, -733, -534, 69, 435, 327
+sub r7, *r1
+L66: .data 759, 208, 239, -901
+L67: prn *r2
+sub *r6, *r5
+red L2
+L68: mov L61, L26
+jsr *r2
+L69: .data -478, -975, -97, -575, -909, 482, 332
+rts
+bne L28
+prn #134
+L70: .data -575
+L71: stop
+jmp *r0
+L72: add L60, *r1
+L73: cmp *r0, #-149
+L74: bne *r6
+L75: sub #191, r6
+inc L2
+L76: sub L15, *r7
+L77: jmp L56
+L78: bne *r5
+not L42
+L79: add *r1, *r7
+inc L20
+bne *r6
+rts
+lea L63, L13
+not L33
+jmp L48
+stop
+
+dec *r2
+L80: cmp #-165, L43
+inc L28
+jmp *r1
+L81: rts
+
+bne L45
+add *r3, *r7
+
+L82: prn #101
+cmp *r5, #-214
+not r1
+L83: jsr L26
+stop
+lea L71, *r3
+stop
+L84: jmp *r5
+cmp #21, r7
+inc *r3
+red L53
+
+cmp *r3, *r0
+jmp L77
+L85: dec r3
+stop
+mov #189, *r3
+L86: bne L73
+rts
+jsr L69
+bne L21
+prn r7
+L87: .data -45, -881
+L88: .string "iz"
+inc L75
+
+L89: add L48, r3
+L90: inc r4
+not L11
+L91: .string "ddbwpunjkpiko"
+rts
+jmp L53
+L92: sub L63, r7
+L93: lea L31, *r1
+L94: stop
+L95: clr L31
+jsr *r7
+sub *r2, *r2
+L96: lea L31, r1
+L97: add *r1, L35
+L98: sub r7, *r3
+L99: lea L91, *r7
+not *r3
+red *r4
+L100: clr *r7
+; comment
+add #-67, *r7
+lea L20, *r4
+L101: inc *r0
+clr *r7
+not L37
+L102: .string "xnsfcg"
+dec r6
+jmp *r0
+lea L2, L100
+cmp r5, *r7
+bne *r0
+clr r7
+sub #58, r3
+stop
+dec *r3
+L103: .string "nraiikcuwvjr"
+L104: sub *r3, r1
+sub #160, *r0
+L105: .data -843
+L106: rts
+L107: .data 342, 610, 944, 504, -708, 122, 568
+red *r0
+lea L86, r4
+; comment
+; comment
+bne *r4
+sub *r3, *r7
+cmp L103, L0
+L108: .string "vjllmp"
+L109: clr *r4
+inc *r3
+stop
+not r6
+add #-213, L104
+
+inc L27
+sub r2, *r3
+bne *r7
+L110: inc *r3
+L111: cmp r7, L85
+L112: .data -583, -402
+clr L83
+lea L56, r6
+jsr L33
+L113: .string "p"
+L114: dec r6
+stop
+dec *r1
+add #-214, *r5
+L115: .data 544, 693, -321
+jmp L26
+L116: cmp *r0, L62
+jsr L62
+L117: cmp L5, #-76
+clr L88
+jsr *r0
+jsr L75
+sub #-114, r4
+L118: .string "am"
+mov *r6, L37
+L119: clr *r6
+inc *r4
+L120: .string "mzcqjnzmxfxfsi"
+L121: .data 145, -49, -610, 319, 422, 16, -658
+L122: .data 854, -433, 394
+inc L91
+L123: not *r0
+sub #57, r7
+L124: cmp #-14, #197
+L125: .data 83, -971, -64, -866
+add #-144, *r1
+clr *r6
+
+L126: clr r4
+bne *r5
+inc r6
+rts
+L127: red L92
+L128: cmp *r7, *r4
+cmp L5, *r4
+add #-243, r7
+L129: jsr *r7
+not r7
+clr *r5
+red r2
+L130: not L109
+rts
+add #6, r0
+mov #180, r1
+L131: jsr L107
+mov r0, r5
+
+inc *r4
+L132: mov L5, *r1
+clr r2
+L133: sub r2, L86
+lea L60, r6
+dec r3
+clr *r3
+sub r6, *r7
+sub r4, *r7
+jmp L92
+L134: clr *r1
+prn r6
+rts
+inc *r2
+dec L3
+mov #-242, *r7
+L135: .data 291, 585
+rts
+dec L118
+clr *r1
+lea L73, L11
+jmp L110
+jsr *r3
+rts
+L136: .string "lysnneejhwkpse"
+L137: .data -311, -665, -993, -81, -682
+jmp *r5
+not *r0
+L138: .data -996, -669, -875, 188, 20, -874, -476, 353
+not r4
+L139: stop
+rts
+L140: dec r2
+sub *r7, r5
+L141: sub *r0, L119
+clr L47
+rts
+dec L73
+L142: .string "yxahciypgcgsoqgm"
+L143: .string "joannufq"
+
+bne *r3
+add *r1, L44
+L144: .string "lnvzsffpbk"
+L145: clr r0
+cmp L25, #-61
+L146: .string "bbfiu"
+L147: dec r6
+L148: jmp *r5
+L149: rts
+dec *r7
+bne *r0
+L150: inc L40
+add r3, L24
+clr r0
+jmp *r3
+
+prn r3
+inc L110
+L151: jsr L12
+L152: prn *r4
+L153: jsr L57
+prn *r4
+prn #-166
+add L66, r4
+sub *r6, r2
+dec r1
+
+sub *r0, L55
+rts
+lea L6, *r0
+L154: .string "lsbojzlogo"
+L155: .string "lfhtvlsyecyu"
+L156: rts
+L157: sub *r3, *r7
+clr L107
+lea L48, *r5
+lea L45, r4
+red L21
+clr r6
+bne *r0
+inc *r1
+not L128
+L158: mov #-231, L46
+inc L50
+L159: .data -281, 298
+jmp L29
+red L2
+prn L57
+cmp r5, L80
+stop
+rts
+stop
+jmp L115
+L160: .data 107, 297, -723, 38, -657, -289, -383, 233
+bne L106
+L161: inc L43
+mov L79, L70
+; comment
+L162: clr L70
+dec *r1
+mov #214, *r4
+not r5
+not r6
+red r0
+jsr *r1
+; comment
+add r6, L126
+add #120, r7
+lea L113, r6
+not L52
+L163: prn L73
+
+jsr L42
+L164: rts
+add L99, *r2
+rts
+
+red *r5
+jmp *r3
+clr *r2
+lea L89, *r4
+mov r1, L17
+jmp L111
+L165: .string "lvjnetskdcinwtrgsrisuyed"
+L166: lea L66, L38
+L167: rts
+L168: sub L64, r0
+rts
+cmp r4, L107
+L169: jsr L162
+clr r7
+add r1, r5
+L170: .data 118, 156, 442, -337, 802
+; comment
+L171: jmp *r0
+not L155
+L172: not *r4
+; comment
+L173: add r6, *r4
+L174: prn *r4
+L175: .data 777, 911, 846, -950, -750, -321, -920, 818
+dec *r1
+; comment
+clr *r2
+cmp *r7, r5
+dec *r1
+clr r4
+dec L171
+L176: prn #147
+clr *r3
+jmp *r4
+L177: .string "rtaynvhxmrfncwuzggcmorp"
+sub #39, *r2
+clr r6
+jmp *r6
+L178: bne L93
+not *r4
+not L94
+
+L179: jsr L110
+L180: .string "oufolstqj"
+L181: dec L99
+
+L182: .string "azblozzlhxq"
+L183: not r1
+L184: prn r0
+clr r1
+jsr L75
+L185: mov r3, *r4
+not r7
+sub #-164, L22
+L186: mov r0, L56
+mov L22, L93
+L187: .data 362
+sub #132, r5
+mov r1, *r6
+L188: .data 402
+red *r2
+L189: lea L15, *r2
+clr *r1
+inc L12
+L190: sub r4, *r0
+clr L139
+jmp L78
+mov *r7, *r7
+prn r3
+L191: .data 27
+L192: dec r5
+sub #-102, L73
+jmp *r7
+L193: .string "azgr"
+L194: bne *r7
+
+jmp L43
+not r5
+mov L4, *r6
+L195: stop
+rts
+L196: rts
+jsr *r2
+sub L70, L179
+rts
+L197: sub #-26, L70
+L198: .data -459, 572, 116, 207, 832
+L199: .data 595, -140
+L200: inc *r3
+
+jmp *r4
+sub *r6, L30
+clr *r2
+red L126
+L201: mov *r4, L99
+sub r3, *r2
+sub r1, *r7
+L202: inc L17
+not *r5
+red L127
+red *r0
+L203: clr *r0
+bne L99
+inc r5
+mov #117, r2
+lea L48, r3
+jsr *r3
+bne *r3
+L204: sub L200, L43
+L205: .string "jrmsgo"
+L206: jmp L47
+
+bne L118
+lea L77, r7
+L207: bne *r1
+bne *r7
+sub *r7, r2
+L208: lea L143, *r2
+L209: bne *r5
+dec L185
+bne *r1
+dec *r6
+L210: inc L178
+
+L211: lea L101, *r2
+dec r0
+L212: .string "cxkdyzsljzyzld"
+L213: .string "eicqzbdzc"
+cmp r5, L56
+mov *r5, r5
+clr r3
+L214: bne L174
+cmp r1, #126
+clr r7
+stop
+red L134
+red *r2
+L215: add #59, *r2
+L216: stop
+clr *r2
+not L110
+; comment
+clr r3
+L217: stop
+stop
+lea L95, r0
+L218: not r4
+lea L127, r4
+sub *r1, *r2
+mov #216, *r3
+clr *r5
+not *r4
+L219: sub r3, *r0
+dec *r4
+jmp *r4
+clr L135
+rts
+L220: .data 917, -573, 674, -894, 20, -16, 770, 553
+jmp L185
+prn L179
+lea L39, L195
+L221: .data -955, 925, 677, -511, -326, 303, -622, 347
+sub #207, r5
+cmp #241, L16
+L222: dec r7
+bne *r6
+clr L194
+; comment
+lea L2, *r6
+inc r3
+L223: not L101
+; comment
+L224: red *r7
+jmp *r1
+clr *r2
+L225: rts
+jmp L52
+jsr L139
+jmp *r4
+rts
+L226: inc r5
+L227: sub *r5, *r2
+lea L136, L155
+L228: lea L27, *r5
+jsr *r1
+L229: rts
+dec r5
+bne L7
+rts
+stop
+L230: stop
+; comment
+
+; comment
+prn r4
+lea L150, *r3
+L231: jmp *r1
+bne *r4
+jsr *r3
+L232: .string "ffzkmyrhknviwygdhctiqa"
+not *r7
+L233: .data 492, -639, -99, -998, -43, -571
+not L74
+L234: red r0
+L235: .string "pezrzpnqqwakttkikzfbkf"
+jsr L21
+bne L29
+bne L136
+jsr *r0
+inc r6
+
+not *r6
+not L45
+L236: cmp L230, #-41
+jmp *r6
+cmp *r4, *r3
+not L187
+prn *r2
+jmp *r3
+L237: prn *r0
+bne *r5
+add #34, *r3
+mov #-229, r1
+sub L195, *r7
+inc r0
+add r4, r4
+inc L5
+jsr L184
+L238: inc L75
+L239: .string "thjsjtkgetnmxu"
+not *r3
+mov r1, r4
+add #96, *r4
+jsr L206
+L240: lea L10, L232
+cmp #-69, L52
+prn r0
+cmp #225, L21
+
+cmp r3, *r7
+L241: mov *r4, r0
+L242: .string "ldnokmpghud"
+dec *r6
+L243: dec r5
+L244: stop
+red r0
+stop
+L245: clr *r2
+lea L183, r2
+prn #41
+jmp L206
+dec r2
+cmp #170, L28
+jsr *r6
+stop
+L246: sub r5, L37
+mov *r4, L91
+L247: .data -747, -235, -210, -734, 21, 746, -311
+inc r5
+cmp L2, L54
+L248: inc L111
+lea L172, L143
+L249: mov #-93, L77
+dec L152
+add #4, r3
+mov L113, r6
+L250: sub L100, *r7
+prn L173
+mov *r3, *r1
+jmp *r3
+mov r3, r6
+
+L251: sub *r1, *r5
+L252: .data 281
+L253: jsr *r6
+mov #99, L156
+L254: .data 416, -610, -395, -439, 491, 720
+L255: inc r1
+cmp *r7, #252
+not *r4
+L256: clr L178
+jmp *r2
+inc L80
+jmp *r2
+sub #85, L39
+rts
+L257: dec r2
+cmp L213, r0
+cmp r6, #58
+stop
+rts
+L258: .string "tj"
+L259: .data -399, -330, 599, -784
+L260: jsr L216
+L261: cmp L160, #156
+inc r5
+prn L11
+L262: add #-64, L19
+L263: not r7
+L264: not *r2
+jmp L23
+red L66
+L265: sub *r2, r6
+L266: lea L8, r7
+L267: red L248
+
+L268: cmp r3, L201
+bne L3
+rts
+L269: inc r4
+L270: .string "cjbtxk"
+jmp L85
+L271: not L268
+L272: stop
+dec r2
+add r7, L231
+not L23
+not *r4
+lea L222, L227
+dec L190
+jsr *r5
+L273: mov L18, r0
+L274: lea L36, r7
+L275: add *r1, *r4
+dec L78
+L276: prn r1
+inc r1
+rts
+L277: .data 338, 514, 350
+clr L151
+lea L95, r3
+not *r5
+L278: inc r3
+
+L279: jsr *r5
+clr r2
+L280: .data 371, 261, 892, 812
+mov #82, *r7
+add r3, *r3
+lea L3, L238
+L281: stop
+
+L282: prn r2
+L283: prn *r0
+not r4
+L284: rts
+red L226
+jsr *r5
+clr *r2
+
+L285: .string "ukoji"
+red r4
+prn *r1
+mov #-201, *r1
+L286: stop
+stop
+add *r6, *r4
+sub *r1, r6
+L287: dec r4
+L288: prn *r4
+L289: not *r7
+inc L257
+bne *r2
+red r7
+clr r3
+sub L241, r6
+prn *r5
+L290: lea L204, r0
+mov r5, L197
+L291: .string "oxctiglsvwqcbfr"
+mov #-232, *r5
+L292: bne *r6
+stop
+L293: clr r4
+L294: prn r7
+jmp *r3
+not *r4
+L295: sub L31, *r6
+jsr L70
+L296: .string "npqkrhe"
+rts
+L297: red L296
+L298: clr r2
+red L151
+L299: stop
+
+L300: bne *r4
+L301: clr r4
+jsr L209
+cmp *r7, r4
+L302: .string "zpnaqj"
+mov L155, L286
+sub r1, *r7
+inc L279
+not r1
+L303: lea L298, L140
+add L254, L216
+mov #-70, *r3
+not r4
+L304: stop
+L305: mov L19, *r0
+L306: .string "bpoyvrha"
+jmp *r1
+L307: .data 468
+L308: sub L67, L138
+L309: mov *r6, *r2
+cmp *r4, *r6
+L310: clr L43
+L311: lea L307, L6
+L312: add *r2, r4
+L313: .data -211, -248, -831, 713, -77, 903
+add #219, L43
+red r1
+add L14, *r6
+
+stop
+L314: lea L292, *r4
+L315: not r4
+jsr *r2
+L316: sub *r6, r1
+inc r5
+rts
+L317: .data 838, 530, 564, 693
+jmp *r2
+L318: inc *r4
+L319: cmp r7, L171
+rts
+L320: .string "lbmkthzmhovvdcogregj"
+L321: cmp r5, #-3
+mov r2, *r2
+L322: .data -721
+red r3
+mov r4, L217
+prn #-128
+jmp L229
+jsr *r7
+inc L101
+L323: bne L30
+jmp *r7
+; comment
+jmp L220
+L324: inc L312
+L325: red *r2
+bne *r0
+mov r7, *r4
+rts
+L326: mov *r6, r4
+bne *r6
+L327: bne *r0
+sub r6, r5
+lea L306, L199
+sub L266, L294
+jsr *r2
+L328: .string "ewbqtdpmztpp"
+cmp r5, r7
+prn r4
+add #91, r4
+L329: sub L65, *r7
+clr L32
+red *r5
+red r7
+L330: red L162
+L331: .string "tzehommuu"
+dec r7
+L332: cmp *r7, r5
+inc r6
+L333: dec L258
+L334: .string "hyolxkwpxfge"
+L335: dec *r6
+lea L125, *r7
+not r6
+L336: lea L61, L122
+mov #-130, r1
+bne *r5
+inc *r6
+L337: inc *r6
+not L277
+L338: .string "vjqvfgsbp"
+add *r7, *r3
+L339: rts
+not r0
+L340: .string "bpiuuh"
+rts
+prn #-229
+rts
+sub L339, r4
+L341: rts
+dec L270
+bne L53
+rts
+L342: clr r0
+cmp *r1, r6
+cmp L293, *r7
+lea L158, *r1
+; comment
+dec L103
+jsr *r1
+L343: clr L76
+L344: dec L110
+bne *r4
+stop
@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 13
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+clr *r4
+add #135, L297
+L0: bne *r1
+mov r1, *r3
+prn L0
+inc *r2
+cmp r1, #205
+dec r0
+add #-173, r5
+L1: prn r5
+L2: .string "twsdeujunpvgeoyte"
+L3: rts
+L4: inc r5
+jmp L3
+dec *r3
+L5: sub L4, r4
+rts
+jsr L5
+clr L0
+L6: bne *r4
+rts
+red r4
+clr L6
+cmp #233, *r2
+prn *r4
+inc L1
+lea L2, r2
+sub r5, *r5
+jmp L1
+dec L3
+
+L7: .data -337, -808, -618, -863, -985, -824
+mov r0, *r0
+L8: mov *r0, L7
+rts
+stop
+jsr L5
+inc r3
+jsr *r1
+lea L3, r2
+inc L0
+inc *r7
+dec r6
+not r1
+inc *r4
+L9: dec r6
+mov L1, r4
+L10: clr r0
+
+L11: .data 271, 315, 469, 408, 82
+; comment
+L12: bne L6
+rts
+add *r4, *r6
+rts
+rts
+add r3, L4
+jmp *r6
+lea L4, r4
+L13: bne L13
+jsr L6
+add r4, r3
+not r5
+; comment
+rts
+clr *r2
+L14: clr L9
+jmp L13
+L15: .data -832, -239, 820, 3, 720, 743, -954, -227
+L16: inc *r6
+add r5, L6
+stop
+stop
+L17: bne *r5
+L18: .data 613, 138
+bne *r5
+add #-135, *r0
+red L7
+L19: inc L3
+L20: clr r0
+L21: .data -841, 116, -548, -599, 182, 897, -86, -527
+jsr L13
+rts
+cmp r5, *r1
+L22: sub *r3, r3
+dec *r6
+L23: .string "ygqkcanuzuuh"
+inc L9
+L24: prn #159
+
+jmp *r1
+L25: not *r7
+; comment
+cmp *r6, r5
+L26: lea L12, *r7
+L27: .string "fkwxdywugfg"
+not L13
+L28: .string "oi"
+; comment
+add L6, L21
+rts
+L29: red *r3
+stop
+dec L16
+not L8
+L30: lea L24, L6
+red r4
+bne L15
+sub *r0, r6
+L31: jmp L25
+lea L25, *r7
+stop
+L32: lea L29, r0
+L33: lea L24, *r5
+dec r6
+add *r3, L24
+prn *r0
+add r5, L24
+mov r3, L20
+jsr L28
+L34: .string "ckri"
+red L1
+stop
+red *r2
+stop
+add L16, L28
+add r4, r4
+L35: mov #-87, *r3
+bne L7
+clr r4
+L36: bne L11
+inc r2
+stop
+bne L29
+L37: add r4, L32
+L38: jsr L17
+bne L22
+L39: .string "jxqvcnjhxewc"
+L40: .string "etr"
+add *r5, *r4
+L41: add L25, r1
+L42: rts
+L43: stop
+L44: lea L1, *r1
+L45: add r4, *r7
+L46: clr *r1
+L47: prn #-55
+red L44
+L48: lea L36, *r6
+sub *r6, *r5
+prn #-135
+L49: .string "koqtgpfqptwea"
+inc *r1
+L50: clr r5
+inc *r1
+L51: add L14, r5
+L52: clr *r4
+L53: jmp *r3
+L54: inc *r5
+red *r2
+L55: stop
+L56: rts
+dec *r2
+mov r2, r6
+red *r6
+L57: stop
+mov *r6, L29
+L58: .data 842
+clr r5
+add r7, L40
+bne L26
+L59: .data 13, -75, 707, -674, 864, 560
+red r2
+add #-141, L36
+stop
+L60: add #215, *r4
+dec L45
+L61: not *r7
+dec *r2
+L62: jmp *r4
+dec r4
+dec r2
+red r1
+L63: rts
+add #-46, *r3
+red r2
+L64: bne *r5
+; comment
+L65: .string "ydtteoryyotlko"
+dec L15
+prn *r2
+add r7, L2
+sub L7, L5
+L66: sub *r1, r3
+L67: inc *r7
+red r6
+L68: not *r1
+; comment
+rts
+L69: bne *r2
+inc r3
+red L55
+red r7
+jmp L3
+prn L27
+L70: lea L3, L51
+L71: mov L24, *r3
+L72: bne L59
+; comment
+L73: red r7
+sub L2, r5
+L74: cmp #-29, r0
+L75: .data 890, -747, 635, 543
+lea L4, L35
+cmp L12, #-75
+cmp L49, *r4
+sub L51, r0
+add L26, *r1
+mov r2, *r0
+sub #-131, *r3
+inc *r5
+L76: prn L34
+dec L74
+; comment
+L77: prn L67
+L78: jmp *r6
+L79: sub r3, *r3
+inc L62
+red L54
+lea L9, r0
+L80: .string "egqziqpp"
+not *r0
+jmp *r6
+L81: bne L46
+add #-146, L5
+clr *r7
+lea L33, *r7
+
+L82: inc L70
+L83: .data 336, 785, 482, 116, 507, -524, -682, -818
+L84: jmp *r1
+L85: prn L81
+L86: not *r4
+cmp #-193, *r1
+L87: rts
+rts
+sub r5, *r2
+L88: .string "gffjrjlrzxjhecfy"
+lea L66, *r4
+dec r4
+add #44, *r5
+prn r0
+cmp #144, L5
+L89: .string "bbkjkavmmpcbynosii"
+L90: .data -350, 460, -75, 782, 882
+L91: .string "wbhpqjuqdv"
+not *r5
+L92: red *r0
+inc *r3
+L93: add L43, *r0
+jmp *r3
+prn *r7
+lea L84, r2
+L94: prn r5
+
+L95: lea L37, *r2
+L96: red *r6
+L97: .data -81, 914, -703, -775, -231, 279, -14
+not *r2
+lea L9, L66
+L98: .string "lmyalecuggcj"
+inc *r0
+rts
+L99: inc *r1
+rts
+red r1
+; comment
+clr L67
+L100: inc L1
+rts
+lea L72, r1
+L101: inc r4
+rts
+lea L20, L73
+L102: rts
+L103: jsr L34
+sub #23, *r3
+L104: .string "fmuvutpqwpgxcj"
+mov r5, *r7
+bne *r4
+rts
+stop
+jsr L78
+L105: .string "hqqmgyqzebqpcvemgaho"
+red L102
+sub r7, L95
+prn #-107
+inc L40
+L106: add r5, *r3
+clr *r0
+add #-17, L82
+; comment
+prn r4
+; comment
+L107: lea L43, *r1
+lea L14, L22
+add *r7, r3
+jsr *r5
+
+L108: mov r6, r0
+cmp #-242, r7
+lea L41, r0
+red *r7
+jsr *r0
+mov L3, r4
+jmp *r7
+add L26, r3
+jsr L87
+rts
+L109: sub L40, r1
+L110: jsr *r6
+L111: .data -835, 308, 792, -671, 417
+rts
+L112: add #-233, r1
+L113: red L17
+L114: .data -849, -770, 174, -270, 172, -389
+L115: bne *r3
+lea L81, *r5
+rts
+red r5
+L116: mov L84, L51
+jmp *r6
+L117: .string "byz"
+sub *r2, r4
+L118: .data 856
+L119: mov r6, r4
+L120: bne *r1
+dec r3
+L121: lea L68, r2
+jmp *r6
+
+L122: jsr L24
+L123: cmp L7, L89
+L124: add r3, L65
+L125: jmp L107
+jsr L21
+dec L35
+L126: bne L9
+inc *r3
+L127: jmp *r1
+inc L119
+cmp #-190, *r7
+sub r0, *r6
+rts
+inc *r1
+inc r5
+L128: sub #-235, r0
+dec r6
+rts
+L129: .data 753, 770, 407
+L130: .data 431
+prn *r4
+L131: .string "byfajthdydcss"
+red r6
+add r7, r6
+L132: jmp L41
+L133: not *r2
+L134: jsr L24
+mov *r7, r4
+cmp *r1, r7
+mov r5, *r3
+stop
+red *r0
+L135: not L80
+mov *r4, L113
+bne L3
+
+L136: add L111, r3
+rts
+L137: mov #255, r1
+inc *r3
+inc L40
+not *r7
+stop
+red L12
+jsr *r3
+lea L16, L51
+jmp *r2
+L138: .data -711, 215
+mov L71, L14
+red *r3
+bne L35
+mov r2, r2
+L139: .string "ppubvjminupmoboksixjh"
+L140: .data 534, 559, -729, 897, -744, 194
+rts
+cmp #155, r3
+L141: dec *r1
+stop
+dec L47
+L142: sub #83, r1
+cmp *r7, r1
+cmp r7, L114
+lea L53, L120
+bne L114
+lea L17, r4
+; comment
+L143: jsr L16
+; comment
+clr r6
+dec L83
+cmp L76, *r6
+dec r3
+L144: jsr *r5
+stop
+lea L69, *r0
+bne *r2
+add L138, r4
+inc r6
+L145: mov L42, L72
+inc r1
+mov #137, *r0
+rts
+cmp #67, #99
+jsr L126
+L146: sub *r7, *r6
+bne *r2
+bne *r5
+L147: sub L33, L93
+L148: rts
+L149: stop
+L150: jmp *r4
+clr r5
+L151: prn r4
+stop
+inc *r7
+sub L102, L72
+not r3
+not *r4
+L152: stop
+; comment
+prn *r2
+L153: .string "j"
+L154: dec *r7
+jmp *r6
+; comment
+cmp r6, L132
+jmp L84
+L155: .data -421, 952
+add *r0, L94
+jmp *r7
+not *r2
+L156: bne *r5
+dec *r5
+stop
+lea L14, r1
+lea L113, *r1
+add #-254, r7
+prn L102
+inc L94
+jmp *r1
+mov *r4, *r3
+L157: .string "byfewtjga"
+L158: prn L43
+sub r3, L12
+L159: add #6, r6
+L160: bne L69
+dec r0
+clr L86
+jmp *r2
+clr r4
+red *r6
+add *r6, L3
+
+stop
+L161: .string "ctzgfnnmlsmdbqf"
+mov r7, *r6
+jsr L50
+mov L16, *r2
+
+L162: .data -417, 783, 637, -828, -214, 890
+L163: not r3
+clr r6
+cmp *r1, #-225
+rts
+add #220, *r3
+jmp *r7
+sub #1, r3
+prn *r4
+L164: dec r1
+not *r7
+red L62
+rts
+jsr *r2
+L165: sub L153, L60
+jmp *r0
+add L78, r2
+inc L39
+jsr *r6
+inc r0
+L166: .data -667, -672, 815, 972, -884, 496
+dec L149
+L167: .string "fwgroyapmonfzbbdirhprcmw"
+jmp *r1
+L168: .data 157, -181, -545, 215
+lea L117, L156
+bne *r6
+lea L46, L49
+L169: rts
+not *r2
+rts
+L170: sub *r3, L11
+L171: .string "cfyzjuvlvnvmrmzryyagsbg"
+cmp L89, #244
+stop
+L172: rts
+L173: .data 385, -589, -804, 948
+L174: sub #209, L63
+L175: .string "l"
+lea L159, r1
+stop
+dec r2
+L176: rts
+L177: .string "fdugyoiejzrpiti"
+stop
+L178: sub *r6, *r7
+inc *r2
+L179: .string "koflcpsifiynecfohqjuhy"
+L180: dec L134
+L181: cmp L119, *r5
+L182: stop
+red *r3
+jsr *r7
+L183: not *r0
+inc r1
+add *r6, L73
+L184: add #25, L15
+red L181
+sub r1, r2
+lea L128, L172
+bne *r4
+sub r7, r2
+bne *r1
+rts
+bne *r3
+lea L148, L160
+L185: sub L125, *r3
+bne *r5
+L186: mov r3, L72
+rts
+lea L17, *r2
+clr r7
+L187: stop
+stop
+red r6
+L188: rts
+prn L158
+stop
+jmp *r4
+dec *r7
+not r3
+stop
+mov r6, *r3
+bne L37
+mov #-120, r1
+stop
+cmp L147, r5
+L189: mov L35, r1
+L190: .data 427, 911, 729, 933, 876, -975
+add *r7, r4
+L191: .data -143, -845
+rts
+L192: jsr *r4
+red *r2
+cmp *r6, L97
+jmp L149
+L193: mov #196, *r0
+L194: .data -555, -248, 653
+L195: add L112, L182
+rts
+lea L10, *r2
+L196: .data -939, 276, 375, 568, -639
+stop
+cmp L48, r3
+L197: inc L128
+prn L167
+inc L194
+inc L35
+add *r4, *r4
+
+; comment
+L198: prn *r7
+rts
+lea L160, *r6
+mov r3, r6
+dec *r3
+L199: lea L64, *r2
+
+prn *r4
+L200: .data -783, -947, -70, -409, 722
+L201: stop
+mov #19, L156
+L202: .data -188, -574, -42, 735
+mov *r4, L166
+sub *r6, *r2
+stop
+bne L169
+dec L120
+jsr *r4
+not r7
+dec r7
+L203: cmp #-51, L6
+inc *r0
+L204: red r4
+clr L68
+red r2
+clr r7
+cmp r1, L141
+L205: jsr *r4
+L206: not L84
+L207: cmp #193, r4
+clr L19
+L208: stop
+L209: .data -827
+cmp #138, *r5
+L210: .data 611, 530, -200, -595, -487, -711
+clr L42
+not L34
+mov r7, r1
+red *r0
+jmp L154
+cmp L4, #-189
+L211: bne *r5
+dec L155
+L212: not L92
+L213: bne L112
+inc L210
+red r6
+add *r4, *r2
+sub L1, L26
+L214: prn *r6
+L215: prn #-235
+stop
+L216: dec r0
+jmp *r2
+clr L76
+clr *r2
+clr *r6
+red L22
+not r7
+red L153
+dec *r5
+L217: sub *r6, *r1
+not r0
+sub r7, *r7
+L218: not r6
+L219: dec *r1
+L220: .string "ivpjmfxpvgsjqlkaybrtevkq"
+; comment
+L221: .string "ktulxhlchhovfbcjswpldvu"
+L222: not *r4
+mov *r0, *r0
+mov r2, L212
+cmp *r5, #-189
+inc L81
+stop
+jmp *r4
+not L214
+rts
+
+jmp *r2
+L223: not *r4
+add #-6, *r0
+not *r3
+add r4, L172
+L224: dec r0
+L225: cmp L67, r0
+inc r2
+jsr L223
+L226: prn *r2
+stop
+rts
+clr *r2
+clr L191
+L227: stop
+jmp *r6
+; comment
+
+red r6
+L228: .string "thagqnec"
+stop
+sub r6, *r5
+L229: clr r1
+sub #-164, L100
+add #184, L184
+jmp *r6
+add r3, L168
+add L31, r7
+lea L72, r0
+lea L169, *r6
+inc *r5
+; comment
+rts
+lea L221, *r3
+lea L153, r1
+L230: .string "nxeg"
+L231: cmp *r2, r3
+L232: .string "xlbjitlnelzwstf"
+L233: jsr *r6
+stop
+stop
+dec r4
+bne L78
+inc L66
+bne *r5
+
+cmp *r5, L203
+L234: stop
+cmp *r5, *r0
+L235: .string "np"
+L236: bne *r2
+lea L121, L218
+stop
+
+add *r1, r5
+inc r1
+not L177
+L237: .data -745, -968, 484, -785, -748, 468
+bne *r3
+jsr L180
+L238: mov #-28, r0
+not r4
+red r6
+rts
+L239: clr r6
+red *r5
+red L112
+L240: inc *r2
+L241: stop
+jmp *r1
+not r4
+inc r6
+add L196, r0
+L242: .data -643, -643, 219, 491, 429, -431, -66, -279
+mov r4, r5
+mov L124, *r2
+bne L148
+L243: .data 938, 770, 289, 466, 745, -726, 883, -619
+sub *r3, L173
+bne L74
+L244: red L167
+mov r1, r3
+L245: inc *r2
+not L46
+inc r3
+prn L199
+clr L95
+cmp r4, #213
+L246: mov L113, *r3
+mov #35, *r5
+rts
+stop
+add #-165, L178
+L247: .string "nwmnirvttxwmobed"
+L248: .data 683, -488
+L249: bne *r4
+L250: dec L112
+
+not r5
+jmp *r3
+L251: prn *r0
+clr L141
+mov *r7, r1
+stop
+rts
+inc r0
+rts
+L252: rts
+rts
+dec *r7
+L253: lea L17, r0
+L254: prn L183
+L255: rts
+not r3
+lea L137, L169
+stop
+mov L117, *r6
+L256: .string "krilvbghequx"
+lea L200, r6
+jsr L161
+L257: prn L137
+L258: red L102
+L259: not r4
+L260: red *r5
+lea L245, *r2
+L261: dec L170
+sub *r5, r4
+lea L101, L70
+L262: clr r2
+L263: sub r6, *r7
+L264: jmp *r4
+sub *r3, *r4
+L265: lea L88, r0
+L266: jmp L230
+prn #216
+lea L150, *r7
+stop
+L267: .string "cvugtztx"
+L268: add L28, L158
+L269: not L44
+L270: cmp L61, *r6
+stop
+inc *r4
+not *r2
+not *r0
+L271: add L141, L264
+prn L234
+L272: clr L272
+L273: red *r6
+clr r0
+L274: .string "pkpyyhewafeuvpjv"
+L275: .string "lmiycnwsicueczpkymr"
+inc *r1
+dec L178
+L276: lea L65, L110
+prn r4
+; comment
+red r6
+L277: .data 701, 877, -277, 543, -308, 68
+L278: add r3, L237
+L279: not L276
+stop
+L280: dec *r1
+
+L281: mov L205, *r2
+bne *r6
+L282: cmp L138, L90
+L283: inc L155
+L284: lea L32, L211
+clr *r7
+
+sub r7, *r3
+L285: clr r7
+L286: dec L175
+bne L205
+cmp r4, r5
+dec *r7
+sub #-47, L181
+stop
+lea L169, *r1
+; comment
+L287: .string "bgvdaob"
+mov L109, *r6
+stop
+L288: rts
+
+L289: bne L181
+L290: stop
+jsr L168
+clr r6
+add r6, r4
+L291: sub L143, r7
+prn L254
+dec L116
+sub #61, *r3
+L292: .data -994, -653, -940
+prn *r4
+add *r4, *r2
+mov #-16, r3
+L293: jmp *r7
+
+L294: jmp L48
+mov r3, *r1
+cmp *r5, L273
+mov #183, L119
+cmp #56, #-115
+L295: stop
+L296: .string "ibhpmyqs"
+bne L22
+L297: .string "udvah"
+sub #-20, *r3
+clr r2
+L298: rts
+red L30
+sub r7, *r0
+L299: not r7
+
+lea L277, L259
+bne L126
+jmp L76
+bne *r7
+; comment
+mov L166, r1
+L300: .data -163, -514, 683, -108, 563, 255, 633, -844
+rts
+clr *r0
+jsr *r2
+L301: lea L34, *r7
+L302: clr L204
+L303: jsr L219
+cmp r1, *r0
+L304: cmp *r7, #-60
+mov *r1, *r2
+L305: clr *r7
+lea L264, r2
+inc L194
+L306: stop
+add *r2, *r6
+cmp r3, *r6
+bne *r5
+L307: .data -295, -268, -830, 903, -507, -108, -821, -196
+jsr *r3
+jmp *r3
+bne L214
+sub #-245, *r6
+stop
+L308: .string "ltyolfyoxtkoxyo"
+dec r7
+clr *r1
+dec *r4
+bne L252
+bne L66
+rts
+L309: dec r5
+L310: sub #-6, L151
+L311: .string "hxozjasmkirxhxaoseigcav"
+not *r4
+L312: clr r3
+dec r3
+
+clr L12
+lea L117, r1
+L313: sub #-213, L274
+L314: lea L116, L236
+L315: red L29
+not *r2
+clr L157
+L316: red *r3
+L317: sub #-90, L84
+cmp #94, L213
+stop
+lea L295, r4
+L318: .string "ybykfxsfzid"
+L319: cmp r5, r3
+L320: .data 203, 230, 509, -73
+L321: red *r4
+L322: .string "tibuyi"
+inc L322
+dec r1
+jsr *r2
+inc *r1
+L323: sub r2, *r4
+not *r3
+jmp *r4
+L324: inc r1
+add #-161, *r4
+L325: .data -495, -549, -876, -473, -300
+stop
+L326: sub *r6, L1
+jmp L75
+dec r2
+sub L201, *r1
+clr r3
+cmp L89, L62
+L327: dec *r4
+L328: .data 85
+L329: .data -975, 282, -378, 836, -762
+L330: red L51
+jsr *r1
+L331: mov L44, *r0
+L332: mov #-93, L41
+L333: not *r3
+L334: not r1
+stop
+L335: sub r6, *r5
+lea L253, r7
+prn #33
+dec *r4
+not r3
+L336: stop
+L337: .data 623, -56, -93, 444, -125
+jsr *r1
+not r4
+sub L302, L80
+bne *r7
+L338: cmp *r2, *r4
+L339: prn *r7
+jsr L294
+sub L271, *r5
+cmp *r3, #-241
+stop
+jsr *r7
+sub r1, *r7
+not r1
+cmp L324, #-208
+L340: red L308
+red r7
+L341: .data 902, 433, 837, 779, 762, -871, 135
+clr *r4
+L342: sub *r0, *r3
+stop
@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 14
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: .string "ducuteouhubpwpnfehacyqca"
+L1: .data 197, -751, -784, -934, 484, 337, 466, -354
+L2: .data 705
+jsr *r1
+prn *r3
+L3: jsr *r6
+red *r1
+cmp #-74, r7
+rts
+
+L4: mov #-38, r5
+dec *r0
+stop
+cmp r3, *r7
+stop
+lea L3, *r7
+L5: cmp *r0, #135
+inc *r0
+L6: jsr *r6
+add r7, L5
+add r1, r5
+inc L5
+bne L2
+jmp L0
+
+jmp L2
+L7: jmp *r5
+sub r2, L5
+; comment
+add #7, r6
+stop
+dec r6
+add r5, r6
+rts
+dec r3
+not L0
+not *r2
+mov r0, r5
+not L0
+L8: .data -799, -702, -797
+L9: .string "dnpge"
+L10: prn *r6
+L11: bne *r2
+prn #-131
+L12: jsr L12
+jsr *r0
+L13: not *r2
+inc r4
+jsr *r1
+cmp #-199, r6
+L14: .string "baquvmkybeuehrsqmxk"
+jmp *r4
+rts
+bne L8
+lea L2, L0
+lea L11, r6
+clr L2
+; comment
+prn *r2
+inc *r6
+
+L15: lea L9, *r3
+stop
+bne *r2
+not r0
+inc *r0
+red L11
+stop
+L16: .data 624, -480, 747, 334, -107, 366, 65, 460
+stop
+
+stop
+
+L17: mov *r0, *r7
+bne L4
+mov r7, r0
+stop
+cmp r6, #-87
+L18: .data -458, 493, 405, 769, 961, 76, 526, -853
+L19: add r1, r0
+clr r0
+bne *r5
+sub L4, r7
+jsr *r6
+cmp r3, L15
+L20: not *r7
+L21: .data -5, 751, 194, -140, -655, 370, -829
+L22: .string "ehfwknliqoos"
+rts
+jsr *r2
+clr L9
+cmp r0, #-202
+L23: .string "xpbvthdwbvdwlqnsksdyx"
+jsr *r6
+L24: inc L21
+bne *r1
+clr r4
+inc *r4
+lea L4, *r7
+L25: dec *r7
+L26: dec *r4
+L27: add r2, *r0
+rts
+L28: lea L3, *r5
+mov L13, L13
+L29: bne L23
+L30: clr *r3
+lea L11, *r3
+L31: sub *r0, r7
+L32: mov L7, r6
+not L28
+red L7
+L33: jsr L4
+jmp *r0
+L34: .string "xklo"
+inc r1
+L35: stop
+L36: .data 617, 733, 751
+cmp r5, #132
+cmp L31, #19
+jsr *r5
+jsr *r4
+L37: bne L11
+red r4
+
+lea L19, r6
+L38: sub *r5, L24
+
+L39: .string "glffgjpqmqxazstfahpevlu"
+jmp L4
+L40: clr r5
+L41: dec *r7
+L42: prn L28
+L43: clr r1
+bne *r1
+rts
+jmp L25
+mov #-189, *r3
+jmp L24
+lea L42, L25
+cmp r5, L9
+mov r7, r6
+L44: cmp *r1, #67
+L45: sub r0, *r0
+mov L28, r5
+not *r4
+stop
+add r3, L40
+L46: prn *r0
+L47: .string "dweqchhyzbfqavb"
+prn r4
+lea L43, r3
+inc *r3
+jmp *r3
+inc *r0
+L48: inc L3
+dec *r5
+jmp L17
+L49: add *r0, *r6
+clr r0
+red *r7
+stop
+
+jsr L10
+L50: inc L23
+L51: jmp *r1
+L52: clr r2
+L53: not r5
+L54: bne L37
+L55: jsr *r3
+L56: dec *r3
+not L20
+sub *r2, L43
+L57: jsr L48
+inc r2
+prn *r7
+inc *r4
+L58: .string "lnsvzsczl"
+L59: mov *r4, r2
+red r5
+clr r0
+bne *r0
+not r5
+L60: inc L5
+inc *r4
+prn #40
+mov *r7, L7
+inc L28
+inc r5
+L61: .data -409, 415, 880, 12, 24
+red L9
+L62: sub L41, L47
+jsr *r7
+dec L55
+L63: .string "ymefbebmxpkaljfsyle"
+L64: inc *r5
+jsr *r7
+stop
+bne *r5
+; comment
+L65: jsr *r6
+L66: clr r0
+
+not L1
+L67: .string "opa"
+dec *r7
+lea L27, r4
+dec r1
+L68: .data 583
+L69: rts
+red r5
+not r2
+jmp L48
+L70: red r6
+jmp *r7
+mov L4, *r5
+not *r0
+sub #-250, r5
+lea L26, r5
+L71: cmp *r2, r2
+dec L32
+add *r0, L67
+add #55, r3
+inc L43
+L72: inc L33
+L73: not L4
+rts
+L74: jmp L48
+L75: add *r4, L59
+L76: .string "zsfbgnrtipoernfhopc"
+lea L9, *r2
+jsr *r6
+add L73, L43
+not L17
+L77: red r7
+L78: dec *r0
+cmp *r1, r5
+L79: .string "xdacqox"
+cmp #176, L53
+prn L70
+L80: .data 218, -574, 25, -870, -496, -584, -232, 862
+sub *r6, r6
+L81: cmp L9, L42
+red r1
+L82: inc L9
+add *r6, L18
+red L26
+; comment
+L83: add r0, *r7
+L84: .data -996
+red *r5
+clr r5
+stop
+prn #-234
+; comment
+lea L28, r1
+dec r3
+L85: sub #-57, *r5
+not *r1
+L86: jmp L19
+cmp *r0, r7
+inc L2
+inc r4
+L87: clr *r2
+L88: cmp L68, *r5
+sub L27, r4
+stop
+red *r0
+add *r3, r3
+L89: jsr L32
+mov *r6, L47
+mov *r5, r7
+L90: dec L90
+jmp *r1
+dec L73
+cmp L90, #-220
+sub *r6, r3
+L91: stop
+; comment
+L92: mov r2, L10
+L93: lea L86, L0
+stop
+clr L53
+dec L81
+add L53, *r5
+; comment
+rts
+L94: lea L75, *r2
+clr L35
+mov *r7, L52
+L95: add r2, L91
+L96: inc *r3
+L97: rts
+; comment
+red *r0
+lea L4, L95
+L98: .string "dgdzlrwd"
+dec L7
+cmp *r4, *r1
+red *r3
+; comment
+L99: inc L28
+L100: cmp *r7, #-197
+L101: lea L51, r0
+L102: mov L39, *r2
+L103: sub r7, *r7
+L104: .string "irmmkpbvfrekgaafdcnv"
+mov r1, L76
+L105: .string "wbyauufvzwpacqdz"
+prn #141
+red r0
+mov *r6, r0
+
+prn #216
+L106: .string "vvwrfpxgosriteimeknvpwl"
+stop
+L107: bne L62
+mov *r2, *r7
+rts
+dec r4
+L108: .string "wflajwztvdgnvr"
+L109: cmp *r2, #-186
+L110: lea L26, r3
+L111: .data -346
+mov *r6, L70
+not L76
+sub L23, r1
+not L103
+L112: dec *r6
+inc r5
+L113: .data 565, -857, -832, 33, -619, -162, -108
+mov L78, r7
+bne L1
+sub *r4, r4
+L114: sub L66, *r1
+add L71, *r6
+L115: .data 694, 572, 747, 680, 732, 977, 109, 345
+L116: stop
+rts
+jmp *r4
+L117: .string "dtmysxczslxeft"
+inc L68
+dec *r1
+stop
+L118: .string "cbvaytt"
+lea L50, *r1
+bne *r5
+stop
+L119: rts
+red r5
+cmp *r1, r3
+not L88
+inc *r5
+; comment
+L120: .data -711, -461, 222, 395, -563, -881, 185, -562
+clr L2
+stop
+not *r3
+L121: sub #-243, L1
+not L37
+L122: jmp *r4
+L123: .string "xtraqw"
+L124: sub r3, r0
+mov #-66, r5
+add #-155, r2
+sub r1, L6
+L125: inc r3
+clr *r2
+sub *r6, *r5
+inc r2
+jmp *r7
+L126: prn *r4
+L127: .string "ypxxsazrfaqnzwhznrxvlbbu"
+not *r1
+L128: cmp *r7, L22
+L129: clr r5
+not r5
+L130: lea L89, *r6
+lea L85, r1
+jsr *r5
+jmp L51
+bne L13
+clr *r7
+bne *r2
+L131: .string "vvmvnqdacdttkbngp"
+jmp L102
+L132: sub r5, *r5
+L133: red r1
+L134: .data 788
+lea L127, r1
+L135: stop
+L136: jsr L56
+jsr L91
+add #-256, L60
+jsr *r6
+lea L84, r7
+L137: sub r5, *r4
+L138: inc r7
+L139: jmp *r2
+L140: red r7
+red *r1
+lea L125, L139
+jsr L8
+L141: jmp L35
+L142: sub #-48, r4
+clr L105
+jsr *r1
+jsr *r6
+L143: add r3, L109
+L144: cmp #-11, #-25
+L145: rts
+L146: lea L59, *r1
+sub *r6, L134
+
+jsr L94
+dec *r6
+prn L133
+L147: clr r6
+inc *r5
+L148: lea L113, r6
+not *r6
+
+inc L56
+L149: rts
+mov #153, r0
+lea L19, r4
+dec L141
+cmp L64, r0
+cmp L77, L122
+dec L28
+jsr *r0
+stop
+L150: red *r7
+L151: inc L73
+stop
+add L76, r2
+L152: mov L40, *r0
+bne *r6
+prn r1
+sub r0, L76
+sub *r4, *r4
+L153: dec *r3
+L154: .string "vvldzlilmszfk"
+L155: lea L138, L140
+sub L29, *r1
+jmp *r2
+jsr L137
+clr r2
+L156: clr *r2
+sub L152, L82
+bne L149
+jmp L12
+sub #170, r5
+stop
+not *r2
+L157: clr r3
+stop
+L158: mov #244, L93
+lea L140, L130
+rts
+clr r4
+L159: .data -982, 122, 684, -340, -817, 471, -4, 227
+stop
+jmp *r6
+L160: prn L63
+; comment
+L161: clr *r1
+L162: cmp r7, r1
+stop
+jmp *r3
+sub #-5, *r0
+cmp L99, L120
+stop
+prn #0
+L163: bne L154
+L164: .string "mdojemjymesx"
+red L2
+prn #-203
+prn L139
+sub *r1, *r1
+jsr *r3
+L165: .data 26, 167, 863, -772, -663, -797, 964, 558
+clr L23
+L166: red r6
+rts
+sub *r1, *r5
+not *r7
+not *r7
+mov *r7, r4
+L167: .data -16, -895, -82, 767, 818
+mov L154, L119
+cmp *r7, L57
+cmp #-210, *r1
+L168: red r6
+L169: .string "ximhpncpck"
+L170: sub #11, r6
+bne *r0
+jsr *r0
+cmp L51, L77
+jsr L82
+bne *r6
+mov r2, r5
+; comment
+L171: rts
+L172: dec *r3
+L173: cmp *r0, r7
+L174: mov L136, *r7
+L175: jmp *r2
+jsr *r1
+L176: .string "ownuxvbypklgpucvkp"
+red r0
+prn r3
+jsr L41
+add #-142, *r6
+rts
+jmp L164
+L177: cmp *r0, #102
+jmp *r0
+L178: inc *r2
+L179: jmp *r3
+L180: bne L65
+not r5
+L181: .data 237, -877, 622
+L182: prn L134
+prn L166
+
+add *r4, *r2
+L183: .string "vjlh"
+lea L105, r1
+jsr L142
+bne L183
+jsr *r2
+L184: clr L66
+mov L150, r7
+L185: .data -669, -2, -239, 416
+cmp L83, #43
+jmp L87
+L186: stop
+bne L48
+mov #247, r3
+jsr L132
+L187: inc *r5
+
+jmp L30
+L188: clr r5
+L189: lea L114, *r6
+stop
+not r4
+jsr *r6
+stop
+jmp L28
+
+sub #40, r6
+red *r2
+L190: mov L59, L7
+clr r0
+L191: jsr L56
+bne *r6
+L192: .string "s"
+L193: dec *r2
+; comment
+stop
+dec r3
+dec r0
+dec r7
+dec *r4
+L194: jsr L136
+rts
+jsr L165
+prn r7
+L195: prn #208
+clr L73
+mov r0, *r6
+red *r0
+bne L107
+L196: .string "bcf"
+; comment
+lea L24, L45
+L197: mov *r6, *r3
+red L35
+jsr L108
+L198: clr r0
+L199: add *r1, L22
+clr r4
+clr *r0
+L200: lea L154, *r5
+L201: .data -25, -981, 7, 582, -389
+L202: add *r3, *r1
+red r4
+mov #-51, r7
+jsr *r5
+stop
+L203: mov *r0, L76
+L204: cmp *r4, #-166
+sub #-75, L90
+L205: sub *r3, L80
+; comment
+L206: dec L115
+clr L80
+sub *r1, *r2
+red L49
+rts
+L207: prn *r1
+jsr L198
+cmp r5, #69
+cmp r1, L188
+jsr *r0
+add L128, r6
+dec *r2
+rts
+sub L19, *r4
+mov #-240, r6
+jmp L74
+L208: sub L64, *r6
+L209: add #-166, L61
+inc *r4
+L210: .string "zlkrogvsqlspcuug"
+prn #-62
+L211: stop
+mov r5, *r2
+stop
+; comment
+L212: sub r5, L191
+L213: .string "sqfhwsrzwxv"
+jsr *r1
+L214: .string "frvffhtnizwvwqvorsrfc"
+L215: bne *r7
+inc L10
+L216: .data -323, -689, -140, 116, -854, 524, 953, -532
+mov L73, r7
+L217: prn #48
+bne L116
+red L205
+stop
+L218: cmp *r4, *r1
+L219: cmp r3, #164
+L220: prn #201
+L221: rts
+dec r4
+L222: .data -379, -438
+; comment
+L223: jsr *r0
+; comment
+jmp L156
+not *r7
+dec r2
+bne *r6
+L224: dec L55
+prn *r1
+; comment
+add *r3, *r3
+L225: .data 697, -975, 439, -931, 939, 429, 964, 480
+L226: mov L111, *r5
+dec *r7
+L227: .string "b"
+clr *r2
+cmp *r1, *r1
+red *r7
+L228: inc L177
+L229: stop
+rts
+L230: .string "wbtrf"
+dec L190
+L231: prn #-147
+clr *r5
+L232: not r2
+L233: .string "jkhaxwnvzksq"
+bne *r6
+; comment
+rts
+cmp #-242, r2
+L234: stop
+L235: add #75, r5
+jsr *r1
+L236: .string "evxewivg"
+mov *r1, L123
+L237: mov *r4, *r2
+not L61
+L238: red *r3
+
+not r6
+L239: not *r4
+prn #-125
+dec L68
+inc L23
+red L168
+bne *r4
+inc r6
+red L202
+L240: red r1
+dec r0
+jmp L163
+L241: sub #211, r1
+red *r2
+L242: not L227
+not L48
+red r1
+not L78
+not L13
+L243: clr L161
+add *r2, L121
+L244: .data 204, 269, -647
+rts
+not L0
+L245: sub *r1, r7
+inc *r0
+jsr *r1
+L246: jmp L99
+rts
+jmp *r2
+L247: jsr L245
+lea L111, r0
+rts
+red r0
+L248: .data 652, -180, -275, -719
+clr *r6
+clr r6
+red L7
+inc *r6
+L249: .data -523, 152
+lea L76, *r0
+mov L218, L15
+L250: .string "rronymk"
+inc *r5
+jsr L129
+L251: bne L198
+mov L250, r6
+L252: bne L205
+stop
+jsr L110
+L253: jmp L90
+mov L187, *r5
+L254: .data 228, 964, 309, -756, -285
+jmp *r0
+inc *r1
+cmp *r6, r4
+jmp L210
+sub #-22, *r4
+dec L137
+cmp r2, L136
+jmp L18
+L255: cmp *r4, r7
+L256: jmp L231
+mov r2, L171
+stop
+sub #-128, L160
+bne *r2
+lea L2, *r0
+clr r4
+jmp L179
+L257: stop
+jmp L227
+red *r5
+L258: jmp L69
+mov *r5, L50
+jmp L12
+L259: bne *r1
+red L50
+L260: cmp #188, r5
+L261: sub #-107, r5
+dec *r0
+jmp *r1
+; comment
+inc *r4
+L262: cmp #-30, *r0
+L263: add *r3, *r2
+sub r3, *r2
+sub L161, L241
+L264: add *r6, *r2
+add #-222, *r4
+L265: cmp L144, #-190
+bne L251
+L266: jmp L159
+inc r1
+L267: jmp *r3
+dec L45
+not r2
+lea L100, r5
+L268: bne L123
+cmp *r6, L46
+sub *r0, r7
+sub L86, *r3
+clr L6
+L269: prn #232
+L270: .data -407, 458, -104, -269, 954
+L271: jmp L105
+; comment
+sub #-31, *r7
+jsr *r4
+red *r7
+L272: cmp r4, #169
+L273: .string "cmlydhsqzovyqfpcqqmiihz"
+sub r6, r0
+inc L202
+lea L222, r5
+jmp *r7
+stop
+stop
+
+not *r5
+jmp *r3
+prn #-38
+jmp *r1
+L274: not L19
+mov #-92, L100
+prn r3
+L275: dec r6
+rts
+sub r5, L4
+L276: stop
+L277: add L6, *r6
+L278: jsr *r4
+L279: lea L79, *r6
+jsr *r5
+sub #231, L132
+lea L278, r5
+L280: prn *r0
+red L168
+mov r4, *r4
+L281: add *r1, L217
+lea L98, L146
+stop
+L282: prn *r2
+sub #-103, *r6
+L283: .string "nufobwdwfkbu"
+L284: not r0
+lea L109, r5
+stop
+jmp L276
+stop
+not *r4
+L285: not *r5
+lea L203, L69
+jsr L254
+lea L251, *r2
+prn L15
+L286: .string "vjnov"
+L287: cmp r0, r0
+dec L104
+mov r7, r1
+inc r7
+jmp L54
+jsr L73
+mov *r3, L91
+jsr L0
+dec *r3
+stop
+not L114
+; comment
+not *r0
+L288: not *r6
+L289: not L85
+L290: .data 107, -626, 675, 937
+inc L16
+L291: rts
+lea L83, L34
+jsr L225
+clr L39
+L292: sub L86, *r6
+L293: inc *r5
+jsr *r2
+jmp L249
+L294: prn #-49
+L295: stop
+mov #-20, r3
+L296: jmp *r3
+cmp r0, #-222
+L297: add L5, r2
+L298: mov r5, *r4
+jmp L141
+L299: .string "sphumxecwparecuek"
+jsr L276
+add r6, r2
+L300: jsr L200
+L301: cmp L127, L155
+lea L34, *r3
+L302: stop
+L303: cmp #-225, #14
+add *r5, r4
+inc r3
+dec L59
+; comment
+mov *r5, r2
+lea L34, L103
+L304: .data -74, -197, 585, -264
+L305: sub L104, *r0
+L306: lea L176, r2
+L307: dec L83
+inc L8
+prn #-161
+L308: rts
+cmp *r3, r1
+inc L120
+add r1, r2
+bne L294
+L309: .string "ledzusdwuhhdn"
+L310: lea L206, r1
+L311: .data -325, -1000, -175
+L312: add r7, L104
+sub r7, *r1
+prn r1
+jsr L304
+jsr L92
+L313: .data -698, 146
+rts
+add *r7, *r3
+inc r6
+L314: jmp *r0
+not r2
+lea L6, *r3
+add #67, r5
+cmp L155, r0
+stop
+red L159
+L315: stop
+L316: lea L224, r5
+L317: add #-97, r4
+lea L165, *r6
+red *r0
+L318: red L53
+L319: .string "uhuozvillnvauwbztqjvtzc"
+dec L69
+dec *r5
+rts
+stop
+L320: clr r5
+jmp L94
+bne *r5
+L321: .string "jax"
+lea L134, *r6
+L322: .data 441, -104, 476, -359, -288, 221
+L323: prn *r0
+L324: not r3
+
+inc *r6
+L325: .data -434
+stop
+L326: dec L273
+stop
+L327: stop
+stop
+add L147, *r4
+add *r1, r6
+L328: .string "yqsuazguqabwmvc"
+L329: inc L245
+sub *r4, r4
+cmp *r6, *r2
+bne *r6
+cmp L87, *r4
+L330: rts
+L331: jmp *r0
+L332: prn #242
+mov r6, r4
+L333: rts
+lea L307, L279
+add #-137, r6
+L334: clr r6
+inc *r0
+mov #-36, r1
+cmp L76, r1
+inc r0
+rts
+stop
+L335: .string "rysesylxspndretdxr"
+L336: clr L228
+prn #-111
+L337: stop
+L338: rts
+; comment
+L339: not r6
+L340: mov *r4, r0
+add r0, L66
+jsr *r3
+rts
+cmp r3, *r3
+dec r6
+L341: mov *r1, L52
+dec r6
+add #226, L74
+L342: .string "eicpgcmwfusnan"
+add L218, L330
+prn *r0
+add *r1, r3
+
+lea L134, L65
+prn L28
+stop
+inc L148
+jmp *r7
+red *r6
+L343: jsr L266
+mov #174, r6
+L344: not *r7
+L345: dec L157
+L346: .data 348, 873, -255
+rts
+L347: jsr L313
+L348: rts
+red L115
+not r2
+stop
@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 15
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+jmp *r4
+add r0, *r7
+clr r0
+bne L163
+L0: stop
+clr L0
+prn r0
+clr L0
+L1: jsr L0
+L2: add #-151, *r3
+mov r6, r4
+L3: mov #76, *r6
+L4: red r2
+L5: .string "c"
+prn *r2
+rts
+; comment
+L6: inc r3
+cmp L1, *r3
+not *r4
+not L1
+L7: .string "sxafcuiyqjsnkytsuippnre"
+L8: .string "gegvhyyynvkafxs"
+add r1, r6
+lea L8, *r0
+L9: bne L4
+L10: mov *r3, *r3
+L11: add *r5, r1
+red L6
+inc *r5
+stop
+jsr L3
+L12: .string "afhncajvknnrhtbvipcfusin"
+lea L12, *r6
+clr L5
+sub L5, L7
+mov L9, L12
+not r0
+L13: .string "gum"
+sub L0, r4
+jmp L1
+L14: .string "ajekiragmciluhzrxicmuhv"
+L15: jsr *r7
+cmp L1, L13
+L16: stop
+stop
+lea L5, *r5
+sub #-178, L8
+bne L0
+inc r0
+clr *r1
+jmp L0
+L17: red *r7
+; comment
+L18: mov *r5, L4
+lea L2, L0
+L19: clr r6
+L20: prn *r7
+; comment
+L21: stop
+bne *r1
+; comment
+stop
+mov L17, *r0
+L22: cmp #-242, *r5
+cmp #235, L16
+prn *r5
+stop
+red r6
+L23: not *r1
+cmp r2, r2
+L24: inc L24
+L25: dec r5
+L26: not r0
+L27: dec L14
+sub *r4, r7
+mov r7, *r6
+L28: stop
+add r3, *r0
+bne *r1
+jmp *r7
+L29: .string "pe"
+dec *r7
+L30: clr r7
+L31: .string "oxnvyw"
+red r0
+prn r7
+L32: rts
+L33: jmp L23
+not L25
+clr r4
+L34: .string "vgeks"
+; comment
+stop
+inc r3
+not L28
+lea L14, L34
+inc r1
+stop
+L35: rts
+L36: bne *r4
+red *r1
+lea L25, L33
+prn r5
+rts
+red *r2
+jsr L22
+L37: red L10
+lea L17, *r4
+L38: jsr L18
+red *r0
+clr *r3
+L39: prn L3
+clr *r1
+L40: inc L25
+jsr *r4
+
+stop
+L41: .data -858, 744
+
+L42: rts
+L43: .string "lfp"
+dec L26
+dec r1
+cmp *r4, r6
+
+stop
+bne *r0
+stop
+inc r4
+L44: dec *r7
+cmp #-214, *r6
+jsr L15
+L45: .data -378
+L46: .data 820
+stop
+jmp *r7
+lea L27, r1
+sub #129, L10
+clr r4
+L47: .data -42, 839
+L48: lea L47, *r6
+bne *r5
+add r4, L5
+add *r4, *r1
+dec r4
+L49: jsr *r5
+L50: rts
+red L33
+stop
+lea L45, *r3
+not r0
+dec r6
+L51: add L16, L9
+mov *r2, r4
+clr r7
+
+sub #196, L15
+L52: dec *r2
+sub #-136, r0
+clr L48
+red *r0
+L53: .string "rqdyvwlnykaqxzg"
+L54: clr r5
+L55: .data -245, -470, -452, 324
+bne *r4
+bne *r3
+dec r0
+stop
+cmp r6, r1
+clr *r1
+L56: .data -546, 54, 555, -255, 89
+L57: rts
+jmp L28
+L58: inc r4
+jmp L20
+red r1
+jmp L50
+L59: jsr L19
+jmp *r5
+; comment
+L60: cmp L15, *r0
+cmp r7, *r7
+lea L38, *r7
+red L31
+stop
+inc *r2
+cmp #-3, r0
+L61: mov *r4, r6
+L62: .string "bmkhzoovetip"
+rts
+dec L22
+not r1
+prn L31
+not L47
+mov #107, *r2
+L63: sub #180, r0
+L64: .string "sfjxofxakhshob"
+; comment
+red r4
+mov r1, r3
+L65: jsr *r3
+inc r2
+jmp L2
+L66: .string "txdnsixwntrfdnsbkfw"
+L67: .data -635, -831, 302, 11, 244, -561, -92, 328
+prn #-167
+rts
+clr r6
+not r3
+stop
+dec r0
+L68: sub L59, L21
+L69: prn #128
+inc r1
+clr r7
+red r3
+add *r3, L44
+L70: dec *r7
+L71: red *r5
+not r0
+L72: jmp L4
+sub *r4, r4
+L73: lea L67, r7
+red *r7
+L74: .data -988, -930, -967, -288, 748, 161, -141, 582
+L75: .string "beutrizaaactgomc"
+L76: lea L32, *r3
+dec *r5
+L77: bne *r6
+prn #-10
+stop
+L78: cmp r2, *r1
+sub *r5, *r2
+bne *r4
+L79: stop
+jsr *r2
+L80: prn r2
+L81: add r5, L7
+rts
+cmp r0, r7
+L82: jsr L46
+L83: clr r3
+L84: lea L48, r4
+rts
+cmp r0, L68
+; comment
+not L75
+clr *r2
+L85: clr L17
+bne *r0
+stop
+sub #-54, *r3
+add *r5, L69
+jmp L64
+red r3
+mov L1, r2
+inc L52
+L86: rts
+jmp *r0
+rts
+bne *r3
+rts
+L87: dec L64
+not r4
+clr r2
+L88: cmp *r0, #139
+not L64
+L89: clr *r2
+L90: .data 309, -944, 254
+stop
+; comment
+L91: .data -775, -77, -992
+L92: prn *r3
+L93: prn *r6
+rts
+L94: prn L58
+jmp *r6
+L95: add #-130, r5
+L96: jsr *r2
+rts
+red r1
+jmp *r7
+cmp r3, r1
+L97: jmp L76
+dec r2
+bne *r2
+cmp *r4, r7
+L98: prn *r7
+mov r7, *r0
+cmp #50, L45
+L99: sub #201, r0
+not r7
+red r4
+L100: .data 265
+bne L11
+red *r2
+L101: add L80, r7
+clr *r1
+; comment
+L102: stop
+L103: cmp *r4, r3
+L104: stop
+clr L53
+jmp L29
+not r5
+L105: mov r4, r2
+sub r5, r3
+L106: red L33
+lea L104, r1
+; comment
+L107: inc r5
+L108: clr L91
+red L79
+red r2
+L109: lea L32, L35
+L110: rts
+L111: red L109
+lea L95, *r3
+prn #-226
+lea L66, L75
+L112: stop
+dec *r4
+clr L80
+bne *r0
+mov L1, *r0
+cmp *r2, r3
+L113: jsr L15
+L114: sub *r4, *r5
+L115: cmp *r2, r5
+L116: .string "pfesssxdojioewqzvsw"
+bne *r7
+; comment
+rts
+jsr L64
+L117: .data -949, 294, -106, -429, 400, 137, 425
+prn *r5
+sub #-170, r4
+lea L86, *r1
+; comment
+cmp *r1, L6
+L118: .string "hqznnvosxmaagcjmya"
+dec *r3
+stop
+L119: cmp #81, #99
+L120: jmp *r4
+L121: dec L6
+L122: .data -835, -931, 123, 578
+L123: not L114
+L124: mov L66, L110
+stop
+L125: cmp L125, L70
+red *r5
+L126: red r0
+sub #-122, r0
+L127: jsr *r7
+dec *r6
+bne L53
+L128: red *r1
+L129: red r7
+mov #-149, L123
+L130: rts
+L131: lea L89, L87
+jsr *r4
+L132: inc *r2
+
+jmp L69
+L133: rts
+not r4
+stop
+jsr L80
+L134: dec r4
+L135: rts
+L136: stop
+bne *r5
+L137: jsr L16
+jmp *r4
+L138: .string "sfebdthohaexo"
+jsr L43
+stop
+add r2, r0
+cmp L109, #97
+L139: .data 834, -771, -839, -907
+L140: red L136
+cmp *r0, #55
+jsr *r4
+clr r1
+L141: .data 816, -382, -669, -260
+L142: rts
+add r7, *r4
+rts
+L143: prn L49
+dec *r7
+L144: .string "dupvdmgooklvx"
+dec r7
+L145: jmp *r7
+L146: rts
+jmp L92
+L147: cmp r4, L24
+stop
+mov r0, r0
+L148: clr L142
+inc *r6
+L149: not L108
+L150: rts
+L151: rts
+L152: rts
+sub *r5, *r2
+jmp L114
+L153: prn *r1
+L154: not *r4
+inc L138
+dec r4
+L155: clr L32
+prn #164
+mov r7, r4
+L156: not r3
+cmp L143, *r5
+jsr L60
+red *r0
+L157: .data 831, 387, 476, 797
+dec r3
+jmp L46
+cmp L11, r0
+lea L105, r3
+L158: mov *r2, r1
+lea L42, *r3
+L159: clr L5
+L160: .string "kk"
+bne L91
+red L48
+mov L96, L60
+L161: rts
+L162: .string "xpafwkwrbkw"
+L163: mov L14, r5
+dec *r0
+lea L10, r7
+; comment
+L164: jsr L81
+
+bne L133
+dec *r2
+prn r4
+L165: cmp *r4, L144
+L166: cmp *r1, #-123
+lea L145, *r4
+dec *r0
+L167: .data -864, 810, 161, -532, 753, -575
+
+stop
+dec r6
+red r4
+add *r3, L16
+sub L123, r2
+sub *r4, *r7
+mov L95, L32
+rts
+L168: .data -66, 602, -455
+cmp #-224, #-11
+not L87
+lea L85, *r4
+L169: add r0, r0
+bne *r4
+L170: add L72, L159
+L171: red L156
+L172: add r1, L68
+mov *r4, r4
+cmp *r7, L14
+jsr L165
+not r6
+L173: .string "d"
+red L26
+lea L38, L116
+clr L70
+inc *r6
+bne L43
+jmp *r4
+L174: bne *r1
+dec r7
+mov *r7, *r6
+clr L11
+jsr L13
+dec r5
+clr *r7
+lea L90, L105
+add *r1, *r7
+L175: rts
+mov #102, L43
+L176: jmp *r1
+stop
+rts
+inc L140
+L177: clr *r5
+sub #-1, L28
+L178: .string "ukgcxgyxpqiglzpy"
+L179: inc L165
+L180: cmp #143, r0
+not r5
+mov #129, *r4
+L181: inc r3
+L182: jmp L101
+red r6
+prn L102
+L183: stop
+L184: red L4
+L185: add #-247, L72
+add L69, *r3
+add r3, *r5
+lea L114, *r6
+L186: rts
+L187: rts
+sub L34, *r0
+L188: inc r7
+dec L46
+mov L25, *r6
+lea L67, L31
+mov #186, L77
+stop
+clr L101
+inc L165
+L189: .string "ffvqtywptsus"
+L190: .data -385, 556
+L191: sub *r6, *r2
+mov L24, L93
+prn *r0
+stop
+L192: lea L148, L125
+add #-177, L43
+sub #119, r5
+add *r4, *r0
+inc *r5
+L193: stop
+not r0
+rts
+L194: .string "afppidhdi"
+jmp *r7
+L195: mov L139, r1
+L196: sub #-248, L153
+sub L76, r5
+dec L134
+lea L105, L105
+L197: not *r2
+L198: prn *r6
+jsr *r6
+L199: stop
+jmp *r7
+clr L79
+stop
+sub L34, *r6
+L200: .string "zgfzugallae"
+L201: red r1
+red *r0
+L202: clr L125
+L203: jsr *r3
+not L168
+cmp r7, L115
+L204: .string "vmcxbmaynnqk"
+sub *r1, L83
+add *r3, r6
+cmp *r3, L192
+inc r5
+add *r2, r3
+L205: red *r1
+lea L171, r7
+mov L185, r7
+L206: jmp L172
+mov r7, r5
+sub r1, r0
+L207: not L136
+jmp *r2
+not *r7
+lea L126, *r6
+red *r1
+bne *r1
+bne *r2
+not *r2
+add *r6, L22
+sub #226, r0
+L208: add r5, L203
+bne *r7
+red *r5
+red L116
+
+L209: clr r6
+L210: .string "vgvbze"
+L211: .string "zikcuzdcxyurppedndwxtx"
+mov L129, L151
+prn #172
+cmp L204, *r0
+lea L198, *r3
+add *r5, *r7
+rts
+prn L105
+jmp L2
+bne *r7
+mov L48, *r1
+add *r2, L67
+inc r3
+clr *r0
+prn *r1
+dec r1
+L212: cmp r0, #-100
+add L131, *r2
+jsr *r1
+
+L213: .string "lmlckswxjoecshlqbsusul"
+jsr L156
+L214: .string "pua"
+red r2
+sub *r1, *r6
+L215: red L197
+; comment
+add #139, L16
+not r3
+clr r4
+bne L37
+L216: stop
+sub *r1, L195
+bne *r1
+
+not L60
+L217: dec L123
+L218: sub r2, L210
+red L28
+red *r2
+L219: sub r1, *r0
+L220: add L131, *r1
+inc *r0
+not L144
+L221: mov L178, L189
+
+mov #77, *r2
+mov #19, *r4
+L222: .data -670, 357, -725, -583, 993
+L223: .data -885, 563
+inc r7
+sub #-226, *r0
+L224: bne L205
+mov #-56, r4
+jmp L180
+cmp L139, #-25
+L225: cmp r1, L178
+dec L183
+prn L149
+red L115
+L226: rts
+L227: not *r2
+L228: .data 805, 823, -909, 114, -822, 735, 883, -307
+L229: add r1, r0
+dec r6
+L230: red L108
+L231: lea L73, *r4
+inc L166
+bne L153
+L232: .string "ou"
+L233: .string "lzubichs"
+L234: mov L38, L113
+L235: inc r7
+inc r7
+red L63
+lea L123, r2
+mov L183, *r1
+not r0
+mov L221, L94
+L236: clr L173
+L237: jmp L235
+stop
+L238: .data 626
+L239: prn r1
+L240: bne *r7
+prn L37
+L241: sub #76, *r3
+; comment
+inc L152
+; comment
+L242: .string "fjipsqoczaffqyffnwmgb"
+L243: jmp *r1
+L244: sub L201, *r5
+jmp L0
+clr r0
+bne *r3
+prn L141
+not r2
+
+dec *r1
+L245: lea L233, r1
+L246: .string "xeco"
+clr L105
+L247: rts
+prn *r1
+stop
+L248: not r4
+add #63, L95
+L249: mov r6, *r0
+mov #-59, L190
+rts
+L250: jsr L34
+L251: mov L218, *r1
+bne L117
+not L198
+cmp r0, L0
+red *r7
+L252: dec r5
+not r6
+cmp #36, *r7
+rts
+stop
+
+red *r4
+L253: not *r1
+jsr L99
+stop
+lea L188, L9
+L254: bne L138
+jsr *r4
+clr r5
+stop
+L255: prn r4
+bne L188
+; comment
+jmp *r4
+L256: jsr L148
+clr L77
+mov r6, *r7
+L257: .data 279, 449, 215, -772
+L258: prn #128
+bne L124
+mov #89, *r1
+cmp #55, #-252
+L259: dec r0
+add L106, L252
+jmp L177
+lea L33, L95
+bne *r6
+L260: .data 442, 92, 277, -535
+L261: cmp r7, #-254
+mov *r7, *r6
+add r3, L202
+stop
+L262: stop
+jmp L145
+rts
+clr L59
+not r3
+add L245, r2
+L263: .data -429, -182, -670, -271, -78
+stop
+L264: not *r2
+rts
+mov #-17, L127
+stop
+rts
+dec *r4
+not r0
+inc L171
+lea L189, *r1
+jsr L85
+L265: mov #-252, r3
+L266: lea L11, *r6
+L267: .string "ytaogjsaxskkxxmxtjcdtzqs"
+prn #7
+L268: .string "mjihusilmrvqkqktnhftbeds"
+L269: .data 843, -693, 690, 166, 864, -874
+L270: dec L69
+; comment
+bne L245
+L271: .data 654, -234, -65, 614, 29
+L272: .string "oqwovfkznohwxapsy"
+stop
+prn #90
+; comment
+add r5, r1
+inc r6
+mov *r4, *r3
+not L76
+sub L211, r1
+rts
+L273: stop
+sub r7, r7
+bne L64
+not L166
+lea L227, *r2
+mov #133, *r3
+cmp #-14, L231
+L274: .string "lvktxun"
+L275: .string "ftwkfiftzibjbbsyrzq"
+L276: mov *r6, L126
+bne L163
+L277: add L257, r3
+rts
+inc r0
+L278: clr r0
+L279: add L128, r6
+
+red r1
+lea L211, r1
+rts
+L280: cmp #-49, *r2
+L281: red L192
+L282: jsr L246
+L283: jmp L205
+jmp L50
+L284: dec *r2
+L285: clr L75
+not *r7
+stop
+dec *r3
+L286: cmp r4, #-151
+inc L21
+L287: prn *r4
+red L31
+L288: jsr *r7
+; comment
+dec L127
+prn r0
+L289: stop
+L290: add *r7, *r2
+lea L220, L277
+sub *r7, L276
+rts
+L291: sub r2, r5
+bne *r3
+L292: mov L128, *r3
+L293: rts
+L294: jsr *r1
+not *r0
+L295: jmp *r2
+clr L68
+L296: clr r1
+add L242, *r1
+not L155
+inc r4
+jsr *r1
+sub L227, L271
+bne L188
+L297: add r6, L117
+clr r2
+L298: clr L212
+clr r2
+sub r5, L285
+L299: .string "nnykng"
+L300: red L258
+prn r5
+red r6
+rts
+rts
+jsr *r4
+sub L92, *r7
+L301: stop
+clr L72
+L302: .string "glrjcmyziwgmvduvxus"
+sub L283, L206
+inc *r4
+prn r6
+L303: dec *r6
+jsr *r1
+; comment
+stop
+not *r7
+prn *r1
+rts
+lea L116, L56
+L304: inc *r4
+add #175, L121
+not *r7
+clr L195
+L305: .data -663, 754, 429, 325, 433
+not r1
+lea L183, L139
+mov r5, *r1
+add L246, r2
+L306: rts
+L307: clr r7
+L308: lea L260, *r4
+L309: .data -713, 528
+L310: cmp *r2, L300
+jsr L200
+prn r7
+mov #126, L209
+L311: clr r7
+not *r2
+prn r2
+prn #-225
+rts
+stop
+dec *r3
+mov #25, L241
+mov r5, r6
+jsr *r5
+red L234
+cmp r1, *r6
+L312: rts
+L313: stop
+prn #-226
+L314: lea L96, L309
+L315: .string "yvnw"
+sub L97, L74
+L316: .string "dntabp"
+L317: .data -308, 868, 386
+L318: cmp *r4, r1
+L319: lea L216, r5
+L320: jsr L229
+jsr L88
+; comment
+L321: not *r0
+jmp *r0
+L322: not *r3
+mov r0, L77
+; comment
+sub #-193, *r2
+stop
+rts
+lea L251, *r4
+red L65
+red r0
+dec *r6
+L323: jmp *r2
+L324: not L145
+L325: .data 222, 912, 33, 555
+add #-49, *r7
+inc L223
+
+L326: prn #-38
+L327: rts
+mov r7, *r7
+mov r2, *r3
+L328: .data -213
+L329: jsr L173
+dec L254
+L330: inc L45
+jmp *r6
+L331: lea L204, L58
+bne *r4
+red L202
+L332: mov #111, *r3
+bne *r3
+add L324, r6
+jsr L332
+inc L271
+sub #-174, *r5
+; comment
+L333: dec L186
+L334: cmp #86, L299
+cmp r3, r1
+mov L12, *r2
+L335: not L230
+jsr *r2
+inc *r7
+L336: stop
+L337: sub r2, L111
+sub r5, r2
+mov #197, *r4
+lea L314, r3
+; comment
+not *r4
+inc *r5
+jmp *r3
+lea L173, L105
+sub L215, L213
+L338: mov *r7, r2
+inc L83
+rts
+L339: inc r2
+not *r6
+L340: sub L312, r3
+; comment
+; comment
+cmp *r7, *r6
+jsr *r1
+jsr *r1
+L341: .string "gxvdsiwxtobxenyq"
+cmp *r5, L31
+L342: .string "xsh"
+L343: .data 293
+L344: prn #57
+L345: .data -758, 190, -888, -474, 405
+L346: .data 572, 410, 971, -271, 79, 35
+mov *r2, *r4
+not L44
+add L315, r1
+
+red L274
+rts
+cmp #-249, #222
+L347: stop
+stop
+bne L104
+L348: prn r2
+L349: .string "iauuowhhd"
+add r6, L109
+
+not L259
+clr r7
+mov L29, L239
+L350: add *r6, r1
+bne *r0
+lea L27, L78
+add #28, L282
+L351: stop
+cmp *r2, r3
+stop
@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 16
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: sub #29, *r0
+prn #-33
+red L0
+add #-178, L0
+L1: sub #-204, L1
+L2: prn r3
+dec r3
+prn L0
+dec L2
+not r5
+mov L1, L2
+not *r5
+L3: add *r1, *r4
+L4: add #136, r3
+L5: red r1
+sub *r3, *r3
+red L1
+sub L1, L3
+dec L0
+L6: .string "bvcxpfxnwxrgguylzei"
+bne L6
+L7: .string "zcrvavaakxnidynfln"
+cmp *r5, #21
+inc r3
+L8: .string "rksrnwsmdkxqujlmm"
+L9: not L1
+add #-30, r0
+rts
+clr r1
+cmp L7, r5
+jsr L0
+L10: cmp r2, r1
+L11: rts
+rts
+stop
+add r6, L3
+L12: not L0
+; comment
+L13: .data -95, -782, -335, -319, -385, -743
+red *r3
+jsr L7
+L14: dec L1
+not L7
+L15: stop
+cmp #160, *r2
+rts
+not r1
+L16: clr r1
+rts
+L17: dec r4
+jsr *r5
+mov *r4, *r7
+cmp L15, L0
+L18: prn r0
+rts
+not *r1
+red L1
+L19: jmp L18
+mov L11, *r2
+red *r7
+L20: sub #-151, L11
+inc L14
+lea L14, *r0
+; comment
+L21: stop
+clr L17
+L22: sub #116, *r4
+L23: add *r7, L4
+L24: prn #47
+L25: bne *r7
+red L13
+L26: add *r5, r3
+; comment
+stop
+cmp r0, r5
+L27: rts
+inc *r3
+lea L24, r5
+stop
+L28: clr *r2
+rts
+not L10
+mov #-252, *r4
+L29: jsr L9
+L30: jsr *r2
+jsr *r2
+red *r2
+jsr *r1
+not r0
+L31: .string "lfyrpaxgcs"
+sub r3, r4
+L32: prn r2
+inc L14
+L33: sub r3, r3
+stop
+mov *r5, r2
+lea L15, r4
+L34: prn L2
+
+clr r4
+clr r6
+lea L21, L33
+L35: jsr L30
+rts
+; comment
+red r4
+L36: .data -180, -178, 579, 837, -840, 547
+dec r3
+bne *r0
+L37: mov #-124, *r1
+prn L10
+sub *r3, L24
+L38: add *r0, *r1
+L39: .data 271, -535, 794, 498, 245
+sub L26, *r1
+L40: prn L21
+L41: rts
+bne *r4
+stop
+L42: rts
+mov *r3, *r0
+stop
+L43: clr *r4
+L44: inc *r6
+lea L28, *r2
+rts
+jmp L19
+lea L33, r5
+cmp L28, r3
+L45: prn r0
+add L30, L12
+not *r2
+add #13, *r1
+mov L14, L39
+prn L14
+L46: lea L15, r5
+bne *r7
+jmp *r4
+L47: .string "kchejpp"
+dec r6
+mov #-114, *r3
+L48: stop
+inc L39
+add r7, r3
+lea L36, L23
+L49: .data -489
+L50: bne L9
+L51: prn #-135
+mov #-124, L5
+stop
+not r2
+lea L48, L33
+L52: dec L51
+rts
+rts
+jmp L26
+clr r0
+stop
+L53: .string "esjikygucsxcjfhscj"
+stop
+clr L3
+clr r1
+mov #115, r7
+L54: jsr L26
+L55: sub #6, *r3
+sub L13, *r3
+dec *r6
+dec L30
+rts
+dec r5
+dec r6
+L56: add L25, r0
+L57: .string "beybzofvcuj"
+bne *r7
+L58: stop
+jmp L19
+
+sub *r5, r2
+lea L37, *r1
+L59: lea L10, r4
+inc *r5
+add *r5, *r2
+not *r6
+
+rts
+L60: .string "eil"
+L61: lea L6, L44
+red *r7
+stop
+sub L25, r1
+prn #-94
+dec L38
+inc L21
+not *r1
+L62: sub #51, L16
+jsr L37
+prn r2
+L63: inc r4
+rts
+L64: rts
+L65: clr r6
+L66: add L12, *r6
+red *r1
+clr r4
+clr L54
+jmp *r5
+L67: .data -678, 657, -185, 722, -807
+sub L3, r6
+dec L40
+sub r7, L9
+jsr L45
+cmp #-226, *r5
+L68: .data 474, 848, -414, -142, 35
+mov r4, L44
+sub L27, *r6
+sub *r3, L44
+mov *r7, r1
+L69: not L3
+dec r3
+red r5
+bne *r6
+L70: inc r5
+lea L24, L69
+dec r3
+rts
+dec *r6
+mov *r4, L18
+inc *r3
+L71: mov *r2, r3
+mov #40, L6
+L72: sub #-134, L41
+
+sub r6, L3
+prn r2
+L73: red r3
+not *r2
+cmp L68, L34
+dec L35
+lea L22, *r5
+red *r0
+L74: mov r4, *r3
+rts
+L75: not *r2
+lea L2, r1
+L76: dec L1
+inc r5
+bne L32
+jmp L11
+clr *r1
+L77: sub L18, r3
+L78: .string "mmdvkgbdgy"
+sub #-65, r2
+bne L33
+mov #167, r1
+inc L46
+bne *r3
+prn L12
+rts
+lea L68, r1
+rts
+jsr *r1
+bne L8
+dec *r4
+jmp *r7
+cmp r4, r5
+red L26
+L79: lea L24, L18
+red r7
+L80: .data -413, 86, -321, -29
+L81: jmp *r5
+add r7, *r2
+L82: stop
+bne *r2
+sub *r2, *r3
+L83: rts
+inc r7
+sub #-18, *r2
+clr r5
+
+L84: not r5
+L85: red L10
+inc r3
+lea L50, *r1
+; comment
+L86: dec r2
+L87: .data -58, -992, -226
+prn L32
+L88: prn #169
+inc *r2
+L89: prn r1
+rts
+prn L33
+L90: .string "of"
+L91: not *r1
+L92: .string "q"
+L93: clr r4
+L94: bne *r6
+L95: .data -516, 70, 750, 471, 30, -334, 38, 502
+L96: cmp L16, *r4
+
+L97: red *r1
+mov L73, L43
+L98: stop
+jmp L90
+red *r1
+L99: bne *r7
+rts
+
+prn L78
+mov #-72, *r4
+; comment
+lea L19, r2
+L100: red L54
+clr *r1
+not *r2
+dec L9
+L101: jmp L17
+
+; comment
+sub r3, r7
+jsr *r0
+red r2
+jsr *r1
+prn L21
+clr L82
+jsr L51
+L102: .string "xfcjhwpuqlmuksvj"
+L103: inc *r6
+L104: .data -358, 173, 970
+cmp *r4, #99
+inc *r1
+jsr *r2
+inc L70
+add r7, r1
+prn #85
+L105: .string "dhnhyyof"
+L106: dec *r4
+jsr L72
+L107: bne *r4
+L108: dec *r5
+L109: .string "ekqyspqncshzcjcchy"
+L110: lea L89, L24
+prn #125
+prn L93
+jmp L23
+L111: rts
+L112: sub L111, *r7
+jsr L10
+sub r4, *r1
+sub L18, L37
+rts
+red r4
+dec *r3
+inc *r6
+L113: dec L93
+lea L58, *r4
+cmp L20, L14
+L114: .data -299, -818, -175, -502, -460, 941
+bne L69
+bne *r5
+rts
+bne L103
+mov *r5, r5
+L115: .string "tulpxbwuchkdulxeiyvyxu"
+L116: clr L47
+lea L22, *r2
+stop
+L117: .string "iqleffrjhsqehwqyldqg"
+bne L107
+red *r1
+L118: dec r5
+L119: bne *r4
+mov r6, r2
+stop
+dec *r6
+mov #152, L84
+L120: lea L75, r3
+inc *r0
+L121: red L104
+L122: lea L67, r4
+; comment
+L123: jmp *r3
+L124: .data -867, 548, -574, 708, 177, -310, 453, 335
+jmp *r3
+dec L28
+mov *r4, r5
+lea L30, L85
+L125: jsr *r3
+
+L126: .data 365, -817
+L127: bne *r3
+clr r2
+cmp r2, #19
+L128: cmp #-202, r3
+jmp *r5
+L129: .string "tolpvzjfrj"
+L130: bne *r6
+clr r3
+jmp *r2
+not *r0
+L131: .string "velbzagalxuzncjcmh"
+L132: .data 866, -796, 471
+L133: prn L1
+prn L10
+L134: .string "jpwccmhcbswkcna"
+dec *r5
+cmp L115, *r2
+add r7, *r2
+lea L103, L42
+L135: .string "bgmlidaytoaluaodlhibzskm"
+L136: .data 144, 928, -209, 237
+L137: .data -799, -522, 276, 855, 466, -807
+sub r7, r2
+lea L70, *r3
+L138: add r3, r7
+mov L40, *r3
+L139: .string "hyaxvmjdrvibmgbqgntslzs"
+cmp L22, *r6
+stop
+cmp L22, #242
+L140: rts
+add #-126, L124
+L141: .string "elotdyhkrvbhkrypov"
+red L73
+prn #-91
+L142: .string "eznighexzfikjvgvr"
+
+; comment
+L143: add #-198, r2
+lea L132, L118
+dec *r3
+rts
+clr r6
+; comment
+cmp L142, r2
+prn L44
+L144: jsr *r4
+
+rts
+L145: .string "uouizqkkdqevufuyrxtucq"
+L146: .data 314, 635, 312, -987, -860, -142
+red L55
+rts
+L147: prn #116
+L148: jsr *r4
+L149: .data 938, -820, -965, -770, -164, -197, -993
+jsr L140
+add *r3, r7
+rts
+L150: stop
+L151: not L117
+L152: .string "dmzwb"
+L153: dec L113
+L154: .data 217, 119, 56, 513, -788, 32
+bne L41
+clr *r2
+dec L58
+lea L15, *r6
+L155: .string "afslqgbe"
+
+jmp L149
+L156: add #89, *r7
+L157: .string "sz"
+stop
+L158: .data -245, 873, -465
+cmp r0, *r1
+L159: cmp r4, #239
+dec r3
+bne L70
+L160: .data -484, 652, -22, -916, 160, 276, 214
+L161: red r1
+red L8
+stop
+L162: bne *r5
+inc L149
+L163: red *r2
+L164: rts
+L165: dec *r0
+L166: .string "kkzitktsfuyavozduhzunfo"
+L167: lea L166, r1
+rts
+add r5, *r1
+L168: .data -933, 242, -213, 870, 258
+inc L125
+L169: add L13, L96
+inc L5
+rts
+add *r4, L7
+sub *r6, *r1
+L170: lea L159, r2
+L171: rts
+sub #-35, r3
+add L139, r4
+L172: lea L39, r3
+L173: dec r5
+L174: .string "ptzaaewwzwohgzalbjriaq"
+stop
+cmp *r6, #56
+cmp *r2, #-246
+L175: jmp *r0
+rts
+L176: .data -256
+L177: sub #78, L45
+L178: dec *r3
+bne *r1
+red L169
+stop
+prn *r4
+red L48
+jmp L17
+add *r0, *r3
+L179: stop
+rts
+bne *r5
+jmp L99
+not *r4
+red *r6
+jsr *r5
+inc L152
+clr *r6
+L180: rts
+jsr L110
+L181: jsr *r2
+L182: add #254, r3
+bne *r2
+not *r3
+L183: jsr *r6
+add r2, *r7
+L184: dec r2
+mov #-254, r6
+L185: sub *r1, L76
+L186: .string "jzevbxnyhlbrncce"
+L187: cmp *r1, #70
+prn #186
+jsr *r1
+L188: .data -528, 834, 423, -140
+rts
+red r3
+L189: stop
+sub L35, r7
+dec *r6
+L190: not r5
+cmp L9, L56
+dec *r4
+jsr L183
+red r2
+L191: stop
+L192: add *r4, L141
+add r2, *r7
+L193: stop
+L194: jsr L68
+cmp r5, L179
+bne L27
+rts
+clr L171
+jsr *r7
+L195: .string "heycckmjkgyqph"
+L196: mov #75, *r4
+rts
+not r1
+add *r2, *r4
+not r7
+L197: .string "lhvoimhnseb"
+L198: add L132, *r2
+jmp L71
+L199: bne L16
+L200: .string "im"
+add L64, *r0
+clr r7
+
+cmp r5, #250
+L201: .string "naqstaodhunij"
+L202: dec r1
+red *r4
+L203: not L158
+clr *r7
+L204: .string "sokmevnjzxvrpmkudst"
+lea L180, *r6
+jmp L44
+dec *r3
+L205: rts
+rts
+L206: jsr *r2
+L207: inc *r6
+L208: stop
+L209: .string "yxklvwdh"
+L210: dec *r1
+cmp #141, r4
+bne *r7
+inc *r4
+dec L137
+prn r3
+jmp *r1
+cmp *r0, #-228
+L211: clr r1
+jmp *r0
+mov *r1, L61
+dec *r5
+bne *r0
+clr r0
+lea L28, L84
+prn L43
+dec L108
+rts
+add L30, L142
+L212: dec r7
+red *r5
+L213: red *r3
+lea L147, r2
+L214: .data -441
+L215: jsr *r3
+L216: .string "zsg"
+L217: red r6
+jsr *r3
+L218: stop
+prn *r5
+mov *r1, *r5
+not L108
+jmp L215
+jmp L32
+L219: .data 989, -545, -399, -695, -4, -657, 189
+L220: cmp *r3, L175
+L221: mov L173, r0
+clr *r2
+bne L88
+L222: bne L67
+not r3
+mov r4, *r7
+lea L137, *r0
+dec r5
+bne L81
+L223: dec *r0
+rts
+red r2
+mov #-82, r2
+cmp r6, r5
+dec r1
+L224: jmp L182
+dec L95
+mov *r4, L106
+stop
+
+lea L123, r7
+sub #133, *r1
+L225: mov L139, L221
+add *r7, *r3
+cmp *r5, *r3
+dec L102
+L226: clr L203
+red *r1
+prn r3
+dec L168
+jsr *r1
+L227: add L27, *r7
+sub L62, r0
+bne L193
+; comment
+lea L177, r5
+lea L123, L120
+mov *r6, *r0
+L228: jsr *r6
+jmp L2
+
+add #129, L28
+add *r7, L105
+rts
+L229: .string "vfjdzapt"
+prn L117
+clr *r6
+mov #-223, r1
+cmp L229, L51
+clr L222
+red *r6
+L230: rts
+; comment
+prn #-191
+prn r6
+mov #-245, r0
+L231: inc r7
+L232: inc L171
+stop
+; comment
+inc r2
+sub *r1, L224
+L233: .data 457, -820, 530
+rts
+L234: rts
+jmp *r5
+L235: rts
+sub #-248, r0
+not L48
+L236: rts
+L237: prn r2
+inc r1
+prn *r1
+L238: mov L71, *r6
+rts
+L239: mov r3, *r5
+L240: add *r0, *r3
+
+mov #-66, L100
+L241: rts
+L242: prn r2
+dec *r5
+jsr *r5
+mov #122, L148
+L243: jmp *r0
+mov *r7, *r4
+L244: cmp *r7, L154
+inc r1
+cmp #-139, L44
+prn *r3
+L245: prn #55
+L246: stop
+cmp #91, *r6
+jsr *r2
+; comment
+jmp L173
+lea L244, L210
+; comment
+L247: .data 876, -70, 744, 246
+sub *r1, *r6
+bne L3
+; comment
+not r6
+L248: .data -933, 698, 512, 674, -742, 864, -382
+sub *r7, L5
+dec r2
+clr L22
+stop
+L249: .data -483, 920, 326, 525, 436, 715, 619
+add #-115, L238
+jmp *r0
+L250: lea L162, L35
+L251: lea L187, *r6
+L252: inc L79
+dec r2
+jmp *r1
+; comment
+dec r7
+rts
+sub r5, *r2
+cmp r6, *r7
+clr L238
+; comment
+
+; comment
+bne L71
+prn #56
+L253: jmp L52
+L254: .data -732, 661, 214, 680
+L255: .data -328, -762
+inc *r6
+L256: prn #55
+add *r5, r5
+clr *r5
+inc *r0
+L257: sub #24, L218
+L258: lea L110, r3
+red *r1
+mov *r6, *r4
+L259: .string "hwlwjvkmjjejhxgaxqilw"
+clr r5
+dec *r2
+L260: jmp *r7
+bne *r0
+cmp r6, #-129
+L261: .data 10
+L262: stop
+stop
+L263: stop
+not r6
+add *r3, L177
+clr *r5
+not r3
+L264: sub r2, r0
+dec L24
+L265: stop
+L266: .string "zzktsvlqojwjtogvowexbjg"
+add L234, r4
+mov L13, r2
+L267: .data 974, 410
+rts
+L268: mov *r3, *r4
+L269: .string "lyajfcbdwoufjawlbrb"
+cmp L27, *r4
+jmp *r3
+bne L159
+L270: clr *r2
+not r4
+stop
+L271: dec r6
+inc r1
+bne L106
+dec L154
+red *r6
+sub *r7, *r6
+L272: .string "kjdzv"
+not *r6
+bne L21
+dec *r6
+sub L37, *r7
+L273: .data -233, 26, -779, 587, 852, 201, 379, 42
+L274: .data 209, -580, -772, 247, -923, -899, -457, -796
+mov #-28, r7
+add *r6, *r5
+L275: jmp L223
+; comment
+add L9, r3
+sub *r6, r1
+red L95
+sub r1, L142
+not *r0
+L276: jsr L69
+dec *r5
+not r3
+jsr *r6
+lea L222, L246
+sub r2, r5
+L277: dec L37
+L278: clr *r3
+
+stop
+L279: prn r7
+clr r4
+inc r6
+prn *r3
+clr L100
+rts
+L280: not L220
+prn r2
+inc r6
+add *r3, L243
+L281: sub *r1, *r5
+
+bne *r6
+red r4
+L282: dec L0
+L283: dec *r7
+jsr *r5
+L284: .data -472, -246
+not *r1
+inc r4
+clr r4
+L285: lea L197, L97
+
+rts
+bne *r2
+L286: not L51
+prn *r7
+L287: inc r5
+L288: .string "cxpqrttakyjmu"
+L289: cmp #45, #18
+mov *r1, L35
+mov r5, L251
+jsr *r5
+L290: dec *r6
+L291: .string "ytwltdhlccwjgznjtapuyn"
+L292: .string "tyosptxmvyzar"
+L293: bne L269
+rts
+red *r3
+L294: stop
+red *r4
+cmp *r6, L199
+; comment
+L295: dec r6
+cmp r7, r1
+L296: jsr L144
+L297: add L66, *r4
+L298: cmp r7, #142
+L299: mov L15, r6
+not L287
+lea L179, L206
+jmp L230
+stop
+clr *r7
+stop
+lea L151, r1
+L300: jsr *r1
+dec *r7
+; comment
+bne L22
+prn L174
+L301: .data -365, 265, 520, -256, 320, -882, -653, 967
+L302: .data 675, 464, -403, 556, 316, -38
+not L61
+bne *r3
+L303: .string "turdhheejwxtlkgra"
+add #56, *r1
+; comment
+stop
+add r4, *r0
+jmp L242
+L304: prn *r3
+jmp *r0
+not *r7
+L305: bne *r4
+sub r3, *r3
+jsr *r3
+L306: rts
+red *r1
+jmp L210
+L307: prn L21
+rts
+inc L229
+clr *r4
+clr r0
+
+prn r7
+jsr *r5
+add r6, r0
+sub L245, L89
+L308: .string "jmbwrockgrjrurhvcojlmku"
+add *r1, L25
+clr *r2
+dec r7
+
+lea L223, r7
+not *r7
+L309: .string "rbcsib"
+sub r1, *r6
+L310: mov *r2, L258
+L311: dec L303
+L312: .string "hapnmdgyrmotuvjhm"
+clr L259
+
+jsr *r6
+L313: mov L95, L179
+cmp L289, L194
+L314: .string "qxrtmp"
+; comment
+inc r5
+jmp L140
+bne *r6
+jmp *r6
+L315: .string "lrmbj"
+add #-107, r7
+sub L258, *r0
+prn *r6
+sub r2, r6
+jsr *r5
+jsr L79
+dec r5
+mov r5, *r4
+jmp *r7
+prn #-208
+L316: sub r2, r3
+mov L189, r4
+not *r3
+add #-181, L310
+lea L38, L273
+L317: clr L177
+jmp *r3
+jsr L76
+L318: .data 775, 904, -603, 578, 903
+red L37
+L319: .data -962, 932, 925, -55, -698, -418, -909
+L320: clr r1
+L321: add *r2, L174
+L322: jmp L242
+stop
+L323: .data 300, -412, -25, 339, 54, -887
+L324: inc r3
+stop
+not L149
+L325: stop
+cmp *r4, *r2
+L326: clr L250
+add #146, *r7
+cmp #50, #-90
+inc r6
+lea L291, L72
+L327: add L197, L110
+cmp r3, r3
+L328: dec L186
+stop
+L329: prn L252
+lea L210, *r4
+jmp L35
+rts
+L330: red r7
+L331: .string "xothqfkatcpxoszftss"
+jsr *r6
+add #207, r2
+L332: jsr L14
+L333: mov L234, r3
+add *r5, r0
+bne L269
+
+stop
+L334: clr L230
+add #251, L309
+L335: dec L188
+sub L207, *r3
+L336: lea L188, L142
+L337: add L80, r5
+sub r2, L35
+stop
+not r3
+stop
@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 17
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: .string "zqsazbixdcfejuod"
+L1: add L1, r2
+jmp L0
+jmp L1
+mov *r1, *r5
+L2: not r1
+dec L0
+mov #-200, L0
+inc L1
+L3: clr r5
+red r5
+L4: .string "hedqwbcrlpdlbvkhrysr"
+rts
+L5: bne L5
+bne L0
+L6: sub *r6, *r7
+clr *r6
+dec *r1
+red r6
+L7: .data 423, -634, -44
+dec r7
+sub #-145, r7
+L8: .data 534
+dec *r3
+prn #60
+L9: lea L3, L7
+L10: prn r3
+L11: .data -453, 511, -367, -617
+dec r6
+L12: .data 28, 161, 978, 286
+L13: cmp #130, #-50
+dec r4
+L14: inc *r3
+clr L1
+not L9
+not *r2
+L15: add *r0, *r7
+inc r2
+add L4, r7
+
+L16: jmp *r0
+L17: add #78, r3
+L18: stop
+L19: red L6
+; comment
+sub r0, L18
+dec L14
+L20: jmp L12
+stop
+not *r2
+sub *r5, *r4
+jmp L3
+L21: lea L8, L12
+dec *r0
+L22: .data 803, 858, 868, -10, 384
+L23: sub r2, *r1
+L24: jmp L23
+add L13, L8
+red r7
+sub r0, r6
+add #-185, *r1
+stop
+L25: dec L9
+L26: not r1
+dec L25
+L27: not L4
+clr L27
+add *r2, *r0
+jmp *r3
+sub L7, *r4
+mov #-188, *r2
+dec *r4
+jsr *r3
+cmp #82, #251
+jsr L24
+L28: jmp *r5
+inc *r2
+red *r7
+L29: not r6
+add r5, r0
+L30: .data 387, -266, 493, -68, -949
+L31: rts
+L32: mov #25, r2
+mov #-102, L27
+not r3
+; comment
+add r7, L15
+L33: .data 93, -951, -800, -680, -305, 690, 257
+jmp *r0
+
+bne *r6
+dec *r0
+not L28
+stop
+prn #-28
+L34: .string "joqiskcrsrlstcjuc"
+cmp r1, L3
+add r2, *r2
+jsr L27
+bne *r1
+lea L28, *r7
+L35: not *r4
+L36: jsr *r0
+
+red r0
+lea L35, L28
+clr L29
+L37: dec L12
+not *r1
+add *r7, r1
+bne *r4
+L38: not *r7
+cmp #205, #236
+L39: jsr *r7
+red r0
+mov #-36, *r2
+jsr L2
+red *r7
+dec L18
+mov #-127, L19
+add r6, r3
+jmp L4
+rts
+L40: not L34
+cmp r6, *r1
+stop
+L41: .data 115
+bne *r4
+bne *r0
+L42: .data 946, 48, -85, 281, 315, 496
+L43: add r6, r6
+red L11
+L44: cmp r5, r2
+add #37, L16
+L45: .data 688, -430, 753, -144, -124, -959, 408
+jsr L12
+cmp *r3, L40
+prn *r1
+prn #-84
+red *r1
+prn r1
+cmp #14, #11
+not r4
+; comment
+L46: mov L24, *r2
+L47: stop
+stop
+L48: stop
+clr *r1
+L49: .data 936, 745, 977, -878, -959, 510, 294, -797
+L50: add #-89, L28
+prn *r7
+prn r0
+bne *r2
+clr L9
+stop
+L51: lea L33, r4
+jsr *r1
+rts
+jsr L6
+cmp r5, #-22
+sub *r4, L11
+red *r5
+L52: sub L36, L15
+mov #-72, *r1
+L53: .string "rcbvzdwohcklzqdxeit"
+jsr *r0
+add #158, L52
+L54: jmp *r3
+
+mov #87, L24
+L55: red r2
+rts
+sub L32, L40
+L56: .data 985
+L57: .data 525, -38, -248, -137, -838, 407, -708
+L58: cmp *r6, #83
+red r4
+clr *r6
+cmp *r7, *r0
+red *r4
+not L23
+clr r6
+jmp L24
+dec r0
+jmp L13
+not r5
+prn #-256
+rts
+bne L48
+not *r1
+prn r0
+sub L11, r5
+L59: .data 677, -93, -119
+mov r1, *r6
+L60: clr *r7
+L61: lea L37, L42
+add r4, r5
+rts
+
+
+red r4
+L62: add r5, r0
+L63: jsr L3
+L64: .string "sva"
+jsr L56
+prn r6
+red *r4
+jsr *r3
+jsr L6
+red L48
+L65: clr L24
+lea L36, *r2
+red *r5
+cmp #7, L2
+mov r2, r1
+L66: add *r0, *r4
+L67: mov *r1, r3
+L68: not L68
+L69: stop
+jmp *r3
+lea L61, *r1
+jmp L55
+
+inc r0
+bne *r5
+prn L46
+lea L17, L46
+rts
+L70: .data 475, 522
+dec *r2
+L71: sub r7, r3
+prn #124
+jsr L1
+jsr L29
+jmp L24
+dec r4
+L72: dec r7
+L73: jsr *r5
+mov *r4, *r2
+not L62
+clr L65
+
+; comment
+L74: not *r2
+
+L75: clr *r1
+stop
+bne *r4
+dec L40
+L76: lea L17, L12
+L77: add L16, *r5
+not L16
+jmp *r3
+jmp L51
+mov L5, *r6
+L78: not L21
+mov #-32, r1
+jmp L16
+prn L54
+rts
+L79: dec *r0
+L80: .string "ktitwjrb"
+dec r7
+inc L54
+L81: jsr *r6
+L82: red *r1
+bne L17
+red r4
+L83: clr *r6
+L84: not r7
+sub *r6, *r6
+L85: .data 737
+L86: .string "xeb"
+L87: add r1, *r5
+L88: prn #-24
+clr *r1
+L89: not *r5
+not *r2
+jmp *r7
+cmp L23, L41
+L90: add r7, L88
+add #-166, *r5
+clr L22
+red L39
+; comment
+rts
+mov #135, *r5
+jsr L29
+lea L13, *r2
+L91: .data 583, -145, -423, 510, 468, 455, -684
+add L58, *r0
+clr r3
+sub r1, *r5
+L92: jsr *r2
+red r6
+not r7
+mov *r3, r1
+add *r4, *r4
+L93: inc L70
+prn *r1
+rts
+L94: sub L23, *r0
+jsr *r5
+L95: add *r2, L57
+L96: not r7
+L97: .data 419, -203, -513, 263, -636, 644
+L98: inc r4
+bne *r1
+L99: rts
+sub #-28, *r2
+jsr *r2
+mov r7, *r6
+L100: red *r7
+L101: mov L86, r4
+dec r1
+inc L21
+add L96, *r1
+
+inc L13
+prn r5
+L102: .string "z"
+prn L69
+red r2
+L103: jsr L29
+L104: .data 900, 230, 215, -3, -619, 32, -333
+L105: .data 879, 47, -346, 766
+L106: red *r0
+add #-81, *r2
+; comment
+L107: prn *r5
+lea L33, r5
+L108: .string "cmmnytczgzpdljwvtn"
+L109: add r5, L59
+L110: cmp L49, r7
+lea L18, r1
+L111: .data -739, -41
+L112: not r7
+
+inc *r7
+jsr *r7
+L113: cmp *r5, #246
+lea L10, r3
+
+not r0
+mov L58, *r1
+rts
+cmp *r4, L34
+L114: bne *r2
+sub *r5, *r1
+L115: jsr L39
+rts
+L116: inc L8
+L117: sub L113, L8
+red r1
+cmp r5, r2
+L118: dec r6
+red *r3
+prn r2
+L119: red *r4
+L120: jmp L86
+jmp *r2
+add r0, L89
+L121: .data 669, -791, 939, -497, 623
+stop
+jsr *r2
+; comment
+stop
+L122: jsr *r0
+dec r2
+L123: sub #-31, *r2
+L124: cmp r7, *r3
+not L13
+L125: not *r7
+L126: inc r0
+lea L27, *r4
+L127: .string "wxbfuvaudtiyrnum"
+L128: red r7
+not L30
+L129: lea L64, L128
+cmp r4, r3
+cmp *r7, L101
+L130: add *r6, L83
+lea L6, L45
+L131: dec r6
+cmp *r1, #-234
+
+jmp *r1
+add *r1, r6
+
+mov #-64, *r4
+cmp r1, r6
+L132: jsr *r2
+L133: prn *r3
+prn #58
+L134: .string "wykbxredzfjtebd"
+bne L14
+inc L2
+jmp L50
+red r5
+L135: jmp *r1
+rts
+jsr *r0
+rts
+stop
+not L60
+L136: cmp L67, r0
+L137: prn L83
+bne L128
+inc r2
+
+prn L103
+L138: inc r5
+L139: red L23
+L140: .data 109, -956, 23, -261, -568, 286
+jmp L58
+L141: jmp *r7
+L142: red *r7
+
+clr r7
+stop
+add #62, r0
+not r6
+dec r7
+L143: not r7
+L144: jmp L42
+mov L112, L51
+stop
+red r6
+bne L133
+jmp L130
+L145: .string "csqrarrtilwccwdnbem"
+inc *r1
+L146: dec L15
+jmp L124
+sub r1, *r7
+bne L13
+lea L114, *r6
+; comment
+L147: .string "rjiodtaunxjrkwwe"
+lea L44, *r0
+L148: .data -229, 32, -981, 433, -172
+L149: inc *r1
+dec r7
+L150: not L136
+sub L75, r1
+L151: red L138
+L152: red *r3
+cmp #144, L42
+bne L36
+stop
+bne L110
+clr *r1
+L153: .data -22, -915, 633
+mov *r2, r6
+jmp L79
+L154: .string "gqdcbcoebbphg"
+add L44, L41
+L155: lea L151, *r7
+rts
+mov *r2, *r5
+inc L83
+cmp L54, L76
+L156: dec r7
+bne L135
+L157: sub r1, *r4
+L158: .data -18
+cmp L33, r2
+L159: cmp #-34, *r3
+L160: rts
+bne L45
+dec r2
+L161: clr *r1
+L162: prn #-182
+clr *r2
+cmp *r5, L90
+
+inc *r7
+rts
+mov #-112, *r1
+inc *r7
+stop
+cmp L87, r6
+stop
+L163: rts
+; comment
+lea L82, r2
+prn r2
+L164: lea L121, L133
+L165: clr *r0
+jsr *r6
+cmp *r7, *r7
+add #47, *r3
+L166: sub #-70, r6
+L167: clr *r1
+not r2
+sub *r1, r4
+L168: jmp L126
+L169: cmp #49, #-41
+cmp r5, L47
+L170: .data -141, -649, -93
+L171: stop
+L172: .data -687, 570, 135, -6, -611, -101, -227, -379
+L173: lea L6, r0
+jmp L15
+add L85, L18
+not r0
+
+L174: add r7, *r6
+inc r5
+L175: clr r6
+L176: lea L101, *r2
+dec r3
+jmp *r6
+mov *r7, r4
+L177: inc r6
+L178: cmp #54, L53
+L179: prn #152
+clr L6
+inc r3
+L180: .string "kggrpnlgayszncbtzn"
+cmp #92, L179
+inc *r7
+add #-208, L169
+
+prn *r4
+sub #-118, r7
+jsr L93
+L181: jmp L23
+; comment
+dec r5
+L182: not *r4
+jsr L96
+L183: inc L129
+L184: rts
+red *r0
+lea L0, *r7
+jmp L175
+rts
+bne *r6
+mov #144, r1
+mov L45, r5
+L185: cmp #-94, *r1
+stop
+L186: prn #253
+red L87
+clr *r0
+not L36
+
+L187: .string "qwakwxsjjrvrif"
+bne *r5
+bne L88
+L188: .data -594, 957
+lea L41, *r0
+L189: .data -945, -520, -213, 382, 355
+inc L174
+not *r2
+L190: .string "lw"
+cmp #-34, r2
+jmp *r4
+prn r4
+L191: .string "abzzghbtbf"
+rts
+jsr *r0
+L192: clr r5
+prn *r1
+jsr L14
+prn #-200
+L193: red L193
+stop
+sub r4, r7
+L194: red *r1
+cmp r7, L78
+clr r2
+L195: .string "ijpmquebukorp"
+inc L3
+sub L13, r3
+L196: .string "msy"
+L197: bne L1
+lea L21, L100
+L198: .data 767, -838, -199, -87, 516
+; comment
+rts
+dec L197
+L199: jmp *r3
+rts
+L200: sub r6, r1
+cmp *r3, *r4
+L201: sub r0, r7
+lea L118, r7
+L202: .string "tnzucrvomunzbzwtocqti"
+L203: stop
+L204: mov #-107, L196
+L205: .string "vxzvahrwuhfcgmocixfk"
+L206: .data -906, 953, -249, -559, -236, -653, -818
+stop
+inc L95
+not *r1
+cmp #71, L82
+L207: mov L1, r0
+lea L65, r1
+
+jsr L8
+L208: stop
+; comment
+L209: .data -934, 771, -903, 606, -970
+L210: not *r0
+bne *r4
+jsr L14
+lea L39, L162
+L211: .string "kkjprupriy"
+dec L207
+lea L159, *r4
+
+add *r4, *r5
+L212: bne *r6
+cmp *r1, #-94
+add #208, r7
+L213: clr *r0
+stop
+jmp *r3
+L214: .data -841, 55, -712
+inc L131
+sub *r1, L111
+bne L194
+jsr L1
+bne *r5
+L215: dec L82
+
+L216: jsr L120
+stop
+stop
+inc r2
+L217: .string "kfcgnjoochpfirsbh"
+L218: jmp L178
+L219: bne *r6
+lea L10, *r0
+
+jmp L95
+bne L89
+L220: cmp *r2, *r2
+L221: prn r0
+L222: add r0, r3
+not *r7
+add r2, r2
+stop
+L223: .data 802, 113, -103, 660, 647, -543, -828, 140
+bne *r3
+L224: .string "zxfbypctcptzmsypjgt"
+L225: .data 871, -202, -873, 104
+dec r5
+jmp L67
+inc *r5
+L226: .data 974, -28, 838, -452
+dec L17
+L227: .data 227, 312
+L228: .string "xjzfugnxkmch"
+sub L203, L115
+stop
+L229: add #-228, *r1
+rts
+clr r7
+add *r5, *r4
+L230: stop
+L231: rts
+sub L139, L82
+L232: .string "urkmxt"
+L233: sub *r2, *r0
+red L66
+cmp L86, L145
+jsr *r4
+L234: sub L101, L143
+L235: jsr *r5
+L236: .data -546, -916
+not *r2
+rts
+bne L124
+L237: lea L204, L14
+L238: .string "lizktoejgtwrxoe"
+inc r3
+not L8
+L239: jmp L164
+inc L123
+L240: rts
+L241: rts
+rts
+bne *r1
+L242: .string "dcicvgoxvjadxelj"
+L243: .string "xyxiw"
+jsr *r0
+clr *r5
+cmp L8, r7
+L244: lea L28, r0
+sub r0, *r0
+sub #156, r6
+add *r0, *r0
+prn *r5
+L245: .string "zhsxrkkjcnnrzmgzqbvh"
+red r6
+L246: not *r3
+not *r6
+L247: clr *r3
+mov #-119, r2
+not L241
+red L166
+mov L219, r6
+L248: prn #63
+stop
+L249: stop
+L250: cmp L25, r3
+bne *r5
+L251: add *r5, r7
+L252: red r6
+jmp *r2
+add r3, L243
+mov #-137, L204
+rts
+not *r3
+jsr L201
+prn #-162
+L253: .string "ioppbmplbiuagxtha"
+not L230
+
+L254: .data 260, 334, -540, -444, -376, 357
+L255: .data 318, -921, -859, 679, 134
+add L216, L161
+red *r2
+L256: stop
+L257: red r6
+L258: .data -469, -654, -738, 544, -201
+L259: inc L247
+jsr *r4
+; comment
+stop
+stop
+L260: jsr L247
+jmp L74
+prn L156
+jmp *r5
+rts
+dec r1
+stop
+not L64
+add #128, r0
+clr L182
+not L251
+; comment
+add r3, L103
+L261: .data -315, -624, -444
+lea L207, r7
+clr *r3
+not r3
+cmp r1, r6
+L262: .string "ymfvwzxjpjwejfwfyijcvpoo"
+L263: .data 813, 183
+clr L34
+bne *r4
+lea L262, r0
+; comment
+L264: red r2
+red *r3
+clr *r6
+dec *r7
+red r7
+not *r6
+not L160
+stop
+jmp L1
+L265: .string "pfbyijbra"
+dec r0
+L266: .data 323, -789, 413, -710, -950, 63, -758, -173
+bne *r5
+rts
+dec L194
+L267: .data 496, 352, -813, 806, 835, 377
+L268: dec L108
+L269: sub *r2, L26
+L270: .data 448, -229, 839, 759, 369, 143, 917, 463
+sub r1, *r2
+L271: rts
+L272: prn #-137
+add r2, L202
+L273: .string "cgszxqwhtcyvaizbjnbjld"
+rts
+L274: .data 404, 93, 625
+dec *r7
+dec *r3
+bne L239
+prn r1
+clr *r5
+; comment
+L275: stop
+bne *r0
+inc *r1
+add *r2, L177
+L276: stop
+sub r2, r0
+jmp *r5
+bne *r0
+add L160, *r3
+jmp L276
+L277: cmp *r4, #-92
+bne L47
+L278: bne *r2
+clr L210
+L279: red *r4
+not L254
+clr r3
+not r2
+bne L200
+lea L159, *r6
+not r5
+dec L102
+L280: .string "dddvopxe"
+L281: dec *r3
+sub r3, r4
+bne L127
+sub *r1, r4
+lea L37, *r0
+L282: clr r0
+jsr *r3
+mov r3, *r0
+L283: .data -373, 442, -542, -371, -751, 351, 621
+L284: red *r5
+L285: lea L239, *r4
+red L82
+add *r5, *r3
+
+sub *r6, *r4
+lea L149, r1
+bne *r4
+lea L245, *r0
+L286: lea L194, r4
+rts
+clr L137
+L287: .string "cgbvut"
+; comment
+inc *r2
+clr *r7
+cmp *r6, L25
+L288: red r1
+cmp *r1, #36
+inc r1
+L289: stop
+L290: lea L127, *r7
+not L235
+L291: inc r5
+stop
+L292: .data -993, -521, 747, 575, 993
+clr r6
+add r0, *r3
+jmp L181
+inc r5
+L293: jmp *r6
+L294: .string "znwvbipszxhq"
+red *r3
+add #149, *r1
+prn *r3
+; comment
+jmp L73
+not L237
+jsr *r7
+not *r4
+L295: dec L18
+; comment
+L296: jsr L180
+L297: .string "aspbn"
+bne L114
+dec *r4
+jsr *r4
+L298: bne *r2
+L299: .data -119, 233, 205, -950, 17, -683, -332
+cmp *r5, L177
+stop
+sub L262, r2
+L300: lea L55, *r1
+bne L49
+rts
+L301: clr r4
+prn L13
+L302: jmp L242
+jsr *r3
+jsr *r2
+lea L85, L24
+red r5
+inc r5
+bne L176
+lea L278, L199
+mov L3, L70
+stop
+L303: .data -279, 563, -757, 633, -357, 183, -432
+cmp r0, r0
+jmp *r6
+L304: bne L132
+L305: not *r7
+stop
+L306: jsr *r4
+rts
+; comment
+mov *r3, *r2
+L307: clr *r6
+prn L26
+mov r5, *r5
+rts
+L308: prn *r5
+; comment
+L309: jsr L267
+L310: .data -483, 70, -335
+rts
+jmp *r5
+mov r0, L1
+L311: stop
+jmp *r6
+L312: jsr L8
+L313: .data -181, -533, -715, -259, -257, -585, 994
+mov #64, r4
+dec r6
+L314: lea L299, L183
+L315: .string "rapdry"
+not L20
+not *r6
+inc L154
+L316: .string "bqwbxpnmxbqatomccogxgi"
+L317: bne L165
+L318: .data 656, 789, 86, -500, -108
+clr *r7
+sub r3, *r3
+L319: .string "wpqtmbuaiqexajuqae"
+L320: prn #-210
+not r5
+; comment
+dec r1
+L321: .data 787, 265, 664, 676
+stop
+L322: jmp *r2
+add L124, L254
+add r5, *r1
+dec r4
+sub *r2, L145
+L323: lea L202, *r5
+lea L89, r7
+L324: jmp L312
+L325: mov *r0, L293
+cmp #15, L126
+
+L326: jmp *r0
+jsr *r5
+inc r0
+rts
+sub *r1, *r4
+mov #-187, r7
+prn #254
+L327: stop
+L328: dec *r1
+inc L74
+L329: inc L215
+L330: .data -447, 746, -452
+dec r0
+rts
+L331: add #71, r2
+prn *r3
+dec *r7
+L332: sub *r4, r3
+L333: dec *r2
+bne L209
+L334: red *r7
+L335: bne *r0
+bne L263
+jmp *r5
+L336: cmp #-133, L314
+jsr *r4
+stop
+red *r2
+not *r6
+not r5
+red L184
+cmp *r0, L135
+L337: inc L198
+L338: red *r6
+red *r1
+; comment
+bne *r6
+prn #217
+clr L176
+dec r7
+rts
+L339: rts
+
+sub L262, *r0
+cmp *r3, r7
+jmp L335
+jmp *r0
+L340: inc L71
+L341: .data -602, 817, -34, -43, 253, -178, -51, 589
+L342: add *r4, *r1
+red L312
+jsr *r1
+add L336, L19
+inc L42
+clr L178
+stop
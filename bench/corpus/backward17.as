@@ -0,0 +1,1026 @@
+; Generated by genCorpus --seed 18
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+inc *r1
+L0: .string "yjilexqsymnfbwynxw"
+sub #-152, r7
+inc *r6
+jsr L0
+jmp L0
+jmp L0
+L1: .string "gcqlibhodre"
+sub r0, r2
+L2: clr L1
+stop
+not r7
+mov #-148, *r4
+jsr *r0
+stop
+add *r2, *r3
+inc *r2
+lea L0, L2
+not L2
+prn L0
+rts
+not L0
+mov r6, *r2
+add r2, r2
+bne *r5
+clr r7
+dec r7
+
+add L2, r1
+L3: inc *r4
+prn #-191
+L4: prn L0
+lea L1, L2
+lea L2, L0
+L5: lea L3, *r2
+prn r4
+L6: .string "nzewzmusp"
+L7: not *r0
+L8: cmp L6, r6
+lea L4, *r0
+L9: .string "rqunsxwu"
+L10: jmp *r1
+jmp *r5
+inc r5
+inc r5
+L11: .string "sfnkkpppohsgokqfpmznocxp"
+L12: bne L0
+mov r6, r5
+jmp *r4
+dec L2
+stop
+sub L6, L4
+L13: lea L1, *r6
+inc *r3
+L14: clr r1
+dec L2
+L15: red r2
+L16: sub #75, *r5
+cmp #207, *r2
+add L12, *r6
+rts
+L17: jmp L3
+L18: .data -667
+inc r2
+L19: bne *r4
+stop
+red r7
+
+red *r5
+jmp L4
+cmp *r7, *r6
+L20: prn #179
+L21: lea L0, r1
+dec L3
+mov *r3, L2
+L22: jsr L11
+lea L7, r5
+rts
+L23: jsr L10
+L24: jmp *r6
+jmp *r1
+L25: red r7
+clr *r2
+L26: stop
+L27: cmp *r5, *r1
+clr r5
+L28: stop
+lea L23, L20
+L29: not r7
+; comment
+L30: .string "lflrfzjo"
+L31: rts
+rts
+sub *r1, *r6
+inc L28
+sub L13, r4
+L32: inc r4
+cmp L16, *r5
+jsr *r0
+clr L9
+L33: jmp *r0
+dec r2
+rts
+
+L34: clr L24
+L35: bne *r0
+bne L4
+L36: dec r1
+rts
+stop
+add r1, L21
+L37: inc *r2
+L38: rts
+L39: bne L37
+dec L14
+inc r7
+add #-30, r6
+jsr L4
+prn r5
+sub *r2, *r3
+add *r2, r1
+clr *r2
+inc L29
+L40: prn L1
+stop
+jsr *r0
+mov r4, L5
+jsr *r3
+L41: dec *r5
+red *r6
+red r1
+L42: prn L36
+cmp r4, L14
+L43: jsr L37
+inc *r0
+mov *r5, L10
+not r7
+cmp L12, *r1
+L44: sub L23, r0
+prn L38
+
+bne *r4
+prn L41
+dec L39
+prn L22
+stop
+L45: lea L37, r2
+rts
+lea L41, L21
+inc *r1
+L46: sub #198, L5
+L47: jmp *r3
+bne *r2
+L48: not *r0
+L49: clr *r3
+L50: jmp L44
+jsr *r7
+red L40
+L51: red *r7
+rts
+L52: inc r7
+cmp L39, #-255
+L53: .data -854, 812, -236
+stop
+bne L30
+not r3
+prn r7
+lea L51, L4
+sub r7, *r4
+cmp #-254, L36
+
+mov L11, r2
+L54: lea L18, r2
+L55: red r3
+stop
+
+L56: stop
+L57: .string "jlfexzcitmvkohwr"
+L58: inc *r6
+not L25
+red L53
+cmp *r3, *r6
+clr L6
+; comment
+bne L42
+inc r5
+L59: prn #-185
+lea L5, r4
+red *r1
+cmp L30, r5
+inc L30
+L60: .data -693, -7
+clr *r6
+L61: .data 104, 431, 916, -382
+lea L11, *r4
+L62: prn *r1
+L63: jsr *r0
+L64: jmp *r4
+L65: .string "wkjkcaget"
+not *r4
+add #-237, *r5
+jsr *r4
+L66: not r0
+L67: dec L41
+L68: .data -837, 563, -325
+inc r3
+sub #14, r5
+L69: clr *r2
+L70: bne *r4
+not L56
+sub *r6, r2
+L71: mov L49, r6
+rts
+L72: .data -425, -959, -369, -431, 786, -993
+L73: jsr L12
+sub #-150, r5
+L74: dec L70
+clr *r5
+L75: jsr L12
+stop
+bne *r4
+; comment
+L76: cmp L44, L0
+lea L28, *r1
+L77: .data -820, -163, 641
+inc *r5
+add #-118, r6
+L78: dec r4
+bne L73
+prn #-222
+L79: .string "jeackbdwudzbscnkvp"
+L80: add *r2, r1
+dec L34
+L81: .string "v"
+jmp *r5
+cmp *r4, L61
+bne *r1
+L82: lea L49, r0
+not L27
+
+stop
+add *r5, r3
+sub L77, r1
+rts
+rts
+
+L83: lea L21, r7
+jmp *r4
+prn #81
+L84: prn *r5
+jmp L10
+L85: red L83
+not L24
+L86: cmp *r3, *r4
+L87: .data 953, 467, 212, -159, -730, -192, 766, 17
+L88: inc r3
+L89: rts
+L90: prn L88
+; comment
+bne *r7
+sub L8, L71
+L91: .data 400, 870, 726, 979, -413
+L92: add #-87, r2
+L93: jmp *r5
+stop
+sub r2, *r4
+L94: add r1, r3
+L95: sub #151, r6
+jsr L78
+L96: mov *r1, L53
+L97: lea L5, *r0
+; comment
+L98: cmp #188, #-215
+clr L10
+L99: dec L68
+dec r5
+L100: .string "gfbtfjyoaxwzbhkeuzrimk"
+L101: cmp r4, r7
+inc L28
+L102: .string "llnqkpnglfghvk"
+lea L67, r2
+L103: .string "mrvquhetgroxarsguf"
+
+L104: bne L68
+jmp *r7
+L105: sub #-162, r0
+L106: .string "ozwwbewaqudhldarnirouici"
+; comment
+prn *r7
+L107: lea L84, *r3
+rts
+red r6
+bne L70
+prn L48
+jsr *r1
+lea L86, L64
+not L96
+prn #214
+L108: lea L65, L62
+L109: clr *r3
+cmp r5, r5
+red r4
+jsr *r5
+jmp *r6
+add *r5, L47
+L110: .string "hwjcpbip"
+stop
+rts
+L111: red *r3
+L112: red L107
+L113: bne L67
+sub *r6, *r4
+
+jmp *r4
+red r4
+rts
+jmp L2
+L114: .data 921, 408, -699, -647, -534, 387, 629, 99
+L115: cmp *r0, *r2
+stop
+not r7
+dec r4
+L116: .data 15, -979, 862, -633, 377, 242, 728, -59
+L117: prn L66
+add #-251, L95
+lea L15, *r6
+dec L3
+; comment
+jsr L29
+not *r7
+L118: stop
+L119: jmp *r0
+dec L33
+clr r5
+inc L104
+L120: .string "feeizqhfydjec"
+L121: .data 757, -762, 996, 108, 250
+jsr *r7
+L122: .string "dobmknfa"
+lea L50, *r4
+L123: .string "u"
+L124: add *r2, r5
+L125: red *r6
+L126: not *r0
+dec r2
+L127: .data -40, -292, -941, 798, -832, -222
+L128: red L70
+stop
+L129: .string "q"
+L130: red L1
+L131: .string "yipbuiupzdxae"
+rts
+L132: rts
+bne L25
+not *r4
+rts
+not *r0
+mov #106, r4
+jmp *r3
+L133: cmp *r0, #-226
+L134: jsr L93
+L135: inc *r0
+L136: .string "tmmdcvfwtoxjclcxmv"
+rts
+L137: clr *r3
+L138: inc *r2
+
+L139: .data -766, -535, 970, -58, 744, 963, -197
+clr *r0
+stop
+L140: prn #-213
+dec L139
+L141: jmp *r2
+; comment
+bne L45
+L142: cmp r1, r6
+inc r4
+lea L22, r0
+L143: .data 269, -700, 303, -491, -608
+inc *r2
+L144: prn #-88
+cmp L39, *r6
+bne L20
+jsr *r1
+add r3, r3
+L145: jsr L48
+L146: add r1, *r5
+L147: sub *r4, *r6
+L148: jsr *r0
+prn *r5
+prn #-41
+L149: inc L91
+L150: rts
+mov L2, r7
+L151: .data 811, 748
+jsr L22
+clr L6
+L152: mov *r6, *r7
+lea L110, L43
+L153: dec *r7
+L154: .data -346, -376, -116, -6, -525, 863
+L155: bne L5
+sub *r5, r5
+L156: add *r1, L85
+L157: add L105, *r2
+lea L30, *r1
+L158: .string "hcopnzsnxup"
+L159: bne *r3
+L160: .string "ovpeeoooottkutpg"
+clr *r0
+L161: lea L134, *r0
+L162: clr r2
+rts
+jsr *r5
+clr r3
+L163: prn r7
+L164: lea L57, *r0
+; comment
+red r7
+cmp r6, #253
+cmp #185, #-90
+clr *r0
+rts
+sub r4, L51
+rts
+bne L99
+L165: rts
+lea L0, r4
+not L151
+cmp r3, L152
+rts
+mov #-191, L24
+
+dec L86
+prn r2
+cmp L19, *r5
+sub #-137, L149
+add *r6, r0
+prn r7
+
+stop
+L166: .string "iloyixsl"
+jsr L50
+L167: .data -528, -972, 0, -580, 436
+lea L57, r3
+mov #-58, *r7
+L168: bne L80
+red *r0
+mov *r3, r1
+inc r2
+L169: dec r4
+dec *r1
+L170: jmp L48
+L171: jsr *r6
+L172: dec L93
+sub L48, *r1
+red *r6
+L173: clr L142
+L174: prn r7
+bne *r6
+lea L108, r5
+L175: dec L98
+inc L74
+
+stop
+jsr *r1
+L176: .string "efh"
+jmp *r2
+jsr L154
+stop
+L177: mov *r1, *r3
+mov L41, *r3
+not *r2
+L178: .string "lvdayxapkeicqqxdalill"
+jsr *r5
+jsr *r2
+L179: cmp r7, *r5
+cmp r3, #-200
+L180: .data 821, 282, -682, 43, 615, -692, 682, 993
+red L48
+cmp r3, #148
+not *r4
+L181: add L10, r5
+mov *r2, *r7
+jmp *r3
+mov #10, *r2
+jsr *r0
+lea L125, *r1
+clr r0
+L182: stop
+L183: .string "oegqndfsuqpohvu"
+L184: .data 114, 859
+L185: rts
+rts
+L186: red *r6
+jmp L42
+bne *r0
+prn r6
+prn *r0
+sub r3, *r4
+L187: .data 876, 736, 476, -138
+lea L173, L101
+red L11
+L188: prn #-31
+bne *r7
+sub #-34, r7
+L189: sub #72, L10
+L190: add L174, *r4
+L191: .data -868
+not L15
+
+add #-239, r1
+jmp *r3
+prn #-12
+jsr L78
+L192: .string "hqrjego"
+sub r3, r5
+
+sub #-15, L10
+L193: jsr *r1
+L194: jsr L45
+clr r1
+L195: dec L134
+L196: lea L14, L8
+L197: inc L154
+inc r1
+L198: dec *r6
+L199: .string "hqiat"
+not r5
+mov L139, L96
+jmp L103
+inc r0
+stop
+dec L104
+jmp L93
+L200: add *r3, r1
+inc L61
+mov #156, L195
+L201: lea L161, *r7
+L202: clr *r2
+stop
+L203: stop
+sub #-166, r1
+bne L106
+inc L18
+L204: .string "hxsl"
+jsr L105
+L205: .data -59
+bne *r3
+rts
+not L181
+L206: stop
+L207: inc r6
+jmp L163
+stop
+L208: sub L94, *r4
+not r7
+lea L131, r4
+
+L209: prn #132
+add *r5, L93
+jmp *r2
+sub r7, L87
+L210: stop
+add #-38, *r4
+inc r3
+mov #75, *r4
+L211: jsr *r4
+L212: red r2
+L213: .data -265, -434, -304, 825, 289, 824, 735
+L214: dec r6
+L215: .data 690
+inc *r5
+clr *r3
+L216: not L90
+bne L106
+L217: rts
+L218: .string "bbmgqmxero"
+stop
+stop
+L219: .data 620, 215, -411, -551
+mov *r3, r4
+stop
+lea L122, r4
+jmp L36
+L220: .data -980, -889, -960, 736
+L221: prn *r4
+cmp r2, r1
+jsr *r0
+jmp L143
+L222: bne *r6
+L223: jmp L117
+add r1, r3
+mov *r5, L41
+dec L123
+L224: .string "fkxidrtuj"
+L225: lea L20, *r5
+L226: clr r7
+cmp r7, *r5
+inc *r2
+add r1, L190
+lea L147, r5
+jsr L102
+add L59, r2
+lea L60, L28
+sub L108, r5
+L227: rts
+mov r2, r6
+add #-96, *r1
+prn L20
+not *r1
+not L70
+L228: rts
+jmp L28
+L229: .string "rhhiljlzwhfphns"
+L230: .data -147, -820, 223, -91
+lea L112, r2
+cmp #125, #-8
+rts
+L231: .string "dbbvvrismndno"
+rts
+jsr *r0
+jsr L157
+red *r5
+jmp L138
+inc r5
+dec L209
+not L230
+sub L117, r5
+red r3
+L232: jmp *r3
+; comment
+prn L50
+
+L233: .data 672, 178, -745, 384, 938, 384
+clr r5
+not *r3
+L234: stop
+clr r2
+L235: lea L78, r7
+add r7, r1
+jsr *r6
+prn L153
+mov *r1, r4
+L236: .data 260, 144, -373, -537, 23, -125
+prn #241
+L237: rts
+cmp #174, *r3
+L238: inc r4
+not r4
+cmp r5, #249
+not r4
+L239: clr *r0
+L240: red *r1
+not *r7
+clr r1
+add *r1, *r4
+clr *r4
+red *r7
+L241: .data -816, -487, -804, -19, 483
+jsr L211
+dec *r5
+red r3
+mov r1, L16
+L242: sub r6, L123
+L243: not L54
+not r1
+L244: .string "bbibolglpbedaosqll"
+stop
+jmp *r4
+clr r4
+add L131, L46
+dec r1
+lea L122, r4
+; comment
+L245: not L74
+L246: lea L53, r6
+jsr L136
+add *r0, *r4
+L247: .string "wqaxkqgk"
+lea L84, r0
+clr r1
+L248: not *r1
+prn #-237
+jmp *r3
+
+stop
+mov L59, L101
+mov r2, r3
+L249: bne *r2
+L250: not L146
+; comment
+jmp *r7
+cmp #123, L165
+L251: .data 102
+cmp #-97, L163
+L252: inc L118
+dec r2
+L253: stop
+L254: jsr *r3
+; comment
+L255: .string "tzuhhknalqlky"
+L256: rts
+L257: lea L6, *r4
+L258: red r0
+red L67
+L259: mov #34, L4
+cmp L239, L169
+rts
+inc *r3
+L260: .string "okgzeia"
+bne *r2
+
+L261: lea L78, r1
+bne L164
+lea L29, r4
+L262: cmp L145, *r7
+L263: dec L103
+cmp r7, *r6
+jmp *r5
+L264: jmp *r5
+red *r4
+L265: not *r4
+jmp *r3
+dec r2
+L266: add #207, r0
+lea L102, *r5
+prn L6
+jmp *r2
+cmp r7, #-151
+stop
+L267: jsr *r4
+L268: not *r7
+L269: add L146, L212
+L270: mov r6, L72
+inc *r3
+inc L209
+prn L109
+sub #-185, *r4
+stop
+mov r7, r2
+L271: bne L45
+L272: add *r0, *r1
+L273: stop
+L274: lea L162, *r5
+lea L145, L86
+add *r6, *r6
+L275: .data -330, -836
+inc L151
+sub *r5, r2
+
+add *r0, *r5
+clr L167
+L276: .data -101, -730, -987, -299, 320, 25, -476, -692
+jmp *r4
+inc r2
+inc r6
+
+L277: red r1
+dec L272
+not L273
+cmp r2, #-102
+add L257, *r0
+L278: dec L165
+L279: mov #-193, L122
+L280: red L143
+add r4, *r3
+clr *r0
+L281: inc r4
+L282: .data 370, -907, 940
+
+dec *r3
+clr L1
+dec r4
+jmp L257
+L283: prn *r6
+L284: mov #100, *r5
+not *r1
+L285: rts
+L286: .data -858, -158, 656, -158, 100
+L287: .data -369, -270, 76, -498, 629, 422
+mov *r1, L272
+L288: .string "hviybsbwyzpljyw"
+cmp r3, #105
+cmp r3, *r2
+jmp L72
+L289: not L0
+add r0, r7
+dec L23
+inc r0
+L290: .data 265, 407, -203, 342, -784, -309, 758, 1
+prn *r6
+L291: .data -459, 603, 608, 155, 549, 238
+L292: prn *r4
+stop
+red L33
+mov L283, r7
+L293: prn r7
+L294: .data 128, 71, -78
+clr *r1
+mov #44, L256
+mov r3, r7
+rts
+clr r6
+sub r2, L139
+prn #-157
+mov *r3, L201
+bne *r2
+L295: stop
+inc L202
+add r6, L257
+mov #-182, *r7
+L296: cmp r6, *r1
+red L8
+prn L111
+rts
+not r5
+L297: not *r2
+L298: .string "wsutj"
+; comment
+dec r7
+L299: sub #7, L96
+L300: rts
+rts
+jsr L140
+clr L184
+sub *r3, r4
+sub L258, *r4
+L301: mov *r2, L43
+inc r2
+red L122
+prn #38
+L302: add #187, *r2
+L303: rts
+
+L304: cmp r1, r1
+
+L305: cmp r2, L299
+jsr *r5
+prn L145
+cmp #-162, r2
+clr r5
+add #31, L110
+prn r4
+L306: add L240, L165
+L307: add r1, *r4
+sub L307, L127
+bne *r5
+not *r3
+; comment
+clr L241
+clr L64
+L308: .string "artxadssvztfmtczedqdpnoi"
+; comment
+L309: sub r2, r4
+bne *r0
+L310: bne *r2
+lea L221, L182
+L311: rts
+L312: .data -275, -798, 630
+clr L69
+jsr L21
+L313: clr L65
+L314: .string "fu"
+; comment
+; comment
+L315: mov *r1, r4
+jsr L85
+jsr *r3
+L316: dec L191
+
+cmp #-186, r0
+L317: dec *r1
+add #-69, L278
+L318: rts
+jmp *r1
+red *r4
+L319: inc r6
+L320: prn *r5
+L321: .data -582, -244, 235
+L322: clr L207
+bne L80
+clr *r7
+L323: mov r4, r4
+dec r2
+L324: inc *r5
+not L29
+L325: lea L130, *r6
+sub r2, r5
+L326: lea L49, *r5
+lea L146, *r2
+L327: cmp L233, #-139
+
+red *r0
+prn r0
+mov r0, r2
+not *r0
+not *r6
+L328: add L70, r1
+prn r1
+L329: inc r4
+add *r1, *r4
+L330: add r0, r3
+L331: bne L271
+L332: red L1
+L333: .data 135, -872, 288, -475
+L334: .data 99
+jmp L109
+add *r5, r6
+L335: red r5
+add *r6, L327
+; comment
+L336: bne L301
+rts
+L337: stop
+L338: inc L3
+L339: not *r6
+L340: red L105
+jmp *r5
+lea L253, L30
+L341: mov r5, L313
+L342: sub r0, L314
+cmp r3, r6
+dec *r1
+not *r2
+prn L301
+sub r0, r1
+jsr L31
+add L139, r0
+sub *r7, *r4
+L343: cmp #156, #-219
+L344: bne L157
+jsr *r2
+L345: bne L135
+sub r3, L142
+L346: lea L288, r6
+L347: rts
+jsr L28
+L348: .string "xnvnzgzncwfmyjhfywordk"
+sub #224, L207
+clr *r6
+L349: cmp #-119, #41
+red r7
+prn r4
+L350: mov r0, r0
+L351: mov L270, r6
+
+add L49, r3
+red *r0
+stop
+red L227
+mov L288, L276
+L352: lea L320, L212
+clr r2
+L353: clr r4
+L354: not L221
+inc L83
+cmp L118, #-96
+L355: lea L108, L46
+L356: lea L48, *r1
+inc L22
+clr L319
+L357: dec L299
+L358: .string "rndiffyhlrfb"
+jsr L114
+L359: stop
+bne L38
+L360: cmp L121, #-159
+prn L50
+stop
+L361: sub r2, r7
+L362: prn L328
+red L203
+clr L78
+L363: .string "ckefmsmoexznqlodyzuo"
+L364: add #-66, *r5
+dec *r4
+mov *r3, L130
+L365: .data 161, -812, -44, -450, -973, -614, -468
+L366: jsr *r0
+dec L121
+red r3
+L367: red L178
+mov L357, r0
+sub r1, r2
+L368: red r3
+dec r5
+L369: mov r0, L207
+add L0, r6
+lea L299, L310
+L370: prn *r6
+L371: jmp *r0
+L372: .data -221, 2, 802
+not r0
+L373: lea L2, r7
+add *r3, r2
+L374: jmp *r6
+jsr L360
+L375: rts
+bne *r7
+stop
@@ -0,0 +1,1026 @@
+; Generated by genCorpus --seed 19
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+dec r1
+jsr *r5
+cmp #4, #-227
+not *r1
+L0: red *r2
+L1: stop
+L2: .data 542, 981, 691
+sub L2, r5
+; comment
+stop
+stop
+L3: prn L3
+add #5, L0
+dec L0
+stop
+jsr L3
+L4: prn *r3
+mov r7, L0
+L5: add #-64, L1
+L6: add r1, L0
+L7: .string "kblrp"
+add L7, r4
+L8: not *r3
+add L0, *r4
+red r1
+not L3
+L9: dec L2
+L10: dec *r3
+L11: prn *r5
+; comment
+rts
+cmp *r1, *r7
+dec r2
+L12: jsr L1
+jmp L4
+; comment
+red *r0
+red r6
+red r0
+dec L7
+L13: stop
+jmp L8
+not r5
+jsr L1
+cmp *r4, r5
+L14: jsr *r6
+L15: .data 195, 957, -735, -782, 814, -282, 650, 926
+L16: dec r5
+dec *r6
+L17: stop
+stop
+L18: jsr *r4
+L19: prn *r4
+L20: not *r1
+L21: inc *r4
+clr r4
+prn #-172
+clr r7
+L22: inc L9
+inc *r1
+L23: bne L2
+L24: red r4
+L25: dec r2
+L26: dec L21
+sub L9, r0
+L27: .data -149, 114, 277, -505, -766, 529, -751
+L28: stop
+stop
+bne L16
+L29: .data -438, -549, 388, 189, -587
+L30: mov *r4, L4
+
+red *r5
+stop
+L31: dec r2
+stop
+L32: .data 431, 390, -804, 864, -264, -678, 986
+jmp *r7
+clr r0
+L33: red r3
+inc *r5
+add #26, L25
+L34: cmp r6, r5
+sub #-132, *r0
+add L20, *r1
+L35: bne *r3
+L36: .string "qaaoidrlhihcy"
+rts
+rts
+stop
+jmp L26
+L37: .data 874, -192, -484, 440, -769, -5
+jmp *r4
+L38: clr r3
+mov *r0, *r7
+L39: .data -490, 971, 879, 964, 134, 35
+L40: .data -733, -978, -366, -79, -173, 48, -623
+L41: lea L31, r4
+L42: prn #-251
+L43: sub *r6, L37
+L44: add L26, r4
+L45: bne L4
+add *r5, L14
+L46: .string "oyovbxvix"
+L47: jmp *r7
+mov #143, *r3
+jmp *r0
+add r0, r6
+
+red r5
+lea L21, *r7
+jmp L3
+L48: sub #-133, L40
+
+not r1
+dec r1
+L49: mov *r2, r1
+
+add r7, *r7
+L50: jmp L38
+dec *r3
+add r3, *r4
+red *r0
+rts
+clr L14
+jsr *r3
+L51: .string "j"
+L52: .data 372, 898
+red L6
+not L37
+L53: red L20
+clr r7
+L54: clr *r4
+L55: .string "zlkcssiapnng"
+prn #21
+clr r1
+L56: red *r2
+L57: jsr L48
+jmp L11
+L58: dec L27
+cmp L12, *r7
+clr L44
+dec L29
+L59: dec L41
+; comment
+cmp r4, L38
+L60: .data -235, 260, -128, 847, -514
+add #-206, r0
+jmp *r1
+clr r7
+rts
+L61: jmp L51
+L62: prn #-204
+add r2, r6
+rts
+L63: jmp *r1
+; comment
+mov #143, L30
+mov *r2, r5
+red *r5
+inc *r7
+L64: .string "ajvpumnlygraloixfskd"
+rts
+L65: .data 377, -809, -250, 772, 188
+L66: not L5
+cmp *r4, #-192
+jmp *r5
+L67: inc L42
+; comment
+inc r7
+L68: inc L52
+; comment
+L69: jsr L29
+
+L70: jmp *r1
+L71: .string "oqmwhnznjaaiaqano"
+jsr L31
+L72: jmp L49
+L73: stop
+L74: jsr *r4
+L75: add L27, L2
+add r4, L65
+
+L76: .data 525, -64, 23, 463, 818, 304
+L77: cmp r3, L9
+not r6
+prn r4
+lea L25, L21
+clr r7
+prn *r3
+L78: mov *r3, *r1
+prn *r1
+dec r4
+rts
+stop
+lea L61, L66
+L79: jsr L20
+L80: add *r7, r2
+jsr *r5
+L81: stop
+L82: jmp *r3
+clr L61
+L83: add L40, r5
+L84: lea L49, L61
+bne L81
+L85: sub L20, r0
+prn #-236
+L86: jmp *r6
+stop
+inc r3
+inc r2
+rts
+L87: dec *r2
+cmp #-37, *r2
+stop
+rts
+inc L5
+jsr L25
+cmp L31, r0
+jsr L87
+jmp L66
+L88: stop
+L89: sub #57, *r3
+L90: add r2, L34
+mov L17, L47
+mov r5, L86
+add L88, r3
+dec r5
+sub L18, L83
+red *r2
+cmp L39, L39
+red r7
+lea L78, *r4
+prn #-162
+mov *r2, *r6
+rts
+L91: .string "qhwsybwdwtweuzghtjd"
+dec L89
+rts
+L92: .data -429, 75, 117, -670, -968, 350, -405
+sub #115, r6
+L93: .data -233, -874, -973, -871
+L94: jsr L16
+jmp *r7
+; comment
+jmp L92
+L95: .data 90, 846, 163, 388, -526
+stop
+inc L0
+red *r3
+sub #-239, *r0
+red L69
+lea L83, L59
+not r2
+jsr L93
+L96: lea L76, r7
+L97: cmp *r1, *r6
+stop
+
+; comment
+stop
+stop
+cmp #221, r7
+prn *r5
+dec r0
+stop
+jmp *r5
+jmp L60
+rts
+not L44
+L98: lea L94, *r7
+L99: jmp L58
+clr L26
+not r4
+cmp #-55, *r2
+L100: .string "lrxdspb"
+L101: stop
+L102: dec r1
+rts
+add r5, L26
+
+cmp r7, #-198
+stop
+prn *r5
+mov #-209, L21
+not *r1
+L103: .string "hqdmtpkdxeaflvnqapn"
+L104: .data 152, -866, -969, 432
+cmp L74, #-3
+inc *r5
+L105: bne *r3
+L106: red r7
+L107: clr r6
+sub r0, L103
+L108: jsr L84
+red *r2
+inc *r4
+mov #-99, L42
+inc *r6
+red r7
+L109: dec *r1
+cmp r0, #216
+L110: rts
+stop
+dec L19
+clr *r7
+L111: .data -915, -799, 9, -815
+L112: add r6, r3
+L113: add #65, *r4
+lea L108, *r5
+jmp L98
+L114: jmp *r5
+stop
+not L32
+L115: cmp r1, *r3
+L116: .data -858, -482, -504
+L117: dec *r5
+stop
+L118: jsr L65
+L119: lea L99, r6
+add L63, r4
+L120: clr r5
+L121: inc *r2
+prn *r2
+L122: jsr *r6
+jsr *r3
+add #-134, r0
+L123: .data -242, -642, 757
+inc *r3
+rts
+L124: inc r3
+L125: rts
+; comment
+L126: cmp L74, *r4
+rts
+not r4
+jsr L114
+bne *r3
+; comment
+mov L121, r3
+L127: stop
+L128: dec L50
+cmp r2, *r6
+L129: jsr *r0
+L130: inc L53
+L131: inc L105
+rts
+
+add #142, r3
+L132: inc L83
+prn *r3
+mov *r4, r6
+L133: dec r1
+cmp L24, r2
+stop
+mov r0, r6
+not *r3
+sub r1, *r6
+sub *r0, L58
+clr L110
+L134: add *r3, r0
+L135: bne *r0
+L136: rts
+cmp L35, L114
+L137: sub L27, r4
+bne L66
+L138: .data 422, 26, -841, -225, -189, 414, -217
+add *r3, r7
+L139: sub r4, r5
+add #-132, r4
+L140: stop
+not r3
+lea L121, *r7
+L141: dec L58
+prn L101
+L142: rts
+lea L7, *r3
+cmp #120, *r7
+inc L55
+L143: mov *r3, L108
+; comment
+sub r6, *r2
+stop
+L144: sub r5, r6
+sub #-236, *r1
+sub *r4, L86
+not L99
+L145: sub *r3, L115
+L146: dec L101
+prn #-126
+L147: cmp *r6, r0
+not r6
+L148: jsr *r2
+jmp L137
+L149: rts
+bne L15
+cmp #133, *r2
+jmp *r1
+L150: add r0, L38
+cmp r0, L83
+red r3
+stop
+
+dec *r4
+L151: .data 302, -296, 285, -798
+sub #-96, *r3
+
+L152: mov *r1, *r4
+inc *r7
+clr L130
+rts
+red r0
+; comment
+stop
+
+rts
+L153: sub r3, r4
+bne L113
+sub r5, r7
+jsr L142
+; comment
+rts
+jmp *r7
+L154: mov *r6, L17
+prn L150
+add *r7, L52
+L155: .data 152, -99, -319, 288, 622
+
+L156: add #99, L83
+L157: stop
+add r5, r3
+rts
+add L75, L152
+; comment
+dec L82
+L158: sub r2, r3
+
+prn r0
+lea L134, L50
+L159: rts
+jmp *r1
+L160: not L74
+sub L77, *r1
+clr *r2
+dec r0
+not r3
+mov r6, r4
+L161: prn #-107
+L162: mov *r7, r2
+jmp *r2
+
+L163: .string "mwaxxfctrpkp"
+sub L68, L138
+L164: not *r7
+inc *r3
+cmp *r5, L21
+jmp L38
+; comment
+mov L82, r5
+L165: jmp L112
+jsr *r7
+L166: clr r2
+inc *r2
+stop
+sub #-249, r1
+L167: not *r3
+; comment
+jmp L12
+not r5
+inc L109
+jmp L59
+L168: rts
+add *r7, L151
+L169: mov L108, *r2
+L170: dec *r5
+jsr L73
+clr r0
+red *r3
+
+add #246, r0
+dec r3
+jmp *r1
+L171: .string "uplyjhh"
+stop
+prn #-103
+L172: .data 272
+rts
+sub #130, r2
+mov L142, L103
+jsr L83
+prn #-169
+L173: stop
+L174: inc L67
+clr *r1
+inc L34
+L175: cmp L139, L1
+bne *r1
+inc *r1
+
+not *r1
+mov r2, L53
+L176: jmp L115
+L177: jmp *r6
+lea L33, r4
+add L149, r3
+cmp L87, #178
+L178: dec r2
+L179: cmp L53, #77
+lea L130, L118
+jsr *r6
+red *r5
+rts
+red L93
+clr r3
+bne L24
+sub L54, r4
+L180: lea L100, r6
+L181: dec r5
+L182: lea L169, r3
+red *r2
+mov L66, L8
+mov *r1, *r4
+clr r7
+L183: mov *r5, *r2
+L184: bne L40
+lea L68, L11
+inc *r7
+L185: dec r1
+L186: .string "wvrzojvte"
+sub L97, *r3
+mov *r0, r0
+mov r0, r6
+prn r5
+L187: jsr *r2
+L188: bne *r7
+L189: rts
+L190: mov #219, r0
+
+rts
+L191: dec *r3
+sub r4, L83
+
+L192: lea L40, *r6
+prn r3
+L193: jsr L89
+L194: rts
+sub L48, *r4
+mov #-206, L47
+cmp #-80, r7
+L195: .string "ernaezkbiszizvgxsoxmoo"
+
+L196: bne *r1
+clr L103
+jsr L175
+prn *r2
+stop
+L197: mov L122, *r3
+jmp L29
+L198: mov *r7, L48
+L199: sub #-12, L158
+L200: lea L164, L141
+mov L90, L29
+clr *r1
+sub #241, *r7
+lea L127, L158
+; comment
+rts
+L201: .string "qtrqxopluwbsodpvdvgote"
+L202: clr *r4
+L203: .data -739
+stop
+L204: .string "kxbzlbstxrkms"
+L205: prn L201
+cmp *r1, *r5
+rts
+jmp L117
+
+L206: .data 262, 398, 871, 487, -127, 909
+lea L69, L33
+L207: .data -185
+jsr L101
+L208: lea L35, L146
+inc *r2
+; comment
+L209: .data -976, -736, -733, -118, 953, 62, -964
+prn L31
+jmp L54
+prn L17
+L210: .string "nkxmvwrd"
+L211: .data 824, 308, 230
+L212: rts
+dec r7
+red r2
+jsr *r5
+dec L8
+sub r0, *r5
+L213: inc r3
+L214: rts
+clr r0
+dec r3
+clr L64
+lea L8, *r5
+not L148
+L215: prn *r3
+mov r6, *r5
+clr L138
+sub r2, r1
+lea L209, L109
+sub L155, r3
+L216: inc *r4
+L217: .string "rpmhqojunhovxfy"
+jmp L139
+L218: add #88, L28
+L219: jmp *r2
+prn L178
+L220: prn r5
+L221: bne L150
+L222: prn r7
+not r4
+add r6, *r3
+cmp *r5, L81
+add #72, L29
+L223: jsr *r4
+
+prn #-31
+inc r3
+not *r4
+L224: cmp r2, r7
+L225: prn r1
+L226: add L46, r4
+L227: cmp *r1, #110
+jsr L129
+L228: dec r2
+L229: inc r2
+dec r3
+L230: .data -643, -760, -937
+L231: jsr *r1
+stop
+cmp r1, L202
+lea L102, r5
+L232: .data 472, 430, -56, -869
+jmp L84
+L233: clr L13
+L234: cmp L103, r1
+L235: jmp L199
+L236: stop
+L237: cmp *r4, r6
+L238: cmp #-201, L191
+L239: .data -987, -787, 682
+prn *r0
+L240: inc L38
+dec L76
+; comment
+; comment
+L241: stop
+not r4
+prn r7
+clr L48
+L242: jsr L8
+stop
+cmp #246, L134
+; comment
+add #-199, *r5
+L243: cmp #178, *r3
+cmp #-246, r6
+
+dec r4
+L244: sub r5, r5
+L245: dec r7
+cmp #-256, *r6
+sub L52, r1
+L246: dec *r1
+clr r5
+L247: stop
+not r3
+cmp L69, *r7
+L248: red r3
+bne L26
+; comment
+L249: stop
+L250: rts
+L251: .string "qynsiycwrwfvzjzrsr"
+L252: not r7
+red r2
+L253: stop
+bne L94
+stop
+L254: clr *r7
+prn *r3
+rts
+lea L227, L147
+L255: not *r3
+inc L144
+clr L237
+stop
+bne *r0
+sub *r7, *r5
+lea L113, L70
+bne L178
+red L163
+cmp L106, r3
+not L147
+prn #156
+L256: cmp r3, r2
+L257: .string "vln"
+L258: jsr L209
+jmp *r1
+L259: jmp L204
+; comment
+L260: jsr *r5
+L261: .data 224, -289, 763, 676, 710
+L262: inc L188
+cmp r0, #-224
+prn #-13
+L263: not r1
+L264: cmp r5, *r0
+bne *r1
+sub L83, L25
+cmp L164, *r5
+bne *r4
+jmp L87
+rts
+rts
+L265: .data -68, -546, -835, -914
+L266: bne L191
+L267: lea L228, r4
+L268: stop
+red *r7
+stop
+L269: mov L27, L269
+inc *r0
+L270: .string "ndrzzzzjbjfnkmer"
+red r2
+L271: .data -998, -404, -270, 718, -449, 915, -39
+L272: cmp *r3, *r0
+L273: .string "dgr"
+L274: red *r6
+L275: .data 144, 269, -552, -12, -373, -205
+L276: .data -579, -822, -671, 853, 132
+add r6, r6
+dec r0
+inc L139
+L277: stop
+dec L210
+not L94
+L278: .string "um"
+L279: .data -255, 87, -392, 913, -317, 602
+jsr *r3
+L280: mov L180, r0
+L281: jsr L40
+L282: red r4
+inc r4
+add L282, r1
+L283: jmp L258
+L284: stop
+sub *r7, r6
+prn #-102
+L285: cmp r4, L98
+dec L13
+inc L279
+red L44
+sub #202, L50
+not L89
+add #235, *r7
+L286: lea L208, L165
+L287: mov #138, *r5
+mov #-112, r7
+lea L167, r7
+L288: .string "yjgsyjyajmm"
+L289: .string "vcdeusjnpgiz"
+L290: inc *r3
+clr r1
+sub *r5, L264
+; comment
+L291: .string "xk"
+cmp r5, #135
+L292: .string "tkdwrwxbzocpcsnbnojdje"
+dec L138
+prn r1
+L293: inc r1
+stop
+dec *r4
+lea L239, r4
+add #90, *r0
+bne *r4
+lea L280, r2
+L294: red *r3
+rts
+L295: .string "zyxvsuknpiib"
+dec r7
+bne *r3
+L296: jsr L55
+L297: lea L283, *r2
+jmp L66
+L298: .string "yahejjxk"
+jmp L84
+inc r2
+jsr *r1
+; comment
+L299: .data -678, -123, 438, 503, -892, 594, 729, -633
+L300: inc L14
+jmp *r4
+clr L269
+rts
+jsr L62
+add *r4, L55
+L301: .string "cg"
+mov #5, *r4
+mov #-119, r2
+jmp L28
+inc *r0
+L302: bne *r2
+L303: sub *r7, *r3
+L304: .data 975, -323, 177, -576, -43, 310, -538
+; comment
+mov r5, *r1
+not L235
+L305: red r6
+rts
+bne L168
+L306: clr r5
+; comment
+not r2
+dec r6
+; comment
+L307: jmp L199
+cmp *r1, *r1
+jmp *r1
+L308: lea L284, r6
+L309: inc L31
+lea L54, r2
+dec r2
+not L59
+add *r5, L267
+lea L41, r1
+L310: jsr *r1
+L311: prn #-67
+L312: clr L177
+
+rts
+add *r6, L48
+mov #-156, r1
+L313: cmp #203, r1
+L314: stop
+red *r0
+stop
+
+L315: not L133
+sub r5, L255
+clr L81
+L316: mov #4, L147
+red L303
+clr *r3
+L317: jsr *r2
+prn #227
+L318: mov #-88, r6
+jsr L181
+dec L243
+L319: .string "nxcycmmgvbgxiqws"
+L320: cmp #164, #-89
+prn L93
+L321: red *r0
+rts
+not L197
+dec r6
+cmp r1, *r1
+rts
+L322: sub *r5, r5
+L323: rts
+; comment
+L324: .data 960, -795, 706, 969
+bne *r3
+L325: .string "ul"
+L326: sub r2, L176
+red L193
+bne L116
+red L236
+inc L146
+L327: not *r4
+L328: lea L87, r6
+lea L159, L267
+sub #-165, L67
+mov L33, *r4
+bne *r0
+
+sub #244, L97
+red *r3
+red r5
+L329: jmp L285
+L330: jmp L228
+lea L48, *r3
+mov #247, L0
+jsr *r7
+L331: .string "sddtinz"
+rts
+lea L70, L190
+L332: rts
+prn L184
+not r5
+prn *r7
+prn #-168
+stop
+; comment
+jsr *r6
+L333: .data -478, -426, 22, -175, 950, -332, 842
+red r5
+mov *r2, *r6
+prn r2
+rts
+bne L314
+L334: mov r3, *r1
+L335: dec r7
+add *r7, *r4
+red L147
+L336: .data 853, 177
+inc *r2
+add r7, *r3
+bne L316
+L337: cmp #-96, r2
+L338: .string "bbgpxjamuco"
+bne L113
+L339: mov r1, *r2
+sub *r3, r0
+stop
+L340: lea L59, L126
+prn #46
+prn r1
+; comment
+L341: inc r3
+L342: red L235
+not r7
+prn r4
+dec L69
+jmp *r7
+L343: .string "ltiaqqbabkyvcbfxbtdoshz"
+sub #183, r6
+inc *r0
+L344: not L195
+jsr L17
+jmp L23
+L345: .data -273
+rts
+jsr *r2
+not L329
+; comment
+L346: mov #11, L322
+L347: sub *r3, r1
+L348: stop
+jsr *r5
+sub r6, r2
+L349: sub #185, *r2
+L350: .data 464, -969, 533, -300, -900, 735
+jsr *r1
+add L227, L235
+L351: jsr *r4
+jmp L5
+; comment
+not *r3
+jsr L46
+prn r2
+L352: inc r2
+L353: sub L188, r4
+L354: bne *r7
+L355: dec *r1
+clr r6
+cmp L185, r7
+rts
+prn *r1
+jsr L92
+L356: bne L172
+L357: add #218, r1
+jsr *r6
+L358: .data 310, -189
+cmp *r2, #10
+jmp L167
+cmp *r3, L228
+L359: jsr *r7
+mov #250, r7
+L360: bne *r7
+L361: add r1, L330
+rts
+L362: stop
+L363: lea L330, *r4
+not *r7
+L364: prn *r3
+not *r7
+L365: inc *r5
+prn r6
+L366: cmp *r5, *r6
+sub #236, r3
+L367: rts
+stop
+L368: jsr *r3
+L369: stop
+jmp L108
+stop
+L370: mov #-144, *r3
+cmp L170, r2
+red r5
+L371: .data -495, -883, -636, -472
+stop
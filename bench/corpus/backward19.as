@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 20
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: .string "ww"
+clr L0
+bne *r2
+L1: red r7
+prn r7
+prn r0
+lea L0, *r4
+L2: not L0
+clr *r0
+L3: rts
+L4: .data -219, -700, 112, 534, -250, 624, 522, 267
+L5: cmp r3, #-100
+jmp L0
+jmp L5
+; comment
+
+not L2
+L6: add *r0, L0
+lea L1, L4
+bne *r0
+L7: red L4
+bne L2
+stop
+prn *r3
+rts
+L8: not r1
+L9: mov #-29, L2
+jsr L7
+bne *r1
+L10: not L2
+add #-166, L3
+bne L4
+jsr L2
+sub L7, *r0
+dec *r4
+lea L3, r6
+L11: dec r5
+lea L8, r7
+
+prn L1
+inc r4
+L12: inc r6
+L13: stop
+L14: inc L5
+L15: mov L7, *r7
+not r3
+L16: .data -701, 844, -415, -265
+sub #-43, r1
+not *r0
+bne *r0
+L17: bne L7
+rts
+sub L9, r1
+jmp *r1
+prn r3
+inc r2
+L18: dec L11
+inc L13
+clr r6
+rts
+mov #-208, *r1
+lea L11, *r3
+rts
+not L1
+red L14
+jsr *r0
+L19: jsr *r1
+add *r3, r3
+jmp *r2
+dec L3
+L20: .data 62, -880, -159, 506, 495, 627
+inc L9
+jmp *r5
+dec r4
+L21: inc L11
+L22: add #231, r3
+stop
+stop
+L23: .data 507, -987, 808, 18, -789, -401, -275, -59
+cmp *r5, *r0
+L24: rts
+inc L3
+sub r1, r6
+lea L21, L3
+mov #48, L8
+; comment
+jsr L3
+L25: cmp #191, r0
+not r5
+L26: mov *r1, r4
+cmp *r4, *r2
+stop
+not r4
+dec r2
+; comment
+L27: jmp L10
+L28: clr *r2
+; comment
+L29: cmp L12, *r1
+L30: stop
+dec *r3
+L31: add L17, *r0
+red r4
+L32: stop
+bne *r5
+L33: .string "pkadrbrzrk"
+sub L28, r0
+add #176, L24
+mov #60, r4
+jsr *r7
+lea L25, *r7
+clr *r2
+inc *r5
+bne L32
+L34: clr *r7
+rts
+L35: sub L32, r7
+L36: jsr *r1
+L37: .string "ouatcjbkcojresiabuvq"
+L38: red r2
+sub *r1, L13
+L39: .string "ddcssusahjop"
+mov #-217, L32
+
+L40: mov #124, r3
+lea L36, L38
+sub #-11, r3
+L41: rts
+inc L18
+dec *r6
+inc *r1
+dec L41
+red r7
+stop
+bne L37
+lea L35, r5
+jmp L30
+; comment
+jmp L15
+L42: rts
+L43: stop
+jsr L39
+L44: inc L37
+inc L29
+L45: mov L9, L12
+L46: .data -846, 279
+L47: sub *r6, *r6
+jsr *r6
+L48: rts
+inc r7
+clr *r3
+sub *r3, r1
+L49: inc r4
+rts
+L50: dec r4
+inc L18
+L51: sub r7, r2
+jsr *r1
+sub *r0, *r1
+lea L44, r4
+dec r3
+L52: jmp *r5
+L53: clr *r2
+add L30, L44
+L54: .data -748, -301, -972, -411, -878, -761
+not *r1
+bne L37
+jmp L23
+L55: .data -616, -12
+L56: red *r0
+stop
+L57: cmp r6, #-239
+L58: .string "yqyxnrvgkaicj"
+L59: .data 891, 665, 949, -396, -378, -645, 320
+L60: .string "wjlhrzurkrl"
+L61: dec *r6
+L62: inc L31
+mov L57, L25
+mov *r0, L35
+lea L50, *r2
+; comment
+L63: dec L39
+red L24
+cmp #-38, L57
+mov #64, *r0
+L64: .data -253, -909, 215
+rts
+add *r1, *r3
+lea L33, r6
+L65: jsr *r3
+clr r6
+L66: clr r5
+rts
+inc L55
+clr L31
+lea L39, r3
+L67: add r0, r6
+sub #-171, L46
+jsr *r2
+bne L40
+L68: sub *r5, r7
+not r1
+red *r0
+L69: dec *r0
+lea L50, *r4
+lea L6, r2
+L70: sub #60, *r5
+stop
+jsr L70
+sub r2, *r0
+cmp L28, L51
+cmp r4, *r5
+inc L48
+red L22
+L71: prn L31
+L72: sub L51, *r6
+sub r4, *r2
+cmp #210, #11
+prn L34
+prn #205
+add r6, L22
+stop
+add r5, L8
+; comment
+not L35
+L73: rts
+sub r1, r4
+L74: lea L55, r3
+L75: bne *r3
+prn #-213
+prn *r2
+L76: stop
+L77: .data 642, 137, 73, -827, 923, -228, 825
+L78: jmp *r3
+L79: red r5
+clr r1
+clr r5
+L80: bne *r5
+L81: prn #-126
+L82: jsr L63
+L83: sub #-31, *r4
+L84: sub #80, L70
+L85: add r6, *r7
+add r6, r0
+red L62
+L86: lea L44, r3
+add r7, *r6
+lea L32, L38
+red r5
+L87: jmp *r6
+sub r1, r1
+inc r0
+lea L44, r3
+jmp *r0
+lea L86, r6
+add r0, r0
+add L74, r4
+cmp #13, r7
+rts
+L88: .data 687, -163, -911
+rts
+add L1, r6
+lea L13, *r1
+L89: not *r2
+cmp r0, L62
+L90: inc L63
+mov r0, r5
+; comment
+lea L16, L43
+L91: sub #78, L32
+mov *r0, *r0
+red L40
+L92: bne *r3
+cmp r1, *r4
+add *r2, *r1
+mov r6, L76
+L93: red r2
+lea L60, L66
+L94: red L29
+inc r0
+bne *r0
+stop
+rts
+L95: inc *r3
+rts
+clr *r1
+cmp *r4, *r3
+lea L80, r0
+jmp *r4
+mov L68, *r4
+sub L86, *r1
+L96: rts
+sub r7, L59
+L97: .data 138, -716, -91
+stop
+dec L95
+; comment
+inc L23
+L98: clr r6
+bne *r5
+jmp *r7
+red L48
+red L92
+L99: not L82
+sub #-92, *r1
+L100: .string "kyuuiawledzzwiwmzvuqln"
+L101: cmp L1, #115
+L102: dec L62
+L103: rts
+L104: .data -312, 33, -747, 913, 122, -237
+mov r5, *r4
+L105: jsr L78
+lea L17, L105
+clr r2
+not L85
+prn *r7
+L106: .string "vlevdstweppoykpan"
+L107: stop
+stop
+; comment
+bne L65
+add *r5, *r6
+L108: cmp L65, r4
+L109: prn r0
+cmp L82, #-182
+cmp r6, #-151
+L110: .data 554, -284
+L111: prn r2
+not r3
+L112: jsr *r2
+L113: dec L83
+red *r1
+sub r6, *r4
+prn L101
+prn #51
+L114: cmp r5, #93
+L115: stop
+lea L38, L3
+dec r2
+bne *r0
+L116: lea L79, *r0
+L117: jmp L62
+sub L17, *r5
+dec *r0
+L118: mov *r6, r3
+stop
+jsr *r2
+stop
+rts
+bne *r6
+clr r1
+inc L96
+inc r7
+L119: add #146, L64
+; comment
+add *r5, r6
+prn r4
+jsr *r6
+prn *r0
+L120: sub r4, *r3
+cmp r5, L43
+not *r7
+jsr *r6
+red *r2
+cmp r3, L102
+L121: .data 838, -826, 668, 99, -522, 228
+L122: .data 342, -275
+lea L22, r1
+L123: cmp #-75, L98
+L124: jmp *r4
+L125: clr L80
+mov L21, L40
+prn *r1
+mov #90, L91
+L126: .string "wjjfgmwpk"
+; comment
+L127: clr r6
+L128: .data 624, -556, 408, -189, -592
+; comment
+L129: bne L22
+L130: lea L117, L15
+L131: jmp *r6
+add r0, r6
+cmp r0, L13
+L132: .string "bpguqlzzsyeidvp"
+
+rts
+mov r2, L96
+L133: stop
+clr r0
+jsr L19
+L134: cmp L90, L28
+sub L2, *r6
+L135: red *r3
+not r4
+L136: mov r6, r6
+not L11
+add L84, *r3
+L137: add #-193, L104
+L138: dec r4
+clr *r6
+sub #83, *r0
+L139: dec *r4
+inc r5
+L140: clr L82
+cmp #-69, r0
+rts
+L141: sub #-24, L91
+cmp L138, r6
+L142: bne *r7
+L143: stop
+L144: mov *r0, *r1
+red r3
+L145: .data 377, -215
+L146: .data 69, 240, 265, 933, 834, 405, 776, -46
+L147: rts
+L148: inc L76
+lea L79, L31
+cmp *r3, r4
+add L136, *r2
+sub L79, *r3
+not L18
+L149: .string "fbsvuuscvoezlu"
+prn #102
+lea L79, *r3
+
+rts
+sub L52, r7
+jmp L84
+L150: dec *r3
+jsr L27
+red *r5
+inc *r7
+prn #-166
+rts
+jsr L95
+sub #-71, r5
+cmp #-110, L9
+bne L108
+
+L151: .string "ki"
+sub #-24, *r7
+L152: clr *r0
+rts
+L153: add *r0, *r1
+not *r0
+L154: .string "ypptucypkyk"
+L155: red *r5
+jmp *r0
+L156: .string "emiosnj"
+clr r5
+jmp L141
+cmp *r5, L148
+sub #212, L92
+not r4
+L157: stop
+L158: rts
+jsr L117
+add r0, r7
+stop
+mov r3, *r4
+sub r4, L0
+clr r2
+dec r1
+L159: red r2
+rts
+L160: jsr *r5
+dec *r4
+L161: .data -957, 651, 0, -886, -257, 2, -585, -284
+dec r2
+rts
+jmp L12
+add r3, L75
+mov r4, L156
+lea L150, r5
+cmp #-97, *r3
+L162: cmp #-94, r4
+L163: mov #-58, L25
+red *r7
+not r0
+inc r0
+L164: jmp *r6
+L165: .data -262, 522, -658, 929, 398, 100, 453, -260
+inc L132
+lea L37, *r4
+L166: stop
+; comment
+jsr *r4
+rts
+mov L29, *r5
+L167: jsr L62
+L168: .string "vfwavjesftogowkf"
+jmp L41
+dec *r6
+rts
+inc r1
+clr r3
+L169: inc L123
+L170: red L9
+L171: stop
+add *r1, L147
+L172: clr *r7
+dec r1
+bne *r0
+L173: lea L74, L72
+; comment
+cmp L16, L104
+
+L174: .string "ggvjicujstieshvjvkjdx"
+prn L156
+L175: dec r0
+stop
+red L148
+L176: red *r2
+L177: red *r3
+lea L158, r2
+L178: inc r7
+L179: cmp *r0, r2
+L180: bne *r2
+dec r3
+bne L115
+lea L134, r4
+L181: .data 706, 302, -41, -416, -73, -958
+L182: .data -364, 257, 50, -902, 371, -53, 208, -5
+inc *r2
+L183: prn *r1
+L184: lea L70, *r0
+add L35, L27
+red L153
+; comment
+jmp L38
+L185: .string "vqlsfecoploumqirujofggn"
+L186: .data 692, -311, -583, -669, 1
+L187: not *r3
+red r7
+jsr *r3
+prn r4
+inc r2
+L188: bne *r5
+jsr *r3
+lea L135, r1
+clr L141
+add L168, r4
+L189: .string "ochetezjpgfnoslrkog"
+bne *r4
+jsr L145
+mov L110, *r1
+dec r1
+lea L71, L187
+L190: clr L117
+L191: cmp #215, *r2
+lea L109, r0
+red L98
+L192: dec *r5
+sub #3, *r3
+
+lea L120, r0
+rts
+L193: dec *r3
+cmp L27, #-93
+prn r0
+L194: add r4, r3
+rts
+stop
+L195: not L58
+; comment
+lea L145, L191
+L196: clr L71
+L197: cmp *r2, L148
+bne L171
+L198: .string "znwnstqqkcrnbbfukbvtgb"
+inc *r2
+L199: mov *r3, r1
+L200: lea L145, *r5
+L201: red *r4
+L202: red r7
+not r6
+L203: .string "agjzhnvqbroip"
+jsr *r5
+
+mov L200, *r5
+; comment
+red r4
+mov *r4, L44
+not *r1
+cmp *r5, r2
+inc *r2
+dec L75
+mov L53, r7
+rts
+L204: jsr L112
+L205: red *r6
+L206: .string "hdmokujvbjtd"
+L207: red r0
+stop
+red L42
+dec r1
+L208: mov L199, L132
+L209: sub r3, *r6
+sub #8, L159
+sub *r5, L180
+add L106, r4
+L210: stop
+L211: inc *r6
+prn L84
+prn *r1
+not L59
+L212: inc L29
+cmp *r5, L118
+L213: red *r7
+L214: prn r0
+jsr L145
+clr *r1
+L215: jmp L16
+stop
+clr L214
+bne L66
+lea L9, r2
+stop
+L216: .string "mtay"
+L217: sub L66, L182
+L218: .data -780, 514, 86, -381, -169, -734, 709, -699
+L219: .string "edkeaayacqqzjbsncu"
+bne *r1
+add L179, r3
+prn *r4
+cmp #-199, r3
+stop
+L220: .data 455, 313, 148, -53, 968, 292, 191
+L221: jsr L188
+mov #10, r1
+inc r2
+jmp *r7
+stop
+L222: add L43, r5
+cmp L128, #10
+cmp *r7, r4
+L223: sub #191, r1
+L224: prn L184
+L225: bne *r7
+L226: not L217
+mov #-161, *r4
+dec *r4
+bne *r6
+
+L227: rts
+L228: dec L129
+L229: rts
+L230: .data -125, 312, -320, 983, -783, 443, 940, 628
+; comment
+L231: prn r5
+L232: sub r4, L146
+stop
+stop
+jsr L40
+cmp #1, *r7
+jsr *r7
+prn #130
+bne L56
+clr r1
+add #218, r6
+
+L233: .string "qxxfzoaiubtjxud"
+add *r4, L106
+inc L52
+sub r7, r6
+L234: .data -166, -969, -346, -48, -381
+; comment
+lea L154, r1
+
+prn L3
+L235: add r4, *r0
+inc L173
+sub L94, r1
+rts
+L236: .string "cyhopgzhgmbpoephvxwfjry"
+L237: not *r6
+L238: clr r0
+dec L105
+cmp L101, L34
+; comment
+L239: add #-245, L15
+cmp r1, *r1
+L240: not r0
+L241: not r7
+L242: dec L113
+L243: .data -958, -856, -426, -438, 348, 561, -305, 676
+inc L165
+inc *r3
+stop
+L244: prn #-139
+L245: jsr *r3
+; comment
+red *r4
+L246: .data -22, -793, -98, -791, 800, -398
+L247: stop
+inc r7
+jmp *r6
+rts
+L248: bne L65
+L249: jsr L79
+L250: .string "ryv"
+add r5, r4
+
+dec *r1
+L251: .data -526, 704, -288, 515, 713
+jsr L201
+bne *r0
+clr L206
+prn r4
+jmp *r4
+
+mov *r0, L108
+stop
+L252: inc L58
+L253: cmp r7, L40
+lea L29, L211
+L254: rts
+not r0
+add L130, *r1
+L255: dec L127
+L256: .string "rv"
+add r6, r0
+L257: .data 285, -716, -245, 855, 58, 342, 815, -115
+dec r6
+L258: mov L74, r2
+jsr *r3
+inc r7
+stop
+cmp *r1, #139
+add r5, *r4
+sub #101, r7
+L259: jmp L215
+L260: clr r6
+cmp *r6, L218
+L261: cmp L124, *r7
+L262: bne *r5
+mov L233, L70
+L263: jmp *r2
+L264: bne L256
+rts
+not L92
+jsr *r3
+sub r7, r2
+clr *r5
+add #-87, L53
+L265: inc *r0
+jmp *r2
+L266: stop
+cmp #142, L253
+L267: .data -797, 329, 306, -320, -737, -470, -378, 445
+add L158, r4
+sub #127, L200
+add r3, r3
+not *r7
+L268: not r6
+clr *r6
+jsr L213
+red L118
+L269: mov #199, r2
+red L146
+jsr L212
+L270: .data 86, -406, 156, -271, -642, -164, 234
+add L154, r0
+jsr L120
+L271: .data 307
+L272: .data -647, 595, 153
+not r4
+prn *r3
+bne L150
+stop
+; comment
+inc r4
+dec r4
+; comment
+L273: rts
+not r1
+bne L44
+prn *r6
+dec *r3
+L274: lea L172, *r1
+L275: cmp #-32, #-158
+red L235
+lea L256, L27
+bne *r5
+L276: .string "oxaqy"
+prn L64
+bne *r6
+
+L277: .data -956, 731, 798, -453, 593, -816, 123, 638
+; comment
+L278: cmp #-11, L16
+L279: .data 27, 667, -913, -838, 897, -860, 264
+lea L18, L152
+not L16
+mov L56, *r2
+L280: clr L235
+L281: lea L157, r4
+stop
+bne L249
+L282: red L27
+cmp r6, r3
+red *r7
+dec L51
+sub #139, L30
+jsr *r0
+bne *r2
+L283: cmp *r4, r4
+clr r4
+rts
+inc r6
+cmp r4, *r1
+cmp L4, #32
+L284: lea L137, *r5
+L285: rts
+; comment
+L286: bne L273
+sub *r0, r7
+rts
+L287: .string "jp"
+L288: clr *r1
+add L95, r0
+rts
+cmp *r7, *r3
+add L189, r3
+L289: .string "l"
+clr *r0
+not r6
+rts
+not L273
+stop
+jsr L82
+red L47
+L290: .string "ggcxufucigzaivkyaw"
+stop
+jmp *r0
+dec r1
+L291: cmp r5, r1
+clr r1
+rts
+inc r5
+jmp L162
+add #-139, r5
+jmp *r0
+clr *r6
+bne L85
+not *r7
+L292: .data -975, 6, -581, -71, -82, -712, -704
+L293: sub *r1, r7
+not L130
+dec r6
+jmp *r3
+L294: bne L222
+bne L42
+L295: not L204
+lea L26, *r7
+add r1, L111
+not *r1
+jmp *r5
+L296: inc *r4
+cmp L153, L61
+clr r5
+L297: clr L159
+L298: inc *r0
+L299: red L280
+not *r0
+red r0
+sub L180, *r0
+L300: lea L43, r2
+bne *r5
+mov r3, L93
+not *r1
+L301: red r3
+jsr *r3
+L302: .string "f"
+mov *r3, r7
+L303: clr r7
+jmp L181
+bne *r2
+inc r0
+jsr *r6
+sub *r3, *r1
+jsr *r5
+inc L271
+rts
+sub L218, *r6
+L304: sub *r6, r4
+mov r0, *r2
+L305: .data -48, 635, 706, -701
+prn L266
+L306: bne *r4
+L307: .data -17, 586, 963, 615, 767, -11, 348, -162
+L308: cmp L30, #23
+L309: dec r4
+rts
+L310: add *r0, L125
+L311: jmp L85
+
+dec L111
+L312: not *r4
+L313: clr *r2
+cmp r1, r3
+
+lea L295, r0
+stop
+L314: .data 381, -315, -487, 142, -248
+L315: inc L306
+red *r3
+L316: inc r6
+; comment
+cmp r3, #193
+add r5, L10
+prn *r6
+L317: prn L87
+sub L102, r2
+add #187, *r6
+sub r2, r5
+not L258
+L318: clr L262
+jsr L210
+L319: .data 499
+L320: inc L244
+bne L297
+sub r4, r7
+L321: cmp L251, #1
+L322: bne *r4
+inc L213
+rts
+
+inc L220
+red L179
+red *r2
+clr r2
+L323: prn L157
+mov *r2, *r1
+red r4
+L324: red *r5
+jsr *r0
+red *r4
+sub r1, L165
+bne L13
+jmp L18
+L325: dec r3
+L326: .string "fplg"
+L327: jsr L181
+bne *r4
+inc *r4
+clr L151
+add #127, r7
+L328: inc L54
+add L56, r6
+jmp *r3
+red *r3
+; comment
+mov *r6, L259
+jmp L75
+L329: add L134, L294
+red L28
+jsr *r5
+; comment
+L330: red *r4
+red *r6
+prn *r6
+L331: .data 795
+cmp L160, r5
+L332: dec r3
+L333: cmp *r4, r6
+dec r5
+add #175, r6
+dec L266
+clr *r5
+red *r6
+jmp L321
+lea L92, r1
+
+jmp L123
+L334: not L20
+mov r6, L147
+; comment
+L335: cmp L311, *r4
+jmp L100
+L336: bne *r7
+jmp L281
+lea L253, *r3
+red L81
+L337: .data -217, -817, 377, -637, -78, -672
+lea L294, r1
+rts
+red *r2
+
+rts
+
+L338: jsr *r1
+L339: not *r0
+clr r5
+L340: clr *r5
+L341: cmp *r5, r2
+cmp *r0, L260
+not L232
+jsr L27
+stop
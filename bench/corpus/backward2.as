@@ -0,0 +1,1023 @@
+; Generated by genCorpus --seed 3
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+sub r5, L17
+L0: .string "twvghbb"
+jsr L0
+bne *r7
+red r4
+L1: .string "nzlliklnncvwexutiurivwoh"
+L2: .data 554, 145
+jmp L2
+jmp L0
+L3: rts
+bne *r0
+jsr L1
+rts
+L4: cmp #-246, r7
+; comment
+L5: .string "gapezzlnlnjlnjjxizg"
+
+rts
+stop
+inc *r4
+add L3, r2
+jmp L3
+L6: rts
+L7: mov *r2, r3
+L8: .data 167, 59, 874, 934
+prn #59
+jmp L5
+L9: inc *r5
+not r6
+L10: clr r5
+L11: prn r4
+L12: stop
+add #-64, *r4
+inc *r2
+L13: rts
+stop
+L14: cmp r2, L12
+rts
+
+cmp L2, r6
+rts
+mov L7, L2
+sub L6, L6
+; comment
+
+stop
+not r0
+bne L9
+bne L7
+L15: .data 208, -816
+
+lea L15, *r3
+bne *r0
+L16: .string "azvmzlphwd"
+bne *r3
+L17: .string "tbgigwuokianuikafq"
+L18: not L18
+; comment
+L19: lea L19, L17
+L20: .data 348, -561, -173, 904
+
+L21: clr L11
+add *r6, *r6
+red L20
+cmp L17, #201
+
+L22: dec r0
+add r6, L14
+L23: jsr L21
+
+stop
+stop
+L24: prn *r2
+bne *r0
+dec L9
+L25: .string "zjrlwqwvucmmnfrbwu"
+L26: red r4
+bne *r7
+L27: .string "oupwhdlgqtfgjokfw"
+bne *r7
+mov r3, *r1
+rts
+inc L3
+cmp r6, #170
+L28: add r7, *r4
+L29: .string "kteyjqbvqewbianudt"
+; comment
+
+bne L0
+L30: jmp L28
+jsr *r7
+bne *r2
+bne *r5
+L31: stop
+L32: lea L10, r7
+L33: .data -277, 322, -668, -740, 353, 33
+not L28
+dec r2
+inc *r2
+L34: jsr L16
+; comment
+lea L23, *r5
+L35: dec L14
+prn #42
+
+L36: bne *r4
+inc *r5
+inc L3
+not r6
+
+L37: add r7, L5
+L38: cmp L5, #181
+stop
+mov #-251, *r3
+sub r1, r1
+clr *r7
+sub r0, L15
+
+bne L11
+L39: sub r5, r6
+prn L9
+stop
+L40: .string "wtlrggbu"
+red *r6
+inc L16
+L41: .string "jnnchumj"
+L42: not r1
+dec L8
+L43: sub L21, L32
+L44: red L11
+red *r5
+L45: clr r1
+jsr L35
+L46: .string "asvphgwuoxvhnzxzjhdvg"
+sub #40, L34
+mov L3, r5
+mov *r6, L22
+jmp *r0
+jmp *r0
+jsr L31
+sub *r4, L32
+
+L47: jmp L35
+stop
+cmp r0, r3
+L48: .string "xgyls"
+add *r5, *r5
+L49: .string "kbqxgmgv"
+sub *r2, L6
+rts
+prn L43
+prn r7
+inc L39
+L50: .string "nwr"
+jmp *r5
+jsr L0
+L51: .string "ldejfzhmzshsvl"
+sub *r6, *r7
+not r7
+prn L47
+L52: stop
+L53: lea L15, r6
+prn *r4
+clr *r4
+L54: clr *r1
+jmp L14
+add r3, *r4
+rts
+stop
+stop
+L55: .string "edoj"
+sub *r7, r2
+not r0
+sub *r6, L28
+red r2
+L56: jsr *r5
+L57: bne L7
+L58: .data 688, -260, -386
+
+jsr L6
+cmp *r0, #5
+L59: sub #63, *r5
+cmp r5, #-181
+cmp #33, #153
+L60: bne *r6
+sub *r3, r0
+inc *r3
+L61: add L22, L45
+dec r2
+L62: sub #-254, *r7
+L63: stop
+L64: jsr *r6
+clr r0
+L65: jmp L38
+red r3
+L66: add L30, *r4
+not L53
+jsr L9
+prn #193
+lea L65, L11
+L67: .string "aeztbdyadc"
+jsr L33
+inc *r6
+L68: inc r0
+jsr L49
+mov r1, r4
+lea L53, *r7
+L69: stop
+lea L43, *r3
+L70: .data 968, 465, -258
+L71: lea L11, L29
+rts
+L72: bne L39
+dec L47
+L73: inc L33
+lea L59, r1
+stop
+jmp L58
+L74: .data 744, -369, -794, 615, 782, -511, 779
+dec r0
+prn r0
+lea L63, r2
+red L25
+clr *r3
+
+inc L8
+cmp r6, *r3
+rts
+inc *r7
+inc L22
+mov L54, *r5
+bne *r5
+lea L34, L25
+inc L46
+L75: cmp *r4, #94
+L76: stop
+cmp #167, r5
+rts
+L77: jmp *r2
+dec *r1
+L78: jsr L3
+inc r2
+L79: clr *r7
+not *r0
+L80: add *r5, L12
+cmp L1, L11
+prn #-95
+add L52, L47
+L81: sub *r5, L42
+red *r5
+red L9
+bne *r2
+bne L40
+; comment
+L82: jsr L58
+dec L55
+stop
+L83: .data 156, 174, -400, -318, -730, 912
+rts
+L84: cmp #66, L62
+cmp *r3, r4
+L85: .string "wzbzltij"
+L86: .data 610, -700, 53
+red r1
+L87: rts
+L88: .data 690, 662, 918, 188, 70, 157, -43, -261
+L89: jsr *r6
+cmp *r4, *r2
+sub L4, L5
+inc L44
+L90: clr *r1
+sub r7, L38
+L91: clr L61
+rts
+L92: .string "phqryysxf"
+bne *r7
+prn *r5
+jsr *r1
+bne L20
+L93: .data 175, -522, -873, 121, -583, -398
+add L75, L70
+dec *r3
+L94: sub #134, *r1
+jsr *r3
+lea L27, *r1
+rts
+not *r3
+lea L6, r1
+L95: inc r5
+inc L43
+L96: jmp *r1
+L97: jsr L43
+mov *r0, L47
+cmp #-28, #171
+jsr *r4
+clr *r3
+rts
+L98: lea L93, L51
+not r7
+dec L33
+sub #-13, *r0
+stop
+not r5
+L99: jsr L24
+rts
+dec r4
+mov L57, *r3
+rts
+lea L30, *r5
+L100: not r2
+cmp L86, r6
+sub r4, *r3
+
+dec L10
+lea L14, r0
+not r7
+L101: .string "j"
+add r0, L94
+cmp L101, L23
+prn L38
+stop
+prn *r3
+stop
+rts
+mov L12, *r2
+L102: bne L72
+jmp *r1
+stop
+L103: .data 807, 696, -909, -22, 621, -58, -819, 171
+dec r1
+stop
+L104: dec L7
+stop
+cmp *r1, L70
+L105: .string "ydir"
+dec r6
+L106: .string "rfddmozzm"
+L107: .data 180, 186
+bne *r1
+jsr L37
+red *r5
+not r0
+
+not L50
+L108: red L72
+add L79, r6
+rts
+stop
+L109: not r7
+jmp *r1
+rts
+L110: jsr *r1
+L111: dec L111
+dec *r2
+L112: .string "zgloqywnnthnzrtactwsceti"
+L113: lea L91, L5
+L114: jmp L103
+L115: rts
+jsr *r0
+prn L42
+not r1
+dec L111
+lea L113, L5
+clr L45
+L116: .data -17, -38
+L117: .data -871, 914, -952, -115, -879, 764, -968
+L118: .data -974, 458, 478, 207, -609, -258, -239
+sub #121, L106
+L119: mov #88, r0
+rts
+dec *r7
+add L79, r0
+stop
+prn #-233
+lea L80, L39
+clr L109
+L120: lea L69, L112
+rts
+bne *r2
+inc *r2
+jsr L119
+rts
+dec r2
+stop
+prn r3
+rts
+lea L48, r1
+jsr L15
+L121: cmp #-77, #195
+L122: red L102
+not *r4
+sub r4, *r5
+jsr *r7
+add #148, *r5
+lea L63, L22
+L123: jsr L63
+L124: red L96
+not L80
+L125: jsr L67
+prn #244
+L126: bne L89
+L127: stop
+jsr L16
+cmp L2, #-183
+stop
+L128: .data 321
+L129: not L32
+L130: red *r2
+dec *r6
+clr *r3
+stop
+not *r5
+prn *r6
+inc L57
+red r5
+add *r7, *r5
+not *r7
+not *r5
+stop
+sub *r3, L0
+jmp L28
+lea L37, L11
+red *r4
+sub *r5, L25
+sub r2, L71
+L131: .data -938
+rts
+jmp *r6
+L132: jmp L114
+add L44, r1
+prn #-2
+jsr L14
+dec r2
+add L109, *r6
+L133: .string "ltwsfasqnoxkxsuzvyywhiu"
+L134: .data -124, 239, 79, -414, -945, 884
+sub r1, r7
+L135: inc *r2
+dec *r7
+L136: .string "ddvcxxbs"
+sub *r7, *r4
+L137: dec r0
+L138: .data -96, -506, -28, -149, -902, 95, -496
+red L95
+cmp *r2, r4
+L139: .data 617
+L140: jsr L101
+L141: add *r5, r2
+L142: .string "vxwtefemph"
+not L38
+jsr L28
+bne L63
+cmp r0, L130
+L143: stop
+bne L34
+clr r7
+rts
+cmp *r7, L43
+L144: rts
+L145: jmp L122
+L146: lea L111, *r3
+L147: .data 607, 423, 191, -117, -709
+add L53, L99
+L148: not *r4
+stop
+L149: prn r5
+not *r6
+L150: add *r1, L124
+
+cmp r3, *r3
+clr r7
+L151: .string "dyixpgpmikvpnzkb"
+add #-10, *r4
+inc r5
+dec *r5
+L152: not L65
+rts
+lea L86, r4
+sub L9, *r2
+L153: not r6
+L154: lea L106, *r0
+bne *r3
+L155: prn *r3
+jmp L35
+L156: mov #40, L80
+L157: red r7
+L158: stop
+lea L46, r7
+red *r4
+stop
+red *r4
+L159: lea L35, *r7
+sub #238, r0
+not L84
+add r4, *r7
+inc *r4
+L160: dec L137
+mov r1, *r0
+lea L80, *r2
+lea L49, *r6
+jsr L107
+L161: rts
+L162: bne *r2
+prn #-215
+stop
+L163: cmp *r3, *r0
+mov r4, L139
+inc L53
+prn *r1
+prn *r6
+clr r7
+inc *r1
+cmp #72, L119
+prn r6
+jmp *r2
+cmp r1, *r5
+red r6
+L164: mov #-215, L46
+jmp L41
+L165: dec L3
+L166: .string "nthjsaukznezqd"
+clr *r3
+dec L26
+inc *r3
+L167: .data 414, 893
+jmp L2
+add r1, L157
+jmp L116
+L168: .data -566
+
+stop
+mov r5, L86
+red *r1
+L169: .string "mijlgzuwd"
+L170: .data 971
+L171: .string "ckupmpjrznnwdccghcus"
+stop
+jmp L171
+red *r0
+jsr *r1
+red L52
+mov #107, L37
+add *r5, L137
+L172: jmp L134
+L173: jmp *r3
+prn *r3
+clr L101
+sub *r1, r7
+L174: inc *r3
+L175: cmp L5, r4
+red r6
+L176: .string "bhvebzqcfsipiuxq"
+
+jmp *r4
+L177: prn r3
+cmp #-254, #-65
+red L3
+red L121
+L178: jmp *r1
+jmp L173
+red L116
+L179: .data 880, -277, 382, -957, -723, 439, -942
+L180: prn *r5
+stop
+L181: cmp *r6, L71
+lea L81, *r1
+mov r3, r4
+rts
+L182: .string "axrrcxninpells"
+rts
+L183: not *r4
+L184: jsr *r6
+red *r3
+L185: .string "wfoetmjckdhvpcq"
+jsr L162
+inc *r7
+L186: not *r1
+prn *r7
+L187: .string "rntypixqvsx"
+not *r7
+
+red *r1
+L188: .string "fgmvyzkjeel"
+inc r7
+L189: lea L175, *r2
+L190: jsr L36
+add *r3, *r1
+clr r2
+L191: bne *r6
+jmp *r0
+
+add L101, r2
+rts
+inc r6
+L192: add L154, *r7
+dec r1
+inc L19
+mov L129, r1
+L193: not *r1
+jmp L51
+stop
+L194: .data 743, -863, 543, 516, 227, 855, -688
+clr L186
+lea L140, L63
+
+inc L161
+jmp *r6
+inc L78
+L195: .data -336, -831, 618, -599, -807, -294
+sub #95, r7
+L196: jsr L150
+L197: .string "udcwffzzxvqnh"
+mov *r0, *r1
+jmp L183
+dec r0
+L198: stop
+L199: .string "tcsxgnbywdirbmhvs"
+L200: bne *r1
+L201: .string "czkkxsmqjhlftlwx"
+stop
+lea L177, *r6
+L202: bne L79
+mov #-28, r6
+lea L183, r5
+prn L149
+not r1
+not *r3
+L203: stop
+L204: dec L129
+L205: .data -402, 919, -76, -725
+inc r0
+bne L110
+dec L62
+; comment
+stop
+bne L130
+L206: bne L77
+L207: .string "rgjctcujhesgqvfc"
+bne *r0
+cmp #203, L18
+bne L139
+add *r2, L192
+L208: sub r1, r2
+lea L75, L121
+rts
+rts
+
+L209: jmp L77
+mov r5, L160
+clr *r4
+red r5
+L210: mov L48, *r4
+inc *r2
+L211: lea L182, r2
+L212: inc *r1
+bne L99
+jsr L69
+L213: .data 989, -355
+
+red *r7
+cmp L34, r7
+inc *r4
+clr r6
+inc *r1
+L214: rts
+mov #229, r5
+bne L28
+not L121
+jsr *r1
+L215: .data -706, 157, 849, -927, 663, 658, -103, -324
+dec *r0
+inc *r3
+lea L202, r2
+sub #168, L26
+red L126
+clr *r5
+jmp *r2
+dec r5
+L216: rts
+L217: .string "zymxqrly"
+prn L39
+prn *r5
+L218: inc *r7
+L219: .data 845, -452, -578, 562, 710, 209
+lea L210, r4
+L220: jsr *r5
+stop
+L221: cmp *r7, #45
+L222: add *r3, r5
+jmp *r3
+add L83, L189
+prn r0
+not r2
+L223: clr *r4
+sub #53, *r7
+; comment
+mov L46, L136
+L224: mov r3, L216
+L225: clr r0
+jsr L25
+; comment
+L226: .string "jjzkcyrsfqzdhxoj"
+prn #155
+mov r3, r4
+L227: sub *r4, *r4
+lea L76, *r5
+
+jmp *r6
+stop
+jmp L190
+jmp L79
+add r6, L214
+jmp *r4
+L228: red L174
+not *r7
+L229: stop
+prn #149
+cmp L182, *r2
+clr *r1
+rts
+prn L36
+rts
+inc L188
+L230: jmp *r5
+inc L79
+L231: not *r1
+sub r5, r6
+L232: prn r2
+L233: .string "hbcaiiizem"
+rts
+mov *r1, L198
+prn #189
+L234: lea L125, r4
+red r5
+inc L81
+dec *r2
+mov *r0, *r5
+L235: clr r7
+bne L143
+prn L52
+sub *r2, L69
+prn r2
+prn *r7
+rts
+L236: cmp L183, #114
+rts
+lea L153, *r4
+bne *r3
+clr *r2
+dec r2
+L237: stop
+L238: mov L95, r7
+cmp #-96, *r0
+L239: mov *r3, *r5
+L240: .data -33, 685, 840, 951
+L241: dec *r2
+L242: .data -567, -924, -509, -155, -994, 94
+sub L94, r4
+
+clr r3
+stop
+L243: sub #90, r2
+jmp L136
+lea L176, *r1
+jmp L160
+red L237
+red r2
+sub L48, r4
+mov *r0, *r0
+jsr *r4
+not *r1
+
+clr r2
+L244: .data -107, 543, -855
+jmp L34
+L245: .string "lnydczliaaoiad"
+L246: red L212
+red r4
+bne L180
+bne *r1
+cmp #-104, r0
+mov *r6, r7
+L247: stop
+L248: bne L87
+stop
+prn *r1
+add #-172, *r7
+cmp r1, *r1
+L249: .data -851, -557, 919, 537, 897, 661, -613, 217
+add r0, *r4
+L250: dec r4
+L251: bne L182
+lea L189, *r4
+
+L252: lea L190, L88
+stop
+add L124, L50
+L253: clr r1
+L254: .data -538, -773
+L255: sub L250, L161
+; comment
+dec r2
+clr r3
+L256: .string "sk"
+L257: prn r4
+jsr *r1
+red *r0
+L258: mov *r3, *r2
+jmp L123
+L259: lea L59, L107
+cmp r3, #-157
+
+stop
+inc *r4
+not L256
+dec *r4
+L260: .string "nmuovouvgwbhbmdt"
+L261: inc *r7
+L262: prn #174
+mov *r4, L216
+mov *r1, L226
+mov *r1, *r3
+L263: inc L121
+L264: .string "acsneenyjbnpezds"
+L265: .string "rxbkxxtbtcgssjc"
+L266: .string "fsr"
+L267: dec L31
+stop
+L268: stop
+L269: .data -234, -899
+lea L169, L13
+jmp *r6
+bne *r6
+lea L80, L246
+L270: .string "szeqsorxngmwtpypr"
+not *r0
+jmp L48
+lea L173, r3
+L271: bne *r4
+jsr *r7
+L272: .data -783, -404, -436, -735, 907
+L273: lea L247, L16
+prn L216
+L274: clr r0
+L275: red r0
+L276: clr *r2
+; comment
+mov *r6, L60
+L277: prn *r2
+not *r4
+prn *r4
+not *r3
+L278: .data 469, 29, 748, 796, -51, -25
+L279: jsr L160
+cmp L189, L43
+inc r3
+jsr *r5
+mov L210, r2
+sub *r3, r6
+red *r1
+not L251
+L280: stop
+L281: .string "kndtgtaqaogtnvxeexejb"
+L282: .string "yobiwpmvekx"
+jsr L242
+L283: cmp r6, *r4
+L284: lea L76, *r1
+mov #238, r6
+cmp #-171, r6
+sub #90, *r4
+mov *r5, L190
+clr *r0
+stop
+L285: stop
+; comment
+stop
+lea L38, L169
+lea L72, *r7
+dec L145
+L286: dec *r5
+red L257
+L287: .data -351, 118, -685, -866, -871
+lea L114, r0
+L288: jmp L224
+jsr L129
+not *r6
+L289: sub L263, r7
+prn #208
+prn r6
+mov *r5, *r6
+jmp *r6
+L290: inc r3
+inc *r6
+cmp #211, #-57
+L291: cmp L47, #-73
+prn r1
+L292: mov r2, *r2
+clr L244
+L293: lea L46, *r1
+L294: .data -425, 484, 375, -565, 883, -41, 110, 955
+L295: cmp r3, L207
+L296: rts
+dec r4
+bne L62
+L297: dec r1
+mov L202, L224
+sub r6, *r5
+L298: prn L141
+jmp L92
+jsr *r7
+mov r3, L282
+stop
+L299: .string "ylimjvgyxxbgsfuzshnu"
+cmp L93, #161
+; comment
+sub r6, L2
+red r3
+L300: rts
+L301: .data -86, 131, 752
+inc L124
+not *r6
+L302: sub L141, *r7
+rts
+L303: add #-34, *r3
+stop
+bne L178
+mov #-95, r4
+
+sub r2, r6
+sub #91, *r4
+cmp L221, #223
+red r0
+mov L266, *r5
+clr *r5
+prn *r5
+rts
+jsr *r5
+L304: not L191
+
+L305: cmp *r6, *r1
+L306: bne L162
+jmp *r1
+L307: sub *r4, *r7
+; comment
+stop
+L308: .data 812
+lea L165, L202
+mov *r0, r6
+add #-202, r6
+
+L309: inc L138
+bne L150
+stop
+L310: .data 551, -305, -834, -786, -469
+sub *r5, r0
+jsr *r4
+cmp L32, r0
+cmp #65, #-58
+rts
+prn L133
+rts
+prn #41
+clr L89
+red r0
+dec L144
+bne *r0
+stop
+L311: .data 298, -831, -64
+red *r3
+L312: red r1
+cmp #-13, #-55
+red r1
+L313: sub L264, r3
+L314: jmp *r4
+clr *r3
+inc *r7
+not L241
+L315: prn r1
+rts
+L316: not L10
+sub L276, r1
+L317: dec *r7
+stop
+jsr L131
+not *r5
+L318: clr r2
+L319: .data -980, 492, -557
+L320: inc L151
+stop
+bne *r7
+stop
+L321: add *r0, r5
+jmp *r0
+clr L271
+L322: not *r3
+L323: stop
+cmp *r3, r2
+add #114, r6
+L324: bne *r6
+not r1
+stop
@@ -0,0 +1,1023 @@
+; Generated by genCorpus --seed 21
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: bne L0
+stop
+jsr *r3
+L1: mov r3, r4
+L2: mov *r6, L2
+jsr L1
+
+jmp L0
+bne *r5
+
+L3: mov *r2, *r2
+L4: .data 481, 14, -229, -318
+dec r6
+L5: lea L0, *r1
+stop
+jsr *r6
+L6: cmp L3, L1
+rts
+bne L3
+jmp L1
+lea L1, *r6
+add #56, r4
+; comment
+L7: red *r7
+L8: .string "kytjgw"
+mov #-117, L0
+jmp *r1
+sub r7, *r7
+mov #22, L4
+inc r6
+dec r1
+L9: add r4, L2
+sub L2, *r4
+sub r3, *r5
+lea L0, r1
+jsr *r3
+jmp *r3
+lea L0, *r6
+rts
+L10: jmp L8
+L11: .string "fvdaqjurflvezrfsebtusnu"
+L12: .string "rlalptecrjemtrwmt"
+L13: .data 37, -379, 284
+L14: stop
+red L9
+prn L5
+stop
+L15: cmp L15, r7
+L16: .data 641, 174, 911
+dec *r3
+L17: dec r7
+red r2
+mov #-229, *r0
+bne *r4
+clr L10
+jsr L5
+jsr L7
+sub *r2, *r4
+L18: lea L0, *r2
+dec L12
+inc L17
+prn r2
+L19: dec r3
+dec L6
+lea L4, *r4
+L20: inc *r5
+inc L1
+L21: .data -744, 257, 135, -443, 700, -656
+L22: .data -114, 895, 504, 980, -826
+inc *r6
+L23: jsr L14
+sub r2, r2
+jmp *r5
+L24: prn L0
+add L23, *r7
+sub #-210, r5
+cmp L5, *r5
+L25: rts
+dec r7
+L26: red r6
+mov *r7, L13
+inc L4
+not L22
+L27: stop
+stop
+red r6
+sub r5, *r5
+rts
+sub r5, L14
+L28: prn #90
+add L16, L28
+jsr *r1
+L29: stop
+mov r6, *r3
+stop
+L30: .string "wxjulbiqzhpywxed"
+L31: bne L18
+rts
+bne L10
+bne L24
+
+dec L2
+lea L25, *r0
+L32: .string "mtxcjrsh"
+
+L33: bne L25
+L34: jsr *r5
+L35: stop
+clr L3
+L36: red r5
+dec L31
+L37: mov L34, r7
+sub #-114, *r3
+L38: .string "uwhbaswysor"
+prn r6
+lea L27, L16
+clr L12
+rts
+sub r5, L3
+mov *r7, r3
+prn L32
+cmp #100, L23
+not r6
+red L30
+not L35
+cmp #-134, *r2
+inc r6
+rts
+sub r4, L38
+jsr *r4
+
+L39: .string "ouevlkrhgyneg"
+L40: jmp *r2
+L41: rts
+red L24
+red L12
+red r5
+not r1
+lea L14, *r6
+L42: .data 432, -730
+; comment
+add #-178, r4
+L43: .data -680, 225, 9, 407, 284
+L44: .data 775, 419, -949, -730, -486, -266
+L45: red r3
+sub *r3, *r3
+rts
+; comment
+mov L16, *r6
+prn L44
+prn *r5
+rts
+cmp L9, L18
+L46: sub L9, r6
+add L36, r2
+bne *r5
+mov r3, r4
+clr L28
+L47: .string "es"
+cmp L37, L24
+L48: jmp L29
+L49: clr L14
+jmp *r2
+L50: .string "hrrctpeqnqmjoh"
+mov r3, *r2
+clr r2
+jsr *r0
+L51: red r0
+cmp r7, L48
+L52: not r0
+L53: .data -172, -459
+mov L36, *r0
+rts
+bne *r0
+red r5
+red *r5
+L54: rts
+jmp *r3
+not r0
+L55: .string "mistcidsc"
+L56: .string "jutxalyhqsnlqwuhnhiva"
+L57: not *r2
+rts
+L58: bne L16
+jmp *r4
+mov r5, *r0
+jmp *r1
+L59: .string "epvxidbwc"
+L60: rts
+not L37
+L61: cmp *r3, r3
+L62: .string "mqtlhjduuhvchsmac"
+L63: jsr *r6
+mov *r3, r2
+L64: .string "ltcuhmngjh"
+rts
+L65: .data 854, 528, -638, 460, -796, -189, 333
+jsr *r3
+lea L50, *r6
+L66: stop
+L67: cmp r5, *r4
+red *r5
+prn r4
+mov L54, *r3
+L68: jmp L31
+rts
+L69: red L1
+L70: jsr *r0
+dec *r4
+L71: .string "ayoufrqbhdi"
+bne *r6
+jmp *r4
+L72: stop
+cmp L18, L67
+cmp L1, L40
+inc *r2
+L73: bne *r7
+rts
+rts
+jmp L63
+L74: sub L7, *r7
+mov L66, L38
+add r6, r4
+clr L10
+L75: lea L54, *r4
+mov *r1, *r3
+add *r6, r7
+jmp *r3
+L76: cmp L54, L65
+add *r5, L57
+L77: sub *r2, *r6
+L78: .string "wwnpvav"
+lea L4, r3
+jsr *r7
+L79: not *r4
+
+jmp *r1
+L80: add #-14, *r0
+add *r3, *r0
+L81: .data 988, 885, -778, 654, 26, -158, 95, -460
+prn r1
+L82: rts
+L83: not r2
+rts
+cmp #176, r6
+sub L2, L38
+L84: clr r2
+
+bne L42
+L85: dec *r5
+L86: .data 274, -809, 114, -673
+prn #128
+L87: cmp r3, #-224
+red r3
+sub *r3, *r3
+L88: lea L31, r4
+rts
+mov L55, L29
+not L30
+sub r2, r0
+stop
+L89: red r7
+lea L32, r7
+bne *r5
+red *r1
+L90: .data 168, 457
+lea L40, L39
+bne L90
+jmp *r3
+jsr L27
+stop
+prn *r1
+not r6
+not *r5
+jmp L60
+jsr *r6
+stop
+L91: mov #-126, r2
+sub #183, L70
+L92: not L47
+prn *r6
+add #-6, r3
+jsr *r1
+sub r3, *r0
+; comment
+L93: dec L53
+jmp *r7
+L94: prn r6
+sub #94, *r6
+L95: prn *r6
+cmp r0, r0
+L96: not r7
+sub #107, *r3
+
+mov r5, *r4
+L97: .string "iwglillaphrvv"
+cmp #-230, #125
+clr L59
+not *r6
+sub L96, r7
+L98: rts
+bne L35
+mov r4, r1
+L99: .data 163, -116, 407, 359, -259, 780, 562, -448
+prn #3
+dec L50
+L100: inc *r5
+; comment
+not r0
+add L67, *r0
+sub *r6, r4
+L101: jsr *r4
+L102: cmp L20, *r0
+mov #1, L48
+; comment
+mov r5, L87
+L103: not *r5
+bne L30
+L104: .data 597, -183, 552, -960, 771, -687, 895, -356
+inc *r0
+L105: red r2
+clr *r6
+red *r7
+; comment
+cmp *r4, *r6
+
+clr r7
+jsr *r2
+L106: .string "ekezzwiicghgowgr"
+mov *r1, *r6
+clr r5
+red *r5
+prn L94
+L107: jmp L47
+L108: .data 87
+mov L50, r0
+L109: clr r7
+lea L96, L61
+inc L41
+jmp L101
+
+rts
+jmp L53
+
+mov L40, *r1
+mov L106, r6
+inc *r3
+
+L110: not *r3
+stop
+dec L39
+L111: .data -430, -214, -582
+; comment
+L112: jmp *r3
+L113: red L56
+lea L46, r3
+lea L85, L36
+dec *r3
+stop
+L114: prn *r4
+dec *r6
+L115: lea L28, L34
+clr L60
+jsr L76
+jsr L114
+not *r4
+stop
+mov r7, r6
+inc r4
+
+L116: .data 676, -343, 109, 958, -740, -179, 636
+L117: stop
+bne L68
+L118: .data -408, -389, -788, -830
+sub *r3, r0
+L119: cmp #254, L109
+rts
+mov *r2, r4
+not *r0
+not r4
+L120: lea L113, r6
+mov #-199, r1
+prn #14
+lea L56, r4
+jsr L8
+clr r2
+not r2
+stop
+jsr *r7
+jmp *r0
+red L117
+jmp L97
+red *r4
+mov r6, *r6
+prn L110
+cmp *r6, *r4
+L121: prn *r7
+rts
+L122: cmp r6, *r7
+dec *r5
+rts
+red r7
+L123: red *r6
+stop
+red *r2
+sub L28, r7
+lea L16, r0
+add r2, L13
+L124: .string "xwpqllvneje"
+red L119
+L125: red r4
+L126: not r1
+L127: lea L58, *r0
+L128: .string "kuo"
+sub #241, *r1
+L129: prn L126
+jsr *r1
+L130: bne *r3
+add #241, L14
+L131: cmp r6, #-192
+jsr *r0
+not *r7
+not L107
+dec r5
+bne *r0
+stop
+mov L127, L42
+L132: .string "mtcezrkcpsr"
+dec *r0
+prn r6
+L133: stop
+inc r2
+L134: dec r3
+L135: mov L104, *r5
+jsr L122
+L136: stop
+L137: .string "mclbdjvxaefzblqprbcutusz"
+bne L41
+add *r2, *r6
+sub *r3, r1
+jmp *r0
+lea L58, r4
+jmp L100
+prn #-181
+inc r3
+L138: inc *r5
+add r1, r7
+L139: rts
+not *r6
+
+prn L43
+dec L37
+lea L107, r0
+clr L26
+prn *r2
+L140: .data -576, -154, 54, -899, -105, 173, -216, 609
+; comment
+prn L31
+jsr L111
+cmp r5, *r5
+stop
+rts
+L141: prn #-8
+L142: lea L39, *r7
+L143: bne *r4
+L144: jmp *r5
+sub #18, *r1
+sub #121, r4
+cmp *r6, #10
+L145: not L48
+L146: .string "sutgtmifipzksmrde"
+L147: mov #204, *r7
+prn #-222
+L148: .string "geccaf"
+clr L52
+L149: stop
+L150: not r2
+L151: .string "vg"
+sub *r7, *r6
+dec r5
+add #143, r3
+L152: sub L100, r3
+L153: cmp r4, *r0
+
+L154: mov L147, r7
+L155: cmp r6, L79
+inc *r1
+add L22, *r1
+jmp L18
+stop
+L156: .string "cish"
+add *r0, r7
+stop
+dec r4
+L157: .data 137, 22
+L158: red *r3
+not L110
+inc *r5
+L159: .string "rixoghwjsrvjezqr"
+red L92
+L160: red r4
+mov L46, L87
+inc L23
+L161: red *r6
+dec r7
+L162: .data 555, 271, -188, -619, 922
+L163: .data -455, -739, -714
+cmp *r2, L48
+L164: .string "p"
+L165: stop
+L166: inc r4
+L167: .data -286, -136, -830, 205, 162, 493, -50, 375
+prn r5
+lea L76, *r6
+lea L138, *r2
+cmp r0, r5
+lea L155, r1
+bne L32
+bne L40
+L168: red r5
+sub r5, r0
+L169: mov L38, *r3
+
+jmp *r2
+sub *r2, *r7
+L170: clr *r2
+
+dec r6
+inc L170
+cmp #107, r5
+clr r6
+L171: .string "jfswlscwrcalacjmcvaeyxn"
+inc L141
+bne L126
+stop
+rts
+L172: red r5
+inc r4
+mov r2, L4
+inc r6
+; comment
+mov #-35, r3
+rts
+L173: .data 802, -434, 944, 376, -609, 207, 31
+
+cmp L173, #-48
+inc r2
+bne L4
+jmp *r5
+dec L100
+; comment
+jsr *r3
+L174: prn r7
+dec r4
+
+add L68, L82
+L175: clr r4
+sub #-189, r1
+dec *r3
+; comment
+L176: .string "bnqxyunvkdklfklwosqjbmk"
+L177: .string "jmydemrkogmcrq"
+lea L113, r4
+red r1
+L178: cmp L114, *r5
+red L55
+L179: .string "fnmkyt"
+clr L10
+L180: .data -850, 360, 695, -718, 754
+bne L157
+mov *r2, *r3
+jsr *r1
+L181: mov r6, r6
+; comment
+red L69
+stop
+L182: .data -221, 169, 387, 582, 117
+L183: clr L111
+sub *r3, r6
+L184: mov *r1, L0
+L185: dec r1
+L186: sub L157, r7
+L187: cmp *r3, *r1
+L188: add #4, *r0
+L189: not *r7
+L190: rts
+red *r6
+L191: stop
+lea L15, r6
+not *r2
+prn L20
+jsr *r2
+mov *r7, r0
+sub r3, r5
+dec *r7
+stop
+L192: red L171
+add *r4, L148
+jmp *r7
+L193: clr *r1
+prn #-15
+prn L17
+clr *r2
+L194: red L116
+L195: dec L118
+lea L165, L120
+lea L189, L173
+L196: cmp L94, *r5
+L197: jmp *r0
+; comment
+inc r1
+jmp L162
+add *r6, *r0
+L198: .string "igqspevdju"
+L199: sub *r6, *r5
+dec *r6
+rts
+jmp L11
+red L2
+mov L13, r2
+L200: mov *r3, *r5
+dec *r7
+not *r7
+L201: prn r4
+cmp *r5, r4
+mov L165, L111
+L202: .string "uuuysqdkbpxpkfmqbeweohh"
+mov r3, *r1
+cmp *r3, L130
+jmp L133
+add L161, L169
+mov *r7, r1
+red r2
+L203: bne L0
+L204: .string "dfppyhbstaz"
+
+clr r3
+L205: stop
+L206: clr r2
+L207: bne L61
+L208: sub *r3, *r6
+clr *r4
+; comment
+add L62, L19
+L209: .data 359, 370, 86
+not L167
+L210: dec *r3
+mov #-44, *r2
+red *r1
+L211: .string "wqbjbzrztvaasodjznvpou"
+sub L23, r4
+cmp *r3, #151
+prn r1
+sub *r0, r0
+L212: rts
+L213: not L46
+bne *r3
+sub #-178, *r0
+add *r7, L27
+L214: clr *r4
+L215: rts
+clr *r5
+L216: red *r0
+L217: .data 694, -132, 157, 940, -841
+red L40
+L218: jmp L118
+L219: .data 393, -915
+add #98, r7
+lea L197, *r4
+L220: inc *r4
+L221: not *r1
+; comment
+L222: rts
+L223: prn L221
+jsr L6
+L224: dec r0
+lea L104, *r6
+L225: .string "zwkbceaghpns"
+rts
+rts
+prn *r2
+mov L129, L74
+L226: stop
+bne L77
+L227: prn L61
+red *r6
+stop
+L228: prn r2
+L229: mov #-45, L4
+L230: clr r1
+mov L114, r0
+prn *r2
+L231: not r0
+L232: .string "jjfoarpqvkb"
+red *r6
+sub *r3, *r2
+red L104
+jmp *r0
+jsr *r6
+prn *r3
+jmp L141
+red L51
+L233: lea L54, r3
+L234: .string "wxpeakrabouagtiiqods"
+jmp L66
+L235: red *r6
+rts
+add r6, r1
+L236: .string "rnshkq"
+
+sub #-173, r1
+L237: .data -26, 977, -340, 538, -267, 146, 762, 913
+L238: not L77
+mov #81, *r2
+cmp #26, r5
+L239: prn L143
+jmp *r3
+rts
+jmp L114
+rts
+stop
+L240: red r7
+L241: dec L111
+add *r7, *r1
+inc *r1
+
+jmp *r2
+prn r3
+cmp #136, r5
+mov *r0, L115
+lea L6, *r0
+L242: bne *r1
+inc r0
+L243: mov L35, *r0
+mov #-3, L163
+dec r2
+stop
+not r1
+L244: rts
+jmp *r0
+bne *r4
+L245: inc L43
+; comment
+L246: prn #-184
+L247: .string "dkemdugk"
+prn *r6
+L248: stop
+L249: clr r1
+red *r4
+red L201
+mov #10, *r3
+rts
+L250: stop
+add #-193, *r2
+jsr *r6
+stop
+prn r1
+L251: lea L126, r0
+L252: inc L149
+; comment
+L253: not *r5
+L254: sub #183, *r0
+dec L74
+L255: red L229
+L256: not *r5
+inc L101
+dec r3
+sub r4, *r4
+L257: stop
+cmp L8, #11
+L258: inc *r1
+L259: lea L227, *r7
+L260: bne *r3
+mov r4, L155
+inc L33
+jsr *r6
+L261: .data -114, -720, 943, 261, -646, 708, 879
+not r3
+L262: cmp *r6, r5
+L263: red *r4
+L264: not *r0
+rts
+lea L26, r4
+L265: .data 439, -679, 426, -312, 361, 26, -137
+add r1, r5
+L266: .data -738, -602, 476, -963
+jsr *r6
+L267: sub #-254, L219
+lea L126, L174
+L268: red r0
+add r3, *r7
+L269: sub #43, L115
+dec *r1
+add L117, *r5
+dec r0
+inc r3
+L270: bne *r4
+mov *r6, r7
+lea L103, *r1
+rts
+dec r7
+add L163, r1
+inc L164
+L271: .string "sydnflwjfamgocuasnjjmkyz"
+lea L235, r3
+dec r7
+L272: .string "mvpshmwnuyguzplnux"
+L273: prn r1
+L274: inc L7
+inc r4
+red L204
+rts
+prn #-129
+L275: .string "pclhsmeng"
+L276: .string "byxjnhhfxtanexfiersnr"
+red L11
+rts
+L277: stop
+mov L235, L115
+sub r4, L170
+L278: bne L200
+bne L49
+L279: .string "bfiduekepzvusl"
+not r4
+not L236
+dec r4
+jmp L161
+prn *r7
+add *r1, r2
+L280: sub L269, r5
+clr L156
+L281: add #-224, *r0
+sub L155, *r5
+rts
+jmp *r3
+jmp *r1
+L282: red r4
+L283: sub *r4, L171
+; comment
+lea L184, L176
+cmp r2, *r0
+jsr L138
+L284: jmp L103
+dec L272
+L285: jsr *r5
+L286: .data 31
+sub L74, r3
+red r6
+L287: bne L113
+sub *r3, L4
+mov L244, *r4
+L288: lea L248, r1
+clr r3
+bne *r2
+jmp *r3
+L289: dec r4
+add #-35, r1
+lea L149, L16
+inc *r7
+
+prn #185
+prn L99
+L290: dec *r6
+cmp r4, r3
+L291: jsr L233
+clr r4
+jsr L111
+not *r3
+inc *r3
+L292: stop
+dec L118
+L293: clr L11
+L294: add #167, r2
+prn L240
+L295: stop
+add #122, *r0
+bne *r0
+jsr L289
+L296: prn #209
+L297: .string "llqrwxqo"
+stop
+cmp L218, r3
+inc L70
+L298: .data 585, -305, 327, -710, 904, 330, 855
+L299: .data -325, -126, -753, -666
+inc *r5
+L300: bne L212
+L301: dec L111
+prn #-26
+L302: prn L213
+L303: mov L54, L148
+rts
+prn *r1
+red *r0
+mov r2, *r6
+sub r7, r0
+; comment
+clr r5
+rts
+sub #-63, r6
+add #181, r5
+add L278, L120
+rts
+L304: jsr *r6
+mov r5, *r7
+cmp #68, r1
+L305: .string "rpucnphvkbmewxfuqvqvpx"
+clr *r0
+stop
+L306: prn r7
+bne *r1
+add *r7, L31
+L307: inc *r2
+bne L66
+bne L14
+red *r2
+sub *r4, *r1
+mov r5, L193
+inc *r0
+mov L64, L126
+clr r6
+L308: mov L50, r6
+inc *r4
+L309: red r0
+clr *r3
+bne *r0
+L310: prn L229
+add r4, *r0
+jsr *r0
+mov r5, r1
+inc *r6
+prn L159
+L311: mov *r7, *r7
+jsr L81
+jmp L273
+; comment
+dec r2
+jsr L94
+L312: sub L30, *r7
+L313: lea L174, L40
+L314: stop
+rts
+red *r5
+clr L184
+jsr L53
+L315: jmp L213
+sub #-66, L234
+add #32, *r5
+inc L190
+L316: rts
+inc r4
+cmp #-111, L61
+lea L103, *r6
+L317: .data 593, 860, 125, 760
+lea L169, *r1
+; comment
+prn *r5
+L318: .data 746, 6
+L319: jmp L231
+red *r3
+red r4
+prn *r1
+L320: add *r7, L66
+bne *r1
+not L181
+sub L45, L243
+red r0
+inc *r6
+rts
+clr *r5
+mov L192, L132
+cmp r7, r7
+L321: jsr L157
+prn #19
+L322: lea L168, *r6
+L323: .string "wcnynriifkxdsrbiidqtvm"
+add r0, r5
+add r1, L190
+
+L324: cmp L294, #146
+
+inc *r6
+lea L310, *r7
+not *r4
+
+prn r3
+prn #68
+inc *r7
+L325: .data 87, 356, 990, -864, 999, 296, -592, -114
+jsr *r0
+bne L283
+L326: stop
+cmp #-52, r4
+L327: stop
+L328: prn r6
+cmp L259, #-107
+jsr L313
+L329: jmp *r7
+jmp L1
+inc r2
+stop
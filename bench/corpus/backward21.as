@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 22
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: clr *r5
+bne *r4
+jmp *r6
+L1: .string "jjkxe"
+prn L0
+L2: red L2
+L3: jsr *r2
+L4: jmp L3
+
+clr r6
+; comment
+red L2
+red *r6
+L5: prn L0
+L6: dec r5
+mov L6, *r5
+L7: sub r6, r7
+L8: inc r6
+L9: .data -850, 752, 798
+jsr *r5
+stop
+L10: .data -411
+L11: mov r0, L1
+L12: bne *r6
+L13: red *r6
+not r2
+bne L11
+L14: inc *r2
+inc *r6
+not L9
+bne *r7
+; comment
+add r7, L1
+red r6
+sub r2, *r4
+stop
+jmp L7
+L15: prn *r0
+prn r5
+bne *r5
+L16: not L9
+lea L9, L6
+bne L10
+L17: mov *r0, L14
+L18: dec *r1
+L19: bne *r3
+L20: .data 685, -802, -303, 145, 583
+not r3
+
+lea L7, L14
+jsr *r2
+L21: jsr L20
+add #-94, L9
+prn L16
+L22: .string "it"
+; comment
+L23: red *r0
+red *r3
+jmp L1
+add L20, *r3
+jmp L19
+lea L4, L13
+sub #-84, r5
+L24: add *r0, L18
+
+prn r4
+jsr L7
+L25: mov r5, *r6
+bne *r6
+L26: jsr L20
+L27: .data -373
+cmp r6, #-109
+stop
+not r7
+cmp L3, L25
+L28: not L28
+bne *r5
+L29: lea L8, L8
+L30: clr L17
+L31: .data -817, 920
+jmp *r2
+inc r6
+jmp L29
+cmp L28, r4
+clr L10
+mov L28, *r5
+clr r6
+stop
+cmp r0, L30
+jsr L22
+prn L11
+bne *r1
+stop
+dec r6
+L32: stop
+inc L12
+rts
+cmp *r3, *r7
+jsr *r4
+inc L20
+L33: prn #69
+stop
+L34: rts
+; comment
+; comment
+jmp *r0
+L35: lea L18, *r4
+rts
+L36: rts
+sub #58, L20
+jsr L7
+jmp *r3
+cmp L19, r4
+L37: clr r3
+dec r5
+L38: prn L14
+L39: mov #189, *r1
+clr *r5
+L40: rts
+L41: bne *r6
+red r6
+red L10
+prn #-196
+L42: .data 915, -416, -204, -226, 286, 586, -850, 562
+L43: mov L0, *r3
+prn r4
+L44: inc r5
+L45: mov r3, *r2
+L46: clr *r3
+prn r7
+L47: not *r7
+L48: inc *r1
+jsr *r2
+L49: .data -374, 851, -875, -833
+L50: prn r3
+clr *r4
+cmp r6, *r5
+L51: add L33, L47
+jmp L43
+stop
+jmp *r2
+mov #-52, L7
+bne *r6
+L52: jmp *r3
+L53: add #97, L12
+lea L48, r4
+lea L40, *r0
+jmp L20
+stop
+cmp *r0, *r3
+L54: .string "uxgqbrblydmoigtdotz"
+prn *r1
+lea L3, *r1
+lea L19, r7
+L55: mov *r2, r6
+L56: inc *r7
+
+prn #-185
+stop
+L57: .string "vnkef"
+L58: stop
+clr L21
+jsr *r7
+not L50
+sub #-82, *r0
+clr r0
+L59: inc L53
+L60: stop
+; comment
+jmp L48
+bne *r3
+cmp L55, *r5
+L61: prn L16
+L62: mov r4, *r6
+dec L59
+jsr *r7
+L63: .string "br"
+prn #158
+sub *r4, r1
+jsr L23
+L64: sub r0, r6
+L65: .data -802, -151, -47, 384
+L66: mov L11, L26
+rts
+; comment
+L67: prn L64
+L68: cmp L54, *r3
+L69: mov #150, r0
+clr r3
+clr *r2
+clr L55
+sub r1, r3
+red L5
+L70: .string "vwgmfga"
+cmp *r7, *r1
+L71: not L35
+L72: .data 840, -905
+L73: sub r2, *r3
+inc *r3
+; comment
+not r7
+L74: clr L28
+bne *r0
+not *r6
+jmp *r6
+sub r1, r4
+L75: inc L10
+jmp L53
+inc *r2
+add #-147, L40
+inc *r4
+L76: lea L13, *r1
+lea L7, *r7
+bne *r4
+inc r4
+
+L77: inc L20
+L78: .string "urhr"
+red L7
+cmp r4, #171
+sub #133, *r7
+clr r2
+bne L13
+L79: rts
+sub #-2, r2
+
+add #-74, L74
+L80: .data -671, -891, 728
+not r3
+rts
+add L72, L65
+L81: rts
+inc L23
+prn *r4
+rts
+cmp r3, L4
+cmp r2, #-89
+rts
+L82: red L71
+sub #-27, r4
+L83: mov #218, *r7
+inc *r0
+inc r1
+red L44
+jsr *r5
+not r5
+jsr L11
+L84: .string "nstce"
+add #163, *r1
+L85: red L80
+stop
+L86: rts
+L87: bne L86
+cmp r3, r6
+; comment
+L88: sub L26, r4
+dec r0
+prn L58
+prn *r1
+mov #101, *r1
+L89: .string "dtcqhr"
+rts
+rts
+sub #-216, *r4
+L90: cmp #-205, L49
+dec L54
+L91: stop
+L92: .data 621
+L93: dec r4
+clr L76
+inc r5
+sub r5, *r5
+add r3, L42
+L94: clr *r7
+mov *r4, *r0
+mov *r7, L51
+bne L81
+prn #-42
+cmp L49, *r4
+rts
+L95: cmp L60, r6
+stop
+L96: cmp r5, r7
+clr L63
+L97: lea L44, L20
+clr r3
+mov L70, L39
+dec *r4
+
+L98: prn #94
+L99: jsr *r1
+sub r5, *r0
+L100: .string "w"
+add L38, *r3
+add *r1, *r6
+L101: .data -204, -279
+red L50
+lea L96, *r7
+mov r2, *r7
+; comment
+red *r7
+jmp *r4
+; comment
+L102: clr L99
+inc *r0
+L103: prn #119
+L104: not r3
+rts
+dec r1
+sub #69, r6
+sub r3, *r5
+bne *r1
+; comment
+L105: stop
+not *r6
+dec L94
+stop
+prn L45
+L106: stop
+jmp L72
+red L8
+inc L96
+jmp L9
+L107: not r4
+L108: prn #182
+lea L42, r5
+stop
+L109: inc L88
+L110: prn r0
+L111: jmp *r6
+L112: mov r7, *r4
+lea L57, L46
+cmp L100, *r0
+dec r0
+mov #-220, L38
+add *r4, L19
+cmp #-91, *r7
+jmp L72
+rts
+not r1
+L113: inc L64
+L114: jsr L63
+L115: not *r5
+bne *r6
+red L82
+sub *r4, *r5
+rts
+red r7
+L116: .string "uuyfyssvstvyganu"
+sub r7, L69
+L117: rts
+sub L65, L94
+sub *r3, *r4
+L118: add *r2, *r0
+L119: mov L29, L86
+prn #-81
+L120: .data 95
+red *r0
+bne L17
+add r7, r2
+clr r3
+rts
+dec r7
+jsr *r3
+L121: red L4
+mov #-184, L63
+L122: .data 13, -591, -758, -723
+prn *r4
+; comment
+dec r2
+L123: bne *r2
+L124: .data 730, 166
+L125: jmp *r1
+lea L101, *r7
+L126: .string "ijjccg"
+sub #104, L88
+L127: prn L100
+L128: .string "ivumo"
+add L117, L61
+
+stop
+L129: mov #211, r6
+L130: cmp r1, *r7
+clr L19
+rts
+
+dec *r6
+mov #65, r0
+cmp #179, L17
+bne L45
+clr *r6
+L131: .string "owycygmtsf"
+cmp #-137, *r3
+jmp L68
+lea L77, *r4
+L132: clr *r0
+lea L109, r6
+red *r6
+L133: stop
+L134: .string "m"
+not *r0
+
+jmp *r3
+prn #231
+L135: dec r1
+L136: prn L13
+not r0
+dec *r6
+prn L27
+L137: .data 304, -50, 872, -78, -131, 164
+L138: red r4
+L139: .string "cmverkoswnvdfbiz"
+not L80
+inc *r0
+add *r5, *r5
+inc r0
+add L85, *r5
+mov r2, *r7
+L140: not r1
+L141: stop
+
+mov *r3, r4
+L142: jmp *r1
+mov L140, r4
+jmp *r6
+not L9
+inc r5
+lea L100, *r0
+rts
+cmp L8, #-118
+add *r7, *r4
+cmp *r0, L121
+L143: .data 75
+jmp L112
+L144: rts
+bne *r2
+L145: jmp L132
+prn #197
+L146: lea L146, *r5
+dec L101
+add *r3, r1
+cmp L91, r2
+L147: mov L125, r0
+rts
+mov *r2, *r7
+cmp r2, *r2
+bne L41
+L148: jsr *r1
+L149: lea L62, L34
+cmp r7, L100
+stop
+
+
+L150: add *r1, *r7
+lea L78, L21
+jmp L118
+clr r0
+bne *r2
+sub *r4, *r5
+stop
+inc L150
+cmp r5, *r5
+L151: bne L7
+cmp *r3, r3
+cmp *r2, L31
+L152: add L0, r4
+lea L25, L96
+clr *r0
+L153: .string "jphraaejwvxspcikpvzikcmr"
+cmp *r0, *r2
+stop
+jmp L29
+L154: .data 230, -950, 803, -131, -427, -358, 75, -625
+
+not r5
+L155: rts
+; comment
+L156: prn *r5
+add #159, r7
+L157: .data -145, 366, -996
+bne *r5
+L158: .string "b"
+jmp *r6
+red L15
+not L15
+L159: mov *r3, *r7
+L160: .string "imrdjzdsdwwkvldlosdhslcy"
+sub *r6, L120
+; comment
+stop
+L161: prn *r2
+inc L3
+L162: jmp *r2
+L163: not r1
+L164: .string "hqpvydx"
+red L11
+jmp *r1
+inc L84
+L165: .data 602, -654
+sub r5, *r1
+L166: clr *r2
+clr r1
+prn L139
+L167: mov #72, r0
+inc r5
+; comment
+L168: lea L147, L29
+L169: rts
+stop
+L170: .data 729, 495, -965, 856, -923, 140
+dec L46
+L171: add #127, r3
+jsr L110
+L172: .data 464, -537, 809, -133, -686, -571, -962, 973
+sub L105, *r0
+sub *r1, r3
+jmp L143
+rts
+L173: sub *r1, L60
+L174: bne *r7
+L175: cmp r3, L103
+cmp L121, #-58
+jsr L98
+L176: rts
+rts
+add #-89, L19
+bne *r1
+stop
+stop
+rts
+mov L45, r5
+; comment
+L177: .data 209, -53, 797, 16, 424, -82
+cmp #-188, L151
+L178: jsr *r3
+
+jsr *r5
+prn *r0
+clr *r6
+lea L165, r3
+not *r7
+L179: prn #-95
+cmp L58, *r0
+L180: rts
+lea L111, r0
+sub r2, r6
+jsr *r3
+L181: prn #-96
+mov L140, r3
+bne L10
+red r7
+L182: jmp *r4
+L183: stop
+L184: prn L108
+inc r2
+L185: .string "xdgnuyydevlabifymevgztl"
+dec *r0
+not *r7
+mov r7, *r7
+L186: clr L124
+jsr L132
+L187: not r6
+dec r3
+L188: inc r7
+L189: prn *r3
+jmp *r7
+prn #-110
+sub L165, r6
+
+cmp L61, r1
+cmp *r7, r5
+L190: cmp *r2, #-153
+clr *r4
+cmp *r0, *r7
+cmp #171, r3
+sub *r3, *r5
+bne L174
+prn L174
+bne L141
+L191: prn #236
+L192: sub *r1, L11
+cmp L70, r0
+dec *r0
+red L13
+cmp #69, #7
+inc r3
+L193: rts
+stop
+mov r6, *r7
+bne L151
+cmp r3, L114
+not *r6
+dec *r2
+jsr L187
+bne *r4
+clr *r7
+inc *r5
+L194: red L162
+L195: bne L12
+L196: add r2, L194
+prn L196
+L197: not r7
+stop
+L198: lea L68, L138
+stop
+bne *r2
+
+L199: sub L70, *r2
+L200: sub #211, *r5
+L201: clr L21
+lea L87, *r4
+jsr L119
+L202: .data -715, -776, 79, -803, 845, -396, 557
+stop
+L203: inc L63
+L204: bne *r7
+L205: .data 731, 164, -716, -154, 52, 548
+
+mov L168, *r3
+rts
+L206: cmp L140, r0
+L207: .data 885, 578, -635, 356, 629
+prn #44
+sub L69, *r0
+jmp L110
+sub r0, *r0
+bne L46
+stop
+jmp L179
+jsr *r5
+L208: .data 954, -524, -432
+L209: clr r1
+prn #-10
+add *r4, r0
+rts
+L210: jsr *r1
+mov #107, L187
+inc L169
+cmp *r3, #42
+L211: .string "sfbwzvhvuivqpsxrzhm"
+; comment
+prn #214
+rts
+mov *r7, L114
+L212: .data -773, -942
+not r5
+dec L132
+prn *r2
+L213: stop
+
+prn *r4
+clr r1
+red r5
+bne *r5
+bne *r5
+mov *r5, *r3
+add r4, r5
+L214: .string "jsnwvbbknwho"
+L215: .data -397, 900, -318, 181, 284, 527
+L216: add *r3, r3
+L217: .string "zdfxjbpeb"
+lea L24, r0
+jmp *r1
+jsr L89
+dec L152
+L218: clr *r4
+jmp *r6
+L219: rts
+dec *r0
+cmp *r3, r7
+rts
+red r4
+L220: prn *r4
+
+L221: stop
+cmp L60, #128
+; comment
+prn #41
+; comment
+; comment
+add *r4, L188
+prn L133
+rts
+jsr L188
+L222: .data 298, -143
+L223: .data -556, -651, -359
+dec *r1
+clr r5
+sub *r1, r2
+L224: rts
+cmp *r2, *r0
+red L27
+lea L14, *r1
+sub r7, r4
+inc r1
+bne L180
+L225: jsr *r4
+L226: red L197
+L227: .data -269
+inc r2
+jsr *r3
+add L109, L21
+mov L182, *r6
+L228: not *r1
+L229: prn #-191
+L230: lea L179, *r6
+L231: jsr *r5
+L232: .data 12, -624, -550, -704
+mov #245, L111
+jmp *r4
+L233: .data -1, -141, -564, -33, -573, -154
+cmp #-30, #-20
+cmp #91, r0
+red L57
+L234: not *r6
+rts
+inc *r7
+add L27, L228
+L235: .string "oghndpgmqmyizxzgtv"
+red r7
+L236: .data -292, -897
+dec L181
+L237: not *r5
+L238: jmp *r4
+L239: sub *r3, L93
+red r5
+sub #171, L168
+L240: rts
+sub *r6, L96
+L241: .data 572, 846
+add L117, L24
+; comment
+cmp #58, r0
+dec r5
+L242: mov #-86, r3
+L243: add L15, *r3
+L244: lea L57, r5
+L245: jmp L118
+L246: .string "qputexjyoc"
+cmp *r3, L235
+L247: add L153, L58
+L248: sub L147, L86
+stop
+L249: lea L45, L245
+stop
+L250: stop
+L251: .data -204, 126, -382, 720, -911, -711, 403, 848
+lea L127, r5
+sub #-109, *r3
+jsr L206
+L252: .string "uzuprykk"
+jsr *r3
+L253: dec L219
+mov L251, r1
+; comment
+inc r4
+L254: .data 769, 122, -376, -790, -901, -860, 971
+; comment
+L255: .data 286, 41, -652, 922, -124, 432, 131
+not L144
+bne L215
+L256: add #-129, *r2
+jmp L76
+inc r3
+lea L111, r6
+L257: sub r1, r3
+; comment
+L258: lea L13, r2
+red *r7
+clr r6
+inc r0
+rts
+dec r5
+; comment
+L259: bne *r4
+prn #-18
+jmp L225
+cmp *r5, #226
+rts
+L260: .string "whdstmtdln"
+L261: .data -987, 825
+L262: inc *r6
+not r0
+cmp L148, #105
+red L161
+L263: not *r0
+bne L65
+add #155, *r3
+inc *r6
+L264: clr L216
+L265: .data -812, -453, -506, 19, -506
+not r5
+L266: .data -454
+sub #173, L149
+jsr *r5
+lea L87, r1
+stop
+red r1
+jmp L219
+L267: .data -305
+L268: .data -596, -346, 458, 547, 34, 617
+rts
+jsr *r5
+sub *r3, *r3
+stop
+prn *r7
+bne *r2
+jsr *r2
+dec L68
+bne L263
+add *r3, r3
+
+L269: prn *r6
+jmp L0
+L270: jmp *r5
+L271: dec r3
+L272: inc L76
+L273: .string "hhbtmhnybpbmvsmcarwd"
+red *r7
+not r4
+
+L274: prn L44
+L275: rts
+L276: prn r0
+jmp L22
+
+jsr *r0
+L277: .string "rlfdvxeffnhvd"
+sub *r6, L204
+L278: jmp L122
+L279: stop
+L280: red r0
+L281: inc L277
+sub *r7, r3
+L282: .data -833, -523, -73, 682
+prn *r3
+red L89
+inc r3
+rts
+add *r1, *r5
+L283: .data 484, 216, 210, 639
+red L186
+L284: .string "yaecbbvzftoiheimn"
+stop
+not L177
+bne *r6
+rts
+rts
+red L226
+cmp r4, *r2
+L285: red *r6
+L286: bne L107
+cmp #190, *r0
+; comment
+mov #-256, L183
+dec *r0
+not L135
+
+sub L272, L196
+sub L249, *r5
+L287: .data -898
+L288: add L128, *r7
+L289: .string "gyhyjgaogy"
+not *r1
+rts
+L290: stop
+L291: mov #95, L205
+L292: inc *r2
+L293: mov L41, r6
+inc L18
+not *r3
+L294: inc *r0
+
+mov L198, L97
+L295: cmp L38, r4
+rts
+L296: jmp *r3
+red *r0
+L297: lea L190, r1
+L298: stop
+L299: inc r5
+rts
+bne *r0
+
+clr *r0
+dec L111
+inc L244
+red L29
+add #-25, *r5
+red r4
+not *r2
+inc L4
+red L153
+inc r2
+cmp *r7, L22
+L300: add *r4, r1
+L301: jmp *r6
+inc r0
+; comment
+dec *r1
+dec r4
+L302: dec *r6
+L303: mov *r0, L262
+rts
+add #-48, r7
+inc *r4
+
+jsr L20
+lea L30, L287
+L304: .string "emlscblguovkawemmjemc"
+jmp *r4
+L305: cmp r6, L173
+add #-147, r4
+mov L247, L290
+not *r5
+jsr L16
+L306: lea L158, r2
+L307: sub *r0, L173
+L308: .data -412
+inc r1
+L309: prn *r7
+L310: lea L217, L118
+L311: rts
+lea L180, r0
+jmp *r7
+L312: add L274, L28
+mov r0, r0
+mov *r2, r4
+mov #-252, L7
+L313: prn L65
+jmp *r7
+not r7
+inc *r2
+L314: prn r7
+mov *r0, L7
+jsr L65
+sub *r6, r3
+L315: .string "ybyiaejtndjiv"
+dec *r1
+L316: prn #-63
+inc L282
+L317: cmp #-117, *r7
+dec L240
+add L93, r6
+L318: clr *r3
+L319: jmp L286
+L320: mov r6, r6
+L321: clr *r1
+prn *r1
+sub *r2, L124
+not r6
+dec r0
+L322: sub L130, L76
+inc *r2
+not L243
+sub *r3, *r0
+L323: lea L108, L54
+L324: red *r5
+cmp *r6, *r6
+L325: .data -980, -495
+add L290, L82
+inc r7
+inc *r6
+L326: dec *r5
+stop
+lea L124, *r0
+L327: sub L137, *r5
+jsr L253
+clr *r6
+sub r0, L133
+L328: .string "nsnzzxdgzbohawfzptu"
+dec *r2
+L329: cmp L207, r3
+lea L183, *r1
+L330: sub L227, L269
+jmp L122
+red r6
+not L217
+L331: prn #116
+prn r4
+L332: clr L283
+L333: .string "k"
+L334: rts
+dec L66
+mov L25, r3
+jmp L271
+stop
+
+red L203
+L335: stop
+
+cmp #-234, r7
+; comment
+L336: red *r4
+sub *r0, *r0
+red *r4
+dec *r4
+cmp *r1, #246
+inc *r4
+mov r0, r1
+stop
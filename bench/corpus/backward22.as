@@ -0,0 +1,1023 @@
+; Generated by genCorpus --seed 23
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+dec L106
+add L0, *r0
+cmp r6, r4
+L0: jsr L0
+L1: inc L1
+sub #9, L1
+L2: .string "adkcwbwfpxguwysiajd"
+L3: add L1, r7
+bne *r2
+jmp *r2
+cmp #29, r1
+mov #102, r5
+L4: .data 928
+cmp r4, L3
+jmp *r2
+; comment
+lea L4, L4
+dec r6
+prn #161
+; comment
+L5: .string "sdunyzulcyxzud"
+rts
+not *r4
+L6: clr r7
+sub L4, L2
+lea L5, L1
+red L4
+L7: jmp L4
+dec r4
+red r3
+not *r7
+L8: sub #249, L4
+L9: red L2
+sub #80, r3
+mov #129, *r7
+cmp #78, *r2
+cmp L4, *r5
+cmp r1, #161
+jmp L1
+
+L10: cmp L1, L2
+add #-14, L1
+L11: .data 807
+lea L10, r6
+rts
+L12: inc *r5
+rts
+sub L3, r7
+lea L2, r6
+sub L6, *r4
+L13: add *r4, L2
+red r6
+inc L8
+sub #38, *r4
+clr *r1
+lea L2, L12
+L14: lea L1, r1
+L15: cmp *r6, L0
+L16: dec *r4
+L17: jmp *r2
+bne L16
+mov *r5, *r5
+L18: not r5
+L19: bne L17
+clr r6
+L20: clr r5
+sub L1, *r3
+stop
+lea L6, *r1
+inc r4
+cmp *r1, *r1
+L21: red r2
+sub L20, r0
+L22: stop
+red L7
+L23: .data 306, -385
+L24: .string "oqxqvylalxefwmjf"
+sub *r1, r4
+L25: .string "vpxuchnodhr"
+inc *r5
+jsr *r4
+; comment
+L26: .string "obpobldlzdrhtgnxnjj"
+add *r7, L10
+lea L20, r0
+mov L0, r0
+mov #247, L6
+rts
+L27: cmp L13, r0
+bne *r7
+clr r5
+; comment
+L28: red r0
+not L2
+rts
+L29: dec *r4
+mov #-108, L9
+L30: red *r1
+cmp L5, #213
+L31: .string "vuw"
+L32: rts
+jsr L8
+jsr *r4
+; comment
+cmp *r6, L19
+not L29
+L33: .data 954
+L34: mov L21, r3
+L35: .string "auxfyadqkuxzjdbefbutq"
+L36: rts
+jmp *r2
+L37: .string "iiaunuwpdgjf"
+clr *r2
+sub L5, L37
+L38: add #-148, *r2
+L39: bne L39
+L40: .string "vaqp"
+prn L1
+L41: .data -738, -286, 232, 574, 794, 508, 194
+L42: mov r7, *r3
+red *r1
+add r4, *r6
+bne *r1
+add L33, *r5
+sub r1, L28
+add L25, r7
+bne L0
+L43: .data -958, -632, 252, 630, 115, 922
+cmp *r0, *r7
+L44: .string "ycpkamnrghspkmz"
+L45: dec r1
+L46: stop
+prn r4
+clr *r1
+jmp *r1
+sub r5, *r2
+L47: sub r1, L3
+bne *r7
+lea L11, *r7
+red r5
+red *r3
+jmp *r4
+dec r3
+inc *r2
+jmp *r7
+L48: rts
+inc *r2
+sub L36, L1
+mov #59, r3
+L49: bne L22
+clr r4
+clr L11
+not r3
+L50: clr *r4
+mov *r1, *r0
+sub *r5, *r3
+jmp L5
+L51: rts
+L52: add r0, L9
+clr r3
+jsr L22
+sub *r7, *r6
+prn *r2
+L53: bne L28
+L54: sub #-83, L48
+mov r0, L38
+not r4
+inc r4
+L55: red *r6
+lea L6, r5
+rts
+add #-182, *r0
+bne *r6
+sub L14, r1
+L56: jmp *r5
+red L40
+lea L38, r4
+L57: .data -733
+L58: dec r4
+L59: mov #-178, *r5
+cmp r6, *r7
+rts
+jsr L49
+lea L2, L13
+; comment
+sub L55, r7
+L60: .string "kjoucjsakrvbhbdfmpgbb"
+bne *r1
+jmp L53
+L61: red r3
+mov #168, L54
+mov L17, r5
+jsr L59
+L62: dec r4
+sub *r2, L16
+bne *r5
+lea L53, r0
+L63: .string "hdwpqyrmqfepmfelqapomqk"
+clr r4
+L64: .data 492, 327, 54, -456, 477
+inc L8
+rts
+cmp L11, r3
+L65: rts
+cmp *r3, *r4
+not L51
+stop
+L66: cmp L41, #72
+prn *r3
+sub *r4, *r7
+jsr L20
+inc *r6
+L67: .data -302
+prn r5
+stop
+clr L33
+add L41, r0
+not *r2
+bne L63
+L68: stop
+jsr L56
+stop
+dec r3
+jmp L61
+cmp *r0, L1
+L69: .string "ibtvdxalojgdvyeiqqomryyy"
+L70: stop
+L71: jsr L35
+bne L38
+; comment
+L72: red *r7
+; comment
+cmp r7, *r3
+L73: red L34
+L74: red L12
+L75: .string "zynbmdnelihpietnvyntsvsu"
+stop
+not r3
+L76: stop
+cmp L38, *r2
+mov r6, *r4
+L77: dec r7
+L78: .string "wrluozlsxraeoppjdnmak"
+bne *r0
+jsr L70
+cmp #25, #137
+dec L58
+L79: clr *r4
+add *r2, L46
+not r6
+bne L15
+L80: add L52, L11
+L81: mov *r5, r0
+L82: rts
+L83: .data -271, -667
+stop
+L84: bne L43
+not *r4
+dec L35
+L85: .string "pbmbttthe"
+cmp L59, r3
+; comment
+L86: inc r3
+L87: jmp *r6
+cmp *r5, r6
+
+inc L3
+sub *r2, r0
+sub #-186, *r0
+jsr L12
+L88: add *r3, r4
+L89: .data -181, 168, 116
+L90: stop
+mov r5, *r6
+jmp *r5
+L91: add *r1, *r2
+dec L50
+cmp #-128, r3
+inc *r6
+; comment
+red L68
+
+L92: .data -395, 25, -202
+dec *r0
+lea L16, *r3
+rts
+bne *r0
+mov r6, *r3
+jmp *r3
+L93: dec L23
+rts
+rts
+jsr L8
+; comment
+L94: .data 822, 34, 191, -585, -782, -616
+L95: cmp *r2, L74
+jmp L6
+L96: dec L5
+clr r2
+L97: jsr L70
+L98: red r0
+jmp *r5
+dec r1
+not r4
+L99: dec *r4
+; comment
+jsr L86
+L100: prn r3
+; comment
+jsr L56
+not r2
+rts
+bne *r5
+lea L50, *r1
+prn L62
+L101: bne *r5
+L102: cmp *r3, *r2
+L103: prn r2
+L104: inc L1
+stop
+add #-55, L99
+dec *r7
+L105: dec L19
+dec *r7
+not *r0
+L106: .data -368, 393, 297
+L107: lea L44, L67
+L108: inc L107
+inc r5
+
+L109: .string "biseoixyasof"
+L110: jmp *r1
+L111: mov L65, *r6
+mov #-42, r2
+rts
+L112: jsr *r3
+lea L68, r7
+L113: .string "alyvieyhx"
+L114: dec L93
+inc L61
+jsr *r2
+cmp L51, L42
+prn #-228
+L115: bne *r7
+red *r7
+L116: rts
+; comment
+L117: mov r2, *r1
+dec L101
+inc L33
+L118: .data -528, -855, -347, 64, -990, -163
+L119: dec *r0
+cmp #-249, *r1
+clr L3
+prn r3
+jmp *r1
+rts
+add r7, r5
+jsr L88
+
+dec r0
+clr r5
+L120: bne *r6
+sub #-129, r1
+dec L70
+L121: sub #6, *r1
+; comment
+inc *r5
+cmp L78, L60
+not r4
+clr L60
+dec L96
+rts
+jsr L73
+mov L68, L17
+add #-210, r2
+inc r6
+rts
+L122: rts
+L123: .string "ydvxidjzdhcewppd"
+jsr L120
+jsr L86
+dec r4
+rts
+L124: dec *r2
+prn #-165
+clr *r0
+L125: clr L64
+red L104
+dec L29
+L126: .data 43, 546, 655, -940
+add r0, r6
+L127: sub r7, L108
+stop
+prn *r5
+inc L119
+L128: rts
+clr *r0
+bne *r4
+jsr L26
+clr L62
+add #107, *r0
+add *r6, L11
+red *r3
+stop
+jmp L12
+cmp #-127, #-244
+L129: not r1
+L130: .data -189
+cmp r6, r1
+not *r0
+L131: bne *r0
+sub r0, *r6
+L132: jsr *r3
+L133: inc r1
+L134: stop
+bne *r3
+L135: red r4
+red L45
+L136: lea L125, L68
+L137: mov *r1, r4
+L138: stop
+jmp *r5
+lea L115, L71
+L139: lea L81, *r3
+clr r6
+mov #200, L1
+L140: clr *r0
+jsr L86
+L141: jmp L128
+L142: bne *r5
+L143: .string "omlmrkunqnjizssbof"
+dec L11
+L144: .data -397, 464, -803, -895, -693, -296, -28, 704
+mov #214, *r5
+sub L13, r2
+red *r0
+L145: add #24, r1
+red L46
+dec r2
+not L13
+stop
+L146: .data -511, 922, 721, 99
+add L51, L73
+jmp *r7
+prn r3
+L147: red L15
+prn L129
+prn r2
+
+L148: .data 11, -381, -668, -194, -903, 131, 12, -909
+prn #-170
+mov *r0, *r3
+not L113
+L149: cmp *r2, *r4
+L150: inc *r6
+rts
+clr r0
+prn L81
+jmp *r7
+lea L46, r7
+prn *r5
+stop
+L151: dec L140
+stop
+L152: .string "p"
+L153: .data -26, -305, 671, -899, -227
+L154: .string "oxixbw"
+mov L17, *r5
+L155: .string "wjpubrclueulm"
+cmp *r4, L36
+sub #217, L46
+L156: jsr L152
+jmp *r2
+dec r5
+cmp r4, L62
+add #39, L55
+lea L11, r0
+cmp #248, r5
+clr L7
+rts
+L157: add #5, *r5
+L158: prn r4
+L159: add r4, r2
+L160: rts
+jmp *r2
+jsr L122
+dec r7
+sub *r5, L126
+L161: stop
+rts
+L162: stop
+L163: inc r0
+L164: cmp r0, *r7
+L165: .data -407, 420, 997, 594, -981, -798
+bne L29
+L166: .data -270, 333, 596, 333, -205, 136
+L167: clr r5
+
+dec r2
+not r3
+sub r3, *r5
+L168: bne L75
+L169: .data 592, 438, -485, 297, -820, 174, -635
+L170: .string "vsnjyihmw"
+add *r2, L116
+L171: .string "lhwzecvbqckckggbcj"
+dec r4
+inc r5
+prn *r1
+mov L58, r1
+jsr L111
+jmp *r7
+; comment
+inc r1
+L172: clr L27
+stop
+L173: rts
+red L90
+cmp *r2, L46
+inc L58
+L174: add r2, *r0
+dec L169
+inc *r3
+L175: lea L84, *r1
+L176: rts
+clr r2
+L177: sub L129, L22
+stop
+L178: jmp *r7
+L179: stop
+lea L137, r6
+prn L1
+clr r1
+bne *r5
+L180: bne *r7
+rts
+L181: rts
+clr r7
+bne *r3
+add #31, r2
+L182: .string "ibjsusuwxqgl"
+jmp L10
+L183: .data -511, -98, -160, -591, 227, -290, 268, -931
+L184: .data -952, -183, 884
+prn #149
+L185: rts
+L186: red L14
+sub L59, *r5
+rts
+L187: .string "thfncddlkhgsvobxdivm"
+L188: rts
+mov r2, L179
+dec r5
+L189: add r2, r5
+lea L158, *r1
+L190: red *r2
+L191: not r4
+L192: .data -791, 695, -939, -104, 637, 405, 803, 877
+prn #183
+L193: sub L137, *r4
+L194: .string "wmvjtfulwhxqtpglwq"
+inc *r3
+L195: prn #-139
+prn r2
+sub r4, L160
+L196: sub r6, r6
+rts
+clr *r6
+L197: inc r3
+dec *r1
+L198: .data -788, 103, 525, 695
+mov L13, r3
+L199: stop
+clr L107
+L200: .data 227, -878, 151
+L201: not r7
+dec L67
+prn r7
+L202: rts
+sub L87, r7
+lea L48, r7
+stop
+rts
+L203: red L96
+bne L183
+prn *r4
+jsr L164
+prn r5
+rts
+bne L82
+red r7
+lea L117, r3
+jmp L129
+L204: not *r0
+inc r0
+rts
+jsr L9
+lea L137, r0
+red *r6
+L205: red r4
+jmp *r7
+mov L54, L139
+mov L124, L189
+inc r1
+dec *r5
+lea L27, r1
+jmp L80
+cmp *r0, L98
+stop
+L206: sub *r2, L45
+inc *r7
+rts
+L207: rts
+; comment
+stop
+cmp L89, #-83
+inc L95
+prn L109
+prn r4
+not r0
+mov #-16, L55
+L208: bne *r6
+L209: .data -267, -415, -885
+L210: add r7, L184
+rts
+cmp #-35, *r5
+L211: red L85
+L212: add L72, r5
+red L158
+clr L172
+L213: .data -982, 43, -118, -861, -144, -533, 681, 174
+add *r4, *r7
+
+sub *r6, *r6
+jsr *r5
+clr L105
+L214: .data -595, 826, 346, -402
+
+inc *r2
+lea L196, *r3
+rts
+L215: jmp *r3
+rts
+sub r7, *r5
+clr L214
+add #244, r2
+bne L19
+inc r4
+bne *r1
+L216: red *r3
+add L57, *r0
+L217: sub #-70, *r0
+L218: .data -36, -721, 495, -150
+cmp #233, *r1
+L219: add #-154, *r0
+L220: rts
+L221: red *r3
+bne L78
+add L220, L110
+add #166, *r5
+inc *r2
+L222: inc r1
+clr r3
+not r3
+prn #-96
+L223: dec L209
+L224: mov #184, r1
+clr *r0
+dec r1
+dec *r3
+stop
+; comment
+cmp #-78, *r3
+L225: mov r0, L138
+bne L1
+L226: add L103, r5
+jsr *r4
+not r1
+sub L144, *r3
+mov *r6, r7
+red r4
+L227: dec L86
+L228: jmp L24
+stop
+dec r1
+lea L25, L173
+L229: mov r4, L64
+not L0
+L230: stop
+
+mov r6, r6
+L231: .data -859, 209, -947, 627, -978, -313, -777, -585
+lea L82, r1
+L232: not L76
+cmp #-227, L54
+; comment
+inc r1
+prn #-62
+cmp r7, L142
+prn r6
+; comment
+jsr *r0
+L233: rts
+dec *r6
+L234: dec r6
+not *r5
+L235: .string "ttjnpmuypyxgntslarz"
+
+lea L45, *r1
+; comment
+rts
+cmp *r1, *r7
+L236: inc r7
+add L177, r4
+stop
+clr r6
+L237: .string "uupnvkoqimaej"
+cmp #191, *r4
+L238: .data -723, 448, -451, -608, -617, 607
+L239: .data 237, -832, -242, -36
+mov L132, L97
+L240: jmp *r0
+L241: .string "vybwi"
+jmp *r2
+
+lea L16, r0
+lea L91, *r5
+L242: red L41
+; comment
+cmp L126, #-10
+clr r7
+bne *r6
+add L152, *r3
+clr *r1
+L243: red *r7
+L244: .data -686, -555, -757, 881
+bne *r1
+L245: .string "zdgyhrpjxb"
+jmp *r7
+lea L53, r4
+mov *r6, *r7
+cmp #-229, r1
+stop
+add *r7, *r7
+red r2
+mov *r2, *r4
+not L133
+L246: jmp *r2
+dec *r3
+; comment
+L247: add L163, r4
+L248: .data -137
+L249: .data -390, 855, 645, -768, 54
+L250: rts
+not L205
+not r0
+L251: sub *r6, L126
+L252: dec *r4
+L253: bne L168
+; comment
+not r5
+not L8
+L254: inc r7
+inc L110
+L255: rts
+L256: .data -517, -861, -267, 729, 373, -652, -412, 306
+jsr *r4
+dec L137
+rts
+sub r1, r1
+L257: mov #195, *r6
+add #223, r3
+; comment
+; comment
+L258: lea L186, L52
+L259: .string "mbadobmrhtmcjuxmqs"
+not *r1
+L260: .string "g"
+L261: cmp #-244, L49
+; comment
+L262: red L14
+mov *r6, r1
+clr r6
+stop
+L263: .string "qnjlqnaaxmogakby"
+inc r0
+jmp *r2
+stop
+L264: cmp #-153, *r5
+L265: lea L253, *r7
+stop
+not *r3
+L266: add *r4, *r1
+lea L250, r5
+stop
+L267: .string "do"
+L268: mov *r3, r4
+L269: inc L213
+prn #66
+clr *r0
+clr r2
+inc L103
+mov r0, L204
+mov #177, r5
+; comment
+dec r1
+L270: not *r4
+rts
+inc r6
+jmp L266
+rts
+mov *r7, L105
+rts
+L271: .data 547, -61, 597, 458
+dec r4
+rts
+red r3
+not *r4
+; comment
+prn #-229
+inc *r3
+bne *r5
+dec *r5
+inc L6
+not r5
+L272: not *r6
+L273: jsr L156
+sub r5, *r4
+L274: clr r4
+L275: .string "jtngxlsmzyrldlft"
+stop
+not r1
+L276: prn #-159
+L277: .data -328, -547, -39, -528, -76
+L278: .data 595, -769, 29
+mov r7, *r1
+L279: .data 763
+L280: rts
+jmp L1
+inc L239
+L281: .string "vmm"
+cmp *r3, #85
+jsr L137
+L282: add #-65, r5
+red r7
+inc L63
+L283: lea L107, r6
+cmp r0, *r3
+lea L8, *r1
+L284: rts
+lea L77, L248
+jmp L235
+lea L265, r1
+sub #-94, r0
+L285: red L87
+L286: dec L240
+; comment
+stop
+clr L114
+L287: rts
+L288: inc *r6
+stop
+jmp L222
+L289: bne L31
+L290: lea L82, L101
+L291: stop
+L292: jmp L31
+not *r7
+bne L76
+L293: .data -123, -525, 772, 314
+dec L279
+L294: stop
+L295: dec *r1
+
+L296: not r2
+red *r4
+red *r6
+inc r1
+stop
+rts
+add #-252, L277
+; comment
+L297: lea L207, r1
+mov *r5, r3
+clr *r3
+bne *r0
+dec r0
+add r7, *r7
+L298: .string "a"
+jmp *r3
+cmp r2, #204
+jmp L186
+rts
+dec *r2
+clr L134
+rts
+L299: stop
+L300: inc r4
+dec r5
+; comment
+L301: stop
+clr r3
+red *r0
+L302: sub r2, L238
+mov *r2, r7
+add r0, *r7
+L303: red L269
+jmp L291
+dec L171
+L304: .data 498, 274
+; comment
+clr r4
+jmp L295
+add #-37, L60
+cmp *r2, #41
+L305: jsr L154
+L306: rts
+add #239, L182
+bne L50
+jsr L7
+stop
+bne L236
+jsr L125
+L307: prn r2
+inc r0
+stop
+L308: add r2, L68
+not L161
+
+L309: inc r7
+jmp *r6
+; comment
+L310: sub #-48, L133
+prn *r5
+L311: .string "cfywwlnaotyecctvbujgp"
+mov *r6, L250
+jsr L12
+sub #-63, *r2
+
+add r1, L114
+L312: lea L56, L58
+L313: add L78, r0
+bne *r3
+mov L7, r6
+L314: .string "csaqppaivjut"
+add L186, *r7
+clr *r6
+rts
+stop
+clr L258
+inc *r2
+mov L45, r4
+L315: dec L202
+L316: red *r4
+add *r3, L316
+rts
+L317: not r0
+mov *r0, *r2
+jsr L294
+not L183
+sub r7, L272
+rts
+jmp L28
+jsr *r5
+L318: dec r2
+rts
+sub #-199, *r1
+mov r4, r0
+mov *r0, *r6
+L319: .data -925, 834, 958, 153, -467, -575, 796, 909
+L320: prn *r0
+mov *r6, r2
+jmp L152
+L321: jsr *r2
+dec r7
+sub L321, r5
+L322: .string "lzhvhhy"
+
+L323: add #167, L309
+inc L221
+lea L82, r6
+clr r3
+not L169
+inc *r1
+
+L324: .string "axjn"
+red L259
+cmp *r6, L152
+L325: dec L247
+mov L108, L237
+jsr L120
+L326: stop
+mov *r7, *r7
+rts
+L327: .string "sdxbxlhcderzvnv"
+sub *r2, *r0
+lea L321, r5
+L328: bne L238
+; comment
+stop
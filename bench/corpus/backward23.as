@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: bne *r5
+bne L0
+not r0
+jsr *r0
+mov *r5, *r0
+L1: dec *r2
+L2: red r7
+L3: bne L3
+; comment
+inc r4
+stop
+L4: .string "icpodsscfi"
+L5: red L2
+bne *r2
+rts
+L6: not *r7
+L7: .string "aimwhpv"
+prn L4
+rts
+inc r3
+L8: red L7
+L9: sub L0, *r4
+add #-213, L7
+L10: .string "oobpehquhmgoctchy"
+
+L11: rts
+L12: rts
+L13: not *r0
+L14: cmp #21, L7
+red r7
+; comment
+L15: .string "oz"
+L16: lea L10, *r7
+mov L4, r0
+jmp *r3
+dec *r5
+not r4
+red L11
+bne *r1
+L17: inc *r3
+red *r6
+not *r5
+stop
+cmp *r5, #-115
+red *r7
+sub *r1, *r2
+cmp *r0, *r2
+inc r1
+L18: mov *r7, *r0
+L19: jsr *r3
+; comment
+L20: jsr L19
+L21: clr *r3
+jmp L14
+L22: red r3
+rts
+dec r4
+clr *r3
+L23: .string "jdjpnwkmvxatl"
+L24: add *r5, r6
+L25: rts
+lea L14, L7
+L26: stop
+add #-119, r7
+rts
+red *r1
+; comment
+lea L3, r0
+red *r0
+L27: lea L9, L16
+clr *r7
+mov r4, *r6
+stop
+prn L18
+L28: inc r1
+bne *r1
+inc L5
+L29: bne *r7
+L30: red L16
+dec *r1
+cmp *r3, r4
+inc *r0
+L31: .data 818, -48, -684
+L32: .data 77
+L33: mov *r3, *r3
+lea L24, L20
+prn #13
+jsr L26
+lea L33, *r7
+prn *r7
+stop
+L34: cmp r7, r1
+lea L15, *r2
+jmp L33
+bne *r1
+red *r0
+rts
+jmp *r6
+rts
+mov *r7, L28
+L35: jsr L12
+dec L27
+L36: jsr *r4
+jmp *r4
+jmp *r5
+L37: .string "yoogwfubvfyxyqffe"
+jsr L26
+prn r7
+jsr *r7
+rts
+L38: not L5
+lea L27, *r0
+L39: jmp *r6
+prn L19
+jmp L27
+L40: prn L9
+mov #24, r3
+stop
+stop
+L41: cmp L22, L10
+clr L5
+stop
+L42: .string "fyibmmmnbz"
+sub *r4, *r3
+inc *r1
+bne *r6
+dec L20
+L43: add L21, r5
+jsr L29
+L44: cmp *r3, r0
+L45: lea L40, L42
+mov r0, *r4
+L46: stop
+not r6
+L47: bne L41
+L48: .string "en"
+cmp #-248, L28
+red L14
+L49: red r4
+rts
+prn r2
+cmp #145, L40
+not r3
+rts
+bne L1
+red L16
+L50: stop
+add *r7, L29
+
+L51: jsr L9
+rts
+add L11, L16
+rts
+prn r3
+clr L9
+L52: inc r2
+clr L2
+not *r5
+add #-211, r3
+stop
+L53: not L40
+add L51, L20
+red r2
+lea L10, r3
+jmp L24
+not r0
+lea L16, L22
+L54: not *r6
+red L25
+cmp r7, r1
+L55: red *r1
+add L33, L42
+L56: sub r4, L22
+cmp L52, r0
+jmp L39
+L57: .data 276
+rts
+L58: stop
+red r3
+L59: inc L40
+
+L60: not r4
+jsr L23
+; comment
+L61: stop
+inc *r5
+L62: lea L7, L30
+L63: .data 25, 569, -291, -67
+red *r3
+L64: dec r6
+L65: dec r3
+L66: clr L66
+bne L66
+L67: .string "djotvmziqwrtxq"
+lea L62, r3
+clr r1
+jmp *r2
+L68: sub L61, r1
+L69: clr r3
+add #-235, L39
+L70: .string "hy"
+dec L29
+
+inc L31
+jmp *r6
+not r5
+red r7
+lea L12, L10
+L71: lea L47, *r7
+L72: sub r5, L42
+cmp #-133, L62
+L73: add *r6, L61
+inc *r3
+jsr *r7
+rts
+add L15, *r1
+clr r4
+rts
+jmp *r7
+L74: .string "o"
+L75: .string "kcw"
+stop
+add L60, *r7
+L76: .data 228, 847, 368, -240, -974, 212, -634, -462
+dec L67
+clr r6
+jsr L6
+L77: .data -511, -593, 668
+L78: inc *r5
+; comment
+cmp r4, *r7
+clr r0
+stop
+L79: clr r0
+prn L19
+L80: red *r2
+L81: .string "nnuztlcxjueozpaadfopgfq"
+rts
+prn r6
+L82: prn *r4
+L83: mov #-214, L18
+L84: .string "dhhwborigkkv"
+L85: .string "hydrfaqgaw"
+add #-203, r7
+L86: clr L19
+cmp #89, L22
+inc L58
+L87: .data -208, -812, -722, -288, 356, 856, 873
+jmp L85
+clr r0
+L88: lea L9, *r1
+L89: jsr L32
+stop
+
+stop
+sub L66, *r2
+bne L4
+L90: jsr L40
+clr L29
+jsr L62
+dec *r2
+L91: jmp *r0
+red L29
+L92: add *r7, L48
+stop
+rts
+jsr L3
+
+L93: add *r4, L52
+; comment
+dec L32
+L94: lea L4, r1
+rts
+rts
+inc *r1
+jmp L41
+cmp L40, L19
+bne *r0
+dec r0
+red *r5
+not r2
+prn L28
+lea L94, *r5
+inc L51
+add L82, r5
+dec *r0
+rts
+L95: not *r3
+
+L96: jmp *r2
+; comment
+prn *r4
+L97: stop
+dec r0
+sub r7, *r5
+L98: .string "ngftpp"
+; comment
+rts
+red r1
+L99: .data -719, 276, -273, -392
+cmp *r1, L0
+add #-19, L51
+add *r5, L2
+L100: cmp *r5, r1
+stop
+L101: clr r7
+L102: lea L47, L91
+lea L3, *r4
+add r3, r0
+rts
+; comment
+rts
+rts
+mov r5, *r0
+bne L47
+L103: .string "dyouefgydpnfacwajfd"
+prn *r0
+prn #150
+L104: .string "hrnaduxshtdkwsz"
+L105: .string "j"
+L106: dec L25
+sub *r7, r7
+not L27
+bne L85
+sub *r7, L24
+rts
+L107: sub *r7, *r3
+L108: .data 681
+L109: jmp *r5
+
+stop
+L110: not r4
+L111: jmp L109
+L112: jsr L37
+L113: .data -760
+L114: mov r5, L42
+mov r7, r5
+L115: .data -919, -207, -237, -655, -546
+L116: dec L110
+L117: inc *r1
+L118: mov L7, L86
+jsr L107
+L119: bne *r5
+inc *r0
+bne *r0
+L120: rts
+add #79, r5
+jsr L15
+jmp L15
+rts
+L121: lea L28, *r4
+jmp *r0
+jmp *r1
+add *r1, L82
+jmp L43
+L122: clr L99
+L123: jmp *r6
+L124: mov r2, L59
+prn r4
+add L45, r0
+L125: prn r4
+bne L26
+bne L4
+sub #-190, r5
+mov L112, r1
+; comment
+L126: bne L126
+L127: stop
+L128: .string "k"
+L129: bne *r6
+L130: stop
+
+not *r7
+L131: lea L44, r0
+
+add r5, L44
+bne *r6
+inc L5
+L132: lea L19, *r7
+L133: .data -515, 834, -576, -7, 26, 627, 217, 635
+not L1
+; comment
+clr *r7
+L134: .data -674, -476
+rts
+L135: dec *r7
+mov L29, r0
+sub #-99, L120
+stop
+clr r0
+L136: lea L59, L23
+clr L125
+L137: sub #178, r7
+jsr *r3
+L138: jmp *r6
+L139: .string "borvmauxjtcgpolfd"
+L140: not *r6
+prn L1
+; comment
+lea L68, r5
+bne L108
+red *r7
+rts
+L141: cmp r4, r4
+L142: .string "mojruocuqkqinnulnz"
+L143: stop
+jmp *r0
+bne L143
+jsr L34
+red r1
+jmp *r5
+L144: rts
+add r0, r0
+L145: red r1
+stop
+lea L99, *r4
+add r4, L22
+L146: inc r4
+stop
+rts
+prn L4
+dec *r3
+L147: .data 321, -37, 637, 739, -720
+mov r2, r7
+L148: cmp #75, #166
+jmp *r6
+rts
+add r7, L54
+not L67
+mov r6, *r7
+inc L141
+L149: rts
+L150: jsr *r1
+L151: add #-85, L46
+clr *r0
+stop
+L152: inc *r1
+L153: prn #-23
+; comment
+L154: prn L13
+L155: prn r0
+prn #247
+L156: rts
+prn r3
+L157: mov L6, L157
+L158: sub r5, r0
+L159: stop
+lea L41, *r1
+L160: add r1, L12
+L161: red r7
+inc r7
+L162: bne L53
+jsr L46
+L163: not r2
+rts
+red *r6
+cmp L137, L85
+inc L63
+L164: .data 839, 22
+sub r5, L77
+jmp *r5
+L165: .data 471
+jsr L79
+L166: not r5
+prn *r1
+L167: .string "pgdpt"
+L168: .string "dbhngrvzspdhvzgvg"
+jsr L159
+red r4
+jsr *r1
+stop
+prn r0
+L169: bne *r5
+rts
+L170: lea L94, *r6
+prn r3
+L171: jsr *r4
+rts
+L172: prn r0
+L173: bne *r4
+add L105, *r1
+stop
+cmp r2, #189
+L174: not r3
+jsr L94
+sub L111, r0
+rts
+L175: .data 874, 916, 945, -833, 292, -924, -24
+prn L24
+L176: dec L116
+L177: bne *r6
+add r1, r6
+cmp *r4, *r0
+jmp L101
+L178: rts
+
+red r3
+not r1
+prn r1
+not r3
+stop
+L179: inc L89
+L180: .string "vgtnapuj"
+jsr L110
+sub *r0, L57
+rts
+L181: not r2
+prn #7
+jmp *r6
+
+L182: .string "jjwazpmgmi"
+L183: dec r0
+L184: .data 886, -156, -277, -321, -544, -890
+L185: cmp L26, L150
+inc *r6
+; comment
+stop
+dec r2
+clr *r7
+L186: jsr *r6
+lea L162, L67
+L187: not *r6
+L188: .data 574, 508
+bne *r2
+L189: .data -468, -80, 671, 935, 170
+clr *r0
+prn *r1
+jsr L89
+L190: bne *r4
+dec L107
+L191: lea L73, r4
+rts
+lea L66, *r4
+; comment
+not r6
+L192: red L30
+cmp #-67, L68
+L193: jmp L44
+L194: .data -806, -809, -910, -447, 12, -529, 344, 503
+L195: jmp *r6
+L196: bne L77
+L197: stop
+; comment
+red L155
+dec L111
+clr *r3
+; comment
+bne L109
+inc *r0
+dec r2
+L198: .string "fuur"
+L199: .data 712, -291
+L200: jsr L50
+prn *r1
+sub #-182, *r2
+lea L43, r7
+cmp L36, r2
+; comment
+L201: .data -370, 187, 190
+L202: .data -557, -529, 790, -361
+L203: lea L88, L144
+prn L199
+red L86
+cmp #195, #36
+L204: jmp L71
+cmp r2, *r7
+add L184, L4
+bne *r4
+sub *r5, L120
+L205: .string "yhalbnlstdvawvjlejwzosx"
+L206: clr r2
+clr r3
+inc L150
+stop
+
+red L149
+L207: stop
+cmp #-158, r1
+L208: prn r2
+cmp #-35, r5
+L209: bne *r0
+dec L179
+L210: stop
+prn *r6
+; comment
+stop
+L211: stop
+L212: red *r5
+L213: prn r1
+jsr L27
+sub L39, L166
+clr r7
+L214: sub r6, *r7
+
+prn L30
+L215: dec r0
+L216: red *r4
+not *r0
+L217: .data 636, 110, 107
+L218: inc *r5
+inc r2
+not L86
+L219: not *r3
+; comment
+L220: not L183
+inc L108
+prn L143
+not r7
+add *r4, r3
+; comment
+jsr L4
+L221: mov r1, r1
+inc L132
+bne *r3
+jmp L180
+lea L133, r1
+mov #80, L90
+rts
+L222: .data 153, 629
+L223: cmp #121, r6
+L224: .string "hofkpnlqmpghxiemtjhsacw"
+sub r4, L80
+mov r2, r6
+
+not r6
+red *r5
+; comment
+add *r5, *r7
+not r3
+lea L74, *r1
+jmp *r4
+rts
+L225: bne *r5
+bne *r7
+prn r0
+mov *r5, L183
+cmp *r5, *r3
+inc L99
+L226: red r7
+jmp *r3
+red *r3
+bne *r7
+add #117, L38
+L227: lea L192, *r5
+L228: add *r4, r2
+L229: not *r1
+mov #158, r6
+red *r2
+inc L13
+L230: clr L80
+
+L231: prn r4
+cmp L210, *r5
+inc r0
+L232: clr *r7
+dec L208
+rts
+stop
+; comment
+L233: .data 368, 296, -48, -503, 484, -645, 803
+L234: sub #-163, r6
+inc L6
+cmp r5, #129
+sub L96, r1
+bne *r0
+prn r2
+L235: .string "hzafwfgk"
+stop
+L236: .data 739, -55, 3, 31, 330, 672, 48
+sub *r5, r3
+dec L34
+L237: bne *r3
+L238: rts
+clr r6
+prn *r7
+bne *r2
+jsr *r1
+; comment
+cmp #-151, r6
+; comment
+L239: prn L127
+prn r0
+sub r6, *r4
+not r4
+add L72, L2
+rts
+jsr L223
+L240: .string "xokpzgvggwchcmidl"
+L241: lea L26, r2
+jsr *r1
+cmp L140, L58
+cmp *r5, r0
+inc *r3
+L242: jmp *r3
+mov L83, L110
+stop
+L243: stop
+prn *r4
+
+clr L27
+L244: .string "hvmd"
+rts
+sub #199, *r2
+L245: .string "cfxrclmub"
+clr *r3
+L246: rts
+lea L102, L99
+L247: mov L204, *r0
+L248: .string "klonylezgpfqqijeefngsdb"
+rts
+L249: .data 229, 370, 165, -900, 645
+mov L243, *r6
+dec *r3
+sub L45, L12
+L250: lea L122, *r1
+dec L120
+L251: stop
+jsr *r2
+prn #3
+L252: rts
+rts
+L253: not r2
+mov *r6, L108
+inc r4
+L254: bne *r2
+prn L166
+L255: cmp r0, #49
+add *r4, *r1
+L256: jsr L124
+inc r5
+; comment
+inc L234
+not *r1
+L257: bne L25
+L258: bne L29
+rts
+lea L223, *r0
+cmp r5, r2
+L259: lea L253, r5
+jsr L180
+mov L120, r0
+L260: .data 484, -579, 93
+clr L116
+L261: dec r7
+add *r6, L243
+L262: bne L168
+prn *r0
+L263: prn *r7
+inc L60
+rts
+not r2
+cmp #135, L240
+cmp *r6, #-160
+
+
+cmp #-170, L42
+red r0
+L264: sub r7, *r1
+stop
+cmp *r3, L137
+prn r6
+lea L26, r0
+stop
+L265: add #-154, L168
+mov *r4, L28
+L266: sub *r1, r0
+rts
+L267: red r1
+jsr *r3
+; comment
+prn r0
+
+L268: lea L41, r0
+L269: prn L88
+L270: red r7
+L271: bne L53
+mov r4, r1
+sub r5, r2
+L272: prn *r7
+L273: .data 97
+L274: rts
+dec *r7
+L275: inc *r0
+red L162
+inc r6
+sub r2, r6
+L276: rts
+dec r7
+jsr L56
+L277: prn r7
+lea L4, r6
+not L167
+L278: .string "jpxnbjotbza"
+L279: lea L197, *r6
+L280: red *r5
+L281: .string "arnusebkrxomqdvqanfddjv"
+not r5
+L282: not *r5
+red r7
+L283: mov *r5, r6
+L284: clr L221
+dec r3
+L285: lea L196, *r3
+not r1
+stop
+L286: add r6, r7
+not L90
+bne L214
+L287: bne L242
+L288: inc L36
+L289: cmp r1, L176
+inc L11
+not r3
+sub *r5, r4
+
+jmp *r6
+L290: mov r1, *r5
+L291: sub #112, *r2
+mov #-153, *r0
+clr r6
+L292: .string "jutglpmydxgmy"
+lea L161, L259
+add #216, *r0
+stop
+lea L265, r5
+jsr *r5
+jsr *r7
+L293: jmp *r3
+mov *r4, *r1
+L294: jmp *r0
+not r0
+L295: clr L161
+inc r2
+L296: inc L161
+L297: .data -201, 153, 451, 86, -375, -187, -75, 540
+L298: red r2
+sub #-205, *r7
+L299: mov #-181, r0
+sub r1, r1
+L300: .data 840, -649
+add L238, r5
+add #-159, *r2
+L301: not L167
+rts
+; comment
+sub r7, *r1
+sub r2, r2
+L302: cmp L66, r4
+rts
+; comment
+L303: prn r7
+not *r2
+L304: .string "iajhpormpfdknxs"
+not *r4
+cmp #-61, L201
+lea L212, L69
+not *r6
+L305: red *r4
+prn #22
+not r4
+L306: .data -86, 516, -83
+red L25
+L307: sub #-79, r5
+cmp L214, L20
+red *r4
+L308: prn L259
+dec L161
+L309: prn L163
+
+dec r3
+L310: rts
+inc L181
+jmp L222
+L311: lea L73, *r0
+stop
+cmp *r4, r4
+mov *r4, *r4
+lea L279, r4
+add r4, *r3
+
+L312: .string "q"
+; comment
+jsr L285
+L313: red r0
+jmp *r4
+L314: .data -772, 241, 66, -982, 656, 801
+clr r2
+L315: not L164
+bne L205
+rts
+not r2
+cmp *r6, #210
+prn #60
+L316: add r1, r3
+dec *r2
+L317: inc *r5
+L318: add L157, *r5
+
+dec r7
+add r2, *r4
+; comment
+cmp #170, #54
+jmp *r6
+L319: red *r7
+L320: stop
+L321: bne L74
+cmp *r6, *r4
+cmp r1, r6
+sub r6, *r7
+jmp *r6
+lea L168, L115
+inc *r3
+L322: rts
+cmp L231, r2
+L323: prn L40
+sub L182, r0
+L324: cmp *r5, #-45
+L325: not *r1
+L326: mov *r7, r2
+rts
+L327: mov #130, *r4
+prn r4
+
+clr *r0
+inc *r1
+red L70
+add *r1, L102
+prn r0
+red r5
+L328: clr L126
+sub #59, r1
+sub r2, *r4
+clr L274
+L329: inc L220
+L330: jsr L232
+L331: prn L258
+red r0
+prn r1
+stop
+clr r7
+mov #99, r3
+; comment
+L332: .data -497, 112, 977, -876, -787
+clr *r6
+inc *r6
+inc *r3
+L333: dec *r2
+bne L136
+rts
+red L268
+stop
+lea L285, *r1
+rts
+prn L139
+jmp L161
+clr L253
+inc L50
+L334: jsr *r2
+not r1
+jmp L258
+jmp *r4
+L335: rts
+L336: jmp L177
+jmp L118
+cmp *r4, L251
+L337: cmp r1, r3
+red *r1
+jmp L312
+cmp r1, #17
+L338: .data 488, -861, 650, 914, -435, 71, 699
+sub *r4, *r6
+
+bne L285
+L339: .string "mu"
+L340: .string "paefjycjfzwvuscewrxr"
+jmp L222
+L341: red r2
+red L267
+rts
+lea L20, *r4
+jsr *r3
+L342: inc *r4
+clr r0
+inc r1
+sub r2, L173
+prn #8
+rts
+cmp L216, #107
+red L210
+jmp *r1
+mov *r6, r2
+jmp *r0
+sub *r4, r2
+L343: .string "dprrvhuxqggnknjdliiij"
+prn L243
+lea L135, r6
+L344: stop
+L345: mov *r1, *r6
+add L54, r1
+L346: inc r7
+stop
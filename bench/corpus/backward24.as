@@ -0,0 +1,1023 @@
+; Generated by genCorpus --seed 25
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+sub L192, L152
+L0: mov r4, r4
+prn r0
+bne L0
+bne *r5
+rts
+prn *r1
+L1: inc L0
+L2: clr L0
+L3: .string "rilypssumdplrcybtuwmkc"
+; comment
+rts
+dec *r0
+mov r3, L1
+jmp *r0
+stop
+add L1, r5
+red *r2
+L4: clr *r1
+L5: dec r0
+red *r4
+bne *r7
+add r4, r4
+cmp #-185, #-106
+L6: dec *r0
+rts
+add L3, L0
+cmp r2, r5
+L7: jmp *r1
+L8: stop
+L9: .data 256, -327, -452, 414, -982, 125, -254
+L10: not r2
+clr *r3
+bne *r6
+jmp L7
+stop
+add *r2, *r0
+stop
+rts
+; comment
+stop
+jsr L7
+sub #98, L2
+not *r1
+jsr *r4
+
+L11: add L4, L10
+L12: red r5
+jmp L9
+jmp L10
+L13: lea L1, *r5
+mov *r2, *r4
+L14: .data 491, 405, -725
+red r3
+lea L8, *r6
+mov *r2, r2
+jmp *r0
+L15: lea L0, L4
+L16: .string "dbnggwonowfpfcpeukb"
+jsr *r5
+rts
+prn r7
+not r5
+not L5
+cmp r7, *r0
+dec L12
+L17: sub r2, r4
+L18: bne *r2
+stop
+jsr L16
+red L17
+inc L2
+jmp *r5
+L19: clr *r4
+L20: mov r2, r0
+L21: .data -562, 775
+rts
+jsr L9
+sub r6, L10
+; comment
+clr *r5
+
+rts
+stop
+lea L21, r7
+bne L14
+red L16
+L22: inc L21
+L23: inc r6
+L24: jmp *r3
+sub r1, *r1
+rts
+L25: lea L11, L6
+L26: clr *r6
+L27: jmp *r1
+L28: .data 926, 805, 595, -578, 207, -639, 319
+; comment
+jmp *r4
+jsr L1
+lea L16, L25
+inc L4
+L29: clr r1
+cmp r2, L17
+L30: mov #253, *r3
+L31: add #-18, *r3
+L32: .string "goqthdxgyivz"
+jsr *r2
+L33: prn *r0
+L34: add *r4, L7
+inc L25
+lea L7, *r2
+L35: not r2
+not L0
+L36: .string "wsecdksiwc"
+sub *r3, *r5
+cmp #-228, r5
+clr L2
+L37: stop
+clr L36
+L38: add *r0, r7
+add *r7, L3
+dec *r1
+dec *r7
+cmp r4, *r6
+cmp #-249, r7
+L39: .data 600, 620, -610, 224, 663, -169, 831, -698
+add #192, *r4
+L40: .data -447, -141, -384
+red r0
+add L39, r0
+dec L30
+; comment
+cmp #111, *r2
+dec *r6
+L41: .data -13, 992, 332, 850
+L42: cmp L34, L27
+not L26
+L43: .string "uyvg"
+sub #17, *r0
+L44: .string "eekhkt"
+jmp L40
+add #7, *r4
+L45: rts
+rts
+rts
+sub r4, r4
+; comment
+cmp r1, *r2
+rts
+L46: jmp L6
+mov L7, *r0
+sub L22, L28
+mov r7, *r4
+bne L43
+mov r1, r6
+L47: add r6, r0
+rts
+clr *r1
+jmp L27
+lea L44, L21
+L48: red L27
+L49: not r4
+stop
+dec L18
+clr L37
+sub L44, L27
+lea L1, L48
+sub #238, *r3
+jmp *r7
+lea L8, L32
+bne *r0
+bne L31
+; comment
+inc *r4
+clr *r2
+L50: add *r1, L29
+lea L23, L13
+L51: .string "pnotpfdjnuzokaqmxdh"
+dec L29
+add r3, *r5
+L52: jsr L24
+L53: prn #-172
+jmp L7
+add L14, *r7
+L54: sub r1, L9
+jmp *r5
+jmp L2
+L55: .string "qgkyyakifbriybxahleqoce"
+rts
+jmp *r1
+L56: .data -91, -288, 283, -89, -526
+L57: cmp r2, *r4
+prn r7
+clr L49
+bne *r1
+mov *r1, r5
+prn #195
+inc r1
+L58: .string "tvhbtf"
+
+
+L59: .string "pt"
+L60: prn *r4
+L61: stop
+L62: jmp *r6
+jmp *r4
+jsr *r2
+sub *r1, r4
+L63: jsr L32
+not *r4
+jmp *r0
+rts
+L64: mov r6, r7
+cmp #-43, *r7
+L65: stop
+L66: sub #-170, L56
+prn r6
+dec r5
+sub r1, *r4
+bne *r1
+L67: not *r6
+add #-96, *r2
+jsr L57
+cmp r1, L41
+add #-228, L60
+rts
+red r2
+L68: prn #-220
+not r7
+rts
+rts
+lea L36, r0
+L69: prn L63
+cmp r1, r4
+jmp L32
+L70: red L23
+inc r1
+L71: sub #234, L32
+bne *r1
+jmp L31
+L72: prn #4
+L73: .string "uiuhrxwcfzuylosk"
+; comment
+jmp L15
+dec L41
+L74: bne *r6
+L75: stop
+L76: bne *r2
+clr *r1
+jmp *r1
+L77: .data -95, 548, -288, 752, -800, 864, -872
+; comment
+L78: mov L18, *r7
+prn r5
+not r5
+L79: lea L40, *r2
+rts
+bne L18
+L80: jsr *r5
+L81: lea L67, *r1
+L82: clr L39
+clr L61
+clr r5
+add L16, L74
+lea L76, r5
+L83: prn L57
+sub L50, L28
+not L29
+mov #135, r2
+not L80
+jsr *r3
+
+L84: red *r1
+cmp #140, L39
+stop
+jmp L76
+L85: .string "p"
+not *r4
+L86: .data -449, 920, 285, -350
+prn #70
+red *r2
+bne L82
+
+L87: cmp *r6, r6
+L88: .string "kafocism"
+L89: dec *r0
+not *r3
+L90: rts
+red L83
+inc L81
+prn *r2
+L91: stop
+bne *r4
+lea L87, r5
+; comment
+L92: jmp *r6
+jsr L2
+inc L91
+add L55, *r7
+L93: red L16
+L94: .data -856, 493, -326, 710, 365, -364, -773
+L95: add L12, r2
+L96: prn r0
+L97: clr r4
+rts
+L98: rts
+L99: .data -443, 427, -922
+sub #165, r7
+sub *r5, r4
+L100: mov L6, r4
+cmp r1, r6
+cmp #204, r3
+L101: .string "fbzokbtpjsajcpfus"
+not L5
+add *r3, *r5
+clr r6
+L102: add *r5, r7
+red *r4
+; comment
+stop
+L103: bne L60
+jmp L7
+L104: prn r4
+red *r5
+clr *r1
+inc L80
+L105: red *r1
+add r3, L15
+L106: .data 629, 281, 445, 493, 746, -347, -670, 324
+lea L84, *r6
+L107: .data 945, -582, -148, 359, -126, 99, -1
+L108: inc L102
+lea L42, L69
+mov #-50, r1
+L109: .data -518, 706, -645, 412, -360, 686
+jsr L62
+mov L88, *r5
+inc L94
+add r6, *r5
+L110: lea L60, r7
+L111: .data -670, 744, -800, -555, 23, 553
+clr L6
+not L90
+clr r1
+cmp #-199, L39
+L112: rts
+dec r1
+L113: .data -508, 869
+dec *r1
+L114: not L7
+prn r3
+jmp *r1
+prn r4
+L115: prn *r3
+not L26
+rts
+rts
+stop
+cmp L96, L73
+prn #22
+cmp #208, L16
+stop
+prn L25
+rts
+
+inc L40
+not *r1
+; comment
+jmp L1
+inc L56
+L116: add r4, r5
+sub *r2, L94
+dec r5
+mov *r2, L112
+L117: bne *r2
+inc r4
+; comment
+L118: rts
+add L64, *r0
+
+L119: sub L64, L67
+L120: prn L23
+stop
+L121: .data 569, -472, 784, -719, 46, 25, 732
+stop
+L122: jmp *r3
+dec r3
+add r0, L21
+cmp L16, L42
+prn L102
+L123: dec L106
+mov #-96, L112
+L124: not r4
+L125: jmp L121
+rts
+prn L41
+L126: stop
+prn L113
+not r2
+L127: add #-211, *r1
+jsr *r4
+L128: clr L116
+L129: jsr L27
+jmp *r3
+jsr L53
+L130: stop
+inc *r1
+L131: lea L101, *r4
+dec *r1
+L132: .string "mojlrzmmhuqck"
+rts
+L133: stop
+L134: .string "hptksivurlw"
+L135: .string "te"
+lea L10, r0
+cmp L18, L90
+not *r4
+prn #-226
+cmp L28, #138
+L136: sub *r5, *r3
+L137: .data 813, -587
+add #-183, L46
+dec L15
+mov L137, *r0
+jmp *r1
+rts
+jmp L124
+rts
+sub r3, r1
+rts
+L138: .data -403, 317, 460, 212, -336
+mov *r0, L47
+clr L87
+L139: .data 619, -748, 336, 516, -315, 196, 137, -613
+L140: rts
+L141: .string "dhm"
+bne *r6
+L142: jsr L81
+jsr L76
+clr L116
+L143: lea L84, r1
+sub *r2, *r6
+cmp L14, #-34
+L144: not L96
+L145: .data 88
+jsr *r6
+L146: add #130, L3
+jsr *r2
+jmp L7
+L147: .string "qluqsme"
+lea L33, L69
+cmp #179, *r6
+; comment
+inc r2
+lea L140, L94
+jmp *r6
+L148: prn #-67
+prn r7
+stop
+inc r7
+L149: inc r4
+add r7, r6
+cmp r4, r2
+; comment
+L150: jsr *r0
+cmp r1, #189
+stop
+L151: .data -668, 347, -363, -720, -862, -312, -893
+not r2
+red *r0
+
+L152: prn #171
+L153: sub *r2, *r6
+jmp *r3
+cmp r3, #217
+bne L109
+L154: add L8, L87
+L155: jsr L27
+mov #-230, *r0
+bne *r1
+L156: cmp L83, r6
+add L98, r0
+
+rts
+dec L28
+red L36
+not L103
+rts
+prn #71
+cmp #-25, L112
+L157: add #22, r6
+L158: inc *r0
+; comment
+mov #125, *r5
+red *r1
+jmp *r6
+clr L149
+cmp L63, r5
+L159: .data 395, 245
+L160: mov *r3, r0
+; comment
+dec L101
+prn L62
+stop
+red *r1
+red r5
+L161: stop
+stop
+lea L67, *r6
+mov #223, r2
+mov *r7, L63
+; comment
+stop
+L162: .data -291, 963
+L163: .string "yswzwvimhvpsqjwv"
+L164: lea L141, *r5
+L165: .string "klg"
+clr L105
+clr L99
+L166: inc *r6
+inc *r6
+add #-102, *r0
+red r2
+L167: jmp *r2
+
+not L115
+inc L163
+L168: .data 870, 788, -165, 967, -611, 956, 758
+red L15
+L169: jmp *r0
+L170: add r0, r6
+not L11
+L171: clr *r1
+L172: cmp r5, #87
+jmp L46
+L173: sub r4, L109
+lea L13, *r5
+stop
+stop
+prn #100
+not *r5
+add *r6, r3
+jmp *r1
+L174: .data 124, 635, -435, 751, -252, 657, -304
+not L38
+mov L160, L97
+L175: .string "gzihkbfl"
+L176: .data -769, 78, 464, 432, 27, -48, 798, 869
+mov *r3, r7
+inc *r4
+L177: .string "wqkonvjajrxazazpaqqmpxf"
+L178: mov r0, L110
+L179: not *r4
+add L54, *r1
+cmp #148, r0
+bne *r4
+jsr L29
+; comment
+rts
+not L0
+rts
+lea L126, r5
+add #248, *r1
+L180: jmp *r2
+red *r1
+bne L2
+; comment
+L181: bne *r7
+cmp *r7, L13
+not *r4
+prn *r1
+red r2
+L182: bne *r7
+stop
+jmp L180
+L183: .string "dkafewrolqleb"
+inc *r6
+inc r7
+L184: dec *r3
+not *r6
+L185: sub #140, L160
+L186: .data 665, 149, 84, 151, -514, 609, -212
+; comment
+stop
+clr *r4
+
+sub #-201, L113
+stop
+mov r7, r1
+inc r0
+mov L172, r7
+L187: .data 279, 818, -896, 253, 505
+mov #-153, r4
+red L45
+L188: stop
+bne L27
+inc L124
+L189: .data 979, -543, 689, 835, 370, 665, 602
+sub *r6, *r1
+red r4
+L190: dec *r6
+L191: dec r4
+stop
+mov r4, *r4
+L192: lea L172, r2
+L193: mov #184, r4
+not L7
+dec r3
+L194: dec *r7
+
+L195: not r0
+L196: jsr L33
+L197: stop
+mov #-61, L38
+dec r3
+inc r6
+sub L171, *r7
+L198: add r2, *r4
+L199: .data 205, -340
+L200: .string "lkongpjoeigu"
+mov *r1, r7
+L201: dec *r4
+L202: red L116
+L203: dec L57
+lea L68, *r0
+not r3
+L204: .data 953, 86
+L205: mov L96, r3
+dec L178
+clr *r1
+L206: cmp #-232, #107
+lea L148, L3
+cmp *r0, L77
+L207: .data -562, 880, -197, -766, -367, 438, -253, -339
+L208: .data -990, 615, -420
+red L124
+L209: .data -972, 471, -642, 552, 790, -951
+dec r0
+jmp *r4
+L210: .string "uaicoaupflrqluq"
+L211: lea L64, *r3
+lea L57, L115
+stop
+rts
+stop
+L212: not L66
+L213: lea L163, *r5
+sub *r4, L26
+L214: inc *r5
+L215: .string "gnjrd"
+L216: stop
+L217: not r3
+add #-93, r1
+prn #56
+stop
+L218: lea L119, L169
+mov L124, L9
+L219: .data -474, 815, 230, -531, -723, -920, 8, -912
+sub *r5, r7
+; comment
+L220: lea L91, *r4
+L221: bne L28
+sub #124, L11
+dec r4
+sub r6, *r3
+jsr L50
+L222: stop
+sub *r1, *r0
+not L66
+jmp L52
+
+cmp L57, r7
+mov *r4, *r5
+; comment
+; comment
+not *r2
+sub r0, L23
+L223: prn r1
+red L92
+rts
+bne *r4
+L224: add *r7, *r2
+add L109, *r5
+rts
+L225: add r7, r2
+L226: .string "gezelpufnycsuja"
+L227: clr *r7
+lea L16, L76
+dec *r7
+L228: .string "cs"
+red *r0
+L229: .string "zq"
+L230: lea L138, *r1
+red *r5
+rts
+
+jmp *r1
+; comment
+not r1
+L231: stop
+red L136
+L232: dec *r1
+mov L100, L73
+stop
+L233: .data 482, -123
+stop
+prn r3
+dec r4
+L234: .string "dlhiwkctaa"
+; comment
+lea L125, *r4
+bne L187
+L235: lea L102, L213
+L236: .data 598, 822, 938, 275, -683
+red *r3
+inc r4
+L237: red *r1
+red L165
+L238: .data -636, 478, 362, 568
+lea L95, L133
+bne L238
+L239: red L74
+add #-41, L154
+L240: .string "lcpdtszcraezdellzldx"
+L241: rts
+jmp L39
+L242: prn *r6
+cmp r1, L31
+L243: .string "mdqgghxclbdpeddg"
+L244: mov L110, r1
+L245: rts
+L246: inc L226
+rts
+add *r7, L195
+bne *r7
+inc L32
+stop
+L247: mov *r5, *r2
+L248: .data -932, -37, -395, -399, 614, 532, 346
+L249: cmp L107, *r2
+rts
+stop
+add L0, r1
+not L117
+
+L250: cmp r5, #227
+lea L85, *r6
+L251: bne L119
+dec r2
+add #41, *r1
+L252: sub L21, L24
+L253: jmp *r4
+jsr *r3
+mov r3, *r7
+bne L62
+; comment
+rts
+L254: not r7
+not L43
+red L128
+L255: .string "lhyrccsxlsvw"
+stop
+bne *r6
+L256: stop
+add r2, r7
+jsr L39
+rts
+inc L220
+; comment
+red r3
+L257: sub r0, L146
+; comment
+L258: not L94
+L259: sub *r7, L193
+red *r3
+add #-145, *r0
+L260: .string "cocfunlwleyoih"
+jmp *r3
+dec *r3
+cmp L210, L177
+L261: .string "besuuzuokizjq"
+L262: .data -604, 345, -167, 611, -991, -223
+L263: clr *r0
+jsr *r7
+L264: clr *r0
+; comment
+dec *r6
+prn L115
+lea L154, *r3
+L265: .data -789, -967, 222, -743, -732, -942
+prn #245
+sub *r0, r2
+L266: sub #-143, L223
+not *r5
+jmp L6
+prn #-7
+
+jmp L37
+L267: red L52
+L268: dec r2
+L269: .string "facfxqjkunbmzzsg"
+clr L199
+inc *r6
+mov r2, r2
+dec *r2
+L270: lea L244, r3
+rts
+cmp #175, *r7
+rts
+jsr L66
+bne L112
+cmp *r3, L64
+dec r0
+L271: .string "tozojyc"
+L272: add *r1, r0
+L273: bne *r7
+bne L87
+sub L178, L161
+L274: red *r2
+jsr L128
+stop
+L275: cmp L112, #-55
+lea L126, L214
+L276: clr L28
+L277: jsr *r2
+
+prn *r4
+clr *r2
+jsr L252
+prn #138
+L278: .data 4, -702, -269, -905, 909
+stop
+add L112, r6
+L279: .string "hyahmc"
+L280: mov r6, *r2
+prn *r2
+jmp *r5
+L281: dec L224
+sub #241, L249
+L282: .data -18, -509, 605, 617
+prn r2
+L283: .data -15, 180, -421, 351, 731, 293
+L284: prn #-140
+L285: .string "butwrzevboluvb"
+L286: .data -800, -918
+jsr L91
+L287: lea L238, L193
+L288: .string "jnuyqcxlygkmtfquonwdbntq"
+rts
+L289: add r7, *r4
+dec *r0
+mov r5, *r0
+L290: not r7
+stop
+add r1, r7
+cmp *r1, L195
+L291: not L179
+mov L127, *r5
+rts
+inc *r5
+L292: lea L54, *r1
+L293: lea L260, r4
+L294: sub L93, L85
+not L265
+jmp *r2
+red L278
+lea L106, L16
+L295: clr L139
+; comment
+clr r3
+clr L47
+jsr *r0
+cmp *r7, *r0
+L296: .data 808, 710, 577, 190, -581, -610
+mov r1, *r0
+prn #-76
+L297: red r0
+stop
+mov *r4, r1
+bne *r4
+bne *r5
+rts
+L298: .string "znxwopdeg"
+L299: add #-46, *r3
+inc L63
+rts
+L300: red L188
+L301: dec *r0
+not *r1
+L302: jsr L50
+L303: stop
+lea L67, *r2
+cmp *r3, L18
+L304: .string "klev"
+jmp L26
+L305: prn *r5
+lea L166, *r3
+red *r2
+jmp *r2
+L306: red *r5
+inc L195
+L307: sub #48, *r1
+L308: lea L155, r2
+L309: prn #-129
+not L112
+; comment
+not r1
+L310: .string "npxqymzygjbsuzbfvlwl"
+jsr *r3
+dec *r1
+lea L249, *r5
+jsr L247
+clr L123
+prn r0
+lea L70, *r4
+mov r0, *r7
+inc r7
+sub *r1, *r2
+L311: prn *r7
+jsr L167
+mov #-185, r5
+stop
+L312: bne *r4
+L313: .data 334, -955, 815, -120, -692, -946, -367, -495
+mov r3, *r4
+stop
+L314: rts
+clr *r0
+sub #82, *r5
+bne *r2
+rts
+L315: .data -619, -771, -979, -103, 17, -723, 75, 456
+prn L160
+prn L236
+L316: red L251
+red L277
+L317: .string "bmbwacjcoubtbwuiclhmhts"
+jsr L118
+not *r2
+lea L206, *r6
+not *r7
+L318: bne *r7
+red *r6
+mov #-21, L23
+rts
+L319: cmp L303, #-244
+L320: bne *r4
+L321: .string "afcrznjobkxuim"
+
+prn #186
+red L63
+sub L46, *r0
+not *r2
+rts
+cmp *r7, *r2
+clr r6
+inc *r1
+L322: rts
+dec r2
+add r4, r3
+stop
+; comment
+; comment
+not L259
+L323: dec r1
+red L1
+red L68
+jsr L79
+jsr L229
+prn *r5
+bne *r0
+jmp L7
+L324: .data 831, -4, 484, -249, -83, 160, -105
+lea L68, r1
+inc *r3
+red r3
+stop
+mov L137, L297
+L325: sub r7, L210
+L326: cmp L196, L165
+L327: .data 740
+stop
+dec *r1
+stop
+rts
+not *r1
+; comment
+L328: jsr L99
+add r0, *r2
+jmp *r5
+L329: mov #98, r1
+mov *r6, L281
+jmp L152
+red r4
+dec *r6
+clr *r5
+L330: inc L7
+L331: not *r1
+not L179
+L332: lea L72, r5
+stop
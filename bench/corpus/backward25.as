@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 26
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+red r4
+stop
+clr *r1
+L0: clr L0
+
+L1: jsr *r2
+L2: lea L0, r3
+sub L1, L0
+stop
+rts
+dec L1
+add L1, *r4
+bne L0
+add r2, r0
+L3: .data 118, -301, 373, 525, -118, 444, 639
+rts
+mov r5, L2
+not L0
+L4: .string "hnslzovcjsvfxidbb"
+lea L0, r4
+rts
+lea L1, L4
+cmp L1, *r3
+dec *r3
+L5: mov #-15, L3
+dec *r7
+bne *r3
+not r3
+dec r6
+dec r2
+mov *r5, *r4
+L6: clr L1
+not *r3
+rts
+; comment
+L7: mov r3, *r5
+mov #60, L1
+add r6, *r0
+add #-212, r0
+stop
+L8: not r5
+sub #64, L5
+L9: prn r7
+L10: rts
+bne L5
+L11: jmp *r6
+red *r2
+lea L11, r6
+L12: dec L6
+
+L13: clr L2
+; comment
+L14: jsr L10
+L15: jsr *r2
+L16: .data -167, -782, 3, -423
+sub r2, r0
+jsr *r6
+
+rts
+L17: clr r7
+L18: .string "rbrwxcuptqjzhkg"
+L19: inc L0
+L20: not L1
+L21: inc *r2
+L22: .string "avkwb"
+red r4
+L23: add #-50, L16
+mov L11, L18
+prn r0
+red r1
+; comment
+stop
+prn r7
+prn #226
+clr L21
+L24: clr r4
+L25: .string "qtpomvhuesmprpzqccxb"
+bne *r5
+jmp L19
+L26: cmp r3, L4
+clr r7
+bne *r6
+L27: rts
+clr L12
+red *r1
+bne *r5
+L28: prn r6
+L29: sub *r2, L7
+L30: inc L22
+L31: dec r3
+stop
+bne L3
+jmp *r1
+bne *r2
+jsr *r7
+stop
+clr r7
+L32: cmp r5, r4
+dec L27
+mov r4, L9
+L33: .string "uvdtcynipdmq"
+L34: sub *r7, L15
+rts
+clr L21
+lea L2, r5
+L35: clr *r1
+add *r3, L31
+cmp L19, #10
+stop
+clr L3
+L36: red L18
+dec *r0
+dec r3
+jsr *r5
+cmp #-208, L18
+L37: cmp L12, *r6
+L38: .string "pdqiuuqfliilsamlvkjwnr"
+sub L2, r5
+inc r4
+red r2
+inc *r3
+add L30, L8
+L39: .data -427
+L40: lea L14, r6
+L41: jsr *r2
+jmp *r2
+cmp *r1, #-224
+mov #236, r0
+L42: jsr *r2
+lea L42, r4
+L43: rts
+L44: jsr L39
+L45: sub *r4, r0
+L46: jmp *r6
+lea L38, r2
+L47: .string "nnnjjtcutfbbodmyicu"
+not L11
+L48: add L10, *r5
+rts
+L49: .data 339, 644, 961, 113
+L50: add r3, L37
+lea L19, r5
+L51: .data -75, -188, 931, -889
+L52: stop
+add L41, r6
+not L26
+L53: .data -853, 304
+L54: bne L40
+add #116, L21
+
+L55: clr *r5
+L56: mov #88, r0
+L57: not r5
+mov #153, r4
+L58: stop
+L59: jsr *r1
+add r4, r0
+mov *r1, r6
+L60: bne L59
+L61: .string "blfjtfriaiup"
+dec r2
+cmp L47, r7
+L62: dec L10
+; comment
+L63: not r2
+L64: lea L37, L29
+cmp *r3, L53
+not *r0
+rts
+L65: rts
+lea L29, *r0
+L66: red r1
+jsr L9
+red *r7
+red r4
+L67: dec r6
+L68: red *r4
+; comment
+jmp L10
+rts
+L69: jsr *r0
+prn #-101
+mov r6, r4
+inc *r1
+L70: bne L41
+dec L54
+mov #-115, *r5
+L71: clr *r0
+inc *r7
+sub *r7, L30
+L72: jmp *r0
+L73: jmp L25
+L74: red r5
+
+not *r7
+jsr L26
+not L51
+stop
+L75: sub L51, L65
+L76: .string "xuvsswulkqlwjqqptbzffzz"
+inc *r6
+L77: bne L8
+add r5, r4
+L78: lea L49, *r0
+clr r3
+lea L74, r6
+dec L46
+L79: inc r6
+L80: not L48
+stop
+lea L60, L54
+jmp *r3
+
+mov #-58, L27
+mov r3, *r7
+stop
+dec r5
+jmp L10
+jmp L68
+mov *r6, *r5
+L81: .string "qcxakqniffhphy"
+stop
+L82: jsr L35
+jsr L57
+L83: .data -629
+add L28, r6
+L84: sub r4, *r1
+L85: clr *r3
+L86: bne L31
+L87: .data -200, -145, 14, -442
+red *r2
+red L55
+L88: .string "etjxkqyidcaaalrj"
+dec *r0
+cmp *r4, #-181
+red *r4
+L89: dec L5
+inc L4
+jsr *r5
+not *r0
+rts
+; comment
+L90: bne L35
+inc r6
+stop
+L91: bne *r1
+cmp *r7, #53
+cmp *r0, *r5
+L92: inc *r0
+L93: mov #-23, r7
+stop
+L94: sub r2, r1
+prn r7
+mov L45, L20
+
+
+jmp L6
+bne L26
+L95: red L46
+L96: bne *r0
+lea L22, *r2
+L97: prn #110
+L98: .string "qpmkgfnppzioao"
+L99: clr r7
+L100: .data 821, -19, 414, -913, -736
+L101: dec L96
+add *r4, *r0
+L102: .data 736, -187, -119, 934, -719
+mov #59, r3
+mov *r5, L100
+stop
+
+L103: jmp *r3
+inc r5
+L104: jmp L84
+L105: bne L7
+L106: .string "yftmhicwtcz"
+rts
+L107: rts
+
+mov r0, L22
+L108: stop
+prn *r7
+L109: cmp r3, r7
+L110: not L80
+sub r5, L37
+not L79
+clr L109
+jsr L25
+dec L64
+mov L105, L95
+red *r4
+L111: prn r6
+L112: bne *r3
+L113: .string "umtlnzxzkd"
+L114: dec r4
+L115: .string "tipggdnmryleji"
+cmp #-70, r2
+L116: .data -391, -264, -845, -621, 772
+L117: sub r4, L113
+L118: clr L54
+L119: .string "vqwvdjvxeqlfsr"
+mov L56, r4
+
+mov L116, *r0
+stop
+L120: .string "rbiqqnuuy"
+dec *r2
+mov r3, *r6
+inc L117
+dec L7
+jmp *r4
+stop
+mov #43, *r6
+bne L110
+red r6
+not *r3
+stop
+bne *r3
+L121: jmp L63
+L122: lea L38, *r4
+stop
+jsr L37
+L123: jsr *r4
+L124: lea L22, r1
+red L23
+prn *r4
+not r6
+L125: not r1
+lea L30, L106
+red *r4
+not L113
+add #-214, L39
+mov r0, r6
+jmp *r2
+L126: bne L81
+mov L87, r2
+lea L82, *r3
+add *r1, L57
+cmp *r5, *r2
+L127: jsr L22
+bne L121
+rts
+dec *r4
+L128: .string "uvnmodtz"
+add L39, *r0
+bne L6
+L129: .string "ftimitbfow"
+lea L105, L119
+stop
+L130: not *r5
+mov r4, L60
+L131: jmp *r6
+L132: mov L88, L28
+add #-67, r7
+cmp L40, L80
+not r5
+prn L57
+inc L73
+L133: jmp L25
+cmp #-73, r2
+L134: mov #75, L72
+L135: .string "olpfmxm"
+jsr *r4
+bne L3
+L136: .string "iviyyokhzysdvwj"
+jmp L116
+clr L62
+stop
+dec L115
+mov L111, r3
+jmp *r1
+cmp #107, *r5
+L137: lea L122, r3
+inc *r3
+stop
+L138: .string "etzhmjhrcnyplnnqhdqqou"
+L139: jsr L132
+cmp *r6, *r1
+L140: add *r2, r5
+rts
+sub L108, r2
+L141: bne *r6
+clr r4
+bne L69
+red *r4
+stop
+mov #60, L72
+jsr L61
+lea L40, L96
+L142: .data -512, 704, 385, 45
+
+L143: rts
+L144: bne L101
+L145: dec L112
+L146: clr L129
+lea L142, r2
+sub *r3, L137
+jmp L111
+L147: not L71
+L148: red r5
+prn *r0
+inc L96
+L149: .string "zzvmtpsmsgyojpllcplimza"
+L150: .string "gkehlptkimbbf"
+L151: .data 717, 280, 614, 349, 32, -410
+dec *r5
+lea L67, L85
+inc L30
+not L75
+sub *r5, *r2
+prn *r5
+L152: clr L134
+clr L57
+rts
+L153: inc r6
+L154: inc *r2
+L155: jsr L154
+L156: .data 381, 282, -545, -842, -155
+red r4
+jsr L42
+stop
+lea L141, L29
+L157: .string "uigcqcvxfkaraymjg"
+jmp *r7
+rts
+L158: .data 655, 646, 425
+cmp *r1, r3
+bne L37
+add r1, L40
+clr *r3
+; comment
+L159: not *r4
+clr r5
+L160: .data 639, -672, -443, 206, -341
+L161: dec r0
+red *r1
+prn #-254
+jmp L160
+inc *r7
+L162: add L92, r3
+L163: lea L98, L32
+inc L99
+dec L37
+jsr *r5
+clr *r1
+mov #50, *r2
+prn L51
+cmp r7, L10
+add #245, L38
+L164: red r3
+L165: stop
+lea L42, r1
+L166: red r6
+jmp L127
+prn L163
+L167: inc L61
+rts
+inc r5
+dec r1
+stop
+L168: not *r3
+L169: .string "ugqvxfhhcft"
+L170: add L116, *r7
+L171: .data -59, 794, -547, 784, -976, -56, 99, 667
+rts
+L172: sub #173, L78
+L173: add #176, r7
+L174: rts
+L175: .string "syysztoxew"
+cmp L131, L8
+inc *r6
+jmp *r2
+jsr *r2
+not *r2
+red r7
+add #135, *r7
+lea L170, *r1
+mov r4, r3
+bne L173
+L176: rts
+L177: red r7
+jsr L146
+L178: clr r5
+prn *r3
+L179: jmp *r7
+mov #-174, *r5
+L180: red r4
+prn r0
+L181: prn #238
+bne L12
+L182: rts
+sub *r6, r4
+not r4
+jsr *r7
+L183: bne L113
+clr r3
+inc r0
+L184: add #-111, *r3
+L185: lea L15, L15
+L186: .data 707, -281, 552, 676, 606, -702
+not *r4
+prn L11
+sub *r6, r7
+L187: .string "x"
+red *r5
+L188: .string "vwhmlwopnok"
+inc *r2
+jmp *r2
+jsr L62
+jsr *r0
+prn #235
+L189: clr r6
+L190: mov #236, r1
+L191: stop
+sub L43, *r3
+stop
+prn L185
+mov #34, r1
+jmp *r4
+dec r7
+L192: clr *r6
+L193: .data -194
+; comment
+L194: .string "a"
+prn r7
+add L166, L31
+L195: not L190
+sub r1, L173
+cmp *r6, L148
+clr r7
+L196: lea L123, L71
+mov L7, *r4
+mov #43, L107
+sub #15, L110
+add L185, *r0
+jsr *r7
+rts
+inc L186
+L197: add *r7, L152
+not L40
+bne L2
+add L115, L135
+inc L132
+prn L48
+mov #7, r6
+jsr *r3
+inc L63
+jmp *r0
+L198: .string "dvlpfqdypftvnvpmx"
+bne *r7
+cmp r3, *r3
+lea L162, L25
+not *r6
+rts
+L199: mov L78, r6
+sub r0, L28
+L200: inc r3
+stop
+rts
+lea L6, L35
+clr *r3
+L201: not L71
+mov r6, *r6
+dec r0
+L202: rts
+cmp #84, *r4
+L203: mov r2, r1
+L204: mov L28, L115
+stop
+L205: mov r0, r3
+bne *r5
+; comment
+; comment
+L206: prn L48
+lea L149, r5
+clr r2
+cmp L14, *r2
+not r3
+jsr *r7
+L207: prn L134
+
+inc L13
+L208: .string "wuxqv"
+L209: .data -703, 88, 132, -691, 44, 724, -495
+stop
+stop
+bne *r4
+L210: inc *r5
+clr r1
+stop
+L211: rts
+jmp *r4
+bne *r7
+L212: prn *r5
+L213: stop
+red *r6
+L214: jsr *r3
+jmp L167
+L215: rts
+add r0, *r6
+jmp *r5
+L216: .string "qhibnvspurbpsxuiszcwx"
+inc *r6
+cmp *r0, #136
+rts
+sub *r6, r7
+clr *r3
+L217: jmp *r0
+cmp L120, *r5
+; comment
+L218: sub r7, r5
+L219: stop
+L220: sub #-70, r0
+L221: cmp r5, *r2
+L222: not L97
+not L222
+rts
+L223: prn L102
+L224: inc L158
+sub *r4, *r3
+L225: .data 435, 27
+L226: jmp *r4
+L227: bne *r6
+prn #29
+L228: .string "cvextm"
+rts
+L229: dec *r5
+L230: inc *r4
+mov r3, *r0
+L231: dec L48
+not r3
+L232: .string "fsnycnqyiregxiehvklc"
+L233: .data -841, -937, -758, -558
+L234: .data 540, -455, 933, -777, -534
+L235: add *r1, r4
+cmp r1, *r4
+prn #159
+
+L236: jsr *r0
+not r2
+add #-186, L92
+L237: dec *r4
+not L78
+cmp L98, *r1
+; comment
+L238: .string "al"
+inc L73
+prn L226
+L239: bne *r6
+L240: not L152
+cmp L180, L197
+rts
+inc L105
+rts
+L241: stop
+mov L49, r6
+L242: cmp #-126, L211
+add r5, r1
+L243: prn #200
+L244: .data -776
+L245: add r7, r6
+L246: red *r6
+inc *r2
+L247: mov #60, L6
+cmp *r4, *r0
+dec L133
+inc *r7
+bne *r3
+red L155
+L248: clr r1
+; comment
+L249: inc *r4
+L250: sub L23, L48
+jsr *r7
+mov L174, L192
+; comment
+L251: prn L170
+L252: not L9
+rts
+jmp *r6
+lea L63, L217
+bne *r7
+sub *r7, L167
+red r7
+not L39
+L253: bne *r6
+L254: stop
+cmp *r1, r4
+jmp *r3
+
+not *r0
+add *r1, r6
+inc L102
+rts
+not r6
+L255: inc *r6
+bne *r6
+L256: red L223
+rts
+L257: sub *r5, L4
+jmp *r6
+jmp *r2
+jmp L44
+clr *r5
+L258: not L0
+L259: add #-87, r5
+jmp L244
+L260: lea L197, *r3
+L261: rts
+L262: cmp L152, L246
+sub *r5, r7
+add *r6, r6
+clr *r1
+add *r4, r4
+L263: red *r0
+rts
+cmp *r4, *r6
+add #9, r1
+dec L179
+prn L227
+L264: jsr *r2
+L265: red r1
+stop
+jsr *r1
+rts
+L266: .data 880, -899, -434
+jmp *r1
+L267: bne L92
+clr r5
+L268: add L94, *r3
+not L57
+add r3, *r1
+L269: jsr *r3
+L270: red *r0
+L271: sub L112, *r6
+red L15
+prn *r7
+red *r0
+; comment
+lea L19, L131
+L272: .data -417, -516, 579, -764, -543, 788, -899, -442
+; comment
+dec *r5
+L273: .string "eacmkirtunvzdkbq"
+L274: .string "wglhck"
+dec r6
+L275: .string "nr"
+L276: sub #-213, L183
+clr r7
+sub r5, *r3
+rts
+bne L27
+lea L55, *r0
+L277: .data 21, 566
+; comment
+lea L195, r1
+red *r6
+L278: lea L90, *r2
+; comment
+L279: .data -394, 908, -770, 170, 578, -633
+jmp L24
+cmp r1, #-168
+sub #-51, r4
+L280: prn #134
+clr *r5
+rts
+dec r2
+inc r2
+L281: .data -142, -606, 960, -327
+not L8
+cmp #140, #-156
+prn *r5
+L282: stop
+L283: red r3
+not r3
+L284: add *r5, *r3
+L285: stop
+not L104
+L286: .string "fniqn"
+jmp *r1
+rts
+
+add *r0, *r4
+sub #-51, L70
+L287: jmp L247
+inc r2
+bne *r2
+; comment
+cmp #128, #106
+L288: prn r4
+L289: prn #-143
+clr L208
+L290: sub #-239, r5
+mov L140, *r1
+L291: .data 228, 631, 227, 978
+jsr L242
+jsr L96
+bne *r7
+cmp *r4, L13
+clr r6
+L292: rts
+mov r5, r5
+L293: .data 92, -854, 95
+bne *r0
+L294: .string "znk"
+; comment
+mov *r3, r2
+clr L224
+L295: add #32, r0
+sub *r5, *r2
+L296: lea L143, L190
+; comment
+cmp #-198, r1
+
+L297: prn #126
+bne *r7
+add L231, *r3
+L298: jmp L116
+L299: mov *r1, *r3
+L300: prn L238
+dec r3
+L301: rts
+cmp L92, r4
+clr r3
+L302: .data 371, -953, 703, -667
+cmp L301, *r4
+
+sub *r0, r0
+cmp r2, *r0
+
+dec L46
+L303: sub r0, r4
+; comment
+L304: lea L70, *r2
+
+add r7, r1
+L305: not r2
+L306: cmp #-256, #225
+red L210
+sub *r7, *r7
+L307: prn r5
+inc *r7
+bne *r4
+stop
+prn *r6
+
+cmp *r5, L79
+lea L194, r7
+jsr *r7
+sub #-222, *r1
+clr L27
+prn *r0
+prn r3
+; comment
+mov #-165, L159
+L308: .string "jxiqywbatuntmhocsycc"
+L309: dec *r4
+L310: bne *r7
+sub *r4, r7
+inc L267
+L311: not L139
+L312: cmp #-202, *r5
+jsr L88
+; comment
+rts
+not r7
+L313: cmp *r1, L139
+not L242
+clr L233
+jsr *r1
+lea L191, *r4
+; comment
+; comment
+L314: stop
+jmp L301
+
+stop
+L315: jmp L87
+cmp *r3, *r3
+L316: mov *r4, L311
+L317: inc L194
+L318: .data -260, 207, -174, 600, 879
+cmp *r3, *r3
+bne *r6
+L319: mov #181, *r4
+L320: not L304
+red *r0
+dec L229
+inc *r5
+L321: lea L80, L106
+inc *r4
+add #-222, r0
+L322: rts
+red r5
+L323: inc *r1
+jmp *r7
+L324: lea L321, *r2
+L325: lea L286, *r1
+add *r5, *r4
+mov #27, L4
+L326: jsr L39
+dec L129
+L327: red *r5
+mov #-188, L181
+L328: bne L7
+
+L329: jmp L154
+jsr *r6
+L330: rts
+stop
+add L47, r6
+stop
+inc *r4
+L331: cmp L138, L323
+L332: rts
+jsr *r5
+sub r7, *r6
+prn *r7
+jmp *r4
+red *r2
+L333: rts
+sub #4, L112
+lea L295, *r2
+L334: bne *r2
+L335: jsr L1
+add L155, r3
+lea L126, r5
+L336: .data -413, -122, 302, 564
+L337: jmp L236
+stop
+mov #-235, L58
+lea L34, r7
+clr r6
+stop
+jmp *r4
+L338: .string "ihpcvhqaygvloa"
+prn r0
+L339: mov L285, r1
+L340: mov L100, *r6
+L341: jsr *r0
+stop
+lea L181, *r5
+lea L103, *r6
+prn r2
+L342: cmp *r0, #133
+L343: lea L117, L154
+jsr L147
+clr *r3
+add *r6, r7
+L344: clr L273
+
+L345: lea L307, L37
+sub *r6, L193
+sub *r1, *r7
+stop
+cmp *r7, L60
+L346: jsr *r2
+clr L271
+add #185, L72
+stop
+dec r3
+mov L210, r6
+L347: rts
+dec L64
+L348: .string "uunvpphwjrgjmc"
+mov L306, r4
+jmp L4
+sub *r3, L68
+L349: lea L239, r3
+dec *r3
+red *r7
+lea L140, L236
+cmp L237, *r5
+bne *r4
+bne *r5
+L350: rts
+L351: .data 627, -275, 338, -201, 403, -381, 586
+; comment
+cmp *r2, L206
+sub *r6, r1
+L352: mov L250, *r6
+stop
+not r1
+not *r0
+jsr *r2
+jsr *r3
+L353: inc L288
+sub *r1, r5
+L354: .string "zzftgiq"
+rts
+L355: dec L274
+add L237, r5
+L356: jsr *r5
+L357: .string "cqrqrpy"
+L358: inc L6
+
+add #-46, *r7
+jmp L325
+dec r6
+stop
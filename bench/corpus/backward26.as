@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 27
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+not r0
+L0: .string "b"
+L1: bne *r5
+red *r2
+clr *r1
+add *r2, *r0
+jsr L0
+add L1, L1
+add *r3, r4
+L2: add r5, *r7
+L3: .string "isxnqs"
+sub L2, *r4
+cmp #-85, L3
+L4: .data 305, -158
+dec L4
+L5: prn *r6
+L6: red r2
+bne L2
+jmp *r2
+L7: jmp L4
+jmp L4
+L8: add r6, L8
+L9: bne L4
+L10: .string "kgqpnrpuzbxgeb"
+lea L4, r4
+inc *r3
+prn #-249
+
+bne L8
+L11: .string "mudqttxz"
+sub r2, *r6
+red L8
+rts
+L12: red r0
+jsr L12
+clr r5
+; comment
+cmp #-252, L5
+L13: jmp L10
+stop
+L14: rts
+sub *r3, r3
+L15: jmp *r4
+L16: inc r2
+rts
+red L13
+bne L15
+L17: .data 963, -948
+L18: clr r7
+L19: mov #7, L0
+L20: clr r2
+stop
+rts
+jsr *r5
+bne *r2
+L21: .data -123, 421
+jsr *r5
+L22: sub L18, *r6
+red *r6
+L23: .data -324, 721, -712, -11, 782, -78, -270
+L24: sub L2, r0
+inc r1
+L25: lea L3, L9
+L26: dec *r1
+L27: jmp *r2
+L28: clr L18
+L29: .data 758, 263, 511, -656, 230, -604, 542
+L30: stop
+L31: lea L9, r5
+sub L31, *r0
+lea L22, r6
+dec L30
+sub L30, L20
+L32: .string "xdmwdsducdxubau"
+lea L16, r2
+L33: inc *r2
+jmp *r5
+clr *r7
+jmp L5
+L34: mov r1, r1
+jmp L21
+L35: rts
+bne L21
+stop
+L36: lea L19, *r4
+L37: mov L17, r6
+bne *r6
+
+L38: .string "ygzrngxupusqjlsxttnihsq"
+stop
+cmp *r5, #-59
+L39: .data -378, -667, 342, 938, -119, -467
+rts
+sub L29, L17
+dec *r4
+dec L13
+L40: clr L9
+bne L7
+L41: .data 345, 286, 729, -422, -696, -538, 299
+stop
+cmp r4, r5
+L42: bne L37
+L43: prn #216
+dec L31
+
+L44: jmp L35
+not r1
+L45: lea L38, *r4
+red *r4
+clr L27
+prn #-177
+L46: .data -876, -605, 682, 188, -244
+sub r0, *r4
+jmp *r1
+jsr L0
+dec r6
+jsr *r1
+cmp r7, L23
+L47: inc *r5
+bne L36
+L48: cmp *r6, *r5
+red r1
+mov #216, L47
+L49: inc *r6
+
+not L18
+L50: lea L18, r6
+L51: prn #190
+L52: .data -644, -325, -78, -314, 641, 352, 166
+L53: lea L25, r1
+L54: .string "ktddcri"
+sub #-136, r7
+sub #-209, L12
+add #37, *r7
+cmp L13, #-42
+jmp L27
+red L27
+not L37
+L55: jsr L51
+L56: .data -730, 883, 677, 570, 244
+red *r5
+L57: .data -916, 9, 791, 711, -318, 412
+L58: jsr *r4
+L59: not L34
+L60: clr *r1
+L61: jmp *r0
+sub #-208, *r4
+add #-9, *r5
+bne L15
+bne L59
+jsr *r2
+L62: jmp *r3
+stop
+mov L49, L10
+lea L29, r5
+L63: dec L17
+add r6, *r1
+L64: .string "exdsoyiqs"
+L65: stop
+jmp *r7
+
+L66: jsr *r6
+inc r0
+cmp L7, *r2
+L67: red *r2
+L68: dec L24
+mov #174, r1
+L69: add L3, *r1
+stop
+bne L69
+L70: jsr *r1
+L71: .data -305, -318
+L72: .string "kucwgoyqlo"
+L73: mov r0, r2
+jsr L17
+L74: stop
+cmp r5, r5
+L75: jsr L7
+L76: bne *r7
+L77: rts
+rts
+dec L13
+L78: .string "fdpvrhdxeebjjpny"
+clr *r6
+inc *r7
+clr L56
+rts
+L79: rts
+mov #-48, L34
+L80: prn #-232
+lea L27, *r7
+L81: bne *r2
+clr L26
+dec L28
+not *r7
+red r7
+lea L32, r0
+jmp *r0
+cmp L60, r6
+red r0
+not *r7
+bne *r1
+L82: add L2, *r2
+mov #-84, L32
+L83: sub L75, L26
+L84: sub *r6, *r7
+L85: dec r5
+L86: sub *r2, *r2
+L87: bne L59
+inc L1
+L88: mov L80, L74
+L89: .data -947
+L90: prn r6
+L91: add L43, r6
+L92: lea L65, L18
+lea L41, r3
+cmp L0, r5
+stop
+L93: .data -311
+L94: red L52
+red L86
+bne L22
+add L4, *r0
+sub L29, r5
+lea L4, *r1
+jmp L1
+jsr L58
+L95: rts
+L96: dec *r2
+lea L67, L50
+prn #152
+jmp L36
+; comment
+; comment
+jmp *r1
+; comment
+L97: .data 606, -6, 932, -187, -786, 865, -727
+jsr *r4
+dec L19
+; comment
+jsr L73
+; comment
+L98: bne L95
+clr *r3
+rts
+L99: cmp #132, *r5
+L100: clr r4
+red r2
+L101: clr L4
+L102: jsr L48
+dec *r2
+L103: jsr *r4
+mov L98, L89
+dec *r3
+lea L68, L45
+L104: jmp *r1
+stop
+rts
+L105: sub r7, r2
+L106: .string "xm"
+L107: jmp L29
+
+prn *r4
+inc *r0
+red r2
+jmp L95
+dec *r6
+red L13
+L108: jsr L104
+cmp r5, #20
+L109: rts
+rts
+dec *r5
+L110: clr *r1
+L111: cmp #141, #-150
+L112: rts
+L113: lea L52, r3
+red r3
+prn r5
+L114: jsr L88
+L115: prn #134
+L116: add *r2, r5
+add L58, r7
+L117: .data -833, 380, -657, 20, 379
+add L47, *r3
+inc L6
+stop
+L118: mov r4, r4
+L119: .data 488, 175, -242, 19, -399, 175, -426
+L120: .data -973, -627
+jmp *r6
+lea L41, r0
+
+bne *r2
+mov #190, *r1
+sub *r6, L75
+mov *r7, r5
+L121: .data -834, -695, 939, -152, -35, 384
+; comment
+sub r7, r5
+bne L38
+red r7
+L122: lea L47, *r6
+L123: .data -659, 783, 78, 190, -285, 362, 897, -591
+sub L11, r0
+L124: red *r4
+; comment
+L125: rts
+bne *r5
+red r5
+L126: .string "hqsysxngovwvxpaubninya"
+stop
+L127: .string "dkxgesc"
+L128: clr L56
+jmp L102
+stop
+L129: jsr L36
+lea L66, *r7
+stop
+L130: sub L81, *r3
+L131: bne L103
+lea L27, *r1
+clr r7
+L132: add L67, *r7
+L133: dec r2
+L134: add *r5, L133
+red *r0
+rts
+rts
+dec r1
+rts
+bne L72
+L135: not *r5
+bne *r5
+prn L122
+L136: .data -968, 701, -397, -109, -763, 587, 706, -211
+
+lea L79, *r0
+L137: bne L102
+inc *r6
+add *r0, *r3
+cmp #222, #195
+clr L44
+jsr *r2
+add #-204, *r6
+jmp *r7
+rts
+jsr L5
+sub L102, r3
+clr L105
+jsr *r5
+stop
+add *r7, r7
+L138: .data 356, -616, -534, -355, 954, 841, -527
+jmp L20
+L139: .string "sjhshvfbxx"
+L140: add r7, r6
+stop
+red r2
+stop
+rts
+L141: prn L134
+jsr L26
+lea L6, *r7
+L142: prn r2
+L143: .data 754, -648, -791, -666, 507
+L144: jmp *r2
+L145: jsr *r0
+stop
+L146: lea L17, r1
+L147: .string "yjhwipqnctr"
+; comment
+cmp *r5, L32
+L148: lea L52, L27
+prn r3
+prn #18
+bne *r7
+not L95
+inc r4
+L149: bne *r7
+L150: lea L97, r7
+L151: prn L148
+rts
+L152: add L81, r5
+L153: cmp r1, *r1
+prn L128
+cmp L88, #-145
+cmp #196, r3
+L154: jsr *r3
+prn *r1
+dec L106
+bne *r7
+stop
+clr L20
+L155: rts
+lea L36, *r0
+lea L22, L112
+L156: .string "qhnnmjtwzmedq"
+jmp *r1
+stop
+L157: mov r0, r0
+L158: .data -200
+L159: lea L144, r4
+L160: .string "tbheqihssgpskgujca"
+clr r1
+L161: .data -649, 184, 733, 319, -887, -134, -901, -58
+L162: rts
+L163: stop
+prn *r5
+jmp L69
+prn *r7
+red *r4
+L164: .data 884, 405, 664
+L165: add r4, r1
+L166: clr L84
+add r1, *r0
+prn L92
+L167: mov r1, *r1
+prn #86
+not r4
+L168: clr L28
+add L128, *r5
+inc L25
+clr r5
+lea L0, r2
+clr r4
+mov r2, *r0
+L169: lea L167, r4
+L170: .string "qqoey"
+cmp L93, L56
+
+L171: .string "tovakxdamgfvpijdpj"
+lea L25, *r5
+not r0
+L172: .string "dhdscuevme"
+prn #250
+jsr L104
+jsr *r0
+prn #130
+sub L99, L101
+; comment
+L173: bne *r3
+L174: .string "cnrxcqzbbaxjwplynmfrm"
+prn #-109
+lea L69, L40
+L175: dec *r2
+L176: .string "slyebrvgdcro"
+rts
+sub *r7, L79
+L177: inc L37
+L178: jsr *r1
+inc r4
+
+cmp r3, r0
+inc r4
+not *r5
+L179: clr *r0
+L180: dec *r7
+bne *r4
+rts
+L181: clr *r6
+clr r4
+
+L182: clr r1
+add L109, L98
+L183: .data -982, -311, -943
+L184: dec r0
+sub *r3, *r1
+sub *r6, r7
+jsr L90
+cmp r5, *r4
+bne L26
+stop
+dec L112
+L185: .data -323, -241
+L186: dec r2
+L187: prn #-189
+bne *r5
+; comment
+mov r4, *r5
+L188: lea L146, *r0
+add L173, r0
+cmp #-99, r5
+dec L65
+mov *r5, r5
+
+L189: bne *r2
+stop
+L190: rts
+L191: inc r2
+L192: sub #76, *r5
+lea L21, r3
+clr r2
+L193: stop
+rts
+L194: lea L75, *r1
+jsr L146
+L195: stop
+rts
+L196: jmp L4
+bne L78
+mov *r5, *r2
+lea L136, r3
+L197: stop
+; comment
+jsr *r0
+sub r0, r2
+clr r0
+jsr *r7
+jsr *r7
+L198: lea L133, L36
+; comment
+L199: inc *r1
+mov L167, r5
+L200: clr r4
+L201: add *r4, r7
+jsr *r4
+jmp *r7
+jsr *r7
+add #-11, L20
+clr *r6
+dec r2
+
+jsr *r5
+; comment
+L202: red r4
+L203: inc *r3
+bne *r5
+sub *r1, r2
+
+bne *r6
+rts
+jmp L132
+L204: red *r5
+mov *r4, L14
+clr L85
+L205: sub L197, L115
+jsr L124
+sub #-248, r7
+red *r1
+red r7
+stop
+L206: .data -537, -98
+prn L38
+dec *r1
+cmp *r1, *r5
+sub #208, L120
+L207: .string "qdotmupvjklxyaivudechh"
+dec *r3
+L208: cmp *r1, r6
+rts
+L209: bne *r6
+L210: clr *r2
+bne *r2
+L211: sub #-253, L42
+L212: .string "vblljarncatlmtb"
+L213: stop
+L214: .data 176
+jmp *r4
+
+L215: lea L179, r2
+L216: .data -241, 676
+inc *r4
+
+jmp *r5
+L217: red r0
+L218: .string "bvmkvzlzlvjncupgov"
+
+stop
+L219: red L57
+L220: mov L126, r5
+bne L200
+stop
+bne *r1
+L221: jsr L59
+inc *r1
+jmp L29
+clr L41
+prn L157
+cmp #-237, #18
+add L32, *r6
+jmp *r2
+L222: add L220, L26
+lea L194, *r5
+bne *r0
+dec *r1
+L223: .string "u"
+not *r7
+jsr *r2
+cmp *r3, #126
+L224: inc r0
+L225: .string "jcybvydgzainxyrha"
+add r4, *r4
+dec *r1
+lea L49, L181
+red r3
+jmp L131
+prn L72
+L226: inc *r4
+add L96, *r1
+not r4
+L227: rts
+clr r5
+rts
+lea L122, *r2
+L228: jmp L113
+L229: dec L3
+L230: sub #136, r4
+rts
+cmp #-123, #165
+not r5
+bne *r4
+cmp r7, *r0
+L231: .data 83, 818, 948, 920
+mov #74, r4
+red r0
+cmp *r2, r4
+not *r7
+prn L79
+L232: bne L32
+dec L123
+L233: mov #-22, *r2
+L234: .data -598, -31, -268, 314, 520
+mov r7, *r1
+L235: .data 768, -121, 528
+clr r2
+L236: mov #-68, r2
+dec *r5
+sub #152, r0
+add r1, *r0
+L237: not *r3
+add r3, L224
+L238: .string "mrtzqjscrhwwgxjxwsdkmus"
+add L189, r1
+not L175
+inc L200
+jmp L192
+jsr *r3
+L239: jsr *r2
+L240: bne *r7
+jmp L124
+dec L224
+not *r3
+L241: inc r2
+jmp *r4
+
+sub #-128, r6
+L242: .data -625, -347, 97, 372, -828, -347, 478
+L243: .string "lodkclxzspiwrrbi"
+L244: cmp #141, #189
+
+
+not L222
+jmp L192
+L245: inc *r4
+cmp *r5, *r3
+L246: bne L51
+stop
+L247: jmp *r4
+add r4, r2
+sub L171, *r6
+cmp r4, *r2
+stop
+jmp L212
+rts
+L248: stop
+
+prn r7
+L249: dec L80
+mov L131, *r6
+L250: .string "bpgervzgxtgllpvawpbyhhf"
+cmp L30, L28
+L251: add r0, *r7
+cmp L239, L13
+sub *r0, r7
+rts
+sub *r7, *r7
+not r3
+bne *r3
+L252: .string "xsozhtiaxspkrwqeawyersot"
+red r7
+L253: stop
+clr r3
+prn *r2
+stop
+inc r6
+L254: red *r7
+L255: stop
+jsr L218
+L256: .string "hyofztkdzabwspgyvcppinn"
+cmp #-253, L119
+L257: sub *r0, L220
+L258: red r6
+L259: .string "bjwihxzveccupzxxc"
+L260: cmp #81, #57
+prn #-207
+L261: .data -243, 984, 555, -153, 347, 329, -651, -669
+L262: prn *r6
+; comment
+jmp L231
+L263: clr L196
+dec L49
+cmp #121, *r7
+cmp r2, L166
+L264: red r5
+L265: .string "cpnsjzultkom"
+L266: jsr L194
+L267: cmp *r3, #-182
+rts
+
+
+clr L70
+sub r0, L169
+prn #17
+mov #185, r7
+L268: clr *r7
+inc *r0
+stop
+L269: lea L165, r1
+stop
+L270: red *r3
+cmp #164, *r7
+bne L200
+L271: .data 495, -698
+sub *r1, r0
+L272: add L6, L80
+L273: red r4
+L274: not L40
+L275: .string "blatzsevwdypfj"
+L276: .data -148, -272, 442, 460
+; comment
+L277: add r1, *r3
+L278: .data 6, -66, -722, 252, -661
+bne *r7
+L279: jsr *r5
+red r4
+cmp #-135, #242
+stop
+bne L12
+mov L72, r3
+sub #138, *r4
+jmp L71
+add L244, L260
+inc L188
+; comment
+L280: clr *r4
+jmp L82
+L281: cmp *r3, r4
+rts
+jsr *r7
+L282: not L61
+jsr *r3
+inc L223
+mov L244, r7
+bne *r7
+L283: .data 843, -515, -662, -488, 892, 694, -940, 775
+clr L227
+L284: jmp *r4
+rts
+L285: cmp #224, *r3
+bne *r2
+rts
+bne *r3
+bne L197
+L286: sub r7, L280
+; comment
+rts
+dec r4
+not *r0
+L287: jsr L256
+cmp #-253, #96
+L288: lea L36, r0
+sub L71, L241
+L289: mov r5, r0
+
+jmp *r5
+L290: .string "g"
+
+L291: add *r6, *r6
+L292: dec L89
+mov #160, L24
+not r1
+L293: mov L237, L79
+L294: prn #154
+L295: inc r6
+prn r0
+mov r2, r5
+rts
+L296: .string "zvwpntzyfpidb"
+L297: rts
+L298: sub r1, r6
+prn r1
+L299: .data -286, -399
+mov #113, r4
+mov *r0, L131
+L300: red r1
+clr L49
+mov #-74, L6
+rts
+L301: inc r2
+L302: .string "qbbujfughky"
+L303: mov *r2, r1
+L304: add #182, L278
+bne *r2
+dec L241
+mov *r0, r6
+L305: stop
+; comment
+L306: inc *r4
+
+add r6, *r7
+L307: .string "hsuacifrbwupcam"
+L308: rts
+not r5
+L309: .data 477, 733, -293, 310, -155, -658, -736
+red *r5
+L310: .data -319
+inc L85
+dec L250
+stop
+L311: bne *r4
+lea L271, *r2
+jsr *r5
+
+prn *r2
+jmp L28
+rts
+inc *r2
+L312: red r6
+red r3
+bne *r7
+inc L304
+L313: mov #183, r1
+L314: rts
+
+jsr L243
+L315: jsr *r7
+inc L242
+mov r7, L102
+jmp L237
+inc r5
+lea L190, *r6
+sub #22, *r1
+jmp *r4
+clr r5
+L316: sub r5, *r6
+L317: cmp L315, r6
+L318: prn L278
+mov r2, r4
+L319: jmp L201
+prn #-50
+
+jsr L133
+stop
+L320: clr L272
+L321: clr *r0
+L322: add L56, r2
+stop
+L323: not *r2
+not L62
+lea L60, r5
+prn *r0
+clr L300
+
+rts
+inc r6
+cmp r5, r5
+L324: dec r5
+L325: clr *r6
+L326: rts
+mov L202, *r1
+lea L280, L293
+bne L68
+L327: inc *r6
+dec r3
+rts
+inc L206
+red *r2
+L328: .string "ogvrnsvcxievyixyamjygcx"
+L329: prn L64
+red r3
+L330: bne *r3
+L331: .string "aqcbmgzjtdltxujbkta"
+L332: .data -443, -738, -345, -761, 463, 990, 163, 896
+dec *r4
+
+; comment
+L333: add *r1, r3
+inc L144
+L334: red r7
+L335: stop
+rts
+inc L111
+lea L296, L196
+rts
+red L74
+; comment
+clr r0
+rts
+sub #184, *r4
+L336: rts
+L337: .string "bttproaesttqaueorrbc"
+L338: .string "cfffnp"
+add #225, L247
+sub r1, *r0
+lea L307, r7
+clr L246
+red r1
+stop
+clr r2
+sub L48, r5
+L339: rts
+bne L112
+L340: lea L301, L39
+
+L341: .string "wjiugwip"
+L342: lea L229, *r2
+cmp L86, r7
+not *r4
+L343: jsr L226
+cmp r1, L220
+; comment
+L344: stop
+mov *r1, *r4
+inc r2
+mov *r5, r1
+mov L39, L51
+lea L175, *r5
+L345: .string "akwqi"
+jsr *r6
+; comment
+red r4
+mov r0, r0
+dec *r3
+inc r2
+bne *r7
+L346: .string "cukhsabxynnmbpjnmreb"
+clr r7
+mov L285, r2
+L347: stop
+add *r6, r5
+L348: dec *r1
+; comment
+jmp L269
+jmp L148
+L349: add #-149, L259
+prn #159
+sub L161, *r6
+prn #-58
+mov #172, L86
+L350: .data -172, 52, 125, 350, 405, 867, 840
+
+sub *r4, r0
+stop
+L351: .string "wkfmywkfhkhx"
+jmp L87
+L352: clr r2
+
+L353: .data -171, -388, -178
+mov L215, *r3
+stop
+red *r4
+rts
+jsr L65
+
+clr *r5
+stop
+L354: stop
+sub *r6, r0
+L355: dec r2
+L356: .data -802, 246, 920, -35
+lea L226, r4
+L357: jsr *r5
+mov r6, r2
+not L179
+lea L81, r2
+L358: .string "mqcubowzic"
+L359: rts
+sub *r2, r6
+mov *r4, *r4
+L360: .string "gfcjhuexcbnpjegncfajovl"
+sub #-242, L96
+sub *r4, *r5
+L361: not L189
+clr r3
+jmp *r1
+L362: .string "jimlfxlkotpihsjhvngti"
+sub r2, r7
+jsr L255
+dec r0
+lea L50, *r3
+
+mov r7, r2
+jmp *r2
+L363: not r2
+dec r3
+jmp *r1
+L364: rts
+L365: dec r3
+L366: mov L234, *r0
+stop
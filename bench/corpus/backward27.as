@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 28
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+L0: jsr *r2
+bne *r0
+; comment
+L1: lea L1, L0
+clr *r4
+stop
+L2: sub L0, r4
+inc r5
+jmp *r7
+red L0
+add *r2, r7
+jmp L0
+L3: not L1
+L4: cmp *r5, *r0
+L5: .data -52, 204, -83, -224, 921
+
+mov *r7, L1
+jmp L5
+clr L3
+dec *r3
+
+L6: dec *r3
+inc r7
+L7: clr *r5
+L8: dec L4
+dec L8
+L9: jmp L7
+inc L3
+sub *r0, L8
+L10: add r2, r3
+red L6
+L11: .data -463, -323, -835, -800
+L12: .data 668, -998, -232, -595, -109, -555, -890
+L13: sub #40, *r4
+sub *r0, L11
+
+L14: dec r7
+rts
+sub L3, r4
+mov L8, r1
+sub L2, r2
+mov *r2, L10
+; comment
+L15: mov *r3, L1
+stop
+L16: not L10
+clr L7
+L17: add r7, *r5
+sub #-157, *r3
+inc L1
+L18: red L11
+L19: .data -44, -157, -325, -992
+lea L17, r0
+lea L13, *r3
+L20: inc r6
+L21: jsr L18
+L22: .data -664, 74, -854, 35, 139
+red r2
+
+rts
+add r1, r7
+bne L22
+not *r6
+sub #184, r3
+stop
+L23: .string "iyvqrra"
+lea L3, *r3
+lea L23, r6
+jmp *r7
+red L20
+L24: .string "sovcnhiafts"
+mov *r1, r4
+L25: jmp *r5
+jsr L3
+L26: .data -179, 959, 620, -799
+; comment
+dec *r0
+L27: inc r0
+L28: dec *r0
+L29: dec *r1
+cmp *r0, #30
+prn *r0
+not *r5
+
+mov #-162, L17
+mov #-161, *r1
+L30: not *r6
+prn *r3
+prn r4
+; comment
+L31: .data -528
+bne L7
+red L28
+cmp L31, L8
+L32: add L15, L17
+L33: stop
+L34: .data 738, -234, 738, -727, 432
+L35: .string "vhpxqqqt"
+
+L36: .data 956, -408, -587
+red *r3
+add r3, r1
+rts
+L37: .data -958, -249, -974, -130, 267, -705, 586, -736
+bne L11
+L38: .data -168, 702, 117, 317
+L39: lea L29, L34
+L40: inc L5
+bne L34
+L41: clr L41
+L42: jmp L39
+L43: add #163, *r6
+stop
+cmp #134, L40
+not L8
+lea L24, *r0
+
+mov *r4, L39
+L44: add L17, r1
+cmp #-87, r4
+red r4
+L45: stop
+add *r2, r1
+jsr *r7
+L46: inc L2
+L47: bne *r2
+sub *r4, *r5
+L48: red *r5
+L49: inc *r7
+prn r4
+L50: add #35, r6
+L51: .data -114, 863, -479, -428, 541, 577, -157, -608
+L52: mov r6, *r2
+L53: inc *r0
+clr L13
+L54: cmp *r4, L48
+L55: .data 561, 846
+red *r7
+bne L21
+sub r1, L27
+L56: .data -327
+jsr L24
+L57: cmp *r5, r5
+prn r6
+cmp r4, L57
+add L40, L42
+prn r7
+sub r6, *r4
+L58: .data 34
+lea L31, L44
+L59: .data -67
+mov r3, L14
+bne L1
+L60: stop
+add r4, r1
+jmp *r5
+L61: .string "vfoxtjb"
+L62: lea L30, r5
+L63: jsr *r3
+add L18, *r2
+L64: red L6
+sub L5, L52
+stop
+L65: .string "okqldbcpqmtn"
+bne L2
+add r7, *r3
+L66: jsr L15
+L67: bne *r4
+lea L55, L38
+jsr *r0
+cmp *r0, *r2
+jsr L31
+L68: dec *r7
+L69: .data -464, 862, -529, 737, 325, -633, 262, 395
+lea L42, r4
+L70: rts
+prn r7
+L71: red r3
+prn r6
+L72: inc *r6
+L73: jmp L20
+stop
+jsr *r6
+prn L29
+add *r4, r7
+add *r6, L1
+L74: cmp L61, r0
+; comment
+rts
+L75: rts
+
+red r0
+prn L60
+L76: prn *r0
+lea L35, *r2
+red L71
+L77: .string "xhhdduwfjyyqgioszkisisl"
+add #175, r4
+clr *r1
+prn r0
+bne L12
+L78: jmp *r3
+red L47
+L79: .string "srxwuzveathwuulszttg"
+L80: dec L63
+jsr *r1
+L81: prn L29
+L82: .data -22, -641, -598
+prn #-77
+stop
+L83: mov *r0, *r4
+mov r0, L66
+L84: clr *r4
+bne L27
+clr L34
+not r7
+stop
+prn r7
+L85: rts
+mov #12, L10
+L86: .string "oxyhplplkqkzilcmqyakwm"
+L87: .data 847, -562, -933, 898
+L88: red L68
+L89: .string "abcjmngurtzlcvecdpvomhx"
+mov r4, *r4
+red r3
+L90: mov #84, L21
+dec *r2
+bne *r1
+mov r0, r4
+add #-61, r2
+jsr L27
+mov L22, L21
+bne L56
+L91: mov #-148, L23
+inc *r2
+stop
+lea L78, r4
+
+L92: jsr L91
+red *r1
+L93: .string "kwoeliwzmhargioj"
+cmp *r1, L56
+
+prn r5
+clr L89
+lea L15, r5
+dec *r4
+red *r3
+clr r3
+L94: clr L70
+mov *r1, L91
+rts
+prn #106
+lea L6, r4
+L95: dec r4
+L96: .string "tt"
+cmp *r5, r1
+mov L76, *r6
+L97: rts
+L98: .data 480, -282, -730
+L99: rts
+mov L14, L17
+red L8
+clr r1
+L100: prn r7
+sub #150, r7
+prn r6
+clr L3
+bne L47
+; comment
+not L42
+not *r3
+jmp L86
+rts
+clr L68
+add *r3, L72
+bne *r5
+jsr L35
+red r4
+rts
+L101: .data 174, -497, -936, 253, 499, 120, -559
+L102: .string "ihuhitapevzyzfcavj"
+L103: red L87
+
+cmp #95, r7
+jmp L55
+L104: sub *r2, *r4
+prn *r7
+inc r3
+L105: lea L26, r2
+jsr L67
+stop
+not *r2
+cmp L90, *r5
+not r5
+prn L15
+dec r7
+; comment
+prn #-228
+jsr *r7
+inc L44
+jmp L51
+L106: clr *r2
+L107: .data -831, -568, 671, 836
+not *r4
+cmp #221, *r6
+L108: stop
+L109: .string "pxuumqkeontcopwcry"
+L110: jsr L27
+sub #77, r2
+red *r5
+inc *r6
+prn L28
+L111: rts
+mov L71, L71
+cmp *r1, L53
+L112: stop
+jmp *r1
+clr L91
+sub r5, *r4
+jsr *r7
+lea L105, r1
+L113: inc r2
+not r3
+L114: .data 614
+sub r5, *r7
+L115: jsr L1
+L116: .string "uctflqrjpvhzmcvgwkyy"
+add L46, L34
+L117: prn *r1
+
+L118: cmp #-131, r0
+; comment
+L119: jsr *r6
+L120: .string "eupuolltz"
+dec *r3
+
+cmp *r5, *r6
+inc L44
+clr *r3
+inc r3
+bne L15
+cmp *r7, r6
+
+sub r1, *r0
+jsr L43
+
+cmp L60, *r7
+L121: bne L35
+not *r3
+L122: .data 79, 345, -165, 13, 148, -900, 554
+L123: inc r0
+not *r5
+red *r3
+jmp *r1
+L124: rts
+lea L30, *r6
+L125: .data -14, 456
+dec r3
+cmp #138, #115
+cmp L6, *r6
+jmp *r0
+L126: .data -715, -603, 450
+rts
+L127: lea L105, L118
+inc *r1
+rts
+mov #232, r7
+L128: add *r6, *r2
+L129: rts
+add r4, r4
+; comment
+sub *r7, r3
+sub r5, r6
+cmp L84, #244
+sub L92, L50
+jmp L47
+L130: .data 939, 182, -167, 262, -418, 356, 414
+L131: .string "bwhbhntpo"
+red r3
+L132: jmp *r4
+rts
+L133: .data 958
+clr r0
+not *r5
+L134: .string "mylax"
+clr L3
+prn *r7
+stop
+L135: .data 167, -418, 817, -992
+jmp L43
+L136: .data 447, 231, -984, -678, -781, 151, -913
+inc L129
+prn r3
+L137: lea L41, L33
+jmp *r0
+cmp *r7, *r3
+sub *r2, r3
+prn *r6
+jmp *r7
+sub L125, *r2
+add r7, L126
+L138: mov L42, *r4
+L139: not *r3
+jsr *r0
+cmp r0, r7
+
+inc *r6
+jmp L132
+mov *r7, L78
+
+L140: bne L69
+cmp *r1, #151
+lea L122, L117
+prn *r1
+L141: mov *r5, L87
+not r3
+L142: red L63
+L143: .data 673, 746, -956, 639, -283
+stop
+jmp *r1
+prn *r7
+; comment
+dec L92
+L144: .data -423, -149, -791, 930, 315
+bne L111
+clr L33
+L145: prn #-148
+clr *r5
+stop
+sub #-224, L71
+rts
+mov *r3, r5
+L146: cmp #-215, L4
+prn *r3
+L147: mov *r3, *r4
+lea L143, *r5
+L148: clr L65
+L149: stop
+; comment
+L150: stop
+mov r0, L85
+mov #48, r6
+L151: dec L12
+rts
+L152: lea L33, *r3
+cmp *r7, L125
+sub *r4, *r1
+add r7, *r6
+clr L45
+rts
+not r2
+sub *r7, *r5
+L153: lea L133, r7
+L154: stop
+clr *r1
+add r4, *r1
+L155: sub r2, *r3
+lea L136, *r1
+lea L86, L7
+mov #95, r2
+L156: .data 812, 314, 531, 556, -428, -953, 169, 293
+mov *r4, *r7
+stop
+L157: inc L146
+L158: .data 491, 106, 569, 435, -91, -791
+jmp L67
+L159: lea L93, *r4
+L160: .string "aglhkapidwa"
+prn #59
+bne *r3
+inc r7
+L161: jmp *r7
+clr r1
+L162: .string "wzq"
+mov #-122, r1
+sub #-157, r6
+L163: bne *r0
+add *r1, *r4
+L164: rts
+bne *r5
+; comment
+L165: clr r3
+L166: dec L117
+L167: jmp *r1
+rts
+add L134, r0
+rts
+L168: lea L164, *r7
+add L117, *r2
+prn #30
+L169: not r3
+inc *r7
+lea L72, L21
+mov r7, r4
+L170: dec r2
+clr r2
+L171: mov L148, *r7
+L172: .data -579, 995, 340, 851, -479, -100, -768, 68
+cmp r6, *r0
+L173: prn r1
+inc *r0
+clr L155
+not L20
+L174: rts
+lea L130, L145
+dec *r5
+not r4
+clr *r6
+red L119
+L175: stop
+sub *r4, *r5
+jmp L26
+L176: rts
+clr r0
+prn r6
+L177: clr r3
+sub *r3, L171
+L178: add r7, r4
+red L54
+not r7
+prn r0
+L179: .string "armawugghvvgquybikjae"
+L180: .string "ddls"
+not L101
+bne L151
+not r0
+L181: red r5
+add #96, *r6
+dec *r3
+clr L27
+L182: red L56
+jmp *r4
+jsr L143
+
+; comment
+inc r1
+L183: add L71, *r6
+L184: lea L1, *r2
+inc L62
+mov r6, L181
+L185: stop
+L186: red L67
+red r6
+not L87
+L187: red L35
+cmp r2, #-254
+L188: mov r5, *r4
+L189: clr L113
+inc L34
+L190: .data -78, 594, 316, -528, 565
+lea L5, r6
+jsr *r7
+dec L173
+red L141
+dec r5
+rts
+inc L189
+prn *r7
+sub *r1, r1
+cmp #-62, r7
+L191: prn *r2
+inc L14
+rts
+L192: cmp r3, #216
+
+mov L28, L156
+jsr *r1
+sub *r6, r2
+add #250, r7
+rts
+L193: cmp *r2, *r5
+L194: inc L11
+mov r6, r2
+red L70
+L195: .data 509, -428, 34, -456, 787, 375
+red L98
+lea L110, r7
+L196: not *r0
+sub *r7, *r6
+red L47
+add #-4, r3
+bne L138
+L197: red *r5
+inc *r1
+stop
+lea L39, r5
+dec *r5
+L198: .string "xlkqfnpuwxbuennfgwev"
+L199: .data -290, 975, -936
+L200: lea L24, r0
+sub #-224, r2
+red L144
+dec *r1
+lea L180, r6
+jmp *r4
+rts
+L201: .string "nqcmx"
+L202: add #197, L193
+jmp *r0
+inc *r2
+jmp *r1
+L203: add *r0, L68
+prn L54
+rts
+bne L150
+add *r2, *r6
+rts
+dec r2
+sub *r2, r4
+dec r7
+lea L28, L118
+L204: red L200
+inc *r7
+bne *r2
+L205: sub *r1, r1
+jmp *r3
+jsr *r1
+mov #205, *r7
+rts
+mov L95, L25
+add L51, r1
+L206: red *r5
+red *r2
+dec *r1
+L207: not *r0
+rts
+L208: .string "oaauonuixcycsncuy"
+mov L113, r0
+bne L204
+L209: rts
+prn r7
+L210: clr r3
+red L158
+L211: .data 19, 689, 98, -710, 545, 376, -821, -885
+jsr L165
+; comment
+jsr *r1
+lea L80, *r0
+jmp L97
+bne L202
+rts
+stop
+jmp *r5
+lea L74, *r3
+cmp *r4, r6
+; comment
+; comment
+L212: .string "eovu"
+prn #201
+L213: not L178
+bne L20
+jsr L142
+L214: not L101
+L215: mov L112, *r1
+inc r3
+L216: add #-153, L165
+clr L8
+L217: sub L22, r2
+add #82, *r3
+jsr *r4
+L218: red r0
+cmp *r1, #147
+L219: stop
+not r1
+L220: not L89
+sub *r6, r6
+jsr *r7
+lea L161, r1
+not L15
+L221: jsr L79
+
+L222: cmp #219, *r5
+L223: cmp r4, r6
+lea L154, L7
+dec *r5
+L224: jmp *r7
+sub L209, L113
+L225: cmp r1, #-142
+jsr L193
+L226: lea L48, r2
+L227: .data -721, -192, -676, 356, 993, 415, -485
+L228: dec L194
+prn #102
+bne L57
+L229: not *r2
+L230: lea L160, L82
+cmp *r0, *r1
+L231: not L171
+L232: .string "dkcrwsswrllrzmdsvwnll"
+L233: .data -961, 214, -864, 469, -543, -635
+sub #-52, *r3
+L234: prn #-124
+jmp L54
+L235: .string "mkudmounabvmpcnokdbho"
+not *r5
+L236: jsr L52
+L237: .data 830, 110, 211, 464
+L238: inc *r3
+inc *r0
+bne *r3
+L239: .string "snmguynkeeojhdtchbdcsf"
+rts
+inc L130
+L240: .data 252
+L241: mov #-191, *r3
+dec r3
+sub *r7, *r2
+L242: not *r0
+L243: .data -88, 658, -744, 917, -240, -110, 774
+L244: dec L238
+prn #-92
+lea L6, L73
+dec *r0
+L245: lea L67, r7
+rts
+L246: bne *r0
+; comment
+inc r7
+L247: red *r6
+L248: .data -223, 81
+L249: .string "venuyoaoteljrg"
+bne *r1
+L250: red L38
+red *r7
+L251: red r5
+jmp *r4
+bne L162
+jmp *r2
+L252: add r4, r2
+jsr L230
+rts
+; comment
+L253: jmp L219
+lea L31, *r3
+L254: .string "mcchib"
+L255: inc r6
+cmp #-97, r5
+not *r6
+L256: .string "lbvxxaohkfepoeyqmafa"
+lea L185, r7
+jsr *r2
+L257: jsr *r4
+L258: clr r3
+sub r1, *r1
+jsr L163
+stop
+sub *r4, L187
+L259: bne L235
+L260: lea L62, L55
+L261: add #-2, r6
+stop
+L262: clr r0
+cmp *r7, *r3
+lea L182, r7
+not *r7
+cmp r2, r0
+L263: dec *r6
+stop
+clr r4
+lea L235, *r3
+mov r4, r2
+rts
+lea L177, L4
+mov r2, r6
+L264: cmp *r1, r1
+rts
+L265: sub L120, *r2
+L266: jmp *r7
+L267: .data 771, 107, 494, -394, 113, -419, 918, 101
+L268: add r3, *r7
+add L246, *r5
+prn #-58
+bne L208
+L269: prn *r4
+bne L105
+L270: .string "npypaxj"
+not *r4
+; comment
+L271: bne *r7
+jsr *r3
+L272: dec r4
+red *r3
+bne *r4
+sub #55, r0
+cmp r7, r7
+L273: clr L263
+sub r4, r3
+L274: .data 358, -753, -465, -924, -933, 826, 719
+prn #50
+jmp L19
+bne *r4
+mov r1, L53
+L275: lea L164, L222
+L276: stop
+cmp *r4, L190
+cmp #30, *r2
+bne L222
+lea L262, L36
+; comment
+L277: red L264
+mov #-104, r1
+L278: prn r5
+red r5
+L279: .string "vyhruawf"
+L280: dec *r0
+jmp *r7
+L281: add L187, L266
+add r6, *r3
+rts
+L282: add r1, L83
+L283: .data -46, 136, -788, 202, -93, -367
+L284: stop
+red *r0
+rts
+L285: cmp #-92, *r6
+clr L215
+sub L24, r3
+red L212
+jmp *r1
+L286: .string "zoswxttkytziliz"
+L287: mov *r6, L140
+add #252, L64
+dec L59
+L288: .data -904, 603, 770, 328, -772, -605
+jmp L65
+L289: dec r1
+prn L12
+jmp *r1
+prn L197
+L290: .data -57, 460, 549, -552, 457, -678
+red L201
+prn r2
+L291: jsr *r2
+prn #-223
+L292: jmp *r2
+; comment
+cmp #-78, #73
+cmp r3, r1
+cmp r3, *r0
+not r7
+red L288
+prn #78
+not L112
+L293: jmp L115
+L294: bne L100
+add r0, *r6
+L295: add r7, r2
+clr *r3
+red *r6
+L296: not r5
+L297: sub L86, *r7
+; comment
+bne L132
+L298: sub L89, L72
+bne *r4
+mov r7, r0
+L299: not L152
+L300: inc *r7
+cmp r5, L266
+L301: add r4, L106
+dec L143
+lea L228, L190
+stop
+L302: lea L173, *r0
+
+stop
+L303: inc *r7
+prn #187
+L304: red *r0
+L305: cmp #166, L203
+jmp L233
+L306: .string "wymbjtuoyv"
+L307: .data 197, 923, -654
+add #229, L210
+L308: not L175
+red *r7
+clr L149
+stop
+L309: prn L272
+L310: .string "iuamyqpnbeqh"
+L311: add #-169, L114
+sub L31, *r4
+not *r1
+L312: .data -443, 124, -444, -319, 924, -894, -781, 972
+jmp L156
+red L255
+L313: .data 812, 964, 670, 902
+L314: .data -87, 104
+jsr *r2
+L315: not *r2
+prn L112
+jmp L134
+inc L160
+clr *r7
+rts
+clr L123
+L316: cmp #177, L93
+L317: mov L105, L124
+L318: dec *r2
+not L244
+L319: .data -463, 369, 449, -862, 380, -642
+bne L30
+sub *r2, *r1
+L320: .data 940, 933, 320, -942, 822, 451, 813
+
+jsr L45
+L321: red r6
+L322: bne *r4
+lea L239, *r3
+clr L269
+rts
+add r1, L265
+L323: red L72
+stop
+L324: add r4, r3
+L325: mov *r3, r4
+cmp *r1, r6
+bne L147
+lea L179, r2
+not *r4
+lea L48, L271
+L326: cmp *r2, #-140
+bne L218
+L327: red *r4
+L328: not r4
+jmp *r1
+clr *r1
+dec *r5
+L329: .string "oectblahcmfammuavmlptd"
+jmp L121
+L330: bne *r2
+add L182, *r1
+rts
+rts
+lea L79, *r1
+L331: stop
+bne *r0
+dec *r4
+cmp #39, L148
+L332: jmp *r5
+dec L320
+sub *r3, r7
+L333: .string "e"
+cmp L205, r2
+stop
+L334: mov L48, r5
+clr *r3
+L335: rts
+bne L325
+rts
+clr r5
+L336: stop
+prn *r5
+L337: red *r2
+L338: .string "tatfstfgtjhsu"
+bne L328
+bne L271
+dec L167
+sub *r2, *r7
+bne *r1
+inc r2
+L339: .string "dhzg"
+L340: red r6
+L341: red r4
+stop
+mov L149, r0
+lea L82, *r0
+stop
+mov *r4, *r2
+L342: dec L145
+jmp L76
+add #223, r7
+bne L184
+jmp L334
+L343: not *r6
+L344: prn L233
+sub L232, *r3
+L345: bne L217
+L346: add #-170, *r6
+; comment
+L347: cmp *r0, L70
+L348: bne *r7
+jsr L188
+L349: rts
+L350: not *r5
+L351: clr *r5
+L352: not r0
+L353: .data -912
+dec r4
+L354: .data -495, -513, 808, -685, 338
+prn r4
+L355: dec *r0
+jsr *r0
+L356: cmp r7, *r4
+L357: lea L168, *r7
+clr r6
+L358: .data -128, 198, 177, 783, -951, 753, 463, 962
+inc *r0
+stop
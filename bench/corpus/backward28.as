@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 29
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+red r4
+L0: mov L0, L0
+L1: sub L1, *r7
+sub L1, *r3
+L2: .data -4, 778
+
+inc L0
+rts
+lea L2, *r1
+L3: .string "sblocnx"
+L4: .data -371, 692, -274, 614, 829, 239
+L5: red *r3
+not *r6
+red L5
+bne *r4
+clr r5
+not r4
+L6: .data -417
+bne L5
+red r4
+red *r4
+mov r1, *r2
+rts
+stop
+L7: .string "fuhrzno"
+L8: add L4, L5
+L9: .string "nyxvvmmut"
+L10: not r0
+L11: clr *r3
+add #132, L9
+bne L8
+L12: bne *r2
+mov L1, *r1
+lea L3, r7
+L13: .string "knb"
+L14: clr r1
+L15: .data 236, -187
+L16: rts
+inc r3
+
+clr *r4
+dec r4
+L17: dec L7
+jsr *r7
+L18: stop
+sub *r2, *r4
+cmp *r1, #96
+lea L1, *r3
+jmp *r6
+prn *r0
+mov *r3, *r2
+add L17, *r5
+jsr L0
+stop
+L19: .string "zpqabxfwoztasj"
+L20: red r0
+bne L13
+L21: .data 308, -452
+L22: jmp *r1
+clr L20
+jsr L12
+L23: .string "yigbbhxngc"
+L24: jmp *r2
+sub #16, *r6
+jsr L7
+lea L6, *r5
+L25: jmp *r4
+cmp r0, L5
+bne L21
+mov r1, *r6
+L26: dec L9
+L27: lea L5, L2
+cmp L5, L27
+lea L23, L17
+dec L4
+
+red L22
+inc *r6
+L28: .data -520, -187
+cmp #105, #-133
+mov *r4, L0
+L29: red *r2
+lea L21, r4
+prn #98
+L30: sub r2, L0
+rts
+red *r0
+mov *r4, L29
+dec *r3
+not L4
+lea L30, *r3
+rts
+L31: not L26
+bne L2
+add L10, L29
+; comment
+jmp *r7
+rts
+L32: prn #39
+not r0
+L33: cmp L32, r2
+
+L34: .string "ueordnohgkaanjiyduyiq"
+inc r6
+add r3, r7
+L35: .data -597, -555
+L36: lea L14, *r3
+jsr *r4
+not L11
+L37: .string "navlzpmqemtbmrsw"
+; comment
+clr L14
+red *r5
+not L14
+not r6
+jmp *r0
+cmp L13, L26
+L38: clr r7
+L39: clr *r7
+
+L40: prn L9
+; comment
+L41: .string "pswmgdfcvo"
+inc *r0
+rts
+L42: sub *r0, r3
+red r0
+L43: add L29, L24
+L44: mov #241, r4
+jmp *r5
+rts
+jsr L22
+add L2, *r7
+L45: jsr *r2
+bne *r3
+L46: clr *r7
+sub *r4, r5
+L47: lea L35, L46
+inc *r2
+red L17
+mov L7, L46
+
+jmp *r0
+clr r7
+clr L5
+jmp L0
+L48: dec *r6
+inc r4
+inc r0
+L49: red L47
+L50: .string "bawxwmjqktmvgsso"
+; comment
+add *r5, r5
+jmp L27
+clr L37
+L51: jmp *r7
+add r6, L29
+rts
+L52: inc r3
+
+rts
+bne L31
+prn L12
+dec *r1
+inc r1
+dec *r7
+; comment
+L53: .data -113, -778
+sub L41, r7
+L54: red r5
+; comment
+L55: inc *r4
+L56: sub r0, r6
+stop
+rts
+dec r5
+bne *r6
+L57: .string "eidhmbjsagqslj"
+clr L45
+not *r7
+L58: jmp L18
+clr L19
+L59: clr r4
+L60: clr *r7
+add #106, r7
+red L46
+mov *r2, r2
+L61: .data 792, 730, -845, 893
+L62: sub *r5, r4
+inc L13
+bne *r2
+L63: stop
+add #-248, r6
+; comment
+L64: not L36
+not L1
+inc r5
+jsr L59
+L65: sub *r2, L37
+mov #238, r1
+add r4, *r0
+rts
+dec *r5
+jsr *r1
+L66: cmp #-227, #78
+L67: mov #-132, r3
+lea L40, *r3
+inc *r5
+stop
+L68: .data -996, -771, -943, 732, -653
+
+rts
+L69: mov L59, *r6
+L70: inc *r1
+prn *r6
+dec r1
+dec L29
+L71: red *r1
+stop
+L72: lea L1, *r7
+stop
+L73: clr r5
+L74: .data -238, 434, -630, -233, 875, -275, -364
+rts
+stop
+clr L53
+not *r7
+L75: .data -743, 861, 870
+L76: red *r6
+; comment
+not L40
+prn #9
+rts
+not r4
+L77: not *r4
+L78: .string "xhrhbciynmn"
+mov r0, *r2
+mov L57, *r7
+jsr L54
+inc r3
+L79: inc *r2
+
+L80: jsr *r7
+red L37
+L81: jsr *r4
+
+L82: prn r4
+L83: sub *r2, r3
+L84: .data 152
+cmp *r5, #28
+jmp L72
+L85: clr *r0
+L86: dec *r5
+L87: rts
+L88: .data -818, 661, -811
+L89: jsr L57
+inc L6
+L90: clr r4
+add *r7, L57
+mov r7, r6
+add L28, L17
+red r3
+stop
+L91: inc r4
+red L88
+L92: lea L32, r3
+dec r4
+; comment
+L93: not *r1
+L94: .data -569, 522, 464, 873, -600, -213
+
+stop
+L95: not L67
+L96: lea L47, L83
+
+inc r2
+clr r2
+
+L97: .string "gycdgpajbdouarqjptui"
+L98: rts
+L99: stop
+L100: .string "zkgyrjxmslmvnu"
+dec r2
+; comment
+inc L68
+stop
+L101: bne L13
+L102: mov #189, r4
+
+mov *r2, *r6
+L103: inc r0
+L104: clr r1
+mov *r0, r5
+L105: .string "ytrpuhbgd"
+L106: sub #-24, L28
+sub r1, *r4
+prn #168
+not L67
+
+L107: not r7
+dec r2
+
+clr r4
+bne L26
+not *r0
+dec *r0
+L108: .string "bzxvwouekknkx"
+dec *r0
+L109: cmp #-19, L90
+not *r1
+L110: clr r6
+mov #-186, L51
+lea L103, r6
+jmp L31
+mov #203, L57
+red L49
+inc r7
+L111: not L43
+
+prn L11
+mov *r7, r4
+L112: inc r0
+rts
+sub L13, *r5
+inc r5
+L113: clr *r7
+not r7
+jsr *r2
+L114: lea L105, L63
+L115: red *r4
+add r7, *r1
+cmp L53, #-81
+prn *r6
+L116: clr *r3
+add *r7, L15
+L117: .string "mecbqqlpejxgqmcwmnlej"
+jmp *r6
+stop
+rts
+inc *r0
+add #-71, L30
+add r0, *r5
+sub #37, L74
+prn L39
+clr r1
+L118: rts
+mov L71, r2
+add L10, r6
+sub *r6, L66
+L119: inc *r5
+sub #-222, *r2
+inc r5
+L120: red L38
+L121: sub r4, r0
+L122: .string "nkljlnmjnlmrpxaqzaqb"
+L123: dec r6
+red L74
+; comment
+L124: cmp #13, *r2
+mov L51, *r6
+dec r3
+L125: inc L110
+L126: lea L126, *r2
+inc *r3
+rts
+L127: .data -502, -766
+add r1, r1
+L128: inc L19
+dec r0
+L129: red *r2
+jsr *r5
+L130: red *r6
+bne *r3
+L131: rts
+bne *r6
+dec *r1
+inc r5
+L132: .string "zgksnuece"
+inc *r5
+L133: .data -78, -716, -248, 97, -230, 432
+
+add L55, L13
+; comment
+rts
+clr *r4
+lea L53, r5
+lea L68, L38
+jmp *r7
+L134: bne L116
+L135: .string "dpazuaymgyumm"
+jmp L95
+red r2
+not *r6
+prn L2
+not r3
+sub *r3, r7
+red *r5
+cmp *r6, r6
+dec r1
+clr r0
+bne *r0
+prn r2
+L136: jsr L133
+cmp r2, #-80
+; comment
+L137: mov r7, *r6
+
+cmp r4, r5
+rts
+clr L40
+jsr L60
+sub #-43, r7
+inc r4
+L138: cmp *r7, L126
+bne L108
+L139: red *r5
+bne *r2
+L140: .string "ypvplwladq"
+L141: .data -70, -126
+prn L109
+L142: not r3
+red L62
+L143: jsr *r2
+L144: .string "xgxhytxx"
+L145: clr r5
+L146: inc L133
+stop
+L147: .data 682, 481, 359, 502, 76, 56, 617, 637
+L148: cmp L2, #197
+
+L149: .data -219, 304
+L150: clr *r4
+lea L134, *r0
+stop
+sub *r2, *r6
+jsr *r2
+stop
+prn #111
+
+red L22
+clr *r1
+bne L110
+add L101, L34
+jsr *r2
+inc L108
+add L76, r5
+sub L87, r3
+jmp L38
+L151: add r0, *r0
+cmp *r3, r3
+L152: cmp #-148, r4
+
+L153: add *r4, r1
+add *r3, L131
+L154: stop
+add *r7, *r3
+sub #61, *r2
+L155: sub L33, r3
+
+prn L121
+L156: rts
+L157: .string "traqcjvxpi"
+mov #-19, *r0
+L158: mov #-144, L127
+L159: dec L85
+
+inc *r1
+prn L79
+clr *r0
+lea L58, r0
+add #154, L34
+stop
+cmp L125, *r1
+stop
+stop
+inc r1
+sub #209, L119
+L160: stop
+lea L62, *r3
+inc *r0
+stop
+L161: clr r5
+L162: .string "xlvqpkiyqwzhc"
+L163: not *r7
+L164: .data -965, -337
+L165: not r7
+cmp #219, #36
+cmp *r6, *r6
+add #-223, r7
+L166: dec *r5
+dec L28
+stop
+cmp L11, *r2
+L167: dec *r6
+bne *r0
+L168: .string "ziaprxhdcm"
+L169: stop
+prn L92
+bne L15
+
+jsr L17
+prn *r4
+L170: mov L66, *r2
+L171: cmp #12, #226
+L172: mov L46, r1
+L173: cmp L18, #-135
+L174: clr *r7
+L175: rts
+red L128
+L176: red L32
+L177: .string "vw"
+stop
+; comment
+cmp L133, #-174
+
+jsr *r7
+clr r4
+rts
+inc r2
+add *r1, *r6
+stop
+
+mov *r4, *r7
+L178: red r1
+bne L83
+
+dec r1
+inc L109
+bne L132
+not L21
+L179: prn L41
+prn L119
+add L144, L126
+L180: .data 118, -121, -152
+cmp #12, #163
+L181: inc r2
+L182: .data -108, -606
+L183: .data -656, 606, -478, 270
+jmp L145
+L184: cmp #-232, #166
+L185: cmp *r3, *r3
+clr *r0
+L186: red r7
+L187: jmp L22
+stop
+rts
+L188: rts
+stop
+red r5
+not L149
+L189: .data -785, 869
+mov r7, r3
+add #77, r5
+prn #-106
+jsr L43
+L190: not *r6
+L191: jmp *r6
+dec L50
+prn r4
+L192: inc L187
+sub *r2, *r3
+mov #-56, *r7
+L193: stop
+L194: red *r6
+inc L112
+jsr L190
+L195: .data -740, 655, -312, -874, 824, 870, 973
+L196: dec L74
+inc r1
+rts
+dec r7
+red r7
+L197: .string "xdjcalfhmnirox"
+L198: rts
+
+mov L103, L145
+lea L55, r3
+
+inc r7
+L199: cmp r2, #244
+stop
+
+L200: rts
+L201: prn #-1
+L202: cmp L106, r7
+jmp L78
+
+L203: .string "yufbwzucsxlvasluctnkqmde"
+L204: cmp #58, *r2
+not r3
+
+inc L153
+L205: inc r2
+L206: jmp L194
+not L112
+L207: clr r5
+prn r5
+lea L85, r6
+lea L123, L103
+bne L181
+not r1
+add L142, L22
+L208: clr r5
+rts
+L209: clr *r4
+L210: prn r2
+prn L59
+
+sub r4, L53
+L211: prn *r3
+L212: dec r0
+cmp r6, *r4
+mov L26, r0
+; comment
+not L50
+L213: not L196
+rts
+L214: .data 216, -962, -114, 729, -328, 52, 768, 754
+L215: add r5, L145
+L216: cmp L83, r4
+dec *r0
+red r4
+jsr L205
+cmp #-150, r3
+L217: bne L99
+not L90
+mov #30, L32
+L218: .string "f"
+L219: red L106
+inc L77
+L220: red L199
+L221: .string "gchudusammbqmnnbtoellty"
+lea L2, L30
+lea L20, *r3
+L222: jmp *r1
+L223: mov L109, *r3
+mov L37, L72
+jsr *r0
+bne L206
+L224: .string "mrrmfp"
+L225: .string "ocsblwac"
+add *r0, *r2
+cmp L62, L91
+cmp #10, #-1
+bne L28
+L226: .string "uoghewahztqpevklyxxcfnl"
+cmp *r3, #131
+red L38
+bne L15
+dec L77
+mov *r0, r0
+red *r3
+L227: add r0, *r1
+L228: lea L170, *r4
+L229: stop
+bne *r2
+bne L78
+L230: red r5
+L231: dec r2
+sub r0, r7
+L232: clr *r3
+L233: mov L171, L174
+mov L99, r1
+jsr L42
+mov L202, *r2
+bne L111
+L234: prn *r1
+L235: jsr L233
+prn #170
+L236: .data -737, -593, 193
+inc r4
+not *r2
+L237: cmp L144, *r6
+sub #155, L207
+L238: stop
+jsr *r0
+L239: .data -896
+clr r7
+L240: .string "iurimtrr"
+jsr L123
+dec r7
+L241: .string "esidspoonlfqgzfgesigs"
+add L106, r3
+dec *r7
+L242: bne L16
+L243: not *r3
+L244: .string "dlfgkeovbl"
+prn *r6
+L245: cmp #9, #-67
+jsr L179
+rts
+not r3
+red r5
+L246: .data 930, 491
+dec *r3
+add L3, L89
+clr r3
+L247: sub *r7, r1
+dec L207
+jsr L30
+clr *r2
+add *r0, *r6
+L248: .data -834, -413, -565, -495
+L249: .data 408
+L250: not r2
+cmp r5, r4
+inc L105
+L251: .string "qyxqngbzwasoriujumye"
+inc *r1
+L252: rts
+L253: bne L165
+stop
+not r2
+L254: clr r5
+inc L54
+
+rts
+not *r0
+prn L43
+lea L240, *r7
+L255: .string "ecbjcqebxtzilnb"
+clr L84
+L256: bne *r4
+sub r1, *r0
+L257: rts
+dec r3
+; comment
+
+inc r4
+red L14
+L258: cmp L183, L101
+lea L162, *r1
+red *r2
+red r5
+rts
+stop
+L259: lea L213, r1
+L260: jsr *r1
+; comment
+; comment
+L261: red *r0
+clr L102
+lea L191, *r4
+jsr L159
+stop
+; comment
+stop
+
+red L205
+L262: clr r3
+red r2
+jmp L243
+L263: not r1
+L264: red L19
+prn *r4
+L265: prn r3
+jsr L25
+bne L194
+inc L122
+lea L63, r7
+jsr L120
+lea L169, L124
+rts
+L266: clr L213
+L267: not L226
+stop
+jmp *r3
+L268: mov L19, L29
+dec *r5
+sub #-88, r7
+not r5
+L269: stop
+jsr L85
+inc L45
+L270: jsr *r0
+stop
+L271: .data 434, 872, -382, -68
+jsr L50
+L272: clr L133
+L273: .data 880, 352, -764, -90
+rts
+clr L179
+L274: prn L99
+L275: jmp L257
+
+L276: .data 908
+rts
+L277: not *r6
+L278: lea L117, r2
+L279: bne L123
+L280: cmp *r4, L3
+inc r7
+L281: red r7
+L282: inc r1
+L283: .string "nllyhsbfpsrirfxpqnek"
+L284: stop
+L285: .string "vgrlsjgbmwxhyhxht"
+inc L270
+lea L245, *r1
+L286: .string "asudmrnrmigycbnu"
+L287: dec *r2
+L288: red L65
+L289: sub *r5, r1
+bne *r5
+L290: rts
+prn r0
+
+stop
+red *r2
+L291: .data -969, -643, -969, -956, 200, 642
+mov #-233, *r7
+L292: bne L169
+L293: .string "qvloz"
+dec r0
+jmp L140
+bne L65
+inc L239
+cmp #88, r5
+L294: prn L164
+L295: dec L288
+inc L280
+prn #14
+
+stop
+clr L164
+L296: .data 274, -498, 422, -421, 17, 559, 425
+jmp *r0
+sub #-116, L206
+
+add L49, L241
+rts
+sub *r4, L282
+L297: .string "go"
+L298: add r3, r3
+stop
+L299: .data -10, 38
+L300: cmp *r1, r7
+prn #18
+mov #27, L255
+clr *r6
+rts
+L301: not L240
+lea L124, *r3
+add *r0, *r1
+L302: .string "rayhkjzjlkspkjsmzcgtiw"
+prn L296
+clr *r3
+inc r0
+L303: .string "vftbrvuhsueerbtggduthk"
+stop
+add *r4, r6
+L304: .data 777
+clr *r5
+L305: stop
+L306: inc *r3
+L307: .data -138, 604, 866
+bne *r3
+
+stop
+clr *r2
+L308: stop
+L309: mov *r2, *r6
+mov L196, L13
+stop
+add #167, *r4
+L310: inc L132
+L311: add L181, L54
+jsr *r6
+L312: bne *r4
+bne L119
+L313: .string "krjnmyhxvtlfqcaztu"
+L314: jsr L311
+jmp L71
+L315: jmp *r2
+L316: stop
+dec *r7
+L317: prn #70
+jmp L277
+L318: .data 579, 390
+not L12
+red r4
+L319: jsr *r1
+add r5, r7
+; comment
+L320: mov r2, L275
+clr r5
+clr *r4
+L321: inc *r5
+L322: .data -715, -580, -171, 654, -519, -330
+dec r6
+sub #-74, *r2
+L323: prn #37
+L324: inc *r4
+L325: .data -350, 929, 889, 506, -577, 735, 850
+; comment
+L326: add #-34, r7
+add L199, L278
+L327: stop
+L328: cmp L21, L122
+stop
+L329: .data 304, -786, 985, 673, -483
+L330: add #-211, L218
+L331: jmp L106
+L332: not *r3
+
+bne *r0
+add *r7, r3
+prn *r1
+stop
+inc r7
+L333: lea L14, L74
+L334: bne *r3
+sub *r6, L293
+red r5
+L335: .string "rcloitskzixvpjnjsfkz"
+L336: .data -819, -621, 446, 423, 754, -240
+add #168, *r0
+clr r5
+jmp *r3
+bne L330
+prn *r5
+red L20
+clr L141
+dec r1
+L337: .data 472, -506, 155, -126, -176, -316, 361
+mov #-123, *r5
+L338: .string "ltlnmbfythr"
+not L167
+rts
+stop
+stop
+red L170
+clr r7
+rts
+clr *r2
+L339: .data -891, 942, -156, -184, -958, 719
+L340: rts
+L341: inc L98
+lea L163, r7
+sub L288, r0
+lea L34, *r5
+stop
+dec *r3
+jsr *r2
+L342: rts
+L343: inc *r3
+L344: prn r1
+L345: lea L97, r0
+L346: sub #-211, r0
+bne L32
+L347: clr L50
+L348: .string "srqvuimzersqtsgsqmeehkwy"
+L349: lea L87, r4
+sub *r6, *r5
+mov r6, *r6
+L350: clr *r6
+L351: .string "hekhmpidcdvdgclksjt"
+rts
+inc *r5
+not L331
+L352: not *r1
+L353: jsr *r0
+inc r6
+L354: red L92
+mov *r3, *r0
+L355: red *r2
+L356: sub #225, *r7
+inc r4
+not *r6
+stop
+bne *r2
+rts
+L357: prn *r5
+not *r0
+; comment
+bne L238
+inc *r3
+sub r2, r6
+
+prn r1
+stop
+L358: clr *r5
+jsr L35
+L359: .data 24, -653, 228, 753, -652
+L360: .string "yhnnedgmem"
+stop
+rts
+lea L185, r0
+lea L360, r6
+mov *r7, L121
+; comment
+sub r4, L111
+L361: jmp *r5
+L362: .data -70, 211
+stop
+L363: sub *r2, *r0
+lea L298, *r1
+prn r0
+add #-246, L208
+; comment
+stop
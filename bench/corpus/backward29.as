@@ -0,0 +1,1023 @@
+; Generated by genCorpus --seed 30
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+
+cmp r3, #-227
+jsr L22
+L0: .string "fiqmxozyxlwwpjxyslfpjhea"
+add #-105, L0
+L1: mov #-121, *r3
+lea L0, r2
+inc *r7
+red *r1
+L2: jsr L0
+jsr *r3
+L3: add *r3, r0
+prn L0
+red *r1
+; comment
+L4: mov #-19, *r2
+clr *r1
+clr r5
+L5: jsr L4
+dec *r0
+dec *r3
+bne L1
+red *r4
+rts
+lea L3, *r6
+stop
+rts
+stop
+L6: jsr L5
+add r5, L5
+jsr L6
+lea L4, *r5
+L7: red *r2
+dec *r2
+rts
+not L5
+inc L1
+inc r7
+L8: sub #217, L5
+jmp *r7
+red *r3
+L9: .data 965, -787, -983, -621
+dec r7
+lea L7, r5
+add *r2, L8
+bne *r7
+jmp L4
+cmp *r0, #68
+prn r5
+L10: .string "tvpnlzznfpxmu"
+bne L3
+cmp #-230, *r3
+L11: bne *r1
+add #135, L2
+prn L10
+L12: prn r5
+inc *r3
+jmp *r1
+clr r6
+L13: not L10
+L14: add #-130, r4
+L15: sub #-128, *r0
+L16: mov #-25, L14
+prn L12
+jsr *r5
+not r6
+rts
+clr r0
+L17: .string "ymrzaiav"
+
+stop
+red r2
+jsr L4
+mov #54, r4
+not L4
+L18: clr *r1
+; comment
+jsr *r5
+bne L6
+mov r3, *r2
+add #-158, *r2
+L19: jsr *r0
+L20: sub L17, r5
+L21: .string "oahtbtfshoxdxskzgkpx"
+L22: lea L10, r1
+inc L0
+dec *r3
+L23: .string "j"
+jmp L9
+jsr *r3
+L24: rts
+L25: bne L3
+jsr *r5
+clr L20
+jsr *r1
+not *r0
+cmp r7, *r4
+L26: lea L7, L9
+jsr L13
+red L0
+mov r1, *r7
+red *r6
+inc r3
+lea L18, *r1
+prn *r0
+clr r3
+L27: not L4
+L28: jsr L20
+L29: inc *r7
+L30: dec *r3
+rts
+cmp r3, *r4
+L31: inc L0
+cmp r1, r2
+L32: not L1
+L33: .string "hnfjumcindzf"
+cmp #75, *r1
+L34: lea L29, *r2
+L35: stop
+L36: rts
+stop
+cmp r3, L35
+L37: stop
+L38: jmp *r4
+cmp r7, r6
+L39: not L38
+L40: jsr *r7
+add L15, r2
+L41: mov L17, L41
+lea L40, *r5
+red *r1
+L42: .data -120, -697, -57, -481
+L43: red r2
+L44: mov #-7, *r3
+L45: .string "qjutfgszhlxkk"
+L46: .data -425, 166, -133, -979
+clr r7
+rts
+prn r0
+L47: inc *r4
+not *r5
+L48: red L20
+rts
+not r1
+cmp r0, r4
+; comment
+L49: .string "fndvzzvldyxodlgrkmr"
+mov #33, *r7
+L50: jsr *r4
+jsr *r3
+mov #237, L8
+mov #206, *r0
+jsr L3
+add #-205, r6
+sub L16, *r2
+L51: red *r7
+L52: dec L49
+mov #47, L50
+
+bne L8
+clr *r6
+L53: .data -409
+L54: mov L4, r1
+bne L29
+lea L34, *r6
+lea L26, L54
+L55: not *r2
+add #71, r1
+cmp r3, #-7
+L56: rts
+L57: jmp *r6
+bne L50
+prn #210
+mov L51, *r6
+jsr L8
+L58: not *r1
+L59: .string "xqimfpnnamixspqvczsgd"
+L60: red L1
+L61: prn *r5
+sub r0, *r6
+rts
+add #250, *r2
+rts
+lea L29, *r5
+; comment
+rts
+prn r0
+cmp L13, #-61
+add r7, r3
+; comment
+jsr L8
+jsr *r1
+L62: rts
+inc r6
+L63: not *r6
+
+rts
+cmp L10, #-129
+L64: rts
+rts
+bne *r2
+L65: cmp *r3, L27
+prn #130
+L66: .string "zqtuz"
+red *r7
+rts
+L67: cmp #110, #252
+stop
+inc r6
+stop
+clr r5
+L68: lea L51, L53
+L69: clr L26
+dec L5
+L70: rts
+L71: .data -742, -311, -330
+L72: .string "kkgzkbkxsgjseamcik"
+add #-45, L20
+sub #-35, r1
+stop
+rts
+L73: jsr *r6
+L74: .data 552, -894, 413, 216, -592, -364
+rts
+L75: not r6
+lea L39, L58
+L76: cmp r5, r5
+L77: .string "udfarlcmvgrsrigqho"
+L78: not *r1
+L79: rts
+stop
+mov #114, L63
+L80: cmp #-199, r1
+L81: cmp L10, r2
+red *r7
+bne L80
+add r5, L36
+not *r2
+
+add L9, r4
+inc L5
+inc r2
+cmp L35, L28
+red L30
+L82: clr *r3
+rts
+not r3
+jsr L20
+L83: .string "pbmqqxjrwz"
+inc r3
+jsr *r4
+prn r0
+L84: not L70
+not L82
+L85: mov #44, *r2
+inc *r2
+mov #114, r5
+stop
+jsr L81
+L86: stop
+L87: prn *r5
+L88: jsr L46
+not L43
+stop
+L89: clr *r6
+prn *r0
+jsr *r7
+dec L15
+jmp L61
+bne *r0
+jsr *r4
+L90: dec r6
+jmp L40
+inc r6
+L91: dec *r6
+lea L72, r2
+L92: clr L57
+bne *r0
+stop
+L93: .data 327, 707, 411, -843, -248, 22
+dec *r4
+cmp #-134, r4
+stop
+cmp L80, #-244
+L94: .data -458, -771, 750, 446
+sub r5, *r4
+L95: .data -675, -131, 279, -909, 385, 418, -696, -340
+clr L21
+rts
+rts
+jsr L12
+
+L96: add #-164, *r1
+rts
+L97: stop
+sub L31, *r5
+not r6
+red r6
+lea L72, L13
+L98: mov r4, L72
+mov #-174, *r1
+not r6
+sub #-238, r2
+stop
+L99: inc *r4
+add #247, L81
+cmp L60, r4
+clr *r1
+red L8
+add *r7, r3
+cmp *r6, #192
+dec r7
+L100: inc L49
+
+prn #28
+bne L66
+lea L67, r7
+not L87
+inc L10
+L101: .string "patscfipzjydhrb"
+red *r2
+jsr *r2
+L102: .data -865, -638, 587, 53, 543, 225
+L103: inc r1
+add #-219, r4
+L104: rts
+prn *r7
+not L55
+jmp *r2
+dec L60
+stop
+not L81
+stop
+sub *r6, r0
+bne *r7
+add L4, r6
+; comment
+clr *r2
+cmp r4, #84
+cmp L2, #-235
+L105: rts
+cmp #-219, *r0
+dec r0
+jsr *r3
+dec *r5
+L106: jmp L55
+L107: red L91
+bne L55
+inc L93
+rts
+prn #-168
+L108: stop
+jmp L30
+L109: .data 912, 134, 876
+sub L52, r5
+L110: .data 21, -941, -704, 993, -137, -740, -320
+red r3
+jsr *r5
+prn #168
+stop
+jmp *r3
+L111: .string "eosjfibdkslwsbnsz"
+stop
+cmp L11, L80
+L112: bne L9
+sub r6, L24
+L113: bne L53
+inc L35
+L114: sub L39, L114
+rts
+stop
+add *r3, r0
+lea L101, r4
+L115: lea L40, *r3
+add L67, *r3
+prn #-243
+L116: prn *r1
+inc r2
+not L74
+inc L8
+L117: prn L53
+L118: stop
+L119: .data -411, 689, -723, -761, 150, 486, 883, 730
+jmp L60
+not r3
+inc L66
+lea L94, *r5
+jsr L97
+stop
+lea L46, L95
+L120: jsr *r1
+jmp *r2
+add *r4, L45
+jmp L111
+stop
+cmp *r0, *r0
+sub L89, r1
+jsr L112
+L121: bne L59
+red r2
+add #-14, r0
+dec *r3
+rts
+not L2
+L122: stop
+mov r3, r3
+L123: add *r1, r7
+sub #57, L90
+L124: red L41
+add #63, L35
+prn L54
+jmp L35
+L125: stop
+add L87, *r3
+red L18
+add #135, r1
+inc *r4
+L126: .string "bgjbjhtbvhu"
+prn r6
+bne *r1
+add L0, r5
+L127: mov #-76, r0
+rts
+L128: prn *r4
+L129: .string "qukdxgjcovrqfd"
+prn #51
+red r2
+L130: .string "oqj"
+rts
+
+lea L48, *r0
+stop
+; comment
+L131: mov r3, *r7
+clr *r7
+L132: stop
+inc L112
+bne *r3
+L133: dec *r4
+L134: inc r2
+not L106
+L135: .data -949
+cmp r2, *r0
+
+cmp r1, L30
+jsr L9
+sub r7, *r6
+stop
+dec L111
+lea L89, L103
+L136: .data -968, 347, -254, 624, 232, -247
+red *r3
+jsr L129
+L137: rts
+; comment
+; comment
+stop
+; comment
+sub #146, r7
+L138: lea L97, r7
+red *r5
+not *r4
+clr r0
+jmp *r6
+inc *r0
+mov *r2, L92
+L139: .data 739, 546, -107
+rts
+jsr *r1
+L140: .data -89, 843, 263, -687, 614, -324
+add #-99, L14
+
+jsr L44
+sub L17, r4
+red r6
+L141: .string "ycndmezxlvn"
+lea L11, *r4
+sub *r1, L42
+L142: stop
+add #222, r7
+L143: cmp *r4, *r6
+clr r7
+bne *r0
+L144: dec r2
+rts
+lea L118, *r3
+mov L14, L29
+L145: jsr L62
+L146: add *r3, r0
+stop
+L147: rts
+prn #-35
+sub #165, L12
+inc r2
+L148: bne L68
+jmp L104
+lea L106, L71
+L149: lea L87, r3
+lea L132, L136
+L150: .data 918, -206, -973, 643, -440
+red r5
+bne *r4
+red L22
+L151: .data -104, -62, -713, 251, -383, 518
+not L131
+L152: jsr *r5
+sub *r4, L109
+stop
+L153: prn L50
+L154: .string "vgsetqwvrrodwrdxn"
+stop
+dec r5
+
+red r0
+L155: rts
+red L105
+; comment
+L156: dec r7
+L157: .string "drcpevtndiplysvzqsi"
+add r5, *r0
+
+bne *r2
+inc *r6
+lea L64, L129
+L158: stop
+L159: .string "vkeejgjaerxqofnbtbn"
+L160: .string "kkdgpqfvdarjadsyhdhhp"
+L161: .string "tsbkvbejbmr"
+inc r6
+jsr L110
+L162: jmp L143
+add r1, *r4
+bne *r4
+rts
+L163: not L162
+stop
+
+add #-174, *r6
+L164: not *r1
+lea L73, r3
+L165: cmp #98, L84
+L166: rts
+sub r5, *r3
+L167: jmp *r2
+inc *r1
+cmp #214, L66
+not r4
+not L22
+L168: .string "axlqgbpgufwulwietigob"
+L169: .data -586, 899, -182
+L170: rts
+stop
+L171: jmp *r1
+
+L172: .string "whkfe"
+inc r2
+cmp r2, #-195
+jmp *r5
+jsr L150
+L173: jsr *r5
+L174: dec L104
+prn *r5
+sub r5, L116
+lea L23, *r1
+red r5
+L175: stop
+inc r6
+L176: red L167
+stop
+L177: not *r6
+jmp *r6
+L178: .data 0
+L179: .string "kikkhcraponnkhwdbjejpo"
+L180: .string "ieoqajnlv"
+not *r5
+sub *r5, L165
+add L3, L99
+L181: cmp L39, *r6
+inc L172
+sub #-72, r5
+rts
+add r2, *r5
+add r6, L168
+bne L155
+add r4, L157
+sub *r6, *r7
+L182: .string "wnusptd"
+sub #45, *r7
+L183: sub *r7, r1
+jmp *r0
+lea L64, r1
+L184: add *r1, *r6
+
+stop
+L185: mov L84, r0
+L186: clr L60
+prn *r4
+mov #206, L166
+prn L114
+sub r0, *r2
+stop
+not r1
+cmp L1, #-71
+not L138
+L187: mov *r7, *r0
+L188: .string "vdrjvgjrpdutevwqixhtre"
+bne *r2
+L189: .string "nxhxvld"
+sub #111, r4
+L190: rts
+not r0
+rts
+jmp *r0
+lea L103, r0
+L191: lea L39, r0
+inc *r2
+L192: sub L63, L88
+red *r6
+rts
+mov #128, r3
+L193: jsr *r5
+
+L194: .string "uhmluun"
+not r0
+L195: not r6
+L196: add L160, L132
+; comment
+L197: jsr L168
+L198: .data -342, -993, -563, 160, 718, -50, -509, -507
+jsr L143
+mov #165, r2
+red *r4
+lea L68, *r0
+rts
+add #-134, *r6
+jsr L88
+prn *r3
+L199: .string "zpswedjyywhtti"
+L200: cmp r4, #-40
+red *r0
+L201: .data -604, 385, -660, -471, 149
+lea L145, L133
+clr L121
+L202: add r1, *r7
+rts
+L203: add *r2, *r3
+jsr *r7
+dec r5
+; comment
+L204: prn L92
+bne *r2
+prn #-12
+rts
+L205: .data 66, -827, 463, -966, -804, 594, 723
+L206: jsr *r3
+not r2
+rts
+not r3
+inc r7
+add #-69, *r0
+L207: .string "kttfqlstvgrqgbfno"
+jmp L176
+L208: .string "bvyd"
+bne *r0
+jsr L151
+; comment
+L209: inc *r7
+bne L46
+jsr L119
+L210: prn *r2
+clr *r4
+add *r7, *r2
+cmp #208, L8
+
+dec L153
+clr L182
+not L208
+dec r5
+lea L28, *r7
+L211: prn #-170
+jmp L108
+inc L127
+add #-11, r3
+cmp *r6, L188
+clr L143
+jsr *r3
+rts
+L212: not L179
+jmp L22
+L213: .string "cfsnm"
+L214: not r4
+prn r0
+dec r4
+cmp L167, #95
+L215: stop
+not *r1
+bne *r6
+L216: add *r3, L8
+mov #-163, r4
+
+jmp L101
+bne L172
+
+bne *r1
+L217: mov *r7, L160
+L218: .string "vdp"
+L219: .string "zvgxhberptngfnckeqkf"
+prn #108
+L220: .string "zetepfvhytumi"
+L221: add *r3, L23
+bne *r7
+L222: .data 256
+dec L18
+stop
+sub r2, *r3
+cmp L86, *r5
+L223: lea L169, r6
+red *r3
+red L52
+cmp *r3, L172
+inc L107
+prn L219
+mov *r5, *r3
+not r7
+prn L115
+add r3, *r3
+L224: bne L151
+L225: sub L9, *r0
+dec r7
+stop
+L226: prn *r6
+inc L89
+jmp *r0
+L227: .string "shhigdfwjvjuxujfec"
+L228: red L189
+add r0, L68
+mov L148, L173
+stop
+dec r6
+L229: .string "foyeckctjhcxbfghtcomncbn"
+sub *r2, L202
+prn L69
+bne L53
+rts
+add #23, r1
+mov r6, *r3
+L230: stop
+L231: dec L182
+L232: sub *r7, *r2
+rts
+L233: bne L204
+L234: mov L194, L233
+L235: sub L235, L16
+bne *r2
+jsr L206
+stop
+jsr L64
+sub L68, L131
+L236: inc *r6
+L237: not L231
+red L77
+L238: bne *r5
+L239: .data -722, 368, -140, -900
+
+L240: .data -650, 403, -394, 890
+L241: .string "hijl"
+prn *r4
+red r1
+dec *r2
+prn #-221
+not L79
+bne *r7
+L242: bne *r4
+prn r1
+add *r2, r0
+L243: jmp *r1
+clr L80
+; comment
+bne *r6
+dec L225
+add r7, r6
+L244: sub r6, r0
+L245: add *r3, L145
+add r1, *r2
+; comment
+L246: rts
+red *r1
+prn L27
+jsr *r3
+jmp *r7
+L247: .data 640
+L248: clr L60
+lea L198, *r7
+cmp *r6, L16
+prn L237
+clr L179
+L249: add *r4, *r5
+L250: rts
+sub #23, *r6
+L251: jmp *r3
+; comment
+L252: mov *r5, L144
+L253: bne L149
+L254: .data -396, -21, -102, 22, -280, -105, -884
+dec L97
+jmp *r3
+stop
+jmp *r2
+; comment
+sub L43, *r6
+jmp L219
+lea L102, r3
+dec r0
+clr L240
+L255: prn r5
+mov #185, r1
+L256: mov r0, r2
+L257: lea L1, L241
+not r5
+L258: jsr *r5
+stop
+L259: dec *r5
+inc r2
+L260: .data 423, -578, -682, -681, -420, -889, 520
+L261: prn L96
+dec r6
+add r5, *r0
+stop
+L262: dec *r4
+sub *r5, L239
+add L137, L153
+cmp #239, #-122
+not r7
+L263: .data -39
+not r5
+mov *r6, r2
+L264: jsr *r2
+; comment
+jsr L117
+L265: .string "fzrkvzgep"
+L266: inc L244
+prn L185
+dec r7
+cmp r2, #-89
+L267: .data 681, -456, 522, 715, 656, -429
+rts
+not L161
+not r5
+L268: lea L77, L160
+L269: lea L157, r4
+; comment
+rts
+L270: inc L216
+bne L194
+L271: stop
+cmp r4, #178
+cmp r4, #-206
+L272: jmp *r1
+jsr L225
+lea L133, *r6
+L273: add *r7, r4
+L274: rts
+rts
+L275: stop
+add #-89, L252
+inc *r2
+L276: .data -252, -953, -244
+lea L148, *r7
+mov #-114, L223
+L277: mov r2, *r3
+L278: .string "gmzficvncvazdxswzjuwn"
+not *r7
+lea L244, L142
+mov *r4, r1
+not *r5
+L279: jmp *r4
+L280: add #-253, *r5
+dec L97
+not L55
+rts
+L281: dec *r2
+L282: .string "iogntcftosohnwljd"
+lea L126, L201
+L283: add *r1, L126
+L284: red *r4
+cmp *r5, r2
+L285: .data -379, -922, -785
+L286: .string "ijue"
+add r5, *r1
+L287: bne L14
+L288: .string "wyx"
+not L3
+not L67
+L289: dec r3
+stop
+rts
+L290: bne L26
+cmp r7, L84
+clr r5
+add L27, *r3
+inc L133
+; comment
+mov L70, *r3
+mov r2, L141
+mov L132, L11
+L291: clr r2
+rts
+add #-193, r0
+L292: .string "ujpgypfxaxjwq"
+stop
+L293: cmp #-92, #15
+
+rts
+add *r4, L275
+
+; comment
+sub L276, r5
+L294: .string "cllbknjquqrrvvcmp"
+red r7
+L295: dec *r1
+cmp L34, r7
+prn *r4
+add #255, *r1
+L296: .string "aljsjj"
+bne L225
+dec L32
+dec *r4
+sub *r7, r0
+red r1
+inc L227
+bne L40
+add #-130, *r3
+cmp #-90, L19
+cmp L79, *r3
+red *r0
+L297: stop
+dec *r0
+L298: cmp #-89, #-221
+L299: red *r6
+red *r3
+not r5
+not r1
+rts
+L300: inc L227
+L301: jmp L40
+L302: jsr L198
+bne L46
+; comment
+L303: add r1, r7
+stop
+add r0, *r0
+L304: not L42
+cmp L82, r5
+stop
+clr r2
+L305: rts
+rts
+L306: sub *r2, *r0
+L307: clr *r1
+L308: .data 730, 880, 710, 465, -930, 187, 665, 825
+rts
+L309: dec *r3
+
+not r2
+rts
+clr *r3
+L310: .string "xntkzqtnowei"
+jmp *r2
+
+L311: .string "yqughgshlywmwbuqlggtscl"
+L312: cmp L193, #100
+; comment
+L313: rts
+rts
+inc L157
+jmp L291
+dec r3
+L314: lea L165, r0
+prn L123
+; comment
+L315: .string "dzylmnwtdpmewu"
+bne *r3
+stop
+L316: jmp *r5
+prn L2
+jmp L89
+stop
+L317: dec *r5
+mov #21, L257
+stop
+L318: jmp *r7
+; comment
+add r7, L244
+add r1, r1
+add *r4, L58
+L319: .string "zzqsnzmlnpcdmvchrniun"
+clr L21
+L320: bne L173
+rts
+L321: bne L131
+stop
@@ -0,0 +1,1027 @@
+; Generated by genCorpus --seed 4
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+L0: add *r7, L0
+L1: bne L1
+L2: .string "prb"
+L3: jsr *r7
+red r1
+L4: .data -936, -569, -790
+not r1
+L5: cmp *r1, r6
+not *r2
+mov #108, L1
+dec r3
+not r4
+clr L5
+mov #-163, *r4
+jsr L4
+jsr *r2
+mov *r6, *r1
+mov #-100, L4
+L6: .data -46, -706, -608, -510, 613, 322
+prn L3
+prn *r7
+inc *r7
+prn #-171
+cmp L2, *r2
+L7: lea L3, *r7
+L8: .string "oqjphtpugz"
+stop
+red r4
+lea L0, *r3
+prn L4
+bne *r2
+add L0, *r7
+L9: prn L8
+L10: .data 645
+L11: jmp *r2
+L12: .data 308, 330, -568, 346, -252, -946, -831, 878
+; comment
+L13: .string "kubgxiuwzsjvrrmrrrktt"
+rts
+L14: lea L8, r5
+cmp L12, #89
+L15: stop
+; comment
+add #207, *r6
+L16: mov L7, r4
+add r5, *r4
+clr r2
+L17: mov r7, r1
+jsr *r0
+jsr L9
+clr L1
+jmp *r1
+prn r4
+jsr L12
+lea L10, r3
+L18: jsr L16
+jmp *r0
+mov r2, L16
+rts
+sub *r3, r0
+jmp L18
+bne *r7
+L19: .string "y"
+jsr L3
+L20: jsr L8
+L21: .data 490, 509, -842
+inc *r5
+dec *r5
+L22: .string "lqbl"
+jmp L15
+prn r6
+stop
+stop
+stop
+L23: add L6, *r1
+L24: jsr *r7
+clr *r5
+add *r3, L5
+sub L10, L12
+L25: .data 834, 31
+cmp r1, r7
+add *r1, r7
+; comment
+L26: .data -47, 244
+add r5, r2
+
+L27: inc *r3
+L28: prn r7
+inc *r3
+add *r3, *r0
+mov *r5, *r3
+L29: jsr L29
+L30: prn L15
+L31: .data 769
+
+L32: red *r1
+not *r5
+L33: .data 401, -654, 616, -894, 752, -554, -390, 488
+lea L8, *r4
+stop
+
+cmp #-121, *r4
+prn *r4
+L34: not r5
+L35: .data -162, 165, -906, 606, -288, -69
+bne L30
+L36: not *r4
+sub r1, L5
+; comment
+L37: bne L26
+L38: red *r5
+prn r5
+dec r1
+dec L29
+rts
+mov r6, *r6
+jmp *r3
+not L10
+prn L2
+jmp L29
+L39: mov r5, L25
+; comment
+add #181, *r6
+L40: .string "ryehqccpcprgpe"
+mov r4, L24
+L41: bne *r1
+jsr *r0
+L42: cmp r4, *r4
+L43: lea L3, L4
+L44: stop
+L45: bne L1
+lea L23, L21
+L46: sub *r6, r7
+inc r5
+L47: red r5
+jmp *r5
+lea L20, r1
+; comment
+prn r3
+sub L33, r6
+sub L7, L46
+L48: not r2
+mov r5, r0
+L49: .string "dmwaipyksjvjnzs"
+prn #255
+not r4
+red r5
+cmp *r0, L43
+L50: lea L0, r1
+L51: sub #-135, L11
+cmp *r7, L4
+inc L5
+L52: lea L21, r5
+L53: bne *r3
+lea L14, *r6
+L54: prn #159
+mov #174, r5
+L55: add *r0, L45
+L56: mov #-198, L47
+dec r3
+stop
+L57: prn r2
+L58: .data 480
+add *r4, *r7
+inc L26
+L59: add L16, L55
+L60: bne *r3
+cmp *r1, L43
+
+L61: .string "oqsvqrpnaaweepnxdhgbx"
+clr r3
+L62: .string "vsgsnfzrd"
+bne *r1
+L63: bne L48
+dec *r2
+add L30, r6
+L64: .data 294, 333, -670, 674, -812, -975
+rts
+prn *r1
+stop
+L65: bne L54
+L66: lea L25, *r5
+rts
+L67: prn r3
+inc L32
+L68: .data -499, -283, -266
+L69: .string "gzkhxhdtmodzfe"
+L70: .data -72, -413, -195, -329, -513, -421, 977
+sub #46, r2
+dec *r4
+sub L29, *r1
+cmp L54, L34
+mov L43, *r2
+prn r4
+L71: prn r1
+not r6
+L72: dec r1
+L73: .data -570, 937, 228, 235, 817, -375, -429, 848
+jmp L54
+jmp *r6
+cmp L41, #-225
+lea L30, *r3
+prn #-231
+
+inc L28
+jsr L43
+L74: .string "clcnzyfuqnlfl"
+sub #-62, *r5
+mov r4, r7
+rts
+inc L72
+L75: not L25
+jmp *r3
+cmp r0, #64
+; comment
+jmp *r7
+lea L58, L65
+L76: mov r6, r2
+L77: .string "xktpydlxugovbc"
+stop
+L78: .data 324, 382, 370, -67, 723
+inc *r7
+bne *r5
+jmp L4
+L79: bne *r6
+L80: sub #152, *r1
+mov r2, L39
+L81: dec *r4
+L82: not r6
+not L50
+not r7
+bne *r1
+stop
+L83: .string "mdmkyqfljpokvznlmsrc"
+bne *r3
+L84: jmp L26
+L85: cmp *r0, #251
+prn *r0
+
+dec L50
+bne *r3
+not r4
+L86: stop
+L87: rts
+jmp *r1
+L88: dec L6
+L89: .string "htgkuyxwkyivsyyfguujjxw"
+L90: prn L22
+L91: lea L1, L55
+add L37, r2
+stop
+L92: .data 138, 779
+L93: add L13, *r5
+L94: prn #-190
+L95: red *r3
+rts
+L96: inc *r7
+L97: .string "hybkacsqfqcayetfnfdgzmii"
+L98: jsr *r0
+not r4
+bne *r4
+not *r6
+red r2
+; comment
+cmp #209, L76
+stop
+rts
+L99: jsr L93
+cmp r0, L88
+rts
+L100: red *r0
+clr r1
+L101: prn *r0
+cmp r2, L51
+L102: rts
+inc L19
+not *r0
+not L61
+sub r3, L102
+; comment
+L103: sub *r2, *r0
+rts
+L104: cmp #-108, r2
+red *r0
+L105: jmp *r1
+bne *r3
+L106: .data -227, 132, -536, 12, -786, -310, 497, -108
+rts
+bne L94
+L107: .string "cgadyzidchtjh"
+inc *r0
+jmp L52
+L108: cmp #197, L97
+cmp r7, #-231
+sub L27, L5
+L109: lea L87, *r0
+L110: clr L21
+L111: .string "hskvcgeykbwhojottqhorwuc"
+L112: rts
+stop
+L113: cmp *r3, L9
+L114: stop
+add L19, L53
+rts
+bne *r0
+; comment
+jmp L31
+sub *r7, r5
+stop
+not r7
+L115: .data -131
+L116: stop
+L117: .string "kgrphzukuooektlynorom"
+cmp *r2, L54
+L118: lea L82, *r5
+inc *r6
+red L107
+L119: rts
+jmp L38
+L120: stop
+lea L20, L89
+red *r3
+L121: jsr L41
+L122: prn #58
+L123: not L84
+add *r4, *r0
+jmp L78
+dec L36
+L124: jsr L7
+bne *r6
+L125: jmp *r5
+red *r1
+dec L84
+L126: .string "mgllktqe"
+L127: .data -116, 551, 566, -193, 567
+L128: .data 157, 360, 887, 590, 539, -666, -209, -632
+lea L20, *r2
+inc L50
+add *r3, *r6
+red *r5
+clr r4
+L129: inc r5
+L130: stop
+L131: .data -217, 566, 191, -381, -416
+lea L86, *r2
+; comment
+mov L63, *r2
+cmp r7, #155
+L132: cmp #-174, L75
+not L42
+sub L35, *r6
+L133: clr *r7
+clr r2
+not L104
+jsr L94
+L134: inc L49
+bne L125
+L135: .data -430, 480
+L136: jmp *r6
+lea L23, r5
+jsr L81
+inc *r2
+rts
+L137: prn L8
+L138: prn r1
+L139: red L6
+jsr *r5
+prn *r5
+rts
+L140: prn *r0
+L141: red *r7
+cmp L101, #252
+L142: rts
+cmp *r7, *r5
+prn L45
+clr L5
+lea L58, r1
+L143: lea L0, r2
+sub *r0, L61
+jsr L78
+clr L112
+L144: .string "bpcmg"
+stop
+stop
+L145: red L22
+; comment
+lea L99, L54
+L146: bne L144
+cmp r5, L22
+L147: sub r1, L144
+bne L98
+sub #-29, *r3
+L148: .data 707
+L149: add L14, r2
+prn *r7
+inc *r4
+lea L110, *r5
+inc L126
+cmp *r2, #-54
+L150: .data 503, -576, -79, 215
+lea L118, L108
+mov #-150, r4
+prn *r5
+L151: cmp r2, r2
+L152: jsr L102
+rts
+L153: jsr L41
+; comment
+jmp *r7
+L154: lea L37, L105
+clr r6
+L155: stop
+dec r4
+
+L156: red L38
+cmp *r3, *r4
+inc *r5
+clr *r1
+lea L18, L50
+mov #-12, *r1
+red L142
+L157: .data -89, 304
+jsr L122
+L158: cmp r1, *r6
+stop
+red r3
+rts
+dec *r5
+prn L45
+sub *r5, *r7
+L159: jsr L99
+cmp *r1, *r7
+lea L136, L67
+L160: .data -425, 951, 909, -17, -123, -281
+L161: rts
+L162: mov #-194, *r6
+prn L27
+jsr *r2
+L163: .data -147, 534, 74, -379
+; comment
+L164: mov *r0, r0
+inc L49
+L165: sub L73, L140
+inc L143
+add #70, *r6
+jmp L141
+cmp L136, r5
+lea L74, *r3
+L166: rts
+lea L113, L76
+not L123
+jsr *r6
+L167: prn L124
+jsr *r3
+lea L36, L1
+rts
+L168: inc r3
+rts
+L169: add L38, r0
+jsr *r5
+
+L170: jsr L19
+L171: bne L166
+L172: .data -527, -213, -271, 370
+
+L173: stop
+L174: rts
+prn L135
+jmp *r3
+L175: .data -862, 181
+jsr *r2
+L176: red r1
+inc r0
+L177: .data 127, 412, -227, 744
+L178: lea L174, *r6
+L179: add L136, *r0
+prn L109
+L180: bne L156
+inc *r7
+red r2
+red r0
+L181: cmp L116, #-55
+dec L123
+cmp r7, L180
+L182: prn #111
+; comment
+clr L52
+prn L134
+not r5
+bne *r1
+clr r7
+add #-201, L51
+L183: mov #-251, r7
+; comment
+stop
+dec *r7
+rts
+rts
+jsr *r1
+add L102, L79
+L184: .string "ohma"
+L185: inc *r3
+cmp #-250, *r6
+sub r5, L45
+add r5, r1
+L186: mov #135, *r1
+L187: .data -564, 264, 188, -149, 283, -964, -557, -268
+L188: bne L121
+cmp #-94, *r5
+L189: jmp L37
+L190: stop
+L191: dec *r6
+sub L81, L57
+L192: cmp #178, L9
+lea L187, L0
+L193: .string "dkwsqfaaavvpgzidjxaqmgd"
+not L103
+L194: rts
+L195: .string "pyiayzvacbdsbmroddds"
+stop
+rts
+; comment
+L196: lea L137, *r4
+dec *r5
+L197: jmp *r6
+L198: lea L3, r6
+L199: rts
+sub L66, r6
+bne L73
+; comment
+L200: clr *r2
+L201: dec *r2
+prn r7
+stop
+L202: red r1
+red *r4
+L203: clr *r1
+clr r2
+jsr L88
+L204: jmp *r7
+stop
+L205: sub #-239, *r5
+red *r4
+mov L133, r2
+bne *r1
+L206: .string "fhurnemgbnpuvkywstko"
+; comment
+L207: .data 500, -44, 519, -9, 115, -861, -560, -920
+jmp *r7
+jmp *r2
+L208: cmp #53, L158
+bne L92
+mov r5, L51
+red L87
+L209: clr L13
+red L62
+red L140
+stop
+bne *r0
+L210: inc r3
+sub r5, L165
+lea L184, L90
+stop
+L211: red L166
+L212: inc L14
+not r4
+L213: dec r1
+L214: clr r3
+sub L108, *r6
+bne L168
+L215: prn #-236
+cmp L160, r5
+L216: bne *r1
+cmp L193, #-20
+L217: .data 378, -512, 486
+mov L190, r6
+dec *r4
+L218: .data 186, -220, 972, 927, -536
+L219: add L217, r7
+L220: .string "fweil"
+L221: .data 643, -583, 495, -743, -936, 888, 974, 897
+inc *r2
+L222: dec *r5
+cmp #-121, *r7
+L223: lea L146, *r1
+L224: .string "dyaeuszoduswojvbgjvrszx"
+jmp L129
+L225: clr L17
+mov #-121, *r3
+; comment
+jmp L215
+inc L53
+not *r0
+L226: .string "vpradu"
+L227: dec r3
+dec *r0
+prn L57
+jsr *r5
+L228: red *r7
+L229: clr r4
+L230: jsr L57
+jsr *r0
+stop
+L231: mov #-245, L114
+add r3, L53
+stop
+cmp *r6, L72
+red L3
+L232: prn r6
+sub *r2, L112
+rts
+jsr L3
+L233: cmp r4, r7
+cmp r0, L78
+L234: .data -822, 323, 947
+L235: .string "grrvdxpjreymgsaqyjtoildg"
+L236: .string "omwh"
+L237: prn r6
+red L138
+dec r1
+jmp *r2
+add L106, r7
+jmp L103
+dec L101
+mov #-61, r7
+mov *r1, r1
+add L125, L197
+L238: inc L221
+jmp *r3
+inc r1
+
+sub #-135, L55
+; comment
+
+mov #-73, *r7
+prn #-111
+jmp L22
+mov *r1, *r2
+stop
+L239: cmp r7, r6
+dec L112
+L240: bne *r0
+L241: lea L18, r1
+L242: .data 543, 356
+mov L69, L233
+rts
+jsr *r5
+inc *r0
+L243: inc *r2
+jmp L165
+add r7, L14
+L244: prn #-66
+red L78
+L245: rts
+cmp L136, L42
+red L124
+L246: rts
+stop
+; comment
+cmp *r4, #-100
+inc r4
+not L191
+stop
+rts
+jsr L98
+jsr L225
+L247: .data -529, 486, -405, 102
+L248: clr *r3
+L249: inc r4
+
+; comment
+L250: .string "udxtuclyykccvvyldwxkkzsh"
+not r5
+L251: clr L76
+add #25, L59
+jmp L113
+prn #65
+cmp L150, #245
+L252: .string "rviospexihvqawwblbdcvr"
+jsr L209
+clr L25
+sub #185, r1
+L253: clr L190
+not *r7
+red L91
+cmp *r2, L191
+
+L254: clr L81
+L255: inc L228
+L256: jmp *r2
+; comment
+mov r1, L167
+L257: .string "svietknesi"
+L258: lea L187, r7
+L259: .data 480
+clr r0
+jsr *r1
+L260: cmp r0, #60
+L261: dec r1
+sub #-45, L40
+jmp *r0
+lea L48, L110
+bne L137
+L262: bne L107
+L263: .string "kqmb"
+prn L212
+L264: clr L148
+L265: dec r6
+clr *r5
+jmp L217
+L266: jsr *r6
+sub #-191, r4
+L267: red *r4
+L268: not r7
+red L85
+L269: lea L147, L60
+stop
+sub L51, r3
+
+; comment
+bne *r0
+mov r0, *r7
+L270: cmp L136, #-211
+not r2
+cmp #68, *r0
+L271: lea L130, L271
+L272: inc *r4
+L273: rts
+bne L109
+L274: sub r3, L65
+L275: sub L132, L191
+dec r7
+L276: red r2
+L277: .string "dbg"
+add r6, *r1
+
+bne *r1
+; comment
+L278: .string "qoodhaztfhzlxrfw"
+L279: stop
+L280: lea L237, L137
+cmp L64, #-234
+
+dec r0
+jmp *r6
+L281: cmp r2, #-167
+jmp L197
+L282: cmp #56, L141
+dec L151
+prn r3
+bne L272
+jmp L121
+not r7
+L283: .data 950, 214, -854, 791, -129, -187
+L284: .string "aotdi"
+prn r4
+rts
+L285: .data 145, 60, 155, 71, 12, -933, -178, -875
+sub r3, *r2
+L286: mov L60, r7
+L287: jmp L96
+L288: lea L198, *r4
+jmp L89
+L289: .string "svwcqzic"
+L290: stop
+L291: stop
+
+L292: .string "rueslciwnhpklkzox"
+add L83, r7
+L293: .data -628, 149, 369, 246, -266, 803, 942
+L294: jmp *r7
+L295: jmp *r4
+dec L246
+jmp L187
+L296: sub L194, L195
+L297: .data -211, 199, 969, 294, 324, 566, -581
+L298: .data 93, 969, 864
+dec L14
+L299: prn *r3
+rts
+not *r6
+L300: not L68
+; comment
+L301: add r7, r1
+L302: prn *r0
+L303: clr L129
+sub L290, *r0
+not r2
+prn r2
+L304: lea L151, L228
+L305: inc r2
+jsr L113
+L306: prn r1
+mov r1, L51
+L307: bne L147
+jmp *r4
+clr *r6
+prn L114
+stop
+clr *r7
+rts
+L308: stop
+not L217
+L309: cmp *r3, L54
+L310: rts
+jsr L154
+bne L249
+dec L22
+jsr *r4
+mov *r5, L193
+rts
+L311: .data 730, -616, -930, -762, 939, 956
+add r7, *r0
+L312: bne *r3
+L313: .data -900, -237, 282
+jmp L22
+jsr *r0
+L314: mov #239, r7
+jsr *r6
+L315: prn r7
+L316: jmp *r2
+prn L78
+L317: rts
+L318: .string "xtmibosndiwqsrinzw"
+L319: .string "clevryjmcpdu"
+jmp *r1
+add r4, L192
+L320: jsr *r4
+stop
+bne *r7
+jmp L239
+stop
+L321: .data -817, 551, 924, -536, -590, 449
+mov #124, r3
+mov *r6, *r4
+L322: prn #231
+sub r3, *r4
+mov r2, L226
+dec L61
+add L293, L314
+L323: lea L125, r7
+L324: stop
+rts
+L325: inc L214
+bne *r4
+jmp *r6
+clr *r3
+L326: .string "xqennxhwbzffoozsr"
+not *r2
+mov r6, *r5
+L327: stop
+add #-4, L121
+L328: .data -442, -327, -206
+sub #124, *r1
+inc L117
+dec *r6
+L329: cmp *r2, #-75
+jsr L83
+; comment
+dec r0
+L330: lea L61, *r0
+prn L15
+red *r4
+prn *r7
+L331: dec L59
+cmp #45, #-134
+inc r1
+L332: jsr *r2
+clr *r5
+mov L151, *r2
+jmp L103
+
+lea L277, *r7
+L333: stop
+stop
+L334: jmp L75
+L335: .string "gwgqzqqxczwdizd"
+bne L15
+stop
+L336: .string "tboznottovbfpntic"
+L337: dec r0
+clr L150
+bne L253
+L338: clr r2
+add *r5, r1
+rts
+L339: .data 499, -837, 176, -88
+stop
+not *r0
+L340: inc L187
+clr *r5
+bne L330
+stop
+jmp L23
+L341: add *r2, *r6
+clr *r5
+L342: sub r7, L166
+bne *r7
+cmp L264, L88
+jmp L71
+; comment
+jmp L22
+bne L40
+L343: stop
+L344: sub L8, r5
+L345: lea L65, L197
+L346: sub #-165, L132
+L347: not *r6
+dec L312
+dec r7
+L348: mov r3, *r2
+L349: not L158
+jsr L251
+red L146
+red *r4
+prn L218
+add *r5, r0
+jmp *r3
+add r6, r2
+L350: clr r3
+jmp *r5
+L351: inc r7
+dec *r1
+L352: .string "maogu"
+
+L353: .string "lpnijp"
+L354: mov L202, L102
+jsr L349
+L355: jmp L109
+not L266
+L356: bne L71
+stop
+jmp L48
+red r3
+not *r4
+not r3
+jsr L8
+L357: rts
+bne L283
+; comment
+L358: prn r2
+L359: lea L52, L345
+red L126
+not L113
+lea L28, L1
+jmp *r1
+L360: lea L328, r4
+L361: jsr *r1
+L362: not L272
+jmp *r4
+L363: .string "klzke"
+L364: jmp L268
+mov #-22, r3
+L365: .data -507, -753
+L366: jmp *r1
+inc *r4
+L367: add r7, L28
+rts
+mov #-89, *r3
+L368: lea L108, L35
+; comment
+cmp #-74, *r1
+L369: .data -286, 410, 369, 227, 23, -514, -952, 368
+L370: .data -552, -105, 960, 430
+red *r6
+sub r3, *r5
+L371: .string "svnqnriskinrgjbhhwobs"
+dec r1
+L372: inc L5
+L373: jmp *r4
+L374: .data 807, -553, -460, 332, 945, 752, -185, 855
+L375: not L343
+cmp *r2, r2
+red r6
+L376: jmp L337
+inc L258
+rts
+mov L175, r2
+sub r2, *r7
+L377: lea L97, L121
+not r0
+sub #185, L219
+; comment
+L378: sub r4, r7
+cmp r1, #251
+mov L36, *r1
+L379: add r5, r7
+L380: mov r6, *r3
+clr L321
+L381: prn #237
+L382: sub L338, *r2
+clr L313
+dec *r7
+cmp *r5, r7
+L383: inc r2
+not r7
+lea L37, r7
+L384: inc r7
+L385: lea L341, r2
+L386: dec L200
+stop
@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 31
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+L0: .data -336, 949, 35, -418
+L1: .string "ixftvgovnmxdjvvefyohuity"
+not r6
+bne *r3
+L2: sub *r4, L0
+L3: sub *r5, r1
+jsr L1
+jsr L1
+jsr L0
+jsr L0
+lea L0, *r5
+prn #-203
+; comment
+rts
+
+L4: add *r4, L4
+inc L0
+L5: not L2
+L6: cmp #-218, *r5
+rts
+L7: dec L5
+not r6
+stop
+cmp L2, #-129
+L8: .data -68
+mov #89, r6
+not *r2
+clr *r6
+L9: prn L7
+L10: jsr *r0
+rts
+L11: prn #6
+not *r6
+L12: prn *r7
+red *r1
+cmp *r2, *r2
+jsr L3
+red L3
+rts
+bne L10
+L13: bne L13
+inc r5
+L14: .string "fcirxclvrxegyiuqulai"
+sub L4, *r6
+stop
+red r4
+dec *r0
+L15: stop
+L16: .data -841, -747, 640, -788, -543, 810, -233
+stop
+L17: .string "ikemalxjzfsfatpz"
+red *r3
+L18: add *r0, r5
+stop
+L19: .string "fouo"
+bne L19
+red L16
+L20: .data -721, 465, 495, -337, 331, -452, 696
+red L2
+L21: not *r1
+jsr L18
+lea L7, r1
+prn r6
+add L0, L4
+prn *r2
+bne L10
+L22: stop
+L23: prn r1
+L24: red r0
+jmp L23
+sub #152, r2
+L25: stop
+rts
+add #-30, r4
+dec r0
+L26: mov r2, L1
+inc L0
+add *r4, r0
+dec r7
+inc L1
+clr L21
+L27: dec L8
+L28: .string "iizogpz"
+L29: .string "sqewvhlevrvxrdrdjblsn"
+L30: .data -390, -71
+L31: jmp *r2
+sub L4, r1
+L32: cmp #72, #-44
+not L23
+jmp L21
+L33: bne *r5
+sub #165, *r2
+clr r2
+lea L31, L32
+L34: not *r6
+bne L1
+; comment
+red r1
+clr r2
+L35: bne L8
+; comment
+lea L3, L24
+mov r0, L1
+stop
+L36: red r0
+red *r4
+inc *r5
+L37: add r6, *r6
+; comment
+red L15
+red L8
+prn r6
+lea L0, r7
+red r6
+L38: mov #161, *r0
+L39: stop
+clr *r7
+
+
+rts
+L40: add #187, *r3
+
+bne L17
+dec *r3
+L41: .string "wtzzlt"
+jsr L5
+jsr L37
+jsr L40
+L42: jmp L42
+not L32
+mov #-124, *r7
+L43: prn *r6
+L44: mov L31, L14
+L45: cmp *r5, r0
+L46: sub *r3, r4
+mov *r6, r6
+L47: bne L24
+mov #-77, r6
+sub #195, L13
+L48: .string "hphremyvicbeucv"
+red *r1
+L49: lea L23, L26
+L50: not r7
+L51: cmp L48, L41
+L52: add r2, *r6
+mov *r7, *r1
+L53: bne *r6
+L54: red r1
+dec *r2
+not L43
+rts
+rts
+
+L55: stop
+rts
+clr *r5
+stop
+L56: jmp L5
+L57: dec L51
+L58: add #-75, r1
+inc L50
+inc *r5
+L59: bne *r3
+cmp *r2, *r1
+L60: clr r5
+mov L58, r4
+jmp L4
+L61: bne L13
+mov *r5, r2
+L62: clr r4
+L63: jmp *r7
+L64: mov #-245, *r5
+L65: stop
+mov L26, *r2
+L66: inc *r6
+L67: .string "rhsmg"
+stop
+jsr *r3
+L68: not L37
+rts
+L69: .data -533, -883, 337
+; comment
+L70: jmp *r4
+lea L40, *r2
+inc L8
+L71: inc L29
+sub L33, *r3
+L72: .data -830, 511
+jmp *r0
+sub r7, r1
+L73: clr L73
+
+L74: sub *r7, *r2
+jmp *r6
+clr L72
+bne L58
+jsr *r6
+L75: jmp L46
+inc r6
+L76: jmp L64
+
+add L44, L32
+L77: jsr *r1
+L78: .string "fls"
+dec L41
+
+bne L61
+cmp L69, r6
+L79: dec *r2
+not L66
+rts
+mov L29, *r1
+cmp *r2, *r5
+bne L62
+cmp #-97, L71
+L80: jsr *r6
+mov *r3, r3
+L81: lea L22, *r2
+prn r4
+L82: clr L74
+inc L42
+rts
+rts
+add r1, r0
+L83: jmp *r0
+jmp L37
+L84: sub r7, *r5
+inc L54
+L85: add r1, r0
+L86: mov r3, *r0
+red r7
+L87: .data -307, -328, 780, -294, -383, 464, 753, -591
+mov *r6, r7
+L88: .string "phrhlcvlwbwehhvghwjgqp"
+L89: jsr L64
+; comment
+red L53
+; comment
+mov *r2, L4
+L90: prn L10
+prn #17
+L91: prn *r4
+sub *r6, L4
+lea L2, r6
+L92: lea L9, *r1
+bne L58
+not L65
+lea L75, L72
+not r5
+jmp L4
+L93: .string "fieepbyzkacuwfakpthxckxy"
+rts
+dec r5
+prn r5
+jsr L78
+jsr *r0
+L94: dec r7
+L95: .data -459, 169, -327, -374, 189
+L96: clr L47
+jmp L40
+; comment
+jmp L47
+dec L89
+clr *r1
+jsr L14
+red *r0
+; comment
+L97: .string "rj"
+bne *r0
+L98: not L22
+clr *r5
+stop
+red *r5
+L99: jmp L6
+mov r7, *r5
+cmp #11, *r1
+add L92, L11
+
+; comment
+mov *r1, L62
+stop
+jsr L20
+clr *r1
+clr r7
+clr r7
+not L91
+L100: jsr L3
+jmp *r1
+; comment
+L101: clr r2
+L102: mov *r1, r6
+dec *r6
+clr *r0
+stop
+L103: mov r1, L79
+red L99
+L104: inc *r7
+L105: lea L12, L36
+lea L13, *r6
+L106: jsr L92
+not *r7
+L107: bne *r1
+lea L43, r6
+add r3, r6
+red *r7
+L108: prn L60
+; comment
+L109: mov r4, r7
+L110: dec r4
+red L67
+inc L108
+stop
+sub *r1, r3
+not r1
+L111: dec *r1
+
+L112: .string "zmyqkoalzjfqkswkx"
+; comment
+L113: jmp L45
+L114: .data 223, -808
+L115: jmp *r5
+clr r4
+sub #49, *r3
+dec L70
+L116: .data -4, -585, 329, 578
+red r1
+not r2
+jsr *r6
+red L64
+L117: prn *r1
+rts
+jmp *r6
+L118: add L6, r2
+L119: sub r2, *r6
+bne *r0
+add r1, r3
+L120: lea L104, *r2
+cmp *r2, *r5
+bne *r4
+; comment
+
+sub r3, *r6
+jmp L36
+prn r7
+stop
+lea L37, *r4
+L121: jmp *r6
+lea L5, L22
+mov L56, r1
+L122: bne L7
+red *r7
+L123: dec *r7
+L124: prn #34
+rts
+L125: sub L67, r4
+L126: rts
+dec *r2
+L127: stop
+lea L25, L11
+L128: stop
+inc *r0
+L129: bne L33
+jmp L59
+stop
+not r4
+jmp L11
+dec r0
+add #-70, *r2
+bne L114
+lea L18, r6
+L130: .data 995, 169, -76, 409, -698, 457
+L131: .data -572, -265, 953, 887
+inc *r1
+L132: .data 75, -830, 780, 991, 542, -520
+bne *r5
+
+
+L133: red r2
+jsr L24
+L134: lea L122, r2
+mov L83, *r3
+L135: .string "wdqfwdpyaywwqai"
+not *r3
+prn L97
+L136: .string "fhdjjodivxsn"
+L137: mov #160, L52
+L138: .string "epwkxnuuvcjagrgg"
+stop
+L139: not L81
+clr *r2
+L140: jmp L19
+inc *r3
+L141: rts
+dec L108
+inc L103
+bne L35
+L142: prn *r4
+prn L54
+cmp *r3, #-256
+L143: rts
+jsr *r5
+stop
+not *r3
+L144: lea L22, L5
+sub L82, L104
+sub #-200, r0
+sub L60, r0
+L145: red L141
+red *r2
+L146: stop
+stop
+mov *r0, *r0
+L147: jsr L96
+stop
+mov #-190, L122
+bne L24
+prn r2
+red r3
+not *r6
+mov #-2, r5
+prn L137
+
+L148: cmp L133, #-105
+L149: lea L9, r2
+not r4
+L150: dec r1
+lea L106, L56
+inc r0
+L151: stop
+L152: .data 807, 340, 357, 127, -301
+
+bne *r0
+L153: lea L27, r6
+L154: dec r3
+L155: .data -458, -995
+bne L42
+L156: dec r7
+not *r4
+L157: cmp r1, r6
+prn #-208
+lea L76, L121
+jsr *r0
+not *r4
+sub #249, r0
+clr L77
+L158: stop
+prn #83
+add r2, L64
+L159: rts
+not r7
+L160: .data -361, 171, 160
+L161: jsr *r3
+L162: clr L64
+jmp *r1
+add L131, r4
+lea L55, L113
+L163: add r2, L134
+L164: prn #190
+L165: sub *r0, L84
+L166: not r2
+L167: jsr *r4
+lea L111, L46
+
+L168: rts
+add L61, r5
+inc *r0
+mov #-127, *r4
+cmp *r1, *r5
+L169: jsr L27
+prn #114
+red L59
+cmp L89, L8
+rts
+rts
+L170: clr L144
+L171: lea L96, L79
+dec *r0
+rts
+
+prn #80
+jmp *r6
+prn *r5
+add r4, L119
+bne L82
+rts
+L172: jsr L106
+L173: dec L84
+rts
+prn #-89
+L174: lea L32, r3
+L175: stop
+mov r5, *r4
+jmp *r4
+L176: bne L170
+L177: inc r4
+L178: cmp #-124, r6
+L179: .string "refnvtmzyhai"
+L180: rts
+L181: not r0
+rts
+rts
+red *r0
+jsr *r5
+L182: not *r5
+mov L120, *r4
+L183: rts
+L184: .string "dkrlgadqrkfhijkqpog"
+L185: prn r1
+L186: lea L65, L50
+not r2
+rts
+mov r7, r7
+add #-194, L135
+cmp L169, L182
+L187: add r0, r5
+; comment
+L188: not r2
+jmp *r6
+lea L183, r5
+prn L151
+L189: cmp r0, *r4
+dec L93
+
+red *r7
+dec *r7
+L190: red L169
+L191: clr *r2
+sub L67, *r3
+lea L178, L23
+red *r0
+jmp *r2
+L192: add r5, *r0
+rts
+L193: .data 186, 116, 847, -826, -462
+clr *r6
+jmp *r4
+jmp L109
+stop
+; comment
+L194: bne L5
+jsr *r2
+jmp L100
+inc *r2
+jmp L72
+jsr *r6
+L195: dec r2
+L196: prn *r3
+rts
+L197: dec r5
+cmp *r6, r1
+mov L14, L193
+L198: stop
+red L54
+sub *r4, L194
+prn *r4
+L199: clr *r1
+L200: .string "qkextxfoxucsmwho"
+cmp r0, L75
+L201: jsr L197
+L202: inc *r7
+L203: .data -836, 795, 834
+not *r3
+lea L145, *r5
+; comment
+L204: prn #217
+prn L164
+L205: .data -120, 570, 519, -84, 626, -958, -561
+prn r3
+lea L25, r6
+L206: lea L46, *r7
+jmp L134
+sub *r2, L53
+clr L133
+L207: sub r3, r7
+L208: rts
+jmp *r6
+add #-141, L205
+prn L115
+cmp #-135, L177
+L209: sub *r0, L70
+L210: inc L7
+cmp r5, #-99
+rts
+L211: sub L59, *r4
+dec *r6
+inc r7
+L212: .data 250, 831, 845, 72, -892
+sub L202, L186
+rts
+bne L93
+cmp L29, #-244
+L213: inc *r0
+cmp #-17, #164
+add L135, *r0
+add #-131, r4
+L214: bne L118
+L215: cmp #142, L88
+L216: .data 104, 1, 360, -494
+L217: lea L62, *r1
+stop
+cmp *r5, L213
+not L45
+stop
+L218: rts
+inc r1
+L219: dec r2
+rts
+L220: jmp L34
+L221: .string "wrfnshxbnnodkshbvancwhdw"
+lea L45, r7
+red r4
+jsr L133
+L222: .data 183, 149, -72, 743, 113, -35
+jmp *r5
+L223: cmp r0, r7
+L224: jmp L168
+
+lea L169, *r2
+sub *r0, r1
+L225: red L160
+L226: dec r0
+not r0
+mov r1, L124
+L227: clr r2
+lea L215, *r2
+L228: mov *r0, r5
+stop
+sub *r5, r5
+stop
+L229: rts
+; comment
+lea L194, *r2
+mov r7, *r0
+clr *r1
+rts
+L230: inc r6
+L231: cmp r0, r7
+jmp *r7
+not r5
+L232: lea L12, L15
+L233: dec r3
+clr *r5
+rts
+red r5
+L234: .string "jcoxiqmdbczjyvwpk"
+rts
+inc r4
+L235: .data -806, 145, 448, -948, -944, -681, 537
+inc L92
+add L40, r0
+L236: clr *r0
+not *r3
+L237: stop
+; comment
+cmp L230, r5
+sub *r6, r4
+prn r0
+inc r5
+L238: .data 952
+L239: .data -966, -712, 392, -312, 605, 81, -63
+mov r1, r5
+red r7
+
+cmp *r0, *r7
+L240: .data 109, -868, 790, -365, 755, 540
+dec L74
+mov L19, *r4
+L241: .string "tmatmnquq"
+not r6
+clr *r2
+sub L201, r0
+L242: clr r7
+L243: not L236
+; comment
+L244: .data 716, -921, -98, -399, 172, -653, 304
+; comment
+L245: jsr *r6
+jsr L148
+add #-4, L215
+mov r3, r5
+L246: cmp L178, #-112
+L247: dec r7
+stop
+mov r1, r3
+L248: .string "dfyy"
+sub *r0, L36
+add L67, r1
+add *r0, r6
+L249: clr r3
+inc L34
+L250: .string "kwlqqxwmncursyibyapv"
+lea L65, L239
+cmp L71, L57
+bne L139
+L251: red L215
+lea L33, r0
+jsr L19
+L252: clr L106
+L253: .data 505, 372, -87, 821, 812
+add *r0, L191
+not r2
+L254: .string "psrxfgkchigkwcs"
+stop
+sub L111, L203
+prn r2
+L255: clr *r4
+add r1, r4
+add r6, L172
+
+L256: cmp L125, *r7
+jsr L172
+L257: .data -585, 962, -545, -968
+sub #-86, r0
+
+
+L258: jsr L199
+rts
+sub #251, r2
+stop
+lea L148, r0
+mov #240, *r5
+clr *r2
+lea L231, *r2
+L259: prn *r1
+prn #190
+add L132, *r5
+L260: dec L51
+stop
+not *r6
+mov L70, *r4
+clr r7
+stop
+lea L88, L204
+clr L113
+L261: not L254
+rts
+not *r3
+L262: stop
+not *r1
+inc *r3
+bne L120
+L263: red r4
+L264: jsr L65
+bne L64
+L265: mov r5, L94
+L266: rts
+L267: clr *r0
+mov *r1, *r2
+rts
+L268: jsr *r7
+add *r4, r4
+L269: .data 959, 458, 316, 942
+L270: red *r0
+L271: cmp r2, *r1
+red L231
+L272: .data -294, 750, -277, 895, 120, 142
+L273: .data 242, -632, 430
+L274: stop
+
+L275: not *r6
+; comment
+prn *r2
+dec *r2
+sub #215, L92
+jmp L274
+jmp L218
+L276: jmp *r0
+sub *r5, r7
+red L119
+L277: add *r7, L186
+rts
+dec *r0
+dec L65
+mov *r6, r5
+jsr L22
+L278: not r1
+prn r4
+mov *r1, L250
+stop
+L279: inc r2
+L280: .data 741, -597, -162, 615, -222, 702
+sub *r3, r0
+inc L135
+L281: .string "w"
+prn r1
+red r2
+dec L273
+rts
+inc L84
+mov r2, r5
+not r7
+L282: .string "mos"
+L283: inc L240
+not L106
+; comment
+inc L18
+clr L198
+L284: stop
+add #93, r5
+L285: prn L148
+lea L17, *r5
+L286: .data -560, -601, -226
+jmp L51
+bne L214
+L287: not *r7
+sub r3, r4
+L288: .data -125, 294, -661, -571, 935, -838, -520, -591
+prn #-31
+; comment
+prn L3
+L289: .string "kmdmqzzfzh"
+jsr *r7
+cmp *r5, *r3
+not L1
+L290: .string "wquaej"
+stop
+L291: clr *r6
+bne *r6
+cmp L216, r4
+L292: .string "utaglnhsoieqlswnevizh"
+not L56
+lea L84, r3
+add r4, L202
+L293: jmp L67
+mov #41, *r7
+; comment
+rts
+inc L251
+cmp *r7, r2
+clr r4
+L294: cmp r0, L284
+L295: jsr *r0
+not *r2
+jsr *r6
+add r7, r6
+L296: inc L71
+red L192
+L297: inc r4
+L298: add *r6, *r1
+clr *r5
+L299: rts
+L300: prn *r3
+cmp L260, r6
+rts
+L301: .string "vnbkmddcqkqfzbvmenhxaj"
+dec L5
+L302: mov L185, r5
+L303: sub #-121, L124
+lea L121, r3
+dec *r1
+stop
+not L0
+L304: .string "fyhvalgldlfkwjyhsxuetjf"
+L305: sub L190, *r0
+jsr L260
+; comment
+; comment
+bne L44
+L306: not r0
+cmp #-200, L66
+L307: dec L292
+mov r0, *r3
+L308: .string "njhmsfyjuajmllxwwwthkr"
+cmp #192, L90
+L309: clr r4
+L310: lea L44, r1
+L311: add r4, *r0
+inc L185
+add #-120, *r2
+dec r3
+lea L52, *r4
+jmp L239
+
+
+L312: sub r5, *r6
+rts
+L313: cmp L308, #71
+L314: .string "dwkexdlfudlccyeiiqpcj"
+L315: rts
+jmp L215
+L316: inc *r4
+clr *r7
+jsr *r2
+L317: .string "mawdlbxwg"
+lea L136, r5
+L318: .data 598, -976, 328, -183, -824
+rts
+bne *r2
+cmp L172, #-37
+red r1
+clr L13
+not *r7
+L319: .string "caluddlghketfxiurxpetnm"
+clr r6
+L320: cmp #169, L308
+inc r0
+L321: inc *r0
+jsr L135
+L322: mov L234, r4
+L323: .data 739, 778, 922, -423
+dec L126
+stop
+inc r5
+add L78, r1
+inc r2
+L324: clr L212
+
+sub #61, L287
+inc *r0
+L325: .string "dnkcxavwapt"
+not r4
+L326: add L284, L181
+cmp *r1, r2
+clr L94
+bne L151
+L327: jmp L165
+L328: .data 917, -391, -303, -934, 644, 323, 979, 967
+mov r6, *r7
+cmp *r5, r4
+L329: dec *r1
+L330: jsr *r0
+bne *r4
+rts
+
+L331: inc r2
+clr L277
+clr r6
+not L320
+
+prn *r6
+prn #38
+L332: .string "whjrzgeqzigh"
+mov L207, *r5
+L333: red *r2
+dec r0
+clr L324
+L334: stop
+inc r4
+L335: cmp *r2, #184
+lea L296, *r3
+not *r5
+not *r2
+L336: inc *r7
+L337: .string "dcwczkvcj"
+L338: clr r0
+L339: add L30, r6
+mov #-21, r5
+clr L39
+L340: jmp *r0
+dec *r6
+; comment
+prn #184
+stop
+L341: not L80
+clr r1
+dec r7
+bne L157
+L342: prn #167
+L343: .string "iypvgbyhf"
+bne L137
+L344: prn *r0
+
+sub #12, *r0
+L345: .string "ukrhankqsrru"
+lea L262, r6
+not r5
+L346: .data -661, -73, 635, -725, 2, 592
+inc L61
+jmp L35
+L347: jmp *r3
+L348: prn #-187
+inc r4
+L349: clr *r0
+; comment
+jmp L336
+clr *r7
+clr r1
+bne *r7
+jmp *r7
+
+L350: red r5
+sub #240, L116
+rts
+L351: not r3
+not r5
+red *r6
+dec r2
+L352: lea L207, L132
+L353: .string "amybtlnithtwcdt"
+L354: .data -182, -321, -783, -500, -862, 649, -995
+L355: mov L183, *r3
+bne L273
+L356: lea L282, r2
+inc r4
+L357: lea L56, *r1
+L358: rts
+inc L239
+L359: bne *r6
+L360: stop
+bne L290
+stop
@@ -0,0 +1,1026 @@
+; Generated by genCorpus --seed 32
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+L0: mov #101, r0
+L1: stop
+mov L0, *r1
+L2: not r0
+L3: sub *r3, *r7
+bne *r5
+L4: .string "sskfrypix"
+L5: .string "rgguclqzmjfsdidgdscj"
+L6: prn *r7
+; comment
+L7: stop
+bne L0
+L8: dec r3
+L9: rts
+jmp *r6
+add r2, L6
+jmp *r1
+L10: .data -315, -692, -783, -541, 880
+rts
+jsr *r0
+L11: .data -652
+L12: jsr *r7
+L13: .data 280, 472
+L14: sub L8, r5
+cmp *r0, #243
+sub L5, *r2
+bne L6
+rts
+mov r4, r7
+bne *r0
+L15: .data 543, 928, 293, -448
+L16: cmp #18, #101
+L17: .string "oxnnyfqkeqn"
+dec *r5
+inc L9
+L18: sub L17, r6
+L19: clr r5
+inc r4
+jmp L13
+L20: .data 521, -463, 818
+rts
+add #162, r0
+rts
+prn L18
+mov *r7, *r7
+sub L20, *r3
+L21: clr *r2
+prn *r7
+L22: .data -386, -921, 470, -123
+add r5, L9
+bne *r2
+sub *r5, *r4
+L23: bne *r6
+L24: cmp #210, *r4
+clr L13
+bne *r1
+L25: sub *r7, *r0
+; comment
+lea L5, L23
+inc r1
+add #-68, L9
+L26: .data 624, 858, -258, 660, 239, -493, 368
+sub r1, L25
+add L10, r3
+L27: mov *r2, L18
+L28: clr *r5
+
+mov #55, r2
+prn *r3
+L29: .string "hiitbfz"
+clr L3
+L30: cmp #-26, #155
+sub L2, L12
+L31: .string "mflcntkbcymypfl"
+sub r3, r6
+jsr L3
+mov r2, r4
+L32: rts
+jsr *r1
+jmp L2
+L33: mov L27, L24
+
+mov #146, L5
+jsr L20
+L34: lea L3, *r7
+
+L35: jmp *r1
+L36: rts
+
+L37: mov #-235, L5
+L38: inc L28
+; comment
+inc r4
+red r6
+rts
+jmp L23
+bne *r2
+mov *r5, L2
+inc L29
+L39: .string "xzcuuzifrtueaihih"
+dec L23
+sub L36, L7
+jmp L16
+L40: not L37
+lea L2, L6
+stop
+L41: .string "vam"
+L42: not r4
+
+L43: .string "ojnyevef"
+L44: .string "basyjjwbeiuirfxrbhqg"
+L45: lea L43, *r7
+red L2
+stop
+not *r7
+L46: cmp r4, L40
+not L24
+L47: stop
+inc *r5
+stop
+L48: dec r0
+L49: jsr L40
+L50: clr r5
+L51: add #237, L28
+dec *r3
+inc r0
+cmp #-196, *r6
+stop
+rts
+L52: .string "hlmgemvcqdymyyntmssoreni"
+L53: clr *r2
+add r7, *r5
+mov *r6, r0
+lea L6, r1
+red r0
+inc r7
+sub *r4, L42
+prn *r2
+clr *r2
+L54: lea L7, L19
+bne L3
+stop
+L55: not L52
+add r6, r6
+L56: inc *r6
+jmp L6
+L57: not r5
+clr *r0
+add #125, L4
+bne L11
+not r5
+dec L50
+L58: red L52
+red L45
+rts
+L59: bne L5
+L60: .data 484, 682, -672, 744
+L61: .data 839, 854, -384, -1, -96, -333
+L62: sub *r4, *r4
+L63: .data 721, -681, 479, -252, -791, -269, 649
+lea L12, L19
+lea L39, r5
+L64: bne L4
+add L56, r7
+lea L44, *r1
+red r3
+cmp r2, #127
+jmp L40
+red r1
+jmp *r6
+stop
+L65: .string "ykgsbplx"
+L66: .string "tpv"
+add *r5, r6
+jmp *r0
+L67: jsr *r0
+lea L11, L40
+sub L29, r3
+rts
+L68: inc *r7
+
+L69: sub r0, L6
+not r6
+sub *r6, *r7
+L70: inc *r1
+; comment
+rts
+L71: .data 828, -101, 237, 959, -854, 507
+lea L19, r0
+L72: .string "zmebfglpkp"
+bne L46
+L73: jmp *r6
+; comment
+L74: rts
+stop
+L75: add *r7, r4
+jmp L38
+
+L76: clr L71
+L77: red L21
+L78: lea L69, *r3
+not r1
+sub *r6, *r1
+L79: clr *r3
+L80: jsr L31
+rts
+L81: .string "sc"
+
+L82: jmp *r5
+L83: sub r6, L9
+jmp L25
+add *r0, L48
+jmp L14
+stop
+not r1
+L84: rts
+L85: prn L53
+add #-252, *r7
+jmp L60
+clr *r4
+L86: sub r1, r0
+clr *r4
+sub #-189, L27
+L87: bne L42
+L88: rts
+L89: red r3
+L90: lea L67, *r2
+prn #148
+L91: .data 671, -940, 528, -172, -5, 247, -761
+lea L73, *r0
+bne *r3
+inc r0
+L92: lea L82, *r0
+inc L92
+sub r7, *r2
+L93: mov #-244, L62
+L94: .data -905, -885, 783, -557, -465
+prn r4
+inc *r7
+L95: .string "yghmqopoywuzqgctyxw"
+L96: stop
+add #-117, L4
+bne L83
+L97: bne L35
+inc *r6
+L98: inc L14
+; comment
+sub r4, L86
+prn *r0
+L99: jsr *r5
+bne *r7
+jmp *r4
+L100: sub *r6, *r2
+red *r5
+inc *r2
+not r6
+stop
+stop
+red r7
+bne L46
+red r0
+stop
+L101: sub *r7, L93
+L102: .string "qmaockac"
+lea L29, r0
+L103: red L31
+red *r5
+jsr L13
+L104: stop
+L105: cmp r2, r5
+bne *r4
+clr L69
+not r7
+bne *r7
+L106: clr r0
+not r1
+L107: clr *r7
+L108: stop
+dec r1
+L109: rts
+prn #75
+; comment
+L110: inc r6
+jsr L44
+clr *r6
+inc r0
+L111: inc r3
+jmp *r3
+stop
+cmp *r5, #251
+L112: .data -581, -158, -551
+mov r0, r5
+L113: lea L67, r5
+red *r2
+rts
+rts
+jmp L83
+; comment
+; comment
+L114: inc *r2
+L115: .data -883, 711, 291, 82, 944
+prn L52
+L116: cmp L13, #-159
+lea L10, r6
+stop
+bne L110
+cmp r1, *r2
+stop
+red L112
+jmp *r5
+L117: jmp *r7
+lea L28, *r5
+L118: rts
+L119: cmp r1, L17
+mov L13, r0
+L120: mov r7, *r5
+inc r6
+L121: cmp r1, L89
+L122: lea L42, *r7
+lea L5, r2
+bne L9
+mov r5, r7
+bne *r5
+L123: not L25
+stop
+prn #165
+jsr *r0
+L124: mov L124, *r6
+stop
+bne L40
+mov #69, r1
+L125: inc r4
+dec L97
+jsr *r7
+clr r2
+prn L117
+bne *r3
+dec r0
+L126: clr r5
+mov #246, L112
+add #-122, L0
+dec r5
+L127: .string "qat"
+L128: dec r7
+sub r4, *r3
+red r7
+; comment
+mov r1, *r0
+not *r0
+dec *r1
+L129: cmp *r1, *r7
+mov L19, r0
+lea L104, L11
+red r4
+jmp *r0
+L130: lea L21, *r4
+L131: rts
+
+rts
+lea L117, L105
+L132: not L116
+inc r7
+bne *r3
+clr r0
+sub r1, L113
+L133: jsr *r7
+dec L10
+clr L56
+inc r0
+dec *r2
+
+L134: rts
+; comment
+mov r1, L45
+lea L30, r2
+stop
+dec L27
+inc *r4
+red L82
+L135: red *r7
+jmp L70
+sub #-160, *r6
+dec *r2
+jsr L36
+stop
+not L101
+L136: jsr *r3
+dec *r5
+not *r0
+L137: not r2
+add L88, L0
+L138: rts
+lea L30, L1
+L139: clr *r3
+jmp L27
+jmp *r6
+L140: sub r4, L122
+L141: .data 73, -622, -448, -147, 879
+red *r0
+L142: .string "qxuicbrtsanwkveanh"
+not *r1
+L143: add L61, *r4
+L144: .data -923, -896, 618, 883
+L145: .string "buom"
+bne *r1
+L146: .data 935
+L147: .data 295, 707, -619, -222, -58, 870
+L148: .data -605, -844, -900, -675
+clr r1
+lea L83, *r1
+; comment
+L149: mov *r6, *r5
+jmp L91
+inc L125
+sub #-130, L109
+mov L75, *r0
+prn #-154
+sub #-60, *r2
+L150: sub *r0, L26
+L151: .string "kj"
+mov L0, L89
+; comment
+L152: sub L27, L60
+L153: not r4
+jsr *r1
+
+L154: clr r6
+L155: dec L146
+L156: .data 704, -346, -957, -358, -631, 294, 203, 453
+L157: cmp *r5, #-4
+L158: lea L69, *r2
+clr *r7
+cmp #217, L76
+inc r1
+L159: .data 75
+jsr *r1
+clr *r4
+add L39, r5
+red *r7
+L160: mov r7, *r3
+stop
+clr *r3
+clr *r6
+L161: prn #63
+L162: rts
+inc *r0
+sub r3, *r3
+L163: .data -34, 378, 876, -917, 182, -374, -73, -673
+sub *r6, *r1
+L164: sub L153, L53
+sub L107, r0
+add r6, r6
+inc L69
+prn #-139
+inc L148
+L165: .string "uwbjtfvdpjxdimnsyh"
+L166: prn *r4
+cmp *r3, L111
+L167: red L33
+; comment
+red *r2
+mov r5, *r4
+L168: .data 65, 295, -348, 375, -317, -236
+L169: inc *r5
+sub #196, L24
+L170: lea L153, r7
+L171: .string "eiao"
+L172: jmp *r6
+L173: stop
+not *r4
+mov L96, *r5
+L174: .data -919, -991, -431, 596, 869, 41
+L175: .string "bdtqqfhjatuohtjrd"
+L176: cmp *r1, #-169
+add r2, r7
+jmp L106
+L177: lea L4, r2
+red L116
+L178: .data -593
+jsr *r4
+L179: .string "mkrpweggpzaucklj"
+L180: sub #141, r4
+L181: cmp #224, L62
+clr r7
+not *r4
+jmp *r5
+; comment
+clr L169
+clr *r4
+L182: sub L38, *r3
+L183: red r7
+dec r1
+L184: rts
+L185: jmp L115
+jmp L122
+rts
+L186: not r0
+rts
+L187: bne *r4
+L188: clr *r3
+add r2, *r5
+add r0, L98
+rts
+mov *r5, *r0
+bne L36
+L189: .data 342, -144, -571
+mov *r6, r6
+dec L3
+stop
+red *r2
+mov L16, L9
+L190: lea L77, r6
+red *r7
+mov #-66, r3
+jmp *r4
+L191: dec L133
+add #134, *r6
+sub r2, r1
+inc *r4
+dec r0
+not L149
+L192: dec *r3
+
+inc L119
+add L170, r1
+L193: red L72
+L194: clr r7
+L195: jmp L162
+; comment
+L196: .string "mbc"
+prn #-244
+add r3, r0
+not *r0
+prn *r2
+inc *r4
+; comment
+add #139, L154
+jmp *r1
+; comment
+L197: prn #250
+L198: add L13, *r4
+inc L184
+dec L76
+L199: jsr *r3
+stop
+prn r6
+prn #205
+jsr *r3
+prn r6
+L200: not L86
+jmp *r6
+jmp *r6
+clr r4
+stop
+L201: cmp *r4, #111
+L202: red L76
+L203: .string "qsoluoudgdvyreoowzp"
+L204: dec *r7
+inc *r4
+lea L112, *r2
+dec *r5
+L205: .string "yhpamyrkaa"
+dec r1
+L206: sub *r0, *r7
+sub #5, L155
+add *r3, *r1
+cmp *r6, *r2
+L207: mov L110, *r4
+
+L208: jsr *r6
+; comment
+L209: not *r1
+inc L92
+L210: sub #169, *r3
+sub #-216, r0
+jmp L132
+dec *r7
+inc r5
+inc L26
+L211: red *r2
+cmp #-9, #54
+L212: jsr *r4
+clr *r4
+rts
+L213: not *r0
+inc L105
+mov #59, L134
+sub L78, L187
+inc *r7
+prn L173
+prn L89
+add #185, *r7
+L214: clr r1
+; comment
+not *r7
+
+mov r5, L47
+bne *r4
+L215: inc L82
+stop
+rts
+; comment
+L216: .data 264, -44, 959
+inc L212
+L217: cmp L48, *r5
+L218: inc r7
+rts
+L219: rts
+rts
+dec L47
+
+red r3
+rts
+L220: dec *r0
+bne L78
+dec r6
+bne L27
+add r2, *r4
+dec r1
+stop
+not r1
+L221: clr L55
+L222: .string "grkqmsgjszu"
+L223: .data -331, 660, -742, 494, 91
+L224: jmp *r0
+add L114, L118
+L225: add L194, r5
+L226: red r1
+L227: not r4
+L228: .string "gqforwhf"
+inc L198
+sub *r2, *r0
+inc r7
+L229: .string "ilpapv"
+prn r1
+L230: jsr *r3
+L231: stop
+L232: lea L7, L98
+L233: .string "hnpr"
+clr r6
+jsr L39
+
+mov *r5, L133
+rts
+jmp L16
+cmp *r3, r5
+jsr *r0
+dec *r3
+lea L201, r6
+mov *r3, r1
+clr r2
+inc r5
+; comment
+L234: red *r3
+L235: .data -793, 805
+stop
+L236: dec r7
+jsr L92
+L237: cmp r6, *r0
+L238: dec r4
+L239: jsr *r6
+rts
+L240: stop
+L241: dec L91
+inc L35
+mov *r4, r1
+L242: prn #180
+L243: sub L85, *r5
+mov #140, *r6
+L244: inc r7
+L245: .data 878
+L246: inc r6
+jmp *r2
+jmp L8
+stop
+cmp #-75, #-70
+jmp *r2
+L247: not L100
+L248: rts
+L249: red r7
+L250: bne L176
+L251: not L225
+jsr *r5
+dec *r0
+L252: .string "ldqfyupllkw"
+L253: prn L219
+L254: .string "jhozpehconsaslgtx"
+jmp *r2
+mov *r2, r2
+L255: red L79
+sub *r2, r4
+L256: jmp *r1
+jsr L27
+add r5, *r2
+cmp L148, L11
+L257: clr L214
+rts
+add r0, L129
+jsr L78
+L258: add r7, L171
+mov L137, L243
+not L229
+L259: lea L80, *r3
+prn *r3
+inc *r4
+L260: prn L243
+add r1, r5
+L261: .string "zpfi"
+
+dec *r5
+L262: prn *r6
+clr L124
+dec r7
+L263: inc L111
+L264: lea L17, r2
+stop
+bne L172
+mov *r5, L70
+L265: jmp L60
+L266: .string "cqxybjtpvqjtdyocyzawa"
+L267: not r6
+L268: prn r4
+L269: .string "evt"
+L270: add #236, L47
+rts
+red r2
+stop
+L271: clr L113
+mov r2, L184
+sub #-47, r7
+L272: .string "ytzvcwqlljljplr"
+; comment
+L273: clr L206
+cmp r0, *r6
+L274: red L135
+prn L69
+L275: red *r5
+sub r1, r7
+rts
+jmp *r3
+L276: .data -970, 169, 804
+L277: add r1, L186
+stop
+L278: .string "ewduv"
+bne L173
+; comment
+jsr *r0
+L279: add #130, L170
+L280: stop
+L281: inc r7
+mov #-76, r2
+L282: jmp L29
+L283: red *r1
+red r3
+L284: .string "ibpt"
+inc L60
+inc *r6
+L285: clr *r0
+L286: sub r4, *r3
+L287: prn r7
+red L119
+prn r7
+L288: .string "dyserijkdb"
+jsr L239
+L289: red *r3
+; comment
+
+stop
+jsr *r7
+L290: jmp *r2
+rts
+L291: bne *r0
+L292: prn r3
+prn r3
+add #4, *r3
+
+L293: dec L220
+lea L77, L289
+L294: prn L53
+rts
+stop
+L295: .data -880, 53, 737
+inc r4
+rts
+L296: lea L195, *r1
+
+L297: add *r2, L263
+L298: prn r1
+L299: inc L97
+L300: dec L120
+cmp *r1, #68
+jsr *r3
+not *r1
+mov #88, L202
+red L76
+cmp *r2, r2
+L301: dec *r2
+inc r2
+L302: prn #-97
+stop
+lea L5, *r5
+jmp L214
+sub #34, L171
+L303: jsr L246
+clr *r5
+L304: cmp *r0, #-11
+; comment
+L305: .string "goybdrvcbkcbneavi"
+not *r4
+
+bne L173
+sub r5, *r1
+jsr L165
+L306: .data 577, 5, -793, -870, -964, 414, 983
+prn L219
+L307: not *r1
+
+L308: .data -931, -319, 980, 461
+rts
+L309: .string "liwhgskhoibqzx"
+jsr *r2
+bne L138
+L310: red *r4
+bne *r7
+L311: inc L232
+add L45, *r0
+inc *r0
+L312: dec *r3
+not *r3
+
+add *r2, r1
+cmp r0, *r3
+red r0
+cmp #66, r1
+sub *r3, *r1
+sub L178, *r1
+dec L179
+L313: not r1
+L314: dec *r4
+red r2
+add *r7, r4
+red r0
+mov L225, r1
+L315: add #114, *r6
+prn *r5
+red r5
+L316: prn r1
+L317: mov L140, r7
+mov #176, r0
+bne *r6
+prn L171
+L318: mov r3, r7
+L319: jmp L246
+L320: .string "x"
+L321: rts
+cmp L273, *r3
+lea L305, *r4
+dec L51
+L322: .data 663, 764, 89, 473, -869
+rts
+add L9, *r7
+jsr L137
+L323: dec L36
+not L223
+L324: .data 261, 318, -557
+mov r5, *r3
+cmp r4, r4
+L325: .string "nezrogltojsvkav"
+lea L137, r2
+L326: .data -938, -123, -185, 822, -280, 520
+inc r2
+mov #-180, *r7
+stop
+bne *r4
+lea L325, L110
+L327: lea L312, *r4
+L328: add L244, L171
+add r2, *r2
+sub *r3, L297
+L329: lea L58, L223
+cmp *r1, *r6
+L330: sub r1, *r3
+bne L246
+jsr L248
+L331: jmp *r5
+jmp *r6
+jmp L179
+L332: .data -444, 800
+red L146
+L333: sub L332, *r7
+not *r7
+L334: sub #-100, L154
+stop
+rts
+lea L10, *r5
+red L245
+bne L310
+jmp L228
+clr L249
+
+L335: sub r0, L12
+jmp *r1
+add L136, *r2
+L336: cmp r2, #7
+clr r6
+; comment
+prn r3
+bne *r5
+L337: bne L59
+bne L130
+L338: jsr L324
+mov #-10, r1
+L339: .data -379, -595, -1000, -939
+L340: rts
+bne L173
+red r3
+bne L70
+not *r4
+stop
+rts
+dec r5
+dec *r5
+L341: red r4
+L342: .data -344, 892, -320, 30, -395, 518
+stop
+jsr L29
+add r3, *r7
+red L140
+; comment
+L343: stop
+bne L12
+L344: .string "jfqvozitpfnc"
+L345: stop
+L346: .data 87, -823
+L347: not L330
+red *r3
+stop
+; comment
+L348: not L271
+L349: not r5
+jsr L52
+bne *r7
+sub *r3, *r5
+rts
+L350: cmp r3, L348
+inc r5
+L351: .string "pbcysdn"
+L352: stop
+not *r5
+L353: prn r3
+L354: .data 643, 141, 485
+L355: lea L33, r3
+bne *r4
+rts
+rts
+prn r3
+inc L19
+clr r7
+L356: mov #-224, L198
+; comment
+stop
+lea L2, *r2
+stop
+prn *r6
+jmp L178
+prn L325
+inc *r5
+inc *r1
+sub *r4, L159
+red *r2
+dec *r6
+L357: stop
+; comment
+L358: inc *r7
+L359: stop
+lea L29, *r5
+red r5
+jmp L290
+cmp L267, r2
+L360: sub *r2, L140
+lea L114, *r6
+
+dec L351
+clr L239
+L361: inc *r2
+jmp *r0
+rts
+L362: jmp *r2
+
+inc r6
+L363: .string "mva"
+
+sub L226, L300
+dec L36
+L364: add L270, *r6
+cmp #-12, r1
+L365: jmp *r3
+L366: prn r7
+L367: stop
+L368: sub *r1, *r0
+stop
@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 33
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+prn L320
+L0: rts
+jmp *r3
+prn L0
+lea L0, L0
+L1: .string "iltwinaqx"
+L2: mov *r2, r1
+bne L0
+red r7
+cmp r6, r6
+cmp r5, L0
+L3: mov #230, L2
+clr L1
+prn L0
+dec r5
+clr *r6
+inc L0
+L4: prn #-133
+dec L2
+L5: inc *r2
+; comment
+prn #-154
+jsr L0
+cmp #99, *r4
+L6: mov #240, r1
+cmp r1, r4
+prn L4
+mov #161, L2
+dec *r1
+prn L3
+red *r6
+add #-248, r1
+bne *r3
+L7: mov *r1, *r1
+L8: stop
+sub *r6, *r6
+jsr *r7
+jsr *r3
+; comment
+mov r5, r3
+not *r6
+L9: .data 128, 941, 181, 103, -595, -323
+rts
+sub L2, r4
+sub L9, *r1
+
+L10: bne *r4
+inc L0
+bne *r3
+jsr *r2
+L11: stop
+rts
+
+L12: lea L6, L1
+jmp *r5
+stop
+L13: stop
+dec L7
+prn #30
+lea L5, r3
+L14: prn *r1
+lea L3, *r7
+L15: dec *r0
+L16: stop
+L17: not *r5
+jmp L8
+; comment
+; comment
+rts
+sub L3, L8
+dec *r2
+red *r6
+L18: .string "nofu"
+dec L8
+add r0, r6
+jmp L7
+sub L7, L17
+add *r0, r6
+L19: .string "pxlcczpqtyahjiqzhutm"
+L20: .string "u"
+add L10, L10
+
+rts
+clr L15
+sub *r7, L14
+L21: jmp *r4
+L22: jsr *r3
+mov L15, r7
+jmp L17
+L23: not L0
+dec L9
+inc L6
+sub r0, r3
+stop
+prn *r2
+dec *r5
+L24: bne L8
+L25: rts
+add L3, L7
+L26: .string "psgdoptqeixyndmwafcu"
+not *r4
+bne L18
+L27: prn r3
+lea L19, L7
+clr r6
+jmp *r6
+not L2
+L28: .data -923
+jmp *r7
+mov r0, L18
+clr r1
+
+stop
+add r2, L18
+L29: jmp L2
+prn L3
+lea L9, *r5
+stop
+red r6
+jsr *r6
+not *r5
+L30: .string "vtibyzhxxd"
+jsr L26
+prn *r3
+L31: .data -707, 66, -986
+add L1, L15
+dec r1
+L32: lea L30, L31
+L33: .string "svziqaveefrwrzmzfyopx"
+jsr L2
+prn #-182
+prn #30
+L34: rts
+prn r5
+rts
+L35: .string "hnkwjpjwvixgzdicnis"
+lea L19, *r1
+not *r5
+inc r6
+stop
+mov *r3, L0
+not L2
+sub #37, r2
+inc r5
+add #-122, r4
+prn #-154
+dec L18
+jsr L18
+; comment
+inc *r6
+red r7
+L36: sub *r2, *r4
+inc L6
+jmp L1
+add *r7, r7
+L37: .string "txkjzqybcyvigr"
+L38: .string "p"
+L39: dec r1
+red L2
+stop
+; comment
+jmp L17
+L40: mov r0, *r2
+bne L8
+L41: .data 960, -879, -139, 413, 557, -161, -46, -509
+mov L15, L41
+L42: red L39
+lea L0, r5
+L43: dec *r6
+L44: mov #180, r3
+not *r7
+inc *r3
+L45: red r4
+L46: .data -231
+L47: lea L46, r3
+L48: add r7, L5
+L49: rts
+
+mov #-226, *r5
+L50: .string "zxzusnuvnnrjho"
+not *r1
+L51: rts
+
+L52: rts
+L53: stop
+L54: lea L28, L21
+stop
+L55: rts
+L56: lea L24, L51
+clr r0
+L57: stop
+mov #173, r0
+L58: stop
+L59: rts
+red r2
+L60: .string "ktzvuwevcj"
+not r3
+L61: .data -966, -842, -636, 742, -334
+L62: not L61
+lea L46, L25
+bne L48
+L63: sub r1, r6
+L64: inc L41
+jmp *r7
+L65: lea L33, *r0
+inc r4
+L66: jmp L48
+rts
+prn #-107
+dec L7
+
+L67: .string "d"
+add r2, r0
+jmp *r3
+lea L36, L42
+jmp L61
+red r2
+red r1
+dec *r0
+jsr L51
+L68: .string "svfrwwg"
+mov r5, L33
+bne L54
+L69: rts
+L70: dec *r5
+jmp L4
+; comment
+L71: mov #-75, L42
+add *r4, *r4
+dec L53
+prn L69
+lea L1, L37
+jsr *r4
+lea L52, *r6
+prn #-108
+add L12, L37
+add #-56, L48
+stop
+rts
+sub *r7, *r3
+L72: jsr *r4
+bne *r1
+red r5
+jmp L15
+mov #71, *r6
+clr L19
+L73: .data 170, -483
+bne *r2
+L74: .data 12, 372, -769, 195, 481, -670, -897
+sub r1, *r0
+L75: .data 243, -178, -11, -930, 337, -523
+jsr L47
+L76: dec r6
+cmp r7, r3
+bne L29
+L77: .string "jjenkcran"
+L78: bne *r1
+clr r4
+rts
+rts
+inc L27
+mov L41, *r0
+mov L25, L33
+bne *r3
+rts
+not r3
+L79: .data 221
+L80: .data 225, 123, 458, 374, -600, 391
+not r7
+L81: not *r4
+jsr *r7
+add *r7, r6
+stop
+mov #28, r0
+lea L3, L13
+; comment
+cmp r2, *r0
+jsr L46
+add r3, L76
+dec L39
+L82: .data 37, 746, -206, 897, 483, 94, 733
+mov L63, *r7
+L83: .string "gogmrondbwizgc"
+L84: rts
+dec r5
+add #133, L35
+L85: bne *r4
+L86: bne *r6
+bne L65
+prn *r0
+dec L74
+L87: rts
+L88: lea L48, *r0
+add r4, *r5
+L89: clr L7
+L90: clr r7
+clr *r0
+not *r1
+clr r3
+bne L22
+L91: mov #-37, L49
+lea L88, *r3
+clr *r1
+sub r7, r2
+L92: mov L85, L14
+mov r1, L65
+dec r5
+L93: dec L28
+bne L68
+L94: not r7
+L95: cmp L46, #-240
+dec *r0
+L96: not r0
+sub #245, r6
+mov r0, L90
+L97: .string "vrpvzrxsxxwfcpenofgrzys"
+inc r3
+L98: .data -433, -400, 43, -744, 345, -514
+L99: clr r2
+rts
+
+L100: not *r0
+add #58, r1
+jsr *r7
+sub L86, L11
+cmp *r3, r5
+sub L60, r7
+clr *r4
+L101: red L47
+inc L53
+mov r4, L99
+inc L77
+rts
+jmp *r6
+dec L17
+L102: mov #-108, r5
+clr L21
+jsr *r4
+stop
+L103: rts
+not r2
+
+L104: cmp #-111, #-39
+stop
+lea L27, L91
+jsr *r5
+add *r1, *r0
+stop
+add L66, L7
+L105: sub r5, r0
+mov #-90, L37
+; comment
+jmp *r1
+L106: cmp *r3, r1
+L107: not *r0
+L108: jmp *r3
+red r7
+L109: jsr *r6
+jsr L81
+dec *r5
+dec r0
+L110: clr L87
+L111: clr *r3
+add *r2, *r3
+L112: .string "npxecmrpuuvqoj"
+jsr L16
+bne L109
+L113: .data 101, 228, 169, 639, -999
+L114: mov *r1, r3
+clr r3
+L115: lea L10, r4
+rts
+rts
+L116: dec r6
+clr L71
+L117: sub #-82, r6
+L118: .data 206, 820, -853, 168, 756, -177
+not *r3
+clr L104
+L119: .data 489, 204, -841, -46, -134, 307, -669, 914
+not *r0
+L120: .data 464
+L121: bne *r5
+L122: lea L40, r7
+not r1
+L123: mov r3, L116
+not r5
+lea L102, L44
+not r3
+not *r3
+red L70
+mov r7, r2
+L124: .string "nwvgqumwiood"
+cmp *r5, r7
+mov *r2, r4
+bne L110
+L125: add L1, L48
+jmp L49
+mov r6, *r3
+bne L48
+L126: clr L44
+L127: lea L56, L31
+add r2, *r2
+jmp L40
+L128: lea L113, L57
+L129: not L34
+prn L83
+L130: .data -128, 576
+; comment
+not r3
+clr *r2
+L131: jsr L99
+L132: .string "znmpeffeopd"
+not *r2
+prn L65
+stop
+red r2
+L133: dec L98
+lea L114, *r1
+L134: .string "nyzeowoiubmpaztd"
+L135: prn r3
+L136: jsr L127
+bne *r0
+sub #-191, L59
+L137: prn #47
+L138: stop
+jmp *r4
+red L108
+L139: cmp #-197, *r3
+L140: inc *r0
+bne L20
+inc *r4
+mov r5, L34
+L141: rts
+inc *r1
+L142: cmp L86, r1
+dec *r7
+stop
+cmp *r0, #-191
+; comment
+L143: not r6
+jsr *r1
+L144: .string "jmatatpjeiskttmphdrb"
+L145: jsr *r5
+L146: mov r1, r5
+prn *r5
+not L133
+mov r3, r1
+red L71
+L147: .string "lbyn"
+L148: jsr *r6
+L149: .data -478
+dec *r2
+inc r2
+not r7
+inc r7
+stop
+bne L130
+L150: red r6
+rts
+clr r5
+clr L82
+clr *r6
+L151: clr *r2
+L152: .string "zheyglagoru"
+mov #-74, L12
+clr r5
+jmp *r4
+L153: jmp L120
+rts
+sub L66, *r2
+L154: not r4
+add r5, *r0
+red L119
+red *r2
+L155: mov *r4, *r1
+sub *r5, r3
+jmp *r6
+jsr *r6
+dec L28
+lea L147, *r0
+L156: rts
+rts
+L157: .string "px"
+bne *r7
+mov *r0, L103
+L158: .string "nevpfjlvbojicejfpghog"
+mov L85, r1
+jsr *r3
+inc *r5
+; comment
+L159: jmp *r3
+L160: sub r6, L85
+; comment
+L161: jsr *r4
+L162: prn r1
+; comment
+L163: sub *r4, r0
+rts
+lea L60, L93
+L164: inc r7
+red L9
+bne *r0
+; comment
+L165: rts
+L166: not L68
+L167: red L3
+jmp *r5
+L168: jmp *r1
+rts
+jsr *r5
+add *r2, r3
+rts
+clr r1
+red r4
+mov L124, L57
+not r0
+L169: .data 63, 759, -108
+stop
+L170: rts
+mov #14, r3
+cmp L115, *r5
+L171: jsr L33
+L172: .data 452, -19, -137, -153
+L173: clr r0
+dec L155
+L174: .string "q"
+
+L175: .data 243, -325, 44
+cmp r5, #237
+L176: jmp L83
+L177: .string "xuhrtt"
+L178: cmp *r3, L144
+sub #76, L46
+bne L22
+
+L179: add #-42, *r0
+L180: jsr L149
+L181: prn r5
+mov L88, r7
+clr r1
+clr *r3
+L182: cmp L5, r4
+jmp L170
+L183: clr *r2
+L184: red r1
+bne *r3
+L185: rts
+L186: jsr *r3
+jmp L53
+add L82, r2
+L187: inc *r2
+inc *r5
+add *r1, *r3
+rts
+not r3
+not L31
+stop
+jmp *r5
+jsr L81
+add *r7, r4
+mov r0, *r2
+not r5
+rts
+L188: rts
+L189: bne L0
+clr *r1
+L190: bne L158
+bne L93
+L191: sub #235, *r0
+L192: .string "ihmyndt"
+L193: .data 58
+L194: mov *r4, *r2
+L195: .string "itylboptybvrrcvcnyjitj"
+sub r1, r3
+L196: jmp *r5
+L197: inc L118
+not *r1
+stop
+L198: bne L81
+add L89, r4
+L199: red r6
+prn L42
+not r7
+L200: inc *r6
+L201: .string "xurxtpbpqfq"
+clr L40
+L202: sub L42, *r3
+L203: prn *r5
+mov r7, L116
+jmp *r4
+clr r1
+red L143
+cmp *r2, #21
+cmp #216, *r4
+L204: stop
+prn *r3
+rts
+stop
+inc r1
+rts
+L205: rts
+jmp L116
+rts
+L206: rts
+L207: add r2, r2
+cmp L167, r5
+rts
+L208: mov #143, *r7
+dec r3
+L209: .data -508
+mov r0, *r4
+clr r3
+L210: cmp L20, #114
+L211: lea L53, *r6
+inc L188
+L212: jmp *r0
+jsr *r4
+lea L152, r2
+L213: jmp *r0
+L214: jmp L210
+mov L207, r7
+rts
+L215: mov #93, r1
+dec L175
+L216: sub #88, *r7
+cmp r4, #34
+L217: jsr *r7
+rts
+cmp #93, r4
+clr L23
+
+L218: add *r7, L146
+inc L168
+L219: jsr L10
+L220: jmp *r1
+L221: sub r6, *r1
+bne L179
+clr r1
+; comment
+sub r5, L98
+rts
+jmp *r4
+L222: .data -105
+bne *r5
+L223: clr L142
+inc r5
+add r6, L114
+; comment
+L224: lea L85, r0
+stop
+L225: clr L121
+stop
+L226: jmp *r7
+mov #-135, *r5
+; comment
+lea L60, L111
+L227: .data -355, 587, 691, 665, 329, 880
+L228: mov #8, *r2
+add r7, r0
+bne L148
+dec r1
+sub r6, *r6
+lea L195, L85
+L229: red L108
+rts
+L230: .string "sopdimzshialqqfcqglotqd"
+mov #-217, L28
+jmp *r2
+
+jmp *r0
+inc *r3
+red L185
+prn *r1
+prn L97
+bne L140
+clr r1
+bne L218
+add #-55, r7
+L231: .data -101, 982, -789, 130, -877, -918, 376, -51
+clr L45
+L232: prn L73
+L233: jsr *r7
+L234: clr r5
+lea L11, L75
+cmp L25, r3
+dec L95
+L235: jmp L109
+sub #214, *r6
+stop
+sub r4, r2
+mov *r3, L5
+mov r6, r0
+prn L104
+sub #86, r5
+L236: not L166
+add *r5, L195
+rts
+L237: stop
+lea L40, r2
+L238: not r0
+L239: not *r7
+stop
+L240: .string "sdvrazgbffjvbw"
+bne *r7
+add #-174, r6
+L241: not L119
+mov #-153, L95
+sub #-48, *r4
+lea L136, r5
+clr *r0
+jsr L193
+inc *r2
+L242: jmp *r2
+cmp #-235, #139
+bne *r3
+L243: .data -621
+cmp #72, r0
+cmp L166, r6
+L244: .string "viuhiungffnvtcrzfwjf"
+dec L242
+L245: clr r2
+prn *r6
+rts
+not *r6
+L246: not L58
+dec L13
+stop
+L247: .data 905, -188, -169, -604
+L248: sub #7, L142
+dec *r4
+prn #250
+L249: sub *r7, r7
+L250: dec *r0
+add r7, *r3
+L251: lea L87, L151
+sub r6, *r2
+mov *r2, L98
+not *r4
+L252: .string "ecgxqlgujziyifpzuufz"
+add r7, r1
+not *r6
+clr r2
+red *r5
+jsr *r3
+L253: .data -261, 869, -102, 348, 100, 742, -317
+L254: inc L114
+rts
+red *r7
+add *r4, *r7
+clr L151
+L255: bne *r7
+cmp L63, *r3
+jsr *r6
+cmp L171, *r0
+rts
+L256: add #-153, *r7
+L257: lea L68, *r4
+not r2
+bne L206
+dec L162
+mov r2, L1
+L258: jmp L99
+L259: add r5, *r0
+L260: inc r1
+cmp #-154, *r5
+L261: inc *r4
+L262: inc r5
+red r6
+L263: jmp *r1
+cmp *r2, L145
+mov #-37, L185
+rts
+not L149
+dec r0
+L264: .string "hdqwtjmxaoaljmcwamhmcdf"
+prn L130
+jmp *r7
+bne L121
+L265: clr *r3
+L266: not *r6
+bne *r6
+rts
+cmp #180, *r1
+rts
+stop
+dec L74
+dec *r6
+dec L52
+dec L118
+L267: cmp r5, *r2
+stop
+bne L222
+prn *r2
+inc L20
+add #169, L4
+inc r7
+sub *r0, L20
+sub L159, L258
+jmp *r5
+rts
+L268: jsr *r7
+inc *r5
+stop
+jmp L34
+inc L6
+inc L35
+jmp L31
+jsr *r2
+dec r6
+L269: .string "mrdiwh"
+cmp r3, L216
+
+add #170, r3
+L270: jmp *r7
+
+cmp r5, r3
+L271: cmp r5, *r4
+L272: cmp L107, *r4
+stop
+cmp L188, r4
+jsr L222
+L273: .data -202, -214, 114, -825, -802
+L274: bne L33
+L275: add *r4, *r2
+prn L6
+red *r4
+rts
+L276: .data 334, -522, 138, -779
+stop
+L277: stop
+clr r7
+L278: .data 616, -511
+add #-10, L137
+clr L127
+L279: stop
+L280: not L80
+
+L281: jmp L51
+L282: sub L232, r4
+dec r1
+mov #59, L178
+not *r0
+inc r7
+L283: sub *r2, *r4
+jmp *r1
+red *r0
+mov #160, L189
+; comment
+inc *r4
+L284: stop
+L285: mov r6, r3
+sub r3, *r4
+sub #-18, r4
+L286: .string "i"
+L287: .data -173, -919, 910, -996, -2, -379, 733
+rts
+stop
+jsr L62
+prn *r0
+jmp L226
+; comment
+L288: add *r7, L64
+L289: prn *r6
+L290: .string "hkzfkiijxjkq"
+not r1
+jsr *r0
+mov L141, *r4
+mov r5, *r0
+prn r7
+bne *r3
+cmp r6, *r7
+bne L154
+jsr *r7
+jsr L30
+rts
+add *r2, L136
+L291: rts
+L292: .string "ddwvoifvbtn"
+add #-60, L181
+rts
+L293: rts
+L294: prn *r1
+bne *r4
+inc *r0
+dec r1
+jsr *r1
+cmp *r4, r6
+add L280, r7
+sub *r7, r0
+red L5
+rts
+L295: sub L84, *r5
+L296: add *r3, r0
+L297: jsr *r5
+dec L9
+L298: rts
+L299: .data -203, -939, -315, -246
+inc r4
+L300: .string "nbtjcfrcjia"
+sub r6, L281
+jsr L49
+red r3
+inc r1
+inc *r3
+inc r1
+sub *r6, L279
+L301: dec L158
+; comment
+jsr *r0
+L302: clr *r4
+inc r5
+L303: stop
+L304: red L294
+cmp r2, #-221
+cmp *r2, *r7
+jmp *r0
+cmp *r7, r4
+cmp r6, *r3
+L305: .string "skefpved"
+L306: cmp #198, L23
+L307: cmp r5, r3
+L308: jsr *r4
+
+rts
+cmp L266, *r3
+L309: not *r0
+clr L300
+
+clr *r4
+L310: prn r5
+stop
+not r6
+prn L39
+dec L110
+clr r1
+L311: .data -875, 50, -669, 815, 63, -809, 47
+L312: not r4
+cmp r0, #-10
+L313: .string "ltccezc"
+L314: jsr *r1
+jsr *r0
+rts
+L315: .string "pkluyrcsxostpkb"
+clr *r0
+dec *r0
+L316: lea L125, L222
+L317: .string "aofntyflyiycxeypbmofzssx"
+L318: bne L105
+lea L172, L95
+L319: add r6, *r7
+L320: rts
+L321: inc *r4
+stop
+L322: clr *r0
+add *r7, L258
+L323: inc *r3
+L324: dec *r5
+prn *r6
+not L22
+rts
+prn L6
+jsr *r1
+L325: not r0
+mov *r3, r6
+rts
+L326: dec r7
+prn #216
+stop
+clr r2
+not r6
+L327: jmp *r2
+red L283
+L328: clr *r3
+L329: dec L152
+lea L196, r1
+add L257, L55
+sub r3, r0
+rts
+add r6, r0
+L330: lea L113, r0
+inc L260
+L331: dec *r2
+prn r4
+lea L140, L20
+L332: dec *r0
+not L9
+L333: red *r6
+L334: sub L124, r0
+L335: .string "bbfsshhc"
+L336: stop
+rts
+rts
+inc L157
+rts
+jsr L298
+L337: .data 436, -66, -780, -926, 487, 253, -573
+mov L328, r0
+jmp L262
+L338: rts
+stop
@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 34
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+sub *r0, L203
+
+L0: inc r6
+L1: add #212, *r5
+clr *r6
+L2: add r0, r2
+L3: .string "yvukptojsgncch"
+not r6
+add #149, *r7
+jsr L2
+L4: .string "rx"
+; comment
+jsr L4
+L5: .string "aoqvst"
+L6: .data 836, 684
+jsr *r1
+L7: .string "grrhkbb"
+bne L6
+jmp L5
+rts
+sub r2, *r5
+sub r2, *r3
+L8: rts
+jmp *r1
+not *r1
+L9: .data -614, -26, 319, 235, -706
+L10: .string "idaprxegoirqfyrnqecvgpf"
+L11: red L4
+sub L11, *r6
+lea L5, *r6
+inc L7
+rts
+red *r7
+L12: sub #-246, L0
+mov L1, L11
+L13: not r2
+L14: mov r0, L9
+lea L5, *r2
+jsr L9
+; comment
+jsr L13
+L15: jmp L5
+inc *r0
+rts
+L16: jsr L16
+L17: .string "emargmhypswoytb"
+stop
+bne *r3
+L18: mov L8, *r5
+L19: .data 959, -358, -94
+L20: inc *r1
+add #-60, r4
+cmp r7, r4
+stop
+L21: clr L4
+sub #-5, *r7
+prn r6
+jsr L16
+L22: jmp L1
+L23: .string "kudmqjcrxvaduayuf"
+L24: add L2, L16
+not L6
+sub L4, L9
+dec r5
+L25: inc L7
+red r5
+L26: clr *r6
+L27: lea L26, L23
+clr L20
+jmp L6
+dec L5
+L28: not L10
+lea L28, r5
+mov *r3, r0
+stop
+prn *r5
+dec *r7
+mov *r2, *r1
+
+inc r6
+prn r4
+red *r1
+L29: .string "pgdcsjepuikfxqez"
+not r3
+clr r2
+cmp r0, #-42
+L30: stop
+add L5, L29
+jmp L26
+red r5
+rts
+clr L1
+not *r3
+L31: .string "sxrupkho"
+rts
+L32: .data -707, 934, -53, 818, -714, -277, 587, -788
+inc r2
+sub r7, r6
+cmp L13, *r0
+prn *r1
+inc *r3
+not *r0
+bne L29
+clr r7
+L33: .string "umjlkowycvlbykluwmgesbbm"
+L34: .data -938, -622, 603, -164, 103
+L35: .data 103, 186, -332, -935, -909, 15, 873, -917
+jsr *r6
+not L33
+sub #16, L18
+L36: .data -943, 62, -197
+L37: .string "lbg"
+dec *r2
+inc *r3
+bne L3
+cmp *r3, L17
+rts
+dec *r6
+not L23
+cmp L22, *r0
+L38: jmp L4
+L39: clr *r0
+not L2
+jsr L15
+rts
+rts
+L40: rts
+red *r5
+stop
+L41: inc L38
+red *r1
+lea L18, r6
+L42: cmp r1, #-100
+dec r2
+cmp *r5, *r7
+L43: jsr L31
+red L26
+L44: jmp *r2
+clr *r6
+jmp L1
+cmp r0, L2
+inc L0
+sub L44, *r0
+add r1, r6
+stop
+cmp L37, L35
+jmp L28
+add r3, r2
+; comment
+red r4
+not r5
+L45: .data -570, -327, -268, -911, 229
+L46: red r1
+L47: .string "mzwkrgtbmcixazlheak"
+
+red r1
+
+L48: rts
+clr r2
+rts
+stop
+L49: .data -685, -546, 446, 585, 663, -588, -350, -46
+L50: .data 712, -262, 594
+jmp L33
+clr L9
+cmp #203, #-238
+bne *r7
+jsr *r3
+L51: sub r2, r0
+L52: stop
+L53: .data -766
+L54: sub *r7, L30
+L55: prn #-156
+prn L27
+stop
+inc r5
+L56: .string "mgcjl"
+L57: .string "yibeqef"
+L58: .data -970, -671, 110, -268, 485, 702
+bne L14
+L59: .string "taciseuhxwdl"
+L60: add #223, L8
+L61: cmp *r6, r2
+bne *r0
+L62: .data -843, 532, -990
+L63: red *r4
+L64: mov #154, *r0
+rts
+not L13
+L65: .string "idoogmoebo"
+bne *r1
+jsr *r0
+dec *r7
+L66: .data 518, 349, -629, -6, -372, -991, -245
+not r2
+L67: dec L9
+cmp *r3, *r2
+jsr L4
+L68: lea L62, r7
+not r7
+not *r3
+L69: lea L34, *r3
+L70: .data -243, 862, -676, 630
+sub #115, r4
+stop
+rts
+L71: jmp *r7
+rts
+inc *r0
+dec *r1
+L72: add *r5, L43
+jmp L9
+dec r2
+L73: rts
+mov #-218, *r7
+jmp *r7
+jmp *r5
+clr r2
+jmp L45
+stop
+red *r6
+sub #62, L21
+lea L44, *r7
+L74: .string "qkvufunyfu"
+mov #-224, *r4
+L75: add #33, L52
+inc L6
+stop
+red r3
+L76: add L71, r4
+dec L61
+L77: not *r5
+lea L9, r1
+L78: .string "ajymcamftkokcclgwjdr"
+red r5
+
+add r5, L78
+L79: bne *r4
+clr *r2
+add r0, *r5
+red L40
+L80: .string "zcwr"
+mov L9, *r7
+prn *r7
+stop
+jsr L47
+L81: .string "zxr"
+stop
+L82: cmp #234, *r5
+inc L76
+L83: dec L61
+dec r2
+red *r1
+inc *r7
+jsr *r2
+dec r1
+L84: .data 870, 198, -76, -676, -546, -675
+stop
+rts
+cmp #69, *r1
+L85: dec r7
+L86: bne L8
+inc L69
+rts
+
+lea L2, L40
+jsr *r5
+L87: not *r7
+L88: bne L61
+red r3
+mov L62, *r5
+bne L60
+not *r7
+sub #153, L47
+jmp L51
+add r6, L27
+L89: jsr *r2
+sub r5, L46
+L90: cmp r6, L68
+L91: inc *r4
+jsr *r7
+L92: .data -693, 672, 361, 909, -452, 826
+L93: mov L42, *r1
+jsr L41
+dec *r6
+inc *r1
+L94: rts
+L95: mov L77, L40
+L96: .data 741, -177, -721, 3, 283, 449, -770, 961
+L97: inc r6
+jsr *r4
+L98: sub L25, L33
+lea L53, *r6
+cmp L96, r6
+bne L51
+dec L31
+L99: .data 837, -276, -353, -576, -898, -508, 309, -498
+; comment
+L100: sub #42, L73
+add L85, L82
+jmp *r3
+L101: red r4
+clr r3
+L102: sub #150, *r6
+L103: .string "drauhhjuwdvwigefzt"
+jsr *r3
+rts
+jsr L71
+cmp *r6, L71
+; comment
+L104: .data 450, 55, 635, -750
+cmp L30, #-160
+bne L2
+rts
+L105: jsr *r7
+dec *r0
+jsr L64
+inc L31
+L106: mov #-44, L26
+prn #188
+L107: .string "abwbshg"
+L108: not L104
+mov *r7, *r0
+not L108
+lea L92, *r7
+bne *r1
+mov #173, L17
+stop
+clr r6
+prn r6
+dec r5
+dec L108
+prn L79
+L109: .string "zwbrpsdonbcm"
+prn *r6
+bne L29
+L110: clr *r5
+jsr *r2
+inc *r5
+L111: inc r0
+L112: stop
+
+L113: bne *r1
+L114: .string "ddooeyuhtayqjrn"
+L115: .string "cpyqwunlywpqts"
+L116: sub L11, L28
+; comment
+jmp *r7
+jsr *r2
+cmp #-130, #-29
+lea L100, *r4
+L117: not r3
+L118: bne L98
+sub *r6, r2
+clr r5
+rts
+
+mov r5, L3
+not L108
+prn #-69
+rts
+add L70, r5
+L119: jsr L81
+L120: .string "ykhbqfsnzdvzboptapree"
+L121: .data -774, 215, 670, 572, 47, -714, -766
+prn r4
+red r7
+mov #149, *r0
+L122: .data 101, -258, -298
+inc L110
+lea L46, r5
+inc r4
+mov #201, *r6
+rts
+L123: dec r5
+L124: jsr L104
+
+L125: dec r5
+dec r5
+not L50
+L126: stop
+L127: .data 218
+L128: jmp *r1
+L129: jsr L59
+jmp L58
+sub r1, L97
+jmp *r2
+cmp L112, *r5
+L130: clr r3
+clr r7
+stop
+jsr L15
+not L122
+sub L109, *r4
+mov L62, *r6
+cmp *r2, L107
+
+L131: mov *r0, L107
+L132: red L91
+L133: mov *r6, r4
+add #24, *r6
+L134: stop
+inc r6
+L135: .string "biwagqcuvzviduro"
+L136: jsr *r1
+L137: .string "oudupwsuvxelzmmtju"
+L138: add *r5, r2
+lea L47, *r5
+sub r6, L27
+sub r3, L50
+L139: .string "pmppuxa"
+L140: not r3
+dec r6
+inc r0
+stop
+clr L92
+red L86
+cmp L30, *r7
+rts
+prn #-107
+L141: .data 17, -485, 238, 228
+L142: stop
+L143: mov #160, L114
+L144: .string "oowxaaurnghprkogezuxwgnn"
+inc L58
+inc r1
+bne L46
+bne *r1
+lea L35, *r2
+red r6
+jmp L95
+jsr *r7
+dec L91
+prn *r0
+cmp *r3, #166
+inc L74
+stop
+prn #-196
+rts
+lea L133, r6
+
+
+L145: mov L67, *r2
+L146: sub #87, *r7
+L147: cmp #-236, r5
+stop
+jmp *r6
+L148: clr *r1
+sub r5, L141
+bne *r1
+dec L80
+lea L48, r2
+L149: not r4
+L150: rts
+L151: lea L67, *r5
+L152: .string "anamhuzpogurrkhimipohs"
+
+mov r7, *r7
+rts
+L153: not r4
+not *r4
+prn *r4
+L154: clr *r2
+L155: .data 588, 834, 289, 722
+cmp r6, r5
+dec r6
+L156: add r4, L154
+lea L143, r2
+lea L67, r4
+red *r1
+stop
+jmp L4
+add *r6, r5
+sub #7, *r0
+L157: add *r1, *r5
+bne *r0
+cmp #-126, L40
+L158: inc *r6
+rts
+jsr L111
+stop
+stop
+inc L140
+stop
+clr r4
+L159: .data 418, 503, -426, 983, 84, -866, 451, 136
+cmp #-93, #-103
+sub #9, L15
+add L81, r5
+jmp L148
+L160: inc L74
+jsr L72
+sub *r6, L126
+
+clr L91
+jsr L125
+bne L54
+L161: lea L18, *r4
+L162: inc *r3
+L163: jmp L64
+sub #78, L122
+L164: jmp L94
+mov #-89, r6
+red r5
+L165: prn L136
+L166: dec *r5
+prn r6
+lea L60, *r3
+mov #6, r4
+jsr L36
+clr r6
+L167: .data -837, 728, -678, -41, 284
+cmp *r1, L15
+sub #-11, *r0
+L168: prn *r1
+L169: prn L86
+lea L113, r6
+L170: mov *r0, *r4
+clr L81
+jsr L29
+add L35, r6
+red L91
+mov L8, r2
+inc *r5
+L171: lea L91, r4
+clr r7
+not r3
+clr r1
+L172: .string "nmrjmjnlglxjbjajdfhtm"
+L173: clr *r7
+L174: inc L166
+dec *r0
+; comment
+rts
+bne L118
+not *r5
+sub L13, *r6
+L175: jsr *r1
+dec *r0
+L176: prn L116
+prn L79
+add *r0, L71
+L177: prn #-200
+L178: prn r6
+not L80
+L179: not L66
+L180: red *r7
+sub #-61, r3
+add L156, *r4
+L181: dec *r5
+dec L94
+sub *r6, L83
+L182: jmp *r7
+not *r3
+L183: .data 985, -53, 584, -114, -640, 755
+L184: not L89
+add r1, r7
+; comment
+L185: jsr *r5
+prn *r2
+inc *r7
+L186: clr *r4
+L187: clr *r6
+bne *r5
+dec r4
+L188: .string "ybxapspjybfemufw"
+jsr L74
+jsr *r3
+jmp L15
+rts
+L189: .data 143, 207, 194, -408, -488
+L190: lea L26, r2
+clr *r6
+sub r0, r7
+cmp #199, #-143
+L191: jmp *r6
+L192: add *r0, *r2
+
+L193: lea L168, r3
+mov #125, L29
+L194: jsr *r6
+inc *r3
+L195: dec r5
+inc L9
+cmp #223, *r7
+L196: inc r5
+sub r6, *r1
+add L106, *r6
+rts
+not r1
+inc L70
+red r3
+lea L44, L128
+L197: lea L163, L158
+clr *r7
+dec *r7
+red *r0
+L198: prn *r0
+L199: .data -434
+L200: .data 180, -289
+rts
+inc r2
+jmp *r6
+sub r1, *r5
+mov *r4, L71
+L201: stop
+bne *r2
+mov L173, *r5
+bne *r5
+mov *r0, r4
+L202: not r3
+dec *r7
+jsr *r6
+L203: bne *r5
+mov r6, *r4
+L204: mov L138, L99
+rts
+not *r2
+jsr *r2
+L205: prn #-121
+not r1
+add L107, *r1
+L206: cmp r0, #113
+L207: rts
+inc r5
+cmp L168, #-238
+L208: jsr L17
+not L84
+red r0
+stop
+not L95
+L209: mov *r3, L127
+not r6
+clr L12
+; comment
+L210: .string "ucilfytpbfhynyaxjlmkdy"
+bne L189
+L211: cmp r2, #-79
+cmp r1, #-9
+L212: add #-196, L20
+sub *r1, *r7
+stop
+sub r2, *r2
+L213: .string "aahgjkcjanjfoqankliesqqm"
+rts
+L214: .string "mcbjkrvxyybhjgktd"
+add *r4, L100
+L215: .data 779, -514, -414, -208, 286, 590, 974, 256
+L216: sub r5, L108
+cmp r7, *r6
+L217: not L212
+; comment
+lea L41, r1
+sub r3, L159
+red *r1
+L218: rts
+L219: jmp *r0
+lea L73, L194
+rts
+cmp #57, *r6
+bne L104
+stop
+dec L193
+red L181
+mov L60, r2
+L220: red L71
+L221: lea L205, r6
+rts
+L222: not *r1
+jmp L8
+dec L170
+jmp *r0
+L223: .string "uqzfjlixaghj"
+prn #-24
+inc *r0
+mov *r2, *r3
+jsr L203
+dec r3
+L224: mov #-250, *r7
+bne L95
+L225: jmp *r6
+L226: clr r6
+inc *r5
+not *r5
+L227: prn #29
+L228: .string "tisckawrcewmccfwaghjpi"
+L229: bne *r7
+L230: cmp r1, r5
+jmp *r1
+L231: .data -880, -847, 553, 964, 430, -275, -712, 460
+L232: dec L160
+lea L181, *r6
+L233: bne *r2
+not L156
+jmp *r4
+rts
+L234: red *r1
+jsr L5
+; comment
+lea L137, L139
+L235: lea L24, *r1
+jmp *r1
+inc r2
+rts
+stop
+mov L57, r1
+lea L160, r7
+; comment
+jmp *r4
+inc r3
+L236: rts
+bne L222
+L237: .data 573, -243, 806, 905, 627, -34
+cmp #-67, #8
+jsr L23
+red *r1
+cmp L108, r3
+L238: clr r1
+clr L14
+L239: .string "zsii"
+L240: prn L139
+not L235
+lea L118, r7
+bne L229
+add *r2, r2
+L241: not *r0
+L242: cmp L217, L36
+L243: not *r5
+inc *r1
+jmp L103
+lea L61, L150
+L244: add #37, *r5
+L245: add #94, L177
+L246: jsr L107
+jmp *r0
+L247: not r0
+mov L224, *r4
+jmp *r6
+
+inc L194
+; comment
+L248: .string "otxcumuybljxhqilzrhb"
+dec L238
+prn L14
+L249: lea L170, L155
+L250: .data -136, -327, 122, 875
+L251: bne L125
+L252: prn *r0
+L253: sub *r1, *r2
+not r2
+L254: add *r4, L161
+add #127, L177
+clr r4
+jsr *r5
+dec *r1
+L255: .string "zkyqxzpauoobqlsfeejpb"
+red *r7
+dec *r5
+L256: .data 655, -401, 775, 855, -70, 622, -645, 432
+L257: mov *r1, *r2
+jsr *r0
+dec *r0
+stop
+jsr *r5
+L258: add L228, r7
+mov #32, r0
+red L107
+stop
+L259: .string "qvcewfftknytvmljxavl"
+sub #-44, L96
+L260: stop
+red r4
+prn r7
+L261: jsr *r7
+L262: .data 443, 164
+rts
+L263: not r5
+red L236
+jsr *r4
+L264: not r2
+lea L92, L98
+mov #-34, *r4
+bne *r7
+jsr L184
+sub L152, *r3
+stop
+mov *r5, L11
+lea L193, L111
+L265: clr L111
+L266: .string "b"
+stop
+stop
+L267: lea L84, *r0
+mov #-170, r4
+lea L244, L42
+clr r7
+not r7
+jsr L26
+not L90
+rts
+red *r4
+L268: prn #-132
+L269: jsr *r1
+bne L70
+lea L115, L100
+L270: .string "byjbfrqimcdtsacnd"
+L271: .data -565, 604, -66, 541
+mov L45, r0
+L272: bne *r5
+; comment
+L273: add #115, *r2
+jsr L145
+mov *r7, r1
+clr L21
+L274: sub r7, *r1
+L275: bne *r1
+L276: .data -361
+jmp L127
+lea L139, *r7
+L277: dec *r3
+L278: add L27, r0
+L279: mov #-183, *r2
+L280: jmp L54
+; comment
+; comment
+jmp *r0
+clr L25
+stop
+L281: bne L176
+L282: .data 523, 45, 912
+add L127, L167
+dec *r4
+
+L283: red *r2
+prn r7
+dec L273
+stop
+red L45
+mov #-46, r2
+dec *r3
+sub L74, *r6
+inc L117
+L284: .data 309, -118, 423, 959, -519, 89, -836
+L285: .data 601, 922, 451, 757
+L286: inc *r7
+cmp *r0, L256
+L287: .string "jiaexfkefhyhjsgepwjumt"
+L288: .data 786, -852
+jmp *r3
+lea L177, r6
+dec r7
+jmp L109
+bne L234
+red L40
+L289: jsr L28
+L290: stop
+L291: red L272
+rts
+L292: not r7
+L293: mov *r0, *r3
+L294: stop
+L295: rts
+not *r7
+prn r6
+bne L258
+sub L77, r2
+L296: cmp r6, L95
+inc L30
+L297: red L285
+inc L178
+stop
+cmp #-84, r1
+clr r5
+stop
+not *r4
+sub #140, L203
+clr r6
+add #-228, r0
+
+L298: add r2, r0
+L299: stop
+mov L295, r4
+
+jmp L28
+dec L297
+L300: inc r3
+clr L132
+jmp *r5
+jmp L290
+L301: jsr L59
+L302: jmp *r4
+L303: .string "yqnhxdljjwmown"
+L304: inc *r5
+clr r1
+L305: .data -824, 98, 865, -239, -411, -271
+L306: .data -833
+rts
+L307: jmp L266
+L308: red r5
+cmp L47, r0
+L309: .string "ogzkfbmfwxsmvigczcdhoovk"
+clr L13
+dec *r5
+clr L252
+L310: .data -327
+prn #-98
+add *r7, r3
+stop
+L311: not *r2
+red *r1
+jsr L145
+red r0
+L312: .data -485, -696
+stop
+prn L162
+jmp *r7
+L313: mov L29, *r4
+not r2
+jsr L123
+clr r4
+L314: bne L96
+L315: .data -652, -269, -90, -374, -750, -104, 555, 353
+; comment
+add #89, *r2
+L316: .string "b"
+inc *r3
+bne L303
+L317: clr *r7
+rts
+L318: .data -818, 342, -349
+L319: cmp *r4, r7
+inc r1
+L320: .string "lrejg"
+; comment
+L321: clr r3
+L322: red *r0
+bne L240
+sub #-15, L27
+L323: clr *r4
+sub r6, L244
+dec *r0
+jsr L11
+L324: bne L178
+lea L212, L242
+lea L293, L60
+clr L133
+mov r5, *r5
+L325: red L71
+L326: .data 900, -206, -277, 36
+
+cmp *r2, L326
+stop
+cmp *r0, L195
+L327: .string "bvmqobitgemiwfw"
+dec r2
+not L78
+stop
+L328: mov r0, r2
+jsr L76
+L329: lea L18, r4
+clr L309
+jsr L95
+inc L162
+stop
+clr *r0
+L330: prn r1
+L331: add r4, r6
+red L86
+red *r6
+L332: not L71
+L333: .data -557, -137, -272, 451, -400, 270, -445, 262
+L334: not L308
+bne L302
+jsr *r4
+; comment
+L335: jmp L210
+red r3
+rts
+mov #-233, *r7
+L336: bne L261
+clr r1
+not r7
+L337: lea L174, r0
+
+jmp L39
+jsr *r5
+
+mov L34, *r5
+inc r6
+dec L310
+cmp #36, r6
+L338: lea L136, *r0
+stop
+L339: .data -63, -463, -621, 888, -495
+bne L153
+; comment
+rts
+L340: bne *r2
+dec r2
+L341: cmp *r2, #41
+stop
@@ -0,0 +1,1023 @@
+; Generated by genCorpus --seed 35
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: mov r0, L0
+L1: .string "dygbmx"
+red L0
+not L1
+L2: .data -399, -58, 80
+cmp #129, *r5
+inc L1
+jmp *r7
+L3: jsr L3
+clr *r1
+red *r7
+prn *r5
+jmp *r1
+inc *r1
+dec *r2
+L4: add #-137, r3
+dec *r4
+lea L4, L1
+bne L4
+L5: add #-45, L4
+lea L0, r0
+rts
+L6: sub *r4, L0
+clr r3
+mov *r3, r0
+L7: clr r2
+mov *r2, *r4
+L8: dec *r3
+rts
+cmp L8, *r7
+add *r4, L0
+sub *r5, *r6
+L9: not L5
+prn r7
+clr *r6
+sub r7, r3
+rts
+L10: .data -862
+L11: prn r0
+lea L1, L0
+inc r7
+; comment
+prn L8
+
+sub L5, r3
+jmp *r6
+L12: red *r0
+bne *r3
+L13: lea L5, r7
+L14: mov #200, L5
+lea L10, L1
+jmp *r4
+L15: jmp *r7
+L16: red L3
+red *r7
+
+bne *r7
+; comment
+; comment
+
+prn *r5
+sub #104, L13
+; comment
+add r4, L0
+inc r5
+L17: stop
+red *r4
+red L6
+inc L13
+L18: bne *r1
+add #-116, r4
+jmp *r1
+L19: red *r0
+lea L18, *r1
+stop
+L20: .string "nmigpvlt"
+L21: bne L1
+L22: jsr L11
+stop
+bne *r2
+L23: cmp *r2, #69
+L24: .string "tyguianjucdcyavwqddi"
+; comment
+sub r5, *r3
+not L8
+prn #-146
+L25: clr L6
+L26: dec *r3
+jmp L5
+add r2, r4
+sub *r3, L22
+clr r4
+jmp L26
+add *r4, r2
+L27: prn *r0
+jmp *r0
+red L9
+add *r3, r0
+prn L9
+sub r4, *r0
+L28: red L27
+; comment
+L29: lea L6, r6
+sub *r7, *r1
+inc r6
+cmp *r0, L20
+L30: stop
+sub L16, r0
+bne *r5
+L31: rts
+; comment
+rts
+L32: mov L14, r2
+clr L21
+L33: .string "qgxaogbzitidcbtdja"
+mov #-217, *r4
+clr r4
+L34: .data 27, 27, 797, -571, -12, -577, -618, -701
+rts
+clr L17
+add r2, *r4
+L35: .data -150, -797
+red r1
+dec *r4
+L36: lea L25, L34
+add L26, r2
+stop
+L37: rts
+jmp L3
+mov #-206, L21
+jmp L12
+dec r4
+not r7
+inc r2
+L38: bne *r3
+bne L38
+add r6, L13
+L39: stop
+rts
+bne *r3
+prn L10
+L40: .data 205, -708, 256, -36, -858, -134, 235, -767
+bne L0
+L41: dec *r5
+prn *r1
+L42: lea L24, r1
+rts
+rts
+jsr L40
+red r0
+rts
+bne *r0
+jsr L40
+stop
+inc r3
+bne L35
+inc L27
+L43: .string "cwgpfaswkqazk"
+L44: .string "ifbomq"
+L45: .string "dizsfvzvpbbmhfdqkm"
+jmp *r2
+jmp *r0
+sub L22, *r2
+jsr *r3
+lea L45, L10
+mov #67, L22
+L46: red r7
+
+sub *r1, r4
+rts
+dec L11
+L47: add *r1, *r6
+lea L25, L36
+L48: prn L31
+lea L40, L4
+prn #224
+sub r4, r3
+not r5
+dec r5
+stop
+L49: dec *r6
+bne *r5
+red *r2
+jsr *r5
+rts
+L50: .data -217, -565, -200
+rts
+L51: .data 709, 732, -42, 363
+red r7
+red *r6
+lea L6, L42
+L52: .string "fzjdlvoi"
+L53: .data 653, 847
+rts
+inc r7
+jmp *r1
+inc r4
+L54: rts
+L55: rts
+lea L2, r1
+stop
+L56: jmp *r2
+add *r0, L54
+stop
+red r5
+jmp *r6
+dec r2
+bne *r5
+; comment
+L57: jmp L42
+lea L6, *r1
+jsr *r1
+L58: rts
+dec *r5
+L59: not L59
+L60: .data -583
+L61: not *r1
+L62: bne *r7
+inc r1
+
+rts
+inc *r0
+red L53
+L63: rts
+dec *r7
+L64: mov r6, r4
+red L61
+inc L61
+prn #87
+dec *r6
+clr r7
+
+rts
+L65: not r7
+sub L13, *r0
+bne L61
+lea L62, *r4
+rts
+L66: clr L2
+L67: lea L43, L0
+clr *r5
+L68: sub *r6, r1
+rts
+inc r3
+L69: .data 84, 429
+L70: stop
+L71: clr r5
+prn #29
+red *r0
+add L37, r0
+clr L54
+L72: clr r6
+inc r2
+L73: red L5
+lea L72, r1
+L74: not *r2
+L75: bne *r3
+L76: .data -780, -478, 486, -93, -90, 293
+prn *r0
+red L76
+rts
+; comment
+inc L9
+sub r1, L4
+mov L5, L7
+
+lea L37, r4
+not *r5
+L77: not r7
+L78: .data 816, 946, 668, -27, -356, -223, 886
+cmp *r5, #110
+lea L38, L32
+L79: lea L73, r7
+cmp L75, *r2
+rts
+not r5
+L80: cmp #175, r6
+lea L68, r0
+add r4, L31
+L81: add r5, L40
+stop
+sub #-140, r4
+mov r4, r1
+L82: sub r3, *r6
+L83: not r3
+L84: jsr L39
+L85: .data -215, 62, -289, -637, 375, -911, 234
+stop
+L86: .string "rrwt"
+rts
+L87: .data 357, 673, 745
+L88: .string "hbzosohgbqoyhuefr"
+clr r6
+jmp *r6
+L89: add #67, r5
+clr r5
+rts
+prn L26
+L90: .data 821, -177, 625, 316, -413, 369, 799
+not L86
+dec *r6
+L91: .data 549, 501, -215, -903
+L92: .data 364, 120, 979, 164
+L93: inc *r3
+cmp #180, r2
+add *r3, *r0
+dec L66
+inc L19
+lea L83, L12
+L94: prn #29
+prn r0
+
+mov r2, r1
+L95: jmp L88
+L96: sub r5, r0
+jsr L87
+L97: rts
+sub L77, r4
+add L76, r6
+L98: .string "xrpvtiheqic"
+L99: .string "racxswbtr"
+dec *r0
+cmp #-162, *r1
+L100: jmp L54
+red r5
+clr *r4
+L101: .string "lxjymsqbbyffksf"
+sub #188, r2
+sub #-85, r1
+L102: .data -737, -683, -778, -583, -472
+L103: red r4
+L104: jsr L83
+bne *r7
+not r5
+; comment
+L105: clr *r4
+L106: not *r7
+sub L86, r2
+mov r1, L33
+red r1
+prn r0
+stop
+stop
+cmp r0, r1
+L107: lea L1, L91
+rts
+
+red L52
+L108: sub r2, *r5
+jmp L89
+clr r5
+not r4
+jmp L24
+
+L109: add *r5, r4
+L110: cmp #-128, #11
+lea L97, L69
+
+add r5, *r5
+L111: .string "bzdpvbjaunnnxmsdu"
+inc r1
+L112: .data 580, 900, 270
+add L47, r1
+add r1, L64
+rts
+cmp *r7, #-214
+jmp *r1
+red *r5
+jmp L62
+L113: cmp *r5, *r1
+sub L108, *r5
+L114: bne L85
+not r4
+L115: add r2, L15
+L116: cmp #5, L43
+stop
+L117: bne L5
+inc L39
+cmp *r6, L96
+red *r3
+mov *r0, *r3
+L118: lea L17, *r6
+jsr *r6
+jsr *r1
+not *r0
+stop
+jmp *r4
+not *r1
+lea L33, L37
+add #33, r5
+clr L84
+L119: .data -963, -537, 32, 484, 19, -188, -756, 11
+stop
+inc L1
+L120: jmp *r7
+bne *r0
+cmp r2, *r3
+L121: .data -582, -654, 977
+L122: .data -283, 905, -390, 709, -342
+L123: lea L88, r6
+L124: .data -870
+L125: .string "hhhwnhtdlukiq"
+L126: rts
+clr L73
+lea L109, *r7
+L127: inc r3
+clr *r5
+red r5
+mov *r1, *r3
+not L16
+inc L115
+jsr *r5
+clr r2
+L128: prn L113
+dec *r3
+add *r1, *r4
+inc L79
+
+lea L71, *r1
+sub L67, r0
+not L43
+cmp r1, #-32
+; comment
+rts
+L129: cmp r1, *r2
+lea L56, L124
+not r6
+L130: red r4
+L131: add #-217, *r5
+L132: add *r1, *r0
+L133: prn #-76
+jmp *r0
+L134: inc r6
+L135: bne *r0
+jsr *r5
+L136: .string "lkaplgwsd"
+L137: dec *r3
+L138: clr r2
+bne L79
+sub L121, L38
+L139: cmp r7, #-36
+L140: jmp *r5
+lea L79, r0
+L141: .string "vxfidnefbwxadrl"
+L142: red L122
+L143: sub r5, *r6
+sub *r7, L89
+dec L128
+clr r4
+L144: not L141
+L145: .string "jjocblhjdsetsspduyierf"
+L146: not *r3
+L147: red r2
+lea L121, r5
+stop
+not r6
+L148: lea L134, r3
+; comment
+L149: lea L76, r4
+L150: .data -505, -663
+add #-153, L84
+L151: .data -799, -461, -159, -345, -288, -168
+clr *r4
+bne *r0
+L152: inc L77
+L153: red L119
+not r3
+bne L151
+lea L37, r0
+cmp #-211, *r7
+red *r7
+L154: sub *r7, r1
+bne L117
+L155: cmp r0, r5
+L156: .data 884, 240, 219, -179, -626, 64, 6, 414
+lea L0, r0
+L157: stop
+
+red r3
+L158: .string "ijlvkvjgld"
+add L82, L11
+L159: .string "citbiqfpmslnpabfjq"
+add r7, L87
+sub #-249, L154
+L160: not r0
+mov *r1, *r0
+prn *r2
+L161: .data 910, -914
+jsr *r0
+rts
+L162: .string "bfpzepiur"
+inc L149
+not r2
+L163: clr L52
+mov *r1, r3
+L164: rts
+jsr L115
+L165: red L90
+mov *r7, *r3
+L166: lea L76, *r0
+L167: jmp *r4
+L168: mov L4, L23
+red *r1
+L169: bne L47
+sub *r2, r3
+add *r6, *r5
+L170: sub #-16, r0
+add *r3, r1
+; comment
+jmp *r2
+sub r7, *r2
+bne *r1
+jsr L119
+mov #143, L68
+add r2, L153
+dec r6
+cmp r4, r6
+L171: .string "ecq"
+L172: .data 987, -953, -928
+dec *r2
+L173: stop
+L174: not r2
+L175: rts
+red *r7
+L176: add #245, *r1
+sub *r6, L3
+not r4
+clr L33
+dec r3
+add r0, r3
+L177: not L37
+lea L165, r0
+stop
+lea L152, L119
+stop
+jmp *r3
+L178: inc r0
+clr L168
+L179: inc r1
+L180: sub L68, r0
+L181: cmp r1, *r7
+prn #124
+L182: jsr *r1
+L183: cmp *r1, L122
+L184: stop
+L185: add #148, *r5
+L186: lea L46, r4
+clr r6
+L187: add r1, r3
+L188: .data 11, 374, -954, -668
+clr r5
+clr *r7
+L189: .data -865, -171, -885, 437
+add L34, *r2
+L190: red r6
+bne *r0
+cmp r3, #223
+jmp *r1
+rts
+jsr *r3
+L191: clr r4
+L192: .data 267, -492, -63, -438, -809, 698, -327
+jsr *r3
+clr *r0
+bne *r6
+jmp L37
+L193: red L94
+L194: dec r2
+L195: .data -944, 12, 49, 6, -812, 207, -309, 171
+dec L19
+bne L173
+clr *r3
+jmp *r6
+bne L123
+mov r4, L155
+inc r7
+rts
+L196: cmp L147, r2
+mov *r6, L77
+L197: lea L156, L39
+clr *r6
+L198: bne *r1
+dec *r4
+cmp *r7, #-216
+jsr L24
+red L70
+add L191, *r7
+mov r3, r6
+jmp *r3
+
+L199: prn *r4
+prn #-249
+red L180
+lea L36, *r0
+mov r3, L145
+stop
+L200: .string "lamvtshax"
+mov L86, r1
+jmp *r3
+not L62
+cmp *r0, r5
+jsr *r2
+L201: not r0
+jsr L150
+prn *r2
+add *r4, r6
+L202: sub r0, L91
+clr *r3
+bne *r3
+inc L42
+prn #12
+L203: rts
+dec L88
+L204: .string "inhblyxckszxufqkga"
+cmp *r0, #160
+stop
+cmp r3, *r2
+dec r5
+prn L61
+jmp *r5
+L205: .string "dfhjxmtfvk"
+stop
+; comment
+L206: .string "ojonokocjnqznsylxqetbc"
+mov #115, *r3
+stop
+L207: .string "cnkhrh"
+; comment
+L208: not *r5
+clr r7
+L209: mov #45, *r1
+sub #79, r6
+stop
+jmp L33
+inc L146
+dec r6
+L210: lea L17, *r6
+L211: inc *r7
+rts
+rts
+L212: .data -687
+prn L32
+L213: prn r1
+clr *r3
+prn #-250
+L214: .data -188, -719, 106, -90, -543, -801
+add #31, r5
+jmp L182
+jsr *r7
+L215: red L60
+not r7
+rts
+prn L84
+clr *r2
+L216: .string "vwvayvdivtonjzyjocnt"
+jsr *r1
+inc *r5
+L217: .data -957, 831
+L218: cmp L189, #-237
+cmp #59, L214
+L219: .data -354, -793, 672
+bne L50
+dec *r5
+L220: red L204
+lea L197, r3
+L221: bne *r4
+L222: mov r6, *r7
+L223: prn L167
+L224: sub #-120, L163
+prn L37
+L225: inc *r1
+jsr *r6
+
+L226: inc r6
+L227: lea L127, L124
+L228: inc *r7
+sub r6, r0
+mov L116, *r3
+mov L189, *r7
+L229: inc L224
+L230: prn *r6
+not L213
+
+L231: clr r3
+not *r1
+L232: lea L136, *r0
+L233: prn r4
+not L200
+L234: dec L32
+L235: .data 429
+jsr L164
+not *r4
+jsr *r1
+red *r5
+add L97, r3
+stop
+add L201, L111
+red r3
+stop
+cmp #61, L90
+L236: red *r3
+inc r5
+cmp r7, r6
+L237: .data -938, -421, 730, -704, -918, 849, 487, -922
+inc r5
+jmp *r2
+clr *r5
+stop
+red r3
+mov r7, *r3
+L238: lea L203, r5
+stop
+L239: .string "lblarpwyrwoawmvkc"
+L240: jmp L6
+mov L33, r3
+L241: bne *r5
+L242: jmp L179
+L243: .data 314, -81, -237, 400
+not *r7
+L244: prn #-223
+prn *r7
+L245: dec *r5
+lea L31, *r3
+L246: add r7, r0
+mov L165, *r1
+rts
+mov L187, r1
+sub L7, *r2
+jsr *r1
+L247: dec *r3
+L248: .data -932, -216
+rts
+L249: .data 906, 578
+; comment
+L250: inc *r1
+L251: .data -945, 9, -815, -617, -669
+L252: red r4
+inc r6
+L253: .data 91, 966, 368, -6, -145, -377, -15
+rts
+cmp L4, #-46
+rts
+stop
+sub *r0, *r5
+jmp *r0
+mov r6, r5
+jmp *r5
+jsr L10
+clr *r0
+bne L76
+inc *r3
+clr *r3
+L254: add *r7, L156
+rts
+sub r4, r2
+L255: prn r1
+L256: .string "gghxkpvdxvkmewfzqdnrqhda"
+red *r1
+cmp #-141, L138
+
+mov r7, L40
+jmp L53
+red L125
+cmp L238, #234
+red *r1
+L257: inc *r0
+sub #-153, r2
+red L207
+not L4
+L258: .data -291, -736, -489, 767, 107, 33, -615, 502
+stop
+jsr *r7
+; comment
+lea L226, r6
+rts
+stop
+jmp *r4
+red r2
+rts
+add r0, r5
+L259: .string "jfsumweu"
+L260: add *r1, *r4
+clr L209
+lea L239, L199
+red r5
+clr r0
+not *r2
+L261: .data -217, -260
+L262: rts
+clr *r6
+red L228
+sub r0, *r6
+
+L263: red r0
+inc *r1
+cmp r0, #-229
+lea L1, r6
+red *r1
+L264: clr L155
+jsr L244
+bne *r2
+L265: .data 368, -747
+L266: .data -574, 144, -626, 17, 671, 843, -492, 829
+rts
+rts
+mov #37, *r0
+L267: add r7, *r2
+prn r1
+L268: red L11
+L269: dec *r7
+L270: lea L0, r4
+cmp *r2, *r6
+L271: .data -942, -627, -885, -596, -236
+red L94
+L272: stop
+sub #-198, *r2
+L273: jsr *r6
+L274: lea L192, r2
+L275: bne *r7
+; comment
+mov #-84, *r1
+lea L92, r1
+jsr L2
+inc *r4
+jsr L15
+mov L26, r6
+prn L50
+not r7
+sub #175, *r2
+stop
+; comment
+mov r3, *r7
+
+rts
+rts
+cmp r4, L240
+prn *r4
+jsr *r5
+L276: dec L63
+cmp L177, #62
+L277: red L151
+inc L246
+L278: .string "b"
+prn r3
+L279: .data 106, -256, 909, -903, -507, -550, -661, -83
+stop
+stop
+mov L123, *r7
+add L95, r5
+rts
+inc L149
+lea L208, r5
+L280: stop
+prn L187
+red r2
+clr *r5
+mov #-189, r0
+mov #-84, L95
+L281: clr r5
+L282: rts
+L283: .string "ynrtm"
+not L267
+stop
+sub L66, r1
+red r6
+L284: rts
+L285: bne L195
+red L142
+L286: rts
+jsr L146
+L287: cmp L100, #111
+rts
+jmp L135
+L288: bne L285
+mov *r2, L62
+cmp *r4, L108
+rts
+; comment
+bne L227
+inc *r6
+rts
+dec L163
+L289: .data -660, 411
+L290: jsr L187
+add r5, L123
+
+L291: dec L173
+L292: .string "zkcvskydjkpw"
+inc r2
+red L126
+not *r7
+red *r4
+red L165
+jmp L36
+jsr L65
+cmp *r6, L154
+sub *r2, L86
+jmp *r6
+mov #-86, L11
+L293: jsr L223
+not L277
+L294: .string "brxsmqapay"
+; comment
+cmp *r2, *r5
+sub L251, *r5
+L295: rts
+not r2
+jmp *r5
+lea L230, L266
+L296: .data 333, 183, 810, -562, 397, -141, -687
+L297: .data -348
+cmp r2, r7
+mov #-60, *r7
+inc L203
+mov L53, r3
+L298: .data 392, -256
+rts
+L299: .data 870, -162, 824, -939, 620, -281, 72
+L300: .string "sirmj"
+L301: .string "irwn"
+L302: lea L209, r2
+jmp L180
+bne L189
+rts
+L303: add #139, L181
+L304: jsr *r4
+add #-234, *r6
+jmp *r7
+L305: .data 68, 16, 928, 726, 608, -413
+cmp *r6, #170
+rts
+jmp *r0
+; comment
+cmp r4, L29
+jmp L268
+L306: .string "gcty"
+inc r3
+L307: dec r6
+prn #130
+L308: bne L12
+bne *r4
+L309: stop
+L310: not r7
+rts
+stop
+L311: jsr L11
+L312: mov r1, L217
+L313: sub *r1, L83
+L314: cmp L217, L26
+
+L315: .string "vbeszpxodteqi"
+jmp *r1
+L316: jmp L112
+L317: bne L89
+mov *r7, r5
+not *r5
+L318: .string "h"
+
+L319: .string "bifgirwna"
+L320: dec *r6
+dec *r4
+not *r1
+; comment
+jmp *r7
+cmp L130, L184
+add L152, *r4
+L321: jmp *r3
+prn r5
+L322: stop
+L323: .data 280, -368, -684, -318, 70, 625
+L324: jmp L35
+sub r4, r6
+L325: inc *r2
+L326: .data -910, -51
+sub *r7, r5
+lea L90, *r2
+cmp #-197, L2
+stop
+dec L15
+stop
+not L39
+red L276
+clr *r0
+red L187
+rts
+L327: .data -699, -250, -275, 685, -875, 106
+L328: prn r5
+L329: .string "eypubtn"
+L330: bne *r1
+mov *r3, r2
+L331: .data 0, 622, 62, 481, 27, -551, 481, -713
+jmp L225
+L332: .data -217, 402, 818, -727, -835, -653, 866
+L333: prn #60
+stop
+prn #214
+L334: dec r7
+jmp *r0
+dec *r1
+L335: .string "ehztdsgdcoltcvh"
+stop
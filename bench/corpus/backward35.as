@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 36
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+clr L285
+cmp L0, *r3
+red r4
+inc r4
+L0: mov *r5, *r3
+jsr L0
+lea L0, L0
+lea L0, L0
+not *r6
+L1: .string "pqxbjtfwstitzotqvgazep"
+L2: prn *r4
+lea L1, r3
+sub #1, *r2
+L3: jsr *r1
+rts
+jmp L2
+inc L1
+stop
+add r1, *r5
+sub L3, L3
+L4: .string "nuxsfthpbpciqk"
+cmp r6, L0
+stop
+L5: .string "fpmsqyxwzxrtopgufxtqhlv"
+lea L2, r0
+; comment
+L6: sub #197, L5
+L7: jsr *r2
+clr L6
+red *r3
+add *r5, r5
+L8: sub #71, L3
+L9: prn r1
+; comment
+rts
+mov *r7, r6
+L10: rts
+prn L4
+L11: sub L2, L7
+add #232, *r1
+L12: inc *r6
+prn *r0
+jsr L2
+L13: rts
+mov #-245, *r4
+inc L12
+dec L7
+L14: inc r2
+
+inc *r0
+rts
+L15: .data -733
+lea L15, L5
+L16: .data 817, -237, 220, 978
+L17: inc *r7
+; comment
+L18: .string "mqicad"
+not *r2
+; comment
+L19: cmp r1, r6
+; comment
+rts
+not *r6
+L20: red L10
+L21: inc *r3
+L22: stop
+
+; comment
+sub L21, L13
+sub L18, r3
+L23: dec r6
+L24: prn #74
+L25: rts
+dec r3
+jsr *r7
+L26: rts
+L27: .data -54, -732, -894, 596, -871
+stop
+lea L3, L13
+L28: .string "rwe"
+L29: jmp L3
+L30: .data -693, -834, -719
+jmp *r5
+add *r1, *r3
+L31: jmp *r3
+red r1
+lea L17, *r4
+add r1, r5
+red r4
+L32: .string "gkffyhpmwhpao"
+L33: lea L22, *r0
+red r1
+red *r0
+jsr *r3
+dec r6
+L34: .data -964, -980, 144, 174, 600, 450, 459, 935
+L35: .string "oox"
+mov L25, *r6
+jsr *r7
+jmp *r1
+L36: mov r6, L22
+inc r3
+L37: lea L19, *r7
+jmp L7
+L38: .data 878, -538, -416, -916, -383, -3
+
+rts
+prn *r3
+mov r2, L34
+L39: bne *r4
+L40: stop
+L41: .data 867, -769, 354, -766, -506, 995, -640, 111
+L42: .string "zqmmjkkbjignhxt"
+
+red r6
+L43: .string "etidegwcxqnbszus"
+clr L22
+add #255, r5
+bne L13
+L44: sub *r6, *r7
+jsr *r1
+L45: .data -672, 878, -583
+L46: mov #152, L20
+jsr *r3
+jsr *r0
+clr *r5
+rts
+stop
+bne L12
+stop
+; comment
+L47: .string "iyqeerazngvtpbhm"
+jmp L7
+mov r3, *r3
+not *r2
+clr L26
+rts
+L48: .data -915
+inc r4
+not L26
+mov #213, L15
+L49: dec *r7
+jmp L41
+L50: add *r3, *r2
+clr r7
+L51: .string "g"
+sub L50, r6
+not L45
+bne L24
+L52: prn *r7
+L53: .string "gqsskkneysbscceevwbpno"
+stop
+
+stop
+lea L14, *r0
+stop
+bne L41
+bne *r0
+red L41
+mov #-12, *r3
+L54: lea L40, r0
+add *r2, L20
+not *r6
+L55: .data 134, 482, 948, 409, 5, 164
+add *r2, r1
+add *r0, r2
+jmp L2
+jmp L15
+L56: cmp #91, L32
+L57: .data 576, -952, -653
+L58: .string "wfhllq"
+bne L38
+L59: .string "ivavl"
+clr L30
+
+cmp *r3, r0
+L60: prn #-200
+prn r0
+stop
+mov L37, L59
+inc *r3
+clr *r5
+mov #184, L58
+lea L15, *r4
+stop
+L61: .data 796, 898, 386, 126, 373, 862
+L62: lea L22, L8
+L63: rts
+stop
+bne L10
+not L63
+dec *r4
+L64: not L48
+add #-54, r0
+jsr *r4
+L65: prn #26
+
+mov #-106, *r5
+L66: .data -236, 703, -919, -948, 971
+L67: jmp *r2
+mov #163, *r7
+L68: inc r3
+L69: prn #15
+jsr L22
+cmp #250, L30
+jmp *r6
+L70: prn r7
+L71: cmp #30, L17
+L72: mov *r3, L15
+not L64
+L73: .data -778
+bne *r5
+L74: .string "pfa"
+add r2, r4
+; comment
+L75: jsr L57
+L76: clr L45
+not *r0
+lea L33, r3
+stop
+rts
+mov r4, r0
+L77: sub r5, *r0
+L78: add r3, r3
+clr L3
+L79: bne *r1
+L80: jsr *r0
+jmp L51
+stop
+L81: .string "kf"
+inc L1
+stop
+rts
+L82: cmp *r7, L59
+sub *r2, *r4
+inc L21
+lea L29, *r2
+jmp L55
+L83: bne L30
+L84: sub *r1, r6
+L85: clr *r2
+L86: rts
+L87: inc *r3
+prn r5
+jsr *r2
+red *r4
+cmp #-153, r6
+L88: sub L43, *r4
+dec L18
+rts
+inc *r1
+rts
+lea L52, *r3
+L89: bne L87
+prn L89
+L90: inc *r1
+L91: bne *r3
+bne L46
+dec *r5
+L92: .string "yxesgqtdvevuybwylbff"
+dec r5
+L93: .string "nkqoxlvcphh"
+L94: rts
+inc *r7
+sub r1, *r1
+L95: .data -497, -655, 471, -229, 455, -109
+L96: rts
+not r4
+lea L36, *r3
+rts
+L97: inc *r4
+sub r2, L10
+L98: .string "jpnzwmputgkgsnajtzqocxj"
+jsr *r4
+red L17
+stop
+mov L54, r3
+L99: prn #-183
+L100: clr *r1
+dec L18
+L101: .data 852
+L102: red r0
+jsr *r4
+jsr *r6
+dec r5
+dec *r7
+jsr L91
+inc *r7
+cmp *r6, L61
+L103: lea L84, *r6
+L104: stop
+mov L43, r5
+add *r5, L3
+L105: .data 717, 878, 87, -339, 750, -658
+bne L79
+rts
+lea L99, r0
+inc L100
+not *r1
+jmp L99
+L106: .string "ichcbg"
+cmp *r4, L63
+add #-251, r2
+stop
+red *r2
+L107: prn #102
+; comment
+L108: jmp L0
+lea L16, L33
+red r0
+L109: inc *r7
+lea L30, *r7
+clr *r2
+L110: clr L13
+clr L92
+L111: clr L24
+sub r0, r1
+inc r3
+L112: .data -379, 82, 610, 528, 158, -12, -463
+L113: cmp *r7, #-75
+not *r2
+L114: jsr *r3
+L115: inc r6
+not r6
+not *r7
+mov L82, r1
+bne *r0
+sub #63, L40
+prn *r4
+L116: .data -531, 524, -308
+stop
+L117: inc *r4
+jsr L80
+sub r2, *r4
+L118: not *r3
+prn r2
+L119: .data -232, -514, 25, 679, -12, 679, -274, 189
+L120: .data -892, 455, -767, 852, -751, -517
+L121: stop
+L122: lea L116, r1
+jmp L60
+inc r3
+L123: .data -489, -40, 825, 46, -586, 358, 416, 385
+stop
+L124: .data -913, 880, 239, 911, -200
+bne L82
+L125: inc *r3
+lea L76, r7
+jmp *r2
+jmp L55
+dec *r4
+stop
+L126: add *r7, L47
+add *r2, L113
+rts
+bne *r3
+L127: inc L54
+L128: inc *r6
+L129: clr *r4
+jmp L123
+L130: bne *r5
+inc L17
+add L1, r6
+bne L52
+add #55, *r0
+L131: sub r1, r2
+mov r2, L58
+not r4
+L132: .data -457, 594, 73, 309
+L133: dec L94
+not L10
+sub *r5, L30
+add *r1, r4
+L134: .data 39
+L135: .string "xbehtypw"
+L136: .string "smdk"
+L137: .data -324, -139, -510, 510
+; comment
+L138: .data 369, 716
+clr L97
+stop
+clr *r4
+L139: inc r6
+add #-94, L125
+dec L29
+sub r6, r0
+prn r1
+dec *r0
+L140: inc *r6
+cmp L62, L84
+bne L19
+rts
+stop
+lea L22, *r2
+L141: sub *r3, r0
+L142: not r6
+cmp *r4, L127
+add r0, L57
+not *r0
+cmp r2, *r1
+L143: add *r1, L132
+L144: bne *r4
+mov *r2, r0
+L145: .string "obrw"
+
+clr r6
+rts
+L146: .string "ckmyjwt"
+L147: rts
+L148: sub r4, *r4
+inc r2
+jsr *r1
+sub r2, *r6
+L149: dec r6
+cmp L129, r4
+L150: lea L123, *r5
+lea L5, L79
+L151: prn #236
+rts
+cmp *r2, *r0
+L152: .string "qxngbpjvjtqkezwayday"
+; comment
+not r4
+not r5
+prn #-122
+stop
+add *r5, r5
+L153: bne *r5
+L154: .data 345, 489, -916, -623, -229, 73, -299, 174
+clr *r5
+rts
+jmp *r0
+rts
+bne L46
+inc L46
+L155: rts
+L156: cmp r2, *r3
+L157: .string "zrtosfzulhoyxmx"
+L158: clr *r1
+sub *r2, L60
+jmp *r1
+L159: .string "zvlvhquqwcxxytoruruszybu"
+jsr *r0
+prn r7
+stop
+add *r3, L102
+inc r5
+jmp *r6
+inc L66
+jmp *r2
+jsr *r4
+inc L69
+dec *r7
+bne *r3
+cmp L71, r1
+L160: sub L21, *r1
+sub #165, r7
+
+L161: .string "rosddxcptwzeghc"
+L162: prn #169
+L163: rts
+dec L9
+L164: jmp *r6
+L165: inc L128
+L166: red r2
+L167: .string "p"
+inc L163
+L168: add L163, *r0
+rts
+L169: lea L102, *r6
+lea L46, r6
+L170: jmp *r0
+not *r0
+red *r4
+jmp *r2
+L171: prn r4
+jmp *r2
+L172: bne L39
+L173: jmp L164
+L174: .string "n"
+sub *r6, L12
+
+clr *r1
+L175: jmp *r4
+not *r3
+L176: sub r3, L142
+stop
+stop
+not L36
+L177: red *r7
+L178: clr r2
+prn #-3
+red *r3
+cmp *r3, *r2
+lea L150, L104
+prn *r6
+L179: jmp *r4
+L180: .data -476, -5, -601, -628, 843, 247
+not *r6
+rts
+jsr L170
+bne L13
+L181: .string "ebw"
+rts
+add r3, L153
+not *r5
+L182: jsr *r1
+L183: .string "dkhcyutifptvkzxhxyvlzmgs"
+prn L105
+not r6
+bne L4
+jsr *r5
+
+L184: .data -145, 964, 574, 739
+inc *r6
+L185: jsr L4
+jsr L130
+; comment
+rts
+L186: stop
+L187: add r5, L43
+add r0, L104
+L188: not L59
+bne *r1
+mov r6, r6
+inc r0
+L189: jsr L78
+clr *r2
+add r2, *r0
+jsr L181
+inc L18
+stop
+stop
+inc *r3
+red L107
+jmp *r5
+jsr L114
+inc L136
+L190: stop
+bne *r6
+L191: prn #-7
+L192: .string "chjzniy"
+L193: prn L93
+not r1
+L194: add #162, *r1
+prn L165
+L195: prn #-252
+L196: sub #-159, *r3
+rts
+L197: add r2, r7
+add *r0, L97
+L198: dec L27
+mov L188, r4
+prn L28
+L199: sub *r6, *r3
+dec L99
+bne L102
+L200: mov r2, L177
+; comment
+sub r5, *r6
+prn L76
+L201: sub #-22, L76
+L202: add *r0, *r1
+dec L79
+
+L203: prn *r4
+L204: bne *r5
+bne *r7
+not L88
+inc r5
+jmp *r1
+dec L112
+mov r7, L173
+jmp L33
+jmp L164
+lea L62, L48
+rts
+bne *r4
+L205: mov *r1, *r1
+L206: jmp L93
+sub #53, *r5
+rts
+cmp #55, *r5
+; comment
+add #-70, *r5
+L207: .string "ycyyukmgtlbdclz"
+L208: sub #126, r7
+L209: stop
+; comment
+jsr L19
+L210: bne *r0
+
+sub r5, L198
+jmp L202
+L211: .data -252
+dec *r5
+red *r0
+L212: inc L7
+L213: .data 95, 976, -853
+L214: red L61
+jsr L142
+L215: stop
+L216: mov #-28, L13
+
+L217: .string "ivoinxnm"
+L218: mov L78, L83
+rts
+rts
+jmp *r0
+sub #236, r7
+clr *r5
+L219: .string "ijjqmiffpleffi"
+inc *r3
+lea L54, *r3
+L220: dec *r3
+bne L166
+jmp *r0
+jmp L1
+mov #-256, L147
+
+rts
+rts
+rts
+
+L221: dec L95
+sub L115, *r5
+stop
+jsr *r7
+bne *r7
+lea L128, *r2
+add #-245, r3
+L222: bne L41
+L223: cmp #-117, L184
+inc r1
+prn #-174
+mov #182, L122
+add *r4, r1
+L224: inc L11
+dec r0
+L225: cmp #-6, L202
+L226: .data 46, -544, 743, 993, -855, -913, -365
+L227: prn L165
+L228: dec L218
+prn *r6
+clr r1
+jmp L150
+L229: jmp *r4
+L230: jmp L0
+sub r0, *r7
+rts
+stop
+L231: bne L16
+L232: rts
+not L47
+inc r5
+L233: prn #-224
+; comment
+cmp L63, L169
+not L148
+L234: lea L196, r2
+red L188
+dec *r1
+jsr *r7
+clr r3
+L235: add *r6, L148
+
+L236: cmp L32, L38
+sub r5, r2
+inc r6
+
+L237: .data 678, -247, 722, -462
+stop
+stop
+sub r5, *r2
+prn *r7
+not r6
+inc r3
+L238: rts
+
+jsr *r0
+dec r1
+mov r1, r0
+prn *r7
+L239: prn L158
+sub L128, r3
+jmp *r2
+stop
+cmp L80, #-210
+L240: mov #216, *r5
+clr r3
+
+L241: stop
+clr L23
+prn *r3
+L242: rts
+L243: .string "gdxp"
+red r1
+sub L211, r3
+sub *r3, L33
+jmp L219
+sub #-51, *r4
+add #-124, L13
+L244: inc L3
+red *r4
+jsr *r6
+sub r7, L139
+dec L176
+bne L93
+bne L99
+mov *r6, r4
+L245: dec r0
+L246: bne *r0
+clr r2
+cmp L1, *r5
+red r1
+dec L87
+; comment
+add *r3, L129
+stop
+jmp L14
+cmp #179, #198
+lea L117, *r0
+sub r3, L106
+L247: mov #27, *r1
+L248: mov #-97, r3
+L249: prn r7
+prn *r3
+prn L26
+mov *r5, r6
+L250: .string "zt"
+
+lea L66, L180
+
+lea L85, *r5
+L251: prn r7
+mov *r3, L116
+cmp L215, L23
+prn #-226
+lea L169, r1
+L252: bne *r4
+; comment
+cmp r3, *r7
+lea L40, L238
+inc L131
+L253: .data 127, -248, -770, -580, -4, -450
+L254: sub r0, *r2
+red L49
+jsr *r3
+L255: lea L62, r2
+rts
+L256: clr r6
+not r6
+mov L125, L176
+prn *r4
+inc L78
+L257: dec *r1
+L258: prn *r0
+mov *r5, L243
+L259: mov r7, r4
+dec *r7
+L260: bne L166
+lea L19, *r1
+lea L40, r4
+L261: stop
+L262: inc r0
+L263: .string "vtyyvwcphbfufqxb"
+L264: .string "rzmihvbmvicxdovjrznk"
+clr *r1
+dec L194
+not *r1
+L265: prn #-89
+L266: .string "yzanoowdinzztqj"
+cmp #-124, r6
+inc L187
+add #-209, r0
+inc r5
+rts
+bne L241
+cmp L184, r3
+L267: cmp #-182, r2
+bne *r6
+L268: add r3, *r2
+L269: .data 755, 705, 775, 918, -89
+sub #-69, L10
+L270: red *r6
+L271: .data 773, -711, -650, -191
+not L208
+jsr *r3
+L272: prn r0
+jmp *r4
+lea L250, L168
+L273: not *r1
+red *r5
+L274: not *r3
+rts
+L275: cmp #-170, *r7
+L276: red r6
+L277: jmp *r4
+rts
+cmp *r1, #-20
+L278: sub r3, L123
+stop
+stop
+dec L183
+
+L279: rts
+prn #13
+jsr *r2
+not *r7
+jsr *r6
+L280: .string "rqj"
+clr r3
+clr r7
+jmp *r1
+jsr *r0
+bne L271
+cmp r3, #-206
+dec L209
+mov #183, L54
+add L108, r0
+L281: .data -753, 426, 750, 24
+L282: .string "i"
+stop
+not L61
+L283: jsr *r1
+L284: dec r4
+L285: .string "ndblpl"
+prn *r0
+L286: clr r1
+rts
+stop
+mov L111, L17
+L287: .string "xxlxcmicpspsai"
+bne L130
+clr L209
+prn #71
+
+jmp L283
+clr L223
+L288: prn r7
+prn L286
+stop
+L289: clr *r0
+L290: dec L210
+L291: dec r2
+L292: mov r6, *r1
+L293: stop
+L294: inc L266
+lea L2, *r3
+L295: dec *r5
+clr L247
+L296: lea L145, L76
+add *r3, *r4
+lea L106, *r3
+L297: .data 938, 375, -320
+L298: .string "vcovrbauwlh"
+add r2, L20
+L299: cmp r0, r4
+prn L216
+inc L74
+rts
+prn *r0
+rts
+L300: dec *r2
+inc r6
+L301: cmp r3, r4
+stop
+prn *r7
+jmp *r7
+red r4
+jsr *r5
+inc r6
+
+L302: stop
+rts
+clr L113
+dec r1
+mov r6, r7
+L303: stop
+L304: not L141
+jmp L37
+bne L82
+inc r3
+prn #160
+L305: prn #81
+
+jmp L21
+dec r6
+L306: .string "hodn"
+L307: .data -893, 770
+cmp *r2, #221
+sub *r5, L198
+stop
+bne L100
+red *r7
+L308: inc L189
+cmp #-78, L244
+cmp r6, r3
+dec L296
+L309: mov #-65, *r1
+L310: cmp L172, #-247
+mov *r5, L97
+cmp *r0, L157
+clr r3
+sub L291, *r4
+lea L279, L309
+sub #-234, L80
+L311: prn L231
+L312: .string "xxhcjxrnraodvusjt"
+lea L100, *r7
+prn r2
+L313: red L30
+inc *r7
+L314: .string "dgctlmnscquecypa"
+L315: .string "ygjwucihfkdwotbsttsseadi"
+prn r3
+not r1
+L316: red r4
+L317: bne *r6
+L318: add #-80, r4
+L319: dec L121
+L320: cmp *r1, L75
+bne L242
+dec *r3
+rts
+; comment
+rts
+L321: bne L65
+L322: red *r2
+rts
+L323: not r7
+sub *r4, r4
+dec *r1
+mov r1, r7
+jmp L270
+mov *r2, *r7
+inc *r6
+red r6
+L324: clr *r0
+inc *r7
+L325: red *r0
+stop
+inc L46
+clr r3
+L326: rts
+rts
+inc *r2
+not L129
+mov r2, *r0
+stop
+not L119
+cmp L125, #134
+jsr *r5
+clr *r0
+stop
+L327: clr L306
+jsr L137
+L328: jsr *r4
+not r0
+clr r0
+L329: rts
+add #-105, *r5
+add L175, *r5
+L330: stop
+dec L126
+L331: .data -801, 259, 645, 911, -730, 992, 87, 337
+prn #233
+stop
+L332: sub r7, *r4
+cmp r2, L157
+jmp *r1
+L333: lea L173, r2
+clr r4
+L334: prn r2
+add L271, r1
+L335: not r4
+sub #152, L126
+jmp *r5
+L336: jsr L149
+L337: stop
+jsr L336
+jmp L190
+inc *r0
+prn #-83
+inc r5
+lea L3, r5
+inc *r7
+L338: rts
+lea L116, *r7
+L339: .string "acaqwhjprcyxyqhmnrumdn"
+dec L308
+lea L176, r5
+L340: .string "x"
+clr r6
+red r7
+add r3, r3
+dec r4
+lea L339, *r3
+mov r1, L138
+bne *r7
+stop
@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 37
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+lea L199, *r7
+red r3
+red L62
+L0: jsr L0
+mov #-42, r5
+L1: sub L1, *r4
+L2: cmp *r5, r5
+lea L1, r6
+L3: add #-34, *r4
+add #81, L3
+rts
+L4: clr L1
+L5: .data -62, 193, -788, -369, 772
+L6: cmp *r6, L1
+prn #-255
+L7: dec *r5
+bne *r0
+bne *r4
+add *r2, L5
+inc L2
+inc *r4
+clr *r6
+add r7, L5
+cmp L2, *r6
+lea L3, *r1
+L8: .string "o"
+L9: not r7
+dec r3
+L10: inc L0
+L11: .string "ctlduqytqxmnnjifemz"
+L12: jsr L11
+add r6, L0
+dec *r3
+dec L5
+jsr *r0
+rts
+L13: jmp L6
+L14: prn L14
+L15: .data -862, -799, -329, 342, 256, -326, -458
+red *r3
+prn L4
+L16: sub L16, *r0
+lea L13, r0
+L17: lea L12, r1
+jsr *r0
+not r7
+L18: clr r1
+
+L19: bne L7
+clr *r4
+rts
+L20: sub r5, L12
+stop
+jsr *r4
+L21: cmp L6, *r5
+L22: inc r1
+L23: lea L5, *r3
+red r0
+L24: dec *r5
+L25: cmp #37, L6
+clr r0
+prn r4
+red *r3
+jsr *r6
+L26: clr r5
+L27: cmp r1, r6
+
+L28: red L2
+cmp *r3, L8
+L29: jsr *r6
+prn #226
+sub L23, r3
+; comment
+dec r6
+rts
+lea L11, r2
+prn L25
+lea L13, *r4
+L30: jsr *r2
+dec r6
+red L18
+jmp L11
+clr r2
+L31: sub L14, L20
+dec r5
+dec L31
+L32: bne *r4
+L33: inc *r3
+bne *r7
+jmp L8
+lea L23, *r6
+red L17
+L34: jsr L24
+L35: sub #43, L18
+rts
+jmp *r1
+sub *r4, *r5
+L36: .data 996, 541, 393
+prn *r1
+; comment
+L37: rts
+L38: bne *r7
+stop
+inc *r1
+stop
+red *r6
+L39: sub #62, r3
+red L20
+; comment
+L40: .string "xaddkstfhymqxmpavpfhgahb"
+L41: .string "yfcoyjkzhgvnxhfz"
+inc *r5
+dec *r1
+rts
+stop
+inc r2
+red *r0
+L42: sub L16, *r7
+sub r0, L33
+lea L17, r5
+L43: rts
+; comment
+L44: rts
+L45: bne L39
+inc L30
+stop
+clr L19
+stop
+L46: .data -2, -128
+clr *r2
+add #118, L42
+bne L15
+dec *r3
+L47: prn *r0
+L48: prn r0
+lea L26, *r6
+; comment
+L49: jsr *r0
+L50: red r0
+L51: prn r6
+L52: .data -33
+prn r7
+
+jmp *r1
+L53: dec L19
+dec *r5
+L54: not r3
+jsr *r6
+L55: mov L54, L47
+bne L39
+L56: lea L54, r1
+mov r6, *r7
+L57: cmp r1, L51
+sub L25, *r7
+add r6, r3
+L58: not L51
+inc r5
+L59: .string "zcamrcpu"
+prn #-73
+; comment
+not r7
+add r2, L51
+prn #-67
+; comment
+sub r6, *r3
+jmp *r4
+inc *r4
+inc *r7
+not L58
+sub L36, L29
+L60: jsr *r5
+L61: not r2
+L62: sub r6, r2
+bne L16
+L63: not L33
+sub #-107, r7
+L64: dec *r0
+rts
+add L40, L40
+sub L62, *r1
+sub r4, r2
+L65: mov r3, r5
+rts
+prn r6
+inc L42
+cmp r3, r5
+rts
+L66: jmp L36
+L67: .data -452
+bne *r1
+L68: red r1
+red L8
+not *r5
+bne *r5
+mov L32, r0
+inc *r1
+red r1
+cmp *r5, #-230
+L69: rts
+L70: .data 51, 63, -221
+L71: .data -718, -929, 445, -75, -400, -319, 646
+jmp *r1
+cmp *r5, #250
+prn r1
+bne *r1
+L72: cmp *r2, L39
+L73: dec r5
+sub *r7, *r3
+sub r1, r3
+L74: .string "nkmdohaviivdmzt"
+inc L57
+jmp L45
+rts
+inc r1
+inc L23
+; comment
+L75: stop
+L76: .string "nkierulq"
+prn r3
+L77: .data 232, -104, -459
+inc *r7
+jsr *r0
+L78: dec r3
+L79: inc r4
+L80: prn L63
+dec r6
+mov r2, r7
+bne L62
+add r5, L11
+; comment
+L81: .data 856, 815, 187, -376
+jsr *r2
+L82: .string "vdhoakplmhqrkqdczwxnuzac"
+red r6
+red L75
+L83: red *r0
+L84: clr L29
+L85: mov *r2, L40
+inc L60
+mov L75, r0
+L86: red *r1
+prn #248
+prn L52
+cmp r5, #-202
+L87: lea L31, L70
+L88: mov #50, r3
+red r4
+lea L19, *r1
+L89: not *r4
+clr *r3
+jsr *r1
+stop
+add r7, r1
+clr *r4
+lea L63, r0
+jsr L14
+L90: mov #-90, L3
+L91: cmp L20, r4
+L92: prn #-136
+jsr *r1
+L93: lea L3, L29
+L94: .string "inlfcflgdchgidtffns"
+red r0
+prn L30
+L95: lea L75, r3
+cmp L20, #-136
+rts
+cmp L7, #-58
+stop
+rts
+bne *r2
+L96: sub r3, r4
+red L8
+L97: .data 753, -896, 973, -181, -30, 618
+bne L83
+L98: inc r2
+cmp *r1, *r6
+red L37
+L99: not *r5
+L100: .data -50, 66, -434, 812, -792, 302, -783
+prn r4
+L101: jmp *r3
+L102: sub L53, *r0
+add r5, L63
+stop
+bne *r7
+jsr L47
+L103: rts
+sub *r4, L23
+L104: .string "lvrbxhbmmehrxntwdeuo"
+L105: .data -894, 703, -95, -251, -862, 929, 695
+jsr L66
+L106: mov L100, *r7
+add #-93, r7
+L107: .string "neztdhzhn"
+L108: .data 606
+jmp L67
+L109: red *r0
+L110: red L102
+clr L90
+L111: .data 839, -502, -337, 871, -495, -417, -622
+inc L18
+jsr L7
+jsr *r6
+inc *r0
+rts
+L112: lea L89, *r6
+dec r4
+bne *r0
+lea L90, r0
+L113: clr *r7
+L114: .string "hqdezwadytkxnepbknayg"
+stop
+add r1, L92
+jmp L28
+L115: lea L46, r1
+prn r1
+L116: .data -498, -937, 257, -205, 168, 809
+cmp L104, #81
+L117: prn r4
+stop
+
+L118: mov r3, r7
+jsr L24
+L119: dec *r0
+mov *r1, r5
+clr r6
+clr r7
+jmp L38
+L120: dec L73
+sub r7, L52
+add L110, L74
+jsr *r7
+lea L5, L100
+L121: stop
+L122: .data 441
+dec *r3
+jsr L74
+red r5
+dec r7
+bne L80
+lea L35, r3
+inc *r2
+L123: .data -110, 792, -276, 351
+jmp L38
+L124: .string "eengrb"
+L125: .string "qnaanovehvcfwymwlwwzytde"
+L126: clr r2
+; comment
+red *r0
+L127: add #-157, r2
+rts
+inc *r6
+not *r5
+L128: cmp *r6, #219
+red r7
+jsr L101
+L129: lea L25, r7
+L130: cmp r7, #53
+L131: .data -98, -234
+not r4
+L132: inc r4
+prn r4
+bne *r7
+
+mov #224, L71
+stop
+L133: rts
+stop
+cmp #-81, *r0
+jmp *r5
+mov r2, L76
+L134: cmp *r5, *r4
+L135: add L110, *r3
+L136: dec *r5
+L137: not *r2
+jmp *r1
+L138: .string "syybezsavsynlulckxhsrht"
+mov *r6, *r3
+jmp *r5
+mov L101, L1
+clr L104
+rts
+add *r3, r4
+add *r1, *r6
+L139: jmp L0
+L140: lea L46, *r7
+L141: prn *r7
+L142: dec *r3
+jmp L68
+L143: prn *r1
+stop
+add *r2, r1
+jmp *r7
+; comment
+clr L86
+not L50
+prn r2
+inc *r5
+not r0
+
+L144: .data 101, 53, -558
+lea L29, L74
+stop
+
+L145: sub #-143, L131
+jsr L125
+L146: bne L13
+
+L147: add *r6, r6
+not r5
+sub #207, *r2
+inc L111
+dec *r3
+L148: clr *r6
+L149: .data 304, 654, -523, 364, -520, 411, -3
+mov L136, r2
+L150: prn L56
+bne L58
+; comment
+lea L124, L122
+stop
+rts
+add *r1, *r1
+L151: cmp #-219, #182
+L152: red *r4
+L153: prn L18
+L154: bne L124
+red r6
+L155: inc *r5
+dec L48
+dec *r5
+red *r7
+L156: .string "x"
+stop
+L157: sub *r0, r6
+
+L158: cmp #-88, L64
+L159: jmp L101
+clr *r0
+stop
+L160: add r5, *r6
+add #-87, r4
+L161: .data 642, 867, 539
+jsr *r4
+inc r5
+inc L141
+L162: cmp *r1, r2
+bne L54
+L163: mov #-11, L159
+red r3
+clr L64
+not *r6
+red L67
+mov L55, *r2
+rts
+inc *r6
+L164: .string "ociklikyfsshrbogz"
+not r3
+L165: sub #-112, L16
+add L138, r2
+red L102
+L166: .string "qphghoisyklriqobbdzom"
+bne *r2
+lea L109, *r3
+L167: mov r1, *r7
+inc L42
+L168: lea L116, *r2
+L169: .data 416, -671, 139, 487, 901, -855, 263
+lea L91, L15
+red L100
+add r6, r4
+L170: mov L146, L21
+inc L10
+L171: .string "lanwaqqaqgqmdwkrdnxwh"
+not L116
+L172: cmp #-212, #-113
+L173: stop
+add r5, L68
+add r7, r5
+dec r6
+L174: dec *r1
+L175: cmp *r1, L101
+L176: prn #-93
+prn L3
+add #-77, L141
+prn *r0
+add L110, r5
+L177: mov r2, *r5
+; comment
+L178: .string "wlmtwf"
+; comment
+L179: jmp L89
+add #-40, *r0
+dec L149
+add r6, *r4
+rts
+bne *r0
+add L52, *r4
+L180: .data -975, 350
+jsr *r3
+stop
+L181: sub L94, *r6
+L182: .string "paqwncefurzo"
+dec *r7
+inc L3
+bne *r2
+cmp #74, *r1
+jsr *r3
+L183: dec L101
+
+stop
+clr *r6
+L184: jmp *r1
+add L91, r2
+lea L114, *r4
+not L63
+mov #-141, *r6
+L185: prn L140
+L186: .data 27
+add r7, r5
+L187: sub L40, *r5
+L188: red L10
+mov #-9, L123
+L189: jsr *r2
+L190: cmp r0, *r3
+not L168
+L191: jmp *r4
+L192: bne *r0
+rts
+L193: rts
+L194: .string "vnrrmhtmjhfcz"
+L195: inc L98
+not r2
+not *r5
+bne *r4
+L196: prn *r3
+
+dec *r6
+L197: inc L2
+L198: .string "xxhvdcpkf"
+add #-165, r5
+lea L99, r6
+red *r5
+lea L196, r6
+sub *r1, L159
+rts
+jmp L58
+bne L132
+inc L47
+stop
+lea L152, L195
+L199: .data 452, 894, 57, -549, 227, -901
+L200: .data 105, 78, -938, -930, 18, 795
+; comment
+lea L132, L138
+not *r6
+L201: jmp *r0
+bne L99
+jsr *r4
+red L141
+L202: .data -677, 379, -650, 803, -215, 238
+clr L41
+sub L7, r2
+prn *r0
+clr *r7
+L203: .data -905
+inc L41
+; comment
+L204: stop
+L205: rts
+cmp r2, #-248
+red r5
+L206: rts
+L207: clr L4
+L208: sub r7, r2
+rts
+jsr L74
+L209: jsr L163
+stop
+not L180
+L210: .string "negkhveoczrbi"
+jsr L130
+sub #-105, L126
+
+L211: bne L89
+sub L199, r5
+red r7
+L212: stop
+clr *r3
+L213: lea L151, L35
+stop
+add r1, r2
+dec L24
+add L41, *r7
+mov *r6, r1
+red *r1
+L214: .data 468, -793, 874, -410, 17, 992, 51, 23
+L215: sub #-190, L58
+dec L87
+L216: clr r2
+L217: rts
+inc L8
+L218: jsr L168
+L219: stop
+red *r5
+jsr *r5
+red L195
+L220: .string "zgrasfwzjktgwfkyskkrrao"
+L221: bne L86
+L222: .data 819, 491
+
+stop
+not *r1
+inc *r5
+L223: inc *r1
+dec r0
+L224: mov #253, *r2
+; comment
+clr *r3
+jmp L67
+; comment
+L225: .string "lapkadobttexchiyw"
+inc *r1
+lea L30, r0
+red *r4
+bne *r6
+dec r5
+L226: add *r2, r6
+rts
+clr *r0
+stop
+bne L111
+; comment
+not L13
+L227: stop
+rts
+jsr *r4
+inc *r5
+L228: red L129
+red *r5
+clr *r6
+jmp *r7
+bne L30
+
+not r1
+mov r5, *r2
+L229: .data 691, 249
+L230: clr *r1
+bne L95
+L231: inc *r4
+L232: .string "f"
+L233: bne L33
+L234: .string "ihonbswmlyzcnujobfs"
+L235: .string "t"
+add r0, L160
+L236: .string "wxcpklaiwwcyaoyouvp"
+lea L91, r0
+
+cmp #240, r7
+jsr L6
+L237: bne *r6
+dec r7
+bne L76
+dec *r6
+add *r2, r4
+prn L15
+L238: jsr *r1
+L239: red r2
+L240: .string "ijojikvfifhcxnxmjqt"
+not *r7
+; comment
+sub *r6, r2
+mov #45, r6
+rts
+L241: jmp L224
+sub r5, r0
+clr r1
+jsr *r5
+mov r0, *r3
+cmp L232, #173
+not *r7
+stop
+dec r0
+not *r3
+red *r2
+L242: rts
+L243: inc L144
+dec *r7
+red r6
+bne L26
+jsr *r1
+jsr *r1
+L244: .data -90, 785, 663
+L245: not L19
+mov #251, r4
+add #222, *r5
+L246: sub r2, *r6
+mov r7, L239
+not *r3
+L247: dec L40
+L248: .data 252, -923
+mov L181, r0
+dec r3
+; comment
+L249: .string "edkgwhqzltvnrscov"
+stop
+L250: add #-253, *r0
+add r1, L159
+L251: clr r3
+lea L250, *r5
+L252: .data -452, 406, -689, 17, -483, 474, 205, -876
+; comment
+L253: not *r6
+L254: .data -181, 134, -591, 713, 395, 322, 119, -856
+bne *r4
+L255: mov r5, r0
+jmp L161
+L256: add #252, L189
+L257: jmp L216
+stop
+dec r5
+L258: cmp *r7, *r4
+
+sub #2, L59
+L259: red L213
+L260: sub *r1, *r1
+stop
+inc L62
+jmp *r0
+not r3
+; comment
+dec *r3
+stop
+jsr *r0
+L261: .data 595, -350, -111, 523, -396, -647, -10, -279
+not r7
+inc L42
+L262: lea L101, L172
+L263: prn r0
+lea L256, *r0
+inc L238
+red L117
+bne *r1
+L264: jmp *r1
+sub #-123, L222
+L265: .string "fsbxubbjealdsouhfwn"
+jsr *r3
+jmp L176
+cmp *r4, *r6
+jmp *r3
+jmp *r1
+lea L110, L111
+not L261
+L266: .data -457, 876, -385, 890, 746, 984
+L267: stop
+lea L125, r0
+jsr *r2
+cmp #-197, r3
+jmp L88
+L268: jmp *r1
+L269: not L23
+L270: bne L26
+L271: sub r7, L34
+L272: jsr L131
+L273: dec *r0
+lea L159, *r1
+L274: sub r3, r4
+dec r2
+L275: sub *r5, r5
+cmp r6, L86
+L276: .string "bya"
+L277: rts
+L278: jsr *r6
+sub *r2, L88
+L279: red L199
+L280: .string "w"
+bne L269
+dec L228
+red r5
+stop
+; comment
+L281: red L38
+L282: cmp #-181, #113
+L283: .string "hidxfcxbhifp"
+lea L243, r0
+jsr *r5
+
+bne L259
+stop
+dec r4
+L284: .string "uorpnhfxxive"
+mov *r6, r7
+L285: .data 492, -314, -271, 504, -528
+L286: not *r6
+L287: dec r1
+dec *r2
+L288: inc *r3
+L289: inc r3
+jmp *r6
+add r4, *r3
+cmp L194, L14
+not *r7
+; comment
+add #-146, r1
+sub *r0, L240
+lea L91, r4
+rts
+mov #-243, *r5
+not *r2
+rts
+rts
+L290: red r1
+clr L23
+lea L96, L257
+mov L253, r1
+L291: .data -335, -115, -901, -656
+prn L31
+mov r6, r6
+mov L110, *r6
+L292: cmp #-108, #-130
+inc *r2
+L293: stop
+jmp *r3
+L294: .string "djdpdlpuwwrmmmqwytfsoqnu"
+L295: red L122
+red *r4
+prn *r2
+jsr *r6
+L296: inc L72
+L297: .string "xtxkuzdxfj"
+L298: mov L262, r2
+sub #1, L291
+L299: .data 778, 749, 667, 393, -157, -935
+L300: mov L102, *r6
+clr *r7
+clr r7
+jmp *r4
+inc r6
+jsr *r2
+jmp *r6
+mov *r2, r2
+jsr *r6
+mov L240, *r7
+red r0
+lea L104, *r1
+sub r0, *r3
+prn *r0
+jmp *r1
+jsr *r1
+L301: clr *r7
+L302: .data -764, 205
+mov #134, L157
+L303: .string "jxwtajcdtohrz"
+L304: lea L209, *r2
+L305: .string "cqq"
+mov L65, *r5
+mov *r3, *r6
+cmp *r7, #131
+rts
+dec r4
+inc r1
+jsr *r0
+lea L301, r4
+L306: jsr L157
+stop
+mov r0, r5
+prn L20
+sub r2, *r7
+prn #166
+L307: .string "rmqbdhdq"
+L308: stop
+stop
+L309: rts
+rts
+stop
+sub r2, r7
+jsr L206
+prn r7
+lea L186, *r6
+stop
+L310: rts
+
+cmp L74, L228
+L311: .data -726, -241, 799, 678, 207, 123, 87, 396
+bne L232
+not r3
+not L88
+red r2
+L312: stop
+L313: .string "kbprogqml"
+cmp *r7, *r0
+L314: red L134
+L315: .string "onjtxitizrefabivojja"
+L316: .data -786, 889, 658
+cmp L315, #98
+rts
+mov #-188, *r3
+inc L214
+red *r5
+L317: lea L124, r7
+L318: mov L159, L63
+L319: bne *r5
+add r6, *r0
+; comment
+inc L98
+prn *r2
+jmp L284
+L320: jmp *r6
+L321: inc r2
+stop
+stop
+sub r0, *r7
+L322: .data 245, 479, -201
+prn #35
+L323: clr *r1
+jsr *r6
+L324: cmp #-125, r5
+stop
+L325: stop
+dec r3
+bne *r6
+inc r3
+L326: .data -65, 953, 445, 92, 329
+L327: .data -78, -159, -184, 261
+L328: jsr L281
+clr *r3
+stop
+L329: red r1
+clr *r7
+dec *r3
+clr *r3
+L330: stop
+cmp *r6, L206
+add *r1, r1
+bne L328
+
+jsr *r3
+jsr L249
+L331: rts
+red *r4
+jmp L170
+L332: stop
+mov *r1, r7
+L333: bne *r2
+
+; comment
+jmp *r2
+cmp L44, #222
+L334: bne *r6
+not r2
+mov r2, r3
+L335: add #-198, L204
+add r2, r7
+stop
+inc L118
+L336: red L235
+mov *r7, L67
+not r2
+sub #154, L140
+lea L185, r1
+jsr *r6
+L337: dec *r4
+L338: .string "asdmqxjxsdngdaioqhcfkwg"
+dec *r1
+rts
+jmp *r5
+dec *r4
+sub L336, L162
+stop
+L339: add L255, r0
+stop
+L340: .string "dwthrmkxbhnlxagazccsfbb"
+cmp r7, L14
+L341: .data -607, -928, 12, 824, -140, -667
+red L131
+jmp L163
+not *r5
+
+sub #76, L255
+cmp L338, #33
+L342: .data -143, -55, -637, 312, -798
+L343: red L207
+mov L298, r1
+cmp r4, #228
+rts
+L344: .string "xbxafvdjoqzr"
+bne L146
+not *r3
+not L5
+dec r1
+jmp L130
+dec L24
+rts
+prn *r7
+L345: prn *r6
+dec L158
+L346: lea L28, *r1
+clr *r6
+add *r4, r1
+stop
@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 38
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+L0: .string "ecpklftkwsooqz"
+mov L0, L0
+L1: .string "xmecmpuoygzjzwvrea"
+inc *r1
+lea L1, L0
+dec *r4
+L2: .data 772, -858, -880, -258, 76, 697, -168, -360
+inc r7
+not *r4
+cmp #-167, #20
+L3: .string "pwclmizmszq"
+stop
+bne L0
+L4: dec r2
+red r6
+L5: bne L0
+rts
+bne L5
+red r0
+dec *r5
+L6: .string "ybkvbozqiuoeozq"
+not r0
+clr r1
+L7: dec r5
+L8: .data -548, 231, 47, 940, -513, -532, 578, 947
+L9: add *r4, *r6
+not r2
+L10: .string "o"
+jsr L10
+jmp L4
+jmp *r6
+mov r1, L8
+inc L3
+red L7
+L11: lea L7, r4
+add #191, r3
+L12: clr r7
+L13: add #248, *r3
+add *r7, L11
+
+stop
+bne L1
+; comment
+bne L7
+bne *r7
+jsr L13
+add r0, L12
+prn *r2
+L14: inc r0
+L15: red r3
+prn r2
+L16: prn #57
+L17: .string "vdvajtkrlbhqhl"
+mov #115, *r2
+; comment
+add *r2, *r0
+not *r3
+L18: jmp *r7
+jmp L16
+L19: dec L13
+prn L17
+L20: stop
+mov #-112, L5
+jmp *r5
+L21: lea L14, *r3
+; comment
+L22: add #56, L0
+rts
+rts
+L23: not r7
+L24: jsr *r7
+jsr *r1
+add L22, r1
+bne L13
+dec L6
+stop
+sub L5, r5
+red r4
+rts
+add #168, L15
+L25: add r2, *r2
+cmp r1, *r4
+L26: not *r3
+L27: clr r0
+dec L20
+rts
+L28: not L9
+sub #14, *r6
+L29: stop
+rts
+L30: dec *r2
+L31: clr L8
+
+L32: sub r2, r6
+L33: jsr *r4
+add #154, L26
+L34: .data -694, 894, -734, -422, 424, 49, 857, -42
+jmp L13
+lea L6, *r4
+inc L23
+L35: red *r6
+lea L9, L30
+mov r0, *r0
+bne *r5
+L36: red L26
+rts
+L37: .string "fglttspz"
+inc *r6
+L38: rts
+L39: clr *r3
+rts
+
+L40: .string "lnamiievgopkdkxouegemd"
+L41: prn #-123
+not r3
+L42: prn L26
+L43: jmp L25
+L44: inc *r0
+L45: bne *r4
+jsr *r4
+lea L20, *r7
+inc L4
+L46: cmp *r5, L25
+jsr L21
+prn *r4
+jsr L34
+lea L27, L6
+rts
+L47: add #-176, r3
+inc *r3
+L48: .data -94, 954, 203
+cmp L28, #-235
+L49: mov L35, *r0
+clr r1
+mov *r7, *r6
+L50: stop
+mov *r7, L24
+sub *r1, r2
+L51: bne *r5
+L52: .string "e"
+not *r3
+L53: sub #63, L28
+stop
+add r3, L19
+L54: rts
+cmp L45, r5
+inc L23
+dec r2
+L55: prn L41
+L56: clr L51
+jmp *r3
+L57: not r6
+L58: stop
+dec r6
+clr r7
+L59: cmp #-29, r3
+jsr L34
+; comment
+L60: stop
+red r3
+stop
+L61: mov L31, r6
+bne L0
+prn r1
+not *r6
+L62: not *r6
+bne L3
+dec r5
+L63: jsr L40
+L64: inc r4
+jsr *r4
+L65: .string "lhajlhay"
+jmp *r5
+mov *r1, r7
+rts
+inc *r2
+sub #-32, r1
+mov *r3, L59
+jmp L4
+inc *r4
+red r2
+L66: stop
+; comment
+prn r5
+L67: clr *r6
+clr *r5
+red r2
+sub L46, r1
+L68: clr L28
+; comment
+inc *r3
+jmp *r7
+clr *r6
+dec L18
+not r5
+rts
+L69: dec r7
+jsr *r0
+L70: jsr *r2
+dec L42
+L71: jsr *r2
+cmp L22, #-121
+sub r4, r0
+inc *r0
+lea L20, L5
+L72: add #180, *r0
+L73: .data 688, 920, 846, 516
+L74: .data -71, -44, -14
+L75: lea L2, L61
+L76: stop
+cmp *r5, #131
+L77: .data 144, -186, -779
+add L72, r3
+L78: .data 730, -738, 501, 802
+L79: red *r2
+; comment
+red r7
+L80: dec r7
+dec *r4
+L81: inc *r7
+L82: not r1
+prn L75
+cmp r0, r7
+not L42
+L83: prn *r1
+L84: .data 141, 339, -915, -327, 245, -981, 405
+prn *r5
+red L48
+L85: .string "hoondaux"
+L86: rts
+stop
+L87: .string "jbut"
+inc L32
+L88: inc r7
+clr L33
+L89: mov L61, r0
+lea L71, L89
+clr L2
+clr *r4
+L90: inc L85
+L91: add r3, L43
+red *r7
+prn L22
+bne *r0
+inc L49
+lea L7, r4
+clr *r2
+inc r6
+inc *r6
+L92: .data 958, 238, 587
+; comment
+lea L37, L82
+
+L93: prn r1
+stop
+prn #-156
+L94: not r6
+L95: inc L26
+red L67
+bne L12
+not *r4
+
+bne L85
+jmp L46
+clr *r6
+rts
+L96: add L9, *r0
+red L85
+add L79, r4
+dec r7
+jsr *r5
+rts
+bne L12
+L97: mov L75, *r3
+stop
+dec r6
+clr r7
+L98: mov r5, L38
+dec r3
+add L89, L6
+L99: cmp *r2, *r2
+add #134, L20
+L100: prn #190
+; comment
+L101: mov *r5, r4
+lea L34, L68
+L102: .data 975, 302, 330, -91, -327, 853
+L103: .string "bjg"
+L104: stop
+L105: prn r4
+L106: .string "agkitooyasctpwkirdvroyf"
+cmp r4, r1
+dec L8
+inc L42
+add #-151, r6
+L107: lea L6, r3
+cmp *r3, #243
+L108: bne L86
+cmp #63, *r3
+L109: .data 515, 178, 958, -249, -624, -75, 907
+add *r6, *r7
+inc r2
+add *r6, *r5
+clr L14
+L110: cmp r4, *r2
+inc r7
+jmp *r2
+cmp *r2, *r7
+bne L90
+L111: mov #-238, r0
+jmp *r0
+not r7
+inc L54
+dec r0
+sub L53, *r1
+rts
+L112: bne *r4
+red L83
+jsr L111
+
+red L27
+L113: .string "fqhsvksnhrumof"
+L114: .data -719, 354, -890, -321, -644, 154
+L115: jsr L77
+mov *r0, r2
+L116: .string "dlsfvmtazprpuizskypfewu"
+not *r0
+L117: .data -614, -267, 134, 554, 868, 716
+jmp L28
+clr *r4
+jsr *r2
+red r5
+L118: rts
+lea L64, r1
+jmp *r2
+stop
+lea L31, *r2
+dec r5
+jmp L13
+L119: .data 346, -825, 394, -389
+mov L53, L56
+clr L92
+jsr L37
+jmp *r6
+; comment
+L120: inc L5
+sub L40, r3
+L121: .data 422, 916, 249, -115, 331, 975
+L122: jsr L77
+dec r4
+L123: jsr *r7
+
+L124: add r7, r0
+jmp *r1
+mov L92, *r4
+bne *r6
+sub r3, L41
+bne *r0
+L125: .data 214, -807, -433
+; comment
+sub r2, L82
+
+red L54
+L126: lea L25, r7
+cmp r0, L68
+sub #192, *r6
+prn #-80
+clr L94
+bne L16
+jsr L103
+sub *r0, *r7
+bne L29
+jsr L104
+sub #-103, *r3
+clr *r6
+inc *r4
+cmp *r7, *r1
+lea L64, *r3
+bne *r1
+cmp r0, *r3
+L127: .data -260, 427
+lea L107, *r1
+stop
+L128: red *r2
+L129: prn r4
+cmp #206, #44
+sub r2, r1
+jsr *r5
+cmp r7, r5
+L130: .data -134, 217
+sub *r4, L88
+L131: .data 718, -741, 511, -291, -808
+L132: mov #-17, L91
+L133: .string "uhnu"
+not *r3
+L134: sub L50, *r1
+rts
+stop
+clr L53
+L135: clr *r1
+stop
+jsr *r0
+red L17
+prn r6
+L136: bne L122
+L137: rts
+rts
+L138: bne L11
+red L20
+L139: clr L104
+; comment
+rts
+L140: jmp L40
+L141: red *r5
+add *r3, r5
+L142: cmp #98, *r1
+prn L133
+L143: add #45, r3
+L144: mov *r4, *r7
+L145: .data -196, 778, -692, 331, 19, -707, 829, -376
+L146: .string "bngxmuulioyzyohzlmbx"
+bne *r0
+bne L4
+stop
+L147: .data 362, -453, 882
+cmp #53, #180
+add *r0, r0
+L148: .data 223, -661
+mov r2, r0
+jmp *r6
+inc r5
+dec *r2
+L149: .data 659, 629, 34, -998, -366, 707, 817, -256
+stop
+L150: sub r1, r3
+bne *r7
+L151: dec L137
+L152: sub L111, L101
+add #-126, r2
+jmp *r6
+L153: cmp #99, #-180
+add L119, *r1
+L154: cmp #-21, L111
+
+L155: .data -163, 82, 966, -213, 880, -717, -689
+add r6, *r0
+clr *r7
+clr *r0
+cmp #-231, *r3
+L156: mov L19, r1
+L157: .string "ze"
+inc L3
+clr *r3
+cmp L79, L137
+cmp *r2, r7
+red L46
+stop
+stop
+L158: clr *r7
+L159: stop
+stop
+sub *r0, L143
+bne *r1
+jsr *r3
+L160: lea L128, *r6
+not r3
+red *r3
+L161: cmp L5, *r2
+L162: red r2
+L163: bne L132
+cmp #-93, r7
+L164: rts
+rts
+stop
+add *r2, r4
+L165: .data -132, 454, 16, 885, -367, 21, 664
+L166: .data 778
+lea L13, r0
+sub *r0, L41
+L167: stop
+L168: add #-172, L93
+L169: not *r4
+jsr L115
+; comment
+L170: .string "encoqffoxsv"
+L171: .data -493, 169, -78, 12, -659, 759, 249, 764
+rts
+bne *r2
+L172: rts
+
+
+L173: lea L101, L122
+L174: prn L153
+prn r7
+prn L166
+lea L170, *r7
+L175: dec *r5
+prn *r5
+L176: rts
+sub L75, *r2
+rts
+clr L123
+clr *r7
+cmp r5, r0
+add #200, *r6
+L177: not L129
+stop
+cmp #172, L55
+jmp *r3
+red L175
+not r5
+L178: sub r3, r3
+inc r0
+L179: jsr L40
+L180: stop
+L181: prn L72
+L182: .data -840, 927, 578, -487, 210, -889, 117
+bne L164
+L183: .string "hbvcvchwztmhzmjcolt"
+inc r1
+rts
+stop
+inc r0
+red L160
+jsr L37
+L184: .data 223, 968, 904, -31, -991, -36, 271
+rts
+L185: .data -129, 852, 366, 307, 465, 988, -603, 248
+prn *r0
+L186: .string "biivmktysjajxwewfowt"
+cmp #-234, *r7
+L187: prn r5
+mov L22, *r7
+dec *r2
+L188: sub *r6, r1
+sub r4, L74
+L189: mov *r0, *r3
+L190: jmp *r1
+red *r4
+mov r5, L135
+L191: mov #-93, *r7
+stop
+bne L11
+jsr *r7
+dec *r7
+red *r6
+rts
+L192: .data 582, -586, 294, 714, 643, 530, 907, -210
+
+lea L102, L20
+jmp L162
+add *r3, *r1
+not *r2
+L193: .string "dubbnkrfanwhzeeytm"
+L194: stop
+prn r6
+
+cmp *r7, #-124
+inc r7
+L195: not L4
+stop
+stop
+jmp *r1
+L196: dec r0
+L197: add r7, r5
+L198: rts
+L199: dec L4
+not L67
+L200: dec r2
+L201: bne L115
+L202: jsr L108
+L203: rts
+inc *r5
+dec r0
+clr r2
+stop
+sub *r0, *r4
+stop
+L204: not *r1
+prn L128
+stop
+stop
+L205: red *r2
+inc *r2
+prn #168
+sub L64, *r5
+L206: cmp #-74, r5
+bne *r3
+bne L40
+L207: .string "bkqxqgt"
+mov L96, r7
+sub *r1, *r4
+jmp L111
+L208: rts
+jmp L13
+sub #154, *r0
+dec L106
+
+stop
+
+L209: .string "erlgqfxjaqhjyuinhvmbnimv"
+rts
+dec *r5
+L210: lea L161, r1
+L211: .data -897, -923, -767, 263, -17, -405
+dec *r1
+jmp L18
+L212: .data -170, -286, 279, 483, 783
+L213: mov r6, L75
+add r6, r7
+L214: .string "qxseaemmrtbko"
+stop
+L215: bne *r0
+jsr *r6
+sub r3, *r1
+L216: red L196
+L217: dec r5
+not r0
+prn *r4
+prn L29
+jsr *r2
+stop
+add #132, L24
+red r5
+L218: stop
+L219: stop
+L220: clr L132
+L221: .string "dzgjaphcgf"
+bne *r4
+L222: not r2
+L223: clr L60
+L224: bne *r1
+L225: jmp *r1
+red r5
+cmp L14, r2
+L226: prn *r7
+lea L9, *r0
+inc L63
+stop
+cmp L226, r7
+bne *r2
+L227: lea L187, L106
+stop
+L228: mov L2, L34
+inc r2
+sub r4, r0
+L229: .string "vkbhqcwqvomdjimv"
+L230: prn r1
+clr r0
+L231: not *r6
+L232: bne *r2
+bne L61
+bne L163
+; comment
+; comment
+L233: dec L142
+bne *r0
+L234: prn *r1
+mov L143, L73
+L235: mov L201, *r1
+L236: red L57
+not L231
+stop
+L237: add r4, L5
+L238: .string "vhpgtwutrqvuirjqdlavkva"
+L239: jsr L56
+
+L240: .string "cwnaxfrwobzfaapcslnavvt"
+jmp *r7
+jmp *r4
+L241: dec r1
+L242: .string "tgqlisnwpxfsrxgfyvje"
+L243: lea L36, *r6
+inc L147
+not *r1
+L244: inc r0
+L245: .data 199, -864, 262, -91, 73, 81
+red r6
+mov #104, *r7
+red L138
+jsr L95
+L246: red *r1
+inc r4
+mov *r7, *r5
+L247: clr r0
+L248: add #229, r5
+L249: lea L23, L52
+lea L18, L138
+clr r7
+cmp L209, #36
+; comment
+lea L126, *r1
+cmp L82, r5
+inc r7
+add r4, r5
+add r1, *r2
+not r7
+lea L113, L116
+
+prn #-53
+dec *r5
+red r0
+add *r1, L39
+L250: lea L225, L226
+jmp *r0
+red *r5
+inc r1
+L251: prn r2
+lea L25, r5
+jmp L66
+dec r7
+clr L203
+rts
+L252: clr L251
+L253: inc r2
+sub #215, *r5
+mov #213, r4
+L254: .data -753, 643, 258, 10, -357, -972, -998
+L255: add r1, L89
+L256: .data -330, -25, -202, 415, -80, 685, 106
+prn *r1
+L257: inc *r0
+L258: .data 362, 68, 250, 310, -250
+L259: sub #53, r5
+rts
+L260: jsr L255
+clr *r6
+L261: .string "yvrebhfan"
+add r5, *r3
+L262: jsr L86
+stop
+L263: jsr L20
+mov r7, *r7
+red *r2
+add L12, r5
+clr r3
+L264: .string "dczoxfipmndoxxxcokqwuw"
+not r6
+not r5
+mov L178, L14
+L265: stop
+L266: lea L253, L199
+red *r4
+L267: stop
+lea L14, *r0
+L268: mov #10, r2
+L269: add L188, *r1
+L270: dec *r4
+rts
+red L41
+dec r3
+L271: lea L122, *r4
+L272: prn *r1
+L273: dec *r3
+red r1
+L274: .data -291
+L275: jsr *r7
+mov r6, r3
+L276: jmp *r4
+jmp L77
+jsr *r2
+stop
+not r2
+mov L160, L46
+L277: .string "jkhflmhg"
+clr *r7
+L278: .string "ojqvqqqxuuafppia"
+add r5, L145
+
+prn *r2
+rts
+add r6, r7
+lea L146, L131
+dec L53
+jmp *r6
+prn L188
+L279: dec *r6
+L280: inc L237
+cmp r5, *r7
+add #-175, *r4
+inc L206
+inc L128
+sub *r6, *r7
+sub #-54, r0
+bne L222
+lea L43, *r6
+L281: red L48
+L282: .data 980, -227, -613
+add #164, L5
+not *r7
+prn *r4
+stop
+L283: .data 568
+not *r3
+L284: cmp #204, #-234
+L285: jmp L280
+inc r1
+clr L195
+L286: .string "zehjsfbdjz"
+lea L204, L67
+dec L111
+jmp *r0
+bne L284
+clr *r6
+red r6
+bne L127
+L287: rts
+L288: add L77, L76
+L289: mov #26, L255
+clr L174
+rts
+L290: not L197
+dec L129
+L291: cmp L175, *r1
+sub #16, *r1
+red r7
+not r7
+rts
+clr r3
+; comment
+mov r2, r0
+sub *r3, L104
+sub L4, *r2
+L292: sub r4, r7
+add *r5, r3
+add #-84, L204
+add L131, r3
+clr *r6
+
+L293: .data 490, -628
+mov #80, r4
+stop
+lea L126, L71
+cmp L137, #-62
+inc L259
+cmp r0, *r5
+L294: .data -835, -958, -820, -959, 94, -905
+L295: sub L217, r7
+sub L254, r7
+L296: stop
+rts
+jmp L145
+L297: bne *r5
+add L109, L23
+red *r4
+inc L281
+jmp *r4
+L298: .data -198, -914, -404
+L299: .data 810, 893, -264, 748
+not L133
+stop
+L300: jsr *r5
+L301: .string "aoqajrpurgjiimq"
+jsr *r1
+add L130, L91
+L302: sub r1, *r7
+add *r5, L12
+stop
+bne L63
+L303: add L292, r0
+L304: .string "hli"
+inc L144
+sub #113, *r3
+L305: .string "qvfmwqqxckkyhb"
+inc r6
+cmp *r4, L229
+L306: clr *r3
+
+L307: bne L96
+cmp #-161, r2
+jmp L151
+L308: .string "wjcbdgm"
+L309: stop
+mov r0, r7
+red r3
+clr r3
+L310: add r1, L145
+lea L259, L157
+mov #-202, r3
+L311: bne *r2
+add *r2, *r3
+L312: rts
+clr r4
+jmp L90
+L313: red r0
+mov #-141, L27
+bne L44
+add r2, *r4
+L314: rts
+L315: lea L91, r7
+L316: lea L34, r3
+L317: .data -807, 980, -657, -323, 485, 290, -739
+L318: jmp L69
+sub #-158, r6
+L319: inc *r3
+clr L269
+not L55
+
+red *r2
+L320: mov L89, L97
+lea L73, L69
+prn r0
+L321: .string "fmaxabmpwhpvkebrn"
+L322: red r5
+L323: lea L258, L260
+L324: jmp L123
+prn *r3
+; comment
+L325: jsr *r1
+dec r3
+L326: add L286, *r7
+bne L295
+L327: add #26, r5
+lea L108, r6
+rts
+mov L325, r7
+L328: jsr L265
+mov #239, r0
+sub r7, r0
+rts
+L329: clr *r2
+cmp *r6, *r7
+L330: not L3
+add #31, r3
+L331: sub #-25, L32
+red r4
+bne L253
+L332: sub #-65, r1
+L333: .string "dtmdyxgfpsmcgamlswmef"
+mov L53, L235
+L334: .string "ezjlolwmonyfzdrhhgnkovzx"
+bne *r6
+L335: dec L279
+L336: rts
+L337: inc L295
+prn *r5
+mov L162, *r7
+L338: inc *r1
+inc *r2
+bne *r5
+bne L186
+L339: .data -810, 725, -221, -187, 816, 268, -501, 213
+L340: cmp *r3, L313
+dec *r4
+L341: stop
+dec *r2
+L342: sub *r4, *r2
+L343: clr L281
+not *r4
+L344: .string "msllkjxqpq"
+not L115
+L345: .data -790
+L346: .string "lubhetu"
+L347: clr r7
+bne L281
+L348: inc r7
+; comment
+prn #-80
+not *r4
+L349: red L224
+L350: lea L178, r7
+bne L310
+bne *r6
+mov r7, L39
+red *r3
+cmp L233, L89
+L351: .data -279, -563, 91, 147, -680, -211, 609
+not r6
+L352: add #-137, r6
+clr r1
+clr r6
+
+cmp *r1, r2
+add *r7, r4
+lea L32, L9
+L353: bne *r0
+bne *r6
+add *r3, r6
+L354: inc r7
+stop
+inc *r0
+jmp L126
+red *r7
+L355: dec L276
+stop
+
+dec L237
+add L18, r1
+L356: bne L65
+L357: lea L203, r2
+not L21
+
+lea L260, *r6
+L358: stop
+; comment
+L359: stop
+red r5
+jmp L228
+cmp r1, #-23
+rts
+stop
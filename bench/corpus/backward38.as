@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 39
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: bne *r6
+red r7
+mov *r1, r5
+not L0
+mov r7, L0
+add *r6, L0
+prn r2
+bne *r3
+lea L0, L0
+add *r6, *r0
+rts
+stop
+dec r6
+L1: add r7, r0
+L2: dec r3
+cmp *r0, L1
+stop
+jsr L1
+add r6, *r4
+L3: inc r3
+L4: prn #2
+add #-17, *r5
+L5: mov L4, *r2
+clr L5
+mov #-45, *r2
+stop
+bne L0
+bne L2
+bne L2
+clr *r3
+; comment
+cmp *r5, r1
+add *r7, *r1
+stop
+clr *r1
+stop
+dec r6
+lea L4, L5
+L6: .string "q"
+L7: mov #247, *r6
+jmp L3
+stop
+rts
+L8: stop
+not r3
+inc L2
+bne L2
+L9: lea L1, r4
+jsr *r7
+inc L9
+L10: .data 833, -14, -145, 251, 666
+L11: clr L4
+red *r0
+prn #77
+rts
+L12: lea L4, r6
+L13: add r1, r5
+red r7
+L14: .data -406, -466, 250, 561, -994
+mov r7, *r7
+L15: bne L15
+add #-20, r3
+L16: .string "acysaapgdekjpeelb"
+L17: add L8, L15
+cmp L13, *r3
+L18: not r7
+L19: rts
+inc r7
+L20: lea L20, *r0
+L21: not r3
+not *r5
+
+L22: sub *r4, r2
+sub *r3, r5
+L23: rts
+L24: mov r7, *r0
+bne *r4
+jsr L23
+lea L9, r3
+add #151, *r6
+clr L4
+rts
+lea L0, *r0
+L25: stop
+L26: mov #217, r2
+lea L7, r4
+cmp L10, r3
+mov *r3, *r2
+L27: add #-115, L18
+bne L6
+sub r5, r3
+stop
+mov #-91, L4
+L28: rts
+prn L19
+cmp r1, r7
+L29: .string "fozukjgbwrskh"
+rts
+rts
+inc r7
+add L5, r3
+sub #63, *r4
+L30: red L20
+mov L29, r5
+inc r5
+jsr *r5
+lea L22, *r2
+stop
+red r2
+L31: cmp r3, *r5
+dec r1
+L32: lea L5, L20
+L33: bne *r4
+prn r1
+inc L19
+jsr L24
+L34: .string "xwee"
+lea L12, r1
+L35: .data -775, 676, -123, -100, -742
+mov #217, r1
+L36: lea L20, *r7
+L37: lea L18, *r0
+dec L30
+jmp *r2
+L38: rts
+prn #86
+bne L26
+; comment
+add L23, *r3
+inc *r7
+prn L26
+bne L19
+lea L17, r6
+; comment
+rts
+L39: .string "ffbrdqhmq"
+jsr *r0
+L40: mov L27, *r5
+clr L6
+rts
+L41: add r1, *r7
+L42: cmp #-93, *r0
+L43: .string "ovbrdtmgczhsafaa"
+dec r6
+clr L26
+mov #-7, L37
+add L16, *r4
+prn *r4
+L44: .string "scqeufmqniizzinr"
+not r2
+not L0
+L45: inc r1
+red L6
+L46: inc r1
+L47: cmp L46, r2
+red L43
+cmp r7, #25
+L48: add r7, *r1
+mov L48, *r2
+L49: rts
+clr L41
+L50: sub L20, *r0
+cmp r6, r1
+; comment
+mov #70, r3
+stop
+L51: .string "kygbuvjqbkmzeuuknnabl"
+rts
+jsr *r4
+L52: .data -315, 453, -440, -121, -794, -392, 702, 298
+cmp r1, L52
+stop
+red *r3
+red r5
+lea L33, r5
+dec L27
+L53: .data 860, -393, 8, 341, -732, -77, 867, 525
+L54: prn *r7
+clr *r3
+jsr *r1
+mov *r1, L42
+L55: inc L30
+L56: mov #6, *r7
+dec *r4
+jmp *r2
+L57: dec r2
+jsr *r0
+L58: rts
+lea L51, r2
+mov L12, r7
+cmp #-184, #148
+rts
+prn #-188
+cmp r5, L18
+jsr L15
+prn L19
+prn #-26
+cmp L4, #-204
+lea L55, L44
+add r7, r6
+inc *r1
+L59: dec L54
+L60: not L60
+inc r3
+L61: sub r0, *r3
+inc L41
+rts
+jmp L25
+clr r2
+not *r2
+cmp r5, L49
+L62: dec r4
+stop
+L63: red r1
+red r3
+dec L46
+
+L64: jmp L12
+L65: sub #46, r4
+L66: .string "kfpcxly"
+stop
+jsr L2
+stop
+L67: .string "msppozhedixuisuruelbqkl"
+L68: jsr L1
+prn L42
+not *r7
+jsr L37
+rts
+L69: red L50
+jsr L67
+red *r5
+
+clr r6
+lea L69, r0
+L70: red L17
+prn r2
+inc r3
+L71: prn #30
+L72: sub r3, r2
+L73: .string "mlzqkuqdchrlqogtomvxpv"
+red r1
+lea L20, L14
+mov L11, *r2
+rts
+cmp #-215, L5
+sub #-78, r0
+L74: sub L21, L2
+L75: bne *r4
+cmp #43, #-22
+jsr *r5
+L76: mov L73, *r3
+L77: red r4
+prn #-159
+not *r5
+not r6
+L78: add #-123, *r2
+rts
+dec *r6
+jmp *r2
+lea L0, L33
+L79: sub #-238, L20
+mov r2, r3
+red *r0
+L80: rts
+dec *r5
+stop
+inc r7
+red r4
+L81: .string "ertamjdlmicptogktjmztxuz"
+L82: prn #-27
+L83: prn #-7
+L84: stop
+dec *r2
+not L39
+rts
+L85: .string "c"
+bne *r2
+L86: jmp *r6
+L87: .data -423
+bne L24
+not r5
+bne *r7
+stop
+L88: not *r7
+; comment
+L89: clr r5
+L90: mov r1, L51
+L91: prn #9
+L92: not *r0
+L93: lea L61, L11
+mov *r2, *r6
+stop
+L94: sub r7, *r3
+not *r6
+stop
+inc *r4
+clr r6
+cmp #97, #-166
+L95: .data -828, -467, 876, 179
+prn r1
+add L37, L14
+dec r4
+jsr L80
+sub L64, L39
+jmp *r7
+bne *r7
+bne L38
+cmp #179, *r6
+L96: not *r2
+inc r3
+not L66
+rts
+L97: bne L80
+L98: dec r0
+red r4
+L99: sub #4, L55
+add #-32, L52
+L100: red L29
+not L17
+lea L0, *r7
+mov L30, r7
+
+inc r0
+not *r1
+L101: mov *r4, L49
+L102: jsr L74
+L103: add #15, r7
+jmp *r6
+jsr L89
+stop
+lea L20, *r0
+prn #26
+prn L62
+L104: sub *r5, *r1
+L105: rts
+L106: .data 582, -354, 126
+stop
+L107: prn *r5
+not L59
+mov L6, *r1
+L108: clr L89
+L109: not L15
+inc L44
+L110: sub #79, r3
+L111: add r4, *r5
+; comment
+rts
+stop
+sub r4, *r5
+; comment
+mov *r4, *r3
+
+L112: jsr L93
+cmp #97, L15
+bne *r0
+L113: not *r7
+jsr L70
+mov r6, r2
+dec L59
+L114: bne L3
+sub L26, *r2
+red r3
+L115: dec r0
+lea L46, *r1
+jsr L65
+not *r6
+red r1
+clr r5
+jsr L50
+sub r1, r2
+jsr *r4
+red r3
+L116: jsr L69
+mov #165, L2
+prn L8
+jmp *r2
+rts
+inc *r3
+inc L70
+stop
+
+prn r2
+not *r1
+add r6, *r5
+red L113
+L117: jmp L29
+L118: lea L17, L2
+L119: dec r5
+L120: not L87
+jsr L86
+L121: sub r5, r3
+L122: add *r7, r0
+red L87
+mov #-104, L82
+; comment
+bne *r4
+add *r1, r5
+; comment
+rts
+clr r6
+inc r6
+cmp #-194, *r7
+L123: dec r6
+clr r0
+L124: dec *r7
+clr L58
+dec r6
+red L86
+L125: mov *r3, *r6
+lea L97, *r2
+lea L57, r4
+jmp *r3
+; comment
+cmp #68, #-170
+
+bne *r4
+jsr *r7
+L126: add r1, r4
+L127: .string "kjyjvfgzukyqmxejeddgv"
+cmp *r0, L22
+sub *r4, L119
+prn L85
+L128: .string "nirqbswclnnifevwxaacnyrp"
+L129: cmp L83, *r4
+prn L68
+mov #46, r1
+L130: dec L10
+add *r7, *r1
+L131: stop
+inc L38
+rts
+L132: clr *r4
+bne *r7
+sub *r0, r0
+stop
+L133: .data 385, -158, -387, -454, 347, -854, 323
+L134: jmp *r2
+L135: mov #-95, *r4
+L136: dec *r3
+L137: .string "rpyorybiewfjzthfnxy"
+L138: .data -237, -695, 420, 827, -721, -246
+add L121, L109
+add *r5, r5
+inc r3
+lea L45, L43
+jsr L106
+mov #-76, *r4
+L139: cmp *r5, *r5
+clr L91
+red *r7
+L140: clr L129
+L141: jmp *r6
+L142: cmp L120, #-225
+L143: not *r4
+jsr *r7
+prn r0
+L144: prn #-125
+lea L129, *r3
+L145: mov *r4, r1
+L146: sub #40, *r2
+L147: jsr L135
+L148: .data -35, -422, 115, 784, 139, -967, -824, 101
+prn L28
+jsr L3
+red L18
+cmp #-220, L78
+dec L93
+L149: clr *r6
+lea L43, L71
+add *r4, L78
+L150: red r5
+mov L47, *r4
+prn #244
+L151: .data -82, -695, -246, -657, 277
+L152: cmp #172, #-32
+cmp #-212, r3
+; comment
+L153: .string "cydlgiqvbwsmeeadwsrl"
+L154: .data -540, -891, 963, -226
+stop
+mov r5, *r2
+prn L23
+clr *r3
+cmp L135, #28
+cmp #-201, L114
+L155: prn L23
+jsr *r5
+red r4
+lea L22, *r6
+L156: prn *r2
+clr r5
+lea L114, L15
+red r4
+L157: .string "yxadgdpuvy"
+red r1
+jsr *r6
+; comment
+add *r2, r1
+L158: .string "pjuwiq"
+dec r6
+L159: cmp r5, r7
+L160: red *r5
+prn L29
+L161: dec r2
+sub *r5, r7
+red r2
+L162: lea L135, *r7
+; comment
+sub *r1, *r3
+L163: add r2, L35
+mov r7, r2
+L164: not *r3
+L165: lea L0, *r3
+L166: sub *r4, L42
+L167: .data 420, -234
+L168: .data -950, 883, -225, -209, 793, -499
+inc r0
+red r2
+; comment
+L169: .string "iyiyzx"
+cmp *r5, #22
+
+L170: clr L50
+; comment
+prn *r5
+lea L13, *r5
+red *r6
+rts
+L171: rts
+inc r0
+L172: .data -432
+not r2
+L173: lea L60, r7
+L174: cmp *r7, *r2
+L175: stop
+rts
+L176: .string "zijvhpbcrvox"
+L177: jsr L65
+L178: stop
+rts
+L179: stop
+L180: .string "imekuxj"
+add r1, L58
+L181: lea L169, *r1
+prn L20
+L182: cmp L156, r3
+clr r4
+rts
+L183: jmp *r0
+sub *r6, r1
+not L27
+L184: not *r4
+prn L121
+red L41
+jmp *r7
+dec *r6
+cmp L157, *r0
+L185: .string "nlqxknmqqzhkzqleejrmu"
+L186: .data 785
+L187: clr r7
+prn #249
+stop
+L188: mov L158, r4
+jmp L34
+jmp L31
+; comment
+bne L76
+prn L41
+bne L120
+not r3
+L189: not *r4
+L190: .data 969
+L191: dec L176
+L192: .string "rtrevvkoxsd"
+cmp *r2, *r0
+rts
+L193: .data -299, -339, -577, 185
+bne L79
+; comment
+L194: clr r1
+L195: .string "r"
+L196: .data -633, -383
+not L21
+add #148, *r1
+L197: rts
+clr *r0
+; comment
+lea L78, r3
+bne L83
+bne L27
+L198: clr L4
+jmp *r2
+L199: clr *r3
+red L37
+L200: .data 709, -122, 700, 64, -527
+L201: prn r7
+bne L128
+mov #110, r5
+inc r1
+L202: .string "waayxxtrisytcwehzfp"
+L203: red L52
+lea L137, *r1
+jsr L157
+red *r2
+cmp *r6, #-183
+cmp r2, *r0
+jmp L84
+prn #-55
+L204: inc L195
+L205: lea L79, r5
+L206: jsr *r5
+L207: .data -120, 888, 450
+bne *r3
+mov *r7, r6
+add L148, L75
+clr L10
+L208: sub L137, *r3
+clr *r4
+L209: rts
+prn L86
+; comment
+L210: rts
+L211: jmp L99
+prn r5
+clr *r4
+rts
+inc L101
+lea L182, r4
+; comment
+; comment
+not L68
+L212: jsr L176
+L213: red r2
+L214: bne *r0
+L215: dec L150
+L216: red L152
+L217: jmp *r3
+stop
+bne L212
+mov r2, *r1
+L218: jsr L65
+add *r7, *r1
+jmp *r4
+
+; comment
+L219: lea L152, L64
+L220: rts
+mov *r3, r0
+L221: stop
+dec L123
+L222: dec r1
+rts
+sub L195, L86
+inc L22
+L223: jmp *r0
+L224: cmp *r6, #161
+bne *r5
+mov L115, r0
+jmp L56
+clr L104
+sub L8, L122
+inc *r2
+
+jsr *r0
+dec r2
+L225: .string "htaykmvhchovvfrpylsqyyf"
+prn *r2
+stop
+add L17, L134
+L226: .data 260, -884, -784
+jmp *r5
+clr *r6
+L227: add *r5, L183
+; comment
+sub r1, L57
+dec *r2
+; comment
+add *r7, r4
+L228: .string "qavjxhllsukfylkkqylau"
+sub *r1, L181
+stop
+L229: jmp L65
+stop
+stop
+rts
+L230: lea L209, r2
+L231: inc r3
+clr r5
+rts
+jsr L62
+cmp #-180, L231
+L232: bne L118
+L233: clr *r3
+rts
+rts
+add *r3, L91
+L234: sub *r5, *r7
+L235: .data -984, 246, -950, -70
+inc *r2
+dec r1
+rts
+jmp *r0
+lea L104, L79
+L236: .data -414, -378, -778, -961, 958, 94, 103
+L237: clr r3
+not *r1
+L238: .string "lzuytwhsxziijv"
+L239: prn r7
+lea L86, L101
+L240: prn *r7
+stop
+lea L69, r6
+clr *r0
+lea L164, L130
+stop
+L241: .string "iroi"
+dec r6
+L242: bne L173
+L243: add L212, r5
+
+bne *r5
+L244: stop
+; comment
+
+L245: .string "rblhgnjmvzzuws"
+not L197
+L246: clr r2
+cmp *r1, r5
+inc L141
+L247: clr L232
+L248: .string "fsdbfghvxnivvvegilplkn"
+bne *r2
+stop
+L249: not r5
+not L243
+add L23, *r2
+L250: rts
+rts
+sub *r1, r2
+sub r6, *r3
+clr r7
+lea L162, *r0
+jsr L59
+bne *r2
+L251: bne *r2
+L252: add r7, L182
+rts
+bne *r0
+prn L146
+dec r7
+stop
+L253: .data -75, 488, -316, 633, 910, -913, 678, -682
+jmp *r6
+stop
+L254: lea L1, L234
+mov #102, *r5
+L255: jmp *r7
+clr r1
+not *r6
+jsr L232
+L256: not L233
+jsr *r0
+L257: red r3
+L258: jmp L229
+mov #-212, L206
+sub L98, *r3
+L259: red *r2
+; comment
+L260: .data 750
+L261: cmp L39, #3
+prn #-9
+L262: inc L206
+not L180
+clr L211
+inc L254
+L263: .string "cmypbclgvs"
+sub #209, L235
+L264: dec r4
+dec *r5
+add #-228, L250
+not r1
+L265: cmp r7, L176
+L266: rts
+mov #-246, *r7
+not r3
+L267: dec r0
+inc L250
+jsr *r7
+L268: .data 174, 469, 423, 57
+not *r4
+prn L43
+stop
+bne L248
+cmp #-247, r1
+prn #80
+red L238
+stop
+L269: red r3
+dec r6
+clr *r7
+L270: rts
+not r1
+not *r3
+clr r7
+cmp L163, #122
+dec r2
+dec *r2
+prn #144
+dec *r2
+L271: jmp L12
+dec L52
+L272: .data -626, 290, 365, -989, 880, -133
+L273: inc L123
+mov L68, L75
+jsr L115
+prn r1
+L274: .string "dendzxofeuodgozfnwiab"
+dec L181
+inc L190
+bne *r0
+add #251, *r2
+; comment
+L275: .data -4, -637, -141, 939
+jmp *r5
+prn L228
+not L144
+clr *r2
+red *r0
+jmp *r6
+; comment
+L276: not r3
+L277: red r2
+L278: not r2
+stop
+bne *r1
+clr *r1
+sub L162, r4
+add r5, r1
+inc r4
+L279: stop
+L280: .data 314, 254, -967, -689, 154, -163, 739, -581
+jsr *r1
+L281: mov L116, *r4
+L282: sub *r7, r3
+clr L166
+not *r7
+L283: lea L41, r3
+sub r1, *r3
+cmp r4, L246
+not *r3
+prn *r1
+stop
+prn *r7
+lea L53, r2
+L284: .string "hudseancsbimaoxmrp"
+stop
+
+L285: add *r0, L176
+clr L107
+
+
+not r3
+add #211, r3
+prn L242
+mov *r2, r4
+rts
+L286: .data 803, 889, 580, 940, -814
+sub r6, L152
+L287: lea L83, r5
+L288: .string "pnapzveicxxkbxeya"
+dec r6
+; comment
+L289: .data -227, 849, 611, -410, 499, 311, -740
+L290: not r0
+bne L195
+red L246
+not *r3
+L291: sub r2, r6
+dec r5
+L292: bne *r2
+red L248
+add #-189, r4
+mov #60, *r3
+L293: clr L279
+mov *r6, *r5
+; comment
+L294: prn #-18
+jmp *r2
+L295: bne *r5
+L296: cmp r7, r5
+L297: cmp r4, #245
+add r0, *r0
+sub L91, r6
+sub #-91, *r3
+L298: .data 959
+mov *r7, r2
+add *r7, r0
+sub r0, r5
+rts
+not *r3
+add #153, r2
+mov *r2, L245
+L299: not L284
+L300: inc *r3
+rts
+L301: .data 445, -923, 40, 830, -689, 799, -998
+L302: sub #-53, L37
+L303: .data 170, 401, -657, -899, 330, 279, -121, 910
+L304: sub r3, *r5
+prn #-175
+rts
+jmp *r7
+sub r6, *r4
+inc r6
+stop
+dec r7
+not *r6
+red r6
+not r6
+; comment
+bne L56
+L305: cmp *r0, *r5
+L306: bne L45
+stop
+clr L285
+L307: clr *r7
+not *r0
+L308: lea L17, *r3
+jsr L249
+L309: .data -773, -945, 447
+L310: prn r2
+prn r1
+L311: clr L246
+mov #-135, r5
+jmp L28
+L312: bne L215
+L313: sub *r1, r5
+L314: not r4
+rts
+prn r3
+not *r6
+add r1, r3
+clr L275
+jsr L206
+jsr L209
+L315: not r0
+L316: stop
+L317: .string "ssiignlmqpvooewpdmbmjddb"
+prn *r2
+bne L162
+red *r3
+L318: inc *r3
+L319: dec r3
+L320: inc r6
+stop
+L321: stop
+L322: mov #254, r5
+L323: stop
+L324: not L43
+L325: .data -184, -656, -200, -345, -832, -199, -453
+L326: stop
+L327: sub r5, r4
+L328: lea L109, r7
+; comment
+cmp #13, #-108
+jmp *r2
+rts
+lea L289, L83
+lea L143, r0
+L329: bne L197
+L330: add *r4, r3
+
+inc r1
+L331: stop
+L332: red *r6
+jsr L142
+sub L228, L231
+mov r6, r0
+stop
+L333: .string "envbqslhhal"
+L334: .data -6
+not r6
+L335: red L45
+L336: dec L10
+mov L126, r6
+add #93, *r4
+L337: lea L48, *r0
+L338: jmp L289
+red L238
+add L115, L155
+L339: .data 75, 720, 299, -952, 488, 323, -848
+L340: prn r6
+prn *r5
+L341: not r2
+mov r0, L58
+not *r1
+lea L65, *r6
+inc r1
+not *r6
+stop
@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 40
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: prn #86
+sub #-246, L0
+L1: rts
+cmp *r0, #160
+dec *r6
+jsr *r1
+dec *r5
+prn *r4
+L2: clr L1
+lea L2, r1
+prn #-241
+jmp L1
+inc *r6
+L3: dec *r4
+rts
+L4: .string "dxzbelbxxfwbbylaux"
+rts
+cmp L4, *r3
+clr *r5
+L5: clr L3
+prn L5
+L6: mov #74, r3
+not *r0
+L7: cmp r1, *r2
+jmp *r1
+L8: .data -801, -147, 797, 139
+prn #250
+jmp *r5
+L9: cmp L8, r2
+L10: stop
+lea L2, L4
+L11: clr L11
+bne *r3
+sub #-183, r0
+bne L11
+stop
+L12: inc r4
+L13: .data 271, -254, 440, -371, 762, 413
+clr *r0
+dec L1
+sub L9, *r6
+L14: prn *r0
+L15: prn *r6
+L16: sub r4, L14
+L17: .data -878, -733, -749, 459, -537
+not *r2
+; comment
+L18: red L0
+stop
+not *r6
+L19: add *r3, L17
+L20: cmp L0, #-42
+bne L4
+not r1
+L21: .data 245
+; comment
+clr *r4
+L22: .data -338, 760, -187, 919
+bne L11
+jmp L12
+L23: prn r6
+inc L2
+bne L11
+dec *r0
+L24: .data 918, -768, -845, 201, 798, 684
+jmp *r7
+clr *r1
+L25: not L20
+dec *r3
+stop
+L26: bne *r7
+L27: sub L21, *r6
+L28: not *r0
+L29: cmp #143, L5
+
+rts
+inc r7
+L30: .string "xawiylxvzrnurvtfoxob"
+not *r7
+add *r1, *r3
+L31: .string "nnlfycrku"
+mov L6, r1
+add #-9, r3
+L32: add L26, *r2
+add #206, r4
+cmp #-119, L32
+L33: .data 597, -864, -68, -940, -901, -759, -691
+red *r0
+mov r4, r4
+L34: .string "yruwwygsel"
+inc r6
+rts
+sub r3, *r1
+bne *r3
+inc *r2
+mov r6, L4
+jsr L34
+rts
+L35: red L29
+L36: .data -624
+jsr L27
+jsr *r5
+dec *r3
+inc *r4
+L37: rts
+stop
+L38: red L27
+not r1
+clr *r7
+clr r5
+L39: jsr *r4
+lea L29, r5
+L40: not r1
+L41: bne *r1
+stop
+; comment
+L42: rts
+L43: jmp L4
+stop
+L44: .string "xxyebhdveryawk"
+L45: mov L35, r0
+L46: prn #96
+rts
+jsr *r3
+L47: inc *r2
+red L31
+dec *r6
+rts
+mov *r2, r4
+clr *r2
+rts
+L48: .data 409, 194, 698, 186
+stop
+cmp *r7, r7
+L49: .string "jbdtsxpwnqve"
+L50: bne *r7
+L51: rts
+L52: add #15, r5
+clr r6
+L53: jmp *r5
+sub #-125, *r5
+dec *r5
+rts
+; comment
+jsr *r1
+jmp *r2
+clr r3
+red r2
+rts
+stop
+L54: inc L28
+L55: .data 122, 171, -756, -698, 836
+L56: .data -506
+add *r2, L18
+not *r0
+sub r5, L26
+jsr *r1
+L57: bne L6
+L58: sub #4, r5
+cmp r4, *r7
+stop
+not r1
+L59: jsr *r5
+L60: clr r5
+add *r6, *r3
+
+not *r5
+lea L58, r1
+L61: .data -733, -194, -646, -553, -945, 525, -631, 652
+L62: not *r6
+lea L9, r4
+L63: mov L5, *r4
+jsr *r1
+clr L49
+stop
+lea L30, L24
+bne L32
+
+rts
+red r3
+lea L10, *r7
+L64: .string "mlkdocdugvov"
+L65: dec r6
+L66: mov #-112, *r2
+sub #9, r2
+L67: .data 22
+mov L65, *r6
+not L10
+jmp *r1
+inc *r5
+lea L15, r6
+L68: bne L61
+
+sub r4, *r1
+add #185, *r6
+L69: .data -918, -314, 392, 227, 338
+not L38
+L70: sub #-226, r0
+rts
+inc *r7
+L71: mov r7, L7
+not *r1
+bne L29
+not r0
+dec L30
+dec L36
+red *r5
+L72: jmp *r7
+bne *r5
+clr L66
+lea L23, *r7
+mov *r1, *r1
+bne L10
+not L34
+add #-131, L35
+clr r2
+L73: red L61
+mov *r3, r3
+rts
+L74: lea L9, r3
+L75: dec r2
+clr L29
+red r6
+L76: prn L22
+sub *r4, r2
+L77: mov #57, L49
+L78: .string "tkfjdkhiqrwqzeefalqdqdpf"
+sub L65, L35
+stop
+L79: red r6
+L80: lea L14, *r3
+not *r3
+lea L13, L30
+L81: prn r0
+red *r6
+lea L57, r7
+jmp *r3
+red r1
+L82: .string "ugoeazkjix"
+L83: sub #-97, L68
+L84: bne L50
+L85: add r0, r5
+L86: dec r1
+bne *r0
+L87: jsr *r7
+L88: .string "pxakryzdplupl"
+jmp L74
+L89: inc *r7
+dec r0
+mov *r6, r5
+clr r4
+L90: rts
+sub L23, r7
+L91: .string "rld"
+L92: .string "dgnhdgmtjiuljzzdgmeiq"
+L93: .data 211, 778, -201, -990, 258, -592
+L94: mov #-251, r6
+prn r0
+sub r7, *r2
+add L35, L65
+stop
+bne *r3
+clr L33
+clr *r6
+L95: .string "zewkzatmhegsosqsxl"
+L96: .string "fboelapvgsescavzufinw"
+dec r1
+dec L68
+L97: .string "qlcpobefurekhamm"
+lea L90, L25
+L98: jsr *r4
+L99: sub L1, L88
+mov *r5, *r7
+jmp *r5
+dec L25
+prn *r2
+jsr L34
+L100: stop
+sub *r3, L61
+L101: .data 988, 795, 584, 638, 106, -785, -364, -45
+dec L44
+bne *r2
+L102: add L49, r7
+L103: stop
+L104: clr r5
+; comment
+L105: .string "l"
+L106: inc *r6
+stop
+L107: add *r3, *r2
+L108: lea L108, L86
+L109: jmp L46
+L110: bne *r2
+lea L42, *r7
+L111: bne *r2
+mov L2, *r4
+clr r7
+clr L101
+L112: cmp *r0, r3
+mov *r7, r1
+bne L53
+L113: jmp L75
+L114: red *r5
+not r0
+red r2
+cmp r1, #251
+clr L71
+mov #-148, *r6
+L115: .string "wqjbsaytqbsagyjwx"
+inc L111
+L116: bne L6
+jsr *r7
+L117: add #-179, L3
+red r7
+bne L66
+lea L94, L79
+not L36
+cmp *r5, r5
+red r4
+lea L99, L112
+L118: clr L96
+inc L19
+red r5
+bne L102
+L119: dec *r5
+L120: cmp r0, L29
+cmp L81, L98
+jmp L101
+
+L121: .string "engqzqx"
+lea L65, L44
+bne L31
+L122: stop
+L123: lea L89, *r4
+L124: add L99, *r2
+red *r5
+red L38
+L125: lea L17, r2
+rts
+lea L52, r6
+
+inc *r5
+inc r5
+clr r6
+; comment
+not r2
+red *r1
+L126: .string "kglgt"
+L127: cmp *r2, *r0
+L128: jmp L30
+L129: mov *r7, *r4
+L130: prn *r3
+L131: jmp L32
+rts
+rts
+sub r1, r3
+mov *r3, *r2
+L132: bne *r7
+L133: jmp L38
+L134: not r4
+rts
+L135: add *r0, r3
+mov L113, r5
+jmp L32
+L136: stop
+cmp L136, r5
+L137: jmp L124
+mov r0, r0
+L138: prn #-213
+L139: sub L102, *r2
+lea L99, L128
+L140: .string "gyvfijjujkv"
+mov L31, *r5
+L141: prn #-202
+dec r0
+jmp L78
+red L58
+add #128, L36
+L142: lea L51, *r7
+mov L74, *r3
+L143: jmp *r5
+sub L30, r4
+L144: jsr L56
+L145: dec L17
+L146: red L136
+clr r4
+red *r5
+rts
+clr L95
+L147: .data -431, 419, -638
+stop
+add L12, L62
+L148: not L17
+bne *r6
+bne *r5
+lea L26, L13
+jmp L117
+L149: mov L24, r3
+not L132
+rts
+L150: cmp #185, #42
+inc *r2
+cmp L128, L9
+jmp L21
+red r2
+lea L45, r5
+bne L116
+add L73, *r2
+clr r6
+sub *r4, r3
+L151: mov L46, *r7
+L152: .string "gamohrntugytfvga"
+L153: jsr *r4
+inc r7
+not *r1
+mov L102, *r1
+L154: bne L42
+dec r5
+L155: red *r4
+red r0
+bne L85
+clr *r6
+
+L156: clr r3
+clr *r4
+rts
+L157: jsr *r4
+jmp *r5
+prn r5
+inc r4
+L158: stop
+stop
+lea L94, L125
+L159: .string "xcdlflcuahhqrffnurj"
+rts
+bne L148
+L160: stop
+L161: rts
+bne *r1
+sub L4, L147
+bne L159
+L162: add #-189, L148
+add #-125, L44
+L163: rts
+L164: .string "lwsvemr"
+L165: rts
+L166: jsr *r2
+lea L79, r7
+jmp L158
+bne L38
+L167: mov L64, r3
+cmp r2, r3
+lea L129, r4
+lea L145, L65
+L168: .data -698, 495, 940, 303, -361, -691, -712, -835
+prn #-229
+lea L58, L114
+lea L57, r7
+sub #67, *r3
+lea L140, r4
+clr r1
+; comment
+L169: .string "vmbuwjmsihrkzdrnbzsmtvg"
+add L53, *r5
+prn #174
+jsr *r7
+bne *r0
+L170: .string "aos"
+L171: .data 860
+mov L39, L125
+jmp L50
+L172: bne *r5
+L173: sub *r6, L91
+L174: jmp *r1
+L175: rts
+L176: mov L56, *r4
+L177: stop
+clr L78
+L178: prn r3
+L179: mov L101, *r5
+red *r7
+prn L7
+L180: red *r4
+L181: inc *r0
+rts
+L182: add #-52, *r1
+red L24
+sub r5, r4
+L183: rts
+lea L150, r0
+L184: bne L3
+L185: .string "fibcuomgwa"
+red *r5
+L186: .string "kj"
+lea L135, r0
+jmp L4
+prn r2
+clr L5
+bne L97
+jsr *r3
+dec L96
+L187: .data -103, -817, -489, 786, 151
+clr *r0
+not *r7
+L188: .string "xm"
+dec r4
+L189: prn #-191
+L190: jsr *r3
+bne L150
+
+jsr *r3
+sub r2, r0
+jsr *r0
+add #-167, *r4
+L191: jmp *r2
+
+
+lea L40, L187
+L192: .data 661
+prn #59
+L193: lea L96, r4
+jsr L92
+inc r5
+jsr *r2
+lea L148, *r1
+rts
+L194: jsr L147
+L195: not r6
+jmp *r4
+L196: .string "a"
+; comment
+clr L187
+bne *r2
+jsr L56
+dec L130
+inc *r7
+L197: .string "mbpnsnsvxw"
+jsr *r7
+L198: prn L167
+clr r5
+not *r0
+lea L14, *r2
+jmp L13
+prn L119
+; comment
+not L143
+L199: not L169
+L200: jmp *r2
+L201: clr L7
+jsr *r7
+lea L125, *r6
+rts
+jmp *r6
+dec *r7
+prn r4
+jsr L104
+jsr *r6
+L202: cmp *r4, *r3
+stop
+dec L134
+lea L54, r5
+clr r5
+L203: add r3, r6
+lea L37, r7
+L204: jsr L45
+jmp *r4
+mov r1, r5
+red r3
+mov #131, *r1
+lea L64, *r5
+sub r2, *r3
+L205: mov *r5, L16
+clr *r3
+stop
+sub #-153, *r0
+
+L206: stop
+not *r2
+L207: rts
+L208: rts
+prn *r4
+L209: .data -861, 33, 592, 494, -145, -219
+clr L15
+prn #-5
+stop
+sub *r7, r6
+jmp *r4
+L210: .string "phnbmitngo"
+L211: cmp *r7, r0
+not *r2
+L212: jmp *r3
+jsr *r6
+L213: bne L47
+; comment
+; comment
+prn L174
+jsr L181
+L214: jsr *r0
+lea L85, *r1
+L215: bne L55
+jmp *r0
+dec r5
+red *r1
+L216: .string "cslukppxdlnxjko"
+bne L55
+lea L14, L178
+red L43
+L217: stop
+jsr *r2
+red L211
+L218: mov r0, r1
+L219: inc r1
+cmp L132, L118
+
+L220: add L72, L44
+L221: cmp r2, *r7
+
+clr *r2
+cmp r6, *r0
+; comment
+L222: red r1
+L223: bne *r5
+not L216
+inc r7
+L224: inc r7
+L225: dec r2
+L226: dec *r2
+jmp *r6
+
+sub L188, L78
+L227: .data -219, -925, -143, -860, -298, -778, -42, 522
+inc *r2
+L228: bne *r7
+stop
+L229: red r4
+not L3
+L230: prn #-109
+
+stop
+rts
+rts
+L231: .string "eevxdnzxicsmovdpapkclua"
+lea L196, r0
+
+not L39
+; comment
+jmp *r2
+stop
+mov r3, r0
+stop
+mov #183, *r7
+not *r1
+rts
+L232: bne L171
+not r5
+L233: add #192, *r3
+bne *r2
+L234: dec L4
+L235: jmp L154
+L236: rts
+mov r3, L154
+L237: mov r6, L113
+jsr L44
+prn L195
+L238: jsr L90
+rts
+sub r5, r2
+stop
+inc r1
+not *r3
+bne L59
+dec r0
+L239: jmp L35
+not L217
+bne *r5
+rts
+clr L73
+L240: mov L111, *r2
+L241: clr L167
+stop
+L242: not r2
+L243: .data -453, 356, -174, 665, 22, -366, 444
+L244: sub #240, *r3
+lea L119, *r7
+add #-19, L190
+prn r7
+L245: not r3
+bne *r0
+L246: .data -466, -436, -453, -287, 513, 276
+L247: .string "wftoxjltke"
+L248: .data -471
+prn L40
+bne *r3
+lea L234, r7
+L249: mov *r7, *r5
+stop
+lea L169, *r2
+rts
+add L127, *r1
+add #18, L195
+L250: prn L212
+cmp #-64, *r1
+L251: clr L244
+jmp L53
+sub #-114, *r5
+jmp *r2
+L252: jsr *r3
+cmp L77, *r0
+L253: dec L22
+L254: bne L56
+L255: stop
+L256: not r1
+rts
+add r3, *r0
+L257: rts
+dec r4
+dec r7
+jmp *r6
+jsr *r4
+stop
+L258: not r6
+prn L105
+sub *r3, L253
+prn L26
+red L228
+clr L203
+not r7
+jsr *r4
+mov #-49, r1
+prn r0
+jmp L105
+lea L21, L105
+L259: inc L24
+red r6
+red L9
+jsr L173
+L260: .string "buznvlnxqhkne"
+lea L229, *r5
+L261: stop
+jsr L89
+prn L119
+; comment
+L262: rts
+L263: .string "fyhjzldvmjzgfuxthquv"
+cmp #26, L183
+lea L176, *r6
+L264: jsr L31
+stop
+bne L118
+L265: rts
+L266: sub *r5, *r0
+dec *r3
+L267: .string "bukvscmppfltx"
+jsr *r7
+L268: stop
+L269: bne L184
+red L31
+clr *r5
+lea L245, L198
+dec L76
+lea L234, *r4
+not *r3
+inc r2
+L270: inc r7
+L271: .data -75, -738, -125
+stop
+sub r1, L135
+red r2
+lea L102, *r0
+prn L127
+dec r7
+; comment
+rts
+jmp L196
+stop
+L272: sub r7, L26
+red *r4
+L273: stop
+jsr *r3
+rts
+add L158, *r6
+dec r4
+L274: .data 990
+add #99, r1
+rts
+L275: lea L93, L203
+red *r0
+mov r7, *r2
+L276: inc L65
+sub *r1, L212
+stop
+jmp *r7
+L277: bne L195
+stop
+L278: sub #6, r0
+jmp *r0
+add L207, L213
+stop
+L279: bne L278
+L280: not *r3
+mov #-111, r4
+bne *r5
+stop
+lea L174, *r4
+sub *r1, L115
+rts
+dec L219
+L281: red *r0
+sub *r5, L268
+dec *r1
+inc *r0
+L282: bne L29
+lea L55, L213
+L283: .data 79, 966, 700, -363, -594
+L284: sub L271, r1
+L285: .string "xzzpw"
+jmp *r0
+clr L198
+L286: prn *r4
+L287: not r1
+cmp #43, #-91
+L288: .string "zglejbheutfolfim"
+add *r6, r5
+clr L222
+L289: .string "akbyjuz"
+bne L289
+cmp r1, L123
+L290: .string "jsvrnfjcearzcfuacspceyof"
+mov #-41, L231
+; comment
+; comment
+L291: jmp L113
+L292: stop
+dec *r3
+prn L86
+L293: .data -80, -493, 211, 795, -50, 963, 951
+L294: mov *r1, *r6
+rts
+jmp *r5
+L295: .data 925, 384, -769
+dec L38
+L296: sub L252, L161
+L297: add *r4, *r2
+clr L257
+mov #208, *r2
+red *r1
+sub #-113, L189
+clr L44
+L298: .string "hdsbibktkuhe"
+L299: inc *r1
+lea L258, *r1
+prn *r3
+red *r6
+bne L140
+mov #-238, *r0
+clr *r7
+L300: bne L37
+L301: sub L184, *r5
+sub L181, *r3
+jmp *r5
+cmp L245, #124
+L302: prn L139
+prn L161
+cmp L203, r3
+lea L73, r5
+jsr *r7
+not L139
+inc r2
+mov #-57, *r2
+inc L161
+cmp *r3, *r5
+prn r7
+L303: cmp *r2, #189
+red *r4
+mov #119, L141
+not L220
+prn L60
+L304: stop
+bne *r2
+red L24
+L305: .data -112
+L306: rts
+L307: cmp r4, r7
+sub L99, *r1
+L308: dec L62
+inc r1
+L309: sub *r5, r2
+red r6
+red L263
+bne *r7
+rts
+jsr *r5
+bne *r7
+L310: inc L119
+L311: .string "uciz"
+L312: .string "uelkjsze"
+L313: add *r1, L282
+jsr L170
+L314: sub L67, L69
+rts
+L315: .string "spvkfrtonpgkarwkjfzciq"
+inc L41
+add L296, L138
+lea L174, r6
+red *r7
+inc *r0
+L316: cmp L306, *r2
+add L58, *r5
+not L207
+L317: bne *r6
+L318: jmp L185
+red L292
+L319: inc r3
+dec r3
+add L153, *r5
+L320: dec *r4
+L321: add L207, *r4
+stop
+L322: .string "ywkrif"
+sub L51, *r0
+L323: bne *r7
+mov *r2, *r3
+L324: clr r1
+cmp L263, r4
+L325: red r3
+add *r4, *r5
+dec r4
+L326: .string "lry"
+dec r5
+cmp r1, #-68
+L327: red r2
+dec L165
+L328: .string "wsqwhhgveugt"
+
+jmp L8
+
+L329: .string "k"
+bne *r6
+jsr L235
+lea L308, *r0
+jmp *r2
+lea L320, *r6
+jmp L14
+L330: .string "clswullmphpysfxitscel"
+not r1
+stop
+L331: not *r0
+sub L270, r3
+L332: red *r3
+L333: clr L283
+mov r4, *r3
+rts
+L334: bne *r5
+prn r0
+clr *r1
+prn L78
+L335: .data 48, -730, -276, -265, 287, 463, 253
+L336: cmp *r4, #-199
+L337: red *r0
+stop
+L338: red r7
+jsr L50
+clr *r4
+
+L339: cmp *r2, L88
+L340: red *r6
+jmp L64
+
+bne L309
+jsr L258
+L341: dec *r5
+L342: mov r5, L32
+jmp *r4
+L343: mov r6, *r0
+dec *r2
+dec *r4
+L344: prn L154
+L345: red *r3
+sub r7, L131
+L346: jmp L53
+stop
+not r5
+add *r3, L126
+prn #-28
+L347: bne *r5
+cmp #240, r1
+jsr L33
+rts
+not L299
+L348: add L282, r5
+mov r2, r2
+stop
+L349: .data -872, 854, 864, -848, -654, -155
+
+bne L118
+rts
+rts
+; comment
+dec L237
+stop
+stop
@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 5
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+prn L56
+inc r1
+; comment
+stop
+L0: add #17, r7
+jsr L0
+rts
+inc L0
+sub L0, L0
+L1: sub *r2, *r2
+jmp *r1
+inc L0
+dec r1
+L2: bne *r5
+clr *r0
+stop
+clr r5
+bne L1
+jmp L0
+not L1
+lea L1, L0
+stop
+prn *r3
+dec r5
+cmp *r5, #-150
+L3: .string "fey"
+inc L3
+prn r2
+lea L2, r0
+bne L3
+L4: .string "iucdgksfjhmuqmmipsdm"
+stop
+red L1
+stop
+cmp *r7, #-19
+sub *r1, *r4
+rts
+lea L2, *r3
+dec *r3
+add #10, *r3
+lea L1, L2
+stop
+L5: .data 761, 972, 142, -109, 855, 561, -247, -353
+L6: .data -484, 980, 438, 957, 678, 487, -420
+inc *r3
+; comment
+L7: lea L1, r5
+mov #-107, r1
+L8: mov r5, *r7
+prn r1
+clr L8
+L9: stop
+jmp L3
+red L3
+L10: mov L10, *r0
+L11: .data 72, 582, -663, -959
+L12: stop
+red *r7
+L13: jmp L0
+bne L1
+stop
+clr L5
+L14: .string "glrtkgppdolemejhhatfve"
+cmp #-116, L13
+; comment
+stop
+rts
+L15: stop
+lea L4, *r2
+add *r3, r7
+inc r5
+jsr L11
+not L7
+stop
+sub r3, r5
+red r4
+inc *r4
+L16: lea L8, r3
+prn r3
+L17: bne *r6
+lea L15, *r3
+bne *r3
+prn r1
+jsr L13
+sub r7, r7
+not *r1
+jmp *r5
+mov *r1, r1
+jmp *r6
+stop
+L18: stop
+mov r5, r1
+add r2, *r1
+bne *r6
+rts
+mov r4, *r2
+L19: add *r7, L14
+; comment
+L20: clr *r3
+L21: prn *r5
+L22: jsr *r1
+stop
+jsr *r0
+L23: clr r1
+not *r4
+add #-219, *r6
+red *r4
+L24: bne *r2
+add r0, L1
+rts
+jsr *r5
+inc *r5
+L25: clr L7
+prn r3
+inc r7
+prn #141
+L26: cmp L18, L4
+L27: add L24, *r7
+L28: .string "wyajxrmtlbtxn"
+L29: .string "hlvnrumcfrctisdsmauarz"
+inc *r5
+not *r5
+prn #-246
+dec L21
+sub L2, *r6
+sub #252, *r2
+L30: .string "lnnibylet"
+mov *r4, *r2
+jsr *r1
+red *r3
+rts
+lea L29, *r6
+red L28
+rts
+sub r5, L1
+L31: jmp *r5
+dec *r7
+L32: lea L27, *r1
+sub *r6, L25
+lea L30, *r6
+
+dec r6
+lea L14, L28
+L33: .data -818, -358
+add #-59, r3
+inc r2
+L34: inc *r5
+stop
+clr L15
+lea L24, r3
+rts
+jmp *r6
+rts
+not r4
+cmp r0, L6
+L35: jsr *r4
+not r6
+sub r6, *r0
+L36: clr r7
+L37: dec L30
+L38: sub L25, r7
+L39: red r2
+rts
+L40: .data -296, -392, 905, 487, -373, 86
+prn L17
+rts
+L41: .data -272, 931, -961
+not L33
+prn #-87
+stop
+dec r4
+sub r5, r7
+not *r3
+prn L4
+L42: .string "fmozygmzxdxbjhlxoflqdzna"
+sub r5, *r0
+red *r7
+L43: .data 178, -939, -689, 263, 990, 604, -544, 344
+L44: jsr L5
+L45: prn *r0
+L46: .data 992, 551, -24, 965, 268, 113
+L47: .string "dq"
+dec *r0
+not L38
+L48: cmp L9, L1
+L49: bne *r7
+not L28
+sub L33, r3
+lea L17, *r6
+L50: .string "kqwaqkglrphkzsg"
+rts
+L51: inc r7
+clr *r4
+; comment
+L52: .string "gmtgtpjmjgsjugkdcto"
+L53: clr *r5
+L54: bne L13
+prn r5
+red r2
+stop
+jsr L31
+L55: dec L3
+L56: bne L5
+not r0
+L57: .string "czu"
+L58: bne L28
+add *r6, L3
+L59: dec r1
+L60: sub L15, *r6
+not L26
+L61: .data 190, -1000, 338, -148, 394, 668
+stop
+prn r6
+not *r1
+; comment
+inc *r0
+L62: lea L37, L15
+L63: jmp *r5
+L64: rts
+add L2, r0
+inc r4
+inc L36
+add L27, *r3
+bne L48
+jmp L14
+red r0
+add r5, r7
+L65: inc *r2
+L66: .string "uyt"
+stop
+cmp r2, r2
+L67: .data 992, 624, -753
+not L46
+mov L15, L32
+dec r6
+dec r0
+clr L61
+dec L15
+L68: .string "jmjyhbkxmdkwxgkbl"
+; comment
+L69: stop
+sub #227, *r6
+L70: bne L70
+add r5, *r0
+
+L71: sub L23, L45
+L72: rts
+jmp L47
+prn *r6
+prn r1
+bne L62
+cmp r7, L15
+L73: lea L25, L47
+
+L74: bne L64
+rts
+L75: stop
+L76: sub *r2, *r0
+add #-243, *r7
+jmp *r6
+L77: .data -860
+prn L3
+L78: .data 49, -441, -480
+cmp *r1, *r5
+clr r7
+cmp r7, L7
+L79: cmp #-110, r5
+L80: inc *r1
+L81: jsr *r1
+jsr L59
+stop
+L82: lea L57, L40
+cmp r7, #-60
+add r4, L36
+bne *r4
+L83: bne *r6
+L84: red r2
+L85: prn #-88
+L86: mov L50, *r7
+jsr L54
+L87: cmp r6, *r0
+red r1
+L88: lea L3, *r5
+lea L45, *r2
+L89: red *r6
+not L17
+inc L50
+mov #27, *r4
+L90: not L87
+dec *r4
+cmp L21, r4
+dec L69
+bne *r3
+L91: rts
+jmp L58
+prn #88
+L92: add #-106, L84
+L93: inc *r6
+clr L47
+red *r7
+bne L85
+mov L82, *r7
+
+not *r2
+bne *r4
+L94: not L27
+L95: dec *r0
+L96: .data 820, -993, -92, 808, 657, -708
+L97: stop
+dec *r3
+add r0, *r1
+mov L81, *r0
+not r1
+stop
+add *r6, *r4
+L98: red L46
+jsr L84
+cmp #-44, r7
+; comment
+L99: .string "wctmhjskafxiwpro"
+lea L64, L46
+dec L17
+bne *r7
+clr r7
+L100: inc *r3
+cmp r6, #192
+jmp L68
+rts
+sub L2, r0
+L101: add L42, r7
+bne *r2
+
+clr L42
+
+L102: cmp r1, L60
+
+dec L97
+clr r4
+sub #-101, r5
+L103: lea L24, *r3
+bne *r5
+L104: .string "vogclndtwqmwmqker"
+prn *r4
+L105: dec *r5
+L106: jmp *r5
+L107: lea L53, *r4
+lea L3, L20
+bne *r0
+clr r4
+add #184, *r5
+jmp *r5
+dec r2
+L108: .string "rlixscumzv"
+
+sub #156, *r2
+stop
+L109: lea L8, L45
+rts
+jmp *r2
+L110: .string "bksco"
+inc *r0
+L111: bne *r0
+add L89, L87
+L112: red *r4
+add r1, r7
+L113: lea L1, L38
+not r5
+not *r1
+L114: not *r0
+dec *r3
+add *r3, r4
+mov *r7, *r2
+prn r0
+prn *r2
+L115: clr *r5
+clr *r0
+not L105
+rts
+jmp *r6
+L116: jsr *r3
+red *r6
+L117: dec r6
+L118: sub *r5, *r5
+bne *r4
+L119: jmp L68
+L120: not *r5
+stop
+L121: not L63
+rts
+L122: prn #88
+L123: inc *r6
+sub *r7, r0
+L124: rts
+not L26
+L125: jmp L87
+cmp L111, L30
+mov #-9, r5
+L126: cmp #-241, L117
+sub r6, L85
+add r4, r3
+stop
+L127: add #-120, L119
+rts
+not *r4
+L128: .data 255, -701, -434, 94, -488, 559, 285, -69
+prn r6
+bne *r6
+L129: mov #187, r6
+L130: add *r0, *r4
+prn #-61
+L131: add *r7, *r3
+L132: stop
+L133: cmp L12, #197
+L134: inc *r7
+L135: clr L48
+L136: sub #206, L2
+mov #130, L106
+L137: .data -30, -344, -948, 605, -537, -565, 661
+; comment
+L138: rts
+not L54
+jmp L18
+prn #-96
+add r2, *r1
+L139: bne *r4
+L140: .data 777, -679
+lea L102, r4
+dec *r3
+L141: .data 526, 29, -717, 529, -644
+L142: red L58
+dec *r6
+lea L93, *r3
+L143: cmp r0, #-221
+L144: red *r6
+mov r7, L60
+lea L36, r5
+dec *r4
+stop
+rts
+L145: .data 509, 767, 86, -244, -234, -980
+mov r6, r6
+L146: dec r4
+L147: red L72
+L148: inc L63
+L149: jmp *r0
+lea L77, *r7
+rts
+cmp #-91, #238
+lea L54, r1
+jsr L49
+L150: .data 252, 224
+stop
+prn r0
+L151: add *r3, r2
+lea L29, L55
+L152: add #-210, *r2
+L153: .data 967, -733, 109, 188, -766, 723, 947, -381
+L154: bne *r5
+rts
+bne *r0
+mov #20, r2
+sub L127, *r7
+L155: jmp L149
+bne L67
+sub #43, *r0
+sub #-189, L141
+L156: .data 491, 417, -825, -416, -829, -559, -719
+L157: not *r5
+lea L44, L36
+jmp L114
+bne L95
+L158: dec r7
+L159: mov #-91, *r3
+L160: .string "exuuguxs"
+bne *r2
+; comment
+L161: add r4, r5
+L162: not L56
+L163: red *r5
+rts
+prn r0
+L164: rts
+prn r4
+red r5
+bne *r6
+clr r7
+jmp *r5
+L165: not r1
+not *r2
+L166: prn *r0
+bne *r3
+L167: .string "odbiq"
+jsr L126
+jmp L23
+jsr L57
+cmp *r4, L4
+not *r3
+jmp *r0
+L168: bne L81
+L169: add r7, *r4
+bne L11
+L170: bne *r3
+L171: mov #254, L167
+stop
+L172: red *r2
+; comment
+L173: sub L118, r0
+L174: .data 117, 732, 332, -878, -305
+stop
+stop
+rts
+clr L4
+jsr L45
+L175: .string "socgqzq"
+mov r0, *r5
+L176: red *r0
+L177: .data 605
+cmp r0, L176
+clr L26
+stop
+lea L50, r3
+L178: jmp L73
+mov #86, L24
+L179: jmp L30
+L180: jsr L152
+not r7
+inc L44
+L181: jmp L60
+L182: lea L54, L91
+jmp *r0
+dec *r7
+L183: .data -986, 423, 168
+L184: clr r4
+L185: dec r6
+L186: red L180
+cmp r3, *r2
+inc L110
+jsr L171
+stop
+jmp L85
+not r4
+stop
+L187: .string "icvb"
+inc r3
+L188: mov L155, *r1
+red *r6
+add #-237, r1
+not *r3
+; comment
+mov *r5, L176
+rts
+L189: dec r2
+L190: mov L169, L6
+sub L108, *r5
+inc L133
+not r4
+L191: clr L43
+cmp r3, r7
+lea L96, r3
+
+inc *r1
+rts
+inc *r4
+L192: lea L31, L136
+L193: red r0
+jsr *r0
+L194: prn L176
+lea L91, r5
+; comment
+stop
+cmp #192, r4
+dec r1
+L195: jsr L67
+prn L152
+stop
+L196: prn r0
+; comment
+L197: .string "eacueyclynpvwswsfoganst"
+; comment
+add *r2, *r7
+add #32, L124
+; comment
+; comment
+jsr *r4
+add #99, *r7
+jsr L33
+jmp L84
+L198: sub L151, r6
+L199: inc L84
+L200: dec L102
+lea L154, L11
+prn #59
+L201: lea L64, L101
+jsr L162
+prn *r2
+jmp L87
+red *r7
+jmp L155
+L202: .string "eqcjlgheyffohwu"
+rts
+L203: .string "aerlyyntaqolfmxjzzrv"
+; comment
+stop
+clr L4
+bne L119
+sub *r7, L171
+L204: jsr *r5
+cmp *r3, L15
+not L81
+red L126
+add r4, r1
+sub L136, *r3
+clr L57
+jsr L27
+L205: clr L202
+clr *r4
+L206: .data 234
+L207: .data 30, 351, -691, 740, 119, -806, -764
+L208: stop
+L209: dec *r0
+L210: mov L184, r5
+L211: lea L162, L104
+L212: rts
+red r1
+L213: bne L173
+red r0
+prn *r7
+not *r7
+mov *r2, r2
+sub r1, r4
+L214: lea L150, *r6
+; comment
+clr *r7
+red *r0
+dec r6
+red L73
+L215: lea L142, L49
+L216: sub r3, *r7
+lea L11, r2
+not *r4
+L217: sub #32, *r0
+jmp L211
+L218: not r2
+not r3
+clr *r6
+bne L32
+L219: mov #-146, r0
+bne *r1
+not r1
+L220: lea L143, r6
+jmp *r7
+dec r6
+prn #126
+L221: stop
+cmp L1, r4
+L222: cmp *r0, *r1
+stop
+L223: red *r3
+cmp *r0, L88
+; comment
+sub #-204, *r2
+L224: .string "pnmawkqvqx"
+L225: add #-227, r4
+L226: .string "fqz"
+L227: .string "mjbn"
+dec r2
+L228: lea L168, *r2
+; comment
+mov *r3, r5
+L229: lea L52, *r0
+L230: prn *r2
+L231: rts
+L232: stop
+jsr *r6
+not r7
+L233: .string "etzptomudtsznenkrck"
+sub r2, r6
+stop
+L234: dec L55
+lea L41, r4
+sub r3, *r0
+lea L205, L149
+L235: cmp r1, r4
+L236: .data 32, -955
+; comment
+rts
+L237: sub L107, r7
+
+lea L121, r3
+add *r5, *r2
+L238: rts
+mov #-178, L230
+sub #207, *r5
+jmp *r5
+dec r0
+cmp L3, L146
+lea L200, r3
+red r6
+L239: cmp L182, #-210
+L240: stop
+L241: .data -600, 196, -502, 655
+lea L137, L141
+inc *r0
+jsr *r5
+jmp *r7
+dec r5
+; comment
+sub *r4, *r2
+L242: not L73
+prn r7
+jsr L162
+dec L63
+rts
+L243: .string "zsz"
+stop
+L244: bne *r0
+clr *r7
+add r5, *r7
+; comment
+sub #30, *r3
+add *r6, r7
+mov *r7, *r6
+prn #21
+clr L109
+cmp r7, r0
+L245: sub L218, r5
+sub #238, *r2
+dec r4
+not *r1
+L246: inc *r1
+L247: mov *r0, L209
+L248: .data -981
+inc r3
+lea L201, L117
+stop
+L249: lea L199, L130
+L250: sub L25, L131
+stop
+L251: lea L11, L186
+L252: bne L56
+L253: red r6
+L254: rts
+clr L246
+L255: .string "puiztsmplagkfnz"
+L256: dec L67
+lea L57, *r6
+red L125
+L257: clr L86
+L258: clr L109
+; comment
+red r0
+L259: .string "ezydstq"
+sub L219, L256
+
+L260: lea L173, *r5
+L261: .string "rzuoskhleljxk"
+L262: .data -605, 953, -463, 378, 239, -15, -454, -186
+dec r6
+; comment
+red r7
+L263: add #-174, r3
+add #7, L117
+prn r7
+stop
+add #-37, r4
+L264: sub r2, *r3
+L265: sub *r3, L26
+mov #68, L222
+L266: .data 878, -924, -339, -155, -986, -642, -412
+L267: jsr *r1
+inc r3
+cmp *r4, r5
+L268: sub r4, L189
+stop
+rts
+L269: .string "xhngtd"
+stop
+add L109, L254
+L270: mov *r1, L51
+rts
+
+prn *r6
+clr r1
+L271: sub #-238, r6
+L272: .data 919, 454, -562, -217
+L273: cmp *r6, r7
+bne *r5
+mov *r5, r7
+cmp L9, r3
+red *r1
+L274: dec L152
+
+L275: .string "sslzcymivgnm"
+rts
+red r2
+L276: .data 480, -244
+L277: stop
+stop
+L278: .string "kte"
+prn L63
+stop
+jsr L114
+L279: sub r1, r3
+dec L36
+; comment
+L280: .string "rxcjqwbidfyrupfrkeeksv"
+inc r7
+jsr *r0
+prn L255
+dec L29
+L281: .data 326, -176, 382
+L282: mov #-227, r7
+L283: stop
+jmp *r7
+jsr L150
+red r0
+; comment
+lea L244, L127
+L284: jsr *r3
+dec *r3
+L285: .string "kljhfawwtiryj"
+jsr *r3
+L286: .string "bvtvxzlvxsnyyszzbbuiam"
+L287: bne L198
+L288: not L263
+prn #131
+stop
+L289: mov #-160, L141
+sub L205, r7
+rts
+mov *r1, r6
+jmp *r6
+lea L151, *r1
+red L243
+jsr *r3
+L290: jmp *r6
+clr *r5
+cmp #201, *r0
+L291: sub #-228, r5
+L292: cmp L15, r6
+L293: red L41
+; comment
+lea L268, r5
+L294: add L291, r7
+cmp #-5, r6
+L295: jsr *r6
+dec r4
+L296: not r4
+bne L92
+L297: .data 903, 648
+L298: jsr *r0
+lea L262, *r2
+not r2
+red *r7
+prn *r7
+L299: lea L9, r6
+L300: .string "kesbcpjdyq"
+sub #137, r6
+L301: .data 99, -54, -215, 941, 250, 272, -85, -570
+cmp L35, r1
+L302: stop
+L303: .data 475, -333
+; comment
+L304: .string "fbspuhuksccgrksoskbw"
+L305: .data -834, -289, 491, -894, -552, -631, -696, 98
+prn *r0
+bne *r1
+; comment
+bne L304
+L306: .string "bswksoztikucodjyvpo"
+L307: inc r0
+; comment
+L308: .string "zxrlcptdzuumbnb"
+jmp *r5
+red r2
+prn L165
+L309: .string "snaanamjaic"
+L310: add #-159, *r6
+L311: clr r5
+L312: dec L28
+prn L114
+L313: .string "imzhamrjgeihxfsjez"
+rts
+clr *r2
+clr L279
+cmp *r7, r5
+L314: lea L263, L80
+rts
+mov r6, *r5
+lea L241, *r5
+mov L33, *r1
+prn r6
+L315: stop
+L316: cmp *r3, r4
+L317: jmp *r0
+clr r7
+L318: add *r5, *r4
+jmp L215
+cmp #-180, r3
+dec *r0
+cmp r3, L189
+jmp *r3
+mov #-140, *r4
+clr r4
+stop
+cmp #164, L215
+lea L314, *r4
+add #53, *r5
+L319: jsr *r3
+inc r4
+clr r4
+cmp #-145, r7
+inc *r4
+L320: .data -773, 175, -989, -356, -939, -174, -574
+dec *r5
+red r1
+not *r0
+bne L128
+L321: add *r5, *r7
+not *r6
+
+
+L322: red L8
+L323: .data 357, 10
+bne *r6
+clr *r0
+
+cmp *r3, L10
+cmp L217, #231
+
+mov L128, r1
+L324: .data -196, -6, 791, -503, -106, 512, -114, -537
+add L212, r7
+jmp L17
+cmp r5, r3
+sub *r2, *r1
+dec r2
+L325: mov #-3, r6
+cmp r3, r5
+jsr L240
+; comment
+L326: red L178
+L327: inc r3
+; comment
+not L80
+dec L160
+red L318
+L328: .string "udutltnrfscniyat"
+not L129
+jsr L94
+L329: red *r1
+prn L171
+mov r0, L106
+L330: .data 861, 150
+mov r2, *r1
+
+add #210, *r7
+stop
+L331: .string "jmevbhio"
+red *r0
+stop
+sub *r7, r1
+prn *r3
+L332: .data -203, -263, -311, -77, -112
+not *r4
+inc *r7
+
+prn r6
+rts
+L333: rts
+jsr L30
+cmp *r0, #45
+not L61
+not L89
+inc L168
+rts
+; comment
+lea L0, r4
+L334: rts
+jmp *r6
+
+cmp L115, r0
+L335: .string "uwrtibdmysycghphrwc"
+red L108
+L336: prn *r4
+L337: .string "xrlzclhla"
+lea L256, r2
+L338: sub L188, r6
+L339: inc r3
+bne L305
+inc r3
+L340: jsr L253
+bne L122
+red r2
+mov *r7, L307
+sub L100, L285
+cmp *r5, #-87
+L341: .data 480, -788
+mov r5, r0
+red *r6
+stop
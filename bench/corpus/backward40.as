@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 41
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+stop
+L0: lea L0, L0
+not r7
+inc *r0
+mov #-107, *r0
+L1: clr L1
+L2: jsr *r0
+jsr *r1
+L3: .string "svxdauxibqfmmkiizwhmqwln"
+L4: .data 422, -790, 86, -869, 421, -916, 968, 381
+sub r4, L4
+jsr *r6
+L5: stop
+L6: lea L5, r5
+rts
+prn r6
+not *r7
+L7: clr *r0
+
+L8: bne *r7
+L9: .data -943, 58
+L10: jsr *r5
+jmp *r4
+bne L4
+clr r4
+L11: add #1, *r5
+not L1
+
+; comment
+dec r6
+jmp L5
+bne *r6
+stop
+not L1
+L12: inc r1
+L13: .string "sjldlnmvhuyhzmxlmk"
+L14: sub L8, L10
+jsr *r4
+add r1, r4
+inc L3
+L15: dec L6
+clr L2
+dec r7
+L16: jsr L11
+inc L3
+dec L12
+cmp r5, #-203
+L17: rts
+prn r7
+jmp *r3
+prn #134
+cmp r3, #-10
+L18: dec L12
+sub #2, r0
+bne L9
+L19: inc *r4
+add *r7, L19
+L20: dec r6
+L21: bne *r5
+L22: sub *r7, *r5
+jmp L21
+L23: clr *r2
+rts
+dec *r6
+L24: red L12
+L25: jmp L8
+L26: clr r2
+rts
+L27: prn L25
+L28: clr r2
+inc r6
+L29: mov #85, *r4
+L30: lea L22, L2
+clr L10
+cmp *r5, *r2
+L31: red r4
+inc *r4
+prn r2
+L32: cmp #-164, L23
+jsr L20
+jmp *r3
+mov L25, *r5
+red *r2
+inc r1
+L33: .string "aj"
+bne *r7
+stop
+mov r2, r1
+mov #154, L13
+L34: not r7
+L35: lea L17, r2
+jsr *r4
+stop
+bne L8
+jsr L11
+
+add L35, L23
+
+sub *r0, r0
+bne *r2
+mov r0, r1
+jmp L34
+L36: .string "vpkmvjlbmnnenvobetsxfbu"
+add r5, *r5
+jmp L15
+L37: .data 28, 20, 259, -893
+add L36, L2
+jsr L30
+bne L7
+jmp *r7
+L38: clr r5
+dec r4
+clr r1
+dec L22
+L39: sub L14, r1
+mov L35, L11
+L40: .data -578, -318, 258, 439, -17, 776, -209, -257
+L41: rts
+add L32, r7
+L42: inc L34
+jmp *r6
+red *r2
+inc r3
+cmp L38, #193
+L43: not r4
+L44: .string "qbk"
+red r0
+L45: .data 345, -351, -381, 612, -742
+jsr *r1
+inc r7
+dec r3
+sub L44, *r2
+dec r1
+jmp *r0
+L46: jmp L16
+clr L7
+mov #0, *r4
+L47: lea L14, L23
+L48: inc *r3
+cmp *r4, *r1
+L49: .string "vxka"
+prn L30
+L50: lea L10, *r5
+L51: rts
+inc *r0
+L52: dec r0
+jmp L51
+jmp *r4
+mov #-61, r3
+L53: .string "ut"
+L54: prn L49
+clr *r6
+stop
+; comment
+jsr L10
+
+L55: .data -209
+L56: jsr L31
+L57: add L18, L25
+L58: jsr L23
+red *r1
+stop
+rts
+not *r6
+sub L12, L30
+jsr L36
+L59: clr L3
+add L48, r0
+dec r1
+stop
+sub *r1, L35
+red *r6
+dec r3
+prn *r1
+jsr *r6
+not L19
+inc r7
+lea L48, *r3
+inc r3
+mov #183, L23
+stop
+L60: add L5, *r4
+dec *r6
+L61: jmp L7
+L62: bne *r7
+dec *r4
+L63: mov #192, r1
+not r2
+clr r6
+jsr *r4
+L64: .string "wnsqwhlrurnqybkpz"
+L65: prn #220
+sub #-33, *r6
+clr r1
+lea L64, L59
+jsr L20
+; comment
+stop
+L66: dec r3
+jmp L18
+lea L55, L18
+clr *r7
+L67: .string "iqakhtcre"
+L68: sub r3, *r3
+L69: lea L55, r3
+L70: red r6
+L71: .data 380, 380, -670
+lea L21, r2
+L72: rts
+add *r0, L71
+L73: .string "ntv"
+add r5, L21
+stop
+stop
+jsr *r3
+L74: .string "bhgdyvaaqaulrvvmibtyz"
+L75: red r5
+L76: red r3
+L77: .string "ticgihi"
+add #-18, L24
+L78: .string "uxrscuvbljrferendfjonpz"
+jsr *r4
+L79: stop
+lea L54, L39
+jsr L14
+L80: stop
+L81: jsr *r6
+sub r1, *r1
+L82: red L11
+L83: mov #-24, r1
+add *r0, L28
+lea L70, *r0
+jsr *r6
+L84: cmp #193, *r6
+prn L33
+jsr L21
+clr r2
+jmp *r6
+add #63, *r3
+sub #-135, L47
+L85: stop
+lea L66, r1
+clr L67
+red L76
+L86: mov r4, L21
+L87: mov #-143, r0
+not *r1
+L88: .data 476, 423, -402, 444, -532
+L89: jsr L35
+red *r7
+clr *r6
+L90: stop
+dec L7
+L91: inc L28
+L92: inc r6
+L93: sub r1, *r5
+not L58
+L94: clr *r0
+bne L45
+clr *r3
+L95: cmp *r6, #35
+bne L62
+mov L72, L83
+jsr L85
+jsr *r6
+L96: lea L43, r7
+L97: cmp *r0, *r0
+jsr L42
+stop
+add r4, L97
+L98: .string "qp"
+cmp L92, r2
+rts
+rts
+L99: jsr L47
+jmp L25
+clr *r0
+L100: inc *r1
+
+L101: .data 338
+not *r2
+L102: .string "auxir"
+not L53
+; comment
+jsr L98
+L103: cmp L57, #26
+rts
+red *r7
+sub r4, L90
+mov *r5, r2
+L104: .data 498, -139, -836
+red r6
+jsr *r5
+rts
+jmp *r3
+not L65
+sub L77, L10
+L105: .string "frl"
+L106: .data 184, -679
+L107: inc L36
+clr *r7
+mov r6, *r3
+L108: .string "putaop"
+jsr L17
+lea L12, *r2
+jmp L3
+red L44
+red L90
+mov L11, r5
+bne *r0
+L109: .string "q"
+L110: dec *r4
+rts
+sub r3, r3
+sub *r3, r6
+add r0, r7
+sub L50, *r3
+L111: mov #184, r5
+L112: add *r0, *r7
+
+dec r6
+L113: clr r6
+L114: sub *r7, r7
+lea L68, r5
+dec L58
+inc *r3
+clr r3
+jsr *r4
+L115: sub r5, *r7
+L116: red L93
+L117: stop
+not *r1
+jmp *r6
+L118: .string "quwautst"
+L119: jmp *r6
+add *r4, L68
+jsr L82
+L120: cmp r0, r5
+L121: rts
+red r0
+stop
+jmp L16
+stop
+L122: .string "wmimvupfgz"
+L123: cmp *r5, r4
+jsr L72
+clr L49
+clr *r4
+dec r2
+
+red *r6
+prn r1
+lea L26, L30
+inc L70
+L124: clr *r7
+L125: lea L55, *r3
+L126: rts
+dec r4
+lea L97, r6
+lea L9, L72
+L127: lea L66, *r3
+dec L5
+lea L20, r4
+dec L123
+not *r0
+stop
+prn #49
+L128: .data -467
+L129: .data -436, -328, -747, 353, 739, 492
+inc r1
+L130: .string "weuuevispyk"
+L131: stop
+L132: rts
+not L117
+prn *r2
+not *r1
+L133: .data 28, 364, 89, 276, 46
+L134: .string "eosqqnfefqlbvidk"
+prn #-21
+sub L62, *r7
+bne L33
+L135: jmp L92
+L136: red *r0
+rts
+jmp L101
+L137: rts
+L138: .data 582, -297, 872, 990, 73, 233, 800
+stop
+jmp L126
+rts
+L139: red L13
+L140: stop
+not L40
+L141: cmp L128, L58
+red r2
+rts
+sub r5, r4
+rts
+not L126
+L142: .data -270, 195, -225
+sub *r0, *r3
+red L71
+dec L7
+L143: .data 225, 618, 521, -333, 523, 978, 264, -644
+mov *r3, r6
+clr *r0
+L144: sub r5, *r2
+L145: .string "ejuegisytcjxdjtui"
+L146: rts
+prn L16
+jsr *r4
+red r0
+L147: stop
+L148: jsr L32
+prn r7
+dec *r5
+L149: prn L33
+L150: .data -139, -260, -997
+lea L116, *r3
+red r6
+cmp L85, *r4
+L151: .data -940
+prn #-155
+jsr *r0
+red *r3
+; comment
+dec *r1
+L152: .data 340, 405, 800
+L153: .data 321, -101, -380, -266, -846, 219
+L154: cmp r6, r1
+red r6
+L155: sub r3, L0
+red r1
+add *r5, L88
+lea L95, *r4
+stop
+L156: stop
+bne *r4
+L157: cmp #-25, *r7
+red *r6
+L158: inc *r5
+stop
+L159: rts
+jsr *r7
+stop
+not *r7
+L160: cmp L89, r3
+L161: mov L31, r6
+red r3
+L162: mov *r5, r3
+L163: add r1, L146
+; comment
+L164: .string "thvckcnqtnshaanojnnfhyi"
+not r7
+bne *r5
+L165: jsr L66
+L166: .data 743, 680, 724, -315, 509, -49, 944, 36
+; comment
+clr r0
+sub *r1, r6
+sub r7, *r2
+sub r0, *r0
+inc r4
+L167: sub *r0, *r0
+rts
+L168: mov r6, L45
+jmp *r1
+not *r3
+jsr *r6
+jmp *r4
+lea L42, *r2
+prn #-84
+L169: .string "kdwjfbrefgdkufdpu"
+add L166, L154
+stop
+sub L129, *r7
+rts
+L170: prn #213
+L171: .string "wayez"
+jmp *r3
+L172: stop
+lea L101, L93
+mov *r5, L107
+jmp L78
+prn L128
+add *r2, r5
+inc r6
+red r7
+not L21
+L173: stop
+cmp r3, #-30
+lea L80, r4
+inc L100
+L174: add *r6, L59
+L175: prn *r0
+L176: inc r3
+sub L116, r5
+rts
+L177: dec L97
+add L62, *r0
+L178: red L120
+inc r6
+lea L110, r6
+L179: .string "moszuzpqua"
+rts
+bne *r4
+L180: .string "efjbnafjsgmahnpdjp"
+L181: .string "qyzkwqhlrywhgbdxpexzap"
+jmp L78
+L182: bne *r3
+inc r5
+; comment
+sub L18, L107
+add #-219, r5
+L183: clr L54
+not r0
+dec L2
+L184: stop
+lea L180, L36
+L185: prn L73
+L186: prn r1
+red *r3
+dec L54
+L187: jmp L153
+L188: sub L157, *r0
+L189: sub r4, L167
+jmp *r2
+red r2
+L190: cmp r7, *r0
+inc r0
+jmp L88
+bne L60
+L191: jsr L61
+mov r5, L94
+add r5, r7
+L192: cmp L154, L45
+L193: clr *r7
+L194: .string "ysg"
+L195: not *r2
+L196: mov *r3, r6
+inc r0
+stop
+rts
+L197: .data 460, -55
+bne L196
+jmp L123
+rts
+jsr L59
+L198: add L186, r4
+jsr *r5
+L199: lea L185, *r0
+stop
+add *r4, *r0
+sub r1, L1
+; comment
+mov r2, *r0
+jsr *r7
+red *r4
+L200: sub #-218, r4
+bne L166
+add *r3, L137
+L201: inc r4
+L202: rts
+clr L159
+
+inc *r3
+L203: lea L162, L108
+mov *r7, *r5
+bne *r5
+L204: jsr L65
+L205: .string "hghvrvruvuwxnkoywcuvxrfy"
+clr r6
+mov #-6, *r1
+jmp L166
+sub *r5, r4
+inc r6
+add r2, r2
+L206: jsr *r7
+jmp L32
+L207: .string "shbwnc"
+lea L126, L167
+jsr L44
+inc *r1
+mov #-231, *r7
+mov #154, L112
+L208: jmp *r4
+not L125
+red *r5
+L209: jmp *r0
+L210: add L195, r1
+L211: inc L22
+add r6, *r6
+mov #15, *r2
+prn r6
+jsr *r2
+lea L199, *r3
+
+prn #171
+; comment
+L212: rts
+L213: .data -41, -496, -316, 874
+dec L78
+cmp #-89, *r0
+L214: .string "ojiglnehhdhwrcejisdq"
+add L58, r4
+L215: not r7
+stop
+L216: rts
+L217: not *r6
+cmp r3, *r1
+add r1, *r6
+clr L166
+jmp *r5
+L218: red r7
+mov #64, L7
+mov #-253, r7
+
+add *r4, L173
+L219: jsr L135
+L220: sub #-143, r5
+jmp L213
+rts
+sub *r3, *r0
+red r1
+
+rts
+cmp #-63, #207
+bne L19
+lea L183, L32
+L221: jmp L2
+jsr L49
+L222: clr *r3
+rts
+mov L129, *r2
+jsr L108
+sub r0, L80
+sub L149, *r0
+L223: .string "pgodbtvsrzvery"
+lea L88, *r6
+rts
+; comment
+; comment
+L224: .data 831, 694, -222, -215
+not *r6
+L225: lea L74, L182
+stop
+not L99
+not L76
+L226: prn r3
+dec L23
+jsr *r3
+L227: .string "totgu"
+sub r1, r1
+L228: jmp *r1
+rts
+
+cmp L14, *r5
+
+not *r2
+add *r6, L105
+L229: .string "uyknuulmxtxinpoqbz"
+not L168
+L230: rts
+not *r7
+L231: stop
+L232: .string "cdthgn"
+not *r4
+clr *r0
+clr L90
+jsr L171
+jsr L203
+not L96
+lea L120, *r3
+mov L190, L158
+bne *r5
+bne *r6
+L233: .data 13, 820, -124, 995, -975
+stop
+lea L182, *r0
+rts
+L234: jmp L200
+L235: jsr L101
+red *r2
+inc L199
+inc *r5
+not L80
+dec *r2
+L236: jmp *r4
+L237: .string "zhjosxaeuxp"
+rts
+lea L29, L93
+L238: add L209, r2
+add *r2, *r1
+L239: red L50
+inc r3
+L240: cmp L216, L93
+clr *r5
+L241: .string "hyrxjdxneqxdiistpvaydil"
+not L122
+stop
+L242: not L230
+L243: clr L162
+add r3, r7
+clr *r2
+L244: sub r5, *r0
+rts
+sub r3, *r2
+L245: rts
+L246: .data 459, 63, -205, 354
+L247: not L10
+jsr L212
+jsr L30
+bne *r3
+dec L42
+L248: .data 210, -322, -31
+add r5, L6
+L249: lea L109, L79
+cmp *r5, #10
+sub L43, r2
+not r4
+lea L128, L177
+L250: mov r4, *r0
+cmp *r7, *r3
+sub #69, *r5
+L251: mov L152, L141
+jsr L100
+L252: prn *r4
+stop
+inc r3
+L253: inc r5
+add *r1, *r4
+inc r0
+clr r6
+jmp *r6
+L254: stop
+bne *r5
+jmp L66
+L255: rts
+stop
+
+sub r5, L203
+L256: stop
+L257: sub #-212, *r6
+jmp *r6
+inc L55
+mov r3, L104
+cmp r7, #86
+L258: .string "o"
+inc L102
+jsr L4
+not L218
+inc *r1
+L259: clr r5
+stop
+dec r2
+L260: prn L65
+L261: .data -7, -560
+L262: .data 590, -415, -901, 573
+L263: .string "iwbdskyguiitmuydf"
+; comment
+jsr L70
+clr *r0
+L264: cmp L148, L145
+L265: jsr L36
+sub *r2, L54
+L266: lea L103, r2
+cmp *r3, #-116
+L267: add #51, L177
+bne L246
+jmp L165
+L268: not L144
+inc *r0
+dec L70
+lea L94, *r7
+L269: cmp *r7, L102
+clr r5
+red r3
+sub L117, L182
+L270: .data -490, 594, 998
+L271: jmp *r7
+L272: stop
+L273: red r5
+jsr L64
+L274: stop
+inc r5
+add *r2, L11
+L275: clr *r4
+L276: .data 810, -485, -305, 523
+L277: lea L96, r2
+jmp *r1
+
+L278: .string "dnvjytrcpgzr"
+red L10
+L279: .string "dpn"
+L280: lea L256, L264
+stop
+L281: .data 945, -33, -803, 988, -516
+bne L254
+sub r0, L280
+L282: stop
+L283: rts
+L284: .string "obgvd"
+jsr *r7
+red L121
+clr r2
+clr r2
+dec L37
+L285: red *r5
+L286: sub L109, *r3
+rts
+L287: .string "qqc"
+L288: inc r2
+L289: red *r7
+red L140
+L290: stop
+L291: .string "hgsbatv"
+L292: cmp r7, L26
+stop
+L293: jsr *r3
+L294: .string "qbivbzwlup"
+sub L175, *r4
+lea L6, L140
+red L116
+L295: add #189, L31
+L296: jsr L27
+rts
+cmp L290, *r4
+L297: sub #237, r5
+lea L266, *r3
+L298: .data 548
+dec *r1
+jsr L226
+L299: red *r3
+red L125
+L300: clr *r3
+mov *r6, *r2
+jsr *r2
+stop
+rts
+L301: cmp *r1, #60
+red L93
+jsr L66
+lea L64, r6
+L302: stop
+not *r2
+L303: rts
+sub *r3, L190
+jmp L248
+prn #-121
+jsr L98
+L304: .data -983
+red *r3
+add r3, *r2
+; comment
+jmp L99
+L305: .data -385, 395, 649, 88, 19, -975, -570, -993
+clr *r4
+prn r2
+L306: .data -548, 593, 441
+
+red *r7
+mov #229, *r3
+bne *r7
+sub L198, L50
+inc r1
+L307: red *r3
+L308: mov r0, r5
+cmp #178, #-108
+L309: cmp *r5, r4
+lea L64, *r2
+prn r3
+L310: mov L36, r6
+L311: not *r6
+jmp L278
+jmp L150
+mov r3, *r4
+; comment
+L312: rts
+rts
+jsr *r3
+clr r7
+L313: not r6
+L314: jsr L278
+clr *r0
+L315: add r6, *r5
+L316: stop
+jmp *r6
+bne *r5
+mov #-154, r2
+L317: .string "fhwp"
+bne *r0
+inc r4
+rts
+L318: sub #53, r0
+sub *r1, r2
+L319: .string "ur"
+L320: prn *r3
+clr L149
+inc L268
+clr *r0
+L321: .string "hiyajwebhtqwqvozfgtz"
+jmp *r4
+not *r6
+cmp *r0, r6
+L322: .data 417, -699, 734, 97, 551, 226, -787, -213
+jsr L263
+L323: mov *r5, L0
+L324: stop
+bne *r3
+L325: cmp r0, r7
+L326: bne L174
+stop
+not *r4
+rts
+jmp *r4
+L327: .string "uaykzqkspfyqcegx"
+L328: cmp r5, L63
+bne L314
+L329: red L18
+jmp *r5
+L330: add #242, r4
+L331: mov r0, r6
+L332: .data -637, 461, -88, -792, 587, -268, 903, -144
+add #-229, *r3
+lea L125, r3
+clr L139
+L333: .data -653, 98, -82, 531, -2, -583, -583
+stop
+stop
+L334: .data 303, -71
+L335: mov *r2, r5
+L336: rts
+clr r5
+not *r4
+rts
+L337: sub #74, r4
+mov r2, *r3
+L338: add #-140, r6
+jsr *r7
+L339: prn *r6
+jmp L76
+stop
+not *r1
+; comment
+; comment
+L340: not *r1
+bne L208
+jsr L42
+L341: jsr *r6
+inc *r6
+red L282
+L342: clr *r7
+mov #-79, r5
+L343: jsr *r7
+L344: clr L43
+sub #-55, *r1
+L345: jsr L57
+L346: cmp #-65, r6
+inc r3
+stop
+L347: prn L285
+dec *r2
+inc r1
+mov #170, L301
+bne L275
+L348: inc *r2
+not r1
+L349: inc L151
+dec L24
+; comment
+L350: not L289
+add *r2, r2
+red L210
+jmp L211
+not L175
+clr *r7
+inc *r7
+rts
+red *r7
+dec L282
+L351: .string "jxhlbgs"
+not L334
+L352: clr L189
+sub *r7, r2
+cmp L99, *r3
+mov L167, r2
+dec *r3
+mov r3, r7
+add L119, L168
+L353: clr *r2
+L354: prn *r1
+jmp *r6
+bne L307
+L355: .string "hjtbaviaetoez"
+inc r6
+L356: red *r4
+
+jsr L265
+L357: sub *r0, r3
+red *r6
+stop
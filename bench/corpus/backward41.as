@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 42
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+not L118
+stop
+dec L303
+L0: sub #-8, L0
+rts
+; comment
+dec *r0
+L1: jsr *r6
+not L1
+lea L1, r0
+inc r5
+stop
+L2: dec r1
+not L0
+L3: .string "exlqvjv"
+L4: .data -927
+rts
+L5: sub *r4, r6
+prn #186
+stop
+L6: jmp L6
+L7: .data 216
+inc r6
+mov r4, *r3
+dec *r2
+L8: mov *r4, *r4
+L9: inc r4
+L10: add r4, r5
+L11: .data -460, 912, -525, -557, -456, -50, 25, 315
+bne L11
+L12: .string "umzalvzcetwgftih"
+L13: jmp L7
+dec r0
+; comment
+prn L0
+cmp r5, L8
+jsr L10
+mov L4, *r2
+lea L10, L2
+stop
+cmp #-80, *r6
+L14: lea L3, *r1
+L15: jsr *r5
+prn r5
+L16: .string "tutjz"
+stop
+dec L10
+lea L14, r1
+L17: red L14
+cmp *r2, *r0
+cmp r7, L2
+red L1
+L18: .string "jk"
+sub L12, *r1
+L19: bne L1
+sub *r3, L4
+L20: .data -575, -273, 524, 382, 888
+L21: mov *r2, L18
+L22: not L3
+L23: .string "anwp"
+L24: stop
+sub L17, *r7
+L25: red L4
+jmp *r2
+jmp *r0
+L26: lea L8, L8
+L27: bne L13
+dec r2
+red L24
+sub #-12, L19
+prn r2
+jmp L9
+clr *r5
+clr L18
+; comment
+stop
+jmp *r2
+
+stop
+inc r5
+jsr *r2
+L28: bne *r1
+red L25
+not *r5
+sub r2, r1
+L29: .string "vmmnrjhnlyvskb"
+clr L11
+lea L12, *r7
+prn r3
+L30: .string "xqeiugkzbhgumnqwtdlhuvl"
+L31: .string "gjlsseikymsqwaovbu"
+dec *r2
+lea L26, r6
+jmp L0
+bne *r1
+L32: .data 647, 495, 513, 177, -635, -139, 402
+inc L17
+sub L22, L11
+lea L5, *r0
+L33: prn L31
+L34: clr L28
+red r0
+L35: .data -77, 125, -484, 726, 854, -385
+inc r7
+L36: dec L6
+L37: jmp L29
+L38: jmp *r1
+stop
+mov *r3, L13
+sub L2, L35
+not r3
+mov r6, L15
+L39: .data 932, -361, -156, 812, -744, 531, -895
+lea L27, *r3
+L40: prn #196
+L41: bne *r3
+red L37
+mov L23, *r1
+stop
+L42: clr *r3
+prn #-188
+prn r4
+clr *r6
+
+L43: stop
+
+L44: dec *r2
+red r7
+L45: sub L20, L32
+jmp *r2
+clr *r0
+dec r4
+rts
+rts
+mov #-81, *r3
+mov *r5, L10
+L46: .string "thluciovksvqngkwmr"
+L47: jmp L20
+lea L3, r7
+bne *r5
+bne L7
+L48: cmp *r6, #179
+L49: .data 902, 340, 441
+add L15, r0
+cmp r5, #-105
+L50: jmp L8
+jmp *r1
+stop
+prn *r5
+dec r2
+L51: jmp *r7
+jmp L11
+lea L24, r4
+add *r3, r6
+L52: lea L4, L1
+L53: dec *r4
+stop
+; comment
+L54: .string "tvolrhmzqraki"
+bne *r0
+not *r5
+L55: cmp r5, *r0
+L56: .data -990
+L57: dec L20
+cmp r0, r1
+not r4
+jsr L53
+L58: not r3
+inc r7
+L59: .string "atrjvmylhmbrx"
+L60: inc *r2
+L61: rts
+sub r5, L46
+bne L24
+L62: rts
+jsr L4
+rts
+L63: bne L50
+mov L2, *r1
+add L21, *r5
+cmp L40, r7
+L64: not *r0
+L65: prn L9
+stop
+L66: mov #-53, L47
+clr L47
+stop
+L67: cmp #61, r4
+not *r4
+jsr *r2
+inc r4
+dec L3
+bne L12
+L68: .string "ka"
+stop
+rts
+prn r1
+rts
+L69: mov L7, L59
+jsr L41
+L70: .data 750
+L71: inc r0
+prn #-68
+
+jmp L68
+L72: red L71
+
+L73: rts
+L74: .string "gghwczov"
+stop
+jmp *r1
+L75: red *r2
+jmp *r4
+inc L65
+stop
+L76: lea L63, L3
+cmp r4, r0
+L77: jmp *r1
+stop
+L78: not *r2
+add r2, L62
+inc r2
+L79: .data 44, -468, 46, 920, 458, 489, -321, 320
+L80: lea L20, L40
+L81: inc L20
+clr L63
+clr L53
+bne *r2
+sub #-58, *r6
+inc L67
+not *r6
+lea L8, r3
+dec *r3
+prn r0
+sub #192, *r1
+not L11
+L82: add *r5, L29
+mov L76, *r1
+red *r6
+rts
+add *r4, *r4
+L83: cmp *r2, L13
+; comment
+jsr *r6
+L84: jmp *r3
+not r6
+rts
+L85: bne L33
+clr *r5
+prn *r0
+stop
+L86: .string "srzbirqaprqga"
+dec r5
+jsr L17
+prn *r6
+L87: red r5
+L88: lea L64, r7
+rts
+stop
+sub *r6, L51
+rts
+L89: jsr *r3
+add #197, *r5
+L90: .string "lu"
+cmp *r6, r4
+jmp *r5
+L91: prn r3
+prn *r1
+L92: bne *r3
+L93: red r6
+jsr L52
+add #-139, r0
+L94: bne L51
+L95: rts
+bne *r7
+lea L47, *r1
+lea L33, L35
+; comment
+L96: red L53
+L97: jsr L63
+jmp L78
+mov #-19, L35
+red r6
+cmp *r2, *r4
+jmp *r7
+cmp L91, r1
+L98: prn L60
+clr L74
+L99: .string "bfzp"
+inc L0
+L100: mov r1, L77
+jsr *r3
+L101: mov *r5, L15
+L102: dec L10
+L103: .data 461
+L104: add L96, L6
+sub r6, *r3
+rts
+
+stop
+; comment
+L105: stop
+prn #-8
+L106: .string "wiulahaynggrebb"
+L107: bne *r7
+bne L104
+; comment
+add #-80, L32
+sub #-43, r5
+lea L93, *r6
+L108: prn #94
+L109: .string "uetbkg"
+bne *r1
+L110: .data 864
+dec L61
+mov L60, L34
+lea L28, L100
+L111: prn r0
+L112: .data -579, -883, 737, 645
+L113: .string "nezzqtgdn"
+L114: jsr L81
+sub r3, *r1
+sub L58, *r6
+inc L99
+L115: clr L53
+jsr L18
+clr r5
+not *r3
+L116: .string "edvzzcdexwakrsgesrpnbi"
+L117: .string "weg"
+cmp L55, #-85
+dec *r1
+clr r4
+prn #238
+bne *r7
+mov r7, L13
+L118: lea L91, L56
+L119: not r4
+L120: inc L85
+; comment
+add #-3, r0
+jsr L116
+L121: prn *r6
+dec r2
+jsr *r0
+inc r0
+jsr *r0
+prn L119
+L122: not r5
+L123: lea L15, *r6
+jmp L83
+L124: clr r2
+L125: sub #81, *r6
+dec L109
+L126: add #-237, *r1
+dec r4
+sub #-77, L102
+L127: not L24
+not *r6
+
+jsr L77
+L128: sub #86, L17
+inc *r4
+L129: .data -960
+L130: .string "cojohjshylwz"
+sub r5, r7
+cmp *r0, *r0
+add #-256, L23
+dec L85
+add L52, L7
+L131: prn r5
+L132: jsr L18
+L133: jsr *r0
+dec *r1
+not *r6
+L134: cmp L99, #214
+L135: jsr L56
+; comment
+lea L75, *r6
+L136: clr r2
+L137: not *r5
+dec *r7
+; comment
+; comment
+dec *r6
+L138: jsr L31
+add r4, *r0
+; comment
+not L35
+L139: rts
+cmp #-66, r3
+jmp L56
+not r3
+rts
+jsr *r3
+L140: dec *r1
+jsr L3
+jsr L131
+clr *r2
+add r7, r4
+prn *r0
+clr r3
+lea L63, L94
+red *r1
+not r6
+L141: .data 246, -445
+dec *r5
+L142: add *r3, r6
+inc L18
+jsr *r6
+
+L143: cmp r5, L64
+red L22
+
+
+stop
+mov #-165, *r1
+
+inc *r5
+L144: mov r0, *r2
+dec L64
+rts
+inc L88
+L145: inc *r1
+inc *r6
+add L129, r0
+rts
+L146: .string "hbodnrbnd"
+red *r5
+prn L23
+cmp r6, r4
+L147: red L96
+inc r6
+L148: .string "rrfhsuxvrjkgh"
+add r0, *r3
+jmp L122
+L149: clr L93
+prn L122
+L150: .string "fbronmchxzyuiotsnkftkkg"
+L151: clr L62
+mov #207, *r7
+jmp *r7
+L152: cmp r6, *r5
+; comment
+stop
+L153: dec L98
+prn r0
+L154: rts
+mov r4, *r0
+L155: dec L144
+lea L93, L60
+bne *r3
+L156: .string "huf"
+L157: .data 494, -316, -591, -369, 225, 672, -877
+L158: jmp L143
+L159: .data -698, 318, 300, -550
+stop
+jsr L101
+L160: prn *r1
+lea L42, *r4
+jsr *r3
+jmp *r7
+L161: prn *r0
+cmp *r0, r0
+bne *r6
+sub r2, L124
+prn *r3
+clr r0
+
+L162: bne *r3
+; comment
+lea L139, r6
+L163: not L132
+sub L76, L64
+rts
+L164: .data -977, 790, 707, 300, -371
+jmp *r7
+L165: add #55, r3
+L166: inc *r0
+L167: stop
+add r4, r4
+clr *r7
+L168: lea L161, L68
+jsr L154
+L169: rts
+L170: red *r4
+lea L114, *r1
+jsr *r1
+not L22
+clr L4
+L171: not r2
+sub r5, r5
+L172: .data -421, -536, -167
+L173: sub *r1, L69
+L174: red L93
+L175: clr L47
+inc L96
+red L130
+inc *r4
+L176: mov *r4, r0
+add #50, *r4
+L177: mov #-253, *r5
+clr L96
+L178: .data 140, -63
+L179: add *r5, r6
+L180: red *r4
+jsr *r2
+sub L78, L39
+L181: cmp L140, L69
+bne L6
+mov #-172, *r3
+L182: rts
+lea L133, *r5
+; comment
+L183: dec L120
+L184: lea L165, L122
+clr *r2
+L185: sub *r1, L154
+inc *r2
+not r4
+L186: rts
+prn r1
+red L94
+sub L117, r2
+sub #-153, r7
+L187: jsr L138
+L188: mov r7, *r5
+not L135
+inc r1
+mov *r5, *r6
+red *r4
+clr L121
+mov r2, *r3
+not L185
+inc *r1
+stop
+mov r5, L76
+L189: .string "svtfinaj"
+bne *r2
+jsr *r2
+stop
+L190: mov L83, r0
+jsr *r6
+red L6
+jsr L110
+cmp *r2, *r3
+; comment
+L191: rts
+stop
+L192: cmp L43, L67
+jmp *r1
+inc L50
+L193: sub r6, *r4
+L194: sub #54, L101
+inc *r6
+stop
+L195: .string "lgkmfsvew"
+L196: jmp L87
+L197: .data -676, -886, 81, 546
+L198: inc L52
+L199: jmp *r1
+L200: clr r4
+dec L93
+clr L17
+jmp L20
+jmp *r3
+rts
+cmp r3, r6
+red *r4
+L201: rts
+rts
+sub *r1, L161
+L202: rts
+L203: sub r3, L132
+; comment
+mov L13, r1
+L204: sub r7, L111
+inc L203
+L205: jmp *r7
+
+cmp #-84, #-144
+inc L46
+red L95
+L206: red L44
+add *r5, *r0
+not r7
+lea L98, r6
+L207: dec L15
+dec r0
+L208: prn #-22
+jmp L155
+bne L4
+cmp r0, L103
+; comment
+rts
+L209: dec *r3
+lea L39, r6
+L210: not L137
+L211: lea L210, r0
+L212: .string "iyoafbpm"
+lea L198, r5
+clr r6
+L213: bne *r5
+L214: stop
+dec L125
+prn *r2
+add #123, r5
+inc L109
+L215: .string "kmghbobqqcavzyorp"
+L216: clr *r0
+L217: add r7, r6
+L218: red r4
+clr r5
+L219: rts
+not r4
+lea L71, *r4
+sub *r4, L152
+mov #-216, r7
+add L96, L153
+L220: .data 86, 951, -920, -687, -296, -409, -532, -522
+bne L141
+bne L115
+dec r0
+jsr *r3
+cmp *r7, *r1
+L221: jsr L93
+L222: cmp *r7, r6
+L223: rts
+add L61, L214
+
+L224: red r4
+stop
+jsr *r6
+dec r1
+L225: cmp *r7, *r3
+clr *r7
+inc *r6
+L226: .data -328, -96
+mov *r5, *r1
+lea L55, L11
+L227: .data -151
+L228: clr r6
+L229: .string "leckharuicdmcnysmzqdjql"
+bne *r2
+jsr L100
+inc *r1
+bne L4
+; comment
+lea L8, L69
+prn L21
+add *r2, *r5
+jsr L214
+stop
+; comment
+L230: .data -957, -531, 628
+prn L34
+sub #85, r5
+L231: add L147, L228
+rts
+bne *r7
+red r7
+L232: dec r2
+clr L29
+L233: bne L82
+L234: rts
+add *r7, r6
+not *r0
+L235: red *r7
+L236: cmp *r2, r3
+jmp L126
+sub L222, L162
+jsr L41
+dec L175
+rts
+jmp L55
+add L35, *r7
+jmp *r7
+jsr L106
+not L91
+L237: .string "iebxrjcqfkmkwmvpnvg"
+L238: inc r5
+L239: bne *r1
+inc r3
+L240: prn *r7
+rts
+clr L239
+mov *r2, r2
+L241: jsr L156
+cmp L103, L228
+not *r6
+jsr *r3
+bne L82
+L242: .data -758, 706, -280, -318
+stop
+L243: prn #233
+not L126
+inc L220
+L244: .data -312, -997, 43
+
+not L140
+L245: .string "q"
+L246: .data 652, -969
+cmp *r7, #240
+stop
+stop
+L247: .data -420
+L248: lea L102, L247
+jmp L156
+not *r1
+L249: .data -689, 745, 304, 893, 611, -446
+clr r1
+bne L177
+L250: .string "vprwjckkzdpppxs"
+; comment
+L251: .string "gctfegqjzcgoijsspxhkorsx"
+bne L137
+not *r4
+prn L114
+stop
+prn L73
+jsr L217
+inc L12
+L252: sub *r7, r4
+sub L55, *r2
+stop
+L253: .data -423, -377
+lea L134, L93
+stop
+L254: .data 863, 879, 819
+add *r5, r5
+L255: .string "josigddknm"
+prn *r1
+L256: red *r1
+L257: clr L136
+L258: .string "sfsybdxedkhxfkdbjgsecd"
+clr L119
+add #168, L144
+L259: lea L105, r5
+L260: stop
+jsr *r5
+clr r3
+add #-31, *r6
+dec r2
+not L26
+jsr L10
+bne *r0
+
+stop
+not r7
+L261: .data -930, 62, 583, 644
+L262: .data -265, -550, 641, -686, 871, -359, -84
+not r2
+jsr *r5
+prn L251
+; comment
+L263: lea L88, *r5
+cmp L210, *r7
+rts
+L264: bne *r3
+dec L127
+inc r7
+lea L160, r1
+clr r0
+L265: .data -733, 820
+dec L180
+red *r6
+jsr *r6
+add *r4, r2
+cmp r5, *r2
+rts
+L266: inc L224
+prn #-59
+L267: .data -629, 49, 599, -870, 496, -923, -970
+
+L268: red L146
+L269: bne *r1
+jmp *r4
+red L4
+prn r0
+jmp L224
+stop
+L270: red r1
+cmp r7, #133
+L271: clr r4
+L272: rts
+dec *r1
+clr L264
+sub L259, *r6
+mov L210, *r4
+; comment
+jmp *r1
+not r1
+L273: .string "cyeoaadujyibcwuclyjom"
+L274: bne *r4
+clr r7
+sub L249, L236
+L275: mov L229, *r1
+L276: .data 853
+not r3
+clr r7
+inc *r7
+jsr L251
+not *r1
+lea L34, *r1
+L277: sub r1, *r4
+clr *r2
+not L45
+clr *r1
+prn #-25
+stop
+bne *r1
+sub L259, L104
+L278: sub r1, *r5
+jsr L134
+L279: .data -742
+jsr L267
+
+jmp *r7
+jsr *r0
+stop
+
+
+L280: dec L1
+dec L29
+sub r5, L272
+stop
+lea L40, r1
+L281: .string "vcg"
+L282: rts
+red *r7
+lea L120, L41
+L283: cmp *r7, L220
+; comment
+lea L226, *r7
+jmp *r4
+dec L129
+red r0
+not r0
+
+
+jsr *r6
+L284: .data 644, 840, 168
+dec *r6
+not *r0
+L285: clr r5
+prn *r2
+rts
+add *r3, L220
+L286: inc L113
+L287: .string "rixtciaghisszkrt"
+L288: clr r7
+L289: lea L189, L177
+L290: cmp #-242, r3
+L291: add *r4, L28
+stop
+; comment
+dec L279
+clr *r7
+inc L86
+clr L247
+not L139
+L292: .string "ucvel"
+L293: .string "lkokncgtzivpmfjegnj"
+jsr L94
+L294: clr *r6
+sub L49, *r0
+prn r6
+dec L286
+mov #-106, *r1
+dec L191
+clr r7
+; comment
+clr L149
+not r6
+jmp L13
+L295: bne *r1
+inc *r7
+L296: jmp *r6
+L297: .string "wwohzjtaytpafmacxkctpf"
+L298: stop
+not *r0
+mov #-154, *r1
+L299: stop
+red *r1
+prn L124
+L300: clr r6
+jsr L230
+L301: not L214
+L302: jmp *r2
+L303: .data 714, 96, 734, -256, 356
+clr *r1
+L304: bne L27
+rts
+bne *r2
+L305: rts
+sub r1, *r1
+L306: inc r5
+bne L284
+
+L307: not L287
+L308: add *r6, L179
+; comment
+L309: .data 329, 638
+L310: .string "xtuieekshfssnb"
+lea L146, *r4
+L311: prn *r1
+inc *r7
+clr *r3
+stop
+inc L300
+L312: .string "lgigzrwvbsmlpoqa"
+L313: jsr *r3
+sub *r3, r3
+add #-179, *r5
+inc *r7
+L314: .data -181, 141, -53, -815, -810, 143
+mov *r2, L308
+not r2
+red *r3
+mov r1, L231
+cmp *r1, L260
+L315: jsr L100
+jsr *r4
+add r0, *r0
+lea L125, L237
+dec r2
+bne L86
+sub *r5, r2
+L316: lea L136, L73
+inc L106
+dec L85
+L317: cmp r4, *r7
+
+
+add L219, L70
+prn #61
+jmp L40
+L318: mov *r4, L293
+jmp *r3
+jsr *r3
+rts
+dec *r2
+red *r3
+L319: .string "vmwestb"
+L320: .data 984, -73, -433, -972, 673, 163, 313
+add *r0, *r5
+not r6
+rts
+L321: .string "pifw"
+L322: .data -501, 177, 652, -886, 977, 360, -266, 98
+L323: rts
+mov *r1, L313
+jsr L74
+clr L66
+dec L127
+L324: mov #-129, *r4
+clr r7
+lea L157, *r1
+L325: sub *r0, L109
+; comment
+cmp *r3, #-28
+L326: not L119
+L327: jsr L148
+sub r2, *r6
+bne L20
+L328: add r0, L318
+L329: .data -255, 796, 961, 100, 268
+red L192
+dec r4
+not L166
+mov #-82, r0
+jmp L120
+not r6
+cmp r7, #-152
+not L169
+cmp L27, *r1
+bne L104
+not *r6
+L330: .string "ndnjhthvnmuzmaeiqqwu"
+L331: clr *r4
+jsr L2
+L332: add #209, r0
+dec *r6
+prn #193
+; comment
+jmp L255
+prn #-30
+inc r6
+sub L53, *r2
+L333: not L271
+jmp *r3
+; comment
+red r6
+jmp L311
+L334: .data -241, 52, -52
+
+L335: jmp *r6
+sub #54, L214
+L336: jmp *r0
+inc *r1
+stop
@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 43
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: rts
+clr *r1
+mov r2, *r7
+prn r5
+L1: red r1
+not L0
+L2: .string "xywpkjjdimwhphtjmqyfaq"
+L3: cmp *r3, L0
+jmp L1
+sub #3, r7
+not *r7
+L4: clr L2
+; comment
+lea L3, r6
+jsr *r1
+bne *r6
+bne *r2
+jmp L3
+jsr L2
+rts
+mov r0, *r2
+mov *r6, L0
+bne *r2
+stop
+stop
+bne *r7
+prn #-226
+L5: mov *r5, L2
+L6: stop
+stop
+L7: .string "hjkzrqvmtlaustcrqgpeu"
+L8: cmp *r3, L4
+stop
+L9: .data 654, 463, 498, -434, -619, -318, -243, 510
+L10: bne *r5
+
+prn L8
+stop
+L11: .string "b"
+jmp L6
+
+L12: .data 118, 996
+cmp #-155, r0
+bne *r0
+L13: .data -569, 851, 191
+jmp *r2
+L14: dec *r7
+L15: lea L8, *r7
+prn *r7
+inc L2
+jsr L4
+L16: clr r5
+not L13
+add #-26, L2
+stop
+rts
+lea L14, L15
+dec L6
+L17: not *r7
+rts
+mov #-75, r0
+L18: jmp *r1
+L19: lea L18, r3
+jmp L12
+dec *r2
+red L10
+jmp *r1
+L20: bne L1
+L21: .data 454, 533, -825, 161, -603
+clr r0
+L22: .string "scshipfokpboaqtyofowuak"
+jsr *r3
+not *r5
+bne L4
+cmp *r1, *r5
+mov r7, r3
+L23: not *r3
+prn r1
+L24: jmp *r4
+L25: .string "yyvoclhbcrrgnqgudyt"
+
+L26: jsr *r5
+rts
+stop
+jsr *r3
+L27: cmp #26, *r5
+clr r3
+add #94, *r3
+L28: lea L22, r4
+mov #-94, r6
+bne *r3
+prn r2
+L29: .string "zgvszzjikxsqylgivnqm"
+sub L22, L28
+bne L4
+L30: dec *r1
+red r4
+cmp *r6, #191
+clr L5
+jsr L26
+add r4, *r4
+mov r2, L12
+L31: .data 341
+inc *r0
+L32: .string "hlhxeboukis"
+clr L29
+add r0, r6
+not L31
+L33: .data 804, -219, -338
+L34: bne L27
+
+mov L33, L27
+L35: .string "kz"
+L36: stop
+add L9, L12
+L37: .string "sxbuiddgdspivlxciiomeheh"
+L38: stop
+add #-183, *r1
+stop
+sub L0, L34
+L39: .string "vbkwius"
+red L9
+clr r4
+L40: .data -584, -934
+prn L34
+stop
+L41: .data 297, -44, -342, -428, 193, 190, 652
+L42: sub #240, L1
+bne L37
+not r6
+; comment
+L43: red *r5
+inc L18
+cmp r7, r2
+
+L44: red *r3
+bne L13
+mov L8, L22
+red r2
+L45: mov L44, *r1
+inc *r2
+L46: red r4
+L47: mov r1, L28
+L48: prn L33
+jsr L36
+jsr L25
+L49: stop
+cmp *r5, *r3
+L50: bne *r1
+jsr *r6
+cmp #120, L49
+rts
+red *r5
+L51: add L35, L1
+L52: .data -387
+sub r7, L16
+jsr *r7
+L53: .data -605, -942, -264, -40, -86, -779, -552, -75
+dec L38
+L54: dec *r5
+L55: .string "rmrz"
+clr L15
+add r3, L42
+cmp r3, #-44
+L56: sub L38, r2
+prn L37
+cmp r6, r6
+sub *r6, r5
+stop
+stop
+prn r7
+L57: sub L54, r6
+lea L28, r7
+L58: inc *r6
+L59: not *r1
+clr L15
+stop
+jmp *r7
+; comment
+cmp #-178, #30
+L60: lea L10, r0
+stop
+jsr L21
+not r0
+jmp L0
+mov *r0, L28
+lea L29, *r0
+mov L31, L15
+sub *r3, r5
+L61: lea L9, *r5
+L62: .data -218, -217, -995, -103, -624, 657, -695, 421
+not *r4
+L63: cmp *r4, r6
+not L14
+L64: sub #241, *r1
+
+L65: dec r2
+stop
+red r0
+L66: sub L42, *r5
+clr *r1
+clr *r4
+L67: .data -961, -762, -905
+cmp L15, *r5
+rts
+prn *r1
+L68: stop
+jmp *r0
+bne L4
+lea L44, r6
+lea L50, *r0
+L69: .data 63
+L70: lea L23, r7
+rts
+bne L38
+L71: inc *r1
+not *r6
+not *r4
+prn #-114
+; comment
+L72: jmp *r5
+L73: .string "clhxnlnhothuimgrvaodeoe"
+L74: sub #203, r7
+prn L38
+not L16
+jsr L15
+not r5
+L75: inc *r5
+bne L69
+lea L24, L62
+mov L35, r5
+L76: bne *r7
+L77: jsr L48
+L78: .string "zfwddws"
+not L44
+add *r2, L76
+rts
+rts
+cmp #128, L11
+lea L72, L34
+inc L31
+mov #104, *r5
+sub #-192, L27
+L79: not r3
+L80: jmp *r3
+rts
+lea L44, L38
+jmp *r5
+mov *r7, *r5
+sub #-220, r1
+bne *r4
+clr L42
+L81: cmp r4, #34
+L82: .data -95, -392, 665, -778, -581, -936, 367, -624
+L83: dec r4
+prn r6
+cmp #-243, L11
+L84: lea L7, L43
+stop
+rts
+dec L78
+L85: jsr L21
+L86: stop
+L87: lea L51, L56
+add *r7, *r4
+L88: .data -280, -203, 738, -231, -703, 866
+bne L25
+red r4
+stop
+L89: mov #235, *r4
+not L40
+jsr *r6
+bne *r3
+add #198, *r1
+jmp L76
+sub r6, *r1
+rts
+L90: clr *r1
+sub *r5, L37
+dec L43
+cmp r2, #-252
+prn L7
+jmp L88
+L91: .data -859, -917, -632, 973, 153, -156
+L92: lea L37, *r5
+L93: dec L44
+red *r6
+clr r4
+stop
+L94: prn L38
+L95: rts
+L96: rts
+bne *r3
+L97: .data -726, -540, -1000, 436, 888, 379, 565, 349
+; comment
+clr *r0
+clr *r1
+stop
+L98: red L26
+L99: dec r0
+L100: cmp #-221, L14
+dec r7
+stop
+lea L72, r1
+lea L5, *r2
+L101: sub L70, L16
+inc *r2
+bne *r0
+jmp L24
+red *r2
+L102: cmp *r5, r6
+clr L73
+; comment
+L103: jsr *r7
+rts
+bne *r6
+bne L21
+L104: inc L62
+bne L75
+L105: inc L41
+L106: jsr L81
+prn *r0
+clr L18
+jmp L81
+L107: not r5
+L108: .data 350, 737, 230, 648, -326, 378, 161
+stop
+jmp L64
+rts
+bne L11
+not r4
+cmp *r0, r3
+rts
+L109: lea L88, r1
+clr *r4
+rts
+red L32
+not L12
+stop
+L110: jmp *r4
+inc r4
+L111: cmp *r5, *r5
+rts
+L112: jsr L99
+L113: sub L14, L12
+stop
+lea L68, L72
+L114: .string "ofpstbhade"
+red L53
+red L61
+L115: mov #189, *r1
+L116: .data -118, 59, 504, -533, 988
+jmp L86
+L117: .string "kyxenvkbtdnmqmcsj"
+jsr *r0
+sub r7, r2
+not L61
+lea L101, *r4
+L118: cmp *r7, #-78
+rts
+L119: mov #-154, *r1
+lea L14, L90
+L120: inc L49
+L121: cmp L26, r5
+rts
+jmp L4
+; comment
+L122: .string "rayihlgngghtnfpslq"
+L123: .data -209, -240, 197, 414, -388, 408
+sub *r4, L78
+L124: sub L46, r5
+; comment
+red r1
+; comment
+jmp L32
+L125: .data -237, 730, -352, -354, -937, 305, 28, 307
+clr L55
+L126: jsr *r5
+L127: clr *r4
+L128: inc r7
+L129: clr L58
+lea L103, *r7
+L130: not r5
+inc r1
+L131: lea L18, r5
+L132: .string "wtmnnpzyterpx"
+dec *r6
+red *r7
+L133: stop
+L134: rts
+L135: rts
+L136: .data -719, -270, -485, -76, 360
+L137: .data 116, -708, -701, 250
+L138: add L115, r1
+bne *r3
+jsr *r2
+rts
+L139: add *r1, r3
+L140: .data -6, -588
+rts
+jmp *r7
+jmp *r5
+L141: not L73
+L142: red *r1
+L143: .data -858, 851, -611, -376, -765
+stop
+L144: red r6
+clr *r5
+L145: dec L36
+dec *r2
+jmp *r4
+L146: .data -763, -855
+
+stop
+cmp *r3, #249
+jsr *r0
+cmp *r4, #71
+L147: lea L108, L40
+stop
+add r1, *r2
+sub r4, *r0
+L148: .string "tm"
+L149: red r6
+sub #-101, *r5
+inc L82
+mov #219, L4
+bne *r2
+lea L121, r0
+jsr L37
+L150: .string "nqhznrchjefmmkeialpuf"
+L151: red r6
+jmp L62
+L152: inc r0
+; comment
+jmp *r5
+L153: mov L87, r7
+red L143
+L154: inc r0
+L155: stop
+inc L10
+stop
+inc *r1
+add *r0, L121
+; comment
+jsr L14
+L156: lea L102, L30
+jsr *r1
+prn r4
+red r5
+jmp *r5
+red L127
+not L91
+sub L33, r5
+not L108
+L157: red r3
+L158: inc L49
+L159: inc *r0
+L160: rts
+clr L65
+L161: .string "qvzkfoqiilhxsnqgbcb"
+L162: jsr L29
+L163: bne L76
+lea L156, *r5
+cmp *r6, r6
+L164: dec r6
+mov L49, L22
+sub *r0, *r6
+L165: .string "tng"
+L166: red L116
+L167: jmp L157
+clr r3
+L168: lea L34, r3
+jsr L122
+L169: jmp L8
+L170: .data -182, -87, -865, 365, 918, -401, -346
+stop
+L171: .data 660, 216, -576, -887, -602, 163, 418
+inc *r7
+; comment
+L172: prn L72
+clr L134
+jsr *r6
+L173: lea L95, *r3
+add L66, *r2
+L174: mov L169, r1
+not *r5
+L175: bne *r7
+mov r1, *r6
+bne *r6
+L176: jmp *r7
+L177: .string "lotpxsywmzqciireqspang"
+add L86, L159
+L178: lea L88, *r3
+L179: sub r7, *r3
+jsr *r6
+bne *r2
+L180: stop
+L181: clr *r0
+L182: not *r5
+prn *r4
+L183: not L42
+L184: .string "irhu"
+L185: .string "cdbqjisedqpxwzfqeenuejm"
+jmp L2
+L186: add #-175, *r4
+L187: .data -597
+L188: jsr *r4
+red L77
+L189: .string "vqmlxwcwcbsl"
+inc r2
+
+mov L36, L142
+cmp *r5, *r6
+jsr L96
+L190: cmp #19, r1
+stop
+stop
+add #-16, L125
+L191: prn L54
+L192: add L120, r2
+L193: mov #-111, r7
+rts
+bne *r1
+add #180, L92
+clr *r0
+jsr *r6
+L194: .data -66, 900, 76, -656, 960, 593, -941, -151
+L195: .data -462, 211, 652, -908, -146
+dec *r2
+sub #215, *r6
+jmp *r5
+jmp L70
+L196: bne *r1
+rts
+mov *r0, L32
+L197: jsr L192
+dec r0
+
+L198: .string "vujgwcsqxsiene"
+lea L142, *r5
+bne L159
+cmp #-72, L94
+L199: not *r5
+cmp L163, *r7
+prn *r0
+; comment
+red *r6
+stop
+
+L200: red r5
+L201: .string "eygpsghebdtvvhhz"
+L202: .string "rpyy"
+L203: rts
+clr L145
+; comment
+clr *r2
+L204: .string "bobgeidavrjdpcltrukqatyg"
+L205: jmp L111
+add *r7, r0
+lea L189, r1
+L206: cmp *r6, L138
+jmp L97
+lea L126, L64
+L207: .string "gtcqymhif"
+L208: .data 411, -150, -508, -773, 866, 222
+not r4
+L209: jsr *r2
+cmp #114, *r3
+red *r5
+L210: .string "hthqqzf"
+L211: .string "sirdzbwwgikxleewcwfxd"
+L212: .string "z"
+L213: dec *r7
+L214: dec *r7
+inc L59
+L215: dec L94
+red L197
+clr r0
+add r6, L9
+not r7
+L216: red r3
+L217: mov r2, r7
+clr *r5
+; comment
+red L114
+jmp *r7
+add #-239, r6
+L218: red L54
+prn #-226
+L219: prn r1
+add r5, r7
+add L93, L192
+prn #-161
+inc r2
+L220: add #80, *r6
+lea L129, *r3
+red *r4
+
+L221: mov *r2, *r4
+bne *r1
+lea L107, r3
+dec r2
+sub #-141, r3
+cmp r3, L151
+jmp *r5
+inc L82
+L222: stop
+L223: red r6
+stop
+prn #-240
+jmp L221
+cmp *r0, #-185
+jsr L73
+mov *r3, *r6
+cmp #164, L115
+bne *r4
+add *r7, r0
+L224: inc r3
+not *r7
+inc r0
+
+bne L198
+jsr *r5
+L225: .string "ohwveagdnalqvifyl"
+jsr *r1
+red L206
+L226: .data 515, -746, 35, -515, 950, 787
+L227: not *r7
+L228: cmp #-132, r7
+lea L66, L80
+L229: .data 364, 373, -151, 999
+L230: jmp L79
+jmp *r7
+L231: .data -644
+inc L187
+rts
+L232: prn #123
+dec L184
+clr *r1
+L233: clr r1
+jsr L187
+L234: add r5, r7
+prn r4
+rts
+clr *r4
+L235: .data 582
+stop
+red *r7
+rts
+not *r0
+clr *r5
+clr r5
+sub #-25, L151
+L236: .data 114, 173, -127, -193, -678, -617, 767
+lea L198, r0
+L237: add r5, r2
+mov #-146, L135
+L238: .data 797
+clr r6
+jmp *r1
+jmp *r2
+L239: dec r5
+mov L217, L7
+; comment
+clr *r2
+jmp L81
+red r0
+dec L172
+mov r3, *r5
+not L160
+
+jmp *r7
+mov r7, *r0
+lea L86, r6
+sub *r6, L58
+lea L115, r3
+inc *r2
+prn r7
+inc L39
+red *r5
+L240: .string "sciarwbjoqtwvozbirr"
+L241: .string "boxqyyesdqobymbyhfkeo"
+stop
+
+cmp *r5, L230
+L242: clr *r6
+lea L53, *r6
+add r6, r0
+L243: .data 525, -112, 368, -193, 21, -114
+cmp r7, *r7
+jsr L100
+cmp *r3, L2
+prn *r7
+L244: cmp *r7, *r3
+L245: dec r1
+L246: clr L207
+L247: .string "fzjcqig"
+add r2, *r7
+rts
+L248: bne *r2
+not *r3
+not L12
+lea L85, *r3
+L249: .string "shpiosiqvkgnbuln"
+L250: rts
+bne L118
+clr *r3
+L251: .data 640, 499, -224
+; comment
+not r5
+L252: .data 328, 461, 138, -646, 969, 675, 55, 920
+rts
+L253: .data 341, -410, -334, 243, 446, 63
+jmp L18
+mov L35, r4
+mov L187, *r5
+L254: .string "atqiowao"
+stop
+L255: clr L48
+mov #-104, L188
+not r2
+L256: red *r5
+L257: stop
+jmp *r4
+L258: .string "jvfdsdxoaxezgytaefqk"
+L259: bne *r1
+L260: dec r1
+bne L124
+L261: sub #-156, *r1
+dec *r0
+rts
+dec r0
+L262: mov L150, L73
+L263: dec L245
+jmp *r1
+L264: not *r4
+L265: .data -915, -436, 735, -396, 677, -544
+mov L169, r3
+L266: red *r7
+mov *r0, *r1
+add L12, r7
+rts
+prn L102
+red r4
+lea L191, r4
+L267: .data 846, -92, -415, -499
+L268: dec L48
+L269: red *r4
+mov #17, L99
+; comment
+L270: stop
+rts
+L271: .data 987, -293, -966, -867, -671, -374, -4, 201
+jsr *r0
+dec r7
+prn *r1
+not L241
+L272: stop
+bne L113
+add L170, *r5
+prn L68
+prn r6
+; comment
+L273: .data 349
+L274: .string "pwzzziqhchzntiuuizilt"
+L275: .data -778, -632, -73, 244, -154, -848, -597, -681
+L276: stop
+clr *r4
+dec *r5
+jmp *r4
+L277: .string "sgqnjjomxqzinvccwybov"
+L278: sub *r4, r3
+L279: stop
+L280: .data -87, 963, 221
+L281: jsr L225
+not L107
+jmp *r2
+clr *r0
+bne L87
+L282: jsr L96
+stop
+not r7
+clr L37
+prn L181
+clr r3
+stop
+sub r4, *r1
+red *r3
+L283: jsr *r6
+bne L65
+L284: .data 665, 482, 176, 647, -11, -265, -807
+jmp L34
+stop
+cmp L56, r0
+; comment
+mov L177, L167
+sub #2, r7
+red *r5
+L285: .data -514, 240, 603, 124, -299, -65, 392, 95
+L286: jmp L165
+rts
+L287: sub #-121, r0
+sub #141, r2
+inc *r0
+stop
+sub #40, L234
+rts
+dec r5
+lea L144, r7
+L288: sub *r4, r3
+L289: .data 122, -532, 214, 356, -465, -850, 872, 45
+cmp L288, L166
+jmp *r7
+L290: .string "lddrhcawvj"
+L291: .string "gomijtayidljmwecn"
+; comment
+jsr L121
+L292: red *r5
+add #-66, r4
+L293: bne *r7
+L294: red r5
+mov *r0, *r4
+L295: not r0
+red L209
+red *r2
+inc r2
+L296: .string "gw"
+L297: mov r1, *r3
+mov L271, *r1
+lea L220, r4
+L298: lea L172, L108
+L299: sub L89, r0
+sub *r3, *r6
+L300: add #-184, L131
+L301: .string "nxefeuwqdxcvzhknzsfmelr"
+mov *r0, r4
+inc L118
+sub *r5, L184
+inc L155
+L302: .data 33, -191, 788, -837, 849
+sub #50, *r1
+cmp #-166, r3
+prn L145
+not r7
+L303: prn *r7
+L304: bne *r2
+inc L275
+sub L64, L59
+bne L89
+rts
+prn #72
+dec r3
+not *r6
+inc L14
+rts
+L305: clr r0
+red L93
+lea L37, r5
+L306: sub r6, r0
+inc *r7
+clr L3
+L307: jmp L179
+stop
+mov L145, L216
+cmp *r1, L183
+L308: clr r6
+prn #219
+L309: add L235, r5
+mov L76, r1
+L310: inc L132
+L311: lea L190, *r4
+not L61
+sub L51, *r5
+red r1
+rts
+cmp #-153, r4
+cmp *r4, r2
+L312: .data -366, 429, 317, -758
+L313: jsr *r3
+mov L221, L182
+bne L220
+L314: clr r6
+clr r1
+L315: jmp L234
+sub L280, L206
+L316: mov L72, r0
+; comment
+add #-223, r0
+L317: .string "okrpndnlzxlwxzgwsopw"
+sub #37, L121
+L318: stop
+L319: .data 738, -286, -994, -638, 309, -520, 596, 622
+red r6
+cmp *r5, #-164
+bne *r5
+L320: .data -826, 222, -837, 951, -979, 40
+sub *r2, *r0
+mov #-153, *r2
+stop
+red L52
+jsr L149
+jsr L264
+clr r0
+L321: jsr L245
+dec *r0
+clr r3
+prn r3
+lea L206, r5
+
+L322: dec r7
+L323: add *r4, L16
+jmp L285
+L324: jmp L247
+inc r6
+rts
+add r6, *r1
+rts
+L325: cmp L110, #239
+bne L196
+inc L230
+dec r0
+stop
+cmp #-220, #145
+jmp *r7
+bne L138
+L326: bne L21
+L327: dec r6
+lea L284, r4
+L328: cmp L85, #148
+jsr *r4
+L329: .data -347, 742, -166, -351, 185, 795, -197
+cmp *r4, #162
+sub #212, *r4
+mov #-201, r2
+L330: red L324
+L331: .data -815
+L332: bne *r0
+add #-119, *r0
+L333: dec *r1
+sub *r5, *r4
+L334: cmp r3, L198
+clr r0
+stop
+stop
+L335: .data 418, 575, 653, -556, 655, 139, -867
+not *r0
+add L106, r4
+stop
+cmp L267, #-102
+clr L263
+red *r4
+clr r3
+jmp L212
+not *r1
+clr *r5
+stop
+sub *r5, *r2
+
+prn L233
+not L59
+lea L71, *r0
+
+dec *r3
+bne L236
+L336: inc L99
+L337: mov #254, r1
+L338: dec *r5
+prn #-33
+jmp *r3
+clr r0
+L339: cmp #-126, #142
+dec *r2
+L340: .string "sjbosidksmwnxwescgvsbm"
+jmp *r7
+L341: .data -716, 778, -798, 933, 305, -713, 666
+cmp *r6, r1
+; comment
+bne L167
+L342: stop
+inc L251
+lea L333, L64
+L343: jmp *r5
+jmp *r4
+lea L12, r6
+jmp *r4
+jmp *r4
+L344: .string "elfgbqsy"
+jmp *r6
+prn #22
+jmp *r3
+L345: .string "rnykull"
+rts
+L346: stop
+mov #195, L267
+L347: mov *r6, r3
+lea L23, r0
+L348: .data 708, 260, 752
+jmp L67
+L349: rts
+L350: mov #50, L282
+stop
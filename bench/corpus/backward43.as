@@ -0,0 +1,1023 @@
+; Generated by genCorpus --seed 44
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+
+rts
+add #120, *r6
+L0: not L0
+L1: bne *r7
+L2: rts
+prn r4
+dec r2
+mov #19, L0
+L3: stop
+rts
+sub r4, L2
+inc r0
+add *r4, r2
+dec *r7
+jsr *r4
+not *r7
+sub r0, r2
+stop
+jsr L3
+jmp L3
+cmp *r4, r0
+sub L1, L2
+add *r7, r3
+L4: rts
+not *r2
+red r1
+L5: jsr L0
+L6: stop
+cmp r3, L3
+red *r7
+L7: stop
+not *r2
+add r6, *r1
+jmp L4
+L8: cmp L8, #-198
+jmp L5
+jmp *r1
+stop
+L9: sub #34, *r1
+rts
+L10: jsr *r5
+cmp #9, r0
+L11: sub #158, r2
+L12: not r7
+L13: clr L0
+lea L1, L12
+L14: prn *r3
+jsr L5
+prn L1
+red r4
+jsr *r3
+L15: not L0
+L16: mov r1, r2
+not *r6
+L17: .data -703, -16, -3
+L18: inc r3
+rts
+cmp #200, r4
+cmp L18, *r2
+stop
+add r4, *r7
+mov *r2, L14
+cmp #53, *r3
+sub *r3, r6
+prn #91
+red L12
+L19: sub *r1, L1
+not *r0
+L20: .string "jccjjcnrrjepusainls"
+jsr *r2
+L21: .data -46, -656, 158, -437, -341
+jsr L18
+sub r3, r2
+stop
+cmp *r2, #-204
+rts
+stop
+jmp *r7
+rts
+L22: .data 254, -753
+L23: red r6
+L24: clr r3
+L25: .string "ktzhvhwkxbc"
+lea L9, *r2
+bne *r5
+lea L16, r7
+L26: .data -660, 261, -489, -974, 696, -919, -675, -459
+L27: .string "gkfqmvyu"
+jmp L27
+dec *r5
+dec r4
+bne *r2
+jmp *r1
+rts
+clr *r5
+L28: .data 630, -380, 501, 68, -974
+L29: cmp L29, #-177
+jmp L18
+dec L19
+dec r3
+clr L5
+L30: bne L13
+cmp #-96, L21
+lea L11, L28
+jmp L3
+L31: stop
+L32: lea L7, r3
+L33: .string "dhhxdabfwetcgpsphyovp"
+lea L27, L2
+dec *r2
+lea L27, r4
+add r0, r6
+L34: cmp L2, #-148
+cmp #240, #78
+L35: prn *r7
+sub L11, r5
+sub #-194, r4
+stop
+clr *r6
+L36: rts
+inc L20
+jmp *r7
+L37: .string "pfptxmtumeqnzpzmfdpih"
+not L1
+red *r7
+sub L10, *r1
+bne *r6
+L38: sub L5, L1
+L39: lea L8, L27
+stop
+L40: lea L2, *r7
+prn r5
+mov *r3, L22
+; comment
+add L39, *r2
+L41: dec *r1
+L42: mov *r4, *r0
+clr r7
+mov L21, r7
+lea L26, *r7
+mov L10, *r4
+add L27, *r6
+L43: .string "vjefirmae"
+L44: .string "iglrnmafaxzs"
+prn *r2
+not L30
+red r5
+L45: bne L42
+jsr L27
+L46: rts
+red r0
+prn *r1
+L47: lea L13, *r4
+L48: .data -3, -398, -557, 997, -251, -300
+mov L33, r2
+sub #-121, r5
+L49: inc *r0
+mov *r7, r2
+jmp *r3
+mov r1, r7
+cmp L14, r1
+L50: .data -367, 681, 440, 871, -756, 493, -660
+prn #-248
+clr *r2
+L51: .data 718, 901, -448
+L52: add *r1, *r4
+L53: add *r5, L13
+dec L37
+cmp #93, r4
+L54: prn r7
+L55: clr L4
+; comment
+add #213, *r2
+mov r1, r1
+add *r3, *r6
+jmp L36
+dec *r3
+dec r0
+
+L56: bne L56
+clr L5
+rts
+clr L3
+L57: jmp *r2
+not L49
+red *r2
+bne L7
+rts
+not *r2
+; comment
+bne L2
+cmp L20, #-121
+L58: bne L58
+L59: bne *r6
+jsr *r6
+L60: jmp *r3
+prn L18
+add r3, *r1
+L61: jmp *r1
+stop
+inc L22
+red r4
+add r2, L25
+L62: .data 851, -821, 378, 401, 456, -195
+jmp *r5
+L63: red L20
+dec r5
+bne L4
+L64: clr r3
+L65: stop
+prn L19
+L66: inc *r6
+L67: sub L66, r5
+add r4, *r0
+not L48
+L68: jmp L66
+L69: .data -207, -285, 304, -551
+bne *r3
+L70: not r2
+L71: sub L21, *r5
+lea L47, *r2
+bne L21
+jsr *r3
+sub r0, r2
+L72: .data -715, 228, 571, -968, -85, -967, -786, -746
+jsr *r7
+lea L40, r0
+L73: .string "ncpxolerqzkhswwezaa"
+stop
+jsr L35
+rts
+sub *r3, *r1
+not r0
+jsr *r1
+mov r6, L6
+jsr L1
+add #-149, r3
+L74: jmp *r7
+sub #81, L26
+clr *r2
+red *r3
+L75: .data 618, -620
+red L18
+bne *r4
+red r6
+sub *r3, r0
+lea L53, *r5
+add #143, r1
+; comment
+cmp #154, *r5
+prn *r6
+rts
+bne *r5
+stop
+L76: add r4, *r4
+; comment
+L77: stop
+L78: add #200, L44
+rts
+inc *r4
+L79: .string "xfgvoahlbrtcwd"
+jsr *r4
+clr *r7
+jsr L20
+add L55, L15
+prn L18
+L80: inc L11
+L81: jmp L35
+prn *r4
+sub #250, *r4
+L82: prn L11
+stop
+; comment
+dec L11
+rts
+L83: sub L76, L55
+L84: lea L49, r1
+L85: red *r1
+cmp #-86, *r0
+not r3
+L86: .string "mmlhromrkxbvju"
+L87: red r1
+add #-190, r0
+jsr *r1
+jsr *r2
+clr r0
+mov L48, r6
+bne L22
+jmp *r0
+L88: lea L46, *r0
+clr L4
+L89: jmp L50
+jsr *r4
+L90: bne *r0
+L91: jmp *r5
+L92: mov #-205, L29
+rts
+jsr L88
+inc *r6
+rts
+bne *r2
+L93: clr L32
+stop
+; comment
+sub r0, r7
+sub #-153, r6
+mov r3, L45
+inc *r0
+inc r2
+add L73, L85
+cmp *r6, r5
+not *r4
+dec L64
+L94: clr *r4
+L95: clr L64
+L96: inc r1
+prn *r4
+L97: .string "wckmvhvlgzcqj"
+red *r7
+jsr *r7
+add #-88, L1
+jsr *r0
+cmp *r3, r1
+add #-249, *r4
+L98: mov r4, *r2
+; comment
+L99: .string "isyeqsitapgtmj"
+L100: jmp L16
+red *r5
+; comment
+L101: .data -448, 466
+mov *r3, *r7
+cmp #160, *r1
+L102: not *r0
+mov *r7, *r5
+jsr *r0
+L103: .string "ejwigtaibxng"
+L104: .string "pcstdnve"
+lea L67, r1
+L105: .data -901, -153, -204, -389, -61
+L106: add #46, *r3
+not *r4
+clr L40
+L107: .string "vjqz"
+
+L108: prn *r1
+L109: not r2
+L110: .string "tyfvekkjjznlvht"
+add r6, r0
+clr L26
+L111: add *r7, L85
+rts
+L112: stop
+L113: cmp r1, #130
+jmp *r5
+clr *r6
+L114: .string "tevhvxmmgc"
+L115: .string "eankfpxtlpnuxwvrvkvoxb"
+lea L80, r5
+lea L93, *r7
+L116: rts
+sub *r0, r0
+L117: clr r4
+inc r3
+sub r3, L15
+clr L32
+L118: .string "lrh"
+mov L113, r0
+L119: .data -451, -659
+L120: jsr L14
+L121: .string "orwodrvkailb"
+L122: jmp *r6
+L123: .string "hhpyfcslkgmjazbxcjtjiely"
+mov L40, r5
+inc r0
+rts
+jmp *r2
+jmp L4
+L124: jmp *r2
+inc *r5
+red L111
+L125: dec *r3
+not *r5
+L126: dec r5
+L127: .string "uqycfwgvhdxfkujoqf"
+bne *r3
+L128: stop
+L129: .data -828, -929, 151
+mov r4, *r4
+rts
+stop
+L130: rts
+L131: prn r0
+not L7
+prn *r5
+L132: inc *r5
+sub r1, L92
+mov *r3, *r1
+clr L94
+L133: lea L124, r4
+prn r7
+inc r5
+add *r6, L3
+add r5, r4
+bne L107
+L134: dec *r4
+not r0
+L135: .string "llzftphvtmojbv"
+L136: not *r7
+L137: red *r5
+not *r0
+jsr L51
+L138: mov #-150, r4
+stop
+jsr L67
+red r3
+rts
+L139: sub r3, L37
+L140: cmp *r7, L32
+cmp r5, #-160
+add r5, L29
+L141: sub r1, *r4
+stop
+cmp #152, L42
+L142: add r4, *r5
+mov L110, *r4
+prn *r4
+stop
+stop
+red *r2
+jmp L134
+L143: .data 150, 188, 364, -724
+sub r3, *r2
+L144: prn #133
+jsr L4
+rts
+mov #135, L2
+L145: dec r3
+jsr L90
+bne *r0
+L146: mov r5, r5
+sub *r3, L85
+inc r1
+L147: mov r7, r3
+rts
+add L3, L36
+L148: clr *r4
+L149: mov r6, *r0
+stop
+prn #-65
+clr r7
+jsr *r4
+add #247, L71
+clr r0
+inc r3
+L150: rts
+; comment
+L151: rts
+inc L148
+stop
+red *r1
+L152: sub *r7, L60
+stop
+red *r4
+clr *r3
+L153: .string "bhy"
+L154: mov r5, r1
+
+mov L1, r7
+lea L92, *r2
+L155: inc L59
+L156: red r1
+sub #243, L142
+L157: dec *r4
+L158: jsr *r3
+bne *r5
+mov L85, *r4
+dec *r3
+not r6
+bne *r0
+jmp L144
+prn #-201
+L159: .data -718, -80, 379, -271, 544, 131
+cmp #-9, r1
+; comment
+L160: .string "fpcxjqevksetkvqmpn"
+clr L158
+red L56
+cmp r3, *r2
+not L140
+jmp L138
+cmp r5, #-170
+L161: rts
+lea L31, *r5
+add *r1, r1
+jmp *r7
+prn L2
+L162: inc *r2
+prn #-61
+prn L57
+sub r3, L122
+L163: sub #-144, r5
+L164: dec r1
+jmp L116
+L165: red *r3
+mov #142, r4
+mov #167, *r4
+cmp L88, *r1
+add L89, r3
+jmp L10
+L166: not *r0
+lea L21, r6
+L167: clr r7
+prn r3
+cmp *r7, *r4
+add L10, L53
+jmp L155
+mov *r5, L114
+rts
+bne *r2
+red *r5
+not L3
+not r3
+rts
+L168: sub r1, r6
+L169: lea L125, *r4
+rts
+L170: dec *r5
+sub r7, r1
+sub #-150, r6
+add *r1, *r4
+lea L6, *r5
+L171: .data -959, 485, 73, -654
+sub r2, L165
+L172: .data -41, -802, 224, 748, 863, 524, -651
+dec L38
+inc L6
+sub r6, r2
+inc *r5
+L173: .data 605, -866, -159, -888, -310, 657, -384
+
+L174: inc *r3
+clr r1
+L175: jmp *r0
+add L20, L145
+rts
+L176: mov *r3, L39
+L177: .string "hfqhbnuezkzi"
+L178: not *r5
+; comment
+dec *r5
+cmp r1, r1
+jmp *r1
+L179: red L112
+red *r0
+L180: .data -924, -647, -56, 224, 195, 819, -845
+L181: .data 125, 306, -958, -491, 954, 632
+lea L121, *r5
+sub r2, L71
+jsr L1
+sub #-239, *r1
+; comment
+
+rts
+prn r3
+L182: cmp L57, L58
+clr *r1
+mov L179, r0
+L183: red L125
+L184: .data 906, 623, 232, 655, -706, 995
+L185: .string "zdfpjtjg"
+not r3
+red *r0
+sub L94, r6
+; comment
+stop
+bne *r4
+inc *r2
+
+jsr *r1
+L186: add *r0, *r3
+; comment
+sub L19, L144
+L187: lea L51, *r0
+clr *r6
+L188: cmp L56, #30
+L189: sub r3, *r1
+stop
+clr *r7
+not L48
+bne *r1
+inc *r1
+jmp L80
+cmp r6, #220
+L190: jsr L64
+mov #-45, r1
+jsr L6
+sub #51, r5
+not *r2
+L191: bne L109
+mov L181, *r4
+not *r6
+L192: .data 579
+L193: clr r0
+L194: .string "witgdonolx"
+stop
+cmp *r7, L83
+bne L77
+prn L71
+inc r5
+L195: lea L106, r6
+L196: jsr *r7
+
+mov #-98, r2
+lea L52, *r2
+L197: .string "szpklsehcmhuudidvh"
+sub L197, *r5
+clr *r5
+L198: jmp *r2
+L199: clr *r0
+L200: .data -864, -649, -718, -4, 363, -232, 546, 509
+jmp *r0
+not r5
+L201: .string "juwgmthkjmuflcqqa"
+jmp L7
+lea L4, *r0
+L202: clr *r1
+clr r5
+lea L100, *r6
+L203: inc L65
+L204: jmp L204
+L205: prn r2
+L206: clr *r2
+red r1
+stop
+sub #-147, r5
+clr L122
+L207: sub *r5, L48
+lea L155, *r1
+stop
+jsr *r5
+not *r6
+not *r6
+dec r2
+L208: cmp L84, #206
+L209: lea L8, *r1
+red r6
+inc r0
+L210: inc r5
+dec r4
+jsr *r6
+lea L142, L99
+L211: .string "gkvnnuzcraeqxenzxymoe"
+bne L102
+add L196, *r5
+; comment
+stop
+rts
+L212: .string "pyfbjrfltbrapcpndebci"
+L213: cmp *r4, *r5
+bne L99
+L214: clr r3
+mov #-23, r3
+cmp L112, L174
+mov *r7, L114
+jmp L200
+L215: .string "wvnrzashjhmfmntd"
+lea L137, L111
+L216: .string "q"
+prn #-2
+
+inc r2
+L217: .string "ovu"
+cmp r7, *r7
+L218: cmp #-161, *r7
+L219: .data 273, -635, -506, -198
+L220: cmp r6, #-2
+prn r1
+dec *r3
+dec r2
+inc L104
+L221: prn L131
+stop
+L222: cmp *r2, #155
+rts
+L223: lea L145, *r5
+inc L144
+L224: sub #-175, *r1
+lea L18, L76
+jsr L151
+L225: mov L120, r0
+L226: prn L95
+jsr L218
+L227: .data 742, 384, -284, 169, -568, -432, -600
+stop
+L228: not *r5
+mov L138, *r4
+mov *r3, r0
+rts
+lea L212, *r2
+cmp L98, L118
+clr L198
+dec L60
+not *r6
+prn L5
+rts
+L229: .string "scrdqlexjuhtg"
+sub r1, r2
+L230: stop
+sub L60, *r5
+jmp *r4
+L231: .data -66, -741, -359, 339, 463, -162, 596, -816
+add L121, L194
+dec L199
+clr *r6
+L232: .string "yhlagh"
+L233: prn L163
+L234: mov #147, L66
+; comment
+cmp L113, L84
+inc L85
+mov L109, r4
+sub *r0, r5
+dec r4
+jsr L229
+stop
+L235: prn *r5
+mov L233, r3
+jsr *r4
+L236: clr r5
+dec L5
+jsr L196
+sub *r7, L66
+L237: cmp *r2, *r7
+red *r4
+mov r0, *r0
+rts
+jmp L228
+L238: .data 319
+inc L163
+L239: .string "widppvxpuwbwktygcyp"
+jsr *r5
+add #187, L201
+L240: dec *r0
+L241: sub L206, *r0
+L242: .string "ldkypexuabrrvw"
+prn *r2
+; comment
+L243: .string "hiykphgfqgppltv"
+jmp L12
+L244: jmp *r6
+L245: .string "eisukzqbztkrjq"
+dec r3
+L246: sub #129, *r5
+prn *r6
+red r0
+cmp #-207, L132
+sub L34, r5
+L247: rts
+stop
+dec *r4
+L248: clr r1
+stop
+
+prn *r6
+not r7
+jmp L17
+L249: lea L58, r6
+prn L62
+bne *r5
+
+stop
+lea L179, r5
+dec *r6
+jmp *r4
+rts
+jmp L167
+red *r6
+L250: sub *r2, *r6
+mov *r1, r2
+jmp *r1
+lea L30, *r3
+cmp r6, *r0
+clr r4
+L251: .string "flywtzsrg"
+red L205
+L252: cmp L65, r7
+bne *r3
+prn L143
+L253: .data -174, 999, -425, 650, 710
+rts
+rts
+mov *r3, L16
+L254: .string "mpswny"
+jsr *r7
+L255: prn #-255
+L256: not *r4
+; comment
+L257: prn #-101
+L258: .string "lhrgbdypkos"
+dec r7
+L259: lea L222, r2
+red *r4
+red L68
+jmp *r0
+not *r4
+L260: .string "j"
+clr *r3
+add *r1, *r2
+L261: .data -463, 907, -725, -627, 917, 252, -732
+L262: mov r3, *r7
+clr *r6
+dec *r1
+L263: .data -878, -59, -38, 781, 182, 178
+prn r0
+lea L191, r1
+mov #-67, r4
+add *r4, *r5
+L264: jsr *r1
+stop
+not L98
+L265: red r3
+cmp *r4, L109
+L266: stop
+jsr L10
+
+L267: sub *r4, *r2
+stop
+jmp *r3
+clr r6
+stop
+L268: .string "gimiazdujceyguaimxcmyxd"
+sub #228, *r1
+prn L120
+L269: .data 991, 566, 63, 235, 220
+L270: .data -322, 334, 49, 174, 990
+red *r6
+L271: jmp *r0
+L272: lea L262, L131
+sub L253, *r3
+L273: inc r7
+dec L189
+L274: lea L0, L109
+add r0, *r0
+add #86, r4
+stop
+stop
+clr L124
+L275: red r0
+lea L260, r4
+jsr L199
+L276: cmp #46, *r3
+L277: red r5
+
+L278: jsr *r1
+add L261, L163
+L279: prn r3
+lea L120, L169
+mov #-105, r4
+mov r3, r5
+L280: clr L35
+L281: prn #188
+L282: .data -950, 991, 987, -520, -387
+inc *r3
+L283: stop
+sub #213, *r2
+L284: mov #125, r5
+L285: rts
+add r5, L165
+L286: red r6
+jsr *r2
+prn *r7
+dec *r6
+L287: .string "xn"
+stop
+cmp L259, #221
+lea L77, *r4
+mov L2, *r5
+rts
+jmp *r5
+inc r2
+
+L288: inc r2
+L289: .data -439, 48, -643, -428, 184
+inc L149
+add L78, r5
+lea L202, L241
+dec *r1
+clr *r2
+dec r6
+sub *r6, *r3
+L290: .data -610, 351, 526, 403, 709
+jmp *r4
+L291: dec *r7
+sub *r3, r4
+L292: .string "shkyeujeensxxi"
+prn r1
+; comment
+inc *r3
+inc L138
+lea L261, *r0
+L293: dec r3
+rts
+L294: .string "uyshlwbgx"
+jmp L59
+L295: sub L130, *r4
+not r4
+L296: .string "w"
+jsr *r0
+not L41
+
+L297: prn *r3
+jmp *r1
+jmp *r0
+L298: inc *r1
+inc r2
+; comment
+bne *r0
+prn #248
+mov #-253, *r4
+; comment
+L299: jmp *r4
+lea L109, *r3
+L300: red r7
+L301: .data 726, -579, 27
+jmp *r0
+mov L245, L62
+red r5
+; comment
+bne *r2
+stop
+rts
+add r0, r7
+prn L223
+L302: clr *r1
+not r4
+sub L77, *r4
+L303: red L156
+not *r0
+L304: stop
+not r5
+L305: not *r1
+rts
+jsr *r7
+dec r7
+L306: .data -414, -378, -237, 114, 358, 843, 813, -842
+L307: .data 579, -13, 972, -112, 255, 773
+jsr *r2
+prn #-13
+L308: red L228
+cmp L61, *r1
+add L214, L275
+rts
+cmp #-144, *r4
+jsr *r5
+dec r5
+L309: prn L224
+L310: .data 550, 757
+L311: .data -721, 932
+clr r3
+clr *r3
+L312: jsr L157
+L313: dec r3
+L314: not *r1
+jmp *r5
+L315: rts
+L316: cmp r6, L278
+sub *r2, L310
+jmp *r5
+L317: bne L114
+L318: bne *r0
+bne *r0
+L319: not r4
+sub *r3, *r1
+add r3, *r1
+L320: bne L37
+L321: mov r7, *r5
+L322: .string "dnaltke"
+add #205, L318
+
+sub *r3, L43
+cmp r5, *r7
+bne *r6
+prn L196
+L323: prn L150
+L324: clr L299
+not r2
+L325: red r1
+L326: stop
+inc r2
+L327: mov *r0, r5
+lea L4, L133
+L328: rts
+mov #245, r3
+
+add *r5, L281
+mov r4, *r4
+L329: red r5
+lea L35, *r6
+stop
@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 45
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: stop
+not r5
+; comment
+red L0
+L1: mov L0, r4
+cmp *r5, r4
+clr r7
+L2: .data -651, -331, 488, -80, -189, -886, -114
+cmp L2, L1
+add L2, L0
+L3: cmp r1, L1
+sub #193, L3
+inc L2
+L4: prn r4
+inc *r4
+L5: red r6
+L6: dec r6
+mov *r2, *r2
+lea L0, *r7
+dec r1
+not *r4
+L7: stop
+L8: .string "fytuqukunbybp"
+not *r7
+lea L5, *r4
+dec *r1
+inc r5
+stop
+cmp r6, *r2
+clr L6
+L9: dec r7
+add r6, *r5
+inc *r1
+stop
+L10: stop
+L11: .data -923, 210, -145, -923, -509
+sub #-194, *r4
+L12: .string "kibbcksjv"
+L13: lea L8, r7
+jmp L7
+jsr *r5
+clr *r7
+jmp *r2
+bne L6
+mov #-37, *r3
+L14: .string "hszihtmhqncamrqhpguy"
+L15: inc r6
+dec *r6
+L16: mov #40, L2
+L17: rts
+lea L5, L6
+red L0
+L18: stop
+L19: mov r7, *r0
+L20: .string "szav"
+rts
+lea L3, *r3
+L21: clr *r2
+L22: rts
+not L16
+L23: clr *r6
+L24: .string "dzkaxdmk"
+L25: jsr L20
+L26: stop
+L27: stop
+rts
+mov *r0, L25
+L28: .string "ls"
+stop
+dec *r3
+L29: sub *r2, r7
+; comment
+add L10, r6
+red *r3
+bne *r5
+L30: .data -324, 903, -92, 384
+L31: clr r4
+L32: clr L23
+bne L12
+L33: mov *r4, r6
+L34: .data 500, 751, -157, 232, 276, 553, -218, 403
+L35: dec *r2
+L36: rts
+jmp L31
+; comment
+clr L23
+clr *r2
+jmp *r0
+not r6
+L37: red *r2
+lea L26, L27
+sub L19, L7
+L38: lea L4, *r6
+mov *r2, *r0
+sub #202, r6
+rts
+L39: inc *r7
+lea L29, L23
+L40: rts
+jmp L4
+red *r4
+L41: lea L36, L34
+L42: not *r4
+cmp *r3, L40
+rts
+rts
+mov L39, r1
+jmp *r3
+L43: cmp L11, r0
+bne L1
+dec *r5
+L44: inc L31
+jsr L30
+jsr *r5
+L45: mov r3, r1
+jmp L5
+; comment
+dec r7
+mov *r7, *r2
+L46: not L28
+; comment
+L47: .string "jkmpxvxskkqoxxjxulumrbv"
+mov r5, L21
+L48: sub r7, r2
+not r4
+stop
+jsr L43
+L49: .data -190, -797, -765, 661, 118, -529
+bne L47
+inc r3
+L50: mov *r2, L28
+prn #-33
+lea L8, *r6
+jsr *r7
+mov r5, *r7
+L51: cmp L17, L43
+clr *r3
+L52: add #-25, *r3
+jsr *r2
+L53: jsr *r1
+L54: inc *r3
+prn r6
+mov #12, L11
+inc L10
+prn L25
+clr L35
+add L27, L23
+not *r5
+L55: .data 193, 43, 992, -264, -258, 675, -689, 511
+not L43
+lea L38, L3
+dec L30
+clr L2
+lea L18, r2
+inc r1
+not L38
+not r5
+L56: .data -76
+prn r6
+rts
+jsr *r5
+stop
+L57: jmp *r6
+L58: jmp *r6
+L59: rts
+not *r7
+L60: jmp L58
+jmp *r5
+mov *r6, L56
+mov #201, L43
+lea L4, *r5
+mov *r7, *r6
+L61: not *r6
+red r1
+red L20
+clr L43
+; comment
+cmp r1, r0
+bne *r2
+inc L38
+inc r6
+clr *r2
+L62: mov *r0, *r7
+jmp *r6
+clr L52
+L63: .data 879, -367, -685, 355, -790, 614, 134, -879
+jmp *r3
+mov r2, r2
+L64: rts
+lea L3, L53
+bne *r7
+clr r6
+L65: lea L19, *r4
+lea L14, r0
+L66: inc L47
+lea L39, L56
+; comment
+sub L29, r3
+add #128, L23
+clr L9
+mov r4, r5
+L67: prn #114
+L68: jmp *r7
+cmp L3, r6
+add L20, *r3
+L69: jsr *r6
+; comment
+L70: .string "tgtygbmtginc"
+lea L1, L42
+not *r4
+
+cmp L39, r6
+L71: .string "kusiclcp"
+sub #158, L41
+jsr L3
+jsr L29
+rts
+L72: clr r3
+prn #-22
+L73: add #-66, *r0
+dec L4
+L74: lea L49, r7
+sub #221, *r3
+L75: .data 979, 955, 543
+L76: add *r3, L25
+jmp L50
+not r3
+L77: .string "dlzteb"
+L78: cmp L11, *r6
+clr *r5
+lea L25, r3
+add #103, *r1
+rts
+cmp #104, #-12
+L79: bne *r4
+dec L34
+rts
+L80: .string "irnryu"
+mov #-82, L52
+L81: jsr L47
+L82: clr L26
+L83: dec r0
+cmp #-242, #-25
+L84: .string "zowapva"
+lea L53, r3
+L85: jsr L48
+prn #-249
+jmp L41
+jsr L43
+mov r1, r6
+jsr L51
+prn *r2
+add *r6, r1
+rts
+jsr *r5
+L86: .data 609, 931, 970, -103
+
+red L4
+inc *r6
+bne L33
+L87: red r2
+inc L45
+stop
+cmp *r1, *r5
+sub *r5, r5
+L88: bne L70
+jmp L54
+L89: .data 426, -299
+stop
+L90: lea L7, *r3
+lea L85, L73
+L91: .data 340, -719, 856, -261, 6
+jsr L17
+L92: inc *r0
+L93: .string "ndqakqlxebzhzmufnuvno"
+L94: lea L22, *r0
+L95: stop
+add *r0, *r6
+L96: .string "dejfdfupfracqqj"
+L97: prn r5
+prn #195
+clr *r0
+dec L24
+rts
+dec *r2
+; comment
+stop
+jsr L29
+jmp *r5
+jsr L64
+L98: .string "lhyhhshwufxkxqu"
+L99: inc *r2
+cmp r6, *r6
+L100: bne L10
+jsr *r6
+L101: dec L16
+rts
+lea L83, r3
+stop
+stop
+L102: clr r2
+L103: not L33
+add #57, L93
+prn L4
+L104: lea L101, *r5
+dec L38
+cmp r7, #21
+L105: lea L5, *r7
+bne *r4
+L106: sub *r5, L62
+jsr L41
+clr r0
+jsr L69
+cmp L53, *r1
+rts
+stop
+L107: stop
+add r5, L57
+L108: jmp L78
+L109: sub #64, *r5
+L110: lea L62, *r5
+L111: clr r7
+sub L101, *r3
+rts
+sub L83, r7
+rts
+L112: .string "lbdlp"
+sub r5, *r1
+inc L32
+inc L110
+; comment
+rts
+inc r6
+L113: .string "ojpbkksswi"
+mov r6, L62
+L114: lea L91, *r7
+add L43, r2
+clr *r7
+L115: bne *r1
+prn L30
+
+dec r6
+L116: .string "rmrlcrweuhzjfvvyoniojgu"
+stop
+jsr L50
+L117: sub L27, *r2
+L118: cmp L79, *r3
+inc *r3
+cmp r3, L35
+L119: mov *r7, *r6
+L120: stop
+L121: .string "byeckynjriqirfcwve"
+not r6
+dec *r6
+mov L111, L72
+L122: add #25, L108
+clr *r1
+sub *r5, *r2
+inc r7
+jmp *r2
+bne L78
+lea L23, *r3
+bne L49
+jmp L115
+; comment
+rts
+lea L55, *r4
+L123: bne L81
+L124: jsr L110
+cmp *r7, #177
+L125: .data 935, 162, 616, 179
+jmp *r0
+L126: clr *r5
+L127: clr *r2
+bne *r2
+dec *r0
+L128: stop
+jsr *r1
+L129: .string "mrdsyldliamfeyboaliaias"
+
+L130: inc r3
+stop
+dec *r4
+L131: inc L59
+L132: rts
+stop
+cmp #-92, L15
+lea L98, *r4
+L133: .data 146, -509, -589, 740
+sub *r1, L49
+L134: add L126, *r2
+mov r1, L81
+L135: dec L105
+clr *r7
+L136: .string "cqsvvqkxsfeejytzuesiuudt"
+red r2
+L137: rts
+not L98
+L138: jsr *r0
+lea L91, *r7
+L139: .string "cho"
+inc L85
+rts
+L140: prn #176
+mov L51, L134
+L141: prn L43
+L142: dec L29
+
+L143: .string "yqbwjecsgirtdqkucc"
+L144: jmp L55
+L145: dec r7
+L146: .data 921, -604
+rts
+not r7
+bne L45
+L147: stop
+inc *r5
+not L17
+clr *r6
+prn #-168
+jmp *r5
+jsr L139
+L148: .data -383, -635, 380
+dec *r0
+stop
+inc L80
+prn L70
+red r0
+
+L149: .data -927, 342
+L150: jmp *r3
+prn L143
+L151: sub L67, L27
+L152: prn r4
+L153: lea L98, r4
+jsr *r1
+L154: bne *r4
+L155: .string "erefb"
+L156: add r7, L12
+mov r0, r5
+stop
+mov *r4, L153
+mov #141, r4
+L157: jsr L142
+sub *r4, r6
+lea L67, *r4
+L158: jsr *r2
+jsr *r0
+prn r3
+lea L100, r2
+L159: .data -604, 796, 575, -632, 500
+; comment
+jmp L78
+bne *r0
+lea L75, *r0
+; comment
+dec *r2
+L160: .string "xbhsjzzyjjcpjvsyepadthkw"
+L161: not *r0
+clr L21
+L162: sub r2, *r5
+add #-107, L67
+L163: add *r4, L115
+L164: .data 353, 589, -105, 500, 128
+mov L80, *r4
+cmp *r1, #-1
+lea L40, *r3
+stop
+clr r6
+mov L136, L38
+L165: cmp *r6, *r1
+bne *r6
+L166: not *r2
+L167: stop
+L168: .string "irsygdpvx"
+L169: dec L54
+mov L45, r4
+cmp L56, *r2
+L170: sub L65, L2
+jsr *r0
+L171: jsr *r6
+L172: not r2
+; comment
+bne L40
+jsr *r1
+prn *r7
+stop
+L173: prn L92
+jmp *r3
+
+add L115, r3
+L174: .data 827, -912, -205, -500
+jmp L53
+clr L19
+red r2
+add L38, *r4
+L175: mov *r5, r2
+L176: .data 14
+bne *r0
+cmp L6, *r7
+red r3
+prn #195
+not L151
+add r6, *r0
+dec L139
+lea L38, r5
+L177: lea L27, r7
+L178: clr L17
+L179: bne L137
+add r7, r1
+L180: red *r1
+L181: .string "spvv"
+jsr *r6
+L182: .string "ypoofzqphbiwqvzc"
+lea L60, r3
+L183: prn r0
+add L157, r0
+cmp r2, #161
+sub #-237, r7
+L184: .string "qgebtp"
+dec L178
+L185: sub #-198, L108
+jmp *r2
+jsr *r2
+prn #-19
+L186: .string "cnhvrag"
+L187: inc *r5
+red L23
+L188: dec r2
+stop
+not r3
+L189: mov L6, *r5
+clr r3
+L190: mov r1, *r1
+dec r3
+L191: jmp L13
+L192: jmp *r6
+jmp *r2
+mov *r7, r0
+L193: .data -255, -418, -988, 369, 720, -832, 215, 272
+dec *r3
+; comment
+inc *r2
+rts
+not L140
+L194: .data -921, -427, 540, 497
+L195: sub L20, L155
+L196: red *r1
+bne *r0
+rts
+L197: rts
+lea L163, L141
+L198: clr L3
+bne L40
+jmp L22
+inc *r1
+L199: .string "ksdcatytiqxfxclpptxpfhia"
+L200: cmp L5, *r4
+not r5
+L201: .string "ouevegavmjvw"
+L202: cmp L157, *r4
+sub L75, L63
+dec *r7
+jmp *r5
+cmp r6, #252
+bne L191
+red r6
+add r0, L133
+not L81
+L203: jmp *r6
+rts
+jmp L115
+L204: .data -214, -709, 845, -461, -602, 656, 539, -679
+; comment
+inc *r2
+L205: mov #-108, L89
+add L89, L57
+L206: .string "fwafnhtpgfgmlm"
+not L187
+stop
+L207: .data -551, 287, -770, -569
+jsr *r4
+dec r1
+L208: clr *r1
+L209: dec r5
+stop
+L210: .string "rahpahbfnbyq"
+lea L209, r6
+stop
+cmp *r6, L178
+cmp #2, L176
+red L21
+L211: jsr *r7
+jsr L72
+L212: lea L149, L37
+L213: bne L17
+L214: bne L167
+jsr L173
+bne *r5
+stop
+rts
+bne *r2
+L215: .string "zxezxdmurapahmdmfexq"
+not *r0
+add r6, L127
+jmp *r4
+prn L49
+L216: red L25
+L217: .data 246, 200, 189, 942, -708, -528, 628
+bne L172
+rts
+prn r1
+mov *r3, *r1
+L218: .string "scho"
+cmp *r0, r0
+mov #200, r7
+not r1
+prn #-71
+L219: .data 393, 64
+sub #-1, *r7
+L220: bne *r1
+L221: cmp *r4, #204
+L222: jmp L126
+not *r4
+L223: .string "smhkjmcppmemnvep"
+stop
+L224: .data 156, 262, 98, 786, 615, -196
+L225: .string "rwwotucslysvxebnurtjyt"
+L226: .string "af"
+dec r7
+rts
+; comment
+L227: .string "hp"
+rts
+cmp #-91, *r1
+L228: prn L61
+not r0
+inc *r7
+prn L214
+; comment
+inc L14
+jsr *r6
+dec r6
+sub #32, r1
+L229: inc L186
+L230: .string "g"
+lea L58, L212
+; comment
+not L125
+L231: .data -216, 102, -845, 26, -449
+mov r3, L63
+; comment
+jmp L57
+jmp L78
+sub #-23, r6
+; comment
+not r4
+jsr L126
+jsr L67
+cmp #55, *r0
+L232: .string "e"
+mov #-256, *r1
+not *r4
+L233: .string "qudeij"
+L234: .data -937, 313, -766, 559, -687, 509
+L235: rts
+L236: mov *r7, r1
+jmp *r5
+add r6, L71
+inc *r2
+L237: jmp L160
+L238: .string "w"
+rts
+stop
+not r6
+inc r7
+L239: .data 836, -828, -950
+sub L75, *r2
+jsr *r7
+not L17
+jmp *r1
+dec r1
+
+L240: jsr L148
+
+L241: bne *r7
+L242: .string "ddkituhmaolsebyoxattxxo"
+lea L103, L165
+dec r6
+clr L11
+L243: bne L127
+rts
+inc r3
+
+not L34
+add r3, L27
+; comment
+stop
+sub #-169, r0
+red r3
+lea L238, r4
+L244: jmp *r6
+L245: bne L204
+red L73
+L246: .data 577, -96, -15
+sub L190, r2
+L247: dec r7
+rts
+L248: .data 87, -816, 181, -249, -257, 234, 285
+stop
+lea L247, *r5
+jsr L107
+L249: inc L16
+L250: .string "ysjqdspjqanmgwnaznqybug"
+lea L156, r3
+not L223
+dec *r5
+mov #62, L176
+prn r7
+lea L66, *r7
+L251: jmp L136
+cmp #72, r3
+red *r2
+mov #-2, *r7
+cmp *r7, *r5
+L252: dec r4
+sub *r7, L10
+sub #-222, *r3
+sub #98, L165
+rts
+stop
+L253: not r3
+dec r7
+sub r6, r7
+clr L73
+red r2
+jmp L22
+L254: .string "yppuy"
+L255: jmp L105
+L256: prn L60
+L257: .string "qbpx"
+sub L26, r7
+lea L32, L90
+prn L163
+L258: jmp L170
+dec *r5
+bne *r6
+L259: jmp *r4
+L260: red r6
+bne *r2
+L261: prn L9
+prn r4
+L262: bne *r3
+inc r2
+jsr *r5
+add #-37, L223
+sub *r7, *r6
+L263: red *r1
+add *r2, r3
+L264: sub L134, *r4
+mov L175, *r2
+L265: bne *r0
+sub r1, L242
+L266: cmp r1, r7
+red *r0
+L267: prn L160
+; comment
+L268: lea L262, L15
+jmp L75
+not *r7
+L269: clr *r4
+L270: cmp L27, #-131
+L271: .data -131, 949, -806, 891, 59
+rts
+jmp L143
+L272: lea L129, L167
+L273: prn #169
+rts
+red L189
+bne L20
+bne *r4
+prn L258
+
+clr *r7
+jsr *r2
+L274: jmp L183
+dec *r3
+L275: inc L64
+add L200, *r1
+red *r5
+rts
+stop
+L276: .data 343, 381, 976, 107, 638, 775
+cmp r5, #-170
+cmp *r3, L101
+clr L209
+L277: .string "eyvjonmjegqginnh"
+L278: jmp *r0
+mov L163, *r5
+add r4, r6
+L279: sub r0, *r1
+clr L271
+L280: rts
+clr L253
+L281: red r5
+L282: mov *r6, r7
+
+lea L271, *r2
+clr L238
+jsr *r1
+stop
+add r3, *r7
+L283: jsr L185
+L284: dec *r1
+jsr L67
+lea L226, r6
+
+L285: jmp L100
+L286: add L53, r6
+L287: .data -416, 610
+rts
+L288: .string "ruymkjb"
+mov L107, *r3
+cmp #-32, r4
+cmp r0, *r0
+jsr *r0
+prn L174
+L289: sub *r5, r2
+red L219
+not L96
+add r7, L157
+mov *r7, *r3
+clr L38
+L290: rts
+cmp L252, #-244
+jsr *r7
+L291: not *r7
+cmp r6, L272
+dec L102
+not L145
+L292: prn r1
+L293: .data 237, 110, -308, -958, 664, -311, -766
+L294: sub *r0, *r3
+L295: red L101
+L296: .string "ts"
+L297: add #48, r4
+jsr L51
+L298: jmp *r1
+lea L169, L51
+clr *r6
+L299: rts
+red L56
+red L246
+prn L283
+jsr L164
+mov *r7, L24
+red L191
+L300: bne *r5
+red L189
+sub *r7, r1
+L301: .data 370, -954, -840
+red *r4
+lea L218, *r5
+rts
+mov r6, L164
+bne L151
+not r4
+clr *r0
+sub L52, *r2
+clr r4
+L302: .data 113, -920, 992, -592, 125
+L303: .data -330, -996, -949, -905, -78, -107, 834, 900
+lea L72, *r7
+L304: cmp r4, L233
+clr *r2
+L305: .data 797, 624, -745, -746, -507, -685, -451
+stop
+; comment
+cmp *r4, *r3
+L306: jmp L107
+sub #-74, L95
+L307: add r0, r1
+not *r2
+L308: .string "gnxmznhk"
+jmp *r7
+L309: .data 488, 841, 529
+L310: sub r2, r6
+clr r4
+sub r3, r1
+cmp L92, L89
+L311: jsr *r3
+jsr L174
+lea L243, *r3
+mov r0, r4
+prn L205
+L312: jsr L142
+L313: prn L40
+red L271
+lea L188, *r3
+red L68
+dec L282
+L314: .data 628, 375, 695, 841, -449, 208
+L315: mov r5, L107
+L316: prn #38
+L317: lea L50, L215
+not L317
+rts
+L318: prn #-171
+L319: sub *r4, L170
+L320: add *r2, r1
+L321: prn r4
+; comment
+rts
+L322: mov *r1, r1
+add L293, *r4
+; comment
+mov L60, r5
+L323: mov r2, *r7
+clr r5
+not L296
+L324: sub #-14, *r3
+inc *r3
+L325: lea L16, *r6
+jmp *r7
+; comment
+L326: .data -399, -617, 192, -985
+jsr L191
+inc L95
+jmp *r6
+sub #-83, L271
+L327: .string "aqxfesn"
+dec *r1
+L328: bne *r3
+L329: clr *r2
+mov L216, L192
+clr L257
+L330: dec r7
+clr r3
+clr L174
+L331: .string "hqrreydhenkwnopoxokzt"
+jmp *r6
+L332: dec L182
+inc L137
+sub #-208, L144
+dec r5
+clr *r2
+L333: rts
+cmp #238, #164
+add *r7, L25
+prn r6
+prn #104
+prn #49
+bne L17
+jsr *r6
+prn *r4
+cmp r5, r0
+add L306, L120
+L334: .string "nngdveztnrltevcaxijqo"
+L335: jmp L188
+inc r1
+L336: not *r1
+L337: .string "uayiqqeuxkpaougdhxvw"
+lea L105, L203
+jmp *r3
+lea L170, L74
+stop
+jsr *r0
+
+clr *r4
+rts
+lea L210, L327
+dec L261
+L338: jmp *r2
+stop
+L339: .string "wajjgooztkjatpfqh"
+cmp r3, L179
+red *r6
+add #-16, r3
+mov r1, L122
+L340: jmp *r0
+L341: prn *r5
+red *r2
+stop
+L342: .string "yyabmcjlpbyvyafnihs"
+not r5
+rts
+clr *r5
+red *r2
+inc r7
+add L256, r4
+dec L36
+cmp *r2, #70
+dec *r5
+stop
+clr r2
+stop
+add *r0, L48
+jmp *r0
+add L243, *r2
+prn #94
+stop
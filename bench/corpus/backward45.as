@@ -0,0 +1,1026 @@
+; Generated by genCorpus --seed 46
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+jmp *r1
+L0: .data 677, -935, -148, -410, -150, -130, 836
+cmp #-151, L0
+mov *r7, *r1
+add *r4, r2
+dec L0
+lea L0, r4
+mov r3, r7
+jmp L0
+inc *r0
+bne *r7
+L1: .data -885
+mov *r7, L1
+bne L1
+jmp *r3
+jmp *r4
+L2: dec L1
+dec L2
+rts
+L3: .string "ufuwuxim"
+dec L1
+clr r2
+inc *r2
+L4: clr r3
+L5: prn r4
+L6: .data -818
+dec L4
+L7: not L4
+L8: red r0
+stop
+red *r6
+not L0
+clr L1
+L9: inc r5
+add *r6, *r2
+L10: .data 699, -708, 334, 275, 272, 226, 486, -5
+clr L7
+bne *r6
+L11: .string "ehibubk"
+prn L0
+
+bne L10
+L12: cmp #-50, #-44
+inc r2
+sub L11, *r0
+add #-20, L0
+add r3, *r7
+mov L3, L5
+jsr L4
+
+red *r7
+L13: not L6
+L14: jsr *r7
+jsr *r6
+jmp *r4
+rts
+L15: cmp r1, *r4
+inc *r6
+L16: jmp *r0
+sub #107, r4
+; comment
+cmp r1, *r7
+; comment
+lea L15, *r0
+clr r0
+jmp L3
+inc L9
+clr L1
+clr L11
+prn r4
+add *r2, *r5
+L17: lea L13, L9
+mov *r7, r2
+sub L14, r3
+mov r2, *r7
+L18: rts
+L19: .data 421, 236, 733, -656, -496, 972, 578
+jmp *r4
+cmp *r0, #-205
+red L14
+rts
+not r7
+L20: mov *r0, r2
+L21: rts
+L22: sub r5, L0
+prn *r4
+jmp L9
+lea L5, *r5
+sub L8, r4
+L23: add r5, L16
+L24: red L5
+prn L11
+jmp L10
+bne *r6
+L25: sub r1, r7
+bne L13
+bne L14
+L26: bne *r2
+sub L13, *r7
+inc r7
+jsr L23
+L27: .data -780, 8, -413, 831, -303
+L28: mov L20, *r6
+L29: clr *r2
+bne *r6
+jmp L27
+inc r7
+cmp L14, *r7
+inc r2
+bne L10
+L30: jsr *r1
+inc L27
+prn L27
+L31: .data 231, -833, 745, 700, 231, -393, 871, -515
+rts
+L32: lea L6, *r5
+dec *r4
+not L18
+inc r0
+dec *r2
+L33: rts
+not L26
+L34: .string "trcimcrzwwxcuanpcohtv"
+L35: .data -880, -705
+L36: .string "bsijcqzi"
+L37: clr L20
+L38: red L38
+L39: prn #-213
+prn r3
+rts
+L40: mov L3, L14
+rts
+cmp #120, L26
+L41: .data -223, -618, -674, 65, 32, -161, 242, 591
+L42: add r7, L13
+sub r3, *r0
+L43: add #-144, *r6
+L44: .data -428, -155
+sub L21, r3
+sub r7, *r4
+add L28, *r6
+L45: sub *r7, *r0
+inc r3
+L46: not r3
+L47: add *r6, r5
+add *r3, r6
+L48: .data 596, -991, 902
+add L19, r4
+jsr L2
+jmp L15
+L49: add L27, L1
+bne L11
+inc r2
+sub L37, L30
+add #-166, L40
+; comment
+L50: .data 181, -161, 171, -788
+clr *r0
+L51: sub r1, *r3
+L52: .data -596, -49, 139, -492, 231
+L53: stop
+sub L35, L26
+L54: lea L5, *r1
+inc L4
+jmp *r3
+dec *r7
+L55: dec *r2
+inc *r6
+rts
+add *r2, r0
+L56: stop
+add *r1, r0
+rts
+L57: red L1
+L58: prn #-167
+L59: .string "cotsygfvucmjjt"
+bne *r6
+red r5
+lea L35, *r7
+clr L7
+jsr *r3
+stop
+L60: lea L45, *r3
+
+add L2, L53
+L61: dec r1
+L62: bne *r2
+L63: mov r4, *r7
+L64: bne L39
+lea L64, *r0
+L65: jmp *r5
+; comment
+clr *r4
+dec r2
+
+not L20
+prn #-228
+jmp *r2
+jsr L30
+not L45
+L66: lea L2, r3
+stop
+L67: .string "ilpz"
+L68: .data 151, -757, 452, -911, 577, -148
+add r3, *r1
+L69: not L68
+L70: .string "jfmkepdnikrccsx"
+stop
+L71: stop
+not *r5
+red L71
+prn *r1
+clr L40
+inc L50
+bne *r3
+clr L62
+L72: stop
+not *r0
+not *r6
+L73: jmp L31
+L74: not *r2
+
+stop
+L75: lea L73, r3
+stop
+L76: .data 293, 770, 278, 374, 483, -855
+sub r3, r5
+lea L35, *r6
+jmp *r2
+jmp L74
+red r2
+L77: .data 613, -459, 354, 926, 168, 520, 449, 589
+L78: mov *r2, L48
+add #-94, L39
+L79: jsr L47
+clr L59
+L80: jmp L46
+
+mov r7, *r7
+mov *r0, r1
+L81: cmp #25, #254
+rts
+cmp r5, #-234
+clr r5
+jmp L81
+L82: mov #-53, r6
+L83: .string "niw"
+inc r4
+lea L45, *r6
+L84: .data 505, 406, -828, 924, 715, -812, 192, -960
+; comment
+mov L2, *r1
+; comment
+L85: .data -630, -990, -952
+add *r6, *r2
+bne L82
+lea L47, *r5
+sub L64, L44
+L86: stop
+not *r7
+L87: prn L17
+stop
+L88: not *r4
+L89: sub #42, *r1
+clr *r3
+clr r3
+rts
+lea L61, *r4
+prn r4
+L90: cmp r7, #5
+inc L20
+L91: jmp *r6
+sub *r1, *r2
+L92: .data 354
+add r0, r3
+L93: not L5
+lea L68, L77
+add #36, *r7
+; comment
+stop
+L94: mov *r5, r5
+L95: rts
+L96: jsr *r1
+not r4
+jmp L40
+mov #170, r6
+L97: bne *r2
+; comment
+L98: .string "vfdmgzbvmhtdizjgnvk"
+L99: stop
+sub r7, L72
+cmp L49, L74
+L100: add #-86, L47
+; comment
+lea L83, L62
+L101: lea L88, *r5
+jsr *r4
+L102: stop
+rts
+lea L79, r4
+dec r2
+cmp #105, *r0
+rts
+; comment
+stop
+clr *r2
+stop
+red L7
+L103: rts
+dec r2
+mov #149, *r0
+mov *r7, L73
+L104: clr r7
+add r2, r2
+not r4
+not r1
+jsr L101
+
+; comment
+
+jmp L8
+; comment
+L105: sub #2, L79
+L106: inc r4
+bne *r2
+add L79, L46
+prn L5
+add #202, r3
+stop
+L107: clr *r4
+lea L23, L71
+L108: jsr L63
+red L63
+stop
+L109: inc L59
+L110: clr r7
+L111: .data 158, -345, 685, -792, 156, 296, 93
+dec *r2
+red r6
+L112: jmp *r5
+lea L69, r1
+jsr L33
+not r3
+L113: .string "zazqjjbexpn"
+jmp L42
+clr L110
+add *r7, *r1
+bne L77
+L114: cmp *r2, *r0
+L115: sub #-111, L17
+L116: jmp L27
+sub r4, *r1
+clr L69
+not L67
+rts
+L117: cmp L101, r1
+clr r0
+L118: prn *r5
+L119: jsr L103
+not L97
+L120: inc *r3
+prn #62
+L121: .data -400, -476, -279, 916, -974, -733, 545, 874
+clr *r0
+L122: cmp #-14, L36
+rts
+bne *r0
+L123: bne *r6
+L124: red *r5
+L125: sub r6, *r6
+L126: mov r4, r0
+not r5
+cmp *r1, r2
+L127: dec r2
+L128: .data -502, -969, -809, 241, 68, 366
+L129: stop
+inc *r1
+bne L24
+jsr L43
+L130: stop
+L131: clr *r3
+prn *r7
+L132: red *r7
+red *r2
+stop
+L133: sub L4, *r7
+not *r1
+L134: jsr *r1
+prn *r0
+L135: .data 88, 614, 488, 422, -43, 553
+L136: cmp *r0, L40
+L137: jmp *r2
+jmp L42
+cmp r5, *r2
+prn r6
+L138: inc r0
+jsr *r2
+L139: .data -462, 867, 9, -741, 366, 702, -694
+L140: red *r1
+jsr L104
+bne L121
+L141: .data 697, -920, 826, -855
+L142: mov r6, r2
+stop
+L143: jsr L128
+L144: stop
+jmp *r2
+inc *r5
+L145: add *r5, *r0
+red L126
+stop
+L146: bne L10
+L147: cmp L79, L89
+L148: bne *r5
+L149: .data 20, -801, 899
+lea L17, *r2
+L150: jsr L70
+inc *r0
+jmp L104
+jmp L80
+
+mov #-170, *r1
+L151: not r4
+L152: prn *r4
+jmp *r2
+not r0
+add *r4, L48
+dec *r2
+jmp *r1
+; comment
+L153: jmp L48
+L154: stop
+stop
+clr r7
+jmp L67
+
+cmp *r5, #82
+jmp L132
+jmp L43
+L155: prn *r1
+stop
+; comment
+jmp *r2
+dec r2
+; comment
+L156: red L43
+L157: mov r1, L105
+bne L102
+dec *r6
+prn *r2
+L158: not *r6
+L159: sub #52, *r7
+bne L110
+lea L86, r0
+dec r2
+inc r5
+L160: add r0, L114
+L161: clr r7
+sub *r7, *r2
+stop
+L162: red *r4
+L163: rts
+; comment
+prn *r2
+inc *r6
+not r7
+sub r5, L116
+L164: mov L54, L7
+L165: .string "orrvbjkbrbnb"
+
+sub #48, *r3
+red *r2
+bne *r4
+L166: red r2
+L167: inc r5
+L168: .data -394, -160, -712, -850, -751, 371, -806, -926
+L169: add #165, r2
+L170: .data 141, -854, -366, 725
+; comment
+rts
+L171: cmp L165, *r5
+stop
+add r1, r0
+L172: jsr *r0
+add #-85, L9
+L173: .string "dlapavg"
+L174: .data 328, 59, -572, -13
+not r1
+L175: .string "jxyfaslcemwrygcobqtdamxw"
+jmp L80
+; comment
+dec *r6
+L176: bne *r4
+bne L119
+sub L123, *r6
+cmp L60, #-48
+dec *r7
+red *r4
+L177: lea L95, *r5
+L178: .data -872, 930, 377, -841, -738
+jmp *r3
+inc *r0
+bne *r3
+red L70
+L179: .data -617
+not r5
+L180: mov *r5, L83
+L181: lea L47, r7
+L182: dec L4
+dec L141
+bne L114
+add *r1, *r2
+add r4, r0
+stop
+L183: clr *r4
+jsr L106
+clr L161
+L184: lea L17, r7
+L185: clr r3
+red r1
+L186: stop
+stop
+red r0
+dec L112
+; comment
+mov #-208, *r0
+red r7
+inc r4
+L187: .data -887, 313, -144
+L188: sub r1, r2
+L189: jsr *r5
+L190: .data -105, 905, 925, 385
+lea L49, *r7
+clr *r6
+rts
+L191: rts
+sub *r4, L175
+sub r4, L171
+L192: clr L186
+stop
+L193: sub r5, L112
+not r2
+bne L4
+; comment
+cmp *r3, r4
+L194: .string "cxboiixmstvplmpm"
+L195: .data -428, 259, 453, -139, -232, 705
+rts
+sub #-192, L154
+L196: cmp L9, *r7
+mov #114, *r3
+stop
+L197: .string "jmunmfyvvibrlvqrmaq"
+red L4
+bne L27
+stop
+add L108, r5
+dec L128
+jsr *r0
+not *r5
+prn *r3
+L198: stop
+dec *r1
+L199: lea L172, *r2
+L200: .string "aoamclcdoysbcvgbui"
+add r0, L194
+L201: add r2, r3
+mov r0, L189
+jsr L159
+rts
+L202: inc *r0
+L203: .string "mzfodwafydybw"
+rts
+L204: jsr L106
+L205: jmp *r6
+L206: .string "otzbaxlatubzebpqebwlxo"
+not r2
+bne L143
+sub #-246, r2
+not L45
+jsr L13
+mov r5, *r7
+mov r0, r3
+L207: rts
+jsr L5
+prn #141
+L208: prn r4
+jsr *r5
+L209: add L156, L151
+lea L73, *r1
+stop
+L210: cmp L162, r5
+L211: cmp r0, r5
+prn L194
+L212: .string "g"
+stop
+sub #44, *r5
+inc L60
+sub L69, *r5
+sub #-75, *r6
+rts
+clr L115
+L213: jsr L96
+jmp L202
+L214: rts
+lea L77, L206
+L215: .data -251
+L216: .data -406, -331, -620, -543, 895, -544, -580, 730
+bne L87
+prn #-133
+clr L163
+L217: stop
+L218: prn *r0
+clr r4
+sub *r1, r7
+L219: .string "gaccavwsdlbqtzxa"
+L220: stop
+L221: add L176, r4
+bne *r5
+cmp L37, #-126
+L222: .data 954, 77, 817, -54, 538, -994
+L223: red r0
+
+mov #130, r5
+not *r6
+
+L224: bne *r1
+add r7, L133
+dec r3
+; comment
+bne L123
+jsr L201
+lea L221, r1
+L225: dec L64
+sub *r5, r4
+sub *r1, *r0
+rts
+L226: not L110
+dec r4
+L227: jmp *r1
+L228: mov *r7, *r0
+L229: .data -567, -850, -171, -581, -374, 78
+prn r6
+L230: jsr *r7
+mov *r5, L58
+L231: clr *r4
+L232: add #81, L152
+stop
+jsr *r2
+inc r4
+inc *r3
+L233: red *r5
+jsr *r5
+inc *r7
+stop
+L234: sub *r5, r1
+L235: clr r3
+bne *r5
+lea L144, *r1
+prn *r4
+rts
+cmp *r3, r4
+L236: .string "ayt"
+add *r4, r1
+L237: .string "n"
+dec L232
+dec *r6
+L238: prn #-39
+prn r5
+lea L122, r1
+prn r1
+jmp *r7
+stop
+clr L122
+prn #109
+L239: clr r7
+prn r4
+not L79
+clr L130
+L240: cmp #155, #168
+L241: jsr *r3
+L242: cmp #70, #191
+mov *r5, r0
+L243: mov #-69, *r1
+red r7
+L244: .data -137
+bne *r6
+red L132
+
+L245: dec *r3
+prn r0
+not r7
+L246: .data -76, -147, 411
+L247: dec L126
+L248: lea L99, L122
+mov r1, L8
+L249: .string "nslaqejgfhm"
+L250: cmp *r2, *r6
+stop
+
+
+mov *r4, L104
+L251: .string "hu"
+mov #38, L216
+red *r0
+jsr *r5
+sub *r1, *r3
+inc L100
+L252: dec L133
+not r4
+jsr *r1
+; comment
+add #-8, *r4
+prn r3
+
+rts
+inc L72
+red *r4
+clr *r3
+L253: .string "yvruwvaptzrsdcwxrps"
+not L101
+L254: prn *r4
+L255: .data -576, 815, -755, -75, -402, -27
+L256: not *r2
+inc *r4
+cmp r2, r4
+sub r7, r4
+L257: dec L7
+L258: not r3
+sub r5, *r4
+sub r5, r2
+sub #182, *r1
+not *r5
+L259: lea L224, r4
+L260: .string "hliuqdsdlh"
+cmp r5, r5
+L261: lea L38, L24
+jsr L225
+L262: add #-219, *r5
+jmp *r7
+L263: stop
+stop
+bne *r5
+L264: add *r2, *r7
+jmp *r1
+prn #37
+bne *r2
+L265: not L250
+bne L138
+; comment
+inc L41
+dec L80
+L266: sub #63, r2
+add L107, *r6
+L267: clr *r7
+L268: inc r0
+L269: prn *r4
+stop
+L270: jsr L125
+L271: .string "ucqahycpmje"
+rts
+L272: bne L242
+inc L156
+L273: .string "kpyytsljeqmlpnxaphkzsq"
+stop
+rts
+L274: clr *r5
+prn *r7
+L275: .data -120, 115, 127, -666, -480, 297, -249
+jsr L79
+L276: red L274
+mov #-37, L221
+L277: prn *r2
+L278: .data -986, -294, -760, -307, -761
+L279: not r2
+L280: .string "mkw"
+prn *r6
+L281: bne *r5
+not L208
+L282: mov r0, L254
+L283: jsr *r6
+bne *r2
+L284: lea L231, r4
+red L144
+L285: add *r3, L249
+inc L159
+add #-181, *r1
+clr r3
+inc *r0
+red r4
+sub r1, L170
+L286: not *r6
+jmp *r3
+stop
+L287: not *r3
+L288: clr L98
+dec r1
+L289: red *r1
+jsr L277
+L290: cmp L241, #-221
+prn #7
+rts
+dec L61
+L291: prn r5
+L292: cmp #-247, r1
+L293: cmp r4, r6
+prn *r3
+
+L294: not *r1
+mov #-220, *r6
+red L0
+L295: rts
+L296: red L171
+rts
+inc L78
+L297: .string "fozjfvjupcwdkqncy"
+L298: .string "xsmmhdyetqogkaegjn"
+L299: prn #240
+clr L16
+L300: lea L205, *r4
+jmp *r2
+jmp *r7
+add L1, *r6
+dec r3
+L301: add r3, *r5
+L302: inc L41
+jmp *r4
+L303: .string "tnepsrwysng"
+prn L46
+add L186, *r5
+jsr L61
+sub #94, r5
+add r1, *r5
+jsr L22
+red r2
+mov L210, r1
+L304: .data 881, 798, 388, -654
+L305: not L16
+clr L200
+L306: mov #-210, r7
+L307: .data 917, -299, 356, -520, -74, -410, 27
+L308: .string "yquubbwraadrddkbdainitei"
+bne L200
+dec L240
+clr *r6
+mov L80, r7
+stop
+L309: rts
+red r1
+inc r3
+L310: jmp L3
+L311: dec *r5
+cmp L299, #16
+prn L163
+L312: jsr *r4
+L313: lea L92, *r0
+prn *r5
+bne *r6
+mov #-147, *r3
+L314: mov #126, L239
+red r4
+L315: .string "z"
+clr *r2
+L316: .data 513, -806
+L317: dec *r7
+stop
+add #120, *r7
+stop
+inc L248
+L318: jmp *r4
+L319: prn *r0
+L320: jmp *r3
+L321: lea L235, *r5
+add L119, L260
+dec L12
+
+L322: lea L279, L184
+sub *r4, L198
+not r4
+L323: bne *r7
+add L91, *r3
+L324: red *r4
+L325: .data 225, 633, -862, 232, -77, 82, -140
+L326: lea L269, r2
+dec L29
+bne *r7
+red L27
+L327: .data 158, 681, -51, 608, -157
+jmp L196
+L328: mov L32, L88
+L329: .string "nyfuidptjqmvdv"
+lea L276, *r6
+clr *r5
+red L27
+; comment
+L330: lea L263, r0
+lea L164, L252
+dec r5
+dec *r7
+not *r6
+jsr *r6
+L331: lea L109, r2
+lea L52, L72
+add #233, L220
+L332: add #102, L225
+L333: prn #-92
+L334: dec r1
+L335: jmp *r0
+stop
+add L54, r0
+cmp *r4, L198
+L336: jsr L130
+jsr *r0
+L337: bne L124
+prn #137
+L338: prn #37
+L339: inc *r6
+stop
+L340: jsr L184
+L341: lea L303, L92
+L342: stop
+L343: bne L45
+inc L9
+lea L282, L113
+not L245
+inc L204
+dec *r1
+L344: add r2, L147
+; comment
+jmp *r6
+add r6, *r6
+add *r3, *r3
+add r3, L197
+lea L320, *r4
+L345: prn *r1
+L346: jsr L246
+L347: mov *r0, *r0
+not r4
+not r3
+dec r3
+not *r6
+sub *r5, r5
+jsr *r5
+L348: sub #-34, r1
+L349: mov #-4, *r4
+L350: add *r4, L226
+rts
+mov L60, L181
+clr r0
+L351: jsr L137
+L352: .string "afvrgq"
+jsr L191
+cmp r4, *r7
+add #-151, L239
+L353: .data -679, 105, -200, -520, -530
+L354: dec r4
+rts
+inc L319
+red L317
+L355: .string "fyhduczaog"
+add *r3, *r1
+clr r7
+clr *r4
+dec L126
+jmp L238
+L356: .string "zooejtjwjcryoenvuo"
+jsr *r0
+lea L216, *r5
+L357: mov #-152, r4
+L358: not r1
+L359: .data 217, -695, 524, 300
+jmp L315
+bne *r2
+L360: stop
+L361: cmp L331, L291
+L362: jmp L255
+L363: bne *r3
+L364: .string "sovgstbsju"
+inc r7
+; comment
+L365: .data 798, -396, -22
+L366: .string "abowprgvaskktnssoyshayi"
+jsr *r1
+bne L188
+not r1
+inc *r3
+L367: .string "ssdntitxyjzrjvfyfkwk"
+L368: jmp *r4
+jsr *r3
+clr L239
+L369: cmp L215, #165
+L370: .string "oznstaijyeon"
+jsr L109
+
+mov *r4, L303
+L371: lea L311, r4
+clr *r3
+L372: .data -995, -830, 356
+L373: .data -137, 688, 528, 192
+L374: rts
+stop
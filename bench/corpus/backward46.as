@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 47
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+add r3, L51
+sub r2, r1
+L0: dec r7
+L1: lea L1, r7
+mov L0, L1
+L2: bne *r6
+L3: add *r7, r2
+L4: lea L3, r2
+L5: dec L2
+prn #-103
+inc L3
+L6: add L4, L2
+dec L5
+cmp L3, L1
+inc r5
+L7: mov *r4, r3
+L8: stop
+sub #215, r7
+L9: clr r1
+jmp L0
+clr L2
+inc L0
+clr *r3
+L10: .data 907, -414
+L11: lea L8, r7
+bne L11
+add L9, *r6
+L12: mov *r7, r3
+add L5, L12
+sub *r3, L3
+bne L3
+mov #-232, *r6
+L13: .data 36, 555, 206, -759, -589, 379
+not *r7
+L14: inc L4
+L15: .string "hurywauyn"
+inc r7
+L16: .data 223, -285, 495, -167, -369
+dec *r0
+cmp L12, L15
+inc r1
+not r3
+sub #184, *r7
+inc r0
+L17: rts
+L18: red L16
+L19: sub #227, r2
+not L2
+bne *r1
+L20: add r6, r2
+L21: rts
+jmp L2
+mov #-60, L5
+L22: bne L11
+bne *r6
+bne L1
+not r4
+prn *r3
+L23: prn #-20
+
+dec *r7
+not *r3
+L24: dec r0
+jsr *r5
+sub L16, *r6
+red L22
+mov *r3, r1
+jmp *r1
+L25: stop
+jmp *r7
+jmp *r7
+L26: .string "muuklpbhesaxqhyemoprevi"
+red L16
+L27: .string "kfqcmsarcewtkyrtwpmahen"
+rts
+stop
+L28: sub *r4, *r1
+L29: prn L9
+L30: add #185, *r6
+prn r7
+not *r5
+L31: .data 789, 547
+red r6
+mov r5, *r7
+L32: not r6
+L33: cmp L17, #-236
+jmp *r0
+jmp L14
+clr L0
+L34: not L30
+sub #103, r0
+; comment
+L35: .string "jclruxcvimwwxygyz"
+L36: bne *r1
+L37: cmp r3, #15
+clr *r7
+L38: jmp L27
+L39: inc r6
+cmp #132, *r6
+L40: dec L32
+lea L8, L18
+mov r1, L12
+L41: dec r2
+L42: red r1
+L43: .string "eyxlyjmwnyvpbbysek"
+jsr L10
+L44: .string "sglaivhdlyxhzjq"
+bne *r4
+lea L9, r2
+L45: dec L44
+mov #-172, r1
+mov L35, L23
+rts
+L46: .data 926, 31, 853, -150, -710, -198, -869
+cmp #-135, *r7
+cmp #120, L11
+
+mov L15, *r7
+L47: jmp L37
+not *r7
+clr *r6
+L48: lea L8, L9
+add r3, r3
+jsr L39
+stop
+inc r6
+jsr *r1
+bne *r2
+; comment
+dec L6
+red r1
+not r4
+bne L22
+prn L39
+sub #197, r3
+prn #-58
+dec r4
+add L5, *r4
+L49: dec L8
+stop
+lea L0, L7
+clr *r6
+L50: stop
+L51: rts
+not r2
+L52: clr L8
+cmp #106, r1
+clr *r4
+L53: .data 171, 587, -12, -559, 219, -932, -553
+red L18
+not *r7
+L54: red r1
+stop
+mov *r1, L8
+dec r4
+stop
+L55: inc *r5
+jsr L19
+L56: .string "orbyuygohfrvyfty"
+add #-162, L6
+L57: jmp L44
+add r4, *r6
+L58: jsr L34
+L59: .data 331
+L60: cmp r3, *r2
+L61: red r2
+
+L62: rts
+dec L13
+cmp L53, *r1
+L63: .string "rxnhoibgkvzmzb"
+L64: .string "fvbazgjcuqatouvgvpht"
+L65: rts
+not r4
+sub r0, r0
+L66: jsr *r4
+L67: .data 80, 942, -200, -564, 203, 978
+sub *r2, *r4
+dec *r4
+cmp #148, r1
+L68: red r0
+red L46
+sub L66, *r6
+clr *r6
+cmp #85, L35
+dec L20
+L69: bne L43
+prn L28
+inc r4
+L70: .data -619, -89, -867, -63, 8, 276, 708, -782
+red *r2
+stop
+add L45, r0
+lea L54, r6
+rts
+L71: cmp *r4, L39
+mov #-45, L31
+prn #-76
+clr L36
+dec L11
+rts
+add r1, *r3
+jmp L4
+prn r2
+inc *r2
+prn r4
+add r6, *r2
+L72: prn *r6
+jmp *r1
+dec L67
+L73: stop
+rts
+prn #107
+L74: add L3, *r0
+inc *r1
+sub L74, L72
+L75: .data -743
+L76: bne *r7
+L77: sub r0, L33
+cmp r6, *r5
+L78: dec r2
+rts
+stop
+L79: not *r7
+
+add *r4, L72
+L80: .string "hxshksvkncseml"
+bne *r6
+L81: .string "elmfuujdivbz"
+prn *r3
+L82: lea L8, r3
+jmp L39
+
+clr L13
+dec *r0
+red r5
+sub L31, r2
+jmp *r0
+add #77, *r3
+sub #51, *r4
+L83: stop
+L84: stop
+cmp *r5, L65
+jsr *r3
+L85: cmp *r0, #29
+not *r5
+jsr L68
+prn *r2
+L86: mov *r5, r0
+rts
+L87: dec *r2
+add *r3, r3
+red r0
+jsr *r1
+inc L17
+bne L71
+prn *r6
+prn L5
+rts
+sub #52, L23
+lea L87, L60
+prn r1
+L88: mov #-189, r3
+L89: cmp L13, r5
+L90: stop
+L91: mov r5, *r5
+L92: clr r2
+; comment
+cmp #119, #-189
+inc L55
+clr r0
+jsr *r4
+add #18, L30
+mov L73, r1
+mov L58, L34
+rts
+; comment
+L93: red *r1
+L94: cmp #31, r6
+add r0, r5
+L95: dec L80
+add L18, r7
+stop
+add L23, *r0
+not r2
+L96: .data 701, -330, 790, -88, -454
+L97: jsr *r5
+L98: .string "f"
+red *r0
+L99: bne *r0
+prn #-71
+clr *r1
+bne L7
+clr r2
+dec r3
+L100: rts
+L101: inc *r7
+dec *r3
+L102: red *r4
+L103: jsr L71
+jmp L57
+L104: lea L55, r4
+stop
+L105: jmp L10
+cmp #-8, *r0
+L106: cmp L65, *r6
+L107: jsr L64
+inc r7
+stop
+sub r2, L6
+L108: clr L5
+
+jmp L19
+L109: cmp *r1, L69
+L110: dec L0
+; comment
+mov L109, *r7
+L111: sub L59, r5
+rts
+jsr L27
+cmp *r2, r1
+clr r1
+clr *r5
+bne *r5
+L112: lea L70, r4
+mov #-60, r7
+L113: lea L111, L64
+L114: bne *r6
+L115: .string "ewsg"
+L116: prn *r0
+
+inc L15
+sub #37, r3
+L117: prn #-130
+jsr L90
+jsr L81
+L118: bne L5
+dec L101
+add r6, *r0
+prn *r1
+mov L100, L16
+
+L119: jsr *r4
+mov #47, *r3
+L120: jmp L94
+L121: add r4, L54
+L122: .string "rlxq"
+add #-28, L92
+L123: inc *r0
+lea L33, *r7
+prn *r1
+inc r0
+L124: .data -324, 63, -550, 610, 826
+L125: add #178, r7
+inc r3
+L126: mov *r4, L86
+inc *r7
+cmp #-49, *r3
+L127: .string "zxdhbz"
+cmp L13, #-183
+sub #64, r3
+red *r1
+L128: .data -881, -797, -174, -616
+; comment
+inc L38
+sub r3, L118
+L129: .string "tndujjauszxjec"
+L130: dec *r6
+clr *r6
+jmp L111
+L131: .data 912, 357, -154, 634
+rts
+bne L12
+prn *r7
+dec r5
+clr r4
+prn *r2
+not L85
+cmp L72, r6
+jsr L112
+prn *r6
+L132: lea L26, L110
+jsr *r5
+cmp #-89, #-69
+L133: stop
+prn *r6
+; comment
+jsr *r5
+cmp r1, L51
+lea L71, r1
+stop
+sub L12, r3
+L134: .data -919, 532, -539, 640, -228, 660, 357
+inc L117
+L135: dec r6
+L136: not r5
+
+L137: rts
+red *r1
+inc *r6
+L138: stop
+jsr L15
+add r0, L136
+cmp r5, *r0
+; comment
+L139: bne *r5
+L140: stop
+L141: cmp #110, r5
+stop
+add #-178, r7
+add #71, *r1
+dec *r6
+rts
+L142: jsr *r3
+jsr L14
+add *r1, L5
+L143: inc *r6
+lea L16, L39
+clr *r5
+not *r2
+jmp L46
+L144: red *r7
+L145: .string "hdnrjjnuezsfnunvuf"
+L146: dec r6
+L147: .data 860, -125, -772, -85, 887, 182
+add L102, L57
+L148: .string "dxjcbbzoshxpgbqt"
+mov #-50, L137
+lea L13, L45
+L149: .string "bdawdhkairxxcdkgrdi"
+dec L105
+L150: jmp L135
+sub r3, L126
+L151: dec r6
+not *r1
+add r7, r6
+red r3
+red L106
+dec *r2
+L152: red L151
+; comment
+add #-8, *r4
+L153: clr L24
+jsr *r7
+prn *r6
+prn r0
+L154: .string "yvwufixoijfbua"
+lea L73, *r4
+dec L136
+L155: stop
+L156: sub #46, *r5
+not *r6
+lea L152, L8
+L157: inc L132
+L158: .data 797, -713, 979, 544, 340, -772, -397
+lea L135, r1
+lea L85, L19
+L159: clr r6
+jsr *r7
+L160: lea L94, *r1
+add L132, *r4
+L161: inc *r5
+
+red *r2
+inc *r6
+L162: clr r1
+dec *r4
+L163: .data -662, 661, 920, -692, -688
+L164: .data 680, -465, -827
+red r2
+bne *r5
+inc r0
+add #-86, r6
+rts
+jsr *r0
+rts
+cmp #28, r5
+clr L159
+inc L75
+not L68
+clr L96
+L165: inc *r1
+prn r2
+add L26, L51
+cmp r5, #-235
+rts
+rts
+mov *r7, L103
+inc *r1
+stop
+stop
+L166: mov *r1, *r2
+clr *r6
+bne *r3
+L167: add L115, *r5
+rts
+dec L101
+jsr L80
+mov L118, L116
+sub *r1, L70
+jmp L120
+stop
+L168: .string "uhufkdblguhghyl"
+lea L125, r5
+inc L36
+L169: jsr *r3
+not *r2
+L170: .string "llidooxz"
+L171: stop
+L172: clr *r1
+stop
+cmp L124, r2
+cmp L102, L31
+L173: cmp #-76, L94
+L174: jsr *r5
+cmp #171, *r3
+mov *r3, r2
+L175: mov #133, L4
+L176: jmp *r6
+not r2
+dec r1
+lea L36, r6
+red L108
+bne *r4
+sub L122, *r5
+lea L86, *r6
+lea L133, *r6
+
+L177: not r3
+rts
+lea L163, r7
+L178: .data 678, 537
+not *r1
+jsr *r4
+not L57
+not r0
+stop
+L179: stop
+bne L56
+L180: rts
+cmp r3, #207
+
+; comment
+L181: .data 593, 491, 811, -334
+add *r4, *r4
+cmp L72, *r0
+not *r5
+stop
+L182: lea L154, r1
+not *r6
+L183: rts
+bne L80
+cmp #-33, r7
+L184: mov L175, r0
+not r1
+L185: stop
+red r3
+cmp *r1, r2
+clr L73
+sub *r7, *r2
+L186: lea L59, L178
+L187: .data 318, 474
+mov #117, r3
+L188: red *r2
+L189: add #-195, L44
+L190: dec L185
+not *r6
+not r7
+L191: bne *r1
+jmp *r6
+L192: bne L171
+add r0, L65
+not *r3
+L193: bne L115
+sub #-86, r3
+; comment
+dec *r7
+L194: inc L114
+L195: bne L118
+bne *r1
+stop
+L196: .data -420, -148, 816
+dec *r2
+mov *r6, L189
+L197: .string "ubf"
+stop
+L198: .data 686, 951, 578, 252, -206, 245
+bne *r5
+; comment
+sub r6, r3
+rts
+red *r6
+stop
+clr *r0
+; comment
+sub #-146, *r1
+sub #234, *r3
+prn #85
+sub *r7, r7
+; comment
+jmp *r3
+L199: .string "kixsbwmmhqfwlvyiqbwhqp"
+red r7
+L200: .data 897, -987
+red r5
+stop
+mov L183, *r5
+L201: rts
+clr *r7
+L202: mov #-147, r5
+mov *r3, L8
+L203: jsr *r6
+not r0
+jsr L19
+prn r7
+bne *r7
+jmp *r2
+sub *r6, L89
+bne L144
+L204: lea L103, *r2
+L205: bne L149
+jsr L52
+L206: .data -899, -748, -117
+not L94
+red *r3
+prn r4
+L207: .string "cjjfccytglk"
+bne L158
+bne L28
+clr L54
+L208: inc *r0
+L209: .data 850, -605, -876, -782, -68, -475, -673
+inc r4
+dec r7
+prn #33
+prn L92
+mov L42, r5
+not *r4
+; comment
+jmp *r6
+L210: dec L139
+bne L89
+add L135, *r2
+prn *r1
+mov #-93, L155
+L211: .string "tpwdgzgdkjemt"
+red L58
+L212: clr r6
+lea L149, r1
+L213: bne L134
+add r6, r4
+; comment
+rts
+sub *r3, *r4
+jsr *r4
+jmp L184
+L214: sub #54, r1
+L215: sub r0, L102
+rts
+jmp L135
+add r2, r1
+L216: .string "tawpeecgqbidwowc"
+L217: rts
+L218: bne L42
+sub *r6, r4
+L219: .data 232, -671
+L220: sub *r4, L33
+stop
+prn *r0
+L221: .string "hsxasarbf"
+L222: rts
+L223: lea L152, *r2
+cmp L41, *r6
+L224: .data -751, 580, -906, 168, 261, -242, 120
+dec r1
+L225: .string "mo"
+L226: stop
+rts
+; comment
+mov *r6, r0
+L227: bne L82
+mov *r6, r6
+L228: not *r6
+prn L26
+not L20
+stop
+sub *r1, *r5
+L229: mov *r5, r5
+L230: red r6
+L231: dec r3
+L232: stop
+add L128, r4
+jsr *r4
+jmp *r6
+mov #-109, *r0
+add *r2, *r5
+jsr L1
+bne *r4
+; comment
+L233: jsr *r0
+L234: .data 893, -90, -624
+dec L58
+L235: rts
+dec L20
+L236: stop
+red *r5
+L237: lea L3, L211
+L238: cmp r5, L165
+
+L239: stop
+add #-101, r1
+bne *r4
+L240: .data -39, 482, 125, -213, -246, -426
+L241: dec L155
+add *r7, L148
+inc r4
+jmp *r7
+cmp *r1, *r6
+; comment
+stop
+rts
+L242: jmp *r0
+dec *r3
+jsr *r1
+bne *r7
+jmp L147
+dec *r0
+not *r3
+L243: jsr *r0
+prn #215
+L244: .string "kdsxtclnbskbwjqnaf"
+dec r7
+red L41
+mov L204, r7
+L245: stop
+L246: .data 571
+prn r1
+add r1, L226
+L247: .string "t"
+L248: dec r6
+
+jmp L188
+bne L114
+L249: jmp L219
+sub #136, *r3
+red r6
+L250: clr r3
+L251: prn L221
+L252: mov r6, *r2
+L253: mov #-117, *r7
+L254: stop
+cmp r1, #-221
+rts
+L255: inc r7
+not *r0
+L256: stop
+jsr *r2
+jmp *r2
+add *r2, L235
+add r4, L253
+mov *r3, r5
+red r1
+L257: .string "mivwivbzfjr"
+dec r4
+L258: not r1
+cmp L26, *r6
+jmp L171
+dec L135
+L259: jsr *r1
+L260: clr *r4
+L261: jsr L196
+prn L110
+L262: .data 708, 400, 765, 38, -693
+cmp *r4, L209
+jmp *r6
+dec L162
+rts
+L263: stop
+L264: inc r1
+rts
+stop
+add L120, r4
+rts
+rts
+inc *r6
+not *r5
+sub L184, L34
+L265: stop
+L266: rts
+red L137
+; comment
+dec r5
+L267: sub #88, L82
+L268: jsr *r0
+L269: jmp L89
+add #172, L30
+L270: cmp *r3, *r2
+L271: not *r0
+cmp #-69, #66
+L272: sub r0, L164
+bne *r0
+jmp *r0
+not *r3
+bne L148
+L273: dec L146
+jsr L225
+jmp *r1
+L274: .data 977, -545, -24, 120, 79, 713
+stop
+L275: .data 571, 360, 154, -518
+cmp r3, r7
+stop
+stop
+L276: .string "ufoxjotbv"
+inc L13
+mov *r0, L58
+bne *r7
+L277: .data 67, -425, -282, 56, -744, -801, -239, 292
+jmp *r1
+rts
+cmp r5, r7
+L278: jsr *r5
+L279: .string "iqttjao"
+rts
+
+L280: .data -478, -172, 797, -334, -768, 856, -871
+L281: .data 99, -445, -125, 72, -93
+lea L274, *r6
+clr *r2
+prn *r6
+not *r7
+L282: .data -478, 613, -371
+mov L170, r0
+L283: jsr *r6
+
+
+mov r4, r7
+rts
+not L156
+add L148, r4
+jsr L25
+L284: inc r2
+mov L183, L102
+rts
+L285: .data -12, -629, -470, -167, -218, 64, -704
+stop
+jmp L131
+jmp L212
+inc r1
+L286: mov *r1, r6
+L287: inc *r2
+sub #57, *r7
+L288: rts
+add *r5, *r1
+jsr *r1
+lea L18, *r4
+L289: .data -72, 104, 544, 498
+sub L155, r7
+inc *r2
+L290: red L165
+L291: add L268, L180
+
+lea L48, r1
+L292: rts
+not *r2
+L293: cmp L197, r7
+dec L63
+L294: inc *r1
+jmp L129
+inc r0
+L295: .string "scxqdizcqzgyupd"
+jmp *r3
+stop
+bne L186
+stop
+add *r2, *r3
+lea L104, r4
+L296: rts
+L297: lea L268, r3
+red *r1
+not L268
+L298: red r7
+L299: .data 839, -301, -279, -145, -179, -901
+L300: cmp L1, L176
+prn #-113
+bne *r2
+L301: sub L278, r4
+bne L209
+add L6, L215
+red *r2
+inc r4
+rts
+add L247, L63
+add *r1, L210
+L302: jsr L178
+mov *r5, r6
+L303: .string "wvvpljqvwcvlxkzusgu"
+L304: .string "bfjwcawvu"
+add *r6, r3
+L305: .string "dfwowugtcoxqofsqiu"
+dec L117
+L306: .data -957, -510, 194, -829, 759
+L307: inc r1
+red L142
+clr *r1
+L308: .data -432, 33
+add #89, L157
+lea L43, L261
+L309: jmp *r2
+L310: .data -94, 931, -474, -726, -673, -133
+add r0, *r1
+sub L308, L211
+L311: red *r7
+L312: clr r7
+stop
+L313: .string "wjjpddid"
+jsr L154
+; comment
+L314: bne L17
+mov *r0, r0
+cmp *r0, r3
+L315: .string "vkkloozgorsuqhqbvjcqium"
+rts
+L316: .string "hunorlxma"
+jmp *r5
+cmp *r3, r2
+prn #65
+dec *r6
+L317: dec *r7
+L318: not *r6
+L319: inc L59
+not *r2
+mov *r4, r7
+prn #-11
+stop
+stop
+not L238
+red L99
+mov r7, r6
+
+jsr *r3
+L320: jmp *r3
+L321: inc r2
+L322: red L291
+add L269, L251
+mov r5, L34
+L323: cmp *r2, #170
+L324: rts
+clr *r3
+L325: stop
+jmp *r5
+L326: lea L317, r7
+L327: cmp #-202, r3
+prn r6
+L328: prn L264
+jmp L311
+L329: .string "zxshvqofcygmtkmdaecpe"
+rts
+L330: .data -170, 212, -393, -882, -335, -737
+L331: not r3
+lea L189, L155
+L332: mov L96, L244
+L333: sub *r3, L58
+L334: not L255
+mov L42, r5
+inc L221
+jmp *r6
+L335: mov #82, r1
+jmp *r5
+clr r3
+red r3
+add #-174, *r0
+sub r4, r2
+not L255
+; comment
+; comment
+mov #157, L292
+jmp *r5
+add *r2, *r4
+L336: red L208
+dec *r2
+stop
+cmp #-64, r4
+stop
+not L264
+jmp *r1
+L337: inc L263
+not *r3
+
+L338: mov #-220, r7
+L339: mov #-191, *r0
+L340: .data -196, -881, -102, -662, 998, -138, 152, 403
+dec L1
+L341: red r5
+L342: clr L12
+clr r1
+prn #-54
+not L338
+L343: .string "y"
+L344: jmp L136
+stop
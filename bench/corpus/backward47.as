@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 48
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+L0: clr r0
+red *r2
+jsr *r5
+clr *r7
+bne L0
+not *r1
+inc L0
+L1: mov #-46, *r4
+L2: jmp L2
+dec *r3
+L3: jsr L3
+cmp #-32, *r2
+L4: .data -878, 177, 535, -753
+stop
+L5: lea L1, r7
+add L5, L2
+cmp #101, *r3
+mov *r7, r2
+
+L6: .data 658, 659, 74, -86, 91, -450
+inc r5
+
+clr L6
+not r3
+jsr L3
+L7: jsr L7
+L8: bne L7
+jsr L0
+jmp *r2
+sub #-63, L3
+dec r7
+; comment
+prn L3
+bne L3
+dec *r1
+inc r3
+prn r4
+L9: stop
+lea L1, L0
+lea L1, L6
+inc r3
+L10: .string "p"
+inc r1
+clr r6
+L11: cmp L1, *r5
+L12: stop
+lea L9, L12
+L13: .string "mnnacjlfq"
+L14: bne *r7
+L15: not r6
+L16: rts
+L17: add r5, *r2
+rts
+stop
+L18: sub #-68, *r3
+L19: .data 349, 471, -30, 436, 970, -360
+L20: not *r6
+red r4
+L21: mov *r2, r5
+; comment
+L22: clr L6
+stop
+inc *r4
+prn r0
+L23: jsr L0
+L24: inc *r0
+L25: prn *r6
+L26: .data -938
+rts
+add #79, r1
+jmp *r4
+jsr L2
+mov L3, r4
+; comment
+L27: .string "kihkcannwumfbcvzxba"
+clr L25
+jmp L24
+L28: clr r3
+clr *r7
+sub r0, r2
+L29: .data -990, -959, 250, -437
+L30: prn *r4
+L31: inc r0
+jsr *r2
+prn L16
+rts
+L32: .string "tbnvuasptfqbdufbupk"
+cmp #-38, r2
+jmp L25
+inc L16
+bne *r0
+dec *r6
+inc *r5
+L33: jsr *r3
+L34: cmp #-105, r2
+rts
+L35: stop
+lea L21, L21
+L36: jsr L19
+jsr *r0
+prn #167
+L37: rts
+sub *r1, L25
+prn #232
+L38: bne L5
+not r6
+clr r0
+cmp *r2, r5
+L39: jmp L5
+red r7
+clr *r1
+cmp L7, r3
+L40: red r4
+dec r4
+cmp *r4, #185
+lea L22, L34
+; comment
+not *r4
+L41: add *r2, L26
+stop
+jmp *r5
+not *r2
+L42: jmp L31
+L43: rts
+red *r5
+L44: .data -816
+jmp L30
+L45: .data -714, -105
+L46: not L35
+L47: inc r1
+stop
+; comment
+; comment
+cmp r4, #-161
+clr r0
+cmp #172, #-76
+jmp L22
+cmp #224, L47
+L48: cmp #232, *r5
+not r1
+dec L18
+not *r0
+mov L8, r0
+dec L0
+L49: mov r3, *r4
+bne *r1
+L50: add #-69, *r0
+bne *r6
+dec L36
+clr L0
+jsr L9
+L51: .data 631, -73, 525
+add *r2, r5
+jmp L23
+L52: mov *r7, r2
+stop
+add L7, *r3
+L53: prn r2
+; comment
+L54: .string "lnupkifksymiabefwznwmzf"
+stop
+not *r0
+bne *r1
+red *r4
+L55: jsr L23
+L56: add #88, L36
+L57: .string "ajujypecygoxshkmlax"
+L58: not L43
+L59: sub *r4, r6
+L60: bne L45
+red r1
+L61: .string "rakijmjsdzhkzlhin"
+L62: lea L27, r5
+inc *r3
+cmp #57, #68
+bne L59
+mov r2, r2
+inc r0
+lea L38, L10
+L63: .string "tzxtbeh"
+L64: jmp L15
+L65: .data -592, -610
+L66: jsr *r3
+L67: cmp #233, L19
+L68: inc L49
+prn r0
+
+; comment
+L69: .string "wtfrqzp"
+L70: jmp L62
+red *r0
+rts
+cmp r2, *r3
+prn L15
+mov #-225, *r1
+sub #-11, *r7
+L71: red *r2
+L72: lea L40, L59
+rts
+L73: not L44
+L74: sub #21, r7
+L75: sub *r0, r0
+prn #-11
+L76: rts
+sub L62, *r2
+mov r2, L51
+inc L55
+dec r2
+rts
+; comment
+L77: red *r4
+lea L58, L13
+L78: jmp L76
+mov r3, *r1
+sub L11, r4
+L79: clr *r3
+rts
+L80: bne *r7
+L81: .data -880
+; comment
+clr r3
+L82: .string "v"
+cmp r4, *r4
+not r1
+dec *r4
+inc L50
+L83: dec *r7
+inc r5
+cmp r2, L37
+L84: .string "nkizxynmkmsun"
+mov r0, *r2
+L85: .string "mbrrjzmucbydamncgxs"
+dec L30
+cmp *r1, L7
+rts
+L86: dec L71
+rts
+not r1
+L87: jsr L22
+bne *r6
+L88: inc L10
+dec *r5
+prn *r1
+red r1
+sub *r4, *r6
+lea L52, *r1
+L89: jmp *r3
+add L33, r1
+cmp *r3, #211
+L90: mov #95, r4
+jsr *r5
+red *r1
+; comment
+stop
+L91: .data 375, 947, 486, 149, 590, 324, 93, 796
+cmp *r5, L12
+L92: inc r1
+not L52
+prn *r1
+not L13
+jmp L66
+L93: jsr *r2
+add #-199, r3
+cmp L87, L3
+lea L62, *r3
+cmp #-38, #93
+L94: add #-231, r5
+jmp L72
+prn *r3
+jsr *r1
+rts
+prn r6
+cmp L87, *r6
+lea L11, *r2
+L95: mov r3, *r2
+jmp *r3
+lea L45, r7
+not r3
+L96: .string "aqzrwkhwfmcjlqn"
+L97: cmp L42, L97
+L98: not *r6
+jmp *r2
+L99: clr r3
+L100: dec r7
+prn L58
+stop
+inc *r1
+mov r5, L25
+lea L39, r6
+dec L83
+inc L73
+red L95
+L101: stop
+L102: lea L82, L1
+jmp *r2
+L103: dec L19
+bne L59
+rts
+red r2
+prn r4
+L104: clr *r5
+mov r5, r4
+L105: jmp L84
+jsr L103
+L106: .string "sc"
+prn L74
+bne L11
+rts
+jsr L2
+cmp #84, #-17
+L107: lea L42, L34
+rts
+L108: add r1, *r6
+L109: rts
+red r6
+L110: lea L79, *r7
+mov *r5, r4
+lea L32, r3
+lea L21, *r6
+bne L90
+not r4
+L111: bne L65
+jsr L43
+prn #-108
+cmp #-255, L20
+L112: lea L96, *r2
+bne *r1
+dec *r2
+add L109, L38
+mov L40, L110
+bne L96
+add #-104, L97
+L113: sub #-75, r5
+L114: prn L7
+L115: bne *r5
+red r6
+rts
+L116: clr r0
+cmp *r5, #233
+prn #239
+lea L56, *r6
+cmp #-15, L107
+L117: bne L37
+; comment
+not L80
+lea L66, *r1
+L118: bne *r7
+L119: .data -330, 345, -252, 106, 245, -941, 636, 806
+L120: rts
+jsr *r6
+L121: bne *r4
+bne L51
+bne L27
+L122: rts
+not r3
+clr L42
+L123: .string "hkombplddpznkq"
+L124: dec *r2
+L125: sub L20, L100
+L126: jsr L123
+lea L50, r2
+L127: not L68
+inc *r3
+
+inc L16
+inc L102
+red *r4
+L128: not *r1
+L129: jmp L26
+L130: .string "tlojqohoqkssqqs"
+not L106
+L131: inc r1
+L132: not r3
+sub L63, r5
+lea L73, L120
+red *r2
+sub #-181, r5
+inc r0
+sub L54, L20
+lea L123, L44
+L133: dec r1
+jsr *r1
+L134: .string "ypehrgkkwwzkjbbblznzfjwu"
+lea L65, L119
+add L43, *r0
+; comment
+stop
+clr r0
+inc L84
+jmp L82
+bne L102
+mov L39, r5
+red r2
+cmp *r3, #-83
+L135: not *r0
+L136: .data 831, 903, 173
+
+not L71
+L137: cmp #-200, *r2
+lea L18, *r2
+L138: jsr L132
+prn *r7
+rts
+inc *r2
+prn r1
+rts
+jsr *r5
+L139: .data 62, 407, 387
+bne L84
+not r5
+L140: clr *r4
+jsr *r2
+L141: jmp L119
+jmp L129
+jmp L61
+L142: rts
+cmp r1, L44
+L143: .string "okfnvkynvojlljacquszmqqp"
+L144: bne *r2
+red *r2
+stop
+dec *r5
+L145: .data 654, -598
+prn L140
+L146: .string "ncifnknhubarboknlyxirljs"
+L147: red *r6
+lea L36, L101
+sub #21, L71
+mov L142, L49
+rts
+inc L42
+stop
+red L51
+L148: prn L94
+mov #-48, *r3
+L149: lea L75, L101
+mov *r0, *r5
+
+
+cmp *r3, #165
+L150: prn *r3
+red L105
+dec L99
+L151: lea L75, L139
+sub *r1, r0
+clr *r5
+L152: .string "s"
+mov *r6, r1
+cmp L11, #31
+lea L19, r6
+not L67
+L153: stop
+L154: .string "zqu"
+prn r2
+sub L47, *r7
+
+L155: stop
+L156: .data -833, 368, -289, -776, -735, -355, -272, -885
+L157: stop
+inc *r6
+dec r7
+cmp r2, r6
+L158: jmp *r3
+sub *r4, L94
+cmp #-55, r0
+L159: red r2
+prn #133
+L160: bne L24
+L161: clr *r0
+L162: .string "zcbpnewuewngqfgszha"
+L163: dec r7
+; comment
+dec L121
+L164: cmp L84, L64
+cmp r1, *r5
+red r0
+L165: .data 739, -726, -762, 648, -524, -406, -331
+
+red *r5
+mov *r7, L93
+jmp L70
+red *r0
+L166: stop
+jsr L46
+not r6
+L167: sub r3, *r0
+mov #220, L47
+clr r5
+lea L75, r6
+stop
+bne L6
+L168: not r5
+L169: rts
+L170: jmp *r2
+sub L88, L73
+L171: red *r4
+lea L167, *r4
+prn *r2
+L172: clr *r5
+L173: not L59
+mov *r7, r5
+L174: sub *r4, *r6
+bne *r6
+clr *r6
+dec L166
+L175: rts
+L176: clr L75
+L177: inc r1
+mov L144, r4
+sub L106, L7
+L178: .string "vfvszmbykithmoymqk"
+inc *r5
+L179: inc *r6
+mov #80, *r0
+L180: lea L120, *r7
+prn L50
+lea L9, L149
+L181: prn r4
+L182: .data 931, -387, 974, 389, 249, 82
+L183: inc r3
+mov r3, *r0
+L184: mov r7, r7
+L185: .data -198, -708, 519, -808, 946
+L186: sub #-165, *r6
+L187: .string "up"
+L188: prn L128
+inc r0
+L189: .string "ipofsptjaohztlpxdztoo"
+L190: stop
+add r2, *r5
+lea L43, r0
+cmp r6, L155
+rts
+bne *r1
+rts
+L191: .data -744, -357, -332, -76, -186, 57
+stop
+jsr *r4
+dec L85
+L192: bne *r6
+bne *r1
+L193: clr L113
+prn L119
+L194: .data -351
+stop
+prn r7
+jsr L16
+red L30
+L195: .string "pkathsmmrl"
+L196: jsr *r1
+prn r4
+dec L122
+mov *r6, *r7
+L197: not L176
+L198: .data 397, 831, 567
+not L72
+L199: bne L5
+clr r4
+inc r3
+inc L165
+prn r7
+dec r3
+add *r1, L64
+L200: bne *r7
+red r0
+L201: stop
+rts
+bne *r7
+cmp *r6, r1
+not r5
+prn #205
+L202: .string "prjhxtv"
+jmp *r0
+L203: cmp r2, *r3
+
+L204: bne *r4
+inc r7
+jmp L115
+L205: .data -459, 753, -222, 307
+jsr *r3
+add *r7, r5
+L206: sub L75, r2
+L207: cmp *r6, *r7
+L208: mov r0, L135
+L209: lea L1, r7
+lea L50, *r0
+jmp L56
+mov *r6, L78
+not L160
+bne *r2
+L210: red r3
+not *r5
+not r3
+add L3, r4
+L211: add #55, L41
+clr r1
+L212: .string "nnicwjwkf"
+
+L213: sub #28, L142
+L214: rts
+clr L134
+L215: stop
+bne *r0
+jmp *r7
+dec r4
+red *r6
+cmp r0, *r0
+L216: mov *r7, r2
+L217: .string "dumuuokfvhgxugicujjn"
+L218: bne L122
+add *r0, *r3
+clr r3
+L219: stop
+cmp #169, *r6
+L220: .string "cfnngecxkeynjsj"
+inc *r5
+L221: .string "uivxvonugieqymsvc"
+
+stop
+inc *r1
+
+L222: .data 91, 707
+jmp *r7
+L223: stop
+L224: jsr L37
+mov r2, L156
+cmp *r3, #-59
+stop
+L225: .data -422, 866, 653
+prn *r7
+cmp r2, L157
+; comment
+L226: rts
+L227: rts
+L228: lea L45, r5
+L229: lea L19, r5
+prn *r1
+L230: clr L116
+L231: sub #46, *r0
+mov #-88, r3
+L232: inc r6
+rts
+jmp L75
+L233: add #-121, *r2
+lea L211, *r7
+L234: stop
+cmp *r7, #107
+cmp #-82, #231
+dec L75
+mov L220, r2
+rts
+stop
+not L132
+L235: .data -158, -81
+red L173
+lea L108, r4
+lea L187, L59
+bne L19
+; comment
+L236: not r6
+L237: inc r4
+L238: lea L147, *r3
+L239: .data 815, 173, -602
+jsr *r2
+red L12
+L240: rts
+dec *r4
+L241: lea L91, L74
+dec *r2
+stop
+red *r0
+cmp #-195, L229
+prn *r0
+L242: not r1
+bne *r2
+not r5
+L243: .data 436, -780, -118, 337, -828, 242, 169
+L244: .string "bwipcemogcdtzlomxkga"
+prn L37
+L245: mov L190, L113
+L246: .string "yvfokgd"
+L247: rts
+clr *r3
+red *r1
+clr *r6
+bne *r7
+L248: jmp *r7
+mov *r5, r0
+inc L131
+L249: .data -55, 387, 737, 38, -986, 965, 310
+
+inc L240
+sub r5, r5
+dec r3
+stop
+L250: not *r0
+jmp L191
+bne L208
+inc r4
+jmp L244
+L251: clr L225
+add L159, r6
+L252: add L248, r0
+L253: .data 700, -623, 366
+rts
+not *r3
+prn *r2
+red L3
+stop
+not r7
+dec r2
+clr L113
+jsr L228
+
+red *r1
+L254: stop
+L255: .data 651, 775, 958, 917
+clr L92
+L256: jsr *r0
+L257: .data -284, -811, 918, 774, -974, 337, -626, 58
+clr r6
+jsr L200
+jmp L176
+stop
+sub r4, L153
+stop
+L258: cmp #186, r7
+L259: .data -995, -421, -790, 297, -239, 697, 266, -197
+bne L168
+red r3
+add L80, L53
+rts
+; comment
+L260: clr *r7
+L261: bne L21
+jmp *r7
+L262: jmp L230
+red *r6
+L263: .data 301, -443, -575, 212, -746, 171
+L264: .data -864, 539, -624, -661, -836
+mov #-93, r6
+stop
+L265: sub L3, r4
+jmp L61
+jmp L241
+sub #-120, r6
+L266: .data 429, 120
+prn #151
+L267: .string "iiiwlfasvmtyoiyrobasxjvz"
+not L145
+not L125
+L268: not L99
+stop
+not r3
+add L117, r5
+not r4
+rts
+add *r2, L156
+mov r1, r6
+inc r6
+L269: .string "tysymzhyldffg"
+inc *r0
+dec r3
+dec *r3
+L270: bne L232
+cmp #-27, L236
+bne L44
+inc *r5
+clr r7
+L271: inc L145
+lea L75, *r5
+add L120, L121
+prn L214
+jsr *r5
+not *r4
+L272: add #143, r7
+rts
+L273: jmp L160
+jsr L232
+L274: not r4
+mov *r4, L52
+L275: inc L214
+L276: .data 139, 466, 149, -621, 871, -278, -482
+L277: .string "rhefnzjazpf"
+cmp r0, *r7
+
+dec r6
+
+; comment
+L278: mov r1, L245
+dec *r4
+mov r0, L116
+clr r0
+clr r1
+L279: lea L93, r4
+red L127
+L280: bne *r3
+L281: .data -601, -713, -433, 651, 632, -816
+L282: dec *r0
+add *r1, r4
+L283: prn L194
+sub L264, r4
+mov r7, *r7
+L284: add #116, r6
+bne L67
+L285: dec L213
+inc *r1
+red r2
+sub #-111, *r2
+L286: .string "b"
+dec *r7
+L287: prn L287
+not *r5
+not r4
+add *r1, r0
+L288: .string "wrvxwzkzdk"
+red *r4
+L289: .data 445, -21
+L290: add *r2, *r3
+; comment
+bne L178
+stop
+L291: inc r3
+prn L182
+clr L221
+L292: red *r5
+bne *r2
+L293: jmp L113
+L294: red L196
+L295: clr r3
+clr L36
+mov L210, L161
+mov #-194, *r7
+
+; comment
+lea L105, *r3
+L296: .data -311, 186, 543, -79
+L297: lea L181, *r7
+L298: sub #-204, r6
+cmp #-89, *r5
+L299: jmp L214
+bne *r7
+lea L283, *r6
+L300: jmp *r2
+jsr L140
+L301: .data 727, -108, -152
+red L202
+jsr *r6
+L302: bne L259
+clr r5
+red *r7
+L303: inc r3
+L304: .data -504, 996, -745, 503, 210, 722, -389, -152
+L305: dec r5
+rts
+clr *r3
+cmp L6, L5
+L306: jsr L149
+L307: .data -975, 161, -91, 643, 825, -983, 598, 560
+rts
+not L181
+L308: .string "ucupcriipgl"
+jsr *r1
+lea L242, r4
+sub #-248, r0
+clr r2
+sub r5, *r6
+L309: rts
+; comment
+L310: .data -700, 450, 499
+inc L305
+prn L122
+sub #-195, r6
+L311: lea L294, *r3
+L312: bne *r1
+jsr L59
+mov *r0, *r0
+L313: cmp r5, L4
+red *r4
+jsr *r7
+L314: prn *r7
+sub r0, L168
+bne L266
+sub *r1, r6
+L315: sub r2, L312
+L316: mov L307, r3
+red L223
+clr *r5
+L317: .string "opatamdnazt"
+mov r2, *r7
+L318: mov *r3, L83
+stop
+lea L305, r3
+not L274
+red *r4
+dec *r3
+
+stop
+stop
+L319: .string "ulnajlmamrijc"
+L320: not L56
+lea L313, *r3
+dec L304
+prn r1
+stop
+dec *r3
+L321: .data 430, -74, -430, -471, -52, -360, -352
+L322: jsr L82
+stop
+stop
+jmp *r4
+L323: red *r4
+L324: bne *r2
+L325: .data -776, -582, -894, -926
+red L9
+L326: .data 97, -891, 450, 228, -507, 502, 775, -897
+mov L108, *r3
+clr L325
+jsr L176
+cmp r7, r2
+L327: add L37, L311
+L328: rts
+L329: clr *r6
+L330: .data 818, -823, 665, 861, -899
+L331: .data 667, 437, -377
+lea L246, *r5
+lea L21, *r0
+L332: jsr *r5
+inc L103
+L333: dec L232
+mov *r0, r2
+not *r0
+add *r5, *r5
+L334: clr *r2
+clr r4
+; comment
+L335: jsr L132
+red *r6
+rts
+add r3, L326
+rts
+prn r3
+L336: .string "zvvz"
+L337: inc *r4
+stop
+jsr L303
+L338: not *r7
+not *r6
+clr L307
+stop
+cmp r3, L83
+L339: inc r2
+add #-208, *r2
+cmp #-237, L183
+not r4
+lea L66, *r1
+L340: jsr *r4
+L341: .data 829, 696, -108, 497, 385, 889, -487, -814
+stop
+red *r5
+lea L273, L70
+L342: clr *r7
+add *r1, r3
+lea L15, r7
+; comment
+prn *r3
+L343: add r6, L20
+clr L248
+dec *r6
+red L296
+L344: not r0
+L345: bne L71
+L346: cmp L197, *r5
+lea L340, *r0
+L347: mov *r5, L242
+prn #-180
+stop
+dec *r7
+bne *r2
+not *r4
+L348: stop
+add r7, *r5
+L349: .data 210
+L350: rts
+jmp *r6
+L351: rts
+stop
+add #62, *r7
+inc *r2
+lea L238, L241
+cmp *r5, *r3
+jsr L132
+lea L281, *r5
+prn r4
+add r3, L212
+lea L189, r6
+bne *r1
+L352: .string "oolcfjhbbxmmycj"
+L353: prn *r3
+rts
+stop
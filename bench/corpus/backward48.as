@@ -0,0 +1,1026 @@
+; Generated by genCorpus --seed 49
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+L0: red L0
+bne L0
+dec L0
+L1: add r2, *r3
+clr r3
+sub r1, L1
+L2: jsr L2
+L3: prn *r7
+rts
+L4: clr *r7
+L5: inc r1
+bne *r4
+red *r6
+rts
+not *r1
+L6: not r6
+cmp L4, r6
+; comment
+; comment
+add *r2, L4
+L7: not r3
+L8: jsr *r3
+L9: .data 914, -60, -365, -467, 237, 793
+prn #169
+L10: not L3
+L11: rts
+clr L5
+bne L11
+prn *r5
+
+; comment
+L12: not r1
+jsr *r7
+bne *r6
+L13: stop
+lea L9, L7
+L14: add r2, L13
+lea L0, *r4
+L15: sub *r7, L6
+L16: rts
+L17: dec L15
+inc *r7
+not *r5
+cmp *r5, r4
+L18: not L8
+lea L13, *r7
+not r7
+L19: inc L16
+inc r4
+L20: prn r5
+L21: bne *r7
+L22: add #-241, L7
+rts
+L23: jsr *r0
+rts
+sub *r4, L6
+L24: sub L24, *r4
+bne L18
+inc L14
+mov L6, L13
+inc r4
+L25: lea L6, r2
+L26: .string "e"
+; comment
+rts
+stop
+L27: jmp L25
+L28: bne L17
+L29: not L9
+inc L3
+L30: red r1
+bne *r5
+L31: .string "wysihjuhhehbfvhixlhio"
+bne *r7
+stop
+jsr L26
+clr r7
+L32: .data -186, -388, 920, 977, -690, -524, -355, 386
+bne L16
+not *r6
+jsr *r2
+L33: clr L23
+stop
+bne *r0
+clr L9
+L34: .string "ncbxhjofjmt"
+prn r7
+L35: clr L6
+L36: add r3, L33
+
+L37: sub #-132, *r0
+not r5
+stop
+; comment
+dec r6
+prn L37
+sub *r6, r1
+L38: sub L37, L3
+; comment
+jsr L4
+L39: dec L30
+L40: inc r3
+jmp L18
+jsr *r2
+not L29
+red r7
+L41: .data 874, 646, 435, 689, -330
+inc r7
+cmp #116, r5
+rts
+L42: mov #119, *r1
+inc L16
+prn r3
+
+inc *r2
+inc L1
+jmp L15
+rts
+L43: not *r3
+L44: inc L10
+lea L36, r4
+L45: add r5, r1
+
+L46: inc *r6
+cmp *r1, r0
+prn r2
+cmp *r1, r1
+add r0, L6
+L47: cmp *r0, L28
+sub L40, *r1
+L48: red L12
+red *r7
+L49: prn r0
+dec r1
+bne L38
+lea L41, L23
+jsr L19
+mov *r5, r2
+L50: sub #-174, r7
+L51: red *r3
+clr *r1
+prn r1
+L52: jsr L21
+jsr *r3
+L53: lea L23, r2
+L54: add #27, r1
+L55: mov *r6, r1
+L56: prn r4
+add #-127, L2
+clr *r4
+L57: lea L4, *r1
+not L25
+L58: jmp *r6
+cmp *r6, *r3
+cmp L36, *r5
+jsr *r2
+L59: rts
+L60: .data 874, 746, 804, -114, -295, 675, 322
+L61: .string "mraccgxseeixkoikijinrpnu"
+dec r5
+L62: .data 737, 517
+lea L17, *r5
+L63: .data -970, -245, 824
+bne L62
+L64: .string "hdaixyrqggeqzcg"
+dec L41
+sub #156, *r1
+jsr *r4
+clr *r7
+L65: inc *r0
+not r3
+L66: cmp L14, r0
+L67: not r5
+inc r6
+L68: .data 480, 716
+L69: .string "vapapfeyoizk"
+L70: lea L21, *r7
+jmp *r5
+L71: sub L71, *r0
+L72: .data 275, 534, -670
+inc *r2
+L73: dec r5
+L74: sub #-204, L17
+red *r6
+jsr L32
+L75: stop
+L76: mov *r6, r1
+bne *r3
+cmp r1, r2
+jsr *r0
+clr L28
+; comment
+not L62
+rts
+sub r2, L23
+rts
+; comment
+rts
+L77: jsr L5
+not *r1
+
+stop
+L78: .data -890, 480
+L79: sub #-176, *r7
+jmp L59
+jsr *r4
+
+sub #233, L17
+L80: lea L4, L18
+jmp *r3
+rts
+stop
+stop
+jmp *r4
+L81: .data 781, -746, -407, 295, 549, -27, 419
+add *r7, L6
+L82: bne L13
+L83: .string "ftnyco"
+clr *r1
+L84: .data -901, 912, 667, -852
+L85: sub #165, L83
+L86: cmp L84, *r4
+sub L10, *r2
+red r3
+L87: .data 766
+jmp L6
+L88: .string "ofjyjnrwqryime"
+not *r1
+L89: .string "qoictayfhag"
+clr L25
+L90: lea L37, r5
+
+L91: mov r7, *r5
+inc r7
+mov #120, *r2
+L92: bne *r7
+L93: red L84
+L94: jmp L6
+stop
+L95: .string "bqcgf"
+L96: .string "htexrpbwwwgquwctijrvhez"
+lea L66, r3
+dec L68
+not r1
+L97: .data 680, 87, -180
+prn *r6
+add r1, r6
+prn *r5
+lea L35, L80
+red *r3
+prn *r1
+
+lea L64, L0
+L98: clr r7
+L99: sub #248, *r4
+stop
+; comment
+L100: dec L9
+clr L25
+L101: mov *r4, r1
+lea L59, r5
+L102: .data 700, 992, -924
+lea L81, L31
+L103: prn r7
+L104: .data 726, -811, 942, -634, 728
+sub #-145, r4
+L105: bne *r4
+stop
+bne L28
+L106: not *r7
+L107: bne L18
+L108: red *r7
+inc *r2
+jsr *r2
+rts
+L109: inc L33
+add r7, r5
+L110: mov r2, *r0
+mov *r0, *r1
+cmp #-40, L9
+L111: not r2
+L112: clr *r1
+bne L9
+jmp *r1
+L113: rts
+jmp L99
+rts
+jsr L102
+inc r3
+clr r5
+L114: prn L31
+L115: jsr L112
+lea L29, *r3
+clr *r0
+dec r4
+clr L76
+bne *r3
+lea L6, r6
+add *r3, *r1
+L116: dec r6
+clr r6
+L117: cmp r7, *r5
+L118: clr L113
+L119: stop
+inc r7
+L120: .data -866, 70, 31, -303, -743
+clr *r2
+cmp r3, #154
+L121: prn r4
+cmp #73, r5
+L122: .data 533, -13
+L123: inc *r0
+
+inc L7
+L124: .data -451, 646, 819, -189, 347, 593, 517, -886
+clr r4
+L125: bne L28
+inc *r0
+bne *r6
+not L97
+jsr *r6
+L126: jsr *r2
+clr L12
+lea L66, L60
+jsr *r4
+lea L37, r7
+lea L77, r3
+dec r0
+jsr *r1
+L127: mov L50, *r7
+L128: inc *r3
+L129: .data -390, 28, 72, -382, 112, 651, -95, 247
+bne L32
+L130: .data -456, -417, 447
+jsr *r5
+L131: dec *r3
+stop
+jmp *r7
+L132: dec L92
+bne L85
+cmp r3, *r2
+stop
+L133: add L57, r3
+L134: prn *r4
+L135: .data 903, -942, 722, -84, 330, 408
+L136: rts
+L137: .data 782, 981
+lea L7, L32
+L138: .data 945, -840, -780, 752, -841
+prn *r6
+L139: stop
+jsr L112
+cmp #5, #113
+rts
+mov #116, *r7
+L140: red r0
+sub L110, *r4
+jsr *r0
+L141: not L140
+sub #-12, L38
+L142: sub #109, r7
+mov #50, *r4
+bne L49
+clr L119
+L143: prn L48
+L144: .string "ohrvslftpazad"
+L145: cmp *r6, r5
+sub r4, r1
+lea L28, r6
+not r7
+L146: .data 762, -45, -700, 16, 139, -143
+L147: lea L121, r3
+L148: .data 680, -546, -973, 357, -868
+jsr L134
+inc *r3
+L149: not L141
+L150: .string "pzpgw"
+sub L94, r0
+jmp *r4
+L151: cmp L120, #247
+prn #-21
+L152: jmp L50
+mov r2, *r2
+L153: prn *r0
+not L63
+jmp L9
+bne *r0
+L154: inc *r4
+stop
+L155: add *r2, L135
+
+prn #-229
+L156: .data 154, -183
+clr *r7
+L157: .data 512, -79, 670, 435
+jmp *r4
+; comment
+L158: .data -380, 318, 90, -902, 942, -570, -658, -303
+L159: inc *r1
+L160: red r7
+L161: mov r1, L10
+L162: not r7
+red L63
+L163: prn r6
+L164: cmp *r6, #196
+jmp L125
+
+L165: lea L23, *r2
+cmp r4, r0
+L166: jsr L103
+L167: bne L52
+L168: .string "jeptx"
+add L111, L21
+lea L143, L54
+rts
+rts
+lea L74, r4
+red r7
+L169: .data 17, 818, -774, 722, 102, 698
+bne *r6
+sub r5, *r2
+cmp r2, r3
+prn L28
+bne L119
+L170: .string "yqf"
+L171: stop
+L172: clr *r6
+L173: cmp L132, L160
+; comment
+bne *r6
+L174: jmp L47
+L175: sub r3, r6
+cmp *r1, #131
+lea L8, r6
+clr r0
+L176: add L18, *r0
+L177: stop
+jmp L13
+L178: .string "mupaepevcenzl"
+L179: dec *r4
+L180: mov #-74, *r2
+L181: bne L7
+red r7
+L182: not r2
+; comment
+L183: .data 277, -614, -624, -526, -764, -12, 705, -70
+L184: dec r2
+stop
+L185: not L58
+cmp L106, L56
+bne L170
+cmp #-135, L3
+L186: lea L60, r7
+clr *r0
+jmp *r7
+L187: cmp r5, L174
+dec *r4
+bne *r1
+mov #224, *r0
+cmp r0, #238
+not *r2
+cmp #153, #-155
+clr L131
+dec *r0
+L188: red *r2
+sub L35, L133
+rts
+stop
+lea L111, r5
+clr r1
+jmp *r1
+L189: .data -662, 475
+lea L65, L113
+L190: dec L20
+L191: prn r6
+L192: .data -212, -555, -928
+add r3, *r6
+clr r3
+lea L173, L109
+clr L23
+bne *r4
+prn *r6
+L193: .data -625, -10, 557, 553, 96, -270, 716
+L194: dec *r5
+L195: .string "phqu"
+
+
+jmp L19
+mov r7, *r7
+; comment
+; comment
+L196: .string "pxqhkbravqhxvy"
+clr *r1
+add r2, *r1
+dec r1
+cmp #-46, r7
+mov #-245, *r7
+not L56
+L197: .string "rszugzkgjtfypibjjszvf"
+L198: not r3
+sub *r2, L122
+bne *r5
+prn *r2
+L199: .string "raqqqyhfqfbddbzuqzktkje"
+stop
+mov r5, L99
+L200: bne L198
+L201: jsr *r4
+L202: mov L107, *r2
+stop
+dec *r1
+L203: jsr *r7
+jmp L21
+stop
+L204: stop
+jsr *r6
+add L63, *r7
+mov r5, L30
+clr L13
+jmp *r3
+L205: inc r2
+stop
+stop
+L206: red *r2
+L207: lea L120, L186
+L208: .data 860, -236, 659, 734
+jmp *r1
+L209: jsr *r1
+L210: lea L126, L118
+
+L211: bne L178
+L212: not *r4
+add #-252, *r3
+dec *r7
+cmp #-229, *r6
+inc L84
+L213: rts
+jmp *r4
+dec *r2
+L214: bne *r0
+L215: cmp r7, L27
+red *r5
+L216: .string "o"
+add L71, L175
+lea L105, r5
+L217: inc *r0
+cmp #-133, *r2
+rts
+jmp L38
+lea L130, L101
+stop
+L218: .string "thmikmqoprjis"
+L219: .data -107, 159, 133, -92, -139
+lea L161, r4
+dec L188
+dec r7
+L220: inc *r4
+L221: rts
+cmp r7, #-213
+cmp r0, L213
+prn *r2
+cmp L184, L124
+mov *r6, L101
+L222: .string "dzoasekrpcctp"
+not *r1
+; comment
+bne L87
+prn L115
+cmp *r4, r7
+inc r3
+L223: lea L111, *r2
+stop
+sub #-90, r2
+cmp r3, r2
+
+mov r5, *r7
+L224: jsr L175
+L225: .string "fcys"
+
+
+add *r7, L178
+clr r4
+inc *r1
+lea L120, *r0
+L226: inc r5
+bne L218
+
+not r7
+dec *r4
+L227: add L227, *r1
+
+stop
+L228: .data 177, -166, -589, 428
+; comment
+jsr L62
+L229: .string "qdli"
+rts
+mov L67, r0
+lea L135, *r7
+L230: .string "lvtpinwjtnbkxuupstetttq"
+red r3
+red L193
+stop
+jsr *r5
+red L111
+prn r6
+jmp *r4
+mov #211, *r4
+sub L1, r5
+L231: bne L52
+dec L46
+rts
+jsr *r5
+L232: .data -728, -490, 450, 410, -617, 860, -898
+add r0, r5
+jsr *r3
+cmp #135, #107
+L233: mov L55, r1
+L234: dec *r6
+L235: .string "xrnyvdqwohv"
+L236: .data 993, 679, 370, 471, -797, 688
+stop
+jsr *r7
+cmp #-156, #112
+clr r4
+inc r1
+lea L40, L35
+L237: .string "ffvizckzelfxphxi"
+red L184
+sub *r0, *r1
+L238: .data -864
+mov L217, r2
+L239: inc *r2
+sub #163, *r2
+rts
+rts
+lea L49, r0
+mov #129, r1
+L240: bne *r0
+jsr L153
+L241: add #-208, L164
+lea L87, r1
+dec *r4
+cmp L11, L10
+jmp *r0
+sub r3, r0
+jmp *r3
+clr r1
+sub L118, r4
+dec r1
+red *r3
+dec r5
+add #29, *r1
+L242: bne L80
+clr r2
+L243: .data 752, 682, 973, -737, 847, 119, 908
+not r2
+sub L198, *r4
+
+L244: red *r7
+L245: .data -8, 59, 294, -930, 954
+L246: stop
+L247: mov L246, r4
+prn r4
+L248: .data 468
+stop
+L249: .data 99, -492, 141, 299, 917, -713, -73, 292
+L250: jmp L115
+rts
+not *r2
+inc L78
+cmp L129, r6
+prn #100
+sub r4, L21
+L251: .string "xvnijiffrdgqdbviox"
+L252: prn #-23
+bne *r5
+L253: sub *r4, L202
+clr L244
+L254: rts
+L255: .string "vyfupztzoqqnbohd"
+jsr *r6
+sub #24, r7
+cmp L71, r7
+mov *r2, L178
+jmp L63
+prn L238
+L256: .string "gcvmanwpnglg"
+jsr L76
+L257: inc L80
+add *r1, L115
+L258: bne L256
+stop
+L259: bne L83
+jmp *r0
+L260: .data -306, -895, 595, -663
+not *r1
+add #-167, L213
+L261: jsr L102
+L262: rts
+dec *r1
+L263: rts
+stop
+bne *r4
+clr L85
+L264: not r4
+L265: cmp *r6, r7
+L266: clr L77
+bne *r6
+add r4, *r0
+clr r6
+jmp *r3
+add L1, L122
+; comment
+mov #-191, *r6
+mov r3, *r5
+lea L84, r1
+sub r2, r1
+cmp *r0, L60
+stop
+L267: rts
+rts
+clr L52
+dec r7
+L268: stop
+jsr L153
+bne *r1
+L269: lea L68, L196
+jsr L76
+jsr *r0
+cmp L214, #-229
+L270: .string "xhdu"
+add r6, L64
+L271: cmp L204, #-7
+jmp L48
+cmp #194, #122
+rts
+L272: .string "qackbfzsmyklwkwudlyev"
+clr r3
+
+
+L273: clr *r0
+add #-238, L46
+dec *r4
+lea L234, r3
+stop
+jmp *r2
+L274: red *r3
+prn *r7
+L275: .string "irrjvsplavwsocow"
+add *r0, r6
+sub L234, *r3
+L276: stop
+sub r0, r2
+L277: cmp r1, L91
+add #116, L149
+
+rts
+L278: add r0, L221
+red *r3
+rts
+L279: sub *r7, L118
+inc L162
+lea L45, L180
+inc L193
+L280: .data 119, -900, 751, 712, 31
+L281: stop
+L282: .string "sbswvhzgt"
+lea L150, *r5
+L283: stop
+lea L125, r4
+clr *r5
+L284: rts
+L285: dec *r6
+L286: add r2, L113
+L287: bne L117
+L288: not r7
+jsr *r5
+; comment
+L289: prn #-78
+L290: jsr *r5
+jmp *r0
+clr *r7
+
+L291: red *r1
+jsr L171
+not r3
+inc L225
+not L152
+bne L79
+L292: .data 830
+L293: cmp #49, r4
+red *r1
+red *r6
+clr r6
+L294: bne L15
+add L82, L80
+L295: mov *r3, L62
+sub *r4, r6
+prn L21
+cmp #248, #205
+dec L135
+mov #138, r0
+cmp r7, L294
+jsr *r7
+rts
+L296: .data 225, -647, -662
+bne L206
+L297: dec L148
+L298: dec L72
+L299: mov L138, r7
+L300: mov L75, *r0
+sub #50, *r1
+clr *r6
+L301: cmp r2, L298
+L302: clr L298
+L303: stop
+jsr L301
+L304: dec r6
+inc r3
+L305: .string "fxgq"
+L306: lea L69, L298
+add L22, r2
+add L37, r3
+L307: dec r5
+L308: .data 564, -398, 882, 804, 188, -340
+; comment
+cmp *r6, L161
+L309: rts
+L310: .string "ip"
+L311: .data -857, -11, -51, -436, -941, 659
+not r1
+L312: .string "wfmuqzbsnydiayfmbeqjiaz"
+; comment
+stop
+lea L72, L57
+cmp r0, *r6
+; comment
+red *r7
+clr L187
+lea L12, *r3
+prn L17
+L313: not r4
+L314: .data 657, -426, -563, 547, 397, 407, 718
+L315: .data -679, -454, -275, 831, -486
+L316: rts
+L317: red L188
+jmp L12
+L318: .data -243
+add L318, r0
+mov #-81, r3
+L319: .data -653, 197, 405, -647, -644, 547, -722
+cmp #221, r4
+prn L287
+not r5
+L320: add r7, *r5
+rts
+L321: jsr L52
+L322: inc L222
+L323: red r6
+not L31
+L324: jsr *r2
+dec *r4
+L325: clr *r3
+mov #183, L231
+add #247, *r3
+sub L148, *r5
+L326: bne L97
+mov *r5, *r6
+L327: .data 469, -524, -741, -712, 860, -382
+L328: clr L3
+red *r7
+; comment
+L329: .string "antcnuiijtpznlhaarwrhs"
+bne *r1
+dec r3
+clr L193
+cmp *r7, #-126
+L330: jmp L210
+mov *r3, L257
+stop
+prn r1
+jmp L233
+prn L186
+L331: inc *r4
+L332: clr L77
+L333: .string "unhrnqmmf"
+cmp L117, r0
+rts
+inc r5
+rts
+rts
+inc *r1
+cmp r0, *r6
+add r6, r4
+L334: .string "rglsmtxhfikjrsrdkoxfd"
+rts
+sub #80, L270
+L335: rts
+L336: mov L230, *r4
+lea L336, *r7
+L337: .data 993, -796, 635, -743, -692, -850, -830, 591
+mov L285, *r1
+L338: inc L216
+L339: .string "c"
+stop
+bne L219
+L340: rts
+add *r1, L201
+; comment
+not *r5
+not r7
+L341: dec *r0
+L342: rts
+stop
+clr r4
+L343: .data -547, 585, -279, -12, -230
+L344: add r3, *r5
+L345: lea L192, *r5
+L346: red *r4
+prn r0
+mov r0, L136
+L347: .string "myjtfvhxegnpd"
+mov #85, L32
+
+; comment
+add *r0, r2
+not *r5
+L348: .string "yti"
+L349: inc *r1
+jsr *r2
+clr L127
+not r5
+L350: .data -709, -870, -19, -568
+rts
+lea L37, *r4
+bne *r4
+
+jmp *r6
+mov L287, *r1
+L351: prn #-67
+red *r4
+cmp *r6, *r5
+L352: .data 72, -94, 663
+add #213, L81
+L353: .data 518
+inc *r4
+jsr *r1
+
+L354: cmp #250, *r2
+mov *r5, L19
+L355: mov *r3, *r2
+sub L78, r1
+L356: prn r0
+jmp *r7
+L357: bne L122
+L358: clr r2
+clr L174
+L359: .data 697, -615, -184, 971, 779, -171, -80, 879
+dec L329
+cmp *r2, *r1
+bne L359
+red *r0
+L360: sub *r7, L179
+dec L40
+red *r0
+add #244, *r2
+prn r2
+mov L308, r5
+clr *r6
+L361: stop
+L362: red r5
+
+inc r2
+sub L274, L125
+L363: .string "tydrualnnjbocmeitbgaiyy"
+cmp r6, #-183
+lea L161, *r3
+L364: sub L24, L158
+L365: mov L321, *r2
+stop
+clr L260
+mov *r2, r4
+L366: add L304, *r3
+stop
+add r0, L6
+L367: not r4
+dec r0
+dec r2
+lea L131, *r7
+jmp L2
+stop
+rts
+L368: jmp L44
+L369: not *r7
+add L191, *r3
+rts
+L370: mov r0, r6
+cmp *r4, L316
+bne L222
+stop
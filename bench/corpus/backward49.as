@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 50
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+jmp L218
+mov *r7, *r3
+L0: .data -364, -355, -719
+jsr L0
+L1: .string "qgbelyffoigtvtprpeppc"
+L2: rts
+L3: add #132, L0
+L4: stop
+not *r1
+stop
+L5: sub *r2, *r0
+bne *r3
+red *r3
+L6: cmp *r7, *r5
+cmp r1, L6
+L7: lea L2, r0
+add L0, *r7
+L8: prn r6
+bne L0
+inc r1
+L9: bne *r4
+bne *r5
+sub #149, L5
+L10: .string "vqs"
+bne L0
+L11: lea L9, L9
+
+add *r5, *r3
+add *r4, L11
+L12: dec *r3
+L13: cmp r5, L4
+L14: not L5
+inc L14
+clr *r7
+L15: .string "lww"
+L16: .string "ssepbntvevsmmzbqu"
+lea L12, r1
+L17: not *r2
+prn r1
+sub L4, L15
+stop
+add #-11, *r4
+prn #-204
+red L2
+L18: red r1
+L19: not r0
+L20: .string "ckzyyphqjkupyqlzuvnf"
+dec *r4
+not r5
+L21: .string "nwqxchnfadpcezzgo"
+L22: red *r5
+L23: .string "yduyhcqnnlbyyzzjaopjfoox"
+L24: rts
+L25: rts
+stop
+not r4
+bne *r2
+cmp *r6, *r5
+
+stop
+L26: bne *r7
+L27: red *r2
+sub #-101, L2
+jsr *r0
+L28: sub L27, L19
+mov r0, *r3
+jsr *r7
+L29: mov r0, L20
+bne L24
+inc r4
+L30: .data -177
+L31: sub L6, *r5
+bne *r1
+clr r0
+jsr L28
+bne L7
+L32: .data 935, 744, -935, 825, -601, 821
+prn #-79
+L33: lea L17, *r0
+L34: jmp *r7
+red *r2
+rts
+lea L4, L2
+L35: clr L34
+cmp L30, *r0
+rts
+L36: red L10
+add *r6, L11
+L37: not r2
+L38: .data -242, 373, 392, -802, 578
+L39: dec r5
+add r5, L31
+jsr L37
+prn L9
+red *r5
+L40: .data 45, -810, -793, 886, -245, 890, 887
+L41: cmp L17, L12
+sub #-141, r3
+rts
+L42: sub L25, L0
+rts
+clr r3
+mov #126, L33
+jmp *r5
+sub *r0, L0
+clr L25
+L43: rts
+L44: lea L0, *r0
+clr r4
+jmp *r3
+; comment
+mov #-194, *r3
+L45: jmp L32
+rts
+L46: .data -822, -128, 940, 293, 668
+clr *r7
+red *r7
+jmp *r6
+L47: jmp *r1
+bne *r2
+mov *r2, *r0
+L48: clr r1
+L49: lea L27, *r5
+L50: rts
+cmp #-14, r3
+lea L8, L39
+prn L9
+L51: .string "rkeygrn"
+
+L52: .string "rmk"
+L53: clr r5
+prn L53
+dec r6
+L54: prn #5
+L55: stop
+dec r6
+L56: .string "apbsbshqacvpmon"
+rts
+cmp L49, r5
+add L37, L52
+lea L5, L42
+rts
+dec *r1
+L57: .data 269, 985, -108
+red *r2
+jmp L34
+add r7, L12
+L58: jmp *r7
+mov L26, L32
+red r2
+L59: .string "pifjiuy"
+L60: dec *r5
+prn r4
+L61: .data 794, 815, 509, 340, -521
+L62: .data 684, -352, -738, -355, 384, 609, -294, 332
+L63: sub r6, r6
+L64: jsr *r6
+rts
+L65: .data -263, 452, -926
+rts
+not r0
+not *r1
+jsr *r6
+clr *r2
+stop
+L66: clr r3
+red r5
+L67: cmp *r2, *r6
+L68: stop
+rts
+prn r4
+clr *r7
+inc L23
+red r1
+cmp #239, #-2
+lea L38, *r3
+L69: .data 845, -66, -937, -71, 867
+jsr L8
+; comment
+jmp L38
+L70: dec r7
+bne L67
+L71: inc L12
+L72: .string "rnxy"
+add *r2, r5
+
+add #-117, *r2
+lea L50, r7
+sub L13, r0
+; comment
+
+L73: .string "pxqsq"
+add *r0, L21
+L74: prn #230
+L75: .string "iokeurhslgg"
+L76: dec L29
+L77: sub #-36, L34
+prn #-78
+inc r6
+bne L10
+
+not *r6
+stop
+L78: jmp *r4
+L79: jsr *r3
+add #-9, *r4
+clr *r5
+jsr L59
+L80: .data -859
+L81: inc L23
+sub *r1, L25
+L82: jsr L2
+L83: rts
+L84: bne L37
+prn *r3
+clr L83
+L85: mov r3, *r4
+L86: jmp *r7
+prn *r5
+L87: sub r0, *r7
+L88: .string "koe"
+L89: cmp *r5, #-79
+bne L59
+bne *r2
+clr r5
+L90: prn L79
+L91: .data -607, -323, -707, 773, 903, -357, 917
+lea L58, r4
+stop
+L92: red L56
+add #-102, *r4
+prn L60
+L93: stop
+lea L78, L80
+lea L6, r0
+L94: .data 619
+bne L5
+red *r0
+L95: .string "qhsfsguzsb"
+L96: stop
+L97: .string "mqejmnpmxnwii"
+dec *r4
+sub #6, *r6
+L98: add L86, r7
+L99: jmp L73
+L100: .data 760, 924, 18, 976, 145, 76
+L101: .data 934, -418, -500, 823, -246, -132
+; comment
+; comment
+lea L10, *r7
+add #92, r3
+L102: prn *r6
+jmp L33
+rts
+L103: .string "tyce"
+not *r6
+not r0
+red *r5
+L104: add *r0, r6
+jmp L39
+
+cmp L58, *r6
+not L25
+L105: sub #177, *r6
+L106: .string "uqopugzfnkmxmvkjyaog"
+L107: prn #183
+mov r4, L29
+bne L24
+clr *r5
+red r3
+L108: stop
+red *r2
+not *r5
+inc L73
+cmp L30, r5
+L109: dec r6
+dec r6
+L110: .string "xnzztzcikavsmiyruh"
+prn L78
+sub *r1, *r5
+L111: lea L77, *r5
+prn r7
+jmp L46
+L112: prn *r1
+jsr *r0
+L113: clr *r0
+red r6
+; comment
+bne *r0
+rts
+L114: mov L7, *r2
+; comment
+L115: sub L76, L40
+L116: rts
+
+rts
+mov r5, r5
+clr r5
+jsr *r4
+rts
+L117: sub #185, r1
+red *r1
+jsr L103
+not r7
+L118: prn *r2
+L119: clr r7
+L120: jmp *r2
+L121: .data 400, -994, 894, -154, -718, -508
+L122: rts
+cmp #-54, L60
+add *r0, *r1
+L123: .string "tgzp"
+L124: rts
+sub L111, L39
+dec *r4
+L125: not r5
+dec L80
+inc L64
+sub #146, r6
+bne L19
+dec r0
+L126: jsr L12
+jmp L53
+L127: stop
+; comment
+dec L37
+jsr L111
+L128: add #1, L21
+L129: jmp L85
+L130: .string "ijdbox"
+inc r4
+jsr L50
+rts
+L131: sub L61, r2
+jsr L92
+add #-104, *r4
+dec r6
+L132: clr L43
+L133: bne L90
+prn r2
+L134: add *r1, r5
+L135: lea L52, L92
+jsr *r6
+L136: add *r5, r1
+mov *r7, r3
+L137: lea L126, L103
+add r0, r4
+rts
+L138: prn L95
+lea L50, r4
+; comment
+rts
+L139: inc L32
+add #-5, r1
+L140: rts
+L141: bne *r0
+L142: mov *r2, L105
+rts
+bne L133
+cmp *r5, *r2
+L143: .data -716, 29, -794, -949, -410, 0, 961
+clr *r5
+L144: rts
+; comment
+prn #178
+jsr L29
+prn L140
+clr L43
+not *r0
+bne *r0
+L145: jsr *r4
+L146: .data 703, -598
+inc r4
+dec L79
+inc L60
+cmp r5, r0
+mov r5, *r2
+mov L125, r5
+jmp L97
+L147: bne L138
+L148: add L33, r4
+L149: lea L84, *r0
+add L99, L115
+L150: mov *r4, *r4
+prn *r0
+
+clr r0
+; comment
+L151: stop
+dec r6
+
+jmp L103
+dec r1
+clr r3
+; comment
+red r6
+L152: mov r2, L119
+inc L4
+jsr *r7
+mov *r5, L151
+L153: dec r6
+dec *r3
+L154: cmp #171, L8
+add *r3, r2
+L155: lea L32, *r2
+L156: rts
+
+inc r3
+stop
+stop
+dec r5
+L157: .data 166, 359, 425, -47, 180
+stop
+inc r5
+; comment
+jmp L87
+not r3
+bne L51
+L158: cmp r6, L124
+
+sub *r4, *r7
+L159: add #-29, *r0
+cmp #204, #211
+L160: add *r0, r3
+stop
+red L151
+stop
+L161: lea L74, r7
+L162: bne *r1
+L163: bne L101
+not L71
+L164: red L17
+mov *r2, L104
+L165: prn #65
+L166: .string "ddltfehmfgwiyno"
+jmp *r6
+L167: jmp *r6
+rts
+lea L99, L110
+L168: bne L155
+L169: .string "ziggektueosgvdeejphou"
+L170: jsr L47
+bne *r7
+dec L116
+L171: clr *r6
+prn r5
+stop
+L172: dec *r3
+inc r7
+not *r3
+add r6, *r0
+lea L160, r1
+mov #230, L80
+; comment
+
+inc r6
+red *r0
+not r0
+cmp L100, *r2
+prn L105
+rts
+L173: clr *r6
+lea L45, L135
+L174: lea L154, *r1
+bne L60
+lea L118, *r7
+
+mov *r0, r5
+rts
+sub r7, *r2
+not *r6
+dec r7
+jsr L114
+add r1, L14
+; comment
+L175: jmp L97
+inc L82
+L176: .data 508
+prn *r4
+stop
+mov r1, r3
+L177: not L51
+add #-214, L15
+inc L19
+bne L29
+L178: not r5
+jsr *r5
+red *r6
+L179: mov #197, L8
+L180: not L42
+cmp L151, L129
+L181: .data -191, 4, -909
+L182: add #137, r7
+L183: mov *r1, *r4
+L184: cmp r2, L175
+mov *r1, L10
+L185: .data -841
+prn #216
+stop
+red r2
+jsr L126
+red *r4
+dec L106
+jmp *r1
+jsr L114
+prn #-130
+cmp r6, *r4
+sub L151, r7
+cmp L105, #110
+L186: rts
+jsr L42
+rts
+L187: .string "hnbcfpklvdcfwvcg"
+L188: add *r6, L57
+not L3
+clr *r1
+sub #154, L176
+jsr *r0
+not r6
+add r5, *r4
+prn #123
+L189: rts
+L190: .data 772, 595, -857, 724
+L191: .data 817
+jmp *r5
+sub *r3, *r2
+bne *r2
+rts
+jmp *r7
+jmp L165
+L192: prn *r1
+cmp L189, *r1
+inc *r6
+stop
+red *r2
+red r7
+cmp #40, #-184
+rts
+sub r5, L55
+inc r3
+not L170
+L193: sub #18, r0
+jmp *r5
+sub L145, *r0
+clr L19
+add *r4, r7
+stop
+prn *r5
+red L80
+L194: cmp *r7, L154
+L195: mov L83, L192
+L196: sub L14, *r0
+sub #102, *r3
+
+dec L138
+stop
+L197: prn r2
+L198: lea L69, r4
+prn r1
+cmp #-198, L35
+L199: clr L78
+L200: jmp L62
+sub r1, L197
+L201: red *r0
+L202: lea L41, L51
+L203: cmp L82, r7
+dec r7
+red r5
+L204: red r0
+L205: .data 122, 330, -66, 85
+clr L160
+clr L55
+cmp L36, L30
+sub *r7, *r7
+L206: clr r5
+L207: stop
+L208: bne L98
+L209: not *r5
+mov #-143, *r3
+L210: sub *r5, L78
+L211: rts
+L212: clr r1
+
+L213: red r2
+add r7, r6
+prn *r5
+add *r1, r1
+L214: cmp r0, *r5
+jmp *r4
+cmp *r6, L193
+rts
+bne L52
+red *r6
+L215: rts
+sub L18, r7
+red L82
+L216: jmp L67
+L217: not *r6
+jsr L189
+jmp *r6
+jsr L107
+L218: .string "gaurtfxvvosiltzcyesf"
+L219: jmp L144
+add *r2, *r6
+inc *r7
+L220: not r0
+dec L40
+red *r1
+cmp r5, *r4
+jsr *r7
+sub #-34, *r1
+stop
+L221: .string "adaqwpzutofzul"
+L222: stop
+L223: .string "rtpecpzk"
+mov r4, r0
+mov r6, *r3
+dec L94
+sub L139, r4
+jsr L222
+L224: .data 447, 94, -232, -839, -414, -416, -217
+not *r7
+add *r5, *r4
+L225: .string "htzatkabtaeuy"
+dec *r6
+prn *r5
+prn L170
+jsr L71
+not *r6
+prn *r2
+add *r7, *r0
+sub L142, *r7
+; comment
+stop
+jmp L145
+L226: sub L170, *r5
+stop
+L227: rts
+add #-136, r6
+dec r6
+red r1
+L228: stop
+L229: clr L199
+jmp *r4
+rts
+stop
+; comment
+L230: rts
+L231: rts
+not *r4
+; comment
+not r2
+L232: .data -799, -84, -829, 521, 838
+clr *r1
+stop
+add L83, r6
+L233: inc *r1
+sub r1, r4
+jsr *r5
+L234: inc L25
+inc *r5
+stop
+add r3, r5
+mov L218, r3
+sub *r1, r7
+rts
+jsr *r0
+red L132
+L235: .string "yltfmbkkjhqncjggaujna"
+L236: .data 503, 592, -998, 942, -720, 920, 237
+L237: .data -993, -539, -427, 728
+add *r5, L172
+L238: sub *r7, L217
+jsr *r5
+L239: mov r4, *r1
+cmp #125, #-46
+dec r2
+inc L188
+rts
+bne L100
+L240: jmp L143
+L241: mov L142, *r1
+L242: mov L126, r7
+inc *r0
+jsr *r0
+inc *r3
+L243: inc *r6
+L244: jmp *r0
+rts
+L245: add r5, *r6
+dec r1
+L246: .string "ks"
+
+L247: .data 579, 865, -685, -486, -277, 386, -413
+; comment
+clr r2
+L248: sub L191, *r2
+prn #132
+L249: dec *r3
+dec *r3
+mov *r7, *r3
+L250: rts
+L251: stop
+not L47
+L252: .string "vzqz"
+cmp r6, r3
+not L61
+L253: red *r7
+L254: not *r1
+not r4
+bne L53
+L255: red *r0
+bne *r4
+add #-32, L39
+not *r3
+L256: .string "ryxwtztkyesvjfyt"
+add L67, L102
+
+L257: .string "iscr"
+not *r2
+L258: sub *r1, r3
+add r7, L118
+mov #-39, *r1
+L259: .data -702, -225, -465, 643, 538, 705
+L260: clr r3
+L261: mov #-218, r2
+L262: dec L141
+; comment
+L263: jmp L174
+red r3
+L264: prn L118
+L265: red *r3
+prn *r5
+lea L78, r5
+L266: rts
+red *r3
+rts
+L267: .data -971, 940
+jsr *r5
+mov L237, *r6
+L268: mov *r7, *r2
+bne L230
+L269: jsr L110
+red *r0
+cmp *r7, r6
+red r6
+
+jmp *r3
+bne *r4
+L270: mov r0, *r7
+; comment
+sub L70, L226
+bne *r1
+rts
+L271: .string "ggzxwug"
+red L29
+clr *r5
+red r6
+L272: .string "pfxtssky"
+clr r2
+jmp *r2
+cmp *r1, *r7
+not L164
+L273: mov #-3, L240
+; comment
+mov L225, *r4
+L274: rts
+sub *r2, r4
+stop
+inc r2
+L275: jmp *r7
+bne *r4
+L276: add #219, *r1
+not *r5
+L277: rts
+L278: clr *r4
+L279: sub #192, r0
+L280: inc r2
+stop
+add *r4, *r2
+bne L38
+sub L225, *r6
+L281: mov #-114, L132
+stop
+lea L254, L40
+cmp *r7, L70
+inc r7
+rts
+clr L155
+rts
+lea L46, r4
+stop
+red *r4
+lea L159, r6
+lea L139, r1
+jmp *r7
+L282: dec *r5
+red r0
+dec *r6
+prn r0
+cmp r1, L139
+mov *r2, r6
+jmp *r0
+mov #145, L6
+
+jmp L274
+cmp r0, r0
+L283: rts
+lea L168, L56
+L284: inc *r0
+jmp L234
+L285: jsr L30
+jmp L211
+L286: .string "vkemsufiz"
+L287: clr L57
+L288: lea L250, L129
+bne *r6
+jsr *r6
+L289: .data 400, -986, -387
+rts
+not L207
+L290: mov #-88, *r2
+prn *r5
+clr L163
+L291: bne L238
+lea L269, r5
+L292: mov L290, L191
+dec L11
+sub #-160, L267
+L293: red L247
+clr *r2
+red r4
+L294: not L225
+add #-72, L117
+lea L233, r6
+L295: stop
+jsr L61
+not L161
+mov L79, *r1
+mov #86, r5
+L296: .data -462, 444, 353, -574, 741, -240, -502
+L297: clr *r1
+bne L222
+L298: sub *r3, *r0
+red L145
+L299: sub *r6, *r2
+L300: stop
+L301: .string "nojczdmqigyucte"
+L302: .data -291, -102, -207, 92, -194, 614
+jsr L161
+L303: lea L289, r3
+mov L206, *r7
+L304: cmp *r4, *r0
+
+cmp *r0, r1
+mov #95, *r0
+stop
+bne L90
+bne L241
+; comment
+L305: mov *r2, L296
+L306: .data 720, 306, -104, 253, -433, 599, -156
+
+L307: jmp *r4
+bne *r4
+rts
+
+sub #238, *r0
+lea L124, *r3
+
+L308: .data -914, -869, 924
+sub *r5, L272
+L309: stop
+not r2
+L310: .data -145, 382, 608, 350, 375
+add r3, L278
+L311: stop
+L312: clr *r3
+lea L139, L296
+L313: .data -608, -127, -299, 959
+
+L314: dec *r0
+inc *r6
+bne *r2
+L315: bne *r0
+L316: clr *r3
+L317: sub L212, r5
+
+L318: jsr L240
+
+L319: lea L31, r4
+L320: .data -321
+mov r0, *r1
+L321: sub *r6, L216
+
+mov *r1, *r7
+L322: stop
+L323: sub *r2, r6
+dec r4
+not L104
+L324: cmp r5, L116
+rts
+prn L50
+add #-115, L299
+prn #148
+red L102
+L325: not L68
+red *r7
+dec *r6
+jsr *r7
+mov #-1, r1
+cmp L238, r7
+red *r0
+add #225, r2
+L326: .string "hqwqspwuiwuc"
+cmp r3, #5
+L327: stop
+jmp L217
+L328: bne L323
+bne *r2
+L329: cmp *r5, L329
+L330: stop
+L331: dec *r4
+stop
+not r3
+L332: mov #158, *r3
+
+L333: .string "ojhosudev"
+inc *r4
+L334: prn r0
+L335: .data 151, 280
+cmp r6, L66
+cmp #30, *r0
+clr *r2
+lea L40, r0
+prn #-203
+rts
+rts
+jmp *r0
+L336: .string "oidnycceoa"
+L337: .string "rowwmazkiopyosqvlbtqn"
+sub #34, *r7
+L338: mov r0, r1
+bne *r4
+not r5
+inc r5
+add #133, *r2
+; comment
+L339: prn *r0
+prn r5
+L340: rts
+dec *r1
+bne L42
+stop
+L341: .string "gokmrqclmjojy"
+lea L79, r4
+red r6
+lea L119, r0
+L342: jmp L260
+stop
+L343: lea L34, L322
+stop
+L344: prn *r1
+cmp #236, #225
+jsr L64
+L345: cmp *r5, r1
+L346: stop
+prn #144
+mov *r2, r1
+clr *r4
+mov L166, r1
+clr L314
+L347: jsr L244
+jsr L79
+jsr L221
+L348: prn r5
+L349: sub r3, r5
+rts
+L350: dec r4
+L351: .data 370, 753, 852, 433, 386, 646, 43
+L352: cmp *r1, #130
+inc r4
+L353: prn L21
+L354: .string "tkazgidjpzkpknbsai"
+L355: clr r7
+dec L308
+not r2
+L356: red L87
+jmp *r0
+L357: bne *r7
+mov L325, *r2
+L358: clr L217
+jmp L260
+L359: .data 730
+add #180, L123
+L360: lea L206, r4
+cmp L149, *r6
+cmp #-226, #-104
+L361: .data -17, 149, -709
+red *r3
+stop
@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 6
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+bne L329
+bne L247
+; comment
+L0: red L0
+L1: dec L0
+stop
+cmp *r1, L0
+L2: red *r4
+L3: mov #-152, L3
+L4: not *r7
+L5: bne *r6
+sub L2, *r3
+L6: .string "wd"
+red L3
+lea L1, r6
+clr L3
+L7: clr r6
+L8: not L0
+L9: .string "nmdaqhuotkzyzuhx"
+L10: mov r7, r7
+L11: .string "yucfqvruyu"
+inc L5
+not L1
+L12: cmp #-23, #103
+not r6
+clr L12
+stop
+bne *r7
+L13: lea L3, *r0
+L14: red r2
+add *r6, *r4
+jmp *r5
+L15: rts
+rts
+red L2
+L16: clr *r2
+mov L7, *r2
+L17: .data 57
+rts
+lea L8, *r2
+L18: prn r0
+clr L10
+L19: .data 945, 621, 545, -142, 988, -230, -865
+stop
+not L11
+lea L19, r0
+L20: dec L18
+L21: jmp L4
+red L14
+L22: lea L10, *r4
+rts
+mov *r0, r7
+red *r6
+clr L0
+mov L17, L22
+L23: .string "bqrolpgvaxctnztwxgxo"
+L24: bne L6
+L25: jsr L14
+prn L6
+lea L7, *r1
+stop
+; comment
+inc r2
+stop
+stop
+stop
+L26: inc L6
+red *r7
+red r1
+
+L27: .string "vhs"
+L28: clr r1
+cmp L18, #154
+prn L22
+stop
+stop
+L29: .string "wcsxclepttwtqwmlusmm"
+rts
+L30: .string "rztrsmgs"
+stop
+L31: .data -206, -909, -238, 275, 977, 131
+jmp *r7
+prn L26
+L32: .string "eam"
+red L26
+L33: not L27
+jsr *r3
+L34: .string "dsmvveujkjdrkp"
+sub r1, *r2
+L35: lea L14, *r1
+L36: add #-158, L34
+L37: prn #83
+L38: .string "tfckkaxlhwy"
+L39: jmp L24
+not *r1
+bne L0
+jsr *r6
+clr r4
+
+L40: .data -367
+inc L32
+prn L0
+clr r7
+L41: cmp *r3, r6
+cmp #-206, *r2
+L42: lea L1, r0
+; comment
+L43: .data -820
+add r5, *r2
+bne *r0
+jmp *r1
+inc L2
+clr *r4
+prn L23
+mov L7, r2
+rts
+L44: lea L7, *r7
+
+inc r7
+L45: clr L10
+clr *r1
+L46: sub r1, L21
+bne *r2
+dec *r4
+; comment
+dec *r2
+L47: .data 121, -324, -921, 283, -506, -384, -594, 669
+prn L7
+L48: lea L29, L21
+stop
+red *r2
+not *r1
+L49: rts
+mov *r0, L15
+L50: mov L11, L18
+cmp r7, L36
+L51: rts
+mov #127, *r3
+L52: inc *r2
+L53: lea L49, r6
+
+not *r1
+L54: .string "jaegjdpvdpx"
+L55: .data -163, -895, -674
+not r0
+L56: rts
+sub r1, L52
+bne *r4
+rts
+stop
+L57: lea L19, *r3
+L58: .data 583, 420, 4, 845, -539, 113, 993
+L59: .string "mqkp"
+jmp L6
+L60: mov #98, L31
+L61: .string "xpplvhzjecvmkbkvnqptcgj"
+lea L48, r4
+L62: jmp L61
+lea L33, r0
+prn *r7
+stop
+jmp L36
+L63: lea L4, *r4
+jmp L32
+prn L33
+L64: .string "gjxhdfvevohjykfbs"
+L65: dec L24
+L66: bne L22
+stop
+L67: .data -456, 228, 808
+L68: .string "xpdbfcmakplmckqtbdbw"
+L69: .data 536, -857, 903, -852, -778, 216
+L70: cmp L4, r3
+prn *r0
+L71: .string "ea"
+stop
+rts
+rts
+L72: dec L47
+rts
+add *r2, r7
+dec r6
+mov r7, *r7
+bne L25
+mov L6, r0
+stop
+sub r6, r7
+rts
+inc *r0
+L73: .string "fgnyaarnzjdwmmxemg"
+prn *r2
+L74: mov L43, r6
+not r4
+bne *r4
+; comment
+rts
+L75: clr *r4
+red *r1
+dec L26
+; comment
+red *r5
+L76: .string "vcfbkxhmpwm"
+L77: lea L13, L33
+L78: sub L50, L26
+stop
+L79: prn L9
+add *r4, *r5
+L80: .string "rcztgmcqexbr"
+L81: sub r0, *r0
+jmp *r2
+L82: cmp #163, r3
+add #130, *r0
+cmp r3, #14
+red L77
+lea L1, *r5
+not L65
+prn r6
+L83: .string "qqdugdndcjoxka"
+dec r7
+stop
+L84: jsr *r1
+inc r0
+red *r7
+; comment
+not *r4
+sub L77, *r1
+cmp L77, r1
+L85: jsr *r1
+lea L8, r5
+L86: red r5
+L87: not *r3
+add *r4, L2
+; comment
+L88: .string "tuuzyxddmdnlngztoh"
+cmp *r6, #179
+inc r4
+mov L79, L80
+jmp L74
+L89: lea L77, *r4
+L90: prn *r1
+clr L7
+dec r5
+inc r5
+L91: jmp L48
+bne *r7
+L92: cmp r5, #215
+L93: dec L74
+mov *r3, *r5
+L94: rts
+prn *r0
+L95: lea L34, L74
+bne L33
+prn *r4
+L96: stop
+jmp *r4
+clr L69
+L97: sub r0, L8
+clr r3
+L98: cmp #-237, r0
+; comment
+L99: lea L77, L17
+L100: cmp *r1, L9
+prn r3
+L101: jsr L58
+mov L10, L26
+lea L30, L100
+jmp *r6
+stop
+cmp L42, #193
+L102: clr L17
+mov L2, *r3
+
+L103: inc L57
+bne L42
+mov L15, *r7
+L104: .string "pcsoaqhsoygatuukuoyyw"
+inc *r2
+clr L42
+L105: sub L98, *r5
+L106: inc r0
+L107: clr r7
+L108: mov L24, r0
+mov r2, r6
+stop
+L109: prn L79
+L110: red L88
+rts
+clr L73
+
+red *r4
+add r1, *r6
+L111: mov *r1, L58
+rts
+lea L24, L85
+lea L90, L64
+bne L102
+L112: prn *r1
+jsr *r7
+L113: red *r5
+mov r6, *r0
+inc L89
+L114: not r0
+red L41
+L115: clr L21
+
+jmp *r3
+; comment
+red *r5
+jsr *r7
+L116: red L50
+L117: .string "xnexgqxzcpzhyhevi"
+prn r6
+cmp r0, r1
+L118: cmp L107, *r7
+L119: red *r7
+L120: .data 891, -598, 493, -296, -611, -251, -979, 452
+mov r1, r0
+jsr L66
+stop
+prn #-137
+dec L8
+mov #-91, *r1
+stop
+sub L62, r6
+cmp r6, r4
+L121: .data -176, -838, 375, 612, -822, -327, -506
+sub *r4, r2
+lea L5, r2
+inc *r7
+dec r3
+jmp L54
+inc *r5
+L122: not L87
+L123: rts
+sub *r3, r7
+bne L28
+sub #-228, *r7
+L124: lea L48, *r3
+L125: red *r2
+jsr L120
+stop
+
+mov L31, *r0
+L126: .string "qqxksmohnvwkywbs"
+rts
+mov r6, L88
+jsr L35
+clr *r4
+lea L83, L72
+jmp L119
+not *r3
+L127: lea L63, L45
+sub L89, *r6
+bne L74
+L128: sub r3, L89
+add #9, L120
+red *r5
+L129: cmp #-76, r5
+bne L40
+rts
+L130: jmp *r3
+clr L18
+L131: inc *r0
+L132: clr *r3
+
+
+L133: red r4
+mov #-68, *r1
+L134: rts
+not r3
+sub L51, r0
+L135: clr r2
+jsr *r2
+clr r4
+L136: red r1
+prn #-182
+sub L118, r4
+rts
+L137: dec L18
+lea L105, *r4
+L138: .string "wyiskfjkqtp"
+stop
+L139: rts
+L140: red *r1
+L141: clr r7
+L142: jsr L46
+sub *r3, r1
+L143: lea L43, *r3
+L144: sub #18, *r1
+L145: lea L90, L128
+sub #-10, L85
+
+bne *r1
+mov *r1, L130
+lea L66, L48
+rts
+clr L38
+L146: jsr *r2
+L147: inc *r4
+red *r6
+add #180, r6
+not r5
+jsr L139
+L148: dec r0
+mov #-119, *r2
+
+cmp L119, *r2
+L149: prn L140
+mov *r4, *r1
+L150: add #70, L25
+inc *r3
+L151: rts
+L152: clr L125
+prn #113
+stop
+stop
+not L42
+; comment
+lea L6, L120
+L153: rts
+lea L3, L37
+L154: sub #-73, r7
+add L88, L68
+rts
+mov *r3, r0
+jmp L12
+jmp *r1
+; comment
+L155: .data 563, 261, -620
+prn *r6
+L156: rts
+rts
+add r1, r2
+red *r2
+; comment
+L157: .string "cibujiqzfhlpahnn"
+dec L20
+not r0
+not L19
+cmp r0, *r6
+jmp L92
+jmp L96
+L158: prn r6
+L159: red *r0
+red r1
+prn r0
+prn r0
+clr *r4
+inc r2
+L160: prn L143
+L161: cmp #37, L145
+clr r3
+sub r0, r0
+L162: jsr *r4
+L163: .data -222, -997
+red L123
+; comment
+L164: .data 141
+clr *r4
+L165: .string "cpqlodfoknzjc"
+rts
+L166: stop
+sub L0, *r2
+dec L7
+red L162
+
+; comment
+red L90
+L167: .data 714, 557, 384, 689, 181, 830, -821
+L168: .string "keuzgrycynvwfpgowmuqfkr"
+jsr *r7
+L169: .string "jxkb"
+dec r7
+L170: clr *r7
+stop
+red *r3
+clr L59
+bne *r3
+inc r4
+L171: rts
+jsr L123
+jmp L26
+L172: cmp *r5, *r7
+bne *r5
+L173: .data 685, -362, 787, -131, -580, 310, 580, 231
+cmp #194, #-39
+clr r1
+cmp #-15, *r5
+inc r6
+prn #137
+dec r6
+bne L137
+L174: add *r2, r5
+cmp *r4, *r0
+mov L133, r0
+lea L74, L33
+prn r0
+jsr *r7
+dec r7
+L175: not L97
+sub r2, r4
+L176: not *r2
+clr r2
+L177: rts
+L178: add *r6, L149
+L179: .data -519
+red *r4
+dec *r6
+; comment
+not r7
+prn #65
+rts
+stop
+L180: red L147
+cmp L121, L104
+L181: not *r4
+lea L52, *r7
+add #-210, r7
+jmp L133
+L182: red *r0
+jmp *r1
+not L13
+L183: mov L112, L29
+sub #-124, *r3
+L184: dec r7
+prn *r5
+L185: jsr L105
+rts
+L186: .string "ntyegalhyugbqbq"
+L187: clr *r2
+rts
+clr r6
+L188: clr L19
+add #25, L144
+not r3
+L189: red *r3
+rts
+add L23, *r1
+L190: not r5
+inc L95
+L191: prn *r4
+add #217, r2
+bne L33
+dec r2
+not r6
+L192: cmp #-139, L109
+inc r7
+red *r5
+inc *r5
+L193: not r1
+L194: .data 580, -257, 517, -794, -137, -598, 286
+L195: inc *r4
+L196: rts
+jsr *r1
+inc r0
+stop
+stop
+L197: dec L177
+L198: mov L100, L66
+red r2
+stop
+L199: red r0
+L200: stop
+mov r6, *r7
+L201: jmp *r5
+cmp #161, r0
+jsr L57
+L202: sub L19, L37
+red L69
+L203: rts
+inc r4
+L204: stop
+L205: red L112
+L206: red r5
+inc L58
+
+clr *r6
+L207: red *r1
+stop
+prn r3
+L208: rts
+cmp *r1, L197
+prn *r2
+mov *r3, *r4
+sub #-81, *r4
+L209: sub L15, L135
+rts
+L210: rts
+
+dec L36
+L211: mov L64, r0
+add r2, L166
+; comment
+jmp L94
+cmp L117, #150
+jsr L207
+lea L100, *r4
+red L163
+mov r6, r3
+sub L170, *r5
+sub r4, r2
+sub r4, r1
+add L161, *r4
+mov L83, *r2
+L212: add *r1, r5
+L213: .string "qn"
+L214: lea L187, r7
+dec L81
+stop
+add #-236, *r3
+stop
+cmp #29, r0
+L215: jsr L157
+inc L6
+mov r4, r2
+cmp *r3, *r0
+inc r1
+L216: inc *r5
+rts
+L217: .data -883, 8, 508, 900, -350
+L218: jmp *r4
+L219: mov #245, r7
+mov L156, *r5
+bne L218
+jsr *r7
+clr r2
+L220: dec *r0
+L221: .data 539
+jsr *r5
+red r2
+not L84
+L222: lea L204, r4
+L223: cmp r6, r1
+L224: mov *r6, r7
+dec r1
+add *r0, L82
+
+L225: .string "kccxcuuuajrs"
+bne *r4
+; comment
+inc L35
+dec L17
+cmp L89, *r6
+L226: bne *r1
+L227: clr r7
+L228: dec *r0
+inc r6
+red r2
+not *r4
+L229: jsr *r4
+; comment
+bne L9
+prn r5
+L230: .data -450
+inc *r7
+jsr L16
+sub #64, *r4
+L231: stop
+jsr *r3
+L232: add L84, r6
+red *r1
+red *r2
+clr r4
+L233: mov r3, r3
+L234: prn L156
+red L205
+jmp L17
+clr *r3
+mov *r4, r2
+inc L167
+lea L172, r1
+prn r4
+red *r5
+L235: .string "uyrgbpehavdyegi"
+lea L108, *r7
+L236: .data -573, -632, -154, -993, -539
+clr L177
+L237: sub *r7, r5
+L238: red r4
+mov *r5, *r0
+L239: rts
+; comment
+rts
+rts
+lea L87, r2
+L240: jmp *r6
+dec r5
+L241: .string "ldikeojdxhrmuqrbtplova"
+add #130, *r7
+add #43, L184
+; comment
+mov #56, L69
+cmp *r7, #-38
+inc r6
+L242: .data 544
+rts
+L243: dec *r1
+dec r0
+L244: bne *r5
+L245: sub *r4, r3
+L246: inc r0
+L247: prn *r5
+L248: .data -480
+L249: red L174
+L250: inc *r0
+L251: jsr L22
+bne *r7
+dec *r0
+red *r0
+L252: inc r5
+prn #-170
+L253: .data -326
+bne *r1
+L254: .data 464, 583
+L255: .data 232, -193, -318, -654, 286, 442, -862
+clr L86
+L256: mov *r1, L30
+L257: .string "nwpxvlemk"
+bne L47
+L258: clr L181
+rts
+
+jmp *r5
+L259: mov L32, L134
+dec L178
+add L222, r5
+L260: stop
+L261: .data 329
+L262: lea L183, *r3
+not L135
+inc L189
+bne L122
+L263: clr r3
+L264: .string "ahcnywqslvujx"
+L265: .data -767, 375
+clr r2
+mov *r6, *r3
+L266: jmp L94
+clr L235
+add L213, L223
+L267: sub r7, *r2
+add r7, *r0
+dec r2
+jmp *r6
+jsr L177
+lea L75, L104
+jmp *r4
+inc r3
+prn *r7
+L268: prn r1
+L269: mov #38, *r1
+clr L14
+L270: jmp L130
+jsr L55
+stop
+L271: .string "ilqfkzlpqspyaln"
+cmp #181, #-176
+inc *r0
+L272: inc *r5
+L273: lea L240, r3
+sub L115, *r0
+inc r0
+add r3, *r2
+; comment
+not L181
+
+rts
+not L165
+clr r5
+not L104
+L274: .string "cvkkoakmztdiwtuujita"
+L275: sub *r4, L153
+L276: inc r0
+L277: prn r6
+L278: jmp *r1
+prn r0
+bne *r5
+L279: stop
+clr L89
+rts
+dec *r2
+L280: .data 550, -132, -236, 194, -809
+L281: mov L126, *r1
+not L153
+clr r1
+cmp *r0, #133
+L282: jsr L73
+L283: stop
+L284: clr L143
+L285: sub *r5, r4
+L286: not L22
+L287: rts
+L288: stop
+L289: dec r7
+lea L142, *r0
+jmp *r4
+red *r6
+add r4, L220
+prn r1
+jmp L97
+add L173, *r1
+; comment
+mov r7, r7
+stop
+L290: stop
+L291: not r3
+L292: red L13
+
+not *r7
+L293: add #184, *r4
+bne L244
+L294: not r5
+clr L145
+jsr *r7
+bne L72
+prn *r1
+L295: lea L156, r2
+L296: clr L174
+jsr L294
+L297: jmp L278
+
+inc *r7
+
+L298: mov *r3, r0
+L299: .data 500, -425, -726
+L300: rts
+L301: rts
+jsr L171
+stop
+bne L68
+L302: bne L263
+L303: clr L108
+jmp *r6
+L304: red *r1
+lea L182, r6
+L305: jsr L184
+L306: mov *r7, L95
+L307: bne L60
+not r7
+jsr L195
+L308: .data 449, 647
+lea L76, L264
+add L257, *r5
+bne *r3
+cmp L228, r0
+jsr L192
+dec L146
+clr L250
+clr *r5
+L309: lea L303, r1
+dec r5
+dec r4
+mov r1, L252
+dec *r2
+not *r5
+lea L300, L230
+L310: not *r1
+jmp L233
+L311: jmp *r6
+stop
+L312: stop
+mov r7, *r7
+not r4
+stop
+bne *r7
+red L293
+prn L291
+sub #-167, *r3
+not L106
+L313: .string "huxpbrcxoldrnnihxipvpot"
+L314: .data -445, -279, -834, 928, -511, 771
+L315: bne L308
+sub *r6, *r1
+prn r7
+L316: mov r0, L166
+add #-229, r5
+dec r0
+L317: jmp L180
+rts
+L318: bne *r1
+dec *r2
+L319: prn r2
+prn *r4
+jsr *r4
+
+L320: not r1
+L321: prn #48
+L322: .data 650, 530, 490, 109, 556, -710, -385
+dec *r5
+inc r7
+rts
+add r3, *r4
+mov *r4, r5
+dec L318
+not L320
+bne L266
+add r0, L160
+L323: stop
+L324: .string "cfigbspe"
+L325: not *r3
+sub L296, L155
+cmp r3, *r3
+not r7
+add *r6, L60
+mov *r5, *r6
+lea L291, r7
+red L293
+dec r6
+L326: .data 249, -793, 814, 59, 953, 514, -850, 169
+L327: lea L204, *r3
+L328: .data -136, -666, 475, 735, -270
+not L179
+not L168
+red r4
+red r7
+sub r6, r1
+prn L278
+jsr *r0
+dec L289
+red *r1
+clr *r1
+jsr L325
+not L39
+inc r1
+bne *r1
+jsr *r4
+L329: cmp *r2, #-177
+add #-183, *r0
+stop
+L330: prn #206
+L331: prn r3
+lea L248, r7
+inc L107
+L332: clr L304
+L333: .string "qcipgripwtfktyxuvdqhrd"
+L334: dec *r4
+lea L3, *r7
+inc L47
+L335: .string "mei"
+rts
+L336: mov r2, r3
+L337: .string "sv"
+rts
+L338: .data -473, 249
+bne *r5
+L339: prn #115
+L340: cmp #-158, #-117
+L341: dec L216
+L342: .string "rmtpdwazh"
+lea L122, r1
+mov *r5, r5
+stop
+stop
+L343: jmp L15
+L344: clr *r3
+L345: .data -523, -12
+L346: .string "jubzpeyrmzahxmu"
+stop
+bne L36
+rts
+sub #171, L217
+jsr L49
+red *r2
+not r2
+not L46
+mov #-82, L101
+red *r5
+cmp r2, *r2
+prn #56
+L347: lea L261, r7
+L348: jmp L241
+L349: .data -831, -429, 587
+L350: red L115
+L351: jsr L200
+jsr L330
+sub L239, L63
+sub #185, *r2
+sub #213, L153
+red r4
+; comment
+L352: .string "iyyhcdyfotcrwrhh"
+bne L6
+; comment
+red *r2
+L353: red r5
+
+sub L290, *r7
+L354: sub L177, L17
+; comment
+jmp L145
+; comment
+L355: .string "jcibw"
+L356: .string "luvswohzthndoouogbkqz"
+dec *r6
+bne L200
+L357: .data -985, -303, 481, 217
+; comment
+inc L136
+mov *r4, r4
+inc L299
+stop
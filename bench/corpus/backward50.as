@@ -0,0 +1,1026 @@
+; Generated by genCorpus --seed 51
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+L0: dec r2
+L1: mov *r0, r3
+L2: .data 823, -342, 547, 418, 338, -69
+clr *r0
+add *r5, r4
+L3: .string "ufjvjgqjmfqolxh"
+L4: rts
+lea L0, L1
+lea L2, *r2
+bne *r5
+jmp L2
+L5: add *r5, *r1
+clr *r2
+bne *r4
+L6: not L5
+stop
+
+
+L7: rts
+
+add L0, r7
+bne L5
+L8: clr r7
+L9: add L2, *r2
+mov r3, L8
+L10: red L9
+add *r7, L10
+not r2
+dec *r3
+rts
+L11: sub r0, r5
+L12: .data -788, 562, 602, 87, 895, 826, 830, -37
+L13: .string "uytmvqpwdlnygaayhqi"
+L14: mov *r7, *r7
+lea L9, L9
+L15: .data 5, 281
+cmp #-84, #160
+; comment
+prn r7
+prn r7
+sub r5, L9
+clr r4
+red r2
+dec L12
+sub r7, *r6
+L16: cmp #24, r2
+lea L15, L6
+cmp L12, r0
+L17: stop
+sub r6, L15
+L18: jsr *r2
+L19: mov #-151, L12
+not r1
+inc L8
+L20: prn *r1
+lea L9, L15
+stop
+lea L12, r0
+L21: cmp L5, r5
+red *r5
+L22: .string "qtpcrxytwsewvcowixluzygb"
+mov L3, r4
+
+L23: .string "aetgkiernrwfjhtcdl"
+rts
+L24: .string "iqfheq"
+inc *r6
+L25: .data -672, -819, 859, 288
+red *r5
+jmp *r0
+L26: mov *r2, L0
+mov r3, L7
+L27: sub #-185, L0
+rts
+red r7
+red *r4
+L28: cmp *r7, #-216
+L29: clr L21
+inc r4
+L30: inc r3
+inc L19
+stop
+lea L27, L13
+L31: not *r1
+L32: jmp *r0
+dec *r1
+dec *r0
+prn *r5
+add L16, r5
+stop
+jsr *r4
+L33: sub L11, L26
+L34: .data 795, -108, -231, 377, -158, 362, -607, -734
+L35: bne L19
+L36: .data 539, -967, -907, -946, 925, -242
+L37: stop
+stop
+sub *r5, r4
+L38: add L17, L17
+L39: prn r4
+inc r0
+L40: .string "mqtjmadbuwqngkwdj"
+prn r0
+L41: bne *r3
+L42: stop
+dec L18
+L43: add #185, r4
+rts
+lea L6, L10
+prn r3
+jsr *r0
+L44: dec r3
+clr L9
+jmp L35
+L45: stop
+L46: .data 63, 989, -955, 447, -352, -114, 911
+mov *r4, *r0
+L47: sub r1, r1
+not *r0
+L48: jsr *r5
+L49: jsr L27
+sub r0, L3
+
+L50: rts
+L51: rts
+sub L35, r7
+inc *r6
+L52: mov L44, r2
+L53: .string "asjsqvwecnchcymgint"
+inc *r0
+L54: .data 415, -671, 876, 320, -680, -363, -6, 202
+bne L51
+inc L23
+dec L49
+rts
+L55: not L42
+mov r7, *r2
+mov *r5, L27
+not L9
+lea L19, L36
+sub r5, r2
+L56: .string "lbdsvsouzbhpxfj"
+
+L57: jsr *r0
+L58: rts
+L59: stop
+stop
+L60: bne L28
+L61: red L32
+jsr L46
+inc *r3
+stop
+lea L6, L31
+cmp L43, *r2
+stop
+L62: clr r0
+L63: not r3
+rts
+red *r7
+L64: .string "kabtwmqeglfnqrrg"
+L65: mov L44, *r6
+inc *r7
+stop
+
+cmp L35, L43
+L66: .string "znnxgpafkqbyyjlcmgk"
+red L5
+jsr L45
+L67: inc r3
+L68: bne *r0
+sub *r1, *r0
+
+jsr L24
+jsr *r6
+L69: dec r3
+L70: lea L55, *r7
+L71: inc L24
+; comment
+L72: .data 236, 192, -202
+sub #-248, L23
+dec r2
+L73: prn L46
+lea L56, r2
+
+red L21
+L74: red r0
+cmp #96, r4
+L75: mov L70, *r2
+mov *r2, r5
+add #197, *r3
+L76: add r4, *r7
+red *r6
+L77: jsr L15
+stop
+inc r1
+L78: not *r4
+not *r7
+add *r0, r5
+L79: add r7, L56
+mov L44, r0
+L80: bne L51
+; comment
+L81: cmp *r2, *r6
+L82: mov *r3, r6
+bne *r0
+L83: .data 616, -806, 710, -447
+L84: dec r7
+mov *r3, *r6
+prn L64
+lea L81, *r2
+red r7
+rts
+rts
+sub r2, *r6
+jmp L48
+L85: .string "pflgdxxvjhqlznndtl"
+jmp *r5
+bne L55
+bne *r0
+L86: dec *r3
+prn L39
+L87: .string "yvp"
+L88: .data 564, 806, -96, 545, 542, 164
+; comment
+not r5
+L89: sub #155, *r7
+L90: inc r5
+cmp L3, #-28
+L91: red r1
+add #-215, *r2
+
+dec L29
+add L78, *r4
+lea L22, r4
+L92: sub L5, *r7
+cmp r3, L31
+sub #237, L55
+stop
+add #-30, r0
+L93: clr r3
+lea L42, L4
+sub L60, r7
+stop
+rts
+L94: stop
+L95: .string "shdmwo"
+L96: sub L95, *r3
+; comment
+jmp L85
+L97: .data 288
+add #77, L96
+mov L66, *r1
+L98: clr *r5
+not L48
+bne L44
+dec r2
+lea L77, r0
+L99: bne L52
+L100: .string "olenrcfbrlmozjkhxv"
+add r3, L53
+L101: rts
+L102: .data -817, -682, 226, -316, 601
+cmp L62, #-118
+L103: bne L30
+inc *r2
+red *r0
+prn #-198
+L104: cmp #-91, *r1
+; comment
+prn #223
+sub L7, L96
+L105: stop
+clr *r3
+rts
+prn #254
+L106: bne L33
+bne *r3
+not r3
+L107: stop
+L108: clr r4
+prn #102
+bne *r2
+L109: sub #254, r4
+L110: inc L23
+dec r1
+mov L16, *r1
+L111: jsr L59
+clr *r1
+L112: stop
+L113: add r4, *r3
+lea L84, r3
+L114: .data 861, 124, -145
+L115: jmp L6
+L116: bne L92
+; comment
+mov r1, *r2
+sub r3, L48
+red r3
+L117: bne L91
+L118: .data -567, -74
+bne L75
+dec L13
+jmp L61
+sub *r2, r7
+L119: bne L70
+add *r7, r3
+dec *r4
+L120: rts
+mov #202, r1
+jmp L34
+prn *r0
+L121: jsr L53
+prn L16
+L122: jsr L59
+stop
+L123: add *r7, *r3
+clr L68
+add r2, r7
+red L106
+sub *r4, r0
+add L11, r3
+L124: dec L95
+L125: .string "awkgwdhbrpf"
+L126: not L59
+stop
+
+L127: .string "wivajedqfi"
+lea L11, L57
+inc r4
+dec L64
+; comment
+L128: dec *r4
+mov r6, L6
+L129: jsr *r5
+L130: bne L40
+red L68
+rts
+L131: .data 949, 517, -90, -116, 722, -101, -232, 482
+; comment
+lea L6, *r6
+bne L108
+clr L33
+L132: cmp r2, r4
+dec *r0
+L133: cmp *r5, L86
+L134: prn r7
+L135: .data -931, 966, 801, 93, 169, -418, -833, 306
+L136: inc *r3
+dec *r2
+
+prn r3
+cmp *r7, r3
+add #-253, *r3
+sub *r5, *r0
+lea L38, r6
+stop
+L137: .data -188, 70, 75, 829
+stop
+cmp L21, L28
+inc L105
+cmp r5, #23
+red r6
+sub r7, *r1
+stop
+clr r4
+L138: mov #-34, *r4
+jmp *r2
+L139: stop
+dec L47
+L140: .data -914, 328, -329, -492, 970, -534, -562, -713
+add L101, *r5
+jsr L40
+inc L105
+mov r0, L6
+inc r7
+stop
+inc *r4
+prn L80
+L141: .string "cjosqgirziqgaigm"
+L142: .string "bimbwaqlhygzn"
+L143: .string "i"
+L144: mov #145, *r1
+L145: dec *r6
+not L106
+lea L46, r3
+L146: cmp #-107, L90
+L147: add L6, *r4
+L148: mov *r1, *r3
+clr L35
+jsr *r4
+mov r7, L54
+stop
+L149: .data -201, -640
+L150: sub L96, r7
+L151: not L34
+inc L20
+stop
+rts
+red *r5
+mov r0, r4
+dec *r3
+sub *r0, L81
+cmp *r7, *r0
+L152: .string "jgijduuilrj"
+sub *r4, r4
+L153: rts
+L154: sub *r2, L144
+L155: rts
+bne L136
+L156: .data 776, 53, 604, 866, -784, -10
+L157: not L36
+red r4
+sub r4, r7
+dec r7
+jsr *r3
+L158: jmp *r2
+not L79
+inc *r4
+jmp L95
+L159: clr r4
+cmp r5, *r5
+L160: bne L43
+dec *r3
+add #-187, r1
+L161: red L63
+lea L110, L84
+bne *r7
+L162: .string "awcelolxnxhukxxnereyrfh"
+L163: inc *r7
+L164: cmp *r2, L146
+inc *r4
+clr L12
+L165: jmp L131
+inc *r6
+L166: jmp L64
+sub L12, r1
+inc r0
+L167: add #106, L81
+jsr *r6
+bne *r6
+rts
+L168: .string "onbzocigjvtpusgqho"
+; comment
+L169: .data -584, 564, -251, 393, -159, 460, -353
+bne *r2
+lea L118, *r3
+inc L81
+jmp *r5
+mov #240, *r2
+L170: jmp L148
+red r3
+L171: mov #-206, r1
+L172: prn *r6
+stop
+L173: not *r6
+jsr L91
+clr L16
+cmp #165, *r7
+dec L109
+not *r7
+jsr L8
+clr *r3
+L174: sub L135, *r1
+cmp r2, L40
+stop
+sub r4, *r5
+red *r3
+sub *r7, L29
+stop
+jsr *r2
+inc L152
+L175: jsr L143
+lea L174, r4
+rts
+L176: inc *r1
+red L48
+jmp L163
+L177: inc *r0
+add *r5, L56
+jsr *r7
+lea L98, *r5
+L178: .data 360, 345
+L179: mov #119, *r0
+cmp *r2, *r4
+L180: .string "ksoxcpjldabinpgndbgol"
+L181: mov L110, *r7
+cmp #74, L174
+L182: bne *r3
+L183: jmp L106
+L184: clr L95
+prn r1
+inc L51
+L185: .data -513, -487, 599, -58, -734, -872, -931, 433
+red L1
+L186: prn *r7
+red *r7
+jmp L108
+stop
+cmp *r2, L16
+L187: rts
+bne *r6
+dec *r0
+dec *r5
+rts
+rts
+jsr *r1
+jsr L95
+jsr *r6
+stop
+; comment
+jmp *r0
+L188: sub #-179, r7
+dec *r4
+not r2
+rts
+inc *r3
+inc r5
+
+L189: jmp *r1
+L190: stop
+L191: .string "zudufllf"
+cmp #73, L167
+clr L138
+L192: stop
+L193: .data -126, -445, -57, -922, -770
+L194: lea L2, *r0
+L195: mov L48, L168
+
+jmp *r1
+L196: .string "vjjgtuzaeatfhwzie"
+L197: stop
+jsr *r1
+dec r1
+bne *r5
+L198: lea L83, L124
+; comment
+jsr L166
+L199: .string "a"
+jsr L18
+
+L200: not *r7
+jsr L42
+clr L149
+L201: lea L70, r2
+L202: prn #56
+inc r4
+L203: .data -394, 790, 737, 934, 886, 237
+L204: prn #-17
+red r4
+add *r1, *r3
+L205: inc *r1
+L206: dec r5
+prn r5
+jmp *r6
+L207: .string "fddbranhviruglhnt"
+L208: .data 328, -641, 308, -286, 685
+L209: add L10, L88
+L210: stop
+
+not *r3
+sub r6, r3
+jsr L84
+stop
+L211: sub *r7, r2
+L212: bne L128
+stop
+L213: .string "arhlpsfcudaj"
+L214: lea L75, r4
+
+L215: prn #-219
+L216: prn #130
+bne *r0
+bne L112
+add *r4, L194
+L217: dec L152
+L218: jmp L62
+bne *r5
+bne L191
+rts
+add #133, *r5
+cmp #-123, L100
+L219: .string "pwrhpecjxpvjak"
+L220: prn #-218
+mov #-197, L69
+not *r0
+prn *r2
+bne *r3
+inc *r6
+inc *r7
+; comment
+dec L141
+L221: add #165, L93
+L222: clr r7
+L223: inc L6
+L224: jsr L139
+not L96
+cmp r0, #195
+red *r0
+L225: rts
+L226: dec r6
+clr L124
+sub *r1, *r5
+add *r3, r7
+jmp L66
+sub r1, *r3
+inc r6
+L227: prn r1
+L228: cmp *r0, r2
+L229: red r2
+L230: jsr *r0
+cmp #189, L84
+; comment
+L231: .data 390, 481, 166, -463, -470
+lea L165, r3
+L232: .string "kx"
+not *r6
+lea L229, L4
+lea L175, L129
+inc L90
+
+jmp *r6
+L233: mov r0, r6
+rts
+L234: prn #-217
+lea L134, r3
+not r4
+L235: .string "sqyaelukbfgflu"
+L236: cmp #93, *r1
+L237: stop
+jmp *r0
+L238: .data 774, -126, -384
+L239: mov L230, r3
+L240: add L74, r4
+cmp #122, *r4
+jsr *r0
+rts
+prn *r4
+add *r3, r6
+clr *r2
+jmp L110
+add *r6, L133
+bne L110
+jmp *r7
+bne L13
+dec *r1
+inc *r7
+; comment
+bne *r4
+L241: bne *r4
+inc *r2
+clr r0
+stop
+jmp *r7
+rts
+cmp #-125, #0
+bne L194
+; comment
+cmp *r6, r0
+L242: not r0
+L243: .string "ldzolahwisndhrsmauwng"
+jmp L225
+L244: .string "jcrrmoululu"
+L245: add #-55, r4
+red *r1
+sub #239, *r3
+dec L42
+lea L160, *r6
+stop
+L246: clr *r4
+not *r0
+inc L136
+stop
+L247: .data -226, -499, -192, 433, -948, 674, -93
+dec r3
+L248: lea L103, L197
+clr r3
+L249: lea L120, *r2
+jmp L188
+L250: .string "nvdzbhgqbyerhgtlm"
+L251: inc *r4
+L252: jsr *r4
+L253: .string "xwvmbbatzvgspeehvvrgzh"
+lea L158, L198
+L254: inc *r7
+cmp #169, *r1
+sub L150, r2
+lea L94, *r3
+clr L85
+lea L248, r5
+bne L172
+rts
+inc L224
+
+L255: jsr *r6
+L256: add L86, L26
+L257: .data -572, -959, 873, 570, -644, 946, -170
+dec *r4
+L258: .string "eejoglllzwwejoaejbcbf"
+not L174
+rts
+add #198, L37
+L259: mov #106, *r6
+prn *r1
+L260: .string "cjeyzekxawgqehejcpjzn"
+L261: rts
+lea L178, r6
+L262: clr r3
+jsr *r4
+L263: .string "igiensfygyufnjsnzg"
+bne L215
+L264: .string "fsxevpbosalfzzwmslbyna"
+L265: bne L164
+dec *r1
+L266: lea L260, r0
+not L96
+L267: mov *r7, *r6
+L268: cmp r4, r3
+L269: .data 248, 116, -388, 694, -18, 815, -319, 627
+L270: .string "jomrdpkrkjqmlgefnurjtlf"
+jmp L153
+L271: bne L146
+L272: jsr *r4
+L273: lea L240, r3
+cmp L188, *r0
+lea L136, *r7
+
+stop
+prn r3
+L274: mov r2, r3
+cmp #107, *r2
+not L250
+L275: add L257, L126
+stop
+not L18
+mov #-149, L132
+sub r6, *r1
+not *r6
+
+sub *r3, *r0
+prn *r1
+red *r7
+jmp *r6
+L276: inc *r3
+bne L49
+cmp *r4, L201
+jsr *r4
+jmp L143
+mov #148, r0
+L277: .data -378, -649
+L278: inc *r2
+not *r3
+jsr *r6
+L279: .data 504, 249, -953
+add r1, *r5
+L280: add L6, *r5
+L281: lea L59, r0
+add L130, *r1
+not L201
+L282: inc L38
+L283: dec L168
+bne L4
+L284: .string "upkucrwawa"
+L285: cmp *r7, r7
+L286: .string "qqctrzmnrhqbhtov"
+rts
+L287: .data 152, 451, -136, 118, 226, -85, -247, 603
+L288: .data 344, -564
+add *r0, L188
+prn *r6
+L289: rts
+L290: dec L219
+L291: jmp *r0
+jsr *r1
+L292: add r0, r7
+jsr *r7
+
+not *r4
+bne L208
+dec r1
+not L289
+; comment
+jmp *r5
+L293: red *r0
+L294: stop
+sub L18, L263
+jsr L208
+stop
+red r4
+bne L223
+L295: .data 201, 820, 892
+L296: add r5, L1
+clr *r5
+L297: bne L116
+L298: inc L193
+L299: lea L64, *r7
+not r1
+L300: .string "of"
+sub *r0, *r6
+jmp L212
+red *r1
+cmp r5, L34
+dec r7
+L301: lea L179, r5
+L302: .data -804, -802, -240, 789, -162, 871, 343, -810
+
+L303: sub L287, r6
+bne *r3
+jsr L85
+lea L58, L53
+sub *r7, *r4
+L304: .data 404
+L305: stop
+L306: jsr L6
+L307: cmp r6, *r6
+jmp *r7
+not L151
+L308: .data -469, -555, -39, 111, 3, 842, 924
+dec *r7
+L309: red r0
+lea L202, *r5
+L310: stop
+L311: inc r6
+jsr L147
+clr r5
+
+jsr *r0
+add L36, *r7
+; comment
+rts
+L312: bne L157
+L313: jmp L129
+mov L18, r7
+L314: rts
+L315: not *r4
+dec r4
+L316: bne *r0
+inc *r5
+dec L226
+prn L311
+cmp *r0, L40
+L317: jmp *r4
+L318: .string "ivs"
+rts
+L319: cmp r7, r0
+bne *r4
+stop
+
+rts
+L320: .data -971, -738, 605
+L321: sub #29, L93
+lea L311, L96
+add *r1, L135
+lea L85, r1
+inc L17
+inc r6
+prn #181
+L322: prn #89
+L323: rts
+cmp #169, r0
+L324: add L37, *r7
+not *r7
+; comment
+L325: mov *r3, L107
+L326: .data 430, -534, 183, 814, -551, -216, 657
+clr L266
+add #-234, r1
+clr r5
+mov #231, L262
+prn r7
+cmp #206, *r7
+L327: cmp #-173, #-11
+L328: not L98
+inc L21
+L329: add #11, *r5
+jmp *r2
+L330: prn r6
+dec *r7
+; comment
+L331: prn L107
+L332: .string "zvwfvh"
+lea L45, *r6
+L333: .data -22, 899, 814, -446, 249, -711, -252
+L334: not L234
+dec r5
+L335: rts
+L336: cmp r5, L141
+L337: clr *r7
+stop
+jmp *r2
+L338: inc r5
+L339: rts
+sub L259, r4
+add #31, r2
+not r2
+jsr L64
+
+
+jsr *r0
+jsr *r1
+stop
+add r3, r1
+jmp *r4
+red *r7
+dec *r7
+; comment
+jmp *r0
+clr *r4
+add #163, *r5
+L340: .string "mgnu"
+L341: cmp *r1, #17
+bne L322
+add *r2, L312
+sub r1, r3
+L342: .data -206, 81, 713, 672, 692
+jmp L179
+L343: jmp L208
+add L30, L261
+sub L220, r3
+prn #20
+L344: .data -889, -159, 389, 811, 901, -11, 253, 321
+clr *r6
+
+L345: inc L209
+red L185
+L346: jsr *r3
+L347: not r6
+L348: prn L20
+L349: bne L35
+L350: sub r0, r6
+inc L318
+L351: mov r1, L181
+L352: not *r5
+red L15
+jsr *r6
+not *r6
+L353: sub #177, *r1
+L354: red r3
+rts
+add *r5, *r0
+jsr *r1
+L355: .data -924, 405, -954, -839, -991
+jsr *r6
+prn L128
+L356: inc r1
+L357: jmp L242
+L358: prn *r4
+L359: not r3
+L360: prn #-226
+prn L65
+stop
+L361: .string "msgfcqtahzagmqybhpuiz"
+sub #106, *r5
+sub r5, r5
+lea L147, *r2
+stop
+inc *r4
+prn r2
+lea L147, *r0
+L362: lea L47, *r7
+L363: red *r3
+L364: red L29
+; comment
+L365: sub *r6, r4
+jsr *r2
+cmp *r6, #231
+bne L204
+clr r2
+jsr L111
+not *r5
+L366: jsr L306
+L367: .data 373, -148, -87, 385, -539
+not L74
+not r7
+dec r1
+inc L253
+cmp L341, *r5
+red *r3
+jmp *r2
+jmp L43
+mov r6, L352
+jsr L143
+inc r1
+not L210
+L368: mov *r5, r1
+red *r4
+rts
+L369: .string "ngvwbiku"
+L370: jmp L18
+sub L220, L98
+jmp *r7
+sub *r3, L171
+red *r6
+jsr L249
+dec *r0
+add L277, *r4
+cmp #-49, #-155
+dec *r4
+not *r7
+cmp r0, L218
+sub #-77, L114
+stop
@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 52
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+bne *r2
+L0: stop
+cmp *r4, *r3
+lea L0, r4
+L1: .data 563, 919, -306, 906, -230, 133, -719
+cmp *r6, #106
+cmp L1, *r2
+lea L1, *r3
+add L0, r3
+L2: sub L1, L0
+clr L1
+L3: rts
+L4: lea L0, r3
+jmp *r6
+inc L4
+jsr L3
+mov r4, r0
+L5: cmp L4, L1
+sub #-97, L4
+clr r3
+inc L5
+L6: mov r7, r1
+prn #182
+
+add r1, L1
+L7: .string "tmasvqthqoubbzz"
+L8: jsr L1
+add L1, L3
+L9: cmp r2, *r3
+dec r1
+cmp L8, #228
+; comment
+dec *r3
+jsr *r7
+L10: stop
+L11: add *r5, L1
+clr r5
+clr *r2
+clr *r3
+sub *r1, L6
+L12: not L10
+not r6
+; comment
+lea L7, *r0
+L13: .data 779, 458
+L14: .string "sspkjivyekaet"
+L15: .data -974, -492, -178, 621, -205, -163, -400
+L16: stop
+jmp *r2
+L17: bne *r6
+jmp *r7
+L18: .data -899, 478, 682, 373, -338, -507, 352
+L19: .data 180, -860, -246, -981, 792, -159, -876
+red r1
+L20: clr L11
+L21: bne *r7
+dec L18
+L22: mov r7, L18
+mov *r2, r3
+bne *r7
+rts
+jmp L22
+bne *r1
+L23: bne L2
+L24: .string "sqklhcfmujjv"
+jmp L24
+dec r0
+L25: not r1
+rts
+L26: .data -812, 652, 238
+inc r0
+L27: lea L5, r6
+rts
+L28: prn #187
+stop
+stop
+L29: .string "dakalqlcpqufsbtttfyfnpv"
+
+L30: red L12
+stop
+sub *r3, *r4
+L31: jmp L29
+L32: prn #77
+clr L29
+L33: .data 772, -878, 150, 409, 732, 860, 210, -747
+add L32, L10
+; comment
+cmp L5, L11
+inc *r2
+dec L3
+L34: jsr *r0
+L35: .data -722, 46
+inc r3
+add #233, *r2
+stop
+L36: jmp L34
+lea L13, r4
+red L8
+L37: bne L15
+L38: lea L3, r1
+dec r6
+red L22
+add *r6, r7
+lea L9, *r4
+L39: jmp *r6
+inc *r0
+jmp L36
+L40: add r4, r7
+bne L26
+bne L20
+inc *r0
+
+L41: add *r5, *r7
+L42: sub *r0, L12
+stop
+lea L7, *r2
+L43: lea L5, L14
+sub r6, r1
+L44: clr *r2
+stop
+red r6
+red r2
+lea L30, r0
+L45: .data 795, -825, 923, -738, -720, 947, -362
+clr *r1
+add r0, r0
+rts
+dec r6
+rts
+inc L39
+prn r3
+L46: add #149, L33
+add #-52, *r7
+lea L46, *r3
+bne L9
+dec L45
+L47: not r6
+red L31
+cmp #-180, L15
+inc r0
+jmp L8
+
+dec *r1
+stop
+L48: .string "nrlnwqtaenryarkunlbg"
+cmp #6, *r0
+jmp L40
+prn L24
+L49: inc *r1
+; comment
+lea L47, r3
+L50: add *r4, *r5
+L51: inc r0
+L52: cmp L22, #137
+L53: .string "cciurdrtoqcerektd"
+L54: .string "gconysfpuvmslh"
+inc L24
+dec L16
+; comment
+
+inc r1
+inc L13
+L55: inc L8
+add r2, *r6
+jmp *r2
+L56: inc *r6
+L57: cmp #19, #103
+jmp L11
+L58: add *r4, L12
+jmp *r6
+clr r1
+L59: jsr L14
+lea L29, L59
+L60: red *r5
+L61: inc *r5
+cmp r4, #4
+lea L60, r4
+prn L30
+L62: jsr *r1
+L63: lea L21, L48
+sub L7, *r4
+jmp L52
+L64: jmp L47
+L65: prn r4
+bne *r5
+L66: red r1
+jsr L48
+jsr *r3
+L67: clr *r5
+bne L25
+add r1, L44
+L68: cmp L10, L6
+L69: stop
+L70: .data -103, -5, -364, -531
+clr L34
+
+prn r0
+prn *r7
+clr *r3
+clr *r3
+L71: rts
+L72: dec *r0
+L73: rts
+red L53
+L74: clr *r1
+lea L50, *r5
+L75: cmp *r3, #-109
+L76: dec L43
+stop
+inc r3
+bne L49
+L77: inc r5
+sub *r6, r7
+dec L64
+cmp *r1, L8
+
+red *r2
+clr *r0
+inc *r1
+cmp *r7, L71
+L78: not L5
+stop
+add *r4, L65
+bne *r3
+jsr *r7
+rts
+L79: mov #-200, *r7
+cmp r4, L18
+L80: clr r6
+jsr L42
+L81: .data 700, 14
+red L63
+jmp L39
+cmp #-24, r3
+jsr L35
+red L74
+bne L26
+bne L26
+L82: cmp #87, *r3
+red L12
+not r1
+L83: .data 238, 247, -816, -719
+add r3, r3
+rts
+jsr L37
+bne *r4
+bne L56
+clr *r2
+red *r7
+L84: lea L46, *r2
+rts
+cmp r0, L52
+L85: inc L11
+cmp #107, r5
+L86: clr r3
+
+jsr L77
+bne L83
+L87: .string "qxqpvtlmdvecn"
+lea L67, r0
+L88: .string "jhhsujokqls"
+L89: add r5, r3
+mov L80, r3
+jmp *r5
+red *r7
+sub #47, L24
+L90: jmp *r4
+L91: .string "dbtvqgcjitdbiatmxu"
+L92: rts
+rts
+sub *r2, L32
+clr r4
+L93: .string "gcvzv"
+L94: stop
+mov #-88, r6
+jsr *r2
+; comment
+mov r3, L59
+jmp L21
+mov *r3, *r2
+L95: sub #110, L54
+L96: stop
+prn L77
+jmp L43
+L97: .data 345, 825, 320, -801, 72, 622, 807, -366
+stop
+stop
+lea L16, *r2
+L98: cmp *r7, L34
+add *r5, L50
+; comment
+L99: not *r1
+L100: clr r1
+jsr L17
+red L84
+jmp *r0
+L101: add L101, r1
+L102: .string "ddpdmdbladuuejmg"
+sub #-72, L42
+L103: red r6
+
+jsr *r0
+bne *r5
+jsr L13
+prn #-50
+L104: prn L39
+inc r1
+add *r2, *r1
+cmp #148, r7
+not r7
+L105: red r0
+L106: .string "xvmygccsgznxqsc"
+clr L52
+lea L3, *r5
+L107: .string "jwokorylmryevv"
+rts
+prn #123
+L108: .data 721, -240, 547, -993, 837, 152
+not *r4
+stop
+; comment
+add r6, L76
+L109: mov #158, L109
+add L82, r6
+mov *r7, *r3
+jmp *r6
+mov *r2, *r5
+prn #123
+add r7, L5
+mov *r3, r1
+dec *r0
+dec *r3
+
+L110: rts
+L111: mov r4, *r3
+L112: mov #89, *r5
+lea L47, L33
+L113: rts
+cmp *r0, #-152
+red *r2
+L114: lea L0, *r1
+clr r4
+jsr *r4
+cmp *r2, r7
+L115: dec *r1
+L116: add *r4, L34
+bne L65
+jmp *r4
+stop
+; comment
+dec r2
+stop
+lea L101, *r6
+rts
+L117: .string "ungikvlioz"
+L118: cmp #-120, #198
+L119: .data -75, -73, -423
+stop
+L120: .data 152, -709, 904, 659, 377, -696, 702, 200
+L121: not *r3
+L122: prn #47
+add #-208, L17
+dec L20
+L123: inc r0
+bne *r2
+; comment
+rts
+L124: add *r1, r6
+prn #248
+add *r4, r5
+L125: add r3, L17
+stop
+L126: cmp L97, #6
+L127: cmp *r1, r3
+L128: red *r2
+L129: red r1
+L130: lea L95, *r0
+prn L101
+dec *r5
+red *r1
+L131: prn L86
+rts
+red *r5
+prn *r3
+inc r7
+L132: .data 223, -265, -269, -451, 792, 564, -334
+
+L133: .data -363, 924, 512, -108
+L134: dec *r5
+not r1
+L135: jsr *r7
+L136: jsr *r6
+clr *r5
+L137: .data -654, -395, 773, -557, 310, 949, 222
+L138: dec r1
+mov *r3, *r4
+L139: .string "p"
+
+L140: inc *r3
+jsr *r1
+red *r5
+lea L104, *r6
+bne *r7
+L141: bne *r5
+stop
+L142: add *r4, r1
+lea L66, *r2
+rts
+clr L29
+L143: prn *r6
+inc *r4
+
+
+
+dec L143
+L144: mov #-159, r6
+lea L57, L60
+cmp *r1, r7
+L145: .data -133, 952, -441, -519, 757
+prn r2
+red L124
+jsr L17
+stop
+dec r2
+inc L49
+inc r5
+L146: .string "qd"
+L147: sub *r3, L116
+not r3
+L148: inc L137
+bne *r4
+inc *r7
+; comment
+L149: .string "pkcvynrggeofjcwwykjo"
+L150: prn L98
+L151: jmp *r5
+; comment
+L152: .data -777, 431, -234
+add #-135, *r3
+dec L49
+jsr L92
+cmp *r3, #-243
+red L54
+L153: .data 45
+L154: mov r6, L105
+L155: jsr *r7
+inc r3
+stop
+stop
+red L68
+jmp *r5
+; comment
+lea L143, L43
+red L147
+mov r3, *r5
+L156: prn #-69
+L157: sub L75, *r7
+L158: inc L10
+
+L159: not r3
+inc *r5
+L160: .string "skdnph"
+L161: red L80
+
+jsr L101
+add r6, r0
+L162: jsr *r7
+L163: jmp *r7
+sub *r7, r7
+L164: .string "sswuzhf"
+inc L142
+clr *r6
+inc r4
+L165: rts
+dec *r5
+sub r6, r0
+dec L30
+jsr *r5
+L166: bne L77
+lea L73, *r1
+L167: jsr *r3
+red *r0
+dec r4
+prn *r1
+L168: .data -896, -311, 168, -953, 798, 997, 620
+L169: clr L141
+
+L170: jmp *r3
+
+L171: rts
+L172: sub L103, L105
+L173: .string "ytxywqxcnorinixhgb"
+L174: cmp r3, *r7
+L175: .data 256, -331, 246, 847, 844, 515
+inc *r3
+jsr *r4
+cmp L71, L89
+inc *r1
+clr L29
+L176: .string "dpmvavauvdgnl"
+add #-77, r2
+L177: stop
+L178: bne *r5
+L179: bne L120
+L180: not *r1
+inc r5
+not r3
+jsr *r2
+
+L181: .data -35, 36
+L182: dec r4
+bne L111
+red r5
+jsr *r2
+rts
+L183: .string "kf"
+sub L23, *r3
+jmp L135
+L184: .data -602, 203, -230, 293
+jmp *r7
+sub r3, r5
+L185: sub *r7, r2
+L186: rts
+jsr *r7
+L187: jmp *r3
+; comment
+
+dec r4
+L188: lea L128, r5
+L189: .data 768, 302, -869, 807, -745, 734, 502
+jsr *r7
+L190: cmp #-96, #-69
+L191: .data -397, 430, 969, 23
+clr L104
+not *r1
+add L150, *r1
+L192: rts
+L193: lea L138, *r1
+dec r2
+jmp L102
+stop
+dec r1
+clr L107
+L194: jmp *r1
+lea L110, L174
+cmp *r6, #-137
+jmp *r5
+L195: not r7
+jmp L50
+rts
+L196: .data 976, -171, 209, 422, 96
+dec *r0
+rts
+sub *r6, L163
+jmp L127
+L197: jsr L41
+L198: .data -791, -477, 394, -489, -875, -510, -56, -188
+lea L49, r4
+mov r4, L108
+rts
+L199: .string "aidzuywvepweuslfviamiuuj"
+L200: jsr L180
+L201: jsr L93
+jmp *r3
+rts
+
+mov r6, r4
+rts
+L202: .string "frylafl"
+add #-238, r0
+lea L155, *r7
+L203: .data -992, -634
+prn *r0
+L204: sub r1, r0
+L205: .data -420, 231, 979
+L206: stop
+bne *r0
+L207: cmp #-249, L61
+add r0, r5
+rts
+inc *r2
+not r7
+jsr L164
+L208: add #197, r3
+L209: .string "fzffvsngawslasb"
+prn #-132
+dec L37
+add r3, r0
+rts
+L210: .string "qfogebcxcu"
+; comment
+L211: bne L91
+sub r0, L205
+sub r3, *r5
+L212: red r1
+inc *r7
+L213: .string "fmlfcnjjg"
+prn *r6
+sub r3, r5
+inc r5
+bne *r4
+add L68, *r0
+L214: jsr L17
+
+L215: clr L105
+not r3
+jmp L46
+L216: .data 606
+rts
+cmp *r1, r1
+L217: not r2
+jmp L120
+add *r5, *r4
+L218: not L147
+red r1
+jsr L118
+bne L53
+mov *r5, L4
+stop
+prn r2
+red r1
+prn #1
+jsr L203
+jmp *r1
+red *r5
+L219: .data -400, -232, -148
+not r4
+L220: jmp L212
+cmp #-25, *r4
+L221: stop
+red L184
+add #198, L217
+sub r4, L94
+red r3
+jmp L61
+L222: inc *r0
+lea L39, L195
+L223: prn *r2
+red *r5
+L224: rts
+add L34, L153
+bne L147
+inc *r0
+lea L217, *r1
+L225: stop
+inc r7
+L226: .data 135, 647, -101
+clr *r4
+inc r2
+L227: add r2, *r5
+add L60, *r4
+mov r2, r6
+jsr *r4
+L228: bne L16
+rts
+L229: .data -787, 262, -659, 882, -7, 893, 535, 965
+L230: jsr L0
+L231: stop
+L232: .string "iodwrudunzisefscbfbpnjr"
+red *r6
+; comment
+lea L86, L15
+inc *r5
+red L196
+L233: .string "pgzwqnuyxkwsqsieszpmgd"
+stop
+jmp *r0
+clr *r7
+
+L234: add L105, r4
+L235: inc L140
+not r5
+stop
+sub L139, L15
+jsr *r4
+L236: bne L182
+sub *r3, r6
+L237: inc r5
+L238: red L37
+inc *r7
+; comment
+lea L136, *r0
+bne *r3
+L239: .string "czydwmmesyervr"
+not L95
+prn L76
+rts
+L240: clr L94
+red L224
+L241: jsr *r2
+sub r4, L179
+L242: sub r1, r7
+; comment
+L243: bne *r4
+mov *r3, L21
+L244: jmp L179
+rts
+rts
+clr r7
+; comment
+
+stop
+bne L238
+L245: .string "pqbiexzxgnphtmdq"
+L246: prn L26
+L247: clr *r5
+red *r2
+inc *r2
+rts
+jmp L52
+lea L43, *r5
+inc *r6
+L248: .data 719, 733, 869, -65, -877
+; comment
+cmp L14, #53
+jsr *r5
+jsr L80
+jmp *r6
+L249: lea L107, *r7
+clr r0
+L250: clr L5
+bne L24
+
+bne L150
+dec L73
+L251: jmp *r5
+stop
+L252: stop
+lea L142, *r4
+bne L235
+stop
+lea L92, r6
+inc *r1
+add #-52, *r3
+; comment
+; comment
+mov L201, L187
+L253: bne *r6
+; comment
+rts
+jsr L212
+L254: red r3
+L255: not r5
+L256: rts
+mov *r1, L52
+mov #-130, L170
+L257: add *r1, r7
+bne *r0
+
+not *r6
+not r1
+lea L170, L248
+L258: stop
+L259: cmp r5, L72
+red r0
+lea L78, *r4
+L260: jsr L189
+L261: .data -108, 716
+L262: inc r5
+jmp L208
+stop
+L263: not *r7
+clr *r4
+bne L20
+L264: .string "lwpqkxuo"
+jsr L123
+red L71
+jsr *r0
+lea L31, r0
+L265: rts
+L266: rts
+not r6
+stop
+L267: inc *r2
+jsr L257
+L268: stop
+L269: jsr *r3
+not L266
+lea L21, r1
+inc r7
+not L253
+mov r4, *r2
+L270: not *r4
+prn *r2
+L271: mov r6, *r7
+lea L121, L198
+L272: dec r7
+lea L34, *r6
+inc r3
+L273: lea L144, *r3
+prn L40
+L274: .string "bwi"
+cmp L250, L95
+add L229, *r5
+L275: .data 333, -960, -375
+dec *r6
+jsr L26
+L276: red *r1
+L277: sub *r3, r6
+not *r4
+sub L36, L22
+
+add L82, r2
+L278: add L153, L4
+rts
+red L76
+; comment
+L279: mov #-155, r6
+L280: mov L208, *r3
+sub #213, r2
+jsr L115
+jmp L82
+rts
+L281: .string "gipodgsfqbgavsca"
+L282: dec *r4
+jmp *r1
+not L57
+add L237, r3
+mov *r1, *r6
+L283: stop
+L284: red r1
+clr r6
+L285: lea L65, *r5
+dec r7
+L286: prn L25
+L287: .data -584, -126, 149, -587
+jsr L255
+dec r7
+L288: not r5
+L289: sub L271, r3
+L290: sub r3, L22
+clr *r2
+dec *r0
+clr r1
+red *r0
+L291: dec r0
+clr r3
+L292: stop
+L293: not *r4
+bne *r5
+dec *r2
+mov r5, r3
+L294: .string "qtmojtqwkfakccxlb"
+L295: red r1
+red r3
+not r3
+L296: .string "drjesc"
+L297: red *r6
+bne L143
+L298: .string "ghqbgnkgyztfmiprhdiognam"
+L299: .data -147
+L300: add #-79, *r1
+L301: stop
+jmp L290
+L302: rts
+clr r2
+red *r3
+sub #167, *r0
+L303: inc L71
+dec *r3
+L304: .data 774
+jsr L210
+L305: jsr *r4
+add #-190, r7
+L306: .data -692, -815, -466, 1
+L307: mov L209, *r2
+not r4
+clr L42
+L308: not L158
+L309: sub r0, L216
+L310: red *r2
+; comment
+lea L119, r4
+L311: .data -514, -30, -259
+L312: sub r1, r6
+L313: jsr *r0
+L314: jmp *r6
+prn #-205
+L315: not r7
+L316: .data -686, 732, -172, 218, 474, 90, 437
+inc L290
+bne L21
+bne L298
+rts
+add *r1, *r2
+L317: .data 732, 841, 170, -832
+inc r5
+clr L40
+red r5
+L318: .string "jzzixp"
+L319: cmp #202, L39
+sub L266, *r0
+L320: rts
+L321: sub *r4, r0
+inc r1
+L322: clr L269
+
+L323: .data -628, 949, -667, 784, 886, 1
+jsr L296
+
+L324: prn r1
+mov *r6, L78
+L325: jsr L133
+sub L28, r7
+L326: cmp L77, #-35
+jsr L221
+dec L70
+mov r5, r1
+L327: .string "mapgcsdeygaguvrckokqneh"
+add *r7, r7
+rts
+inc *r1
+; comment
+not L317
+; comment
+jmp *r6
+L328: bne *r7
+L329: dec *r4
+red *r1
+not L306
+clr r2
+clr *r0
+lea L14, *r4
+rts
+; comment
+clr L18
+bne *r4
+L330: jsr *r0
+red L157
+mov L137, *r7
+L331: .data 38, 311, 861
+L332: not L151
+prn r3
+L333: red L282
+L334: lea L294, r0
+inc L138
+prn #176
+dec L197
+cmp #-115, r7
+
+lea L136, L215
+L335: stop
+add r2, *r1
+
+inc L184
+L336: dec L34
+cmp r5, r6
+inc r5
+bne L28
+L337: stop
+L338: rts
+L339: not r3
+L340: lea L211, r4
+cmp *r5, *r7
+bne L77
+sub r1, L212
+lea L151, *r5
+L341: .data 665, 12, -239, 593, -905
+L342: .data 206, -326, -928, 284, 505, 840, 580, 495
+dec L4
+clr r3
+mov *r5, *r7
+L343: jmp *r5
+clr r1
+L344: .data 971, 290, -495
+clr L261
+prn *r2
+jmp *r4
+L345: jmp *r5
+L346: lea L249, L153
+L347: rts
+L348: lea L179, L82
+bne *r5
+jsr *r5
+stop
+L349: .data -294, 17, -833, 415
+jsr *r3
+clr *r5
+jmp *r0
+stop
+L350: .data -58, 683
+stop
+not *r0
+sub *r6, *r2
+L351: stop
+mov L297, r2
+lea L306, r7
+L352: .data -261, 540, 399, -643
+L353: dec L274
+L354: jmp *r5
+L355: mov *r0, L18
+L356: jsr L244
+add L294, r2
+not L140
+L357: clr L150
+
+lea L339, *r7
+L358: mov *r7, r7
+sub L72, r1
+red r4
+stop
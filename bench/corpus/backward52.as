@@ -0,0 +1,1026 @@
+; Generated by genCorpus --seed 53
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+; comment
+dec r3
+L0: red L0
+mov #-150, *r3
+L1: stop
+L2: stop
+lea L0, *r4
+jmp *r4
+L3: add L1, L1
+not r3
+bne L0
+cmp L0, *r5
+L4: .string "wdkovxaspis"
+not L2
+jmp *r6
+L5: red r7
+L6: jmp L4
+dec L5
+L7: inc *r3
+stop
+L8: .data -388, -487
+rts
+L9: lea L9, r5
+L10: clr r4
+L11: dec L5
+dec r2
+dec L8
+L12: .string "hbdunqg"
+L13: lea L11, *r7
+L14: mov r5, *r0
+jsr *r2
+jsr L0
+L15: .string "pxtc"
+L16: bne *r1
+L17: bne *r0
+L18: dec *r6
+L19: .data 699, 470, 560, 859, -484, -131, 805
+L20: .string "achpqcveo"
+prn L3
+L21: lea L16, L17
+inc L4
+L22: .data -35, -630, 23, -147, -282
+L23: .string "ztd"
+bne L2
+add L10, L9
+sub *r7, L6
+jmp *r3
+L24: sub r7, *r0
+red *r3
+dec L7
+inc *r7
+prn r2
+clr L23
+jsr *r0
+L25: .data -700, 606, -245, 887, 275
+clr r7
+L26: .data -837, 491, -579
+rts
+L27: clr L20
+stop
+sub r1, L0
+red *r5
+rts
+clr r5
+
+L28: cmp *r2, r1
+add *r6, r4
+mov *r4, r0
+add r3, r4
+sub L0, r2
+jsr *r4
+L29: .data -202
+L30: jmp *r7
+L31: .data 277, 444, 917, -689, 988, 562, -151, -365
+L32: bne L20
+jmp L25
+L33: cmp #-77, r1
+L34: mov L33, L34
+clr r2
+cmp *r6, *r7
+stop
+L35: bne L2
+inc r1
+stop
+stop
+L36: .data -960, -228, -256, -991
+jmp L36
+cmp L22, L8
+dec *r1
+red L2
+L37: .data -880, 220, 173, 269, -530, 848, -636
+add r7, r6
+L38: clr L27
+mov *r2, r5
+L39: rts
+L40: inc r6
+L41: rts
+L42: .data -425, 719, -94, -183, -366, 475, -85, 870
+bne *r0
+L43: .data 995, -809, -32, 993, -781, 439, 763
+cmp #-53, *r5
+stop
+lea L14, L38
+not L30
+stop
+add #223, L40
+clr *r2
+not *r3
+rts
+bne L29
+sub *r3, L14
+
+L44: .string "vvmtwrrh"
+L45: .data -858
+L46: add L32, L19
+L47: lea L33, r1
+stop
+L48: prn L13
+jsr L16
+bne *r7
+stop
+L49: .string "xquyakswwjprioqbtil"
+
+bne L49
+lea L33, L20
+L50: jsr *r0
+clr r2
+jmp L28
+; comment
+bne L46
+prn #148
+L51: stop
+L52: jsr L27
+L53: mov #-186, L12
+
+bne *r0
+bne L42
+red r1
+rts
+L54: rts
+L55: rts
+L56: bne L41
+L57: prn L13
+L58: sub r2, r2
+inc *r7
+L59: mov L10, r0
+
+L60: .data 136, 999, -550, -312, -480, -398
+L61: dec *r6
+clr *r4
+jmp *r3
+L62: .string "bmwuchyqayspzmlhbxqjsz"
+red *r1
+cmp L16, L18
+lea L58, *r1
+dec *r7
+L63: lea L19, L49
+jmp *r0
+cmp L61, *r6
+L64: bne L37
+rts
+jmp *r2
+dec r6
+clr r3
+L65: clr r6
+mov r5, L37
+L66: .data 364, 234, 41, -201, -589, -321, -304, 930
+sub *r1, r1
+rts
+cmp r3, #-69
+L67: lea L51, r7
+add r1, L55
+inc *r2
+L68: not r3
+L69: stop
+L70: mov #250, L29
+L71: .data 728, -108, -636, 482
+jmp *r4
+L72: .string "lphhfkdlpkxskerolomonqru"
+clr r2
+prn L70
+red r0
+red *r0
+dec L61
+L73: add L15, r3
+L74: prn #-67
+L75: jsr L55
+L76: rts
+mov *r5, L68
+L77: mov #-4, L40
+lea L54, *r3
+cmp L54, *r2
+L78: not *r3
+L79: .data -372, 898
+L80: .string "gpxcgxcgqzzinclr"
+sub *r7, *r1
+bne L64
+L81: .string "i"
+L82: .data 794, -639, -544, 323, -376, -236, -83, 794
+L83: inc r4
+lea L49, r3
+L84: .data -917, 193, -949, -502, -638
+L85: .string "fpesllzsvyngnfty"
+L86: stop
+prn r7
+clr r0
+dec L76
+not L46
+L87: .string "tngxdzldmere"
+L88: prn #-213
+mov #-63, *r5
+
+L89: stop
+add L62, r1
+L90: cmp r5, L78
+L91: not *r3
+L92: jmp *r7
+inc L64
+stop
+dec r1
+stop
+jsr L9
+dec r1
+add L85, *r4
+jmp *r1
+lea L63, r4
+L93: .data -80, -930, -13, 651, 856, -156, 317
+inc r0
+mov *r4, r0
+rts
+mov *r5, r6
+dec L50
+lea L0, *r6
+lea L59, r0
+not *r2
+L94: clr r7
+L95: inc *r4
+add *r7, *r2
+sub #-235, r5
+L96: red L52
+add *r6, r3
+L97: cmp *r6, *r3
+not L34
+L98: clr *r4
+sub #152, *r4
+L99: add #-82, L34
+L100: stop
+L101: red r6
+jmp L31
+bne L20
+jmp L38
+sub #96, L61
+L102: .data 578, -237, 555, 943, 456, 360
+prn #-141
+L103: dec L72
+mov #16, L95
+L104: inc *r7
+jsr L91
+inc *r7
+not r7
+jsr L17
+prn *r7
+clr r4
+jsr L27
+inc r7
+L105: .string "foeysq"
+
+bne L91
+dec *r6
+L106: lea L32, r0
+not *r6
+L107: dec r5
+add L91, *r4
+L108: .string "fnreezqlndltwvztt"
+L109: .string "awlfnicgubsmtzicoqnnckho"
+L110: stop
+add r1, *r2
+L111: prn *r3
+jsr *r2
+lea L52, r6
+not r0
+L112: bne L73
+inc r2
+add L67, L107
+
+jsr L76
+L113: add L35, L18
+stop
+cmp *r4, *r3
+L114: .string "xmkmauqdqtirechky"
+jsr L47
+add L40, *r2
+not L98
+bne L44
+L115: .string "vglgsjrwjkbpdktwafvezqxd"
+L116: jsr *r7
+clr L49
+sub *r4, L92
+; comment
+L117: prn L76
+lea L50, *r4
+dec r2
+clr L16
+clr *r7
+red r3
+inc r6
+L118: cmp #-140, *r2
+L119: prn #-207
+prn *r6
+dec *r6
+L120: sub *r6, r3
+L121: add L30, L19
+stop
+L122: jmp L110
+cmp *r5, *r4
+add *r0, L27
+add *r7, r4
+dec L53
+inc *r6
+L123: cmp #-52, #-57
+L124: not *r2
+; comment
+L125: jsr *r4
+L126: bne L106
+stop
+L127: not L59
+prn r7
+bne L14
+L128: prn #183
+L129: sub r0, *r2
+bne *r0
+jsr L6
+; comment
+bne L2
+sub L114, r2
+L130: .data 313, -778, 870, 858, 281
+L131: sub L54, r4
+L132: lea L78, L82
+cmp r7, L15
+L133: inc L78
+prn L110
+; comment
+L134: jsr L80
+mov #-229, *r5
+L135: stop
+L136: stop
+L137: clr L13
+rts
+prn r6
+red *r2
+not L136
+prn r4
+not *r2
+sub r0, *r0
+lea L110, r5
+dec r4
+L138: lea L132, r4
+inc L83
+sub r2, L118
+L139: jmp L20
+stop
+sub *r7, *r6
+L140: clr r0
+L141: inc L88
+add #115, r7
+bne L105
+dec r3
+lea L138, r7
+L142: red *r3
+L143: add *r5, L108
+cmp #8, L135
+not L122
+L144: .string "wnnllhxupxgzthzypomktbhj"
+mov *r3, L122
+L145: .string "jdkdhboaixyntxusgtzupbhc"
+add *r1, *r1
+L146: jsr L69
+sub r2, *r3
+jmp L4
+cmp #209, #73
+L147: .data -950, -678
+L148: bne L115
+jmp L98
+add L82, r2
+not L26
+not r6
+bne *r6
+L149: mov L93, L23
+L150: not L100
+L151: inc L54
+L152: clr r5
+L153: .string "rzdhkxpugbckhxrws"
+stop
+jmp L22
+L154: stop
+inc r3
+bne L140
+stop
+jmp L9
+inc L119
+red *r3
+add r0, L52
+L155: prn #-182
+L156: sub r3, *r3
+L157: bne *r5
+red r4
+dec L39
+L158: lea L71, r3
+red *r0
+rts
+L159: prn r1
+inc L68
+L160: inc *r3
+; comment
+L161: .data -158, 409, 866, 72
+mov *r4, *r6
+red *r0
+L162: stop
+
+mov #-201, r0
+inc L65
+jsr *r1
+sub *r7, r6
+rts
+L163: inc L24
+cmp *r7, r7
+prn #160
+L164: stop
+L165: dec L150
+L166: sub *r5, r6
+; comment
+lea L53, L132
+L167: .string "syho"
+L168: red *r5
+rts
+bne L125
+rts
+clr *r2
+dec *r2
+bne L122
+L169: jsr L123
+L170: clr L108
+not *r6
+L171: .string "kvcwjomddsnjistt"
+red r0
+clr L47
+dec r0
+L172: add *r3, L153
+inc *r3
+L173: sub #174, L66
+lea L155, r3
+L174: jmp L96
+jmp *r5
+L175: prn #107
+L176: mov #-250, r4
+red r2
+rts
+L177: .string "tayqv"
+L178: .string "crfoct"
+cmp *r3, r3
+L179: dec r1
+jsr *r3
+; comment
+inc L98
+red L62
+prn #255
+L180: inc L64
+L181: clr r4
+jmp L98
+L182: .data 375, -516, -704, -2
+cmp r7, L114
+L183: stop
+cmp #61, #76
+L184: not *r1
+dec r4
+L185: .data -94, 979, 939, 484, 612, 116, 916, -476
+prn *r2
+stop
+prn #73
+mov *r6, *r1
+lea L1, r7
+stop
+L186: prn #-2
+jsr *r7
+L187: lea L165, L158
+sub L146, *r1
+cmp L11, *r1
+L188: .string "iys"
+dec L20
+bne L152
+; comment
+L189: jmp *r5
+stop
+L190: stop
+L191: lea L36, *r1
+not r7
+mov r2, *r1
+sub L163, r3
+bne *r0
+lea L8, L157
+jmp L0
+rts
+rts
+clr r4
+L192: .string "jlafdxokeduzpluzb"
+not L135
+
+
+cmp *r1, r4
+clr *r1
+not *r0
+red r3
+
+L193: jsr *r4
+; comment
+L194: .string "muollvsthoobpipe"
+cmp *r1, L94
+clr *r6
+
+L195: .data -270, 185, 228, 567, 38, 602, -288, -919
+L196: add *r4, L138
+bne L28
+add r3, *r3
+add r6, *r6
+stop
+dec r2
+add L190, r1
+L197: sub #-233, *r4
+dec L6
+not L110
+L198: clr L86
+bne L39
+add L121, *r7
+L199: not L189
+not *r6
+L200: .data -410, -687, 764, 679, 951, -602
+stop
+L201: red r0
+L202: stop
+not r6
+L203: cmp #126, r5
+L204: inc L152
+L205: .data 589, -802, 394, -586, 249
+lea L128, r5
+sub r3, L179
+dec *r1
+dec L182
+L206: not *r0
+
+add *r4, *r5
+
+L207: add L1, *r1
+L208: cmp #-200, r2
+L209: rts
+cmp r1, #-11
+L210: mov L43, r1
+clr *r5
+inc L151
+L211: dec *r0
+L212: not *r0
+L213: inc L105
+add L203, L116
+clr *r7
+clr *r6
+L214: bne *r2
+L215: .string "xqitncjwfiesemg"
+L216: jsr *r2
+rts
+sub L152, L85
+rts
+L217: .data -998, 971, -782, 435
+clr *r6
+add #-127, *r4
+sub #-40, L79
+prn r1
+L218: lea L29, r3
+bne *r7
+cmp r4, #66
+red *r6
+L219: clr r7
+L220: jmp *r1
+sub *r0, L162
+L221: .string "uoswiknrnipax"
+add r5, r4
+clr *r5
+inc *r4
+lea L118, *r7
+L222: mov L38, *r0
+mov L112, L66
+lea L176, *r1
+L223: add L54, *r6
+L224: .data 394, -706, -403, 144, -452, 947, 928, -223
+L225: bne *r0
+L226: jmp L136
+L227: lea L202, *r3
+L228: red *r4
+mov *r4, L73
+L229: .string "kzmfreprdujwxaxgcpiaxua"
+L230: .string "rgqpfgkogz"
+L231: clr r4
+L232: red r2
+L233: cmp L24, #-230
+mov L123, r2
+mov *r3, *r0
+L234: jsr *r7
+lea L157, r0
+sub #-122, *r3
+L235: dec *r5
+add r6, *r6
+L236: jsr *r0
+L237: lea L186, *r1
+L238: dec r1
+L239: sub *r4, *r4
+cmp L156, L149
+prn #129
+red r0
+L240: jsr *r0
+L241: .data 530
+sub *r5, r5
+lea L29, *r7
+cmp #-180, r5
+
+L242: .data -634, -1, -646, 598, -650
+L243: .data -432, -442, 248, 499, 195, -46
+not r5
+prn r2
+L244: .string "pi"
+not *r7
+sub r0, *r2
+L245: prn L27
+clr *r4
+L246: jmp L200
+
+L247: .data -376, 462
+L248: not L180
+rts
+L249: prn L122
+; comment
+L250: clr L218
+not *r5
+stop
+L251: .string "jhjfcqfmlgrgtlfyvzl"
+L252: .data 643, 694
+red *r6
+add #79, *r1
+L253: .data 619, 748, 667, 310, -322, -435, 576
+L254: jmp L91
+L255: .data 752, 368
+rts
+L256: .data -235, -22, 704
+L257: cmp r2, *r0
+rts
+L258: .string "yrwosqnjzljxplzjwycjcd"
+L259: prn *r0
+sub r1, L246
+L260: red L183
+jsr *r5
+
+stop
+jsr L7
+mov L187, L146
+rts
+; comment
+dec r7
+prn r2
+clr *r2
+jsr *r4
+rts
+clr L107
+L261: not r7
+inc r3
+L262: red *r0
+jmp L255
+cmp r0, #26
+L263: jsr *r6
+dec *r0
+jmp L141
+dec r3
+cmp r5, *r1
+L264: add L140, r1
+lea L212, L106
+L265: .string "ewpr"
+cmp #160, L10
+add L261, *r3
+L266: jmp L168
+L267: .data 16, -101, 359, -123, 778, 833, 959
+L268: .string "gvnfcnge"
+L269: jsr L107
+prn *r1
+L270: prn *r6
+mov *r6, r2
+L271: .data -867, 739, -599, 146
+L272: .string "kzsopipnmcffre"
+red L37
+prn *r7
+jmp L141
+red L187
+mov L163, *r5
+
+inc r6
+prn #46
+L273: jmp *r5
+dec r2
+jmp L261
+sub *r3, r4
+cmp L10, *r5
+rts
+L274: .data -754, 923, -831, -608, -180
+not *r2
+red *r4
+dec L88
+lea L252, L270
+bne L116
+inc *r6
+clr r7
+L275: .string "jcqnptokemlpzegteob"
+lea L51, r3
+L276: inc L259
+dec r3
+inc r6
+; comment
+jmp *r0
+mov *r4, *r5
+mov r0, r7
+add L180, r5
+stop
+L277: mov #-66, *r3
+cmp r6, r0
+dec *r7
+L278: cmp *r0, r1
+not r0
+stop
+L279: jmp *r6
+cmp #-143, r5
+clr r6
+L280: .data -500
+L281: stop
+L282: mov #-21, r3
+L283: prn r2
+cmp #-150, *r4
+jsr *r3
+rts
+jmp L233
+L284: clr L261
+add r6, L28
+inc *r6
+stop
+
+dec L60
+add *r5, r3
+L285: jsr L174
+L286: prn r7
+L287: add #-193, L21
+jsr L286
+sub *r7, *r4
+rts
+bne *r1
+stop
+sub *r6, L219
+sub L164, L161
+bne *r0
+mov r2, L114
+L288: rts
+L289: not *r1
+L290: rts
+dec *r4
+L291: clr r1
+L292: clr L148
+mov *r6, *r1
+L293: add #11, *r5
+bne *r6
+red L106
+L294: .data 912
+L295: .data -108, -904, -232, 311, -160, -879, -222, 9
+L296: .string "cqhyedljliujgeqeassanp"
+jsr *r1
+L297: dec L253
+cmp L217, *r3
+L298: stop
+L299: .string "oukyrwrohnewecy"
+L300: inc L187
+L301: rts
+sub L139, L30
+bne L28
+rts
+prn L167
+L302: not r3
+red *r3
+lea L189, *r7
+cmp #186, #20
+sub *r4, *r1
+L303: jmp L120
+sub L39, *r3
+L304: .string "lepmixmsj"
+L305: clr L84
+not r7
+bne *r3
+dec L117
+inc *r2
+not L202
+L306: inc L195
+not r0
+clr *r0
+L307: .string "aiequrxut"
+rts
+L308: .data -555, -477, 478
+stop
+bne *r5
+inc *r5
+rts
+L309: red *r5
+L310: lea L238, L36
+cmp r3, r6
+inc r2
+stop
+jmp *r0
+jmp *r1
+; comment
+lea L9, L239
+add *r0, L295
+L311: add *r2, *r1
+rts
+L312: lea L142, L98
+L313: not *r6
+inc r3
+sub *r1, *r6
+L314: inc *r7
+sub r2, L174
+mov *r6, *r2
+L315: stop
+add #-79, L17
+add L69, L79
+clr *r2
+jsr L10
+jsr *r5
+add #207, *r5
+L316: sub L245, L289
+L317: prn r1
+rts
+jsr *r4
+jmp L221
+jsr *r5
+L318: .data -501, 42, 136, 718
+bne *r2
+L319: .string "uldtwbosunzsyfejiwafntya"
+stop
+not *r5
+bne L263
+L320: jsr L59
+sub #203, r7
+; comment
+jmp *r4
+stop
+add #107, *r4
+L321: not *r1
+L322: jsr *r5
+; comment
+inc *r3
+sub *r5, r6
+L323: cmp *r4, #-105
+L324: .string "kwjhmfmpseekje"
+mov L35, *r7
+L325: dec *r0
+red *r1
+L326: cmp *r6, r2
+L327: rts
+mov #145, r7
+dec r3
+sub r6, L28
+red r5
+prn *r5
+jsr L139
+prn L292
+stop
+add *r5, L30
+L328: .string "nikld"
+jmp *r4
+dec L145
+red *r3
+jsr L115
+L329: jmp L282
+; comment
+dec *r3
+clr r6
+rts
+add #71, L49
+rts
+not r3
+prn *r5
+L330: sub #95, *r2
+rts
+; comment
+stop
+inc r6
+add *r5, L279
+jsr L291
+rts
+not L286
+L331: mov r7, *r5
+L332: jmp *r4
+L333: jmp L90
+clr *r6
+bne *r5
+L334: prn *r6
+jmp *r4
+L335: .string "zgafafvkmdrpggmt"
+clr *r2
+clr L169
+sub r3, r5
+; comment
+clr r0
+clr *r5
+L336: inc L33
+L337: bne L295
+inc L154
+L338: jmp L244
+L339: clr L328
+bne *r5
+sub *r6, *r3
+L340: sub #133, r1
+L341: .data -557, 944, 698, 553, 376, 623, 492, -980
+stop
+L342: cmp L179, #247
+L343: dec *r2
+L344: mov #-28, L114
+prn L289
+L345: bne L131
+stop
+L346: stop
+jmp *r5
+jmp *r7
+L347: rts
+L348: .string "urokntakhxzvkcowyvzytr"
+clr r0
+L349: clr r7
+L350: .string "yghggqqvyhvdldfusrddllue"
+mov #-27, r2
+L351: prn r7
+jmp L280
+inc r4
+; comment
+jsr L149
+jmp *r2
+L352: dec L155
+L353: add *r4, L320
+
+bne *r1
+L354: add #26, *r3
+L355: not L117
+; comment
+red r1
+sub *r0, *r5
+L356: .string "lrwkerjgygixmsm"
+L357: inc L118
+L358: stop
+add L38, *r6
+L359: stop
+jsr *r4
+
+L360: .string "whywceesjiklldttc"
+cmp r5, r5
+jsr *r6
+L361: not *r2
+inc *r4
+stop
+inc *r6
+clr L226
+clr *r3
+L362: sub r1, L2
+red r4
+lea L55, *r1
+cmp r3, *r0
+add r1, *r0
+L363: stop
+sub r1, *r2
+red L356
+lea L290, L69
+L364: .data 462, -993, -267, 668, 646, -549
+cmp *r4, *r2
+L365: .data 263, -57, -450
+
+L366: .string "d"
+L367: prn *r7
+L368: bne *r1
+stop
+L369: .string "npohatupkqils"
+rts
+add *r4, L112
+L370: .string "vedtxilrndagzg"
+L371: mov #-134, r1
+jsr L13
+; comment
+prn L113
+bne *r2
+; comment
+cmp r1, *r7
+L372: jsr *r2
+bne L44
+jmp *r0
+L373: .string "vlvzvnltaajuufclukmbeb"
+stop
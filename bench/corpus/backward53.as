@@ -0,0 +1,1027 @@
+; Generated by genCorpus --seed 54
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+jsr L211
+clr L166
+prn L180
+L0: mov r4, *r5
+lea L0, *r7
+add #141, L0
+L1: .data -225, -698, -730, -771, 932, 219
+L2: .string "cbsrvrcrakzxsxfnxiuhsmf"
+L3: .string "rlkxavjjbxagzlkyqijxbx"
+L4: prn *r7
+L5: sub L4, *r4
+L6: jsr *r2
+L7: bne *r4
+L8: prn r0
+L9: add r5, L4
+sub L9, r3
+mov r3, *r7
+
+L10: .data 905
+stop
+L11: lea L5, L7
+L12: prn L3
+L13: inc *r6
+stop
+L14: .string "cmelrlbhtnippvyzy"
+cmp #-203, *r0
+bne L13
+L15: .data -137, 183, 209, -43, -969, -491, 42
+sub #-96, L8
+L16: dec r7
+add r0, L6
+bne *r4
+L17: .string "nlrnrecuzbeqiezsqbdxjour"
+sub #-205, *r6
+bne L3
+L18: prn #-1
+
+mov *r4, r5
+L19: .data -352, 495, -218, 872, -351, -473
+L20: .string "rpuuffzhzhko"
+stop
+dec r1
+prn *r4
+prn r1
+rts
+L21: lea L14, *r2
+red L5
+L22: jmp *r6
+not r5
+L23: prn L7
+L24: .data -789, 47, -899, -599, -19, -460
+stop
+not *r1
+dec r2
+stop
+jsr *r2
+jmp L18
+not L18
+inc r3
+L25: prn L23
+add r1, r0
+L26: .string "jbjcsijsdyobhlowkrsibwf"
+red L7
+rts
+not r6
+L27: add *r3, *r6
+
+bne L21
+L28: bne L11
+not r2
+sub #-133, *r5
+lea L4, *r1
+stop
+mov *r6, r3
+L29: lea L1, L25
+clr *r5
+clr *r5
+bne *r7
+bne *r0
+stop
+L30: cmp L23, #11
+L31: add *r2, r1
+lea L12, L28
+L32: prn #166
+rts
+jsr L21
+L33: red r7
+bne L11
+
+L34: .data -876, 114, -331, -365, -641, -91
+L35: rts
+L36: prn r5
+L37: add #111, *r3
+L38: .data 707, 582, -377, -616, -75, 139, -250
+L39: rts
+prn #-58
+dec L23
+L40: sub L30, *r2
+rts
+stop
+mov #-11, r6
+L41: .string "tviqgvzrkfyfgiuooos"
+L42: .data 482, 744, 97, -579, -966, -967, 613
+L43: prn *r2
+jmp *r2
+L44: .string "atjuzptg"
+not r6
+L45: clr L36
+jsr L1
+jsr *r0
+cmp *r2, L17
+L46: mov L37, L19
+L47: cmp *r3, L25
+lea L11, r0
+not L36
+L48: jmp *r5
+inc *r3
+inc r0
+not r6
+L49: red r6
+L50: stop
+red r1
+dec *r3
+add #-133, *r4
+L51: prn #233
+rts
+stop
+L52: .data 532, -92
+prn #25
+jmp L16
+add *r5, *r3
+L53: add #-27, *r6
+
+rts
+rts
+L54: .data -12, 719, -474
+bne L21
+inc r3
+bne *r3
+jmp *r4
+L55: jmp *r3
+L56: red r4
+jmp *r2
+mov *r1, *r2
+rts
+prn r6
+; comment
+L57: add L35, *r6
+add L16, r4
+inc L42
+L58: .string "bnzyyruwzoswdjgaqyuiqd"
+L59: .data -342, 87, 515, -785, 985
+L60: .string "eqklkp"
+L61: clr r6
+not L47
+L62: .string "tlfdqaoxuyawgkubqbmylzqh"
+L63: red *r1
+L64: cmp *r6, r3
+jsr *r1
+dec L2
+bne *r2
+L65: .string "psghqzpbbfljmnybeb"
+not r7
+mov L5, L62
+stop
+inc r1
+jsr L1
+L66: clr *r7
+L67: .data 911, -725, 31, -630, -707
+mov L52, L21
+L68: prn L17
+cmp L58, r4
+not r7
+inc *r3
+L69: .data -225
+bne L29
+L70: mov #238, *r1
+L71: lea L26, r4
+lea L16, *r5
+red L45
+L72: .data 382, -789, -674, 327, -618
+jmp L17
+L73: jmp L25
+L74: clr *r3
+bne *r0
+; comment
+bne L23
+L75: mov L25, L50
+bne L5
+bne L3
+bne L59
+L76: dec *r5
+L77: .data 661, 198, -747, 381, -956, -444
+; comment
+jsr *r4
+L78: prn r0
+L79: bne *r4
+L80: clr L78
+clr *r7
+stop
+clr L12
+inc r7
+dec *r4
+L81: red r4
+L82: dec *r6
+sub r6, *r3
+; comment
+L83: clr r4
+add r0, *r5
+L84: .data -96, 748, 700, 520, 347, 663, 870, -377
+inc L0
+add #111, *r4
+L85: add r5, r6
+L86: .data 569, 441, 11, -819, -868, 265, -824, 672
+add L74, r7
+L87: .data -562, -525, -349
+L88: mov r5, *r2
+lea L7, L76
+L89: dec r0
+clr L24
+prn r2
+dec r5
+L90: .data -627, 913, 264, -642, -132, -840, -277, -201
+not L18
+L91: lea L59, L16
+not *r5
+sub #119, *r0
+L92: lea L13, L56
+dec L62
+L93: stop
+mov r4, L24
+; comment
+L94: sub *r6, L66
+rts
+
+L95: prn *r0
+prn L49
+L96: dec r5
+rts
+L97: cmp *r7, r7
+L98: mov *r7, r5
+stop
+L99: cmp #-191, #-247
+stop
+L100: .data -335, -159
+L101: .data -413, 876, -967, 164, -631, -981, -688
+L102: inc r1
+L103: cmp *r0, r5
+L104: red r6
+sub #32, L11
+L105: cmp r1, r5
+bne *r1
+; comment
+L106: .data 991, -372, -299, 17, 767
+bne L102
+L107: .data 535, -391, 597, -270, 780, -225, 853
+prn L87
+inc r5
+bne *r3
+L108: .string "loslojzayqd"
+jsr *r0
+lea L87, *r1
+sub #-94, *r1
+rts
+sub r7, *r7
+L109: .string "eacriillbhhsyoznaebhz"
+inc L10
+L110: cmp #-143, r2
+; comment
+; comment
+L111: dec *r6
+jmp *r0
+L112: lea L96, L30
+jmp L47
+red L93
+L113: red L107
+lea L49, L33
+L114: lea L16, r0
+prn #157
+L115: .data -235, 379, -948, 597, 506
+bne L111
+L116: prn #4
+jsr L97
+cmp #-78, #-192
+not L75
+L117: bne L99
+dec L49
+L118: dec L33
+L119: .string "zmljytutyrpteytinp"
+L120: .data -345, 635, 823, 368, 727, 625
+inc L63
+prn *r0
+rts
+L121: mov *r7, *r6
+L122: rts
+; comment
+L123: .data 344, 609
+L124: cmp r6, r4
+jmp *r1
+L125: sub r1, *r2
+L126: jsr *r1
+L127: .string "gzjzqsdozwkkroo"
+lea L9, L78
+L128: .data 729, 659, -77, -116
+L129: not r3
+rts
+cmp *r2, L85
+bne *r7
+mov L8, L4
+inc L47
+L130: prn #-80
+dec *r3
+jmp L69
+lea L88, r2
+L131: inc *r3
+L132: .data -991, -342, -8
+L133: .string "ogoqde"
+L134: add #-34, r1
+red r3
+jmp L94
+jsr *r5
+L135: sub #-92, r0
+rts
+sub L4, L4
+L136: jmp L102
+red r5
+L137: dec r6
+L138: .data -783
+bne *r1
+add *r5, r2
+L139: dec *r7
+rts
+stop
+sub #-7, L52
+bne *r2
+sub L66, L74
+L140: lea L58, L101
+prn L38
+stop
+add L115, *r2
+rts
+mov *r5, *r5
+L141: jsr *r0
+prn r2
+L142: bne *r0
+clr r1
+sub #166, *r3
+jsr L41
+sub L30, *r0
+L143: jmp *r5
+bne L82
+prn #-65
+sub *r2, *r4
+lea L142, *r6
+L144: bne L130
+mov #-167, L109
+L145: red r2
+L146: lea L132, L121
+mov r3, *r5
+L147: add *r2, *r3
+rts
+add *r0, L47
+jmp *r2
+cmp #145, #209
+L148: prn r3
+jmp *r6
+L149: red L4
+lea L57, r5
+L150: lea L42, L121
+stop
+sub r3, r5
+jmp *r2
+L151: stop
+rts
+rts
+; comment
+L152: clr r5
+add *r5, *r3
+L153: jmp *r7
+sub #-180, L132
+mov r2, L16
+L154: red r7
+L155: .string "dytznfqp"
+; comment
+jsr *r6
+L156: red r0
+L157: add #84, r1
+sub #84, r4
+L158: inc L94
+sub r5, L137
+red *r4
+L159: mov r3, L101
+dec L61
+L160: not L102
+L161: bne *r1
+inc r3
+jmp *r3
+stop
+L162: sub *r7, L74
+L163: .string "uphgifxakcjmcm"
+clr *r0
+stop
+red r4
+L164: .string "hagcsojmrkewammi"
+L165: .string "lrrzcedwzw"
+prn *r6
+clr *r1
+L166: not r4
+L167: dec r2
+sub L143, r4
+inc *r2
+L168: dec L73
+red *r7
+sub #-114, L66
+L169: sub L145, r3
+; comment
+prn L25
+L170: cmp r3, L149
+mov L166, r0
+red L8
+L171: inc *r3
+bne L73
+jsr *r7
+bne *r2
+L172: lea L109, L5
+cmp r2, *r7
+L173: red *r7
+inc *r6
+sub r0, *r3
+L174: not *r2
+add #224, L18
+mov #-4, *r5
+dec r1
+L175: mov #91, L102
+prn r3
+not *r6
+L176: bne *r2
+dec *r0
+L177: inc *r2
+add *r4, L105
+L178: inc *r3
+clr L127
+L179: .string "enwtlenqajqxcssufg"
+inc L121
+L180: rts
+; comment
+L181: jsr *r4
+L182: jmp *r0
+cmp *r3, r7
+L183: lea L180, L103
+clr r0
+; comment
+red r3
+sub L51, r0
+lea L40, *r0
+
+lea L115, r7
+L184: rts
+L185: dec r0
+inc *r5
+L186: inc L169
+; comment
+L187: stop
+
+stop
+L188: jmp L153
+jmp L55
+L189: rts
+inc r6
+L190: lea L38, L58
+not *r1
+not r4
+jsr L20
+L191: .data 520, -548, -449, -824
+L192: prn L82
+clr *r3
+clr L118
+jmp L125
+L193: .string "bwiezfxaiwuiuebmk"
+; comment
+L194: .data -251, 937, -613, 884, -151, -711, 105
+mov r0, L81
+L195: jsr L103
+L196: red r2
+L197: .data 883, 559
+L198: .data 277, -463
+L199: .string "xprnrbjkogkbjxcybmnueyrr"
+lea L172, L129
+jmp *r6
+L200: red L26
+stop
+L201: clr *r4
+dec *r0
+not r6
+jsr *r0
+L202: .string "quuujoacumbetcsnfgxxeyk"
+mov L168, *r2
+L203: not L47
+jsr L51
+bne *r2
+; comment
+L204: not r1
+bne *r2
+jmp L60
+add *r0, L195
+inc L28
+prn *r6
+L205: stop
+L206: .string "pevjkbmbnrjvhspvg"
+L207: cmp #117, *r3
+L208: clr r7
+L209: jsr L127
+sub L169, *r4
+L210: dec r4
+L211: red *r3
+bne *r0
+L212: .string "ivtemtwmlvrh"
+clr *r3
+clr L72
+L213: lea L22, L207
+add r1, L41
+stop
+L214: rts
+L215: jsr L171
+jsr L6
+L216: .string "mfdqsrhhmmfppenlseqmak"
+L217: red *r0
+L218: prn L192
+clr r5
+inc r2
+clr r4
+L219: rts
+jmp *r6
+sub *r7, L152
+L220: jsr L169
+
+L221: bne *r6
+L222: .string "dobo"
+
+clr r7
+; comment
+dec L143
+L223: add L189, *r4
+
+rts
+L224: stop
+stop
+L225: .data 736
+bne *r7
+rts
+red L160
+inc L212
+mov #74, L158
+L226: clr *r0
+L227: red *r7
+lea L117, r4
+mov *r0, L159
+L228: prn r7
+L229: .string "fclzhu"
+stop
+clr r0
+inc *r7
+cmp r4, *r1
+rts
+L230: .data -531, -359, -509, -651, -192, 510
+cmp r3, #162
+dec r6
+dec L122
+sub #-25, r5
+inc r0
+L231: clr L28
+L232: .string "bhln"
+jsr *r3
+not *r3
+L233: bne L119
+cmp r2, *r5
+jsr *r7
+clr *r1
+jsr L31
+mov L161, *r5
+not *r3
+inc *r0
+mov #62, L119
+inc r1
+not L33
+dec L120
+L234: .string "ieljphv"
+cmp L189, #65
+stop
+L235: .string "dj"
+lea L186, L24
+red *r4
+cmp *r0, #-32
+mov *r3, L224
+L236: .string "bunybdhuvkvamtbkrnhjp"
+L237: bne *r1
+L238: mov L195, r3
+jsr *r1
+dec r3
+L239: not L235
+L240: .data 581, 164
+L241: bne L222
+L242: add L55, *r2
+; comment
+dec L113
+
+stop
+add *r5, *r3
+inc r7
+prn *r1
+sub *r6, L215
+L243: not *r3
+
+prn L95
+L244: jsr *r3
+clr L60
+prn #-110
+L245: add *r7, r2
+add r6, L17
+L246: jmp L189
+sub #172, r4
+inc L108
+L247: prn L85
+L248: inc r5
+L249: jmp L237
+L250: sub *r2, L102
+L251: cmp #-10, #167
+L252: .string "mpgmeverecqbtyoofxc"
+cmp L232, r1
+mov #79, r5
+L253: rts
+inc r5
+rts
+jsr *r0
+L254: inc r4
+L255: mov #-114, L49
+prn L175
+lea L116, L213
+add #246, *r5
+dec L42
+L256: red r6
+prn L229
+add r3, r1
+stop
+L257: stop
+L258: jmp *r7
+prn #89
+L259: .data -869
+clr r5
+inc L9
+stop
+lea L197, *r6
+L260: .string "oufs"
+L261: not *r2
+L262: .string "tauqlyvberuxlcplotfh"
+jmp *r0
+L263: sub *r2, L176
+L264: red L133
+dec L136
+L265: .data -903, -255, 14, -647, -712, 453
+not r3
+red r3
+L266: not r2
+L267: cmp L33, r1
+; comment
+lea L139, L124
+L268: bne *r0
+L269: clr L1
+jmp L53
+add *r5, L123
+L270: inc L17
+; comment
+add *r3, *r2
+L271: prn L122
+add r3, *r7
+clr *r5
+not r1
+red r5
+L272: mov #-45, L188
+
+prn L62
+; comment
+sub #207, r5
+bne L3
+red *r0
+L273: add L88, L63
+lea L133, *r7
+L274: red r7
+inc r0
+clr L239
+L275: stop
+inc *r0
+L276: jsr *r5
+L277: bne *r3
+add *r0, *r6
+cmp #15, *r3
+L278: mov *r7, *r1
+not r2
+jmp L15
+L279: .string "pycobtgvxymwzugazfknqrk"
+jsr L252
+jsr L266
+jmp L276
+L280: not r4
+L281: .data 673, -200, -903, 21, -626, 991
+add #-252, r0
+add L246, L83
+L282: .data 110, 271, -924, -481, 888, -710, -130
+L283: .string "wruactdusnfstgnfdctirl"
+prn L84
+L284: sub r5, L14
+red r0
+red L156
+L285: .data 17, -130, -373, -762
+L286: jmp *r6
+jsr L142
+L287: lea L50, *r6
+not r5
+L288: clr *r7
+clr L91
+jmp *r5
+lea L272, *r1
+inc L58
+mov *r0, L280
+L289: stop
+stop
+add r5, r6
+jmp L6
+L290: mov #-93, L28
+jmp L244
+prn r2
+; comment
+jsr L170
+mov *r4, r0
+clr r0
+L291: sub *r0, r3
+bne *r6
+jmp L258
+cmp r3, r3
+clr r4
+prn r7
+prn #-182
+dec *r1
+clr *r1
+L292: .string "z"
+not r2
+L293: cmp #123, r4
+red *r3
+L294: inc L147
+dec r5
+add #111, r2
+prn *r3
+L295: lea L179, r0
+add L233, L31
+sub *r4, *r2
+
+L296: bne *r0
+L297: clr r4
+clr *r5
+stop
+L298: jmp *r3
+L299: red r5
+L300: .string "bigymsnree"
+L301: stop
+; comment
+jsr *r5
+lea L191, *r7
+rts
+L302: inc *r7
+add #32, r3
+add r6, r2
+prn L34
+; comment
+L303: clr *r7
+L304: jmp *r2
+sub #-248, L219
+L305: mov r1, *r1
+L306: bne *r0
+rts
+L307: rts
+L308: rts
+lea L46, r7
+L309: .data -46, -142, 504
+L310: .data 358, 126
+inc L93
+L311: mov *r3, *r6
+L312: clr L201
+inc L90
+; comment
+L313: add *r7, *r1
+L314: .data 21, -274, -325, 5, 96, 984
+L315: mov r7, *r2
+L316: cmp L223, #6
+dec *r2
+stop
+L317: mov #-96, r3
+
+L318: .string "udxrlugzengmf"
+dec r5
+rts
+L319: cmp r7, L42
+not r0
+inc r7
+L320: cmp L308, *r4
+; comment
+clr L181
+L321: .string "iyemqfdkvacedxwpn"
+bne *r3
+L322: sub r2, *r3
+jsr *r4
+L323: jmp *r6
+jsr L201
+sub *r4, r5
+inc r3
+L324: add *r7, *r0
+jsr L146
+stop
+L325: red L240
+red L61
+clr r7
+lea L89, L163
+dec r5
+add *r5, r7
+jmp *r1
+jmp *r7
+L326: jsr *r6
+L327: inc r7
+L328: inc *r7
+mov r5, *r2
+stop
+inc *r5
+sub L74, L260
+L329: not L160
+prn r0
+sub L283, *r1
+L330: prn *r6
+L331: prn #-20
+sub *r7, r0
+L332: dec *r4
+L333: rts
+inc *r2
+L334: jsr L209
+rts
+cmp r6, L315
+mov r1, r6
+L335: not *r1
+L336: cmp L19, L161
+jmp L101
+jmp L136
+dec *r7
+cmp L239, r7
+add *r7, *r4
+sub #86, L220
+jsr L110
+L337: red r4
+inc *r7
+L338: cmp r3, *r4
+L339: .string "zilxfccbxekfoqnthbeosowh"
+L340: .string "hdguqrovcffnxxlkohuhrs"
+L341: jmp L295
+lea L117, r1
+mov #201, r4
+not *r3
+sub #-5, *r2
+L342: .string "yxlwrbwiwxcx"
+sub #23, L48
+jsr *r7
+sub *r0, L200
+rts
+sub *r0, L199
+; comment
+L343: prn r7
+L344: rts
+jmp *r0
+L345: stop
+; comment
+sub r2, *r3
+stop
+L346: jsr *r5
+red *r1
+L347: add *r5, r6
+mov *r3, L160
+L348: red r6
+clr *r1
+clr L259
+inc L344
+L349: lea L232, L332
+L350: .data 513
+L351: .string "njdfk"
+L352: cmp L279, #36
+L353: .data -904, 449
+rts
+L354: cmp #107, r1
+not L57
+cmp #66, *r7
+mov #-184, L308
+red *r1
+jsr *r5
+not *r7
+lea L92, r7
+L355: cmp L167, #17
+clr *r0
+red r6
+add *r7, *r7
+L356: sub L270, r2
+sub #134, r5
+dec L136
+lea L10, r7
+lea L235, *r0
+L357: jsr L187
+jsr L195
+L358: lea L222, *r2
+L359: .string "rsgatemutkzekaiwjqdrbmq"
+L360: prn r6
+L361: .data 264
+not L100
+sub *r1, r6
+jsr *r6
+L362: jmp *r5
+bne *r2
+rts
+L363: sub L291, r6
+mov #158, r5
+L364: dec L160
+L365: not L362
+lea L91, *r0
+L366: sub #-83, L217
+prn r0
+sub *r5, *r5
+L367: add L55, r4
+prn *r2
+not r5
+add *r4, *r6
+add L58, r5
+red *r1
+L368: sub r0, r6
+not r0
+L369: cmp L189, #103
+; comment
+bne L270
+bne *r7
+rts
+L370: stop
+L371: red L65
+inc L211
+L372: dec r4
+clr L223
+not r4
+cmp r6, *r2
+add #80, *r7
+lea L210, L203
+L373: rts
+bne *r2
+clr L68
+cmp r0, #42
+stop
+prn L276
+L374: prn #-169
+sub *r1, r2
+mov *r5, r2
+jsr *r1
+stop
+sub L339, *r5
+L375: inc L38
+L376: .string "s"
+inc r5
+stop
+L377: sub *r6, L304
+L378: lea L145, L2
+bne L33
+jsr *r2
+mov L249, r7
+red L304
+sub *r4, *r7
+L379: rts
+L380: stop
+dec L214
+lea L317, L47
+lea L211, L281
+L381: add #82, L267
+inc r2
+lea L244, *r0
+L382: add L162, L241
+bne L218
+L383: red r5
+L384: add *r0, L140
+rts
+L385: .data -671, 241, 109, -545, -887, -207, -721, 979
+prn L367
+not L356
+L386: .string "bnjgwcganqxnwoybkjuqhy"
+sub L355, L145
+
+L387: .data 790, 169, -139
+L388: .string "fxzqezz"
+L389: dec r4
+jsr L349
+jmp *r6
+stop
+rts
+stop
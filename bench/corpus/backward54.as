@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 55
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+L0: cmp #-166, #104
+L1: jmp *r6
+cmp L1, r2
+L2: cmp r0, *r3
+; comment
+L3: lea L3, *r3
+bne L1
+sub #62, *r3
+L4: dec *r5
+L5: inc r7
+not *r6
+L6: inc L0
+stop
+L7: .data 259, -110, -64, -413
+mov #145, L0
+L8: cmp *r5, r1
+L9: .string "vuxucynnbjbpch"
+L10: prn #-63
+L11: bne *r2
+L12: dec *r2
+inc r6
+inc L1
+L13: .data -160, 372
+L14: jmp L14
+cmp #181, *r5
+inc L10
+L15: cmp L7, #-59
+bne *r0
+L16: add *r1, L6
+lea L6, L2
+mov *r6, L9
+L17: jmp L8
+sub #221, r0
+jmp L5
+L18: .data -88, -893, -93, -103, 820, -622, -215
+rts
+
+inc r4
+L19: .data -509, 967, 149, -610, -816, -970
+add *r0, L11
+L20: bne L10
+L21: cmp r6, r0
+stop
+cmp L2, *r2
+L22: .string "xiaqqqdc"
+dec L22
+L23: prn r5
+bne *r2
+lea L0, r4
+jsr *r5
+L24: bne L22
+add L15, L9
+L25: stop
+L26: cmp *r1, *r5
+L27: .string "thujnavwmqaglvr"
+lea L8, L19
+L28: prn *r2
+add r2, r7
+rts
+L29: bne L3
+L30: sub r0, r5
+sub #185, L3
+mov r1, *r1
+mov *r2, L16
+L31: bne L16
+L32: .string "vchunolaqznp"
+L33: sub r3, *r1
+L34: bne L24
+jsr *r2
+L35: rts
+L36: inc *r2
+sub *r6, r5
+dec L15
+mov r5, *r4
+stop
+inc *r1
+L37: prn *r1
+L38: .string "hmeraqqdgewukit"
+L39: add *r6, L21
+mov r5, L2
+L40: red r3
+L41: .string "wkmjvzhidg"
+L42: prn *r4
+add r7, L1
+jmp L17
+jsr *r4
+L43: not *r7
+rts
+jmp L11
+lea L11, L3
+L44: mov *r0, r1
+jsr *r7
+L45: .data -24, -12, -463, -127, -569, -832, 810
+rts
+L46: sub #-4, L36
+sub L1, *r4
+L47: .data -952, 902
+mov *r3, r6
+clr r2
+add #-102, L10
+stop
+clr L8
+; comment
+
+dec *r5
+L48: inc r6
+prn *r6
+rts
+cmp L40, *r3
+; comment
+L49: cmp #-38, r4
+red *r7
+add *r2, *r5
+red L8
+L50: .data -569, 600, -351, 48, 126, -597, 957, 274
+rts
+L51: jsr L16
+mov r1, r4
+add r6, L21
+; comment
+L52: cmp *r1, r7
+L53: sub r5, L48
+L54: stop
+jsr L28
+; comment
+bne *r7
+L55: cmp *r2, L19
+L56: .data 866, 932, -300, 128, -265, 520
+jsr L43
+red *r2
+L57: cmp #114, *r0
+L58: not r2
+jsr *r7
+prn *r4
+L59: .data -74, 520, -935
+L60: .data 728, 735, -262, 574, -805, 685
+inc *r2
+red *r0
+prn r6
+L61: lea L37, L36
+not *r6
+dec r1
+inc *r0
+prn L23
+L62: .string "mnagcoxuburdamka"
+dec *r5
+; comment
+L63: .string "rqiyatxdoawrxdtsigampf"
+inc L2
+red *r3
+red r7
+jsr L28
+inc L48
+L64: cmp r1, r0
+L65: jsr L37
+jsr *r2
+L66: rts
+lea L7, *r4
+jsr L30
+L67: lea L23, L16
+L68: .string "xcovjsdtllpz"
+jmp *r6
+L69: .data 69, -257, -767, -634
+L70: red r3
+
+L71: .data -481, -422, 127, 401, -81, -277, -3
+prn r7
+cmp #117, *r5
+L72: .string "riauavddhxiag"
+red *r1
+lea L60, L38
+stop
+stop
+rts
+jmp L10
+L73: stop
+L74: lea L17, L56
+L75: add *r5, *r1
+L76: dec L24
+L77: .string "jigtj"
+sub r1, L64
+L78: jmp L78
+L79: .string "ojytwdhv"
+cmp *r6, L43
+L80: rts
+L81: .string "l"
+mov r4, *r1
+not L8
+
+L82: clr r4
+
+cmp *r1, L50
+mov #-199, L33
+L83: clr L2
+dec L47
+
+L84: dec r5
+dec r2
+L85: lea L15, L34
+clr r3
+jmp *r3
+red *r0
+cmp *r5, L72
+L86: .data 416, 951, -176, 317, -44, -370, -981, 814
+stop
+L87: .data 677
+dec *r3
+L88: dec r5
+dec L8
+red r6
+red *r7
+L89: rts
+not L21
+L90: jmp L20
+clr *r7
+red *r1
+lea L23, r0
+stop
+add *r5, *r5
+stop
+clr r4
+clr L64
+jmp *r5
+L91: .string "ims"
+mov L64, L11
+L92: rts
+L93: inc L46
+L94: prn #205
+L95: bne L33
+cmp L82, r5
+L96: cmp L45, L61
+L97: bne *r1
+L98: .string "gnoyraclrbailnxdw"
+L99: sub L65, L68
+red L75
+L100: sub *r2, r2
+prn *r3
+add r4, *r1
+L101: add *r0, r2
+L102: dec L32
+L103: dec L46
+L104: .data 463, -176, -446, -149, 932, -766, -111, -613
+lea L66, r6
+rts
+dec L59
+prn L77
+sub r2, *r7
+lea L23, *r7
+add #16, L22
+
+rts
+jmp *r7
+jmp L59
+L105: red L4
+clr *r4
+jsr L50
+bne L83
+jmp L71
+clr *r5
+L106: dec r4
+
+L107: stop
+L108: dec r4
+dec L71
+cmp L67, r5
+clr *r2
+L109: lea L67, *r6
+jsr L37
+L110: dec *r1
+L111: jsr *r5
+L112: clr L49
+dec L105
+cmp L97, #-144
+mov r6, L78
+add r7, *r0
+L113: lea L51, L58
+jsr L67
+inc r6
+sub #-175, L99
+rts
+L114: .string "wpulclazpa"
+red L85
+L115: prn L20
+prn L39
+mov *r1, L111
+L116: bne L29
+add L47, r4
+red r6
+L117: .string "hgxnelofdo"
+L118: red *r4
+not r5
+L119: not r3
+L120: bne L63
+red L31
+L121: cmp *r7, L104
+clr L63
+rts
+inc *r2
+stop
+L122: dec *r5
+jmp *r0
+L123: cmp r5, L3
+lea L99, L13
+sub r7, r0
+; comment
+rts
+bne *r7
+L124: red r2
+L125: jsr *r0
+L126: cmp *r3, *r7
+clr *r2
+L127: stop
+L128: .data 446
+inc r3
+bne L22
+sub #-179, *r2
+inc r2
+rts
+L129: jsr *r4
+add *r5, r3
+bne *r0
+L130: jmp L102
+clr *r1
+inc *r6
+L131: red r3
+cmp #154, #-12
+L132: .data -615
+inc r4
+L133: inc *r6
+mov r5, *r7
+bne *r0
+jmp *r1
+dec r5
+rts
+stop
+cmp *r6, *r5
+L134: .data -892, -467, 196
+inc r1
+add #-88, r7
+rts
+inc L42
+mov *r0, *r1
+L135: bne L68
+rts
+L136: lea L75, *r2
+L137: not *r4
+L138: jsr *r4
+L139: red r4
+add r0, *r0
+inc *r1
+jsr L6
+L140: mov #-216, r3
+L141: .data 825, -696
+clr r0
+
+L142: .data 127, -50, -997, 286, -771, 852
+red L55
+L143: dec *r2
+L144: jmp L97
+cmp #138, #-53
+
+jmp L100
+clr L131
+L145: not L22
+dec r0
+L146: sub r5, L96
+add #-82, r2
+jmp L58
+L147: clr r4
+red L93
+clr r0
+jsr L74
+stop
+sub *r4, L46
+clr L111
+sub *r3, r7
+L148: prn r2
+cmp L136, r3
+prn L34
+cmp #-234, *r7
+jmp *r2
+clr *r2
+add *r7, L33
+cmp L115, #-93
+add r3, *r0
+prn L17
+add r2, *r0
+prn L68
+L149: dec r1
+inc r1
+bne L19
+L150: red *r2
+jmp *r0
+rts
+jmp L38
+inc *r7
+jmp L12
+dec *r6
+; comment
+jmp L108
+stop
+jsr L103
+jsr L119
+; comment
+; comment
+L151: clr r0
+L152: stop
+; comment
+L153: .string "xpopbcdp"
+stop
+L154: .data -955, 931, 434, -128
+add #24, L26
+L155: prn L89
+L156: cmp L67, L48
+L157: add L51, L13
+red r4
+red L11
+L158: lea L117, L108
+rts
+prn L33
+sub L113, L49
+jmp L99
+mov #-159, r7
+L159: prn *r6
+L160: .data -750, -615
+not r1
+prn *r0
+L161: rts
+jmp *r3
+mov *r1, *r3
+L162: stop
+L163: jmp L151
+inc r7
+mov L127, L159
+cmp *r6, *r1
+; comment
+L164: dec *r0
+L165: lea L107, r5
+add #-176, L25
+cmp r6, L146
+mov r4, *r3
+add *r5, L38
+L166: add #-221, *r6
+sub L24, L19
+L167: jsr L92
+dec L27
+jsr L8
+L168: .data 162
+L169: inc L115
+L170: red r1
+L171: sub r5, L42
+clr L126
+L172: cmp *r3, L58
+L173: .data -958, -699, -931, 614, -770
+inc *r1
+dec r3
+jmp L145
+L174: add *r4, L154
+L175: jsr *r1
+; comment
+clr *r5
+L176: jmp *r7
+L177: clr *r6
+bne *r7
+L178: inc *r2
+inc L39
+clr r3
+; comment
+sub #-163, r2
+not *r4
+rts
+prn L49
+L179: .string "zkitpiksfethbwgvhjybuklz"
+rts
+L180: clr L50
+L181: .string "hytrvwpckyydaazy"
+jsr *r2
+inc r5
+stop
+L182: clr r0
+jmp *r3
+stop
+L183: dec L66
+add *r4, r2
+inc r2
+stop
+L184: .data -613, -197, 691, -308
+L185: .data 210
+dec *r6
+
+clr r5
+dec *r3
+jmp *r5
+L186: cmp #106, *r3
+jmp *r6
+; comment
+L187: .data 869, -6, 359, 980
+add L83, L184
+rts
+rts
+L188: .data -874
+red *r3
+cmp *r1, L77
+cmp r5, #-237
+red *r0
+lea L78, L18
+L189: .data -348
+rts
+L190: bne *r2
+add r0, *r2
+clr *r6
+
+clr L24
+lea L129, *r7
+rts
+prn L140
+dec *r7
+add *r1, r2
+prn r6
+L191: .data 623, 238, -14, -151, -265, -950, 743
+stop
+bne L166
+L192: not *r3
+L193: jsr *r1
+clr r3
+prn *r3
+L194: inc *r1
+add r1, L123
+prn #60
+not *r2
+L195: .data 386, 368, -847, -611, 182, -140, 153
+sub L26, r3
+; comment
+L196: not *r2
+sub r0, L161
+prn *r1
+
+L197: rts
+lea L68, *r6
+L198: jmp L145
+dec *r1
+jmp *r0
+L199: jsr L15
+sub r1, L45
+not r1
+not L199
+L200: bne *r6
+clr r0
+bne *r0
+add r2, *r4
+; comment
+L201: jsr L192
+red *r3
+L202: .string "txpm"
+L203: clr *r2
+
+dec L161
+lea L4, *r1
+not L156
+rts
+cmp *r0, L200
+; comment
+L204: add *r3, *r1
+prn r6
+rts
+stop
+L205: jmp *r3
+jmp *r6
+cmp *r5, *r5
+bne L138
+L206: .data -79, 27, 570, 343, 48, -285
+L207: bne *r1
+L208: red L178
+sub r3, L72
+stop
+cmp *r3, L169
+L209: .data -916, 294, 855, -679, 412, 201, -857, -472
+L210: inc r5
+not L50
+inc *r0
+L211: .data 640, -883
+prn #103
+L212: cmp L8, *r1
+stop
+red *r1
+
+lea L150, r6
+L213: jmp L165
+prn r0
+L214: lea L21, L89
+; comment
+L215: jsr L141
+sub *r3, r7
+stop
+add #-220, L93
+L216: clr r3
+L217: sub L112, L214
+L218: bne L32
+mov #-121, *r4
+L219: rts
+L220: sub #-127, L119
+dec *r6
+stop
+L221: .data 464, 90, 723
+clr r7
+mov r2, *r4
+L222: rts
+cmp r6, r0
+rts
+L223: lea L187, r0
+L224: .string "jsqctlgjennryuyjv"
+dec *r3
+rts
+jsr *r3
+clr r1
+add *r3, L10
+jmp L162
+dec *r1
+sub *r5, L115
+prn r2
+stop
+L225: inc L175
+stop
+inc L148
+L226: .string "fcbrd"
+clr r4
+stop
+jmp *r5
+L227: sub r7, L55
+sub L69, L152
+L228: not L215
+L229: clr *r7
+mov r5, r7
+jsr L210
+L230: cmp #23, *r3
+L231: mov #234, L174
+L232: jsr *r1
+rts
+L233: lea L162, *r3
+L234: inc L6
+stop
+jsr L202
+clr L175
+prn r5
+sub r3, L12
+L235: .data -405, 249, 281, -908, 490, 735, -177
+clr *r6
+stop
+clr *r1
+L236: .data -230, -623, 482, -859, -703, 158
+L237: mov #-119, *r0
+not L185
+lea L199, *r1
+stop
+clr r1
+sub r2, L159
+not *r5
+L238: .string "bmbilfkvir"
+stop
+L239: cmp #-150, *r0
+cmp L85, L38
+L240: .data 815, 504, -24
+not L23
+L241: clr *r6
+stop
+; comment
+sub *r1, r1
+lea L195, L93
+L242: .data 977, 423, -673, 484, 876, 749
+L243: .string "jxrcydmlqvzxrblql"
+stop
+L244: add r5, r5
+dec L160
+clr r0
+L245: dec L237
+red *r6
+sub *r4, L153
+L246: .string "paxzqypvnfykhm"
+L247: .string "dnfbgsyu"
+rts
+L248: red r3
+L249: stop
+add #130, L223
+sub L151, L1
+inc L230
+cmp *r4, *r4
+inc r6
+rts
+rts
+mov L113, r4
+not *r5
+L250: mov r5, r1
+dec L83
+jmp *r2
+jsr *r5
+L251: .string "fbqkrqyq"
+L252: add #-143, L137
+; comment
+L253: .string "ebpzntr"
+L254: not r6
+dec r7
+not r4
+L255: lea L100, r2
+sub #156, *r2
+dec r5
+L256: red *r7
+prn r7
+prn *r0
+L257: sub L4, *r0
+L258: dec r3
+prn r5
+L259: sub L116, r5
+L260: .data 737, -254, 544, -642, -119, -460
+L261: cmp *r5, L135
+bne L230
+L262: .string "go"
+jmp *r7
+prn r6
+clr r1
+rts
+sub #161, *r5
+add r6, L43
+prn *r3
+prn L238
+lea L243, *r4
+rts
+L263: jmp L72
+; comment
+dec r4
+mov #-180, *r1
+lea L32, r2
+cmp r0, *r0
+L264: red L114
+L265: not L126
+L266: jmp *r3
+L267: .string "bkun"
+clr L98
+jsr *r1
+inc r1
+rts
+L268: dec r7
+; comment
+cmp L250, *r4
+L269: mov L110, *r1
+; comment
+jsr L250
+; comment
+L270: rts
+L271: .string "yqzgckjzm"
+jmp *r5
+L272: sub #-195, L199
+L273: bne L254
+dec L30
+; comment
+prn *r3
+L274: cmp r1, L270
+; comment
+L275: dec r5
+jsr L58
+L276: red L173
+L277: cmp r7, r4
+clr *r6
+L278: cmp r0, L103
+dec r4
+clr r4
+cmp #-56, #233
+lea L241, r1
+rts
+sub *r3, r6
+L279: red r5
+stop
+not r5
+L280: mov #114, L217
+L281: bne L210
+lea L112, *r6
+sub #24, L111
+red *r3
+mov *r3, r4
+L282: cmp #183, r4
+L283: jmp L21
+stop
+lea L56, L191
+L284: not *r1
+bne *r5
+L285: .string "grmajeprnloiagvegai"
+red *r1
+L286: .data -513, -639
+rts
+
+rts
+jmp L69
+
+red r3
+dec r1
+mov #205, r5
+; comment
+rts
+dec *r1
+L287: inc *r7
+rts
+sub #-110, L115
+not *r7
+
+rts
+L288: not r6
+jmp L58
+cmp r4, r4
+prn *r7
+lea L247, L48
+L289: .string "bjsivekzqw"
+L290: add L165, r3
+stop
+L291: lea L86, *r2
+L292: cmp L242, r3
+; comment
+L293: stop
+prn *r5
+add L245, r5
+clr L132
+L294: cmp r0, *r5
+bne *r1
+cmp #-246, #-79
+jmp *r1
+red r5
+
+jmp *r4
+bne L58
+prn r3
+stop
+jmp L130
+L295: .string "kwobkairsacfighpsuni"
+L296: not *r3
+inc r3
+jmp L282
+cmp r4, r4
+L297: rts
+L298: bne *r6
+L299: jmp L11
+rts
+bne *r1
+clr *r0
+inc *r6
+L300: sub r2, L220
+not *r1
+rts
+rts
+L301: dec L277
+jmp L16
+dec r0
+L302: lea L92, L149
+prn L257
+add r3, *r3
+L303: .string "llzjnaeureecqwgnzdf"
+jsr *r2
+rts
+L304: sub *r0, r1
+L305: jsr L176
+mov *r7, L102
+L306: clr r0
+L307: rts
+bne L60
+cmp L234, #206
+L308: red L251
+rts
+sub r1, L53
+
+L309: inc L300
+L310: lea L151, *r2
+prn r4
+jsr *r1
+not r3
+L311: mov L228, L99
+stop
+clr r6
+dec r5
+L312: jsr *r2
+L313: mov #209, L7
+sub L134, r6
+
+sub #98, r6
+mov L104, L99
+rts
+
+sub *r6, r4
+not L107
+L314: .string "sbyfjkrdwoeeeef"
+L315: .string "wqgurskdwbrjqakyxofvrktw"
+L316: jsr L18
+cmp *r2, r6
+stop
+stop
+L317: .data 647, -620, -861, 942, -254
+mov *r5, *r2
+L318: not r0
+prn #-225
+dec L228
+dec *r7
+L319: mov r5, r7
+L320: .string "ovh"
+L321: .string "nhmuchm"
+L322: .string "uqdyoxgfwjmllpyjidzbf"
+L323: .data -831, 655, -33, 969
+add L238, *r0
+add L245, *r1
+clr r2
+L324: .string "cvftvrspkpqvyugeivrz"
+prn *r4
+stop
+; comment
+sub *r2, L248
+inc r4
+L325: red *r7
+L326: red *r3
+prn *r6
+L327: .string "yfzybfdqz"
+mov r0, *r2
+clr L262
+L328: rts
+mov L221, *r1
+add *r1, *r1
+jmp L7
+stop
+
+L329: inc *r4
+dec *r3
+L330: .data 960, -132, 705, 547, -547
+jsr L37
+jsr *r4
+L331: add L175, *r5
+dec L65
+L332: prn L297
+; comment
+cmp r4, r5
+L333: red L331
+L334: clr *r4
+L335: prn L159
+L336: mov r1, L312
+clr *r5
+L337: .data -497, 333
+mov r5, r7
+L338: lea L158, r6
+lea L190, L304
+L339: sub L65, r7
+inc L222
+L340: jmp *r2
+red r5
+stop
+inc L108
+clr *r3
+prn *r0
+L341: stop
+L342: mov L36, r3
+mov #161, r1
+inc *r6
+red L278
+cmp r4, *r6
+L343: jsr L18
+lea L227, L106
+rts
+; comment
+bne L11
+lea L277, r3
+L344: .string "hpfzbfrhfbusbcrumgauccqu"
+L345: .data 830, 116, -196, -607, -172, -824, -822, -406
+rts
+; comment
+not L172
+rts
+L346: lea L290, L42
+L347: red r7
+inc L171
+jmp *r4
+add #212, L270
+clr r3
+bne *r0
+cmp r5, *r0
+jsr *r6
+L348: jmp *r6
+rts
+L349: rts
+L350: lea L314, L268
+L351: mov #6, r2
+clr r0
+rts
+L352: .data -742, 636, 853
+; comment
+red r4
+cmp L83, L295
+inc *r1
+not r1
+add L154, L242
+prn #27
+jmp L132
+add #235, r5
+clr *r1
+L353: dec L9
+L354: red L183
+L355: rts
+mov L267, L33
+red L169
+stop
@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 56
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+stop
+sub #221, *r6
+dec L137
+
+L0: prn L0
+L1: mov L1, r7
+lea L0, *r0
+L2: .string "mlh"
+; comment
+rts
+jsr L1
+dec r5
+; comment
+L3: .string "ajwldlqsnuarywkqjwuadpdg"
+L4: jsr *r5
+lea L0, *r0
+L5: .string "rvdnauttwzikshy"
+add L3, *r5
+L6: .data -764, -828, 927, 362, -279
+L7: .string "vcmkg"
+L8: jsr L8
+
+
+L9: add *r5, L0
+L10: clr L10
+rts
+jmp *r7
+dec L9
+L11: jmp *r4
+L12: stop
+add *r6, L11
+rts
+bne L6
+bne *r3
+red *r1
+sub #-137, L5
+L13: .data 950, 526, 482, 403, 189
+jsr L0
+add L12, L10
+
+sub #72, r5
+stop
+cmp L9, #99
+jsr L0
+rts
+L14: add r5, r1
+bne *r5
+L15: jmp *r4
+bne *r5
+L16: not r0
+L17: add L4, *r1
+clr r5
+dec r5
+clr r0
+prn r0
+L18: cmp r1, #-2
+L19: jsr *r5
+bne *r5
+jsr L12
+L20: .data -7, 40, 713, 367, 703, -838, 410, 407
+prn *r5
+prn L8
+L21: mov *r1, r5
+red r0
+clr L19
+not L20
+L22: dec *r3
+jmp L19
+inc r7
+add *r2, *r2
+; comment
+prn r4
+cmp *r5, #-247
+prn #167
+L23: bne L8
+; comment
+jsr L13
+bne L8
+; comment
+clr L20
+L24: lea L2, L11
+stop
+jsr L12
+cmp L0, #-254
+clr *r2
+L25: .string "h"
+not r7
+lea L15, r5
+mov #177, r0
+dec *r1
+lea L5, L14
+jmp L9
+rts
+; comment
+sub L3, r5
+not *r1
+clr r5
+L26: .data 961, -5, 204, 182
+stop
+L27: dec r5
+L28: .data -872, -932
+L29: prn r5
+jmp *r1
+stop
+L30: .data -352, 254, 406, -474, -263
+L31: .data -965, 361, 414, 173, -41, -629, 459
+inc L28
+prn L25
+jsr L16
+L32: dec r7
+L33: clr L15
+bne L28
+clr r1
+rts
+L34: clr r4
+cmp #-33, #-180
+prn *r3
+L35: rts
+add L30, *r5
+add L5, L17
+not L0
+L36: dec *r6
+red *r3
+red *r2
+L37: .string "akcas"
+L38: jmp *r7
+L39: not L0
+rts
+rts
+L40: bne *r4
+inc *r7
+clr r7
+cmp L13, L30
+not L40
+rts
+L41: .string "cpdyrjjodgbfuz"
+L42: rts
+stop
+jsr *r5
+dec r7
+L43: .data 727, -108, -225, -482
+L44: .string "cjjirldlyyx"
+not L18
+
+not *r6
+L45: red L31
+clr r4
+not L33
+L46: clr L7
+add r6, r3
+L47: .string "xty"
+sub r6, *r1
+sub #69, L47
+L48: clr L7
+not L23
+L49: mov L6, L47
+rts
+L50: jsr L4
+lea L48, *r3
+inc L23
+L51: not L34
+L52: .data -592, -450, 875, -377, -840
+clr r0
+L53: .data -544, -660, -950, -850, -212, 963
+dec r3
+dec *r7
+L54: bne *r6
+; comment
+jsr L13
+; comment
+stop
+L55: red *r6
+L56: bne L6
+jsr L46
+bne L46
+lea L32, L53
+lea L51, *r3
+jmp L53
+add #-102, r3
+inc *r7
+; comment
+dec L36
+bne *r4
+L57: red *r2
+L58: .data -732, 965, -776, 886
+lea L32, *r0
+jsr *r2
+sub *r6, r7
+mov #145, L22
+sub #-172, r3
+L59: jmp L21
+L60: cmp *r6, *r3
+L61: stop
+L62: inc *r1
+jsr *r6
+dec r2
+mov r6, *r0
+prn *r1
+jmp L38
+jsr L14
+; comment
+L63: not r2
+mov *r7, L41
+not L27
+jmp *r3
+inc r1
+stop
+L64: dec L23
+L65: dec *r6
+; comment
+mov #142, r4
+dec L51
+L66: jmp L0
+add *r5, *r3
+jmp *r3
+L67: clr *r5
+mov r7, L57
+prn *r2
+not *r6
+L68: .string "oseeyejlnax"
+mov *r3, L40
+red L30
+clr r0
+L69: .string "nkjm"
+; comment
+stop
+prn r5
+dec *r3
+jmp *r5
+L70: add r4, *r7
+inc L52
+sub *r0, L34
+bne *r2
+L71: mov L4, *r0
+L72: bne L47
+L73: jmp *r3
+jmp *r6
+jsr *r7
+rts
+mov L8, L30
+jmp L72
+sub #-224, *r5
+red r5
+jsr L34
+sub L53, L36
+L74: jmp L68
+dec L58
+stop
+clr r1
+stop
+L75: .string "lrzppmcpckxjwrzrlqmsjwn"
+L76: .data 557, 475, 63, 866, 544
+; comment
+rts
+add L22, L0
+L77: .string "ahvsinqarydlsyuwjdtxvhfb"
+L78: .data 845, -196, -814, -289, -165, 652, 511
+add *r5, *r2
+red *r2
+L79: .data -11, 530, 2, -163, -77, -947, -775
+inc *r0
+rts
+L80: rts
+sub r3, L52
+red *r0
+bne L17
+L81: jsr *r7
+cmp *r3, *r4
+L82: .string "zcsovyyuhqkgistot"
+L83: clr *r5
+red *r7
+inc r7
+red r3
+clr r2
+mov r6, *r0
+L84: inc L32
+sub #-133, r3
+L85: jmp *r3
+L86: .data 413, -802, 646, 860, 356
+jmp L3
+inc L44
+stop
+rts
+rts
+not L39
+add L1, L63
+clr L78
+L87: add *r6, *r2
+red r6
+; comment
+jsr *r6
+inc *r1
+cmp L85, *r6
+L88: cmp r6, r3
+inc L7
+jmp *r1
+prn L39
+bne L56
+clr *r4
+jsr *r1
+prn r2
+clr r2
+stop
+
+dec r2
+lea L49, r6
+
+rts
+prn r0
+L89: .string "aloyqocloisafiea"
+rts
+rts
+not *r2
+prn L12
+dec *r6
+stop
+L90: .data 361, -232, 185, -979, 588, 225
+rts
+L91: lea L58, r7
+dec L85
+L92: mov #130, r5
+L93: rts
+sub #-19, r6
+dec r4
+cmp r1, #194
+L94: jmp *r5
+red *r7
+L95: .string "ybzsykyxaau"
+clr r4
+jsr *r7
+clr *r6
+cmp r7, L20
+L96: jsr L36
+clr L85
+L97: lea L13, L3
+L98: .data 250, -31, -867, 700, -580, -944
+L99: inc L55
+not *r1
+jsr *r1
+jmp *r0
+L100: mov *r4, *r7
+; comment
+cmp r4, #-10
+L101: clr L70
+inc r0
+L102: .data 744, -979
+dec r7
+cmp r0, #38
+prn *r6
+inc *r4
+sub r2, r3
+rts
+L103: .string "iidksppalmneeu"
+rts
+L104: jmp *r4
+bne L19
+L105: bne L81
+L106: add *r6, r2
+not L87
+mov #143, L68
+sub L104, L85
+L107: red *r6
+
+clr L1
+jsr L74
+jsr *r5
+
+sub #114, r4
+L108: jsr L65
+prn #-200
+L109: .string "lmuneycufpuybyxfmpry"
+L110: .data -291, -851, 8, -183, -144, 582, -259, 126
+not r7
+L111: lea L15, L92
+sub r3, r7
+L112: sub #-179, L45
+bne L77
+rts
+dec L71
+prn #192
+stop
+jsr *r5
+cmp L112, *r6
+L113: .string "rispgaokm"
+L114: .string "xff"
+L115: mov r4, L55
+lea L86, *r6
+L116: bne L116
+L117: .string "hdecxg"
+jsr L75
+rts
+L118: dec *r4
+L119: add L69, r2
+clr L113
+jmp L79
+L120: rts
+L121: .string "hpxnolmc"
+not *r3
+red *r4
+jmp *r7
+
+rts
+inc r1
+L122: .data 610
+add #142, L57
+L123: .data -577, 300, -720, -362, -675, 800, -27
+red *r3
+sub *r6, *r6
+L124: stop
+L125: .data 463, 845, -305, -616, -282, 643
+cmp r2, *r2
+mov L38, *r7
+bne *r7
+not L18
+add L110, *r1
+bne L116
+bne *r3
+L126: mov r2, L118
+
+dec r5
+; comment
+L127: .data 269, 973, 278, 8, 67, 625
+jmp L3
+L128: prn L19
+prn #-11
+jsr *r3
+stop
+not *r5
+lea L35, *r4
+inc *r3
+prn L17
+sub L81, L65
+L129: prn #102
+L130: not L86
+L131: sub L117, *r0
+red r2
+L132: .data 869
+red L32
+bne L71
+L133: rts
+mov *r4, *r5
+L134: red *r1
+L135: inc r4
+bne *r0
+L136: .data -844, 205, 437, -158, -62, -280
+jmp *r2
+L137: jmp L61
+jmp *r2
+clr *r2
+red *r0
+
+L138: red *r3
+L139: jmp L107
+jsr L36
+jsr *r1
+L140: mov #-128, *r7
+clr L69
+red *r1
+L141: .data 558, 378, -761, 901
+L142: jmp *r0
+L143: cmp *r1, L19
+clr *r4
+L144: .data -90, -279, -148, 936, -74, 335, 301, -113
+rts
+
+sub *r0, L6
+; comment
+L145: rts
+L146: jsr *r5
+L147: bne L100
+not *r0
+L148: jmp L25
+dec *r4
+L149: bne L127
+L150: bne *r7
+clr r3
+sub r4, r2
+L151: inc L89
+jsr *r4
+jsr L50
+sub *r1, *r0
+mov *r0, L123
+add #234, r5
+bne L138
+L152: jmp *r4
+L153: .data 898, -789, -862, 721
+L154: not L114
+mov *r1, L86
+dec *r7
+L155: rts
+L156: prn L35
+L157: jsr *r4
+jsr L18
+L158: .string "ucqhhablpjfikyo"
+rts
+rts
+L159: mov r5, r6
+jsr *r6
+L160: .data 785, -796, -547, 383, 394
+stop
+rts
+L161: clr r1
+L162: .data -636, 324, 800, 856, -537, 817, -192, -145
+L163: jsr L152
+bne *r2
+add L115, r3
+L164: .string "mvfcypdrwgmjs"
+cmp r4, L109
+jmp *r6
+sub #-44, L135
+L165: red *r2
+L166: cmp r1, #-117
+bne *r2
+cmp L49, #-40
+L167: rts
+stop
+L168: red L77
+L169: bne L55
+L170: bne *r5
+L171: prn L105
+L172: bne L106
+add #142, *r5
+dec *r5
+L173: stop
+inc r7
+jsr *r4
+L174: cmp #203, L130
+lea L124, r5
+L175: .string "zx"
+red *r0
+rts
+sub *r2, *r2
+
+lea L6, L166
+L176: jsr *r2
+L177: clr L60
+L178: .data -747
+dec *r2
+red r6
+inc L127
+stop
+jmp L17
+dec L150
+rts
+inc L114
+L179: rts
+L180: red L101
+add r5, *r7
+inc r5
+clr L180
+rts
+lea L93, r6
+sub L115, r3
+mov #183, *r5
+L181: red *r0
+jmp L63
+L182: .string "whtay"
+red r0
+L183: jmp *r6
+L184: add #-188, *r7
+stop
+cmp L169, #-100
+red r3
+red *r0
+rts
+; comment
+jmp L180
+bne L126
+L185: stop
+jsr *r5
+sub L157, *r1
+mov L57, *r3
+mov L134, L123
+L186: rts
+L187: .data 964
+stop
+not *r3
+L188: jsr L46
+clr *r0
+; comment
+red *r7
+red *r2
+L189: clr r5
+L190: stop
+bne *r5
+dec r1
+L191: lea L86, L3
+dec *r1
+inc L114
+L192: jmp *r6
+lea L116, *r5
+lea L157, L134
+jsr *r2
+; comment
+L193: .data 432, -71, 437
+mov r2, L29
+L194: not r5
+L195: .string "qdklismzyccqmefmoz"
+L196: dec *r3
+jsr *r7
+mov *r1, *r2
+L197: prn r0
+L198: .string "dclhcu"
+L199: .data 31, 946
+not r3
+sub #124, *r3
+bne L99
+rts
+prn L107
+cmp L97, L49
+stop
+cmp r2, *r2
+dec L56
+; comment
+L200: .data 482, 523, -92, 475, -22, -108, -258
+not L184
+inc r5
+not L156
+add #231, *r4
+not *r2
+L201: sub L174, *r5
+jmp L100
+red L189
+inc *r1
+mov L29, L9
+L202: sub L60, L180
+lea L106, *r7
+; comment
+inc r6
+dec r6
+L203: lea L117, r5
+bne L44
+L204: .string "hvscbzxgyqfqv"
+inc L89
+red r0
+not *r3
+; comment
+lea L78, r6
+mov *r5, r7
+bne L151
+not L116
+L205: add L3, L175
+prn *r6
+cmp *r2, r4
+rts
+jmp L115
+prn #105
+L206: .string "cstlowybumknynozmyqt"
+mov #187, L48
+sub *r4, L202
+dec L131
+L207: clr *r6
+jmp *r2
+red r2
+jmp *r2
+bne *r1
+L208: inc *r2
+jmp L189
+inc L196
+L209: lea L163, *r4
+L210: sub #124, *r3
+cmp *r0, *r1
+L211: cmp L106, L102
+add #-42, r3
+not *r7
+cmp *r4, r7
+lea L204, L177
+mov L172, L76
+sub L17, L94
+stop
+L212: add L35, r6
+L213: rts
+cmp L63, *r5
+L214: rts
+L215: .data -633, -447, 884, -706, 358, 150, 176
+L216: bne *r1
+L217: .string "tnrteuvxmhsupjbs"
+jmp *r4
+stop
+
+inc L196
+L218: lea L164, *r4
+inc r4
+red r0
+L219: .data -544, -748, -643, 898
+prn #122
+jmp L170
+; comment
+inc r4
+prn *r0
+L220: .data 344, 614
+not r5
+rts
+L221: .data -916, 824, 892, -349, -796
+L222: jmp *r4
+L223: lea L135, r2
+jmp L76
+rts
+stop
+stop
+L224: mov *r0, L130
+L225: clr L93
+L226: jmp L28
+jsr L222
+sub L103, r4
+; comment
+L227: red r2
+L228: stop
+jmp *r2
+L229: mov *r1, L80
+not r2
+L230: prn L116
+stop
+L231: .string "ceo"
+red *r5
+prn r0
+L232: .string "aqebbhsfkjvggbhtgygnbmfx"
+L233: dec r6
+not r1
+; comment
+L234: mov r4, *r5
+L235: mov #-79, *r6
+L236: bne *r5
+mov #-192, L212
+L237: .string "ty"
+L238: dec *r2
+L239: jmp *r1
+prn *r2
+add *r2, r0
+stop
+jsr *r2
+L240: stop
+rts
+add *r0, r2
+bne L71
+stop
+lea L238, *r4
+jsr *r6
+L241: .string "vhoahtvgkyrnsmmypzm"
+L242: .string "ul"
+
+jsr L90
+mov #-34, *r5
+prn #-88
+jmp L180
+cmp #-130, r7
+L243: .data 767, 412, 18, -672
+L244: .data -307, -663, -364, -690, -148, 209, -78
+prn *r3
+L245: stop
+clr *r7
+L246: cmp r1, *r6
+L247: prn r1
+L248: cmp #-79, L173
+sub #-130, r0
+jmp *r1
+not L114
+rts
+L249: rts
+clr r3
+L250: stop
+inc L227
+bne L119
+inc L112
+sub r1, *r5
+L251: jmp *r7
+inc L53
+dec L200
+L252: .string "ldzickgailj"
+; comment
+prn L79
+not *r2
+L253: jsr *r6
+
+jsr L140
+inc L80
+sub L38, *r2
+L254: jmp L226
+add #231, *r7
+rts
+L255: clr r5
+dec *r3
+L256: stop
+L257: red L65
+mov r2, L104
+dec r4
+jmp L125
+cmp #-161, #-140
+L258: lea L98, *r4
+clr *r0
+L259: add *r7, L23
+L260: jsr *r2
+inc r1
+L261: jmp L23
+L262: dec L213
+add r7, *r7
+not L128
+add r7, r2
+stop
+L263: inc L222
+L264: rts
+clr L43
+L265: .data -28
+L266: mov #-101, *r4
+lea L251, *r4
+cmp *r2, r0
+L267: .string "y"
+L268: clr r7
+add *r5, r4
+L269: clr r6
+L270: clr r3
+mov L233, *r4
+rts
+L271: mov L233, L84
+L272: inc *r2
+not r3
+rts
+L273: .data -169, 607, -573, -53
+stop
+mov *r2, *r5
+cmp L263, #200
+jsr *r3
+inc *r2
+mov *r1, L189
+cmp *r7, *r7
+sub L244, *r5
+L274: jmp *r6
+L275: .string "gworfbaidskk"
+inc r6
+L276: jsr L115
+inc L36
+red r3
+
+L277: jmp *r3
+L278: .data 633, -618, 711, -79, -561, 240, 175
+inc *r5
+dec r3
+L279: .data 49, -998, 971, 508, -558, -972, 587, -773
+L280: .string "shsdnpxtscultxosapzpnw"
+jmp *r2
+sub *r2, *r7
+L281: bne *r3
+add *r3, *r5
+L282: cmp r4, *r1
+L283: lea L43, L32
+stop
+clr *r1
+L284: red L212
+L285: rts
+L286: bne L231
+cmp #166, *r4
+cmp L257, r1
+lea L65, *r7
+L287: clr L165
+; comment
+dec r1
+
+inc r0
+add #109, r0
+cmp L75, L117
+L288: mov r2, L176
+dec *r2
+L289: mov r0, r5
+L290: .data -563, 933, -427, -407
+inc *r6
+red *r7
+lea L16, r0
+L291: clr L192
+; comment
+L292: add *r3, L216
+L293: .data 240, 745, -285, -94, 869, 282
+stop
+; comment
+jmp L173
+L294: bne L143
+; comment
+mov #-220, r0
+mov L84, *r7
+bne *r6
+lea L233, *r6
+clr L1
+lea L27, r2
+jsr L96
+L295: .string "vwdzinuviuvwbok"
+L296: dec *r3
+; comment
+L297: sub L63, r5
+dec L214
+cmp #136, #191
+bne *r3
+not *r3
+rts
+clr L55
+; comment
+L298: .data -206, -52, -159, -154
+inc *r3
+L299: .data -673, 631
+clr *r5
+prn *r7
+L300: add #-208, *r0
+L301: prn L64
+add *r2, L295
+L302: jsr L250
+cmp #-244, *r4
+bne *r5
+cmp #62, #92
+L303: mov L101, L119
+L304: red L200
+not r3
+; comment
+jmp *r3
+not *r6
+sub *r2, *r6
+lea L48, L24
+L305: jmp *r2
+add #-198, *r4
+L306: prn L215
+clr r5
+L307: .data -391, -565, 749
+cmp #-208, L95
+prn #160
+stop
+L308: stop
+L309: clr *r0
+L310: add *r5, r1
+L311: cmp L34, *r5
+jmp *r0
+sub *r5, r6
+L312: .string "sn"
+jmp L304
+L313: add *r6, *r4
+L314: jmp *r0
+; comment
+rts
+lea L276, *r7
+L315: .data -477
+jsr *r5
+not r6
+L316: rts
+L317: cmp #-33, #150
+red *r5
+lea L133, *r6
+add *r1, r0
+L318: .data 486, -506, 248, 738
+not *r5
+jsr *r4
+L319: clr *r4
+lea L40, L18
+L320: lea L245, L151
+rts
+L321: clr r7
+L322: inc L156
+not L59
+prn *r0
+L323: clr L310
+L324: .data 455, 279, -162, 916, 54, -606, -590
+cmp #0, #149
+L325: cmp *r3, *r0
+L326: .string "nlnkpjqted"
+lea L266, *r5
+L327: add L324, r4
+add #-239, *r0
+; comment
+jsr L237
+rts
+red L24
+jsr *r1
+
+clr *r7
+stop
+jmp *r3
+L328: .data -480, -772
+L329: add #-4, r7
+inc *r5
+L330: stop
+L331: stop
+not *r7
+L332: .data -986, 148, -675, -986, 453, -762
+lea L287, L207
+L333: .data -986, 354
+L334: cmp *r6, r3
+lea L131, r1
+prn r2
+L335: stop
+jsr *r6
+stop
+L336: .data 488, 58
+bne L219
+L337: .data -991, 153, -845, 908
+inc *r0
+L338: stop
+cmp r7, L287
+L339: .data -10, -421
+lea L16, *r0
+stop
+; comment
+L340: dec r0
+L341: sub #121, L198
+L342: inc *r1
+stop
+stop
@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 57
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+bne *r0
+add r1, r4
+lea L253, r1
+L0: rts
+L1: cmp *r5, L1
+mov *r5, *r2
+sub L1, r2
+L2: add *r6, L1
+sub r2, r4
+rts
+L3: bne *r4
+L4: not *r7
+lea L2, *r6
+clr L3
+dec r7
+red L3
+L5: mov #-226, r1
+L6: stop
+L7: jsr *r6
+lea L3, L5
+cmp #232, L1
+add r7, L7
+jmp *r0
+mov r7, L2
+add r3, *r6
+L8: .string "wjyampbnmwzzdgs"
+L9: red r1
+jsr *r5
+L10: clr L7
+bne L7
+prn *r5
+L11: red r7
+stop
+L12: mov #204, L5
+bne *r2
+red L1
+clr r5
+L13: stop
+L14: cmp *r7, #-34
+L15: cmp #-185, L14
+jsr *r4
+
+L16: clr *r3
+L17: mov #2, r6
+jsr L0
+cmp r0, r7
+L18: lea L7, L15
+L19: not *r0
+not L3
+prn r4
+L20: cmp *r3, #103
+stop
+jmp *r1
+L21: rts
+rts
+L22: sub r5, r3
+red L11
+bne L10
+dec L21
+stop
+L23: .string "dcixndmhadhclbavn"
+clr *r2
+L24: .string "qccw"
+L25: lea L10, L1
+L26: .string "tmxdnsnrbkbz"
+L27: prn L8
+rts
+L28: .string "gojqqcedp"
+mov #204, r3
+jmp L24
+L29: rts
+L30: .data -489, 138, 635, -876, -82, -189, -613, -239
+L31: bne *r2
+L32: stop
+jmp *r2
+L33: clr r0
+L34: add #-101, r1
+L35: jsr *r1
+mov #245, r4
+dec *r1
+lea L25, r1
+L36: .data 481, -850, -15, 532
+cmp r5, L34
+L37: stop
+L38: jmp L7
+L39: cmp r7, L15
+inc *r3
+L40: bne L2
+dec *r0
+inc r4
+sub *r3, L30
+L41: clr L14
+L42: add #-218, L14
+prn *r4
+L43: clr r5
+sub *r0, r2
+L44: jsr L33
+add L30, r2
+lea L14, r3
+L45: .data -879, 156, -421, -1, -354, 323, -413
+L46: .string "cbfyrimdclhfdw"
+red r7
+stop
+not r2
+L47: jmp *r4
+not *r4
+L48: not r3
+L49: .data -97
+L50: stop
+L51: prn L13
+jsr L27
+clr L33
+L52: stop
+; comment
+clr *r3
+jmp *r7
+L53: mov r2, *r0
+red r0
+L54: .string "njymuvcuqky"
+inc *r5
+; comment
+jmp *r2
+jmp *r6
+L55: .data -174, -877, 775, 885, 504, -404, -189
+L56: sub #211, *r7
+L57: .data -475, 636, 93, 984
+add #186, r0
+L58: cmp #-95, r5
+stop
+jsr *r1
+L59: stop
+add *r7, L7
+cmp L44, *r0
+L60: not *r6
+not r2
+mov #-157, L1
+L61: sub #-225, r7
+clr L34
+add L46, *r6
+jmp *r3
+L62: red r7
+cmp L54, *r2
+stop
+cmp #-222, L17
+jsr L61
+bne L53
+
+inc r5
+jsr *r2
+mov *r0, *r0
+L63: lea L12, *r7
+prn r6
+not r5
+L64: red r2
+L65: jsr *r3
+L66: dec L55
+L67: mov L36, *r2
+L68: .data 854, 111, -819, 729, 842, -920, -521, -479
+red r5
+; comment
+L69: sub *r5, L57
+cmp *r4, r6
+L70: .string "swcrmfsevygmkpy"
+jmp *r2
+L71: .data 77, -812, -944, 505, 87, 763
+; comment
+jsr *r2
+dec *r2
+sub L58, *r4
+rts
+L72: .string "zcqlndiqhaagm"
+L73: red L49
+rts
+prn #243
+red r0
+jmp *r7
+dec L13
+; comment
+L74: .data 397, 901, -308, 178, -148, -617, 365, 765
+L75: add #58, L64
+add #152, *r2
+add r7, L2
+mov r4, *r1
+bne L17
+clr L71
+clr *r6
+L76: mov *r0, L62
+L77: .string "xplurni"
+L78: red r0
+L79: cmp #-197, #125
+; comment
+clr *r5
+red L36
+L80: .string "raaaex"
+L81: .string "bosgpecnouxot"
+rts
+L82: mov L0, L40
+L83: .data 691, -794, -59, 565, 260, -302
+lea L54, *r7
+jmp *r4
+add L11, *r0
+L84: bne L34
+jmp L25
+red r5
+L85: prn L19
+clr L48
+sub #-208, L83
+L86: not L72
+
+mov L66, L33
+prn *r6
+not r3
+L87: .data -788, 378, 415, 773, 912, 691, 495
+prn L62
+L88: .data 926
+cmp *r3, L67
+dec r2
+L89: mov r5, L35
+rts
+bne L52
+inc *r3
+cmp #-131, *r2
+L90: prn *r0
+cmp *r6, L88
+L91: clr *r5
+prn *r5
+L92: dec *r4
+not *r2
+L93: not L60
+prn L49
+jsr *r7
+clr L8
+L94: jmp *r1
+L95: prn #-18
+jsr *r0
+jsr L25
+L96: .string "slszbkrazdvlcuccqzqz"
+lea L36, r2
+jsr L40
+jmp L55
+L97: sub #202, L2
+dec L90
+not *r7
+L98: dec r7
+lea L27, r0
+clr L98
+red L26
+jmp *r7
+clr *r0
+L99: inc r0
+bne *r7
+L100: .data 92, -629, 309, -602, -234, -903
+
+L101: .string "lgqqb"
+
+lea L82, *r5
+add L30, *r7
+L102: inc *r1
+not r5
+L103: rts
+L104: clr r2
+cmp L103, r2
+stop
+L105: .data -338, 963, 197, -572, 514, -889
+L106: .string "rouhnlongzhogcqqxswhe"
+bne *r4
+inc L106
+L107: .data 426, 983
+cmp r3, *r2
+stop
+dec *r4
+
+rts
+; comment
+add r0, r3
+; comment
+L108: .data -95, -866, 491
+not L73
+mov L98, *r1
+L109: red L11
+cmp r5, L81
+sub #88, L49
+lea L39, L107
+red L25
+L110: prn r3
+dec L72
+L111: jmp *r5
+L112: stop
+L113: bne *r2
+L114: .data -835, -948, -995, -5, 331, -421, -151, -997
+mov r0, r4
+red L67
+L115: dec r7
+L116: inc L50
+dec L74
+rts
+not *r5
+add r1, r2
+not L41
+L117: dec r7
+mov L42, r7
+jsr *r5
+L118: .data 512
+L119: stop
+cmp r6, *r4
+dec L48
+rts
+L120: mov #226, L65
+L121: red r0
+red *r4
+L122: cmp L19, #-159
+L123: stop
+add L100, r7
+rts
+inc L16
+L124: bne L91
+L125: clr *r6
+L126: inc *r2
+
+stop
+L127: dec *r2
+
+add #82, L127
+stop
+L128: stop
+L129: add L105, L57
+not r6
+L130: inc *r5
+lea L111, *r2
+stop
+dec L55
+red *r4
+red *r1
+lea L28, L116
+rts
+mov r0, *r5
+rts
+lea L54, *r6
+
+clr r2
+jsr L81
+sub L10, r0
+L131: red L52
+L132: sub r1, L25
+L133: .data 946
+L134: bne L26
+add L73, r2
+red *r0
+dec *r6
+rts
+clr L105
+dec *r5
+stop
+
+clr L30
+inc r6
+prn r3
+jsr L111
+L135: .string "vflzqerqmpg"
+L136: clr r0
+bne L93
+jmp L87
+L137: jsr *r5
+jmp *r5
+L138: .data 630, -909, -477
+inc r3
+stop
+L139: clr L119
+L140: mov r6, r7
+add L10, *r0
+mov #226, r1
+cmp *r2, *r0
+rts
+jmp L118
+; comment
+prn L16
+not L136
+L141: not L64
+L142: stop
+L143: not L117
+red r0
+L144: bne L114
+L145: cmp #-214, L135
+
+L146: stop
+red L39
+mov r7, L10
+sub L120, *r3
+cmp #-217, L53
+; comment
+; comment
+red *r4
+L147: lea L35, *r7
+L148: red r7
+L149: bne L140
+L150: .string "zzkbbpeqoxtmbqsmey"
+not L149
+
+prn #-188
+rts
+L151: .data 664, -916, 345, 242
+; comment
+L152: cmp L84, r4
+clr L102
+stop
+red L66
+dec *r4
+prn #-234
+add *r3, L78
+add r2, *r0
+L153: jmp *r6
+
+L154: jsr L126
+rts
+L155: inc *r5
+cmp *r3, #-134
+L156: stop
+L157: not L133
+inc r2
+L158: dec L143
+add *r4, r0
+L159: add #-51, *r6
+lea L115, L92
+rts
+cmp *r4, #-60
+dec r4
+mov #-46, L69
+inc *r1
+L160: mov r6, *r3
+L161: inc r1
+add r0, L133
+dec *r0
+clr L34
+L162: .data 781, 680, 454, -183, -804
+stop
+L163: add r7, L141
+L164: lea L120, *r0
+cmp r1, L97
+prn *r7
+clr r7
+L165: bne L123
+stop
+red r5
+L166: .string "yvdawlzrpogzswh"
+prn r4
+not L75
+L167: mov L110, L79
+stop
+stop
+L168: .data -126, -606, 599, -928, 98, 510
+L169: rts
+L170: jmp *r6
+sub *r6, L167
+lea L13, *r1
+L171: .string "toghl"
+
+dec r2
+; comment
+L172: sub L100, r3
+mov #199, L139
+lea L110, *r4
+lea L102, *r1
+L173: inc L86
+L174: cmp L90, #197
+red *r1
+lea L37, r3
+L175: .string "xnerjrycxbhhdymnrbazupp"
+stop
+jmp *r3
+rts
+not r0
+inc *r5
+
+
+mov *r1, L46
+L176: red r0
+prn *r3
+L177: .data 223, 781, -956, -944, -670, 819, -852, -640
+L178: .data 126, -128, 91, 854, -127
+L179: mov r3, *r1
+L180: add *r2, L150
+
+L181: .string "x"
+clr *r0
+L182: inc L158
+bne L123
+stop
+inc r3
+jmp *r1
+lea L10, r6
+L183: .string "fcp"
+L184: clr *r5
+mov r0, L50
+add r5, *r7
+jsr L124
+L185: jmp L62
+sub r6, L45
+L186: .string "tuzysyujahpbx"
+sub r5, *r2
+jmp *r3
+L187: jsr *r6
+clr *r1
+clr L57
+add *r7, L117
+jsr *r2
+inc L3
+L188: prn L144
+L189: lea L67, L126
+
+cmp L48, *r1
+L190: stop
+lea L128, *r2
+clr L160
+prn #143
+sub *r0, L103
+lea L145, r0
+clr L146
+not r0
+bne L146
+L191: clr L141
+sub r3, r0
+
+add *r1, r4
+mov L117, r4
+red L7
+L192: cmp L143, r1
+L193: mov L106, *r4
+prn r3
+L194: clr r5
+mov L144, L23
+jmp L102
+jsr L26
+L195: inc L88
+red L101
+L196: prn r5
+
+L197: inc L156
+prn r2
+stop
+jmp L76
+add r2, L28
+L198: dec L138
+bne L163
+L199: stop
+; comment
+clr L101
+; comment
+prn r4
+jmp *r4
+L200: jmp L20
+jsr L43
+red L49
+prn #188
+not *r5
+dec r6
+inc r2
+cmp r1, r5
+; comment
+L201: sub *r7, *r7
+red *r4
+L202: stop
+inc r0
+inc L16
+rts
+mov #70, L95
+L203: inc L95
+L204: red L34
+L205: not L82
+L206: rts
+L207: add #-97, r0
+L208: .data -635, 878, -238, -945, 723, -303, 530
+L209: .data -48, 21, -959, 899
+L210: lea L115, L187
+stop
+add L116, *r6
+stop
+L211: rts
+prn L3
+rts
+rts
+jsr L143
+; comment
+stop
+dec *r1
+inc *r0
+stop
+stop
+sub L98, r3
+stop
+add r1, r5
+bne L130
+inc *r5
+clr *r1
+L212: .data -929, -883, -374, 214, 72, -912, 688, 270
+dec r3
+
+jmp *r7
+
+jmp L7
+L213: .string "gjsaqameouae"
+L214: stop
+jsr *r2
+dec L14
+red *r4
+L215: inc *r4
+lea L164, r7
+bne *r0
+L216: add #62, r4
+mov r1, *r6
+; comment
+lea L50, L82
+not *r0
+red L188
+inc L214
+lea L18, L191
+prn #119
+dec *r1
+clr r6
+bne *r1
+L217: jmp L209
+L218: lea L100, *r7
+L219: jsr L9
+inc L116
+L220: .data -851, -388, 729, 979, -23, -479
+red L95
+add *r3, r0
+prn L75
+mov #-32, L174
+not L63
+
+
+L221: .string "titiefs"
+L222: rts
+L223: jmp *r7
+jmp L13
+cmp L127, r1
+L224: .string "zriubkxqsdq"
+stop
+jsr L203
+L225: bne *r5
+not *r2
+L226: .data 864, -566, 626, -725, -353, -302
+; comment
+jsr *r0
+lea L223, r3
+lea L215, L211
+jmp *r5
+L227: .string "ljxsqpuvvslrew"
+add #-161, L149
+L228: not *r3
+L229: dec r6
+L230: prn #-45
+not r4
+cmp *r7, L46
+clr L203
+add r2, r4
+L231: clr r0
+add #-102, *r0
+L232: .data -871, 767, 822
+sub #-95, r1
+L233: clr *r4
+red r6
+clr r6
+lea L45, L206
+L234: mov L167, r0
+add r4, *r2
+L235: cmp r7, #-202
+not r1
+rts
+mov r5, r4
+L236: mov #-50, r7
+lea L177, L123
+lea L33, L39
+L237: .string "rtzgg"
+jmp L124
+L238: cmp #-206, *r2
+inc r0
+not r2
+not r1
+jsr *r6
+bne *r7
+bne L75
+not r5
+mov L3, L78
+not *r5
+not r1
+prn L110
+; comment
+L239: prn L230
+L240: .string "wuiyclnqdcatscppkyvawiku"
+clr *r4
+stop
+red *r3
+red *r2
+not r3
+L241: red L182
+inc L25
+add #95, r0
+lea L62, r2
+mov #73, r5
+L242: jsr L36
+prn #150
+L243: clr *r7
+rts
+L244: .string "anwvubjcirw"
+L245: red r0
+inc r0
+red r3
+red *r6
+bne L205
+not L184
+cmp *r7, *r2
+jmp L142
+L246: .data 470, -33, 544
+; comment
+dec *r5
+L247: jsr *r0
+jmp *r3
+L248: .string "veqxxpimndywdiskgott"
+L249: inc *r3
+clr *r6
+red L188
+dec *r6
+stop
+dec r3
+stop
+L250: .string "u"
+jsr L161
+inc r3
+inc r0
+L251: not r6
+mov *r3, *r0
+L252: .data -279, -166
+L253: .string "yfs"
+red *r1
+L254: .data 612
+lea L52, *r1
+sub *r4, *r2
+rts
+lea L194, r2
+L255: .data 953, -385, -317, 905, -159, -865, 59
+lea L169, r2
+bne L112
+bne *r6
+L256: .data 13, 838, -616, -438, -315, -985
+L257: .string "wzchpup"
+lea L112, L45
+not *r5
+lea L230, r7
+L258: sub #-79, *r6
+jsr L125
+L259: rts
+dec r4
+jsr *r7
+inc L82
+clr *r3
+dec r3
+cmp L81, *r7
+L260: .data -70, 592, 995
+cmp #-211, #-189
+L261: clr *r7
+clr r5
+L262: .data -944, 984, 828, -786, 883
+not *r7
+L263: jsr L52
+stop
+prn #138
+L264: cmp *r2, #243
+inc r2
+clr r7
+red *r2
+L265: mov L70, r5
+jmp L124
+; comment
+dec r1
+dec L184
+lea L245, L184
+bne *r2
+inc *r0
+bne *r0
+L266: not r3
+L267: cmp r4, r0
+jsr *r3
+not L259
+lea L53, *r4
+L268: .string "dhvsr"
+L269: mov #217, *r3
+red r5
+L270: jsr L9
+red L197
+L271: .string "aetqfrbeua"
+bne *r6
+lea L262, L86
+rts
+lea L222, r2
+jsr *r0
+sub r0, L94
+sub r2, L198
+add #-154, L165
+not L264
+mov r1, *r2
+sub L123, r7
+jsr L54
+jsr *r5
+rts
+L272: rts
+inc r1
+dec r7
+
+jsr L161
+L273: add r2, *r3
+stop
+dec *r6
+L274: .data 683, 243, 804, -656, 865, -582, -441
+L275: clr *r1
+L276: prn r2
+bne L210
+L277: .string "jexizkwwgnuhp"
+L278: cmp L158, #-175
+dec *r4
+cmp *r6, L2
+jsr L141
+L279: clr r6
+stop
+L280: inc L152
+L281: stop
+red r4
+dec L21
+; comment
+mov *r7, L249
+L282: rts
+L283: .string "gftdtzrlxjagcgl"
+red r7
+inc r7
+sub r6, r7
+L284: jsr L37
+dec *r6
+stop
+add #82, L87
+L285: .data 566, -930, -970, 380
+jsr L146
+sub #171, L79
+not *r5
+L286: .string "treqncogcgeibjk"
+jsr L123
+jmp L224
+L287: add r5, *r7
+L288: cmp *r3, r7
+sub *r1, r7
+stop
+L289: .data -460, -377, 777, -150, -377
+inc *r0
+L290: dec L267
+jsr *r7
+jsr L147
+mov *r0, *r7
+clr *r7
+mov r2, r7
+bne L20
+cmp L162, *r7
+L291: .data -257, -795, 421
+rts
+prn #179
+cmp *r5, L227
+red r4
+not *r5
+mov r3, r3
+dec L106
+L292: rts
+; comment
+L293: not *r0
+L294: inc r0
+dec r3
+lea L125, *r6
+clr *r0
+stop
+dec *r5
+lea L184, r5
+L295: lea L31, L173
+L296: bne L60
+sub r2, *r2
+mov r7, *r6
+L297: prn r5
+clr *r2
+not *r2
+bne L256
+bne *r0
+L298: jsr L214
+; comment
+sub *r7, L208
+cmp L167, #-254
+not *r4
+
+L299: .data -353, -572
+mov #-97, L229
+cmp #-182, r0
+
+L300: lea L269, *r5
+jsr L74
+L301: sub r6, *r2
+L302: .string "k"
+sub *r1, r2
+add r6, *r6
+jsr *r2
+L303: not r3
+L304: .string "uvmlndakb"
+clr *r2
+lea L243, L193
+
+dec L193
+; comment
+L305: mov L209, r2
+prn L286
+not L32
+L306: dec *r2
+L307: .string "coufc"
+L308: sub #-214, r2
+cmp L286, *r0
+jsr L103
+bne *r5
+L309: .string "peldm"
+L310: red *r1
+L311: dec *r5
+jmp *r5
+L312: dec r2
+cmp *r6, #-131
+L313: jsr L244
+red r5
+mov r5, *r0
+inc *r5
+inc *r4
+red *r2
+L314: add *r7, *r1
+rts
+lea L246, L152
+not L34
+lea L131, *r2
+rts
+rts
+prn L13
+clr *r6
+L315: stop
+jsr L33
+L316: inc *r7
+L317: .string "bwcyj"
+L318: bne L83
+cmp r0, *r5
+inc r1
+bne *r6
+L319: lea L63, r5
+L320: cmp L110, *r2
+add r1, r6
+rts
+L321: .string "mwbou"
+inc r4
+L322: .data 322, 288, 86, 780
+L323: .string "rbaddwetvyvoxibjeyyl"
+L324: inc *r4
+L325: rts
+L326: lea L9, *r0
+L327: jmp *r5
+prn L158
+prn *r1
+L328: .data -98, 930
+L329: prn #9
+L330: red r6
+L331: .string "hyoonbdaxpaubgercafuxjkk"
+L332: not *r6
+
+sub *r3, L31
+inc L263
+inc L191
+L333: jmp L316
+L334: bne L333
+not *r3
+mov *r3, *r7
+L335: stop
+red L5
+L336: .data -747, 412, -616, 364, 366
+L337: .string "xpavskyx"
+jmp *r4
+add L148, r0
+not *r1
+add *r5, L167
+jsr *r2
+jmp *r0
+not *r5
+dec L65
+dec r5
+bne L24
+L338: jsr L146
+L339: stop
+L340: cmp #131, #203
+dec *r2
+L341: sub L163, r1
+stop
+L342: prn #207
+dec r6
+L343: add L79, r2
+add *r6, r2
+stop
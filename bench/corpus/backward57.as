@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 58
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+red r3
+L0: clr *r7
+rts
+rts
+mov #63, L0
+add #-151, L0
+L1: red r5
+red *r0
+L2: lea L1, *r4
+L3: rts
+bne *r5
+inc *r2
+L4: .data 651, -687, -72, 219, 797, -125
+L5: mov #-198, L1
+; comment
+bne *r0
+L6: dec *r0
+stop
+L7: jmp L6
+sub L1, r4
+L8: .data 652, -777, 729, 398, -888, -169
+clr r4
+lea L0, r4
+add #240, L0
+not L5
+mov *r1, *r1
+L9: jmp *r5
+prn #-149
+L10: .string "iujusrjhzopfxhcroc"
+jmp L0
+
+dec r1
+L11: bne L8
+dec *r6
+dec r4
+L12: .data -877, 954
+L13: red L11
+L14: .string "qpbuqyndpqrhiaqssr"
+not *r1
+add *r2, L0
+not r4
+stop
+cmp #209, *r4
+prn #-153
+L15: prn L0
+L16: rts
+dec *r3
+L17: bne *r4
+L18: mov *r4, r4
+rts
+red *r1
+inc r7
+L19: .string "bhxivoisoixyg"
+L20: dec L10
+; comment
+red L15
+lea L11, L13
+sub *r2, *r0
+dec L11
+L21: stop
+L22: mov L12, *r0
+sub #-109, L2
+L23: dec r1
+L24: dec *r6
+L25: .string "ljztxmfjdjkczxdx"
+L26: .string "xhacvlqijxdpwpyueb"
+L27: mov L26, *r6
+L28: stop
+jmp L17
+inc L27
+L29: not r4
+inc L28
+inc L12
+jsr L14
+add r2, r4
+not *r7
+L30: .data 455, -534, 931, 45, 54, 19, 973, 107
+bne *r6
+L31: red *r4
+not L25
+L32: bne L20
+not r2
+jsr *r2
+lea L4, L15
+red L32
+L33: sub #-105, r0
+cmp r7, L21
+L34: jsr L34
+lea L4, r7
+; comment
+jsr L23
+L35: inc *r4
+stop
+cmp r1, #9
+L36: .data 466, -57, -198, 81, 627, -166
+L37: .data -298, 187, 698, 423, -440, -446, -174, 707
+sub r4, r0
+L38: dec r1
+stop
+L39: bne *r4
+; comment
+L40: bne L24
+add *r4, *r2
+bne *r2
+L41: jmp *r3
+L42: jmp L24
+stop
+lea L28, L16
+add r2, *r3
+rts
+sub L19, r1
+bne L30
+L43: .data 800, -4, -988, -613
+not L26
+stop
+L44: stop
+L45: bne L45
+L46: jsr L15
+red r1
+bne L32
+rts
+lea L17, r0
+red *r6
+prn L10
+sub r6, *r0
+jmp *r2
+L47: red L39
+
+red L42
+L48: not *r1
+; comment
+prn L28
+L49: .data -442, 458, 215, 810, 577, -634
+bne L38
+lea L26, *r4
+L50: not *r6
+L51: .data 779, -50, 503
+mov #-196, r2
+mov *r7, L38
+L52: prn *r3
+lea L34, r0
+dec r2
+L53: jsr L38
+stop
+inc L13
+rts
+
+L54: .string "hamtmnvhfmarvgpwlbxil"
+bne L28
+add #188, *r0
+jsr *r0
+not r7
+jmp L24
+L55: red r1
+rts
+lea L48, r4
+L56: .string "xdszkmydssxynrnaiehovdw"
+red r0
+stop
+clr *r4
+L57: .string "nwxclwepgtdczrnpjvddbzc"
+stop
+L58: .data -125
+cmp L12, L51
+sub r5, *r7
+stop
+L59: .string "oulfokgcgpovys"
+L60: stop
+L61: sub *r3, L15
+not r3
+jsr *r6
+L62: rts
+bne L24
+rts
+not *r1
+jmp L39
+L63: inc *r1
+bne L26
+lea L45, *r3
+add r7, L60
+L64: .string "xmkargcfiggyry"
+jmp L54
+rts
+stop
+L65: jmp *r5
+red r7
+L66: lea L40, L52
+L67: clr L25
+L68: .data 582, 603, -990
+rts
+L69: lea L66, L6
+jsr *r7
+L70: not *r1
+rts
+; comment
+L71: .string "gtsklljxin"
+jmp L22
+sub #216, *r7
+L72: .data 468, -649, -283
+cmp L47, L32
+cmp r0, r6
+; comment
+L73: add L48, *r3
+L74: .data -792, 457, 391, -789, -694, 834, 134
+lea L33, L66
+L75: dec L22
+L76: sub L30, *r3
+mov r2, L58
+clr L8
+bne *r2
+L77: clr L12
+jsr *r4
+clr *r0
+jsr L42
+
+L78: jmp *r1
+dec r2
+L79: bne L53
+dec L58
+add L11, L34
+prn L49
+lea L24, r7
+clr r4
+L80: .data -112, -859, 597, -564, -761, 341, -39, -12
+L81: .data -535, 207, -332, -479, 138, 448, -114, -593
+not r3
+lea L42, r3
+mov #-241, L77
+sub #-147, r4
+cmp *r1, *r7
+; comment
+inc L9
+lea L64, *r1
+cmp L62, L1
+L82: clr r2
+L83: .data -148, -944, 940, 440, -250
+
+L84: inc r5
+L85: .data 484, 776
+inc r4
+sub #189, r5
+prn L1
+L86: .data -508, 890
+bne L50
+dec r5
+L87: bne L85
+L88: dec r1
+L89: stop
+red L27
+L90: red r6
+L91: .string "rnhsabercsujucimvgtnug"
+sub #-81, r1
+inc r5
+jmp *r1
+L92: .data -389, -805, 113, -766, -941, -871, -700, 226
+sub r3, L54
+sub #-5, *r0
+jmp L72
+cmp L14, L56
+L93: add *r5, r6
+L94: bne *r7
+L95: lea L83, L78
+L96: inc *r0
+jmp *r0
+mov L63, *r4
+sub r5, *r7
+mov r5, r7
+bne L92
+clr *r1
+cmp r2, #120
+L97: rts
+jmp *r3
+sub L47, r6
+L98: lea L88, *r3
+; comment
+L99: not r1
+L100: cmp #157, L2
+not r3
+cmp r4, r7
+L101: .data -145
+dec *r5
+add *r5, r4
+jmp L21
+red r0
+jmp L80
+L102: .string "kxrsjbqtylkfnfqtx"
+L103: stop
+inc *r3
+lea L2, r2
+L104: sub *r6, *r5
+rts
+L105: .data -727, 519, -315
+L106: .string "bhdbqdeljwxzhecwyaafc"
+jsr L92
+L107: mov r0, *r6
+red L83
+sub *r4, L93
+jsr L10
+inc L78
+red r5
+jsr *r4
+stop
+dec L74
+L108: sub r3, *r2
+L109: mov r7, *r5
+L110: .string "bssgtvfzdbiudjgvb"
+red r6
+not *r7
+jmp *r6
+
+jsr L51
+prn L107
+add L46, *r1
+not r4
+L111: jmp L44
+rts
+L112: prn *r7
+L113: .data 26, -674, 800
+L114: clr *r0
+L115: not L112
+cmp L99, r7
+L116: jmp L96
+L117: lea L94, L10
+mov #175, L89
+inc *r4
+clr *r3
+cmp r7, #62
+prn *r1
+clr r2
+jsr *r2
+stop
+add L92, L36
+L118: lea L103, r6
+add r0, *r2
+L119: add *r2, L116
+L120: rts
+L121: jsr *r1
+L122: prn #58
+lea L80, r3
+add *r1, r1
+clr L23
+inc r6
+L123: clr *r5
+
+stop
+L124: jmp *r6
+sub r0, *r0
+L125: .string "hlujbqjcbdi"
+stop
+clr L90
+L126: not *r2
+L127: .data -239, 493, -573, -950
+jsr L27
+mov *r2, *r4
+inc *r7
+dec r3
+rts
+add L110, r6
+dec L17
+L128: prn *r6
+jsr L18
+L129: not r4
+; comment
+L130: .string "dqmqkagoinoswbn"
+jmp L44
+sub L68, L24
+inc L80
+L131: mov L82, *r4
+L132: lea L77, r4
+not r0
+inc *r5
+cmp L102, *r3
+L133: cmp #-126, *r0
+inc r7
+red *r7
+clr r1
+L134: prn L103
+lea L1, r1
+dec L72
+
+L135: bne L96
+L136: .data -754, 992, -168
+jsr *r7
+L137: rts
+L138: sub L124, r3
+add L8, L110
+jmp *r1
+add L105, L36
+bne L70
+L139: .data 795, 947, -437
+lea L135, *r4
+jmp L113
+prn r4
+bne *r7
+stop
+sub L73, *r5
+L140: bne *r6
+add #186, L9
+not *r1
+not L73
+L141: bne L75
+add #-247, L38
+L142: clr L28
+stop
+red r4
+bne L135
+jsr *r1
+L143: .string "u"
+red *r7
+jsr *r1
+red *r6
+rts
+L144: .string "ri"
+dec L71
+L145: .string "svrqmz"
+add *r7, r3
+rts
+L146: lea L98, r7
+jmp L55
+L147: .string "ow"
+rts
+L148: clr *r2
+jmp L110
+L149: red L94
+not r7
+L150: .data 794, -638, 382, -511, 339, 564
+L151: clr *r4
+jmp L114
+jsr L21
+add L99, L92
+; comment
+cmp #103, L116
+L152: red *r4
+sub #130, L8
+rts
+L153: prn *r1
+lea L74, *r5
+not r0
+L154: stop
+dec L48
+prn #53
+; comment
+L155: .data 987, 585, -86
+jmp L52
+sub r6, L53
+L156: .data 541, 393, -517, -57
+stop
+red r5
+clr *r3
+jmp L93
+add #-99, L17
+inc r1
+jmp L137
+add L143, r1
+clr r6
+add *r2, *r2
+L157: dec r1
+jsr *r6
+jsr *r1
+L158: .string "nmjnqjklabwlfqsqxxmtuzj"
+L159: inc L67
+bne L34
+rts
+clr *r6
+cmp r7, L23
+jmp *r5
+L160: .string "qlvsgfgtdlsvc"
+L161: stop
+jsr L104
+lea L74, r0
+sub *r6, *r7
+rts
+L162: .string "oezcwxskqgkpoxzrqfca"
+jmp *r1
+rts
+lea L121, r4
+L163: rts
+prn r4
+L164: .data -342, -950, 703, -957, -213
+
+L165: add L164, L4
+clr *r0
+dec r0
+L166: clr L163
+L167: not *r0
+mov L45, r4
+dec r7
+mov #-174, L102
+jmp *r4
+L168: lea L81, r1
+not r1
+lea L77, L105
+; comment
+jsr *r5
+L169: not *r2
+not r0
+rts
+L170: prn L156
+not r0
+rts
+bne L91
+L171: jsr *r0
+L172: bne *r5
+stop
+stop
+L173: red *r6
+L174: rts
+cmp L98, *r0
+L175: rts
+rts
+L176: .string "lrzwgabh"
+add *r6, L68
+not L126
+jsr L90
+clr L173
+bne *r6
+L177: cmp r7, #-170
+L178: .data -206, 14, 780, -958, -821, -249, -265, -910
+clr L133
+bne *r7
+
+L179: lea L27, r2
+L180: sub L113, *r3
+clr r2
+L181: add r2, *r4
+stop
+L182: jsr *r0
+L183: jsr L165
+jmp *r1
+jsr L108
+red r4
+rts
+clr *r2
+jsr L126
+L184: prn *r4
+bne L103
+add L111, L3
+
+L185: lea L151, r2
+clr L150
+L186: rts
+mov *r0, L51
+jsr L93
+jsr *r3
+prn r5
+not *r7
+dec *r0
+clr r6
+lea L18, *r5
+L187: mov *r2, r0
+clr L98
+L188: add *r1, *r6
+
+cmp #-140, L147
+lea L54, r0
+mov *r7, r4
+L189: clr L87
+dec *r3
+L190: bne L104
+lea L100, *r4
+lea L29, L4
+clr *r2
+mov #-1, r6
+L191: jsr *r7
+dec L170
+L192: stop
+L193: red r0
+add *r2, r6
+L194: red L168
+jmp L101
+jsr L108
+bne *r4
+prn #251
+L195: add *r6, L159
+rts
+bne L79
+not r7
+jsr L45
+stop
+lea L3, r1
+mov L109, r4
+L196: jsr *r2
+inc r5
+; comment
+bne *r0
+add r3, r4
+L197: cmp r0, *r7
+
+clr L178
+prn #-213
+rts
+rts
+sub #-144, *r3
+clr r3
+L198: clr *r4
+rts
+L199: lea L119, *r5
+bne *r0
+prn #-243
+L200: not L9
+L201: add *r0, r4
+mov L158, L99
+mov *r5, L72
+L202: jmp L90
+add #113, L95
+L203: dec *r7
+L204: red *r5
+dec L112
+L205: .data 773, -190, -147
+stop
+jsr L75
+L206: rts
+L207: add L134, L130
+cmp #83, *r2
+clr L161
+jsr *r7
+L208: dec *r7
+prn #176
+dec L150
+L209: jmp L53
+red L191
+add *r2, *r6
+L210: .data -620, 146, -282, -957, -558
+dec L134
+stop
+L211: dec L146
+sub r2, r4
+jmp *r1
+
+L212: .data 995, 108, -120, 188, -649
+red L114
+L213: stop
+L214: .data -696, 934, -272, 82, -789
+L215: sub #-159, *r4
+L216: cmp *r5, *r7
+add #-87, L92
+cmp *r4, *r3
+stop
+rts
+prn r5
+jmp *r3
+L217: .string "prxslabmdxwy"
+L218: not L32
+L219: prn L95
+rts
+sub *r5, L141
+sub #-256, L5
+jsr L219
+inc L68
+dec r7
+dec r5
+; comment
+cmp #-243, #216
+sub #-132, L194
+L220: dec L143
+mov #29, r2
+jmp *r1
+L221: cmp #-14, #129
+L222: .string "mqwsktifjjwiiphgdv"
+L223: inc r4
+red *r3
+L224: bne L198
+red *r0
+L225: cmp *r7, *r7
+stop
+mov #99, L213
+not r1
+inc r7
+L226: .string "lmkmjkymvtmbnwdqwgpi"
+L227: .data 765, 659
+L228: .data 703, 657, -949
+L229: jsr L72
+not r7
+L230: .data 234, 657, -36, -439, 710
+L231: rts
+L232: .string "xoonprayiejubhbsejzlm"
+L233: prn *r6
+lea L10, *r3
+inc L141
+bne L17
+L234: clr L121
+bne *r5
+L235: bne *r2
+rts
+inc L135
+red L210
+prn *r0
+L236: stop
+jsr L122
+lea L61, L64
+L237: jsr *r7
+L238: prn r3
+L239: prn L150
+L240: .data -538, 789, -177
+L241: .data -318, -504
+clr r5
+add #223, L93
+sub r4, L171
+L242: mov L122, L103
+
+prn #-107
+jmp L96
+jsr L50
+jmp *r5
+prn L196
+L243: stop
+L244: stop
+inc r3
+jsr L208
+stop
+dec r5
+L245: .string "vgwzdkjayegbg"
+jsr *r2
+inc *r4
+add r2, L238
+rts
+bne L94
+L246: red *r6
+jsr L183
+dec L80
+red *r7
+mov *r0, L27
+dec *r4
+stop
+L247: cmp *r1, *r3
+L248: sub L30, r5
+jsr L8
+L249: jmp L74
+L250: cmp L10, L190
+prn *r4
+L251: .string "rfpbwbfmzj"
+stop
+sub #-191, L190
+L252: .data -32, 75, 14, 633, -271, 967
+L253: .data 260
+sub #-193, r7
+add *r1, *r3
+red *r5
+red *r4
+not L113
+stop
+dec *r4
+bne L55
+jmp L111
+dec r5
+cmp r2, #117
+bne *r1
+mov #-141, r6
+inc *r2
+add *r0, *r2
+L254: jsr L65
+cmp #231, L152
+L255: red *r6
+clr L176
+jsr L212
+lea L55, L61
+dec *r0
+L256: .string "fijh"
+inc L241
+L257: jsr L177
+L258: prn *r5
+dec *r5
+dec L199
+; comment
+L259: add L112, L93
+L260: mov r1, L150
+L261: clr r2
+L262: red *r2
+mov #-243, *r0
+rts
+lea L170, *r2
+add #233, r4
+L263: stop
+inc r7
+; comment
+L264: sub *r4, r7
+L265: .data -688, 348, -735, -260, -33, -216, 111, -455
+L266: jsr *r7
+L267: not *r3
+L268: jsr L236
+jsr L52
+cmp #-91, #-138
+L269: cmp *r2, r0
+jsr *r0
+inc L110
+
+prn r6
+jmp *r6
+L270: red L188
+red r4
+L271: .data 906
+
+L272: .data 402, 449, -24, -259
+rts
+not r4
+L273: bne *r0
+inc *r3
+stop
+red L159
+L274: jsr L114
+add *r7, *r4
+mov *r1, *r7
+lea L154, r3
+L275: not L136
+clr *r2
+L276: cmp #145, *r4
+; comment
+L277: .string "bpzzgawutjl"
+add L187, L80
+jsr *r6
+prn L244
+L278: jmp L118
+L279: jsr L188
+L280: inc L216
+lea L39, L26
+bne *r7
+L281: not *r4
+prn *r1
+red r4
+inc *r0
+L282: jmp L194
+red r2
+
+bne *r4
+sub #153, *r4
+L283: .data 345, -99, -690
+rts
+L284: lea L219, L276
+add L55, L73
+jmp L34
+mov L168, *r6
+jmp L240
+L285: jmp L231
+L286: clr L256
+L287: sub #90, r2
+L288: .data -807, -229, -532, -148
+jsr *r4
+L289: .data 434, 852, -348, -879, -665, 515, 562
+L290: .string "wzjaldwu"
+not r5
+
+L291: clr r5
+L292: red L69
+not *r1
+L293: jmp *r2
+L294: jsr *r2
+mov r1, r0
+stop
+inc r2
+cmp *r0, L157
+red L78
+L295: .string "jm"
+L296: red *r5
+rts
+; comment
+L297: lea L69, *r1
+L298: .string "xwenc"
+prn L58
+sub *r6, r7
+L299: add *r1, r3
+red r4
+rts
+jmp *r7
+bne L224
+L300: inc r2
+
+sub #60, *r4
+; comment
+prn L276
+mov #-158, *r2
+sub L39, L122
+not r1
+jmp *r0
+jsr *r7
+
+L301: lea L162, r1
+stop
+L302: jsr L244
+not L256
+not L169
+L303: .data -184, 41, 857, 174, 844, 823
+jsr L188
+L304: add *r6, r4
+not L261
+L305: bne L191
+clr L85
+lea L157, L83
+L306: bne *r4
+stop
+; comment
+dec *r5
+add #-42, L136
+dec L163
+mov r0, r6
+inc *r2
+L307: sub L165, L193
+jsr L73
+; comment
+stop
+L308: mov *r6, L191
+sub *r1, *r6
+lea L292, *r6
+prn L272
+red *r3
+not L3
+L309: .data 465, -717, 389, 549, 556, -594, 609
+L310: prn #-54
+add #111, r2
+L311: .string "ljs"
+prn r5
+mov *r1, *r0
+L312: lea L282, *r6
+add *r0, L93
+cmp *r3, #-227
+
+bne L44
+L313: add *r1, *r6
+
+clr *r7
+cmp *r0, *r1
+L314: .data -985, -350, 494, -668, 495, 26, -312, 796
+jsr L120
+lea L80, r0
+rts
+rts
+prn r1
+red r7
+L315: .data -948, 585
+L316: .data -341, 339, -683, -873, -267
+L317: cmp r6, *r3
+L318: add *r4, *r0
+L319: clr *r7
+L320: .string "ebkcbzrnkbzpp"
+L321: .data 682
+L322: dec r1
+red L280
+jmp *r0
+L323: rts
+clr L253
+red r7
+clr L179
+L324: .data 47
+add *r1, L233
+jsr *r4
+L325: jsr L28
+L326: .data -56, 657, 682
+L327: red L46
+L328: .data 774, -490, -714, 254, 380, -203, 484
+prn L75
+inc L179
+add r3, L176
+cmp r4, #231
+jsr L171
+L329: .string "tdvrwqdwle"
+L330: clr L88
+jmp L19
+L331: inc *r3
+not L98
+add L45, r4
+dec L214
+lea L204, L84
+red *r5
+cmp r3, #10
+L332: clr r4
+
+L333: .string "puotsbatnydbdbhpggnfaw"
+red *r0
+L334: rts
+inc r6
+bne *r1
+clr L14
+L335: add r5, *r6
+mov L103, *r6
+L336: stop
+mov *r7, L100
+L337: prn r0
+L338: rts
+L339: .data 161, -414, 446, 386, -381
+red *r2
+rts
+not r4
+dec r1
+sub #38, *r3
+clr L205
+dec r7
+L340: add L14, L181
+lea L31, r0
+L341: .data -526, 56, -579, 21
+lea L256, L273
+L342: cmp #137, L304
+add *r3, *r4
+L343: jsr *r3
+L344: clr *r0
+jmp L27
+dec *r5
+L345: mov r6, r5
+; comment
+dec L284
+L346: mov *r2, r2
+L347: lea L318, r5
+stop
@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 59
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: lea L0, r6
+L1: dec *r3
+rts
+not *r6
+jmp *r1
+not L0
+jsr *r0
+L2: cmp #-23, r5
+inc *r3
+stop
+clr L0
+L3: cmp r1, *r0
+lea L2, *r0
+jmp *r2
+prn *r2
+jmp *r7
+bne *r7
+not *r6
+clr L1
+stop
+bne *r7
+L4: not r3
+
+L5: jsr L0
+rts
+mov *r3, r2
+rts
+jsr L5
+L6: .data 74, -305, -455, 240
+red r4
+inc L6
+L7: red *r7
+L8: mov *r3, r2
+cmp *r7, L3
+stop
+lea L6, r1
+L9: sub r5, *r6
+L10: .string "bijrasjbnvherrepscjlmzu"
+clr r7
+L11: not r2
+red *r2
+L12: red L1
+rts
+L13: prn r3
+add *r5, L2
+clr L11
+rts
+L14: jsr *r3
+red L7
+rts
+clr r3
+L15: rts
+L16: .string "szvul"
+not *r2
+
+mov r1, L2
+jmp L10
+inc L3
+L17: .string "lxkakmgokocjyszoa"
+jsr L17
+L18: .data -988, 150, 418, -262, -199, 472
+L19: stop
+jsr *r4
+red L11
+bne L19
+jsr L9
+L20: jsr L12
+L21: dec L7
+L22: dec *r4
+cmp *r4, L20
+lea L3, L18
+mov L13, r6
+not *r4
+L23: inc r6
+L24: sub r5, *r0
+add #-157, *r4
+rts
+add *r0, r2
+not L2
+L25: .string "gkcwyoolo"
+L26: .string "kmyhtfdtjqyflbeib"
+L27: .string "zzhmxplzovdccit"
+stop
+L28: add r4, r2
+L29: bne *r4
+L30: lea L11, *r3
+; comment
+L31: cmp *r7, r7
+L32: add L14, r0
+prn r0
+L33: .data 407, -823, 288
+sub #143, r4
+inc *r6
+mov r1, *r1
+L34: sub #162, L8
+lea L2, *r5
+jsr *r4
+L35: .string "tndscwkurssfrthgzywvqvti"
+lea L8, L33
+not *r5
+stop
+L36: stop
+L37: jsr L24
+jsr L10
+L38: clr r0
+bne L5
+dec r1
+cmp #-155, *r4
+L39: red L34
+mov #28, *r0
+jmp L3
+jsr *r4
+L40: .data 639, 12, 106, 680
+clr r0
+L41: .data -828, 94, -143
+not r5
+L42: .string "ucrqkvwdvvwhpdaeldq"
+jsr L7
+lea L42, *r0
+stop
+L43: red r3
+lea L11, L24
+not *r6
+
+; comment
+L44: .data -201, -19, -427, -493, 86, 468
+rts
+L45: not L39
+clr *r6
+dec r2
+jsr *r5
+dec *r1
+L46: not L10
+L47: .string "dk"
+L48: red *r5
+mov r2, r0
+clr L22
+cmp *r0, L31
+bne L22
+clr r5
+L49: clr L7
+not r6
+red L23
+rts
+L50: prn *r7
+L51: .string "wzghsquliypckqtrgiadre"
+add #-142, *r7
+add L48, r4
+L52: bne L22
+L53: jmp L48
+stop
+bne L10
+L54: stop
+mov L5, r0
+not r5
+add L27, L17
+red r2
+not r6
+L55: .string "qspljwzkxfokc"
+rts
+L56: dec *r5
+inc r4
+rts
+L57: jsr *r2
+mov *r7, r7
+clr L9
+L58: not *r4
+L59: .data -196
+L60: mov r1, *r4
+L61: jsr *r3
+prn L49
+dec L59
+mov r1, L6
+dec *r2
+L62: jsr L52
+L63: .string "xxzlnajeaeavjx"
+lea L35, r1
+L64: jmp L19
+red r6
+not L10
+L65: .string "wiiqsjeqzcwjoywcahdi"
+L66: inc r5
+clr r1
+dec r0
+; comment
+inc L27
+inc r0
+L67: .data 556, -877, -186, -625, 575, -979, -59, 10
+stop
+not *r7
+sub #-82, r3
+clr *r0
+L68: .data -924, 170, 361
+dec r0
+add *r7, *r6
+mov #53, r0
+L69: sub r5, *r7
+not *r1
+clr L41
+
+not *r2
+sub #-113, L38
+L70: .string "uinghvydhr"
+; comment
+bne *r4
+red *r2
+L71: rts
+jsr *r2
+L72: not r2
+L73: .data 464, 708, -809
+L74: .data -732, 825, -355, 970, -227, 231
+jmp *r0
+bne L69
+
+mov r5, r7
+not *r7
+L75: bne *r7
+mov r4, *r0
+jsr *r6
+prn *r3
+mov #233, L3
+L76: jmp L46
+not L29
+stop
+L77: prn *r6
+L78: lea L63, r7
+dec L69
+cmp #-1, L19
+L79: .data 556, -250, 440, -415, 144, 568
+sub r2, r1
+; comment
+add #-173, *r0
+not r0
+add L30, r2
+lea L32, L68
+jsr L40
+L80: jsr L39
+L81: jmp *r5
+L82: inc r6
+stop
+L83: .data 343, -826, 608, 396
+L84: .data -666, -298
+red r6
+L85: .data -640, 178, -367
+L86: .string "fraftmwqzhjayrb"
+L87: .data -549, -11
+red r1
+cmp r0, L24
+; comment
+L88: cmp L52, *r7
+L89: clr *r4
+L90: .data 416, 13, -11, 534, -182, 618, 236
+L91: cmp #-20, *r7
+bne *r7
+red L22
+dec *r0
+L92: prn *r1
+L93: red L92
+jsr L77
+rts
+cmp #213, #-26
+prn r7
+jmp *r1
+L94: .data -426, 806, 575, -520, 274
+mov r4, *r4
+mov L11, *r6
+dec L91
+clr L27
+L95: add r0, L27
+not *r7
+stop
+lea L6, *r0
+; comment
+inc L75
+L96: stop
+bne *r3
+jmp *r0
+L97: rts
+L98: prn #51
+inc r0
+sub r1, L54
+stop
+cmp L3, *r6
+L99: mov *r2, r3
+L100: jmp L18
+L101: .string "vmwfvsrzizbr"
+L102: sub L38, r4
+L103: lea L7, L70
+L104: inc *r3
+mov L41, r5
+L105: inc *r0
+L106: lea L73, r4
+L107: prn #-238
+bne *r7
+lea L92, *r4
+stop
+not *r4
+jsr *r3
+
+L108: stop
+L109: add *r2, *r5
+; comment
+L110: inc r0
+cmp r7, L98
+prn #-201
+L111: bne *r1
+jsr L77
+add #162, r1
+mov #202, L106
+bne *r1
+rts
+not *r0
+L112: lea L22, *r5
+add #-9, r5
+; comment
+not L103
+not r2
+L113: stop
+L114: .string "daixfcpnttszhlydarjwhj"
+L115: bne *r6
+bne L16
+L116: not r2
+L117: mov L84, L29
+dec r5
+clr *r5
+L118: cmp r0, r5
+add *r0, r5
+jmp *r1
+red r7
+dec r7
+lea L117, r2
+clr L80
+mov r3, r5
+L119: rts
+stop
+jsr L98
+jsr L17
+
+bne *r1
+L120: not *r2
+L121: add r1, L110
+jsr *r2
+bne *r7
+cmp r3, #-236
+clr *r6
+L122: .string "rhvuczljowdopn"
+L123: jsr L65
+jmp *r5
+L124: .string "ayrmzvoa"
+sub L59, *r4
+add r5, r3
+L125: .data -835, -565, -926, 672, 155, 673, 654
+sub r4, L44
+rts
+cmp #149, L4
+L126: .string "hccotxnljrwhsjttnvkbwbvs"
+not r6
+jmp *r6
+clr *r2
+L127: bne *r4
+L128: .data -624, -287, 796, -899, 685, -638
+stop
+stop
+sub r0, L41
+L129: .data 539, 504, 778, -814, 411, -780, -691, -137
+not L97
+jsr L60
+prn #-223
+L130: .data 482, -482, -926
+
+lea L26, L71
+L131: lea L29, *r4
+red r5
+red r0
+L132: lea L111, L65
+; comment
+dec *r4
+L133: red L64
+not L94
+L134: .data -170, 814, -343, -80, -83
+sub *r7, *r5
+L135: jsr *r7
+L136: prn *r3
+prn #200
+L137: red *r3
+add r4, L134
+L138: mov L98, r4
+not *r2
+lea L63, L5
+lea L51, r0
+jmp L138
+L139: red L135
+L140: .string "to"
+L141: .string "rnxexmjuoe"
+L142: red r5
+lea L6, r0
+rts
+L143: stop
+L144: red r7
+L145: .string "wsdkdwmeqwrnjmwyvb"
+sub *r6, L60
+L146: jmp *r3
+jsr *r0
+inc r2
+bne *r5
+L147: rts
+red L130
+L148: .data 646, -773, 763, 299
+lea L123, *r0
+L149: dec *r0
+cmp L140, L64
+clr *r5
+inc *r6
+add r4, r4
+L150: .string "mpptjkkklbxatjirbw"
+inc L140
+L151: red r7
+L152: rts
+stop
+prn *r5
+; comment
+clr r0
+clr L54
+L153: jmp *r1
+jmp *r2
+L154: .string "ahcqvx"
+L155: .data 611, 795
+L156: .data 407, -765, 384, -559, 922
+L157: jmp *r3
+prn #-228
+L158: not L154
+L159: .data 292, 928, -911, 13, 63, -543
+bne L141
+dec L36
+add *r2, *r6
+inc L127
+red L13
+inc *r5
+clr L110
+jmp *r5
+mov #-233, L132
+clr r6
+rts
+L160: bne *r4
+dec *r6
+prn #-36
+L161: lea L81, *r6
+L162: dec *r5
+rts
+L163: clr *r4
+add #80, *r7
+L164: inc r6
+jsr *r7
+dec *r7
+bne *r4
+stop
+L165: dec L155
+L166: not r0
+rts
+inc r7
+L167: inc r2
+L168: inc L32
+L169: jsr *r7
+cmp L34, L21
+rts
+red r4
+L170: dec L125
+red L141
+clr r3
+dec L157
+cmp r4, L87
+L171: .string "pjrrmrilvpnclvvexhkpykgp"
+; comment
+L172: .string "obryszteqivnpget"
+add r7, L57
+L173: .data -347, -783, -367, 738, -415
+L174: .data 328, -408
+
+jmp L54
+rts
+L175: mov r3, L21
+L176: sub L136, *r1
+jmp L146
+dec *r7
+L177: bne *r7
+prn #-180
+add r0, *r4
+L178: rts
+; comment
+bne L104
+stop
+L179: stop
+L180: prn #74
+mov #115, r7
+inc L120
+cmp #-2, *r5
+L181: .string "exwvnxqbapsqxynnnwzmku"
+red r4
+sub L160, L63
+mov *r4, L117
+inc r0
+jmp L165
+; comment
+L182: add #17, r7
+clr L9
+
+cmp *r3, *r6
+L183: .string "qebucxkdldmdffhxwscgsys"
+; comment
+red *r7
+L184: .string "auarcbjmduironr"
+red L33
+sub r2, L23
+L185: .string "nssrqkstymykrralb"
+L186: jmp L73
+L187: .string "sisjzvwof"
+red r2
+L188: stop
+clr r6
+
+mov *r2, L89
+L189: stop
+stop
+lea L98, r3
+inc r6
+L190: jmp L59
+L191: .string "nslqivro"
+L192: .string "zzxgvcsfti"
+sub L180, r6
+L193: .string "nmiiqryshixccmngyvu"
+L194: .string "nxcyacwvwrjhubcjugdlsg"
+L195: lea L136, L17
+sub L67, r4
+L196: dec *r7
+red *r0
+bne L2
+dec r2
+L197: rts
+L198: not r7
+stop
+L199: lea L39, L154
+L200: stop
+jsr *r0
+stop
+bne *r1
+sub r0, L122
+L201: red L164
+L202: inc L163
+add L74, r6
+L203: jmp *r7
+clr r6
+L204: .string "xuvdgjlelcjkkcansrwg"
+cmp L52, *r3
+jmp *r7
+prn r5
+dec L168
+L205: add L53, L176
+stop
+jmp L72
+jsr L27
+prn #-110
+red *r7
+dec L153
+jmp L143
+stop
+L206: red L32
+; comment
+L207: not *r4
+L208: jmp L192
+dec r7
+rts
+L209: .string "cnurzwpbnahwkoocu"
+lea L190, r2
+sub #-114, r6
+rts
+L210: stop
+L211: jmp *r7
+jmp *r7
+jmp L121
+stop
+mov L206, *r1
+red *r0
+lea L20, L40
+L212: mov L141, L116
+lea L203, L88
+not *r6
+L213: add *r6, *r4
+L214: not r3
+jsr *r7
+L215: rts
+bne *r6
+L216: rts
+prn L19
+clr *r1
+L217: dec *r0
+mov #-112, r2
+cmp *r2, L123
+lea L15, *r6
+red r2
+not L202
+lea L185, *r2
+sub L201, *r1
+L218: clr L61
+red *r1
+inc L109
+L219: .string "bcuhrdbbrpcsxfuv"
+L220: red L196
+jmp *r3
+clr *r4
+rts
+L221: inc L58
+clr r4
+jmp L164
+jsr L88
+L222: cmp *r5, *r1
+L223: red r1
+lea L154, L115
+L224: .string "jiohxr"
+rts
+stop
+L225: dec L206
+stop
+mov r2, L200
+L226: .data 39, 757, 650, -768, -464, -336, -977, 273
+clr r7
+prn L61
+; comment
+
+L227: .data -857, -905, -495, 448, 644, 233, 619
+jsr L148
+lea L181, r4
+L228: .string "mgreiygnemc"
+dec r0
+red L220
+stop
+L229: dec r7
+prn #-160
+L230: lea L139, *r6
+bne L165
+mov *r2, *r7
+jmp L20
+jsr L220
+bne *r3
+L231: stop
+L232: mov L120, r4
+dec L205
+L233: dec *r6
+jsr *r4
+dec L186
+clr r5
+lea L122, r1
+add r4, L220
+L234: bne *r7
+not *r7
+L235: lea L194, r1
+not r3
+lea L72, L49
+L236: inc r2
+dec *r0
+bne *r3
+prn #211
+lea L74, L124
+stop
+jsr *r3
+not *r2
+inc *r1
+
+L237: add #221, *r7
+cmp r3, *r1
+dec *r1
+stop
+sub L233, L96
+rts
+dec L107
+L238: mov *r5, r7
+add L209, L92
+sub r6, r6
+stop
+sub *r1, r6
+stop
+; comment
+L239: add r0, *r5
+sub r1, L143
+
+red *r4
+L240: bne L7
+L241: add r5, L33
+jmp L237
+L242: .data 291, 413, -618, -955, -913, -905, 343
+dec L62
+add *r0, L36
+rts
+mov L91, L128
+cmp r1, L139
+L243: .string "hhdtgoqabhpdyh"
+inc L5
+dec L162
+jmp L208
+L244: red L13
+
+not L139
+red L216
+prn *r1
+sub L129, *r7
+dec r5
+jmp *r2
+mov #-220, L13
+L245: dec r3
+L246: rts
+mov #12, L148
+prn r6
+dec r2
+rts
+bne *r2
+L247: .string "zshkkyuzicnbofqzua"
+L248: add #184, *r5
+L249: stop
+L250: bne L147
+L251: lea L48, L27
+inc *r5
+lea L250, L69
+stop
+clr L200
+L252: jsr L9
+jsr *r5
+L253: bne *r4
+cmp *r3, L89
+clr L186
+red L174
+dec *r6
+inc r4
+L254: prn r5
+L255: prn #-21
+
+mov #-200, *r1
+L256: dec r6
+rts
+prn r0
+red L4
+L257: dec r5
+L258: jmp L74
+bne L201
+L259: .string "tukhmkwobfhyt"
+not r4
+lea L23, L238
+L260: jmp *r3
+inc L45
+lea L215, r7
+mov #-47, L39
+stop
+L261: not L44
+bne L213
+L262: not r4
+L263: lea L130, *r0
+jsr *r7
+dec *r4
+jmp L119
+lea L158, *r0
+prn *r1
+bne *r2
+sub L177, r1
+L264: .data -26, -790, 639, -542, -330
+cmp L60, *r7
+inc L199
+; comment
+cmp L21, *r3
+L265: sub L69, r3
+cmp L34, r3
+inc *r4
+L266: cmp #208, L90
+stop
+red L141
+dec *r7
+cmp *r0, *r4
+inc r5
+L267: jsr *r6
+L268: .data 353, -92, -970, 999, -618
+lea L110, L7
+L269: rts
+
+sub L49, *r5
+bne *r7
+not *r3
+L270: .string "grxkmq"
+add #69, r1
+mov #23, r3
+sub r0, L232
+
+clr *r2
+
+not *r4
+lea L257, r1
+prn *r1
+L271: .string "x"
+L272: .string "xkuqlvvmwdposiahedtd"
+L273: dec L131
+L274: .string "sbytpdebygfasxcuverfw"
+clr L210
+dec L244
+
+
+stop
+L275: clr r5
+L276: sub *r6, r0
+L277: bne L103
+add r1, L187
+L278: inc *r7
+jmp *r2
+mov #167, *r2
+L279: rts
+
+bne *r2
+add #169, L262
+L280: bne L218
+add L35, r5
+mov #-209, r5
+add L150, *r6
+jsr *r0
+prn *r4
+red *r0
+dec L100
+clr L125
+mov #-162, r5
+jsr L200
+mov r7, r3
+L281: cmp r2, L125
+L282: .data 623, 412, -45, 823
+not *r0
+L283: dec r4
+red *r0
+dec L250
+inc L71
+jsr L19
+jsr *r5
+prn r5
+add *r4, L256
+clr r3
+red L132
+lea L118, r7
+L284: sub #128, r0
+lea L22, r5
+bne L176
+sub *r0, *r1
+clr L193
+cmp *r5, r0
+not *r7
+cmp L92, r5
+L285: cmp L168, #163
+jmp *r4
+bne L179
+lea L82, r6
+; comment
+inc L62
+mov r5, r2
+clr L166
+clr L278
+L286: cmp *r0, r6
+L287: not L61
+bne L221
+L288: .string "hqowpxvpf"
+L289: .string "hcutyhulikgnzpfgn"
+dec r2
+stop
+lea L178, r7
+L290: sub #48, *r1
+L291: sub r0, r6
+dec *r5
+L292: mov r5, r6
+L293: inc *r4
+L294: .data 713, 99
+L295: .string "xkxrhm"
+inc r6
+inc L135
+L296: .data -717, 524, 351, -192, 600, 152, -180
+bne *r5
+prn *r4
+L297: bne *r7
+L298: jmp *r2
+rts
+; comment
+prn L168
+stop
+L299: .string "yhacpzipaxaerhysz"
+jsr L184
+stop
+inc r3
+sub #61, r4
+L300: .data -615, 801, 372
+L301: bne L41
+L302: .string "ihsbedqgrwabwnligctgafsf"
+jsr *r5
+L303: stop
+prn L150
+jsr *r6
+L304: cmp #-71, #156
+cmp r5, #-236
+jmp L189
+stop
+L305: .string "cfilsaldakqgskbgzzphval"
+lea L128, L113
+add *r0, L277
+dec L174
+L306: inc L235
+jsr L191
+jsr *r3
+; comment
+L307: jmp *r3
+clr r6
+jmp *r0
+jsr *r5
+rts
+L308: .string "delgglbbopfn"
+jsr L209
+L309: .string "felftqifoqbcj"
+lea L132, r7
+L310: .data -850, -450, -854, -543, -110, -24, 995, -893
+L311: sub #-189, *r3
+add r6, r3
+add *r0, r3
+red *r6
+mov #55, r6
+L312: inc L130
+L313: bne L202
+sub *r3, L201
+L314: bne *r4
+L315: bne *r0
+clr *r1
+L316: add L186, *r0
+L317: prn *r6
+rts
+cmp L64, #-79
+inc r2
+clr L225
+clr *r5
+mov #-53, r4
+dec r1
+L318: jmp *r4
+L319: prn r0
+dec *r5
+L320: stop
+L321: .string "mvaviizpth"
+L322: rts
+mov *r6, r5
+mov r4, r5
+not r6
+lea L244, L317
+red L264
+L323: .data -298, 325
+L324: add #-48, *r4
+L325: lea L322, *r0
+sub r2, r1
+L326: .data 14, -127, 77, 614, -269, -348, 227
+L327: lea L92, *r1
+prn #236
+stop
+jsr *r4
+L328: stop
+L329: .data -502, -843, -859, -312
+L330: mov #175, *r7
+L331: jsr L183
+rts
+jsr L325
+L332: cmp r1, *r1
+inc *r2
+red L77
+rts
+rts
+jmp L46
+jsr *r2
+L333: mov L330, L297
+L334: jmp L15
+jmp L25
+inc L223
+L335: .string "etuiwtnbq"
+L336: .string "ep"
+mov *r3, L142
+L337: mov r3, r7
+stop
+cmp r6, #-74
+L338: lea L291, r2
+rts
+L339: dec r0
+L340: clr r6
+L341: rts
+L342: red r5
+lea L256, L29
+prn #55
+cmp r4, *r7
+sub L314, r4
+L343: lea L70, *r3
+mov *r7, r3
+L344: .data 223
+sub *r2, L150
+L345: .string "mowr"
+L346: jsr L3
+
+L347: sub #194, L140
+jsr L339
+dec *r4
+mov *r4, L23
+stop
@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 60
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+L0: lea L0, L0
+add #129, L0
+sub r3, *r2
+L1: clr L0
+add L0, r2
+L2: cmp #-10, *r5
+lea L2, L1
+cmp *r3, L1
+; comment
+bne L2
+L3: jsr L3
+
+L4: stop
+mov L3, r2
+jsr *r4
+L5: .data -978
+sub #-11, L2
+prn r5
+L6: sub #-81, L2
+L7: .string "obqpnqybfrfvdcvj"
+rts
+dec L0
+sub #-223, L6
+L8: cmp #-43, *r4
+L9: red L4
+prn *r4
+L10: lea L9, *r2
+not L5
+L11: .string "pxiibsblgx"
+L12: .string "mqqknudo"
+lea L4, r6
+clr r3
+clr L4
+lea L7, *r4
+L13: not *r6
+; comment
+L14: .data 799, 160
+jsr L6
+mov #-83, r1
+L15: bne L6
+; comment
+jsr L0
+not *r5
+jsr *r2
+inc r4
+L16: cmp #120, L6
+lea L6, r3
+L17: .string "hlkxk"
+dec r2
+
+L18: .string "hgkrmdxqsrakkbkvub"
+prn #143
+L19: .string "bge"
+inc L7
+L20: .string "gsptckathbqatjypys"
+inc L17
+L21: bne *r1
+dec *r3
+jmp *r5
+; comment
+dec *r6
+L22: .string "wgekwtftmefnskjuaznz"
+L23: dec L9
+red r3
+rts
+L24: jmp *r6
+L25: dec r2
+prn *r3
+jsr L2
+L26: not *r2
+mov L12, r0
+jsr L8
+rts
+L27: .string "tqkfxdzadu"
+L28: not L28
+rts
+cmp *r1, #-167
+inc L2
+inc L2
+not *r3
+L29: not *r1
+L30: rts
+L31: clr *r4
+; comment
+jsr *r1
+jmp *r1
+lea L30, *r2
+L32: mov r6, r4
+prn L1
+red L31
+L33: bne L9
+not *r1
+L34: .string "dguzbtejfkhsepbhjtopzk"
+L35: jsr *r0
+dec L29
+add *r3, *r5
+L36: cmp r0, r6
+L37: prn L7
+stop
+L38: .string "kifffusxdodb"
+not *r6
+mov r5, L28
+L39: cmp L37, L8
+cmp *r7, r0
+L40: stop
+cmp #219, L23
+stop
+lea L8, *r0
+L41: .string "ticeyyukdfpvqigluibybhfu"
+; comment
+L42: sub r3, *r7
+bne L22
+cmp *r4, #-69
+rts
+lea L11, L5
+sub L26, L2
+add #-37, *r3
+rts
+mov #54, L41
+lea L4, r6
+dec r6
+L43: .string "jnkxahe"
+cmp r1, #24
+add L5, r3
+L44: mov *r6, *r5
+L45: lea L14, *r7
+add r5, L14
+add *r4, L41
+L46: cmp r6, #-185
+L47: red *r7
+L48: dec L22
+jsr L15
+L49: inc *r2
+
+clr *r6
+jsr L42
+clr *r6
+lea L11, L31
+clr L13
+red *r2
+L50: jsr L39
+inc r3
+L51: clr r5
+clr *r4
+L52: .data 708, 488, -61, 930
+L53: not r7
+not r3
+L54: add r5, r7
+L55: .string "dgzcgxqbuasvjtqkoqlf"
+L56: lea L35, r4
+jsr *r0
+
+; comment
+L57: inc *r5
+add L5, r4
+sub *r3, L30
+cmp r6, #-194
+mov #-30, *r2
+clr r3
+prn #-96
+L58: add *r3, *r1
+red L31
+stop
+mov L24, *r3
+red *r0
+stop
+L59: add r3, *r6
+rts
+add L25, L56
+L60: .data -144, -799, -360
+clr *r3
+prn *r1
+dec r3
+not *r3
+L61: stop
+rts
+stop
+cmp *r2, *r3
+red r4
+stop
+L62: rts
+L63: prn #114
+L64: dec L38
+L65: .string "ipx"
+L66: mov *r6, r2
+inc r1
+L67: .string "wfdzvjm"
+prn L23
+L68: red L54
+inc *r1
+stop
+not *r0
+bne *r0
+; comment
+inc *r7
+L69: bne L8
+L70: .string "bjpwlzkpeaycuduudqdoypy"
+L71: sub *r6, r2
+rts
+L72: .data 614, -941, 443, -940, -649, 289, -374
+dec r5
+L73: .string "jg"
+clr r1
+prn #233
+
+L74: .string "stoeihaa"
+clr *r1
+bne *r6
+L75: cmp r0, r7
+inc r3
+
+bne *r2
+L76: prn L17
+L77: stop
+L78: inc r1
+stop
+prn *r1
+inc *r1
+L79: clr *r5
+L80: inc *r0
+L81: mov *r5, *r0
+; comment
+prn #-210
+L82: .string "pzdkeskkdyjwpojiwrnihcs"
+L83: .data 555, 937
+mov #222, *r3
+L84: inc L62
+jmp L15
+add L77, L74
+jsr *r3
+L85: jmp L65
+add r6, L5
+bne *r1
+L86: sub L10, *r5
+L87: .data 941, -263, 576, 528, 270, 247, -958
+jsr L1
+lea L0, r5
+rts
+not L79
+L88: bne L26
+red *r5
+jmp L64
+L89: jsr L4
+stop
+mov r0, *r5
+L90: bne L54
+not L75
+sub #-115, L48
+L91: .data -125
+not L86
+L92: prn #-182
+stop
+add #249, L74
+add L23, r2
+inc L66
+red *r2
+jsr *r5
+inc *r5
+not *r4
+sub *r6, r2
+L93: red r6
+red r3
+lea L86, r3
+L94: bne L94
+
+lea L23, L63
+
+L95: sub #158, *r3
+add L27, L61
+rts
+red *r5
+L96: rts
+red r4
+jsr *r5
+L97: rts
+red r4
+L98: lea L80, *r3
+L99: sub #113, L19
+L100: red L8
+; comment
+not *r2
+add r5, *r3
+jmp *r3
+
+L101: .data 171
+L102: mov *r2, *r5
+sub #182, *r5
+prn r1
+L103: add L74, r7
+rts
+jmp *r5
+jmp L4
+L104: clr L64
+L105: .string "idshyntewmadixfmubsshoj"
+L106: red L45
+jsr *r5
+jmp *r4
+red *r6
+stop
+jmp *r7
+inc r3
+jmp L64
+add #-242, L37
+not r0
+L107: dec r0
+sub r4, r4
+L108: .string "rxvfsqifquqar"
+L109: .string "peivjazyn"
+stop
+jsr L88
+L110: bne *r3
+L111: stop
+rts
+mov #-193, *r0
+clr L3
+lea L77, *r0
+L112: rts
+L113: cmp *r6, #139
+rts
+L114: not L81
+L115: inc L52
+L116: .data 759, 307, -655, 254, -551, 957, 970
+stop
+prn #71
+L117: rts
+prn *r1
+L118: bne L60
+L119: .string "tjbxbbyw"
+stop
+sub *r5, L19
+jsr *r2
+add L118, *r2
+L120: clr *r4
+L121: clr *r6
+L122: not r7
+L123: stop
+L124: .data 910
+cmp #-176, L47
+bne L49
+lea L0, L69
+L125: dec *r5
+
+L126: sub r7, *r4
+jsr L84
+add L117, *r0
+not *r4
+
+bne L113
+add L120, r4
+L127: rts
+stop
+prn L56
+inc L103
+add r6, *r6
+L128: cmp r6, *r4
+clr L0
+bne L86
+jmp L114
+prn *r0
+rts
+L129: clr L69
+red r6
+not *r0
+; comment
+; comment
+sub *r0, L118
+L130: clr *r7
+dec *r1
+mov #94, *r0
+L131: not L71
+L132: .data 872, -323, -430, 903, -191
+jsr L43
+L133: add #-65, L109
+sub #70, *r1
+L134: add r0, L71
+sub L31, *r7
+jsr *r2
+
+rts
+add L115, r5
+cmp L76, *r4
+L135: prn r1
+lea L51, *r0
+rts
+add *r5, L130
+add #-70, L5
+lea L110, L10
+lea L121, *r4
+prn L44
+red L86
+inc *r1
+prn *r7
+jmp *r4
+L136: dec L58
+red r1
+L137: sub r1, r3
+lea L66, *r3
+dec r0
+L138: mov r1, r1
+L139: lea L112, *r2
+dec *r3
+add L38, r6
+bne L63
+lea L41, r3
+L140: mov *r3, *r2
+L141: prn r4
+L142: bne *r4
+L143: rts
+sub L102, r1
+L144: jmp *r2
+L145: .string "eiihxojns"
+L146: .data 105, -511, -163, 611, 124
+L147: stop
+L148: .string "ogerabhic"
+dec r6
+bne *r3
+dec L97
+dec r7
+lea L121, r7
+L149: not L144
+L150: .string "j"
+jsr *r7
+dec r4
+L151: stop
+rts
+prn *r1
+L152: jsr L30
+not r6
+L153: .string "yxidlgxah"
+dec *r0
+add #-132, L104
+clr r7
+red r7
+L154: .string "aogzfpctjnjv"
+L155: bne L131
+jmp *r4
+L156: red *r4
+L157: .data 636, 284, 871
+L158: cmp *r3, L38
+sub r5, r1
+L159: .string "dmcuriwertvkgl"
+L160: .string "gwgggworzzvry"
+L161: stop
+prn L157
+not r6
+not *r1
+lea L106, *r4
+sub *r4, r0
+prn r6
+L162: mov *r1, r2
+rts
+L163: .string "zespibykb"
+jsr *r0
+clr r5
+L164: .string "oqblhjqhwfhhlcxobtbfvkk"
+red r7
+L165: sub L100, r3
+L166: prn *r5
+red *r0
+L167: lea L99, L36
+L168: lea L48, *r3
+L169: inc *r3
+L170: bne *r0
+red *r6
+L171: prn *r6
+red *r2
+cmp L0, *r4
+L172: .string "lolhvfrffuushlbzj"
+stop
+jsr *r1
+bne L105
+red r6
+cmp *r1, r0
+lea L49, r5
+L173: .string "sdeqqbo"
+prn *r4
+jmp *r3
+L174: clr r4
+L175: jsr L97
+cmp r3, r3
+L176: red *r2
+not *r3
+not r0
+L177: sub L10, L28
+inc r1
+clr r1
+sub r0, L89
+; comment
+sub *r5, L36
+L178: stop
+red r2
+rts
+sub r4, L68
+L179: red *r6
+rts
+not L28
+L180: .data 373, 932, -978, 454, 661
+rts
+dec r2
+
+L181: cmp *r1, *r1
+L182: .data 689, -556, 964, 662, 440, -219, 286
+prn L82
+L183: inc *r5
+rts
+jsr *r4
+prn #-192
+rts
+rts
+rts
+stop
+add *r5, r4
+L184: .string "nsfgmlb"
+red r5
+L185: .string "sxdqve"
+bne L61
+L186: .data -306, 492, 592
+L187: .string "cvntznki"
+L188: .data 772, -892, 286, 79, -23, 998
+bne L71
+inc r3
+stop
+jmp *r7
+L189: inc r3
+L190: .data -583, -17, 982, -108, -850, -306, -909, -69
+dec *r3
+L191: add *r0, *r1
+L192: not r5
+L193: mov #242, L52
+jmp *r0
+L194: lea L147, L101
+add #-26, *r6
+L195: stop
+rts
+dec L114
+rts
+L196: .data 9, -1000, 974
+rts
+inc r7
+red L160
+cmp #80, #-99
+red L82
+L197: jsr L196
+L198: dec r2
+stop
+bne *r3
+bne *r3
+red r6
+red L198
+clr *r5
+L199: add *r2, L192
+L200: .data 742, 297, -99, -384, -457, -639, 717, 94
+L201: .data 886, -615, -733, -59, -590, -717
+not L134
+
+L202: .data 826, 444, 529, 923, 921, 275, -746, 82
+stop
+L203: .data 89, 886, 868, -565, 575, 629, -10, 408
+add #-245, *r6
+prn *r2
+L204: .data -383, 228
+jmp *r3
+bne *r6
+mov *r4, *r7
+L205: stop
+clr r1
+cmp *r3, L197
+not *r7
+clr L108
+stop
+cmp #-242, *r1
+inc r2
+add *r1, L73
+L206: lea L200, r5
+prn #-158
+rts
+L207: inc *r7
+jmp L46
+prn r2
+L208: sub L11, *r7
+sub #-68, r7
+cmp #-223, #-41
+lea L27, r1
+red L117
+L209: prn *r5
+clr *r7
+clr r6
+rts
+rts
+not r6
+L210: clr *r2
+L211: mov #120, r4
+
+clr L194
+inc r6
+sub r5, *r4
+L212: lea L61, *r4
+stop
+not r6
+L213: .data -138, 252, -469, -993, -518, 515, -267, -400
+
+L214: lea L154, r7
+L215: .data -807, 812
+jsr *r2
+jmp *r5
+L216: red *r4
+add *r2, *r5
+add r7, r3
+jmp L154
+dec *r7
+L217: jmp L94
+L218: bne *r7
+L219: inc *r4
+
+dec r1
+L220: .string "bqvpaixonabrk"
+clr r4
+jmp L80
+mov *r3, r4
+dec L122
+
+L221: clr *r1
+cmp #7, *r7
+red L78
+not *r6
+L222: rts
+not r4
+add #23, r6
+sub r7, r0
+inc *r5
+L223: .data 852, -259, 275, 541, 804, -969, -113, 441
+jmp L134
+L224: clr *r2
+not *r0
+jsr L157
+cmp L122, L7
+L225: .data 273, -307, 621, -236
+L226: jmp L119
+lea L43, L66
+L227: .data -887
+L228: red *r6
+cmp r3, *r5
+L229: jmp *r5
+L230: .string "xqsim"
+rts
+lea L100, r6
+inc r5
+jmp L165
+L231: stop
+rts
+not r5
+L232: .string "hibgkjnax"
+L233: .data 322
+L234: not L72
+L235: .string "vwdyztjcqjxaft"
+cmp #-177, L118
+jsr *r5
+L236: stop
+lea L126, r7
+L237: dec L221
+jsr *r2
+L238: .string "mxxjky"
+sub L122, L110
+L239: .string "nzhyfeypclov"
+L240: stop
+stop
+L241: stop
+cmp L74, #-202
+jsr L129
+; comment
+inc L114
+L242: .string "admammtpxyvciuulzzgzmm"
+; comment
+L243: .data -353
+L244: inc r6
+dec r7
+L245: .string "g"
+red *r7
+not *r0
+L246: bne *r0
+add *r6, r4
+dec r2
+L247: .data 868, 262
+L248: jsr *r5
+sub r7, *r2
+L249: lea L21, *r7
+L250: jmp L85
+L251: clr r5
+L252: not *r1
+stop
+L253: rts
+L254: jsr L206
+add *r6, *r0
+L255: jsr L227
+prn *r7
+L256: .string "gmdiwyrlmjanfardryapigoo"
+jsr L124
+stop
+jmp *r4
+jmp L166
+rts
+L257: lea L28, L235
+L258: sub r3, *r5
+jmp L43
+L259: inc r5
+jmp L129
+sub #168, r5
+mov r5, *r3
+not *r1
+lea L110, r4
+L260: .data 840, -640, -125
+stop
+L261: inc *r7
+bne L135
+L262: dec r6
+L263: .string "amxzfciyzvrnbtkgwrjeiewj"
+; comment
+rts
+L264: red L65
+L265: clr *r3
+rts
+clr *r2
+L266: mov L51, *r2
+red r4
+dec r0
+L267: prn #-116
+stop
+add *r5, L44
+L268: .data -604, 663, 396, 843, -401, -978, 337
+bne L81
+L269: clr L225
+dec L214
+lea L170, L36
+sub *r1, *r1
+stop
+red *r6
+red r1
+L270: .data -649, 126, 888, -883
+bne *r0
+L271: .data -922, 468
+L272: clr r2
+L273: jsr *r7
+cmp #245, L36
+jmp *r1
+cmp L250, L39
+L274: sub *r1, r3
+clr r6
+L275: jsr *r2
+L276: jsr L32
+jmp L197
+
+jmp L63
+sub *r0, L22
+red *r1
+rts
+stop
+L277: .data 606, -379, 220, 434
+sub L146, L228
+L278: red L246
+not L212
+inc *r4
+L279: jmp *r7
+lea L96, *r4
+L280: mov L3, r2
+L281: not r6
+inc L142
+stop
+prn r2
+L282: bne *r3
+L283: .string "ltufisrbuz"
+L284: sub #201, r2
+L285: inc L79
+prn L117
+clr L34
+L286: bne *r3
+rts
+jsr *r3
+lea L24, *r1
+inc L152
+L287: bne L8
+mov r6, r4
+red r4
+L288: clr L159
+L289: jmp *r2
+L290: clr *r7
+mov *r4, r7
+lea L68, *r1
+L291: .data -82
+L292: .string "mzligiqhjkstxqpess"
+L293: cmp *r1, #4
+bne *r1
+stop
+L294: .string "amfzwmatgzlpsq"
+L295: jsr *r1
+L296: stop
+stop
+L297: red r6
+not L42
+L298: .data 740, -512, -904, -901, -261
+sub r4, L216
+cmp *r7, #-210
+jmp *r5
+L299: .data 448, 886, 690, 319, -296
+red r5
+L300: not *r7
+red r3
+mov #198, L205
+L301: .data 862, 910, -261
+dec L260
+L302: inc r5
+L303: jmp L284
+L304: .data 957, 333, -712, -308, -491, 525, 633, 505
+lea L154, L143
+L305: prn *r7
+L306: dec L30
+L307: add L102, r1
+rts
+rts
+clr L141
+dec L216
+mov *r7, *r5
+L308: jsr *r6
+mov *r2, L43
+dec *r5
+jsr L61
+jsr *r6
+dec *r6
+L309: mov #4, *r5
+L310: mov *r1, r7
+prn *r0
+mov L153, *r2
+add *r6, L165
+not *r6
+L311: lea L146, r5
+L312: dec L264
+L313: rts
+L314: mov *r7, L239
+; comment
+prn L35
+L315: .string "udeeiwrdzowutevlnr"
+bne L139
+stop
+clr *r4
+bne L128
+
+add #159, *r2
+L316: jmp L52
+rts
+dec L129
+inc *r0
+L317: bne L125
+jsr *r1
+not *r4
+sub #-84, *r0
+bne L221
+L318: sub #-45, L132
+L319: not r3
+L320: not *r6
+L321: sub *r4, r2
+L322: inc r2
+L323: bne L215
+sub #-140, *r5
+jsr *r5
+inc *r5
+bne L64
+L324: mov L100, L89
+L325: add L155, *r7
+L326: bne L323
+jmp *r2
+L327: .string "uupbrxvdihgghqjxngjbxblo"
+L328: jmp L73
+prn L51
+dec *r4
+add *r5, r7
+jmp *r2
+not r0
+not r4
+clr *r0
+L329: inc L235
+add *r2, L220
+add #-31, L187
+L330: jsr *r1
+L331: stop
+not r1
+L332: clr L214
+L333: .string "aqfapjhahhl"
+sub *r2, *r2
+mov #-237, *r0
+rts
+L334: rts
+inc L183
+bne *r2
+cmp L1, #-256
+bne *r6
+red r6
+L335: not *r2
+L336: rts
+not r4
+not L28
+rts
+bne *r1
+jsr L264
+L337: .data 541, 431, 593
+jsr *r2
+L338: not r7
+
+prn r4
+sub #103, *r5
+prn *r4
+L339: .string "arcvmcdbbnijgo"
+bne *r7
+inc L195
+jsr L136
+L340: .string "silnebjua"
+L341: prn #108
+L342: .data 157, -11
+L343: lea L98, L102
+dec *r5
+rts
+lea L56, L327
+dec L238
+lea L216, r7
+; comment
+dec L130
+L344: inc r4
+cmp #-44, r6
+jsr *r4
+L345: not *r2
+stop
+lea L120, r6
+L346: not *r1
+L347: jsr L143
+dec r0
+not r7
+clr *r4
+L348: .string "abvhwihlqwnkuplss"
+jsr *r0
+not *r3
+L349: lea L246, r4
+clr *r6
+inc *r4
+bne *r6
+L350: jmp *r4
+L351: prn L221
+L352: rts
+sub L3, r0
+cmp #234, L339
+dec r0
+stop
+dec L267
+L353: cmp r2, r0
+stop
+clr r0
+cmp #-122, #-125
+jsr L231
+red r0
+jsr *r7
+rts
+sub r3, r5
+L354: jmp *r7
+bne L103
+L355: lea L124, L257
+not *r0
+inc *r0
+bne *r4
+bne *r4
+rts
+rts
+lea L257, L142
+stop
+L356: mov L280, L337
+prn *r7
+lea L252, r2
+dec L326
+L357: .data -790, -67, 727
+not *r1
+L358: inc r3
+jmp L177
+bne *r4
+mov L67, L179
+jmp L139
+stop
+jmp L87
+L359: cmp L70, *r0
+L360: rts
+red r4
+L361: not *r1
+prn L283
+jmp *r1
+L362: stop
+mov *r5, *r3
+jsr *r6
+L363: dec L284
+mov #-224, r6
+red L356
+add #19, L227
+lea L335, r3
+mov #249, *r0
+rts
+L364: .data 646, -778, -881
+stop
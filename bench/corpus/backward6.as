@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 7
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: jmp *r6
+add *r3, *r5
+jsr L0
+L1: cmp #-66, r1
+L2: jsr L1
+cmp #126, r2
+sub r1, *r0
+L3: prn #232
+L4: jsr *r2
+dec *r5
+L5: red r0
+; comment
+prn *r4
+jsr *r3
+L6: red r2
+inc *r6
+L7: red *r0
+dec r3
+L8: red L8
+jmp *r6
+jsr L7
+dec *r2
+not L0
+not L0
+L9: .data -513
+not *r6
+not L1
+prn *r1
+L10: .data 298, -364, -9
+L11: jsr *r5
+sub *r6, L1
+L12: sub *r7, r0
+L13: inc L10
+L14: .data -955, 410, 759, -233
+L15: sub L10, *r1
+stop
+mov L9, r4
+rts
+L16: clr L5
+red *r2
+L17: .data 49, -339, -805, 836
+inc r0
+L18: .data -731
+add *r4, *r5
+L19: cmp *r0, *r7
+sub #102, *r1
+add *r1, L7
+L20: .string "yhbkrosjsdv"
+L21: mov #-93, r0
+inc r3
+stop
+cmp r0, #-147
+L22: red r6
+cmp *r2, *r4
+bne *r1
+dec r2
+jmp *r2
+bne *r2
+dec *r0
+L23: inc r1
+cmp *r0, L3
+bne L21
+lea L16, L14
+L24: sub r4, r6
+stop
+L25: .string "weze"
+sub r4, r1
+prn *r4
+rts
+L26: .string "vccdqa"
+L27: not *r7
+cmp r7, *r4
+L28: .string "fzsjvdgbptem"
+L29: red r0
+L30: lea L13, L15
+bne *r6
+L31: prn L9
+L32: jsr L2
+not L0
+dec r2
+dec *r1
+; comment
+inc *r0
+prn L1
+prn #206
+L33: add L19, r5
+L34: .data -224, -425, -926, 628, 163, 264, -985
+L35: stop
+sub #147, *r5
+mov r3, L22
+L36: .data -957, 200
+inc r6
+
+L37: .string "eznbzcxzbksahbgsm"
+; comment
+L38: jsr L16
+L39: mov L1, *r2
+L40: inc r3
+L41: not L8
+add *r2, *r2
+mov *r6, L31
+
+L42: prn L40
+jmp *r5
+cmp #106, #141
+
+L43: stop
+
+mov #78, r3
+stop
+bne L3
+L44: cmp *r7, *r0
+L45: mov L8, L31
+L46: clr L21
+bne *r4
+jsr *r5
+not L29
+red *r6
+not L35
+L47: .data -526, 110, -962, -555, 371
+L48: cmp *r4, *r4
+prn L11
+cmp r7, L48
+jmp L4
+L49: clr L43
+L50: .data 227, 900, 311
+rts
+rts
+prn r1
+mov *r5, *r5
+lea L16, r5
+bne *r4
+sub *r4, *r2
+bne L49
+cmp r1, *r7
+add r3, *r1
+
+prn *r7
+L51: inc *r2
+L52: .string "sbqsa"
+L53: .string "kw"
+dec L6
+L54: lea L44, L19
+L55: inc *r6
+inc L14
+L56: cmp #-170, *r7
+red L33
+rts
+jmp *r4
+jmp *r3
+L57: inc r3
+jsr *r1
+not *r1
+; comment
+inc r4
+L58: .data -168, 254, 238, 991, -129, -113
+clr r1
+jsr L34
+lea L54, L25
+sub L3, r6
+; comment
+bne L47
+; comment
+L59: add #88, L29
+dec *r1
+rts
+bne *r7
+L60: .string "fpbdvuvyfutnibutegbt"
+L61: .data -575, 348, 688, -301
+mov L46, L38
+clr *r0
+bne L57
+prn r7
+L62: .data -176, -282, 987, 176
+rts
+red r3
+L63: lea L7, r6
+L64: dec r7
+inc *r2
+L65: jsr L35
+cmp #-81, r6
+L66: not L21
+L67: clr L19
+rts
+; comment
+L68: jmp L42
+mov r6, L51
+lea L68, L18
+lea L66, r0
+lea L5, L6
+add L41, r6
+red *r2
+L69: mov #-210, r1
+jmp *r6
+L70: lea L16, L20
+bne L8
+jmp *r2
+clr *r4
+sub *r2, L64
+not *r3
+rts
+L71: add L38, L64
+; comment
+L72: not r5
+L73: bne L51
+bne *r2
+red r7
+L74: inc r5
+rts
+sub #170, L26
+jsr *r6
+L75: dec r4
+L76: .data -584, 969, -272, 143, 132
+stop
+L77: inc L57
+clr r7
+lea L22, L40
+L78: jsr *r5
+lea L24, *r6
+clr L29
+clr *r3
+jmp *r2
+stop
+L79: jsr L11
+L80: .data -974, 320, -547, 342, -283, -409, -33
+prn #-128
+L81: clr *r1
+; comment
+L82: dec r5
+dec L41
+not *r1
+L83: lea L41, L7
+cmp L33, #-178
+jsr L17
+L84: prn r4
+L85: .data 100, 788, 730, -35, -213, 581, 786, 96
+jsr L30
+L86: stop
+L87: lea L61, r4
+L88: red r5
+L89: inc r5
+L90: lea L61, *r2
+mov *r4, r7
+L91: .data -468, -857, 99
+jsr L17
+L92: .string "ynmrjghlp"
+; comment
+L93: .string "zqkas"
+mov #-77, *r4
+cmp #247, *r2
+cmp #144, #-137
+clr r6
+red L73
+L94: prn L23
+inc r0
+L95: .data 132
+
+mov *r6, *r0
+jsr *r3
+L96: .string "kbnpttnanfpmbet"
+not r5
+L97: jsr *r3
+L98: stop
+rts
+cmp L32, r0
+L99: .data 59, -232
+L100: .data 541, 942, 556, -269
+stop
+bne L0
+rts
+red *r0
+clr r6
+jmp *r2
+jmp L69
+stop
+L101: bne L38
+clr r3
+sub #202, L16
+bne L26
+clr L60
+jsr L77
+clr *r4
+L102: inc L18
+prn *r5
+jsr L76
+rts
+red r3
+L103: dec L11
+add r7, L66
+cmp L37, #-251
+L104: dec *r2
+sub *r1, *r0
+red r4
+cmp L78, r1
+L105: red *r4
+L106: bne *r0
+mov *r7, r7
+prn L36
+add L95, r4
+L107: clr L30
+rts
+not r7
+inc *r3
+L108: cmp r1, r5
+prn *r2
+sub r3, L25
+L109: rts
+L110: dec r4
+L111: .data 531
+L112: sub #-70, *r3
+L113: .data -116, -186, 868, -820, -466
+
+stop
+rts
+clr *r6
+L114: stop
+L115: .string "clsmdrvzuwidtvhgmiot"
+L116: .data -307, -38, 488, 632, 923
+
+bne *r2
+rts
+bne *r0
+jsr L115
+jsr *r1
+L117: red L7
+L118: cmp L21, #-158
+sub r6, L85
+L119: prn #-87
+L120: lea L86, L32
+clr *r1
+L121: clr *r1
+L122: .data -663, 161, 638, 191, 222, -204, 204, 405
+add *r3, L97
+prn r7
+inc r0
+prn *r5
+red *r0
+L123: .data -215, 600, 810, 342, -149, -34, 410, 139
+L124: dec r4
+add r4, L84
+L125: cmp #5, L79
+L126: mov *r1, L75
+dec *r5
+jsr L84
+prn *r5
+
+inc *r1
+clr r2
+cmp #116, r7
+L127: bne L4
+L128: prn r2
+jmp L19
+not L45
+sub L70, r5
+add L68, *r5
+inc r4
+mov *r6, L35
+L129: cmp r6, #36
+jmp L93
+not r2
+add *r5, *r4
+L130: jsr L43
+L131: .string "ezxvmrsduhucnxxcb"
+rts
+L132: rts
+clr *r1
+prn r3
+jmp L36
+jsr *r0
+L133: jmp L53
+mov L30, L64
+L134: inc r6
+add #-97, *r6
+red r0
+sub L37, *r7
+L135: .data 532, -380
+lea L97, r5
+L136: inc r3
+sub L19, L25
+bne L33
+jmp L19
+sub r3, L46
+L137: stop
+cmp L19, *r4
+
+sub L114, r1
+sub L29, r7
+L138: stop
+mov #-194, r1
+L139: mov #140, L107
+L140: not *r2
+L141: jsr L90
+; comment
+stop
+cmp r4, L63
+bne *r5
+L142: .data -675, 475, -644, -977
+not *r5
+L143: sub *r0, *r5
+lea L45, *r5
+not r2
+L144: red L79
+add L96, L111
+L145: mov L45, *r7
+L146: red L80
+sub L86, r5
+dec *r6
+stop
+not L19
+not *r7
+clr r5
+dec *r6
+not r4
+rts
+L147: not *r5
+jsr L111
+L148: stop
+L149: prn *r1
+L150: sub r0, *r2
+jmp L15
+mov r1, L99
+inc L115
+clr L14
+add L137, *r0
+red L0
+clr r5
+add L127, *r5
+lea L43, L137
+
+
+jsr *r1
+L151: mov r0, r1
+jmp *r4
+L152: prn #-53
+L153: .string "vyhfgtlmsnv"
+add #72, r2
+L154: sub L151, *r7
+
+cmp L132, L135
+L155: sub #132, L63
+jmp L127
+L156: cmp #22, L135
+jmp L87
+jsr *r6
+L157: inc L138
+stop
+L158: .string "eyzxbsyjurzlxohpzutgj"
+; comment
+dec *r4
+L159: .string "soodklacfubhwjpsabawmh"
+L160: sub L76, r7
+L161: not *r7
+not r3
+lea L161, r2
+mov *r2, L136
+cmp L89, #110
+rts
+inc r0
+
+; comment
+L162: .data 330, -839, 725, -47, 572
+L163: clr L56
+dec *r3
+not *r0
+L164: .data -621, 614, -120, 691, 440
+dec *r5
+L165: clr L132
+not L123
+
+red L88
+L166: jmp *r5
+L167: cmp L91, r5
+dec *r7
+L168: rts
+L169: not L154
+L170: .data 225, -470, -264, 426, -536, 743, 395
+stop
+L171: .data -900, 35, -560, 731, -922, -712, 280
+dec r1
+mov #-86, *r5
+inc r0
+bne *r4
+; comment
+L172: .string "achwej"
+red L1
+L173: not L164
+L174: stop
+rts
+clr *r0
+jmp *r6
+bne L140
+dec L32
+dec r6
+L175: .string "awisinxtlm"
+jsr *r3
+cmp L159, *r6
+L176: sub *r2, *r4
+dec r0
+bne *r2
+stop
+L177: jsr L8
+red *r1
+mov L1, *r5
+mov #13, L99
+not *r4
+clr L100
+L178: prn *r7
+clr *r0
+L179: stop
+L180: lea L66, r0
+L181: mov #238, r6
+jmp L68
+sub *r5, L171
+L182: .data 816, -300, 156, -726, 670, -760
+L183: .string "avtcvtgcsgwnidtmhoedxkd"
+jsr *r2
+stop
+inc L8
+bne *r1
+L184: red L145
+clr r6
+jmp *r3
+sub r3, *r1
+dec L135
+L185: prn r7
+L186: .string "qdkdvixjpdlpygrwins"
+lea L174, r6
+not *r1
+sub #-223, L175
+cmp r2, *r4
+L187: sub L169, L78
+rts
+dec L144
+L188: jsr L106
+L189: clr r2
+stop
+L190: prn L20
+L191: not L164
+inc L179
+cmp L86, r0
+L192: bne L107
+mov L5, *r2
+L193: not *r1
+red r2
+L194: mov #148, L174
+L195: dec L154
+L196: .data 471, -491, -140, -871, -561, 593, 801
+L197: bne *r5
+not L48
+L198: clr *r2
+; comment
+L199: .string "hubjzlpordooydx"
+inc L104
+L200: .string "ygwhcgulrnivxoco"
+cmp *r7, #46
+L201: jmp *r2
+rts
+
+dec r2
+jsr *r2
+red r1
+L202: lea L190, r4
+L203: stop
+bne L166
+L204: .data 184, 268
+clr *r3
+L205: sub #184, *r0
+L206: red *r0
+L207: .string "hixiljmdtskapauoysdmhrc"
+prn #-63
+red L164
+L208: dec L182
+lea L45, r2
+L209: jmp L198
+jsr L143
+L210: inc r6
+
+stop
+L211: prn L162
+L212: rts
+mov r1, *r5
+jmp L192
+L213: jsr L115
+dec L49
+red L0
+add #-116, r4
+L214: .data 28
+L215: stop
+L216: bne *r0
+mov L154, *r0
+stop
+bne *r3
+rts
+bne *r7
+stop
+L217: .data 809, -572, -423, 338
+L218: sub L27, r2
+L219: not *r4
+bne L1
+clr *r4
+jmp *r2
+cmp L99, L156
+lea L162, *r0
+L220: cmp #213, L57
+add L70, r7
+jmp L9
+bne *r6
+add *r4, L172
+add L93, r4
+clr L116
+stop
+dec *r1
+L221: .string "n"
+red L178
+cmp *r1, L52
+clr L4
+jsr L207
+stop
+L222: .data -926, 517, -913
+L223: red L209
+stop
+rts
+dec *r7
+mov #92, r7
+lea L200, r1
+L224: bne *r3
+lea L165, L195
+jsr *r2
+L225: .string "xdckrlzpv"
+L226: dec r5
+mov #141, *r2
+L227: .data -24, 335, -918, 29, -988, 861, 759
+bne L71
+add r6, *r5
+lea L9, *r3
+L228: not *r7
+not L107
+L229: rts
+mov r2, r4
+bne *r2
+add r0, *r5
+prn r4
+not r5
+red r1
+
+L230: jmp L155
+L231: bne *r3
+jsr *r2
+lea L84, r2
+L232: rts
+L233: stop
+rts
+rts
+bne L44
+jmp *r6
+sub *r4, r1
+prn r6
+red *r1
+L234: .string "jyswexadplmtgonlyqibl"
+cmp r3, #-11
+dec L207
+rts
+inc *r6
+L235: .data 423, 244, -45, 452, -493, -271, 249, -959
+sub L146, L164
+prn #-75
+jsr L121
+L236: lea L47, L10
+
+add *r0, L1
+L237: cmp L206, *r0
+clr r6
+not *r5
+dec *r7
+jsr *r5
+red r6
+L238: prn *r1
+not *r6
+red L152
+dec L52
+L239: cmp #-208, L155
+
+L240: dec r2
+not *r3
+jmp *r3
+bne *r2
+clr L0
+L241: jsr *r7
+
+; comment
+L242: .data -206, 34, 851, 291, 262
+mov r2, r2
+L243: red L118
+inc *r3
+L244: .string "jevreovny"
+dec *r2
+red *r6
+jsr L16
+lea L120, *r6
+L245: sub L233, L106
+not L120
+L246: dec r7
+cmp *r4, r0
+prn *r6
+L247: not *r6
+L248: inc L209
+clr *r1
+red L153
+not *r1
+dec *r2
+stop
+L249: add r6, L171
+L250: .string "w"
+red r1
+mov #-89, r3
+L251: sub #-241, r1
+; comment
+; comment
+mov #28, L60
+L252: stop
+lea L205, L219
+rts
+prn #-170
+bne *r1
+bne L63
+not r4
+mov #196, r4
+stop
+L253: .data -30, 14, -540, -315, -405, 688, 982, 59
+sub r2, L65
+jmp *r6
+L254: sub r3, r6
+L255: inc r2
+L256: cmp *r4, L153
+L257: mov r4, L167
+inc L171
+prn #253
+bne *r4
+L258: jsr L155
+cmp *r5, L88
+L259: lea L117, r1
+clr L97
+rts
+L260: lea L128, *r4
+; comment
+L261: rts
+bne *r2
+not r4
+cmp #-54, r5
+prn *r7
+L262: dec L111
+L263: bne L163
+dec *r3
+mov #17, r5
+mov r7, L80
+bne L170
+stop
+jsr *r3
+bne *r1
+L264: stop
+add #215, *r6
+lea L121, L128
+L265: clr r0
+not *r0
+; comment
+L266: .string "gnaovvoga"
+L267: .data 601, -893, -463, 89, -837, -338
+not L82
+sub #-84, L88
+sub #80, *r5
+L268: .data 498, -759, -543
+add r6, L114
+jmp L203
+L269: add *r6, *r0
+dec L162
+add #-242, *r1
+L270: rts
+L271: add #-172, L94
+L272: dec L165
+clr r6
+L273: dec r2
+; comment
+stop
+L274: .data 212, 915, 649
+L275: .string "azknfvanwjgvdopmpen"
+jmp *r0
+rts
+L276: .data -306, 605, 986, -117, 143, -756, 194
+jmp L74
+L277: rts
+cmp *r0, L210
+not r6
+clr r3
+cmp r3, #19
+L278: .data 999, 518, 344, -180, 695
+jsr L25
+L279: mov L11, *r4
+L280: .string "bihgmslyuogfkunuu"
+; comment
+jmp *r7
+L281: red r0
+inc *r5
+lea L175, *r7
+cmp *r7, L247
+not *r2
+sub L53, *r7
+rts
+L282: add *r6, r3
+L283: add *r5, r0
+rts
+L284: not r4
+L285: add r4, *r1
+dec r7
+mov *r3, *r2
+sub L93, r7
+jmp L98
+not *r3
+L286: jmp *r1
+prn *r3
+sub r2, r4
+prn r1
+L287: .data -721, 353, -316, -163, 827, -175
+rts
+lea L255, *r7
+L288: .data -344, -294, 49, -764
+L289: mov #134, *r3
+L290: red r5
+L291: not r5
+L292: not *r2
+red L224
+lea L176, *r6
+L293: mov #148, *r6
+jmp L243
+L294: stop
+; comment
+L295: prn L47
+bne L112
+red r2
+L296: stop
+jsr L208
+L297: dec L20
+L298: cmp #186, L199
+dec L20
+prn L230
+sub #68, r2
+mov r7, L161
+clr L24
+L299: prn #-195
+lea L249, r4
+dec *r4
+lea L153, L194
+cmp r5, *r1
+
+not L248
+not *r0
+L300: jmp L270
+inc L189
+
+stop
+L301: lea L111, r4
+L302: jsr *r4
+jmp *r2
+dec r5
+L303: inc L65
+L304: lea L65, r3
+L305: sub *r2, *r1
+
+L306: .string "tq"
+; comment
+add *r1, *r1
+L307: .string "sjw"
+red *r3
+rts
+jsr L269
+L308: mov L138, *r2
+L309: inc L208
+not r5
+L310: add #-46, *r6
+L311: lea L7, *r7
+mov L243, r0
+L312: .data 326, -319, 325, 808, -389, -49, -205, 76
+L313: jmp *r6
+bne L169
+L314: .data 546, -365, 182, 702, 727, 958, -35, 799
+add L73, *r6
+L315: cmp *r5, r1
+L316: .string "yrfjmvew"
+jsr *r6
+L317: .string "r"
+L318: add r6, r3
+L319: .string "elzdxjxjgfcifjrcxflntz"
+cmp L268, *r5
+mov *r6, r6
+prn *r6
+dec r7
+cmp r3, L131
+clr r6
+L320: .string "ifiteqahnhjq"
+; comment
+lea L186, *r1
+L321: stop
+lea L223, L188
+red *r1
+L322: sub #-81, *r5
+rts
+L323: dec L266
+red r0
+stop
+bne *r7
+not *r0
+cmp r3, #-214
+L324: red *r4
+dec L101
+L325: .string "lrjc"
+L326: add L205, r0
+rts
+cmp L291, *r4
+not r2
+jmp *r0
+sub #-49, r4
+L327: clr *r4
+L328: .data 240, 748, 353
+inc *r2
+mov #-90, r2
+cmp r7, *r4
+L329: .string "dx"
+clr *r1
+rts
+red L271
+inc L203
+jsr *r3
+L330: bne L66
+dec r3
+rts
+clr *r1
+L331: .data 377, 472, -781, 571, -519
+red r1
+L332: .data -266, -966, 561
+
+
+L333: .string "r"
+clr r6
+cmp #-163, r4
+L334: add #-94, *r3
+L335: red *r2
+bne *r5
+clr *r3
+red *r6
+not L22
+jsr *r4
+rts
+mov r4, *r0
+L336: clr *r5
+L337: inc L51
+L338: inc *r1
+rts
+rts
+; comment
+L339: .data -698, -128, -272, 85, 130, -771, 220
+lea L296, *r1
+L340: dec r4
+L341: .string "kcuqckflpokdgnqoyu"
+L342: dec L121
+inc r2
+bne L121
+dec *r7
+L343: .string "ffsfcsnjzdajakapcxrsas"
+clr L257
+L344: clr r3
+sub *r4, *r5
+not *r6
+L345: .data 47, 612, 192, -483, 240, -593, 936
+jmp L229
+L346: prn r2
+sub r4, r3
+inc L314
+prn *r0
+lea L174, r2
+mov L242, *r4
+lea L212, r6
+jsr L25
+add L299, L47
+rts
+prn r6
+rts
+lea L29, r2
+L347: .data 360, -52, 809, 535, -285, -676
+bne *r4
+bne *r1
+stop
+inc L223
+mov L233, *r5
+; comment
+add *r2, *r1
+L348: jsr *r7
+L349: .string "rb"
+cmp *r4, *r2
+L350: cmp #209, #-118
+jsr L277
+jsr L157
+stop
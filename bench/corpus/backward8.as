@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 9
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+lea L269, L109
+L0: red *r6
+L1: .string "hnqoktsvim"
+L2: inc *r2
+prn L2
+
+inc *r5
+sub r1, *r3
+add r0, r4
+; comment
+bne *r4
+bne *r3
+L3: add r4, L2
+L4: sub L3, L1
+add r3, L2
+L5: cmp r3, L3
+add #-55, *r1
+dec r5
+L6: mov L3, *r7
+L7: .data -339, 479
+jmp *r6
+L8: .data -400, -750
+L9: red L3
+prn #44
+prn L1
+L10: cmp L1, *r2
+jsr *r6
+L11: stop
+bne L2
+L12: stop
+L13: mov L13, r5
+; comment
+L14: add r6, r6
+rts
+dec *r5
+L15: mov L10, L15
+bne *r3
+bne L7
+sub r3, *r2
+cmp L14, L2
+bne *r3
+sub *r2, r0
+red L15
+L16: clr L13
+add *r3, L14
+clr L7
+stop
+L17: .string "fdobuvura"
+not *r3
+L18: inc r3
+bne L12
+bne *r6
+dec r2
+inc r3
+L19: dec r1
+sub L8, *r7
+bne *r7
+L20: mov r3, *r3
+mov #-82, L18
+not L19
+L21: jsr L7
+clr L20
+prn L16
+lea L4, L2
+L22: clr L1
+bne L14
+L23: .data -568, 35, 324
+jsr *r6
+stop
+L24: stop
+; comment
+stop
+lea L1, *r1
+L25: lea L8, *r2
+bne *r2
+inc L7
+L26: cmp #229, r6
+rts
+red r2
+stop
+jmp L7
+L27: .data 449, -458
+lea L7, *r5
+sub #-144, *r0
+rts
+jsr *r5
+L28: .string "cairp"
+lea L17, r6
+mov L20, L4
+rts
+L29: .string "gufvtvndysdpvjnq"
+L30: bne L13
+L31: .string "jgegugnlpj"
+L32: rts
+L33: jmp *r7
+L34: .data -628, -961
+add L15, *r3
+bne *r6
+L35: jsr *r0
+L36: jsr *r6
+L37: .string "xcqntzg"
+prn L26
+L38: add r6, *r6
+rts
+inc *r5
+L39: not r7
+L40: not *r4
+jmp L40
+L41: .string "occgtfowdpmn"
+sub L41, r5
+L42: .data -500, 461, -683
+L43: clr L15
+jmp *r6
+cmp r4, L24
+bne L3
+; comment
+L44: .string "jjnqcnnkhmfzqdrldi"
+red r3
+L45: .data 600, 218, -691, 892
+sub L44, L19
+L46: mov #73, r0
+L47: jmp L41
+cmp L33, *r7
+red *r5
+stop
+stop
+add #38, L38
+prn L36
+L48: jmp *r0
+bne *r3
+sub #149, *r1
+L49: mov *r7, L1
+clr L11
+L50: add *r6, *r6
+rts
+bne L47
+add #-179, L26
+L51: .data 999, 85, 510, 477, -978, 522, 778, -795
+L52: jsr *r1
+not *r2
+inc r3
+clr L18
+jsr *r2
+sub *r7, r0
+prn L22
+; comment
+L53: not L47
+L54: add *r1, r5
+inc r0
+jmp L14
+L55: jsr *r6
+mov #119, r5
+L56: not *r0
+clr L34
+sub #-115, r4
+L57: jmp L0
+L58: sub *r6, L42
+L59: add r4, *r7
+mov *r2, r3
+clr r4
+rts
+L60: prn L58
+add r2, r6
+bne *r5
+cmp #-46, r3
+; comment
+L61: clr L60
+L62: prn #11
+red L62
+cmp #-88, r2
+L63: dec L40
+L64: not *r3
+L65: rts
+L66: stop
+cmp *r1, L22
+red *r2
+inc r3
+jmp L22
+stop
+L67: clr *r4
+L68: prn #-238
+L69: add #-217, L19
+red L4
+L70: rts
+rts
+jmp L65
+L71: inc r7
+L72: add *r2, *r6
+red L64
+prn L7
+red *r5
+L73: jsr *r2
+rts
+stop
+lea L27, L20
+jsr *r1
+lea L18, *r5
+bne *r4
+sub r6, r7
+red L9
+red *r4
+cmp L59, *r0
+L74: bne *r2
+prn #147
+dec *r6
+clr *r3
+stop
+bne *r5
+cmp L72, #-145
+L75: .data -427, 475, -612, -154, 791, 957
+inc r7
+bne *r0
+jmp L2
+add r7, *r5
+dec *r4
+
+red L31
+L76: stop
+L77: jsr *r4
+L78: sub #7, L3
+add #-178, r6
+L79: sub r2, L68
+add #-128, L16
+jsr L77
+mov L77, r3
+L80: .data 410, 266, -253, 223
+stop
+lea L11, r4
+mov #-226, r1
+jsr L25
+L81: jsr L47
+stop
+red *r4
+L82: .data -686, 901, 919, 409, 593, -497, -579, 425
+L83: .data -712
+jsr *r1
+
+prn *r0
+L84: dec *r6
+clr r4
+L85: sub #158, r4
+inc r6
+L86: clr *r4
+L87: .string "dkxrjdkleyvxeoyusxbw"
+dec r2
+L88: rts
+jmp L70
+L89: jmp L56
+L90: .data 775, -366, 960, 182, -655, 151, 110, -916
+jmp L72
+not r5
+L91: sub L26, r7
+; comment
+L92: .data 549, 23, -224, -637
+L93: jmp L23
+L94: stop
+L95: sub L89, *r3
+L96: clr *r0
+rts
+sub *r7, *r5
+L97: red *r1
+lea L37, L68
+L98: stop
+stop
+inc r6
+cmp L35, *r5
+cmp *r0, L17
+stop
+L99: dec r7
+L100: prn L39
+dec L56
+jsr L66
+mov *r1, *r2
+L101: stop
+stop
+L102: inc L22
+L103: cmp #36, *r3
+not r5
+L104: .data -401
+L105: lea L35, *r1
+L106: dec L49
+L107: .data -999, 418, 547, -995
+lea L70, L79
+mov #172, L27
+L108: .string "ifayknmrlsuhv"
+jsr L28
+; comment
+stop
+L109: .data 149, 997, -510, -450, -439, -569, -41
+L110: red L57
+L111: .string "biys"
+bne L25
+sub L33, L4
+cmp r0, r6
+L112: red *r5
+
+
+
+jsr L87
+L113: sub r2, L53
+L114: rts
+stop
+add r1, *r2
+prn r1
+L115: stop
+dec L6
+L116: prn #243
+L117: stop
+L118: add L108, L72
+stop
+mov *r4, *r3
+L119: .data 92, -611, -989
+L120: jsr L117
+L121: red *r2
+cmp *r1, r2
+lea L25, L21
+jsr L23
+stop
+lea L36, *r4
+cmp L73, L49
+stop
+L122: dec r5
+L123: mov *r4, *r6
+L124: jmp L82
+; comment
+add #248, L52
+not r4
+jmp *r6
+rts
+not *r2
+inc r3
+L125: not *r0
+lea L11, L74
+bne L48
+mov r5, L77
+add L45, L95
+bne *r3
+L126: jsr L34
+clr r1
+bne L29
+L127: .string "sskct"
+cmp #168, *r1
+stop
+rts
+red r6
+cmp L11, #75
+L128: jmp *r0
+rts
+L129: jsr *r2
+prn r2
+prn L92
+L130: prn #17
+L131: lea L7, *r1
+inc L23
+inc r7
+L132: dec *r5
+L133: jsr L1
+clr L111
+L134: sub L118, *r6
+clr r5
+L135: jmp *r4
+cmp L92, *r1
+stop
+clr *r2
+L136: red r6
+L137: .data 419, -812, -623
+jmp L118
+L138: cmp r3, L35
+bne L117
+L139: inc r0
+clr r6
+sub *r2, L106
+L140: lea L12, *r6
+clr L92
+dec *r5
+stop
+prn #-221
+clr *r2
+L141: sub *r0, r2
+mov L4, r0
+sub #-130, r2
+L142: .string "kkwtgwz"
+; comment
+dec L83
+not L20
+L143: sub #135, L122
+L144: sub *r4, r6
+L145: bne *r2
+clr *r4
+L146: cmp *r5, *r0
+cmp #101, *r2
+L147: .data -60, -185
+dec L94
+not *r6
+red L30
+rts
+sub #-14, *r5
+jmp *r6
+L148: inc r0
+sub *r1, L138
+L149: jmp *r3
+cmp #115, L28
+bne L113
+prn *r4
+L150: stop
+prn *r1
+sub *r4, *r2
+L151: prn #29
+L152: add *r2, r2
+sub L43, L54
+mov #-148, r4
+L153: stop
+red r0
+L154: .data -991
+add r2, r2
+clr *r6
+jmp L57
+add *r1, r6
+
+L155: cmp L132, *r3
+dec r6
+L156: lea L5, *r2
+lea L76, L39
+L157: prn #40
+add r7, r5
+L158: red r6
+sub #-231, *r2
+bne *r0
+mov #2, r6
+rts
+bne L101
+L159: jmp L106
+L160: cmp L34, #-151
+jmp L114
+L161: not L97
+lea L58, *r3
+L162: .data 728, -529, -77, 770, -375
+L163: mov L82, *r6
+; comment
+dec L10
+dec L15
+cmp L17, #-81
+jsr L24
+L164: prn r0
+not L65
+L165: lea L61, L87
+jsr L103
+L166: red r6
+clr L118
+rts
+L167: .data -649
+red *r4
+bne L97
+prn r0
+rts
+rts
+; comment
+stop
+inc L111
+jmp L84
+rts
+L168: jsr *r1
+L169: .data 668, -757
+jsr *r1
+L170: not *r5
+red L11
+L171: rts
+rts
+stop
+L172: bne *r2
+not L26
+L173: stop
+L174: add *r3, L97
+L175: jsr L30
+clr *r0
+mov L157, *r0
+red *r7
+L176: red L56
+L177: sub *r3, r7
+sub *r0, L138
+L178: jsr L154
+prn #-182
+dec L132
+
+mov L130, *r0
+L179: lea L75, r2
+L180: cmp r2, #107
+bne *r5
+L181: dec L96
+L182: rts
+stop
+prn r7
+L183: .string "kaaaqhemswfz"
+L184: .data -193, 775, 55, -830
+L185: jsr *r2
+cmp *r3, #170
+mov #148, L129
+L186: .data -275, 788, 518, -85, -682
+L187: sub L13, L13
+lea L147, L39
+not r2
+L188: stop
+bne L95
+clr *r7
+jsr L108
+L189: .data 240, -601, 707, 793, 921, 966
+L190: jsr *r6
+L191: dec r7
+lea L41, *r7
+L192: stop
+L193: bne *r1
+jsr L35
+stop
+jsr L19
+jsr L142
+bne *r1
+clr *r5
+jmp *r1
+dec *r4
+L194: prn #-174
+mov #-225, r7
+rts
+L195: red r5
+; comment
+L196: mov #-2, *r2
+jmp *r7
+clr *r1
+mov r4, L89
+add r4, L73
+; comment
+sub r5, r0
+L197: lea L156, L112
+inc r4
+L198: inc *r2
+prn #-205
+inc L192
+cmp *r6, #-203
+L199: dec *r3
+L200: .data -577, 139, 505, 258, 744, 716
+prn L8
+inc *r1
+jsr L83
+cmp *r1, r7
+jmp L5
+mov L182, r5
+sub #247, *r4
+jsr *r0
+add L92, *r3
+L201: .string "ygd"
+L202: cmp #230, *r1
+clr r4
+cmp L182, r7
+clr *r1
+L203: sub L21, r1
+dec *r1
+
+jmp *r0
+L204: jmp *r2
+red *r5
+mov #228, *r6
+lea L118, *r6
+inc *r6
+inc L78
+not r2
+L205: .data 783, 989, 441, -585, 974, 20
+L206: cmp r0, L128
+bne *r1
+L207: prn #-17
+cmp L96, r6
+jsr L78
+add r4, *r5
+cmp #-122, L101
+inc *r1
+stop
+L208: .string "nazgcunrwdostl"
+sub *r0, *r1
+L209: .data -316, -678, 406, -236, 587, 2
+L210: sub #251, L143
+cmp #-256, r7
+sub *r0, r4
+mov #34, L54
+L211: .data 453, 598, 343, 543, -997
+L212: .string "qekbcdzchfamxghppawbzoao"
+L213: inc *r6
+L214: prn r5
+L215: bne *r0
+rts
+lea L158, *r6
+cmp L125, L104
+red r3
+L216: .data -489, -547, -177, -452
+L217: .string "frvmqevqskcubunyizompbfk"
+mov r4, L164
+bne L104
+L218: sub r3, *r5
+L219: .string "wrfgisuffenxafrgtqjdd"
+cmp *r0, *r0
+; comment
+lea L126, r5
+bne *r7
+L220: .string "pxspvqghhcgcfaxjok"
+sub #212, L37
+L221: not *r3
+L222: red r6
+L223: add *r7, L86
+L224: stop
+add *r6, L118
+inc L175
+bne L149
+jsr L113
+prn L105
+prn #-109
+L225: dec *r4
+add *r0, *r4
+stop
+L226: prn L136
+not L31
+L227: lea L86, L79
+L228: jmp *r6
+rts
+L229: jmp L96
+L230: not *r2
+mov *r4, r4
+L231: lea L62, r7
+red *r5
+dec L45
+dec *r7
+not r3
+L232: dec L17
+L233: jsr L137
+add r4, *r3
+L234: not *r5
+add #74, *r4
+inc r7
+sub #-18, r6
+prn r0
+cmp #231, L78
+lea L101, r7
+not *r0
+lea L209, r3
+L235: mov #216, *r7
+L236: clr *r2
+bne L166
+jmp L121
+clr *r4
+L237: .string "tgtgyvysymr"
+
+jmp L103
+L238: jsr L63
+stop
+L239: prn r4
+L240: mov *r0, r5
+not *r6
+add L33, L192
+jsr *r1
+L241: add L134, L93
+sub #-18, *r0
+L242: dec r6
+
+rts
+L243: .string "tqcicqppbaeqpiogmoxwt"
+L244: jmp L159
+clr *r3
+L245: .string "hfrkgwpcqdpwwasmfk"
+L246: dec L160
+rts
+mov #114, *r3
+inc L242
+clr r0
+L247: sub L57, L182
+bne *r0
+clr L196
+mov L155, L119
+
+L248: .string "ldihilfhewuvm"
+jsr L191
+L249: .string "taeywtczascehpbwqbtbo"
+L250: clr r7
+mov #127, r0
+L251: .data 636, 652, 998, 510, 127
+inc *r5
+clr r2
+L252: rts
+prn L220
+sub L76, *r0
+L253: jsr L168
+cmp L174, #-172
+L254: .data -629, 733, -328
+not r6
+L255: sub r3, L203
+L256: red r2
+prn *r5
+add #-55, L229
+dec L233
+L257: inc *r2
+prn r7
+jmp L226
+; comment
+clr *r2
+clr r4
+L258: dec L170
+L259: prn r3
+; comment
+mov L123, r0
+rts
+L260: .string "xsesgcxovhmjilq"
+rts
+L261: bne L10
+clr *r4
+cmp #-33, #-29
+prn *r0
+
+dec *r0
+L262: .string "yv"
+L263: .string "nzs"
+sub #-23, L53
+dec *r3
+clr L4
+L264: bne *r7
+; comment
+jmp *r2
+not L233
+rts
+L265: not r1
+rts
+L266: prn L256
+jmp *r2
+L267: jsr L49
+L268: .string "oemiatsbrofclqdr"
+prn r1
+mov *r4, L85
+L269: add r2, *r4
+L270: add *r6, r7
+L271: clr L54
+dec *r0
+L272: .data -822, 931, 578, -837, -413
+stop
+sub *r5, *r5
+L273: mov L53, L181
+clr *r4
+rts
+dec *r7
+mov r2, L56
+red *r2
+stop
+L274: stop
+prn r2
+L275: jmp L212
+bne *r5
+L276: .string "ghawabcmnkrmvsq"
+sub L74, *r1
+; comment
+prn *r2
+L277: .string "nzdjvpixvgzj"
+not *r5
+L278: jsr *r4
+add r6, r1
+dec L135
+clr *r3
+add L136, *r3
+L279: cmp #-167, *r1
+red *r5
+L280: .string "buttyiysymycn"
+red *r0
+rts
+red L12
+rts
+L281: cmp r2, r1
+cmp L98, #-210
+inc r5
+L282: not *r3
+mov L121, *r0
+sub #-210, r1
+rts
+jsr L125
+
+mov #-150, *r6
+L283: stop
+inc r6
+L284: .string "zabmmdwatrdqkxjmf"
+add #-213, r4
+L285: .string "pl"
+lea L264, r5
+cmp #214, *r6
+stop
+mov #-210, *r1
+jsr *r5
+stop
+L286: jmp *r2
+inc L280
+add *r4, L36
+L287: jsr L95
+L288: sub r5, L59
+inc r5
+add r0, r6
+rts
+L289: bne L268
+L290: .string "lgb"
+not *r4
+
+lea L166, *r2
+L291: .string "euxvj"
+dec *r7
+add *r1, L219
+jsr L264
+L292: .string "cohrdrrgthidxkxkfp"
+clr *r5
+rts
+L293: not r2
+inc r3
+L294: .string "cuotyexsklvpo"
+mov r1, r4
+L295: add r3, r1
+L296: .data -37, -61, -529, 841, -20, 951, -811, -934
+L297: .string "kefoebssdtidjv"
+stop
+lea L163, L121
+cmp #160, #-248
+rts
+
+mov *r1, *r1
+
+inc r1
+stop
+prn #-56
+L298: mov *r5, L3
+lea L45, r7
+L299: clr *r3
+jmp L276
+stop
+stop
+add r2, r2
+jmp *r7
+
+dec L19
+not *r5
+mov *r1, r2
+L300: dec *r3
+stop
+lea L3, r7
+L301: rts
+add L194, *r6
+L302: jsr *r2
+lea L21, r5
+bne L88
+L303: bne L20
+rts
+dec *r1
+not L267
+L304: jsr L240
+L305: .string "b"
+stop
+
+
+cmp L84, *r4
+mov L271, r7
+jsr L156
+mov r5, *r7
+L306: .string "wgmnypmmhavezqiinuqpeo"
+L307: jsr L236
+; comment
+bne L90
+inc L248
+prn #148
+lea L11, r4
+inc r2
+; comment
+L308: .string "bywzp"
+L309: not L31
+L310: add #-161, *r3
+add #151, L22
+dec L275
+jsr *r6
+L311: inc *r7
+mov L212, r5
+L312: mov #7, r3
+rts
+L313: .data 528, -250, -475, -865, 439, -180, 774, 252
+L314: red *r4
+L315: sub *r6, *r4
+jmp *r1
+red *r7
+not *r0
+clr r3
+mov #-137, *r1
+clr L281
+L316: .data 50
+clr *r5
+prn #81
+lea L62, L295
+not *r2
+prn #150
+L317: .string "lamtmstteufqgaz"
+rts
+bne L128
+cmp *r4, #103
+inc *r0
+prn *r2
+L318: .string "wdcivdsrhyho"
+L319: inc L18
+L320: add r1, r5
+cmp #97, L81
+not L267
+jsr L303
+jsr L317
+stop
+L321: .data 9, 658, -691, 105, 827
+L322: not *r3
+prn *r1
+dec r3
+stop
+jmp *r4
+rts
+L323: lea L264, r4
+L324: clr *r1
+
+L325: .data -684, -598, 516, -742, 168, 297
+L326: inc L155
+stop
+cmp L154, *r1
+jsr *r1
+L327: cmp L280, #109
+bne *r5
+L328: clr r3
+L329: .string "qnlesaxbgmfhspendfbii"
+clr r7
+L330: jsr L164
+L331: sub L252, *r6
+cmp *r7, #215
+clr *r1
+not L74
+red *r3
+bne L110
+L332: cmp #109, #189
+L333: .string "qxxbpthqgmzofeeqpm"
+sub *r0, r2
+cmp r7, #-172
+prn #167
+prn *r6
+L334: red *r0
+add r3, *r0
+L335: .data -561, 258, -545
+mov L163, r0
+L336: clr r2
+L337: mov *r3, *r6
+L338: bne *r3
+rts
+jmp *r2
+red *r2
+not r3
+bne *r1
+add *r1, L31
+inc L82
+jmp *r6
+sub L258, *r0
+sub L212, L329
+prn *r2
+prn r4
+L339: .data 384, 439, 398
+red r0
+L340: .data -320, -696, -560, -651, 70, -88, -488, 97
+L341: not r1
+L342: jmp *r6
+sub r2, L322
+L343: .data -856, 13, -921, -589
+sub L230, r0
+jsr L3
+L344: mov r5, r1
+L345: red *r2
+inc r5
+L346: not L10
+dec *r6
+bne L138
+not L345
+bne L159
+rts
+not *r6
+L347: .data -545
+L348: lea L123, r4
+clr L187
+lea L334, r5
+not r6
+red L190
+clr r6
+rts
+lea L215, *r6
+L349: cmp #-177, r2
+bne *r1
+red L158
+L350: inc L149
+add #-242, r3
+add L92, r1
+red r7
+; comment
+bne L64
+clr r0
+inc *r0
+stop
+lea L171, *r0
+jmp *r3
+stop
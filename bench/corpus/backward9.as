@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 10
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: rts
+cmp L0, L0
+inc L0
+L1: jmp *r7
+L2: stop
+L3: .string "aooopas"
+dec L2
+inc r6
+stop
+L4: not L0
+L5: .string "civynodb"
+prn L2
+not r6
+add #-157, r0
+L6: jmp *r1
+inc r1
+rts
+jmp *r5
+prn r2
+stop
+bne L5
+stop
+add r7, L5
+not r2
+jsr *r0
+not r5
+rts
+dec L2
+L7: lea L2, L3
+not L4
+clr *r5
+clr L3
+
+L8: red r7
+L9: rts
+mov r7, r0
+L10: dec r4
+cmp L8, r6
+jmp L5
+mov #-54, *r2
+add *r3, L4
+not r2
+L11: add L0, L2
+L12: cmp #18, *r4
+L13: jsr *r1
+jsr *r2
+L14: not r6
+dec r5
+prn r3
+L15: prn r6
+L16: .string "xucbusjzy"
+L17: sub r5, r2
+cmp #-143, L15
+L18: jsr L7
+L19: mov L8, r6
+jmp *r7
+jsr *r6
+L20: red *r1
+; comment
+clr r0
+L21: clr *r2
+L22: rts
+jmp L12
+L23: .data 123
+prn L14
+lea L12, *r3
+L24: rts
+inc L7
+stop
+mov r7, r7
+L25: add #14, L25
+bne L21
+L26: inc *r1
+red r5
+stop
+bne L15
+lea L15, r4
+add *r3, *r3
+sub *r6, L14
+lea L9, *r6
+L27: .string "ljsvhhjmnpy"
+L28: mov r2, L22
+L29: add L27, *r4
+L30: prn *r4
+add #106, L2
+L31: cmp #-50, *r1
+lea L9, L14
+rts
+clr *r1
+L32: .string "kzrqkkg"
+L33: sub L16, r3
+mov *r0, *r1
+stop
+L34: jmp L20
+jsr L3
+inc *r4
+L35: .string "azhlukgfel"
+L36: .data 555, -308, -110, 675
+L37: mov L32, *r2
+L38: sub *r7, *r5
+L39: sub L37, r2
+clr r3
+jsr L14
+; comment
+L40: lea L19, r6
+prn *r4
+cmp L0, *r4
+L41: not r0
+sub *r4, *r2
+mov L20, r1
+L42: bne L1
+L43: .string "anyfdtbfnxqztdgxbfkf"
+inc L33
+L44: bne *r1
+cmp #-212, *r2
+L45: .string "anehdranwkmdrzvlvo"
+clr r5
+L46: inc *r2
+sub L30, *r7
+L47: not r3
+prn r3
+L48: cmp r3, #77
+L49: clr r4
+stop
+L50: .string "agvywanipquexkqh"
+L51: .string "ztmxjpenuzrsbdzepdmqdew"
+lea L19, *r0
+dec *r6
+clr L50
+jmp L22
+L52: prn *r3
+L53: .string "drwumf"
+L54: stop
+; comment
+add #-110, *r0
+L55: jsr L30
+lea L50, r3
+dec *r6
+L56: sub *r3, L12
+
+cmp r5, L11
+add *r5, *r7
+lea L29, *r2
+L57: cmp *r0, #155
+prn r6
+L58: prn L50
+L59: stop
+jsr *r6
+red r0
+L60: .string "oyrtothgbjipzbdmk"
+add L13, *r3
+L61: jmp L25
+L62: red r4
+clr *r2
+add r6, L53
+L63: .data 384, 277, 615, 146, 413, -694, 413, -644
+; comment
+mov r0, L6
+rts
+lea L34, *r1
+dec r0
+add #60, r1
+L64: clr L53
+cmp #23, r6
+; comment
+L65: lea L65, *r1
+L66: dec r0
+not r4
+jsr L24
+L67: rts
+jmp L18
+L68: stop
+add r3, L16
+not *r1
+
+red *r3
+add *r7, r7
+L69: mov r6, L62
+jsr *r6
+L70: .string "dlp"
+lea L12, L1
+inc *r7
+inc *r5
+L71: jmp *r3
+clr r3
+lea L67, r2
+
+dec *r2
+bne L46
+bne L28
+L72: prn *r7
+L73: .string "tkejpqlnmrrvciv"
+L74: red *r6
+cmp L31, r4
+red L45
+rts
+L75: stop
+L76: red *r5
+add r1, r6
+bne *r2
+sub #-5, r6
+L77: .data -427, -636, -731, 412, -40, -533, -923, -724
+stop
+clr r1
+dec L32
+jsr L58
+add L54, r6
+L78: .data -965
+mov *r7, *r6
+
+L79: red r2
+prn L65
+dec L12
+clr r5
+L80: stop
+L81: clr r0
+sub r0, r2
+L82: .data 428, 906
+L83: .data 53, -28, 957, 144
+bne *r6
+add L83, r2
+sub #-136, *r2
+lea L45, L57
+sub r7, *r3
+clr L19
+sub r5, r1
+L84: prn L19
+L85: mov *r1, L47
+jmp L40
+clr r6
+L86: .data 957, -673, -674
+inc L22
+add r5, L54
+L87: sub L66, *r6
+sub L37, L54
+bne L60
+L88: .data -563
+dec *r7
+prn #54
+jsr *r4
+L89: .data -942
+red *r0
+jmp L75
+lea L36, *r7
+sub *r6, r1
+L90: red r1
+prn r6
+
+bne *r3
+prn *r5
+L91: prn r7
+dec r2
+cmp #30, r1
+lea L56, L62
+cmp L60, r6
+
+L92: .string "vhjnaxdplglrnpdzg"
+; comment
+L93: inc *r1
+dec L55
+L94: jsr L78
+not r1
+inc r1
+cmp #-39, #-59
+L95: .string "knmniqzwhdlc"
+mov *r2, r0
+add #-216, L95
+sub #-186, *r3
+add *r2, L90
+L96: .string "zsmkemizaexcpitqrazhfpb"
+bne L70
+bne L60
+jmp L75
+L97: inc L12
+inc L4
+sub L5, *r1
+not r2
+clr L6
+red L92
+cmp *r3, r4
+lea L40, *r1
+sub L74, r3
+clr L84
+L98: stop
+bne *r7
+bne L45
+jsr *r3
+rts
+cmp L0, #199
+L99: lea L9, L23
+not L65
+L100: jsr L81
+add r4, L79
+add r4, r2
+rts
+L101: mov r1, L33
+cmp r3, #147
+sub L84, *r6
+clr *r5
+mov *r2, L93
+mov L58, r1
+L102: dec L98
+
+L103: not r7
+sub #-167, L102
+inc L84
+prn L98
+add *r4, *r0
+red *r7
+dec L20
+jmp *r5
+L104: red *r0
+L105: .string "svfisgbekw"
+sub L4, L99
+jmp *r7
+L106: inc L18
+L107: .string "hdgarnarktfnfacly"
+rts
+; comment
+L108: prn *r6
+rts
+add r5, *r4
+L109: clr L79
+L110: jsr L15
+rts
+prn #134
+L111: bne L107
+red r1
+L112: clr r0
+stop
+L113: clr r4
+add #20, r6
+L114: not *r4
+mov *r3, L44
+L115: rts
+add r7, r0
+stop
+stop
+L116: red *r6
+mov r6, *r1
+mov #-45, *r0
+L117: .string "orkukq"
+L118: not *r5
+
+L119: add L1, *r5
+rts
+clr L90
+cmp L27, r2
+L120: prn L10
+clr L10
+red r0
+L121: .data 794, -331, 465
+lea L39, L11
+L122: red *r3
+red r5
+jsr L57
+L123: prn #67
+L124: lea L35, *r4
+L125: jsr *r3
+L126: sub r7, *r3
+cmp r1, *r5
+L127: mov #-208, *r6
+red L94
+sub r7, *r3
+cmp #-149, r4
+L128: dec *r3
+bne *r5
+inc *r6
+add r4, L54
+inc r2
+not *r4
+jsr L41
+L129: .data 785, 887, 845, -517
+L130: stop
+not *r0
+red *r0
+L131: .data 668, 934, -267, 386, -554, 314
+inc L74
+L132: .data 594, -236, 476
+sub #105, *r3
+L133: clr *r0
+prn r2
+jmp L82
+L134: prn r3
+L135: sub L52, *r6
+rts
+sub L80, *r4
+L136: .data 266, 746, 501, -947, -700, 756, -650, -855
+red L40
+L137: bne L111
+L138: prn *r4
+
+not r2
+
+lea L16, r1
+not r2
+; comment
+add #200, r2
+L139: lea L139, *r6
+jsr *r4
+L140: jmp *r1
+
+not L108
+mov r6, r2
+jsr *r0
+L141: prn *r4
+L142: stop
+clr *r0
+clr r6
+jmp L105
+add r0, r2
+not r6
+; comment
+rts
+lea L70, *r3
+prn #-181
+jsr L123
+L143: .string "ystmnzibfkkzdrapmz"
+L144: bne *r4
+jsr L21
+bne L59
+dec L25
+lea L3, *r5
+add L2, r7
+rts
+L145: lea L60, *r7
+inc L70
+
+red *r6
+L146: add r3, *r2
+L147: .string "cdoipefzc"
+add *r3, L81
+sub r6, L1
+L148: dec L109
+L149: red r0
+mov r2, *r1
+L150: bne L13
+mov L39, r1
+L151: jsr L42
+L152: .string "ajkvgcptywcuudnttuxkqkb"
+L153: .data 830, -31, 323, 794
+prn r2
+L154: not L58
+rts
+L155: .string "race"
+L156: .string "mxbhqzqbaatyabufblwfr"
+jmp *r2
+lea L119, r2
+L157: .string "pzbxgflsrbcbmoc"
+bne *r6
+mov #247, L148
+L158: dec L73
+cmp #-223, #28
+cmp L100, *r7
+L159: clr r4
+cmp L66, r0
+
+L160: .string "kfcrtztmzoeoozyhczfdu"
+not r1
+prn L156
+L161: not *r4
+L162: .string "nbffbdsuixxc"
+
+sub #-7, L122
+not L15
+L163: sub #-107, *r5
+L164: inc r5
+red r0
+L165: rts
+L166: cmp r3, #84
+L167: inc *r0
+not L21
+clr *r6
+red L66
+inc L86
+jmp L159
+jsr L23
+; comment
+rts
+add L133, r7
+jmp L27
+lea L52, L77
+L168: red r5
+L169: clr L169
+L170: bne L131
+add *r7, r2
+L171: inc *r2
+cmp L29, *r0
+L172: dec L25
+inc *r7
+not *r3
+prn r4
+L173: .string "fpgy"
+L174: not r4
+L175: .data 765
+stop
+jsr L123
+lea L84, *r2
+; comment
+L176: .data 799
+rts
+sub r5, r4
+L177: rts
+sub L16, r3
+stop
+lea L44, *r4
+L178: sub L61, L97
+jmp *r5
+jmp L157
+mov L33, r2
+jmp *r1
+dec *r6
+L179: clr *r3
+clr r1
+add #-136, *r2
+L180: inc L64
+L181: .data -759, -239, -937, -360, -831
+L182: red *r3
+dec L143
+sub *r6, r4
+jsr *r1
+red *r2
+jmp L60
+add *r4, L91
+L183: .data 77
+not *r1
+L184: .data -528, 196
+L185: jmp *r6
+not *r3
+L186: sub L67, r7
+inc L183
+L187: clr *r0
+cmp L179, r0
+mov #-53, *r3
+L188: cmp #-39, r1
+stop
+L189: .string "bfgiry"
+jsr *r1
+red *r7
+L190: lea L58, L162
+dec *r2
+L191: dec L189
+L192: .data 62, 274
+jsr *r4
+red L70
+L193: red L56
+prn L59
+add r1, L142
+inc L61
+not L119
+lea L101, *r4
+sub #140, L10
+jsr *r7
+inc *r5
+L194: lea L109, L20
+L195: inc r5
+L196: red *r3
+inc *r7
+L197: .string "wqibvnlzmidnuwbw"
+jsr *r7
+jmp L51
+bne *r5
+dec r3
+lea L22, *r0
+L198: .data -183, -957, -382, 306, 498, 66, 329
+red L166
+lea L167, *r3
+L199: .data -825, -216, 719, 180, -970
+mov *r6, L115
+L200: .data 65, -904, 536, 812
+red *r7
+rts
+sub *r2, r7
+dec r2
+L201: mov *r5, r0
+jsr L152
+lea L94, r2
+not r3
+inc r0
+L202: stop
+L203: jsr *r1
+dec r5
+L204: jsr *r7
+; comment
+L205: dec *r0
+L206: cmp r1, *r2
+prn L142
+not r1
+lea L158, L162
+prn #242
+L207: stop
+jmp L128
+sub *r5, r0
+cmp r1, L81
+clr r1
+add r5, r5
+prn r1
+L208: dec *r4
+L209: cmp #-72, r5
+; comment
+L210: .string "nnrhqouxvjjy"
+clr *r7
+rts
+not r6
+not r3
+add *r1, L163
+jsr *r4
+L211: .string "rldgodryagilkckbpncco"
+L212: .data -529, 731, 782, -869
+lea L148, L58
+cmp L48, *r0
+add #191, r2
+L213: lea L104, L195
+L214: .data 515, -433, -48, -260
+prn *r5
+rts
+rts
+L215: sub *r1, r1
+stop
+lea L118, L36
+clr L191
+add #-40, L102
+jmp L24
+L216: .string "pdwaarlvlirfybdckuc"
+L217: .data -609, -822
+add #-160, L46
+sub *r4, r4
+clr *r6
+sub r3, *r1
+sub L61, *r7
+L218: rts
+L219: jsr *r6
+dec r6
+jmp L49
+not L33
+jsr *r2
+stop
+lea L188, *r5
+L220: red *r3
+L221: .data 613, 780, 697, 874, 620
+L222: stop
+; comment
+inc *r4
+lea L63, r2
+L223: rts
+red r0
+L224: .data 789
+L225: jmp *r1
+red *r4
+; comment
+jsr L218
+not L28
+L226: cmp *r7, r5
+red r6
+L227: lea L21, L221
+dec r3
+clr L28
+L228: not L150
+add #24, r6
+
+jmp L198
+L229: jsr L155
+cmp r5, r3
+L230: inc *r6
+rts
+L231: jsr *r0
+rts
+add *r0, L104
+prn *r6
+L232: not r3
+L233: jsr L199
+L234: .string "jsq"
+sub r5, L149
+rts
+L235: lea L33, r6
+red *r5
+L236: .data -826, 163, 933, 820, -79, 740
+rts
+rts
+jmp *r3
+clr r7
+sub L175, *r7
+L237: .string "owjvwbawpdfkxdx"
+jmp L136
+dec L147
+L238: jsr *r1
+rts
+dec L193
+inc *r2
+prn #-233
+L239: rts
+L240: mov L191, L184
+rts
+L241: add L9, L191
+stop
+L242: .string "cxqkgytkqtq"
+L243: .data 251, 838, -969, 212, -682, -585, 328
+clr *r3
+inc L56
+L244: cmp *r3, L234
+L245: prn L65
+L246: dec L56
+L247: .string "waegohltqjactemaf"
+L248: jsr *r5
+prn r3
+dec r1
+L249: lea L146, r7
+L250: mov *r7, L86
+add *r7, r5
+dec r4
+dec r5
+red L0
+mov L74, L47
+L251: .string "mhujfqiqopcjtoolelxesxxw"
+L252: cmp #-47, r1
+stop
+; comment
+inc r3
+add *r5, L242
+L253: bne *r0
+lea L29, r7
+L254: clr *r5
+jsr *r3
+jmp *r5
+L255: red L142
+L256: .string "dedvymfjscrb"
+clr r6
+L257: .string "wygekoi"
+bne *r2
+dec r3
+L258: .data 291, 209, 902, -968
+L259: .data 126, 771, 487
+bne L4
+cmp L52, #-239
+clr r7
+sub *r1, L124
+cmp L189, L54
+L260: stop
+L261: .data 593, -431, -92, -155, -704, 997
+red L197
+dec *r4
+stop
+stop
+not r5
+bne L207
+L262: inc r1
+L263: cmp r6, #-141
+clr L188
+L264: prn #144
+bne *r0
+prn *r7
+dec r3
+not L22
+inc r6
+
+clr *r1
+mov #237, L84
+red r0
+L265: .data -694, 623, 149
+jmp L123
+mov r3, L97
+not L37
+dec r7
+dec *r7
+L266: dec L12
+L267: dec r2
+L268: clr *r7
+L269: sub r0, *r4
+bne *r7
+jmp L177
+rts
+stop
+jsr *r6
+lea L169, r4
+jmp L159
+jmp L83
+not r2
+inc r4
+stop
+L270: cmp r2, r1
+dec *r3
+inc L151
+jsr L116
+bne L188
+bne *r1
+lea L50, *r7
+L271: stop
+; comment
+prn *r1
+L272: prn L228
+red *r4
+L273: prn #-119
+
+L274: mov r0, r7
+clr *r3
+L275: jmp L110
+L276: .data -1000, -344, -179, 427, 582, -804
+mov L42, L80
+L277: sub L162, *r2
+red L170
+L278: jmp L41
+stop
+L279: stop
+dec *r5
+L280: rts
+dec L126
+cmp #170, #90
+L281: jsr *r0
+L282: inc r0
+red r1
+not *r0
+dec r1
+
+clr *r0
+clr *r7
+L283: sub L252, r0
+sub r3, *r0
+L284: sub L116, r0
+L285: red L218
+L286: rts
+dec r0
+
+L287: .data 902, 78, 331, -325
+
+lea L188, L59
+L288: add r0, *r0
+rts
+stop
+L289: red L238
+stop
+jsr *r6
+L290: lea L169, *r0
+L291: .data -795
+jsr *r0
+sub #-161, *r3
+L292: clr r3
+jsr L193
+L293: not L40
+not r4
+dec L44
+rts
+red r5
+L294: cmp #-199, L70
+sub L174, r1
+L295: .string "flfousa"
+; comment
+red r0
+lea L83, *r1
+; comment
+red r4
+not r4
+L296: bne *r4
+cmp r0, L193
+clr *r0
+cmp *r2, #-98
+L297: lea L224, *r4
+L298: .data -322, 216
+mov r7, L160
+stop
+L299: .string "wizkuaqiviwlvygppnweslp"
+L300: prn #43
+L301: bne L46
+stop
+red L251
+dec r7
+bne L256
+rts
+mov r7, L290
+not r4
+
+L302: jsr L252
+bne L200
+L303: cmp L8, #-37
+jsr L14
+inc *r5
+L304: .string "cgsu"
+L305: mov *r0, *r6
+bne *r5
+L306: .string "chmnjzcrifjc"
+
+L307: sub #242, r3
+jsr L114
+jmp L157
+cmp #-144, L131
+L308: rts
+L309: jmp L120
+red r6
+red *r2
+sub #-251, L55
+jmp L121
+rts
+not *r0
+L310: .string "jgqcsobsbfpnyoroysa"
+clr L309
+L311: rts
+lea L91, r1
+lea L65, r6
+rts
+L312: .data 237
+L313: .string "tvmzexwteb"
+mov #49, r2
+L314: dec *r6
+prn #11
+rts
+L315: cmp *r3, *r5
+L316: .string "zdc"
+red r2
+L317: mov L310, r1
+clr L35
+rts
+red r0
+L318: bne *r6
+L319: .data 128, 56, 671
+not *r4
+jsr L163
+prn L271
+L320: prn L309
+jmp *r0
+mov #-158, r1
+stop
+L321: dec *r2
+
+L322: add #-177, *r3
+L323: .string "mgdmkt"
+L324: .data 356, -748, 890, -755, 874, 400, -220
+L325: rts
+dec *r3
+L326: .string "ndumddjzmsqemnakwkybix"
+cmp #42, L173
+bne L36
+rts
+L327: jsr *r0
+not r4
+add r5, r5
+red r6
+L328: inc L300
+L329: stop
+inc L9
+L330: sub *r5, L19
+L331: .data 412, 439, -965, 788, 992, -335, 623
+red *r6
+dec r2
+stop
+sub r0, *r7
+clr L227
+L332: .string "vnwht"
+L333: cmp r4, r1
+L334: .data -801, 925, 481, -792, -128, -372, 679
+sub *r5, *r4
+not L215
+L335: sub *r7, r1
+prn *r0
+jmp L75
+jsr *r5
+L336: clr *r5
+cmp #47, #227
+jmp *r6
+; comment
+clr *r2
+prn L322
+L337: stop
+jsr L234
+L338: prn *r7
+cmp #30, L149
+not r6
+jsr L167
+inc r6
+inc r2
+L339: .data 140, 351, -214, 782, -500, 478
+L340: cmp *r2, r4
+L341: jmp L168
+lea L241, L45
+L342: jmp *r0
+jsr *r4
+L343: .data -524, 752, -725, -281
+jmp L150
+bne *r7
+L344: jmp L269
+jmp L13
+L345: .data -811, -215, 900, -202, -713
+prn r4
+bne *r0
+lea L181, *r1
+lea L268, *r4
+
+dec r2
+jsr *r0
+dec *r7
+clr L173
+L346: rts
+lea L32, r1
+L347: rts
+L348: lea L338, L25
+L349: inc *r5
+rts
+L350: inc r1
+rts
+lea L185, *r7
+cmp r5, #128
+prn L256
+stop
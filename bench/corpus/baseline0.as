@@ -0,0 +1,1020 @@
+; Generated by genCorpus --seed 1
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+inc L105
+L0: rts
+sub r7, *r3
+bne L216
+jsr L0
+stop
+L1: prn r1
+cmp r1, #-87
+mov L0, *r1
+mov *r1, r5
+
+dec *r2
+L2: .string "ycouglxdfqblmmgtmnfwzbe"
+L3: lea L3, *r6
+stop
+L4: red r0
+rts
+cmp r1, *r3
+jsr *r2
+mov *r4, L1
+dec L265
+L5: .string "sbdnnhsxxvecpjapfzgm"
+add #-32, *r4
+not *r6
+dec L4
+sub #187, r1
+add L31, *r7
+mov #8, L1
+L6: .data 842, -776, -697, -230
+L7: prn r2
+red *r2
+mov r0, *r2
+L8: .data -21
+stop
+sub r3, r2
+L9: sub #-185, L4
+jmp L7
+lea L229, L4
+not *r7
+jmp L250
+red L8
+L10: bne L2
+jmp L47
+L11: lea L96, *r5
+cmp L135, #-189
+not r6
+rts
+clr r2
+L12: inc L177
+L13: red L174
+prn #122
+L14: .data 121, -730
+add *r4, L6
+clr L54
+rts
+mov L62, L187
+not *r3
+dec L10
+L15: bne *r1
+L16: add *r1, L138
+mov r4, *r5
+bne *r0
+
+inc L264
+L17: clr r6
+cmp r7, r0
+mov *r4, *r6
+L18: add r2, *r4
+L19: rts
+L20: inc L15
+add L207, *r5
+dec L226
+L21: .data -1000, 190, -995, 638, 139, -510, 225, 809
+dec r0
+clr *r6
+L22: cmp L142, #12
+L23: prn #-230
+L24: .data 659, -374
+jmp L16
+prn *r5
+lea L181, r7
+bne *r0
+sub r4, *r7
+L25: .data -526, 822
+clr L84
+prn r0
+prn r3
+bne L14
+lea L7, r7
+lea L168, r3
+add *r4, *r5
+rts
+L26: prn #70
+stop
+rts
+bne L230
+L27: .string "hsydhrulmbnniozjrqozxjz"
+L28: bne *r6
+not *r5
+; comment
+L29: sub r1, L142
+L30: .string "ginrlgsq"
+red L48
+inc L13
+jsr *r6
+not *r1
+jsr *r5
+inc L211
+prn r1
+L31: clr *r5
+jmp *r3
+prn #242
+L32: bne L261
+inc r2
+sub L11, L155
+sub L31, L83
+not L27
+red *r3
+bne L17
+red L21
+L33: bne L162
+L34: .string "xatyfdgnmjunyiy"
+prn L35
+mov *r6, r6
+dec L2
+bne *r2
+L35: mov *r0, L30
+not r7
+not *r6
+add r6, L268
+not *r0
+mov *r1, *r5
+jsr *r4
+
+prn L39
+L36: sub r7, r4
+jmp L25
+jmp L23
+add L4, L2
+add #-192, r7
+L37: inc L162
+L38: .string "ekkvrrdensh"
+clr *r7
+prn *r4
+mov #245, L63
+L39: clr *r3
+red r3
+jmp L16
+add #-127, L13
+L40: .string "dvhweaqnbpaqv"
+L41: stop
+bne *r0
+L42: dec r5
+inc L274
+jsr *r3
+stop
+; comment
+lea L148, L100
+inc L6
+L43: prn *r0
+not r1
+L44: .string "vnqqmjlhqcmtoc"
+jsr *r0
+red L216
+cmp L132, *r2
+jsr *r1
+rts
+; comment
+jsr L138
+L45: .string "lon"
+stop
+lea L11, L93
+clr *r1
+cmp #-240, r1
+prn *r5
+L46: jmp *r6
+red *r3
+jmp L255
+L47: .string "z"
+jmp L24
+L48: clr L244
+not *r1
+jsr *r6
+
+add *r0, r1
+L49: add r1, L36
+L50: mov *r2, L155
+red r2
+inc r6
+L51: rts
+mov #149, r7
+jmp L259
+L52: .data 660, -812, 205, 885, -263
+inc *r0
+sub #166, r4
+lea L99, *r6
+add *r5, *r7
+L53: cmp #25, *r4
+lea L195, L48
+L54: .string "spfp"
+lea L74, *r0
+L55: red L40
+bne *r0
+jmp *r7
+add #-82, r3
+mov r1, *r7
+; comment
+L56: inc *r0
+add L240, *r2
+bne L179
+not r6
+lea L226, *r7
+prn #67
+L57: .string "yovroznct"
+L58: .string "rralazdgspt"
+L59: .string "i"
+jmp L42
+; comment
+red L41
+sub L51, L11
+
+lea L95, L121
+; comment
+cmp L33, *r3
+red r2
+rts
+L60: stop
+mov #-184, L151
+cmp *r1, #129
+L61: bne L259
+add L216, L179
+prn #29
+lea L29, L228
+; comment
+jsr L23
+lea L30, L81
+add r1, L56
+inc r0
+lea L46, L103
+; comment
+stop
+not r4
+L62: rts
+mov r1, L40
+L63: .string "rpfzbqzgvz"
+red r7
+red L61
+bne L15
+
+stop
+sub *r7, r5
+L64: prn r3
+L65: rts
+L66: .string "wdsm"
+rts
+jsr *r4
+sub L48, r5
+rts
+L67: .data -9, -494, -633, -177, -770
+prn L36
+stop
+cmp #-76, L8
+clr *r4
+jsr L24
+L68: jmp *r4
+red *r3
+cmp *r3, #-134
+jsr *r3
+jsr L189
+L69: dec r1
+jsr *r3
+L70: .string "ayrlncgbndiugnepp"
+jsr *r7
+L71: bne *r3
+clr *r7
+L72: dec r4
+rts
+sub *r2, L152
+prn *r0
+dec L21
+jmp L72
+red L270
+add L219, *r1
+cmp L69, #-195
+not L19
+jmp *r0
+L73: inc r7
+rts
+L74: inc r7
+stop
+sub L31, *r6
+clr L24
+prn *r6
+mov r1, *r4
+bne L161
+clr r2
+stop
+L75: inc L10
+lea L157, r0
+clr L64
+jmp *r5
+rts
+L76: inc r1
+L77: bne L24
+clr r7
+
+jmp *r3
+L78: bne L205
+bne *r0
+; comment
+L79: .data -455, -663, 185, -179, -313, 905, 477
+mov #217, L66
+clr L27
+L80: jmp L194
+dec L58
+not r4
+jmp *r6
+red *r4
+prn #174
+L81: dec L145
+dec *r6
+jmp *r4
+rts
+cmp L149, #232
+L82: add *r5, L0
+add r5, *r2
+prn *r3
+jsr L127
+mov #86, r2
+add *r3, *r5
+L83: add #-52, r0
+; comment
+L84: .string "pntzopuhwffinnawklfw"
+stop
+lea L190, r5
+stop
+jmp L77
+L85: sub *r2, r7
+L86: red L188
+dec L56
+jmp *r3
+sub *r2, *r4
+stop
+cmp #52, *r4
+L87: red r4
+L88: rts
+L89: .data 455, -965, 247, 292
+L90: .string "pv"
+jmp L199
+L91: add r6, *r5
+dec *r0
+clr L90
+clr r0
+L92: bne L85
+bne *r2
+dec L23
+not L206
+jmp *r7
+lea L274, *r6
+; comment
+L93: clr *r1
+L94: .data -637, 667, 856, 724, -134, -524, 693
+inc *r4
+L95: .string "lelkyjadpugna"
+L96: red r3
+cmp r5, r4
+jmp *r4
+dec *r1
+jmp *r6
+L97: .data 795
+stop
+L98: .string "dskevryfyfadgodxphasc"
+clr *r2
+lea L174, *r0
+L99: .string "shdikincrmjkzkmbyqxuc"
+lea L25, *r4
+L100: .data -30, 992, -236
+L101: jsr L53
+dec *r2
+jmp *r2
+prn *r2
+L102: rts
+L103: .string "geg"
+L104: sub r4, *r0
+prn r5
+stop
+rts
+jmp L12
+jmp *r0
+mov #-80, *r1
+stop
+clr L32
+L105: add #-34, L21
+bne L239
+L106: sub r4, r6
+not *r0
+L107: not *r4
+L108: lea L188, *r5
+L109: .data -439, -663, 697, -247, 471, 613, -972
+jsr L106
+not *r5
+rts
+bne *r1
+sub L267, *r0
+L110: mov #132, r3
+L111: bne L120
+sub #-156, r0
+lea L90, *r7
+jsr *r3
+L112: .data -980, -249, 492, -197
+L113: .string "mnljrskjrecicvtuhiue"
+dec r5
+red L271
+lea L224, r0
+sub #-221, L100
+L114: stop
+L115: clr *r3
+inc L129
+L116: mov L263, L77
+L117: .data -292, -204, -872
+stop
+sub L36, r6
+mov r4, r2
+bne *r2
+jmp *r2
+prn r2
+rts
+cmp L247, *r0
+clr *r0
+rts
+stop
+L118: not r3
+L119: stop
+red *r4
+cmp #-194, L19
+prn r0
+jmp *r4
+L120: clr r4
+rts
+L121: prn L227
+rts
+bne L28
+prn L181
+clr r4
+L122: .data 981, 853, 146, -564, -524, -346
+prn L35
+stop
+mov r0, L22
+L123: red *r5
+cmp #-168, *r7
+lea L217, L203
+mov r7, L67
+bne L269
+
+add r7, *r5
+jsr *r3
+jmp *r7
+L124: .string "xbmalzdkibnbrz"
+L125: .data 251, 131, 892, 102
+rts
+sub r3, r3
+add *r3, L220
+L126: .string "ipydrzmyyewnloakwzcly"
+L127: not *r6
+add *r6, *r0
+L128: .data 277, 342
+
+not L255
+L129: mov #-131, r4
+; comment
+L130: jsr L222
+L131: red *r3
+mov L2, r5
+jmp *r6
+inc r5
+bne L54
+clr L150
+L132: jsr L77
+sub *r3, r4
+clr L95
+lea L182, L207
+L133: sub *r3, r7
+lea L265, *r1
+add *r4, r2
+cmp *r7, #-125
+; comment
+L134: .string "zcuootgbxwudpqqebdxozz"
+
+not r3
+stop
+L135: rts
+jmp L91
+red r4
+mov #-214, *r3
+inc *r7
+L136: rts
+L137: jmp L62
+L138: .string "vlselgbhjcptsdkcboceu"
+bne *r5
+L139: jmp *r1
+
+red r0
+L140: jmp L268
+jsr *r0
+dec L177
+mov *r5, L191
+rts
+lea L180, r3
+jsr *r7
+clr *r4
+not r4
+add #-128, r2
+L141: .string "oftezeilbbfqzlypdfqwu"
+rts
+jsr L170
+red *r6
+L142: rts
+dec *r5
+not *r3
+cmp L37, *r6
+clr r5
+prn r6
+add L264, *r3
+cmp r2, L225
+rts
+rts
+inc *r2
+L143: jmp *r7
+mov L119, r7
+clr L248
+add r6, *r3
+L144: .string "vukqtzybebprhdgnranae"
+rts
+
+sub r5, *r1
+L145: .data 684, 776, -570
+L146: prn *r0
+add L193, L214
+L147: inc r1
+clr r6
+L148: lea L139, *r2
+L149: .data -204, 888, 741, 643, 760
+not L50
+L150: red *r5
+L151: jmp *r0
+L152: .string "bthc"
+dec L74
+mov #-211, L132
+jsr *r3
+L153: cmp r4, #-103
+cmp L265, r5
+
+L154: prn *r7
+L155: .string "cnsljrjbqilp"
+not r4
+red L261
+cmp L13, r7
+bne *r3
+L156: inc r4
+not *r4
+clr *r4
+L157: dec L57
+L158: .data 361, -322
+cmp r6, *r3
+L159: dec r1
+prn L45
+red L127
+dec r7
+L160: mov #-71, *r2
+L161: .data 232, -301, -751, 171, -668, 680
+red *r1
+jsr L187
+rts
+rts
+L162: not L201
+clr r6
+L163: .data -76
+cmp L79, r7
+L164: .data 247, 831, 681, -908, -692, -237
+stop
+L165: lea L258, *r3
+add #96, L272
+prn #-92
+rts
+lea L260, r2
+lea L80, L136
+clr *r2
+L166: stop
+inc r2
+jmp L43
+L167: not L215
+dec L178
+cmp r1, L22
+red *r0
+cmp #-176, L104
+L168: red r5
+bne L155
+clr *r3
+; comment
+mov #174, *r6
+bne *r4
+prn *r7
+; comment
+
+red L207
+
+prn *r3
+lea L200, *r0
+L169: not L250
+; comment
+cmp #20, L198
+L170: .data -567, 337, -578
+jmp L194
+L171: dec r0
+L172: .string "uoy"
+L173: add L88, *r0
+jsr *r6
+inc *r0
+red r0
+stop
+L174: inc r1
+L175: cmp L224, #132
+mov *r7, r0
+sub *r3, r6
+prn L186
+L176: .data 238, 465, 585
+L177: .data 83, 396, -637, -705
+prn L33
+
+dec L214
+; comment
+L178: lea L132, *r1
+lea L246, r4
+cmp L106, #125
+cmp *r4, *r1
+L179: lea L37, L249
+rts
+L180: dec L208
+add #43, r0
+L181: jmp *r0
+sub *r6, r4
+jmp *r0
+L182: lea L234, L274
+cmp #-236, L242
+jsr L156
+prn r5
+L183: sub *r6, r3
+cmp L126, *r6
+clr L201
+sub r7, *r2
+dec L86
+L184: add L270, r1
+sub #117, r4
+lea L66, *r5
+inc r1
+clr r3
+red *r6
+stop
+stop
+cmp #30, r7
+
+dec *r5
+sub *r6, r4
+bne L204
+L185: .data -307, 996, 798
+mov r6, L209
+jsr *r3
+red L145
+L186: jmp *r4
+add #178, *r4
+L187: .string "biaodeigdqtrwgcbyunwr"
+L188: red r5
+clr r6
+sub L61, r5
+L189: dec *r4
+L190: not r5
+mov r3, L90
+red L224
+add r6, L240
+
+mov #-204, *r6
+L191: .data -442, 154, 436, 875, -802
+L192: .data 627, 935
+L193: .string "sexhewwbkwaz"
+prn #1
+mov L164, r2
+jsr L216
+sub r3, L96
+inc *r0
+bne L194
+clr *r1
+red *r7
+bne *r0
+prn r4
+mov L160, L213
+L194: .data -542, -191, 589, -328, 884, 340
+L195: inc L67
+L196: red r4
+
+lea L190, *r3
+L197: not *r1
+stop
+red *r2
+add *r1, *r3
+L198: cmp #-100, #-4
+rts
+L199: lea L212, *r5
+red *r0
+L200: .data 990, 832, -297, -54, -164, 78
+L201: .data 291, -287, -390, 686
+L202: add L237, *r0
+red r6
+L203: red L268
+not *r3
+bne L198
+red L13
+
+bne *r7
+L204: not *r4
+add *r1, r5
+jsr L237
+clr *r6
+rts
+clr L219
+prn L267
+stop
+not L72
+L205: .data 879, -834
+mov L163, r2
+jsr *r7
+red L89
+mov *r4, r7
+red *r4
+prn *r6
+rts
+L206: rts
+cmp L205, *r0
+L207: .string "hvzje"
+inc *r2
+lea L111, r4
+stop
+mov *r1, *r4
+bne *r3
+prn #-3
+sub *r2, *r1
+L208: .string "adskmpqnciu"
+mov *r5, L94
+jsr L127
+clr L6
+L209: not r1
+bne *r2
+jsr L240
+clr r4
+L210: .string "ht"
+stop
+dec *r1
+L211: lea L59, *r6
+; comment
+stop
+prn L225
+
+rts
+dec *r5
+stop
+inc r7
+L212: red *r5
+L213: clr *r5
+jmp *r4
+rts
+rts
+L214: jmp *r5
+rts
+L215: clr r5
+cmp L256, #133
+clr r1
+clr r3
+mov r3, *r7
+L216: .string "cgdnnmwhlfjqsgyp"
+jmp *r4
+L217: .data 769, -844, -282, 781, 131, -877
+L218: add *r3, *r1
+sub #-48, r3
+mov *r6, r1
+lea L231, *r2
+prn r3
+
+jsr L177
+lea L64, L30
+bne L67
+rts
+L219: clr *r4
+stop
+mov L62, L172
+inc L274
+cmp L268, L265
+red L258
+L220: inc *r2
+stop
+stop
+stop
+mov *r1, r1
+L221: jsr *r1
+
+L222: .string "wzoyerztupqbpfeghgkje"
+L223: bne *r2
+sub r1, *r3
+L224: .string "wnvgsfljgk"
+red r6
+sub L236, *r7
+add r6, *r3
+stop
+clr L265
+jsr L259
+red *r5
+mov *r1, *r6
+bne L267
+dec L193
+inc *r4
+cmp L260, r7
+prn *r0
+not *r0
+cmp *r4, #-18
+jmp L247
+bne *r0
+dec *r6
+jsr *r0
+inc r2
+; comment
+L225: mov #185, *r7
+add r7, r6
+jsr L118
+L226: .string "ugsgk"
+inc L187
+prn *r0
+not L254
+L227: stop
+jsr L87
+L228: clr r2
+jmp *r5
+sub *r6, L140
+prn *r5
+clr L134
+add r0, L169
+L229: .string "ijityqb"
+L230: jmp L264
+add r3, L167
+L231: .string "pyovglcdkimvugmc"
+L232: lea L274, L172
+jmp *r0
+L233: .data 507, -978, -108, -498, 393, -396, 4, -287
+cmp *r3, r6
+inc *r3
+jmp *r2
+mov L257, *r4
+L234: .string "inkekjqvmvjqj"
+L235: .string "npck"
+inc r2
+L236: bne L190
+clr r2
+bne *r3
+clr *r7
+prn #-3
+stop
+prn *r2
+L237: .data 965, 281, -928, 930, 405, 962, 330
+dec *r1
+lea L111, L269
+L238: clr r7
+mov #-196, *r3
+jsr L252
+lea L248, *r4
+L239: .data -738, 117, 371, 692, 607
+bne *r0
+sub #179, L249
+not *r3
+rts
+stop
+L240: mov #-97, L241
+L241: jmp *r2
+
+L242: jmp L158
+prn #249
+not r6
+L243: add L256, L93
+L244: .data 890, 100, -760, -278, 31
+jmp *r1
+sub L233, L218
+L245: .string "gamntjbofcwciu"
+L246: not L216
+prn *r5
+not L124
+inc L19
+L247: dec L168
+lea L272, L263
+bne L255
+L248: jsr L249
+prn *r0
+L249: .string "ohdpbqvv"
+inc *r3
+rts
+lea L54, L250
+mov L253, L127
+mov *r2, r6
+L250: jmp L0
+stop
+clr r4
+sub #-222, L15
+dec L260
+bne *r4
+clr L261
+cmp *r0, *r1
+L251: dec L254
+inc *r4
+prn L187
+red *r5
+bne *r5
+
+L252: red r3
+jsr *r4
+L253: sub #-198, *r5
+bne *r4
+prn L267
+stop
+rts
+rts
+add L261, r6
+inc *r7
+prn #151
+L254: add #-249, *r3
+L255: add L126, L49
+red L105
+red L53
+L256: bne *r5
+L257: jsr *r1
+stop
+L258: mov #106, r2
+inc r2
+sub r4, L261
+stop
+L259: jmp *r1
+; comment
+; comment
+rts
+L260: sub *r4, L263
+L261: mov #241, L50
+lea L271, *r1
+mov *r0, L268
+jmp L117
+rts
+L262: stop
+jsr *r6
+L263: stop
+L264: .data 995, -490, -656, 522, -927, 277
+L265: not L30
+jmp L266
+stop
+prn L203
+mov #-196, r4
+clr L96
+
+L266: rts
+add *r0, r2
+lea L246, *r0
+L267: cmp r5, L145
+stop
+not r3
+inc r6
+L268: cmp r3, r7
+; comment
+not r6
+dec r4
+stop
+jmp L271
+jmp L271
+prn *r5
+L269: not L138
+add *r7, L272
+stop
+rts
+mov *r4, r2
+L270: not r7
+not r2
+L271: stop
+lea L108, L274
+inc *r7
+jsr L63
+not *r5
+bne *r1
+inc L274
+lea L272, r1
+
+L272: jmp L113
+jmp *r6
+red r3
+L273: dec *r6
+jmp L274
+inc r3
+L274: jmp *r2
+rts
+dec *r4
+stop
@@ -0,0 +1,1020 @@
+; Generated by genCorpus --seed 2
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+rts
+dec r6
+lea L83, r4
+lea L27, *r6
+mov *r0, *r4
+rts
+lea L36, L90
+L0: jmp L1
+sub L0, L52
+dec *r1
+sub #14, r6
+add L26, r1
+prn r1
+jsr L84
+bne L0
+dec *r5
+L1: jsr *r3
+
+L2: .string "zfskpgplnkl"
+not r1
+bne *r1
+L3: .string "todxwvttdilmofvgldzh"
+clr r2
+L4: .string "pkmmbhqgpopalewwtnnnysss"
+bne *r6
+L5: inc *r6
+L6: jsr *r2
+L7: rts
+L8: dec L7
+stop
+bne *r4
+prn r1
+stop
+sub r7, *r0
+L9: jmp L262
+
+jmp *r1
+L10: red *r3
+red *r6
+cmp r2, #138
+lea L5, r1
+cmp #67, *r2
+L11: rts
+L12: .string "aylnfssnzkjidgewmzozl"
+jmp *r0
+dec L128
+sub L11, r6
+cmp #198, #-201
+prn r6
+inc L187
+L13: .string "yzscjmchsxw"
+cmp #44, L3
+; comment
+clr L226
+prn #-101
+L14: sub L9, *r7
+rts
+add r4, r7
+L15: add #-207, L0
+cmp #215, *r6
+bne *r4
+rts
+L16: add *r7, r2
+sub L11, *r1
+jsr *r7
+L17: red L3
+lea L222, *r1
+not r7
+cmp *r2, L6
+dec *r3
+L18: red r6
+stop
+L19: sub #-182, *r4
+red *r1
+L20: mov L5, r6
+not r2
+add *r0, r0
+clr *r0
+; comment
+lea L107, *r2
+L21: jmp *r3
+L22: stop
+; comment
+not r2
+mov *r7, r4
+L23: jsr *r0
+sub r6, *r5
+lea L12, L17
+cmp *r3, *r0
+bne L6
+prn #-195
+rts
+jsr *r1
+stop
+L24: rts
+sub *r1, r1
+L25: rts
+sub *r2, r2
+
+lea L6, *r4
+rts
+L26: .data -632, 661, -548
+inc L100
+L27: prn #36
+L28: .data 263, -216
+red L18
+add r2, r2
+stop
+prn L162
+L29: .data 908, 632, -453, -330, -570, 72, 795, 381
+clr *r5
+L30: .data 772, 719, -43, -162, 860, 447, -821, -506
+cmp L30, r2
+dec r3
+L31: stop
+jmp *r5
+inc L22
+L32: .data 742, 116, 616, 492, 548
+clr r6
+red L106
+not *r5
+clr r7
+cmp L8, #-182
+L33: jsr *r3
+cmp #-35, #249
+L34: .data 686, 57, -729, 130, -301, 168
+stop
+jsr *r5
+L35: lea L51, L25
+L36: dec L129
+lea L71, L29
+L37: stop
+L38: cmp r1, *r6
+L39: bne *r4
+mov r2, L61
+add #-44, r1
+jmp L116
+red r3
+dec L94
+sub *r7, *r0
+inc *r2
+L40: .data 915, -816, 931, 497
+; comment
+jmp *r3
+L41: prn r0
+bne *r5
+red r7
+stop
+cmp *r4, L37
+lea L19, r0
+jmp *r2
+add *r6, L190
+rts
+stop
+not L9
+mov #124, r7
+L42: cmp r6, L0
+jsr *r6
+add r3, *r6
+sub #-122, *r6
+not *r2
+L43: rts
+clr r6
+inc *r4
+not r3
+jmp *r4
+L44: mov #73, *r7
+rts
+not r1
+lea L104, L178
+L45: .data -177, -220, 960, 193
+cmp #219, #-225
+stop
+L46: .string "bhhczaidoccqcyu"
+prn #50
+lea L97, r7
+jmp L14
+dec r4
+red L10
+lea L31, *r1
+red r3
+L47: lea L244, *r3
+sub r6, r7
+jmp L13
+add r1, r5
+lea L94, L171
+mov *r0, *r7
+cmp L225, r7
+inc L209
+jmp *r4
+L48: jmp *r7
+L49: cmp *r2, *r3
+L50: .string "knoricng"
+lea L34, r5
+red *r1
+add r2, L46
+bne *r7
+L51: red L0
+L52: add L70, *r2
+red L27
+not *r2
+red *r1
+L53: red L234
+inc r4
+dec *r2
+L54: .string "aodazocodulc"
+add #240, *r6
+mov L23, L34
+red L50
+rts
+prn *r2
+L55: .data -488, -346, 282, -825, -674, 434
+inc r4
+rts
+; comment
+lea L194, L8
+jsr *r0
+add *r6, L103
+stop
+L56: .string "adrcqxglg"
+L57: prn L82
+L58: inc *r5
+L59: red *r3
+jmp L243
+lea L43, L10
+add *r7, L15
+L60: .data -878, -915, 874
+cmp L198, r5
+cmp r6, L115
+mov #-212, L4
+not r0
+bne *r4
+not *r5
+L61: red L58
+inc r7
+stop
+cmp #220, *r5
+jsr L268
+jsr *r1
+L62: cmp *r5, L40
+sub #-147, *r7
+inc L39
+inc r6
+not L3
+L63: red L214
+L64: prn r0
+cmp r6, *r7
+add #5, r4
+dec r7
+lea L220, r5
+mov #101, *r0
+jsr *r4
+add r4, *r2
+dec L52
+clr r6
+L65: .string "zqmwdexgnnerryiunbr"
+L66: .string "jvilwnnculzzztitlhojmblx"
+jsr *r1
+lea L187, *r7
+L67: .data -916, -142, -456, 832
+stop
+cmp r7, r5
+lea L65, *r6
+add L240, *r3
+L68: stop
+add L241, L48
+lea L13, r3
+; comment
+L69: add L221, *r7
+L70: cmp r3, L123
+L71: add r3, L96
+L72: add L263, *r7
+inc *r5
+clr r3
+L73: add #-158, L220
+cmp *r0, L247
+L74: lea L48, r1
+not L129
+clr r6
+red r6
+not L127
+L75: lea L64, L134
+sub r5, r4
+not r2
+dec *r2
+jsr L131
+dec L44
+L76: mov L133, L234
+L77: .data 110, -556
+L78: .data 655, 245, 115, 817, 992, -669, 791
+stop
+add #201, *r7
+L79: .string "iz"
+sub #22, r2
+L80: .string "lizfkvaitjv"
+L81: .string "uguhyhioxttfka"
+bne L249
+prn #205
+sub #52, *r2
+mov #218, *r7
+dec r0
+add #-195, L168
+L82: sub *r3, r5
+L83: .data 615
+jsr *r6
+bne *r5
+inc L253
+inc *r6
+L84: cmp #-193, L84
+inc *r6
+add #151, *r0
+cmp r4, r4
+stop
+inc *r0
+L85: .data 996, -896, -590, 418
+not *r7
+L86: stop
+bne L255
+cmp #238, r1
+L87: .string "tbldszlhczmiwnaufgaiypvt"
+dec r4
+prn L40
+; comment
+L88: bne *r7
+L89: .data 32, -472, 31, 874, 979, -893, 522, 800
+L90: jmp *r1
+jmp L88
+rts
+L91: .string "zfepavgblnndk"
+L92: jsr L73
+not r6
+inc L258
+jsr L241
+lea L46, L32
+rts
+L93: inc r2
+sub #190, r6
+L94: stop
+mov *r7, *r4
+; comment
+cmp r5, r7
+rts
+rts
+sub *r7, *r5
+bne *r5
+
+jsr L133
+dec L156
+clr r4
+add #56, *r4
+L95: mov L124, L166
+jsr *r1
+L96: red *r7
+L97: inc r4
+add r3, *r1
+inc r0
+not *r6
+jmp *r7
+red r2
+cmp #-234, r7
+rts
+stop
+L98: red L181
+mov L174, r0
+dec *r1
+jsr *r6
+cmp *r0, #-135
+lea L3, L35
+sub *r4, L203
+dec *r0
+L99: red r1
+inc *r7
+inc r0
+mov r3, r0
+L100: rts
+sub *r4, L105
+jmp *r5
+jmp L91
+
+lea L269, *r6
+red L77
+L101: .string "jxxxxjcpkrlhymuprzqccc"
+mov r6, L210
+stop
+cmp L226, r5
+not r2
+rts
+
+not L84
+rts
+L102: .string "vb"
+jmp *r7
+L103: dec L117
+prn *r6
+add *r4, L41
+dec r2
+stop
+L104: .string "icrpcdgbjbqtnem"
+stop
+prn r2
+L105: .string "njeges"
+add L33, *r2
+
+lea L179, *r0
+rts
+L106: .string "ocfenibjqzcdlkiptlgge"
+L107: not *r0
+dec r7
+L108: .data -608, -68, -414, -912, -9, 314
+L109: .string "lcg"
+stop
+jsr L192
+cmp r1, r0
+bne *r7
+L110: lea L35, *r4
+L111: red r7
+prn r5
+not L187
+sub *r4, L114
+L112: sub #-189, L37
+stop
+stop
+stop
+inc L220
+lea L72, r6
+lea L26, *r7
+jmp *r1
+L113: dec *r6
+rts
+jmp *r5
+bne *r6
+jmp L66
+prn L54
+dec L62
+L114: rts
+clr L127
+L115: add L73, L77
+L116: .string "dsgjlpz"
+mov *r6, L18
+L117: bne *r6
+sub #-163, L3
+not L183
+clr L121
+stop
+L118: jsr L136
+lea L53, L204
+L119: .data 786, 590, 992, -437, -279
+L120: .data -797, 462, -668, 916, 633, -613, -489, -114
+add *r4, r3
+bne L222
+red *r5
+bne L93
+mov L148, r5
+clr r1
+red r7
+mov r7, L9
+cmp #-228, #199
+jmp L165
+clr L191
+L121: sub r6, r3
+clr *r2
+red *r3
+L122: .data -878, 366, -216, -809, -976, -861, -553, -159
+lea L253, *r7
+bne L266
+not *r4
+add L220, L217
+jmp L168
+L123: not L222
+sub #-48, L19
+L124: .data -19, -408, -468, 894, 189
+sub L58, L17
+jsr *r3
+clr L84
+prn #-253
+jmp L33
+jmp L49
+red r6
+inc L18
+L125: jsr *r6
+not L94
+bne *r7
+L126: prn *r1
+L127: not r6
+sub *r5, *r2
+inc L213
+bne L43
+clr L146
+red L134
+stop
+add L163, *r3
+L128: clr *r1
+inc *r2
+L129: cmp *r6, L107
+prn L0
+red r7
+L130: .string "ffghbsws"
+rts
+red *r2
+L131: .data 495, -571, -447, 599
+mov r4, r7
+prn #73
+L132: not L257
+
+not r5
+L133: clr r1
+L134: .string "ktiuufmpm"
+bne *r1
+not *r4
+L135: .string "dnlhfnnnxeiaov"
+jmp L159
+stop
+sub #-244, r0
+L136: stop
+jmp L234
+add *r7, *r5
+prn #255
+bne *r6
+clr *r3
+dec L129
+mov L197, *r5
+clr *r1
+prn #-67
+L137: stop
+cmp L59, L43
+sub L257, r6
+add r4, *r7
+L138: lea L186, *r6
+; comment
+L139: bne L119
+L140: .data -534, 69, 82, -55, -532
+cmp r6, r1
+not *r1
+inc r7
+mov *r7, *r7
+jsr *r0
+L141: .string "lctxhvmjhqutnecuewcuz"
+stop
+prn L118
+L142: not r6
+jsr L196
+clr *r6
+rts
+stop
+bne L171
+L143: prn r7
+L144: not r5
+L145: .string "rcvgpyqrcbigu"
+stop
+L146: .string "yqbjtyx"
+jsr L215
+inc r2
+lea L248, *r5
+add #-181, *r3
+prn *r4
+L147: .data 702, 364
+rts
+cmp #99, r4
+bne L241
+dec L21
+jmp *r1
+L148: .data 292, -202, -522, 645, 835, -322, -117, 424
+bne L208
+mov r1, L9
+inc L116
+not r6
+L149: add L100, *r1
+L150: cmp #86, L128
+L151: .data -100, 923, -276, 205, -879, -944
+L152: .data 570, -459, -795, 625, 849, -641, -287, 162
+mov #30, *r6
+jsr L174
+red L122
+inc L8
+red *r3
+jsr *r2
+lea L267, r6
+red L227
+; comment
+L153: cmp L208, r4
+L154: inc L20
+red r1
+; comment
+rts
+lea L123, *r7
+cmp *r4, L45
+clr r5
+mov r5, L9
+; comment
+add *r4, L34
+L155: .string "sb"
+jmp L62
+L156: sub r2, L163
+L157: sub #179, r0
+L158: .data -903, 433, 472, 112, 317, 333
+
+inc L40
+jmp *r4
+bne L92
+jsr *r7
+stop
+jsr L171
+rts
+sub *r5, *r5
+dec L80
+L159: .string "wcaumymnq"
+L160: add *r6, r0
+clr *r6
+inc L139
+add *r4, r0
+mov #-171, L241
+L161: prn r7
+L162: stop
+jsr *r6
+lea L22, L101
+red r7
+; comment
+dec L228
+mov #107, L154
+lea L36, r0
+red r4
+L163: dec r6
+dec L116
+L164: cmp L242, #-206
+L165: jsr *r6
+jsr *r7
+L166: not r3
+bne L195
+L167: .string "uniexsjarls"
+dec r6
+jsr L181
+
+jsr L254
+clr *r5
+clr r2
+L168: mov #-189, *r0
+red L107
+sub r2, *r3
+L169: inc r0
+mov *r3, L146
+L170: lea L59, r7
+stop
+red r0
+mov #-22, *r7
+red r3
+L171: not *r4
+L172: bne *r2
+L173: stop
+L174: bne L204
+prn r2
+bne L2
+L175: rts
+L176: lea L182, L27
+L177: lea L203, r2
+bne *r5
+rts
+clr *r6
+L178: mov #-38, L218
+jsr L114
+not *r4
+not L198
+bne L204
+not L7
+; comment
+lea L165, *r7
+add #184, *r1
+rts
+lea L263, L186
+red r3
+L179: inc r4
+bne L220
+bne *r5
+jmp L256
+bne *r2
+L180: jsr *r3
+add L145, L236
+stop
+bne *r0
+stop
+jsr L255
+L181: red L200
+L182: clr *r4
+cmp *r5, #-254
+not L111
+add *r5, r7
+sub L198, L185
+L183: .data 502, -727, -128
+stop
+add #4, L16
+mov L156, *r4
+rts
+inc L235
+lea L42, *r4
+; comment
+lea L109, *r7
+not L223
+jsr L184
+prn #-59
+sub *r6, *r6
+cmp L199, *r6
+L184: red L80
+L185: .data -267, -674, -214, -670, -26, 624, -405
+add #103, r1
+sub r6, r7
+L186: rts
+lea L63, *r3
+; comment
+prn L40
+L187: red r7
+dec r1
+L188: .string "ix"
+not *r6
+not *r4
+L189: prn #175
+L190: .data 954, 577, 499, -792, -960, 844, -3
+L191: .data 208, 105
+stop
+mov #-50, *r2
+rts
+L192: .data 944, -870, -425, 389, 605, -259
+lea L88, *r4
+add L118, L114
+L193: .string "s"
+add #-60, r3
+not r2
+rts
+jmp *r2
+jmp L179
+L194: rts
+; comment
+mov r2, L24
+L195: .string "u"
+L196: dec r6
+bne L1
+rts
+L197: .data -305, 981, -518, 140
+clr L16
+cmp r4, #-1
+lea L98, *r3
+clr *r0
+sub L251, L213
+dec r7
+prn L105
+L198: .data 230, 433, -373, -449, -349
+jsr *r2
+not L250
+dec L245
+sub *r1, *r6
+L199: rts
+add r7, r0
+L200: cmp *r2, *r3
+rts
+rts
+prn #-127
+L201: prn *r1
+lea L254, r4
+L202: .string "bhlcxselkshxlcqfftu"
+red *r5
+L203: cmp r3, L82
+L204: stop
+cmp r1, r4
+L205: .string "ktb"
+rts
+L206: jsr *r3
+clr L230
+rts
+L207: .data -204, -880, -690, 208, -550, 648, -685, -441
+stop
+lea L201, r1
+L208: inc r6
+jmp L256
+stop
+not *r3
+lea L215, L115
+red r2
+lea L250, L209
+not *r7
+mov r3, L188
+L209: clr L245
+cmp L178, r3
+inc L235
+dec L109
+L210: cmp L137, *r3
+mov #-142, *r4
+clr *r4
+bne L6
+sub *r4, L63
+L211: prn r3
+L212: jmp L30
+add L86, *r3
+add #1, L35
+clr *r5
+lea L257, *r4
+bne *r2
+inc *r5
+jmp *r4
+not r5
+jmp L266
+jsr L182
+jmp L183
+cmp r7, *r4
+L213: .string "ntcnjwxelrgrqwtcdtxl"
+; comment
+L214: bne *r3
+rts
+L215: .data -776, 686, 435, 568, -351, -235
+red r0
+L216: lea L149, *r3
+cmp r6, #-95
+rts
+inc L238
+L217: clr L215
+L218: prn *r7
+L219: .data 233, -299, 75, -872
+sub r0, L250
+lea L200, *r2
+clr *r5
+jmp *r2
+
+; comment
+red r3
+dec L251
+inc r5
+lea L268, L268
+add *r4, r1
+
+add r0, *r7
+L220: .string "unbkntxez"
+cmp #-87, *r2
+L221: .data 630, 181, -668, 381, 907, 320, -297, 149
+inc L153
+L222: .string "uilvcsjaosfiwrp"
+not r3
+red r5
+red L230
+clr *r3
+cmp #-68, r4
+L223: .string "dptrew"
+inc *r3
+mov L253, L1
+rts
+not r6
+L224: clr *r2
+dec r7
+add *r1, L92
+L225: clr r7
+prn r7
+dec *r4
+red L218
+L226: cmp r5, *r1
+L227: .string "uxesegsh"
+red r5
+L228: .string "ljookrjsoibycbzyk"
+stop
+dec L239
+L229: .data -137, -921, 922, -727, 617, -484
+L230: lea L140, L265
+inc *r7
+mov *r4, r3
+L231: .data -651, -438, 479, -786, -143, 197, 314
+L232: .data 389, -369, 14, 829, 730, 769
+inc *r4
+jsr *r6
+inc L44
+bne L44
+L233: stop
+prn L270
+mov r6, L161
+rts
+
+mov *r1, r0
+red r1
+sub L215, *r4
+L234: dec *r5
+prn L93
+stop
+L235: .data -449, -722, -343, 973, -379, -688, -536
+mov L213, *r0
+L236: not L10
+L237: sub *r0, r4
+jsr *r3
+L238: .string "eukohmvotcgdsvojlcz"
+add L272, L173
+add r7, r0
+L239: .data 987, 945, 677, -473, 906
+L240: cmp *r5, #-155
+red r7
+rts
+jmp L148
+sub L248, L264
+jsr L260
+sub *r1, r7
+
+clr *r0
+bne *r2
+L241: .string "svca"
+cmp L139, L209
+L242: rts
+inc L261
+lea L249, L266
+clr L272
+red L248
+L243: lea L148, r6
+rts
+L244: .data 923
+L245: mov L262, L131
+prn #-228
+prn r1
+dec L186
+inc L266
+L246: cmp r4, #-144
+L247: .data 959, 854, 478
+L248: inc *r5
+rts
+add L254, *r7
+not L257
+bne L264
+bne *r0
+prn #-193
+add L256, r6
+lea L27, *r4
+L249: cmp L274, #159
+jmp L259
+rts
+L250: .string "rvgkdnidarspjodjhptho"
+not r3
+rts
+L251: red *r6
+L252: .string "oiprwcaj"
+dec r3
+L253: dec L221
+red r2
+red r7
+sub *r5, r1
+L254: .string "apr"
+add *r4, r1
+stop
+jmp *r6
+cmp L256, #-85
+cmp *r3, #-177
+cmp *r3, r1
+red *r1
+L255: red r5
+bne *r2
+stop
+L256: .data -239, -457, 611, 909, 983, 908, 680, -834
+red *r6
+cmp L264, #-144
+cmp L148, *r3
+add L273, r2
+inc L38
+mov #75, r2
+L257: .string "jvzvailazbrgckstqxqcfcz"
+L258: red L91
+stop
+cmp *r3, L272
+L259: rts
+dec *r5
+cmp r4, r6
+L260: .data 984, 89, 977, 102, 110, 127
+L261: not r7
+L262: sub #133, *r6
+
+inc r5
+not L272
+L263: dec *r5
+jsr *r5
+L264: bne *r3
+dec r3
+; comment
+L265: prn L260
+red L117
+rts
+rts
+rts
+sub #26, *r6
+lea L123, r4
+sub r2, *r5
+mov r4, *r4
+L266: dec *r1
+L267: .string "fkzehkdeiqkfdvbaomenm"
+L268: .data -708, -141, -728, -43, 58, -703, -183, -21
+jmp L271
+sub L135, *r5
+jsr L131
+L269: lea L272, *r0
+L270: inc *r4
+jmp L233
+clr L111
+L271: red L187
+L272: not *r7
+mov r2, L273
+add L273, *r4
+L273: clr *r0
+L274: cmp *r7, #-255
+stop
+add r6, r2
+dec *r4
+mov *r6, r2
+cmp #-41, *r3
+stop
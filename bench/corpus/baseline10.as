@@ -0,0 +1,1019 @@
+; Generated by genCorpus --seed 11
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+clr L60
+add L136, *r6
+not *r7
+clr r4
+jmp L98
+mov *r1, L171
+not L211
+clr L1
+sub #-173, L170
+stop
+prn r4
+; comment
+not *r7
+jsr *r4
+L0: jmp *r7
+prn #-221
+not L0
+rts
+clr r4
+cmp r1, L0
+L1: .string "owxuxrmawixrideakq"
+lea L0, *r4
+L2: .string "rcgsjqhfcdljxvmwzys"
+mov L1, *r3
+bne *r0
+inc *r7
+jmp *r7
+prn L1
+L3: .string "svwztmqj"
+L4: .data -666, 216
+cmp #-244, #151
+mov r5, L198
+L5: red L5
+; comment
+add *r6, *r4
+L6: .data 925, -80, -534
+L7: jsr *r2
+L8: .data 839, -172
+sub #-151, L4
+clr L141
+jmp *r2
+add *r4, r3
+rts
+not *r2
+bne L156
+stop
+prn r7
+prn L65
+lea L0, r2
+inc r3
+lea L8, r4
+add L4, r0
+L9: rts
+prn *r4
+not *r3
+L10: dec *r3
+sub *r5, *r6
+jsr L228
+not *r5
+L11: bne *r0
+red *r7
+
+jmp *r2
+L12: .data -777, -868
+L13: bne *r7
+L14: prn *r7
+
+lea L62, L171
+not r1
+red L10
+dec *r0
+lea L244, r5
+mov *r1, *r2
+L15: .string "rqxgcuilebfccgnvyic"
+L16: red r5
+L17: .data -426, 948, 574
+jsr *r4
+jsr *r3
+jsr *r2
+add #212, *r2
+jmp L186
+; comment
+L18: .string "d"
+jmp L187
+L19: inc *r1
+
+lea L91, L8
+lea L252, L1
+lea L253, r5
+L20: .data -539, 382, 664, 293
+L21: inc L78
+mov L10, L41
+stop
+red L14
+rts
+clr r5
+inc L9
+jsr *r7
+L22: .data -470, 388, 526, -302, 91, -873, 699, -512
+
+stop
+jsr L19
+L23: bne *r3
+not L18
+sub r1, *r3
+rts
+inc *r3
+L24: red r2
+clr *r0
+clr L90
+not L116
+L25: jsr L19
+L26: .string "aobokejhudstpytlo"
+inc r6
+bne L19
+prn #220
+L27: dec *r1
+bne L14
+bne L23
+rts
+cmp *r0, L115
+L28: .data -502, -174, -471, 44, -683, -971, 573
+L29: lea L250, r6
+bne *r4
+clr L42
+dec r2
+rts
+L30: .string "goyplvjvdpcwxtkzfbrnnd"
+jsr L71
+L31: .string "bzhpuwrwlxvwfjgdvypoqsba"
+cmp r4, r5
+
+L32: clr *r3
+L33: .data 782
+dec *r0
+stop
+mov *r3, *r5
+sub #83, L52
+not r2
+; comment
+stop
+dec L87
+mov *r6, *r2
+L34: rts
+jsr L115
+stop
+inc r5
+stop
+L35: jsr *r0
+lea L231, L89
+cmp *r6, *r7
+sub #-170, r6
+not *r0
+rts
+rts
+L36: jsr *r7
+rts
+lea L30, r7
+L37: .data -891, -156, -427, -646, -58, -363, -322
+L38: .string "rycvet"
+bne L198
+L39: rts
+not r7
+prn *r2
+cmp r3, *r0
+L40: lea L44, r6
+L41: .data 77
+L42: .string "c"
+mov L45, L9
+prn #125
+sub *r1, *r4
+red L3
+L43: .string "hipbarvvh"
+add r4, *r3
+L44: jmp *r3
+mov L16, r0
+mov r5, L153
+L45: rts
+L46: bne L252
+jsr *r0
+bne *r5
+cmp r1, *r7
+L47: .data 798, 65, 576, 628
+mov r7, L20
+L48: bne *r6
+L49: prn r6
+stop
+rts
+jmp L10
+lea L81, *r2
+mov #152, L50
+stop
+rts
+sub *r2, L29
+; comment
+jmp L235
+L50: clr *r6
+sub r1, L65
+L51: not r3
+stop
+inc *r4
+inc r4
+L52: dec r7
+rts
+
+L53: not r4
+lea L70, *r2
+inc L49
+L54: rts
+add L88, r2
+; comment
+rts
+stop
+L55: lea L13, *r2
+not *r5
+bne *r0
+stop
+red *r0
+rts
+L56: .string "iiiqweyublekwv"
+bne L54
+prn #-45
+inc r5
+bne L252
+L57: .string "olnuydalon"
+inc r4
+L58: not L196
+L59: .data -909, -161
+L60: sub *r7, r0
+jsr *r5
+dec r0
+inc L12
+prn r5
+bne *r0
+jsr L255
+mov r2, *r4
+
+prn L20
+inc r0
+jmp L35
+sub #117, L157
+L61: .data 921
+L62: cmp *r5, *r1
+cmp #-132, *r0
+L63: .data -631, 800, 564, -443, 527, 991, 987
+jmp L194
+L64: .data 458, 973, 24, -95, 577, -245, 316, 645
+not *r4
+lea L149, *r1
+L65: .string "cqxlq"
+jmp *r2
+red *r4
+clr r7
+L66: .string "obqc"
+L67: stop
+cmp r0, #2
+red r3
+lea L0, *r3
+mov r4, r5
+L68: not L85
+L69: .string "qqj"
+prn #-220
+L70: .string "zirzupdtcwtygewtycbx"
+L71: jsr L18
+mov *r2, r2
+rts
+L72: .string "alkikorkxhkjijdpwwvume"
+inc *r6
+clr L12
+jmp L36
+prn r7
+rts
+rts
+mov *r2, *r4
+L73: jsr *r2
+prn r5
+L74: dec L70
+L75: cmp *r5, r5
+lea L60, r4
+mov r5, L40
+stop
+clr L97
+stop
+cmp *r3, #255
+stop
+clr r0
+jmp L12
+mov #-20, L122
+red L116
+lea L101, L34
+dec r4
+not L15
+cmp L103, *r6
+mov L68, r7
+bne L68
+sub L135, *r0
+jmp *r1
+stop
+clr L174
+prn *r4
+mov L123, *r3
+L76: not L46
+jmp *r5
+jmp *r3
+L77: not *r3
+stop
+L78: .data -467
+lea L121, r5
+jmp L233
+L79: .string "ukatvkxhbtrvzndcwcg"
+dec r0
+L80: .string "sk"
+add #-210, *r7
+inc L30
+cmp r0, L41
+not L8
+mov r4, r6
+rts
+inc L77
+L81: not r3
+red *r0
+sub *r5, L190
+L82: inc *r7
+not r6
+lea L59, L55
+L83: rts
+L84: .data -306, -792, -715, 790, 793, -832, 547
+inc *r1
+jmp *r3
+stop
+L85: dec r5
+L86: stop
+cmp L166, L176
+jsr L1
+lea L38, r0
+L87: lea L198, *r0
+inc L214
+inc *r0
+jmp L223
+; comment
+inc r0
+; comment
+bne L133
+bne L14
+clr L206
+rts
+
+L88: jmp *r5
+L89: .string "gywvz"
+bne L139
+cmp #-96, r7
+not *r1
+inc L45
+red L80
+L90: .data 744, -324, -363, -911, 982, 335, -852, -636
+dec L207
+not *r1
+rts
+L91: bne L68
+L92: .data -840, -197, 547
+add *r1, *r4
+L93: red *r2
+mov r6, *r1
+
+lea L166, L179
+red *r3
+lea L15, L236
+L94: .string "klugcv"
+L95: .string "q"
+prn L141
+
+jsr L180
+dec L38
+L96: .string "iduvvmqm"
+L97: sub r7, r4
+add r3, L253
+dec *r0
+add L198, L175
+L98: mov L85, r0
+mov L7, L247
+red *r7
+mov L89, *r7
+L99: .data 347, 834
+red r2
+red r3
+inc r5
+red L36
+L100: prn *r4
+rts
+clr L91
+L101: add r1, L5
+red L33
+L102: clr *r7
+L103: prn #-255
+L104: not L77
+inc L169
+dec r4
+L105: lea L124, *r6
+cmp L37, L148
+; comment
+prn *r0
+prn r2
+inc L75
+
+jmp *r1
+jmp *r0
+L106: inc *r4
+clr L221
+jsr L36
+lea L224, r0
+bne *r1
+L107: jsr *r7
+lea L246, L233
+not r2
+lea L185, L192
+sub r7, r6
+inc r1
+clr *r4
+L108: sub r0, L39
+dec *r1
+sub *r7, r4
+jmp *r0
+L109: .data -1000, -575, 504, 870
+lea L125, *r6
+L110: .string "yklleqfi"
+inc r7
+jmp *r3
+L111: stop
+red L9
+L112: clr *r7
+rts
+L113: jmp L75
+add *r5, r2
+L114: mov L97, r2
+stop
+rts
+add L238, r7
+clr r4
+clr r3
+L115: cmp r0, *r2
+clr L73
+L116: dec L147
+L117: .data -548, -582, 517, 152, 416, 968, -52
+inc *r4
+prn *r1
+prn r4
+cmp r2, r2
+L118: .string "yorackgcmqglf"
+L119: .data -467, -456, 79, -898, 459, -326
+mov *r1, r2
+add #-99, L114
+bne L43
+jsr L196
+L120: .string "dmiugtnkdglpubixrczqm"
+lea L84, r2
+mov L37, r4
+cmp *r0, r4
+sub r7, r3
+L121: .data -64, 146, 263, -937, 149, 81
+L122: inc L50
+L123: lea L90, r3
+L124: jmp *r7
+L125: lea L95, r5
+clr r7
+L126: .string "iykwhkljsshxnxzfezqktron"
+cmp L100, #149
+dec L74
+clr L151
+L127: clr r4
+jsr L226
+red *r1
+L128: inc r7
+L129: cmp L53, *r3
+red r0
+inc L165
+L130: mov #108, r6
+not L151
+L131: .data -328, 273, -743
+bne *r4
+jmp *r4
+jsr *r5
+not L112
+lea L164, *r2
+
+L132: bne L48
+; comment
+dec r0
+red *r2
+sub *r5, *r6
+prn *r6
+L133: inc r4
+clr r5
+prn *r0
+inc r2
+L134: dec L21
+L135: jsr *r6
+L136: sub #-63, r7
+inc r2
+L137: .string "emnalyluwp"
+jmp *r5
+dec L106
+sub L87, L215
+prn *r5
+prn #184
+cmp #-217, #85
+bne L3
+cmp *r6, *r2
+bne L5
+bne *r3
+L138: lea L203, L93
+L139: red r6
+add r5, *r0
+cmp #129, *r7
+red *r4
+mov r2, r7
+add L147, *r2
+jmp *r7
+inc *r2
+L140: .string "omzqrtedcvzg"
+L141: bne *r5
+prn r2
+sub L60, L155
+stop
+L142: rts
+red r3
+L143: prn L258
+L144: .data -195, -159, -118, -382
+inc *r7
+
+prn r5
+cmp #-184, *r3
+prn #-56
+prn #137
+mov r5, r0
+L145: lea L7, *r5
+rts
+jmp L244
+L146: inc *r0
+; comment
+dec *r0
+jmp L156
+sub *r7, r4
+; comment
+prn #214
+rts
+jsr L194
+L147: .data 322, -392, -679, 366, -483, -325, 792, 573
+clr *r4
+red *r4
+bne *r6
+; comment
+L148: .string "nverbpw"
+bne *r1
+stop
+clr r2
+red *r1
+add *r3, r2
+dec *r4
+L149: dec *r6
+prn *r4
+sub L178, r5
+L150: .string "onboqiseadzqnyfjsmqcyfm"
+mov #-197, r4
+lea L63, *r0
+lea L207, r5
+L151: .string "icncbhqwtimxlqymc"
+not *r2
+not *r5
+cmp L18, L76
+L152: prn r0
+clr L200
+prn *r7
+inc *r2
+stop
+add *r3, L241
+mov r4, L47
+L153: not *r3
+cmp #-112, r2
+bne *r5
+
+not r4
+inc *r2
+L154: .string "zbbncchtpbsnt"
+clr r4
+stop
+sub L180, L167
+inc r7
+lea L81, L13
+L155: bne *r5
+bne *r3
+L156: .data 72, 643, 12, 168
+sub r6, *r6
+inc *r6
+red L204
+dec r5
+red L141
+L157: add r2, *r5
+red *r5
+red L210
+cmp L203, L0
+sub L56, r2
+jmp *r0
+dec L199
+sub *r4, *r0
+dec *r3
+L158: rts
+cmp L102, L162
+add r4, L1
+L159: dec L182
+add r6, L12
+jsr L81
+red r3
+L160: inc r1
+cmp #-77, r1
+L161: not r0
+L162: .string "t"
+L163: stop
+rts
+add L21, r0
+not *r2
+L164: stop
+; comment
+clr r0
+L165: inc L74
+red r3
+stop
+L166: jmp L177
+L167: bne L43
+bne L198
+jmp *r0
+jsr L177
+not L81
+add #58, *r4
+
+mov #-210, r4
+not r2
+mov L213, L177
+add *r5, L123
+red r4
+L168: mov r4, *r3
+mov #166, L102
+not L212
+red L206
+L169: bne *r7
+L170: .string "fulhdmmj"
+inc L93
+rts
+jmp L165
+prn r4
+inc L255
+dec r3
+dec L204
+L171: not *r6
+L172: .string "akmqenyabbjhphbnhugy"
+not r0
+L173: lea L96, *r0
+jmp *r4
+inc *r1
+mov L192, L227
+not *r4
+dec *r3
+add L191, r7
+prn r6
+jmp L239
+L174: jsr *r0
+L175: .data 963, 270, 873, -877, 48
+inc L73
+red *r7
+add L260, *r4
+L176: .data 913, 493, -581
+L177: inc r5
+lea L247, L11
+L178: lea L204, r0
+stop
+L179: .data -80, -242, 755
+
+not L194
+; comment
+L180: .data 940
+jmp L150
+L181: not *r0
+L182: .string "btbtoixzfctiulj"
+red r7
+jmp L193
+L183: .string "wzxbvoovmxcoteei"
+bne L197
+L184: cmp L171, #249
+L185: lea L9, L237
+clr r4
+L186: sub L249, L211
+bne *r6
+L187: not *r4
+L188: inc *r1
+L189: .string "tkkjds"
+L190: dec r5
+inc r3
+jmp *r1
+L191: jmp *r7
+L192: .string "wiawhjfijelotpwna"
+
+cmp L41, r5
+stop
+inc *r2
+not r5
+dec *r3
+
+L193: rts
+jsr *r7
+stop
+lea L209, L152
+inc *r2
+; comment
+not *r3
+dec L248
+L194: cmp *r3, #138
+L195: mov r1, L252
+mov r6, *r1
+cmp L235, r3
+L196: sub *r1, *r7
+L197: prn *r3
+rts
+
+sub r0, r0
+clr L219
+add r2, L161
+L198: .string "anfqmdxksqwnejivudiintiz"
+lea L175, r5
+L199: .data -599, -508, -838, -184, -28, -586, 793, 753
+not r7
+rts
+; comment
+L200: .string "lhktwnjqdfvgetzaxojkr"
+sub #201, *r6
+
+L201: inc r7
+; comment
+L202: stop
+inc *r3
+inc *r7
+not L28
+jmp *r2
+dec L199
+add *r7, L190
+red *r5
+jsr *r3
+red L4
+not r4
+L203: inc *r5
+
+red r0
+L204: cmp #29, *r2
+red L25
+stop
+jmp L245
+clr *r2
+add #248, *r3
+sub #-124, L38
+not *r0
+jmp *r2
+stop
+L205: stop
+; comment
+L206: rts
+mov L39, L211
+not r0
+
+dec *r7
+L207: prn r0
+inc *r1
+L208: .string "cfuoe"
+jsr *r2
+clr *r6
+L209: .string "ricdfrmjcmdhcc"
+lea L17, L66
+L210: jsr *r0
+dec L178
+add r4, r4
+jmp *r3
+sub r3, L220
+clr r7
+clr r1
+
+jsr L251
+prn r1
+clr L100
+lea L257, r5
+L211: mov r5, L238
+jmp *r1
+sub r4, L186
+jsr L250
+
+prn #-74
+L212: .data -658, -462, -861, -970, 812, 752, -194, -418
+cmp r4, #-62
+L213: dec r2
+prn *r2
+; comment
+clr L260
+jsr *r3
+sub L244, L239
+stop
+inc L253
+L214: stop
+L215: .data 687, -221, 796, -31
+add *r7, *r4
+red *r7
+jmp *r0
+
+L216: rts
+not *r1
+cmp #-237, r7
+lea L252, L218
+prn #-125
+add *r2, L168
+stop
+rts
+L217: add L79, *r1
+prn *r4
+prn #-106
+stop
+L218: stop
+rts
+L219: .string "e"
+add L187, *r2
+L220: .data -291, 64, -75, 943, 588
+jsr L143
+cmp r3, r6
+
+; comment
+bne L153
+cmp L253, L124
+L221: add #21, *r0
+inc *r2
+cmp #171, r2
+inc L18
+mov *r6, r5
+L222: .data 942, -624, -452, -963, 269
+stop
+jsr L260
+bne *r2
+
+clr r0
+cmp L21, r1
+stop
+L223: clr r1
+jmp *r0
+add *r3, r4
+prn L135
+L224: sub *r2, *r1
+cmp r6, r3
+L225: jmp L248
+dec *r3
+jsr *r4
+cmp #0, #23
+inc L233
+L226: dec *r3
+L227: .string "qz"
+
+dec r6
+L228: mov #-221, *r2
+L229: .string "jvl"
+not L184
+L230: .string "ehfy"
+stop
+stop
+mov *r5, r7
+mov #-63, *r4
+sub L245, *r0
+L231: .data -860, -242, 263, -810, 798, -141
+sub *r4, *r4
+L232: .string "e"
+add r1, r3
+L233: dec L259
+sub r5, r6
+not *r1
+L234: .data -683, -459, 134, 533
+L235: stop
+red L237
+L236: sub *r0, L251
+stop
+dec r1
+jmp L257
+inc *r2
+L237: dec L240
+L238: clr r2
+stop
+rts
+rts
+rts
+jmp L75
+bne *r2
+stop
+jsr L61
+prn r5
+L239: lea L141, *r0
+mov L130, L246
+L240: clr L247
+L241: .data 954, -699, -105, -949, -579, -162
+lea L247, *r1
+dec *r1
+stop
+L242: .string "r"
+jmp *r3
+mov *r2, L211
+dec L89
+L243: .string "ffy"
+cmp *r1, L255
+not L261
+cmp L251, *r7
+add r2, r7
+clr r6
+; comment
+jmp L91
+stop
+not *r0
+
+red L34
+add r6, *r0
+dec r4
+not *r3
+; comment
+prn #63
+L244: .string "ivsvlyvfgeiknnsoowqf"
+not *r7
+L245: clr r7
+jsr L248
+jsr *r7
+jmp L251
+L246: inc L261
+add L241, r4
+add *r3, L71
+clr r2
+
+not r2
+prn L247
+prn r2
+bne L59
+L247: .string "etszxyb"
+jmp L250
+not L258
+inc *r2
+prn #-178
+
+lea L233, L251
+rts
+inc r1
+L248: inc L83
+L249: add *r3, r7
+L250: .string "izbcsacjgvigfcuszgezxyof"
+prn #-184
+jmp L251
+prn r7
+inc L261
+
+L251: clr *r2
+bne *r5
+jmp L256
+L252: .string "aunm"
+red *r0
+stop
+not L1
+dec *r2
+stop
+inc L256
+cmp L140, L137
+L253: bne L242
+prn *r5
+stop
+L254: .string "zfvixmugsilzier"
+L255: jsr L260
+stop
+stop
+stop
+mov *r5, r0
+jmp *r7
+not *r7
+lea L33, L256
+cmp r0, *r4
+
+L256: jmp L260
+dec L208
+stop
+L257: bne *r4
+bne L258
+L258: lea L62, r4
+L259: .string "iuccrwqqyjkamtx"
+mov L25, L260
+stop
+stop
+jsr L44
+lea L260, L241
+L260: cmp #-18, *r6
+bne L195
+stop
+prn L261
+L261: rts
+jsr L62
+rts
+; comment
+red L202
+stop
@@ -0,0 +1,1019 @@
+; Generated by genCorpus --seed 12
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+jmp *r6
+bne L21
+prn #132
+add *r0, L112
+clr *r7
+mov #117, *r1
+red L170
+clr *r3
+L0: .data -764, -500, 679, 918, -126, -367, 711, 704
+rts
+
+mov r4, L109
+prn #248
+mov #85, *r2
+L1: red *r0
+rts
+cmp *r1, *r4
+add #106, r5
+cmp L55, r5
+mov #-254, *r3
+L2: mov *r5, L2
+L3: .string "ehnycdsncueqerbhldcyv"
+lea L2, L146
+L4: jmp *r4
+add *r4, r6
+cmp r2, #161
+stop
+; comment
+dec *r2
+clr *r6
+prn L208
+L5: .string "flwohuwbx"
+; comment
+L6: sub L2, L0
+lea L0, r6
+prn r6
+stop
+prn #-16
+L7: jsr *r3
+L8: .string "agyifdkmfxcwbnzfn"
+L9: stop
+clr *r4
+L10: .data 250, -170, -454, 438, 910, 797
+cmp *r3, r2
+mov L7, r4
+mov r2, r5
+sub *r6, r1
+L11: bne L2
+not r6
+; comment
+bne L4
+
+jmp *r7
+jsr L6
+L12: jsr L1
+L13: add #-24, *r4
+add r2, *r5
+not r6
+L14: .string "yqnfkadgfkhfxswdbzsnu"
+not L10
+jsr L55
+sub L5, L11
+L15: mov #-242, r3
+jmp L79
+stop
+stop
+jsr L158
+L16: prn r4
+red r2
+L17: cmp #249, r4
+add #38, L17
+L18: cmp L2, *r6
+; comment
+rts
+dec L17
+L19: cmp *r1, *r0
+prn r0
+L20: lea L133, *r2
+L21: rts
+stop
+not *r7
+red L12
+stop
+L22: prn *r4
+bne L254
+L23: lea L7, r0
+clr r1
+prn *r1
+jsr *r6
+prn L19
+rts
+not L4
+L24: .string "rylfgqacscekekqzps"
+L25: red L9
+L26: mov *r4, *r1
+stop
+L27: cmp *r6, r4
+add r5, L237
+jsr *r3
+rts
+jmp *r4
+mov #-117, r1
+clr r6
+clr r4
+add *r4, r2
+lea L36, r2
+mov *r5, *r4
+cmp #-156, L6
+rts
+L28: jsr *r4
+
+jsr *r7
+stop
+L29: .data -979, 509
+jmp L49
+; comment
+clr r1
+L30: .data -964, -850, 63, 215, 309, -664
+bne L75
+rts
+L31: sub #114, L107
+jsr *r6
+jmp *r6
+jmp *r4
+mov #-20, r2
+; comment
+L32: cmp #-228, r3
+sub #163, r6
+not r7
+not L252
+clr r6
+L33: .data -991, 344
+L34: .string "paedsjpjrnagxhngnwstjv"
+inc r1
+prn r2
+stop
+jmp L84
+bne *r0
+bne L19
+L35: jmp L15
+sub #-11, *r5
+L36: cmp r1, #236
+L37: inc L34
+stop
+L38: red r1
+lea L13, *r5
+cmp #-88, L161
+dec *r2
+L39: jsr *r7
+L40: sub #-13, L44
+inc L33
+bne L3
+; comment
+; comment
+rts
+
+L41: .data 568
+bne L42
+add *r3, L4
+bne *r3
+cmp *r1, L49
+jmp L151
+L42: add *r6, L188
+not *r3
+sub #232, *r0
+red L31
+cmp #-251, *r4
+cmp *r0, L18
+L43: .string "ocmndgnbdxtfmiwskqv"
+add r4, *r3
+
+not L237
+add *r1, *r1
+jsr *r4
+inc L24
+inc L39
+; comment
+L44: .data 392, 713, -187, -470, -687, -354, 519
+L45: .string "frlszyjfqwmldgaxolljtvsz"
+lea L73, *r5
+inc r4
+jsr *r6
+jmp L123
+prn #-85
+bne L14
+stop
+
+not r0
+
+L46: clr r2
+L47: .data 23, 808, 972
+mov L101, *r0
+L48: .string "xgxnqlorfae"
+prn *r1
+lea L60, r1
+bne *r6
+L49: .data 979, 833
+L50: .string "ynlwjujcskwpkxsktlxplq"
+stop
+L51: jsr L3
+jmp L17
+L52: .string "ucdusrvzbjnebz"
+L53: .data -319, -790, 110, -733, -534, 69, 435, 327
+sub r7, *r1
+L54: .data 759, 208, 239, -901
+L55: prn *r2
+sub *r6, *r5
+red L46
+mov L76, L39
+jsr *r2
+L56: .data -478, -975, -97, -575, -909, 482, 332
+rts
+bne L155
+prn #134
+L57: .data -575
+stop
+jmp *r0
+add L206, *r1
+cmp *r0, #-149
+L58: bne *r6
+L59: sub #191, r6
+inc L135
+L60: sub L44, *r7
+L61: jmp L175
+L62: bne *r5
+not L8
+L63: add *r1, *r7
+inc L232
+bne *r6
+rts
+lea L63, L183
+not L1
+jmp L94
+stop
+
+dec *r2
+L64: cmp #-165, L141
+inc L51
+jmp *r1
+rts
+
+bne L84
+add *r3, *r7
+
+L65: prn #101
+cmp *r5, #-214
+not r1
+L66: jsr L37
+stop
+lea L102, *r3
+stop
+L67: jmp *r5
+cmp #21, r7
+inc *r3
+red L53
+
+cmp *r3, *r0
+jmp L227
+dec r3
+stop
+mov #189, *r3
+L68: bne L160
+rts
+jsr L198
+bne L78
+prn r7
+L69: .data -45, -881
+L70: .string "iz"
+inc L39
+
+L71: add L255, r3
+L72: inc r4
+not L136
+L73: .string "ddbwpunjkpiko"
+rts
+jmp L221
+L74: sub L264, r7
+L75: lea L3, *r1
+stop
+L76: clr L24
+jsr *r7
+sub *r2, *r2
+lea L124, r1
+add *r1, L21
+L77: sub r7, *r3
+L78: lea L40, *r7
+not *r3
+red *r4
+clr *r7
+; comment
+add #-67, *r7
+lea L20, *r4
+inc *r0
+clr *r7
+not L216
+L79: .string "xnsfcg"
+dec r6
+jmp *r0
+lea L50, L255
+cmp r5, *r7
+bne *r0
+clr r7
+sub #58, r3
+stop
+dec *r3
+L80: .string "nraiikcuwvjr"
+L81: sub *r3, r1
+sub #160, *r0
+L82: .data -843
+L83: rts
+L84: .data 342, 610, 944, 504, -708, 122, 568
+red *r0
+lea L64, r4
+; comment
+; comment
+bne *r4
+sub *r3, *r7
+cmp L56, L249
+L85: .string "vjllmp"
+L86: clr *r4
+inc *r3
+stop
+not r6
+add #-213, L91
+
+inc L264
+sub r2, *r3
+bne *r7
+L87: inc *r3
+cmp r7, L137
+L88: .data -583, -402
+clr L80
+lea L13, r6
+jsr L9
+L89: .string "p"
+L90: dec r6
+stop
+dec *r1
+add #-214, *r5
+L91: .data 544, 693, -321
+jmp L90
+L92: cmp *r0, L254
+jsr L113
+L93: cmp L127, #-76
+clr L30
+jsr *r0
+jsr L51
+sub #-114, r4
+L94: .string "am"
+mov *r6, L23
+clr *r6
+inc *r4
+L95: .string "mzcqjnzmxfxfsi"
+L96: .data 145, -49, -610, 319, 422, 16, -658
+L97: .data 854, -433, 394
+inc L32
+not *r0
+sub #57, r7
+cmp #-14, #197
+L98: .data 83, -971, -64, -866
+add #-144, *r1
+clr *r6
+
+clr r4
+bne *r5
+inc r6
+rts
+red L231
+cmp *r7, *r4
+cmp L185, *r4
+add #-243, r7
+L99: jsr *r7
+not r7
+clr *r5
+red r2
+not L15
+rts
+add #6, r0
+mov #180, r1
+L100: jsr L6
+mov r0, r5
+
+inc *r4
+L101: mov L53, *r1
+clr r2
+L102: sub r2, L109
+lea L111, r6
+dec r3
+clr *r3
+sub r6, *r7
+sub r4, *r7
+jmp L191
+L103: clr *r1
+prn r6
+rts
+inc *r2
+dec L181
+mov #-242, *r7
+L104: .data 291, 585
+rts
+dec L36
+clr *r1
+lea L66, L97
+jmp L211
+jsr *r3
+rts
+L105: .string "lysnneejhwkpse"
+L106: .data -311, -665, -993, -81, -682
+jmp *r5
+not *r0
+L107: .data -996, -669, -875, 188, 20, -874, -476, 353
+not r4
+L108: stop
+rts
+dec r2
+sub *r7, r5
+sub *r0, L206
+clr L122
+rts
+dec L206
+L109: .string "yxahciypgcgsoqgm"
+L110: .string "joannufq"
+
+bne *r3
+add *r1, L26
+L111: .string "lnvzsffpbk"
+clr r0
+cmp L220, #-61
+L112: .string "bbfiu"
+dec r6
+jmp *r5
+L113: rts
+dec *r7
+bne *r0
+inc L25
+add r3, L43
+clr r0
+jmp *r3
+
+prn r3
+inc L225
+L114: jsr L127
+L115: prn *r4
+jsr L91
+prn *r4
+prn #-166
+add L80, r4
+sub *r6, r2
+dec r1
+
+sub *r0, L246
+rts
+lea L217, *r0
+L116: .string "lsbojzlogo"
+L117: .string "lfhtvlsyecyu"
+L118: rts
+L119: sub *r3, *r7
+clr L49
+lea L34, *r5
+lea L194, r4
+red L59
+clr r6
+bne *r0
+inc *r1
+not L88
+mov #-231, L52
+inc L263
+L120: .data -281, 298
+jmp L114
+red L241
+prn L38
+cmp r5, L54
+stop
+rts
+stop
+jmp L24
+L121: .data 107, 297, -723, 38, -657, -289, -383, 233
+bne L254
+L122: inc L184
+mov L256, L70
+; comment
+L123: clr L243
+dec *r1
+mov #214, *r4
+not r5
+not r6
+red r0
+jsr *r1
+; comment
+add r6, L16
+add #120, r7
+lea L238, r6
+not L60
+L124: prn L17
+
+jsr L207
+L125: rts
+add L264, *r2
+rts
+
+red *r5
+jmp *r3
+clr *r2
+lea L212, *r4
+mov r1, L242
+jmp L123
+L126: .string "lvjnetskdcinwtrgsrisuyed"
+lea L236, L256
+L127: rts
+L128: sub L168, r0
+rts
+cmp r4, L179
+L129: jsr L102
+clr r7
+add r1, r5
+L130: .data 118, 156, 442, -337, 802
+; comment
+jmp *r0
+not L214
+not *r4
+; comment
+add r6, *r4
+L131: prn *r4
+L132: .data 777, 911, 846, -950, -750, -321, -920, 818
+dec *r1
+; comment
+clr *r2
+cmp *r7, r5
+dec *r1
+clr r4
+dec L192
+L133: prn #147
+clr *r3
+jmp *r4
+L134: .string "rtaynvhxmrfncwuzggcmorp"
+sub #39, *r2
+clr r6
+jmp *r6
+bne L157
+not *r4
+not L152
+
+L135: jsr L42
+L136: .string "oufolstqj"
+dec L21
+
+L137: .string "azblozzlhxq"
+L138: not r1
+L139: prn r0
+clr r1
+jsr L151
+L140: mov r3, *r4
+not r7
+sub #-164, L247
+L141: mov r0, L4
+mov L96, L106
+L142: .data 362
+sub #132, r5
+mov r1, *r6
+L143: .data 402
+red *r2
+L144: lea L226, *r2
+clr *r1
+inc L191
+sub r4, *r0
+clr L167
+jmp L202
+mov *r7, *r7
+prn r3
+L145: .data 27
+L146: dec r5
+sub #-102, L183
+jmp *r7
+L147: .string "azgr"
+L148: bne *r7
+
+jmp L31
+not r5
+mov L160, *r6
+L149: stop
+rts
+L150: rts
+jsr *r2
+sub L202, L77
+rts
+L151: sub #-26, L36
+L152: .data -459, 572, 116, 207, 832
+L153: .data 595, -140
+L154: inc *r3
+
+jmp *r4
+sub *r6, L155
+clr *r2
+red L161
+L155: mov *r4, L117
+sub r3, *r2
+sub r1, *r7
+L156: inc L146
+not *r5
+red L27
+red *r0
+clr *r0
+bne L7
+inc r5
+mov #117, r2
+lea L101, r3
+jsr *r3
+bne *r3
+sub L23, L245
+L157: .string "jrmsgo"
+jmp L179
+
+bne L87
+lea L96, r7
+L158: bne *r1
+bne *r7
+sub *r7, r2
+L159: lea L69, *r2
+bne *r5
+dec L248
+bne *r1
+dec *r6
+inc L204
+
+L160: lea L262, *r2
+dec r0
+L161: .string "cxkdyzsljzyzld"
+L162: .string "eicqzbdzc"
+cmp r5, L171
+mov *r5, r5
+clr r3
+bne L146
+cmp r1, #126
+clr r7
+stop
+red L124
+red *r2
+add #59, *r2
+L163: stop
+clr *r2
+not L217
+; comment
+clr r3
+L164: stop
+stop
+lea L151, r0
+L165: not r4
+lea L58, r4
+sub *r1, *r2
+mov #216, *r3
+clr *r5
+not *r4
+sub r3, *r0
+dec *r4
+jmp *r4
+clr L41
+rts
+L166: .data 917, -573, 674, -894, 20, -16, 770, 553
+jmp L265
+prn L28
+lea L208, L12
+L167: .data -955, 925, 677, -511, -326, 303, -622, 347
+sub #207, r5
+cmp #241, L256
+L168: dec r7
+bne *r6
+clr L145
+; comment
+lea L111, *r6
+inc r3
+not L54
+; comment
+red *r7
+jmp *r1
+clr *r2
+L169: rts
+jmp L235
+jsr L15
+jmp *r4
+rts
+L170: inc r5
+L171: sub *r5, *r2
+lea L194, L251
+lea L179, *r5
+jsr *r1
+L172: rts
+dec r5
+bne L80
+rts
+stop
+L173: stop
+; comment
+
+; comment
+prn r4
+lea L150, *r3
+L174: jmp *r1
+bne *r4
+jsr *r3
+L175: .string "ffzkmyrhknviwygdhctiqa"
+not *r7
+L176: .data 492, -639, -99, -998, -43, -571
+not L131
+L177: red r0
+L178: .string "pezrzpnqqwakttkikzfbkf"
+jsr L252
+bne L184
+bne L151
+jsr *r0
+inc r6
+
+not *r6
+not L80
+L179: cmp L101, #-41
+jmp *r6
+cmp *r4, *r3
+not L211
+prn *r2
+jmp *r3
+L180: prn *r0
+bne *r5
+add #34, *r3
+mov #-229, r1
+sub L266, *r7
+inc r0
+add r4, r4
+inc L246
+jsr L123
+L181: inc L163
+L182: .string "thjsjtkgetnmxu"
+not *r3
+mov r1, r4
+add #96, *r4
+jsr L185
+lea L245, L244
+cmp #-69, L189
+prn r0
+cmp #225, L155
+
+cmp r3, *r7
+L183: mov *r4, r0
+L184: .string "ldnokmpghud"
+dec *r6
+dec r5
+L185: stop
+red r0
+stop
+L186: clr *r2
+lea L206, r2
+prn #41
+jmp L207
+dec r2
+cmp #170, L249
+jsr *r6
+stop
+sub r5, L232
+mov *r4, L201
+L187: .data -747, -235, -210, -734, 21, 746, -311
+inc r5
+cmp L82, L203
+L188: inc L108
+lea L217, L212
+mov #-93, L236
+dec L57
+add #4, r3
+mov L128, r6
+L189: sub L230, *r7
+prn L182
+mov *r3, *r1
+jmp *r3
+mov r3, r6
+
+L190: sub *r1, *r5
+L191: .data 281
+L192: jsr *r6
+mov #99, L215
+L193: .data 416, -610, -395, -439, 491, 720
+L194: inc r1
+cmp *r7, #252
+not *r4
+L195: clr L30
+jmp *r2
+inc L77
+jmp *r2
+sub #85, L262
+rts
+dec r2
+cmp L215, r0
+cmp r6, #58
+stop
+rts
+L196: .string "tj"
+L197: .data -399, -330, 599, -784
+L198: jsr L234
+L199: cmp L134, #156
+inc r5
+prn L210
+L200: add #-64, L253
+L201: not r7
+L202: not *r2
+jmp L153
+red L254
+sub *r2, r6
+lea L8, r7
+L203: red L116
+
+L204: cmp r3, L185
+bne L32
+rts
+L205: inc r4
+L206: .string "cjbtxk"
+jmp L118
+L207: not L172
+L208: stop
+dec r2
+add r7, L113
+not L255
+not *r4
+lea L127, L217
+dec L75
+jsr *r5
+L209: mov L241, r0
+L210: lea L77, r7
+L211: add *r1, *r4
+dec L244
+L212: prn r1
+inc r1
+rts
+L213: .data 338, 514, 350
+clr L262
+lea L246, r3
+not *r5
+L214: inc r3
+
+L215: jsr *r5
+clr r2
+L216: .data 371, 261, 892, 812
+mov #82, *r7
+add r3, *r3
+lea L261, L209
+L217: stop
+
+prn r2
+prn *r0
+not r4
+L218: rts
+red L229
+jsr *r5
+clr *r2
+
+L219: .string "ukoji"
+red r4
+prn *r1
+mov #-201, *r1
+stop
+stop
+add *r6, *r4
+sub *r1, r6
+L220: dec r4
+L221: prn *r4
+L222: not *r7
+inc L15
+bne *r2
+red r7
+clr r3
+sub L230, r6
+prn *r5
+L223: lea L230, r0
+mov r5, L257
+L224: .string "oxctiglsvwqcbfr"
+mov #-232, *r5
+bne *r6
+stop
+L225: clr r4
+L226: prn r7
+jmp *r3
+not *r4
+sub L242, *r6
+jsr L40
+L227: .string "npqkrhe"
+rts
+L228: red L206
+clr r2
+red L0
+L229: stop
+
+L230: bne *r4
+clr r4
+jsr L246
+cmp *r7, r4
+L231: .string "zpnaqj"
+mov L259, L108
+sub r1, *r7
+inc L255
+not r1
+lea L82, L256
+add L62, L176
+mov #-70, *r3
+not r4
+L232: stop
+L233: mov L238, *r0
+L234: .string "bpoyvrha"
+jmp *r1
+L235: .data 468
+L236: sub L250, L264
+L237: mov *r6, *r2
+cmp *r4, *r6
+L238: clr L185
+L239: lea L250, L264
+L240: add *r2, r4
+L241: .data -211, -248, -831, 713, -77, 903
+add #219, L41
+red r1
+add L114, *r6
+
+stop
+L242: lea L256, *r4
+L243: not r4
+jsr *r2
+sub *r6, r1
+inc r5
+rts
+L244: .data 838, 530, 564, 693
+jmp *r2
+L245: inc *r4
+cmp r7, L258
+rts
+L246: .string "lbmkthzmhovvdcogregj"
+L247: cmp r5, #-3
+mov r2, *r2
+L248: .data -721
+red r3
+mov r4, L215
+prn #-128
+jmp L0
+jsr *r7
+inc L221
+L249: bne L238
+jmp *r7
+; comment
+jmp L158
+L250: inc L151
+L251: red *r2
+bne *r0
+mov r7, *r4
+rts
+L252: mov *r6, r4
+bne *r6
+bne *r0
+sub r6, r5
+lea L106, L260
+sub L259, L253
+jsr *r2
+L253: .string "ewbqtdpmztpp"
+cmp r5, r7
+prn r4
+add #91, r4
+L254: sub L125, *r7
+clr L257
+red *r5
+red r7
+red L262
+L255: .string "tzehommuu"
+dec r7
+L256: cmp *r7, r5
+inc r6
+L257: dec L4
+L258: .string "hyolxkwpxfge"
+dec *r6
+lea L264, *r7
+not r6
+lea L110, L182
+mov #-130, r1
+bne *r5
+inc *r6
+L259: inc *r6
+not L147
+L260: .string "vjqvfgsbp"
+add *r7, *r3
+L261: rts
+not r0
+L262: .string "bpiuuh"
+rts
+prn #-229
+rts
+sub L253, r4
+L263: rts
+dec L156
+bne L227
+rts
+L264: clr r0
+cmp *r1, r6
+cmp L266, *r7
+lea L266, *r1
+; comment
+dec L53
+jsr *r1
+L265: clr L266
+L266: dec L47
+bne *r4
+stop
@@ -0,0 +1,1019 @@
+; Generated by genCorpus --seed 13
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+clr *r4
+add #135, L253
+bne *r1
+mov r1, *r3
+prn L132
+inc *r2
+cmp r1, #205
+dec r0
+add #-173, r5
+L0: prn r5
+L1: .string "twsdeujunpvgeoyte"
+rts
+L2: inc r5
+jmp L129
+dec *r3
+L3: sub L95, r4
+rts
+jsr L1
+clr L2
+L4: bne *r4
+rts
+red r4
+clr L242
+cmp #233, *r2
+prn *r4
+inc L2
+lea L185, r2
+sub r5, *r5
+jmp L1
+dec L1
+
+L5: .data -337, -808, -618, -863, -985, -824
+mov r0, *r0
+mov *r0, L31
+rts
+stop
+jsr L5
+inc r3
+jsr *r1
+lea L164, r2
+inc L225
+inc *r7
+dec r6
+not r1
+inc *r4
+dec r6
+mov L1, r4
+L6: clr r0
+
+L7: .data 271, 315, 469, 408, 82
+; comment
+L8: bne L3
+rts
+add *r4, *r6
+rts
+rts
+add r3, L170
+jmp *r6
+lea L2, r4
+L9: bne L1
+jsr L0
+add r4, r3
+not r5
+; comment
+rts
+clr *r2
+L10: clr L1
+jmp L8
+L11: .data -832, -239, 820, 3, 720, 743, -954, -227
+L12: inc *r6
+add r5, L0
+stop
+stop
+L13: bne *r5
+L14: .data 613, 138
+bne *r5
+add #-135, *r0
+red L73
+inc L228
+L15: clr r0
+L16: .data -841, 116, -548, -599, 182, 897, -86, -527
+jsr L68
+rts
+cmp r5, *r1
+L17: sub *r3, r3
+dec *r6
+L18: .string "ygqkcanuzuuh"
+inc L18
+L19: prn #159
+
+jmp *r1
+L20: not *r7
+; comment
+cmp *r6, r5
+lea L42, *r7
+L21: .string "fkwxdywugfg"
+not L180
+L22: .string "oi"
+; comment
+add L263, L5
+rts
+red *r3
+stop
+dec L207
+not L209
+L23: lea L174, L258
+red r4
+bne L21
+sub *r0, r6
+L24: jmp L34
+lea L114, *r7
+stop
+L25: lea L85, r0
+lea L63, *r5
+dec r6
+add *r3, L4
+prn *r0
+add r5, L10
+mov r3, L18
+jsr L8
+L26: .string "ckri"
+red L196
+stop
+red *r2
+stop
+add L6, L83
+add r4, r4
+mov #-87, *r3
+bne L7
+clr r4
+bne L7
+inc r2
+stop
+bne L0
+L27: add r4, L6
+L28: jsr L149
+bne L11
+L29: .string "jxqvcnjhxewc"
+L30: .string "etr"
+add *r5, *r4
+L31: add L168, r1
+L32: rts
+L33: stop
+L34: lea L11, *r1
+L35: add r4, *r7
+L36: clr *r1
+L37: prn #-55
+red L32
+L38: lea L172, *r6
+sub *r6, *r5
+prn #-135
+L39: .string "koqtgpfqptwea"
+inc *r1
+clr r5
+inc *r1
+add L104, r5
+L40: clr *r4
+L41: jmp *r3
+inc *r5
+red *r2
+L42: stop
+rts
+dec *r2
+mov r2, r6
+red *r6
+stop
+mov *r6, L44
+L43: .data 842
+clr r5
+add r7, L8
+bne L14
+L44: .data 13, -75, 707, -674, 864, 560
+red r2
+add #-141, L6
+stop
+L45: add #215, *r4
+dec L27
+not *r7
+dec *r2
+jmp *r4
+dec r4
+dec r2
+red r1
+L46: rts
+add #-46, *r3
+red r2
+bne *r5
+; comment
+L47: .string "ydtteoryyotlko"
+dec L39
+prn *r2
+add r7, L26
+sub L81, L47
+L48: sub *r1, r3
+L49: inc *r7
+red r6
+not *r1
+; comment
+rts
+L50: bne *r2
+inc r3
+red L37
+red r7
+jmp L106
+prn L14
+L51: lea L15, L6
+mov L208, *r3
+bne L12
+; comment
+L52: red r7
+sub L183, r5
+L53: cmp #-29, r0
+L54: .data 890, -747, 635, 543
+lea L219, L120
+cmp L235, #-75
+cmp L230, *r4
+sub L144, r0
+add L197, *r1
+mov r2, *r0
+sub #-131, *r3
+inc *r5
+prn L1
+dec L19
+; comment
+prn L242
+L55: jmp *r6
+L56: sub r3, *r3
+inc L34
+red L207
+lea L82, r0
+L57: .string "egqziqpp"
+not *r0
+jmp *r6
+L58: bne L223
+add #-146, L200
+clr *r7
+lea L3, *r7
+
+L59: inc L5
+L60: .data 336, 785, 482, 116, 507, -524, -682, -818
+L61: jmp *r1
+L62: prn L184
+L63: not *r4
+cmp #-193, *r1
+rts
+rts
+sub r5, *r2
+L64: .string "gffjrjlrzxjhecfy"
+lea L8, *r4
+dec r4
+add #44, *r5
+prn r0
+cmp #144, L119
+L65: .string "bbkjkavmmpcbynosii"
+L66: .data -350, 460, -75, 782, 882
+L67: .string "wbhpqjuqdv"
+not *r5
+red *r0
+inc *r3
+L68: add L82, *r0
+jmp *r3
+prn *r7
+lea L207, r2
+L69: prn r5
+
+lea L9, *r2
+L70: red *r6
+L71: .data -81, 914, -703, -775, -231, 279, -14
+not *r2
+lea L174, L48
+L72: .string "lmyalecuggcj"
+inc *r0
+rts
+inc *r1
+rts
+red r1
+; comment
+clr L25
+L73: inc L103
+rts
+lea L69, r1
+L74: inc r4
+rts
+lea L233, L37
+L75: rts
+L76: jsr L95
+sub #23, *r3
+L77: .string "fmuvutpqwpgxcj"
+mov r5, *r7
+bne *r4
+rts
+stop
+jsr L39
+L78: .string "hqqmgyqzebqpcvemgaho"
+red L129
+sub r7, L24
+prn #-107
+inc L153
+L79: add r5, *r3
+clr *r0
+add #-17, L14
+; comment
+prn r4
+; comment
+L80: lea L232, *r1
+lea L68, L22
+add *r7, r3
+jsr *r5
+
+L81: mov r6, r0
+cmp #-242, r7
+lea L182, r0
+red *r7
+jsr *r0
+mov L8, r4
+jmp *r7
+add L81, r3
+jsr L73
+rts
+L82: sub L109, r1
+L83: jsr *r6
+L84: .data -835, 308, 792, -671, 417
+rts
+add #-233, r1
+L85: red L21
+L86: .data -849, -770, 174, -270, 172, -389
+L87: bne *r3
+lea L33, *r5
+rts
+red r5
+L88: mov L22, L248
+jmp *r6
+L89: .string "byz"
+sub *r2, r4
+L90: .data 856
+L91: mov r6, r4
+L92: bne *r1
+dec r3
+L93: lea L14, r2
+jmp *r6
+
+L94: jsr L19
+cmp L71, L10
+L95: add r3, L208
+L96: jmp L4
+jsr L160
+dec L61
+bne L19
+inc *r3
+L97: jmp *r1
+inc L166
+cmp #-190, *r7
+sub r0, *r6
+rts
+inc *r1
+inc r5
+sub #-235, r0
+dec r6
+rts
+L98: .data 753, 770, 407
+L99: .data 431
+prn *r4
+L100: .string "byfajthdydcss"
+red r6
+add r7, r6
+jmp L56
+L101: not *r2
+jsr L6
+mov *r7, r4
+cmp *r1, r7
+mov r5, *r3
+stop
+red *r0
+not L155
+mov *r4, L45
+bne L250
+
+L102: add L22, r3
+rts
+L103: mov #255, r1
+inc *r3
+inc L78
+not *r7
+stop
+red L139
+jsr *r3
+lea L18, L5
+jmp *r2
+L104: .data -711, 215
+mov L110, L51
+red *r3
+bne L103
+mov r2, r2
+L105: .string "ppubvjminupmoboksixjh"
+L106: .data 534, 559, -729, 897, -744, 194
+rts
+cmp #155, r3
+L107: dec *r1
+stop
+dec L157
+sub #83, r1
+cmp *r7, r1
+cmp r7, L81
+lea L51, L165
+bne L5
+lea L203, r4
+; comment
+L108: jsr L125
+; comment
+clr r6
+dec L63
+cmp L88, *r6
+dec r3
+L109: jsr *r5
+stop
+lea L49, *r0
+bne *r2
+add L188, r4
+inc r6
+L110: mov L108, L83
+inc r1
+mov #137, *r0
+rts
+cmp #67, #99
+jsr L215
+L111: sub *r7, *r6
+bne *r2
+bne *r5
+sub L197, L260
+L112: rts
+L113: stop
+jmp *r4
+clr r5
+prn r4
+stop
+inc *r7
+sub L102, L34
+not r3
+not *r4
+L114: stop
+; comment
+prn *r2
+L115: .string "j"
+dec *r7
+jmp *r6
+; comment
+cmp r6, L174
+jmp L192
+L116: .data -421, 952
+add *r0, L139
+jmp *r7
+not *r2
+L117: bne *r5
+dec *r5
+stop
+lea L228, r1
+lea L204, *r1
+add #-254, r7
+prn L224
+inc L140
+jmp *r1
+mov *r4, *r3
+L118: .string "byfewtjga"
+prn L82
+sub r3, L264
+L119: add #6, r6
+L120: bne L20
+dec r0
+clr L173
+jmp *r2
+clr r4
+red *r6
+add *r6, L150
+
+stop
+L121: .string "ctzgfnnmlsmdbqf"
+mov r7, *r6
+jsr L257
+mov L34, *r2
+
+L122: .data -417, 783, 637, -828, -214, 890
+L123: not r3
+clr r6
+cmp *r1, #-225
+rts
+add #220, *r3
+jmp *r7
+sub #1, r3
+prn *r4
+dec r1
+not *r7
+red L195
+rts
+jsr *r2
+L124: sub L138, L197
+jmp *r0
+add L95, r2
+inc L250
+jsr *r6
+inc r0
+L125: .data -667, -672, 815, 972, -884, 496
+dec L174
+L126: .string "fwgroyapmonfzbbdirhprcmw"
+jmp *r1
+L127: .data 157, -181, -545, 215
+lea L114, L90
+bne *r6
+lea L244, L158
+L128: rts
+not *r2
+rts
+L129: sub *r3, L249
+L130: .string "cfyzjuvlvnvmrmzryyagsbg"
+cmp L252, #244
+stop
+L131: rts
+L132: .data 385, -589, -804, 948
+L133: sub #209, L28
+L134: .string "l"
+lea L47, r1
+stop
+dec r2
+L135: rts
+L136: .string "fdugyoiejzrpiti"
+stop
+L137: sub *r6, *r7
+inc *r2
+L138: .string "koflcpsifiynecfohqjuhy"
+L139: dec L209
+L140: cmp L73, *r5
+L141: stop
+red *r3
+jsr *r7
+L142: not *r0
+inc r1
+add *r6, L260
+add #25, L121
+red L14
+sub r1, r2
+lea L245, L47
+bne *r4
+sub r7, r2
+bne *r1
+rts
+bne *r3
+lea L100, L174
+L143: sub L95, *r3
+bne *r5
+L144: mov r3, L112
+rts
+lea L24, *r2
+clr r7
+L145: stop
+stop
+red r6
+rts
+prn L130
+stop
+jmp *r4
+dec *r7
+not r3
+stop
+mov r6, *r3
+bne L28
+mov #-120, r1
+stop
+cmp L258, r5
+L146: mov L62, r1
+L147: .data 427, 911, 729, 933, 876, -975
+add *r7, r4
+L148: .data -143, -845
+rts
+L149: jsr *r4
+red *r2
+cmp *r6, L64
+jmp L72
+L150: mov #196, *r0
+L151: .data -555, -248, 653
+add L249, L233
+rts
+lea L155, *r2
+L152: .data -939, 276, 375, 568, -639
+stop
+cmp L134, r3
+L153: inc L249
+prn L177
+inc L240
+inc L168
+add *r4, *r4
+
+; comment
+L154: prn *r7
+rts
+lea L243, *r6
+mov r3, r6
+dec *r3
+L155: lea L254, *r2
+
+prn *r4
+L156: .data -783, -947, -70, -409, 722
+L157: stop
+mov #19, L202
+L158: .data -188, -574, -42, 735
+mov *r4, L158
+sub *r6, *r2
+stop
+bne L66
+dec L241
+jsr *r4
+not r7
+dec r7
+L159: cmp #-51, L208
+inc *r0
+red r4
+clr L73
+red r2
+clr r7
+cmp r1, L191
+L160: jsr *r4
+not L130
+cmp #193, r4
+clr L158
+L161: stop
+L162: .data -827
+cmp #138, *r5
+L163: .data 611, 530, -200, -595, -487, -711
+clr L177
+not L50
+mov r7, r1
+red *r0
+jmp L210
+cmp L260, #-189
+L164: bne *r5
+dec L62
+L165: not L57
+bne L235
+inc L214
+red r6
+add *r4, *r2
+sub L79, L185
+L166: prn *r6
+L167: prn #-235
+stop
+L168: dec r0
+jmp *r2
+clr L51
+clr *r2
+clr *r6
+red L261
+not r7
+red L11
+dec *r5
+L169: sub *r6, *r1
+not r0
+sub r7, *r7
+L170: not r6
+L171: dec *r1
+L172: .string "ivpjmfxpvgsjqlkaybrtevkq"
+; comment
+L173: .string "ktulxhlchhovfbcjswpldvu"
+L174: not *r4
+mov *r0, *r0
+mov r2, L257
+cmp *r5, #-189
+inc L175
+stop
+jmp *r4
+not L256
+rts
+
+jmp *r2
+L175: not *r4
+add #-6, *r0
+not *r3
+add r4, L214
+L176: dec r0
+L177: cmp L133, r0
+inc r2
+jsr L209
+L178: prn *r2
+stop
+rts
+clr *r2
+clr L203
+stop
+jmp *r6
+; comment
+
+red r6
+L179: .string "thagqnec"
+stop
+sub r6, *r5
+L180: clr r1
+sub #-164, L257
+add #184, L241
+jmp *r6
+add r3, L199
+add L192, r7
+lea L227, r0
+lea L246, *r6
+inc *r5
+; comment
+rts
+lea L214, *r3
+lea L13, r1
+L181: .string "nxeg"
+L182: cmp *r2, r3
+L183: .string "xlbjitlnelzwstf"
+jsr *r6
+stop
+stop
+dec r4
+bne L58
+inc L122
+bne *r5
+
+cmp *r5, L163
+L184: stop
+cmp *r5, *r0
+L185: .string "np"
+bne *r2
+lea L228, L173
+stop
+
+add *r1, r5
+inc r1
+not L3
+L186: .data -745, -968, 484, -785, -748, 468
+bne *r3
+jsr L229
+L187: mov #-28, r0
+not r4
+red r6
+rts
+L188: clr r6
+red *r5
+red L151
+L189: inc *r2
+L190: stop
+jmp *r1
+not r4
+inc r6
+add L149, r0
+L191: .data -643, -643, 219, 491, 429, -431, -66, -279
+mov r4, r5
+mov L210, *r2
+bne L225
+L192: .data 938, 770, 289, 466, 745, -726, 883, -619
+sub *r3, L198
+bne L153
+red L201
+mov r1, r3
+L193: inc *r2
+not L232
+inc r3
+prn L196
+clr L157
+cmp r4, #213
+mov L80, *r3
+mov #35, *r5
+rts
+stop
+add #-165, L227
+L194: .string "nwmnirvttxwmobed"
+L195: .data 683, -488
+bne *r4
+L196: dec L119
+
+not r5
+jmp *r3
+L197: prn *r0
+clr L223
+mov *r7, r1
+stop
+rts
+inc r0
+rts
+L198: rts
+rts
+dec *r7
+L199: lea L133, r0
+L200: prn L0
+rts
+not r3
+lea L152, L173
+stop
+mov L254, *r6
+L201: .string "krilvbghequx"
+lea L113, r6
+jsr L173
+L202: prn L254
+L203: red L240
+not r4
+red *r5
+lea L197, *r2
+L204: dec L36
+sub *r5, r4
+lea L10, L213
+clr r2
+L205: sub r6, *r7
+L206: jmp *r4
+sub *r3, *r4
+L207: lea L220, r0
+L208: jmp L224
+prn #216
+lea L62, *r7
+stop
+L209: .string "cvugtztx"
+L210: add L100, L142
+L211: not L2
+L212: cmp L164, *r6
+stop
+inc *r4
+not *r2
+not *r0
+L213: add L97, L223
+prn L227
+L214: clr L236
+L215: red *r6
+clr r0
+L216: .string "pkpyyhewafeuvpjv"
+L217: .string "lmiycnwsicueczpkymr"
+inc *r1
+dec L10
+lea L246, L254
+prn r4
+; comment
+red r6
+L218: .data 701, 877, -277, 543, -308, 68
+L219: add r3, L223
+L220: not L225
+stop
+L221: dec *r1
+
+L222: mov L46, *r2
+bne *r6
+cmp L251, L244
+inc L92
+L223: lea L203, L178
+clr *r7
+
+sub r7, *r3
+clr r7
+dec L49
+bne L224
+cmp r4, r5
+dec *r7
+sub #-47, L241
+stop
+lea L92, *r1
+; comment
+L224: .string "bgvdaob"
+mov L181, *r6
+stop
+L225: rts
+
+L226: bne L252
+stop
+jsr L260
+clr r6
+add r6, r4
+L227: sub L43, r7
+prn L22
+dec L260
+sub #61, *r3
+L228: .data -994, -653, -940
+prn *r4
+add *r4, *r2
+mov #-16, r3
+jmp *r7
+
+jmp L83
+mov r3, *r1
+cmp *r5, L170
+mov #183, L259
+cmp #56, #-115
+stop
+L229: .string "ibhpmyqs"
+bne L249
+L230: .string "udvah"
+sub #-20, *r3
+clr r2
+L231: rts
+red L242
+sub r7, *r0
+not r7
+
+lea L242, L236
+bne L241
+jmp L242
+bne *r7
+; comment
+mov L110, r1
+L232: .data -163, -514, 683, -108, 563, 255, 633, -844
+rts
+clr *r0
+jsr *r2
+L233: lea L210, *r7
+L234: clr L221
+L235: jsr L123
+cmp r1, *r0
+cmp *r7, #-60
+mov *r1, *r2
+L236: clr *r7
+lea L239, r2
+inc L119
+L237: stop
+add *r2, *r6
+cmp r3, *r6
+bne *r5
+L238: .data -295, -268, -830, 903, -507, -108, -821, -196
+jsr *r3
+jmp *r3
+bne L261
+sub #-245, *r6
+stop
+L239: .string "ltyolfyoxtkoxyo"
+dec r7
+clr *r1
+dec *r4
+bne L201
+bne L42
+rts
+L240: dec r5
+L241: sub #-6, L244
+L242: .string "hxozjasmkirxhxaoseigcav"
+not *r4
+L243: clr r3
+dec r3
+
+clr L149
+lea L264, r1
+sub #-213, L194
+L244: lea L256, L131
+L245: red L263
+not *r2
+clr L249
+L246: red *r3
+L247: sub #-90, L264
+cmp #94, L256
+stop
+lea L73, r4
+L248: .string "ybykfxsfzid"
+cmp r5, r3
+L249: .data 203, 230, 509, -73
+red *r4
+L250: .string "tibuyi"
+inc L261
+dec r1
+jsr *r2
+inc *r1
+sub r2, *r4
+not *r3
+jmp *r4
+L251: inc r1
+add #-161, *r4
+L252: .data -495, -549, -876, -473, -300
+stop
+L253: sub *r6, L262
+jmp L208
+dec r2
+sub L260, *r1
+clr r3
+cmp L259, L264
+L254: dec *r4
+L255: .data 85
+L256: .data -975, 282, -378, 836, -762
+red L11
+jsr *r1
+L257: mov L261, *r0
+mov #-93, L107
+L258: not *r3
+not r1
+stop
+sub r6, *r5
+lea L183, r7
+prn #33
+dec *r4
+not r3
+L259: stop
+L260: .data 623, -56, -93, 444, -125
+jsr *r1
+not r4
+sub L160, L22
+bne *r7
+L261: cmp *r2, *r4
+prn *r7
+jsr L263
+sub L264, *r5
+cmp *r3, #-241
+stop
+jsr *r7
+sub r1, *r7
+not r1
+cmp L262, #-208
+L262: red L200
+red r7
+L263: .data 902, 433, 837, 779, 762, -871, 135
+clr *r4
+L264: sub *r0, *r3
+stop
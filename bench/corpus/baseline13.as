@@ -0,0 +1,1019 @@
+; Generated by genCorpus --seed 14
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+L0: .string "ducuteouhubpwpnfehacyqca"
+L1: .data 197, -751, -784, -934, 484, 337, 466, -354
+L2: .data 705
+jsr *r1
+prn *r3
+jsr *r6
+red *r1
+cmp #-74, r7
+rts
+
+L3: mov #-38, r5
+dec *r0
+stop
+cmp r3, *r7
+stop
+lea L256, *r7
+cmp *r0, #135
+inc *r0
+L4: jsr *r6
+add r7, L31
+add r1, r5
+inc L98
+bne L37
+jmp L170
+
+jmp L0
+L5: jmp *r5
+sub r2, L1
+; comment
+add #7, r6
+stop
+dec r6
+add r5, r6
+rts
+dec r3
+not L46
+not *r2
+mov r0, r5
+not L4
+L6: .data -799, -702, -797
+L7: .string "dnpge"
+L8: prn *r6
+L9: bne *r2
+prn #-131
+L10: jsr L5
+jsr *r0
+L11: not *r2
+inc r4
+jsr *r1
+cmp #-199, r6
+L12: .string "baquvmkybeuehrsqmxk"
+jmp *r4
+rts
+bne L68
+lea L1, L2
+lea L2, r6
+clr L8
+; comment
+prn *r2
+inc *r6
+
+lea L74, *r3
+stop
+bne *r2
+not r0
+inc *r0
+red L6
+stop
+L13: .data 624, -480, 747, 334, -107, 366, 65, 460
+stop
+
+stop
+
+L14: mov *r0, *r7
+bne L49
+mov r7, r0
+stop
+cmp r6, #-87
+L15: .data -458, 493, 405, 769, 961, 76, 526, -853
+L16: add r1, r0
+clr r0
+bne *r5
+sub L161, r7
+jsr *r6
+cmp r3, L4
+L17: not *r7
+L18: .data -5, 751, 194, -140, -655, 370, -829
+L19: .string "ehfwknliqoos"
+rts
+jsr *r2
+clr L14
+cmp r0, #-202
+L20: .string "xpbvthdwbvdwlqnsksdyx"
+jsr *r6
+inc L59
+bne *r1
+clr r4
+inc *r4
+lea L2, *r7
+dec *r7
+dec *r4
+L21: add r2, *r0
+rts
+lea L198, *r5
+mov L9, L94
+L22: bne L13
+clr *r3
+lea L13, *r3
+L23: sub *r0, r7
+L24: mov L7, r6
+not L18
+red L102
+L25: jsr L266
+jmp *r0
+L26: .string "xklo"
+inc r1
+L27: stop
+L28: .data 617, 733, 751
+cmp r5, #132
+cmp L20, #19
+jsr *r5
+jsr *r4
+L29: bne L239
+red r4
+
+lea L215, r6
+L30: sub *r5, L3
+
+L31: .string "glffgjpqmqxazstfahpevlu"
+jmp L28
+L32: clr r5
+L33: dec *r7
+L34: prn L17
+L35: clr r1
+bne *r1
+rts
+jmp L255
+mov #-189, *r3
+jmp L8
+lea L14, L5
+cmp r5, L187
+mov r7, r6
+cmp *r1, #67
+sub r0, *r0
+mov L92, r5
+not *r4
+stop
+add r3, L224
+L36: prn *r0
+L37: .string "dweqchhyzbfqavb"
+prn r4
+lea L25, r3
+inc *r3
+jmp *r3
+inc *r0
+L38: inc L182
+dec *r5
+jmp L56
+add *r0, *r6
+clr r0
+red *r7
+stop
+
+jsr L151
+L39: inc L11
+jmp *r1
+L40: clr r2
+L41: not r5
+L42: bne L4
+jsr *r3
+dec *r3
+not L153
+sub *r2, L1
+L43: jsr L10
+inc r2
+prn *r7
+inc *r4
+L44: .string "lnsvzsczl"
+L45: mov *r4, r2
+red r5
+clr r0
+bne *r0
+not r5
+L46: inc L172
+inc *r4
+prn #40
+mov *r7, L9
+inc L37
+inc r5
+L47: .data -409, 415, 880, 12, 24
+red L43
+L48: sub L265, L33
+jsr *r7
+dec L72
+L49: .string "ymefbebmxpkaljfsyle"
+L50: inc *r5
+jsr *r7
+stop
+bne *r5
+; comment
+L51: jsr *r6
+L52: clr r0
+
+not L104
+L53: .string "opa"
+dec *r7
+lea L35, r4
+dec r1
+L54: .data 583
+L55: rts
+red r5
+not r2
+jmp L78
+L56: red r6
+jmp *r7
+mov L51, *r5
+not *r0
+sub #-250, r5
+lea L29, r5
+L57: cmp *r2, r2
+dec L254
+add *r0, L69
+add #55, r3
+inc L1
+inc L183
+not L172
+rts
+L58: jmp L262
+L59: add *r4, L247
+L60: .string "zsfbgnrtipoernfhopc"
+lea L51, *r2
+jsr *r6
+add L101, L115
+not L67
+red r7
+L61: dec *r0
+cmp *r1, r5
+L62: .string "xdacqox"
+cmp #176, L244
+prn L43
+L63: .data 218, -574, 25, -870, -496, -584, -232, 862
+sub *r6, r6
+L64: cmp L34, L56
+red r1
+L65: inc L10
+add *r6, L49
+red L29
+; comment
+add r0, *r7
+L66: .data -996
+red *r5
+clr r5
+stop
+prn #-234
+; comment
+lea L176, r1
+dec r3
+L67: sub #-57, *r5
+not *r1
+L68: jmp L91
+cmp *r0, r7
+inc L17
+inc r4
+L69: clr *r2
+cmp L80, *r5
+sub L158, r4
+stop
+red *r0
+add *r3, r3
+L70: jsr L253
+mov *r6, L208
+mov *r5, r7
+dec L30
+jmp *r1
+dec L24
+cmp L5, #-220
+sub *r6, r3
+stop
+; comment
+L71: mov r2, L151
+L72: lea L38, L178
+stop
+clr L7
+dec L54
+add L208, *r5
+; comment
+rts
+L73: lea L231, *r2
+clr L65
+mov *r7, L170
+L74: add r2, L43
+inc *r3
+L75: rts
+; comment
+red *r0
+lea L4, L31
+L76: .string "dgdzlrwd"
+dec L205
+cmp *r4, *r1
+red *r3
+; comment
+L77: inc L98
+L78: cmp *r7, #-197
+L79: lea L243, r0
+mov L53, *r2
+L80: sub r7, *r7
+L81: .string "irmmkpbvfrekgaafdcnv"
+mov r1, L154
+L82: .string "wbyauufvzwpacqdz"
+prn #141
+red r0
+mov *r6, r0
+
+prn #216
+L83: .string "vvwrfpxgosriteimeknvpwl"
+stop
+L84: bne L174
+mov *r2, *r7
+rts
+dec r4
+L85: .string "wflajwztvdgnvr"
+cmp *r2, #-186
+L86: lea L17, r3
+L87: .data -346
+mov *r6, L54
+not L36
+sub L237, r1
+not L63
+L88: dec *r6
+inc r5
+L89: .data 565, -857, -832, 33, -619, -162, -108
+mov L24, r7
+bne L49
+sub *r4, r4
+L90: sub L1, *r1
+add L47, *r6
+L91: .data 694, 572, 747, 680, 732, 977, 109, 345
+L92: stop
+rts
+jmp *r4
+L93: .string "dtmysxczslxeft"
+inc L48
+dec *r1
+stop
+L94: .string "cbvaytt"
+lea L43, *r1
+bne *r5
+stop
+rts
+red r5
+cmp *r1, r3
+not L38
+inc *r5
+; comment
+L95: .data -711, -461, 222, 395, -563, -881, 185, -562
+clr L86
+stop
+not *r3
+sub #-243, L127
+not L147
+L96: jmp *r4
+L97: .string "xtraqw"
+L98: sub r3, r0
+mov #-66, r5
+add #-155, r2
+sub r1, L5
+L99: inc r3
+clr *r2
+sub *r6, *r5
+inc r2
+jmp *r7
+prn *r4
+L100: .string "ypxxsazrfaqnzwhznrxvlbbu"
+not *r1
+L101: cmp *r7, L124
+L102: clr r5
+not r5
+lea L6, *r6
+lea L219, r1
+jsr *r5
+jmp L39
+bne L203
+clr *r7
+bne *r2
+L103: .string "vvmvnqdacdttkbngp"
+jmp L26
+L104: sub r5, *r5
+red r1
+L105: .data 788
+lea L65, r1
+L106: stop
+L107: jsr L146
+jsr L147
+add #-256, L205
+jsr *r6
+lea L192, r7
+L108: sub r5, *r4
+L109: inc r7
+jmp *r2
+L110: red r7
+red *r1
+lea L17, L154
+jsr L185
+jmp L269
+sub #-48, r4
+clr L256
+jsr *r1
+jsr *r6
+L111: add r3, L109
+L112: cmp #-11, #-25
+L113: rts
+L114: lea L98, *r1
+sub *r6, L16
+
+jsr L34
+dec *r6
+prn L152
+clr r6
+inc *r5
+L115: lea L233, r6
+not *r6
+
+inc L242
+L116: rts
+mov #153, r0
+lea L34, r4
+dec L228
+cmp L82, r0
+cmp L104, L140
+dec L46
+jsr *r0
+stop
+L117: red *r7
+inc L19
+stop
+add L98, r2
+L118: mov L6, *r0
+bne *r6
+prn r1
+sub r0, L76
+sub *r4, *r4
+dec *r3
+L119: .string "vvldzlilmszfk"
+L120: lea L33, L43
+sub L260, *r1
+jmp *r2
+jsr L132
+clr r2
+L121: clr *r2
+sub L106, L152
+bne L61
+jmp L205
+sub #170, r5
+stop
+not *r2
+clr r3
+stop
+mov #244, L34
+lea L213, L176
+rts
+clr r4
+L122: .data -982, 122, 684, -340, -817, 471, -4, 227
+stop
+jmp *r6
+prn L107
+; comment
+L123: clr *r1
+cmp r7, r1
+stop
+jmp *r3
+sub #-5, *r0
+cmp L10, L119
+stop
+prn #0
+bne L150
+L124: .string "mdojemjymesx"
+red L137
+prn #-203
+prn L104
+sub *r1, *r1
+jsr *r3
+L125: .data 26, 167, 863, -772, -663, -797, 964, 558
+clr L105
+L126: red r6
+rts
+sub *r1, *r5
+not *r7
+not *r7
+mov *r7, r4
+L127: .data -16, -895, -82, 767, 818
+mov L192, L201
+cmp *r7, L65
+cmp #-210, *r1
+L128: red r6
+L129: .string "ximhpncpck"
+sub #11, r6
+bne *r0
+jsr *r0
+cmp L31, L244
+jsr L82
+bne *r6
+mov r2, r5
+; comment
+rts
+dec *r3
+L130: cmp *r0, r7
+L131: mov L128, *r7
+jmp *r2
+jsr *r1
+L132: .string "ownuxvbypklgpucvkp"
+red r0
+prn r3
+jsr L224
+add #-142, *r6
+rts
+jmp L102
+L133: cmp *r0, #102
+jmp *r0
+inc *r2
+jmp *r3
+L134: bne L72
+not r5
+L135: .data 237, -877, 622
+prn L34
+prn L136
+
+add *r4, *r2
+L136: .string "vjlh"
+lea L102, r1
+jsr L24
+bne L86
+jsr *r2
+clr L185
+mov L51, r7
+L137: .data -669, -2, -239, 416
+cmp L47, #43
+jmp L201
+L138: stop
+bne L150
+mov #247, r3
+jsr L122
+L139: inc *r5
+
+jmp L224
+L140: clr r5
+L141: lea L178, *r6
+stop
+not r4
+jsr *r6
+stop
+jmp L242
+
+sub #40, r6
+red *r2
+L142: mov L27, L73
+clr r0
+jsr L125
+bne *r6
+L143: .string "s"
+dec *r2
+; comment
+stop
+dec r3
+dec r0
+dec r7
+dec *r4
+L144: jsr L16
+rts
+jsr L90
+prn r7
+L145: prn #208
+clr L113
+mov r0, *r6
+red *r0
+bne L99
+L146: .string "bcf"
+; comment
+lea L106, L0
+L147: mov *r6, *r3
+red L47
+jsr L264
+L148: clr r0
+L149: add *r1, L22
+clr r4
+clr *r0
+L150: lea L164, *r5
+L151: .data -25, -981, 7, 582, -389
+L152: add *r3, *r1
+red r4
+mov #-51, r7
+jsr *r5
+stop
+L153: mov *r0, L198
+L154: cmp *r4, #-166
+sub #-75, L175
+L155: sub *r3, L50
+; comment
+L156: dec L179
+clr L247
+sub *r1, *r2
+red L245
+rts
+L157: prn *r1
+jsr L96
+cmp r5, #69
+cmp r1, L48
+jsr *r0
+add L18, r6
+dec *r2
+rts
+sub L61, *r4
+mov #-240, r6
+jmp L2
+L158: sub L1, *r6
+L159: add #-166, L191
+inc *r4
+L160: .string "zlkrogvsqlspcuug"
+prn #-62
+L161: stop
+mov r5, *r2
+stop
+; comment
+L162: sub r5, L93
+L163: .string "sqfhwsrzwxv"
+jsr *r1
+L164: .string "frvffhtnizwvwqvorsrfc"
+L165: bne *r7
+inc L164
+L166: .data -323, -689, -140, 116, -854, 524, 953, -532
+mov L256, r7
+L167: prn #48
+bne L232
+red L243
+stop
+L168: cmp *r4, *r1
+L169: cmp r3, #164
+L170: prn #201
+L171: rts
+dec r4
+L172: .data -379, -438
+; comment
+L173: jsr *r0
+; comment
+jmp L114
+not *r7
+dec r2
+bne *r6
+L174: dec L105
+prn *r1
+; comment
+add *r3, *r3
+L175: .data 697, -975, 439, -931, 939, 429, 964, 480
+L176: mov L200, *r5
+dec *r7
+L177: .string "b"
+clr *r2
+cmp *r1, *r1
+red *r7
+L178: inc L44
+stop
+rts
+L179: .string "wbtrf"
+dec L214
+L180: prn #-147
+clr *r5
+not r2
+L181: .string "jkhaxwnvzksq"
+bne *r6
+; comment
+rts
+cmp #-242, r2
+stop
+L182: add #75, r5
+jsr *r1
+L183: .string "evxewivg"
+mov *r1, L221
+L184: mov *r4, *r2
+not L246
+L185: red *r3
+
+not r6
+not *r4
+prn #-125
+dec L218
+inc L209
+red L222
+bne *r4
+inc r6
+red L256
+L186: red r1
+dec r0
+jmp L15
+sub #211, r1
+red *r2
+not L237
+not L110
+red r1
+not L184
+not L258
+clr L225
+add *r2, L251
+L187: .data 204, 269, -647
+rts
+not L75
+sub *r1, r7
+inc *r0
+jsr *r1
+L188: jmp L8
+rts
+jmp *r2
+L189: jsr L203
+lea L19, r0
+rts
+red r0
+L190: .data 652, -180, -275, -719
+clr *r6
+clr r6
+red L55
+inc *r6
+L191: .data -523, 152
+lea L188, *r0
+mov L230, L133
+L192: .string "rronymk"
+inc *r5
+jsr L36
+L193: bne L240
+mov L244, r6
+bne L234
+stop
+jsr L171
+L194: jmp L253
+mov L128, *r5
+L195: .data 228, 964, 309, -756, -285
+jmp *r0
+inc *r1
+cmp *r6, r4
+jmp L221
+sub #-22, *r4
+dec L218
+cmp r2, L125
+jmp L137
+L196: cmp *r4, r7
+L197: jmp L57
+mov r2, L131
+stop
+sub #-128, L248
+bne *r2
+lea L4, *r0
+clr r4
+jmp L214
+stop
+jmp L137
+red *r5
+L198: jmp L224
+mov *r5, L102
+jmp L255
+bne *r1
+red L135
+L199: cmp #188, r5
+L200: sub #-107, r5
+dec *r0
+jmp *r1
+; comment
+inc *r4
+L201: cmp #-30, *r0
+add *r3, *r2
+sub r3, *r2
+sub L31, L207
+L202: add *r6, *r2
+add #-222, *r4
+cmp L186, #-190
+bne L248
+L203: jmp L36
+inc r1
+L204: jmp *r3
+dec L42
+not r2
+lea L11, r5
+L205: bne L208
+cmp *r6, L264
+sub *r0, r7
+sub L224, *r3
+clr L253
+L206: prn #232
+L207: .data -407, 458, -104, -269, 954
+L208: jmp L52
+; comment
+sub #-31, *r7
+jsr *r4
+red *r7
+L209: cmp r4, #169
+L210: .string "cmlydhsqzovyqfpcqqmiihz"
+sub r6, r0
+inc L160
+lea L137, r5
+jmp *r7
+stop
+stop
+
+not *r5
+jmp *r3
+prn #-38
+jmp *r1
+L211: not L220
+mov #-92, L231
+prn r3
+dec r6
+rts
+sub r5, L128
+stop
+L212: add L220, *r6
+L213: jsr *r4
+L214: lea L94, *r6
+jsr *r5
+sub #231, L52
+lea L133, r5
+prn *r0
+red L96
+mov r4, *r4
+add *r1, L261
+lea L49, L173
+stop
+L215: prn *r2
+sub #-103, *r6
+L216: .string "nufobwdwfkbu"
+not r0
+lea L123, r5
+stop
+jmp L219
+stop
+not *r4
+not *r5
+lea L122, L224
+jsr L46
+lea L232, *r2
+prn L196
+L217: .string "vjnov"
+L218: cmp r0, r0
+dec L248
+mov r7, r1
+inc r7
+jmp L69
+jsr L265
+mov *r3, L55
+jsr L183
+dec *r3
+stop
+not L42
+; comment
+not *r0
+not *r6
+L219: not L235
+L220: .data 107, -626, 675, 937
+inc L227
+L221: rts
+lea L125, L264
+jsr L247
+clr L237
+L222: sub L249, *r6
+inc *r5
+jsr *r2
+jmp L255
+L223: prn #-49
+L224: stop
+mov #-20, r3
+L225: jmp *r3
+cmp r0, #-222
+L226: add L4, r2
+L227: mov r5, *r4
+jmp L162
+L228: .string "sphumxecwparecuek"
+jsr L172
+add r6, r2
+L229: jsr L260
+L230: cmp L258, L217
+lea L26, *r3
+L231: stop
+L232: cmp #-225, #14
+add *r5, r4
+inc r3
+dec L111
+; comment
+mov *r5, r2
+lea L235, L152
+L233: .data -74, -197, 585, -264
+L234: sub L90, *r0
+L235: lea L22, r2
+L236: dec L147
+inc L45
+prn #-161
+rts
+cmp *r3, r1
+inc L189
+add r1, r2
+bne L249
+L237: .string "ledzusdwuhhdn"
+L238: lea L242, r1
+L239: .data -325, -1000, -175
+add r7, L64
+sub r7, *r1
+prn r1
+jsr L258
+jsr L41
+L240: .data -698, 146
+rts
+add *r7, *r3
+inc r6
+jmp *r0
+not r2
+lea L144, *r3
+add #67, r5
+cmp L269, r0
+stop
+red L260
+L241: stop
+L242: lea L265, r5
+L243: add #-97, r4
+lea L255, *r6
+red *r0
+L244: red L78
+L245: .string "uhuozvillnvauwbztqjvtzc"
+dec L119
+dec *r5
+rts
+stop
+L246: clr r5
+jmp L158
+bne *r5
+L247: .string "jax"
+lea L256, *r6
+L248: .data 441, -104, 476, -359, -288, 221
+prn *r0
+not r3
+
+inc *r6
+L249: .data -434
+stop
+L250: dec L40
+stop
+L251: stop
+stop
+add L265, *r4
+add *r1, r6
+L252: .string "yqsuazguqabwmvc"
+L253: inc L257
+sub *r4, r4
+cmp *r6, *r2
+bne *r6
+cmp L15, *r4
+rts
+jmp *r0
+L254: prn #242
+mov r6, r4
+L255: rts
+lea L189, L263
+add #-137, r6
+L256: clr r6
+inc *r0
+mov #-36, r1
+cmp L163, r1
+inc r0
+rts
+stop
+L257: .string "rysesylxspndretdxr"
+L258: clr L150
+prn #-111
+L259: stop
+L260: rts
+; comment
+L261: not r6
+L262: mov *r4, r0
+add r0, L132
+jsr *r3
+rts
+cmp r3, *r3
+dec r6
+L263: mov *r1, L226
+dec r6
+add #226, L266
+L264: .string "eicpgcmwfusnan"
+add L267, L266
+prn *r0
+add *r1, r3
+
+lea L112, L267
+prn L217
+stop
+inc L269
+jmp *r7
+red *r6
+jsr L265
+mov #174, r6
+L265: not *r7
+L266: dec L269
+L267: .data 348, 873, -255
+rts
+L268: jsr L188
+L269: rts
+red L28
+not r2
+stop
@@ -0,0 +1,1019 @@
+; Generated by genCorpus --seed 15
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+jmp *r4
+add r0, *r7
+clr r0
+bne L131
+L0: stop
+clr L0
+prn r0
+clr L169
+L1: jsr L0
+add #-151, *r3
+mov r6, r4
+L2: mov #76, *r6
+L3: red r2
+L4: .string "c"
+prn *r2
+rts
+; comment
+L5: inc r3
+cmp L243, *r3
+not *r4
+not L62
+L6: .string "sxafcuiyqjsnkytsuippnre"
+L7: .string "gegvhyyynvkafxs"
+add r1, r6
+lea L3, *r0
+L8: bne L6
+mov *r3, *r3
+L9: add *r5, r1
+red L0
+inc *r5
+stop
+jsr L88
+L10: .string "afhncajvknnrhtbvipcfusin"
+lea L190, *r6
+clr L102
+sub L132, L7
+mov L172, L4
+not r0
+L11: .string "gum"
+sub L142, r4
+jmp L14
+L12: .string "ajekiragmciluhzrxicmuhv"
+L13: jsr *r7
+cmp L7, L1
+stop
+stop
+lea L180, *r5
+sub #-178, L246
+bne L25
+inc r0
+clr *r1
+jmp L11
+L14: red *r7
+; comment
+L15: mov *r5, L12
+lea L160, L8
+clr r6
+L16: prn *r7
+; comment
+stop
+bne *r1
+; comment
+stop
+mov L160, *r0
+L17: cmp #-242, *r5
+cmp #235, L17
+prn *r5
+stop
+red r6
+L18: not *r1
+cmp r2, r2
+L19: inc L216
+L20: dec r5
+not r0
+L21: dec L14
+sub *r4, r7
+mov r7, *r6
+stop
+add r3, *r0
+bne *r1
+jmp *r7
+L22: .string "pe"
+dec *r7
+L23: clr r7
+L24: .string "oxnvyw"
+red r0
+prn r7
+L25: rts
+L26: jmp L46
+not L1
+clr r4
+L27: .string "vgeks"
+; comment
+stop
+inc r3
+not L86
+lea L7, L111
+inc r1
+stop
+L28: rts
+L29: bne *r4
+red *r1
+lea L239, L71
+prn r5
+rts
+red *r2
+jsr L145
+red L14
+lea L5, *r4
+jsr L18
+red *r0
+clr *r3
+L30: prn L74
+clr *r1
+L31: inc L18
+jsr *r4
+
+stop
+L32: .data -858, 744
+
+rts
+L33: .string "lfp"
+dec L22
+dec r1
+cmp *r4, r6
+
+stop
+bne *r0
+stop
+inc r4
+L34: dec *r7
+cmp #-214, *r6
+jsr L231
+L35: .data -378
+L36: .data 820
+stop
+jmp *r7
+lea L15, r1
+sub #129, L12
+clr r4
+L37: .data -42, 839
+L38: lea L183, *r6
+bne *r5
+add r4, L33
+add *r4, *r1
+dec r4
+L39: jsr *r5
+L40: rts
+red L160
+stop
+lea L16, *r3
+not r0
+dec r6
+add L101, L214
+mov *r2, r4
+clr r7
+
+sub #196, L6
+L41: dec *r2
+sub #-136, r0
+clr L4
+red *r0
+L42: .string "rqdyvwlnykaqxzg"
+clr r5
+L43: .data -245, -470, -452, 324
+bne *r4
+bne *r3
+dec r0
+stop
+cmp r6, r1
+clr *r1
+L44: .data -546, 54, 555, -255, 89
+rts
+jmp L65
+inc r4
+jmp L139
+red r1
+jmp L23
+jsr L220
+jmp *r5
+; comment
+L45: cmp L117, *r0
+cmp r7, *r7
+lea L229, *r7
+red L15
+stop
+inc *r2
+cmp #-3, r0
+mov *r4, r6
+L46: .string "bmkhzoovetip"
+rts
+dec L57
+not r1
+prn L181
+not L8
+mov #107, *r2
+L47: sub #180, r0
+L48: .string "sfjxofxakhshob"
+; comment
+red r4
+mov r1, r3
+L49: jsr *r3
+inc r2
+jmp L169
+L50: .string "txdnsixwntrfdnsbkfw"
+L51: .data -635, -831, 302, 11, 244, -561, -92, 328
+prn #-167
+rts
+clr r6
+not r3
+stop
+dec r0
+sub L33, L129
+L52: prn #128
+inc r1
+clr r7
+red r3
+add *r3, L105
+L53: dec *r7
+L54: red *r5
+not r0
+L55: jmp L61
+sub *r4, r4
+lea L55, r7
+red *r7
+L56: .data -988, -930, -967, -288, 748, 161, -141, 582
+L57: .string "beutrizaaactgomc"
+L58: lea L55, *r3
+dec *r5
+L59: bne *r6
+prn #-10
+stop
+L60: cmp r2, *r1
+sub *r5, *r2
+bne *r4
+L61: stop
+jsr *r2
+prn r2
+L62: add r5, L216
+rts
+cmp r0, r7
+jsr L25
+clr r3
+lea L29, r4
+rts
+cmp r0, L0
+; comment
+not L57
+clr *r2
+L63: clr L11
+bne *r0
+stop
+sub #-54, *r3
+add *r5, L15
+jmp L166
+red r3
+mov L75, r2
+inc L204
+rts
+jmp *r0
+rts
+bne *r3
+rts
+L64: dec L41
+not r4
+clr r2
+L65: cmp *r0, #139
+not L226
+L66: clr *r2
+L67: .data 309, -944, 254
+stop
+; comment
+L68: .data -775, -77, -992
+prn *r3
+L69: prn *r6
+rts
+L70: prn L129
+jmp *r6
+L71: add #-130, r5
+jsr *r2
+rts
+red r1
+jmp *r7
+cmp r3, r1
+L72: jmp L151
+dec r2
+bne *r2
+cmp *r4, r7
+L73: prn *r7
+mov r7, *r0
+cmp #50, L75
+L74: sub #201, r0
+not r7
+red r4
+L75: .data 265
+bne L52
+red *r2
+L76: add L70, r7
+clr *r1
+; comment
+L77: stop
+L78: cmp *r4, r3
+L79: stop
+clr L107
+jmp L79
+not r5
+mov r4, r2
+sub r5, r3
+red L28
+lea L44, r1
+; comment
+L80: inc r5
+L81: clr L11
+red L116
+red r2
+L82: lea L6, L24
+rts
+L83: red L81
+lea L11, *r3
+prn #-226
+lea L10, L254
+L84: stop
+dec *r4
+clr L84
+bne *r0
+mov L171, *r0
+cmp *r2, r3
+L85: jsr L201
+L86: sub *r4, *r5
+cmp *r2, r5
+L87: .string "pfesssxdojioewqzvsw"
+bne *r7
+; comment
+rts
+jsr L4
+L88: .data -949, 294, -106, -429, 400, 137, 425
+prn *r5
+sub #-170, r4
+lea L66, *r1
+; comment
+cmp *r1, L50
+L89: .string "hqznnvosxmaagcjmya"
+dec *r3
+stop
+L90: cmp #81, #99
+L91: jmp *r4
+L92: dec L60
+L93: .data -835, -931, 123, 578
+L94: not L8
+mov L81, L96
+stop
+L95: cmp L17, L214
+red *r5
+L96: red r0
+sub #-122, r0
+L97: jsr *r7
+dec *r6
+bne L81
+L98: red *r1
+red r7
+mov #-149, L36
+L99: rts
+lea L49, L87
+jsr *r4
+L100: inc *r2
+
+jmp L192
+L101: rts
+not r4
+stop
+jsr L14
+L102: dec r4
+L103: rts
+stop
+bne *r5
+jsr L88
+jmp *r4
+L104: .string "sfebdthohaexo"
+jsr L216
+stop
+add r2, r0
+cmp L224, #97
+L105: .data 834, -771, -839, -907
+red L114
+cmp *r0, #55
+jsr *r4
+clr r1
+L106: .data 816, -382, -669, -260
+L107: rts
+add r7, *r4
+rts
+prn L130
+dec *r7
+L108: .string "dupvdmgooklvx"
+dec r7
+L109: jmp *r7
+rts
+jmp L17
+cmp r4, L26
+stop
+mov r0, r0
+L110: clr L86
+inc *r6
+not L45
+rts
+rts
+L111: rts
+sub *r5, *r2
+jmp L221
+L112: prn *r1
+L113: not *r4
+inc L12
+dec r4
+L114: clr L231
+prn #164
+mov r7, r4
+L115: not r3
+cmp L250, *r5
+jsr L103
+red *r0
+L116: .data 831, 387, 476, 797
+dec r3
+jmp L173
+cmp L172, r0
+lea L56, r3
+L117: mov *r2, r1
+lea L85, *r3
+L118: clr L83
+L119: .string "kk"
+bne L168
+red L191
+mov L51, L193
+rts
+L120: .string "xpafwkwrbkw"
+L121: mov L96, r5
+dec *r0
+lea L44, r7
+; comment
+L122: jsr L234
+
+bne L163
+dec *r2
+prn r4
+L123: cmp *r4, L215
+cmp *r1, #-123
+lea L108, *r4
+dec *r0
+L124: .data -864, 810, 161, -532, 753, -575
+
+stop
+dec r6
+red r4
+add *r3, L9
+sub L117, r2
+sub *r4, *r7
+mov L61, L61
+rts
+L125: .data -66, 602, -455
+cmp #-224, #-11
+not L221
+lea L153, *r4
+L126: add r0, r0
+bne *r4
+L127: add L49, L249
+red L72
+add r1, L178
+mov *r4, r4
+cmp *r7, L144
+jsr L133
+not r6
+L128: .string "d"
+red L5
+lea L56, L98
+clr L175
+inc *r6
+bne L130
+jmp *r4
+L129: bne *r1
+dec r7
+mov *r7, *r6
+clr L219
+jsr L192
+dec r5
+clr *r7
+lea L245, L232
+add *r1, *r7
+rts
+mov #102, L170
+jmp *r1
+stop
+rts
+inc L196
+L130: clr *r5
+sub #-1, L221
+L131: .string "ukgcxgyxpqiglzpy"
+L132: inc L109
+L133: cmp #143, r0
+not r5
+mov #129, *r4
+inc r3
+jmp L76
+red r6
+prn L76
+L134: stop
+red L237
+L135: add #-247, L68
+add L223, *r3
+add r3, *r5
+lea L74, *r6
+L136: rts
+rts
+sub L27, *r0
+L137: inc r7
+dec L10
+mov L217, *r6
+lea L178, L169
+mov #186, L14
+stop
+clr L194
+inc L36
+L138: .string "ffvqtywptsus"
+L139: .data -385, 556
+L140: sub *r6, *r2
+mov L111, L258
+prn *r0
+stop
+L141: lea L217, L214
+add #-177, L171
+sub #119, r5
+add *r4, *r0
+inc *r5
+stop
+not r0
+rts
+L142: .string "afppidhdi"
+jmp *r7
+L143: mov L19, r1
+L144: sub #-248, L58
+sub L101, r5
+dec L185
+lea L141, L128
+L145: not *r2
+L146: prn *r6
+jsr *r6
+stop
+jmp *r7
+clr L22
+stop
+sub L221, *r6
+L147: .string "zgfzugallae"
+L148: red r1
+red *r0
+clr L155
+L149: jsr *r3
+not L240
+cmp r7, L181
+L150: .string "vmcxbmaynnqk"
+sub *r1, L209
+add *r3, r6
+cmp *r3, L153
+inc r5
+add *r2, r3
+L151: red *r1
+lea L15, r7
+mov L237, r7
+L152: jmp L172
+mov r7, r5
+sub r1, r0
+L153: not L179
+jmp *r2
+not *r7
+lea L244, *r6
+red *r1
+bne *r1
+bne *r2
+not *r2
+add *r6, L178
+sub #226, r0
+L154: add r5, L207
+bne *r7
+red *r5
+red L178
+
+L155: clr r6
+L156: .string "vgvbze"
+L157: .string "zikcuzdcxyurppedndwxtx"
+mov L160, L227
+prn #172
+cmp L114, *r0
+lea L44, *r3
+add *r5, *r7
+rts
+prn L214
+jmp L183
+bne *r7
+mov L96, *r1
+add *r2, L160
+inc r3
+clr *r0
+prn *r1
+dec r1
+L158: cmp r0, #-100
+add L191, *r2
+jsr *r1
+
+L159: .string "lmlckswxjoecshlqbsusul"
+jsr L20
+L160: .string "pua"
+red r2
+sub *r1, *r6
+red L226
+; comment
+add #139, L241
+not r3
+clr r4
+bne L79
+L161: stop
+sub *r1, L194
+bne *r1
+
+not L97
+dec L113
+L162: sub r2, L150
+red L96
+red *r2
+sub r1, *r0
+L163: add L3, *r1
+inc *r0
+not L215
+L164: mov L112, L84
+
+mov #77, *r2
+mov #19, *r4
+L165: .data -670, 357, -725, -583, 993
+L166: .data -885, 563
+inc r7
+sub #-226, *r0
+L167: bne L25
+mov #-56, r4
+jmp L42
+cmp L244, #-25
+L168: cmp r1, L44
+dec L260
+prn L218
+red L244
+rts
+L169: not *r2
+L170: .data 805, 823, -909, 114, -822, 735, 883, -307
+add r1, r0
+dec r6
+red L252
+lea L234, *r4
+inc L253
+bne L38
+L171: .string "ou"
+L172: .string "lzubichs"
+mov L78, L91
+L173: inc r7
+inc r7
+red L75
+lea L121, r2
+mov L215, *r1
+not r0
+mov L249, L68
+L174: clr L188
+L175: jmp L224
+stop
+L176: .data 626
+prn r1
+L177: bne *r7
+prn L65
+sub #76, *r3
+; comment
+inc L221
+; comment
+L178: .string "fjipsqoczaffqyffnwmgb"
+L179: jmp *r1
+L180: sub L227, *r5
+jmp L226
+clr r0
+bne *r3
+prn L29
+not r2
+
+dec *r1
+lea L44, r1
+L181: .string "xeco"
+clr L40
+rts
+prn *r1
+stop
+not r4
+add #63, L116
+mov r6, *r0
+mov #-59, L256
+rts
+L182: jsr L240
+L183: mov L255, *r1
+bne L125
+not L186
+cmp r0, L226
+red *r7
+L184: dec r5
+not r6
+cmp #36, *r7
+rts
+stop
+
+red *r4
+L185: not *r1
+jsr L185
+stop
+lea L20, L210
+L186: bne L187
+jsr *r4
+clr r5
+stop
+L187: prn r4
+bne L68
+; comment
+jmp *r4
+jsr L206
+clr L203
+mov r6, *r7
+L188: .data 279, 449, 215, -772
+L189: prn #128
+bne L245
+mov #89, *r1
+cmp #55, #-252
+L190: dec r0
+add L237, L190
+jmp L248
+lea L141, L1
+bne *r6
+L191: .data 442, 92, 277, -535
+L192: cmp r7, #-254
+mov *r7, *r6
+add r3, L75
+stop
+L193: stop
+jmp L220
+rts
+clr L10
+not r3
+add L240, r2
+L194: .data -429, -182, -670, -271, -78
+stop
+L195: not *r2
+rts
+mov #-17, L253
+stop
+rts
+dec *r4
+not r0
+inc L197
+lea L205, *r1
+jsr L226
+L196: mov #-252, r3
+lea L15, *r6
+L197: .string "ytaogjsaxskkxxmxtjcdtzqs"
+prn #7
+L198: .string "mjihusilmrvqkqktnhftbeds"
+L199: .data 843, -693, 690, 166, 864, -874
+dec L241
+; comment
+bne L221
+L200: .data 654, -234, -65, 614, 29
+L201: .string "oqwovfkznohwxapsy"
+stop
+prn #90
+; comment
+add r5, r1
+inc r6
+mov *r4, *r3
+not L114
+sub L229, r1
+rts
+L202: stop
+sub r7, r7
+bne L257
+not L21
+lea L146, *r2
+mov #133, *r3
+cmp #-14, L222
+L203: .string "lvktxun"
+L204: .string "ftwkfiftzibjbbsyrzq"
+L205: mov *r6, L77
+bne L17
+L206: add L246, r3
+rts
+inc r0
+clr r0
+add L221, r6
+
+red r1
+lea L252, r1
+rts
+L207: cmp #-49, *r2
+L208: red L114
+L209: jsr L100
+L210: jmp L240
+jmp L121
+dec *r2
+L211: clr L221
+not *r7
+stop
+dec *r3
+L212: cmp r4, #-151
+inc L252
+L213: prn *r4
+red L161
+L214: jsr *r7
+; comment
+dec L223
+prn r0
+stop
+L215: add *r7, *r2
+lea L217, L229
+sub *r7, L81
+rts
+L216: sub r2, r5
+bne *r3
+mov L216, *r3
+rts
+L217: jsr *r1
+not *r0
+L218: jmp *r2
+clr L251
+L219: clr r1
+add L220, *r1
+not L166
+inc r4
+jsr *r1
+sub L253, L216
+bne L243
+L220: add r6, L230
+clr r2
+L221: clr L226
+clr r2
+sub r5, L94
+L222: .string "nnykng"
+red L19
+prn r5
+red r6
+rts
+rts
+jsr *r4
+sub L145, *r7
+L223: stop
+clr L236
+L224: .string "glrjcmyziwgmvduvxus"
+sub L229, L161
+inc *r4
+prn r6
+L225: dec *r6
+jsr *r1
+; comment
+stop
+not *r7
+prn *r1
+rts
+lea L174, L257
+L226: inc *r4
+add #175, L259
+not *r7
+clr L29
+L227: .data -663, 754, 429, 325, 433
+not r1
+lea L228, L229
+mov r5, *r1
+add L30, r2
+L228: rts
+clr r7
+lea L249, *r4
+L229: .data -713, 528
+cmp *r2, L144
+jsr L162
+prn r7
+mov #126, L237
+L230: clr r7
+not *r2
+prn r2
+prn #-225
+rts
+stop
+dec *r3
+mov #25, L232
+mov r5, r6
+jsr *r5
+red L183
+cmp r1, *r6
+L231: rts
+L232: stop
+prn #-226
+L233: lea L258, L57
+L234: .string "yvnw"
+sub L94, L235
+L235: .string "dntabp"
+L236: .data -308, 868, 386
+L237: cmp *r4, r1
+lea L176, r5
+L238: jsr L252
+jsr L245
+; comment
+not *r0
+jmp *r0
+L239: not *r3
+mov r0, L44
+; comment
+sub #-193, *r2
+stop
+rts
+lea L105, *r4
+red L259
+red r0
+dec *r6
+L240: jmp *r2
+L241: not L248
+L242: .data 222, 912, 33, 555
+add #-49, *r7
+inc L19
+
+L243: prn #-38
+rts
+mov r7, *r7
+mov r2, *r3
+L244: .data -213
+L245: jsr L254
+dec L260
+inc L160
+jmp *r6
+L246: lea L160, L95
+bne *r4
+red L247
+mov #111, *r3
+bne *r3
+add L254, r6
+jsr L247
+inc L256
+sub #-174, *r5
+; comment
+dec L199
+cmp #86, L27
+cmp r3, r1
+mov L44, *r2
+L247: not L94
+jsr *r2
+inc *r7
+L248: stop
+L249: sub r2, L53
+sub r5, r2
+mov #197, *r4
+lea L252, r3
+; comment
+not *r4
+inc *r5
+jmp *r3
+lea L241, L256
+sub L258, L251
+L250: mov *r7, r2
+inc L174
+rts
+inc r2
+not *r6
+L251: sub L255, r3
+; comment
+; comment
+cmp *r7, *r6
+jsr *r1
+jsr *r1
+L252: .string "gxvdsiwxtobxenyq"
+cmp *r5, L162
+L253: .string "xsh"
+L254: .data 293
+L255: prn #57
+L256: .data -758, 190, -888, -474, 405
+L257: .data 572, 410, 971, -271, 79, 35
+mov *r2, *r4
+not L260
+add L161, r1
+
+red L80
+rts
+cmp #-249, #222
+stop
+stop
+bne L74
+prn r2
+L258: .string "iauuowhhd"
+add r6, L144
+
+not L260
+clr r7
+mov L260, L260
+L259: add *r6, r1
+bne *r0
+lea L235, L247
+add #28, L260
+L260: stop
+cmp *r2, r3
+stop
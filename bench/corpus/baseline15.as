@@ -0,0 +1,1019 @@
+; Generated by genCorpus --seed 16
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+L0: sub #29, *r0
+prn #-33
+red L110
+add #-178, L27
+L1: sub #-204, L243
+prn r3
+dec r3
+prn L0
+dec L0
+not r5
+mov L1, L209
+not *r5
+L2: add *r1, *r4
+L3: add #136, r3
+red r1
+sub *r3, *r3
+red L3
+sub L3, L3
+dec L4
+L4: .string "bvcxpfxnwxrgguylzei"
+bne L1
+L5: .string "zcrvavaakxnidynfln"
+cmp *r5, #21
+inc r3
+L6: .string "rksrnwsmdkxqujlmm"
+not L5
+add #-30, r0
+rts
+clr r1
+cmp L4, r5
+jsr L182
+L7: cmp r2, r1
+L8: rts
+rts
+stop
+add r6, L254
+L9: not L41
+; comment
+L10: .data -95, -782, -335, -319, -385, -743
+red *r3
+jsr L9
+dec L3
+not L6
+stop
+cmp #160, *r2
+rts
+not r1
+L11: clr r1
+rts
+L12: dec r4
+jsr *r5
+mov *r4, *r7
+cmp L8, L118
+L13: prn r0
+rts
+not *r1
+red L7
+L14: jmp L3
+mov L1, *r2
+red *r7
+sub #-151, L2
+inc L5
+lea L39, *r0
+; comment
+L15: stop
+clr L7
+L16: sub #116, *r4
+L17: add *r7, L10
+L18: prn #47
+L19: bne *r7
+red L17
+add *r5, r3
+; comment
+stop
+cmp r0, r5
+L20: rts
+inc *r3
+lea L10, r5
+stop
+L21: clr *r2
+rts
+not L38
+mov #-252, *r4
+L22: jsr L22
+jsr *r2
+jsr *r2
+red *r2
+jsr *r1
+not r0
+L23: .string "lfyrpaxgcs"
+sub r3, r4
+L24: prn r2
+inc L252
+sub r3, r3
+stop
+mov *r5, r2
+lea L215, r4
+L25: prn L54
+
+clr r4
+clr r6
+lea L17, L6
+L26: jsr L82
+rts
+; comment
+red r4
+L27: .data -180, -178, 579, 837, -840, 547
+dec r3
+bne *r0
+mov #-124, *r1
+prn L236
+sub *r3, L18
+L28: add *r0, *r1
+L29: .data 271, -535, 794, 498, 245
+sub L26, *r1
+prn L12
+L30: rts
+bne *r4
+stop
+rts
+mov *r3, *r0
+stop
+L31: clr *r4
+inc *r6
+lea L22, *r2
+rts
+jmp L186
+lea L95, r5
+cmp L3, r3
+prn r0
+add L18, L26
+not *r2
+add #13, *r1
+mov L138, L71
+prn L4
+L32: lea L79, r5
+bne *r7
+jmp *r4
+L33: .string "kchejpp"
+dec r6
+mov #-114, *r3
+L34: stop
+inc L186
+add r7, r3
+lea L15, L9
+L35: .data -489
+L36: bne L229
+prn #-135
+mov #-124, L106
+stop
+not r2
+lea L239, L179
+L37: dec L117
+rts
+rts
+jmp L21
+clr r0
+stop
+L38: .string "esjikygucsxcjfhscj"
+stop
+clr L21
+clr r1
+mov #115, r7
+L39: jsr L1
+L40: sub #6, *r3
+sub L30, *r3
+dec *r6
+dec L0
+rts
+dec r5
+dec r6
+L41: add L106, r0
+L42: .string "beybzofvcuj"
+bne *r7
+stop
+jmp L19
+
+sub *r5, r2
+lea L13, *r1
+L43: lea L198, r4
+inc *r5
+add *r5, *r2
+not *r6
+
+rts
+L44: .string "eil"
+L45: lea L16, L28
+red *r7
+stop
+sub L17, r1
+prn #-94
+dec L128
+inc L5
+not *r1
+sub #51, L0
+jsr L3
+prn r2
+inc r4
+rts
+rts
+clr r6
+add L4, *r6
+red *r1
+clr r4
+clr L23
+jmp *r5
+L46: .data -678, 657, -185, 722, -807
+sub L195, r6
+dec L77
+sub r7, L71
+jsr L150
+cmp #-226, *r5
+L47: .data 474, 848, -414, -142, 35
+mov r4, L47
+sub L6, *r6
+sub *r3, L182
+mov *r7, r1
+L48: not L17
+dec r3
+red r5
+bne *r6
+L49: inc r5
+lea L34, L29
+dec r3
+rts
+dec *r6
+mov *r4, L108
+inc *r3
+L50: mov *r2, r3
+mov #40, L53
+L51: sub #-134, L48
+
+sub r6, L40
+prn r2
+L52: red r3
+not *r2
+cmp L57, L162
+dec L115
+lea L121, *r5
+red *r0
+L53: mov r4, *r3
+rts
+not *r2
+lea L60, r1
+L54: dec L117
+inc r5
+bne L21
+jmp L33
+clr *r1
+L55: sub L0, r3
+L56: .string "mmdvkgbdgy"
+sub #-65, r2
+bne L223
+mov #167, r1
+inc L190
+bne *r3
+prn L68
+rts
+lea L184, r1
+rts
+jsr *r1
+bne L200
+dec *r4
+jmp *r7
+cmp r4, r5
+red L46
+L57: lea L12, L32
+red r7
+L58: .data -413, 86, -321, -29
+L59: jmp *r5
+add r7, *r2
+L60: stop
+bne *r2
+sub *r2, *r3
+L61: rts
+inc r7
+sub #-18, *r2
+clr r5
+
+L62: not r5
+L63: red L36
+inc r3
+lea L8, *r1
+; comment
+L64: dec r2
+L65: .data -58, -992, -226
+prn L254
+L66: prn #169
+inc *r2
+L67: prn r1
+rts
+prn L261
+L68: .string "of"
+L69: not *r1
+L70: .string "q"
+L71: clr r4
+L72: bne *r6
+L73: .data -516, 70, 750, 471, 30, -334, 38, 502
+cmp L35, *r4
+
+L74: red *r1
+mov L59, L31
+L75: stop
+jmp L14
+red *r1
+L76: bne *r7
+rts
+
+prn L44
+mov #-72, *r4
+; comment
+lea L236, r2
+red L33
+clr *r1
+not *r2
+dec L17
+jmp L2
+
+; comment
+sub r3, r7
+jsr *r0
+red r2
+jsr *r1
+prn L65
+clr L158
+jsr L61
+L77: .string "xfcjhwpuqlmuksvj"
+L78: inc *r6
+L79: .data -358, 173, 970
+cmp *r4, #99
+inc *r1
+jsr *r2
+inc L101
+add r7, r1
+prn #85
+L80: .string "dhnhyyof"
+L81: dec *r4
+jsr L52
+L82: bne *r4
+L83: dec *r5
+L84: .string "ekqyspqncshzcjcchy"
+lea L19, L151
+prn #125
+prn L226
+jmp L33
+L85: rts
+L86: sub L64, *r7
+jsr L244
+sub r4, *r1
+sub L257, L130
+rts
+red r4
+dec *r3
+inc *r6
+L87: dec L115
+lea L146, *r4
+cmp L62, L192
+L88: .data -299, -818, -175, -502, -460, 941
+bne L80
+bne *r5
+rts
+bne L187
+mov *r5, r5
+L89: .string "tulpxbwuchkdulxeiyvyxu"
+L90: clr L129
+lea L48, *r2
+stop
+L91: .string "iqleffrjhsqehwqyldqg"
+bne L29
+red *r1
+dec r5
+L92: bne *r4
+mov r6, r2
+stop
+dec *r6
+mov #152, L173
+L93: lea L44, r3
+inc *r0
+L94: red L34
+L95: lea L13, r4
+; comment
+jmp *r3
+L96: .data -867, 548, -574, 708, 177, -310, 453, 335
+jmp *r3
+dec L205
+mov *r4, r5
+lea L28, L232
+L97: jsr *r3
+
+L98: .data 365, -817
+L99: bne *r3
+clr r2
+cmp r2, #19
+cmp #-202, r3
+jmp *r5
+L100: .string "tolpvzjfrj"
+L101: bne *r6
+clr r3
+jmp *r2
+not *r0
+L102: .string "velbzagalxuzncjcmh"
+L103: .data 866, -796, 471
+L104: prn L162
+prn L0
+L105: .string "jpwccmhcbswkcna"
+dec *r5
+cmp L164, *r2
+add r7, *r2
+lea L149, L178
+L106: .string "bgmlidaytoaluaodlhibzskm"
+L107: .data 144, 928, -209, 237
+L108: .data -799, -522, 276, 855, 466, -807
+sub r7, r2
+lea L242, *r3
+add r3, r7
+mov L235, *r3
+L109: .string "hyaxvmjdrvibmgbqgntslzs"
+cmp L116, *r6
+stop
+cmp L236, #242
+L110: rts
+add #-126, L100
+L111: .string "elotdyhkrvbhkrypov"
+red L231
+prn #-91
+L112: .string "eznighexzfikjvgvr"
+
+; comment
+add #-198, r2
+lea L33, L155
+dec *r3
+rts
+clr r6
+; comment
+cmp L12, r2
+prn L147
+jsr *r4
+
+rts
+L113: .string "uouizqkkdqevufuyrxtucq"
+L114: .data 314, 635, 312, -987, -860, -142
+red L2
+rts
+L115: prn #116
+L116: jsr *r4
+L117: .data 938, -820, -965, -770, -164, -197, -993
+jsr L174
+add *r3, r7
+rts
+L118: stop
+L119: not L219
+L120: .string "dmzwb"
+dec L167
+L121: .data 217, 119, 56, 513, -788, 32
+bne L106
+clr *r2
+dec L155
+lea L54, *r6
+L122: .string "afslqgbe"
+
+jmp L236
+L123: add #89, *r7
+L124: .string "sz"
+stop
+L125: .data -245, 873, -465
+cmp r0, *r1
+L126: cmp r4, #239
+dec r3
+bne L90
+L127: .data -484, 652, -22, -916, 160, 276, 214
+red r1
+red L6
+stop
+bne *r5
+inc L99
+L128: red *r2
+L129: rts
+dec *r0
+L130: .string "kkzitktsfuyavozduhzunfo"
+lea L61, r1
+rts
+add r5, *r1
+L131: .data -933, 242, -213, 870, 258
+inc L68
+L132: add L228, L257
+inc L160
+rts
+add *r4, L75
+sub *r6, *r1
+L133: lea L66, r2
+L134: rts
+sub #-35, r3
+add L161, r4
+L135: lea L78, r3
+dec r5
+L136: .string "ptzaaewwzwohgzalbjriaq"
+stop
+cmp *r6, #56
+cmp *r2, #-246
+L137: jmp *r0
+rts
+L138: .data -256
+sub #78, L214
+L139: dec *r3
+bne *r1
+red L214
+stop
+prn *r4
+red L207
+jmp L233
+add *r0, *r3
+L140: stop
+rts
+bne *r5
+jmp L154
+not *r4
+red *r6
+jsr *r5
+inc L239
+clr *r6
+L141: rts
+jsr L210
+L142: jsr *r2
+add #254, r3
+bne *r2
+not *r3
+L143: jsr *r6
+add r2, *r7
+L144: dec r2
+mov #-254, r6
+L145: sub *r1, L98
+L146: .string "jzevbxnyhlbrncce"
+L147: cmp *r1, #70
+prn #186
+jsr *r1
+L148: .data -528, 834, 423, -140
+rts
+red r3
+L149: stop
+sub L237, r7
+dec *r6
+L150: not r5
+cmp L218, L237
+dec *r4
+jsr L240
+red r2
+stop
+L151: add *r4, L227
+add r2, *r7
+stop
+jsr L260
+cmp r5, L112
+bne L14
+rts
+clr L128
+jsr *r7
+L152: .string "heycckmjkgyqph"
+L153: mov #75, *r4
+rts
+not r1
+add *r2, *r4
+not r7
+L154: .string "lhvoimhnseb"
+add L244, *r2
+jmp L9
+bne L224
+L155: .string "im"
+add L202, *r0
+clr r7
+
+cmp r5, #250
+L156: .string "naqstaodhunij"
+L157: dec r1
+red *r4
+not L256
+clr *r7
+L158: .string "sokmevnjzxvrpmkudst"
+lea L56, *r6
+jmp L29
+dec *r3
+rts
+rts
+L159: jsr *r2
+L160: inc *r6
+stop
+L161: .string "yxklvwdh"
+dec *r1
+cmp #141, r4
+bne *r7
+inc *r4
+dec L84
+prn r3
+jmp *r1
+cmp *r0, #-228
+L162: clr r1
+jmp *r0
+mov *r1, L162
+dec *r5
+bne *r0
+clr r0
+lea L222, L36
+prn L246
+dec L161
+rts
+add L256, L256
+dec r7
+red *r5
+red *r3
+lea L99, r2
+L163: .data -441
+L164: jsr *r3
+L165: .string "zsg"
+L166: red r6
+jsr *r3
+L167: stop
+prn *r5
+mov *r1, *r5
+not L30
+jmp L59
+jmp L234
+L168: .data 989, -545, -399, -695, -4, -657, 189
+L169: cmp *r3, L141
+L170: mov L243, r0
+clr *r2
+bne L19
+bne L24
+not r3
+mov r4, *r7
+lea L80, *r0
+dec r5
+bne L90
+L171: dec *r0
+rts
+red r2
+mov #-82, r2
+cmp r6, r5
+dec r1
+L172: jmp L1
+dec L187
+mov *r4, L60
+stop
+
+lea L235, r7
+sub #133, *r1
+L173: mov L1, L151
+add *r7, *r3
+cmp *r5, *r3
+dec L178
+L174: clr L35
+red *r1
+prn r3
+dec L91
+jsr *r1
+add L241, *r7
+sub L255, r0
+bne L8
+; comment
+lea L39, r5
+lea L175, L46
+mov *r6, *r0
+jsr *r6
+jmp L230
+
+add #129, L82
+add *r7, L11
+rts
+L175: .string "vfjdzapt"
+prn L153
+clr *r6
+mov #-223, r1
+cmp L139, L243
+clr L210
+red *r6
+L176: rts
+; comment
+prn #-191
+prn r6
+mov #-245, r0
+L177: inc r7
+inc L111
+stop
+; comment
+inc r2
+sub *r1, L216
+L178: .data 457, -820, 530
+rts
+L179: rts
+jmp *r5
+L180: rts
+sub #-248, r0
+not L123
+L181: rts
+prn r2
+inc r1
+prn *r1
+L182: mov L149, *r6
+rts
+L183: mov r3, *r5
+L184: add *r0, *r3
+
+mov #-66, L196
+L185: rts
+L186: prn r2
+dec *r5
+jsr *r5
+mov #122, L194
+L187: jmp *r0
+mov *r7, *r4
+cmp *r7, L222
+inc r1
+cmp #-139, L234
+prn *r3
+L188: prn #55
+stop
+cmp #91, *r6
+jsr *r2
+; comment
+jmp L172
+lea L242, L30
+; comment
+L189: .data 876, -70, 744, 246
+sub *r1, *r6
+bne L193
+; comment
+not r6
+L190: .data -933, 698, 512, 674, -742, 864, -382
+sub *r7, L234
+dec r2
+clr L146
+stop
+L191: .data -483, 920, 326, 525, 436, 715, 619
+add #-115, L240
+jmp *r0
+L192: lea L238, L204
+L193: lea L209, *r6
+L194: inc L127
+dec r2
+jmp *r1
+; comment
+dec r7
+rts
+sub r5, *r2
+cmp r6, *r7
+clr L250
+; comment
+
+; comment
+bne L210
+prn #56
+L195: jmp L70
+L196: .data -732, 661, 214, 680
+L197: .data -328, -762
+inc *r6
+L198: prn #55
+add *r5, r5
+clr *r5
+inc *r0
+sub #24, L204
+L199: lea L215, r3
+red *r1
+mov *r6, *r4
+L200: .string "hwlwjvkmjjejhxgaxqilw"
+clr r5
+dec *r2
+jmp *r7
+bne *r0
+cmp r6, #-129
+L201: .data 10
+L202: stop
+stop
+stop
+not r6
+add *r3, L232
+clr *r5
+not r3
+L203: sub r2, r0
+dec L207
+stop
+L204: .string "zzktsvlqojwjtogvowexbjg"
+add L259, r4
+mov L72, r2
+L205: .data 974, 410
+rts
+L206: mov *r3, *r4
+L207: .string "lyajfcbdwoufjawlbrb"
+cmp L67, *r4
+jmp *r3
+bne L199
+L208: clr *r2
+not r4
+stop
+dec r6
+inc r1
+bne L217
+dec L251
+red *r6
+sub *r7, *r6
+L209: .string "kjdzv"
+not *r6
+bne L168
+dec *r6
+sub L163, *r7
+L210: .data -233, 26, -779, 587, 852, 201, 379, 42
+L211: .data 209, -580, -772, 247, -923, -899, -457, -796
+mov #-28, r7
+add *r6, *r5
+jmp L249
+; comment
+add L29, r3
+sub *r6, r1
+red L217
+sub r1, L260
+not *r0
+L212: jsr L201
+dec *r5
+not r3
+jsr *r6
+lea L220, L232
+sub r2, r5
+L213: dec L115
+L214: clr *r3
+
+stop
+L215: prn r7
+clr r4
+inc r6
+prn *r3
+clr L44
+rts
+L216: not L253
+prn r2
+inc r6
+add *r3, L261
+sub *r1, *r5
+
+bne *r6
+red r4
+L217: dec L226
+L218: dec *r7
+jsr *r5
+L219: .data -472, -246
+not *r1
+inc r4
+clr r4
+L220: lea L2, L246
+
+rts
+bne *r2
+not L21
+prn *r7
+inc r5
+L221: .string "cxpqrttakyjmu"
+cmp #45, #18
+mov *r1, L247
+mov r5, L3
+jsr *r5
+L222: dec *r6
+L223: .string "ytwltdhlccwjgznjtapuyn"
+L224: .string "tyosptxmvyzar"
+bne L249
+rts
+red *r3
+L225: stop
+red *r4
+cmp *r6, L209
+; comment
+L226: dec r6
+cmp r7, r1
+L227: jsr L75
+L228: add L159, *r4
+L229: cmp r7, #142
+mov L15, r6
+not L253
+lea L253, L96
+jmp L30
+stop
+clr *r7
+stop
+lea L261, r1
+L230: jsr *r1
+dec *r7
+; comment
+bne L253
+prn L247
+L231: .data -365, 265, 520, -256, 320, -882, -653, 967
+L232: .data 675, 464, -403, 556, 316, -38
+not L245
+bne *r3
+L233: .string "turdhheejwxtlkgra"
+add #56, *r1
+; comment
+stop
+add r4, *r0
+jmp L244
+L234: prn *r3
+jmp *r0
+not *r7
+L235: bne *r4
+sub r3, *r3
+jsr *r3
+L236: rts
+red *r1
+jmp L250
+L237: prn L251
+rts
+inc L215
+clr *r4
+clr r0
+
+prn r7
+jsr *r5
+add r6, r0
+sub L63, L255
+L238: .string "jmbwrockgrjrurhvcojlmku"
+add *r1, L254
+clr *r2
+dec r7
+
+lea L249, r7
+not *r7
+L239: .string "rbcsib"
+sub r1, *r6
+mov *r2, L243
+L240: dec L178
+L241: .string "hapnmdgyrmotuvjhm"
+clr L97
+
+jsr *r6
+mov L259, L55
+cmp L203, L94
+L242: .string "qxrtmp"
+; comment
+inc r5
+jmp L140
+bne *r6
+jmp *r6
+L243: .string "lrmbj"
+add #-107, r7
+sub L18, *r0
+prn *r6
+sub r2, r6
+jsr *r5
+jsr L247
+dec r5
+mov r5, *r4
+jmp *r7
+prn #-208
+L244: sub r2, r3
+mov L46, r4
+not *r3
+add #-181, L254
+lea L258, L258
+L245: clr L213
+jmp *r3
+jsr L250
+L246: .data 775, 904, -603, 578, 903
+red L250
+L247: .data -962, 932, 925, -55, -698, -418, -909
+L248: clr r1
+L249: add *r2, L102
+jmp L137
+stop
+L250: .data 300, -412, -25, 339, 54, -887
+inc r3
+stop
+not L257
+L251: stop
+cmp *r4, *r2
+L252: clr L260
+add #146, *r7
+cmp #50, #-90
+inc r6
+lea L58, L256
+L253: add L67, L260
+cmp r3, r3
+L254: dec L125
+stop
+L255: prn L256
+lea L256, *r4
+jmp L261
+rts
+L256: red r7
+L257: .string "xothqfkatcpxoszftss"
+jsr *r6
+add #207, r2
+jsr L65
+mov L84, r3
+add *r5, r0
+bne L63
+
+stop
+L258: clr L48
+add #251, L259
+L259: dec L28
+sub L151, *r3
+L260: lea L102, L54
+L261: add L10, r5
+sub r2, L91
+stop
+not r3
+stop
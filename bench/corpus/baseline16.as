@@ -0,0 +1,1018 @@
+; Generated by genCorpus --seed 17
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+L0: .string "zqsazbixdcfejuod"
+add L0, r2
+jmp L227
+jmp L0
+mov *r1, *r5
+L1: not r1
+dec L0
+mov #-200, L93
+inc L0
+L2: clr r5
+red r5
+L3: .string "hedqwbcrlpdlbvkhrysr"
+rts
+bne L3
+bne L0
+sub *r6, *r7
+clr *r6
+dec *r1
+red r6
+L4: .data 423, -634, -44
+dec r7
+sub #-145, r7
+L5: .data 534
+dec *r3
+prn #60
+L6: lea L68, L116
+L7: prn r3
+L8: .data -453, 511, -367, -617
+dec r6
+L9: .data 28, 161, 978, 286
+L10: cmp #130, #-50
+dec r4
+L11: inc *r3
+clr L226
+not L9
+not *r2
+L12: add *r0, *r7
+inc r2
+add L5, r7
+
+L13: jmp *r0
+L14: add #78, r3
+L15: stop
+red L6
+; comment
+sub r0, L122
+dec L2
+L16: jmp L4
+stop
+not *r2
+sub *r5, *r4
+jmp L148
+L17: lea L0, L2
+dec *r0
+L18: .data 803, 858, 868, -10, 384
+sub r2, *r1
+L19: jmp L13
+add L3, L8
+red r7
+sub r0, r6
+add #-185, *r1
+stop
+L20: dec L18
+not r1
+dec L137
+L21: not L131
+clr L1
+add *r2, *r0
+jmp *r3
+sub L92, *r4
+mov #-188, *r2
+dec *r4
+jsr *r3
+cmp #82, #251
+jsr L10
+L22: jmp *r5
+inc *r2
+red *r7
+L23: not r6
+add r5, r0
+L24: .data 387, -266, 493, -68, -949
+L25: rts
+L26: mov #25, r2
+mov #-102, L230
+not r3
+; comment
+add r7, L21
+L27: .data 93, -951, -800, -680, -305, 690, 257
+jmp *r0
+
+bne *r6
+dec *r0
+not L91
+stop
+prn #-28
+L28: .string "joqiskcrsrlstcjuc"
+cmp r1, L144
+add r2, *r2
+jsr L140
+bne *r1
+lea L5, *r7
+L29: not *r4
+jsr *r0
+
+red r0
+lea L10, L1
+clr L59
+dec L20
+not *r1
+add *r7, r1
+bne *r4
+not *r7
+cmp #205, #236
+L30: jsr *r7
+red r0
+mov #-36, *r2
+jsr L79
+red *r7
+dec L4
+mov #-127, L2
+add r6, r3
+jmp L227
+rts
+L31: not L13
+cmp r6, *r1
+stop
+L32: .data 115
+bne *r4
+bne *r0
+L33: .data 946, 48, -85, 281, 315, 496
+add r6, r6
+red L247
+L34: cmp r5, r2
+add #37, L11
+L35: .data 688, -430, 753, -144, -124, -959, 408
+jsr L12
+cmp *r3, L6
+prn *r1
+prn #-84
+red *r1
+prn r1
+cmp #14, #11
+not r4
+; comment
+mov L2, *r2
+L36: stop
+stop
+L37: stop
+clr *r1
+L38: .data 936, 745, 977, -878, -959, 510, 294, -797
+L39: add #-89, L179
+prn *r7
+prn r0
+bne *r2
+clr L73
+stop
+lea L44, r4
+jsr *r1
+rts
+jsr L26
+cmp r5, #-22
+sub *r4, L27
+red *r5
+sub L39, L144
+mov #-72, *r1
+L40: .string "rcbvzdwohcklzqdxeit"
+jsr *r0
+add #158, L7
+L41: jmp *r3
+
+mov #87, L35
+L42: red r2
+rts
+sub L229, L195
+L43: .data 985
+L44: .data 525, -38, -248, -137, -838, 407, -708
+L45: cmp *r6, #83
+red r4
+clr *r6
+cmp *r7, *r0
+red *r4
+not L33
+clr r6
+jmp L91
+dec r0
+jmp L42
+not r5
+prn #-256
+rts
+bne L35
+not *r1
+prn r0
+sub L28, r5
+L46: .data 677, -93, -119
+mov r1, *r6
+clr *r7
+lea L224, L129
+add r4, r5
+rts
+
+
+red r4
+L47: add r5, r0
+L48: jsr L5
+L49: .string "sva"
+jsr L1
+prn r6
+red *r4
+jsr *r3
+jsr L1
+red L48
+L50: clr L9
+lea L159, *r2
+red *r5
+cmp #7, L32
+mov r2, r1
+add *r0, *r4
+L51: mov *r1, r3
+L52: not L79
+L53: stop
+jmp *r3
+lea L45, *r1
+jmp L63
+
+inc r0
+bne *r5
+prn L36
+lea L43, L237
+rts
+L54: .data 475, 522
+dec *r2
+L55: sub r7, r3
+prn #124
+jsr L87
+jsr L232
+jmp L0
+dec r4
+L56: dec r7
+L57: jsr *r5
+mov *r4, *r2
+not L6
+clr L53
+
+; comment
+not *r2
+
+L58: clr *r1
+stop
+bne *r4
+dec L28
+lea L44, L232
+add L167, *r5
+not L3
+jmp *r3
+jmp L32
+mov L74, *r6
+not L8
+mov #-32, r1
+jmp L50
+prn L130
+rts
+L59: dec *r0
+L60: .string "ktitwjrb"
+dec r7
+inc L139
+L61: jsr *r6
+L62: red *r1
+bne L9
+red r4
+L63: clr *r6
+L64: not r7
+sub *r6, *r6
+L65: .data 737
+L66: .string "xeb"
+L67: add r1, *r5
+L68: prn #-24
+clr *r1
+not *r5
+not *r2
+jmp *r7
+cmp L38, L122
+L69: add r7, L175
+add #-166, *r5
+clr L43
+red L235
+; comment
+rts
+mov #135, *r5
+jsr L111
+lea L20, *r2
+L70: .data 583, -145, -423, 510, 468, 455, -684
+add L61, *r0
+clr r3
+sub r1, *r5
+L71: jsr *r2
+red r6
+not r7
+mov *r3, r1
+add *r4, *r4
+L72: inc L159
+prn *r1
+rts
+L73: sub L146, *r0
+jsr *r5
+add *r2, L125
+not r7
+L74: .data 419, -203, -513, 263, -636, 644
+inc r4
+bne *r1
+L75: rts
+sub #-28, *r2
+jsr *r2
+mov r7, *r6
+L76: red *r7
+L77: mov L20, r4
+dec r1
+inc L75
+add L42, *r1
+
+inc L209
+prn r5
+L78: .string "z"
+prn L145
+red r2
+L79: jsr L108
+L80: .data 900, 230, 215, -3, -619, 32, -333
+L81: .data 879, 47, -346, 766
+L82: red *r0
+add #-81, *r2
+; comment
+L83: prn *r5
+lea L69, r5
+L84: .string "cmmnytczgzpdljwvtn"
+L85: add r5, L35
+L86: cmp L22, r7
+lea L211, r1
+L87: .data -739, -41
+L88: not r7
+
+inc *r7
+jsr *r7
+L89: cmp *r5, #246
+lea L152, r3
+
+not r0
+mov L128, *r1
+rts
+cmp *r4, L96
+bne *r2
+sub *r5, *r1
+jsr L13
+rts
+L90: inc L243
+L91: sub L160, L216
+red r1
+cmp r5, r2
+dec r6
+red *r3
+prn r2
+L92: red *r4
+L93: jmp L23
+jmp *r2
+add r0, L161
+L94: .data 669, -791, 939, -497, 623
+stop
+jsr *r2
+; comment
+stop
+L95: jsr *r0
+dec r2
+sub #-31, *r2
+L96: cmp r7, *r3
+not L37
+L97: not *r7
+L98: inc r0
+lea L17, *r4
+L99: .string "wxbfuvaudtiyrnum"
+red r7
+not L202
+lea L177, L98
+cmp r4, r3
+cmp *r7, L208
+L100: add *r6, L211
+lea L230, L27
+L101: dec r6
+cmp *r1, #-234
+
+jmp *r1
+add *r1, r6
+
+mov #-64, *r4
+cmp r1, r6
+L102: jsr *r2
+L103: prn *r3
+prn #58
+L104: .string "wykbxredzfjtebd"
+bne L126
+inc L77
+jmp L95
+red r5
+L105: jmp *r1
+rts
+jsr *r0
+rts
+stop
+not L16
+cmp L215, r0
+prn L3
+bne L18
+inc r2
+
+prn L83
+inc r5
+red L185
+L106: .data 109, -956, 23, -261, -568, 286
+jmp L73
+L107: jmp *r7
+L108: red *r7
+
+clr r7
+stop
+add #62, r0
+not r6
+dec r7
+not r7
+jmp L165
+mov L219, L249
+stop
+red r6
+bne L201
+jmp L98
+L109: .string "csqrarrtilwccwdnbem"
+inc *r1
+L110: dec L165
+jmp L49
+sub r1, *r7
+bne L186
+lea L126, *r6
+; comment
+L111: .string "rjiodtaunxjrkwwe"
+lea L12, *r0
+L112: .data -229, 32, -981, 433, -172
+L113: inc *r1
+dec r7
+not L105
+sub L50, r1
+L114: red L57
+red *r3
+cmp #144, L62
+bne L226
+stop
+bne L189
+clr *r1
+L115: .data -22, -915, 633
+mov *r2, r6
+jmp L19
+L116: .string "gqdcbcoebbphg"
+add L84, L63
+L117: lea L152, *r7
+rts
+mov *r2, *r5
+inc L23
+cmp L154, L242
+L118: dec r7
+bne L37
+L119: sub r1, *r4
+L120: .data -18
+cmp L35, r2
+L121: cmp #-34, *r3
+rts
+bne L168
+dec r2
+clr *r1
+L122: prn #-182
+clr *r2
+cmp *r5, L105
+
+inc *r7
+rts
+mov #-112, *r1
+inc *r7
+stop
+cmp L153, r6
+stop
+L123: rts
+; comment
+lea L98, r2
+prn r2
+L124: lea L81, L133
+L125: clr *r0
+jsr *r6
+cmp *r7, *r7
+add #47, *r3
+sub #-70, r6
+L126: clr *r1
+not r2
+sub *r1, r4
+L127: jmp L140
+L128: cmp #49, #-41
+cmp r5, L226
+L129: .data -141, -649, -93
+L130: stop
+L131: .data -687, 570, 135, -6, -611, -101, -227, -379
+L132: lea L85, r0
+jmp L68
+add L113, L48
+not r0
+
+L133: add r7, *r6
+inc r5
+L134: clr r6
+lea L177, *r2
+dec r3
+jmp *r6
+mov *r7, r4
+L135: inc r6
+cmp #54, L199
+L136: prn #152
+clr L83
+inc r3
+L137: .string "kggrpnlgayszncbtzn"
+cmp #92, L82
+inc *r7
+add #-208, L247
+
+prn *r4
+sub #-118, r7
+jsr L19
+L138: jmp L250
+; comment
+dec r5
+not *r4
+jsr L27
+L139: inc L17
+rts
+red *r0
+lea L217, *r7
+jmp L0
+rts
+bne *r6
+mov #144, r1
+mov L105, r5
+cmp #-94, *r1
+stop
+L140: prn #253
+red L146
+clr *r0
+not L14
+
+L141: .string "qwakwxsjjrvrif"
+bne *r5
+bne L158
+L142: .data -594, 957
+lea L39, *r0
+L143: .data -945, -520, -213, 382, 355
+inc L86
+not *r2
+L144: .string "lw"
+cmp #-34, r2
+jmp *r4
+prn r4
+L145: .string "abzzghbtbf"
+rts
+jsr *r0
+L146: clr r5
+prn *r1
+jsr L20
+prn #-200
+red L69
+stop
+sub r4, r7
+L147: red *r1
+cmp r7, L211
+clr r2
+L148: .string "ijpmquebukorp"
+inc L126
+sub L226, r3
+L149: .string "msy"
+bne L19
+lea L99, L243
+L150: .data 767, -838, -199, -87, 516
+; comment
+rts
+dec L3
+L151: jmp *r3
+rts
+L152: sub r6, r1
+cmp *r3, *r4
+sub r0, r7
+lea L241, r7
+L153: .string "tnzucrvomunzbzwtocqti"
+L154: stop
+L155: mov #-107, L107
+L156: .string "vxzvahrwuhfcgmocixfk"
+L157: .data -906, 953, -249, -559, -236, -653, -818
+stop
+inc L128
+not *r1
+cmp #71, L71
+L158: mov L208, r0
+lea L21, r1
+
+jsr L197
+stop
+; comment
+L159: .data -934, 771, -903, 606, -970
+not *r0
+bne *r4
+jsr L244
+lea L243, L229
+L160: .string "kkjprupriy"
+dec L200
+lea L236, *r4
+
+add *r4, *r5
+bne *r6
+cmp *r1, #-94
+add #208, r7
+L161: clr *r0
+stop
+jmp *r3
+L162: .data -841, 55, -712
+inc L169
+sub *r1, L224
+bne L18
+jsr L14
+bne *r5
+L163: dec L223
+
+L164: jsr L205
+stop
+stop
+inc r2
+L165: .string "kfcgnjoochpfirsbh"
+L166: jmp L174
+bne *r6
+lea L203, *r0
+
+jmp L122
+bne L63
+L167: cmp *r2, *r2
+L168: prn r0
+add r0, r3
+not *r7
+add r2, r2
+stop
+L169: .data 802, 113, -103, 660, 647, -543, -828, 140
+bne *r3
+L170: .string "zxfbypctcptzmsypjgt"
+L171: .data 871, -202, -873, 104
+dec r5
+jmp L199
+inc *r5
+L172: .data 974, -28, 838, -452
+dec L59
+L173: .data 227, 312
+L174: .string "xjzfugnxkmch"
+sub L233, L206
+stop
+add #-228, *r1
+rts
+clr r7
+add *r5, *r4
+stop
+L175: rts
+sub L3, L74
+L176: .string "urkmxt"
+L177: sub *r2, *r0
+red L136
+cmp L126, L163
+jsr *r4
+sub L98, L166
+L178: jsr *r5
+L179: .data -546, -916
+not *r2
+rts
+bne L200
+lea L245, L233
+L180: .string "lizktoejgtwrxoe"
+inc r3
+not L223
+jmp L225
+inc L208
+L181: rts
+L182: rts
+rts
+bne *r1
+L183: .string "dcicvgoxvjadxelj"
+L184: .string "xyxiw"
+jsr *r0
+clr *r5
+cmp L63, r7
+lea L53, r0
+sub r0, *r0
+sub #156, r6
+add *r0, *r0
+prn *r5
+L185: .string "zhsxrkkjcnnrzmgzqbvh"
+red r6
+L186: not *r3
+not *r6
+clr *r3
+mov #-119, r2
+not L206
+red L180
+mov L214, r6
+L187: prn #63
+stop
+L188: stop
+L189: cmp L29, r3
+bne *r5
+add *r5, r7
+L190: red r6
+jmp *r2
+add r3, L58
+mov #-137, L200
+rts
+not *r3
+jsr L58
+prn #-162
+L191: .string "ioppbmplbiuagxtha"
+not L172
+
+L192: .data 260, 334, -540, -444, -376, 357
+L193: .data 318, -921, -859, 679, 134
+add L208, L47
+red *r2
+L194: stop
+red r6
+L195: .data -469, -654, -738, 544, -201
+L196: inc L99
+jsr *r4
+; comment
+stop
+stop
+L197: jsr L157
+jmp L229
+prn L111
+jmp *r5
+rts
+dec r1
+stop
+not L181
+add #128, r0
+clr L250
+not L216
+; comment
+add r3, L130
+L198: .data -315, -624, -444
+lea L2, r7
+clr *r3
+not r3
+cmp r1, r6
+L199: .string "ymfvwzxjpjwejfwfyijcvpoo"
+L200: .data 813, 183
+clr L142
+bne *r4
+lea L207, r0
+; comment
+L201: red r2
+red *r3
+clr *r6
+dec *r7
+red r7
+not *r6
+not L214
+stop
+jmp L249
+L202: .string "pfbyijbra"
+dec r0
+L203: .data 323, -789, 413, -710, -950, 63, -758, -173
+bne *r5
+rts
+dec L170
+L204: .data 496, 352, -813, 806, 835, 377
+dec L223
+L205: sub *r2, L178
+L206: .data 448, -229, 839, 759, 369, 143, 917, 463
+sub r1, *r2
+L207: rts
+L208: prn #-137
+add r2, L241
+L209: .string "cgszxqwhtcyvaizbjnbjld"
+rts
+L210: .data 404, 93, 625
+dec *r7
+dec *r3
+bne L199
+prn r1
+clr *r5
+; comment
+stop
+bne *r0
+inc *r1
+add *r2, L167
+L211: stop
+sub r2, r0
+jmp *r5
+bne *r0
+add L50, *r3
+jmp L232
+L212: cmp *r4, #-92
+bne L82
+bne *r2
+clr L228
+red *r4
+not L141
+clr r3
+not r2
+bne L213
+lea L58, *r6
+not r5
+dec L132
+L213: .string "dddvopxe"
+L214: dec *r3
+sub r3, r4
+bne L152
+sub *r1, r4
+lea L34, *r0
+clr r0
+jsr *r3
+mov r3, *r0
+L215: .data -373, 442, -542, -371, -751, 351, 621
+red *r5
+L216: lea L244, *r4
+red L24
+add *r5, *r3
+
+sub *r6, *r4
+lea L53, r1
+bne *r4
+lea L218, *r0
+L217: lea L237, r4
+rts
+clr L236
+L218: .string "cgbvut"
+; comment
+inc *r2
+clr *r7
+cmp *r6, L252
+red r1
+cmp *r1, #36
+inc r1
+stop
+lea L124, *r7
+not L187
+L219: inc r5
+stop
+L220: .data -993, -521, 747, 575, 993
+clr r6
+add r0, *r3
+jmp L86
+inc r5
+jmp *r6
+L221: .string "znwvbipszxhq"
+red *r3
+add #149, *r1
+prn *r3
+; comment
+jmp L25
+not L156
+jsr *r7
+not *r4
+L222: dec L67
+; comment
+L223: jsr L244
+L224: .string "aspbn"
+bne L38
+dec *r4
+jsr *r4
+L225: bne *r2
+L226: .data -119, 233, 205, -950, 17, -683, -332
+cmp *r5, L250
+stop
+sub L245, r2
+L227: lea L127, *r1
+bne L3
+rts
+L228: clr r4
+prn L174
+jmp L240
+jsr *r3
+jsr *r2
+lea L38, L241
+red r5
+inc r5
+bne L187
+lea L133, L206
+mov L235, L84
+stop
+L229: .data -279, 563, -757, 633, -357, 183, -432
+cmp r0, r0
+jmp *r6
+L230: bne L244
+not *r7
+stop
+jsr *r4
+rts
+; comment
+mov *r3, *r2
+clr *r6
+prn L180
+mov r5, *r5
+rts
+L231: prn *r5
+; comment
+L232: jsr L240
+L233: .data -483, 70, -335
+rts
+jmp *r5
+mov r0, L249
+stop
+jmp *r6
+jsr L240
+L234: .data -181, -533, -715, -259, -257, -585, 994
+mov #64, r4
+dec r6
+L235: lea L248, L251
+L236: .string "rapdry"
+not L237
+not *r6
+inc L233
+L237: .string "bqwbxpnmxbqatomccogxgi"
+L238: bne L248
+L239: .data 656, 789, 86, -500, -108
+clr *r7
+sub r3, *r3
+L240: .string "wpqtmbuaiqexajuqae"
+prn #-210
+not r5
+; comment
+dec r1
+L241: .data 787, 265, 664, 676
+stop
+jmp *r2
+add L247, L249
+add r5, *r1
+dec r4
+sub *r2, L83
+lea L242, *r5
+lea L249, r7
+jmp L100
+L242: mov *r0, L250
+cmp #15, L243
+
+L243: jmp *r0
+jsr *r5
+inc r0
+rts
+sub *r1, *r4
+mov #-187, r7
+prn #254
+L244: stop
+L245: dec *r1
+inc L82
+L246: inc L252
+L247: .data -447, 746, -452
+dec r0
+rts
+add #71, r2
+prn *r3
+dec *r7
+L248: sub *r4, r3
+dec *r2
+bne L252
+red *r7
+bne *r0
+bne L143
+jmp *r5
+L249: cmp #-133, L74
+jsr *r4
+stop
+red *r2
+not *r6
+not r5
+red L32
+cmp *r0, L12
+L250: inc L251
+red *r6
+red *r1
+; comment
+bne *r6
+prn #217
+clr L252
+dec r7
+rts
+L251: rts
+
+sub L58, *r0
+cmp *r3, r7
+jmp L252
+jmp *r0
+inc L252
+L252: .data -602, 817, -34, -43, 253, -178, -51, 589
+add *r4, *r1
+red L157
+jsr *r1
+add L160, L174
+inc L143
+clr L216
+stop
@@ -0,0 +1,1020 @@
+; Generated by genCorpus --seed 18
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+inc *r1
+L0: .string "yjilexqsymnfbwynxw"
+sub #-152, r7
+inc *r6
+jsr L30
+jmp L37
+jmp L0
+L1: .string "gcqlibhodre"
+sub r0, r2
+clr L43
+stop
+not r7
+mov #-148, *r4
+jsr *r0
+stop
+add *r2, *r3
+inc *r2
+lea L0, L0
+not L0
+prn L101
+rts
+not L0
+mov r6, *r2
+add r2, r2
+bne *r5
+clr r7
+dec r7
+
+add L0, r1
+inc *r4
+prn #-191
+L2: prn L1
+lea L2, L0
+lea L1, L197
+L3: lea L149, *r2
+prn r4
+L4: .string "nzewzmusp"
+L5: not *r0
+cmp L195, r6
+lea L4, *r0
+L6: .string "rqunsxwu"
+L7: jmp *r1
+jmp *r5
+inc r5
+inc r5
+L8: .string "sfnkkpppohsgokqfpmznocxp"
+L9: bne L7
+mov r6, r5
+jmp *r4
+dec L1
+stop
+sub L7, L3
+L10: lea L4, *r6
+inc *r3
+L11: clr r1
+dec L11
+L12: red r2
+L13: sub #75, *r5
+cmp #207, *r2
+add L9, *r6
+rts
+L14: jmp L3
+L15: .data -667
+inc r2
+bne *r4
+stop
+red r7
+
+red *r5
+jmp L0
+cmp *r7, *r6
+L16: prn #179
+L17: lea L40, r1
+dec L11
+mov *r3, L108
+L18: jsr L219
+lea L1, r5
+rts
+L19: jsr L6
+L20: jmp *r6
+jmp *r1
+red r7
+clr *r2
+L21: stop
+L22: cmp *r5, *r1
+clr r5
+L23: stop
+lea L196, L281
+L24: not r7
+; comment
+L25: .string "lflrfzjo"
+L26: rts
+rts
+sub *r1, *r6
+inc L270
+sub L88, r4
+L27: inc r4
+cmp L8, *r5
+jsr *r0
+clr L6
+jmp *r0
+dec r2
+rts
+
+clr L24
+L28: bne *r0
+bne L10
+dec r1
+rts
+stop
+add r1, L81
+L29: inc *r2
+L30: rts
+bne L7
+dec L215
+inc r7
+add #-30, r6
+jsr L43
+prn r5
+sub *r2, *r3
+add *r2, r1
+clr *r2
+inc L160
+L31: prn L23
+stop
+jsr *r0
+mov r4, L12
+jsr *r3
+dec *r5
+red *r6
+red r1
+prn L39
+cmp r4, L64
+jsr L9
+inc *r0
+mov *r5, L124
+not r7
+cmp L42, *r1
+L32: sub L212, r0
+prn L17
+
+bne *r4
+prn L20
+dec L30
+prn L163
+stop
+L33: lea L1, r2
+rts
+lea L109, L243
+inc *r1
+sub #198, L24
+L34: jmp *r3
+bne *r2
+not *r0
+clr *r3
+jmp L246
+jsr *r7
+red L224
+red *r7
+rts
+L35: inc r7
+cmp L0, #-255
+L36: .data -854, 812, -236
+stop
+bne L11
+not r3
+prn r7
+lea L27, L265
+sub r7, *r4
+cmp #-254, L8
+
+mov L2, r2
+L37: lea L182, r2
+red r3
+stop
+
+L38: stop
+L39: .string "jlfexzcitmvkohwr"
+L40: inc *r6
+not L9
+red L12
+cmp *r3, *r6
+clr L0
+; comment
+bne L1
+inc r5
+L41: prn #-185
+lea L17, r4
+red *r1
+cmp L132, r5
+inc L36
+L42: .data -693, -7
+clr *r6
+L43: .data 104, 431, 916, -382
+lea L273, *r4
+L44: prn *r1
+jsr *r0
+jmp *r4
+L45: .string "wkjkcaget"
+not *r4
+add #-237, *r5
+jsr *r4
+L46: not r0
+dec L249
+L47: .data -837, 563, -325
+inc r3
+sub #14, r5
+L48: clr *r2
+L49: bne *r4
+not L41
+sub *r6, r2
+mov L99, r6
+rts
+L50: .data -425, -959, -369, -431, 786, -993
+L51: jsr L154
+sub #-150, r5
+dec L207
+clr *r5
+L52: jsr L262
+stop
+bne *r4
+; comment
+cmp L9, L44
+lea L45, *r1
+L53: .data -820, -163, 641
+inc *r5
+add #-118, r6
+L54: dec r4
+bne L160
+prn #-222
+L55: .string "jeackbdwudzbscnkvp"
+L56: add *r2, r1
+dec L25
+L57: .string "v"
+jmp *r5
+cmp *r4, L199
+bne *r1
+lea L19, r0
+not L22
+
+stop
+add *r5, r3
+sub L36, r1
+rts
+rts
+
+L58: lea L47, r7
+jmp *r4
+prn #81
+L59: prn *r5
+jmp L90
+L60: red L195
+not L49
+L61: cmp *r3, *r4
+L62: .data 953, 467, 212, -159, -730, -192, 766, 17
+L63: inc r3
+L64: rts
+prn L69
+; comment
+bne *r7
+sub L171, L32
+L65: .data 400, 870, 726, 979, -413
+L66: add #-87, r2
+jmp *r5
+stop
+sub r2, *r4
+add r1, r3
+L67: sub #151, r6
+jsr L18
+L68: mov *r1, L86
+lea L242, *r0
+; comment
+cmp #188, #-215
+clr L112
+L69: dec L194
+dec r5
+L70: .string "gfbtfjyoaxwzbhkeuzrimk"
+cmp r4, r7
+inc L101
+L71: .string "llnqkpnglfghvk"
+lea L161, r2
+L72: .string "mrvquhetgroxarsguf"
+
+L73: bne L171
+jmp *r7
+sub #-162, r0
+L74: .string "ozwwbewaqudhldarnirouici"
+; comment
+prn *r7
+L75: lea L240, *r3
+rts
+red r6
+bne L14
+prn L212
+jsr *r1
+lea L160, L202
+not L44
+prn #214
+L76: lea L40, L272
+clr *r3
+cmp r5, r5
+red r4
+jsr *r5
+jmp *r6
+add *r5, L47
+L77: .string "hwjcpbip"
+stop
+rts
+red *r3
+L78: red L139
+bne L18
+sub *r6, *r4
+
+jmp *r4
+red r4
+rts
+jmp L194
+L79: .data 921, 408, -699, -647, -534, 387, 629, 99
+L80: cmp *r0, *r2
+stop
+not r7
+dec r4
+L81: .data 15, -979, 862, -633, 377, 242, 728, -59
+L82: prn L126
+add #-251, L263
+lea L245, *r6
+dec L235
+; comment
+jsr L27
+not *r7
+stop
+jmp *r0
+dec L107
+clr r5
+inc L173
+L83: .string "feeizqhfydjec"
+L84: .data 757, -762, 996, 108, 250
+jsr *r7
+L85: .string "dobmknfa"
+lea L9, *r4
+L86: .string "u"
+add *r2, r5
+red *r6
+L87: not *r0
+dec r2
+L88: .data -40, -292, -941, 798, -832, -222
+L89: red L10
+stop
+L90: .string "q"
+L91: red L85
+L92: .string "yipbuiupzdxae"
+rts
+L93: rts
+bne L185
+not *r4
+rts
+not *r0
+mov #106, r4
+jmp *r3
+L94: cmp *r0, #-226
+L95: jsr L90
+inc *r0
+L96: .string "tmmdcvfwtoxjclcxmv"
+rts
+L97: clr *r3
+inc *r2
+
+L98: .data -766, -535, 970, -58, 744, 963, -197
+clr *r0
+stop
+prn #-213
+dec L94
+L99: jmp *r2
+; comment
+bne L27
+cmp r1, r6
+inc r4
+lea L265, r0
+L100: .data 269, -700, 303, -491, -608
+inc *r2
+L101: prn #-88
+cmp L63, *r6
+bne L56
+jsr *r1
+add r3, r3
+jsr L156
+L102: add r1, *r5
+sub *r4, *r6
+L103: jsr *r0
+prn *r5
+prn #-41
+L104: inc L232
+L105: rts
+mov L65, r7
+L106: .data 811, 748
+jsr L89
+clr L23
+L107: mov *r6, *r7
+lea L65, L121
+dec *r7
+L108: .data -346, -376, -116, -6, -525, 863
+L109: bne L25
+sub *r5, r5
+add *r1, L129
+add L3, *r2
+lea L218, *r1
+L110: .string "hcopnzsnxup"
+L111: bne *r3
+L112: .string "ovpeeoooottkutpg"
+clr *r0
+lea L267, *r0
+L113: clr r2
+rts
+jsr *r5
+clr r3
+L114: prn r7
+lea L237, *r0
+; comment
+red r7
+cmp r6, #253
+cmp #185, #-90
+clr *r0
+rts
+sub r4, L169
+rts
+bne L228
+L115: rts
+lea L82, r4
+not L267
+cmp r3, L0
+rts
+mov #-191, L140
+
+dec L52
+prn r2
+cmp L71, *r5
+sub #-137, L265
+add *r6, r0
+prn r7
+
+stop
+L116: .string "iloyixsl"
+jsr L14
+L117: .data -528, -972, 0, -580, 436
+lea L163, r3
+mov #-58, *r7
+bne L57
+red *r0
+mov *r3, r1
+inc r2
+dec r4
+dec *r1
+L118: jmp L273
+L119: jsr *r6
+L120: dec L164
+sub L24, *r1
+red *r6
+L121: clr L84
+L122: prn r7
+bne *r6
+lea L132, r5
+dec L77
+inc L87
+
+stop
+jsr *r1
+L123: .string "efh"
+jmp *r2
+jsr L44
+stop
+L124: mov *r1, *r3
+mov L118, *r3
+not *r2
+L125: .string "lvdayxapkeicqqxdalill"
+jsr *r5
+jsr *r2
+cmp r7, *r5
+cmp r3, #-200
+L126: .data 821, 282, -682, 43, 615, -692, 682, 993
+red L206
+cmp r3, #148
+not *r4
+L127: add L68, r5
+mov *r2, *r7
+jmp *r3
+mov #10, *r2
+jsr *r0
+lea L183, *r1
+clr r0
+L128: stop
+L129: .string "oegqndfsuqpohvu"
+L130: .data 114, 859
+rts
+rts
+L131: red *r6
+jmp L42
+bne *r0
+prn r6
+prn *r0
+sub r3, *r4
+L132: .data 876, 736, 476, -138
+lea L170, L257
+red L2
+prn #-31
+bne *r7
+sub #-34, r7
+L133: sub #72, L230
+L134: add L52, *r4
+L135: .data -868
+not L151
+
+add #-239, r1
+jmp *r3
+prn #-12
+jsr L70
+L136: .string "hqrjego"
+sub r3, r5
+
+sub #-15, L222
+L137: jsr *r1
+L138: jsr L43
+clr r1
+L139: dec L78
+lea L48, L133
+inc L92
+inc r1
+L140: dec *r6
+L141: .string "hqiat"
+not r5
+mov L73, L218
+jmp L185
+inc r0
+stop
+dec L206
+jmp L131
+add *r3, r1
+inc L41
+mov #156, L122
+L142: lea L162, *r7
+clr *r2
+stop
+L143: stop
+sub #-166, r1
+bne L34
+inc L264
+L144: .string "hxsl"
+jsr L135
+L145: .data -59
+bne *r3
+rts
+not L11
+stop
+L146: inc r6
+jmp L100
+stop
+L147: sub L89, *r4
+not r7
+lea L87, r4
+
+L148: prn #132
+add *r5, L214
+jmp *r2
+sub r7, L80
+L149: stop
+add #-38, *r4
+inc r3
+mov #75, *r4
+L150: jsr *r4
+L151: red r2
+L152: .data -265, -434, -304, 825, 289, 824, 735
+dec r6
+L153: .data 690
+inc *r5
+clr *r3
+L154: not L276
+bne L13
+L155: rts
+L156: .string "bbmgqmxero"
+stop
+stop
+L157: .data 620, 215, -411, -551
+mov *r3, r4
+stop
+lea L110, r4
+jmp L154
+L158: .data -980, -889, -960, 736
+L159: prn *r4
+cmp r2, r1
+jsr *r0
+jmp L61
+bne *r6
+jmp L193
+add r1, r3
+mov *r5, L9
+dec L169
+L160: .string "fkxidrtuj"
+L161: lea L4, *r5
+L162: clr r7
+cmp r7, *r5
+inc *r2
+add r1, L244
+lea L99, r5
+jsr L127
+add L149, r2
+lea L130, L199
+sub L263, r5
+rts
+mov r2, r6
+add #-96, *r1
+prn L182
+not *r1
+not L202
+L163: rts
+jmp L232
+L164: .string "rhhiljlzwhfphns"
+L165: .data -147, -820, 223, -91
+lea L195, r2
+cmp #125, #-8
+rts
+L166: .string "dbbvvrismndno"
+rts
+jsr *r0
+jsr L265
+red *r5
+jmp L170
+inc r5
+dec L184
+not L15
+sub L29, r5
+red r3
+L167: jmp *r3
+; comment
+prn L258
+
+L168: .data 672, 178, -745, 384, 938, 384
+clr r5
+not *r3
+L169: stop
+clr r2
+lea L232, r7
+add r7, r1
+jsr *r6
+prn L73
+mov *r1, r4
+L170: .data 260, 144, -373, -537, 23, -125
+prn #241
+L171: rts
+cmp #174, *r3
+L172: inc r4
+not r4
+cmp r5, #249
+not r4
+L173: clr *r0
+red *r1
+not *r7
+clr r1
+add *r1, *r4
+clr *r4
+red *r7
+L174: .data -816, -487, -804, -19, 483
+jsr L229
+dec *r5
+red r3
+mov r1, L89
+L175: sub r6, L66
+L176: not L188
+not r1
+L177: .string "bbibolglpbedaosqll"
+stop
+jmp *r4
+clr r4
+add L93, L40
+dec r1
+lea L195, r4
+; comment
+not L108
+L178: lea L241, r6
+jsr L107
+add *r0, *r4
+L179: .string "wqaxkqgk"
+lea L56, r0
+clr r1
+not *r1
+prn #-237
+jmp *r3
+
+stop
+mov L173, L272
+mov r2, r3
+bne *r2
+L180: not L16
+; comment
+jmp *r7
+cmp #123, L24
+L181: .data 102
+cmp #-97, L37
+L182: inc L63
+dec r2
+L183: stop
+L184: jsr *r3
+; comment
+L185: .string "tzuhhknalqlky"
+rts
+L186: lea L91, *r4
+L187: red r0
+red L255
+L188: mov #34, L239
+cmp L243, L209
+rts
+inc *r3
+L189: .string "okgzeia"
+bne *r2
+
+L190: lea L30, r1
+bne L235
+lea L51, r4
+L191: cmp L184, *r7
+L192: dec L34
+cmp r7, *r6
+jmp *r5
+L193: jmp *r5
+red *r4
+L194: not *r4
+jmp *r3
+dec r2
+L195: add #207, r0
+lea L260, *r5
+prn L104
+jmp *r2
+cmp r7, #-151
+stop
+jsr *r4
+L196: not *r7
+L197: add L236, L218
+L198: mov r6, L151
+inc *r3
+inc L195
+prn L217
+sub #-185, *r4
+stop
+mov r7, r2
+L199: bne L29
+L200: add *r0, *r1
+L201: stop
+L202: lea L106, *r5
+lea L279, L133
+add *r6, *r6
+L203: .data -330, -836
+inc L79
+sub *r5, r2
+
+add *r0, *r5
+clr L83
+L204: .data -101, -730, -987, -299, 320, 25, -476, -692
+jmp *r4
+inc r2
+inc r6
+
+red r1
+dec L103
+not L218
+cmp r2, #-102
+add L183, *r0
+L205: dec L142
+L206: mov #-193, L234
+L207: red L258
+add r4, *r3
+clr *r0
+L208: inc r4
+L209: .data 370, -907, 940
+
+dec *r3
+clr L278
+dec r4
+jmp L53
+L210: prn *r6
+L211: mov #100, *r5
+not *r1
+rts
+L212: .data -858, -158, 656, -158, 100
+L213: .data -369, -270, 76, -498, 629, 422
+mov *r1, L102
+L214: .string "hviybsbwyzpljyw"
+cmp r3, #105
+cmp r3, *r2
+jmp L0
+L215: not L6
+add r0, r7
+dec L237
+inc r0
+L216: .data 265, 407, -203, 342, -784, -309, 758, 1
+prn *r6
+L217: .data -459, 603, 608, 155, 549, 238
+L218: prn *r4
+stop
+red L32
+mov L198, r7
+L219: prn r7
+L220: .data 128, 71, -78
+clr *r1
+mov #44, L234
+mov r3, r7
+rts
+clr r6
+sub r2, L256
+prn #-157
+mov *r3, L231
+bne *r2
+L221: stop
+inc L128
+add r6, L109
+mov #-182, *r7
+cmp r6, *r1
+red L245
+prn L51
+rts
+not r5
+L222: not *r2
+L223: .string "wsutj"
+; comment
+dec r7
+L224: sub #7, L279
+L225: rts
+rts
+jsr L112
+clr L13
+sub *r3, r4
+sub L58, *r4
+mov *r2, L237
+inc r2
+red L112
+prn #38
+L226: add #187, *r2
+rts
+
+cmp r1, r1
+
+cmp r2, L268
+jsr *r5
+prn L227
+cmp #-162, r2
+clr r5
+add #31, L271
+prn r4
+L227: add L234, L73
+add r1, *r4
+sub L143, L115
+bne *r5
+not *r3
+; comment
+clr L275
+clr L260
+L228: .string "artxadssvztfmtczedqdpnoi"
+; comment
+L229: sub r2, r4
+bne *r0
+L230: bne *r2
+lea L253, L149
+L231: rts
+L232: .data -275, -798, 630
+clr L277
+jsr L256
+clr L176
+L233: .string "fu"
+; comment
+; comment
+L234: mov *r1, r4
+jsr L270
+jsr *r3
+L235: dec L256
+
+cmp #-186, r0
+L236: dec *r1
+add #-69, L248
+rts
+jmp *r1
+red *r4
+L237: inc r6
+L238: prn *r5
+L239: .data -582, -244, 235
+clr L266
+bne L15
+clr *r7
+L240: mov r4, r4
+dec r2
+inc *r5
+not L217
+L241: lea L258, *r6
+sub r2, r5
+lea L62, *r5
+lea L269, *r2
+cmp L275, #-139
+
+red *r0
+prn r0
+mov r0, r2
+not *r0
+not *r6
+L242: add L269, r1
+prn r1
+L243: inc r4
+add *r1, *r4
+L244: add r0, r3
+L245: bne L133
+L246: red L242
+L247: .data 135, -872, 288, -475
+L248: .data 99
+jmp L16
+add *r5, r6
+L249: red r5
+add *r6, L273
+; comment
+L250: bne L55
+rts
+L251: stop
+inc L207
+L252: not *r6
+red L226
+jmp *r5
+lea L269, L281
+L253: mov r5, L75
+sub r0, L162
+cmp r3, r6
+dec *r1
+not *r2
+prn L275
+sub r0, r1
+jsr L264
+add L260, r0
+sub *r7, *r4
+L254: cmp #156, #-219
+L255: bne L228
+jsr *r2
+L256: bne L272
+sub r3, L221
+L257: lea L235, r6
+L258: rts
+jsr L167
+L259: .string "xnvnzgzncwfmyjhfywordk"
+sub #224, L170
+clr *r6
+L260: cmp #-119, #41
+red r7
+prn r4
+L261: mov r0, r0
+mov L96, r6
+
+add L167, r3
+red *r0
+stop
+red L93
+mov L16, L2
+L262: lea L281, L281
+clr r2
+L263: clr r4
+L264: not L171
+inc L188
+cmp L266, #-96
+L265: lea L220, L272
+L266: lea L273, *r1
+inc L193
+clr L274
+dec L273
+L267: .string "rndiffyhlrfb"
+jsr L273
+L268: stop
+bne L14
+L269: cmp L271, #-159
+prn L198
+stop
+L270: sub r2, r7
+L271: prn L275
+red L274
+clr L280
+L272: .string "ckefmsmoexznqlodyzuo"
+L273: add #-66, *r5
+dec *r4
+mov *r3, L276
+L274: .data 161, -812, -44, -450, -973, -614, -468
+jsr *r0
+dec L43
+red r3
+red L72
+mov L279, r0
+sub r1, r2
+L275: red r3
+dec r5
+L276: mov r0, L211
+add L52, r6
+lea L103, L154
+L277: prn *r6
+L278: jmp *r0
+L279: .data -221, 2, 802
+not r0
+L280: lea L218, r7
+add *r3, r2
+L281: jmp *r6
+jsr L243
+rts
+bne *r7
+stop
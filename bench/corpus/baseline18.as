@@ -0,0 +1,1020 @@
+; Generated by genCorpus --seed 19
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+dec r1
+jsr *r5
+cmp #4, #-227
+not *r1
+L0: red *r2
+L1: stop
+L2: .data 542, 981, 691
+sub L2, r5
+; comment
+stop
+stop
+L3: prn L3
+add #5, L0
+dec L0
+stop
+jsr L39
+L4: prn *r3
+mov r7, L0
+L5: add #-64, L130
+add r1, L215
+L6: .string "kblrp"
+add L152, r4
+L7: not *r3
+add L3, *r4
+red r1
+not L112
+dec L115
+L8: dec *r3
+L9: prn *r5
+; comment
+rts
+cmp *r1, *r7
+dec r2
+jsr L184
+jmp L2
+; comment
+red *r0
+red r6
+red r0
+dec L9
+stop
+jmp L4
+not r5
+jsr L3
+cmp *r4, r5
+jsr *r6
+L10: .data 195, 957, -735, -782, 814, -282, 650, 926
+L11: dec r5
+dec *r6
+stop
+stop
+jsr *r4
+L12: prn *r4
+not *r1
+L13: inc *r4
+clr r4
+prn #-172
+clr r7
+L14: inc L247
+inc *r1
+L15: bne L245
+L16: red r4
+L17: dec r2
+dec L3
+sub L60, r0
+L18: .data -149, 114, 277, -505, -766, 529, -751
+stop
+stop
+bne L1
+L19: .data -438, -549, 388, 189, -587
+mov *r4, L6
+
+red *r5
+stop
+L20: dec r2
+stop
+L21: .data 431, 390, -804, 864, -264, -678, 986
+jmp *r7
+clr r0
+L22: red r3
+inc *r5
+add #26, L22
+cmp r6, r5
+sub #-132, *r0
+add L11, *r1
+L23: bne *r3
+L24: .string "qaaoidrlhihcy"
+rts
+rts
+stop
+jmp L60
+L25: .data 874, -192, -484, 440, -769, -5
+jmp *r4
+L26: clr r3
+mov *r0, *r7
+L27: .data -490, 971, 879, 964, 134, 35
+L28: .data -733, -978, -366, -79, -173, 48, -623
+lea L22, r4
+L29: prn #-251
+sub *r6, L21
+add L26, r4
+L30: bne L111
+add *r5, L181
+L31: .string "oyovbxvix"
+L32: jmp *r7
+mov #143, *r3
+jmp *r0
+add r0, r6
+
+red r5
+lea L12, *r7
+jmp L6
+L33: sub #-133, L5
+
+not r1
+dec r1
+L34: mov *r2, r1
+
+add r7, *r7
+L35: jmp L2
+dec *r3
+add r3, *r4
+red *r0
+rts
+clr L203
+jsr *r3
+L36: .string "j"
+L37: .data 372, 898
+red L29
+not L14
+red L8
+clr r7
+clr *r4
+L38: .string "zlkcssiapnng"
+prn #21
+clr r1
+L39: red *r2
+jsr L244
+jmp L108
+dec L15
+cmp L26, *r7
+clr L230
+dec L156
+dec L1
+; comment
+cmp r4, L201
+L40: .data -235, 260, -128, 847, -514
+add #-206, r0
+jmp *r1
+clr r7
+rts
+L41: jmp L216
+L42: prn #-204
+add r2, r6
+rts
+L43: jmp *r1
+; comment
+mov #143, L22
+mov *r2, r5
+red *r5
+inc *r7
+L44: .string "ajvpumnlygraloixfskd"
+rts
+L45: .data 377, -809, -250, 772, 188
+L46: not L42
+cmp *r4, #-192
+jmp *r5
+L47: inc L14
+; comment
+inc r7
+inc L88
+; comment
+L48: jsr L92
+
+L49: jmp *r1
+L50: .string "oqmwhnznjaaiaqano"
+jsr L49
+jmp L23
+stop
+L51: jsr *r4
+L52: add L64, L91
+add r4, L23
+
+L53: .data 525, -64, 23, 463, 818, 304
+cmp r3, L129
+not r6
+prn r4
+lea L103, L33
+clr r7
+prn *r3
+mov *r3, *r1
+prn *r1
+dec r4
+rts
+stop
+lea L25, L88
+L54: jsr L0
+L55: add *r7, r2
+jsr *r5
+L56: stop
+L57: jmp *r3
+clr L54
+L58: add L149, r5
+L59: lea L14, L203
+bne L41
+sub L18, r0
+prn #-236
+L60: jmp *r6
+stop
+inc r3
+inc r2
+rts
+L61: dec *r2
+cmp #-37, *r2
+stop
+rts
+inc L231
+jsr L35
+cmp L27, r0
+jsr L243
+jmp L211
+L62: stop
+L63: sub #57, *r3
+L64: add r2, L8
+mov L17, L60
+mov r5, L34
+add L127, r3
+dec r5
+sub L96, L57
+red *r2
+cmp L26, L26
+red r7
+lea L26, *r4
+prn #-162
+mov *r2, *r6
+rts
+L65: .string "qhwsybwdwtweuzghtjd"
+dec L86
+rts
+L66: .data -429, 75, 117, -670, -968, 350, -405
+sub #115, r6
+L67: .data -233, -874, -973, -871
+L68: jsr L124
+jmp *r7
+; comment
+jmp L122
+L69: .data 90, 846, 163, 388, -526
+stop
+inc L75
+red *r3
+sub #-239, *r0
+red L23
+lea L63, L220
+not r2
+jsr L47
+lea L203, r7
+L70: cmp *r1, *r6
+stop
+
+; comment
+stop
+stop
+cmp #221, r7
+prn *r5
+dec r0
+stop
+jmp *r5
+jmp L10
+rts
+not L115
+L71: lea L40, *r7
+L72: jmp L231
+clr L199
+not r4
+cmp #-55, *r2
+L73: .string "lrxdspb"
+L74: stop
+L75: dec r1
+rts
+add r5, L54
+
+cmp r7, #-198
+stop
+prn *r5
+mov #-209, L47
+not *r1
+L76: .string "hqdmtpkdxeaflvnqapn"
+L77: .data 152, -866, -969, 432
+cmp L107, #-3
+inc *r5
+bne *r3
+L78: red r7
+L79: clr r6
+sub r0, L51
+jsr L107
+red *r2
+inc *r4
+mov #-99, L186
+inc *r6
+red r7
+dec *r1
+cmp r0, #216
+L80: rts
+stop
+dec L169
+clr *r7
+L81: .data -915, -799, 9, -815
+L82: add r6, r3
+add #65, *r4
+lea L267, *r5
+jmp L219
+L83: jmp *r5
+stop
+not L202
+L84: cmp r1, *r3
+L85: .data -858, -482, -504
+L86: dec *r5
+stop
+L87: jsr L14
+lea L142, r6
+add L87, r4
+clr r5
+L88: inc *r2
+prn *r2
+L89: jsr *r6
+jsr *r3
+add #-134, r0
+L90: .data -242, -642, 757
+inc *r3
+rts
+inc r3
+rts
+; comment
+L91: cmp L61, *r4
+rts
+not r4
+jsr L85
+bne *r3
+; comment
+mov L8, r3
+L92: stop
+L93: dec L71
+cmp r2, *r6
+L94: jsr *r0
+L95: inc L135
+inc L156
+rts
+
+add #142, r3
+L96: inc L36
+prn *r3
+mov *r4, r6
+dec r1
+cmp L91, r2
+stop
+mov r0, r6
+not *r3
+sub r1, *r6
+sub *r0, L215
+clr L253
+L97: add *r3, r0
+L98: bne *r0
+L99: rts
+cmp L84, L148
+L100: sub L28, r4
+bne L84
+L101: .data 422, 26, -841, -225, -189, 414, -217
+add *r3, r7
+L102: sub r4, r5
+add #-132, r4
+L103: stop
+not r3
+lea L120, *r7
+dec L66
+prn L75
+L104: rts
+lea L12, *r3
+cmp #120, *r7
+inc L180
+L105: mov *r3, L14
+; comment
+sub r6, *r2
+stop
+L106: sub r5, r6
+sub #-236, *r1
+sub *r4, L157
+not L52
+L107: sub *r3, L29
+dec L68
+prn #-126
+L108: cmp *r6, r0
+not r6
+L109: jsr *r2
+jmp L13
+rts
+bne L175
+cmp #133, *r2
+jmp *r1
+L110: add r0, L251
+cmp r0, L111
+red r3
+stop
+
+dec *r4
+L111: .data 302, -296, 285, -798
+sub #-96, *r3
+
+L112: mov *r1, *r4
+inc *r7
+clr L224
+rts
+red r0
+; comment
+stop
+
+rts
+L113: sub r3, r4
+bne L252
+sub r5, r7
+jsr L164
+; comment
+rts
+jmp *r7
+mov *r6, L34
+prn L26
+add *r7, L221
+L114: .data 152, -99, -319, 288, 622
+
+add #99, L141
+L115: stop
+add r5, r3
+rts
+add L124, L48
+; comment
+dec L44
+L116: sub r2, r3
+
+prn r0
+lea L23, L158
+L117: rts
+jmp *r1
+not L256
+sub L168, *r1
+clr *r2
+dec r0
+not r3
+mov r6, r4
+L118: prn #-107
+L119: mov *r7, r2
+jmp *r2
+
+L120: .string "mwaxxfctrpkp"
+sub L106, L69
+not *r7
+inc *r3
+cmp *r5, L183
+jmp L93
+; comment
+mov L5, r5
+jmp L1
+jsr *r7
+L121: clr r2
+inc *r2
+stop
+sub #-249, r1
+L122: not *r3
+; comment
+jmp L123
+not r5
+inc L115
+jmp L122
+rts
+add *r7, L0
+mov L108, *r2
+L123: dec *r5
+jsr L80
+clr r0
+red *r3
+
+add #246, r0
+dec r3
+jmp *r1
+L124: .string "uplyjhh"
+stop
+prn #-103
+L125: .data 272
+rts
+sub #130, r2
+mov L221, L171
+jsr L26
+prn #-169
+L126: stop
+L127: inc L250
+clr *r1
+inc L167
+L128: cmp L35, L40
+bne *r1
+inc *r1
+
+not *r1
+mov r2, L134
+L129: jmp L220
+jmp *r6
+lea L53, r4
+add L162, r3
+cmp L99, #178
+L130: dec r2
+L131: cmp L41, #77
+lea L199, L10
+jsr *r6
+red *r5
+rts
+red L222
+clr r3
+bne L213
+sub L66, r4
+L132: lea L265, r6
+L133: dec r5
+L134: lea L265, r3
+red *r2
+mov L147, L128
+mov *r1, *r4
+clr r7
+mov *r5, *r2
+L135: bne L40
+lea L228, L17
+inc *r7
+L136: dec r1
+L137: .string "wvrzojvte"
+sub L257, *r3
+mov *r0, r0
+mov r0, r6
+prn r5
+jsr *r2
+bne *r7
+rts
+mov #219, r0
+
+rts
+L138: dec *r3
+sub r4, L270
+
+lea L230, *r6
+prn r3
+L139: jsr L51
+L140: rts
+sub L144, *r4
+mov #-206, L53
+cmp #-80, r7
+L141: .string "ernaezkbiszizvgxsoxmoo"
+
+bne *r1
+clr L122
+jsr L122
+prn *r2
+stop
+L142: mov L259, *r3
+jmp L62
+L143: mov *r7, L244
+L144: sub #-12, L175
+lea L75, L35
+mov L31, L117
+clr *r1
+sub #241, *r7
+lea L234, L203
+; comment
+rts
+L145: .string "qtrqxopluwbsodpvdvgote"
+L146: clr *r4
+L147: .data -739
+stop
+L148: .string "kxbzlbstxrkms"
+prn L216
+cmp *r1, *r5
+rts
+jmp L228
+
+L149: .data 262, 398, 871, 487, -127, 909
+lea L117, L180
+L150: .data -185
+jsr L198
+L151: lea L92, L177
+inc *r2
+; comment
+L152: .data -976, -736, -733, -118, 953, 62, -964
+prn L154
+jmp L90
+prn L230
+L153: .string "nkxmvwrd"
+L154: .data 824, 308, 230
+L155: rts
+dec r7
+red r2
+jsr *r5
+dec L164
+sub r0, *r5
+L156: inc r3
+L157: rts
+clr r0
+dec r3
+clr L177
+lea L251, *r5
+not L271
+L158: prn *r3
+mov r6, *r5
+clr L165
+sub r2, r1
+lea L182, L172
+sub L53, r3
+L159: inc *r4
+L160: .string "rpmhqojunhovxfy"
+jmp L262
+add #88, L105
+L161: jmp *r2
+prn L175
+L162: prn r5
+L163: bne L94
+L164: prn r7
+not r4
+add r6, *r3
+cmp *r5, L33
+add #72, L205
+jsr *r4
+
+prn #-31
+inc r3
+not *r4
+cmp r2, r7
+L165: prn r1
+add L226, r4
+cmp *r1, #110
+jsr L129
+L166: dec r2
+L167: inc r2
+dec r3
+L168: .data -643, -760, -937
+jsr *r1
+stop
+cmp r1, L195
+lea L207, r5
+L169: .data 472, 430, -56, -869
+jmp L207
+L170: clr L130
+L171: cmp L191, r1
+jmp L119
+L172: stop
+L173: cmp *r4, r6
+L174: cmp #-201, L184
+L175: .data -987, -787, 682
+prn *r0
+inc L103
+dec L21
+; comment
+; comment
+stop
+not r4
+prn r7
+clr L195
+L176: jsr L68
+stop
+cmp #246, L203
+; comment
+add #-199, *r5
+L177: cmp #178, *r3
+cmp #-246, r6
+
+dec r4
+sub r5, r5
+L178: dec r7
+cmp #-256, *r6
+sub L73, r1
+L179: dec *r1
+clr r5
+stop
+not r3
+cmp L105, *r7
+L180: red r3
+bne L215
+; comment
+L181: stop
+rts
+L182: .string "qynsiycwrwfvzjzrsr"
+not r7
+red r2
+L183: stop
+bne L120
+stop
+L184: clr *r7
+prn *r3
+rts
+lea L147, L162
+L185: not *r3
+inc L231
+clr L125
+stop
+bne *r0
+sub *r7, *r5
+lea L93, L252
+bne L36
+red L111
+cmp L166, r3
+not L39
+prn #156
+cmp r3, r2
+L186: .string "vln"
+jsr L243
+jmp *r1
+L187: jmp L8
+; comment
+L188: jsr *r5
+L189: .data 224, -289, 763, 676, 710
+inc L18
+cmp r0, #-224
+prn #-13
+not r1
+L190: cmp r5, *r0
+bne *r1
+sub L250, L241
+cmp L92, *r5
+bne *r4
+jmp L250
+rts
+rts
+L191: .data -68, -546, -835, -914
+bne L230
+lea L72, r4
+L192: stop
+red *r7
+stop
+mov L158, L202
+inc *r0
+L193: .string "ndrzzzzjbjfnkmer"
+red r2
+L194: .data -998, -404, -270, 718, -449, 915, -39
+L195: cmp *r3, *r0
+L196: .string "dgr"
+red *r6
+L197: .data 144, 269, -552, -12, -373, -205
+L198: .data -579, -822, -671, 853, 132
+add r6, r6
+dec r0
+inc L256
+stop
+dec L16
+not L78
+L199: .string "um"
+L200: .data -255, 87, -392, 913, -317, 602
+jsr *r3
+L201: mov L66, r0
+L202: jsr L231
+L203: red r4
+inc r4
+add L136, r1
+L204: jmp L239
+L205: stop
+sub *r7, r6
+prn #-102
+cmp r4, L214
+dec L75
+inc L141
+red L209
+sub #202, L234
+not L251
+add #235, *r7
+L206: lea L268, L152
+mov #138, *r5
+mov #-112, r7
+lea L224, r7
+L207: .string "yjgsyjyajmm"
+L208: .string "vcdeusjnpgiz"
+L209: inc *r3
+clr r1
+sub *r5, L3
+; comment
+L210: .string "xk"
+cmp r5, #135
+L211: .string "tkdwrwxbzocpcsnbnojdje"
+dec L37
+prn r1
+L212: inc r1
+stop
+dec *r4
+lea L224, r4
+add #90, *r0
+bne *r4
+lea L28, r2
+L213: red *r3
+rts
+L214: .string "zyxvsuknpiib"
+dec r7
+bne *r3
+L215: jsr L238
+L216: lea L218, *r2
+jmp L76
+L217: .string "yahejjxk"
+jmp L247
+inc r2
+jsr *r1
+; comment
+L218: .data -678, -123, 438, 503, -892, 594, 729, -633
+L219: inc L221
+jmp *r4
+clr L0
+rts
+jsr L262
+add *r4, L248
+L220: .string "cg"
+mov #5, *r4
+mov #-119, r2
+jmp L257
+inc *r0
+L221: bne *r2
+L222: sub *r7, *r3
+L223: .data 975, -323, 177, -576, -43, 310, -538
+; comment
+mov r5, *r1
+not L68
+L224: red r6
+rts
+bne L177
+L225: clr r5
+; comment
+not r2
+dec r6
+; comment
+L226: jmp L268
+cmp *r1, *r1
+jmp *r1
+lea L205, r6
+L227: inc L31
+lea L272, r2
+dec r2
+not L232
+add *r5, L250
+lea L181, r1
+L228: jsr *r1
+L229: prn #-67
+L230: clr L143
+
+rts
+add *r6, L237
+mov #-156, r1
+L231: cmp #203, r1
+stop
+red *r0
+stop
+
+not L165
+sub r5, L261
+clr L13
+L232: mov #4, L177
+red L249
+clr *r3
+jsr *r2
+prn #227
+L233: mov #-88, r6
+jsr L208
+dec L168
+L234: .string "nxcycmmgvbgxiqws"
+L235: cmp #164, #-89
+prn L249
+L236: red *r0
+rts
+not L155
+dec r6
+cmp r1, *r1
+rts
+L237: sub *r5, r5
+rts
+; comment
+L238: .data 960, -795, 706, 969
+bne *r3
+L239: .string "ul"
+sub r2, L164
+red L259
+bne L149
+red L47
+inc L53
+L240: not *r4
+lea L256, r6
+lea L208, L254
+sub #-165, L135
+mov L145, *r4
+bne *r0
+
+sub #244, L144
+red *r3
+red r5
+L241: jmp L197
+jmp L249
+lea L238, *r3
+mov #247, L207
+jsr *r7
+L242: .string "sddtinz"
+rts
+lea L247, L267
+rts
+prn L229
+not r5
+prn *r7
+prn #-168
+stop
+; comment
+jsr *r6
+L243: .data -478, -426, 22, -175, 950, -332, 842
+red r5
+mov *r2, *r6
+prn r2
+rts
+bne L267
+mov r3, *r1
+L244: dec r7
+add *r7, *r4
+red L252
+L245: .data 853, 177
+inc *r2
+add r7, *r3
+bne L259
+cmp #-96, r2
+L246: .string "bbgpxjamuco"
+bne L252
+L247: mov r1, *r2
+sub *r3, r0
+stop
+L248: lea L236, L95
+prn #46
+prn r1
+; comment
+inc r3
+L249: red L150
+not r7
+prn r4
+dec L254
+jmp *r7
+L250: .string "ltiaqqbabkyvcbfxbtdoshz"
+sub #183, r6
+inc *r0
+L251: not L267
+jsr L38
+jmp L272
+L252: .data -273
+rts
+jsr *r2
+not L150
+; comment
+L253: mov #11, L34
+L254: sub *r3, r1
+L255: stop
+jsr *r5
+sub r6, r2
+L256: sub #185, *r2
+L257: .data 464, -969, 533, -300, -900, 735
+jsr *r1
+add L92, L271
+jsr *r4
+jmp L45
+; comment
+not *r3
+jsr L268
+prn r2
+L258: inc r2
+sub L237, r4
+L259: bne *r7
+L260: dec *r1
+clr r6
+cmp L28, r7
+rts
+prn *r1
+jsr L265
+L261: bne L264
+L262: add #218, r1
+jsr *r6
+L263: .data 310, -189
+cmp *r2, #10
+jmp L268
+cmp *r3, L271
+L264: jsr *r7
+mov #250, r7
+bne *r7
+L265: add r1, L206
+rts
+L266: stop
+lea L271, *r4
+not *r7
+L267: prn *r3
+not *r7
+inc *r5
+prn r6
+L268: cmp *r5, *r6
+sub #236, r3
+rts
+stop
+L269: jsr *r3
+L270: stop
+jmp L269
+stop
+L271: mov #-144, *r3
+cmp L272, r2
+red r5
+L272: .data -495, -883, -636, -472
+stop
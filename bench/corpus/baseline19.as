@@ -0,0 +1,1018 @@
+; Generated by genCorpus --seed 20
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+L0: .string "ww"
+clr L0
+bne *r2
+L1: red r7
+prn r7
+prn r0
+lea L0, *r4
+L2: not L0
+clr *r0
+L3: rts
+L4: .data -219, -700, 112, 534, -250, 624, 522, 267
+cmp r3, #-100
+jmp L4
+jmp L2
+; comment
+
+not L135
+L5: add *r0, L0
+lea L3, L3
+bne *r0
+L6: red L183
+bne L159
+stop
+prn *r3
+rts
+L7: not r1
+L8: mov #-29, L8
+jsr L46
+bne *r1
+L9: not L18
+add #-166, L7
+bne L9
+jsr L112
+sub L22, *r0
+dec *r4
+lea L162, r6
+L10: dec r5
+lea L5, r7
+
+prn L7
+inc r4
+inc r6
+L11: stop
+L12: inc L12
+L13: mov L9, *r7
+not r3
+L14: .data -701, 844, -415, -265
+sub #-43, r1
+not *r0
+bne *r0
+bne L238
+rts
+sub L0, r1
+jmp *r1
+prn r3
+inc r2
+dec L158
+inc L9
+clr r6
+rts
+mov #-208, *r1
+lea L0, *r3
+rts
+not L113
+red L4
+jsr *r0
+L15: jsr *r1
+add *r3, r3
+jmp *r2
+dec L11
+L16: .data 62, -880, -159, 506, 495, 627
+inc L241
+jmp *r5
+dec r4
+inc L192
+L17: add #231, r3
+stop
+stop
+L18: .data 507, -987, 808, 18, -789, -401, -275, -59
+cmp *r5, *r0
+L19: rts
+inc L3
+sub r1, r6
+lea L1, L8
+mov #48, L181
+; comment
+jsr L18
+L20: cmp #191, r0
+not r5
+L21: mov *r1, r4
+cmp *r4, *r2
+stop
+not r4
+dec r2
+; comment
+L22: jmp L171
+L23: clr *r2
+; comment
+L24: cmp L241, *r1
+L25: stop
+dec *r3
+add L11, *r0
+red r4
+L26: stop
+bne *r5
+L27: .string "pkadrbrzrk"
+sub L158, r0
+add #176, L12
+mov #60, r4
+jsr *r7
+lea L138, *r7
+clr *r2
+inc *r5
+bne L145
+clr *r7
+rts
+L28: sub L113, r7
+L29: jsr *r1
+L30: .string "ouatcjbkcojresiabuvq"
+L31: red r2
+sub *r1, L67
+L32: .string "ddcssusahjop"
+mov #-217, L33
+
+mov #124, r3
+lea L19, L32
+sub #-11, r3
+L33: rts
+inc L205
+dec *r6
+inc *r1
+dec L7
+red r7
+stop
+bne L58
+lea L33, r5
+jmp L198
+; comment
+jmp L9
+L34: rts
+stop
+jsr L19
+L35: inc L190
+inc L11
+L36: mov L222, L85
+L37: .data -846, 279
+L38: sub *r6, *r6
+jsr *r6
+rts
+inc r7
+clr *r3
+sub *r3, r1
+L39: inc r4
+rts
+L40: dec r4
+inc L36
+sub r7, r2
+jsr *r1
+sub *r0, *r1
+lea L137, r4
+dec r3
+jmp *r5
+clr *r2
+add L9, L177
+L41: .data -748, -301, -972, -411, -878, -761
+not *r1
+bne L39
+jmp L17
+L42: .data -616, -12
+L43: red *r0
+stop
+L44: cmp r6, #-239
+L45: .string "yqyxnrvgkaicj"
+L46: .data 891, 665, 949, -396, -378, -645, 320
+L47: .string "wjlhrzurkrl"
+dec *r6
+L48: inc L10
+mov L8, L211
+mov *r0, L222
+lea L207, *r2
+; comment
+L49: dec L66
+red L42
+cmp #-38, L35
+mov #64, *r0
+L50: .data -253, -909, 215
+rts
+add *r1, *r3
+lea L37, r6
+L51: jsr *r3
+clr r6
+clr r5
+rts
+inc L1
+clr L0
+lea L119, r3
+L52: add r0, r6
+sub #-171, L59
+jsr *r2
+bne L20
+L53: sub *r5, r7
+not r1
+red *r0
+L54: dec *r0
+lea L67, *r4
+lea L191, r2
+L55: sub #60, *r5
+stop
+jsr L202
+sub r2, *r0
+cmp L222, L44
+cmp r4, *r5
+inc L110
+red L9
+L56: prn L40
+L57: sub L234, *r6
+sub r4, *r2
+cmp #210, #11
+prn L160
+prn #205
+add r6, L92
+stop
+add r5, L157
+; comment
+not L138
+L58: rts
+sub r1, r4
+L59: lea L10, r3
+L60: bne *r3
+prn #-213
+prn *r2
+L61: stop
+L62: .data 642, 137, 73, -827, 923, -228, 825
+jmp *r3
+L63: red r5
+clr r1
+clr r5
+L64: bne *r5
+prn #-126
+jsr L9
+sub #-31, *r4
+L65: sub #80, L122
+add r6, *r7
+add r6, r0
+red L242
+L66: lea L119, r3
+add r7, *r6
+lea L118, L63
+red r5
+L67: jmp *r6
+sub r1, r1
+inc r0
+lea L102, r3
+jmp *r0
+lea L175, r6
+add r0, r0
+add L2, r4
+cmp #13, r7
+rts
+L68: .data 687, -163, -911
+rts
+add L8, r6
+lea L21, *r1
+L69: not *r2
+cmp r0, L2
+inc L35
+mov r0, r5
+; comment
+lea L131, L103
+sub #78, L169
+mov *r0, *r0
+red L58
+L70: bne *r3
+cmp r1, *r4
+add *r2, *r1
+mov r6, L187
+L71: red r2
+lea L26, L240
+L72: red L81
+inc r0
+bne *r0
+stop
+rts
+L73: inc *r3
+rts
+clr *r1
+cmp *r4, *r3
+lea L36, r0
+jmp *r4
+mov L54, *r4
+sub L111, *r1
+L74: rts
+sub r7, L5
+L75: .data 138, -716, -91
+stop
+dec L137
+; comment
+inc L90
+clr r6
+bne *r5
+jmp *r7
+red L33
+red L176
+L76: not L49
+sub #-92, *r1
+L77: .string "kyuuiawledzzwiwmzvuqln"
+L78: cmp L32, #115
+L79: dec L248
+rts
+L80: .data -312, 33, -747, 913, 122, -237
+mov r5, *r4
+jsr L173
+lea L19, L33
+clr r2
+not L38
+prn *r7
+L81: .string "vlevdstweppoykpan"
+L82: stop
+stop
+; comment
+bne L4
+add *r5, *r6
+L83: cmp L174, r4
+L84: prn r0
+cmp L72, #-182
+cmp r6, #-151
+L85: .data 554, -284
+prn r2
+not r3
+L86: jsr *r2
+L87: dec L127
+red *r1
+sub r6, *r4
+prn L19
+prn #51
+L88: cmp r5, #93
+stop
+lea L10, L72
+dec r2
+bne *r0
+L89: lea L16, *r0
+jmp L2
+sub L25, *r5
+dec *r0
+mov *r6, r3
+stop
+jsr *r2
+stop
+rts
+bne *r6
+clr r1
+inc L32
+inc r7
+L90: add #146, L207
+; comment
+add *r5, r6
+prn r4
+jsr *r6
+prn *r0
+L91: sub r4, *r3
+cmp r5, L225
+not *r7
+jsr *r6
+red *r2
+cmp r3, L204
+L92: .data 838, -826, 668, 99, -522, 228
+L93: .data 342, -275
+lea L95, r1
+cmp #-75, L72
+L94: jmp *r4
+L95: clr L50
+mov L87, L181
+prn *r1
+mov #90, L91
+L96: .string "wjjfgmwpk"
+; comment
+clr r6
+L97: .data 624, -556, 408, -189, -592
+; comment
+L98: bne L69
+lea L217, L78
+jmp *r6
+add r0, r6
+cmp r0, L238
+L99: .string "bpguqlzzsyeidvp"
+
+rts
+mov r2, L112
+L100: stop
+clr r0
+jsr L248
+L101: cmp L18, L226
+sub L197, *r6
+red *r3
+not r4
+mov r6, r6
+not L212
+add L184, *r3
+L102: add #-193, L103
+L103: dec r4
+clr *r6
+sub #83, *r0
+dec *r4
+inc r5
+L104: clr L229
+cmp #-69, r0
+rts
+L105: sub #-24, L182
+cmp L145, r6
+bne *r7
+L106: stop
+mov *r0, *r1
+red r3
+L107: .data 377, -215
+L108: .data 69, 240, 265, 933, 834, 405, 776, -46
+rts
+inc L22
+lea L89, L243
+cmp *r3, r4
+add L188, *r2
+sub L211, *r3
+not L17
+L109: .string "fbsvuuscvoezlu"
+prn #102
+lea L178, *r3
+
+rts
+sub L147, r7
+jmp L211
+dec *r3
+jsr L172
+red *r5
+inc *r7
+prn #-166
+rts
+jsr L32
+sub #-71, r5
+cmp #-110, L101
+bne L159
+
+L110: .string "ki"
+sub #-24, *r7
+clr *r0
+rts
+add *r0, *r1
+not *r0
+L111: .string "ypptucypkyk"
+L112: red *r5
+jmp *r0
+L113: .string "emiosnj"
+clr r5
+jmp L6
+cmp *r5, L102
+sub #212, L228
+not r4
+L114: stop
+L115: rts
+jsr L77
+add r0, r7
+stop
+mov r3, *r4
+sub r4, L193
+clr r2
+dec r1
+red r2
+rts
+L116: jsr *r5
+dec *r4
+L117: .data -957, 651, 0, -886, -257, 2, -585, -284
+dec r2
+rts
+jmp L194
+add r3, L202
+mov r4, L217
+lea L189, r5
+cmp #-97, *r3
+L118: cmp #-94, r4
+mov #-58, L25
+red *r7
+not r0
+inc r0
+L119: jmp *r6
+L120: .data -262, 522, -658, 929, 398, 100, 453, -260
+inc L137
+lea L101, *r4
+L121: stop
+; comment
+jsr *r4
+rts
+mov L120, *r5
+L122: jsr L89
+L123: .string "vfwavjesftogowkf"
+jmp L157
+dec *r6
+rts
+inc r1
+clr r3
+L124: inc L118
+L125: red L117
+stop
+add *r1, L239
+clr *r7
+dec r1
+bne *r0
+L126: lea L169, L60
+; comment
+cmp L247, L86
+
+L127: .string "ggvjicujstieshvjvkjdx"
+prn L89
+L128: dec r0
+stop
+red L213
+L129: red *r2
+red *r3
+lea L201, r2
+L130: inc r7
+L131: cmp *r0, r2
+L132: bne *r2
+dec r3
+bne L128
+lea L175, r4
+L133: .data 706, 302, -41, -416, -73, -958
+L134: .data -364, 257, 50, -902, 371, -53, 208, -5
+inc *r2
+L135: prn *r1
+L136: lea L78, *r0
+add L172, L48
+red L6
+; comment
+jmp L166
+L137: .string "vqlsfecoploumqirujofggn"
+L138: .data 692, -311, -583, -669, 1
+L139: not *r3
+red r7
+jsr *r3
+prn r4
+inc r2
+L140: bne *r5
+jsr *r3
+lea L168, r1
+clr L75
+add L69, r4
+L141: .string "ochetezjpgfnoslrkog"
+bne *r4
+jsr L99
+mov L223, *r1
+dec r1
+lea L15, L131
+L142: clr L151
+cmp #215, *r2
+lea L84, r0
+red L73
+dec *r5
+sub #3, *r3
+
+lea L176, r0
+rts
+L143: dec *r3
+cmp L69, #-93
+prn r0
+add r4, r3
+rts
+stop
+L144: not L235
+; comment
+lea L214, L77
+clr L124
+L145: cmp *r2, L120
+bne L147
+L146: .string "znwnstqqkcrnbbfukbvtgb"
+inc *r2
+L147: mov *r3, r1
+L148: lea L193, *r5
+L149: red *r4
+red r7
+not r6
+L150: .string "agjzhnvqbroip"
+jsr *r5
+
+mov L221, *r5
+; comment
+red r4
+mov *r4, L213
+not *r1
+cmp *r5, r2
+inc *r2
+dec L129
+mov L29, r7
+rts
+L151: jsr L243
+L152: red *r6
+L153: .string "hdmokujvbjtd"
+red r0
+stop
+red L184
+dec r1
+L154: mov L179, L121
+L155: sub r3, *r6
+sub #8, L213
+sub *r5, L225
+add L166, r4
+stop
+L156: inc *r6
+prn L16
+prn *r1
+not L204
+L157: inc L245
+cmp *r5, L73
+red *r7
+prn r0
+jsr L226
+clr *r1
+jmp L244
+stop
+clr L44
+bne L92
+lea L55, r2
+stop
+L158: .string "mtay"
+sub L132, L197
+L159: .data -780, 514, 86, -381, -169, -734, 709, -699
+L160: .string "edkeaayacqqzjbsncu"
+bne *r1
+add L105, r3
+prn *r4
+cmp #-199, r3
+stop
+L161: .data 455, 313, 148, -53, 968, 292, 191
+jsr L104
+mov #10, r1
+inc r2
+jmp *r7
+stop
+L162: add L104, r5
+cmp L246, #10
+cmp *r7, r4
+L163: sub #191, r1
+prn L32
+L164: bne *r7
+not L233
+mov #-161, *r4
+dec *r4
+bne *r6
+
+L165: rts
+L166: dec L191
+rts
+L167: .data -125, 312, -320, 983, -783, 443, 940, 628
+; comment
+prn r5
+sub r4, L172
+stop
+stop
+jsr L194
+cmp #1, *r7
+jsr *r7
+prn #130
+bne L196
+clr r1
+add #218, r6
+
+L168: .string "qxxfzoaiubtjxud"
+add *r4, L67
+inc L0
+sub r7, r6
+L169: .data -166, -969, -346, -48, -381
+; comment
+lea L134, r1
+
+prn L63
+L170: add r4, *r0
+inc L163
+sub L235, r1
+rts
+L171: .string "cyhopgzhgmbpoephvxwfjry"
+not *r6
+L172: clr r0
+dec L79
+cmp L179, L8
+; comment
+L173: add #-245, L135
+cmp r1, *r1
+not r0
+L174: not r7
+L175: dec L81
+L176: .data -958, -856, -426, -438, 348, 561, -305, 676
+inc L190
+inc *r3
+stop
+L177: prn #-139
+L178: jsr *r3
+; comment
+red *r4
+L179: .data -22, -793, -98, -791, 800, -398
+L180: stop
+inc r7
+jmp *r6
+rts
+bne L48
+jsr L238
+L181: .string "ryv"
+add r5, r4
+
+dec *r1
+L182: .data -526, 704, -288, 515, 713
+jsr L192
+bne *r0
+clr L98
+prn r4
+jmp *r4
+
+mov *r0, L225
+stop
+L183: inc L173
+L184: cmp r7, L231
+lea L240, L202
+L185: rts
+not r0
+add L193, *r1
+dec L85
+L186: .string "rv"
+add r6, r0
+L187: .data 285, -716, -245, 855, 58, 342, 815, -115
+dec r6
+mov L45, r2
+jsr *r3
+inc r7
+stop
+cmp *r1, #139
+add r5, *r4
+sub #101, r7
+jmp L227
+clr r6
+cmp *r6, L228
+cmp L62, *r7
+L188: bne *r5
+mov L198, L218
+L189: jmp *r2
+bne L248
+rts
+not L67
+jsr *r3
+sub r7, r2
+clr *r5
+add #-87, L58
+inc *r0
+jmp *r2
+L190: stop
+cmp #142, L31
+L191: .data -797, 329, 306, -320, -737, -470, -378, 445
+add L240, r4
+sub #127, L225
+add r3, r3
+not *r7
+L192: not r6
+clr *r6
+jsr L205
+red L176
+L193: mov #199, r2
+red L240
+jsr L86
+L194: .data 86, -406, 156, -271, -642, -164, 234
+add L88, r0
+jsr L227
+L195: .data 307
+L196: .data -647, 595, 153
+not r4
+prn *r3
+bne L243
+stop
+; comment
+inc r4
+dec r4
+; comment
+L197: rts
+not r1
+bne L190
+prn *r6
+dec *r3
+L198: lea L221, *r1
+cmp #-32, #-158
+red L132
+lea L128, L183
+bne *r5
+L199: .string "oxaqy"
+prn L202
+bne *r6
+
+L200: .data -956, 731, 798, -453, 593, -816, 123, 638
+; comment
+L201: cmp #-11, L235
+L202: .data 27, 667, -913, -838, 897, -860, 264
+lea L235, L180
+not L135
+mov L229, *r2
+clr L217
+L203: lea L187, r4
+stop
+bne L240
+L204: red L73
+cmp r6, r3
+red *r7
+dec L245
+sub #139, L212
+jsr *r0
+bne *r2
+L205: cmp *r4, r4
+clr r4
+rts
+inc r6
+cmp r4, *r1
+cmp L206, #32
+L206: lea L215, *r5
+L207: rts
+; comment
+L208: bne L127
+sub *r0, r7
+rts
+L209: .string "jp"
+L210: clr *r1
+add L110, r0
+rts
+cmp *r7, *r3
+add L248, r3
+L211: .string "l"
+clr *r0
+not r6
+rts
+not L217
+stop
+jsr L32
+red L215
+L212: .string "ggcxufucigzaivkyaw"
+stop
+jmp *r0
+dec r1
+L213: cmp r5, r1
+clr r1
+rts
+inc r5
+jmp L227
+add #-139, r5
+jmp *r0
+clr *r6
+bne L240
+not *r7
+L214: .data -975, 6, -581, -71, -82, -712, -704
+L215: sub *r1, r7
+not L220
+dec r6
+jmp *r3
+bne L206
+bne L224
+L216: not L245
+lea L243, *r7
+add r1, L139
+not *r1
+jmp *r5
+L217: inc *r4
+cmp L241, L200
+clr r5
+L218: clr L63
+L219: inc *r0
+L220: red L245
+not *r0
+red r0
+sub L225, *r0
+L221: lea L235, r2
+bne *r5
+mov r3, L232
+not *r1
+red r3
+jsr *r3
+L222: .string "f"
+mov *r3, r7
+L223: clr r7
+jmp L213
+bne *r2
+inc r0
+jsr *r6
+sub *r3, *r1
+jsr *r5
+inc L233
+rts
+sub L229, *r6
+L224: sub *r6, r4
+mov r0, *r2
+L225: .data -48, 635, 706, -701
+prn L238
+L226: bne *r4
+L227: .data -17, 586, 963, 615, 767, -11, 348, -162
+L228: cmp L229, #23
+dec r4
+rts
+L229: add *r0, L143
+jmp L223
+
+dec L141
+L230: not *r4
+L231: clr *r2
+cmp r1, r3
+
+lea L236, r0
+stop
+L232: .data 381, -315, -487, 142, -248
+inc L175
+red *r3
+L233: inc r6
+; comment
+cmp r3, #193
+add r5, L248
+prn *r6
+prn L21
+sub L237, r2
+add #187, *r6
+sub r2, r5
+not L0
+L234: clr L244
+jsr L111
+L235: .data 499
+L236: inc L151
+bne L51
+sub r4, r7
+L237: cmp L237, #1
+bne *r4
+inc L43
+rts
+
+inc L101
+red L196
+red *r2
+clr r2
+prn L33
+mov *r2, *r1
+red r4
+red *r5
+jsr *r0
+red *r4
+sub r1, L143
+bne L116
+jmp L136
+dec r3
+L238: .string "fplg"
+L239: jsr L242
+bne *r4
+inc *r4
+clr L47
+add #127, r7
+L240: inc L59
+add L243, r6
+jmp *r3
+red *r3
+; comment
+mov *r6, L132
+jmp L241
+L241: add L156, L243
+red L248
+jsr *r5
+; comment
+L242: red *r4
+red *r6
+prn *r6
+L243: .data 795
+cmp L247, r5
+dec r3
+cmp *r4, r6
+dec r5
+add #175, r6
+dec L246
+clr *r5
+red *r6
+jmp L221
+lea L200, r1
+
+jmp L247
+not L244
+mov r6, L246
+; comment
+cmp L7, *r4
+jmp L246
+L244: bne *r7
+jmp L248
+lea L53, *r3
+red L143
+L245: .data -217, -817, 377, -637, -78, -672
+lea L168, r1
+rts
+red *r2
+
+rts
+
+L246: jsr *r1
+not *r0
+clr r5
+L247: clr *r5
+L248: cmp *r5, r2
+cmp *r0, L230
+not L103
+jsr L102
+stop
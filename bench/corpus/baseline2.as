@@ -0,0 +1,1018 @@
+; Generated by genCorpus --seed 3
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+sub r5, L116
+L0: .string "twvghbb"
+jsr L37
+bne *r7
+red r4
+L1: .string "nzlliklnncvwexutiurivwoh"
+L2: .data 554, 145
+jmp L2
+jmp L0
+rts
+bne *r0
+jsr L2
+rts
+L3: cmp #-246, r7
+; comment
+L4: .string "gapezzlnlnjlnjjxizg"
+
+rts
+stop
+inc *r4
+add L206, r2
+jmp L2
+rts
+L5: mov *r2, r3
+L6: .data 167, 59, 874, 934
+prn #59
+jmp L3
+L7: inc *r5
+not r6
+clr r5
+L8: prn r4
+L9: stop
+add #-64, *r4
+inc *r2
+rts
+stop
+cmp r2, L126
+rts
+
+cmp L23, r6
+rts
+mov L7, L192
+sub L111, L99
+; comment
+
+stop
+not r0
+bne L4
+bne L237
+L10: .data 208, -816
+
+lea L176, *r3
+bne *r0
+L11: .string "azvmzlphwd"
+bne *r3
+L12: .string "tbgigwuokianuikafq"
+L13: not L10
+; comment
+L14: lea L9, L226
+L15: .data 348, -561, -173, 904
+
+L16: clr L126
+add *r6, *r6
+red L9
+cmp L208, #201
+
+dec r0
+add r6, L199
+L17: jsr L183
+
+stop
+stop
+prn *r2
+bne *r0
+dec L9
+L18: .string "zjrlwqwvucmmnfrbwu"
+red r4
+bne *r7
+L19: .string "oupwhdlgqtfgjokfw"
+bne *r7
+mov r3, *r1
+rts
+inc L7
+cmp r6, #170
+add r7, *r4
+L20: .string "kteyjqbvqewbianudt"
+; comment
+
+bne L216
+L21: jmp L19
+jsr *r7
+bne *r2
+bne *r5
+L22: stop
+L23: lea L238, r7
+L24: .data -277, 322, -668, -740, 353, 33
+not L240
+dec r2
+inc *r2
+L25: jsr L32
+; comment
+lea L24, *r5
+dec L22
+prn #42
+
+bne *r4
+inc *r5
+inc L10
+not r6
+
+L26: add r7, L23
+cmp L17, #181
+stop
+mov #-251, *r3
+sub r1, r1
+clr *r7
+sub r0, L72
+
+bne L59
+sub r5, r6
+prn L47
+stop
+L27: .string "wtlrggbu"
+red *r6
+inc L19
+L28: .string "jnnchumj"
+not r1
+dec L15
+sub L191, L195
+red L4
+red *r5
+L29: clr r1
+jsr L107
+L30: .string "asvphgwuoxvhnzxzjhdvg"
+sub #40, L227
+mov L18, r5
+mov *r6, L90
+jmp *r0
+jmp *r0
+jsr L0
+sub *r4, L154
+
+L31: jmp L223
+stop
+cmp r0, r3
+L32: .string "xgyls"
+add *r5, *r5
+L33: .string "kbqxgmgv"
+sub *r2, L16
+rts
+prn L89
+prn r7
+inc L239
+L34: .string "nwr"
+jmp *r5
+jsr L73
+L35: .string "ldejfzhmzshsvl"
+sub *r6, *r7
+not r7
+prn L7
+L36: stop
+L37: lea L241, r6
+prn *r4
+clr *r4
+L38: clr *r1
+jmp L38
+add r3, *r4
+rts
+stop
+stop
+L39: .string "edoj"
+sub *r7, r2
+not r0
+sub *r6, L118
+red r2
+jsr *r5
+L40: bne L239
+L41: .data 688, -260, -386
+
+jsr L241
+cmp *r0, #5
+L42: sub #63, *r5
+cmp r5, #-181
+cmp #33, #153
+bne *r6
+sub *r3, r0
+inc *r3
+L43: add L30, L209
+dec r2
+L44: sub #-254, *r7
+stop
+L45: jsr *r6
+clr r0
+L46: jmp L161
+red r3
+L47: add L11, *r4
+not L201
+jsr L42
+prn #193
+lea L44, L135
+L48: .string "aeztbdyadc"
+jsr L232
+inc *r6
+L49: inc r0
+jsr L226
+mov r1, r4
+lea L215, *r7
+stop
+lea L135, *r3
+L50: .data 968, 465, -258
+lea L206, L29
+rts
+bne L75
+dec L121
+L51: inc L11
+lea L83, r1
+stop
+jmp L78
+L52: .data 744, -369, -794, 615, 782, -511, 779
+dec r0
+prn r0
+lea L124, r2
+red L19
+clr *r3
+
+inc L1
+cmp r6, *r3
+rts
+inc *r7
+inc L37
+mov L47, *r5
+bne *r5
+lea L94, L136
+inc L128
+L53: cmp *r4, #94
+L54: stop
+cmp #167, r5
+rts
+jmp *r2
+dec *r1
+jsr L29
+inc r2
+L55: clr *r7
+not *r0
+add *r5, L107
+cmp L11, L135
+prn #-95
+add L118, L162
+L56: sub *r5, L137
+red *r5
+red L10
+bne *r2
+bne L141
+; comment
+jsr L51
+dec L28
+stop
+L57: .data 156, 174, -400, -318, -730, 912
+rts
+L58: cmp #66, L121
+cmp *r3, r4
+L59: .string "wzbzltij"
+L60: .data 610, -700, 53
+red r1
+rts
+L61: .data 690, 662, 918, 188, 70, 157, -43, -261
+L62: jsr *r6
+cmp *r4, *r2
+sub L40, L59
+inc L53
+L63: clr *r1
+sub r7, L193
+clr L37
+rts
+L64: .string "phqryysxf"
+bne *r7
+prn *r5
+jsr *r1
+bne L113
+L65: .data 175, -522, -873, 121, -583, -398
+add L77, L52
+dec *r3
+L66: sub #134, *r1
+jsr *r3
+lea L201, *r1
+rts
+not *r3
+lea L46, r1
+L67: inc r5
+inc L209
+jmp *r1
+L68: jsr L116
+mov *r0, L77
+cmp #-28, #171
+jsr *r4
+clr *r3
+rts
+L69: lea L23, L187
+not r7
+dec L114
+sub #-13, *r0
+stop
+not r5
+jsr L64
+rts
+dec r4
+mov L37, *r3
+rts
+lea L212, *r5
+L70: not r2
+cmp L116, r6
+sub r4, *r3
+
+dec L39
+lea L167, r0
+not r7
+L71: .string "j"
+add r0, L22
+cmp L185, L41
+prn L230
+stop
+prn *r3
+stop
+rts
+mov L180, *r2
+L72: bne L11
+jmp *r1
+stop
+L73: .data 807, 696, -909, -22, 621, -58, -819, 171
+dec r1
+stop
+dec L90
+stop
+cmp *r1, L231
+L74: .string "ydir"
+dec r6
+L75: .string "rfddmozzm"
+L76: .data 180, 186
+bne *r1
+jsr L229
+red *r5
+not r0
+
+not L182
+L77: red L55
+add L76, r6
+rts
+stop
+L78: not r7
+jmp *r1
+rts
+L79: jsr *r1
+L80: dec L50
+dec *r2
+L81: .string "zgloqywnnthnzrtactwsceti"
+lea L215, L179
+L82: jmp L183
+L83: rts
+jsr *r0
+prn L182
+not r1
+dec L205
+lea L81, L17
+clr L77
+L84: .data -17, -38
+L85: .data -871, 914, -952, -115, -879, 764, -968
+L86: .data -974, 458, 478, 207, -609, -258, -239
+sub #121, L35
+L87: mov #88, r0
+rts
+dec *r7
+add L39, r0
+stop
+prn #-233
+lea L156, L31
+clr L69
+lea L129, L129
+rts
+bne *r2
+inc *r2
+jsr L64
+rts
+dec r2
+stop
+prn r3
+rts
+lea L160, r1
+jsr L239
+L88: cmp #-77, #195
+L89: red L231
+not *r4
+sub r4, *r5
+jsr *r7
+add #148, *r5
+lea L33, L22
+L90: jsr L52
+red L53
+not L11
+L91: jsr L61
+prn #244
+L92: bne L193
+L93: stop
+jsr L14
+cmp L60, #-183
+stop
+L94: .data 321
+L95: not L228
+L96: red *r2
+dec *r6
+clr *r3
+stop
+not *r5
+prn *r6
+inc L191
+red r5
+add *r7, *r5
+not *r7
+not *r5
+stop
+sub *r3, L107
+jmp L36
+lea L17, L61
+red *r4
+sub *r5, L176
+sub r2, L99
+L97: .data -938
+rts
+jmp *r6
+jmp L65
+add L86, r1
+prn #-2
+jsr L91
+dec r2
+add L221, *r6
+L98: .string "ltwsfasqnoxkxsuzvyywhiu"
+L99: .data -124, 239, 79, -414, -945, 884
+sub r1, r7
+inc *r2
+dec *r7
+L100: .string "ddvcxxbs"
+sub *r7, *r4
+dec r0
+L101: .data -96, -506, -28, -149, -902, 95, -496
+red L192
+cmp *r2, r4
+L102: .data 617
+L103: jsr L212
+L104: add *r5, r2
+L105: .string "vxwtefemph"
+not L36
+jsr L101
+bne L65
+cmp r0, L75
+L106: stop
+bne L74
+clr r7
+rts
+cmp *r7, L216
+rts
+L107: jmp L216
+L108: lea L132, *r3
+L109: .data 607, 423, 191, -117, -709
+add L93, L19
+L110: not *r4
+stop
+prn r5
+not *r6
+L111: add *r1, L98
+
+cmp r3, *r3
+clr r7
+L112: .string "dyixpgpmikvpnzkb"
+add #-10, *r4
+inc r5
+dec *r5
+not L18
+rts
+lea L105, r4
+sub L12, *r2
+L113: not r6
+L114: lea L181, *r0
+bne *r3
+prn *r3
+jmp L34
+mov #40, L141
+L115: red r7
+L116: stop
+lea L34, r7
+red *r4
+stop
+red *r4
+L117: lea L19, *r7
+sub #238, r0
+not L170
+add r4, *r7
+inc *r4
+L118: dec L173
+mov r1, *r0
+lea L73, *r2
+lea L70, *r6
+jsr L93
+rts
+L119: bne *r2
+prn #-215
+stop
+cmp *r3, *r0
+mov r4, L11
+inc L179
+prn *r1
+prn *r6
+clr r7
+inc *r1
+cmp #72, L175
+prn r6
+jmp *r2
+cmp r1, *r5
+red r6
+L120: mov #-215, L177
+jmp L118
+L121: dec L41
+L122: .string "nthjsaukznezqd"
+clr *r3
+dec L120
+inc *r3
+L123: .data 414, 893
+jmp L164
+add r1, L207
+jmp L190
+L124: .data -566
+
+stop
+mov r5, L167
+red *r1
+L125: .string "mijlgzuwd"
+L126: .data 971
+L127: .string "ckupmpjrznnwdccghcus"
+stop
+jmp L123
+red *r0
+jsr *r1
+red L44
+mov #107, L57
+add *r5, L101
+jmp L169
+L128: jmp *r3
+prn *r3
+clr L146
+sub *r1, r7
+L129: inc *r3
+L130: cmp L219, r4
+red r6
+L131: .string "bhvebzqcfsipiuxq"
+
+jmp *r4
+prn r3
+cmp #-254, #-65
+red L217
+red L227
+jmp *r1
+jmp L224
+red L26
+L132: .data 880, -277, 382, -957, -723, 439, -942
+prn *r5
+stop
+L133: cmp *r6, L17
+lea L215, *r1
+mov r3, r4
+rts
+L134: .string "axrrcxninpells"
+rts
+not *r4
+L135: jsr *r6
+red *r3
+L136: .string "wfoetmjckdhvpcq"
+jsr L68
+inc *r7
+not *r1
+prn *r7
+L137: .string "rntypixqvsx"
+not *r7
+
+red *r1
+L138: .string "fgmvyzkjeel"
+inc r7
+L139: lea L211, *r2
+L140: jsr L242
+add *r3, *r1
+clr r2
+bne *r6
+jmp *r0
+
+add L152, r2
+rts
+inc r6
+L141: add L78, *r7
+dec r1
+inc L170
+mov L188, r1
+not *r1
+jmp L39
+stop
+L142: .data 743, -863, 543, 516, 227, 855, -688
+clr L203
+lea L23, L128
+
+inc L109
+jmp *r6
+inc L0
+L143: .data -336, -831, 618, -599, -807, -294
+sub #95, r7
+jsr L75
+L144: .string "udcwffzzxvqnh"
+mov *r0, *r1
+jmp L128
+dec r0
+L145: stop
+L146: .string "tcsxgnbywdirbmhvs"
+L147: bne *r1
+L148: .string "czkkxsmqjhlftlwx"
+stop
+lea L69, *r6
+L149: bne L6
+mov #-28, r6
+lea L18, r5
+prn L232
+not r1
+not *r3
+L150: stop
+L151: dec L177
+L152: .data -402, 919, -76, -725
+inc r0
+bne L22
+dec L223
+; comment
+stop
+bne L234
+bne L113
+L153: .string "rgjctcujhesgqvfc"
+bne *r0
+cmp #203, L160
+bne L185
+add *r2, L230
+L154: sub r1, r2
+lea L154, L196
+rts
+rts
+
+jmp L232
+mov r5, L189
+clr *r4
+red r5
+L155: mov L221, *r4
+inc *r2
+L156: lea L194, r2
+L157: inc *r1
+bne L236
+jsr L42
+L158: .data 989, -355
+
+red *r7
+cmp L189, r7
+inc *r4
+clr r6
+inc *r1
+L159: rts
+mov #229, r5
+bne L3
+not L238
+jsr *r1
+L160: .data -706, 157, 849, -927, 663, 658, -103, -324
+dec *r0
+inc *r3
+lea L6, r2
+sub #168, L203
+red L163
+clr *r5
+jmp *r2
+dec r5
+L161: rts
+L162: .string "zymxqrly"
+prn L14
+prn *r5
+L163: inc *r7
+L164: .data 845, -452, -578, 562, 710, 209
+lea L45, r4
+L165: jsr *r5
+stop
+cmp *r7, #45
+add *r3, r5
+jmp *r3
+add L237, L171
+prn r0
+not r2
+L166: clr *r4
+sub #53, *r7
+; comment
+mov L65, L56
+L167: mov r3, L12
+L168: clr r0
+jsr L95
+; comment
+L169: .string "jjzkcyrsfqzdhxoj"
+prn #155
+mov r3, r4
+L170: sub *r4, *r4
+lea L76, *r5
+
+jmp *r6
+stop
+jmp L232
+jmp L136
+add r6, L100
+jmp *r4
+L171: red L18
+not *r7
+L172: stop
+prn #149
+cmp L231, *r2
+clr *r1
+rts
+prn L237
+rts
+inc L234
+L173: jmp *r5
+inc L40
+L174: not *r1
+sub r5, r6
+L175: prn r2
+L176: .string "hbcaiiizem"
+rts
+mov *r1, L204
+prn #189
+lea L191, r4
+red r5
+inc L101
+dec *r2
+mov *r0, *r5
+clr r7
+bne L84
+prn L52
+sub *r2, L128
+prn r2
+prn *r7
+rts
+L177: cmp L227, #114
+rts
+lea L137, *r4
+bne *r3
+clr *r2
+dec r2
+stop
+L178: mov L168, r7
+cmp #-96, *r0
+L179: mov *r3, *r5
+L180: .data -33, 685, 840, 951
+L181: dec *r2
+L182: .data -567, -924, -509, -155, -994, 94
+sub L214, r4
+
+clr r3
+stop
+L183: sub #90, r2
+jmp L64
+lea L164, *r1
+jmp L184
+red L221
+red r2
+sub L84, r4
+mov *r0, *r0
+jsr *r4
+not *r1
+
+clr r2
+L184: .data -107, 543, -855
+jmp L114
+L185: .string "lnydczliaaoiad"
+L186: red L207
+red r4
+bne L84
+bne *r1
+cmp #-104, r0
+mov *r6, r7
+L187: stop
+L188: bne L117
+stop
+prn *r1
+add #-172, *r7
+cmp r1, *r1
+L189: .data -851, -557, 919, 537, 897, 661, -613, 217
+add r0, *r4
+L190: dec r4
+bne L179
+lea L192, *r4
+
+lea L216, L121
+stop
+add L69, L114
+L191: clr r1
+L192: .data -538, -773
+L193: sub L204, L199
+; comment
+dec r2
+clr r3
+L194: .string "sk"
+L195: prn r4
+jsr *r1
+red *r0
+L196: mov *r3, *r2
+jmp L91
+lea L19, L200
+cmp r3, #-157
+
+stop
+inc *r4
+not L206
+dec *r4
+L197: .string "nmuovouvgwbhbmdt"
+inc *r7
+L198: prn #174
+mov *r4, L79
+mov *r1, L216
+mov *r1, *r3
+L199: inc L49
+L200: .string "acsneenyjbnpezds"
+L201: .string "rxbkxxtbtcgssjc"
+L202: .string "fsr"
+dec L53
+stop
+L203: stop
+L204: .data -234, -899
+lea L14, L28
+jmp *r6
+bne *r6
+lea L130, L206
+L205: .string "szeqsorxngmwtpypr"
+not *r0
+jmp L189
+lea L123, r3
+bne *r4
+jsr *r7
+L206: .data -783, -404, -436, -735, 907
+L207: lea L185, L6
+prn L40
+L208: clr r0
+red r0
+L209: clr *r2
+; comment
+mov *r6, L214
+L210: prn *r2
+not *r4
+prn *r4
+not *r3
+L211: .data 469, 29, 748, 796, -51, -25
+jsr L216
+cmp L153, L239
+inc r3
+jsr *r5
+mov L232, r2
+sub *r3, r6
+red *r1
+not L15
+stop
+L212: .string "kndtgtaqaogtnvxeexejb"
+L213: .string "yobiwpmvekx"
+jsr L170
+cmp r6, *r4
+lea L241, *r1
+mov #238, r6
+cmp #-171, r6
+sub #90, *r4
+mov *r5, L228
+clr *r0
+stop
+L214: stop
+; comment
+stop
+lea L243, L225
+lea L124, *r7
+dec L232
+L215: dec *r5
+red L222
+L216: .data -351, 118, -685, -866, -871
+lea L37, r0
+L217: jmp L228
+jsr L242
+not *r6
+L218: sub L232, r7
+prn #208
+prn r6
+mov *r5, *r6
+jmp *r6
+L219: inc r3
+inc *r6
+cmp #211, #-57
+L220: cmp L241, #-73
+prn r1
+mov r2, *r2
+clr L90
+L221: lea L238, *r1
+L222: .data -425, 484, 375, -565, 883, -41, 110, 955
+L223: cmp r3, L239
+L224: rts
+dec r4
+bne L233
+L225: dec r1
+mov L84, L244
+sub r6, *r5
+prn L193
+jmp L237
+jsr *r7
+mov r3, L132
+stop
+L226: .string "ylimjvgyxxbgsfuzshnu"
+cmp L237, #161
+; comment
+sub r6, L245
+red r3
+L227: rts
+L228: .data -86, 131, 752
+inc L242
+not *r6
+L229: sub L70, *r7
+rts
+add #-34, *r3
+stop
+bne L232
+mov #-95, r4
+
+sub r2, r6
+sub #91, *r4
+cmp L121, #223
+red r0
+mov L224, *r5
+clr *r5
+prn *r5
+rts
+jsr *r5
+not L230
+
+cmp *r6, *r1
+L230: bne L134
+jmp *r1
+L231: sub *r4, *r7
+; comment
+stop
+L232: .data 812
+lea L242, L215
+mov *r0, r6
+add #-202, r6
+
+inc L37
+bne L171
+stop
+L233: .data 551, -305, -834, -786, -469
+sub *r5, r0
+jsr *r4
+cmp L228, r0
+cmp #65, #-58
+rts
+prn L182
+rts
+prn #41
+clr L245
+red r0
+dec L194
+bne *r0
+stop
+L234: .data 298, -831, -64
+red *r3
+L235: red r1
+cmp #-13, #-55
+red r1
+sub L110, r3
+jmp *r4
+clr *r3
+inc *r7
+not L237
+L236: prn r1
+rts
+L237: not L238
+sub L245, r1
+L238: dec *r7
+stop
+jsr L243
+not *r5
+L239: clr r2
+L240: .data -980, 492, -557
+L241: inc L8
+stop
+bne *r7
+stop
+L242: add *r0, r5
+jmp *r0
+clr L245
+L243: not *r3
+L244: stop
+cmp *r3, r2
+add #114, r6
+L245: bne *r6
+not r1
+stop
@@ -0,0 +1,1019 @@
+; Generated by genCorpus --seed 21
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+L0: bne L18
+stop
+jsr *r3
+mov r3, r4
+mov *r6, L0
+jsr L166
+
+jmp L0
+bne *r5
+
+L1: mov *r2, *r2
+L2: .data 481, 14, -229, -318
+dec r6
+L3: lea L30, *r1
+stop
+jsr *r6
+L4: cmp L0, L2
+rts
+bne L244
+jmp L31
+lea L6, *r6
+add #56, r4
+; comment
+red *r7
+L5: .string "kytjgw"
+mov #-117, L3
+jmp *r1
+sub r7, *r7
+mov #22, L115
+inc r6
+dec r1
+L6: add r4, L6
+sub L21, *r4
+sub r3, *r5
+lea L4, r1
+jsr *r3
+jmp *r3
+lea L115, *r6
+rts
+L7: jmp L7
+L8: .string "fvdaqjurflvezrfsebtusnu"
+L9: .string "rlalptecrjemtrwmt"
+L10: .data 37, -379, 284
+L11: stop
+red L84
+prn L101
+stop
+L12: cmp L8, r7
+L13: .data 641, 174, 911
+dec *r3
+dec r7
+red r2
+mov #-229, *r0
+bne *r4
+clr L6
+jsr L5
+jsr L9
+sub *r2, *r4
+L14: lea L215, *r2
+dec L0
+inc L181
+prn r2
+L15: dec r3
+dec L177
+lea L235, *r4
+L16: inc *r5
+inc L221
+L17: .data -744, 257, 135, -443, 700, -656
+L18: .data -114, 895, 504, 980, -826
+inc *r6
+L19: jsr L18
+sub r2, r2
+jmp *r5
+L20: prn L151
+add L249, *r7
+sub #-210, r5
+cmp L71, *r5
+L21: rts
+dec r7
+L22: red r6
+mov *r7, L14
+inc L227
+not L2
+stop
+stop
+red r6
+sub r5, *r5
+rts
+sub r5, L10
+L23: prn #90
+add L17, L147
+jsr *r1
+L24: stop
+mov r6, *r3
+stop
+L25: .string "wxjulbiqzhpywxed"
+L26: bne L14
+rts
+bne L67
+bne L19
+
+dec L9
+lea L182, *r0
+L27: .string "mtxcjrsh"
+
+L28: bne L24
+L29: jsr *r5
+L30: stop
+clr L252
+L31: red r5
+dec L18
+L32: mov L27, r7
+sub #-114, *r3
+L33: .string "uwhbaswysor"
+prn r6
+lea L216, L180
+clr L192
+rts
+sub r5, L16
+mov *r7, r3
+prn L22
+cmp #100, L82
+not r6
+red L0
+not L158
+cmp #-134, *r2
+inc r6
+rts
+sub r4, L23
+jsr *r4
+
+L34: .string "ouevlkrhgyneg"
+L35: jmp *r2
+L36: rts
+red L61
+red L189
+red r5
+not r1
+lea L26, *r6
+L37: .data 432, -730
+; comment
+add #-178, r4
+L38: .data -680, 225, 9, 407, 284
+L39: .data 775, 419, -949, -730, -486, -266
+L40: red r3
+sub *r3, *r3
+rts
+; comment
+mov L77, *r6
+prn L247
+prn *r5
+rts
+cmp L200, L32
+sub L29, r6
+add L36, r2
+bne *r5
+mov r3, r4
+clr L194
+L41: .string "es"
+cmp L163, L0
+L42: jmp L210
+clr L259
+jmp *r2
+L43: .string "hrrctpeqnqmjoh"
+mov r3, *r2
+clr r2
+jsr *r0
+red r0
+cmp r7, L205
+L44: not r0
+L45: .data -172, -459
+mov L154, *r0
+rts
+bne *r0
+red r5
+red *r5
+L46: rts
+jmp *r3
+not r0
+L47: .string "mistcidsc"
+L48: .string "jutxalyhqsnlqwuhnhiva"
+not *r2
+rts
+L49: bne L11
+jmp *r4
+mov r5, *r0
+jmp *r1
+L50: .string "epvxidbwc"
+L51: rts
+not L156
+cmp *r3, r3
+L52: .string "mqtlhjduuhvchsmac"
+L53: jsr *r6
+mov *r3, r2
+L54: .string "ltcuhmngjh"
+rts
+L55: .data 854, 528, -638, 460, -796, -189, 333
+jsr *r3
+lea L98, *r6
+stop
+L56: cmp r5, *r4
+red *r5
+prn r4
+mov L56, *r3
+L57: jmp L74
+rts
+red L43
+jsr *r0
+dec *r4
+L58: .string "ayoufrqbhdi"
+bne *r6
+jmp *r4
+L59: stop
+cmp L66, L15
+cmp L34, L75
+inc *r2
+L60: bne *r7
+rts
+rts
+jmp L38
+sub L118, *r7
+mov L44, L149
+add r6, r4
+clr L146
+L61: lea L40, *r4
+mov *r1, *r3
+add *r6, r7
+jmp *r3
+cmp L79, L137
+add *r5, L69
+sub *r2, *r6
+L62: .string "wwnpvav"
+lea L55, r3
+jsr *r7
+L63: not *r4
+
+jmp *r1
+L64: add #-14, *r0
+add *r3, *r0
+L65: .data 988, 885, -778, 654, 26, -158, 95, -460
+prn r1
+L66: rts
+L67: not r2
+rts
+cmp #176, r6
+sub L96, L58
+clr r2
+
+bne L25
+L68: dec *r5
+L69: .data 274, -809, 114, -673
+prn #128
+cmp r3, #-224
+red r3
+sub *r3, *r3
+L70: lea L127, r4
+rts
+mov L26, L24
+not L79
+sub r2, r0
+stop
+L71: red r7
+lea L14, r7
+bne *r5
+red *r1
+L72: .data 168, 457
+lea L244, L19
+bne L37
+jmp *r3
+jsr L10
+stop
+prn *r1
+not r6
+not *r5
+jmp L138
+jsr *r6
+stop
+L73: mov #-126, r2
+sub #183, L203
+not L91
+prn *r6
+add #-6, r3
+jsr *r1
+sub r3, *r0
+; comment
+L74: dec L200
+jmp *r7
+prn r6
+sub #94, *r6
+L75: prn *r6
+cmp r0, r0
+L76: not r7
+sub #107, *r3
+
+mov r5, *r4
+L77: .string "iwglillaphrvv"
+cmp #-230, #125
+clr L11
+not *r6
+sub L46, r7
+L78: rts
+bne L38
+mov r4, r1
+L79: .data 163, -116, 407, 359, -259, 780, 562, -448
+prn #3
+dec L70
+L80: inc *r5
+; comment
+not r0
+add L3, *r0
+sub *r6, r4
+L81: jsr *r4
+cmp L209, *r0
+mov #1, L63
+; comment
+mov r5, L51
+L82: not *r5
+bne L49
+L83: .data 597, -183, 552, -960, 771, -687, 895, -356
+inc *r0
+L84: red r2
+clr *r6
+red *r7
+; comment
+cmp *r4, *r6
+
+clr r7
+jsr *r2
+L85: .string "ekezzwiicghgowgr"
+mov *r1, *r6
+clr r5
+red *r5
+prn L223
+L86: jmp L50
+L87: .data 87
+mov L82, r0
+clr r7
+lea L126, L61
+inc L19
+jmp L197
+
+rts
+jmp L167
+
+mov L126, *r1
+mov L18, r6
+inc *r3
+
+L88: not *r3
+stop
+dec L41
+L89: .data -430, -214, -582
+; comment
+jmp *r3
+red L8
+lea L193, r3
+lea L13, L126
+dec *r3
+stop
+L90: prn *r4
+dec *r6
+lea L75, L209
+clr L68
+jsr L31
+jsr L62
+not *r4
+stop
+mov r7, r6
+inc r4
+
+L91: .data 676, -343, 109, 958, -740, -179, 636
+L92: stop
+bne L76
+L93: .data -408, -389, -788, -830
+sub *r3, r0
+cmp #254, L141
+rts
+mov *r2, r4
+not *r0
+not r4
+L94: lea L138, r6
+mov #-199, r1
+prn #14
+lea L252, r4
+jsr L177
+clr r2
+not r2
+stop
+jsr *r7
+jmp *r0
+red L100
+jmp L138
+red *r4
+mov r6, *r6
+prn L195
+cmp *r6, *r4
+L95: prn *r7
+rts
+cmp r6, *r7
+dec *r5
+rts
+red r7
+L96: red *r6
+stop
+red *r2
+sub L197, r7
+lea L133, r0
+add r2, L74
+L97: .string "xwpqllvneje"
+red L109
+red r4
+L98: not r1
+L99: lea L30, *r0
+L100: .string "kuo"
+sub #241, *r1
+L101: prn L42
+jsr *r1
+L102: bne *r3
+add #241, L226
+L103: cmp r6, #-192
+jsr *r0
+not *r7
+not L176
+dec r5
+bne *r0
+stop
+mov L59, L206
+L104: .string "mtcezrkcpsr"
+dec *r0
+prn r6
+L105: stop
+inc r2
+L106: dec r3
+L107: mov L28, *r5
+jsr L94
+L108: stop
+L109: .string "mclbdjvxaefzblqprbcutusz"
+bne L113
+add *r2, *r6
+sub *r3, r1
+jmp *r0
+lea L137, r4
+jmp L40
+prn #-181
+inc r3
+L110: inc *r5
+add r1, r7
+L111: rts
+not *r6
+
+prn L241
+dec L116
+lea L51, r0
+clr L110
+prn *r2
+L112: .data -576, -154, 54, -899, -105, 173, -216, 609
+; comment
+prn L182
+jsr L8
+cmp r5, *r5
+stop
+rts
+L113: prn #-8
+lea L72, *r7
+L114: bne *r4
+L115: jmp *r5
+sub #18, *r1
+sub #121, r4
+cmp *r6, #10
+L116: not L239
+L117: .string "sutgtmifipzksmrde"
+L118: mov #204, *r7
+prn #-222
+L119: .string "geccaf"
+clr L101
+L120: stop
+not r2
+L121: .string "vg"
+sub *r7, *r6
+dec r5
+add #143, r3
+L122: sub L157, r3
+L123: cmp r4, *r0
+
+L124: mov L171, r7
+cmp r6, L79
+inc *r1
+add L247, *r1
+jmp L175
+stop
+L125: .string "cish"
+add *r0, r7
+stop
+dec r4
+L126: .data 137, 22
+red *r3
+not L63
+inc *r5
+L127: .string "rixoghwjsrvjezqr"
+red L186
+L128: red r4
+mov L173, L141
+inc L219
+L129: red *r6
+dec r7
+L130: .data 555, 271, -188, -619, 922
+L131: .data -455, -739, -714
+cmp *r2, L136
+L132: .string "p"
+stop
+inc r4
+L133: .data -286, -136, -830, 205, 162, 493, -50, 375
+prn r5
+lea L138, *r6
+lea L224, *r2
+cmp r0, r5
+lea L238, r1
+bne L80
+bne L50
+L134: red r5
+sub r5, r0
+L135: mov L38, *r3
+
+jmp *r2
+sub *r2, *r7
+L136: clr *r2
+
+dec r6
+inc L245
+cmp #107, r5
+clr r6
+L137: .string "jfswlscwrcalacjmcvaeyxn"
+inc L125
+bne L147
+stop
+rts
+L138: red r5
+inc r4
+mov r2, L256
+inc r6
+; comment
+mov #-35, r3
+rts
+L139: .data 802, -434, 944, 376, -609, 207, 31
+
+cmp L240, #-48
+inc r2
+bne L252
+jmp *r5
+dec L14
+; comment
+jsr *r3
+L140: prn r7
+dec r4
+
+add L254, L163
+L141: clr r4
+sub #-189, r1
+dec *r3
+; comment
+L142: .string "bnqxyunvkdklfklwosqjbmk"
+L143: .string "jmydemrkogmcrq"
+lea L179, r4
+red r1
+L144: cmp L205, *r5
+red L197
+L145: .string "fnmkyt"
+clr L104
+L146: .data -850, 360, 695, -718, 754
+bne L42
+mov *r2, *r3
+jsr *r1
+L147: mov r6, r6
+; comment
+red L125
+stop
+L148: .data -221, 169, 387, 582, 117
+L149: clr L119
+sub *r3, r6
+L150: mov *r1, L117
+L151: dec r1
+L152: sub L169, r7
+L153: cmp *r3, *r1
+L154: add #4, *r0
+L155: not *r7
+rts
+red *r6
+L156: stop
+lea L228, r6
+not *r2
+prn L209
+jsr *r2
+mov *r7, r0
+sub r3, r5
+dec *r7
+stop
+L157: red L65
+add *r4, L84
+jmp *r7
+clr *r1
+prn #-15
+prn L7
+clr *r2
+L158: red L2
+L159: dec L254
+lea L117, L240
+lea L236, L169
+L160: cmp L40, *r5
+jmp *r0
+; comment
+inc r1
+jmp L163
+add *r6, *r0
+L161: .string "igqspevdju"
+L162: sub *r6, *r5
+dec *r6
+rts
+jmp L126
+red L16
+mov L180, r2
+L163: mov *r3, *r5
+dec *r7
+not *r7
+prn r4
+cmp *r5, r4
+mov L244, L151
+L164: .string "uuuysqdkbpxpkfmqbeweohh"
+mov r3, *r1
+cmp *r3, L125
+jmp L54
+add L167, L147
+mov *r7, r1
+red r2
+L165: bne L68
+L166: .string "dfppyhbstaz"
+
+clr r3
+L167: stop
+clr r2
+L168: bne L250
+L169: sub *r3, *r6
+clr *r4
+; comment
+add L12, L214
+L170: .data 359, 370, 86
+not L59
+L171: dec *r3
+mov #-44, *r2
+red *r1
+L172: .string "wqbjbzrztvaasodjznvpou"
+sub L192, r4
+cmp *r3, #151
+prn r1
+sub *r0, r0
+L173: rts
+L174: not L41
+bne *r3
+sub #-178, *r0
+add *r7, L26
+clr *r4
+rts
+clr *r5
+L175: red *r0
+L176: .data 694, -132, 157, 940, -841
+red L46
+jmp L127
+L177: .data 393, -915
+add #98, r7
+lea L11, *r4
+L178: inc *r4
+L179: not *r1
+; comment
+L180: rts
+L181: prn L81
+jsr L104
+dec r0
+lea L260, *r6
+L182: .string "zwkbceaghpns"
+rts
+rts
+prn *r2
+mov L188, L193
+L183: stop
+bne L255
+L184: prn L246
+red *r6
+stop
+prn r2
+L185: mov #-45, L225
+clr r1
+mov L30, r0
+prn *r2
+L186: not r0
+L187: .string "jjfoarpqvkb"
+red *r6
+sub *r3, *r2
+red L204
+jmp *r0
+jsr *r6
+prn *r3
+jmp L2
+red L212
+L188: lea L207, r3
+L189: .string "wxpeakrabouagtiiqods"
+jmp L116
+L190: red *r6
+rts
+add r6, r1
+L191: .string "rnshkq"
+
+sub #-173, r1
+L192: .data -26, 977, -340, 538, -267, 146, 762, 913
+L193: not L202
+mov #81, *r2
+cmp #26, r5
+prn L71
+jmp *r3
+rts
+jmp L172
+rts
+stop
+L194: red r7
+dec L12
+add *r7, *r1
+inc *r1
+
+jmp *r2
+prn r3
+cmp #136, r5
+mov *r0, L200
+lea L157, *r0
+bne *r1
+inc r0
+mov L133, *r0
+mov #-3, L206
+dec r2
+stop
+not r1
+L195: rts
+jmp *r0
+bne *r4
+L196: inc L210
+; comment
+L197: prn #-184
+L198: .string "dkemdugk"
+prn *r6
+stop
+L199: clr r1
+red *r4
+red L1
+mov #10, *r3
+rts
+stop
+add #-193, *r2
+jsr *r6
+stop
+prn r1
+L200: lea L243, r0
+L201: inc L245
+; comment
+not *r5
+L202: sub #183, *r0
+dec L244
+L203: red L225
+L204: not *r5
+inc L209
+dec r3
+sub r4, *r4
+stop
+cmp L20, #11
+L205: inc *r1
+L206: lea L240, *r7
+L207: bne *r3
+mov r4, L216
+inc L136
+jsr *r6
+L208: .data -114, -720, 943, 261, -646, 708, 879
+not r3
+cmp *r6, r5
+L209: red *r4
+L210: not *r0
+rts
+lea L25, r4
+L211: .data 439, -679, 426, -312, 361, 26, -137
+add r1, r5
+L212: .data -738, -602, 476, -963
+jsr *r6
+L213: sub #-254, L77
+lea L96, L216
+L214: red r0
+add r3, *r7
+L215: sub #43, L115
+dec *r1
+add L243, *r5
+dec r0
+inc r3
+bne *r4
+mov *r6, r7
+lea L224, *r1
+rts
+dec r7
+add L209, r1
+inc L208
+L216: .string "sydnflwjfamgocuasnjjmkyz"
+lea L248, r3
+dec r7
+L217: .string "mvpshmwnuyguzplnux"
+prn r1
+inc L194
+inc r4
+red L238
+rts
+prn #-129
+L218: .string "pclhsmeng"
+L219: .string "byxjnhhfxtanexfiersnr"
+red L208
+rts
+L220: stop
+mov L226, L256
+sub r4, L233
+bne L239
+bne L237
+L221: .string "bfiduekepzvusl"
+not r4
+not L78
+dec r4
+jmp L151
+prn *r7
+add *r1, r2
+sub L239, r5
+clr L237
+add #-224, *r0
+sub L248, *r5
+rts
+jmp *r3
+jmp *r1
+L222: red r4
+L223: sub *r4, L99
+; comment
+lea L168, L12
+cmp r2, *r0
+jsr L10
+L224: jmp L238
+dec L254
+jsr *r5
+L225: .data 31
+sub L230, r3
+red r6
+bne L151
+sub *r3, L259
+mov L236, *r4
+L226: lea L254, r1
+clr r3
+bne *r2
+jmp *r3
+L227: dec r4
+add #-35, r1
+lea L230, L22
+inc *r7
+
+prn #185
+prn L197
+L228: dec *r6
+cmp r4, r3
+L229: jsr L63
+clr r4
+jsr L11
+not *r3
+inc *r3
+L230: stop
+dec L256
+L231: clr L41
+L232: add #167, r2
+prn L235
+L233: stop
+add #122, *r0
+bne *r0
+jsr L241
+L234: prn #209
+L235: .string "llqrwxqo"
+stop
+cmp L54, r3
+inc L90
+L236: .data 585, -305, 327, -710, 904, 330, 855
+L237: .data -325, -126, -753, -666
+inc *r5
+bne L58
+dec L117
+prn #-26
+prn L242
+L238: mov L259, L139
+rts
+prn *r1
+red *r0
+mov r2, *r6
+sub r7, r0
+; comment
+clr r5
+rts
+sub #-63, r6
+add #181, r5
+add L245, L255
+rts
+L239: jsr *r6
+mov r5, *r7
+cmp #68, r1
+L240: .string "rpucnphvkbmewxfuqvqvpx"
+clr *r0
+stop
+L241: prn r7
+bne *r1
+add *r7, L86
+L242: inc *r2
+bne L22
+bne L249
+red *r2
+sub *r4, *r1
+mov r5, L54
+inc *r0
+mov L257, L243
+clr r6
+L243: mov L57, r6
+inc *r4
+L244: red r0
+clr *r3
+bne *r0
+L245: prn L53
+add r4, *r0
+jsr *r0
+mov r5, r1
+inc *r6
+prn L249
+L246: mov *r7, *r7
+jsr L250
+jmp L117
+; comment
+dec r2
+jsr L251
+L247: sub L250, *r7
+lea L196, L258
+L248: stop
+rts
+red *r5
+clr L214
+jsr L92
+jmp L39
+sub #-66, L255
+add #32, *r5
+inc L111
+L249: rts
+inc r4
+cmp #-111, L251
+lea L248, *r6
+L250: .data 593, 860, 125, 760
+lea L252, *r1
+; comment
+prn *r5
+L251: .data 746, 6
+L252: jmp L0
+red *r3
+red r4
+prn *r1
+L253: add *r7, L124
+bne *r1
+not L254
+sub L254, L256
+red r0
+inc *r6
+rts
+clr *r5
+mov L260, L255
+cmp r7, r7
+L254: jsr L210
+prn #19
+lea L257, *r6
+L255: .string "wcnynriifkxdsrbiidqtvm"
+add r0, r5
+add r1, L210
+
+cmp L122, #146
+
+inc *r6
+lea L137, *r7
+not *r4
+
+prn r3
+prn #68
+inc *r7
+L256: .data 87, 356, 990, -864, 999, 296, -592, -114
+jsr *r0
+bne L145
+L257: stop
+cmp #-52, r4
+L258: stop
+L259: prn r6
+cmp L260, #-107
+jsr L260
+L260: jmp *r7
+jmp L91
+inc r2
+stop
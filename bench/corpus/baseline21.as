@@ -0,0 +1,1018 @@
+; Generated by genCorpus --seed 22
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+L0: clr *r5
+bne *r4
+jmp *r6
+L1: .string "jjkxe"
+prn L126
+L2: red L2
+L3: jsr *r2
+L4: jmp L139
+
+clr r6
+; comment
+red L2
+red *r6
+prn L0
+L5: dec r5
+mov L4, *r5
+sub r6, r7
+L6: inc r6
+L7: .data -850, 752, 798
+jsr *r5
+stop
+L8: .data -411
+L9: mov r0, L199
+L10: bne *r6
+L11: red *r6
+not r2
+bne L3
+inc *r2
+inc *r6
+not L64
+bne *r7
+; comment
+add r7, L214
+red r6
+sub r2, *r4
+stop
+jmp L4
+L12: prn *r0
+prn r5
+bne *r5
+not L6
+lea L11, L4
+bne L212
+mov *r0, L12
+L13: dec *r1
+L14: bne *r3
+L15: .data 685, -802, -303, 145, 583
+not r3
+
+lea L79, L65
+jsr *r2
+L16: jsr L12
+add #-94, L12
+prn L2
+L17: .string "it"
+; comment
+L18: red *r0
+red *r3
+jmp L211
+add L9, *r3
+jmp L13
+lea L5, L16
+sub #-84, r5
+L19: add *r0, L18
+
+prn r4
+jsr L29
+L20: mov r5, *r6
+bne *r6
+L21: jsr L4
+L22: .data -373
+cmp r6, #-109
+stop
+not r7
+cmp L7, L181
+not L74
+bne *r5
+L23: lea L162, L252
+clr L237
+L24: .data -817, 920
+jmp *r2
+inc r6
+jmp L190
+cmp L246, r4
+clr L226
+mov L14, *r5
+clr r6
+stop
+cmp r0, L2
+jsr L15
+prn L20
+bne *r1
+stop
+dec r6
+L25: stop
+inc L17
+rts
+cmp *r3, *r7
+jsr *r4
+inc L58
+L26: prn #69
+stop
+L27: rts
+; comment
+; comment
+jmp *r0
+L28: lea L29, *r4
+rts
+L29: rts
+sub #58, L15
+jsr L58
+jmp *r3
+cmp L242, r4
+L30: clr r3
+dec r5
+L31: prn L193
+mov #189, *r1
+clr *r5
+rts
+L32: bne *r6
+red r6
+red L192
+prn #-196
+L33: .data 915, -416, -204, -226, 286, 586, -850, 562
+L34: mov L148, *r3
+prn r4
+L35: inc r5
+L36: mov r3, *r2
+clr *r3
+prn r7
+L37: not *r7
+L38: inc *r1
+jsr *r2
+L39: .data -374, 851, -875, -833
+prn r3
+clr *r4
+cmp r6, *r5
+L40: add L220, L34
+jmp L108
+stop
+jmp *r2
+mov #-52, L195
+bne *r6
+L41: jmp *r3
+L42: add #97, L26
+lea L36, r4
+lea L17, *r0
+jmp L30
+stop
+cmp *r0, *r3
+L43: .string "uxgqbrblydmoigtdotz"
+prn *r1
+lea L25, *r1
+lea L30, r7
+L44: mov *r2, r6
+L45: inc *r7
+
+prn #-185
+stop
+L46: .string "vnkef"
+stop
+clr L179
+jsr *r7
+not L0
+sub #-82, *r0
+clr r0
+inc L41
+L47: stop
+; comment
+jmp L42
+bne *r3
+cmp L46, *r5
+L48: prn L13
+L49: mov r4, *r6
+dec L28
+jsr *r7
+L50: .string "br"
+prn #158
+sub *r4, r1
+jsr L130
+sub r0, r6
+L51: .data -802, -151, -47, 384
+L52: mov L131, L51
+rts
+; comment
+prn L5
+L53: cmp L45, *r3
+L54: mov #150, r0
+clr r3
+clr *r2
+clr L40
+sub r1, r3
+red L114
+L55: .string "vwgmfga"
+cmp *r7, *r1
+not L91
+L56: .data 840, -905
+L57: sub r2, *r3
+inc *r3
+; comment
+not r7
+L58: clr L20
+bne *r0
+not *r6
+jmp *r6
+sub r1, r4
+L59: inc L176
+jmp L163
+inc *r2
+add #-147, L188
+inc *r4
+lea L108, *r1
+lea L121, *r7
+bne *r4
+inc r4
+
+L60: inc L33
+L61: .string "urhr"
+red L8
+cmp r4, #171
+sub #133, *r7
+clr r2
+bne L185
+rts
+sub #-2, r2
+
+add #-74, L232
+L62: .data -671, -891, 728
+not r3
+rts
+add L0, L29
+L63: rts
+inc L47
+prn *r4
+rts
+cmp r3, L166
+cmp r2, #-89
+rts
+red L250
+sub #-27, r4
+L64: mov #218, *r7
+inc *r0
+inc r1
+red L22
+jsr *r5
+not r5
+jsr L60
+L65: .string "nstce"
+add #163, *r1
+red L188
+stop
+L66: rts
+bne L61
+cmp r3, r6
+; comment
+L67: sub L115, r4
+dec r0
+prn L81
+prn *r1
+mov #101, *r1
+L68: .string "dtcqhr"
+rts
+rts
+sub #-216, *r4
+L69: cmp #-205, L80
+dec L134
+stop
+L70: .data 621
+L71: dec r4
+clr L246
+inc r5
+sub r5, *r5
+add r3, L4
+L72: clr *r7
+mov *r4, *r0
+mov *r7, L221
+bne L104
+prn #-42
+cmp L156, *r4
+rts
+L73: cmp L56, r6
+stop
+L74: cmp r5, r7
+clr L34
+L75: lea L144, L248
+clr r3
+mov L236, L61
+dec *r4
+
+prn #94
+jsr *r1
+sub r5, *r0
+L76: .string "w"
+add L25, *r3
+add *r1, *r6
+L77: .data -204, -279
+red L38
+lea L0, *r7
+mov r2, *r7
+; comment
+red *r7
+jmp *r4
+; comment
+clr L45
+inc *r0
+L78: prn #119
+L79: not r3
+rts
+dec r1
+sub #69, r6
+sub r3, *r5
+bne *r1
+; comment
+L80: stop
+not *r6
+dec L220
+stop
+prn L66
+L81: stop
+jmp L223
+red L75
+inc L27
+jmp L230
+not r4
+L82: prn #182
+lea L142, r5
+stop
+L83: inc L132
+L84: prn r0
+L85: jmp *r6
+mov r7, *r4
+lea L100, L200
+cmp L226, *r0
+dec r0
+mov #-220, L60
+add *r4, L197
+cmp #-91, *r7
+jmp L151
+rts
+not r1
+L86: inc L218
+L87: jsr L232
+L88: not *r5
+bne *r6
+red L193
+sub *r4, *r5
+rts
+red r7
+L89: .string "uuyfyssvstvyganu"
+sub r7, L6
+L90: rts
+sub L10, L47
+sub *r3, *r4
+L91: add *r2, *r0
+mov L89, L18
+prn #-81
+L92: .data 95
+red *r0
+bne L53
+add r7, r2
+clr r3
+rts
+dec r7
+jsr *r3
+red L95
+mov #-184, L86
+L93: .data 13, -591, -758, -723
+prn *r4
+; comment
+dec r2
+L94: bne *r2
+L95: .data 730, 166
+L96: jmp *r1
+lea L121, *r7
+L97: .string "ijjccg"
+sub #104, L83
+L98: prn L153
+L99: .string "ivumo"
+add L235, L161
+
+stop
+L100: mov #211, r6
+L101: cmp r1, *r7
+clr L42
+rts
+
+dec *r6
+mov #65, r0
+cmp #179, L39
+bne L9
+clr *r6
+L102: .string "owycygmtsf"
+cmp #-137, *r3
+jmp L224
+lea L47, *r4
+L103: clr *r0
+lea L15, r6
+red *r6
+stop
+L104: .string "m"
+not *r0
+
+jmp *r3
+prn #231
+dec r1
+prn L152
+not r0
+dec *r6
+prn L64
+L105: .data 304, -50, 872, -78, -131, 164
+L106: red r4
+L107: .string "cmverkoswnvdfbiz"
+not L146
+inc *r0
+add *r5, *r5
+inc r0
+add L65, *r5
+mov r2, *r7
+L108: not r1
+L109: stop
+
+mov *r3, r4
+jmp *r1
+mov L155, r4
+jmp *r6
+not L179
+inc r5
+lea L174, *r0
+rts
+cmp L191, #-118
+add *r7, *r4
+cmp *r0, L169
+L110: .data 75
+jmp L214
+L111: rts
+bne *r2
+jmp L160
+prn #197
+L112: lea L127, *r5
+dec L178
+add *r3, r1
+cmp L198, r2
+mov L184, r0
+rts
+mov *r2, *r7
+cmp r2, *r2
+bne L70
+jsr *r1
+L113: lea L110, L198
+cmp r7, L144
+stop
+
+
+add *r1, *r7
+lea L106, L180
+jmp L218
+clr r0
+bne *r2
+sub *r4, *r5
+stop
+inc L106
+cmp r5, *r5
+L114: bne L86
+cmp *r3, r3
+cmp *r2, L197
+L115: add L146, r4
+lea L183, L248
+clr *r0
+L116: .string "jphraaejwvxspcikpvzikcmr"
+cmp *r0, *r2
+stop
+jmp L176
+L117: .data 230, -950, 803, -131, -427, -358, 75, -625
+
+not r5
+L118: rts
+; comment
+L119: prn *r5
+add #159, r7
+L120: .data -145, 366, -996
+bne *r5
+L121: .string "b"
+jmp *r6
+red L16
+not L0
+mov *r3, *r7
+L122: .string "imrdjzdsdwwkvldlosdhslcy"
+sub *r6, L181
+; comment
+stop
+L123: prn *r2
+inc L135
+jmp *r2
+L124: not r1
+L125: .string "hqpvydx"
+red L17
+jmp *r1
+inc L150
+L126: .data 602, -654
+sub r5, *r1
+L127: clr *r2
+clr r1
+prn L188
+mov #72, r0
+inc r5
+; comment
+lea L24, L91
+L128: rts
+stop
+L129: .data 729, 495, -965, 856, -923, 140
+dec L99
+add #127, r3
+jsr L216
+L130: .data 464, -537, 809, -133, -686, -571, -962, 973
+sub L177, *r0
+sub *r1, r3
+jmp L115
+rts
+sub *r1, L164
+L131: bne *r7
+cmp r3, L103
+cmp L185, #-58
+jsr L98
+L132: rts
+rts
+add #-89, L66
+bne *r1
+stop
+stop
+rts
+mov L128, r5
+; comment
+L133: .data 209, -53, 797, 16, 424, -82
+cmp #-188, L53
+L134: jsr *r3
+
+jsr *r5
+prn *r0
+clr *r6
+lea L1, r3
+not *r7
+prn #-95
+cmp L58, *r0
+rts
+lea L205, r0
+sub r2, r6
+jsr *r3
+prn #-96
+mov L233, r3
+bne L208
+red r7
+jmp *r4
+stop
+prn L207
+inc r2
+L135: .string "xdgnuyydevlabifymevgztl"
+dec *r0
+not *r7
+mov r7, *r7
+L136: clr L84
+jsr L122
+L137: not r6
+dec r3
+L138: inc r7
+L139: prn *r3
+jmp *r7
+prn #-110
+sub L229, r6
+
+cmp L239, r1
+cmp *r7, r5
+L140: cmp *r2, #-153
+clr *r4
+cmp *r0, *r7
+cmp #171, r3
+sub *r3, *r5
+bne L110
+prn L52
+bne L217
+L141: prn #236
+L142: sub *r1, L55
+cmp L198, r0
+dec *r0
+red L15
+cmp #69, #7
+inc r3
+L143: rts
+stop
+mov r6, *r7
+bne L111
+cmp r3, L182
+not *r6
+dec *r2
+jsr L187
+bne *r4
+clr *r7
+inc *r5
+L144: red L253
+bne L134
+add r2, L93
+prn L22
+not r7
+stop
+L145: lea L198, L194
+stop
+bne *r2
+
+L146: sub L100, *r2
+L147: sub #211, *r5
+clr L223
+lea L45, *r4
+jsr L79
+L148: .data -715, -776, 79, -803, 845, -396, 557
+stop
+L149: inc L15
+L150: bne *r7
+L151: .data 731, 164, -716, -154, 52, 548
+
+mov L152, *r3
+rts
+L152: cmp L245, r0
+L153: .data 885, 578, -635, 356, 629
+prn #44
+sub L59, *r0
+jmp L156
+sub r0, *r0
+bne L16
+stop
+jmp L237
+jsr *r5
+L154: .data 954, -524, -432
+clr r1
+prn #-10
+add *r4, r0
+rts
+L155: jsr *r1
+mov #107, L158
+inc L153
+cmp *r3, #42
+L156: .string "sfbwzvhvuivqpsxrzhm"
+; comment
+prn #214
+rts
+mov *r7, L238
+L157: .data -773, -942
+not r5
+dec L242
+prn *r2
+stop
+
+prn *r4
+clr r1
+red r5
+bne *r5
+bne *r5
+mov *r5, *r3
+add r4, r5
+L158: .string "jsnwvbbknwho"
+L159: .data -397, 900, -318, 181, 284, 527
+L160: add *r3, r3
+L161: .string "zdfxjbpeb"
+lea L102, r0
+jmp *r1
+jsr L25
+dec L82
+L162: clr *r4
+jmp *r6
+L163: rts
+dec *r0
+cmp *r3, r7
+rts
+red r4
+L164: prn *r4
+
+L165: stop
+cmp L196, #128
+; comment
+prn #41
+; comment
+; comment
+add *r4, L38
+prn L137
+rts
+jsr L188
+L166: .data 298, -143
+L167: .data -556, -651, -359
+dec *r1
+clr r5
+sub *r1, r2
+L168: rts
+cmp *r2, *r0
+red L251
+lea L28, *r1
+sub r7, r4
+inc r1
+bne L184
+L169: jsr *r4
+L170: red L67
+L171: .data -269
+inc r2
+jsr *r3
+add L101, L41
+mov L234, *r6
+L172: not *r1
+L173: prn #-191
+L174: lea L67, *r6
+L175: jsr *r5
+L176: .data 12, -624, -550, -704
+mov #245, L11
+jmp *r4
+L177: .data -1, -141, -564, -33, -573, -154
+cmp #-30, #-20
+cmp #91, r0
+red L229
+L178: not *r6
+rts
+inc *r7
+add L211, L72
+L179: .string "oghndpgmqmyizxzgtv"
+red r7
+L180: .data -292, -897
+dec L196
+L181: not *r5
+jmp *r4
+L182: sub *r3, L187
+red r5
+sub #171, L231
+L183: rts
+sub *r6, L104
+L184: .data 572, 846
+add L230, L221
+; comment
+cmp #58, r0
+dec r5
+mov #-86, r3
+add L133, *r3
+lea L214, r5
+jmp L213
+L185: .string "qputexjyoc"
+cmp *r3, L222
+L186: add L167, L113
+L187: sub L112, L253
+stop
+L188: lea L120, L177
+stop
+L189: stop
+L190: .data -204, 126, -382, 720, -911, -711, 403, 848
+lea L192, r5
+sub #-109, *r3
+jsr L7
+L191: .string "uzuprykk"
+jsr *r3
+L192: dec L54
+mov L196, r1
+; comment
+inc r4
+L193: .data 769, 122, -376, -790, -901, -860, 971
+; comment
+L194: .data 286, 41, -652, 922, -124, 432, 131
+not L237
+bne L246
+L195: add #-129, *r2
+jmp L150
+inc r3
+lea L202, r6
+sub r1, r3
+; comment
+lea L125, r2
+red *r7
+clr r6
+inc r0
+rts
+dec r5
+; comment
+bne *r4
+prn #-18
+jmp L53
+cmp *r5, #226
+rts
+L196: .string "whdstmtdln"
+L197: .data -987, 825
+inc *r6
+not r0
+cmp L159, #105
+red L39
+L198: not *r0
+bne L231
+add #155, *r3
+inc *r6
+L199: clr L248
+L200: .data -812, -453, -506, 19, -506
+not r5
+L201: .data -454
+sub #173, L50
+jsr *r5
+lea L186, r1
+stop
+red r1
+jmp L216
+L202: .data -305
+L203: .data -596, -346, 458, 547, 34, 617
+rts
+jsr *r5
+sub *r3, *r3
+stop
+prn *r7
+bne *r2
+jsr *r2
+dec L224
+bne L241
+add *r3, r3
+
+L204: prn *r6
+jmp L230
+jmp *r5
+L205: dec r3
+L206: inc L231
+L207: .string "hhbtmhnybpbmvsmcarwd"
+red *r7
+not r4
+
+L208: prn L218
+rts
+L209: prn r0
+jmp L44
+
+jsr *r0
+L210: .string "rlfdvxeffnhvd"
+sub *r6, L60
+jmp L132
+L211: stop
+L212: red r0
+L213: inc L223
+sub *r7, r3
+L214: .data -833, -523, -73, 682
+prn *r3
+red L34
+inc r3
+rts
+add *r1, *r5
+L215: .data 484, 216, 210, 639
+red L222
+L216: .string "yaecbbvzftoiheimn"
+stop
+not L222
+bne *r6
+rts
+rts
+red L245
+cmp r4, *r2
+red *r6
+L217: bne L238
+cmp #190, *r0
+; comment
+mov #-256, L222
+dec *r0
+not L246
+
+sub L242, L40
+sub L221, *r5
+L218: .data -898
+L219: add L246, *r7
+L220: .string "gyhyjgaogy"
+not *r1
+rts
+L221: stop
+L222: mov #95, L188
+inc *r2
+L223: mov L153, r6
+inc L242
+not *r3
+inc *r0
+
+mov L252, L241
+L224: cmp L250, r4
+rts
+L225: jmp *r3
+red *r0
+L226: lea L252, r1
+L227: stop
+inc r5
+rts
+bne *r0
+
+clr *r0
+dec L237
+inc L220
+red L239
+add #-25, *r5
+red r4
+not *r2
+inc L88
+red L249
+inc r2
+cmp *r7, L250
+L228: add *r4, r1
+L229: jmp *r6
+inc r0
+; comment
+dec *r1
+dec r4
+dec *r6
+mov *r0, L252
+rts
+add #-48, r7
+inc *r4
+
+jsr L250
+lea L236, L161
+L230: .string "emlscblguovkawemmjemc"
+jmp *r4
+L231: cmp r6, L203
+add #-147, r4
+mov L251, L240
+not *r5
+jsr L54
+L232: lea L248, r2
+L233: sub *r0, L235
+L234: .data -412
+inc r1
+prn *r7
+lea L237, L251
+L235: rts
+lea L164, r0
+jmp *r7
+add L243, L202
+mov r0, r0
+mov *r2, r4
+mov #-252, L196
+prn L179
+jmp *r7
+not r7
+inc *r2
+L236: prn r7
+mov *r0, L232
+jsr L236
+sub *r6, r3
+L237: .string "ybyiaejtndjiv"
+dec *r1
+prn #-63
+inc L58
+cmp #-117, *r7
+dec L92
+add L243, r6
+L238: clr *r3
+jmp L1
+L239: mov r6, r6
+L240: clr *r1
+prn *r1
+sub *r2, L155
+not r6
+dec r0
+L241: sub L245, L91
+inc *r2
+not L244
+sub *r3, *r0
+L242: lea L249, L216
+L243: red *r5
+cmp *r6, *r6
+L244: .data -980, -495
+add L249, L46
+inc r7
+inc *r6
+L245: dec *r5
+stop
+lea L79, *r0
+L246: sub L35, *r5
+jsr L251
+clr *r6
+sub r0, L204
+L247: .string "nsnzzxdgzbohawfzptu"
+dec *r2
+cmp L1, r3
+lea L251, *r1
+L248: sub L88, L150
+jmp L249
+red r6
+not L62
+L249: prn #116
+prn r4
+L250: clr L234
+L251: .string "k"
+L252: rts
+dec L75
+mov L253, r3
+jmp L253
+stop
+
+red L253
+L253: stop
+
+cmp #-234, r7
+; comment
+red *r4
+sub *r0, *r0
+red *r4
+dec *r4
+cmp *r1, #246
+inc *r4
+mov r0, r1
+stop
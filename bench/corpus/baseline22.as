@@ -0,0 +1,1017 @@
+; Generated by genCorpus --seed 23
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+dec L55
+add L54, *r0
+cmp r6, r4
+L0: jsr L78
+L1: inc L24
+sub #9, L1
+L2: .string "adkcwbwfpxguwysiajd"
+L3: add L18, r7
+bne *r2
+jmp *r2
+cmp #29, r1
+mov #102, r5
+L4: .data 928
+cmp r4, L83
+jmp *r2
+; comment
+lea L161, L4
+dec r6
+prn #161
+; comment
+L5: .string "sdunyzulcyxzud"
+rts
+not *r4
+L6: clr r7
+sub L4, L121
+lea L5, L1
+red L4
+jmp L235
+dec r4
+red r3
+not *r7
+sub #249, L218
+red L93
+sub #80, r3
+mov #129, *r7
+cmp #78, *r2
+cmp L6, *r5
+cmp r1, #161
+jmp L204
+
+L7: cmp L185, L109
+add #-14, L119
+L8: .data 807
+lea L1, r6
+rts
+L9: inc *r5
+rts
+sub L169, r7
+lea L0, r6
+sub L96, *r4
+L10: add *r4, L111
+red r6
+inc L9
+sub #38, *r4
+clr *r1
+lea L97, L1
+L11: lea L231, r1
+cmp *r6, L98
+dec *r4
+L12: jmp *r2
+bne L165
+mov *r5, *r5
+L13: not r5
+L14: bne L144
+clr r6
+clr r5
+sub L1, *r3
+stop
+lea L70, *r1
+inc r4
+cmp *r1, *r1
+L15: red r2
+sub L2, r0
+stop
+red L2
+L16: .data 306, -385
+L17: .string "oqxqvylalxefwmjf"
+sub *r1, r4
+L18: .string "vpxuchnodhr"
+inc *r5
+jsr *r4
+; comment
+L19: .string "obpobldlzdrhtgnxnjj"
+add *r7, L48
+lea L4, r0
+mov L53, r0
+mov #247, L5
+rts
+cmp L5, r0
+bne *r7
+clr r5
+; comment
+red r0
+not L107
+rts
+L20: dec *r4
+mov #-108, L74
+L21: red *r1
+cmp L1, #213
+L22: .string "vuw"
+rts
+jsr L76
+jsr *r4
+; comment
+cmp *r6, L14
+not L19
+L23: .data 954
+L24: mov L136, r3
+L25: .string "auxfyadqkuxzjdbefbutq"
+rts
+jmp *r2
+L26: .string "iiaunuwpdgjf"
+clr *r2
+sub L148, L236
+L27: add #-148, *r2
+L28: bne L228
+L29: .string "vaqp"
+prn L74
+L30: .data -738, -286, 232, 574, 794, 508, 194
+mov r7, *r3
+red *r1
+add r4, *r6
+bne *r1
+add L11, *r5
+sub r1, L6
+add L29, r7
+bne L25
+L31: .data -958, -632, 252, 630, 115, 922
+cmp *r0, *r7
+L32: .string "ycpkamnrghspkmz"
+L33: dec r1
+stop
+prn r4
+clr *r1
+jmp *r1
+sub r5, *r2
+sub r1, L133
+bne *r7
+lea L11, *r7
+red r5
+red *r3
+jmp *r4
+dec r3
+inc *r2
+jmp *r7
+rts
+inc *r2
+sub L26, L7
+mov #59, r3
+bne L20
+clr r4
+clr L50
+not r3
+clr *r4
+mov *r1, *r0
+sub *r5, *r3
+jmp L22
+rts
+L34: add r0, L4
+clr r3
+jsr L103
+sub *r7, *r6
+prn *r2
+L35: bne L28
+sub #-83, L26
+mov r0, L2
+not r4
+inc r4
+red *r6
+lea L2, r5
+rts
+add #-182, *r0
+bne *r6
+sub L2, r1
+jmp *r5
+red L71
+lea L235, r4
+L36: .data -733
+L37: dec r4
+mov #-178, *r5
+cmp r6, *r7
+rts
+jsr L27
+lea L190, L96
+; comment
+sub L21, r7
+L38: .string "kjoucjsakrvbhbdfmpgbb"
+bne *r1
+jmp L0
+red r3
+mov #168, L21
+mov L82, r5
+jsr L182
+L39: dec r4
+sub *r2, L238
+bne *r5
+lea L56, r0
+L40: .string "hdwpqyrmqfepmfelqapomqk"
+clr r4
+L41: .data 492, 327, 54, -456, 477
+inc L19
+rts
+cmp L17, r3
+rts
+cmp *r3, *r4
+not L148
+stop
+cmp L202, #72
+prn *r3
+sub *r4, *r7
+jsr L160
+inc *r6
+L42: .data -302
+prn r5
+stop
+clr L37
+add L216, r0
+not *r2
+bne L26
+stop
+jsr L72
+stop
+dec r3
+jmp L108
+cmp *r0, L200
+L43: .string "ibtvdxalojgdvyeiqqomryyy"
+L44: stop
+L45: jsr L25
+bne L181
+; comment
+red *r7
+; comment
+cmp r7, *r3
+red L158
+L46: red L3
+L47: .string "zynbmdnelihpietnvyntsvsu"
+stop
+not r3
+L48: stop
+cmp L45, *r2
+mov r6, *r4
+L49: dec r7
+L50: .string "wrluozlsxraeoppjdnmak"
+bne *r0
+jsr L181
+cmp #25, #137
+dec L24
+clr *r4
+add *r2, L22
+not r6
+bne L146
+L51: add L53, L24
+mov *r5, r0
+L52: rts
+L53: .data -271, -667
+stop
+bne L32
+not *r4
+dec L32
+L54: .string "pbmbttthe"
+cmp L40, r3
+; comment
+L55: inc r3
+L56: jmp *r6
+cmp *r5, r6
+
+inc L20
+sub *r2, r0
+sub #-186, *r0
+jsr L10
+L57: add *r3, r4
+L58: .data -181, 168, 116
+L59: stop
+mov r5, *r6
+jmp *r5
+add *r1, *r2
+dec L223
+cmp #-128, r3
+inc *r6
+; comment
+red L76
+
+L60: .data -395, 25, -202
+dec *r0
+lea L40, *r3
+rts
+bne *r0
+mov r6, *r3
+jmp *r3
+L61: dec L107
+rts
+rts
+jsr L20
+; comment
+L62: .data 822, 34, 191, -585, -782, -616
+L63: cmp *r2, L66
+jmp L138
+L64: dec L94
+clr r2
+jsr L91
+L65: red r0
+jmp *r5
+dec r1
+not r4
+L66: dec *r4
+; comment
+jsr L121
+L67: prn r3
+; comment
+jsr L31
+not r2
+rts
+bne *r5
+lea L0, *r1
+prn L1
+bne *r5
+L68: cmp *r3, *r2
+L69: prn r2
+L70: inc L114
+stop
+add #-55, L9
+dec *r7
+L71: dec L39
+dec *r7
+not *r0
+L72: .data -368, 393, 297
+L73: lea L157, L47
+L74: inc L84
+inc r5
+
+L75: .string "biseoixyasof"
+L76: jmp *r1
+L77: mov L35, *r6
+mov #-42, r2
+rts
+jsr *r3
+lea L15, r7
+L78: .string "alyvieyhx"
+L79: dec L105
+inc L142
+jsr *r2
+cmp L61, L189
+prn #-228
+L80: bne *r7
+red *r7
+L81: rts
+; comment
+mov r2, *r1
+dec L33
+inc L71
+L82: .data -528, -855, -347, 64, -990, -163
+dec *r0
+cmp #-249, *r1
+clr L69
+prn r3
+jmp *r1
+rts
+add r7, r5
+jsr L12
+
+dec r0
+clr r5
+L83: bne *r6
+sub #-129, r1
+dec L46
+L84: sub #6, *r1
+; comment
+inc *r5
+cmp L127, L141
+not r4
+clr L57
+dec L23
+rts
+jsr L65
+mov L211, L208
+add #-210, r2
+inc r6
+rts
+L85: rts
+L86: .string "ydvxidjzdhcewppd"
+jsr L2
+jsr L161
+dec r4
+rts
+dec *r2
+prn #-165
+clr *r0
+L87: clr L10
+red L214
+dec L33
+L88: .data 43, 546, 655, -940
+add r0, r6
+sub r7, L28
+stop
+prn *r5
+inc L128
+L89: rts
+clr *r0
+bne *r4
+jsr L148
+clr L44
+add #107, *r0
+add *r6, L71
+red *r3
+stop
+jmp L27
+cmp #-127, #-244
+not r1
+L90: .data -189
+cmp r6, r1
+not *r0
+L91: bne *r0
+sub r0, *r6
+jsr *r3
+inc r1
+stop
+bne *r3
+red r4
+red L190
+L92: lea L104, L78
+mov *r1, r4
+stop
+jmp *r5
+lea L87, L30
+L93: lea L205, *r3
+clr r6
+mov #200, L85
+L94: clr *r0
+jsr L133
+L95: jmp L99
+bne *r5
+L96: .string "omlmrkunqnjizssbof"
+dec L226
+L97: .data -397, 464, -803, -895, -693, -296, -28, 704
+mov #214, *r5
+sub L87, r2
+red *r0
+add #24, r1
+red L164
+dec r2
+not L81
+stop
+L98: .data -511, 922, 721, 99
+add L129, L102
+jmp *r7
+prn r3
+L99: red L51
+prn L153
+prn r2
+
+L100: .data 11, -381, -668, -194, -903, 131, 12, -909
+prn #-170
+mov *r0, *r3
+not L51
+L101: cmp *r2, *r4
+L102: inc *r6
+rts
+clr r0
+prn L47
+jmp *r7
+lea L129, r7
+prn *r5
+stop
+dec L91
+stop
+L103: .string "p"
+L104: .data -26, -305, 671, -899, -227
+L105: .string "oxixbw"
+mov L224, *r5
+L106: .string "wjpubrclueulm"
+cmp *r4, L143
+sub #217, L117
+L107: jsr L152
+jmp *r2
+dec r5
+cmp r4, L35
+add #39, L147
+lea L198, r0
+cmp #248, r5
+clr L218
+rts
+L108: add #5, *r5
+L109: prn r4
+L110: add r4, r2
+rts
+jmp *r2
+jsr L51
+dec r7
+sub *r5, L158
+L111: stop
+rts
+L112: stop
+inc r0
+L113: cmp r0, *r7
+L114: .data -407, 420, 997, 594, -981, -798
+bne L36
+L115: .data -270, 333, 596, 333, -205, 136
+L116: clr r5
+
+dec r2
+not r3
+sub r3, *r5
+L117: bne L133
+L118: .data 592, 438, -485, 297, -820, 174, -635
+L119: .string "vsnjyihmw"
+add *r2, L222
+L120: .string "lhwzecvbqckckggbcj"
+dec r4
+inc r5
+prn *r1
+mov L5, r1
+jsr L218
+jmp *r7
+; comment
+inc r1
+clr L36
+stop
+L121: rts
+red L26
+cmp *r2, L58
+inc L147
+L122: add r2, *r0
+dec L227
+inc *r3
+lea L175, *r1
+rts
+clr r2
+L123: sub L235, L120
+stop
+L124: jmp *r7
+L125: stop
+lea L214, r6
+prn L19
+clr r1
+bne *r5
+L126: bne *r7
+rts
+rts
+clr r7
+bne *r3
+add #31, r2
+L127: .string "ibjsusuwxqgl"
+jmp L189
+L128: .data -511, -98, -160, -591, 227, -290, 268, -931
+L129: .data -952, -183, 884
+prn #149
+L130: rts
+L131: red L225
+sub L234, *r5
+rts
+L132: .string "thfncddlkhgsvobxdivm"
+L133: rts
+mov r2, L166
+dec r5
+L134: add r2, r5
+lea L123, *r1
+L135: red *r2
+not r4
+L136: .data -791, 695, -939, -104, 637, 405, 803, 877
+prn #183
+L137: sub L9, *r4
+L138: .string "wmvjtfulwhxqtpglwq"
+inc *r3
+prn #-139
+prn r2
+sub r4, L195
+L139: sub r6, r6
+rts
+clr *r6
+inc r3
+dec *r1
+L140: .data -788, 103, 525, 695
+mov L237, r3
+stop
+clr L107
+L141: .data 227, -878, 151
+not r7
+dec L107
+prn r7
+L142: rts
+sub L148, r7
+lea L145, r7
+stop
+rts
+red L203
+bne L127
+prn *r4
+jsr L223
+prn r5
+rts
+bne L37
+red r7
+lea L122, r3
+jmp L212
+not *r0
+inc r0
+rts
+jsr L86
+lea L143, r0
+red *r6
+red r4
+jmp *r7
+mov L47, L160
+mov L118, L192
+inc r1
+dec *r5
+lea L132, r1
+jmp L179
+cmp *r0, L120
+stop
+sub *r2, L15
+inc *r7
+rts
+L143: rts
+; comment
+stop
+cmp L211, #-83
+inc L111
+prn L147
+prn r4
+not r0
+mov #-16, L119
+L144: bne *r6
+L145: .data -267, -415, -885
+L146: add r7, L71
+rts
+cmp #-35, *r5
+L147: red L230
+add L117, r5
+red L156
+clr L37
+L148: .data -982, 43, -118, -861, -144, -533, 681, 174
+add *r4, *r7
+
+sub *r6, *r6
+jsr *r5
+clr L212
+L149: .data -595, 826, 346, -402
+
+inc *r2
+lea L86, *r3
+rts
+jmp *r3
+rts
+sub r7, *r5
+clr L178
+add #244, r2
+bne L91
+inc r4
+bne *r1
+L150: red *r3
+add L192, *r0
+L151: sub #-70, *r0
+L152: .data -36, -721, 495, -150
+cmp #233, *r1
+add #-154, *r0
+rts
+L153: red *r3
+bne L222
+add L155, L194
+add #166, *r5
+inc *r2
+inc r1
+clr r3
+not r3
+prn #-96
+L154: dec L83
+L155: mov #184, r1
+clr *r0
+dec r1
+dec *r3
+stop
+; comment
+cmp #-78, *r3
+L156: mov r0, L175
+bne L74
+L157: add L200, r5
+jsr *r4
+not r1
+sub L164, *r3
+mov *r6, r7
+red r4
+dec L104
+L158: jmp L217
+stop
+dec r1
+lea L160, L134
+L159: mov r4, L233
+not L165
+stop
+
+mov r6, r6
+L160: .data -859, 209, -947, 627, -978, -313, -777, -585
+lea L13, r1
+L161: not L231
+cmp #-227, L142
+; comment
+inc r1
+prn #-62
+cmp r7, L156
+prn r6
+; comment
+jsr *r0
+rts
+dec *r6
+L162: dec r6
+not *r5
+L163: .string "ttjnpmuypyxgntslarz"
+
+lea L193, *r1
+; comment
+rts
+cmp *r1, *r7
+L164: inc r7
+add L0, r4
+stop
+clr r6
+L165: .string "uupnvkoqimaej"
+cmp #191, *r4
+L166: .data -723, 448, -451, -608, -617, 607
+L167: .data 237, -832, -242, -36
+mov L205, L235
+L168: jmp *r0
+L169: .string "vybwi"
+jmp *r2
+
+lea L212, r0
+lea L41, *r5
+red L31
+; comment
+cmp L169, #-10
+clr r7
+bne *r6
+add L9, *r3
+clr *r1
+L170: red *r7
+L171: .data -686, -555, -757, 881
+bne *r1
+L172: .string "zdgyhrpjxb"
+jmp *r7
+lea L128, r4
+mov *r6, *r7
+cmp #-229, r1
+stop
+add *r7, *r7
+red r2
+mov *r2, *r4
+not L198
+L173: jmp *r2
+dec *r3
+; comment
+L174: add L218, r4
+L175: .data -137
+L176: .data -390, 855, 645, -768, 54
+L177: rts
+not L132
+not r0
+sub *r6, L8
+L178: dec *r4
+L179: bne L235
+; comment
+not r5
+not L199
+L180: inc r7
+inc L228
+L181: rts
+L182: .data -517, -861, -267, 729, 373, -652, -412, 306
+jsr *r4
+dec L101
+rts
+sub r1, r1
+L183: mov #195, *r6
+add #223, r3
+; comment
+; comment
+L184: lea L38, L229
+L185: .string "mbadobmrhtmcjuxmqs"
+not *r1
+L186: .string "g"
+cmp #-244, L0
+; comment
+L187: red L218
+mov *r6, r1
+clr r6
+stop
+L188: .string "qnjlqnaaxmogakby"
+inc r0
+jmp *r2
+stop
+L189: cmp #-153, *r5
+L190: lea L230, *r7
+stop
+not *r3
+add *r4, *r1
+lea L222, r5
+stop
+L191: .string "do"
+L192: mov *r3, r4
+L193: inc L105
+prn #66
+clr *r0
+clr r2
+inc L207
+mov r0, L12
+mov #177, r5
+; comment
+dec r1
+not *r4
+rts
+inc r6
+jmp L235
+rts
+mov *r7, L208
+rts
+L194: .data 547, -61, 597, 458
+dec r4
+rts
+red r3
+not *r4
+; comment
+prn #-229
+inc *r3
+bne *r5
+dec *r5
+inc L71
+not r5
+L195: not *r6
+L196: jsr L199
+sub r5, *r4
+L197: clr r4
+L198: .string "jtngxlsmzyrldlft"
+stop
+not r1
+L199: prn #-159
+L200: .data -328, -547, -39, -528, -76
+L201: .data 595, -769, 29
+mov r7, *r1
+L202: .data 763
+rts
+jmp L215
+inc L5
+L203: .string "vmm"
+cmp *r3, #85
+jsr L214
+add #-65, r5
+red r7
+inc L67
+L204: lea L62, r6
+cmp r0, *r3
+lea L233, *r1
+L205: rts
+lea L73, L184
+jmp L154
+lea L74, r1
+sub #-94, r0
+L206: red L220
+L207: dec L216
+; comment
+stop
+clr L47
+rts
+L208: inc *r6
+stop
+jmp L215
+L209: bne L71
+L210: lea L214, L98
+L211: stop
+L212: jmp L32
+not *r7
+bne L78
+L213: .data -123, -525, 772, 314
+dec L220
+L214: stop
+L215: dec *r1
+
+L216: not r2
+red *r4
+red *r6
+inc r1
+stop
+rts
+add #-252, L219
+; comment
+L217: lea L205, r1
+mov *r5, r3
+clr *r3
+bne *r0
+dec r0
+add r7, *r7
+L218: .string "a"
+jmp *r3
+cmp r2, #204
+jmp L234
+rts
+dec *r2
+clr L98
+rts
+L219: stop
+L220: inc r4
+dec r5
+; comment
+L221: stop
+clr r3
+red *r0
+sub r2, L229
+mov *r2, r7
+add r0, *r7
+L222: red L236
+jmp L169
+dec L234
+L223: .data 498, 274
+; comment
+clr r4
+jmp L145
+add #-37, L161
+cmp *r2, #41
+L224: jsr L225
+L225: rts
+add #239, L226
+bne L228
+jsr L178
+stop
+bne L234
+jsr L230
+prn r2
+inc r0
+stop
+add r2, L238
+not L100
+
+L226: inc r7
+jmp *r6
+; comment
+sub #-48, L224
+prn *r5
+L227: .string "cfywwlnaotyecctvbujgp"
+mov *r6, L236
+jsr L234
+sub #-63, *r2
+
+add r1, L30
+L228: lea L229, L229
+add L67, r0
+bne *r3
+mov L135, r6
+L229: .string "csaqppaivjut"
+add L236, *r7
+clr *r6
+rts
+stop
+clr L168
+inc *r2
+mov L230, r4
+dec L150
+L230: red *r4
+add *r3, L237
+rts
+not r0
+mov *r0, *r2
+jsr L231
+not L232
+sub r7, L11
+rts
+jmp L205
+jsr *r5
+L231: dec r2
+rts
+sub #-199, *r1
+mov r4, r0
+mov *r0, *r6
+L232: .data -925, 834, 958, 153, -467, -575, 796, 909
+prn *r0
+mov *r6, r2
+jmp L235
+jsr *r2
+dec r7
+sub L234, r5
+L233: .string "lzhvhhy"
+
+L234: add #167, L236
+inc L224
+lea L45, r6
+clr r3
+not L236
+inc *r1
+
+L235: .string "axjn"
+red L44
+cmp *r6, L106
+dec L237
+mov L237, L7
+jsr L234
+L236: stop
+mov *r7, *r7
+rts
+L237: .string "sdxbxlhcderzvnv"
+sub *r2, *r0
+lea L238, r5
+L238: bne L118
+; comment
+stop
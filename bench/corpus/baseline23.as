@@ -0,0 +1,1018 @@
+; Generated by genCorpus --seed 24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+L0: bne *r5
+bne L0
+not r0
+jsr *r0
+mov *r5, *r0
+L1: dec *r2
+L2: red r7
+bne L1
+; comment
+inc r4
+stop
+L3: .string "icpodsscfi"
+L4: red L79
+bne *r2
+rts
+L5: not *r7
+L6: .string "aimwhpv"
+prn L1
+rts
+inc r3
+L7: red L4
+L8: sub L173, *r4
+add #-213, L3
+L9: .string "oobpehquhmgoctchy"
+
+rts
+L10: rts
+not *r0
+cmp #21, L9
+red r7
+; comment
+L11: .string "oz"
+L12: lea L199, *r7
+mov L215, r0
+jmp *r3
+dec *r5
+not r4
+red L101
+bne *r1
+inc *r3
+red *r6
+not *r5
+stop
+cmp *r5, #-115
+red *r7
+sub *r1, *r2
+cmp *r0, *r2
+inc r1
+L13: mov *r7, *r0
+jsr *r3
+; comment
+L14: jsr L171
+clr *r3
+jmp L4
+L15: red r3
+rts
+dec r4
+clr *r3
+L16: .string "jdjpnwkmvxatl"
+add *r5, r6
+L17: rts
+lea L104, L17
+L18: stop
+add #-119, r7
+rts
+red *r1
+; comment
+lea L85, r0
+red *r0
+lea L15, L73
+clr *r7
+mov r4, *r6
+stop
+prn L3
+L19: inc r1
+bne *r1
+inc L7
+bne *r7
+red L117
+dec *r1
+cmp *r3, r4
+inc *r0
+L20: .data 818, -48, -684
+L21: .data 77
+L22: mov *r3, *r3
+lea L7, L11
+prn #13
+jsr L45
+lea L220, *r7
+prn *r7
+stop
+L23: cmp r7, r1
+lea L0, *r2
+jmp L109
+bne *r1
+red *r0
+rts
+jmp *r6
+rts
+mov *r7, L2
+jsr L183
+dec L78
+jsr *r4
+jmp *r4
+jmp *r5
+L24: .string "yoogwfubvfyxyqffe"
+jsr L225
+prn r7
+jsr *r7
+rts
+L25: not L121
+lea L164, *r0
+L26: jmp *r6
+prn L16
+jmp L176
+L27: prn L12
+mov #24, r3
+stop
+stop
+cmp L22, L24
+clr L166
+stop
+L28: .string "fyibmmmnbz"
+sub *r4, *r3
+inc *r1
+bne *r6
+dec L5
+L29: add L15, r5
+jsr L25
+L30: cmp *r3, r0
+L31: lea L120, L20
+mov r0, *r4
+stop
+not r6
+L32: bne L190
+L33: .string "en"
+cmp #-248, L18
+red L23
+L34: red r4
+rts
+prn r2
+cmp #145, L0
+not r3
+rts
+bne L6
+red L21
+stop
+add *r7, L178
+
+L35: jsr L219
+rts
+add L11, L28
+rts
+prn r3
+clr L179
+inc r2
+clr L125
+not *r5
+add #-211, r3
+stop
+L36: not L32
+add L204, L217
+red r2
+lea L213, r3
+jmp L10
+not r0
+lea L67, L9
+L37: not *r6
+red L14
+cmp r7, r1
+L38: red *r1
+add L21, L20
+L39: sub r4, L100
+cmp L8, r0
+jmp L8
+L40: .data 276
+rts
+L41: stop
+red r3
+inc L22
+
+L42: not r4
+jsr L38
+; comment
+L43: stop
+inc *r5
+lea L11, L233
+L44: .data 25, 569, -291, -67
+red *r3
+dec r6
+dec r3
+L45: clr L22
+bne L198
+L46: .string "djotvmziqwrtxq"
+lea L63, r3
+clr r1
+jmp *r2
+L47: sub L4, r1
+clr r3
+add #-235, L3
+L48: .string "hy"
+dec L34
+
+inc L4
+jmp *r6
+not r5
+red r7
+lea L96, L2
+lea L220, *r7
+sub r5, L82
+cmp #-133, L1
+add *r6, L234
+inc *r3
+jsr *r7
+rts
+add L50, *r1
+clr r4
+rts
+jmp *r7
+L49: .string "o"
+L50: .string "kcw"
+stop
+add L149, *r7
+L51: .data 228, 847, 368, -240, -974, 212, -634, -462
+dec L215
+clr r6
+jsr L203
+L52: .data -511, -593, 668
+L53: inc *r5
+; comment
+cmp r4, *r7
+clr r0
+stop
+clr r0
+prn L11
+L54: red *r2
+L55: .string "nnuztlcxjueozpaadfopgfq"
+rts
+prn r6
+prn *r4
+mov #-214, L18
+L56: .string "dhhwborigkkv"
+L57: .string "hydrfaqgaw"
+add #-203, r7
+clr L105
+cmp #89, L213
+inc L29
+L58: .data -208, -812, -722, -288, 356, 856, 873
+jmp L29
+clr r0
+L59: lea L12, *r1
+L60: jsr L195
+stop
+
+stop
+sub L8, *r2
+bne L41
+L61: jsr L3
+clr L6
+jsr L58
+dec *r2
+jmp *r0
+red L81
+add *r7, L48
+stop
+rts
+jsr L34
+
+add *r4, L242
+; comment
+dec L88
+L62: lea L243, r1
+rts
+rts
+inc *r1
+jmp L194
+cmp L29, L29
+bne *r0
+dec r0
+red *r5
+not r2
+prn L199
+lea L50, *r5
+inc L80
+add L35, r5
+dec *r0
+rts
+L63: not *r3
+
+L64: jmp *r2
+; comment
+prn *r4
+stop
+dec r0
+sub r7, *r5
+L65: .string "ngftpp"
+; comment
+rts
+red r1
+L66: .data -719, 276, -273, -392
+cmp *r1, L105
+add #-19, L17
+add *r5, L7
+cmp *r5, r1
+stop
+L67: clr r7
+L68: lea L162, L145
+lea L193, *r4
+add r3, r0
+rts
+; comment
+rts
+rts
+mov r5, *r0
+bne L92
+L69: .string "dyouefgydpnfacwajfd"
+prn *r0
+prn #150
+L70: .string "hrnaduxshtdkwsz"
+L71: .string "j"
+L72: dec L71
+sub *r7, r7
+not L34
+bne L72
+sub *r7, L19
+rts
+L73: sub *r7, *r3
+L74: .data 681
+L75: jmp *r5
+
+stop
+not r4
+jmp L17
+L76: jsr L114
+L77: .data -760
+mov r5, L202
+mov r7, r5
+L78: .data -919, -207, -237, -655, -546
+dec L185
+L79: inc *r1
+mov L50, L150
+jsr L232
+L80: bne *r5
+inc *r0
+bne *r0
+L81: rts
+add #79, r5
+jsr L78
+jmp L198
+rts
+L82: lea L67, *r4
+jmp *r0
+jmp *r1
+add *r1, L139
+jmp L76
+L83: clr L48
+L84: jmp *r6
+mov r2, L244
+prn r4
+add L30, r0
+L85: prn r4
+bne L0
+bne L58
+sub #-190, r5
+mov L150, r1
+; comment
+bne L68
+stop
+L86: .string "k"
+L87: bne *r6
+stop
+
+not *r7
+L88: lea L193, r0
+
+add r5, L66
+bne *r6
+inc L166
+L89: lea L78, *r7
+L90: .data -515, 834, -576, -7, 26, 627, 217, 635
+not L34
+; comment
+clr *r7
+L91: .data -674, -476
+rts
+L92: dec *r7
+mov L130, r0
+sub #-99, L213
+stop
+clr r0
+lea L94, L36
+clr L209
+L93: sub #178, r7
+jsr *r3
+L94: jmp *r6
+L95: .string "borvmauxjtcgpolfd"
+L96: not *r6
+prn L132
+; comment
+lea L226, r5
+bne L233
+red *r7
+rts
+L97: cmp r4, r4
+L98: .string "mojruocuqkqinnulnz"
+L99: stop
+jmp *r0
+bne L127
+jsr L10
+red r1
+jmp *r5
+L100: rts
+add r0, r0
+L101: red r1
+stop
+lea L103, *r4
+add r4, L72
+inc r4
+stop
+rts
+prn L4
+dec *r3
+L102: .data 321, -37, 637, 739, -720
+mov r2, r7
+L103: cmp #75, #166
+jmp *r6
+rts
+add r7, L12
+not L117
+mov r6, *r7
+inc L55
+rts
+L104: jsr *r1
+L105: add #-85, L84
+clr *r0
+stop
+L106: inc *r1
+L107: prn #-23
+; comment
+L108: prn L69
+L109: prn r0
+prn #247
+rts
+prn r3
+L110: mov L163, L136
+L111: sub r5, r0
+stop
+lea L211, *r1
+L112: add r1, L217
+red r7
+inc r7
+bne L215
+jsr L169
+not r2
+rts
+red *r6
+cmp L202, L138
+inc L220
+L113: .data 839, 22
+sub r5, L220
+jmp *r5
+L114: .data 471
+jsr L146
+not r5
+prn *r1
+L115: .string "pgdpt"
+L116: .string "dbhngrvzspdhvzgvg"
+jsr L192
+red r4
+jsr *r1
+stop
+prn r0
+L117: bne *r5
+rts
+L118: lea L222, *r6
+prn r3
+jsr *r4
+rts
+L119: prn r0
+bne *r4
+add L81, *r1
+stop
+cmp r2, #189
+not r3
+jsr L214
+sub L66, r0
+rts
+L120: .data 874, 916, 945, -833, 292, -924, -24
+prn L90
+dec L196
+bne *r6
+add r1, r6
+cmp *r4, *r0
+jmp L99
+L121: rts
+
+red r3
+not r1
+prn r1
+not r3
+stop
+L122: inc L71
+L123: .string "vgtnapuj"
+jsr L173
+sub *r0, L64
+rts
+L124: not r2
+prn #7
+jmp *r6
+
+L125: .string "jjwazpmgmi"
+L126: dec r0
+L127: .data 886, -156, -277, -321, -544, -890
+L128: cmp L171, L223
+inc *r6
+; comment
+stop
+dec r2
+clr *r7
+L129: jsr *r6
+lea L31, L242
+L130: not *r6
+L131: .data 574, 508
+bne *r2
+L132: .data -468, -80, 671, 935, 170
+clr *r0
+prn *r1
+jsr L70
+L133: bne *r4
+dec L83
+L134: lea L226, r4
+rts
+lea L57, *r4
+; comment
+not r6
+L135: red L147
+cmp #-67, L177
+L136: jmp L97
+L137: .data -806, -809, -910, -447, 12, -529, 344, 503
+L138: jmp *r6
+L139: bne L45
+stop
+; comment
+red L3
+dec L200
+clr *r3
+; comment
+bne L37
+inc *r0
+dec r2
+L140: .string "fuur"
+L141: .data 712, -291
+L142: jsr L9
+prn *r1
+sub #-182, *r2
+lea L186, r7
+cmp L212, r2
+; comment
+L143: .data -370, 187, 190
+L144: .data -557, -529, 790, -361
+lea L153, L177
+prn L11
+red L243
+cmp #195, #36
+L145: jmp L76
+cmp r2, *r7
+add L216, L228
+bne *r4
+sub *r5, L38
+L146: .string "yhalbnlstdvawvjlejwzosx"
+L147: clr r2
+clr r3
+inc L86
+stop
+
+red L103
+L148: stop
+cmp #-158, r1
+prn r2
+cmp #-35, r5
+bne *r0
+dec L96
+L149: stop
+prn *r6
+; comment
+stop
+stop
+red *r5
+L150: prn r1
+jsr L82
+sub L158, L83
+clr r7
+sub r6, *r7
+
+prn L57
+L151: dec r0
+L152: red *r4
+not *r0
+L153: .data 636, 110, 107
+L154: inc *r5
+inc r2
+not L166
+L155: not *r3
+; comment
+L156: not L189
+inc L241
+prn L50
+not r7
+add *r4, r3
+; comment
+jsr L87
+mov r1, r1
+inc L159
+bne *r3
+jmp L53
+lea L143, r1
+mov #80, L195
+rts
+L157: .data 153, 629
+cmp #121, r6
+L158: .string "hofkpnlqmpghxiemtjhsacw"
+sub r4, L17
+mov r2, r6
+
+not r6
+red *r5
+; comment
+add *r5, *r7
+not r3
+lea L146, *r1
+jmp *r4
+rts
+L159: bne *r5
+bne *r7
+prn r0
+mov *r5, L219
+cmp *r5, *r3
+inc L139
+L160: red r7
+jmp *r3
+red *r3
+bne *r7
+add #117, L122
+L161: lea L171, *r5
+add *r4, r2
+not *r1
+mov #158, r6
+red *r2
+inc L35
+clr L35
+
+L162: prn r4
+cmp L60, *r5
+inc r0
+L163: clr *r7
+dec L177
+rts
+stop
+; comment
+L164: .data 368, 296, -48, -503, 484, -645, 803
+L165: sub #-163, r6
+inc L75
+cmp r5, #129
+sub L149, r1
+bne *r0
+prn r2
+L166: .string "hzafwfgk"
+stop
+L167: .data 739, -55, 3, 31, 330, 672, 48
+sub *r5, r3
+dec L19
+L168: bne *r3
+L169: rts
+clr r6
+prn *r7
+bne *r2
+jsr *r1
+; comment
+cmp #-151, r6
+; comment
+L170: prn L28
+prn r0
+sub r6, *r4
+not r4
+add L229, L239
+rts
+jsr L106
+L171: .string "xokpzgvggwchcmidl"
+lea L6, r2
+jsr *r1
+cmp L222, L54
+cmp *r5, r0
+inc *r3
+jmp *r3
+mov L212, L234
+stop
+L172: stop
+prn *r4
+
+clr L200
+L173: .string "hvmd"
+rts
+sub #199, *r2
+L174: .string "cfxrclmub"
+clr *r3
+rts
+lea L55, L218
+L175: mov L84, *r0
+L176: .string "klonylezgpfqqijeefngsdb"
+rts
+L177: .data 229, 370, 165, -900, 645
+mov L188, *r6
+dec *r3
+sub L241, L54
+L178: lea L73, *r1
+dec L166
+L179: stop
+jsr *r2
+prn #3
+rts
+rts
+L180: not r2
+mov *r6, L46
+inc r4
+bne *r2
+prn L105
+L181: cmp r0, #49
+add *r4, *r1
+L182: jsr L138
+inc r5
+; comment
+inc L200
+not *r1
+bne L82
+L183: bne L158
+rts
+lea L240, *r0
+cmp r5, r2
+L184: lea L198, r5
+jsr L225
+mov L80, r0
+L185: .data 484, -579, 93
+clr L224
+L186: dec r7
+add *r6, L224
+L187: bne L128
+prn *r0
+prn *r7
+inc L132
+rts
+not r2
+cmp #135, L8
+cmp *r6, #-160
+
+
+cmp #-170, L209
+red r0
+L188: sub r7, *r1
+stop
+cmp *r3, L176
+prn r6
+lea L49, r0
+stop
+L189: add #-154, L16
+mov *r4, L231
+sub *r1, r0
+rts
+red r1
+jsr *r3
+; comment
+prn r0
+
+lea L187, r0
+L190: prn L132
+L191: red r7
+bne L226
+mov r4, r1
+sub r5, r2
+prn *r7
+L192: .data 97
+L193: rts
+dec *r7
+L194: inc *r0
+red L223
+inc r6
+sub r2, r6
+rts
+dec r7
+jsr L244
+L195: prn r7
+lea L80, r6
+not L244
+L196: .string "jpxnbjotbza"
+L197: lea L222, *r6
+L198: red *r5
+L199: .string "arnusebkrxomqdvqanfddjv"
+not r5
+L200: not *r5
+red r7
+L201: mov *r5, r6
+L202: clr L241
+dec r3
+L203: lea L242, *r3
+not r1
+stop
+add r6, r7
+not L198
+bne L213
+bne L86
+inc L138
+L204: cmp r1, L231
+inc L226
+not r3
+sub *r5, r4
+
+jmp *r6
+mov r1, *r5
+L205: sub #112, *r2
+mov #-153, *r0
+clr r6
+L206: .string "jutglpmydxgmy"
+lea L209, L204
+add #216, *r0
+stop
+lea L226, r5
+jsr *r5
+jsr *r7
+jmp *r3
+mov *r4, *r1
+L207: jmp *r0
+not r0
+L208: clr L157
+inc r2
+inc L226
+L209: .data -201, 153, 451, 86, -375, -187, -75, 540
+red r2
+sub #-205, *r7
+mov #-181, r0
+sub r1, r1
+L210: .data 840, -649
+add L37, r5
+add #-159, *r2
+L211: not L173
+rts
+; comment
+sub r7, *r1
+sub r2, r2
+cmp L191, r4
+rts
+; comment
+prn r7
+not *r2
+L212: .string "iajhpormpfdknxs"
+not *r4
+cmp #-61, L222
+lea L220, L85
+not *r6
+L213: red *r4
+prn #22
+not r4
+L214: .data -86, 516, -83
+red L121
+sub #-79, r5
+cmp L148, L237
+red *r4
+L215: prn L240
+dec L80
+prn L225
+
+dec r3
+L216: rts
+inc L66
+jmp L217
+lea L42, *r0
+stop
+cmp *r4, r4
+mov *r4, *r4
+lea L58, r4
+add r4, *r3
+
+L217: .string "q"
+; comment
+jsr L232
+L218: red r0
+jmp *r4
+L219: .data -772, 241, 66, -982, 656, 801
+clr r2
+L220: not L27
+bne L75
+rts
+not r2
+cmp *r6, #210
+prn #60
+L221: add r1, r3
+dec *r2
+inc *r5
+L222: add L79, *r5
+
+dec r7
+add r2, *r4
+; comment
+cmp #170, #54
+jmp *r6
+L223: red *r7
+L224: stop
+L225: bne L233
+cmp *r6, *r4
+cmp r1, r6
+sub r6, *r7
+jmp *r6
+lea L238, L49
+inc *r3
+L226: rts
+cmp L228, r2
+L227: prn L124
+sub L86, r0
+L228: cmp *r5, #-45
+L229: not *r1
+L230: mov *r7, r2
+rts
+L231: mov #130, *r4
+prn r4
+
+clr *r0
+inc *r1
+red L232
+add *r1, L241
+prn r0
+red r5
+L232: clr L236
+sub #59, r1
+sub r2, *r4
+clr L233
+L233: inc L226
+L234: jsr L243
+prn L235
+red r0
+prn r1
+stop
+clr r7
+mov #99, r3
+; comment
+L235: .data -497, 112, 977, -876, -787
+clr *r6
+inc *r6
+inc *r3
+L236: dec *r2
+bne L237
+rts
+red L197
+stop
+lea L78, *r1
+rts
+prn L244
+jmp L29
+clr L8
+inc L243
+jsr *r2
+not r1
+jmp L122
+jmp *r4
+rts
+L237: jmp L194
+jmp L240
+cmp *r4, L59
+cmp r1, r3
+red *r1
+jmp L146
+cmp r1, #17
+L238: .data 488, -861, 650, 914, -435, 71, 699
+sub *r4, *r6
+
+bne L239
+L239: .string "mu"
+L240: .string "paefjycjfzwvuscewrxr"
+jmp L159
+red r2
+red L244
+rts
+lea L243, *r4
+jsr *r3
+L241: inc *r4
+clr r0
+inc r1
+sub r2, L182
+prn #8
+rts
+cmp L234, #107
+red L66
+jmp *r1
+mov *r6, r2
+jmp *r0
+sub *r4, r2
+L242: .string "dprrvhuxqggnknjdliiij"
+prn L239
+lea L175, r6
+L243: stop
+L244: mov *r1, *r6
+add L219, r1
+inc r7
+stop
@@ -0,0 +1,1019 @@
+; Generated by genCorpus --seed 25
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+sub L144, L219
+mov r4, r4
+prn r0
+bne L194
+bne *r5
+rts
+prn *r1
+L0: inc L153
+clr L0
+L1: .string "rilypssumdplrcybtuwmkc"
+; comment
+rts
+dec *r0
+mov r3, L69
+jmp *r0
+stop
+add L1, r5
+red *r2
+L2: clr *r1
+dec r0
+red *r4
+bne *r7
+add r4, r4
+cmp #-185, #-106
+L3: dec *r0
+rts
+add L158, L2
+cmp r2, r5
+L4: jmp *r1
+L5: stop
+L6: .data 256, -327, -452, 414, -982, 125, -254
+L7: not r2
+clr *r3
+bne *r6
+jmp L3
+stop
+add *r2, *r0
+stop
+rts
+; comment
+stop
+jsr L2
+sub #98, L2
+not *r1
+jsr *r4
+
+add L0, L6
+L8: red r5
+jmp L5
+jmp L125
+L9: lea L1, *r5
+mov *r2, *r4
+L10: .data 491, 405, -725
+red r3
+lea L241, *r6
+mov *r2, r2
+jmp *r0
+L11: lea L70, L65
+L12: .string "dbnggwonowfpfcpeukb"
+jsr *r5
+rts
+prn r7
+not r5
+not L11
+cmp r7, *r0
+dec L7
+L13: sub r2, r4
+L14: bne *r2
+stop
+jsr L3
+red L220
+inc L11
+jmp *r5
+clr *r4
+L15: mov r2, r0
+L16: .data -562, 775
+rts
+jsr L206
+sub r6, L31
+; comment
+clr *r5
+
+rts
+stop
+lea L8, r7
+bne L9
+red L8
+L17: inc L15
+inc r6
+L18: jmp *r3
+sub r1, *r1
+rts
+L19: lea L15, L12
+L20: clr *r6
+L21: jmp *r1
+L22: .data 926, 805, 595, -578, 207, -639, 319
+; comment
+jmp *r4
+jsr L11
+lea L0, L117
+inc L16
+L23: clr r1
+cmp r2, L152
+L24: mov #253, *r3
+L25: add #-18, *r3
+L26: .string "goqthdxgyivz"
+jsr *r2
+L27: prn *r0
+L28: add *r4, L33
+inc L65
+lea L102, *r2
+not r2
+not L0
+L29: .string "wsecdksiwc"
+sub *r3, *r5
+cmp #-228, r5
+clr L59
+L30: stop
+clr L163
+add *r0, r7
+add *r7, L19
+dec *r1
+dec *r7
+cmp r4, *r6
+cmp #-249, r7
+L31: .data 600, 620, -610, 224, 663, -169, 831, -698
+add #192, *r4
+L32: .data -447, -141, -384
+red r0
+add L3, r0
+dec L243
+; comment
+cmp #111, *r2
+dec *r6
+L33: .data -13, 992, 332, 850
+L34: cmp L2, L4
+not L3
+L35: .string "uyvg"
+sub #17, *r0
+L36: .string "eekhkt"
+jmp L242
+add #7, *r4
+rts
+rts
+rts
+sub r4, r4
+; comment
+cmp r1, *r2
+rts
+jmp L15
+mov L134, *r0
+sub L33, L46
+mov r7, *r4
+bne L206
+mov r1, r6
+L37: add r6, r0
+rts
+clr *r1
+jmp L170
+lea L14, L215
+L38: red L116
+L39: not r4
+stop
+dec L28
+clr L27
+sub L34, L27
+lea L11, L155
+sub #238, *r3
+jmp *r7
+lea L135, L12
+bne *r0
+bne L11
+; comment
+inc *r4
+clr *r2
+add *r1, L31
+lea L235, L230
+L40: .string "pnotpfdjnuzokaqmxdh"
+dec L186
+add r3, *r5
+jsr L50
+prn #-172
+jmp L48
+add L16, *r7
+sub r1, L18
+jmp *r5
+jmp L40
+L41: .string "qgkyyakifbriybxahleqoce"
+rts
+jmp *r1
+L42: .data -91, -288, 283, -89, -526
+L43: cmp r2, *r4
+prn r7
+clr L1
+bne *r1
+mov *r1, r5
+prn #195
+inc r1
+L44: .string "tvhbtf"
+
+
+L45: .string "pt"
+L46: prn *r4
+L47: stop
+L48: jmp *r6
+jmp *r4
+jsr *r2
+sub *r1, r4
+L49: jsr L68
+not *r4
+jmp *r0
+rts
+mov r6, r7
+cmp #-43, *r7
+L50: stop
+L51: sub #-170, L50
+prn r6
+dec r5
+sub r1, *r4
+bne *r1
+not *r6
+add #-96, *r2
+jsr L17
+cmp r1, L37
+add #-228, L20
+rts
+red r2
+L52: prn #-220
+not r7
+rts
+rts
+lea L9, r0
+L53: prn L51
+cmp r1, r4
+jmp L149
+L54: red L18
+inc r1
+L55: sub #234, L112
+bne *r1
+jmp L47
+prn #4
+L56: .string "uiuhrxwcfzuylosk"
+; comment
+jmp L4
+dec L178
+L57: bne *r6
+L58: stop
+bne *r2
+clr *r1
+jmp *r1
+L59: .data -95, 548, -288, 752, -800, 864, -872
+; comment
+L60: mov L177, *r7
+prn r5
+not r5
+L61: lea L20, *r2
+rts
+bne L190
+L62: jsr *r5
+L63: lea L9, *r1
+L64: clr L217
+clr L100
+clr r5
+add L3, L48
+lea L199, r5
+L65: prn L173
+sub L2, L83
+not L185
+mov #135, r2
+not L86
+jsr *r3
+
+red *r1
+cmp #140, L169
+stop
+jmp L155
+L66: .string "p"
+not *r4
+L67: .data -449, 920, 285, -350
+prn #70
+red *r2
+bne L159
+
+L68: cmp *r6, r6
+L69: .string "kafocism"
+L70: dec *r0
+not *r3
+L71: rts
+red L255
+inc L207
+prn *r2
+L72: stop
+bne *r4
+lea L252, r5
+; comment
+L73: jmp *r6
+jsr L4
+inc L1
+add L11, *r7
+red L70
+L74: .data -856, 493, -326, 710, 365, -364, -773
+L75: add L56, r2
+L76: prn r0
+L77: clr r4
+rts
+L78: rts
+L79: .data -443, 427, -922
+sub #165, r7
+sub *r5, r4
+L80: mov L27, r4
+cmp r1, r6
+cmp #204, r3
+L81: .string "fbzokbtpjsajcpfus"
+not L101
+add *r3, *r5
+clr r6
+add *r5, r7
+red *r4
+; comment
+stop
+L82: bne L149
+jmp L182
+prn r4
+red *r5
+clr *r1
+inc L52
+L83: red *r1
+add r3, L177
+L84: .data 629, 281, 445, 493, 746, -347, -670, 324
+lea L76, *r6
+L85: .data 945, -582, -148, 359, -126, 99, -1
+L86: inc L243
+lea L89, L55
+mov #-50, r1
+L87: .data -518, 706, -645, 412, -360, 686
+jsr L62
+mov L66, *r5
+inc L6
+add r6, *r5
+L88: lea L242, r7
+L89: .data -670, 744, -800, -555, 23, 553
+clr L133
+not L44
+clr r1
+cmp #-199, L234
+rts
+dec r1
+L90: .data -508, 869
+dec *r1
+L91: not L7
+prn r3
+jmp *r1
+prn r4
+prn *r3
+not L184
+rts
+rts
+stop
+cmp L88, L69
+prn #22
+cmp #208, L64
+stop
+prn L192
+rts
+
+inc L4
+not *r1
+; comment
+jmp L41
+inc L36
+L92: add r4, r5
+sub *r2, L192
+dec r5
+mov *r2, L252
+bne *r2
+inc r4
+; comment
+L93: rts
+add L256, *r0
+
+L94: sub L34, L7
+L95: prn L12
+stop
+L96: .data 569, -472, 784, -719, 46, 25, 732
+stop
+L97: jmp *r3
+dec r3
+add r0, L107
+cmp L60, L221
+prn L61
+dec L240
+mov #-96, L187
+not r4
+L98: jmp L118
+rts
+prn L142
+L99: stop
+prn L208
+not r2
+add #-211, *r1
+jsr *r4
+L100: clr L30
+jsr L40
+jmp *r3
+jsr L102
+L101: stop
+inc *r1
+L102: lea L248, *r4
+dec *r1
+L103: .string "mojlrzmmhuqck"
+rts
+stop
+L104: .string "hptksivurlw"
+L105: .string "te"
+lea L245, r0
+cmp L40, L20
+not *r4
+prn #-226
+cmp L188, #138
+L106: sub *r5, *r3
+L107: .data 813, -587
+add #-183, L206
+dec L242
+mov L120, *r0
+jmp *r1
+rts
+jmp L129
+rts
+sub r3, r1
+rts
+L108: .data -403, 317, 460, 212, -336
+mov *r0, L112
+clr L252
+L109: .data 619, -748, 336, 516, -315, 196, 137, -613
+L110: rts
+L111: .string "dhm"
+bne *r6
+L112: jsr L118
+jsr L245
+clr L23
+lea L26, r1
+sub *r2, *r6
+cmp L105, #-34
+not L165
+L113: .data 88
+jsr *r6
+add #130, L209
+jsr *r2
+jmp L249
+L114: .string "qluqsme"
+lea L256, L170
+cmp #179, *r6
+; comment
+inc r2
+lea L205, L88
+jmp *r6
+L115: prn #-67
+prn r7
+stop
+inc r7
+inc r4
+add r7, r6
+cmp r4, r2
+; comment
+jsr *r0
+cmp r1, #189
+stop
+L116: .data -668, 347, -363, -720, -862, -312, -893
+not r2
+red *r0
+
+prn #171
+L117: sub *r2, *r6
+jmp *r3
+cmp r3, #217
+bne L216
+L118: add L122, L121
+jsr L83
+mov #-230, *r0
+bne *r1
+L119: cmp L150, r6
+add L167, r0
+
+rts
+dec L211
+red L153
+not L106
+rts
+prn #71
+cmp #-25, L148
+L120: add #22, r6
+L121: inc *r0
+; comment
+mov #125, *r5
+red *r1
+jmp *r6
+clr L235
+cmp L197, r5
+L122: .data 395, 245
+mov *r3, r0
+; comment
+dec L256
+prn L105
+stop
+red *r1
+red r5
+L123: stop
+stop
+lea L182, *r6
+mov #223, r2
+mov *r7, L7
+; comment
+stop
+L124: .data -291, 963
+L125: .string "yswzwvimhvpsqjwv"
+L126: lea L122, *r5
+L127: .string "klg"
+clr L85
+clr L33
+L128: inc *r6
+inc *r6
+add #-102, *r0
+red r2
+L129: jmp *r2
+
+not L227
+inc L109
+L130: .data 870, 788, -165, 967, -611, 956, 758
+red L40
+L131: jmp *r0
+L132: add r0, r6
+not L187
+L133: clr *r1
+cmp r5, #87
+jmp L54
+sub r4, L93
+lea L81, *r5
+stop
+stop
+prn #100
+not *r5
+add *r6, r3
+jmp *r1
+L134: .data 124, 635, -435, 751, -252, 657, -304
+not L63
+mov L80, L77
+L135: .string "gzihkbfl"
+L136: .data -769, 78, 464, 432, 27, -48, 798, 869
+mov *r3, r7
+inc *r4
+L137: .string "wqkonvjajrxazazpaqqmpxf"
+L138: mov r0, L139
+L139: not *r4
+add L212, *r1
+cmp #148, r0
+bne *r4
+jsr L89
+; comment
+rts
+not L20
+rts
+lea L106, r5
+add #248, *r1
+L140: jmp *r2
+red *r1
+bne L113
+; comment
+L141: bne *r7
+cmp *r7, L223
+not *r4
+prn *r1
+red r2
+bne *r7
+stop
+jmp L124
+L142: .string "dkafewrolqleb"
+inc *r6
+inc r7
+L143: dec *r3
+not *r6
+L144: sub #140, L120
+L145: .data 665, 149, 84, 151, -514, 609, -212
+; comment
+stop
+clr *r4
+
+sub #-201, L253
+stop
+mov r7, r1
+inc r0
+mov L94, r7
+L146: .data 279, 818, -896, 253, 505
+mov #-153, r4
+red L63
+L147: stop
+bne L91
+inc L120
+L148: .data 979, -543, 689, 835, 370, 665, 602
+sub *r6, *r1
+red r4
+L149: dec *r6
+L150: dec r4
+stop
+mov r4, *r4
+L151: lea L146, r2
+L152: mov #184, r4
+not L67
+dec r3
+L153: dec *r7
+
+L154: not r0
+jsr L144
+L155: stop
+mov #-61, L38
+dec r3
+inc r6
+sub L129, *r7
+L156: add r2, *r4
+L157: .data 205, -340
+L158: .string "lkongpjoeigu"
+mov *r1, r7
+dec *r4
+L159: red L169
+L160: dec L194
+lea L103, *r0
+not r3
+L161: .data 953, 86
+mov L167, r3
+dec L136
+clr *r1
+L162: cmp #-232, #107
+lea L256, L110
+cmp *r0, L219
+L163: .data -562, 880, -197, -766, -367, 438, -253, -339
+L164: .data -990, 615, -420
+red L180
+L165: .data -972, 471, -642, 552, 790, -951
+dec r0
+jmp *r4
+L166: .string "uaicoaupflrqluq"
+lea L77, *r3
+lea L246, L210
+stop
+rts
+stop
+not L15
+L167: lea L199, *r5
+sub *r4, L185
+inc *r5
+L168: .string "gnjrd"
+stop
+L169: not r3
+add #-93, r1
+prn #56
+stop
+L170: lea L232, L163
+mov L217, L138
+L171: .data -474, 815, 230, -531, -723, -920, 8, -912
+sub *r5, r7
+; comment
+lea L106, *r4
+bne L203
+sub #124, L47
+dec r4
+sub r6, *r3
+jsr L60
+L172: stop
+sub *r1, *r0
+not L213
+jmp L54
+
+cmp L256, r7
+mov *r4, *r5
+; comment
+; comment
+not *r2
+sub r0, L92
+prn r1
+red L181
+rts
+bne *r4
+add *r7, *r2
+add L177, *r5
+rts
+L173: add r7, r2
+L174: .string "gezelpufnycsuja"
+clr *r7
+lea L221, L221
+dec *r7
+L175: .string "cs"
+red *r0
+L176: .string "zq"
+lea L66, *r1
+red *r5
+rts
+
+jmp *r1
+; comment
+not r1
+L177: stop
+red L183
+L178: dec *r1
+mov L31, L172
+stop
+L179: .data 482, -123
+stop
+prn r3
+dec r4
+L180: .string "dlhiwkctaa"
+; comment
+lea L134, *r4
+bne L52
+lea L93, L246
+L181: .data 598, 822, 938, 275, -683
+red *r3
+inc r4
+L182: red *r1
+red L240
+L183: .data -636, 478, 362, 568
+lea L29, L121
+bne L58
+L184: red L54
+add #-41, L84
+L185: .string "lcpdtszcraezdellzldx"
+L186: rts
+jmp L220
+L187: prn *r6
+cmp r1, L231
+L188: .string "mdqgghxclbdpeddg"
+L189: mov L212, r1
+L190: rts
+inc L50
+rts
+add *r7, L78
+bne *r7
+inc L164
+stop
+L191: mov *r5, *r2
+L192: .data -932, -37, -395, -399, 614, 532, 346
+L193: cmp L147, *r2
+rts
+stop
+add L245, r1
+not L35
+
+L194: cmp r5, #227
+lea L255, *r6
+bne L65
+dec r2
+add #41, *r1
+sub L206, L104
+L195: jmp *r4
+jsr *r3
+mov r3, *r7
+bne L52
+; comment
+rts
+L196: not r7
+not L95
+red L250
+L197: .string "lhyrccsxlsvw"
+stop
+bne *r6
+stop
+add r2, r7
+jsr L78
+rts
+inc L200
+; comment
+red r3
+L198: sub r0, L25
+; comment
+not L57
+L199: sub *r7, L254
+red *r3
+add #-145, *r0
+L200: .string "cocfunlwleyoih"
+jmp *r3
+dec *r3
+cmp L75, L180
+L201: .string "besuuzuokizjq"
+L202: .data -604, 345, -167, 611, -991, -223
+clr *r0
+jsr *r7
+clr *r0
+; comment
+dec *r6
+prn L205
+lea L218, *r3
+L203: .data -789, -967, 222, -743, -732, -942
+prn #245
+sub *r0, r2
+sub #-143, L255
+not *r5
+jmp L174
+prn #-7
+
+jmp L100
+L204: red L205
+dec r2
+L205: .string "facfxqjkunbmzzsg"
+clr L231
+inc *r6
+mov r2, r2
+dec *r2
+L206: lea L94, r3
+rts
+cmp #175, *r7
+rts
+jsr L208
+bne L221
+cmp *r3, L216
+dec r0
+L207: .string "tozojyc"
+L208: add *r1, r0
+L209: bne *r7
+bne L137
+sub L118, L225
+L210: red *r2
+jsr L214
+stop
+L211: cmp L255, #-55
+lea L210, L170
+clr L201
+L212: jsr *r2
+
+prn *r4
+clr *r2
+jsr L221
+prn #138
+L213: .data 4, -702, -269, -905, 909
+stop
+add L227, r6
+L214: .string "hyahmc"
+mov r6, *r2
+prn *r2
+jmp *r5
+L215: dec L32
+sub #241, L255
+L216: .data -18, -509, 605, 617
+prn r2
+L217: .data -15, 180, -421, 351, 731, 293
+L218: prn #-140
+L219: .string "butwrzevboluvb"
+L220: .data -800, -918
+jsr L9
+L221: lea L76, L217
+L222: .string "jnuyqcxlygkmtfquonwdbntq"
+rts
+L223: add r7, *r4
+dec *r0
+mov r5, *r0
+L224: not r7
+stop
+add r1, r7
+cmp *r1, L33
+L225: not L226
+mov L219, *r5
+rts
+inc *r5
+lea L189, *r1
+lea L234, r4
+L226: sub L65, L232
+not L216
+jmp *r2
+red L114
+lea L243, L233
+clr L27
+; comment
+clr r3
+clr L204
+jsr *r0
+cmp *r7, *r0
+L227: .data 808, 710, 577, 190, -581, -610
+mov r1, *r0
+prn #-76
+red r0
+stop
+mov *r4, r1
+bne *r4
+bne *r5
+rts
+L228: .string "znxwopdeg"
+L229: add #-46, *r3
+inc L123
+rts
+L230: red L240
+dec *r0
+not *r1
+jsr L143
+L231: stop
+lea L51, *r2
+cmp *r3, L254
+L232: .string "klev"
+jmp L174
+L233: prn *r5
+lea L112, *r3
+red *r2
+jmp *r2
+red *r5
+inc L76
+L234: sub #48, *r1
+L235: lea L253, r2
+L236: prn #-129
+not L249
+; comment
+not r1
+L237: .string "npxqymzygjbsuzbfvlwl"
+jsr *r3
+dec *r1
+lea L228, *r5
+jsr L242
+clr L248
+prn r0
+lea L78, *r4
+mov r0, *r7
+inc r7
+sub *r1, *r2
+L238: prn *r7
+jsr L13
+mov #-185, r5
+stop
+L239: bne *r4
+L240: .data 334, -955, 815, -120, -692, -946, -367, -495
+mov r3, *r4
+stop
+rts
+clr *r0
+sub #82, *r5
+bne *r2
+rts
+L241: .data -619, -771, -979, -103, 17, -723, 75, 456
+prn L176
+prn L58
+red L192
+red L65
+L242: .string "bmbwacjcoubtbwuiclhmhts"
+jsr L4
+not *r2
+lea L253, *r6
+not *r7
+L243: bne *r7
+red *r6
+mov #-21, L129
+rts
+L244: cmp L252, #-244
+L245: bne *r4
+L246: .string "afcrznjobkxuim"
+
+prn #186
+red L3
+sub L98, *r0
+not *r2
+rts
+cmp *r7, *r2
+clr r6
+inc *r1
+L247: rts
+dec r2
+add r4, r3
+stop
+; comment
+; comment
+not L95
+L248: dec r1
+red L254
+red L5
+jsr L256
+jsr L232
+prn *r5
+bne *r0
+jmp L76
+L249: .data 831, -4, 484, -249, -83, 160, -105
+lea L250, r1
+inc *r3
+red r3
+stop
+mov L251, L255
+L250: sub r7, L76
+L251: cmp L64, L138
+L252: .data 740
+stop
+dec *r1
+stop
+rts
+not *r1
+; comment
+L253: jsr L256
+add r0, *r2
+jmp *r5
+L254: mov #98, r1
+mov *r6, L191
+jmp L255
+red r4
+dec *r6
+clr *r5
+L255: inc L55
+L256: not *r1
+not L156
+lea L249, r5
+stop
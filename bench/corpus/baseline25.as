@@ -0,0 +1,1020 @@
+; Generated by genCorpus --seed 26
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+red r4
+stop
+clr *r1
+L0: clr L0
+
+L1: jsr *r2
+lea L0, r3
+sub L1, L0
+stop
+rts
+dec L1
+add L162, *r4
+bne L248
+add r2, r0
+L2: .data 118, -301, 373, 525, -118, 444, 639
+rts
+mov r5, L3
+not L1
+L3: .string "hnslzovcjsvfxidbb"
+lea L83, r4
+rts
+lea L3, L248
+cmp L0, *r3
+dec *r3
+L4: mov #-15, L4
+dec *r7
+bne *r3
+not r3
+dec r6
+dec r2
+mov *r5, *r4
+L5: clr L2
+not *r3
+rts
+; comment
+L6: mov r3, *r5
+mov #60, L3
+add r6, *r0
+add #-212, r0
+stop
+not r5
+sub #64, L270
+L7: prn r7
+L8: rts
+bne L199
+L9: jmp *r6
+red *r2
+lea L17, r6
+dec L98
+
+L10: clr L6
+; comment
+L11: jsr L68
+L12: jsr *r2
+L13: .data -167, -782, 3, -423
+sub r2, r0
+jsr *r6
+
+rts
+L14: clr r7
+L15: .string "rbrwxcuptqjzhkg"
+inc L12
+L16: not L114
+inc *r2
+L17: .string "avkwb"
+red r4
+L18: add #-50, L36
+mov L7, L14
+prn r0
+red r1
+; comment
+stop
+prn r7
+prn #226
+clr L154
+clr r4
+L19: .string "qtpomvhuesmprpzqccxb"
+bne *r5
+jmp L3
+cmp r3, L99
+clr r7
+bne *r6
+rts
+clr L0
+red *r1
+bne *r5
+L20: prn r6
+L21: sub *r2, L21
+inc L63
+L22: dec r3
+stop
+bne L88
+jmp *r1
+bne *r2
+jsr *r7
+stop
+clr r7
+L23: cmp r5, r4
+dec L12
+mov r4, L148
+L24: .string "uvdtcynipdmq"
+L25: sub *r7, L209
+rts
+clr L4
+lea L12, r5
+clr *r1
+add *r3, L237
+cmp L117, #10
+stop
+clr L11
+L26: red L76
+dec *r0
+dec r3
+jsr *r5
+cmp #-208, L224
+cmp L25, *r6
+L27: .string "pdqiuuqfliilsamlvkjwnr"
+sub L119, r5
+inc r4
+red r2
+inc *r3
+add L181, L95
+L28: .data -427
+lea L185, r6
+jsr *r2
+jmp *r2
+cmp *r1, #-224
+mov #236, r0
+jsr *r2
+lea L27, r4
+L29: rts
+L30: jsr L6
+L31: sub *r4, r0
+jmp *r6
+lea L125, r2
+L32: .string "nnnjjtcutfbbodmyicu"
+not L115
+L33: add L129, *r5
+rts
+L34: .data 339, 644, 961, 113
+add r3, L9
+lea L78, r5
+L35: .data -75, -188, 931, -889
+L36: stop
+add L244, r6
+not L3
+L37: .data -853, 304
+L38: bne L20
+add #116, L28
+
+clr *r5
+mov #88, r0
+not r5
+mov #153, r4
+L39: stop
+L40: jsr *r1
+add r4, r0
+mov *r1, r6
+L41: bne L199
+L42: .string "blfjtfriaiup"
+dec r2
+cmp L152, r7
+dec L190
+; comment
+not r2
+L43: lea L15, L9
+cmp *r3, L30
+not *r0
+rts
+L44: rts
+lea L44, *r0
+red r1
+jsr L221
+red *r7
+red r4
+L45: dec r6
+L46: red *r4
+; comment
+jmp L7
+rts
+L47: jsr *r0
+prn #-101
+mov r6, r4
+inc *r1
+L48: bne L3
+dec L17
+mov #-115, *r5
+clr *r0
+inc *r7
+sub *r7, L250
+L49: jmp *r0
+L50: jmp L142
+red r5
+
+not *r7
+jsr L23
+not L79
+stop
+L51: sub L185, L45
+L52: .string "xuvsswulkqlwjqqptbzffzz"
+inc *r6
+L53: bne L258
+add r5, r4
+L54: lea L44, *r0
+clr r3
+lea L123, r6
+dec L195
+L55: inc r6
+L56: not L248
+stop
+lea L213, L51
+jmp *r3
+
+mov #-58, L30
+mov r3, *r7
+stop
+dec r5
+jmp L13
+jmp L2
+mov *r6, *r5
+L57: .string "qcxakqniffhphy"
+stop
+L58: jsr L56
+jsr L174
+L59: .data -629
+add L272, r6
+L60: sub r4, *r1
+L61: clr *r3
+L62: bne L43
+L63: .data -200, -145, 14, -442
+red *r2
+red L199
+L64: .string "etjxkqyidcaaalrj"
+dec *r0
+cmp *r4, #-181
+red *r4
+dec L50
+inc L39
+jsr *r5
+not *r0
+rts
+; comment
+bne L35
+inc r6
+stop
+L65: bne *r1
+cmp *r7, #53
+cmp *r0, *r5
+L66: inc *r0
+L67: mov #-23, r7
+stop
+L68: sub r2, r1
+prn r7
+mov L59, L5
+
+
+jmp L63
+bne L13
+L69: red L148
+bne *r0
+lea L14, *r2
+L70: prn #110
+L71: .string "qpmkgfnppzioao"
+L72: clr r7
+L73: .data 821, -19, 414, -913, -736
+L74: dec L57
+add *r4, *r0
+L75: .data 736, -187, -119, 934, -719
+mov #59, r3
+mov *r5, L221
+stop
+
+L76: jmp *r3
+inc r5
+jmp L104
+L77: bne L277
+L78: .string "yftmhicwtcz"
+rts
+rts
+
+mov r0, L273
+L79: stop
+prn *r7
+L80: cmp r3, r7
+not L8
+sub r5, L7
+not L163
+clr L253
+jsr L43
+dec L129
+mov L242, L20
+red *r4
+prn r6
+L81: bne *r3
+L82: .string "umtlnzxzkd"
+dec r4
+L83: .string "tipggdnmryleji"
+cmp #-70, r2
+L84: .data -391, -264, -845, -621, 772
+L85: sub r4, L253
+L86: clr L201
+L87: .string "vqwvdjvxeqlfsr"
+mov L274, r4
+
+mov L68, *r0
+stop
+L88: .string "rbiqqnuuy"
+dec *r2
+mov r3, *r6
+inc L81
+dec L30
+jmp *r4
+stop
+mov #43, *r6
+bne L24
+red r6
+not *r3
+stop
+bne *r3
+L89: jmp L161
+L90: lea L115, *r4
+stop
+jsr L36
+jsr *r4
+L91: lea L190, r1
+red L274
+prn *r4
+not r6
+L92: not r1
+lea L84, L136
+red *r4
+not L97
+add #-214, L121
+mov r0, r6
+jmp *r2
+L93: bne L99
+mov L40, r2
+lea L18, *r3
+add *r1, L34
+cmp *r5, *r2
+L94: jsr L134
+bne L168
+rts
+dec *r4
+L95: .string "uvnmodtz"
+add L42, *r0
+bne L12
+L96: .string "ftimitbfow"
+lea L124, L15
+stop
+L97: not *r5
+mov r4, L19
+L98: jmp *r6
+L99: mov L264, L79
+add #-67, r7
+cmp L137, L7
+not r5
+prn L83
+inc L66
+L100: jmp L167
+cmp #-73, r2
+L101: mov #75, L246
+L102: .string "olpfmxm"
+jsr *r4
+bne L86
+L103: .string "iviyyokhzysdvwj"
+jmp L54
+clr L102
+stop
+dec L96
+mov L206, r3
+jmp *r1
+cmp #107, *r5
+L104: lea L121, r3
+inc *r3
+stop
+L105: .string "etzhmjhrcnyplnnqhdqqou"
+L106: jsr L36
+cmp *r6, *r1
+L107: add *r2, r5
+rts
+sub L48, r2
+bne *r6
+clr r4
+bne L101
+red *r4
+stop
+mov #60, L86
+jsr L95
+lea L256, L34
+L108: .data -512, 704, 385, 45
+
+L109: rts
+L110: bne L49
+L111: dec L18
+L112: clr L215
+lea L64, r2
+sub *r3, L39
+jmp L236
+L113: not L201
+L114: red r5
+prn *r0
+inc L174
+L115: .string "zzvmtpsmsgyojpllcplimza"
+L116: .string "gkehlptkimbbf"
+L117: .data 717, 280, 614, 349, 32, -410
+dec *r5
+lea L67, L203
+inc L42
+not L249
+sub *r5, *r2
+prn *r5
+L118: clr L277
+clr L176
+rts
+L119: inc r6
+L120: inc *r2
+L121: jsr L66
+L122: .data 381, 282, -545, -842, -155
+red r4
+jsr L36
+stop
+lea L58, L175
+L123: .string "uigcqcvxfkaraymjg"
+jmp *r7
+rts
+L124: .data 655, 646, 425
+cmp *r1, r3
+bne L57
+add r1, L86
+clr *r3
+; comment
+not *r4
+clr r5
+L125: .data 639, -672, -443, 206, -341
+L126: dec r0
+red *r1
+prn #-254
+jmp L7
+inc *r7
+L127: add L242, r3
+L128: lea L238, L109
+inc L58
+dec L259
+jsr *r5
+clr *r1
+mov #50, *r2
+prn L7
+cmp r7, L111
+add #245, L207
+red r3
+L129: stop
+lea L20, r1
+red r6
+jmp L96
+prn L108
+inc L57
+rts
+inc r5
+dec r1
+stop
+L130: not *r3
+L131: .string "ugqvxfhhcft"
+L132: add L21, *r7
+L133: .data -59, 794, -547, 784, -976, -56, 99, 667
+rts
+L134: sub #173, L67
+L135: add #176, r7
+rts
+L136: .string "syysztoxew"
+cmp L266, L207
+inc *r6
+jmp *r2
+jsr *r2
+not *r2
+red r7
+add #135, *r7
+lea L70, *r1
+mov r4, r3
+bne L140
+L137: rts
+L138: red r7
+jsr L53
+L139: clr r5
+prn *r3
+L140: jmp *r7
+mov #-174, *r5
+L141: red r4
+prn r0
+L142: prn #238
+bne L90
+L143: rts
+sub *r6, r4
+not r4
+jsr *r7
+L144: bne L64
+clr r3
+inc r0
+add #-111, *r3
+L145: lea L257, L155
+L146: .data 707, -281, 552, 676, 606, -702
+not *r4
+prn L77
+sub *r6, r7
+L147: .string "x"
+red *r5
+L148: .string "vwhmlwopnok"
+inc *r2
+jmp *r2
+jsr L30
+jsr *r0
+prn #235
+L149: clr r6
+L150: mov #236, r1
+L151: stop
+sub L147, *r3
+stop
+prn L211
+mov #34, r1
+jmp *r4
+dec r7
+L152: clr *r6
+L153: .data -194
+; comment
+L154: .string "a"
+prn r7
+add L198, L171
+L155: not L106
+sub r1, L269
+cmp *r6, L234
+clr r7
+L156: lea L68, L254
+mov L142, *r4
+mov #43, L170
+sub #15, L120
+add L21, *r0
+jsr *r7
+rts
+inc L161
+L157: add *r7, L208
+not L264
+bne L190
+add L177, L75
+inc L94
+prn L40
+mov #7, r6
+jsr *r3
+inc L85
+jmp *r0
+L158: .string "dvlpfqdypftvnvpmx"
+bne *r7
+cmp r3, *r3
+lea L262, L178
+not *r6
+rts
+mov L253, r6
+sub r0, L26
+inc r3
+stop
+rts
+lea L48, L29
+clr *r3
+L159: not L149
+mov r6, *r6
+dec r0
+rts
+cmp #84, *r4
+L160: mov r2, r1
+L161: mov L72, L36
+stop
+L162: mov r0, r3
+bne *r5
+; comment
+; comment
+prn L119
+lea L243, r5
+clr r2
+cmp L17, *r2
+not r3
+jsr *r7
+prn L190
+
+inc L16
+L163: .string "wuxqv"
+L164: .data -703, 88, 132, -691, 44, 724, -495
+stop
+stop
+bne *r4
+L165: inc *r5
+clr r1
+stop
+rts
+jmp *r4
+bne *r7
+L166: prn *r5
+stop
+red *r6
+L167: jsr *r3
+jmp L170
+rts
+add r0, *r6
+jmp *r5
+L168: .string "qhibnvspurbpsxuiszcwx"
+inc *r6
+cmp *r0, #136
+rts
+sub *r6, r7
+clr *r3
+L169: jmp *r0
+cmp L78, *r5
+; comment
+L170: sub r7, r5
+L171: stop
+L172: sub #-70, r0
+L173: cmp r5, *r2
+not L97
+not L164
+rts
+L174: prn L274
+L175: inc L235
+sub *r4, *r3
+L176: .data 435, 27
+L177: jmp *r4
+L178: bne *r6
+prn #29
+L179: .string "cvextm"
+rts
+L180: dec *r5
+L181: inc *r4
+mov r3, *r0
+L182: dec L228
+not r3
+L183: .string "fsnycnqyiregxiehvklc"
+L184: .data -841, -937, -758, -558
+L185: .data 540, -455, 933, -777, -534
+add *r1, r4
+cmp r1, *r4
+prn #159
+
+L186: jsr *r0
+not r2
+add #-186, L37
+L187: dec *r4
+not L22
+cmp L210, *r1
+; comment
+L188: .string "al"
+inc L114
+prn L211
+bne *r6
+not L188
+cmp L258, L92
+rts
+inc L118
+rts
+L189: stop
+mov L107, r6
+L190: cmp #-126, L38
+add r5, r1
+prn #200
+L191: .data -776
+L192: add r7, r6
+L193: red *r6
+inc *r2
+mov #60, L264
+cmp *r4, *r0
+dec L157
+inc *r7
+bne *r3
+red L233
+clr r1
+; comment
+L194: inc *r4
+sub L156, L80
+jsr *r7
+mov L273, L10
+; comment
+L195: prn L170
+L196: not L114
+rts
+jmp *r6
+lea L271, L217
+bne *r7
+sub *r7, L136
+red r7
+not L90
+bne *r6
+L197: stop
+cmp *r1, r4
+jmp *r3
+
+not *r0
+add *r1, r6
+inc L220
+rts
+not r6
+L198: inc *r6
+bne *r6
+L199: red L225
+rts
+L200: sub *r5, L232
+jmp *r6
+jmp *r2
+jmp L194
+clr *r5
+not L11
+L201: add #-87, r5
+jmp L0
+L202: lea L277, *r3
+L203: rts
+cmp L222, L267
+sub *r5, r7
+add *r6, r6
+clr *r1
+add *r4, r4
+L204: red *r0
+rts
+cmp *r4, *r6
+add #9, r1
+dec L249
+prn L240
+L205: jsr *r2
+red r1
+stop
+jsr *r1
+rts
+L206: .data 880, -899, -434
+jmp *r1
+bne L82
+clr r5
+add L220, *r3
+not L152
+add r3, *r1
+L207: jsr *r3
+L208: red *r0
+sub L222, *r6
+red L236
+prn *r7
+red *r0
+; comment
+lea L234, L240
+L209: .data -417, -516, 579, -764, -543, 788, -899, -442
+; comment
+dec *r5
+L210: .string "eacmkirtunvzdkbq"
+L211: .string "wglhck"
+dec r6
+L212: .string "nr"
+L213: sub #-213, L244
+clr r7
+sub r5, *r3
+rts
+bne L84
+lea L257, *r0
+L214: .data 21, 566
+; comment
+lea L230, r1
+red *r6
+lea L108, *r2
+; comment
+L215: .data -394, 908, -770, 170, 578, -633
+jmp L244
+cmp r1, #-168
+sub #-51, r4
+L216: prn #134
+clr *r5
+rts
+dec r2
+inc r2
+L217: .data -142, -606, 960, -327
+not L256
+cmp #140, #-156
+prn *r5
+stop
+L218: red r3
+not r3
+L219: add *r5, *r3
+stop
+not L244
+L220: .string "fniqn"
+jmp *r1
+rts
+
+add *r0, *r4
+sub #-51, L165
+L221: jmp L253
+inc r2
+bne *r2
+; comment
+cmp #128, #106
+L222: prn r4
+prn #-143
+clr L226
+sub #-239, r5
+mov L269, *r1
+L223: .data 228, 631, 227, 978
+jsr L22
+jsr L230
+bne *r7
+cmp *r4, L269
+clr r6
+L224: rts
+mov r5, r5
+L225: .data 92, -854, 95
+bne *r0
+L226: .string "znk"
+; comment
+mov *r3, r2
+clr L267
+L227: add #32, r0
+sub *r5, *r2
+L228: lea L229, L239
+; comment
+cmp #-198, r1
+
+L229: prn #126
+bne *r7
+add L261, *r3
+jmp L162
+L230: mov *r1, *r3
+L231: prn L264
+dec r3
+L232: rts
+cmp L243, r4
+clr r3
+L233: .data 371, -953, 703, -667
+cmp L244, *r4
+
+sub *r0, r0
+cmp r2, *r0
+
+dec L255
+sub r0, r4
+; comment
+lea L270, *r2
+
+add r7, r1
+L234: not r2
+L235: cmp #-256, #225
+red L124
+sub *r7, *r7
+prn r5
+inc *r7
+bne *r4
+stop
+prn *r6
+
+cmp *r5, L231
+lea L86, r7
+jsr *r7
+sub #-222, *r1
+clr L263
+prn *r0
+prn r3
+; comment
+mov #-165, L95
+L236: .string "jxiqywbatuntmhocsycc"
+L237: dec *r4
+L238: bne *r7
+sub *r4, r7
+inc L28
+L239: not L187
+L240: cmp #-202, *r5
+jsr L214
+; comment
+rts
+not r7
+L241: cmp *r1, L125
+not L202
+clr L249
+jsr *r1
+lea L231, *r4
+; comment
+; comment
+L242: stop
+jmp L130
+
+stop
+L243: jmp L277
+cmp *r3, *r3
+L244: mov *r4, L266
+L245: inc L20
+L246: .data -260, 207, -174, 600, 879
+cmp *r3, *r3
+bne *r6
+mov #181, *r4
+L247: not L255
+red *r0
+dec L48
+inc *r5
+L248: lea L254, L86
+inc *r4
+add #-222, r0
+L249: rts
+red r5
+L250: inc *r1
+jmp *r7
+L251: lea L148, *r2
+lea L210, *r1
+add *r5, *r4
+mov #27, L38
+L252: jsr L260
+dec L7
+L253: red *r5
+mov #-188, L63
+L254: bne L216
+
+L255: jmp L170
+jsr *r6
+L256: rts
+stop
+add L274, r6
+stop
+inc *r4
+L257: cmp L272, L269
+L258: rts
+jsr *r5
+sub r7, *r6
+prn *r7
+jmp *r4
+red *r2
+L259: rts
+sub #4, L240
+lea L265, *r2
+L260: bne *r2
+jsr L178
+add L65, r3
+lea L27, r5
+L261: .data -413, -122, 302, 564
+L262: jmp L277
+stop
+mov #-235, L109
+lea L263, r7
+clr r6
+stop
+jmp *r4
+L263: .string "ihpcvhqaygvloa"
+prn r0
+mov L245, r1
+L264: mov L275, *r6
+jsr *r0
+stop
+lea L269, *r5
+lea L106, *r6
+prn r2
+cmp *r0, #133
+lea L262, L227
+jsr L53
+clr *r3
+add *r6, r7
+L265: clr L275
+
+L266: lea L30, L273
+sub *r6, L199
+sub *r1, *r7
+stop
+cmp *r7, L121
+L267: jsr *r2
+clr L275
+add #185, L273
+stop
+dec r3
+mov L269, r6
+rts
+dec L56
+L268: .string "uunvpphwjrgjmc"
+mov L19, r4
+jmp L277
+sub *r3, L259
+L269: lea L49, r3
+dec *r3
+red *r7
+lea L270, L116
+cmp L17, *r5
+bne *r4
+bne *r5
+L270: rts
+L271: .data 627, -275, 338, -201, 403, -381, 586
+; comment
+cmp *r2, L254
+sub *r6, r1
+L272: mov L165, *r6
+stop
+not r1
+not *r0
+jsr *r2
+jsr *r3
+L273: inc L12
+sub *r1, r5
+L274: .string "zzftgiq"
+rts
+L275: dec L276
+add L277, r5
+L276: jsr *r5
+L277: .string "cqrqrpy"
+inc L103
+
+add #-46, *r7
+jmp L56
+dec r6
+stop
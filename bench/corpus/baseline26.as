@@ -0,0 +1,1021 @@
+; Generated by genCorpus --seed 27
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+not r0
+L0: .string "b"
+L1: bne *r5
+red *r2
+clr *r1
+add *r2, *r0
+jsr L114
+add L1, L1
+add *r3, r4
+L2: add r5, *r7
+L3: .string "isxnqs"
+sub L146, *r4
+cmp #-85, L3
+L4: .data 305, -158
+dec L4
+prn *r6
+L5: red r2
+bne L180
+jmp *r2
+L6: jmp L2
+jmp L6
+add r6, L93
+L7: bne L278
+L8: .string "kgqpnrpuzbxgeb"
+lea L5, r4
+inc *r3
+prn #-249
+
+bne L4
+L9: .string "mudqttxz"
+sub r2, *r6
+red L194
+rts
+L10: red r0
+jsr L9
+clr r5
+; comment
+cmp #-252, L178
+L11: jmp L216
+stop
+rts
+sub *r3, r3
+L12: jmp *r4
+L13: inc r2
+rts
+red L10
+bne L198
+L14: .data 963, -948
+L15: clr r7
+L16: mov #7, L81
+clr r2
+stop
+rts
+jsr *r5
+bne *r2
+L17: .data -123, 421
+jsr *r5
+L18: sub L39, *r6
+red *r6
+L19: .data -324, 721, -712, -11, 782, -78, -270
+sub L2, r0
+inc r1
+L20: lea L24, L199
+dec *r1
+L21: jmp *r2
+L22: clr L2
+L23: .data 758, 263, 511, -656, 230, -604, 542
+L24: stop
+L25: lea L3, r5
+sub L11, *r0
+lea L2, r6
+dec L10
+sub L108, L98
+L26: .string "xdmwdsducdxubau"
+lea L7, r2
+inc *r2
+jmp *r5
+clr *r7
+jmp L157
+mov r1, r1
+jmp L284
+L27: rts
+bne L1
+stop
+L28: lea L101, *r4
+L29: mov L1, r6
+bne *r6
+
+L30: .string "ygzrngxupusqjlsxttnihsq"
+stop
+cmp *r5, #-59
+L31: .data -378, -667, 342, 938, -119, -467
+rts
+sub L203, L25
+dec *r4
+dec L13
+L32: clr L283
+bne L40
+L33: .data 345, 286, 729, -422, -696, -538, 299
+stop
+cmp r4, r5
+L34: bne L247
+L35: prn #216
+dec L35
+
+L36: jmp L0
+not r1
+L37: lea L242, *r4
+red *r4
+clr L35
+prn #-177
+L38: .data -876, -605, 682, 188, -244
+sub r0, *r4
+jmp *r1
+jsr L1
+dec r6
+jsr *r1
+cmp r7, L0
+L39: inc *r5
+bne L186
+L40: cmp *r6, *r5
+red r1
+mov #216, L274
+L41: inc *r6
+
+not L8
+L42: lea L108, r6
+L43: prn #190
+L44: .data -644, -325, -78, -314, 641, 352, 166
+L45: lea L9, r1
+L46: .string "ktddcri"
+sub #-136, r7
+sub #-209, L32
+add #37, *r7
+cmp L64, #-42
+jmp L3
+red L240
+not L243
+jsr L261
+L47: .data -730, 883, 677, 570, 244
+red *r5
+L48: .data -916, 9, 791, 711, -318, 412
+jsr *r4
+L49: not L264
+clr *r1
+jmp *r0
+sub #-208, *r4
+add #-9, *r5
+bne L183
+bne L275
+jsr *r2
+L50: jmp *r3
+stop
+mov L28, L187
+lea L20, r5
+dec L40
+add r6, *r1
+L51: .string "exdsoyiqs"
+L52: stop
+jmp *r7
+
+L53: jsr *r6
+inc r0
+cmp L232, *r2
+L54: red *r2
+dec L201
+mov #174, r1
+L55: add L101, *r1
+stop
+bne L237
+L56: jsr *r1
+L57: .data -305, -318
+L58: .string "kucwgoyqlo"
+L59: mov r0, r2
+jsr L277
+L60: stop
+cmp r5, r5
+jsr L42
+L61: bne *r7
+rts
+rts
+dec L133
+L62: .string "fdpvrhdxeebjjpny"
+clr *r6
+inc *r7
+clr L9
+rts
+rts
+mov #-48, L26
+prn #-232
+lea L231, *r7
+bne *r2
+clr L27
+dec L44
+not *r7
+red r7
+lea L10, r0
+jmp *r0
+cmp L235, r6
+red r0
+not *r7
+bne *r1
+L63: add L49, *r2
+mov #-84, L56
+L64: sub L199, L139
+L65: sub *r6, *r7
+L66: dec r5
+L67: sub *r2, *r2
+L68: bne L14
+inc L271
+mov L243, L43
+L69: .data -947
+L70: prn r6
+L71: add L71, r6
+L72: lea L63, L13
+lea L150, r3
+cmp L205, r5
+stop
+L73: .data -311
+L74: red L2
+red L242
+bne L42
+add L220, *r0
+sub L19, r5
+lea L39, *r1
+jmp L51
+jsr L172
+L75: rts
+L76: dec *r2
+lea L130, L118
+prn #152
+jmp L17
+; comment
+; comment
+jmp *r1
+; comment
+L77: .data 606, -6, 932, -187, -786, 865, -727
+jsr *r4
+dec L41
+; comment
+jsr L47
+; comment
+bne L182
+clr *r3
+rts
+L78: cmp #132, *r5
+L79: clr r4
+red r2
+L80: clr L52
+jsr L1
+dec *r2
+L81: jsr *r4
+mov L164, L235
+dec *r3
+lea L36, L107
+L82: jmp *r1
+stop
+rts
+L83: sub r7, r2
+L84: .string "xm"
+L85: jmp L3
+
+prn *r4
+inc *r0
+red r2
+jmp L201
+dec *r6
+red L63
+L86: jsr L65
+cmp r5, #20
+rts
+rts
+dec *r5
+L87: clr *r1
+L88: cmp #141, #-150
+rts
+L89: lea L196, r3
+red r3
+prn r5
+L90: jsr L151
+L91: prn #134
+L92: add *r2, r5
+add L37, r7
+L93: .data -833, 380, -657, 20, 379
+add L25, *r3
+inc L190
+stop
+L94: mov r4, r4
+L95: .data 488, 175, -242, 19, -399, 175, -426
+L96: .data -973, -627
+jmp *r6
+lea L22, r0
+
+bne *r2
+mov #190, *r1
+sub *r6, L153
+mov *r7, r5
+L97: .data -834, -695, 939, -152, -35, 384
+; comment
+sub r7, r5
+bne L136
+red r7
+lea L167, *r6
+L98: .data -659, 783, 78, 190, -285, 362, 897, -591
+sub L211, r0
+L99: red *r4
+; comment
+L100: rts
+bne *r5
+red r5
+L101: .string "hqsysxngovwvxpaubninya"
+stop
+L102: .string "dkxgesc"
+clr L290
+jmp L84
+stop
+L103: jsr L250
+lea L40, *r7
+stop
+sub L149, *r3
+L104: bne L7
+lea L54, *r1
+clr r7
+L105: add L25, *r7
+dec r2
+add *r5, L228
+red *r0
+rts
+rts
+dec r1
+rts
+bne L77
+L106: not *r5
+bne *r5
+prn L4
+L107: .data -968, 701, -397, -109, -763, 587, 706, -211
+
+lea L101, *r0
+bne L114
+inc *r6
+add *r0, *r3
+cmp #222, #195
+clr L254
+jsr *r2
+add #-204, *r6
+jmp *r7
+rts
+jsr L119
+sub L72, r3
+clr L3
+jsr *r5
+stop
+add *r7, r7
+L108: .data 356, -616, -534, -355, 954, 841, -527
+jmp L8
+L109: .string "sjhshvfbxx"
+add r7, r6
+stop
+red r2
+stop
+rts
+L110: prn L225
+jsr L209
+lea L47, *r7
+prn r2
+L111: .data 754, -648, -791, -666, 507
+L112: jmp *r2
+L113: jsr *r0
+stop
+L114: lea L126, r1
+L115: .string "yjhwipqnctr"
+; comment
+cmp *r5, L196
+L116: lea L102, L122
+prn r3
+prn #18
+bne *r7
+not L284
+inc r4
+L117: bne *r7
+L118: lea L1, r7
+L119: prn L126
+rts
+add L120, r5
+L120: cmp r1, *r1
+prn L275
+cmp L44, #-145
+cmp #196, r3
+L121: jsr *r3
+prn *r1
+dec L92
+bne *r7
+stop
+clr L221
+rts
+lea L54, *r0
+lea L216, L14
+L122: .string "qhnnmjtwzmedq"
+jmp *r1
+stop
+L123: mov r0, r0
+L124: .data -200
+L125: lea L44, r4
+L126: .string "tbheqihssgpskgujca"
+clr r1
+L127: .data -649, 184, 733, 319, -887, -134, -901, -58
+L128: rts
+L129: stop
+prn *r5
+jmp L65
+prn *r7
+red *r4
+L130: .data 884, 405, 664
+add r4, r1
+L131: clr L132
+add r1, *r0
+prn L6
+mov r1, *r1
+prn #86
+not r4
+L132: clr L6
+add L31, *r5
+inc L88
+clr r5
+lea L44, r2
+clr r4
+mov r2, *r0
+L133: lea L211, r4
+L134: .string "qqoey"
+cmp L195, L92
+
+L135: .string "tovakxdamgfvpijdpj"
+lea L285, *r5
+not r0
+L136: .string "dhdscuevme"
+prn #250
+jsr L273
+jsr *r0
+prn #130
+sub L203, L21
+; comment
+L137: bne *r3
+L138: .string "cnrxcqzbbaxjwplynmfrm"
+prn #-109
+lea L30, L82
+dec *r2
+L139: .string "slyebrvgdcro"
+rts
+sub *r7, L221
+L140: inc L277
+L141: jsr *r1
+inc r4
+
+cmp r3, r0
+inc r4
+not *r5
+clr *r0
+L142: dec *r7
+bne *r4
+rts
+clr *r6
+clr r4
+
+clr r1
+add L270, L156
+L143: .data -982, -311, -943
+L144: dec r0
+sub *r3, *r1
+sub *r6, r7
+jsr L65
+cmp r5, *r4
+bne L171
+stop
+dec L178
+L145: .data -323, -241
+dec r2
+L146: prn #-189
+bne *r5
+; comment
+mov r4, *r5
+L147: lea L30, *r0
+add L195, r0
+cmp #-99, r5
+dec L12
+mov *r5, r5
+
+L148: bne *r2
+stop
+L149: rts
+L150: inc r2
+sub #76, *r5
+lea L203, r3
+clr r2
+L151: stop
+rts
+L152: lea L39, *r1
+jsr L263
+stop
+rts
+jmp L157
+bne L282
+mov *r5, *r2
+lea L286, r3
+L153: stop
+; comment
+jsr *r0
+sub r0, r2
+clr r0
+jsr *r7
+jsr *r7
+L154: lea L63, L140
+; comment
+L155: inc *r1
+mov L87, r5
+L156: clr r4
+L157: add *r4, r7
+jsr *r4
+jmp *r7
+jsr *r7
+add #-11, L258
+clr *r6
+dec r2
+
+jsr *r5
+; comment
+L158: red r4
+L159: inc *r3
+bne *r5
+sub *r1, r2
+
+bne *r6
+rts
+jmp L88
+red *r5
+mov *r4, L250
+clr L214
+L160: sub L173, L157
+jsr L156
+sub #-248, r7
+red *r1
+red r7
+stop
+L161: .data -537, -98
+prn L155
+dec *r1
+cmp *r1, *r5
+sub #208, L21
+L162: .string "qdotmupvjklxyaivudechh"
+dec *r3
+L163: cmp *r1, r6
+rts
+bne *r6
+L164: clr *r2
+bne *r2
+L165: sub #-253, L264
+L166: .string "vblljarncatlmtb"
+L167: stop
+L168: .data 176
+jmp *r4
+
+L169: lea L133, r2
+L170: .data -241, 676
+inc *r4
+
+jmp *r5
+L171: red r0
+L172: .string "bvmkvzlzlvjncupgov"
+
+stop
+L173: red L291
+L174: mov L250, r5
+bne L222
+stop
+bne *r1
+jsr L162
+inc *r1
+jmp L271
+clr L255
+prn L142
+cmp #-237, #18
+add L82, *r6
+jmp *r2
+add L159, L119
+lea L223, *r5
+bne *r0
+dec *r1
+L175: .string "u"
+not *r7
+jsr *r2
+cmp *r3, #126
+L176: inc r0
+L177: .string "jcybvydgzainxyrha"
+add r4, *r4
+dec *r1
+lea L19, L11
+red r3
+jmp L291
+prn L206
+L178: inc *r4
+add L94, *r1
+not r4
+L179: rts
+clr r5
+rts
+lea L86, *r2
+L180: jmp L116
+dec L52
+L181: sub #136, r4
+rts
+cmp #-123, #165
+not r5
+bne *r4
+cmp r7, *r0
+L182: .data 83, 818, 948, 920
+mov #74, r4
+red r0
+cmp *r2, r4
+not *r7
+prn L74
+L183: bne L243
+dec L45
+L184: mov #-22, *r2
+L185: .data -598, -31, -268, 314, 520
+mov r7, *r1
+L186: .data 768, -121, 528
+clr r2
+L187: mov #-68, r2
+dec *r5
+sub #152, r0
+add r1, *r0
+L188: not *r3
+add r3, L21
+L189: .string "mrtzqjscrhwwgxjxwsdkmus"
+add L33, r1
+not L92
+inc L262
+jmp L279
+jsr *r3
+jsr *r2
+L190: bne *r7
+jmp L263
+dec L101
+not *r3
+L191: inc r2
+jmp *r4
+
+sub #-128, r6
+L192: .data -625, -347, 97, 372, -828, -347, 478
+L193: .string "lodkclxzspiwrrbi"
+L194: cmp #141, #189
+
+
+not L182
+jmp L268
+L195: inc *r4
+cmp *r5, *r3
+bne L170
+stop
+L196: jmp *r4
+add r4, r2
+sub L167, *r6
+cmp r4, *r2
+stop
+jmp L249
+rts
+L197: stop
+
+prn r7
+L198: dec L199
+mov L275, *r6
+L199: .string "bpgervzgxtgllpvawpbyhhf"
+cmp L46, L254
+L200: add r0, *r7
+cmp L143, L154
+sub *r0, r7
+rts
+sub *r7, *r7
+not r3
+bne *r3
+L201: .string "xsozhtiaxspkrwqeawyersot"
+red r7
+L202: stop
+clr r3
+prn *r2
+stop
+inc r6
+L203: red *r7
+stop
+jsr L70
+L204: .string "hyofztkdzabwspgyvcppinn"
+cmp #-253, L276
+sub *r0, L272
+L205: red r6
+L206: .string "bjwihxzveccupzxxc"
+L207: cmp #81, #57
+prn #-207
+L208: .data -243, 984, 555, -153, 347, 329, -651, -669
+L209: prn *r6
+; comment
+jmp L145
+L210: clr L135
+dec L238
+cmp #121, *r7
+cmp r2, L160
+L211: red r5
+L212: .string "cpnsjzultkom"
+L213: jsr L142
+L214: cmp *r3, #-182
+rts
+
+
+clr L106
+sub r0, L93
+prn #17
+mov #185, r7
+clr *r7
+inc *r0
+stop
+L215: lea L165, r1
+stop
+L216: red *r3
+cmp #164, *r7
+bne L97
+L217: .data 495, -698
+sub *r1, r0
+L218: add L267, L77
+L219: red r4
+L220: not L282
+L221: .string "blatzsevwdypfj"
+L222: .data -148, -272, 442, 460
+; comment
+add r1, *r3
+L223: .data 6, -66, -722, 252, -661
+bne *r7
+L224: jsr *r5
+red r4
+cmp #-135, #242
+stop
+bne L17
+mov L254, r3
+sub #138, *r4
+jmp L226
+add L59, L244
+inc L271
+; comment
+clr *r4
+jmp L221
+L225: cmp *r3, r4
+rts
+jsr *r7
+L226: not L12
+jsr *r3
+inc L229
+mov L35, r7
+bne *r7
+L227: .data 843, -515, -662, -488, 892, 694, -940, 775
+clr L259
+L228: jmp *r4
+rts
+L229: cmp #224, *r3
+bne *r2
+rts
+bne *r3
+bne L287
+L230: sub r7, L273
+; comment
+rts
+dec r4
+not *r0
+L231: jsr L274
+cmp #-253, #96
+L232: lea L214, r0
+sub L251, L26
+L233: mov r5, r0
+
+jmp *r5
+L234: .string "g"
+
+L235: add *r6, *r6
+L236: dec L215
+mov #160, L79
+not r1
+mov L249, L55
+prn #154
+inc r6
+prn r0
+mov r2, r5
+rts
+L237: .string "zvwpntzyfpidb"
+rts
+L238: sub r1, r6
+prn r1
+L239: .data -286, -399
+mov #113, r4
+mov *r0, L251
+L240: red r1
+clr L262
+mov #-74, L289
+rts
+L241: inc r2
+L242: .string "qbbujfughky"
+L243: mov *r2, r1
+L244: add #182, L253
+bne *r2
+dec L61
+mov *r0, r6
+stop
+; comment
+L245: inc *r4
+
+add r6, *r7
+L246: .string "hsuacifrbwupcam"
+rts
+not r5
+L247: .data 477, 733, -293, 310, -155, -658, -736
+red *r5
+L248: .data -319
+inc L281
+dec L248
+stop
+L249: bne *r4
+lea L185, *r2
+jsr *r5
+
+prn *r2
+jmp L250
+rts
+inc *r2
+L250: red r6
+red r3
+bne *r7
+inc L27
+mov #183, r1
+L251: rts
+
+jsr L264
+L252: jsr *r7
+inc L202
+mov r7, L286
+jmp L284
+inc r5
+lea L270, *r6
+sub #22, *r1
+jmp *r4
+clr r5
+L253: sub r5, *r6
+L254: cmp L60, r6
+prn L243
+mov r2, r4
+L255: jmp L269
+prn #-50
+
+jsr L283
+stop
+L256: clr L182
+L257: clr *r0
+L258: add L141, r2
+stop
+not *r2
+not L170
+lea L279, r5
+prn *r0
+clr L222
+
+rts
+inc r6
+cmp r5, r5
+L259: dec r5
+clr *r6
+L260: rts
+mov L250, *r1
+lea L274, L269
+bne L128
+L261: inc *r6
+dec r3
+rts
+inc L34
+red *r2
+L262: .string "ogvrnsvcxievyixyamjygcx"
+prn L251
+red r3
+L263: bne *r3
+L264: .string "aqcbmgzjtdltxujbkta"
+L265: .data -443, -738, -345, -761, 463, 990, 163, 896
+dec *r4
+
+; comment
+L266: add *r1, r3
+inc L288
+L267: red r7
+L268: stop
+rts
+inc L229
+lea L278, L87
+rts
+red L283
+; comment
+clr r0
+rts
+sub #184, *r4
+rts
+L269: .string "bttproaesttqaueorrbc"
+L270: .string "cfffnp"
+add #225, L282
+sub r1, *r0
+lea L65, r7
+clr L245
+red r1
+stop
+clr r2
+sub L278, r5
+L271: rts
+bne L284
+L272: lea L284, L54
+
+L273: .string "wjiugwip"
+L274: lea L288, *r2
+cmp L244, r7
+not *r4
+L275: jsr L126
+cmp r1, L286
+; comment
+stop
+mov *r1, *r4
+inc r2
+mov *r5, r1
+mov L39, L279
+lea L289, *r5
+L276: .string "akwqi"
+jsr *r6
+; comment
+red r4
+mov r0, r0
+dec *r3
+inc r2
+bne *r7
+L277: .string "cukhsabxynnmbpjnmreb"
+clr r7
+mov L288, r2
+L278: stop
+add *r6, r5
+L279: dec *r1
+; comment
+jmp L286
+jmp L283
+L280: add #-149, L13
+prn #159
+sub L24, *r6
+prn #-58
+mov #172, L290
+L281: .data -172, 52, 125, 350, 405, 867, 840
+
+sub *r4, r0
+stop
+L282: .string "wkfmywkfhkhx"
+jmp L107
+L283: clr r2
+
+L284: .data -171, -388, -178
+mov L275, *r3
+stop
+red *r4
+rts
+jsr L170
+
+clr *r5
+stop
+L285: stop
+sub *r6, r0
+L286: dec r2
+L287: .data -802, 246, 920, -35
+lea L13, r4
+L288: jsr *r5
+mov r6, r2
+not L290
+lea L276, r2
+L289: .string "mqcubowzic"
+rts
+sub *r2, r6
+mov *r4, *r4
+L290: .string "gfcjhuexcbnpjegncfajovl"
+sub #-242, L17
+sub *r4, *r5
+L291: not L285
+clr r3
+jmp *r1
+L292: .string "jimlfxlkotpihsjhvngti"
+sub r2, r7
+jsr L293
+dec r0
+lea L90, *r3
+
+mov r7, r2
+jmp *r2
+not r2
+dec r3
+jmp *r1
+rts
+dec r3
+L293: mov L125, *r0
+stop
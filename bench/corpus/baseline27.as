@@ -0,0 +1,1020 @@
+; Generated by genCorpus --seed 28
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+L0: jsr *r2
+bne *r0
+; comment
+L1: lea L13, L0
+clr *r4
+stop
+L2: sub L0, r4
+inc r5
+jmp *r7
+red L182
+add *r2, r7
+jmp L65
+L3: not L273
+cmp *r5, *r0
+L4: .data -52, 204, -83, -224, 921
+
+mov *r7, L150
+jmp L34
+clr L0
+dec *r3
+
+L5: dec *r3
+inc r7
+L6: clr *r5
+L7: dec L33
+dec L91
+L8: jmp L3
+inc L2
+sub *r0, L0
+L9: add r2, r3
+red L3
+L10: .data -463, -323, -835, -800
+L11: .data 668, -998, -232, -595, -109, -555, -890
+sub #40, *r4
+sub *r0, L1
+
+dec r7
+rts
+sub L9, r4
+mov L11, r1
+sub L186, r2
+mov *r2, L72
+; comment
+L12: mov *r3, L226
+stop
+not L4
+clr L67
+L13: add r7, *r5
+sub #-157, *r3
+inc L7
+L14: red L64
+L15: .data -44, -157, -325, -992
+lea L1, r0
+lea L13, *r3
+L16: inc r6
+L17: jsr L8
+L18: .data -664, 74, -854, 35, 139
+red r2
+
+rts
+add r1, r7
+bne L12
+not *r6
+sub #184, r3
+stop
+L19: .string "iyvqrra"
+lea L65, *r3
+lea L3, r6
+jmp *r7
+red L8
+L20: .string "sovcnhiafts"
+mov *r1, r4
+L21: jmp *r5
+jsr L103
+L22: .data -179, 959, 620, -799
+; comment
+dec *r0
+L23: inc r0
+L24: dec *r0
+L25: dec *r1
+cmp *r0, #30
+prn *r0
+not *r5
+
+mov #-162, L43
+mov #-161, *r1
+L26: not *r6
+prn *r3
+prn r4
+; comment
+L27: .data -528
+bne L119
+red L24
+cmp L7, L29
+L28: add L56, L235
+stop
+L29: .data 738, -234, 738, -727, 432
+L30: .string "vhpxqqqt"
+
+L31: .data 956, -408, -587
+red *r3
+add r3, r1
+rts
+L32: .data -958, -249, -974, -130, 267, -705, 586, -736
+bne L25
+L33: .data -168, 702, 117, 317
+L34: lea L126, L4
+L35: inc L48
+bne L14
+L36: clr L152
+jmp L127
+L37: add #163, *r6
+stop
+cmp #134, L124
+not L187
+lea L0, *r0
+
+mov *r4, L144
+add L127, r1
+cmp #-87, r4
+red r4
+L38: stop
+add *r2, r1
+jsr *r7
+L39: inc L107
+L40: bne *r2
+sub *r4, *r5
+red *r5
+L41: inc *r7
+prn r4
+L42: add #35, r6
+L43: .data -114, 863, -479, -428, 541, 577, -157, -608
+L44: mov r6, *r2
+L45: inc *r0
+clr L43
+L46: cmp *r4, L224
+L47: .data 561, 846
+red *r7
+bne L75
+sub r1, L35
+L48: .data -327
+jsr L66
+L49: cmp *r5, r5
+prn r6
+cmp r4, L92
+add L38, L44
+prn r7
+sub r6, *r4
+L50: .data 34
+lea L1, L43
+L51: .data -67
+mov r3, L30
+bne L69
+L52: stop
+add r4, r1
+jmp *r5
+L53: .string "vfoxtjb"
+L54: lea L251, r5
+L55: jsr *r3
+add L50, *r2
+red L39
+sub L141, L7
+stop
+L56: .string "okqldbcpqmtn"
+bne L201
+add r7, *r3
+L57: jsr L210
+L58: bne *r4
+lea L52, L57
+jsr *r0
+cmp *r0, *r2
+jsr L29
+L59: dec *r7
+L60: .data -464, 862, -529, 737, 325, -633, 262, 395
+lea L143, r4
+rts
+prn r7
+L61: red r3
+prn r6
+L62: inc *r6
+jmp L213
+stop
+jsr *r6
+prn L13
+add *r4, r7
+add *r6, L236
+L63: cmp L202, r0
+; comment
+rts
+L64: rts
+
+red r0
+prn L18
+prn *r0
+lea L268, *r2
+red L202
+L65: .string "xhhdduwfjyyqgioszkisisl"
+add #175, r4
+clr *r1
+prn r0
+bne L36
+jmp *r3
+red L204
+L66: .string "srxwuzveathwuulszttg"
+L67: dec L89
+jsr *r1
+prn L250
+L68: .data -22, -641, -598
+prn #-77
+stop
+mov *r0, *r4
+mov r0, L243
+clr *r4
+bne L49
+clr L85
+not r7
+stop
+prn r7
+L69: rts
+mov #12, L46
+L70: .string "oxyhplplkqkzilcmqyakwm"
+L71: .data 847, -562, -933, 898
+L72: red L17
+L73: .string "abcjmngurtzlcvecdpvomhx"
+mov r4, *r4
+red r3
+L74: mov #84, L58
+dec *r2
+bne *r1
+mov r0, r4
+add #-61, r2
+jsr L15
+mov L127, L23
+bne L52
+mov #-148, L38
+inc *r2
+stop
+lea L10, r4
+
+L75: jsr L257
+red *r1
+L76: .string "kwoeliwzmhargioj"
+cmp *r1, L125
+
+prn r5
+clr L180
+lea L226, r5
+dec *r4
+red *r3
+clr r3
+L77: clr L14
+mov *r1, L121
+rts
+prn #106
+lea L69, r4
+dec r4
+L78: .string "tt"
+cmp *r5, r1
+mov L140, *r6
+L79: rts
+L80: .data 480, -282, -730
+rts
+mov L16, L98
+red L89
+clr r1
+L81: prn r7
+sub #150, r7
+prn r6
+clr L27
+bne L142
+; comment
+not L14
+not *r3
+jmp L5
+rts
+clr L261
+add *r3, L33
+bne *r5
+jsr L74
+red r4
+rts
+L82: .data 174, -497, -936, 253, 499, 120, -559
+L83: .string "ihuhitapevzyzfcavj"
+L84: red L236
+
+cmp #95, r7
+jmp L22
+sub *r2, *r4
+prn *r7
+inc r3
+L85: lea L10, r2
+jsr L199
+stop
+not *r2
+cmp L62, *r5
+not r5
+prn L9
+dec r7
+; comment
+prn #-228
+jsr *r7
+inc L28
+jmp L255
+L86: clr *r2
+L87: .data -831, -568, 671, 836
+not *r4
+cmp #221, *r6
+stop
+L88: .string "pxuumqkeontcopwcry"
+L89: jsr L243
+sub #77, r2
+red *r5
+inc *r6
+prn L168
+L90: rts
+mov L85, L64
+cmp *r1, L184
+L91: stop
+jmp *r1
+clr L246
+sub r5, *r4
+jsr *r7
+lea L227, r1
+L92: inc r2
+not r3
+L93: .data 614
+sub r5, *r7
+L94: jsr L270
+L95: .string "uctflqrjpvhzmcvgwkyy"
+add L278, L253
+L96: prn *r1
+
+L97: cmp #-131, r0
+; comment
+L98: jsr *r6
+L99: .string "eupuolltz"
+dec *r3
+
+cmp *r5, *r6
+inc L132
+clr *r3
+inc r3
+bne L3
+cmp *r7, r6
+
+sub r1, *r0
+jsr L73
+
+cmp L53, *r7
+L100: bne L60
+not *r3
+L101: .data 79, 345, -165, 13, 148, -900, 554
+L102: inc r0
+not *r5
+red *r3
+jmp *r1
+rts
+lea L48, *r6
+L103: .data -14, 456
+dec r3
+cmp #138, #115
+cmp L102, *r6
+jmp *r0
+L104: .data -715, -603, 450
+rts
+L105: lea L35, L68
+inc *r1
+rts
+mov #232, r7
+L106: add *r6, *r2
+L107: rts
+add r4, r4
+; comment
+sub *r7, r3
+sub r5, r6
+cmp L12, #244
+sub L260, L10
+jmp L223
+L108: .data 939, 182, -167, 262, -418, 356, 414
+L109: .string "bwhbhntpo"
+red r3
+L110: jmp *r4
+rts
+L111: .data 958
+clr r0
+not *r5
+L112: .string "mylax"
+clr L65
+prn *r7
+stop
+L113: .data 167, -418, 817, -992
+jmp L228
+L114: .data 447, 231, -984, -678, -781, 151, -913
+inc L23
+prn r3
+L115: lea L220, L49
+jmp *r0
+cmp *r7, *r3
+sub *r2, r3
+prn *r6
+jmp *r7
+sub L57, *r2
+add r7, L104
+L116: mov L232, *r4
+L117: not *r3
+jsr *r0
+cmp r0, r7
+
+inc *r6
+jmp L62
+mov *r7, L202
+
+bne L193
+cmp *r1, #151
+lea L28, L244
+prn *r1
+mov *r5, L180
+not r3
+L118: red L242
+L119: .data 673, 746, -956, 639, -283
+stop
+jmp *r1
+prn *r7
+; comment
+dec L20
+L120: .data -423, -149, -791, 930, 315
+bne L2
+clr L100
+L121: prn #-148
+clr *r5
+stop
+sub #-224, L41
+rts
+mov *r3, r5
+L122: cmp #-215, L79
+prn *r3
+L123: mov *r3, *r4
+lea L244, *r5
+L124: clr L210
+L125: stop
+; comment
+stop
+mov r0, L162
+mov #48, r6
+L126: dec L189
+rts
+L127: lea L51, *r3
+cmp *r7, L253
+sub *r4, *r1
+add r7, *r6
+clr L30
+rts
+not r2
+sub *r7, *r5
+L128: lea L144, r7
+L129: stop
+clr *r1
+add r4, *r1
+L130: sub r2, *r3
+lea L86, *r1
+lea L187, L54
+mov #95, r2
+L131: .data 812, 314, 531, 556, -428, -953, 169, 293
+mov *r4, *r7
+stop
+L132: inc L102
+L133: .data 491, 106, 569, 435, -91, -791
+jmp L39
+L134: lea L184, *r4
+L135: .string "aglhkapidwa"
+prn #59
+bne *r3
+inc r7
+L136: jmp *r7
+clr r1
+L137: .string "wzq"
+mov #-122, r1
+sub #-157, r6
+L138: bne *r0
+add *r1, *r4
+L139: rts
+bne *r5
+; comment
+clr r3
+dec L60
+L140: jmp *r1
+rts
+add L20, r0
+rts
+L141: lea L237, *r7
+add L78, *r2
+prn #30
+not r3
+inc *r7
+lea L181, L89
+mov r7, r4
+L142: dec r2
+clr r2
+mov L9, *r7
+L143: .data -579, 995, 340, 851, -479, -100, -768, 68
+cmp r6, *r0
+prn r1
+inc *r0
+clr L172
+not L242
+rts
+lea L224, L29
+dec *r5
+not r4
+clr *r6
+red L142
+L144: stop
+sub *r4, *r5
+jmp L211
+rts
+clr r0
+prn r6
+L145: clr r3
+sub *r3, L224
+L146: add r7, r4
+red L144
+not r7
+prn r0
+L147: .string "armawugghvvgquybikjae"
+L148: .string "ddls"
+not L153
+bne L227
+not r0
+L149: red r5
+add #96, *r6
+dec *r3
+clr L39
+red L89
+jmp *r4
+jsr L264
+
+; comment
+inc r1
+L150: add L196, *r6
+lea L67, *r2
+inc L133
+mov r6, L126
+stop
+L151: red L221
+red r6
+not L258
+L152: red L180
+cmp r2, #-254
+L153: mov r5, *r4
+clr L190
+inc L163
+L154: .data -78, 594, 316, -528, 565
+lea L73, r6
+jsr *r7
+dec L215
+red L141
+dec r5
+rts
+inc L144
+prn *r7
+sub *r1, r1
+cmp #-62, r7
+L155: prn *r2
+inc L86
+rts
+cmp r3, #216
+
+mov L82, L173
+jsr *r1
+sub *r6, r2
+add #250, r7
+rts
+L156: cmp *r2, *r5
+inc L89
+mov r6, r2
+red L17
+L157: .data 509, -428, 34, -456, 787, 375
+red L90
+lea L212, r7
+L158: not *r0
+sub *r7, *r6
+red L49
+add #-4, r3
+bne L167
+L159: red *r5
+inc *r1
+stop
+lea L131, r5
+dec *r5
+L160: .string "xlkqfnpuwxbuennfgwev"
+L161: .data -290, 975, -936
+L162: lea L158, r0
+sub #-224, r2
+red L63
+dec *r1
+lea L193, r6
+jmp *r4
+rts
+L163: .string "nqcmx"
+add #197, L273
+jmp *r0
+inc *r2
+jmp *r1
+add *r0, L217
+prn L74
+rts
+bne L66
+add *r2, *r6
+rts
+dec r2
+sub *r2, r4
+dec r7
+lea L267, L82
+red L278
+inc *r7
+bne *r2
+L164: sub *r1, r1
+jmp *r3
+jsr *r1
+mov #205, *r7
+rts
+mov L99, L228
+add L99, r1
+L165: red *r5
+red *r2
+dec *r1
+L166: not *r0
+rts
+L167: .string "oaauonuixcycsncuy"
+mov L247, r0
+bne L64
+rts
+prn r7
+L168: clr r3
+red L118
+L169: .data 19, 689, 98, -710, 545, 376, -821, -885
+jsr L125
+; comment
+jsr *r1
+lea L168, *r0
+jmp L117
+bne L218
+rts
+stop
+jmp *r5
+lea L164, *r3
+cmp *r4, r6
+; comment
+; comment
+L170: .string "eovu"
+prn #201
+L171: not L216
+bne L4
+jsr L28
+L172: not L95
+L173: mov L106, *r1
+inc r3
+L174: add #-153, L215
+clr L134
+L175: sub L0, r2
+add #82, *r3
+jsr *r4
+L176: red r0
+cmp *r1, #147
+L177: stop
+not r1
+L178: not L172
+sub *r6, r6
+jsr *r7
+lea L166, r1
+not L211
+jsr L204
+
+L179: cmp #219, *r5
+cmp r4, r6
+lea L230, L249
+dec *r5
+L180: jmp *r7
+sub L91, L63
+cmp r1, #-142
+jsr L136
+L181: lea L198, r2
+L182: .data -721, -192, -676, 356, 993, 415, -485
+dec L72
+prn #102
+bne L236
+L183: not *r2
+L184: lea L225, L264
+cmp *r0, *r1
+L185: not L45
+L186: .string "dkcrwsswrllrzmdsvwnll"
+L187: .data -961, 214, -864, 469, -543, -635
+sub #-52, *r3
+L188: prn #-124
+jmp L47
+L189: .string "mkudmounabvmpcnokdbho"
+not *r5
+jsr L224
+L190: .data 830, 110, 211, 464
+inc *r3
+inc *r0
+bne *r3
+L191: .string "snmguynkeeojhdtchbdcsf"
+rts
+inc L263
+L192: .data 252
+L193: mov #-191, *r3
+dec r3
+sub *r7, *r2
+not *r0
+L194: .data -88, 658, -744, 917, -240, -110, 774
+L195: dec L189
+prn #-92
+lea L55, L269
+dec *r0
+lea L89, r7
+rts
+bne *r0
+; comment
+inc r7
+L196: red *r6
+L197: .data -223, 81
+L198: .string "venuyoaoteljrg"
+bne *r1
+red L247
+red *r7
+red r5
+jmp *r4
+bne L265
+jmp *r2
+add r4, r2
+jsr L198
+rts
+; comment
+L199: jmp L43
+lea L273, *r3
+L200: .string "mcchib"
+L201: inc r6
+cmp #-97, r5
+not *r6
+L202: .string "lbvxxaohkfepoeyqmafa"
+lea L238, r7
+jsr *r2
+L203: jsr *r4
+L204: clr r3
+sub r1, *r1
+jsr L2
+stop
+sub *r4, L267
+L205: bne L145
+L206: lea L271, L250
+L207: add #-2, r6
+stop
+L208: clr r0
+cmp *r7, *r3
+lea L176, r7
+not *r7
+cmp r2, r0
+L209: dec *r6
+stop
+clr r4
+lea L37, *r3
+mov r4, r2
+rts
+lea L257, L196
+mov r2, r6
+L210: cmp *r1, r1
+rts
+L211: sub L114, *r2
+L212: jmp *r7
+L213: .data 771, 107, 494, -394, 113, -419, 918, 101
+L214: add r3, *r7
+add L280, *r5
+prn #-58
+bne L33
+prn *r4
+bne L5
+L215: .string "npypaxj"
+not *r4
+; comment
+L216: bne *r7
+jsr *r3
+L217: dec r4
+red *r3
+bne *r4
+sub #55, r0
+cmp r7, r7
+clr L221
+sub r4, r3
+L218: .data 358, -753, -465, -924, -933, 826, 719
+prn #50
+jmp L243
+bne *r4
+mov r1, L135
+L219: lea L264, L232
+L220: stop
+cmp *r4, L241
+cmp #30, *r2
+bne L234
+lea L82, L90
+; comment
+L221: red L238
+mov #-104, r1
+L222: prn r5
+red r5
+L223: .string "vyhruawf"
+L224: dec *r0
+jmp *r7
+add L139, L277
+add r6, *r3
+rts
+L225: add r1, L194
+L226: .data -46, 136, -788, 202, -93, -367
+L227: stop
+red *r0
+rts
+L228: cmp #-92, *r6
+clr L64
+sub L279, r3
+red L6
+jmp *r1
+L229: .string "zoswxttkytziliz"
+L230: mov *r6, L255
+add #252, L46
+dec L254
+L231: .data -904, 603, 770, 328, -772, -605
+jmp L251
+L232: dec r1
+prn L161
+jmp *r1
+prn L86
+L233: .data -57, 460, 549, -552, 457, -678
+red L183
+prn r2
+L234: jsr *r2
+prn #-223
+jmp *r2
+; comment
+cmp #-78, #73
+cmp r3, r1
+cmp r3, *r0
+not r7
+red L139
+prn #78
+not L241
+jmp L7
+bne L35
+add r0, *r6
+add r7, r2
+clr *r3
+red *r6
+not r5
+L235: sub L174, *r7
+; comment
+bne L259
+L236: sub L108, L245
+bne *r4
+mov r7, r0
+not L265
+inc *r7
+cmp r5, L279
+L237: add r4, L254
+dec L211
+lea L244, L54
+stop
+L238: lea L186, *r0
+
+stop
+inc *r7
+prn #187
+L239: red *r0
+L240: cmp #166, L250
+jmp L60
+L241: .string "wymbjtuoyv"
+L242: .data 197, 923, -654
+add #229, L245
+not L139
+red *r7
+clr L26
+stop
+L243: prn L258
+L244: .string "iuamyqpnbeqh"
+L245: add #-169, L90
+sub L263, *r4
+not *r1
+L246: .data -443, 124, -444, -319, 924, -894, -781, 972
+jmp L195
+red L259
+L247: .data 812, 964, 670, 902
+L248: .data -87, 104
+jsr *r2
+L249: not *r2
+prn L26
+jmp L34
+inc L170
+clr *r7
+rts
+clr L37
+L250: cmp #177, L280
+mov L42, L273
+L251: dec *r2
+not L264
+L252: .data -463, 369, 449, -862, 380, -642
+bne L263
+sub *r2, *r1
+L253: .data 940, 933, 320, -942, 822, 451, 813
+
+jsr L110
+L254: red r6
+L255: bne *r4
+lea L277, *r3
+clr L103
+rts
+add r1, L61
+L256: red L74
+stop
+L257: add r4, r3
+L258: mov *r3, r4
+cmp *r1, r6
+bne L262
+lea L270, r2
+not *r4
+lea L209, L258
+L259: cmp *r2, #-140
+bne L280
+red *r4
+not r4
+jmp *r1
+clr *r1
+dec *r5
+L260: .string "oectblahcmfammuavmlptd"
+jmp L34
+bne *r2
+add L267, *r1
+rts
+rts
+lea L131, *r1
+L261: stop
+bne *r0
+dec *r4
+cmp #39, L278
+L262: jmp *r5
+dec L170
+sub *r3, r7
+L263: .string "e"
+cmp L201, r2
+stop
+mov L33, r5
+clr *r3
+L264: rts
+bne L270
+rts
+clr r5
+L265: stop
+prn *r5
+L266: red *r2
+L267: .string "tatfstfgtjhsu"
+bne L150
+bne L216
+dec L275
+sub *r2, *r7
+bne *r1
+inc r2
+L268: .string "dhzg"
+red r6
+L269: red r4
+stop
+mov L149, r0
+lea L280, *r0
+stop
+mov *r4, *r2
+L270: dec L202
+jmp L274
+add #223, r7
+bne L214
+jmp L271
+not *r6
+prn L77
+sub L202, *r3
+L271: bne L263
+L272: add #-170, *r6
+; comment
+L273: cmp *r0, L274
+L274: bne *r7
+jsr L240
+rts
+L275: not *r5
+L276: clr *r5
+not r0
+L277: .data -912
+dec r4
+L278: .data -495, -513, 808, -685, 338
+prn r4
+L279: dec *r0
+jsr *r0
+cmp r7, *r4
+lea L280, *r7
+clr r6
+L280: .data -128, 198, 177, 783, -951, 753, 463, 962
+inc *r0
+stop
@@ -0,0 +1,1019 @@
+; Generated by genCorpus --seed 29
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+red r4
+L0: mov L0, L0
+sub L158, *r7
+sub L0, *r3
+L1: .data -4, 778
+
+inc L1
+rts
+lea L160, *r1
+L2: .string "sblocnx"
+L3: .data -371, 692, -274, 614, 829, 239
+L4: red *r3
+not *r6
+red L202
+bne *r4
+clr r5
+not r4
+L5: .data -417
+bne L5
+red r4
+red *r4
+mov r1, *r2
+rts
+stop
+L6: .string "fuhrzno"
+add L149, L248
+L7: .string "nyxvvmmut"
+not r0
+L8: clr *r3
+add #132, L6
+bne L8
+L9: bne *r2
+mov L147, *r1
+lea L44, r7
+L10: .string "knb"
+L11: clr r1
+L12: .data 236, -187
+L13: rts
+inc r3
+
+clr *r4
+dec r4
+L14: dec L218
+jsr *r7
+L15: stop
+sub *r2, *r4
+cmp *r1, #96
+lea L0, *r3
+jmp *r6
+prn *r0
+mov *r3, *r2
+add L0, *r5
+jsr L0
+stop
+L16: .string "zpqabxfwoztasj"
+L17: red r0
+bne L236
+L18: .data 308, -452
+L19: jmp *r1
+clr L210
+jsr L262
+L20: .string "yigbbhxngc"
+L21: jmp *r2
+sub #16, *r6
+jsr L8
+lea L3, *r5
+L22: jmp *r4
+cmp r0, L21
+bne L108
+mov r1, *r6
+L23: dec L222
+L24: lea L16, L27
+cmp L6, L2
+lea L60, L162
+dec L8
+
+red L91
+inc *r6
+L25: .data -520, -187
+cmp #105, #-133
+mov *r4, L10
+L26: red *r2
+lea L18, r4
+prn #98
+L27: sub r2, L10
+rts
+red *r0
+mov *r4, L123
+dec *r3
+not L194
+lea L144, *r3
+rts
+L28: not L215
+bne L255
+add L13, L58
+; comment
+jmp *r7
+rts
+L29: prn #39
+not r0
+cmp L6, r2
+
+L30: .string "ueordnohgkaanjiyduyiq"
+inc r6
+add r3, r7
+L31: .data -597, -555
+L32: lea L86, *r3
+jsr *r4
+not L19
+L33: .string "navlzpmqemtbmrsw"
+; comment
+clr L28
+red *r5
+not L86
+not r6
+jmp *r0
+cmp L19, L132
+L34: clr r7
+L35: clr *r7
+
+L36: prn L28
+; comment
+L37: .string "pswmgdfcvo"
+inc *r0
+rts
+L38: sub *r0, r3
+red r0
+add L7, L41
+mov #241, r4
+jmp *r5
+rts
+jsr L13
+add L216, *r7
+L39: jsr *r2
+bne *r3
+L40: clr *r7
+sub *r4, r5
+lea L23, L183
+inc *r2
+red L13
+mov L38, L2
+
+jmp *r0
+clr r7
+clr L28
+jmp L30
+L41: dec *r6
+inc r4
+inc r0
+red L137
+L42: .string "bawxwmjqktmvgsso"
+; comment
+add *r5, r5
+jmp L19
+clr L6
+L43: jmp *r7
+add r6, L90
+rts
+L44: inc r3
+
+rts
+bne L77
+prn L168
+dec *r1
+inc r1
+dec *r7
+; comment
+L45: .data -113, -778
+sub L41, r7
+red r5
+; comment
+L46: inc *r4
+L47: sub r0, r6
+stop
+rts
+dec r5
+bne *r6
+L48: .string "eidhmbjsagqslj"
+clr L37
+not *r7
+jmp L2
+clr L257
+L49: clr r4
+L50: clr *r7
+add #106, r7
+red L89
+mov *r2, r2
+L51: .data 792, 730, -845, 893
+sub *r5, r4
+inc L43
+bne *r2
+L52: stop
+add #-248, r6
+; comment
+not L68
+not L170
+inc r5
+jsr L192
+L53: sub *r2, L143
+mov #238, r1
+add r4, *r0
+rts
+dec *r5
+jsr *r1
+L54: cmp #-227, #78
+L55: mov #-132, r3
+lea L8, *r3
+inc *r5
+stop
+L56: .data -996, -771, -943, 732, -653
+
+rts
+mov L82, *r6
+inc *r1
+prn *r6
+dec r1
+dec L235
+L57: red *r1
+stop
+L58: lea L20, *r7
+stop
+L59: clr r5
+L60: .data -238, 434, -630, -233, 875, -275, -364
+rts
+stop
+clr L21
+not *r7
+L61: .data -743, 861, 870
+red *r6
+; comment
+not L208
+prn #9
+rts
+not r4
+L62: not *r4
+L63: .string "xhrhbciynmn"
+mov r0, *r2
+mov L68, *r7
+jsr L98
+inc r3
+L64: inc *r2
+
+jsr *r7
+red L37
+jsr *r4
+
+prn r4
+sub *r2, r3
+L65: .data 152
+cmp *r5, #28
+jmp L197
+clr *r0
+L66: dec *r5
+L67: rts
+L68: .data -818, 661, -811
+L69: jsr L57
+inc L46
+L70: clr r4
+add *r7, L175
+mov r7, r6
+add L20, L255
+red r3
+stop
+inc r4
+red L52
+L71: lea L110, r3
+dec r4
+; comment
+L72: not *r1
+L73: .data -569, 522, 464, 873, -600, -213
+
+stop
+L74: not L64
+lea L122, L41
+
+inc r2
+clr r2
+
+L75: .string "gycdgpajbdouarqjptui"
+L76: rts
+stop
+L77: .string "zkgyrjxmslmvnu"
+dec r2
+; comment
+inc L92
+stop
+L78: bne L8
+mov #189, r4
+
+mov *r2, *r6
+L79: inc r0
+clr r1
+mov *r0, r5
+L80: .string "ytrpuhbgd"
+L81: sub #-24, L36
+sub r1, *r4
+prn #168
+not L81
+
+L82: not r7
+dec r2
+
+clr r4
+bne L55
+not *r0
+dec *r0
+L83: .string "bzxvwouekknkx"
+dec *r0
+L84: cmp #-19, L35
+not *r1
+clr r6
+mov #-186, L88
+lea L54, r6
+jmp L18
+mov #203, L86
+red L268
+inc r7
+L85: not L259
+
+prn L35
+mov *r7, r4
+L86: inc r0
+rts
+sub L20, *r5
+inc r5
+clr *r7
+not r7
+jsr *r2
+L87: lea L22, L103
+L88: red *r4
+add r7, *r1
+cmp L174, #-81
+prn *r6
+L89: clr *r3
+add *r7, L6
+L90: .string "mecbqqlpejxgqmcwmnlej"
+jmp *r6
+stop
+rts
+inc *r0
+add #-71, L68
+add r0, *r5
+sub #37, L129
+prn L154
+clr r1
+L91: rts
+mov L99, r2
+add L193, r6
+sub *r6, L252
+L92: inc *r5
+sub #-222, *r2
+inc r5
+L93: red L244
+sub r4, r0
+L94: .string "nkljlnmjnlmrpxaqzaqb"
+dec r6
+red L7
+; comment
+cmp #13, *r2
+mov L11, *r6
+dec r3
+inc L13
+lea L137, *r2
+inc *r3
+rts
+L95: .data -502, -766
+add r1, r1
+L96: inc L245
+dec r0
+L97: red *r2
+jsr *r5
+L98: red *r6
+bne *r3
+L99: rts
+bne *r6
+dec *r1
+inc r5
+L100: .string "zgksnuece"
+inc *r5
+L101: .data -78, -716, -248, 97, -230, 432
+
+add L179, L5
+; comment
+rts
+clr *r4
+lea L162, r5
+lea L50, L98
+jmp *r7
+bne L161
+L102: .string "dpazuaymgyumm"
+jmp L46
+red r2
+not *r6
+prn L79
+not r3
+sub *r3, r7
+red *r5
+cmp *r6, r6
+dec r1
+clr r0
+bne *r0
+prn r2
+jsr L39
+cmp r2, #-80
+; comment
+mov r7, *r6
+
+cmp r4, r5
+rts
+clr L8
+jsr L265
+sub #-43, r7
+inc r4
+cmp *r7, L267
+bne L36
+L103: red *r5
+bne *r2
+L104: .string "ypvplwladq"
+L105: .data -70, -126
+prn L187
+L106: not r3
+red L22
+L107: jsr *r2
+L108: .string "xgxhytxx"
+L109: clr r5
+L110: inc L153
+stop
+L111: .data 682, 481, 359, 502, 76, 56, 617, 637
+L112: cmp L30, #197
+
+L113: .data -219, 304
+L114: clr *r4
+lea L200, *r0
+stop
+sub *r2, *r6
+jsr *r2
+stop
+prn #111
+
+red L81
+clr *r1
+bne L246
+add L261, L202
+jsr *r2
+inc L132
+add L235, r5
+sub L43, r3
+jmp L91
+L115: add r0, *r0
+cmp *r3, r3
+L116: cmp #-148, r4
+
+add *r4, r1
+add *r3, L170
+stop
+add *r7, *r3
+sub #61, *r2
+sub L111, r3
+
+prn L118
+L117: rts
+L118: .string "traqcjvxpi"
+mov #-19, *r0
+L119: mov #-144, L209
+dec L143
+
+inc *r1
+prn L253
+clr *r0
+lea L154, r0
+add #154, L34
+stop
+cmp L216, *r1
+stop
+stop
+inc r1
+sub #209, L163
+L120: stop
+lea L140, *r3
+inc *r0
+stop
+clr r5
+L121: .string "xlvqpkiyqwzhc"
+L122: not *r7
+L123: .data -965, -337
+L124: not r7
+cmp #219, #36
+cmp *r6, *r6
+add #-223, r7
+dec *r5
+dec L120
+stop
+cmp L83, *r2
+L125: dec *r6
+bne *r0
+L126: .string "ziaprxhdcm"
+L127: stop
+prn L192
+bne L132
+
+jsr L162
+prn *r4
+mov L2, *r2
+cmp #12, #226
+L128: mov L108, r1
+cmp L39, #-135
+L129: clr *r7
+L130: rts
+red L48
+red L220
+L131: .string "vw"
+stop
+; comment
+cmp L95, #-174
+
+jsr *r7
+clr r4
+rts
+inc r2
+add *r1, *r6
+stop
+
+mov *r4, *r7
+red r1
+bne L162
+
+dec r1
+inc L70
+bne L172
+not L173
+L132: prn L218
+prn L115
+add L10, L121
+L133: .data 118, -121, -152
+cmp #12, #163
+L134: inc r2
+L135: .data -108, -606
+L136: .data -656, 606, -478, 270
+jmp L46
+L137: cmp #-232, #166
+L138: cmp *r3, *r3
+clr *r0
+red r7
+jmp L81
+stop
+rts
+L139: rts
+stop
+red r5
+not L166
+L140: .data -785, 869
+mov r7, r3
+add #77, r5
+prn #-106
+jsr L71
+not *r6
+L141: jmp *r6
+dec L214
+prn r4
+L142: inc L262
+sub *r2, *r3
+mov #-56, *r7
+L143: stop
+red *r6
+inc L221
+jsr L199
+L144: .data -740, 655, -312, -874, 824, 870, 973
+L145: dec L160
+inc r1
+rts
+dec r7
+red r7
+L146: .string "xdjcalfhmnirox"
+L147: rts
+
+mov L245, L92
+lea L15, r3
+
+inc r7
+L148: cmp r2, #244
+stop
+
+L149: rts
+L150: prn #-1
+L151: cmp L30, r7
+jmp L262
+
+L152: .string "yufbwzucsxlvasluctnkqmde"
+cmp #58, *r2
+not r3
+
+inc L207
+L153: inc r2
+L154: jmp L77
+not L240
+L155: clr r5
+prn r5
+lea L33, r6
+lea L71, L207
+bne L129
+not r1
+add L163, L74
+L156: clr r5
+rts
+L157: clr *r4
+prn r2
+prn L101
+
+sub r4, L176
+prn *r3
+L158: dec r0
+cmp r6, *r4
+mov L128, r0
+; comment
+not L2
+L159: not L160
+rts
+L160: .data 216, -962, -114, 729, -328, 52, 768, 754
+L161: add r5, L232
+L162: cmp L245, r4
+dec *r0
+red r4
+jsr L129
+cmp #-150, r3
+L163: bne L73
+not L158
+mov #30, L199
+L164: .string "f"
+red L106
+inc L210
+L165: red L244
+L166: .string "gchudusammbqmnnbtoellty"
+lea L223, L197
+lea L136, *r3
+L167: jmp *r1
+L168: mov L182, *r3
+mov L202, L221
+jsr *r0
+bne L143
+L169: .string "mrrmfp"
+L170: .string "ocsblwac"
+add *r0, *r2
+cmp L183, L250
+cmp #10, #-1
+bne L239
+L171: .string "uoghewahztqpevklyxxcfnl"
+cmp *r3, #131
+red L265
+bne L128
+dec L45
+mov *r0, r0
+red *r3
+L172: add r0, *r1
+L173: lea L252, *r4
+stop
+bne *r2
+bne L262
+L174: red r5
+L175: dec r2
+sub r0, r7
+clr *r3
+mov L242, L179
+mov L209, r1
+jsr L209
+mov L177, *r2
+bne L224
+L176: prn *r1
+jsr L262
+prn #170
+L177: .data -737, -593, 193
+inc r4
+not *r2
+L178: cmp L195, *r6
+sub #155, L268
+L179: stop
+jsr *r0
+L180: .data -896
+clr r7
+L181: .string "iurimtrr"
+jsr L197
+dec r7
+L182: .string "esidspoonlfqgzfgesigs"
+add L4, r3
+dec *r7
+L183: bne L193
+L184: not *r3
+L185: .string "dlfgkeovbl"
+prn *r6
+cmp #9, #-67
+jsr L59
+rts
+not r3
+red r5
+L186: .data 930, 491
+dec *r3
+add L67, L158
+clr r3
+L187: sub *r7, r1
+dec L205
+jsr L211
+clr *r2
+add *r0, *r6
+L188: .data -834, -413, -565, -495
+L189: .data 408
+L190: not r2
+cmp r5, r4
+inc L78
+L191: .string "qyxqngbzwasoriujumye"
+inc *r1
+L192: rts
+bne L212
+stop
+not r2
+L193: clr r5
+inc L263
+
+rts
+not *r0
+prn L267
+lea L254, *r7
+L194: .string "ecbjcqebxtzilnb"
+clr L255
+L195: bne *r4
+sub r1, *r0
+rts
+dec r3
+; comment
+
+inc r4
+red L48
+L196: cmp L252, L227
+lea L223, *r1
+red *r2
+red r5
+rts
+stop
+L197: lea L225, r1
+L198: jsr *r1
+; comment
+; comment
+red *r0
+clr L40
+lea L266, *r4
+jsr L24
+stop
+; comment
+stop
+
+red L111
+L199: clr r3
+red r2
+jmp L206
+L200: not r1
+L201: red L1
+prn *r4
+L202: prn r3
+jsr L123
+bne L33
+inc L229
+lea L105, r7
+jsr L209
+lea L197, L233
+rts
+clr L187
+L203: not L34
+stop
+jmp *r3
+mov L199, L146
+dec *r5
+sub #-88, r7
+not r5
+L204: stop
+jsr L135
+inc L10
+jsr *r0
+stop
+L205: .data 434, 872, -382, -68
+jsr L56
+clr L54
+L206: .data 880, 352, -764, -90
+rts
+clr L10
+prn L20
+L207: jmp L242
+
+L208: .data 908
+rts
+L209: not *r6
+lea L120, r2
+bne L53
+L210: cmp *r4, L224
+inc r7
+L211: red r7
+inc r1
+L212: .string "nllyhsbfpsrirfxpqnek"
+L213: stop
+L214: .string "vgrlsjgbmwxhyhxht"
+inc L243
+lea L65, *r1
+L215: .string "asudmrnrmigycbnu"
+L216: dec *r2
+red L248
+L217: sub *r5, r1
+bne *r5
+rts
+prn r0
+
+stop
+red *r2
+L218: .data -969, -643, -969, -956, 200, 642
+mov #-233, *r7
+L219: bne L241
+L220: .string "qvloz"
+dec r0
+jmp L58
+bne L101
+inc L256
+cmp #88, r5
+L221: prn L20
+dec L254
+inc L240
+prn #14
+
+stop
+clr L260
+L222: .data 274, -498, 422, -421, 17, 559, 425
+jmp *r0
+sub #-116, L229
+
+add L156, L259
+rts
+sub *r4, L125
+L223: .string "go"
+add r3, r3
+stop
+L224: .data -10, 38
+cmp *r1, r7
+prn #18
+mov #27, L253
+clr *r6
+rts
+L225: not L236
+lea L263, *r3
+add *r0, *r1
+L226: .string "rayhkjzjlkspkjsmzcgtiw"
+prn L108
+clr *r3
+inc r0
+L227: .string "vftbrvuhsueerbtggduthk"
+stop
+add *r4, r6
+L228: .data 777
+clr *r5
+stop
+inc *r3
+L229: .data -138, 604, 866
+bne *r3
+
+stop
+clr *r2
+stop
+L230: mov *r2, *r6
+mov L241, L256
+stop
+add #167, *r4
+L231: inc L224
+L232: add L167, L263
+jsr *r6
+L233: bne *r4
+bne L267
+L234: .string "krjnmyhxvtlfqcaztu"
+L235: jsr L268
+jmp L265
+L236: jmp *r2
+stop
+dec *r7
+L237: prn #70
+jmp L260
+L238: .data 579, 390
+not L267
+red r4
+jsr *r1
+add r5, r7
+; comment
+L239: mov r2, L164
+clr r5
+clr *r4
+L240: inc *r5
+L241: .data -715, -580, -171, 654, -519, -330
+dec r6
+sub #-74, *r2
+prn #37
+inc *r4
+L242: .data -350, 929, 889, 506, -577, 735, 850
+; comment
+add #-34, r7
+add L28, L256
+L243: stop
+cmp L163, L29
+stop
+L244: .data 304, -786, 985, 673, -483
+add #-211, L84
+L245: jmp L184
+L246: not *r3
+
+bne *r0
+add *r7, r3
+prn *r1
+stop
+inc r7
+L247: lea L264, L261
+bne *r3
+sub *r6, L266
+red r5
+L248: .string "rcloitskzixvpjnjsfkz"
+L249: .data -819, -621, 446, 423, 754, -240
+add #168, *r0
+clr r5
+jmp *r3
+bne L267
+prn *r5
+red L252
+clr L260
+dec r1
+L250: .data 472, -506, 155, -126, -176, -316, 361
+mov #-123, *r5
+L251: .string "ltlnmbfythr"
+not L182
+rts
+stop
+stop
+red L268
+clr r7
+rts
+clr *r2
+L252: .data -891, 942, -156, -184, -958, 719
+rts
+inc L267
+lea L254, r7
+sub L265, r0
+lea L263, *r5
+stop
+dec *r3
+jsr *r2
+rts
+L253: inc *r3
+prn r1
+L254: lea L262, r0
+L255: sub #-211, r0
+bne L260
+L256: clr L79
+L257: .string "srqvuimzersqtsgsqmeehkwy"
+lea L219, r4
+sub *r6, *r5
+mov r6, *r6
+L258: clr *r6
+L259: .string "hekhmpidcdvdgclksjt"
+rts
+inc *r5
+not L55
+L260: not *r1
+jsr *r0
+inc r6
+red L265
+mov *r3, *r0
+L261: red *r2
+L262: sub #225, *r7
+inc r4
+not *r6
+stop
+bne *r2
+rts
+L263: prn *r5
+not *r0
+; comment
+bne L268
+inc *r3
+sub r2, r6
+
+prn r1
+stop
+L264: clr *r5
+jsr L55
+L265: .data 24, -653, 228, 753, -652
+L266: .string "yhnnedgmem"
+stop
+rts
+lea L267, r0
+lea L89, r6
+mov *r7, L13
+; comment
+sub r4, L138
+jmp *r5
+L267: .data -70, 211
+stop
+L268: sub *r2, *r0
+lea L99, *r1
+prn r0
+add #-246, L237
+; comment
+stop
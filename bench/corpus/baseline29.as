@@ -0,0 +1,1018 @@
+; Generated by genCorpus --seed 30
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+
+cmp r3, #-227
+jsr L150
+L0: .string "fiqmxozyxlwwpjxyslfpjhea"
+add #-105, L0
+L1: mov #-121, *r3
+lea L124, r2
+inc *r7
+red *r1
+L2: jsr L197
+jsr *r3
+L3: add *r3, r0
+prn L225
+red *r1
+; comment
+mov #-19, *r2
+clr *r1
+clr r5
+jsr L2
+dec *r0
+dec *r3
+bne L239
+red *r4
+rts
+lea L3, *r6
+stop
+rts
+stop
+L4: jsr L4
+add r5, L4
+jsr L215
+lea L3, *r5
+L5: red *r2
+dec *r2
+rts
+not L206
+inc L14
+inc r7
+sub #217, L5
+jmp *r7
+red *r3
+L6: .data 965, -787, -983, -621
+dec r7
+lea L1, r5
+add *r2, L105
+bne *r7
+jmp L241
+cmp *r0, #68
+prn r5
+L7: .string "tvpnlzznfpxmu"
+bne L3
+cmp #-230, *r3
+L8: bne *r1
+add #135, L79
+prn L227
+L9: prn r5
+inc *r3
+jmp *r1
+clr r6
+not L135
+L10: add #-130, r4
+sub #-128, *r0
+L11: mov #-25, L11
+prn L0
+jsr *r5
+not r6
+rts
+clr r0
+L12: .string "ymrzaiav"
+
+stop
+red r2
+jsr L143
+mov #54, r4
+not L11
+clr *r1
+; comment
+jsr *r5
+bne L4
+mov r3, *r2
+add #-158, *r2
+L13: jsr *r0
+L14: sub L245, r5
+L15: .string "oahtbtfshoxdxskzgkpx"
+lea L38, r1
+inc L11
+dec *r3
+L16: .string "j"
+jmp L34
+jsr *r3
+rts
+L17: bne L42
+jsr *r5
+clr L8
+jsr *r1
+not *r0
+cmp r7, *r4
+L18: lea L5, L82
+jsr L6
+red L118
+mov r1, *r7
+red *r6
+inc r3
+lea L229, *r1
+prn *r0
+clr r3
+L19: not L12
+L20: jsr L10
+L21: inc *r7
+L22: dec *r3
+rts
+cmp r3, *r4
+L23: inc L0
+cmp r1, r2
+L24: not L16
+L25: .string "hnfjumcindzf"
+cmp #75, *r1
+lea L24, *r2
+stop
+L26: rts
+stop
+cmp r3, L53
+L27: stop
+jmp *r4
+cmp r7, r6
+L28: not L7
+jsr *r7
+add L17, r2
+L29: mov L180, L204
+lea L77, *r5
+red *r1
+L30: .data -120, -697, -57, -481
+L31: red r2
+L32: mov #-7, *r3
+L33: .string "qjutfgszhlxkk"
+L34: .data -425, 166, -133, -979
+clr r7
+rts
+prn r0
+L35: inc *r4
+not *r5
+red L18
+rts
+not r1
+cmp r0, r4
+; comment
+L36: .string "fndvzzvldyxodlgrkmr"
+mov #33, *r7
+L37: jsr *r4
+jsr *r3
+mov #237, L22
+mov #206, *r0
+jsr L32
+add #-205, r6
+sub L0, *r2
+L38: red *r7
+L39: dec L11
+mov #47, L203
+
+bne L7
+clr *r6
+L40: .data -409
+L41: mov L61, r1
+bne L41
+lea L28, *r6
+lea L35, L151
+L42: not *r2
+add #71, r1
+cmp r3, #-7
+rts
+L43: jmp *r6
+bne L123
+prn #210
+mov L124, *r6
+jsr L4
+L44: not *r1
+L45: .string "xqimfpnnamixspqvczsgd"
+red L108
+L46: prn *r5
+sub r0, *r6
+rts
+add #250, *r2
+rts
+lea L176, *r5
+; comment
+rts
+prn r0
+cmp L21, #-61
+add r7, r3
+; comment
+jsr L28
+jsr *r1
+L47: rts
+inc r6
+L48: not *r6
+
+rts
+cmp L30, #-129
+L49: rts
+rts
+bne *r2
+L50: cmp *r3, L39
+prn #130
+L51: .string "zqtuz"
+red *r7
+rts
+L52: cmp #110, #252
+stop
+inc r6
+stop
+clr r5
+L53: lea L114, L186
+L54: clr L189
+dec L86
+rts
+L55: .data -742, -311, -330
+L56: .string "kkgzkbkxsgjseamcik"
+add #-45, L194
+sub #-35, r1
+stop
+rts
+L57: jsr *r6
+L58: .data 552, -894, 413, 216, -592, -364
+rts
+not r6
+lea L8, L73
+L59: cmp r5, r5
+L60: .string "udfarlcmvgrsrigqho"
+L61: not *r1
+L62: rts
+stop
+mov #114, L11
+L63: cmp #-199, r1
+L64: cmp L17, r2
+red *r7
+bne L103
+add r5, L121
+not *r2
+
+add L3, r4
+inc L102
+inc r2
+cmp L52, L14
+red L7
+clr *r3
+rts
+not r3
+jsr L226
+L65: .string "pbmqqxjrwz"
+inc r3
+jsr *r4
+prn r0
+not L163
+not L29
+L66: mov #44, *r2
+inc *r2
+mov #114, r5
+stop
+jsr L37
+L67: stop
+L68: prn *r5
+L69: jsr L82
+not L220
+stop
+L70: clr *r6
+prn *r0
+jsr *r7
+dec L6
+jmp L106
+bne *r0
+jsr *r4
+dec r6
+jmp L66
+inc r6
+L71: dec *r6
+lea L93, r2
+L72: clr L211
+bne *r0
+stop
+L73: .data 327, 707, 411, -843, -248, 22
+dec *r4
+cmp #-134, r4
+stop
+cmp L80, #-244
+L74: .data -458, -771, 750, 446
+sub r5, *r4
+L75: .data -675, -131, 279, -909, 385, 418, -696, -340
+clr L29
+rts
+rts
+jsr L12
+
+add #-164, *r1
+rts
+stop
+sub L9, *r5
+not r6
+red r6
+lea L234, L71
+L76: mov r4, L28
+mov #-174, *r1
+not r6
+sub #-238, r2
+stop
+inc *r4
+add #247, L32
+cmp L40, r4
+clr *r1
+red L115
+add *r7, r3
+cmp *r6, #192
+dec r7
+L77: inc L58
+
+prn #28
+bne L198
+lea L3, r7
+not L66
+inc L237
+L78: .string "patscfipzjydhrb"
+red *r2
+jsr *r2
+L79: .data -865, -638, 587, 53, 543, 225
+inc r1
+add #-219, r4
+L80: rts
+prn *r7
+not L73
+jmp *r2
+dec L78
+stop
+not L139
+stop
+sub *r6, r0
+bne *r7
+add L13, r6
+; comment
+clr *r2
+cmp r4, #84
+cmp L98, #-235
+L81: rts
+cmp #-219, *r0
+dec r0
+jsr *r3
+dec *r5
+jmp L94
+red L167
+bne L101
+inc L29
+rts
+prn #-168
+L82: stop
+jmp L104
+L83: .data 912, 134, 876
+sub L58, r5
+L84: .data 21, -941, -704, 993, -137, -740, -320
+red r3
+jsr *r5
+prn #168
+stop
+jmp *r3
+L85: .string "eosjfibdkslwsbnsz"
+stop
+cmp L216, L6
+bne L32
+sub r6, L172
+bne L27
+inc L73
+L86: sub L47, L85
+rts
+stop
+add *r3, r0
+lea L243, r4
+L87: lea L136, *r3
+add L144, *r3
+prn #-243
+L88: prn *r1
+inc r2
+not L191
+inc L124
+prn L134
+L89: stop
+L90: .data -411, 689, -723, -761, 150, 486, 883, 730
+jmp L89
+not r3
+inc L13
+lea L125, *r5
+jsr L176
+stop
+lea L161, L246
+L91: jsr *r1
+jmp *r2
+add *r4, L72
+jmp L221
+stop
+cmp *r0, *r0
+sub L237, r1
+jsr L141
+L92: bne L182
+red r2
+add #-14, r0
+dec *r3
+rts
+not L117
+L93: stop
+mov r3, r3
+L94: add *r1, r7
+sub #57, L189
+L95: red L246
+add #63, L57
+prn L159
+jmp L148
+L96: stop
+add L2, *r3
+red L93
+add #135, r1
+inc *r4
+L97: .string "bgjbjhtbvhu"
+prn r6
+bne *r1
+add L189, r5
+L98: mov #-76, r0
+rts
+prn *r4
+L99: .string "qukdxgjcovrqfd"
+prn #51
+red r2
+L100: .string "oqj"
+rts
+
+lea L132, *r0
+stop
+; comment
+L101: mov r3, *r7
+clr *r7
+L102: stop
+inc L117
+bne *r3
+L103: dec *r4
+L104: inc r2
+not L16
+L105: .data -949
+cmp r2, *r0
+
+cmp r1, L231
+jsr L19
+sub r7, *r6
+stop
+dec L121
+lea L53, L31
+L106: .data -968, 347, -254, 624, 232, -247
+red *r3
+jsr L105
+rts
+; comment
+; comment
+stop
+; comment
+sub #146, r7
+lea L239, r7
+red *r5
+not *r4
+clr r0
+jmp *r6
+inc *r0
+mov *r2, L179
+L107: .data 739, 546, -107
+rts
+jsr *r1
+L108: .data -89, 843, 263, -687, 614, -324
+add #-99, L240
+
+jsr L15
+sub L37, r4
+red r6
+L109: .string "ycndmezxlvn"
+lea L182, *r4
+sub *r1, L246
+L110: stop
+add #222, r7
+cmp *r4, *r6
+clr r7
+bne *r0
+L111: dec r2
+rts
+lea L170, *r3
+mov L32, L88
+L112: jsr L183
+add *r3, r0
+stop
+L113: rts
+prn #-35
+sub #165, L84
+inc r2
+bne L190
+jmp L10
+lea L216, L68
+L114: lea L77, r3
+lea L37, L209
+L115: .data 918, -206, -973, 643, -440
+red r5
+bne *r4
+red L63
+L116: .data -104, -62, -713, 251, -383, 518
+not L236
+L117: jsr *r5
+sub *r4, L57
+stop
+L118: prn L15
+L119: .string "vgsetqwvrrodwrdxn"
+stop
+dec r5
+
+red r0
+rts
+red L21
+; comment
+dec r7
+L120: .string "drcpevtndiplysvzqsi"
+add r5, *r0
+
+bne *r2
+inc *r6
+lea L34, L152
+L121: stop
+L122: .string "vkeejgjaerxqofnbtbn"
+L123: .string "kkdgpqfvdarjadsyhdhhp"
+L124: .string "tsbkvbejbmr"
+inc r6
+jsr L23
+jmp L56
+add r1, *r4
+bne *r4
+rts
+L125: not L246
+stop
+
+add #-174, *r6
+L126: not *r1
+lea L54, r3
+L127: cmp #98, L114
+L128: rts
+sub r5, *r3
+L129: jmp *r2
+inc *r1
+cmp #214, L128
+not r4
+not L62
+L130: .string "axlqgbpgufwulwietigob"
+L131: .data -586, 899, -182
+rts
+stop
+jmp *r1
+
+L132: .string "whkfe"
+inc r2
+cmp r2, #-195
+jmp *r5
+jsr L32
+jsr *r5
+dec L13
+prn *r5
+sub r5, L11
+lea L239, *r1
+red r5
+stop
+inc r6
+L133: red L75
+stop
+L134: not *r6
+jmp *r6
+L135: .data 0
+L136: .string "kikkhcraponnkhwdbjejpo"
+L137: .string "ieoqajnlv"
+not *r5
+sub *r5, L101
+add L83, L63
+cmp L188, *r6
+inc L149
+sub #-72, r5
+rts
+add r2, *r5
+add r6, L215
+bne L202
+add r4, L75
+sub *r6, *r7
+L138: .string "wnusptd"
+sub #45, *r7
+L139: sub *r7, r1
+jmp *r0
+lea L157, r1
+add *r1, *r6
+
+stop
+mov L141, r0
+L140: clr L76
+prn *r4
+mov #206, L58
+prn L186
+sub r0, *r2
+stop
+not r1
+cmp L130, #-71
+not L120
+mov *r7, *r0
+L141: .string "vdrjvgjrpdutevwqixhtre"
+bne *r2
+L142: .string "nxhxvld"
+sub #111, r4
+rts
+not r0
+rts
+jmp *r0
+lea L60, r0
+lea L61, r0
+inc *r2
+L143: sub L108, L66
+red *r6
+rts
+mov #128, r3
+L144: jsr *r5
+
+L145: .string "uhmluun"
+not r0
+L146: not r6
+L147: add L153, L31
+; comment
+jsr L72
+L148: .data -342, -993, -563, 160, 718, -50, -509, -507
+jsr L37
+mov #165, r2
+red *r4
+lea L116, *r0
+rts
+add #-134, *r6
+jsr L176
+prn *r3
+L149: .string "zpswedjyywhtti"
+cmp r4, #-40
+red *r0
+L150: .data -604, 385, -660, -471, 149
+lea L192, L224
+clr L145
+L151: add r1, *r7
+rts
+L152: add *r2, *r3
+jsr *r7
+dec r5
+; comment
+L153: prn L11
+bne *r2
+prn #-12
+rts
+L154: .data 66, -827, 463, -966, -804, 594, 723
+L155: jsr *r3
+not r2
+rts
+not r3
+inc r7
+add #-69, *r0
+L156: .string "kttfqlstvgrqgbfno"
+jmp L139
+L157: .string "bvyd"
+bne *r0
+jsr L124
+; comment
+L158: inc *r7
+bne L213
+jsr L107
+L159: prn *r2
+clr *r4
+add *r7, *r2
+cmp #208, L8
+
+dec L211
+clr L68
+not L51
+dec r5
+lea L79, *r7
+L160: prn #-170
+jmp L95
+inc L164
+add #-11, r3
+cmp *r6, L187
+clr L52
+jsr *r3
+rts
+L161: not L41
+jmp L61
+L162: .string "cfsnm"
+not r4
+prn r0
+dec r4
+cmp L79, #95
+L163: stop
+not *r1
+bne *r6
+add *r3, L173
+mov #-163, r4
+
+jmp L44
+bne L36
+
+bne *r1
+L164: mov *r7, L229
+L165: .string "vdp"
+L166: .string "zvgxhberptngfnckeqkf"
+prn #108
+L167: .string "zetepfvhytumi"
+L168: add *r3, L142
+bne *r7
+L169: .data 256
+dec L178
+stop
+sub r2, *r3
+cmp L198, *r5
+lea L81, r6
+red *r3
+red L201
+cmp *r3, L104
+inc L242
+prn L235
+mov *r5, *r3
+not r7
+prn L180
+add r3, *r3
+L170: bne L237
+sub L222, *r0
+dec r7
+stop
+L171: prn *r6
+inc L188
+jmp *r0
+L172: .string "shhigdfwjvjuxujfec"
+L173: red L68
+add r0, L99
+mov L126, L26
+stop
+dec r6
+L174: .string "foyeckctjhcxbfghtcomncbn"
+sub *r2, L52
+prn L79
+bne L48
+rts
+add #23, r1
+mov r6, *r3
+L175: stop
+L176: dec L104
+L177: sub *r7, *r2
+rts
+L178: bne L241
+L179: mov L236, L48
+sub L209, L32
+bne *r2
+jsr L243
+stop
+jsr L80
+sub L246, L87
+L180: inc *r6
+L181: not L193
+red L119
+L182: bne *r5
+L183: .data -722, 368, -140, -900
+
+L184: .data -650, 403, -394, 890
+L185: .string "hijl"
+prn *r4
+red r1
+dec *r2
+prn #-221
+not L203
+bne *r7
+L186: bne *r4
+prn r1
+add *r2, r0
+L187: jmp *r1
+clr L96
+; comment
+bne *r6
+dec L117
+add r7, r6
+sub r6, r0
+L188: add *r3, L157
+add r1, *r2
+; comment
+L189: rts
+red *r1
+prn L236
+jsr *r3
+jmp *r7
+L190: .data 640
+L191: clr L246
+lea L48, *r7
+cmp *r6, L225
+prn L196
+clr L204
+L192: add *r4, *r5
+L193: rts
+sub #23, *r6
+L194: jmp *r3
+; comment
+L195: mov *r5, L37
+L196: bne L228
+L197: .data -396, -21, -102, 22, -280, -105, -884
+dec L232
+jmp *r3
+stop
+jmp *r2
+; comment
+sub L245, *r6
+jmp L147
+lea L96, r3
+dec r0
+clr L90
+prn r5
+mov #185, r1
+mov r0, r2
+lea L13, L103
+not r5
+L198: jsr *r5
+stop
+dec *r5
+inc r2
+L199: .data 423, -578, -682, -681, -420, -889, 520
+L200: prn L245
+dec r6
+add r5, *r0
+stop
+L201: dec *r4
+sub *r5, L38
+add L237, L166
+cmp #239, #-122
+not r7
+L202: .data -39
+not r5
+mov *r6, r2
+L203: jsr *r2
+; comment
+jsr L130
+L204: .string "fzrkvzgep"
+inc L53
+prn L210
+dec r7
+cmp r2, #-89
+L205: .data 681, -456, 522, 715, 656, -429
+rts
+not L241
+not r5
+L206: lea L136, L5
+L207: lea L239, r4
+; comment
+rts
+L208: inc L105
+bne L226
+L209: stop
+cmp r4, #178
+cmp r4, #-206
+L210: jmp *r1
+jsr L49
+lea L58, *r6
+L211: add *r7, r4
+rts
+rts
+L212: stop
+add #-89, L213
+inc *r2
+L213: .data -252, -953, -244
+lea L18, *r7
+mov #-114, L180
+L214: mov r2, *r3
+L215: .string "gmzficvncvazdxswzjuwn"
+not *r7
+lea L136, L115
+mov *r4, r1
+not *r5
+L216: jmp *r4
+add #-253, *r5
+dec L225
+not L107
+rts
+L217: dec *r2
+L218: .string "iogntcftosohnwljd"
+lea L232, L234
+L219: add *r1, L241
+red *r4
+cmp *r5, r2
+L220: .data -379, -922, -785
+L221: .string "ijue"
+add r5, *r1
+bne L226
+L222: .string "wyx"
+not L242
+not L240
+L223: dec r3
+stop
+rts
+L224: bne L125
+cmp r7, L228
+clr r5
+add L232, *r3
+inc L233
+; comment
+mov L226, *r3
+mov r2, L114
+mov L15, L50
+L225: clr r2
+rts
+add #-193, r0
+L226: .string "ujpgypfxaxjwq"
+stop
+cmp #-92, #15
+
+rts
+add *r4, L228
+
+; comment
+sub L205, r5
+L227: .string "cllbknjquqrrvvcmp"
+red r7
+L228: dec *r1
+cmp L90, r7
+prn *r4
+add #255, *r1
+L229: .string "aljsjj"
+bne L238
+dec L203
+dec *r4
+sub *r7, r0
+red r1
+inc L238
+bne L192
+add #-130, *r3
+cmp #-90, L132
+cmp L174, *r3
+red *r0
+L230: stop
+dec *r0
+L231: cmp #-89, #-221
+L232: red *r6
+red *r3
+not r5
+not r1
+rts
+inc L169
+jmp L235
+jsr L242
+bne L92
+; comment
+add r1, r7
+stop
+add r0, *r0
+L233: not L98
+cmp L235, r5
+stop
+clr r2
+L234: rts
+rts
+L235: sub *r2, *r0
+L236: clr *r1
+L237: .data 730, 880, 710, 465, -930, 187, 665, 825
+rts
+dec *r3
+
+not r2
+rts
+clr *r3
+L238: .string "xntkzqtnowei"
+jmp *r2
+
+L239: .string "yqughgshlywmwbuqlggtscl"
+cmp L240, #100
+; comment
+L240: rts
+rts
+inc L218
+jmp L242
+dec r3
+L241: lea L105, r0
+prn L245
+; comment
+L242: .string "dzylmnwtdpmewu"
+bne *r3
+stop
+L243: jmp *r5
+prn L159
+jmp L246
+stop
+dec *r5
+mov #21, L35
+stop
+L244: jmp *r7
+; comment
+add r7, L86
+add r1, r1
+add *r4, L15
+L245: .string "zzqsnzmlnpcdmvchrniun"
+clr L246
+L246: bne L51
+rts
+bne L113
+stop
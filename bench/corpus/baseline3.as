@@ -0,0 +1,1020 @@
+; Generated by genCorpus --seed 4
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+L0: add *r7, L81
+L1: bne L1
+L2: .string "prb"
+L3: jsr *r7
+red r1
+L4: .data -936, -569, -790
+not r1
+L5: cmp *r1, r6
+not *r2
+mov #108, L1
+dec r3
+not r4
+clr L219
+mov #-163, *r4
+jsr L196
+jsr *r2
+mov *r6, *r1
+mov #-100, L4
+L6: .data -46, -706, -608, -510, 613, 322
+prn L3
+prn *r7
+inc *r7
+prn #-171
+cmp L226, *r2
+lea L2, *r7
+L7: .string "oqjphtpugz"
+stop
+red r4
+lea L134, *r3
+prn L147
+bne *r2
+add L3, *r7
+L8: prn L176
+L9: .data 645
+jmp *r2
+L10: .data 308, 330, -568, 346, -252, -946, -831, 878
+; comment
+L11: .string "kubgxiuwzsjvrrmrrrktt"
+rts
+lea L66, r5
+cmp L242, #89
+L12: stop
+; comment
+add #207, *r6
+L13: mov L134, r4
+add r5, *r4
+clr r2
+L14: mov r7, r1
+jsr *r0
+jsr L249
+clr L13
+jmp *r1
+prn r4
+jsr L235
+lea L1, r3
+L15: jsr L0
+jmp *r0
+mov r2, L148
+rts
+sub *r3, r0
+jmp L171
+bne *r7
+L16: .string "y"
+jsr L169
+L17: jsr L119
+L18: .data 490, 509, -842
+inc *r5
+dec *r5
+L19: .string "lqbl"
+jmp L8
+prn r6
+stop
+stop
+stop
+add L230, *r1
+L20: jsr *r7
+clr *r5
+add *r3, L233
+sub L42, L206
+L21: .data 834, 31
+cmp r1, r7
+add *r1, r7
+; comment
+L22: .data -47, 244
+add r5, r2
+
+L23: inc *r3
+prn r7
+inc *r3
+add *r3, *r0
+mov *r5, *r3
+L24: jsr L19
+L25: prn L15
+L26: .data 769
+
+red *r1
+not *r5
+L27: .data 401, -654, 616, -894, 752, -554, -390, 488
+lea L6, *r4
+stop
+
+cmp #-121, *r4
+prn *r4
+L28: not r5
+L29: .data -162, 165, -906, 606, -288, -69
+bne L56
+not *r4
+sub r1, L13
+; comment
+bne L146
+L30: red *r5
+prn r5
+dec r1
+dec L151
+rts
+mov r6, *r6
+jmp *r3
+not L28
+prn L202
+jmp L73
+mov r5, L22
+; comment
+add #181, *r6
+L31: .string "ryehqccpcprgpe"
+mov r4, L138
+L32: bne *r1
+jsr *r0
+L33: cmp r4, *r4
+lea L125, L118
+stop
+L34: bne L19
+lea L25, L6
+sub *r6, r7
+inc r5
+red r5
+jmp *r5
+lea L205, r1
+; comment
+prn r3
+sub L7, r6
+sub L195, L21
+not r2
+mov r5, r0
+L35: .string "dmwaipyksjvjnzs"
+prn #255
+not r4
+red r5
+cmp *r0, L49
+lea L128, r1
+L36: sub #-135, L25
+cmp *r7, L28
+inc L229
+L37: lea L6, r5
+bne *r3
+lea L34, *r6
+L38: prn #159
+mov #174, r5
+L39: add *r0, L155
+L40: mov #-198, L91
+dec r3
+stop
+L41: prn r2
+L42: .data 480
+add *r4, *r7
+inc L23
+L43: add L138, L11
+bne *r3
+cmp *r1, L20
+
+L44: .string "oqsvqrpnaaweepnxdhgbx"
+clr r3
+L45: .string "vsgsnfzrd"
+bne *r1
+L46: bne L276
+dec *r2
+add L100, r6
+L47: .data 294, 333, -670, 674, -812, -975
+rts
+prn *r1
+stop
+L48: bne L26
+L49: lea L248, *r5
+rts
+L50: prn r3
+inc L32
+L51: .data -499, -283, -266
+L52: .string "gzkhxhdtmodzfe"
+L53: .data -72, -413, -195, -329, -513, -421, 977
+sub #46, r2
+dec *r4
+sub L27, *r1
+cmp L17, L48
+mov L187, *r2
+prn r4
+L54: prn r1
+not r6
+L55: dec r1
+L56: .data -570, 937, 228, 235, 817, -375, -429, 848
+jmp L182
+jmp *r6
+cmp L204, #-225
+lea L2, *r3
+prn #-231
+
+inc L106
+jsr L18
+L57: .string "clcnzyfuqnlfl"
+sub #-62, *r5
+mov r4, r7
+rts
+inc L200
+not L3
+jmp *r3
+cmp r0, #64
+; comment
+jmp *r7
+lea L276, L43
+L58: mov r6, r2
+L59: .string "xktpydlxugovbc"
+stop
+L60: .data 324, 382, 370, -67, 723
+inc *r7
+bne *r5
+jmp L152
+L61: bne *r6
+L62: sub #152, *r1
+mov r2, L30
+L63: dec *r4
+not r6
+not L22
+not r7
+bne *r1
+stop
+L64: .string "mdmkyqfljpokvznlmsrc"
+bne *r3
+L65: jmp L178
+L66: cmp *r0, #251
+prn *r0
+
+dec L237
+bne *r3
+not r4
+L67: stop
+rts
+jmp *r1
+dec L116
+L68: .string "htgkuyxwkyivsyyfguujjxw"
+L69: prn L29
+lea L271, L9
+add L263, r2
+stop
+L70: .data 138, 779
+L71: add L7, *r5
+L72: prn #-190
+L73: red *r3
+rts
+inc *r7
+L74: .string "hybkacsqfqcayetfnfdgzmii"
+L75: jsr *r0
+not r4
+bne *r4
+not *r6
+red r2
+; comment
+cmp #209, L131
+stop
+rts
+jsr L13
+cmp r0, L210
+rts
+L76: red *r0
+clr r1
+L77: prn *r0
+cmp r2, L51
+L78: rts
+inc L76
+not *r0
+not L6
+sub r3, L74
+; comment
+sub *r2, *r0
+rts
+L79: cmp #-108, r2
+red *r0
+L80: jmp *r1
+bne *r3
+L81: .data -227, 132, -536, 12, -786, -310, 497, -108
+rts
+bne L185
+L82: .string "cgadyzidchtjh"
+inc *r0
+jmp L66
+L83: cmp #197, L83
+cmp r7, #-231
+sub L17, L81
+L84: lea L57, *r0
+L85: clr L188
+L86: .string "hskvcgeykbwhojottqhorwuc"
+rts
+stop
+L87: cmp *r3, L1
+L88: stop
+add L142, L156
+rts
+bne *r0
+; comment
+jmp L241
+sub *r7, r5
+stop
+not r7
+L89: .data -131
+stop
+L90: .string "kgrphzukuooektlynorom"
+cmp *r2, L198
+L91: lea L98, *r5
+inc *r6
+red L88
+rts
+jmp L238
+L92: stop
+lea L194, L42
+red *r3
+L93: jsr L225
+prn #58
+L94: not L14
+add *r4, *r0
+jmp L4
+dec L247
+L95: jsr L91
+bne *r6
+jmp *r5
+red *r1
+dec L54
+L96: .string "mgllktqe"
+L97: .data -116, 551, 566, -193, 567
+L98: .data 157, 360, 887, 590, 539, -666, -209, -632
+lea L258, *r2
+inc L184
+add *r3, *r6
+red *r5
+clr r4
+L99: inc r5
+stop
+L100: .data -217, 566, 191, -381, -416
+lea L217, *r2
+; comment
+mov L83, *r2
+cmp r7, #155
+L101: cmp #-174, L76
+not L226
+sub L39, *r6
+clr *r7
+clr r2
+not L2
+jsr L102
+L102: inc L32
+bne L11
+L103: .data -430, 480
+jmp *r6
+lea L86, r5
+jsr L179
+inc *r2
+rts
+L104: prn L160
+L105: prn r1
+L106: red L70
+jsr *r5
+prn *r5
+rts
+L107: prn *r0
+L108: red *r7
+cmp L37, #252
+rts
+cmp *r7, *r5
+prn L258
+clr L192
+lea L219, r1
+lea L143, r2
+sub *r0, L151
+jsr L47
+clr L113
+L109: .string "bpcmg"
+stop
+stop
+L110: red L165
+; comment
+lea L137, L39
+L111: bne L265
+cmp r5, L254
+L112: sub r1, L7
+bne L159
+sub #-29, *r3
+L113: .data 707
+add L132, r2
+prn *r7
+inc *r4
+lea L212, *r5
+inc L118
+cmp *r2, #-54
+L114: .data 503, -576, -79, 215
+lea L236, L2
+mov #-150, r4
+prn *r5
+L115: cmp r2, r2
+L116: jsr L137
+rts
+L117: jsr L109
+; comment
+jmp *r7
+lea L98, L88
+clr r6
+L118: stop
+dec r4
+
+L119: red L75
+cmp *r3, *r4
+inc *r5
+clr *r1
+lea L276, L28
+mov #-12, *r1
+red L18
+L120: .data -89, 304
+jsr L184
+cmp r1, *r6
+stop
+red r3
+rts
+dec *r5
+prn L85
+sub *r5, *r7
+L121: jsr L177
+cmp *r1, *r7
+lea L202, L59
+L122: .data -425, 951, 909, -17, -123, -281
+rts
+mov #-194, *r6
+prn L157
+jsr *r2
+L123: .data -147, 534, 74, -379
+; comment
+mov *r0, r0
+inc L117
+L124: sub L8, L156
+inc L191
+add #70, *r6
+jmp L164
+cmp L213, r5
+lea L64, *r3
+L125: rts
+lea L40, L180
+not L266
+jsr *r6
+L126: prn L146
+jsr *r3
+lea L36, L152
+rts
+inc r3
+rts
+add L89, r0
+jsr *r5
+
+jsr L29
+L127: bne L46
+L128: .data -527, -213, -271, 370
+
+L129: stop
+rts
+prn L100
+jmp *r3
+L130: .data -862, 181
+jsr *r2
+red r1
+inc r0
+L131: .data 127, 412, -227, 744
+L132: lea L11, *r6
+L133: add L162, *r0
+prn L7
+bne L88
+inc *r7
+red r2
+red r0
+cmp L192, #-55
+dec L233
+cmp r7, L136
+prn #111
+; comment
+clr L273
+prn L32
+not r5
+bne *r1
+clr r7
+add #-201, L74
+L134: mov #-251, r7
+; comment
+stop
+dec *r7
+rts
+rts
+jsr *r1
+add L194, L189
+L135: .string "ohma"
+L136: inc *r3
+cmp #-250, *r6
+sub r5, L275
+add r5, r1
+mov #135, *r1
+L137: .data -564, 264, 188, -149, 283, -964, -557, -268
+bne L245
+cmp #-94, *r5
+L138: jmp L252
+L139: stop
+dec *r6
+sub L185, L245
+L140: cmp #178, L46
+lea L277, L100
+L141: .string "dkwsqfaaavvpgzidjxaqmgd"
+not L275
+L142: rts
+L143: .string "pyiayzvacbdsbmroddds"
+stop
+rts
+; comment
+L144: lea L58, *r4
+dec *r5
+L145: jmp *r6
+lea L88, r6
+L146: rts
+sub L111, r6
+bne L177
+; comment
+L147: clr *r2
+dec *r2
+prn r7
+stop
+L148: red r1
+red *r4
+L149: clr *r1
+clr r2
+jsr L158
+jmp *r7
+stop
+sub #-239, *r5
+red *r4
+mov L193, r2
+bne *r1
+L150: .string "fhurnemgbnpuvkywstko"
+; comment
+L151: .data 500, -44, 519, -9, 115, -861, -560, -920
+jmp *r7
+jmp *r2
+L152: cmp #53, L20
+bne L54
+mov r5, L232
+red L261
+clr L109
+red L47
+red L218
+stop
+bne *r0
+L153: inc r3
+sub r5, L131
+lea L68, L262
+stop
+red L72
+inc L155
+not r4
+L154: dec r1
+clr r3
+sub L230, *r6
+bne L171
+prn #-236
+cmp L131, r5
+L155: bne *r1
+cmp L155, #-20
+L156: .data 378, -512, 486
+mov L1, r6
+dec *r4
+L157: .data 186, -220, 972, 927, -536
+L158: add L179, r7
+L159: .string "fweil"
+L160: .data 643, -583, 495, -743, -936, 888, 974, 897
+inc *r2
+dec *r5
+cmp #-121, *r7
+L161: lea L90, *r1
+L162: .string "dyaeuszoduswojvbgjvrszx"
+jmp L82
+L163: clr L3
+mov #-121, *r3
+; comment
+jmp L23
+inc L193
+not *r0
+L164: .string "vpradu"
+L165: dec r3
+dec *r0
+prn L11
+jsr *r5
+red *r7
+L166: clr r4
+jsr L248
+jsr *r0
+stop
+L167: mov #-245, L66
+add r3, L189
+stop
+cmp *r6, L244
+red L175
+L168: prn r6
+sub *r2, L215
+rts
+jsr L229
+cmp r4, r7
+cmp r0, L264
+L169: .data -822, 323, 947
+L170: .string "grrvdxpjreymgsaqyjtoildg"
+L171: .string "omwh"
+L172: prn r6
+red L155
+dec r1
+jmp *r2
+add L230, r7
+jmp L262
+dec L150
+mov #-61, r7
+mov *r1, r1
+add L221, L94
+inc L232
+jmp *r3
+inc r1
+
+sub #-135, L120
+; comment
+
+mov #-73, *r7
+prn #-111
+jmp L113
+mov *r1, *r2
+stop
+L173: cmp r7, r6
+dec L52
+L174: bne *r0
+L175: lea L106, r1
+L176: .data 543, 356
+mov L211, L277
+rts
+jsr *r5
+inc *r0
+inc *r2
+jmp L19
+add r7, L124
+prn #-66
+red L205
+rts
+cmp L185, L226
+red L219
+L177: rts
+stop
+; comment
+cmp *r4, #-100
+inc r4
+not L222
+stop
+rts
+jsr L79
+jsr L23
+L178: .data -529, 486, -405, 102
+clr *r3
+L179: inc r4
+
+; comment
+L180: .string "udxtuclyykccvvyldwxkkzsh"
+not r5
+L181: clr L270
+add #25, L229
+jmp L57
+prn #65
+cmp L200, #245
+L182: .string "rviospexihvqawwblbdcvr"
+jsr L157
+clr L108
+sub #185, r1
+clr L233
+not *r7
+red L51
+cmp *r2, L249
+
+L183: clr L101
+L184: inc L197
+jmp *r2
+; comment
+mov r1, L146
+L185: .string "svietknesi"
+lea L243, r7
+L186: .data 480
+clr r0
+jsr *r1
+cmp r0, #60
+dec r1
+sub #-45, L257
+jmp *r0
+lea L69, L274
+bne L155
+L187: bne L213
+L188: .string "kqmb"
+prn L125
+L189: clr L224
+L190: dec r6
+clr *r5
+jmp L24
+L191: jsr *r6
+sub #-191, r4
+red *r4
+not r7
+red L55
+lea L253, L200
+stop
+sub L81, r3
+
+; comment
+bne *r0
+mov r0, *r7
+L192: cmp L15, #-211
+not r2
+cmp #68, *r0
+lea L255, L139
+L193: inc *r4
+L194: rts
+bne L17
+sub r3, L270
+L195: sub L132, L95
+dec r7
+red r2
+L196: .string "dbg"
+add r6, *r1
+
+bne *r1
+; comment
+L197: .string "qoodhaztfhzlxrfw"
+L198: stop
+L199: lea L86, L58
+cmp L202, #-234
+
+dec r0
+jmp *r6
+L200: cmp r2, #-167
+jmp L230
+L201: cmp #56, L262
+dec L158
+prn r3
+bne L194
+jmp L108
+not r7
+L202: .data 950, 214, -854, 791, -129, -187
+L203: .string "aotdi"
+prn r4
+rts
+L204: .data 145, 60, 155, 71, 12, -933, -178, -875
+sub r3, *r2
+L205: mov L276, r7
+jmp L196
+L206: lea L3, *r4
+jmp L246
+L207: .string "svwcqzic"
+L208: stop
+L209: stop
+
+L210: .string "rueslciwnhpklkzox"
+add L232, r7
+L211: .data -628, 149, 369, 246, -266, 803, 942
+jmp *r7
+L212: jmp *r4
+dec L23
+jmp L116
+sub L92, L63
+L213: .data -211, 199, 969, 294, 324, 566, -581
+L214: .data 93, 969, 864
+dec L201
+L215: prn *r3
+rts
+not *r6
+L216: not L259
+; comment
+add r7, r1
+prn *r0
+L217: clr L135
+sub L240, *r0
+not r2
+prn r2
+L218: lea L179, L263
+L219: inc r2
+jsr L177
+prn r1
+mov r1, L97
+L220: bne L120
+jmp *r4
+clr *r6
+prn L12
+stop
+clr *r7
+rts
+L221: stop
+not L169
+L222: cmp *r3, L83
+rts
+jsr L255
+bne L232
+dec L263
+jsr *r4
+mov *r5, L230
+rts
+L223: .data 730, -616, -930, -762, 939, 956
+add r7, *r0
+L224: bne *r3
+L225: .data -900, -237, 282
+jmp L250
+jsr *r0
+mov #239, r7
+jsr *r6
+prn r7
+jmp *r2
+prn L57
+L226: rts
+L227: .string "xtmibosndiwqsrinzw"
+L228: .string "clevryjmcpdu"
+jmp *r1
+add r4, L180
+jsr *r4
+stop
+bne *r7
+jmp L242
+stop
+L229: .data -817, 551, 924, -536, -590, 449
+mov #124, r3
+mov *r6, *r4
+prn #231
+sub r3, *r4
+mov r2, L252
+dec L91
+add L185, L84
+L230: lea L266, r7
+stop
+rts
+L231: inc L124
+bne *r4
+jmp *r6
+clr *r3
+L232: .string "xqennxhwbzffoozsr"
+not *r2
+mov r6, *r5
+L233: stop
+add #-4, L243
+L234: .data -442, -327, -206
+sub #124, *r1
+inc L164
+dec *r6
+L235: cmp *r2, #-75
+jsr L253
+; comment
+dec r0
+L236: lea L248, *r0
+prn L246
+red *r4
+prn *r7
+dec L244
+cmp #45, #-134
+inc r1
+jsr *r2
+clr *r5
+mov L58, *r2
+jmp L239
+
+lea L1, *r7
+L237: stop
+stop
+L238: jmp L247
+L239: .string "gwgqzqqxczwdizd"
+bne L255
+stop
+L240: .string "tboznottovbfpntic"
+L241: dec r0
+clr L40
+bne L117
+clr r2
+add *r5, r1
+rts
+L242: .data 499, -837, 176, -88
+stop
+not *r0
+inc L273
+clr *r5
+bne L14
+stop
+jmp L251
+L243: add *r2, *r6
+clr *r5
+sub r7, L277
+bne *r7
+cmp L163, L277
+jmp L275
+; comment
+jmp L260
+bne L261
+L244: stop
+L245: sub L264, r5
+lea L267, L35
+L246: sub #-165, L271
+L247: not *r6
+dec L184
+dec r7
+L248: mov r3, *r2
+L249: not L208
+jsr L101
+red L256
+red *r4
+prn L258
+add *r5, r0
+jmp *r3
+add r6, r2
+L250: clr r3
+jmp *r5
+L251: inc r7
+dec *r1
+L252: .string "maogu"
+
+L253: .string "lpnijp"
+mov L29, L103
+jsr L268
+L254: jmp L134
+not L260
+bne L122
+stop
+jmp L201
+red r3
+not *r4
+not r3
+jsr L265
+L255: rts
+bne L275
+; comment
+L256: prn r2
+lea L49, L263
+red L56
+not L265
+lea L202, L219
+jmp *r1
+L257: lea L259, r4
+L258: jsr *r1
+not L61
+jmp *r4
+L259: .string "klzke"
+jmp L267
+mov #-22, r3
+L260: .data -507, -753
+L261: jmp *r1
+inc *r4
+add r7, L274
+rts
+mov #-89, *r3
+L262: lea L269, L25
+; comment
+cmp #-74, *r1
+L263: .data -286, 410, 369, 227, 23, -514, -952, 368
+L264: .data -552, -105, 960, 430
+red *r6
+sub r3, *r5
+L265: .string "svnqnriskinrgjbhhwobs"
+dec r1
+L266: inc L267
+jmp *r4
+L267: .data 807, -553, -460, 332, 945, 752, -185, 855
+L268: not L23
+cmp *r2, r2
+red r6
+L269: jmp L272
+inc L272
+rts
+mov L33, r2
+sub r2, *r7
+lea L275, L277
+not r0
+sub #185, L165
+; comment
+sub r4, r7
+cmp r1, #251
+mov L48, *r1
+L270: add r5, r7
+L271: mov r6, *r3
+clr L275
+L272: prn #237
+L273: sub L274, *r2
+clr L104
+dec *r7
+cmp *r5, r7
+L274: inc r2
+not r7
+lea L48, r7
+L275: inc r7
+L276: lea L277, r2
+L277: dec L138
+stop
@@ -0,0 +1,1019 @@
+; Generated by genCorpus --seed 31
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+L0: .data -336, 949, 35, -418
+L1: .string "ixftvgovnmxdjvvefyohuity"
+not r6
+bne *r3
+L2: sub *r4, L0
+L3: sub *r5, r1
+jsr L19
+jsr L1
+jsr L254
+jsr L0
+lea L0, *r5
+prn #-203
+; comment
+rts
+
+add *r4, L45
+inc L1
+L4: not L3
+cmp #-218, *r5
+rts
+L5: dec L171
+not r6
+stop
+cmp L208, #-129
+L6: .data -68
+mov #89, r6
+not *r2
+clr *r6
+L7: prn L3
+jsr *r0
+rts
+prn #6
+not *r6
+L8: prn *r7
+red *r1
+cmp *r2, *r2
+jsr L178
+red L3
+rts
+bne L2
+L9: bne L261
+inc r5
+L10: .string "fcirxclvrxegyiuqulai"
+sub L9, *r6
+stop
+red r4
+dec *r0
+stop
+L11: .data -841, -747, 640, -788, -543, 810, -233
+stop
+L12: .string "ikemalxjzfsfatpz"
+red *r3
+add *r0, r5
+stop
+L13: .string "fouo"
+bne L9
+red L8
+L14: .data -721, 465, 495, -337, 331, -452, 696
+red L14
+not *r1
+jsr L140
+lea L231, r1
+prn r6
+add L6, L6
+prn *r2
+bne L9
+L15: stop
+prn r1
+L16: red r0
+jmp L12
+sub #152, r2
+stop
+rts
+add #-30, r4
+dec r0
+L17: mov r2, L10
+inc L154
+add *r4, r0
+dec r7
+inc L174
+clr L173
+L18: dec L41
+L19: .string "iizogpz"
+L20: .string "sqewvhlevrvxrdrdjblsn"
+L21: .data -390, -71
+jmp *r2
+sub L18, r1
+L22: cmp #72, #-44
+not L66
+jmp L11
+L23: bne *r5
+sub #165, *r2
+clr r2
+lea L89, L14
+not *r6
+bne L39
+; comment
+red r1
+clr r2
+L24: bne L48
+; comment
+lea L17, L17
+mov r0, L74
+stop
+L25: red r0
+red *r4
+inc *r5
+L26: add r6, *r6
+; comment
+red L150
+red L146
+prn r6
+lea L21, r7
+red r6
+L27: mov #161, *r0
+L28: stop
+clr *r7
+
+
+rts
+add #187, *r3
+
+bne L31
+dec *r3
+L29: .string "wtzzlt"
+jsr L197
+jsr L13
+jsr L114
+L30: jmp L26
+not L1
+mov #-124, *r7
+L31: prn *r6
+L32: mov L261, L26
+cmp *r5, r0
+L33: sub *r3, r4
+mov *r6, r6
+L34: bne L126
+mov #-77, r6
+sub #195, L6
+L35: .string "hphremyvicbeucv"
+red *r1
+L36: lea L60, L3
+L37: not r7
+cmp L14, L59
+L38: add r2, *r6
+mov *r7, *r1
+bne *r6
+red r1
+dec *r2
+not L36
+rts
+rts
+
+stop
+rts
+clr *r5
+stop
+L39: jmp L36
+L40: dec L48
+L41: add #-75, r1
+inc L13
+inc *r5
+L42: bne *r3
+cmp *r2, *r1
+clr r5
+mov L127, r4
+jmp L10
+L43: bne L211
+mov *r5, r2
+L44: clr r4
+L45: jmp *r7
+mov #-245, *r5
+stop
+mov L102, *r2
+inc *r6
+L46: .string "rhsmg"
+stop
+jsr *r3
+L47: not L189
+rts
+L48: .data -533, -883, 337
+; comment
+L49: jmp *r4
+lea L183, *r2
+inc L29
+L50: inc L11
+sub L45, *r3
+L51: .data -830, 511
+jmp *r0
+sub r7, r1
+L52: clr L84
+
+L53: sub *r7, *r2
+jmp *r6
+clr L152
+bne L1
+jsr *r6
+L54: jmp L210
+inc r6
+L55: jmp L223
+
+add L23, L4
+L56: jsr *r1
+L57: .string "fls"
+dec L57
+
+bne L8
+cmp L208, r6
+dec *r2
+not L208
+rts
+mov L199, *r1
+cmp *r2, *r5
+bne L204
+cmp #-97, L157
+L58: jsr *r6
+mov *r3, r3
+L59: lea L60, *r2
+prn r4
+L60: clr L182
+inc L230
+rts
+rts
+add r1, r0
+L61: jmp *r0
+jmp L33
+L62: sub r7, *r5
+inc L28
+L63: add r1, r0
+mov r3, *r0
+red r7
+L64: .data -307, -328, 780, -294, -383, 464, 753, -591
+mov *r6, r7
+L65: .string "phrhlcvlwbwehhvghwjgqp"
+L66: jsr L42
+; comment
+red L16
+; comment
+mov *r2, L66
+L67: prn L92
+prn #17
+L68: prn *r4
+sub *r6, L27
+lea L25, r6
+lea L75, *r1
+bne L86
+not L26
+lea L15, L39
+not r5
+jmp L250
+L69: .string "fieepbyzkacuwfakpthxckxy"
+rts
+dec r5
+prn r5
+jsr L108
+jsr *r0
+L70: dec r7
+L71: .data -459, 169, -327, -374, 189
+clr L130
+jmp L231
+; comment
+jmp L209
+dec L19
+clr *r1
+jsr L10
+red *r0
+; comment
+L72: .string "rj"
+bne *r0
+L73: not L70
+clr *r5
+stop
+red *r5
+jmp L8
+mov r7, *r5
+cmp #11, *r1
+add L102, L193
+
+; comment
+mov *r1, L168
+stop
+jsr L138
+clr *r1
+clr r7
+clr r7
+not L189
+L74: jsr L227
+jmp *r1
+; comment
+L75: clr r2
+L76: mov *r1, r6
+dec *r6
+clr *r0
+stop
+L77: mov r1, L27
+red L21
+L78: inc *r7
+L79: lea L180, L124
+lea L89, *r6
+L80: jsr L121
+not *r7
+L81: bne *r1
+lea L55, r6
+add r3, r6
+red *r7
+L82: prn L18
+; comment
+mov r4, r7
+dec r4
+red L89
+inc L202
+stop
+sub *r1, r3
+not r1
+dec *r1
+
+L83: .string "zmyqkoalzjfqkswkx"
+; comment
+L84: jmp L163
+L85: .data 223, -808
+L86: jmp *r5
+clr r4
+sub #49, *r3
+dec L146
+L87: .data -4, -585, 329, 578
+red r1
+not r2
+jsr *r6
+red L185
+prn *r1
+rts
+jmp *r6
+L88: add L183, r2
+sub r2, *r6
+bne *r0
+add r1, r3
+L89: lea L17, *r2
+cmp *r2, *r5
+bne *r4
+; comment
+
+sub r3, *r6
+jmp L66
+prn r7
+stop
+lea L54, *r4
+L90: jmp *r6
+lea L7, L34
+mov L71, r1
+L91: bne L49
+red *r7
+L92: dec *r7
+L93: prn #34
+rts
+L94: sub L20, r4
+L95: rts
+dec *r2
+L96: stop
+lea L233, L219
+stop
+inc *r0
+bne L165
+jmp L111
+stop
+not r4
+jmp L168
+dec r0
+add #-70, *r2
+bne L106
+lea L210, r6
+L97: .data 995, 169, -76, 409, -698, 457
+L98: .data -572, -265, 953, 887
+inc *r1
+L99: .data 75, -830, 780, 991, 542, -520
+bne *r5
+
+
+red r2
+jsr L122
+lea L12, r2
+mov L210, *r3
+L100: .string "wdqfwdpyaywwqai"
+not *r3
+prn L221
+L101: .string "fhdjjodivxsn"
+L102: mov #160, L50
+L103: .string "epwkxnuuvcjagrgg"
+stop
+L104: not L107
+clr *r2
+L105: jmp L54
+inc *r3
+rts
+dec L64
+inc L3
+bne L35
+L106: prn *r4
+prn L231
+cmp *r3, #-256
+L107: rts
+jsr *r5
+stop
+not *r3
+L108: lea L55, L50
+sub L78, L222
+sub #-200, r0
+sub L254, r0
+red L128
+red *r2
+stop
+stop
+mov *r0, *r0
+L109: jsr L118
+stop
+mov #-190, L6
+bne L10
+prn r2
+red r3
+not *r6
+mov #-2, r5
+prn L63
+
+L110: cmp L221, #-105
+lea L54, r2
+not r4
+dec r1
+lea L217, L167
+inc r0
+stop
+L111: .data 807, 340, 357, 127, -301
+
+bne *r0
+L112: lea L70, r6
+dec r3
+L113: .data -458, -995
+bne L160
+L114: dec r7
+not *r4
+L115: cmp r1, r6
+prn #-208
+lea L22, L203
+jsr *r0
+not *r4
+sub #249, r0
+clr L43
+L116: stop
+prn #83
+add r2, L70
+L117: rts
+not r7
+L118: .data -361, 171, 160
+L119: jsr *r3
+L120: clr L188
+jmp *r1
+add L89, r4
+lea L115, L200
+L121: add r2, L24
+L122: prn #190
+L123: sub *r0, L116
+L124: not r2
+L125: jsr *r4
+lea L27, L46
+
+L126: rts
+add L202, r5
+inc *r0
+mov #-127, *r4
+cmp *r1, *r5
+jsr L184
+prn #114
+red L9
+cmp L36, L255
+rts
+rts
+L127: clr L219
+lea L20, L199
+dec *r0
+rts
+
+prn #80
+jmp *r6
+prn *r5
+add r4, L215
+bne L164
+rts
+L128: jsr L193
+dec L179
+rts
+prn #-89
+lea L45, r3
+L129: stop
+mov r5, *r4
+jmp *r4
+bne L119
+L130: inc r4
+L131: cmp #-124, r6
+L132: .string "refnvtmzyhai"
+L133: rts
+not r0
+rts
+rts
+red *r0
+jsr *r5
+L134: not *r5
+mov L211, *r4
+L135: rts
+L136: .string "dkrlgadqrkfhijkqpog"
+prn r1
+lea L89, L57
+not r2
+rts
+mov r7, r7
+add #-194, L125
+cmp L226, L85
+L137: add r0, r5
+; comment
+L138: not r2
+jmp *r6
+lea L160, r5
+prn L92
+L139: cmp r0, *r4
+dec L171
+
+red *r7
+dec *r7
+L140: red L27
+L141: clr *r2
+sub L257, *r3
+lea L200, L15
+red *r0
+jmp *r2
+add r5, *r0
+rts
+L142: .data 186, 116, 847, -826, -462
+clr *r6
+jmp *r4
+jmp L192
+stop
+; comment
+bne L31
+jsr *r2
+jmp L61
+inc *r2
+jmp L98
+jsr *r6
+L143: dec r2
+L144: prn *r3
+rts
+L145: dec r5
+cmp *r6, r1
+mov L6, L205
+L146: stop
+red L168
+sub *r4, L164
+prn *r4
+clr *r1
+L147: .string "qkextxfoxucsmwho"
+cmp r0, L214
+L148: jsr L104
+L149: inc *r7
+L150: .data -836, 795, 834
+not *r3
+lea L113, *r5
+; comment
+L151: prn #217
+prn L25
+L152: .data -120, 570, 519, -84, 626, -958, -561
+prn r3
+lea L94, r6
+L153: lea L33, *r7
+jmp L90
+sub *r2, L124
+clr L112
+L154: sub r3, r7
+L155: rts
+jmp *r6
+add #-141, L161
+prn L125
+cmp #-135, L15
+L156: sub *r0, L227
+L157: inc L117
+cmp r5, #-99
+rts
+sub L109, *r4
+dec *r6
+inc r7
+L158: .data 250, 831, 845, 72, -892
+sub L192, L259
+rts
+bne L18
+cmp L258, #-244
+L159: inc *r0
+cmp #-17, #164
+add L201, *r0
+add #-131, r4
+L160: bne L9
+cmp #142, L174
+L161: .data 104, 1, 360, -494
+L162: lea L40, *r1
+stop
+cmp *r5, L230
+not L237
+stop
+rts
+inc r1
+dec r2
+rts
+L163: jmp L56
+L164: .string "wrfnshxbnnodkshbvancwhdw"
+lea L42, r7
+red r4
+jsr L94
+L165: .data 183, 149, -72, 743, 113, -35
+jmp *r5
+L166: cmp r0, r7
+L167: jmp L180
+
+lea L253, *r2
+sub *r0, r1
+red L178
+dec r0
+not r0
+mov r1, L256
+clr r2
+lea L59, *r2
+mov *r0, r5
+stop
+sub *r5, r5
+stop
+L168: rts
+; comment
+lea L182, *r2
+mov r7, *r0
+clr *r1
+rts
+L169: inc r6
+cmp r0, r7
+jmp *r7
+not r5
+L170: lea L151, L146
+dec r3
+clr *r5
+rts
+red r5
+L171: .string "jcoxiqmdbczjyvwpk"
+rts
+inc r4
+L172: .data -806, 145, 448, -948, -944, -681, 537
+inc L173
+add L174, r0
+clr *r0
+not *r3
+stop
+; comment
+cmp L32, r5
+sub *r6, r4
+prn r0
+inc r5
+L173: .data 952
+L174: .data -966, -712, 392, -312, 605, 81, -63
+mov r1, r5
+red r7
+
+cmp *r0, *r7
+L175: .data 109, -868, 790, -365, 755, 540
+dec L198
+mov L63, *r4
+L176: .string "tmatmnquq"
+not r6
+clr *r2
+sub L258, r0
+clr r7
+L177: not L182
+; comment
+L178: .data 716, -921, -98, -399, 172, -653, 304
+; comment
+jsr *r6
+jsr L168
+add #-4, L254
+mov r3, r5
+cmp L93, #-112
+L179: dec r7
+stop
+mov r1, r3
+L180: .string "dfyy"
+sub *r0, L70
+add L58, r1
+add *r0, r6
+L181: clr r3
+inc L154
+L182: .string "kwlqqxwmncursyibyapv"
+lea L75, L235
+cmp L190, L185
+bne L185
+red L238
+lea L197, r0
+jsr L178
+L183: clr L216
+L184: .data 505, 372, -87, 821, 812
+add *r0, L228
+not r2
+L185: .string "psrxfgkchigkwcs"
+stop
+sub L102, L200
+prn r2
+clr *r4
+add r1, r4
+add r6, L172
+
+L186: cmp L75, *r7
+jsr L155
+L187: .data -585, 962, -545, -968
+sub #-86, r0
+
+
+jsr L49
+rts
+sub #251, r2
+stop
+lea L225, r0
+mov #240, *r5
+clr *r2
+lea L39, *r2
+prn *r1
+prn #190
+add L258, *r5
+dec L7
+stop
+not *r6
+mov L256, *r4
+clr r7
+stop
+lea L261, L102
+clr L237
+L188: not L126
+rts
+not *r3
+L189: stop
+not *r1
+inc *r3
+bne L225
+L190: red r4
+jsr L250
+bne L243
+L191: mov r5, L4
+L192: rts
+L193: clr *r0
+mov *r1, *r2
+rts
+jsr *r7
+add *r4, r4
+L194: .data 959, 458, 316, 942
+L195: red *r0
+cmp r2, *r1
+red L247
+L196: .data -294, 750, -277, 895, 120, 142
+L197: .data 242, -632, 430
+L198: stop
+
+not *r6
+; comment
+prn *r2
+dec *r2
+sub #215, L210
+jmp L42
+jmp L258
+jmp *r0
+sub *r5, r7
+red L228
+L199: add *r7, L238
+rts
+dec *r0
+dec L73
+mov *r6, r5
+jsr L258
+not r1
+prn r4
+mov *r1, L151
+stop
+inc r2
+L200: .data 741, -597, -162, 615, -222, 702
+sub *r3, r0
+inc L178
+L201: .string "w"
+prn r1
+red r2
+dec L157
+rts
+inc L140
+mov r2, r5
+not r7
+L202: .string "mos"
+L203: inc L128
+not L234
+; comment
+inc L238
+clr L190
+L204: stop
+add #93, r5
+L205: prn L248
+lea L255, *r5
+L206: .data -560, -601, -226
+jmp L179
+bne L238
+not *r7
+sub r3, r4
+L207: .data -125, 294, -661, -571, 935, -838, -520, -591
+prn #-31
+; comment
+prn L246
+L208: .string "kmdmqzzfzh"
+jsr *r7
+cmp *r5, *r3
+not L54
+L209: .string "wquaej"
+stop
+L210: clr *r6
+bne *r6
+cmp L215, r4
+L211: .string "utaglnhsoieqlswnevizh"
+not L120
+lea L248, r3
+add r4, L213
+jmp L219
+mov #41, *r7
+; comment
+rts
+inc L101
+cmp *r7, r2
+clr r4
+L212: cmp r0, L109
+jsr *r0
+not *r2
+jsr *r6
+add r7, r6
+inc L11
+red L254
+inc r4
+L213: add *r6, *r1
+clr *r5
+L214: rts
+L215: prn *r3
+cmp L51, r6
+rts
+L216: .string "vnbkmddcqkqfzbvmenhxaj"
+dec L224
+mov L2, r5
+sub #-121, L155
+lea L130, r3
+dec *r1
+stop
+not L46
+L217: .string "fyhvalgldlfkwjyhsxuetjf"
+L218: sub L190, *r0
+jsr L232
+; comment
+; comment
+bne L224
+L219: not r0
+cmp #-200, L127
+L220: dec L0
+mov r0, *r3
+L221: .string "njhmsfyjuajmllxwwwthkr"
+cmp #192, L81
+L222: clr r4
+L223: lea L12, r1
+L224: add r4, *r0
+inc L2
+add #-120, *r2
+dec r3
+lea L230, *r4
+jmp L38
+
+
+L225: sub r5, *r6
+rts
+cmp L156, #71
+L226: .string "dwkexdlfudlccyeiiqpcj"
+L227: rts
+jmp L253
+inc *r4
+clr *r7
+jsr *r2
+L228: .string "mawdlbxwg"
+lea L257, r5
+L229: .data 598, -976, 328, -183, -824
+rts
+bne *r2
+cmp L215, #-37
+red r1
+clr L237
+not *r7
+L230: .string "caluddlghketfxiurxpetnm"
+clr r6
+cmp #169, L143
+inc r0
+inc *r0
+jsr L239
+L231: mov L249, r4
+L232: .data 739, 778, 922, -423
+dec L142
+stop
+inc r5
+add L255, r1
+inc r2
+L233: clr L186
+
+sub #61, L40
+inc *r0
+L234: .string "dnkcxavwapt"
+not r4
+L235: add L250, L19
+cmp *r1, r2
+clr L260
+bne L28
+jmp L241
+L236: .data 917, -391, -303, -934, 644, 323, 979, 967
+mov r6, *r7
+cmp *r5, r4
+L237: dec *r1
+L238: jsr *r0
+bne *r4
+rts
+
+L239: inc r2
+clr L49
+clr r6
+not L254
+
+prn *r6
+prn #38
+L240: .string "whjrzgeqzigh"
+mov L247, *r5
+L241: red *r2
+dec r0
+clr L254
+stop
+inc r4
+L242: cmp *r2, #184
+lea L65, *r3
+not *r5
+not *r2
+L243: inc *r7
+L244: .string "dcwczkvcj"
+clr r0
+add L70, r6
+mov #-21, r5
+clr L94
+L245: jmp *r0
+dec *r6
+; comment
+prn #184
+stop
+L246: not L249
+clr r1
+dec r7
+bne L81
+prn #167
+L247: .string "iypvgbyhf"
+bne L89
+L248: prn *r0
+
+sub #12, *r0
+L249: .string "ukrhankqsrru"
+lea L10, r6
+not r5
+L250: .data -661, -73, 635, -725, 2, 592
+inc L256
+jmp L188
+L251: jmp *r3
+prn #-187
+inc r4
+L252: clr *r0
+; comment
+jmp L175
+clr *r7
+clr r1
+bne *r7
+jmp *r7
+
+L253: red r5
+sub #240, L37
+rts
+L254: not r3
+not r5
+red *r6
+dec r2
+L255: lea L67, L212
+L256: .string "amybtlnithtwcdt"
+L257: .data -182, -321, -783, -500, -862, 649, -995
+mov L59, *r3
+bne L65
+lea L171, r2
+inc r4
+L258: lea L248, *r1
+L259: rts
+inc L261
+L260: bne *r6
+L261: stop
+bne L111
+stop
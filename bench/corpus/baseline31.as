@@ -0,0 +1,1020 @@
+; Generated by genCorpus --seed 32
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+L0: mov #101, r0
+L1: stop
+mov L245, *r1
+L2: not r0
+L3: sub *r3, *r7
+bne *r5
+L4: .string "sskfrypix"
+L5: .string "rgguclqzmjfsdidgdscj"
+L6: prn *r7
+; comment
+L7: stop
+bne L0
+dec r3
+rts
+jmp *r6
+add r2, L211
+jmp *r1
+L8: .data -315, -692, -783, -541, 880
+rts
+jsr *r0
+L9: .data -652
+jsr *r7
+L10: .data 280, 472
+L11: sub L170, r5
+cmp *r0, #243
+sub L5, *r2
+bne L43
+rts
+mov r4, r7
+bne *r0
+L12: .data 543, 928, 293, -448
+cmp #18, #101
+L13: .string "oxnnyfqkeqn"
+dec *r5
+inc L7
+sub L122, r6
+L14: clr r5
+inc r4
+jmp L190
+L15: .data 521, -463, 818
+rts
+add #162, r0
+rts
+prn L10
+mov *r7, *r7
+sub L105, *r3
+L16: clr *r2
+prn *r7
+L17: .data -386, -921, 470, -123
+add r5, L156
+bne *r2
+sub *r5, *r4
+L18: bne *r6
+L19: cmp #210, *r4
+clr L8
+bne *r1
+L20: sub *r7, *r0
+; comment
+lea L30, L18
+inc r1
+add #-68, L104
+L21: .data 624, 858, -258, 660, 239, -493, 368
+sub r1, L6
+add L9, r3
+L22: mov *r2, L11
+clr *r5
+
+mov #55, r2
+prn *r3
+L23: .string "hiitbfz"
+clr L262
+cmp #-26, #155
+sub L14, L164
+L24: .string "mflcntkbcymypfl"
+sub r3, r6
+jsr L17
+mov r2, r4
+L25: rts
+jsr *r1
+jmp L20
+L26: mov L170, L149
+
+mov #146, L2
+jsr L18
+L27: lea L24, *r7
+
+L28: jmp *r1
+L29: rts
+
+L30: mov #-235, L186
+L31: inc L206
+; comment
+inc r4
+red r6
+rts
+jmp L229
+bne *r2
+mov *r5, L99
+inc L262
+L32: .string "xzcuuzifrtueaihih"
+dec L140
+sub L237, L52
+jmp L61
+L33: not L193
+lea L19, L239
+stop
+L34: .string "vam"
+L35: not r4
+
+L36: .string "ojnyevef"
+L37: .string "basyjjwbeiuirfxrbhqg"
+lea L83, *r7
+red L229
+stop
+not *r7
+cmp r4, L14
+not L8
+L38: stop
+inc *r5
+stop
+dec r0
+L39: jsr L0
+clr r5
+L40: add #237, L7
+dec *r3
+inc r0
+cmp #-196, *r6
+stop
+rts
+L41: .string "hlmgemvcqdymyyntmssoreni"
+clr *r2
+add r7, *r5
+mov *r6, r0
+lea L90, r1
+red r0
+inc r7
+sub *r4, L18
+prn *r2
+clr *r2
+lea L109, L201
+bne L22
+stop
+L42: not L19
+add r6, r6
+L43: inc *r6
+jmp L24
+L44: not r5
+clr *r0
+add #125, L2
+bne L230
+not r5
+dec L153
+L45: red L1
+red L248
+rts
+bne L150
+L46: .data 484, 682, -672, 744
+L47: .data 839, 854, -384, -1, -96, -333
+L48: sub *r4, *r4
+L49: .data 721, -681, 479, -252, -791, -269, 649
+lea L40, L49
+lea L206, r5
+L50: bne L170
+add L10, r7
+lea L178, *r1
+red r3
+cmp r2, #127
+jmp L97
+red r1
+jmp *r6
+stop
+L51: .string "ykgsbplx"
+L52: .string "tpv"
+add *r5, r6
+jmp *r0
+L53: jsr *r0
+lea L170, L24
+sub L158, r3
+rts
+inc *r7
+
+L54: sub r0, L36
+not r6
+sub *r6, *r7
+L55: inc *r1
+; comment
+rts
+L56: .data 828, -101, 237, 959, -854, 507
+lea L49, r0
+L57: .string "zmebfglpkp"
+bne L250
+jmp *r6
+; comment
+L58: rts
+stop
+L59: add *r7, r4
+jmp L50
+
+clr L16
+red L212
+L60: lea L53, *r3
+not r1
+sub *r6, *r1
+L61: clr *r3
+jsr L10
+rts
+L62: .string "sc"
+
+L63: jmp *r5
+L64: sub r6, L150
+jmp L35
+add *r0, L52
+jmp L19
+stop
+not r1
+L65: rts
+prn L265
+add #-252, *r7
+jmp L151
+clr *r4
+sub r1, r0
+clr *r4
+sub #-189, L57
+L66: bne L64
+rts
+red r3
+L67: lea L241, *r2
+prn #148
+L68: .data 671, -940, 528, -172, -5, 247, -761
+lea L50, *r0
+bne *r3
+inc r0
+lea L167, *r0
+inc L29
+sub r7, *r2
+mov #-244, L60
+L69: .data -905, -885, 783, -557, -465
+prn r4
+inc *r7
+L70: .string "yghmqopoywuzqgctyxw"
+L71: stop
+add #-117, L35
+bne L265
+L72: bne L31
+inc *r6
+inc L150
+; comment
+sub r4, L63
+prn *r0
+L73: jsr *r5
+bne *r7
+jmp *r4
+L74: sub *r6, *r2
+red *r5
+inc *r2
+not r6
+stop
+stop
+red r7
+bne L222
+red r0
+stop
+L75: sub *r7, L163
+L76: .string "qmaockac"
+lea L35, r0
+L77: red L167
+red *r5
+jsr L153
+L78: stop
+L79: cmp r2, r5
+bne *r4
+clr L13
+not r7
+bne *r7
+L80: clr r0
+not r1
+L81: clr *r7
+L82: stop
+dec r1
+L83: rts
+prn #75
+; comment
+L84: inc r6
+jsr L52
+clr *r6
+inc r0
+inc r3
+jmp *r3
+stop
+cmp *r5, #251
+L85: .data -581, -158, -551
+mov r0, r5
+L86: lea L28, r5
+red *r2
+rts
+rts
+jmp L62
+; comment
+; comment
+L87: inc *r2
+L88: .data -883, 711, 291, 82, 944
+prn L34
+cmp L54, #-159
+lea L77, r6
+stop
+bne L266
+cmp r1, *r2
+stop
+red L186
+jmp *r5
+jmp *r7
+lea L161, *r5
+L89: rts
+L90: cmp r1, L57
+mov L164, r0
+mov r7, *r5
+inc r6
+L91: cmp r1, L234
+L92: lea L147, *r7
+lea L104, r2
+bne L72
+mov r5, r7
+bne *r5
+L93: not L57
+stop
+prn #165
+jsr *r0
+L94: mov L49, *r6
+stop
+bne L40
+mov #69, r1
+L95: inc r4
+dec L13
+jsr *r7
+clr r2
+prn L219
+bne *r3
+dec r0
+clr r5
+mov #246, L21
+add #-122, L202
+dec r5
+L96: .string "qat"
+dec r7
+sub r4, *r3
+red r7
+; comment
+mov r1, *r0
+not *r0
+dec *r1
+L97: cmp *r1, *r7
+mov L174, r0
+lea L202, L17
+red r4
+jmp *r0
+lea L75, *r4
+L98: rts
+
+rts
+lea L84, L110
+L99: not L162
+inc r7
+bne *r3
+clr r0
+sub r1, L32
+L100: jsr *r7
+dec L271
+clr L231
+inc r0
+dec *r2
+
+L101: rts
+; comment
+mov r1, L72
+lea L182, r2
+stop
+dec L264
+inc *r4
+red L34
+red *r7
+jmp L145
+sub #-160, *r6
+dec *r2
+jsr L167
+stop
+not L167
+L102: jsr *r3
+dec *r5
+not *r0
+L103: not r2
+add L219, L16
+L104: rts
+lea L71, L39
+clr *r3
+jmp L97
+jmp *r6
+L105: sub r4, L141
+L106: .data 73, -622, -448, -147, 879
+red *r0
+L107: .string "qxuicbrtsanwkveanh"
+not *r1
+L108: add L218, *r4
+L109: .data -923, -896, 618, 883
+L110: .string "buom"
+bne *r1
+L111: .data 935
+L112: .data 295, 707, -619, -222, -58, 870
+L113: .data -605, -844, -900, -675
+clr r1
+lea L124, *r1
+; comment
+L114: mov *r6, *r5
+jmp L46
+inc L35
+sub #-130, L206
+mov L208, *r0
+prn #-154
+sub #-60, *r2
+sub *r0, L30
+L115: .string "kj"
+mov L273, L135
+; comment
+L116: sub L208, L255
+L117: not r4
+jsr *r1
+
+L118: clr r6
+L119: dec L86
+L120: .data 704, -346, -957, -358, -631, 294, 203, 453
+L121: cmp *r5, #-4
+L122: lea L15, *r2
+clr *r7
+cmp #217, L25
+inc r1
+L123: .data 75
+jsr *r1
+clr *r4
+add L107, r5
+red *r7
+L124: mov r7, *r3
+stop
+clr *r3
+clr *r6
+prn #63
+L125: rts
+inc *r0
+sub r3, *r3
+L126: .data -34, 378, 876, -917, 182, -374, -73, -673
+sub *r6, *r1
+L127: sub L76, L117
+sub L224, r0
+add r6, r6
+inc L175
+prn #-139
+inc L142
+L128: .string "uwbjtfvdpjxdimnsyh"
+L129: prn *r4
+cmp *r3, L228
+red L125
+; comment
+red *r2
+mov r5, *r4
+L130: .data 65, 295, -348, 375, -317, -236
+inc *r5
+sub #196, L85
+lea L54, r7
+L131: .string "eiao"
+jmp *r6
+L132: stop
+not *r4
+mov L23, *r5
+L133: .data -919, -991, -431, 596, 869, 41
+L134: .string "bdtqqfhjatuohtjrd"
+cmp *r1, #-169
+add r2, r7
+jmp L219
+L135: lea L54, r2
+red L98
+L136: .data -593
+jsr *r4
+L137: .string "mkrpweggpzaucklj"
+sub #141, r4
+L138: cmp #224, L151
+clr r7
+not *r4
+jmp *r5
+; comment
+clr L258
+clr *r4
+sub L40, *r3
+red r7
+dec r1
+L139: rts
+jmp L77
+jmp L165
+rts
+not r0
+rts
+L140: bne *r4
+L141: clr *r3
+add r2, *r5
+add r0, L7
+rts
+mov *r5, *r0
+bne L69
+L142: .data 342, -144, -571
+mov *r6, r6
+dec L162
+stop
+red *r2
+mov L273, L32
+L143: lea L81, r6
+red *r7
+mov #-66, r3
+jmp *r4
+L144: dec L170
+add #134, *r6
+sub r2, r1
+inc *r4
+dec r0
+not L129
+L145: dec *r3
+
+inc L56
+add L224, r1
+L146: red L197
+L147: clr r7
+jmp L223
+; comment
+L148: .string "mbc"
+prn #-244
+add r3, r0
+not *r0
+prn *r2
+inc *r4
+; comment
+add #139, L129
+jmp *r1
+; comment
+prn #250
+add L45, *r4
+inc L137
+dec L225
+L149: jsr *r3
+stop
+prn r6
+prn #205
+jsr *r3
+prn r6
+L150: not L15
+jmp *r6
+jmp *r6
+clr r4
+stop
+L151: cmp *r4, #111
+L152: red L254
+L153: .string "qsoluoudgdvyreoowzp"
+L154: dec *r7
+inc *r4
+lea L255, *r2
+dec *r5
+L155: .string "yhpamyrkaa"
+dec r1
+L156: sub *r0, *r7
+sub #5, L108
+add *r3, *r1
+cmp *r6, *r2
+L157: mov L102, *r4
+
+jsr *r6
+; comment
+not *r1
+inc L80
+sub #169, *r3
+sub #-216, r0
+jmp L25
+dec *r7
+inc r5
+inc L121
+L158: red *r2
+cmp #-9, #54
+L159: jsr *r4
+clr *r4
+rts
+not *r0
+inc L213
+mov #59, L180
+sub L104, L27
+inc *r7
+prn L227
+prn L9
+add #185, *r7
+clr r1
+; comment
+not *r7
+
+mov r5, L22
+bne *r4
+L160: inc L223
+stop
+rts
+; comment
+L161: .data 264, -44, 959
+inc L243
+L162: cmp L197, *r5
+L163: inc r7
+rts
+rts
+rts
+dec L151
+
+red r3
+rts
+dec *r0
+bne L54
+dec r6
+bne L52
+add r2, *r4
+dec r1
+stop
+not r1
+L164: clr L268
+L165: .string "grkqmsgjszu"
+L166: .data -331, 660, -742, 494, 91
+L167: jmp *r0
+add L156, L79
+L168: add L135, r5
+L169: red r1
+L170: not r4
+L171: .string "gqforwhf"
+inc L238
+sub *r2, *r0
+inc r7
+L172: .string "ilpapv"
+prn r1
+L173: jsr *r3
+L174: stop
+L175: lea L191, L64
+L176: .string "hnpr"
+clr r6
+jsr L220
+
+mov *r5, L124
+rts
+jmp L273
+cmp *r3, r5
+jsr *r0
+dec *r3
+lea L218, r6
+mov *r3, r1
+clr r2
+inc r5
+; comment
+L177: red *r3
+L178: .data -793, 805
+stop
+L179: dec r7
+jsr L68
+cmp r6, *r0
+L180: dec r4
+L181: jsr *r6
+rts
+stop
+L182: dec L177
+inc L196
+mov *r4, r1
+L183: prn #180
+sub L49, *r5
+mov #140, *r6
+L184: inc r7
+L185: .data 878
+L186: inc r6
+jmp *r2
+jmp L274
+stop
+cmp #-75, #-70
+jmp *r2
+L187: not L132
+L188: rts
+L189: red r7
+bne L82
+not L47
+jsr *r5
+dec *r0
+L190: .string "ldqfyupllkw"
+L191: prn L218
+L192: .string "jhozpehconsaslgtx"
+jmp *r2
+mov *r2, r2
+L193: red L220
+sub *r2, r4
+L194: jmp *r1
+jsr L268
+add r5, *r2
+cmp L236, L65
+clr L91
+rts
+add r0, L232
+jsr L75
+L195: add r7, L227
+mov L210, L89
+not L237
+lea L222, *r3
+prn *r3
+inc *r4
+L196: prn L7
+add r1, r5
+L197: .string "zpfi"
+
+dec *r5
+prn *r6
+clr L243
+dec r7
+inc L177
+lea L220, r2
+stop
+bne L205
+mov *r5, L240
+jmp L186
+L198: .string "cqxybjtpvqjtdyocyzawa"
+not r6
+L199: prn r4
+L200: .string "evt"
+L201: add #236, L223
+rts
+red r2
+stop
+L202: clr L210
+mov r2, L219
+sub #-47, r7
+L203: .string "ytzvcwqlljljplr"
+; comment
+clr L239
+cmp r0, *r6
+L204: red L195
+prn L164
+red *r5
+sub r1, r7
+rts
+jmp *r3
+L205: .data -970, 169, 804
+L206: add r1, L202
+stop
+L207: .string "ewduv"
+bne L183
+; comment
+jsr *r0
+L208: add #130, L243
+L209: stop
+L210: inc r7
+mov #-76, r2
+L211: jmp L228
+L212: red *r1
+red r3
+L213: .string "ibpt"
+inc L32
+inc *r6
+L214: clr *r0
+sub r4, *r3
+L215: prn r7
+red L237
+prn r7
+L216: .string "dyserijkdb"
+jsr L164
+red *r3
+; comment
+
+stop
+jsr *r7
+L217: jmp *r2
+rts
+L218: bne *r0
+L219: prn r3
+prn r3
+add #4, *r3
+
+L220: dec L259
+lea L96, L19
+L221: prn L240
+rts
+stop
+L222: .data -880, 53, 737
+inc r4
+rts
+L223: lea L219, *r1
+
+L224: add *r2, L140
+prn r1
+inc L242
+L225: dec L255
+cmp *r1, #68
+jsr *r3
+not *r1
+mov #88, L83
+red L36
+cmp *r2, r2
+dec *r2
+inc r2
+L226: prn #-97
+stop
+lea L172, *r5
+jmp L245
+sub #34, L106
+L227: jsr L170
+clr *r5
+cmp *r0, #-11
+; comment
+L228: .string "goybdrvcbkcbneavi"
+not *r4
+
+bne L81
+sub r5, *r1
+jsr L232
+L229: .data 577, 5, -793, -870, -964, 414, 983
+prn L257
+L230: not *r1
+
+L231: .data -931, -319, 980, 461
+rts
+L232: .string "liwhgskhoibqzx"
+jsr *r2
+bne L212
+L233: red *r4
+bne *r7
+inc L232
+add L123, *r0
+inc *r0
+L234: dec *r3
+not *r3
+
+add *r2, r1
+cmp r0, *r3
+red r0
+cmp #66, r1
+sub *r3, *r1
+sub L3, *r1
+dec L269
+L235: not r1
+L236: dec *r4
+red r2
+add *r7, r4
+red r0
+mov L237, r1
+add #114, *r6
+prn *r5
+red r5
+L237: prn r1
+mov L18, r7
+mov #176, r0
+bne *r6
+prn L238
+L238: mov r3, r7
+jmp L241
+L239: .string "x"
+rts
+cmp L249, *r3
+lea L276, *r4
+dec L69
+L240: .data 663, 764, 89, 473, -869
+rts
+add L251, *r7
+jsr L180
+L241: dec L252
+not L17
+L242: .data 261, 318, -557
+mov r5, *r3
+cmp r4, r4
+L243: .string "nezrogltojsvkav"
+lea L65, r2
+L244: .data -938, -123, -185, 822, -280, 520
+inc r2
+mov #-180, *r7
+stop
+bne *r4
+lea L262, L28
+L245: lea L267, *r4
+L246: add L257, L257
+add r2, *r2
+sub *r3, L182
+lea L222, L260
+cmp *r1, *r6
+L247: sub r1, *r3
+bne L48
+jsr L251
+L248: jmp *r5
+jmp *r6
+jmp L256
+L249: .data -444, 800
+red L261
+L250: sub L179, *r7
+not *r7
+sub #-100, L253
+stop
+rts
+lea L10, *r5
+red L259
+bne L118
+jmp L25
+clr L254
+
+sub r0, L265
+jmp *r1
+add L263, *r2
+L251: cmp r2, #7
+clr r6
+; comment
+prn r3
+bne *r5
+L252: bne L264
+bne L269
+L253: jsr L274
+mov #-10, r1
+L254: .data -379, -595, -1000, -939
+L255: rts
+bne L271
+red r3
+bne L259
+not *r4
+stop
+rts
+dec r5
+dec *r5
+L256: red r4
+L257: .data -344, 892, -320, 30, -395, 518
+stop
+jsr L272
+add r3, *r7
+red L267
+; comment
+stop
+bne L184
+L258: .string "jfqvozitpfnc"
+stop
+L259: .data 87, -823
+L260: not L69
+red *r3
+stop
+; comment
+not L263
+L261: not r5
+jsr L136
+bne *r7
+sub *r3, *r5
+rts
+cmp r3, L271
+inc r5
+L262: .string "pbcysdn"
+stop
+not *r5
+L263: prn r3
+L264: .data 643, 141, 485
+L265: lea L272, r3
+bne *r4
+rts
+rts
+prn r3
+inc L266
+clr r7
+L266: mov #-224, L269
+; comment
+stop
+lea L274, *r2
+stop
+prn *r6
+jmp L61
+prn L211
+inc *r5
+inc *r1
+sub *r4, L165
+red *r2
+dec *r6
+L267: stop
+; comment
+L268: inc *r7
+L269: stop
+lea L271, *r5
+red r5
+jmp L271
+cmp L271, r2
+sub *r2, L85
+lea L200, *r6
+
+dec L89
+clr L224
+L270: inc *r2
+jmp *r0
+rts
+L271: jmp *r2
+
+inc r6
+L272: .string "mva"
+
+sub L135, L273
+dec L273
+add L121, *r6
+cmp #-12, r1
+L273: jmp *r3
+L274: prn r7
+L275: stop
+L276: sub *r1, *r0
+stop
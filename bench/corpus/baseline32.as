@@ -0,0 +1,1019 @@
+; Generated by genCorpus --seed 33
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+prn L1
+rts
+jmp *r3
+prn L189
+lea L173, L256
+L0: .string "iltwinaqx"
+mov *r2, r1
+bne L0
+red r7
+cmp r6, r6
+cmp r5, L247
+L1: mov #230, L246
+clr L51
+prn L142
+dec r5
+clr *r6
+inc L14
+prn #-133
+dec L1
+inc *r2
+; comment
+prn #-154
+jsr L118
+cmp #99, *r4
+L2: mov #240, r1
+cmp r1, r4
+prn L184
+mov #161, L260
+dec *r1
+prn L1
+red *r6
+add #-248, r1
+bne *r3
+L3: mov *r1, *r1
+L4: stop
+sub *r6, *r6
+jsr *r7
+jsr *r3
+; comment
+mov r5, r3
+not *r6
+L5: .data 128, 941, 181, 103, -595, -323
+rts
+sub L0, r4
+sub L5, *r1
+
+L6: bne *r4
+inc L65
+bne *r3
+jsr *r2
+L7: stop
+rts
+
+L8: lea L4, L18
+jmp *r5
+stop
+L9: stop
+dec L9
+prn #30
+lea L17, r3
+L10: prn *r1
+lea L165, *r7
+dec *r0
+stop
+L11: not *r5
+jmp L8
+; comment
+; comment
+rts
+sub L181, L74
+dec *r2
+red *r6
+L12: .string "nofu"
+dec L6
+add r0, r6
+jmp L69
+sub L41, L159
+add *r0, r6
+L13: .string "pxlcczpqtyahjiqzhutm"
+L14: .string "u"
+add L218, L133
+
+rts
+clr L231
+sub *r7, L14
+L15: jmp *r4
+L16: jsr *r3
+mov L266, r7
+jmp L148
+L17: not L66
+dec L257
+inc L6
+sub r0, r3
+stop
+prn *r2
+dec *r5
+L18: bne L70
+L19: rts
+add L255, L13
+L20: .string "psgdoptqeixyndmwafcu"
+not *r4
+bne L28
+L21: prn r3
+lea L147, L13
+clr r6
+jmp *r6
+not L6
+L22: .data -923
+jmp *r7
+mov r0, L11
+clr r1
+
+stop
+add r2, L3
+L23: jmp L30
+prn L15
+lea L9, *r5
+stop
+red r6
+jsr *r6
+not *r5
+L24: .string "vtibyzhxxd"
+jsr L203
+prn *r3
+L25: .data -707, 66, -986
+add L149, L121
+dec r1
+lea L20, L22
+L26: .string "svziqaveefrwrzmzfyopx"
+jsr L10
+prn #-182
+prn #30
+rts
+prn r5
+rts
+L27: .string "hnkwjpjwvixgzdicnis"
+lea L11, *r1
+not *r5
+inc r6
+stop
+mov *r3, L208
+not L26
+sub #37, r2
+inc r5
+add #-122, r4
+prn #-154
+dec L34
+jsr L2
+; comment
+inc *r6
+red r7
+L28: sub *r2, *r4
+inc L13
+jmp L17
+add *r7, r7
+L29: .string "txkjzqybcyvigr"
+L30: .string "p"
+L31: dec r1
+red L154
+stop
+; comment
+jmp L9
+mov r0, *r2
+bne L66
+L32: .data 960, -879, -139, 413, 557, -161, -46, -509
+mov L181, L29
+red L20
+lea L119, r5
+L33: dec *r6
+mov #180, r3
+not *r7
+inc *r3
+red r4
+L34: .data -231
+L35: lea L10, r3
+L36: add r7, L17
+L37: rts
+
+mov #-226, *r5
+L38: .string "zxzusnuvnnrjho"
+not *r1
+L39: rts
+
+L40: rts
+L41: stop
+L42: lea L131, L49
+stop
+L43: rts
+L44: lea L98, L36
+clr r0
+L45: stop
+mov #173, r0
+L46: stop
+L47: rts
+red r2
+L48: .string "ktzvuwevcj"
+not r3
+L49: .data -966, -842, -636, 742, -334
+L50: not L84
+lea L34, L62
+bne L176
+L51: sub r1, r6
+L52: inc L264
+jmp *r7
+lea L2, *r0
+inc r4
+L53: jmp L247
+rts
+prn #-107
+dec L40
+
+L54: .string "d"
+add r2, r0
+jmp *r3
+lea L18, L227
+jmp L224
+red r2
+red r1
+dec *r0
+jsr L10
+L55: .string "svfrwwg"
+mov r5, L257
+bne L42
+L56: rts
+L57: dec *r5
+jmp L40
+; comment
+mov #-75, L54
+add *r4, *r4
+dec L29
+prn L115
+lea L113, L55
+jsr *r4
+lea L68, *r6
+prn #-108
+add L238, L33
+add #-56, L190
+stop
+rts
+sub *r7, *r3
+jsr *r4
+bne *r1
+red r5
+jmp L27
+mov #71, *r6
+clr L26
+L58: .data 170, -483
+bne *r2
+L59: .data 12, 372, -769, 195, 481, -670, -897
+sub r1, *r0
+L60: .data 243, -178, -11, -930, 337, -523
+jsr L247
+L61: dec r6
+cmp r7, r3
+bne L154
+L62: .string "jjenkcran"
+L63: bne *r1
+clr r4
+rts
+rts
+inc L169
+mov L116, *r0
+mov L25, L109
+bne *r3
+rts
+not r3
+L64: .data 221
+L65: .data 225, 123, 458, 374, -600, 391
+not r7
+L66: not *r4
+jsr *r7
+add *r7, r6
+stop
+mov #28, r0
+lea L196, L110
+; comment
+cmp r2, *r0
+jsr L237
+add r3, L71
+dec L25
+L67: .data 37, 746, -206, 897, 483, 94, 733
+mov L33, *r7
+L68: .string "gogmrondbwizgc"
+rts
+dec r5
+add #133, L9
+bne *r4
+L69: bne *r6
+bne L255
+prn *r0
+dec L35
+L70: rts
+lea L26, *r0
+add r4, *r5
+clr L111
+L71: clr r7
+clr *r0
+not *r1
+clr r3
+bne L73
+mov #-37, L29
+lea L16, *r3
+clr *r1
+sub r7, r2
+mov L76, L256
+mov r1, L234
+dec r5
+L72: dec L55
+bne L54
+L73: not r7
+L74: cmp L49, #-240
+dec *r0
+L75: not r0
+sub #245, r6
+mov r0, L113
+L76: .string "vrpvzrxsxxwfcpenofgrzys"
+inc r3
+L77: .data -433, -400, 43, -744, 345, -514
+L78: clr r2
+rts
+
+not *r0
+add #58, r1
+jsr *r7
+sub L41, L225
+cmp *r3, r5
+sub L17, r7
+clr *r4
+L79: red L33
+inc L181
+mov r4, L227
+inc L217
+rts
+jmp *r6
+dec L177
+L80: mov #-108, r5
+clr L161
+jsr *r4
+stop
+L81: rts
+not r2
+
+L82: cmp #-111, #-39
+stop
+lea L155, L89
+jsr *r5
+add *r1, *r0
+stop
+add L184, L12
+L83: sub r5, r0
+mov #-90, L119
+; comment
+jmp *r1
+cmp *r3, r1
+L84: not *r0
+L85: jmp *r3
+red r7
+L86: jsr *r6
+jsr L46
+dec *r5
+dec r0
+L87: clr L74
+L88: clr *r3
+add *r2, *r3
+L89: .string "npxecmrpuuvqoj"
+jsr L26
+bne L18
+L90: .data 101, 228, 169, 639, -999
+L91: mov *r1, r3
+clr r3
+lea L66, r4
+rts
+rts
+dec r6
+clr L28
+L92: sub #-82, r6
+L93: .data 206, 820, -853, 168, 756, -177
+not *r3
+clr L42
+L94: .data 489, 204, -841, -46, -134, 307, -669, 914
+not *r0
+L95: .data 464
+L96: bne *r5
+lea L96, r7
+not r1
+L97: mov r3, L92
+not r5
+lea L86, L26
+not r3
+not *r3
+red L78
+mov r7, r2
+L98: .string "nwvgqumwiood"
+cmp *r5, r7
+mov *r2, r4
+bne L265
+L99: add L97, L232
+jmp L233
+mov r6, *r3
+bne L92
+L100: clr L173
+lea L85, L8
+add r2, *r2
+jmp L215
+lea L226, L31
+L101: not L80
+prn L251
+L102: .data -128, 576
+; comment
+not r3
+clr *r2
+L103: jsr L203
+L104: .string "znmpeffeopd"
+not *r2
+prn L155
+stop
+red r2
+L105: dec L178
+lea L148, *r1
+L106: .string "nyzeowoiubmpaztd"
+L107: prn r3
+jsr L62
+bne *r0
+sub #-191, L188
+L108: prn #47
+L109: stop
+jmp *r4
+red L72
+L110: cmp #-197, *r3
+L111: inc *r0
+bne L144
+inc *r4
+mov r5, L131
+L112: rts
+inc *r1
+L113: cmp L123, r1
+dec *r7
+stop
+cmp *r0, #-191
+; comment
+L114: not r6
+jsr *r1
+L115: .string "jmatatpjeiskttmphdrb"
+L116: jsr *r5
+L117: mov r1, r5
+prn *r5
+not L260
+mov r3, r1
+red L19
+L118: .string "lbyn"
+L119: jsr *r6
+L120: .data -478
+dec *r2
+inc r2
+not r7
+inc r7
+stop
+bne L131
+L121: red r6
+rts
+clr r5
+clr L0
+clr *r6
+L122: clr *r2
+L123: .string "zheyglagoru"
+mov #-74, L145
+clr r5
+jmp *r4
+jmp L176
+rts
+sub L246, *r2
+L124: not r4
+add r5, *r0
+red L74
+red *r2
+mov *r4, *r1
+sub *r5, r3
+jmp *r6
+jsr *r6
+dec L24
+lea L246, *r0
+L125: rts
+rts
+L126: .string "px"
+bne *r7
+mov *r0, L70
+L127: .string "nevpfjlvbojicejfpghog"
+mov L225, r1
+jsr *r3
+inc *r5
+; comment
+L128: jmp *r3
+L129: sub r6, L215
+; comment
+L130: jsr *r4
+L131: prn r1
+; comment
+L132: sub *r4, r0
+rts
+lea L43, L45
+L133: inc r7
+red L103
+bne *r0
+; comment
+L134: rts
+L135: not L36
+L136: red L164
+jmp *r5
+jmp *r1
+rts
+jsr *r5
+add *r2, r3
+rts
+clr r1
+red r4
+mov L256, L103
+not r0
+L137: .data 63, 759, -108
+stop
+L138: rts
+mov #14, r3
+cmp L212, *r5
+L139: jsr L257
+L140: .data 452, -19, -137, -153
+L141: clr r0
+dec L135
+L142: .string "q"
+
+L143: .data 243, -325, 44
+cmp r5, #237
+L144: jmp L222
+L145: .string "xuhrtt"
+L146: cmp *r3, L122
+sub #76, L170
+bne L171
+
+add #-42, *r0
+L147: jsr L225
+L148: prn r5
+mov L64, r7
+clr r1
+clr *r3
+L149: cmp L238, r4
+jmp L208
+clr *r2
+L150: red r1
+bne *r3
+L151: rts
+L152: jsr *r3
+jmp L188
+add L14, r2
+L153: inc *r2
+inc *r5
+add *r1, *r3
+rts
+not r3
+not L143
+stop
+jmp *r5
+jsr L75
+add *r7, r4
+mov r0, *r2
+not r5
+rts
+L154: rts
+bne L30
+clr *r1
+L155: bne L79
+bne L134
+sub #235, *r0
+L156: .string "ihmyndt"
+L157: .data 58
+mov *r4, *r2
+L158: .string "itylboptybvrrcvcnyjitj"
+sub r1, r3
+jmp *r5
+L159: inc L260
+not *r1
+stop
+bne L151
+add L35, r4
+L160: red r6
+prn L202
+not r7
+inc *r6
+L161: .string "xurxtpbpqfq"
+clr L224
+sub L139, *r3
+L162: prn *r5
+mov r7, L207
+jmp *r4
+clr r1
+red L54
+cmp *r2, #21
+cmp #216, *r4
+L163: stop
+prn *r3
+rts
+stop
+inc r1
+rts
+L164: rts
+jmp L178
+rts
+L165: rts
+L166: add r2, r2
+cmp L139, r5
+rts
+L167: mov #143, *r7
+dec r3
+L168: .data -508
+mov r0, *r4
+clr r3
+L169: cmp L86, #114
+lea L215, *r6
+inc L146
+jmp *r0
+jsr *r4
+lea L26, r2
+jmp *r0
+L170: jmp L191
+mov L244, r7
+rts
+mov #93, r1
+dec L201
+L171: sub #88, *r7
+cmp r4, #34
+L172: jsr *r7
+rts
+cmp #93, r4
+clr L248
+
+L173: add *r7, L251
+inc L226
+jsr L20
+L174: jmp *r1
+L175: sub r6, *r1
+bne L243
+clr r1
+; comment
+sub r5, L182
+rts
+jmp *r4
+L176: .data -105
+bne *r5
+clr L91
+inc r5
+add r6, L67
+; comment
+lea L25, r0
+stop
+L177: clr L187
+stop
+L178: jmp *r7
+mov #-135, *r5
+; comment
+lea L222, L35
+L179: .data -355, 587, 691, 665, 329, 880
+L180: mov #8, *r2
+add r7, r0
+bne L248
+dec r1
+sub r6, *r6
+lea L70, L209
+L181: red L238
+rts
+L182: .string "sopdimzshialqqfcqglotqd"
+mov #-217, L61
+jmp *r2
+
+jmp *r0
+inc *r3
+red L203
+prn *r1
+prn L215
+bne L32
+clr r1
+bne L245
+add #-55, r7
+L183: .data -101, 982, -789, 130, -877, -918, 376, -51
+clr L53
+L184: prn L203
+L185: jsr *r7
+L186: clr r5
+lea L147, L237
+cmp L215, r3
+dec L61
+L187: jmp L173
+sub #214, *r6
+stop
+sub r4, r2
+mov *r3, L105
+mov r6, r0
+prn L192
+sub #86, r5
+L188: not L197
+add *r5, L226
+rts
+L189: stop
+lea L32, r2
+L190: not r0
+L191: not *r7
+stop
+L192: .string "sdvrazgbffjvbw"
+bne *r7
+add #-174, r6
+L193: not L241
+mov #-153, L257
+sub #-48, *r4
+lea L78, r5
+clr *r0
+jsr L49
+inc *r2
+L194: jmp *r2
+cmp #-235, #139
+bne *r3
+L195: .data -621
+cmp #72, r0
+cmp L146, r6
+L196: .string "viuhiungffnvtcrzfwjf"
+dec L79
+clr r2
+prn *r6
+rts
+not *r6
+L197: not L83
+dec L79
+stop
+L198: .data 905, -188, -169, -604
+L199: sub #7, L235
+dec *r4
+prn #250
+L200: sub *r7, r7
+dec *r0
+add r7, *r3
+lea L24, L136
+sub r6, *r2
+mov *r2, L116
+not *r4
+L201: .string "ecgxqlgujziyifpzuufz"
+add r7, r1
+not *r6
+clr r2
+red *r5
+jsr *r3
+L202: .data -261, 869, -102, 348, 100, 742, -317
+L203: inc L165
+rts
+red *r7
+add *r4, *r7
+clr L202
+L204: bne *r7
+cmp L257, *r3
+jsr *r6
+cmp L133, *r0
+rts
+L205: add #-153, *r7
+L206: lea L239, *r4
+not r2
+bne L140
+dec L228
+mov r2, L232
+L207: jmp L203
+add r5, *r0
+L208: inc r1
+cmp #-154, *r5
+L209: inc *r4
+L210: inc r5
+red r6
+L211: jmp *r1
+cmp *r2, L229
+mov #-37, L13
+rts
+not L257
+dec r0
+L212: .string "hdqwtjmxaoaljmcwamhmcdf"
+prn L65
+jmp *r7
+bne L254
+clr *r3
+L213: not *r6
+bne *r6
+rts
+cmp #180, *r1
+rts
+stop
+dec L12
+dec *r6
+dec L201
+dec L56
+L214: cmp r5, *r2
+stop
+bne L251
+prn *r2
+inc L245
+add #169, L216
+inc r7
+sub *r0, L15
+sub L239, L216
+jmp *r5
+rts
+jsr *r7
+inc *r5
+stop
+jmp L238
+inc L240
+inc L242
+jmp L62
+jsr *r2
+dec r6
+L215: .string "mrdiwh"
+cmp r3, L162
+
+add #170, r3
+L216: jmp *r7
+
+cmp r5, r3
+cmp r5, *r4
+L217: cmp L127, *r4
+stop
+cmp L242, r4
+jsr L218
+L218: .data -202, -214, 114, -825, -802
+L219: bne L88
+L220: add *r4, *r2
+prn L3
+red *r4
+rts
+L221: .data 334, -522, 138, -779
+stop
+stop
+clr r7
+L222: .data 616, -511
+add #-10, L136
+clr L251
+L223: stop
+L224: not L142
+
+jmp L204
+L225: sub L233, r4
+dec r1
+mov #59, L264
+not *r0
+inc r7
+L226: sub *r2, *r4
+jmp *r1
+red *r0
+mov #160, L111
+; comment
+inc *r4
+L227: stop
+mov r6, r3
+sub r3, *r4
+sub #-18, r4
+L228: .string "i"
+L229: .data -173, -919, 910, -996, -2, -379, 733
+rts
+stop
+jsr L120
+prn *r0
+jmp L24
+; comment
+add *r7, L181
+prn *r6
+L230: .string "hkzfkiijxjkq"
+not r1
+jsr *r0
+mov L232, *r4
+mov r5, *r0
+prn r7
+bne *r3
+cmp r6, *r7
+bne L259
+jsr *r7
+jsr L256
+rts
+add *r2, L249
+L231: rts
+L232: .string "ddwvoifvbtn"
+add #-60, L76
+rts
+L233: rts
+prn *r1
+bne *r4
+inc *r0
+dec r1
+jsr *r1
+cmp *r4, r6
+add L261, r7
+sub *r7, r0
+red L262
+rts
+sub L240, *r5
+L234: add *r3, r0
+L235: jsr *r5
+dec L187
+L236: rts
+L237: .data -203, -939, -315, -246
+inc r4
+L238: .string "nbtjcfrcjia"
+sub r6, L244
+jsr L249
+red r3
+inc r1
+inc *r3
+inc r1
+sub *r6, L93
+L239: dec L264
+; comment
+jsr *r0
+clr *r4
+inc r5
+stop
+L240: red L160
+cmp r2, #-221
+cmp *r2, *r7
+jmp *r0
+cmp *r7, r4
+cmp r6, *r3
+L241: .string "skefpved"
+L242: cmp #198, L223
+L243: cmp r5, r3
+L244: jsr *r4
+
+rts
+cmp L89, *r3
+L245: not *r0
+clr L266
+
+clr *r4
+L246: prn r5
+stop
+not r6
+prn L69
+dec L68
+clr r1
+L247: .data -875, 50, -669, 815, 63, -809, 47
+L248: not r4
+cmp r0, #-10
+L249: .string "ltccezc"
+jsr *r1
+jsr *r0
+rts
+L250: .string "pkluyrcsxostpkb"
+clr *r0
+dec *r0
+lea L109, L255
+L251: .string "aofntyflyiycxeypbmofzssx"
+L252: bne L17
+lea L95, L205
+L253: add r6, *r7
+rts
+L254: inc *r4
+stop
+L255: clr *r0
+add *r7, L257
+inc *r3
+dec *r5
+prn *r6
+not L256
+rts
+prn L254
+jsr *r1
+not r0
+mov *r3, r6
+rts
+L256: dec r7
+prn #216
+stop
+clr r2
+not r6
+jmp *r2
+red L262
+L257: clr *r3
+L258: dec L267
+lea L47, r1
+add L261, L263
+sub r3, r0
+rts
+add r6, r0
+L259: lea L13, r0
+inc L150
+L260: dec *r2
+prn r4
+lea L266, L264
+L261: dec *r0
+not L265
+L262: red *r6
+L263: sub L198, r0
+L264: .string "bbfsshhc"
+L265: stop
+rts
+rts
+inc L266
+rts
+jsr L266
+L266: .data 436, -66, -780, -926, 487, 253, -573
+mov L188, r0
+jmp L267
+L267: rts
+stop
@@ -0,0 +1,1019 @@
+; Generated by genCorpus --seed 34
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+sub *r0, L111
+
+L0: inc r6
+add #212, *r5
+clr *r6
+add r0, r2
+L1: .string "yvukptojsgncch"
+not r6
+add #149, *r7
+jsr L114
+L2: .string "rx"
+; comment
+jsr L1
+L3: .string "aoqvst"
+L4: .data 836, 684
+jsr *r1
+L5: .string "grrhkbb"
+bne L4
+jmp L1
+rts
+sub r2, *r5
+sub r2, *r3
+rts
+jmp *r1
+not *r1
+L6: .data -614, -26, 319, 235, -706
+L7: .string "idaprxegoirqfyrnqecvgpf"
+L8: red L171
+sub L215, *r6
+lea L185, *r6
+inc L154
+rts
+red *r7
+L9: sub #-246, L91
+mov L9, L169
+not r2
+L10: mov r0, L59
+lea L106, *r2
+jsr L7
+; comment
+jsr L8
+L11: jmp L93
+inc *r0
+rts
+L12: jsr L82
+L13: .string "emargmhypswoytb"
+stop
+bne *r3
+L14: mov L13, *r5
+L15: .data 959, -358, -94
+inc *r1
+add #-60, r4
+cmp r7, r4
+stop
+L16: clr L227
+sub #-5, *r7
+prn r6
+jsr L13
+L17: jmp L166
+L18: .string "kudmqjcrxvaduayuf"
+L19: add L41, L110
+not L256
+sub L4, L257
+dec r5
+L20: inc L3
+red r5
+L21: clr *r6
+L22: lea L115, L9
+clr L25
+jmp L11
+dec L15
+L23: not L111
+lea L0, r5
+mov *r3, r0
+stop
+prn *r5
+dec *r7
+mov *r2, *r1
+
+inc r6
+prn r4
+red *r1
+L24: .string "pgdcsjepuikfxqez"
+not r3
+clr r2
+cmp r0, #-42
+L25: stop
+add L5, L134
+jmp L155
+red r5
+rts
+clr L12
+not *r3
+L26: .string "sxrupkho"
+rts
+L27: .data -707, 934, -53, 818, -714, -277, 587, -788
+inc r2
+sub r7, r6
+cmp L21, *r0
+prn *r1
+inc *r3
+not *r0
+bne L110
+clr r7
+L28: .string "umjlkowycvlbykluwmgesbbm"
+L29: .data -938, -622, 603, -164, 103
+L30: .data 103, 186, -332, -935, -909, 15, 873, -917
+jsr *r6
+not L1
+sub #16, L182
+L31: .data -943, 62, -197
+L32: .string "lbg"
+dec *r2
+inc *r3
+bne L18
+cmp *r3, L168
+rts
+dec *r6
+not L32
+cmp L10, *r0
+L33: jmp L5
+clr *r0
+not L8
+jsr L191
+rts
+rts
+L34: rts
+red *r5
+stop
+L35: inc L26
+red *r1
+lea L24, r6
+L36: cmp r1, #-100
+dec r2
+cmp *r5, *r7
+L37: jsr L27
+red L240
+jmp *r2
+clr *r6
+jmp L57
+cmp r0, L238
+inc L236
+sub L20, *r0
+add r1, r6
+stop
+cmp L29, L12
+jmp L75
+add r3, r2
+; comment
+red r4
+not r5
+L38: .data -570, -327, -268, -911, 229
+red r1
+L39: .string "mzwkrgtbmcixazlheak"
+
+red r1
+
+L40: rts
+clr r2
+rts
+stop
+L41: .data -685, -546, 446, 585, 663, -588, -350, -46
+L42: .data 712, -262, 594
+jmp L175
+clr L147
+cmp #203, #-238
+bne *r7
+jsr *r3
+L43: sub r2, r0
+L44: stop
+L45: .data -766
+L46: sub *r7, L87
+prn #-156
+prn L9
+stop
+inc r5
+L47: .string "mgcjl"
+L48: .string "yibeqef"
+L49: .data -970, -671, 110, -268, 485, 702
+bne L118
+L50: .string "taciseuhxwdl"
+add #223, L33
+cmp *r6, r2
+bne *r0
+L51: .data -843, 532, -990
+L52: red *r4
+L53: mov #154, *r0
+rts
+not L41
+L54: .string "idoogmoebo"
+bne *r1
+jsr *r0
+dec *r7
+L55: .data 518, 349, -629, -6, -372, -991, -245
+not r2
+L56: dec L28
+cmp *r3, *r2
+jsr L104
+L57: lea L266, r7
+not r7
+not *r3
+L58: lea L55, *r3
+L59: .data -243, 862, -676, 630
+sub #115, r4
+stop
+rts
+L60: jmp *r7
+rts
+inc *r0
+dec *r1
+L61: add *r5, L54
+jmp L32
+dec r2
+L62: rts
+mov #-218, *r7
+jmp *r7
+jmp *r5
+clr r2
+jmp L47
+stop
+red *r6
+sub #62, L61
+lea L127, *r7
+L63: .string "qkvufunyfu"
+mov #-224, *r4
+L64: add #33, L226
+inc L58
+stop
+red r3
+add L121, r4
+dec L228
+not *r5
+lea L61, r1
+L65: .string "ajymcamftkokcclgwjdr"
+red r5
+
+add r5, L48
+bne *r4
+clr *r2
+add r0, *r5
+red L124
+L66: .string "zcwr"
+mov L167, *r7
+prn *r7
+stop
+jsr L153
+L67: .string "zxr"
+stop
+L68: cmp #234, *r5
+inc L6
+dec L28
+dec r2
+red *r1
+inc *r7
+jsr *r2
+dec r1
+L69: .data 870, 198, -76, -676, -546, -675
+stop
+rts
+cmp #69, *r1
+L70: dec r7
+L71: bne L38
+inc L269
+rts
+
+lea L29, L4
+jsr *r5
+L72: not *r7
+L73: bne L25
+red r3
+mov L25, *r5
+bne L190
+not *r7
+sub #153, L20
+jmp L195
+add r6, L49
+L74: jsr *r2
+sub r5, L46
+L75: cmp r6, L137
+L76: inc *r4
+jsr *r7
+L77: .data -693, 672, 361, 909, -452, 826
+L78: mov L208, *r1
+jsr L39
+dec *r6
+inc *r1
+L79: rts
+L80: mov L62, L149
+L81: .data 741, -177, -721, 3, 283, 449, -770, 961
+L82: inc r6
+jsr *r4
+sub L61, L242
+lea L127, *r6
+cmp L5, r6
+bne L188
+dec L186
+L83: .data 837, -276, -353, -576, -898, -508, 309, -498
+; comment
+L84: sub #42, L107
+add L24, L36
+jmp *r3
+L85: red r4
+clr r3
+L86: sub #150, *r6
+L87: .string "drauhhjuwdvwigefzt"
+jsr *r3
+rts
+jsr L7
+cmp *r6, L71
+; comment
+L88: .data 450, 55, 635, -750
+cmp L233, #-160
+bne L83
+rts
+L89: jsr *r7
+dec *r0
+jsr L14
+inc L61
+L90: mov #-44, L216
+prn #188
+L91: .string "abwbshg"
+L92: not L189
+mov *r7, *r0
+not L269
+lea L56, *r7
+bne *r1
+mov #173, L82
+stop
+clr r6
+prn r6
+dec r5
+dec L153
+prn L220
+L93: .string "zwbrpsdonbcm"
+prn *r6
+bne L189
+L94: clr *r5
+jsr *r2
+inc *r5
+L95: inc r0
+stop
+
+L96: bne *r1
+L97: .string "ddooeyuhtayqjrn"
+L98: .string "cpyqwunlywpqts"
+L99: sub L207, L97
+; comment
+jmp *r7
+jsr *r2
+cmp #-130, #-29
+lea L195, *r4
+not r3
+L100: bne L93
+sub *r6, r2
+clr r5
+rts
+
+mov r5, L96
+not L80
+prn #-69
+rts
+add L233, r5
+jsr L167
+L101: .string "ykhbqfsnzdvzboptapree"
+L102: .data -774, 215, 670, 572, 47, -714, -766
+prn r4
+red r7
+mov #149, *r0
+L103: .data 101, -258, -298
+inc L41
+lea L73, r5
+inc r4
+mov #201, *r6
+rts
+L104: dec r5
+L105: jsr L3
+
+L106: dec r5
+dec r5
+not L44
+L107: stop
+L108: .data 218
+L109: jmp *r1
+L110: jsr L50
+jmp L3
+sub r1, L150
+jmp *r2
+cmp L125, *r5
+clr r3
+clr r7
+stop
+jsr L114
+not L191
+sub L53, *r4
+mov L196, *r6
+cmp *r2, L210
+
+L111: mov *r0, L115
+red L220
+L112: mov *r6, r4
+add #24, *r6
+L113: stop
+inc r6
+L114: .string "biwagqcuvzviduro"
+L115: jsr *r1
+L116: .string "oudupwsuvxelzmmtju"
+L117: add *r5, r2
+lea L245, *r5
+sub r6, L21
+sub r3, L200
+L118: .string "pmppuxa"
+not r3
+dec r6
+inc r0
+stop
+clr L15
+red L12
+cmp L59, *r7
+rts
+prn #-107
+L119: .data 17, -485, 238, 228
+L120: stop
+L121: mov #160, L188
+L122: .string "oowxaaurnghprkogezuxwgnn"
+inc L22
+inc r1
+bne L159
+bne *r1
+lea L104, *r2
+red r6
+jmp L83
+jsr *r7
+dec L75
+prn *r0
+cmp *r3, #166
+inc L118
+stop
+prn #-196
+rts
+lea L182, r6
+
+
+L123: mov L213, *r2
+sub #87, *r7
+L124: cmp #-236, r5
+stop
+jmp *r6
+L125: clr *r1
+sub r5, L220
+bne *r1
+dec L267
+lea L203, r2
+L126: not r4
+rts
+L127: lea L187, *r5
+L128: .string "anamhuzpogurrkhimipohs"
+
+mov r7, *r7
+rts
+not r4
+not *r4
+prn *r4
+L129: clr *r2
+L130: .data 588, 834, 289, 722
+cmp r6, r5
+dec r6
+L131: add r4, L118
+lea L16, r2
+lea L179, r4
+red *r1
+stop
+jmp L249
+add *r6, r5
+sub #7, *r0
+L132: add *r1, *r5
+bne *r0
+cmp #-126, L79
+L133: inc *r6
+rts
+jsr L102
+stop
+stop
+inc L44
+stop
+clr r4
+L134: .data 418, 503, -426, 983, 84, -866, 451, 136
+cmp #-93, #-103
+sub #9, L70
+add L66, r5
+jmp L8
+inc L99
+jsr L235
+sub *r6, L34
+
+clr L62
+jsr L205
+bne L195
+L135: lea L252, *r4
+L136: inc *r3
+jmp L182
+sub #78, L167
+L137: jmp L233
+mov #-89, r6
+red r5
+prn L178
+L138: dec *r5
+prn r6
+lea L147, *r3
+mov #6, r4
+jsr L106
+clr r6
+L139: .data -837, 728, -678, -41, 284
+cmp *r1, L143
+sub #-11, *r0
+L140: prn *r1
+L141: prn L198
+lea L85, r6
+L142: mov *r0, *r4
+clr L38
+jsr L4
+add L181, r6
+red L132
+mov L205, r2
+inc *r5
+L143: lea L103, r4
+clr r7
+not r3
+clr r1
+L144: .string "nmrjmjnlglxjbjajdfhtm"
+clr *r7
+inc L247
+dec *r0
+; comment
+rts
+bne L171
+not *r5
+sub L245, *r6
+jsr *r1
+dec *r0
+L145: prn L265
+prn L216
+add *r0, L11
+prn #-200
+L146: prn r6
+not L236
+not L198
+L147: red *r7
+sub #-61, r3
+add L254, *r4
+L148: dec *r5
+dec L209
+sub *r6, L250
+L149: jmp *r7
+not *r3
+L150: .data 985, -53, 584, -114, -640, 755
+L151: not L206
+add r1, r7
+; comment
+jsr *r5
+prn *r2
+inc *r7
+L152: clr *r4
+L153: clr *r6
+bne *r5
+dec r4
+L154: .string "ybxapspjybfemufw"
+jsr L94
+jsr *r3
+jmp L251
+rts
+L155: .data 143, 207, 194, -408, -488
+L156: lea L21, r2
+clr *r6
+sub r0, r7
+cmp #199, #-143
+jmp *r6
+L157: add *r0, *r2
+
+L158: lea L166, r3
+mov #125, L255
+L159: jsr *r6
+inc *r3
+L160: dec r5
+inc L44
+cmp #223, *r7
+L161: inc r5
+sub r6, *r1
+add L197, *r6
+rts
+not r1
+inc L11
+red r3
+lea L221, L220
+L162: lea L234, L230
+clr *r7
+dec *r7
+red *r0
+prn *r0
+L163: .data -434
+L164: .data 180, -289
+rts
+inc r2
+jmp *r6
+sub r1, *r5
+mov *r4, L214
+L165: stop
+bne *r2
+mov L93, *r5
+bne *r5
+mov *r0, r4
+not r3
+dec *r7
+jsr *r6
+bne *r5
+mov r6, *r4
+mov L75, L79
+rts
+not *r2
+jsr *r2
+L166: prn #-121
+not r1
+add L0, *r1
+L167: cmp r0, #113
+rts
+inc r5
+cmp L232, #-238
+jsr L52
+not L0
+red r0
+stop
+not L247
+L168: mov *r3, L251
+not r6
+clr L193
+; comment
+L169: .string "ucilfytpbfhynyaxjlmkdy"
+bne L130
+L170: cmp r2, #-79
+cmp r1, #-9
+L171: add #-196, L25
+sub *r1, *r7
+stop
+sub r2, *r2
+L172: .string "aahgjkcjanjfoqankliesqqm"
+rts
+L173: .string "mcbjkrvxyybhjgktd"
+add *r4, L227
+L174: .data 779, -514, -414, -208, 286, 590, 974, 256
+L175: sub r5, L228
+cmp r7, *r6
+not L200
+; comment
+lea L43, r1
+sub r3, L85
+red *r1
+L176: rts
+L177: jmp *r0
+lea L75, L248
+rts
+cmp #57, *r6
+bne L160
+stop
+dec L245
+red L213
+mov L12, r2
+L178: red L211
+L179: lea L13, r6
+rts
+L180: not *r1
+jmp L255
+dec L95
+jmp *r0
+L181: .string "uqzfjlixaghj"
+prn #-24
+inc *r0
+mov *r2, *r3
+jsr L21
+dec r3
+L182: mov #-250, *r7
+bne L203
+jmp *r6
+L183: clr r6
+inc *r5
+not *r5
+L184: prn #29
+L185: .string "tisckawrcewmccfwaghjpi"
+bne *r7
+cmp r1, r5
+jmp *r1
+L186: .data -880, -847, 553, 964, 430, -275, -712, 460
+dec L230
+lea L198, *r6
+L187: bne *r2
+not L0
+jmp *r4
+rts
+L188: red *r1
+jsr L132
+; comment
+lea L142, L70
+lea L221, *r1
+jmp *r1
+inc r2
+rts
+stop
+mov L112, r1
+lea L65, r7
+; comment
+jmp *r4
+inc r3
+L189: rts
+bne L232
+L190: .data 573, -243, 806, 905, 627, -34
+cmp #-67, #8
+jsr L224
+red *r1
+cmp L264, r3
+L191: clr r1
+clr L192
+L192: .string "zsii"
+L193: prn L168
+not L203
+lea L230, r7
+bne L99
+add *r2, r2
+L194: not *r0
+cmp L109, L93
+L195: not *r5
+inc *r1
+jmp L223
+lea L241, L242
+add #37, *r5
+L196: add #94, L266
+L197: jsr L253
+jmp *r0
+L198: not r0
+mov L129, *r4
+jmp *r6
+
+inc L203
+; comment
+L199: .string "otxcumuybljxhqilzrhb"
+dec L126
+prn L238
+L200: lea L85, L41
+L201: .data -136, -327, 122, 875
+L202: bne L55
+L203: prn *r0
+L204: sub *r1, *r2
+not r2
+L205: add *r4, L250
+add #127, L67
+clr r4
+jsr *r5
+dec *r1
+L206: .string "zkyqxzpauoobqlsfeejpb"
+red *r7
+dec *r5
+L207: .data 655, -401, 775, 855, -70, 622, -645, 432
+L208: mov *r1, *r2
+jsr *r0
+dec *r0
+stop
+jsr *r5
+L209: add L218, r7
+mov #32, r0
+red L235
+stop
+L210: .string "qvcewfftknytvmljxavl"
+sub #-44, L116
+L211: stop
+red r4
+prn r7
+L212: jsr *r7
+L213: .data 443, 164
+rts
+not r5
+red L262
+jsr *r4
+L214: not r2
+lea L2, L28
+mov #-34, *r4
+bne *r7
+jsr L244
+sub L237, *r3
+stop
+mov *r5, L242
+lea L245, L218
+L215: clr L229
+L216: .string "b"
+stop
+stop
+lea L52, *r0
+mov #-170, r4
+lea L211, L251
+clr r7
+not r7
+jsr L265
+not L167
+rts
+red *r4
+L217: prn #-132
+L218: jsr *r1
+bne L76
+lea L227, L266
+L219: .string "byjbfrqimcdtsacnd"
+L220: .data -565, 604, -66, 541
+mov L266, r0
+bne *r5
+; comment
+add #115, *r2
+jsr L261
+mov *r7, r1
+clr L172
+sub r7, *r1
+bne *r1
+L221: .data -361
+jmp L246
+lea L18, *r7
+dec *r3
+L222: add L251, r0
+L223: mov #-183, *r2
+L224: jmp L89
+; comment
+; comment
+jmp *r0
+clr L100
+stop
+bne L158
+L225: .data 523, 45, 912
+add L39, L61
+dec *r4
+
+L226: red *r2
+prn r7
+dec L19
+stop
+red L241
+mov #-46, r2
+dec *r3
+sub L238, *r6
+inc L234
+L227: .data 309, -118, 423, 959, -519, 89, -836
+L228: .data 601, 922, 451, 757
+L229: inc *r7
+cmp *r0, L234
+L230: .string "jiaexfkefhyhjsgepwjumt"
+L231: .data 786, -852
+jmp *r3
+lea L260, r6
+dec r7
+jmp L14
+bne L264
+red L254
+L232: jsr L186
+L233: stop
+red L252
+rts
+L234: not r7
+L235: mov *r0, *r3
+L236: stop
+L237: rts
+not *r7
+prn r6
+bne L238
+sub L107, r2
+L238: cmp r6, L219
+inc L269
+L239: red L263
+inc L96
+stop
+cmp #-84, r1
+clr r5
+stop
+not *r4
+sub #140, L23
+clr r6
+add #-228, r0
+
+L240: add r2, r0
+L241: stop
+mov L175, r4
+
+jmp L214
+dec L61
+inc r3
+clr L226
+jmp *r5
+jmp L52
+jsr L271
+L242: jmp *r4
+L243: .string "yqnhxdljjwmown"
+L244: inc *r5
+clr r1
+L245: .data -824, 98, 865, -239, -411, -271
+L246: .data -833
+rts
+jmp L249
+red r5
+cmp L170, r0
+L247: .string "ogzkfbmfwxsmvigczcdhoovk"
+clr L261
+dec *r5
+clr L248
+L248: .data -327
+prn #-98
+add *r7, r3
+stop
+L249: not *r2
+red *r1
+jsr L271
+red r0
+L250: .data -485, -696
+stop
+prn L254
+jmp *r7
+L251: mov L255, *r4
+not r2
+jsr L35
+clr r4
+L252: bne L10
+L253: .data -652, -269, -90, -374, -750, -104, 555, 353
+; comment
+add #89, *r2
+L254: .string "b"
+inc *r3
+bne L258
+L255: clr *r7
+rts
+L256: .data -818, 342, -349
+L257: cmp *r4, r7
+inc r1
+L258: .string "lrejg"
+; comment
+clr r3
+L259: red *r0
+bne L263
+sub #-15, L109
+clr *r4
+sub r6, L264
+dec *r0
+jsr L255
+bne L243
+lea L82, L242
+lea L33, L271
+clr L133
+mov r5, *r5
+red L151
+L260: .data 900, -206, -277, 36
+
+cmp *r2, L261
+stop
+cmp *r0, L265
+L261: .string "bvmqobitgemiwfw"
+dec r2
+not L262
+stop
+mov r0, r2
+jsr L84
+lea L270, r4
+clr L41
+jsr L267
+inc L136
+stop
+clr *r0
+L262: prn r1
+L263: add r4, r6
+red L270
+red *r6
+L264: not L267
+L265: .data -557, -137, -272, 451, -400, 270, -445, 262
+L266: not L270
+bne L269
+jsr *r4
+; comment
+L267: jmp L270
+red r3
+rts
+mov #-233, *r7
+L268: bne L78
+clr r1
+not r7
+L269: lea L114, r0
+
+jmp L117
+jsr *r5
+
+mov L270, *r5
+inc r6
+dec L270
+cmp #36, r6
+lea L270, *r0
+stop
+L270: .data -63, -463, -621, 888, -495
+bne L271
+; comment
+rts
+bne *r2
+dec r2
+L271: cmp *r2, #41
+stop
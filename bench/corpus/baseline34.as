@@ -0,0 +1,1020 @@
+; Generated by genCorpus --seed 35
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+L0: mov r0, L0
+L1: .string "dygbmx"
+red L23
+not L1
+L2: .data -399, -58, 80
+cmp #129, *r5
+inc L1
+jmp *r7
+L3: jsr L3
+clr *r1
+red *r7
+prn *r5
+jmp *r1
+inc *r1
+dec *r2
+L4: add #-137, r3
+dec *r4
+lea L4, L1
+bne L4
+add #-45, L255
+lea L0, r0
+rts
+L5: sub *r4, L99
+clr r3
+mov *r3, r0
+L6: clr r2
+mov *r2, *r4
+L7: dec *r3
+rts
+cmp L131, *r7
+add *r4, L1
+sub *r5, *r6
+not L3
+prn r7
+clr *r6
+sub r7, r3
+rts
+L8: .data -862
+L9: prn r0
+lea L98, L2
+inc r7
+; comment
+prn L0
+
+sub L7, r3
+jmp *r6
+L10: red *r0
+bne *r3
+L11: lea L207, r7
+L12: mov #200, L6
+lea L118, L7
+jmp *r4
+L13: jmp *r7
+L14: red L230
+red *r7
+
+bne *r7
+; comment
+; comment
+
+prn *r5
+sub #104, L30
+; comment
+add r4, L203
+inc r5
+stop
+red *r4
+red L123
+inc L178
+bne *r1
+add #-116, r4
+jmp *r1
+L15: red *r0
+lea L251, *r1
+stop
+L16: .string "nmigpvlt"
+L17: bne L11
+L18: jsr L15
+stop
+bne *r2
+L19: cmp *r2, #69
+L20: .string "tyguianjucdcyavwqddi"
+; comment
+sub r5, *r3
+not L3
+prn #-146
+L21: clr L172
+L22: dec *r3
+jmp L3
+add r2, r4
+sub *r3, L7
+clr r4
+jmp L154
+add *r4, r2
+prn *r0
+jmp *r0
+red L214
+add *r3, r0
+prn L7
+sub r4, *r0
+L23: red L127
+; comment
+lea L0, r6
+sub *r7, *r1
+inc r6
+cmp *r0, L158
+L24: stop
+sub L14, r0
+bne *r5
+L25: rts
+; comment
+rts
+L26: mov L185, r2
+clr L9
+L27: .string "qgxaogbzitidcbtdja"
+mov #-217, *r4
+clr r4
+L28: .data 27, 27, 797, -571, -12, -577, -618, -701
+rts
+clr L268
+add r2, *r4
+L29: .data -150, -797
+red r1
+dec *r4
+L30: lea L67, L2
+add L27, r2
+stop
+rts
+jmp L48
+mov #-206, L12
+jmp L249
+dec r4
+not r7
+inc r2
+L31: bne *r3
+bne L231
+add r6, L233
+L32: stop
+rts
+bne *r3
+prn L24
+L33: .data 205, -708, 256, -36, -858, -134, 235, -767
+bne L8
+L34: dec *r5
+prn *r1
+L35: lea L118, r1
+rts
+rts
+jsr L111
+red r0
+rts
+bne *r0
+jsr L30
+stop
+inc r3
+bne L29
+inc L260
+L36: .string "cwgpfaswkqazk"
+L37: .string "ifbomq"
+L38: .string "dizsfvzvpbbmhfdqkm"
+jmp *r2
+jmp *r0
+sub L13, *r2
+jsr *r3
+lea L158, L149
+mov #67, L19
+L39: red r7
+
+sub *r1, r4
+rts
+dec L187
+L40: add *r1, *r6
+lea L186, L213
+L41: prn L143
+lea L26, L32
+prn #224
+sub r4, r3
+not r5
+dec r5
+stop
+L42: dec *r6
+bne *r5
+red *r2
+jsr *r5
+rts
+L43: .data -217, -565, -200
+rts
+L44: .data 709, 732, -42, 363
+red r7
+red *r6
+lea L30, L123
+L45: .string "fzjdlvoi"
+L46: .data 653, 847
+rts
+inc r7
+jmp *r1
+inc r4
+L47: rts
+L48: rts
+lea L44, r1
+stop
+L49: jmp *r2
+add *r0, L115
+stop
+red r5
+jmp *r6
+dec r2
+bne *r5
+; comment
+L50: jmp L10
+lea L177, *r1
+jsr *r1
+rts
+dec *r5
+L51: not L3
+L52: .data -583
+L53: not *r1
+L54: bne *r7
+inc r1
+
+rts
+inc *r0
+red L24
+L55: rts
+dec *r7
+L56: mov r6, r4
+red L47
+inc L103
+prn #87
+dec *r6
+clr r7
+
+rts
+L57: not r7
+sub L43, *r0
+bne L220
+lea L268, *r4
+rts
+clr L12
+L58: lea L34, L38
+clr *r5
+L59: sub *r6, r1
+rts
+inc r3
+L60: .data 84, 429
+L61: stop
+L62: clr r5
+prn #29
+red *r0
+add L37, r0
+clr L36
+clr r6
+inc r2
+L63: red L88
+lea L255, r1
+L64: not *r2
+bne *r3
+L65: .data -780, -478, 486, -93, -90, 293
+prn *r0
+red L200
+rts
+; comment
+inc L186
+sub r1, L37
+mov L218, L7
+
+lea L59, r4
+not *r5
+L66: not r7
+L67: .data 816, 946, 668, -27, -356, -223, 886
+cmp *r5, #110
+lea L203, L21
+L68: lea L5, r7
+cmp L96, *r2
+rts
+not r5
+L69: cmp #175, r6
+lea L208, r0
+add r4, L36
+L70: add r5, L117
+stop
+sub #-140, r4
+mov r4, r1
+sub r3, *r6
+L71: not r3
+jsr L271
+L72: .data -215, 62, -289, -637, 375, -911, 234
+stop
+L73: .string "rrwt"
+rts
+L74: .data 357, 673, 745
+L75: .string "hbzosohgbqoyhuefr"
+clr r6
+jmp *r6
+L76: add #67, r5
+clr r5
+rts
+prn L55
+L77: .data 821, -177, 625, 316, -413, 369, 799
+not L60
+dec *r6
+L78: .data 549, 501, -215, -903
+L79: .data 364, 120, 979, 164
+L80: inc *r3
+cmp #180, r2
+add *r3, *r0
+dec L103
+inc L71
+lea L268, L145
+L81: prn #29
+prn r0
+
+mov r2, r1
+L82: jmp L78
+sub r5, r0
+jsr L152
+rts
+sub L144, r4
+add L3, r6
+L83: .string "xrpvtiheqic"
+L84: .string "racxswbtr"
+dec *r0
+cmp #-162, *r1
+L85: jmp L11
+red r5
+clr *r4
+L86: .string "lxjymsqbbyffksf"
+sub #188, r2
+sub #-85, r1
+L87: .data -737, -683, -778, -583, -472
+red r4
+jsr L34
+bne *r7
+not r5
+; comment
+L88: clr *r4
+L89: not *r7
+sub L245, r2
+mov r1, L30
+red r1
+prn r0
+stop
+stop
+cmp r0, r1
+L90: lea L22, L77
+rts
+
+red L133
+L91: sub r2, *r5
+jmp L233
+clr r5
+not r4
+jmp L173
+
+add *r5, r4
+L92: cmp #-128, #11
+lea L46, L18
+
+add r5, *r5
+L93: .string "bzdpvbjaunnnxmsdu"
+inc r1
+L94: .data 580, 900, 270
+add L21, r1
+add r1, L0
+rts
+cmp *r7, #-214
+jmp *r1
+red *r5
+jmp L68
+cmp *r5, *r1
+sub L32, *r5
+L95: bne L260
+not r4
+L96: add r2, L188
+cmp #5, L65
+stop
+L97: bne L196
+inc L55
+cmp *r6, L76
+red *r3
+mov *r0, *r3
+L98: lea L12, *r6
+jsr *r6
+jsr *r1
+not *r0
+stop
+jmp *r4
+not *r1
+lea L64, L88
+add #33, r5
+clr L144
+L99: .data -963, -537, 32, 484, 19, -188, -756, 11
+stop
+inc L21
+L100: jmp *r7
+bne *r0
+cmp r2, *r3
+L101: .data -582, -654, 977
+L102: .data -283, 905, -390, 709, -342
+lea L55, r6
+L103: .data -870
+L104: .string "hhhwnhtdlukiq"
+L105: rts
+clr L19
+lea L16, *r7
+inc r3
+clr *r5
+red r5
+mov *r1, *r3
+not L241
+inc L107
+jsr *r5
+clr r2
+prn L58
+dec *r3
+add *r1, *r4
+inc L29
+
+lea L18, *r1
+sub L49, r0
+not L243
+cmp r1, #-32
+; comment
+rts
+L106: cmp r1, *r2
+lea L153, L1
+not r6
+L107: red r4
+L108: add #-217, *r5
+add *r1, *r0
+L109: prn #-76
+jmp *r0
+L110: inc r6
+L111: bne *r0
+jsr *r5
+L112: .string "lkaplgwsd"
+dec *r3
+L113: clr r2
+bne L113
+sub L8, L98
+L114: cmp r7, #-36
+L115: jmp *r5
+lea L204, r0
+L116: .string "vxfidnefbwxadrl"
+L117: red L32
+L118: sub r5, *r6
+sub *r7, L128
+dec L219
+clr r4
+not L39
+L119: .string "jjocblhjdsetsspduyierf"
+L120: not *r3
+L121: red r2
+lea L177, r5
+stop
+not r6
+L122: lea L113, r3
+; comment
+L123: lea L162, r4
+L124: .data -505, -663
+add #-153, L114
+L125: .data -799, -461, -159, -345, -288, -168
+clr *r4
+bne *r0
+inc L188
+L126: red L206
+not r3
+bne L56
+lea L234, r0
+cmp #-211, *r7
+red *r7
+L127: sub *r7, r1
+bne L107
+L128: cmp r0, r5
+L129: .data 884, 240, 219, -179, -626, 64, 6, 414
+lea L100, r0
+L130: stop
+
+red r3
+L131: .string "ijlvkvjgld"
+add L46, L149
+L132: .string "citbiqfpmslnpabfjq"
+add r7, L180
+sub #-249, L28
+L133: not r0
+mov *r1, *r0
+prn *r2
+L134: .data 910, -914
+jsr *r0
+rts
+L135: .string "bfpzepiur"
+inc L144
+not r2
+L136: clr L28
+mov *r1, r3
+L137: rts
+jsr L85
+red L76
+mov *r7, *r3
+lea L161, *r0
+L138: jmp *r4
+L139: mov L264, L242
+red *r1
+bne L47
+sub *r2, r3
+add *r6, *r5
+L140: sub #-16, r0
+add *r3, r1
+; comment
+jmp *r2
+sub r7, *r2
+bne *r1
+jsr L137
+mov #143, L11
+add r2, L213
+dec r6
+cmp r4, r6
+L141: .string "ecq"
+L142: .data 987, -953, -928
+dec *r2
+stop
+L143: not r2
+rts
+red *r7
+L144: add #245, *r1
+sub *r6, L194
+not r4
+clr L15
+dec r3
+add r0, r3
+L145: not L163
+lea L121, r0
+stop
+lea L74, L65
+stop
+jmp *r3
+L146: inc r0
+clr L137
+inc r1
+L147: sub L178, r0
+L148: cmp r1, *r7
+prn #124
+L149: jsr *r1
+cmp *r1, L262
+L150: stop
+add #148, *r5
+L151: lea L264, r4
+clr r6
+L152: add r1, r3
+L153: .data 11, 374, -954, -668
+clr r5
+clr *r7
+L154: .data -865, -171, -885, 437
+add L124, *r2
+L155: red r6
+bne *r0
+cmp r3, #223
+jmp *r1
+rts
+jsr *r3
+L156: clr r4
+L157: .data 267, -492, -63, -438, -809, 698, -327
+jsr *r3
+clr *r0
+bne *r6
+jmp L220
+L158: red L179
+L159: dec r2
+L160: .data -944, 12, 49, 6, -812, 207, -309, 171
+dec L103
+bne L194
+clr *r3
+jmp *r6
+bne L11
+mov r4, L8
+inc r7
+rts
+L161: cmp L123, r2
+mov *r6, L79
+L162: lea L187, L268
+clr *r6
+L163: bne *r1
+dec *r4
+cmp *r7, #-216
+jsr L223
+red L174
+add L11, *r7
+mov r3, r6
+jmp *r3
+
+L164: prn *r4
+prn #-249
+red L60
+lea L213, *r0
+mov r3, L115
+stop
+L165: .string "lamvtshax"
+mov L112, r1
+jmp *r3
+not L158
+cmp *r0, r5
+jsr *r2
+L166: not r0
+jsr L155
+prn *r2
+add *r4, r6
+L167: sub r0, L56
+clr *r3
+bne *r3
+inc L266
+prn #12
+L168: rts
+dec L209
+L169: .string "inhblyxckszxufqkga"
+cmp *r0, #160
+stop
+cmp r3, *r2
+dec r5
+prn L230
+jmp *r5
+L170: .string "dfhjxmtfvk"
+stop
+; comment
+L171: .string "ojonokocjnqznsylxqetbc"
+mov #115, *r3
+stop
+L172: .string "cnkhrh"
+; comment
+not *r5
+clr r7
+L173: mov #45, *r1
+sub #79, r6
+stop
+jmp L225
+inc L188
+dec r6
+L174: lea L190, *r6
+L175: inc *r7
+rts
+rts
+L176: .data -687
+prn L206
+prn r1
+clr *r3
+prn #-250
+L177: .data -188, -719, 106, -90, -543, -801
+add #31, r5
+jmp L255
+jsr *r7
+red L112
+not r7
+rts
+prn L108
+clr *r2
+L178: .string "vwvayvdivtonjzyjocnt"
+jsr *r1
+inc *r5
+L179: .data -957, 831
+cmp L243, #-237
+cmp #59, L202
+L180: .data -354, -793, 672
+bne L251
+dec *r5
+L181: red L165
+lea L67, r3
+bne *r4
+L182: mov r6, *r7
+L183: prn L111
+sub #-120, L214
+prn L115
+inc *r1
+jsr *r6
+
+L184: inc r6
+L185: lea L265, L154
+L186: inc *r7
+sub r6, r0
+mov L222, *r3
+mov L23, *r7
+L187: inc L100
+L188: prn *r6
+not L150
+
+L189: clr r3
+not *r1
+L190: lea L237, *r0
+L191: prn r4
+not L203
+dec L203
+L192: .data 429
+jsr L75
+not *r4
+jsr *r1
+red *r5
+add L153, r3
+stop
+add L222, L192
+red r3
+stop
+cmp #61, L231
+L193: red *r3
+inc r5
+cmp r7, r6
+L194: .data -938, -421, 730, -704, -918, 849, 487, -922
+inc r5
+jmp *r2
+clr *r5
+stop
+red r3
+mov r7, *r3
+L195: lea L250, r5
+stop
+L196: .string "lblarpwyrwoawmvkc"
+L197: jmp L198
+mov L140, r3
+L198: bne *r5
+jmp L271
+L199: .data 314, -81, -237, 400
+not *r7
+L200: prn #-223
+prn *r7
+L201: dec *r5
+lea L97, *r3
+add r7, r0
+mov L9, *r1
+rts
+mov L117, r1
+sub L178, *r2
+jsr *r1
+L202: dec *r3
+L203: .data -932, -216
+rts
+L204: .data 906, 578
+; comment
+inc *r1
+L205: .data -945, 9, -815, -617, -669
+L206: red r4
+inc r6
+L207: .data 91, 966, 368, -6, -145, -377, -15
+rts
+cmp L249, #-46
+rts
+stop
+sub *r0, *r5
+jmp *r0
+mov r6, r5
+jmp *r5
+jsr L162
+clr *r0
+bne L242
+inc *r3
+clr *r3
+L208: add *r7, L59
+rts
+sub r4, r2
+L209: prn r1
+L210: .string "gghxkpvdxvkmewfzqdnrqhda"
+red *r1
+cmp #-141, L211
+
+mov r7, L186
+jmp L65
+red L234
+cmp L49, #234
+red *r1
+L211: inc *r0
+sub #-153, r2
+red L235
+not L262
+L212: .data -291, -736, -489, 767, 107, 33, -615, 502
+stop
+jsr *r7
+; comment
+lea L83, r6
+rts
+stop
+jmp *r4
+red r2
+rts
+add r0, r5
+L213: .string "jfsumweu"
+add *r1, *r4
+clr L50
+lea L36, L59
+red r5
+clr r0
+not *r2
+L214: .data -217, -260
+L215: rts
+clr *r6
+red L51
+sub r0, *r6
+
+L216: red r0
+inc *r1
+cmp r0, #-229
+lea L266, r6
+red *r1
+clr L35
+jsr L197
+bne *r2
+L217: .data 368, -747
+L218: .data -574, 144, -626, 17, 671, 843, -492, 829
+rts
+rts
+mov #37, *r0
+L219: add r7, *r2
+prn r1
+L220: red L225
+L221: dec *r7
+L222: lea L2, r4
+cmp *r2, *r6
+L223: .data -942, -627, -885, -596, -236
+red L245
+stop
+sub #-198, *r2
+jsr *r6
+lea L62, r2
+bne *r7
+; comment
+mov #-84, *r1
+lea L20, r1
+jsr L252
+inc *r4
+jsr L123
+mov L260, r6
+prn L130
+not r7
+sub #175, *r2
+stop
+; comment
+mov r3, *r7
+
+rts
+rts
+cmp r4, L192
+prn *r4
+jsr *r5
+L224: dec L251
+cmp L271, #62
+L225: red L272
+inc L269
+L226: .string "b"
+prn r3
+L227: .data 106, -256, 909, -903, -507, -550, -661, -83
+stop
+stop
+mov L23, *r7
+add L248, r5
+rts
+inc L247
+lea L184, r5
+L228: stop
+prn L44
+red r2
+clr *r5
+mov #-189, r0
+mov #-84, L272
+clr r5
+rts
+L229: .string "ynrtm"
+not L23
+stop
+sub L251, r1
+red r6
+rts
+L230: bne L248
+red L247
+L231: rts
+jsr L255
+cmp L258, #111
+rts
+jmp L245
+L232: bne L148
+mov *r2, L261
+cmp *r4, L52
+rts
+; comment
+bne L262
+inc *r6
+rts
+dec L235
+L233: .data -660, 411
+L234: jsr L247
+add r5, L266
+
+L235: dec L89
+L236: .string "zkcvskydjkpw"
+inc r2
+red L270
+not *r7
+red *r4
+red L158
+jmp L172
+jsr L222
+cmp *r6, L256
+sub *r2, L132
+jmp *r6
+mov #-86, L146
+L237: jsr L251
+not L165
+L238: .string "brxsmqapay"
+; comment
+cmp *r2, *r5
+sub L252, *r5
+L239: rts
+not r2
+jmp *r5
+lea L240, L226
+L240: .data 333, 183, 810, -562, 397, -141, -687
+L241: .data -348
+cmp r2, r7
+mov #-60, *r7
+inc L69
+mov L115, r3
+L242: .data 392, -256
+rts
+L243: .data 870, -162, 824, -939, 620, -281, 72
+L244: .string "sirmj"
+L245: .string "irwn"
+L246: lea L242, r2
+jmp L78
+bne L267
+rts
+add #139, L48
+L247: jsr *r4
+add #-234, *r6
+jmp *r7
+L248: .data 68, 16, 928, 726, 608, -413
+cmp *r6, #170
+rts
+jmp *r0
+; comment
+cmp r4, L200
+jmp L184
+L249: .string "gcty"
+inc r3
+dec r6
+prn #130
+L250: bne L12
+bne *r4
+L251: stop
+not r7
+rts
+stop
+L252: jsr L238
+L253: mov r1, L88
+sub *r1, L269
+L254: cmp L256, L131
+
+L255: .string "vbeszpxodteqi"
+jmp *r1
+L256: jmp L268
+L257: bne L83
+mov *r7, r5
+not *r5
+L258: .string "h"
+
+L259: .string "bifgirwna"
+L260: dec *r6
+dec *r4
+not *r1
+; comment
+jmp *r7
+cmp L262, L73
+add L272, *r4
+jmp *r3
+prn r5
+L261: stop
+L262: .data 280, -368, -684, -318, 70, 625
+L263: jmp L225
+sub r4, r6
+L264: inc *r2
+L265: .data -910, -51
+sub *r7, r5
+lea L268, *r2
+cmp #-197, L269
+stop
+dec L228
+stop
+not L262
+red L267
+clr *r0
+red L125
+rts
+L266: .data -699, -250, -275, 685, -875, 106
+prn r5
+L267: .string "eypubtn"
+L268: bne *r1
+mov *r3, r2
+L269: .data 0, 622, 62, 481, 27, -551, 481, -713
+jmp L271
+L270: .data -217, 402, 818, -727, -835, -653, 866
+L271: prn #60
+stop
+prn #214
+dec r7
+jmp *r0
+dec *r1
+L272: .string "ehztdsgdcoltcvh"
+stop
@@ -0,0 +1,1019 @@
+; Generated by genCorpus --seed 36
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+clr L53
+cmp L173, *r3
+red r4
+inc r4
+L0: mov *r5, *r3
+jsr L158
+lea L141, L94
+lea L211, L0
+not *r6
+L1: .string "pqxbjtfwstitzotqvgazep"
+L2: prn *r4
+lea L1, r3
+sub #1, *r2
+jsr *r1
+rts
+jmp L165
+inc L2
+stop
+add r1, *r5
+sub L242, L96
+L3: .string "nuxsfthpbpciqk"
+cmp r6, L104
+stop
+L4: .string "fpmsqyxwzxrtopgufxtqhlv"
+lea L227, r0
+; comment
+L5: sub #197, L221
+jsr *r2
+clr L4
+red *r3
+add *r5, r5
+L6: sub #71, L6
+prn r1
+; comment
+rts
+mov *r7, r6
+rts
+prn L2
+L7: sub L78, L3
+add #232, *r1
+inc *r6
+prn *r0
+jsr L5
+L8: rts
+mov #-245, *r4
+inc L107
+dec L128
+L9: inc r2
+
+inc *r0
+rts
+L10: .data -733
+lea L212, L2
+L11: .data 817, -237, 220, 978
+L12: inc *r7
+; comment
+L13: .string "mqicad"
+not *r2
+; comment
+L14: cmp r1, r6
+; comment
+rts
+not *r6
+L15: red L11
+inc *r3
+stop
+
+; comment
+sub L2, L212
+sub L0, r3
+dec r6
+prn #74
+L16: rts
+dec r3
+jsr *r7
+L17: rts
+L18: .data -54, -732, -894, 596, -871
+stop
+lea L16, L9
+L19: .string "rwe"
+L20: jmp L74
+L21: .data -693, -834, -719
+jmp *r5
+add *r1, *r3
+L22: jmp *r3
+red r1
+lea L230, *r4
+add r1, r5
+red r4
+L23: .string "gkffyhpmwhpao"
+L24: lea L221, *r0
+red r1
+red *r0
+jsr *r3
+dec r6
+L25: .data -964, -980, 144, 174, 600, 450, 459, 935
+L26: .string "oox"
+mov L16, *r6
+jsr *r7
+jmp *r1
+L27: mov r6, L164
+inc r3
+L28: lea L166, *r7
+jmp L42
+L29: .data 878, -538, -416, -916, -383, -3
+
+rts
+prn *r3
+mov r2, L182
+L30: bne *r4
+L31: stop
+L32: .data 867, -769, 354, -766, -506, 995, -640, 111
+L33: .string "zqmmjkkbjignhxt"
+
+red r6
+L34: .string "etidegwcxqnbszus"
+clr L21
+add #255, r5
+bne L2
+sub *r6, *r7
+jsr *r1
+L35: .data -672, 878, -583
+L36: mov #152, L55
+jsr *r3
+jsr *r0
+clr *r5
+rts
+stop
+bne L174
+stop
+; comment
+L37: .string "iyqeerazngvtpbhm"
+jmp L175
+mov r3, *r3
+not *r2
+clr L59
+rts
+L38: .data -915
+inc r4
+not L127
+mov #213, L29
+L39: dec *r7
+jmp L56
+L40: add *r3, *r2
+clr r7
+L41: .string "g"
+sub L50, r6
+not L122
+bne L262
+L42: prn *r7
+L43: .string "gqsskkneysbscceevwbpno"
+stop
+
+stop
+lea L209, *r0
+stop
+bne L235
+bne *r0
+red L182
+mov #-12, *r3
+lea L198, r0
+add *r2, L232
+not *r6
+L44: .data 134, 482, 948, 409, 5, 164
+add *r2, r1
+add *r0, r2
+jmp L91
+jmp L248
+L45: cmp #91, L171
+L46: .data 576, -952, -653
+L47: .string "wfhllq"
+bne L214
+L48: .string "ivavl"
+clr L45
+
+cmp *r3, r0
+L49: prn #-200
+prn r0
+stop
+mov L134, L121
+inc *r3
+clr *r5
+mov #184, L6
+lea L26, *r4
+stop
+L50: .data 796, 898, 386, 126, 373, 862
+L51: lea L4, L3
+L52: rts
+stop
+bne L183
+not L40
+dec *r4
+not L78
+add #-54, r0
+jsr *r4
+L53: prn #26
+
+mov #-106, *r5
+L54: .data -236, 703, -919, -948, 971
+L55: jmp *r2
+mov #163, *r7
+inc r3
+L56: prn #15
+jsr L44
+cmp #250, L32
+jmp *r6
+prn r7
+cmp #30, L82
+mov *r3, L0
+not L54
+L57: .data -778
+bne *r5
+L58: .string "pfa"
+add r2, r4
+; comment
+L59: jsr L261
+clr L220
+not *r0
+lea L9, r3
+stop
+rts
+mov r4, r0
+L60: sub r5, *r0
+L61: add r3, r3
+clr L164
+bne *r1
+jsr *r0
+jmp L43
+stop
+L62: .string "kf"
+inc L186
+stop
+rts
+L63: cmp *r7, L5
+sub *r2, *r4
+inc L3
+lea L111, *r2
+jmp L20
+L64: bne L45
+sub *r1, r6
+L65: clr *r2
+L66: rts
+L67: inc *r3
+prn r5
+jsr *r2
+red *r4
+cmp #-153, r6
+sub L21, *r4
+dec L127
+rts
+inc *r1
+rts
+lea L1, *r3
+bne L19
+prn L103
+inc *r1
+bne *r3
+bne L46
+dec *r5
+L68: .string "yxesgqtdvevuybwylbff"
+dec r5
+L69: .string "nkqoxlvcphh"
+rts
+inc *r7
+sub r1, *r1
+L70: .data -497, -655, 471, -229, 455, -109
+rts
+not r4
+lea L204, *r3
+rts
+inc *r4
+sub r2, L48
+L71: .string "jpnzwmputgkgsnajtzqocxj"
+jsr *r4
+red L17
+stop
+mov L257, r3
+L72: prn #-183
+L73: clr *r1
+dec L237
+L74: .data 852
+L75: red r0
+jsr *r4
+jsr *r6
+dec r5
+dec *r7
+jsr L103
+inc *r7
+cmp *r6, L54
+L76: lea L109, *r6
+L77: stop
+mov L58, r5
+add *r5, L166
+L78: .data 717, 878, 87, -339, 750, -658
+bne L44
+rts
+lea L88, r0
+inc L197
+not *r1
+jmp L25
+L79: .string "ichcbg"
+cmp *r4, L55
+add #-251, r2
+stop
+red *r2
+L80: prn #102
+; comment
+jmp L99
+lea L209, L32
+red r0
+inc *r7
+lea L197, *r7
+clr *r2
+L81: clr L236
+clr L81
+clr L219
+sub r0, r1
+inc r3
+L82: .data -379, 82, 610, 528, 158, -12, -463
+L83: cmp *r7, #-75
+not *r2
+L84: jsr *r3
+L85: inc r6
+not r6
+not *r7
+mov L78, r1
+bne *r0
+sub #63, L26
+prn *r4
+L86: .data -531, 524, -308
+stop
+inc *r4
+jsr L23
+sub r2, *r4
+L87: not *r3
+prn r2
+L88: .data -232, -514, 25, 679, -12, 679, -274, 189
+L89: .data -892, 455, -767, 852, -751, -517
+L90: stop
+L91: lea L76, r1
+jmp L44
+inc r3
+L92: .data -489, -40, 825, 46, -586, 358, 416, 385
+stop
+L93: .data -913, 880, 239, 911, -200
+bne L163
+L94: inc *r3
+lea L41, r7
+jmp *r2
+jmp L5
+dec *r4
+stop
+L95: add *r7, L257
+add *r2, L143
+rts
+bne *r3
+L96: inc L43
+L97: inc *r6
+clr *r4
+jmp L27
+L98: bne *r5
+inc L23
+add L8, r6
+bne L197
+add #55, *r0
+L99: sub r1, r2
+mov r2, L42
+not r4
+L100: .data -457, 594, 73, 309
+dec L55
+not L6
+sub *r5, L5
+add *r1, r4
+L101: .data 39
+L102: .string "xbehtypw"
+L103: .string "smdk"
+L104: .data -324, -139, -510, 510
+; comment
+L105: .data 369, 716
+clr L217
+stop
+clr *r4
+L106: inc r6
+add #-94, L130
+dec L242
+sub r6, r0
+prn r1
+dec *r0
+L107: inc *r6
+cmp L256, L18
+bne L1
+rts
+stop
+lea L261, *r2
+L108: sub *r3, r0
+L109: not r6
+cmp *r4, L163
+add r0, L232
+not *r0
+cmp r2, *r1
+L110: add *r1, L149
+bne *r4
+mov *r2, r0
+L111: .string "obrw"
+
+clr r6
+rts
+L112: .string "ckmyjwt"
+L113: rts
+L114: sub r4, *r4
+inc r2
+jsr *r1
+sub r2, *r6
+L115: dec r6
+cmp L59, r4
+L116: lea L195, *r5
+lea L39, L166
+L117: prn #236
+rts
+cmp *r2, *r0
+L118: .string "qxngbpjvjtqkezwayday"
+; comment
+not r4
+not r5
+prn #-122
+stop
+add *r5, r5
+L119: bne *r5
+L120: .data 345, 489, -916, -623, -229, 73, -299, 174
+clr *r5
+rts
+jmp *r0
+rts
+bne L241
+inc L235
+L121: rts
+L122: cmp r2, *r3
+L123: .string "zrtosfzulhoyxmx"
+clr *r1
+sub *r2, L99
+jmp *r1
+L124: .string "zvlvhquqwcxxytoruruszybu"
+jsr *r0
+prn r7
+stop
+add *r3, L52
+inc r5
+jmp *r6
+inc L131
+jmp *r2
+jsr *r4
+inc L109
+dec *r7
+bne *r3
+cmp L116, r1
+L125: sub L223, *r1
+sub #165, r7
+
+L126: .string "rosddxcptwzeghc"
+L127: prn #169
+L128: rts
+dec L186
+L129: jmp *r6
+L130: inc L49
+L131: red r2
+L132: .string "p"
+inc L16
+L133: add L181, *r0
+rts
+L134: lea L87, *r6
+lea L6, r6
+L135: jmp *r0
+not *r0
+red *r4
+jmp *r2
+L136: prn r4
+jmp *r2
+L137: bne L17
+L138: jmp L84
+L139: .string "n"
+sub *r6, L117
+
+clr *r1
+L140: jmp *r4
+not *r3
+sub r3, L163
+stop
+stop
+not L15
+L141: red *r7
+L142: clr r2
+prn #-3
+red *r3
+cmp *r3, *r2
+lea L126, L53
+prn *r6
+jmp *r4
+L143: .data -476, -5, -601, -628, 843, 247
+not *r6
+rts
+jsr L41
+bne L24
+L144: .string "ebw"
+rts
+add r3, L137
+not *r5
+jsr *r1
+L145: .string "dkhcyutifptvkzxhxyvlzmgs"
+prn L131
+not r6
+bne L154
+jsr *r5
+
+L146: .data -145, 964, 574, 739
+inc *r6
+L147: jsr L161
+jsr L96
+; comment
+rts
+L148: stop
+L149: add r5, L158
+add r0, L238
+L150: not L165
+bne *r1
+mov r6, r6
+inc r0
+L151: jsr L176
+clr *r2
+add r2, *r0
+jsr L152
+inc L94
+stop
+stop
+inc *r3
+red L213
+jmp *r5
+jsr L0
+inc L98
+L152: stop
+bne *r6
+L153: prn #-7
+L154: .string "chjzniy"
+prn L248
+not r1
+add #162, *r1
+prn L245
+L155: prn #-252
+L156: sub #-159, *r3
+rts
+L157: add r2, r7
+add *r0, L129
+L158: dec L198
+mov L210, r4
+prn L255
+L159: sub *r6, *r3
+dec L99
+bne L257
+L160: mov r2, L152
+; comment
+sub r5, *r6
+prn L210
+L161: sub #-22, L231
+L162: add *r0, *r1
+dec L0
+
+L163: prn *r4
+bne *r5
+bne *r7
+not L199
+inc r5
+jmp *r1
+dec L30
+mov r7, L132
+jmp L33
+jmp L41
+lea L103, L235
+rts
+bne *r4
+mov *r1, *r1
+jmp L238
+sub #53, *r5
+rts
+cmp #55, *r5
+; comment
+add #-70, *r5
+L164: .string "ycyyukmgtlbdclz"
+sub #126, r7
+stop
+; comment
+jsr L19
+bne *r0
+
+sub r5, L182
+jmp L193
+L165: .data -252
+dec *r5
+red *r0
+L166: inc L48
+L167: .data 95, 976, -853
+red L217
+jsr L197
+L168: stop
+mov #-28, L249
+
+L169: .string "ivoinxnm"
+L170: mov L120, L47
+rts
+rts
+jmp *r0
+sub #236, r7
+clr *r5
+L171: .string "ijjqmiffpleffi"
+inc *r3
+lea L198, *r3
+dec *r3
+bne L215
+jmp *r0
+jmp L122
+mov #-256, L237
+
+rts
+rts
+rts
+
+dec L129
+sub L73, *r5
+stop
+jsr *r7
+bne *r7
+lea L46, *r2
+add #-245, r3
+L172: bne L218
+L173: cmp #-117, L62
+inc r1
+prn #-174
+mov #182, L4
+add *r4, r1
+L174: inc L186
+dec r0
+L175: cmp #-6, L134
+L176: .data 46, -544, 743, 993, -855, -913, -365
+prn L250
+dec L127
+prn *r6
+clr r1
+jmp L106
+L177: jmp *r4
+jmp L211
+sub r0, *r7
+rts
+stop
+L178: bne L97
+L179: rts
+not L40
+inc r5
+L180: prn #-224
+; comment
+cmp L20, L91
+not L251
+L181: lea L132, r2
+red L234
+dec *r1
+jsr *r7
+clr r3
+L182: add *r6, L149
+
+cmp L186, L26
+sub r5, r2
+inc r6
+
+L183: .data 678, -247, 722, -462
+stop
+stop
+sub r5, *r2
+prn *r7
+not r6
+inc r3
+rts
+
+jsr *r0
+dec r1
+mov r1, r0
+prn *r7
+L184: prn L123
+sub L108, r3
+jmp *r2
+stop
+cmp L185, #-210
+mov #216, *r5
+clr r3
+
+L185: stop
+clr L228
+prn *r3
+L186: rts
+L187: .string "gdxp"
+red r1
+sub L71, r3
+sub *r3, L209
+jmp L242
+sub #-51, *r4
+add #-124, L117
+L188: inc L115
+red *r4
+jsr *r6
+sub r7, L34
+dec L237
+bne L79
+bne L85
+mov *r6, r4
+L189: dec r0
+L190: bne *r0
+clr r2
+cmp L211, *r5
+red r1
+dec L0
+; comment
+add *r3, L53
+stop
+jmp L82
+cmp #179, #198
+lea L233, *r0
+sub r3, L202
+L191: mov #27, *r1
+L192: mov #-97, r3
+L193: prn r7
+prn *r3
+prn L54
+mov *r5, r6
+L194: .string "zt"
+
+lea L229, L183
+
+lea L217, *r5
+L195: prn r7
+mov *r3, L172
+cmp L258, L107
+prn #-226
+lea L212, r1
+L196: bne *r4
+; comment
+cmp r3, *r7
+lea L223, L197
+inc L16
+L197: .data 127, -248, -770, -580, -4, -450
+sub r0, *r2
+red L227
+jsr *r3
+L198: lea L15, r2
+rts
+L199: clr r6
+not r6
+mov L202, L20
+prn *r4
+inc L173
+dec *r1
+L200: prn *r0
+mov *r5, L240
+L201: mov r7, r4
+dec *r7
+L202: bne L235
+lea L230, *r1
+lea L156, r4
+stop
+L203: inc r0
+L204: .string "vtyyvwcphbfufqxb"
+L205: .string "rzmihvbmvicxdovjrznk"
+clr *r1
+dec L181
+not *r1
+L206: prn #-89
+L207: .string "yzanoowdinzztqj"
+cmp #-124, r6
+inc L16
+add #-209, r0
+inc r5
+rts
+bne L209
+cmp L224, r3
+L208: cmp #-182, r2
+bne *r6
+add r3, *r2
+L209: .data 755, 705, 775, 918, -89
+sub #-69, L220
+red *r6
+L210: .data 773, -711, -650, -191
+not L235
+jsr *r3
+L211: prn r0
+jmp *r4
+lea L215, L254
+not *r1
+red *r5
+L212: not *r3
+rts
+cmp #-170, *r7
+L213: red r6
+L214: jmp *r4
+rts
+cmp *r1, #-20
+sub r3, L25
+stop
+stop
+dec L113
+
+L215: rts
+prn #13
+jsr *r2
+not *r7
+jsr *r6
+L216: .string "rqj"
+clr r3
+clr r7
+jmp *r1
+jsr *r0
+bne L31
+cmp r3, #-206
+dec L81
+mov #183, L16
+add L249, r0
+L217: .data -753, 426, 750, 24
+L218: .string "i"
+stop
+not L103
+L219: jsr *r1
+L220: dec r4
+L221: .string "ndblpl"
+prn *r0
+clr r1
+rts
+stop
+mov L256, L159
+L222: .string "xxlxcmicpspsai"
+bne L69
+clr L240
+prn #71
+
+jmp L236
+clr L83
+L223: prn r7
+prn L251
+stop
+L224: clr *r0
+L225: dec L33
+L226: dec r2
+L227: mov r6, *r1
+L228: stop
+L229: inc L46
+lea L217, *r3
+L230: dec *r5
+clr L254
+lea L112, L43
+add *r3, *r4
+lea L236, *r3
+L231: .data 938, 375, -320
+L232: .string "vcovrbauwlh"
+add r2, L28
+cmp r0, r4
+prn L27
+inc L13
+rts
+prn *r0
+rts
+L233: dec *r2
+inc r6
+L234: cmp r3, r4
+stop
+prn *r7
+jmp *r7
+red r4
+jsr *r5
+inc r6
+
+L235: stop
+rts
+clr L264
+dec r1
+mov r6, r7
+L236: stop
+L237: not L69
+jmp L256
+bne L189
+inc r3
+prn #160
+L238: prn #81
+
+jmp L3
+dec r6
+L239: .string "hodn"
+L240: .data -893, 770
+cmp *r2, #221
+sub *r5, L24
+stop
+bne L151
+red *r7
+L241: inc L253
+cmp #-78, L6
+cmp r6, r3
+dec L212
+L242: mov #-65, *r1
+L243: cmp L249, #-247
+mov *r5, L247
+cmp *r0, L244
+clr r3
+sub L263, *r4
+lea L260, L247
+sub #-234, L248
+prn L83
+L244: .string "xxhcjxrnraodvusjt"
+lea L260, *r7
+prn r2
+L245: red L142
+inc *r7
+L246: .string "dgctlmnscquecypa"
+L247: .string "ygjwucihfkdwotbsttsseadi"
+prn r3
+not r1
+L248: red r4
+L249: bne *r6
+L250: add #-80, r4
+L251: dec L161
+L252: cmp *r1, L262
+bne L139
+dec *r3
+rts
+; comment
+rts
+L253: bne L7
+red *r2
+rts
+L254: not r7
+sub *r4, r4
+dec *r1
+mov r1, r7
+jmp L21
+mov *r2, *r7
+inc *r6
+red r6
+clr *r0
+inc *r7
+red *r0
+stop
+inc L263
+clr r3
+rts
+rts
+inc *r2
+not L15
+mov r2, *r0
+stop
+not L215
+cmp L119, #134
+jsr *r5
+clr *r0
+stop
+clr L215
+jsr L149
+L255: jsr *r4
+not r0
+clr r0
+L256: rts
+add #-105, *r5
+add L262, *r5
+L257: stop
+dec L262
+L258: .data -801, 259, 645, 911, -730, 992, 87, 337
+prn #233
+stop
+L259: sub r7, *r4
+cmp r2, L70
+jmp *r1
+L260: lea L262, r2
+clr r4
+prn r2
+add L66, r1
+L261: not r4
+sub #152, L68
+jmp *r5
+jsr L185
+stop
+jsr L232
+jmp L262
+inc *r0
+prn #-83
+inc r5
+lea L263, r5
+inc *r7
+L262: rts
+lea L189, *r7
+L263: .string "acaqwhjprcyxyqhmnrumdn"
+dec L264
+lea L264, r5
+L264: .string "x"
+clr r6
+red r7
+add r3, r3
+dec r4
+lea L168, *r3
+mov r1, L66
+bne *r7
+stop
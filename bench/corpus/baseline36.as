@@ -0,0 +1,1019 @@
+; Generated by genCorpus --seed 37
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+lea L172, *r7
+red r3
+red L4
+L0: jsr L116
+mov #-42, r5
+L1: sub L1, *r4
+L2: cmp *r5, r5
+lea L73, r6
+add #-34, *r4
+add #81, L20
+rts
+L3: clr L3
+L4: .data -62, 193, -788, -369, 772
+L5: cmp *r6, L201
+prn #-255
+L6: dec *r5
+bne *r0
+bne *r4
+add *r2, L178
+inc L179
+inc *r4
+clr *r6
+add r7, L54
+cmp L1, *r6
+lea L0, *r1
+L7: .string "o"
+not r7
+dec r3
+inc L129
+L8: .string "ctlduqytqxmnnjifemz"
+jsr L138
+add r6, L8
+dec *r3
+dec L5
+jsr *r0
+rts
+jmp L29
+L9: prn L9
+L10: .data -862, -799, -329, 342, 256, -326, -458
+red *r3
+prn L229
+L11: sub L11, *r0
+lea L12, r0
+L12: lea L41, r1
+jsr *r0
+not r7
+clr r1
+
+bne L104
+clr *r4
+rts
+L13: sub r5, L186
+stop
+jsr *r4
+cmp L8, *r5
+L14: inc r1
+L15: lea L115, *r3
+red r0
+dec *r5
+cmp #37, L154
+clr r0
+prn r4
+red *r3
+jsr *r6
+clr r5
+L16: cmp r1, r6
+
+L17: red L1
+cmp *r3, L71
+L18: jsr *r6
+prn #226
+sub L11, r3
+; comment
+dec r6
+rts
+lea L168, r2
+prn L11
+lea L196, *r4
+L19: jsr *r2
+dec r6
+red L141
+jmp L12
+clr r2
+L20: sub L211, L25
+dec r5
+dec L5
+L21: bne *r4
+L22: inc *r3
+bne *r7
+jmp L3
+lea L3, *r6
+red L4
+L23: jsr L18
+L24: sub #43, L103
+rts
+jmp *r1
+sub *r4, *r5
+L25: .data 996, 541, 393
+prn *r1
+; comment
+rts
+L26: bne *r7
+stop
+inc *r1
+stop
+red *r6
+L27: sub #62, r3
+red L72
+; comment
+L28: .string "xaddkstfhymqxmpavpfhgahb"
+L29: .string "yfcoyjkzhgvnxhfz"
+inc *r5
+dec *r1
+rts
+stop
+inc r2
+red *r0
+L30: sub L41, *r7
+sub r0, L214
+lea L33, r5
+L31: rts
+; comment
+L32: rts
+L33: bne L167
+inc L116
+stop
+clr L226
+stop
+L34: .data -2, -128
+clr *r2
+add #118, L28
+bne L85
+dec *r3
+prn *r0
+prn r0
+lea L239, *r6
+; comment
+L35: jsr *r0
+L36: red r0
+L37: prn r6
+L38: .data -33
+prn r7
+
+jmp *r1
+L39: dec L7
+dec *r5
+L40: not r3
+jsr *r6
+L41: mov L191, L97
+bne L39
+lea L228, r1
+mov r6, *r7
+L42: cmp r1, L29
+sub L34, *r7
+add r6, r3
+L43: not L39
+inc r5
+L44: .string "zcamrcpu"
+prn #-73
+; comment
+not r7
+add r2, L240
+prn #-67
+; comment
+sub r6, *r3
+jmp *r4
+inc *r4
+inc *r7
+not L79
+sub L57, L254
+jsr *r5
+not r2
+L45: sub r6, r2
+bne L197
+not L41
+sub #-107, r7
+L46: dec *r0
+rts
+add L27, L257
+sub L235, *r1
+sub r4, r2
+L47: mov r3, r5
+rts
+prn r6
+inc L60
+cmp r3, r5
+rts
+L48: jmp L166
+L49: .data -452
+bne *r1
+L50: red r1
+red L149
+not *r5
+bne *r5
+mov L26, r0
+inc *r1
+red r1
+cmp *r5, #-230
+L51: rts
+L52: .data 51, 63, -221
+L53: .data -718, -929, 445, -75, -400, -319, 646
+jmp *r1
+cmp *r5, #250
+prn r1
+bne *r1
+L54: cmp *r2, L52
+L55: dec r5
+sub *r7, *r3
+sub r1, r3
+L56: .string "nkmdohaviivdmzt"
+inc L99
+jmp L54
+rts
+inc r1
+inc L26
+; comment
+L57: stop
+L58: .string "nkierulq"
+prn r3
+L59: .data 232, -104, -459
+inc *r7
+jsr *r0
+L60: dec r3
+inc r4
+L61: prn L60
+dec r6
+mov r2, r7
+bne L15
+add r5, L33
+; comment
+L62: .data 856, 815, 187, -376
+jsr *r2
+L63: .string "vdhoakplmhqrkqdczwxnuzac"
+red r6
+red L188
+L64: red *r0
+L65: clr L10
+L66: mov *r2, L89
+inc L39
+mov L190, r0
+L67: red *r1
+prn #248
+prn L51
+cmp r5, #-202
+L68: lea L15, L21
+L69: mov #50, r3
+red r4
+lea L9, *r1
+L70: not *r4
+clr *r3
+jsr *r1
+stop
+add r7, r1
+clr *r4
+lea L164, r0
+jsr L52
+L71: mov #-90, L89
+L72: cmp L105, r4
+prn #-136
+jsr *r1
+L73: lea L59, L234
+L74: .string "inlfcflgdchgidtffns"
+red r0
+prn L25
+lea L42, r3
+cmp L14, #-136
+rts
+cmp L100, #-58
+stop
+rts
+bne *r2
+L75: sub r3, r4
+red L23
+L76: .data 753, -896, 973, -181, -30, 618
+bne L186
+L77: inc r2
+cmp *r1, *r6
+red L112
+L78: not *r5
+L79: .data -50, 66, -434, 812, -792, 302, -783
+prn r4
+L80: jmp *r3
+L81: sub L31, *r0
+add r5, L43
+stop
+bne *r7
+jsr L35
+L82: rts
+sub *r4, L200
+L83: .string "lvrbxhbmmehrxntwdeuo"
+L84: .data -894, 703, -95, -251, -862, 929, 695
+jsr L205
+L85: mov L14, *r7
+add #-93, r7
+L86: .string "neztdhzhn"
+L87: .data 606
+jmp L147
+red *r0
+L88: red L7
+clr L40
+L89: .data 839, -502, -337, 871, -495, -417, -622
+inc L95
+jsr L17
+jsr *r6
+inc *r0
+rts
+L90: lea L33, *r6
+dec r4
+bne *r0
+lea L227, r0
+L91: clr *r7
+L92: .string "hqdezwadytkxnepbknayg"
+stop
+add r1, L54
+jmp L67
+L93: lea L108, r1
+prn r1
+L94: .data -498, -937, 257, -205, 168, 809
+cmp L93, #81
+L95: prn r4
+stop
+
+mov r3, r7
+jsr L144
+L96: dec *r0
+mov *r1, r5
+clr r6
+clr r7
+jmp L135
+L97: dec L114
+sub r7, L96
+add L80, L144
+jsr *r7
+lea L93, L38
+stop
+L98: .data 441
+dec *r3
+jsr L71
+red r5
+dec r7
+bne L242
+lea L62, r3
+inc *r2
+L99: .data -110, 792, -276, 351
+jmp L144
+L100: .string "eengrb"
+L101: .string "qnaanovehvcfwymwlwwzytde"
+clr r2
+; comment
+red *r0
+L102: add #-157, r2
+rts
+inc *r6
+not *r5
+cmp *r6, #219
+red r7
+jsr L9
+lea L69, r7
+L103: cmp r7, #53
+L104: .data -98, -234
+not r4
+inc r4
+prn r4
+bne *r7
+
+mov #224, L57
+stop
+rts
+stop
+cmp #-81, *r0
+jmp *r5
+mov r2, L219
+L105: cmp *r5, *r4
+L106: add L11, *r3
+dec *r5
+not *r2
+jmp *r1
+L107: .string "syybezsavsynlulckxhsrht"
+mov *r6, *r3
+jmp *r5
+mov L227, L90
+clr L44
+rts
+add *r3, r4
+add *r1, *r6
+jmp L151
+lea L256, *r7
+L108: prn *r7
+L109: dec *r3
+jmp L195
+L110: prn *r1
+stop
+add *r2, r1
+jmp *r7
+; comment
+clr L233
+not L155
+prn r2
+inc *r5
+not r0
+
+L111: .data 101, 53, -558
+lea L52, L80
+stop
+
+L112: sub #-143, L10
+jsr L29
+L113: bne L127
+
+add *r6, r6
+not r5
+sub #207, *r2
+inc L75
+dec *r3
+clr *r6
+L114: .data 304, 654, -523, 364, -520, 411, -3
+mov L195, r2
+prn L99
+bne L216
+; comment
+lea L191, L232
+stop
+rts
+add *r1, *r1
+cmp #-219, #182
+red *r4
+L115: prn L102
+L116: bne L172
+red r6
+L117: inc *r5
+dec L140
+dec *r5
+red *r7
+L118: .string "x"
+stop
+L119: sub *r0, r6
+
+L120: cmp #-88, L202
+L121: jmp L93
+clr *r0
+stop
+add r5, *r6
+add #-87, r4
+L122: .data 642, 867, 539
+jsr *r4
+inc r5
+inc L246
+L123: cmp *r1, r2
+bne L60
+L124: mov #-11, L0
+red r3
+clr L8
+not *r6
+red L224
+mov L101, *r2
+rts
+inc *r6
+L125: .string "ociklikyfsshrbogz"
+not r3
+sub #-112, L201
+add L30, r2
+red L2
+L126: .string "qphghoisyklriqobbdzom"
+bne *r2
+lea L226, *r3
+mov r1, *r7
+inc L3
+L127: lea L49, *r2
+L128: .data 416, -671, 139, 487, 901, -855, 263
+lea L22, L232
+red L159
+add r6, r4
+mov L29, L63
+inc L247
+L129: .string "lanwaqqaqgqmdwkrdnxwh"
+not L211
+L130: cmp #-212, #-113
+L131: stop
+add r5, L128
+add r7, r5
+dec r6
+dec *r1
+cmp *r1, L101
+L132: prn #-93
+prn L90
+add #-77, L191
+prn *r0
+add L57, r5
+L133: mov r2, *r5
+; comment
+L134: .string "wlmtwf"
+; comment
+jmp L44
+add #-40, *r0
+dec L14
+add r6, *r4
+rts
+bne *r0
+add L169, *r4
+L135: .data -975, 350
+jsr *r3
+stop
+L136: sub L235, *r6
+L137: .string "paqwncefurzo"
+dec *r7
+inc L243
+bne *r2
+cmp #74, *r1
+jsr *r3
+L138: dec L97
+
+stop
+clr *r6
+L139: jmp *r1
+add L111, r2
+lea L9, *r4
+not L78
+mov #-141, *r6
+prn L164
+L140: .data 27
+add r7, r5
+sub L40, *r5
+L141: red L98
+mov #-9, L114
+jsr *r2
+cmp r0, *r3
+not L107
+jmp *r4
+bne *r0
+rts
+rts
+L142: .string "vnrrmhtmjhfcz"
+inc L223
+not r2
+not *r5
+bne *r4
+prn *r3
+
+dec *r6
+inc L175
+L143: .string "xxhvdcpkf"
+add #-165, r5
+lea L165, r6
+red *r5
+lea L58, r6
+sub *r1, L156
+rts
+jmp L105
+bne L150
+inc L30
+stop
+lea L215, L125
+L144: .data 452, 894, 57, -549, 227, -901
+L145: .data 105, 78, -938, -930, 18, 795
+; comment
+lea L49, L245
+not *r6
+L146: jmp *r0
+bne L156
+jsr *r4
+red L53
+L147: .data -677, 379, -650, 803, -215, 238
+clr L103
+sub L177, r2
+prn *r0
+clr *r7
+L148: .data -905
+inc L71
+; comment
+L149: stop
+L150: rts
+cmp r2, #-248
+red r5
+L151: rts
+clr L28
+sub r7, r2
+rts
+jsr L184
+jsr L247
+stop
+not L198
+L152: .string "negkhveoczrbi"
+jsr L42
+sub #-105, L199
+
+L153: bne L93
+sub L121, r5
+red r7
+L154: stop
+clr *r3
+lea L100, L168
+stop
+add r1, r2
+dec L42
+add L206, *r7
+mov *r6, r1
+red *r1
+L155: .data 468, -793, 874, -410, 17, 992, 51, 23
+L156: sub #-190, L183
+dec L128
+L157: clr r2
+rts
+inc L126
+L158: jsr L243
+stop
+red *r5
+jsr *r5
+red L224
+L159: .string "zgrasfwzjktgwfkyskkrrao"
+L160: bne L205
+L161: .data 819, 491
+
+stop
+not *r1
+inc *r5
+inc *r1
+dec r0
+mov #253, *r2
+; comment
+clr *r3
+jmp L49
+; comment
+L162: .string "lapkadobttexchiyw"
+inc *r1
+lea L97, r0
+red *r4
+bne *r6
+dec r5
+L163: add *r2, r6
+rts
+clr *r0
+stop
+bne L200
+; comment
+not L175
+L164: stop
+rts
+jsr *r4
+inc *r5
+L165: red L243
+red *r5
+clr *r6
+jmp *r7
+bne L151
+
+not r1
+mov r5, *r2
+L166: .data 691, 249
+L167: clr *r1
+bne L158
+inc *r4
+L168: .string "f"
+L169: bne L216
+L170: .string "ihonbswmlyzcnujobfs"
+L171: .string "t"
+add r0, L28
+L172: .string "wxcpklaiwwcyaoyouvp"
+lea L198, r0
+
+cmp #240, r7
+jsr L164
+L173: bne *r6
+dec r7
+bne L180
+dec *r6
+add *r2, r4
+prn L37
+jsr *r1
+red r2
+L174: .string "ijojikvfifhcxnxmjqt"
+not *r7
+; comment
+sub *r6, r2
+mov #45, r6
+rts
+L175: jmp L26
+sub r5, r0
+clr r1
+jsr *r5
+mov r0, *r3
+cmp L122, #173
+not *r7
+stop
+dec r0
+not *r3
+red *r2
+L176: rts
+inc L140
+dec *r7
+red r6
+bne L211
+jsr *r1
+jsr *r1
+L177: .data -90, 785, 663
+L178: not L30
+mov #251, r4
+add #222, *r5
+L179: sub r2, *r6
+mov r7, L230
+not *r3
+dec L48
+L180: .data 252, -923
+mov L149, r0
+dec r3
+; comment
+L181: .string "edkgwhqzltvnrscov"
+stop
+L182: add #-253, *r0
+add r1, L56
+clr r3
+lea L103, *r5
+L183: .data -452, 406, -689, 17, -483, 474, 205, -876
+; comment
+L184: not *r6
+L185: .data -181, 134, -591, 713, 395, 322, 119, -856
+bne *r4
+L186: mov r5, r0
+jmp L222
+L187: add #252, L189
+L188: jmp L195
+stop
+dec r5
+L189: cmp *r7, *r4
+
+sub #2, L215
+L190: red L254
+L191: sub *r1, *r1
+stop
+inc L206
+jmp *r0
+not r3
+; comment
+dec *r3
+stop
+jsr *r0
+L192: .data 595, -350, -111, 523, -396, -647, -10, -279
+not r7
+inc L122
+lea L5, L106
+prn r0
+lea L221, *r0
+inc L199
+red L198
+bne *r1
+jmp *r1
+sub #-123, L22
+L193: .string "fsbxubbjealdsouhfwn"
+jsr *r3
+jmp L233
+cmp *r4, *r6
+jmp *r3
+jmp *r1
+lea L209, L246
+not L218
+L194: .data -457, 876, -385, 890, 746, 984
+stop
+lea L198, r0
+jsr *r2
+cmp #-197, r3
+jmp L197
+jmp *r1
+L195: not L75
+bne L153
+L196: sub r7, L121
+L197: jsr L50
+L198: dec *r0
+lea L212, *r1
+L199: sub r3, r4
+dec r2
+L200: sub *r5, r5
+cmp r6, L14
+L201: .string "bya"
+rts
+jsr *r6
+sub *r2, L98
+L202: red L234
+L203: .string "w"
+bne L249
+dec L169
+red r5
+stop
+; comment
+L204: red L211
+L205: cmp #-181, #113
+L206: .string "hidxfcxbhifp"
+lea L149, r0
+jsr *r5
+
+bne L214
+stop
+dec r4
+L207: .string "uorpnhfxxive"
+mov *r6, r7
+L208: .data 492, -314, -271, 504, -528
+L209: not *r6
+L210: dec r1
+dec *r2
+inc *r3
+L211: inc r3
+jmp *r6
+add r4, *r3
+cmp L255, L227
+not *r7
+; comment
+add #-146, r1
+sub *r0, L62
+lea L43, r4
+rts
+mov #-243, *r5
+not *r2
+rts
+rts
+L212: red r1
+clr L227
+lea L249, L215
+mov L1, r1
+L213: .data -335, -115, -901, -656
+prn L230
+mov r6, r6
+mov L74, *r6
+L214: cmp #-108, #-130
+inc *r2
+L215: stop
+jmp *r3
+L216: .string "djdpdlpuwwrmmmqwytfsoqnu"
+L217: red L126
+red *r4
+prn *r2
+jsr *r6
+inc L80
+L218: .string "xtxkuzdxfj"
+L219: mov L252, r2
+sub #1, L165
+L220: .data 778, 749, 667, 393, -157, -935
+mov L194, *r6
+clr *r7
+clr r7
+jmp *r4
+inc r6
+jsr *r2
+jmp *r6
+mov *r2, r2
+jsr *r6
+mov L222, *r7
+red r0
+lea L158, *r1
+sub r0, *r3
+prn *r0
+jmp *r1
+jsr *r1
+clr *r7
+L221: .data -764, 205
+mov #134, L157
+L222: .string "jxwtajcdtohrz"
+L223: lea L115, *r2
+L224: .string "cqq"
+mov L209, *r5
+mov *r3, *r6
+cmp *r7, #131
+rts
+dec r4
+inc r1
+jsr *r0
+lea L238, r4
+L225: jsr L194
+stop
+mov r0, r5
+prn L136
+sub r2, *r7
+prn #166
+L226: .string "rmqbdhdq"
+L227: stop
+stop
+L228: rts
+rts
+stop
+sub r2, r7
+jsr L229
+prn r7
+lea L243, *r6
+stop
+L229: rts
+
+cmp L252, L61
+L230: .data -726, -241, 799, 678, 207, 123, 87, 396
+bne L259
+not r3
+not L253
+red r2
+L231: stop
+L232: .string "kbprogqml"
+cmp *r7, *r0
+L233: red L62
+L234: .string "onjtxitizrefabivojja"
+L235: .data -786, 889, 658
+cmp L255, #98
+rts
+mov #-188, *r3
+inc L45
+red *r5
+L236: lea L85, r7
+L237: mov L61, L45
+L238: bne *r5
+add r6, *r0
+; comment
+inc L239
+prn *r2
+jmp L217
+L239: jmp *r6
+L240: inc r2
+stop
+stop
+sub r0, *r7
+L241: .data 245, 479, -201
+prn #35
+clr *r1
+jsr *r6
+L242: cmp #-125, r5
+stop
+L243: stop
+dec r3
+bne *r6
+inc r3
+L244: .data -65, 953, 445, 92, 329
+L245: .data -78, -159, -184, 261
+L246: jsr L255
+clr *r3
+stop
+L247: red r1
+clr *r7
+dec *r3
+clr *r3
+stop
+cmp *r6, L90
+add *r1, r1
+bne L260
+
+jsr *r3
+jsr L153
+rts
+red *r4
+jmp L114
+stop
+mov *r1, r7
+L248: bne *r2
+
+; comment
+jmp *r2
+cmp L249, #222
+bne *r6
+not r2
+mov r2, r3
+L249: add #-198, L156
+add r2, r7
+stop
+inc L62
+L250: red L45
+mov *r7, L256
+not r2
+sub #154, L26
+lea L259, r1
+jsr *r6
+L251: dec *r4
+L252: .string "asdmqxjxsdngdaioqhcfkwg"
+dec *r1
+rts
+jmp *r5
+dec *r4
+sub L18, L23
+stop
+L253: add L19, r0
+stop
+L254: .string "dwthrmkxbhnlxagazccsfbb"
+cmp r7, L242
+L255: .data -607, -928, 12, 824, -140, -667
+red L43
+jmp L260
+not *r5
+
+sub #76, L257
+cmp L258, #33
+L256: .data -143, -55, -637, 312, -798
+L257: red L260
+mov L126, r1
+cmp r4, #228
+rts
+L258: .string "xbxafvdjoqzr"
+bne L167
+not *r3
+not L259
+dec r1
+jmp L259
+dec L259
+rts
+prn *r7
+L259: prn *r6
+dec L260
+L260: lea L1, *r1
+clr *r6
+add *r4, r1
+stop
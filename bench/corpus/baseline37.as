@@ -0,0 +1,1020 @@
+; Generated by genCorpus --seed 38
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+L0: .string "ecpklftkwsooqz"
+mov L61, L0
+L1: .string "xmecmpuoygzjzwvrea"
+inc *r1
+lea L199, L110
+dec *r4
+L2: .data 772, -858, -880, -258, 76, 697, -168, -360
+inc r7
+not *r4
+cmp #-167, #20
+L3: .string "pwclmizmszq"
+stop
+bne L0
+L4: dec r2
+red r6
+L5: bne L0
+rts
+bne L173
+red r0
+dec *r5
+L6: .string "ybkvbozqiuoeozq"
+not r0
+clr r1
+dec r5
+L7: .data -548, 231, 47, 940, -513, -532, 578, 947
+L8: add *r4, *r6
+not r2
+L9: .string "o"
+jsr L246
+jmp L180
+jmp *r6
+mov r1, L114
+inc L1
+red L8
+L10: lea L157, r4
+add #191, r3
+clr r7
+L11: add #248, *r3
+add *r7, L227
+
+stop
+bne L121
+; comment
+bne L5
+bne *r7
+jsr L25
+add r0, L6
+prn *r2
+L12: inc r0
+L13: red r3
+prn r2
+L14: prn #57
+L15: .string "vdvajtkrlbhqhl"
+mov #115, *r2
+; comment
+add *r2, *r0
+not *r3
+jmp *r7
+jmp L13
+L16: dec L0
+prn L16
+stop
+mov #-112, L4
+jmp *r5
+L17: lea L188, *r3
+; comment
+add #56, L17
+rts
+rts
+not r7
+L18: jsr *r7
+jsr *r1
+add L15, r1
+bne L220
+dec L1
+stop
+sub L11, r5
+red r4
+rts
+add #168, L0
+add r2, *r2
+cmp r1, *r4
+not *r3
+clr r0
+dec L136
+rts
+L19: not L1
+sub #14, *r6
+stop
+rts
+L20: dec *r2
+clr L57
+
+L21: sub r2, r6
+L22: jsr *r4
+add #154, L10
+L23: .data -694, 894, -734, -422, 424, 49, 857, -42
+jmp L135
+lea L20, *r4
+inc L180
+L24: red *r6
+lea L0, L9
+mov r0, *r0
+bne *r5
+red L10
+rts
+L25: .string "fglttspz"
+inc *r6
+L26: rts
+L27: clr *r3
+rts
+
+L28: .string "lnamiievgopkdkxouegemd"
+L29: prn #-123
+not r3
+prn L14
+jmp L39
+L30: inc *r0
+L31: bne *r4
+jsr *r4
+lea L270, *r7
+inc L18
+cmp *r5, L28
+jsr L39
+prn *r4
+jsr L17
+lea L17, L4
+rts
+L32: add #-176, r3
+inc *r3
+L33: .data -94, 954, 203
+cmp L5, #-235
+mov L47, *r0
+clr r1
+mov *r7, *r6
+stop
+mov *r7, L40
+sub *r1, r2
+L34: bne *r5
+L35: .string "e"
+not *r3
+L36: sub #63, L109
+stop
+add r3, L249
+L37: rts
+cmp L113, r5
+inc L168
+dec r2
+L38: prn L35
+clr L12
+jmp *r3
+L39: not r6
+stop
+dec r6
+clr r7
+L40: cmp #-29, r3
+jsr L270
+; comment
+L41: stop
+red r3
+stop
+L42: mov L2, r6
+bne L139
+prn r1
+not *r6
+L43: not *r6
+bne L6
+dec r5
+L44: jsr L33
+L45: inc r4
+jsr *r4
+L46: .string "lhajlhay"
+jmp *r5
+mov *r1, r7
+rts
+inc *r2
+sub #-32, r1
+mov *r3, L220
+jmp L11
+inc *r4
+red r2
+L47: stop
+; comment
+prn r5
+L48: clr *r6
+clr *r5
+red r2
+sub L16, r1
+clr L14
+; comment
+inc *r3
+jmp *r7
+clr *r6
+dec L252
+not r5
+rts
+L49: dec r7
+jsr *r0
+jsr *r2
+dec L209
+jsr *r2
+cmp L238, #-121
+sub r4, r0
+inc *r0
+lea L38, L3
+L50: add #180, *r0
+L51: .data 688, 920, 846, 516
+L52: .data -71, -44, -14
+L53: lea L74, L241
+L54: stop
+cmp *r5, #131
+L55: .data 144, -186, -779
+add L54, r3
+L56: .data 730, -738, 501, 802
+red *r2
+; comment
+red r7
+dec r7
+dec *r4
+L57: inc *r7
+L58: not r1
+prn L209
+cmp r0, r7
+not L146
+L59: prn *r1
+L60: .data 141, 339, -915, -327, 245, -981, 405
+prn *r5
+red L1
+L61: .string "hoondaux"
+L62: rts
+stop
+L63: .string "jbut"
+inc L268
+inc r7
+clr L10
+L64: mov L21, r0
+lea L171, L59
+clr L274
+clr *r4
+inc L228
+L65: add r3, L143
+red *r7
+prn L26
+bne *r0
+inc L49
+lea L15, r4
+clr *r2
+inc r6
+inc *r6
+L66: .data 958, 238, 587
+; comment
+lea L228, L11
+
+L67: prn r1
+stop
+prn #-156
+L68: not r6
+inc L128
+red L79
+bne L75
+not *r4
+
+bne L37
+jmp L64
+clr *r6
+rts
+L69: add L50, *r0
+red L158
+add L244, r4
+dec r7
+jsr *r5
+rts
+bne L22
+L70: mov L66, *r3
+stop
+dec r6
+clr r7
+L71: mov r5, L38
+dec r3
+add L26, L114
+L72: cmp *r2, *r2
+add #134, L236
+prn #190
+; comment
+L73: mov *r5, r4
+lea L152, L198
+L74: .data 975, 302, 330, -91, -327, 853
+L75: .string "bjg"
+L76: stop
+prn r4
+L77: .string "agkitooyasctpwkirdvroyf"
+cmp r4, r1
+dec L100
+inc L76
+add #-151, r6
+L78: lea L63, r3
+cmp *r3, #243
+L79: bne L78
+cmp #63, *r3
+L80: .data 515, 178, 958, -249, -624, -75, 907
+add *r6, *r7
+inc r2
+add *r6, *r5
+clr L105
+L81: cmp r4, *r2
+inc r7
+jmp *r2
+cmp *r2, *r7
+bne L32
+L82: mov #-238, r0
+jmp *r0
+not r7
+inc L1
+dec r0
+sub L191, *r1
+rts
+L83: bne *r4
+red L104
+jsr L19
+
+red L41
+L84: .string "fqhsvksnhrumof"
+L85: .data -719, 354, -890, -321, -644, 154
+jsr L63
+mov *r0, r2
+L86: .string "dlsfvmtazprpuizskypfewu"
+not *r0
+L87: .data -614, -267, 134, 554, 868, 716
+jmp L258
+clr *r4
+jsr *r2
+red r5
+L88: rts
+lea L42, r1
+jmp *r2
+stop
+lea L29, *r2
+dec r5
+jmp L21
+L89: .data 346, -825, 394, -389
+mov L83, L170
+clr L170
+jsr L7
+jmp *r6
+; comment
+L90: inc L264
+sub L226, r3
+L91: .data 422, 916, 249, -115, 331, 975
+L92: jsr L74
+dec r4
+L93: jsr *r7
+
+L94: add r7, r0
+jmp *r1
+mov L270, *r4
+bne *r6
+sub r3, L239
+bne *r0
+L95: .data 214, -807, -433
+; comment
+sub r2, L232
+
+red L150
+lea L148, r7
+cmp r0, L26
+sub #192, *r6
+prn #-80
+clr L96
+bne L115
+jsr L94
+sub *r0, *r7
+bne L26
+jsr L97
+sub #-103, *r3
+clr *r6
+inc *r4
+cmp *r7, *r1
+lea L129, *r3
+bne *r1
+cmp r0, *r3
+L96: .data -260, 427
+lea L99, *r1
+stop
+L97: red *r2
+prn r4
+cmp #206, #44
+sub r2, r1
+jsr *r5
+cmp r7, r5
+L98: .data -134, 217
+sub *r4, L4
+L99: .data 718, -741, 511, -291, -808
+L100: mov #-17, L43
+L101: .string "uhnu"
+not *r3
+sub L179, *r1
+rts
+stop
+clr L89
+L102: clr *r1
+stop
+jsr *r0
+red L88
+prn r6
+L103: bne L87
+rts
+rts
+L104: bne L109
+red L4
+L105: clr L38
+; comment
+rts
+jmp L167
+L106: red *r5
+add *r3, r5
+L107: cmp #98, *r1
+prn L48
+L108: add #45, r3
+L109: mov *r4, *r7
+L110: .data -196, 778, -692, 331, 19, -707, 829, -376
+L111: .string "bngxmuulioyzyohzlmbx"
+bne *r0
+bne L140
+stop
+L112: .data 362, -453, 882
+cmp #53, #180
+add *r0, r0
+L113: .data 223, -661
+mov r2, r0
+jmp *r6
+inc r5
+dec *r2
+L114: .data 659, 629, 34, -998, -366, 707, 817, -256
+stop
+L115: sub r1, r3
+bne *r7
+L116: dec L20
+L117: sub L48, L37
+add #-126, r2
+jmp *r6
+L118: cmp #99, #-180
+add L84, *r1
+cmp #-21, L150
+
+L119: .data -163, 82, 966, -213, 880, -717, -689
+add r6, *r0
+clr *r7
+clr *r0
+cmp #-231, *r3
+L120: mov L271, r1
+L121: .string "ze"
+inc L207
+clr *r3
+cmp L37, L269
+cmp *r2, r7
+red L70
+stop
+stop
+L122: clr *r7
+L123: stop
+stop
+sub *r0, L243
+bne *r1
+jsr *r3
+lea L175, *r6
+not r3
+red *r3
+cmp L3, *r2
+L124: red r2
+L125: bne L6
+cmp #-93, r7
+rts
+rts
+stop
+add *r2, r4
+L126: .data -132, 454, 16, 885, -367, 21, 664
+L127: .data 778
+lea L240, r0
+sub *r0, L223
+L128: stop
+L129: add #-172, L28
+L130: not *r4
+jsr L131
+; comment
+L131: .string "encoqffoxsv"
+L132: .data -493, 169, -78, 12, -659, 759, 249, 764
+rts
+bne *r2
+L133: rts
+
+
+lea L249, L170
+L134: prn L63
+prn r7
+prn L111
+lea L195, *r7
+L135: dec *r5
+prn *r5
+rts
+sub L91, *r2
+rts
+clr L92
+clr *r7
+cmp r5, r0
+add #200, *r6
+L136: not L130
+stop
+cmp #172, L183
+jmp *r3
+red L1
+not r5
+L137: sub r3, r3
+inc r0
+L138: jsr L50
+L139: stop
+L140: prn L159
+L141: .data -840, 927, 578, -487, 210, -889, 117
+bne L215
+L142: .string "hbvcvchwztmhzmjcolt"
+inc r1
+rts
+stop
+inc r0
+red L208
+jsr L91
+L143: .data 223, 968, 904, -31, -991, -36, 271
+rts
+L144: .data -129, 852, 366, 307, 465, 988, -603, 248
+prn *r0
+L145: .string "biivmktysjajxwewfowt"
+cmp #-234, *r7
+L146: prn r5
+mov L24, *r7
+dec *r2
+L147: sub *r6, r1
+sub r4, L117
+mov *r0, *r3
+L148: jmp *r1
+red *r4
+mov r5, L101
+L149: mov #-93, *r7
+stop
+bne L35
+jsr *r7
+dec *r7
+red *r6
+rts
+L150: .data 582, -586, 294, 714, 643, 530, 907, -210
+
+lea L243, L163
+jmp L171
+add *r3, *r1
+not *r2
+L151: .string "dubbnkrfanwhzeeytm"
+L152: stop
+prn r6
+
+cmp *r7, #-124
+inc r7
+L153: not L144
+stop
+stop
+jmp *r1
+dec r0
+L154: add r7, r5
+rts
+L155: dec L136
+not L139
+dec r2
+L156: bne L265
+L157: jsr L14
+L158: rts
+inc *r5
+dec r0
+clr r2
+stop
+sub *r0, *r4
+stop
+L159: not *r1
+prn L8
+stop
+stop
+red *r2
+inc *r2
+prn #168
+sub L134, *r5
+cmp #-74, r5
+bne *r3
+bne L70
+L160: .string "bkqxqgt"
+mov L234, r7
+sub *r1, *r4
+jmp L122
+rts
+jmp L110
+sub #154, *r0
+dec L269
+
+stop
+
+L161: .string "erlgqfxjaqhjyuinhvmbnimv"
+rts
+dec *r5
+L162: lea L225, r1
+L163: .data -897, -923, -767, 263, -17, -405
+dec *r1
+jmp L250
+L164: .data -170, -286, 279, 483, 783
+mov r6, L179
+add r6, r7
+L165: .string "qxseaemmrtbko"
+stop
+L166: bne *r0
+jsr *r6
+sub r3, *r1
+red L199
+dec r5
+not r0
+prn *r4
+prn L196
+jsr *r2
+stop
+add #132, L191
+red r5
+stop
+L167: stop
+L168: clr L106
+L169: .string "dzgjaphcgf"
+bne *r4
+L170: not r2
+clr L156
+L171: bne *r1
+L172: jmp *r1
+red r5
+cmp L17, r2
+L173: prn *r7
+lea L140, *r0
+inc L213
+stop
+cmp L151, r7
+bne *r2
+lea L223, L22
+stop
+L174: mov L218, L211
+inc r2
+sub r4, r0
+L175: .string "vkbhqcwqvomdjimv"
+L176: prn r1
+clr r0
+not *r6
+L177: bne *r2
+bne L232
+bne L107
+; comment
+; comment
+L178: dec L229
+bne *r0
+prn *r1
+mov L166, L178
+mov L26, *r1
+L179: red L117
+not L195
+stop
+L180: add r4, L116
+L181: .string "vhpgtwutrqvuirjqdlavkva"
+L182: jsr L131
+
+L183: .string "cwnaxfrwobzfaapcslnavvt"
+jmp *r7
+jmp *r4
+L184: dec r1
+L185: .string "tgqlisnwpxfsrxgfyvje"
+L186: lea L97, *r6
+inc L42
+not *r1
+inc r0
+L187: .data 199, -864, 262, -91, 73, 81
+red r6
+mov #104, *r7
+red L20
+jsr L13
+L188: red *r1
+inc r4
+mov *r7, *r5
+clr r0
+L189: add #229, r5
+L190: lea L81, L133
+lea L178, L264
+clr r7
+cmp L225, #36
+; comment
+lea L202, *r1
+cmp L154, r5
+inc r7
+add r4, r5
+add r1, *r2
+not r7
+lea L167, L28
+
+prn #-53
+dec *r5
+red r0
+add *r1, L210
+L191: lea L221, L71
+jmp *r0
+red *r5
+inc r1
+L192: prn r2
+lea L267, r5
+jmp L184
+dec r7
+clr L239
+rts
+clr L261
+inc r2
+sub #215, *r5
+mov #213, r4
+L193: .data -753, 643, 258, 10, -357, -972, -998
+L194: add r1, L138
+L195: .data -330, -25, -202, 415, -80, 685, 106
+prn *r1
+inc *r0
+L196: .data 362, 68, 250, 310, -250
+sub #53, r5
+rts
+L197: jsr L39
+clr *r6
+L198: .string "yvrebhfan"
+add r5, *r3
+jsr L275
+stop
+L199: jsr L124
+mov r7, *r7
+red *r2
+add L36, r5
+clr r3
+L200: .string "dczoxfipmndoxxxcokqwuw"
+not r6
+not r5
+mov L234, L215
+L201: stop
+L202: lea L238, L55
+red *r4
+L203: stop
+lea L194, *r0
+L204: mov #10, r2
+add L242, *r1
+L205: dec *r4
+rts
+red L242
+dec r3
+lea L180, *r4
+prn *r1
+L206: dec *r3
+red r1
+L207: .data -291
+jsr *r7
+mov r6, r3
+L208: jmp *r4
+jmp L241
+jsr *r2
+stop
+not r2
+mov L34, L234
+L209: .string "jkhflmhg"
+clr *r7
+L210: .string "ojqvqqqxuuafppia"
+add r5, L170
+
+prn *r2
+rts
+add r6, r7
+lea L191, L104
+dec L152
+jmp *r6
+prn L267
+dec *r6
+L211: inc L18
+cmp r5, *r7
+add #-175, *r4
+inc L254
+inc L256
+sub *r6, *r7
+sub #-54, r0
+bne L155
+lea L57, *r6
+L212: red L30
+L213: .data 980, -227, -613
+add #164, L221
+not *r7
+prn *r4
+stop
+L214: .data 568
+not *r3
+L215: cmp #204, #-234
+L216: jmp L273
+inc r1
+clr L140
+L217: .string "zehjsfbdjz"
+lea L253, L208
+dec L189
+jmp *r0
+bne L146
+clr *r6
+red r6
+bne L96
+L218: rts
+add L45, L237
+L219: mov #26, L145
+clr L266
+rts
+not L257
+dec L261
+L220: cmp L261, *r1
+sub #16, *r1
+red r7
+not r7
+rts
+clr r3
+; comment
+mov r2, r0
+sub *r3, L133
+sub L240, *r2
+L221: sub r4, r7
+add *r5, r3
+add #-84, L237
+add L160, r3
+clr *r6
+
+L222: .data 490, -628
+mov #80, r4
+stop
+lea L269, L69
+cmp L252, #-62
+inc L229
+cmp r0, *r5
+L223: .data -835, -958, -820, -959, 94, -905
+L224: sub L91, r7
+sub L171, r7
+L225: stop
+rts
+jmp L3
+bne *r5
+add L273, L63
+red *r4
+inc L273
+jmp *r4
+L226: .data -198, -914, -404
+L227: .data 810, 893, -264, 748
+not L85
+stop
+L228: jsr *r5
+L229: .string "aoqajrpurgjiimq"
+jsr *r1
+add L12, L127
+L230: sub r1, *r7
+add *r5, L237
+stop
+bne L273
+L231: add L52, r0
+L232: .string "hli"
+inc L149
+sub #113, *r3
+L233: .string "qvfmwqqxckkyhb"
+inc r6
+cmp *r4, L259
+L234: clr *r3
+
+L235: bne L124
+cmp #-161, r2
+jmp L59
+L236: .string "wjcbdgm"
+L237: stop
+mov r0, r7
+red r3
+clr r3
+L238: add r1, L73
+lea L244, L81
+mov #-202, r3
+L239: bne *r2
+add *r2, *r3
+rts
+clr r4
+jmp L235
+L240: red r0
+mov #-141, L273
+bne L251
+add r2, *r4
+rts
+L241: lea L253, r7
+L242: lea L275, r3
+L243: .data -807, 980, -657, -323, 485, 290, -739
+L244: jmp L252
+sub #-158, r6
+L245: inc *r3
+clr L131
+not L271
+
+red *r2
+L246: mov L250, L29
+lea L254, L273
+prn r0
+L247: .string "fmaxabmpwhpvkebrn"
+L248: red r5
+L249: lea L272, L266
+L250: jmp L237
+prn *r3
+; comment
+L251: jsr *r1
+dec r3
+add L262, *r7
+bne L271
+L252: add #26, r5
+lea L267, r6
+rts
+mov L48, r7
+jsr L211
+mov #239, r0
+sub r7, r0
+rts
+L253: clr *r2
+cmp *r6, *r7
+L254: not L263
+add #31, r3
+sub #-25, L227
+red r4
+bne L255
+L255: sub #-65, r1
+L256: .string "dtmdyxgfpsmcgamlswmef"
+mov L263, L262
+L257: .string "ezjlolwmonyfzdrhhgnkovzx"
+bne *r6
+dec L63
+L258: rts
+L259: inc L165
+prn *r5
+mov L260, *r7
+inc *r1
+inc *r2
+bne *r5
+bne L260
+L260: .data -810, 725, -221, -187, 816, 268, -501, 213
+L261: cmp *r3, L267
+dec *r4
+L262: stop
+dec *r2
+L263: sub *r4, *r2
+clr L269
+not *r4
+L264: .string "msllkjxqpq"
+not L170
+L265: .data -790
+L266: .string "lubhetu"
+clr r7
+bne L233
+L267: inc r7
+; comment
+prn #-80
+not *r4
+red L178
+L268: lea L275, r7
+bne L81
+bne *r6
+mov r7, L269
+red *r3
+cmp L269, L275
+L269: .data -279, -563, 91, 147, -680, -211, 609
+not r6
+L270: add #-137, r6
+clr r1
+clr r6
+
+cmp *r1, r2
+add *r7, r4
+lea L271, L274
+bne *r0
+bne *r6
+add *r3, r6
+L271: inc r7
+stop
+inc *r0
+jmp L6
+red *r7
+dec L272
+stop
+
+dec L125
+add L274, r1
+L272: bne L254
+L273: lea L21, r2
+not L3
+
+lea L56, *r6
+L274: stop
+; comment
+L275: stop
+red r5
+jmp L96
+cmp r1, #-23
+rts
+stop
@@ -0,0 +1,1019 @@
+; Generated by genCorpus --seed 39
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+bne *r6
+red r7
+mov *r1, r5
+not L189
+mov r7, L170
+add *r6, L108
+prn r2
+bne *r3
+lea L97, L32
+add *r6, *r0
+rts
+stop
+dec r6
+add r7, r0
+dec r3
+cmp *r0, L239
+stop
+jsr L102
+add r6, *r4
+L0: inc r3
+prn #2
+add #-17, *r5
+L1: mov L135, *r2
+clr L1
+mov #-45, *r2
+stop
+bne L164
+bne L259
+bne L0
+clr *r3
+; comment
+cmp *r5, r1
+add *r7, *r1
+stop
+clr *r1
+stop
+dec r6
+lea L201, L52
+L2: .string "q"
+mov #247, *r6
+jmp L186
+stop
+rts
+stop
+not r3
+inc L2
+bne L2
+L3: lea L143, r4
+jsr *r7
+inc L1
+L4: .data 833, -14, -145, 251, 666
+L5: clr L4
+red *r0
+prn #77
+rts
+lea L43, r6
+add r1, r5
+red r7
+L6: .data -406, -466, 250, 561, -994
+mov r7, *r7
+L7: bne L175
+add #-20, r3
+L8: .string "acysaapgdekjpeelb"
+L9: add L0, L63
+cmp L158, *r3
+L10: not r7
+L11: rts
+inc r7
+L12: lea L6, *r0
+L13: not r3
+not *r5
+
+L14: sub *r4, r2
+sub *r3, r5
+L15: rts
+L16: mov r7, *r0
+bne *r4
+jsr L115
+lea L5, r3
+add #151, *r6
+clr L84
+rts
+lea L29, *r0
+stop
+L17: mov #217, r2
+lea L7, r4
+cmp L48, r3
+mov *r3, *r2
+L18: add #-115, L8
+bne L12
+sub r5, r3
+stop
+mov #-91, L35
+rts
+prn L123
+cmp r1, r7
+L19: .string "fozukjgbwrskh"
+rts
+rts
+inc r7
+add L142, r3
+sub #63, *r4
+L20: red L16
+mov L16, r5
+inc r5
+jsr *r5
+lea L7, *r2
+stop
+red r2
+cmp r3, *r5
+dec r1
+L21: lea L5, L75
+L22: bne *r4
+prn r1
+inc L106
+jsr L11
+L23: .string "xwee"
+lea L15, r1
+L24: .data -775, 676, -123, -100, -742
+mov #217, r1
+L25: lea L0, *r7
+L26: lea L1, *r0
+dec L61
+jmp *r2
+L27: rts
+prn #86
+bne L55
+; comment
+add L13, *r3
+inc *r7
+prn L8
+bne L19
+lea L135, r6
+; comment
+rts
+L28: .string "ffbrdqhmq"
+jsr *r0
+L29: mov L3, *r5
+clr L22
+rts
+L30: add r1, *r7
+L31: cmp #-93, *r0
+L32: .string "ovbrdtmgczhsafaa"
+dec r6
+clr L171
+mov #-7, L15
+add L137, *r4
+prn *r4
+L33: .string "scqeufmqniizzinr"
+not r2
+not L3
+inc r1
+red L30
+L34: inc r1
+L35: cmp L153, r2
+red L19
+cmp r7, #25
+add r7, *r1
+mov L52, *r2
+rts
+clr L99
+L36: sub L148, *r0
+cmp r6, r1
+; comment
+mov #70, r3
+stop
+L37: .string "kygbuvjqbkmzeuuknnabl"
+rts
+jsr *r4
+L38: .data -315, 453, -440, -121, -794, -392, 702, 298
+cmp r1, L142
+stop
+red *r3
+red r5
+lea L30, r5
+dec L25
+L39: .data 860, -393, 8, 341, -732, -77, 867, 525
+L40: prn *r7
+clr *r3
+jsr *r1
+mov *r1, L39
+L41: inc L179
+mov #6, *r7
+dec *r4
+jmp *r2
+L42: dec r2
+jsr *r0
+L43: rts
+lea L3, r2
+mov L249, r7
+cmp #-184, #148
+rts
+prn #-188
+cmp r5, L247
+jsr L12
+prn L3
+prn #-26
+cmp L4, #-204
+lea L17, L26
+add r7, r6
+inc *r1
+L44: dec L24
+L45: not L32
+inc r3
+sub r0, *r3
+inc L149
+rts
+jmp L41
+clr r2
+not *r2
+cmp r5, L219
+dec r4
+stop
+L46: red r1
+red r3
+dec L11
+
+L47: jmp L220
+L48: sub #46, r4
+L49: .string "kfpcxly"
+stop
+jsr L17
+stop
+L50: .string "msppozhedixuisuruelbqkl"
+L51: jsr L31
+prn L247
+not *r7
+jsr L47
+rts
+L52: red L243
+jsr L27
+red *r5
+
+clr r6
+lea L31, r0
+L53: red L71
+prn r2
+inc r3
+prn #30
+L54: sub r3, r2
+L55: .string "mlzqkuqdchrlqogtomvxpv"
+red r1
+lea L34, L32
+mov L246, *r2
+rts
+cmp #-215, L117
+sub #-78, r0
+L56: sub L21, L87
+L57: bne *r4
+cmp #43, #-22
+jsr *r5
+L58: mov L44, *r3
+red r4
+prn #-159
+not *r5
+not r6
+L59: add #-123, *r2
+rts
+dec *r6
+jmp *r2
+lea L67, L32
+sub #-238, L141
+mov r2, r3
+red *r0
+L60: rts
+dec *r5
+stop
+inc r7
+red r4
+L61: .string "ertamjdlmicptogktjmztxuz"
+L62: prn #-27
+L63: prn #-7
+L64: stop
+dec *r2
+not L79
+rts
+L65: .string "c"
+bne *r2
+L66: jmp *r6
+L67: .data -423
+bne L187
+not r5
+bne *r7
+stop
+L68: not *r7
+; comment
+L69: clr r5
+L70: mov r1, L87
+L71: prn #9
+not *r0
+L72: lea L262, L44
+mov *r2, *r6
+stop
+L73: sub r7, *r3
+not *r6
+stop
+inc *r4
+clr r6
+cmp #97, #-166
+L74: .data -828, -467, 876, 179
+prn r1
+add L196, L101
+dec r4
+jsr L167
+sub L183, L45
+jmp *r7
+bne *r7
+bne L50
+cmp #179, *r6
+L75: not *r2
+inc r3
+not L246
+rts
+L76: bne L217
+L77: dec r0
+red r4
+L78: sub #4, L170
+add #-32, L3
+L79: red L98
+not L27
+lea L83, *r7
+mov L42, r7
+
+inc r0
+not *r1
+mov *r4, L21
+jsr L3
+L80: add #15, r7
+jmp *r6
+jsr L33
+stop
+lea L2, *r0
+prn #26
+prn L169
+sub *r5, *r1
+L81: rts
+L82: .data 582, -354, 126
+stop
+L83: prn *r5
+not L91
+mov L243, *r1
+L84: clr L118
+not L224
+inc L59
+L85: sub #79, r3
+L86: add r4, *r5
+; comment
+rts
+stop
+sub r4, *r5
+; comment
+mov *r4, *r3
+
+jsr L33
+cmp #97, L8
+bne *r0
+L87: not *r7
+jsr L178
+mov r6, r2
+dec L138
+L88: bne L226
+sub L37, *r2
+red r3
+L89: dec r0
+lea L217, *r1
+jsr L234
+not *r6
+red r1
+clr r5
+jsr L104
+sub r1, r2
+jsr *r4
+red r3
+L90: jsr L69
+mov #165, L41
+prn L47
+jmp *r2
+rts
+inc *r3
+inc L83
+stop
+
+prn r2
+not *r1
+add r6, *r5
+red L110
+jmp L26
+L91: lea L36, L197
+dec r5
+L92: not L136
+jsr L111
+sub r5, r3
+L93: add *r7, r0
+red L31
+mov #-104, L10
+; comment
+bne *r4
+add *r1, r5
+; comment
+rts
+clr r6
+inc r6
+cmp #-194, *r7
+L94: dec r6
+clr r0
+L95: dec *r7
+clr L80
+dec r6
+red L186
+L96: mov *r3, *r6
+lea L93, *r2
+lea L144, r4
+jmp *r3
+; comment
+cmp #68, #-170
+
+bne *r4
+jsr *r7
+L97: add r1, r4
+L98: .string "kjyjvfgzukyqmxejeddgv"
+cmp *r0, L225
+sub *r4, L234
+prn L36
+L99: .string "nirqbswclnnifevwxaacnyrp"
+L100: cmp L17, *r4
+prn L79
+mov #46, r1
+L101: dec L78
+add *r7, *r1
+L102: stop
+inc L161
+rts
+L103: clr *r4
+bne *r7
+sub *r0, r0
+stop
+L104: .data 385, -158, -387, -454, 347, -854, 323
+L105: jmp *r2
+L106: mov #-95, *r4
+L107: dec *r3
+L108: .string "rpyorybiewfjzthfnxy"
+L109: .data -237, -695, 420, 827, -721, -246
+add L226, L69
+add *r5, r5
+inc r3
+lea L133, L22
+jsr L121
+mov #-76, *r4
+L110: cmp *r5, *r5
+clr L55
+red *r7
+L111: clr L9
+L112: jmp *r6
+L113: cmp L181, #-225
+not *r4
+jsr *r7
+prn r0
+L114: prn #-125
+lea L39, *r3
+L115: mov *r4, r1
+sub #40, *r2
+L116: jsr L111
+L117: .data -35, -422, 115, 784, 139, -967, -824, 101
+prn L235
+jsr L144
+red L171
+cmp #-220, L85
+dec L70
+L118: clr *r6
+lea L228, L160
+add *r4, L26
+red r5
+mov L106, *r4
+prn #244
+L119: .data -82, -695, -246, -657, 277
+L120: cmp #172, #-32
+cmp #-212, r3
+; comment
+L121: .string "cydlgiqvbwsmeeadwsrl"
+L122: .data -540, -891, 963, -226
+stop
+mov r5, *r2
+prn L196
+clr *r3
+cmp L238, #28
+cmp #-201, L142
+L123: prn L260
+jsr *r5
+red r4
+lea L141, *r6
+L124: prn *r2
+clr r5
+lea L143, L150
+red r4
+L125: .string "yxadgdpuvy"
+red r1
+jsr *r6
+; comment
+add *r2, r1
+L126: .string "pjuwiq"
+dec r6
+L127: cmp r5, r7
+L128: red *r5
+prn L82
+dec r2
+sub *r5, r7
+red r2
+L129: lea L223, *r7
+; comment
+sub *r1, *r3
+L130: add r2, L210
+mov r7, r2
+L131: not *r3
+L132: lea L73, *r3
+L133: sub *r4, L171
+L134: .data 420, -234
+L135: .data -950, 883, -225, -209, 793, -499
+inc r0
+red r2
+; comment
+L136: .string "iyiyzx"
+cmp *r5, #22
+
+clr L117
+; comment
+prn *r5
+lea L231, *r5
+red *r6
+rts
+L137: rts
+inc r0
+L138: .data -432
+not r2
+L139: lea L54, r7
+cmp *r7, *r2
+stop
+rts
+L140: .string "zijvhpbcrvox"
+jsr L16
+stop
+rts
+L141: stop
+L142: .string "imekuxj"
+add r1, L74
+L143: lea L51, *r1
+prn L192
+L144: cmp L106, r3
+clr r4
+rts
+L145: jmp *r0
+sub *r6, r1
+not L157
+not *r4
+prn L67
+red L36
+jmp *r7
+dec *r6
+cmp L117, *r0
+L146: .string "nlqxknmqqzhkzqleejrmu"
+L147: .data 785
+clr r7
+prn #249
+stop
+L148: mov L211, r4
+jmp L234
+jmp L186
+; comment
+bne L89
+prn L141
+bne L155
+not r3
+not *r4
+L149: .data 969
+dec L166
+L150: .string "rtrevvkoxsd"
+cmp *r2, *r0
+rts
+L151: .data -299, -339, -577, 185
+bne L168
+; comment
+clr r1
+L152: .string "r"
+L153: .data -633, -383
+not L125
+add #148, *r1
+L154: rts
+clr *r0
+; comment
+lea L233, r3
+bne L238
+bne L97
+L155: clr L47
+jmp *r2
+clr *r3
+red L200
+L156: .data 709, -122, 700, 64, -527
+L157: prn r7
+bne L4
+mov #110, r5
+inc r1
+L158: .string "waayxxtrisytcwehzfp"
+L159: red L80
+lea L109, *r1
+jsr L45
+red *r2
+cmp *r6, #-183
+cmp r2, *r0
+jmp L191
+prn #-55
+L160: inc L260
+L161: lea L184, r5
+L162: jsr *r5
+L163: .data -120, 888, 450
+bne *r3
+mov *r7, r6
+add L186, L179
+clr L179
+L164: sub L148, *r3
+clr *r4
+L165: rts
+prn L6
+; comment
+L166: rts
+L167: jmp L19
+prn r5
+clr *r4
+rts
+inc L1
+lea L219, r4
+; comment
+; comment
+not L257
+L168: jsr L59
+L169: red r2
+bne *r0
+dec L194
+red L153
+jmp *r3
+stop
+bne L4
+mov r2, *r1
+L170: jsr L177
+add *r7, *r1
+jmp *r4
+
+; comment
+lea L135, L38
+L171: rts
+mov *r3, r0
+stop
+dec L254
+L172: dec r1
+rts
+sub L241, L177
+inc L236
+jmp *r0
+L173: cmp *r6, #161
+bne *r5
+mov L40, r0
+jmp L11
+clr L216
+sub L175, L164
+inc *r2
+
+jsr *r0
+dec r2
+L174: .string "htaykmvhchovvfrpylsqyyf"
+prn *r2
+stop
+add L186, L199
+L175: .data 260, -884, -784
+jmp *r5
+clr *r6
+add *r5, L95
+; comment
+sub r1, L200
+dec *r2
+; comment
+add *r7, r4
+L176: .string "qavjxhllsukfylkkqylau"
+sub *r1, L232
+stop
+L177: jmp L253
+stop
+stop
+rts
+lea L260, r2
+inc r3
+clr r5
+rts
+jsr L110
+cmp #-180, L243
+L178: bne L161
+clr *r3
+rts
+rts
+add *r3, L73
+sub *r5, *r7
+L179: .data -984, 246, -950, -70
+inc *r2
+dec r1
+rts
+jmp *r0
+lea L108, L217
+L180: .data -414, -378, -778, -961, 958, 94, 103
+L181: clr r3
+not *r1
+L182: .string "lzuytwhsxziijv"
+L183: prn r7
+lea L174, L77
+L184: prn *r7
+stop
+lea L227, r6
+clr *r0
+lea L71, L139
+stop
+L185: .string "iroi"
+dec r6
+L186: bne L59
+L187: add L218, r5
+
+bne *r5
+stop
+; comment
+
+L188: .string "rblhgnjmvzzuws"
+not L167
+L189: clr r2
+cmp *r1, r5
+inc L207
+clr L262
+L190: .string "fsdbfghvxnivvvegilplkn"
+bne *r2
+stop
+L191: not r5
+not L257
+add L111, *r2
+L192: rts
+rts
+sub *r1, r2
+sub r6, *r3
+clr r7
+lea L106, *r0
+jsr L261
+bne *r2
+L193: bne *r2
+L194: add r7, L257
+rts
+bne *r0
+prn L260
+dec r7
+stop
+L195: .data -75, 488, -316, 633, 910, -913, 678, -682
+jmp *r6
+stop
+L196: lea L107, L111
+mov #102, *r5
+L197: jmp *r7
+clr r1
+not *r6
+jsr L130
+not L235
+jsr *r0
+red r3
+L198: jmp L234
+mov #-212, L102
+sub L105, *r3
+L199: red *r2
+; comment
+L200: .data 750
+cmp L234, #3
+prn #-9
+L201: inc L233
+not L99
+clr L162
+inc L17
+L202: .string "cmypbclgvs"
+sub #209, L234
+L203: dec r4
+dec *r5
+add #-228, L217
+not r1
+cmp r7, L132
+L204: rts
+mov #-246, *r7
+not r3
+dec r0
+inc L128
+jsr *r7
+L205: .data 174, 469, 423, 57
+not *r4
+prn L256
+stop
+bne L216
+cmp #-247, r1
+prn #80
+red L220
+stop
+L206: red r3
+dec r6
+clr *r7
+L207: rts
+not r1
+not *r3
+clr r7
+cmp L249, #122
+dec r2
+dec *r2
+prn #144
+dec *r2
+L208: jmp L247
+dec L96
+L209: .data -626, 290, 365, -989, 880, -133
+inc L250
+mov L221, L224
+jsr L55
+prn r1
+L210: .string "dendzxofeuodgozfnwiab"
+dec L244
+inc L250
+bne *r0
+add #251, *r2
+; comment
+L211: .data -4, -637, -141, 939
+jmp *r5
+prn L192
+not L248
+clr *r2
+red *r0
+jmp *r6
+; comment
+not r3
+L212: red r2
+L213: not r2
+stop
+bne *r1
+clr *r1
+sub L242, r4
+add r5, r1
+inc r4
+L214: stop
+L215: .data 314, 254, -967, -689, 154, -163, 739, -581
+jsr *r1
+mov L238, *r4
+L216: sub *r7, r3
+clr L222
+not *r7
+lea L240, r3
+sub r1, *r3
+cmp r4, L251
+not *r3
+prn *r1
+stop
+prn *r7
+lea L248, r2
+L217: .string "hudseancsbimaoxmrp"
+stop
+
+L218: add *r0, L76
+clr L20
+
+
+not r3
+add #211, r3
+prn L4
+mov *r2, r4
+rts
+L219: .data 803, 889, 580, 940, -814
+sub r6, L262
+L220: lea L256, r5
+L221: .string "pnapzveicxxkbxeya"
+dec r6
+; comment
+L222: .data -227, 849, 611, -410, 499, 311, -740
+L223: not r0
+bne L73
+red L74
+not *r3
+L224: sub r2, r6
+dec r5
+L225: bne *r2
+red L255
+add #-189, r4
+mov #60, *r3
+L226: clr L59
+mov *r6, *r5
+; comment
+L227: prn #-18
+jmp *r2
+L228: bne *r5
+cmp r7, r5
+L229: cmp r4, #245
+add r0, *r0
+sub L73, r6
+sub #-91, *r3
+L230: .data 959
+mov *r7, r2
+add *r7, r0
+sub r0, r5
+rts
+not *r3
+add #153, r2
+mov *r2, L194
+not L251
+L231: inc *r3
+rts
+L232: .data 445, -923, 40, 830, -689, 799, -998
+L233: sub #-53, L196
+L234: .data 170, 401, -657, -899, 330, 279, -121, 910
+L235: sub r3, *r5
+prn #-175
+rts
+jmp *r7
+sub r6, *r4
+inc r6
+stop
+dec r7
+not *r6
+red r6
+not r6
+; comment
+bne L242
+cmp *r0, *r5
+L236: bne L16
+stop
+clr L227
+clr *r7
+not *r0
+L237: lea L131, *r3
+jsr L245
+L238: .data -773, -945, 447
+prn r2
+prn r1
+L239: clr L174
+mov #-135, r5
+jmp L243
+L240: bne L256
+sub *r1, r5
+L241: not r4
+rts
+prn r3
+not *r6
+add r1, r3
+clr L137
+jsr L259
+jsr L56
+L242: not r0
+L243: stop
+L244: .string "ssiignlmqpvooewpdmbmjddb"
+prn *r2
+bne L251
+red *r3
+L245: inc *r3
+dec r3
+inc r6
+stop
+L246: stop
+L247: mov #254, r5
+L248: stop
+L249: not L143
+L250: .data -184, -656, -200, -345, -832, -199, -453
+L251: stop
+L252: sub r5, r4
+lea L139, r7
+; comment
+cmp #13, #-108
+jmp *r2
+rts
+lea L137, L259
+lea L260, r0
+L253: bne L199
+add *r4, r3
+
+inc r1
+stop
+L254: red *r6
+jsr L260
+sub L168, L262
+mov r6, r0
+stop
+L255: .string "envbqslhhal"
+L256: .data -6
+not r6
+red L260
+L257: dec L94
+mov L258, r6
+add #93, *r4
+L258: lea L182, *r0
+L259: jmp L261
+red L153
+add L261, L36
+L260: .data 75, 720, 299, -952, 488, 323, -848
+L261: prn r6
+prn *r5
+L262: not r2
+mov r0, L160
+not *r1
+lea L153, *r6
+inc r1
+not *r6
+stop
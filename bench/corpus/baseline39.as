@@ -0,0 +1,1019 @@
+; Generated by genCorpus --seed 40
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+prn #86
+sub #-246, L102
+rts
+cmp *r0, #160
+dec *r6
+jsr *r1
+dec *r5
+prn *r4
+clr L11
+lea L80, r1
+prn #-241
+jmp L20
+inc *r6
+L0: dec *r4
+rts
+L1: .string "dxzbelbxxfwbbylaux"
+rts
+cmp L179, *r3
+clr *r5
+L2: clr L0
+prn L2
+L3: mov #74, r3
+not *r0
+L4: cmp r1, *r2
+jmp *r1
+L5: .data -801, -147, 797, 139
+prn #250
+jmp *r5
+L6: cmp L1, r2
+L7: stop
+lea L216, L236
+L8: clr L5
+bne *r3
+sub #-183, r0
+bne L164
+stop
+inc r4
+L9: .data 271, -254, 440, -371, 762, 413
+clr *r0
+dec L68
+sub L3, *r6
+prn *r0
+L10: prn *r6
+sub r4, L233
+L11: .data -878, -733, -749, 459, -537
+not *r2
+; comment
+L12: red L6
+stop
+not *r6
+L13: add *r3, L13
+cmp L91, #-42
+bne L4
+not r1
+L14: .data 245
+; comment
+clr *r4
+L15: .data -338, 760, -187, 919
+bne L15
+jmp L3
+L16: prn r6
+inc L83
+bne L0
+dec *r0
+L17: .data 918, -768, -845, 201, 798, 684
+jmp *r7
+clr *r1
+not L259
+dec *r3
+stop
+bne *r7
+L18: sub L7, *r6
+L19: not *r0
+L20: cmp #143, L92
+
+rts
+inc r7
+L21: .string "xawiylxvzrnurvtfoxob"
+not *r7
+add *r1, *r3
+L22: .string "nnlfycrku"
+mov L18, r1
+add #-9, r3
+L23: add L216, *r2
+add #206, r4
+cmp #-119, L95
+L24: .data 597, -864, -68, -940, -901, -759, -691
+red *r0
+mov r4, r4
+L25: .string "yruwwygsel"
+inc r6
+rts
+sub r3, *r1
+bne *r3
+inc *r2
+mov r6, L139
+jsr L24
+rts
+L26: red L2
+L27: .data -624
+jsr L40
+jsr *r5
+dec *r3
+inc *r4
+rts
+stop
+L28: red L255
+not r1
+clr *r7
+clr r5
+L29: jsr *r4
+lea L114, r5
+L30: not r1
+L31: bne *r1
+stop
+; comment
+L32: rts
+jmp L15
+stop
+L33: .string "xxyebhdveryawk"
+mov L202, r0
+L34: prn #96
+rts
+jsr *r3
+inc *r2
+red L23
+dec *r6
+rts
+mov *r2, r4
+clr *r2
+rts
+L35: .data 409, 194, 698, 186
+stop
+cmp *r7, r7
+L36: .string "jbdtsxpwnqve"
+L37: bne *r7
+L38: rts
+L39: add #15, r5
+clr r6
+L40: jmp *r5
+sub #-125, *r5
+dec *r5
+rts
+; comment
+jsr *r1
+jmp *r2
+clr r3
+red r2
+rts
+stop
+L41: inc L30
+L42: .data 122, 171, -756, -698, 836
+L43: .data -506
+add *r2, L11
+not *r0
+sub r5, L9
+jsr *r1
+L44: bne L127
+L45: sub #4, r5
+cmp r4, *r7
+stop
+not r1
+L46: jsr *r5
+L47: clr r5
+add *r6, *r3
+
+not *r5
+lea L6, r1
+L48: .data -733, -194, -646, -553, -945, 525, -631, 652
+L49: not *r6
+lea L261, r4
+L50: mov L19, *r4
+jsr *r1
+clr L200
+stop
+lea L73, L18
+bne L183
+
+rts
+red r3
+lea L261, *r7
+L51: .string "mlkdocdugvov"
+dec r6
+L52: mov #-112, *r2
+sub #9, r2
+L53: .data 22
+mov L45, *r6
+not L90
+jmp *r1
+inc *r5
+lea L247, r6
+L54: bne L86
+
+sub r4, *r1
+add #185, *r6
+L55: .data -918, -314, 392, 227, 338
+not L217
+L56: sub #-226, r0
+rts
+inc *r7
+L57: mov r7, L209
+not *r1
+bne L23
+not r0
+dec L259
+dec L56
+red *r5
+L58: jmp *r7
+bne *r5
+clr L44
+lea L29, *r7
+mov *r1, *r1
+bne L148
+not L35
+add #-131, L88
+clr r2
+L59: red L59
+mov *r3, r3
+rts
+L60: lea L115, r3
+L61: dec r2
+clr L118
+red r6
+L62: prn L218
+sub *r4, r2
+L63: mov #57, L3
+L64: .string "tkfjdkhiqrwqzeefalqdqdpf"
+sub L46, L19
+stop
+L65: red r6
+L66: lea L261, *r3
+not *r3
+lea L125, L8
+L67: prn r0
+red *r6
+lea L157, r7
+jmp *r3
+red r1
+L68: .string "ugoeazkjix"
+L69: sub #-97, L237
+L70: bne L7
+L71: add r0, r5
+dec r1
+bne *r0
+L72: jsr *r7
+L73: .string "pxakryzdplupl"
+jmp L72
+L74: inc *r7
+dec r0
+mov *r6, r5
+clr r4
+L75: rts
+sub L2, r7
+L76: .string "rld"
+L77: .string "dgnhdgmtjiuljzzdgmeiq"
+L78: .data 211, 778, -201, -990, 258, -592
+L79: mov #-251, r6
+prn r0
+sub r7, *r2
+add L55, L245
+stop
+bne *r3
+clr L43
+clr *r6
+L80: .string "zewkzatmhegsosqsxl"
+L81: .string "fboelapvgsescavzufinw"
+dec r1
+dec L121
+L82: .string "qlcpobefurekhamm"
+lea L70, L79
+L83: jsr *r4
+sub L161, L175
+mov *r5, *r7
+jmp *r5
+dec L197
+prn *r2
+jsr L226
+L84: stop
+sub *r3, L10
+L85: .data 988, 795, 584, 638, 106, -785, -364, -45
+dec L56
+bne *r2
+L86: add L30, r7
+stop
+L87: clr r5
+; comment
+L88: .string "l"
+L89: inc *r6
+stop
+L90: add *r3, *r2
+L91: lea L182, L29
+jmp L226
+L92: bne *r2
+lea L229, *r7
+L93: bne *r2
+mov L157, *r4
+clr r7
+clr L77
+L94: cmp *r0, r3
+mov *r7, r1
+bne L117
+jmp L56
+L95: red *r5
+not r0
+red r2
+cmp r1, #251
+clr L21
+mov #-148, *r6
+L96: .string "wqjbsaytqbsagyjwx"
+inc L116
+L97: bne L184
+jsr *r7
+L98: add #-179, L238
+red r7
+bne L123
+lea L211, L69
+not L113
+cmp *r5, r5
+red r4
+lea L70, L22
+L99: clr L192
+inc L20
+red r5
+bne L34
+dec *r5
+L100: cmp r0, L20
+cmp L88, L71
+jmp L149
+
+L101: .string "engqzqx"
+lea L220, L178
+bne L55
+L102: stop
+L103: lea L73, *r4
+L104: add L219, *r2
+red *r5
+red L63
+L105: lea L138, r2
+rts
+lea L20, r6
+
+inc *r5
+inc r5
+clr r6
+; comment
+not r2
+red *r1
+L106: .string "kglgt"
+L107: cmp *r2, *r0
+L108: jmp L148
+L109: mov *r7, *r4
+L110: prn *r3
+L111: jmp L100
+rts
+rts
+sub r1, r3
+mov *r3, *r2
+L112: bne *r7
+L113: jmp L125
+L114: not r4
+rts
+L115: add *r0, r3
+mov L81, r5
+jmp L112
+stop
+cmp L207, r5
+L116: jmp L4
+mov r0, r0
+L117: prn #-213
+L118: sub L209, *r2
+lea L113, L203
+L119: .string "gyvfijjujkv"
+mov L109, *r5
+L120: prn #-202
+dec r0
+jmp L15
+red L201
+add #128, L27
+lea L51, *r7
+mov L96, *r3
+jmp *r5
+sub L151, r4
+L121: jsr L44
+dec L43
+L122: red L188
+clr r4
+red *r5
+rts
+clr L68
+L123: .data -431, 419, -638
+stop
+add L239, L82
+L124: not L84
+bne *r6
+bne *r5
+lea L220, L232
+jmp L182
+L125: mov L78, r3
+not L120
+rts
+L126: cmp #185, #42
+inc *r2
+cmp L46, L76
+jmp L163
+red r2
+lea L182, r5
+bne L93
+add L4, *r2
+clr r6
+sub *r4, r3
+mov L241, *r7
+L127: .string "gamohrntugytfvga"
+L128: jsr *r4
+inc r7
+not *r1
+mov L52, *r1
+L129: bne L57
+dec r5
+L130: red *r4
+red r0
+bne L85
+clr *r6
+
+L131: clr r3
+clr *r4
+rts
+jsr *r4
+jmp *r5
+prn r5
+inc r4
+stop
+stop
+lea L173, L138
+L132: .string "xcdlflcuahhqrffnurj"
+rts
+bne L261
+L133: stop
+rts
+bne *r1
+sub L60, L187
+bne L144
+L134: add #-189, L170
+add #-125, L160
+L135: rts
+L136: .string "lwsvemr"
+L137: rts
+jsr *r2
+lea L36, r7
+jmp L61
+bne L256
+mov L124, r3
+cmp r2, r3
+lea L99, r4
+lea L19, L107
+L138: .data -698, 495, 940, 303, -361, -691, -712, -835
+prn #-229
+lea L199, L70
+lea L158, r7
+sub #67, *r3
+lea L251, r4
+clr r1
+; comment
+L139: .string "vmbuwjmsihrkzdrnbzsmtvg"
+add L133, *r5
+prn #174
+jsr *r7
+bne *r0
+L140: .string "aos"
+L141: .data 860
+mov L77, L208
+jmp L32
+bne *r5
+L142: sub *r6, L40
+jmp *r1
+L143: rts
+mov L50, *r4
+L144: stop
+clr L68
+L145: prn r3
+mov L37, *r5
+red *r7
+prn L164
+L146: red *r4
+L147: inc *r0
+rts
+L148: add #-52, *r1
+red L166
+sub r5, r4
+L149: rts
+lea L46, r0
+L150: bne L94
+L151: .string "fibcuomgwa"
+red *r5
+L152: .string "kj"
+lea L50, r0
+jmp L225
+prn r2
+clr L90
+bne L80
+jsr *r3
+dec L198
+L153: .data -103, -817, -489, 786, 151
+clr *r0
+not *r7
+L154: .string "xm"
+dec r4
+prn #-191
+L155: jsr *r3
+bne L7
+
+jsr *r3
+sub r2, r0
+jsr *r0
+add #-167, *r4
+L156: jmp *r2
+
+
+lea L173, L236
+L157: .data 661
+prn #59
+lea L38, r4
+jsr L140
+inc r5
+jsr *r2
+lea L10, *r1
+rts
+L158: jsr L200
+not r6
+jmp *r4
+L159: .string "a"
+; comment
+clr L209
+bne *r2
+jsr L87
+dec L86
+inc *r7
+L160: .string "mbpnsnsvxw"
+jsr *r7
+L161: prn L55
+clr r5
+not *r0
+lea L248, *r2
+jmp L150
+prn L76
+; comment
+not L242
+L162: not L250
+jmp *r2
+clr L238
+jsr *r7
+lea L69, *r6
+rts
+jmp *r6
+dec *r7
+prn r4
+jsr L85
+jsr *r6
+L163: cmp *r4, *r3
+stop
+dec L207
+lea L184, r5
+clr r5
+L164: add r3, r6
+lea L16, r7
+jsr L175
+jmp *r4
+mov r1, r5
+red r3
+mov #131, *r1
+lea L199, *r5
+sub r2, *r3
+L165: mov *r5, L62
+clr *r3
+stop
+sub #-153, *r0
+
+L166: stop
+not *r2
+rts
+L167: rts
+prn *r4
+L168: .data -861, 33, 592, 494, -145, -219
+clr L184
+prn #-5
+stop
+sub *r7, r6
+jmp *r4
+L169: .string "phnbmitngo"
+cmp *r7, r0
+not *r2
+jmp *r3
+jsr *r6
+L170: bne L192
+; comment
+; comment
+prn L211
+jsr L162
+L171: jsr *r0
+lea L171, *r1
+bne L91
+jmp *r0
+dec r5
+red *r1
+L172: .string "cslukppxdlnxjko"
+bne L166
+lea L202, L226
+red L253
+L173: stop
+jsr *r2
+red L211
+L174: mov r0, r1
+L175: inc r1
+cmp L187, L244
+
+L176: add L214, L131
+cmp r2, *r7
+
+clr *r2
+cmp r6, *r0
+; comment
+L177: red r1
+bne *r5
+not L108
+inc r7
+L178: inc r7
+dec r2
+dec *r2
+jmp *r6
+
+sub L100, L219
+L179: .data -219, -925, -143, -860, -298, -778, -42, 522
+inc *r2
+L180: bne *r7
+stop
+L181: red r4
+not L63
+prn #-109
+
+stop
+rts
+rts
+L182: .string "eevxdnzxicsmovdpapkclua"
+lea L215, r0
+
+not L80
+; comment
+jmp *r2
+stop
+mov r3, r0
+stop
+mov #183, *r7
+not *r1
+rts
+L183: bne L248
+not r5
+add #192, *r3
+bne *r2
+dec L18
+L184: jmp L219
+L185: rts
+mov r3, L261
+mov r6, L191
+jsr L140
+prn L37
+L186: jsr L186
+rts
+sub r5, r2
+stop
+inc r1
+not *r3
+bne L128
+dec r0
+L187: jmp L147
+not L45
+bne *r5
+rts
+clr L253
+mov L161, *r2
+clr L190
+stop
+L188: not r2
+L189: .data -453, 356, -174, 665, 22, -366, 444
+sub #240, *r3
+lea L249, *r7
+add #-19, L25
+prn r7
+not r3
+bne *r0
+L190: .data -466, -436, -453, -287, 513, 276
+L191: .string "wftoxjltke"
+L192: .data -471
+prn L39
+bne *r3
+lea L54, r7
+mov *r7, *r5
+stop
+lea L75, *r2
+rts
+add L230, *r1
+add #18, L236
+prn L181
+cmp #-64, *r1
+L193: clr L198
+jmp L244
+sub #-114, *r5
+jmp *r2
+jsr *r3
+cmp L139, *r0
+L194: dec L239
+L195: bne L261
+stop
+L196: not r1
+rts
+add r3, *r0
+L197: rts
+dec r4
+dec r7
+jmp *r6
+jsr *r4
+stop
+not r6
+prn L263
+sub *r3, L23
+prn L257
+red L195
+clr L153
+not r7
+jsr *r4
+mov #-49, r1
+prn r0
+jmp L113
+lea L111, L244
+L198: inc L211
+red r6
+red L246
+jsr L218
+L199: .string "buznvlnxqhkne"
+lea L237, *r5
+L200: stop
+jsr L236
+prn L42
+; comment
+L201: rts
+L202: .string "fyhjzldvmjzgfuxthquv"
+cmp #26, L222
+lea L237, *r6
+L203: jsr L243
+stop
+bne L55
+L204: rts
+L205: sub *r5, *r0
+dec *r3
+L206: .string "bukvscmppfltx"
+jsr *r7
+stop
+bne L121
+red L94
+clr *r5
+lea L262, L126
+dec L202
+lea L211, *r4
+not *r3
+inc r2
+L207: inc r7
+L208: .data -75, -738, -125
+stop
+sub r1, L143
+red r2
+lea L231, *r0
+prn L248
+dec r7
+; comment
+rts
+jmp L5
+stop
+L209: sub r7, L26
+red *r4
+stop
+jsr *r3
+rts
+add L257, *r6
+dec r4
+L210: .data 990
+add #99, r1
+rts
+lea L206, L180
+red *r0
+mov r7, *r2
+inc L264
+sub *r1, L245
+stop
+jmp *r7
+L211: bne L247
+stop
+sub #6, r0
+jmp *r0
+add L9, L239
+stop
+L212: bne L227
+L213: not *r3
+mov #-111, r4
+bne *r5
+stop
+lea L258, *r4
+sub *r1, L250
+rts
+dec L128
+red *r0
+sub *r5, L263
+dec *r1
+inc *r0
+bne L217
+lea L243, L197
+L214: .data 79, 966, 700, -363, -594
+L215: sub L231, r1
+L216: .string "xzzpw"
+jmp *r0
+clr L206
+L217: prn *r4
+L218: not r1
+cmp #43, #-91
+L219: .string "zglejbheutfolfim"
+add *r6, r5
+clr L32
+L220: .string "akbyjuz"
+bne L264
+cmp r1, L215
+L221: .string "jsvrnfjcearzcfuacspceyof"
+mov #-41, L240
+; comment
+; comment
+L222: jmp L29
+L223: stop
+dec *r3
+prn L258
+L224: .data -80, -493, 211, 795, -50, 963, 951
+L225: mov *r1, *r6
+rts
+jmp *r5
+L226: .data 925, 384, -769
+dec L65
+sub L56, L238
+add *r4, *r2
+clr L240
+mov #208, *r2
+red *r1
+sub #-113, L146
+clr L255
+L227: .string "hdsbibktkuhe"
+L228: inc *r1
+lea L222, *r1
+prn *r3
+red *r6
+bne L237
+mov #-238, *r0
+clr *r7
+L229: bne L181
+L230: sub L4, *r5
+sub L260, *r3
+jmp *r5
+cmp L66, #124
+prn L251
+prn L262
+cmp L80, r3
+lea L25, r5
+jsr *r7
+not L211
+inc r2
+mov #-57, *r2
+inc L241
+cmp *r3, *r5
+prn r7
+L231: cmp *r2, #189
+red *r4
+mov #119, L239
+not L20
+prn L164
+L232: stop
+bne *r2
+red L25
+L233: .data -112
+L234: rts
+L235: cmp r4, r7
+sub L203, *r1
+dec L238
+inc r1
+L236: sub *r5, r2
+red r6
+red L29
+bne *r7
+rts
+jsr *r5
+bne *r7
+L237: inc L238
+L238: .string "uciz"
+L239: .string "uelkjsze"
+L240: add *r1, L2
+jsr L9
+L241: sub L57, L89
+rts
+L242: .string "spvkfrtonpgkarwkjfzciq"
+inc L143
+add L174, L83
+lea L191, r6
+red *r7
+inc *r0
+cmp L259, *r2
+add L66, *r5
+not L152
+L243: bne *r6
+jmp L258
+red L251
+L244: inc r3
+dec r3
+add L88, *r5
+L245: dec *r4
+add L211, *r4
+stop
+L246: .string "ywkrif"
+sub L260, *r0
+bne *r7
+mov *r2, *r3
+L247: clr r1
+cmp L27, r4
+L248: red r3
+add *r4, *r5
+dec r4
+L249: .string "lry"
+dec r5
+cmp r1, #-68
+red r2
+dec L107
+L250: .string "wsqwhhgveugt"
+
+jmp L259
+
+L251: .string "k"
+bne *r6
+jsr L61
+lea L264, *r0
+jmp *r2
+lea L254, *r6
+jmp L260
+L252: .string "clswullmphpysfxitscel"
+not r1
+stop
+L253: not *r0
+sub L261, r3
+red *r3
+L254: clr L54
+mov r4, *r3
+rts
+L255: bne *r5
+prn r0
+clr *r1
+prn L257
+L256: .data 48, -730, -276, -265, 287, 463, 253
+L257: cmp *r4, #-199
+red *r0
+stop
+red r7
+jsr L71
+clr *r4
+
+cmp *r2, L246
+L258: red *r6
+jmp L19
+
+bne L79
+jsr L260
+dec *r5
+L259: mov r5, L96
+jmp *r4
+L260: mov r6, *r0
+dec *r2
+dec *r4
+L261: prn L263
+L262: red *r3
+sub r7, L30
+jmp L264
+stop
+not r5
+add *r3, L238
+prn #-28
+L263: bne *r5
+cmp #240, r1
+jsr L264
+rts
+not L191
+add L264, r5
+mov r2, r2
+stop
+L264: .data -872, 854, 864, -848, -654, -155
+
+bne L28
+rts
+rts
+; comment
+dec L157
+stop
+stop
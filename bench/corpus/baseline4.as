@@ -0,0 +1,1019 @@
+; Generated by genCorpus --seed 5
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+prn L47
+inc r1
+; comment
+stop
+L0: add #17, r7
+jsr L221
+rts
+inc L260
+sub L0, L140
+L1: sub *r2, *r2
+jmp *r1
+inc L0
+dec r1
+L2: bne *r5
+clr *r0
+stop
+clr r5
+bne L47
+jmp L0
+not L72
+lea L1, L221
+stop
+prn *r3
+dec r5
+cmp *r5, #-150
+L3: .string "fey"
+inc L251
+prn r2
+lea L80, r0
+bne L199
+L4: .string "iucdgksfjhmuqmmipsdm"
+stop
+red L1
+stop
+cmp *r7, #-19
+sub *r1, *r4
+rts
+lea L174, *r3
+dec *r3
+add #10, *r3
+lea L1, L2
+stop
+L5: .data 761, 972, 142, -109, 855, 561, -247, -353
+L6: .data -484, 980, 438, 957, 678, 487, -420
+inc *r3
+; comment
+L7: lea L1, r5
+mov #-107, r1
+mov r5, *r7
+prn r1
+clr L208
+L8: stop
+jmp L116
+red L0
+L9: mov L119, *r0
+L10: .data 72, 582, -663, -959
+L11: stop
+red *r7
+L12: jmp L1
+bne L38
+stop
+clr L150
+L13: .string "glrtkgppdolemejhhatfve"
+cmp #-116, L1
+; comment
+stop
+rts
+L14: stop
+lea L7, *r2
+add *r3, r7
+inc r5
+jsr L6
+not L8
+stop
+sub r3, r5
+red r4
+inc *r4
+L15: lea L50, r3
+prn r3
+L16: bne *r6
+lea L68, *r3
+bne *r3
+prn r1
+jsr L198
+sub r7, r7
+not *r1
+jmp *r5
+mov *r1, r1
+jmp *r6
+stop
+L17: stop
+mov r5, r1
+add r2, *r1
+bne *r6
+rts
+mov r4, *r2
+add *r7, L16
+; comment
+clr *r3
+prn *r5
+L18: jsr *r1
+stop
+jsr *r0
+L19: clr r1
+not *r4
+add #-219, *r6
+red *r4
+bne *r2
+add r0, L131
+rts
+jsr *r5
+inc *r5
+L20: clr L230
+prn r3
+inc r7
+prn #141
+L21: cmp L13, L80
+add L0, *r7
+L22: .string "wyajxrmtlbtxn"
+L23: .string "hlvnrumcfrctisdsmauarz"
+inc *r5
+not *r5
+prn #-246
+dec L243
+sub L146, *r6
+sub #252, *r2
+L24: .string "lnnibylet"
+mov *r4, *r2
+jsr *r1
+red *r3
+rts
+lea L3, *r6
+red L195
+rts
+sub r5, L11
+L25: jmp *r5
+dec *r7
+L26: lea L12, *r1
+sub *r6, L19
+lea L94, *r6
+
+dec r6
+lea L190, L4
+L27: .data -818, -358
+add #-59, r3
+inc r2
+L28: inc *r5
+stop
+clr L142
+lea L3, r3
+rts
+jmp *r6
+rts
+not r4
+cmp r0, L0
+jsr *r4
+not r6
+sub r6, *r0
+clr r7
+L29: dec L56
+L30: sub L192, r7
+L31: red r2
+rts
+L32: .data -296, -392, 905, 487, -373, 86
+prn L51
+rts
+L33: .data -272, 931, -961
+not L159
+prn #-87
+stop
+dec r4
+sub r5, r7
+not *r3
+prn L28
+L34: .string "fmozygmzxdxbjhlxoflqdzna"
+sub r5, *r0
+red *r7
+L35: .data 178, -939, -689, 263, 990, 604, -544, 344
+L36: jsr L201
+L37: prn *r0
+L38: .data 992, 551, -24, 965, 268, 113
+L39: .string "dq"
+dec *r0
+not L30
+cmp L60, L44
+L40: bne *r7
+not L261
+sub L172, r3
+lea L39, *r6
+L41: .string "kqwaqkglrphkzsg"
+rts
+inc r7
+clr *r4
+; comment
+L42: .string "gmtgtpjmjgsjugkdcto"
+L43: clr *r5
+L44: bne L33
+prn r5
+red r2
+stop
+jsr L11
+L45: dec L175
+L46: bne L103
+not r0
+L47: .string "czu"
+L48: bne L67
+add *r6, L35
+L49: dec r1
+L50: sub L19, *r6
+not L240
+L51: .data 190, -1000, 338, -148, 394, 668
+stop
+prn r6
+not *r1
+; comment
+inc *r0
+L52: lea L111, L110
+jmp *r5
+L53: rts
+add L50, r0
+inc r4
+inc L218
+add L258, *r3
+bne L186
+jmp L8
+red r0
+add r5, r7
+L54: inc *r2
+L55: .string "uyt"
+stop
+cmp r2, r2
+L56: .data 992, 624, -753
+not L49
+mov L34, L51
+dec r6
+dec r0
+clr L3
+dec L86
+L57: .string "jmjyhbkxmdkwxgkbl"
+; comment
+L58: stop
+sub #227, *r6
+L59: bne L104
+add r5, *r0
+
+L60: sub L236, L228
+L61: rts
+jmp L18
+prn *r6
+prn r1
+bne L39
+cmp r7, L40
+lea L177, L55
+
+bne L12
+rts
+stop
+sub *r2, *r0
+add #-243, *r7
+jmp *r6
+L62: .data -860
+prn L80
+L63: .data 49, -441, -480
+cmp *r1, *r5
+clr r7
+cmp r7, L113
+L64: cmp #-110, r5
+inc *r1
+L65: jsr *r1
+jsr L33
+stop
+L66: lea L162, L47
+cmp r7, #-60
+add r4, L256
+bne *r4
+bne *r6
+L67: red r2
+prn #-88
+L68: mov L26, *r7
+jsr L116
+L69: cmp r6, *r0
+red r1
+L70: lea L172, *r5
+lea L43, *r2
+L71: red *r6
+not L133
+inc L173
+mov #27, *r4
+L72: not L95
+dec *r4
+cmp L74, r4
+dec L61
+bne *r3
+L73: rts
+jmp L72
+prn #88
+add #-106, L26
+inc *r6
+clr L13
+red *r7
+bne L101
+mov L163, *r7
+
+not *r2
+bne *r4
+L74: not L42
+dec *r0
+L75: .data 820, -993, -92, 808, 657, -708
+L76: stop
+dec *r3
+add r0, *r1
+mov L67, *r0
+not r1
+stop
+add *r6, *r4
+L77: red L84
+jsr L69
+cmp #-44, r7
+; comment
+L78: .string "wctmhjskafxiwpro"
+lea L95, L36
+dec L6
+bne *r7
+clr r7
+L79: inc *r3
+cmp r6, #192
+jmp L41
+rts
+sub L53, r0
+add L12, r7
+bne *r2
+
+clr L52
+
+L80: cmp r1, L22
+
+dec L174
+clr r4
+sub #-101, r5
+L81: lea L6, *r3
+bne *r5
+L82: .string "vogclndtwqmwmqker"
+prn *r4
+L83: dec *r5
+jmp *r5
+lea L218, *r4
+lea L51, L8
+bne *r0
+clr r4
+add #184, *r5
+jmp *r5
+dec r2
+L84: .string "rlixscumzv"
+
+sub #156, *r2
+stop
+L85: lea L90, L31
+rts
+jmp *r2
+L86: .string "bksco"
+inc *r0
+L87: bne *r0
+add L247, L47
+L88: red *r4
+add r1, r7
+lea L46, L27
+not r5
+not *r1
+L89: not *r0
+dec *r3
+add *r3, r4
+mov *r7, *r2
+prn r0
+prn *r2
+clr *r5
+clr *r0
+not L166
+rts
+jmp *r6
+jsr *r3
+red *r6
+dec r6
+L90: sub *r5, *r5
+bne *r4
+jmp L2
+L91: not *r5
+stop
+L92: not L260
+rts
+prn #88
+L93: inc *r6
+sub *r7, r0
+rts
+not L173
+L94: jmp L224
+cmp L72, L71
+mov #-9, r5
+L95: cmp #-241, L156
+sub r6, L157
+add r4, r3
+stop
+L96: add #-120, L192
+rts
+not *r4
+L97: .data 255, -701, -434, 94, -488, 559, 285, -69
+prn r6
+bne *r6
+L98: mov #187, r6
+L99: add *r0, *r4
+prn #-61
+L100: add *r7, *r3
+stop
+L101: cmp L62, #197
+inc *r7
+L102: clr L111
+L103: sub #206, L128
+mov #130, L61
+L104: .data -30, -344, -948, 605, -537, -565, 661
+; comment
+L105: rts
+not L104
+jmp L71
+prn #-96
+add r2, *r1
+L106: bne *r4
+L107: .data 777, -679
+lea L75, r4
+dec *r3
+L108: .data 526, 29, -717, 529, -644
+L109: red L25
+dec *r6
+lea L141, *r3
+L110: cmp r0, #-221
+L111: red *r6
+mov r7, L73
+lea L262, r5
+dec *r4
+stop
+rts
+L112: .data 509, 767, 86, -244, -234, -980
+mov r6, r6
+L113: dec r4
+L114: red L56
+inc L249
+L115: jmp *r0
+lea L202, *r7
+rts
+cmp #-91, #238
+lea L164, r1
+jsr L195
+L116: .data 252, 224
+stop
+prn r0
+add *r3, r2
+lea L42, L214
+L117: add #-210, *r2
+L118: .data 967, -733, 109, 188, -766, 723, 947, -381
+bne *r5
+rts
+bne *r0
+mov #20, r2
+sub L119, *r7
+jmp L136
+bne L126
+sub #43, *r0
+sub #-189, L176
+L119: .data 491, 417, -825, -416, -829, -559, -719
+L120: not *r5
+lea L50, L31
+jmp L149
+bne L64
+L121: dec r7
+L122: mov #-91, *r3
+L123: .string "exuuguxs"
+bne *r2
+; comment
+add r4, r5
+L124: not L203
+L125: red *r5
+rts
+prn r0
+L126: rts
+prn r4
+red r5
+bne *r6
+clr r7
+jmp *r5
+L127: not r1
+not *r2
+L128: prn *r0
+bne *r3
+L129: .string "odbiq"
+jsr L179
+jmp L181
+jsr L250
+cmp *r4, L104
+not *r3
+jmp *r0
+L130: bne L245
+add r7, *r4
+bne L12
+L131: bne *r3
+L132: mov #254, L60
+stop
+L133: red *r2
+; comment
+L134: sub L207, r0
+L135: .data 117, 732, 332, -878, -305
+stop
+stop
+rts
+clr L150
+jsr L10
+L136: .string "socgqzq"
+mov r0, *r5
+L137: red *r0
+L138: .data 605
+cmp r0, L173
+clr L171
+stop
+lea L159, r3
+L139: jmp L254
+mov #86, L17
+L140: jmp L197
+jsr L178
+not r7
+inc L88
+L141: jmp L255
+L142: lea L149, L16
+jmp *r0
+dec *r7
+L143: .data -986, 423, 168
+L144: clr r4
+L145: dec r6
+L146: red L131
+cmp r3, *r2
+inc L112
+jsr L223
+stop
+jmp L45
+not r4
+stop
+L147: .string "icvb"
+inc r3
+L148: mov L18, *r1
+red *r6
+add #-237, r1
+not *r3
+; comment
+mov *r5, L116
+rts
+dec r2
+mov L252, L224
+sub L4, *r5
+inc L240
+not r4
+L149: clr L203
+cmp r3, r7
+lea L244, r3
+
+inc *r1
+rts
+inc *r4
+L150: lea L3, L246
+L151: red r0
+jsr *r0
+L152: prn L41
+lea L184, r5
+; comment
+stop
+cmp #192, r4
+dec r1
+L153: jsr L25
+prn L26
+stop
+L154: prn r0
+; comment
+L155: .string "eacueyclynpvwswsfoganst"
+; comment
+add *r2, *r7
+add #32, L167
+; comment
+; comment
+jsr *r4
+add #99, *r7
+jsr L190
+jmp L42
+sub L20, r6
+L156: inc L99
+dec L233
+lea L262, L28
+prn #59
+L157: lea L249, L254
+jsr L174
+prn *r2
+jmp L221
+red *r7
+jmp L143
+L158: .string "eqcjlgheyffohwu"
+rts
+L159: .string "aerlyyntaqolfmxjzzrv"
+; comment
+stop
+clr L60
+bne L59
+sub *r7, L43
+jsr *r5
+cmp *r3, L135
+not L96
+red L31
+add r4, r1
+sub L241, *r3
+clr L102
+jsr L157
+clr L259
+clr *r4
+L160: .data 234
+L161: .data 30, 351, -691, 740, 119, -806, -764
+L162: stop
+dec *r0
+L163: mov L35, r5
+lea L158, L36
+rts
+red r1
+L164: bne L186
+red r0
+prn *r7
+not *r7
+mov *r2, r2
+sub r1, r4
+L165: lea L209, *r6
+; comment
+clr *r7
+red *r0
+dec r6
+red L201
+L166: lea L99, L240
+L167: sub r3, *r7
+lea L230, r2
+not *r4
+L168: sub #32, *r0
+jmp L214
+not r2
+not r3
+clr *r6
+bne L120
+L169: mov #-146, r0
+bne *r1
+not r1
+L170: lea L202, r6
+jmp *r7
+dec r6
+prn #126
+L171: stop
+cmp L239, r4
+L172: cmp *r0, *r1
+stop
+L173: red *r3
+cmp *r0, L248
+; comment
+sub #-204, *r2
+L174: .string "pnmawkqvqx"
+L175: add #-227, r4
+L176: .string "fqz"
+L177: .string "mjbn"
+dec r2
+lea L41, *r2
+; comment
+mov *r3, r5
+L178: lea L223, *r0
+L179: prn *r2
+rts
+L180: stop
+jsr *r6
+not r7
+L181: .string "etzptomudtsznenkrck"
+sub r2, r6
+stop
+dec L197
+lea L241, r4
+sub r3, *r0
+lea L248, L62
+L182: cmp r1, r4
+L183: .data 32, -955
+; comment
+rts
+L184: sub L127, r7
+
+lea L121, r3
+add *r5, *r2
+L185: rts
+mov #-178, L207
+sub #207, *r5
+jmp *r5
+dec r0
+cmp L231, L6
+lea L111, r3
+red r6
+L186: cmp L245, #-210
+stop
+L187: .data -600, 196, -502, 655
+lea L85, L21
+inc *r0
+jsr *r5
+jmp *r7
+dec r5
+; comment
+sub *r4, *r2
+not L12
+prn r7
+jsr L169
+dec L212
+rts
+L188: .string "zsz"
+stop
+L189: bne *r0
+clr *r7
+add r5, *r7
+; comment
+sub #30, *r3
+add *r6, r7
+mov *r7, *r6
+prn #21
+clr L99
+cmp r7, r0
+L190: sub L223, r5
+sub #238, *r2
+dec r4
+not *r1
+L191: inc *r1
+L192: mov *r0, L176
+L193: .data -981
+inc r3
+lea L230, L152
+stop
+L194: lea L206, L105
+L195: sub L185, L48
+stop
+L196: lea L169, L209
+L197: bne L100
+red r6
+rts
+clr L147
+L198: .string "puiztsmplagkfnz"
+L199: dec L202
+lea L127, *r6
+red L261
+L200: clr L56
+clr L25
+; comment
+red r0
+L201: .string "ezydstq"
+sub L235, L248
+
+L202: lea L57, *r5
+L203: .string "rzuoskhleljxk"
+L204: .data -605, 953, -463, 378, 239, -15, -454, -186
+dec r6
+; comment
+red r7
+L205: add #-174, r3
+add #7, L257
+prn r7
+stop
+add #-37, r4
+sub r2, *r3
+sub *r3, L251
+mov #68, L146
+L206: .data 878, -924, -339, -155, -986, -642, -412
+L207: jsr *r1
+inc r3
+cmp *r4, r5
+sub r4, L210
+stop
+rts
+L208: .string "xhngtd"
+stop
+add L210, L158
+L209: mov *r1, L88
+rts
+
+prn *r6
+clr r1
+L210: sub #-238, r6
+L211: .data 919, 454, -562, -217
+L212: cmp *r6, r7
+bne *r5
+mov *r5, r7
+cmp L91, r3
+red *r1
+L213: dec L226
+
+L214: .string "sslzcymivgnm"
+rts
+red r2
+L215: .data 480, -244
+L216: stop
+stop
+L217: .string "kte"
+prn L218
+stop
+jsr L233
+sub r1, r3
+dec L244
+; comment
+L218: .string "rxcjqwbidfyrupfrkeeksv"
+inc r7
+jsr *r0
+prn L98
+dec L250
+L219: .data 326, -176, 382
+L220: mov #-227, r7
+L221: stop
+jmp *r7
+jsr L251
+red r0
+; comment
+lea L208, L49
+jsr *r3
+dec *r3
+L222: .string "kljhfawwtiryj"
+jsr *r3
+L223: .string "bvtvxzlvxsnyyszzbbuiam"
+L224: bne L245
+not L117
+prn #131
+stop
+mov #-160, L254
+sub L250, r7
+rts
+mov *r1, r6
+jmp *r6
+lea L216, *r1
+red L260
+jsr *r3
+L225: jmp *r6
+clr *r5
+cmp #201, *r0
+sub #-228, r5
+L226: cmp L168, r6
+L227: red L248
+; comment
+lea L237, r5
+L228: add L138, r7
+cmp #-5, r6
+L229: jsr *r6
+dec r4
+L230: not r4
+bne L92
+L231: .data 903, 648
+L232: jsr *r0
+lea L246, *r2
+not r2
+red *r7
+prn *r7
+lea L242, r6
+L233: .string "kesbcpjdyq"
+sub #137, r6
+L234: .data 99, -54, -215, 941, 250, 272, -85, -570
+cmp L145, r1
+stop
+L235: .data 475, -333
+; comment
+L236: .string "fbspuhuksccgrksoskbw"
+L237: .data -834, -289, 491, -894, -552, -631, -696, 98
+prn *r0
+bne *r1
+; comment
+bne L134
+L238: .string "bswksoztikucodjyvpo"
+inc r0
+; comment
+L239: .string "zxrlcptdzuumbnb"
+jmp *r5
+red r2
+prn L250
+L240: .string "snaanamjaic"
+L241: add #-159, *r6
+L242: clr r5
+dec L262
+prn L254
+L243: .string "imzhamrjgeihxfsjez"
+rts
+clr *r2
+clr L79
+cmp *r7, r5
+L244: lea L247, L80
+rts
+mov r6, *r5
+lea L252, *r5
+mov L260, *r1
+prn r6
+L245: stop
+L246: cmp *r3, r4
+jmp *r0
+clr r7
+add *r5, *r4
+jmp L136
+cmp #-180, r3
+dec *r0
+cmp r3, L255
+jmp *r3
+mov #-140, *r4
+clr r4
+stop
+cmp #164, L258
+lea L129, *r4
+add #53, *r5
+L247: jsr *r3
+inc r4
+clr r4
+cmp #-145, r7
+inc *r4
+L248: .data -773, 175, -989, -356, -939, -174, -574
+dec *r5
+red r1
+not *r0
+bne L161
+add *r5, *r7
+not *r6
+
+
+L249: red L254
+L250: .data 357, 10
+bne *r6
+clr *r0
+
+cmp *r3, L261
+cmp L231, #231
+
+mov L147, r1
+L251: .data -196, -6, 791, -503, -106, 512, -114, -537
+add L200, r7
+jmp L242
+cmp r5, r3
+sub *r2, *r1
+dec r2
+mov #-3, r6
+cmp r3, r5
+jsr L256
+; comment
+red L142
+inc r3
+; comment
+not L184
+dec L258
+red L259
+L252: .string "udutltnrfscniyat"
+not L262
+jsr L261
+L253: red *r1
+prn L159
+mov r0, L100
+L254: .data 861, 150
+mov r2, *r1
+
+add #210, *r7
+stop
+L255: .string "jmevbhio"
+red *r0
+stop
+sub *r7, r1
+prn *r3
+L256: .data -203, -263, -311, -77, -112
+not *r4
+inc *r7
+
+prn r6
+rts
+rts
+jsr L121
+cmp *r0, #45
+not L67
+not L258
+inc L195
+rts
+; comment
+lea L261, r4
+L257: rts
+jmp *r6
+
+cmp L258, r0
+L258: .string "uwrtibdmysycghphrwc"
+red L213
+prn *r4
+L259: .string "xrlzclhla"
+lea L261, r2
+L260: sub L8, r6
+L261: inc r3
+bne L241
+inc r3
+jsr L262
+bne L49
+red r2
+mov *r7, L73
+sub L69, L262
+cmp *r5, #-87
+L262: .data 480, -788
+mov r5, r0
+red *r6
+stop
@@ -0,0 +1,1019 @@
+; Generated by genCorpus --seed 41
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+stop
+L0: lea L213, L115
+not r7
+inc *r0
+mov #-107, *r0
+clr L12
+L1: jsr *r0
+jsr *r1
+L2: .string "svxdauxibqfmmkiizwhmqwln"
+L3: .data 422, -790, 86, -869, 421, -916, 968, 381
+sub r4, L132
+jsr *r6
+L4: stop
+L5: lea L263, r5
+rts
+prn r6
+not *r7
+L6: clr *r0
+
+bne *r7
+L7: .data -943, 58
+L8: jsr *r5
+jmp *r4
+bne L48
+clr r4
+L9: add #1, *r5
+not L68
+
+; comment
+dec r6
+jmp L210
+bne *r6
+stop
+not L9
+L10: inc r1
+L11: .string "sjldlnmvhuyhzmxlmk"
+L12: sub L237, L104
+jsr *r4
+add r1, r4
+inc L79
+dec L111
+clr L9
+dec r7
+jsr L6
+inc L162
+dec L232
+cmp r5, #-203
+L13: rts
+prn r7
+jmp *r3
+prn #134
+cmp r3, #-10
+L14: dec L1
+sub #2, r0
+bne L82
+L15: inc *r4
+add *r7, L15
+dec r6
+L16: bne *r5
+L17: sub *r7, *r5
+jmp L241
+clr *r2
+rts
+dec *r6
+L18: red L16
+L19: jmp L142
+clr r2
+rts
+L20: prn L38
+L21: clr r2
+inc r6
+L22: mov #85, *r4
+L23: lea L234, L93
+clr L207
+cmp *r5, *r2
+red r4
+inc *r4
+prn r2
+L24: cmp #-164, L147
+jsr L96
+jmp *r3
+mov L24, *r5
+red *r2
+inc r1
+L25: .string "aj"
+bne *r7
+stop
+mov r2, r1
+mov #154, L21
+not r7
+L26: lea L220, r2
+jsr *r4
+stop
+bne L17
+jsr L2
+
+add L8, L23
+
+sub *r0, r0
+bne *r2
+mov r0, r1
+jmp L175
+L27: .string "vpkmvjlbmnnenvobetsxfbu"
+add r5, *r5
+jmp L17
+L28: .data 28, 20, 259, -893
+add L26, L15
+jsr L1
+bne L224
+jmp *r7
+clr r5
+dec r4
+clr r1
+dec L68
+L29: sub L4, r1
+mov L5, L11
+L30: .data -578, -318, 258, 439, -17, 776, -209, -257
+L31: rts
+add L68, r7
+L32: inc L104
+jmp *r6
+red *r2
+inc r3
+cmp L8, #193
+L33: not r4
+L34: .string "qbk"
+red r0
+L35: .data 345, -351, -381, 612, -742
+jsr *r1
+inc r7
+dec r3
+sub L30, *r2
+dec r1
+jmp *r0
+L36: jmp L1
+clr L195
+mov #0, *r4
+L37: lea L68, L42
+inc *r3
+cmp *r4, *r1
+L38: .string "vxka"
+prn L7
+lea L50, *r5
+rts
+inc *r0
+dec r0
+jmp L156
+jmp *r4
+mov #-61, r3
+L39: .string "ut"
+prn L9
+clr *r6
+stop
+; comment
+jsr L150
+
+L40: .data -209
+jsr L156
+L41: add L8, L27
+jsr L26
+red *r1
+stop
+rts
+not *r6
+sub L246, L5
+jsr L191
+clr L170
+add L0, r0
+dec r1
+stop
+sub *r1, L41
+red *r6
+dec r3
+prn *r1
+jsr *r6
+not L19
+inc r7
+lea L36, *r3
+inc r3
+mov #183, L5
+stop
+add L9, *r4
+dec *r6
+jmp L137
+L42: bne *r7
+dec *r4
+mov #192, r1
+not r2
+clr r6
+jsr *r4
+L43: .string "wnsqwhlrurnqybkpz"
+prn #220
+sub #-33, *r6
+clr r1
+lea L193, L37
+jsr L42
+; comment
+stop
+dec r3
+jmp L4
+lea L99, L79
+clr *r7
+L44: .string "iqakhtcre"
+L45: sub r3, *r3
+L46: lea L84, r3
+L47: red r6
+L48: .data 380, 380, -670
+lea L142, r2
+L49: rts
+add *r0, L2
+L50: .string "ntv"
+add r5, L72
+stop
+stop
+jsr *r3
+L51: .string "bhgdyvaaqaulrvvmibtyz"
+L52: red r5
+red r3
+L53: .string "ticgihi"
+add #-18, L48
+L54: .string "uxrscuvbljrferendfjonpz"
+jsr *r4
+L55: stop
+lea L54, L7
+jsr L158
+stop
+L56: jsr *r6
+sub r1, *r1
+L57: red L234
+L58: mov #-24, r1
+add *r0, L135
+lea L55, *r0
+jsr *r6
+cmp #193, *r6
+prn L50
+jsr L43
+clr r2
+jmp *r6
+add #63, *r3
+sub #-135, L183
+stop
+lea L22, r1
+clr L39
+red L123
+mov r4, L232
+L59: mov #-143, r0
+not *r1
+L60: .data 476, 423, -402, 444, -532
+jsr L29
+red *r7
+clr *r6
+stop
+dec L24
+L61: inc L44
+L62: inc r6
+L63: sub r1, *r5
+not L193
+clr *r0
+bne L203
+clr *r3
+cmp *r6, #35
+bne L72
+mov L205, L19
+jsr L197
+jsr *r6
+L64: lea L33, r7
+L65: cmp *r0, *r0
+jsr L126
+stop
+add r4, L15
+L66: .string "qp"
+cmp L159, r2
+rts
+rts
+L67: jsr L121
+jmp L147
+clr *r0
+L68: inc *r1
+
+L69: .data 338
+not *r2
+L70: .string "auxir"
+not L260
+; comment
+jsr L141
+cmp L224, #26
+rts
+red *r7
+sub r4, L253
+mov *r5, r2
+L71: .data 498, -139, -836
+red r6
+jsr *r5
+rts
+jmp *r3
+not L244
+sub L124, L219
+L72: .string "frl"
+L73: .data 184, -679
+L74: inc L187
+clr *r7
+mov r6, *r3
+L75: .string "putaop"
+jsr L141
+lea L32, *r2
+jmp L74
+red L2
+red L242
+mov L134, r5
+bne *r0
+L76: .string "q"
+L77: dec *r4
+rts
+sub r3, r3
+sub *r3, r6
+add r0, r7
+sub L220, *r3
+mov #184, r5
+L78: add *r0, *r7
+
+dec r6
+clr r6
+sub *r7, r7
+lea L263, r5
+dec L213
+inc *r3
+clr r3
+jsr *r4
+L79: sub r5, *r7
+L80: red L3
+stop
+not *r1
+jmp *r6
+L81: .string "quwautst"
+L82: jmp *r6
+add *r4, L259
+jsr L153
+L83: cmp r0, r5
+L84: rts
+red r0
+stop
+jmp L167
+stop
+L85: .string "wmimvupfgz"
+L86: cmp *r5, r4
+jsr L259
+clr L114
+clr *r4
+dec r2
+
+red *r6
+prn r1
+lea L203, L191
+inc L2
+clr *r7
+lea L92, *r3
+L87: rts
+dec r4
+lea L64, r6
+lea L28, L264
+L88: lea L123, *r3
+dec L63
+lea L41, r4
+dec L34
+not *r0
+stop
+prn #49
+L89: .data -467
+L90: .data -436, -328, -747, 353, 739, 492
+inc r1
+L91: .string "weuuevispyk"
+stop
+rts
+not L159
+prn *r2
+not *r1
+L92: .data 28, 364, 89, 276, 46
+L93: .string "eosqqnfefqlbvidk"
+prn #-21
+sub L58, *r7
+bne L154
+L94: jmp L62
+red *r0
+rts
+jmp L94
+rts
+L95: .data 582, -297, 872, 990, 73, 233, 800
+stop
+jmp L2
+rts
+L96: red L6
+L97: stop
+not L106
+L98: cmp L2, L165
+red r2
+rts
+sub r5, r4
+rts
+not L10
+L99: .data -270, 195, -225
+sub *r0, *r3
+red L37
+dec L21
+L100: .data 225, 618, 521, -333, 523, 978, 264, -644
+mov *r3, r6
+clr *r0
+L101: sub r5, *r2
+L102: .string "ejuegisytcjxdjtui"
+rts
+prn L191
+jsr *r4
+red r0
+L103: stop
+L104: jsr L17
+prn r7
+dec *r5
+L105: prn L31
+L106: .data -139, -260, -997
+lea L195, *r3
+red r6
+cmp L5, *r4
+L107: .data -940
+prn #-155
+jsr *r0
+red *r3
+; comment
+dec *r1
+L108: .data 340, 405, 800
+L109: .data 321, -101, -380, -266, -846, 219
+L110: cmp r6, r1
+red r6
+L111: sub r3, L133
+red r1
+add *r5, L56
+lea L71, *r4
+stop
+L112: stop
+bne *r4
+cmp #-25, *r7
+red *r6
+L113: inc *r5
+stop
+rts
+jsr *r7
+stop
+not *r7
+cmp L14, r3
+L114: mov L97, r6
+red r3
+mov *r5, r3
+add r1, L31
+; comment
+L115: .string "thvckcnqtnshaanojnnfhyi"
+not r7
+bne *r5
+L116: jsr L78
+L117: .data 743, 680, 724, -315, 509, -49, 944, 36
+; comment
+clr r0
+sub *r1, r6
+sub r7, *r2
+sub r0, *r0
+inc r4
+L118: sub *r0, *r0
+rts
+L119: mov r6, L246
+jmp *r1
+not *r3
+jsr *r6
+jmp *r4
+lea L197, *r2
+prn #-84
+L120: .string "kdwjfbrefgdkufdpu"
+add L67, L169
+stop
+sub L70, *r7
+rts
+prn #213
+L121: .string "wayez"
+jmp *r3
+L122: stop
+lea L43, L88
+mov *r5, L222
+jmp L17
+prn L257
+add *r2, r5
+inc r6
+red r7
+not L72
+L123: stop
+cmp r3, #-30
+lea L112, r4
+inc L42
+L124: add *r6, L184
+L125: prn *r0
+L126: inc r3
+sub L70, r5
+rts
+L127: dec L157
+add L143, *r0
+L128: red L66
+inc r6
+lea L62, r6
+L129: .string "moszuzpqua"
+rts
+bne *r4
+L130: .string "efjbnafjsgmahnpdjp"
+L131: .string "qyzkwqhlrywhgbdxpexzap"
+jmp L0
+L132: bne *r3
+inc r5
+; comment
+sub L55, L7
+add #-219, r5
+clr L251
+not r0
+dec L102
+L133: stop
+lea L78, L237
+L134: prn L46
+L135: prn r1
+red *r3
+dec L20
+jmp L248
+L136: sub L91, *r0
+L137: sub r4, L148
+jmp *r2
+red r2
+cmp r7, *r0
+inc r0
+jmp L171
+bne L174
+L138: jsr L17
+mov r5, L132
+add r5, r7
+cmp L19, L176
+clr *r7
+L139: .string "ysg"
+not *r2
+L140: mov *r3, r6
+inc r0
+stop
+rts
+L141: .data 460, -55
+bne L251
+jmp L13
+rts
+jsr L47
+L142: add L75, r4
+jsr *r5
+lea L27, *r0
+stop
+add *r4, *r0
+sub r1, L170
+; comment
+mov r2, *r0
+jsr *r7
+red *r4
+sub #-218, r4
+bne L239
+add *r3, L72
+inc r4
+L143: rts
+clr L88
+
+inc *r3
+lea L6, L96
+mov *r7, *r5
+bne *r5
+jsr L233
+L144: .string "hghvrvruvuwxnkoywcuvxrfy"
+clr r6
+mov #-6, *r1
+jmp L253
+sub *r5, r4
+inc r6
+add r2, r2
+L145: jsr *r7
+jmp L241
+L146: .string "shbwnc"
+lea L173, L60
+jsr L213
+inc *r1
+mov #-231, *r7
+mov #154, L263
+L147: jmp *r4
+not L23
+red *r5
+jmp *r0
+L148: add L252, r1
+inc L100
+add r6, *r6
+mov #15, *r2
+prn r6
+jsr *r2
+lea L236, *r3
+
+prn #171
+; comment
+L149: rts
+L150: .data -41, -496, -316, 874
+dec L195
+cmp #-89, *r0
+L151: .string "ojiglnehhdhwrcejisdq"
+add L121, r4
+L152: not r7
+stop
+L153: rts
+L154: not *r6
+cmp r3, *r1
+add r1, *r6
+clr L35
+jmp *r5
+red r7
+mov #64, L240
+mov #-253, r7
+
+add *r4, L242
+jsr L180
+L155: sub #-143, r5
+jmp L261
+rts
+sub *r3, *r0
+red r1
+
+rts
+cmp #-63, #207
+bne L172
+lea L118, L214
+jmp L128
+jsr L221
+L156: clr *r3
+rts
+mov L79, *r2
+jsr L135
+sub r0, L52
+sub L18, *r0
+L157: .string "pgodbtvsrzvery"
+lea L84, *r6
+rts
+; comment
+; comment
+L158: .data 831, 694, -222, -215
+not *r6
+lea L108, L17
+stop
+not L224
+not L209
+prn r3
+dec L123
+jsr *r3
+L159: .string "totgu"
+sub r1, r1
+jmp *r1
+rts
+
+cmp L114, *r5
+
+not *r2
+add *r6, L173
+L160: .string "uyknuulmxtxinpoqbz"
+not L195
+L161: rts
+not *r7
+stop
+L162: .string "cdthgn"
+not *r4
+clr *r0
+clr L46
+jsr L175
+jsr L94
+not L37
+lea L50, *r3
+mov L188, L128
+bne *r5
+bne *r6
+L163: .data 13, 820, -124, 995, -975
+stop
+lea L173, *r0
+rts
+jmp L259
+L164: jsr L246
+red *r2
+inc L18
+inc *r5
+not L205
+dec *r2
+jmp *r4
+L165: .string "zhjosxaeuxp"
+rts
+lea L246, L194
+add L62, r2
+add *r2, *r1
+L166: red L137
+inc r3
+L167: cmp L202, L88
+clr *r5
+L168: .string "hyrxjdxneqxdiistpvaydil"
+not L177
+stop
+not L113
+clr L247
+add r3, r7
+clr *r2
+sub r5, *r0
+rts
+sub r3, *r2
+L169: rts
+L170: .data 459, 63, -205, 354
+not L187
+jsr L144
+jsr L95
+bne *r3
+dec L138
+L171: .data 210, -322, -31
+add r5, L17
+L172: lea L93, L108
+cmp *r5, #10
+sub L180, r2
+not r4
+lea L107, L196
+L173: mov r4, *r0
+cmp *r7, *r3
+sub #69, *r5
+L174: mov L237, L64
+jsr L221
+L175: prn *r4
+stop
+inc r3
+L176: inc r5
+add *r1, *r4
+inc r0
+clr r6
+jmp *r6
+L177: stop
+bne *r5
+jmp L220
+L178: rts
+stop
+
+sub r5, L121
+stop
+L179: sub #-212, *r6
+jmp *r6
+inc L220
+mov r3, L38
+cmp r7, #86
+L180: .string "o"
+inc L234
+jsr L227
+not L156
+inc *r1
+L181: clr r5
+stop
+dec r2
+prn L248
+L182: .data -7, -560
+L183: .data 590, -415, -901, 573
+L184: .string "iwbdskyguiitmuydf"
+; comment
+jsr L223
+clr *r0
+L185: cmp L254, L13
+L186: jsr L65
+sub *r2, L122
+L187: lea L259, r2
+cmp *r3, #-116
+L188: add #51, L258
+bne L239
+jmp L262
+L189: not L189
+inc *r0
+dec L244
+lea L244, *r7
+L190: cmp *r7, L31
+clr r5
+red r3
+sub L2, L110
+L191: .data -490, 594, 998
+L192: jmp *r7
+L193: stop
+red r5
+jsr L228
+L194: stop
+inc r5
+add *r2, L176
+L195: clr *r4
+L196: .data 810, -485, -305, 523
+L197: lea L66, r2
+jmp *r1
+
+L198: .string "dnvjytrcpgzr"
+red L174
+L199: .string "dpn"
+L200: lea L108, L239
+stop
+L201: .data 945, -33, -803, 988, -516
+bne L184
+sub r0, L203
+stop
+L202: rts
+L203: .string "obgvd"
+jsr *r7
+red L166
+clr r2
+clr r2
+dec L233
+L204: red *r5
+sub L214, *r3
+rts
+L205: .string "qqc"
+L206: inc r2
+L207: red *r7
+red L216
+L208: stop
+L209: .string "hgsbatv"
+cmp r7, L103
+stop
+L210: jsr *r3
+L211: .string "qbivbzwlup"
+sub L139, *r4
+lea L263, L35
+red L244
+L212: add #189, L264
+L213: jsr L253
+rts
+cmp L83, *r4
+L214: sub #237, r5
+lea L227, *r3
+L215: .data 548
+dec *r1
+jsr L252
+L216: red *r3
+red L24
+L217: clr *r3
+mov *r6, *r2
+jsr *r2
+stop
+rts
+L218: cmp *r1, #60
+red L208
+jsr L225
+lea L221, r6
+L219: stop
+not *r2
+L220: rts
+sub *r3, L132
+jmp L249
+prn #-121
+jsr L110
+L221: .data -983
+red *r3
+add r3, *r2
+; comment
+jmp L227
+L222: .data -385, 395, 649, 88, 19, -975, -570, -993
+clr *r4
+prn r2
+L223: .data -548, 593, 441
+
+red *r7
+mov #229, *r3
+bne *r7
+sub L231, L232
+inc r1
+red *r3
+L224: mov r0, r5
+cmp #178, #-108
+L225: cmp *r5, r4
+lea L257, *r2
+prn r3
+L226: mov L31, r6
+L227: not *r6
+jmp L14
+jmp L78
+mov r3, *r4
+; comment
+L228: rts
+rts
+jsr *r3
+clr r7
+not r6
+jsr L25
+clr *r0
+L229: add r6, *r5
+L230: stop
+jmp *r6
+bne *r5
+mov #-154, r2
+L231: .string "fhwp"
+bne *r0
+inc r4
+rts
+L232: sub #53, r0
+sub *r1, r2
+L233: .string "ur"
+prn *r3
+clr L218
+inc L106
+clr *r0
+L234: .string "hiyajwebhtqwqvozfgtz"
+jmp *r4
+not *r6
+cmp *r0, r6
+L235: .data 417, -699, 734, 97, 551, 226, -787, -213
+jsr L77
+L236: mov *r5, L213
+L237: stop
+bne *r3
+L238: cmp r0, r7
+L239: bne L246
+stop
+not *r4
+rts
+jmp *r4
+L240: .string "uaykzqkspfyqcegx"
+cmp r5, L151
+bne L241
+L241: red L150
+jmp *r5
+add #242, r4
+L242: mov r0, r6
+L243: .data -637, 461, -88, -792, 587, -268, 903, -144
+add #-229, *r3
+lea L258, r3
+clr L234
+L244: .data -653, 98, -82, 531, -2, -583, -583
+stop
+stop
+L245: .data 303, -71
+L246: mov *r2, r5
+L247: rts
+clr r5
+not *r4
+rts
+L248: sub #74, r4
+mov r2, *r3
+add #-140, r6
+jsr *r7
+L249: prn *r6
+jmp L256
+stop
+not *r1
+; comment
+; comment
+L250: not *r1
+bne L263
+jsr L257
+L251: jsr *r6
+inc *r6
+red L174
+L252: clr *r7
+mov #-79, r5
+L253: jsr *r7
+clr L262
+sub #-55, *r1
+L254: jsr L169
+L255: cmp #-65, r6
+inc r3
+stop
+L256: prn L258
+dec *r2
+inc r1
+mov #170, L258
+bne L260
+L257: inc *r2
+not r1
+L258: inc L46
+dec L263
+; comment
+not L263
+add *r2, r2
+red L129
+jmp L260
+not L160
+clr *r7
+inc *r7
+rts
+red *r7
+dec L141
+L259: .string "jxhlbgs"
+not L263
+L260: clr L263
+sub *r7, r2
+cmp L262, *r3
+mov L262, r2
+dec *r3
+mov r3, r7
+add L264, L168
+L261: clr *r2
+L262: prn *r1
+jmp *r6
+bne L77
+L263: .string "hjtbaviaetoez"
+inc r6
+red *r4
+
+jsr L130
+L264: sub *r0, r3
+red *r6
+stop
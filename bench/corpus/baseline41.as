@@ -0,0 +1,1019 @@
+; Generated by genCorpus --seed 42
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+not L63
+stop
+dec L226
+sub #-8, L39
+rts
+; comment
+dec *r0
+jsr *r6
+not L255
+lea L78, r0
+inc r5
+stop
+L0: dec r1
+not L89
+L1: .string "exlqvjv"
+L2: .data -927
+rts
+sub *r4, r6
+prn #186
+stop
+L3: jmp L105
+L4: .data 216
+inc r6
+mov r4, *r3
+dec *r2
+L5: mov *r4, *r4
+inc r4
+L6: add r4, r5
+L7: .data -460, 912, -525, -557, -456, -50, 25, 315
+bne L55
+L8: .string "umzalvzcetwgftih"
+L9: jmp L3
+dec r0
+; comment
+prn L27
+cmp r5, L72
+jsr L167
+mov L204, *r2
+lea L59, L2
+stop
+cmp #-80, *r6
+L10: lea L128, *r1
+jsr *r5
+prn r5
+L11: .string "tutjz"
+stop
+dec L233
+lea L219, r1
+red L200
+cmp *r2, *r0
+cmp r7, L8
+red L1
+L12: .string "jk"
+sub L164, *r1
+L13: bne L1
+sub *r3, L111
+L14: .data -575, -273, 524, 382, 888
+L15: mov *r2, L84
+L16: not L12
+L17: .string "anwp"
+L18: stop
+sub L81, *r7
+L19: red L4
+jmp *r2
+jmp *r0
+L20: lea L2, L5
+bne L13
+dec r2
+red L109
+sub #-12, L5
+prn r2
+jmp L246
+clr *r5
+clr L4
+; comment
+stop
+jmp *r2
+
+stop
+inc r5
+jsr *r2
+L21: bne *r1
+red L212
+not *r5
+sub r2, r1
+L22: .string "vmmnrjhnlyvskb"
+clr L18
+lea L12, *r7
+prn r3
+L23: .string "xqeiugkzbhgumnqwtdlhuvl"
+L24: .string "gjlsseikymsqwaovbu"
+dec *r2
+lea L10, r6
+jmp L24
+bne *r1
+L25: .data 647, 495, 513, 177, -635, -139, 402
+inc L23
+sub L48, L6
+lea L2, *r0
+L26: prn L26
+L27: clr L237
+red r0
+L28: .data -77, 125, -484, 726, 854, -385
+inc r7
+dec L129
+jmp L248
+L29: jmp *r1
+stop
+mov *r3, L153
+sub L20, L114
+not r3
+mov r6, L252
+L30: .data 932, -361, -156, 812, -744, 531, -895
+lea L20, *r3
+prn #196
+L31: bne *r3
+red L11
+mov L145, *r1
+stop
+clr *r3
+prn #-188
+prn r4
+clr *r6
+
+L32: stop
+
+dec *r2
+red r7
+L33: sub L32, L0
+jmp *r2
+clr *r0
+dec r4
+rts
+rts
+mov #-81, *r3
+mov *r5, L8
+L34: .string "thluciovksvqngkwmr"
+L35: jmp L237
+lea L221, r7
+bne *r5
+bne L81
+cmp *r6, #179
+L36: .data 902, 340, 441
+add L16, r0
+cmp r5, #-105
+L37: jmp L17
+jmp *r1
+stop
+prn *r5
+dec r2
+L38: jmp *r7
+jmp L11
+lea L11, r4
+add *r3, r6
+lea L256, L9
+dec *r4
+stop
+; comment
+L39: .string "tvolrhmzqraki"
+bne *r0
+not *r5
+L40: cmp r5, *r0
+L41: .data -990
+L42: dec L249
+cmp r0, r1
+not r4
+jsr L202
+not r3
+inc r7
+L43: .string "atrjvmylhmbrx"
+L44: inc *r2
+rts
+sub r5, L157
+bne L101
+L45: rts
+jsr L26
+rts
+L46: bne L135
+mov L151, *r1
+add L170, *r5
+cmp L40, r7
+L47: not *r0
+L48: prn L240
+stop
+mov #-53, L27
+clr L63
+stop
+L49: cmp #61, r4
+not *r4
+jsr *r2
+inc r4
+dec L11
+bne L208
+L50: .string "ka"
+stop
+rts
+prn r1
+rts
+L51: mov L37, L191
+jsr L11
+L52: .data 750
+L53: inc r0
+prn #-68
+
+jmp L50
+L54: red L175
+
+L55: rts
+L56: .string "gghwczov"
+stop
+jmp *r1
+L57: red *r2
+jmp *r4
+inc L51
+stop
+L58: lea L67, L10
+cmp r4, r0
+jmp *r1
+stop
+not *r2
+add r2, L45
+inc r2
+L59: .data 44, -468, 46, 920, 458, 489, -321, 320
+lea L137, L1
+L60: inc L32
+clr L62
+clr L130
+bne *r2
+sub #-58, *r6
+inc L9
+not *r6
+lea L47, r3
+dec *r3
+prn r0
+sub #192, *r1
+not L24
+L61: add *r5, L38
+mov L41, *r1
+red *r6
+rts
+add *r4, *r4
+L62: cmp *r2, L34
+; comment
+jsr *r6
+L63: jmp *r3
+not r6
+rts
+L64: bne L57
+clr *r5
+prn *r0
+stop
+L65: .string "srzbirqaprqga"
+dec r5
+jsr L227
+prn *r6
+L66: red r5
+lea L35, r7
+rts
+stop
+sub *r6, L141
+rts
+L67: jsr *r3
+add #197, *r5
+L68: .string "lu"
+cmp *r6, r4
+jmp *r5
+L69: prn r3
+prn *r1
+L70: bne *r3
+red r6
+jsr L251
+add #-139, r0
+bne L54
+rts
+bne *r7
+lea L26, *r1
+lea L7, L25
+; comment
+L71: red L131
+L72: jsr L61
+jmp L70
+mov #-19, L23
+red r6
+cmp *r2, *r4
+jmp *r7
+cmp L53, r1
+L73: prn L86
+clr L118
+L74: .string "bfzp"
+inc L139
+L75: mov r1, L220
+jsr *r3
+L76: mov *r5, L15
+L77: dec L51
+L78: .data 461
+add L91, L27
+sub r6, *r3
+rts
+
+stop
+; comment
+L79: stop
+prn #-8
+L80: .string "wiulahaynggrebb"
+bne *r7
+bne L50
+; comment
+add #-80, L32
+sub #-43, r5
+lea L66, *r6
+L81: prn #94
+L82: .string "uetbkg"
+bne *r1
+L83: .data 864
+dec L155
+mov L163, L157
+lea L94, L10
+prn r0
+L84: .data -579, -883, 737, 645
+L85: .string "nezzqtgdn"
+L86: jsr L24
+sub r3, *r1
+sub L37, *r6
+inc L241
+L87: clr L5
+jsr L127
+clr r5
+not *r3
+L88: .string "edvzzcdexwakrsgesrpnbi"
+L89: .string "weg"
+cmp L134, #-85
+dec *r1
+clr r4
+prn #238
+bne *r7
+mov r7, L103
+L90: lea L202, L173
+L91: not r4
+inc L8
+; comment
+add #-3, r0
+jsr L59
+L92: prn *r6
+dec r2
+jsr *r0
+inc r0
+jsr *r0
+prn L63
+L93: not r5
+L94: lea L48, *r6
+jmp L24
+L95: clr r2
+L96: sub #81, *r6
+dec L12
+L97: add #-237, *r1
+dec r4
+sub #-77, L145
+L98: not L9
+not *r6
+
+jsr L53
+L99: sub #86, L50
+inc *r4
+L100: .data -960
+L101: .string "cojohjshylwz"
+sub r5, r7
+cmp *r0, *r0
+add #-256, L6
+dec L162
+add L154, L186
+L102: prn r5
+jsr L170
+L103: jsr *r0
+dec *r1
+not *r6
+cmp L61, #214
+jsr L228
+; comment
+lea L230, *r6
+clr r2
+L104: not *r5
+dec *r7
+; comment
+; comment
+dec *r6
+jsr L31
+add r4, *r0
+; comment
+not L104
+rts
+cmp #-66, r3
+jmp L21
+not r3
+rts
+jsr *r3
+dec *r1
+jsr L87
+jsr L176
+clr *r2
+add r7, r4
+prn *r0
+clr r3
+lea L15, L205
+red *r1
+not r6
+L105: .data 246, -445
+dec *r5
+L106: add *r3, r6
+inc L67
+jsr *r6
+
+L107: cmp r5, L100
+red L94
+
+
+stop
+mov #-165, *r1
+
+inc *r5
+mov r0, *r2
+dec L76
+rts
+inc L182
+L108: inc *r1
+inc *r6
+add L130, r0
+rts
+L109: .string "hbodnrbnd"
+red *r5
+prn L104
+cmp r6, r4
+red L194
+inc r6
+L110: .string "rrfhsuxvrjkgh"
+add r0, *r3
+jmp L79
+L111: clr L150
+prn L4
+L112: .string "fbronmchxzyuiotsnkftkkg"
+L113: clr L249
+mov #207, *r7
+jmp *r7
+cmp r6, *r5
+; comment
+stop
+L114: dec L169
+prn r0
+L115: rts
+mov r4, *r0
+L116: dec L66
+lea L154, L169
+bne *r3
+L117: .string "huf"
+L118: .data 494, -316, -591, -369, 225, 672, -877
+jmp L40
+L119: .data -698, 318, 300, -550
+stop
+jsr L21
+L120: prn *r1
+lea L127, *r4
+jsr *r3
+jmp *r7
+L121: prn *r0
+cmp *r0, r0
+bne *r6
+sub r2, L74
+prn *r3
+clr r0
+
+L122: bne *r3
+; comment
+lea L13, r6
+L123: not L112
+sub L244, L158
+rts
+L124: .data -977, 790, 707, 300, -371
+jmp *r7
+add #55, r3
+L125: inc *r0
+stop
+add r4, r4
+clr *r7
+L126: lea L171, L120
+jsr L164
+L127: rts
+L128: red *r4
+lea L39, *r1
+jsr *r1
+not L109
+clr L16
+not r2
+sub r5, r5
+L129: .data -421, -536, -167
+L130: sub *r1, L83
+L131: red L72
+L132: clr L82
+inc L108
+red L215
+inc *r4
+L133: mov *r4, r0
+add #50, *r4
+mov #-253, *r5
+clr L118
+L134: .data 140, -63
+L135: add *r5, r6
+red *r4
+jsr *r2
+sub L122, L17
+L136: cmp L11, L256
+bne L175
+mov #-172, *r3
+rts
+lea L13, *r5
+; comment
+dec L28
+L137: lea L52, L216
+clr *r2
+L138: sub *r1, L137
+inc *r2
+not r4
+L139: rts
+prn r1
+red L150
+sub L222, r2
+sub #-153, r7
+L140: jsr L138
+L141: mov r7, *r5
+not L188
+inc r1
+mov *r5, *r6
+red *r4
+clr L242
+mov r2, *r3
+not L159
+inc *r1
+stop
+mov r5, L239
+L142: .string "svtfinaj"
+bne *r2
+jsr *r2
+stop
+L143: mov L147, r0
+jsr *r6
+red L86
+jsr L178
+cmp *r2, *r3
+; comment
+L144: rts
+stop
+L145: cmp L179, L85
+jmp *r1
+inc L180
+sub r6, *r4
+sub #54, L229
+inc *r6
+stop
+L146: .string "lgkmfsvew"
+jmp L254
+L147: .data -676, -886, 81, 546
+L148: inc L204
+L149: jmp *r1
+L150: clr r4
+dec L168
+clr L133
+jmp L131
+jmp *r3
+rts
+cmp r3, r6
+red *r4
+L151: rts
+rts
+sub *r1, L250
+rts
+sub r3, L158
+; comment
+mov L195, r1
+L152: sub r7, L66
+inc L63
+L153: jmp *r7
+
+cmp #-84, #-144
+inc L42
+red L249
+L154: red L235
+add *r5, *r0
+not r7
+lea L91, r6
+L155: dec L15
+dec r0
+L156: prn #-22
+jmp L85
+bne L209
+cmp r0, L151
+; comment
+rts
+L157: dec *r3
+lea L151, r6
+not L69
+L158: lea L183, r0
+L159: .string "iyoafbpm"
+lea L7, r5
+clr r6
+bne *r5
+stop
+dec L40
+prn *r2
+add #123, r5
+inc L109
+L160: .string "kmghbobqqcavzyorp"
+clr *r0
+add r7, r6
+red r4
+clr r5
+L161: rts
+not r4
+lea L248, *r4
+sub *r4, L179
+mov #-216, r7
+add L96, L109
+L162: .data 86, 951, -920, -687, -296, -409, -532, -522
+bne L48
+bne L175
+dec r0
+jsr *r3
+cmp *r7, *r1
+L163: jsr L151
+cmp *r7, r6
+L164: rts
+add L58, L21
+
+L165: red r4
+stop
+jsr *r6
+dec r1
+L166: cmp *r7, *r3
+clr *r7
+inc *r6
+L167: .data -328, -96
+mov *r5, *r1
+lea L219, L240
+L168: .data -151
+L169: clr r6
+L170: .string "leckharuicdmcnysmzqdjql"
+bne *r2
+jsr L239
+inc *r1
+bne L183
+; comment
+lea L152, L246
+prn L194
+add *r2, *r5
+jsr L177
+stop
+; comment
+L171: .data -957, -531, 628
+prn L100
+sub #85, r5
+add L107, L60
+rts
+bne *r7
+red r7
+dec r2
+clr L9
+bne L206
+L172: rts
+add *r7, r6
+not *r0
+L173: red *r7
+L174: cmp *r2, r3
+jmp L181
+sub L111, L225
+jsr L253
+dec L23
+rts
+jmp L219
+add L219, *r7
+jmp *r7
+jsr L185
+not L250
+L175: .string "iebxrjcqfkmkwmvpnvg"
+inc r5
+bne *r1
+inc r3
+L176: prn *r7
+rts
+clr L49
+mov *r2, r2
+L177: jsr L210
+cmp L13, L154
+not *r6
+jsr *r3
+bne L98
+L178: .data -758, 706, -280, -318
+stop
+L179: prn #233
+not L158
+inc L24
+L180: .data -312, -997, 43
+
+not L236
+L181: .string "q"
+L182: .data 652, -969
+cmp *r7, #240
+stop
+stop
+L183: .data -420
+L184: lea L101, L26
+jmp L242
+not *r1
+L185: .data -689, 745, 304, 893, 611, -446
+clr r1
+bne L151
+L186: .string "vprwjckkzdpppxs"
+; comment
+L187: .string "gctfegqjzcgoijsspxhkorsx"
+bne L101
+not *r4
+prn L254
+stop
+prn L129
+jsr L85
+inc L184
+L188: sub *r7, r4
+sub L162, *r2
+stop
+L189: .data -423, -377
+lea L244, L192
+stop
+L190: .data 863, 879, 819
+add *r5, r5
+L191: .string "josigddknm"
+prn *r1
+L192: red *r1
+clr L237
+L193: .string "sfsybdxedkhxfkdbjgsecd"
+clr L183
+add #168, L219
+L194: lea L170, r5
+stop
+jsr *r5
+clr r3
+add #-31, *r6
+dec r2
+not L161
+jsr L142
+bne *r0
+
+stop
+not r7
+L195: .data -930, 62, 583, 644
+L196: .data -265, -550, 641, -686, 871, -359, -84
+not r2
+jsr *r5
+prn L168
+; comment
+L197: lea L238, *r5
+cmp L206, *r7
+rts
+L198: bne *r3
+dec L238
+inc r7
+lea L220, r1
+clr r0
+L199: .data -733, 820
+dec L52
+red *r6
+jsr *r6
+add *r4, r2
+cmp r5, *r2
+rts
+L200: inc L119
+prn #-59
+L201: .data -629, 49, 599, -870, 496, -923, -970
+
+red L112
+L202: bne *r1
+jmp *r4
+red L113
+prn r0
+jmp L211
+stop
+red r1
+cmp r7, #133
+clr r4
+rts
+dec *r1
+clr L209
+sub L0, *r6
+mov L189, *r4
+; comment
+jmp *r1
+not r1
+L203: .string "cyeoaadujyibcwuclyjom"
+L204: bne *r4
+clr r7
+sub L245, L11
+L205: mov L143, *r1
+L206: .data 853
+not r3
+clr r7
+inc *r7
+jsr L91
+not *r1
+lea L230, *r1
+L207: sub r1, *r4
+clr *r2
+not L235
+clr *r1
+prn #-25
+stop
+bne *r1
+sub L143, L68
+L208: sub r1, *r5
+jsr L232
+L209: .data -742
+jsr L245
+
+jmp *r7
+jsr *r0
+stop
+
+
+L210: dec L184
+dec L227
+sub r5, L221
+stop
+lea L225, r1
+L211: .string "vcg"
+L212: rts
+red *r7
+lea L153, L73
+L213: cmp *r7, L228
+; comment
+lea L66, *r7
+jmp *r4
+dec L219
+red r0
+not r0
+
+
+jsr *r6
+L214: .data 644, 840, 168
+dec *r6
+not *r0
+L215: clr r5
+prn *r2
+rts
+add *r3, L14
+inc L27
+L216: .string "rixtciaghisszkrt"
+L217: clr r7
+L218: lea L248, L119
+L219: cmp #-242, r3
+add *r4, L92
+stop
+; comment
+dec L175
+clr *r7
+inc L30
+clr L234
+not L199
+L220: .string "ucvel"
+L221: .string "lkokncgtzivpmfjegnj"
+jsr L246
+L222: clr *r6
+sub L54, *r0
+prn r6
+dec L104
+mov #-106, *r1
+dec L160
+clr r7
+; comment
+clr L205
+not r6
+jmp L160
+L223: bne *r1
+inc *r7
+L224: jmp *r6
+L225: .string "wwohzjtaytpafmacxkctpf"
+L226: stop
+not *r0
+mov #-154, *r1
+stop
+red *r1
+prn L104
+clr r6
+jsr L245
+L227: not L52
+L228: jmp *r2
+L229: .data 714, 96, 734, -256, 356
+clr *r1
+bne L157
+rts
+bne *r2
+L230: rts
+sub r1, *r1
+inc r5
+bne L235
+
+L231: not L11
+L232: add *r6, L36
+; comment
+L233: .data 329, 638
+L234: .string "xtuieekshfssnb"
+lea L249, *r4
+L235: prn *r1
+inc *r7
+clr *r3
+stop
+inc L88
+L236: .string "lgigzrwvbsmlpoqa"
+L237: jsr *r3
+sub *r3, r3
+add #-179, *r5
+inc *r7
+L238: .data -181, 141, -53, -815, -810, 143
+mov *r2, L250
+not r2
+red *r3
+mov r1, L154
+cmp *r1, L247
+jsr L253
+jsr *r4
+add r0, *r0
+lea L129, L4
+dec r2
+bne L184
+sub *r5, r2
+L239: lea L245, L255
+inc L247
+dec L256
+L240: cmp r4, *r7
+
+
+add L252, L245
+prn #61
+jmp L1
+L241: mov *r4, L7
+jmp *r3
+jsr *r3
+rts
+dec *r2
+red *r3
+L242: .string "vmwestb"
+L243: .data 984, -73, -433, -972, 673, 163, 313
+add *r0, *r5
+not r6
+rts
+L244: .string "pifw"
+L245: .data -501, 177, 652, -886, 977, 360, -266, 98
+rts
+mov *r1, L1
+jsr L170
+clr L246
+dec L85
+mov #-129, *r4
+clr r7
+lea L242, *r1
+L246: sub *r0, L116
+; comment
+cmp *r3, #-28
+L247: not L256
+L248: jsr L111
+sub r2, *r6
+bne L37
+L249: add r0, L253
+L250: .data -255, 796, 961, 100, 268
+red L138
+dec r4
+not L255
+mov #-82, r0
+jmp L251
+not r6
+cmp r7, #-152
+not L69
+cmp L254, *r1
+bne L253
+not *r6
+L251: .string "ndnjhthvnmuzmaeiqqwu"
+L252: clr *r4
+jsr L214
+add #209, r0
+dec *r6
+prn #193
+; comment
+jmp L138
+prn #-30
+inc r6
+sub L22, *r2
+L253: not L256
+jmp *r3
+; comment
+red r6
+jmp L169
+L254: .data -241, 52, -52
+
+L255: jmp *r6
+sub #54, L198
+L256: jmp *r0
+inc *r1
+stop
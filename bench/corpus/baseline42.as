@@ -0,0 +1,1020 @@
+; Generated by genCorpus --seed 43
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+L0: rts
+clr *r1
+mov r2, *r7
+prn r5
+L1: red r1
+not L20
+L2: .string "xywpkjjdimwhphtjmqyfaq"
+cmp *r3, L2
+jmp L2
+sub #3, r7
+not *r7
+L3: clr L1
+; comment
+lea L0, r6
+jsr *r1
+bne *r6
+bne *r2
+jmp L2
+jsr L60
+rts
+mov r0, *r2
+mov *r6, L154
+bne *r2
+stop
+stop
+bne *r7
+prn #-226
+L4: mov *r5, L150
+L5: stop
+stop
+L6: .string "hjkzrqvmtlaustcrqgpeu"
+L7: cmp *r3, L137
+stop
+L8: .data 654, 463, 498, -434, -619, -318, -243, 510
+L9: bne *r5
+
+prn L9
+stop
+L10: .string "b"
+jmp L10
+
+L11: .data 118, 996
+cmp #-155, r0
+bne *r0
+L12: .data -569, 851, 191
+jmp *r2
+L13: dec *r7
+L14: lea L11, *r7
+prn *r7
+inc L14
+jsr L233
+L15: clr r5
+not L168
+add #-26, L11
+stop
+rts
+lea L118, L161
+dec L236
+L16: not *r7
+rts
+mov #-75, r0
+L17: jmp *r1
+L18: lea L255, r3
+jmp L158
+dec *r2
+red L4
+jmp *r1
+bne L254
+L19: .data 454, 533, -825, 161, -603
+clr r0
+L20: .string "scshipfokpboaqtyofowuak"
+jsr *r3
+not *r5
+bne L16
+cmp *r1, *r5
+mov r7, r3
+L21: not *r3
+prn r1
+L22: jmp *r4
+L23: .string "yyvoclhbcrrgnqgudyt"
+
+jsr *r5
+rts
+stop
+jsr *r3
+cmp #26, *r5
+clr r3
+add #94, *r3
+L24: lea L21, r4
+mov #-94, r6
+bne *r3
+prn r2
+L25: .string "zgvszzjikxsqylgivnqm"
+sub L128, L4
+bne L170
+L26: dec *r1
+red r4
+cmp *r6, #191
+clr L99
+jsr L181
+add r4, *r4
+mov r2, L0
+L27: .data 341
+inc *r0
+L28: .string "hlhxeboukis"
+clr L28
+add r0, r6
+not L20
+L29: .data 804, -219, -338
+L30: bne L3
+
+mov L64, L58
+L31: .string "kz"
+stop
+add L6, L16
+L32: .string "sxbuiddgdspivlxciiomeheh"
+stop
+add #-183, *r1
+stop
+sub L147, L31
+L33: .string "vbkwius"
+red L9
+clr r4
+L34: .data -584, -934
+prn L20
+stop
+L35: .data 297, -44, -342, -428, 193, 190, 652
+sub #240, L256
+bne L217
+not r6
+; comment
+red *r5
+inc L106
+cmp r7, r2
+
+L36: red *r3
+bne L48
+mov L20, L87
+red r2
+L37: mov L120, *r1
+inc *r2
+red r4
+L38: mov r1, L160
+prn L92
+jsr L21
+jsr L34
+stop
+cmp *r5, *r3
+L39: bne *r1
+jsr *r6
+cmp #120, L26
+rts
+red *r5
+add L247, L13
+L40: .data -387
+sub r7, L5
+jsr *r7
+L41: .data -605, -942, -264, -40, -86, -779, -552, -75
+dec L2
+dec *r5
+L42: .string "rmrz"
+clr L32
+add r3, L159
+cmp r3, #-44
+L43: sub L101, r2
+prn L8
+cmp r6, r6
+sub *r6, r5
+stop
+stop
+prn r7
+L44: sub L273, r6
+lea L28, r7
+L45: inc *r6
+L46: not *r1
+clr L213
+stop
+jmp *r7
+; comment
+cmp #-178, #30
+lea L46, r0
+stop
+jsr L14
+not r0
+jmp L273
+mov *r0, L219
+lea L4, *r0
+mov L39, L58
+sub *r3, r5
+L47: lea L41, *r5
+L48: .data -218, -217, -995, -103, -624, 657, -695, 421
+not *r4
+L49: cmp *r4, r6
+not L162
+L50: sub #241, *r1
+
+L51: dec r2
+stop
+red r0
+sub L239, *r5
+clr *r1
+clr *r4
+L52: .data -961, -762, -905
+cmp L37, *r5
+rts
+prn *r1
+L53: stop
+jmp *r0
+bne L43
+lea L2, r6
+lea L59, *r0
+L54: .data 63
+L55: lea L224, r7
+rts
+bne L173
+L56: inc *r1
+not *r6
+not *r4
+prn #-114
+; comment
+L57: jmp *r5
+L58: .string "clhxnlnhothuimgrvaodeoe"
+L59: sub #203, r7
+prn L53
+not L31
+jsr L96
+not r5
+L60: inc *r5
+bne L233
+lea L34, L40
+mov L58, r5
+bne *r7
+L61: jsr L20
+L62: .string "zfwddws"
+not L151
+add *r2, L161
+rts
+rts
+cmp #128, L192
+lea L121, L56
+inc L222
+mov #104, *r5
+sub #-192, L16
+not r3
+jmp *r3
+rts
+lea L98, L38
+jmp *r5
+mov *r7, *r5
+sub #-220, r1
+bne *r4
+clr L177
+L63: cmp r4, #34
+L64: .data -95, -392, 665, -778, -581, -936, 367, -624
+L65: dec r4
+prn r6
+cmp #-243, L53
+L66: lea L57, L48
+stop
+rts
+dec L106
+jsr L0
+L67: stop
+L68: lea L100, L176
+add *r7, *r4
+L69: .data -280, -203, 738, -231, -703, 866
+bne L41
+red r4
+stop
+mov #235, *r4
+not L60
+jsr *r6
+bne *r3
+add #198, *r1
+jmp L56
+sub r6, *r1
+rts
+clr *r1
+sub *r5, L44
+dec L79
+cmp r2, #-252
+prn L0
+jmp L39
+L70: .data -859, -917, -632, 973, 153, -156
+L71: lea L178, *r5
+L72: dec L72
+red *r6
+clr r4
+stop
+L73: prn L261
+rts
+L74: rts
+bne *r3
+L75: .data -726, -540, -1000, 436, 888, 379, 565, 349
+; comment
+clr *r0
+clr *r1
+stop
+L76: red L37
+L77: dec r0
+cmp #-221, L86
+dec r7
+stop
+lea L144, r1
+lea L230, *r2
+L78: sub L225, L264
+inc *r2
+bne *r0
+jmp L71
+red *r2
+L79: cmp *r5, r6
+clr L9
+; comment
+jsr *r7
+rts
+bne *r6
+bne L157
+L80: inc L71
+bne L261
+L81: inc L177
+L82: jsr L237
+prn *r0
+clr L226
+jmp L25
+L83: not r5
+L84: .data 350, 737, 230, 648, -326, 378, 161
+stop
+jmp L79
+rts
+bne L34
+not r4
+cmp *r0, r3
+rts
+L85: lea L80, r1
+clr *r4
+rts
+red L238
+not L268
+stop
+L86: jmp *r4
+inc r4
+L87: cmp *r5, *r5
+rts
+L88: jsr L5
+L89: sub L50, L240
+stop
+lea L2, L30
+L90: .string "ofpstbhade"
+red L209
+red L83
+mov #189, *r1
+L91: .data -118, 59, 504, -533, 988
+jmp L257
+L92: .string "kyxenvkbtdnmqmcsj"
+jsr *r0
+sub r7, r2
+not L9
+lea L16, *r4
+L93: cmp *r7, #-78
+rts
+L94: mov #-154, *r1
+lea L84, L147
+inc L9
+L95: cmp L248, r5
+rts
+jmp L242
+; comment
+L96: .string "rayihlgngghtnfpslq"
+L97: .data -209, -240, 197, 414, -388, 408
+sub *r4, L136
+L98: sub L71, r5
+; comment
+red r1
+; comment
+jmp L148
+L99: .data -237, 730, -352, -354, -937, 305, 28, 307
+clr L215
+L100: jsr *r5
+clr *r4
+inc r7
+L101: clr L198
+lea L37, *r7
+L102: not r5
+inc r1
+L103: lea L186, r5
+L104: .string "wtmnnpzyterpx"
+dec *r6
+red *r7
+stop
+rts
+L105: rts
+L106: .data -719, -270, -485, -76, 360
+L107: .data 116, -708, -701, 250
+L108: add L10, r1
+bne *r3
+jsr *r2
+rts
+L109: add *r1, r3
+L110: .data -6, -588
+rts
+jmp *r7
+jmp *r5
+L111: not L223
+red *r1
+L112: .data -858, 851, -611, -376, -765
+stop
+L113: red r6
+clr *r5
+dec L248
+dec *r2
+jmp *r4
+L114: .data -763, -855
+
+stop
+cmp *r3, #249
+jsr *r0
+cmp *r4, #71
+lea L128, L157
+stop
+add r1, *r2
+sub r4, *r0
+L115: .string "tm"
+L116: red r6
+sub #-101, *r5
+inc L91
+mov #219, L43
+bne *r2
+lea L19, r0
+jsr L130
+L117: .string "nqhznrchjefmmkeialpuf"
+red r6
+jmp L48
+inc r0
+; comment
+jmp *r5
+L118: mov L17, r7
+red L212
+L119: inc r0
+L120: stop
+inc L217
+stop
+inc *r1
+add *r0, L72
+; comment
+jsr L236
+L121: lea L238, L249
+jsr *r1
+prn r4
+red r5
+jmp *r5
+red L220
+not L152
+sub L53, r5
+not L196
+L122: red r3
+L123: inc L14
+L124: inc *r0
+rts
+clr L105
+L125: .string "qvzkfoqiilhxsnqgbcb"
+jsr L182
+L126: bne L0
+lea L251, *r5
+cmp *r6, r6
+L127: dec r6
+mov L27, L199
+sub *r0, *r6
+L128: .string "tng"
+red L114
+jmp L64
+clr r3
+L129: lea L8, r3
+jsr L31
+L130: jmp L66
+L131: .data -182, -87, -865, 365, 918, -401, -346
+stop
+L132: .data 660, 216, -576, -887, -602, 163, 418
+inc *r7
+; comment
+prn L85
+clr L111
+jsr *r6
+L133: lea L175, *r3
+add L10, *r2
+L134: mov L235, r1
+not *r5
+bne *r7
+mov r1, *r6
+bne *r6
+jmp *r7
+L135: .string "lotpxsywmzqciireqspang"
+add L108, L61
+L136: lea L101, *r3
+sub r7, *r3
+jsr *r6
+bne *r2
+L137: stop
+L138: clr *r0
+not *r5
+prn *r4
+not L109
+L139: .string "irhu"
+L140: .string "cdbqjisedqpxwzfqeenuejm"
+jmp L197
+L141: add #-175, *r4
+L142: .data -597
+L143: jsr *r4
+red L182
+L144: .string "vqmlxwcwcbsl"
+inc r2
+
+mov L258, L246
+cmp *r5, *r6
+jsr L36
+L145: cmp #19, r1
+stop
+stop
+add #-16, L175
+L146: prn L234
+L147: add L266, r2
+L148: mov #-111, r7
+rts
+bne *r1
+add #180, L4
+clr *r0
+jsr *r6
+L149: .data -66, 900, 76, -656, 960, 593, -941, -151
+L150: .data -462, 211, 652, -908, -146
+dec *r2
+sub #215, *r6
+jmp *r5
+jmp L191
+L151: bne *r1
+rts
+mov *r0, L189
+jsr L224
+dec r0
+
+L152: .string "vujgwcsqxsiene"
+lea L272, *r5
+bne L42
+cmp #-72, L63
+L153: not *r5
+cmp L61, *r7
+prn *r0
+; comment
+red *r6
+stop
+
+L154: red r5
+L155: .string "eygpsghebdtvvhhz"
+L156: .string "rpyy"
+rts
+clr L70
+; comment
+clr *r2
+L157: .string "bobgeidavrjdpcltrukqatyg"
+L158: jmp L182
+add *r7, r0
+lea L240, r1
+cmp *r6, L120
+jmp L100
+lea L141, L115
+L159: .string "gtcqymhif"
+L160: .data 411, -150, -508, -773, 866, 222
+not r4
+jsr *r2
+cmp #114, *r3
+red *r5
+L161: .string "hthqqzf"
+L162: .string "sirdzbwwgikxleewcwfxd"
+L163: .string "z"
+L164: dec *r7
+L165: dec *r7
+inc L144
+L166: dec L75
+red L117
+clr r0
+add r6, L46
+not r7
+L167: red r3
+mov r2, r7
+clr *r5
+; comment
+red L166
+jmp *r7
+add #-239, r6
+L168: red L244
+prn #-226
+prn r1
+add r5, r7
+add L74, L240
+prn #-161
+inc r2
+L169: add #80, *r6
+lea L214, *r3
+red *r4
+
+L170: mov *r2, *r4
+bne *r1
+lea L248, r3
+dec r2
+sub #-141, r3
+cmp r3, L229
+jmp *r5
+inc L19
+stop
+L171: red r6
+stop
+prn #-240
+jmp L89
+cmp *r0, #-185
+jsr L129
+mov *r3, *r6
+cmp #164, L191
+bne *r4
+add *r7, r0
+inc r3
+not *r7
+inc r0
+
+bne L183
+jsr *r5
+L172: .string "ohwveagdnalqvifyl"
+jsr *r1
+red L149
+L173: .data 515, -746, 35, -515, 950, 787
+not *r7
+L174: cmp #-132, r7
+lea L91, L223
+L175: .data 364, 373, -151, 999
+L176: jmp L37
+jmp *r7
+L177: .data -644
+inc L9
+rts
+L178: prn #123
+dec L193
+clr *r1
+L179: clr r1
+jsr L43
+add r5, r7
+prn r4
+rts
+clr *r4
+L180: .data 582
+stop
+red *r7
+rts
+not *r0
+clr *r5
+clr r5
+sub #-25, L205
+L181: .data 114, 173, -127, -193, -678, -617, 767
+lea L252, r0
+L182: add r5, r2
+mov #-146, L270
+L183: .data 797
+clr r6
+jmp *r1
+jmp *r2
+L184: dec r5
+mov L27, L97
+; comment
+clr *r2
+jmp L46
+red r0
+dec L27
+mov r3, *r5
+not L160
+
+jmp *r7
+mov r7, *r0
+lea L212, r6
+sub *r6, L270
+lea L185, r3
+inc *r2
+prn r7
+inc L207
+red *r5
+L185: .string "sciarwbjoqtwvozbirr"
+L186: .string "boxqyyesdqobymbyhfkeo"
+stop
+
+cmp *r5, L199
+L187: clr *r6
+lea L226, *r6
+add r6, r0
+L188: .data 525, -112, 368, -193, 21, -114
+cmp r7, *r7
+jsr L66
+cmp *r3, L232
+prn *r7
+L189: cmp *r7, *r3
+L190: dec r1
+L191: clr L207
+L192: .string "fzjcqig"
+add r2, *r7
+rts
+bne *r2
+not *r3
+not L205
+lea L195, *r3
+L193: .string "shpiosiqvkgnbuln"
+rts
+bne L258
+clr *r3
+L194: .data 640, 499, -224
+; comment
+not r5
+L195: .data 328, 461, 138, -646, 969, 675, 55, 920
+rts
+L196: .data 341, -410, -334, 243, 446, 63
+jmp L247
+mov L83, r4
+mov L56, *r5
+L197: .string "atqiowao"
+stop
+L198: clr L240
+mov #-104, L54
+not r2
+red *r5
+L199: stop
+jmp *r4
+L200: .string "jvfdsdxoaxezgytaefqk"
+L201: bne *r1
+L202: dec r1
+bne L243
+L203: sub #-156, *r1
+dec *r0
+rts
+dec r0
+mov L42, L169
+L204: dec L169
+jmp *r1
+L205: not *r4
+L206: .data -915, -436, 735, -396, 677, -544
+mov L267, r3
+L207: red *r7
+mov *r0, *r1
+add L245, r7
+rts
+prn L146
+red r4
+lea L25, r4
+L208: .data 846, -92, -415, -499
+L209: dec L194
+L210: red *r4
+mov #17, L265
+; comment
+L211: stop
+rts
+L212: .data 987, -293, -966, -867, -671, -374, -4, 201
+jsr *r0
+dec r7
+prn *r1
+not L199
+L213: stop
+bne L218
+add L243, *r5
+prn L236
+prn r6
+; comment
+L214: .data 349
+L215: .string "pwzzziqhchzntiuuizilt"
+L216: .data -778, -632, -73, 244, -154, -848, -597, -681
+L217: stop
+clr *r4
+dec *r5
+jmp *r4
+L218: .string "sgqnjjomxqzinvccwybov"
+L219: sub *r4, r3
+L220: stop
+L221: .data -87, 963, 221
+L222: jsr L256
+not L236
+jmp *r2
+clr *r0
+bne L123
+L223: jsr L23
+stop
+not r7
+clr L235
+prn L223
+clr r3
+stop
+sub r4, *r1
+red *r3
+L224: jsr *r6
+bne L224
+L225: .data 665, 482, 176, 647, -11, -265, -807
+jmp L270
+stop
+cmp L124, r0
+; comment
+mov L45, L59
+sub #2, r7
+red *r5
+L226: .data -514, 240, 603, 124, -299, -65, 392, 95
+jmp L222
+rts
+L227: sub #-121, r0
+sub #141, r2
+inc *r0
+stop
+sub #40, L54
+rts
+dec r5
+lea L228, r7
+L228: sub *r4, r3
+L229: .data 122, -532, 214, 356, -465, -850, 872, 45
+cmp L78, L96
+jmp *r7
+L230: .string "lddrhcawvj"
+L231: .string "gomijtayidljmwecn"
+; comment
+jsr L249
+red *r5
+add #-66, r4
+bne *r7
+L232: red r5
+mov *r0, *r4
+L233: not r0
+red L241
+red *r2
+inc r2
+L234: .string "gw"
+L235: mov r1, *r3
+mov L215, *r1
+lea L212, r4
+lea L47, L252
+sub L245, r0
+sub *r3, *r6
+add #-184, L275
+L236: .string "nxefeuwqdxcvzhknzsfmelr"
+mov *r0, r4
+inc L271
+sub *r5, L249
+inc L245
+L237: .data 33, -191, 788, -837, 849
+sub #50, *r1
+cmp #-166, r3
+prn L128
+not r7
+L238: prn *r7
+L239: bne *r2
+inc L110
+sub L179, L144
+bne L224
+rts
+prn #72
+dec r3
+not *r6
+inc L258
+rts
+L240: clr r0
+red L241
+lea L274, r5
+L241: sub r6, r0
+inc *r7
+clr L246
+jmp L135
+stop
+mov L275, L238
+cmp *r1, L255
+clr r6
+prn #219
+L242: add L92, r5
+mov L264, r1
+inc L262
+L243: lea L266, *r4
+not L241
+sub L135, *r5
+red r1
+rts
+cmp #-153, r4
+cmp *r4, r2
+L244: .data -366, 429, 317, -758
+jsr *r3
+mov L17, L255
+bne L104
+L245: clr r6
+clr r1
+L246: jmp L255
+sub L143, L0
+L247: mov L143, r0
+; comment
+add #-223, r0
+L248: .string "okrpndnlzxlwxzgwsopw"
+sub #37, L40
+stop
+L249: .data 738, -286, -994, -638, 309, -520, 596, 622
+red r6
+cmp *r5, #-164
+bne *r5
+L250: .data -826, 222, -837, 951, -979, 40
+sub *r2, *r0
+mov #-153, *r2
+stop
+red L256
+jsr L251
+jsr L251
+clr r0
+L251: jsr L257
+dec *r0
+clr r3
+prn r3
+lea L66, r5
+
+dec r7
+L252: add *r4, L274
+jmp L196
+L253: jmp L70
+inc r6
+rts
+add r6, *r1
+rts
+cmp L130, #239
+bne L260
+inc L266
+dec r0
+stop
+cmp #-220, #145
+jmp *r7
+bne L146
+L254: bne L180
+L255: dec r6
+lea L164, r4
+L256: cmp L272, #148
+jsr *r4
+L257: .data -347, 742, -166, -351, 185, 795, -197
+cmp *r4, #162
+sub #212, *r4
+mov #-201, r2
+L258: red L271
+L259: .data -815
+L260: bne *r0
+add #-119, *r0
+L261: dec *r1
+sub *r5, *r4
+L262: cmp r3, L83
+clr r0
+stop
+stop
+L263: .data 418, 575, 653, -556, 655, 139, -867
+not *r0
+add L274, r4
+stop
+cmp L267, #-102
+clr L275
+red *r4
+clr r3
+jmp L272
+not *r1
+clr *r5
+stop
+sub *r5, *r2
+
+prn L137
+not L275
+lea L275, *r0
+
+dec *r3
+bne L188
+L264: inc L185
+L265: mov #254, r1
+dec *r5
+prn #-33
+jmp *r3
+clr r0
+cmp #-126, #142
+dec *r2
+L266: .string "sjbosidksmwnxwescgvsbm"
+jmp *r7
+L267: .data -716, 778, -798, 933, 305, -713, 666
+cmp *r6, r1
+; comment
+bne L131
+L268: stop
+inc L94
+lea L273, L62
+L269: jmp *r5
+jmp *r4
+lea L272, r6
+jmp *r4
+jmp *r4
+L270: .string "elfgbqsy"
+jmp *r6
+prn #22
+jmp *r3
+L271: .string "rnykull"
+rts
+stop
+mov #195, L273
+L272: mov *r6, r3
+lea L275, r0
+L273: .data 708, 260, 752
+jmp L274
+L274: rts
+L275: mov #50, L246
+stop
@@ -0,0 +1,1018 @@
+; Generated by genCorpus --seed 44
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+
+rts
+add #120, *r6
+L0: not L13
+L1: bne *r7
+L2: rts
+prn r4
+dec r2
+mov #19, L154
+stop
+rts
+sub r4, L2
+inc r0
+add *r4, r2
+dec *r7
+jsr *r4
+not *r7
+sub r0, r2
+stop
+jsr L147
+jmp L1
+cmp *r4, r0
+sub L223, L133
+add *r7, r3
+L3: rts
+not *r2
+red r1
+L4: jsr L228
+L5: stop
+cmp r3, L5
+red *r7
+L6: stop
+not *r2
+add r6, *r1
+jmp L1
+L7: cmp L5, #-198
+jmp L230
+jmp *r1
+stop
+L8: sub #34, *r1
+rts
+jsr *r5
+cmp #9, r0
+L9: sub #158, r2
+not r7
+L10: clr L242
+lea L75, L2
+L11: prn *r3
+jsr L5
+prn L146
+red r4
+jsr *r3
+not L0
+L12: mov r1, r2
+not *r6
+L13: .data -703, -16, -3
+L14: inc r3
+rts
+cmp #200, r4
+cmp L6, *r2
+stop
+add r4, *r7
+mov *r2, L41
+cmp #53, *r3
+sub *r3, r6
+prn #91
+red L196
+sub *r1, L39
+not *r0
+L15: .string "jccjjcnrrjepusainls"
+jsr *r2
+L16: .data -46, -656, 158, -437, -341
+jsr L15
+sub r3, r2
+stop
+cmp *r2, #-204
+rts
+stop
+jmp *r7
+rts
+L17: .data 254, -753
+red r6
+L18: clr r3
+L19: .string "ktzhvhwkxbc"
+lea L5, *r2
+bne *r5
+lea L2, r7
+L20: .data -660, 261, -489, -974, 696, -919, -675, -459
+L21: .string "gkfqmvyu"
+jmp L177
+dec *r5
+dec r4
+bne *r2
+jmp *r1
+rts
+clr *r5
+L22: .data 630, -380, 501, 68, -974
+L23: cmp L49, #-177
+jmp L90
+dec L13
+dec r3
+clr L5
+L24: bne L23
+cmp #-96, L220
+lea L87, L4
+jmp L242
+L25: stop
+L26: lea L39, r3
+L27: .string "dhhxdabfwetcgpsphyovp"
+lea L15, L70
+dec *r2
+lea L197, r4
+add r0, r6
+cmp L39, #-148
+cmp #240, #78
+L28: prn *r7
+sub L23, r5
+sub #-194, r4
+stop
+clr *r6
+L29: rts
+inc L15
+jmp *r7
+L30: .string "pfptxmtumeqnzpzmfdpih"
+not L14
+red *r7
+sub L63, *r1
+bne *r6
+L31: sub L28, L175
+lea L8, L155
+stop
+L32: lea L85, *r7
+prn r5
+mov *r3, L8
+; comment
+add L193, *r2
+dec *r1
+L33: mov *r4, *r0
+clr r7
+mov L29, r7
+lea L19, *r7
+mov L15, *r4
+add L3, *r6
+L34: .string "vjefirmae"
+L35: .string "iglrnmafaxzs"
+prn *r2
+not L12
+red r5
+L36: bne L13
+jsr L26
+rts
+red r0
+prn *r1
+L37: lea L187, *r4
+L38: .data -3, -398, -557, 997, -251, -300
+mov L240, r2
+sub #-121, r5
+L39: inc *r0
+mov *r7, r2
+jmp *r3
+mov r1, r7
+cmp L158, r1
+L40: .data -367, 681, 440, 871, -756, 493, -660
+prn #-248
+clr *r2
+L41: .data 718, 901, -448
+add *r1, *r4
+L42: add *r5, L28
+dec L122
+cmp #93, r4
+L43: prn r7
+L44: clr L37
+; comment
+add #213, *r2
+mov r1, r1
+add *r3, *r6
+jmp L32
+dec *r3
+dec r0
+
+bne L2
+clr L29
+rts
+clr L218
+jmp *r2
+not L41
+red *r2
+bne L35
+rts
+not *r2
+; comment
+bne L33
+cmp L31, #-121
+L45: bne L101
+bne *r6
+jsr *r6
+L46: jmp *r3
+prn L224
+add r3, *r1
+L47: jmp *r1
+stop
+inc L146
+red r4
+add r2, L135
+L48: .data 851, -821, 378, 401, 456, -195
+jmp *r5
+L49: red L40
+dec r5
+bne L218
+L50: clr r3
+stop
+prn L43
+L51: inc *r6
+L52: sub L126, r5
+add r4, *r0
+not L30
+L53: jmp L36
+L54: .data -207, -285, 304, -551
+bne *r3
+not r2
+L55: sub L53, *r5
+lea L127, *r2
+bne L5
+jsr *r3
+sub r0, r2
+L56: .data -715, 228, 571, -968, -85, -967, -786, -746
+jsr *r7
+lea L165, r0
+L57: .string "ncpxolerqzkhswwezaa"
+stop
+jsr L109
+rts
+sub *r3, *r1
+not r0
+jsr *r1
+mov r6, L158
+jsr L123
+add #-149, r3
+L58: jmp *r7
+sub #81, L198
+clr *r2
+red *r3
+L59: .data 618, -620
+red L118
+bne *r4
+red r6
+sub *r3, r0
+lea L237, *r5
+add #143, r1
+; comment
+cmp #154, *r5
+prn *r6
+rts
+bne *r5
+stop
+L60: add r4, *r4
+; comment
+L61: stop
+L62: add #200, L33
+rts
+inc *r4
+L63: .string "xfgvoahlbrtcwd"
+jsr *r4
+clr *r7
+jsr L180
+add L183, L207
+prn L18
+L64: inc L120
+jmp L206
+prn *r4
+sub #250, *r4
+L65: prn L36
+stop
+; comment
+dec L17
+rts
+L66: sub L164, L164
+L67: lea L32, r1
+red *r1
+cmp #-86, *r0
+not r3
+L68: .string "mmlhromrkxbvju"
+red r1
+add #-190, r0
+jsr *r1
+jsr *r2
+clr r0
+mov L227, r6
+bne L124
+jmp *r0
+lea L48, *r0
+clr L27
+L69: jmp L10
+jsr *r4
+L70: bne *r0
+jmp *r5
+L71: mov #-205, L2
+rts
+jsr L134
+inc *r6
+rts
+bne *r2
+clr L10
+stop
+; comment
+sub r0, r7
+sub #-153, r6
+mov r3, L49
+inc *r0
+inc r2
+add L255, L17
+cmp *r6, r5
+not *r4
+dec L14
+L72: clr *r4
+L73: clr L76
+L74: inc r1
+prn *r4
+L75: .string "wckmvhvlgzcqj"
+red *r7
+jsr *r7
+add #-88, L9
+jsr *r0
+cmp *r3, r1
+add #-249, *r4
+L76: mov r4, *r2
+; comment
+L77: .string "isyeqsitapgtmj"
+jmp L108
+red *r5
+; comment
+L78: .data -448, 466
+mov *r3, *r7
+cmp #160, *r1
+L79: not *r0
+mov *r7, *r5
+jsr *r0
+L80: .string "ejwigtaibxng"
+L81: .string "pcstdnve"
+lea L245, r1
+L82: .data -901, -153, -204, -389, -61
+L83: add #46, *r3
+not *r4
+clr L238
+L84: .string "vjqz"
+
+L85: prn *r1
+not r2
+L86: .string "tyfvekkjjznlvht"
+add r6, r0
+clr L141
+L87: add *r7, L173
+rts
+L88: stop
+cmp r1, #130
+jmp *r5
+clr *r6
+L89: .string "tevhvxmmgc"
+L90: .string "eankfpxtlpnuxwvrvkvoxb"
+lea L87, r5
+lea L63, *r7
+L91: rts
+sub *r0, r0
+clr r4
+inc r3
+sub r3, L121
+clr L20
+L92: .string "lrh"
+mov L50, r0
+L93: .data -451, -659
+jsr L240
+L94: .string "orwodrvkailb"
+L95: jmp *r6
+L96: .string "hhpyfcslkgmjazbxcjtjiely"
+mov L16, r5
+inc r0
+rts
+jmp *r2
+jmp L73
+L97: jmp *r2
+inc *r5
+red L118
+L98: dec *r3
+not *r5
+L99: dec r5
+L100: .string "uqycfwgvhdxfkujoqf"
+bne *r3
+L101: stop
+L102: .data -828, -929, 151
+mov r4, *r4
+rts
+stop
+L103: rts
+L104: prn r0
+not L211
+prn *r5
+inc *r5
+sub r1, L115
+mov *r3, *r1
+clr L59
+lea L235, r4
+prn r7
+inc r5
+add *r6, L231
+add r5, r4
+bne L141
+L105: dec *r4
+not r0
+L106: .string "llzftphvtmojbv"
+L107: not *r7
+L108: red *r5
+not *r0
+jsr L98
+mov #-150, r4
+stop
+jsr L119
+red r3
+rts
+L109: sub r3, L87
+L110: cmp *r7, L219
+cmp r5, #-160
+add r5, L165
+L111: sub r1, *r4
+stop
+cmp #152, L104
+L112: add r4, *r5
+mov L223, *r4
+prn *r4
+stop
+stop
+red *r2
+jmp L32
+L113: .data 150, 188, 364, -724
+sub r3, *r2
+L114: prn #133
+jsr L132
+rts
+mov #135, L62
+L115: dec r3
+jsr L212
+bne *r0
+mov r5, r5
+sub *r3, L180
+inc r1
+L116: mov r7, r3
+rts
+add L199, L67
+L117: clr *r4
+mov r6, *r0
+stop
+prn #-65
+clr r7
+jsr *r4
+add #247, L255
+clr r0
+inc r3
+rts
+; comment
+L118: rts
+inc L180
+stop
+red *r1
+sub *r7, L77
+stop
+red *r4
+clr *r3
+L119: .string "bhy"
+mov r5, r1
+
+mov L101, r7
+lea L145, *r2
+L120: inc L103
+L121: red r1
+sub #243, L247
+dec *r4
+L122: jsr *r3
+bne *r5
+mov L67, *r4
+dec *r3
+not r6
+bne *r0
+jmp L48
+prn #-201
+L123: .data -718, -80, 379, -271, 544, 131
+cmp #-9, r1
+; comment
+L124: .string "fpcxjqevksetkvqmpn"
+clr L227
+red L81
+cmp r3, *r2
+not L80
+jmp L28
+cmp r5, #-170
+L125: rts
+lea L103, *r5
+add *r1, r1
+jmp *r7
+prn L148
+L126: inc *r2
+prn #-61
+prn L180
+sub r3, L9
+sub #-144, r5
+dec r1
+jmp L129
+L127: red *r3
+mov #142, r4
+mov #167, *r4
+cmp L146, *r1
+add L97, r3
+jmp L186
+not *r0
+lea L53, r6
+L128: clr r7
+prn r3
+cmp *r7, *r4
+add L106, L133
+jmp L181
+mov *r5, L60
+rts
+bne *r2
+red *r5
+not L221
+not r3
+rts
+sub r1, r6
+L129: lea L135, *r4
+rts
+L130: dec *r5
+sub r7, r1
+sub #-150, r6
+add *r1, *r4
+lea L233, *r5
+L131: .data -959, 485, 73, -654
+sub r2, L157
+L132: .data -41, -802, 224, 748, 863, 524, -651
+dec L49
+inc L111
+sub r6, r2
+inc *r5
+L133: .data 605, -866, -159, -888, -310, 657, -384
+
+L134: inc *r3
+clr r1
+jmp *r0
+add L155, L26
+rts
+L135: mov *r3, L39
+L136: .string "hfqhbnuezkzi"
+L137: not *r5
+; comment
+dec *r5
+cmp r1, r1
+jmp *r1
+L138: red L161
+red *r0
+L139: .data -924, -647, -56, 224, 195, 819, -845
+L140: .data 125, 306, -958, -491, 954, 632
+lea L130, *r5
+sub r2, L193
+jsr L71
+sub #-239, *r1
+; comment
+
+rts
+prn r3
+L141: cmp L70, L42
+clr *r1
+mov L96, r0
+L142: red L177
+L143: .data 906, 623, 232, 655, -706, 995
+L144: .string "zdfpjtjg"
+not r3
+red *r0
+sub L51, r6
+; comment
+stop
+bne *r4
+inc *r2
+
+jsr *r1
+L145: add *r0, *r3
+; comment
+sub L126, L224
+L146: lea L102, *r0
+clr *r6
+L147: cmp L48, #30
+L148: sub r3, *r1
+stop
+clr *r7
+not L75
+bne *r1
+inc *r1
+jmp L238
+cmp r6, #220
+L149: jsr L240
+mov #-45, r1
+jsr L20
+sub #51, r5
+not *r2
+bne L79
+mov L159, *r4
+not *r6
+L150: .data 579
+L151: clr r0
+L152: .string "witgdonolx"
+stop
+cmp *r7, L23
+bne L53
+prn L47
+inc r5
+L153: lea L194, r6
+jsr *r7
+
+mov #-98, r2
+lea L37, *r2
+L154: .string "szpklsehcmhuudidvh"
+sub L188, *r5
+clr *r5
+L155: jmp *r2
+clr *r0
+L156: .data -864, -649, -718, -4, 363, -232, 546, 509
+jmp *r0
+not r5
+L157: .string "juwgmthkjmuflcqqa"
+jmp L147
+lea L2, *r0
+clr *r1
+clr r5
+lea L237, *r6
+L158: inc L152
+L159: jmp L192
+L160: prn r2
+clr *r2
+red r1
+stop
+sub #-147, r5
+clr L30
+L161: sub *r5, L206
+lea L131, *r1
+stop
+jsr *r5
+not *r6
+not *r6
+dec r2
+L162: cmp L102, #206
+L163: lea L192, *r1
+red r6
+inc r0
+inc r5
+dec r4
+jsr *r6
+lea L212, L63
+L164: .string "gkvnnuzcraeqxenzxymoe"
+bne L207
+add L221, *r5
+; comment
+stop
+rts
+L165: .string "pyfbjrfltbrapcpndebci"
+L166: cmp *r4, *r5
+bne L229
+clr r3
+mov #-23, r3
+cmp L1, L192
+mov *r7, L255
+jmp L220
+L167: .string "wvnrzashjhmfmntd"
+lea L65, L39
+L168: .string "q"
+prn #-2
+
+inc r2
+L169: .string "ovu"
+cmp r7, *r7
+L170: cmp #-161, *r7
+L171: .data 273, -635, -506, -198
+L172: cmp r6, #-2
+prn r1
+dec *r3
+dec r2
+inc L137
+prn L224
+stop
+L173: cmp *r2, #155
+rts
+L174: lea L33, *r5
+inc L158
+L175: sub #-175, *r1
+lea L87, L150
+jsr L156
+mov L172, r0
+L176: prn L239
+jsr L221
+L177: .data 742, 384, -284, 169, -568, -432, -600
+stop
+L178: not *r5
+mov L253, *r4
+mov *r3, r0
+rts
+lea L202, *r2
+cmp L94, L194
+clr L191
+dec L121
+not *r6
+prn L70
+rts
+L179: .string "scrdqlexjuhtg"
+sub r1, r2
+L180: stop
+sub L238, *r5
+jmp *r4
+L181: .data -66, -741, -359, 339, 463, -162, 596, -816
+add L119, L212
+dec L199
+clr *r6
+L182: .string "yhlagh"
+prn L238
+mov #147, L221
+; comment
+cmp L238, L88
+inc L233
+mov L241, r4
+sub *r0, r5
+dec r4
+jsr L220
+stop
+L183: prn *r5
+mov L213, r3
+jsr *r4
+clr r5
+dec L80
+jsr L65
+sub *r7, L235
+cmp *r2, *r7
+red *r4
+mov r0, *r0
+rts
+jmp L242
+L184: .data 319
+inc L78
+L185: .string "widppvxpuwbwktygcyp"
+jsr *r5
+add #187, L237
+L186: dec *r0
+L187: sub L192, *r0
+L188: .string "ldkypexuabrrvw"
+prn *r2
+; comment
+L189: .string "hiykphgfqgppltv"
+jmp L230
+L190: jmp *r6
+L191: .string "eisukzqbztkrjq"
+dec r3
+L192: sub #129, *r5
+prn *r6
+red r0
+cmp #-207, L125
+sub L80, r5
+rts
+stop
+dec *r4
+L193: clr r1
+stop
+
+prn *r6
+not r7
+jmp L101
+L194: lea L233, r6
+prn L182
+bne *r5
+
+stop
+lea L224, r5
+dec *r6
+jmp *r4
+rts
+jmp L52
+red *r6
+L195: sub *r2, *r6
+mov *r1, r2
+jmp *r1
+lea L205, *r3
+cmp r6, *r0
+clr r4
+L196: .string "flywtzsrg"
+red L233
+L197: cmp L164, r7
+bne *r3
+prn L44
+L198: .data -174, 999, -425, 650, 710
+rts
+rts
+mov *r3, L65
+L199: .string "mpswny"
+jsr *r7
+L200: prn #-255
+L201: not *r4
+; comment
+L202: prn #-101
+L203: .string "lhrgbdypkos"
+dec r7
+L204: lea L27, r2
+red *r4
+red L158
+jmp *r0
+not *r4
+L205: .string "j"
+clr *r3
+add *r1, *r2
+L206: .data -463, 907, -725, -627, 917, 252, -732
+L207: mov r3, *r7
+clr *r6
+dec *r1
+L208: .data -878, -59, -38, 781, 182, 178
+prn r0
+lea L246, r1
+mov #-67, r4
+add *r4, *r5
+jsr *r1
+stop
+not L195
+red r3
+cmp *r4, L166
+stop
+jsr L31
+
+sub *r4, *r2
+stop
+jmp *r3
+clr r6
+stop
+L209: .string "gimiazdujceyguaimxcmyxd"
+sub #228, *r1
+prn L135
+L210: .data 991, 566, 63, 235, 220
+L211: .data -322, 334, 49, 174, 990
+red *r6
+L212: jmp *r0
+L213: lea L245, L37
+sub L173, *r3
+L214: inc r7
+dec L104
+lea L218, L255
+add r0, *r0
+add #86, r4
+stop
+stop
+clr L14
+L215: red r0
+lea L236, r4
+jsr L243
+L216: cmp #46, *r3
+L217: red r5
+
+jsr *r1
+add L163, L134
+L218: prn r3
+lea L241, L236
+mov #-105, r4
+mov r3, r5
+L219: clr L101
+prn #188
+L220: .data -950, 991, 987, -520, -387
+inc *r3
+stop
+sub #213, *r2
+L221: mov #125, r5
+L222: rts
+add r5, L121
+L223: red r6
+jsr *r2
+prn *r7
+dec *r6
+L224: .string "xn"
+stop
+cmp L229, #221
+lea L59, *r4
+mov L230, *r5
+rts
+jmp *r5
+inc r2
+
+L225: inc r2
+L226: .data -439, 48, -643, -428, 184
+inc L197
+add L16, r5
+lea L255, L3
+dec *r1
+clr *r2
+dec r6
+sub *r6, *r3
+L227: .data -610, 351, 526, 403, 709
+jmp *r4
+dec *r7
+sub *r3, r4
+L228: .string "shkyeujeensxxi"
+prn r1
+; comment
+inc *r3
+inc L68
+lea L243, *r0
+L229: dec r3
+rts
+L230: .string "uyshlwbgx"
+jmp L235
+L231: sub L242, *r4
+not r4
+L232: .string "w"
+jsr *r0
+not L243
+
+prn *r3
+jmp *r1
+jmp *r0
+L233: inc *r1
+inc r2
+; comment
+bne *r0
+prn #248
+mov #-253, *r4
+; comment
+L234: jmp *r4
+lea L114, *r3
+L235: red r7
+L236: .data 726, -579, 27
+jmp *r0
+mov L255, L238
+red r5
+; comment
+bne *r2
+stop
+rts
+add r0, r7
+prn L185
+L237: clr *r1
+not r4
+sub L249, *r4
+red L68
+not *r0
+L238: stop
+not r5
+L239: not *r1
+rts
+jsr *r7
+dec r7
+L240: .data -414, -378, -237, 114, 358, 843, 813, -842
+L241: .data 579, -13, 972, -112, 255, 773
+jsr *r2
+prn #-13
+L242: red L243
+cmp L249, *r1
+add L252, L2
+rts
+cmp #-144, *r4
+jsr *r5
+dec r5
+prn L85
+L243: .data 550, 757
+L244: .data -721, 932
+clr r3
+clr *r3
+jsr L247
+L245: dec r3
+not *r1
+jmp *r5
+L246: rts
+L247: cmp r6, L3
+sub *r2, L97
+jmp *r5
+L248: bne L255
+bne *r0
+bne *r0
+L249: not r4
+sub *r3, *r1
+add r3, *r1
+bne L254
+L250: mov r7, *r5
+L251: .string "dnaltke"
+add #205, L216
+
+sub *r3, L255
+cmp r5, *r7
+bne *r6
+prn L61
+prn L254
+L252: clr L253
+not r2
+L253: red r1
+L254: stop
+inc r2
+L255: mov *r0, r5
+lea L164, L29
+rts
+mov #245, r3
+
+add *r5, L8
+mov r4, *r4
+red r5
+lea L47, *r6
+stop
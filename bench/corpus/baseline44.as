@@ -0,0 +1,1019 @@
+; Generated by genCorpus --seed 45
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+L0: stop
+not r5
+; comment
+red L0
+mov L0, r4
+cmp *r5, r4
+clr r7
+L1: .data -651, -331, 488, -80, -189, -886, -114
+cmp L0, L109
+add L1, L1
+cmp r1, L1
+sub #193, L20
+inc L0
+prn r4
+inc *r4
+red r6
+dec r6
+mov *r2, *r2
+lea L1, *r7
+dec r1
+not *r4
+L2: stop
+L3: .string "fytuqukunbybp"
+not *r7
+lea L1, *r4
+dec *r1
+inc r5
+stop
+cmp r6, *r2
+clr L89
+dec r7
+add r6, *r5
+inc *r1
+stop
+L4: stop
+L5: .data -923, 210, -145, -923, -509
+sub #-194, *r4
+L6: .string "kibbcksjv"
+lea L1, r7
+jmp L158
+jsr *r5
+clr *r7
+jmp *r2
+bne L6
+mov #-37, *r3
+L7: .string "hszihtmhqncamrqhpguy"
+L8: inc r6
+dec *r6
+mov #40, L6
+L9: rts
+lea L7, L6
+red L6
+stop
+mov r7, *r0
+L10: .string "szav"
+rts
+lea L2, *r3
+L11: clr *r2
+L12: rts
+not L101
+L13: clr *r6
+L14: .string "dzkaxdmk"
+L15: jsr L112
+L16: stop
+L17: stop
+rts
+mov *r0, L17
+L18: .string "ls"
+stop
+dec *r3
+L19: sub *r2, r7
+; comment
+add L10, r6
+red *r3
+bne *r5
+L20: .data -324, 903, -92, 384
+L21: clr r4
+L22: clr L199
+bne L89
+mov *r4, r6
+L23: .data 500, 751, -157, 232, 276, 553, -218, 403
+L24: dec *r2
+rts
+jmp L23
+; comment
+clr L135
+clr *r2
+jmp *r0
+not r6
+L25: red *r2
+lea L22, L99
+sub L1, L23
+L26: lea L22, *r6
+mov *r2, *r0
+sub #202, r6
+rts
+L27: inc *r7
+lea L25, L15
+L28: rts
+jmp L152
+red *r4
+lea L227, L211
+L29: not *r4
+cmp *r3, L208
+rts
+rts
+mov L196, r1
+jmp *r3
+L30: cmp L17, r0
+bne L40
+dec *r5
+inc L92
+jsr L18
+jsr *r5
+L31: mov r3, r1
+jmp L19
+; comment
+dec r7
+mov *r7, *r2
+L32: not L8
+; comment
+L33: .string "jkmpxvxskkqoxxjxulumrbv"
+mov r5, L123
+L34: sub r7, r2
+not r4
+stop
+jsr L1
+L35: .data -190, -797, -765, 661, 118, -529
+bne L27
+inc r3
+L36: mov *r2, L16
+prn #-33
+lea L148, *r6
+jsr *r7
+mov r5, *r7
+L37: cmp L244, L57
+clr *r3
+add #-25, *r3
+jsr *r2
+L38: jsr *r1
+L39: inc *r3
+prn r6
+mov #12, L21
+inc L118
+prn L20
+clr L234
+add L7, L23
+not *r5
+L40: .data 193, 43, 992, -264, -258, 675, -689, 511
+not L17
+lea L179, L128
+dec L255
+clr L199
+lea L26, r2
+inc r1
+not L47
+not r5
+L41: .data -76
+prn r6
+rts
+jsr *r5
+stop
+jmp *r6
+jmp *r6
+L42: rts
+not *r7
+L43: jmp L17
+jmp *r5
+mov *r6, L10
+mov #201, L12
+lea L227, *r5
+mov *r7, *r6
+not *r6
+red r1
+red L0
+clr L7
+; comment
+cmp r1, r0
+bne *r2
+inc L144
+inc r6
+clr *r2
+mov *r0, *r7
+jmp *r6
+clr L36
+L44: .data 879, -367, -685, 355, -790, 614, 134, -879
+jmp *r3
+mov r2, r2
+L45: rts
+lea L22, L6
+bne *r7
+clr r6
+L46: lea L11, *r4
+lea L0, r0
+L47: inc L48
+lea L100, L36
+; comment
+sub L18, r3
+add #128, L229
+clr L243
+mov r4, r5
+L48: prn #114
+L49: jmp *r7
+cmp L102, r6
+add L11, *r3
+L50: jsr *r6
+; comment
+L51: .string "tgtygbmtginc"
+lea L23, L140
+not *r4
+
+cmp L14, r6
+L52: .string "kusiclcp"
+sub #158, L206
+jsr L208
+jsr L138
+rts
+L53: clr r3
+prn #-22
+add #-66, *r0
+dec L63
+lea L175, r7
+sub #221, *r3
+L54: .data 979, 955, 543
+L55: add *r3, L39
+jmp L65
+not r3
+L56: .string "dlzteb"
+L57: cmp L167, *r6
+clr *r5
+lea L36, r3
+add #103, *r1
+rts
+cmp #104, #-12
+bne *r4
+dec L205
+rts
+L58: .string "irnryu"
+mov #-82, L13
+L59: jsr L238
+L60: clr L0
+dec r0
+cmp #-242, #-25
+L61: .string "zowapva"
+lea L230, r3
+L62: jsr L39
+prn #-249
+jmp L148
+jsr L51
+mov r1, r6
+jsr L100
+prn *r2
+add *r6, r1
+rts
+jsr *r5
+L63: .data 609, 931, 970, -103
+
+red L67
+inc *r6
+bne L52
+red r2
+inc L107
+stop
+cmp *r1, *r5
+sub *r5, r5
+L64: bne L93
+jmp L30
+L65: .data 426, -299
+stop
+lea L125, *r3
+lea L48, L6
+L66: .data 340, -719, 856, -261, 6
+jsr L166
+L67: inc *r0
+L68: .string "ndqakqlxebzhzmufnuvno"
+L69: lea L181, *r0
+L70: stop
+add *r0, *r6
+L71: .string "dejfdfupfracqqj"
+L72: prn r5
+prn #195
+clr *r0
+dec L93
+rts
+dec *r2
+; comment
+stop
+jsr L40
+jmp *r5
+jsr L173
+L73: .string "lhyhhshwufxkxqu"
+L74: inc *r2
+cmp r6, *r6
+bne L221
+jsr *r6
+dec L1
+rts
+lea L182, r3
+stop
+stop
+L75: clr r2
+not L57
+add #57, L184
+prn L20
+L76: lea L10, *r5
+dec L52
+cmp r7, #21
+L77: lea L75, *r7
+bne *r4
+L78: sub *r5, L199
+jsr L46
+clr r0
+jsr L63
+cmp L43, *r1
+rts
+stop
+stop
+add r5, L140
+jmp L220
+L79: sub #64, *r5
+L80: lea L23, *r5
+L81: clr r7
+sub L99, *r3
+rts
+sub L69, r7
+rts
+L82: .string "lbdlp"
+sub r5, *r1
+inc L168
+inc L158
+; comment
+rts
+inc r6
+L83: .string "ojpbkksswi"
+mov r6, L32
+lea L27, *r7
+add L119, r2
+clr *r7
+L84: bne *r1
+prn L15
+
+dec r6
+L85: .string "rmrlcrweuhzjfvvyoniojgu"
+stop
+jsr L139
+L86: sub L94, *r2
+L87: cmp L85, *r3
+inc *r3
+cmp r3, L168
+mov *r7, *r6
+stop
+L88: .string "byeckynjriqirfcwve"
+not r6
+dec *r6
+mov L42, L141
+L89: add #25, L171
+clr *r1
+sub *r5, *r2
+inc r7
+jmp *r2
+bne L96
+lea L182, *r3
+bne L31
+jmp L199
+; comment
+rts
+lea L232, *r4
+L90: bne L14
+jsr L181
+cmp *r7, #177
+L91: .data 935, 162, 616, 179
+jmp *r0
+clr *r5
+L92: clr *r2
+bne *r2
+dec *r0
+L93: stop
+jsr *r1
+L94: .string "mrdsyldliamfeyboaliaias"
+
+inc r3
+stop
+dec *r4
+L95: inc L59
+L96: rts
+stop
+cmp #-92, L11
+lea L4, *r4
+L97: .data 146, -509, -589, 740
+sub *r1, L189
+L98: add L252, *r2
+mov r1, L72
+dec L33
+clr *r7
+L99: .string "cqsvvqkxsfeejytzuesiuudt"
+red r2
+L100: rts
+not L139
+L101: jsr *r0
+lea L153, *r7
+L102: .string "cho"
+inc L224
+rts
+prn #176
+mov L129, L159
+L103: prn L151
+dec L55
+
+L104: .string "yqbwjecsgirtdqkucc"
+L105: jmp L181
+L106: dec r7
+L107: .data 921, -604
+rts
+not r7
+bne L54
+L108: stop
+inc *r5
+not L182
+clr *r6
+prn #-168
+jmp *r5
+jsr L93
+L109: .data -383, -635, 380
+dec *r0
+stop
+inc L252
+prn L257
+red r0
+
+L110: .data -927, 342
+L111: jmp *r3
+prn L137
+L112: sub L232, L100
+L113: prn r4
+L114: lea L27, r4
+jsr *r1
+L115: bne *r4
+L116: .string "erefb"
+add r7, L54
+mov r0, r5
+stop
+mov *r4, L18
+mov #141, r4
+L117: jsr L247
+sub *r4, r6
+lea L207, *r4
+L118: jsr *r2
+jsr *r0
+prn r3
+lea L3, r2
+L119: .data -604, 796, 575, -632, 500
+; comment
+jmp L217
+bne *r0
+lea L75, *r0
+; comment
+dec *r2
+L120: .string "xbhsjzzyjjcpjvsyepadthkw"
+not *r0
+clr L158
+L121: sub r2, *r5
+add #-107, L125
+L122: add *r4, L234
+L123: .data 353, 589, -105, 500, 128
+mov L216, *r4
+cmp *r1, #-1
+lea L205, *r3
+stop
+clr r6
+mov L222, L148
+cmp *r6, *r1
+bne *r6
+L124: not *r2
+L125: stop
+L126: .string "irsygdpvx"
+dec L239
+mov L144, r4
+cmp L191, *r2
+L127: sub L212, L27
+jsr *r0
+L128: jsr *r6
+L129: not r2
+; comment
+bne L114
+jsr *r1
+prn *r7
+stop
+L130: prn L179
+jmp *r3
+
+add L146, r3
+L131: .data 827, -912, -205, -500
+jmp L89
+clr L147
+red r2
+add L252, *r4
+L132: mov *r5, r2
+L133: .data 14
+bne *r0
+cmp L117, *r7
+red r3
+prn #195
+not L125
+add r6, *r0
+dec L58
+lea L100, r5
+L134: lea L212, r7
+L135: clr L132
+L136: bne L202
+add r7, r1
+L137: red *r1
+L138: .string "spvv"
+jsr *r6
+L139: .string "ypoofzqphbiwqvzc"
+lea L36, r3
+L140: prn r0
+add L122, r0
+cmp r2, #161
+sub #-237, r7
+L141: .string "qgebtp"
+dec L44
+L142: sub #-198, L127
+jmp *r2
+jsr *r2
+prn #-19
+L143: .string "cnhvrag"
+L144: inc *r5
+red L236
+L145: dec r2
+stop
+not r3
+mov L76, *r5
+clr r3
+L146: mov r1, *r1
+dec r3
+jmp L124
+L147: jmp *r6
+jmp *r2
+mov *r7, r0
+L148: .data -255, -418, -988, 369, 720, -832, 215, 272
+dec *r3
+; comment
+inc *r2
+rts
+not L153
+L149: .data -921, -427, 540, 497
+L150: sub L205, L88
+L151: red *r1
+bne *r0
+rts
+L152: rts
+lea L145, L78
+clr L157
+bne L29
+jmp L147
+inc *r1
+L153: .string "ksdcatytiqxfxclpptxpfhia"
+cmp L140, *r4
+not r5
+L154: .string "ouevegavmjvw"
+L155: cmp L173, *r4
+sub L1, L156
+dec *r7
+jmp *r5
+cmp r6, #252
+bne L106
+red r6
+add r0, L254
+not L62
+jmp *r6
+rts
+jmp L103
+L156: .data -214, -709, 845, -461, -602, 656, 539, -679
+; comment
+inc *r2
+L157: mov #-108, L247
+add L247, L215
+L158: .string "fwafnhtpgfgmlm"
+not L133
+stop
+L159: .data -551, 287, -770, -569
+jsr *r4
+dec r1
+L160: clr *r1
+L161: dec r5
+stop
+L162: .string "rahpahbfnbyq"
+lea L239, r6
+stop
+cmp *r6, L121
+cmp #2, L163
+red L166
+L163: jsr *r7
+jsr L228
+L164: lea L8, L172
+L165: bne L133
+bne L140
+jsr L214
+bne *r5
+stop
+rts
+bne *r2
+L166: .string "zxezxdmurapahmdmfexq"
+not *r0
+add r6, L256
+jmp *r4
+prn L86
+L167: red L81
+L168: .data 246, 200, 189, 942, -708, -528, 628
+bne L4
+rts
+prn r1
+mov *r3, *r1
+L169: .string "scho"
+cmp *r0, r0
+mov #200, r7
+not r1
+prn #-71
+L170: .data 393, 64
+sub #-1, *r7
+bne *r1
+cmp *r4, #204
+L171: jmp L188
+not *r4
+L172: .string "smhkjmcppmemnvep"
+stop
+L173: .data 156, 262, 98, 786, 615, -196
+L174: .string "rwwotucslysvxebnurtjyt"
+L175: .string "af"
+dec r7
+rts
+; comment
+L176: .string "hp"
+rts
+cmp #-91, *r1
+prn L216
+not r0
+inc *r7
+prn L241
+; comment
+inc L122
+jsr *r6
+dec r6
+sub #32, r1
+L177: inc L180
+L178: .string "g"
+lea L112, L179
+; comment
+not L102
+L179: .data -216, 102, -845, 26, -449
+mov r3, L252
+; comment
+jmp L149
+jmp L138
+sub #-23, r6
+; comment
+not r4
+jsr L234
+jsr L179
+cmp #55, *r0
+L180: .string "e"
+mov #-256, *r1
+not *r4
+L181: .string "qudeij"
+L182: .data -937, 313, -766, 559, -687, 509
+L183: rts
+L184: mov *r7, r1
+jmp *r5
+add r6, L40
+inc *r2
+jmp L93
+L185: .string "w"
+rts
+stop
+not r6
+inc r7
+L186: .data 836, -828, -950
+sub L146, *r2
+jsr *r7
+not L260
+jmp *r1
+dec r1
+
+L187: jsr L144
+
+bne *r7
+L188: .string "ddkituhmaolsebyoxattxxo"
+lea L22, L219
+dec r6
+clr L209
+L189: bne L209
+rts
+inc r3
+
+not L230
+add r3, L246
+; comment
+stop
+sub #-169, r0
+red r3
+lea L42, r4
+L190: jmp *r6
+L191: bne L42
+red L235
+L192: .data 577, -96, -15
+sub L121, r2
+L193: dec r7
+rts
+L194: .data 87, -816, 181, -249, -257, 234, 285
+stop
+lea L103, *r5
+jsr L260
+L195: inc L252
+L196: .string "ysjqdspjqanmgwnaznqybug"
+lea L79, r3
+not L257
+dec *r5
+mov #62, L230
+prn r7
+lea L259, *r7
+L197: jmp L82
+cmp #72, r3
+red *r2
+mov #-2, *r7
+cmp *r7, *r5
+dec r4
+sub *r7, L98
+sub #-222, *r3
+sub #98, L165
+rts
+stop
+not r3
+dec r7
+sub r6, r7
+clr L161
+red r2
+jmp L14
+L198: .string "yppuy"
+L199: jmp L259
+prn L233
+L200: .string "qbpx"
+sub L143, r7
+lea L239, L213
+prn L94
+jmp L124
+dec *r5
+bne *r6
+L201: jmp *r4
+L202: red r6
+bne *r2
+L203: prn L77
+prn r4
+L204: bne *r3
+inc r2
+jsr *r5
+add #-37, L64
+sub *r7, *r6
+L205: red *r1
+add *r2, r3
+L206: sub L119, *r4
+mov L246, *r2
+L207: bne *r0
+sub r1, L192
+L208: cmp r1, r7
+red *r0
+prn L12
+; comment
+L209: lea L231, L205
+jmp L249
+not *r7
+L210: clr *r4
+L211: cmp L259, #-131
+L212: .data -131, 949, -806, 891, 59
+rts
+jmp L260
+L213: lea L12, L241
+prn #169
+rts
+red L235
+bne L260
+bne *r4
+prn L116
+
+clr *r7
+jsr *r2
+L214: jmp L138
+dec *r3
+inc L233
+add L71, *r1
+red *r5
+rts
+stop
+L215: .data 343, 381, 976, 107, 638, 775
+cmp r5, #-170
+cmp *r3, L7
+clr L242
+L216: .string "eyvjonmjegqginnh"
+jmp *r0
+mov L241, *r5
+add r4, r6
+L217: sub r0, *r1
+clr L236
+rts
+clr L244
+L218: red r5
+L219: mov *r6, r7
+
+lea L258, *r2
+clr L135
+jsr *r1
+stop
+add r3, *r7
+L220: jsr L246
+dec *r1
+jsr L96
+lea L252, r6
+
+L221: jmp L40
+L222: add L214, r6
+L223: .data -416, 610
+rts
+L224: .string "ruymkjb"
+mov L108, *r3
+cmp #-32, r4
+cmp r0, *r0
+jsr *r0
+prn L196
+L225: sub *r5, r2
+red L250
+not L34
+add r7, L225
+mov *r7, *r3
+clr L239
+rts
+cmp L236, #-244
+jsr *r7
+L226: not *r7
+cmp r6, L257
+dec L16
+not L85
+L227: prn r1
+L228: .data 237, 110, -308, -958, 664, -311, -766
+L229: sub *r0, *r3
+red L237
+L230: .string "ts"
+L231: add #48, r4
+jsr L205
+L232: jmp *r1
+lea L243, L13
+clr *r6
+rts
+red L253
+red L214
+prn L252
+jsr L245
+mov *r7, L249
+red L1
+bne *r5
+red L240
+sub *r7, r1
+L233: .data 370, -954, -840
+red *r4
+lea L236, *r5
+rts
+mov r6, L90
+bne L137
+not r4
+clr *r0
+sub L174, *r2
+clr r4
+L234: .data 113, -920, 992, -592, 125
+L235: .data -330, -996, -949, -905, -78, -107, 834, 900
+lea L208, *r7
+cmp r4, L244
+clr *r2
+L236: .data 797, 624, -745, -746, -507, -685, -451
+stop
+; comment
+cmp *r4, *r3
+jmp L257
+sub #-74, L223
+add r0, r1
+not *r2
+L237: .string "gnxmznhk"
+jmp *r7
+L238: .data 488, 841, 529
+sub r2, r6
+clr r4
+sub r3, r1
+cmp L247, L257
+jsr *r3
+jsr L247
+lea L254, *r3
+mov r0, r4
+prn L244
+L239: jsr L115
+L240: prn L34
+red L250
+lea L116, *r3
+red L251
+dec L259
+L241: .data 628, 375, 695, 841, -449, 208
+mov r5, L235
+L242: prn #38
+L243: lea L259, L71
+not L15
+rts
+L244: prn #-171
+L245: sub *r4, L246
+L246: add *r2, r1
+prn r4
+; comment
+rts
+mov *r1, r1
+add L250, *r4
+; comment
+mov L193, r5
+mov r2, *r7
+clr r5
+not L253
+L247: sub #-14, *r3
+inc *r3
+lea L208, *r6
+jmp *r7
+; comment
+L248: .data -399, -617, 192, -985
+jsr L59
+inc L155
+jmp *r6
+sub #-83, L94
+L249: .string "aqxfesn"
+dec *r1
+L250: bne *r3
+L251: clr *r2
+mov L252, L258
+clr L17
+dec r7
+clr r3
+clr L254
+L252: .string "hqrreydhenkwnopoxokzt"
+jmp *r6
+dec L246
+inc L253
+sub #-208, L256
+dec r5
+clr *r2
+rts
+cmp #238, #164
+add *r7, L230
+prn r6
+prn #104
+prn #49
+bne L243
+jsr *r6
+prn *r4
+cmp r5, r0
+add L220, L187
+L253: .string "nngdveztnrltevcaxijqo"
+L254: jmp L257
+inc r1
+L255: not *r1
+L256: .string "uayiqqeuxkpaougdhxvw"
+lea L260, L260
+jmp *r3
+lea L222, L211
+stop
+jsr *r0
+
+clr *r4
+rts
+lea L11, L189
+dec L210
+L257: jmp *r2
+stop
+L258: .string "wajjgooztkjatpfqh"
+cmp r3, L260
+red *r6
+add #-16, r3
+mov r1, L259
+L259: jmp *r0
+prn *r5
+red *r2
+stop
+L260: .string "yyabmcjlpbyvyafnihs"
+not r5
+rts
+clr *r5
+red *r2
+inc r7
+add L94, r4
+dec L113
+cmp *r2, #70
+dec *r5
+stop
+clr r2
+stop
+add *r0, L225
+jmp *r0
+add L80, *r2
+prn #94
+stop
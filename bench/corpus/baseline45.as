@@ -0,0 +1,1020 @@
+; Generated by genCorpus --seed 46
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+jmp *r1
+L0: .data 677, -935, -148, -410, -150, -130, 836
+cmp #-151, L117
+mov *r7, *r1
+add *r4, r2
+dec L209
+lea L0, r4
+mov r3, r7
+jmp L0
+inc *r0
+bne *r7
+L1: .data -885
+mov *r7, L107
+bne L211
+jmp *r3
+jmp *r4
+dec L0
+dec L47
+rts
+L2: .string "ufuwuxim"
+dec L159
+clr r2
+inc *r2
+L3: clr r3
+L4: prn r4
+L5: .data -818
+dec L228
+L6: not L10
+L7: red r0
+stop
+red *r6
+not L228
+clr L5
+L8: inc r5
+add *r6, *r2
+L9: .data 699, -708, 334, 275, 272, 226, 486, -5
+clr L3
+bne *r6
+L10: .string "ehibubk"
+prn L71
+
+bne L199
+cmp #-50, #-44
+inc r2
+sub L218, *r0
+add #-20, L71
+add r3, *r7
+mov L127, L8
+jsr L3
+
+red *r7
+L11: not L0
+L12: jsr *r7
+jsr *r6
+jmp *r4
+rts
+L13: cmp r1, *r4
+inc *r6
+jmp *r0
+sub #107, r4
+; comment
+cmp r1, *r7
+; comment
+lea L178, *r0
+clr r0
+jmp L2
+inc L56
+clr L9
+clr L0
+prn r4
+add *r2, *r5
+lea L33, L11
+mov *r7, r2
+sub L0, r3
+mov r2, *r7
+rts
+L14: .data 421, 236, 733, -656, -496, 972, 578
+jmp *r4
+cmp *r0, #-205
+red L134
+rts
+not r7
+mov *r0, r2
+L15: rts
+L16: sub r5, L140
+prn *r4
+jmp L213
+lea L9, *r5
+sub L15, r4
+L17: add r5, L10
+L18: red L3
+prn L32
+jmp L6
+bne *r6
+L19: sub r1, r7
+bne L223
+bne L18
+L20: bne *r2
+sub L46, *r7
+inc r7
+jsr L32
+L21: .data -780, 8, -413, 831, -303
+mov L145, *r6
+L22: clr *r2
+bne *r6
+jmp L121
+inc r7
+cmp L9, *r7
+inc r2
+bne L35
+L23: jsr *r1
+inc L10
+prn L2
+L24: .data 231, -833, 745, 700, 231, -393, 871, -515
+rts
+lea L116, *r5
+dec *r4
+not L23
+inc r0
+dec *r2
+L25: rts
+not L6
+L26: .string "trcimcrzwwxcuanpcohtv"
+L27: .data -880, -705
+L28: .string "bsijcqzi"
+L29: clr L196
+L30: red L27
+L31: prn #-213
+prn r3
+rts
+L32: mov L48, L227
+rts
+cmp #120, L2
+L33: .data -223, -618, -674, 65, 32, -161, 242, 591
+add r7, L10
+sub r3, *r0
+add #-144, *r6
+L34: .data -428, -155
+sub L243, r3
+sub r7, *r4
+add L79, *r6
+L35: sub *r7, *r0
+inc r3
+L36: not r3
+L37: add *r6, r5
+add *r3, r6
+L38: .data 596, -991, 902
+add L204, r4
+jsr L26
+jmp L51
+add L26, L37
+bne L28
+inc r2
+sub L218, L192
+add #-166, L23
+; comment
+L39: .data 181, -161, 171, -788
+clr *r0
+sub r1, *r3
+L40: .data -596, -49, 139, -492, 231
+L41: stop
+sub L59, L26
+lea L92, *r1
+inc L4
+jmp *r3
+dec *r7
+dec *r2
+inc *r6
+rts
+add *r2, r0
+stop
+add *r1, r0
+rts
+red L241
+L42: prn #-167
+L43: .string "cotsygfvucmjjt"
+bne *r6
+red r5
+lea L179, *r7
+clr L31
+jsr *r3
+stop
+lea L68, *r3
+
+add L5, L148
+L44: dec r1
+L45: bne *r2
+L46: mov r4, *r7
+L47: bne L186
+lea L92, *r0
+L48: jmp *r5
+; comment
+clr *r4
+dec r2
+
+not L218
+prn #-228
+jmp *r2
+jsr L116
+not L183
+lea L265, r3
+stop
+L49: .string "ilpz"
+L50: .data 151, -757, 452, -911, 577, -148
+add r3, *r1
+L51: not L204
+L52: .string "jfmkepdnikrccsx"
+stop
+L53: stop
+not *r5
+red L251
+prn *r1
+clr L76
+inc L110
+bne *r3
+clr L68
+L54: stop
+not *r0
+not *r6
+jmp L246
+L55: not *r2
+
+stop
+L56: lea L135, r3
+stop
+L57: .data 293, 770, 278, 374, 483, -855
+sub r3, r5
+lea L29, *r6
+jmp *r2
+jmp L62
+red r2
+L58: .data 613, -459, 354, 926, 168, 520, 449, 589
+L59: mov *r2, L252
+add #-94, L43
+jsr L7
+clr L199
+L60: jmp L28
+
+mov r7, *r7
+mov *r0, r1
+cmp #25, #254
+rts
+cmp r5, #-234
+clr r5
+jmp L69
+mov #-53, r6
+L61: .string "niw"
+inc r4
+lea L55, *r6
+L62: .data 505, 406, -828, 924, 715, -812, 192, -960
+; comment
+mov L56, *r1
+; comment
+L63: .data -630, -990, -952
+add *r6, *r2
+bne L22
+lea L75, *r5
+sub L34, L44
+L64: stop
+not *r7
+L65: prn L137
+stop
+L66: not *r4
+L67: sub #42, *r1
+clr *r3
+clr r3
+rts
+lea L27, *r4
+prn r4
+L68: cmp r7, #5
+inc L30
+jmp *r6
+sub *r1, *r2
+L69: .data 354
+add r0, r3
+L70: not L53
+lea L200, L23
+add #36, *r7
+; comment
+stop
+L71: mov *r5, r5
+rts
+L72: jsr *r1
+not r4
+jmp L9
+mov #170, r6
+L73: bne *r2
+; comment
+L74: .string "vfdmgzbvmhtdizjgnvk"
+L75: stop
+sub r7, L60
+cmp L125, L38
+L76: add #-86, L240
+; comment
+lea L234, L43
+L77: lea L250, *r5
+jsr *r4
+stop
+rts
+lea L41, r4
+dec r2
+cmp #105, *r0
+rts
+; comment
+stop
+clr *r2
+stop
+red L30
+rts
+dec r2
+mov #149, *r0
+mov *r7, L21
+L78: clr r7
+add r2, r2
+not r4
+not r1
+jsr L46
+
+; comment
+
+jmp L163
+; comment
+sub #2, L37
+L79: inc r4
+bne *r2
+add L6, L12
+prn L64
+add #202, r3
+stop
+L80: clr *r4
+lea L50, L110
+L81: jsr L104
+red L17
+stop
+L82: inc L46
+L83: clr r7
+L84: .data 158, -345, 685, -792, 156, 296, 93
+dec *r2
+red r6
+jmp *r5
+lea L142, r1
+jsr L60
+not r3
+L85: .string "zazqjjbexpn"
+jmp L166
+clr L158
+add *r7, *r1
+bne L239
+L86: cmp *r2, *r0
+L87: sub #-111, L57
+L88: jmp L62
+sub r4, *r1
+clr L50
+not L118
+rts
+cmp L18, r1
+clr r0
+L89: prn *r5
+jsr L43
+not L37
+L90: inc *r3
+prn #62
+L91: .data -400, -476, -279, 916, -974, -733, 545, 874
+clr *r0
+L92: cmp #-14, L96
+rts
+bne *r0
+bne *r6
+L93: red *r5
+L94: sub r6, *r6
+L95: mov r4, r0
+not r5
+cmp *r1, r2
+L96: dec r2
+L97: .data -502, -969, -809, 241, 68, 366
+L98: stop
+inc *r1
+bne L88
+jsr L185
+L99: stop
+clr *r3
+prn *r7
+L100: red *r7
+red *r2
+stop
+sub L261, *r7
+not *r1
+jsr *r1
+prn *r0
+L101: .data 88, 614, 488, 422, -43, 553
+L102: cmp *r0, L36
+jmp *r2
+jmp L263
+cmp r5, *r2
+prn r6
+L103: inc r0
+jsr *r2
+L104: .data -462, 867, 9, -741, 366, 702, -694
+L105: red *r1
+jsr L85
+bne L83
+L106: .data 697, -920, 826, -855
+L107: mov r6, r2
+stop
+L108: jsr L37
+L109: stop
+jmp *r2
+inc *r5
+L110: add *r5, *r0
+red L102
+stop
+L111: bne L131
+cmp L271, L113
+L112: bne *r5
+L113: .data 20, -801, 899
+lea L77, *r2
+L114: jsr L189
+inc *r0
+jmp L179
+jmp L179
+
+mov #-170, *r1
+L115: not r4
+prn *r4
+jmp *r2
+not r0
+add *r4, L87
+dec *r2
+jmp *r1
+; comment
+L116: jmp L181
+L117: stop
+stop
+clr r7
+jmp L46
+
+cmp *r5, #82
+jmp L58
+jmp L78
+prn *r1
+stop
+; comment
+jmp *r2
+dec r2
+; comment
+L118: red L13
+L119: mov r1, L101
+bne L42
+dec *r6
+prn *r2
+L120: not *r6
+L121: sub #52, *r7
+bne L200
+lea L240, r0
+dec r2
+inc r5
+L122: add r0, L67
+L123: clr r7
+sub *r7, *r2
+stop
+red *r4
+rts
+; comment
+prn *r2
+inc *r6
+not r7
+sub r5, L236
+mov L71, L163
+L124: .string "orrvbjkbrbnb"
+
+sub #48, *r3
+red *r2
+bne *r4
+L125: red r2
+L126: inc r5
+L127: .data -394, -160, -712, -850, -751, 371, -806, -926
+L128: add #165, r2
+L129: .data 141, -854, -366, 725
+; comment
+rts
+L130: cmp L138, *r5
+stop
+add r1, r0
+jsr *r0
+add #-85, L226
+L131: .string "dlapavg"
+L132: .data 328, 59, -572, -13
+not r1
+L133: .string "jxyfaslcemwrygcobqtdamxw"
+jmp L200
+; comment
+dec *r6
+bne *r4
+bne L70
+sub L43, *r6
+cmp L63, #-48
+dec *r7
+red *r4
+L134: lea L242, *r5
+L135: .data -872, 930, 377, -841, -738
+jmp *r3
+inc *r0
+bne *r3
+red L233
+L136: .data -617
+not r5
+L137: mov *r5, L216
+L138: lea L17, r7
+L139: dec L18
+dec L65
+bne L111
+add *r1, *r2
+add r4, r0
+stop
+L140: clr *r4
+jsr L144
+clr L8
+L141: lea L172, r7
+L142: clr r3
+red r1
+L143: stop
+stop
+red r0
+dec L97
+; comment
+mov #-208, *r0
+red r7
+inc r4
+L144: .data -887, 313, -144
+sub r1, r2
+jsr *r5
+L145: .data -105, 905, 925, 385
+lea L163, *r7
+clr *r6
+rts
+L146: rts
+sub *r4, L85
+sub r4, L123
+L147: clr L41
+stop
+L148: sub r5, L254
+not r2
+bne L44
+; comment
+cmp *r3, r4
+L149: .string "cxboiixmstvplmpm"
+L150: .data -428, 259, 453, -139, -232, 705
+rts
+sub #-192, L31
+cmp L125, *r7
+mov #114, *r3
+stop
+L151: .string "jmunmfyvvibrlvqrmaq"
+red L176
+bne L205
+stop
+add L100, r5
+dec L222
+jsr *r0
+not *r5
+prn *r3
+stop
+dec *r1
+L152: lea L228, *r2
+L153: .string "aoamclcdoysbcvgbui"
+add r0, L115
+L154: add r2, r3
+mov r0, L210
+jsr L19
+rts
+L155: inc *r0
+L156: .string "mzfodwafydybw"
+rts
+L157: jsr L29
+jmp *r6
+L158: .string "otzbaxlatubzebpqebwlxo"
+not r2
+bne L230
+sub #-246, r2
+not L177
+jsr L79
+mov r5, *r7
+mov r0, r3
+L159: rts
+jsr L5
+prn #141
+prn r4
+jsr *r5
+add L166, L197
+lea L113, *r1
+stop
+L160: cmp L29, r5
+cmp r0, r5
+prn L201
+L161: .string "g"
+stop
+sub #44, *r5
+inc L63
+sub L207, *r5
+sub #-75, *r6
+rts
+clr L31
+L162: jsr L159
+jmp L237
+L163: rts
+lea L163, L64
+L164: .data -251
+L165: .data -406, -331, -620, -543, 895, -544, -580, 730
+bne L228
+prn #-133
+clr L86
+L166: stop
+L167: prn *r0
+clr r4
+sub *r1, r7
+L168: .string "gaccavwsdlbqtzxa"
+stop
+add L183, r4
+bne *r5
+cmp L125, #-126
+L169: .data 954, 77, 817, -54, 538, -994
+L170: red r0
+
+mov #130, r5
+not *r6
+
+L171: bne *r1
+add r7, L258
+dec r3
+; comment
+bne L232
+jsr L271
+lea L90, r1
+dec L38
+sub *r5, r4
+sub *r1, *r0
+rts
+L172: not L222
+dec r4
+jmp *r1
+L173: mov *r7, *r0
+L174: .data -567, -850, -171, -581, -374, 78
+prn r6
+L175: jsr *r7
+mov *r5, L146
+clr *r4
+L176: add #81, L224
+stop
+jsr *r2
+inc r4
+inc *r3
+L177: red *r5
+jsr *r5
+inc *r7
+stop
+L178: sub *r5, r1
+clr r3
+bne *r5
+lea L204, *r1
+prn *r4
+rts
+cmp *r3, r4
+L179: .string "ayt"
+add *r4, r1
+L180: .string "n"
+dec L49
+dec *r6
+L181: prn #-39
+prn r5
+lea L138, r1
+prn r1
+jmp *r7
+stop
+clr L128
+prn #109
+clr r7
+prn r4
+not L71
+clr L274
+cmp #155, #168
+jsr *r3
+L182: cmp #70, #191
+mov *r5, r0
+L183: mov #-69, *r1
+red r7
+L184: .data -137
+bne *r6
+red L268
+
+L185: dec *r3
+prn r0
+not r7
+L186: .data -76, -147, 411
+dec L26
+lea L228, L253
+mov r1, L97
+L187: .string "nslaqejgfhm"
+L188: cmp *r2, *r6
+stop
+
+
+mov *r4, L270
+L189: .string "hu"
+mov #38, L26
+red *r0
+jsr *r5
+sub *r1, *r3
+inc L216
+dec L218
+not r4
+jsr *r1
+; comment
+add #-8, *r4
+prn r3
+
+rts
+inc L190
+red *r4
+clr *r3
+L190: .string "yvruwvaptzrsdcwxrps"
+not L102
+prn *r4
+L191: .data -576, 815, -755, -75, -402, -27
+L192: not *r2
+inc *r4
+cmp r2, r4
+sub r7, r4
+dec L173
+L193: not r3
+sub r5, *r4
+sub r5, r2
+sub #182, *r1
+not *r5
+L194: lea L159, r4
+L195: .string "hliuqdsdlh"
+cmp r5, r5
+L196: lea L104, L220
+jsr L217
+L197: add #-219, *r5
+jmp *r7
+stop
+stop
+bne *r5
+L198: add *r2, *r7
+jmp *r1
+prn #37
+bne *r2
+not L72
+bne L62
+; comment
+inc L212
+dec L272
+L199: sub #63, r2
+add L250, *r6
+L200: clr *r7
+inc r0
+L201: prn *r4
+stop
+jsr L76
+L202: .string "ucqahycpmje"
+rts
+L203: bne L59
+inc L237
+L204: .string "kpyytsljeqmlpnxaphkzsq"
+stop
+rts
+L205: clr *r5
+prn *r7
+L206: .data -120, 115, 127, -666, -480, 297, -249
+jsr L217
+L207: red L160
+mov #-37, L225
+prn *r2
+L208: .data -986, -294, -760, -307, -761
+not r2
+L209: .string "mkw"
+prn *r6
+bne *r5
+not L76
+mov r0, L193
+L210: jsr *r6
+bne *r2
+lea L7, r4
+red L184
+add *r3, L213
+inc L253
+add #-181, *r1
+clr r3
+inc *r0
+red r4
+sub r1, L103
+L211: not *r6
+jmp *r3
+stop
+L212: not *r3
+L213: clr L30
+dec r1
+L214: red *r1
+jsr L258
+cmp L213, #-221
+prn #7
+rts
+dec L59
+prn r5
+cmp #-247, r1
+L215: cmp r4, r6
+prn *r3
+
+L216: not *r1
+mov #-220, *r6
+red L217
+rts
+L217: red L197
+rts
+inc L174
+L218: .string "fozjfvjupcwdkqncy"
+L219: .string "xsmmhdyetqogkaegjn"
+prn #240
+clr L36
+L220: lea L69, *r4
+jmp *r2
+jmp *r7
+add L272, *r6
+dec r3
+L221: add r3, *r5
+L222: inc L246
+jmp *r4
+L223: .string "tnepsrwysng"
+prn L110
+add L42, *r5
+jsr L229
+sub #94, r5
+add r1, *r5
+jsr L22
+red r2
+mov L266, r1
+L224: .data 881, 798, 388, -654
+not L241
+clr L218
+L225: mov #-210, r7
+L226: .data 917, -299, 356, -520, -74, -410, 27
+L227: .string "yquubbwraadrddkbdainitei"
+bne L74
+dec L129
+clr *r6
+mov L239, r7
+stop
+rts
+red r1
+inc r3
+jmp L263
+L228: dec *r5
+cmp L260, #16
+prn L22
+jsr *r4
+L229: lea L60, *r0
+prn *r5
+bne *r6
+mov #-147, *r3
+L230: mov #126, L245
+red r4
+L231: .string "z"
+clr *r2
+L232: .data 513, -806
+L233: dec *r7
+stop
+add #120, *r7
+stop
+inc L50
+L234: jmp *r4
+L235: prn *r0
+L236: jmp *r3
+lea L36, *r5
+add L91, L252
+dec L246
+
+L237: lea L270, L133
+sub *r4, L265
+not r4
+L238: bne *r7
+add L245, *r3
+L239: red *r4
+L240: .data 225, 633, -862, 232, -77, 82, -140
+L241: lea L246, r2
+dec L270
+bne *r7
+red L186
+L242: .data 158, 681, -51, 608, -157
+jmp L263
+mov L88, L182
+L243: .string "nyfuidptjqmvdv"
+lea L184, *r6
+clr *r5
+red L25
+; comment
+lea L234, r0
+lea L250, L257
+dec r5
+dec *r7
+not *r6
+jsr *r6
+L244: lea L259, r2
+lea L115, L261
+add #233, L274
+L245: add #102, L264
+L246: prn #-92
+L247: dec r1
+jmp *r0
+stop
+add L126, r0
+cmp *r4, L250
+L248: jsr L263
+jsr *r0
+L249: bne L270
+prn #137
+L250: prn #37
+L251: inc *r6
+stop
+L252: jsr L267
+L253: lea L257, L264
+stop
+L254: bne L268
+inc L159
+lea L212, L234
+not L19
+inc L274
+dec *r1
+add r2, L267
+; comment
+jmp *r6
+add r6, *r6
+add *r3, *r3
+add r3, L212
+lea L215, *r4
+prn *r1
+jsr L213
+mov *r0, *r0
+not r4
+not r3
+dec r3
+not *r6
+sub *r5, r5
+jsr *r5
+L255: sub #-34, r1
+mov #-4, *r4
+L256: add *r4, L27
+rts
+mov L269, L55
+clr r0
+L257: jsr L267
+L258: .string "afvrgq"
+jsr L102
+cmp r4, *r7
+add #-151, L11
+L259: .data -679, 105, -200, -520, -530
+dec r4
+rts
+inc L271
+red L22
+L260: .string "fyhduczaog"
+add *r3, *r1
+clr r7
+clr *r4
+dec L273
+jmp L17
+L261: .string "zooejtjwjcryoenvuo"
+jsr *r0
+lea L96, *r5
+mov #-152, r4
+L262: not r1
+L263: .data 217, -695, 524, 300
+jmp L75
+bne *r2
+L264: stop
+cmp L183, L273
+jmp L267
+L265: bne *r3
+L266: .string "sovgstbsju"
+inc r7
+; comment
+L267: .data 798, -396, -22
+L268: .string "abowprgvaskktnssoyshayi"
+jsr *r1
+bne L197
+not r1
+inc *r3
+L269: .string "ssdntitxyjzrjvfyfkwk"
+L270: jmp *r4
+jsr *r3
+clr L272
+cmp L271, #165
+L271: .string "oznstaijyeon"
+jsr L61
+
+mov *r4, L36
+L272: lea L35, r4
+clr *r3
+L273: .data -995, -830, 356
+L274: .data -137, 688, 528, 192
+L275: rts
+stop
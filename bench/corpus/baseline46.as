@@ -0,0 +1,1018 @@
+; Generated by genCorpus --seed 47
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+add r3, L41
+sub r2, r1
+L0: dec r7
+lea L0, r7
+mov L0, L0
+L1: bne *r6
+add *r7, r2
+lea L39, r2
+dec L0
+prn #-103
+inc L1
+L2: add L0, L2
+dec L1
+cmp L1, L129
+inc r5
+L3: mov *r4, r3
+L4: stop
+sub #215, r7
+clr r1
+jmp L0
+clr L22
+inc L135
+clr *r3
+L5: .data 907, -414
+L6: lea L1, r7
+bne L6
+add L136, *r6
+mov *r7, r3
+add L178, L2
+sub *r3, L138
+bne L1
+mov #-232, *r6
+L7: .data 36, 555, 206, -759, -589, 379
+not *r7
+L8: inc L239
+L9: .string "hurywauyn"
+inc r7
+L10: .data 223, -285, 495, -167, -369
+dec *r0
+cmp L5, L5
+inc r1
+not r3
+sub #184, *r7
+inc r0
+rts
+L11: red L11
+L12: sub #227, r2
+not L12
+bne *r1
+add r6, r2
+L13: rts
+jmp L180
+mov #-60, L53
+bne L5
+bne *r6
+bne L7
+not r4
+prn *r3
+L14: prn #-20
+
+dec *r7
+not *r3
+L15: dec r0
+jsr *r5
+sub L14, *r6
+red L146
+mov *r3, r1
+jmp *r1
+L16: stop
+jmp *r7
+jmp *r7
+L17: .string "muuklpbhesaxqhyemoprevi"
+red L7
+L18: .string "kfqcmsarcewtkyrtwpmahen"
+rts
+stop
+L19: sub *r4, *r1
+L20: prn L9
+L21: add #185, *r6
+prn r7
+not *r5
+L22: .data 789, 547
+red r6
+mov r5, *r7
+not r6
+cmp L80, #-236
+jmp *r0
+jmp L149
+clr L0
+L23: not L197
+sub #103, r0
+; comment
+L24: .string "jclruxcvimwwxygyz"
+L25: bne *r1
+L26: cmp r3, #15
+clr *r7
+jmp L12
+L27: inc r6
+cmp #132, *r6
+L28: dec L93
+lea L144, L111
+mov r1, L10
+dec r2
+red r1
+L29: .string "eyxlyjmwnyvpbbysek"
+jsr L4
+L30: .string "sglaivhdlyxhzjq"
+bne *r4
+lea L3, r2
+dec L10
+mov #-172, r1
+mov L43, L159
+rts
+L31: .data 926, 31, 853, -150, -710, -198, -869
+cmp #-135, *r7
+cmp #120, L7
+
+mov L0, *r7
+jmp L21
+not *r7
+clr *r6
+L32: lea L48, L23
+add r3, r3
+jsr L226
+stop
+inc r6
+jsr *r1
+bne *r2
+; comment
+dec L17
+red r1
+not r4
+bne L174
+prn L233
+sub #197, r3
+prn #-58
+dec r4
+add L8, *r4
+dec L120
+stop
+lea L12, L52
+clr *r6
+L33: stop
+L34: rts
+not r2
+clr L105
+cmp #106, r1
+clr *r4
+L35: .data 171, 587, -12, -559, 219, -932, -553
+red L0
+not *r7
+red r1
+stop
+mov *r1, L241
+dec r4
+stop
+L36: inc *r5
+jsr L243
+L37: .string "orbyuygohfrvyfty"
+add #-162, L169
+L38: jmp L119
+add r4, *r6
+L39: jsr L238
+L40: .data 331
+cmp r3, *r2
+L41: red r2
+
+rts
+dec L170
+cmp L158, *r1
+L42: .string "rxnhoibgkvzmzb"
+L43: .string "fvbazgjcuqatouvgvpht"
+L44: rts
+not r4
+sub r0, r0
+jsr *r4
+L45: .data 80, 942, -200, -564, 203, 978
+sub *r2, *r4
+dec *r4
+cmp #148, r1
+L46: red r0
+red L26
+sub L33, *r6
+clr *r6
+cmp #85, L10
+dec L153
+bne L19
+prn L5
+inc r4
+L47: .data -619, -89, -867, -63, 8, 276, 708, -782
+red *r2
+stop
+add L67, r0
+lea L26, r6
+rts
+L48: cmp *r4, L8
+mov #-45, L9
+prn #-76
+clr L58
+dec L69
+rts
+add r1, *r3
+jmp L197
+prn r2
+inc *r2
+prn r4
+add r6, *r2
+L49: prn *r6
+jmp *r1
+dec L8
+stop
+rts
+prn #107
+L50: add L45, *r0
+inc *r1
+sub L38, L45
+L51: .data -743
+L52: bne *r7
+L53: sub r0, L3
+cmp r6, *r5
+L54: dec r2
+rts
+stop
+not *r7
+
+add *r4, L37
+L55: .string "hxshksvkncseml"
+bne *r6
+L56: .string "elmfuujdivbz"
+prn *r3
+lea L44, r3
+jmp L18
+
+clr L53
+dec *r0
+red r5
+sub L112, r2
+jmp *r0
+add #77, *r3
+sub #51, *r4
+L57: stop
+stop
+cmp *r5, L184
+jsr *r3
+cmp *r0, #29
+not *r5
+jsr L48
+prn *r2
+L58: mov *r5, r0
+rts
+L59: dec *r2
+add *r3, r3
+red r0
+jsr *r1
+inc L109
+bne L59
+prn *r6
+prn L219
+rts
+sub #52, L31
+lea L75, L228
+prn r1
+L60: mov #-189, r3
+L61: cmp L51, r5
+L62: stop
+L63: mov r5, *r5
+L64: clr r2
+; comment
+cmp #119, #-189
+inc L142
+clr r0
+jsr *r4
+add #18, L49
+mov L152, r1
+mov L120, L45
+rts
+; comment
+red *r1
+cmp #31, r6
+add r0, r5
+L65: dec L194
+add L6, r7
+stop
+add L5, *r0
+not r2
+L66: .data 701, -330, 790, -88, -454
+L67: jsr *r5
+L68: .string "f"
+red *r0
+bne *r0
+prn #-71
+clr *r1
+bne L212
+clr r2
+dec r3
+L69: rts
+L70: inc *r7
+dec *r3
+L71: red *r4
+L72: jsr L69
+jmp L142
+lea L221, r4
+stop
+jmp L41
+cmp #-8, *r0
+L73: cmp L189, *r6
+L74: jsr L10
+inc r7
+stop
+sub r2, L39
+clr L208
+
+jmp L216
+cmp *r1, L14
+dec L126
+; comment
+mov L77, *r7
+L75: sub L87, r5
+rts
+jsr L203
+cmp *r2, r1
+clr r1
+clr *r5
+bne *r5
+lea L162, r4
+mov #-60, r7
+L76: lea L161, L14
+bne *r6
+L77: .string "ewsg"
+L78: prn *r0
+
+inc L30
+sub #37, r3
+prn #-130
+jsr L121
+jsr L60
+bne L77
+dec L69
+add r6, *r0
+prn *r1
+mov L25, L233
+
+L79: jsr *r4
+mov #47, *r3
+L80: jmp L180
+L81: add r4, L110
+L82: .string "rlxq"
+add #-28, L181
+L83: inc *r0
+lea L53, *r7
+prn *r1
+inc r0
+L84: .data -324, 63, -550, 610, 826
+add #178, r7
+inc r3
+L85: mov *r4, L166
+inc *r7
+cmp #-49, *r3
+L86: .string "zxdhbz"
+cmp L118, #-183
+sub #64, r3
+red *r1
+L87: .data -881, -797, -174, -616
+; comment
+inc L53
+sub r3, L170
+L88: .string "tndujjauszxjec"
+dec *r6
+clr *r6
+jmp L74
+L89: .data 912, 357, -154, 634
+rts
+bne L0
+prn *r7
+dec r5
+clr r4
+prn *r2
+not L37
+cmp L30, r6
+jsr L28
+prn *r6
+L90: lea L181, L126
+jsr *r5
+cmp #-89, #-69
+L91: stop
+prn *r6
+; comment
+jsr *r5
+cmp r1, L17
+lea L73, r1
+stop
+sub L14, r3
+L92: .data -919, 532, -539, 640, -228, 660, 357
+inc L178
+dec r6
+L93: not r5
+
+rts
+red *r1
+inc *r6
+stop
+jsr L13
+add r0, L32
+cmp r5, *r0
+; comment
+L94: bne *r5
+stop
+L95: cmp #110, r5
+stop
+add #-178, r7
+add #71, *r1
+dec *r6
+rts
+jsr *r3
+jsr L209
+add *r1, L12
+L96: inc *r6
+lea L212, L100
+clr *r5
+not *r2
+jmp L87
+red *r7
+L97: .string "hdnrjjnuezsfnunvuf"
+dec r6
+L98: .data 860, -125, -772, -85, 887, 182
+add L191, L28
+L99: .string "dxjcbbzoshxpgbqt"
+mov #-50, L135
+lea L72, L204
+L100: .string "bdawdhkairxxcdkgrdi"
+dec L66
+L101: jmp L88
+sub r3, L129
+L102: dec r6
+not *r1
+add r7, r6
+red r3
+red L62
+dec *r2
+L103: red L175
+; comment
+add #-8, *r4
+L104: clr L101
+jsr *r7
+prn *r6
+prn r0
+L105: .string "yvwufixoijfbua"
+lea L67, *r4
+dec L39
+stop
+L106: sub #46, *r5
+not *r6
+lea L232, L70
+inc L232
+L107: .data 797, -713, 979, 544, 340, -772, -397
+lea L72, r1
+lea L31, L85
+L108: clr r6
+jsr *r7
+L109: lea L50, *r1
+add L90, *r4
+L110: inc *r5
+
+red *r2
+inc *r6
+L111: clr r1
+dec *r4
+L112: .data -662, 661, 920, -692, -688
+L113: .data 680, -465, -827
+red r2
+bne *r5
+inc r0
+add #-86, r6
+rts
+jsr *r0
+rts
+cmp #28, r5
+clr L51
+inc L42
+not L62
+clr L96
+L114: inc *r1
+prn r2
+add L126, L214
+cmp r5, #-235
+rts
+rts
+mov *r7, L236
+inc *r1
+stop
+stop
+L115: mov *r1, *r2
+clr *r6
+bne *r3
+L116: add L16, *r5
+rts
+dec L127
+jsr L110
+mov L19, L184
+sub *r1, L25
+jmp L3
+stop
+L117: .string "uhufkdblguhghyl"
+lea L119, r5
+inc L27
+jsr *r3
+not *r2
+L118: .string "llidooxz"
+stop
+clr *r1
+stop
+cmp L158, r2
+cmp L6, L173
+L119: cmp #-76, L34
+L120: jsr *r5
+cmp #171, *r3
+mov *r3, r2
+L121: mov #133, L38
+L122: jmp *r6
+not r2
+dec r1
+lea L204, r6
+red L105
+bne *r4
+sub L204, *r5
+lea L2, *r6
+lea L179, *r6
+
+L123: not r3
+rts
+lea L155, r7
+L124: .data 678, 537
+not *r1
+jsr *r4
+not L77
+not r0
+stop
+L125: stop
+bne L92
+L126: rts
+cmp r3, #207
+
+; comment
+L127: .data 593, 491, 811, -334
+add *r4, *r4
+cmp L186, *r0
+not *r5
+stop
+lea L77, r1
+not *r6
+rts
+bne L96
+cmp #-33, r7
+L128: mov L229, r0
+not r1
+stop
+red r3
+cmp *r1, r2
+clr L234
+sub *r7, *r2
+L129: lea L239, L35
+L130: .data 318, 474
+mov #117, r3
+L131: red *r2
+L132: add #-195, L148
+L133: dec L130
+not *r6
+not r7
+bne *r1
+jmp *r6
+bne L207
+add r0, L35
+not *r3
+bne L189
+sub #-86, r3
+; comment
+dec *r7
+L134: inc L99
+bne L11
+bne *r1
+stop
+L135: .data -420, -148, 816
+dec *r2
+mov *r6, L67
+L136: .string "ubf"
+stop
+L137: .data 686, 951, 578, 252, -206, 245
+bne *r5
+; comment
+sub r6, r3
+rts
+red *r6
+stop
+clr *r0
+; comment
+sub #-146, *r1
+sub #234, *r3
+prn #85
+sub *r7, r7
+; comment
+jmp *r3
+L138: .string "kixsbwmmhqfwlvyiqbwhqp"
+red r7
+L139: .data 897, -987
+red r5
+stop
+mov L105, *r5
+L140: rts
+clr *r7
+L141: mov #-147, r5
+mov *r3, L108
+L142: jsr *r6
+not r0
+jsr L180
+prn r7
+bne *r7
+jmp *r2
+sub *r6, L106
+bne L91
+L143: lea L103, *r2
+L144: bne L227
+jsr L151
+L145: .data -899, -748, -117
+not L6
+red *r3
+prn r4
+L146: .string "cjjfccytglk"
+bne L33
+bne L195
+clr L149
+L147: inc *r0
+L148: .data 850, -605, -876, -782, -68, -475, -673
+inc r4
+dec r7
+prn #33
+prn L116
+mov L73, r5
+not *r4
+; comment
+jmp *r6
+L149: dec L75
+bne L84
+add L47, *r2
+prn *r1
+mov #-93, L11
+L150: .string "tpwdgzgdkjemt"
+red L241
+clr r6
+lea L19, r1
+bne L11
+add r6, r4
+; comment
+rts
+sub *r3, *r4
+jsr *r4
+jmp L70
+L151: sub #54, r1
+sub r0, L244
+rts
+jmp L235
+add r2, r1
+L152: .string "tawpeecgqbidwowc"
+L153: rts
+bne L96
+sub *r6, r4
+L154: .data 232, -671
+sub *r4, L93
+stop
+prn *r0
+L155: .string "hsxasarbf"
+L156: rts
+lea L227, *r2
+cmp L194, *r6
+L157: .data -751, 580, -906, 168, 261, -242, 120
+dec r1
+L158: .string "mo"
+L159: stop
+rts
+; comment
+mov *r6, r0
+bne L54
+mov *r6, r6
+not *r6
+prn L244
+not L34
+stop
+sub *r1, *r5
+L160: mov *r5, r5
+L161: red r6
+dec r3
+stop
+add L192, r4
+jsr *r4
+jmp *r6
+mov #-109, *r0
+add *r2, *r5
+jsr L184
+bne *r4
+; comment
+jsr *r0
+L162: .data 893, -90, -624
+dec L192
+rts
+dec L99
+L163: stop
+red *r5
+lea L249, L9
+cmp r5, L216
+
+stop
+add #-101, r1
+bne *r4
+L164: .data -39, 482, 125, -213, -246, -426
+dec L155
+add *r7, L197
+inc r4
+jmp *r7
+cmp *r1, *r6
+; comment
+stop
+rts
+L165: jmp *r0
+dec *r3
+jsr *r1
+bne *r7
+jmp L120
+dec *r0
+not *r3
+L166: jsr *r0
+prn #215
+L167: .string "kdsxtclnbskbwjqnaf"
+dec r7
+red L34
+mov L180, r7
+L168: stop
+L169: .data 571
+prn r1
+add r1, L237
+L170: .string "t"
+L171: dec r6
+
+jmp L115
+bne L184
+L172: jmp L206
+sub #136, *r3
+red r6
+L173: clr r3
+prn L219
+L174: mov r6, *r2
+L175: mov #-117, *r7
+stop
+cmp r1, #-221
+rts
+inc r7
+not *r0
+L176: stop
+jsr *r2
+jmp *r2
+add *r2, L207
+add r4, L60
+mov *r3, r5
+red r1
+L177: .string "mivwivbzfjr"
+dec r4
+L178: not r1
+cmp L209, *r6
+jmp L53
+dec L9
+L179: jsr *r1
+L180: clr *r4
+L181: jsr L190
+prn L196
+L182: .data 708, 400, 765, 38, -693
+cmp *r4, L126
+jmp *r6
+dec L152
+rts
+L183: stop
+L184: inc r1
+rts
+stop
+add L180, r4
+rts
+rts
+inc *r6
+not *r5
+sub L249, L219
+L185: stop
+L186: rts
+red L27
+; comment
+dec r5
+L187: sub #88, L110
+jsr *r0
+L188: jmp L8
+add #172, L246
+L189: cmp *r3, *r2
+L190: not *r0
+cmp #-69, #66
+sub r0, L106
+bne *r0
+jmp *r0
+not *r3
+bne L129
+L191: dec L58
+jsr L61
+jmp *r1
+L192: .data 977, -545, -24, 120, 79, 713
+stop
+L193: .data 571, 360, 154, -518
+cmp r3, r7
+stop
+stop
+L194: .string "ufoxjotbv"
+inc L24
+mov *r0, L228
+bne *r7
+L195: .data 67, -425, -282, 56, -744, -801, -239, 292
+jmp *r1
+rts
+cmp r5, r7
+L196: jsr *r5
+L197: .string "iqttjao"
+rts
+
+L198: .data -478, -172, 797, -334, -768, 856, -871
+L199: .data 99, -445, -125, 72, -93
+lea L134, *r6
+clr *r2
+prn *r6
+not *r7
+L200: .data -478, 613, -371
+mov L229, r0
+jsr *r6
+
+
+mov r4, r7
+rts
+not L247
+add L218, r4
+jsr L12
+L201: inc r2
+mov L182, L38
+rts
+L202: .data -12, -629, -470, -167, -218, 64, -704
+stop
+jmp L155
+jmp L13
+inc r1
+L203: mov *r1, r6
+L204: inc *r2
+sub #57, *r7
+L205: rts
+add *r5, *r1
+jsr *r1
+lea L246, *r4
+L206: .data -72, 104, 544, 498
+sub L235, r7
+inc *r2
+L207: red L159
+add L152, L208
+
+lea L68, r1
+L208: rts
+not *r2
+L209: cmp L113, r7
+dec L231
+L210: inc *r1
+jmp L239
+inc r0
+L211: .string "scxqdizcqzgyupd"
+jmp *r3
+stop
+bne L202
+stop
+add *r2, *r3
+lea L152, r4
+L212: rts
+lea L218, r3
+red *r1
+not L52
+L213: red r7
+L214: .data 839, -301, -279, -145, -179, -901
+L215: cmp L242, L4
+prn #-113
+bne *r2
+L216: sub L81, r4
+bne L241
+add L235, L224
+red *r2
+inc r4
+rts
+add L243, L241
+add *r1, L228
+jsr L239
+mov *r5, r6
+L217: .string "wvvpljqvwcvlxkzusgu"
+L218: .string "bfjwcawvu"
+add *r6, r3
+L219: .string "dfwowugtcoxqofsqiu"
+dec L241
+L220: .data -957, -510, 194, -829, 759
+L221: inc r1
+red L178
+clr *r1
+L222: .data -432, 33
+add #89, L48
+lea L174, L235
+jmp *r2
+L223: .data -94, 931, -474, -726, -673, -133
+add r0, *r1
+sub L16, L238
+L224: red *r7
+L225: clr r7
+stop
+L226: .string "wjjpddid"
+jsr L70
+; comment
+bne L72
+mov *r0, r0
+cmp *r0, r3
+L227: .string "vkkloozgorsuqhqbvjcqium"
+rts
+L228: .string "hunorlxma"
+jmp *r5
+cmp *r3, r2
+prn #65
+dec *r6
+L229: dec *r7
+L230: not *r6
+L231: inc L247
+not *r2
+mov *r4, r7
+prn #-11
+stop
+stop
+not L234
+red L123
+mov r7, r6
+
+jsr *r3
+jmp *r3
+L232: inc r2
+L233: red L34
+add L245, L238
+mov r5, L245
+L234: cmp *r2, #170
+L235: rts
+clr *r3
+L236: stop
+jmp *r5
+L237: lea L243, r7
+cmp #-202, r3
+prn r6
+L238: prn L241
+jmp L247
+L239: .string "zxshvqofcygmtkmdaecpe"
+rts
+L240: .data -170, 212, -393, -882, -335, -737
+L241: not r3
+lea L227, L249
+L242: mov L123, L249
+L243: sub *r3, L248
+L244: not L245
+mov L247, r5
+inc L246
+jmp *r6
+mov #82, r1
+jmp *r5
+clr r3
+red r3
+add #-174, *r0
+sub r4, r2
+not L246
+; comment
+; comment
+mov #157, L246
+jmp *r5
+add *r2, *r4
+red L247
+dec *r2
+stop
+cmp #-64, r4
+stop
+not L247
+jmp *r1
+L245: inc L75
+not *r3
+
+mov #-220, r7
+L246: mov #-191, *r0
+L247: .data -196, -881, -102, -662, 998, -138, 152, 403
+dec L249
+red r5
+L248: clr L218
+clr r1
+prn #-54
+not L62
+L249: .string "y"
+jmp L221
+stop
@@ -0,0 +1,1020 @@
+; Generated by genCorpus --seed 48
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+clr r0
+red *r2
+jsr *r5
+clr *r7
+bne L119
+not *r1
+inc L166
+L0: mov #-46, *r4
+L1: jmp L1
+dec *r3
+L2: jsr L146
+cmp #-32, *r2
+L3: .data -878, 177, 535, -753
+stop
+L4: lea L4, r7
+add L1, L4
+cmp #101, *r3
+mov *r7, r2
+
+L5: .data 658, 659, 74, -86, 91, -450
+inc r5
+
+clr L5
+not r3
+jsr L0
+L6: jsr L3
+L7: bne L1
+jsr L204
+jmp *r2
+sub #-63, L24
+dec r7
+; comment
+prn L151
+bne L2
+dec *r1
+inc r3
+prn r4
+stop
+lea L259, L4
+lea L104, L4
+inc r3
+L8: .string "p"
+inc r1
+clr r6
+L9: cmp L9, *r5
+L10: stop
+lea L14, L194
+L11: .string "mnnacjlfq"
+bne *r7
+L12: not r6
+rts
+add r5, *r2
+rts
+stop
+L13: sub #-68, *r3
+L14: .data 349, 471, -30, 436, 970, -360
+not *r6
+red r4
+L15: mov *r2, r5
+; comment
+clr L49
+stop
+inc *r4
+prn r0
+L16: jsr L113
+inc *r0
+L17: prn *r6
+L18: .data -938
+rts
+add #79, r1
+jmp *r4
+jsr L272
+mov L12, r4
+; comment
+L19: .string "kihkcannwumfbcvzxba"
+clr L13
+jmp L267
+L20: clr r3
+clr *r7
+sub r0, r2
+L21: .data -990, -959, 250, -437
+L22: prn *r4
+inc r0
+jsr *r2
+prn L37
+rts
+L23: .string "tbnvuasptfqbdufbupk"
+cmp #-38, r2
+jmp L7
+inc L196
+bne *r0
+dec *r6
+inc *r5
+jsr *r3
+cmp #-105, r2
+rts
+L24: stop
+lea L270, L82
+jsr L23
+jsr *r0
+prn #167
+L25: rts
+sub *r1, L7
+prn #232
+bne L18
+not r6
+clr r0
+cmp *r2, r5
+L26: jmp L220
+red r7
+clr *r1
+cmp L160, r3
+L27: red r4
+dec r4
+cmp *r4, #185
+lea L134, L22
+; comment
+not *r4
+L28: add *r2, L127
+stop
+jmp *r5
+not *r2
+jmp L4
+L29: rts
+red *r5
+L30: .data -816
+jmp L178
+L31: .data -714, -105
+L32: not L52
+L33: inc r1
+stop
+; comment
+; comment
+cmp r4, #-161
+clr r0
+cmp #172, #-76
+jmp L2
+cmp #224, L188
+cmp #232, *r5
+not r1
+dec L21
+not *r0
+mov L142, r0
+dec L12
+L34: mov r3, *r4
+bne *r1
+add #-69, *r0
+bne *r6
+dec L207
+clr L18
+jsr L180
+L35: .data 631, -73, 525
+add *r2, r5
+jmp L50
+mov *r7, r2
+stop
+add L27, *r3
+L36: prn r2
+; comment
+L37: .string "lnupkifksymiabefwznwmzf"
+stop
+not *r0
+bne *r1
+red *r4
+L38: jsr L134
+add #88, L15
+L39: .string "ajujypecygoxshkmlax"
+L40: not L29
+L41: sub *r4, r6
+bne L120
+red r1
+L42: .string "rakijmjsdzhkzlhin"
+L43: lea L173, r5
+inc *r3
+cmp #57, #68
+bne L239
+mov r2, r2
+inc r0
+lea L230, L194
+L44: .string "tzxtbeh"
+L45: jmp L254
+L46: .data -592, -610
+L47: jsr *r3
+L48: cmp #233, L68
+inc L46
+prn r0
+
+; comment
+L49: .string "wtfrqzp"
+L50: jmp L21
+red *r0
+rts
+cmp r2, *r3
+prn L70
+mov #-225, *r1
+sub #-11, *r7
+red *r2
+L51: lea L23, L248
+rts
+not L28
+L52: sub #21, r7
+L53: sub *r0, r0
+prn #-11
+L54: rts
+sub L51, *r2
+mov r2, L18
+inc L270
+dec r2
+rts
+; comment
+L55: red *r4
+lea L40, L176
+jmp L68
+mov r3, *r1
+sub L48, r4
+clr *r3
+rts
+L56: bne *r7
+L57: .data -880
+; comment
+clr r3
+L58: .string "v"
+cmp r4, *r4
+not r1
+dec *r4
+inc L29
+dec *r7
+inc r5
+cmp r2, L34
+L59: .string "nkizxynmkmsun"
+mov r0, *r2
+L60: .string "mbrrjzmucbydamncgxs"
+dec L27
+cmp *r1, L140
+rts
+L61: dec L99
+rts
+not r1
+jsr L12
+bne *r6
+L62: inc L47
+dec *r5
+prn *r1
+red r1
+sub *r4, *r6
+lea L7, *r1
+jmp *r3
+add L6, r1
+cmp *r3, #211
+L63: mov #95, r4
+jsr *r5
+red *r1
+; comment
+stop
+L64: .data 375, 947, 486, 149, 590, 324, 93, 796
+cmp *r5, L269
+L65: inc r1
+not L52
+prn *r1
+not L115
+jmp L237
+L66: jsr *r2
+add #-199, r3
+cmp L9, L56
+lea L48, *r3
+cmp #-38, #93
+L67: add #-231, r5
+jmp L19
+prn *r3
+jsr *r1
+rts
+prn r6
+cmp L170, *r6
+lea L189, *r2
+mov r3, *r2
+jmp *r3
+lea L209, r7
+not r3
+L68: .string "aqzrwkhwfmcjlqn"
+L69: cmp L119, L181
+L70: not *r6
+jmp *r2
+L71: clr r3
+dec r7
+prn L52
+stop
+inc *r1
+mov r5, L238
+lea L231, r6
+dec L25
+inc L80
+red L50
+L72: stop
+L73: lea L51, L18
+jmp *r2
+dec L167
+bne L25
+rts
+red r2
+prn r4
+clr *r5
+mov r5, r4
+L74: jmp L159
+jsr L224
+L75: .string "sc"
+prn L152
+bne L181
+rts
+jsr L264
+cmp #84, #-17
+L76: lea L52, L231
+rts
+L77: add r1, *r6
+L78: rts
+red r6
+L79: lea L231, *r7
+mov *r5, r4
+lea L91, r3
+lea L5, *r6
+bne L54
+not r4
+L80: bne L52
+jsr L12
+prn #-108
+cmp #-255, L59
+lea L73, *r2
+bne *r1
+dec *r2
+add L4, L54
+mov L27, L49
+bne L15
+add #-104, L12
+L81: sub #-75, r5
+prn L52
+L82: bne *r5
+red r6
+rts
+L83: clr r0
+cmp *r5, #233
+prn #239
+lea L56, *r6
+cmp #-15, L227
+L84: bne L176
+; comment
+not L187
+lea L20, *r1
+bne *r7
+L85: .data -330, 345, -252, 106, 245, -941, 636, 806
+L86: rts
+jsr *r6
+L87: bne *r4
+bne L1
+bne L51
+L88: rts
+not r3
+clr L110
+L89: .string "hkombplddpznkq"
+dec *r2
+L90: sub L237, L247
+L91: jsr L23
+lea L96, r2
+L92: not L58
+inc *r3
+
+inc L205
+inc L62
+red *r4
+L93: not *r1
+L94: jmp L76
+L95: .string "tlojqohoqkssqqs"
+not L61
+L96: inc r1
+L97: not r3
+sub L28, r5
+lea L199, L253
+red *r2
+sub #-181, r5
+inc r0
+sub L250, L62
+lea L214, L9
+L98: dec r1
+jsr *r1
+L99: .string "ypehrgkkwwzkjbbblznzfjwu"
+lea L252, L260
+add L83, *r0
+; comment
+stop
+clr r0
+inc L4
+jmp L268
+bne L260
+mov L69, r5
+red r2
+cmp *r3, #-83
+L100: not *r0
+L101: .data 831, 903, 173
+
+not L232
+L102: cmp #-200, *r2
+lea L99, *r2
+L103: jsr L173
+prn *r7
+rts
+inc *r2
+prn r1
+rts
+jsr *r5
+L104: .data 62, 407, 387
+bne L49
+not r5
+L105: clr *r4
+jsr *r2
+L106: jmp L158
+jmp L176
+jmp L32
+L107: rts
+cmp r1, L35
+L108: .string "okfnvkynvojlljacquszmqqp"
+L109: bne *r2
+red *r2
+stop
+dec *r5
+L110: .data 654, -598
+prn L141
+L111: .string "ncifnknhubarboknlyxirljs"
+L112: red *r6
+lea L18, L62
+sub #21, L268
+mov L143, L214
+rts
+inc L191
+stop
+red L208
+L113: prn L179
+mov #-48, *r3
+lea L111, L152
+mov *r0, *r5
+
+
+cmp *r3, #165
+L114: prn *r3
+red L228
+dec L237
+L115: lea L63, L7
+sub *r1, r0
+clr *r5
+L116: .string "s"
+mov *r6, r1
+cmp L191, #31
+lea L73, r6
+not L178
+L117: stop
+L118: .string "zqu"
+prn r2
+sub L101, *r7
+
+L119: stop
+L120: .data -833, 368, -289, -776, -735, -355, -272, -885
+L121: stop
+inc *r6
+dec r7
+cmp r2, r6
+L122: jmp *r3
+sub *r4, L43
+cmp #-55, r0
+L123: red r2
+prn #133
+L124: bne L123
+L125: clr *r0
+L126: .string "zcbpnewuewngqfgszha"
+L127: dec r7
+; comment
+dec L49
+L128: cmp L15, L49
+cmp r1, *r5
+red r0
+L129: .data 739, -726, -762, 648, -524, -406, -331
+
+red *r5
+mov *r7, L105
+jmp L258
+red *r0
+L130: stop
+jsr L96
+not r6
+L131: sub r3, *r0
+mov #220, L164
+clr r5
+lea L75, r6
+stop
+bne L162
+not r5
+L132: rts
+jmp *r2
+sub L69, L73
+L133: red *r4
+lea L221, *r4
+prn *r2
+L134: clr *r5
+L135: not L89
+mov *r7, r5
+L136: sub *r4, *r6
+bne *r6
+clr *r6
+dec L52
+L137: rts
+clr L258
+inc r1
+mov L196, r4
+sub L210, L29
+L138: .string "vfvszmbykithmoymqk"
+inc *r5
+inc *r6
+mov #80, *r0
+lea L230, *r7
+prn L82
+lea L152, L214
+prn r4
+L139: .data 931, -387, 974, 389, 249, 82
+inc r3
+mov r3, *r0
+L140: mov r7, r7
+L141: .data -198, -708, 519, -808, 946
+sub #-165, *r6
+L142: .string "up"
+prn L248
+inc r0
+L143: .string "ipofsptjaohztlpxdztoo"
+stop
+add r2, *r5
+lea L145, r0
+cmp r6, L138
+rts
+bne *r1
+rts
+L144: .data -744, -357, -332, -76, -186, 57
+stop
+jsr *r4
+dec L28
+L145: bne *r6
+bne *r1
+L146: clr L264
+prn L214
+L147: .data -351
+stop
+prn r7
+jsr L224
+red L99
+L148: .string "pkathsmmrl"
+L149: jsr *r1
+prn r4
+dec L53
+mov *r6, *r7
+not L44
+L150: .data 397, 831, 567
+not L43
+L151: bne L206
+clr r4
+inc r3
+inc L85
+prn r7
+dec r3
+add *r1, L272
+L152: bne *r7
+red r0
+L153: stop
+rts
+bne *r7
+cmp *r6, r1
+not r5
+prn #205
+L154: .string "prjhxtv"
+jmp *r0
+L155: cmp r2, *r3
+
+bne *r4
+inc r7
+jmp L43
+L156: .data -459, 753, -222, 307
+jsr *r3
+add *r7, r5
+L157: sub L210, r2
+cmp *r6, *r7
+L158: mov r0, L180
+lea L1, r7
+lea L251, *r0
+jmp L233
+mov *r6, L195
+not L4
+bne *r2
+red r3
+not *r5
+not r3
+add L84, r4
+add #55, L212
+clr r1
+L159: .string "nnicwjwkf"
+
+L160: sub #28, L153
+L161: rts
+clr L25
+L162: stop
+bne *r0
+jmp *r7
+dec r4
+red *r6
+cmp r0, *r0
+L163: mov *r7, r2
+L164: .string "dumuuokfvhgxugicujjn"
+bne L122
+add *r0, *r3
+clr r3
+L165: stop
+cmp #169, *r6
+L166: .string "cfnngecxkeynjsj"
+inc *r5
+L167: .string "uivxvonugieqymsvc"
+
+stop
+inc *r1
+
+L168: .data 91, 707
+jmp *r7
+stop
+L169: jsr L27
+mov r2, L46
+cmp *r3, #-59
+stop
+L170: .data -422, 866, 653
+prn *r7
+cmp r2, L2
+; comment
+L171: rts
+L172: rts
+L173: lea L98, r5
+L174: lea L254, r5
+prn *r1
+clr L102
+sub #46, *r0
+mov #-88, r3
+L175: inc r6
+rts
+jmp L190
+add #-121, *r2
+lea L196, *r7
+L176: stop
+cmp *r7, #107
+cmp #-82, #231
+dec L216
+mov L75, r2
+rts
+stop
+not L178
+L177: .data -158, -81
+red L141
+lea L213, r4
+lea L149, L135
+bne L55
+; comment
+L178: not r6
+L179: inc r4
+lea L42, *r3
+L180: .data 815, 173, -602
+jsr *r2
+red L209
+L181: rts
+dec *r4
+L182: lea L270, L15
+dec *r2
+stop
+red *r0
+cmp #-195, L46
+prn *r0
+L183: not r1
+bne *r2
+not r5
+L184: .data 436, -780, -118, 337, -828, 242, 169
+L185: .string "bwipcemogcdtzlomxkga"
+prn L201
+L186: mov L219, L234
+L187: .string "yvfokgd"
+L188: rts
+clr *r3
+red *r1
+clr *r6
+bne *r7
+L189: jmp *r7
+mov *r5, r0
+inc L104
+L190: .data -55, 387, 737, 38, -986, 965, 310
+
+inc L46
+sub r5, r5
+dec r3
+stop
+L191: not *r0
+jmp L271
+bne L16
+inc r4
+jmp L264
+L192: clr L234
+add L268, r6
+L193: add L249, r0
+L194: .data 700, -623, 366
+rts
+not *r3
+prn *r2
+red L250
+stop
+not r7
+dec r2
+clr L260
+jsr L249
+
+red *r1
+stop
+L195: .data 651, 775, 958, 917
+clr L268
+L196: jsr *r0
+L197: .data -284, -811, 918, 774, -974, 337, -626, 58
+clr r6
+jsr L152
+jmp L74
+stop
+sub r4, L99
+stop
+L198: cmp #186, r7
+L199: .data -995, -421, -790, 297, -239, 697, 266, -197
+bne L68
+red r3
+add L160, L265
+rts
+; comment
+L200: clr *r7
+bne L94
+jmp *r7
+jmp L28
+red *r6
+L201: .data 301, -443, -575, 212, -746, 171
+L202: .data -864, 539, -624, -661, -836
+mov #-93, r6
+stop
+L203: sub L33, r4
+jmp L235
+jmp L263
+sub #-120, r6
+L204: .data 429, 120
+prn #151
+L205: .string "iiiwlfasvmtyoiyrobasxjvz"
+not L123
+not L264
+L206: not L226
+stop
+not r3
+add L254, r5
+not r4
+rts
+add *r2, L225
+mov r1, r6
+inc r6
+L207: .string "tysymzhyldffg"
+inc *r0
+dec r3
+dec *r3
+L208: bne L94
+cmp #-27, L80
+bne L225
+inc *r5
+clr r7
+L209: inc L231
+lea L231, *r5
+add L132, L25
+prn L2
+jsr *r5
+not *r4
+L210: add #143, r7
+rts
+L211: jmp L170
+jsr L228
+L212: not r4
+mov *r4, L69
+L213: inc L231
+L214: .data 139, 466, 149, -621, 871, -278, -482
+L215: .string "rhefnzjazpf"
+cmp r0, *r7
+
+dec r6
+
+; comment
+mov r1, L224
+dec *r4
+mov r0, L98
+clr r0
+clr r1
+lea L205, r4
+red L227
+bne *r3
+L216: .data -601, -713, -433, 651, 632, -816
+L217: dec *r0
+add *r1, r4
+L218: prn L249
+sub L214, r4
+mov r7, *r7
+L219: add #116, r6
+bne L42
+L220: dec L226
+inc *r1
+red r2
+sub #-111, *r2
+L221: .string "b"
+dec *r7
+L222: prn L129
+not *r5
+not r4
+add *r1, r0
+L223: .string "wrvxwzkzdk"
+red *r4
+L224: .data 445, -21
+L225: add *r2, *r3
+; comment
+bne L229
+stop
+L226: inc r3
+prn L185
+clr L37
+red *r5
+bne *r2
+jmp L270
+L227: red L269
+L228: clr r3
+clr L126
+mov L214, L213
+mov #-194, *r7
+
+; comment
+lea L193, *r3
+L229: .data -311, 186, 543, -79
+L230: lea L222, *r7
+sub #-204, r6
+cmp #-89, *r5
+L231: jmp L130
+bne *r7
+lea L271, *r6
+jmp *r2
+jsr L75
+L232: .data 727, -108, -152
+red L267
+jsr *r6
+L233: bne L250
+clr r5
+red *r7
+L234: inc r3
+L235: .data -504, 996, -745, 503, 210, 722, -389, -152
+L236: dec r5
+rts
+clr *r3
+cmp L81, L242
+L237: jsr L265
+L238: .data -975, 161, -91, 643, 825, -983, 598, 560
+rts
+not L195
+L239: .string "ucupcriipgl"
+jsr *r1
+lea L65, r4
+sub #-248, r0
+clr r2
+sub r5, *r6
+L240: rts
+; comment
+L241: .data -700, 450, 499
+inc L185
+prn L244
+sub #-195, r6
+lea L261, *r3
+L242: bne *r1
+jsr L269
+mov *r0, *r0
+L243: cmp r5, L250
+red *r4
+jsr *r7
+L244: prn *r7
+sub r0, L252
+bne L196
+sub *r1, r6
+L245: sub r2, L46
+L246: mov L198, r3
+red L272
+clr *r5
+L247: .string "opatamdnazt"
+mov r2, *r7
+L248: mov *r3, L260
+stop
+lea L262, r3
+not L165
+red *r4
+dec *r3
+
+stop
+stop
+L249: .string "ulnajlmamrijc"
+L250: not L255
+lea L33, *r3
+dec L231
+prn r1
+stop
+dec *r3
+L251: .data 430, -74, -430, -471, -52, -360, -352
+L252: jsr L265
+stop
+stop
+jmp *r4
+L253: red *r4
+bne *r2
+L254: .data -776, -582, -894, -926
+red L266
+L255: .data 97, -891, 450, 228, -507, 502, 775, -897
+mov L256, *r3
+clr L263
+jsr L272
+cmp r7, r2
+L256: add L262, L26
+L257: rts
+L258: clr *r6
+L259: .data 818, -823, 665, 861, -899
+L260: .data 667, 437, -377
+lea L249, *r5
+lea L169, *r0
+jsr *r5
+inc L271
+L261: dec L264
+mov *r0, r2
+not *r0
+add *r5, *r5
+clr *r2
+clr r4
+; comment
+L262: jsr L271
+red *r6
+rts
+add r3, L85
+rts
+prn r3
+L263: .string "zvvz"
+inc *r4
+stop
+jsr L268
+L264: not *r7
+not *r6
+clr L21
+stop
+cmp r3, L271
+inc r2
+add #-208, *r2
+cmp #-237, L203
+not r4
+lea L146, *r1
+jsr *r4
+L265: .data 829, 696, -108, 497, 385, 889, -487, -814
+stop
+red *r5
+lea L45, L108
+clr *r7
+add *r1, r3
+lea L267, r7
+; comment
+prn *r3
+L266: add r6, L72
+clr L271
+dec *r6
+red L269
+not r0
+L267: bne L115
+L268: cmp L269, *r5
+lea L231, *r0
+mov *r5, L186
+prn #-180
+stop
+dec *r7
+bne *r2
+not *r4
+stop
+add r7, *r5
+L269: .data 210
+L270: rts
+jmp *r6
+L271: rts
+stop
+add #62, *r7
+inc *r2
+lea L272, L272
+cmp *r5, *r3
+jsr L272
+lea L272, *r5
+prn r4
+add r3, L272
+lea L272, r6
+bne *r1
+L272: .string "oolcfjhbbxmmycj"
+prn *r3
+rts
+stop
@@ -0,0 +1,1020 @@
+; Generated by genCorpus --seed 49
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+L0: red L98
+bne L51
+dec L0
+L1: add r2, *r3
+clr r3
+sub r1, L138
+L2: jsr L2
+L3: prn *r7
+rts
+L4: clr *r7
+inc r1
+bne *r4
+red *r6
+rts
+not *r1
+L5: not r6
+cmp L4, r6
+; comment
+; comment
+add *r2, L1
+not r3
+jsr *r3
+L6: .data 914, -60, -365, -467, 237, 793
+prn #169
+L7: not L0
+L8: rts
+clr L2
+bne L50
+prn *r5
+
+; comment
+L9: not r1
+jsr *r7
+bne *r6
+L10: stop
+lea L7, L38
+add r2, L8
+lea L6, *r4
+L11: sub *r7, L10
+L12: rts
+L13: dec L5
+inc *r7
+not *r5
+cmp *r5, r4
+not L66
+lea L10, *r7
+not r7
+L14: inc L235
+inc r4
+L15: prn r5
+L16: bne *r7
+add #-241, L44
+rts
+L17: jsr *r0
+rts
+sub *r4, L0
+sub L6, *r4
+bne L115
+inc L68
+mov L17, L3
+inc r4
+lea L183, r2
+L18: .string "e"
+; comment
+rts
+stop
+jmp L60
+bne L8
+L19: not L30
+inc L172
+red r1
+bne *r5
+L20: .string "wysihjuhhehbfvhixlhio"
+bne *r7
+stop
+jsr L0
+clr r7
+L21: .data -186, -388, 920, 977, -690, -524, -355, 386
+bne L5
+not *r6
+jsr *r2
+L22: clr L5
+stop
+bne *r0
+clr L11
+L23: .string "ncbxhjofjmt"
+prn r7
+L24: clr L101
+add r3, L14
+
+sub #-132, *r0
+not r5
+stop
+; comment
+dec r6
+prn L10
+sub *r6, r1
+L25: sub L103, L252
+; comment
+jsr L4
+dec L2
+L26: inc r3
+jmp L19
+jsr *r2
+not L19
+red r7
+L27: .data 874, 646, 435, 689, -330
+inc r7
+cmp #116, r5
+rts
+L28: mov #119, *r1
+inc L68
+prn r3
+
+inc *r2
+inc L9
+jmp L151
+rts
+not *r3
+inc L154
+lea L45, r4
+L29: add r5, r1
+
+L30: inc *r6
+cmp *r1, r0
+prn r2
+cmp *r1, r1
+add r0, L195
+L31: cmp *r0, L82
+sub L35, *r1
+L32: red L241
+red *r7
+L33: prn r0
+dec r1
+bne L14
+lea L17, L262
+jsr L13
+mov *r5, r2
+L34: sub #-174, r7
+red *r3
+clr *r1
+prn r1
+jsr L197
+jsr *r3
+lea L58, r2
+add #27, r1
+L35: mov *r6, r1
+L36: prn r4
+add #-127, L197
+clr *r4
+lea L17, *r1
+not L18
+L37: jmp *r6
+cmp *r6, *r3
+cmp L37, *r5
+jsr *r2
+rts
+L38: .data 874, 746, 804, -114, -295, 675, 322
+L39: .string "mraccgxseeixkoikijinrpnu"
+dec r5
+L40: .data 737, 517
+lea L20, *r5
+L41: .data -970, -245, 824
+bne L34
+L42: .string "hdaixyrqggeqzcg"
+dec L5
+sub #156, *r1
+jsr *r4
+clr *r7
+L43: inc *r0
+not r3
+cmp L32, r0
+L44: not r5
+inc r6
+L45: .data 480, 716
+L46: .string "vapapfeyoizk"
+L47: lea L261, *r7
+jmp *r5
+sub L23, *r0
+L48: .data 275, 534, -670
+inc *r2
+L49: dec r5
+L50: sub #-204, L50
+red *r6
+jsr L23
+L51: stop
+L52: mov *r6, r1
+bne *r3
+cmp r1, r2
+jsr *r0
+clr L84
+; comment
+not L20
+rts
+sub r2, L22
+rts
+; comment
+rts
+jsr L224
+not *r1
+
+stop
+L53: .data -890, 480
+L54: sub #-176, *r7
+jmp L34
+jsr *r4
+
+sub #233, L52
+L55: lea L5, L251
+jmp *r3
+rts
+stop
+stop
+jmp *r4
+L56: .data 781, -746, -407, 295, 549, -27, 419
+add *r7, L211
+bne L162
+L57: .string "ftnyco"
+clr *r1
+L58: .data -901, 912, 667, -852
+L59: sub #165, L85
+cmp L81, *r4
+sub L85, *r2
+red r3
+L60: .data 766
+jmp L181
+L61: .string "ofjyjnrwqryime"
+not *r1
+L62: .string "qoictayfhag"
+clr L25
+lea L160, r5
+
+L63: mov r7, *r5
+inc r7
+mov #120, *r2
+L64: bne *r7
+red L56
+L65: jmp L275
+stop
+L66: .string "bqcgf"
+L67: .string "htexrpbwwwgquwctijrvhez"
+lea L17, r3
+dec L159
+not r1
+L68: .data 680, 87, -180
+prn *r6
+add r1, r6
+prn *r5
+lea L188, L177
+red *r3
+prn *r1
+
+lea L17, L35
+L69: clr r7
+L70: sub #248, *r4
+stop
+; comment
+L71: dec L57
+clr L50
+L72: mov *r4, r1
+lea L252, r5
+L73: .data 700, 992, -924
+lea L56, L27
+prn r7
+L74: .data 726, -811, 942, -634, 728
+sub #-145, r4
+bne *r4
+stop
+bne L197
+not *r7
+L75: bne L26
+L76: red *r7
+inc *r2
+jsr *r2
+rts
+L77: inc L277
+add r7, r5
+mov r2, *r0
+mov *r0, *r1
+cmp #-40, L219
+L78: not r2
+L79: clr *r1
+bne L195
+jmp *r1
+L80: rts
+jmp L9
+rts
+jsr L81
+inc r3
+clr r5
+L81: prn L41
+L82: jsr L63
+lea L152, *r3
+clr *r0
+dec r4
+clr L115
+bne *r3
+lea L11, r6
+add *r3, *r1
+dec r6
+clr r6
+L83: cmp r7, *r5
+L84: clr L256
+L85: stop
+inc r7
+L86: .data -866, 70, 31, -303, -743
+clr *r2
+cmp r3, #154
+L87: prn r4
+cmp #73, r5
+L88: .data 533, -13
+L89: inc *r0
+
+inc L244
+L90: .data -451, 646, 819, -189, 347, 593, 517, -886
+clr r4
+L91: bne L233
+inc *r0
+bne *r6
+not L247
+jsr *r6
+L92: jsr *r2
+clr L231
+lea L218, L132
+jsr *r4
+lea L174, r7
+lea L48, r3
+dec r0
+jsr *r1
+L93: mov L92, *r7
+L94: inc *r3
+L95: .data -390, 28, 72, -382, 112, 651, -95, 247
+bne L72
+L96: .data -456, -417, 447
+jsr *r5
+L97: dec *r3
+stop
+jmp *r7
+L98: dec L35
+bne L57
+cmp r3, *r2
+stop
+add L122, r3
+L99: prn *r4
+L100: .data 903, -942, 722, -84, 330, 408
+L101: rts
+L102: .data 782, 981
+lea L91, L79
+L103: .data 945, -840, -780, 752, -841
+prn *r6
+stop
+jsr L251
+cmp #5, #113
+rts
+mov #116, *r7
+red r0
+sub L48, *r4
+jsr *r0
+L104: not L1
+sub #-12, L78
+L105: sub #109, r7
+mov #50, *r4
+bne L206
+clr L45
+prn L147
+L106: .string "ohrvslftpazad"
+L107: cmp *r6, r5
+sub r4, r1
+lea L132, r6
+not r7
+L108: .data 762, -45, -700, 16, 139, -143
+L109: lea L89, r3
+L110: .data 680, -546, -973, 357, -868
+jsr L54
+inc *r3
+L111: not L109
+L112: .string "pzpgw"
+sub L270, r0
+jmp *r4
+cmp L217, #247
+prn #-21
+jmp L222
+mov r2, *r2
+L113: prn *r0
+not L144
+jmp L83
+bne *r0
+inc *r4
+stop
+add *r2, L258
+
+prn #-229
+L114: .data 154, -183
+clr *r7
+L115: .data 512, -79, 670, 435
+jmp *r4
+; comment
+L116: .data -380, 318, 90, -902, 942, -570, -658, -303
+L117: inc *r1
+L118: red r7
+L119: mov r1, L166
+not r7
+red L102
+L120: prn r6
+L121: cmp *r6, #196
+jmp L277
+
+L122: lea L9, *r2
+cmp r4, r0
+jsr L223
+L123: bne L220
+L124: .string "jeptx"
+add L267, L10
+lea L40, L11
+rts
+rts
+lea L1, r4
+red r7
+L125: .data 17, 818, -774, 722, 102, 698
+bne *r6
+sub r5, *r2
+cmp r2, r3
+prn L154
+bne L7
+L126: .string "yqf"
+stop
+clr *r6
+cmp L25, L249
+; comment
+bne *r6
+L127: jmp L23
+L128: sub r3, r6
+cmp *r1, #131
+lea L249, r6
+clr r0
+add L27, *r0
+stop
+jmp L168
+L129: .string "mupaepevcenzl"
+L130: dec *r4
+mov #-74, *r2
+bne L276
+red r7
+L131: not r2
+; comment
+L132: .data 277, -614, -624, -526, -764, -12, 705, -70
+dec r2
+stop
+L133: not L26
+cmp L152, L118
+bne L273
+cmp #-135, L35
+lea L55, r7
+clr *r0
+jmp *r7
+L134: cmp r5, L193
+dec *r4
+bne *r1
+mov #224, *r0
+cmp r0, #238
+not *r2
+cmp #153, #-155
+clr L162
+dec *r0
+L135: red *r2
+sub L131, L135
+rts
+stop
+lea L99, r5
+clr r1
+jmp *r1
+L136: .data -662, 475
+lea L232, L206
+L137: dec L202
+prn r6
+L138: .data -212, -555, -928
+add r3, *r6
+clr r3
+lea L275, L182
+clr L35
+bne *r4
+prn *r6
+L139: .data -625, -10, 557, 553, 96, -270, 716
+dec *r5
+L140: .string "phqu"
+
+
+jmp L144
+mov r7, *r7
+; comment
+; comment
+L141: .string "pxqhkbravqhxvy"
+clr *r1
+add r2, *r1
+dec r1
+cmp #-46, r7
+mov #-245, *r7
+not L274
+L142: .string "rszugzkgjtfypibjjszvf"
+L143: not r3
+sub *r2, L127
+bne *r5
+prn *r2
+L144: .string "raqqqyhfqfbddbzuqzktkje"
+stop
+mov r5, L104
+L145: bne L159
+jsr *r4
+L146: mov L271, *r2
+stop
+dec *r1
+L147: jsr *r7
+jmp L29
+stop
+L148: stop
+jsr *r6
+add L272, *r7
+mov r5, L130
+clr L227
+jmp *r3
+inc r2
+stop
+stop
+L149: red *r2
+L150: lea L148, L193
+L151: .data 860, -236, 659, 734
+jmp *r1
+jsr *r1
+L152: lea L103, L82
+
+L153: bne L132
+not *r4
+add #-252, *r3
+dec *r7
+cmp #-229, *r6
+inc L171
+L154: rts
+jmp *r4
+dec *r2
+L155: bne *r0
+L156: cmp r7, L180
+red *r5
+L157: .string "o"
+add L98, L104
+lea L127, r5
+inc *r0
+cmp #-133, *r2
+rts
+jmp L64
+lea L140, L249
+stop
+L158: .string "thmikmqoprjis"
+L159: .data -107, 159, 133, -92, -139
+lea L61, r4
+dec L196
+dec r7
+L160: inc *r4
+L161: rts
+cmp r7, #-213
+cmp r0, L192
+prn *r2
+cmp L205, L199
+mov *r6, L206
+L162: .string "dzoasekrpcctp"
+not *r1
+; comment
+bne L268
+prn L242
+cmp *r4, r7
+inc r3
+lea L202, *r2
+stop
+sub #-90, r2
+cmp r3, r2
+
+mov r5, *r7
+L163: jsr L81
+L164: .string "fcys"
+
+
+add *r7, L269
+clr r4
+inc *r1
+lea L215, *r0
+inc r5
+bne L194
+
+not r7
+dec *r4
+add L278, *r1
+
+stop
+L165: .data 177, -166, -589, 428
+; comment
+jsr L219
+L166: .string "qdli"
+rts
+mov L202, r0
+lea L80, *r7
+L167: .string "lvtpinwjtnbkxuupstetttq"
+red r3
+red L67
+stop
+jsr *r5
+red L111
+prn r6
+jmp *r4
+mov #211, *r4
+sub L256, r5
+L168: bne L229
+dec L131
+rts
+jsr *r5
+L169: .data -728, -490, 450, 410, -617, 860, -898
+add r0, r5
+jsr *r3
+cmp #135, #107
+L170: mov L190, r1
+L171: dec *r6
+L172: .string "xrnyvdqwohv"
+L173: .data 993, 679, 370, 471, -797, 688
+stop
+jsr *r7
+cmp #-156, #112
+clr r4
+inc r1
+lea L88, L113
+L174: .string "ffvizckzelfxphxi"
+red L30
+sub *r0, *r1
+L175: .data -864
+mov L45, r2
+inc *r2
+sub #163, *r2
+rts
+rts
+lea L238, r0
+mov #129, r1
+L176: bne *r0
+jsr L253
+L177: add #-208, L38
+lea L147, r1
+dec *r4
+cmp L227, L205
+jmp *r0
+sub r3, r0
+jmp *r3
+clr r1
+sub L255, r4
+dec r1
+red *r3
+dec r5
+add #29, *r1
+bne L44
+clr r2
+L178: .data 752, 682, 973, -737, 847, 119, 908
+not r2
+sub L2, *r4
+
+L179: red *r7
+L180: .data -8, 59, 294, -930, 954
+stop
+L181: mov L226, r4
+prn r4
+L182: .data 468
+stop
+L183: .data 99, -492, 141, 299, 917, -713, -73, 292
+L184: jmp L0
+rts
+not *r2
+inc L242
+cmp L240, r6
+prn #100
+sub r4, L195
+L185: .string "xvnijiffrdgqdbviox"
+prn #-23
+bne *r5
+sub *r4, L215
+clr L48
+L186: rts
+L187: .string "vyfupztzoqqnbohd"
+jsr *r6
+sub #24, r7
+cmp L226, r7
+mov *r2, L198
+jmp L183
+prn L202
+L188: .string "gcvmanwpnglg"
+jsr L111
+L189: inc L224
+add *r1, L113
+L190: bne L231
+stop
+L191: bne L31
+jmp *r0
+L192: .data -306, -895, 595, -663
+not *r1
+add #-167, L206
+L193: jsr L128
+rts
+dec *r1
+L194: rts
+stop
+bne *r4
+clr L103
+not r4
+L195: cmp *r6, r7
+L196: clr L245
+bne *r6
+add r4, *r0
+clr r6
+jmp *r3
+add L70, L63
+; comment
+mov #-191, *r6
+mov r3, *r5
+lea L43, r1
+sub r2, r1
+cmp *r0, L228
+stop
+rts
+rts
+clr L221
+dec r7
+stop
+jsr L239
+bne *r1
+lea L257, L73
+jsr L273
+jsr *r0
+cmp L83, #-229
+L197: .string "xhdu"
+add r6, L200
+L198: cmp L126, #-7
+jmp L21
+cmp #194, #122
+rts
+L199: .string "qackbfzsmyklwkwudlyev"
+clr r3
+
+
+L200: clr *r0
+add #-238, L273
+dec *r4
+lea L201, r3
+stop
+jmp *r2
+L201: red *r3
+prn *r7
+L202: .string "irrjvsplavwsocow"
+add *r0, r6
+sub L277, *r3
+stop
+sub r0, r2
+cmp r1, L246
+add #116, L23
+
+rts
+L203: add r0, L257
+red *r3
+rts
+L204: sub *r7, L88
+inc L209
+lea L210, L237
+inc L123
+L205: .data 119, -900, 751, 712, 31
+L206: stop
+L207: .string "sbswvhzgt"
+lea L116, *r5
+stop
+lea L173, r4
+clr *r5
+L208: rts
+dec *r6
+L209: add r2, L272
+L210: bne L236
+not r7
+jsr *r5
+; comment
+L211: prn #-78
+L212: jsr *r5
+jmp *r0
+clr *r7
+
+red *r1
+jsr L268
+not r3
+inc L51
+not L34
+bne L236
+L213: .data 830
+L214: cmp #49, r4
+red *r1
+red *r6
+clr r6
+L215: bne L104
+add L29, L79
+L216: mov *r3, L69
+sub *r4, r6
+prn L178
+cmp #248, #205
+dec L5
+mov #138, r0
+cmp r7, L100
+jsr *r7
+rts
+L217: .data 225, -647, -662
+bne L269
+L218: dec L229
+L219: dec L255
+mov L227, r7
+L220: mov L207, *r0
+sub #50, *r1
+clr *r6
+L221: cmp r2, L262
+L222: clr L167
+L223: stop
+jsr L93
+L224: dec r6
+inc r3
+L225: .string "fxgq"
+lea L276, L126
+add L187, r2
+add L251, r3
+L226: dec r5
+L227: .data 564, -398, 882, 804, 188, -340
+; comment
+cmp *r6, L242
+L228: rts
+L229: .string "ip"
+L230: .data -857, -11, -51, -436, -941, 659
+not r1
+L231: .string "wfmuqzbsnydiayfmbeqjiaz"
+; comment
+stop
+lea L181, L268
+cmp r0, *r6
+; comment
+red *r7
+clr L255
+lea L261, *r3
+prn L271
+not r4
+L232: .data 657, -426, -563, 547, 397, 407, 718
+L233: .data -679, -454, -275, 831, -486
+L234: rts
+red L263
+jmp L87
+L235: .data -243
+add L239, r0
+mov #-81, r3
+L236: .data -653, 197, 405, -647, -644, 547, -722
+cmp #221, r4
+prn L26
+not r5
+L237: add r7, *r5
+rts
+L238: jsr L257
+L239: inc L171
+L240: red r6
+not L262
+L241: jsr *r2
+dec *r4
+clr *r3
+mov #183, L276
+add #247, *r3
+sub L210, *r5
+L242: bne L226
+mov *r5, *r6
+L243: .data 469, -524, -741, -712, 860, -382
+clr L90
+red *r7
+; comment
+L244: .string "antcnuiijtpznlhaarwrhs"
+bne *r1
+dec r3
+clr L264
+cmp *r7, #-126
+L245: jmp L251
+mov *r3, L112
+stop
+prn r1
+jmp L270
+prn L225
+inc *r4
+clr L38
+L246: .string "unhrnqmmf"
+cmp L248, r0
+rts
+inc r5
+rts
+rts
+inc *r1
+cmp r0, *r6
+add r6, r4
+L247: .string "rglsmtxhfikjrsrdkoxfd"
+rts
+sub #80, L262
+L248: rts
+L249: mov L157, *r4
+lea L54, *r7
+L250: .data 993, -796, 635, -743, -692, -850, -830, 591
+mov L80, *r1
+L251: inc L105
+L252: .string "c"
+stop
+bne L212
+rts
+add *r1, L201
+; comment
+not *r5
+not r7
+L253: dec *r0
+rts
+stop
+clr r4
+L254: .data -547, 585, -279, -12, -230
+L255: add r3, *r5
+L256: lea L271, *r5
+L257: red *r4
+prn r0
+mov r0, L268
+L258: .string "myjtfvhxegnpd"
+mov #85, L275
+
+; comment
+add *r0, r2
+not *r5
+L259: .string "yti"
+L260: inc *r1
+jsr *r2
+clr L272
+not r5
+L261: .data -709, -870, -19, -568
+rts
+lea L277, *r4
+bne *r4
+
+jmp *r6
+mov L276, *r1
+L262: prn #-67
+red *r4
+cmp *r6, *r5
+L263: .data 72, -94, 663
+add #213, L48
+L264: .data 518
+inc *r4
+jsr *r1
+
+L265: cmp #250, *r2
+mov *r5, L252
+L266: mov *r3, *r2
+sub L256, r1
+L267: prn r0
+jmp *r7
+bne L116
+L268: clr r2
+clr L120
+L269: .data 697, -615, -184, 971, 779, -171, -80, 879
+dec L275
+cmp *r2, *r1
+bne L278
+red *r0
+L270: sub *r7, L175
+dec L273
+red *r0
+add #244, *r2
+prn r2
+mov L20, r5
+clr *r6
+stop
+L271: red r5
+
+inc r2
+sub L277, L185
+L272: .string "tydrualnnjbocmeitbgaiyy"
+cmp r6, #-183
+lea L274, *r3
+L273: sub L60, L277
+L274: mov L278, *r2
+stop
+clr L277
+mov *r2, r4
+L275: add L276, *r3
+stop
+add r0, L278
+L276: not r4
+dec r0
+dec r2
+lea L18, *r7
+jmp L72
+stop
+rts
+jmp L237
+L277: not *r7
+add L278, *r3
+rts
+L278: mov r0, r6
+cmp *r4, L253
+bne L66
+stop
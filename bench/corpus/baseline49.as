@@ -0,0 +1,1020 @@
+; Generated by genCorpus --seed 50
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+jmp L34
+mov *r7, *r3
+L0: .data -364, -355, -719
+jsr L0
+L1: .string "qgbelyffoigtvtprpeppc"
+L2: rts
+L3: add #132, L56
+stop
+not *r1
+stop
+L4: sub *r2, *r0
+bne *r3
+red *r3
+cmp *r7, *r5
+cmp r1, L4
+lea L99, r0
+add L158, *r7
+L5: prn r6
+bne L186
+inc r1
+L6: bne *r4
+bne *r5
+sub #149, L5
+L7: .string "vqs"
+bne L4
+lea L1, L5
+
+add *r5, *r3
+add *r4, L115
+L8: dec *r3
+L9: cmp r5, L154
+L10: not L71
+inc L240
+clr *r7
+L11: .string "lww"
+L12: .string "ssepbntvevsmmzbqu"
+lea L15, r1
+L13: not *r2
+prn r1
+sub L62, L11
+stop
+add #-11, *r4
+prn #-204
+red L220
+red r1
+L14: not r0
+L15: .string "ckzyyphqjkupyqlzuvnf"
+dec *r4
+not r5
+L16: .string "nwqxchnfadpcezzgo"
+L17: red *r5
+L18: .string "yduyhcqnnlbyyzzjaopjfoox"
+L19: rts
+rts
+stop
+not r4
+bne *r2
+cmp *r6, *r5
+
+stop
+L20: bne *r7
+L21: red *r2
+sub #-101, L182
+jsr *r0
+sub L214, L29
+mov r0, *r3
+jsr *r7
+mov r0, L28
+bne L72
+inc r4
+L22: .data -177
+L23: sub L6, *r5
+bne *r1
+clr r0
+jsr L92
+bne L7
+L24: .data 935, 744, -935, 825, -601, 821
+prn #-79
+L25: lea L139, *r0
+jmp *r7
+red *r2
+rts
+lea L115, L263
+L26: clr L52
+cmp L267, *r0
+rts
+L27: red L13
+add *r6, L4
+L28: not r2
+L29: .data -242, 373, 392, -802, 578
+dec r5
+add r5, L11
+jsr L227
+prn L9
+red *r5
+L30: .data 45, -810, -793, 886, -245, 890, 887
+L31: cmp L17, L8
+sub #-141, r3
+rts
+sub L49, L252
+rts
+clr r3
+mov #126, L6
+jmp *r5
+sub *r0, L226
+clr L172
+rts
+L32: lea L3, *r0
+clr r4
+jmp *r3
+; comment
+mov #-194, *r3
+L33: jmp L32
+rts
+L34: .data -822, -128, 940, 293, 668
+clr *r7
+red *r7
+jmp *r6
+jmp *r1
+bne *r2
+mov *r2, *r0
+clr r1
+L35: lea L31, *r5
+L36: rts
+cmp #-14, r3
+lea L15, L4
+prn L11
+L37: .string "rkeygrn"
+
+L38: .string "rmk"
+clr r5
+prn L17
+dec r6
+L39: prn #5
+stop
+dec r6
+L40: .string "apbsbshqacvpmon"
+rts
+cmp L82, r5
+add L235, L18
+lea L264, L261
+rts
+dec *r1
+L41: .data 269, 985, -108
+red *r2
+jmp L224
+add r7, L16
+L42: jmp *r7
+mov L22, L20
+red r2
+L43: .string "pifjiuy"
+L44: dec *r5
+prn r4
+L45: .data 794, 815, 509, 340, -521
+L46: .data 684, -352, -738, -355, 384, 609, -294, 332
+L47: sub r6, r6
+L48: jsr *r6
+rts
+L49: .data -263, 452, -926
+rts
+not r0
+not *r1
+jsr *r6
+clr *r2
+stop
+L50: clr r3
+red r5
+L51: cmp *r2, *r6
+L52: stop
+rts
+prn r4
+clr *r7
+inc L39
+red r1
+cmp #239, #-2
+lea L231, *r3
+L53: .data 845, -66, -937, -71, 867
+jsr L34
+; comment
+jmp L30
+L54: dec r7
+bne L28
+inc L30
+L55: .string "rnxy"
+add *r2, r5
+
+add #-117, *r2
+lea L8, r7
+sub L12, r0
+; comment
+
+L56: .string "pxqsq"
+add *r0, L72
+L57: prn #230
+L58: .string "iokeurhslgg"
+L59: dec L6
+L60: sub #-36, L15
+prn #-78
+inc r6
+bne L19
+
+not *r6
+stop
+L61: jmp *r4
+L62: jsr *r3
+add #-9, *r4
+clr *r5
+jsr L38
+L63: .data -859
+inc L83
+sub *r1, L143
+jsr L194
+L64: rts
+L65: bne L23
+prn *r3
+clr L27
+L66: mov r3, *r4
+L67: jmp *r7
+prn *r5
+sub r0, *r7
+L68: .string "koe"
+cmp *r5, #-79
+bne L20
+bne *r2
+clr r5
+L69: prn L2
+L70: .data -607, -323, -707, 773, 903, -357, 917
+lea L99, r4
+stop
+red L6
+add #-102, *r4
+prn L8
+L71: stop
+lea L16, L118
+lea L152, r0
+L72: .data 619
+bne L215
+red *r0
+L73: .string "qhsfsguzsb"
+L74: stop
+L75: .string "mqejmnpmxnwii"
+dec *r4
+sub #6, *r6
+add L124, r7
+L76: jmp L150
+L77: .data 760, 924, 18, 976, 145, 76
+L78: .data 934, -418, -500, 823, -246, -132
+; comment
+; comment
+lea L44, *r7
+add #92, r3
+prn *r6
+jmp L209
+rts
+L79: .string "tyce"
+not *r6
+not r0
+red *r5
+L80: add *r0, r6
+jmp L135
+
+cmp L73, *r6
+not L226
+sub #177, *r6
+L81: .string "uqopugzfnkmxmvkjyaog"
+L82: prn #183
+mov r4, L34
+bne L54
+clr *r5
+red r3
+stop
+red *r2
+not *r5
+inc L147
+cmp L88, r5
+dec r6
+dec r6
+L83: .string "xnzztzcikavsmiyruh"
+prn L3
+sub *r1, *r5
+lea L77, *r5
+prn r7
+jmp L74
+L84: prn *r1
+jsr *r0
+L85: clr *r0
+red r6
+; comment
+bne *r0
+rts
+L86: mov L117, *r2
+; comment
+L87: sub L80, L156
+L88: rts
+
+rts
+mov r5, r5
+clr r5
+jsr *r4
+rts
+L89: sub #185, r1
+red *r1
+jsr L131
+not r7
+L90: prn *r2
+clr r7
+L91: jmp *r2
+L92: .data 400, -994, 894, -154, -718, -508
+L93: rts
+cmp #-54, L107
+add *r0, *r1
+L94: .string "tgzp"
+rts
+sub L46, L74
+dec *r4
+L95: not r5
+dec L86
+inc L124
+sub #146, r6
+bne L13
+dec r0
+jsr L21
+jmp L118
+L96: stop
+; comment
+dec L35
+jsr L47
+L97: add #1, L160
+L98: jmp L9
+L99: .string "ijdbox"
+inc r4
+jsr L71
+rts
+sub L117, r2
+jsr L76
+add #-104, *r4
+dec r6
+L100: clr L242
+L101: bne L240
+prn r2
+L102: add *r1, r5
+L103: lea L100, L36
+jsr *r6
+L104: add *r5, r1
+mov *r7, r3
+L105: lea L26, L185
+add r0, r4
+rts
+L106: prn L235
+lea L85, r4
+; comment
+rts
+inc L92
+add #-5, r1
+L107: rts
+L108: bne *r0
+L109: mov *r2, L197
+rts
+bne L56
+cmp *r5, *r2
+L110: .data -716, 29, -794, -949, -410, 0, 961
+clr *r5
+L111: rts
+; comment
+prn #178
+jsr L9
+prn L175
+clr L4
+not *r0
+bne *r0
+L112: jsr *r4
+L113: .data 703, -598
+inc r4
+dec L112
+inc L159
+cmp r5, r0
+mov r5, *r2
+mov L17, r5
+jmp L73
+L114: bne L187
+L115: add L125, r4
+L116: lea L264, *r0
+add L210, L61
+L117: mov *r4, *r4
+prn *r0
+
+clr r0
+; comment
+stop
+dec r6
+
+jmp L59
+dec r1
+clr r3
+; comment
+red r6
+L118: mov r2, L224
+inc L4
+jsr *r7
+mov *r5, L100
+L119: dec r6
+dec *r3
+L120: cmp #171, L129
+add *r3, r2
+lea L203, *r2
+L121: rts
+
+inc r3
+stop
+stop
+dec r5
+L122: .data 166, 359, 425, -47, 180
+stop
+inc r5
+; comment
+jmp L57
+not r3
+bne L64
+L123: cmp r6, L99
+
+sub *r4, *r7
+L124: add #-29, *r0
+cmp #204, #211
+L125: add *r0, r3
+stop
+red L158
+stop
+lea L20, r7
+L126: bne *r1
+bne L105
+not L57
+L127: red L269
+mov *r2, L160
+L128: prn #65
+L129: .string "ddltfehmfgwiyno"
+jmp *r6
+L130: jmp *r6
+rts
+lea L112, L261
+bne L40
+L131: .string "ziggektueosgvdeejphou"
+jsr L125
+bne *r7
+dec L248
+L132: clr *r6
+prn r5
+stop
+L133: dec *r3
+inc r7
+not *r3
+add r6, *r0
+lea L93, r1
+mov #230, L216
+; comment
+
+inc r6
+red *r0
+not r0
+cmp L106, *r2
+prn L144
+rts
+L134: clr *r6
+lea L219, L96
+lea L44, *r1
+bne L85
+lea L118, *r7
+
+mov *r0, r5
+rts
+sub r7, *r2
+not *r6
+dec r7
+jsr L104
+add r1, L4
+; comment
+jmp L105
+inc L4
+L135: .data 508
+prn *r4
+stop
+mov r1, r3
+L136: not L151
+add #-214, L249
+inc L159
+bne L150
+L137: not r5
+jsr *r5
+red *r6
+L138: mov #197, L266
+not L12
+cmp L35, L171
+L139: .data -191, 4, -909
+L140: add #137, r7
+L141: mov *r1, *r4
+L142: cmp r2, L112
+mov *r1, L50
+L143: .data -841
+prn #216
+stop
+red r2
+jsr L108
+red *r4
+dec L148
+jmp *r1
+jsr L54
+prn #-130
+cmp r6, *r4
+sub L1, r7
+cmp L201, #110
+L144: rts
+jsr L162
+rts
+L145: .string "hnbcfpklvdcfwvcg"
+add *r6, L143
+not L249
+clr *r1
+sub #154, L179
+jsr *r0
+not r6
+add r5, *r4
+prn #123
+L146: rts
+L147: .data 772, 595, -857, 724
+L148: .data 817
+jmp *r5
+sub *r3, *r2
+bne *r2
+rts
+jmp *r7
+jmp L48
+L149: prn *r1
+cmp L31, *r1
+inc *r6
+stop
+red *r2
+red r7
+cmp #40, #-184
+rts
+sub r5, L58
+inc r3
+not L4
+sub #18, r0
+jmp *r5
+sub L167, *r0
+clr L45
+add *r4, r7
+stop
+prn *r5
+red L206
+L150: cmp *r7, L205
+L151: mov L259, L116
+L152: sub L81, *r0
+sub #102, *r3
+
+dec L265
+stop
+prn r2
+lea L151, r4
+prn r1
+cmp #-198, L28
+L153: clr L124
+jmp L248
+sub r1, L250
+L154: red *r0
+lea L215, L182
+L155: cmp L202, r7
+dec r7
+red r5
+L156: red r0
+L157: .data 122, 330, -66, 85
+clr L58
+clr L207
+cmp L176, L250
+sub *r7, *r7
+L158: clr r5
+L159: stop
+L160: bne L124
+not *r5
+mov #-143, *r3
+L161: sub *r5, L19
+L162: rts
+L163: clr r1
+
+L164: red r2
+add r7, r6
+prn *r5
+add *r1, r1
+L165: cmp r0, *r5
+jmp *r4
+cmp *r6, L125
+rts
+bne L27
+red *r6
+rts
+sub L14, r7
+red L148
+L166: jmp L150
+L167: not *r6
+jsr L225
+jmp *r6
+jsr L275
+L168: .string "gaurtfxvvosiltzcyesf"
+L169: jmp L266
+add *r2, *r6
+inc *r7
+not r0
+dec L57
+red *r1
+cmp r5, *r4
+jsr *r7
+sub #-34, *r1
+stop
+L170: .string "adaqwpzutofzul"
+L171: stop
+L172: .string "rtpecpzk"
+mov r4, r0
+mov r6, *r3
+dec L125
+sub L20, r4
+jsr L178
+L173: .data 447, 94, -232, -839, -414, -416, -217
+not *r7
+add *r5, *r4
+L174: .string "htzatkabtaeuy"
+dec *r6
+prn *r5
+prn L59
+jsr L249
+not *r6
+prn *r2
+add *r7, *r0
+sub L39, *r7
+; comment
+stop
+jmp L26
+sub L181, *r5
+stop
+rts
+add #-136, r6
+dec r6
+red r1
+stop
+L175: clr L235
+jmp *r4
+rts
+stop
+; comment
+rts
+rts
+not *r4
+; comment
+not r2
+L176: .data -799, -84, -829, 521, 838
+clr *r1
+stop
+add L227, r6
+L177: inc *r1
+sub r1, r4
+jsr *r5
+L178: inc L87
+inc *r5
+stop
+add r3, r5
+mov L122, r3
+sub *r1, r7
+rts
+jsr *r0
+red L270
+L179: .string "yltfmbkkjhqncjggaujna"
+L180: .data 503, 592, -998, 942, -720, 920, 237
+L181: .data -993, -539, -427, 728
+add *r5, L268
+sub *r7, L212
+jsr *r5
+L182: mov r4, *r1
+cmp #125, #-46
+dec r2
+inc L101
+rts
+bne L34
+jmp L32
+mov L205, *r1
+L183: mov L252, r7
+inc *r0
+jsr *r0
+inc *r3
+inc *r6
+L184: jmp *r0
+rts
+L185: add r5, *r6
+dec r1
+L186: .string "ks"
+
+L187: .data 579, 865, -685, -486, -277, 386, -413
+; comment
+clr r2
+L188: sub L188, *r2
+prn #132
+dec *r3
+dec *r3
+mov *r7, *r3
+L189: rts
+L190: stop
+not L262
+L191: .string "vzqz"
+cmp r6, r3
+not L46
+L192: red *r7
+L193: not *r1
+not r4
+bne L206
+L194: red *r0
+bne *r4
+add #-32, L23
+not *r3
+L195: .string "ryxwtztkyesvjfyt"
+add L139, L168
+
+L196: .string "iscr"
+not *r2
+L197: sub *r1, r3
+add r7, L44
+mov #-39, *r1
+L198: .data -702, -225, -465, 643, 538, 705
+L199: clr r3
+mov #-218, r2
+dec L267
+; comment
+jmp L158
+red r3
+L200: prn L136
+red *r3
+prn *r5
+lea L202, r5
+L201: rts
+red *r3
+rts
+L202: .data -971, 940
+jsr *r5
+mov L129, *r6
+L203: mov *r7, *r2
+bne L245
+L204: jsr L165
+red *r0
+cmp *r7, r6
+red r6
+
+jmp *r3
+bne *r4
+mov r0, *r7
+; comment
+sub L117, L219
+bne *r1
+rts
+L205: .string "ggzxwug"
+red L167
+clr *r5
+red r6
+L206: .string "pfxtssky"
+clr r2
+jmp *r2
+cmp *r1, *r7
+not L179
+mov #-3, L2
+; comment
+mov L215, *r4
+L207: rts
+sub *r2, r4
+stop
+inc r2
+L208: jmp *r7
+bne *r4
+L209: add #219, *r1
+not *r5
+L210: rts
+L211: clr *r4
+L212: sub #192, r0
+L213: inc r2
+stop
+add *r4, *r2
+bne L220
+sub L63, *r6
+mov #-114, L100
+stop
+lea L162, L214
+cmp *r7, L216
+inc r7
+rts
+clr L175
+rts
+lea L248, r4
+stop
+red *r4
+lea L235, r6
+lea L55, r1
+jmp *r7
+L214: dec *r5
+red r0
+dec *r6
+prn r0
+cmp r1, L243
+mov *r2, r6
+jmp *r0
+mov #145, L268
+
+jmp L271
+cmp r0, r0
+L215: rts
+lea L56, L264
+L216: inc *r0
+jmp L252
+L217: jsr L16
+jmp L231
+L218: .string "vkemsufiz"
+L219: clr L45
+L220: lea L258, L252
+bne *r6
+jsr *r6
+L221: .data 400, -986, -387
+rts
+not L247
+L222: mov #-88, *r2
+prn *r5
+clr L93
+bne L77
+lea L122, r5
+L223: mov L239, L239
+dec L253
+sub #-160, L230
+red L121
+clr *r2
+red r4
+L224: not L145
+add #-72, L243
+lea L128, r6
+L225: stop
+jsr L233
+not L81
+mov L107, *r1
+mov #86, r5
+L226: .data -462, 444, 353, -574, 741, -240, -502
+clr *r1
+bne L155
+L227: sub *r3, *r0
+red L246
+L228: sub *r6, *r2
+L229: stop
+L230: .string "nojczdmqigyucte"
+L231: .data -291, -102, -207, 92, -194, 614
+jsr L90
+L232: lea L126, r3
+mov L274, *r7
+L233: cmp *r4, *r0
+
+cmp *r0, r1
+mov #95, *r0
+stop
+bne L120
+bne L258
+; comment
+L234: mov *r2, L178
+L235: .data 720, 306, -104, 253, -433, 599, -156
+
+jmp *r4
+bne *r4
+rts
+
+sub #238, *r0
+lea L184, *r3
+
+L236: .data -914, -869, 924
+sub *r5, L275
+L237: stop
+not r2
+L238: .data -145, 382, 608, 350, 375
+add r3, L266
+L239: stop
+clr *r3
+lea L255, L253
+L240: .data -608, -127, -299, 959
+
+L241: dec *r0
+inc *r6
+bne *r2
+L242: bne *r0
+clr *r3
+sub L215, r5
+
+L243: jsr L105
+
+lea L275, r4
+L244: .data -321
+mov r0, *r1
+L245: sub *r6, L10
+
+mov *r1, *r7
+L246: stop
+L247: sub *r2, r6
+dec r4
+not L264
+cmp r5, L21
+rts
+prn L251
+add #-115, L270
+prn #148
+red L50
+not L154
+red *r7
+dec *r6
+jsr *r7
+mov #-1, r1
+cmp L16, r7
+red *r0
+add #225, r2
+L248: .string "hqwqspwuiwuc"
+cmp r3, #5
+L249: stop
+jmp L59
+L250: bne L266
+bne *r2
+L251: cmp *r5, L125
+stop
+dec *r4
+stop
+not r3
+mov #158, *r3
+
+L252: .string "ojhosudev"
+inc *r4
+prn r0
+L253: .data 151, 280
+cmp r6, L92
+cmp #30, *r0
+clr *r2
+lea L264, r0
+prn #-203
+rts
+rts
+jmp *r0
+L254: .string "oidnycceoa"
+L255: .string "rowwmazkiopyosqvlbtqn"
+sub #34, *r7
+L256: mov r0, r1
+bne *r4
+not r5
+inc r5
+add #133, *r2
+; comment
+prn *r0
+prn r5
+L257: rts
+dec *r1
+bne L260
+stop
+L258: .string "gokmrqclmjojy"
+lea L265, r4
+red r6
+lea L103, r0
+L259: jmp L264
+stop
+L260: lea L123, L19
+stop
+L261: prn *r1
+cmp #236, #225
+jsr L91
+L262: cmp *r5, r1
+L263: stop
+prn #144
+mov *r2, r1
+clr *r4
+mov L87, r1
+clr L65
+jsr L268
+jsr L67
+jsr L137
+L264: prn r5
+L265: sub r3, r5
+rts
+L266: dec r4
+L267: .data 370, 753, 852, 433, 386, 646, 43
+L268: cmp *r1, #130
+inc r4
+L269: prn L213
+L270: .string "tkazgidjpzkpknbsai"
+L271: clr r7
+dec L272
+not r2
+red L275
+jmp *r0
+L272: bne *r7
+mov L275, *r2
+clr L275
+jmp L60
+L273: .data 730
+add #180, L275
+L274: lea L275, r4
+cmp L264, *r6
+cmp #-226, #-104
+L275: .data -17, 149, -709
+red *r3
+stop
@@ -0,0 +1,1019 @@
+; Generated by genCorpus --seed 6
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+bne L79
+bne L46
+; comment
+L0: red L59
+dec L25
+stop
+cmp *r1, L0
+red *r4
+mov #-152, L0
+L1: not *r7
+L2: bne *r6
+sub L163, *r3
+L3: .string "wd"
+red L0
+lea L2, r6
+clr L0
+L4: clr r6
+L5: not L0
+L6: .string "nmdaqhuotkzyzuhx"
+L7: mov r7, r7
+L8: .string "yucfqvruyu"
+inc L254
+not L190
+cmp #-23, #103
+not r6
+clr L4
+stop
+bne *r7
+lea L0, *r0
+L9: red r2
+add *r6, *r4
+jmp *r5
+rts
+rts
+red L0
+clr *r2
+mov L48, *r2
+L10: .data 57
+rts
+lea L5, *r2
+prn r0
+clr L8
+L11: .data 945, 621, 545, -142, 988, -230, -865
+stop
+not L248
+lea L137, r0
+dec L118
+jmp L10
+red L8
+L12: lea L11, *r4
+rts
+mov *r0, r7
+red *r6
+clr L217
+mov L241, L12
+L13: .string "bqrolpgvaxctnztwxgxo"
+bne L15
+L14: jsr L13
+prn L27
+lea L160, *r1
+stop
+; comment
+inc r2
+stop
+stop
+stop
+inc L110
+red *r7
+red r1
+
+L15: .string "vhs"
+clr r1
+cmp L14, #154
+prn L6
+stop
+stop
+L16: .string "wcsxclepttwtqwmlusmm"
+rts
+L17: .string "rztrsmgs"
+stop
+L18: .data -206, -909, -238, 275, 977, 131
+jmp *r7
+prn L18
+L19: .string "eam"
+red L79
+L20: not L226
+jsr *r3
+L21: .string "dsmvveujkjdrkp"
+sub r1, *r2
+lea L18, *r1
+add #-158, L117
+prn #83
+L22: .string "tfckkaxlhwy"
+jmp L11
+not *r1
+bne L6
+jsr *r6
+clr r4
+
+L23: .data -367
+inc L3
+prn L261
+clr r7
+cmp *r3, r6
+cmp #-206, *r2
+L24: lea L206, r0
+; comment
+L25: .data -820
+add r5, *r2
+bne *r0
+jmp *r1
+inc L18
+clr *r4
+prn L15
+mov L9, r2
+rts
+lea L8, *r7
+
+inc r7
+L26: clr L1
+clr *r1
+L27: sub r1, L96
+bne *r2
+dec *r4
+; comment
+dec *r2
+L28: .data 121, -324, -921, 283, -506, -384, -594, 669
+prn L17
+lea L20, L16
+stop
+red *r2
+not *r1
+L29: rts
+mov *r0, L47
+mov L90, L3
+cmp r7, L0
+rts
+mov #127, *r3
+L30: inc *r2
+L31: lea L1, r6
+
+not *r1
+L32: .string "jaegjdpvdpx"
+L33: .data -163, -895, -674
+not r0
+L34: rts
+sub r1, L258
+bne *r4
+rts
+stop
+L35: lea L31, *r3
+L36: .data 583, 420, 4, 845, -539, 113, 993
+L37: .string "mqkp"
+jmp L59
+mov #98, L240
+L38: .string "xpplvhzjecvmkbkvnqptcgj"
+lea L16, r4
+jmp L13
+lea L3, r0
+prn *r7
+stop
+jmp L103
+L39: lea L4, *r4
+jmp L145
+prn L53
+L40: .string "gjxhdfvevohjykfbs"
+L41: dec L241
+bne L128
+stop
+L42: .data -456, 228, 808
+L43: .string "xpdbfcmakplmckqtbdbw"
+L44: .data 536, -857, 903, -852, -778, 216
+cmp L118, r3
+prn *r0
+L45: .string "ea"
+stop
+rts
+rts
+L46: dec L32
+rts
+add *r2, r7
+dec r6
+mov r7, *r7
+bne L27
+mov L45, r0
+stop
+sub r6, r7
+rts
+inc *r0
+L47: .string "fgnyaarnzjdwmmxemg"
+prn *r2
+L48: mov L9, r6
+not r4
+bne *r4
+; comment
+rts
+L49: clr *r4
+red *r1
+dec L42
+; comment
+red *r5
+L50: .string "vcfbkxhmpwm"
+L51: lea L13, L7
+L52: sub L41, L51
+stop
+prn L122
+add *r4, *r5
+L53: .string "rcztgmcqexbr"
+L54: sub r0, *r0
+jmp *r2
+L55: cmp #163, r3
+add #130, *r0
+cmp r3, #14
+red L12
+lea L39, *r5
+not L9
+prn r6
+L56: .string "qqdugdndcjoxka"
+dec r7
+stop
+L57: jsr *r1
+inc r0
+red *r7
+; comment
+not *r4
+sub L220, *r1
+cmp L130, r1
+jsr *r1
+lea L46, r5
+red r5
+L58: not *r3
+add *r4, L105
+; comment
+L59: .string "tuuzyxddmdnlngztoh"
+cmp *r6, #179
+inc r4
+mov L182, L86
+jmp L49
+L60: lea L252, *r4
+prn *r1
+clr L48
+dec r5
+inc r5
+L61: jmp L112
+bne *r7
+L62: cmp r5, #215
+dec L59
+mov *r3, *r5
+L63: rts
+prn *r0
+L64: lea L213, L253
+bne L33
+prn *r4
+stop
+jmp *r4
+clr L126
+L65: sub r0, L193
+clr r3
+L66: cmp #-237, r0
+; comment
+lea L39, L216
+cmp *r1, L5
+prn r3
+jsr L183
+mov L36, L149
+lea L75, L52
+jmp *r6
+stop
+cmp L9, #193
+L67: clr L20
+mov L122, *r3
+
+L68: inc L67
+bne L36
+mov L248, *r7
+L69: .string "pcsoaqhsoygatuukuoyyw"
+inc *r2
+clr L42
+L70: sub L46, *r5
+L71: inc r0
+clr r7
+L72: mov L102, r0
+mov r2, r6
+stop
+prn L212
+red L236
+rts
+clr L15
+
+red *r4
+add r1, *r6
+L73: mov *r1, L230
+rts
+lea L238, L215
+lea L32, L103
+bne L22
+L74: prn *r1
+jsr *r7
+L75: red *r5
+mov r6, *r0
+inc L51
+not r0
+red L70
+clr L178
+
+jmp *r3
+; comment
+red *r5
+jsr *r7
+L76: red L214
+L77: .string "xnexgqxzcpzhyhevi"
+prn r6
+cmp r0, r1
+L78: cmp L77, *r7
+red *r7
+L79: .data 891, -598, 493, -296, -611, -251, -979, 452
+mov r1, r0
+jsr L18
+stop
+prn #-137
+dec L29
+mov #-91, *r1
+stop
+sub L67, r6
+cmp r6, r4
+L80: .data -176, -838, 375, 612, -822, -327, -506
+sub *r4, r2
+lea L43, r2
+inc *r7
+dec r3
+jmp L131
+inc *r5
+L81: not L5
+rts
+sub *r3, r7
+bne L8
+sub #-228, *r7
+L82: lea L261, *r3
+L83: red *r2
+jsr L78
+stop
+
+mov L202, *r0
+L84: .string "qqxksmohnvwkywbs"
+rts
+mov r6, L140
+jsr L187
+clr *r4
+lea L72, L0
+jmp L2
+not *r3
+L85: lea L15, L25
+sub L223, *r6
+bne L158
+L86: sub r3, L257
+add #9, L219
+red *r5
+L87: cmp #-76, r5
+bne L258
+rts
+L88: jmp *r3
+clr L67
+L89: inc *r0
+L90: clr *r3
+
+
+L91: red r4
+mov #-68, *r1
+L92: rts
+not r3
+sub L214, r0
+L93: clr r2
+jsr *r2
+clr r4
+L94: red r1
+prn #-182
+sub L41, r4
+rts
+L95: dec L24
+lea L93, *r4
+L96: .string "wyiskfjkqtp"
+stop
+rts
+red *r1
+clr r7
+L97: jsr L221
+sub *r3, r1
+L98: lea L178, *r3
+L99: sub #18, *r1
+lea L119, L32
+sub #-10, L71
+
+bne *r1
+mov *r1, L52
+lea L229, L206
+rts
+clr L221
+jsr *r2
+inc *r4
+red *r6
+add #180, r6
+not r5
+jsr L109
+L100: dec r0
+mov #-119, *r2
+
+cmp L217, *r2
+prn L34
+mov *r4, *r1
+L101: add #70, L172
+inc *r3
+rts
+clr L74
+prn #113
+stop
+stop
+not L93
+; comment
+lea L171, L103
+L102: rts
+lea L95, L47
+L103: sub #-73, r7
+add L138, L239
+rts
+mov *r3, r0
+jmp L43
+jmp *r1
+; comment
+L104: .data 563, 261, -620
+prn *r6
+L105: rts
+rts
+add r1, r2
+red *r2
+; comment
+L106: .string "cibujiqzfhlpahnn"
+dec L159
+not r0
+not L226
+cmp r0, *r6
+jmp L247
+jmp L36
+L107: prn r6
+L108: red *r0
+red r1
+prn r0
+prn r0
+clr *r4
+inc r2
+L109: prn L101
+L110: cmp #37, L16
+clr r3
+sub r0, r0
+L111: jsr *r4
+L112: .data -222, -997
+red L40
+; comment
+L113: .data 141
+clr *r4
+L114: .string "cpqlodfoknzjc"
+rts
+stop
+sub L85, *r2
+dec L1
+red L99
+
+; comment
+red L121
+L115: .data 714, 557, 384, 689, 181, 830, -821
+L116: .string "keuzgrycynvwfpgowmuqfkr"
+jsr *r7
+L117: .string "jxkb"
+dec r7
+L118: clr *r7
+stop
+red *r3
+clr L0
+bne *r3
+inc r4
+rts
+jsr L51
+jmp L75
+L119: cmp *r5, *r7
+bne *r5
+L120: .data 685, -362, 787, -131, -580, 310, 580, 231
+cmp #194, #-39
+clr r1
+cmp #-15, *r5
+inc r6
+prn #137
+dec r6
+bne L216
+L121: add *r2, r5
+cmp *r4, *r0
+mov L162, r0
+lea L204, L167
+prn r0
+jsr *r7
+dec r7
+L122: not L19
+sub r2, r4
+L123: not *r2
+clr r2
+L124: rts
+L125: add *r6, L261
+L126: .data -519
+red *r4
+dec *r6
+; comment
+not r7
+prn #65
+rts
+stop
+L127: red L88
+cmp L187, L74
+not *r4
+lea L187, *r7
+add #-210, r7
+jmp L71
+L128: red *r0
+jmp *r1
+not L106
+L129: mov L82, L69
+sub #-124, *r3
+L130: dec r7
+prn *r5
+L131: jsr L262
+rts
+L132: .string "ntyegalhyugbqbq"
+L133: clr *r2
+rts
+clr r6
+L134: clr L211
+add #25, L90
+not r3
+L135: red *r3
+rts
+add L91, *r1
+L136: not r5
+inc L229
+L137: prn *r4
+add #217, r2
+bne L244
+dec r2
+not r6
+L138: cmp #-139, L50
+inc r7
+red *r5
+inc *r5
+L139: not r1
+L140: .data 580, -257, 517, -794, -137, -598, 286
+L141: inc *r4
+L142: rts
+jsr *r1
+inc r0
+stop
+stop
+L143: dec L170
+L144: mov L123, L175
+red r2
+stop
+red r0
+L145: stop
+mov r6, *r7
+jmp *r5
+cmp #161, r0
+jsr L27
+sub L84, L135
+red L89
+L146: rts
+inc r4
+stop
+red L185
+L147: red r5
+inc L24
+
+clr *r6
+red *r1
+stop
+prn r3
+L148: rts
+cmp *r1, L232
+prn *r2
+mov *r3, *r4
+sub #-81, *r4
+L149: sub L229, L45
+rts
+L150: rts
+
+dec L13
+L151: mov L12, r0
+add r2, L187
+; comment
+jmp L242
+cmp L17, #150
+jsr L143
+lea L92, *r4
+red L147
+mov r6, r3
+sub L110, *r5
+sub r4, r2
+sub r4, r1
+add L141, *r4
+mov L59, *r2
+L152: add *r1, r5
+L153: .string "qn"
+lea L141, r7
+dec L207
+stop
+add #-236, *r3
+stop
+cmp #29, r0
+L154: jsr L45
+inc L161
+mov r4, r2
+cmp *r3, *r0
+inc r1
+L155: inc *r5
+rts
+L156: .data -883, 8, 508, 900, -350
+jmp *r4
+mov #245, r7
+mov L41, *r5
+bne L177
+jsr *r7
+clr r2
+L157: dec *r0
+L158: .data 539
+jsr *r5
+red r2
+not L201
+L159: lea L0, r4
+L160: cmp r6, r1
+L161: mov *r6, r7
+dec r1
+add *r0, L234
+
+L162: .string "kccxcuuuajrs"
+bne *r4
+; comment
+inc L42
+dec L131
+cmp L238, *r6
+L163: bne *r1
+L164: clr r7
+L165: dec *r0
+inc r6
+red r2
+not *r4
+L166: jsr *r4
+; comment
+bne L78
+prn r5
+L167: .data -450
+inc *r7
+jsr L16
+sub #64, *r4
+L168: stop
+jsr *r3
+L169: add L17, r6
+red *r1
+red *r2
+clr r4
+L170: mov r3, r3
+L171: prn L239
+red L245
+jmp L178
+clr *r3
+mov *r4, r2
+inc L141
+lea L147, r1
+prn r4
+red *r5
+L172: .string "uyrgbpehavdyegi"
+lea L167, *r7
+L173: .data -573, -632, -154, -993, -539
+clr L188
+L174: sub *r7, r5
+L175: red r4
+mov *r5, *r0
+L176: rts
+; comment
+rts
+rts
+lea L39, r2
+jmp *r6
+dec r5
+L177: .string "ldikeojdxhrmuqrbtplova"
+add #130, *r7
+add #43, L204
+; comment
+mov #56, L137
+cmp *r7, #-38
+inc r6
+L178: .data 544
+rts
+dec *r1
+dec r0
+bne *r5
+L179: sub *r4, r3
+L180: inc r0
+L181: prn *r5
+L182: .data -480
+L183: red L185
+L184: inc *r0
+L185: jsr L208
+bne *r7
+dec *r0
+red *r0
+inc r5
+prn #-170
+L186: .data -326
+bne *r1
+L187: .data 464, 583
+L188: .data 232, -193, -318, -654, 286, 442, -862
+clr L259
+L189: mov *r1, L223
+L190: .string "nwpxvlemk"
+bne L232
+L191: clr L219
+rts
+
+jmp *r5
+L192: mov L245, L31
+dec L241
+add L235, r5
+stop
+L193: .data 329
+L194: lea L229, *r3
+not L52
+inc L188
+bne L205
+clr r3
+L195: .string "ahcnywqslvujx"
+L196: .data -767, 375
+clr r2
+mov *r6, *r3
+L197: jmp L19
+clr L232
+add L153, L163
+L198: sub r7, *r2
+add r7, *r0
+dec r2
+jmp *r6
+jsr L204
+lea L104, L103
+jmp *r4
+inc r3
+prn *r7
+L199: prn r1
+L200: mov #38, *r1
+clr L245
+L201: jmp L206
+jsr L185
+stop
+L202: .string "ilqfkzlpqspyaln"
+cmp #181, #-176
+inc *r0
+inc *r5
+L203: lea L80, r3
+sub L5, *r0
+inc r0
+add r3, *r2
+; comment
+not L212
+
+rts
+not L234
+clr r5
+not L30
+L204: .string "cvkkoakmztdiwtuujita"
+L205: sub *r4, L193
+L206: inc r0
+L207: prn r6
+jmp *r1
+prn r0
+bne *r5
+stop
+clr L17
+rts
+dec *r2
+L208: .data 550, -132, -236, 194, -809
+mov L221, *r1
+not L224
+clr r1
+cmp *r0, #133
+jsr L240
+L209: stop
+L210: clr L243
+L211: sub *r5, r4
+L212: not L219
+L213: rts
+L214: stop
+L215: dec r7
+lea L253, *r0
+jmp *r4
+red *r6
+add r4, L32
+prn r1
+jmp L262
+add L141, *r1
+; comment
+mov r7, r7
+stop
+L216: stop
+not r3
+L217: red L182
+
+not *r7
+L218: add #184, *r4
+bne L13
+L219: not r5
+clr L210
+jsr *r7
+bne L137
+prn *r1
+lea L52, r2
+L220: clr L227
+jsr L55
+jmp L243
+
+inc *r7
+
+mov *r3, r0
+L221: .data 500, -425, -726
+rts
+L222: rts
+jsr L50
+stop
+bne L61
+L223: bne L232
+clr L220
+jmp *r6
+red *r1
+lea L245, r6
+jsr L192
+L224: mov *r7, L254
+L225: bne L227
+not r7
+jsr L247
+L226: .data 449, 647
+lea L255, L254
+add L204, *r5
+bne *r3
+cmp L248, r0
+jsr L254
+dec L241
+clr L161
+clr *r5
+L227: lea L236, r1
+dec r5
+dec r4
+mov r1, L128
+dec *r2
+not *r5
+lea L62, L253
+L228: not *r1
+jmp L248
+L229: jmp *r6
+stop
+L230: stop
+mov r7, *r7
+not r4
+stop
+bne *r7
+red L100
+prn L208
+sub #-167, *r3
+not L98
+L231: .string "huxpbrcxoldrnnihxipvpot"
+L232: .data -445, -279, -834, 928, -511, 771
+bne L121
+sub *r6, *r1
+prn r7
+L233: mov r0, L246
+add #-229, r5
+dec r0
+jmp L259
+rts
+L234: bne *r1
+dec *r2
+L235: prn r2
+prn *r4
+jsr *r4
+
+L236: not r1
+prn #48
+L237: .data 650, 530, 490, 109, 556, -710, -385
+dec *r5
+inc r7
+rts
+add r3, *r4
+mov *r4, r5
+dec L240
+not L255
+bne L198
+add r0, L245
+L238: stop
+L239: .string "cfigbspe"
+L240: not *r3
+sub L51, L262
+cmp r3, *r3
+not r7
+add *r6, L251
+mov *r5, *r6
+lea L262, r7
+red L256
+dec r6
+L241: .data 249, -793, 814, 59, 953, 514, -850, 169
+lea L22, *r3
+L242: .data -136, -666, 475, 735, -270
+not L54
+not L244
+red r4
+red r7
+sub r6, r1
+prn L257
+jsr *r0
+dec L134
+red *r1
+clr *r1
+jsr L162
+not L48
+inc r1
+bne *r1
+jsr *r4
+L243: cmp *r2, #-177
+add #-183, *r0
+stop
+L244: prn #206
+prn r3
+lea L259, r7
+inc L246
+L245: clr L229
+L246: .string "qcipgripwtfktyxuvdqhrd"
+dec *r4
+lea L256, *r7
+inc L259
+L247: .string "mei"
+rts
+mov r2, r3
+L248: .string "sv"
+rts
+L249: .data -473, 249
+bne *r5
+prn #115
+L250: cmp #-158, #-117
+L251: dec L255
+L252: .string "rmtpdwazh"
+lea L182, r1
+mov *r5, r5
+stop
+stop
+jmp L256
+clr *r3
+L253: .data -523, -12
+L254: .string "jubzpeyrmzahxmu"
+stop
+bne L89
+rts
+sub #171, L257
+jsr L256
+red *r2
+not r2
+not L72
+mov #-82, L260
+red *r5
+cmp r2, *r2
+prn #56
+lea L256, r7
+L255: jmp L258
+L256: .data -831, -429, 587
+red L258
+L257: jsr L260
+jsr L0
+sub L259, L55
+sub #185, *r2
+sub #213, L5
+red r4
+; comment
+L258: .string "iyyhcdyfotcrwrhh"
+bne L44
+; comment
+red *r2
+red r5
+
+sub L13, *r7
+L259: sub L260, L167
+; comment
+jmp L260
+; comment
+L260: .string "jcibw"
+L261: .string "luvswohzthndoouogbkqz"
+dec *r6
+bne L262
+L262: .data -985, -303, 481, 217
+; comment
+inc L230
+mov *r4, r4
+inc L223
+stop
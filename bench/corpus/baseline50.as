@@ -0,0 +1,1021 @@
+; Generated by genCorpus --seed 51
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+L0: dec r2
+L1: mov *r0, r3
+L2: .data 823, -342, 547, 418, 338, -69
+clr *r0
+add *r5, r4
+L3: .string "ufjvjgqjmfqolxh"
+rts
+lea L0, L122
+lea L1, *r2
+bne *r5
+jmp L77
+add *r5, *r1
+clr *r2
+bne *r4
+not L233
+stop
+
+
+rts
+
+add L36, r7
+bne L1
+clr r7
+add L2, *r2
+mov r3, L24
+L4: red L2
+add *r7, L3
+not r2
+dec *r3
+rts
+L5: sub r0, r5
+L6: .data -788, 562, 602, 87, 895, 826, 830, -37
+L7: .string "uytmvqpwdlnygaayhqi"
+L8: mov *r7, *r7
+lea L269, L0
+L9: .data 5, 281
+cmp #-84, #160
+; comment
+prn r7
+prn r7
+sub r5, L211
+clr r4
+red r2
+dec L4
+sub r7, *r6
+L10: cmp #24, r2
+lea L31, L88
+cmp L168, r0
+L11: stop
+sub r6, L9
+L12: jsr *r2
+mov #-151, L2
+not r1
+inc L7
+prn *r1
+lea L5, L66
+stop
+lea L9, r0
+L13: cmp L11, r5
+red *r5
+L14: .string "qtpcrxytwsewvcowixluzygb"
+mov L163, r4
+
+L15: .string "aetgkiernrwfjhtcdl"
+rts
+L16: .string "iqfheq"
+inc *r6
+L17: .data -672, -819, 859, 288
+red *r5
+jmp *r0
+L18: mov *r2, L7
+mov r3, L6
+L19: sub #-185, L92
+rts
+red r7
+red *r4
+L20: cmp *r7, #-216
+clr L3
+inc r4
+L21: inc r3
+inc L17
+stop
+lea L98, L2
+L22: not *r1
+jmp *r0
+dec *r1
+dec *r0
+prn *r5
+add L22, r5
+stop
+jsr *r4
+L23: sub L81, L82
+L24: .data 795, -108, -231, 377, -158, 362, -607, -734
+L25: bne L33
+L26: .data 539, -967, -907, -946, 925, -242
+L27: stop
+stop
+sub *r5, r4
+L28: add L175, L2
+L29: prn r4
+inc r0
+L30: .string "mqtjmadbuwqngkwdj"
+prn r0
+bne *r3
+L31: stop
+dec L265
+L32: add #185, r4
+rts
+lea L17, L233
+prn r3
+jsr *r0
+L33: dec r3
+clr L119
+jmp L246
+stop
+L34: .data 63, 989, -955, 447, -352, -114, 911
+mov *r4, *r0
+L35: sub r1, r1
+not *r0
+jsr *r5
+L36: jsr L1
+sub r0, L18
+
+rts
+rts
+sub L0, r7
+inc *r6
+L37: mov L29, r2
+L38: .string "asjsqvwecnchcymgint"
+inc *r0
+L39: .data 415, -671, 876, 320, -680, -363, -6, 202
+bne L11
+inc L208
+dec L14
+rts
+L40: not L16
+mov r7, *r2
+mov *r5, L25
+not L277
+lea L19, L5
+sub r5, r2
+L41: .string "lbdsvsouzbhpxfj"
+
+L42: jsr *r0
+rts
+stop
+stop
+L43: bne L170
+L44: red L118
+jsr L26
+inc *r3
+stop
+lea L12, L23
+cmp L22, *r2
+stop
+clr r0
+L45: not r3
+rts
+red *r7
+L46: .string "kabtwmqeglfnqrrg"
+mov L268, *r6
+inc *r7
+stop
+
+cmp L271, L19
+L47: .string "znnxgpafkqbyyjlcmgk"
+red L40
+jsr L15
+L48: inc r3
+L49: bne *r0
+sub *r1, *r0
+
+jsr L20
+jsr *r6
+L50: dec r3
+lea L46, *r7
+L51: inc L28
+; comment
+L52: .data 236, 192, -202
+sub #-248, L26
+dec r2
+L53: prn L198
+lea L64, r2
+
+red L17
+L54: red r0
+cmp #96, r4
+mov L249, *r2
+mov *r2, r5
+add #197, *r3
+L55: add r4, *r7
+red *r6
+L56: jsr L3
+stop
+inc r1
+L57: not *r4
+not *r7
+add *r0, r5
+L58: add r7, L18
+mov L228, r0
+L59: bne L252
+; comment
+L60: cmp *r2, *r6
+mov *r3, r6
+bne *r0
+L61: .data 616, -806, 710, -447
+L62: dec r7
+mov *r3, *r6
+prn L85
+lea L114, *r2
+red r7
+rts
+rts
+sub r2, *r6
+jmp L265
+L63: .string "pflgdxxvjhqlznndtl"
+jmp *r5
+bne L167
+bne *r0
+L64: dec *r3
+prn L36
+L65: .string "yvp"
+L66: .data 564, 806, -96, 545, 542, 164
+; comment
+not r5
+L67: sub #155, *r7
+L68: inc r5
+cmp L189, #-28
+L69: red r1
+add #-215, *r2
+
+dec L71
+add L30, *r4
+lea L56, r4
+L70: sub L36, *r7
+cmp r3, L87
+sub #237, L31
+stop
+add #-30, r0
+L71: clr r3
+lea L170, L76
+sub L4, r7
+stop
+rts
+L72: stop
+L73: .string "shdmwo"
+L74: sub L209, *r3
+; comment
+jmp L45
+L75: .data 288
+add #77, L192
+mov L2, *r1
+L76: clr *r5
+not L26
+bne L11
+dec r2
+lea L66, r0
+L77: bne L38
+L78: .string "olenrcfbrlmozjkhxv"
+add r3, L249
+L79: rts
+L80: .data -817, -682, 226, -316, 601
+cmp L44, #-118
+L81: bne L18
+inc *r2
+red *r0
+prn #-198
+cmp #-91, *r1
+; comment
+prn #223
+sub L49, L72
+L82: stop
+clr *r3
+rts
+prn #254
+L83: bne L60
+bne *r3
+not r3
+L84: stop
+L85: clr r4
+prn #102
+bne *r2
+L86: sub #254, r4
+inc L23
+dec r1
+mov L37, *r1
+jsr L86
+clr *r1
+L87: stop
+L88: add r4, *r3
+lea L39, r3
+L89: .data 861, 124, -145
+L90: jmp L233
+bne L253
+; comment
+mov r1, *r2
+sub r3, L267
+red r3
+L91: bne L35
+L92: .data -567, -74
+bne L18
+dec L78
+jmp L258
+sub *r2, r7
+L93: bne L268
+add *r7, r3
+dec *r4
+rts
+mov #202, r1
+jmp L93
+prn *r0
+L94: jsr L45
+prn L90
+L95: jsr L134
+stop
+add *r7, *r3
+clr L28
+add r2, r7
+red L74
+sub *r4, r0
+add L75, r3
+dec L129
+L96: .string "awkgwdhbrpf"
+not L145
+stop
+
+L97: .string "wivajedqfi"
+lea L173, L95
+inc r4
+dec L98
+; comment
+L98: dec *r4
+mov r6, L78
+L99: jsr *r5
+bne L85
+red L37
+rts
+L100: .data 949, 517, -90, -116, 722, -101, -232, 482
+; comment
+lea L80, *r6
+bne L4
+clr L79
+L101: cmp r2, r4
+dec *r0
+cmp *r5, L194
+L102: prn r7
+L103: .data -931, 966, 801, 93, 169, -418, -833, 306
+inc *r3
+dec *r2
+
+prn r3
+cmp *r7, r3
+add #-253, *r3
+sub *r5, *r0
+lea L86, r6
+stop
+L104: .data -188, 70, 75, 829
+stop
+cmp L9, L31
+inc L54
+cmp r5, #23
+red r6
+sub r7, *r1
+stop
+clr r4
+L105: mov #-34, *r4
+jmp *r2
+L106: stop
+dec L165
+L107: .data -914, 328, -329, -492, 970, -534, -562, -713
+add L261, *r5
+jsr L43
+inc L122
+mov r0, L33
+inc r7
+stop
+inc *r4
+prn L14
+L108: .string "cjosqgirziqgaigm"
+L109: .string "bimbwaqlhygzn"
+L110: .string "i"
+L111: mov #145, *r1
+dec *r6
+not L174
+lea L250, r3
+L112: cmp #-107, L245
+add L182, *r4
+L113: mov *r1, *r3
+clr L105
+jsr *r4
+mov r7, L19
+stop
+L114: .data -201, -640
+L115: sub L185, r7
+not L102
+inc L286
+stop
+rts
+red *r5
+mov r0, r4
+dec *r3
+sub *r0, L21
+cmp *r7, *r0
+L116: .string "jgijduuilrj"
+sub *r4, r4
+rts
+L117: sub *r2, L180
+L118: rts
+bne L249
+L119: .data 776, 53, 604, 866, -784, -10
+L120: not L70
+red r4
+sub r4, r7
+dec r7
+jsr *r3
+jmp *r2
+not L121
+inc *r4
+jmp L183
+clr r4
+cmp r5, *r5
+bne L194
+dec *r3
+add #-187, r1
+L121: red L275
+lea L214, L58
+bne *r7
+L122: .string "awcelolxnxhukxxnereyrfh"
+L123: inc *r7
+L124: cmp *r2, L26
+inc *r4
+clr L137
+jmp L126
+inc *r6
+L125: jmp L55
+sub L58, r1
+inc r0
+L126: add #106, L161
+jsr *r6
+bne *r6
+rts
+L127: .string "onbzocigjvtpusgqho"
+; comment
+L128: .data -584, 564, -251, 393, -159, 460, -353
+bne *r2
+lea L71, *r3
+inc L257
+jmp *r5
+mov #240, *r2
+jmp L49
+red r3
+L129: mov #-206, r1
+L130: prn *r6
+stop
+L131: not *r6
+jsr L31
+clr L112
+cmp #165, *r7
+dec L121
+not *r7
+jsr L104
+clr *r3
+sub L126, *r1
+cmp r2, L93
+stop
+sub r4, *r5
+red *r3
+sub *r7, L28
+stop
+jsr *r2
+inc L174
+L132: jsr L136
+lea L192, r4
+rts
+L133: inc *r1
+red L97
+jmp L14
+inc *r0
+add *r5, L180
+jsr *r7
+lea L154, *r5
+L134: .data 360, 345
+L135: mov #119, *r0
+cmp *r2, *r4
+L136: .string "ksoxcpjldabinpgndbgol"
+L137: mov L58, *r7
+cmp #74, L286
+L138: bne *r3
+L139: jmp L138
+clr L130
+prn r1
+inc L161
+L140: .data -513, -487, 599, -58, -734, -872, -931, 433
+red L179
+L141: prn *r7
+red *r7
+jmp L8
+stop
+cmp *r2, L284
+L142: rts
+bne *r6
+dec *r0
+dec *r5
+rts
+rts
+jsr *r1
+jsr L270
+jsr *r6
+stop
+; comment
+jmp *r0
+sub #-179, r7
+dec *r4
+not r2
+rts
+inc *r3
+inc r5
+
+jmp *r1
+L143: stop
+L144: .string "zudufllf"
+cmp #73, L14
+clr L156
+L145: stop
+L146: .data -126, -445, -57, -922, -770
+L147: lea L180, *r0
+L148: mov L57, L85
+
+jmp *r1
+L149: .string "vjjgtuzaeatfhwzie"
+stop
+jsr *r1
+dec r1
+bne *r5
+L150: lea L221, L2
+; comment
+jsr L132
+L151: .string "a"
+jsr L66
+
+L152: not *r7
+jsr L187
+clr L287
+L153: lea L200, r2
+L154: prn #56
+inc r4
+L155: .data -394, 790, 737, 934, 886, 237
+L156: prn #-17
+red r4
+add *r1, *r3
+L157: inc *r1
+L158: dec r5
+prn r5
+jmp *r6
+L159: .string "fddbranhviruglhnt"
+L160: .data 328, -641, 308, -286, 685
+L161: add L210, L70
+L162: stop
+
+not *r3
+sub r6, r3
+jsr L207
+stop
+sub *r7, r2
+L163: bne L199
+stop
+L164: .string "arhlpsfcudaj"
+lea L125, r4
+
+L165: prn #-219
+L166: prn #130
+bne *r0
+bne L206
+add *r4, L141
+L167: dec L144
+L168: jmp L191
+bne *r5
+bne L177
+rts
+add #133, *r5
+cmp #-123, L182
+L169: .string "pwrhpecjxpvjak"
+L170: prn #-218
+mov #-197, L126
+not *r0
+prn *r2
+bne *r3
+inc *r6
+inc *r7
+; comment
+dec L261
+L171: add #165, L259
+clr r7
+L172: inc L82
+jsr L186
+not L251
+cmp r0, #195
+red *r0
+L173: rts
+L174: dec r6
+clr L273
+sub *r1, *r5
+add *r3, r7
+jmp L71
+sub r1, *r3
+inc r6
+L175: prn r1
+cmp *r0, r2
+L176: red r2
+L177: jsr *r0
+cmp #189, L115
+; comment
+L178: .data 390, 481, 166, -463, -470
+lea L60, r3
+L179: .string "kx"
+not *r6
+lea L110, L201
+lea L76, L282
+inc L192
+
+jmp *r6
+mov r0, r6
+rts
+prn #-217
+lea L234, r3
+not r4
+L180: .string "sqyaelukbfgflu"
+L181: cmp #93, *r1
+L182: stop
+jmp *r0
+L183: .data 774, -126, -384
+mov L220, r3
+L184: add L288, r4
+cmp #122, *r4
+jsr *r0
+rts
+prn *r4
+add *r3, r6
+clr *r2
+jmp L126
+add *r6, L85
+bne L17
+jmp *r7
+bne L279
+dec *r1
+inc *r7
+; comment
+bne *r4
+L185: bne *r4
+inc *r2
+clr r0
+stop
+jmp *r7
+rts
+cmp #-125, #0
+bne L128
+; comment
+cmp *r6, r0
+not r0
+L186: .string "ldzolahwisndhrsmauwng"
+jmp L35
+L187: .string "jcrrmoululu"
+add #-55, r4
+red *r1
+sub #239, *r3
+dec L62
+lea L258, *r6
+stop
+L188: clr *r4
+not *r0
+inc L228
+stop
+L189: .data -226, -499, -192, 433, -948, 674, -93
+dec r3
+L190: lea L131, L217
+clr r3
+L191: lea L214, *r2
+jmp L282
+L192: .string "nvdzbhgqbyerhgtlm"
+L193: inc *r4
+L194: jsr *r4
+L195: .string "xwvmbbatzvgspeehvvrgzh"
+lea L176, L20
+L196: inc *r7
+cmp #169, *r1
+sub L130, r2
+lea L252, *r3
+clr L252
+lea L101, r5
+bne L64
+rts
+inc L46
+
+L197: jsr *r6
+add L57, L156
+L198: .data -572, -959, 873, 570, -644, 946, -170
+dec *r4
+L199: .string "eejoglllzwwejoaejbcbf"
+not L181
+rts
+add #198, L200
+mov #106, *r6
+prn *r1
+L200: .string "cjeyzekxawgqehejcpjzn"
+L201: rts
+lea L194, r6
+L202: clr r3
+jsr *r4
+L203: .string "igiensfygyufnjsnzg"
+bne L285
+L204: .string "fsxevpbosalfzzwmslbyna"
+L205: bne L230
+dec *r1
+lea L185, r0
+not L251
+L206: mov *r7, *r6
+cmp r4, r3
+L207: .data 248, 116, -388, 694, -18, 815, -319, 627
+L208: .string "jomrdpkrkjqmlgefnurjtlf"
+jmp L282
+L209: bne L86
+L210: jsr *r4
+L211: lea L170, r3
+cmp L66, *r0
+lea L286, *r7
+
+stop
+prn r3
+L212: mov r2, r3
+cmp #107, *r2
+not L29
+L213: add L107, L268
+stop
+not L30
+mov #-149, L214
+sub r6, *r1
+not *r6
+
+sub *r3, *r0
+prn *r1
+red *r7
+jmp *r6
+L214: inc *r3
+bne L63
+cmp *r4, L226
+jsr *r4
+jmp L245
+mov #148, r0
+L215: .data -378, -649
+L216: inc *r2
+not *r3
+jsr *r6
+L217: .data 504, 249, -953
+add r1, *r5
+L218: add L271, *r5
+L219: lea L205, r0
+add L252, *r1
+not L235
+L220: inc L78
+L221: dec L230
+bne L92
+L222: .string "upkucrwawa"
+L223: cmp *r7, r7
+L224: .string "qqctrzmnrhqbhtov"
+rts
+L225: .data 152, 451, -136, 118, 226, -85, -247, 603
+L226: .data 344, -564
+add *r0, L218
+prn *r6
+rts
+dec L260
+L227: jmp *r0
+jsr *r1
+L228: add r0, r7
+jsr *r7
+
+not *r4
+bne L289
+dec r1
+not L231
+; comment
+jmp *r5
+L229: red *r0
+stop
+sub L93, L273
+jsr L223
+stop
+red r4
+bne L253
+L230: .data 201, 820, 892
+L231: add r5, L129
+clr *r5
+L232: bne L236
+L233: inc L241
+L234: lea L264, *r7
+not r1
+L235: .string "of"
+sub *r0, *r6
+jmp L255
+red *r1
+cmp r5, L41
+dec r7
+L236: lea L12, r5
+L237: .data -804, -802, -240, 789, -162, 871, 343, -810
+
+L238: sub L196, r6
+bne *r3
+jsr L21
+lea L108, L248
+sub *r7, *r4
+L239: .data 404
+L240: stop
+L241: jsr L146
+L242: cmp r6, *r6
+jmp *r7
+not L276
+L243: .data -469, -555, -39, 111, 3, 842, 924
+dec *r7
+L244: red r0
+lea L257, *r5
+L245: stop
+L246: inc r6
+jsr L289
+clr r5
+
+jsr *r0
+add L101, *r7
+; comment
+rts
+bne L286
+L247: jmp L285
+mov L50, r7
+rts
+not *r4
+dec r4
+L248: bne *r0
+inc *r5
+dec L276
+prn L264
+cmp *r0, L257
+L249: jmp *r4
+L250: .string "ivs"
+rts
+L251: cmp r7, r0
+bne *r4
+stop
+
+rts
+L252: .data -971, -738, 605
+L253: sub #29, L185
+lea L147, L282
+add *r1, L213
+lea L209, r1
+inc L221
+inc r6
+prn #181
+L254: prn #89
+L255: rts
+cmp #169, r0
+add L271, *r7
+not *r7
+; comment
+L256: mov *r3, L263
+L257: .data 430, -534, 183, 814, -551, -216, 657
+clr L275
+add #-234, r1
+clr r5
+mov #231, L267
+prn r7
+cmp #206, *r7
+L258: cmp #-173, #-11
+L259: not L284
+inc L263
+L260: add #11, *r5
+jmp *r2
+prn r6
+dec *r7
+; comment
+L261: prn L273
+L262: .string "zvwfvh"
+lea L281, *r6
+L263: .data -22, 899, 814, -446, 249, -711, -252
+L264: not L49
+dec r5
+L265: rts
+cmp r5, L266
+L266: clr *r7
+stop
+jmp *r2
+L267: inc r5
+L268: rts
+sub L199, r4
+add #31, r2
+not r2
+jsr L87
+
+
+jsr *r0
+jsr *r1
+stop
+add r3, r1
+jmp *r4
+red *r7
+dec *r7
+; comment
+jmp *r0
+clr *r4
+add #163, *r5
+L269: .string "mgnu"
+L270: cmp *r1, #17
+bne L53
+add *r2, L152
+sub r1, r3
+L271: .data -206, 81, 713, 672, 692
+jmp L133
+jmp L284
+add L274, L261
+sub L278, r3
+prn #20
+L272: .data -889, -159, 389, 811, 901, -11, 253, 321
+clr *r6
+
+L273: inc L275
+red L201
+L274: jsr *r3
+L275: not r6
+L276: prn L283
+bne L289
+L277: sub r0, r6
+inc L96
+L278: mov r1, L284
+not *r5
+red L288
+jsr *r6
+not *r6
+L279: sub #177, *r1
+red r3
+rts
+add *r5, *r0
+jsr *r1
+L280: .data -924, 405, -954, -839, -991
+jsr *r6
+prn L284
+inc r1
+L281: jmp L200
+L282: prn *r4
+L283: not r3
+prn #-226
+prn L182
+stop
+L284: .string "msgfcqtahzagmqybhpuiz"
+sub #106, *r5
+sub r5, r5
+lea L287, *r2
+stop
+inc *r4
+prn r2
+lea L199, *r0
+L285: lea L288, *r7
+red *r3
+L286: red L289
+; comment
+L287: sub *r6, r4
+jsr *r2
+cmp *r6, #231
+bne L270
+clr r2
+jsr L213
+not *r5
+jsr L289
+L288: .data 373, -148, -87, 385, -539
+not L289
+not r7
+dec r1
+inc L227
+cmp L289, *r5
+red *r3
+jmp *r2
+jmp L289
+mov r6, L289
+jsr L190
+inc r1
+not L234
+mov *r5, r1
+red *r4
+rts
+L289: .string "ngvwbiku"
+jmp L107
+sub L86, L115
+jmp *r7
+sub *r3, L52
+red *r6
+jsr L17
+dec *r0
+add L220, *r4
+cmp #-49, #-155
+dec *r4
+not *r7
+cmp r0, L212
+sub #-77, L173
+stop
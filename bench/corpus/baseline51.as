@@ -0,0 +1,1020 @@
+; Generated by genCorpus --seed 52
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+bne *r2
+L0: stop
+cmp *r4, *r3
+lea L75, r4
+L1: .data 563, 919, -306, 906, -230, 133, -719
+cmp *r6, #106
+cmp L215, *r2
+lea L124, *r3
+add L204, r3
+L2: sub L163, L74
+clr L31
+L3: rts
+L4: lea L0, r3
+jmp *r6
+inc L114
+jsr L3
+mov r4, r0
+L5: cmp L172, L132
+sub #-97, L4
+clr r3
+inc L266
+mov r7, r1
+prn #182
+
+add r1, L2
+L6: .string "tmasvqthqoubbzz"
+jsr L2
+add L1, L1
+L7: cmp r2, *r3
+dec r1
+cmp L162, #228
+; comment
+dec *r3
+jsr *r7
+L8: stop
+L9: add *r5, L197
+clr r5
+clr *r2
+clr *r3
+sub *r1, L6
+L10: not L22
+not r6
+; comment
+lea L12, *r0
+L11: .data 779, 458
+L12: .string "sspkjivyekaet"
+L13: .data -974, -492, -178, 621, -205, -163, -400
+L14: stop
+jmp *r2
+L15: bne *r6
+jmp *r7
+L16: .data -899, 478, 682, 373, -338, -507, 352
+L17: .data 180, -860, -246, -981, 792, -159, -876
+red r1
+L18: clr L14
+L19: bne *r7
+dec L137
+L20: mov r7, L275
+mov *r2, r3
+bne *r7
+rts
+jmp L234
+bne *r1
+bne L17
+L21: .string "sqklhcfmujjv"
+jmp L71
+dec r0
+not r1
+rts
+L22: .data -812, 652, 238
+inc r0
+lea L196, r6
+rts
+prn #187
+stop
+stop
+L23: .string "dakalqlcpqufsbtttfyfnpv"
+
+L24: red L0
+stop
+sub *r3, *r4
+jmp L190
+L25: prn #77
+clr L13
+L26: .data 772, -878, 150, 409, 732, 860, 210, -747
+add L9, L217
+; comment
+cmp L84, L262
+inc *r2
+dec L8
+L27: jsr *r0
+L28: .data -722, 46
+inc r3
+add #233, *r2
+stop
+jmp L10
+lea L58, r4
+red L8
+L29: bne L121
+lea L24, r1
+dec r6
+red L247
+add *r6, r7
+lea L12, *r4
+L30: jmp *r6
+inc *r0
+jmp L11
+L31: add r4, r7
+bne L20
+bne L14
+inc *r0
+
+add *r5, *r7
+sub *r0, L147
+stop
+lea L0, *r2
+L32: lea L27, L259
+sub r6, r1
+clr *r2
+stop
+red r6
+red r2
+lea L88, r0
+L33: .data 795, -825, 923, -738, -720, 947, -362
+clr *r1
+add r0, r0
+rts
+dec r6
+rts
+inc L52
+prn r3
+L34: add #149, L42
+add #-52, *r7
+lea L0, *r3
+bne L76
+dec L27
+L35: not r6
+red L98
+cmp #-180, L27
+inc r0
+jmp L20
+
+dec *r1
+stop
+L36: .string "nrlnwqtaenryarkunlbg"
+cmp #6, *r0
+jmp L31
+prn L21
+L37: inc *r1
+; comment
+lea L70, r3
+L38: add *r4, *r5
+L39: inc r0
+L40: cmp L38, #137
+L41: .string "cciurdrtoqcerektd"
+L42: .string "gconysfpuvmslh"
+inc L101
+dec L55
+; comment
+
+inc r1
+inc L202
+inc L18
+add r2, *r6
+jmp *r2
+inc *r6
+L43: cmp #19, #103
+jmp L39
+L44: add *r4, L48
+jmp *r6
+clr r1
+L45: jsr L0
+lea L11, L246
+red *r5
+L46: inc *r5
+cmp r4, #4
+lea L18, r4
+prn L231
+L47: jsr *r1
+L48: lea L130, L53
+sub L252, *r4
+jmp L2
+L49: jmp L239
+L50: prn r4
+bne *r5
+L51: red r1
+jsr L167
+jsr *r3
+L52: clr *r5
+bne L16
+add r1, L47
+L53: cmp L109, L9
+stop
+L54: .data -103, -5, -364, -531
+clr L92
+
+prn r0
+prn *r7
+clr *r3
+clr *r3
+L55: rts
+L56: dec *r0
+L57: rts
+red L243
+L58: clr *r1
+lea L12, *r5
+cmp *r3, #-109
+L59: dec L56
+stop
+inc r3
+bne L221
+L60: inc r5
+sub *r6, r7
+dec L51
+cmp *r1, L219
+
+red *r2
+clr *r0
+inc *r1
+cmp *r7, L31
+not L245
+stop
+add *r4, L185
+bne *r3
+jsr *r7
+rts
+L61: mov #-200, *r7
+cmp r4, L12
+L62: clr r6
+jsr L42
+L63: .data 700, 14
+red L31
+jmp L77
+cmp #-24, r3
+jsr L63
+red L24
+bne L77
+bne L44
+L64: cmp #87, *r3
+red L9
+not r1
+L65: .data 238, 247, -816, -719
+add r3, r3
+rts
+jsr L1
+bne *r4
+bne L276
+clr *r2
+red *r7
+L66: lea L55, *r2
+rts
+cmp r0, L42
+L67: inc L133
+cmp #107, r5
+clr r3
+
+jsr L154
+bne L174
+L68: .string "qxqpvtlmdvecn"
+lea L128, r0
+L69: .string "jhhsujokqls"
+L70: add r5, r3
+mov L239, r3
+jmp *r5
+red *r7
+sub #47, L54
+jmp *r4
+L71: .string "dbtvqgcjitdbiatmxu"
+rts
+rts
+sub *r2, L166
+clr r4
+L72: .string "gcvzv"
+L73: stop
+mov #-88, r6
+jsr *r2
+; comment
+mov r3, L211
+jmp L243
+mov *r3, *r2
+L74: sub #110, L39
+L75: stop
+prn L37
+jmp L70
+L76: .data 345, 825, 320, -801, 72, 622, 807, -366
+stop
+stop
+lea L261, *r2
+L77: cmp *r7, L16
+add *r5, L20
+; comment
+L78: not *r1
+L79: clr r1
+jsr L37
+red L4
+jmp *r0
+L80: add L11, r1
+L81: .string "ddpdmdbladuuejmg"
+sub #-72, L53
+L82: red r6
+
+jsr *r0
+bne *r5
+jsr L146
+prn #-50
+L83: prn L60
+inc r1
+add *r2, *r1
+cmp #148, r7
+not r7
+L84: red r0
+L85: .string "xvmygccsgznxqsc"
+clr L70
+lea L47, *r5
+L86: .string "jwokorylmryevv"
+rts
+prn #123
+L87: .data 721, -240, 547, -993, 837, 152
+not *r4
+stop
+; comment
+add r6, L11
+L88: mov #158, L37
+add L22, r6
+mov *r7, *r3
+jmp *r6
+mov *r2, *r5
+prn #123
+add r7, L26
+mov *r3, r1
+dec *r0
+dec *r3
+
+rts
+L89: mov r4, *r3
+L90: mov #89, *r5
+lea L50, L3
+rts
+cmp *r0, #-152
+red *r2
+lea L128, *r1
+clr r4
+jsr *r4
+cmp *r2, r7
+L91: dec *r1
+L92: add *r4, L198
+bne L53
+jmp *r4
+stop
+; comment
+dec r2
+stop
+lea L11, *r6
+rts
+L93: .string "ungikvlioz"
+L94: cmp #-120, #198
+L95: .data -75, -73, -423
+stop
+L96: .data 152, -709, 904, 659, 377, -696, 702, 200
+L97: not *r3
+L98: prn #47
+add #-208, L2
+dec L44
+L99: inc r0
+bne *r2
+; comment
+rts
+add *r1, r6
+prn #248
+add *r4, r5
+L100: add r3, L75
+stop
+L101: cmp L252, #6
+L102: cmp *r1, r3
+L103: red *r2
+L104: red r1
+lea L159, *r0
+prn L7
+dec *r5
+red *r1
+prn L151
+rts
+red *r5
+prn *r3
+inc r7
+L105: .data 223, -265, -269, -451, 792, 564, -334
+
+L106: .data -363, 924, 512, -108
+L107: dec *r5
+not r1
+jsr *r7
+jsr *r6
+clr *r5
+L108: .data -654, -395, 773, -557, 310, 949, 222
+dec r1
+mov *r3, *r4
+L109: .string "p"
+
+inc *r3
+jsr *r1
+red *r5
+lea L82, *r6
+bne *r7
+L110: bne *r5
+stop
+L111: add *r4, r1
+lea L112, *r2
+rts
+clr L36
+prn *r6
+inc *r4
+
+
+
+dec L63
+L112: mov #-159, r6
+lea L101, L261
+cmp *r1, r7
+L113: .data -133, 952, -441, -519, 757
+prn r2
+red L32
+jsr L237
+stop
+dec r2
+inc L222
+inc r5
+L114: .string "qd"
+sub *r3, L6
+not r3
+L115: inc L163
+bne *r4
+inc *r7
+; comment
+L116: .string "pkcvynrggeofjcwwykjo"
+L117: prn L207
+L118: jmp *r5
+; comment
+L119: .data -777, 431, -234
+add #-135, *r3
+dec L49
+jsr L101
+cmp *r3, #-243
+red L81
+L120: .data 45
+L121: mov r6, L227
+L122: jsr *r7
+inc r3
+stop
+stop
+red L257
+jmp *r5
+; comment
+lea L11, L152
+red L3
+mov r3, *r5
+L123: prn #-69
+L124: sub L35, *r7
+L125: inc L231
+
+L126: not r3
+inc *r5
+L127: .string "skdnph"
+red L78
+
+jsr L191
+add r6, r0
+jsr *r7
+L128: jmp *r7
+sub *r7, r7
+L129: .string "sswuzhf"
+inc L251
+clr *r6
+inc r4
+L130: rts
+dec *r5
+sub r6, r0
+dec L183
+jsr *r5
+bne L141
+lea L103, *r1
+L131: jsr *r3
+red *r0
+dec r4
+prn *r1
+L132: .data -896, -311, 168, -953, 798, 997, 620
+L133: clr L192
+
+L134: jmp *r3
+
+L135: rts
+sub L198, L36
+L136: .string "ytxywqxcnorinixhgb"
+L137: cmp r3, *r7
+L138: .data 256, -331, 246, 847, 844, 515
+inc *r3
+jsr *r4
+cmp L52, L117
+inc *r1
+clr L54
+L139: .string "dpmvavauvdgnl"
+add #-77, r2
+stop
+bne *r5
+L140: bne L217
+L141: not *r1
+inc r5
+not r3
+jsr *r2
+
+L142: .data -35, 36
+L143: dec r4
+bne L69
+red r5
+jsr *r2
+rts
+L144: .string "kf"
+sub L29, *r3
+jmp L55
+L145: .data -602, 203, -230, 293
+jmp *r7
+sub r3, r5
+L146: sub *r7, r2
+L147: rts
+jsr *r7
+L148: jmp *r3
+; comment
+
+dec r4
+lea L21, r5
+L149: .data 768, 302, -869, 807, -745, 734, 502
+jsr *r7
+L150: cmp #-96, #-69
+L151: .data -397, 430, 969, 23
+clr L180
+not *r1
+add L271, *r1
+L152: rts
+L153: lea L221, *r1
+dec r2
+jmp L165
+stop
+dec r1
+clr L67
+L154: jmp *r1
+lea L30, L178
+cmp *r6, #-137
+jmp *r5
+L155: not r7
+jmp L171
+rts
+L156: .data 976, -171, 209, 422, 96
+dec *r0
+rts
+sub *r6, L127
+jmp L229
+L157: jsr L202
+L158: .data -791, -477, 394, -489, -875, -510, -56, -188
+lea L120, r4
+mov r4, L103
+rts
+L159: .string "aidzuywvepweuslfviamiuuj"
+L160: jsr L226
+L161: jsr L244
+jmp *r3
+rts
+
+mov r6, r4
+rts
+L162: .string "frylafl"
+add #-238, r0
+lea L223, *r7
+L163: .data -992, -634
+prn *r0
+L164: sub r1, r0
+L165: .data -420, 231, 979
+stop
+bne *r0
+L166: cmp #-249, L134
+add r0, r5
+rts
+inc *r2
+not r7
+jsr L51
+L167: add #197, r3
+L168: .string "fzffvsngawslasb"
+prn #-132
+dec L52
+add r3, r0
+rts
+L169: .string "qfogebcxcu"
+; comment
+bne L248
+sub r0, L121
+sub r3, *r5
+L170: red r1
+inc *r7
+L171: .string "fmlfcnjjg"
+prn *r6
+sub r3, r5
+inc r5
+bne *r4
+add L203, *r0
+jsr L259
+
+clr L89
+not r3
+jmp L134
+L172: .data 606
+rts
+cmp *r1, r1
+L173: not r2
+jmp L144
+add *r5, *r4
+not L6
+red r1
+jsr L237
+bne L189
+mov *r5, L174
+stop
+prn r2
+red r1
+prn #1
+jsr L243
+jmp *r1
+red *r5
+L174: .data -400, -232, -148
+not r4
+jmp L217
+cmp #-25, *r4
+L175: stop
+red L106
+add #198, L239
+sub r4, L56
+red r3
+jmp L3
+L176: inc *r0
+lea L154, L185
+L177: prn *r2
+red *r5
+L178: rts
+add L70, L43
+bne L241
+inc *r0
+lea L236, *r1
+L179: stop
+inc r7
+L180: .data 135, 647, -101
+clr *r4
+inc r2
+add r2, *r5
+add L241, *r4
+mov r2, r6
+jsr *r4
+bne L264
+rts
+L181: .data -787, 262, -659, 882, -7, 893, 535, 965
+jsr L35
+stop
+L182: .string "iodwrudunzisefscbfbpnjr"
+red *r6
+; comment
+lea L134, L211
+inc *r5
+red L210
+L183: .string "pgzwqnuyxkwsqsieszpmgd"
+stop
+jmp *r0
+clr *r7
+
+L184: add L30, r4
+L185: inc L244
+not r5
+stop
+sub L199, L254
+jsr *r4
+L186: bne L93
+sub *r3, r6
+inc r5
+red L239
+inc *r7
+; comment
+lea L239, *r0
+bne *r3
+L187: .string "czydwmmesyervr"
+not L55
+prn L272
+rts
+clr L270
+red L203
+jsr *r2
+sub r4, L37
+L188: sub r1, r7
+; comment
+L189: bne *r4
+mov *r3, L119
+L190: jmp L276
+rts
+rts
+clr r7
+; comment
+
+stop
+bne L192
+L191: .string "pqbiexzxgnphtmdq"
+L192: prn L268
+L193: clr *r5
+red *r2
+inc *r2
+rts
+jmp L199
+lea L208, *r5
+inc *r6
+L194: .data 719, 733, 869, -65, -877
+; comment
+cmp L2, #53
+jsr *r5
+jsr L92
+jmp *r6
+L195: lea L222, *r7
+clr r0
+L196: clr L274
+bne L0
+
+bne L15
+dec L12
+L197: jmp *r5
+stop
+L198: stop
+lea L25, *r4
+bne L123
+stop
+lea L237, r6
+inc *r1
+add #-52, *r3
+; comment
+; comment
+mov L114, L90
+L199: bne *r6
+; comment
+rts
+jsr L253
+L200: red r3
+L201: not r5
+rts
+mov *r1, L216
+mov #-130, L275
+add *r1, r7
+bne *r0
+
+not *r6
+not r1
+lea L134, L258
+L202: stop
+cmp r5, L16
+red r0
+lea L263, *r4
+jsr L215
+L203: .data -108, 716
+L204: inc r5
+jmp L262
+stop
+not *r7
+clr *r4
+bne L225
+L205: .string "lwpqkxuo"
+jsr L17
+red L137
+jsr *r0
+lea L231, r0
+L206: rts
+L207: rts
+not r6
+stop
+L208: inc *r2
+jsr L210
+L209: stop
+jsr *r3
+not L206
+lea L141, r1
+inc r7
+not L217
+mov r4, *r2
+L210: not *r4
+prn *r2
+mov r6, *r7
+lea L234, L9
+dec r7
+lea L224, *r6
+inc r3
+L211: lea L275, *r3
+prn L10
+L212: .string "bwi"
+cmp L227, L88
+add L69, *r5
+L213: .data 333, -960, -375
+dec *r6
+jsr L76
+red *r1
+L214: sub *r3, r6
+not *r4
+sub L4, L273
+
+add L233, r2
+L215: add L232, L148
+rts
+red L220
+; comment
+mov #-155, r6
+L216: mov L263, *r3
+sub #213, r2
+jsr L13
+jmp L208
+rts
+L217: .string "gipodgsfqbgavsca"
+L218: dec *r4
+jmp *r1
+not L246
+add L124, r3
+mov *r1, *r6
+L219: stop
+L220: red r1
+clr r6
+lea L104, *r5
+dec r7
+prn L122
+L221: .data -584, -126, 149, -587
+jsr L229
+dec r7
+not r5
+L222: sub L240, r3
+L223: sub r3, L246
+clr *r2
+dec *r0
+clr r1
+red *r0
+L224: dec r0
+clr r3
+L225: stop
+L226: not *r4
+bne *r5
+dec *r2
+mov r5, r3
+L227: .string "qtmojtqwkfakccxlb"
+L228: red r1
+red r3
+not r3
+L229: .string "drjesc"
+L230: red *r6
+bne L252
+L231: .string "ghqbgnkgyztfmiprhdiognam"
+L232: .data -147
+add #-79, *r1
+stop
+jmp L151
+rts
+clr r2
+red *r3
+sub #167, *r0
+inc L244
+dec *r3
+L233: .data 774
+jsr L193
+L234: jsr *r4
+add #-190, r7
+L235: .data -692, -815, -466, 1
+L236: mov L274, *r2
+not r4
+clr L267
+L237: not L249
+L238: sub r0, L271
+L239: red *r2
+; comment
+lea L243, r4
+L240: .data -514, -30, -259
+L241: sub r1, r6
+L242: jsr *r0
+jmp *r6
+prn #-205
+not r7
+L243: .data -686, 732, -172, 218, 474, 90, 437
+inc L64
+bne L197
+bne L270
+rts
+add *r1, *r2
+L244: .data 732, 841, 170, -832
+inc r5
+clr L249
+red r5
+L245: .string "jzzixp"
+cmp #202, L261
+sub L18, *r0
+L246: rts
+L247: sub *r4, r0
+inc r1
+L248: clr L101
+
+L249: .data -628, 949, -667, 784, 886, 1
+jsr L70
+
+prn r1
+mov *r6, L53
+L250: jsr L268
+sub L253, r7
+L251: cmp L143, #-35
+jsr L254
+dec L267
+mov r5, r1
+L252: .string "mapgcsdeygaguvrckokqneh"
+add *r7, r7
+rts
+inc *r1
+; comment
+not L236
+; comment
+jmp *r6
+L253: bne *r7
+L254: dec *r4
+red *r1
+not L231
+clr r2
+clr *r0
+lea L269, *r4
+rts
+; comment
+clr L123
+bne *r4
+jsr *r0
+red L273
+mov L268, *r7
+L255: .data 38, 311, 861
+L256: not L259
+prn r3
+L257: red L174
+lea L276, r0
+inc L41
+prn #176
+dec L89
+cmp #-115, r7
+
+lea L273, L203
+L258: stop
+add r2, *r1
+
+inc L275
+L259: dec L137
+cmp r5, r6
+inc r5
+bne L177
+L260: stop
+L261: rts
+not r3
+L262: lea L270, r4
+cmp *r5, *r7
+bne L273
+sub r1, L238
+lea L276, *r5
+L263: .data 665, 12, -239, 593, -905
+L264: .data 206, -326, -928, 284, 505, 840, 580, 495
+dec L267
+clr r3
+mov *r5, *r7
+jmp *r5
+clr r1
+L265: .data 971, 290, -495
+clr L20
+prn *r2
+jmp *r4
+L266: jmp *r5
+L267: lea L82, L269
+L268: rts
+L269: lea L274, L89
+bne *r5
+jsr *r5
+stop
+L270: .data -294, 17, -833, 415
+jsr *r3
+clr *r5
+jmp *r0
+stop
+L271: .data -58, 683
+stop
+not *r0
+sub *r6, *r2
+L272: stop
+mov L270, r2
+lea L275, r7
+L273: .data -261, 540, 399, -643
+dec L156
+jmp *r5
+L274: mov *r0, L275
+L275: jsr L276
+add L276, r2
+not L215
+clr L276
+
+lea L276, *r7
+L276: mov *r7, r7
+sub L156, r1
+red r4
+stop
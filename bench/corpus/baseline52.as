@@ -0,0 +1,1021 @@
+; Generated by genCorpus --seed 53
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+; comment
+dec r3
+L0: red L0
+mov #-150, *r3
+stop
+L1: stop
+lea L165, *r4
+jmp *r4
+add L1, L239
+not r3
+bne L0
+cmp L170, *r5
+L2: .string "wdkovxaspis"
+not L295
+jmp *r6
+red r7
+L3: jmp L0
+dec L3
+inc *r3
+stop
+L4: .data -388, -487
+rts
+L5: lea L179, r5
+clr r4
+L6: dec L2
+dec r2
+dec L3
+L7: .string "hbdunqg"
+L8: lea L1, *r7
+L9: mov r5, *r0
+jsr *r2
+jsr L49
+L10: .string "pxtc"
+L11: bne *r1
+L12: bne *r0
+L13: dec *r6
+L14: .data 699, 470, 560, 859, -484, -131, 805
+L15: .string "achpqcveo"
+prn L4
+lea L14, L9
+inc L8
+L16: .data -35, -630, 23, -147, -282
+L17: .string "ztd"
+bne L2
+add L228, L3
+sub *r7, L176
+jmp *r3
+L18: sub r7, *r0
+red *r3
+dec L7
+inc *r7
+prn r2
+clr L16
+jsr *r0
+L19: .data -700, 606, -245, 887, 275
+clr r7
+L20: .data -837, 491, -579
+rts
+clr L177
+stop
+sub r1, L0
+red *r5
+rts
+clr r5
+
+L21: cmp *r2, r1
+add *r6, r4
+mov *r4, r0
+add r3, r4
+sub L3, r2
+jsr *r4
+L22: .data -202
+L23: jmp *r7
+L24: .data 277, 444, 917, -689, 988, 562, -151, -365
+L25: bne L10
+jmp L177
+L26: cmp #-77, r1
+L27: mov L141, L137
+clr r2
+cmp *r6, *r7
+stop
+bne L6
+inc r1
+stop
+stop
+L28: .data -960, -228, -256, -991
+jmp L18
+cmp L225, L55
+dec *r1
+red L262
+L29: .data -880, 220, 173, 269, -530, 848, -636
+add r7, r6
+L30: clr L4
+mov *r2, r5
+rts
+L31: inc r6
+L32: rts
+L33: .data -425, 719, -94, -183, -366, 475, -85, 870
+bne *r0
+L34: .data 995, -809, -32, 993, -781, 439, 763
+cmp #-53, *r5
+stop
+lea L18, L22
+not L27
+stop
+add #223, L228
+clr *r2
+not *r3
+rts
+bne L15
+sub *r3, L78
+
+L35: .string "vvmtwrrh"
+L36: .data -858
+L37: add L32, L6
+L38: lea L169, r1
+stop
+L39: prn L1
+jsr L7
+bne *r7
+stop
+L40: .string "xquyakswwjprioqbtil"
+
+bne L154
+lea L35, L8
+L41: jsr *r0
+clr r2
+jmp L244
+; comment
+bne L47
+prn #148
+L42: stop
+L43: jsr L41
+mov #-186, L32
+
+bne *r0
+bne L4
+red r1
+rts
+L44: rts
+L45: rts
+L46: bne L290
+L47: prn L9
+sub r2, r2
+inc *r7
+mov L46, r0
+
+L48: .data 136, 999, -550, -312, -480, -398
+L49: dec *r6
+clr *r4
+jmp *r3
+L50: .string "bmwuchyqayspzmlhbxqjsz"
+red *r1
+cmp L43, L36
+lea L274, *r1
+dec *r7
+lea L39, L21
+jmp *r0
+cmp L215, *r6
+L51: bne L274
+rts
+jmp *r2
+dec r6
+clr r3
+L52: clr r6
+mov r5, L25
+L53: .data 364, 234, 41, -201, -589, -321, -304, 930
+sub *r1, r1
+rts
+cmp r3, #-69
+lea L241, r7
+add r1, L25
+inc *r2
+L54: not r3
+stop
+L55: mov #250, L78
+L56: .data 728, -108, -636, 482
+jmp *r4
+L57: .string "lphhfkdlpkxskerolomonqru"
+clr r2
+prn L290
+red r0
+red *r0
+dec L228
+L58: add L30, r3
+L59: prn #-67
+L60: jsr L0
+L61: rts
+mov *r5, L116
+mov #-4, L32
+lea L228, *r3
+cmp L6, *r2
+L62: not *r3
+L63: .data -372, 898
+L64: .string "gpxcgxcgqzzinclr"
+sub *r7, *r1
+bne L25
+L65: .string "i"
+L66: .data 794, -639, -544, 323, -376, -236, -83, 794
+L67: inc r4
+lea L33, r3
+L68: .data -917, 193, -949, -502, -638
+L69: .string "fpesllzsvyngnfty"
+L70: stop
+prn r7
+clr r0
+dec L14
+not L118
+L71: .string "tngxdzldmere"
+L72: prn #-213
+mov #-63, *r5
+
+L73: stop
+add L0, r1
+cmp r5, L243
+not *r3
+jmp *r7
+inc L288
+stop
+dec r1
+stop
+jsr L66
+dec r1
+add L5, *r4
+jmp *r1
+lea L57, r4
+L74: .data -80, -930, -13, 651, 856, -156, 317
+inc r0
+mov *r4, r0
+rts
+mov *r5, r6
+dec L238
+lea L235, *r6
+lea L14, r0
+not *r2
+clr r7
+L75: inc *r4
+add *r7, *r2
+sub #-235, r5
+L76: red L14
+add *r6, r3
+L77: cmp *r6, *r3
+not L184
+L78: clr *r4
+sub #152, *r4
+L79: add #-82, L218
+stop
+L80: red r6
+jmp L94
+bne L243
+jmp L71
+sub #96, L112
+L81: .data 578, -237, 555, 943, 456, 360
+prn #-141
+L82: dec L10
+mov #16, L19
+L83: inc *r7
+jsr L195
+inc *r7
+not r7
+jsr L80
+prn *r7
+clr r4
+jsr L69
+inc r7
+L84: .string "foeysq"
+
+bne L194
+dec *r6
+lea L190, r0
+not *r6
+L85: dec r5
+add L253, *r4
+L86: .string "fnreezqlndltwvztt"
+L87: .string "awlfnicgubsmtzicoqnnckho"
+stop
+add r1, *r2
+L88: prn *r3
+jsr *r2
+lea L154, r6
+not r0
+L89: bne L253
+inc r2
+add L164, L85
+
+jsr L257
+add L177, L24
+stop
+cmp *r4, *r3
+L90: .string "xmkmauqdqtirechky"
+jsr L138
+add L200, *r2
+not L82
+bne L112
+L91: .string "vglgsjrwjkbpdktwafvezqxd"
+L92: jsr *r7
+clr L179
+sub *r4, L53
+; comment
+L93: prn L28
+lea L66, *r4
+dec r2
+clr L22
+clr *r7
+red r3
+inc r6
+L94: cmp #-140, *r2
+L95: prn #-207
+prn *r6
+dec *r6
+sub *r6, r3
+L96: add L158, L44
+stop
+L97: jmp L5
+cmp *r5, *r4
+add *r0, L45
+add *r7, r4
+dec L51
+inc *r6
+cmp #-52, #-57
+L98: not *r2
+; comment
+L99: jsr *r4
+L100: bne L38
+stop
+L101: not L57
+prn r7
+bne L288
+prn #183
+sub r0, *r2
+bne *r0
+jsr L216
+; comment
+bne L192
+sub L102, r2
+L102: .data 313, -778, 870, 858, 281
+sub L60, r4
+L103: lea L135, L35
+cmp r7, L98
+L104: inc L149
+prn L230
+; comment
+L105: jsr L3
+mov #-229, *r5
+L106: stop
+L107: stop
+L108: clr L46
+rts
+prn r6
+red *r2
+not L275
+prn r4
+not *r2
+sub r0, *r0
+lea L168, r5
+dec r4
+L109: lea L37, r4
+inc L4
+sub r2, L43
+L110: jmp L135
+stop
+sub *r7, *r6
+clr r0
+L111: inc L70
+add #115, r7
+bne L125
+dec r3
+lea L88, r7
+red *r3
+L112: add *r5, L68
+cmp #8, L85
+not L55
+L113: .string "wnnllhxupxgzthzypomktbhj"
+mov *r3, L58
+L114: .string "jdkdhboaixyntxusgtzupbhc"
+add *r1, *r1
+L115: jsr L42
+sub r2, *r3
+jmp L260
+cmp #209, #73
+L116: .data -950, -678
+bne L264
+jmp L47
+add L296, r2
+not L63
+not r6
+bne *r6
+mov L292, L35
+L117: not L112
+L118: inc L201
+L119: clr r5
+L120: .string "rzdhkxpugbckhxrws"
+stop
+jmp L66
+L121: stop
+inc r3
+bne L249
+stop
+jmp L216
+inc L180
+red *r3
+add r0, L287
+L122: prn #-182
+sub r3, *r3
+bne *r5
+red r4
+dec L283
+L123: lea L168, r3
+red *r0
+rts
+L124: prn r1
+inc L8
+L125: inc *r3
+; comment
+L126: .data -158, 409, 866, 72
+mov *r4, *r6
+red *r0
+stop
+
+mov #-201, r0
+inc L32
+jsr *r1
+sub *r7, r6
+rts
+L127: inc L24
+cmp *r7, r7
+prn #160
+L128: stop
+L129: dec L128
+L130: sub *r5, r6
+; comment
+lea L7, L263
+L131: .string "syho"
+L132: red *r5
+rts
+bne L290
+rts
+clr *r2
+dec *r2
+bne L141
+jsr L69
+L133: clr L246
+not *r6
+L134: .string "kvcwjomddsnjistt"
+red r0
+clr L127
+dec r0
+add *r3, L239
+inc *r3
+L135: sub #174, L6
+lea L195, r3
+L136: jmp L21
+jmp *r5
+prn #107
+L137: mov #-250, r4
+red r2
+rts
+L138: .string "tayqv"
+L139: .string "crfoct"
+cmp *r3, r3
+L140: dec r1
+jsr *r3
+; comment
+inc L217
+red L128
+prn #255
+L141: inc L100
+L142: clr r4
+jmp L33
+L143: .data 375, -516, -704, -2
+cmp r7, L93
+L144: stop
+cmp #61, #76
+not *r1
+dec r4
+L145: .data -94, 979, 939, 484, 612, 116, 916, -476
+prn *r2
+stop
+prn #73
+mov *r6, *r1
+lea L263, r7
+stop
+L146: prn #-2
+jsr *r7
+lea L166, L171
+sub L241, *r1
+cmp L58, *r1
+L147: .string "iys"
+dec L186
+bne L41
+; comment
+L148: jmp *r5
+stop
+L149: stop
+lea L194, *r1
+not r7
+mov r2, *r1
+sub L67, r3
+bne *r0
+lea L68, L267
+jmp L170
+rts
+rts
+clr r4
+L150: .string "jlafdxokeduzpluzb"
+not L193
+
+
+cmp *r1, r4
+clr *r1
+not *r0
+red r3
+
+L151: jsr *r4
+; comment
+L152: .string "muollvsthoobpipe"
+cmp *r1, L49
+clr *r6
+
+L153: .data -270, 185, 228, 567, 38, 602, -288, -919
+L154: add *r4, L225
+bne L145
+add r3, *r3
+add r6, *r6
+stop
+dec r2
+add L22, r1
+L155: sub #-233, *r4
+dec L204
+not L276
+L156: clr L25
+bne L124
+add L126, *r7
+L157: not L81
+not *r6
+L158: .data -410, -687, 764, 679, 951, -602
+stop
+L159: red r0
+L160: stop
+not r6
+cmp #126, r5
+L161: inc L115
+L162: .data 589, -802, 394, -586, 249
+lea L123, r5
+sub r3, L38
+dec *r1
+dec L152
+L163: not *r0
+
+add *r4, *r5
+
+add L191, *r1
+cmp #-200, r2
+L164: rts
+cmp r1, #-11
+mov L29, r1
+clr *r5
+inc L75
+L165: dec *r0
+L166: not *r0
+L167: inc L149
+add L265, L190
+clr *r7
+clr *r6
+L168: bne *r2
+L169: .string "xqitncjwfiesemg"
+jsr *r2
+rts
+sub L175, L154
+rts
+L170: .data -998, 971, -782, 435
+clr *r6
+add #-127, *r4
+sub #-40, L75
+prn r1
+lea L173, r3
+bne *r7
+cmp r4, #66
+red *r6
+L171: clr r7
+jmp *r1
+sub *r0, L281
+L172: .string "uoswiknrnipax"
+add r5, r4
+clr *r5
+inc *r4
+lea L93, *r7
+L173: mov L71, *r0
+mov L134, L267
+lea L197, *r1
+L174: add L177, *r6
+L175: .data 394, -706, -403, 144, -452, 947, 928, -223
+L176: bne *r0
+L177: jmp L34
+L178: lea L218, *r3
+L179: red *r4
+mov *r4, L78
+L180: .string "kzmfreprdujwxaxgcpiaxua"
+L181: .string "rgqpfgkogz"
+clr r4
+L182: red r2
+cmp L199, #-230
+mov L168, r2
+mov *r3, *r0
+L183: jsr *r7
+lea L207, r0
+sub #-122, *r3
+L184: dec *r5
+add r6, *r6
+L185: jsr *r0
+L186: lea L135, *r1
+L187: dec r1
+L188: sub *r4, *r4
+cmp L263, L56
+prn #129
+red r0
+L189: jsr *r0
+L190: .data 530
+sub *r5, r5
+lea L106, *r7
+cmp #-180, r5
+
+L191: .data -634, -1, -646, 598, -650
+L192: .data -432, -442, 248, 499, 195, -46
+not r5
+prn r2
+L193: .string "pi"
+not *r7
+sub r0, *r2
+prn L269
+clr *r4
+jmp L134
+
+L194: .data -376, 462
+L195: not L232
+rts
+L196: prn L111
+; comment
+L197: clr L76
+not *r5
+stop
+L198: .string "jhjfcqfmlgrgtlfyvzl"
+L199: .data 643, 694
+red *r6
+add #79, *r1
+L200: .data 619, 748, 667, 310, -322, -435, 576
+L201: jmp L170
+L202: .data 752, 368
+rts
+L203: .data -235, -22, 704
+L204: cmp r2, *r0
+rts
+L205: .string "yrwosqnjzljxplzjwycjcd"
+L206: prn *r0
+sub r1, L245
+red L165
+jsr *r5
+
+stop
+jsr L34
+mov L115, L92
+rts
+; comment
+dec r7
+prn r2
+clr *r2
+jsr *r4
+rts
+clr L249
+not r7
+inc r3
+red *r0
+jmp L250
+cmp r0, #26
+L207: jsr *r6
+dec *r0
+jmp L265
+dec r3
+cmp r5, *r1
+L208: add L269, r1
+lea L40, L228
+L209: .string "ewpr"
+cmp #160, L122
+add L283, *r3
+L210: jmp L57
+L211: .data 16, -101, 359, -123, 778, 833, 959
+L212: .string "gvnfcnge"
+L213: jsr L39
+prn *r1
+prn *r6
+mov *r6, r2
+L214: .data -867, 739, -599, 146
+L215: .string "kzsopipnmcffre"
+red L218
+prn *r7
+jmp L291
+red L172
+mov L94, *r5
+
+inc r6
+prn #46
+L216: jmp *r5
+dec r2
+jmp L57
+sub *r3, r4
+cmp L263, *r5
+rts
+L217: .data -754, 923, -831, -608, -180
+not *r2
+red *r4
+dec L266
+lea L155, L278
+bne L274
+inc *r6
+clr r7
+L218: .string "jcqnptokemlpzegteob"
+lea L289, r3
+L219: inc L214
+dec r3
+inc r6
+; comment
+jmp *r0
+mov *r4, *r5
+mov r0, r7
+add L2, r5
+stop
+L220: mov #-66, *r3
+cmp r6, r0
+dec *r7
+L221: cmp *r0, r1
+not r0
+stop
+L222: jmp *r6
+cmp #-143, r5
+clr r6
+L223: .data -500
+L224: stop
+L225: mov #-21, r3
+prn r2
+cmp #-150, *r4
+jsr *r3
+rts
+jmp L239
+L226: clr L265
+add r6, L253
+inc *r6
+stop
+
+dec L155
+add *r5, r3
+L227: jsr L274
+L228: prn r7
+L229: add #-193, L213
+jsr L174
+sub *r7, *r4
+rts
+bne *r1
+stop
+sub *r6, L233
+sub L164, L151
+bne *r0
+mov r2, L64
+L230: rts
+not *r1
+L231: rts
+dec *r4
+L232: clr r1
+clr L230
+mov *r6, *r1
+L233: add #11, *r5
+bne *r6
+red L202
+L234: .data 912
+L235: .data -108, -904, -232, 311, -160, -879, -222, 9
+L236: .string "cqhyedljliujgeqeassanp"
+jsr *r1
+L237: dec L17
+cmp L231, *r3
+L238: stop
+L239: .string "oukyrwrohnewecy"
+inc L186
+rts
+sub L171, L288
+bne L278
+rts
+prn L81
+L240: not r3
+red *r3
+lea L131, *r7
+cmp #186, #20
+sub *r4, *r1
+L241: jmp L76
+sub L273, *r3
+L242: .string "lepmixmsj"
+L243: clr L68
+not r7
+bne *r3
+dec L131
+inc *r2
+not L160
+L244: inc L249
+not r0
+clr *r0
+L245: .string "aiequrxut"
+rts
+L246: .data -555, -477, 478
+stop
+bne *r5
+inc *r5
+rts
+L247: red *r5
+L248: lea L121, L110
+cmp r3, r6
+inc r2
+stop
+jmp *r0
+jmp *r1
+; comment
+lea L262, L74
+add *r0, L296
+L249: add *r2, *r1
+rts
+L250: lea L293, L272
+L251: not *r6
+inc r3
+sub *r1, *r6
+inc *r7
+sub r2, L111
+mov *r6, *r2
+L252: stop
+add #-79, L135
+add L196, L17
+clr *r2
+jsr L33
+jsr *r5
+add #207, *r5
+sub L265, L206
+L253: prn r1
+rts
+jsr *r4
+jmp L279
+jsr *r5
+L254: .data -501, 42, 136, 718
+bne *r2
+L255: .string "uldtwbosunzsyfejiwafntya"
+stop
+not *r5
+bne L135
+jsr L199
+sub #203, r7
+; comment
+jmp *r4
+stop
+add #107, *r4
+L256: not *r1
+L257: jsr *r5
+; comment
+inc *r3
+sub *r5, r6
+L258: cmp *r4, #-105
+L259: .string "kwjhmfmpseekje"
+mov L289, *r7
+L260: dec *r0
+red *r1
+L261: cmp *r6, r2
+L262: rts
+mov #145, r7
+dec r3
+sub r6, L281
+red r5
+prn *r5
+jsr L283
+prn L264
+stop
+add *r5, L176
+L263: .string "nikld"
+jmp *r4
+dec L295
+red *r3
+jsr L265
+L264: jmp L62
+; comment
+dec *r3
+clr r6
+rts
+add #71, L281
+rts
+not r3
+prn *r5
+sub #95, *r2
+rts
+; comment
+stop
+inc r6
+add *r5, L292
+jsr L276
+rts
+not L296
+mov r7, *r5
+L265: jmp *r4
+L266: jmp L165
+clr *r6
+bne *r5
+prn *r6
+jmp *r4
+L267: .string "zgafafvkmdrpggmt"
+clr *r2
+clr L269
+sub r3, r5
+; comment
+clr r0
+clr *r5
+L268: inc L288
+L269: bne L197
+inc L284
+L270: jmp L30
+clr L291
+bne *r5
+sub *r6, *r3
+sub #133, r1
+L271: .data -557, 944, 698, 553, 376, 623, 492, -980
+stop
+L272: cmp L32, #247
+L273: dec *r2
+L274: mov #-28, L297
+prn L288
+L275: bne L249
+stop
+L276: stop
+jmp *r5
+jmp *r7
+rts
+L277: .string "urokntakhxzvkcowyvzytr"
+clr r0
+clr r7
+L278: .string "yghggqqvyhvdldfusrddllue"
+mov #-27, r2
+L279: prn r7
+jmp L284
+inc r4
+; comment
+jsr L295
+jmp *r2
+L280: dec L296
+L281: add *r4, L26
+
+bne *r1
+add #26, *r3
+L282: not L188
+; comment
+red r1
+sub *r0, *r5
+L283: .string "lrwkerjgygixmsm"
+L284: inc L18
+L285: stop
+add L283, *r6
+L286: stop
+jsr *r4
+
+L287: .string "whywceesjiklldttc"
+cmp r5, r5
+jsr *r6
+L288: not *r2
+inc *r4
+stop
+inc *r6
+clr L37
+clr *r3
+L289: sub r1, L295
+red r4
+lea L149, *r1
+cmp r3, *r0
+add r1, *r0
+stop
+sub r1, *r2
+red L290
+lea L50, L93
+L290: .data 462, -993, -267, 668, 646, -549
+cmp *r4, *r2
+L291: .data 263, -57, -450
+
+L292: .string "d"
+L293: prn *r7
+bne *r1
+stop
+L294: .string "npohatupkqils"
+rts
+add *r4, L132
+L295: .string "vedtxilrndagzg"
+mov #-134, r1
+jsr L221
+; comment
+prn L261
+bne *r2
+; comment
+cmp r1, *r7
+L296: jsr *r2
+bne L297
+jmp *r0
+L297: .string "vlvzvnltaajuufclukmbeb"
+stop
@@ -0,0 +1,1020 @@
+; Generated by genCorpus --seed 54
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+jsr L83
+clr L227
+prn L259
+L0: mov r4, *r5
+lea L260, *r7
+add #141, L0
+L1: .data -225, -698, -730, -771, 932, 219
+L2: .string "cbsrvrcrakzxsxfnxiuhsmf"
+L3: .string "rlkxavjjbxagzlkyqijxbx"
+L4: prn *r7
+sub L2, *r4
+jsr *r2
+L5: bne *r4
+L6: prn r0
+L7: add r5, L18
+sub L103, r3
+mov r3, *r7
+
+L8: .data 905
+stop
+L9: lea L7, L176
+L10: prn L6
+inc *r6
+stop
+L11: .string "cmelrlbhtnippvyzy"
+cmp #-203, *r0
+bne L15
+L12: .data -137, 183, 209, -43, -969, -491, 42
+sub #-96, L3
+L13: dec r7
+add r0, L127
+bne *r4
+L14: .string "nlrnrecuzbeqiezsqbdxjour"
+sub #-205, *r6
+bne L104
+L15: prn #-1
+
+mov *r4, r5
+L16: .data -352, 495, -218, 872, -351, -473
+L17: .string "rpuuffzhzhko"
+stop
+dec r1
+prn *r4
+prn r1
+rts
+L18: lea L29, *r2
+red L172
+L19: jmp *r6
+not r5
+L20: prn L7
+L21: .data -789, 47, -899, -599, -19, -460
+stop
+not *r1
+dec r2
+stop
+jsr *r2
+jmp L9
+not L150
+inc r3
+prn L104
+add r1, r0
+L22: .string "jbjcsijsdyobhlowkrsibwf"
+red L189
+rts
+not r6
+add *r3, *r6
+
+bne L7
+bne L2
+not r2
+sub #-133, *r5
+lea L25, *r1
+stop
+mov *r6, r3
+L23: lea L35, L13
+clr *r5
+clr *r5
+bne *r7
+bne *r0
+stop
+L24: cmp L101, #11
+L25: add *r2, r1
+lea L24, L10
+prn #166
+rts
+jsr L247
+L26: red r7
+bne L170
+
+L27: .data -876, 114, -331, -365, -641, -91
+L28: rts
+prn r5
+add #111, *r3
+L29: .data 707, 582, -377, -616, -75, 139, -250
+L30: rts
+prn #-58
+dec L15
+L31: sub L178, *r2
+rts
+stop
+mov #-11, r6
+L32: .string "tviqgvzrkfyfgiuooos"
+L33: .data 482, 744, 97, -579, -966, -967, 613
+L34: prn *r2
+jmp *r2
+L35: .string "atjuzptg"
+not r6
+clr L28
+jsr L13
+jsr *r0
+cmp *r2, L183
+mov L34, L187
+L36: cmp *r3, L158
+lea L144, r0
+not L265
+L37: jmp *r5
+inc *r3
+inc r0
+not r6
+L38: red r6
+L39: stop
+red r1
+dec *r3
+add #-133, *r4
+L40: prn #233
+rts
+stop
+L41: .data 532, -92
+prn #25
+jmp L8
+add *r5, *r3
+L42: add #-27, *r6
+
+rts
+rts
+L43: .data -12, 719, -474
+bne L119
+inc r3
+bne *r3
+jmp *r4
+jmp *r3
+L44: red r4
+jmp *r2
+mov *r1, *r2
+rts
+prn r6
+; comment
+L45: add L25, *r6
+add L10, r4
+inc L216
+L46: .string "bnzyyruwzoswdjgaqyuiqd"
+L47: .data -342, 87, 515, -785, 985
+L48: .string "eqklkp"
+L49: clr r6
+not L197
+L50: .string "tlfdqaoxuyawgkubqbmylzqh"
+L51: red *r1
+cmp *r6, r3
+jsr *r1
+dec L28
+bne *r2
+L52: .string "psghqzpbbfljmnybeb"
+not r7
+mov L37, L34
+stop
+inc r1
+jsr L194
+L53: clr *r7
+L54: .data 911, -725, 31, -630, -707
+mov L52, L27
+L55: prn L155
+cmp L83, r4
+not r7
+inc *r3
+L56: .data -225
+bne L49
+L57: mov #238, *r1
+L58: lea L257, r4
+lea L65, *r5
+red L276
+L59: .data 382, -789, -674, 327, -618
+jmp L115
+L60: jmp L242
+L61: clr *r3
+bne *r0
+; comment
+bne L245
+L62: mov L62, L9
+bne L270
+bne L188
+bne L10
+dec *r5
+L63: .data 661, 198, -747, 381, -956, -444
+; comment
+jsr *r4
+L64: prn r0
+bne *r4
+L65: clr L15
+clr *r7
+stop
+clr L238
+inc r7
+dec *r4
+red r4
+L66: dec *r6
+sub r6, *r3
+; comment
+L67: clr r4
+add r0, *r5
+L68: .data -96, 748, 700, 520, 347, 663, 870, -377
+inc L72
+add #111, *r4
+add r5, r6
+L69: .data 569, 441, 11, -819, -868, 265, -824, 672
+add L276, r7
+L70: .data -562, -525, -349
+L71: mov r5, *r2
+lea L248, L235
+dec r0
+clr L42
+prn r2
+dec r5
+L72: .data -627, 913, 264, -642, -132, -840, -277, -201
+not L99
+L73: lea L71, L233
+not *r5
+sub #119, *r0
+lea L162, L0
+dec L257
+L74: stop
+mov r4, L205
+; comment
+L75: sub *r6, L77
+rts
+
+L76: prn *r0
+prn L190
+L77: dec r5
+rts
+L78: cmp *r7, r7
+mov *r7, r5
+stop
+cmp #-191, #-247
+stop
+L79: .data -335, -159
+L80: .data -413, 876, -967, 164, -631, -981, -688
+L81: inc r1
+L82: cmp *r0, r5
+red r6
+sub #32, L241
+cmp r1, r5
+bne *r1
+; comment
+L83: .data 991, -372, -299, 17, 767
+bne L244
+L84: .data 535, -391, 597, -270, 780, -225, 853
+prn L220
+inc r5
+bne *r3
+L85: .string "loslojzayqd"
+jsr *r0
+lea L32, *r1
+sub #-94, *r1
+rts
+sub r7, *r7
+L86: .string "eacriillbhhsyoznaebhz"
+inc L53
+L87: cmp #-143, r2
+; comment
+; comment
+dec *r6
+jmp *r0
+L88: lea L43, L174
+jmp L79
+red L20
+L89: red L195
+lea L245, L266
+lea L215, r0
+prn #157
+L90: .data -235, 379, -948, 597, 506
+bne L21
+L91: prn #4
+jsr L224
+cmp #-78, #-192
+not L266
+bne L15
+dec L239
+L92: dec L73
+L93: .string "zmljytutyrpteytinp"
+L94: .data -345, 635, 823, 368, 727, 625
+inc L160
+prn *r0
+rts
+mov *r7, *r6
+L95: rts
+; comment
+L96: .data 344, 609
+cmp r6, r4
+jmp *r1
+sub r1, *r2
+jsr *r1
+L97: .string "gzjzqsdozwkkroo"
+lea L25, L24
+L98: .data 729, 659, -77, -116
+L99: not r3
+rts
+cmp *r2, L5
+bne *r7
+mov L38, L263
+inc L152
+L100: prn #-80
+dec *r3
+jmp L17
+lea L77, r2
+L101: inc *r3
+L102: .data -991, -342, -8
+L103: .string "ogoqde"
+L104: add #-34, r1
+red r3
+jmp L239
+jsr *r5
+L105: sub #-92, r0
+rts
+sub L138, L54
+jmp L46
+red r5
+L106: dec r6
+L107: .data -783
+bne *r1
+add *r5, r2
+dec *r7
+rts
+stop
+sub #-7, L12
+bne *r2
+sub L140, L26
+L108: lea L257, L85
+prn L165
+stop
+add L33, *r2
+rts
+mov *r5, *r5
+jsr *r0
+prn r2
+bne *r0
+clr r1
+sub #166, *r3
+jsr L83
+sub L259, *r0
+L109: jmp *r5
+bne L162
+prn #-65
+sub *r2, *r4
+lea L205, *r6
+bne L20
+mov #-167, L242
+red r2
+L110: lea L84, L237
+mov r3, *r5
+add *r2, *r3
+rts
+add *r0, L238
+jmp *r2
+cmp #145, #209
+prn r3
+jmp *r6
+L111: red L266
+lea L41, r5
+lea L203, L100
+stop
+sub r3, r5
+jmp *r2
+L112: stop
+rts
+rts
+; comment
+clr r5
+add *r5, *r3
+L113: jmp *r7
+sub #-180, L237
+mov r2, L162
+red r7
+L114: .string "dytznfqp"
+; comment
+jsr *r6
+red r0
+L115: add #84, r1
+sub #84, r4
+L116: inc L222
+sub r5, L164
+red *r4
+mov r3, L91
+dec L178
+not L18
+L117: bne *r1
+inc r3
+jmp *r3
+stop
+sub *r7, L236
+L118: .string "uphgifxakcjmcm"
+clr *r0
+stop
+red r4
+L119: .string "hagcsojmrkewammi"
+L120: .string "lrrzcedwzw"
+prn *r6
+clr *r1
+not r4
+dec r2
+sub L204, r4
+inc *r2
+dec L233
+red *r7
+sub #-114, L148
+L121: sub L31, r3
+; comment
+prn L217
+cmp r3, L59
+mov L158, r0
+red L144
+L122: inc *r3
+bne L188
+jsr *r7
+bne *r2
+L123: lea L71, L122
+cmp r2, *r7
+L124: red *r7
+inc *r6
+sub r0, *r3
+L125: not *r2
+add #224, L240
+mov #-4, *r5
+dec r1
+L126: mov #91, L153
+prn r3
+not *r6
+L127: bne *r2
+dec *r0
+inc *r2
+add *r4, L17
+L128: inc *r3
+clr L70
+L129: .string "enwtlenqajqxcssufg"
+inc L254
+L130: rts
+; comment
+jsr *r4
+L131: jmp *r0
+cmp *r3, r7
+L132: lea L2, L252
+clr r0
+; comment
+red r3
+sub L74, r0
+lea L62, *r0
+
+lea L69, r7
+rts
+L133: dec r0
+inc *r5
+inc L66
+; comment
+L134: stop
+
+stop
+L135: jmp L126
+jmp L227
+L136: rts
+inc r6
+L137: lea L200, L257
+not *r1
+not r4
+jsr L190
+L138: .data 520, -548, -449, -824
+prn L229
+clr *r3
+clr L58
+jmp L118
+L139: .string "bwiezfxaiwuiuebmk"
+; comment
+L140: .data -251, 937, -613, 884, -151, -711, 105
+mov r0, L237
+jsr L95
+L141: red r2
+L142: .data 883, 559
+L143: .data 277, -463
+L144: .string "xprnrbjkogkbjxcybmnueyrr"
+lea L32, L174
+jmp *r6
+red L54
+stop
+L145: clr *r4
+dec *r0
+not r6
+jsr *r0
+L146: .string "quuujoacumbetcsnfgxxeyk"
+mov L49, *r2
+not L194
+jsr L141
+bne *r2
+; comment
+L147: not r1
+bne *r2
+jmp L186
+add *r0, L260
+inc L108
+prn *r6
+L148: stop
+L149: .string "pevjkbmbnrjvhspvg"
+L150: cmp #117, *r3
+clr r7
+L151: jsr L109
+sub L31, *r4
+L152: dec r4
+L153: red *r3
+bne *r0
+L154: .string "ivtemtwmlvrh"
+clr *r3
+clr L251
+L155: lea L265, L61
+add r1, L211
+stop
+L156: rts
+L157: jsr L125
+jsr L208
+L158: .string "mfdqsrhhmmfppenlseqmak"
+L159: red *r0
+prn L217
+clr r5
+inc r2
+clr r4
+rts
+jmp *r6
+sub *r7, L152
+L160: jsr L186
+
+bne *r6
+L161: .string "dobo"
+
+clr r7
+; comment
+dec L66
+add L41, *r4
+
+rts
+stop
+stop
+L162: .data 736
+bne *r7
+rts
+red L156
+inc L153
+mov #74, L251
+L163: clr *r0
+L164: red *r7
+lea L141, r4
+mov *r0, L192
+prn r7
+L165: .string "fclzhu"
+stop
+clr r0
+inc *r7
+cmp r4, *r1
+rts
+L166: .data -531, -359, -509, -651, -192, 510
+cmp r3, #162
+dec r6
+dec L212
+sub #-25, r5
+inc r0
+L167: clr L68
+L168: .string "bhln"
+jsr *r3
+not *r3
+bne L252
+cmp r2, *r5
+jsr *r7
+clr *r1
+jsr L83
+mov L109, *r5
+not *r3
+inc *r0
+mov #62, L28
+inc r1
+not L256
+dec L217
+L169: .string "ieljphv"
+cmp L262, #65
+stop
+L170: .string "dj"
+lea L201, L47
+red *r4
+cmp *r0, #-32
+mov *r3, L20
+L171: .string "bunybdhuvkvamtbkrnhjp"
+L172: bne *r1
+mov L221, r3
+jsr *r1
+dec r3
+L173: not L263
+L174: .data 581, 164
+bne L217
+L175: add L215, *r2
+; comment
+dec L264
+
+stop
+add *r5, *r3
+inc r7
+prn *r1
+sub *r6, L15
+L176: not *r3
+
+prn L2
+L177: jsr *r3
+clr L162
+prn #-110
+add *r7, r2
+add r6, L103
+jmp L164
+sub #172, r4
+inc L23
+prn L119
+inc r5
+L178: jmp L190
+sub *r2, L159
+cmp #-10, #167
+L179: .string "mpgmeverecqbtyoofxc"
+cmp L108, r1
+mov #79, r5
+L180: rts
+inc r5
+rts
+jsr *r0
+inc r4
+mov #-114, L230
+prn L196
+lea L65, L11
+add #246, *r5
+dec L255
+L181: red r6
+prn L161
+add r3, r1
+stop
+L182: stop
+L183: jmp *r7
+prn #89
+L184: .data -869
+clr r5
+inc L119
+stop
+lea L190, *r6
+L185: .string "oufs"
+L186: not *r2
+L187: .string "tauqlyvberuxlcplotfh"
+jmp *r0
+L188: sub *r2, L189
+L189: red L239
+dec L141
+L190: .data -903, -255, 14, -647, -712, 453
+not r3
+red r3
+not r2
+cmp L226, r1
+; comment
+lea L27, L120
+L191: bne *r0
+L192: clr L123
+jmp L163
+add *r5, L184
+L193: inc L74
+; comment
+add *r3, *r2
+prn L136
+add r3, *r7
+clr *r5
+not r1
+red r5
+mov #-45, L237
+
+prn L242
+; comment
+sub #207, r5
+bne L58
+red *r0
+add L104, L269
+lea L224, *r7
+L194: red r7
+inc r0
+clr L189
+stop
+inc *r0
+jsr *r5
+bne *r3
+add *r0, *r6
+cmp #15, *r3
+L195: mov *r7, *r1
+not r2
+jmp L23
+L196: .string "pycobtgvxymwzugazfknqrk"
+jsr L249
+jsr L177
+jmp L273
+L197: not r4
+L198: .data 673, -200, -903, 21, -626, 991
+add #-252, r0
+add L0, L62
+L199: .data 110, 271, -924, -481, 888, -710, -130
+L200: .string "wruactdusnfstgnfdctirl"
+prn L162
+L201: sub r5, L60
+red r0
+red L253
+L202: .data 17, -130, -373, -762
+jmp *r6
+jsr L135
+L203: lea L250, *r6
+not r5
+clr *r7
+clr L40
+jmp *r5
+lea L229, *r1
+inc L275
+mov *r0, L267
+L204: stop
+stop
+add r5, r6
+jmp L233
+mov #-93, L60
+jmp L176
+prn r2
+; comment
+jsr L108
+mov *r4, r0
+clr r0
+sub *r0, r3
+bne *r6
+jmp L207
+cmp r3, r3
+clr r4
+prn r7
+prn #-182
+dec *r1
+clr *r1
+L205: .string "z"
+not r2
+L206: cmp #123, r4
+red *r3
+inc L239
+dec r5
+add #111, r2
+prn *r3
+lea L266, r0
+add L178, L212
+sub *r4, *r2
+
+bne *r0
+L207: clr r4
+clr *r5
+stop
+L208: jmp *r3
+L209: red r5
+L210: .string "bigymsnree"
+L211: stop
+; comment
+jsr *r5
+lea L15, *r7
+rts
+inc *r7
+add #32, r3
+add r6, r2
+prn L93
+; comment
+clr *r7
+L212: jmp *r2
+sub #-248, L136
+L213: mov r1, *r1
+L214: bne *r0
+rts
+L215: rts
+L216: rts
+lea L218, r7
+L217: .data -46, -142, 504
+L218: .data 358, 126
+inc L203
+L219: mov *r3, *r6
+clr L263
+inc L0
+; comment
+L220: add *r7, *r1
+L221: .data 21, -274, -325, 5, 96, 984
+L222: mov r7, *r2
+L223: cmp L227, #6
+dec *r2
+stop
+L224: mov #-96, r3
+
+L225: .string "udxrlugzengmf"
+dec r5
+rts
+L226: cmp r7, L124
+not r0
+inc r7
+cmp L232, *r4
+; comment
+clr L98
+L227: .string "iyemqfdkvacedxwpn"
+bne *r3
+L228: sub r2, *r3
+jsr *r4
+jmp *r6
+jsr L238
+sub *r4, r5
+inc r3
+L229: add *r7, *r0
+jsr L16
+stop
+red L258
+red L173
+clr r7
+lea L181, L101
+dec r5
+add *r5, r7
+jmp *r1
+jmp *r7
+jsr *r6
+L230: inc r7
+inc *r7
+mov r5, *r2
+stop
+inc *r5
+sub L237, L148
+L231: not L66
+prn r0
+sub L275, *r1
+L232: prn *r6
+prn #-20
+sub *r7, r0
+L233: dec *r4
+rts
+inc *r2
+L234: jsr L119
+rts
+cmp r6, L45
+mov r1, r6
+not *r1
+L235: cmp L251, L271
+jmp L152
+jmp L239
+dec *r7
+cmp L275, r7
+add *r7, *r4
+sub #86, L46
+jsr L84
+L236: red r4
+inc *r7
+L237: cmp r3, *r4
+L238: .string "zilxfccbxekfoqnthbeosowh"
+L239: .string "hdguqrovcffnxxlkohuhrs"
+L240: jmp L65
+lea L144, r1
+mov #201, r4
+not *r3
+sub #-5, *r2
+L241: .string "yxlwrbwiwxcx"
+sub #23, L146
+jsr *r7
+sub *r0, L260
+rts
+sub *r0, L252
+; comment
+L242: prn r7
+L243: rts
+jmp *r0
+stop
+; comment
+sub r2, *r3
+stop
+L244: jsr *r5
+red *r1
+add *r5, r6
+mov *r3, L273
+L245: red r6
+clr *r1
+clr L276
+inc L157
+L246: lea L249, L259
+L247: .data 513
+L248: .string "njdfk"
+cmp L204, #36
+L249: .data -904, 449
+rts
+L250: cmp #107, r1
+not L205
+cmp #66, *r7
+mov #-184, L20
+red *r1
+jsr *r5
+not *r7
+lea L67, r7
+L251: cmp L263, #17
+clr *r0
+red r6
+add *r7, *r7
+L252: sub L244, r2
+sub #134, r5
+dec L266
+lea L21, r7
+lea L112, *r0
+L253: jsr L93
+jsr L257
+L254: lea L266, *r2
+L255: .string "rsgatemutkzekaiwjqdrbmq"
+L256: prn r6
+L257: .data 264
+not L144
+sub *r1, r6
+jsr *r6
+L258: jmp *r5
+bne *r2
+rts
+L259: sub L187, r6
+mov #158, r5
+dec L215
+L260: not L275
+lea L37, *r0
+L261: sub #-83, L264
+prn r0
+sub *r5, *r5
+L262: add L30, r4
+prn *r2
+not r5
+add *r4, *r6
+add L189, r5
+red *r1
+L263: sub r0, r6
+not r0
+cmp L3, #103
+; comment
+bne L50
+bne *r7
+rts
+L264: stop
+L265: red L275
+inc L25
+L266: dec r4
+clr L169
+not r4
+cmp r6, *r2
+add #80, *r7
+lea L270, L235
+rts
+bne *r2
+clr L150
+cmp r0, #42
+stop
+prn L273
+L267: prn #-169
+sub *r1, r2
+mov *r5, r2
+jsr *r1
+stop
+sub L258, *r5
+inc L274
+L268: .string "s"
+inc r5
+stop
+L269: sub *r6, L142
+lea L155, L67
+bne L113
+jsr *r2
+mov L271, r7
+red L274
+sub *r4, *r7
+L270: rts
+stop
+dec L272
+lea L80, L276
+lea L275, L154
+L271: add #82, L273
+inc r2
+lea L272, *r0
+add L109, L273
+bne L91
+red r5
+add *r0, L272
+rts
+L272: .data -671, 241, 109, -545, -887, -207, -721, 979
+prn L274
+not L273
+L273: .string "bnjgwcganqxnwoybkjuqhy"
+sub L14, L275
+
+L274: .data 790, 169, -139
+L275: .string "fxzqezz"
+L276: dec r4
+jsr L180
+jmp *r6
+stop
+rts
+stop
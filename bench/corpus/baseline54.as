@@ -0,0 +1,1020 @@
+; Generated by genCorpus --seed 55
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+L0: cmp #-166, #104
+jmp *r6
+cmp L0, r2
+L1: cmp r0, *r3
+; comment
+L2: lea L2, *r3
+bne L280
+sub #62, *r3
+L3: dec *r5
+L4: inc r7
+not *r6
+L5: inc L1
+stop
+L6: .data 259, -110, -64, -413
+mov #145, L5
+cmp *r5, r1
+L7: .string "vuxucynnbjbpch"
+L8: prn #-63
+L9: bne *r2
+dec *r2
+inc r6
+inc L7
+L10: .data -160, 372
+L11: jmp L2
+cmp #181, *r5
+inc L25
+L12: cmp L7, #-59
+bne *r0
+L13: add *r1, L80
+lea L38, L1
+mov *r6, L6
+L14: jmp L43
+sub #221, r0
+jmp L8
+L15: .data -88, -893, -93, -103, 820, -622, -215
+rts
+
+inc r4
+L16: .data -509, 967, 149, -610, -816, -970
+add *r0, L11
+L17: bne L16
+L18: cmp r6, r0
+stop
+cmp L3, *r2
+L19: .string "xiaqqqdc"
+dec L176
+prn r5
+bne *r2
+lea L119, r4
+jsr *r5
+bne L12
+add L225, L181
+stop
+L20: cmp *r1, *r5
+L21: .string "thujnavwmqaglvr"
+lea L107, L83
+prn *r2
+add r2, r7
+rts
+bne L13
+L22: sub r0, r5
+sub #185, L59
+mov r1, *r1
+mov *r2, L1
+L23: bne L101
+L24: .string "vchunolaqznp"
+L25: sub r3, *r1
+L26: bne L2
+jsr *r2
+rts
+L27: inc *r2
+sub *r6, r5
+dec L6
+mov r5, *r4
+stop
+inc *r1
+L28: prn *r1
+L29: .string "hmeraqqdgewukit"
+add *r6, L21
+mov r5, L22
+L30: red r3
+L31: .string "wkmjvzhidg"
+L32: prn *r4
+add r7, L12
+jmp L93
+jsr *r4
+L33: not *r7
+rts
+jmp L13
+lea L190, L271
+mov *r0, r1
+jsr *r7
+L34: .data -24, -12, -463, -127, -569, -832, 810
+rts
+sub #-4, L27
+sub L79, *r4
+L35: .data -952, 902
+mov *r3, r6
+clr r2
+add #-102, L222
+stop
+clr L8
+; comment
+
+dec *r5
+L36: inc r6
+prn *r6
+rts
+cmp L249, *r3
+; comment
+L37: cmp #-38, r4
+red *r7
+add *r2, *r5
+red L14
+L38: .data -569, 600, -351, 48, 126, -597, 957, 274
+rts
+jsr L217
+mov r1, r4
+add r6, L72
+; comment
+L39: cmp *r1, r7
+sub r5, L14
+L40: stop
+jsr L74
+; comment
+bne *r7
+L41: cmp *r2, L198
+L42: .data 866, 932, -300, 128, -265, 520
+jsr L31
+red *r2
+L43: cmp #114, *r0
+L44: not r2
+jsr *r7
+prn *r4
+L45: .data -74, 520, -935
+L46: .data 728, 735, -262, 574, -805, 685
+inc *r2
+red *r0
+prn r6
+L47: lea L243, L249
+not *r6
+dec r1
+inc *r0
+prn L178
+L48: .string "mnagcoxuburdamka"
+dec *r5
+; comment
+L49: .string "rqiyatxdoawrxdtsigampf"
+inc L95
+red *r3
+red r7
+jsr L75
+inc L42
+cmp r1, r0
+L50: jsr L136
+jsr *r2
+L51: rts
+lea L176, *r4
+jsr L51
+L52: lea L43, L109
+L53: .string "xcovjsdtllpz"
+jmp *r6
+L54: .data 69, -257, -767, -634
+red r3
+
+L55: .data -481, -422, 127, 401, -81, -277, -3
+prn r7
+cmp #117, *r5
+L56: .string "riauavddhxiag"
+red *r1
+lea L163, L55
+stop
+stop
+rts
+jmp L17
+stop
+lea L29, L8
+L57: add *r5, *r1
+L58: dec L17
+L59: .string "jigtj"
+sub r1, L202
+L60: jmp L45
+L61: .string "ojytwdhv"
+cmp *r6, L13
+L62: rts
+L63: .string "l"
+mov r4, *r1
+not L271
+
+clr r4
+
+cmp *r1, L168
+mov #-199, L26
+L64: clr L175
+dec L10
+
+L65: dec r5
+dec r2
+L66: lea L96, L61
+clr r3
+jmp *r3
+red *r0
+cmp *r5, L245
+L67: .data 416, 951, -176, 317, -44, -370, -981, 814
+stop
+L68: .data 677
+dec *r3
+L69: dec r5
+dec L10
+red r6
+red *r7
+rts
+not L122
+L70: jmp L14
+clr *r7
+red *r1
+lea L55, r0
+stop
+add *r5, *r5
+stop
+clr r4
+clr L44
+jmp *r5
+L71: .string "ims"
+mov L20, L71
+L72: rts
+L73: inc L94
+prn #205
+bne L3
+cmp L18, r5
+cmp L14, L192
+bne *r1
+L74: .string "gnoyraclrbailnxdw"
+L75: sub L61, L79
+red L27
+sub *r2, r2
+prn *r3
+add r4, *r1
+add *r0, r2
+L76: dec L132
+dec L73
+L77: .data 463, -176, -446, -149, 932, -766, -111, -613
+lea L123, r6
+rts
+dec L158
+prn L134
+sub r2, *r7
+lea L164, *r7
+add #16, L135
+
+rts
+jmp *r7
+jmp L137
+L78: red L47
+clr *r4
+jsr L249
+bne L228
+jmp L234
+clr *r5
+L79: dec r4
+
+L80: stop
+dec r4
+dec L210
+cmp L37, r5
+clr *r2
+L81: lea L21, *r6
+jsr L49
+L82: dec *r1
+L83: jsr *r5
+L84: clr L59
+dec L1
+cmp L61, #-144
+mov r6, L182
+add r7, *r0
+L85: lea L158, L168
+jsr L264
+inc r6
+sub #-175, L39
+rts
+L86: .string "wpulclazpa"
+red L135
+L87: prn L32
+prn L185
+mov *r1, L19
+L88: bne L106
+add L139, r4
+red r6
+L89: .string "hgxnelofdo"
+L90: red *r4
+not r5
+L91: not r3
+L92: bne L80
+red L35
+cmp *r7, L81
+clr L124
+rts
+inc *r2
+stop
+dec *r5
+jmp *r0
+L93: cmp r5, L275
+lea L5, L270
+sub r7, r0
+; comment
+rts
+bne *r7
+L94: red r2
+L95: jsr *r0
+L96: cmp *r3, *r7
+clr *r2
+stop
+L97: .data 446
+inc r3
+bne L78
+sub #-179, *r2
+inc r2
+rts
+L98: jsr *r4
+add *r5, r3
+bne *r0
+L99: jmp L96
+clr *r1
+inc *r6
+L100: red r3
+cmp #154, #-12
+L101: .data -615
+inc r4
+L102: inc *r6
+mov r5, *r7
+bne *r0
+jmp *r1
+dec r5
+rts
+stop
+cmp *r6, *r5
+L103: .data -892, -467, 196
+inc r1
+add #-88, r7
+rts
+inc L131
+mov *r0, *r1
+L104: bne L133
+rts
+L105: lea L57, *r2
+L106: not *r4
+L107: jsr *r4
+L108: red r4
+add r0, *r0
+inc *r1
+jsr L163
+L109: mov #-216, r3
+L110: .data 825, -696
+clr r0
+
+L111: .data 127, -50, -997, 286, -771, 852
+red L6
+L112: dec *r2
+jmp L77
+cmp #138, #-53
+
+jmp L179
+clr L31
+L113: not L258
+dec r0
+L114: sub r5, L226
+add #-82, r2
+jmp L62
+L115: clr r4
+red L13
+clr r0
+jsr L265
+stop
+sub *r4, L269
+clr L137
+sub *r3, r7
+prn r2
+cmp L135, r3
+prn L166
+cmp #-234, *r7
+jmp *r2
+clr *r2
+add *r7, L79
+cmp L70, #-93
+add r3, *r0
+prn L45
+add r2, *r0
+prn L249
+L116: dec r1
+inc r1
+bne L22
+L117: red *r2
+jmp *r0
+rts
+jmp L168
+inc *r7
+jmp L11
+dec *r6
+; comment
+jmp L220
+stop
+jsr L75
+jsr L117
+; comment
+; comment
+clr r0
+L118: stop
+; comment
+L119: .string "xpopbcdp"
+stop
+L120: .data -955, 931, 434, -128
+add #24, L115
+L121: prn L277
+L122: cmp L115, L130
+L123: add L206, L7
+red r4
+red L53
+L124: lea L137, L212
+rts
+prn L131
+sub L196, L132
+jmp L1
+mov #-159, r7
+L125: prn *r6
+L126: .data -750, -615
+not r1
+prn *r0
+L127: rts
+jmp *r3
+mov *r1, *r3
+L128: stop
+jmp L276
+inc r7
+mov L101, L105
+cmp *r6, *r1
+; comment
+dec *r0
+L129: lea L123, r5
+add #-176, L27
+cmp r6, L207
+mov r4, *r3
+add *r5, L54
+L130: add #-221, *r6
+sub L17, L191
+jsr L43
+dec L55
+jsr L163
+L131: .data 162
+L132: inc L30
+red r1
+sub r5, L183
+clr L139
+cmp *r3, L121
+L133: .data -958, -699, -931, 614, -770
+inc *r1
+dec r3
+jmp L171
+add *r4, L91
+L134: jsr *r1
+; comment
+clr *r5
+jmp *r7
+L135: clr *r6
+bne *r7
+inc *r2
+inc L9
+clr r3
+; comment
+sub #-163, r2
+not *r4
+rts
+prn L34
+L136: .string "zkitpiksfethbwgvhjybuklz"
+rts
+L137: clr L183
+L138: .string "hytrvwpckyydaazy"
+jsr *r2
+inc r5
+stop
+clr r0
+jmp *r3
+stop
+L139: dec L102
+add *r4, r2
+inc r2
+stop
+L140: .data -613, -197, 691, -308
+L141: .data 210
+dec *r6
+
+clr r5
+dec *r3
+jmp *r5
+L142: cmp #106, *r3
+jmp *r6
+; comment
+L143: .data 869, -6, 359, 980
+add L248, L40
+rts
+rts
+L144: .data -874
+red *r3
+cmp *r1, L179
+cmp r5, #-237
+red *r0
+lea L92, L163
+L145: .data -348
+rts
+L146: bne *r2
+add r0, *r2
+clr *r6
+
+clr L183
+lea L192, *r7
+rts
+prn L8
+dec *r7
+add *r1, r2
+prn r6
+L147: .data 623, 238, -14, -151, -265, -950, 743
+stop
+bne L174
+not *r3
+L148: jsr *r1
+clr r3
+prn *r3
+L149: inc *r1
+add r1, L3
+prn #60
+not *r2
+L150: .data 386, 368, -847, -611, 182, -140, 153
+sub L249, r3
+; comment
+L151: not *r2
+sub r0, L99
+prn *r1
+
+L152: rts
+lea L253, *r6
+L153: jmp L80
+dec *r1
+jmp *r0
+L154: jsr L140
+sub r1, L174
+not r1
+not L236
+L155: bne *r6
+clr r0
+bne *r0
+add r2, *r4
+; comment
+L156: jsr L137
+red *r3
+L157: .string "txpm"
+L158: clr *r2
+
+dec L160
+lea L199, *r1
+not L114
+rts
+cmp *r0, L243
+; comment
+L159: add *r3, *r1
+prn r6
+rts
+stop
+L160: jmp *r3
+jmp *r6
+cmp *r5, *r5
+bne L189
+L161: .data -79, 27, 570, 343, 48, -285
+bne *r1
+L162: red L196
+sub r3, L4
+stop
+cmp *r3, L273
+L163: .data -916, 294, 855, -679, 412, 201, -857, -472
+inc r5
+not L155
+inc *r0
+L164: .data 640, -883
+prn #103
+L165: cmp L129, *r1
+stop
+red *r1
+
+lea L238, r6
+L166: jmp L35
+prn r0
+L167: lea L50, L263
+; comment
+L168: jsr L214
+sub *r3, r7
+stop
+add #-220, L198
+L169: clr r3
+L170: sub L127, L88
+L171: bne L2
+mov #-121, *r4
+rts
+L172: sub #-127, L183
+dec *r6
+stop
+L173: .data 464, 90, 723
+clr r7
+mov r2, *r4
+L174: rts
+cmp r6, r0
+rts
+L175: lea L11, r0
+L176: .string "jsqctlgjennryuyjv"
+dec *r3
+rts
+jsr *r3
+clr r1
+add *r3, L208
+jmp L147
+dec *r1
+sub *r5, L160
+prn r2
+stop
+L177: inc L232
+stop
+inc L239
+L178: .string "fcbrd"
+clr r4
+stop
+jmp *r5
+L179: sub r7, L184
+sub L243, L270
+L180: not L191
+L181: clr *r7
+mov r5, r7
+jsr L8
+L182: cmp #23, *r3
+L183: mov #234, L275
+L184: jsr *r1
+rts
+L185: lea L60, *r3
+L186: inc L110
+stop
+jsr L248
+clr L221
+prn r5
+sub r3, L199
+L187: .data -405, 249, 281, -908, 490, 735, -177
+clr *r6
+stop
+clr *r1
+L188: .data -230, -623, 482, -859, -703, 158
+L189: mov #-119, *r0
+not L214
+lea L214, *r1
+stop
+clr r1
+sub r2, L237
+not *r5
+L190: .string "bmbilfkvir"
+stop
+L191: cmp #-150, *r0
+cmp L181, L280
+L192: .data 815, 504, -24
+not L257
+L193: clr *r6
+stop
+; comment
+sub *r1, r1
+lea L85, L109
+L194: .data 977, 423, -673, 484, 876, 749
+L195: .string "jxrcydmlqvzxrblql"
+stop
+add r5, r5
+dec L231
+clr r0
+L196: dec L64
+red *r6
+sub *r4, L248
+L197: .string "paxzqypvnfykhm"
+L198: .string "dnfbgsyu"
+rts
+L199: red r3
+L200: stop
+add #130, L59
+sub L90, L78
+inc L181
+cmp *r4, *r4
+inc r6
+rts
+rts
+mov L234, r4
+not *r5
+L201: mov r5, r1
+dec L200
+jmp *r2
+jsr *r5
+L202: .string "fbqkrqyq"
+L203: add #-143, L188
+; comment
+L204: .string "ebpzntr"
+L205: not r6
+dec r7
+not r4
+L206: lea L271, r2
+sub #156, *r2
+dec r5
+L207: red *r7
+prn r7
+prn *r0
+L208: sub L97, *r0
+L209: dec r3
+prn r5
+L210: sub L227, r5
+L211: .data 737, -254, 544, -642, -119, -460
+L212: cmp *r5, L262
+bne L243
+L213: .string "go"
+jmp *r7
+prn r6
+clr r1
+rts
+sub #161, *r5
+add r6, L254
+prn *r3
+prn L234
+lea L238, *r4
+rts
+L214: jmp L191
+; comment
+dec r4
+mov #-180, *r1
+lea L247, r2
+cmp r0, *r0
+L215: red L135
+not L216
+L216: jmp *r3
+L217: .string "bkun"
+clr L247
+jsr *r1
+inc r1
+rts
+L218: dec r7
+; comment
+cmp L89, *r4
+L219: mov L60, *r1
+; comment
+jsr L70
+; comment
+L220: rts
+L221: .string "yqzgckjzm"
+jmp *r5
+L222: sub #-195, L117
+L223: bne L255
+dec L50
+; comment
+prn *r3
+L224: cmp r1, L225
+; comment
+L225: dec r5
+jsr L267
+L226: red L270
+L227: cmp r7, r4
+clr *r6
+cmp r0, L231
+dec r4
+clr r4
+cmp #-56, #233
+lea L265, r1
+rts
+sub *r3, r6
+red r5
+stop
+not r5
+L228: mov #114, L52
+bne L23
+lea L39, *r6
+sub #24, L250
+red *r3
+mov *r3, r4
+L229: cmp #183, r4
+jmp L261
+stop
+lea L235, L173
+not *r1
+bne *r5
+L230: .string "grmajeprnloiagvegai"
+red *r1
+L231: .data -513, -639
+rts
+
+rts
+jmp L252
+
+red r3
+dec r1
+mov #205, r5
+; comment
+rts
+dec *r1
+L232: inc *r7
+rts
+sub #-110, L252
+not *r7
+
+rts
+L233: not r6
+jmp L260
+cmp r4, r4
+prn *r7
+lea L215, L252
+L234: .string "bjsivekzqw"
+L235: add L18, r3
+stop
+L236: lea L275, *r2
+L237: cmp L245, r3
+; comment
+L238: stop
+prn *r5
+add L274, r5
+clr L5
+L239: cmp r0, *r5
+bne *r1
+cmp #-246, #-79
+jmp *r1
+red r5
+
+jmp *r4
+bne L113
+prn r3
+stop
+jmp L25
+L240: .string "kwobkairsacfighpsuni"
+not *r3
+inc r3
+jmp L115
+cmp r4, r4
+rts
+L241: bne *r6
+jmp L262
+rts
+bne *r1
+clr *r0
+inc *r6
+sub r2, L266
+not *r1
+rts
+rts
+L242: dec L43
+jmp L257
+dec r0
+L243: lea L273, L268
+prn L221
+add r3, *r3
+L244: .string "llzjnaeureecqwgnzdf"
+jsr *r2
+rts
+L245: sub *r0, r1
+jsr L32
+mov *r7, L30
+L246: clr r0
+L247: rts
+bne L208
+cmp L273, #206
+red L57
+rts
+sub r1, L274
+
+L248: inc L98
+L249: lea L258, *r2
+prn r4
+jsr *r1
+not r3
+L250: mov L263, L266
+stop
+clr r6
+dec r5
+jsr *r2
+mov #209, L23
+sub L265, r6
+
+sub #98, r6
+mov L251, L270
+rts
+
+sub *r6, r4
+not L17
+L251: .string "sbyfjkrdwoeeeef"
+L252: .string "wqgurskdwbrjqakyxofvrktw"
+L253: jsr L156
+cmp *r2, r6
+stop
+stop
+L254: .data 647, -620, -861, 942, -254
+mov *r5, *r2
+not r0
+prn #-225
+dec L259
+dec *r7
+L255: mov r5, r7
+L256: .string "ovh"
+L257: .string "nhmuchm"
+L258: .string "uqdyoxgfwjmllpyjidzbf"
+L259: .data -831, 655, -33, 969
+add L218, *r0
+add L271, *r1
+clr r2
+L260: .string "cvftvrspkpqvyugeivrz"
+prn *r4
+stop
+; comment
+sub *r2, L229
+inc r4
+L261: red *r7
+L262: red *r3
+prn *r6
+L263: .string "yfzybfdqz"
+mov r0, *r2
+clr L275
+L264: rts
+mov L44, *r1
+add *r1, *r1
+jmp L14
+stop
+
+inc *r4
+dec *r3
+L265: .data 960, -132, 705, 547, -547
+jsr L141
+jsr *r4
+L266: add L105, *r5
+dec L280
+prn L280
+; comment
+cmp r4, r5
+L267: red L268
+L268: clr *r4
+prn L103
+L269: mov r1, L232
+clr *r5
+L270: .data -497, 333
+mov r5, r7
+lea L280, r6
+lea L117, L271
+L271: sub L65, r7
+inc L154
+jmp *r2
+red r5
+stop
+inc L10
+clr *r3
+prn *r0
+L272: stop
+mov L273, r3
+mov #161, r1
+inc *r6
+red L273
+cmp r4, *r6
+jsr L275
+lea L121, L275
+rts
+; comment
+bne L276
+lea L278, r3
+L273: .string "hpfzbfrhfbusbcrumgauccqu"
+L274: .data 830, 116, -196, -607, -172, -824, -822, -406
+rts
+; comment
+not L164
+rts
+L275: lea L196, L279
+red r7
+inc L171
+jmp *r4
+add #212, L270
+clr r3
+bne *r0
+cmp r5, *r0
+jsr *r6
+jmp *r6
+rts
+rts
+L276: lea L147, L248
+L277: mov #6, r2
+clr r0
+rts
+L278: .data -742, 636, 853
+; comment
+red r4
+cmp L279, L279
+inc *r1
+not r1
+add L279, L279
+prn #27
+jmp L93
+add #235, r5
+clr *r1
+L279: dec L280
+red L280
+L280: rts
+mov L73, L178
+red L147
+stop
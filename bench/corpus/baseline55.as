@@ -0,0 +1,1019 @@
+; Generated by genCorpus --seed 56
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+stop
+sub #221, *r6
+dec L91
+
+L0: prn L0
+mov L0, r7
+lea L175, *r0
+L1: .string "mlh"
+; comment
+rts
+jsr L0
+dec r5
+; comment
+L2: .string "ajwldlqsnuarywkqjwuadpdg"
+L3: jsr *r5
+lea L3, *r0
+L4: .string "rvdnauttwzikshy"
+add L158, *r5
+L5: .data -764, -828, 927, 362, -279
+L6: .string "vcmkg"
+jsr L5
+
+
+L7: add *r5, L4
+L8: clr L7
+rts
+jmp *r7
+dec L237
+L9: jmp *r4
+L10: stop
+add *r6, L139
+rts
+bne L139
+bne *r3
+red *r1
+sub #-137, L5
+L11: .data 950, 526, 482, 403, 189
+jsr L2
+add L4, L57
+
+sub #72, r5
+stop
+cmp L175, #99
+jsr L187
+rts
+add r5, r1
+bne *r5
+L12: jmp *r4
+bne *r5
+not r0
+L13: add L144, *r1
+clr r5
+dec r5
+clr r0
+prn r0
+L14: cmp r1, #-2
+L15: jsr *r5
+bne *r5
+jsr L61
+L16: .data -7, 40, 713, 367, 703, -838, 410, 407
+prn *r5
+prn L157
+mov *r1, r5
+red r0
+clr L14
+not L207
+L17: dec *r3
+jmp L5
+inc r7
+add *r2, *r2
+; comment
+prn r4
+cmp *r5, #-247
+prn #167
+bne L19
+; comment
+jsr L81
+bne L2
+; comment
+clr L14
+L18: lea L15, L13
+stop
+jsr L180
+cmp L13, #-254
+clr *r2
+L19: .string "h"
+not r7
+lea L27, r5
+mov #177, r0
+dec *r1
+lea L13, L18
+jmp L15
+rts
+; comment
+sub L33, r5
+not *r1
+clr r5
+L20: .data 961, -5, 204, 182
+stop
+L21: dec r5
+L22: .data -872, -932
+L23: prn r5
+jmp *r1
+stop
+L24: .data -352, 254, 406, -474, -263
+L25: .data -965, 361, 414, 173, -41, -629, 459
+inc L81
+prn L86
+jsr L133
+dec r7
+L26: clr L122
+bne L233
+clr r1
+rts
+clr r4
+cmp #-33, #-180
+prn *r3
+L27: rts
+add L18, *r5
+add L25, L21
+not L216
+L28: dec *r6
+red *r3
+red *r2
+L29: .string "akcas"
+jmp *r7
+not L205
+rts
+rts
+bne *r4
+inc *r7
+clr r7
+cmp L228, L164
+not L13
+rts
+L30: .string "cpdyrjjodgbfuz"
+L31: rts
+stop
+jsr *r5
+dec r7
+L32: .data 727, -108, -225, -482
+L33: .string "cjjirldlyyx"
+not L5
+
+not *r6
+L34: red L11
+clr r4
+not L34
+clr L29
+add r6, r3
+L35: .string "xty"
+sub r6, *r1
+sub #69, L11
+L36: clr L23
+not L53
+mov L13, L94
+rts
+L37: jsr L213
+lea L44, *r3
+inc L100
+L38: not L21
+L39: .data -592, -450, 875, -377, -840
+clr r0
+L40: .data -544, -660, -950, -850, -212, 963
+dec r3
+dec *r7
+L41: bne *r6
+; comment
+jsr L150
+; comment
+stop
+L42: red *r6
+bne L7
+jsr L46
+bne L256
+lea L19, L38
+lea L104, *r3
+jmp L240
+add #-102, r3
+inc *r7
+; comment
+dec L207
+bne *r4
+L43: red *r2
+L44: .data -732, 965, -776, 886
+lea L158, *r0
+jsr *r2
+sub *r6, r7
+mov #145, L137
+sub #-172, r3
+L45: jmp L23
+cmp *r6, *r3
+L46: stop
+inc *r1
+jsr *r6
+dec r2
+mov r6, *r0
+prn *r1
+jmp L232
+jsr L229
+; comment
+not r2
+mov *r7, L14
+not L232
+jmp *r3
+inc r1
+stop
+dec L155
+dec *r6
+; comment
+mov #142, r4
+dec L98
+jmp L116
+add *r5, *r3
+jmp *r3
+L47: clr *r5
+mov r7, L37
+prn *r2
+not *r6
+L48: .string "oseeyejlnax"
+mov *r3, L68
+red L42
+clr r0
+L49: .string "nkjm"
+; comment
+stop
+prn r5
+dec *r3
+jmp *r5
+L50: add r4, *r7
+inc L5
+sub *r0, L27
+bne *r2
+L51: mov L168, *r0
+L52: bne L107
+jmp *r3
+jmp *r6
+jsr *r7
+rts
+mov L48, L55
+jmp L149
+sub #-224, *r5
+red r5
+jsr L61
+sub L198, L115
+L53: jmp L38
+dec L204
+stop
+clr r1
+stop
+L54: .string "lrzppmcpckxjwrzrlqmsjwn"
+L55: .data 557, 475, 63, 866, 544
+; comment
+rts
+add L71, L141
+L56: .string "ahvsinqarydlsyuwjdtxvhfb"
+L57: .data 845, -196, -814, -289, -165, 652, 511
+add *r5, *r2
+red *r2
+L58: .data -11, 530, 2, -163, -77, -947, -775
+inc *r0
+rts
+rts
+sub r3, L246
+red *r0
+bne L42
+L59: jsr *r7
+cmp *r3, *r4
+L60: .string "zcsovyyuhqkgistot"
+L61: clr *r5
+red *r7
+inc r7
+red r3
+clr r2
+mov r6, *r0
+inc L249
+sub #-133, r3
+L62: jmp *r3
+L63: .data 413, -802, 646, 860, 356
+jmp L188
+inc L199
+stop
+rts
+rts
+not L6
+add L78, L17
+clr L47
+L64: add *r6, *r2
+red r6
+; comment
+jsr *r6
+inc *r1
+cmp L44, *r6
+L65: cmp r6, r3
+inc L82
+jmp *r1
+prn L48
+bne L65
+clr *r4
+jsr *r1
+prn r2
+clr r2
+stop
+
+dec r2
+lea L216, r6
+
+rts
+prn r0
+L66: .string "aloyqocloisafiea"
+rts
+rts
+not *r2
+prn L33
+dec *r6
+stop
+L67: .data 361, -232, 185, -979, 588, 225
+rts
+lea L203, r7
+dec L37
+L68: mov #130, r5
+L69: rts
+sub #-19, r6
+dec r4
+cmp r1, #194
+L70: jmp *r5
+red *r7
+L71: .string "ybzsykyxaau"
+clr r4
+jsr *r7
+clr *r6
+cmp r7, L20
+jsr L154
+clr L63
+L72: lea L38, L208
+L73: .data 250, -31, -867, 700, -580, -944
+L74: inc L78
+not *r1
+jsr *r1
+jmp *r0
+L75: mov *r4, *r7
+; comment
+cmp r4, #-10
+clr L58
+inc r0
+L76: .data 744, -979
+dec r7
+cmp r0, #38
+prn *r6
+inc *r4
+sub r2, r3
+rts
+L77: .string "iidksppalmneeu"
+rts
+L78: jmp *r4
+bne L208
+bne L240
+L79: add *r6, r2
+not L66
+mov #143, L65
+sub L5, L153
+red *r6
+
+clr L231
+jsr L38
+jsr *r5
+
+sub #114, r4
+L80: jsr L24
+prn #-200
+L81: .string "lmuneycufpuybyxfmpry"
+L82: .data -291, -851, 8, -183, -144, 582, -259, 126
+not r7
+L83: lea L95, L224
+sub r3, r7
+L84: sub #-179, L32
+bne L245
+rts
+dec L216
+prn #192
+stop
+jsr *r5
+cmp L71, *r6
+L85: .string "rispgaokm"
+L86: .string "xff"
+L87: mov r4, L132
+lea L184, *r6
+L88: bne L190
+L89: .string "hdecxg"
+jsr L105
+rts
+dec *r4
+L90: add L24, r2
+clr L176
+jmp L196
+rts
+L91: .string "hpxnolmc"
+not *r3
+red *r4
+jmp *r7
+
+rts
+inc r1
+L92: .data 610
+add #142, L109
+L93: .data -577, 300, -720, -362, -675, 800, -27
+red *r3
+sub *r6, *r6
+L94: stop
+L95: .data 463, 845, -305, -616, -282, 643
+cmp r2, *r2
+mov L239, *r7
+bne *r7
+not L66
+add L2, *r1
+bne L20
+bne *r3
+L96: mov r2, L48
+
+dec r5
+; comment
+L97: .data 269, 973, 278, 8, 67, 625
+jmp L156
+L98: prn L105
+prn #-11
+jsr *r3
+stop
+not *r5
+lea L160, *r4
+inc *r3
+prn L32
+sub L21, L53
+L99: prn #102
+not L33
+L100: sub L146, *r0
+red r2
+L101: .data 869
+red L63
+bne L147
+rts
+mov *r4, *r5
+L102: red *r1
+L103: inc r4
+bne *r0
+L104: .data -844, 205, 437, -158, -62, -280
+jmp *r2
+jmp L226
+jmp *r2
+clr *r2
+red *r0
+
+L105: red *r3
+L106: jmp L144
+jsr L21
+jsr *r1
+L107: mov #-128, *r7
+clr L54
+red *r1
+L108: .data 558, 378, -761, 901
+L109: jmp *r0
+cmp *r1, L153
+clr *r4
+L110: .data -90, -279, -148, 936, -74, 335, 301, -113
+rts
+
+sub *r0, L194
+; comment
+L111: rts
+L112: jsr *r5
+bne L57
+not *r0
+L113: jmp L92
+dec *r4
+bne L1
+L114: bne *r7
+clr r3
+sub r4, r2
+L115: inc L185
+jsr *r4
+jsr L145
+sub *r1, *r0
+mov *r0, L11
+add #234, r5
+bne L90
+jmp *r4
+L116: .data 898, -789, -862, 721
+L117: not L96
+mov *r1, L199
+dec *r7
+L118: rts
+L119: prn L3
+jsr *r4
+jsr L68
+L120: .string "ucqhhablpjfikyo"
+rts
+rts
+mov r5, r6
+jsr *r6
+L121: .data 785, -796, -547, 383, 394
+stop
+rts
+clr r1
+L122: .data -636, 324, 800, 856, -537, 817, -192, -145
+L123: jsr L36
+bne *r2
+add L7, r3
+L124: .string "mvfcypdrwgmjs"
+cmp r4, L168
+jmp *r6
+sub #-44, L25
+L125: red *r2
+L126: cmp r1, #-117
+bne *r2
+cmp L128, #-40
+rts
+stop
+red L178
+L127: bne L158
+bne *r5
+prn L121
+L128: bne L196
+add #142, *r5
+dec *r5
+stop
+inc r7
+jsr *r4
+cmp #203, L219
+lea L164, r5
+L129: .string "zx"
+red *r0
+rts
+sub *r2, *r2
+
+lea L32, L150
+L130: jsr *r2
+L131: clr L215
+L132: .data -747
+dec *r2
+red r6
+inc L134
+stop
+jmp L50
+dec L79
+rts
+inc L21
+L133: rts
+L134: red L206
+add r5, *r7
+inc r5
+clr L196
+rts
+lea L197, r6
+sub L242, r3
+mov #183, *r5
+L135: red *r0
+jmp L206
+L136: .string "whtay"
+red r0
+jmp *r6
+L137: add #-188, *r7
+stop
+cmp L7, #-100
+red r3
+red *r0
+rts
+; comment
+jmp L231
+bne L230
+stop
+jsr *r5
+sub L227, *r1
+mov L45, *r3
+mov L232, L235
+rts
+L138: .data 964
+stop
+not *r3
+jsr L116
+clr *r0
+; comment
+red *r7
+red *r2
+L139: clr r5
+L140: stop
+bne *r5
+dec r1
+L141: lea L144, L238
+dec *r1
+inc L72
+L142: jmp *r6
+lea L10, *r5
+lea L55, L31
+jsr *r2
+; comment
+L143: .data 432, -71, 437
+mov r2, L25
+L144: not r5
+L145: .string "qdklismzyccqmefmoz"
+L146: dec *r3
+jsr *r7
+mov *r1, *r2
+prn r0
+L147: .string "dclhcu"
+L148: .data 31, 946
+not r3
+sub #124, *r3
+bne L106
+rts
+prn L135
+cmp L15, L9
+stop
+cmp r2, *r2
+dec L197
+; comment
+L149: .data 482, 523, -92, 475, -22, -108, -258
+not L172
+inc r5
+not L117
+add #231, *r4
+not *r2
+sub L238, *r5
+jmp L52
+red L253
+inc *r1
+mov L17, L219
+L150: sub L121, L16
+lea L199, *r7
+; comment
+inc r6
+dec r6
+L151: lea L61, r5
+bne L241
+L152: .string "hvscbzxgyqfqv"
+inc L63
+red r0
+not *r3
+; comment
+lea L176, r6
+mov *r5, r7
+bne L99
+not L240
+L153: add L157, L89
+prn *r6
+cmp *r2, r4
+rts
+jmp L45
+prn #105
+L154: .string "cstlowybumknynozmyqt"
+mov #187, L1
+sub *r4, L216
+dec L253
+clr *r6
+jmp *r2
+red r2
+jmp *r2
+bne *r1
+inc *r2
+jmp L95
+inc L100
+L155: lea L145, *r4
+L156: sub #124, *r3
+cmp *r0, *r1
+L157: cmp L205, L179
+add #-42, r3
+not *r7
+cmp *r4, r7
+lea L72, L5
+mov L202, L195
+sub L209, L12
+stop
+L158: add L221, r6
+L159: rts
+cmp L239, *r5
+rts
+L160: .data -633, -447, 884, -706, 358, 150, 176
+L161: bne *r1
+L162: .string "tnrteuvxmhsupjbs"
+jmp *r4
+stop
+
+inc L249
+L163: lea L244, *r4
+inc r4
+red r0
+L164: .data -544, -748, -643, 898
+prn #122
+jmp L199
+; comment
+inc r4
+prn *r0
+L165: .data 344, 614
+not r5
+rts
+L166: .data -916, 824, 892, -349, -796
+jmp *r4
+lea L82, r2
+jmp L110
+rts
+stop
+stop
+mov *r0, L155
+clr L20
+L167: jmp L92
+jsr L123
+sub L94, r4
+; comment
+red r2
+stop
+jmp *r2
+L168: mov *r1, L187
+not r2
+L169: prn L208
+stop
+L170: .string "ceo"
+red *r5
+prn r0
+L171: .string "aqebbhsfkjvggbhtgygnbmfx"
+L172: dec r6
+not r1
+; comment
+mov r4, *r5
+L173: mov #-79, *r6
+L174: bne *r5
+mov #-192, L209
+L175: .string "ty"
+L176: dec *r2
+L177: jmp *r1
+prn *r2
+add *r2, r0
+stop
+jsr *r2
+stop
+rts
+add *r0, r2
+bne L253
+stop
+lea L186, *r4
+jsr *r6
+L178: .string "vhoahtvgkyrnsmmypzm"
+L179: .string "ul"
+
+jsr L117
+mov #-34, *r5
+prn #-88
+jmp L183
+cmp #-130, r7
+L180: .data 767, 412, 18, -672
+L181: .data -307, -663, -364, -690, -148, 209, -78
+prn *r3
+L182: stop
+clr *r7
+L183: cmp r1, *r6
+L184: prn r1
+cmp #-79, L256
+sub #-130, r0
+jmp *r1
+not L230
+rts
+L185: rts
+clr r3
+L186: stop
+inc L204
+bne L162
+inc L217
+sub r1, *r5
+L187: jmp *r7
+inc L199
+dec L124
+L188: .string "ldzickgailj"
+; comment
+prn L240
+not *r2
+jsr *r6
+
+jsr L207
+inc L53
+sub L39, *r2
+L189: jmp L26
+add #231, *r7
+rts
+L190: clr r5
+dec *r3
+L191: stop
+L192: red L244
+mov r2, L182
+dec r4
+jmp L210
+cmp #-161, #-140
+L193: lea L183, *r4
+clr *r0
+add *r7, L237
+jsr *r2
+inc r1
+L194: jmp L132
+L195: dec L111
+add r7, *r7
+not L74
+add r7, r2
+stop
+inc L244
+L196: rts
+clr L127
+L197: .data -28
+mov #-101, *r4
+lea L208, *r4
+cmp *r2, r0
+L198: .string "y"
+L199: clr r7
+add *r5, r4
+clr r6
+clr r3
+mov L213, *r4
+rts
+L200: mov L47, L143
+L201: inc *r2
+not r3
+rts
+L202: .data -169, 607, -573, -53
+stop
+mov *r2, *r5
+cmp L240, #200
+jsr *r3
+inc *r2
+mov *r1, L232
+cmp *r7, *r7
+sub L176, *r5
+L203: jmp *r6
+L204: .string "gworfbaidskk"
+inc r6
+L205: jsr L216
+inc L194
+red r3
+
+L206: jmp *r3
+L207: .data 633, -618, 711, -79, -561, 240, 175
+inc *r5
+dec r3
+L208: .data 49, -998, 971, 508, -558, -972, 587, -773
+L209: .string "shsdnpxtscultxosapzpnw"
+jmp *r2
+sub *r2, *r7
+bne *r3
+add *r3, *r5
+L210: cmp r4, *r1
+lea L214, L167
+stop
+clr *r1
+red L119
+L211: rts
+bne L228
+cmp #166, *r4
+cmp L245, r1
+lea L200, *r7
+L212: clr L84
+; comment
+dec r1
+
+inc r0
+add #109, r0
+cmp L248, L60
+mov r2, L35
+dec *r2
+L213: mov r0, r5
+L214: .data -563, 933, -427, -407
+inc *r6
+red *r7
+lea L255, r0
+clr L129
+; comment
+L215: add *r3, L209
+L216: .data 240, 745, -285, -94, 869, 282
+stop
+; comment
+jmp L201
+L217: bne L211
+; comment
+mov #-220, r0
+mov L253, *r7
+bne *r6
+lea L229, *r6
+clr L252
+lea L147, r2
+jsr L114
+L218: .string "vwdzinuviuvwbok"
+L219: dec *r3
+; comment
+L220: sub L96, r5
+dec L221
+cmp #136, #191
+bne *r3
+not *r3
+rts
+clr L188
+; comment
+L221: .data -206, -52, -159, -154
+inc *r3
+L222: .data -673, 631
+clr *r5
+prn *r7
+L223: add #-208, *r0
+L224: prn L13
+add *r2, L230
+L225: jsr L192
+cmp #-244, *r4
+bne *r5
+cmp #62, #92
+L226: mov L100, L228
+L227: red L121
+not r3
+; comment
+jmp *r3
+not *r6
+sub *r2, *r6
+lea L214, L68
+L228: jmp *r2
+add #-198, *r4
+L229: prn L231
+clr r5
+L230: .data -391, -565, 749
+cmp #-208, L240
+prn #160
+stop
+stop
+clr *r0
+L231: add *r5, r1
+L232: cmp L116, *r5
+jmp *r0
+sub *r5, r6
+L233: .string "sn"
+jmp L242
+L234: add *r6, *r4
+jmp *r0
+; comment
+rts
+lea L191, *r7
+L235: .data -477
+jsr *r5
+not r6
+L236: rts
+L237: cmp #-33, #150
+red *r5
+lea L181, *r6
+add *r1, r0
+L238: .data 486, -506, 248, 738
+not *r5
+jsr *r4
+clr *r4
+lea L239, L145
+L239: lea L236, L255
+rts
+L240: clr r7
+inc L248
+not L86
+prn *r0
+L241: clr L32
+L242: .data 455, 279, -162, 916, 54, -606, -590
+cmp #0, #149
+L243: cmp *r3, *r0
+L244: .string "nlnkpjqted"
+lea L253, *r5
+L245: add L78, r4
+add #-239, *r0
+; comment
+jsr L237
+rts
+red L188
+jsr *r1
+
+clr *r7
+stop
+jmp *r3
+L246: .data -480, -772
+L247: add #-4, r7
+inc *r5
+L248: stop
+stop
+not *r7
+L249: .data -986, 148, -675, -986, 453, -762
+lea L250, L172
+L250: .data -986, 354
+L251: cmp *r6, r3
+lea L253, r1
+prn r2
+stop
+jsr *r6
+stop
+L252: .data 488, 58
+bne L135
+L253: .data -991, 153, -845, 908
+inc *r0
+stop
+cmp r7, L242
+L254: .data -10, -421
+lea L101, *r0
+stop
+; comment
+L255: dec r0
+sub #121, L256
+L256: inc *r1
+stop
+stop
@@ -0,0 +1,1019 @@
+; Generated by genCorpus --seed 57
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+bne *r0
+add r1, r4
+lea L81, r1
+L0: rts
+cmp *r5, L113
+mov *r5, *r2
+sub L176, r2
+L1: add *r6, L220
+sub r2, r4
+rts
+L2: bne *r4
+L3: not *r7
+lea L1, *r6
+clr L1
+dec r7
+red L3
+L4: mov #-226, r1
+L5: stop
+jsr *r6
+lea L3, L5
+cmp #232, L3
+add r7, L1
+jmp *r0
+mov r7, L4
+add r3, *r6
+L6: .string "wjyampbnmwzzdgs"
+red r1
+jsr *r5
+L7: clr L102
+bne L190
+prn *r5
+L8: red r7
+stop
+L9: mov #204, L107
+bne *r2
+red L171
+clr r5
+L10: stop
+L11: cmp *r7, #-34
+L12: cmp #-185, L140
+jsr *r4
+
+L13: clr *r3
+L14: mov #2, r6
+jsr L6
+cmp r0, r7
+L15: lea L91, L15
+not *r0
+not L123
+prn r4
+cmp *r3, #103
+stop
+jmp *r1
+L16: rts
+rts
+L17: sub r5, r3
+red L7
+bne L86
+dec L235
+stop
+L18: .string "dcixndmhadhclbavn"
+clr *r2
+L19: .string "qccw"
+L20: lea L4, L10
+L21: .string "tmxdnsnrbkbz"
+L22: prn L47
+rts
+L23: .string "gojqqcedp"
+mov #204, r3
+jmp L22
+L24: rts
+L25: .data -489, 138, 635, -876, -82, -189, -613, -239
+L26: bne *r2
+stop
+jmp *r2
+L27: clr r0
+L28: add #-101, r1
+L29: jsr *r1
+mov #245, r4
+dec *r1
+lea L1, r1
+L30: .data 481, -850, -15, 532
+cmp r5, L12
+L31: stop
+L32: jmp L160
+cmp r7, L1
+inc *r3
+bne L50
+dec *r0
+inc r4
+sub *r3, L2
+L33: clr L12
+add #-218, L1
+prn *r4
+L34: clr r5
+sub *r0, r2
+L35: jsr L81
+add L93, r2
+lea L5, r3
+L36: .data -879, 156, -421, -1, -354, 323, -413
+L37: .string "cbfyrimdclhfdw"
+red r7
+stop
+not r2
+jmp *r4
+not *r4
+L38: not r3
+L39: .data -97
+stop
+prn L17
+jsr L231
+clr L33
+L40: stop
+; comment
+clr *r3
+jmp *r7
+mov r2, *r0
+red r0
+L41: .string "njymuvcuqky"
+inc *r5
+; comment
+jmp *r2
+jmp *r6
+L42: .data -174, -877, 775, 885, 504, -404, -189
+L43: sub #211, *r7
+L44: .data -475, 636, 93, 984
+add #186, r0
+L45: cmp #-95, r5
+stop
+jsr *r1
+L46: stop
+add *r7, L183
+cmp L145, *r0
+L47: not *r6
+not r2
+mov #-157, L210
+sub #-225, r7
+clr L38
+add L46, *r6
+jmp *r3
+red r7
+cmp L36, *r2
+stop
+cmp #-222, L8
+jsr L88
+bne L41
+
+inc r5
+jsr *r2
+mov *r0, *r0
+lea L74, *r7
+prn r6
+not r5
+red r2
+jsr *r3
+dec L39
+L48: mov L6, *r2
+L49: .data 854, 111, -819, 729, 842, -920, -521, -479
+red r5
+; comment
+sub *r5, L241
+cmp *r4, r6
+L50: .string "swcrmfsevygmkpy"
+jmp *r2
+L51: .data 77, -812, -944, 505, 87, 763
+; comment
+jsr *r2
+dec *r2
+sub L242, *r4
+rts
+L52: .string "zcqlndiqhaagm"
+L53: red L33
+rts
+prn #243
+red r0
+jmp *r7
+dec L47
+; comment
+L54: .data 397, 901, -308, 178, -148, -617, 365, 765
+add #58, L28
+add #152, *r2
+add r7, L52
+mov r4, *r1
+bne L124
+clr L144
+clr *r6
+L55: mov *r0, L34
+L56: .string "xplurni"
+L57: red r0
+L58: cmp #-197, #125
+; comment
+clr *r5
+red L99
+L59: .string "raaaex"
+L60: .string "bosgpecnouxot"
+rts
+L61: mov L172, L16
+L62: .data 691, -794, -59, 565, 260, -302
+lea L33, *r7
+jmp *r4
+add L11, *r0
+bne L40
+jmp L14
+red r5
+prn L191
+clr L38
+sub #-208, L48
+not L108
+
+mov L60, L171
+prn *r6
+not r3
+L63: .data -788, 378, 415, 773, 912, 691, 495
+prn L30
+L64: .data 926
+cmp *r3, L173
+dec r2
+L65: mov r5, L41
+rts
+bne L64
+inc *r3
+cmp #-131, *r2
+prn *r0
+cmp *r6, L74
+L66: clr *r5
+prn *r5
+dec *r4
+not *r2
+L67: not L30
+prn L237
+jsr *r7
+clr L50
+L68: jmp *r1
+prn #-18
+jsr *r0
+jsr L34
+L69: .string "slszbkrazdvlcuccqzqz"
+lea L191, r2
+jsr L227
+jmp L207
+sub #202, L84
+dec L34
+not *r7
+L70: dec r7
+lea L109, r0
+clr L136
+red L86
+jmp *r7
+clr *r0
+L71: inc r0
+bne *r7
+L72: .data 92, -629, 309, -602, -234, -903
+
+L73: .string "lgqqb"
+
+lea L2, *r5
+add L220, *r7
+L74: inc *r1
+not r5
+rts
+clr r2
+cmp L43, r2
+stop
+L75: .data -338, 963, 197, -572, 514, -889
+L76: .string "rouhnlongzhogcqqxswhe"
+bne *r4
+inc L64
+L77: .data 426, 983
+cmp r3, *r2
+stop
+dec *r4
+
+rts
+; comment
+add r0, r3
+; comment
+L78: .data -95, -866, 491
+not L246
+mov L192, *r1
+L79: red L41
+cmp r5, L71
+sub #88, L9
+lea L171, L87
+red L179
+L80: prn r3
+dec L81
+L81: jmp *r5
+L82: stop
+bne *r2
+L83: .data -835, -948, -995, -5, 331, -421, -151, -997
+mov r0, r4
+red L198
+L84: dec r7
+inc L156
+dec L116
+rts
+not *r5
+add r1, r2
+not L17
+L85: dec r7
+mov L0, r7
+jsr *r5
+L86: .data 512
+L87: stop
+cmp r6, *r4
+dec L176
+rts
+mov #226, L195
+L88: red r0
+red *r4
+L89: cmp L1, #-159
+L90: stop
+add L81, r7
+rts
+inc L142
+bne L17
+L91: clr *r6
+L92: inc *r2
+
+stop
+dec *r2
+
+add #82, L73
+stop
+L93: stop
+L94: add L232, L230
+not r6
+L95: inc *r5
+lea L27, *r2
+stop
+dec L190
+red *r4
+red *r1
+lea L223, L188
+rts
+mov r0, *r5
+rts
+lea L51, *r6
+
+clr r2
+jsr L221
+sub L102, r0
+L96: red L163
+sub r1, L87
+L97: .data 946
+L98: bne L35
+add L112, r2
+red *r0
+dec *r6
+rts
+clr L69
+dec *r5
+stop
+
+clr L204
+inc r6
+prn r3
+jsr L30
+L99: .string "vflzqerqmpg"
+L100: clr r0
+bne L60
+jmp L197
+L101: jsr *r5
+jmp *r5
+L102: .data 630, -909, -477
+inc r3
+stop
+L103: clr L7
+L104: mov r6, r7
+add L19, *r0
+mov #226, r1
+cmp *r2, *r0
+rts
+jmp L82
+; comment
+prn L253
+not L67
+not L104
+L105: stop
+L106: not L239
+red r0
+L107: bne L212
+L108: cmp #-214, L51
+
+L109: stop
+red L67
+mov r7, L243
+sub L181, *r3
+cmp #-217, L86
+; comment
+; comment
+red *r4
+L110: lea L109, *r7
+red r7
+bne L152
+L111: .string "zzkbbpeqoxtmbqsmey"
+not L23
+
+prn #-188
+rts
+L112: .data 664, -916, 345, 242
+; comment
+L113: cmp L117, r4
+clr L216
+stop
+red L189
+dec *r4
+prn #-234
+add *r3, L246
+add r2, *r0
+jmp *r6
+
+L114: jsr L51
+rts
+inc *r5
+cmp *r3, #-134
+L115: stop
+not L73
+inc r2
+L116: dec L71
+add *r4, r0
+L117: add #-51, *r6
+lea L75, L36
+rts
+cmp *r4, #-60
+dec r4
+mov #-46, L95
+inc *r1
+mov r6, *r3
+L118: inc r1
+add r0, L119
+dec *r0
+clr L212
+L119: .data 781, 680, 454, -183, -804
+stop
+L120: add r7, L89
+L121: lea L226, *r0
+cmp r1, L153
+prn *r7
+clr r7
+bne L151
+stop
+red r5
+L122: .string "yvdawlzrpogzswh"
+prn r4
+not L198
+mov L176, L7
+stop
+stop
+L123: .data -126, -606, 599, -928, 98, 510
+rts
+L124: jmp *r6
+sub *r6, L18
+lea L157, *r1
+L125: .string "toghl"
+
+dec r2
+; comment
+sub L203, r3
+mov #199, L171
+lea L186, *r4
+lea L210, *r1
+inc L164
+cmp L184, #197
+red *r1
+lea L23, r3
+L126: .string "xnerjrycxbhhdymnrbazupp"
+stop
+jmp *r3
+rts
+not r0
+inc *r5
+
+
+mov *r1, L75
+L127: red r0
+prn *r3
+L128: .data 223, 781, -956, -944, -670, 819, -852, -640
+L129: .data 126, -128, 91, 854, -127
+L130: mov r3, *r1
+L131: add *r2, L184
+
+L132: .string "x"
+clr *r0
+L133: inc L184
+bne L233
+stop
+inc r3
+jmp *r1
+lea L61, r6
+L134: .string "fcp"
+clr *r5
+mov r0, L130
+add r5, *r7
+jsr L257
+L135: jmp L80
+sub r6, L55
+L136: .string "tuzysyujahpbx"
+sub r5, *r2
+jmp *r3
+L137: jsr *r6
+clr *r1
+clr L203
+add *r7, L215
+jsr *r2
+inc L7
+prn L207
+L138: lea L65, L165
+
+cmp L22, *r1
+L139: stop
+lea L12, *r2
+clr L41
+prn #143
+sub *r0, L138
+lea L179, r0
+clr L213
+not r0
+bne L5
+clr L159
+sub r3, r0
+
+add *r1, r4
+mov L223, r4
+red L223
+L140: cmp L22, r1
+L141: mov L120, *r4
+prn r3
+clr r5
+mov L150, L172
+jmp L99
+jsr L8
+L142: inc L132
+red L25
+prn r5
+
+L143: inc L66
+prn r2
+stop
+jmp L94
+add r2, L100
+L144: dec L12
+bne L17
+stop
+; comment
+clr L202
+; comment
+prn r4
+jmp *r4
+L145: jmp L115
+jsr L70
+red L192
+prn #188
+not *r5
+dec r6
+inc r2
+cmp r1, r5
+; comment
+L146: sub *r7, *r7
+red *r4
+L147: stop
+inc r0
+inc L223
+rts
+mov #70, L76
+L148: inc L133
+L149: red L155
+L150: not L205
+rts
+add #-97, r0
+L151: .data -635, 878, -238, -945, 723, -303, 530
+L152: .data -48, 21, -959, 899
+L153: lea L192, L98
+stop
+add L93, *r6
+stop
+L154: rts
+prn L176
+rts
+rts
+jsr L57
+; comment
+stop
+dec *r1
+inc *r0
+stop
+stop
+sub L136, r3
+stop
+add r1, r5
+bne L39
+inc *r5
+clr *r1
+L155: .data -929, -883, -374, 214, 72, -912, 688, 270
+dec r3
+
+jmp *r7
+
+jmp L247
+L156: .string "gjsaqameouae"
+stop
+jsr *r2
+dec L13
+red *r4
+L157: inc *r4
+lea L202, r7
+bne *r0
+L158: add #62, r4
+mov r1, *r6
+; comment
+lea L110, L232
+not *r0
+red L125
+inc L191
+lea L215, L181
+prn #119
+dec *r1
+clr r6
+bne *r1
+jmp L221
+lea L208, *r7
+L159: jsr L69
+inc L254
+L160: .data -851, -388, 729, 979, -23, -479
+red L249
+add *r3, r0
+prn L68
+mov #-32, L234
+not L32
+
+
+L161: .string "titiefs"
+L162: rts
+L163: jmp *r7
+jmp L203
+cmp L193, r1
+L164: .string "zriubkxqsdq"
+stop
+jsr L23
+L165: bne *r5
+not *r2
+L166: .data 864, -566, 626, -725, -353, -302
+; comment
+jsr *r0
+lea L253, r3
+lea L47, L210
+jmp *r5
+L167: .string "ljxsqpuvvslrew"
+add #-161, L221
+not *r3
+L168: dec r6
+L169: prn #-45
+not r4
+cmp *r7, L249
+clr L87
+add r2, r4
+L170: clr r0
+add #-102, *r0
+L171: .data -871, 767, 822
+sub #-95, r1
+L172: clr *r4
+red r6
+clr r6
+lea L80, L241
+L173: mov L217, r0
+add r4, *r2
+cmp r7, #-202
+not r1
+rts
+mov r5, r4
+L174: mov #-50, r7
+lea L221, L218
+lea L66, L179
+L175: .string "rtzgg"
+jmp L222
+cmp #-206, *r2
+inc r0
+not r2
+not r1
+jsr *r6
+bne *r7
+bne L184
+not r5
+mov L191, L216
+not *r5
+not r1
+prn L232
+; comment
+L176: prn L251
+L177: .string "wuiyclnqdcatscppkyvawiku"
+clr *r4
+stop
+red *r3
+red *r2
+not r3
+L178: red L36
+inc L91
+add #95, r0
+lea L153, r2
+mov #73, r5
+L179: jsr L18
+prn #150
+L180: clr *r7
+rts
+L181: .string "anwvubjcirw"
+L182: red r0
+inc r0
+red r3
+red *r6
+bne L238
+not L235
+cmp *r7, *r2
+jmp L196
+L183: .data 470, -33, 544
+; comment
+dec *r5
+L184: jsr *r0
+jmp *r3
+L185: .string "veqxxpimndywdiskgott"
+L186: inc *r3
+clr *r6
+red L243
+dec *r6
+stop
+dec r3
+stop
+L187: .string "u"
+jsr L141
+inc r3
+inc r0
+L188: not r6
+mov *r3, *r0
+L189: .data -279, -166
+L190: .string "yfs"
+red *r1
+L191: .data 612
+lea L205, *r1
+sub *r4, *r2
+rts
+lea L62, r2
+L192: .data 953, -385, -317, 905, -159, -865, 59
+lea L67, r2
+bne L52
+bne *r6
+L193: .data 13, 838, -616, -438, -315, -985
+L194: .string "wzchpup"
+lea L196, L243
+not *r5
+lea L92, r7
+L195: sub #-79, *r6
+jsr L139
+L196: rts
+dec r4
+jsr *r7
+inc L75
+clr *r3
+dec r3
+cmp L222, *r7
+L197: .data -70, 592, 995
+cmp #-211, #-189
+clr *r7
+clr r5
+L198: .data -944, 984, 828, -786, 883
+not *r7
+L199: jsr L256
+stop
+prn #138
+cmp *r2, #243
+inc r2
+clr r7
+red *r2
+L200: mov L25, r5
+jmp L249
+; comment
+dec r1
+dec L70
+lea L26, L252
+bne *r2
+inc *r0
+bne *r0
+L201: not r3
+L202: cmp r4, r0
+jsr *r3
+not L183
+lea L253, *r4
+L203: .string "dhvsr"
+mov #217, *r3
+red r5
+L204: jsr L100
+red L18
+L205: .string "aetqfrbeua"
+bne *r6
+lea L166, L176
+rts
+lea L228, r2
+jsr *r0
+sub r0, L236
+sub r2, L228
+add #-154, L219
+not L254
+mov r1, *r2
+sub L249, r7
+jsr L106
+jsr *r5
+rts
+rts
+inc r1
+dec r7
+
+jsr L35
+L206: add r2, *r3
+stop
+dec *r6
+L207: .data 683, 243, 804, -656, 865, -582, -441
+L208: clr *r1
+L209: prn r2
+bne L2
+L210: .string "jexizkwwgnuhp"
+L211: cmp L146, #-175
+dec *r4
+cmp *r6, L233
+jsr L96
+L212: clr r6
+stop
+L213: inc L217
+L214: stop
+red r4
+dec L242
+; comment
+mov *r7, L241
+L215: rts
+L216: .string "gftdtzrlxjagcgl"
+red r7
+inc r7
+sub r6, r7
+jsr L76
+dec *r6
+stop
+add #82, L238
+L217: .data 566, -930, -970, 380
+jsr L32
+sub #171, L111
+not *r5
+L218: .string "treqncogcgeibjk"
+jsr L69
+jmp L183
+L219: add r5, *r7
+L220: cmp *r3, r7
+sub *r1, r7
+stop
+L221: .data -460, -377, 777, -150, -377
+inc *r0
+L222: dec L2
+jsr *r7
+jsr L237
+mov *r0, *r7
+clr *r7
+mov r2, r7
+bne L231
+cmp L228, *r7
+L223: .data -257, -795, 421
+rts
+prn #179
+cmp *r5, L251
+red r4
+not *r5
+mov r3, r3
+dec L194
+rts
+; comment
+L224: not *r0
+inc r0
+dec r3
+lea L125, *r6
+clr *r0
+stop
+dec *r5
+lea L246, r5
+L225: lea L257, L239
+bne L108
+sub r2, *r2
+mov r7, *r6
+prn r5
+clr *r2
+not *r2
+bne L240
+bne *r0
+L226: jsr L227
+; comment
+sub *r7, L233
+cmp L200, #-254
+not *r4
+
+L227: .data -353, -572
+mov #-97, L97
+cmp #-182, r0
+
+lea L99, *r5
+jsr L254
+sub r6, *r2
+L228: .string "k"
+sub *r1, r2
+add r6, *r6
+jsr *r2
+L229: not r3
+L230: .string "uvmlndakb"
+clr *r2
+lea L254, L51
+
+dec L234
+; comment
+mov L191, r2
+prn L247
+not L194
+dec *r2
+L231: .string "coufc"
+sub #-214, r2
+cmp L30, *r0
+jsr L244
+bne *r5
+L232: .string "peldm"
+red *r1
+dec *r5
+jmp *r5
+L233: dec r2
+cmp *r6, #-131
+L234: jsr L241
+red r5
+mov r5, *r0
+inc *r5
+inc *r4
+red *r2
+L235: add *r7, *r1
+rts
+lea L247, L255
+not L220
+lea L121, *r2
+rts
+rts
+prn L97
+clr *r6
+L236: stop
+jsr L251
+L237: inc *r7
+L238: .string "bwcyj"
+L239: bne L82
+cmp r0, *r5
+inc r1
+bne *r6
+lea L241, r5
+cmp L248, *r2
+add r1, r6
+rts
+L240: .string "mwbou"
+inc r4
+L241: .data 322, 288, 86, 780
+L242: .string "rbaddwetvyvoxibjeyyl"
+inc *r4
+L243: rts
+L244: lea L106, *r0
+L245: jmp *r5
+prn L256
+prn *r1
+L246: .data -98, 930
+prn #9
+L247: red r6
+L248: .string "hyoonbdaxpaubgercafuxjkk"
+L249: not *r6
+
+sub *r3, L60
+inc L251
+inc L250
+L250: jmp L251
+bne L254
+not *r3
+mov *r3, *r7
+stop
+red L162
+L251: .data -747, 412, -616, 364, 366
+L252: .string "xpavskyx"
+jmp *r4
+add L255, r0
+not *r1
+add *r5, L257
+jsr *r2
+jmp *r0
+not *r5
+dec L256
+dec r5
+bne L253
+jsr L155
+L253: stop
+L254: cmp #131, #203
+dec *r2
+L255: sub L225, r1
+stop
+L256: prn #207
+dec r6
+L257: add L79, r2
+add *r6, r2
+stop
@@ -0,0 +1,1019 @@
+; Generated by genCorpus --seed 58
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+red r3
+L0: clr *r7
+rts
+rts
+mov #63, L256
+add #-151, L0
+L1: red r5
+red *r0
+L2: lea L89, *r4
+L3: rts
+bne *r5
+inc *r2
+L4: .data 651, -687, -72, 219, 797, -125
+mov #-198, L1
+; comment
+bne *r0
+L5: dec *r0
+stop
+L6: jmp L190
+sub L5, r4
+L7: .data 652, -777, 729, 398, -888, -169
+clr r4
+lea L45, r4
+add #240, L238
+not L7
+mov *r1, *r1
+L8: jmp *r5
+prn #-149
+L9: .string "iujusrjhzopfxhcroc"
+jmp L8
+
+dec r1
+bne L198
+dec *r6
+dec r4
+L10: .data -877, 954
+red L0
+L11: .string "qpbuqyndpqrhiaqssr"
+not *r1
+add *r2, L9
+not r4
+stop
+cmp #209, *r4
+prn #-153
+L12: prn L1
+L13: rts
+dec *r3
+L14: bne *r4
+mov *r4, r4
+rts
+red *r1
+inc r7
+L15: .string "bhxivoisoixyg"
+L16: dec L2
+; comment
+red L9
+lea L217, L65
+sub *r2, *r0
+dec L14
+stop
+L17: mov L6, *r0
+sub #-109, L106
+L18: dec r1
+dec *r6
+L19: .string "ljztxmfjdjkczxdx"
+L20: .string "xhacvlqijxdpwpyueb"
+L21: mov L152, *r6
+L22: stop
+jmp L11
+inc L255
+not r4
+inc L157
+inc L221
+jsr L137
+add r2, r4
+not *r7
+L23: .data 455, -534, 931, 45, 54, 19, 973, 107
+bne *r6
+L24: red *r4
+not L2
+bne L156
+not r2
+jsr *r2
+lea L9, L157
+red L123
+L25: sub #-105, r0
+cmp r7, L157
+jsr L8
+lea L40, r7
+; comment
+jsr L7
+L26: inc *r4
+stop
+cmp r1, #9
+L27: .data 466, -57, -198, 81, 627, -166
+L28: .data -298, 187, 698, 423, -440, -446, -174, 707
+sub r4, r0
+L29: dec r1
+stop
+L30: bne *r4
+; comment
+bne L152
+add *r4, *r2
+bne *r2
+jmp *r3
+jmp L121
+stop
+lea L8, L3
+add r2, *r3
+rts
+sub L30, r1
+bne L27
+L31: .data 800, -4, -988, -613
+not L62
+stop
+L32: stop
+bne L139
+L33: jsr L188
+red r1
+bne L4
+rts
+lea L11, r0
+red *r6
+prn L7
+sub r6, *r0
+jmp *r2
+L34: red L21
+
+red L18
+not *r1
+; comment
+prn L21
+L35: .data -442, 458, 215, 810, 577, -634
+bne L28
+lea L8, *r4
+not *r6
+L36: .data 779, -50, 503
+mov #-196, r2
+mov *r7, L210
+prn *r3
+lea L225, r0
+dec r2
+L37: jsr L214
+stop
+inc L75
+rts
+
+L38: .string "hamtmnvhfmarvgpwlbxil"
+bne L20
+add #188, *r0
+jsr *r0
+not r7
+jmp L8
+L39: red r1
+rts
+lea L8, r4
+L40: .string "xdszkmydssxynrnaiehovdw"
+red r0
+stop
+clr *r4
+L41: .string "nwxclwepgtdczrnpjvddbzc"
+stop
+L42: .data -125
+cmp L249, L80
+sub r5, *r7
+stop
+L43: .string "oulfokgcgpovys"
+L44: stop
+sub *r3, L4
+not r3
+jsr *r6
+L45: rts
+bne L33
+rts
+not *r1
+jmp L15
+inc *r1
+bne L28
+lea L17, *r3
+add r7, L10
+L46: .string "xmkargcfiggyry"
+jmp L206
+rts
+stop
+jmp *r5
+red r7
+L47: lea L61, L186
+clr L49
+L48: .data 582, 603, -990
+rts
+lea L38, L78
+jsr *r7
+L49: not *r1
+rts
+; comment
+L50: .string "gtsklljxin"
+jmp L46
+sub #216, *r7
+L51: .data 468, -649, -283
+cmp L5, L33
+cmp r0, r6
+; comment
+L52: add L49, *r3
+L53: .data -792, 457, 391, -789, -694, 834, 134
+lea L79, L36
+L54: dec L199
+L55: sub L51, *r3
+mov r2, L242
+clr L1
+bne *r2
+L56: clr L174
+jsr *r4
+clr *r0
+jsr L139
+
+L57: jmp *r1
+dec r2
+L58: bne L8
+dec L11
+add L151, L52
+prn L226
+lea L148, r7
+clr r4
+L59: .data -112, -859, 597, -564, -761, 341, -39, -12
+L60: .data -535, 207, -332, -479, 138, 448, -114, -593
+not r3
+lea L81, r3
+mov #-241, L29
+sub #-147, r4
+cmp *r1, *r7
+; comment
+inc L67
+lea L29, *r1
+cmp L89, L138
+clr r2
+L61: .data -148, -944, 940, 440, -250
+
+L62: inc r5
+L63: .data 484, 776
+inc r4
+sub #189, r5
+prn L37
+L64: .data -508, 890
+bne L63
+dec r5
+L65: bne L179
+L66: dec r1
+L67: stop
+red L23
+red r6
+L68: .string "rnhsabercsujucimvgtnug"
+sub #-81, r1
+inc r5
+jmp *r1
+L69: .data -389, -805, 113, -766, -941, -871, -700, 226
+sub r3, L25
+sub #-5, *r0
+jmp L121
+cmp L210, L144
+add *r5, r6
+L70: bne *r7
+L71: lea L59, L240
+inc *r0
+jmp *r0
+mov L46, *r4
+sub r5, *r7
+mov r5, r7
+bne L23
+clr *r1
+cmp r2, #120
+L72: rts
+jmp *r3
+sub L49, r6
+L73: lea L15, *r3
+; comment
+L74: not r1
+cmp #157, L56
+not r3
+cmp r4, r7
+L75: .data -145
+dec *r5
+add *r5, r4
+jmp L205
+red r0
+jmp L126
+L76: .string "kxrsjbqtylkfnfqtx"
+stop
+inc *r3
+lea L136, r2
+sub *r6, *r5
+rts
+L77: .data -727, 519, -315
+L78: .string "bhdbqdeljwxzhecwyaafc"
+jsr L21
+L79: mov r0, *r6
+red L55
+sub *r4, L29
+jsr L78
+inc L38
+red r5
+jsr *r4
+stop
+dec L78
+L80: sub r3, *r2
+L81: mov r7, *r5
+L82: .string "bssgtvfzdbiudjgvb"
+red r6
+not *r7
+jmp *r6
+
+jsr L59
+prn L17
+add L210, *r1
+not r4
+jmp L60
+rts
+prn *r7
+L83: .data 26, -674, 800
+clr *r0
+L84: not L115
+cmp L107, r7
+jmp L148
+lea L179, L3
+mov #175, L115
+inc *r4
+clr *r3
+cmp r7, #62
+prn *r1
+clr r2
+jsr *r2
+stop
+add L118, L180
+L85: lea L202, r6
+add r0, *r2
+add *r2, L122
+L86: rts
+L87: jsr *r1
+L88: prn #58
+lea L163, r3
+add *r1, r1
+clr L256
+inc r6
+clr *r5
+
+stop
+jmp *r6
+sub r0, *r0
+L89: .string "hlujbqjcbdi"
+stop
+clr L102
+L90: not *r2
+L91: .data -239, 493, -573, -950
+jsr L105
+mov *r2, *r4
+inc *r7
+dec r3
+rts
+add L22, r6
+dec L165
+prn *r6
+jsr L139
+L92: not r4
+; comment
+L93: .string "dqmqkagoinoswbn"
+jmp L188
+sub L190, L185
+inc L49
+mov L82, *r4
+L94: lea L58, r4
+not r0
+inc *r5
+cmp L185, *r3
+cmp #-126, *r0
+inc r7
+red *r7
+clr r1
+prn L259
+lea L46, r1
+dec L47
+
+L95: bne L24
+L96: .data -754, 992, -168
+jsr *r7
+L97: rts
+L98: sub L17, r3
+add L241, L18
+jmp *r1
+add L92, L39
+bne L155
+L99: .data 795, 947, -437
+lea L105, *r4
+jmp L253
+prn r4
+bne *r7
+stop
+sub L113, *r5
+L100: bne *r6
+add #186, L118
+not *r1
+not L32
+L101: bne L37
+add #-247, L20
+L102: clr L150
+stop
+red r4
+bne L109
+jsr *r1
+L103: .string "u"
+red *r7
+jsr *r1
+red *r6
+rts
+L104: .string "ri"
+dec L189
+L105: .string "svrqmz"
+add *r7, r3
+rts
+L106: lea L146, r7
+jmp L177
+L107: .string "ow"
+rts
+clr *r2
+jmp L101
+L108: red L59
+not r7
+L109: .data 794, -638, 382, -511, 339, 564
+clr *r4
+jmp L224
+jsr L131
+add L53, L202
+; comment
+cmp #103, L226
+L110: red *r4
+sub #130, L239
+rts
+L111: prn *r1
+lea L256, *r5
+not r0
+L112: stop
+dec L112
+prn #53
+; comment
+L113: .data 987, 585, -86
+jmp L154
+sub r6, L203
+L114: .data 541, 393, -517, -57
+stop
+red r5
+clr *r3
+jmp L81
+add #-99, L71
+inc r1
+jmp L140
+add L131, r1
+clr r6
+add *r2, *r2
+L115: dec r1
+jsr *r6
+jsr *r1
+L116: .string "nmjnqjklabwlfqsqxxmtuzj"
+L117: inc L107
+bne L32
+rts
+clr *r6
+cmp r7, L35
+jmp *r5
+L118: .string "qlvsgfgtdlsvc"
+stop
+jsr L214
+lea L144, r0
+sub *r6, *r7
+rts
+L119: .string "oezcwxskqgkpoxzrqfca"
+jmp *r1
+rts
+lea L161, r4
+L120: rts
+prn r4
+L121: .data -342, -950, 703, -957, -213
+
+add L150, L176
+clr *r0
+dec r0
+L122: clr L25
+not *r0
+mov L15, r4
+dec r7
+mov #-174, L170
+jmp *r4
+L123: lea L144, r1
+not r1
+lea L16, L176
+; comment
+jsr *r5
+L124: not *r2
+not r0
+rts
+L125: prn L39
+not r0
+rts
+bne L10
+jsr *r0
+L126: bne *r5
+stop
+stop
+L127: red *r6
+rts
+cmp L99, *r0
+L128: rts
+rts
+L129: .string "lrzwgabh"
+add *r6, L177
+not L88
+jsr L111
+clr L76
+bne *r6
+L130: cmp r7, #-170
+L131: .data -206, 14, 780, -958, -821, -249, -265, -910
+clr L50
+bne *r7
+
+lea L75, r2
+L132: sub L141, *r3
+clr r2
+L133: add r2, *r4
+stop
+jsr *r0
+L134: jsr L87
+jmp *r1
+jsr L121
+red r4
+rts
+clr *r2
+jsr L49
+prn *r4
+bne L244
+add L36, L3
+
+L135: lea L131, r2
+clr L2
+L136: rts
+mov *r0, L17
+jsr L188
+jsr *r3
+prn r5
+not *r7
+dec *r0
+clr r6
+lea L258, *r5
+L137: mov *r2, r0
+clr L64
+L138: add *r1, *r6
+
+cmp #-140, L151
+lea L58, r0
+mov *r7, r4
+clr L251
+dec *r3
+bne L173
+lea L25, *r4
+lea L86, L201
+clr *r2
+mov #-1, r6
+L139: jsr *r7
+dec L192
+L140: stop
+L141: red r0
+add *r2, r6
+L142: red L221
+jmp L230
+jsr L254
+bne *r4
+prn #251
+L143: add *r6, L75
+rts
+bne L167
+not r7
+jsr L245
+stop
+lea L227, r1
+mov L221, r4
+L144: jsr *r2
+inc r5
+; comment
+bne *r0
+add r3, r4
+L145: cmp r0, *r7
+
+clr L52
+prn #-213
+rts
+rts
+sub #-144, *r3
+clr r3
+L146: clr *r4
+rts
+L147: lea L99, *r5
+bne *r0
+prn #-243
+L148: not L61
+add *r0, r4
+mov L88, L246
+mov *r5, L75
+jmp L187
+add #113, L104
+dec *r7
+red *r5
+dec L142
+L149: .data 773, -190, -147
+stop
+jsr L59
+L150: rts
+L151: add L30, L236
+cmp #83, *r2
+clr L177
+jsr *r7
+L152: dec *r7
+prn #176
+dec L257
+jmp L32
+red L212
+add *r2, *r6
+L153: .data -620, 146, -282, -957, -558
+dec L66
+stop
+dec L114
+sub r2, r4
+jmp *r1
+
+L154: .data 995, 108, -120, 188, -649
+red L41
+L155: stop
+L156: .data -696, 934, -272, 82, -789
+sub #-159, *r4
+L157: cmp *r5, *r7
+add #-87, L91
+cmp *r4, *r3
+stop
+rts
+prn r5
+jmp *r3
+L158: .string "prxslabmdxwy"
+not L107
+L159: prn L95
+rts
+sub *r5, L231
+sub #-256, L161
+jsr L159
+inc L108
+dec r7
+dec r5
+; comment
+cmp #-243, #216
+sub #-132, L154
+L160: dec L117
+mov #29, r2
+jmp *r1
+L161: cmp #-14, #129
+L162: .string "mqwsktifjjwiiphgdv"
+L163: inc r4
+red *r3
+bne L16
+red *r0
+L164: cmp *r7, *r7
+stop
+mov #99, L78
+not r1
+inc r7
+L165: .string "lmkmjkymvtmbnwdqwgpi"
+L166: .data 765, 659
+L167: .data 703, 657, -949
+L168: jsr L260
+not r7
+L169: .data 234, 657, -36, -439, 710
+L170: rts
+L171: .string "xoonprayiejubhbsejzlm"
+L172: prn *r6
+lea L212, *r3
+inc L207
+bne L185
+clr L234
+bne *r5
+L173: bne *r2
+rts
+inc L217
+red L152
+prn *r0
+L174: stop
+jsr L213
+lea L212, L218
+L175: jsr *r7
+L176: prn r3
+L177: prn L232
+L178: .data -538, 789, -177
+L179: .data -318, -504
+clr r5
+add #223, L171
+sub r4, L181
+mov L140, L94
+
+prn #-107
+jmp L234
+jsr L232
+jmp *r5
+prn L25
+L180: stop
+L181: stop
+inc r3
+jsr L47
+stop
+dec r5
+L182: .string "vgwzdkjayegbg"
+jsr *r2
+inc *r4
+add r2, L239
+rts
+bne L200
+L183: red *r6
+jsr L211
+dec L186
+red *r7
+mov *r0, L68
+dec *r4
+stop
+cmp *r1, *r3
+sub L256, r5
+jsr L231
+jmp L248
+L184: cmp L199, L204
+prn *r4
+L185: .string "rfpbwbfmzj"
+stop
+sub #-191, L248
+L186: .data -32, 75, 14, 633, -271, 967
+L187: .data 260
+sub #-193, r7
+add *r1, *r3
+red *r5
+red *r4
+not L141
+stop
+dec *r4
+bne L23
+jmp L229
+dec r5
+cmp r2, #117
+bne *r1
+mov #-141, r6
+inc *r2
+add *r0, *r2
+L188: jsr L158
+cmp #231, L158
+L189: red *r6
+clr L198
+jsr L226
+lea L213, L39
+dec *r0
+L190: .string "fijh"
+inc L246
+L191: jsr L159
+L192: prn *r5
+dec *r5
+dec L259
+; comment
+add L195, L144
+L193: mov r1, L101
+clr r2
+L194: red *r2
+mov #-243, *r0
+rts
+lea L248, *r2
+add #233, r4
+L195: stop
+inc r7
+; comment
+L196: sub *r4, r7
+L197: .data -688, 348, -735, -260, -33, -216, 111, -455
+L198: jsr *r7
+L199: not *r3
+L200: jsr L207
+jsr L205
+cmp #-91, #-138
+L201: cmp *r2, r0
+jsr *r0
+inc L252
+
+prn r6
+jmp *r6
+red L34
+red r4
+L202: .data 906
+
+L203: .data 402, 449, -24, -259
+rts
+not r4
+bne *r0
+inc *r3
+stop
+red L231
+jsr L221
+add *r7, *r4
+mov *r1, *r7
+lea L260, r3
+L204: not L239
+clr *r2
+cmp #145, *r4
+; comment
+L205: .string "bpzzgawutjl"
+add L243, L218
+jsr *r6
+prn L98
+jmp L259
+L206: jsr L33
+inc L118
+lea L208, L30
+bne *r7
+not *r4
+prn *r1
+red r4
+inc *r0
+jmp L222
+red r2
+
+bne *r4
+sub #153, *r4
+L207: .data 345, -99, -690
+rts
+lea L112, L156
+add L218, L236
+jmp L28
+mov L6, *r6
+jmp L208
+L208: jmp L249
+clr L219
+L209: sub #90, r2
+L210: .data -807, -229, -532, -148
+jsr *r4
+L211: .data 434, 852, -348, -879, -665, 515, 562
+L212: .string "wzjaldwu"
+not r5
+
+L213: clr r5
+L214: red L3
+not *r1
+jmp *r2
+L215: jsr *r2
+mov r1, r0
+stop
+inc r2
+cmp *r0, L22
+red L229
+L216: .string "jm"
+L217: red *r5
+rts
+; comment
+L218: lea L255, *r1
+L219: .string "xwenc"
+prn L115
+sub *r6, r7
+L220: add *r1, r3
+red r4
+rts
+jmp *r7
+bne L214
+L221: inc r2
+
+sub #60, *r4
+; comment
+prn L35
+mov #-158, *r2
+sub L183, L98
+not r1
+jmp *r0
+jsr *r7
+
+lea L238, r1
+stop
+L222: jsr L233
+not L4
+not L35
+L223: .data -184, 41, 857, 174, 844, 823
+jsr L60
+L224: add *r6, r4
+not L131
+L225: bne L255
+clr L103
+lea L189, L255
+L226: bne *r4
+stop
+; comment
+dec *r5
+add #-42, L184
+dec L233
+mov r0, r6
+inc *r2
+L227: sub L249, L249
+jsr L81
+; comment
+stop
+L228: mov *r6, L255
+sub *r1, *r6
+lea L225, *r6
+prn L246
+red *r3
+not L259
+L229: .data 465, -717, 389, 549, 556, -594, 609
+L230: prn #-54
+add #111, r2
+L231: .string "ljs"
+prn r5
+mov *r1, *r0
+L232: lea L202, *r6
+add *r0, L39
+cmp *r3, #-227
+
+bne L245
+L233: add *r1, *r6
+
+clr *r7
+cmp *r0, *r1
+L234: .data -985, -350, 494, -668, 495, 26, -312, 796
+jsr L175
+lea L252, r0
+rts
+rts
+prn r1
+red r7
+L235: .data -948, 585
+L236: .data -341, 339, -683, -873, -267
+L237: cmp r6, *r3
+L238: add *r4, *r0
+L239: clr *r7
+L240: .string "ebkcbzrnkbzpp"
+L241: .data 682
+L242: dec r1
+red L158
+jmp *r0
+L243: rts
+clr L245
+red r7
+clr L261
+L244: .data 47
+add *r1, L252
+jsr *r4
+L245: jsr L246
+L246: .data -56, 657, 682
+L247: red L222
+L248: .data 774, -490, -714, 254, 380, -203, 484
+prn L249
+inc L251
+add r3, L169
+cmp r4, #231
+jsr L258
+L249: .string "tdvrwqdwle"
+L250: clr L212
+jmp L251
+L251: inc *r3
+not L50
+add L255, r4
+dec L6
+lea L256, L60
+red *r5
+cmp r3, #10
+L252: clr r4
+
+L253: .string "puotsbatnydbdbhpggnfaw"
+red *r0
+rts
+inc r6
+bne *r1
+clr L255
+L254: add r5, *r6
+mov L49, *r6
+stop
+mov *r7, L261
+L255: prn r0
+L256: rts
+L257: .data 161, -414, 446, 386, -381
+red *r2
+rts
+not r4
+dec r1
+sub #38, *r3
+clr L121
+dec r7
+L258: add L259, L261
+lea L220, r0
+L259: .data -526, 56, -579, 21
+lea L260, L261
+cmp #137, L201
+add *r3, *r4
+jsr *r3
+L260: clr *r0
+jmp L261
+dec *r5
+L261: mov r6, r5
+; comment
+dec L252
+mov *r2, r2
+lea L72, r5
+stop
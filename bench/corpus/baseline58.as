@@ -0,0 +1,1018 @@
+; Generated by genCorpus --seed 59
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+L0: lea L135, r6
+L1: dec *r3
+rts
+not *r6
+jmp *r1
+not L156
+jsr *r0
+L2: cmp #-23, r5
+inc *r3
+stop
+clr L0
+L3: cmp r1, *r0
+lea L146, *r0
+jmp *r2
+prn *r2
+jmp *r7
+bne *r7
+not *r6
+clr L1
+stop
+bne *r7
+L4: not r3
+
+jsr L3
+rts
+mov *r3, r2
+rts
+jsr L4
+L5: .data 74, -305, -455, 240
+red r4
+inc L3
+L6: red *r7
+L7: mov *r3, r2
+cmp *r7, L6
+stop
+lea L144, r1
+sub r5, *r6
+L8: .string "bijrasjbnvherrepscjlmzu"
+clr r7
+L9: not r2
+red *r2
+L10: red L0
+rts
+L11: prn r3
+add *r5, L4
+clr L145
+rts
+L12: jsr *r3
+red L251
+rts
+clr r3
+L13: rts
+L14: .string "szvul"
+not *r2
+
+mov r1, L227
+jmp L1
+inc L64
+L15: .string "lxkakmgokocjyszoa"
+jsr L237
+L16: .data -988, 150, 418, -262, -199, 472
+stop
+jsr *r4
+red L112
+bne L10
+jsr L66
+L17: jsr L6
+dec L169
+dec *r4
+cmp *r4, L16
+lea L13, L5
+mov L81, r6
+not *r4
+inc r6
+L18: sub r5, *r0
+add #-157, *r4
+rts
+add *r0, r2
+not L4
+L19: .string "gkcwyoolo"
+L20: .string "kmyhtfdtjqyflbeib"
+L21: .string "zzhmxplzovdccit"
+stop
+L22: add r4, r2
+L23: bne *r4
+lea L158, *r3
+; comment
+cmp *r7, r7
+add L168, r0
+prn r0
+L24: .data 407, -823, 288
+sub #143, r4
+inc *r6
+mov r1, *r1
+L25: sub #162, L219
+lea L213, *r5
+jsr *r4
+L26: .string "tndscwkurssfrthgzywvqvti"
+lea L17, L76
+not *r5
+stop
+stop
+L27: jsr L0
+jsr L16
+L28: clr r0
+bne L123
+dec r1
+cmp #-155, *r4
+L29: red L4
+mov #28, *r0
+jmp L193
+jsr *r4
+L30: .data 639, 12, 106, 680
+clr r0
+L31: .data -828, 94, -143
+not r5
+L32: .string "ucrqkvwdvvwhpdaeldq"
+jsr L92
+lea L97, *r0
+stop
+L33: red r3
+lea L229, L26
+not *r6
+
+; comment
+L34: .data -201, -19, -427, -493, 86, 468
+rts
+not L11
+clr *r6
+dec r2
+jsr *r5
+dec *r1
+L35: not L174
+L36: .string "dk"
+red *r5
+mov r2, r0
+clr L8
+cmp *r0, L20
+bne L250
+clr r5
+L37: clr L11
+not r6
+red L31
+rts
+L38: prn *r7
+L39: .string "wzghsquliypckqtrgiadre"
+add #-142, *r7
+add L100, r4
+L40: bne L5
+L41: jmp L24
+stop
+bne L128
+stop
+mov L24, r0
+not r5
+add L41, L117
+red r2
+not r6
+L42: .string "qspljwzkxfokc"
+rts
+dec *r5
+inc r4
+rts
+jsr *r2
+mov *r7, r7
+clr L2
+L43: not *r4
+L44: .data -196
+L45: mov r1, *r4
+L46: jsr *r3
+prn L31
+dec L188
+mov r1, L155
+dec *r2
+jsr L46
+L47: .string "xxzlnajeaeavjx"
+lea L19, r1
+L48: jmp L2
+red r6
+not L42
+L49: .string "wiiqsjeqzcwjoywcahdi"
+L50: inc r5
+clr r1
+dec r0
+; comment
+inc L13
+inc r0
+L51: .data 556, -877, -186, -625, 575, -979, -59, 10
+stop
+not *r7
+sub #-82, r3
+clr *r0
+L52: .data -924, 170, 361
+dec r0
+add *r7, *r6
+mov #53, r0
+L53: sub r5, *r7
+not *r1
+clr L203
+
+not *r2
+sub #-113, L12
+L54: .string "uinghvydhr"
+; comment
+bne *r4
+red *r2
+L55: rts
+jsr *r2
+not r2
+L56: .data 464, 708, -809
+L57: .data -732, 825, -355, 970, -227, 231
+jmp *r0
+bne L223
+
+mov r5, r7
+not *r7
+L58: bne *r7
+mov r4, *r0
+jsr *r6
+prn *r3
+mov #233, L7
+L59: jmp L218
+not L89
+stop
+L60: prn *r6
+L61: lea L168, r7
+dec L2
+cmp #-1, L38
+L62: .data 556, -250, 440, -415, 144, 568
+sub r2, r1
+; comment
+add #-173, *r0
+not r0
+add L97, r2
+lea L187, L49
+jsr L35
+jsr L232
+jmp *r5
+L63: inc r6
+stop
+L64: .data 343, -826, 608, 396
+L65: .data -666, -298
+red r6
+L66: .data -640, 178, -367
+L67: .string "fraftmwqzhjayrb"
+L68: .data -549, -11
+red r1
+cmp r0, L3
+; comment
+L69: cmp L104, *r7
+L70: clr *r4
+L71: .data 416, 13, -11, 534, -182, 618, 236
+L72: cmp #-20, *r7
+bne *r7
+red L145
+dec *r0
+prn *r1
+red L124
+jsr L245
+rts
+cmp #213, #-26
+prn r7
+jmp *r1
+L73: .data -426, 806, 575, -520, 274
+mov r4, *r4
+mov L59, *r6
+dec L252
+clr L4
+add r0, L3
+not *r7
+stop
+lea L34, *r0
+; comment
+inc L55
+L74: stop
+bne *r3
+jmp *r0
+L75: rts
+L76: prn #51
+inc r0
+sub r1, L43
+stop
+cmp L95, *r6
+L77: mov *r2, r3
+L78: jmp L255
+L79: .string "vmwfvsrzizbr"
+sub L120, r4
+L80: lea L205, L18
+L81: inc *r3
+mov L79, r5
+L82: inc *r0
+L83: lea L60, r4
+prn #-238
+bne *r7
+lea L208, *r4
+stop
+not *r4
+jsr *r3
+
+L84: stop
+L85: add *r2, *r5
+; comment
+inc r0
+cmp r7, L54
+prn #-201
+L86: bne *r1
+jsr L71
+add #162, r1
+mov #202, L86
+bne *r1
+rts
+not *r0
+L87: lea L110, *r5
+add #-9, r5
+; comment
+not L80
+not r2
+L88: stop
+L89: .string "daixfcpnttszhlydarjwhj"
+L90: bne *r6
+bne L206
+L91: not r2
+L92: mov L132, L131
+dec r5
+clr *r5
+cmp r0, r5
+add *r0, r5
+jmp *r1
+red r7
+dec r7
+lea L31, r2
+clr L130
+mov r3, r5
+L93: rts
+stop
+jsr L240
+jsr L43
+
+bne *r1
+not *r2
+L94: add r1, L176
+jsr *r2
+bne *r7
+cmp r3, #-236
+clr *r6
+L95: .string "rhvuczljowdopn"
+L96: jsr L241
+jmp *r5
+L97: .string "ayrmzvoa"
+sub L242, *r4
+add r5, r3
+L98: .data -835, -565, -926, 672, 155, 673, 654
+sub r4, L17
+rts
+cmp #149, L160
+L99: .string "hccotxnljrwhsjttnvkbwbvs"
+not r6
+jmp *r6
+clr *r2
+L100: bne *r4
+L101: .data -624, -287, 796, -899, 685, -638
+stop
+stop
+sub r0, L142
+L102: .data 539, 504, 778, -814, 411, -780, -691, -137
+not L34
+jsr L83
+prn #-223
+L103: .data 482, -482, -926
+
+lea L92, L42
+lea L213, *r4
+red r5
+red r0
+L104: lea L253, L175
+; comment
+dec *r4
+L105: red L76
+not L14
+L106: .data -170, 814, -343, -80, -83
+sub *r7, *r5
+L107: jsr *r7
+prn *r3
+prn #200
+red *r3
+add r4, L238
+L108: mov L59, r4
+not *r2
+lea L98, L23
+lea L253, r0
+jmp L0
+red L223
+L109: .string "to"
+L110: .string "rnxexmjuoe"
+L111: red r5
+lea L151, r0
+rts
+L112: stop
+L113: red r7
+L114: .string "wsdkdwmeqwrnjmwyvb"
+sub *r6, L0
+L115: jmp *r3
+jsr *r0
+inc r2
+bne *r5
+L116: rts
+red L73
+L117: .data 646, -773, 763, 299
+lea L105, *r0
+L118: dec *r0
+cmp L103, L211
+clr *r5
+inc *r6
+add r4, r4
+L119: .string "mpptjkkklbxatjirbw"
+inc L238
+red r7
+L120: rts
+stop
+prn *r5
+; comment
+clr r0
+clr L82
+L121: jmp *r1
+jmp *r2
+L122: .string "ahcqvx"
+L123: .data 611, 795
+L124: .data 407, -765, 384, -559, 922
+jmp *r3
+prn #-228
+not L215
+L125: .data 292, 928, -911, 13, 63, -543
+bne L187
+dec L212
+add *r2, *r6
+inc L163
+red L107
+inc *r5
+clr L126
+jmp *r5
+mov #-233, L94
+clr r6
+rts
+bne *r4
+dec *r6
+prn #-36
+lea L9, *r6
+dec *r5
+rts
+clr *r4
+add #80, *r7
+L126: inc r6
+jsr *r7
+dec *r7
+bne *r4
+stop
+dec L196
+not r0
+rts
+inc r7
+L127: inc r2
+L128: inc L50
+L129: jsr *r7
+cmp L54, L41
+rts
+red r4
+L130: dec L203
+red L209
+clr r3
+dec L116
+cmp r4, L74
+L131: .string "pjrrmrilvpnclvvexhkpykgp"
+; comment
+L132: .string "obryszteqivnpget"
+add r7, L113
+L133: .data -347, -783, -367, 738, -415
+L134: .data 328, -408
+
+jmp L129
+rts
+L135: mov r3, L133
+sub L224, *r1
+jmp L171
+dec *r7
+bne *r7
+prn #-180
+add r0, *r4
+rts
+; comment
+bne L10
+stop
+stop
+L136: prn #74
+mov #115, r7
+inc L185
+cmp #-2, *r5
+L137: .string "exwvnxqbapsqxynnnwzmku"
+red r4
+sub L212, L183
+mov *r4, L49
+inc r0
+jmp L141
+; comment
+add #17, r7
+clr L63
+
+cmp *r3, *r6
+L138: .string "qebucxkdldmdffhxwscgsys"
+; comment
+red *r7
+L139: .string "auarcbjmduironr"
+red L223
+sub r2, L123
+L140: .string "nssrqkstymykrralb"
+L141: jmp L114
+L142: .string "sisjzvwof"
+red r2
+stop
+clr r6
+
+mov *r2, L133
+stop
+stop
+lea L213, r3
+inc r6
+L143: jmp L178
+L144: .string "nslqivro"
+L145: .string "zzxgvcsfti"
+sub L200, r6
+L146: .string "nmiiqryshixccmngyvu"
+L147: .string "nxcyacwvwrjhubcjugdlsg"
+L148: lea L165, L219
+sub L42, r4
+L149: dec *r7
+red *r0
+bne L180
+dec r2
+rts
+L150: not r7
+stop
+L151: lea L79, L66
+stop
+jsr *r0
+stop
+bne *r1
+sub r0, L9
+red L204
+L152: inc L146
+add L155, r6
+jmp *r7
+clr r6
+L153: .string "xuvdgjlelcjkkcansrwg"
+cmp L27, *r3
+jmp *r7
+prn r5
+dec L103
+L154: add L146, L198
+stop
+jmp L249
+jsr L191
+prn #-110
+red *r7
+dec L183
+jmp L186
+stop
+red L159
+; comment
+L155: not *r4
+L156: jmp L217
+dec r7
+rts
+L157: .string "cnurzwpbnahwkoocu"
+lea L14, r2
+sub #-114, r6
+rts
+L158: stop
+L159: jmp *r7
+jmp *r7
+jmp L229
+stop
+mov L86, *r1
+red *r0
+lea L248, L56
+mov L106, L180
+lea L78, L157
+not *r6
+L160: add *r6, *r4
+not r3
+jsr *r7
+L161: rts
+bne *r6
+L162: rts
+prn L182
+clr *r1
+L163: dec *r0
+mov #-112, r2
+cmp *r2, L199
+lea L115, *r6
+red r2
+not L234
+lea L17, *r2
+sub L65, *r1
+L164: clr L151
+red *r1
+inc L245
+L165: .string "bcuhrdbbrpcsxfuv"
+red L50
+jmp *r3
+clr *r4
+rts
+inc L140
+clr r4
+jmp L198
+jsr L224
+cmp *r5, *r1
+red r1
+lea L208, L57
+L166: .string "jiohxr"
+rts
+stop
+L167: dec L10
+stop
+mov r2, L146
+L168: .data 39, 757, 650, -768, -464, -336, -977, 273
+clr r7
+prn L141
+; comment
+
+L169: .data -857, -905, -495, 448, 644, 233, 619
+jsr L88
+lea L253, r4
+L170: .string "mgreiygnemc"
+dec r0
+red L81
+stop
+dec r7
+prn #-160
+L171: lea L185, *r6
+bne L64
+mov *r2, *r7
+jmp L21
+jsr L83
+bne *r3
+L172: stop
+L173: mov L183, r4
+dec L77
+dec *r6
+jsr *r4
+dec L102
+clr r5
+lea L252, r1
+add r4, L52
+bne *r7
+not *r7
+L174: lea L196, r1
+not r3
+lea L193, L205
+inc r2
+dec *r0
+bne *r3
+prn #211
+lea L80, L10
+stop
+jsr *r3
+not *r2
+inc *r1
+
+L175: add #221, *r7
+cmp r3, *r1
+dec *r1
+stop
+sub L87, L210
+rts
+dec L11
+mov *r5, r7
+add L134, L212
+sub r6, r6
+stop
+sub *r1, r6
+stop
+; comment
+L176: add r0, *r5
+sub r1, L158
+
+red *r4
+L177: bne L141
+L178: add r5, L92
+jmp L251
+L179: .data 291, 413, -618, -955, -913, -905, 343
+dec L227
+add *r0, L162
+rts
+mov L219, L92
+cmp r1, L31
+L180: .string "hhdtgoqabhpdyh"
+inc L74
+dec L117
+jmp L247
+red L149
+
+not L215
+red L247
+prn *r1
+sub L103, *r7
+dec r5
+jmp *r2
+mov #-220, L6
+L181: dec r3
+L182: rts
+mov #12, L99
+prn r6
+dec r2
+rts
+bne *r2
+L183: .string "zshkkyuzicnbofqzua"
+L184: add #184, *r5
+L185: stop
+L186: bne L42
+lea L226, L110
+inc *r5
+lea L191, L214
+stop
+clr L255
+L187: jsr L210
+jsr *r5
+bne *r4
+cmp *r3, L219
+clr L242
+red L228
+dec *r6
+inc r4
+prn r5
+L188: prn #-21
+
+mov #-200, *r1
+L189: dec r6
+rts
+prn r0
+red L228
+dec r5
+jmp L248
+bne L170
+L190: .string "tukhmkwobfhyt"
+not r4
+lea L214, L234
+L191: jmp *r3
+inc L213
+lea L202, r7
+mov #-47, L90
+stop
+L192: not L217
+bne L47
+L193: not r4
+lea L226, *r0
+jsr *r7
+dec *r4
+jmp L229
+lea L220, *r0
+prn *r1
+bne *r2
+sub L127, r1
+L194: .data -26, -790, 639, -542, -330
+cmp L249, *r7
+inc L253
+; comment
+cmp L26, *r3
+sub L208, r3
+cmp L110, r3
+inc *r4
+L195: cmp #208, L130
+stop
+red L187
+dec *r7
+cmp *r0, *r4
+inc r5
+L196: jsr *r6
+L197: .data 353, -92, -970, 999, -618
+lea L65, L200
+rts
+
+sub L67, *r5
+bne *r7
+not *r3
+L198: .string "grxkmq"
+add #69, r1
+mov #23, r3
+sub r0, L72
+
+clr *r2
+
+not *r4
+lea L0, r1
+prn *r1
+L199: .string "x"
+L200: .string "xkuqlvvmwdposiahedtd"
+dec L80
+L201: .string "sbytpdebygfasxcuverfw"
+clr L252
+dec L246
+
+
+stop
+L202: clr r5
+L203: sub *r6, r0
+bne L233
+add r1, L185
+L204: inc *r7
+jmp *r2
+mov #167, *r2
+L205: rts
+
+bne *r2
+add #169, L208
+L206: bne L223
+add L126, r5
+mov #-209, r5
+add L205, *r6
+jsr *r0
+prn *r4
+red *r0
+dec L142
+clr L238
+mov #-162, r5
+jsr L24
+mov r7, r3
+L207: cmp r2, L219
+L208: .data 623, 412, -45, 823
+not *r0
+L209: dec r4
+red *r0
+dec L10
+inc L47
+jsr L225
+jsr *r5
+prn r5
+add *r4, L238
+clr r3
+red L12
+lea L224, r7
+L210: sub #128, r0
+lea L218, r5
+bne L237
+sub *r0, *r1
+clr L239
+cmp *r5, r0
+not *r7
+cmp L228, r5
+L211: cmp L112, #163
+jmp *r4
+bne L215
+lea L228, r6
+; comment
+inc L124
+mov r5, r2
+clr L98
+clr L226
+L212: cmp *r0, r6
+L213: not L187
+bne L237
+L214: .string "hqowpxvpf"
+L215: .string "hcutyhulikgnzpfgn"
+dec r2
+stop
+lea L244, r7
+L216: sub #48, *r1
+sub r0, r6
+dec *r5
+mov r5, r6
+L217: inc *r4
+L218: .data 713, 99
+L219: .string "xkxrhm"
+inc r6
+inc L223
+L220: .data -717, 524, 351, -192, 600, 152, -180
+bne *r5
+prn *r4
+L221: bne *r7
+L222: jmp *r2
+rts
+; comment
+prn L234
+stop
+L223: .string "yhacpzipaxaerhysz"
+jsr L124
+stop
+inc r3
+sub #61, r4
+L224: .data -615, 801, 372
+L225: bne L249
+L226: .string "ihsbedqgrwabwnligctgafsf"
+jsr *r5
+stop
+prn L231
+jsr *r6
+L227: cmp #-71, #156
+cmp r5, #-236
+jmp L61
+stop
+L228: .string "cfilsaldakqgskbgzzphval"
+lea L76, L234
+add *r0, L236
+dec L250
+inc L242
+jsr L245
+jsr *r3
+; comment
+jmp *r3
+clr r6
+jmp *r0
+jsr *r5
+rts
+L229: .string "delgglbbopfn"
+jsr L24
+L230: .string "felftqifoqbcj"
+lea L27, r7
+L231: .data -850, -450, -854, -543, -110, -24, 995, -893
+L232: sub #-189, *r3
+add r6, r3
+add *r0, r3
+red *r6
+mov #55, r6
+inc L242
+L233: bne L136
+sub *r3, L251
+bne *r4
+L234: bne *r0
+clr *r1
+L235: add L246, *r0
+L236: prn *r6
+rts
+cmp L249, #-79
+inc r2
+clr L108
+clr *r5
+mov #-53, r4
+dec r1
+jmp *r4
+prn r0
+dec *r5
+L237: stop
+L238: .string "mvaviizpth"
+rts
+mov *r6, r5
+mov r4, r5
+not r6
+lea L245, L250
+red L165
+L239: .data -298, 325
+L240: add #-48, *r4
+L241: lea L248, *r0
+sub r2, r1
+L242: .data 14, -127, 77, 614, -269, -348, 227
+lea L42, *r1
+prn #236
+stop
+jsr *r4
+stop
+L243: .data -502, -843, -859, -312
+L244: mov #175, *r7
+jsr L247
+rts
+jsr L252
+cmp r1, *r1
+inc *r2
+red L254
+rts
+rts
+jmp L151
+jsr *r2
+L245: mov L78, L251
+L246: jmp L247
+jmp L251
+inc L48
+L247: .string "etuiwtnbq"
+L248: .string "ep"
+mov *r3, L253
+L249: mov r3, r7
+stop
+cmp r6, #-74
+L250: lea L254, r2
+rts
+dec r0
+clr r6
+rts
+L251: red r5
+lea L252, L254
+prn #55
+cmp r4, *r7
+sub L48, r4
+lea L254, *r3
+mov *r7, r3
+L252: .data 223
+sub *r2, L81
+L253: .string "mowr"
+L254: jsr L255
+
+L255: sub #194, L172
+jsr L91
+dec *r4
+mov *r4, L143
+stop
@@ -0,0 +1,1020 @@
+; Generated by genCorpus --seed 60
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+L0: lea L0, L0
+add #129, L163
+sub r3, *r2
+L1: clr L0
+add L238, r2
+L2: cmp #-10, *r5
+lea L2, L250
+cmp *r3, L1
+; comment
+bne L2
+jsr L254
+
+L3: stop
+mov L218, r2
+jsr *r4
+L4: .data -978
+sub #-11, L2
+prn r5
+L5: sub #-81, L74
+L6: .string "obqpnqybfrfvdcvj"
+rts
+dec L4
+sub #-223, L69
+L7: cmp #-43, *r4
+L8: red L3
+prn *r4
+L9: lea L6, *r2
+not L1
+L10: .string "pxiibsblgx"
+L11: .string "mqqknudo"
+lea L10, r6
+clr r3
+clr L129
+lea L145, *r4
+not *r6
+; comment
+L12: .data 799, 160
+jsr L85
+mov #-83, r1
+L13: bne L174
+; comment
+jsr L12
+not *r5
+jsr *r2
+inc r4
+L14: cmp #120, L28
+lea L11, r3
+L15: .string "hlkxk"
+dec r2
+
+L16: .string "hgkrmdxqsrakkbkvub"
+prn #143
+L17: .string "bge"
+inc L15
+L18: .string "gsptckathbqatjypys"
+inc L247
+bne *r1
+dec *r3
+jmp *r5
+; comment
+dec *r6
+L19: .string "wgekwtftmefnskjuaznz"
+dec L98
+red r3
+rts
+L20: jmp *r6
+L21: dec r2
+prn *r3
+jsr L14
+L22: not *r2
+mov L20, r0
+jsr L157
+rts
+L23: .string "tqkfxdzadu"
+L24: not L8
+rts
+cmp *r1, #-167
+inc L24
+inc L34
+not *r3
+L25: not *r1
+rts
+L26: clr *r4
+; comment
+jsr *r1
+jmp *r1
+lea L257, *r2
+L27: mov r6, r4
+prn L23
+red L19
+bne L27
+not *r1
+L28: .string "dguzbtejfkhsepbhjtopzk"
+L29: jsr *r0
+dec L11
+add *r3, *r5
+cmp r0, r6
+L30: prn L21
+stop
+L31: .string "kifffusxdodb"
+not *r6
+mov r5, L5
+cmp L5, L138
+cmp *r7, r0
+L32: stop
+cmp #219, L48
+stop
+lea L173, *r0
+L33: .string "ticeyyukdfpvqigluibybhfu"
+; comment
+sub r3, *r7
+bne L78
+cmp *r4, #-69
+rts
+lea L29, L179
+sub L92, L230
+add #-37, *r3
+rts
+mov #54, L248
+lea L138, r6
+dec r6
+L34: .string "jnkxahe"
+cmp r1, #24
+add L33, r3
+L35: mov *r6, *r5
+L36: lea L16, *r7
+add r5, L34
+add *r4, L5
+cmp r6, #-185
+L37: red *r7
+dec L74
+jsr L3
+inc *r2
+
+clr *r6
+jsr L215
+clr *r6
+lea L7, L37
+clr L25
+red *r2
+jsr L9
+inc r3
+clr r5
+clr *r4
+L38: .data 708, 488, -61, 930
+not r7
+not r3
+add r5, r7
+L39: .string "dgzcgxqbuasvjtqkoqlf"
+L40: lea L1, r4
+jsr *r0
+
+; comment
+inc *r5
+add L27, r4
+sub *r3, L171
+cmp r6, #-194
+mov #-30, *r2
+clr r3
+prn #-96
+L41: add *r3, *r1
+red L35
+stop
+mov L15, *r3
+red *r0
+stop
+add r3, *r6
+rts
+add L261, L211
+L42: .data -144, -799, -360
+clr *r3
+prn *r1
+dec r3
+not *r3
+L43: stop
+rts
+stop
+cmp *r2, *r3
+red r4
+stop
+rts
+prn #114
+dec L1
+L44: .string "ipx"
+L45: mov *r6, r2
+inc r1
+L46: .string "wfdzvjm"
+prn L28
+L47: red L3
+inc *r1
+stop
+not *r0
+bne *r0
+; comment
+inc *r7
+bne L203
+L48: .string "bjpwlzkpeaycuduudqdoypy"
+L49: sub *r6, r2
+rts
+L50: .data 614, -941, 443, -940, -649, 289, -374
+dec r5
+L51: .string "jg"
+clr r1
+prn #233
+
+L52: .string "stoeihaa"
+clr *r1
+bne *r6
+cmp r0, r7
+inc r3
+
+bne *r2
+prn L103
+L53: stop
+inc r1
+stop
+prn *r1
+inc *r1
+clr *r5
+L54: inc *r0
+mov *r5, *r0
+; comment
+prn #-210
+L55: .string "pzdkeskkdyjwpojiwrnihcs"
+L56: .data 555, 937
+mov #222, *r3
+L57: inc L178
+jmp L11
+add L25, L274
+jsr *r3
+L58: jmp L47
+add r6, L110
+bne *r1
+sub L34, *r5
+L59: .data 941, -263, 576, 528, 270, 247, -958
+jsr L216
+lea L40, r5
+rts
+not L207
+L60: bne L6
+red *r5
+jmp L31
+jsr L219
+stop
+mov r0, *r5
+L61: bne L191
+not L49
+sub #-115, L235
+L62: .data -125
+not L109
+prn #-182
+stop
+add #249, L62
+add L56, r2
+inc L170
+red *r2
+jsr *r5
+inc *r5
+not *r4
+sub *r6, r2
+red r6
+red r3
+lea L34, r3
+L63: bne L30
+
+lea L48, L26
+
+L64: sub #158, *r3
+add L25, L47
+rts
+red *r5
+rts
+red r4
+jsr *r5
+L65: rts
+red r4
+L66: lea L23, *r3
+L67: sub #113, L27
+L68: red L169
+; comment
+not *r2
+add r5, *r3
+jmp *r3
+
+L69: .data 171
+L70: mov *r2, *r5
+sub #182, *r5
+prn r1
+L71: add L66, r7
+rts
+jmp *r5
+jmp L12
+L72: clr L31
+L73: .string "idshyntewmadixfmubsshoj"
+red L271
+jsr *r5
+jmp *r4
+red *r6
+stop
+jmp *r7
+inc r3
+jmp L64
+add #-242, L31
+not r0
+L74: dec r0
+sub r4, r4
+L75: .string "rxvfsqifquqar"
+L76: .string "peivjazyn"
+stop
+jsr L0
+L77: bne *r3
+L78: stop
+rts
+mov #-193, *r0
+clr L194
+lea L1, *r0
+L79: rts
+cmp *r6, #139
+rts
+not L11
+L80: inc L0
+L81: .data 759, 307, -655, 254, -551, 957, 970
+stop
+prn #71
+rts
+prn *r1
+L82: bne L84
+L83: .string "tjbxbbyw"
+stop
+sub *r5, L43
+jsr *r2
+add L268, *r2
+L84: clr *r4
+clr *r6
+L85: not r7
+L86: stop
+L87: .data 910
+cmp #-176, L250
+bne L154
+lea L89, L40
+L88: dec *r5
+
+L89: sub r7, *r4
+jsr L244
+add L234, *r0
+not *r4
+
+bne L30
+add L85, r4
+L90: rts
+stop
+prn L195
+inc L234
+add r6, *r6
+L91: cmp r6, *r4
+clr L86
+bne L87
+jmp L266
+prn *r0
+rts
+clr L116
+red r6
+not *r0
+; comment
+; comment
+sub *r0, L117
+clr *r7
+dec *r1
+mov #94, *r0
+L92: not L20
+L93: .data 872, -323, -430, 903, -191
+jsr L226
+L94: add #-65, L6
+sub #70, *r1
+add r0, L166
+sub L171, *r7
+jsr *r2
+
+rts
+add L120, r5
+cmp L261, *r4
+L95: prn r1
+lea L11, *r0
+rts
+add *r5, L66
+add #-70, L69
+lea L184, L50
+lea L81, *r4
+prn L20
+red L220
+inc *r1
+prn *r7
+jmp *r4
+L96: dec L49
+red r1
+sub r1, r3
+lea L51, *r3
+dec r0
+L97: mov r1, r1
+lea L219, *r2
+dec *r3
+add L52, r6
+bne L91
+lea L69, r3
+L98: mov *r3, *r2
+L99: prn r4
+L100: bne *r4
+L101: rts
+sub L12, r1
+jmp *r2
+L102: .string "eiihxojns"
+L103: .data 105, -511, -163, 611, 124
+L104: stop
+L105: .string "ogerabhic"
+dec r6
+bne *r3
+dec L237
+dec r7
+lea L102, r7
+not L42
+L106: .string "j"
+jsr *r7
+dec r4
+stop
+rts
+prn *r1
+L107: jsr L102
+not r6
+L108: .string "yxidlgxah"
+dec *r0
+add #-132, L121
+clr r7
+red r7
+L109: .string "aogzfpctjnjv"
+L110: bne L17
+jmp *r4
+L111: red *r4
+L112: .data 636, 284, 871
+L113: cmp *r3, L157
+sub r5, r1
+L114: .string "dmcuriwertvkgl"
+L115: .string "gwgggworzzvry"
+stop
+prn L15
+not r6
+not *r1
+lea L228, *r4
+sub *r4, r0
+prn r6
+L116: mov *r1, r2
+rts
+L117: .string "zespibykb"
+jsr *r0
+clr r5
+L118: .string "oqblhjqhwfhhlcxobtbfvkk"
+red r7
+sub L56, r3
+L119: prn *r5
+red *r0
+L120: lea L164, L213
+lea L147, *r3
+inc *r3
+L121: bne *r0
+red *r6
+L122: prn *r6
+red *r2
+cmp L175, *r4
+L123: .string "lolhvfrffuushlbzj"
+stop
+jsr *r1
+bne L127
+red r6
+cmp *r1, r0
+lea L77, r5
+L124: .string "sdeqqbo"
+prn *r4
+jmp *r3
+L125: clr r4
+jsr L29
+cmp r3, r3
+L126: red *r2
+not *r3
+not r0
+sub L169, L169
+inc r1
+clr r1
+sub r0, L56
+; comment
+sub *r5, L16
+L127: stop
+red r2
+rts
+sub r4, L240
+red *r6
+rts
+not L40
+L128: .data 373, 932, -978, 454, 661
+rts
+dec r2
+
+L129: cmp *r1, *r1
+L130: .data 689, -556, 964, 662, 440, -219, 286
+prn L112
+L131: inc *r5
+rts
+jsr *r4
+prn #-192
+rts
+rts
+rts
+stop
+add *r5, r4
+L132: .string "nsfgmlb"
+red r5
+L133: .string "sxdqve"
+bne L69
+L134: .data -306, 492, 592
+L135: .string "cvntznki"
+L136: .data 772, -892, 286, 79, -23, 998
+bne L11
+inc r3
+stop
+jmp *r7
+L137: inc r3
+L138: .data -583, -17, 982, -108, -850, -306, -909, -69
+dec *r3
+L139: add *r0, *r1
+L140: not r5
+mov #242, L241
+jmp *r0
+lea L45, L74
+add #-26, *r6
+L141: stop
+rts
+dec L132
+rts
+L142: .data 9, -1000, 974
+rts
+inc r7
+red L22
+cmp #80, #-99
+red L45
+L143: jsr L260
+L144: dec r2
+stop
+bne *r3
+bne *r3
+red r6
+red L153
+clr *r5
+add *r2, L42
+L145: .data 742, 297, -99, -384, -457, -639, 717, 94
+L146: .data 886, -615, -733, -59, -590, -717
+not L34
+
+L147: .data 826, 444, 529, 923, 921, 275, -746, 82
+stop
+L148: .data 89, 886, 868, -565, 575, 629, -10, 408
+add #-245, *r6
+prn *r2
+L149: .data -383, 228
+jmp *r3
+bne *r6
+mov *r4, *r7
+L150: stop
+clr r1
+cmp *r3, L65
+not *r7
+clr L251
+stop
+cmp #-242, *r1
+inc r2
+add *r1, L244
+L151: lea L99, r5
+prn #-158
+rts
+L152: inc *r7
+jmp L136
+prn r2
+L153: sub L209, *r7
+sub #-68, r7
+cmp #-223, #-41
+lea L38, r1
+red L51
+L154: prn *r5
+clr *r7
+clr r6
+rts
+rts
+not r6
+L155: clr *r2
+L156: mov #120, r4
+
+clr L257
+inc r6
+sub r5, *r4
+L157: lea L94, *r4
+stop
+not r6
+L158: .data -138, 252, -469, -993, -518, 515, -267, -400
+
+lea L208, r7
+L159: .data -807, 812
+jsr *r2
+jmp *r5
+L160: red *r4
+add *r2, *r5
+add r7, r3
+jmp L84
+dec *r7
+L161: jmp L220
+L162: bne *r7
+inc *r4
+
+dec r1
+L163: .string "bqvpaixonabrk"
+clr r4
+jmp L258
+mov *r3, r4
+dec L123
+
+L164: clr *r1
+cmp #7, *r7
+red L261
+not *r6
+L165: rts
+not r4
+add #23, r6
+sub r7, r0
+inc *r5
+L166: .data 852, -259, 275, 541, 804, -969, -113, 441
+jmp L47
+clr *r2
+not *r0
+jsr L270
+cmp L65, L91
+L167: .data 273, -307, 621, -236
+jmp L272
+lea L198, L53
+L168: .data -887
+L169: red *r6
+cmp r3, *r5
+L170: jmp *r5
+L171: .string "xqsim"
+rts
+lea L111, r6
+inc r5
+jmp L173
+stop
+rts
+not r5
+L172: .string "hibgkjnax"
+L173: .data 322
+L174: not L197
+L175: .string "vwdyztjcqjxaft"
+cmp #-177, L26
+jsr *r5
+L176: stop
+lea L260, r7
+dec L6
+jsr *r2
+L177: .string "mxxjky"
+sub L228, L188
+L178: .string "nzhyfeypclov"
+stop
+stop
+stop
+cmp L225, #-202
+jsr L162
+; comment
+inc L259
+L179: .string "admammtpxyvciuulzzgzmm"
+; comment
+L180: .data -353
+L181: inc r6
+dec r7
+L182: .string "g"
+red *r7
+not *r0
+L183: bne *r0
+add *r6, r4
+dec r2
+L184: .data 868, 262
+jsr *r5
+sub r7, *r2
+L185: lea L224, *r7
+L186: jmp L247
+clr r5
+not *r1
+stop
+L187: rts
+L188: jsr L14
+add *r6, *r0
+L189: jsr L206
+prn *r7
+L190: .string "gmdiwyrlmjanfardryapigoo"
+jsr L166
+stop
+jmp *r4
+jmp L204
+rts
+L191: lea L40, L175
+sub r3, *r5
+jmp L214
+inc r5
+jmp L198
+sub #168, r5
+mov r5, *r3
+not *r1
+lea L38, r4
+L192: .data 840, -640, -125
+stop
+L193: inc *r7
+bne L77
+L194: dec r6
+L195: .string "amxzfciyzvrnbtkgwrjeiewj"
+; comment
+rts
+L196: red L32
+L197: clr *r3
+rts
+clr *r2
+L198: mov L34, *r2
+red r4
+dec r0
+L199: prn #-116
+stop
+add *r5, L252
+L200: .data -604, 663, 396, 843, -401, -978, 337
+bne L143
+clr L78
+dec L227
+lea L261, L24
+sub *r1, *r1
+stop
+red *r6
+red r1
+L201: .data -649, 126, 888, -883
+bne *r0
+L202: .data -922, 468
+clr r2
+jsr *r7
+cmp #245, L245
+jmp *r1
+cmp L221, L246
+L203: sub *r1, r3
+clr r6
+L204: jsr *r2
+jsr L64
+jmp L255
+
+jmp L55
+sub *r0, L191
+red *r1
+rts
+stop
+L205: .data 606, -379, 220, 434
+sub L54, L80
+L206: red L229
+not L209
+inc *r4
+L207: jmp *r7
+lea L104, *r4
+L208: mov L103, r2
+not r6
+inc L213
+stop
+prn r2
+L209: bne *r3
+L210: .string "ltufisrbuz"
+L211: sub #201, r2
+L212: inc L214
+prn L232
+clr L245
+L213: bne *r3
+rts
+jsr *r3
+lea L241, *r1
+inc L216
+L214: bne L259
+mov r6, r4
+red r4
+L215: clr L252
+jmp *r2
+L216: clr *r7
+mov *r4, r7
+lea L255, *r1
+L217: .data -82
+L218: .string "mzligiqhjkstxqpess"
+cmp *r1, #4
+bne *r1
+stop
+L219: .string "amfzwmatgzlpsq"
+L220: jsr *r1
+L221: stop
+stop
+L222: red r6
+not L206
+L223: .data 740, -512, -904, -901, -261
+sub r4, L250
+cmp *r7, #-210
+jmp *r5
+L224: .data 448, 886, 690, 319, -296
+red r5
+L225: not *r7
+red r3
+mov #198, L249
+L226: .data 862, 910, -261
+dec L235
+L227: inc r5
+L228: jmp L205
+L229: .data 957, 333, -712, -308, -491, 525, 633, 505
+lea L274, L273
+L230: prn *r7
+L231: dec L240
+L232: add L251, r1
+rts
+rts
+clr L262
+dec L239
+mov *r7, *r5
+L233: jsr *r6
+mov *r2, L145
+dec *r5
+jsr L184
+jsr *r6
+dec *r6
+L234: mov #4, *r5
+mov *r1, r7
+prn *r0
+mov L237, *r2
+add *r6, L188
+not *r6
+L235: lea L265, r5
+L236: dec L256
+L237: rts
+L238: mov *r7, L13
+; comment
+prn L189
+L239: .string "udeeiwrdzowutevlnr"
+bne L264
+stop
+clr *r4
+bne L192
+
+add #159, *r2
+jmp L93
+rts
+dec L148
+inc *r0
+bne L257
+jsr *r1
+not *r4
+sub #-84, *r0
+bne L71
+L240: sub #-45, L89
+L241: not r3
+not *r6
+L242: sub *r4, r2
+inc r2
+bne L134
+sub #-140, *r5
+jsr *r5
+inc *r5
+bne L247
+L243: mov L273, L57
+L244: add L272, *r7
+bne L259
+jmp *r2
+L245: .string "uupbrxvdihgghqjxngjbxblo"
+L246: jmp L264
+prn L270
+dec *r4
+add *r5, r7
+jmp *r2
+not r0
+not r4
+clr *r0
+L247: inc L270
+add *r2, L258
+add #-31, L19
+jsr *r1
+L248: stop
+not r1
+clr L4
+L249: .string "aqfapjhahhl"
+sub *r2, *r2
+mov #-237, *r0
+rts
+L250: rts
+inc L245
+bne *r2
+cmp L97, #-256
+bne *r6
+red r6
+L251: not *r2
+L252: rts
+not r4
+not L125
+rts
+bne *r1
+jsr L260
+L253: .data 541, 431, 593
+jsr *r2
+L254: not r7
+
+prn r4
+sub #103, *r5
+prn *r4
+L255: .string "arcvmcdbbnijgo"
+bne *r7
+inc L59
+jsr L112
+L256: .string "silnebjua"
+prn #108
+L257: .data 157, -11
+L258: lea L59, L129
+dec *r5
+rts
+lea L259, L16
+dec L273
+lea L253, r7
+; comment
+dec L233
+L259: inc r4
+cmp #-44, r6
+jsr *r4
+not *r2
+stop
+lea L263, r6
+L260: not *r1
+jsr L143
+dec r0
+not r7
+clr *r4
+L261: .string "abvhwihlqwnkuplss"
+jsr *r0
+not *r3
+lea L274, r4
+clr *r6
+inc *r4
+bne *r6
+L262: jmp *r4
+L263: prn L265
+L264: rts
+sub L68, r0
+cmp #234, L268
+dec r0
+stop
+dec L6
+L265: cmp r2, r0
+stop
+clr r0
+cmp #-122, #-125
+jsr L245
+red r0
+jsr *r7
+rts
+sub r3, r5
+L266: jmp *r7
+bne L269
+L267: lea L269, L269
+not *r0
+inc *r0
+bne *r4
+bne *r4
+rts
+rts
+lea L245, L30
+stop
+L268: mov L42, L186
+prn *r7
+lea L272, r2
+dec L274
+L269: .data -790, -67, 727
+not *r1
+L270: inc r3
+jmp L121
+bne *r4
+mov L186, L16
+jmp L48
+stop
+jmp L272
+L271: cmp L273, *r0
+rts
+red r4
+L272: not *r1
+prn L74
+jmp *r1
+L273: stop
+mov *r5, *r3
+jsr *r6
+dec L274
+mov #-224, r6
+red L174
+add #19, L274
+lea L274, r3
+mov #249, *r0
+rts
+L274: .data 646, -778, -881
+stop
@@ -0,0 +1,1019 @@
+; Generated by genCorpus --seed 7
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+L0: jmp *r6
+add *r3, *r5
+jsr L68
+L1: cmp #-66, r1
+L2: jsr L208
+cmp #126, r2
+sub r1, *r0
+L3: prn #232
+L4: jsr *r2
+dec *r5
+L5: red r0
+; comment
+prn *r4
+jsr *r3
+red r2
+inc *r6
+L6: red *r0
+dec r3
+red L1
+jmp *r6
+jsr L213
+dec *r2
+not L8
+not L4
+L7: .data -513
+not *r6
+not L1
+prn *r1
+L8: .data 298, -364, -9
+L9: jsr *r5
+sub *r6, L1
+L10: sub *r7, r0
+L11: inc L6
+L12: .data -955, 410, 759, -233
+L13: sub L12, *r1
+stop
+mov L217, r4
+rts
+clr L7
+red *r2
+L14: .data 49, -339, -805, 836
+inc r0
+L15: .data -731
+add *r4, *r5
+L16: cmp *r0, *r7
+sub #102, *r1
+add *r1, L108
+L17: .string "yhbkrosjsdv"
+L18: mov #-93, r0
+inc r3
+stop
+cmp r0, #-147
+red r6
+cmp *r2, *r4
+bne *r1
+dec r2
+jmp *r2
+bne *r2
+dec *r0
+L19: inc r1
+cmp *r0, L11
+bne L184
+lea L16, L14
+L20: sub r4, r6
+stop
+L21: .string "weze"
+sub r4, r1
+prn *r4
+rts
+L22: .string "vccdqa"
+not *r7
+cmp r7, *r4
+L23: .string "fzsjvdgbptem"
+L24: red r0
+L25: lea L18, L22
+bne *r6
+prn L5
+L26: jsr L14
+not L45
+dec r2
+dec *r1
+; comment
+inc *r0
+prn L25
+prn #206
+L27: add L40, r5
+L28: .data -224, -425, -926, 628, 163, 264, -985
+stop
+sub #147, *r5
+mov r3, L5
+L29: .data -957, 200
+inc r6
+
+L30: .string "eznbzcxzbksahbgsm"
+; comment
+L31: jsr L28
+L32: mov L66, *r2
+inc r3
+not L137
+add *r2, *r2
+mov *r6, L22
+
+L33: prn L32
+jmp *r5
+cmp #106, #141
+
+stop
+
+mov #78, r3
+stop
+bne L93
+L34: cmp *r7, *r0
+L35: mov L24, L21
+clr L66
+bne *r4
+jsr *r5
+not L44
+red *r6
+not L27
+L36: .data -526, 110, -962, -555, 371
+cmp *r4, *r4
+prn L13
+cmp r7, L7
+jmp L230
+clr L15
+L37: .data 227, 900, 311
+rts
+rts
+prn r1
+mov *r5, *r5
+lea L21, r5
+bne *r4
+sub *r4, *r2
+bne L35
+cmp r1, *r7
+add r3, *r1
+
+prn *r7
+L38: inc *r2
+L39: .string "sbqsa"
+L40: .string "kw"
+dec L173
+lea L5, L27
+L41: inc *r6
+inc L116
+L42: cmp #-170, *r7
+red L118
+rts
+jmp *r4
+jmp *r3
+inc r3
+jsr *r1
+not *r1
+; comment
+inc r4
+L43: .data -168, 254, 238, 991, -129, -113
+clr r1
+jsr L119
+lea L176, L38
+sub L102, r6
+; comment
+bne L25
+; comment
+L44: add #88, L98
+dec *r1
+rts
+bne *r7
+L45: .string "fpbdvuvyfutnibutegbt"
+L46: .data -575, 348, 688, -301
+mov L42, L8
+clr *r0
+bne L74
+prn r7
+L47: .data -176, -282, 987, 176
+rts
+red r3
+lea L23, r6
+L48: dec r7
+inc *r2
+L49: jsr L1
+cmp #-81, r6
+L50: not L19
+L51: clr L39
+rts
+; comment
+L52: jmp L10
+mov r6, L188
+lea L24, L94
+lea L105, r0
+lea L6, L17
+add L135, r6
+red *r2
+L53: mov #-210, r1
+jmp *r6
+L54: lea L22, L243
+bne L2
+jmp *r2
+clr *r4
+sub *r2, L7
+not *r3
+rts
+add L241, L50
+; comment
+not r5
+L55: bne L239
+bne *r2
+red r7
+L56: inc r5
+rts
+sub #170, L11
+jsr *r6
+L57: dec r4
+L58: .data -584, 969, -272, 143, 132
+stop
+inc L12
+clr r7
+lea L93, L165
+L59: jsr *r5
+lea L2, *r6
+clr L14
+clr *r3
+jmp *r2
+stop
+L60: jsr L72
+L61: .data -974, 320, -547, 342, -283, -409, -33
+prn #-128
+L62: clr *r1
+; comment
+L63: dec r5
+dec L52
+not *r1
+lea L49, L255
+cmp L41, #-178
+jsr L229
+prn r4
+L64: .data 100, 788, 730, -35, -213, 581, 786, 96
+jsr L117
+stop
+L65: lea L61, r4
+L66: red r5
+L67: inc r5
+L68: lea L36, *r2
+mov *r4, r7
+L69: .data -468, -857, 99
+jsr L25
+L70: .string "ynmrjghlp"
+; comment
+L71: .string "zqkas"
+mov #-77, *r4
+cmp #247, *r2
+cmp #144, #-137
+clr r6
+red L197
+L72: prn L197
+inc r0
+L73: .data 132
+
+mov *r6, *r0
+jsr *r3
+L74: .string "kbnpttnanfpmbet"
+not r5
+jsr *r3
+stop
+rts
+cmp L200, r0
+L75: .data 59, -232
+L76: .data 541, 942, 556, -269
+stop
+bne L142
+rts
+red *r0
+clr r6
+jmp *r2
+jmp L206
+stop
+bne L74
+clr r3
+sub #202, L197
+bne L107
+clr L62
+jsr L32
+clr *r4
+inc L73
+prn *r5
+jsr L102
+rts
+red r3
+dec L200
+add r7, L127
+cmp L23, #-251
+dec *r2
+sub *r1, *r0
+red r4
+cmp L43, r1
+red *r4
+L77: bne *r0
+mov *r7, r7
+prn L55
+add L105, r4
+L78: clr L35
+rts
+not r7
+inc *r3
+cmp r1, r5
+prn *r2
+sub r3, L213
+L79: rts
+dec r4
+L80: .data 531
+L81: sub #-70, *r3
+L82: .data -116, -186, 868, -820, -466
+
+stop
+rts
+clr *r6
+L83: stop
+L84: .string "clsmdrvzuwidtvhgmiot"
+L85: .data -307, -38, 488, 632, 923
+
+bne *r2
+rts
+bne *r0
+jsr L63
+jsr *r1
+red L15
+L86: cmp L173, #-158
+sub r6, L23
+L87: prn #-87
+L88: lea L85, L168
+clr *r1
+clr *r1
+L89: .data -663, 161, 638, 191, 222, -204, 204, 405
+add *r3, L259
+prn r7
+inc r0
+prn *r5
+red *r0
+L90: .data -215, 600, 810, 342, -149, -34, 410, 139
+L91: dec r4
+add r4, L161
+cmp #5, L120
+mov *r1, L9
+dec *r5
+jsr L235
+prn *r5
+
+inc *r1
+clr r2
+cmp #116, r7
+bne L28
+prn r2
+jmp L36
+not L144
+sub L62, r5
+add L16, *r5
+inc r4
+mov *r6, L2
+L92: cmp r6, #36
+jmp L178
+not r2
+add *r5, *r4
+L93: jsr L7
+L94: .string "ezxvmrsduhucnxxcb"
+rts
+L95: rts
+clr *r1
+prn r3
+jmp L121
+jsr *r0
+jmp L39
+mov L66, L163
+L96: inc r6
+add #-97, *r6
+red r0
+sub L27, *r7
+L97: .data 532, -380
+lea L158, r5
+L98: inc r3
+sub L111, L75
+bne L203
+jmp L26
+sub r3, L20
+L99: stop
+cmp L47, *r4
+
+sub L68, r1
+sub L152, r7
+L100: stop
+mov #-194, r1
+mov #140, L108
+L101: not *r2
+L102: jsr L255
+; comment
+stop
+cmp r4, L1
+bne *r5
+L103: .data -675, 475, -644, -977
+not *r5
+L104: sub *r0, *r5
+lea L246, *r5
+not r2
+red L250
+add L122, L11
+L105: mov L91, *r7
+L106: red L138
+sub L11, r5
+dec *r6
+stop
+not L154
+not *r7
+clr r5
+dec *r6
+not r4
+rts
+not *r5
+jsr L64
+L107: stop
+L108: prn *r1
+L109: sub r0, *r2
+jmp L58
+mov r1, L209
+inc L225
+clr L5
+add L247, *r0
+red L108
+clr r5
+add L11, *r5
+lea L153, L247
+
+
+jsr *r1
+mov r0, r1
+jmp *r4
+L110: prn #-53
+L111: .string "vyhfgtlmsnv"
+add #72, r2
+L112: sub L35, *r7
+
+cmp L216, L72
+L113: sub #132, L93
+jmp L181
+cmp #22, L27
+jmp L179
+jsr *r6
+inc L127
+stop
+L114: .string "eyzxbsyjurzlxohpzutgj"
+; comment
+dec *r4
+L115: .string "soodklacfubhwjpsabawmh"
+L116: sub L154, r7
+L117: not *r7
+not r3
+lea L192, r2
+mov *r2, L222
+cmp L41, #110
+rts
+inc r0
+
+; comment
+L118: .data 330, -839, 725, -47, 572
+L119: clr L8
+dec *r3
+not *r0
+L120: .data -621, 614, -120, 691, 440
+dec *r5
+L121: clr L184
+not L260
+
+red L24
+L122: jmp *r5
+L123: cmp L47, r5
+dec *r7
+L124: rts
+L125: not L20
+L126: .data 225, -470, -264, 426, -536, 743, 395
+stop
+L127: .data -900, 35, -560, 731, -922, -712, 280
+dec r1
+mov #-86, *r5
+inc r0
+bne *r4
+; comment
+L128: .string "achwej"
+red L159
+L129: not L48
+stop
+rts
+clr *r0
+jmp *r6
+bne L189
+dec L2
+dec r6
+L130: .string "awisinxtlm"
+jsr *r3
+cmp L254, *r6
+L131: sub *r2, *r4
+dec r0
+bne *r2
+stop
+L132: jsr L245
+red *r1
+mov L196, *r5
+mov #13, L75
+not *r4
+clr L233
+L133: prn *r7
+clr *r0
+stop
+lea L153, r0
+mov #238, r6
+jmp L58
+sub *r5, L83
+L134: .data 816, -300, 156, -726, 670, -760
+L135: .string "avtcvtgcsgwnidtmhoedxkd"
+jsr *r2
+stop
+inc L0
+bne *r1
+red L141
+clr r6
+jmp *r3
+sub r3, *r1
+dec L226
+L136: prn r7
+L137: .string "qdkdvixjpdlpygrwins"
+lea L34, r6
+not *r1
+sub #-223, L138
+cmp r2, *r4
+L138: sub L256, L147
+rts
+dec L74
+L139: jsr L64
+L140: clr r2
+stop
+L141: prn L8
+not L22
+inc L193
+cmp L48, r0
+L142: bne L227
+mov L92, *r2
+not *r1
+red r2
+L143: mov #148, L162
+dec L46
+L144: .data 471, -491, -140, -871, -561, 593, 801
+L145: bne *r5
+not L88
+L146: clr *r2
+; comment
+L147: .string "hubjzlpordooydx"
+inc L44
+L148: .string "ygwhcgulrnivxoco"
+cmp *r7, #46
+jmp *r2
+rts
+
+dec r2
+jsr *r2
+red r1
+lea L44, r4
+L149: stop
+bne L118
+L150: .data 184, 268
+clr *r3
+L151: sub #184, *r0
+red *r0
+L152: .string "hixiljmdtskapauoysdmhrc"
+prn #-63
+red L233
+L153: dec L246
+lea L192, r2
+L154: jmp L133
+jsr L48
+inc r6
+
+stop
+prn L125
+L155: rts
+mov r1, *r5
+jmp L99
+L156: jsr L69
+dec L26
+red L191
+add #-116, r4
+L157: .data 28
+stop
+L158: bne *r0
+mov L174, *r0
+stop
+bne *r3
+rts
+bne *r7
+stop
+L159: .data 809, -572, -423, 338
+sub L224, r2
+not *r4
+bne L181
+clr *r4
+jmp *r2
+cmp L59, L96
+lea L207, *r0
+L160: cmp #213, L216
+add L71, r7
+jmp L223
+bne *r6
+add *r4, L74
+add L138, r4
+clr L73
+stop
+dec *r1
+L161: .string "n"
+red L241
+cmp *r1, L241
+clr L211
+jsr L93
+stop
+L162: .data -926, 517, -913
+L163: red L216
+stop
+rts
+dec *r7
+mov #92, r7
+lea L189, r1
+bne *r3
+lea L248, L225
+jsr *r2
+L164: .string "xdckrlzpv"
+dec r5
+mov #141, *r2
+L165: .data -24, 335, -918, 29, -988, 861, 759
+bne L117
+add r6, *r5
+lea L21, *r3
+L166: not *r7
+not L120
+rts
+mov r2, r4
+bne *r2
+add r0, *r5
+prn r4
+not r5
+red r1
+
+L167: jmp L212
+L168: bne *r3
+jsr *r2
+lea L197, r2
+L169: rts
+L170: stop
+rts
+rts
+bne L8
+jmp *r6
+sub *r4, r1
+prn r6
+red *r1
+L171: .string "jyswexadplmtgonlyqibl"
+cmp r3, #-11
+dec L191
+rts
+inc *r6
+L172: .data 423, 244, -45, 452, -493, -271, 249, -959
+sub L37, L20
+prn #-75
+jsr L238
+L173: lea L212, L160
+
+add *r0, L214
+L174: cmp L73, *r0
+clr r6
+not *r5
+dec *r7
+jsr *r5
+red r6
+prn *r1
+not *r6
+red L233
+dec L117
+L175: cmp #-208, L171
+
+L176: dec r2
+not *r3
+jmp *r3
+bne *r2
+clr L48
+jsr *r7
+
+; comment
+L177: .data -206, 34, 851, 291, 262
+mov r2, r2
+L178: red L257
+inc *r3
+L179: .string "jevreovny"
+dec *r2
+red *r6
+jsr L191
+lea L225, *r6
+L180: sub L148, L81
+not L205
+L181: dec r7
+cmp *r4, r0
+prn *r6
+L182: not *r6
+L183: inc L49
+clr *r1
+red L230
+not *r1
+dec *r2
+stop
+L184: add r6, L6
+L185: .string "w"
+red r1
+mov #-89, r3
+L186: sub #-241, r1
+; comment
+; comment
+mov #28, L14
+L187: stop
+lea L215, L230
+rts
+prn #-170
+bne *r1
+bne L207
+not r4
+mov #196, r4
+stop
+L188: .data -30, 14, -540, -315, -405, 688, 982, 59
+sub r2, L43
+jmp *r6
+sub r3, r6
+inc r2
+L189: cmp *r4, L53
+L190: mov r4, L194
+inc L242
+prn #253
+bne *r4
+L191: jsr L239
+cmp *r5, L11
+lea L209, r1
+clr L77
+rts
+L192: lea L243, *r4
+; comment
+L193: rts
+bne *r2
+not r4
+cmp #-54, r5
+prn *r7
+L194: dec L81
+L195: bne L231
+dec *r3
+mov #17, r5
+mov r7, L76
+bne L158
+stop
+jsr *r3
+bne *r1
+stop
+add #215, *r6
+lea L109, L37
+clr r0
+not *r0
+; comment
+L196: .string "gnaovvoga"
+L197: .data 601, -893, -463, 89, -837, -338
+not L232
+sub #-84, L124
+sub #80, *r5
+L198: .data 498, -759, -543
+add r6, L227
+jmp L188
+add *r6, *r0
+dec L81
+add #-242, *r1
+rts
+add #-172, L223
+L199: dec L232
+clr r6
+L200: dec r2
+; comment
+stop
+L201: .data 212, 915, 649
+L202: .string "azknfvanwjgvdopmpen"
+jmp *r0
+rts
+L203: .data -306, 605, 986, -117, 143, -756, 194
+jmp L166
+L204: rts
+cmp *r0, L81
+not r6
+clr r3
+cmp r3, #19
+L205: .data 999, 518, 344, -180, 695
+jsr L79
+L206: mov L224, *r4
+L207: .string "bihgmslyuogfkunuu"
+; comment
+jmp *r7
+red r0
+inc *r5
+lea L225, *r7
+cmp *r7, L246
+not *r2
+sub L217, *r7
+rts
+add *r6, r3
+L208: add *r5, r0
+rts
+L209: not r4
+add r4, *r1
+dec r7
+mov *r3, *r2
+sub L251, r7
+jmp L245
+not *r3
+L210: jmp *r1
+prn *r3
+sub r2, r4
+prn r1
+L211: .data -721, 353, -316, -163, 827, -175
+rts
+lea L43, *r7
+L212: .data -344, -294, 49, -764
+L213: mov #134, *r3
+L214: red r5
+not r5
+L215: not *r2
+red L107
+lea L149, *r6
+L216: mov #148, *r6
+jmp L238
+stop
+; comment
+L217: prn L251
+bne L251
+red r2
+stop
+jsr L123
+L218: dec L11
+L219: cmp #186, L173
+dec L231
+prn L99
+sub #68, r2
+mov r7, L170
+clr L243
+L220: prn #-195
+lea L95, r4
+dec *r4
+lea L254, L235
+cmp r5, *r1
+
+not L229
+not *r0
+L221: jmp L104
+inc L253
+
+stop
+L222: lea L79, r4
+jsr *r4
+jmp *r2
+dec r5
+inc L202
+L223: lea L161, r3
+sub *r2, *r1
+
+L224: .string "tq"
+; comment
+add *r1, *r1
+L225: .string "sjw"
+red *r3
+rts
+jsr L159
+L226: mov L256, *r2
+L227: inc L260
+not r5
+L228: add #-46, *r6
+L229: lea L246, *r7
+mov L246, r0
+L230: .data 326, -319, 325, 808, -389, -49, -205, 76
+L231: jmp *r6
+bne L41
+L232: .data 546, -365, 182, 702, 727, 958, -35, 799
+add L257, *r6
+L233: cmp *r5, r1
+L234: .string "yrfjmvew"
+jsr *r6
+L235: .string "r"
+L236: add r6, r3
+L237: .string "elzdxjxjgfcifjrcxflntz"
+cmp L258, *r5
+mov *r6, r6
+prn *r6
+dec r7
+cmp r3, L248
+clr r6
+L238: .string "ifiteqahnhjq"
+; comment
+lea L260, *r1
+L239: stop
+lea L105, L260
+red *r1
+L240: sub #-81, *r5
+rts
+dec L31
+red r0
+stop
+bne *r7
+not *r0
+cmp r3, #-214
+L241: red *r4
+dec L56
+L242: .string "lrjc"
+L243: add L224, r0
+rts
+cmp L91, *r4
+not r2
+jmp *r0
+sub #-49, r4
+clr *r4
+L244: .data 240, 748, 353
+inc *r2
+mov #-90, r2
+cmp r7, *r4
+L245: .string "dx"
+clr *r1
+rts
+red L61
+inc L254
+jsr *r3
+L246: bne L256
+dec r3
+rts
+clr *r1
+L247: .data 377, 472, -781, 571, -519
+red r1
+L248: .data -266, -966, 561
+
+
+L249: .string "r"
+clr r6
+cmp #-163, r4
+add #-94, *r3
+red *r2
+bne *r5
+clr *r3
+red *r6
+not L108
+jsr *r4
+rts
+mov r4, *r0
+L250: clr *r5
+inc L200
+L251: inc *r1
+rts
+rts
+; comment
+L252: .data -698, -128, -272, 85, 130, -771, 220
+lea L242, *r1
+dec r4
+L253: .string "kcuqckflpokdgnqoyu"
+L254: dec L131
+inc r2
+bne L256
+dec *r7
+L255: .string "ffsfcsnjzdajakapcxrsas"
+clr L121
+L256: clr r3
+sub *r4, *r5
+not *r6
+L257: .data 47, 612, 192, -483, 240, -593, 936
+jmp L259
+prn r2
+sub r4, r3
+inc L259
+prn *r0
+lea L62, r2
+mov L258, *r4
+lea L259, r6
+jsr L260
+add L25, L23
+rts
+prn r6
+rts
+lea L259, r2
+L258: .data 360, -52, 809, 535, -285, -676
+bne *r4
+bne *r1
+stop
+inc L260
+mov L260, *r5
+; comment
+add *r2, *r1
+jsr *r7
+L259: .string "rb"
+cmp *r4, *r2
+L260: cmp #209, #-118
+jsr L16
+jsr L112
+stop
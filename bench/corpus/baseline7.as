@@ -0,0 +1,1020 @@
+; Generated by genCorpus --seed 8
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+stop
+L0: dec *r4
+red *r2
+L1: add *r5, r7
+stop
+L2: dec L2
+clr *r5
+L3: lea L0, L0
+bne L198
+clr *r1
+; comment
+clr L145
+add *r0, r4
+L4: cmp *r1, r1
+sub #190, *r4
+lea L0, r7
+L5: .data -164, 389, -899, 657, -56, -581
+rts
+add r5, L3
+lea L219, r6
+mov L4, L3
+bne *r3
+sub #-83, *r2
+prn *r0
+add *r5, *r2
+rts
+mov #243, *r4
+stop
+lea L141, L69
+jmp *r2
+bne L133
+L6: .data 216, 818, -272, -546, 70, 969, -822
+L7: sub r2, *r3
+
+L8: .string "jsfqaomukerzrvxqaoe"
+; comment
+L9: .string "abq"
+L10: jsr *r2
+prn *r2
+; comment
+jsr L15
+jsr L286
+add *r6, *r0
+L11: .data -624
+L12: .string "ziagovqurmnwpy"
+L13: red L174
+sub L6, L1
+add r2, L141
+stop
+L14: bne L3
+jsr L156
+inc r2
+
+inc L158
+L15: inc L0
+red *r3
+inc L246
+L16: .data 906, -835, 618, 447, 13
+jmp L260
+prn L12
+clr r4
+L17: rts
+clr r3
+L18: not r7
+L19: cmp r5, #-115
+clr *r3
+jmp L1
+sub r5, L1
+L20: .string "owijqaycjarx"
+; comment
+L21: bne *r6
+jsr *r6
+not r7
+stop
+prn r5
+bne *r4
+; comment
+L22: .string "idnzrgcgd"
+stop
+bne *r1
+lea L4, r5
+L23: .string "axtthktelwyka"
+clr L0
+dec r0
+L24: .string "ncagwgaqptfhuwe"
+jsr *r6
+cmp L283, r6
+jsr L27
+clr r7
+mov r6, L58
+jmp *r7
+not *r6
+cmp #-52, L6
+bne *r7
+not r1
+stop
+add #149, L83
+inc *r3
+L25: .string "lyfdcejohblqdhe"
+cmp L138, r1
+inc L7
+not *r1
+dec L32
+L26: lea L23, L51
+jmp L246
+stop
+jmp L4
+sub L11, r2
+bne L22
+L27: cmp L1, *r7
+dec r3
+bne *r1
+
+L28: clr L28
+prn r2
+sub #243, r6
+L29: .data 410, 767, 376, -348, -580
+not r2
+L30: not *r6
+bne L50
+bne *r2
+L31: add r2, L16
+inc L7
+red r7
+not *r3
+L32: rts
+clr r2
+L33: rts
+dec L16
+L34: jmp *r1
+mov *r5, r3
+jmp L89
+lea L276, L0
+add r5, r3
+L35: .data -751, -885, -376, -727, -156, -31, -883
+clr r6
+clr L16
+stop
+L36: clr *r5
+
+add r2, r7
+L37: prn r3
+L38: .string "xop"
+L39: .data 127
+stop
+not L190
+stop
+L40: .string "zawwxywxsx"
+jsr L8
+; comment
+
+clr L171
+lea L211, r7
+not *r5
+L41: sub r5, r4
+L42: .data 997, -28, -383, -785, -353, 77
+L43: prn r3
+L44: not L41
+rts
+L45: stop
+L46: rts
+lea L40, r4
+clr L248
+lea L4, *r6
+add *r0, r5
+L47: .string "njr"
+sub *r7, *r3
+L48: .data -73, 26
+jmp *r5
+sub *r3, L18
+L49: .data -497, -59, -503, -538
+inc L11
+clr L233
+clr *r3
+add L56, *r1
+inc L96
+prn #-116
+clr L15
+not *r6
+lea L175, L46
+L50: .string "mkfwr"
+mov L120, r3
+dec r2
+inc r4
+L51: add L175, r3
+rts
+jmp *r5
+L52: rts
+dec *r6
+add #-112, *r3
+rts
+L53: prn r7
+prn r5
+red *r1
+rts
+not r4
+stop
+red r2
+jmp L7
+; comment
+L54: .data -12, -267, 470
+L55: clr r1
+mov #203, r2
+add r4, *r2
+dec L124
+L56: .string "iwaaovqfwbwxxwzo"
+rts
+not r5
+
+not L217
+clr *r2
+L57: .string "flausphhnh"
+stop
+red r5
+inc L12
+clr r6
+stop
+cmp *r3, L163
+prn *r7
+clr *r7
+L58: .string "lxmop"
+jmp L35
+dec r6
+jsr *r7
+L59: not *r7
+jmp *r0
+L60: bne *r7
+cmp r0, r5
+prn L24
+prn *r2
+dec *r7
+not r2
+stop
+L61: jmp *r3
+
+L62: jsr *r3
+L63: .string "gazrtvrwcaxh"
+sub r4, *r5
+L64: prn r6
+
+sub L185, *r7
+L65: inc *r4
+dec L244
+red L33
+red r1
+clr L231
+not L167
+jsr L223
+red r0
+lea L246, *r4
+inc r5
+not *r6
+rts
+cmp #-62, r5
+red L204
+L66: .string "fijobauobhyraftdibswfsvr"
+L67: clr L173
+prn r5
+add #-129, L116
+L68: red *r4
+sub *r4, L114
+L69: not L61
+L70: lea L258, *r2
+rts
+jmp *r3
+not *r0
+; comment
+inc *r7
+L71: .data -800, -882, -754, -998, -200
+L72: .string "wuhesorpoilldxtnyeo"
+jmp L59
+not *r3
+cmp L126, L245
+L73: rts
+L74: clr r0
+cmp *r3, L254
+prn *r2
+L75: jmp *r0
+stop
+L76: add *r4, L236
+L77: not L129
+mov r0, *r7
+prn L8
+L78: .string "ulbplb"
+add r6, L141
+prn #-241
+cmp r5, *r1
+jmp *r5
+not r2
+cmp L250, *r3
+add r5, r7
+rts
+sub #-232, L45
+mov *r5, *r1
+inc L269
+L79: stop
+L80: prn r5
+dec r4
+L81: rts
+jsr L221
+mov r2, *r6
+rts
+dec r4
+dec r7
+sub L100, *r5
+L82: red L78
+mov *r0, L278
+mov r2, r2
+clr r3
+mov L131, L235
+L83: lea L226, r3
+; comment
+inc L63
+L84: clr *r5
+
+L85: lea L6, r6
+lea L74, L111
+jmp *r2
+not L158
+L86: prn *r7
+clr r0
+
+clr L242
+L87: clr L168
+red L177
+red r3
+red *r3
+L88: .string "pkgjhlba"
+mov r2, *r6
+red *r5
+jmp L46
+L89: jsr L150
+clr L51
+; comment
+rts
+dec r3
+L90: bne L114
+L91: inc *r6
+L92: jsr *r2
+L93: .data -6, 245, 905, -573, 470, 597, -528
+stop
+L94: .string "roso"
+mov #-53, *r3
+L95: red r6
+bne L60
+lea L252, *r3
+lea L235, r5
+rts
+L96: lea L173, r4
+bne *r6
+bne *r3
+; comment
+L97: prn #-226
+not L223
+L98: prn r3
+add *r1, *r7
+cmp L265, L238
+L99: jmp L129
+L100: add *r2, *r7
+cmp L251, L97
+red r4
+mov #-222, L213
+not *r4
+jsr *r3
+L101: jsr *r2
+L102: add r1, L96
+stop
+L103: lea L70, r0
+L104: jsr *r5
+jsr *r1
+cmp r6, #-67
+L105: rts
+jsr *r4
+L106: .string "zyzuwzbxkkpxkwiwvhq"
+inc *r1
+L107: .string "iliflegfsskszogarblyxs"
+rts
+
+lea L49, L6
+jmp *r1
+sub L13, *r4
+cmp L205, *r2
+jsr L197
+L108: jmp L86
+bne L192
+add #64, L114
+lea L223, *r5
+L109: mov *r4, *r6
+cmp L35, #166
+; comment
+L110: .string "agwvtesakkjklwdwuwpmoyhn"
+dec *r0
+not *r2
+lea L73, *r3
+lea L9, L184
+L111: prn *r5
+clr r3
+L112: bne L88
+jsr *r7
+mov r5, L133
+L113: jsr *r6
+lea L7, r0
+sub *r6, *r0
+jmp *r6
+dec *r1
+L114: clr L215
+stop
+jsr *r5
+L115: sub #251, L270
+mov r7, *r7
+jmp L74
+prn *r5
+mov #243, L40
+prn L41
+bne *r6
+jmp L113
+L116: jsr *r7
+prn *r0
+not L198
+prn #161
+stop
+sub L175, r1
+L117: .data 664
+sub L82, r6
+mov r3, r4
+mov r1, r3
+add L277, L79
+L118: inc *r0
+
+L119: .string "gh"
+rts
+L120: mov L33, r5
+L121: lea L252, L103
+cmp *r1, L284
+bne L107
+mov *r5, r4
+inc *r5
+red *r7
+L122: cmp #1, #3
+L123: .data 826, -989, 749, -73, -349, 253
+L124: red *r6
+jsr *r1
+bne *r6
+; comment
+jsr *r3
+L125: cmp L91, *r5
+rts
+sub #206, r1
+mov #-105, r2
+dec *r2
+L126: mov r4, r1
+cmp L54, L279
+prn #106
+red *r3
+inc L99
+L127: inc *r3
+lea L161, *r6
+clr *r3
+cmp L166, r2
+jsr L50
+L128: .data -631, -806, 590, 100, -467, 797, 367, -425
+; comment
+rts
+L129: lea L201, *r5
+add L232, r6
+inc *r6
+mov r0, *r5
+sub r4, L188
+jmp *r4
+jmp L216
+L130: sub #-80, *r5
+rts
+cmp #107, L209
+cmp #192, #-7
+dec r6
+jmp *r4
+mov L158, *r1
+add #105, L227
+mov *r0, *r5
+red r1
+stop
+inc L272
+mov #-181, *r4
+; comment
+dec r4
+L131: inc L118
+dec L170
+clr r1
+L132: .data -804, 399, -582, 713, -913
+bne *r6
+rts
+prn r3
+lea L71, L263
+L133: prn *r1
+clr *r5
+jmp *r7
+add r6, *r5
+L134: dec *r1
+L135: cmp L193, *r0
+L136: cmp #-133, *r5
+L137: bne *r2
+sub #-135, r5
+L138: .data -939
+L139: stop
+rts
+mov *r3, L262
+mov *r4, *r3
+jmp *r0
+
+inc L211
+sub #-235, r5
+; comment
+jmp *r1
+cmp *r4, *r6
+stop
+L140: inc *r5
+L141: .data 676, -335, 344, 4, 631, 53, 87, 773
+red *r0
+not *r4
+L142: inc r1
+clr *r3
+dec L192
+dec *r2
+L143: dec L278
+L144: prn r0
+lea L125, L58
+L145: inc r2
+jmp L176
+cmp *r2, *r0
+rts
+cmp r4, #162
+prn L106
+cmp L281, r7
+dec r2
+L146: sub L32, r0
+sub r3, r5
+L147: prn L72
+L148: .data -356, 679, -765, 766, -538, 925, 173, 976
+bne *r3
+L149: inc *r5
+bne L42
+prn r4
+not r2
+mov #27, L100
+L150: cmp *r5, r3
+clr r2
+; comment
+not L192
+red r0
+; comment
+mov L181, r4
+not *r7
+L151: red *r0
+mov *r6, L103
+; comment
+prn L248
+L152: .data -867, 598, 145, -301, 617, -213, 604
+stop
+inc r5
+mov r1, L225
+jmp *r4
+jsr *r0
+jsr L279
+L153: add *r7, *r5
+; comment
+not *r6
+clr *r4
+L154: .data -642, 857, -146
+prn r7
+jmp *r3
+sub r3, r2
+L155: .string "pp"
+L156: mov r6, *r7
+bne L53
+
+jmp *r0
+jsr *r5
+bne *r6
+add L185, L161
+L157: .string "kt"
+L158: red *r2
+jmp *r4
+lea L139, *r6
+rts
+inc r2
+L159: jsr *r0
+bne *r2
+L160: .data -367, -109, 821, -674, 523, -743, 682, 185
+cmp r3, #63
+mov r4, r2
+dec L257
+red L71
+; comment
+prn r2
+L161: stop
+red r7
+lea L155, *r0
+L162: cmp #50, L252
+red r4
+red L56
+mov L189, *r1
+L163: add L275, r1
+not L255
+cmp *r0, r2
+L164: lea L194, L261
+
+stop
+sub L251, L248
+bne *r5
+mov r3, r0
+prn L143
+stop
+L165: .string "wacrfvzaedxzkzwiaj"
+L166: prn r4
+stop
+L167: lea L286, r5
+mov L137, L247
+mov r4, r3
+jmp L26
+cmp L257, #43
+L168: .string "lvefxuwiicmdttukprecv"
+L169: .data -266, 719, 292, -883, -194, 520, 460
+L170: stop
+not L21
+prn #142
+clr r6
+L171: .data -575, -374, 663, -774, 638, -321, -382, 877
+L172: inc L34
+L173: .data -517
+L174: bne L265
+not *r2
+inc *r2
+red L280
+
+clr L154
+not *r4
+inc r7
+red r6
+sub *r3, *r6
+
+stop
+L175: red *r5
+not r3
+; comment
+bne L136
+L176: .string "lozvqjiebssqxfjhzulqljce"
+sub L280, L63
+lea L194, *r7
+not r0
+L177: .data 398, -213
+inc L151
+lea L15, L276
+inc L136
+L178: cmp *r6, r4
+L179: cmp r2, #-200
+jmp L200
+L180: .data 603, -347, -397, -348, -387
+add #52, *r1
+L181: .data -136, 472, 944
+prn r2
+cmp r6, #-209
+add r2, r5
+dec L280
+dec L205
+rts
+L182: .string "zamtbbmgmxhtrkqj"
+L183: .string "jtywbovuayx"
+add *r5, r6
+add *r0, r1
+L184: .string "xgwcfnnswxkdkzc"
+L185: .string "bmte"
+clr L94
+not L72
+sub L284, L193
+red L77
+L186: clr L196
+red L101
+red L219
+lea L7, L118
+stop
+L187: .data 430, 547
+not r6
+; comment
+rts
+prn #189
+L188: .data -124, -90, 388, 519, -367, 29
+inc L55
+sub L229, r2
+rts
+dec L102
+inc *r6
+jsr L223
+not L120
+jsr *r7
+L189: inc r1
+L190: .data 774
+L191: .data 846, -676, -255, 645, 9, 828
+prn L126
+L192: dec *r3
+red r6
+L193: rts
+rts
+cmp #73, #250
+dec r3
+; comment
+L194: red L257
+L195: cmp #-45, #232
+L196: rts
+jsr L211
+L197: stop
+rts
+cmp r7, #-53
+dec *r5
+L198: jmp L225
+prn *r6
+L199: cmp #203, *r0
+L200: jsr *r4
+cmp *r4, #-202
+cmp #-41, r7
+add #-246, r6
+rts
+L201: clr *r2
+mov *r6, *r3
+L202: not L138
+L203: add *r1, r6
+
+inc *r7
+L204: not r2
+L205: .data 727, 684, -52, -787, -587, -143, -811, -537
+mov L147, r0
+sub r2, r3
+jsr *r7
+lea L121, r7
+stop
+L206: cmp *r5, *r3
+L207: .data -228, 299, -813, -640, 637, 489, 285
+rts
+L208: .string "prtsrck"
+rts
+rts
+clr L257
+bne *r1
+L209: .string "ftmxxzuqa"
+red *r0
+cmp L278, #33
+L210: .data -952, -283, 548, 544, -713, 110, 551, 823
+rts
+L211: jsr *r0
+; comment
+cmp r1, #209
+dec r3
+rts
+L212: jmp L122
+L213: .data -709, -397, 719, 194, 25, 921, -676
+dec *r3
+bne *r2
+mov L259, *r0
+L214: .string "plax"
+L215: .string "mhtnetyqkkdlcjhtuhylqqji"
+
+cmp *r6, #172
+L216: .string "mdnxnigjutfblxmdqig"
+not r3
+L217: .data -295, 693, 22
+cmp L159, L228
+L218: inc *r6
+L219: sub *r3, r6
+clr r3
+lea L165, r3
+cmp r3, *r5
+dec *r4
+L220: .data -249, 961, -642, 814, 330
+not r2
+L221: .string "nqnpjgtgglaza"
+L222: add L229, r3
+add L8, *r6
+jsr L266
+lea L245, *r2
+inc *r4
+L223: lea L234, r7
+dec r5
+rts
+L224: .data -281, 702, 590, 153
+jsr *r0
+L225: not *r5
+L226: dec *r5
+L227: lea L258, L257
+bne *r7
+mov #-149, r3
+L228: cmp *r1, *r3
+L229: .string "zozaetlufbtprfgeusqwc"
+not L253
+L230: .string "ztchffpcdyavyfxco"
+L231: .string "swpxrxssktxintwzcfym"
+stop
+bne *r2
+cmp L167, *r4
+L232: inc r6
+not L2
+jmp L247
+clr L237
+inc r6
+lea L274, *r7
+mov L169, L183
+L233: .data 545, 920, 127, 941
+rts
+
+red *r4
+cmp r5, L54
+prn L44
+L234: mov #-64, L219
+jsr *r1
+inc L260
+inc r2
+L235: mov r1, L30
+L236: bne *r5
+rts
+lea L284, L194
+mov *r3, r1
+dec L28
+L237: .data -488, -101, -109, -456, -787, 580, 163
+clr r0
+inc r0
+L238: lea L252, L196
+jmp *r0
+red L84
+red *r6
+sub *r6, *r2
+mov r1, *r1
+add *r3, L260
+cmp #-199, r7
+L239: bne L278
+jsr L39
+jsr *r6
+L240: inc *r7
+bne L247
+L241: stop
+jmp *r3
+mov r3, *r0
+bne L184
+bne *r3
+bne *r4
+L242: rts
+L243: .string "fopcgmnntozajcflhtnfyc"
+dec L84
+L244: .string "wjsftyyywwphctz"
+sub *r7, r1
+L245: bne L109
+L246: sub #119, *r0
+L247: add r7, *r3
+L248: mov r5, L182
+jsr *r2
+lea L124, r5
+L249: lea L187, L80
+L250: .data 950, 350, -565, -575, 541
+mov L276, *r3
+clr L80
+mov *r5, *r2
+cmp *r1, #247
+clr r3
+add *r3, L6
+dec r5
+mov L132, *r3
+L251: .data -107, -387, -316, -596, 832, 815, -740
+jsr L253
+lea L33, r5
+L252: jmp L52
+not L264
+L253: mov #229, *r2
+L254: .data -399, 689, -296
+lea L281, r1
+sub r4, r6
+lea L197, *r5
+not r2
+L255: dec r6
+add *r7, r4
+L256: mov L180, r0
+
+jsr L285
+L257: rts
+prn *r4
+L258: prn r5
+inc L275
+L259: red *r5
+lea L240, *r1
+mov #-242, *r4
+dec r5
+L260: dec L281
+lea L78, r5
+L261: .data 559
+
+dec *r6
+red L89
+rts
+bne *r7
+sub *r3, *r5
+sub r6, *r2
+dec r6
+clr *r0
+L262: cmp #107, #69
+mov *r4, L272
+cmp r5, L284
+jmp L263
+jmp *r6
+jmp L261
+cmp *r7, r0
+jmp *r4
+stop
+; comment
+mov r1, *r4
+L263: jmp L264
+L264: .data 79
+L265: prn #-15
+L266: sub L83, L279
+red *r5
+inc L282
+L267: .data 516, 537, 814
+lea L90, *r6
+dec r0
+L268: .string "v"
+jmp *r5
+lea L207, *r5
+rts
+mov L251, L275
+rts
+inc *r3
+lea L281, *r1
+stop
+rts
+add r2, L265
+
+jsr *r5
+L269: .data -240
+jsr L80
+red *r2
+add *r2, r7
+bne *r1
+rts
+lea L70, r7
+jmp *r6
+L270: jmp *r3
+lea L65, L281
+L271: .data -867
+jsr L192
+lea L272, L115
+; comment
+L272: .string "pjcbsrpfz"
+L273: clr r7
+lea L194, L72
+L274: .string "vvt"
+add #183, L24
+add #42, *r0
+inc *r7
+L275: cmp *r1, L201
+sub *r0, L110
+L276: cmp *r4, r1
+; comment
+L277: rts
+jsr *r7
+prn #192
+L278: .data -58, -775, 911, -242, -530, -606, -175, -896
+bne *r7
+L279: jmp *r1
+red *r6
+clr L284
+inc r3
+L280: jsr L284
+sub L285, r3
+clr L282
+clr L171
+cmp *r1, *r6
+dec r4
+L281: .string "hcrlrcuqsnluftbi"
+stop
+dec *r5
+; comment
+dec r2
+dec r6
+clr L284
+sub *r6, L46
+dec *r1
+stop
+L282: rts
+prn r4
+not L42
+L283: stop
+L284: .data -276, 191, 162
+dec *r3
+L285: clr *r6
+dec L148
+dec *r2
+not L286
+jsr L137
+bne L286
+prn L286
+L286: clr *r7
+jmp L124
+rts
+
+jsr L202
+stop
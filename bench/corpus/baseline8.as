@@ -0,0 +1,1019 @@
+; Generated by genCorpus --seed 9
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+lea L86, L181
+L0: red *r6
+L1: .string "hnqoktsvim"
+L2: inc *r2
+prn L2
+
+inc *r5
+sub r1, *r3
+add r0, r4
+; comment
+bne *r4
+bne *r3
+L3: add r4, L2
+sub L0, L70
+add r3, L1
+L4: cmp r3, L2
+add #-55, *r1
+dec r5
+L5: mov L23, *r7
+L6: .data -339, 479
+jmp *r6
+L7: .data -400, -750
+L8: red L7
+prn #44
+prn L5
+cmp L74, *r2
+jsr *r6
+L9: stop
+bne L28
+L10: stop
+mov L130, r5
+; comment
+L11: add r6, r6
+rts
+dec *r5
+L12: mov L7, L166
+bne *r3
+bne L9
+sub r3, *r2
+cmp L234, L1
+bne *r3
+sub *r2, r0
+red L11
+L13: clr L11
+add *r3, L5
+clr L16
+stop
+L14: .string "fdobuvura"
+not *r3
+L15: inc r3
+bne L9
+bne *r6
+dec r2
+inc r3
+L16: dec r1
+sub L104, *r7
+bne *r7
+L17: mov r3, *r3
+mov #-82, L156
+not L235
+L18: jsr L148
+clr L16
+prn L197
+lea L2, L2
+clr L116
+bne L12
+L19: .data -568, 35, 324
+jsr *r6
+stop
+stop
+; comment
+stop
+lea L11, *r1
+L20: lea L118, *r2
+bne *r2
+inc L5
+L21: cmp #229, r6
+rts
+red r2
+stop
+jmp L257
+L22: .data 449, -458
+lea L1, *r5
+sub #-144, *r0
+rts
+jsr *r5
+L23: .string "cairp"
+lea L2, r6
+mov L6, L13
+rts
+L24: .string "gufvtvndysdpvjnq"
+bne L228
+L25: .string "jgegugnlpj"
+L26: rts
+L27: jmp *r7
+L28: .data -628, -961
+add L84, *r3
+bne *r6
+L29: jsr *r0
+L30: jsr *r6
+L31: .string "xcqntzg"
+prn L172
+add r6, *r6
+rts
+inc *r5
+not r7
+L32: not *r4
+jmp L55
+L33: .string "occgtfowdpmn"
+sub L137, r5
+L34: .data -500, 461, -683
+clr L74
+jmp *r6
+cmp r4, L17
+bne L197
+; comment
+L35: .string "jjnqcnnkhmfzqdrldi"
+red r3
+L36: .data 600, 218, -691, 892
+sub L219, L34
+mov #73, r0
+L37: jmp L63
+cmp L131, *r7
+red *r5
+stop
+stop
+add #38, L36
+prn L60
+L38: jmp *r0
+bne *r3
+sub #149, *r1
+L39: mov *r7, L161
+clr L31
+L40: add *r6, *r6
+rts
+bne L245
+add #-179, L183
+L41: .data 999, 85, 510, 477, -978, 522, 778, -795
+L42: jsr *r1
+not *r2
+inc r3
+clr L241
+jsr *r2
+sub *r7, r0
+prn L162
+; comment
+L43: not L13
+L44: add *r1, r5
+inc r0
+jmp L44
+L45: jsr *r6
+mov #119, r5
+L46: not *r0
+clr L36
+sub #-115, r4
+jmp L27
+L47: sub *r6, L164
+L48: add r4, *r7
+mov *r2, r3
+clr r4
+rts
+L49: prn L35
+add r2, r6
+bne *r5
+cmp #-46, r3
+; comment
+L50: clr L215
+L51: prn #11
+red L66
+cmp #-88, r2
+L52: dec L250
+not *r3
+rts
+L53: stop
+cmp *r1, L1
+red *r2
+inc r3
+jmp L79
+stop
+L54: clr *r4
+L55: prn #-238
+L56: add #-217, L243
+red L105
+rts
+rts
+jmp L222
+L57: inc r7
+L58: add *r2, *r6
+red L43
+prn L203
+red *r5
+L59: jsr *r2
+rts
+stop
+lea L73, L102
+jsr *r1
+lea L32, *r5
+bne *r4
+sub r6, r7
+red L207
+red *r4
+cmp L107, *r0
+bne *r2
+prn #147
+dec *r6
+clr *r3
+stop
+bne *r5
+cmp L228, #-145
+L60: .data -427, 475, -612, -154, 791, 957
+inc r7
+bne *r0
+jmp L38
+add r7, *r5
+dec *r4
+
+red L215
+L61: stop
+jsr *r4
+sub #7, L46
+add #-178, r6
+sub r2, L184
+add #-128, L36
+jsr L23
+mov L159, r3
+L62: .data 410, 266, -253, 223
+stop
+lea L143, r4
+mov #-226, r1
+jsr L25
+jsr L46
+stop
+red *r4
+L63: .data -686, 901, 919, 409, 593, -497, -579, 425
+L64: .data -712
+jsr *r1
+
+prn *r0
+L65: dec *r6
+clr r4
+sub #158, r4
+inc r6
+L66: clr *r4
+L67: .string "dkxrjdkleyvxeoyusxbw"
+dec r2
+L68: rts
+jmp L7
+L69: jmp L6
+L70: .data 775, -366, 960, 182, -655, 151, 110, -916
+jmp L11
+not r5
+L71: sub L22, r7
+; comment
+L72: .data 549, 23, -224, -637
+L73: jmp L223
+L74: stop
+L75: sub L253, *r3
+clr *r0
+rts
+sub *r7, *r5
+red *r1
+lea L39, L14
+L76: stop
+stop
+inc r6
+cmp L35, *r5
+cmp *r0, L17
+stop
+dec r7
+L77: prn L57
+dec L68
+jsr L9
+mov *r1, *r2
+L78: stop
+stop
+L79: inc L26
+cmp #36, *r3
+not r5
+L80: .data -401
+lea L150, *r1
+L81: dec L65
+L82: .data -999, 418, 547, -995
+lea L235, L183
+mov #172, L78
+L83: .string "ifayknmrlsuhv"
+jsr L212
+; comment
+stop
+L84: .data 149, 997, -510, -450, -439, -569, -41
+L85: red L67
+L86: .string "biys"
+bne L69
+sub L12, L51
+cmp r0, r6
+red *r5
+
+
+
+jsr L12
+L87: sub r2, L41
+L88: rts
+stop
+add r1, *r2
+prn r1
+stop
+dec L151
+L89: prn #243
+stop
+add L73, L183
+stop
+mov *r4, *r3
+L90: .data 92, -611, -989
+L91: jsr L170
+red *r2
+cmp *r1, r2
+lea L93, L175
+jsr L41
+stop
+lea L30, *r4
+cmp L227, L77
+stop
+dec r5
+L92: mov *r4, *r6
+L93: jmp L25
+; comment
+add #248, L38
+not r4
+jmp *r6
+rts
+not *r2
+inc r3
+not *r0
+lea L227, L8
+bne L108
+mov r5, L85
+add L243, L255
+bne *r3
+L94: jsr L240
+clr r1
+bne L124
+L95: .string "sskct"
+cmp #168, *r1
+stop
+rts
+red r6
+cmp L11, #75
+L96: jmp *r0
+rts
+jsr *r2
+prn r2
+prn L57
+L97: prn #17
+lea L95, *r1
+inc L7
+inc r7
+L98: dec *r5
+L99: jsr L155
+clr L117
+L100: sub L211, *r6
+clr r5
+jmp *r4
+cmp L241, *r1
+stop
+clr *r2
+L101: red r6
+L102: .data 419, -812, -623
+jmp L106
+L103: cmp r3, L176
+bne L63
+L104: inc r0
+clr r6
+sub *r2, L250
+L105: lea L49, *r6
+clr L89
+dec *r5
+stop
+prn #-221
+clr *r2
+L106: sub *r0, r2
+mov L13, r0
+sub #-130, r2
+L107: .string "kkwtgwz"
+; comment
+dec L65
+not L193
+sub #135, L14
+L108: sub *r4, r6
+L109: bne *r2
+clr *r4
+L110: cmp *r5, *r0
+cmp #101, *r2
+L111: .data -60, -185
+dec L258
+not *r6
+red L234
+rts
+sub #-14, *r5
+jmp *r6
+inc r0
+sub *r1, L139
+jmp *r3
+cmp #115, L94
+bne L207
+prn *r4
+L112: stop
+prn *r1
+sub *r4, *r2
+L113: prn #29
+L114: add *r2, r2
+sub L202, L123
+mov #-148, r4
+stop
+red r0
+L115: .data -991
+add r2, r2
+clr *r6
+jmp L14
+add *r1, r6
+
+L116: cmp L198, *r3
+dec r6
+L117: lea L210, *r2
+lea L73, L16
+L118: prn #40
+add r7, r5
+L119: red r6
+sub #-231, *r2
+bne *r0
+mov #2, r6
+rts
+bne L41
+L120: jmp L260
+L121: cmp L194, #-151
+jmp L114
+L122: not L181
+lea L235, *r3
+L123: .data 728, -529, -77, 770, -375
+L124: mov L197, *r6
+; comment
+dec L138
+dec L88
+cmp L211, #-81
+jsr L213
+L125: prn r0
+not L92
+L126: lea L178, L98
+jsr L204
+L127: red r6
+clr L155
+rts
+L128: .data -649
+red *r4
+bne L34
+prn r0
+rts
+rts
+; comment
+stop
+inc L57
+jmp L87
+rts
+L129: jsr *r1
+L130: .data 668, -757
+jsr *r1
+L131: not *r5
+red L110
+L132: rts
+rts
+stop
+bne *r2
+not L61
+L133: stop
+L134: add *r3, L196
+L135: jsr L54
+clr *r0
+mov L109, *r0
+red *r7
+red L176
+L136: sub *r3, r7
+sub *r0, L233
+L137: jsr L23
+prn #-182
+dec L129
+
+mov L234, *r0
+L138: lea L65, r2
+L139: cmp r2, #107
+bne *r5
+dec L140
+L140: rts
+stop
+prn r7
+L141: .string "kaaaqhemswfz"
+L142: .data -193, 775, 55, -830
+L143: jsr *r2
+cmp *r3, #170
+mov #148, L261
+L144: .data -275, 788, 518, -85, -682
+L145: sub L7, L203
+lea L105, L87
+not r2
+L146: stop
+bne L11
+clr *r7
+jsr L87
+L147: .data 240, -601, 707, 793, 921, 966
+jsr *r6
+dec r7
+lea L13, *r7
+stop
+L148: bne *r1
+jsr L56
+stop
+jsr L188
+jsr L131
+bne *r1
+clr *r5
+jmp *r1
+dec *r4
+L149: prn #-174
+mov #-225, r7
+rts
+red r5
+; comment
+mov #-2, *r2
+jmp *r7
+clr *r1
+mov r4, L193
+add r4, L219
+; comment
+sub r5, r0
+L150: lea L14, L112
+inc r4
+inc *r2
+prn #-205
+inc L107
+cmp *r6, #-203
+dec *r3
+L151: .data -577, 139, 505, 258, 744, 716
+prn L232
+inc *r1
+jsr L15
+cmp *r1, r7
+jmp L218
+mov L193, r5
+sub #247, *r4
+jsr *r0
+add L226, *r3
+L152: .string "ygd"
+L153: cmp #230, *r1
+clr r4
+cmp L229, r7
+clr *r1
+sub L193, r1
+dec *r1
+
+jmp *r0
+L154: jmp *r2
+red *r5
+mov #228, *r6
+lea L159, *r6
+inc *r6
+inc L258
+not r2
+L155: .data 783, 989, 441, -585, 974, 20
+L156: cmp r0, L79
+bne *r1
+prn #-17
+cmp L57, r6
+jsr L251
+add r4, *r5
+cmp #-122, L214
+inc *r1
+stop
+L157: .string "nazgcunrwdostl"
+sub *r0, *r1
+L158: .data -316, -678, 406, -236, 587, 2
+L159: sub #251, L254
+cmp #-256, r7
+sub *r0, r4
+mov #34, L213
+L160: .data 453, 598, 343, 543, -997
+L161: .string "qekbcdzchfamxghppawbzoao"
+L162: inc *r6
+L163: prn r5
+bne *r0
+rts
+lea L222, *r6
+cmp L53, L68
+red r3
+L164: .data -489, -547, -177, -452
+L165: .string "frvmqevqskcubunyizompbfk"
+mov r4, L50
+bne L194
+sub r3, *r5
+L166: .string "wrfgisuffenxafrgtqjdd"
+cmp *r0, *r0
+; comment
+lea L147, r5
+bne *r7
+L167: .string "pxspvqghhcgcfaxjok"
+sub #212, L3
+L168: not *r3
+L169: red r6
+add *r7, L96
+L170: stop
+add *r6, L205
+inc L76
+bne L5
+jsr L113
+prn L192
+prn #-109
+dec *r4
+add *r0, *r4
+stop
+L171: prn L165
+not L229
+L172: lea L146, L201
+L173: jmp *r6
+rts
+L174: jmp L256
+not *r2
+mov *r4, r4
+L175: lea L134, r7
+red *r5
+dec L69
+dec *r7
+not r3
+L176: dec L160
+jsr L65
+add r4, *r3
+not *r5
+add #74, *r4
+inc r7
+sub #-18, r6
+prn r0
+cmp #231, L119
+lea L173, r7
+not *r0
+lea L252, r3
+L177: mov #216, *r7
+clr *r2
+bne L198
+jmp L261
+clr *r4
+L178: .string "tgtgyvysymr"
+
+jmp L214
+L179: jsr L187
+stop
+prn r4
+L180: mov *r0, r5
+not *r6
+add L247, L141
+jsr *r1
+L181: add L220, L221
+sub #-18, *r0
+L182: dec r6
+
+rts
+L183: .string "tqcicqppbaeqpiogmoxwt"
+jmp L263
+clr *r3
+L184: .string "hfrkgwpcqdpwwasmfk"
+L185: dec L158
+rts
+mov #114, *r3
+inc L246
+clr r0
+L186: sub L262, L261
+bne *r0
+clr L100
+mov L171, L17
+
+L187: .string "ldihilfhewuvm"
+jsr L78
+L188: .string "taeywtczascehpbwqbtbo"
+L189: clr r7
+mov #127, r0
+L190: .data 636, 652, 998, 510, 127
+inc *r5
+clr r2
+L191: rts
+prn L215
+sub L211, *r0
+jsr L218
+cmp L36, #-172
+L192: .data -629, 733, -328
+not r6
+sub r3, L243
+L193: red r2
+prn *r5
+add #-55, L173
+dec L62
+L194: inc *r2
+prn r7
+jmp L244
+; comment
+clr *r2
+clr r4
+L195: dec L30
+L196: prn r3
+; comment
+mov L170, r0
+rts
+L197: .string "xsesgcxovhmjilq"
+rts
+L198: bne L212
+clr *r4
+cmp #-33, #-29
+prn *r0
+
+dec *r0
+L199: .string "yv"
+L200: .string "nzs"
+sub #-23, L233
+dec *r3
+clr L115
+L201: bne *r7
+; comment
+jmp *r2
+not L222
+rts
+not r1
+rts
+prn L43
+jmp *r2
+L202: jsr L205
+L203: .string "oemiatsbrofclqdr"
+prn r1
+mov *r4, L229
+add r2, *r4
+L204: add *r6, r7
+clr L238
+dec *r0
+L205: .data -822, 931, 578, -837, -413
+stop
+sub *r5, *r5
+mov L261, L229
+clr *r4
+rts
+dec *r7
+mov r2, L58
+red *r2
+stop
+L206: stop
+prn r2
+L207: jmp L196
+bne *r5
+L208: .string "ghawabcmnkrmvsq"
+sub L232, *r1
+; comment
+prn *r2
+L209: .string "nzdjvpixvgzj"
+not *r5
+jsr *r4
+add r6, r1
+dec L123
+clr *r3
+add L211, *r3
+cmp #-167, *r1
+red *r5
+L210: .string "buttyiysymycn"
+red *r0
+rts
+red L111
+rts
+L211: cmp r2, r1
+cmp L90, #-210
+inc r5
+not *r3
+mov L219, *r0
+sub #-210, r1
+rts
+jsr L98
+
+mov #-150, *r6
+L212: stop
+inc r6
+L213: .string "zabmmdwatrdqkxjmf"
+add #-213, r4
+L214: .string "pl"
+lea L53, r5
+cmp #214, *r6
+stop
+mov #-210, *r1
+jsr *r5
+stop
+jmp *r2
+inc L243
+add *r4, L169
+L215: jsr L263
+sub r5, L217
+inc r5
+add r0, r6
+rts
+bne L252
+L216: .string "lgb"
+not *r4
+
+lea L210, *r2
+L217: .string "euxvj"
+dec *r7
+add *r1, L257
+jsr L228
+L218: .string "cohrdrrgthidxkxkfp"
+clr *r5
+rts
+not r2
+inc r3
+L219: .string "cuotyexsklvpo"
+mov r1, r4
+add r3, r1
+L220: .data -37, -61, -529, 841, -20, 951, -811, -934
+L221: .string "kefoebssdtidjv"
+stop
+lea L235, L249
+cmp #160, #-248
+rts
+
+mov *r1, *r1
+
+inc r1
+stop
+prn #-56
+L222: mov *r5, L200
+lea L257, r7
+L223: clr *r3
+jmp L260
+stop
+stop
+add r2, r2
+jmp *r7
+
+dec L35
+not *r5
+mov *r1, r2
+dec *r3
+stop
+lea L226, r7
+L224: rts
+add L251, *r6
+jsr *r2
+lea L231, r5
+bne L133
+L225: bne L246
+rts
+dec *r1
+not L107
+jsr L243
+L226: .string "b"
+stop
+
+
+cmp L60, *r4
+mov L78, r7
+jsr L16
+mov r5, *r7
+L227: .string "wgmnypmmhavezqiinuqpeo"
+jsr L260
+; comment
+bne L218
+inc L244
+prn #148
+lea L243, r4
+inc r2
+; comment
+L228: .string "bywzp"
+not L235
+L229: add #-161, *r3
+add #151, L71
+dec L255
+jsr *r6
+L230: inc *r7
+mov L239, r5
+mov #7, r3
+rts
+L231: .data 528, -250, -475, -865, 439, -180, 774, 252
+red *r4
+L232: sub *r6, *r4
+jmp *r1
+red *r7
+not *r0
+clr r3
+mov #-137, *r1
+clr L32
+L233: .data 50
+clr *r5
+prn #81
+lea L258, L9
+not *r2
+prn #150
+L234: .string "lamtmstteufqgaz"
+rts
+bne L71
+cmp *r4, #103
+inc *r0
+prn *r2
+L235: .string "wdcivdsrhyho"
+L236: inc L242
+L237: add r1, r5
+cmp #97, L252
+not L248
+jsr L80
+jsr L259
+stop
+L238: .data 9, 658, -691, 105, 827
+L239: not *r3
+prn *r1
+dec r3
+stop
+jmp *r4
+rts
+L240: lea L215, r4
+L241: clr *r1
+
+L242: .data -684, -598, 516, -742, 168, 297
+L243: inc L245
+stop
+cmp L256, *r1
+jsr *r1
+cmp L252, #109
+bne *r5
+L244: clr r3
+L245: .string "qnlesaxbgmfhspendfbii"
+clr r7
+L246: jsr L137
+sub L241, *r6
+cmp *r7, #215
+clr *r1
+not L202
+red *r3
+bne L61
+L247: cmp #109, #189
+L248: .string "qxxbpthqgmzofeeqpm"
+sub *r0, r2
+cmp r7, #-172
+prn #167
+prn *r6
+L249: red *r0
+add r3, *r0
+L250: .data -561, 258, -545
+mov L261, r0
+L251: clr r2
+L252: mov *r3, *r6
+bne *r3
+rts
+jmp *r2
+red *r2
+not r3
+bne *r1
+add *r1, L201
+inc L259
+jmp *r6
+sub L254, *r0
+sub L195, L261
+prn *r2
+prn r4
+L253: .data 384, 439, 398
+red r0
+L254: .data -320, -696, -560, -651, 70, -88, -488, 97
+L255: not r1
+L256: jmp *r6
+sub r2, L253
+L257: .data -856, 13, -921, -589
+sub L262, r0
+jsr L3
+L258: mov r5, r1
+L259: red *r2
+inc r5
+L260: not L262
+dec *r6
+bne L261
+not L261
+bne L59
+rts
+not *r6
+L261: .data -545
+lea L16, r4
+clr L251
+lea L262, r5
+not r6
+red L4
+clr r6
+rts
+lea L237, *r6
+L262: cmp #-177, r2
+bne *r1
+red L62
+L263: inc L251
+add #-242, r3
+add L134, r1
+red r7
+; comment
+bne L25
+clr r0
+inc *r0
+stop
+lea L213, *r0
+jmp *r3
+stop
@@ -0,0 +1,1019 @@
+; Generated by genCorpus --seed 10
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+L0: rts
+cmp L0, L0
+inc L0
+jmp *r7
+L1: stop
+L2: .string "aooopas"
+dec L143
+inc r6
+stop
+L3: not L0
+L4: .string "civynodb"
+prn L2
+not r6
+add #-157, r0
+jmp *r1
+inc r1
+rts
+jmp *r5
+prn r2
+stop
+bne L66
+stop
+add r7, L0
+not r2
+jsr *r0
+not r5
+rts
+dec L77
+L5: lea L2, L119
+not L182
+clr *r5
+clr L63
+
+red r7
+L6: rts
+mov r7, r0
+L7: dec r4
+cmp L123, r6
+jmp L202
+mov #-54, *r2
+add *r3, L177
+not r2
+L8: add L24, L104
+L9: cmp #18, *r4
+L10: jsr *r1
+jsr *r2
+L11: not r6
+dec r5
+prn r3
+L12: prn r6
+L13: .string "xucbusjzy"
+L14: sub r5, r2
+cmp #-143, L6
+jsr L140
+mov L13, r6
+jmp *r7
+jsr *r6
+L15: red *r1
+; comment
+clr r0
+L16: clr *r2
+L17: rts
+jmp L174
+L18: .data 123
+prn L18
+lea L127, *r3
+rts
+inc L14
+stop
+mov r7, r7
+L19: add #14, L109
+bne L11
+inc *r1
+red r5
+stop
+bne L246
+lea L7, r4
+add *r3, *r3
+sub *r6, L8
+lea L78, *r6
+L20: .string "ljsvhhjmnpy"
+L21: mov r2, L191
+L22: add L0, *r4
+prn *r4
+add #106, L195
+L23: cmp #-50, *r1
+lea L161, L86
+rts
+clr *r1
+L24: .string "kzrqkkg"
+sub L8, r3
+mov *r0, *r1
+stop
+L25: jmp L6
+jsr L232
+inc *r4
+L26: .string "azhlukgfel"
+L27: .data 555, -308, -110, 675
+L28: mov L140, *r2
+L29: sub *r7, *r5
+L30: sub L193, r2
+clr r3
+jsr L26
+; comment
+lea L81, r6
+prn *r4
+cmp L14, *r4
+L31: not r0
+sub *r4, *r2
+mov L26, r1
+bne L47
+L32: .string "anyfdtbfnxqztdgxbfkf"
+inc L220
+bne *r1
+cmp #-212, *r2
+L33: .string "anehdranwkmdrzvlvo"
+clr r5
+L34: inc *r2
+sub L20, *r7
+not r3
+prn r3
+L35: cmp r3, #77
+L36: clr r4
+stop
+L37: .string "agvywanipquexkqh"
+L38: .string "ztmxjpenuzrsbdzepdmqdew"
+lea L6, *r0
+dec *r6
+clr L209
+jmp L249
+L39: prn *r3
+L40: .string "drwumf"
+L41: stop
+; comment
+add #-110, *r0
+jsr L72
+lea L122, r3
+dec *r6
+sub *r3, L24
+
+cmp r5, L38
+add *r5, *r7
+lea L218, *r2
+cmp *r0, #155
+prn r6
+prn L18
+L42: stop
+jsr *r6
+red r0
+L43: .string "oyrtothgbjipzbdmk"
+add L43, *r3
+L44: jmp L10
+red r4
+clr *r2
+add r6, L230
+L45: .data 384, 277, 615, 146, 413, -694, 413, -644
+; comment
+mov r0, L36
+rts
+lea L204, *r1
+dec r0
+add #60, r1
+L46: clr L43
+cmp #23, r6
+; comment
+L47: lea L221, *r1
+L48: dec r0
+not r4
+jsr L241
+rts
+jmp L127
+stop
+add r3, L42
+not *r1
+
+red *r3
+add *r7, r7
+L49: mov r6, L92
+jsr *r6
+L50: .string "dlp"
+lea L39, L52
+inc *r7
+inc *r5
+jmp *r3
+clr r3
+lea L28, r2
+
+dec *r2
+bne L175
+bne L1
+L51: prn *r7
+L52: .string "tkejpqlnmrrvciv"
+red *r6
+cmp L50, r4
+red L14
+rts
+L53: stop
+red *r5
+add r1, r6
+bne *r2
+sub #-5, r6
+L54: .data -427, -636, -731, 412, -40, -533, -923, -724
+stop
+clr r1
+dec L187
+jsr L30
+add L135, r6
+L55: .data -965
+mov *r7, *r6
+
+L56: red r2
+prn L127
+dec L2
+clr r5
+L57: stop
+clr r0
+sub r0, r2
+L58: .data 428, 906
+L59: .data 53, -28, 957, 144
+bne *r6
+add L131, r2
+sub #-136, *r2
+lea L261, L177
+sub r7, *r3
+clr L19
+sub r5, r1
+L60: prn L35
+mov *r1, L47
+jmp L141
+clr r6
+L61: .data 957, -673, -674
+inc L99
+add r5, L106
+sub L126, *r6
+sub L21, L32
+bne L56
+L62: .data -563
+dec *r7
+prn #54
+jsr *r4
+L63: .data -942
+red *r0
+jmp L169
+lea L10, *r7
+sub *r6, r1
+L64: red r1
+prn r6
+
+bne *r3
+prn *r5
+prn r7
+dec r2
+cmp #30, r1
+lea L88, L62
+cmp L186, r6
+
+L65: .string "vhjnaxdplglrnpdzg"
+; comment
+L66: inc *r1
+dec L22
+L67: jsr L199
+not r1
+inc r1
+cmp #-39, #-59
+L68: .string "knmniqzwhdlc"
+mov *r2, r0
+add #-216, L2
+sub #-186, *r3
+add *r2, L243
+L69: .string "zsmkemizaexcpitqrazhfpb"
+bne L237
+bne L130
+jmp L145
+L70: inc L155
+inc L157
+sub L104, *r1
+not r2
+clr L8
+red L52
+cmp *r3, r4
+lea L43, *r1
+sub L231, r3
+clr L85
+L71: stop
+bne *r7
+bne L138
+jsr *r3
+rts
+cmp L9, #199
+L72: lea L191, L105
+not L253
+L73: jsr L132
+add r4, L92
+add r4, r2
+rts
+L74: mov r1, L171
+cmp r3, #147
+sub L138, *r6
+clr *r5
+mov *r2, L30
+mov L220, r1
+L75: dec L51
+
+not r7
+sub #-167, L114
+inc L232
+prn L46
+add *r4, *r0
+red *r7
+dec L224
+jmp *r5
+red *r0
+L76: .string "svfisgbekw"
+sub L18, L67
+jmp *r7
+inc L65
+L77: .string "hdgarnarktfnfacly"
+rts
+; comment
+L78: prn *r6
+rts
+add r5, *r4
+L79: clr L179
+L80: jsr L78
+rts
+prn #134
+bne L180
+red r1
+L81: clr r0
+stop
+clr r4
+add #20, r6
+L82: not *r4
+mov *r3, L40
+rts
+add r7, r0
+stop
+stop
+L83: red *r6
+mov r6, *r1
+mov #-45, *r0
+L84: .string "orkukq"
+L85: not *r5
+
+L86: add L10, *r5
+rts
+clr L33
+cmp L180, r2
+prn L255
+clr L9
+red r0
+L87: .data 794, -331, 465
+lea L153, L49
+red *r3
+red r5
+jsr L3
+prn #67
+L88: lea L64, *r4
+jsr *r3
+sub r7, *r3
+cmp r1, *r5
+L89: mov #-208, *r6
+red L60
+sub r7, *r3
+cmp #-149, r4
+L90: dec *r3
+bne *r5
+inc *r6
+add r4, L88
+inc r2
+not *r4
+jsr L185
+L91: .data 785, 887, 845, -517
+L92: stop
+not *r0
+red *r0
+L93: .data 668, 934, -267, 386, -554, 314
+inc L10
+L94: .data 594, -236, 476
+sub #105, *r3
+L95: clr *r0
+prn r2
+jmp L150
+L96: prn r3
+L97: sub L150, *r6
+rts
+sub L150, *r4
+L98: .data 266, 746, 501, -947, -700, 756, -650, -855
+red L213
+L99: bne L223
+L100: prn *r4
+
+not r2
+
+lea L156, r1
+not r2
+; comment
+add #200, r2
+L101: lea L127, *r6
+jsr *r4
+L102: jmp *r1
+
+not L14
+mov r6, r2
+jsr *r0
+L103: prn *r4
+L104: stop
+clr *r0
+clr r6
+jmp L34
+add r0, r2
+not r6
+; comment
+rts
+lea L118, *r3
+prn #-181
+jsr L29
+L105: .string "ystmnzibfkkzdrapmz"
+bne *r4
+jsr L22
+bne L13
+dec L140
+lea L164, *r5
+add L1, r7
+rts
+lea L126, *r7
+inc L178
+
+red *r6
+L106: add r3, *r2
+L107: .string "cdoipefzc"
+add *r3, L89
+sub r6, L45
+L108: dec L50
+L109: red r0
+mov r2, *r1
+L110: bne L106
+mov L169, r1
+L111: jsr L154
+L112: .string "ajkvgcptywcuudnttuxkqkb"
+L113: .data 830, -31, 323, 794
+prn r2
+L114: not L63
+rts
+L115: .string "race"
+L116: .string "mxbhqzqbaatyabufblwfr"
+jmp *r2
+lea L82, r2
+L117: .string "pzbxgflsrbcbmoc"
+bne *r6
+mov #247, L246
+L118: dec L160
+cmp #-223, #28
+cmp L125, *r7
+L119: clr r4
+cmp L170, r0
+
+L120: .string "kfcrtztmzoeoozyhczfdu"
+not r1
+prn L188
+not *r4
+L121: .string "nbffbdsuixxc"
+
+sub #-7, L69
+not L120
+sub #-107, *r5
+L122: inc r5
+red r0
+L123: rts
+cmp r3, #84
+L124: inc *r0
+not L43
+clr *r6
+red L101
+inc L58
+jmp L248
+jsr L43
+; comment
+rts
+add L26, r7
+jmp L82
+lea L109, L95
+L125: red r5
+L126: clr L29
+L127: bne L258
+add *r7, r2
+L128: inc *r2
+cmp L29, *r0
+dec L143
+inc *r7
+not *r3
+prn r4
+L129: .string "fpgy"
+not r4
+L130: .data 765
+stop
+jsr L35
+lea L19, *r2
+; comment
+L131: .data 799
+rts
+sub r5, r4
+L132: rts
+sub L219, r3
+stop
+lea L47, *r4
+sub L131, L62
+jmp *r5
+jmp L75
+mov L228, r2
+jmp *r1
+dec *r6
+L133: clr *r3
+clr r1
+add #-136, *r2
+L134: inc L198
+L135: .data -759, -239, -937, -360, -831
+L136: red *r3
+dec L77
+sub *r6, r4
+jsr *r1
+red *r2
+jmp L220
+add *r4, L126
+L137: .data 77
+not *r1
+L138: .data -528, 196
+jmp *r6
+not *r3
+L139: sub L68, r7
+inc L41
+clr *r0
+cmp L115, r0
+mov #-53, *r3
+cmp #-39, r1
+stop
+L140: .string "bfgiry"
+jsr *r1
+red *r7
+L141: lea L126, L257
+dec *r2
+dec L233
+L142: .data 62, 274
+jsr *r4
+red L200
+red L245
+prn L184
+add r1, L246
+inc L141
+not L39
+lea L35, *r4
+sub #140, L176
+jsr *r7
+inc *r5
+L143: lea L130, L254
+L144: inc r5
+L145: red *r3
+inc *r7
+L146: .string "wqibvnlzmidnuwbw"
+jsr *r7
+jmp L30
+bne *r5
+dec r3
+lea L178, *r0
+L147: .data -183, -957, -382, 306, 498, 66, 329
+red L131
+lea L130, *r3
+L148: .data -825, -216, 719, 180, -970
+mov *r6, L224
+L149: .data 65, -904, 536, 812
+red *r7
+rts
+sub *r2, r7
+dec r2
+L150: mov *r5, r0
+jsr L186
+lea L257, r2
+not r3
+inc r0
+L151: stop
+L152: jsr *r1
+dec r5
+jsr *r7
+; comment
+L153: dec *r0
+cmp r1, *r2
+prn L197
+not r1
+lea L218, L89
+prn #242
+stop
+jmp L38
+sub *r5, r0
+cmp r1, L247
+clr r1
+add r5, r5
+prn r1
+dec *r4
+L154: cmp #-72, r5
+; comment
+L155: .string "nnrhqouxvjjy"
+clr *r7
+rts
+not r6
+not r3
+add *r1, L256
+jsr *r4
+L156: .string "rldgodryagilkckbpncco"
+L157: .data -529, 731, 782, -869
+lea L100, L241
+cmp L204, *r0
+add #191, r2
+lea L256, L195
+L158: .data 515, -433, -48, -260
+prn *r5
+rts
+rts
+L159: sub *r1, r1
+stop
+lea L238, L4
+clr L247
+add #-40, L222
+jmp L256
+L160: .string "pdwaarlvlirfybdckuc"
+L161: .data -609, -822
+add #-160, L142
+sub *r4, r4
+clr *r6
+sub r3, *r1
+sub L113, *r7
+L162: rts
+jsr *r6
+dec r6
+jmp L86
+not L199
+jsr *r2
+stop
+lea L1, *r5
+L163: red *r3
+L164: .data 613, 780, 697, 874, 620
+L165: stop
+; comment
+inc *r4
+lea L186, r2
+L166: rts
+red r0
+L167: .data 789
+L168: jmp *r1
+red *r4
+; comment
+jsr L30
+not L239
+cmp *r7, r5
+red r6
+L169: lea L33, L111
+dec r3
+clr L38
+L170: not L86
+add #24, r6
+
+jmp L139
+L171: jsr L81
+cmp r5, r3
+L172: inc *r6
+rts
+jsr *r0
+rts
+add *r0, L119
+prn *r6
+not r3
+jsr L203
+L173: .string "jsq"
+sub r5, L82
+rts
+L174: lea L252, r6
+red *r5
+L175: .data -826, 163, 933, 820, -79, 740
+rts
+rts
+jmp *r3
+clr r7
+sub L216, *r7
+L176: .string "owjvwbawpdfkxdx"
+jmp L210
+dec L242
+jsr *r1
+rts
+dec L216
+inc *r2
+prn #-233
+L177: rts
+L178: mov L137, L133
+rts
+add L220, L203
+stop
+L179: .string "cxqkgytkqtq"
+L180: .data 251, 838, -969, 212, -682, -585, 328
+clr *r3
+inc L125
+L181: cmp *r3, L150
+L182: prn L47
+L183: dec L229
+L184: .string "waegohltqjactemaf"
+L185: jsr *r5
+prn r3
+dec r1
+L186: lea L196, r7
+L187: mov *r7, L37
+add *r7, r5
+dec r4
+dec r5
+red L191
+mov L120, L51
+L188: .string "mhujfqiqopcjtoolelxesxxw"
+cmp #-47, r1
+stop
+; comment
+inc r3
+add *r5, L163
+L189: bne *r0
+lea L181, r7
+L190: clr *r5
+jsr *r3
+jmp *r5
+L191: red L206
+L192: .string "dedvymfjscrb"
+clr r6
+L193: .string "wygekoi"
+bne *r2
+dec r3
+L194: .data 291, 209, 902, -968
+L195: .data 126, 771, 487
+bne L212
+cmp L52, #-239
+clr r7
+sub *r1, L12
+cmp L225, L158
+L196: stop
+L197: .data 593, -431, -92, -155, -704, 997
+red L25
+dec *r4
+stop
+stop
+not r5
+bne L193
+L198: inc r1
+L199: cmp r6, #-141
+clr L252
+prn #144
+bne *r0
+prn *r7
+dec r3
+not L236
+inc r6
+
+clr *r1
+mov #237, L244
+red r0
+L200: .data -694, 623, 149
+jmp L261
+mov r3, L104
+not L217
+dec r7
+dec *r7
+dec L243
+L201: dec r2
+L202: clr *r7
+L203: sub r0, *r4
+bne *r7
+jmp L261
+rts
+stop
+jsr *r6
+lea L223, r4
+jmp L213
+jmp L23
+not r2
+inc r4
+stop
+L204: cmp r2, r1
+dec *r3
+inc L226
+jsr L141
+bne L251
+bne *r1
+lea L256, *r7
+stop
+; comment
+prn *r1
+L205: prn L32
+red *r4
+prn #-119
+
+L206: mov r0, r7
+clr *r3
+L207: jmp L98
+L208: .data -1000, -344, -179, 427, 582, -804
+mov L257, L244
+L209: sub L94, *r2
+red L244
+L210: jmp L255
+stop
+L211: stop
+dec *r5
+rts
+dec L177
+cmp #170, #90
+L212: jsr *r0
+L213: inc r0
+red r1
+not *r0
+dec r1
+
+clr *r0
+clr *r7
+L214: sub L248, r0
+sub r3, *r0
+L215: sub L62, r0
+L216: red L77
+L217: rts
+dec r0
+
+L218: .data 902, 78, 331, -325
+
+lea L53, L86
+add r0, *r0
+rts
+stop
+red L227
+stop
+jsr *r6
+lea L193, *r0
+L219: .data -795
+jsr *r0
+sub #-161, *r3
+L220: clr r3
+jsr L225
+L221: not L262
+not r4
+dec L56
+rts
+red r5
+L222: cmp #-199, L73
+sub L225, r1
+L223: .string "flfousa"
+; comment
+red r0
+lea L259, *r1
+; comment
+red r4
+not r4
+L224: bne *r4
+cmp r0, L253
+clr *r0
+cmp *r2, #-98
+lea L244, *r4
+L225: .data -322, 216
+mov r7, L241
+stop
+L226: .string "wizkuaqiviwlvygppnweslp"
+prn #43
+L227: bne L230
+stop
+red L215
+dec r7
+bne L252
+rts
+mov r7, L164
+not r4
+
+L228: jsr L250
+bne L252
+L229: cmp L246, #-37
+jsr L164
+inc *r5
+L230: .string "cgsu"
+mov *r0, *r6
+bne *r5
+L231: .string "chmnjzcrifjc"
+
+L232: sub #242, r3
+jsr L257
+jmp L84
+cmp #-144, L222
+L233: rts
+L234: jmp L242
+red r6
+red *r2
+sub #-251, L245
+jmp L181
+rts
+not *r0
+L235: .string "jgqcsobsbfpnyoroysa"
+clr L255
+rts
+lea L259, r1
+lea L237, r6
+rts
+L236: .data 237
+L237: .string "tvmzexwteb"
+mov #49, r2
+dec *r6
+prn #11
+rts
+cmp *r3, *r5
+L238: .string "zdc"
+red r2
+mov L69, r1
+clr L260
+rts
+red r0
+L239: bne *r6
+L240: .data 128, 56, 671
+not *r4
+jsr L248
+prn L249
+L241: prn L83
+jmp *r0
+mov #-158, r1
+stop
+dec *r2
+
+L242: add #-177, *r3
+L243: .string "mgdmkt"
+L244: .data 356, -748, 890, -755, 874, 400, -220
+L245: rts
+dec *r3
+L246: .string "ndumddjzmsqemnakwkybix"
+cmp #42, L104
+bne L107
+rts
+jsr *r0
+not r4
+add r5, r5
+red r6
+L247: inc L192
+stop
+inc L19
+L248: sub *r5, L257
+L249: .data 412, 439, -965, 788, 992, -335, 623
+red *r6
+dec r2
+stop
+sub r0, *r7
+clr L143
+L250: .string "vnwht"
+cmp r4, r1
+L251: .data -801, 925, 481, -792, -128, -372, 679
+sub *r5, *r4
+not L77
+L252: sub *r7, r1
+prn *r0
+jmp L257
+jsr *r5
+clr *r5
+cmp #47, #227
+jmp *r6
+; comment
+clr *r2
+prn L74
+L253: stop
+jsr L60
+L254: prn *r7
+cmp #30, L260
+not r6
+jsr L257
+inc r6
+inc r2
+L255: .data 140, 351, -214, 782, -500, 478
+L256: cmp *r2, r4
+L257: jmp L258
+lea L1, L117
+L258: jmp *r0
+jsr *r4
+L259: .data -524, 752, -725, -281
+jmp L98
+bne *r7
+jmp L260
+jmp L158
+L260: .data -811, -215, 900, -202, -713
+prn r4
+bne *r0
+lea L262, *r1
+lea L232, *r4
+
+dec r2
+jsr *r0
+dec *r7
+clr L263
+L261: rts
+lea L153, r1
+rts
+L262: lea L57, L123
+inc *r5
+rts
+L263: inc r1
+rts
+lea L77, *r7
+cmp r5, #128
+prn L208
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 1
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+lea L220, *r4
+L0: .data -373, -751
+; comment
+L1: .string "arscyyjxykbhmrabhhcdklcp"
+L2: .data -36, -368, 299, -172, 857
+L3: .data -915, -154, -314, 964
+mov L1, r3
+L4: .string "trmozibxol"
+L5: .string "owotozrxriyvlehyujsfcfo"
+L6: .string "pulmhftnpdohxpwkpeh"
+L7: .data 942, -377, -911, -807, 206, 989
+L8: .string "leklbxdurhvorwvle"
+L9: .string "sxbbfnzqz"
+jmp *r1
+; comment
+rts
+L10: .string "nbxvqzacbdqok"
+L11: .string "pfunln"
+not L185
+lea L70, L7
+; comment
+sub *r7, *r6
+sub r7, *r7
+L12: .string "gnrpkrovbiaoyhfqcjslcyzk"
+L13: .string "zwdgszpgrunrtl"
+L14: .string "je"
+L15: .string "fgmucz"
+L16: stop
+mov r7, r5
+L17: .string "gfnrqfokytlwfgrksig"
+L18: .string "dsm"
+lea L5, *r4
+L19: .data -29, -263, -90
+L20: .data -653
+sub L15, L1
+L21: .data -753, -342, -38
+; comment
+L22: lea L11, L106
+L23: .data -661, -767
+L24: .string "mfwoy"
+jmp L3
+jsr L14
+inc L111
+L25: .data -17
+L26: .data -703, 104, -258, -605
+L27: .string "mpjbdlwwtfyugaio"
+L28: .string "ecnqhxwyc"
+L29: .data -36
+clr r6
+cmp r5, r6
+L30: .string "giuchpzzcdd"
+L31: .data -179, -904, -831
+L32: .data -767, -797, -935, -119, -649
+prn *r0
+L33: add r2, L41
+L34: .string "tjxqdswaekdlhxynpbwxunqi"
+lea L202, L26
+jmp *r0
+rts
+red L137
+
+L35: .data -480, -116
+stop
+L36: .string "jkjy"
+L37: .data 635, 526, 680, -855, -431, 571
+L38: .data 66, -548, -542
+stop
+L39: .string "frjigzjhzlvbtbxkvdji"
+L40: .data 696, -446, 539
+sub L143, r2
+L41: .data -58, -656, 550, -729, 485, 83
+cmp *r3, #-17
+L42: not r0
+L43: sub L263, *r0
+L44: .data -633, 113, -198
+L45: .data 983, 865
+L46: .string "nrqrferb"
+; comment
+L47: .string "hvovcp"
+L48: .string "ajxirnc"
+L49: .data 581, 719
+L50: .string "h"
+L51: not L47
+clr L31
+; comment
+L52: .string "jgziaqsu"
+; comment
+L53: .data -733
+inc r6
+red L127
+L54: .string "jhpofhufgbqbtbul"
+lea L43, *r0
+L55: .data 569, 38, -463, 325, 997, 539, 528
+jsr *r6
+L56: .data 517
+L57: .string "ufimolloodyfjlf"
+L58: not L26
+cmp r0, #-158
+red *r7
+L59: .string "zvnfuqwlactutlwtwy"
+L60: .string "ftxjheb"
+L61: .data -865, -157
+L62: .string "wnojfd"
+L63: .string "sxih"
+not r6
+L64: .data 197, -889, -664, 941
+red *r0
+red L6
+lea L263, r5
+L65: .data 528, -374, 575, -238, -851, 772, 340, 474
+L66: .string "xvyjiwtkpdygua"
+L67: .data 739, 767, 494, -912, -82, -897
+L68: .data -786, -623, 227, 301, -696, 660, -75
+L69: .data 423, 515, 399, 681
+L70: .data 930, -571, 17, 727, -552
+L71: .data 614, 636, -473, 369, 475, 773, 405, 924
+add L21, r2
+L72: .string "seuatvzhdztoiaucygsagt"
+L73: .string "jpqerl"
+L74: .data -689, -272, 234, -559
+L75: .data -767, -478
+L76: mov *r3, *r5
+L77: .data 455, 607, -203, -176, -635
+L78: .string "avajtunxg"
+L79: .data -562, -802, 138, 728
+; comment
+L80: .string "md"
+L81: .data 648, -992, 944, 635, 21, 187, -711
+L82: .data 38, -36, 289, -884, -160, 834
+clr r1
+dec L66
+L83: .string "xymotdjl"
+lea L70, L53
+sub *r2, r7
+L84: .data -285, 0, 766, -643, 50, 745, -481
+L85: .data -376, -796, -697, -986, 226, -771
+L86: .string "jsgvsikitaqdbvbyfqn"
+stop
+jsr L84
+L87: dec *r0
+bne L84
+L88: .string "bkrdcvutkligypbhnwulpp"
+L89: sub r7, *r2
+L90: .string "mkxvhflrep"
+L91: .string "mrtvljiclmazj"
+L92: .string "wvajzinbgwsccjmlg"
+L93: .string "jtqsudftkstlkdb"
+inc *r3
+L94: .string "hcvlpzkjmqacrvdqr"
+L95: .data 986, -162
+; comment
+L96: .string "aicoxgrhwuazxn"
+clr L3
+L97: .data -623, 490, 457, 974, 394, 744, -740, 182
+L98: .data -867, -142, -201, 440, -377, 897
+prn r6
+red r0
+L99: .data -670, -127, -351, 90, -408
+bne L245
+L100: .string "okpavyjeupqzonbellaxvtmm"
+not *r2
+L101: .data -529, -51, -793, -695, 224, 7
+mov L1, *r2
+L102: clr *r5
+L103: .data 969, 108, 861, -673, 741, 413, -936
+; comment
+bne L67
+L104: .data 673, -95, -888, 705
+; comment
+jmp *r1
+mov r3, *r6
+jsr *r1
+add r2, L152
+L105: sub r6, r2
+L106: .string "sythy"
+L107: .data -34, 665, 919, -192, 738, -332
+L108: .string "woqsxrdekxtshgvxfubxhfdy"
+L109: .data 905, 703, -715, 352, -385, 925, 952, 734
+clr L145
+L110: jmp L28
+L111: .data 421
+L112: .string "wpvhptmclqoin"
+L113: .string "xpd"
+L114: .data -846, -879, -955, -171, -905
+L115: .data -370, 627, 163, -735, -495, -190, 760
+L116: .data 583, -121, 912, 296, 435, 299, 699
+L117: .string "b"
+L118: .string "gewctagoxptcdbwuiphdzs"
+L119: .data 940, 206
+L120: .data 849, 76
+L121: .string "bjwhrlbvzlizgpfrtl"
+clr *r4
+L122: .string "jfux"
+L123: .string "q"
+; comment
+L124: .data 420, 374, -921, 958
+L125: .string "auywwtbiig"
+L126: .data -108, -622, 934, -184, -733, -508, -892
+L127: .data 531, -462, -73, 617, 523, 716, -304
+; comment
+bne *r6
+L128: .data -744, 871, 808, -99, 303, 292, 888
+jsr L73
+stop
+L129: .data -477, 461, -653, 718
+L130: .string "rphjokvdzeunydfljxlu"
+lea L86, L107
+L131: prn #-122
+prn r6
+L132: .string "atndzynsjxxgdnoypgmeo"
+stop
+L133: .data -587, 403, -633, 31, -917, 412, 177, -563
+jmp *r6
+L134: .data -211, 372, -485, -361, -615, -324, -980
+prn *r2
+L135: .data 242, -657, -782
+L136: .data -953, 777, -315, -836, -115, -827
+add #-99, L100
+L137: .string "xbvuxv"
+L138: .string "imlyesyhunaoivtctllch"
+L139: .string "xzromytyabhszgaasqng"
+jsr L75
+L140: inc *r4
+L141: .data 390, -762, 327
+jsr L94
+L142: .string "rzlplubwrmekr"
+L143: .string "jkjyktabwycougl"
+sub r7, L240
+L144: .data -274, -373, -172
+L145: .string "wzbealbbiijjvamlpn"
+not r5
+L146: .string "sww"
+jsr *r4
+; comment
+red r0
+bne *r6
+L147: .string "nnhsxxvecpja"
+L148: .string "zgmwuepeiicuhjif"
+L149: .data -17, 25, -198, -687
+L150: .string "tdmselnhptsybqmlkrmcy"
+red r0
+L151: .data -744, -21, 999
+L152: .string "jikx"
+L153: .data 769, 797, -446, -159, 644, -19, -503, -36
+L154: .string "kbm"
+L155: .string "fdvkbkhxzqgwhhx"
+L156: .data -556, 348, -580
+L157: jsr L77
+L158: .string "xlorkyuobf"
+add r4, *r6
+L159: .data -162
+L160: .data 564, 354, -433, 353, 121
+L161: .data -842, -316, -742
+L162: .data 45, -213, 232, -581
+L163: .string "b"
+L164: sub r3, r0
+not *r3
+L165: .string "fwitriyznjvotimfwpgynx"
+L166: .string "niqvdnxmkeypuktqbyyp"
+L167: .string "tqjiodzyksnojga"
+L168: .string "lyxxqckpfgtntlm"
+L169: .string "wygnhehmukqafupfksnez"
+L170: .string "vmznhlqmvfip"
+L171: .string "aihhwkko"
+L172: .data 592, 39, 24, -985
+L173: .string "mo"
+cmp r2, *r4
+
+L174: .data 324, 212, 78, -649, 150, -686, 308
+sub r0, *r3
+L175: .data -533, -955, -975, -54, -729
+L176: .data -787, 307, 566, -76, 939, 849
+L177: .data 924, -539, 867, 625, 467
+L178: .data 966, -210
+L179: .data -718, 667, -109, -223, 878, 144
+add *r7, r6
+L180: .string "lgsqdxhznmevvtwkjrhjpt"
+L181: .data 508, -780, 187, -423, -915, -792, -987
+L182: .string "pyscmuwcze"
+L183: .string "rhwzygdfmynjwopkfzwh"
+L184: .data -847, -652, -477, 575, 290
+add *r2, L306
+rts
+L185: .string "t"
+L186: .data 513, 828
+red *r7
+; comment
+L187: .string "iymzwyeamqkmtpzez"
+L188: .string "c"
+mov r3, L32
+inc *r4
+L189: .data 163, 374, 415
+red r6
+; comment
+L190: .string "urvrbtchy"
+cmp L59, r7
+L191: .string "pqugl"
+L192: .string "bardfvnuyyiondffalq"
+L193: .data -278, 787, -517, -553, 345, -486, -159
+L194: not r5
+L195: .string "cokiulrfmnpxfgxr"
+lea L74, *r1
+L196: .data -347, 738, 692
+L197: .string "hweaqnbpaqvzwvoonjld"
+
+L198: .string "bxrzcuxdjapfwv"
+not r6
+L199: mov *r6, L306
+L200: .string "qqmjlhqcmtoctjen"
+L201: .string "rxzxfc"
+L202: .data -975, -847, -74, 191, -91, -576
+clr r6
+L203: .data -676, 203, 567, 988, -109, 672
+L204: .string "nybuzzaolpgkjbzipwnzaa"
+L205: mov *r0, *r1
+L206: rts
+; comment
+L207: .data 558, -999, -111, 782, -943, 625
+L208: .data -226, -788, 730, 250, -768, 176
+cmp *r7, L328
+lea L178, L241
+L209: .string "wpqmkuyhyzzw"
+L210: .string "n"
+prn #-244
+
+L211: .data -913, -231
+L212: .data -60, 462, 733, 740
+L213: .string "lciesexivfotiuynklc"
+L214: .data 812, -397, 566, -257, -855, 593, -372
+prn *r7
+L215: .data 707
+L216: .string "kapwxvzsmafzgppmzbhca"
+L217: .data -493, -719, -173, 378, 434, -520
+L218: jsr L164
+not r1
+L219: .string "mbgsjqayovroznctyirral"
+lea L235, r7
+red L188
+L220: .string "jksxavptpujkqjkgmwtwghv"
+L221: .data 869, -627, 10, 867, -765, -400
+add *r7, *r0
+L222: .string "oitkfuf"
+L223: .string "ixshghdevmytwpovofo"
+inc *r2
+red L38
+L224: .data -945, -562, 794, 426, 731, 825, 631
+L225: .data 815, -517, 656, 524, 928
+bne L183
+inc L140
+red L282
+L226: .data 354, 470
+L227: .data 73, -719, -465, -737, 491, -867, 994
+cmp *r1, L134
+L228: stop
+red L8
+bne L224
+cmp r3, *r7
+L229: .data -524, 259, 603, 358, -252, -237
+L230: .data -746, 18, -250, 709
+cmp #147, L122
+L231: sub L227, r7
+L232: .string "bogdjufb"
+dec *r5
+L233: .data 781
+sub #237, L78
+L234: .data -996, 483, 690, -949
+cmp *r3, #-134
+L235: jsr *r3
+L236: .string "wae"
+L237: inc L89
+L238: .string "mayrlncg"
+L239: .data 327, -166, -260, -892, -259, 676
+L240: .data -619, -403, 575, 194
+; comment
+L241: .string "ipwesopmerwrcigmtxkfwf"
+L242: .string "wdlqjxuwpzzr"
+L243: .data -539
+L244: .string "fhrjyzlfkfmzjhvczfefrn"
+L245: .data -22, 70, -392, 635, 969
+L246: .data -590, -342, -169, 886, -3
+L247: .data 775, 95, 513
+L248: .data -292, -864, 642
+L249: .data -280, 397
+L250: .data -956
+; comment
+cmp L2, L107
+L251: .data -816
+L252: .string "frz"
+L253: jsr *r2
+prn #106
+L254: .data -872, -945, 68, 638, -455, -663
+L255: .data -313, 905, 477, 824, -996, 241
+L256: .string "abkqzlyyvgnhe"
+L257: .string "kbj"
+L258: .string "howwguxyxkyunzwqvfij"
+prn #-254
+L259: .data 502, -308, 155, -966, 655, -307
+L260: .string "audtgqayguvcwebadss"
+L261: .string "gcndpntzo"
+inc L316
+inc r4
+L262: .string "awklfwli"
+L263: .data -375
+L264: .data -985, 545, 94, 784, 532, -789
+not L292
+red L302
+L265: .string "ljthbrqgeibrsmqcjhc"
+L266: .data -405, 455, -965, 247, 292, -290, -383, 293
+sub L205, L324
+L267: .string "bqygb"
+L268: .string "wnf"
+L269: .data 396, -714, -666
+L270: .string "wigloqjsjvxjouxzmg"
+L271: .data -514, 185, -937, -90, -637, 667
+L272: .data -134, -524, 693, -305, 549
+L273: .data -356, 165
+
+sub *r4, r2
+L274: .data -378, 404, -663, 758, 867, -387, 947, 617
+stop
+clr *r4
+L275: .string "mcmbnleoghxwmdskevryfy"
+L276: .string "dgodxphascbxmab"
+L277: stop
+L278: .data 64, 327, 620, 56
+L279: red r0
+L280: .string "ncrmjkzkmby"
+mov L283, L158
+L281: clr *r4
+L282: .data -30, 992, -236
+L283: .string "epweszxsqyu"
+L284: .string "cgegrniuqyzhpqpavltdywa"
+mov *r1, r5
+L285: lea L299, r6
+prn L202
+not *r3
+sub r4, r6
+L286: .data 312, 638, -372
+L287: .string "iglkpoafrjtlt"
+L288: prn L289
+L289: not L299
+L290: .string "ffvrhozasai"
+dec *r2
+L291: .string "jngehwktno"
+L292: .data 517, 113, -613, -11, -77, -980, -249, 492
+L293: .string "zmnljrskjrecicvtuhiueq"
+red *r3
+L294: .data 242, -708, -546, 748, -633, -453
+L295: .string "ijbpihnhdzydvsbtiilm"
+clr *r4
+L296: .data -745
+; comment
+L297: .data 712, 710, -498
+L298: mov r4, r2
+L299: .data -590, 913, 519, 234, -988, -69
+L300: .data -599, -79, -451, 135, 630, -912, -147
+L301: .data -122
+L302: .string "ulrtymf"
+lea L304, *r4
+L303: .string "r"
+L304: inc L306
+prn *r4
+L305: .data 652, -298, -238, -294, -508, 590
+L306: .string "alhkaghfbmesugtdeb"
+L307: .data 952, -365, -112, 793, 291, -783, 469, 697
+L308: prn #46
+L309: .string "vyexaoujdxqlwunihodde"
+L310: .string "lpljrd"
+L311: .data -223, -432, -626, 749, -825, -187
+L312: mov *r7, *r5
+L313: .string "rbtv"
+lea L316, L318
+red r6
+red L320
+L314: .string "ipydrzmyyewnloakwzcly"
+L315: .data 310, -150, 430, -962, -377, 464, 96, 609
+jsr L330
+L316: .data 312, 824, 964, 677
+L317: dec L235
+L318: .data -749, -157, -407, 83, 136, 161, 388
+bne L332
+clr *r7
+L319: .data -382, -4, 965, -478, 477, -232
+L320: .string "rqjufuprarvfaamuvjvolil"
+L321: .string "oiuwdncoagezgnazzpdzcuoo"
+L322: .string "bxwudpqqebdxozzsgdhlmnm"
+L323: .data -333, -219, 412, -824
+dec L331
+L324: .data -249, 966, -959, -592, 183, -528, 738
+L325: .data -775, 30, -724, -125
+L326: lea L332, L216
+L327: .data 168, 424, -801, 338
+L328: .string "umxrzlndptudgdn"
+L329: .string "oqjkcuodphgy"
+L330: .data 426
+L331: .data 795
+jsr *r7
+clr *r4
+not r4
+L332: .string "kcypeoftezeilbbfq"
+stop
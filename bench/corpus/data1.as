@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 2
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+cmp L111, #81
+L0: .data -578, -706, -685, 313
+L1: .string "z"
+clr L0
+L2: mov *r7, r2
+L3: not *r1
+cmp L1, #21
+clr L1
+L4: .data 156
+L5: .data -315, 154, 482, -379, 178, -420
+jsr L0
+mov L271, *r4
+L6: .data 145, 12, 663, -795, -130, -685
+add L6, r1
+clr L5
+jsr L6
+bne L40
+jsr *r6
+L7: .data -198, -195, 904, -13
+
+L8: .data -270, 973, 592, -274, -753, -917, -565
+L9: .data -432, 585, 993, 278
+L10: .string "urhwduqfmchgrzzj"
+not r2
+L11: .string "bsdmckqixnb"
+L12: stop
+; comment
+clr L5
+L13: not r1
+L14: .string "iteqhei"
+L15: .data 867, -364, -450, -389
+L16: .string "fsajhnzqfnxzclbmbd"
+L17: .data -981, 523, -35, 588
+not L16
+L18: .string "gybrgte"
+L19: .string "omb"
+L20: .data -968, 984, -724, -590, -806
+dec *r3
+L21: not r1
+rts
+L22: .string "pvbiqfyba"
+stop
+L23: .data -43, -273, 638, -128, -396, -63, -449, 228
+L24: .string "esxbxfpqo"
+L25: .string "qtr"
+L26: .data 423, -345, -635, 776, -397, 377
+L27: .string "zihliejffpdlfvkmiknsdnp"
+red L120
+L28: .string "sm"
+L29: rts
+L30: .data 729
+L31: .data -846, -797, -73
+L32: .string "kfnwkcafpkmlmsm"
+L33: .string "vixmcivmiyfwnblwlcygnsi"
+L34: .string "lvfnitmcpcvitfqovsnvdan"
+add L138, r3
+dec *r3
+rts
+L35: .string "iptxtdgdppein"
+L36: .data 233, 251
+L37: .string "hclpbqrzuvyhpi"
+; comment
+L38: .data -904, 481
+bne L71
+L39: .data -490, -697, -36, 505, -216, -920, -45, 154
+L40: .string "xfwyztagmjgk"
+L41: .string "jdrzxisbt"
+L42: .data -385, -668, 278, 0, 635, -779, -736
+jsr L27
+L43: .string "fqhpozfzo"
+L44: .data -999, 735, -138, 523, -17, -543, 905
+L45: .data -896, -493, -492, 202, 695, 717
+prn L71
+L46: .data 28, 387
+L47: .string "cgpzgrf"
+L48: .data -470, -659
+L49: .data 197, 755, 242, 500, 245, 740, 800, -667
+L50: .data 675, 940, -234, -218, -767, -330, -66
+bne L317
+rts
+dec L168
+L51: .string "gsberksqxuvyzcuuxsex"
+L52: .data 186, -122
+L53: .string "qglckyme"
+L54: .data 511, 60, 65
+L55: .data -691, -347, 494, -768, 337, 920, 195, -900
+L56: .data -443, -962, -174
+L57: .data 850, -203, -620
+L58: .data -593, -827, 560, -421, 682, 329, 609
+bne *r0
+L59: .string "hwf"
+L60: .string "oycremhgqv"
+L61: .string "zxzatuwjvvszkkb"
+rts
+cmp #-180, *r0
+
+red r2
+L62: .data 899, -848, 462
+L63: .string "bqvovwuhlnnt"
+L64: .data 928, 558, 875, 490, 332
+
+L65: .string "ov"
+red L127
+L66: .data -669, -304, -68
+L67: .string "mxbfumthfwnbiphozmnrwmaw"
+add *r1, r4
+L68: .data -539
+L69: .data -305
+not *r2
+lea L218, L53
+lea L51, L129
+inc *r7
+L70: .data -580, 586, -54, 130, -503, 848, 382
+L71: .string "qtbirdcmhd"
+rts
+L72: .data 863, 659, -74, 247
+L73: .data 978, 699
+L74: .string "uxazugxzhntefpyglmkjjq"
+L75: .data 167, 3, 890, 757, 265, -563, -899, -550
+L76: .string "pwstffwhd"
+
+rts
+L77: .string "knsrhziorjozrnahwwasrzwg"
+L78: rts
+L79: .data 145
+L80: .string "onqsk"
+L81: .string "eqjmeybawczrypplksf"
+L82: .string "frqrbzmcb"
+L83: .string "vd"
+L84: .data 507, -484, 294, 480, 87, -837, -747
+add r7, *r3
+L85: red *r7
+L86: .string "fwcmxkdjuwyqghw"
+L87: .data 607
+prn L149
+L88: .string "kdrpazzwkqw"
+jmp *r2
+bne L28
+L89: jmp L120
+cmp L136, r4
+clr *r7
+L90: .string "fyirixwjgkdhlgnhhrzjyn"
+L91: .data 438
+L92: .data 854, -588, 405, 399, -379
+inc L259
+L93: .string "ctbsbbjlo"
+L94: .string "prcproua"
+L95: .data -95, 844, -317, 198, -941, 456, 81
+lea L84, r7
+L96: .data 451, -845, 191, -704, -957
+L97: .data 548
+L98: .data -245, 272, -492, -811, -728, 208, -101, 970
+not L39
+L99: .string "y"
+rts
+L100: .string "osckvhukbyzaywpyjjo"
+L101: .data -98, -512, 924
+L102: .string "lkdjvwbhszkpgehutp"
+L103: .data 160, -851, 76, 739, -122, -906, -509, -170
+L104: sub L214, r5
+L105: .string "lvkzc"
+dec r5
+L106: .data 342, 919, -21, 138, -743, -463, 941
+sub L141, r6
+inc r6
+red L2
+L107: .data 966, 606, -952
+L108: .string "vb"
+inc L226
+red *r3
+L109: jmp L141
+
+prn r1
+L110: .data -169
+L111: .data -411, 449, 330, 618, -712, 903
+L112: mov r5, *r1
+L113: .data 792, -152, 718, 298, 8, -900, -780
+L114: .data -362, 274, 883, -842
+L115: .string "x"
+lea L223, L67
+L116: .string "vrvxrghxhpvtewfvdmk"
+bne *r4
+L117: .data -536, -377, -406, -233, -921, -369, 319, 352
+L118: .data 88, 244, -316
+clr r3
+L119: .data -53, 786, 305, -833, -475, 917, -648, 120
+red r6
+not *r1
+L120: rts
+sub *r3, *r3
+inc r5
+L121: .data -712, 656, 895, -651, -816, -714, -493, 594
+L122: .string "jakrfa"
+L123: .string "sofw"
+L124: bne L43
+inc r3
+jmp *r5
+red r1
+L125: .string "ejftipdcjnxvdbhn"
+L126: inc r2
+L127: .data 499, 973
+L128: stop
+add L324, r5
+jmp L209
+L129: .data -838, 660, 455
+L130: dec L61
+inc *r4
+rts
+L131: .data -36, 674, 25, -623, 21, -494, -302
+L132: .data 16, 364, 855, -678, -595, -420, 762
+rts
+L133: .string "gs"
+L134: .string "nq"
+L135: .string "yqimfdkkihgzvmogjyw"
+jmp *r0
+L136: .string "mesfipps"
+jmp *r5
+; comment
+L137: .string "uitndpkoacyz"
+L138: .string "kuwehkudvmasupu"
+rts
+L139: .data 322, 229
+L140: .data -96, -751, 775, -699, -312, 910
+dec *r0
+prn r3
+L141: .string "xmejw"
+rts
+L142: jmp *r7
+L143: .string "gypbiscipjnsjdishlaql"
+L144: inc *r5
+L145: .string "bqsjttogjfloejwz"
+L146: .data 130, 36
+L147: .data 749, 487, 789, 502, 449
+prn L272
+inc r3
+L148: .data 966
+L149: inc L202
+L150: .string "ijpupkzssnhzbpyiy"
+L151: .string "xbimbnrhcoxkdo"
+inc r7
+rts
+inc L251
+L152: .string "h"
+not *r4
+L153: .string "bskxnsiqkcog"
+L154: lea L220, *r2
+L155: .data -135, -463, -810, 828, -894, 715
+jmp *r6
+L156: .string "xafhxqibs"
+add L226, r1
+L157: .string "hvsf"
+inc L187
+L158: .data -668
+jsr *r3
+red L233
+; comment
+L159: .data 902
+clr r5
+jmp *r2
+L160: .string "qtgznhhtodxwvtt"
+inc L112
+; comment
+L161: sub r6, *r7
+L162: .string "zlwbxpkmmbhqgpop"
+L163: .string "ewwtnnnyssso"
+L164: .string "nbwvlyciddjhapa"
+L165: .string "jrjnvkqbowof"
+L166: .string "lxtplj"
+L167: .data 607, -182
+mov *r4, *r4
+L168: .string "ndinmk"
+rts
+rts
+lea L229, r7
+L169: .string "nzkjidg"
+L170: .string "mzozlxvcyxwzpnpyaqh"
+L171: dec r4
+inc L260
+L172: .string "pkceyzs"
+prn L260
+L173: .data 165
+L174: .string "swnphczohfesffhunl"
+L175: .data -294, 387, 804, -207, -489, -262, 716
+L176: .string "gkrk"
+L177: .data 190, 418, -11
+prn *r2
+L178: .data -193, -854, -389, -295, 857, -942, 656, -55
+L179: .string "htotjggdgspa"
+rts
+L180: .data 734, -526
+L181: .data -636, 128, -98, -93, 547
+L182: .string "xrkslgp"
+L183: not *r0
+L184: .string "tpsknssgyowvh"
+L185: .string "aucavip"
+red r7
+L186: .data 779, 250, 472, -794, -881, -429, -380
+L187: .data -640, -165, 899, 158, -369, 461, -676, -313
+cmp #207, L121
+bne *r2
+L188: .string "kpa"
+L189: .string "zmltxrwnypmjwdkmlywik"
+cmp *r5, #-82
+L190: .data -632, 661, -548
+L191: .data -775, -743, -44, -544, 876, -49
+L192: .string "ovvsloho"
+L193: prn *r7
+L194: .string "ptgziifikyprjddxlu"
+inc *r6
+L195: .data -821, -506, 665, -243, 591, 598, 87, -726
+L196: dec r3
+L197: .string "bz"
+inc L28
+add #14, L298
+L198: .string "rsppevsjrfzpph"
+jmp L321
+L199: .string "vrgn"
+prn L101
+L200: .data -729, 130
+L201: .data 71
+L202: jsr *r5
+L203: .data -58, 848, 718, 188, -387, -400, 763, 39
+dec *r7
+L204: .string "wphpzzbooct"
+L205: .string "d"
+L206: .data -973
+clr r4
+L207: .data -247
+L208: .data -268
+red *r0
+L209: sub #66, L297
+L210: .data 270, 832, 351, 710, -742, -406, 459, 915
+L211: .data 497, -248, -191, -647
+L212: .string "pkghp"
+red r7
+stop
+L213: cmp *r4, L1
+L214: .data 579, 135, -587
+L215: .data 811, 202
+L216: add *r6, L230
+rts
+stop
+not L86
+L217: .data -716
+L218: .data -967, 251, 614, -943, 192, -657, 181, -175
+L219: .data -321, -861, -676
+L220: .string "sougeeuotailhcydltla"
+L221: .string "d"
+L222: .string "asyretfrillhxrwe"
+L223: .data 524, -45
+dec r7
+L224: .string "bhhczaidoccqcyu"
+L225: .string "gmmpazfpqakkzklewsiuc"
+L226: .string "rjtruckw"
+L227: .data -133, -849, 430, 61
+stop
+L228: .data -813, 869, -374
+inc r0
+L229: .data -572, -563, 116, 713, -558
+L230: .string "mswtpdjgx"
+inc r0
+L231: .string "ddyxvxvymixgtknori"
+L232: .data 404, 348, -894, -232, 271, 210, 925, 435
+clr *r2
+stop
+L233: .string "a"
+sub *r7, L99
+L234: .data -342, -35, -80, -329, -529
+L235: .string "auycgojhrrfz"
+L236: .string "fcojoftaodazocod"
+L237: .data -156, 234, -156, 792, 917, 382
+mov L55, L218
+L238: .data -230, 755, 726, 324, 194, 530, 874, -715
+L239: .string "wvugraueyoaqhxv"
+L240: .data -677, 472, -598, 258, 662, -95
+cmp L37, #-180
+
+jmp L108
+L241: .data 936, -76, -699, -664
+; comment
+inc *r5
+L242: .data 235, 961, 798, 617, 628
+L243: lea L11, L6
+add *r7, L243
+L244: .data -878, -915, 874
+L245: .string "cz"
+L246: .data 233, 507, 6, 565, -879, 830
+; comment
+L247: .string "jtcqlaulgugnf"
+L248: .string "ojjnrdgmo"
+L249: .string "ohbvddxqlljfxi"
+L250: .string "jpplvfesecllvwjnkrsphce"
+inc L149
+L251: .string "smzgnulorawtmslbqqviy"
+L252: bne L276
+dec *r1
+rts
+not L246
+dec r1
+L253: .data -294, 391, -823, 298
+sub r0, *r2
+
+L254: .data 420, -81, -793, -779
+bne *r4
+L255: .data 962, -322
+L256: cmp L138, L280
+L257: .string "ojmb"
+L258: .data -75, -795, -807, -372, -506, -490
+dec *r7
+L259: .data -916, -142, -456, 832
+stop
+L260: .string "jzpkquftiylxczlnefhs"
+L261: .data -483, -116, 964
+L262: .data -741, 91, -623, 778, -691, -178, 696, 314
+L263: .data -633, -261
+L264: .data -120, 410, -981, 587, -745, -875, 272
+L265: .data -953, -256, 570, 503, -673, 515
+clr *r2
+L266: .string "uqa"
+L267: .string "tosthnkmb"
+L268: .string "lqkssrfqrwka"
+L269: .string "qkddwpblxhruauugqwqb"
+L270: .string "cgxjkudqeexpfhowpadbfvm"
+L271: .string "togxbrnj"
+L272: .string "beatsiilizfk"
+L273: .string "itjvxhuguhyhioxttfkaosd"
+L274: .string "wdvymnomwuzti"
+dec *r2
+dec L278
+L275: .string "evzb"
+cmp #95, L122
+bne *r5
+L276: .data -400
+add r2, L312
+L277: .string "rx"
+L278: .string "gcirxclxwlgfpisrlwiu"
+L279: .string "atnaccs"
+L280: .data 822, -5, -95, 617, 327
+L281: .string "ldsz"
+L282: jsr *r0
+stop
+L283: .data -646, 493, 602, -126, 335
+dec L266
+L284: .data -285, -272
+L285: .string "ivgmg"
+L286: .data -793, 99
+inc L308
+L287: .data -893, 522, 800, -191
+sub L38, r4
+rts
+L288: .string "zfepavgblnndk"
+L289: .string "guyroprbj"
+L290: .data 742, -254, -292
+L291: .string "vt"
+L292: .data 614, 767, -204
+
+sub #190, r6
+stop
+L293: .string "fjg"
+L294: .data -653, 733
+L295: .string "ialetolizfklihwk"
+L296: .data -699, 941
+bne L305
+L297: .string "wwhleyholfxpwj"
+L298: inc r4
+L299: .string "hjhpcqyiolzxvzqvgwxnktxa"
+L300: .string "gnj"
+L301: .string "sojzbv"
+not r2
+; comment
+mov L35, L9
+L302: .data 683, 374, 540, -805, -378
+L303: .string "w"
+dec *r5
+cmp r2, r7
+dec L187
+L304: .string "wszcuj"
+L305: .string "xxztkgqrompmzwjhy"
+not *r5
+L306: .data -61, -453, -685, -331, 792, -157
+L307: .string "lhymuprzqccccfkrahtjxc"
+L308: .string "heseafktrmov"
+L309: jmp *r3
+L310: .data 311, -640
+L311: .string "oicomis"
+L312: .data 505, -656, 217, 578, -249
+L313: .string "icrpcdgbjbqtnem"
+L314: .data 791, 202, 703, -843, -565
+L315: .data 70, 916, -482, 74, -639, 390, 885
+L316: .string "qit"
+L317: .string "awwo"
+L318: .string "cfenibjqzcdlkiptlggewim"
+L319: .data -313, -807, 45, -608
+L320: .string "sdepglcgfdm"
+jmp L324
+L321: cmp r0, *r1
+L322: .string "vmcdehbjspfmk"
+L323: bne L290
+L324: .data -483, 963, 331, 492, -501, -246, -445, 719
+L325: .data -585, 447, -282, -988, 349, -484, 858, -932
+stop
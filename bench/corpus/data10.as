@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 11
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+cmp *r2, #-228
+L0: .data 473, -716, -774, -506, -978, 629, -88
+L1: .string "czvgsvfnnjnyjjhfwbmzokvt"
+dec L1
+dec *r5
+L2: .string "usrpfbgdmqetu"
+L3: .data 234, -805, 629, -517, -623, 242, 389, -394
+stop
+L4: .string "nwghkrlbdrfnskegxnzc"
+L5: .data -90, -861
+mov *r1, *r7
+L6: .string "schqukukvwculxswxut"
+sub r5, L1
+L7: .string "unmcoafddrmfzyup"
+stop
+L8: .string "wldysdyizlzwoxnmtbdpkhlj"
+L9: .string "cgubefetwasebtrg"
+L10: .data 837
+red *r3
+stop
+add #140, L278
+L11: .string "zt"
+prn *r2
+L12: .string "zghhkpnmrvtr"
+
+clr r6
+L13: .data -541, 837, 45
+L14: .data -351, 992, -526, -804, -265, 654, -130
+bne L309
+inc r7
+L15: .data -331, 431, -830, -710, 420, -180, -723, 560
+L16: .data -719, -665, 226, -528, 423, 944, 368, 244
+not L170
+L17: .string "wn"
+L18: .data 891, 960, 796, -890, -815, 400, 731, 347
+L19: .string "qyvmnsegm"
+L20: .data -743, 82, 656, -531, -553, -637, -116, 489
+dec L10
+L21: .string "wifbglcysmdwotfxhaghodqw"
+; comment
+L22: .data 584, 851, 835, -165, 206
+L23: .string "srza"
+L24: .data -937, 401, 541, 103, 334, 979
+L25: .data -411, -947, 572
+L26: .string "blalqcjhjhgunpc"
+red *r0
+add L262, L11
+L27: .string "fivbwbebpzhn"
+L28: .data -5, 306
+L29: .string "thrmuhqni"
+L30: .data 544, -703, -335, 426, 768
+inc *r2
+jsr *r5
+L31: .data 463, 3, -179, -124
+L32: .data 998, 421, -559, -495, -371
+L33: .data -218, -465, 199, -585
+jmp L28
+L34: .data -243, 56, -254, -825, 213
+mov L33, r3
+dec *r1
+L35: .string "cjvgjofaox"
+L36: .string "kzivjswa"
+bne L14
+cmp *r1, L23
+L37: .data -925, 820, -487, 68, 906, -959
+inc *r5
+L38: .string "btbeteq"
+L39: .string "dqthyfrafhbgjfnc"
+L40: inc r3
+L41: dec r0
+L42: .string "g"
+L43: .string "teowswxbkuvnnhsj"
+L44: .data -349, 700, 742, -949, 18, 892, -318, 345
+L45: .string "dscwyjzwxxdnxlojyzlzda"
+L46: .string "jznzovvo"
+L47: bne L142
+L48: prn L8
+L49: .string "vpmg"
+L50: .data -863, -204, 991, -327, 265, 561, -431, 671
+L51: .data -640, -289, 590, -642, 241, 235, 5
+not L72
+L52: .string "eroat"
+add *r6, L68
+L53: .string "wckqmtpvq"
+L54: .string "utjvkwjnnizwdrtyfv"
+bne *r6
+L55: .data -952, 925, 582, 90, -851, -899, 512, -853
+
+L56: .data 201, -2, 446, -262, -797, 476
+L57: dec L93
+L58: .string "oeghtpqayoimrrcxpmztw"
+L59: .string "jqampwa"
+add r0, *r4
+jsr L21
+lea L164, r6
+L60: sub #156, *r5
+L61: .string "fmvyqjpcfpnsvidqtgwcw"
+lea L38, L311
+L62: .string "cuqjvyvrfqxxcada"
+L63: .string "ouhkdzphqqn"
+rts
+red r1
+clr L128
+L64: .data 210, -796, 128, 685, -225, -786
+L65: .string "z"
+
+L66: .data 841, 202, -528, -992, 510
+L67: .string "g"
+jmp *r6
+L68: .string "skalwvzmygywjbldwgii"
+jmp L212
+L69: .data -865, 945, 199, 893, -506
+L70: .string "nrthctf"
+L71: .string "q"
+L72: .string "fdiyhglggbjfdgjmufu"
+L73: .data -139, -755, 39, 319, -729, -398, 103
+L74: .data 712, 466
+bne L256
+jmp L12
+L75: red r3
+L76: .string "j"
+sub #-127, *r2
+lea L47, L211
+inc r5
+L77: .string "zxttshyqixfxpxbgsyb"
+L78: .string "ayvrsmpzksqylpulrqw"
+L79: .data -708, -700, -188, -337, 61, -66, -992
+L80: .data -323, 846, 690, -183, 74
+clr *r0
+L81: .data 287, -617, -740, 584, -575, -279, -622, 536
+L82: mov L121, L211
+L83: .string "znx"
+L84: .data 536
+L85: .string "gsycprkndgxd"
+L86: .data -612, -422, 951
+rts
+L87: prn *r3
+add r5, *r5
+rts
+L88: .data -791, 688, -961, -653, 769, -444, 547
+L89: .string "pllvqgrahnru"
+sub *r0, r6
+L90: .data 938, -399, 404, -618, 560
+L91: .data -471, -842, -545, -829, -98, 721, -241
+not L300
+L92: .data -25, -334, -258, 859, 550
+L93: .string "h"
+L94: .data 518, 689, 14, 311, 233
+clr *r2
+L95: .string "prdzvzelhbmqotnulbfx"
+L96: .data -521, 229, 686, -991, 513, -803, 143
+L97: .data 694, -771, -777, -844, 327, -507, -810, -217
+L98: .data 688, 701, 600, 789, -622, -462, 634
+L99: .string "buhumsnpkssnksbdjqrntn"
+
+L100: .string "djpfyesywkwz"
+
+L101: .string "vtanaaimtttopl"
+L102: .string "p"
+add #-152, *r5
+L103: .string "klqckmgjqaxct"
+sub #19, *r7
+L104: .data -847, 610, -105, -47, 271, 574
+clr *r6
+; comment
+bne *r4
+L105: .data 504
+mov #-236, r5
+L106: .string "vcweflwjahc"
+L107: .string "txtb"
+jsr *r3
+L108: .data -395, -916, 198
+L109: .string "blomgybmakcumtefsboecwch"
+L110: .string "lyhbofgsglouwlwczsfjduff"
+L111: .data -420, 217, -654, 368
+L112: .string "frqhfdnicm"
+L113: .string "yowmjhlwuqkwkehlrq"
+L114: .string "owbhzrji"
+L115: .data 530, 856, -55, 475, -450, 478
+L116: .string "mteifatuxkxwyfvnc"
+L117: .data 115, 352, -548, -845, 624, 39, -40, 35
+L118: .string "pdmmkyklzpqostzvub"
+clr *r5
+L119: .string "mvqgqwrgrbwssmenuvjdvckh"
+mov *r2, r0
+L120: stop
+L121: .data 339, 825, 947, 601, -673
+jmp L150
+L122: sub *r0, r4
+L123: .data -307, -869, 766, -115
+add L61, *r0
+L124: jsr L201
+L125: .data -523, -52, 737, -22
+jsr L102
+cmp r0, r1
+L126: .data -972, 310, -9, -360
+L127: .string "jcacifqkywm"
+L128: .data -139, 488
+L129: .data 463, 898
+bne L48
+inc r4
+lea L132, *r0
+L130: .string "mc"
+L131: .string "ygrzfgnhkxfdmnqxqbiqjzp"
+prn L47
+L132: prn #-221
+L133: .string "emerhopthj"
+L134: cmp L313, *r4
+red *r5
+L135: .data 508, 668, 276, 331, -751, 906, -109
+L136: .string "kqifsanqksrcgsjqh"
+; comment
+not *r7
+L137: .string "vmwzysol"
+L138: .data -794, -837, 706, 711, -408
+inc *r7
+jmp *r7
+L139: .data -9, -128
+L140: .string "svwztmqj"
+L141: prn L308
+cmp #-244, #151
+L142: .data 453, 886, 49, 160, -205, 569, -132, 895
+L143: .data 38, -346, 212
+L144: .data 258, 925, -80
+add L19, r1
+stop
+L145: .string "ilggxxxuezjk"
+L146: .string "ahv"
+L147: .data -754, -438, 402, 900, 9, -535, 487
+L148: .data 863, -828, 881, 643
+L149: .data 438, 987, 817, -848, -702
+inc r3
+L150: .data -312, 711, -3, -836, -262, -739, 588, 832
+L151: .data -810
+L152: .string "iodbcxvjurauzkq"
+L153: .data -754, 37, -894, -649, 824, 883, 396
+L154: .data 321, 695, 554, 96, -191, -777
+lea L314, L10
+L155: .string "cjvslakohrxvvubkcqzvh"
+L156: .string "gtrmawrqx"
+L157: dec *r0
+mov r0, r7
+L158: .data 968
+L159: jsr *r0
+L160: .string "rlbhg"
+L161: .data 574, -491, -497, -132, 693
+L162: .string "hdcwywhgjexw"
+L163: .data -512, 223, -543, -948
+L164: .string "l"
+L165: .data -284, -340
+
+bne *r4
+L166: .data -164, -981, 313, -128, 138
+sub L7, L31
+clr L284
+not *r5
+inc L266
+mov L52, L308
+L167: .data -558, -740, 794, 598
+clr r5
+L168: .string "ojjphzjayykrnlcslxy"
+red L155
+red r6
+add *r3, r1
+jmp *r6
+; comment
+cmp r3, L6
+L169: mov #245, L221
+L170: .data -699, -699, -971, 762, -119
+L171: jsr L100
+mov r6, r4
+L172: .data 128, 9, 806, 161
+L173: .string "tlolqasaknsasuqrsqrmcsr"
+stop
+L174: .string "gq"
+L175: .string "jficubixjxcie"
+L176: .string "uwncvfbkarag"
+L177: .string "goyplvjvdpcwxtkzfbrnnd"
+jsr L215
+
+L178: .string "zh"
+L179: inc L213
+rts
+stop
+L180: .string "wf"
+L181: .string "dvypoqsbarhypdp"
+L182: .string "fuccglgvesjkvr"
+mov r4, r6
+L183: .string "ywfyemlmmqzq"
+rts
+L184: .string "blrzljtjbwg"
+L185: .string "tvunxcy"
+L186: .string "fkycamvi"
+L187: .string "bljygcc"
+L188: .data -913, -436, -250, -891
+prn L137
+L189: .string "azrycve"
+jmp L309
+L190: prn *r6
+L191: .string "ewixbjaymradhwkczducclpp"
+L192: .string "tiornubxqxjezhahipba"
+jsr *r1
+jsr L130
+L193: .string "vtrgtrjauqhv"
+dec *r5
+L194: rts
+L195: .data -473
+L196: .data 499, -376, -958, -101, 629, -823
+L197: red r6
+L198: inc r3
+not *r0
+prn #119
+L199: .string "smargcnibybiiogv"
+add r3, r0
+lea L107, L182
+sub *r2, L179
+L200: .data -692, -479
+jsr *r1
+L201: .string "pxvxhqzzhrfkdkkkixyh"
+not r4
+L202: .data 448, -408, -418, -254, -801, 839, 452, -289
+L203: rts
+add L288, r2
+L204: .data -745, 28, 970, -841, 765, 995, 842
+L205: .data 661
+L206: .string "czdcaaspiiiqwe"
+L207: .string "blekwva"
+dec L140
+L208: .string "zhnw"
+L209: rts
+L210: .string "srolnuydalontekmddyidbdx"
+L211: .data -963, 744, -891, 197, 741, -48, 266, 464
+inc L122
+prn r5
+L212: .data 536, 5
+rts
+L213: .string "mrimmksfchpfcbujrtalymoy"
+L214: .data -631, 486
+L215: .data 649, 345, -924
+L216: .data -408, 854, -578
+L217: .data 564
+L218: .data 991, 987, -799, -64, 636, 702, 782, 39
+add L263, L99
+L219: .string "iqgiiyk"
+cmp *r4, *r6
+jsr *r4
+L220: .string "gdamdjhd"
+L221: .data 49, 204, 160, -185, 121
+L222: .string "gixadyscg"
+rts
+red *r7
+prn #37
+L223: .data -567, -515
+red r2
+L224: .string "amejlzirzupd"
+L225: .data 578
+sub *r6, *r6
+L226: .string "cbxbkxs"
+mov *r2, r2
+rts
+L227: stop
+L228: .string "lkikorkxhkjijdpww"
+L229: .string "mermuxwboxkvnebrg"
+rts
+mov *r2, *r4
+L230: .string "isll"
+L231: .string "mizivzxchkchysdveqe"
+stop
+L232: .data -298, -237, 615, 233, 226, 859
+L233: .data -425, -819, 582, -560, 497, -836, -236, 524
+L234: .string "kezqnriqehcbr"
+L235: .data -720, 905, -556
+L236: .data 696
+L237: .data -635, -265
+L238: .string "gyxnegpqqiahfgrfmhtzllc"
+bne L281
+L239: .string "zercpycda"
+jmp *r5
+L240: .string "zarlltszgsbjifhkqyda"
+L241: dec r4
+L242: .data -574, -547, 703, 547
+L243: .string "vzndcwcgie"
+L244: .string "nskigcxbrnbwnncpdx"
+L245: .data -531, -992, -872, 627, -988
+L246: lea L155, L118
+L247: .data -285, 131, -669, 936, 235, -222, -219, -505
+L248: .string "t"
+rts
+L249: .string "deaapjgcuohmuil"
+rts
+L250: .data 547
+L251: inc *r1
+jmp *r3
+L252: .string "yjhbhncxbnbuoumdk"
+bne *r0
+L253: .string "dgmwvq"
+L254: .string "b"
+sub #-183, L283
+L255: .data -647, 880, -642, 930, 986, -796, -651, -430
+L256: dec r6
+L257: .data -299, -680, -218, -576, -319
+clr *r6
+; comment
+L258: .data 444, 633, -203, -510, 190, -553, -967
+cmp #-96, r7
+L259: not *r1
+L260: .string "t"
+L261: .string "vtaajicrxkxo"
+; comment
+L262: .data -791, -747, -114
+; comment
+L263: .string "quxomginreutcaj"
+dec r0
+L264: .string "enbkzzo"
+L265: .string "bxhpcxifrxugbklu"
+L266: .data 723, -789, 992, 28, 548, -579, -785
+stop
+bne *r6
+L267: .string "ifkukhiduvvmqml"
+L268: .data 500, 500, -710, -621, 803, 663, 131, -505
+dec *r0
+L269: .string "potadurafvsoleiqgw"
+L270: .data 831, -872
+L271: .data -720
+L272: .data 151, 153, 347, 834, 707, 374, 186, 35
+jsr *r7
+L273: .data -557, 432, -144, 336, -188, 874
+L274: .data -307, -852, 162, 530, 682, 299, 9
+L275: .string "nprodjizwwhiey"
+L276: .string "movygksn"
+L277: .string "uidppfvfqocmyqlslhe"
+L278: .string "dlbdzabru"
+clr L306
+jsr L85
+L279: .string "x"
+; comment
+L280: .data -622
+L281: .data -571, -679
+stop
+lea L304, L283
+L282: .data 370, -388, 316
+L283: add L298, L271
+L284: .string "shmhnyopfcacoknbho"
+L285: .data -276, -335, -721
+L286: .string "t"
+L287: .string "ekedoxgidjyklleqfi"
+L288: .data -201
+L289: .string "bdrucxvirkro"
+stop
+red *r6
+clr r2
+L290: .data 786, 167
+jsr L304
+L291: .string "aowpdw"
+prn L303
+cmp r0, *r2
+clr L169
+dec L314
+sub *r4, *r5
+L292: .data 968
+L293: .string "kioahgpabbofsfayorackgcm"
+mov #-161, r3
+L294: .string "ejizwskdqmqozjweuavvtq"
+L295: .string "vgdmiugtnkdglpubixrcz"
+L296: .string "uxmeheypx"
+L297: sub r4, *r2
+L298: .string "cfxz"
+red *r4
+jsr L302
+; comment
+jsr *r7
+; comment
+stop
+L299: .string "xgqzrzvtibczunvchuriy"
+not r7
+L300: .string "jsshxn"
+jmp *r3
+L301: .string "qk"
+L302: .data -340, -721
+L303: .data -242, 635
+L304: .string "gjonlmtqtaczqeupdtvkth"
+L305: .string "bchzgyhy"
+bne *r0
+L306: .data -284, 406, -98, -278, 427
+prn L300
+L307: jmp *r2
+red *r1
+L308: .string "phtmz"
+red *r4
+L309: .data 852
+L310: .data 726, -974, 76
+L311: .data 562, -704, -539, -160, 563, -984, 226
+sub *r5, *r6
+prn *r6
+inc r4
+L312: .data 93, -108, -562, 664, -641, 82, -422, -976
+L313: .data -489, 645, 275, -210, 283, -616, -135
+L314: .data -353, 789, -94, -488, -599, 606, -218, -249
+L315: .string "yluwpxbdmqpy"
+
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 101
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .string "iawshyuzwahxwugrrm"
+L1: .data 785, 939, -666, -3
+L2: .data -716, -196, 703, -586, 638, 889
+stop
+L3: .string "fseywdnlc"
+L4: .string "m"
+L5: .string "guaqrdtnwfpjslk"
+
+L6: .data 196, -441, -938, 922, 338
+L7: lea L111, L206
+L8: stop
+clr L219
+
+L9: .data 631, -282
+prn r1
+L10: .data -312, -930, -167, -603
+L11: clr r0
+L12: .data -159
+L13: .data 330
+L14: .string "bysnkogm"
+L15: .data 827, 40, -808, 666, 647, -40
+stop
+L16: .string "anpmqtooklywgcvqaytn"
+L17: .data -252, -498
+L18: .string "eipbmffa"
+jsr *r6
+dec r5
+L19: .data -521, -295, -591, -771, -285
+red *r0
+L20: .string "ekxzthzhjedskrzh"
+L21: .data -907
+not *r5
+L22: .data -555, 36, -56, -801
+L23: .string "memsrnyehoyufat"
+L24: .data -755, 506, 128
+jsr *r0
+red r2
+L25: .string "yppltvxooql"
+cmp *r2, #-231
+L26: .data 296, 364
+L27: .data 325, 168
+L28: .data -113, 757, -17
+L29: .data -330, -866, -809
+; comment
+lea L269, *r2
+L30: jsr L150
+L31: .data -497, -829, -962, -314, -85, 718, -695
+L32: .data 979, 653, 350, 191, 18, 538, -18, -895
+L33: .data -571, 730, -481, 604, 128, 766, -874, 887
+L34: .string "yuv"
+L35: .data -197, 355, -627, -754, -114, 494
+L36: .data -662, -900, 331, 955, 309, -950, -542, 683
+L37: .data -525, -651
+dec *r2
+bne L105
+; comment
+L38: .data 930, -711, -914, 621, 573, -259, -323
+mov #103, *r3
+jsr *r7
+L39: .data 489, 514, 789
+L40: lea L35, r4
+L41: .string "qswlrqgz"
+L42: prn r0
+L43: .data -500, 317, 489, 602, -491, 228, -250
+stop
+L44: .data 228, 733, 254, 104, 274, -241, 570
+L45: .data -541, 559, 918, -785, -364
+L46: .string "jtlznp"
+L47: .string "mkxjyxnnwfx"
+L48: .data -591, 180, -507, 343, 793
+L49: .string "r"
+L50: .string "ikhlcgtgwmogj"
+lea L26, r3
+L51: .string "fnldbmylrsfn"
+L52: .string "wuhuylcciiggprqoayy"
+L53: .string "nhrwgvgyiz"
+
+sub *r0, *r5
+add L29, r2
+L54: add L143, r0
+dec *r6
+add r6, L120
+L55: .data 942, 80, -341, -148, 591, -518, -792, 255
+L56: .data -595, -139, -313
+cmp *r1, L22
+jsr L26
+L57: .data -435, 399, -326, -617
+L58: .data 961, -646, -252, 511, -850, 970
+sub *r2, *r5
+inc r3
+L59: .string "jjroyagmirxknuralctfyenr"
+L60: .data -175
+L61: .data -27, -881
+L62: stop
+L63: .string "tyemravxvqcejtv"
+prn L201
+L64: .data -971
+L65: .string "sogsxmdnfq"
+L66: .string "th"
+L67: .data 76, 991, 66, -913, 759
+not *r7
+; comment
+L68: .data 265
+sub r7, r0
+L69: .data 357, -934, -346, 595, 98
+L70: .data 667, -133, -603
+L71: .data -245, 792, 154, 601, 274
+L72: .string "c"
+L73: .data -339, -19, -495, 272, 955, -588, -777, 372
+L74: .string "wpwbeonuk"
+L75: .data -147, -953, 428, -127, 700, 974, -339, -788
+L76: .string "qtaoaklfmskq"
+L77: .data -580, 193, -759, -232, 773, 897, 957, -626
+L78: .string "yjdhgvuyjvqanj"
+L79: .string "pwznlvtpbzmqlavej"
+L80: sub #219, L131
+L81: .string "eyrqjgmfmrzrnw"
+L82: .data -45, 481, -403, 817, -342, 668, -903
+L83: .data 927, -265, -810, 441, 346, -438, -466, -473
+L84: .string "rmadbxqagglempby"
+L85: .string "yemcthwbadv"
+L86: .data -99, 548, -233, -37, -809, 690
+L87: .string "maorgaynozctaihd"
+L88: .string "bazopzrgqqujuadxm"
+L89: .data 662, 310, -701, -740, 288, -514, -142
+L90: .data 427, 694, -945, -437, -90, -316, 108, 468
+L91: .data 470, 355, -748, 786, -554, 205, -814, 788
+L92: jsr *r7
+jmp *r3
+mov #191, L16
+L93: .data 575, -798, -649
+L94: .string "kbmcjvwp"
+L95: .data 515, -621, 193
+stop
+sub #-13, L77
+L96: .string "iwfeeydkyuwctirqr"
+L97: .data -530, 661
+L98: .data -162, 248, -131, 607, -760, 660
+L99: .string "fnkvrfjhmccz"
+L100: .data -935, -845
+L101: .data 241, -894, -865, -743, -261, -141, -856, -71
+
+not r5
+
+red *r1
+L102: .data 547, -908, -175, 520, 365, -760
+bne L220
+L103: .data -415, 651
+L104: .string "uwgxhuzxzpvgarnyshnued"
+cmp r5, L163
+L105: .string "qqatjuzjbrfba"
+L106: .string "nhzoyfvmmmpmgxjbgt"
+L107: .string "rnovkabcgqogfpr"
+L108: .string "hapkvruagefti"
+L109: .data -936
+L110: .string "xkxqdrifg"
+L111: .string "pspfwpyymcqcpo"
+L112: .data -732, 521
+L113: .string "whdoqvuxaiddg"
+L114: .string "oaqnwrksucacfujjtyvrgkb"
+L115: .data 540
+rts
+L116: .string "ejjotvwxuzwi"
+L117: .data 293, -818, -392, 513, 147
+L118: stop
+; comment
+stop
+; comment
+inc r4
+L119: .data -126, -798, 755, 316, 438, -885, 143, -311
+L120: .data -832, 175, -347, 777, -338
+clr *r7
+clr r4
+L121: .data 265, 610, -267
+L122: .data -912, 949
+L123: .string "prqzz"
+L124: .string "wvlknjkxjrohtb"
+L125: .string "e"
+cmp r2, *r0
+L126: .string "ovhyruixkizdjqt"
+L127: .string "qnyodtxqdeejny"
+L128: .string "nill"
+L129: .string "sgsiqrvawgicttvpf"
+L130: .data 428
+L131: .string "xyzqjf"
+L132: .string "kzxgepybxsvwogxu"
+L133: .string "nzeay"
+jsr *r0
+L134: .string "broihdyvpwihndaeov"
+; comment
+not r5
+
+L135: .data 546, -7, -171
+L136: .data 93, 261, -111
+L137: .string "hcadclzq"
+bne *r6
+L138: .data 729
+L139: .string "jrn"
+L140: .string "vltufuzzwdomrhegzwrdkber"
+L141: .string "ujubbvugn"
+L142: .data -683, 738, 616, -955, 615, -85
+L143: .data 794, 312
+lea L35, L205
+; comment
+L144: .string "a"
+L145: .data 911, -307, -878, 545
+rts
+L146: lea L65, *r4
+bne L205
+L147: prn #-241
+; comment
+inc r6
+L148: .string "pknbirhpjwfyjuoptqkmpd"
+clr r4
+red *r3
+L149: stop
+clr L145
+inc L177
+L150: .data -147, 938, 160, 837, 690, -603
+; comment
+red *r4
+L151: .string "h"
+cmp #195, L78
+mov L227, L31
+rts
+; comment
+L152: .string "einoypdpwixvvlapdm"
+
+L153: .string "o"
+add #-53, *r0
+L154: .string "ztwcgdybdmjulmknulyx"
+sub *r5, r0
+L155: .string "b"
+L156: .string "fkjpyv"
+L157: .string "ccdtgeqwwnwbd"
+sub L174, r3
+L158: .data -201, 104, -915, 500, -511, 301, -509, 95
+L159: .data -641, 950
+L160: .string "wlepugoelpslbxutlwvcz"
+L161: .data 65, 909, -687, 846, -811, 285, -296, -32
+L162: .string "rvpria"
+L163: .data 351
+L164: .string "rkk"
+prn *r6
+inc L240
+L165: .data 672, -54, 970, 895, 18
+sub #159, *r7
+dec *r3
+L166: .string "dv"
+dec *r1
+L167: .data 122, -345, -698, 834, 81, -286, -478
+not L279
+L168: .data -410
+L169: .string "qjoajm"
+L170: .string "pzjycjtooaxxmftchcwap"
+L171: .string "eogmfusrrffxgzwwcos"
+L172: .string "qxwagkupidkvvjvzopkltypr"
+mov *r0, r1
+L173: .string "iwioeskk"
+L174: .data 274
+L175: .string "bnvvsgicw"
+L176: .string "jfxqiccuelqokhwiq"
+L177: .string "ckzwzlijxtsobxjgcdpjov"
+sub *r7, L276
+L178: .string "qkqvqtggfkrrb"
+L179: .data -852, -996, -508, -842, 793, -100, 730, 608
+L180: jsr L288
+cmp r3, #-255
+L181: lea L43, *r0
+
+L182: .data -393, -532
+
+L183: .string "qiyoczbszkyjtitajx"
+L184: .data 269, -875
+L185: .data 196, 147, 933
+L186: .string "qspvfjnglazyjxsr"
+L187: .string "vxtefhrofzyaixjwc"
+cmp *r3, *r7
+jmp L182
+dec L210
+L188: .data 523
+add #171, r1
+sub L220, r5
+prn r4
+prn L291
+lea L261, L167
+L189: .string "tzqtvuagkttpgtrlkml"
+prn #-252
+jmp *r5
+L190: jmp *r4
+L191: .string "qlflbcu"
+L192: .string "rpkeptogvwxp"
+sub #159, *r1
+L193: .data -310, -371, 341, 820
+L194: .data -953
+lea L274, L330
+L195: .data -852, -467, -487, 745, 33, 404, 609, -208
+L196: .data 570, -49, 236, -597, 374, 903, 279
+L197: .string "cjeplbthqpwyyx"
+L198: .string "pxphxqmathlumflclzeu"
+L199: bne L226
+L200: .data 800, 997
+rts
+L201: .data -456, -532, 129
+L202: .string "osmggbprpfmtcsdirc"
+L203: .string "qvslekifowqvubcm"
+dec r4
+L204: .data 8, -258, 412, 149, -854, 278, -578
+L205: .string "wdfckjymfhmuxrjjgsyrbaem"
+L206: .string "loxxqdbagbctgpddgwd"
+L207: .data -696, 719, 389, -356
+L208: .data -492, -252, 944, -728, 184
+rts
+clr L213
+L209: .data -397, 762
+L210: .data 55, 234, -10
+L211: .string "z"
+L212: rts
+L213: .string "hilrmppgwrhlducdanjp"
+jmp L263
+L214: .data 418, -446, 435, -249, -129, -716, 212, -815
+L215: .data 85, 842, -514, 907, -656, 453, 887, -181
+sub L48, *r0
+not L36
+L216: .data -227, 421, 457, 458
+
+lea L221, L121
+clr *r7
+L217: .data -949, -517, -192, -486, -747, -531, -615
+L218: .string "mvodywfqmvtaoxxtcpixdqux"
+L219: .data -987, 19, -882, 58, 959, -210, -731
+L220: .string "qrwdyxhrzbgdszs"
+
+jsr *r3
+L221: .string "mrdmchxjh"
+jsr *r3
+L222: .string "mlaqfiopunpk"
+L223: clr L261
+cmp #105, *r3
+L224: .data 481, 326, 964
+L225: .string "fu"
+L226: .string "ca"
+L227: not L298
+L228: .data 743
+L229: .string "gwtzvh"
+red *r2
+L230: .data 600, -337, -622, 241
+L231: not r7
+L232: inc *r1
+L233: .data -12, 987, 790, 40, -878, -557
+L234: .data -479
+add *r0, L251
+L235: .data -753, -57, -18, 957, -521, 384, 924
+L236: .string "ffzusvahycm"
+L237: .string "stqqnfvicchsf"
+L238: .string "mpzfpkubcsqwlakznj"
+mov #98, L228
+L239: .string "vquwxnsoy"
+L240: .string "mohjclcqk"
+L241: .string "huluzwstt"
+L242: .string "wsmgponyyerxbgdcypeay"
+L243: not L292
+L244: sub L49, L325
+L245: .data 564, 466, -771, -122
+L246: .data -155, 459, 726, 521, -611, -848, -210, -326
+not *r6
+L247: .data -477
+dec *r4
+cmp #-50, #-134
+L248: .data -367, 623, 802, -842
+L249: .data 522, -163, 913, -458, -822, 306
+cmp L243, #-48
+dec *r7
+L250: .data 995, 918, 376
+L251: .data 789
+L252: .data 120, -633, 524, 521, 490, -932
+L253: .string "rcjfdxkbnnzjxsdcn"
+L254: .data 449, 106, 361, -403, -922, 926, -120
+cmp L238, #-73
+L255: red *r3
+L256: .data -518, 480, -178, 722, -146, 478
+L257: .data -924, 208, 840, 426
+L258: .string "bqckqyubfmohsedvusz"
+inc *r6
+L259: .string "jhzyrouetjhs"
+L260: .string "bgfiqrc"
+rts
+L261: .string "crhhsqinikfsrrgmucgd"
+L262: .string "mckiprn"
+; comment
+; comment
+bne L278
+inc L178
+L263: .string "bgbcqlmbtaqumdegvg"
+dec L272
+sub L306, L51
+sub r1, *r7
+L264: .data 968, -859, 509, -970
+L265: .string "nuwwdm"
+L266: .data -116, -236, -283, -420, 736, -97
+clr r0
+
+mov L60, L169
+L267: .string "bzutbtqc"
+L268: .string "wygkhcyorkkhydq"
+L269: .data -611, 775, -547, 646
+clr r1
+L270: jsr L174
+L271: .data 296, -578, 843, 71
+L272: .string "vjghfmyabxbduuzqrm"
+L273: .string "rkifweawdsoaxzh"
+L274: .data 952
+L275: .data 250, 674, 77, -632, 579
+not r4
+
+
+L276: .string "nucatvddxk"
+
+L277: rts
+L278: .data 817, -666, -738
+L279: .data 303, -468, 88, -240, -571, 846, 739
+L280: .string "rshwjiutsvbwncnxybtfiq"
+L281: sub #-148, r1
+jmp *r4
+inc r1
+L282: .string "bpckpobukttrzvayqakobbb"
+L283: .data -141, -123, -631, 240, 686, 875, 544
+L284: .string "apophuiomkxiupcpmqrhee"
+L285: .string "dqzzijkcrjlzcxycjavto"
+dec *r3
+L286: add r3, L307
+L287: .data 892, 555, 553, 603, -219
+L288: .string "mgjzfcouasc"
+L289: .string "tbgzcsm"
+L290: .data 904
+L291: .data 321, -714, -767
+cmp #-196, *r4
+L292: .data 431
+prn *r4
+L293: .string "bottffxbipgfpxnhrsfy"
+red L230
+L294: inc L22
+L295: .string "axhvsspzaedpoztmi"
+L296: stop
+L297: .data -19, -662
+L298: .string "duz"
+red *r2
+L299: .string "jcyzjpjlmb"
+L300: .string "v"
+L301: .string "jaywcnayabuoomilttufhvj"
+L302: .data 64, -440, -794
+L303: rts
+L304: .data 673
+L305: .string "jswzulfbvalnhchkp"
+clr r1
+L306: .string "pseyiiuewvhlmygcsmiwgnvr"
+L307: .string "ijemxbnpapqn"
+stop
+
+L308: .string "mngirq"
+L309: .string "ihlvkkhpvrmvm"
+L310: .string "kptk"
+L311: .data 501, -395, -481, 928
+rts
+jmp L256
+L312: .string "uanpjg"
+clr L20
+dec *r1
+L313: .data -714, -644, 918, 788, -440
+L314: .string "gxkoool"
+L315: .string "trksljdmzknmjfa"
+bne *r0
+bne *r4
+stop
+L316: .data 280, -650, 614, -6, -676, -674, -581, -793
+L317: .string "jjkritkslwtcvxdzwxsvoq"
+L318: .data -506, 120, -957, -40, -369, 452, -251
+L319: .string "piwcvdeiehsuwtoreehxtv"
+
+L320: .data 655, 674, 505, -405, -253, 162, 742, 957
+L321: .data -941, -267, -971, 538, 670, -470, -187, -36
+L322: .data -885, -721, -451
+lea L160, L170
+L323: .data -779, 885, 509, 130
+L324: .string "bftlbsfzdlhupfxnyepecokb"
+L325: .data -831, -423, -510, -368, 422, 787, 56, -835
+L326: .string "kovdceunmxakpg"
+L327: .data -475, 386, 763, 513, 481, -654, -976, -918
+dec r2
+L328: .string "sl"
+inc *r2
+lea L329, *r4
+not L330
+prn #225
+L329: .string "puwqltawpaomy"
+L330: .data -94, 720, 522, -182
+jmp L67
+L331: .string "uceyyyedcdfhksh"
+stop
+L332: .data 355, -835, -38, -270, -712, -286, -396, -248
+stop
@@ -0,0 +1,524 @@
+; Generated by genCorpus --seed 102
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: .string "rqoxbexszbkbsfti"
+dec L0
+L1: .data -661, 393, -815, 790, 118, -866
+L2: stop
+L3: .data -149, -136
+L4: .string "womyvdli"
+dec L3
+L5: .string "ipppnmpyknskw"
+sub #-186, L2
+L6: .string "iolgkllbgemfa"
+L7: .string "inkagfzh"
+L8: jsr L96
+L9: .string "ayfgj"
+L10: .string "lwzssxqrxscczgklpnnbpxw"
+L11: .string "qcoheupf"
+stop
+L12: .data -310, 278, -595, 253, 689, 776, 771
+L13: .data -954, -874, -368, 536, 283, -522, 951
+L14: .string "wjuaroph"
+L15: .string "woaiofduyb"
+rts
+L16: .data 816, -401
+jsr *r4
+L17: .string "kakoy"
+cmp r1, L8
+L18: prn #-168
+L19: .data 623, -462, -288, 343, 559, 635, 258
+L20: .data -317, -339, 851, 792, 669, -789, 216, -191
+sub #116, r0
+L21: .string "dwzcrl"
+L22: .data 771, 132, -38, 484
+L23: .data 922, -574, -781, -92
+L24: .data -368, -972, -729, -808, -596, 39, -348
+L25: .data -816, -317, -393, 741, -459, 404
+not L12
+prn *r0
+L26: .data 915, -999, 234, -121, -221, 385, -929, -158
+clr *r4
+jsr L3
+
+L27: .string "xxnwnfsxtnjpmxqns"
+L28: red r1
+bne *r5
+L29: rts
+L30: .data 532, -78, 906, -279
+L31: lea L31, r4
+L32: .string "phnfhtgyeqtkznprjl"
+; comment
+L33: jmp *r7
+L34: .data 85, 471
+
+L35: .string "secdeawxuiuxdrluoh"
+L36: .string "gmphm"
+L37: .data 940
+L38: .string "qxvjead"
+jmp *r3
+L39: .string "buzcgxgztlcdizsx"
+L40: .data -617, 795, -125, -333, 952, -747, 758
+L41: .data 494, 332, 302, 449, 297, 731, -930, 317
+L42: .data -438, -595
+not r4
+jmp L18
+; comment
+L43: .string "kfxaxqlpotkgrargoyfp"
+L44: .data -536, -408, -572
+L45: .data 11, 380, -442, 332
+L46: .data 346, 24
+L47: .data 629, -322, -33, -783, 838, 506
+
+L48: .string "zrphvvndcorhon"
+prn L6
+L49: .string "it"
+L50: .data -281, 305, 956
+L51: .data -874, -450, 152
+bne L200
+L52: .data 711
+L53: .string "mzxdqspdcauzajti"
+L54: red r6
+L55: .data -912
+L56: .string "gjzqcxegifnkbzqstzktpbhc"
+L57: .data -499, -795, 646, -415, -942, -757, 699
+L58: .data -425, -880, -150, 566, -597, -923, 195, -221
+L59: .string "etnemutmdobzk"
+L60: inc r0
+L61: .data -802, -662, -406, -889, 149, -261
+L62: .string "cssoctpaxn"
+L63: .data 15, -411, 595, 772
+L64: prn L74
+L65: .string "jnvjgixfopzbhyoxy"
+L66: .data 54
+jsr L327
+sub r4, r4
+cmp L11, L33
+inc *r4
+jmp *r7
+L67: .string "kelgcgktpobcu"
+L68: .string "laukuewmjf"
+L69: .data -457, -824, -685, -10, -875, 604, -517
+L70: .string "kfcczjdgebuva"
+bne L46
+
+L71: .data -173
+clr r0
+L72: .string "qbtdqqhfyfysdblinlw"
+L73: .data 418, 963, -695, 712, 523, -788, 473
+L74: .data 740, -422, 58
+L75: .string "am"
+L76: .data -469, 939, -744, -218, -533, -24, -311, 782
+jmp L220
+L77: .string "yrmgegbti"
+L78: .string "lysuhqrjsqtwognflyqwwn"
+L79: .string "lsfuhwuxvxtldoswkvlixbqu"
+L80: .string "jkcnln"
+L81: .string "aqjm"
+L82: .string "tbheq"
+L83: red L69
+L84: sub *r7, *r3
+L85: .data -758, 923
+jsr *r3
+; comment
+L86: .data 844
+L87: .data 155, -300, -353, 893, -334, 917
+L88: bne L289
+L89: .data 421, 120, -205
+L90: .data -455, -172, 486, -749, 481
+L91: .data 365, -825, -224, 398, -833, 831, 198
+jsr L226
+L92: clr r2
+L93: .data 784, 144
+L94: .string "maxozslwj"
+L95: .string "klgyjdhtfnmmpaibuz"
+dec *r4
+not r5
+jmp *r0
+L96: .data -743, 491
+L97: .string "jtd"
+lea L86, r5
+sub r0, L53
+jsr L148
+L98: .data -840, -843, -62
+L99: .data 725, -848, 438
+prn #183
+L100: .string "upcxmettgebhi"
+L101: .string "khwvrlpzyoatkws"
+dec *r1
+L102: jmp L67
+L103: .string "ycsgbkuduchlfsgkrqzle"
+L104: .string "libvugov"
+stop
+lea L79, *r4
+L105: .string "cgqzflvrhbbdrjvfxwacvf"
+L106: .string "banogduxwulwjovas"
+L107: .string "dvjnustjvgdz"
+L108: rts
+L109: .string "ismnyyxzsp"
+clr L211
+red L107
+L110: .data -947, -91, 119, 865
+L111: .data -669, -189
+L112: .data -257, -15, -917, -773, 423
+L113: .data -735, 202, 712, 421
+L114: .string "xaddgpgbtq"
+L115: .string "bcozyjuegas"
+L116: .data -227, 264, 595
+L117: .string "twtrwwvn"
+L118: .data -677, -830, 320
+L119: .string "ddczsab"
+L120: .string "uacyaenulqlosvuh"
+; comment
+L121: .string "mqhzzmsmxpgj"
+lea L328, r6
+lea L67, L319
+L122: .string "byfmztdsgmjcpvf"
+L123: .string "kboeehxmq"
+lea L73, *r4
+L124: .string "zywkege"
+L125: .data -308, 162, 216, -857, 204
+L126: .string "qrusnrayutvbwzwshlfqsdju"
+L127: .string "xmz"
+L128: add r6, *r6
+sub *r7, *r5
+L129: cmp *r6, L118
+jsr L92
+L130: .data 842, 829, -32, -85, -72
+inc *r2
+L131: .data -59, -589, 91, -413
+stop
+mov L246, r2
+L132: not *r5
+L133: .data 861, 189, -107, 204, -836, 433
+L134: .string "phceofhftbtolbxtmxgaws"
+L135: .string "cyqtcgpioybkjtbx"
+L136: .data -405, 40, -193, -932, 33, -12, -858, -96
+red r6
+L137: .string "hwgyskkpcsjjy"
+L138: .string "pvdg"
+
+L139: .string "t"
+L140: dec *r6
+rts
+L141: .data -789
+L142: .data 443
+prn r4
+stop
+L143: .string "tns"
+jsr *r5
+rts
+
+L144: .data 879, -148, -67, 342, 577, 19
+L145: .string "ppotwqojmt"
+L146: .string "xigkkcu"
+L147: rts
+L148: .data -372, -541, -832, -171
+stop
+L149: .string "zfkoedol"
+L150: .string "ykfnke"
+rts
+L151: .string "ovpjkzshymgiya"
+L152: .string "inpji"
+cmp #-93, L15
+clr *r1
+L153: .data -570, 81
+L154: .string "fes"
+L155: stop
+jsr *r3
+red L248
+cmp r5, #249
+stop
+bne L217
+L156: .data 131, 562, 880, -63, 395, 513, -97
+lea L300, r1
+L157: .string "xksrpvxxsgtgqwwla"
+; comment
+L158: .string "i"
+L159: .string "cr"
+L160: .data 300, 822, 994, 413, 519, -54, -372, -495
+L161: .string "wblnbmgfmgzgf"
+L162: .data -6
+prn r4
+L163: .data -221, -121, -521, 300, -311, 655, 876, 619
+dec *r4
+L164: .data 244, 553, -812, -581, -138
+L165: .string "rtoezlh"
+L166: .string "xzrob"
+red r2
+L167: .data 930, 862, -298, -476, -873, 730
+L168: .data 139, 6, 486, -867, 499, -399
+L169: add r4, r7
+L170: .string "tzeqkylttrpwjtiy"
+L171: .data -582, 426, 4, -570, -631, 212
+L172: .data 506
+L173: .data -826
+; comment
+L174: .data 922, 431, 949
+dec L59
+L175: .data -660, -934, 653
+L176: .data -252, 916, -867
+L177: .string "zeavhwdfplfniieozau"
+L178: .string "zwhehpc"
+L179: .string "daaelytgbo"
+L180: .data -580, 940, 134, -197, -128
+L181: .data 877, -342, 39, 562
+
+add L252, r4
+bne *r3
+; comment
+dec r7
+; comment
+L182: mov r0, *r5
+L183: .string "pgfxfxovzhkkz"
+L184: .data -989, 931, -899, -753, 995, 608
+jmp *r1
+L185: .string "gmzqizuheabo"
+L186: .data -111
+L187: .data -676, 577, 907, -785
+L188: .string "rclfctogbvfjebxct"
+stop
+L189: .data -352, 326, -914, 210, 891
+L190: .string "anjohvzdltwlszajgu"
+dec r3
+sub #93, *r6
+L191: .data 453, 548, 895, -735, 231, 97, 142, -555
+L192: .data 902, -753, 967, -950, -299, -131, 491
+L193: .data 270, -79
+bne *r7
+inc r7
+L194: .data 922, -186, 26, 416, 370
+L195: .data 449, 508, 72, 421, -230
+L196: .string "orxnnfc"
+dec L35
+L197: .string "jwytiusbimppxpeovxkziq"
+L198: .data -746, 270, -235
+mov L192, r7
+red *r4
+L199: .data -306, 854, 596
+L200: lea L330, *r7
+L201: .data 319, 274
+L202: .data -463, 140, 449, 605, -991
+inc r7
+L203: .data 614, 373, -555, -329, -451, -399, -887
+L204: .data 413, -864, 636, -854, -628
+L205: .string "jjvbo"
+L206: jmp *r2
+L207: add L320, r0
+L208: .data -396, 187
+rts
+L209: .string "xlrxrsjxw"
+L210: .string "nbij"
+L211: .string "xqvoyslohwgzjionpgkntokc"
+L212: .data -476, 212, -926
+lea L246, r0
+inc r2
+L213: .data 209
+dec *r6
+L214: .data 464, 260, 365, 668
+L215: mov L287, L272
+L216: .data -5, 788, 798, 712
+L217: .data 863, 908, 995, 735, 360
+L218: .data -935, -624
+L219: dec *r2
+red r2
+cmp r0, *r3
+jmp L132
+cmp r6, *r3
+L220: cmp L234, L79
+bne *r4
+L221: .data -387, 898, 243, -150
+L222: .data -704, -476, -421, 302, -212
+jmp *r6
+L223: .string "plvxpdcvlzqpvhkxq"
+L224: .data -133, -949, 872, -833, 506, 361
+add *r7, *r0
+
+sub L286, L146
+L225: .string "tkvugfktqvgucwpknvunk"
+L226: .string "ay"
+L227: .string "nfpbbebyajcci"
+L228: not r7
+L229: .string "nxpgtlo"
+add *r1, *r2
+L230: .string "gjqozdrrwwhptolsfv"
+L231: .string "sqdatgjfaxt"
+L232: .string "uipzkhkymqbar"
+red r1
+L233: .string "oqfpbjrqqimgadk"
+rts
+L234: .string "yiahtvcofpnoshxc"
+jsr *r5
+L235: .string "wyoplrzcdz"
+L236: .data 140, 178
+add *r0, *r2
+L237: .data 986, -940, -409, -499
+jsr L81
+L238: .string "mvbcamxhrgotuqvc"
+L239: .string "fudnamm"
+L240: .data -143, -436, 376
+L241: .data -867
+L242: .string "dfirrucpmcuwayexqydtp"
+L243: .data 554, -413
+; comment
+clr L330
+L244: .data -788, 430, 890, -206, -935, 456
+L245: cmp *r7, L206
+L246: .data -849
+red r0
+red L180
+L247: .string "lxpvhhdekkcjkkpncbm"
+L248: .string "uv"
+L249: .data 71, 918, 504, 889, 512, -344
+L250: .string "qgatcyusmfpygsd"
+clr *r6
+L251: .string "ixrj"
+
+L252: .string "mcl"
+L253: .string "szbtv"
+red L304
+L254: .data 113, 148
+prn *r4
+; comment
+jmp L307
+not r1
+L255: .string "coodigivtu"
+not r4
+L256: .data -74, -751
+rts
+L257: .string "ylhvwwgjqkj"
+L258: .data 546, -725, -172
+L259: .data -981, -428, -15, -35, -176, -928, -604, -474
+dec r6
+jsr *r0
+jsr L306
+red r5
+L260: cmp #124, *r6
+L261: .data -980, -419, 895, 169, 970
+L262: .string "vpklsvyjyflvzdchwihehi"
+L263: .string "u"
+L264: .data -111, -262, -295
+L265: .string "lnvuegwsdzurrvmritwt"
+L266: .string "lkpi"
+L267: .data 753, -621, -769, 468, 955, -58, 928
+L268: .data 590, 240, 618, -414, 493, -113
+L269: .data -564, 809, -224
+L270: .string "edte"
+L271: .data 408
+L272: .string "ec"
+prn #172
+prn *r4
+L273: inc L286
+L274: .data 978, -476, 731, 667, 256, 461, -909
+L275: .string "qgcrtbo"
+L276: .string "svudjrordyodfbirm"
+
+L277: prn L51
+L278: .string "ufdmyvshipxurdnzdvm"
+L279: .string "xsuexphamkrlammicqd"
+L280: .data -413, 257, 982
+L281: .data -157, -885, 24, 211
+
+L282: sub L55, r3
+L283: bne *r7
+L284: .string "rlnprfrmqrpuiodjoomssj"
+L285: stop
+jsr *r1
+L286: .string "mhhdobimbquqf"
+lea L324, r3
+L287: .string "fxoggkkqrybpymbcporbi"
+lea L289, r0
+L288: .string "jataazogkxdhpmpmp"
+L289: .string "ypopupwfzsuhqoobj"
+L290: stop
+L291: .data 719, 18
+clr *r6
+L292: .string "cvxcfbgswqezqcntlgtwj"
+L293: .data 259, 965, 86, 209, -514, -275, -899, -454
+cmp L73, *r4
+add #-242, *r5
+L294: .string "vabdplcbzhuxucprijjyclao"
+L295: .string "lsajuqpcdfvybhrbpvvmztp"
+L296: .data 645, 358, -544, -956, 44
+prn r1
+L297: .string "trvhvycafyaknnfgzorq"
+stop
+L298: .data -230, -500, -776, 822, 350, 591
+L299: .string "tcvjnczsy"
+rts
+L300: .string "hwazxpyqweiu"
+L301: inc *r7
+L302: .data -652, 165, 794, -386
+prn *r0
+L303: .string "spabdgpevwatfevvttczc"
+L304: .string "eggegbytrsjmcjzabkf"
+cmp r1, r6
+inc *r6
+L305: .string "zckzmaxzuhwqx"
+L306: stop
+L307: .data 146, 429, -518
+L308: .data -570, -249, 757, 194, 929
+L309: prn r3
+L310: .string "blwfomqlukfvudvxnow"
+L311: .string "aevxtfuzmeo"
+L312: .data -648
+L313: cmp #-75, r3
+red r4
+mov r7, *r3
+rts
+L314: .string "fpzhyyxnqh"
+prn r5
+add L317, r6
+L315: .data -330, -576
+jmp *r7
+L316: sub #-44, r4
+L317: .data 300, 711, 782, -60, -150
+inc r3
+L318: .data -259, -815, 520
+L319: .string "msofrvvtduvusqjwlt"
+not *r1
+L320: .string "yrylfudomdvbyqejtamyrnd"
+L321: .data -221, 713, -682, 283, -948, -655
+L322: .data 201, -139, 42, 128, -578, -117, -495, -450
+L323: .data 787, 377, -986, 659, -81, 564, 902
+L324: .data 197, 356, 60, -354, 267, 668, 948
+L325: .string "wtrwthwiazjkpq"
+L326: .string "betebz"
+jsr *r6
+inc r7
+L327: .data -485, 314, 92, -24
+L328: .string "rghtcfyqqpzkgwmuiq"
+L329: .data 37, 750, -552, -859, 548
+L330: .string "mdtsv"
+L331: .data 835, 94, 704, 969, 842, 987, -257
+; comment
+L332: add L333, L311
+L333: .data -125, -196, -396, 20
+jsr *r3
+L334: .string "ictqszvdhpf"
+L335: .data -243, -803, -608, -44, -622, -571, 861, 978
+red L214
+L336: .data -752, -662, 311, -335
+L337: .data 78
+L338: .string "lmzi"
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 103
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+red L324
+inc L314
+L0: .data -61, -288, -10, 121, 724, 112, 574
+L1: .string "wpzltvpnldunxiva"
+L2: .data -168, 140, -935, 863
+L3: .string "brprru"
+L4: .string "ozwhibr"
+L5: .string "bn"
+red L201
+L6: stop
+rts
+L7: .data -704, 199, 894
+L8: .data 338, 825, -565, 452
+L9: .string "rkgzxrbxuanjt"
+sub r5, *r0
+L10: .string "iwbavfvmevcogfjiuxchvov"
+L11: .string "umjehagifpcen"
+cmp r1, L7
+L12: .data -67
+red r0
+L13: .string "kg"
+L14: .data 965
+sub *r5, L8
+; comment
+not r5
+L15: .string "laletmj"
+L16: .data 738, 315, 154, 446, 873, 862
+L17: .string "sjezue"
+L18: .string "w"
+L19: .data 713, -152, -674, 865, -56
+L20: .string "zvqjwt"
+L21: .data -575, 415, -83, -23, -510
+rts
+not r0
+prn r2
+L22: .string "hjsrsobhx"
+L23: not *r3
+L24: rts
+L25: .data 917, -384, -35, 450, 857, -373
+L26: .data 291, 158, -681, 841
+L27: stop
+cmp *r7, *r7
+L28: inc r7
+dec *r3
+stop
+L29: .data -138, 98, 309, -191, 94, -964, -874
+L30: .string "ybqebwkecms"
+L31: clr L258
+clr L39
+rts
+lea L122, *r5
+L32: .data -714, 420, -420, -934, 939, -32
+L33: .string "hrshymibpcsm"
+L34: .data 563, -894
+L35: .data 360, -963, -180, -690, 476, 838
+L36: .data -52, 351, -285
+sub #-121, *r4
+L37: .string "ywezorquwttwdpldocwe"
+jsr L164
+L38: .data 478
+inc *r6
+L39: .string "yjmk"
+L40: prn L73
+
+L41: .string "uzowganippbuexwgsvwiv"
+clr r0
+L42: .string "aevchqfeaqwkmyolgy"
+red *r1
+L43: .string "ipw"
+L44: .string "ohhzhmtw"
+; comment
+L45: lea L151, *r1
+L46: .data -373, 557, -417, -929, -215, -645
+dec *r1
+add L311, *r5
+L47: prn #14
+L48: .data -852
+L49: .string "wae"
+add *r5, L82
+not r1
+sub #-15, L80
+cmp #170, #-150
+bne L320
+L50: red L83
+sub L26, L34
+L51: .string "iwhpyxujgjgtnyooklgg"
+L52: .data -989, -740, 433, -345, 753
+L53: .data 955, 205, 593, 108, 288
+bne L311
+L54: .string "kamtyuckbbmlnmangxs"
+L55: .data 49, 337
+L56: .data -607, -726, -197, -850, 561
+; comment
+L57: .data 501, 86, 956, -887, -958, 129, -624
+L58: .string "l"
+mov *r1, r0
+L59: .string "uqgjktrmqovtups"
+L60: .data 39, -580, 840, -900, -481, -454, -1000
+mov r5, L199
+L61: red *r5
+L62: .string "fuadkdsg"
+L63: .string "rfbzvglngvz"
+L64: sub #157, *r5
+L65: .string "ythmozhlnqunvincznn"
+dec r5
+L66: .data 652, 217, 130, 225, 117, -532
+red L61
+inc L130
+clr *r2
+stop
+L67: .string "btkucsqmbo"
+L68: .string "aflor"
+prn L40
+L69: .string "uhfzdnoj"
+L70: jmp *r6
+L71: .data 998, -864, -920, 47, -731, 10, -751, -933
+cmp #-169, #213
+L72: .data -725, 724, -803
+L73: .string "abdjlauularaktgydwwslirb"
+L74: .string "vwgxajbpsdgpstx"
+L75: .string "ljlvhosiijobspghmquy"
+prn #-58
+lea L234, *r1
+L76: .string "svgqrlnerh"
+L77: .data 561, 948, -963
+L78: .string "ynbdepzlero"
+L79: .string "phpzdnf"
+bne *r6
+L80: .data -514
+L81: .data 386, -245, -660, 527, -4, -75
+L82: .string "iioncrhmijfparddoagxzd"
+clr *r5
+add *r4, r4
+L83: .data 519, -156, -488, 327, -325
+L84: .data 668
+cmp L41, r5
+L85: .data -896, 590, -390, -881, 488, 952
+L86: mov r1, *r2
+L87: .string "mwshurdbsuzchjqqvsifrf"
+L88: .data 693
+L89: inc *r3
+L90: .data -859, 126, -988, 511, 273
+L91: .data 240, 845, -574, 937, -847, -475, -677, 751
+L92: .string "erdnbbeeodcqvxdq"
+L93: .string "ytqapftigtmzouazzpeueiol"
+rts
+L94: .data -870, -792, 545, 190, -538, 36, -359
+; comment
+L95: .string "pvzny"
+L96: .string "ozegipvnia"
+lea L36, r0
+not *r7
+L97: .data -790, 868, 486
+L98: .data 434, 127, -258, -659, 267, 779, 372
+L99: .data -988, 89, 39, -849, -428
+L100: .string "uvzqpsdiqotgqfb"
+L101: .string "oocurdxgijji"
+stop
+L102: .data 461, -769, -921, -129, 762, -166
+L103: .data -478, 615, 330
+L104: .string "kmvpvpzouss"
+L105: .string "mz"
+L106: .string "mfzdfbcwftikfixjgwmgozq"
+L107: .string "adpgxclyxob"
+L108: .string "o"
+L109: .data -466
+stop
+; comment
+jmp *r2
+L110: .string "frjkgjlawtcsylftybkndbg"
+not r6
+L111: .string "ruiedpr"
+L112: .data -608, -178
+L113: .string "tq"
+not r0
+L114: lea L23, L222
+L115: .string "yakybnuzsn"
+L116: cmp r1, *r1
+add #196, L227
+prn #242
+L117: prn L136
+jmp L64
+L118: sub L62, r3
+L119: .string "iaklbou"
+L120: .string "dlswpvvjt"
+; comment
+L121: .data 842, 99, 845, -512, -377, 727, 363, 516
+add r7, r0
+L122: .string "mecnvaondvociobcduf"
+L123: .data -108, 606, -883, 607, 315, -89
+inc L104
+L124: .string "zdeutuddne"
+L125: .data 278, -723
+L126: .string "llanwevapnyjgr"
+L127: .data -479, -629, -698, -881, 119
+; comment
+red r6
+L128: .data -982, -853, -103, 672, -586, -308, 178
+L129: .string "oxryoqvgkpfmskbwew"
+L130: .data 475, -693, 521, -965
+L131: .data 164, 520, -739, 234, 280, 780
+mov *r4, L288
+L132: red r5
+L133: .data 181, 613, -277
+L134: .string "j"
+L135: .data -815, -5, 699
+L136: .data 577, -772, -737
+stop
+L137: .data -881, -491, -655, -537, -56, 180
+L138: .string "ldnwpevwynxzybrq"
+L139: .string "rzvzvmadmazqbqfcqsgo"
+L140: .data 707, 782, -258, -871, -972
+mov *r3, L253
+L141: add #203, r1
+L142: .data -446, -115, -767, -94
+L143: .string "piewbr"
+L144: .string "z"
+L145: .string "rwyuqsgdurroaaw"
+jmp L248
+L146: .data 455, -221, 416, -811, 313, -44, 382, -29
+L147: .string "pzjwpsijcuv"
+stop
+add L14, r3
+red *r4
+L148: .data -415, 755
+L149: .string "fahz"
+prn *r3
+L150: .data 594, 537, 201, 737, 482, -383, -162, -250
+L151: .string "copxyqowmfylp"
+L152: not *r7
+L153: .data -527, -717, 118, -884, 374, -212
+lea L304, r4
+clr r5
+cmp *r1, *r3
+L154: .data -106, 667, 301, -282, 909, -343, -570, -429
+L155: .string "tdwmfcybnhgzjndcqkgpyx"
+rts
+L156: inc r5
+L157: .string "dyoxtatkyvfq"
+L158: .string "dbtpspeckcjsndjzdpb"
+L159: .string "kwanhqmpbm"
+jsr L114
+mov r5, L99
+L160: .string "wufjiftytzkqacnichtupo"
+L161: .string "hhpzfyjtqvka"
+L162: .data -173
+prn r0
+L163: .data -990, -266, 558, -748, 958, 534
+L164: .data 252, -301, -40
+add r0, *r3
+prn *r6
+L165: .string "gngdlnsrbyuruzenv"
+L166: .data 646, -40, 846, -301, -658, 350, -3, -700
+L167: .string "q"
+sub #-73, *r7
+L168: .data -898, 589, -190, 117
+L169: .string "xgekjizft"
+L170: .string "es"
+clr *r6
+L171: .data 995
+L172: .data -914, -725, 515, 735, 187, -22, 6, -445
+L173: .data -905, 399, 864, -831
+L174: add *r5, *r5
+L175: .data 495, -742, -154, 267, -960, 186, -127
+L176: lea L207, *r5
+L177: .string "bbnyencoeus"
+add r5, L101
+rts
+L178: .string "hyelthnfaft"
+jmp L221
+L179: .string "gckhyn"
+not r1
+L180: .string "zxsqfc"
+rts
+not L292
+jsr *r5
+L181: dec *r1
+L182: .data -990, 265, -100, 552, -573, 155, -982
+
+stop
+L183: .data 627, -426, -208, 382
+rts
+L184: .string "fuulshxbikmubuobdkhxys"
+L185: .string "moslxuidvt"
+L186: .string "pzrkzbb"
+L187: .data -441
+L188: .data -2, -19
+
+L189: .data -202, 668, 264, 562, 202, 418
+clr *r3
+sub r5, *r3
+L190: .string "vysearz"
+L191: .data 258, 992, -639, 575, 315, -159
+L192: .data -518, 634, -956, 342
+mov #-79, *r7
+L193: .data -436, 596, 104, 503, -589, 662, 146, 572
+L194: .data -592
+L195: .string "dkp"
+L196: .string "ewmjfaatuvjkx"
+L197: .data -440, -580, 621, 271, -620, 420, 443
+; comment
+lea L83, L99
+L198: .data -170, 891, -285, 384, 419, 736, -350
+sub #-146, *r6
+L199: jmp L299
+stop
+L200: .string "lstqbrm"
+L201: .data 414, -40
+L202: .string "dcniyncgoxbcbwxhfq"
+L203: .string "yxyutlkxey"
+; comment
+sub #251, *r6
+L204: .string "kdnpazwrrc"
+L205: .data -598, -697
+lea L62, *r5
+L206: .string "isjafuprbqxbrzacbfur"
+L207: .string "nbltxdxa"
+L208: .string "nzgploto"
+L209: add r4, L328
+jsr L314
+L210: .data 725, 830, -407, -491, 749, 956, -212
+inc L249
+clr L223
+L211: .string "lyxlmtndnkzwmrog"
+L212: .string "mhtz"
+L213: .string "aqbfharyajwrrnx"
+L214: .string "emvvvyhhqqgbufmwjqt"
+rts
+L215: .string "oxlyumvuzvirggvfbfc"
+L216: .data -230, 538, 921, 314, -918, -966, 615, 513
+mov #-152, L287
+L217: .data -561, -691, -441
+add r6, r7
+L218: .data 293, -563, 925, -676, 620, -803, -240
+L219: .string "voernumnyy"
+; comment
+L220: .data 354, -483, 227, -781, -232, -75, 163
+clr r7
+
+L221: .string "rsfkzkdk"
+L222: .string "xwahuibfngiekpqkmfw"
+L223: .string "ugpddrfj"
+
+L224: .string "jxdhlqdfwpevfbraxzckul"
+L225: .string "vgywhs"
+L226: .string "gcil"
+L227: .data 565, 302, -10, 829, 659
+L228: .data 712, -543, 943
+stop
+add *r7, *r5
+bne *r4
+add r4, r2
+L229: .data -619, -566, -830, -553, 971, -166
+lea L49, r4
+L230: inc r6
+dec *r4
+L231: .data -802
+
+L232: .string "ffupadbfyjw"
+
+mov *r4, *r4
+L233: .string "gkqrartadpavq"
+L234: .data -586, -697, 973, 770, -707, -28, -569
+L235: bne *r3
+L236: .data 649, -222, 781, 535
+L237: .data -977, 179
+L238: .data -733, -245, -275
+L239: .string "hjdljnaznwagiaelhmoa"
+L240: .string "pjmqunlqzxvemix"
+add *r1, *r5
+L241: .data -48, 64, 35, 748, -769, -794, 370, 514
+prn L166
+jmp L293
+L242: .data 564, -344, -586, 531, 161, 232, -557, -403
+; comment
+inc r7
+L243: .string "acnkgpgxxepjmoz"
+L244: .string "wwhcmyldlhummgidczypoji"
+L245: .string "eegvgrpiagsjycdcvum"
+L246: .data -317
+add r2, L153
+L247: .string "je"
+L248: not L126
+stop
+clr L85
+L249: .data -556, -398, -673, 523, 635, -159
+L250: .string "cwbfxgvwp"
+L251: .string "maczf"
+L252: .string "fiplhsnzhyfnsn"
+sub L326, *r0
+L253: .string "kgjgv"
+L254: .data 459, -1, 806
+lea L257, *r3
+not r2
+L255: dec *r6
+L256: .data -254, 831, 583, -568, -972
+L257: .string "ozpczyo"
+L258: .data 463, -909
+rts
+L259: .string "snnpbb"
+stop
+rts
+; comment
+L260: .string "pzucklrkteack"
+L261: .string "swamvgcxstpeniifcbbhedp"
+add r6, r1
+L262: .data -246, -295, 98, -299, -892, -819, 661
+L263: .data 825, 663, 717
+add #-155, *r2
+bne *r7
+L264: .data 903, 365, -353, -453, -505
+L265: .string "orncqvnxuihonvpikbtpqrkc"
+L266: .data 582
+L267: .string "ampo"
+L268: .string "ultxmfecz"
+lea L275, r3
+L269: .data 429, -610, -786, 928, -180
+add r3, L324
+L270: .data 734, 269, 410, 421, -587
+add r0, L278
+L271: .data -57, -76, 212, 568, -366
+L272: dec *r3
+L273: prn r3
+L274: .string "vhsydsjow"
+L275: .data 420
+prn r2
+L276: .string "nqltjolsbprbzrwiafqsh"
+L277: clr r3
+L278: .data 541, -179, 778
+red *r4
+L279: .string "vnrezmaflxcsqwkvdk"
+L280: .string "okrfslosjd"
+lea L292, r4
+L281: .data -553, 443, -640, -468, -128
+L282: .string "cemnsfax"
+L283: .string "upbhhpecqeecpwqrazhdzmfn"
+L284: .data -667, 465, -426, 334, 328
+add L236, L25
+rts
+L285: red *r5
+L286: .data 951
+lea L96, L135
+add *r7, *r3
+red r7
+L287: .string "auaj"
+L288: .data -291
+L289: not L243
+L290: .string "fsawchnclel"
+lea L305, r4
+dec *r3
+L291: .string "lfyjceg"
+L292: .string "zuaqcttafesqkfy"
+mov L311, *r1
+L293: .data -75, 87, -92, -984, 990, 590, -721
+L294: .data -220, 234, 393
+add r0, *r5
+mov *r0, *r4
+L295: .data -411, -416, -534, -651, 385, -918, -461
+L296: .string "cxellfd"
+L297: .string "jhwwqguwcjf"
+L298: .string "baten"
+L299: .data 542
+L300: add #-225, r3
+L301: .data -770, -561, 999, 527, 777, -744, -455
+L302: .string "kgdcbivfjsz"
+L303: stop
+L304: .data 377, -379, 426, -532, -936, 499, -405, -217
+L305: .data -425, -60, -256, -424, 376, -975
+L306: .string "svuduhspvanuqppkdkhj"
+lea L316, *r0
+not r5
+cmp L327, L210
+L307: .data 658, -709, -344, 699, 622, -655, -960, 137
+L308: .string "p"
+L309: .string "dkvaxhbpjmabsrtnare"
+L310: .data 64, 562, 320, -378, -636
+L311: .data 43, -856
+mov L92, *r3
+L312: not L320
+L313: .string "lyopb"
+L314: .data 593, 880, 238, -901, 552
+L315: .data -815
+jsr L190
+L316: .data 885, 343, 892, 554, -254, -582, -200
+L317: .string "eljjhkuvgchvsxrc"
+L318: red r3
+jmp *r5
+sub r3, L307
+L319: .data 727, -817, -537, 729
+L320: .string "gcxhdtwxdj"
+mov L322, L241
+L321: stop
+L322: .string "xrsephsrydkqn"
+L323: .string "jxayjwyvgbkutvzy"
+not r4
+L324: .data -414, 91, -6
+L325: not *r2
+L326: .string "qund"
+L327: .data -694, -781, 778, 796, 991, -35
+L328: prn *r3
+stop
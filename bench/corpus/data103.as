@@ -0,0 +1,524 @@
+; Generated by genCorpus --seed 104
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: .string "zkfbrknzggjc"
+L1: .data 633, 30
+L2: .data 150, 435, -162, 324
+L3: .data -486, 704, -226, -502, 774
+clr r0
+L4: .string "wqearjnxihybnyjjxcrsa"
+L5: .string "diobddlbynhutwmkszzfmsyn"
+add L1, L4
+L6: .string "ajwgijsgefnbtzy"
+cmp L122, r7
+L7: .data 205, -360, 978, 654, 478, -934, 374
+; comment
+L8: .data 587, 32, -808, 49, 237, 154, -158
+L9: .data -756, 68, -950
+L10: .data -847, 679, -391, 72, 600, -336, -109
+sub *r3, *r1
+L11: .data 107, 950, 332, 827, 611
+L12: .data 491
+L13: .string "gbwantjzpqeqypqxnawwch"
+L14: .data 683, 557, 358, 475, 960, -854, -242
+L15: .data 267, -697
+; comment
+L16: jsr *r0
+sub L287, *r7
+L17: .data 671, -805, 513, -99, -533, 219, 981
+rts
+jmp *r0
+not r5
+L18: .data -496, 174, 859, -929, -100
+; comment
+L19: .string "hmatciqbeoudsveugogfiuc"
+inc r5
+L20: .data -94
+L21: cmp L104, #83
+L22: .data -742, -530, -43, 886, -213, 829, 215, -975
+lea L6, *r2
+stop
+L23: .string "xmjktbdovlnxcexny"
+L24: .string "sq"
+L25: .string "iqtbwlrulolk"
+L26: .data -278, 595, 979, -378, -758, 371, -979
+not L265
+sub r3, L12
+L27: .string "j"
+L28: .string "eekyqtrscunyhuxhnsnhbmh"
+L29: .string "kmdvzmucfm"
+L30: inc L23
+L31: .data 996, -809, -251, 261, -805, -206
+L32: .string "ctubslxtqnbvccfyrc"
+L33: .string "oqqgqetayiuehilhvfstaxtd"
+L34: .string "qczk"
+L35: .data -52, -411, 938, -770, 106, 30, 273, -520
+L36: .string "gcofhobqzfjqtoo"
+mov *r2, L29
+
+sub *r6, *r2
+L37: .data 651
+
+L38: .string "tlxtmaleakoofurpztrwawwf"
+L39: stop
+L40: .data -525, -168, -636, 732, 459, -440
+L41: .string "gzsjkliqdzevfdkltpcstsr"
+L42: prn *r4
+L43: .string "lktiibaqsve"
+stop
+L44: .data 569, -106, -808, -265, -395, -501
+L45: .data -891, 37, 118, 535
+L46: .data 132, -577, 730, 677, 304, -903, -448
+mov L37, r5
+L47: jsr L35
+L48: .data 582, -70, -888, 207, 943, -681, -723
+L49: .string "inevnwwhzieqniqk"
+L50: .data -205, -904, -888, 696
+cmp r3, *r6
+L51: .data -898, -460, -823, 616, -835, -381
+L52: .data -525, -528, 388, 242
+
+L53: .data 809, -830
+L54: bne *r4
+L55: .data -669, -618, -107, 370, 140, 620
+L56: .data 649, 839, 122, 120, -395, -376, -860, -597
+L57: .data 975, 256, -113
+L58: .string "cschptmbs"
+L59: .string "upkghtmn"
+L60: .string "ajrylktcwwzlghxjemdaxuqb"
+L61: .string "xtwehlhjqblloxsckqt"
+
+L62: red r4
+L63: .data -804, -703, 779
+L64: .string "smxnjgnrhihjichlzss"
+L65: .string "cpriljhlvbbffeowstlzdf"
+L66: stop
+inc *r2
+jsr L315
+L67: .data 711, -908, -689, 464, 959, 767
+L68: .string "frexqfnc"
+L69: .string "txwkvxvbxakkozzkqrq"
+jmp L42
+L70: .string "hkdbrzsrdmilhex"
+L71: .data -28, 406
+L72: .data -382, 319, -117, 581
+L73: .data 522, -651, 599, -716
+L74: .data 887, -808, 642, -321, 269
+L75: .data -589
+L76: .string "zwmykrvxnnfmge"
+L77: .string "nyudzfbjhovpw"
+rts
+L78: .data -603, 763
+L79: .string "qilvq"
+L80: .data -604, -484, -393
+clr L74
+rts
+L81: .string "pemmvcvxwrlvmigixxzkt"
+L82: .string "ffqerybsepnh"
+L83: .data 385, 228, 846, 517
+L84: .data 969, 316, -149, -818, 231, -206
+mov L113, r4
+inc r5
+L85: .string "kujikrbtv"
+L86: .string "bqqthrvjmket"
+stop
+rts
+red *r7
+L87: .string "swdinwrexgkvplhlf"
+L88: .data -890, -837, -67, 713
+jmp L67
+L89: clr r6
+clr *r6
+dec r2
+L90: .string "uaahs"
+L91: mov L43, *r1
+L92: mov r4, *r5
+L93: jmp *r7
+jmp *r4
+L94: .data 889, 707, 642, -438, -304
+L95: .data -184, -830, 766, 497, 590, -591
+prn *r7
+prn r1
+L96: .data 209, -347, 10, 341, 551
+L97: not L149
+clr L47
+; comment
+L98: .data -559, -279, -952, 746, 347, 594, 644, 828
+L99: .string "uszgvmsdbeovrmdxqxzsytj"
+L100: .string "i"
+add #-79, L338
+L101: .data -76, -223, -752, 583, 943, -398, -877, -398
+L102: .data 848, -743, 357, -1000
+L103: sub r0, r0
+L104: .string "bvkwynsljcdeca"
+L105: .data 546, 6, -484, -824, 873, 340, -983
+L106: .string "ucvyrqp"
+L107: .string "yhfhxburkojnkrutipzg"
+lea L288, *r5
+L108: .string "jyrzqeycszfrhixmo"
+L109: prn *r3
+L110: .string "wismkyytk"
+not L323
+L111: .string "hlciijscskhrolihnqkyykb"
+; comment
+L112: .data -154, 91, -824, 756, -42, -681
+L113: .string "agtlwlkzltnz"
+L114: .string "lovprfacpmsyvasgvjjcfkhe"
+L115: .string "rsjsktkwaeqhgjefemmp"
+jmp L112
+L116: .data -325, 796, -516
+L117: .data -61, 992
+L118: .string "fozomgisvjqgzmxj"
+L119: .string "wsnmwxapekaloeebqzqola"
+add #161, *r1
+L120: .string "gkqpzyljhvwbaibencc"
+L121: .data 338, -315, -508, -645, -948, 809, 433, 741
+bne L316
+mov r1, L7
+L122: .string "h"
+lea L12, *r2
+L123: sub r2, *r3
+
+L124: .string "kvwvtvthevcluvwkz"
+L125: .data -95, 165, -205, -921, -486, -354, 206
+not *r6
+L126: .string "moxxinpvbd"
+L127: .string "fkowy"
+sub L336, r7
+L128: .data -610
+dec r6
+inc L133
+jsr L88
+L129: .data 659, -140, -953, -952, -327, 760, 41
+L130: .string "evtuoltvloprzp"
+L131: .string "psdiv"
+L132: .string "wqfogae"
+L133: .string "lexhkmakorkfom"
+
+L134: cmp r0, r6
+L135: lea L31, r1
+dec L280
+L136: .data -919, -4, 107, -379, 306
+L137: .data 916, -433, -554, -962
+stop
+jsr *r6
+jmp *r2
+L138: .string "t"
+L139: .data -693, -665
+L140: mov r6, L117
+L141: .string "nptlbz"
+dec L230
+L142: .data -240, 334, 484, 685, 252
+L143: .data 282, 70, -319, 280, -528, -293, 258
+lea L224, r5
+cmp r7, L90
+
+prn L196
+mov #196, L211
+L144: .string "f"
+add r7, *r1
+L145: .string "etejllbppgdshhqymvmsf"
+dec r4
+inc r3
+L146: .data -211, 357, -671, 233, 850, 743, -451, 637
+L147: .string "cgzpnss"
+L148: stop
+clr L133
+L149: .data 629, 73
+L150: bne *r2
+L151: .string "ixktienfpojzcaqvlksjqiq"
+L152: .data -951, -901, 476, 871
+sub L4, r3
+L153: .string "seeuztqdcpefhubzfb"
+lea L338, *r2
+not *r6
+; comment
+L154: .string "mkxygfwottikkauzmesojz"
+L155: add #-213, *r5
+lea L319, r6
+L156: .data -474, -737, -473, -378, 199, 708, 706
+lea L251, *r2
+L157: .string "fu"
+L158: .data 705, -366, 838, -845, 540, -349, -191
+L159: .data 856, -121, -317, -186
+L160: stop
+L161: .data -338, 783, -17, -277, 792, 627, -192, -207
+L162: .data 688, -187, 800, 261, 752, 249, 666
+; comment
+L163: .string "ipfmabjyvatadgfzjiqpug"
+not L265
+L164: .string "gtggqlov"
+red L291
+L165: .string "sm"
+L166: .string "mdxlcxinakxarjaern"
+L167: bne L239
+jsr *r2
+sub *r0, r0
+sub *r1, r7
+L168: .data -935, 383, -502, 452, 148
+
+L169: .data 848, 30
+L170: .string "pvdnkvoleaq"
+; comment
+L171: rts
+L172: .string "wr"
+L173: .data 282, 370, 58, -350, 594, -301, -696, 371
+L174: .string "wkprmwhdsbrsfrahvf"
+L175: .string "smw"
+red r6
+L176: .string "gfzmgguoabjc"
+; comment
+L177: .data 964
+L178: .data 188, -634, -157, -23, -858, -539, -749, 566
+L179: .data -165, -841, -718, 630, -650, 273, -946
+L180: .data 423, 431, -150
+L181: .data -381, 180
+L182: .data -298
+red L272
+L183: .data 289
+; comment
+L184: .string "nlohwprmbeirgmrqdcseiv"
+L185: .data 428, 787
+L186: .string "ftvdwjxxhsqmwcfj"
+L187: .string "kjwoopy"
+mov r7, r2
+L188: .data -825, 861, 635
+L189: .data 351, -501, -775, -600, 236, 739, -502
+L190: .string "yz"
+red L223
+L191: .string "sshhhlhitnaahm"
+L192: .data 617, 679, 910, 764, -163
+L193: .data 445
+add L38, *r4
+L194: .data -338, -816, -688, 878, 229, -79, 580
+sub r4, *r7
+clr r4
+bne *r3
+L195: .string "thcokvdrwrdy"
+L196: clr *r3
+L197: .string "ewlkhjgdpiyrovqncutloo"
+dec *r5
+jmp L120
+prn L23
+L198: .string "mybbgcaoizytw"
+L199: .data -401, 572
+L200: .data -85
+; comment
+L201: .string "jtcihhjtluxjbvyw"
+L202: cmp *r4, L99
+sub #-220, *r5
+L203: .string "yyrlyhafz"
+L204: prn r2
+L205: .data 16, 911, -258, -244, 458, -979, 990, -746
+L206: .string "bfruuqfsicjlzpprlgbxfma"
+L207: lea L210, r7
+clr *r2
+
+L208: .data -173, -516, 106, 644
+L209: .string "wprtwuyevdoaqpynsz"
+
+L210: .data 824
+L211: .string "ztieogauhzcj"
+L212: .data 686, 156
+sub L63, *r7
+rts
+L213: .string "kzaslbkpgboukiccpqzrf"
+rts
+L214: .data 390, 110, 420, -967, -709, -470
+L215: .string "mrdfjdfpywecnqpzxv"
+L216: .string "mswwb"
+L217: .data 71, -165, 915, -269, -569, -500, -778
+L218: .string "nqiskaegvzjmm"
+prn L50
+L219: .string "cu"
+lea L134, L336
+L220: .data -695, 36, -823, 571, 776, 813, 776, -990
+L221: .data -678, -799, -560, -184, 616, -605, 497, 607
+L222: .data 819, 505, 181, 398, -522, -842
+red r1
+; comment
+L223: .data 963, 178, -92
+add r2, r6
+L224: .data -36, -542
+L225: rts
+L226: .string "sufiq"
+L227: .data 990
+L228: .string "gd"
+L229: .data 299, -327, -326, -203, 123
+dec *r2
+L230: .string "daimygqqdvbj"
+L231: .string "iuslppeieuqpl"
+L232: .data 165, 762
+L233: .string "teleckrgrgykviyurb"
+L234: .data -539, -952, -193, -718
+L235: .data 829, 593, 552, -929, -252, -789, 720, -285
+L236: .data -934, -885, 382, -997, -77, -826
+L237: .data -239, 312, -612, -478, -378
+L238: .string "jiwvspqwjwlzebckavofa"
+L239: .data -305
+L240: .data 855, 552, -745, -229, 477, -989
+stop
+L241: .data -444, 476, -867, 390, 417, -13
+bne L327
+L242: .data -427, 71, -717
+L243: .data 74, -289, 708, 193
+prn *r3
+L244: .string "oatbvwwyj"
+L245: .data -762, -669, -345, 775, 928, 917
+L246: .string "mdffhrejxxxkhixpstk"
+clr r6
+L247: .data -51, 557, 25, 602, 114, -756, -546, -549
+sub #152, *r7
+L248: .data -695, 49, -193, 553, -967
+not *r1
+
+jmp *r3
+L249: .data 422, -560
+L250: .string "rucuxbegzcioicijwfmy"
+L251: .data -269, 566, -157, 883, 206, -249, 59
+L252: .data 473, -802, 115, 890, -428, -742
+L253: .string "vupscqguwiqaujnuhsdlbw"
+
+not *r2
+L254: add L334, *r1
+jmp *r3
+L255: .string "ftvuzvrp"
+L256: .string "xcibdrtsccsnlxbwdf"
+lea L142, L285
+L257: .string "cdonasbydh"
+L258: .string "rkczparguqdmq"
+L259: .string "nfydqqvdngydttfovayglyck"
+L260: .data 249, -538, 584, -772
+L261: .data -412, 414, 356
+inc *r1
+red *r2
+; comment
+L262: .string "shn"
+sub #140, *r2
+L263: .data -79
+L264: .data -636, 584, -606, -924, -456, -581, -382
+L265: .data 425
+L266: .string "pqbpajdc"
+L267: .string "icwljwebkpqrvljixlnli"
+L268: .data 131, -415, 830
+L269: .data 312, 637, -881, 710, 648, -55, -654, -312
+L270: .string "fwhtaapvccttvublsh"
+L271: .data -328, 165, 312, 998, 381, -301
+L272: .data -980, 24
+L273: jsr *r0
+L274: .string "ggrnharvrafrrvbwybjq"
+L275: .data -576
+sub r3, *r2
+red *r0
+L276: .data -544, -758, 473, -767, -796, -548
+L277: .data -605, -310
+L278: .data -234, 386, 409, 656
+L279: dec *r3
+
+L280: .string "wcfuusolthynaaq"
+L281: .data -370, -535
+mov *r5, *r7
+L282: jmp L95
+L283: .data 756, 377, 95, -837
+L284: .string "zdysrukjxhmjdpovvvo"
+L285: .string "qzorwtseklki"
+L286: .string "qnclkkbadykh"
+L287: .string "lypbk"
+dec *r0
+L288: .string "wuuyyufeoouej"
+L289: .data 704, 728, -587, -4, 342, -513, 682
+not *r2
+L290: .data 745, -146, 339, 529
+L291: .string "hqny"
+L292: .string "wamzorwtvhxr"
+L293: dec *r1
+sub L339, *r5
+clr *r6
+L294: .data 170
+rts
+inc r0
+L295: .data -478, -69, -598, -12, -44, -576
+L296: .string "uanzkvawu"
+L297: .data -596, -844
+L298: .string "wswuqevpllsqsaxsefh"
+L299: .data -572, 864, 973, 452, 97, 919
+L300: .data -712, 722, -609
+L301: .data 816, 603, 227, 237
+L302: not L140
+jmp *r7
+stop
+rts
+L303: .string "xipiihvmlyqehckqh"
+L304: .data 143
+L305: .string "pwsoa"
+jsr L26
+L306: add L221, r0
+jmp *r1
+L307: .string "wivymyncuih"
+L308: .string "dovmubov"
+L309: .string "mibkfukeh"
+L310: cmp L24, L69
+mov #-109, *r5
+L311: .data -748, 11, -81, -49, -459, 363
+bne *r1
+L312: dec r1
+L313: .string "mxojczsohjjbq"
+L314: .data -861, 292, -367, -213
+L315: .data 537, -840, 21, 68
+L316: .string "fybelk"
+L317: .data 779, -862, -44, 451, 516, 68, 951, -796
+L318: .string "xeipbfbrzlcuwein"
+L319: .data -747, 847, 227
+L320: .data -557
+not r3
+; comment
+L321: .string "muhjknobmkxdjgfzicb"
+L322: .string "d"
+bne *r7
+clr L330
+L323: .data 974
+L324: .data -535, 130, 329, -374, -77, -256, 356
+L325: .string "wqqebbuhkvkxxpa"
+L326: mov #-26, r4
+L327: .string "rfivm"
+inc *r3
+dec r1
+L328: .string "yeynseysslv"
+L329: .string "ibedjqkjtqsgkngtwggbyzp"
+L330: .data -255, 304, 160, -509, 593
+L331: rts
+sub r0, L318
+L332: .string "yjvvzc"
+prn r1
+L333: .string "smgkgwegxligrkgtwn"
+inc r4
+L334: .string "bukkvnnnoj"
+lea L338, L88
+red *r6
+L335: .data -970, 114, 249, -514, -578, 789
+L336: .string "gwrogehc"
+L337: .string "ttlbjidavqlthntaanohqbv"
+bne L339
+L338: .data -318, 828, -789, 884, 747, 503
+L339: .string "ezijcpanpajlnsediecfte"
+stop
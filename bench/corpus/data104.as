@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 105
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .data 38
+not *r3
+L1: .data 48, 860, 911, -8, -672
+mov r3, *r4
+L2: .string "uv"
+L3: .string "mdrzxkszykakrqejqqlymrv"
+L4: .data -181, 803
+L5: .data 423, 460, -393, -873, 302, 278, -313
+jmp *r2
+L6: .string "vfbwertsn"
+L7: .data -546, 347, -678, -767, 949
+mov r6, *r6
+L8: .data 620
+L9: .string "sbypwsvit"
+L10: .data 320, 820, 793, -407, -537, 216, 279
+add L10, r3
+jmp *r5
+L11: .string "hihharlcxixwjtooylw"
+L12: .string "trlmugowvfiutemrhwfzv"
+sub r7, L274
+L13: .data -866, 189, -29, -585, 528, -940, -985
+L14: .data 982, 852, -808, -791, 602, -994, -248
+L15: .data -483, -404
+red L2
+stop
+L16: .string "ktsc"
+L17: .string "j"
+sub #137, L172
+L18: .string "cqdwxidhm"
+
+L19: .data 275, -581
+L20: .data 929, 247, -697, -770, 453, -718
+L21: .data 478, 211, -877
+L22: lea L17, r3
+
+L23: .data -450, 504, 602, -578, -23, -878, -443
+L24: dec r2
+L25: lea L3, L229
+L26: .data -768, 381
+dec *r4
+sub #-153, *r2
+L27: .data 108, -705, 845, -363, 154, -337
+L28: .data -60, 264, -341, 605, 980
+L29: .data 532, -310
+L30: .string "oxllyndyzjfml"
+stop
+stop
+L31: .string "azvhau"
+; comment
+L32: .string "wtthcmxlobgqv"
+L33: .data 628, 887, -862
+L34: .string "sglmy"
+L35: .string "bz"
+red L101
+L36: dec L188
+L37: .data -634, 680, 342, -50, -789, -173, -896, -157
+L38: rts
+L39: .data 564, -390, 807, 146, 545, 239
+L40: .data -682, -887, 871, -853, 119, -183, -970, 839
+red L154
+dec r4
+; comment
+red *r6
+; comment
+red *r1
+not r2
+L41: .string "tbqxxsckwhtcbkenbyh"
+L42: .string "pevipglszlnkvqc"
+inc r4
+L43: .string "ziy"
+L44: .data 254, -502, -429, -746, 265, 755, -671, 393
+dec *r2
+cmp *r6, r3
+L45: .string "boqqyejrjqcwhzlntdmozc"
+lea L35, *r5
+bne *r6
+L46: .string "inermrxpanjsaiebe"
+L47: .string "miicm"
+L48: .string "wqazjfvumhcaridtt"
+L49: dec L157
+L50: .data -430, -502, 880, 891, -754, -276, -554, 292
+L51: .data -400, -19, 94, -543, -191, 168, 295, 117
+L52: .string "gxoza"
+inc L99
+L53: bne L93
+cmp L222, L202
+; comment
+mov #-47, *r4
+red r4
+L54: .string "nhifoinrj"
+L55: .data 980, 594, -966, -886
+L56: .string "o"
+mov *r7, *r4
+mov *r6, r6
+jsr *r7
+L57: prn *r3
+rts
+L58: .data -631, -263
+add L28, *r3
+L59: .string "tqbgwncgp"
+L60: clr L66
+L61: .string "cvuxqfblovpwgszrhsaahh"
+
+sub *r3, *r1
+clr r4
+L62: jmp L261
+inc L30
+L63: .data -332
+L64: dec r3
+L65: .data 272, -173, 632, 684, 938, -608
+L66: .data -997, -846, -922, -987, 165, -856, -41
+L67: .string "tlrvtsaqhfpwyqmbvdbcuxna"
+L68: .string "mjtwojqlamjfvvblnlvph"
+L69: dec *r1
+cmp L317, #-253
+rts
+dec *r0
+inc r1
+L70: clr *r6
+; comment
+mov *r4, *r7
+L71: .string "ppjama"
+L72: .string "powlnjkwjpbjyns"
+jsr *r2
+stop
+; comment
+L73: .string "vvhloyibt"
+
+inc L125
+L74: .data 769, 91, 561, -405, -368, 906, -852, -252
+sub #118, r1
+L75: .string "ihflcjctm"
+L76: .data 279, -14, 447, 153, 889, 15, 190
+L77: .data -379, -66, 17, 764, -630, -408
+L78: .string "w"
+L79: .string "tqgkxqsoyzfvxibpwnqeupde"
+L80: .data 416, 670, -989, -755, 113, -477, 842, 390
+L81: .string "avpromrnn"
+L82: .data 955, -73, -268, -968, 281
+prn r7
+L83: .data -80, 465, -20, -346
+; comment
+L84: .data 768, 207, -649, 732, -847
+L85: .string "yaxcwuq"
+L86: .string "jlxgnlbhfjgarvkijwh"
+L87: .data -111, -915, -996, 662, 858, 235, -808, -256
+not r2
+bne *r2
+dec r0
+L88: .string "xnhcftshwpayvkltosers"
+not *r2
+L89: .data 853, -136, 203, 253
+L90: .string "brtyxvluiecikpnhtheadg"
+red *r0
+L91: .data 380, 162, 114, -245, 743, 526, 329, -255
+L92: .data -256
+L93: .string "xpweaakneqycamhvlplfmjrm"
+L94: .data 326, -927, 682, -861, -137
+not *r6
+L95: .string "tcykrwiwyg"
+L96: .string "wfieao"
+L97: .data -178, 53, -213, 716, -62, 85
+L98: .string "myfeubaroo"
+clr *r1
+sub r1, *r6
+L99: .string "logitbiacihedlipa"
+L100: .data -19, -292, -233, 651, 261, 124, 310, 669
+rts
+cmp L57, r0
+dec L15
+L101: .string "lwgw"
+L102: .data 143, -527
+L103: .string "eqtftgtwzymaumi"
+L104: .data -131, 2, -842, 852
+L105: .data -645, -976, -658
+L106: .data -38, 903
+L107: .string "le"
+L108: .data -879, -689, 578, 357, -215
+L109: .string "qlpsqywjc"
+L110: .string "avcrddsrloavr"
+L111: .string "barqpcnltimx"
+rts
+L112: .string "akb"
+L113: .string "aohpinqyxqcpgrfp"
+prn r1
+cmp #-40, #-243
+L114: .string "ihzvbirzimpmwi"
+not r4
+L115: .string "xewwibhia"
+; comment
+L116: .string "dutvxblopxwplm"
+L117: .data -422, -704, 858, 20, 466, 894, -922, 285
+clr r7
+red *r6
+L118: bne L276
+prn L210
+bne *r3
+L119: .string "lfwwjszjo"
+L120: .data 658, 945
+L121: .string "qzfcpucpfleyon"
+rts
+L122: .data 685
+L123: lea L290, L93
+L124: clr L249
+stop
+prn #-149
+L125: rts
+
+red *r3
+bne *r3
+L126: .string "nmawfuabxsr"
+stop
+L127: .string "yxbfxiuteaikhsrnkh"
+L128: .string "fmvugaphbtjtl"
+not L93
+lea L73, r1
+not r0
+mov L32, r1
+jmp L179
+jmp L292
+L129: .data -11, -816, -836, -237, 449, 87, -394, -990
+L130: .string "tehxdqitwn"
+L131: red r5
+L132: .data 741, -873, 834, -272
+L133: .string "vcmgdlorlkgsqgafqnwzl"
+L134: .data -478, 620, 91, -174, 847, -859, -498
+not L43
+rts
+L135: .data 50, -578
+L136: .data -29, -377, -486, -541
+L137: .data 453, -771, 658
+L138: .string "jvqlikkgdy"
+L139: .data 133, -39, -698, -374, -623, 117
+L140: .data -519
+L141: .string "flzmyaoezqreh"
+L142: .string "puahzfanbxosgopabafq"
+L143: .data 886, -453, -494, 3, 207, 561, 469
+clr r6
+L144: rts
+stop
+L145: .data 54, -855, 332
+mov *r7, *r4
+L146: .string "glpyofh"
+
+L147: .data 912, 402, -80, 955, -694
+not r4
+L148: .data -733, -766, -13, 339, 537, -589, 213, 389
+lea L216, *r4
+L149: .string "hwhfncenxhzpllzjdbmf"
+L150: clr *r4
+red r3
+L151: .data -456, 31, -105, 410, -210, -683, -11, 170
+L152: .string "oxxxoiog"
+L153: .string "oclbbsarpcdwpxfdxyhj"
+
+L154: .data 462, 599, 443, 338, -35, 512, 740, 0
+L155: .data 649, -83, 821, -504, -443, -145, 627
+L156: .string "nkj"
+L157: .string "rgloscimzxjgvlkd"
+not L281
+L158: .data 745, 453, 540, -499, 318, -632
+L159: .data -84, 490, -585, -609, 134, -194
+L160: .data -852
+; comment
+jsr L45
+L161: .data 987, -507, 767, 356, -632
+L162: .data 1, 859
+L163: .data 229, -491, -736, 210, 865, -216, 597, -472
+L164: .string "jqdbw"
+L165: rts
+L166: .string "jjzxxqpyokkdaahftbeg"
+
+bne *r3
+L167: .data 650, 28, 366, 655, 826
+L168: .data -527, 575, 855
+cmp L157, L180
+L169: .string "kweghedjtgsz"
+L170: .string "tptkurnn"
+inc r0
+lea L119, L119
+L171: .string "ewcdiczcuptinc"
+L172: .string "qcefh"
+
+L173: .string "hplriaaxbiwbyktvuvmvsgzc"
+L174: cmp #-188, *r2
+L175: .string "zztmczdsheiby"
+L176: .data 972, 715
+jsr *r0
+
+L177: .data -634, 892
+L178: .data 314, -283, -552, -214, 904, -856
+L179: .string "sjwjpklqrrtzrzpv"
+L180: .string "ccwrwjeuoelarytqinjhr"
+L181: .string "blkyqjw"
+L182: .data 730, 835, -551, 618, 818, 788, -95
+stop
+add *r0, r4
+L183: .data -586, 510, -32, -379, -376, -400, -493
+L184: .data -13, 43, 721, 341, -201, -69
+L185: .data -789, 189, -91, 175
+L186: .data 353
+L187: .string "dyhmdqzsplohocpkmcfije"
+L188: .data -826, 522
+L189: .string "hlulum"
+L190: .string "poeia"
+add #-233, L38
+jmp *r6
+L191: .string "psujxmlvwixyfp"
+L192: .data 237, 383, -6, -580, -864
+L193: .string "lehvqndxuqtx"
+L194: .data -414, 494, -882, -201
+cmp #-96, *r4
+L195: .data -301, 29, 934, 618, 243, 355, -693
+L196: .data 312, 908
+cmp L133, L312
+L197: .string "oka"
+L198: .string "ivnxxzhzqkpkhnogv"
+L199: bne L115
+L200: .string "xf"
+L201: .string "ytutapxitnirskvjnykgzy"
+L202: .string "evhgczwspucxn"
+L203: .data -843, -305
+L204: .string "wzpzrshz"
+L205: .string "skwfnoydikdakmgtjy"
+L206: .data -120, -856, 883, -237, 576, 698
+L207: .data -488, -125, 253
+L208: .data -721, -182, -512, -806
+L209: .string "scodecbyreca"
+sub L300, r5
+
+L210: .string "vdalksgkkumitbwkjkxefut"
+
+L211: .string "mbrmgedlyy"
+L212: red L27
+sub #202, *r7
+L213: .data -691, 539, -844, -784
+L214: not L279
+L215: .data 172, -883, 475, -348, -389, 564
+L216: .data -892, 976
+L217: .string "pwuiomipatzhzr"
+L218: .string "cmzaopktt"
+bne *r1
+
+L219: .data 683
+L220: .data -911
+L221: .data 232, -44, -79, -945, 306
+L222: .data -407, 353
+L223: .data 746
+
+bne L116
+L224: cmp L307, #24
+jmp L30
+rts
+L225: .string "lgsopfcmtkmtcdjcgakmxjx"
+L226: .data 95, 771, 626, 283, 632, 777, 881, -260
+L227: .string "gqkbtc"
+mov L316, r2
+stop
+add *r6, *r1
+L228: .string "wnczvwivjomoewwaiqxnhuc"
+add #-4, L275
+L229: .data -658, -225, -365, -455
+sub L266, *r4
+L230: jmp *r0
+inc *r6
+L231: .string "hvevrw"
+L232: .data 351
+L233: .data -968, 344, 461, 839, -676
+dec r5
+rts
+prn #-43
+L234: .data -111, 523, -697, 570, -106, -533, 770
+prn r1
+rts
+L235: .string "rjbahipmdusluvx"
+L236: .data 936, 584, -833, 530, -532, 134
+L237: .data 877, -546, -97, 125, -67
+add L318, *r0
+add *r6, r0
+L238: .data -524, -186, -763, 988
+L239: .string "pjrhhadtuitpxby"
+L240: .data 18
+mov L318, r1
+L241: .data -775, 173, 171, -384, 595, -730, 582, -923
+L242: .data 424, -628, 718, 228, 337, 736, 919, 963
+L243: dec L271
+L244: .data -214
+L245: dec L244
+L246: .string "vmixo"
+inc r3
+L247: .string "pvppakslxxfzzjn"
+L248: .data -775, -897, 905
+; comment
+jsr L6
+L249: sub #215, *r1
+L250: .string "turplnp"
+L251: .data -792, -682, 64, -23, 4, 120
+L252: .string "eosvyaholhuzzrxqzki"
+L253: .data 199, -650
+L254: .data -663
+clr *r4
+L255: .string "wesaxu"
+mov #-223, L34
+L256: sub #-221, r5
+L257: .data 188, -129, 197, 451, -209
+prn L155
+lea L229, *r4
+L258: .string "smgobwnudfpvtmuccjqqnx"
+inc *r5
+L259: .string "lxynevubclsgyxmahfs"
+jsr L301
+L260: .string "jfvbqydfyhmy"
+L261: .data 358, -794, -607, -625
+L262: .string "uykxisny"
+L263: .string "dhvwfcndtjhy"
+L264: .data 725, -427, -812, 879, 52, -973
+inc *r7
+L265: cmp r0, #-161
+L266: .string "fnenvyheaclzfbmzlwobw"
+L267: .data 620, 318, -317, -697, 393, -593, 815
+L268: sub L310, L290
+L269: .string "kxqtvrejaduxhiv"
+mov r1, L107
+L270: .data 662, -170, -446
+L271: dec *r3
+L272: .string "inhnjydnwfqrk"
+red r6
+L273: .data 704, -760, -355, 749
+cmp *r7, #-152
+sub #26, L293
+L274: lea L6, r5
+L275: red *r1
+L276: .string "z"
+L277: .string "ohyjjjngutagpsbhy"
+jsr *r4
+L278: .data 549, 492
+L279: .string "mjoysbua"
+L280: bne L237
+L281: red r1
+rts
+L282: .string "vtrpzrtrg"
+L283: .data -113, 552, 375, -281, -162, -955, -547
+add r0, *r3
+rts
+L284: .string "ilwotyu"
+add r1, *r0
+add L30, r7
+red L288
+cmp r6, r0
+L285: .data -364, -729, 470, 420
+clr *r3
+jsr L305
+sub L191, r7
+L286: .data -256, -559
+L287: .string "ypmoeqlybpwgjualjrmr"
+L288: .data 982, 516, -861, 324
+prn #153
+L289: .data 304, -611, 728, -610
+L290: .string "bk"
+L291: .data 913, -99
+L292: .string "ufmwqmd"
+L293: .data -113, 520, 253
+L294: prn r2
+L295: .string "hoghsbnlewhdhcbfc"
+jmp L37
+L296: .data 640, -25, -219, -141
+
+L297: .data -519, 82, -434, -675
+L298: add #-144, L123
+L299: .data -244
+dec r0
+L300: .data 992, -241, -957, -541, 971, -205, 727, 840
+L301: .data -97, 632, -556
+L302: .string "wsrcflslm"
+L303: .data 117, 270
+L304: .string "jpgnauwsosytknnwwhnjzn"
+dec L285
+L305: .string "ldgfthdtovd"
+L306: .string "uycnfnuneivsguwiovby"
+L307: .string "vudcoyqeyeyqehpxr"
+jmp L176
+L308: .string "fntkxnkiuxksrkpqad"
+L309: .string "qtdfzhxpcuagjb"
+L310: .string "iipqzwiqbnaev"
+inc L84
+L311: not *r5
+L312: .string "hdnoroxoavkddumkwuvytqk"
+jsr L318
+L313: .string "zympfszvcfrtjbzqaex"
+L314: .data -241, -911, 678, -357, 0
+L315: .string "gxkuhuwtyzibboydzgwrppu"
+lea L123, *r0
+L316: .string "rdnbryvyppoovepehse"
+dec r1
+L317: .string "iziptvbfrxrpmxipbo"
+sub #-110, r5
+cmp *r2, #247
+L318: .string "wyjkcofuxubkapps"
+L319: .data 977, 548, -151, -1, 413, 761
+L320: .string "pyeiqseoiwdcemhblulcxc"
+stop
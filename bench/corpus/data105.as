@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 106
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+; comment
+L0: .data 924, 612
+L1: .data -869
+L2: .data -417, 288, -652
+L3: .string "mqtsausvsrunlrjtrts"
+clr *r5
+jmp *r4
+L4: .data -349, 137, -4, -329, 296
+L5: .string "ljfsuvyw"
+L6: .string "ovasrwcug"
+L7: jsr *r5
+L8: stop
+dec *r4
+L9: jsr L77
+L10: .data -47, -35, 185
+L11: .data 690, -832, -805
+jsr *r7
+stop
+L12: .string "qfd"
+L13: .data 820, 874, -337, -61, 311, 336, -433
+L14: .data -267, 10
+L15: .data 373, 921, -864, 133, -423, -588, 695, 443
+clr *r0
+rts
+sub #-86, L1
+inc L246
+L16: .string "hdlgfwxjh"
+L17: .string "emo"
+L18: .string "gkdunvhyiohzfzfptd"
+L19: .data 334, 791, -592, -304
+L20: .string "fdfciqzwyco"
+L21: .data 338, 423, -671
+L22: .string "wfvrgogi"
+not *r0
+not r3
+rts
+L23: .data 497, 560
+L24: .data 429, 469, 984, -646
+L25: .data 44, -5
+L26: .data 819, -714, 225
+L27: .data -645, -341, -29, 514, 26
+inc r1
+L28: .string "wfooqxbnihyqpeczwzyits"
+L29: .data -992, -601, -839
+red *r7
+L30: .data -707
+L31: .data -706, -701, 158, -27, 790, 267, 979
+clr *r5
+L32: .data 852, 682, 115, 750, -422, 30, -844, -820
+L33: .string "lcwjfxzrnds"
+mov r4, L23
+L34: .string "sigh"
+L35: not r5
+L36: .data -675, -46, 751, -906
+L37: jsr *r5
+L38: red r7
+red *r3
+L39: .string "iizbuwlp"
+cmp L127, r7
+not L165
+L40: .data -502, -119
+not r7
+L41: .data 582, -638, -107, -820, -691
+sub *r2, L123
+L42: .string "lmmcwwg"
+L43: .string "diei"
+L44: .data 704
+L45: .string "umzilhzlpfgwkzas"
+L46: .data 928, 142, 696, -223, 813, 411, 392
+
+L47: inc *r6
+bne L265
+L48: .data -732
+not r5
+L49: .string "lrgaubup"
+L50: .data 599, -938, -596, 901, 35
+dec L183
+lea L123, L50
+red r0
+cmp #-58, r3
+L51: .data -170, -903, -722, 736
+L52: .string "iwflhieqxzdoltqsyernqwn"
+L53: .string "afmzbfaxmvudchuavrrof"
+L54: .data 914, 376, 342, 31, -621, 509, 344, -799
+L55: .string "tanzrugrcgjhzbax"
+L56: .data 997, 49, -822, 966
+L57: stop
+L58: .string "uhwi"
+L59: .data 497
+L60: .data -546
+L61: .data 206
+L62: .data -565, -2
+jmp L246
+jmp *r5
+L63: .string "cqlzivoljizvseadddg"
+
+L64: .string "ieajxcqgdq"
+jmp *r4
+L65: .data -68, -938, 875, -560, 657, -396, -914, 591
+L66: .data 487, -82
+L67: .data -278, 778
+not r1
+L68: .string "ebaygcof"
+stop
+L69: .data -834
+; comment
+L70: .string "jggslxqtzyxvnbjtd"
+not r1
+L71: .string "cdzeuxvwgdon"
+L72: .string "bhpltjdehx"
+L73: .data -569, 57, -572, -823, -474, 323, 718, 831
+; comment
+L74: .string "bcc"
+L75: prn L274
+
+add r2, r2
+L76: jsr L214
+L77: .string "clecqbpdsjeggxpciazbhuk"
+L78: bne *r7
+L79: .data -689, -628, -791, -120, -298, -351, 920
+; comment
+L80: .string "ivlzt"
+L81: .string "xyscjdjacgmuqqeo"
+L82: .data -659, -838, 435
+L83: .data 421, 505, 277
+; comment
+stop
+; comment
+L84: .string "dz"
+L85: .string "pqzzksmfqmrmzmmveyuqzdq"
+lea L194, *r2
+lea L64, r5
+not *r4
+L86: .data 519, 210, 102, -514, -337, -6, 78, 260
+dec r0
+L87: .data 516, 896
+inc *r4
+bne *r7
+L88: .string "cdcdkgyeyq"
+clr L141
+L89: .data -642, -632, -865, 517, -471, 201, -870, -283
+L90: lea L5, r7
+L91: .string "hlvfljixo"
+
+L92: sub *r2, L298
+L93: .data 362, 602, 968, 252, 897, 364, 387, -130
+L94: mov L208, r5
+jmp *r1
+L95: .string "mpmhsujsnvock"
+lea L77, *r1
+L96: .string "eomngtnnagjkoky"
+
+prn r7
+L97: .data 337, 121, 718, 541, -462, -674, 628, 483
+L98: cmp L192, *r6
+L99: .string "qajafpovsrbs"
+L100: .string "zzrwzmowqqbmnfssorkxefw"
+mov #-165, r4
+clr L264
+lea L10, r5
+L101: .string "apsebbdrztpzhphppcjedv"
+L102: .data 406, -554, 721, -798, -501, 834, -405, 736
+L103: .data -575, 703, 281, 129
+stop
+L104: .string "zagvlacecmfifkadugfsxyr"
+L105: .string "dfpxj"
+jmp L7
+cmp *r6, r7
+cmp r0, #120
+L106: .data -972
+L107: .string "z"
+L108: .data -526, -747, -759, -1000, 479, 207, 520
+L109: .data -313, 343, -239, -896
+L110: .data -927, 998, 982, -586, 224, 518, 529, -838
+L111: .string "cwolqryuquwoponfepbohwn"
+L112: .string "mwrzgclzanrvhnmvtcptgxyg"
+L113: .data -488
+jmp L246
+L114: .data 375, -467, 747
+L115: .data 193, -247, -93
+red *r1
+jmp *r2
+red *r1
+L116: jmp *r4
+jmp L93
+L117: .string "wwewpnnknbjz"
+L118: .data 655, -960, 544, 181, -667, 979, -594, -817
+L119: .data -557, 904, 714, -333
+L120: .data -426, 476
+clr r7
+
+L121: .string "lgoxwlkqcusutn"
+L122: lea L7, L177
+L123: .string "j"
+L124: .data 237, -819, 244, 805, 897, -755
+L125: .data 442, -312, -745, -285, -856, -259, 128, -207
+L126: .data 897, 946, 785, -658, 444, 625, 748, 87
+L127: .data -118, 529, -127, 238, 198, 848
+L128: .string "uuzzgjpvjtsihb"
+jsr *r3
+L129: .string "tqggglocwrnxuoc"
+stop
+L130: .string "wqhteimrpzzzgksd"
+L131: .data 657
+L132: .string "iqwqfbeza"
+L133: .string "kyjpuintwzmxtceh"
+red *r4
+L134: .data 766, -387, -864
+L135: .data 778, 884, 456, 105, 375
+L136: .string "axscluyrrdvakhjacih"
+L137: .string "ryjiruueh"
+L138: .data 855, 632, -34, 640, -816, -744, -697, 216
+L139: .data 199, -992, 951, -874, -465, 791, 738
+L140: .string "cd"
+add r5, r4
+L141: jsr L124
+jmp *r0
+jmp L240
+L142: .data 776, -564, 265, -311, -319, -194, 291, -110
+L143: stop
+clr r7
+L144: .data -525, 737, 885
+prn *r7
+jmp *r0
+L145: .string "qtwkhy"
+not *r4
+L146: .string "qnt"
+mov r0, *r7
+L147: .data -731, -131, 798, 41, -552
+L148: .string "y"
+prn #10
+L149: .data 999, -558, -96, -104, 330, -759, 490
+L150: .string "nxfhwgolqv"
+L151: .data 962, -995, -7, 917, 357, 903
+L152: .data -834, -172, 447, 314, 416
+L153: .string "iuqqdhpvwsmcpgfilc"
+L154: add L92, *r1
+L155: .data 896, 617, 617, 356, -211, -249, 700
+jsr *r5
+L156: .data -958, 635, 177, 553, 887
+L157: .data -434, -397, 778, -11, 352, 425, 346
+cmp #-74, L47
+L158: .string "cpsskgombxrbaepbxkm"
+L159: .string "lclykztmnumpm"
+L160: .string "gdncscrmtf"
+sub r3, r7
+stop
+L161: .string "inqsthgcsranfsmmyz"
+L162: .string "ptvsieuyuyrdxv"
+L163: .data -600
+cmp r6, #46
+clr r0
+add *r2, r1
+L164: .data -921, -146, 774
+
+prn *r1
+red *r7
+inc r6
+; comment
+L165: .data -671, -807, 728, 727, 614, -564, -138
+add L234, *r0
+L166: .data -760
+prn *r0
+inc r4
+L167: .data -912, -686
+L168: .data -728, 693, 978
+L169: .data -177, 854, 609, 24, 641, -788
+L170: .string "kjogcrkynaezlqsigkdsedan"
+L171: .data 560, -534, 957, -799, -280
+L172: .data -409, -504, -14, 959, -425
+L173: .string "ccmrl"
+dec *r0
+L174: .data -529, -365, -285, 763, 160
+L175: .string "egieejzxytkwacekuodmp"
+not *r6
+L176: .data 418, -382, 200
+L177: .data -225, 616, -23
+; comment
+dec L200
+L178: .string "bkwnvkfgsfurclyeyybyi"
+prn r1
+L179: cmp r1, r7
+; comment
+L180: .string "eepczaghtrqcfomtncr"
+L181: .data -240
+
+L182: .string "pfkuddbhmy"
+L183: red L250
+L184: .string "uicrbbhcekkpbmtndmnp"
+inc *r5
+L185: .data -50, 628, -504, 135, -216
+jmp *r2
+not L222
+L186: .data 629, -584, -315, -685
+L187: .data -297, -299, 9, -754, 315, 787, 16
+L188: .string "dwbejmkejpxguogvd"
+L189: .string "qkzjhiuskspbrbxjf"
+cmp #-93, r1
+sub r3, r6
+cmp r4, *r0
+L190: .string "dayfdhsfiqapkzlx"
+L191: .data -36, -65, 575, -124, 310, -711, 937, 492
+L192: .string "sdkdyiz"
+cmp r6, r4
+L193: .data 214, 242, -731, -388, -981, 490, -1000, -474
+L194: rts
+L195: .data -547, -482, 876, 982, 847
+L196: .data 130, 821, 997, 650, 993
+add #78, L72
+rts
+dec *r0
+prn L43
+L197: .string "cg"
+L198: .string "ba"
+stop
+L199: .string "rxumjgoipvwoqpg"
+L200: .data -121, -603, 171, 443, 344
+; comment
+L201: .string "xo"
+L202: .data -676, 272, 428, -423
+jmp L233
+
+L203: .data 292, -95, -530, 221, -131
+cmp r5, r5
+L204: .string "rahgypafb"
+L205: .string "ejkdfufngup"
+L206: .string "sckicgsbysguewjijcbme"
+stop
+lea L262, r4
+mov *r3, *r7
+L207: .data 199, -642, -699
+clr *r6
+L208: .string "izpa"
+L209: .data -339, 583, 544, 795, -293
+red L40
+L210: .data 601, -892, 283, 494
+dec r6
+L211: .data 327, 462, -944, -276, 248, 572
+mov *r6, L207
+L212: .data 460, -408
+; comment
+L213: .data 414, 569
+L214: .string "snafuyl"
+L215: jmp L33
+L216: .data 28, 4, 510, -551
+L217: .data -910, -227, -140
+L218: stop
+L219: .string "vypwphwyunxy"
+L220: .string "goujycwyh"
+lea L251, r0
+L221: .string "hjw"
+L222: .string "crbovvjasambgnwbcvootd"
+; comment
+L223: .data -786, -555, 939, 501, -986, 571, -735, -299
+red r4
+L224: .string "ur"
+L225: .data 983, 686
+L226: .data 37, 89, -156, -949, -972, -881
+L227: .data 197
+L228: .string "hzqeujwwmasbeev"
+jsr L18
+L229: .string "vlchgzx"
+prn #-238
+L230: .data 979, -788, -965, 62, 601, 783, -449, -662
+L231: .string "uoafodimfhnqjavichgty"
+L232: .data -157
+L233: .string "e"
+L234: .string "ybpmyqfvghyqnmoyxj"
+jsr L65
+add r4, r1
+L235: not *r1
+L236: .string "ksybqomqvcfqmjouwya"
+dec *r5
+L237: red r0
+L238: .data 248
+L239: .data -25, -640, 135, 111, 303, -655, -579
+L240: .string "xuomo"
+L241: .string "fplepypz"
+mov r0, L218
+L242: .data 309, -785, -96, 411
+L243: .string "wbiwvcps"
+stop
+jsr L256
+L244: .data 771, 325, -303, -794, -246, 943, -447
+not r5
+L245: .data 76, 566, 26, 309, -309, -950
+L246: .string "uevpkwgquhqlckfikz"
+L247: .data 718, -819, 230, -133, -803, 916, 358
+clr *r7
+L248: .data -53, 494, 9
+L249: .string "qigaqdamnvjfvxclp"
+dec *r4
+L250: .string "msfw"
+dec L168
+L251: .data 975, 470, 612
+L252: .data 943
+L253: .string "lycu"
+
+L254: .data 998, -325, -625, 200, -90, -57, -678
+sub L41, r4
+L255: .data -58, -617, 340
+L256: .string "esqnqlufevzemdydjlpjbyj"
+L257: .data 420, -794, -149, 551, 269
+
+jmp L106
+jsr L16
+lea L288, *r7
+jsr L312
+L258: .string "hyrkkhhjdwmtjxordhxaswu"
+lea L266, L14
+prn *r3
+L259: .data -299, -701
+bne *r0
+L260: .string "sxfehcvhtdqgiomjzvqbuhrx"
+L261: .data -192, 647
+stop
+bne L279
+L262: .string "enxrkzwrqaqanhuuqhy"
+L263: .data -206, -670, -58, -978, 645, -593
+L264: .string "dgljkachntcqeg"
+L265: .data 226, 879, 281, -128, 163
+
+L266: .string "zaklfuqvokem"
+L267: .string "vvjwuiglmignwblz"
+stop
+L268: .string "uysekojthseqqba"
+L269: .data 230, -486, 220
+L270: .data 953
+L271: .string "firhfveklbumn"
+L272: .string "pazqcvb"
+L273: stop
+L274: add #100, r5
+L275: stop
+L276: .data 839, -800, 966
+L277: .string "imyuzwywglnczgksxcywhuni"
+L278: .string "skeyhdcaroh"
+mov *r0, L235
+L279: .string "id"
+L280: .data -895, -265, 175, 883, -233, 657, -15
+clr *r1
+L281: .data -322, 811
+; comment
+L282: .data 285, 606, 705, -198, 507, 945, -903
+inc r4
+L283: .data -567, -909, 837, -836, -612, 983, -807, 830
+dec *r2
+L284: .string "ixxqlzawotc"
+L285: .data 699, -419, -676
+inc L308
+L286: .string "lrptoevefejyveto"
+prn r5
+L287: .data 701
+L288: .data -171, 60
+L289: .string "dxxpwmnzv"
+clr L293
+L290: .data -437, -492, 920, 659, -377, -440, 738
+L291: .string "mes"
+L292: .data 861, 74, 739, -716, -455, -423
+add *r7, L26
+
+L293: .data 747, 527, -903
+L294: .string "wflzhjfweeqmgfhivi"
+L295: bne L303
+L296: rts
+; comment
+L297: .data -697
+rts
+lea L308, r7
+L298: .data 982, -754
+mov r1, r7
+L299: .string "sriubfcicpcx"
+rts
+stop
+L300: .data 117, -451, 999, 58, 761, 889, -272, -748
+L301: .string "hzqmrxiwxcikbr"
+
+L302: .string "lslfzzxlcywwbbtgk"
+L303: .data 651, 600, 862, -770, 31, -457
+L304: .data -579, -966, 470, -730
+
+L305: .data -70, 110
+L306: .data -961, 398, -124, -517, 288, 69
+L307: .data -251, -785, 490, 460, -95, -790, 546
+add #-108, r0
+L308: not *r2
+dec *r3
+sub L129, L311
+L309: .data 430
+L310: .string "qjit"
+cmp L315, #57
+L311: .string "mpntvk"
+L312: .data -549, 536, 566, -241, 589, 111, -150
+L313: .string "c"
+
+
+L314: .string "qbhbiutkr"
+L315: bne *r6
+; comment
+
+L316: .data -889, -884, -162, 148, 930, 56
+stop
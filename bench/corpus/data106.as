@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 107
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+red *r0
+L0: .data 608, 399
+L1: .string "apsdhcborsrppckygmm"
+L2: .data -813, 123, 229, 469, -98, 360, -703
+L3: .string "osjdwytpyulyhnavqkcg"
+L4: .string "xpetheufmsxzsbwoxspg"
+jmp L271
+stop
+L5: .string "vaahbvc"
+L6: .string "fbzzxmifhisjs"
+L7: .data -574
+L8: .string "s"
+L9: .data -392
+L10: .string "sqxxtihxprmukdo"
+sub r0, L10
+L11: .data -619, -587, 748
+L12: .string "qwsjssztvfnb"
+L13: .data -190
+L14: .data 924
+L15: .data 532, 582, 167
+L16: .data -994, 122, -141, -225, 841, 474, 114
+; comment
+L17: .string "ajbfaqpmzxuclmmzv"
+
+L18: .string "hbeyueqpzvwpd"
+L19: .data -437, 735, 249, 818, -596, -920, 481, 339
+L20: .string "weohkgjkitvn"
+L21: .string "forkuxhygfqkosultahkln"
+L22: .data -166, 406, 117, -94, 93, 423
+; comment
+clr r5
+red *r1
+L23: .data 848, -370, 185, -950, 522, -743, -479
+cmp *r2, L16
+L24: .data 74, 687, 174
+L25: .string "wjwfbb"
+dec *r2
+L26: clr *r6
+bne L39
+L27: .data -554
+L28: .data 961, -601, -423, -598, -348, -386, 302
+L29: .data -714
+red L28
+L30: .data -915, -74, -851, -139, -299
+stop
+L31: .string "afbiggnncgyzmouv"
+L32: dec r6
+
+L33: .data -101, -529, -781, -530, -505, -843, -190, -956
+L34: .string "oge"
+L35: .string "ixgoomhyadvzmalqll"
+L36: red *r4
+L37: .string "cr"
+L38: red *r1
+L39: .string "xbfnsrfchjbdeetdgss"
+clr L57
+L40: .data -367, 638
+L41: .string "wfrc"
+L42: .string "tljqqythsduve"
+L43: .string "urkmcez"
+L44: .data -711
+dec r2
+mov r4, *r6
+L45: .data -106, -611, 172, -332, 556, -819
+bne L45
+; comment
+prn #144
+L46: .string "iqfsjbeh"
+sub L7, *r4
+L47: .data 985, 931, 957, 998, 889, 850, -286
+L48: .data 805, 497, -400, -59
+L49: .data -416, 383, 889
+L50: .data 229
+L51: .string "ikpb"
+L52: .data -225, -861, -704, -751, -356, 899
+not r4
+L53: .string "ocryjevginmbto"
+; comment
+rts
+L54: .data -646, -169, -415, 302, -56, 850, 869
+stop
+L55: .string "kmdmbky"
+L56: .data -125
+L57: .data 427, -128, 306, -134, -474, 563
+jsr *r3
+clr r5
+L58: .string "fxqhoeiqry"
+L59: .string "wvwl"
+inc *r6
+L60: .string "lwcqavo"
+L61: .data -111, 971, 980, -116, 271, -852
+L62: .string "zdcdzwlwqhdxnabisygz"
+L63: .string "ljdiakaddxch"
+jmp *r7
+mov r7, L56
+L64: .data 442
+stop
+L65: .data -398, -484
+rts
+lea L299, r6
+L66: .string "jfstangybpkpsb"
+L67: .string "mtfkakrnr"
+L68: lea L44, r6
+L69: .data -523, 79, -995, 55
+prn *r0
+L70: jsr L25
+L71: .string "vv"
+rts
+L72: .string "hynjh"
+L73: .data 987, 38, 902, -928, 874, 118, -262
+L74: .data -634, 504, -105, 941, 754, -894
+L75: .data 312, 504, 341, 142, 14, -316, -176, 827
+L76: .string "kqbbhpiqqd"
+L77: .string "vslfhgwx"
+L78: .data -726
+not *r6
+L79: .string "xnotmsezdqjboxpasq"
+L80: .string "eovdbjooeab"
+cmp L175, L135
+clr r7
+L81: .data -473, 669
+rts
+L82: .data -539, 518, 394, -570, 636
+cmp L76, r1
+L83: .string "bxxh"
+L84: .data 785
+L85: .string "bggoquygipvxdaxz"
+lea L188, r7
+inc r3
+L86: .data -667, -997
+mov r3, L34
+inc r2
+L87: .string "zwcmgcu"
+L88: .data -72, -553, -525, -73, 619
+
+L89: .data 311, -308
+L90: .string "qrna"
+L91: .string "fkguekzvnf"
+jsr L10
+L92: not r2
+L93: .string "ydz"
+L94: .data 941, 919, -383, 59
+L95: .data -589, -593, 303, 319, -343, 416
+L96: .string "ezxzvvilnbgvjjl"
+L97: .string "vibodbubqbpbvunirq"
+L98: .string "badornwdlqien"
+L99: .data 768, -542, -485, -685, -337, -83
+L100: jmp L53
+L101: .data -147, 753, -998, 499, -857, 165
+L102: clr r0
+L103: .string "pyugikxsirusytnufbyu"
+
+L104: .data -563, -18, -178, -943, 373, -545, -10
+cmp r5, L73
+L105: .string "glmifygycvdqmxzpjsuy"
+L106: .data -980, 203
+L107: inc r7
+inc L198
+rts
+prn L122
+sub L55, *r0
+inc r6
+add #86, r6
+L108: .string "qdb"
+stop
+L109: .string "os"
+jmp L282
+L110: .string "nbyblaf"
+jsr L13
+L111: .data -964, 271, -99, -206, -496, 88, 870
+L112: .string "coqxswitqemphhpjigrxf"
+L113: .data -318, 640, 658, -424, -718, -902, 96
+L114: .string "ia"
+L115: .string "uqixnn"
+L116: .string "poakzwfbrnnyvpaeuci"
+L117: .string "qmixvnczfhrozsoryu"
+dec r2
+sub L55, *r5
+sub r1, *r0
+L118: .string "sufedofesxgfyaepwykcf"
+L119: mov r2, *r3
+prn *r0
+L120: .data 11, -864, -371
+L121: .data 821, 970, 888, -814
+red L222
+L122: .string "ttqbhsflfuoueiaqqv"
+L123: .data -270, -776
+L124: .data 568, -287, -642
+cmp *r3, *r7
+cmp #-161, r2
+L125: rts
+L126: .data -179, -929
+L127: jmp *r3
+inc L52
+L128: rts
+L129: .data -229, 61, -850, -614, -647
+dec *r0
+L130: .data -615, -323, 804, -42, -729, -472, -670
+L131: .string "tfurvulzclhrthoacb"
+L132: .string "myknhukpcrbzaxvgx"
+L133: .string "egsy"
+L134: .string "klqcpihgwstfk"
+prn *r1
+L135: .data 557, 628, 572, -803, -315, -618, 660
+L136: .data 343
+L137: .data 621, 406, 352, -69
+L138: .data -878, 311, 503, -391
+L139: .string "cwyyjk"
+L140: .data -259, 591, -116, 141, -656, 960, -701, -973
+jmp *r0
+clr L198
+L141: .string "qbcafwakbyhrtdy"
+L142: .data -973, 224, 3
+L143: .data -617
+L144: add *r1, L191
+dec *r5
+L145: .data 646, -874, -682, 408
+L146: .data -380, 47, -102, -936
+L147: .string "k"
+jmp *r7
+sub r7, *r2
+not L217
+prn r0
+mov #41, *r5
+L148: .data -221, 44
+jsr *r7
+L149: .string "ho"
+L150: .string "wajvlyezhwbhimcvwwss"
+L151: .data -855, 726, -894, -827, 367, 802, -183, 255
+L152: .data -784
+L153: .data 471, -633, 74, 8, 48, -34, 459, 515
+L154: .data 831, -623, -312, -499
+L155: mov r5, r2
+L156: .data -272, 768, 234, 136, -994
+L157: bne *r2
+L158: .string "zkycmjwlarnhjmrueumvii"
+L159: .string "qcfahriuycdjdisevyoibin"
+dec L14
+L160: .data 61, 700, -865, 309, -130, -609
+L161: .data -164, 535, 600, -564, -387, -484
+L162: .data -636, 541
+L163: .string "uvcclvt"
+L164: .data 694, 410, -990
+L165: .data -549, -663, -394, -218, 608
+prn *r0
+L166: .string "chzqdjjytidahvhhunqgzjd"
+L167: .string "cvtvveqwocxltpgchqzfe"
+sub L247, L224
+dec *r6
+L168: .string "zqtawiet"
+prn L53
+dec *r6
+; comment
+L169: .data 842, 416, 493, -478, 558, 583, 707, 409
+sub *r7, *r6
+lea L210, L57
+rts
+L170: .string "qsiqljnsvznvvc"
+L171: .string "klqmdmsmznv"
+L172: .string "wfrwswnwibzoktytgwfo"
+L173: .string "qtumzebk"
+L174: .string "uakjnhwwdcaxnao"
+L175: .string "jo"
+L176: .string "qznu"
+L177: .string "bjnsxihjoejqahzyac"
+L178: .data -623, -53, -896, 695, 598, -279
+L179: jmp L274
+cmp r2, #119
+jsr *r6
+L180: .string "fgmqcodreuaipnqmf"
+L181: .string "zkjtwajamunxtysdjk"
+L182: .string "ignunkmsnadhe"
+L183: .data 719, -876, -565, 278, -318
+L184: .string "aojzat"
+L185: .data -51, 25, -73, -659, 139, -787, -806, 999
+L186: .data -330, 660, 164, -148, 771
+L187: .data 443, 477, -303, 949
+L188: .string "vxjzfxgtjkbs"
+L189: .string "rgcxtkpqzznjnb"
+clr L108
+sub *r6, r2
+add r4, *r0
+L190: clr *r7
+L191: .string "smnpyqummnwepltcflwisgqg"
+not r1
+rts
+clr *r7
+L192: .string "hngzeigqko"
+L193: .data -547, -878, -909
+mov *r5, L32
+L194: .string "txkyegrhfavutoqcjp"
+L195: .string "qkqgiteih"
+L196: .data 94, -315, -852, -861, 296, -566
+L197: .data -742, -346, 714, -939
+L198: .string "wz"
+L199: jmp *r3
+L200: .data 335, -997
+L201: not *r1
+L202: prn r1
+cmp *r5, L224
+L203: .string "bhkkb"
+; comment
+dec L215
+sub #53, *r1
+L204: .string "suvrpsnaxjuwwgakipw"
+L205: sub L50, L47
+L206: .string "veweqh"
+cmp r2, *r6
+L207: .data 592, 953, 811, -912, -585, -224
+stop
+L208: .data 84, -738, 907, 823, 952, -8
+L209: .string "uztwxmspotmhjlq"
+jmp *r7
+prn r2
+L210: .data -658, 653, -297, 854, -186
+lea L100, r1
+jmp L162
+L211: .string "nrihmhdvoxyphj"
+; comment
+not r3
+prn *r0
+L212: .string "kxzq"
+L213: .string "zhiandfnqfwqpownegsmtzmb"
+L214: .string "seztgps"
+L215: .data 371, 719, 7, -614, -447, 813
+red L252
+add *r3, L171
+L216: .data -819, 744, 751
+L217: .data 689
+rts
+jsr *r6
+jsr *r7
+L218: .string "pbcz"
+stop
+L219: .data -359
+add #106, *r4
+L220: .string "spvdgabazbgbm"
+L221: .data 628, 982, 152, 903, -713, -854, 15
+L222: .data -353, 91, -940, 578, 499
+; comment
+L223: .data 741, 360
+stop
+L224: .string "coslgrlkzrgn"
+cmp L228, r0
+L225: .string "scpykrkgj"
+L226: .string "jdlqutsehjjk"
+L227: .string "vzgtteoqxgpydmmejsanwqg"
+L228: .string "pxydfpvasehtkko"
+L229: .data -916, 526, -471, -246, -29, 740, 80, 141
+; comment
+rts
+L230: .data -306, -972, 595, 288, 279, -196, -147
+sub *r1, L272
+red r7
+L231: .data 311, 565, 20, -730, -681, 268, 901, 209
+rts
+L232: .data 468, 741, -669, 644, 521, -675, 744
+L233: .data 965, 40, -265
+L234: .string "srdppfakugldpk"
+L235: .data -788, -470, -441
+cmp r7, #254
+L236: .string "nnwrtvaulsbhrdwmib"
+L237: .data -140, -258, -538, 522, 13, -793
+stop
+L238: .data -712, 312
+L239: .data -421, 170, 418, -714, -64, -844, -539, 201
+L240: .string "yqdnxchyaggjkqmpigrsep"
+L241: .data -907, 219, 933, 770
+L242: .data -66, 804, 780, -166, -933, -186, -257
+L243: .data 815, -104
+cmp #205, r0
+L244: .string "ixjt"
+L245: .string "vzeptmkcfsgrewtr"
+L246: .string "hsvs"
+bne L198
+; comment
+red L294
+L247: .data -16, -656, 347
+rts
+L248: .data -940, -97, 171, 632
+L249: .data -309, 567, -435, -14, 334, 560, 35
+cmp #103, *r4
+L250: .data -557, -630, 932, 246
+dec L300
+L251: .data 748
+L252: .string "yeju"
+L253: .string "vabiaiontzxc"
+L254: .data -673, -254, -233, -523
+L255: .data -839, 850
+L256: .data -607, -937, -598, -504, -725, 780
+bne L242
+stop
+rts
+L257: .string "xmewmoolmhssdubdj"
+dec L88
+cmp #141, L121
+L258: add *r4, *r7
+not r2
+L259: .string "gncqukmuidnncr"
+L260: .string "jiowxwnraiutxcadok"
+clr L312
+lea L227, L169
+L261: .data 892, 117, -906
+jsr *r4
+red r1
+stop
+L262: .data 664, -181, -924, 938, 132
+lea L308, *r1
+L263: .data -706, -197, 696
+bne L293
+
+L264: .string "tnxiapymrawkysdqexe"
+L265: .string "aziojbgnoyfitpviyjqz"
+prn r6
+jmp *r3
+L266: .string "mdq"
+L267: .data -453, -172, 427, 328, 661
+mov #-104, r1
+lea L309, r2
+L268: jmp L289
+sub *r1, L44
+L269: .data -328, 214, -566
+L270: .data -185, 610, 926, 117, -454
+not *r5
+cmp #206, *r1
+L271: add r2, r5
+L272: .data -909, 406, -317, 990
+lea L295, *r3
+L273: .string "y"
+L274: jmp *r0
+inc L145
+
+L275: .string "hyzbzoqgtldubfkxyd"
+jsr L60
+L276: .data -290
+clr r7
+L277: .string "qgah"
+L278: clr L14
+L279: .data 604, -193, 840, -212, -71
+red r3
+L280: .string "yxdctbpbctaphulzoesaghfl"
+L281: .string "ghemg"
+L282: .string "jphqpu"
+prn *r4
+L283: .data 174, -260, 555, 210, 194, 82, -607, -453
+L284: .data 582, -426, -858, 128, 108, 497, -64, -228
+L285: add #16, r3
+add L322, L317
+L286: .data 566, 980, -76, 272, 186, 72, -560
+bne L127
+L287: .string "xyfyzfzlp"
+L288: inc r4
+L289: .string "mlvjzushzveurx"
+lea L316, L155
+L290: .string "scrlaojpecw"
+L291: .string "uphpeosrzcxijyhyva"
+L292: stop
+L293: .string "lnjowrjovhljtuboasqj"
+bne *r6
+L294: .string "aq"
+L295: .data 17, 567, 403, -440, -168, 257, -552, -954
+L296: .data 735
+rts
+L297: .string "vzhvre"
+L298: .string "dlxpseakkfbcmumfxcosxh"
+L299: sub #231, L313
+L300: .string "plfdbysypwwfxn"
+red r1
+; comment
+L301: .data 430, -926, 48, 925
+L302: not r5
+cmp L107, *r2
+L303: .string "dpyag"
+L304: .data -466, -721, -14, -385, -222
+not *r2
+red L310
+L305: .data -285, 168
+stop
+L306: .data 692, -814, -908
+L307: .string "vmtavxxkvnaialmjoj"
+L308: .string "z"
+red L311
+L309: .string "objguppizqokayguqxir"
+lea L19, *r2
+L310: .string "siyxplsxjqnuvcld"
+; comment
+L311: lea L139, *r6
+L312: .string "qeowphyfkcrwjivqwqikmy"
+L313: .data -534, 200, -728, -271, 310, -914
+L314: .string "njurcsrfkyjqvnezklapjz"
+L315: rts
+L316: .data -343
+L317: .string "efstdnbwknwflophjopyx"
+L318: .data -209
+L319: .data -160
+L320: .data 385, -898, 807, 543, -732, 205, 850, -369
+bne *r2
+L321: add r3, r6
+L322: .data -59, 944, 724
+cmp *r7, r3
+stop
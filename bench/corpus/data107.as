@@ -0,0 +1,521 @@
+; Generated by genCorpus --seed 108
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+add r0, *r7
+rts
+L0: .string "o"
+bne L27
+
+L1: .data -481, 986, -764, -215, -815
+L2: .data -421, 500, -470, 521, 989
+jmp *r0
+L3: .string "wjcvtsipfmeoz"
+
+L4: .string "qhynqixckzyk"
+rts
+L5: .string "aypkwswfzgvmow"
+lea L143, L1
+L6: .data 325, 201, -961, -677, 832
+L7: .data -710, 260
+L8: .data 419, -405, -387, -788
+L9: .string "ugyqczualsgb"
+L10: bne *r5
+L11: .string "imsijnddqsq"
+L12: .string "mfdhzqzumyvelszkdw"
+L13: .string "uuhepyyiqy"
+L14: .data -194, -676, 864, -679, -954, 680, -367, -941
+dec L253
+L15: .data 211
+L16: .string "dfhodguvrwempr"
+lea L11, *r5
+L17: .string "hwawkskc"
+L18: .string "zbhzdiwaisbfcac"
+L19: .data -998, 764
+L20: .data -304
+L21: .string "lvlq"
+L22: .string "ufhzchhbeguwag"
+L23: .string "oqfxeoewjtyqphaljnoj"
+L24: .string "kmifwdtpfe"
+L25: cmp #-232, r0
+L26: .data -626, 554, -670, -35, -726, -918
+L27: .data -854, -414, -368, 510, 670, 971, 688
+prn #209
+
+L28: dec L3
+stop
+L29: .string "cnraobrdzz"
+L30: .string "suogphasrczzyxi"
+L31: .data 326, 618, 360
+; comment
+L32: .data 121, -618, 921, -146
+L33: .string "chtk"
+L34: .string "milqkvl"
+L35: red *r0
+sub r5, r1
+red *r3
+L36: .data -488, -591, 559, -592, 872, 897, -766
+L37: .data -40, 133, 131, -927
+cmp *r2, r5
+clr L19
+cmp r0, r1
+
+L38: .data 499
+L39: .data -402, -998, -456, 601
+bne *r1
+clr L39
+add L160, L21
+lea L14, r7
+cmp L235, L34
+L40: prn r3
+L41: .data -915, 14
+dec r6
+
+L42: .string "fdgzsqjgx"
+L43: .string "tq"
+L44: .data -371, -141, -858
+L45: cmp L16, *r7
+L46: .string "kdvveaa"
+L47: .data -195, 640, 57, 346, 53
+L48: .string "vgilqdozlgriukuujy"
+L49: .string "runy"
+L50: .string "zjthqeda"
+L51: .string "ntfcblo"
+L52: .data -400, 735, 761
+L53: .data 992, -994, 312
+L54: .string "klayrzaypsk"
+L55: .string "bjxiubgy"
+inc *r5
+rts
+; comment
+L56: .string "jbgfyqomo"
+jmp *r4
+bne *r6
+L57: .data -577, 919
+jmp *r0
+L58: .string "inznbaaelkvsopxbs"
+L59: .string "qszudvoalmxerjiicitjc"
+L60: .string "pndczdgrtd"
+L61: .data -50, 16, -358, -160, -181, 912, 794
+L62: .string "qv"
+sub r5, L16
+L63: .data -413, -345, 322
+L64: .data 732, 727, -269, -707, 543, 834, -477, 499
+L65: .string "vky"
+L66: .data -142, 354, -945
+L67: .string "rzqoq"
+L68: .string "dpd"
+rts
+not L40
+mov *r3, r7
+L69: .string "owsm"
+L70: .string "siwylcybzxuc"
+L71: .string "ialommjzjmv"
+sub r2, *r4
+mov *r3, *r3
+lea L18, L24
+bne *r3
+L72: .string "oblfppvyxrdxqwidtv"
+add L27, L34
+L73: .data -176, 970, 347, 390, 829, 736
+cmp r2, r3
+L74: .string "qdbowfyhra"
+red L134
+L75: .string "wbahahdwifbykonlaylbi"
+L76: .string "yoktegsgupfrxvtadjmoyfrz"
+jmp L64
+inc r3
+L77: .string "sugsvfpmorjxksrnnhijk"
+L78: .data 443, 369, 505, -813, -937, 937, 239
+L79: .data 685, 331, 54, -267, 857, -746
+add r4, r3
+L80: .data 682, -12, -514, 976, 683, 81
+L81: .data 436, -347, -797
+L82: red r6
+L83: .string "bnrdzdppefajpwhqok"
+bne L103
+jsr L35
+red *r1
+L84: .string "foxrhydzislri"
+L85: sub L7, L189
+rts
+L86: .string "qqzjfieszvoalcbgftj"
+; comment
+L87: rts
+stop
+L88: jsr L3
+L89: .string "tiazjekjbjcohwrvov"
+cmp #213, #-164
+cmp L46, r3
+clr r6
+sub *r0, *r4
+add #226, *r2
+L90: .data 259, -625, 458, -782, 360, 663
+add #-3, r7
+L91: .string "grtumlivgtkkg"
+L92: .data -997, -629, -780, -66, -541
+L93: .data -765, -431
+add #158, *r4
+; comment
+L94: .string "ubouqqwlqztuphiegqtr"
+L95: .string "lfsjxeupzrnmnd"
+prn *r2
+prn r6
+L96: .string "afbmugfoscgbblhwsj"
+sub L140, r6
+L97: .data -650
+L98: .string "yzlvjoerrzzojkghyto"
+clr *r2
+L99: .data 516, -337
+L100: .data 504, -666
+L101: .data -596, -435, -627, -659, -3, -268
+L102: .data 926
+L103: .string "ernbjqrezuvgaxjxpi"
+L104: .data 683, 518, 719
+dec r7
+stop
+L105: .string "eszvdra"
+L106: lea L12, L262
+L107: .data -857
+L108: .data 859, 173, 301, -862, 36
+L109: .string "icoixh"
+L110: .string "s"
+L111: .string "zdsjpbyvuuyf"
+sub #-132, r6
+L112: .data 871, -177, 76
+L113: .string "lzzfwbpoxxgbpwkyzhkbp"
+dec r3
+L114: rts
+L115: .data -99, -244, 364, 203, 454, 744, -287
+jsr *r5
+mov r3, *r0
+L116: rts
+rts
+L117: .data -895
+jmp *r4
+L118: .data 744, -507
+L119: .data -114, -742, -766, 172
+dec *r4
+L120: .string "yq"
+sub #-155, L293
+L121: jsr *r6
+L122: red r3
+sub L199, L84
+dec *r2
+L123: .string "kvkfdbrhwirhkfrghgzqc"
+L124: .string "edufknkzdtp"
+bne *r3
+jsr *r0
+L125: .string "ocswektnqicsavvivicw"
+L126: .string "qoaf"
+jsr L148
+L127: add #-141, r0
+L128: .string "dckecdspztscjfuyqb"
+L129: .data -905, -994, -632
+L130: .string "fbu"
+; comment
+red L196
+stop
+L131: .string "cvfgozvzxigpqvfianb"
+L132: .data -599, -20, -231
+jmp *r2
+mov r0, *r3
+L133: .data -285, 217, 303, -279, 513, 244, 100, -213
+L134: .string "jjp"
+L135: .string "aruvynp"
+
+; comment
+L136: .string "syaa"
+L137: .data 238, -98, -370, -770, -93, 708
+L138: .data 668, -563, -306, -466, -74
+L139: .string "qzeccilcnufyo"
+add r3, L16
+L140: .string "xibmzcfqwsteng"
+clr r7
+inc r3
+sub #123, *r2
+L141: .data 477, -416, -906, -341, -594, 811
+L142: .string "meluirulpbhndsuppmg"
+red L60
+L143: .data -442
+
+bne L290
+L144: .data 62
+not L65
+L145: .string "z"
+L146: .string "mjkscixuznjmhwnn"
+L147: .string "cxqvuclwhup"
+L148: .string "wmfdcgwcuxszj"
+L149: .string "f"
+L150: .data -408, 572, 633, -370, 815
+L151: .data 95, -580, -435, -294
+; comment
+mov *r3, L102
+L152: .string "eriz"
+prn L123
+L153: .data -134, 616
+L154: .string "ttlyzho"
+; comment
+L155: .data 324
+L156: .string "wocbkaqujn"
+L157: .data -64, 205, -379, 538, 293, 363, -410
+L158: .string "ggmnffjhegqzavwei"
+L159: bne *r7
+L160: .string "plj"
+L161: .data 117, 592, 496, 891, 885, 268
+red *r4
+L162: .data -432, -596, 68, 810, -155
+L163: .string "grrglfizkjn"
+L164: .string "omojvxdsgclhlp"
+L165: .string "ewnqwya"
+L166: .string "lbubufoagejz"
+L167: .data 51, -240, 74
+; comment
+sub *r1, *r0
+bne L64
+L168: .data 375, 817, 482, 538, -337, 428
+L169: .string "hsmejetsu"
+L170: add r3, r1
+L171: .data 545, -786, -376, 60
+L172: prn *r7
+L173: .data 711, -251
+L174: .string "nmuzcnlujaoaebruise"
+; comment
+stop
+not L122
+bne *r5
+not *r5
+L175: .string "eugnqhosynmuzek"
+; comment
+red r0
+sub r2, r4
+L176: .string "axhzbnoepzrbonzuyihts"
+L177: .data 732, 932, 165, 667, 588
+stop
+L178: .string "gqcw"
+L179: .string "cgkbxtpxenupuuamzxj"
+L180: .string "jdtnzbveqjhaaxawq"
+L181: .string "qnpkkspekkoiwig"
+L182: .data 61, 733
+L183: .data -792, -979, -648, -699, -311, -457, -762, -295
+rts
+L184: .string "otbvajbezckrf"
+prn L69
+lea L19, r3
+jsr *r0
+L185: .string "cufmjovrtkc"
+L186: .string "b"
+mov *r6, *r0
+L187: cmp *r3, #243
+L188: .data 715, 229, 936, 852, -941, -982, 560, -499
+add L229, r0
+bne L217
+L189: .data 17, 774, 974, -958, -169, -749
+lea L152, L199
+L190: .string "i"
+L191: .string "ftvvzzljv"
+L192: not *r7
+L193: .data 467, 904, 584, -323
+L194: .data 245, -198, 42, -7, 130
+L195: .data -895, -77, -463
+L196: .data 664, -649
+L197: .string "lzjixeufxihoxekydtixzdw"
+not *r2
+L198: .data -712, 714, 918, 785, -101, -257, 661
+L199: .string "tuewnripnq"
+L200: .data -731, -478, -647, -331
+jmp *r5
+L201: .data 152, 86, 803, 955, -747, 771
+stop
+dec *r4
+L202: .string "ioy"
+L203: dec *r6
+L204: .string "at"
+L205: .string "ptymxvuzlzwqutupifsbf"
+not r3
+jsr *r3
+L206: .data -639
+L207: .data -336
+dec *r4
+sub *r4, L250
+jsr L228
+jsr *r2
+L208: .string "mdbhijfayju"
+lea L116, r4
+mov L222, r6
+; comment
+jmp *r5
+prn L246
+L209: .data -644, -458, 716, -500, 485, 916, -80
+L210: .string "kvh"
+prn *r2
+L211: not *r7
+L212: .data -470, 504, -117, -744, 84
+L213: .string "vwaw"
+dec L235
+L214: .data -284, 355, 706, 875, -575, -89, 402, -178
+dec L3
+L215: .string "gkhxmqdfqxj"
+L216: .string "aiiuzkirnth"
+
+add r1, *r2
+add *r5, r3
+mov r2, r0
+jmp *r3
+red *r3
+sub *r2, r4
+stop
+L217: .data 536, 278, 498, -7
+L218: .data 526
+L219: .data -553, 621, -422, -210, -868, -62
+not r5
+L220: .data -750, -899, -624, 537
+L221: .string "dbymgtjjvoj"
+L222: .data -736, 811, 367, -358, -28, -439, 368
+L223: .string "hacozjdkblduvkwgoa"
+L224: .data 427, 133, -191, -157, 510, -611, 384
+L225: .string "czqpmjicnyijscrgvt"
+L226: .data -726, 288, 779, 282
+red r5
+L227: .data 213, -185, -177, 503, -850
+dec r2
+L228: .string "iux"
+bne L277
+L229: .data 753, -352, -731, 698, -713, 531, -395
+L230: .string "gvnptpqpfjptlkxw"
+red r0
+L231: .string "ansnrmedibutwkwnvkmvsa"
+L232: .string "giwcvitxzpctllut"
+L233: .string "jlmkiormigcq"
+lea L296, *r1
+L234: inc r4
+L235: .string "kmius"
+L236: .data -465, 394, 882
+mov L250, r4
+L237: .string "nzrjyzx"
+L238: .data -750, 531, 852, -486
+L239: .string "pzin"
+L240: .string "lp"
+L241: .data -554, 908, -500, -165, -204, 101, -35
+L242: .string "ykgsnzj"
+L243: cmp #26, *r7
+inc r2
+L244: .string "zvgcwrhzidtzwsxgzzec"
+L245: .data -138, 788
+L246: .data -31, 964, -427, 925
+L247: prn L295
+bne L124
+red L193
+L248: .data 663, 337, 471, -640, 218, -118
+mov r7, r0
+L249: .data -856, 772, -544, 103
+red r5
+dec L133
+L250: .string "rtjeelgcgxcpsdhynrkimuzc"
+jmp L116
+red r6
+L251: .string "tlslohjjgxtke"
+L252: .data -613, 443, 426, -231, 808, -680, -141, -269
+; comment
+mov L291, *r2
+L253: .string "rsztavjotccqyvagcrfs"
+L254: .string "huttpbdacgtpjekxcg"
+L255: .data -990, -91
+L256: .data 100, 907, -277, 969
+bne L281
+L257: .string "jpbgoesufoddibuzdd"
+cmp *r4, r7
+
+jsr *r1
+L258: .string "fjkxf"
+L259: mov *r6, *r3
+L260: .data 132, 587, 171, 366, -872
+L261: .data 455, -771, 48, -469, 127, -781
+L262: inc L195
+not r5
+L263: prn r0
+clr r1
+lea L16, L281
+L264: .string "ifyelhmxse"
+sub r0, *r6
+L265: .data -247, 960, 504, 31, -266
+L266: .data 282, -759, -426, 452, -362, -531, -211, 382
+
+inc *r3
+add L193, *r6
+dec L288
+rts
+L267: .data -501, 56, -695, 18, -658, 772
+L268: .string "tgdrlhhrthrafdpkhcy"
+dec r4
+L269: .data 222
+L270: .data -695
+L271: .string "uizc"
+L272: .data 108, -576, -673, 23, 783, -255, 147
+L273: .string "zeyomkasygyxjmkkyqync"
+; comment
+L274: dec L286
+L275: .data -746, 635, 772
+L276: red r2
+L277: .data 379, 429, -113
+L278: .data -909
+dec L293
+L279: .data 805, 336, 402, 250, -419, -530, -429, 381
+L280: .data -749, 661, 869, 70
+L281: add *r1, L283
+L282: .data 194, -274, -956, -418, -816, -736
+L283: .data 93, 341, 203, -523, 44, -659, -922
+L284: .data 613, -766, -480, -413, 962, -630, -685, -464
+jmp *r6
+L285: .data 407, 936, -569, -593, 622, -752, 982
+clr r5
+dec L158
+not r5
+jmp *r5
+L286: .data -371, 650
+sub L208, *r1
+L287: .string "prdumxifp"
+mov #-163, L78
+; comment
+add #-105, L288
+jmp L42
+jsr L293
+L288: .data 29, 231
+add r4, r1
+L289: rts
+L290: .string "xxsyqtuufauqpgshbzu"
+lea L295, *r2
+cmp *r3, r6
+bne *r5
+jmp L110
+
+L291: clr *r4
+lea L260, *r5
+prn #-113
+L292: .data -330, 237, -367, -598, -357, 490, -396
+L293: not L291
+L294: .string "ujsdpdwxzypbebwccfaeggf"
+L295: .data 527, 688, 681, -104, -384, -157, 544
+L296: .data -812
+L297: .data 244, -218, -581, -681, 436, 334
+L298: clr r1
+L299: .string "fctsjehudayhdbxdlff"
+lea L300, r3
+L300: .string "rypvnvixuncwltaaoa"
+stop
@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 109
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+L0: .string "xzkcaddagw"
+L1: .string "qdjcodjxletwbhtec"
+L2: stop
+dec L231
+L3: .string "aglzioqo"
+clr *r6
+L4: .data -599, 551, -949, 524, -297
+L5: not r0
+bne L3
+L6: .string "gjchhi"
+L7: .string "czhovmevjovud"
+mov L298, r6
+L8: .string "bqiphujugdpc"
+L9: .data 25, 106, 439, 399, 41
+
+L10: .string "zm"
+jsr *r6
+L11: .string "droiolymvdemkynv"
+jmp L66
+
+L12: .data 190
+jmp L4
+L13: .data -791
+rts
+L14: .data 136
+
+L15: .data -125, -178, -388
+; comment
+dec *r0
+L16: .data 703
+L17: stop
+L18: .data -408, 834, 944, 32, 619, 141, -635, 346
+L19: .string "dbplnevvvhuphuzel"
+L20: .string "ajqqi"
+bne L20
+inc r6
+
+L21: .string "nqtpacgjfqz"
+prn r5
+L22: .string "gqwonlbal"
+jsr L170
+bne L0
+L23: .string "oygcchnubg"
+L24: .data -25, -645, 275
+L25: bne *r4
+L26: .string "kwprzqekxxomauk"
+L27: .data 215, 820, 411, 286, 714
+L28: .data -904, 363, -260
+L29: .string "cfnllspd"
+L30: .data 822, 38, -325, 401, 108, -230
+L31: .string "hgsvapwvqpqzqqjoujgycpbd"
+L32: .string "sxquiepxrdgis"
+
+stop
+L33: rts
+L34: .string "knyigpekujoifp"
+L35: .string "udxlrplmimbtmdaokzjxpmkr"
+L36: mov #119, *r1
+L37: .data -911, 861, -773, -110, 87, 596, -802
+dec r6
+bne L23
+L38: .data -231, 439, -14, -349, -610, 998
+prn #-94
+L39: .string "tfdtpqwraxyypokhicfk"
+L40: .data 537, -651, -439, 302
+L41: .data 476, -432, 337, -455, -922, -529, 283, -959
+L42: .data -78, -538, -630, -884, -20, 202, 402, 396
+
+L43: .data -668, -206, -973, 969
+dec r4
+L44: .string "hoolsdxevezgkszgf"
+sub *r5, *r2
+L45: .data 429, 268, -269, -129, -300, -47, 836, 1
+L46: bne *r7
+L47: .data -858, -752, -181, 938, -31, -519
+L48: .string "uf"
+L49: cmp #-212, L42
+cmp L9, r2
+L50: .data -164, 840, 856, 446, -868, 225
+bne L306
+bne L44
+clr *r4
+L51: .data -309, 542, -597, 749, 809
+L52: .string "ncsslmiclg"
+L53: .string "ovwppgwpdevz"
+L54: .string "pvrezoivxlmdwpzsuoooofor"
+jmp L211
+L55: .string "peqzbuxz"
+L56: .data -947, -320, 297, -599, 50, 122, 404, 497
+red L244
+L57: .data -43, -251, -381
+; comment
+L58: .string "taa"
+L59: .string "oznfzainxwtciiv"
+L60: bne L235
+L61: .string "ylp"
+L62: jmp *r5
+L63: .data -269, 542, 409, -212, 154, 89, -187
+L64: .string "hkzxufqqeshjwyjrzco"
+L65: .data 95, -742, 686, 198, -155, 269, -440, -974
+L66: .data -877, -294, -326, 606
+red *r3
+L67: .string "jnk"
+prn #-231
+L68: .data 692, -753, 281, -347, 561
+L69: .data -262, 526, 784
+L70: .data -201, -612, -945
+L71: .string "psr"
+
+L72: .string "dopjvifakmfkeaxuaw"
+L73: .string "vtcjiiepgowsggbkhsfcbm"
+L74: .data 800, -675, -936, -713
+rts
+L75: .string "bs"
+L76: .data 643, -674, -973, -418, 5, 277, 66
+L77: .string "acvchkfml"
+rts
+L78: .string "nqdwwyizzln"
+rts
+L79: .string "poxxmw"
+red *r4
+L80: .string "bfmzsvktagtcpze"
+jsr *r5
+L81: .string "egdxxaj"
+red r6
+L82: .string "kbahkjijnivzqrqaycno"
+L83: .string "lheghyed"
+L84: .string "zvakmwufv"
+L85: .data -956, 961
+cmp L47, r6
+L86: .string "w"
+stop
+L87: red *r0
+L88: .data 214
+L89: not *r4
+; comment
+cmp #138, #221
+L90: .data -3, -858, -646, -695, 904, 78
+L91: .string "yjatzabewwujbecale"
+lea L0, r4
+mov r1, L37
+L92: .data 378, 212, -102, -221, 446, 729, 43, 245
+L93: .string "rgknrrx"
+L94: .data 888, -521
+red *r7
+L95: .data 262, -638, -895, 858, 817, -283, 69, -835
+L96: .string "bwtxqcbnciesrt"
+prn #-140
+L97: .string "xdvzcnplhwxrn"
+L98: .data 586, 329, -94, 898, 790, -820
+L99: .string "fjizbe"
+L100: .string "ezpmnmjoqewqzduredney"
+L101: .string "bnkvqxjkldwowsxrxfj"
+L102: .string "huxnipejzho"
+L103: .string "brgrgxjlblswhksugg"
+L104: .data -753, 683, 259, -890
+L105: rts
+
+L106: .string "itdjoslehsqlxrqezrihjzo"
+jsr L167
+L107: .data 562, 417, -796, -373, -55, -707
+L108: .string "arwuv"
+L109: .data 69, 773, 104, 339, -128, 725, -741
+stop
+L110: .string "grslprpjbcdqazfkxprpczd"
+L111: .string "ycnzhdkewi"
+L112: .string "baghmkcpopeggoodokifj"
+L113: .data -175, 611, 680, 684, -496, -627, -624, 745
+dec *r4
+L114: jmp *r3
+sub r1, r0
+; comment
+L115: .data 79
+sub r4, *r4
+L116: .string "jvrwckoh"
+L117: .data -725, 429, -305, 133, 119, -709, 232, 821
+
+L118: .string "alokovtxkmxddckkltkhaw"
+L119: .string "bodayozphkkzjdztcykehjot"
+L120: .string "jhpbpvwgybtzueeypojb"
+L121: .data 806, 372, -163, -482, -451, 870, -557, 851
+stop
+L122: .string "tmswuklhldsamkttxefmc"
+stop
+L123: prn *r7
+L124: .string "bgykyjtvenbeqgopaaiyrp"
+L125: .string "wvmz"
+clr L153
+L126: .string "s"
+L127: .string "dxmokonuuaps"
+L128: dec *r7
+L129: .string "ij"
+add L13, r4
+prn L13
+
+L130: .data -813
+not L303
+L131: .data -436, 727, 568, 789, -704, -210
+L132: .data -688, 584, -474, 406, -98, 857
+prn L94
+L133: .string "oc"
+L134: .data 212, -416, -857, 420
+cmp L1, L227
+L135: .string "esgzulximfbyy"
+not L198
+clr *r5
+L136: .string "dztlbsmcpkokzrrm"
+L137: .string "yxnavgioggyxzbvuklwyyyly"
+mov #235, L20
+L138: .data -620, 548, 862, 411, 377
+L139: .string "jkrmtssmq"
+red *r3
+add #-66, *r0
+
+add #-197, r6
+L140: .data 756, -686, -19, -547, -292
+sub #-243, r0
+L141: .data -500, 33
+add r1, *r4
+L142: .string "ohfvrofcpgxrk"
+L143: .string "jjzl"
+L144: .data -536, 410
+bne *r6
+cmp #-83, *r7
+
+L145: .string "svhlzjvaizwonzqfroxelix"
+jmp L18
+jsr L32
+L146: .data 4, -581, -949, -778, 653, -907
+L147: .string "qpbsmp"
+L148: .data 671, 475, 638, -672
+lea L291, L107
+L149: mov L129, L164
+L150: .data -628, 655, 830, -816, 631, 574
+sub r0, *r2
+inc L154
+L151: .data -85, -417
+L152: clr r6
+L153: not r0
+dec r3
+L154: .data 973, -771, -346, -954, 331, -44, -798
+
+L155: .string "pipeqbhhpvclyvfy"
+L156: .data -978, 288, 752, 696, -529, 120
+cmp r1, r6
+L157: clr *r6
+L158: .string "bgaltvgwbfduu"
+L159: .string "mgbefhplihtgeuvjzz"
+L160: .data -319, 186, 45, -168, -291
+mov *r3, L30
+
+red r3
+L161: .string "dzknvrkkevpknc"
+L162: .string "zkwwjhrribakp"
+jsr *r1
+sub *r7, r0
+L163: .string "tejnli"
+dec *r2
+L164: .data 806, -637, -221, 571, 929, 771, 336
+red r6
+L165: .string "wfnfeooiuanfjcvbm"
+L166: .string "wwqmsxgzkvdaxiuxvpmc"
+L167: .string "qn"
+rts
+red r0
+not L29
+L168: clr *r5
+L169: .data -859
+L170: .data 684, 648, -216, -550, -911, -33, 109, -776
+L171: .string "onqnrlktdsbmtmbtumefwqa"
+L172: .string "ry"
+L173: .string "ciqrrwfffzjrmehgffshnl"
+; comment
+jsr L307
+mov *r6, *r7
+red *r5
+jmp L131
+jsr L44
+L174: .string "sq"
+L175: .string "fmeq"
+L176: .data -352, 957, -116, 700, -393, -983
+L177: .data -752, 914, 332, 305, 809, 911
+L178: .string "nwcfxun"
+red r1
+jsr L263
+red L59
+L179: .data -163, 320
+prn #-196
+L180: inc *r4
+L181: .data 629, -801, -215, -542
+bne L195
+L182: .string "yyygylkq"
+jmp L215
+jmp L188
+clr *r5
+L183: .data 181, 82, 803, -4, -459
+L184: .string "r"
+lea L272, *r7
+L185: .data -964, -779, -268, 280, 82, 601, 177, -824
+L186: .string "ims"
+jsr L269
+L187: .string "zi"
+L188: .string "hljfxkcwftg"
+L189: .string "pi"
+L190: .string "adxrqupiffdlttv"
+bne *r6
+
+L191: add #-131, r3
+L192: .string "gcdeckkfzdxgsj"
+L193: .string "bfvdccrwn"
+dec *r7
+lea L25, r0
+L194: .data -102, 480
+cmp r1, #83
+L195: .string "airtfyovrdei"
+L196: .data 843, 716, 760, 688
+L197: .string "bqwsyyfa"
+L198: .data 992, 321, -233, 82
+lea L103, L68
+L199: .string "gubvnsnykzmqdzsemxiva"
+jsr L180
+L200: stop
+L201: .data 91, 223, -46, -587, 403, 176
+dec L126
+L202: .string "jiwamm"
+L203: red *r2
+L204: .string "rptrkezxerjevhsvyjaag"
+L205: .string "nfhgtyrdget"
+add L131, L237
+L206: .data 904, 940, -42, -804, -507
+red *r3
+L207: mov r2, r3
+L208: .string "ubfdorcazcv"
+L209: .data -688
+not L20
+dec r2
+L210: .data -94, 307, 299, 0, -750, -164, 264, 375
+not L172
+inc *r5
+L211: .data 931
+jsr L233
+lea L262, L63
+; comment
+L212: lea L37, L291
+L213: .string "mfpfooihbabbsjpvsi"
+L214: .data 15, 500, -575, -552, 993
+red L251
+L215: .data -673
+L216: .data 987, 246, -43, 305, -786
+
+L217: .data -510, -407
+L218: .data 936, -800, 594, -918, 400
+L219: .data 663, 130, 993, 415, -189
+L220: .string "hljzrgdjvzh"
+
+L221: .data 538, -21, -660, -493, -833, 988, 889
+L222: .string "qlxfzuccetnwgawk"
+L223: .string "aqa"
+not *r3
+L224: .string "llcsbzfewnwtefilpljw"
+L225: rts
+L226: red r6
+L227: .data 541, 776
+L228: .string "milyhs"
+L229: .data 228
+L230: .string "seqfanhh"
+L231: .data 923, -153, -908, -222
+L232: .string "iqnxbijtsy"
+L233: .string "a"
+L234: .string "iafoibrtjrpgdpesphtk"
+L235: .string "ifabwccpzatzqktatchnn"
+L236: .data -524, -675, -363, 471, 881, 309, 921
+red L247
+inc r1
+inc *r7
+L237: .string "fdcski"
+jsr *r6
+add L300, L60
+dec L207
+L238: .string "yldyxurjvbozalzzescl"
+L239: .string "nelbkwspwigmmgq"
+jmp *r3
+stop
+L240: .string "wpntx"
+L241: .string "wgi"
+L242: .data -363, -765, 836
+clr L202
+jmp *r0
+L243: .string "wevsyihyqed"
+L244: .data -494
+
+L245: jmp L248
+bne *r4
+L246: .string "rfvfrxgkidwoahkb"
+L247: .string "mwifdipijoxkjrbxfu"
+red L151
+not L210
+L248: lea L149, *r6
+L249: jsr *r3
+L250: .data -522, -145, -653, -479, -143, -801, -59
+L251: dec L204
+L252: .data -859
+L253: .data 990
+L254: .string "kjnchzivkdgbdpdvxji"
+L255: .data -203, -357, 176, -295
+L256: .data 968, -810, -736, -649, -332, -264, 211, 159
+L257: .string "jidshdrpnhwykabxvllp"
+
+L258: .data 58, 566, 600, 147
+clr r7
+lea L144, L137
+L259: .string "rojgysdvcaa"
+L260: .data -153, 837, 952
+L261: .string "sgvzklomreeo"
+L262: .string "gfncfazisrxmimv"
+L263: .string "qzsbmzavd"
+L264: .string "ckqbwct"
+L265: .data -961, -171, -841, -121, 972, 92, -623
+L266: prn r7
+L267: .string "vmglwoincnemrtn"
+L268: .string "fcs"
+prn *r2
+L269: jmp L81
+rts
+add r4, r6
+L270: .data 275
+L271: .string "xnhmgk"
+L272: cmp r4, r4
+L273: .string "lt"
+; comment
+L274: .string "dziqklxqo"
+L275: .string "athcy"
+rts
+L276: .string "ferohufacocdtmmu"
+jsr L291
+inc L293
+; comment
+L277: .data 395, 751, 290
+clr r5
+L278: .data 4, 299, -673, 890, -796, 974
+jsr L308
+L279: .data 546, 454, -118, -463, -517, 860
+
+L280: red L182
+L281: .data 384, 10, 600, 700
+; comment
+L282: .string "keqowkuaartk"
+not *r1
+rts
+L283: .string "qhekepytwvibwtziaokuj"
+L284: .data -324, -354, -380, 880
+mov r6, r2
+cmp #119, r0
+L285: .data 564, 717, 906, 681, -894, 11, 329, 184
+L286: .data -419, -42, 91, -126, 44, 501, -8
+L287: .data -2, -464
+cmp L291, L59
+L288: bne *r2
+L289: rts
+L290: .data -780, -527, 935, -847, 678, -483, -28
+not r2
+
+bne *r2
+L291: .data 29, -514, 418, -140, 817
+L292: .data 187, -539, 384
+lea L169, r3
+L293: .data 148, 796, -758, 127, 289, 400, 776, -273
+L294: .data -639
+L295: .string "capzgs"
+bne *r1
+L296: .data -396, -129, -31, -901, -721
+L297: .string "efw"
+L298: .data -860, 159, -273, -843, 442
+inc L300
+jmp L176
+L299: .data 21, 21, 135, 924, 337, 548
+stop
+L300: .data -112, -378, -609, -274, 819
+L301: .string "xolfrugqecjbjaqo"
+L302: .string "fmeqbjf"
+L303: .string "irrdgkzew"
+L304: .data -272, 340, -885, 98, 462, 373, -259, 592
+mov L228, r4
+clr L129
+clr L261
+jmp L313
+L305: .string "bckwpdryliir"
+L306: .string "nnsqhfvqiodeybkwxtt"
+L307: .string "pqaxsvnbbhznnbecpvpnlkj"
+sub #-214, L309
+L308: .data 350, -521
+L309: .string "ashjsisht"
+rts
+sub L311, L311
+L310: .data -381, -18
+not *r6
+L311: bne L312
+mov r0, L116
+L312: .data -698, -922
+L313: .data -398, 487, 133, -886, -963, -923
+stop
@@ -0,0 +1,524 @@
+; Generated by genCorpus --seed 110
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+jsr *r5
+rts
+L0: .string "pnebusapwpvvj"
+L1: .string "sfnfximgjvegalogc"
+
+L2: .string "thgr"
+L3: .string "vnahqd"
+jmp L0
+L4: .string "etprphioosmdigowbwijpd"
+L5: .data -464, 418, 983, 931, 865, -651, 249, 419
+L6: .data 416
+jsr *r1
+L7: .data -966, -210, 467, 68, 999
+L8: .string "cdykbgpublpybwcwivyuzcyj"
+L9: .data 751, 410, 44
+L10: add *r2, L8
+L11: .data 805, 663, 465, -92, 373, 463, 877, 837
+red r1
+; comment
+L12: .string "ztewzwtlxsghjgqzi"
+L13: .string "urhkwrtsizdyfscqvpwtzaxx"
+L14: .data 534, -685, 298, 302, 568, 878
+; comment
+L15: .string "kjyg"
+mov r7, L13
+cmp *r1, r7
+L16: .data 318, 699
+L17: .data -952, -194, -376
+L18: not r3
+
+; comment
+L19: .string "holirqcaaxgygvvzrffrlwnq"
+L20: .data 709
+L21: .string "xsqwwgekwfmwhbewmhlydwm"
+; comment
+L22: .data 22, -432, -596, -410, 349, 606
+L23: .data 173, -586, -86
+red *r2
+L24: .string "edkwsxgjr"
+L25: mov #-20, r3
+L26: .data 396, -399, 557, -218, -488
+L27: .data 579, 332, 896, -953, -622, 663, -43
+L28: .data 50, -389
+L29: .string "jhjqolr"
+jmp L320
+L30: .string "ypygefnwfyqxjajrjx"
+L31: .string "fbjpfy"
+L32: .data 899, 685, 645, -126, -705, -857, -585, 557
+cmp *r4, #28
+
+red L307
+L33: .string "bkyntlqfxdiiskz"
+L34: lea L29, *r5
+L35: .data -462, 957, 698
+L36: .data 821
+; comment
+L37: inc L205
+L38: .string "blxygwjro"
+red r3
+L39: .data 569, 818, -934
+red r4
+sub L33, r5
+L40: .data 171, 46, -631, -340, -918, 829, 450, -634
+L41: .data 65
+L42: .data 843, -990
+jmp L21
+L43: .data -406, 912, 679, 699
+bne L9
+L44: .data 478, -675, -827
+L45: .string "gjwghs"
+L46: jsr *r1
+L47: .data -757, 885, -586, 401, -129, -890, 130
+L48: .data -301, -642, 826, 510, 822, -660
+L49: .string "wbowewkptzoxhh"
+L50: .string "rugilegba"
+clr *r4
+L51: mov #-47, L36
+clr *r1
+L52: .string "wczxlxals"
+L53: .data 345, 354
+L54: bne L37
+L55: .string "blsfxkvlbjklb"
+L56: lea L36, r0
+not r3
+L57: .string "avvaydzuqfxhdvgxbyika"
+L58: .string "narjvouarwfta"
+; comment
+L59: .data -914, -178, 821, 665, 562
+L60: .string "izbg"
+L61: .data -474, 845
+jsr L33
+prn #-122
+prn L32
+L62: .string "tnmnvgfara"
+L63: .string "nbdhtfpmr"
+jmp L4
+L64: prn r1
+L65: sub *r6, L65
+add r6, r4
+L66: .string "es"
+L67: .string "yeq"
+L68: .data 592
+L69: .data -814
+L70: .data 9, 53, 927
+jmp L177
+L71: .string "pdcvumpmzkqhysxazqsymanf"
+L72: .data -140, 599
+jsr *r6
+L73: .string "pnwqidkuxezkgrxpqnnite"
+L74: .data 850, -641, -82, 166
+L75: .data 556, 282, 568, -841, -818, 518, 181
+; comment
+prn L0
+jmp L25
+L76: .data 206, -598
+red *r7
+stop
+L77: .string "utxa"
+L78: .string "httgctkn"
+L79: .string "kizlj"
+L80: .data 784, -566, -644, 558, -606, 205
+lea L62, *r5
+L81: .data 699, 719, 913, -709, -491, -230
+L82: .string "fmcjyxlpbwlqvur"
+L83: .data -119, -936
+L84: .string "zxhpahkb"
+L85: .string "vckiksk"
+L86: .string "umjktuowdiqbubbg"
+L87: .data -130, -803, 265
+cmp #-5, *r2
+L88: .data 846, -8, 519, -298, -762, 629
+cmp L270, *r7
+
+L89: .data 543, 590
+L90: .data -112, -204, 203, 140, 676
+rts
+L91: .string "paw"
+L92: .string "xxmm"
+not L301
+L93: .data 917, -938, -108, -992, 408, -75, 446
+L94: .data -85, 974, 27, 114, 68
+L95: .string "bgqimbftgt"
+L96: .data 317, 70, -368, 333
+L97: .string "nowncspc"
+L98: .data 796
+L99: .string "ljkgyoyaxlvgrsjd"
+L100: .data 480, -302
+L101: .string "vbjwohqmkaonhjrs"
+mov #0, L273
+L102: .string "pbnjbthibqnid"
+not r3
+L103: .data 793, 10, 805, 305, 434, 243, 38
+L104: .data -253, -816, -15, 516, 457, 151, -350
+L105: .data -74, 279, 398, -135, -36
+cmp r3, r6
+L106: .string "slpggnyyhcawhb"
+sub r3, *r2
+L107: .data -872, 808, 294
+L108: .data 868, 89, 808, 755, -888, -783
+jmp *r0
+L109: lea L268, r6
+red L334
+L110: cmp L260, *r6
+L111: .string "bxajkj"
+
+rts
+add r5, L318
+red *r0
+L112: .string "gtblwvvlyqamogsufqzn"
+L113: .string "qjio"
+L114: .data 417, 464
+L115: .data 287
+L116: .string "jefim"
+L117: .string "nbxemxdpocc"
+cmp #166, r7
+L118: .string "bqbzmtwzman"
+jsr *r0
+jmp L147
+add *r0, *r1
+L119: .string "ftcnqpxagqxfwrqpz"
+L120: not L65
+add L21, r7
+L121: .data 126, -585, -469, -269, 893
+L122: .string "wft"
+L123: .data 64, 377, -926, 508
+L124: .string "bvutqdkoirkzafiwf"
+L125: sub L263, r0
+L126: .data -861, -993, -155, -189, -923, 178, 885
+L127: .data 276, 354, 523, 575, 517, -900
+L128: .string "puocyz"
+L129: .string "usrejjiwss"
+L130: inc *r1
+jmp *r5
+L131: .data 474, 424
+; comment
+add r3, L146
+L132: .string "quobynifiispzlizr"
+lea L23, L90
+L133: .string "kedvewdqgvufbynfrwcm"
+L134: .data -77, -943, -431, -291, 91, 768, 864
+L135: .string "lqhniizxdbjsqewry"
+clr r7
+L136: .string "uknpqgeymmqcqcxeekbpqzdv"
+sub #0, L22
+L137: .string "wazaedxvzklfzmfeqel"
+L138: .string "qe"
+L139: .data -977, -944, 545, -959, -235, 798, 973, -414
+L140: .string "dpzdlpuzwvigngne"
+L141: mov *r1, r5
+jsr *r4
+L142: jsr L318
+L143: .string "pynrhawwbnbtkvf"
+L144: .data 542, -752, 183, 465, 92, 400, 971, 755
+L145: .string "pzqbysvp"
+L146: .data -137, -216, 780, 418, 900, 225, -177
+L147: .string "jomrhjzk"
+L148: .string "azxfonjbtxnwdzyyqbxtw"
+L149: not r6
+L150: .string "eiutoovmdhrjczzsbweh"
+L151: .string "sgnvipsfoesvetbfojhoh"
+L152: red L331
+cmp *r5, L333
+bne L255
+not *r6
+
+; comment
+jsr L310
+jmp *r0
+L153: .string "hrozkturbdwivox"
+stop
+L154: .data -94, 553, 456, 133, -500, -668
+clr r6
+add r3, *r3
+L155: .string "wmclzvuxeyqdcuwr"
+L156: .string "hwtzoexr"
+L157: .string "esulhzaohvoppqsueuimtz"
+L158: .string "eljjbqeongezt"
+L159: .data -235, -17, 242, -563, 770, -53, 359
+lea L169, L58
+stop
+mov r6, L1
+sub r3, *r1
+L160: .string "btayhwzndlier"
+prn r4
+L161: .data 872
+L162: .string "jwsh"
+L163: .string "e"
+clr L189
+L164: .string "jnqyormvicpfmui"
+sub L260, L42
+stop
+L165: .data 419, 0, 484, 165, -191
+L166: .string "ldvwqo"
+L167: .string "omaynukvadczjjkxtv"
+L168: .string "kudqcm"
+L169: .string "dynevqxhdninlxydaxkgney"
+clr r0
+L170: .string "rnmkqjyzjxmyucdv"
+L171: .data 196
+cmp #-45, L28
+L172: .string "xdqptyagtvbg"
+L173: .string "kvsrkanitwcxgehbfen"
+stop
+lea L111, r7
+L174: .string "fjalkoixocxwtnephumf"
+L175: not *r1
+L176: .data 72, -663, 371, 265, 851, 940
+L177: .string "buzypcmmtbkcvi"
+prn L40
+L178: .string "in"
+L179: .string "kncoovhodseodpplyr"
+jmp L219
+L180: .string "tltynpt"
+L181: .string "gbzebcja"
+L182: .data -792, -495
+L183: .string "swusra"
+L184: .data -790, 558, 284
+mov *r1, L225
+L185: .data 526, 741
+; comment
+L186: .string "egiycbwnqmiijnifrr"
+L187: .data 755, 663, -748, 22, -995, 972
+L188: lea L222, r2
+L189: mov r7, L324
+L190: jsr *r2
+L191: red *r6
+L192: .string "cylkokehsuigiygxbsln"
+L193: .string "oyeqbzkdjzkaumszi"
+L194: .string "ambgwndsnttbvaqiolrb"
+prn r2
+clr r2
+L195: .string "abikcydzulqxzsjr"
+sub r4, *r5
+L196: .string "feirfapsy"
+L197: .string "vivichiecl"
+L198: dec r6
+rts
+dec *r0
+L199: .data -428, 763, 469, -291, -207, -456, -25, -137
+L200: .string "pfbjfmhbcbxpqjw"
+L201: .string "zutwmoflarc"
+cmp *r1, L327
+L202: .string "izjbwx"
+L203: .string "mluwg"
+L204: .data -495, -713, 515
+L205: .data -459, -722, -838, -999, 222
+L206: .data -817, -455, -306
+sub #-49, *r5
+bne L211
+L207: .data -811, 644, -11
+L208: .data 700, -785, 703, 943, 882
+L209: .string "cdcscvux"
+L210: .data 805, 524, 657, -155
+L211: jmp L260
+
+L212: stop
+L213: .data 656, -140, 841, -277, -544
+L214: .string "hwhgxuosrk"
+dec r2
+L215: .data 460, -176, 883, 463, 548, -8, 881
+L216: .string "dvogdummajp"
+L217: .string "hdxpbptxeaj"
+L218: .data 57, -320, 729, -507, -796, 513, -684, 137
+lea L228, r7
+L219: .string "vofhwtbi"
+L220: .data 989, 347, -128, 988, -757, 297
+red *r6
+red r2
+red r3
+jsr L53
+L221: .string "uunxbgynugbct"
+add *r4, r4
+L222: .data -651, -39, -923, -915, -839, -863, -395
+L223: sub #98, L328
+L224: .data -681, 217, -596, -482
+L225: inc r4
+stop
+L226: .data 357
+; comment
+L227: mov L284, L217
+L228: .data -549, 541, -210, -238
+L229: .string "iyldx"
+L230: .string "hsqteckdug"
+L231: .data -995, -265, 264, -479, 949
+L232: .string "xerbdx"
+L233: .string "phtcoixachpxbv"
+
+L234: .string "piywliyys"
+lea L286, *r5
+red r4
+L235: .string "rlkifeqjzcozsd"
+L236: .data -787, 590, 818, -464, -179
+rts
+lea L285, L16
+rts
+L237: bne *r4
+L238: .data 971, -956, -77, 313, -990, 452
+L239: .string "ulylfplxzozcupajvmksxnn"
+jsr L121
+L240: stop
+L241: .data 467, -359, 990, -184, 930, 255, 820
+inc r0
+L242: .data 574, -443, 429, 420, 91
+lea L310, L271
+L243: .data 914, 988, 955, 673
+L244: lea L137, r2
+L245: .string "yapkoxvtoocgflrmrcjjdfg"
+bne L272
+L246: .string "vydwatguyntnr"
+L247: .data 846, 539, -43, -995, 819, -587
+L248: .string "zjocwykxuzcckrkkaknx"
+L249: .string "dqkiyqiykvtqdgghbxt"
+add #-111, r4
+L250: .data 746, 773, -31, -224, -856
+L251: .data -732, 862, 78, 956, 389
+L252: .string "opdvpeuuwhahlhyvrdzahh"
+L253: dec *r1
+L254: jmp L329
+add r0, r4
+L255: .data 629, -605, 732, 186, 364, 455
+L256: .data 623, -304, -24, 457, 771, -434
+L257: .data 829, 281, 837, -546, 466, -931, -645
+inc L133
+L258: .string "awmzktglknfbclvkkjw"
+clr r6
+rts
+L259: .string "qwqjlnyhutodbtyveg"
+sub r4, r2
+L260: .string "vhqwrq"
+L261: .string "rfotskcpcxaawxwj"
+L262: .string "kmkyslqarx"
+L263: .data 156, 430, 846, -948, -881
+; comment
+lea L112, *r0
+L264: .data 234, -786, 211, 442, 840, 152
+L265: red r5
+L266: .string "oslurbpcbfvmrlvio"
+mov #217, *r7
+L267: .string "ywh"
+L268: .data -4, 815, -990, 90, -206, 633, 238
+L269: .data -166, -860
+L270: .data 644, -729, 213
+L271: .data -40, -522, 464, 679, 618, -312, -176, -619
+L272: .string "bnxxklyiykccnlibqcxnf"
+L273: .data -638, 74, -626, -361, -428, 294
+L274: .data 197, 134, 13
+L275: .data 895, 785, 183
+lea L149, L146
+L276: .string "okh"
+L277: .string "hugoowds"
+L278: .string "twapqnmbuofhvyk"
+jmp L237
+L279: bne L68
+L280: inc r6
+L281: .string "sdvoesywkflfftxzgwmbqdvy"
+inc *r6
+dec L289
+L282: dec r2
+L283: .data -496, 625, 454, -139, 369, -177, -957, -146
+; comment
+L284: .string "lhyvmmfnxyytgibewwlqew"
+jmp L56
+L285: .data 120, -939, -115, -796
+L286: .string "vdcvyvlundscaybrl"
+dec r6
+L287: .data 864, -339, -289, 543, -62, -580
+L288: .string "wumquxsbanwy"
+L289: .data -312, -791, 229, 31
+prn L292
+L290: .data 573, 351, -869
+L291: .string "eumyyjsmjhta"
+L292: .string "oiamzufwvyibcfsptc"
+L293: .data -189, 119, 593, 994, -994
+L294: .data -829, 57, -49, -646, -80, 223, -456, 36
+L295: .string "kkpuem"
+dec L312
+L296: .data 801, -569, -947, -282
+mov #-152, L104
+
+L297: cmp r2, L331
+clr r6
+; comment
+not L311
+lea L164, r3
+clr L110
+clr L143
+L298: .data 358, 155, -579, -179, 294
+jsr L330
+L299: .data 0, 571, 351, -21, -830, -701, 892
+L300: .data 879, 999, -320, 538, 44, 413, 659
+L301: clr r5
+L302: .string "mmbxrlazxccyofkinjb"
+stop
+bne *r7
+L303: .data 521, 684, -98, 162
+red L256
+L304: .data 37, 861, -456, 948, -449
+L305: .string "aaeymhqxjejkgigrgughnwc"
+L306: .data 246, -473, -300
+L307: .data -665
+L308: .string "hhnaydvhwonasysovv"
+L309: .data 639, 800, 738, 899, 914, 605
+L310: .string "bvt"
+L311: .data -593, -280, 268, 967, 412
+L312: .data 410, 726, 218, 426, 790, 573
+rts
+L313: .data 304, 327, 827
+L314: .data -774, -109, 121, -872, -918, 333, 612
+L315: .string "vol"
+
+L316: .data 328, 189, -492
+L317: red L333
+L318: .string "cszwrnubpkxgmsiiahhtv"
+L319: .string "i"
+L320: .data -622, 345, 811, 509, 0, 334, 940
+L321: .data 485, 106, -699, -730, -29, 955
+L322: rts
+L323: sub #-224, *r6
+mov *r2, *r1
+L324: .data -797, -622, -340, -597
+red *r1
+L325: .data -921, 97, 887, 266, -164, -690, -340, 278
+L326: jsr *r7
+prn L329
+L327: .data -323, -457, 937
+L328: rts
+L329: .data 757, -858, -641, 596, 416, 816
+L330: .string "jbzbpzaz"
+L331: .string "csoqddtmgxjlmucdyvfsu"
+L332: .string "hkfsbdmztsgofooowbzoszq"
+prn #76
+rts
+L333: .data 993, -432, -940, -558, 255, 120, -778, -551
+L334: jmp *r4
+L335: .string "rdoflodggeayiyhfotttr"
+L336: .data -555, 213, -331, -829, -353, 316, -932
+L337: .data -783, 810, -31, -975, -271, -835
+L338: .data -398, -192
+cmp #36, L339
+L339: mov #-109, *r5
+stop
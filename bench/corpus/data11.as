@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 12
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+L0: .data 524, -63, -816, 108
+L1: .string "oitrakwamoawzkc"
+L2: .data -160
+inc r2
+L3: .data 823, 833, 563, 439, 571, -866
+L4: .data -326, 895, 304, 738, 322, -806, 838
+L5: .data 597, -352, -398, 209, 769, -492, -840, 89
+L6: .string "odyygqx"
+L7: .string "pmkaqclvwneqabnecbc"
+lea L226, r4
+jmp L55
+
+prn #136
+
+prn L1
+rts
+L8: .data 227, 561
+L9: .string "psnhpmzoqgtd"
+L10: .string "bhjlcqzhqdivmaqconz"
+L11: .string "fpzubq"
+L12: .string "cewoxacsyfycr"
+L13: lea L1, L7
+cmp L57, r2
+L14: prn r6
+lea L3, L203
+L15: .string "zovlkiefyaw"
+L16: .string "jjlrmtgkpovubarileyrfvs"
+L17: .string "hkjryai"
+L18: .data 177, 761, -967, 308, -948
+L19: .string "nosyffbjblinu"
+L20: .string "jfkptubo"
+jsr *r3
+jmp L70
+L21: .string "a"
+not r1
+clr r1
+jsr L68
+L22: .string "zqu"
+
+L23: .data 74, 496, -318, -12, 477
+L24: .string "ozpzy"
+L25: .data -644, -70, 175, 823, -140
+stop
+cmp L17, r3
+L26: .string "feulpxtjvlhqqnsiglup"
+L27: .data -734, -950, 702, 566, 887, -53, 209, -748
+L28: .data 212
+L29: .string "sdbww"
+L30: .string "vomrpxnc"
+L31: .data -686, 731
+L32: mov *r0, L6
+jsr L25
+bne L78
+L33: add L14, r7
+L34: .data 798, -275
+rts
+L35: .string "xtckbsciqvxcxpzshdftzdrt"
+rts
+; comment
+rts
+
+dec r1
+L36: .string "ejkvunrklsftrvbor"
+rts
+L37: .data -226, 645, -376, -947, 33, -780, -668
+L38: .data -687, -245, -637, -531, 626, -965, -519, 145
+L39: .string "hzxpyiusclmtvylq"
+dec r5
+L40: dec r1
+jmp L261
+rts
+sub #114, L14
+L41: .string "mtxnnvmng"
+L42: .string "nmbpnpqo"
+L43: .string "yfxtqurnmwhcjipbjuv"
+sub *r5, *r7
+stop
+L44: .data -713, -663, -215, -231, -162, -124
+clr L24
+dec r0
+L45: .data -150, -54, -432, 824
+L46: .data -670
+L47: .data 381, -985, 733
+L48: .data 622
+L49: .string "ofy"
+; comment
+cmp *r1, L35
+bne *r4
+L50: .string "xfkp"
+L51: .data 252, 505, -740, 571, -7
+L52: .string "srme"
+L53: .data 468, -787, -919, -434, -894, 511, 227
+L54: .string "brleebcnkqfbxl"
+L55: .string "xuams"
+rts
+prn *r6
+L56: .data -866, 586, 867, -623, 913, 662, 856, 569
+inc *r1
+L57: .string "yxagnkjbcxbyke"
+L58: .string "pgabnwzfissg"
+L59: .data -114, 589, -816, -522
+L60: .string "dlaqnhewinpmwdays"
+L61: .data 315, -166
+cmp *r0, #231
+jmp L244
+L62: .string "alnozexodlewhfpk"
+L63: .data -936, 713, -227, 359, -492
+prn L18
+stop
+prn *r5
+L64: .data -419, -594, -961, -412, 7
+L65: .data -638, -620, 373, 658, -940
+L66: dec *r7
+L67: .data 682, 85, -452, -684, -359, -491, -441
+L68: .string "ojpihasgutndxaurmrcxox"
+L69: .data 52, -857, -932, 827, 522, -741
+stop
+red *r3
+not *r2
+lea L25, *r5
+L70: .string "c"
+rts
+L71: .data 689, 707, -505, -708, 697, 661
+L72: .data 764, -171, 939, 293
+clr *r6
+lea L99, r7
+L73: .string "fgsytjqzexozyngjs"
+L74: .data -729, -946, 97, 702, -719, 795, -706, 574
+L75: .data 356, 261, -938
+mov r0, *r5
+L76: stop
+; comment
+dec *r2
+L77: .data -894, 370, 529, -447, 887
+L78: .data -599, 553, -238
+; comment
+L79: .string "puqnelsqwmkadttkzme"
+L80: .data -883, -592, -574, 160
+L81: .data -335
+L82: .data 70, -722, -861, -716, 700
+; comment
+L83: .string "dzhrwh"
+lea L82, *r1
+jsr L14
+clr r4
+L84: .string "qduuuomvuxajmnervcrb"
+L85: .data 327, -471, -258, 36, -806, -408
+L86: .string "nvvamfe"
+L87: .string "tmnmkjmy"
+L88: red r3
+L89: .string "imobdlvkrdevjronzt"
+
+L90: .string "mdvpbbbtbgvveyexpwi"
+stop
+L91: .string "clgvdonqbd"
+L92: .data -568, 114, -344
+L93: .data 654, -749
+L94: stop
+L95: .string "x"
+jsr *r2
+jmp L72
+L96: .string "kqq"
+L97: .string "yyvjvzxunagooj"
+jmp L274
+L98: .string "ziisx"
+jmp L247
+L99: prn *r5
+lea L34, L57
+L100: bne L283
+L101: .string "oqbhbu"
+
+jmp L165
+L102: jsr *r4
+L103: .string "gwykd"
+L104: .data -58, -352
+cmp *r2, #148
+L105: .data 307
+L106: .data 845, -268, -924, 628, 231, 598, 395
+L107: .data -160, 160, 617, 692, -475
+L108: .string "oytzos"
+L109: .data -375, -616, 196, -361, -371
+L110: .string "dtuhrsoadg"
+L111: .data 690, 792, -745, 520
+; comment
+; comment
+dec r2
+
+L112: .data 408, 158, 193, -405, -642
+mov #-203, L167
+L113: .string "jvujeomepkma"
+not *r3
+L114: .data -296
+L115: .data 112
+rts
+L116: .string "bmgbempvjjht"
+L117: .string "vkj"
+sub #113, r2
+L118: .string "lzkllbkycrnb"
+L119: .data -684, -897
+L120: .data 280, -539, -892, 42, -139
+cmp L112, *r2
+L121: .data -507, 818, -808, -887, 201
+L122: .data 404, 129, 703, -780, -176, -863, 289, 591
+L123: .data 263
+L124: .data 330
+L125: .string "cthyrxcnbdzuqlymjd"
+L126: .data -736, 448, 30, -183, 842, -590, -678
+L127: .data -464, -856, 62, 460, -596, -63, -671
+L128: .string "ams"
+red L160
+red r0
+L129: .data 476, 915, 323
+L130: .data -745, 251, -558, 626, -213, 514, -739, 808
+L131: .string "hzlallltnzwptoxxofbzffi"
+L132: .data -46, -424, 878, -979
+jmp L13
+inc *r3
+clr *r0
+L133: .string "qfyknuitfhazvhhcvb"
+clr L19
+sub *r5, L74
+L134: .string "taefhkemrkuoueywxdnuw"
+
+lea L292, r4
+; comment
+L135: prn r6
+L136: .data 122, 916, 858
+not *r1
+L137: .string "svn"
+L138: .data -352, 541, -831, 371, 800, 194
+jsr L260
+L139: .data -266, -806, -870
+red r7
+L140: mov #228, L98
+rts
+L141: .string "qtftzye"
+sub r4, r0
+L142: .data -800, 652, 986, 337
+
+L143: .string "luti"
+L144: .string "ixwfhcsmtoy"
+L145: lea L240, *r7
+L146: .data 957, 59, 727
+L147: .string "nqfnltwbyxsjsolcovxqo"
+L148: jmp L271
+L149: .string "ym"
+prn #208
+dec *r1
+L150: .data 638, 176, -842, 825
+L151: .string "cwqkeajpjdsnniyujb"
+mov *r5, L87
+L152: .string "ehnycdsncueqerbhldcyv"
+L153: .data 491, 922, -198, -678, 463, 65, -621, -204
+L154: .string "isy"
+cmp r2, #161
+stop
+L155: .data -134
+L156: add L244, r1
+L157: .string "kgflwo"
+L158: .string "wbxnfprajnu"
+L159: lea L84, r6
+L160: .string "ktgqcntdviag"
+L161: .string "fdkmfxc"
+L162: .string "nzfnntauezcawaijnuld"
+L163: bne L32
+L164: .data -180
+L165: .data 994, -105, 741, -789, 438, 342, 805, -535
+bne L124
+L166: .data 166, 80, -302, -202, -712
+L167: .string "l"
+L168: .data 533, -992, -739, 462, 453, 940, -343, -267
+L169: .string "azkmhusrm"
+L170: .data 406, 44, 108, 300, 677, 877, -790
+L171: .data 38, 739, 736, 971
+stop
+clr r0
+L172: .data 545, 202, 471, 514, 606, -73, -604, 860
+jsr L252
+; comment
+L173: .string "wffesisbltmzmtzxems"
+prn r4
+L174: .data -806, 697, 700
+L175: .data -708, -118, -880, -642
+L176: .data -619, 505, 729, -310, -56, -410
+L177: rts
+L178: .data 736, -382, 494, 635, 521, 858, 913
+not *r4
+L179: .string "w"
+L180: .data 940, -40, -406, 806, 887, -354, 102
+L181: .string "tvmviwoqobvq"
+L182: .data 471, -381, -992, -355
+L183: .string "ma"
+L184: .string "vqidznsgbocttrylfgqacs"
+L185: .data 34, 860, 86, 128, 631
+L186: .string "xaejawqcjlxsetwcxxwlctr"
+L187: .data 913, -629, -740, 968, -660, 35, 15
+cmp L102, L44
+L188: .data 348, 708, -286
+L189: lea L202, r2
+L190: .data -683, 933, 156
+cmp #-156, L107
+rts
+L191: .data 924, 332, -107, 589, -153, 215, -412, 425
+L192: .string "xoolcrbjwbsqbr"
+L193: .string "m"
+L194: .data -964, 294
+sub #114, L267
+L195: .data 22, -191, -593, 830
+L196: .string "mucwfsdbiexbjwhpekuv"
+L197: .data -98, 863
+clr r6
+L198: .data -991, 344
+L199: .string "paedsjpjrnagxhngnwstjv"
+L200: .data -159, 788
+L201: .data -121, 881, 964
+mov L97, r2
+not *r6
+L202: .data -317, 635, 699, 764, 461
+L203: .string "lvbsovodcbhudyenahpvmi"
+L204: .string "cqtuvh"
+L205: .string "mxtovjaiguyqvxiqrnsq"
+L206: bne L256
+L207: add *r3, L200
+bne *r3
+L208: .string "bzlzbmetgcosabkqfdaygkn"
+L209: .string "rdkhyclswjxubeocmn"
+L210: .string "nbdxtfmiwskqvilynpzmm"
+L211: .string "wwtktfrqfq"
+L212: prn #39
+L213: dec r3
+inc *r6
+L214: .data -187, -470
+L215: .string "vyhfrlszyjfqwmldgaxollj"
+L216: .string "szicibktpnynrc"
+L217: .data -269, -757, 292
+L218: .data 514, -772, -418, 408
+L219: .string "smcvnambkhauqbpczcxcxg"
+L220: .data -888, -409, -2, 731, -815, 352
+L221: .string "ufqmejilgrebjtxxdynlw"
+L222: .string "jcskwpkxsktlxplqlfmgdne"
+L223: rts
+clr L306
+rts
+L224: .string "srvzb"
+L225: .data -558, 397, -333, 693, 775, -319
+L226: .string "zkvzlpr"
+stop
+L227: .string "yhbszbciel"
+L228: .string "wtdljqylxiipjnf"
+bne *r6
+L229: .string "rhbayemevm"
+L230: .string "sxgjxbvykbfnl"
+
+L231: .string "ckrszsz"
+lea L110, r6
+L232: mov *r3, *r5
+L233: clr *r7
+L234: .string "temtjibxeuy"
+L235: .string "nnfimazkowyuxbfzwsdjzab"
+mov r1, L62
+L236: .string "nhakz"
+rts
+prn r1
+L237: .string "mfiagfkajn"
+
+L238: add #-236, L112
+clr *r2
+L239: .string "vjcxonicfxdnlfrdhwvbxpkh"
+L240: red L2
+L241: .string "czkgjkhacn"
+L242: .data -904, 356, -587, -548, 563, 882, 262, -757
+stop
+L243: .data -894, -252, 297, 658, -222, -283
+; comment
+L244: .data -513, 890, 929, -45, -881, 514, 1, 728
+red L285
+L245: .string "wztokxpskehllekddbw"
+L246: .string "njkpikoqzge"
+L247: .string "hxzjvwjjraxhvxfnbbjv"
+L248: .data 677, -734, 780
+; comment
+not *r4
+cmp *r6, L279
+stop
+sub r7, *r3
+
+mov L121, *r6
+L249: .data 419, 69, -372, -547
+L250: .data -9, 890, 616, -75, 424, -497, -884, -731
+inc r7
+L251: .data 751, 24, -307, 313, 479, -290, -599, -964
+clr *r5
+L252: .data -154, 941, -860, 818, 560, -187
+rts
+jmp *r0
+lea L71, L301
+L253: .string "xkhufyxv"
+L254: .data -56, 962, -101, -565
+L255: .data 649
+L256: .data 347, 457
+inc L17
+L257: .data -158, -524, 459, 817, 685
+L258: sub *r3, r1
+L259: .data -40
+L260: mov #93, r5
+
+prn *r6
+L261: .string "cgiirzkaj"
+L262: .data -879, -444, -539
+jmp L289
+L263: .data 155, -391, 391, -343, -447, 491, 31
+clr *r0
+L264: .string "vjllmp"
+L265: .data 732, 959, -820, -173, -249, 718
+sub *r2, *r3
+inc *r0
+sub r7, L231
+L266: red r0
+L267: .data -763, 727, -273
+L268: .string "ffrj"
+L269: .string "anxslfwvyemsbcfqaglupi"
+lea L306, *r1
+add #-214, *r5
+L270: .data 544, 693, -321
+L271: .data -933, 650, 89, -718, 544, 737, -178
+L272: .string "efkttjnwgdujmh"
+sub #125, *r1
+L273: .data -404, 230, -575, -356
+L274: .string "am"
+L275: .data 598, -552, 185
+L276: .string "kcrcik"
+clr r7
+L277: .string "jnzmxfxfsioahlstomqbggr"
+add r0, L284
+rts
+L278: .data -96, 961, -107, -625
+L279: cmp #-14, #197
+mov r3, r0
+not *r4
+L280: .data -871
+clr *r6
+bne *r4
+L281: .data 647, -859, -145
+lea L293, L310
+L282: .data -993, -810, -716
+cmp L302, *r4
+L283: .data -987
+red r5
+L284: .string "grrtmbfkmiyzfkyimwckqsmt"
+L285: .string "upcposxlzcoqvalmrpbmh"
+L286: .data -792, -695, -654
+L287: .data 809
+L288: .string "sycthxtnp"
+L289: .string "frdqhjxgtgjrze"
+L290: .data 966, -545, -130, -454, -864, -827, -789
+L291: .string "swslknvne"
+L292: .string "asxzpsu"
+L293: .data 787, 858
+sub L309, *r5
+L294: jsr *r6
+L295: .string "lysnneejhwkpse"
+L296: .data -311, -665, -993, -81, -682
+jmp *r5
+L297: .data -496, 574, -553, -996
+red L126
+rts
+prn L175
+lea L158, r2
+L298: .data 551, 374, -467
+sub *r0, L311
+L299: .data 745, 279, -490, 0, 326
+L300: .string "cnyx"
+rts
+cmp #-140, *r5
+L301: .data 22, -620, 806
+L302: .data -132, 21, 191, 917, 366, 474, -923
+L303: .string "fqbybfecrcweifl"
+jmp *r1
+L304: .string "fpbkzvartlvwfgebbfiukyit"
+L305: .data -490, 384, 605, -569, 274, -235
+mov r1, r1
+L306: add r3, L156
+clr r0
+jmp *r3
+L307: .string "lvzwd"
+L308: .data 868, -354, -884, 36, -778, -572
+L309: jsr L191
+
+rts
+lea L304, L312
+L310: .string "afyeos"
+dec r1
+cmp r2, #-141
+rts
+L311: .string "eksggudvlsbojzlogofxlfh"
+cmp L312, *r2
+
+L312: .string "qtqrbnvyjxs"
+
+L313: .data -673, 541, 252
+stop
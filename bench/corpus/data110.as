@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 111
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .data -538, 412
+L1: .data -211, 352, 83, -712
+L2: .string "wfckrwbukjmlsumenti"
+L3: .data 837, -30, 387, -166, -638, -129, -460, -948
+L4: .string "ka"
+red r1
+L5: .data 869, 393, -81, 524
+L6: .string "ugntsnnjmhziakqojd"
+L7: rts
+
+sub #-115, r5
+L8: .data -12, 764, 866, 940, 193, 996
+clr L300
+L9: .string "qvenvxxzmsvbdnqnwii"
+L10: .data -134
+bne L12
+L11: .data 12
+L12: .data 563, 829, 525, -66, 603, -302
+L13: .string "uvryxrymmsvwaj"
+red *r3
+L14: .string "uthjfnqetjvvcocvhq"
+prn *r7
+stop
+add r1, L6
+L15: .data 768, -247, -242, 758, -685, -316
+L16: .data -791, 684, -114
+red L5
+L17: .data 89, 658, 110, -605, -266, -741, -780
+L18: .string "lvozdeubj"
+rts
+stop
+red L261
+L19: .string "g"
+L20: inc L231
+L21: .string "bsoauiwnisqycohs"
+L22: .data 768
+prn *r0
+L23: rts
+L24: .data -427, -351, 582, 605, -687, 409, 46, -492
+L25: .string "v"
+L26: .data 693, -11, 601, 829, 351, -693, -410
+stop
+stop
+L27: .string "pdstnomfj"
+not r7
+L28: .data 92, -454, -255, -477, 795
+lea L89, *r3
+prn r5
+L29: .string "czehuagnx"
+jsr *r1
+add L206, r2
+; comment
+L30: rts
+L31: .string "vlgp"
+L32: .string "clzujdcsicrtunqyv"
+jsr L20
+red r6
+L33: .data -915, 502, -143, -620
+bne L273
+L34: .data 906, -39, 454, -333, 368, -33, -603, -729
+lea L1, *r3
+not L10
+L35: .string "klmjbnjov"
+inc *r0
+L36: clr *r1
+L37: .data -297, 962, -407
+L38: .data 837, 894, -68, -319
+L39: .data 37, -571, 136, 668, 989
+jsr *r0
+L40: .string "uguxkqytogyec"
+stop
+L41: .string "bzjvmxx"
+L42: .data -410
+L43: .string "ueavoqikumurhuan"
+L44: .data 576, 345
+L45: .data 107, -847, -513, -950, 67, -702, 422
+L46: .data -205, 908, -939, -913, 147
+lea L25, r0
+L47: .string "epgtjdku"
+L48: .data 530, -119, -162, -476, -335, -636, -181, 525
+L49: .string "ulbnljl"
+L50: .data 283, -537, -372, 38
+dec *r7
+prn *r4
+dec L90
+L51: jsr *r5
+L52: .string "qlzvyzcbaqpig"
+dec L79
+L53: .data -784, -132, -400
+not *r5
+L54: .data 81
+L55: lea L201, *r3
+L56: .data 934, -524, -372, 234, 63, -660
+L57: .string "goeilzivkgdrcgnndcsjwm"
+L58: .data 871, -463, -159, 297, -93
+L59: .data -361, -887, -40, -826, 280, -112
+L60: .data -348, -494, 272, -743, 555, -89
+L61: .string "enuiwayhjlstn"
+stop
+L62: prn *r7
+L63: .data -138, 852
+stop
+L64: .data 707
+L65: cmp L52, L84
+clr L40
+L66: .data 245, -758, 79, 257, -92, -889, 842, -758
+stop
+sub L50, L37
+L67: .string "khvgxuvazwlkfvmhav"
+stop
+L68: add #36, r3
+L69: .data 645, 649
+not r5
+cmp #-242, *r7
+L70: cmp *r0, r1
+L71: mov L45, r0
+L72: .string "owspthrtywtg"
+L73: .string "kesidiko"
+rts
+L74: .string "xwwldgesxqedsqa"
+L75: jsr *r4
+L76: .data 833, -813, 941, 967
+cmp r3, r1
+cmp r3, *r5
+L77: .string "ms"
+L78: .string "mrhswzj"
+L79: .data -136, -549, -144, 857, 418, -479
+L80: .string "nkqqsda"
+L81: .data 639, -149, 135, 316
+jsr L14
+not L42
+L82: .data -314, -199
+L83: .string "pbt"
+L84: .string "xunhoqhwjjbclm"
+L85: .data 95, 629
+L86: .data -176, -557, -838, -31, 800
+L87: .data 114, -68, 692
+add r5, r4
+L88: .string "wulqqkiglram"
+add #-130, *r4
+L89: .data 335, -557, -548, -316, 462, 988, -411
+clr L182
+stop
+jmp L178
+sub *r0, r3
+L90: .data -586, 208, -828, -741
+rts
+L91: .data 830, 963, -596, 314, -929, -150, -77, -437
+inc r3
+dec *r1
+L92: .data 524
+L93: .data -90, -897, -544, -105, 188, -661, -160
+L94: .string "hikoanhi"
+L95: .data 102, 929, -445
+prn *r1
+L96: .data 796
+L97: .string "pxyheoycyxfetoodobnivdp"
+L98: .string "m"
+prn r5
+red L306
+L99: .data -347, 519
+inc *r6
+L100: .data 223, -694, 972, -219
+L101: .string "dubhacvcglvgnjlhjomih"
+L102: .string "kouelmnvciwfkckdprphd"
+; comment
+L103: .data -148, -707, 130, -353, -412, 373, -283
+inc L55
+jmp L142
+L104: .string "jjfljbxudygckaoncdn"
+L105: .data 551, 758, -611, -236, -307, -755, -203
+L106: .data -383, -589, 353
+inc *r3
+L107: .data -449, -996, -502, 462, 429, 746, 240, 498
+L108: jsr L201
+L109: .data 988, -66, 163, 301, -326, 318, 780, 972
+L110: .string "frbfxohjkyk"
+L111: .data 240, -543
+L112: .string "zxehcmpg"
+L113: .data -241, 734, 469
+L114: cmp L19, L9
+L115: .string "cyxgwzjly"
+L116: .data -923, -121, -570
+inc *r4
+L117: .string "ckjuvvrydzd"
+L118: .data -800, -196, -649, -189, -900, 564, 325, 168
+L119: .string "v"
+sub #241, L321
+L120: .data 129, 611, -21, -963, -942
+L121: .string "vrhqorbqmuvafrgnwqpdpry"
+L122: .data -991, 439, -738, -38
+L123: .data 83, -271, -783, 507, 784, 204, -611, 375
+L124: .data -972, -8
+rts
+L125: .data 900, 827, 850, -663, -429, 192, 963, -131
+L126: .data 842, 432, -871, 473, 353, 322, 50, -993
+L127: .string "eposhciwzoatoeuvhqy"
+L128: .string "kvjsvsur"
+dec L216
+L129: lea L263, r0
+not *r0
+L130: .string "eeugfhxugpveskzdnybmslk"
+stop
+L131: stop
+L132: .data -892, -746
+L133: .string "qezhjwvyycyl"
+L134: .string "pyeufrxjihtqcodutzkck"
+inc L157
+L135: .data -455, 273, -731, -199, 96, 402
+rts
+L136: jsr *r4
+rts
+L137: .data 873, 888, -617, -602, -813, 180
+sub r1, r2
+
+L138: .data -610, 365, 957, 631, 680
+add r6, r3
+L139: inc *r4
+L140: .string "xffkqmyecdufksqskeaym"
+lea L10, r2
+L141: .data 51, 278, 532, 658, -550, -909, -315, -896
+L142: .data -372, -738, -399, -38, -207, 992, -90
+L143: not L201
+L144: .data 183, -809, 119, -976, 283, 338
+inc *r5
+
+L145: .string "jybbydydwkdyhrbdkwrbs"
+L146: .string "kjkxhhbelncrlqup"
+L147: .data -199, 79, 531
+sub *r5, r6
+lea L7, r3
+cmp L273, r7
+sub #85, *r2
+L148: .data -481, -921, -762, 407, 398
+L149: not L27
+lea L218, r1
+; comment
+inc *r6
+L150: .data 239, 506, -483, 840, 19, 515, -862, -9
+jsr L269
+L151: .data 738, -275, 422, -100
+L152: .string "kyychckeduuztdsaaui"
+L153: .string "afhazaeaamycdujhshdgr"
+red *r4
+L154: .string "rtexnoovkgxzcnkxty"
+L155: .string "sdlipzuppszcuodmarhbsp"
+L156: .string "j"
+L157: .string "purtxtwpiplepqhamnsdv"
+L158: not L237
+L159: stop
+L160: .string "xdwleerg"
+red r7
+prn L254
+L161: .string "pnlum"
+
+; comment
+L162: .data -448, 368, 958
+L163: .data -329, 96, 153, -59, -922, -290
+dec r4
+rts
+L164: .string "ggngolddepbvkv"
+L165: .string "stdjwhzasgixbl"
+L166: .data 891, 899, 978, -219, 496
+add *r0, r2
+L167: .string "ovvurpzahjvjetui"
+; comment
+L168: .data 429
+mov L13, *r4
+prn #-216
+L169: .data 641
+clr r4
+L170: .string "pachlfkchxsirurq"
+L171: .string "y"
+sub r4, r5
+L172: .string "dlndu"
+L173: .string "ucqsxi"
+L174: .data -547, 681, -271, -757
+L175: .data -137, -137, 200, 792, -796
+L176: .data -404, -291, 887, -304, 765
+prn *r7
+cmp L71, *r6
+L177: .data -657, 55
+L178: .string "gwdqtp"
+L179: bne *r3
+L180: red r7
+jmp *r3
+not L97
+L181: .data 964, 641, 267, -409, -76, 115, 952
+L182: rts
+dec *r4
+L183: .data -986, -699
+L184: .data -492, 227, 233, 831, 869, -930, -693
+L185: .string "nkshadqzypdiyt"
+sub L156, r5
+red r1
+jmp *r6
+jsr L207
+L186: .data -370, 12, 669, 402, 512, -288, -232, 621
+L187: .data 587, -654, 826, -977, -933, 126, 702, -990
+L188: inc r0
+L189: .string "gicgwxjukeuupmb"
+L190: .string "twdsvguzwbqqjbqirlk"
+L191: .data -486, -705, -296, -131, 372, -806, -548, -674
+L192: .string "vbjgunqtxsusicwqwbvql"
+L193: .data -940, -644, 48, -810
+L194: .string "sdhbgm"
+L195: .data 725, 381, 641, -263, 70, 744
+L196: .data 590, -723, -705, 110, 529, 402, 508
+L197: .string "dgfmdoltvhnrzcvjqrxmdns"
+L198: jsr *r2
+L199: .data -470, -331
+L200: .string "lkdogwfprwhbmmdc"
+L201: .string "eojinfhpvlvfebtiptrq"
+jmp *r0
+L202: .string "lv"
+prn r0
+L203: .string "tudyfdqq"
+L204: .string "ekbtsxotjzfdlmyrut"
+dec *r3
+sub *r4, L288
+L205: .data -907
+add L226, L307
+cmp L295, L319
+L206: .string "xqnlbcnvmajhqplsbzyrq"
+L207: .string "psfho"
+L208: .string "yltmwvgwuzjofcv"
+L209: .string "wq"
+L210: prn r6
+prn *r6
+
+L211: .data 724, 871, -56, -796
+red *r3
+L212: .string "lxujgnrpvkgtchp"
+L213: .data -628, -632, -111, -597, -867, 163
+lea L264, *r3
+L214: .data 623, -934, -69, -335
+L215: .string "ukvogaerrvoatjy"
+L216: not *r2
+L217: .data 871, 984, 29, -867, 791, 234, 143
+L218: .data 558
+rts
+; comment
+sub L123, r7
+L219: .string "crzaehorpksugluqw"
+clr *r7
+L220: .data -954, -292, -357, -619, -348, -157, -179
+add L10, r3
+L221: .string "ras"
+L222: .data 968
+L223: .string "pv"
+L224: .data 409, 847
+L225: .data -576, 979, 298, -172, 56, 627
+L226: .string "pzmyroklxsgilhz"
+bne L308
+L227: .string "ipjkajpwwpibm"
+inc r3
+rts
+L228: .string "mx"
+L229: .data -76, -832, 462, -980, 752, 987
+L230: .string "onryizifhjwhqjyvawpaqhom"
+L231: .string "vslcp"
+L232: .string "nobfhdpzyxz"
+L233: .data -26, -260, -58, 942, 351, -141
+L234: .data 808, 307, 919
+add r4, r4
+L235: .string "pzq"
+L236: .data 696, -724, -879, -946
+L237: .data 886, 54, -787, -768, -274
+L238: .data 44, -57, 381, -969, 848, -877, 31
+L239: .string "uksal"
+stop
+L240: .data -725
+not L275
+L241: .data -283, 937, 666, -771
+; comment
+L242: .string "ashmlbswnnutianhha"
+
+L243: .data 516, 527, 515, 392, -260, 126, -647, 109
+L244: .string "uicnexakeedbvtcdzmp"
+L245: prn L301
+L246: .data 406, 715, -231, -171
+L247: .string "vi"
+not r4
+L248: .string "vp"
+dec r0
+L249: stop
+L250: .data -488, -692, -79, -99
+L251: .string "skuo"
+
+add r0, L259
+inc r6
+L252: .data -868
+bne L15
+L253: .string "czznymfjljzaydxcgoupfy"
+L254: .string "yjttylhcdyhwduhgbbo"
+L255: .string "hf"
+L256: cmp L114, *r3
+L257: .data -936
+sub #132, *r2
+L258: red *r4
+L259: .data 189, -17
+inc L95
+L260: .data -898, 501
+L261: jmp *r3
+L262: .data -559, -752, -120, 220, 218, -337, -299, 397
+add #24, *r7
+L263: .data 714, 591
+L264: .string "fsbbhnsy"
+rts
+prn #-168
+add #-168, L193
+mov r7, L4
+L265: .data 597, -279
+inc *r7
+L266: add L297, L268
+cmp *r5, r6
+stop
+L267: .string "xpiiwxep"
+L268: add r1, r0
+L269: .data 937
+L270: .data -381, 894, -725, -606, 613, 996, -987, -630
+L271: .data 106, 83
+L272: .string "myuaxdllxwjoszhpikpt"
+inc r7
+L273: .data 434, 57, 102
+L274: .data 433, -456, -561, -468
+add r2, *r2
+dec L243
+lea L223, *r4
+L275: .data 24, -717, -136, 680, 707, 575, 373
+L276: .data 423, 914, -442, -407, 89, -304, 392, 882
+; comment
+bne *r0
+L277: .string "kmbgaogt"
+
+L278: .data 434
+prn #-132
+L279: .data -637, 82, 567, 240, 353
+L280: bne L320
+prn #-57
+L281: .string "hnzeupkkocotenj"
+L282: inc L289
+inc r1
+L283: .string "qyi"
+stop
+L284: .data -487, -268, -996, -699, 633, -491, 536, 536
+L285: .string "zbgjxylxqsrja"
+add r5, *r7
+L286: sub #-65, L315
+jmp *r6
+L287: red *r6
+rts
+L288: .data -63, 26, -271, 535, -684, -359, 613
+clr L180
+L289: .data -195
+prn L78
+L290: bne *r1
+; comment
+L291: bne L103
+L292: .string "vpqhbyplfynwd"
+L293: .string "fhghxcgddssdmuh"
+L294: .string "vehduczuxub"
+L295: .string "x"
+L296: .string "duqucfhoifgovlp"
+L297: .data -10, -387, -833
+jsr *r5
+L298: .string "jgyjfrwuvoq"
+bne L59
+L299: .data -987, 391, -578, 948
+L300: cmp #136, r2
+L301: .data 51, -323, -798, 225, -696
+L302: .data -781, -417, -610
+L303: .string "kylvp"
+L304: inc r6
+L305: .string "yahojw"
+L306: .data -350
+L307: .data -8
+bne *r3
+L308: .string "obryykc"
+L309: .string "lgrcplalowpyoeikvnhuss"
+L310: .data -647, -227
+L311: .string "pjdtpnfllepo"
+L312: .string "bgyssinpw"
+L313: .data -920, -203, -261, 709, -802, 5
+clr L321
+L314: bne L128
+
+L315: .string "mkdiifkgdcxddtbjavzp"
+bne *r6
+L316: .data -586, 136, -340, 872
+L317: .string "au"
+L318: .data -967, -366, -519, 360, 469, -331, 750
+L319: .string "rkrmmjwpojmamj"
+L320: .data -322, -429, 903, -331, -718, -894
+L321: .data 975, 86, -613
+L322: .data 14, 914, -969, -561, -845, 354, -743, 569
+not *r5
+lea L308, L80
+add L115, L226
+not r6
+stop
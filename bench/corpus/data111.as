@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 112
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+rts
+prn *r7
+L0: inc *r1
+L1: .string "mxlsairvaarosooancmdfbfb"
+L2: .data -183
+not L1
+L3: .data -146
+L4: .string "cceqiofljhjx"
+prn #32
+
+L5: .data 291, 765, -301, -412, 159, 907
+L6: .data 721
+L7: .data 423
+L8: .string "ctoibs"
+L9: .data 39, 374, 38, -720, -684, -753, 523, 309
+jmp L8
+L10: lea L167, r7
+L11: .data 428, 791, 545, 979
+L12: .data 74
+L13: .data 614, 616, 202, 527
+L14: .string "hkhnjan"
+L15: .string "woewsgvylfygxogkdm"
+L16: .data -408, 339, 953, -128, -843, 886, -720, 948
+L17: .string "pacgpfuvkbtytop"
+L18: .string "rgtigfqsmsbqtwhgassy"
+L19: .string "mdagvugfujruxvnuqu"
+not *r7
+bne L41
+mov *r3, L205
+stop
+rts
+L20: .data -445, 966, 3, -437, 773, 294, 582, 205
+L21: .string "eabkcnroqppvtxrblqwmvqop"
+L22: .data 875, -35, 24
+L23: .string "erwdfobspzzbltydk"
+bne L128
+L24: .string "wrabwvx"
+red *r0
+L25: .string "rpfwrixdpxauahnl"
+L26: .string "vnqthh"
+
+cmp L21, *r4
+L27: .data 196, 962
+L28: .data -297, -423, 4, -151, 134, 288
+not *r4
+L29: .string "i"
+L30: .data -260, 99, 787, 926
+clr r2
+L31: not L13
+L32: lea L265, r1
+mov r5, L275
+L33: clr *r6
+L34: .data -945, 383, 483, -556
+L35: .data 192, -182, 328, 211, -708
+L36: .string "zhgnqljq"
+L37: .data 526, 315, 162, -254, 661, -188, -572, -659
+prn L162
+L38: .data 742, -973, -801, 333, 75, -631
+L39: .data -137
+L40: .string "emtchfmxqsluinzmcageyzb"
+rts
+L41: .string "vohctnuuxqracee"
+; comment
+L42: .string "yieohstptmdbuyobrshvg"
+jmp L40
+L43: .data -620, -532, 718, 472
+add L102, *r3
+L44: .string "lnzwvrdlymnjoltexbeogvz"
+L45: .data 923, -727, 298, 810
+L46: .data -603
+L47: .string "cwftnuborcoulqgfdzmfg"
+L48: .string "jabwgknzalrmecwm"
+L49: .string "qtzereorvwzhprvxmjmli"
+inc L39
+L50: .string "zfrlndnqyoymzqpelclrn"
+L51: .string "topnsrnfoqzdxdrgmuo"
+L52: prn *r0
+stop
+prn #-250
+L53: .data 233, 812, -399, -767, -87, -73, -265, 145
+
+
+jmp *r4
+L54: .string "zwdnmhgjodyapapiejcycy"
+; comment
+L55: .string "ox"
+L56: .string "gisafl"
+L57: .string "r"
+L58: .string "vdyddznpxpfjfahuc"
+rts
+L59: .data -577, -311, -617, 985, -399, -429, -326, -614
+L60: .string "wjptvcgjxdbhztturbu"
+L61: .data 952, -753, -240
+dec r4
+L62: .data 770, 128, -467, -371
+L63: .data -653, -607, 452, 55, 977, -891, -547
+L64: .data -823, -513, 824, 500, 925
+L65: .data -909, 747, -985, -217, 783, -296, -84, 628
+inc *r1
+L66: stop
+L67: .data -306, 697, 832, 767, -248, -530, 437, -586
+L68: .string "uqdxqgrbrfjhzvwoee"
+L69: .string "bitlkfcenqrbuvvm"
+L70: .string "zlvkkusgmzembsh"
+L71: dec L38
+sub #220, L68
+L72: .string "qlqwyxaofzect"
+clr L312
+lea L19, r3
+L73: .data 264, 202, -402, -936, 914, 785
+L74: .string "uflomgergrck"
+L75: .string "uky"
+L76: .string "keetkxianeql"
+L77: .data 606, 911, -928, -697, -682, -941, 666, -335
+L78: .string "qmojddaucgifowo"
+L79: .data 22
+L80: .string "wbd"
+L81: .data 398, -495, 187, -803, -612, 683, -99
+L82: .data 985, -455, -101, 884, 188, -591, -146, -767
+mov r2, *r3
+L83: .data -139, 881
+red *r5
+red *r4
+L84: .string "kmntuarwniku"
+L85: .string "qeqsxnwdndxvyswlnl"
+lea L234, L63
+stop
+L86: jmp *r0
+add L70, *r5
+L87: .data -370, -710, -196, -650, -399, 409, 783, -265
+L88: .string "qitkftdzwxhmabp"
+not L80
+L89: .string "cihadatn"
+L90: .string "faiz"
+not L14
+rts
+dec *r7
+L91: .string "jtwencijcbaufkvmvpxlvw"
+L92: .data 498, 437, -406, -428, 112, 838, -375, 669
+L93: stop
+L94: .string "fesourmnc"
+L95: .string "hajjs"
+prn r0
+mov *r5, L92
+L96: .string "xucgegb"
+dec L287
+dec *r2
+jsr *r2
+L97: .string "hqajl"
+clr *r7
+L98: .data 447, 274
+dec *r7
+L99: .string "t"
+L100: .data -392, -788, 474, -636, 284
+prn r3
+L101: .string "tkdyquujyzi"
+L102: .data 727, -127, 943
+L103: .string "achrqyhhcracmhnnupmx"
+L104: bne *r4
+L105: .string "whfsecfjmolswywsnoezfw"
+sub #-225, r5
+L106: .string "wxgjfjjcnjcliws"
+red L30
+sub *r1, r3
+L107: .data -389, 226, 31, 965, 524, 501
+prn r7
+L108: .string "d"
+L109: .string "xfp"
+L110: .data 283, -918, 62, -100, -803, 176
+; comment
+L111: .data 609, 853, -712, 364
+L112: .string "pbfonjehtretpmzf"
+stop
+L113: .string "xaabaeqycdnkyztzbcvmmo"
+L114: .string "znmtgsbfh"
+L115: clr r3
+L116: .string "i"
+L117: .data 578, 195, 740, 358, -107
+L118: .data 825, -813, -780
+L119: .data -436, -215, -504, 55, 903, 350, -230, -831
+bne L294
+L120: .data 333, 157, 641, -911, 264, -721, -480
+clr r3
+
+cmp #193, r0
+L121: .data -247, 554, -893, 59, -661, -672, -44, -288
+L122: .data 323, -90, -434, -217, -947, 203, -135, 915
+L123: .data 579, 401, -557, 522, 654, -516, -924, 98
+L124: .data -535, -765, -366, -363
+sub #-158, *r5
+L125: add #158, L329
+L126: .data -900, -812, -764, -70, 246, 654, -593
+jmp L120
+L127: stop
+cmp r2, r6
+L128: .data 452, 705, -330, 306, 940, 515
+L129: cmp *r2, r4
+L130: add r6, L186
+L131: .data 84
+L132: .data -776, -505, 259, -782, -640, 76, -546
+
+L133: .data -849, 442, -879, 328, 890, -783, -881, 127
+L134: .data 752, 176, -975, 557
+lea L307, r7
+jmp L32
+dec r2
+red *r4
+bne *r4
+L135: .string "zplotjj"
+add r1, r1
+add r0, *r2
+L136: .data -674, 130, -161
+L137: .string "jec"
+L138: .string "zel"
+clr L113
+L139: .data -245, -280, 479, 909, -80, 308
+L140: .data -99, -209, 334, -285, -883, -636, 300, -156
+lea L286, L257
+cmp #-183, r3
+L141: .string "tiyoulwoazltqkab"
+L142: .data -946, -697, 32, 65, 127, 28, -310, -54
+L143: .data -580, 812, 257, 134, 776
+L144: .data -862, -854, 556, -958, 384, 764, 183, 541
+L145: .string "vsbcqxpgguafldmx"
+L146: .string "r"
+L147: .string "dokbrtpswzzucefzqf"
+not r0
+L148: .string "jwx"
+L149: add r7, *r6
+sub #240, r7
+; comment
+stop
+L150: .string "axoap"
+L151: add r1, *r7
+L152: .string "zcm"
+rts
+L153: .data -501
+L154: .data -588, 708
+
+L155: .string "kqxmtn"
+L156: .string "kgzrcjeyyqvjevpuxitrp"
+sub *r1, L297
+not r6
+cmp r1, *r1
+L157: .data 8, -835, 665, -742, -694, 380, -275, -392
+L158: .string "mvkmmcckgskx"
+L159: .data -303, -166, -147
+sub *r3, *r3
+L160: .string "kkzetdoo"
+inc L65
+L161: .string "nvlcizbeujdiqq"
+L162: cmp *r0, *r2
+rts
+L163: .data 137, 666
+L164: mov #190, r0
+L165: .data 505
+cmp *r7, L325
+L166: .string "oliqtgpvsomhk"
+L167: .data 678, -724
+L168: .data 367
+dec r0
+L169: bne *r1
+L170: .data 41, 794, -919, 606, -947
+cmp #39, *r6
+
+L171: .string "wjqofnxmlrp"
+L172: .string "dmo"
+L173: .data -233
+L174: .data 217, 814
+L175: .data -770
+L176: .data -187, 768, 15
+L177: .string "sijk"
+L178: .string "reeoyhujqa"
+L179: .data 602
+add r3, r4
+L180: .string "sh"
+L181: add L116, r7
+clr L130
+L182: .data -586, -757, -792, 545, 537, 252, 923
+L183: .string "qcjmzdrdljfhqiursuw"
+L184: .data 705, 827, -95
+; comment
+L185: cmp L167, *r3
+L186: .string "pcuqwvzrhxnbdbsuzsy"
+L187: .string "jpvstxyln"
+L188: .string "zgbbjfsa"
+stop
+not r2
+L189: jsr L23
+red r6
+
+L190: .data 136, -660, -82, 94
+L191: .data -544, 978
+L192: .data -251, -488, -729, -407, 295
+L193: .data -958, -816
+red *r6
+jmp L306
+L194: .data -885, 152, -199
+L195: .string "tsbdvmsrgkbl"
+L196: .string "vkxlik"
+not L289
+L197: .data 979, -772, -931, -490
+L198: .data -964, 53
+L199: prn r3
+L200: .data -443
+mov L15, L164
+L201: .data 157, -63, -517, -392
+L202: .string "jrlizeq"
+L203: .data 79, -205, -869, -987, -814, 251
+L204: .string "lcucmxththsfhreqexmo"
+L205: inc r6
+L206: red *r3
+L207: .string "cpygifahpty"
+not *r5
+L208: .string "xyzaxyr"
+L209: .data 905, -960, 100, 643, 770
+jsr *r2
+L210: .string "iur"
+L211: .data 755, -726, -999, -655, -461
+L212: .data -497, 438, 68, 570, -250
+L213: .data 409, 955, -443, -643, 847, 200
+L214: .string "efpjuybecqylxbxjilnfqnga"
+L215: .string "lsncwk"
+sub r3, r3
+L216: red *r3
+L217: .data -107
+mov #152, L260
+cmp L300, #188
+L218: .data -815, 321, 740, -360, 820, -862
+L219: .string "oc"
+lea L302, *r0
+
+L220: .string "ilurjrwtwdeo"
+dec L193
+cmp *r3, *r1
+red *r2
+jsr *r6
+L221: .data -540, 976, 83, 201, -113
+lea L84, L293
+stop
+L222: .data 77, -411, 12, 402, -731, -14, 603
+L223: .string "gkyo"
+L224: .data 642, -226, -884
+sub r5, r6
+L225: .data 958, 804, -599, 37, 733, -636, -44
+jsr *r4
+L226: .data -345, 350, -249, -5, -295
+mov *r1, L51
+L227: .string "vqzvhfbhn"
+L228: .string "iddi"
+L229: .string "bfy"
+L230: lea L277, r2
+L231: .data 787, -896, -950, 827
+L232: .data -809
+L233: .string "yzpowfxslb"
+L234: .data -223, -178, -439, 553
+L235: .data -895
+L236: .string "jeyfcvmw"
+L237: .data 945, 475, -612, 606, 948, -263, -766
+L238: .data -285, 381, 527
+cmp *r4, *r1
+stop
+inc L196
+rts
+
+
+L239: cmp *r0, r1
+prn #179
+L240: .data 934, 625, -643, -102, 521
+add *r6, *r3
+L241: .string "aisdgkl"
+L242: .data 620, 547, 286, -295, -50, 52
+L243: .string "dokvddtiaeafxw"
+bne *r1
+L244: .string "czyxwkoxjvmbskbrgb"
+L245: .string "dxacmkmavhb"
+L246: .data 150, 565
+mov *r7, r5
+L247: .string "jtjqgahpzgzso"
+L248: .string "g"
+bne *r5
+stop
+prn *r1
+jsr L313
+cmp #-16, L76
+L249: .data 896, 457, -975
+L250: .data 587, 644, -82, -929
+L251: .data 618, 23, 620, -468, -339, 818
+
+
+L252: add #91, r3
+L253: .data -430, 558, -554, -802, 785, -868, -206
+L254: .data -270, -396, -410
+rts
+L255: .string "f"
+not r5
+L256: .string "rz"
+L257: .data 693, -28, 558, -787, 574, -902
+L258: .string "osndcuazlxh"
+L259: .string "ptzvurmi"
+L260: .data 400, -804, -320, 202, 754, -205, 961
+L261: .string "enyaliyyceoburpxze"
+L262: .string "xmsysskagibljguisawubvaz"
+mov r2, *r1
+L263: .data -384, -575, 205
+not r0
+dec r6
+L264: .data -946, 829, 487, -512, 1, -701
+prn *r5
+L265: .string "brpuoicirgxdgjsfjqkkx"
+jsr L255
+L266: .data -805, 896, -70
+L267: .data -626, -828, -98, -899, -814, -681, -569
+L268: .data -873, 942, -484, 404, -718, -274, 592
+stop
+L269: .data 107
+L270: .data -683, 619, -164, -785, -188, 595, 705
+L271: .data -594, -132, -232, 793, -149, -858, -961
+L272: .string "ektpdvmgqbbvjpd"
+L273: .string "ikcznnifkskzs"
+bne L63
+L274: .data -836, 20, 91, -643
+
+L275: .data 624, -152, 484, -297, -647, 860
+L276: bne L311
+L277: .string "qntnoveuygxbdaxtqa"
+L278: .data 579, -342, -930
+jsr *r2
+inc *r0
+L279: .string "mtkczrjbfluatro"
+rts
+L280: .data -335, -266
+L281: .string "edwrmwcineniywjyh"
+L282: .data 346, 608, 173, 468, -405, 183, 485
+L283: .string "vodwdcvjbhyh"
+L284: dec L39
+L285: .string "elfefijrdxyaod"
+L286: .string "kpvsuppskjvwklrqfazn"
+not L171
+inc L64
+L287: .data 931, 75, 101, -816
+L288: add *r2, r7
+L289: .string "etduoakkiljusvlwg"
+L290: jsr *r2
+L291: .data 779, -116, 461
+bne *r1
+L292: .string "sweqzhncvaeskntzeawwi"
+L293: .data -124, 250, 381, -255, -790
+; comment
+add #-154, r5
+L294: .string "fguabpu"
+L295: .string "bhpusdqkbkiwkqxdczuoud"
+
+L296: .data 862, -950, 478, 458, -623, -458, 151, -819
+L297: .data 151
+L298: add r1, L319
+L299: .string "zbepo"
+L300: add #-133, r3
+L301: .data -385, -164, -576, -86, 882, 845
+add r3, r6
+inc r5
+inc r2
+L302: .data -916, -659, -842, -842, -44, 581
+L303: .data -696, -655, 606, -15, 568
+prn *r4
+L304: .string "hlqihtbubr"
+lea L8, *r0
+L305: .data 925, -107, 792, 740, 400, -493, -485
+L306: .data -409, 944, -732, 23, 329, 697
+L307: .data -334, 825, -447, 308, -494, 995, -407, 301
+L308: .data -537
+L309: add r3, r6
+L310: .string "ycgtsanllsxxankyni"
+L311: sub r6, L10
+bne L190
+cmp L328, #4
+L312: .string "pxzuefqnxhwieyxyrq"
+L313: .string "mkgoxydwkzsak"
+L314: .data 707, 738, -956, 864, -4, 760
+L315: .string "mjfgudvzfzdq"
+L316: .data -732, 135, 695, 545, -876, 334
+prn *r2
+prn *r2
+L317: .string "x"
+L318: .data 926
+L319: .string "qgqjwy"
+L320: .data 957, -542, -657, -647, -428, -744, -493, -10
+L321: .data 989
+L322: .string "fzauwlepxxwqnkbxwgbundyu"
+
+L323: .string "xplzsjm"
+L324: .data -131
+; comment
+mov L327, L134
+L325: .string "uzbchlfcqldbuvrqota"
+L326: .string "pyakyubelqlwsp"
+rts
+L327: dec r4
+L328: .string "hwxsqdtozocdektxvwezl"
+L329: .data 801
+stop
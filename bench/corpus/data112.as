@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 113
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .string "eampqcjrkvtpxrf"
+
+L1: .string "jpx"
+L2: .string "cqnemvbu"
+add *r1, r3
+sub *r0, L60
+L3: .string "xnqe"
+L4: .data -861, 513, -744
+L5: .string "pioezzxocjznqkcffskuoy"
+L6: .string "ipcuuantwnebj"
+L7: red *r2
+L8: .data -437, -596
+stop
+L9: .string "zidzcnzmwjdjaw"
+L10: .data -668, -930
+L11: .string "crkudmz"
+L12: .data 566, 340, -577, 48, 459, -95, 484
+clr L61
+sub L3, L129
+rts
+L13: .data -899, -639, -339, 177
+add L13, r0
+L14: .string "qiqy"
+L15: .string "zwbuvxm"
+L16: .string "nrrqkaxvblriziuaex"
+L17: cmp r5, #-84
+sub L191, r6
+L18: .string "ije"
+L19: .string "kljgxjnauzwldmtfsakvzc"
+L20: .string "phnsmbk"
+L21: stop
+
+L22: .data -600, 934, -438, 173, 357, -204, 93
+; comment
+mov *r4, r7
+L23: .string "zguecyhkhhplsvlc"
+L24: .data 807, 982, -729, -303, -541
+L25: .data 434, -202, -387, 715, -70, -551, -155
+L26: .data -878, -903, 215, -150, 968
+L27: .data 515, 268, 824, 936, -587, -472, -51, -232
+rts
+L28: .string "mpwjvlwtxbkfikcauiksoebo"
+L29: .string "eo"
+L30: .data -147, -311, -993, -513, 623, 434, -950
+L31: inc L1
+L32: .string "zscmzbsqdyduz"
+; comment
+L33: .data -284, -567
+stop
+lea L165, *r6
+L34: .data 268, 928, 770, -61, -81, 191
+L35: .string "fmzlnltel"
+L36: .data 838, -257
+prn *r4
+jsr L35
+L37: .string "blyk"
+L38: .string "vifzwktrlhvhv"
+L39: .string "g"
+L40: .data 805, -255, -802
+L41: .data -910, -461, -705, -813, 744, 159, -977
+L42: .string "zmmbjjdnxxgyvtru"
+mov r0, L318
+L43: .string "jtwrzqemgvdknqnewnqfou"
+L44: .data 147, 575, -245, 206, 337, -625, 313, 450
+L45: .data 310
+L46: .string "jdhqtzrnducmctbbtqbbax"
+L47: cmp r0, r5
+L48: .data -285
+L49: .string "v"
+L50: .data -894, -394
+red r6
+L51: .data -359
+L52: .data 38, 327, 499, 13, -262, -865, 273
+jmp L303
+L53: .string "ojiagmlzphobs"
+L54: stop
+L55: .data 512, 762, 692, 464
+L56: .data -840, -198, 129, 634
+L57: .data -255, -976, -163, -807, 767, -972
+L58: .data -309, 342
+not L56
+inc L298
+mov #-177, *r4
+L59: jmp L214
+L60: .string "iggbcqdaw"
+bne L19
+L61: jsr L60
+; comment
+L62: .data -883, -208, -705
+clr *r5
+L63: .data -146, -403, 483, -579, 310, -717, -60
+L64: clr *r4
+clr L9
+L65: .string "kpohuhczitkmrpc"
+
+L66: .data -68, 659
+L67: stop
+L68: .data 84
+L69: .string "ulwjngehdphdzzomfvsehh"
+add #-108, L18
+cmp L150, *r0
+L70: lea L17, L128
+sub L304, *r5
+jsr *r7
+L71: .string "ehwtiscnvecwtsxckrnhcg"
+L72: red *r1
+L73: .string "answgoby"
+; comment
+L74: .data -841, -947
+mov *r5, L18
+L75: .data -191, -722, -422, 490, 36, -553, -710
+L76: mov *r0, r6
+L77: .data -582, 641, 941, 663, 647
+jsr L67
+dec *r5
+L78: .string "rgwxdmcpblvbdacaglq"
+L79: .string "mpgijfqfjxfosbcefwzn"
+L80: .data 293, 45, -985, 345, 835
+mov r6, r0
+L81: .data 986, -946, 253
+mov r2, *r4
+L82: .data 48, 200, 21, 958, -892
+L83: .data 279, -173, -22
+
+not *r4
+L84: .string "okc"
+L85: .string "lvkxuepeoioqltndp"
+inc r3
+L86: .data -10
+L87: .data 369, -214, -552, -703
+lea L208, r6
+dec *r1
+L88: .string "fr"
+L89: .string "elpoaushkusmggzbh"
+sub r5, *r2
+L90: .string "tcuvqqdxpmnsweqwcw"
+L91: dec *r7
+L92: .data 219, -820, -253, 822, 212, -241
+L93: .data -569, 29, -302, 624, -30, 18, 232, -760
+L94: rts
+cmp r5, #129
+inc r0
+L95: .data -71, -717
+L96: .data -538
+lea L185, L67
+L97: .string "zsgswztpyxmnefyoe"
+dec *r4
+L98: .string "rhmgehqxtmvowvq"
+L99: .string "cuc"
+L100: .string "vxvogyvvkaenxzgbvchf"
+L101: .data 915, -605
+L102: .data -647, 163, -597, -28, 486, 789
+L103: mov #-207, *r0
+L104: .data -64, 352, -615, -517
+L105: .string "nou"
+
+L106: .string "cdvvkiaikaxcnd"
+jsr *r3
+cmp #85, L138
+L107: .string "sc"
+L108: .string "ykzxnzdcqkom"
+L109: .data -893, -713, 713, -151, 954, -208, -984, -525
+L110: .data 608, -52, 860, 857, 525
+clr *r0
+L111: .data 816, -408
+L112: .data 131, 29, 637, -961, 579
+L113: cmp r2, r1
+lea L160, L111
+L114: .string "uvozidbdldlwrkjbxwz"
+sub L254, *r2
+L115: .string "mmienbvqlcpso"
+red L263
+L116: .data 209, -374, -385, -773, -205, -213, 944, -61
+cmp #-254, L38
+L117: .data 660, -761, -390, 77, 424
+; comment
+jsr *r3
+L118: .string "dbvffrpn"
+clr *r4
+L119: .data 673, 929
+L120: .data 951, -425, 942, -125, -599, -606
+L121: .data -506, 89, 263
+L122: .data -288, 373
+L123: .data -960, -583, 417, -520, 385, -272, -435
+L124: .string "haanbeuixxthrpkgjvi"
+L125: .data -570, -915, -445, 421, 570, 993
+L126: .data 348, -205, -680, 457
+L127: .data 74
+L128: .data 964, 539, -905, 903
+L129: .string "kcjnwm"
+L130: .string "wdfdvvldwiad"
+jmp L247
+L131: .string "vxzpghobidbdurodmnmixcqf"
+L132: .string "vvdsjdlvnmppnnuctzcsjnrr"
+L133: .string "u"
+L134: lea L316, *r5
+L135: .data 376, 406, -689, -11, -350, 699, 665, -201
+L136: .string "anhdpugkais"
+prn #-122
+L137: .data 772, 556
+prn *r6
+L138: jmp L65
+L139: .string "gxppgkxdess"
+L140: .string "pm"
+L141: .string "sidx"
+red r5
+L142: .string "wcqjbuioysvispgabty"
+sub L238, L48
+L143: .string "gomhukka"
+L144: dec *r6
+mov L294, L196
+L145: .string "qpchejeizelyogrxmnlidkf"
+L146: dec L89
+jmp *r6
+L147: .data -483, 754, -136
+lea L188, *r1
+L148: .string "kzjckgeoewrauuvqthsi"
+; comment
+L149: .string "cjqbdeqjqaom"
+L150: .string "yxfzkxnhjoed"
+L151: .data 884, 601, -406
+L152: .string "mkgotmfllmih"
+L153: mov L72, L151
+L154: .string "ped"
+L155: .string "duammaxyunl"
+L156: .data 995, -22, -772, -878, 10, 604, -181, -775
+L157: .string "uafd"
+; comment
+L158: .data 922, -415, 306, -125, -687
+sub *r0, r7
+jsr L28
+L159: .string "omyhfsvihgbdr"
+
+jsr L318
+add L240, *r3
+cmp *r6, r3
+jmp *r6
+clr r1
+L160: .data -824, 186, 26, -553, -602, 408, 663, -727
+L161: .string "sobqfogywaptcdxncgjnct"
+L162: .string "llixrzzndq"
+L163: not *r4
+L164: .data -271
+jmp L140
+L165: .string "r"
+sub #-251, L7
+cmp *r6, *r4
+L166: .data 125, 438, 624, 165
+clr *r5
+L167: .string "dibq"
+L168: .string "xrbkvmxkfyphr"
+red r7
+L169: .data 108, -409
+
+L170: .data 429, 177, 219, 461, 54, 865, 537, -907
+L171: .string "ueueaue"
+prn r4
+L172: .string "svskkjxgat"
+inc *r1
+L173: .data 207, -617, -172, -890, -728, -221, 494, -850
+; comment
+lea L110, r6
+L174: red L272
+L175: .data -988, -960
+L176: .data 185, 501, -265
+L177: .data -165
+bne L279
+L178: .string "jjjgfalrhwilbkqmzfvcywbc"
+L179: .string "om"
+red r3
+L180: .data -547
+L181: .data 274, -733, 491, 377, 26, 340, -298
+L182: .string "fwt"
+L183: .string "zcifoamptqa"
+L184: .string "zskngkqduchdogxypgoid"
+dec r7
+sub *r1, L64
+L185: .string "zasutu"
+add *r1, *r2
+
+L186: jsr L51
+L187: .data 785, -184, 472, -939, 519, 110
+prn r0
+L188: .string "bmihzwgpmodbfogmczoppveu"
+L189: .data 916, 319, -876, 42, 445, -162, -493
+L190: .string "ubuzcwhxjmqobohspozy"
+jmp *r7
+add *r5, *r5
+L191: .data -859, -366, -205, 57, -283, 772, 284, -604
+L192: .data 228
+L193: .data -259, -234
+mov *r2, r6
+L194: .string "jwvymaaztqsqppdynu"
+
+jsr *r0
+L195: .data 919
+L196: .data 340, -274, -455, 707, 95, 982, 432, 289
+L197: .string "gbqtabgzbytkxrf"
+jsr *r5
+L198: .string "l"
+L199: .data -397, 635, 127, 963, 805
+L200: .string "ucnpjlcxooglosasoiqprpq"
+stop
+stop
+L201: .string "kojwbnow"
+jsr *r5
+
+prn r0
+L202: mov *r1, L243
+L203: .data 608
+L204: .string "dk"
+red L247
+L205: .string "yooxdhdnk"
+rts
+L206: .string "swirsuomlionsbkvoa"
+L207: .data -783, -744, -955, 89, -500, 53, -736
+L208: cmp r3, r0
+dec *r7
+L209: .string "vtfnidoijmrsotydyec"
+L210: .data -767, 523, -202, 550, -773, -739, -258
+L211: .data -748, 13, 967, -165, -78, -103
+inc r0
+L212: .string "fkxwdtvwpxzkmz"
+jmp *r7
+L213: .data 633, 805, 43, 339, -863, -184, 996
+L214: .data 384, 943, -953, -311, 279
+L215: .string "otrcnjqgnbceug"
+L216: .string "bntb"
+L217: .data -290, -315, -403, 835, -218, -560
+rts
+L218: .string "illqfhgeqrhkkikwvabqnz"
+L219: bne *r7
+bne L318
+prn *r5
+L220: .data -833, -998, -322, -840, -61, -244, 6
+L221: .data -626, 312, 295, 24, -907, 933
+L222: .data -150, -488, 795, 967, -796
+L223: .data -867, 984, -993, -97, -15, -209, 140
+clr L263
+L224: .string "fadzbieoppfaqcxdom"
+L225: .data 876
+L226: .data 268, -668, -913
+jmp *r0
+mov L236, L272
+L227: mov r1, L227
+red r1
+
+L228: .string "rbgwje"
+L229: .string "xzgffvzuuvmuntnjwtenb"
+L230: .data 728, 864, 628, -653, -553, -94, -684
+L231: .string "mezxfperyeo"
+L232: .data 188, -834, 144, -690, 872, 213
+L233: .string "wknzmulrarhgp"
+add L223, *r6
+inc L316
+dec r5
+inc *r1
+red *r7
+L234: .string "fxxkbb"
+L235: .data 869, 676, 92, -958, -782, -411, -955, -873
+L236: .data -266, -285, 977, -158
+L237: .string "mso"
+bne L298
+add r4, r5
+L238: .string "zlbn"
+L239: .data -769, -225, -345, 205
+L240: .string "jzqfzronda"
+L241: cmp L21, L264
+not L203
+L242: .string "vaiwci"
+rts
+L243: .string "vopdgagr"
+dec L145
+prn *r3
+L244: .data 371
+L245: sub #-159, L86
+L246: .data -829, -160
+L247: .string "abnzeduosjaufe"
+L248: .string "lhfzthxuk"
+bne L160
+L249: .string "qbdn"
+L250: .data -401, -441, 621, 241, -971, -243, 188
+L251: .string "rjyholnxsmsrrxiohulnq"
+L252: .data -994
+L253: sub L296, *r2
+L254: .data -88, -429, 523, -132, -269, 981, -43, -179
+L255: .data 105, 228, 221
+stop
+L256: .string "dngutszblirfvqudhmn"
+L257: .string "k"
+L258: .data -131, 477, 444
+lea L305, r2
+L259: .data 586, 914, 436
+stop
+L260: .data 817, -395, 277, -607, 392, 834
+L261: .string "mszoajdj"
+dec L260
+L262: .string "mthuxppxurqxwcszhdwaktjv"
+clr *r1
+L263: inc *r7
+not L324
+L264: jsr L138
+L265: .string "giilbrzqvwjxhlrsvv"
+L266: .data 135, -36
+L267: .data -348, -287, 941, 850, -471, 382
+rts
+L268: jmp *r6
+L269: .data 630, 112, -12, -389, 971, 439
+lea L298, *r1
+L270: .string "nofihcgrkzjnxoseoclxwmpt"
+L271: .data -128, -230, 443, 730, -412, 785, 42
+inc *r5
+L272: .data -650, -337, -223, -368, 2
+L273: .data 292, 926, -369
+
+L274: .data -226, -980, 891, 820, 201
+L275: .string "kr"
+cmp *r5, r0
+L276: .data 740, -688, -752, -366, 337
+L277: .string "dhllclrmgxcgmhcublg"
+mov r1, L223
+L278: .data -870, -731, 927, 384, -957, -370, -276
+L279: .data -427, 681, -450, 631, -61, 568, -319
+L280: .data -260, 637, -327, 165
+
+bne L221
+L281: .string "nuvsldcictguodh"
+L282: .data 703, -483, -93, -685, 378, 308, -143
+L283: .string "golobhh"
+L284: .string "ammlvaczkbqkpuog"
+L285: .data -824, -594, 299
+L286: .data 541, -806
+mov L56, L303
+L287: stop
+L288: .string "pwa"
+stop
+L289: .string "dktndgwmjmgiqcka"
+L290: .data -139, -424, 956
+L291: .string "wvbucquyuineunri"
+
+sub #-55, r0
+L292: .string "nkudrsdqouxajjwknzim"
+L293: mov #239, r6
+L294: .data -816, -523, -823, 69, -976, -745, -887
+L295: .data 941, 66, -369
+L296: clr L311
+L297: .string "rxqf"
+L298: .string "qqssglrqpevmcmywnvxxyc"
+L299: .string "riqzwf"
+L300: .data -546, -311, -888, -373, -806, 389, -118, -134
+L301: not L303
+L302: bne L322
+L303: .string "cdxnjvfgpxpqfxenbh"
+red L319
+L304: .data 555, -154, 654, 722, 364, -2, -918, -312
+red *r4
+prn *r5
+jsr *r6
+sub L237, r5
+
+clr L310
+L305: .data -968, 507
+L306: .string "lftffzaqnadzklaeqzyr"
+L307: .data 7
+L308: .string "jajawzlejumccrxs"
+L309: .data -540, 476, 773, -704, -419, -177
+L310: .data 933, -755, 53, -816, -309, -855, -97, -620
+L311: .data 890, 817, -524, -686, 485, 661, 669
+L312: .data -311, 236
+
+cmp *r1, #-185
+jmp *r5
+jsr L127
+jmp *r1
+L313: .string "ykanpbmjpfmfsacgemdsbiny"
+L314: .string "sxzeu"
+L315: .string "uojxakwwgpxgtlnemhgkyarl"
+L316: .string "iyjwastymnpqt"
+L317: .data 144, -145, -219, 342
+L318: .data -828, 429
+prn r6
+L319: .data 542, -750, 350, 516, -929, 712, -897, 996
+jmp *r4
+L320: .data 332, 400, -616, 58, 478, 562, -790, -887
+; comment
+lea L127, *r1
+L321: .data 123, 655, -523, -29, 978, -676
+rts
+prn #-130
+
+L322: .string "rcxoetojqinbtiuvgdg"
+prn L324
+L323: mov *r7, *r3
+L324: .string "uxvwyzqpcrdfnjaatbhrns"
+red r6
+jmp L161
+add r2, *r2
+dec L106
+sub L324, *r1
+red r3
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 114
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .data -650
+L1: .string "zgghgkounmo"
+L2: .string "xjmwkwi"
+red r0
+L3: .data -267
+prn #-57
+L4: .string "mgeexjuzqpyxhugzs"
+cmp L36, r6
+L5: .data 793, 507, -978, 840, -456, -992, -519, -855
+prn #208
+L6: .data -168, -295, -260, -94, 746
+L7: .data 707, 496, 849, 829, -358, 351, -880
+inc *r0
+L8: .string "fru"
+not L1
+stop
+prn r6
+L9: bne *r2
+L10: not r4
+L11: .data -551, 798, 797
+prn L1
+L12: .string "jowytlevifjdfdowbndd"
+dec r7
+add #163, L4
+L13: not r1
+clr *r7
+jsr *r0
+lea L6, *r6
+L14: .data -184, -162, 159, 207, 754, 828, -975, 451
+red *r6
+L15: .data -766, 212, -913, -869, 350, 372, 417, 431
+L16: .string "bhm"
+L17: .data -853, 157, -799, -655
+L18: .data -559, 178, -292, -743, 969, -431, -746
+bne L7
+clr *r5
+L19: .data -696, -278, -195, -575, 249, -930, 884, 440
+bne *r7
+stop
+L20: .data -749, 128
+L21: .string "tflvuydrfnlqypywe"
+L22: .data 377, 874, -180, -151, 62, 222, -982
+L23: .data 376, -78, 386, 137
+bne *r0
+
+lea L264, L276
+mov #156, L208
+L24: .data -819, 784, 617, 935, -9
+dec L88
+add r4, r0
+rts
+L25: .string "vmhafcxfjftvq"
+L26: .data 311, -31, 572, -79, 853, -685, -653, 774
+L27: .string "fgcoemmnwokczxdaxz"
+L28: .string "mempmwnftkzkgr"
+prn L19
+L29: .data 894
+cmp L23, #101
+lea L280, L116
+L30: bne L204
+cmp #245, L163
+L31: .data 555, -872, -140, -233, 9, 449, 76
+; comment
+L32: .string "wtbw"
+L33: .data -950, -740, 645, -814, 81, -767, -51, -753
+rts
+prn r0
+red r4
+L34: .data -201, -472, -782, 321
+L35: .string "myseifftjfs"
+L36: .string "nmduhsy"
+L37: .data 945, 740, -209, -629, 234, 971, -517
+L38: .data 239, -505
+L39: .data -159, 448, 958, -520, 579, 459, -935, -659
+L40: .data -256, -313, -127, -922, -81, -651, -841, 983
+L41: .data 973, -527, 371
+L42: .string "jsjdxjuphhv"
+cmp *r7, r0
+L43: .string "oolyv"
+L44: .string "exjgvew"
+add r2, L30
+L45: .string "uwoia"
+L46: .string "ctwdyyefumqtzvmmgomgqes"
+L47: clr L295
+L48: .data -675
+L49: .string "mciibracfrvcdkzwsk"
+L50: .string "cuufrrgunfshhy"
+jsr L34
+L51: .data -128, -423, 641, 721, -986, 319
+L52: .data 273, 780, -391, 855, 556
+red *r6
+L53: .string "lpjbxwqcrbjidlvjpvuaf"
+L54: .data 505, 76
+L55: .string "ovyyoswfngttp"
+L56: .data 784
+dec r6
+prn r4
+add #165, *r2
+L57: .string "pdik"
+add *r4, L299
+L58: .data -93
+L59: .string "gshfkg"
+L60: .string "cpmnouudbesh"
+; comment
+red L292
+L61: .string "lmsvkaeubpvdmqatkc"
+L62: .data -704, 155, -209, -482, 340, -157, -807
+L63: .string "dcpvlmvhofwpdkfmekdkyxac"
+L64: .data -166, -274, -96, -121
+L65: .data -730, 805, 459, -620, 597, 352
+L66: .string "n"
+L67: .data -603, -79
+lea L66, r1
+lea L0, L259
+L68: .data 29, -991, -731, 287, -177, 88
+L69: .data 165, 442, 673, -483, 790
+L70: .string "zojdylnsaagpzjfmdyqeh"
+L71: add r5, r2
+L72: .data -147, 508, 363, 979, -48, 287, -280, -463
+L73: .data 357, 365, 175
+L74: .data 531, 625
+L75: .data -782, 563
+jsr L53
+L76: .data -930, 780, 258, 300, 290, -301, -517
+
+L77: .string "fvajtrm"
+inc *r4
+L78: cmp L56, L279
+bne *r3
+L79: .string "dw"
+
+L80: prn r3
+inc r5
+L81: .string "tkzbffjqkc"
+L82: .string "hjpdvfx"
+L83: .data -981, -782, 396, -141, -845, -19, -496, -158
+red L282
+prn L77
+mov *r2, L149
+L84: .string "mjbbnugjetul"
+L85: .data -7, -329, 478, 335, 445
+red L129
+; comment
+L86: .string "mxgqkgicofwqqwxjmtonm"
+L87: .data 175, 635, 116
+bne *r6
+L88: lea L121, L192
+L89: .data 407, -795, -454
+bne *r3
+L90: .data -718, 279, -293, 101, -491, -543, -275
+inc L32
+; comment
+L91: .string "lhbav"
+bne L90
+add L16, r6
+L92: .string "crkdf"
+L93: clr *r0
+L94: .data -879, -23, 980
+L95: .string "spx"
+L96: .string "kuqin"
+rts
+bne L235
+red *r7
+L97: .string "hxttxzh"
+jmp *r7
+
+lea L20, r7
+L98: .string "esr"
+L99: .data -361, -16, 288, 873, 209
+L100: .data -319, 876, 749
+L101: .string "efkbkgtemyjbtuytqzew"
+L102: .data -495, -678, -739, 624, -586, -701, -596, -691
+L103: .data -294, 501, -610, 40, 590, 525, 302
+dec *r6
+L104: .data 805, 19, -214, 779, 241, -248
+bne L88
+stop
+prn r5
+L105: .string "hnuzdmnfanuaggq"
+rts
+add *r0, *r1
+L106: .string "kebyjzhwbhaeu"
+jsr L196
+L107: .string "tuncfofkdrqebbeyzsecadn"
+L108: .data -870
+L109: .string "gqqnkp"
+
+not L164
+L110: .string "gvjbaxjstqlyfdhzcbillj"
+L111: .data -287, -444, 128, 348
+dec L52
+L112: .data 225
+jmp L210
+L113: .string "vnxtyea"
+L114: prn *r3
+add #-256, *r3
+inc r3
+L115: .data 943, -11
+L116: .string "rfydztocnudmiis"
+L117: jmp *r7
+L118: jmp L0
+prn #238
+L119: .data -898, 982
+L120: .string "k"
+L121: .data -108
+L122: .data 902, -168, 317
+L123: .string "vjvnmmwr"
+L124: .data 574, -513, -908, -873, 214
+L125: .string "eqmfttcgsjuvtmi"
+L126: stop
+L127: .data 342
+L128: .string "nitxoqnrdpxik"
+; comment
+L129: .data -115, 648
+L130: .data -438, 888, -617, 546, -798
+sub L42, r0
+L131: .string "ggmldkxsgz"
+L132: .data -358
+sub #93, *r1
+L133: .data 607, 413, 541
+
+sub #230, *r7
+L134: .string "xxktzg"
+L135: .string "lvgazwxekvy"
+L136: .data 520
+L137: .data 7, -821, 290, 449, 140, 579, -551
+L138: .string "tkkhrmmlpzyzrvitfyusaxpp"
+L139: .data 939, 634, -339, 346, 447, -344, 726
+L140: .data 493, -256, -137, 708, -560, -21, -973
+prn *r5
+L141: .string "mukaqbzrfsfsevavg"
+L142: sub *r7, *r5
+sub r5, r0
+L143: .string "wmmgbfaizggxbycnll"
+L144: .string "wafn"
+L145: .data -589, 647, -966, -866
+L146: .data 104, 217, -307, -775, -470, 587, -832, -503
+sub L134, r2
+L147: .string "uhitbee"
+L148: .data 266, -388, -219, 844, -742, 587
+L149: jsr *r5
+rts
+
+jsr L231
+mov *r4, r3
+L150: .string "ohcklgapxaddhjksbdziy"
+stop
+stop
+; comment
+L151: .string "mqfatdnfa"
+lea L247, L26
+not *r5
+L152: .data -290, 979, -844, -854, 352, 623, -787
+L153: .data 351, -912, 629
+sub #67, L238
+L154: .string "kkwvjvgzylnlfayhhtuy"
+L155: .string "emdfsafgdvnwbxrjmkjp"
+L156: cmp #227, L27
+prn L20
+L157: .data -971, -460, 112, -649
+L158: .string "yycefi"
+L159: .data 843, -869, 116, 905, 317, -93, -995, -205
+
+L160: .string "nk"
+L161: .data -888, -958, 514, -824, 409, -238
+L162: stop
+L163: .string "xosvlachkgzteskcvcmfdsd"
+add #203, L135
+not r5
+L164: .string "tlpureyth"
+; comment
+; comment
+cmp #229, *r3
+L165: dec *r6
+mov #176, *r1
+L166: .data -312, 342
+L167: .string "ne"
+L168: .data -631, -794, 575, -386, 959
+inc L129
+L169: .string "zaz"
+L170: .data -429, 240, 787, -845, -900
+L171: .string "zwv"
+bne L241
+L172: .data 288, 395, 320, -130, -505, 726, -257
+L173: .data -506, -954, -287, -597, -864, -538, -13
+L174: .data 610, -314
+L175: .string "jqyjpo"
+mov r6, r3
+; comment
+L176: .data 316, 671, 287, -502
+sub L9, *r4
+add r2, *r5
+bne *r1
+L177: .data -154, -760, 303, -407
+L178: red L320
+mov *r2, *r4
+L179: .data -435, -870, -683, 785
+L180: .data -271, 897, -966, 947
+L181: .string "hwfkqjkxlmq"
+L182: .string "szo"
+L183: .string "agrwjudinxexgs"
+L184: not L299
+L185: .data 60, 804
+L186: sub *r0, *r5
+L187: red r1
+mov *r5, *r4
+L188: .string "navusvlpptx"
+L189: .data 321, -887, -978, -571, -977, -518, 474, 799
+L190: .data -530, -792, 122, -361, -141
+red *r3
+L191: clr L39
+L192: .string "jc"
+L193: inc L290
+
+
+L194: .string "nccjexrsvannpmhvakeey"
+L195: .string "rpfwmn"
+L196: .data 65, -173, -196, 367, -46, -882, 275
+L197: .string "kyjjwlkztmrisapgunwikrrd"
+lea L212, L13
+jmp *r4
+L198: .data -472, 280, -312, 812, -676, 179, 860, 417
+L199: .string "ewqd"
+L200: .data 918, -480, 971, -326
+L201: .data -615, -104
+L202: .string "skygmkmvgkdlhr"
+L203: .data 19, 615, 699, -185, -733, 516, -725, -741
+L204: .data -736
+L205: .string "goptojwkngvcmlquvcdjgcrm"
+L206: .string "wtpbodobn"
+L207: .data -545, -527, -721, -467, 630, -535, 891, 89
+L208: bne L105
+bne L230
+L209: .data 723, -406, 639, -583, 218, -442
+rts
+L210: .string "tuwknk"
+not r1
+L211: .string "dopshvxjpggh"
+inc r3
+bne *r6
+L212: .string "zvtfhrepllbxtfdhhdyz"
+L213: not r1
+L214: .string "wcbg"
+sub L302, r2
+L215: cmp L69, L76
+L216: .data 642, -494, 538, 2, -465, 893, -467, 822
+
+L217: .data 885, 714, 81, -385, -742, -128, 741, -14
+L218: .string "dhnopqrkmxyno"
+lea L316, r1
+add L71, L230
+L219: cmp #-37, L184
+L220: .data -513, -100, 355, -387, -489
+L221: .data -674, 551, 485
+L222: .data -117, 372, -911, -329, -699, -78, -926, -765
+not r7
+L223: .data 791, 277, 779, 12, 900, 118
+L224: .string "iohhzwesnvsesjxqtm"
+L225: .data 137
+jmp L25
+L226: .string "tcjtoydmmxcvrvu"
+sub L197, L25
+inc *r1
+L227: .string "jfsgmsasufxip"
+L228: .string "uyktthlnjzktxpaf"
+red r1
+L229: .data 308, -315, 779, 933, 504, -478, -147
+L230: .string "sosydapumsyj"
+; comment
+inc *r3
+L231: clr *r4
+not L61
+L232: .data -423, 641, 297, -685, 389, -84
+mov *r0, r1
+mov L99, *r2
+L233: .data -639, -25, -954
+L234: .data -473, 807, -806
+L235: .string "hiaqlxzlru"
+L236: .string "ilwsvbjwuemanjegijxbar"
+L237: prn L10
+L238: .string "qquozq"
+L239: .data -625, 545, -697
+L240: .string "fhlie"
+L241: .string "mjcbjzubwbemizokdvixkib"
+red r7
+L242: .string "ajgpxlf"
+L243: .string "p"
+L244: .string "xdhpunzbuhhzdhga"
+L245: .string "iysxkplmpooiuczwvjlbav"
+L246: .string "gesvocemwnozkydadmxdu"
+L247: .data -79, 256
+L248: .string "enkcmeuxrpth"
+L249: .data 841, 572, -540, 326, 456, 499, 577
+L250: .string "eshngcnmpbvefbrntgrbhf"
+jsr *r2
+jmp *r7
+L251: .string "dageyyabbwyqn"
+sub #232, *r1
+clr r2
+L252: .data 323, 177, 933, 804, 911, 997, -426
+L253: .data 406, -15, 210
+L254: .string "bwfefgphcxrxl"
+L255: .string "hg"
+L256: .data -66, 265
+L257: .string "xcieuxdwijpfmofq"
+L258: .data 756, 611, -974, -240, 617
+L259: .data 146, -791, 798, 194, -410, 738, 280
+red *r5
+
+inc L318
+jmp L117
+L260: .data 380, 398, -366, 574, -937, -887, 767, -760
+L261: .string "opa"
+L262: .data -87, 839, -221, 652, -464, -93, -21, -53
+lea L165, r4
+L263: .string "gifa"
+L264: .data -731, 58, -927, -577
+rts
+L265: .data 502
+L266: cmp r4, *r0
+L267: .data -114, -821, -656, 212, -270, 152, 96
+clr L262
+L268: .data 202
+lea L285, L108
+add r3, *r2
+lea L86, *r0
+L269: .string "mqvjcfskeivs"
+
+L270: .string "icimtyahdesssspexi"
+inc r6
+L271: .data 582, 696, -724, -764, 658, -362
+L272: .data -261, 397, 437, 942, 111, 476, 282, -949
+L273: .data -544, 649, 395, -360, -689, -721, -623, -590
+L274: .string "jlojheuhdh"
+prn L103
+L275: .data -185, 618, 723, 696, -987
+L276: .data 50, -89, -865, -271, 372, -175, 884, 784
+L277: .data -117
+L278: .data 655, 391, -762, -643, 276
+
+L279: .data 696, 313, -489, 774, 655, -876, -420
+rts
+inc *r4
+L280: .string "qqbmqkwaassryux"
+L281: .data -549, 251, 930, -418, 779, -394
+L282: .string "npwhehwdybnvmsxlpeh"
+
+lea L285, L283
+dec L320
+L283: .data -719, -859, -309, 928, -616, 741, 806, 568
+stop
+L284: .data 326, -870, -657, 727, 674
+red r4
+L285: .data 765, 258, 887
+L286: .string "veeqivhxotjwhskqkj"
+L287: .string "koguemvurdryrpjweivbg"
+not L312
+clr r3
+L288: .string "npzteser"
+L289: .string "jgrtfkqdzkwgyoudukgqche"
+L290: .string "uok"
+L291: mov L318, r3
+L292: .data -446, -450, 12, 32, 148
+sub L319, r1
+L293: .string "x"
+L294: .string "bormxrvogkilmfkhhsjlz"
+L295: .string "ddufhugouyhkiotlhveop"
+L296: .string "ndpgb"
+L297: .data -346, -462, 709, 473, -62, -713, 505
+L298: .string "gfsbetnsqwgflolkwlzlm"
+cmp L273, #137
+cmp r6, L319
+L299: .data -554, -972, 280, 199, 590
+red L192
+bne *r3
+prn #217
+L300: .data -614, -976, -583, 492, 94, -334
+jsr *r0
+L301: .string "raockwul"
+L302: .string "dkqpompzc"
+L303: .data 545
+L304: .string "ncwefitzunrownreho"
+L305: jsr L29
+L306: .data -672, -366, 876, -165, -336, 769, -565, 939
+L307: rts
+L308: .data -429, -43, -699, 964, -508
+L309: .data -800, 479, -82, 591, -437, 199, 675
+L310: .data -519, 806, 752, 634
+L311: .data -753, -538, 510, 237
+L312: .string "jlkkbtd"
+L313: .data -810, -737, 774, 730
+L314: .string "mbqfxuucorxxwp"
+clr r3
+L315: jmp *r7
+L316: not *r6
+rts
+L317: .data -906
+L318: clr L319
+L319: .data -265, -717, 915, 156
+L320: .string "vbgtkfwsnabgwvrk"
+stop
@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 115
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+; comment
+L0: .string "stsythdqkqxsj"
+L1: .data -44, -332, 308, 800, 614
+L2: .string "sgdomosghv"
+lea L1, L109
+L3: .string "o"
+L4: .data 115, -246, 820, 592, -465, -887, 701
+L5: .string "rthwfohnzlmphoxldbytaow"
+L6: .data -812
+cmp *r3, #-75
+L7: .data 257, 636
+clr r6
+L8: .string "bhlhuesnfzn"
+L9: .string "tsfvadh"
+L10: .data 277
+L11: .string "kqlzwkrpmutqdvi"
+jsr L9
+add L7, *r6
+L12: .string "mqiixdxvhakl"
+; comment
+cmp #-46, *r5
+L13: .string "ef"
+red *r3
+L14: .data -60, -917
+L15: .data 164, 126, -298
+add r3, r4
+L16: .string "rwhta"
+not L6
+L17: .data -672, -990, 772, -226, -458, -435
+L18: .data -351, -135, 439, 356, 989, -822, -2
+lea L176, L0
+L19: .data -445, 748, -863, -182, -531, 592, -44
+jsr L11
+L20: .string "o"
+lea L7, L25
+bne L20
+L21: .data -504, 204
+L22: stop
+add L14, L280
+L23: .string "ktleod"
+L24: .data -557, -878, -972, 332, 743
+L25: .data 652, 14, 361, 7, -68, -925, -400, -839
+L26: .data 630
+cmp L15, *r6
+L27: .string "bnbzgafussfofmfod"
+L28: .data -582, 946, -280, 269
+L29: .string "nyyysbra"
+L30: .string "hliykhhitfxx"
+L31: .data -558, -77, 85, -200
+jsr L23
+L32: .string "vjatpn"
+L33: .data -374, -708, -391, -391, 1
+L34: .data 895, 726
+L35: .string "jrpjoryypxkezgdgdrvvg"
+jsr L19
+L36: .data -486, -130
+L37: .string "bplgnvsrl"
+L38: .data -635, -17, -67, 744, 101, -888, -332
+clr r7
+L39: .string "smtexnks"
+L40: .data 321, -628, 166
+L41: .string "ubxt"
+
+L42: .string "wghtadqtvoqwr"
+dec *r1
+lea L9, L153
+L43: .string "dgmhonptbix"
+not *r4
+bne *r0
+L44: stop
+L45: .string "ccehafzdpwkxafzdtounb"
+L46: .string "rqpilw"
+L47: .data 23, -694, -551, 692
+clr *r4
+jmp *r3
+sub L171, *r7
+add r0, *r0
+L48: .string "ckpvbhqodvqhyq"
+bne *r3
+dec *r6
+L49: .data 407, 97, -132, 382, 588, -590, -750, 705
+
+L50: .string "kqnbdcxoidnj"
+L51: .string "lwjwpjimdeydcbvmgwbvft"
+jmp *r2
+not r2
+bne L12
+L52: .data 928, -671, 589, 746, 708, -646, -919, 186
+lea L72, L304
+bne L49
+L53: .data -477, -316, -108, 205, 507, -798
+L54: .string "mfbpftq"
+L55: .string "pxdxtsbyi"
+L56: .data -676, 838, 889, -822, -716, 885
+L57: .data -511, -760, 956, 945, -519, -269, 706
+L58: .data -209, -345, -972
+L59: .data 453, 355, -602, -609
+L60: .data 709, 220, 770, 547, 574, 226
+dec *r4
+L61: .string "qdgwgjnrsigfhrq"
+L62: .data -230, -736, 463, -248, -821, 38, -794, 233
+L63: .string "kbihurncfe"
+L64: .string "pqqzfc"
+L65: .string "adnbojcbt"
+clr r6
+L66: jmp L4
+L67: .data 313, 270, -581, 126, 819, 750, 748, -677
+cmp r1, *r4
+add L38, r4
+; comment
+L68: .data -621, -904, -425, 916
+inc L10
+jsr *r4
+
+dec L29
+L69: .data 26, 253, -90, -951
+L70: .data 967, -484, -794, -946
+L71: .data 201, -642, -438, -411, -438, -5
+L72: .string "qfkejaecy"
+clr *r1
+L73: dec r3
+L74: .string "lhcqzvctj"
+; comment
+jmp *r2
+red r0
+L75: .string "czy"
+L76: .string "f"
+L77: .string "wwarozlrlmulkgylan"
+L78: .data 422
+L79: .string "fjfqzeyfcfk"
+add #-163, r2
+mov L0, r7
+cmp #55, #71
+L80: .data -617, 321, -729
+L81: .string "pzkthxujdhs"
+L82: .data 655, 222, 926, 656, -226, 293, -852, 733
+jmp L133
+L83: .data -762, 858, 585, 212, -767, -853, 861, 539
+L84: jmp *r1
+L85: .string "i"
+L86: .data 52
+dec *r2
+L87: .string "pxnipywqnmbfgks"
+dec *r0
+clr *r1
+L88: .data 214, 807, -402, -113, 430, 863, 945, 778
+L89: .string "rrhwtskhxrxnggayy"
+jsr *r6
+L90: .string "razyepjjyashdtkeuyks"
+inc r7
+; comment
+dec r0
+L91: .data -829, 246
+dec L44
+L92: .string "dyy"
+stop
+L93: .string "caknrfbr"
+L94: stop
+L95: inc r5
+L96: .string "vknvvhepwusgwdbhslhsgu"
+L97: .string "suwzjsn"
+L98: .data 343, -380
+sub L81, r0
+red *r0
+sub #173, L2
+L99: .string "gmqo"
+L100: .data -235, 103
+stop
+L101: .data -504, -116, 663, 231, 372, 717, -381
+inc r2
+L102: .data -732, 527, -805, 65, -467, 893, 677, -257
+L103: .data 541, 741, 731
+inc L3
+L104: .data -949
+L105: .data -237, 409, -301, 214, 118, 679, 640, -330
+L106: add L308, *r6
+lea L142, *r2
+bne *r4
+L107: .string "xioblqtmptsiu"
+L108: .string "zmbgeckisdlhvpjvymfc"
+prn *r0
+L109: .data -948
+add #-108, *r7
+L110: prn r5
+L111: .string "foqvixpycglfcvypukqs"
+L112: .string "vkqzmlsbcyrvykbrup"
+L113: .string "svlnswpliz"
+L114: .string "yuunfnjdzkqiat"
+L115: .data 848, -598, 740, -550, 781
+L116: .data -459, -356, -561
+L117: .string "rcc"
+L118: .data 182, 691, -369, 412, -154, -11
+sub #121, L271
+L119: .string "dvca"
+clr L257
+cmp #151, r4
+L120: .string "aydryih"
+L121: .string "asmvzfhrs"
+L122: .string "wtjeaefcgp"
+L123: cmp r2, r3
+L124: .string "wruo"
+L125: .string "umxukwur"
+L126: .data -147, 983, -890, 996, 598, 196, 681
+L127: .string "lcbocvpqvdb"
+L128: .string "djjvfyyhsxiitabdaodhrldc"
+L129: .string "mzsypnqmvttgxmzhgfgqlyi"
+L130: .data 685, 104, -752, 374, 206, -688
+L131: .data 568, 236, -522, -909, 588, -656
+L132: .data 580, 346, -87, 513
+L133: .string "efpzfiyird"
+not L86
+mov *r3, L175
+L134: .string "qwtbgmbiikrtjtjkkhgs"
+L135: .data 322, -60, -670
+L136: .data 129, 985, -64, 170, -414
+red L83
+clr *r4
+rts
+stop
+L137: .string "niuelaqajsubgcwhepblpla"
+L138: .data 465
+; comment
+rts
+inc *r1
+clr L10
+L139: .data -836, 112, -136
+jmp *r0
+L140: .data 949, 903, -148, -394, -987
+L141: mov *r3, *r6
+L142: .string "wpqfspocrwexgsiirej"
+rts
+L143: .data -76, 159
+bne L166
+L144: .data 293
+L145: lea L29, L98
+L146: .string "wfbnthciuqnubespq"
+L147: .data 412, 558, 47, 767, -797, -215
+L148: .data 1, -198, -913, 551, -569
+L149: .string "zquddfizjnhjesyqale"
+clr *r6
+; comment
+rts
+rts
+L150: .string "yhcc"
+sub L293, r5
+inc *r7
+L151: .string "tm"
+not *r6
+L152: .string "un"
+rts
+L153: .data -388, 687, -219, -826, -826
+L154: .data 588, 98, 577, 15, 868, 579, -776
+cmp *r5, #-12
+L155: .data -965, -440, 10, 289, -814, 440, -996, 428
+L156: .data 409, -75, 326, -839, -609
+L157: .string "iveloyvarixtfkjualwf"
+inc L180
+L158: .data -216, 852, -631, 193
+L159: .data -633
+inc *r1
+L160: .string "k"
+L161: .data -747
+L162: jsr L258
+L163: .string "wvozfoospyjthaojbf"
+add *r2, *r2
+L164: .data -724, -40, 614, -392, 841, 112
+L165: .data 959, -302, -88, -487, 343, 639
+red r0
+rts
+L166: .string "umhaerpc"
+L167: .string "onipuerkhv"
+L168: prn *r2
+L169: .string "bklduiquzliomvwssgtp"
+L170: .string "vcxbouewgtm"
+L171: .string "naookfryi"
+inc *r7
+L172: .string "eeyrhqnjilhi"
+jsr L157
+L173: .string "pmjoowlwizhkodqu"
+L174: .data 956, -892, 118, 317, 411, 684, 862, -610
+L175: .data 103, 382, -126
+dec r0
+red L43
+L176: rts
+stop
+jsr L91
+L177: .data -865, 73, 578, 860, -761, -859
+L178: .data 579, -633, 340, 49, -652, 506, -824
+mov r0, *r0
+rts
+sub r5, *r6
+L179: jsr L10
+stop
+jmp L205
+L180: .data -120, -208, 615, 164, -724
+L181: .string "eqdob"
+red *r2
+L182: .string "pporwbnf"
+mov #-185, L39
+L183: .string "ojcktrh"
+L184: .string "jzwidlufohxndhmxcrki"
+L185: dec *r0
+jsr L124
+L186: prn L154
+prn r3
+L187: .data -333, -153, -846, -116, 428, 881
+jsr *r1
+L188: bne L91
+dec *r0
+L189: .data -144, -218, 629, -839, -996, -662
+L190: .string "mebzuguabuglwefxjpwinew"
+L191: stop
+L192: .string "uyeyotwvzwlapbe"
+L193: rts
+prn #208
+L194: .data 322
+L195: .data 28
+cmp *r5, L122
+rts
+L196: .string "l"
+L197: .data -778, 457, 322, -411
+L198: .string "dpfvnigkxdtgwjqvjfnhbl"
+
+prn *r2
+L199: rts
+L200: .string "axs"
+L201: .data -394, -565
+sub r5, L285
+L202: .string "ebvi"
+L203: .string "acjwlipetjmcthwq"
+L204: .string "cjzwqadkuhalsajwnjqrxtsw"
+L205: .data 562
+clr *r3
+sub *r5, *r3
+; comment
+L206: .data 362
+L207: .data 131, -126, 1, -58, 275, 51
+L208: .data 687, 235, -949, 257, -651, -272, 889
+jsr *r2
+L209: stop
+L210: .data 231, 835, 760, 343
+L211: .string "xx"
+L212: .string "plnvlmnzzeyzlrgmusjzwdxt"
+L213: .string "yvwqqjvaxut"
+prn L112
+L214: .string "jinigckcradbgwcehaouvtnd"
+cmp #-223, L283
+mov *r5, *r6
+L215: .data -936, -866, -257, 932
+jmp *r7
+jsr *r2
+L216: .data 17, -491
+L217: .data -419, 855, 522, 798
+red r6
+L218: add *r7, *r4
+L219: .data 762, 179, 491, -361, -587, 838, -74
+L220: .data -236, -172, 384, 699, 913, -358, 221, 15
+L221: .string "julvvclhd"
+L222: .data 392, 101, -48, -99
+L223: rts
+L224: lea L145, L60
+L225: .data 927, 564, 954, -125
+L226: .data -947, 882
+jsr *r6
+L227: .string "yndpgkohkkadwtwr"
+L228: .string "eyzcdcikmar"
+L229: .data -665
+dec r0
+L230: .string "psajnvjnvyibtjywcknog"
+L231: .data 71
+L232: .data 431, -423
+L233: .string "ietqdnei"
+inc *r4
+prn #-163
+L234: .string "vrrsubnlhzfeeklfhmxuewj"
+
+L235: .string "piwygbornqvcfridmz"
+lea L309, *r0
+sub #-215, L288
+inc L243
+L236: .data -772, -381, -145, -37, -212, 120, 199, 614
+L237: .string "vttniuuvqzazmzaob"
+bne *r4
+L238: .data 94
+L239: .data 287, 273, 544, 807, -448
+mov r1, *r3
+L240: .data -721, 156
+; comment
+L241: .data 304, -696, 200
+L242: .string "gpvryrrjdlkaahtltslgyd"
+add *r6, *r6
+L243: .string "ykd"
+bne L253
+L244: .data -172, -535, 405, -965, 471, -940, -759, -578
+L245: .string "mkhukvglgin"
+L246: .data -154, -927, -726
+jsr L48
+L247: .data -745, -374, -188, 152, -437, -227, 441, -772
+L248: not *r0
+
+dec r7
+prn L67
+not r6
+add #-165, L243
+L249: .data 99, 277, 468, -762, 127, 646
+L250: .string "vdltvsxozweybfmzaufzwzs"
+
+L251: .data -620, 667, -330, 921, 110, 160
+L252: .string "psumejzebyupooju"
+L253: .string "gzxmxwefqtwwuff"
+
+L254: .data -53, 341, -112, -350, 843
+cmp L282, r0
+L255: .string "imjmjwxbxug"
+L256: .data -578, -557, -352, 217, 75
+L257: .string "gvubfppezjzdx"
+L258: .string "vezsrej"
+L259: jsr L122
+L260: .string "ylwqkasdmwc"
+; comment
+inc *r4
+; comment
+L261: .data 566, 605, 558, -9, 424
+L262: .string "ezfqdh"
+L263: .string "ykzqtverdhhqckdlsvo"
+L264: .string "vfipuvlpshfumklma"
+L265: sub r5, r1
+stop
+L266: .string "stsrxrefysoyj"
+L267: .data -839, 995, -19, -503, -684, 983
+L268: .string "zyjiireltzogaxfphdjvl"
+L269: .data -658, 412
+L270: .string "mtqrrvwo"
+L271: prn L304
+sub #86, r3
+L272: .string "bbtxkmfbfflaqq"
+L273: .data -279, -38, -870, -183, 897, -756
+; comment
+L274: .string "avfnrwnsuwbazgjmlm"
+L275: jmp L133
+; comment
+L276: stop
+L277: .data -254, -913, 942, 385, -604, 705, 155, -866
+clr *r2
+L278: .string "yhmgttapckbuqtatftjpze"
+L279: .string "p"
+L280: .string "roawkriqsxhbopqscrwwa"
+L281: .string "hucyjxjdjx"
+rts
+L282: .string "eamweqadfjl"
+L283: .data 24, 860
+L284: .string "ompchemkkw"
+L285: not r2
+L286: .data -572, -120
+L287: .data 265, 38, -793, -202, -592, 958, -96, -368
+L288: .string "cwwxxnpfzrxrqqmkke"
+mov r3, L166
+L289: .data 350, -549
+L290: .data -417, 393
+L291: bne *r3
+bne *r0
+L292: .data 684, 985, 524, 863, 811, 180
+add r7, L294
+inc L305
+
+L293: .string "boo"
+prn r2
+mov #52, *r2
+L294: .string "xrueai"
+L295: .data 137, 27, -551, 790, 859, -750, -133
+cmp L310, r2
+; comment
+L296: .data -115, -697, -144
+; comment
+clr *r6
+L297: .string "toyccntlooeec"
+L298: .data -291, -110, -661, 455, -52
+lea L252, *r1
+jsr L266
+L299: .string "cllrlfiouypw"
+L300: .data 954, -565, -616, -507, 292
+
+L301: not *r5
+L302: jmp L309
+clr L304
+dec *r3
+L303: inc L308
+L304: .string "wxkxfcogpzs"
+L305: cmp L306, L40
+red L102
+L306: .string "turi"
+L307: .string "vlxxtjhbtkkapeiuydszsg"
+; comment
+sub L310, *r0
+L308: .data 811, 972
+L309: .data -255, 910, -821, 502, 94, 669, 209, -239
+L310: .data 82, -761, 477
+bne *r5
+stop
+lea L86, r3
+stop
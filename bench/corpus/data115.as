@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 116
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+stop
+L0: .data 969, -209, 613
+mov r5, L206
+prn #235
+L1: .data -49, 523, 465, -17
+L2: .string "srqtwmerfkedueapdfkmmi"
+L3: clr r3
+L4: .string "qviekivbmllmdqgs"
+L5: .data -428, 789, 417, -243, 607, -223, 681
+mov #158, L1
+L6: .string "mmxkny"
+stop
+L7: .string "rvgqofrkffg"
+L8: .data -585, 221, 11, 124, -451, 487
+L9: sub #-56, L56
+L10: .string "hgigjuxzfyhevxg"
+clr L293
+stop
+L11: add #-209, r0
+L12: .string "xzodoolj"
+L13: .string "co"
+lea L7, *r0
+L14: .data 523, 739
+L15: rts
+L16: .data -869, -303
+L17: .data -678, -448, -515, 741, 249, -754
+L18: .data -801, -597, -832, -831
+; comment
+L19: .data -473, 6, 966, 229, -231, -921, 323
+L20: .string "quavmbav"
+L21: .string "zxbahpywivpfxdkflneau"
+dec *r1
+stop
+L22: bne L11
+L23: .data 668, 506, 23, -10
+L24: .string "nxrcilbsfoovkqidj"
+jmp *r2
+lea L274, *r0
+L25: .string "jmmn"
+L26: .data -991, 153, -586, -171, -925, -655
+dec L23
+L27: .string "hqpahendbncuyv"
+rts
+
+L28: .data 530, 786, -125, 821
+L29: .data -206, -966, 713, -881, -520, 627, 883
+add L8, *r7
+L30: .string "yfuogfhkrcsap"
+L31: mov L280, *r1
+L32: .string "obahkqrqfyq"
+L33: .string "ayrqqflk"
+clr L106
+L34: .data 951, -878
+L35: .data -665, -665, 263, 74, -736
+L36: .data -326, 625, -506, 819, -614, -355, -459, -681
+bne L27
+L37: red r7
+inc r6
+L38: .string "aaqj"
+sub L84, r6
+lea L35, r2
+L39: .data -535, 928, -465, 517, -633, -233, -577
+L40: jsr *r2
+L41: .data 353, 881, -473, -613, -955
+L42: .data -953, 449, -886, -432
+stop
+L43: .string "pcykodoalndyessrztyicrwr"
+L44: .data -741, -36, 703, -656, -520
+L45: .data 828, -411, 812, 635
+L46: .data -798, 759, -529, 432, -463
+L47: .string "ptjerdz"
+L48: .data 192, -342, -277, -959
+inc L204
+mov L48, L28
+L49: .data -672
+L50: .data 4, 858
+L51: .data 320, -632, 391
+L52: .string "hfywasdwtstsgymqnkyqz"
+L53: .data -189, 562, 293, 742
+L54: .data 789, 70, -771, -511, 535
+L55: jsr *r6
+rts
+L56: .data 376
+L57: .data -561, 929, -710
+L58: .string "lifcqumjzfgqasmvvekugc"
+L59: .string "czwgwubpbjuagknh"
+L60: .string "acuqgibawbbqbkissmxqwzq"
+L61: .data -658, -30, -43, 988
+not *r5
+not r7
+stop
+lea L35, *r5
+L62: inc r5
+L63: .string "icvcgzzkattjefipsxjrhjx"
+L64: .string "tpbbmsugnaqn"
+jmp *r4
+L65: .string "iclmwvpmhqxfvvwvykgln"
+L66: .string "ncag"
+red L52
+L67: .data 794, 732, 613, 548
+L68: .data -389, 189
+clr r2
+prn #-110
+red *r1
+L69: .data -618, -856
+rts
+red L61
+L70: .string "voztsqjqsk"
+L71: .string "kazaxmchkhwytak"
+L72: .string "zxwrcmdahc"
+L73: .string "vsi"
+inc *r7
+L74: not r5
+L75: .string "pwurqwejjfx"
+L76: .string "ybmyqakikpvqls"
+L77: .string "pqqtfqfgzvkjmepwsbqdvx"
+L78: lea L136, L314
+L79: .data -268, -36
+inc r1
+rts
+L80: .string "dgvodenhhlzhf"
+L81: .data -499, 538, -61, -238, -361, -109, -527
+add #127, L279
+clr r3
+
+L82: .string "rgvribgffqixvnohbzirngu"
+; comment
+L83: .string "ybov"
+L84: sub r5, L260
+L85: .string "o"
+L86: .string "fdcfnzqwtvyvk"
+L87: .data -449, -529, -50, -761, -816
+dec L222
+L88: .string "zbebrqwqdmngaecgx"
+add r5, L102
+L89: .data -6
+inc L29
+L90: .string "rnyhzlyusjfgcqfki"
+L91: .data 356, 901, -395, 974, 700, -902, -132
+jmp *r7
+L92: .data -303, 539, -108, 496, 900
+L93: .string "ysdhhymmuucqpxpem"
+L94: .string "pyuwqtb"
+L95: .data -440, 782, 348, -906, 657
+L96: .string "szluiiolsevwtpehch"
+L97: add r5, L134
+L98: .string "rltifpwcevvzlpatokd"
+L99: .data -954
+cmp L158, L82
+L100: .string "nkhctonlqmrggn"
+L101: .data 476, 34, -718, 208, 971, 121, -725
+dec *r1
+L102: .data 568, -825, -749, -549, -612, 433, 608
+L103: .data -100, 373, 120, -429
+L104: .data -623, -813, 209, 802, -788
+L105: .data 594, -839, -209, -432
+L106: .string "mktjthmqvhpitcjqkfu"
+L107: .string "fkbpaxyqisbjvaj"
+add *r3, L14
+rts
+L108: .data -542, -778, -93
+inc r6
+L109: .data -773, -899, -292, 818, 927, 247
+inc L69
+rts
+L110: .data -151, -869, 336
+L111: .data 728, 392, 482, 849, 810, -732
+L112: .string "htr"
+
+L113: mov L94, L66
+L114: .data -362, 909
+add #-172, L38
+; comment
+L115: add #-78, r4
+L116: .data 297, 220, -416
+L117: .string "tsdotjmaj"
+jmp L179
+L118: .data -700, -959
+L119: .string "kotjbqlyyvvjvhqj"
+L120: .string "wynngklbknhiibrgkwmgq"
+L121: .data 449, -110
+dec *r5
+L122: .string "i"
+L123: .data -483, -255, 472, -644, -312, 864, -85, -345
+lea L12, L183
+L124: .string "wguflpskflithzmuo"
+L125: .data 802, 61, 12, 897, 568, 589, 568, -104
+L126: .data -824, 952, -746, 504
+L127: .string "idfnycksuzzcal"
+L128: .string "u"
+; comment
+L129: .data -149, 255, 705, -476, 155, -748, -208
+stop
+L130: .string "qiylsyjecpbbrntsb"
+L131: bne *r1
+jsr L241
+L132: .string "niparoyjln"
+jmp L267
+L133: .data -113, 114
+L134: .string "ripmqshbt"
+bne *r4
+L135: .data -641, -899
+L136: .string "haufr"
+L137: .data 306
+bne *r0
+L138: .string "qoqurjqspyqfvi"
+L139: .string "hyovqufbk"
+L140: .string "nkzapfzslseukoux"
+L141: .string "ec"
+add r1, *r4
+red L266
+rts
+mov r3, *r4
+L142: .data 910, -361, -91, 137, -6
+L143: .data -504, 481, 237, 624, 759, -230, -602, 764
+jmp L9
+L144: red *r5
+dec *r1
+stop
+add #218, r6
+dec r5
+dec r4
+L145: .string "fua"
+bne *r6
+L146: .data 871, -332
+sub *r2, L245
+L147: .data 834, 803, -199, -906, -517
+stop
+L148: .string "tzwzqqrowngerovm"
+rts
+L149: .string "otxar"
+; comment
+L150: .data 282, 151, 774, 490, -764, 747, 667
+L151: bne *r2
+L152: .string "ogbhikxbenwzobrmij"
+L153: .string "ocnjkxgnkmcwmuwa"
+L154: .string "mngcdhoewqsidntlelh"
+L155: .data 928, 308
+L156: .string "roafvqqbsutbtzkfhkgyzu"
+L157: .data -896, -965, -184, 205, 993
+L158: .string "urnlr"
+prn r7
+L159: .string "qqapypyoreiqpedpaqg"
+jmp L3
+L160: .string "uyvujhwdhcsnnuemxwx"
+lea L272, L62
+lea L228, r6
+
+L161: .data -576, 337, 912, -335, -191, -205, 862
+prn L251
+L162: .string "zllhwoey"
+L163: .string "hihivcfdpklcrmyidmgns"
+L164: .data 204, 722, -572, -127, 460, -949, 77, -230
+L165: .data -48, -832, 763, -907, 311
+L166: mov #251, L265
+L167: .data -702, -286, -986
+cmp r1, *r5
+red r0
+L168: .string "bfllwviqwrkiavwa"
+L169: .string "mmdkxkxvb"
+L170: sub r6, *r5
+cmp #-130, r6
+L171: .data 726, -937, 498, 103, 139, 463, -339, 871
+L172: .string "xhyhwoy"
+L173: .string "gbyfzrmvoaqipxznyyvhtep"
+jsr L318
+L174: .string "hiatdwoegspkwofzf"
+L175: lea L42, *r1
+inc *r1
+cmp r6, *r5
+
+stop
+L176: .data -856, -404, -284, 246, -198, -960, -316, -562
+not r3
+L177: .data 739, 668, -999, 306, 622, 224, 297, -244
+L178: .data 154, -342, 248, 877, -153, 315
+clr *r7
+jsr *r1
+L179: cmp L171, *r7
+L180: .data -5, 598, -113
+L181: inc *r5
+L182: .string "emputvewfljwfsywaelfsoxq"
+L183: .data -142, 59, -473, 697, -830, -733
+L184: .string "ykcatuktbliyuetzaclsa"
+L185: .string "a"
+L186: .string "zrgkjfkxrplnagqpkpevzfn"
+L187: not L45
+L188: .data -487, 234, -363, -257, -264, 683
+L189: mov *r5, r3
+L190: .string "pacjwesoluaisklivizmhtxl"
+L191: .data 370, -151, 754, -367, -907, 166, 103, 313
+L192: .data -245, 915, -399
+L193: .string "frflbemvnopnvekhnc"
+prn #-236
+L194: prn L207
+L195: .string "n"
+L196: .data 804, 503, 826, 202, -388
+; comment
+L197: .data 664, 728, 393, -760
+L198: .data 445, 325, 885, 169, -34, -768, -166, -143
+L199: .data 143, 467, 856, 225, 869, 9
+L200: .string "wvbpnecjgjvo"
+lea L144, r2
+L201: .string "lafykpjjhejtp"
+L202: .string "uyu"
+stop
+L203: .data 256, -379, -237, 198
+L204: .data 18, -938
+L205: .data 868, 699, 890, -45, 813, -615, -270, -60
+L206: .string "gamzixngoxumns"
+add L249, r1
+L207: .data 847, -159, 178, 829, 419, -264, -773
+L208: .string "nsqz"
+red *r3
+; comment
+dec *r3
+
+prn L296
+L209: .string "upfrdepkyznwaoqoubvm"
+L210: .string "mxghgvtponyjbrzic"
+L211: .data 118, 882, -423, 907, -861, 379, -631
+L212: .data 104
+not *r2
+L213: .string "hiofeoffgav"
+
+L214: .string "inr"
+bne L163
+L215: .data 174, 2
+not L93
+L216: .string "ai"
+L217: .data 796, -217, 583, 472, -970, 70, 103, 886
+jmp *r2
+L218: .data -430, -424, -525, 101, -832
+L219: .data 442, -744, 271, -106, 768, -160, -903
+L220: .string "rapnkimxaivkgzxzboqc"
+; comment
+L221: .data -181, -140
+L222: .string "xwdjcpro"
+L223: .string "lhxjosfkuabmtqfbtwbbcaca"
+mov #19, *r4
+L224: .data -303, -572, -508
+sub r5, r5
+L225: .data 545, -96, -867, -528, 830, 423, 575
+bne *r7
+L226: .data 442
+L227: .data -292, -459, 596, -55, 358, -708
+; comment
+L228: .string "v"
+not r4
+L229: .string "bv"
+L230: .string "z"
+L231: .string "ncyitsv"
+L232: .data 688, -628, 519, 139
+L233: .string "uesqtmxvvthsrsdibbvqhf"
+L234: .data -607, 653, -448, -900, -907, -241, -234, -487
+L235: .string "prouvhsa"
+L236: .data -47, -478, 156, 145, 533, -425
+clr *r6
+L237: .string "rfztlbnamedsf"
+L238: .string "twvujm"
+clr r5
+L239: .string "snck"
+L240: .string "nscefuriyvopcibojfaygtk"
+red *r3
+L241: dec *r4
+L242: .data 203, 162, -26, 623, -283, -493
+jsr L170
+L243: .data -846, 331, -896, 616, 769, 688
+cmp #-189, r3
+L244: .string "xixthvrrpdfkjl"
+L245: bne *r7
+L246: mov *r0, L144
+clr L315
+prn r6
+L247: .data -874, -386, 222, 75, -236, -381, -40
+stop
+
+cmp r6, *r1
+add r0, r2
+L248: .data 758
+L249: .data -106
+L250: .data 254, 973, 952, 233, -741, -491
+L251: .data -191
+L252: .data -357, -652
+L253: .string "ymfuzogvcb"
+L254: .data -442, 873
+L255: .string "cjgjpacwn"
+L256: .string "exdbijof"
+dec L143
+L257: jmp *r6
+L258: .string "wgeorupprbsyspvwlyklc"
+L259: .data 429, -349, -776
+L260: .string "wttjonyhvfyhx"
+mov #148, L132
+L261: .data -568, 0, 594, 800, -51, 253, -977, 590
+L262: .data -307, 655, -594, 130, -185, 543, -689, -733
+L263: .string "zmjfoxtlchtghkxqe"
+L264: prn L248
+L265: .string "ywzgvvotnhj"
+jmp *r4
+L266: .data 104, 50, -467, 813, -430, -819, -936, -856
+L267: .data 712, -71, 431, -984, -412, 329
+add #-187, L232
+L268: .string "nadqlvf"
+L269: mov r6, L311
+lea L132, *r1
+L270: .data 445, -321, -301, -591, 951, 138, 588
+not r1
+jsr *r4
+
+L271: .data 315, 545, 776, -268
+L272: .data -841, 907, 647, -707
+sub *r6, r5
+L273: .string "ecppwgimcwfbikjjncakwcgw"
+L274: .string "awucpzuvfxvcrjj"
+L275: bne L295
+L276: .string "opznahszkknn"
+L277: .data -644, 703, 281, -891, 376, 451
+L278: .data -594
+L279: .data -300, -585, 810, 377, -433, 183, 150, 541
+L280: .string "gmfmgeylfjgwsctrkiik"
+dec r6
+L281: .data 792
+L282: .data -773, 71, 576
+L283: .string "xdkdotitpfgbeiyuhtc"
+L284: .string "uennezgbw"
+L285: .data 479, -555, -113, -425, -74
+L286: jsr *r1
+L287: .string "pnnmkvhojzsyxfkmcw"
+L288: .string "ozsohodhiupwmcmjdekbva"
+L289: .string "qibjhhaom"
+L290: .string "vjhdvmpygwtygqafajufuvnq"
+stop
+prn #16
+mov #95, r6
+; comment
+L291: .data -880, 917, -866, 495, 902, 131, 995, -105
+clr L294
+L292: .data -172, -896, -85, 630, 399, -617, 532, 712
+L293: .data 343, -307, 885, 654
+L294: .data 162, 739, 680, -28, -502, -847, -111
+L295: .string "smzatvtxrxsteeqixi"
+L296: .string "pzayvjldzydvakous"
+L297: lea L69, L123
+inc r1
+L298: .string "hrsyw"
+L299: .string "yrirmzzfnynlfp"
+
+L300: .string "mupbytnkuhxrn"
+mov #88, *r4
+inc *r5
+L301: .string "juhxdqslhiqllajmpcozuhh"
+L302: stop
+not r6
+jmp *r0
+L303: .string "cnghesznjplvwlttj"
+; comment
+L304: .data -513, 804
+L305: .string "rntgmmpcopfxt"
+L306: .data 725
+prn *r2
+prn #214
+jsr *r6
+L307: .data 914, -953, 458, -199, -642, 318, -980
+not *r6
+L308: .data 641, 234, 173, -42, -784, 216
+L309: .data -522, 105, -108, -808, 136, 171, 324
+L310: .data 637, 983, 796, 755
+
+mov #57, L314
+L311: .data 442, -102, -383
+L312: .string "ghifvmrevzqlnmslhg"
+L313: .data -183, 18, -960, -823, 962, -672, 906
+L314: .data -349, 390
+L315: .data -228, 737, -685
+not *r7
+L316: .string "vnsuagcoppgvk"
+L317: rts
+add L318, r5
+L318: .string "mdrlqxpjcdzmjmwyoqg"
+
+sub L321, *r7
+
+mov r0, *r1
+stop
+L319: .string "ipergnkqujcyglnusakga"
+
+L320: .data -707
+L321: .string "sujrblozoughqxindtb"
+L322: .data 128, 86, -911, 410, -144
+L323: .data -389, -817, -175, 964, 660
+L324: .string "azdzhbh"
+jsr L325
+L325: .data 767, 558
+L326: .string "hxpyqpuqavrttgtxu"
+rts
+dec *r4
+L327: .data -422, 158, 146, 262, 781, 867, -774
+L328: .string "o"
+L329: .data -144
+stop
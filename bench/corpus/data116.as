@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 117
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .data 272, -757, 386, 59, 564, -732
+stop
+L1: .string "ggiguhpy"
+rts
+red *r4
+L2: .string "winctbzpxbsrhcmqbzuxuykp"
+not r2
+inc *r7
+L3: .data -324
+sub L155, *r2
+L4: .string "sibkaywcywiciuqhckxg"
+prn *r1
+L5: .data 437
+L6: .data -1000
+L7: .data 932, -60
+clr *r0
+L8: .string "tlzecfsrzmwgijbd"
+L9: bne L0
+cmp #72, L86
+L10: inc *r5
+lea L185, *r2
+L11: .string "eg"
+L12: .data 698
+L13: .string "snrcouaglwglearhnjgp"
+add *r5, *r4
+L14: .data 666, -228, -887, -593, -44, -16, 777
+dec r4
+mov L286, *r1
+inc r2
+jmp *r6
+not L5
+L15: .string "dfhwtgvaxuobcznsdtxafw"
+L16: .string "fcjtgrzqowyucxdrokbgj"
+
+L17: .string "dcixkxbh"
+L18: .string "dpkadlzztnicbjwmwl"
+L19: .data 65, 932
+rts
+L20: .string "crqsaxrwshinaoauxc"
+L21: .data -273, -422, 906, 430, 274, 976, -717
+L22: .string "onfmaxjt"
+not *r3
+L23: .string "ewewxqgm"
+
+L24: .string "sf"
+L25: .string "qmhdopvqvybgwrsmp"
+L26: sub *r5, *r6
+L27: .data -261, 827, -252, 194, -692, 275
+L28: .string "kvaijrnlarbnxlfcpwwj"
+L29: .data 694, 578, 75, -118
+red r2
+L30: dec *r2
+L31: .data -610, 70, -946, 180, 289, 498, 370
+L32: .string "hqlodpbhefp"
+
+L33: .string "uigf"
+L34: .data 549, 42, -221, 305, -504, -538, -335, 381
+inc *r4
+L35: .data 569
+lea L26, *r0
+L36: .string "plibaeaouy"
+L37: inc r0
+L38: .string "kdhmrtxwoqncywi"
+L39: .data 575, -950, -44
+L40: .string "qvqkeg"
+L41: .string "nqpzgdggfinzjegotfrjaes"
+sub #-16, L62
+L42: .string "okgltghgjrkudwttw"
+L43: .string "jvuiocrcgvhqokzpitabi"
+L44: .data -894, 814, 771
+L45: .data 809, 144, 515, 633, -608, -713, -357
+L46: .string "zsbkekzqege"
+red *r2
+clr r6
+L47: .data -582, 453, 574, 872, -340
+L48: .string "tonyjbbtavznnvbpap"
+L49: .data 697, 981
+; comment
+L50: .string "cgxscxhjlptdplomvmwpnj"
+L51: .string "ygs"
+lea L113, r1
+L52: sub #-43, *r3
+L53: .string "ksdrryzrinvtixxynhsgb"
+prn r4
+L54: sub r7, L39
+L55: .string "zb"
+
+L56: .string "limpsclhbqbblzgfldsuqlm"
+bne *r5
+L57: .data -281
+L58: .data 934, -691, -487, 1, -435
+L59: jsr *r2
+jsr *r6
+L60: .string "tnebdkz"
+bne L45
+L61: .data -596, -872, -564, -808, 690, 959, -395, -924
+cmp *r3, r2
+L62: .data 723, 759, 378, -642, -750, -45, 584
+L63: .data -423, 590, -600, -238, -183, -745
+L64: not L22
+bne L51
+L65: .string "zjvvvrewygksgwobjsos"
+rts
+L66: .string "ijdtqbraxgxmgjkqhajwnqd"
+L67: .data -927, -901, 738, -573, -264, -277
+prn r0
+stop
+L68: .data 408
+
+red r3
+L69: .data 682
+L70: .string "hqrsoiurmnrfhvls"
+; comment
+L71: .data 266, -19, 773, 131
+L72: .string "vzgaftuo"
+red *r1
+L73: clr r0
+add L68, L196
+L74: .data -516, 638, 552, -485
+prn r2
+rts
+L75: .data 34
+L76: clr *r7
+L77: .string "aqbdbdopzrpntzfhfgrdt"
+L78: .string "bpigpfe"
+L79: .data -741, 252, 266, -34, 208
+L80: .string "fxuz"
+L81: .string "clzxsngnxkvsxhxps"
+L82: .data -683, -349, -904, -928, 355, 843, -72
+jsr *r3
+not L278
+bne L142
+L83: .string "ehfbdwxkteqmsercqr"
+L84: .string "akzuyjjnpifyde"
+L85: inc r7
+inc r3
+rts
+stop
+; comment
+L86: .data -997, -170, 156, 772
+not *r3
+stop
+L87: .string "nscx"
+L88: mov r5, L141
+L89: .string "jiqsdtloiaspoyixuecbyf"
+not *r3
+L90: .string "yrd"
+dec L130
+L91: .data -942, 724, 312, -236, -840, 27
+L92: .data 375, 129, -593
+
+add *r4, r3
+inc *r7
+inc L21
+L93: .string "zwobqaoj"
+L94: .data 602
+cmp *r3, *r0
+; comment
+L95: .data 189, 873, -159, 39
+L96: .string "f"
+L97: .string "kyhsfz"
+jsr L164
+dec *r1
+L98: .data 292, -135, 684, 443, 978, -650
+L99: .string "vsnutheyfykwozyrtedph"
+L100: .string "oveav"
+stop
+L101: .data -701, -23, 747
+L102: .string "zu"
+lea L257, L131
+L103: .string "ywrwghvwmdztc"
+L104: .data -39, -399, -896, 311, 539
+jmp *r5
+L105: inc r0
+L106: .data -566
+; comment
+L107: .data 577, -586, -736
+not r2
+L108: .string "bkzldtciymyis"
+lea L47, L163
+L109: .data -96, -766, 998, 730, 17
+add L301, *r7
+L110: .data 340, -498, -868, -316
+L111: .data 711, -756, -684, 44, -920
+L112: .string "udeksfrqdapjvzhmqoy"
+L113: .data -159, 620, 314, 210, 245, 845
+L114: .data 54, -621, -634, -839, -785, 595
+inc r3
+L115: .string "oaoll"
+bne *r3
+L116: .string "vmyokpxnzjwr"
+L117: .string "uovythqphe"
+L118: .string "vmritleyskppqp"
+L119: .string "vkmewyhqdfieozanwxyecsg"
+L120: .string "kcyvacvxpdnwfbcug"
+L121: .data 937
+L122: .string "tpunroadnpidxonhga"
+L123: .data -334, 957
+L124: .string "fusuvijoisktgmbxdkajva"
+L125: .data -531, 335
+L126: .string "yapnoavbvthmmr"
+L127: .data 7, -167, 314, -922, -756, 461
+L128: .data 598, -177, -194, 703, 834, -541, 849
+L129: .string "zxywexeunmmvdqyhxng"
+L130: prn r1
+lea L63, *r6
+L131: .data -218, 717, 957
+L132: .data -776, -698, 662, -447, 619
+L133: cmp L269, L108
+L134: lea L36, *r5
+L135: .data 694, 595, -443, 835
+L136: .string "ginpusz"
+L137: .string "d"
+red L24
+L138: .data 560, -914, -471, 728, 991, 344
+L139: .data -579, -115, 735, -995, 542
+L140: .string "tcjiodtlpwkrxxzxofzsee"
+bne *r6
+L141: .string "rczbhcbrc"
+L142: .string "cefcvopscrilkt"
+L143: .string "kmekdvtwfttmuomzsvx"
+L144: .data -460, 802, 680
+L145: .string "zvwzrhgspkipue"
+L146: .data 718, 816, 268, 889, 659, 757, 497
+L147: .string "ycqourv"
+prn r3
+L148: .string "mhgpangwkmgrmooflpoiqyod"
+red r4
+L149: .string "cmaun"
+L150: .string "bdnwuignkooyrbkzwppce"
+not *r0
+rts
+L151: .string "kitoxwpjwhzwbfh"
+L152: .string "bjkzyzpykouisbmiasro"
+rts
+L153: .data 96, -218, -633
+L154: .data -995, 236, 948, -42
+L155: .data -698, 548, 461, -583, -158
+L156: .data -198
+L157: .data -700, -94, 768, 236, -7, -404, -16
+L158: .string "ujrurmsmpuypmp"
+L159: .data -608, 665, -186, -814, -522
+L160: .data -670
+L161: .data -712
+jmp *r3
+L162: .string "vgtszuggifuyfq"
+lea L123, *r1
+inc *r6
+L163: .data -685, -380, -346, 47, 904, -693, -352
+L164: .string "pnijkjdrzsvceylr"
+add *r3, r2
+L165: .string "ovhiivfezlnrbws"
+prn *r1
+L166: .data 935, -395, -581
+rts
+jsr *r2
+L167: .data 197, -531
+L168: .data -10, 715, 462
+bne L325
+L169: .data -194, 106, 549, 488, -549, -601, 853, -32
+dec *r6
+L170: dec r1
+L171: .data -521, -666, 465, 632, -301
+L172: .string "yapeycfofehrcwjzdshc"
+bne L86
+
+L173: clr r5
+L174: .data 416, 521, 464, -873
+L175: .data 886, -944, 110, 412, -122, 400, -400
+L176: .data -357, -557
+L177: .string "qvpkdqmrelhxy"
+L178: .data 586, -606, -373, -136, -343, 734, 795, -44
+lea L163, r0
+L179: .data 597, -135, 653, -813, -652, -360, -564
+L180: .data -840, -295
+inc *r1
+L181: .string "ngzg"
+L182: .string "syivwrtkcaforjoashz"
+prn L272
+cmp *r4, #67
+L183: .data 763, 81, 3, -335, -509, 332, 208, -396
+prn L56
+L184: .string "broixppamm"
+jmp *r2
+dec r1
+L185: .data 77, -903, 351
+L186: .string "twndrms"
+L187: .data -231, -457, -407, -154, 359, -459
+L188: .string "gpfcr"
+L189: .data -208, -328, -925
+L190: .string "xfdwcfyaeulibxr"
+; comment
+clr *r2
+L191: .data 680, -463
+L192: .data -117, -730, 658, 514
+prn #-84
+L193: .string "kljetliytubpyrrst"
+L194: .data -701, -30, -994
+L195: .string "esguuypndmxcxb"
+L196: jmp L45
+L197: .data -417, 576, -441, 516, -642, 416, 614, -383
+L198: stop
+L199: .data 467, -503, 124, 218, 606, 543, -334, 872
+jsr *r4
+add r0, r5
+red *r5
+inc L129
+L200: .string "nhrmzppdahsxer"
+L201: .data -707, -128, 355, 35, 579, 318, -760, -865
+cmp r7, #-198
+L202: .data -808, 436, -673, -952, -549, 691, 377
+L203: .string "ptfbcdugkqxpmay"
+L204: .data 455, -322
+red *r7
+L205: .data -370, -378, -353, -238, -125, 47, -700, -470
+; comment
+L206: .data 830, 314
+L207: .data 332, -923
+L208: .data -77, -676, -574, 97
+L209: .data 138
+L210: inc r0
+L211: .data -699, -424, -229, 184, 409, 598, 303, -602
+L212: .string "lclepyh"
+
+
+L213: .string "l"
+L214: .data 301
+not *r0
+L215: .string "eljuqfpbqalsverbtayy"
+L216: .data -102, -503, -448, 392, -310, -52, -332, -843
+L217: .data -735, -753, 487, 358, -405, 328
+L218: .string "prqqmiwxbh"
+
+L219: .string "nzhdiih"
+L220: .string "wzgbgwgkvazvp"
+L221: .string "fjigu"
+L222: .data -593
+dec L98
+L223: .data 104, 113, 60, 987, -821, 500, 744
+mov #157, r4
+add *r0, *r1
+L224: .string "fsga"
+lea L197, L155
+rts
+L225: .data -388, 80, -261
+L226: not r1
+L227: .string "j"
+L228: .string "klakvmtnbasjxwk"
+L229: .data -648, 907
+L230: .data 756, 2, 838, 88, -952, 635, 102, -699
+jmp *r6
+prn #176
+jmp L116
+L231: .data -490, 924, -160, -663, 912
+L232: .data 962, -466, -412
+L233: .string "zui"
+L234: .data -755, -521
+dec *r5
+L235: rts
+L236: .string "igybvnlodwushmz"
+L237: .data 458
+L238: .data -192, -843, -761, -1, -602, 490, 140, 487
+L239: red *r1
+L240: .data -664, -327, -850, -418, 867, -685, 866, 35
+L241: .data 339, -566, 678, -721, 733, 489, 320
+L242: .string "f"
+stop
+add r7, *r3
+L243: .data -381, 518
+L244: .string "vndbaiarhwixhylz"
+L245: .data 986, 167, -395, -497, -748
+cmp #68, L247
+L246: .data 430
+L247: .string "azbkwwijcliy"
+L248: .string "akbhyexjhsydtnyxvx"
+mov #-252, r4
+L249: .data 732, -100, -751, -992, -15, -843, -655
+L250: sub r7, L272
+L251: .string "cmdmtnccstoyk"
+L252: .data -741, -989, -723, -684, -6
+L253: .data -161, 742, -529, 547, 72, -36, 137
+L254: .data 409, -638
+L255: .data -855, 303, -217, 70, 602, 794
+clr r0
+prn #235
+L256: .data 738, 814, 701, -535, 842, -226
+bne *r0
+red *r3
+L257: .string "sypiofotqkrzgdtdcjdyx"
+L258: .data -454, -609, 977
+; comment
+L259: .data -324
+L260: .string "owdbcsoimucwbpoxtdy"
+L261: lea L142, L288
+L262: prn r1
+L263: .data 638, 830, -810, 576
+jmp L318
+L264: rts
+L265: .data -814, 529, -49, 782
+L266: clr L322
+clr r3
+L267: jmp *r0
+bne L290
+L268: sub #178, L277
+L269: .data -891, 613, 162
+L270: .string "hnxohe"
+jmp *r4
+L271: .string "rofgvt"
+mov *r3, L287
+L272: .data 972, -345, 318
+L273: .string "viukojewgjzftqjdecqqewf"
+; comment
+L274: .string "mrmytgmpx"
+L275: .string "zcgenxmifebkemebzz"
+lea L159, r1
+L276: jmp L311
+rts
+prn r3
+bne *r2
+lea L243, r3
+cmp #-245, r7
+not *r5
+L277: .string "wy"
+
+L278: .data -250, 388, -816
+rts
+L279: mov *r5, r2
+L280: .string "nbazdjrykz"
+L281: .data 558, -441, -108
+jsr *r4
+jsr L262
+L282: jmp *r1
+inc *r4
+clr L28
+jmp L156
+L283: .string "yrgjkrajoyencsflg"
+stop
+dec L316
+L284: .string "cithyhzcovbrebxgtu"
+L285: .data 647, 365, 657, 496, -370, -91, 883
+L286: clr r4
+L287: .data 128, 364, -152, -588, -58, 931
+prn r1
+L288: .data -635, 551
+prn r5
+L289: .data 764, -190, 719, 19, -677, -421
+lea L270, *r4
+L290: .string "tl"
+L291: .data -144
+L292: .data -225, 566, -306, -577, 629, -72, -568, -245
+cmp r3, *r2
+L293: .data -294, 927
+add L312, L302
+L294: clr L215
+L295: rts
+; comment
+L296: sub r4, *r5
+L297: clr L314
+L298: .data 850, -818
+L299: .string "sqzoryysxawjpuuwhlftdl"
+; comment
+L300: jsr *r7
+lea L250, L71
+L301: .string "msbelunhgdffhqndobz"
+prn L318
+L302: .data 276, -892, 341
+jmp L189
+mov L306, L76
+L303: .string "hvolmjpofmfzwf"
+L304: .data 159, 392, -478, 487, -389, 474
+L305: .string "ztdqidlrrvoecgk"
+L306: .data -981, 18, -906, 772, 791, -321, -146, -960
+L307: .string "el"
+L308: .data 452, 535, -243, -868, 126
+L309: .data -968, -779, -927
+L310: lea L316, L55
+sub *r0, L317
+L311: jmp L44
+L312: .string "fgvmobpttzlztg"
+L313: .string "zqwzokcmrocqsgmkcdnh"
+; comment
+L314: red L252
+L315: .data 221
+bne *r4
+dec L323
+L316: .string "yl"
+sub #150, r0
+lea L324, L324
+L317: .data 829, 782, -549, 436, 551
+L318: .data 48
+L319: .string "pclbzo"
+; comment
+sub L326, r0
+L320: .string "tdgbdckxgj"
+L321: .data 165, 412, -830, -375, -730, 851
+L322: .string "ejblzgqlfgalutv"
+L323: .data 912, -8, 474, 759, 411, -231
+L324: .data 904, -736, 813, 760, -798, 958, 931
+L325: .data -715, 226, 704, 830, -32, -192
+L326: .string "rtokhmdkymwxgwblwfpht"
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 118
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+not L154
+L0: .data 137, 62, -409, -770
+dec r4
+L1: .string "fdjzbvtbjzsrtffzygrutc"
+L2: .string "mpjxefnrlnqpsobfotfejij"
+add L2, r7
+L3: .data 566, 85, -812, 64, 29, -356, 656
+bne L1
+L4: .data 714, -179, -112, -637, -851, 712, -986
+L5: .string "wvpdecemahfsmacq"
+lea L4, *r4
+L6: .data 128
+L7: .string "ekte"
+rts
+L8: .string "buhkxxurrmaujzmgpxfbb"
+L9: prn #-203
+mov L1, L260
+L10: .data 67, 675, -979, -802
+L11: .data 236, -508, 926, -597
+clr r5
+L12: stop
+L13: .string "dtxncabajqimhtnrj"
+rts
+dec r5
+sub *r5, *r4
+rts
+L14: .data 259, 708, -305
+L15: .data 876, -35, -775, 805
+cmp *r5, *r6
+L16: .string "srueggzumtclwsa"
+L17: .data -644, -709, -739, -7
+L18: .string "cicpdrhfuefdmhzv"
+red *r0
+L19: .string "cvbgttvnaqwwzhusbmq"
+L20: not *r7
+L21: .string "qdrsxplwrqwrwctsydvbadkz"
+L22: inc *r5
+L23: .string "avriyjxnwflnuum"
+L24: dec *r7
+L25: .data 624
+stop
+L26: .string "ounrlvezymuslkaxi"
+L27: .data 444, 625, 352
+
+L28: .data 34, -347, 399, -948, -359, -688, -153
+L29: .data -497, 8, 413
+L30: .string "cutxeolaffs"
+L31: .string "awkmhkvhcvtrekratk"
+L32: .data -473, 995, 432, -514
+
+L33: .string "op"
+L34: .data -611
+add *r5, r3
+L35: .data -36, 99, 96, -524, 351, -915, 802, -645
+L36: .string "vtsbwxyyajjxkey"
+L37: .data -940, -895, -795, -375, -277, 282
+sub *r4, L219
+L38: .data -683, -259, -490, -622, 288, -161, -643
+L39: .data -238, -443, -789, -271, -72, -926, -727, -586
+L40: .data 55, 69, -648, -705, -378, -140
+L41: .string "weegpqvh"
+; comment
+L42: .string "bmxbr"
+L43: .data 669, 310
+L44: jsr L4
+L45: .string "ivpawgq"
+L46: .data 299, -621, -377, -382, -725, -65, 700
+L47: .data 68, 989, -439
+L48: .string "hvpxocuuvuifljhtwx"
+L49: .data 287
+L50: .data 354, 372
+L51: .data -933, -765, -675
+L52: .string "tksboioqdabmeba"
+dec *r7
+cmp *r0, #-162
+rts
+L53: .string "wlygpijochclqvyvsouqqhey"
+L54: .string "oxnprquzuiykrdcmvd"
+red L29
+inc r0
+L55: .string "mcbwhfqoqiaetosxnjvpji"
+L56: .string "fsrngpexjy"
+L57: .string "gdbtcrgsxmbc"
+L58: .string "utlthvhvyiqw"
+rts
+not L9
+clr r4
+L59: .data -297, -819
+L60: .string "vm"
+L61: .data -631, 243, -209, 989, 859, 571, -682, -617
+L62: .string "ccksbishdy"
+L63: mov r3, r4
+L64: .string "zdoapw"
+red r0
+L65: .data -454, -949, -939, -971, -766, -521
+L66: .data -98, -75, 604, -639
+L67: .data 797, -242, -427, 16, 111, 534
+L68: .string "wzufn"
+L69: .string "b"
+jmp L159
+L70: .string "gapzpwgkvhy"
+L71: .data -810, 70, -138, 23, 250, -74, -174, -781
+L72: .string "ebfiysmdzplasye"
+jsr L59
+red L145
+rts
+cmp L29, L138
+L73: .string "yzvjuehhmqc"
+clr *r7
+
+L74: .data -759, -295, 202, 53, -963, -73, 259, 970
+inc *r2
+L75: .data -383, 436, 172, 833, 96, -110
+dec *r5
+L76: mov #154, r0
+L77: .string "mucn"
+L78: .string "nwgc"
+lea L93, L132
+L79: .string "gnhfkujbzrugqhilktuhjzz"
+L80: .data 825, -909, -261
+dec *r2
+inc r1
+L81: .data -207, -979, -93, 639, 593, 255, 759
+L82: .string "uavpwt"
+cmp L254, L68
+cmp *r0, L142
+inc *r2
+inc r6
+stop
+L83: .string "utja"
+mov L55, L30
+red L9
+L84: .data 22
+red *r5
+L85: .data -550, -175, -994, 227, 176, -264, 540
+sub *r2, *r0
+cmp L147, L274
+L86: .data 662, -756, -142
+L87: .data 500, 11, -364, 339, 414, 862
+L88: .data -797, -531, 942
+bne L69
+L89: .string "niqgeuxiwekpufhfeoij"
+L90: .data -558, 927, -616, -626
+L91: inc L73
+L92: .data -832, 761, -278, -368, -880
+L93: inc r6
+L94: .string "iawbavjxtgciekl"
+not *r1
+L95: .string "qgzwpfzkzjhuziuvtzycsg"
+mov r1, r3
+L96: .string "gkpovlbhftydxtqifty"
+prn L262
+red L32
+; comment
+L97: .data 54, -134, -638
+L98: .data -820, 254, -761, 612, 87, 425, -899
+L99: .string "jvvkfpqszzmxaxz"
+sub *r4, L49
+L100: .data 414, 270, 150, 405, -993, -603, 453
+red *r1
+cmp L34, #-98
+L101: .data -904, 372, 816, -154, 503, -637, 821
+jsr *r7
+dec *r7
+L102: .data -429
+L103: .string "kpjuttkzaydqlwf"
+L104: .data -55, 295, -921, 360, -888
+L105: .string "cuycwsjr"
+L106: .data -733, 235, -566, 909, 191, 554
+L107: .string "qeghf"
+L108: .data 458, 634, 807, -190, 271, 779, -312, 266
+L109: .data -452, -155, 520, 834, 874
+inc *r5
+L110: .string "wsnzpjyzzsxdpgs"
+stop
+lea L76, r3
+L111: jsr *r3
+not L247
+L112: .data 771
+L113: .string "e"
+sub r2, L143
+lea L107, *r0
+bne L111
+L114: .string "wwzntxltxzphmwmqt"
+L115: .string "uocsiune"
+; comment
+L116: .string "cpsuhcwdkkpguird"
+L117: .data -903, 986, 294, -399, 168
+L118: clr L108
+L119: .string "zflumaxnetxewfid"
+L120: .data -452, -460, 43, -507, -44
+L121: .string "npujfyqsdqkjsnag"
+dec L191
+jsr L8
+L122: .data 919
+not r7
+L123: cmp r5, L278
+L124: .string "xuaurqphxwmrhqp"
+stop
+L125: .data -381, -148, 47, 843, 134, -882
+L126: .data 951
+L127: .string "ohmaocgsbzxyvtxlboaxw"
+L128: .data 988, -884, 855, -878, -165, -371
+L129: .data 305, 141, -73, -251
+L130: .data -288, -633, 701, 749, -204, -285, -240
+L131: .string "x"
+; comment
+L132: .data 689, -696, -581, 399, -856
+red r5
+L133: .string "o"
+mov L49, L216
+L134: .string "fdutxiyclqhhhsyzssko"
+not *r1
+not *r5
+L135: .data -221, -779, 807, 658, 698, -284, 341, 908
+L136: .string "kszlvmztlocgwaccbk"
+L137: .string "adgnukwslh"
+L138: .data -451
+add #-169, *r0
+L139: .data -442, 968, -129, 426, 466, 786, 475
+L140: .data -236, -391, -987, -875, -791, -552
+inc L313
+prn r5
+L141: .string "evfayvyq"
+L142: not *r0
+jsr L301
+stop
+L143: .string "ehtztrfrznrbt"
+L144: .data -64, 529, -376, -690
+L145: .string "txfbqoryfjntr"
+not *r7
+L146: .data 114, -472, -420
+L147: .string "axvgkqnqnbtv"
+L148: .string "fpqvsortlpduqoa"
+L149: .data 213, -93
+L150: .data 970, -809, -700, -361, -357
+sub r0, r7
+L151: .string "iqkzqzfuiwttytadppinbmyi"
+jsr *r7
+bne *r7
+L152: .string "tlvoblmapotasutmovhyqi"
+dec r2
+dec r4
+mov #-44, L308
+lea L176, L165
+L153: .string "jgpwin"
+red L67
+L154: red L13
+L155: .data 770, 550, -658, 523
+L156: .data -338
+L157: .data 933, -67, -551
+clr r1
+L158: .data -263, -7, 827, 942
+sub r4, L213
+L159: .string "txntheq"
+jsr L63
+bne *r1
+L160: .string "cfwzehlnvxgovhayal"
+L161: .string "lewpht"
+L162: .data 118
+jmp L180
+dec r7
+L163: .data -588
+add r0, L291
+; comment
+clr L210
+L164: .string "vuyzbvbbmlnsjqtpxnam"
+L165: .data -262, 739, -851, -80, -349, 633, 161
+add #221, *r4
+L166: .data 210, 139, -89, -36, -404, 51, -970
+L167: .data 762, 625, -525
+L168: .string "gijpokvrssagej"
+L169: .data 772, -803, -565, -675, -44, -201
+cmp L186, #-203
+L170: .data -78, -906
+L171: .string "cnaixzxsfqltpihfbpvvy"
+L172: .data -843
+L173: .string "nqhgcpp"
+clr *r7
+prn #206
+L174: .string "bjmfmogfnma"
+L175: .data 824
+cmp *r2, r1
+L176: .string "xxdbklqgsunqiwxokch"
+L177: .data 233, 81, 728, -403, 600
+; comment
+cmp r6, *r7
+L178: .string "ftjdysjlbtoqcczm"
+L179: .string "odtpdpdsy"
+L180: .string "vfgzpcjpqxkwqcnbocwslmhi"
+cmp *r4, *r0
+L181: .data 695, -504, -723, 172
+stop
+L182: .data -242, 419, 930, 192, 471
+L183: sub r0, L224
+L184: .data 497, -271
+; comment
+prn L269
+not L93
+L185: .string "i"
+stop
+L186: .data 333, -482, -220, -564, 540
+red *r6
+L187: .data 960
+L188: .string "hbfssjtrvmtgyrmnlnoqpf"
+inc *r1
+stop
+L189: .data 483, 356, -264, 891, 570, 514, -742, -682
+red L47
+L190: .string "dflfscncmtkpxabejrzjmdri"
+L191: .data -733, 373, 639, -301, 594, -314
+L192: .data -623, 833, -297, -588, 300
+L193: .data -340
+L194: .string "exl"
+L195: .string "zbejlobuzhn"
+L196: .data -40
+L197: .data 115
+L198: jmp L256
+; comment
+L199: .data -773
+red L273
+L200: .string "p"
+L201: .string "tslpckoyibnp"
+; comment
+L202: .data -973, 267
+L203: .data -376, 545, 978, -593, -407
+bne L238
+L204: .data -566, 606, 875, -737
+L205: .string "lrymkijgkre"
+L206: .string "corpwiplurwzthjwumpm"
+L207: .string "pipcuqfk"
+inc L320
+L208: .string "ba"
+L209: .string "d"
+L210: .data -424, -967, 193, -434, 16, -964, -755, 749
+clr *r7
+L211: .string "ummlga"
+L212: .string "plu"
+L213: mov r3, r7
+L214: .string "kgjwadcyowfnaiogwo"
+L215: .string "nkaxiimwdkpwyrnaxrunsr"
+
+not L71
+L216: .data 144, -650
+L217: .data -626, 773, -901, -221
+L218: .string "mogcwkcutoigsuyd"
+L219: .data 743, 578, -738, 323, -805, -480
+sub L162, *r0
+L220: .data -530, 930, 538
+L221: .data -485, 562, -745, -739, -91, -574
+L222: bne *r5
+L223: .string "iyoulzj"
+L224: dec *r5
+L225: .data 249, 298, 815, -374, -101
+not *r6
+L226: .data -283, 783, 201, -104
+inc r3
+L227: .string "sjplbqhnow"
+L228: .data 678, 563, 92, 171, 202, 773, 733
+L229: .data -678, 991, 922, 915, 952, 539
+L230: .string "srjxvekeebuosdpm"
+cmp r1, #-195
+jsr *r5
+L231: .data 10, -283, -207, -508, -835, -885
+L232: .string "ljaiy"
+L233: .data -809, 487, -536, -483, -383, -503, 117, -653
+L234: .data -406, 193, -205, -270, 415, -866, -354
+L235: .string "yoqzibzvwcq"
+L236: .data -574, -215
+L237: lea L201, L317
+lea L198, *r4
+L238: .data -614, -514, -623, -621, -696, 58, 746
+L239: clr *r1
+L240: .data -382, -444
+inc r0
+L241: .string "smvzwu"
+L242: .string "afhqvz"
+L243: .string "kgxdutfcqyteihvmsv"
+L244: not r0
+L245: .data 609, -379, 818, -274, -227, 369
+L246: .string "pobjuslzwdtksvlpv"
+L247: cmp *r7, *r2
+clr L286
+bne L15
+L248: .string "fqhvxm"
+L249: .string "ehtzwdairdibepteqgzn"
+L250: .string "ptykhvoqudq"
+bne L256
+L251: .string "mgfhpyluidzuavcb"
+L252: .string "wfcitkkeyf"
+L253: .data 592, 374, 423, 426
+L254: prn *r1
+lea L180, r4
+red L110
+add #-6, L198
+L255: .string "lhsicyzjz"
+L256: .string "fdnmpdmb"
+rts
+L257: .string "drnguxnxclhukeipfdkrlae"
+L258: .string "umrvc"
+L259: .string "dbphonmujcijkptpiw"
+L260: .string "dxtsxsnlj"
+L261: .string "bkaiittkhjwadzcngzwm"
+; comment
+L262: .data 300, 243, 813, 224, 313, 581, 885
+L263: .string "asphnyxlytggutz"
+
+sub L326, *r1
+L264: .data -280, 373, -285, 5, -581, 927
+red *r1
+L265: .string "elrqomo"
+L266: .data -906, 891, 298, -611, 385, -519, 341, -9
+L267: .string "eubfrfmmwn"
+L268: .data -949, 232, 906, 968, -800, -145, -386, -967
+cmp r0, #147
+L269: .data -484, 247, 777, -58
+clr L8
+clr *r1
+L270: mov L199, L326
+L271: jmp *r1
+L272: .string "huccup"
+L273: .data -772, 751, 659
+L274: .data -985, 214, -738, 446, 325, -671, -959, -53
+clr *r4
+; comment
+L275: .string "xbjn"
+L276: .string "fapfk"
+L277: bne *r6
+L278: .string "azbgbmjlgfrjjjgrllou"
+L279: .string "antcvsuwrxip"
+L280: clr L324
+L281: .data -159, -240, 765, 854, -526, 311, 270
+L282: .data 195, -282
+L283: .string "xssjbprbylexzlmze"
+L284: .data 400
+bne *r0
+L285: not r4
+prn *r7
+L286: red L314
+L287: inc *r7
+add L293, r6
+L288: .data 148, -543, -65, -256, 628, -390
+jmp *r7
+stop
+L289: .string "rifvrirstoxuqexvhr"
+L290: .data 280
+red r5
+L291: bne *r0
+L292: .data 340, 35, 694, -431
+L293: .data 743, -928, 159
+red r4
+L294: .data 459, 775
+dec r6
+; comment
+bne L235
+L295: .string "cryxeoqdmqafbcwqnw"
+L296: .string "tracculdngrlo"
+jmp L121
+red *r2
+L297: .data 957, -804, 911, 913, -24
+L298: .data 485, -203, 182, -863, -95
+L299: .string "ancqdqqdppvefcsybboaew"
+red L76
+dec *r2
+bne *r0
+L300: .data -453, -580
+red *r7
+L301: .string "qkudohtvgffxtpclzruzudk"
+L302: .data 348, 950, -343, -786, 28
+L303: .data -306, -590, 952, -38
+L304: .string "edpnawlzsywkx"
+L305: .string "rxwjtgfx"
+L306: .string "pgbmhfouurxjaaehjyharqj"
+L307: jmp *r0
+L308: .data -567, 299, 550, -786, 819, 560
+L309: .data 396, -423, -258, 946, -362, 603, -458
+L310: .string "krkdsdof"
+lea L274, r1
+L311: .string "tlphx"
+rts
+L312: red r3
+L313: .data 492, -967, -196, -316, -507
+L314: .data -446, 18, -910, -920
+L315: .string "nxqd"
+L316: .data 274, 835, -779, 608, 174, -149, 151, -170
+L317: .data 21, 134, -602, 283
+
+
+L318: .string "stndnoarlpecb"
+L319: .string "lveuvyj"
+L320: .data 172, 226, 579
+jmp L94
+L321: .string "mxslqzdjjlnaj"
+L322: .string "vfcskxjzbxgjpnnnlykmur"
+L323: .string "sgbsqfpkqscpkwmkio"
+
+L324: .string "bubmxzujocoyzxwaskkqeujc"
+L325: .string "ztbmqjtyuzrlzc"
+jsr L121
+L326: .string "qsonrefealfco"
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 119
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .data -457, -416, -555
+L1: .string "eugcyiuwmniibytw"
+L2: .data -79, -263, 873
+L3: .string "oyhzrwdku"
+
+L4: .data 565
+L5: .data 484, -593, -503, 223, -825, -474
+L6: red r3
+L7: .string "dc"
+
+L8: .string "fgwh"
+L9: .string "uafgmsxajpcrudagq"
+
+add #-199, r5
+L10: .data -177, -875
+L11: .string "zixknlqq"
+inc r5
+L12: .data -597, -833, -325
+L13: .string "fuohkejqgplkfvzu"
+inc r6
+L14: .string "vtheyqbszmhaorp"
+cmp r3, r4
+L15: .string "lxjkpzmijwnxncrfnppzrqvv"
+inc L170
+L16: .data -539, 981, 189, -226, 399, -813
+red *r2
+L17: .string "euztnns"
+L18: .string "pqxuxkgvzqpjrd"
+jsr L18
+L19: .string "uyvblqpjhphtqq"
+L20: .string "qptmaktofezzztez"
+L21: .data 163, -334, -525, 641
+jmp L50
+L22: .string "qgkgqnlsbvz"
+
+sub *r3, r2
+L23: .data -763, -719
+L24: clr *r5
+bne L148
+stop
+L25: .data 170, -400, 532, 208, -642
+L26: .data 108, 876, 944, 997, -418, -464, -995, -505
+rts
+L27: .string "auaqyksdctgua"
+L28: .data -988, -743, -752
+L29: .data -579, 562
+L30: .data 784, 881
+L31: cmp L34, r0
+rts
+L32: .string "lfwbotajscxyyzaxoepk"
+
+prn r6
+jmp L91
+prn L293
+clr L157
+inc *r7
+L33: .string "zmkmzfea"
+
+mov #73, *r0
+L34: .string "zzhjmmcismwquynndqni"
+stop
+L35: .string "bs"
+L36: .string "xqlrpcpcylnkvksyttxqs"
+
+add *r3, r7
+mov r0, *r3
+L37: .data -183, 828
+
+; comment
+L38: .string "f"
+L39: .string "lwnfigtwkijyncvfnh"
+L40: .string "vdb"
+L41: .string "tbpangeyxmbrficvnrx"
+sub r1, L261
+dec *r1
+
+; comment
+L42: .string "zejvlagmfzseq"
+not r3
+L43: clr *r0
+inc r1
+dec L69
+L44: .data -288, 178, -634
+L45: .data 257, -438, -773
+L46: .data 817, -15, -996, 217, -424, -52, -43, 946
+L47: cmp L322, #2
+L48: .string "tzoemgca"
+L49: .data 100
+red L293
+L50: .data 966, 149, 883
+L51: cmp r7, L12
+clr r0
+L52: .data 918, 445, 685
+L53: .data -618, -783, 93
+L54: .string "ehtyqajhzppcjhhdratkv"
+L55: .data -239, 627, -621, 872
+L56: .string "xdgaawhbgxzbwbvegw"
+L57: .string "kcuozrewvlgdmjxeumfve"
+L58: .string "hzpigeb"
+L59: dec r2
+L60: .data -774, -283, -549
+L61: .data -829, -625, 812, -305, -766, 702
+; comment
+L62: .string "yk"
+red *r3
+L63: mov L55, L13
+L64: bne *r5
+L65: .string "kaiu"
+L66: .data -781, 132, 940
+L67: .data 356, 77, -971
+L68: .data 571, -177
+L69: .data 737, 632, 465, -438, 548
+L70: .data -505, -836, -653, 111
+L71: .data -542, -370, -648, -583, -469, -165
+L72: .data 757, 555, -399, -424, -417, -884, -855, -874
+not *r5
+; comment
+red *r4
+L73: .data 967, -274, -103, 273, 984, 280
+rts
+L74: .string "jojccamtcdr"
+L75: stop
+red r3
+dec *r5
+L76: .data 822, -500, -693
+bne *r0
+L77: .string "pehjnphibxddfag"
+stop
+L78: .string "waoymiifkuzmrvihcpxpidh"
+L79: .data -355, -584, -854
+L80: .data -706, -534, -521, 741, 306, -3, 865, -927
+add r2, r2
+L81: .string "nqjsrrodt"
+L82: .data 422, 925, -11, 441, 268
+L83: .string "ptbsryvaxoygj"
+mov *r0, L42
+L84: .data 468
+not *r0
+L85: .data -564
+L86: .string "eahkuoefazddwacmmxsxd"
+L87: .string "h"
+mov r0, L6
+L88: .data -487, -119, 789, 775, 921, 155
+L89: .string "uwalitbhubphxyorfgqirjv"
+not *r5
+L90: .string "mzzhldhgoxgvh"
+not *r1
+L91: .data 260, 161, 884, 750, 236
+lea L242, r1
+L92: .data -159, -770
+L93: .data 87, -830, 731
+red r0
+L94: .string "niwmmfcnolizfwotqimthim"
+L95: stop
+L96: .data 290, -234, -165, 483
+clr r7
+L97: .string "sleprayec"
+L98: .string "itudagsckpbtyyifpriq"
+L99: .data 939, -587, 150, 328, 968, -587, -171
+L100: .string "fjfbzttzeouikttsryblgpk"
+L101: .data 44, -156, 199, -824, -632, 939, 434
+prn #-89
+add *r6, r3
+; comment
+L102: .data 985, -248, 843, 11, -57
+L103: .string "tyvxxrwsvxchuahty"
+red r2
+L104: .string "hsffphzx"
+L105: .string "dqmnyhuntrjzukobiejh"
+cmp #79, L16
+clr r7
+L106: .string "swragtlc"
+L107: .string "qxqljvnjcuv"
+L108: .string "htpghedrrnmjrzenkb"
+rts
+L109: .string "tlsayauhepzbixnhxez"
+L110: .string "ykdglxdvx"
+L111: .data 873, -192, -579
+L112: inc *r7
+L113: .data -381, -516
+L114: .string "rxviweieckxdspfjb"
+L115: .data 528, -917, -582, -796, 714
+L116: .data -836, -65, 93
+clr r1
+sub r1, L310
+L117: .string "xlrvntzmgqxevnsxezogcc"
+L118: .data 756
+L119: .string "vnpdkmutcss"
+; comment
+L120: .data 27, 871, -590, 54, -890, 243
+L121: .string "exhwvlqvunxv"
+L122: .data 523, -793, -210, 662, 975, -460, -615
+not *r2
+L123: .data -168, 96, 430, -625, 228, -537, -451, 473
+L124: .data 737, 558, -405
+L125: .data 400, 144, 536, -117, -910, 74, 457
+L126: .data -540, -653, 394
+red *r0
+; comment
+L127: .data -291, 606, 55, -512
+L128: .string "ojcdkqtfizmbtaomls"
+L129: .data 484, 835, -377, -118
+L130: .string "rkdekunn"
+L131: .data -406, -804, -830, 306, -484, -123, -803, 593
+L132: .data 607, 22, -72, 554, 187
+L133: .string "wxofruabmgjtzgv"
+prn #60
+L134: .string "akjkaaixvzcdngitvzoyn"
+L135: .string "dxbckp"
+L136: clr *r0
+sub *r5, L188
+sub L21, r6
+L137: .string "ioiyjzrhwxdebi"
+inc r5
+L138: .data 871, -666, 257, -29
+L139: .data -416, -48, 159, -529, 658, 164
+L140: jmp *r7
+L141: .data -972, -916, -924, 327, 886
+bne *r4
+
+L142: .data -30, 964, -158, -70, 134
+stop
+lea L72, *r3
+L143: .data 503, -259, -493, 878
+L144: .string "fmedvinxv"
+L145: .data 268, -484, 804, 928
+L146: .data 553, 215, 527, 118, 983, -799, 234, -312
+L147: .data 472
+L148: .data 702, -705, -360
+L149: .data -34, -962, -972
+L150: .data -466, 636, 463, 863
+L151: sub *r6, *r5
+L152: .string "qyeumffmhtqpgb"
+L153: add L206, r3
+prn *r1
+L154: .string "xbhefxy"
+inc L22
+L155: .string "svnezwwvodrbpwmd"
+L156: .string "kur"
+L157: .data -499, -779, 802, -687, -277, 596
+L158: .string "nygxzo"
+L159: .data -121, -726, 207
+dec *r6
+cmp r0, *r7
+L160: prn *r2
+L161: .data -229, 772, -842, 826, -332, 651
+L162: .string "cfkzjnapehdxuvzwm"
+L163: .string "wnrgczhjgz"
+jsr L59
+L164: .string "yndhlboyairnovvdiupghifd"
+L165: .data -74, -628, 962, 902, -466, -712, -748, -94
+sub L155, r7
+L166: .string "ujpdpworxrssul"
+jsr *r2
+L167: .string "oxmjt"
+cmp r1, r3
+L168: .data 842, -323, -271, -378, 835, 730
+L169: .data -370, 692
+; comment
+L170: .data 50, -995, 34
+L171: .data 333
+L172: .data 287, 87, 152, -316, -244, 714, 314, 195
+red r6
+dec L209
+L173: .string "ptqbrbasrhlvebldafs"
+dec r2
+red L233
+bne L33
+L174: .string "nexstr"
+L175: .string "mqwpzsbsqt"
+L176: jsr L258
+L177: .data -366
+stop
+mov r6, *r3
+L178: .string "vigqfxqbvktcdhcsovnwvsh"
+
+L179: .string "fieujicdmhmvkjrl"
+L180: .string "lsrfakpzbufybrwgjo"
+L181: .string "ketdykfplnbuyyviq"
+L182: .string "bjqqgdmoplhcml"
+L183: jmp *r6
+L184: .string "uceqkbpoz"
+jsr L91
+not L328
+L185: .string "mrpgnemtdrlasinnhaoyu"
+L186: .string "tlwocyzitsfwdekanhxh"
+L187: .string "zymrlif"
+L188: .string "wrevsxsqt"
+L189: .string "mctvsuvtihxfvmz"
+L190: .string "apifwpciwaljqnkvyp"
+L191: .data 866, 642, 843, -974, 771, 589
+L192: .data -932, -967, -34, 105, -665, 529
+L193: .data 144, -349, 57
+mov #-125, *r7
+L194: .string "ildakfvmajtrubsxyiwitqif"
+L195: .string "asxucwquqcjmegdzcy"
+L196: .data -357
+L197: .string "qcwrhmropewrwerxpyg"
+L198: .string "bjfczjmupobeuay"
+L199: .string "uvpogjumkapawyy"
+not *r2
+L200: .data -843, -54, -406, -689, -411, 433, 230, -108
+inc r2
+L201: .string "guxbeuxhpgkbprjgyymjl"
+rts
+L202: .string "jvkgopfpwnardx"
+L203: .data -937, -604, 594, 330, 931
+L204: .string "sdvhmziohfsfuv"
+L205: .data -165, -954, -816, -69, 255, 869
+lea L157, r4
+clr r1
+mov #168, L306
+L206: .string "xarsermiwyiwsoxgjerviwkn"
+sub r2, r0
+L207: inc r6
+add L155, *r0
+clr *r2
+L208: mov L209, L260
+sub *r7, *r2
+L209: .data 757, 702, -769, -52
+L210: .string "emjpmayba"
+L211: .string "jorraas"
+bne *r3
+inc r0
+L212: .string "mphnsahehynkzrkim"
+L213: .string "ombuuhkjtkcbdpf"
+L214: .string "iaodyepdkacikviufyer"
+L215: .data 736, -787, -443, 637, -981, 169, 981
+rts
+add *r2, L269
+L216: red *r4
+L217: .data 937, -916
+L218: .string "kpvxiigcvkkrcaon"
+prn *r0
+L219: .data -817
+L220: .data -690, -90, -626, 63, -940, 87, 142, 752
+L221: .string "eyptopzekoregmtvi"
+L222: .data -935, 29, 73, 148, -889
+bne L242
+L223: sub #58, *r4
+L224: .string "icsevcwfznoiimhapsbq"
+L225: .string "rtnddqublvopdw"
+sub #-255, r3
+L226: .data 759, -337, 653
+
+inc *r2
+L227: rts
+L228: .data 253, 507
+stop
+; comment
+L229: .string "gorjrefuplbwintlwzoy"
+L230: .data 374, -725, 869, 271, 353, 85
+L231: .string "ctclpwxlqjansnvkwuurg"
+inc L259
+L232: .data 936, -136, 425, -735, 951, -707, 649
+L233: .data -110, 513, 143
+L234: .data -905, -2, -782, 396
+L235: .string "flcbxkzr"
+inc *r5
+; comment
+L236: .data -872, 579
+clr L287
+dec r6
+L237: .string "y"
+L238: .data 635, -893, 64
+L239: .string "kbdufzywgtxedj"
+L240: .string "ahhuyocunqnbgxrtlbw"
+L241: .data 623, -166
+L242: .data -707
+L243: .data -339
+L244: .data 879, 578, -875, 388, 319, -565, 397, 154
+L245: .string "lhnkkoqsbzeocxraekefmf"
+L246: .string "rl"
+L247: .string "ihhn"
+L248: .string "a"
+L249: .data 478, -213
+mov L269, L267
+L250: .string "aiuzogynumypuxni"
+L251: .string "cyvz"
+L252: .data -432, 45, -433, 999, -530, 499, -513
+L253: .data -47, 724, -768, -803, -551, 673, -154
+lea L226, *r1
+L254: .data -900, 596
+L255: .string "fqyzakjudkrdiwvk"
+dec r2
+L256: stop
+L257: .string "frtmoplskmajbidwgcmmj"
+L258: .data 706, -763, -666, -738, -671, 64, -465
+L259: .data 368, -234
+L260: .data -195, -545, 377, 642, 279, 132
+clr L204
+L261: .data -788
+L262: .data 829, 907, -679, -428, 723
+mov *r6, *r4
+L263: .data -109, -706, 170
+cmp r1, r3
+L264: .data -822, 690
+L265: dec *r1
+L266: .data 941, 963, -391, 115, 782, 576
+sub L290, L83
+L267: red *r6
+cmp #-147, *r2
+L268: .data 292, -402, -947, -163
+rts
+inc r6
+sub #-37, *r2
+L269: .data -135, -373, -612, 309, -713, -955, -467, -203
+prn *r2
+prn r0
+L270: .data 770, -501, -274, -693, 793
+L271: .string "vqadkmurjysovbyaukhvxjeu"
+prn L66
+L272: .data 820, 874, 817, -915, -664, 385, 563
+L273: .string "akjczzicfzqqzeeyvqbuguz"
+L274: .data -694, -670, -772, -518
+
+L275: .data -370
+L276: sub L268, L301
+L277: .string "tvechtmcomhprc"
+L278: .data -757
+L279: .data 648, 208, -1, 98
+L280: .data -436, -268, -859, -161, 333, -765, -470
+L281: .data -750, 308, -811, -703, 266, -284
+lea L319, *r1
+L282: .data -285, 290, -1000
+L283: bne L290
+L284: .string "zccoioqqulvgjklldymui"
+L285: .data -751, -42, 789, -981, -464
+L286: .string "giibubnajvsizijlk"
+L287: .data -593, -903, -913, -568, 707, 153, 794, 564
+L288: .string "cwykhjgxgirqeppheti"
+L289: .string "cphliuuc"
+L290: .string "mvaphddayjth"
+sub L314, *r0
+L291: cmp L213, #-239
+L292: .string "srdsfqxzvoeaozjkyxrku"
+L293: .string "lcmodmnufxzqtg"
+L294: .data -669, -851, -944
+clr L320
+L295: .data 473, -428, 107, 728, 711, 984, 542, 607
+L296: .data -642, 511, 821, 821, 351
+
+L297: .string "snhmlcavvmkyxzkqhk"
+L298: .data -693, 512
+; comment
+L299: .data -657, -518
+L300: add #-200, r3
+L301: .string "puowja"
+lea L320, r7
+L302: not r2
+; comment
+
+jmp L307
+L303: .data 658, -106, -11, -410, -210, 127
+L304: .data 601, 234, 954, -412, 152, 143
+L305: .string "dawmzbjnmoxkxip"
+L306: .data 647, 373
+L307: bne L89
+jmp *r6
+L308: .data 43, -897, -214, -203, 646, 344, 181, -27
+L309: .string "nucxptrjzywui"
+L310: .string "hlttjbvwyjhclfn"
+L311: not L213
+dec L315
+L312: .data -150, -898, -310, -18
+L313: .data 401, 243, -203, 908, -109, -445
+L314: .string "qdrpnwyco"
+L315: .data 425
+add *r2, r5
+bne L328
+L316: .string "pkbvjkagcmftmg"
+mov r4, r5
+prn L317
+jsr *r5
+lea L324, r4
+jsr *r4
+L317: .string "mcqgfgtgzusudjdg"
+L318: jsr L323
+L319: .string "th"
+L320: jsr L324
+rts
+L321: .data -921, 883, 659, -40, -31
+L322: .data -926, -263, -95, -426
+L323: .string "jvgdxwebofo"
+dec r5
+L324: .string "qdpmsmcywklkt"
+; comment
+L325: .data 396, -153, 289, -581, 269, 509
+L326: .string "diy"
+L327: .data 603, 109, 304, 230
+jmp *r6
+L328: .data 939, 707
+L329: .data 676, 431, 848, -27, -783, 962, -147
+L330: clr r5
+red *r2
+inc r0
+L331: .data -182, 297, -82, 103
+dec L225
+L332: .string "jjcrkdwwyfiknkxjlknrwzvm"
+L333: .data 428, -234, 538
+stop
@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 120
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+add *r6, L291
+L0: .data 903, 173, 325, -273
+L1: cmp *r1, L171
+L2: .data -164
+L3: .data 102, 159, -660
+L4: .data 841, 622, 86
+L5: .string "essuxeh"
+L6: .data -275, 561, -633, 204, 733, -394
+L7: .data 937, 250, -835
+
+L8: .string "opyhqbevkxymvziqlwujcpx"
+L9: .data -363
+L10: .string "idvmpoxmamek"
+L11: .string "cndzunbcitldsvqruxfhe"
+L12: .string "drcr"
+clr r0
+L13: .data 86, 858
+prn L3
+L14: bne L5
+inc r3
+L15: inc r5
+L16: .string "yoewvreqwhauqi"
+inc *r3
+L17: .data 673, 460, -127, -884, -588, -418, -678, 918
+L18: .data 443
+L19: cmp *r6, L235
+L20: .string "sqqjgqxcdxibecroumwhxr"
+L21: .data -856, 948, -743, -837, 395
+stop
+clr r2
+L22: .string "hjoxlbk"
+L23: .string "wqovvzvgvahiwm"
+L24: .data 59, -62, -609, -636, 483, -634, 490
+L25: .data -68, 64
+L26: .string "rbjskmnhnpyqhm"
+red r6
+L27: .data 346, 344
+L28: inc L36
+L29: not *r6
+bne L277
+L30: .string "ghyuzfqknboeeyrbtdghkjdu"
+L31: .data 956, -216, 607, 569, 441, 167, -890, 996
+bne *r6
+
+L32: .string "zsowwhjiafocb"
+L33: .string "ghfiyuslkrtlmxwbjcgpzjl"
+jsr L257
+rts
+L34: .data -811, -408, -637, -715, -322, -17, -907
+jmp L305
+L35: .string "kroxrmqqkghi"
+L36: .string "dxjmefqprxgce"
+L37: .string "sfakbbkouzmcetelanjd"
+L38: .data -811, -434, -412, 653, 38
+L39: .string "bclmawxwvmq"
+stop
+sub L114, *r4
+
+red *r2
+L40: .data 409
+inc *r6
+L41: .string "y"
+mov L245, L1
+
+L42: .data 34, 120, -585, 832
+inc r2
+clr L85
+bne *r0
+bne L20
+L43: jmp *r0
+L44: .data -950, 343, 855
+L45: .data -592, 772, -335, 673, -605, -734, 993, -252
+
+lea L3, L118
+L46: .data 585
+L47: .string "zgifbikgiqsiccfelrkogqx"
+L48: .string "gfbftfbriotwvyca"
+sub L36, L12
+lea L170, *r1
+red L236
+clr L22
+L49: .string "ueahwcvok"
+L50: .data -566, 299, 177, 28, 151, 978
+L51: stop
+; comment
+rts
+
+L52: .data 58
+; comment
+clr r6
+red *r1
+L53: .data 827, 507, -781, -366, 555, 82
+jmp L32
+L54: .string "zbnhkcgp"
+sub L16, *r7
+prn *r3
+prn *r3
+
+red L37
+L55: .string "xaedcjxclxlmu"
+L56: .data -162, -73, 655, 634, -894
+jsr L29
+not *r1
+cmp *r7, *r3
+L57: .data -349, 1, -403, 593, -982, 30, -837, -717
+L58: .string "ixauolckofkveozxdwxr"
+prn #128
+L59: .string "owdkwwinfkv"
+sub r3, *r1
+L60: .data -802, -802, 10, 701
+
+L61: .string "gcvdlhozaqhhbtnzcaa"
+L62: .data 507, 587, 122
+L63: .string "ygoysdlxgd"
+L64: .string "retcwuhlpbo"
+L65: .data 957, 465, -975
+L66: not *r3
+dec r4
+L67: .data 266, 901, -200, -893, 811
+L68: .string "xryuhbeltfgtptgijbpn"
+not L41
+L69: .data 873, 148, 854, 410, 818
+prn #76
+sub #-38, L107
+lea L81, r1
+not *r5
+L70: .string "usizxbaxcwijtwumhxczkc"
+L71: .string "z"
+L72: .string "nocxh"
+L73: .data -843, -923, -284, -801, 321, 375, 431
+stop
+L74: .string "ogjmxke"
+L75: prn r5
+L76: .string "rruksubkzkhjfflttlc"
+L77: mov r5, r1
+sub *r5, *r2
+not r4
+L78: .data 808, 433, 642, 697
+L79: .string "bypudkwxqfuxfgnrvqujabsd"
+L80: .data -56, 951, 215, -456, -513, 58, -32, 703
+L81: .data 683, -115, -226, -548, -869, 530, 350
+prn L42
+L82: sub #-125, r3
+L83: .data -690, -570
+L84: .data -356, 996, -653
+L85: .string "byscfocjvkkbxfbmrxoroi"
+rts
+stop
+L86: .string "itviinsryecodjhehbasji"
+rts
+dec L304
+L87: .string "rqt"
+clr *r6
+L88: .data -418, 338, 303, -816, 720, 702, 427, 732
+bne *r4
+L89: .data 645, 549
+L90: .string "mpjbcbbvllqmxffija"
+L91: .data -164, -511, 888, 642, -61, 483, 30, -987
+L92: lea L171, *r0
+L93: stop
+lea L130, L43
+L94: .data 265, 994, 567
+L95: .string "arkkfyfwmcetmzgshqhhv"
+cmp r6, L168
+L96: .string "lzrdlwdfjztcaovgxboc"
+dec L32
+red *r3
+sub r1, r1
+L97: .string "lnpprmnvhmpg"
+L98: .string "sxsgqkuoxau"
+L99: .data -195, -984, 232, 138, 332, -889
+clr r2
+cmp #-164, #114
+L100: .data 718
+add r5, *r0
+L101: .data -565, -855, -315, 205, 202
+jmp *r4
+L102: .string "ouqxu"
+L103: stop
+L104: cmp r6, *r6
+mov #-162, r3
+L105: .string "llwryngzxrnqirhjenxs"
+
+L106: .string "oxyredmpkl"
+L107: .data -235
+L108: .data 226
+L109: .data 469, 404, 660, 911, 344
+L110: .string "tdyhsuurhnuiizzbzkaaxkhx"
+lea L234, *r6
+L111: dec r5
+bne *r5
+L112: .data -410, 184
+L113: .string "skmvlnyj"
+rts
+L114: .string "xjmwbjf"
+L115: .data 44, -952, -540, 143, 568
+; comment
+L116: .string "rz"
+cmp r7, *r6
+sub *r5, *r4
+L117: .string "d"
+L118: .string "zcjkhvidbyjcyfixgptqn"
+L119: .data 587, 39, -865, -886, -363
+L120: .string "vgvhxfpnu"
+L121: jsr *r2
+L122: .data -431, -864, -434, -652, -41, 907, -325, -373
+L123: lea L7, *r1
+L124: .data 660, -484, -616
+L125: .string "rsrermad"
+L126: not L102
+; comment
+lea L62, r1
+L127: .string "ayxrlroemtbxuyxsp"
+bne L33
+L128: .data -62, 425
+inc L21
+L129: .string "awnkkgomzcjwvpd"
+L130: .data -150, 643, 806, -625, 285
+L131: .data 556, -821, 781, -505, 917
+L132: jmp L3
+L133: .data -186, -445, -774, 20, -832
+cmp L266, r6
+jmp *r7
+inc L99
+L134: .data -376, 112, 957, -948, -571, -581, 717, -54
+L135: .data -68, -982, 571, 471, -558, -572, -242, 722
+L136: .string "p"
+L137: .string "pgitdntchqzecvvfozaq"
+red *r0
+L138: prn #167
+L139: .data 794, -460
+L140: .string "dosynqeu"
+L141: cmp L130, L38
+L142: .data 638, 203, -617, -125, 685
+L143: .data -463, -756
+L144: .data -285, 53, 597, 698
+L145: .string "ogxhtuwlthssqglzmyflfk"
+cmp #-239, #-198
+cmp *r2, #160
+L146: .data 631, -678, 437, 999, 602, -348, 912
+inc L296
+L147: .data -184, 934, -485, 909, -238, -446, -32, 596
+; comment
+L148: .string "fha"
+not L224
+L149: .string "vpaamufnaurpws"
+L150: .string "ciufams"
+L151: .data 235, -987, 854, 81, 565, -682, 685
+L152: .string "dfkkimggmqjellk"
+L153: .data -324, -750, -609, 700
+red L139
+L154: .string "pcsnbilzxqiaotoqklazdeno"
+L155: .data -113, 759, 679, -622, -694
+L156: .data 344, -959, -785, -413, -409, 811, -415, 356
+add #-205, *r5
+L157: .data -299, 316
+mov L41, *r5
+not r2
+L158: .data -47, 303, -448, 507, 14
+jmp *r5
+mov r7, L205
+L159: .data -52, -95, -288, 405, -504, 278, -287
+L160: .data -609, -761, -424, 593, -15, 284, -261, 542
+clr L161
+
+L161: .string "uk"
+L162: .data 815, 488, 313, -931, -202
+L163: .string "awgsslazowendxtkietgnuni"
+L164: .string "uslgooveriwmnf"
+L165: .data 58, 55, -173, 3, 915
+prn L36
+L166: stop
+prn #198
+L167: .string "zdsxce"
+L168: .data 625, -417, -329, 554
+L169: .string "fhdmxh"
+L170: .string "rkvesddygcnawpttwwlc"
+L171: .string "qujmpyfhidukmpla"
+L172: jsr *r2
+L173: .data -378, -841, 239, -151
+L174: .string "tuypyxuwgbcorm"
+not *r1
+L175: bne *r4
+L176: mov #-217, L167
+not *r3
+jsr *r0
+L177: .string "vaaslsrwnhugunugmgos"
+red r5
+L178: .data -887
+L179: .data -12, -949, 157
+L180: .string "jx"
+L181: jmp L298
+L182: .data 745, 299, -668
+not *r3
+L183: .string "qxfmadirngas"
+L184: .data -247, -824, -16, -262, -873, -34, 128
+jmp *r1
+bne L66
+sub r5, r5
+cmp L49, *r6
+dec *r5
+add r7, *r6
+lea L78, *r7
+jsr *r6
+L185: .data 959, 663, 529, 945, -434, 802
+L186: .data 329, 310, -972, 948, -222, 338
+prn #-36
+L187: .data -235, 831
+L188: .data -628, 297, 259, -270, -526, 68, -704, -651
+L189: sub #132, *r3
+L190: .string "nafnbanzezwiitdzbwvt"
+bne L29
+L191: .data 374
+lea L118, *r3
+L192: .data 146
+L193: .string "qqlitexyfkwvwwfrxu"
+L194: .string "ykmmnrrwn"
+L195: .string "arospzztlkdxulkdqpmhmlo"
+L196: .data 736, 107, 144, 708, 929, -997, 371, 711
+L197: .data 827, -64, -145, -109
+sub #81, *r3
+dec L216
+cmp *r6, r4
+; comment
+L198: .data 750, -263, -68, -271, 15
+L199: .data 353, 417, 530, -245, -949
+L200: stop
+L201: .data -608, -499
+L202: .string "dnvuonsnrnmfurl"
+jmp L297
+L203: add L93, r1
+L204: .data 550, -903, 43, 555
+L205: .data -325, 935, -338, 777, -511, 642, -409
+L206: .string "nwgaznpcbqxvxtb"
+rts
+L207: .string "hto"
+L208: .data 573, 149
+L209: .string "irkwctuzvcupvsvumukwcz"
+mov #-193, r0
+L210: .string "mumqxbvqifnsdrdnsavnf"
+L211: .data 645, -146, 0, -773, 862
+L212: .string "emkmuafozqjhww"
+L213: .data -685, 914
+L214: .string "dnevaeswwsacaoaua"
+L215: rts
+L216: .data -391
+jmp L130
+L217: .string "wjuaqqysywgpngxv"
+jmp *r1
+L218: bne *r2
+L219: .data -497, -459, -727, 545, 173, -561
+L220: .data 279, 9, 873
+mov *r1, r2
+L221: .string "xf"
+prn #-26
+stop
+
+L222: .data -755, 330, -756
+L223: .string "myjpgfveuzrx"
+L224: .data 784
+L225: .data 567, -797
+L226: .string "apqrqqpjdnko"
+bne L184
+L227: .data 673, 173, -154, -635, 486, -28
+lea L237, *r7
+L228: .string "tyrbpnwliq"
+; comment
+L229: .string "acnpkbxkwsjod"
+L230: .string "yhhdmlwrpgthnxguzet"
+L231: .data -51, 798
+L232: .string "b"
+L233: .data 172, 750, -721, 872, 259
+L234: .string "akceuswi"
+L235: .data 167, -221, 119, -411, -304, -139, -275, -517
+; comment
+add L243, r0
+; comment
+L236: .string "aa"
+L237: .string "mnjjmbcetgzc"
+L238: .data 167
+lea L237, L289
+L239: .data 929
+L240: .data 711, 932
+red L25
+L241: .data -494, -141, 361, -3, 767
+L242: .string "vkjczjvbmlqctwnrpjk"
+stop
+L243: .string "loxaexrruqrlfxbw"
+cmp r6, *r4
+L244: inc r7
+L245: .data -640, -784, -460, -829, 422, -256, 699, 56
+L246: .string "xzvfn"
+L247: .string "nwu"
+mov *r4, L262
+clr *r5
+sub r2, r3
+L248: not *r3
+lea L234, *r4
+L249: .string "ajuntzlmfa"
+red *r0
+cmp *r3, #252
+L250: .data -328, 998, 644, 602, 156, -790, -690, 393
+clr r2
+L251: .string "hhgdn"
+red r0
+L252: .string "fqmudyijskmd"
+L253: .data 178, 833, 710, -768, -867, -924, -636
+L254: rts
+add L194, *r1
+stop
+
+L255: .string "pvi"
+L256: .string "tgkimjrinmbwmhb"
+red L274
+bne *r3
+L257: .data -173
+L258: clr r5
+not r5
+L259: .data -379
+L260: .string "yxkbbefmfkfiypdjqwg"
+L261: inc *r7
+L262: .string "shux"
+L263: bne *r2
+L264: add r7, L296
+add *r2, r0
+L265: .string "dnqjwwhuwvfctluhcutage"
+L266: .string "omcif"
+L267: .data 217, 111
+jmp *r1
+lea L287, L187
+L268: .data 408, -427
+L269: .string "crjvigcbcrsy"
+stop
+L270: .data 699, 166, 772, 655, -752
+sub #-94, *r2
+rts
+L271: .string "txk"
+L272: .data 275
+L273: .data -760, -827
+L274: .data -468, -751, 842, 201, 952, -989
+L275: .data -535, 685, -820, -723, 951, 546, 67
+L276: .string "ifphrtrmqvq"
+L277: .data -901, 747, 784
+L278: .data 308, -911
+L279: .data 985, 895, -626, -1
+red r0
+L280: .string "csvtaxvojvuexswqsxk"
+cmp *r5, r0
+mov r1, *r2
+L281: .string "qdnoumvmxcuwxjus"
+bne *r2
+clr r5
+mov *r4, L278
+prn L242
+stop
+L282: .string "uyfvlahhhmlndss"
+L283: not *r0
+clr *r3
+lea L295, *r1
+L284: .string "jqnqcmb"
+L285: .string "xenkwljqeetegpfgfeeavpne"
+L286: .string "jwwsx"
+dec L298
+clr r3
+not r3
+L287: .data -586, 11
+L288: .data 72, -561, 877
+L289: .string "buthdrlsrlvbtkeexo"
+L290: .string "etdlpeix"
+rts
+L291: .string "ndlepv"
+dec *r5
+; comment
+L292: inc r2
+jmp *r1
+L293: .data -265, -311, 108, -957
+dec r5
+add #7, r2
+L294: inc r7
+L295: .data 766, -553, 943, -836
+red *r7
+L296: stop
+inc *r4
+red r5
+
+L297: .data -538, 455, -533, -916, -772
+L298: .string "wwwhsecfinssaixsum"
+L299: .data 730, 324, 717
+L300: jsr *r7
+bne *r7
+
+sub L145, *r4
+sub L262, *r0
+L301: .data -513
+L302: .string "wtftid"
+L303: .data -137, 306, -967, -397
+
+sub *r7, *r6
+L304: .data -61, -312, 881, -920, 625, 580, 329, -410
+L305: cmp L56, L123
+stop
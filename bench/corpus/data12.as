@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 13
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .string "xpuvwimxsgzxcwyuy"
+L1: .string "x"
+L2: inc *r6
+L3: .string "zkafmxfnew"
+L4: .string "uvxsctkcjduztcrphye"
+L5: .string "vwauedvwt"
+L6: .data -908
+L7: .string "tpehsveakyzybbnygyne"
+L8: .data -837, -933, 105, 683, -962, -760
+L9: .string "ryhso"
+L10: .string "xilqomqtcaqejtd"
+stop
+L11: .data -634, -206, 87, -140, -947, 34
+L12: .data -23
+L13: .string "jiptdttzj"
+L14: .string "facqgyssefzusalnfvgel"
+sub L4, r7
+L15: .string "juajywkrgundj"
+L16: .data 218, -824, 507, -43, 860, 755, 763
+rts
+L17: not r7
+stop
+L18: .string "q"
+L19: .string "ffadjnennxetrhbcaxwkvy"
+inc L10
+L20: .string "jdjrvivtgdq"
+L21: .string "whrmpycwvqop"
+L22: .data 290, 1
+prn #-236
+cmp *r7, #-45
+stop
+L23: .string "evqewnyupwlflghfgz"
+L24: .data -641
+bne L146
+bne L59
+L25: bne *r0
+not r0
+L26: .string "rjp"
+L27: .string "hzrhvpmjfbcpvvffxn"
+mov L1, r3
+clr L59
+L28: .string "dgbey"
+L29: .data 837, 283, 56, 899, 248, 66, -714
+lea L4, r3
+L30: .string "pmxllqnacubgin"
+add #226, *r3
+L31: .string "argzoeljecayabgdr"
+red r5
+add r5, *r4
+L32: .string "gytmva"
+lea L157, L30
+L33: .data 890, 850, -845
+L34: .string "shfygdbyneuielf"
+L35: .data -365, -985, -242, 642, 34
+jsr L2
+L36: .string "mytqjggnldcywlf"
+inc r4
+L37: .string "bxholxemfmhztm"
+L38: .string "yixobyt"
+L39: .data 840, -828
+; comment
+L40: .string "sqohrlnkzujywatzlfzqgvz"
+
+stop
+L41: .string "rufr"
+L42: .data -620, -545, -550, 571, -958
+L43: .data -784, 495, 567, 995, 106, 128, 623, 407
+L44: .string "wbomcx"
+L45: .string "dmwqwbiklsr"
+add r7, L64
+rts
+dec L254
+L46: .string "kthsevfq"
+L47: .string "ovi"
+bne *r6
+L48: .data -605, 417, 937, -175, -626, -455, 212, 609
+L49: .string "fvsirbyjfolhnutq"
+
+L50: .data 308, -818, -669
+dec L312
+L51: .data 770, -388, -916, -826, 432, -505, -931, 846
+L52: .data 719, 946
+L53: .data 34, -505, 565, -903, -723, -136, 396, -347
+L54: .string "kjuermbs"
+rts
+not r3
+L55: .data -498, -638, 603, 224, 521
+L56: .string "jqstvnhbwjz"
+clr *r1
+L57: mov #-158, r3
+L58: .data 594, -63, -599, 299, -925, -140, -152
+L59: .data 262, -42, -19, -778, -164, -220
+add #189, r4
+L60: .string "qucabecczgebhb"
+L61: .data 166, 813, 87, 134, -61, -326, -656
+L62: .data -773, -52, 624, 953, -996, 703, 88, -645
+lea L275, *r3
+
+L63: .string "uhoxtuiytemi"
+L64: .string "umejuajnbanyqprhlvfcrd"
+L65: .string "pomlyvlofipo"
+L66: .string "phvbmziwuamjkmmmxuyw"
+prn r6
+L67: dec *r5
+L68: .string "jdopgvwqkzimhuj"
+L69: cmp #-67, #185
+L70: .data -306, 991, 275, 351, -88
+L71: .string "cynrmsziflpjbtdaegaqrha"
+L72: .string "do"
+; comment
+not r5
+L73: bne *r5
+; comment
+cmp *r4, L73
+L74: .data 490, -360
+L75: add L138, r7
+L76: .string "b"
+L77: inc r6
+
+rts
+sub r6, L21
+L78: .string "whp"
+L79: .data -966, 761, 677
+add #22, L139
+L80: .data 296
+jmp *r5
+L81: not L306
+L82: .data -592, -38, 701
+clr r2
+L83: .data -283, -598, 311, 870, -929, -35, -326, -104
+bne L304
+L84: .string "aacfupowikbztvun"
+dec L35
+cmp *r5, L57
+L85: stop
+bne L172
+L86: .string "wmptccef"
+lea L289, L253
+L87: .string "goepfvvfipxs"
+L88: .data -978
+stop
+cmp r7, #-74
+L89: .string "duprd"
+L90: dec r2
+L91: .string "znmlmbjg"
+L92: .string "ywb"
+L93: .data -742, 38, 395
+L94: .data -367, -810, 301
+inc *r6
+inc r1
+L95: .data -287, 848
+L96: clr L122
+L97: .data 188
+prn L2
+L98: .data -597, 440, -157
+jmp L234
+prn L237
+L99: .data 326, -499, 589, -299, 97, 24, 58, 908
+dec L169
+jmp *r7
+L100: .data 261, -280, -60, -933
+L101: .string "pgdnrxrxyrmbutrw"
+L102: .string "sodenpvtrflvpzoa"
+clr r4
+
+L103: .data 851, -28, -930, -15, 957, 689
+bne *r0
+L104: .data -861
+sub #-23, r7
+dec L257
+L105: .data -342, 80, -133
+L106: .data -851
+L107: rts
+L108: .string "qcybbzkdqtfevv"
+L109: .string "nzhhzkl"
+L110: .data 274, 989, -892
+L111: .data 79, 250, 563, 389, 567, -237, 282, 575
+L112: .data 700, 393, -703, 124, 453, 77
+L113: .string "jztijajlsjy"
+prn #-85
+L114: .string "kpaggzzrtfvbdagpwijwbez"
+L115: red r2
+L116: .string "sghsbzti"
+L117: .data 809
+L118: .data -535, -315, -587, 847, 706, 337
+stop
+rts
+L119: jmp *r4
+L120: add #-193, r1
+bne L290
+jmp *r4
+L121: .data 799, 282
+
+add L112, r3
+L122: .string "udzw"
+not *r0
+L123: .data -321, 889, 409
+add *r3, L81
+L124: .string "jjfvuhhqttxuqmxtlxix"
+L125: .data -931, 932, -519, -103, 31
+L126: cmp *r5, L125
+prn #97
+clr r0
+L127: .data 771, -945, 955, -196, -250, 765, -435
+L128: .string "iaxqhafxlwuwyhywacnc"
+red r7
+lea L70, *r7
+L129: .data 771, 103, 422
+L130: add L205, L184
+L131: .data -723, 90, -715, -20, 535, 651
+L132: .data -651, -680, -471, -304
+L133: .data 120, 226, 285, -465, -779, -938, 336
+L134: .string "qoijshh"
+L135: .string "bvzmssshhljqo"
+L136: .data 706, 750, -416, -532, -267, 302, 406, 103
+L137: .string "godfw"
+L138: .data 910, 613, -77, 163, 425, -426, 216
+L139: .string "ugdmvqqvcbqdsbewsjh"
+sub #45, L208
+L140: .string "oylpadelm"
+L141: add r0, *r5
+L142: .data 734, -787, -763, 627, -43, -244, 294
+L143: .string "gxanba"
+dec L53
+L144: .string "guf"
+; comment
+L145: .data -549, -608
+L146: .data 804
+L147: .string "ikurttycoln"
+L148: .data -958, -219, 497, 280, 871, -399, -39
+L149: .data 73, 563, 627, 799, 666
+L150: .data 851, 921
+L151: .string "gtwwyvwvsfziqt"
+L152: bne L66
+L153: bne *r0
+L154: .string "vgeoyteohltvmc"
+L155: .data -476
+L156: .string "rjeggkjccbpwvymraodo"
+; comment
+clr L247
+L157: cmp #233, *r2
+L158: .data 260, -321, 295, -249, 767, -884, -879
+L159: .string "topxxphpohtwo"
+L160: .data -765, -834, 189, -337, -808
+rts
+L161: .string "suxwqawyilweolts"
+L162: .data -113, -182
+sub L215, r0
+L163: .string "jchpirtdhkgwishbgicswa"
+jsr L82
+lea L72, L136
+; comment
+L164: .string "icweibgecwwhci"
+L165: .string "lde"
+L166: .string "zrcokzrcyqcyzdalgy"
+L167: .string "kvwaflyvcihcl"
+L168: rts
+L169: .string "vfthghqferwjbzw"
+L170: .data -19, -909, -223, 805, 327, 263, -702, -433
+L171: clr L109
+add *r1, L226
+L172: .data 472, -317
+L173: .string "wdabz"
+L174: .data 368, 269
+stop
+L175: .data -548, -599, 182, 897, -86
+jmp *r0
+L176: .string "cbpjalbapuhi"
+L177: .string "ydygqkcanuzuuhhgzriafkb"
+L178: cmp L38, r0
+cmp *r6, r5
+L179: .string "bnqvpqfkwxdy"
+; comment
+L180: .string "fgqouvbno"
+dec L66
+L181: .string "osksvpnheracybigqpg"
+L182: .string "wrba"
+lea L201, L12
+L183: .data -242, -367
+L184: .string "pytjjvjfw"
+rts
+L185: add #63, r4
+L186: .string "iwf"
+L187: .string "uwkbtb"
+prn #-150
+L188: .data 603, 309, 519
+L189: .data -920, -849, -621, -962, -915
+L190: .data 378, -35, 778, -886, -949, -110
+L191: .string "ilhwtrnumvultiyw"
+L192: .data -433, 548, 150
+L193: .data -440
+L194: .string "jwgoxbfisqgrzb"
+L195: .data 194, -914, 696, 187, -742, -889, -308, 175
+L196: .data 645, -262, -76
+mov *r2, *r3
+rts
+sub L317, *r4
+cmp L162, #-224
+L197: .string "metrsefmaiz"
+L198: .string "ojajkbuv"
+add L247, r1
+stop
+L199: .string "fgkvpumwqionvo"
+sub *r6, *r5
+L200: .string "hdskoqtgpfqptweanblda"
+L201: .string "gxuvuodf"
+L202: .data -892, 657
+L203: .data -833, -981, 509, -861
+L204: .string "tcuriexapshzuvmeihy"
+red r0
+L205: .string "hzghjbxgmsnusd"
+clr r3
+L206: .string "mnqwegltqepomfzoc"
+L207: .data -207, 862, 92, 783
+L208: .data -222, -655, -641, -396
+L209: .string "mekwhqnqm"
+lea L85, L212
+L210: .data -771, -215
+L211: .string "ydtteoryyotlko"
+dec L175
+L212: prn *r2
+L213: .data -65, -22, 178, -446, 955, -703, 705, 981
+dec L221
+L214: .data -663, 3
+L215: .data 303, -749, -605, -194, 286
+; comment
+L216: .data 646, -558, -851, -742, -97
+L217: .string "zraxnvbxumlchplsampk"
+red *r0
+L218: .data 552, 995, -469, 82, 944
+L219: .data -145
+L220: .string "lhp"
+L221: add *r2, r1
+prn r7
+L222: .data -389, 890, -747, 635
+L223: .string "koirtrdlyqupbtcdqsbvp"
+L224: .string "wuzoyfzaz"
+L225: .string "kjqlkbvotehshccds"
+L226: .data 981, -54, -633, 33, 417
+L227: .string "hxhttrcqptyu"
+L228: .data -672, -191, -226, 568, 623
+L229: inc L42
+L230: .data 380
+L231: .data 926, 576, 64, -47, -407, -610
+L232: .data -768, 740, 202, -308, -410, -404, -161
+
+L233: .data 655, 108, -505, -150, -847, 205, -25
+L234: .string "lxvhnczqgbumefbnwnezymcv"
+; comment
+stop
+bne *r6
+L235: .string "tpvkipgffjrjlrzxjhec"
+L236: .string "odgvxeeuiuu"
+prn r5
+prn r0
+cmp #144, L252
+L237: .string "bbkjkavmmpcbynosii"
+L238: .data -350, 460, -75, 782, 882
+sub L102, *r7
+dec L69
+L239: .string "kn"
+L240: .data 547, -808, 111, -196
+sub *r1, L281
+L241: mov L245, L305
+L242: .data -268, 678, 274, 826, -908, 739, -651, 907
+L243: .string "upxqhsgdalybhzhmw"
+L244: rts
+L245: .string "ebnsyutllmyal"
+L246: .string "uggcjnk"
+L247: .string "ndlwvuh"
+L248: .data 828, 56, 367, -721, 251, 930
+L249: .data 988, -890, -837, 285, -353, 441, -609
+L250: rts
+prn *r4
+L251: .string "mymlabetibuxwjbrfmuvutp"
+L252: .data 49, -774, 465
+prn L323
+jsr L43
+L253: inc *r6
+stop
+jsr L153
+stop
+L254: .string "qqmgyqzebqpcve"
+L255: bne L227
+L256: prn r3
+L257: .string "nfracxayp"
+inc L326
+add r5, *r3
+L258: .string "swgjxvkoiho"
+; comment
+L259: .data -878, -969, -526, -319
+L260: .data -622
+; comment
+L261: .string "g"
+add *r7, r3
+jsr *r5
+inc *r7
+; comment
+L262: .data -919
+L263: lea L231, L62
+bne L251
+L264: .data -779, -739, 952, -440, -879, 198, 168, -540
+L265: .data -609, 479
+
+L266: cmp L320, r5
+mov #181, r3
+L267: .data -410, -952, 721, 805
+L268: .data 799, 444, -835, 308, 792, -671, 417
+L269: .data -328, -273, 529
+
+L270: .string "dzyxxmocanmzxqxzltb"
+L271: .data 711, 709, 392, 449
+L272: .data -156, 20, 855, -79, 307, -106, -159, -358
+L273: .data 13, -277, 318, 682, 139
+L274: .data 320
+L275: .data -173
+L276: .data 276, -126, 535
+L277: .data -414
+L278: .string "gjiaqtfcatsfo"
+cmp L131, L213
+add r3, L304
+L279: .data -244, 127, -987, 682, -198
+L280: .string "afviouwzmrtdhjgld"
+L281: .string "o"
+L282: .string "lzwkmkzzfnazjebv"
+mov #-215, r6
+L283: .data 753, 770, 407
+add #87, r6
+L284: .data 276
+L285: .string "fajthdy"
+L286: stop
+L287: .string "sdhoqbzbmtkxiabqtyu"
+L288: .string "obvohmvhlortsrvpe"
+L289: .string "bbsmguihdqathfu"
+L290: .string "axjq"
+; comment
+L291: .data -686, 705, 623, 504, 323, 495, -497, -149
+not L325
+L292: .data 57, -658, 136, 453
+L293: .data 252, 792, -18, -270
+not *r5
+L294: jmp *r2
+L295: .data -711, 215
+L296: .data 327, 845, -386, -523, 681, 275
+L297: .string "kuwbwxejezkp"
+L298: .string "bvjminupmoboksixjhznq"
+L299: .data 897, -744, 194, 102, -823, -360, -109, -641
+L300: .data -349
+L301: .string "ykwjlatuxbanhjntnvzxoxfb"
+bne *r3
+bne L173
+lea L326, r4
+L302: .data -336, 229, -968, -920, -675, -525
+not r3
+L303: .data -807, -419, 470, -124
+L304: .string "yuzxlnlcfyzxiwd"
+L305: bne L316
+L306: .data 124, -353, 782, -690
+mov L231, L231
+
+L307: .data 824, -372
+jmp *r0
+rts
+cmp #67, #99
+L308: .string "aqbixpoixek"
+red *r3
+L309: .data 293, 587, 520, -375, -74, -793
+jmp *r4
+clr r5
+L310: .string "crhv"
+L311: .string "znaiosiotqmgnuuaqauj"
+L312: .data 639, 497, 355, 734, -523, 201, 575
+rts
+L313: .string "wpwuwrfhucawihqrrlga"
+L314: .data -633, -707, 896
+L315: .string "xouwvv"
+L316: .data -799, 724, -861, -158, -351
+; comment
+L317: .string "zzy"
+L318: .data -281, 239, 434
+L319: lea L299, L38
+L320: .data 91, 300, -752, 37
+L321: .string "ewtjgaebomlhljqz"
+L322: .data -434
+L323: .string "uoeramunzgifjot"
+jmp L298
+L324: .data 418, -778, -518
+bne *r5
+stop
+add *r2, *r5
+L325: .string "nnmlsm"
+L326: red r4
+L327: .string "flxspajsk"
+L328: .string "uzo"
+inc *r5
+inc L329
+add *r6, r3
+clr r6
+L329: .data -335, 852, 103
+
+stop
@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 14
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+L0: .string "fahipivdxwhlftivcfqktvyr"
+L1: .data -633, -605, -913, 587, 583, -959
+L2: .data 47, -812, -599, -526, -390, -776, 342, -376
+prn L118
+red r0
+prn #197
+lea L32, r2
+mov r7, r2
+L3: .string "asqdtpmbfdxmoml"
+L4: .data -349, 714, -821, -378, -237, -38, 339
+L5: .string "r"
+
+L6: .data 878, 873
+L7: sub *r1, r4
+dec *r0
+L8: rts
+jsr *r4
+L9: .string "zngvgelxsouof"
+L10: .string "piamgwy"
+lea L146, L186
+L11: .string "tzlhdhhzgzbav"
+; comment
+red r0
+L12: .string "fmzkfv"
+jmp *r2
+L13: .data -903, -467, 229, 137, -451, -394, 42
+L14: inc r2
+L15: lea L154, L9
+L16: .string "v"
+L17: stop
+rts
+L18: .data 461, 577, 444, -333, -198, 491, -827, 799
+red r1
+cmp r0, L12
+not *r1
+L19: .data 134, -151, 555, 540, -804, -547, 570, -504
+L20: .string "svyvvtywmmflrwf"
+L21: .string "agqv"
+add #21, L1
+L22: .string "s"
+L23: .data 127
+red r0
+L24: .string "zobynxzndjgrgqqdatteo"
+L25: .data -92, -564, 238, 962, 434
+L26: jmp *r2
+L27: .string "gnexypbgtovidqsozvlhhr"
+L28: jmp *r6
+L29: bne *r3
+L30: .data 159
+L31: .data 598, 590, 72
+L32: .string "xex"
+L33: .string "nudbmrgbean"
+L34: .data 846, -24, -383
+L35: .string "hkxezoevrnnvas"
+inc *r4
+L36: .string "p"
+inc *r5
+L37: .string "zjapkq"
+L38: .data 807, 147, -411
+rts
+L39: .string "ytcdaixkmnahgbzowud"
+L40: .data -741, 93, -937, -173, 573
+prn r2
+sub #5, r0
+mov r3, *r6
+L41: .data 10, 509, -97, -820, 555, -310, -274
+stop
+sub *r2, r7
+; comment
+L42: .data 929, 314, 99
+L43: .string "eqpk"
+L44: mov L227, *r5
+clr r2
+L45: .string "p"
+L46: .data 357, -127, -819, 957, -824, 158
+L47: .string "obmukhmja"
+L48: .data -588, 600, -618, -46
+L49: .string "z"
+L50: .data -185, -861, -448, 755, -325
+L51: .data -754, 462, -417, 211, 772, 797, -413
+L52: mov *r4, *r4
+L53: .string "mzmkxvf"
+L54: .data -9, 557, 619
+L55: .data 675, 221, -864
+
+L56: .data 814, -439
+L57: .string "hqrjukfcdomqdjyqmopwdcjg"
+stop
+jsr L20
+clr *r3
+
+L58: .string "kpcgpvt"
+L59: .data -693, -874, -116, 121, 360, -42, 854, 417
+L60: .data -607, 5, -325
+bne *r2
+bne L279
+add #214, r5
+cmp #-144, *r7
+L61: .string "gaqtpsdruyzk"
+L62: stop
+L63: .string "mmwbeuhmyaajyitdf"
+L64: .string "jsvziueoehsfygtqyhahqep"
+L65: .data -733, 245, -33
+jsr *r3
+jsr *r4
+L66: .string "lmdfyefnmsy"
+L67: .data -343
+stop
+L68: .string "yrhrqwuqsdlxrxwdkp"
+L69: .string "bnirfq"
+L70: .string "rrp"
+L71: .data 99, -437, -665, 711
+L72: .string "npfqymreadgkwfob"
+prn r4
+L73: .string "qkfeyh"
+L74: .string "eboqlakujkgpnbdilu"
+red *r4
+L75: .string "vjagoaynzwtor"
+L76: .string "cibmlvmxzadjytnckjsmho"
+L77: .string "ypebbartpgvgad"
+add #30, *r2
+add #-104, *r7
+rts
+
+L78: .string "zucfviznpxpxxnnmfmaaulk"
+sub #137, r2
+cmp #82, *r3
+; comment
+L79: jmp *r0
+L80: .string "b"
+L81: .string "qtwcc"
+not *r0
+L82: .string "ttemagyxvhdgmr"
+L83: .data 426, 956, -589, -461, -713, 958, -804, 735
+L84: inc L132
+L85: .data 541, 848, -420, -95, -746, 25, -999
+not L29
+
+L86: .data 711, 313, -620, 606, -383
+L87: .string "mb"
+L88: .data 550, 744, 84, 485, -870
+sub *r7, L215
+rts
+inc L29
+L89: .data 716, -215, 647, -640, -955, 629, -585
+add #9, L36
+
+L90: .data -566, 462, -697
+L91: .data 261, -832, 286, -962, 908, 79
+L92: .data -663, -438, -35, -433
+
+L93: .data 779, -462, -990, -199, -249
+L94: .data 549, -178, 241, 73, -818, -248, -336, -634
+L95: .string "mwilrzzlh"
+L96: .data -643, 130, 738, -776, -433
+L97: .data -539
+cmp r1, r7
+L98: .string "zuekootysed"
+L99: .data -462, 80, 246, 275, 520, -170
+L100: .data 105, -417, -941, 121, 859, 723, 776, -153
+prn #-25
+jsr L213
+cmp L180, r0
+L101: .string "nfxkmsnjn"
+jmp L35
+rts
+L102: .data 629, 391
+L103: .data 234
+prn *r5
+L104: .data 201, -244
+L105: .data -388, -839, 761, -718
+L106: .string "fifcfxmxvwlrgvbwrbmyxpzb"
+L107: .data -301, -612, 405, -654
+mov *r5, *r5
+jmp *r0
+sub #-194, r0
+L108: .data 677, 981
+L109: .data 850, -730, -279, 838, 313, 183, 864
+jmp L235
+mov *r1, *r7
+L110: .string "ysmijfrgbyjsceyjqtnckm"
+L111: .string "cnwsprktc"
+L112: .string "ewshobavdqh"
+L113: .data -799, 39
+clr L284
+; comment
+L114: .data -770, 970, 533, 783, -869, 692, 72, 317
+L115: .string "pg"
+bne *r5
+L116: .string "xuyuyepi"
+L117: .data -306, -266, -258, -897
+dec L15
+L118: mov *r1, *r4
+L119: .string "bfcjxf"
+bne L293
+L120: prn L71
+L121: .string "pfletkp"
+mov #-180, L6
+L122: .string "rejbmadbyptfguygrjiu"
+L123: .string "pqtfsaddtwcqtljv"
+L124: stop
+sub r1, L49
+L125: .string "dqqkollfasohcfhnsmww"
+L126: .string "gyziawutx"
+L127: .data 984, 537, 43, -516, 804, 345, 543
+prn *r7
+L128: red *r5
+bne L39
+lea L294, L86
+L129: .string "juyozhbaqtzhvvfxnw"
+L130: clr r3
+L131: .string "usxcxf"
+L132: .string "lmbvwxqfbvatinqmcu"
+L133: prn *r4
+inc L82
+prn r6
+cmp r0, *r7
+L134: .data 324, -777, -426, 259, -753, 731
+L135: .data 639
+L136: .string "hxwgcqvwujehfibjdfwrr"
+L137: .string "gwqxnzqrljbr"
+bne *r6
+L138: .string "meyeaxhnljpaefmigitjvmp"
+L139: .string "fobegpwdkc"
+L140: .data 898, 391, 916, -290, 45, -152, -990, 826
+L141: .data -555, -735, 812, 105
+L142: .string "gzdioncbofbqallmoay"
+stop
+L143: .string "cuteouh"
+bne *r7
+add L172, *r7
+; comment
+L144: rts
+L145: .data 950
+L146: .string "jfbkycjiczufjrvuip"
+jsr *r6
+L147: .string "zhmahbmhgcoermjyr"
+
+L148: .string "ebpuixkyfvoeqpvdehfm"
+
+L149: red *r6
+
+L150: .data -449, -943, -643
+L151: .data -796, -287, 923, -798, -40, 949, -793, 433
+
+prn r6
+jmp L113
+jmp *r5
+L152: .string "oobtwikz"
+L153: stop
+L154: .string "kescjrkw"
+L155: .string "pfubjogrs"
+mov r0, r5
+L156: .data 457, -976, 489, -374
+L157: .string "beodnpgesymilockrbk"
+L158: .data 949, -939, 144, 702, -58
+bne *r6
+L159: lea L239, r4
+jmp *r6
+red L8
+mov #-99, *r6
+L160: .data -496, -826, 294, -239, -287, 400, -212, 538
+L161: .string "hrsmusqyipeoz"
+L162: prn *r4
+L163: .string "coedntis"
+prn *r2
+L164: .data 558, 46, -500
+red L97
+sub r2, L235
+clr *r7
+L165: .data 35
+
+L166: .data -169, -336, 303, 624
+
+L167: .string "rqjyvcnzeimalqkcssdpryb"
+cmp r6, #-87
+clr *r6
+clr *r1
+L168: .data 526, -853, 234, -105, -935
+L169: .data 525
+L170: .data 898
+L171: .string "dxjqfh"
+L172: .string "gdpx"
+clr L195
+
+L173: .string "qrlgwnihedeh"
+jmp L149
+L174: .string "qoosenfylopcxfgioemxpbv"
+; comment
+jmp *r2
+L175: jmp *r5
+prn r4
+L176: inc *r2
+rts
+L177: .string "xzjqtmpmstrfbwb"
+L178: .string "asgxc"
+stop
+L179: .data -553, 336, -318, 132, 106, 967, -606
+L180: .data -74
+lea L237, *r5
+L181: .data -203, -539
+L182: .data 864, 946
+L183: .data -377
+L184: .string "ngdpiepb"
+bne L48
+L185: .string "xghsgzmelw"
+inc *r5
+
+dec *r1
+L186: .data 137
+L187: .string "kl"
+L188: .data 728, -775, 871, 951, 282, 617, 733, 751
+L189: .data -195, 16, 444, 969, -219, 276, 786, 28
+sub L163, *r7
+L190: prn *r6
+
+L191: .string "aanm"
+L192: .string "lckrehmo"
+not *r6
+L193: .data -989, 345, -179, -162, 403, 671, -294
+L194: .string "xazstfahp"
+L195: .string "lufudedcnsljujfzdozuxvsr"
+L196: .data -359, -216, 508
+L197: .string "hfavisfa"
+add L113, *r7
+L198: clr r2
+L199: .data 427
+L200: .string "kpyvitxfwcmipce"
+L201: .string "ulcvaj"
+sub *r3, r4
+bne L219
+L202: .data -436, 782, 96, -407, 497, -384, -417
+L203: .data -86, -584, -223, -207, -140, 563
+prn #152
+; comment
+L204: red r3
+L205: .data 419, -335
+L206: .string "pqub"
+add #149, L67
+L207: .string "egugygyffenmzxyly"
+red *r7
+stop
+; comment
+red L306
+L208: .string "mozrosuibxvmmng"
+
+L209: .string "vecrclzctcnoiiobrpypglns"
+L210: .data 396, 898, -593, 289
+mov *r4, r2
+L211: .string "vhyyqbumjxlbgql"
+L212: .data -556, -532, 512, -600, -942
+inc L47
+L213: .string "ygfrhpa"
+stop
+inc *r4
+L214: .string "grxfdcvoqajhxqgikgqy"
+lea L199, r7
+not *r7
+L215: .string "ljfsy"
+L216: .data 399, 74, 837
+L217: jsr *r7
+L218: .data -645, 21, -107
+jsr *r6
+L219: .data -280, -666, -258, -585, 525
+L220: .string "eopaibrsbtnnamdr"
+L221: not L168
+L222: .data 29
+L223: .string "kfwryjmizpfitrabpcdkjuag"
+L224: jsr L196
+L225: .data 757, -823, -246, -734, 915, 474, 160
+L226: .string "meiaoihcupdlttxlrftlyqx"
+not r1
+L227: dec *r1
+L228: .string "qne"
+L229: red L3
+lea L134, r1
+L230: .data 35, 148, 764, -541, 767, 325, 551
+prn r0
+lea L163, *r2
+L231: .data 766, 810, -231, -390
+prn *r7
+L232: .string "mushhjkmifsbnrsyxdacqox"
+L233: .string "mdjrojkicxmqfgmewircg"
+L234: .data 489, 729, -206, -211, -399, -248, -974
+; comment
+L235: .data 479, -115
+clr *r2
+L236: .string "ddprqtthslmxnbkgzshnbdz"
+L237: .string "ahmlqsazslzbuvfzq"
+inc L307
+L238: red *r1
+L239: .string "t"
+stop
+L240: .data 288, -115
+inc r4
+clr *r2
+cmp L247, *r5
+L241: .string "hecobrdogmzmfnybcm"
+; comment
+rts
+L242: .data 607, -600, -478, 133, 684, -505
+L243: .data 291, 968, -175, 635, 585, -624, 444
+; comment
+red r1
+L244: .data 16, 668, -613
+L245: add *r5, *r7
+not *r7
+bne L253
+L246: .data 298, 404, -808, 103, 48, 231, -915, 256
+L247: .data -736, -882, -404, 617, -502, 493, -157, -897
+cmp L174, #-252
+L248: .string "uslhanqoldhywj"
+L249: .data 597, 643, -257, 639, -53
+L250: .data 83, 317, -768
+lea L4, L58
+clr *r1
+L251: .data 467, 95, -103, -924
+L252: .string "iwhtkuktj"
+L253: .string "uhwvcxodyfeu"
+inc L100
+L254: .string "fdpklvxfxz"
+L255: .data -217
+L256: .data -216, 161, -747, -889, -467, 763, -802
+L257: .data -722
+L258: .data 279, 804
+stop
+L259: .string "vbuviyrwbyauufvzw"
+stop
+L260: .string "qdzskxxzquy"
+L261: .string "ueaummovvwrfpxgosrite"
+L262: .string "eknvpwlbq"
+L263: prn L184
+not L127
+rts
+dec r4
+L264: add L118, *r4
+jmp L266
+L265: .string "gnvrtiqiaipj"
+dec r3
+L266: .data -346
+mov *r6, L146
+L267: .data 966, -252, -325, -959, 516
+L268: .data 833, 350
+L269: .data -353, -512, -952, 462, -145, 196
+L270: .string "ybrubr"
+L271: .string "uvuygduyozteixczxhogp"
+L272: .data -27, -804
+; comment
+L273: .string "xigjicbvjfyvtkxjdtmys"
+L274: .string "zslxeftfaxwiwzvtocbvayt"
+L275: .data 571, 673, 98, 837, 553
+bne *r5
+L276: .string "bspronpveabitolshdzpkjl"
+L277: .string "cxsdkzqzzzknlkbeku"
+jsr *r5
+L278: .data -907, 755, -309, -781, 830, -864
+L279: .data 547, -237, 544, 912
+mov #-66, r5
+L280: add #-155, r2
+sub r1, L224
+L281: inc r3
+L282: .string "oxmefxfbutj"
+L283: inc *r6
+L284: .data 927, -644, 595, 279, 373
+L285: .data 269, 105, -691
+L286: .string "nzwhznrxv"
+L287: cmp r3, *r6
+prn L302
+inc L289
+clr r5
+L288: .string "pwx"
+L289: .data -820, -802, -820, -186, 431, -82, -711, 257
+L290: .string "tlcmhmkmiltlgt"
+L291: .string "svvmvnqdacdttkbngppomav"
+inc *r7
+L292: .string "zzkk"
+L293: .data -155, 896, -813, -814, 49
+stop
+jsr L308
+L294: .data 21, -983, -742, -28, -136, 193, -960
+clr r5
+L295: .string "ppmxl"
+L296: .string "rkqlhzxrsznnryrs"
+L297: .data 773, 790, 500, -370
+L298: .string "ldpatjhis"
+jsr L305
+L299: .string "zdbhrycb"
+L300: .data 557, 533, 649, -140, -563, -472
+L301: .string "epieppr"
+L302: .data -539, -6, -929, 800, 821, 730, -908
+L303: jmp L102
+L304: .data 400, -683
+L305: .string "irtvup"
+L306: jsr *r2
+rts
+L307: .data -642, -379, -833, 180, -981, 908
+rts
+mov #153, r0
+lea L257, r4
+L308: .data 29, -359, -823, 269
+stop
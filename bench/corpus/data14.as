@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 15
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+L0: .string "vithvpbiofdlmdsbje"
+L1: .string "wamzudtjtwboujvclgumzq"
+L2: .data -435, -257, 592, -467, -172, 22, 208, 607
+jsr *r7
+jmp L274
+L3: cmp #197, #154
+bne *r2
+L4: .data -662, -419, -415, -108, 454, 613, -550
+L5: .string "nhabntpefdsinnlslsjapr"
+prn *r5
+L6: .data 559, 255, 286, -78, -928, 819, -233, 252
+L7: .string "rrxdckmzdsivkyvdxv"
+jmp L266
+L8: .data 446, 798, 38
+L9: .data -357, 188, 514, 441, -863, 527
+L10: .data 808, 8, -482, -366, -437, -728
+L11: .string "hjrnfkcywgfj"
+; comment
+lea L164, *r2
+clr *r5
+; comment
+L12: sub L4, r7
+rts
+L13: .string "jzueovbzvdjni"
+L14: .string "qwppxffhiuxehcypb"
+L15: .data -487, -210, 929, 8, -543, 838, 133
+L16: .string "spdbycnqo"
+L17: .data -146, 895, -870
+stop
+dec *r0
+L18: mov r5, r2
+add r6, L15
+L19: .data 56, 275
+inc L9
+L20: .data -64, -958, 819, 714
+jsr *r7
+jsr L168
+lea L14, r6
+; comment
+jsr L6
+L21: .string "vkemhwpfbvrazfrr"
+dec L160
+not L267
+L22: .data 478, -955
+L23: .data 152
+L24: .data 319, -872
+L25: .data 597, 399, 479, -842, 981, 707, 642
+L26: .data 372, -585, 911, -502, -857, 210, -361
+rts
+L27: .data 561, 360, -831, -781, 299, -658, 931, -482
+L28: .string "thudywqnucilkk"
+L29: .string "uacgpt"
+inc L24
+jsr L239
+L30: .data -998, -550, 158
+bne L86
+sub #132, *r1
+L31: .data 599, -309, 489, -349, -627
+L32: .string "cwrzqzawmiegeavhd"
+L33: .data 322
+L34: .data -943
+L35: .string "vaq"
+jsr L15
+; comment
+
+L36: not *r5
+L37: .string "wmmroygqopbyr"
+prn *r7
+L38: .data 473, 587, 169
+L39: .data -107, -600, 966, 944
+
+L40: .data -274, 207, 355, -214, -226, -807
+L41: .data 662, 872, 778, 826, 169
+L42: stop
+sub r3, *r6
+L43: .data -215, 953, -821
+L44: .data -922, -56, 343, -476, 749
+L45: .string "qxxpt"
+inc *r7
+L46: .string "kaxqoeojmwskjh"
+L47: .data 859, -277
+cmp L186, L144
+not L40
+L48: .string "hnhrwhcbt"
+L49: .data -718
+bne L308
+L50: .string "d"
+L51: .data 902
+L52: .data -443
+L53: .string "agdypdvele"
+L54: .string "lwmsvskzveikaw"
+L55: .string "trp"
+bne *r4
+lea L39, r3
+dec L207
+L56: .string "w"
+L57: .data -520, -744, 653, 361, -201
+clr *r6
+L58: .string "arnjnozsxyx"
+L59: .string "dsuduk"
+L60: .data -257, 857
+L61: .string "tebgluhwlzq"
+L62: .string "dwcrffufiumclxflnoo"
+lea L8, L218
+L63: .string "evwtlnfthzfh"
+L64: .string "ablqaxo"
+L65: .data 265, -91
+L66: prn L167
+L67: .data 197, -963
+L68: .data 736, 161, -449, 422, -946, 114, 184, -766
+L69: .data -314, 100, -685, -913, -517, 690
+L70: .string "rxxi"
+
+stop
+bne L97
+red L49
+dec L77
+L71: .string "yjvviedcdsgwbptijkoidljq"
+L72: .data -705, -129, -306, -887, -635
+prn *r1
+L73: .string "ozhxqbvkzpivjlc"
+L74: .string "bxqnwpyiwdtgmtdbtzddhx"
+L75: jsr *r3
+L76: .string "cewktnlhlyiicpsfbivaxyhj"
+prn L28
+L77: inc *r2
+L78: inc *r6
+jsr L110
+rts
+L79: .string "cupsoybsgsgslpzogv"
+dec r7
+L80: .data -662, -932, 42, -529, -189, 91, -40, 509
+rts
+L81: .string "nkrrffioqmcpohafda"
+dec L165
+L82: .data 788, -219, 588, -78
+L83: .string "kyhgcflztsajadanztckz"
+prn L116
+L84: .string "wjlecgdmmnvux"
+L85: .data -233, -437, 750, -928, -77, 338, 533
+
+bne *r6
+L86: .string "jccgdguwsh"
+; comment
+dec L40
+L87: .data 230, 802
+rts
+prn *r1
+L88: .string "saysdtetmzcakzurjobgo"
+L89: .string "wawpdkwdop"
+jmp L188
+L90: .string "mngprion"
+stop
+rts
+L91: .data 32, -749
+L92: .data 424, 651
+L93: .data 109, -172, -925, -736
+L94: .data 6, -853, 884, 786, 927, 788, -498, -397
+dec L83
+L95: .data -531, 481, 927, -851, 481, -486, -68, -517
+; comment
+add *r4, *r4
+L96: .data 125, 300, -475, 339, -411, -52, 153
+L97: .string "xxfb"
+add #21, *r1
+L98: .data -288, -461, 770, 726, -849, 617, 771
+L99: .data -857, -976, -407, -970, -606, -836, -454, 793
+L100: dec L75
+L101: rts
+L102: .data 287, -814, 613, -139, -642, 553, 157, -46
+L103: .string "lzrqpba"
+add r1, *r3
+cmp r2, r2
+rts
+L104: .data -325, -256, -567, -818
+L105: cmp #7, L255
+L106: .string "bzetfnuttqpylvyvasiifu"
+L107: .string "cmtpsabfhofcmkjxkkqxg"
+L108: sub *r4, *r7
+prn r1
+L109: .string "r"
+clr L32
+lea L97, *r3
+L110: .string "fkbysummvqa"
+mov r4, r5
+L111: .data 212, -373, -375, 651, 16, -982
+L112: .string "qpmershd"
+L113: .data 672, -425, 521, -105
+L114: .data -564
+clr *r6
+L115: .data -921, -772, 676
+L116: .data -337, -496, -605, -958, 305, -422, -107, -606
+prn L205
+L117: .string "gdhgxshgwgks"
+L118: .data 700, 847
+L119: .data -696, -420
+sub *r7, *r2
+dec r4
+L120: .data 948, 904, 932, -56, 746
+not r7
+clr *r1
+lea L239, L20
+L121: inc L155
+not r0
+L122: .string "mezxbhusfrer"
+inc *r5
+add L37, L49
+L123: mov #81, L80
+sub r4, r5
+L124: .string "lehgwehdqiq"
+L125: .string "liqwwsc"
+L126: .data -626, -553, -626, 650, 213, 799, -146
+L127: .string "knunoqbvenwkambqjbgiskow"
+L128: red L40
+L129: .data 829, 150, 142, -513
+L130: .data -402
+L131: .data -66, 942
+rts
+rts
+L132: .data 549, 23
+prn *r5
+bne *r5
+L133: .string "kjtrtogtduboeocs"
+; comment
+L134: .data -808, 937, -37
+L135: .data 956
+L136: .data -474, 970
+red r2
+lea L38, r2
+L137: .string "limqcgvofqkiarpgl"
+L138: .data -722, -394, 275, 626
+jsr L23
+L139: .data 355, 292
+L140: .string "dtaqaebtrqzpp"
+; comment
+not r1
+prn L35
+L141: stop
+prn *r2
+clr r6
+L142: .string "gndtq"
+L143: .data -336, 502, 375, -627, 855, -48, 338, -936
+stop
+sub r5, L63
+L144: .string "cniamlijwystohmvwtiaqmlo"
+red r2
+not L72
+add *r6, *r7
+L145: .data -583, 121, -771, -978
+L146: .string "wpkgjdveusxa"
+L147: inc *r4
+L148: .string "qjsnkyt"
+L149: .string "ippnrenag"
+L150: .string "vhyyynvkafxsktpycid"
+L151: .data 328, 472, -254, 472
+L152: .data 552, -510, -213, 116, -189
+add *r5, r1
+L153: .string "titjxnzyazlda"
+L154: sub r1, L192
+stop
+L155: dec *r3
+L156: .string "tbvipcfusinmfozlihpcfjjv"
+inc L31
+L157: .string "cjarmsfymk"
+rts
+
+L158: .data 369, -977, 626, -632
+L159: .data -80, 826
+
+rts
+L160: rts
+rts
+L161: .data 598, -272, 717, -904, 96, -382, 112
+add L111, *r1
+stop
+L162: .data 354, -108, 873, 243, 117
+L163: .string "pvgbtild"
+L164: .string "qqxartwcljyymvldgyxrn"
+
+L165: .data -333, 131, -226, 615, -822, 632, -550, -123
+jmp *r4
+L166: .string "btxpg"
+L167: .data 278, -540, -774
+inc r7
+L168: .data -463, 56, -393, -856, -55, 709, 407, 524
+L169: .data 888, -970
+L170: .data 889, 600, 163, 869, 958, 509
+L171: .data 461, 951, 147, -516, -386, -130, 62
+L172: .data 727, -86
+L173: .data -145, -940, -464
+L174: .data 269
+L175: .string "yyaaxynqwnlgzlc"
+L176: not L238
+sub *r0, *r5
+cmp L312, r1
+L177: clr *r0
+L178: .string "tszdxoxnvywlxqydfetydtqg"
+red *r5
+inc r1
+L179: .string "geks"
+L180: sub r7, r3
+L181: not L295
+L182: .data 93, -381, 841, 237
+L183: .string "ypvumvozobkooccy"
+lea L37, r3
+L184: .data 229, 238, -354
+L185: .data -582, 981, -186, 972
+L186: .data 285, -471, -636, -251, 2, -203, 258
+L187: .data -512, -83, 714, 715, -876, -527, 148
+L188: red r6
+cmp r7, r2
+jsr *r4
+L189: .string "hzikmahklfpgqemcaxvsovig"
+L190: .data 735, 896, -553
+L191: .string "kconfmwcmhgqquykbecjb"
+L192: .data 44, 344, -149, -606, 992, 673, -725, 68
+L193: .data 295, -757, -691, 537, -972, 497, 473
+; comment
+L194: .string "jgkhywhpyjabs"
+L195: .data 430, -292, -403
+L196: .string "nkrllgzza"
+L197: .string "smsruxgkimkwuznqzajcygvk"
+clr r7
+
+L198: .string "gwspigirgmwqhevavgmao"
+L199: .string "dyvwlnykaqxzgpdfujt"
+add #28, L256
+L200: .data 659, 48, -987, 752, 471, 153, 479, -898
+stop
+L201: .string "ojaqseptzurwme"
+inc r4
+L202: .data 1, -330, 243, 268, 921
+jmp L138
+L203: .string "sbxlf"
+not *r1
+L204: .string "gibxhqxmxjta"
+inc L125
+inc *r7
+L205: .string "vyn"
+; comment
+mov #254, *r1
+not r3
+cmp *r2, L100
+L206: dec L209
+L207: .data -570, -544, 869, 917, -680, -546, 108, 953
+prn L216
+not L38
+L208: .string "pbarasayslsfjxofx"
+L209: .string "hshobwh"
+jsr L153
+L210: .data 875, -939, -163, 523, -241, -413, -838, -879
+L211: .data 386
+jmp L91
+L212: .data 276, -538, -399, 112
+L213: .data 603, -867, -101, 173, 798, 305, -182, 809
+rts
+; comment
+L214: .string "fepkriquilmbagemvhqkyx"
+L215: .string "hahmqwqpmdbmnvcxgqpo"
+L216: .string "wbjrnrgkkhmuajiijwobp"
+L217: stop
+L218: .string "jrxprqqtkontqcfbeutrizaa"
+L219: .string "tgomcownkzv"
+dec *r5
+bne *r6
+L220: .string "qxthualbcdsccdmff"
+L221: .string "ufu"
+L222: .string "jetn"
+L223: .string "vy"
+inc r5
+
+L224: .data 45, -82, 539, -916, 851, -134, -922
+lea L313, r0
+L225: .data -832, 969, 206
+L226: .string "tzuwvoefidufjoyy"
+sub *r6, r0
+L227: add r1, L292
+red r3
+L228: .string "fnpwnbuwcfvsgsdpkuxbcg"
+L229: .string "rzebkcwzksfexqkmariap"
+L230: .data 290, -775, -77, -992, 852, -202, -101, 756
+L231: .string "cytlwplyiwanbvf"
+L232: .string "rchnfzb"
+red L311
+L233: .data 840
+L234: .data 448
+L235: .string "fenuovluuxi"
+red *r1
+mov L178, *r0
+L236: .data 548, 897, 952, 768
+not r7
+L237: .data -852, -119, -704
+L238: .data -234, -614, -320
+L239: .string "ikblsihv"
+inc r6
+L240: .data 326, 652
+stop
+
+stop
+clr L267
+L241: .data -244, 599, 158, 592, 757
+mov r4, r2
+sub r5, r3
+L242: .data -325, -412, 172, -317, -422, -236
+L243: .string "zjjzrignbj"
+inc r3
+L244: .string "chl"
+bne L50
+rts
+L245: .data -704, -875, 876, -642
+L246: .data 548, -365, -332, -940, 6, 476, 105, 496
+L247: .data 738, -989, 695, 656, 121, -60
+L248: .data 179, 379, -78, -855, 608, 776
+L249: jmp *r6
+L250: mov #161, r2
+sub r5, *r1
+L251: .data -514, -836, 794, 997
+L252: .string "ynfmwpfesssxdojioewqzvs"
+L253: .data -533, -457, 869
+L254: .data 524, 293, 500, 599, 286, -949
+L255: .data -429, 400, 137, 425, 132, 914, 469
+L256: .data 798
+dec r4
+L257: .string "adhv"
+L258: .string "vjgmovhqznn"
+inc *r4
+L259: .string "aagcj"
+L260: .data -722, -64, 945
+; comment
+L261: .string "spknftiyyx"
+L262: dec L295
+L263: .data 578, 590, -886, 496
+L264: .string "vttaatjfpgvpawnrt"
+L265: .data 88
+L266: .data 334
+stop
+L267: .string "hhyiei"
+; comment
+L268: .data 51, 387, -599, 227, 685, 215
+L269: .string "jeitkqawbkovvnsbreclc"
+L270: .string "sctu"
+L271: .string "qrcurgupurnhum"
+dec L228
+sub #40, *r4
+L272: .string "thohaexovathbmhq"
+L273: .data 377
+L274: .data 479, 584, 441, -606
+L275: .string "bbpbddhhuyo"
+L276: .string "pmfwra"
+L277: .data -382
+L278: .string "smhlb"
+L279: .data -476, 737, 305, -711, -944, -530, -17
+inc L28
+L280: .string "dmgooklvxa"
+prn r1
+L281: .data -938, 977, 348, -427, 257, 537, 923, -340
+clr L297
+mov r0, r0
+L282: clr L52
+L283: .data -274, 830, -289, 497, 208
+rts
+L284: .string "jshauhwssqqpokkfisoquab"
+L285: sub L290, *r4
+mov r7, r4
+
+L286: .data -567, 469, -652, -706
+L287: .string "pcnrzmynntlmvg"
+L288: clr *r1
+L289: .string "yldmp"
+L290: .data 380
+L291: .data 831, 855, 819, 72, -50, 882, 985, -167
+L292: .string "vvnthtzhxhkkueqep"
+L293: .data 204, 616, -363, -521, -149
+cmp r0, *r2
+L294: .string "pafwkwrb"
+L295: .string "gtlgqtolsigsozzsdoi"
+L296: .string "eyggeauitmn"
+rts
+L297: .string "mklorkpscqwcschykn"
+dec L256
+L298: .data -585, 807
+L299: dec r6
+L300: .string "qombdlefrihtuhy"
+L301: .string "bilbnobikvkkkfviieti"
+L302: .string "jubbuyukbqliozk"
+L303: .string "slclbpaliw"
+stop
+L304: .data -297, 35, -104, -986, -772, 302, 220, 185
+L305: .data 49, 910, -652, -187, -40, -854, 230, 958
+L306: .string "vcdxjkemqqcgemnewinciwg"
+clr *r1
+sub #58, r1
+L307: dec r7
+L308: mov *r7, *r6
+L309: .string "gkzavfqrxr"
+mov r4, *r2
+L310: .string "k"
+L311: .string "mrwbioiolgxrljbertc"
+L312: .string "jxtitymmizukgcxgyxpqig"
+L313: .string "pybrwjvc"
+stop
@@ -0,0 +1,524 @@
+; Generated by genCorpus --seed 16
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: bne L3
+stop
+jsr *r3
+sub #45, r7
+L1: bne *r6
+lea L1, *r4
+lea L1, r1
+L2: .string "ukitm"
+L3: .data -424, 635, 93, 113, -340, -263, -604
+L4: .string "lcealuizlqwmitjb"
+red r0
+L5: .data -913, 487, -8, -139, 500, 728
+L6: .data 237, 249
+L7: .data -274, -777
+L8: prn L5
+L9: lea L22, L9
+L10: .string "zknuola"
+L11: .data 248, -618, 81, 859, -908
+L12: .data -614, -163
+L13: .data 17, 246, -501, -83, -969, -494, 806
+L14: .data -48
+L15: .string "tbmbiuskqirdszr"
+L16: .string "ayfmcfomi"
+L17: .string "wndfdapsmt"
+; comment
+L18: .data -72, 662, 628, 632, 716, 977
+L19: .data -857, -257
+; comment
+L20: .string "imde"
+L21: .string "lzes"
+L22: prn #240
+L23: .string "mijshtyygl"
+L24: .data 715, -430, 517, -655, -851, 185, -245, -10
+jmp L10
+mov #147, r0
+sub L103, L241
+bne L250
+L25: .string "efnmafueldrmcx"
+stop
+jsr *r0
+L26: .string "feaqusvbarfjubywkoqqvis"
+clr *r7
+clr L145
+L27: prn *r2
+L28: .data -859, 754
+
+L29: .string "jxiuy"
+stop
+L30: .data -475, 44, 428, -690, 66, 810, -915, -457
+L31: .string "juanzpsarwqyphvwrl"
+L32: .string "xqqtehwl"
+L33: .data 802, -939, 901
+stop
+dec r7
+not *r0
+prn *r3
+L34: .string "ezeqhgbbrcqhov"
+L35: .data -792, 44, 711
+jmp *r7
+L36: .data -640, 538, 265, 649
+; comment
+L37: .string "wlkqkqfkdieis"
+L38: .string "psfobba"
+L39: clr L226
+L40: .data -540
+L41: .string "bbddjbkkzhnrw"
+; comment
+jmp *r7
+prn r3
+L42: .string "krwqcvywr"
+L43: .data 502
+L44: .string "udjlakwvi"
+cmp L172, #47
+L45: .data 416, -788
+L46: .data -555, -211, 551, -346, 748, -274
+L47: .string "zmnajcayw"
+L48: .string "izshyjuxadssmtsdbtmoytt"
+inc *r5
+L49: .data 619, 518, 508, 382
+L50: add #79, r0
+L51: .data 567, 48, 352, -871, -743
+L52: .string "wjiprl"
+L53: .data -238, 492
+L54: .data 574, 982, -776
+L55: stop
+L56: prn L317
+; comment
+L57: .data 364, 661, 368
+L58: .string "nddtjfnibfuunmqhd"
+L59: .string "rc"
+
+L60: .string "luskj"
+lea L276, *r6
+L61: .data -55, -612, -261, 860, 915
+L62: .data 978, -780, -356, -848, -203
+L63: .data 485, -380, -856, 332, -301
+L64: .data 920, 242, 461, -165, 278, 605
+sub L40, L210
+L65: .string "jaqazzalsijhgplmiyiljh"
+L66: .data -306, -978, 683, 701, -980, 185, -55
+
+L67: .string "iujuolcwdktoxk"
+L68: .data -967, -414, 648, 126, -979, 348
+L69: sub #-110, r0
+L70: dec r2
+L71: .data 255, -207, 711, -585, -25
+L72: .string "mjk"
+L73: .data 697
+cmp r2, #-61
+L74: .data 245, -583, 401, -912, -743, 484, -270, 665
+L75: .data 514, -910, 49, 254, -563, 792
+L76: .string "vxkggayohcnrnhbjn"
+jmp *r7
+
+L77: .string "oowqtslczswrzozxvpm"
+L78: .data -123
+L79: .string "yd"
+rts
+L80: .string "fbctgbz"
+inc *r2
+L81: .data -692, -938, -494, 623
+L82: .data -554, 512, 809
+dec r1
+L83: jmp L8
+; comment
+dec L258
+jsr *r7
+inc r3
+L84: .data 927, -440, 707, 776, 704, -436, -482, -856
+L85: .string "i"
+L86: cmp *r5, L126
+L87: .string "chsftsmh"
+L88: .string "hmcesswukttclhbhvzfw"
+L89: .data 593, -364, -594, 72
+L90: .data -788, 579, 668, 609
+L91: .data -689, 497
+L92: .string "sqqsvfscdtr"
+L93: .data 133, -539, 1, -943
+L94: .string "djzehfwetuhhhitjeckrxg"
+L95: .string "v"
+bne *r3
+L96: .string "hmpxdtcrewadlxxtgubduv"
+L97: .string "rnctzjyaaeexfk"
+inc *r7
+L98: .string "kdbrqeqkknthczfoc"
+L99: .string "tuvdyxelimwx"
+L100: .string "isvbufnopxbvhnhryimvm"
+L101: .data -883, 589
+L102: .data 344
+inc L37
+L103: .data 215, -419
+L104: .data -502, -573, 174, -327
+jsr *r2
+L105: .data -137, -422, -364, 554, 489, -218, -533
+L106: .data 677
+L107: .data -209, -296, -520, -713, -519
+lea L63, r2
+L108: sub #-181, L173
+L109: .string "qymboznnaxctzhseyq"
+L110: .data 99, 379, -117, -807
+lea L111, *r2
+clr L297
+add L316, *r1
+L111: .data -920, -730, -898, 77, 242, -789, 903, 323
+clr *r6
+L112: prn *r5
+L113: .data -972, 939, 87, -685, -779, -917
+sub L246, L5
+stop
+L114: .string "yrxxexquah"
+L115: .string "hypvrjujpldpscttxuif"
+L116: .data -745, -792, -531, 62, 17
+L117: .string "qavcfbntqwubpe"
+L118: .string "croxjkaqilwnadqiku"
+L119: .string "hwknbxszpbnbyqea"
+L120: jmp L110
+L121: .string "ybxsvwumkrfai"
+L122: .data -77, 622, -390
+L123: .data 391, 181, 674, 783
+L124: .string "vpgfxtgbttskq"
+jsr L203
+L125: .string "ifv"
+L126: .string "lagphx"
+L127: not L125
+L128: .string "q"
+L129: .data -199, -101
+bne *r6
+dec r5
+L130: .data -186
+jmp L164
+L131: jmp *r2
+L132: .data -810, 102, 969, 324, -60, 59, 10, 851
+L133: .string "jmighgzoec"
+L134: .data 147, -483, -1, -336, 707, -371, -854, -412
+L135: .string "rdwplo"
+L136: .string "abnnmlmmqfkwxgfkgj"
+L137: bne L124
+L138: .string "jdkdpafepfshsgmerjdlbtj"
+L139: .string "tralyfwwfnwxvkmjubpfo"
+L140: .string "uakedxnuzdeazoyu"
+L141: .data -826
+L142: .data -403, -532, 791, -191, 819
+L143: .string "igsyumgvsngzzfnzw"
+L144: .data -5, -803, 403, -232, -81, 491, 296
+L145: .string "keibrpw"
+L146: jsr *r4
+L147: .data 101, -954, -851, 925, 359
+L148: sub r3, *r6
+L149: .string "rdriw"
+jsr L141
+L150: .data -732, 298, -463, 429, -602, -119, -89, -424
+L151: .data -483, 39, 693
+L152: .data -59, -386, -589, 477, -917, -404, 724, -84
+cmp #118, #-16
+mov L22, *r6
+L153: .string "cvskmdoawn"
+L154: .string "izjlzdiq"
+L155: .data 947, -722, 44, -984
+L156: .string "ybpbsn"
+L157: .string "mnodhpsgskcchoxqfhaychry"
+add *r2, *r6
+; comment
+L158: .string "zykjdhaphumhiniyakhgglro"
+jsr *r7
+bne *r3
+L159: .string "logpjucawxvnynbudbnb"
+L160: .data -301, -613, -975, 860
+L161: .data -943
+sub #-217, *r6
+L162: .string "bvcxpfxnwxrgguylzei"
+bne L3
+L163: .string "zcrvavaakxnidynfln"
+L164: .data 181, -32, 573
+L165: .string "toirksrnw"
+L166: .string "d"
+L167: .data 832, 734
+L168: .string "mmisdtgsabeijztnru"
+L169: .data 653, 229, -836, -275, -780, 361, 63, -574
+L170: .data -202, 214
+L171: .string "juvrpqatnwi"
+clr L205
+jmp *r1
+red *r3
+L172: .data -135, -251, -128, -724, -338
+L173: .string "bnixfok"
+L174: .string "ualvpojgqrk"
+jsr *r5
+L175: .data -196, -693, -33, -727, 181, 679, 537
+L176: .string "ucrayiztb"
+L177: .string "jbccisbfvvelybzszlywnv"
+L178: .data -148, 936, -986, -380, -554, -728
+prn r5
+L179: .string "zxucyymi"
+L180: .data -47, -36, -508, 308, -937, 34, -173
+stop
+L181: .string "nnwypkxmhvroxrmpfvmdsa"
+red r7
+clr *r2
+L182: .string "ggackywwvcilhtkhnivasnr"
+jmp L141
+inc L318
+L183: .data 827, 14, 409, -978, -388, -946
+L184: .string "zcsm"
+inc L151
+clr r3
+; comment
+red r3
+stop
+mov *r5, r2
+L185: .string "tpbcsd"
+L186: .string "nviijicozirhzgjiy"
+L187: .string "bbvohbkqtxylmvtadkiyozp"
+prn L300
+L188: .data 955, -273, 265, -366, 362, -338, 832
+red L72
+L189: .data 794, 498
+L190: .string "pfuc"
+jmp L26
+L191: .string "ujyhsoc"
+L192: .data -416, 695, 429, 447, 12, 895, -690, -322
+lea L21, *r2
+rts
+jmp L329
+lea L325, r5
+L193: .data 192, 843
+L194: .string "udawlzqtqawp"
+L195: .data 608, 149, -352
+L196: .string "teamabotwusqyjeny"
+; comment
+L197: .string "typykchejppgqoiekn"
+L198: red r7
+L199: .data 486, 938, -9, -361, -615, 627, 444
+L200: .string "zwdugon"
+L201: .string "pdowfwowh"
+L202: .string "fipekqewxc"
+L203: .string "u"
+L204: .string "ewzwxpjqudcvesjikygucsxc"
+jsr *r5
+L205: .data -537, -265, -179
+cmp L203, #-255
+L206: .data 859, 331, -801, 309, 58
+prn L333
+L207: .data -301, 315, -875, -833, -851, 540
+L208: .string "dcsulysqj"
+jsr L145
+L209: .string "pgyqjwbeyb"
+L210: .string "fvcujkvrfro"
+L211: .data -261, -549, -366, 437, 194, 162
+L212: .data 188, -749
+inc r4
+L213: .data -610, 896, -12, 47
+L214: .data 634, 130, 77, -74, -102, 798
+L215: .data -556, 886, -551, 546, -546, -12, -41
+L216: .data 773, 86, -135, -416, -566, -221, -797, 175
+L217: .data 673, -927, -47, 480
+L218: .data -912, 714, -640, -46, 617
+add r3, r7
+L219: .data -703, 443, 172, 779, -749
+L220: .data 837
+L221: .data -903, -652, -193, 802, 975, -131, 436, -138
+L222: .string "bqahqm"
+sub *r3, *r1
+clr r4
+L223: .string "mxhjjvskppkdbtmjuwofsy"
+L224: .data -201, -715, 602, -371, 69, 666, -994, 553
+cmp #-226, *r5
+L225: .data 474, 848, -414, -142, 35
+L226: .data 420, -92, -137, -249, -421, -879, 595, -450
+not *r3
+bne *r0
+L227: .string "cejodwdmh"
+dec r3
+red r5
+L228: .string "ctwhyfaewgxkup"
+rts
+L229: .data 694
+L230: mov *r4, L311
+L231: .data 251, 872, 418, 170, 611, 731
+L232: .data 384, -800, 46, 758, -997
+L233: .data -975, -531, 788
+L234: .string "furb"
+L235: .data 251, 58, -685, -800, 515
+L236: .string "ul"
+L237: .string "yvauayrvkceipljvsolypv"
+rts
+L238: not *r2
+lea L282, r1
+L239: .string "u"
+L240: lea L37, *r4
+L241: cmp #-215, #-95
+add L339, r1
+jmp L191
+
+L242: .data 980, -599, -469, 796, 494, 761, 271
+
+L243: .string "wtce"
+L244: .data 711, -614, 664
+dec *r2
+L245: .data 466, -355, 58, -926, -419, 907, 308, 737
+L246: inc *r6
+L247: .data -960, 312, 690, -495
+L248: .string "rxwojzqayrtdzf"
+L249: .data 205, 147, 393, 286, -632, -548, -528, 371
+L250: .data 460, -742, -749, -655, 335, -434, 403
+L251: .data -321, -29, -975, -407, 237, -838, 135
+L252: .string "qnkbmnciezszfdpskxchgjv"
+; comment
+L253: .string "fuxwxprszzamxzotosemaw"
+L254: prn L324
+L255: .data 801
+L256: inc *r2
+L257: .data -575, -554, -236, -31, -691, 413, 328, 345
+L258: .data 62, 241
+L259: .string "kqdgssduahuoqlkkieblu"
+jsr L82
+L260: .data 25, 968, -503, 176, 959, 921, -907
+L261: .data -847, -74, -138, -134, 883, 152, -727, 146
+stop
+L262: .data 547, 68, 5, -250, -322, 632, -388
+dec *r4
+L263: .data -771, 807, 519, 65, -422
+L264: .data 184, -360, -291, -58, 137, 686
+
+L265: .string "y"
+not *r1
+L266: .string "x"
+L267: .string "rjzxljjkvxaldtqhztv"
+L268: .data -904, -11
+L269: .data -481, -99, -849, 349, -645, -252
+L270: .string "wpuqlmuksvjjnupuqj"
+L271: .data -434, 212
+L272: mov r7, *r1
+L273: .data 434, -337, -294, -774
+jmp L345
+
+
+L274: .string "l"
+L275: .string "dhnhyyof"
+L276: .string "ubguqynqwbr"
+L277: .string "ekqyspqncshzcjcchy"
+L278: .string "ofiuhgo"
+L279: .data 481, 418, -572, -639, 278
+L280: .data 406, 59, 837, -914, 84, 511, -289
+L281: .string "kvlvmjhxlct"
+L282: .data -407
+L283: .data -687, -892, -80, -117
+L284: .data 276, 198, -608, 683, -775, -737, 156, -846
+
+L285: bne *r4
+L286: .string "dajhkzjjibugdg"
+dec L292
+L287: .string "ukwqvugvobmdtu"
+red r7
+L288: .string "uchkdulxeiyvy"
+jmp L322
+L289: .string "gvnjle"
+stop
+L290: .string "iqleffrjhsqehwqyldqg"
+L291: bne L229
+red *r1
+L292: .string "vqjuahwngbqvaoo"
+L293: .data 128
+L294: .data 547, -629, -766, 357, -693
+L295: .string "gjuzeylxnigjpjhurpamevw"
+L296: .data 305, -765, 411, 208, 690, 502, 903, -600
+L297: .data 154, 173, -340, 50, -226
+inc L337
+jsr *r3
+stop
+L298: .data 365, -817
+L299: bne *r3
+L300: .string "qdxkslfyaxvx"
+L301: .string "ehtolp"
+L302: .string "jfrjyxgfhlvreczuzlvelb"
+L303: .data 902
+L304: .data -163, 166, -597, -27
+L305: .string "cmhmgwmlojbhaltwayjpwccm"
+red *r7
+dec r4
+not *r6
+L306: .string "tzligiso"
+sub r6, L319
+L307: .string "ysusfbgm"
+stop
+L308: .string "ay"
+L309: clr r0
+L310: .data 874, -392, -755
+L311: .string "ibzskmizgczd"
+L312: .data -799, -522, 276, 855, 466, -807
+L313: sub r7, r2
+L314: .data -262, 830
+L315: .string "axtqpudwjvzx"
+L316: rts
+red L332
+L317: .string "jdrvibmgb"
+L318: .string "ntslzspdrck"
+; comment
+L319: .string "ru"
+not *r2
+L320: .string "qiy"
+L321: .data -983, -367, 144, 297
+L322: .string "dyhkrvbhkr"
+L323: .data 910, -111, -429, 594
+jsr *r4
+mov L330, L345
+L324: add *r5, *r5
+jsr *r4
+L325: .string "vgvr"
+L326: .string "qagxooggmtw"
+not r6
+sub *r5, r6
+L327: .data -287, 989
+L328: .data -230, 868, -943, -163
+L329: prn L16
+L330: .string "efuouizqkkdqevufuyrxtuc"
+L331: .data 125, 314
+sub #-35, L151
+add *r1, L180
+L332: .data -781, 548, -826, -330, 938, -820
+L333: sub *r4, *r7
+
+L334: .data 640
+L335: add *r3, r7
+rts
+stop
+L336: .data 926, 221, 716, -580, 919, -966, -959
+L337: .data -608, 192
+prn r7
+; comment
+L338: .string "abuuycwkzmgkterkcgcwciha"
+L339: .data 355
+prn #125
+L340: .data 241, 54, 28, -947
+L341: .data 17, 171, -473, -457, -119
+L342: bne *r7
+L343: .data -245, 873, -465
+L344: cmp r0, *r1
+cmp r4, #239
+L345: .string "fsiasduusgiawyrpht"
+prn L3
+stop
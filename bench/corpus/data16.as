@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 17
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .string "vvxbuloqppcld"
+L1: .data 971, 732, -976, -148
+L2: .data -524, 235, 843, 678, 33
+dec L21
+L3: .data 789
+dec L2
+L4: red L1
+L5: .string "fuatotpvsycans"
+L6: .data 206, 553, 35, -546, 604, -615, 871, -493
+not *r6
+L7: .data -174, 429, 897
+L8: stop
+L9: .string "zyuntiigqtzmwzesd"
+L10: .data -39, -394, 864, 420, -14, 506, 992, 996
+
+L11: .string "lfnunuzxunnpdcjhjfmolf"
+bne L249
+L12: .string "nvb"
+jsr L83
+L13: .data 672
+L14: .string "hhzmskdkybndubcw"
+L15: .string "wygnhoa"
+rts
+bne L27
+
+L16: .string "jxbqywpxnfygaqlqf"
+L17: .string "wahqqxqmjlfbrvrrjrco"
+L18: .string "hbiql"
+L19: .string "jqracphcewbewtmchridaq"
+jsr *r7
+L20: .string "rikcgccesd"
+L21: .string "dwasfiulibthnpzddlghoph"
+L22: .data 972, 71, -866, 261, 273, 103, -53, -155
+L23: sub #74, r0
+L24: .data -702, 421, -82
+mov #10, L209
+L25: .string "bivfgbrrnlvsxsjh"
+L26: cmp L105, r6
+stop
+L27: red *r3
+L28: .data -769
+L29: .data -674, -544, 263
+jsr *r2
+L30: bne L7
+L31: .data -725, -326, 856, 355, 601, 582, -795, 523
+stop
+L32: .data 68, -852, -634, 806, 290, 473, 533
+L33: .data -720, -788, -214, -52, -348, 175, 431, 206
+L34: .data -228, 253, 748, 485, 450, 876, -169
+L35: .string "lz"
+L36: .data -645, -417, -74, 855
+L37: .string "mrpbbqwccdtptvfwb"
+L38: .data 909
+L39: .string "pkavhtjhwxqzc"
+
+L40: .data -172, -75, -764, 185, -214, 303, 604
+L41: .data 265, -4, 482, 32, -175
+red r0
+L42: .string "hitewwmkzmtpko"
+L43: .data 417, -546, -411, -990, -522, -798, -763, 104
+L44: .string "w"
+cmp *r7, #209
+mov L15, L300
+bne *r7
+L45: .string "bvesqmsggh"
+cmp #-77, *r0
+L46: .string "jattphaobpsftdzdimazbc"
+L47: .data 310, 92, 417, 667, -104, 833, 12
+stop
+L48: .data 901, -830, -959, 952, 963, -369
+L49: sub r0, *r2
+L50: .data -853, -362, 537, 913, 213
+L51: .string "gdfdn"
+L52: .data 590, -442, 865, 350, -155, 32, -93
+L53: prn *r3
+jsr L148
+L54: .data 802, 598
+L55: .string "sxtbyxkeu"
+L56: .data -372, 111
+dec r3
+L57: .data 726, -852, -749, -709, 100
+prn L321
+red L214
+inc r0
+dec *r1
+add r2, r1
+L58: .string "kyhxsyuoxmzpsnaa"
+L59: .string "lmlufwrirzabk"
+L60: .string "farrrcuzzjafgypecno"
+L61: .string "sudlmxpdeqyrymhmmcxvicf"
+L62: .string "ttr"
+jsr *r4
+L63: .string "irwnazemspdeffjwl"
+mov #158, L309
+not r1
+L64: mov #-178, L16
+jmp *r7
+L65: .data 284, -277, -287, -255
+L66: bne L31
+L67: mov r7, L16
+inc r7
+cmp L250, L37
+; comment
+cmp L31, r3
+L68: .data 573, 947, 54, 849, -153
+jsr L25
+
+red L46
+L69: .data -927, -658, 227, -89, -638, 197, 684
+L70: .data -280, -503, 660, -128, -138, 552
+add L64, *r0
+L71: bne *r3
+L72: .string "qhlx"
+L73: .data 914, -421, 898, 122, 638, 202, 730
+L74: .data -830, 957
+dec r4
+L75: .data 941, 29, -322, 418, 953, -697, 895
+L76: .data -736, 265
+L77: .data 949, -420, 316, 459, -145, 818, 257
+L78: .data 956, 364, -33, 843, 596
+L79: .string "rdeocgemuammtt"
+L80: red *r7
+not r3
+; comment
+not L12
+L81: .string "pvxvpwdkkibhekrp"
+not L62
+L82: .data 738, -259, -751, -452, -67, 944, -55
+L83: .data 294, 780, 309, 293, 593, -150, -87
+L84: .data 203, -928, 464, 748, -393, 103, -867, -688
+L85: .data 890, 567, -822, -818, -322
+lea L62, *r5
+inc r7
+L86: .string "tuofcveeaknzliyu"
+not *r6
+L87: jmp L16
+L88: .string "stdtitnqookganhfskfnhct"
+L89: .string "hbczraqaiqngkamkstvvgngd"
+L90: .data -703, 848
+dec *r0
+mov L275, *r1
+L91: .data 959, 374, 717, 531, 434
+L92: .data 574, -479
+not r2
+sub *r6, L84
+cmp L222, r2
+not L239
+L93: .data 122, 886, 66, -348, -939
+L94: .data -745, 7, -336, -761, 126, 30, 324
+L95: .string "eqkqrdwzln"
+L96: .data 239, 855, -505, 234
+L97: .data -430, -636
+L98: .string "bisnzmohyjjpvkcglypha"
+red r2
+L99: .data -104, -544, 727, -869, 470, 21, -667
+
+lea L8, r4
+mov #160, *r0
+L100: prn r7
+L101: .string "yrirk"
+L102: .data -473, -275, 903, -186, 811, 235, -33, -333
+
+L103: .data 936, 401, 385, -129, 844
+L104: .string "zqcupvmlqqpcqezburqjyodt"
+jmp L224
+bne *r6
+L105: .data 989, 158, 938, -744
+L106: .string "yyhacjg"
+L107: .string "vkqumovvswiugmpcjafeyi"
+sub *r2, L52
+L108: .data 243, 280, -506
+L109: .string "aoqroxpbwot"
+L110: .string "jjipvhtiptqjuekgnjlmnl"
+L111: .data 595, -166, 776, 512
+L112: .data -196, 551
+L113: .data 746
+L114: .string "uhefxuqvzibeynkcnsr"
+cmp *r5, *r0
+
+L115: .data -284, 309, 207, -417, -731
+L116: sub L320, L105
+L117: .data -28, 191, -999, 61, -397, -572, -406, -406
+jsr *r7
+L118: .data 429, -280, 428, -719, -42, 194, 104, 965
+jmp *r4
+L119: .string "mxpwjnxmivibzbmhzpq"
+inc *r3
+L120: .data 767, 828, 724, -378, -784, -662
+L121: .string "nemncyleqebkh"
+L122: .data -821
+not r2
+L123: .string "eflvtjuqrozbss"
+L124: .string "iofqv"
+L125: .string "fccjykogyo"
+rts
+L126: .data -714, 545, -432
+sub L136, L309
+L127: .string "jop"
+L128: .data 313, 297, -971, -303, -768, 721, -366, 989
+L129: .string "puxaoypwjhmtjqyhr"
+L130: .string "jlruohzynbnjtsbekmp"
+; comment
+dec r5
+L131: .data -73, 192, -23
+L132: .data -533
+L133: .string "sbbxuhzulealfbrecb"
+
+red *r6
+L134: sub *r0, L116
+L135: .data -719, 75, 684
+L136: jsr *r0
+L137: clr L90
+L138: .string "qtsblapcmuxojjmcvs"
+L139: .string "kxqseiu"
+; comment
+dec L242
+L140: .string "gulgtrhrkfhedqwb"
+dec L312
+L141: .string "bvkhrysrgukgdu"
+mov r0, *r6
+L142: not *r7
+clr *r6
+dec *r1
+L143: .data 294, 182, 602, 423
+rts
+L144: .data -424
+inc L288
+L145: .data 681, -368, 534, 400, -800, 355, 228, -952
+L146: .data 48, 845, -527, 152, 801
+L147: .data -65, 595, -149, -133, -453
+inc *r7
+dec r6
+inc L209
+L148: .data 505, 640, 906, 272, -618, -800, -432
+L149: .data -20, 883, 541, -245, -487, -189, 414, 418
+stop
+L150: .string "ksgqaax"
+L151: .data 874, -454
+L152: .data 108, -711, -785
+L153: inc *r3
+L154: dec r0
+; comment
+clr *r7
+L155: red L126
+L156: .data 503, -568, -611, 742
+
+L157: .string "hehelpvwou"
+L158: .data 789, 113, 500, 417, 536, 27, -581
+L159: .string "xkzziayytkroiowznwfvn"
+L160: .data 373, -182
+L161: .string "plnwznzjnyga"
+add #-185, *r1
+L162: .data 753
+L163: not L229
+L164: .data -693
+L165: jmp L104
+sub #245, L111
+L166: .string "igi"
+L167: .data 11, 171, -287, 145
+sub #116, *r0
+L168: .data -774, -688, -733, -772, -603
+jmp *r1
+L169: .data -544, -621, -27
+L170: .string "ex"
+L171: .data 367, 965, 178, -605, 125, 135
+L172: not r6
+add r5, r0
+add #-181, r5
+lea L62, L30
+; comment
+L173: .string "ayxzuhjiijjgk"
+lea L167, *r0
+L174: .string "stxzkgof"
+L175: .data 72
+L176: .string "ydodiam"
+add #183, *r4
+L177: prn *r2
+prn r2
+L178: .data -602, -309, 844, 751, 414, 966, 57, 875
+L179: .data -897, -677
+add r2, *r2
+L180: .string "bdihliwezinig"
+lea L135, r3
+cmp #244, r4
+L181: .string "gzpf"
+L182: .string "weqisoxqkf"
+L183: .string "qh"
+L184: prn *r1
+L185: .data 188, 469
+L186: .string "vffxzieealodm"
+L187: .string "daxgdkiugnzopqzacrz"
+L188: .data -596, 422, -306, -21, 882
+L189: .data 891, -986
+; comment
+L190: .data -14, 880, 115, 946, -781, 740, -830, 791
+L191: .string "hqabxzicfueyjrzvblnv"
+L192: add *r4, L286
+not r6
+dec r1
+dec *r1
+mov L262, L49
+red L63
+L193: .data -951, 436, 524, 100, 323, 330, 209
+prn r1
+cmp #14, #11
+not r4
+prn #25
+bne L245
+L194: stop
+L195: .string "jofvzkjtyrcafwcd"
+L196: .string "eeqxejgqnarieyjku"
+L197: .string "qopbnctewgtvjq"
+L198: .data -314, -612, 587, 755
+L199: .string "yjtl"
+L200: .data -262, 308, -974, -808, -124, -416, -470, 721
+dec L295
+jsr *r1
+L201: red *r2
+L202: .data 84, -621, 277
+L203: .string "xe"
+bne *r5
+L204: sub #210, r6
+L205: .data -614, -911, 45, -109
+L206: .string "i"
+L207: .string "u"
+L208: .data -869, 538, 662, -773
+L209: .string "kzwqwmfnwjmajy"
+L210: .string "jyeop"
+L211: red r4
+L212: .data -298, 281, -902, 679, 890, -824
+red *r4
+L213: .string "pvptkzojzgqkfoluknb"
+L214: .string "oygkhbyqb"
+prn r0
+L215: .data -148, 516
+L216: prn L125
+jsr *r1
+; comment
+L217: .data -931, 230
+clr *r7
+lea L254, L252
+L218: .string "gvryisdw"
+L219: .data -445, -707, -682
+L220: .data -230, -420, 203, 418, -78, 110
+L221: .data 517, 702, -48, -849, 196, -81, -34
+red *r4
+L222: .data -533, -859, -380, 786, -999, -429, -232, -720
+L223: .string "jxayzawlaxbzrq"
+
+cmp #162, #111
+bne L82
+bne L322
+L224: mov *r1, r3
+L225: .data -81, 826
+stop
+L226: .string "xukndozhwxdyrjqshp"
+L227: .data -618, -554, -580, -345, -208, 747
+rts
+L228: clr L295
+L229: .string "ssxcxpxezwmk"
+L230: .string "wlzanfbmbkamwicthjh"
+mov *r4, *r2
+L231: .data 299, 242, 237, -351, 652
+L232: .data -742
+not *r2
+lea L312, r2
+L233: .data 688, -343, 490, -52, 732
+; comment
+L234: .data -848
+L235: .string "kjjqrzkegq"
+L236: .data 323, 737, -364, -748, 703, 168, 777, -777
+L237: .string "gofoykecejb"
+add L312, L308
+L238: .data -199
+L239: .data 519, 168, 249, -926, -525
+L240: .string "rb"
+L241: .string "rnzvutfsb"
+L242: .string "mi"
+L243: prn #187
+L244: .data 717, -717, -978, 190, -152
+L245: .data 498, -930, 835, -418
+L246: lea L258, r7
+L247: .data 186, 631, -423, 669, 797, -140
+
+L248: .data 364, -975, -34, -768, 141, 30
+L249: .data -143, 981, 167
+cmp L193, L271
+add r7, L315
+add #-166, *r5
+clr L203
+L250: .string "jnpywmvytdceqcmr"
+L251: .string "kkelhbqmvsyhamfoh"
+; comment
+L252: sub r3, *r1
+clr *r1
+; comment
+L253: red r6
+L254: .string "vwklgboyqmcp"
+L255: cmp r6, #38
+L256: jmp L290
+L257: sub *r3, L29
+L258: .data 866, 282, -684
+L259: red L292
+L260: .data 149, 419
+; comment
+; comment
+L261: .data 644, -513, 892, 572, 482
+sub L276, *r4
+sub *r5, *r2
+L262: .data 415, -402, -474, -605, 404, -865, -968, 953
+L263: .data 304, -500, 512
+; comment
+cmp r3, #227
+add L192, *r1
+inc L272
+L264: .string "jbpkzybggdxql"
+add #-35, *r6
+prn *r7
+L265: .data 32, -333, -142, 211, 879, 47
+L266: .data 163, 634, 568, -406, 128, -457, 552
+add *r4, r5
+L267: lea L261, r5
+L268: red r6
+L269: .string "nytczgzpdljwvtnardiwv"
+L270: .string "etvbqzbwktwllt"
+not r7
+L271: .string "uddbbtev"
+L272: .data 860, -998, 446, 324, -753, -813, -877
+L273: .string "aclwst"
+jmp L124
+L274: .string "vy"
+L275: bne *r2
+L276: .data 333, -854, -815, 133, 408, -407, 63
+L277: .string "cqihtyhldwdftrzl"
+L278: .data -32, 247, -114
+L279: .data -261, 548
+L280: .data 115, 355, 724
+jmp L224
+L281: .data 402, 138, -681, -520
+red *r3
+L282: .data 669, -791, 939, -497, 623
+stop
+jsr *r2
+L283: .data 165, 387, -936, 816, 863, -934, -21, -80
+L284: .string "yjpfihqv"
+cmp L319, r7
+L285: .string "qdlsbgjnw"
+L286: .string "fu"
+L287: .string "u"
+L288: .data 224, 438, 879, 233, -838, -924, -301, 258
+L289: inc r3
+sub #-236, *r0
+not L128
+L290: .string "czvhujnqxoeihjmi"
+L291: .data -207, 518
+L292: .data 464, -492, 558, 873, -406
+L293: .data -178, -164, 1, 621, -647
+L294: .data -535, -6, -410
+L295: .string "a"
+L296: .string "cbfpp"
+L297: .string "nyqcno"
+L298: .data -499, 182, 192
+L299: .string "bxredzf"
+L300: .string "ebdiefbbiymjyepzyddpti"
+L301: .string "uupudzurlvhdmybizg"
+rts
+L302: .data 559, -358, 546, -79, 932
+L303: .data 193, 223, -2
+clr L310
+red *r5
+L304: .string "drukj"
+L305: .data 560, 273, -687, -25, 659, -106, -665, -65
+clr r7
+L306: .string "ggj"
+dec *r3
+rts
+L307: .string "hwj"
+stop
+jmp L310
+L308: .data 811, -938
+dec r4
+stop
+L309: .string "eywtapqluxicsqrarr"
+L310: .data -423
+mov #192, L98
+sub #76, L211
+L311: .string "nghelxhvvkdmirhororjas"
+L312: .string "rjiodtaunxjrkwwe"
+L313: .string "pociykhsrv"
+prn r1
+L314: .string "fluwwvrdx"
+dec r1
+L315: .data 571
+L316: .data -962, -989, 505, -104
+L317: .string "kamoirdmch"
+L318: .string "pnnkahrqoingrwbruqgqdc"
+L319: .data -122, -552, -881, 641, -869
+L320: .data -118, 525, -147, -111, -97, 796, -349
+L321: .string "wvqjeywatzhkrfb"
+L322: .string "czcywzdakqnj"
+stop
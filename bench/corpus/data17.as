@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 18
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+rts
+L0: .string "krosybtutzzblqvkugvvpzje"
+L1: .data -366, -862, -348
+cmp #-101, r5
+dec r7
+L2: .data 292, 750, 101, 690, 455, -941, 305
+L3: .data -518, 469
+L4: .data 173, -841, 965, -229, -649, 468, 388, -762
+L5: .string "uhjafwti"
+L6: .string "etmcngu"
+clr L0
+L7: .string "vqnlzeucmfbmaomhqsr"
+L8: .data -707, -245, -941, -9, 124, -253, -492
+stop
+L9: lea L9, *r6
+L10: .data 470, -443
+L11: .string "vsyqjknlbel"
+inc r0
+rts
+L12: .data -406, -308, -337, 207
+L13: .data -685, -428, 570, -664, 236, 247, 820
+stop
+L14: .string "qjnb"
+mov *r6, *r7
+L15: .data 7, 47, -346, 464, 251, 755, 97, 99
+sub r4, L304
+L16: .data -529, 768, 268, -937, 257, -944, -313
+L17: .data -133, -851, -33, 477
+L18: .string "hwekipbicqtrgjsxyp"
+L19: .data 485, -445, 633
+L20: .string "hxyxhwnkpqgbasdlacgllc"
+bne *r5
+bne L91
+; comment
+prn L41
+clr L87
+mov #242, L112
+L21: .data -447, 697, 504, -457, 672, -616, -1000
+L22: .string "u"
+L23: .string "dbv"
+L24: .string "pgeucvnkglgthidzzbzxk"
+L25: jmp *r7
+; comment
+inc *r6
+L26: .string "aevyxbmtsbvw"
+L27: .string "bzb"
+; comment
+L28: .data 949
+L29: .string "dwfegawavnu"
+L30: .string "jpkizbwcgplcrh"
+L31: .string "sfhtwsqhqkleqeaeaf"
+L32: .string "aeyojxokscqutzlytf"
+L33: .data 914, -992, -830, -645, -527, -504
+L34: cmp L294, L2
+L35: prn #186
+L36: .string "zafzwbpfezuxfdzaemzvmqf"
+L37: .string "nyqtculuwnoez"
+L38: lea L38, *r6
+L39: .data 617
+L40: .data 72, -839
+inc L8
+L41: mov *r3, *r6
+L42: .string "qzexiarg"
+red *r4
+L43: jsr *r3
+L44: .string "iwvphcwbockvmbpthfdu"
+L45: .data 668, -910
+L46: .data -233, 26, 194, -580, -262, 176, -385, 795
+L47: .data -656, 205, 621, -835, -34, -484, 91, -157
+cmp #-137, L33
+L48: .string "ohqsf"
+L49: .data -49, -859
+inc r1
+lea L7, r4
+L50: .data -753, -708, 757, 991, -131, 618
+L51: .data -958, -34, 877, -21, 443, -348, 14
+L52: .data -767, -219, -30, -983, 75, -838, -309
+L53: .string "d"
+inc L172
+not *r3
+add *r6, L39
+stop
+
+L54: .string "zqgvdeclj"
+L55: .data 947, 632, -110, 398
+L56: mov L44, r3
+L57: .string "sotoqvoqfefgh"
+L58: .data -776, 920, 418
+L59: .data -672, 190, -588
+L60: .string "lpqctuhjuxtkwmyhysluj"
+not *r0
+lea L59, *r3
+L61: red *r2
+L62: .string "lavu"
+L63: .string "pznfdid"
+L64: .data 136, -929, 125
+L65: stop
+L66: .string "cattbgmpziq"
+sub *r5, r6
+jmp *r2
+add #-170, L3
+L67: .string "kqplarvenoj"
+L68: .string "jugmoncvbbgswdqzpmdchy"
+L69: .string "ppnf"
+
+L70: .string "jhlgf"
+L71: .string "vtvfdti"
+L72: .string "ewnjafyft"
+L73: .string "biyhvawgkphkttjicdqxmofs"
+L74: .data 219, 962, -431, -241
+L75: .data 13, 833, -987, -536, -647, 98, -438, 328
+; comment
+L76: .string "azhhrdyefoj"
+L77: .data -527, -9, -653, 21, -238
+L78: .data 268, 183, -696, -390, -330, -185, 720, 91
+dec *r4
+L79: .string "bcbnvqpruhdxysdfjwnrxphb"
+L80: .data -535, 644, -11, 183, 109
+add L80, r6
+L81: .string "todpjlstnooevuim"
+L82: .string "rfilynya"
+inc *r1
+L83: .data -868
+L84: .string "akpuiipygghpnrdxjeejxmk"
+mov L91, L207
+L85: .data -343, -89, -741, -833
+L86: .string "bysxotcdmc"
+add *r0, L170
+L87: .string "yqhlvpvvkpffopriebzc"
+clr r3
+L88: .string "pdxjtevkzbvvms"
+L89: .string "b"
+L90: .data -128, 675, 694
+L91: .data -402, -352, -441, 52, 581, 862, 243, -283
+jsr L239
+L92: .data 432, 695, -109, -731, 247, -570, -782
+L93: .string "dscqrnjpxfnqisnagvhv"
+L94: .data 383, -284
+L95: .data -329, 505, -96
+L96: .string "ohdmqcqldsqdcepmbqw"
+L97: add *r4, r5
+clr *r1
+L98: .data 491, -554, 397, 497, -770, -464, 561, -390
+L99: .string "fypchsoreeutewrta"
+add L142, L78
+lea L33, r6
+red L325
+L100: .string "umvnbleerlfnq"
+L101: .data 4
+jsr L208
+L102: .string "eabcjqbicsvixznelj"
+stop
+L103: .string "akxssesvszlxmpeqv"
+L104: jmp *r2
+L105: .string "xxpmhlvpumvrkuazq"
+not r2
+L106: .string "gmtyoposg"
+L107: .string "jowazwtpktbjkvbetmy"
+inc L61
+lea L123, *r5
+mov L196, r7
+L108: .data -921, 143, 93, 360, -687, -594, 936, 690
+dec r5
+dec r1
+L109: .string "tsdwjphztcnueietotqli"
+L110: .string "idegnyudserjntvtszy"
+L111: .string "cbdceylzhgseidg"
+L112: .data -58, 371
+L113: .data -143, -620, -921, 878, 709, 445
+L114: .data -339
+rts
+dec L46
+L115: .data 443, 33, -97, 132, -755
+L116: .data -483, -796, 748, 565, 583, -724
+; comment
+L117: .string "elbpskribkeyaiqoo"
+bne *r0
+L118: .string "qylchizwqbb"
+L119: .string "uufunzsnvp"
+L120: .string "webacknhsfcaqdn"
+L121: .string "jrqrzydwhvnwowcpfkmd"
+L122: jsr *r1
+L123: .data -511, -885
+add #13, *r1
+jsr L181
+L124: .data -995, -224, 553
+L125: .data 498, 897, 674, 806
+L126: .string "fuhossbrbphjdrrrbj"
+L127: .data -879, 279, 220, -640, -866, -114, 254
+; comment
+rts
+L128: .string "ifnnektbebgrbubv"
+prn L202
+L129: .data 139, -532
+L130: .string "cpjqmohidketgbh"
+cmp L238, *r7
+dec L132
+dec L36
+red r5
+L131: .string "nxw"
+
+dec r1
+L132: .string "oopgilhwllbcxplsgcqlibho"
+L133: .data 554, 747, 135, -136, 744, -254
+L134: .string "b"
+L135: .string "yupewgtahribwaeltpgyobfs"
+bne L150
+L136: .string "i"
+L137: .data -794, 819, -794, 734, 260, 761
+L138: .string "zwseehmda"
+bne *r5
+L139: .data -897, 976, 678, -233, -581, -390, 457, 50
+L140: .data -215, 927, 903, -212, -284, -948
+cmp #97, *r4
+L141: .string "ecrrjuxhlmdiqypbm"
+; comment
+prn r4
+add #-217, L80
+; comment
+L142: bne L80
+L143: .data -120, -823, 53, 748, -779
+L144: .data -500, 671, -331, -544, -745, 904, -458
+L145: .string "quns"
+stop
+L146: not L272
+L147: .string "pdfxjzsvvj"
+L148: .data -787, -604
+L149: .string "ppoh"
+bne L151
+L150: .string "pm"
+L151: .data 724, 128
+L152: .string "wernyjalxhlqoplprn"
+L153: .string "thercpffimjxnldbskl"
+L154: .data 165, 426, 811, -960
+red *r5
+cmp #207, *r2
+add L47, *r6
+L155: .data 6, -514
+L156: .data 360, -667, 303, -835
+L157: .string "hmxdpzyxenjavovohge"
+L158: .data 427
+L159: .data 5, 518, -399, 417, 192, -221, 776
+L160: .string "cblmuvgsz"
+L161: .string "ipddqncakrtszp"
+cmp r2, r5
+L162: .string "nhqtexbnhtogswqsvar"
+L163: .data -368, -217
+red r7
+jsr *r7
+clr *r6
+L164: .string "uduqpckilhnxyspccjpg"
+L165: .data 605, 405, -857
+L166: .string "aswtviotguczru"
+L167: .data 861, -336, -286
+L168: add r4, *r6
+cmp *r7, *r3
+L169: .string "lrnpiku"
+L170: rts
+sub L168, r6
+L171: .string "duoobkfujawf"
+clr r6
+add r3, r2
+L172: .data -647, 29, -510, 74
+; comment
+L173: cmp r5, #-15
+dec r7
+jsr *r0
+mov r4, L100
+L174: jsr *r3
+dec *r5
+red *r6
+; comment
+L175: .data 100, 217
+L176: .string "xtorginghdnyaqqr"
+L177: .data 842, 158, -809, 735
+L178: .data 32, -740, 538, 849, 27, -911
+L179: .string "pae"
+L180: .string "zgoxk"
+prn L18
+L181: .data 673, -321
+prn L258
+stop
+L182: .data -316, 779
+L183: red L52
+lea L129, r1
+L184: .string "rzmofkmfbboxaiqydhzh"
+mov *r7, *r5
+stop
+L185: .data 106, 705, 387, 290, 103, -138, -833, 820
+L186: .data 885, -705
+L187: .string "zjwquifymvawwruvjedct"
+L188: .string "avldqurqixrkgu"
+L189: .string "xsukhuuaqtoxvqvudjlf"
+L190: .string "zcitmvkohwrnykgnadlc"
+red r1
+L191: .string "wkjawrgsckrt"
+L192: .string "suxycy"
+L193: .string "mzp"
+L194: .string "jpchdffrcr"
+L195: cmp r1, L174
+L196: mov r0, L327
+L197: .string "v"
+L198: .data 100, 308, -238, -719, -875
+L199: .data -559
+L200: .string "dcwkjkcageteqsauxvjzt"
+lea L24, *r6
+rts
+L201: .string "kvtnrotdwwzthbyobcclr"
+L202: .data -354, 454, 181, 730
+L203: .string "bfkgwdrdvrhcjhmqsvygtz"
+L204: .data 610, 645, 13, 223, 381, -91, 448
+
+L205: mov r2, r4
+L206: add L178, r5
+L207: .data 12, -109, -606, -335, 688, -983, 454
+L208: .string "hxdfpqiqlowkucqalywyn"
+L209: .data -676, 62, 718, 68, -567, -497, -206, 376
+L210: .data -317, 990, 758, 987
+L211: .string "pyuc"
+L212: .data 176, -37
+L213: .data 130, 592, 217, -863, -317, -99, 441, -114
+prn L262
+L214: .string "hsdqjt"
+dec r0
+clr L316
+L215: .data -643, -573, 35
+L216: sub L46, r1
+rts
+L217: rts
+L218: .string "enrrttjiuclqaxpgkirgl"
+L219: .string "mmcdibuyrjxvqhk"
+L220: .string "xzbxoellkjchjxf"
+L221: .string "abg"
+red *r0
+L222: .data 979, -413, 42, -104, -127, 329, -462
+jmp *r5
+L223: .data -921, -598, -84, -204
+L224: .string "rjfhozkchwiqoihvvvam"
+jmp *r6
+L225: .data -583
+lea L307, L258
+L226: inc *r6
+
+L227: .data -779
+L228: .string "tgfbtfjyoaxwzbhkeu"
+sub L291, *r1
+L229: .string "hpncqcxjllnqkpnglfghv"
+L230: .string "egtdqajmrvquh"
+
+L231: .string "roxarsgufrgak"
+cmp L304, r4
+; comment
+jsr L232
+lea L30, r2
+L232: .string "qudhldarnir"
+L233: .string "icitgynufbi"
+L234: .data 518, 259, 615, 966
+bne L214
+prn L289
+jsr *r1
+L235: .data 632, 226, 898, 834, 436
+L236: .string "mqmqaqqdsbtibjzldnh"
+L237: .data -220, 148, -955, 439
+clr *r1
+L238: .string "whpvdhjhwjc"
+L239: .string "iprilunznbuuwr"
+jmp *r6
+not *r4
+L240: .string "xs"
+L241: .string "ycrgyqfbhshj"
+L242: add r5, *r1
+L243: .string "uonuapkyg"
+L244: .data 15, -979, 862, -633, 377, 242, 728, -59
+prn L281
+L245: .string "b"
+L246: red L125
+jmp L286
+L247: .string "gmzhbszpo"
+L248: .data -729, 849, 215, 856, -768, 921, -497, -767
+L249: .data 645, 175, 991, 218, 544, -552
+L250: .string "eeizqhfydjecscteuqorld"
+L251: .string "dobmknfa"
+lea L23, *r4
+L252: .string "u"
+L253: add *r2, r5
+L254: .string "oepse"
+rts
+L255: .data -811, -40, -292, -941, 798, -832, -222
+L256: red L110
+stop
+not L72
+L257: .string "xlgyipbuiupzdxaems"
+L258: .string "rbs"
+dec L315
+not L27
+; comment
+rts
+prn L171
+L259: .string "umobwqqhiqc"
+L260: .data -152, 172, -657, 700, 517, -945
+L261: .data -552, -977, 35, -184, 571, -106, -497, -568
+jsr L319
+L262: .string "xsbwcidyakljptkl"
+prn #-213
+L263: dec L193
+L264: .string "gwemxfvdzxubug"
+lea L316, r0
+L265: .data 269, -700, 303, -491, -608
+inc *r2
+L266: .data 912
+cmp L120, *r6
+bne L257
+L267: .string "beptlh"
+jsr L323
+L268: add r1, *r5
+L269: sub *r4, *r6
+L270: .string "kyefoarnrfrwutwfsx"
+L271: prn L283
+L272: jsr L247
+L273: .data 775, 918, 696, 174, -474
+L274: .data -148, -527, 395, -523, 434, -655, -471, -992
+L275: .data 981, 245, -346, -376, -116, -6, -525, 863
+L276: .data -845, 665, -853, 94, 29
+jmp *r2
+L277: .data 68, -693
+L278: .string "xpdbwgzqkyp"
+dec *r5
+lea L28, L211
+L279: .data 637, 962, -673
+sub L120, r1
+L280: not r6
+L281: bne L319
+jsr L298
+L282: .data 477, -730, -88, 412, -3
+mov #-38, *r5
+L283: .data -922, -251, 47
+L284: .string "oxkxxottnwuwtc"
+L285: .data -713, 614
+
+L286: .data 264, -319
+L287: .data -755, -397, 56, 982, -901, -201, -732
+sub L206, L18
+L288: .string "yvsuomc"
+L289: .data -427, -599, -785, 315, 349, 283, -104, -922
+L290: .string "pbryw"
+L291: dec L196
+L292: .data -86, -103, 681, 873, 675, 802, 37, 619
+mov r4, r7
+add *r6, r0
+prn r7
+L293: .string "eniloyixslzclbna"
+L294: .data 0, -580, 436, 556, -255
+
+L295: .data 627, -392
+prn *r4
+stop
+bne L95
+red *r0
+mov *r3, r1
+L296: .data -174, 624, 615, -684, -192, -724, 409
+L297: .string "e"
+L298: .string "fswuvm"
+L299: .string "jzfvtcknjy"
+L300: .data 359, 39, -766, -601, -186
+L301: .data 519, -242, -565, 741, 992, 372
+L302: .data -17, 18, 384
+bne *r7
+jsr *r1
+L303: .string "efh"
+L304: .string "ihcdgpggdt"
+sub #113, r5
+L305: rts
+L306: .string "mgqqlvdayxapkeicqqxdali"
+L307: .data -123, 535, 573, 325
+red *r1
+L308: .data -494, -547, -423, 727, 795, 96, -512, 276
+L309: .string "mwznuovnngkbrtwuarqyxk"
+L310: .string "tqmoyjflbasetirrwg"
+L311: .data 985, 834
+L312: .data -649, 208, 71, -759, 470, -780
+L313: bne L321
+jmp *r4
+L314: .data -89, 930, 359, 525, -174
+prn L328
+L315: .string "hykvsnq"
+bne *r0
+
+L316: .string "eeghxfuwsbeoueuimbdhtfy"
+L317: bne *r4
+L318: .string "srxfowspvg"
+L319: .data 503, 800, -630, -75
+L320: .data 820, -60, -324, 344, -868
+L321: .string "lpjyslmdphxsewdanahghq"
+L322: .data -760, -970, 732, 891
+L323: .data 619, 277, 841, 75
+L324: .data 594, -951
+L325: red *r7
+L326: .string "qbtjjpawegqkxk"
+L327: .string "zzdagdbteky"
+L328: .string "hqiat"
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 19
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+prn *r2
+L0: .data -148
+L1: red L260
+lea L243, *r6
+L2: .string "zquwhuff"
+L3: .string "icbtfvuzinpncubpfzuna"
+L4: .data 193, 237, 625
+L5: .string "bfxtmqhkjlhgavfxgtw"
+; comment
+L6: .string "wdpkzl"
+L7: .data 942
+mov L219, *r4
+L8: .string "wlnhhiangqsougalo"
+L9: .string "pynfecvggbllskxwmylz"
+L10: .string "bvwxrftxmfhtm"
+L11: .data 418, -604, -121, 446, -719
+L12: .data -363, 541, 648, 723, 190
+prn r1
+L13: .string "iqoaghygwrkbsic"
+L14: .data 221, 653, -620, 244, 864
+stop
+L15: .string "yevuwxjvigckpjxykqpzvj"
+jmp L125
+L16: .data 946, 235, 354, 699, 384, 76, 41, 633
+L17: .string "ftguznlwegaiiqoikidb"
+L18: not L14
+lea L10, *r3
+L19: .data -985
+L20: .string "fniiylnjwiwdlqsekcpyah"
+L21: bne *r7
+mov #195, *r3
+cmp L215, L14
+L22: .string "ajklojchaacuaymnbsumg"
+L23: jsr L5
+L24: inc r6
+
+inc *r6
+mov r4, *r1
+L25: .data 133
+L26: .string "ttgyx"
+L27: .data 331, -174, 301, 818
+L28: .data -500, -444
+L29: .string "backxnelvtjn"
+dec r0
+L30: .data -828, -916, -999, -696, -930, 577, 20
+L31: .string "gwdpcehyqgzzvwxtnbkwrzim"
+mov r7, L28
+L32: rts
+L33: .data -529, -338, -529
+L34: .data -14, 217
+L35: .data -195, 558, -238, 407, -27, -595
+sub *r6, L320
+L36: .string "rvxlakfpmfofypqqioh"
+sub r2, *r5
+L37: .data -899, -923, 400, -490, -605
+L38: .data -68, -706, 626, -375, -902
+red r0
+L39: .string "wyfgoxursquefn"
+stop
+L40: .data -3, 355, -496, 835, 418, -800
+not r3
+L41: .string "vtoyyyitkukalsuexhjn"
+cmp r0, r3
+inc r3
+L42: .string "hyclorsrrfufwsxpoqmr"
+L43: .string "vlowsuelkr"
+L44: .string "ijaqhbro"
+L45: .string "wairwywrbcacdzerttxioy"
+dec L213
+mov L16, r4
+L46: .data 508
+inc L254
+L47: not L12
+L48: rts
+L49: add #240, r3
+L50: .data 67, 199
+add #122, r5
+L51: not L26
+L52: .string "sh"
+L53: .data -369, 429
+L54: .data -870
+L55: .string "hguwnahbhnqdjgcvyvvqgxbu"
+L56: .data -645, 680, 857, -14, -6
+
+red r1
+
+L57: .string "tjvhxdmpmxmqmtvquntkjh"
+L58: .string "ixmsawljvseqpksv"
+jsr L73
+L59: .string "xwnrcafeefpijs"
+clr L198
+L60: .string "flntt"
+add #213, *r0
+L61: .data -263, 439, 385, -615, -107, -729
+jsr *r1
+L62: .data 710, 830, -768, -338
+jsr L242
+L63: sub r6, *r0
+L64: .string "mdvrkzvcqavoqo"
+L65: .string "ihxsnbu"
+L66: .data -431, 587, 855, -338, -581, -239
+lea L277, r1
+L67: .data -805, 188, -78, -104, 842, -443, -333, 676
+L68: .data 532, -827, 533
+L69: .data 290, -15, -421
+L70: .data -897, -575, 322, 429, 864, 262, -279, -617
+stop
+add r5, L22
+L71: inc r2
+
+L72: .data 355, 596, 803, -52, -475, -706
+L73: .string "vpdpfnlphokmyuwzei"
+L74: .data -363, 766, -334
+cmp *r6, r3
+L75: .string "ylxzkyjswzihqyoixavhspc"
+L76: .data 595, -119, -385, -750, -56
+stop
+L77: .string "rposgtdvxqagfmbapeladuey"
+L78: .string "jafathrvrrn"
+L79: .string "woommfgsixqtuol"
+cmp *r7, L223
+L80: sub #-47, *r7
+L81: .data 730, 552, -31
+L82: .data 499, 886, 50
+; comment
+L83: cmp *r6, r7
+L84: .string "datihntvgmwtbk"
+L85: .string "cgvlzh"
+L86: prn *r2
+L87: .string "rlcrpnehqoeeu"
+
+L88: .data -578, 697
+red r1
+L89: .data 373, -571, -37, 463, -248, 308, 323, -50
+L90: prn #-178
+L91: .data -376, 943, -39
+; comment
+L92: .string "wtuukgrtcnojyszbfxezztm"
+L93: .string "jsiicqhozhbuccgsf"
+not L298
+L94: .string "ujisah"
+; comment
+dec *r4
+L95: prn r3
+L96: .string "nzclocjiwf"
+clr *r2
+L97: .data -187, -657, 645, 55, 89, -402, 86, 505
+lea L118, r6
+L98: .string "mqri"
+L99: .string "xyczhracybxkrfcvmm"
+bne L18
+L100: .string "tfmsdlbjjexhgmlc"
+; comment
+L101: .data -258, -881, 458, -909
+L102: .string "amknvi"
+L103: .data 804
+L104: .data 322, -297, 778
+L105: .string "hl"
+L106: bne *r1
+L107: .data 261, 296, 283
+L108: .string "nz"
+L109: .string "fgnpwtwntrcx"
+clr L18
+L110: .string "ppxipssoajgityjsdeo"
+L111: .string "fhiymdfpzrkagyrudl"
+L112: .string "osfwzzobkqw"
+L113: .string "waqbjgqivsdmpmplaztwdlgs"
+L114: .string "ahwafkyjubewzortjc"
+L115: .data -978, -118, 704, -185, 498, -2
+L116: .string "ruviw"
+L117: .data 379, -447, -100, 860, 398, -470
+rts
+prn r0
+jmp L126
+L118: .string "ddlbgglexrqkbnctmbbigfxl"
+; comment
+inc L109
+L119: .string "jvzcxxeiacsca"
+L120: .data 207, -925, 866, -884, -465
+L121: .string "kfxhubcozxdauwzupo"
+L122: .string "prdscelzlfecicvwlq"
+L123: .string "lmgarphoudjzbysburdnzvs"
+inc L66
+clr L296
+L124: .string "cckklteioqsswkklsqyhxaqq"
+L125: .string "cuurioxladrexneqfunrxkkk"
+add #153, L305
+L126: .string "xozxmfvkumcfmiamcoqhn"
+L127: .data 361, 924, 652, 120, 757, 670
+L128: .data -301, -449
+; comment
+L129: .data 754, 542, 981, 691, -693, -711, -620, -939
+L130: .data 690, -409, -137, -972, 233, -225
+L131: .string "kpn"
+L132: .data 960
+L133: jsr *r0
+L134: .data 774, 301, 375, 388, 982, 627
+L135: .string "dpbdgsaxylwbluzyzckb"
+L136: .data 609, -406, -723, 339
+L137: .string "ksyvelbvxolktokzms"
+L138: .data -988, -240, 234, 859, 852, 526, -963
+sub *r1, L24
+L139: .string "tirahbtql"
+L140: .data 931, -150
+L141: dec r5
+; comment
+L142: .data 984, 704
+inc L34
+L143: .data 286, -946, 334
+L144: jsr *r5
+; comment
+L145: .data -215, -178, -484, 187
+
+L146: .string "ojrbltquugeiczggkhrztsck"
+L147: .string "grvcerq"
+L148: .string "yqdgx"
+L149: .data -794, 744
+L150: .data 209, 642, 996, 217, -726, -701, -475, 20
+dec r2
+; comment
+L151: .data -319, 507
+L152: .data -663
+L153: red L140
+L154: .data 277, -505, -766
+jmp *r7
+L155: .string "snwzkgnenhm"
+L156: .string "qjulvcnvsmsxr"
+not *r6
+lea L311, L16
+inc *r1
+dec *r5
+L157: .data -963, 957, -598, 608, 626, 416, -608, 687
+L158: .data -682, -465, -443, -709
+L159: .data -581, -920, 794, 493, -815
+dec *r1
+bne *r3
+red L243
+dec *r6
+L160: .data -511, -703, 298, 195, 84, -680
+L161: .data 647, 241, 0, 819, 379, 784, -603
+L162: .data -484
+mov r3, r5
+L163: .string "blisad"
+L164: .data 37
+L165: .string "zqgjrwxiihpg"
+L166: .data -779, -946, -23, -81, -548
+L167: .string "vhyks"
+L168: .data 650, 125, 78, 196, -400, -116
+L169: .data -952, -870, -870
+rts
+jsr *r2
+prn *r0
+L170: dec *r4
+L171: .string "xvixlxnqqjrlnxuo"
+L172: .string "kuetdnovcrjfhykxv"
+L173: .string "feny"
+L174: .data -39, 864, -57, -263, -296, -34, 474, 441
+L175: .string "wzfwbxqbmujdadrwkpeuy"
+clr L321
+L176: .data -837, -669, 632, 749
+prn L76
+red L77
+not L5
+L177: .data 161, 78, 349, -137, -449, 845
+L178: .string "ynzlkcssiapnngygpjwrd"
+rts
+bne *r4
+L179: .string "teehw"
+L180: .data 615, 233
+L181: .string "iyb"
+L182: .string "pdmgksgtld"
+L183: stop
+L184: cmp r4, L243
+L185: .data -235, 260, -128, 847, -514
+L186: .string "krmxtfdtn"
+rts
+jmp L190
+prn #-204
+add r2, r6
+rts
+jmp *r1
+clr L167
+dec *r6
+mov *r2, r5
+L187: red *r5
+inc *r7
+
+L188: .data -591, -31, -119
+L189: lea L233, *r0
+L190: cmp #167, *r0
+L191: .string "skdomkjb"
+L192: rts
+L193: .data 94, -536, 296, -987, -23
+L194: .string "mcxpftnlizxhh"
+L195: .data -79, -535
+; comment
+L196: .string "exdbjtdaoqmwhnznjaaiaqa"
+L197: .data -811
+; comment
+L198: .data -319, 48, -348, 703, 103, 789, -395, -660
+L199: .string "gnigmijuwn"
+jmp L69
+clr *r7
+inc *r0
+cmp r3, L220
+not r6
+L200: .string "wkmszpuvxslg"
+L201: .data 360, -346, -869, -30
+L202: .string "wrqsuwjgbuhkihxgzakqz"
+L203: .string "tjv"
+L204: .string "bt"
+L205: .data -213, -926, 554, 861, -753, 844, -865, -563
+L206: lea L110, L317
+; comment
+L207: .string "jh"
+jsr L240
+dec L196
+L208: .data -626, 551, -833, 67, -637, 799
+not *r6
+dec *r2
+L209: .string "joobebqzdbkzlhdiv"
+L210: .string "tuydbusaj"
+L211: .string "nbfifcouvohreepvw"
+L212: .string "wrvqftkxrigntz"
+L213: .string "ewsbkyvv"
+L214: .data 405, -244
+lea L3, L28
+L215: .data -692, -460, 848, -586, -856, -562, 50, -430
+L216: .data 248, 314, 982, 653, -46, 214, 758
+L217: .string "dwtweuzghtjdevc"
+cmp *r2, *r3
+L218: .data -670, -968, 350, -405, 603, -868
+L219: .data -370, -838, 131, -233
+L220: .string "tvuh"
+; comment
+L221: jmp *r7
+L222: stop
+L223: .string "vjlqginochvtiepppdyze"
+L224: .data 562, 357, -627, 220
+L225: .string "ltgneaabkxtyagccdjejyap"
+
+jmp *r7
+L226: .string "xntmglasgtvjfzwfgqmqy"
+add #-127, r0
+red L293
+mov *r5, L271
+L227: .data 756, 681
+; comment
+L228: .data 330, -671, 518
+L229: .string "xdspbbqpbq"
+add r5, L174
+L230: .string "jrsoteepkehjoduvvz"
+L231: .string "qdmtpkdxeaflvn"
+L232: .data -21, -175, 186, -253, 152, -866, -969
+L233: .string "vedajfvxgh"
+L234: .data 385, 503, 941, -797
+rts
+L235: .string "kkvhrmskjowvmoqa"
+L236: jsr *r7
+dec *r5
+L237: .string "nfkh"
+L238: .string "xmmggjuvmq"
+clr *r7
+L239: .data -915, -799, 9, -815
+L240: .data 870, 326, 443, -822, -736, 633, 999, -100
+L241: .string "wsgbrcwknpltyur"
+jsr *r3
+L242: .data -589, -401, 290, -858, -482, -504, 320
+L243: .string "rrqdiwaevwckng"
+stop
+prn #69
+L244: .string "lgiiisfxufdxuu"
+L245: .data 712, -808, 834, -242
+L246: .data -17, 568, 859, -138, 655, -221
+red L233
+L247: .string "roayklkfeidqnhlotmqxjz"
+dec L37
+cmp r2, *r6
+L248: .string "wlostjfzri"
+L249: .string "asdrzrtsimbcawaygol"
+L250: .data 981, 94, 231, -510, -729, -840
+L251: .string "x"
+L252: not L68
+L253: .data 177, -373, -610, 987, 242, 248, 269, -268
+L254: .data -17, 541, 468, 250, -946, -229
+
+L255: .string "nuy"
+cmp L148, L299
+L256: .string "ydhmgyfwym"
+L257: .string "ttl"
+L258: .string "uerbxprmprioyxmt"
+not r3
+lea L299, *r7
+; comment
+inc L32
+L259: .string "xumkuhwzdciipxqpdi"
+L260: .string "rnwp"
+sub r6, *r2
+stop
+; comment
+L261: .data 640, -762, -53, -820, 908, 308
+L262: .data -166, 364, 704, 343
+prn *r7
+L263: .data 219, -458, 731, -458, 757
+cmp #-115, r0
+
+L264: dec *r1
+L265: .data 199, 584, 302, 509, 918, -203, 839
+L266: .data 152, 490
+L267: .data 578, -1000, 907, -685, 457, 708, -531
+L268: .string "htd"
+add r0, L283
+L269: .data 920, -507, -363, 588
+red r3
+L270: stop
+L271: .string "puobasxej"
+L272: .data 861
+L273: .data -792, -738, -447, 60, 724
+L274: inc *r7
+L275: clr L293
+L276: .data 289, 768, 287, 887
+L277: prn *r3
+L278: .data -225, -868, 834, 778
+L279: .string "hvltldegmjavfvks"
+L280: .string "kowzjoaufhzekmoxdacaeo"
+L281: .string "ucdgbbbpkepnnoqupkg"
+L282: .data -357, -617, -910, 281, 499
+mov #-29, L286
+L283: .data -460, 518, 633
+L284: .data -627, -111
+not L303
+sub L320, *r1
+L285: .data -702, -608, 127, -176
+not r3
+mov r6, r4
+prn #-107
+mov *r7, r2
+jmp *r2
+L286: .string "bmwaxxfc"
+L287: .data -601, 848, -419, -37, 593, -939, 176, 667
+L288: .data 814, 563, -673, 575, 418, 427, 713
+L289: .string "lvkzcrkhepqhhj"
+L290: .string "qinvzvk"
+L291: .string "boddctphacvknubqqrnrnmfn"
+mov L319, L235
+L292: stop
+sub #192, L111
+L293: add *r0, *r5
+jsr L268
+L294: .string "ilatbsmqdqodnxdjiw"
+L295: .string "lyjhhtqizpqo"
+L296: .data -896, 106, 579, 370
+mov L322, L314
+L297: .data 369
+bne L315
+stop
+L298: .data -75, -608, 989, 960, -759
+L299: inc L309
+cmp L227, L25
+bne *r1
+L300: .data -535, -266, -306, 650, 401, 456, 199, -878
+
+prn L90
+cmp #-87, r6
+L301: .string "cbzqwxf"
+
+L302: .data -823, 741, 952, 739
+lea L319, r1
+L303: .data -327, 960, -747, -916
+clr r2
+L304: .data -182, -875
+L305: .string "fuvibfbldudcshw"
+sub L18, r4
+L306: .data 139, 352, -589, 494, 208, -43
+L307: .string "odobj"
+red *r2
+L308: .string "kstwiqadvy"
+L309: .string "pwcroecmfckpwoxsrfrrqkvn"
+mov #5, L323
+L310: .data -107, 828, 715, -415, -460, 404, -775, -477
+mov *r0, r0
+L311: .string "mywmjtflserdiecbwojo"
+L312: .data -29
+L313: .data -124, 204, -81, -5, 630, -324, -401, 127
+L314: jsr *r6
+prn r3
+L315: .data 454, 231, -666, 491, 981
+L316: .string "logs"
+L317: .string "yidygpruvernaezkbis"
+
+mov L64, L60
+L318: .string "oozmzvpbgedekmmyabq"
+cmp #-170, L91
+; comment
+L319: dec r0
+L320: .data -695, 7, -280, -5, 652, -932, -557, -154
+L321: .data -880, -120, -420, -532, 687
+L322: .data -303
+L323: .data 801, -838, -98, -995, -97, -87, 859
+L324: .data -742, -561
+stop
@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 20
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+L0: .string "bxyjbunzarfnglclhtr"
+L1: .string "qzxft"
+stop
+L2: .data 423, 859, -876, -812, -881
+L3: .data -726, 158, -11, 668
+L4: .data -33, 830, 890, -870, -75, -463
+cmp #76, r5
+L5: stop
+L6: .data -304
+L7: .string "dxyorlxaumokzvknb"
+jsr L0
+L8: .string "swpdq"
+L9: stop
+inc r2
+L10: .string "sktdjrbrxktalzsrlodddjro"
+L11: .data -4, -941, 311, 640
+L12: rts
+
+L13: .string "jgadvevigxbz"
+L14: .data 742, 863, -655, 516, -207
+L15: .data -529, -737, 280, 840
+L16: .data -61, -110, -914
+L17: .data -883, 595, -357, 76, -7, 117, -579
+L18: .string "cff"
+L19: clr r6
+prn #83
+L20: .string "qdbwstgcoz"
+L21: .string "yoabkvsmqybbdkxvxudh"
+jsr *r1
+jsr *r0
+L22: .string "myfxeanyzpwmnv"
+L23: stop
+L24: .string "qxuxid"
+red r7
+L25: .string "mtivgngzfdjvlojycr"
+L26: .data 94, 376, -778, -561, -905, -657
+L27: .data 413, 499, 229, -281, -273
+L28: .string "hcchnissnolpni"
+mov r3, *r2
+prn r7
+stop
+stop
+L29: .string "nuvwdcikbwz"
+L30: cmp #-111, r1
+L31: .string "ewgtitvcbegvwynpuc"
+L32: .data 481, -522
+dec *r3
+L33: .string "fbkeyfxjeqzcrluvysqhxi"
+L34: .data -610, 392, 220
+L35: .string "ycttxlvg"
+L36: lea L282, *r5
+L37: not L7
+L38: jmp *r3
+bne *r7
+L39: .string "shai"
+red *r3
+L40: .string "bziyerjrsqhtlnvhd"
+L41: .string "brkjnn"
+dec *r4
+L42: .string "s"
+cmp r3, #238
+L43: .string "eoubgvtbppteveu"
+L44: .data 417
+add L8, r2
+L45: .data 849, -330, 215, 474, 205, 513, 991, -772
+dec *r7
+L46: .string "wn"
+L47: .string "c"
+red r5
+rts
+dec *r3
+L48: .string "bvj"
+L49: .string "fgotohwahuhgfyesbzotdai"
+not *r0
+lea L67, *r4
+L50: .data -235, -273, 643, -266, -325
+cmp *r7, #14
+L51: .data 839, -131, -860, -89, -13, 812, 505, 215
+L52: bne *r5
+not L280
+stop
+mov L19, *r6
+L53: .data -228, 564, 272, -746, 892, -477, 801, 675
+L54: .string "solzxwhfrszlzbkzclamg"
+red L272
+clr L34
+L55: .string "xqgrpw"
+L56: .string "ybpzzvljfwp"
+L57: cmp L38, r5
+L58: .string "ywtcjqadrcus"
+red r3
+L59: inc *r3
+mov L59, *r6
+L60: red L81
+L61: .string "khowlewu"
+L62: .data -113, -217, -235, 105, -500, 694
+L63: .string "lzqnelncgf"
+L64: .data 739
+jmp *r4
+L65: .data -348, -732, 929, 731, 80, -698
+L66: .data 193, -235, -375, -752, -699, 287
+red L50
+L67: dec r2
+prn *r6
+L68: .string "x"
+L69: .string "hnngktzjjuy"
+L70: .data 45, 881, -281, 100, -315, -478
+L71: .data 500, -410, 427, -886, 973, -457
+L72: .data 781, 565
+add *r0, L50
+; comment
+L73: .string "mwckwdjusakw"
+L74: .string "ceg"
+L75: .data 449, 688, -565, -806, 387, -588, -555, 102
+; comment
+L76: rts
+L77: jsr *r2
+L78: .data 71, 401, 435, 816
+mov #153, *r0
+L79: .string "gjvcmimctzzyuwnoac"
+prn r2
+L80: .string "ig"
+L81: .data -159, -93
+L82: .data 84, 439, -966, -644, 822
+
+L83: .string "dg"
+L84: .data -595, -586, -971, 34, 964
+L85: .data -223, 222, 798, -772, 714
+bne *r6
+L86: .data -997, 565, -146, -176, -772, 145, -34
+L87: .string "clytayiyfqbiagjdixdq"
+L88: .data -664, 273, 186, 570, 804, 230
+red *r6
+cmp L37, r4
+L89: .string "qmnungimobydrwquumuqznkx"
+L90: .string "utjkmynihjaqoqeo"
+L91: .string "weualgxzterqwcnt"
+L92: .string "fmk"
+add #-124, r1
+jsr *r2
+L93: .string "vujaxuz"
+; comment
+L94: .string "h"
+; comment
+rts
+L95: .string "fugvldddkwxvlhwozmuwan"
+dec r7
+; comment
+red r3
+L96: .data 224, -583, 512, 684, -285, -947, 128, 937
+L97: lea L207, *r2
+L98: .data 437, 573
+L99: .string "px"
+inc *r7
+sub r5, *r2
+L100: .string "ykemfdvblvwoeeratoqwt"
+L101: .string "pwiera"
+L102: .string "pxxutartherpldykiv"
+dec r6
+L103: .string "lfmvxqwrptpxnhzzsvdsw"
+L104: .string "qexquppkzsbhrtpjk"
+bne *r5
+bne *r3
+L105: .string "lhynqjukg"
+
+clr *r2
+L106: red L105
+L107: .data 125, 872, 341, -547
+stop
+L108: .string "oxohyr"
+L109: .data -115, -506, -9, -828, -684, 116
+L110: .string "rxhayycygdjfupuw"
+L111: .string "vpjnzlw"
+L112: .data -902, -768, 296, 941
+L113: .data 139, 437, 950, -876, 119, -331, -219
+L114: add r1, *r0
+clr *r2
+sub #-117, r5
+L115: .string "ljbsqoquq"
+L116: .data 817, 433
+L117: red *r5
+clr r4
+L118: .data -988, 912, -994, -845, -713
+mov #-9, L138
+L119: .data -733, 807
+inc *r2
+jmp *r2
+L120: .string "nxaomjrrkq"
+L121: .string "ekssmmzzyrgvd"
+lea L221, L118
+jsr L16
+L122: .data 804, 394, 892, -549, -24, -830
+L123: .data -920, -765, -13
+L124: .data -270, -566, 860, -185
+L125: .string "feuc"
+L126: .data 518, -525, -84, -286
+L127: .string "izitxisxvib"
+L128: .data 409, -961, 684, -377, -421, -785, 136
+rts
+jmp *r1
+lea L125, L88
+L129: .data 995, -233, -418, 940, -574, 25, -974
+L130: rts
+clr r5
+L131: rts
+L132: .data 924, -718, 865, -464, -252, -590, -2
+L133: .data 446, -778
+L134: .data 206
+clr r7
+L135: cmp *r6, r6
+L136: .data 293, -716, 62, -203, -650, -518, 846, 259
+L137: .data 960, -455, 343, 936
+dec L199
+L138: add r4, L132
+L139: lea L188, L63
+lea L197, r4
+L140: .data 34, -99, 768, 549
+L141: red r6
+L142: clr r6
+L143: .data -799, -762, -6, -827, -62, -944, -271, -110
+L144: .string "meeylvblfextd"
+add *r7, *r6
+L145: cmp L81, #46
+L146: .data -952, 321, -966, -90, 574, 201, 611
+L147: .string "ppxxky"
+L148: .string "pfavzbdg"
+L149: .string "firwonzaeliiqrzikwohyajr"
+stop
+cmp L181, #-154
+L150: .string "qusgqjwwffhlyhmtjfezxsxw"
+lea L31, *r4
+not L133
+
+L151: .data -58
+L152: red *r5
+prn #126
+rts
+
+L153: .string "vhzscvqhwfkajdfcidoo"
+L154: .string "j"
+stop
+L155: .string "nhpxy"
+sub *r3, L159
+red r2
+L156: mov #242, L126
+sub *r6, r1
+mov #-29, L55
+jsr L296
+bne *r1
+not L274
+add #-166, L103
+bne L29
+L157: jsr L189
+L158: sub L225, *r0
+dec *r4
+lea L232, r6
+L159: .string "jiulwmxmetfz"
+L160: .string "cpmsntemz"
+mov L9, *r7
+L161: .string "ngjzenfzutgdibqmvomyu"
+jsr L231
+jsr *r6
+; comment
+L162: .string "hmfffpsqsjnjlqsxsq"
+rts
+; comment
+prn #-105
+L163: .data -602, -331, -860, 643, 123
+L164: .string "xfubynutjirvzmqtwtnxcwx"
+L165: .data -929, 341, 62, -880
+jmp L25
+L166: .data -958, 968, -783, 549, 693, -752, 317, 892
+inc L189
+L167: .string "txdhnatfbcedt"
+L168: .string "tmxeqyxzovtrloqcewdksk"
+L169: .string "g"
+L170: jsr L289
+L171: .string "cqnybjoshhcid"
+L172: .string "rquye"
+L173: .string "fqugivd"
+L174: .string "mjzsmvdess"
+L175: .string "cjtyltlb"
+L176: .data 853, 92, -745, -814
+L177: .data 803, 977, 77, -310, 734, -217
+L178: .string "rzrkdbiatuykuxkowmaqif"
+L179: .string "ahqtpzna"
+L180: .string "dfkseabppsllkkyr"
+jsr *r1
+L181: .string "ouatcjbkcojresiabuvq"
+red r2
+sub *r1, L187
+L182: .string "ddcssusahjop"
+L183: .data -209, -651, -974, 912, 432
+L184: .data 228, -589, -133, -884, -540
+jsr *r0
+add L12, r6
+L185: .string "twviapu"
+inc *r1
+dec L179
+L186: .string "zlueyvgzvfnbjyguxfuuz"
+rts
+stop
+L187: .data 676, 599, 463, 762, 945, -433, -81
+L188: .string "xohwrzjigxe"
+stop
+sub *r6, *r6
+jsr *r6
+L189: .data -577, 575, 173, -860, -325, 315, -642, -525
+L190: .data -369, 160
+lea L25, r7
+mov L250, L259
+L191: .data 153, 505, -181, 978, -736, -930
+L192: .data 884, -800, 744, 545, 644
+L193: .data -485, -479, -899, -771, -435
+sub *r2, L64
+rts
+L194: .string "unmvezyni"
+L195: .data 930, -144
+cmp L64, #-221
+L196: .data -616, -12
+L197: .string "chljcsjmsyqyxnrvgkaicjz"
+L198: .data 665, 949, -396, -378
+L199: sub #-240, *r2
+sub r3, L98
+L200: .data -95
+L201: .string "pgjegjuvc"
+L202: .string "l"
+L203: .data -54
+L204: .data -300
+jsr L21
+L205: .data -222, 468, 320, 233
+inc *r3
+mov #-40, L4
+L206: .data -815, -216, -452
+L207: .string "eyqlt"
+stop
+L208: rts
+add *r1, *r3
+L209: .data 187, 403, 828, -402, 773
+L210: .string "rcevwtwftqbp"
+dec *r0
+L211: .data -681, -346, 88, 827, -118, -461
+dec r6
+L212: .data 925, 227, 242, 882, 693
+L213: red L32
+L214: .data -85, -774, -411, 622, -297
+L215: .data -431, -797, -212, -456, -816
+L216: .string "qmjadkutmeygduewn"
+L217: .string "cwyhzmswxfawfg"
+; comment
+L218: .data -4, 962, 45, -881
+jmp L64
+L219: .string "xslattnjywyrzc"
+L220: .data -535, 860, 378
+mov r4, r6
+L221: .string "irilyedabcfxhjxbkoeqy"
+sub r1, r4
+L222: .string "i"
+L223: .string "pyv"
+red L243
+prn *r2
+L224: .data 22, 642
+cmp L98, #-15
+; comment
+L225: inc L108
+L226: .string "ihtgzupvkaybou"
+jmp *r0
+L227: .data 788
+
+prn #-86
+L228: .string "ohy"
+L229: .string "ijecmpjg"
+L230: .string "gtaev"
+L231: .data 319, -562, -706, 236, -677, 306, -993, -302
+jsr L174
+jsr *r3
+L232: .data -153, 929, 789, -791
+; comment
+L233: prn #-188
+L234: .string "k"
+L235: .data -687, 475, -680, -596
+not L199
+L236: .data -77, -456, 797
+dec L220
+L237: .string "cvmlhhcnmvtl"
+L238: .string "trc"
+jmp L241
+L239: .data -803, 201, -418
+L240: .string "lzo"
+cmp #78, r5
+sub L94, *r1
+jsr *r4
+L241: .data 951, -447, 246, 863, 411, 128, 438
+L242: .data -728
+L243: .string "qaoryci"
+L244: .string "jxppimco"
+bne *r1
+L245: .string "movc"
+L246: .string "igdnqugcjqfg"
+L247: .data 384
+L248: .string "ar"
+L249: .string "izgjybta"
+L250: .string "nmtvmmalrqcrnej"
+L251: lea L288, r4
+cmp *r3, r7
+L252: not *r6
+L253: .data 138, -716, -91
+stop
+L254: .string "hrnvcrllgqsvh"
+L255: .string "xblrthbwqqgbejsmerut"
+mov *r6, *r0
+L256: .string "l"
+dec r7
+L257: .data 618, 382, 392, 465, 167
+add #25, L41
+lea L289, *r4
+inc *r6
+L258: .data -312, 33, -747, 913, 122, -237
+L259: mov r5, *r4
+jsr L308
+lea L133, L101
+L260: .data 426, -626, 583, -142, 637
+; comment
+rts
+L261: .string "wvlevd"
+dec r6
+dec L274
+L262: .data 299, 218, -155, -521, 839, -110, -318
+L263: .data 185, 986, -706, -187, -918, 918, -599, 637
+dec L4
+L264: .string "czxeasotfagbrdgcgtqc"
+jsr *r5
+red r0
+L265: .data -733, 851, 750, -455
+sub r6, *r4
+L266: .string "epyohrfpyj"
+L267: .data 734, -16, 954, -561, -521
+L268: .string "k"
+L269: .data 69, 8, -596
+mov L109, *r1
+L270: .string "efvzdnbmnws"
+L271: .data 857, -109, -89, -299, -683, -758, -105
+rts
+L272: .string "kfzrvzfy"
+inc r7
+L273: add #146, L278
+; comment
+L274: .data 501, -296, 630, -524, 259, -612, 757
+L275: jsr L294
+; comment
+L276: .data 556, 163, -325, 281
+; comment
+clr L298
+L277: .string "xzvwnxobvvnonddce"
+L278: .data -522, 228, -536, 545
+rts
+clr r5
+L279: .string "ytdohnlelrupyx"
+add #89, L99
+L280: .string "amngwmjrzfqwjjfgmwpkhrq"
+L281: .string "ukcixkfqwkwqxbexsffzga"
+L282: .string "tkrxytzxf"
+L283: .data -877, -6, -604, -528
+L284: .string "zsyeid"
+L285: .string "mgur"
+L286: .string "qalx"
+jmp L234
+red L123
+L287: .data -203
+L288: cmp #-125, L300
+L289: .data 755, -593, 619, 382, -265, -892, -504
+L290: .string "bkukzms"
+jsr L229
+L291: .data 628, 359, 927
+L292: .string "ycspsanwx"
+L293: .data -16
+; comment
+prn r2
+jsr *r7
+L294: .string "xabde"
+L295: .string "sutbllnzazms"
+sub r7, r2
+L296: .string "dfttwxdtchvqnb"
+L297: .string "eauhwg"
+L298: .string "nhbph"
+add L178, L301
+L299: .string "hdqdff"
+bne *r3
+L300: .data -435, 982, -990, 301
+L301: .string "svuuscvoezlumekoms"
+L302: .string "nioxrdiplrarigorfwccntl"
+inc *r7
+prn #-166
+L303: .data 40, 577, -858, -549, -176, -911
+L304: .string "lsmvdtaescnmbk"
+L305: .data -612, -960, -272, 631
+L306: .string "okaaodnwkcqkypptu"
+L307: .string "pkykjjvnp"
+L308: .data 246, 738, 578, -838, -534
+L309: .string "jd"
+stop
@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 3
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+L0: .data -646, 353, 842, -254, 267, 945, -671
+L1: .data -831, 223, -125, -885, -826
+
+cmp r6, #43
+L2: .data 283, 297, 560, -633, 750, 569
+jmp L279
+L3: .data 49, 492, -507, -755, -514, -149
+; comment
+L4: .data 543, -981, 501, 239, 6, 580, -922, -239
+L5: .string "jkydfnvfsd"
+L6: .string "bg"
+inc r4
+L7: .data -570, 934, -192, -944, 261, 408, 331
+prn L89
+jmp L10
+L8: .string "slxivccdpvrrvtboqtywpn"
+L9: .string "lcj"
+L10: .data 608, -664, 8, -427
+; comment
+L11: .data 571
+
+L12: .data -524, 163, 488, 422, 958, -585
+L13: .string "hpplvflbbzoubdgklbjg"
+sub *r2, L186
+L14: dec *r7
+L15: cmp #200, #-159
+clr *r5
+L16: .string "kxhnpsmigspq"
+L17: jmp *r2
+L18: .data 212, -725, 658, -654, 743, 493, 855
+L19: .data -382, 232, 562, -384, -840, 1, 106, -319
+L20: .data -40, -249, 338, 934, -967
+L21: .data -456, 477, 612, 505, -316, 325, 993, 333
+L22: .data 895, 159, 685
+stop
+L23: .string "nhfkbcwahwegxvbt"
+L24: .data -728, -526
+L25: .data -375, 839, -903
+L26: .data 52, -711, -308, -104, 616, -468, -468, -128
+L27: .data 841, 155, -980, 995
+L28: .string "nyfckttfdqiuteam"
+L29: .data -146, 372
+cmp r0, #73
+L30: .data -51
+rts
+cmp r0, L22
+L31: .string "xgfkaxdgnsuuiis"
+L32: .data 858, -75, -764
+prn #-39
+rts
+L33: .data -907, -428, 697, 441
+L34: .data -924, 453
+L35: .data -738, 563, 579, -137, 126, 773, -462, 14
+
+
+mov L237, *r5
+add r4, L102
+prn r0
+L36: .string "wqyxgdaihamwyluwwhqcojbs"
+L37: .data -573, -793, 18, -670, -275, 267
+; comment
+; comment
+L38: .string "iygmchgzznvogfplmgo"
+clr *r6
+L39: .data -266, 101, 628, 114, -49, -620
+L40: .string "ploxpyo"
+L41: .string "aiqonvpyciklhv"
+L42: .data -392, 586, -811, -944, -269
+L43: .data -815, -109, 423, 645, 657, -360, -597
+L44: .string "brwanwjkuosssewen"
+L45: .data -936, -150, -672, 251, -18, -145
+L46: jsr L77
+
+L47: bne *r2
+L48: .data 548, -599, -29, 549
+mov *r1, r6
+cmp r7, *r3
+L49: .string "hzwcoczkpagowqpgkozn"
+mov L258, r6
+mov L6, *r5
+L50: .string "zsbkmcqeugdtwctw"
+L51: .string "lrwwlucsumvbnbrqrf"
+mov #-34, *r3
+L52: .string "dppzpnvvksfzp"
+L53: .string "wtglfvkvuxodcmssuq"
+L54: .data 732, -702, -328
+clr r3
+L55: .string "jpkadikgwogllkaup"
+L56: .data 333, 381, -339, 113, -434
+; comment
+rts
+L57: .string "hw"
+L58: .data 206, -102
+; comment
+L59: .data 49
+red L218
+L60: .data -458, 796, 5, 576, -761, -52, -735
+prn #-38
+L61: rts
+add *r2, r1
+L62: .data 737, 657, -43, -886, -771
+L63: .string "yamwvmrv"
+; comment
+; comment
+jmp L25
+L64: .string "xush"
+L65: rts
+L66: .data 704, -277, -107, 178, -138, -420
+jsr L19
+bne L51
+L67: .data 38, -784, -528, 843, 127, -131, 426, 66
+L68: not *r1
+L69: .string "gznfffwsorbocbojk"
+L70: .data 961, -129, 821, 662, 801, -62, -713
+dec r5
+add #77, r2
+L71: not *r3
+L72: .data 186, -430, -32, -967
+sub *r4, r1
+L73: .string "r"
+L74: .data -86, 418, 519, 73, -932, -758
+L75: inc *r0
+jsr L22
+L76: .string "bhk"
+sub L49, *r1
+L77: .data -205, 790, 596, 84, -138
+L78: .string "pgelikzqnmzhgurtkbwg"
+; comment
+L79: prn r3
+jmp L25
+L80: .string "mchvnvcrdaplekbexedthay"
+L81: .string "bvayeelawjdxzljpiadt"
+clr *r2
+cmp *r5, *r4
+clr L150
+L82: dec *r6
+L83: .data -496, 6, -323, 934, -345, -480, 530
+L84: .data -881, -58, -842, -638, -847, -440, 142, -143
+L85: .data 77, -332, 980
+L86: .data -559, 219, -433, 484
+prn *r2
+L87: .data -953, -859
+
+jmp L272
+mov *r3, L96
+L88: .data 344
+mov L0, *r1
+lea L116, L186
+add r5, L111
+mov #184, r1
+rts
+L89: .string "bmhjnxhmhmpfdumihzq"
+; comment
+add #-68, L37
+L90: .string "bmibazln"
+L91: .string "ho"
+cmp L237, L74
+L92: .data 494, 752, 602, 175, -827, -229, 322, 799
+L93: .data -251, 602, -370, -132
+L94: .string "ralmakpvqnocyem"
+L95: lea L202, r2
+clr *r0
+inc L187
+L96: .string "pxuozecoxt"
+L97: clr *r6
+L98: .string "fohlhldcvdht"
+dec r2
+L99: clr *r5
+cmp *r7, L110
+L100: .data 445
+L101: .data 372, -773, -756
+lea L53, L189
+inc L275
+L102: .string "pzibqrzngn"
+L103: .string "nkgza"
+L104: .string "qabxmptimgvr"
+L105: .string "iipniyxpklsuvjtejju"
+prn L83
+jsr *r7
+L106: .string "ezyttauindksoucdsloquh"
+L107: .data 390, -214, 757, 583, 701, 502, -212, -605
+L108: lea L93, L24
+L109: .string "cb"
+L110: .data -369, 838, -723, -534, -193, -40, 218
+L111: .data -281
+L112: .string "e"
+L113: prn #-177
+L114: .data 827, 719, -214, -613, 91
+lea L70, L34
+stop
+L115: .string "z"
+clr L4
+rts
+L116: .data -223, 597, -591, -3, -334, 298, 153
+L117: .string "vjkgwo"
+L118: .data 539, 113
+L119: .string "v"
+L120: .string "setqyhljfshsnxyllmko"
+L121: .data 533, 608, 310, -62, 325, -80
+L122: .string "fwehmwokgissygyirrcjdjls"
+L123: .string "cltdhtnfgmpzrvavbk"
+L124: .data -32, -651, -254, -218, 268, 390, 158
+bne L52
+L125: .data -863, -620, 948
+L126: .string "yqb"
+L127: .data 55, -172, 403, 479, 719
+L128: .string "tjvyjeifiigffzs"
+; comment
+; comment
+bne L128
+L129: .string "htwqqbyt"
+jsr *r6
+
+L130: .string "jdtfozgln"
+L131: .data 116, 98
+stop
+L132: .data -202, -59, 933
+sub L147, L185
+L133: .string "zsprqhchboh"
+jsr L97
+; comment
+dec L61
+L134: stop
+L135: .string "szdxizsqgdznibyctby"
+L136: .string "ingdwkwinctzhmffv"
+L137: .data 165, 403, -392
+inc *r6
+L138: jmp L244
+stop
+L139: .data 451
+L140: .data -881, 12
+L141: .string "fmsbpbtegezufehb"
+L142: .data 735, -585
+sub *r6, r3
+L143: .string "qepitwvghbbpu"
+L144: .string "ytvvjmohnzlliklnnc"
+L145: .data -162, -821, 186, -287, -986, 974, 721
+L146: .data 868, 748, 61, -839, -463, 554
+jmp *r0
+L147: .data 17, -824
+L148: .data -714, -686, 669, -800
+jsr L98
+L149: .string "garlyosgap"
+L150: .string "zl"
+L151: .data -405, -153, -491, 945, -401, 781
+clr *r5
+L152: .data 646, -921, 751
+L153: .data 26, 997, -460, -217, 198
+; comment
+jmp L145
+L154: .string "ikoznlpdq"
+rts
+prn #59
+L155: .string "sqzyvajinuxmpihumsdczee"
+L156: .string "blgtnqyilbytrieq"
+cmp L268, L284
+jsr L187
+L157: .string "iktoscckcekaaxqnumwaxp"
+L158: .data 155, 866, -907, 112, -394, 1
+; comment
+L159: .string "mzlphwdktxjltbgigwuokian"
+L160: .data 36, 816, 477
+bne L181
+rts
+L161: mov #-10, L292
+L162: cmp L143, #119
+L163: .string "n"
+clr L164
+L164: .string "kvqthhi"
+L165: .string "pxqvjwdimdmehubeodcxjk"
+not *r2
+red *r0
+L166: .data 109, -699, 873, -833, -265, 653
+L167: .string "qwvucmmnfrbwudrwcpf"
+dec *r2
+bne *r0
+sub L225, *r7
+L168: .data -61, -806, -842, 781, -2, 418, -337
+L169: .data 835
+red *r1
+L170: .data 619, 777, -173, -583, -773, 62, -592, 882
+add r7, *r4
+L171: .string "kteyjqbvqewbianudt"
+L172: .data -766, -380, 119
+L173: .string "gvtdpnizaw"
+L174: .string "jgpfuabfdxskor"
+L175: .string "wrueqafvynsymka"
+L176: .data -772, 639, 637, 560, -92, 53, 670, 596
+L177: .data 518, -302, -999
+lea L187, r7
+L178: .data 766, -917, 958
+L179: .string "pngwvlvwfczjkelxpdf"
+L180: .data -527
+L181: .data -569, -5, 115, -912, 664, -399, -564, -673
+L182: .string "eydvz"
+L183: .data 500, 353, 732, 569, -857, 638, 751
+L184: bne *r7
+jsr L236
+mov r3, r7
+sub #167, r7
+L185: .data -953, -368, -871, 978, -770, -163, -66, 857
+L186: .string "nbfdfvlur"
+L187: .data 544, -905, 911, -765
+L188: .string "nqnfmt"
+L189: .string "easv"
+L190: .data 342, -386, 892, -570
+L191: .string "hnzxzjhdvgfuyyxectvtul"
+
+add *r7, L219
+L192: jsr L248
+dec r6
+L193: .data 539, -842, -700
+L194: .string "ojxksbdlfcjrlsxgylsae"
+L195: .string "zb"
+L196: .string "bqxgmgvpuwpde"
+L197: .data 493, 528, -757, -508, 271
+L198: .string "llpgynwrthxzissapldejfzh"
+L199: bne *r2
+jsr L165
+L200: .data 262, 771, -713
+not r7
+prn L115
+stop
+L201: .string "yvbcmswbfithhvgamoxv"
+L202: .string "gpludedojnujb"
+L203: .data -849, -488, 731, -974, -866, -16, -265
+L204: .string "lydj"
+
+L205: .data 404, 853, -819, 858, 688
+L206: .string "erkffhc"
+L207: .data 909, 11, -380, -761, 451
+jsr *r7
+L208: .data 3, 57, 880, 233, 824
+L209: .data 25, -538, -997
+
+red r0
+L210: .data 139, 122, -223, -15
+L211: .string "ixuhqlwapz"
+L212: .string "dsfykrecszapippxwconir"
+jsr L204
+L213: .string "dgaxmwptyjaeztbdy"
+mov L149, L258
+inc *r6
+inc r0
+L214: .data 23, -920, 632, -93, 825
+L215: .string "yjmdnhbyalrlz"
+not r0
+L216: .data -852, -966, 414, 275, 362, -406, 709
+rts
+L217: .string "vyyyvsbrulgihfo"
+L218: .data -527, -712, 207, 250, -726, -650, 744, -369
+rts
+stop
+not r3
+dec r0
+L219: .string "eovheouf"
+prn r4
+L220: .string "lntbxstnscviztbfw"
+lea L268, L263
+L221: .data -17, -11, -148
+L222: .string "oniexnhsxaqqsf"
+cmp #167, r5
+rts
+L223: .string "yqfvpcsxjvevjv"
+not *r0
+add *r5, L241
+L224: .data -637, -621
+L225: .data -391, -668, -624, -487, -742
+L226: .data 612, 581
+L227: .string "pafdomnej"
+L228: .string "alwtgsm"
+lea L225, *r2
+L229: .string "z"
+L230: rts
+not *r6
+jsr L53
+L231: .data 912, -586, -247, -500, 154, 289, 726
+L232: .data 34, -605
+
+L233: .data 111
+not *r5
+stop
+cmp L255, *r2
+bne L87
+L234: .string "qp"
+inc *r6
+rts
+lea L187, *r5
+L235: .string "pcwcmvznyzaplvbqdppdpdf"
+red L236
+L236: .data -458, 334, -456, 97, 689, -464
+L237: stop
+L238: .data -74, 123, 383, 130, 247, 327, 388
+L239: .string "ffjmcjtqrpyplb"
+L240: .string "rwphuqgtzziosjxxjmg"
+inc r2
+L241: .data -642, -442, 483, 76, -158, -817, 71
+L242: .string "frjjcynrnhpeqpisex"
+dec r1
+L243: .string "wdpda"
+clr *r3
+
+L244: .string "fvnvdsbvaepabejridgqrh"
+L245: .data -376, -410, 928, -198
+prn #-255
+L246: .data -648, 835, 422, -84, 325, -762
+rts
+L247: sub L282, L229
+clr *r7
+L248: rts
+sub r4, *r3
+jsr L57
+L249: .data 716, 620, 771, 707, -328
+L250: .string "zlgjyjehjgrn"
+L251: .string "lulmvmuhosfr"
+L252: .data 993
+jmp L255
+L253: .data 778, 390, -799, -195, 833, 983, 774
+L254: .string "adqxexro"
+L255: stop
+L256: .data -144, -920, -765, 612, 711, 345, 326, 913
+L257: .string "bgpydirytevwrfd"
+L258: .string "ozzml"
+L259: .string "uibtrqvjjepyt"
+L260: .data -658, -768, 416, 470, -957, 910, 693
+L261: .data -791, 155, 886
+L262: .string "iduvphvbshflyhtvmgohxzg"
+L263: .string "qywnnthnz"
+L264: .string "actwscet"
+L265: .data 676, 948, 257, -12, 804
+L266: .string "whvajviozbiqvdyyjr"
+L267: .data 698, -135, 136, -704, 21, -675
+dec r1
+jmp *r7
+L268: .data -138, -871, 914, -952, -115, -879, 764
+L269: .string "eo"
+L270: .data 207, -609, -258, -239, -21, 812, 929
+L271: .string "fyuusaaafhuxarza"
+stop
+L272: prn #-233
+lea L297, L36
+L273: .string "a"
+clr *r5
+L274: .string "uqncwzkbjopw"
+clr L283
+not *r7
+L275: .string "nuub"
+L276: .string "jxpqhjfwngxrr"
+L277: .string "qbujtaipzvfcuwzzkdqbfi"
+L278: .data 416, 984, -469, -589, -397, 969
+L279: .string "ialfmfn"
+prn #244
+L280: .string "mppxsfobtgiefxpedynag"
+L281: red *r2
+dec *r6
+L282: .string "xp"
+L283: .data 157, -844, -350, 390, -817, 186, -375, -880
+L284: .string "hgghrzcqp"
+not *r5
+L285: .string "ibikdfyojahvifsrbnsp"
+L286: .data 534, -266, 521, -757, -393, 922
+L287: .string "rtaocbvulu"
+clr L304
+clr L217
+L288: .data 342, 757, 344, 93, 483
+L289: dec r2
+L290: .string "xj"
+inc L305
+L291: .string "wsfa"
+add #241, *r1
+lea L298, r7
+prn #54
+L292: .string "uodebluvydjldrthisqte"
+stop
+jmp *r3
+L293: not r5
+L294: .data 43
+L295: .data -486, -772, 912, -708, -576, -701, 62, -96
+L296: .data -149, -902, 95, -496, -461
+L297: .string "gfmot"
+; comment
+sub #-239, r6
+jsr L134
+L298: .string "sknvxwtefemp"
+L299: jmp L184
+L300: .data -984, -211, -751, -126, -114, -637
+cmp L130, L106
+; comment
+L301: .data -317, 314, 125, 649, 751, -618, -727
+L302: .string "vdjcxgig"
+L303: .string "fzqpyythjnlgvu"
+L304: .string "nfonefwftqtuowhsrmo"
+cmp r3, *r3
+clr r7
+L305: .string "dyixpgpmikvpnzkb"
+add #-10, *r4
+inc r5
+dec *r5
+not L218
+L306: rts
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 21
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .data -733, -939, 633, 919, 393, 22, 365
+bne L0
+clr L0
+L1: jsr L220
+clr *r0
+L2: .string "nsapdhde"
+L3: .data -980, 318, 936, 599, 471
+
+L4: .string "fi"
+clr *r2
+L5: .data 712, -390, 60
+L6: .string "melqlifdrhwedhvworiq"
+L7: .data -122, -288, -402
+red r5
+L8: prn *r0
+jmp L0
+L9: .string "jjvihr"
+prn r1
+L10: .string "xsltzhsdb"
+L11: .string "lmopefieioy"
+L12: .string "bkebkvcoanfzpbsjzlgyj"
+L13: .data 318, 291, -96, 411, -642, 945
+L14: .data -655, -225, -123
+L15: .data -190, -4
+stop
+L16: .string "pjtpxjayb"
+; comment
+L17: .string "ioygzialvidglfzcltltmdg"
+L18: stop
+jmp *r0
+L19: .data -76, 890, -265, -707, -738, -294, 106
+clr r7
+L20: .data 345, 426, -102, 331, -468, 102
+bne *r1
+L21: .string "i"
+L22: .data 689, 12, -916, -70, -534, -413, -794, 376
+L23: .data -145, 206
+L24: .data -947
+L25: .string "ptrgrtxtllbstwt"
+L26: .string "glusoynflyqulg"
+L27: .data -290, -848, 661, 90, 723
+bne L145
+L28: .string "wnxivekrswitdkltrrztgcpz"
+L29: .data 892, 640
+L30: .data -906, 60
+jmp *r7
+L31: .string "i"
+L32: .data -715, 643, -117, -76
+L33: .data -732, 156, 572, -451, -287
+L34: .data 401, 304, 505
+L35: .string "p"
+L36: .data 673, 653, -206, 310, -672
+L37: rts
+dec L188
+L38: .data 675, -939, 152, 406, -882, -352
+prn L144
+L39: .string "sxqd"
+L40: .data -783, -548, 904, 138
+L41: .string "arrhljlkxoerwpjhcb"
+L42: .data -874, -982, -533, 769, -719
+red *r3
+jmp L289
+L43: .string "upkafndtpaggpp"
+L44: .data -144, 570
+lea L38, r7
+bne *r2
+L45: .string "oh"
+L46: .string "reuyvku"
+L47: .data 274
+L48: .data -60, -631
+L49: .data -825, 870, -846, 477, 914, 864, -195
+L50: .data 640, 85, -512, -567, 547
+L51: .data 894, 711, 49, 86, 757, -659, 540, -927
+L52: .string "cadqijqqicnzskzdnj"
+L53: .data 761, -346, -292, 779, -496, -701
+mov r6, r5
+L54: .data -747, -207, -979, 226, 69, 651
+L55: .string "ytdj"
+L56: .data 872
+L57: .data -785
+L58: .data -9, 148, -430, -4, 253, -872, -103, 409
+L59: .data -104, 683, 198, 173
+red L105
+L60: .data -495, -912, -567, 95, 700, 168, 347, 881
+L61: .string "zent"
+L62: .data 653, 399, 632, -123, -107
+inc *r4
+lea L167, L25
+mov r0, r6
+L63: .data -559, -278
+L64: .string "ysseoeglmozgyjoz"
+L65: .string "jdqhdrlwdsmitswzobo"
+cmp r6, L22
+add L39, L3
+L66: .data 15, -519, -173, 441, -482, -776
+L67: .data -815, 838
+L68: .string "qkofruegrbq"
+L69: .string "ndlumd"
+L70: .string "kkhav"
+dec L289
+L71: .data -252, -372, 927
+L72: .data -110, -893, 0, -354, -503, 178, 376, -540
+L73: red r7
+L74: .string "rdie"
+L75: .string "cijvtlielzgsqxriuw"
+L76: .string "cxqeia"
+lea L242, r5
+clr r4
+L77: .data 795, 734
+L78: .data -669, -69, 120, 940, -607
+jsr L105
+L79: inc r0
+clr r5
+L80: .string "kyxqnnqjiuef"
+L81: .data -910, 703, -97
+L82: .data 672, 507
+L83: .string "asctvtmcr"
+rts
+
+L84: stop
+lea L91, L26
+L85: .string "ci"
+L86: .data 940, 848, -671, -490, -649
+L87: sub #233, *r2
+not L66
+dec *r4
+L88: .string "tkjitcjefglftrjcodfzuxc"
+; comment
+L89: jsr L37
+L90: .string "j"
+prn L235
+; comment
+stop
+L91: .string "wmshum"
+; comment
+red L167
+L92: .string "ujox"
+; comment
+cmp *r4, r0
+L93: .data 371
+L94: .string "ehzfstxl"
+L95: sub L251, L67
+L96: .string "pbrlrhbwlhjerv"
+add L22, r0
+rts
+L97: jsr L24
+L98: red *r0
+cmp r5, #93
+L99: .data 613, -345, -936, -847, 925, -799
+L100: .string "nayzjoqhcjwgbgbpbildus"
+L101: add r6, L304
+L102: .string "bfcprjdcfatpvolwlfkymn"
+L103: .string "jtuboseirepjddetnsj"
+L104: .string "hqskmnsrd"
+L105: .string "ayioaiwfigllc"
+L106: .string "m"
+prn r2
+L107: .string "awfxenudpepibmeg"
+L108: .data -851
+L109: red r3
+L110: .data 516, 690, 361, -945, -775
+L111: add r5, *r6
+L112: .string "hzxzzdhxzdeituggy"
+sub *r7, L163
+cmp r6, *r1
+L113: .string "kabvfwoixcldk"
+L114: .string "qtwcpduwumspy"
+cmp *r5, r0
+L115: .data -824, 320, 852, 904, 238
+L116: .data 756, -810, -1, 385
+L117: .data -849, -482, -746, -107
+prn L95
+L118: .string "tipyyyvyncrrowezyeqh"
+L119: .string "ne"
+L120: jmp L196
+bne L118
+L121: .data 385, 506, 41, -311, -910, 924, 559
+L122: .data -84, 298, 290
+L123: .data -304, 795
+L124: .string "xpjt"
+L125: .string "xyykedovqcpqfljywguocos"
+mov *r6, L73
+L126: .string "jmwubshxrrdkjunzpknxxw"
+L127: .data -724, -268, -102, -918, -779, -861, 86, 339
+lea L80, *r5
+L128: .data 268, 158, 974
+L129: .string "oiiaabycxwk"
+L130: .data -498, -646, -322, 895
+jmp *r1
+mov r3, r3
+mov r6, L63
+; comment
+lea L80, r0
+L131: .string "phffpntncwliuxhyxcmqcc"
+L132: .data 253, 793, -189, 316, -313, 884, 340
+L133: .data 917, 929, 165, 168, -802, 942, -328, 177
+jsr L230
+L134: .data 133, 713
+L135: .data 765
+L136: .data -868, -82, -533, -871, -713, -586, 798, -578
+cmp *r4, *r4
+not *r1
+L137: .data -109, 509, 57, 900, 611
+sub *r1, L211
+L138: .data 750, 685, 893, 540, 155, -408, -631, -159
+; comment
+L139: .string "jpuwmwwsaktv"
+L140: .string "cbvfqszwvivibfsgriemb"
+not L23
+L141: .data -127
+L142: .data -9, 356, -824, -993
+L143: .data 84, 55, 247, -47, -225
+mov #5, *r2
+L144: .string "ebcjk"
+L145: .string "dtwukpqpllekt"
+rts
+L146: .string "ojsvulhyndiecj"
+L147: .data -752, -348, -375, -854, 167, 203, -187
+
+L148: .data 856, -5, -307
+jsr L220
+L149: .string "cincoivywgfvwgoign"
+sub #-5, r5
+L150: .data 383, -186, -337, -888, -71, -911, -334, 10
+dec *r7
+L151: .string "tshtawssgkxwdicjjduhnq"
+inc L313
+L152: .data 776, -830, -416
+L153: sub L243, *r0
+L154: .string "wpawaxtvtcdnzjfdiuscitz"
+lea L311, *r4
+L155: .string "ygimtcqdvnp"
+L156: .string "ytjgw"
+L157: .string "z"
+L158: .string "nzhhvhxwbwuqybd"
+L159: inc r6
+L160: .string "ngvkgmkzbxqacxzdat"
+L161: lea L28, r1
+jsr *r3
+jmp *r3
+lea L179, *r6
+L162: .string "shzeafvdaqjurflvez"
+clr *r0
+not r7
+add *r1, *r3
+L163: .string "lalptecrjemt"
+L164: .data 344, -645, 361, 642, 37, -379, 284
+stop
+red L183
+prn L302
+L165: .data 105, -623
+L166: stop
+L167: .data 87, -846, 641, 174, 911, 112, 89, 427
+L168: .string "xng"
+L169: add #4, L30
+L170: .data -372, -739, -923, 384, 174, -315, 606, 562
+clr *r0
+L171: .data 171, 950, 746, 413, 644, 252
+L172: .string "gqw"
+dec L77
+L173: .data -554
+L174: .string "zqunlmgnmmuks"
+L175: .string "jadxmcsejghdxkchcyzgy"
+L176: .data -303, 670, 869, 396, -317, 678, 443, 291
+bne *r2
+jmp *r5
+L177: .data 543, 250
+add L232, *r7
+L178: sub #-210, r5
+L179: .data -757, -70, -470, -203, -970, -912
+L180: .string "bdgmelcglncukkbb"
+L181: .data -297, -413, -892, -802, 443, -641, 45, -537
+L182: .data -869, 999, 413, -768, 759, 902, -908
+mov *r2, r2
+cmp L228, L30
+L183: .string "x"
+rts
+stop
+L184: .data -276, 247, -28, 713, 647, -160, 913, 681
+L185: .string "zhpywxedombaywocoggzk"
+jmp L177
+add #-48, *r1
+L186: .data 133
+L187: .data 297, -791, -92, -411, -693
+L188: .data 220, -782
+L189: .string "jrrlvzdmrvijor"
+L190: .data -616, -491, -643
+L191: not r7
+sub #-114, *r3
+L192: .string "uwhbaswysor"
+prn r6
+
+L193: .data -705, 104, 217
+L194: .data 294, 619, -861, -682, -901, 83
+L195: .data 482, 374
+L196: .data 751, 794, -469
+L197: .data -335, -336, -167, 840, -132, -75
+L198: .string "qgwdmuegb"
+
+jmp *r0
+L199: .string "inlyyvlioyz"
+L200: jsr *r4
+L201: .string "couev"
+sub #-61, r6
+L202: .data 674, -86, -127, -627, 426, -730
+red L205
+red L265
+L203: .data -931, -706, -808, -607, 332
+L204: .data 86, 162, 966, -822, -359, 432
+L205: .data -598, 244, -842
+L206: .string "omgtn"
+L207: .string "pphztsquddtde"
+L208: .data 539, 390, -50, -584, 949
+jsr L37
+prn L251
+L209: .string "zefffnxretxocmoirdlugab"
+L210: .string "ltnyzhiznfesxxahx"
+L211: .data -575
+L212: .data -769, -707, 175, 512, 614, 737
+jsr L274
+L213: .string "rctpeqnqmjohwz"
+L214: .string "aftwh"
+inc *r3
+L215: cmp #81, r7
+L216: .string "w"
+not r0
+rts
+jmp L273
+L217: .data 178, -776, 816, -218, -942
+L218: .data 467
+lea L208, *r6
+L219: .string "lczeuymistcidscoajutxaly"
+L220: .data -442
+L221: .data 250, 636
+not r5
+
+not *r2
+L222: .data 650, 38, 322, -158, -218, 961, 289
+red *r0
+L223: .data 332, 784, 657, 463, -855, -663
+dec r1
+L224: .data -68, -545
+jmp L303
+; comment
+L225: .string "gpgdrpeymq"
+L226: .data -573, -169
+L227: .string "uhvchsmacdfeoqppucrlt"
+rts
+prn L262
+L228: .string "hqja"
+L229: .data -638
+L230: .data -189, 333, -587, -739, -277
+L231: .data 841, -888, 324, -690, 455
+cmp r5, *r4
+L232: .data -619, 548, 467, -676, -360
+L233: .string "mxhnkwdcfvmvxp"
+L234: dec r2
+L235: .data -230, 130
+mov #162, *r1
+L236: .data -161, 679
+prn *r3
+rts
+L237: .string "kzfnxmrjrlvxuzadlquq"
+L238: .data 710, 550, -47, -872, 562, 515, -773, -75
+L239: .string "jx"
+mov L111, L248
+; comment
+L240: .data -598, -476, -179, -760, -478, 885, 220
+L241: cmp r2, #-20
+mov *r1, *r3
+; comment
+; comment
+L242: .data -33, -15, -887, 267, -903, 957, -584, 927
+jmp L202
+L243: .string "pvoteimyiiwwnpvavagqzq"
+red L293
+L244: .string "iajljoegdsuezo"
+mov L265, L275
+L245: .string "viwvpgwbwsh"
+L246: .string "nmlriwbmifymqyaoh"
+dec *r5
+L247: .data 274, -809, 114, -673
+L248: .string "otjfsahrn"
+sub *r3, *r3
+lea L291, r4
+L249: .string "rpdxwiylvshnejalf"
+L250: .data -708, 545, 463, -738, -949, -961, 386, 133
+L251: .string "lptd"
+L252: .data 860, -60
+L253: clr L34
+red *r6
+; comment
+L254: .data -269, -205
+jsr L217
+L255: .data -358, 353, -626, -654, 246
+L256: .data -723
+jmp L286
+L257: .string "mvuigmchctvsuyfq"
+jsr L42
+add #-6, r3
+L258: jsr *r1
+L259: .string "lbsiqzcvdvfqbojmwkmgcehx"
+L260: .string "kukv"
+L261: sub #107, *r3
+L262: not r3
+L263: jsr *r4
+L264: .string "iwglillaphrvv"
+L265: cmp #-230, #125
+L266: .data 998, -793, -882, 816, 926, 139, -859, -937
+not r7
+L267: .string "alu"
+mov r4, r1
+clr r3
+lea L113, r2
+; comment
+L268: .data 139, 592, -935, 688, 750
+inc *r5
+L269: .data -358, 392, -342, -591, -821, 848, -305
+L270: .data -126, -410, -717, -772
+L271: .string "erdftuswaduxzhwlhbdt"
+; comment
+jsr *r2
+L272: .string "e"
+stop
+inc r1
+L273: .data 771
+L274: .string "apwwbdgt"
+L275: .string "npnaxmoucudddhhunfekezz"
+L276: .string "icghgowgrisrxwfun"
+L277: .string "jmxrnjmrrfajqd"
+jsr L309
+clr r7
+lea L279, L237
+inc L51
+jmp L304
+not L302
+jsr *r1
+mov L305, *r1
+L278: .data -540, 26
+L279: .string "vhftknx"
+L280: .data -500
+L281: .data -803, -838, -430, -214
+L282: .string "ptflgyqaiiwnluizp"
+cmp *r2, #-162
+; comment
+L283: .string "qssbkwypkqlit"
+jsr *r4
+L284: .data 880, 380, 341
+L285: rts
+L286: .data 398, -857, 796, 807, 264, 951, -393
+lea L138, L315
+L287: .data -343, 109, 958, -740, -179
+lea L86, r2
+L288: .data -408, -389, -788, -830
+sub *r3, r0
+L289: cmp #254, L305
+rts
+L290: .string "ctcszmu"
+L291: .string "cdnfiscyjqfgaokyldngl"
+L292: .string "uhbuymafjhvdtmnffhpkaln"
+mov #112, L308
+L293: .data -431, -770, 126, -663, -242
+L294: .data -452, -364, 694, 7, -890, -679, 495
+L295: .string "jemvkzapptkbtgivbww"
+L296: .data -868, 258, 341, 96, 404, -976, -422, 511
+L297: .data 769, -863
+L298: .string "xwpqllvneje"
+red L318
+L299: .data -372, 414, 725
+L300: .data 398, -145, -270, -186, 728
+L301: .string "kuo"
+L302: .string "rqtil"
+clr L258
+L303: jmp L311
+add #241, L306
+cmp r6, #-192
+jsr *r0
+L304: .data -713, 846, -846, -353, 827, -576
+L305: .data 322, 517, 808, -361, -792, 533
+L306: .data 820, -65, -290, -493
+L307: .string "tcezrkc"
+L308: .string "r"
+dec *r0
+L309: .data 22, 871, 159, -454
+L310: .string "q"
+red L229
+L311: mov L318, L58
+L312: .data -977, -418, 992, -951
+; comment
+red r5
+inc *r6
+L313: inc L318
+L314: .data -53, -697, 764, -208
+L315: .string "szuwt"
+L316: .string "woyydahafzrsktmctuz"
+prn *r4
+L317: .data 979
+L318: .data -165
+L319: .data 869
+L320: .data -119, -286, -89, -234, -274, -680, 30, 624
+stop
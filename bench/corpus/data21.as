@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 22
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .data -740, 377, -538, 416, 814, -412, 130
+
+jsr *r4
+L1: .data -268, 127, -492, -255
+L2: red *r2
+L3: .data -248, 443, 633, 266, 389, -492, 238
+jmp *r0
+; comment
+L4: .data 665, 968
+sub #67, L4
+L5: .string "teezhvxwnu"
+stop
+; comment
+not r5
+jsr L0
+inc r4
+L6: .data 797, -814, 12, 311, 326, 673, -650
+; comment
+L7: .string "fuubfkniiakzulxozkgtwo"
+add #-229, L5
+L8: .string "ilqynqrkhmarswtfnxzpy"
+L9: .string "mzxnsqikmzi"
+L10: .string "qoeznegxmuqwqbqgnnlhl"
+dec L165
+L11: .data -675, -392, 58, 533, 484, -212, -499
+L12: .string "aqw"
+L13: .string "tkderyibbdgqvmadq"
+L14: .string "ee"
+L15: .string "ykqjqryabacmp"
+L16: .string "msolwcjeruue"
+L17: .data -482, 226, -323, 133
+rts
+red r0
+L18: .string "xgrcjjhdkctixgzsji"
+L19: .string "ydwj"
+L20: .string "nmojnouqzqnqgj"
+L21: .string "mqmfglzwnuuasi"
+rts
+L22: .string "vokhwnwfmoig"
+L23: .string "wewdxucsllmas"
+L24: .string "rak"
+cmp r5, L270
+L25: .data -518, 949, -537, 427, -958
+not L178
+L26: .data -477, -606, -341, 528, 322, -953
+jmp L0
+clr *r1
+L27: .data 822, -879
+L28: .string "adgl"
+L29: .data -18, -548, -498, -395, 25, 972
+L30: .string "xblrppkelsmrn"
+L31: red *r4
+L32: .data 912, -645, -440, 902
+rts
+L33: .data 11, 820
+inc *r6
+; comment
+L34: .string "ensbfi"
+rts
+
+L35: .data -205, -956, -78, -617
+L36: .data -828, -531, 577, -410
+L37: .data 64, -911, 580, 79, 891, -130
+L38: .data -834, 401, 122, -474, -992
+L39: .string "waqalzlsgyqi"
+L40: .string "ooxfatqmlkbk"
+L41: .data -536, 193, -650, 960
+L42: .data 262, -755, -529, 220, 39, -735
+L43: .data 745, 969
+L44: .string "mmzhkhzxicdjcscmf"
+lea L287, r2
+L45: .data -525, 44
+red *r6
+not *r7
+L46: .string "gwuddboylsdaqqihbeyh"
+L47: .string "gih"
+L48: .data -668, -650
+dec *r4
+L49: .string "krzelkrumtmoqfyreypv"
+
+L50: .data 237, -798
+L51: .data 923, -720, -7, 296, 283, -986
+lea L45, *r1
+L52: .string "bvlzcmrazcaeb"
+L53: .data -548, 837, 650, 416, -829, -715, 607, 664
+L54: .data 288, -771, 976, 712
+L55: .string "wufbgh"
+L56: .data -249, 188, 624, 18, 669, 469, 657, -705
+prn L294
+prn r5
+jmp L52
+sub #-148, *r4
+add #223, *r4
+red L177
+L57: jmp *r6
+L58: .data -956, 263, -93, 790, -314
+L59: .data 672, 207, 636
+L60: .data 376
+lea L285, r0
+L61: .string "ydjlyxuqffohvdc"
+L62: .string "yxnwjpb"
+L63: .data -534, 71, 16, -695, -377, 7, 363
+bne *r6
+L64: .string "gbviqveifgdfstcqubuyc"
+L65: .data -631, -772, 594, 812
+L66: .string "wbgv"
+L67: .string "reuaaggwvqvlkwuiozx"
+jsr *r2
+L68: .string "as"
+L69: .data -523
+add *r1, L11
+L70: .string "ut"
+L71: .data -414
+L72: .string "rnalazrbkuwjskvxcpqpmrnv"
+L73: .string "ymfieppgaalrrxv"
+add *r3, r7
+L74: jsr *r6
+L75: .string "tgb"
+not r6
+L76: .string "pngd"
+L77: .data -242, 718, -862, -706, 447, 712, -745, -682
+mov #156, L143
+L78: .string "gihdcko"
+L79: .string "zuqefuozwki"
+L80: .data -701, -282, -924, -668, 435, 504
+L81: .data 990, 665, -95, -598, -455, 307, -293, 889
+L82: .data -421, 789
+L83: .data 201, 277, 656, -110
+; comment
+; comment
+mov #-90, r7
+L84: .string "yimqehndqamqfsbj"
+not L74
+inc r7
+L85: .string "enzsilrkd"
+red r5
+add *r5, r3
+jmp *r5
+not r2
+L86: .data -166, -642, 69, 505, -967, -805, 535
+lea L74, r2
+L87: bne *r2
+rts
+clr r3
+sub L238, r2
+L88: .data -653, -962, 271, -37
+L89: .data -56, 432, 362, 93
+mov *r0, r3
+not L231
+L90: .data -784, -246, -528, 382
+L91: .string "fksidgedfvo"
+L92: .string "gftejmtjdq"
+L93: .string "ujngnptq"
+L94: .data 16, -632, 8, -513, 577
+L95: prn L61
+L96: lea L18, r2
+sub #228, r6
+add *r1, *r4
+L97: .data -93
+jmp L10
+L98: .string "wnhb"
+add #-1, L265
+; comment
+red L294
+L99: .string "dxnkqbzr"
+L100: .data 565, -411, 133, 502
+stop
+L101: .string "cydjngbltlvdbzgeyx"
+L102: .data -73, -284, 542, -565, -553
+L103: stop
+L104: .data -291
+L105: .data -235
+lea L7, r2
+L106: .data 480, 679, 503
+jsr L106
+stop
+L107: .data -996, -288, -585, 118, -479
+L108: .string "wbuwarakz"
+L109: .data -351, -387, -375, 954, 763, 215
+L110: .string "ffepucrntqncydt"
+add r5, L283
+L111: .data -238, 562, 318, 782, 591
+L112: .string "twxnlfdvagxuxmswoplszfre"
+L113: .data 235, -363
+; comment
+L114: .data -583, 782
+mov r1, *r7
+L115: .data 221
+L116: .data 798, -883, -545, 124
+L117: prn L272
+L118: .string "vvrhtbte"
+L119: .data 529, 636, -843, -819, -649, -487
+bne *r2
+L120: .string "maukwdtixzofezwmuphvq"
+L121: jsr *r0
+L122: .data 249, -990, -797, -522, 649
+L123: .string "mgrrhbrvfbrkzqeneyn"
+cmp r7, #143
+red *r7
+L124: .data -854
+rts
+L125: .data -877, -468, 918, -845
+L126: .string "otciuvolathnc"
+L127: .data -369, 14, 203, -672, -853, -751, -861, 411
+L128: jmp *r2
+; comment
+L129: .string "rjifgvzz"
+L130: .data -260, -90, 227, 888, 369, -294
+L131: .string "dbhblkyhqqtelnwillh"
+rts
+L132: .string "ksivvmkxolmwunbrs"
+; comment
+L133: not r1
+prn L150
+L134: .string "wbmprspehhbbdrs"
+L135: red r1
+stop
+L136: .data 742, 874, 18, -573, 968, -639
+L137: .data -121, 319, -451, -258, 151, 996, -627, 73
+L138: not r6
+L139: .data -290
+L140: .data 781, 678, -65, 413, -743, 405, -524, -377
+L141: .string "drmqa"
+L142: .data 544, -543, 388, -35
+L143: inc *r5
+clr r4
+L144: .string "vhpzupbcxzf"
+
+L145: .data 525, -601, 758, -515, 852
+rts
+inc r2
+L146: .string "dpfmnwfdoesjjkx"
+not L293
+mov r2, r2
+L147: .data -62, -447
+L148: .data -487, 229
+L149: .string "igtjywbqqizh"
+L150: .string "u"
+L151: .data 209
+L152: .data -894, -675, 411, -745, -10, -43, -41
+L153: .string "mdwaskbptvbmrux"
+mov r4, *r2
+L154: .string "lkaapmmifbhjglbyusqosvx"
+stop
+L155: .data -17, -597, -89, 646, 899, 329, 894, 971
+L156: .string "pyvvqakqeyuvdgxbsoh"
+lea L4, r4
+add L259, r6
+L157: mov *r0, L152
+L158: .string "dibdlubantvyshjuvzdpbfb"
+L159: .data 997, -288, 569
+not *r0
+add r5, L105
+L160: .data -456, 297, -802, 495, 298
+L161: red *r0
+L162: .data -93, -399, 158, -293, 417, -550, -659
+L163: .data -933, -725, 929, -636, 298
+L164: sub #208, *r4
+L165: .string "rtksmvwwackyjm"
+sub #29, L218
+L166: mov r5, *r6
+L167: .data 6, -491, -120, 796, -180, -17
+L168: mov r1, *r6
+prn r7
+not r7
+L169: .data -730, 515, 753, 900, 129, 158
+L170: .data 897, -862, 425, 629, 204
+L171: .string "ettwroclbtlenveviipa"
+dec *r1
+cmp *r4, r4
+clr L239
+; comment
+L172: .string "izzpaatbjallidql"
+L173: not *r1
+jsr *r2
+L174: .data -873, 128
+L175: .string "vloyrehcncbrxazzdeykdzu"
+cmp #201, r0
+L176: .string "g"
+not *r4
+rts
+rts
+L177: .data -430
+L178: .data 495, 709, -506, -357, 820, -127
+L179: .data 505, 485, -551, 412
+stop
+prn L23
+L180: .string "xcbgbkgjmxzq"
+L181: .data -334, -183, 278, 307, -911, -890, -525
+L182: .string "qmqo"
+L183: .data 915, -416, -204, -226, 286, 586, -850, 562
+mov L320, *r3
+prn r4
+L184: .string "zit"
+red *r2
+clr *r3
+L185: .string "naqtdiffvyjlsbhdarxr"
+L186: .string "pfgidetshemvz"
+L187: .data -557, 359, -767, -669
+L188: bne L249
+L189: .string "hwd"
+not *r5
+L190: .data 988, 713, -460
+L191: .data 332, -631, -19, -508, 524, 324, 492
+mov L25, *r1
+L192: .data 460, 919, 361, 390, 88
+L193: .string "fquxgqbrblydmoigtdot"
+L194: .data -890, 73, 332, -52, -308
+jsr *r1
+L195: .data 398, -146, -895
+stop
+L196: .data -974, 224, 238, -801, 357, 439, 506
+L197: .string "fzaovnkeflvopefpp"
+; comment
+L198: .string "fzakysxryfx"
+add L251, L229
+L199: .string "zjb"
+jmp *r6
+L200: .data 548, 313, 585, -670, 24, 147
+L201: .data -762, 864
+rts
+L202: mov #-227, r7
+L203: .string "br"
+prn #158
+sub *r4, r1
+L204: .string "uhzbgtmgxovvy"
+L205: .data -591, 601
+prn r2
+L206: .data 148, 813, 498, 320, -519, 981, 761, 31
+L207: .data -824, -648, 894, 684
+mov L305, L42
+clr L61
+sub r1, r3
+L208: red L270
+jmp L104
+prn *r3
+L209: .string "r"
+L210: .string "eroyurkzivvlajpx"
+L211: .data 470, -18, -52, 159
+L212: .string "eoqn"
+L213: .string "zojzkrljsepvearuftzmamy"
+jsr *r4
+L214: .string "fkarpqvhipgzjtkn"
+L215: .string "bqhhvvul"
+sub *r5, r5
+L216: .data 362
+L217: .string "nc"
+L218: .string "bapz"
+stop
+L219: .string "wuckbslmiayeqeu"
+lea L200, r1
+L220: .string "e"
+L221: .data 774, 58, 901, -520
+L222: .data -913, -302, 54, 335, -344, 199
+L223: .string "ggyrt"
+
+L224: .string "qlbssravtcm"
+sub #-27, r4
+mov #218, *r7
+L225: .data 336, -257, 283, -447, -653, -173, -538
+lea L77, L109
+L226: .string "yvoynstceuyhbljyy"
+L227: .string "gionwfbjvuazbxpwiiiuepdr"
+L228: .string "rgihvxfrdtcqhrwcxgg"
+stop
+L229: .string "ipbykmahcjpyniqodz"
+L230: .string "bdnnj"
+L231: clr *r5
+L232: .data -93, -899, -841, 212, -163, 607, -393, 872
+L233: .data -971, 992, 440, -326, -361
+rts
+stop
+dec L136
+L234: not L311
+L235: cmp L240, *r4
+rts
+L236: .string "aizurzxzvznihf"
+lea L267, L285
+L237: .string "fydwozmzgkau"
+L238: prn #94
+L239: .string "rtvnmyqmwathgdzgmv"
+jsr L41
+prn L267
+jsr L51
+L240: .data 426
+L241: .string "ngohqnzzj"
+L242: .string "ozkbt"
+L243: .data 872, -508, -564, 975, 462, -759
+L244: .string "sddruftevjfkrgv"
+L245: .string "hgjyozeyzsbifplynvnixhp"
+clr r5
+L246: .string "fwsccicawmtmaxrhano"
+; comment
+L247: .data 753
+
+L248: .data 251
+L249: .string "qwulawgelds"
+L250: .data -24, -512, 305
+L251: .data -764
+lea L18, *r2
+L252: .string "udvmrqlxiwjwioltqcqjuu"
+L253: .string "idwhqlehybawshgxejijuuy"
+L254: .string "ssvst"
+stop
+L255: .data 284
+L256: .string "zrbbuewrdtxlmizcbdecg"
+L257: .string "as"
+L258: .data -51, -912, -919, 646, -108, -576, -809, -832
+dec *r3
+jmp L267
+L259: .data 842, -981
+L260: inc r2
+L261: clr r3
+L262: .string "r"
+inc r3
+L263: .string "bvyocwljbhrj"
+L264: .string "nyi"
+prn #152
+bne L52
+L265: .string "xwcnbvclltjlbxijjccg"
+L266: .string "agexk"
+L267: .data 924, -294, 804, 750, 617, -204, -938
+L268: .string "nnv"
+L269: .string "njhsopv"
+L270: rts
+L271: .string "vebl"
+L272: .data -64, 726, 805, 368, 716, 950
+mov #65, r0
+cmp #179, L9
+L273: .string "mpbskqbowycygmtsffkjq"
+red L31
+L274: .data -290, 176, 741, 483, 876
+clr *r0
+lea L274, r6
+red *r6
+L275: .data 832, -724, -18, -879, 144, 827
+jmp *r3
+L276: .data -561, -976, -737, -71, -780
+L277: .string "hitqaicalmqof"
+dec L192
+L278: clr *r3
+L279: .string "zlcmv"
+L280: .string "koswnv"
+L281: .string "bizufyulhisodz"
+L282: .data 894, 248, 410, -119, 898, 205, 981, 229
+L283: .data 738, -183, -49, 142, -373, 257, -553, -999
+L284: .string "lnidhjovbxqcdfk"
+L285: not L306
+inc r5
+L286: .data 648, -360, 425, -184
+L287: .string "bzvmscsbtu"
+L288: .string "ulqrtcvpuim"
+L289: .data -967, 370, -495
+L290: .string "aywfqdnq"
+L291: .data -80, -622, -594, -830, 138, -670
+L292: .string "dnfcivcctrla"
+L293: .string "qskmndnqmyualbbndmttafz"
+prn L303
+L294: .string "unmsawjodqstemdcred"
+L295: .string "noyhylcqgrpnjl"
+prn L317
+bne *r2
+
+L296: .data -791, 154, 955, -361, -397, 233, 954, 218
+L297: .data -681, 586, -127, -582, 832
+mov #-156, r2
+red L315
+clr *r0
+L298: .string "jphraaejwvxspcikpvzikcmr"
+L299: .string "uscnjmodglocrhrizptycrk"
+bne L153
+add #159, r7
+L300: .data -145, 366, -996
+L301: .string "vuibznabevcqjzag"
+L302: .string "hlcv"
+L303: .string "rdjzdsdwwkvldlosdhslcyd"
+L304: .data -58, -58, -797, -930, -953, 196, -654
+L305: .string "iylrvowmdvyhqpvydxbknlff"
+jmp *r6
+L306: .string "e"
+cmp *r2, r7
+
+L307: .data 509, 54
+bne *r2
+L308: .string "bwecyqrclodps"
+L309: .data -480, 117
+L310: .data -714, -137, -911, 605
+L311: .string "nsluuqkvsmzvbved"
+L312: .data 367, 464, -537, 809
+L313: .data -571, -962, 973
+sub L315, *r0
+L314: sub *r1, r3
+L315: jmp L121
+L316: .string "sbdcyofpnrdd"
+L317: .data 809, -631, -275, -527, -456, -386, -907, 854
+inc r6
+rts
+L318: .string "pqonoxlzxmwzxbwzlcnrv"
+L319: .data 424
+L320: .string "yevtxfttgdrdwwcbbm"
+stop
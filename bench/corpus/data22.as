@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 23
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .string "autia"
+L1: .data -588, 210, -283, 167, 790, -578, -2, -626
+prn *r1
+L2: .data 282, 786, 128, 152, 501, -837, 46, 55
+L3: sub r3, r7
+L4: cmp L0, #26
+L5: .string "xoey"
+L6: .data -9, 125, -96, 290
+stop
+rts
+jsr L1
+stop
+L7: .string "simfkjvfaeypr"
+inc L279
+L8: inc r2
+L9: .string "qyxkfyzbkcfyce"
+L10: .string "zr"
+
+sub *r6, r3
+prn *r4
+L11: .string "jlzfyjfba"
+L12: .string "earpaqsdwfskoitb"
+L13: .data 802, 248, -793, 331, 109, -254, 627, -258
+clr r7
+L14: .data 860, 124, -121, 161, 635, -281
+cmp L13, *r5
+L15: .data 331, -338, -870, -417, -355
+L16: .data -231, -573
+L17: .string "tv"
+cmp L9, #-249
+sub r4, *r7
+L18: .string "eqvaaxjjbsgvfcltkhxue"
+mov #122, L106
+clr *r0
+mov r1, L10
+L19: .data 617, 402, 760, -832, -214
+L20: .string "twoinysah"
+L21: .string "x"
+red *r1
+L22: stop
+L23: .data 291, 852, -788, 698, -828
+L24: .data 130, -233, 872, 341, -154, 260, 115, -586
+L25: .string "bw"
+add #129, r3
+L26: .data -949, 365, -686, -683, -765, -712, -105
+; comment
+L27: .data 854, 464
+L28: .data 114, 350
+stop
+
+L29: .data 575, 167
+L30: .data 968, 374, 627, -424, 445, 133, 971
+L31: .string "zqrqbqbhjftsyc"
+L32: .data 697, -707, 870, -614, 473, -47
+L33: .data 20
+dec *r6
+not r5
+L34: .data -757, 925, -857, 608
+not *r6
+L35: .string "xkiwnmnhpkqwfth"
+L36: .string "ytoqjspvypln"
+L37: .string "fjqahyovmbnkbodxvdisd"
+dec r7
+L38: .string "ljcirmoe"
+L39: .data 331, -194, -714, -602, -342
+clr r3
+L40: .string "jsast"
+L41: .string "udnmhe"
+; comment
+L42: .data -497, -87
+L43: .data -778, -11, -763, 196, 731, 842
+L44: .data 216, 88
+L45: .string "nbjrdtg"
+; comment
+inc r1
+jmp L44
+L46: .string "pngtjolmlbklrcsum"
+L47: .data 923
+L48: .data 495, 425, -980
+add r4, r3
+sub L46, *r2
+L49: .data 724, 173, 429, -622, -771, 642, 59, -467
+dec r1
+mov *r4, *r4
+L50: .data -40, 32, -353, 175, 793, 213
+L51: .string "eshyoztbtmq"
+L52: .data 598, -63, 89, -257
+L53: .string "sohqzfssbmwkjzcxnlnpztk"
+L54: .string "rqwngbemalr"
+L55: .data -145, -19, 726
+lea L132, L285
+L56: .string "gcdqu"
+sub #150, L39
+
+L57: .data -99, 721
+clr r3
+L58: .string "grtgdpvlkqdxmjb"
+red *r0
+L59: .data -202
+L60: .data 656, 132
+L61: .data -309, 784, 306, -442
+lea L40, r7
+L62: .string "prutkapkypy"
+L63: .string "wpnlunlklzedam"
+L64: .string "xryqlxlrbx"
+L65: .string "hossm"
+L66: lea L275, r0
+L67: .string "koaehaphpvknsn"
+L68: .data -27, -756, 472, 518, 50, -791, 598, 570
+L69: .data -331, -866, -482, 22, -818
+lea L74, L112
+L70: .data 364, -851
+jmp L75
+L71: .string "muqwnlqaylcfnzqaabmnnijy"
+L72: .string "poimtcgrvjdhgmmjjyskmzqy"
+mov *r6, L29
+L73: .data -376, -207, 306, 134, -497, -887, -567, 137
+L74: .data 30, -648
+sub *r6, r5
+L75: .string "gzagrlvlnmp"
+L76: .string "obvde"
+L77: .data 660, 663
+L78: .data 29, -200, -702, 124, 135
+L79: .data 589, 91, -65, 849
+L80: .string "bmvdetrzjc"
+L81: .string "xomk"
+L82: .data 884
+mov #-49, L20
+L83: .data -222
+L84: dec r6
+L85: .data 194, 370
+L86: .string "jcrdnlj"
+jmp L80
+dec r2
+L87: .data -842
+L88: .string "lpyzhiklknhfc"
+L89: .string "cxg"
+not r4
+L90: add r0, r2
+L91: jmp L303
+L92: .data -682
+L93: .string "cdcccrjvumbbmoptcpxl"
+L94: prn #-21
+L95: .data 287, -620, -753, 96, 202
+L96: .data -76, 1, 659, -14, 4, -185, -133
+L97: .string "ysrlr"
+prn r7
+L98: .string "ytmr"
+L99: jmp *r1
+L100: .data -313
+sub #122, L99
+L101: .data 965, -111, -578
+L102: .data 43, 905, 32
+L103: inc L136
+jmp L218
+L104: .string "dvmxtecxpkwt"
+L105: bne *r6
+not *r6
+L106: .string "dhjmvrybxpptygnqx"
+L107: .string "ggenhuhdufpiktqfri"
+sub r4, r0
+red r0
+add L168, L278
+L108: .string "kahaeeuyjpl"
+jmp L303
+L109: .string "xotyjhihtflkzvhykktwxchg"
+jmp *r1
+L110: .string "usvlzo"
+bne *r7
+L111: jmp *r2
+L112: inc *r2
+L113: .string "w"
+rts
+L114: .string "o"
+jsr L329
+L115: .data 50
+L116: .string "dbdjvtjntcmmi"
+lea L12, r0
+L117: .string "rilemjq"
+L118: .string "jcqwqib"
+clr L228
+L119: .data 911, -203, -167, 99, 755, 650, -285
+L120: .string "zssrpmtecpqpbcs"
+L121: .string "xslnsdvlr"
+L122: .string "e"
+L123: .data -789, -852, 103
+L124: .string "ebytgvgltqaqliwbo"
+mov *r7, L74
+bne *r3
+L125: .data -142, -706, 670
+L126: .string "qanlxbnrmohcmtmoyxtruvzq"
+L127: .string "qjjcdylahzuoap"
+red r0
+L128: sub r0, r3
+L129: .data -149, 238, 154, -858, 441
+add *r2, r4
+L130: .string "wfxfpuuyqej"
+jsr *r2
+L131: .string "tif"
+L132: jsr *r0
+L133: .data 928, 75, 576, -422, -175, 362, -716, 897
+mov L68, *r7
+L134: .data 361
+L135: .string "zwidpmfeqxpahjmtjxcpg"
+L136: .data -477, -588, 356, 561, -233
+inc r6
+bne L302
+cmp r3, *r3
+rts
+L137: .data 48, -150, 498, 398, -366
+dec L201
+L138: .data 361, 24, 742, -711
+sub L108, *r5
+L139: .data 197, 121, 326, 963, -558, 842, -113, -749
+L140: .data 791, 798, -269, -637, -725, -443, 953
+L141: .data -52, -928, -160, -504, -491, -245
+L142: .string "anwqwnihlzumexwqjm"
+mov *r0, r6
+L143: .data -574, -177, -114
+prn *r5
+L144: .string "hlsqrcaryj"
+L145: .string "ozyymjesdyasoloipznewvht"
+L146: .data 550, -86, -54, -52, -506, -777, -175, 983
+L147: rts
+L148: .string "lisrbaajvynhey"
+L149: .string "gkel"
+L150: .string "vabcbbxyynnolqz"
+jsr *r2
+mov L221, *r7
+L151: .data -377, -901, -320, -104, 28, 322
+L152: .data -210, -433, 463, -982, -551, -464, 949
+stop
+L153: .string "bgzhqbkhhpy"
+L154: .string "nbdiibr"
+L155: .data -875, -702, -175, 885, 770, -846
+L156: .string "yaneviximgxzwx"
+L157: .string "unyzulcyxzudko"
+L158: jsr L234
+L159: .string "zccjpymvysvy"
+L160: jmp *r2
+L161: .data -367, 270, -253, 476, -112
+L162: .data -509, 703, 11, 30, 126
+stop
+L163: .string "jkpbptuchuuafaihlbfaa"
+rts
+L164: .string "fawonrvhuj"
+jmp L231
+bne *r5
+L165: .string "navwiob"
+L166: .string "m"
+mov r4, r6
+L167: .data 918, 198, -641, -88, 901, -986, 539, 69
+lea L195, r5
+L168: sub #180, r3
+L169: .string "gkewm"
+L170: .data 41, 948, 787, 119, 702, 703, -797, -845
+prn r4
+L171: .data 620, 861, -568, 841, -164, 824
+prn *r4
+L172: .data 652, 609, 619
+L173: .data -263
+cmp *r6, L210
+dec *r4
+L174: .data 2, 930
+L175: .string "oiitvjgq"
+jsr L324
+cmp L254, L245
+L176: .data 967, 546, -327, -229, 823, -324
+L177: .string "veftn"
+prn L221
+L178: .data -285, -472
+L179: .data 193, 69, 506, 18
+
+L180: .data 396, 850, 202, -929
+L181: .string "tyjoqxqvyla"
+L182: sub r4, *r6
+L183: .string "flyzygqovpxu"
+L184: .data -249, 982, -153, -613, -339, 207, 124, -907
+L185: .data 324, 154
+red L177
+red r1
+L186: jsr *r5
+L187: .string "rhtgnxnjjyqdasuk"
+L188: .string "gowchrelicytvjdaxj"
+rts
+L189: .data 320, 418, -215, -697, -787, 76, -411, 156
+L190: .data 160
+L191: .data 738, 105, 406
+dec *r4
+L192: .data 348
+L193: .data 89, 243
+L194: .string "phybklssvuwkdqczrj"
+L195: .string "zgidtzulpufeuelqnfzbmau"
+L196: red L192
+L197: .string "kuxzjdb"
+L198: .string "butqop"
+L199: .data -973, 515, 486
+L200: .data -614, -341, -890, -322, -803
+L201: .data -295, -561, 877
+L202: .string "jtfxbcnqsugyaymfsrv"
+add #223, *r5
+inc L119
+L203: .data 232, 574, 794
+L204: .string "kvp"
+L205: .string "jrtsrklggxry"
+L206: .data 330, -624, 549
+L207: .string "zmqvapofufwuruuv"
+L208: .string "oobojcggn"
+L209: .string "ycpkamnrghspkmz"
+L210: .string "flolmbntnbtf"
+L211: .string "noxljvqxuhhknlbrfjojjy"
+L212: .string "lmszhjhmxt"
+L213: .data 815, 747, 578, 475, 821, -530, 366
+L214: .string "xswbuhwsjyvrcxbbnix"
+L215: .data 517, 884, -488, 22, -791, 164
+L216: .string "stez"
+L217: .string "mkskhimcgxontqpcrqlyi"
+L218: .data -30, 658, -222
+L219: .data 299
+L220: .string "njigbqkrsykehb"
+L221: .string "houoesphsyeo"
+inc r2
+clr *r3
+clr r6
+L222: .string "fzdfuvmykcloyaojqs"
+L223: .data -960
+L224: .data -427, 617, 611
+L225: .string "hydqsze"
+L226: .string "qivtvnfyr"
+; comment
+stop
+L227: .string "kjoucjsakrvbhbdfmpgbb"
+bne *r1
+jmp L102
+red r3
+mov #168, L66
+L228: .string "olqnfcdfsvovmk"
+L229: .data -615, -462
+L230: .data 60, 808, -954, 668, -445, -360
+L231: .string "hdwpqyrmqfepmfelqapomqk"
+clr r4
+rts
+prn #127
+rts
+L232: .string "vsgvuv"
+L233: .data 211
+L234: .data -810, -855, -66, -669
+L235: rts
+L236: .data 894, 232, -323, -89, 905, -755, -796
+L237: .data 112
+L238: .data 483, -53, 282, -612, -17, 223, 133
+L239: .string "dfvqywswblhrpcpabxteoev"
+L240: .string "cov"
+L241: .data -130, -395, -275, -809, -608, 19
+L242: red *r2
+add L201, *r1
+L243: bne *r7
+L244: .data -761, -621, -429
+L245: .data -614, -477, -708, 223, 318, 749
+L246: .string "eiqqomryyyrtwrlsmza"
+L247: jmp *r1
+L248: .string "nbdsphkdahvgajxzynbmdnel"
+L249: .string "pietnvynts"
+L250: .string "uhyhtfhnfdaoinsouom"
+L251: .string "ywrluo"
+L252: .data -734, -585, -3, 554, -676, -648, 601, -305
+L253: .string "nmaksh"
+
+jsr L306
+L254: .string "xsvepkvrwgwoyfpaesgiq"
+
+; comment
+add L322, L167
+mov *r5, r0
+L255: .data -119
+L256: .string "tkedug"
+bne L130
+bne L259
+L257: .data 916, -955
+stop
+L258: .string "hedbgj"
+L259: .data 296, 367, -928, 291
+L260: .string "ijmvxyzngx"
+L261: sub r2, r1
+L262: .data 760, 766, -625, -560
+L263: .string "aiowjcyjmvo"
+L264: .string "qtpmgzfhcmdkgkldifcehhbi"
+not *r3
+L265: .string "stbglpcyew"
+lea L179, *r3
+rts
+L266: bne *r0
+L267: .string "ijnh"
+L268: .string "makd"
+L269: .data -459, -556, -327, -708, 669, 58, -123
+L270: .string "nrocpymdvgvipcspezj"
+L271: .data 293, -342, -364
+L272: .data 638, -40, 449, -545
+L273: .data -434
+L274: .data -214, -212, -992, 734, 548, -401, -299
+L275: .string "cadlffuvfa"
+L276: .string "iwftyatqmtqnnxyltde"
+L277: .string "ikpwjgahbsi"
+L278: jmp *r6
+L279: .data 952
+inc r3
+L280: .data -864, 292, 855, -706, 643, -16, -529, 834
+L281: .string "tytroqxhnd"
+bne *r7
+L282: .data 843, 37, -661, 971, 928, -966
+rts
+dec r5
+prn #74
+L283: .string "nbjyrijdmqouliazrtsm"
+inc L307
+L284: .string "alyvieyhx"
+L285: .string "xbljonrpylbpd"
+L286: .string "xyouerzdcbwvqnmahcp"
+red r7
+bne *r3
+L287: .data -528, -855, -347, 64, -990, -163
+; comment
+prn #49
+L288: .string "ohvyjpux"
+L289: .data -991, 129
+rts
+L290: .string "rcjp"
+L291: .string "enwnuhmdivgbivz"
+L292: .data -769
+L293: .data 827, 356, 542
+L294: .string "rdlltrqarhqklsdhjw"
+dec L138
+L295: .data 896, -646, -805, -712, -367, 931
+L296: .data -974, -279, -966, -780, -58, -978
+bne *r6
+L297: .string "mvvydvxidjzdhcewppdjmrk"
+L298: .string "xgixoae"
+bne L320
+L299: .data 111, 56, 205, -928, 959, 90
+red L326
+; comment
+; comment
+lea L175, L307
+L300: .data -57, -944, 919
+not r3
+inc L9
+stop
+L301: prn *r5
+L302: .data 547
+inc *r5
+jmp L257
+lea L309, r5
+L303: jmp *r6
+L304: add #107, *r0
+L305: .string "qgctrnlhjix"
+L306: .string "wzkeiohgil"
+L307: .data 870, 567, -887, -450, 975, 840, -158, -265
+L308: .data 651, 872, 64, 86
+jsr *r3
+L309: .string "djy"
+sub r3, r4
+L310: .string "z"
+clr *r6
+L311: .string "ihpwchfwvvvxalpcyc"
+stop
+L312: .data 928, -219
+L313: .data -611, 298, -970, -456
+L314: .data 25
+inc r5
+; comment
+L315: .string "usgxitqcjtzvomlmrkunqn"
+jmp L324
+L316: .data -770, 233
+L317: .data 906
+L318: .string "v"
+red r5
+jmp *r0
+L319: .data 392
+L320: .string "irrzgppmjmwceso"
+jmp *r5
+not L101
+bne L165
+cmp r1, r1
+add L3, L321
+L321: .string "rprpanljhktwrwbgzkbmj"
+sub r4, *r1
+L322: .string "jckog"
+L323: bne L327
+not L248
+L324: .string "smkbqmstaaobtyd"
+L325: .data 348, 84, -783, 706, -351, -625, 84, -438
+L326: .data 512, -635, -720, 36, -665, -858, 928, -197
+L327: .data -26, -305, 671, -899, -227
+L328: .string "oxixbw"
+L329: .data 818, -448, 414, -739, -666, -364
+L330: .string "pubrclueulmr"
+not L331
+L331: .string "ufdhuziejxhm"
+dec r5
+cmp r4, L231
+stop
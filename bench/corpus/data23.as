@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .data 185
+lea L307, *r4
+L1: .data 223, -488
+L2: .data 618, 62, -256, 308, -61, -55
+sub #-226, L310
+prn r5
+L3: jmp *r0
+L4: add r4, *r7
+L5: .string "ecjxzokpqulhaecbsokl"
+L6: .string "setvgnkkkclduhqcxvgzddiq"
+sub #-217, r7
+L7: .data 359, -486, -255
+L8: .data 669, -150, -923, -17, 393, -79, -986, 921
+L9: .data 367, 525, -584, 485
+L10: .data -61, 130, -913, -521, -351
+L11: .data 747, -431, 800, 872, -653
+L12: .data 527, -252, 165, -691, -371, 157, -810
+L13: .data 23, 330
+L14: jsr *r3
+L15: .string "elyszbbyopsqzxo"
+L16: .string "ubhbnyeqnkgt"
+L17: .string "ebpqlqskhevfbgufqz"
+mov L40, L8
+bne *r1
+L18: .data -789, 207, -618, 955
+L19: .data 710, 921, 708
+L20: red L13
+L21: .string "vfrf"
+L22: .string "rcsrdbyfzsrffohszqhan"
+L23: .data 776, -884, -643
+stop
+L24: .string "zpebwjtzyztpm"
+L25: .string "xbofuayueczxdmahnmqcfw"
+inc r2
+L26: .string "i"
+L27: .data 676, 407, -721, 144
+L28: .data 103, -26, -808, -625
+L29: .data -125, -374, 512, -227, -222
+L30: .string "uokpsgkxjpf"
+mov #-153, L304
+add L22, *r6
+jmp L172
+stop
+L31: .string "h"
+prn r6
+clr L85
+L32: .string "qjoiebgduf"
+L33: .data 661, 356, -713, 743, -876
+L34: .string "exeuuypndnqkjbhyqspyrkf"
+L35: .string "opynmvjjhmll"
+L36: prn *r6
+L37: .data -826, 516, 165, 965
+L38: .data -684
+L39: .string "rsyjeolsrakdrhnsc"
+stop
+L40: .data 230, 563, 615, -171, 86, 864, -820, -647
+mov L21, r0
+L41: .data 806, -463, -329, -398, 745, -35, -170, 451
+inc L40
+
+L42: .string "vfpdp"
+L43: .string "tpgtmrxniago"
+L44: .string "avaywbosffgqbcwkuaefnxih"
+prn *r3
+L45: .string "hyjcyzvnboggmxbuzpzrfsju"
+; comment
+dec r7
+L46: .string "dwtsnvdddxgpfpnxnwpof"
+L47: .string "ebfrlymdl"
+jmp *r7
+; comment
+L48: .data 344, 917, 785, 577, 760, 837
+L49: .data -171, 388
+L50: .data -415, -263, 566, 181, 47, 821, 679, -788
+dec *r3
+L51: .string "xlxpowxmijuelmfpniwwirp"
+
+L52: .string "aondrsqra"
+L53: .data 831, -445, -481, -690, -576, 17, 149, 795
+add #83, *r5
+L54: prn #234
+L55: .data 502, -654, 778, -49, -265, -110
+add #252, r1
+L56: .string "xihgmnemlzkk"
+L57: .data 486, 30, -159, -155
+jmp L21
+dec r4
+jmp *r4
+not r6
+L58: .data 254, -797, -977, 531, 551
+L59: .string "azprbk"
+L60: .data -74, 21, 385, 347, -926, 132
+not *r5
+L61: .data -124, 523, 900, 33, -659, -872
+clr *r7
+L62: .data 866, 591, 414, -620, -17
+sub *r4, L92
+L63: .string "ngpgzwpvqomxdtprgkmbtpc"
+L64: .string "mcckovmxxpwbxqwhbbqt"
+L65: add r2, L15
+L66: .string "inowpnxnst"
+L67: .string "khptih"
+not r4
+not *r6
+L68: .data -843
+jmp L157
+bne L204
+prn L51
+L69: .string "eibuqmzzzjejypohwzu"
+L70: .string "bxatwz"
+not *r2
+L71: .data -140, 869, -365
+prn #185
+dec *r0
+L72: .data 802, 13, -208, 281
+jmp L104
+red *r6
+L73: .data -586, 92, -442, -851, -871, 868, -710, -416
+L74: .data 54
+lea L30, L316
+L75: .string "xcbefdfq"
+L76: .data -312, -144, 870, 51, -115, -164
+L77: .string "igruvhmlmhltotlewiv"
+L78: .data -799, 823, 865, 799, -96, -702
+L79: .data 185, -466, -887, 663
+L80: .data -567, -584, -279, -210, -776
+red *r7
+; comment
+L81: .data 724, -185, -894, 49, 245, -89
+stop
+add *r7, r3
+bne L46
+prn #84
+jmp *r4
+prn r1
+L82: .data 631, 565, -721, -445, 656, 102, -611
+L83: .string "qybhofsdklqffnihaoyxknvk"
+L84: .string "de"
+L85: .data 585, 538, 954, -393
+L86: .string "dmzdxmxwcjhe"
+jsr *r1
+L87: .string "esaczharhsusxmsuhaupcs"
+mov #-46, *r6
+L88: .string "xshtflhnxkqokw"
+L89: .data 880, -217, 566, 720, 634, 571
+cmp #62, r5
+L90: .data -791
+L91: .data 568, 892, -255, 704, 498, 593, -910, -702
+L92: .data 780, 803, -373, 598, -780
+L93: .data 257, 440, 213, -578, -672, 816
+L94: .data 801, -45, 753, -603, 447, -278, 871
+L95: .data 915
+L96: prn #-13
+L97: .string "se"
+L98: .data 575, 197, -42, 628, 637, -381
+L99: .string "zzilnuctusozuenhkvqojsf"
+rts
+L100: .string "hedeb"
+L101: .data 479, 364
+; comment
+L102: .string "a"
+L103: .string "vgghgftegi"
+L104: .string "q"
+L105: .data -978, -179, -496
+L106: .string "ouabdtomgdophpjjkxqqxxle"
+L107: .string "bwhipqg"
+L108: .string "rmqtbvhgmktxfm"
+L109: .data 393, -944, -345, 83, -639, 799, 237, 873
+mov *r2, r0
+dec L140
+dec L322
+L110: .string "mkmxld"
+L111: .data 869, 139, 547
+dec L287
+dec L62
+L112: .data 592, 365, -945, 97, -605, -721
+rts
+L113: .string "ifpkqkqghgqifg"
+L114: stop
+L115: .string "jhefoggoggmowaaqhqedy"
+L116: .data -411
+L117: .data -538, 691, 47, 57, 446, 416, 980
+L118: .data 553, -69, 853, -251, 594, 246, -285, -292
+L119: .data 229, -430, -308, -336
+L120: dec *r3
+not L78
+add L47, L24
+L121: .string "ahvmjwdocouipiurkzxhwq"
+sub L130, r4
+lea L54, *r5
+jsr *r4
+L122: .string "uypq"
+L123: .data 247, 269, -517, -925, 594, -775, 157
+L124: .string "rdprngojxvonphkgxxkolgjb"
+L125: .string "ikqayuu"
+jmp L85
+red *r1
+rts
+L126: .data -935, -604, -249
+L127: .data -185, 908
+L128: .string "qnwcuqjva"
+L129: .string "fvkzfggcumuazfleqknqxeh"
+L130: .data 951
+L131: .string "nknoygobrpu"
+L132: .data 988, 5, -165, 242, 458, 150
+L133: .data 74, 971, -484, 112, 32, 212, 556
+rts
+L134: .data 653, 529, -462, 389, 373, 386
+L135: .string "cwuujxaqepwayvq"
+L136: .data 591, 738, 366, 364, 147
+L137: .data -373, -532, 919, -985, -623, 642, -86, -777
+lea L92, L120
+L138: .string "rgefgayorlmaimwhpvg"
+L139: .string "iklpjrxycllm"
+L140: .string "mgwdnsltwoo"
+L141: .data -894, -735
+L142: .string "hmgoctchykueqqejefd"
+L143: .data 787, 639, 559, 897, -863, 489, -524
+L144: clr L99
+L145: .string "tutfongrzjm"
+L146: stop
+L147: .string "skjdnombtzphjfkovpbpola"
+L148: .data 260, 807, 427, -762
+L149: .data -942, -919
+L150: rts
+L151: mov *r2, r2
+L152: .string "q"
+inc *r0
+L153: jsr *r3
+jmp *r0
+red *r5
+L154: .data -47, -558, -613, -36
+L155: .data 819, 534, -144, 63, 524, 77
+L156: .string "lgjdjpnwkmvx"
+L157: .data -555, -790, -494, -611, 450, 814, -666, 172
+L158: .string "oqlhne"
+
+L159: .data -537
+L160: .data -308, 241, -612, 76
+L161: .string "gdktgoqkcttkm"
+L162: .string "fy"
+L163: .data -336, -58, 311, 868, 573
+L164: .data -65, -777, -783
+bne *r1
+inc L112
+L165: .string "hlmxfagtpuptsphqsq"
+bne L239
+; comment
+L166: .data -882
+L167: .data -205, 732
+jsr L256
+stop
+mov #-256, L146
+cmp *r4, #98
+L168: .data -849, -76, -910, -289, 823, -199, 775, 647
+sub L229, L70
+L169: .data -848, 411
+L170: bne L206
+red *r0
+rts
+L171: .string "ecwqnvssbcbqakxpjtodhghh"
+clr L20
+L172: .string "gwf"
+L173: .data 851, 793, -702, 63
+L174: .data 987
+L175: .data -507, -200, 700, 120, -364, 51, -241
+jsr *r7
+L176: .string "lmsuhbb"
+L177: .data -239
+cmp *r4, L147
+jmp L208
+L178: .data 755, -488, 632, 132, -160, -590
+L179: .data -521, 377, 597, -648, 370, 809, -536, 492
+L180: clr L314
+stop
+L181: clr L316
+L182: .data -190, 58, 786, 121, 747, -937, -805, -114
+
+
+red *r4
+L183: .string "biahvkwnadx"
+L184: .data 396, 477, 705, 649, -274, -5
+inc L16
+L185: .string "ntmaremotehumatdz"
+L186: .data 151, 345, -948, -272, 369, 960, -426
+red L142
+
+L187: .data -170, -876, -433, 346, 57
+L188: .data 929, 198
+lea L244, *r2
+rts
+L189: .data 83, -935, -718, -734
+L190: .data -838, 919, 772
+L191: .string "xlqejwarilbnqoabhzuyjpki"
+L192: .string "sseu"
+L193: .data -272, -859, 167
+L194: .string "szfgyvdlpqyrteifxugvrmkw"
+L195: .string "omqweamokqsjpzwvfhpbttlq"
+L196: .data 929, 838, 451, 402, 843, 991, -524, 883
+jmp *r1
+L197: clr r0
+L198: .data 785
+L199: .data 128, -506
+mov #-114, r3
+L200: .data 335, 881, 758, -280
+L201: rts
+not r4
+; comment
+bne *r1
+L202: .data 655, 841, 117, -148, -529, -133, 759, 357
+L203: prn #-28
+red r1
+clr L245
+L204: .data -274
+not *r6
+red L208
+L205: .data -48, -576, -471
+jsr *r1
+stop
+bne *r7
+L206: .string "iqwrtxqwhw"
+L207: .data -773, 653, 944, -7, 753
+L208: cmp *r3, L174
+jsr *r5
+
+L209: .string "olqtbtnhyyqnxqvermn"
+cmp *r6, *r5
+red r7
+lea L271, L37
+lea L234, *r7
+L210: .string "vefv"
+cmp #-133, L147
+L211: .data 94, 440, 537
+jsr *r4
+L212: .string "fdqitphjjhfccp"
+L213: cmp r2, #-44
+lea L128, r7
+L214: .data 0, -688, -587, -785, 357, 847
+L215: prn r0
+L216: .data 212, -634, -462
+L217: .data 9, 891, -515, -903, -874, 293
+L218: .data 839
+L219: .data -511, -593, 668
+L220: .string "rafjqazpsqzlzguhv"
+sub r2, L255
+L221: .string "uztlcxjueozp"
+L222: .data -205, -723, -582, -143, 744, -607, 214
+; comment
+L223: prn r6
+
+not L116
+L224: .string "lcphdhhwborigkkv"
+L225: .string "hydrfaqgaw"
+add #-203, r7
+clr L229
+; comment
+
+L226: .string "hwrmczvoukesmo"
+cmp L209, L232
+L227: .data -910, 471, -408, 821, -871
+; comment
+add #22, r2
+L228: .data 653, 278, -934, -138
+L229: .string "wmk"
+jsr L127
+L230: .string "iqxkxkeckzlsfdwtiun"
+prn *r0
+L231: .data -667, -800, -439, -252, -66, 10, 198
+prn r2
+lea L149, r2
+L232: .data 602, -276, -292, 617, 598, 230, 607, 10
+L233: .string "so"
+L234: .data -975, -701
+L235: .data -531, -341
+L236: .string "somiffvibkclfgilkquzrklr"
+L237: .data 475, 132
+L238: .string "uxocqi"
+L239: .data -15, 883, 410, -912, 724
+L240: .data 727, -912, 457, 608, 955
+L241: .data -687, -747, -786, 917, 143, -338, -569, 111
+L242: .string "tydqlwlbqjibupfdaomndu"
+inc r6
+jsr *r7
+L243: .string "ih"
+L244: .string "pbfrukutxb"
+L245: prn #-256
+L246: .string "reoxxxkujkyojpamckyhv"
+L247: .data 182, 464, 514, 286, 569, -910
+L248: .string "pnfa"
+L249: .data 462, -349, 137
+L250: .string "iamecbuhrnaduxshtdkws"
+L251: .string "qjur"
+not *r3
+L252: add r4, r6
+L253: .data 609, 2, 708, -810, 76, -181, 274
+L254: stop
+
+L255: .data -874
+L256: .data -297, 830, 323
+L257: .data 681
+L258: .string "dqbsuyrqibbaxn"
+add #176, L139
+L259: jmp *r2
+L260: .data 23, 353, 109, -23, 948, -919, -207, -237
+jmp L66
+L261: .string "jiduvfsha"
+L262: .data 628, -851, 507, -542, -573, 557
+L263: .data -920, 34, 681, 216, -202
+L264: .string "zehxokqpshaoy"
+L265: .data -694, 74, -580, -271, -249
+L266: .string "jnusvknmlirbpgfaxh"
+L267: .string "v"
+L268: .data 547, -441, 356, -593, 276, 330, -379
+L269: .data -53, -176, -652, 227, 140, 882, 330
+L270: .data 450, 954, -118, 704, -869, -376, 682
+not *r0
+jmp *r6
+L271: .data -801, 50
+mov r6, r4
+mov #26, L239
+L272: .string "dlcspavayylncaksjwttdzq"
+L273: .string "yglxjluqlg"
+red *r3
+
+L274: .string "vingbodykeaahglzhrafo"
+L275: .data 609, 256, 583
+L276: .string "ugx"
+L277: .string "miktzlqbeedxnbhxhy"
+L278: .string "borvmauxjtcgpolfd"
+L279: .data -322, 692
+L280: .string "tmegur"
+L281: .data 626, -962, -864, 696, -909, -514
+L282: .data -327, 543, 348, -373, 988, 608, 913
+lea L99, *r2
+L283: .data 954
+L284: .string "innulnzbn"
+L285: .string "oyonjkekjxzbbzawx"
+L286: mov r0, *r3
+jmp *r4
+prn r5
+L287: .string "adqgtkfrureix"
+sub *r0, *r3
+L288: .data 321, -37, 637, 739, -720
+L289: .string "ykhdaheg"
+L290: .data 974, -890, 778, -905, -473, 61, 286, -132
+L291: .string "ybonkmzbah"
+L292: .string "dxviqvzcmtawjdedwwtnsdk"
+L293: sub #147, *r4
+lea L309, L12
+; comment
+L294: .string "yzbvj"
+L295: .data -528, 327, 700, 845, 21, 961, -905
+L296: .data 183, 609, -609
+
+L297: .data 949, -625, 559, -83
+L298: .data 986, 646, 782
+L299: .data 644, -228, 910, 241, 402
+rts
+L300: .data -234, 777
+L301: jsr *r1
+L302: .data -87, -865, -70, -180, 115, -605
+L303: .data 22, 107, -741, 45, -617, 602, -963, -287
+clr L272
+L304: .data -182, 309, 101, -402, 885, 749
+prn *r1
+L305: lea L328, *r7
+L306: .string "mdbh"
+inc L314
+L307: sub #249, r1
+L308: .data 312, 291, -484, 581
+L309: .string "dtzstvvnebaujle"
+lea L328, *r6
+prn r3
+L310: jsr *r4
+rts
+L311: prn r0
+L312: .string "ywdxfrxhthccdohj"
+L313: jsr L323
+L314: .string "qi"
+L315: .string "qeuqifvkmiklygidg"
+L316: .data -127, 902, -262
+L317: .string "ha"
+cmp *r4, *r0
+jmp L97
+L318: .data -493
+L319: jsr *r6
+L320: .data 244, 899
+L321: cmp *r2, r7
+L322: .string "t"
+cmp r7, r6
+jsr *r6
+clr *r3
+L323: .string "nuvkgqiquowcgkdfp"
+L324: .string "znjjwazpmgmimseufgsnx"
+L325: dec *r1
+clr *r6
+L326: cmp L201, r6
+L327: .data 576, -987, -558, 141, 129, 671, -699, 803
+rts
+L328: .data 296, -939, 748, 213, -58, -722, -200, 910
+stop
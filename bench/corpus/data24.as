@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 25
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+clr *r2
+rts
+L0: .string "xjszbcup"
+L1: .string "pmvcpfgqmjyuspyeh"
+L2: .string "oacylzxa"
+L3: .string "qkvmyileohhuhfgqju"
+L4: dec r5
+L5: .string "wdvcwxxrwoaar"
+inc L2
+L6: .string "pnshsagledovxymhtoiurd"
+dec r0
+L7: .string "ybfhvjywvkkcqgsefbaocbim"
+; comment
+L8: .string "fcfszgnvxownatnw"
+rts
+L9: .data 203, 677, -237, 328, 706
+add r4, r6
+clr *r6
+add #-232, L27
+L10: .data -769, 194
+add *r3, L9
+L11: .string "bxeccvcgxfkkbgmfjgnlsnmq"
+L12: .string "iiariigueicfizzqgycltvrf"
+L13: .data 906, 109, 849, -451
+not L12
+L14: .data 377, 716, -126, -799, 861
+L15: .string "soessohuanzuzelmsjofiymv"
+L16: jsr *r1
+L17: .string "haylwnnfmutsfpvorykaltj"
+L18: .string "rcacwephywisqgpn"
+; comment
+red *r4
+L19: .data -981, 966, -482
+sub r4, L4
+L20: .string "cdacacakbj"
+L21: .string "aolwudrtqxgtkjttjrx"
+L22: rts
+L23: .string "jrkrjplmrwlcryojhvsspngj"
+L24: cmp r2, L85
+inc *r4
+not r7
+L25: .string "jftnwssufpzrwzjg"
+L26: .string "ls"
+L27: .data -819, 100, -814, 765
+inc *r6
+mov r7, r4
+inc *r0
+; comment
+red *r5
+jsr *r2
+L28: .string "ct"
+L29: .string "rgtgxqozmsriogrpnb"
+inc r7
+L30: lea L230, L14
+L31: .string "ltn"
+L32: .string "jfgolsqjaapxgpbasxp"
+L33: .string "jkwndammdsp"
+dec r6
+L34: .string "x"
+L35: .data -364, -635, -288, -823
+L36: .string "dzxcfvtsxxekzzebschjcz"
+jsr L227
+L37: .data -766, 881, -18, -48, 225, -220
+L38: .data 602, -119
+red r6
+jsr *r6
+prn *r0
+L39: .string "hagwuia"
+L40: .string "xle"
+L41: .string "mgpouezehdvqvgvbzh"
+L42: .data -404, -589
+L43: .string "edxbxdadcnorzu"
+L44: .string "ugugsilorosuev"
+L45: .data -538, -328, 223, -515, 233, 150, 735
+L46: .data -101
+clr L36
+L47: .string "bolwknoexbzujnei"
+L48: .data 204, -898, 557, 585, 463, -256, -259
+jsr L88
+L49: .data 951, 274, -180, -335, 842, 440
+L50: .string "vtphllvsqcjqimtrcqjlzbd"
+L51: jmp *r3
+L52: .data -599, -367, 237
+cmp #216, *r5
+stop
+L53: bne *r7
+L54: .string "sapzrdotqamx"
+L55: .string "rmie"
+L56: .data -895, -346
+add L13, *r7
+
+L57: .string "pukbhxlskqpvziyvmj"
+L58: .string "tbwsmtsjenehbvswr"
+L59: .data -159, -492, -858, -945, -593, 18
+L60: .data 510, 742, -197, -381
+jmp L56
+
+cmp #151, r0
+
+clr L37
+inc L74
+clr r2
+lea L8, *r7
+red *r1
+L61: bne L42
+bne *r6
+L62: .data -916, 349, -64
+L63: .data 992, -487, -735, -498
+L64: .data 6, -411, -614
+L65: .data -353, -76, -219, 654, 470, 675, 172
+prn #-242
+prn *r2
+cmp L21, L4
+L66: jmp L10
+
+jmp *r7
+L67: .data -531, 812, 278, -617
+L68: .string "jk"
+mov #-111, *r7
+cmp r0, L278
+L69: .data 133, -234
+L70: .data 597, 175, 948, -435, -198, -692
+L71: .string "emjkvsblzycfeiisvs"
+L72: .string "hhaqsiyntfmn"
+L73: .string "ta"
+L74: .data -404, -477, -796, 273, 88, -717
+; comment
+mov *r1, r0
+L75: .string "gtjvptykrzcsjzknsjag"
+L76: .data 881, 397, -94, -467, -502, 29, -657, 404
+L77: .string "jnlscblubbj"
+L78: .data -755, 934
+jmp *r2
+L79: .string "skxd"
+L80: .data 187, 144
+lea L243, L50
+L81: .string "g"
+jsr L24
+sub r6, *r1
+L82: .string "yisghuzufjrykkalyawnnk"
+bne L169
+; comment
+dec L77
+add r2, *r3
+L83: .string "gkngspzdurksqf"
+L84: .string "yejlzrgzjssdlm"
+stop
+L85: .string "kzwutfqn"
+L86: .string "ivxxehrwefqc"
+L87: .data -190, -607, 188, 106, 357
+cmp L19, *r2
+L88: .string "prkmbvvpvpwuct"
+L89: mov r2, r4
+jsr *r3
+L90: .data -715, 771, -356
+bne *r4
+L91: .string "pkqyinyur"
+; comment
+L92: .string "qsj"
+L93: bne L138
+L94: clr r6
+L95: .string "fl"
+L96: .data -609, 150, 460, -226, -841, 332
+L97: .string "ehekwchvyszcbg"
+L98: .data -887, 949, 29, 123, 629, 157, -915, -820
+L99: .string "snn"
+L100: .string "evq"
+; comment
+L101: .string "ajxebiuxhkzhaxytkau"
+bne *r4
+L102: .string "qyumlavzutaffkyfg"
+L103: .data -571
+stop
+jsr *r1
+L104: .data -410, 888, 810, -539
+L105: .string "tcdqjzcphdhnrf"
+rts
+jmp L67
+jsr *r6
+jsr *r5
+cmp L154, #248
+mov r3, *r0
+stop
+red *r3
+L106: inc r5
+L107: .data -984, -761, 163, 419, -373, -554
+L108: .string "mppcjugylbxekuyi"
+mov #-80, *r7
+sub L58, L206
+L109: .string "bakaeyalxcc"
+L110: .data 211, 438, -997, 700, -520, -550, -807
+; comment
+L111: .string "hfitjahbmtabte"
+L112: .data 525, -138, 61, -825
+L113: .string "feibllthsft"
+jsr L165
+L114: .string "rxjxjmtrmbv"
+jmp *r6
+sub r6, *r4
+rts
+mov L230, *r1
+not r6
+L115: .data -647, -624, 338, -11, 274
+L116: .data -679, -781, 40, 893, -285, -178, 409, 596
+L117: .string "brupmgqztlnmyanor"
+L118: .string "lbdsprzqjeqjsxiqpvku"
+L119: .string "qd"
+L120: .data -100, -265, 642, -537, 662, 88
+lea L192, L111
+L121: .string "r"
+L122: .data -444, -332, 931, 448, 290, 440, -966
+L123: .string "jho"
+prn *r1
+L124: .data 940, 416, 909, -470, -320
+inc L248
+L125: .data -360, 269, 214, 284
+mov *r3, L125
+lea L55, L280
+L126: .string "seajyghdg"
+L127: mov L166, *r7
+add L1, r5
+L128: .data 482
+L129: clr *r1
+
+L130: .string "d"
+L131: .string "ktbob"
+L132: .string "clajkuqzcoqbsmh"
+L133: .data -551, -981, 962
+L134: sub L51, L93
+L135: .string "xcgerecyslgjmjojq"
+stop
+sub r2, *r2
+L136: .data 103
+L137: .string "nhqiwboisgkeofhbuxqjwydy"
+L138: .data 428, 869, -111, 694
+add *r1, L227
+L139: lea L1, *r5
+; comment
+; comment
+L140: .data 452, -931, -742, 491, 405, -725
+L141: red r3
+L142: lea L283, *r6
+L143: .data -766, -444, 954, -799, 673, 296, 428
+jsr *r0
+L144: .data -692, -193, -294, -111, -891, -589
+L145: .string "wonow"
+L146: .string "fcpeukbt"
+inc *r6
+; comment
+sub r6, r5
+L147: .string "wytbxqocmuhrjqce"
+bne *r2
+L148: .data 80, 484, -422, -61, -322, 438
+L149: .string "rkmrnptiignciowpihudqybz"
+red r3
+L150: not r6
+L151: .string "bekxqynpihyongnfd"
+L152: .string "bfdlvibx"
+red r7
+L153: .data -191, 918, 348, 354, 580, -165
+clr *r4
+L154: .string "mlrjbkmddypdfhlfs"
+L155: .string "iugjytq"
+L156: .string "vybqrxxfjqtnrkevqhqgieb"
+L157: .string "goqthdxgyivz"
+jsr *r2
+prn *r0
+L158: .data -340, -337, 434, -408, -657, -337, -654
+prn #53
+L159: add L26, r0
+L160: .data 399, 156, -232, 114, -399, -438, 22
+L161: .data 221, -316, -478, 652, 526, -70, 683
+
+L162: .data 541, -695, -32, 868, 631, 877
+L163: .data -761, 972, 775, 365, 558, -65, -446, -502
+add #34, r2
+L164: .string "kzqisnctdpfksunwxpnihega"
+L165: .string "fnokaezuaojpmzkagfcynyoz"
+L166: .string "mrw"
+L167: .data -710, -800, -299, 894, -623, -613, -13
+L168: .data 850, -423, -271, 192, 897
+L169: .string "ewbtxvruyvghgzcalvee"
+L170: .data -160, 71, 625, 572, -881, -175
+L171: .data 943, -763, 692, 550, -810
+L172: rts
+L173: .string "iaigrvzwyglgosef"
+L174: .string "pqfpkz"
+add L287, *r7
+not *r2
+L175: .data 929, -456, -801, 753, 683, -994, 474, -549
+L176: .data 168
+; comment
+; comment
+L177: .string "xa"
+add r4, L2
+L178: .string "bpnyfsbmfg"
+L179: .string "qnlmtp"
+L180: .data -206, 525, 373, 827, 108, -954, -933
+; comment
+L181: .string "gxoiyxxvdiduisn"
+L182: .string "rsikirirzadxaiizwhr"
+lea L247, L274
+lea L84, L126
+; comment
+; comment
+L183: stop
+L184: .data -239, -390, -332, -174, 746
+L185: .string "dhugadydnrdbobpykilsxvcv"
+rts
+L186: .string "dljxzmcjhnbahoxeqgkyyak"
+bne *r3
+L187: .string "ybxahle"
+L188: .string "c"
+L189: .string "frtbqhs"
+L190: sub r2, r7
+L191: bne L195
+sub r5, L153
+L192: .string "fmefytsoxfknzvtvhb"
+L193: sub r0, r2
+L194: .string "tscatrjyvhgrpojo"
+jmp *r4
+L195: .string "iwsuafbuu"
+mov r6, r7
+cmp #-43, *r7
+stop
+sub #-170, L102
+L196: .data -650, -240, -285, -83, -629, 995, 433, -42
+L197: .string "rrg"
+L198: .string "cgcgkjy"
+L199: .data -263, -549, 9, 525, 899, 801
+add #-228, L172
+L200: .data -867, 210, -844, 756
+L201: .data -343, -889, -714, 134, -404, -492, -224
+L202: add L275, *r6
+L203: .string "pt"
+L204: stop
+lea L55, r3
+L205: .string "ppqtpkulhw"
+bne *r1
+L206: .string "hzmwglb"
+L207: .string "uhrxwcfzuyloskdzugz"
+L208: dec L228
+L209: .string "alqzyfgdpl"
+L210: .string "avuuuwmcagne"
+prn r7
+L211: .string "lasdmjpc"
+jsr L272
+mov #82, r5
+clr r1
+L212: jsr *r4
+jmp *r7
+L213: .string "jcafrdhaf"
+L214: .data 149, -139
+L215: bne L214
+L216: .data -259, 68, 829, -660, -543, 75
+clr *r6
+lea L78, L288
+L217: .data -513
+L218: .data -850, -758, -790
+L219: .string "hvolkfromfxmhnwhrhopij"
+L220: .data 795
+L221: .data 285
+L222: .data 476, 478, 835, 388, -406
+L223: bne L306
+L224: .string "ygbgsjkafo"
+L225: .string "smetoactqldssrs"
+L226: .string "mmipybiq"
+L227: .data -397, 729, 133, 466, -927, -459, 902
+L228: .string "vczyi"
+red r5
+lea L276, *r5
+prn *r7
+not r5
+L229: .data 365, -364, -773, -598, -7, -643, 628
+L230: stop
+bne L247
+clr r4
+rts
+L231: .data 602, -443, 427, -922, 587, -788
+L232: .data -369, -405, 442, -659, 621, -76, -472
+; comment
+L233: .data -935, 484, -999, -417
+jmp *r6
+L234: .string "e"
+L235: .string "usfbzokbtpjs"
+L236: .data 790, -669, 879, 632, -34, -770, -880, -768
+L237: .string "wttvftmseng"
+L238: .string "dkehcekijgnh"
+L239: .data 212, 35, 62, 581
+clr *r1
+L240: .string "nztapirjeavsz"
+L241: .string "td"
+add L276, L241
+L242: .data 454, -219, 798
+L243: .string "cxajdvolemxemxmkeig"
+L244: .data 59, -331
+; comment
+L245: bne *r4
+L246: .string "papcwluugldxlao"
+inc *r6
+L247: clr *r3
+bne *r7
+inc r5
+L248: .string "yzxbvtdie"
+cmp #202, L308
+cmp #-199, L264
+
+L249: .data 665, -341, -311, -508, 869, -32, 263
+L250: .string "zolobtj"
+red r4
+red L309
+L251: .data 110, 231, 802, 598, -698, -441, 617
+L252: jmp *r4
+L253: .data -343, -28, 676, -466, 169
+prn #125
+L254: .data 503, 772, 377, 16, -575
+rts
+L255: stop
+L256: .data 268, 812, 958, -44, 1, 264, -239, 896
+not r7
+jmp L303
+red L274
+L257: .data 26, 909, -782, -709, 368, 61, -675
+mov *r2, L300
+L258: .data -750, -241
+jmp L70
+add L271, *r0
+L259: .string "fwmd"
+sub r4, r3
+L260: .data 557, -442, 569, -472, 784, -719, 46, 25
+lea L270, *r0
+clr r2
+stop
+L261: mov L281, L303
+rts
+jmp *r2
+; comment
+L262: .data -541
+L263: .string "ekqkswcwitubslvw"
+prn L295
+L264: .string "rmqiw"
+L265: .data 972, 357, 640
+L266: .string "hifphg"
+jsr L236
+L267: .data 179, 853, 594, 602, 853, 311, 863, 402
+L268: .string "omrsu"
+L269: .data 633, 415, -852, 354
+L270: dec *r5
+L271: jmp *r6
+L272: .string "uqckizew"
+L273: .data 69, 126, -198, 840, 485, -228
+L274: clr *r6
+L275: .string "te"
+L276: .string "vqluflmsfcoadwkcw"
+cmp L305, #138
+L277: .data -611, -270, -269, 498, -71, 813, -587
+add #-183, L291
+L278: .data -566, 69, -776
+L279: .string "poezt"
+L280: .data -479, 410, 214, -926, 710, 715, 555
+L281: .string "dyuypxcoqwgw"
+L282: .data 827, -691
+cmp L77, r3
+L283: .data 516
+L284: .data 137, -613, -474, -565, 210
+L285: .string "mapmteldlw"
+L286: lea L47, r6
+lea L245, r1
+L287: .data 130, 919, 46, -407, -555, 369, 310
+L288: .string "yhmeeckzdegeqvr"
+L289: .data 581, -86, -927, 516, 908, -249
+L290: .string "qluqsme"
+L291: .string "g"
+L292: .string "f"
+L293: .string "aveqjfxioc"
+not r0
+L294: .data 897, 455, 950, -252, 904, -923, -204
+red L56
+L295: .string "hseuzxiw"
+L296: cmp r4, r2
+L297: .data 979, -16, 393, 471, 649, 844
+jsr *r2
+rts
+L298: .string "takg"
+L299: .string "holjqiasnhmkxmd"
+L300: .string "nzzsxqinzsnlpxqalinb"
+L301: .string "wrwkn"
+jmp *r5
+L302: .string "jyutgsyywkkpajjbiiqadqu"
+L303: .string "vxgrlolcu"
+L304: .string "khygdiwhl"
+L305: .string "mnzdwhtjhbvwmfjnrtpu"
+L306: .data -46, 288, -435, -336
+L307: .data 555, 660
+L308: .string "tbzwhlnbvtsmaprskovssqg"
+stop
+L309: .string "pqnztzvndyswzwvimhvpsqjw"
+clr r7
+L310: .data -189, -987, 435, 66, -900
+clr r5
+stop
@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 26
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+dec *r3
+L0: .string "vdinhctbdjhmitbnbda"
+clr *r6
+not *r5
+L1: .data 590, 160, 657, 246
+L2: .string "nfzpllvfp"
+
+L3: .string "vxtvmxkms"
+jsr L153
+mov r1, *r6
+red r4
+L4: .data -610, 840, -355, 460, -434, -162, -462, 73
+L5: .data -472, 181, -874, -805, 466, -916
+red L33
+L6: .string "vt"
+rts
+L7: .string "mgxcvwzibkscni"
+L8: .string "mjzvmsln"
+L9: .data -416, 960, 842, -599, 691
+L10: .string "wurhjizxlchqjzacpi"
+cmp #230, *r7
+L11: .data 685, 490, -191, -383, 36, -893, -379
+L12: .data -171, 559, 711, -465, -255, 663
+L13: .string "veoa"
+bne *r2
+inc r6
+mov *r4, L9
+L14: .string "gytdwwbuasjhepuzjvvhm"
+rts
+L15: .data 765, 396, 434, 607, -249
+L16: .data -841, -249, 583, 915
+L17: .string "lmpb"
+L18: .data 486, 528, 737
+L19: jsr *r3
+dec r4
+L20: .string "crvwdffh"
+L21: .data 736, 307, -955, 77, -569, -805, -118
+L22: .string "drxzpbiucosnxl"
+L23: .data -93, 332, 344, 151
+stop
+jsr *r0
+
+L24: dec r5
+inc r6
+L25: .data 931, -561, -264, -164, 719, 651, 400, 603
+lea L15, L15
+sub r4, *r7
+L26: .string "aoppj"
+L27: .data 127
+L28: .string "roridtsvopj"
+L29: .data -939, -794, 318
+L30: .data 638, 354, 192, 492
+L31: .string "okxvxqlcplykpfqmkvvcjyz"
+dec *r3
+L32: .string "hddltlnagtwublirwoxiv"
+L33: .data -778, 429
+red L273
+L34: .string "myzxpsmpq"
+L35: .data -751, 440, 846, -331, -343
+L36: .string "wzvv"
+
+L37: .string "dlbijwjevnakutfuvkl"
+L38: .data 405, -977, 862
+L39: add *r6, *r3
+L40: jsr *r5
+L41: .string "hi"
+L42: .data 707, 282, -298, -426, -852, -450, -467
+L43: .data -282
+L44: cmp #45, L162
+prn L17
+L45: inc *r5
+L46: .string "bdemxsheqgwrjebhelo"
+stop
+L47: .string "cjonwwnpahnunmptabqo"
+L48: .data 955, 769
+L49: .data -99, -735, -522
+L50: .data -646
+red r1
+L51: jsr *r0
+L52: .string "rfmhbvqhfkvvwxrabnh"
+L53: bne *r6
+clr L139
+L54: .string "aqvabtzhsbeakuqlerjk"
+mov r1, L226
+L55: .data -71, 103, 758, 274, -178
+L56: .string "yod"
+not L120
+L57: .string "ftdlsvltjbsdnktctnzz"
+L58: .string "waqydmgtaaswhivviodyxctu"
+L59: .data -384, 917, -21
+; comment
+L60: .data 316
+cmp *r5, *r0
+L61: .string "tzvwgzwycylt"
+L62: .data -780, -665, -68
+lea L19, *r3
+sub L78, *r1
+L63: .string "qssinxn"
+L64: .string "vcuclmbvckjrbqpje"
+red L168
+mov r4, *r7
+L65: .data -110, 428, 281, -222, 303, 180, 324
+L66: jsr *r7
+L67: .data -289, -549, -867, -732, -665, -138
+clr *r4
+L68: .string "yshdyyitbnqjcn"
+L69: .string "qfqggyocwmxrehujwycvdr"
+jsr L1
+sub r4, *r2
+L70: .data 989, 795, 685
+L71: .data 272, -22, -431
+bne *r7
+L72: .data -609, 214, -763
+red L51
+jmp L281
+L73: inc *r6
+L74: .data 379, 506, -443, 406, -716, -36, 926
+L75: .string "v"
+L76: .string "xlrjdtmawtogeovsgm"
+L77: .string "qpncltahtvubohnnlta"
+L78: .data 783, -400, 930, 945, 890
+L79: .data 800, -551
+not L43
+not L45
+stop
+L80: .string "umvegeknfbaxkdhhyjxuq"
+bne *r1
+L81: .string "ecdqkxtowliugqcjyxlhs"
+L82: .data 737, 183, -641, -738
+bne *r5
+mov *r1, L166
+L83: .data 454
+L84: .data -967, -411, 365
+stop
+L85: .data 818
+L86: .data 379, 12, 458, 110
+L87: .string "cscrerfqeivhoppp"
+red r7
+L88: .string "tgac"
+
+mov L177, L42
+L89: .string "cumxtqczmejpq"
+inc L301
+L90: add #200, L280
+lea L67, L40
+L91: bne *r4
+L92: .data 323, -691, 851, -71
+cmp r6, #-174
+dec *r6
+L93: .data -150, -949, -96
+L94: bne *r1
+L95: .string "zamvyrutkwjmoiaseqooihfg"
+L96: .string "qnxqr"
+rts
+L97: .data 946, 637, 29
+L98: .string "zrzeelwakgqigowwh"
+L99: .data 826, -898
+clr r4
+red r5
+L100: .data 801, 842, -15, -669, -82, -937, 73
+L101: .string "wjxgfdqrfmxxrqejz"
+L102: .string "hjujpfzpysbcvfnz"
+jmp L38
+L103: .data 898, 73
+dec r6
+L104: .string "gpxnygduzmqwrbne"
+; comment
+not L198
+L105: .string "xrkqimjdqglmceojgcf"
+L106: inc L231
+L107: .data -154, -150, 708, -158, -370
+; comment
+L108: .string "tjdimzjahzxzwpshumbsykfl"
+L109: .string "qzuiozddh"
+L110: .string "tviomkbhnusmfoeypsiot"
+L111: .data 371, -467, 319, 26, 920
+L112: .data 758, -93, 220
+sub L131, *r1
+L113: .string "iidyhorwvrwgvqaalt"
+L114: .data 996, -793
+jmp *r3
+L115: .data 132, 95, -8, 139, 358, -142, -343
+L116: .string "onmsoeesjdreghm"
+cmp L220, L241
+L117: .data 763, 645, -95, 716, 598
+
+L118: .string "zsxdx"
+L119: .data 936, 860, 744, -890
+clr L292
+stop
+L120: .string "ilvqfnszbrmfn"
+L121: .data 217, -639, 262, -449
+stop
+stop
+jsr L69
+; comment
+sub #-131, L54
+L122: .data 597, -828, -706, 997, -938
+; comment
+cmp *r6, L295
+L123: .string "ychcrghqttcyrbxugnzjaedd"
+L124: .data -845, 486, -477
+sub #-167, r3
+L125: .data -929, -606, 953, 419, -890, -667
+cmp r6, #-177
+stop
+L126: .data -263, 608
+L127: .string "cqvfqtlbqtysnpnojwgrk"
+not r4
+prn #148
+L128: .string "njpgjhfspmzcdfrdiuxrc"
+L129: bne *r2
+; comment
+dec *r1
+L130: .string "cgiciyfvbythbz"
+L131: .data -368, 332, 179, -667, -68
+L132: .string "mtbtrb"
+jmp *r5
+L133: .string "fzswf"
+sub L17, L74
+stop
+L134: .data -191
+L135: .data -694, -547
+L136: .string "powma"
+L137: .data 671, -182, 860
+L138: .data 766, 118
+L139: .data 525, -118, 444, 639, 230, -248
+L140: .data 450, -552, -50, 958, 884, 489
+prn r0
+L141: .string "slzovcjsvfxidb"
+L142: .data -528, 823, -565, 753, -332
+
+L143: .string "fpolspxzuubqqtuorf"
+L144: .data 592, -848
+inc L122
+L145: .string "xqngym"
+L146: .string "ozesdeuwuczmpgtzk"
+clr L226
+L147: .data -815
+L148: add r6, *r0
+L149: .string "akkxizfjk"
+mov *r4, r4
+L150: stop
+L151: .data -878, -804, -171, 205, 961, -169, -162
+L152: .data -894, -420, -61, -768, -657, 784, -234
+L153: .string "l"
+L154: .string "rdlomru"
+mov #173, *r2
+mov r1, L277
+L155: .string "weazvcguvfltkrbr"
+L156: .data 872, 468, -231, -333, 786, -457, 983, -501
+L157: prn #55
+L158: .string "qiuwhrkuhs"
+L159: .data 790, -732, 501, 499, 344, 532
+add #-50, L232
+L160: mov L73, L72
+prn r0
+red r1
+L161: .data -380, 947, 991, -476, 316, -374, 301, 556
+lea L176, *r5
+L162: .data 797, 697, -694
+L163: .data -251, -266, -488, -956
+L164: .string "rp"
+L165: .data 150, -188, -13
+L166: .string "dbnkithhpfq"
+L167: .string "apqfucfvlmrwdk"
+red r4
+L168: sub *r3, *r2
+L169: .data 447, 95, 918, 4, 129, -480, -96
+L170: .data -30, -328, 515, 955, -895, -599, 553, -750
+L171: .string "flr"
+stop
+L172: .string "btfrhyyjdsetoom"
+L173: rts
+L174: rts
+L175: .data 911, -591, -665
+dec r5
+dec L248
+L176: .string "qjbz"
+red L45
+sub *r4, r2
+L177: .string "bfv"
+jmp L141
+rts
+L178: .string "dhftyuhn"
+rts
+L179: .data 163, 739, -271, 32, -368, -728, -8, -928
+mov r5, *r5
+; comment
+dec L91
+not *r1
+L180: .data 630, 430, 520, -43, 811, 985, -612
+L181: .string "uqfliilsaml"
+L182: .data -779
+add r5, *r5
+L183: .string "vdbgurjuvdnsfkrudv"
+L184: .data -427
+L185: .data 26, -532, 544, 38
+L186: jsr *r2
+L187: .data -950, -55
+rts
+; comment
+prn #192
+mov #-84, L203
+; comment
+
+stop
+L188: .data -201, -636, -970, -43
+dec L37
+L189: .data 984, -920, 49, -649, 526
+L190: .string "vdgkgsnnnjjtcu"
+red *r3
+L191: clr *r1
+L192: .data 786, -192, -56, -786, 178, -287, -333
+L193: .string "ivahqq"
+L194: red L222
+L195: jmp L191
+bne L304
+L196: .string "ivxpx"
+jsr L208
+L197: .data 561, 830, 618
+L198: .string "cstcghh"
+L199: dec r0
+L200: clr r2
+dec r6
+L201: .data -695, 109
+not *r0
+L202: dec L300
+not r5
+L203: .data 97
+L204: .string "nrrpq"
+L205: .data 722, -152, 744, 858, 993
+jsr L254
+bne *r3
+red L119
+; comment
+L206: .data 453, 32
+lea L80, L172
+L207: .data 235, 19, -289, -273, -16, -488
+add r7, *r4
+L208: bne L300
+L209: .string "odnyzngowbqgyiuunvs"
+L210: .string "flidhpqthraqhiviqwbsa"
+L211: .data 197, -351, -944, -956, -660, -989, -24
+L212: .string "hcxrfawuwylrpuujozdxadc"
+L213: .data -98, -961, -572, 110
+not r3
+dec *r2
+L214: .string "byjlkxrfeyfchnqtxpud"
+
+L215: .data 435, 158
+L216: .data 615, -768, 296, 616, -736
+L217: .string "qlwjq"
+add L119, *r5
+
+L218: inc L259
+L219: rts
+L220: .string "h"
+L221: .data 579, -211, 487
+L222: .data 449, 389, 504, 810, -640
+L223: .string "rckaieskfrhzxsezjjfuu"
+L224: .string "oltrdfieme"
+L225: add *r7, *r7
+; comment
+mov r7, L279
+jmp L61
+L226: .string "biessodjjqcxa"
+L227: .data 883, 542, 101, 935, 825
+L228: .string "yzrgphnourscpidsagelvs"
+L229: .data -835, -983
+L230: .string "aae"
+L231: .data -200, -145, 14, -442
+L232: .string "aviahwpe"
+sub L290, *r0
+dec *r2
+lea L52, *r5
+L233: .data 432, -23, 910, -668, 980, 115, 643
+cmp #8, *r6
+L234: .string "htaphbgrawvkiuwf"
+L235: .string "vwrjxyfatxoqovz"
+; comment
+L236: dec r4
+L237: .string "djjfibdarnipumm"
+clr r7
+L238: .string "kliamarhtbawtwwmys"
+L239: .data -652, 796, 934
+L240: rts
+L241: .data 421, 64, 362, 490, 409
+sub L291, *r0
+prn #149
+not *r5
+L242: .string "rynygf"
+L243: .data -150, -218, -772, -492, 544, 766, -860
+L244: .string "nknsynujgytxmtfcjdlpej"
+L245: .data 638, 829, -158, -994, 908, 399, -798
+L246: .string "ftmhicwtczwkz"
+mov r0, L307
+stop
+L247: .string "znhtfvslfellbhrxanavlmn"
+jsr *r4
+; comment
+L248: .data 397
+jsr *r0
+L249: .string "fldwlxmmzoa"
+L250: .data 927, -791, 386, -760
+jsr *r1
+L251: .string "zkdsbavjtipggdnmry"
+L252: .data 495, -400, -583, -128, 146, -417, 410
+rts
+lea L287, r4
+L253: .string "scpxfgrx"
+L254: .string "vqwvdjvxeqlfsr"
+mov L308, r4
+L255: .string "xuqgmdbkr"
+L256: .data -524, -540, 85, -6, 806
+
+L257: .string "eclzearnokubmt"
+jmp *r4
+stop
+mov #43, *r6
+L258: .data 776
+L259: .data -382, -546, -482, -857
+L260: sub r2, r3
+L261: .data 727
+L262: .data -146, 335, 320, 833, 524
+stop
+L263: .string "vxnvuoityqhjfwo"
+prn *r4
+L264: .data 926, -194, 430, 697, -100, -58, 660, 806
+L265: .string "efkmondfyuiiwlk"
+L266: .string "qoffwymlp"
+L267: .string "zarwox"
+L268: .data -200, -493, -54, 450, -759
+L269: .data -74, -839, 418
+L270: .data 642, -715, 676, -194, 430, -302, -386
+prn L311
+L271: .data -253, -673, 788, 1, 553
+L272: .string "dtzspxcakkkqaxpftimit"
+L273: .string "owetgbqopbsrnejcgctv"
+cmp *r0, L286
+prn r7
+add #-67, r7
+cmp L295, L35
+L274: .data 749, -972, 9, 991, -17, -481
+jmp *r6
+L275: .data -289, 335, -519, -748, 639, -97, 266
+L276: .data 259
+L277: .string "ilwolpfmxmvrywibd"
+L278: .string "iviyyokhzysdvwj"
+L279: .string "mcjroyvgjzssrro"
+L280: .data -623, -263, -55, 681
+L281: .string "kvog"
+L282: cmp *r3, r7
+L283: .string "dunetzhmjhrcnyplnnqh"
+red r2
+prn *r5
+L284: .data -568, 809, 250, 846, -782, 713, 74
+L285: .data 851, 709, 502
+L286: .string "xifkczotjwiaslxssvaeow"
+L287: .data 5, -50, 770, 263, 588, 340, 144
+mov L178, *r3
+dec L53
+L288: .string "aywropeqxvhiempwygtildh"
+L289: .string "cc"
+cmp *r6, r3
+L290: .string "tgewrwvmlwzz"
+jmp L102
+not L48
+L291: .data 179, 403, -715, -903, -360, -443, -915
+L292: not r5
+L293: .data -300, -728, -844, 244, 53, 863, 77, 289
+L294: .data -944, 463, 207
+L295: .string "zbkejqcwubwxnpahjhuvy"
+L296: .string "gvfw"
+clr *r2
+prn *r5
+L297: .data 523, -310, 29, -435
+not L5
+L298: .data 511, -282, -246, 661, 916, -147, 922
+L299: .data 381, 282, -545, -842, -155
+; comment
+L300: .string "tyddjmbawvyoa"
+mov *r4, *r4
+L301: .string "vxfkaraymjgphxehgja"
+
+L302: .string "txvmktievbg"
+L303: .data 269, -225, -69, 154, -786, 872
+prn L253
+L304: .data 639, -672, -443, 206, -341
+L305: .string "elolumyvyaaherinpe"
+dec r4
+rts
+L306: .string "ypu"
+L307: .data 63, 411, -544
+dec *r1
+jsr *r5
+L308: .string "tegasqutcdjdtz"
+L309: .data -950, -804, -339
+L310: rts
+L311: .string "nax"
+stop
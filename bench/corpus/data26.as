@@ -0,0 +1,524 @@
+; Generated by genCorpus --seed 27
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: .string "zthzytce"
+L1: red *r4
+L2: lea L132, L2
+jsr L2
+L3: .data -330, -774, -945, 636, 712, 640
+L4: .string "yqskabh"
+not *r2
+L5: .data 540, -227, 974, -601, -718, 741
+L6: .data -921, -978, 353
+L7: .data -240
+dec *r5
+L8: .data -653, -25, 498, -200, -560, -499, 776, 27
+L9: .data 147, 930, 254, -95, 16, -685, 785
+L10: .string "lwttyvhwbx"
+bne *r1
+L11: .string "puwvtpnmfzha"
+
+L12: .data 849
+L13: .data -627, 379, 916, -271, -714, 107, 24, -404
+L14: .string "o"
+L15: sub *r7, r3
+L16: .data 587, 887, -955, 920, -166, 621
+L17: prn L7
+dec r0
+L18: .data -674, 660, 855, 935, -898, -535, 464
+jmp *r5
+L19: .data -491, -378
+L20: .string "dbnmnlwwwsmklwrizcflbtz"
+L21: .data 726, -516, 946, -183, -334, -873, -10, 504
+; comment
+not r0
+L22: .data -79, 695, -18
+L23: .string "fdao"
+L24: dec r2
+jmp *r7
+L25: .string "kkqegwpazkhxqttdrzjey"
+L26: .string "nov"
+L27: .data 972
+L28: .data 724, 314, -353, 194, 182, 292
+red *r3
+L29: lea L169, *r1
+L30: .data 935, -698, 804, 956, -542, -734, 68
+inc L13
+L31: .data 968, 57
+L32: .string "jvcntbjxroxzj"
+L33: .string "sjcskqtzdp"
+L34: .data 768, -42, 505, 467
+jsr L214
+L35: .string "mzottfawkwejakllwtc"
+L36: .data 445
+stop
+L37: .string "znyhjisxzzhighwrtvfp"
+L38: prn r6
+cmp #5, r3
+L39: .string "wftqaweamlwukjwrp"
+L40: .string "lixm"
+red L21
+
+L41: bne *r0
+L42: .data 718, -378, -396, -287, -971, -300, -384
+clr L20
+L43: .string "hprgkvlkudlpgj"
+rts
+rts
+L44: .string "boopekrnnbxajmhezaihepk"
+cmp *r6, *r0
+L45: .data -208, 740, 398, 891, -563, -609, -240, 285
+L46: .string "tonmewxztofkd"
+L47: .data -841, 344, -768
+L48: .data -209, -980, -653, -910
+mov #5, L159
+L49: .data 169, 896
+jsr *r5
+L50: .data 842, 456, 155, -304, 759, -516, 756, -518
+clr r7
+L51: .string "se"
+L52: .string "jfwimsdcgvnmukspkad"
+L53: .string "eot"
+; comment
+L54: bne *r3
+L55: .data 426, 915, -457, 140, 337, -246
+L56: .string "itaabgogxlhqob"
+; comment
+L57: jsr L147
+jsr L22
+L58: .string "eihqogdvcaymshneuytxrhx"
+L59: clr *r1
+L60: jmp L224
+L61: .string "wgoxhbwwuiahvgywgk"
+bne L5
+L62: .string "ya"
+L63: .data -212, -992, 168, 561, -246
+stop
+red r0
+L64: .string "sknxxyohhpc"
+lea L6, r7
+L65: .string "mutshzfg"
+add r7, L112
+L66: .data 163, -558, -516, 981, -748, -238, -464, -811
+L67: .string "oelgecuky"
+L68: .data -632, 720, 293, -888
+cmp L138, #-25
+L69: .string "dionpestaezazeapzduekifw"
+L70: mov L119, r6
+L71: .data -141, -417, -603, -556
+L72: .data -773, -496, -677, 321, -279, -919
+L73: .data 314, -898, 807
+L74: .string "gcjfffmtvodz"
+L75: .string "wihkcuczqsh"
+rts
+
+inc L24
+L76: .data 134, -861, 953, 974, -596, 894, 201, 634
+L77: .string "eiuktpklzkhlihjgizil"
+L78: .data 522, 91, 169, 797
+L79: .data -101, 455, -171
+lea L283, *r4
+prn L123
+L80: stop
+clr r5
+jmp *r4
+L81: jsr L159
+L82: .data 206, 796, 796, -489, 365, 605, 120, -893
+L83: .string "ofci"
+L84: not r3
+L85: bne L139
+L86: .string "hldhondqzhc"
+mov #-94, L126
+L87: .data -465, -616, 595, -912
+L88: .data -709, 577, 320, 684
+L89: .data 682, 258, -394, 462, 636, -631, -35
+add r7, *r3
+L90: rts
+rts
+L91: .data 219, -970
+L92: .string "kvjlggezxdozwf"
+L93: .string "u"
+not *r3
+L94: .string "ywfzj"
+L95: .data 598, 974
+L96: .string "td"
+L97: .string "xxtwswrsqoitgixxdsajxwkb"
+; comment
+L98: .string "ji"
+L99: .string "rkxsuqocj"
+L100: .data 822, 264, 550, -174, 351, 674, -977
+jmp *r7
+L101: .string "udgnk"
+rts
+L102: .string "zzv"
+L103: .string "yaznut"
+L104: .data -587
+L105: .string "jxstsxrnrujmxmhhqpcnmhe"
+L106: .data -41
+L107: jmp *r7
+L108: .string "jnkakorviukegsgr"
+; comment
+L109: .string "udqox"
+mov *r3, L48
+L110: .data -176, -319, -769, -976, -35, -891, -477, -618
+clr r5
+L111: .data -418, -902, -210, 562, -47, 276, -135, 638
+L112: add #236, r5
+inc *r3
+jmp L325
+L113: sub *r2, L32
+L114: .string "lqvqljntanpigzuzutcicoy"
+L115: .data -70, 250, 917, -846, 741, -56, -47, -919
+cmp *r7, *r4
+L116: .string "jftyhfhybkhcidiawknki"
+prn *r0
+L117: red *r3
+L118: .string "kbmnliamopxgbrgsbkwtllm"
+L119: .data -57, 982, 670, -900, -924, -460, -376
+L120: .string "ebclicltagwgoamssib"
+L121: .string "jhezjptoviiksb"
+L122: .string "lxrfdmqznxjf"
+jmp *r7
+L123: .string "eykd"
+L124: .data -277, -30, 891, 393, 11
+L125: .string "oqgjdcioweevwkenbpmlma"
+jmp *r2
+L126: .string "szqyiv"
+L127: .data -58, -413, -370, 126, -249, 146, 68
+L128: .string "auzrmvblmmaabzcrmsq"
+L129: .data 620, 670, 563, -605, 202, -550, 652
+L130: .data -444, -836, -174, 58, -178
+L131: .string "jjlxntqhvdzeazvbkgdjeklf"
+L132: .string "nbikqbidtcxa"
+L133: .data 837, -439, -582, -613, -19, -845
+L134: .data 804, -899, 366, 173, -457, 765, 887, -249
+; comment
+L135: .data -334
+prn L335
+L136: .data -41, -170, 108, -836, -21, -362
+L137: jmp L100
+L138: .data -548, 930, 222, -696, -142
+L139: lea L265, r5
+L140: .data 626, -909, 985, 36
+L141: .data -429, -242, 870, 669
+clr r3
+bne L219
+L142: dec L237
+L143: .string "oizlmdqojbrubrle"
+L144: .data 195, 699, 764, -466, 131
+L145: .string "suvgeroabzuq"
+L146: inc r1
+L147: .data 652, 933, 467, 537, 605, -644
+L148: .data -123, -168, 361, 365, 207, -571
+L149: .string "poewaolul"
+
+L150: .string "zavjbrlcibdzvpp"
+L151: .string "osfuliaymcbsphdgcfkpaa"
+L152: .string "ohqawyrf"
+L153: .data -748, -265, 858, -898, -85, -862, 196
+L154: .data 485, -362, -601, -895, -331, -802, 168, 727
+L155: .string "snfvyymruhdirclpc"
+L156: .string "y"
+L157: .data 242, 286, -493, -62, -294
+L158: .data -385, 374, 337
+sub *r1, L149
+jmp L36
+L159: .string "ujltuipkvnkg"
+rts
+L160: .data 337, -863
+L161: .data 77, -17, 372, -798, 845, -932
+red r2
+sub #23, *r3
+L162: .data -209, 319, -78, 900, 483
+prn r7
+L163: .data 101, 768, 217, -659, -161
+cmp r3, *r1
+rts
+L164: .data 736, -596, -986, -349, -861
+mov L123, r5
+dec r5
+cmp #-252, L180
+L165: .string "qslwlihbnhrynqmatgkkq"
+L166: .string "ajrtytffo"
+L167: .string "xpabnqrwltvafynpvtbvppbl"
+bne *r6
+L168: .string "cvcqncxeaoblqosad"
+L169: .string "mp"
+L170: .string "cajuebtjobrqryee"
+L171: .data -656, 230, -604, 542, 343, -260, 428, -616
+L172: .data -787, 763
+L173: .string "luqqkjcygoaikbpviaryfwx"
+L174: .string "wdsducdxu"
+stop
+L175: .data -468, -468, -504, -535, 517
+L176: .string "aevxhhqdbowtypfw"
+L177: .string "izlaycpbfw"
+L178: dec L121
+L179: lea L300, *r4
+L180: not *r3
+L181: .data -596, -882, 796, 120
+inc *r5
+L182: .data 238, 273, 696, 816, -958, 63
+L183: .string "xttnihsqpxsjedqjy"
+L184: .string "whdgxrd"
+L185: clr L155
+L186: .string "qilrpnttkgcrmd"
+; comment
+L187: .string "vkkarbrpkljwero"
+L188: .string "wuyonfrap"
+dec *r0
+jmp L70
+; comment
+L189: sub #187, *r4
+L190: .data -721, 591, 212, 868, -601
+L191: .data -876, -605, 682, 188, -244
+L192: sub r0, *r4
+jmp *r1
+jsr L67
+dec r6
+jsr *r1
+cmp r7, L33
+L193: .string "lkunwjcwgnt"
+L194: inc r0
+L195: .data 932
+L196: .string "tboiewgkinetjauy"
+L197: .string "solmoboiivifpjoq"
+dec r5
+; comment
+; comment
+L198: .data 331, 724, 704, 949, -673
+L199: .data 23
+L200: .data -823, 506
+mov L175, r1
+clr L180
+; comment
+lea L113, L282
+
+L201: .string "otugtrmqh"
+L202: .data 244, 899, 724
+L203: .string "lgj"
+stop
+L204: .string "ajhwwyfabvfhjuxwsnq"
+add #-9, *r5
+
+dec r1
+L205: .data 921, -999, -731, -127, 194, 737, 555
+L206: .data 72, -647, -850, -252, 549, 917, 877, -52
+L207: .data 568
+L208: .data -864, 569, 183, -407, 650, 583
+not *r1
+L209: .string "exdsoyiqs"
+stop
+L210: .data 383, -677, 325, -991
+not r6
+L211: .data -539, 635
+add *r2, L150
+L212: .data -682, 150, 328, -800, 406, 758, 81, -662
+L213: .data 733, 479
+L214: .string "kgntzvbunrcglkucwgoyqloq"
+L215: .data 969
+L216: .string "kpjxhv"
+L217: .string "jdgzlcrjswmv"
+
+L218: .data -609, -649, -827, 779, 607, 497, 69, 551
+L219: .string "ebjjpnyvhcpjzfw"
+L220: mov #222, *r0
+L221: .data 136
+L222: .data -940, -464, -528
+L223: lea L233, *r7
+L224: .data -182, -307, -954, 486, 950, 464
+jmp *r0
+L225: .data -945, 995, 824, 879, -388, 616, 189
+L226: .string "krletbislwbdewe"
+inc r7
+L227: .string "tdxauqcwkpejxdtfnsv"
+L228: .string "tvootviyvgqwqpfplvezvzk"
+L229: .data -502, -448
+clr r3
+rts
+L230: add L185, r6
+L231: .string "bmjja"
+L232: .data -277, -391, 691, -429, -103, -811, -152, 164
+inc *r7
+clr r1
+L233: .string "xmxdkhckje"
+L234: .data 135, -186, -610, 568, 187, -883
+L235: .data -501, 997, -132, 86, -918, 164, -440, 801
+L236: jmp L201
+L237: .string "gtmgcckdyfuuhwegt"
+L238: .data 25, -450, 651, 241, 305, -991, -239, 457
+
+not r4
+L239: .string "zphvmwfgpjvwdvcmaygjghs"
+L240: .data 108, -98, -291, 205, -849
+lea L277, *r3
+L241: .data -299, 270, 859, 369, -496
+L242: .string "xtwcdxuwhlorjahlqye"
+L243: .string "fxzgrthvaenxmfsmhq"
+L244: .string "ipfsjrefudlypanrdnhisop"
+L245: .data 704, -660, 390, 38, -688, 455
+L246: jsr *r1
+jmp *r0
+L247: .string "m"
+rts
+lea L314, r3
+L248: .string "byr"
+L249: .string "ioqoci"
+L250: .data 994, 594, -339
+add L145, r7
+L251: .data -833, 380, -657, 20, 379
+add L45, *r3
+L252: .data -192, 696, 519, 680
+L253: .string "fmaywtmdhfsmhhjndyekc"
+L254: .string "aqmjaagwblhwgpogkw"
+L255: .data 149, 898, 597
+L256: .data 939, -152
+; comment
+L257: .data 859, 103, -617, 188, -275, -446, -830
+prn *r3
+L258: .string "uxflwwdlfpowvohp"
+L259: .string "dv"
+L260: .data 611
+L261: .string "okclzpdtpnhqsysxngovw"
+L262: .string "paubninyafjsdkxges"
+; comment
+L263: .data 442, -603, -47, 76, 81, 745, -905, -667
+L264: .data -404
+lea L136, *r7
+L265: .data 301, -659, -845, -140
+L266: sub *r4, *r7
+lea L195, *r1
+L267: .data 599, 778, -443, -832, 239, -838
+L268: .string "k"
+L269: .string "onlsiryisww"
+L270: .string "aqedtujdidjinzemje"
+clr L232
+L271: .data -211, 149, 348
+L272: .string "jhwmkf"
+L273: .string "xyugugzz"
+
+rts
+lea L334, L91
+L274: .data -502, 912, 524
+sub *r1, L276
+jsr L309
+L275: .data 596, 200, -771, 603, -291, 183
+L276: .data 741, 581, 477, 87
+add *r7, r7
+L277: .data 356, -616, -534, -355, 954, 841, -527
+jmp L159
+
+L278: .string "jhshvfbxxqzbgsz"
+L279: red r2
+L280: stop
+
+L281: .string "psnoisqnzgojclcrac"
+L282: .data -666, 507
+L283: .string "ebpwjk"
+L284: .string "inhncyjhwipqnctrx"
+L285: .data -787, -507, -667
+L286: .string "twlexxwltiyyupdktjzlc"
+L287: .data 871, 983, 684
+dec *r5
+L288: .string "ctoicyxpwrnbzjwj"
+prn L337
+cmp L18, #-145
+L289: .data -740, 95, -141, -683, -771
+red *r6
+jmp L305
+L290: .data -451, -289, 487
+clr L298
+L291: rts
+L292: .data 581, 200
+red L5
+L293: inc *r0
+; comment
+prn *r4
+L294: .string "nnmjtwzmed"
+mov L8, L315
+L295: .string "musese"
+L296: .data -625
+prn L318
+L297: clr *r2
+L298: .string "hssgpskgujcafdjzhncrn"
+L299: .string "viibimjpwmnuyntwwja"
+prn L258
+L300: .string "jfvntiidvxqqd"
+rts
+L301: .data 907
+L302: .string "fmeaokcjixpmnnljzfse"
+L303: mov L317, *r1
+L304: bne *r0
+L305: .string "lgmreqeirifcoriqqoeybl"
+red L338
+L306: .data 603, -959, 27, 726, -131
+L307: .string "xdamgfvpijdpj"
+L308: .data 734, 721, -684
+clr L278
+
+L309: .string "hdscuevmeiamxcoerzaaec"
+L310: .string "mvyfcd"
+L311: .data -413, -371
+lea L313, r2
+L312: .string "bbaxjwplynmfrmeoxudurhrq"
+dec *r2
+lea L321, r6
+; comment
+L313: .string "gd"
+; comment
+L314: .string "qhixtjxdpjlrxlpscbztb"
+; comment
+dec r0
+L315: .data -757, 581, 189, 438, 200, -336, 899
+L316: .string "rei"
+L317: .data -194, -643, -461, -180, 110, 141
+L318: .data 202, -951
+L319: .string "iy"
+L320: .string "yqnnkaibylfphgshhxwfh"
+L321: .data -707, -554, 444, 962
+L322: .data -264, 295, -144, -462, -70
+L323: .data -847, -323, -241, 704, -259, -798, -252
+L324: .data -302, -733, 85, 754
+L325: .string "ydtclhqosgtbdkkxinjjcmmg"
+mov *r5, r5
+sub *r3, r7
+L326: .string "ecpiodtwecnqjtwe"
+L327: .string "eouxszricdjcjuqpgspzaed"
+L328: .string "cjr"
+L329: .string "rdhdpurbiwilrsvhzb"
+L330: .data -436, 474, -337, 753, -303, -141, 610, 294
+L331: .data -847, 424, 369, -605, 367
+L332: .string "nuoico"
+L333: .data 821, -759, 332, 513, -261, 255, -811, 363
+stop
+add #-11, L338
+L334: .string "mqlgiftzqxbczahixjncvpu"
+L335: .string "reitekybizi"
+; comment
+L336: .string "nwlihadtxdeejdmi"
+
+L337: .string "qlzrpndpzxhpleybipcnt"
+cmp *r1, *r5
+L338: .string "yctxp"
+L339: .string "dotmupvjk"
+stop
@@ -0,0 +1,524 @@
+; Generated by genCorpus --seed 28
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: sub L0, r3
+L1: .string "ivahqdomsbvnxds"
+L2: .data 724, 531
+L3: .data -574, -704, -923
+
+L4: .string "zddrhcoyfsqsowjp"
+L5: .data -132, -337
+L6: .string "yxpkrd"
+L7: .string "yyanxxbryptgjtzq"
+
+L8: .string "nrfhdwtiuvjlwuiphidmoif"
+add L8, *r7
+mov *r0, L2
+clr r3
+L9: bne *r1
+L10: .data 661, -379, -306, 611
+L11: .data 334, -536
+inc L14
+L12: .data -300, 331, -327, -239, -276, -80
+
+mov r6, r6
+L13: .data -660, -289, -203, -883, -562, 3
+sub r6, r0
+inc r7
+L14: .string "hjeztwfu"
+L15: red *r2
+jsr L197
+L16: sub r7, r4
+L17: .string "iwgtvjtdy"
+L18: .string "qonoyvmewofzsbzkpwj"
+add r5, *r7
+L19: .data -382, 497, -546
+L20: .string "mgbelywrnjyogmbnybple"
+L21: .string "wdluitgyr"
+L22: .data -363, 87, -172, 334, -164, -869
+L23: .string "vrvqrzlxyfjolg"
+
+clr L8
+L24: .string "fricfpnygdh"
+L25: .data -901, -925
+L26: .string "zquzyhjrbgnsmhjgoiv"
+jmp *r5
+L27: .data 629, 988, 699, -768, 227, 715, 12
+inc L259
+L28: .string "ldrk"
+clr r0
+L29: .data -34, 921, 372, -579, 664
+L30: .data -315, 723, 170, 180, -688, -11, -627
+L31: .data 127, 849
+L32: .data 404, -141, 991, 753, -782, 180
+L33: not *r5
+L34: .string "a"
+L35: .string "tgrubfnmkvlyeinokwom"
+not L291
+L36: .data 128, 440, 916, -270, -822, 909, -912, -386
+clr r1
+L37: clr L158
+lea L195, r7
+L38: .data 739, -528, -147, -934
+L39: .string "hkdflcvjjxlavfpn"
+L40: .string "qmjmqbvlv"
+L41: .data -429, 55, -853
+L42: .string "kswgfidkhkuwr"
+L43: .data 894, 963
+red *r7
+L44: .string "kpfezhybovnl"
+L45: .string "keuhjoiudefndvrdfjhhckjo"
+L46: inc r5
+dec *r7
+; comment
+lea L18, *r1
+dec *r5
+mov #232, *r2
+jmp *r0
+bne L256
+L47: .string "xcqtclqlypomuufxeazfvqnr"
+L48: .string "pjwxrqbccgdeenvabyentrcm"
+clr r3
+L49: .string "tasgagsremvjatzvlkgnon"
+mov r5, *r1
+L50: .data -969, 251, 97, 475, 340, -401
+L51: .string "spfbh"
+L52: .string "gvowxnjkcrabdkntir"
+L53: .string "eidtbeclsfced"
+L54: .string "oeworomtqngtnun"
+L55: .string "evzfpekksyffmdgrkal"
+add *r7, r3
+L56: rts
+
+L57: .string "rlnyndwkm"
+L58: .string "oezwk"
+L59: .string "finusluttchlyurqrx"
+L60: stop
+L61: .data 789
+mov #220, L18
+L62: .data -398, 282, 312, 384, -763, -993
+L63: .string "ax"
+lea L51, *r3
+
+stop
+rts
+L64: .data 973, 78, 411, 806, -589, -621, -721, -343
+
+L65: .data 902, -606, -509
+jmp L319
+L66: .string "wnavnugqrqlxrjqpmf"
+L67: .data -971, -734, -253, 630
+inc *r5
+L68: .string "xeaskmwnvw"
+L69: .string "laztmz"
+L70: rts
+L71: .data -309
+lea L19, L233
+L72: .data 844
+L73: .string "ekfghf"
+; comment
+L74: .data -215, -66
+L75: .data 108, 149, -562, 14, 751
+L76: .data 899, 74, 554, -156, -393, -54, 95, 359
+L77: .string "lpijaibbhnmemfbipsbgr"
+sub r7, *r4
+L78: .data 68, 392
+L79: .data 551, -693, -40, -615, 875, 471, 82
+L80: .string "qfk"
+jmp L40
+L81: .string "yurjz"
+L82: .string "pkutfjjhbftxuatnfytd"
+L83: .string "dpkixrdqpmfzuvzyzzramqdj"
+jsr *r4
+L84: .data 973, -226, 808, 179, 39
+L85: .data -136, 111, -706, 93, -55, 346
+L86: .string "oaapmtxbzwkfbvpppebigbwm"
+L87: .data 349, -838, 517, -226, 485
+red r1
+dec *r7
+add L8, L22
+L88: mov #-105, L40
+L89: .data 47, -197, -920, -369, 658
+lea L219, r3
+prn *r3
+jsr L260
+L90: .string "nmsqsearzzku"
+L91: .data 515
+red r7
+L92: .string "tlrhyybohvvpbhgpzpy"
+L93: .data 159, 994, -296, -292, -52, 265, 148
+L94: .data 406, 743, -715, -482, -543, 31, 990
+L95: inc L102
+L96: .data 330, -379, -710, 765, 935, 625, -382, -287
+not r1
+L97: .data 600, 788, -68, 267
+L98: .string "nruhzyloekwlzsqrrr"
+L99: .string "iuxkesf"
+inc L176
+L100: .data -901, -430, 823, -977, 751, 893, 216, -497
+L101: .data 690, -630, -779, 116, 119
+L102: .string "gpseajwqqebqfgxmtjojjv"
+L103: prn *r6
+L104: .data 504, -117, -171
+L105: .string "hiretuhnqvdtwifejwic"
+L106: .string "rycg"
+L107: .data 914, -429, -686, 461, -137, 89, 129, -885
+L108: .data -247, -837, -90, 905
+L109: .string "kczkb"
+bne *r7
+L110: sub r6, r1
+
+add #139, *r0
+L111: stop
+bne L163
+not r3
+prn r0
+L112: .data -949, -928, -401
+jsr L292
+L113: .string "ucacxcqssib"
+
+jsr *r5
+L114: .data 88
+L115: .data -700, 691, 110, -837, 970, 884, -494
+L116: .data 308
+jmp *r4
+L117: .data -258, -4, 447, -228
+L118: .data -448
+L119: inc *r7
+L120: rts
+L121: .string "ksoiqxktwvkiuyoyxysdaom"
+
+L122: .data -612, 329, -675, 23
+
+inc *r7
+L123: .data -64, -503
+L124: .string "kj"
+add r1, L5
+L125: jsr *r5
+L126: .string "hwdwonwocutkeuszyhoy"
+lea L242, r4
+L127: .string "gjwnhnemgawbzrvolz"
+L128: .string "hcrjqrudnr"
+
+L129: .string "evph"
+; comment
+L130: .string "mwklfbpqciucb"
+cmp r0, r7
+rts
+L131: .data 928, -230
+rts
+L132: .string "bmqk"
+L133: .data 751, 265, 830, 161, 295, -519, -920, 959
+L134: .string "wrqgqyqjxikvqgaa"
+L135: .data 129, -322
+L136: .data 59, -654, -791, -279, -533, -499, -397
+L137: .data -796, -427, -848
+add r6, *r1
+L138: .string "egybshqmtalrxkynfrrxmje"
+L139: .data -626, 124, 24, 772, 596, -372, 760, 759
+L140: .data 609, 20, -77, 277
+
+L141: .data -158, -653, -152
+L142: .data -892, 304, -1, 245, 668
+L143: .string "culphbrdwtzbrl"
+L144: .string "owbo"
+L145: .string "mpfwboypozd"
+rts
+jsr L82
+L146: lea L248, r1
+L147: .string "ipunjhghvbhzhuube"
+
+L148: .string "ljrxqrupemcdefxwihjr"
+L149: .data -773, 882, -1000, -148, 79, -922
+L150: .string "iejbzoht"
+; comment
+jmp *r5
+dec r6
+L151: .data -232, -595, -109
+L152: .string "dcqosdekwfnakdfafjhhkyi"
+L153: .data 403, 164, -727
+L154: .string "sn"
+L155: bne L238
+L156: .string "ffdcafizfpsplrtw"
+not *r2
+L157: .string "avlkbrbr"
+L158: .data 139
+red L256
+L159: .data -44, -157, -325, -992
+L160: .string "vximygrvydrmqvc"
+L161: .data 450, -100, -664
+L162: .data 35, 139, 371
+L163: .string "owo"
+; comment
+cmp #47, *r0
+L164: .data -466, 80, 710, -293
+L165: .data 593
+red *r7
+L166: not L131
+dec L283
+lea L210, *r3
+lea L64, r6
+L167: .data 31, -637, -57, 59
+lea L335, L2
+clr *r2
+dec L318
+L168: mov *r1, r4
+L169: .data 341, -59, 370, -579, -871, 78
+L170: red *r7
+L171: .string "gi"
+L172: add #183, r0
+L173: .string "osvfjissoawqojtmuykk"
+L174: clr r0
+L175: .string "qhwowwovojkwiosu"
+dec L194
+L176: .data -332, -791, 669, 778, -537, -619, -680
+L177: .string "rdnkmodxaom"
+L178: .string "ebrvhpxqqqthpysslx"
+L179: .data 410, -733, -77, 567
+L180: .data -550, 823, -958, -249, -974, -130, 267
+L181: .data -736, 946, -980
+L182: .data 873, -493, -168, 702
+L183: .string "sjfxoakfsyaqqnyjoqphes"
+L184: add *r4, L335
+L185: .string "cm"
+clr r4
+L186: .string "waeriwqktgawv"
+L187: .string "ypovqhrs"
+L188: .data -60, -141, 433, 676, -761, -374, -434, 690
+L189: .string "ph"
+L190: .data -298, -774, 136, 850, -247, 378, 987, 990
+lea L306, *r5
+L191: inc *r7
+L192: .string "wcqbfsddwzvg"
+
+jmp *r0
+L193: .string "apkf"
+jsr L110
+; comment
+L194: .data 370, 532
+jsr L86
+L195: .data 846, -573
+stop
+inc *r2
+L196: .string "zjjzfvnmxbwhlf"
+L197: .string "lhorohtazbvilx"
+L198: .data -449, -606, -140, -713, 487, -405, 831, -442
+L199: .data 59, 160, 34, -84, -717
+L200: .data 904, 584, 537, 552, -376, -67, 552, -157
+red L119
+L201: bne L303
+L202: .string "fys"
+cmp L304, *r6
+L203: .string "oxtjbwbgoftbhdsnxuxubs"
+L204: .data -741, -499, -891, 835, 150, 673, -913, 743
+L205: .string "okqldbcpqmtn"
+bne L210
+L206: .string "tpdnmdpepmcg"
+L207: .data -222, -532, 462, 53, -729, 560, -551, -814
+L208: .data 602, -875, -926
+L209: .data -384, 197, -169, 867, -841, -464, 862, -529
+jmp *r7
+rts
+sub #-101, r2
+L210: .string "mmzhhdvshczzipwsobfnu"
+L211: .string "ul"
+L212: .string "wxtmkgiydjb"
+L213: .string "tavuyajokex"
+L214: red *r4
+add #-76, *r1
+L215: red *r2
+red L338
+L216: .string "xhhdduwfjyyqgioszkisisl"
+L217: .data 775
+not r5
+inc r4
+L218: sub #138, *r1
+L219: .string "nhhdvvudsr"
+inc *r4
+L220: .data 816, 584, 461, 767, 576, 470, 502, -197
+L221: .string "ttgsjhcdlxifgbeymtukqf"
+L222: .string "e"
+L223: .string "ai"
+L224: stop
+L225: .data -364, -646, -467, 960
+L226: prn *r6
+; comment
+L227: .string "cfsshl"
+L228: .string "jpswkwzikutoxyhplplkq"
+L229: .data 96, -763, 488, 220, -944, 288, -834, -506
+L230: .string "wprynypxpbngabcjmng"
+L231: .data -847, 147, 223, 638, 935, -654, 952, 145
+jmp *r2
+L232: .string "xgtssmjgtqicih"
+L233: mov #122, L13
+L234: .string "v"
+L235: .string "ckybdazifbcrzwhqiqexr"
+mov #-148, L91
+inc *r2
+L236: .string "fgamovhycsbnh"
+L237: .string "kwoeliwzmhargioj"
+L238: .data -823, -343, 231, 476, -569, 100, -757
+jsr *r3
+L239: .string "qpljntkz"
+
+L240: .data -133, -147
+L241: clr r5
+L242: .string "oygvbe"
+L243: .string "kcoudar"
+L244: .string "qrmxx"
+L245: .data -791, -318, -795, -657, 553, 248
+L246: .string "vho"
+L247: .data -190, 480, -282, -730, -138, -920, -183
+L248: .data 88, -68, 217, 915, 285, -496, 8
+L249: .string "laztziiqdupytjvtsk"
+L250: rts
+L251: .data 462, -456, -412, 758, -610, -264
+L252: .data -748, 481
+L253: .data 637, -291, 225, 21, 922, 710, -701
+
+L254: .data -238, -955, 349, 581, -754, -650
+add r7, L256
+not L283
+L255: .data 120, -559, -573, -367
+L256: prn L280
+L257: .data -176, 609, -532, -375, 819, 402
+L258: .string "cavjhjojznajtjvwudnq"
+L259: .string "iwofritkvniiqfcrjrspylz"
+L260: .data 30, -115, -530
+L261: cmp L308, #-111
+L262: .data -321, 693, -428, 164
+prn L330
+inc L62
+jmp L276
+L263: .string "sgzzwfaimcnqfq"
+rts
+L264: .string "xpxuumqkeontcopwcryhcdm"
+L265: .data -907, -889, 250, 867, 299
+L266: .data -605, -250, -204, -651, -395, 438, -138, -248
+; comment
+inc L269
+L267: inc L338
+L268: .string "hjdxxjrympfflmtvbqqfzkfn"
+L269: .string "mlfksyblhul"
+L270: .string "mjx"
+L271: .data -862, 981, 125, 769, -316, 315, -19
+; comment
+L272: .data 813, -248
+L273: .string "gw"
+L274: dec L293
+L275: .data 67, 754, -594, 682, -764
+rts
+
+L276: .string "ubzqcptkaseupuollt"
+L277: .string "ubqnutgatlalxzbhg"
+sub *r4, r3
+L278: .string "zjcpvzleupecxzxtefo"
+L279: .string "ijbkgxhmlfv"
+L280: .string "ccjqosvdbcrbdriujdaik"
+L281: inc r2
+L282: .data 784
+; comment
+cmp #138, #115
+cmp L134, *r6
+
+L283: .string "auvvkiwjibrmyraxs"
+L284: .string "a"
+L285: .data 474, 82, -330, 734, -910, -282, -790, 851
+lea L324, L304
+L286: .data -597, -497, -459, 554
+L287: .data 453, 794
+dec *r4
+sub L307, L10
+L288: .data 333, -223, 680, -386, 939, 182, -167
+rts
+L289: .data 414, 632, 264, 323, 782
+jsr *r3
+L290: .data 567, 408, -13, 215, -989, -735
+L291: .data 342, -439, -760, 958, 157
+L292: .data 350
+L293: .data -853, 44, 740, -720, -961, -536
+L294: .data 61, -745, 903, 20, -550, 183
+L295: .string "frenatsepymld"
+L296: .string "xlt"
+L297: .string "m"
+L298: .string "rnmvmjushvhsb"
+rts
+
+L299: .data -677, 606, 242, 656
+L300: .data 530, -658, 497, -285, -961
+sub L229, *r2
+L301: .data 975, 962, -547, -408, -632, 85, 149, -153
+L302: .data -18, 803, 259, 805, 885
+L303: .data -213, -592
+L304: .data 609, 575, 79, -914, -111, -154, -905, 312
+mov *r7, L323
+
+L305: .data -663, 971, 121
+add L37, *r1
+L306: .data 83, -198, -701, -76, 454
+jmp L302
+L307: .string "dgmhvkglwatimxvztvtks"
+L308: .string "unai"
+L309: dec r1
+L310: .data 930, 315
+L311: .data -229, 381, -675
+L312: .string "z"
+L313: .string "qbevhnwcopvgiizyj"
+cmp #-215, L154
+L314: .string "xgm"
+L315: .data -764, -100, 740, 744, -345, 295
+clr L10
+L316: cmp r0, r0
+L317: .data 593
+L318: .string "akuqu"
+L319: .string "xuqwpzz"
+clr L336
+L320: .data -887, -726
+sub *r4, *r1
+L321: .string "nhcdjjia"
+L322: .data -878
+L323: .data 687, -817, -459
+lea L333, r7
+L324: .string "rvodueltbwdbefngaxwphi"
+L325: .data 575, 408
+L326: .string "qwlzyexmsrnpemsnfpfntghh"
+L327: .data 569, 435, -91
+cmp L336, L252
+L328: .string "fqhqaglhkapidwaawxenlf"
+L329: .data 769, 317, 327, 893, 803, 97, -974, -454
+L330: dec L331
+L331: .data 175, 489, 491, -964, -757, 224, 766
+L332: .string "igsbrikmvt"
+jsr *r2
+L333: .string "rmgvjncohpsggwqjg"
+L334: .data 79, -102
+L335: .string "amckucgibrjbobnkqjjmfxgw"
+dec r2
+L336: .data 698, 232, 577
+add #-203, *r4
+inc L80
+red *r4
+
+L337: .data -293, 102
+L338: .data -716
+stop
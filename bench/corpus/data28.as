@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 29
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+L0: .data -494, 701, -72
+not r3
+L1: .string "ek"
+L2: .data -12
+L3: .data 872, 950, 918, 590
+L4: .data -918, 111, 498, -965, -1000, 765, 146, 338
+L5: .string "hopkfomlwtedptd"
+L6: .data -14, 166, 490, -509, -355, 96, -419, -185
+L7: .string "usfuokxqqa"
+L8: .string "trisjdydjcrqdwteuny"
+add *r1, r7
+L9: .string "zb"
+L10: .string "vuwsqjqqvisw"
+L11: .data 170, 878, -856, 397, -379, -777, 294, -238
+rts
+L12: .string "esoqzmfkyaqtcgqeiatdbr"
+sub *r4, L258
+inc L294
+jsr *r5
+add #-41, *r3
+cmp *r1, #-190
+L13: .data -731
+jsr L11
+cmp *r6, #-111
+bne L1
+L14: cmp *r7, #-80
+L15: .data 797, -466, -862, -397, -711, -167, 785, -346
+L16: .string "uqxcduni"
+L17: .string "gtbmrtiuloszbnjrhergxa"
+L18: lea L5, *r7
+L19: .string "v"
+bne L227
+L20: .data 916
+not *r1
+stop
+L21: .string "oxbvihdtleyvcl"
+dec r0
+L22: .data 785, 45, 568, 765, -998, -403
+L23: dec *r3
+L24: inc L160
+L25: .data 684, -143, 221
+L26: .string "alfyboabugntq"
+L27: .string "zmjknayutcaw"
+L28: .string "pkqmzjm"
+
+bne L5
+jsr *r1
+L29: prn *r1
+red L304
+L30: .data -351, 750, -875, 370
+L31: .data -249
+L32: .data 639, -625
+L33: .data -390, -586, 50, -110, 989
+red r6
+prn #-44
+add #69, r0
+L34: .data -774
+L35: .data 502, -953, 810, -92, 929, 594, -444
+L36: .string "cwiwqdlndzzsqhyns"
+dec *r4
+L37: .string "ffwsmjglytspnyay"
+not r1
+lea L66, *r2
+
+L38: .string "oijcngdrnjkebixh"
+L39: bne L34
+L40: .data -312, 41, 578, -463, 799
+red L254
+L41: .string "bhyiop"
+clr r2
+
+L42: .string "gepubefljcugki"
+not *r5
+L43: bne L18
+jmp L85
+stop
+inc *r3
+L44: .data -60, 406, 809, -629, 114, 235, 746
+L45: add L25, L66
+L46: .data 285, 779, 933, -210, -762, 394, -789
+L47: .string "uwclhwvzyehjqowgiglwqmvp"
+mov L218, *r7
+lea L216, r4
+dec L13
+L48: .data 835, -609
+L49: .string "nejzdmlub"
+
+sub *r5, r2
+L50: .string "tscikkmqlptls"
+L51: rts
+L52: .data 308, -301, -445, 221, -888
+L53: .data 896
+dec *r4
+L54: .data 111, 340, 700, -993, -663, -332, -529, -759
+bne *r6
+cmp L108, L43
+L55: .data 181, 867, 434, -231, -867, -958
+L56: .string "yx"
+L57: .data 954, 351, -197, -193, -25, 642, 972
+mov r3, *r4
+dec *r7
+L58: .data -299, 436, -841, -954, -677, 904
+cmp r3, r4
+L59: .string "repfvocwlgtixgcwsnpssenh"
+L60: .data -777, -902, -628, -10, -332
+L61: .data 469, 687, 346, -765
+L62: .data -894, 651, -731, 579, -745, 461
+L63: .data -110
+L64: .data 44, -94, -270, -341, 445
+L65: .data 487, -544, -118, 151, 838, -529, -767
+L66: add r5, L37
+sub r5, L9
+jmp L293
+L67: clr r5
+not L21
+L68: .string "xrqgdilnezuvzxvtoaasm"
+L69: .string "prsvdwmh"
+L70: .string "itfxufgjzhitkj"
+L71: .data -371, 686
+L72: .string "ojnyriwgfmqck"
+dec *r7
+L73: lea L309, *r0
+clr r1
+L74: .data 252, 706, 835, -219, 830, -784, 295, 479
+add #233, r4
+; comment
+
+stop
+L75: .data 899, 533
+add *r4, L48
+rts
+L76: .string "zj"
+sub L46, r6
+L77: add L149, r4
+L78: .string "lwnnce"
+L79: prn r7
+; comment
+L80: jmp *r2
+
+L81: .data -147
+L82: .string "jdqslnqyfqhqimwohmrizhsy"
+lea L207, *r5
+L83: .data -548
+L84: .data 717, 505, -788
+L85: .data 941, -950, -673, 359, -598, 919
+L86: .data -352, -855, 832, -391, 870, 224, 214
+L87: .string "mhxrcnkcf"
+L88: .string "ijetzcrje"
+prn *r0
+jmp *r4
+L89: .string "fuina"
+jmp L23
+L90: .data -258, -289, -499, -333, -773, 614, 81
+L91: stop
+L92: .string "mgogovnuwb"
+stop
+mov L210, L31
+L93: .data 663, -637, -819, 895, -908, 516, 819, -397
+L94: .string "riowuer"
+jsr *r5
+prn *r4
+lea L179, L177
+
+L95: .string "ikdkxidmvsjjohwzyier"
+L96: .string "jsqn"
+jmp L249
+L97: .data -150, -913, 460, 40, 109, 39, 69
+L98: .string "nsaloduwwalpvfj"
+L99: .string "ulfaymqhjdrooyuvjxkyhoyu"
+L100: .data -164
+L101: .data -278, -849, 671, -478, -568, -291, -940
+L102: .data 803, 883, 566, 662, -793, -966, 350
+L103: .data -676, -792, 40, -583
+L104: .string "cxiuquxwjtl"
+L105: add L116, L96
+
+not *r4
+clr r4
+L106: .string "paxrlxbptilqswabyaca"
+L107: .string "kdozkuqhmivpxaxcmbszjuuv"
+L108: .string "omwfddujrrkousjn"
+rts
+L109: .data -861, 292, -787, 800, 705, 334
+L110: .string "uyqonjrpmwluzbmhmdp"
+L111: .data -539, -214, -441, 751, 434, 80
+
+L112: .data 310, 403, 206, -284, 322, 359, -165, -616
+L113: .string "cydawblwlnisiievevlspvtv"
+lea L55, r6
+L114: .string "pbpfhsaisiwdprpanngds"
+L115: .data -558, 489, -794, -127, -539, -785, 808
+L116: .string "vgovzjprrxjlbtxeaqgbxghs"
+L117: .string "vjazyzelvygggiipu"
+sub #-153, L250
+
+L118: .data -877, -542, -148, -213, 207, -710, 900, -512
+rts
+prn #64
+; comment
+L119: prn *r6
+L120: .data 803, 734
+rts
+L121: .string "skfzdsgwipkcqtiyuud"
+L122: .data 847, 290, 565, -928, 357, 296, -690
+add #-110, *r2
+L123: .data 703, -459, -121, -869, -747, 62, -7
+L124: .data 94, 302, -190
+; comment
+L125: .data -885
+L126: .data -477, -698
+red L169
+L127: .string "xwjkjurtzptarhxbxgmpgqa"
+inc r5
+L128: .data 932, -237
+
+L129: stop
+prn r7
+L130: .data 511, 55
+lea L164, L147
+L131: rts
+L132: .data -626, -46, -341
+L133: .string "bgzdhjphrfjusgfbtnoev"
+L134: .string "kds"
+rts
+L135: .data -675, 558, -702, 333, -941, 269
+clr L94
+L136: .string "ztrtey"
+L137: .data -911, -951, 573, -622
+L138: .data 109, 610, 973, 254, -16
+L139: .string "utaeghtwsl"
+clr *r0
+stop
+L140: .data 122, -554, 743, -887, 22
+jsr L275
+stop
+L141: .data -614, -575, 629, -746, -674, -951, 483
+clr r3
+dec r5
+L142: jsr L220
+L143: .data -433, -336, -227, 880, 723, 602, 204
+L144: .data -650, -651
+bne L132
+bne *r2
+L145: mov L204, *r1
+L146: lea L161, r7
+
+L147: .data 37, 195, 253, 296, 105
+L148: .data 236, -187
+L149: .data -397, -845, -695, 845, 51, -948, 832, -716
+L150: .string "a"
+L151: .string "nthhxsejyzcdwcimnwyt"
+L152: .data -162, 468
+not L126
+L153: .string "yilyumvlgompqbzpqabx"
+inc L127
+
+L154: .string "jjxqgwtluhkyjfbnoak"
+L155: .string "fjujyigbbhxngcj"
+L156: .data -101, -852, -680
+rts
+L157: rts
+L158: .string "veqfvlgtvzg"
+cmp r0, L70
+bne L237
+mov r1, *r6
+dec L299
+L159: .data 451, 141, -742, -567, 58, -727
+L160: .data -919, -527, -402, 827
+L161: .data -576, 627, 906, 948
+L162: .string "z"
+L163: .data -589, -381, -983, -275, -646
+inc *r6
+add L69, L255
+L164: .data 744, 470, 628, 657
+L165: sub *r3, *r2
+L166: .string "hdrmqyofdscyschxsig"
+L167: .data -989
+L168: .string "l"
+L169: .string "kacwyedoraiuvyq"
+L170: .string "gapxihofijtrigspcr"
+L171: .data 689, -126
+prn r2
+L172: .string "gue"
+
+stop
+L173: .string "ohgkaanj"
+L174: .string "duy"
+L175: .data -753, -189, -282
+
+L176: .data -247, -769, 56, 417
+sub L272, r1
+L177: .data 517, -99, 44, -418
+
+jmp L301
+sub #-27, r5
+jsr L4
+L178: add L66, L15
+L179: clr r6
+L180: .data 227
+L181: jsr *r6
+stop
+L182: add *r6, r6
+L183: .data -208, 409, 593, 571
+inc r3
+lea L227, r7
+stop
+L184: .string "lcumkbpswmgdf"
+rts
+L185: .data 543, -371, -280, 534, 987, -106, 128
+lea L137, r2
+L186: jmp L111
+L187: .string "igrqazhda"
+L188: .string "fnwdt"
+L189: clr *r7
+L190: .data -238, -734, -995, 227
+
+not r3
+L191: add #210, *r4
+L192: .data -965
+L193: .string "slb"
+L194: .string "ayronfjpbkxdbwbjtptf"
+clr *r2
+L195: .data -576
+L196: .data 591, 61, -748, 623, 424, -368, -237
+L197: dec *r1
+sub r7, r6
+L198: .data 842, 571, 502, 992, 221, 506, -253
+L199: .string "solokpmhjoairgqrvjz"
+L200: .data -138, 33, -552, -379, 198, 463, 64, -549
+L201: .string "oskcgvxralxvkto"
+lea L163, L10
+L202: .string "gjjbtjtirrsfru"
+L203: .data 775, -778, 672, 832, 109, 578, -525
+not *r5
+
+L204: .data 271, -632, -797, 277
+L205: .data -634, 868, 774, 321, 513, -115, 582
+L206: .data -722, 282, -105, -943
+bne *r2
+L207: .string "peno"
+L208: .data 8, -497, -982, -140, -654, -326
+
+L209: red L252
+L210: .string "wekdzeuhpjeftkl"
+L211: .data -285, -254
+clr *r7
+L212: .string "iqkuythxkrqbrfvbuqhxa"
+; comment
+L213: .data 199, 872
+
+L214: .string "hqlqvswibjdvhnepsy"
+L215: .string "kqvorcqlxdehpnemv"
+L216: .data -653, -887, -986, 904, 925
+L217: .string "zqrepsmqqv"
+L218: .string "hssjbxrgqttmnjtsf"
+L219: .data -238, 434, -630, -233, 875, -275, -364
+L220: .string "lshcevziyvzqhikmipfsswde"
+L221: .data -156, 686, 273
+L222: .string "uxhrhbci"
+L223: .data 426, -241, 792, 151
+dec *r2
+L224: .data -581, -711
+L225: .string "zqoxfplf"
+L226: .string "xvxbtwiytds"
+L227: .string "fkvewophuivqzkgvsiglo"
+dec L271
+L228: .data -678, -818, 661, -811, 837, -40, -412, 887
+inc L220
+clr r4
+add *r7, L279
+L229: .string "dkcujucgfejg"
+L230: sub r7, r4
+L231: .data -611, -596, -372, 930, -888, -909, 924
+red L116
+dec *r7
+L232: .data 861, -569
+L233: .string "fyvjpsdlficsvzrru"
+L234: .string "mpy"
+add L263, r0
+L235: .string "gpajbdouarqj"
+clr L262
+L236: .string "fjzkgyrj"
+L237: .data 720
+jmp L109
+L238: dec *r7
+L239: .data -625, 526, -576, 765
+L240: .data -514, -632, -997
+L241: .data 709
+L242: .data -57, -216, 646, -998, -384
+L243: rts
+inc r0
+L244: .data 993, 424, 962, -864, 964, -667
+L245: .string "ytrpuhbgd"
+L246: .string "uezctxplowoos"
+red L194
+L247: .string "lcdisngyocou"
+L248: .data -696, -368, 277
+dec L285
+L249: .data 803, 392, -182, -522
+dec *r0
+clr r1
+L250: .data 904, 633, -764
+L251: .string "coujhdvkgckpjj"
+L252: lea L196, r6
+L253: jmp L120
+L254: .data -173
+mov #161, r4
+stop
+stop
+L255: inc r7
+L256: .string "cntmpvrsqdjupusc"
+sub L17, *r5
+L257: .string "vnzrwgzpdkgomiybev"
+L258: .string "szrizxzwnwluwclofssxq"
+mov *r5, r2
+L259: .data -829
+add *r5, r2
+jmp *r0
+
+prn #-240
+L260: .data 713, -218, 871, -415
+sub *r7, L300
+L261: .data -816, 753, -572
+L262: .data -518, 219, 792, 969, -827, 987, -464
+clr L296
+L263: .string "bntqrcarqa"
+cmp *r2, L308
+L264: inc *r3
+L265: .data -59, -481, 947, -337, -401, 629, 923
+mov *r7, L301
+L266: .data -335, 917, 700, -453
+L267: .string "wethn"
+L268: lea L72, r2
+sub L249, L149
+L269: lea L284, *r3
+dec r6
+L270: red L30
+stop
+cmp #13, *r2
+L271: .data -605, -449, 10, 854, -288, -748
+L272: red *r7
+prn #196
+L273: .data -378, 285, -326, -449, 777, 995, -154, -950
+; comment
+L274: .data 650, -213, 377
+L275: .string "tk"
+L276: .string "ucyrl"
+bne *r5
+L277: .string "cusdbssdmynfvvdjkzgk"
+L278: .string "uecebovj"
+L279: .data -716, -248, 97
+L280: .data 337
+add L284, L207
+L281: .data 189, 713, 620, -420, 451, -479, -469
+L282: .data 652, 764, 387, -104, -515, 260
+prn L7
+bne L291
+bne L293
+bne *r0
+L283: .data 988, 870, 940, 982, 462
+L284: .string "qljdjuojya"
+L285: .data -262
+L286: .string "fjiblrrin"
+cmp *r6, r6
+L287: .data 921, 637, 89, -488, -318, -317, -48
+prn r2
+L288: .string "pqrpmsqfklbhgalfk"
+red r6
+clr L33
+L289: .string "sghulgr"
+L290: .string "mrojpzqekwinczu"
+L291: .string "mpypvplwlad"
+
+red r2
+; comment
+L292: .data 906, -207
+L293: .data 843, 467, 498, 590, 457, -507, -423
+L294: .data 759
+L295: .string "x"
+L296: .string "txxzmfptiavxhcv"
+stop
+rts
+L297: .data 617
+clr *r1
+L298: .data -592, 109
+not *r1
+L299: .data -595
+L300: not *r4
+L301: .string "plallwcqkhtmbwyzfbm"
+L302: .data -627, -925, 169, 722, -868, -262, -733
+add L309, L306
+L303: .string "upklradrepljlvaejpum"
+stop
+L304: add r0, *r0
+L305: .string "znnnuuhgscmodxeqrup"
+L306: .string "mmtmnfgrtgvlphdpdelrrwxf"
+L307: .string "aqcjvxpiai"
+L308: .string "yq"
+prn #72
+L309: .string "smwrvjszwnvnnkuehxgscgw"
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 30
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+
+L0: .string "xivfxdx"
+L1: .data -204, 740, 457, 377, 619
+add #193, *r7
+; comment
+L2: .data 731, -518
+L3: .data -407, 287
+L4: .data -35, -586, 676, 186, -367, -374, 863
+inc *r0
+cmp L291, *r1
+L5: .string "zrfkbvsuatrkbjyevucrvpl"
+L6: .data -3, -100, 653, -561
+L7: .string "hrxgmguaolpfupemd"
+L8: .data 668, -611, -986, -665, -532, 546, -631
+L9: .string "rqimwnewcvclswtkvd"
+L10: .data -977, 325
+bne *r0
+L11: .string "xjizyybxkt"
+L12: .string "gjdwjso"
+add L34, r5
+jsr L7
+not L2
+L13: .string "pw"
+L14: .data -529, -968, -71, -267, 972, -256, 111, -619
+red L175
+prn r4
+dec r7
+L15: .data -89
+L16: .string "j"
+L17: .data 611
+inc *r3
+mov r1, r2
+L18: .string "acrttylev"
+bne *r2
+L19: .string "jaokclbzyh"
+L20: .data -884, -908, -390
+not L244
+L21: dec L13
+clr *r7
+L22: .data 604, -139, 86
+L23: .data 772, -699, 561, 937, -767, 186
+L24: .string "npxuhflqadyiawp"
+L25: .string "yojekefzrat"
+L26: .string "u"
+L27: .data -618, 985, 349, -917
+rts
+L28: .string "smppjpslpjbuikpsriwxxc"
+L29: .data 711, 964, 879, 832, -850, -399, 573, 211
+L30: .data -876, 877
+L31: .data -72, -696, -771, -556, -337, -503, 951, 402
+L32: .data 509, -656, 931
+L33: .string "nqbcokqfbafoq"
+L34: .string "ujdxdsswpt"
+mov L238, r0
+bne *r3
+L35: .string "jbpfnygzzamrsrq"
+L36: .data -768, -338, 930, 562, -658, 590, 890
+jmp L134
+L37: .data -941, 124, 417, 152, 53, 676
+L38: .data 211, 75, -362, -107, 914, 807, 75, -893
+stop
+L39: .string "udbte"
+L40: .data -654, -152, -861, 726, -409, -778, -317, -802
+L41: .data 214, 278, 898, 742, 181, -207, -807, 392
+L42: .string "ezqfbkjwtnzxeszbbuw"
+L43: .data 551
+; comment
+clr *r0
+stop
+L44: rts
+L45: .data 377, 824, 186, 960, 516
+rts
+L46: .data -677, -829, 274, 375, -628, 563, 569, 120
+L47: add *r2, r0
+L48: .string "wxaqbkbdkcwhoplayxrl"
+L49: clr L49
+L50: .data 819, 598, -825, 597, -731, 217, -128, -929
+red *r4
+stop
+L51: .string "tkgjghsskjzbykeyonggsvod"
+L52: .data 503, -998, -810, 664, 722
+stop
+rts
+L53: .data 761, -821, 326
+L54: sub #-207, L171
+; comment
+L55: .string "vzlbpzyirudozluslgzsbu"
+L56: .data 769, -163, 12, -928
+L57: jmp *r6
+L58: sub r2, *r5
+bne L3
+dec L127
+L59: .string "tq"
+
+L60: .data -549, 245, -510, -703, 303, -272, 622, -486
+not *r6
+L61: .string "yweeg"
+L62: inc L50
+jmp *r4
+L63: .data -823, -566, 403, 747, 597, 597
+L64: mov L62, r0
+L65: .string "iyylkhvhgzzvzwvzozvi"
+L66: .string "fdxhbpouaoup"
+L67: .data -725
+red r5
+red r0
+
+mov L117, *r7
+red *r6
+L68: .data -727, -434, -681, -190, -691, 974
+L69: .string "cs"
+L70: .string "tsvwmpphvkwjqcywrfq"
+L71: .data 428, 833
+cmp #-2, #238
+L72: .data -929, 185, -600, 838, -638, -568, -908
+inc *r4
+jmp *r6
+L73: .data -542
+L74: lea L166, *r6
+L75: .string "qvncfxzckszvj"
+stop
+L76: .string "jlorsjqvxkdacesvpg"
+L77: .data 141, -744
+L78: .string "zk"
+jsr *r1
+L79: .string "znnwuyhmdfdphimt"
+L80: .data -973, 701, -490, -27, 502, -853, 66
+L81: .data 136, -901, 820, 427, -844, 311, 584
+L82: .data 502, -340
+prn r6
+L83: .string "xv"
+L84: not *r5
+L85: .string "eoyrctfjta"
+L86: .string "qyojvktljaguucccn"
+L87: .string "lheur"
+not r5
+sub *r1, *r6
+L88: red L114
+L89: .string "qbyuxnoqewbmfhzwcg"
+L90: .data -466, -251, 345, 217, 40, -227
+L91: .data 109
+L92: .string "simszdeazjuzlynoupjamr"
+sub r4, L31
+L93: .data -764, -996, 95
+jsr L32
+L94: .data 777
+L95: .data -379, 430, -527, 571
+stop
+L96: .data 494, -881, -187, -67, -553
+L97: .string "ymyezchtnlshyuaovn"
+L98: .string "tlmvgoysussrzgwqhisf"
+L99: .data 309, 751
+L100: .string "ottbyeykjeheemiwcrod"
+sub *r3, r0
+L101: .data 787, 708, -573, -836
+stop
+cmp L115, r0
+L102: .string "oocxalighjg"
+L103: .data 718, -486, 423, -272, 455
+L104: .string "lciabijzoybq"
+L105: .data -158, -538, 819, -293, -597
+L106: .data -509, 44, -96, 878, -629
+
+L107: not *r5
+L108: clr *r2
+L109: .string "vefsavpejekwucjzrir"
+L110: .string "fqlhovkknjortgzoap"
+prn r1
+dec r3
+inc L37
+L111: .data 723, 283, -470, 95, -280
+L112: mov r3, r6
+L113: .data 780, -109, 2, -530, -728, -406, 873, -80
+L114: .string "bveumqdyuyw"
+rts
+L115: .string "vuvkcbwlzgjdgf"
+L116: .data 599, 978, -159
+L117: jsr L324
+L118: .data -615, 142, -691, 994, 277, -480, 513
+L119: .data 8, -892
+L120: .string "nbnqbx"
+L121: .data -979, -153, -613, 851, -587
+L122: .data 123, 608, -30, -271
+L123: .data -844, 55
+rts
+lea L161, *r5
+add *r7, r6
+inc *r0
+L124: .string "mjchxztsdkk"
+L125: jsr *r0
+L126: clr *r3
+L127: .string "c"
+L128: .string "fdxnwfnabmhxhxtsoem"
+dec L9
+inc r6
+L129: .string "g"
+L130: clr r6
+L131: .data -2, -835, -755
+L132: .string "xvvhjslibfsumyueh"
+not *r6
+L133: .data 149
+L134: .string "wayphuf"
+L135: .data -754
+L136: .string "flzkwoxnptulmvhaxthxsu"
+red *r7
+L137: .string "zegaeruphqblodxtve"
+L138: .data 52, -508, -139
+L139: .string "xwcdzlcjlnexk"
+L140: .data -659
+clr *r4
+L141: .data -441, 989
+sub r0, r7
+cmp L17, L35
+L142: .string "t"
+L143: .string "tusn"
+lea L269, *r6
+L144: .data 431, -948, -59, 261, -83, -830, 17
+L145: .data 982, 206, 124, -251, 865, -372, 136
+L146: .data 953, -896, 247, 168
+L147: .string "xlmrusadpmuotxmqddjfb"
+dec *r1
+stop
+sub *r2, *r7
+L148: .string "bzredstcuzjpzgnngluq"
+L149: .data -956, -766, -560, -589
+L150: .string "yxlwwpjxyslfpj"
+L151: .data -444, 282, -736, -689, 589
+L152: .data 152, 352
+inc *r3
+L153: .data -868, 112, 492, -734, -625, 453, 519, -301
+L154: .string "lwhmtvrgur"
+prn #188
+jsr L9
+
+L155: .string "kaxrgpk"
+L156: .data -642, 413, -91, -744, -417, 918
+L157: .data 984, 944, 838, -629, -718
+
+L158: .string "vq"
+L159: lea L119, L206
+rts
+L160: .string "ljkmcuxlkylzquicpejuxrg"
+L161: .string "ysuqcwddvkfzuxzin"
+L162: .data -443, 849, -805
+stop
+L163: .data 963, -818, 291, 965, -787, -983
+red r3
+inc r4
+mov L41, L202
+L164: .data 938, -814, -397, -761, 513, -480
+L165: .string "jagiwmxtcytvpnlzznf"
+L166: .data 634, -700, 66, -686, 556, 923
+L167: .string "sadifvygz"
+mov L313, r7
+L168: .string "tdxxh"
+L169: .data -855, -867, -389, -954
+L170: .data -996, -464, -438
+L171: .data -731, 532, -85, -92, 920, 593, 704
+L172: .data 431, 331, -828, -161, -444
+L173: .string "odtxsfuspks"
+L174: .string "ymrzaiav"
+L175: .string "vbqxyjakoqdwsfqy"
+L176: clr *r1
+L177: .data 881, 45, -110, -14, 92, 823
+mov r3, *r2
+add #-158, *r2
+jsr *r0
+sub L198, r5
+L178: .string "oahtbtfshoxdxskzgkpx"
+L179: .data 110, -127, -510, -615, -913, 188
+L180: .data -912, -261, 347, -369
+mov r1, *r5
+L181: .data 979, 275, 950, 354, -390, -654
+L182: .data 361, 149, -387, 317, -10, 592
+jsr *r1
+L183: .data -664, 521, -973
+
+L184: .string "etdxwkfhiyifb"
+L185: .string "yprwjhzcnppuhmuj"
+L186: .data -654, -608, -979, -361, 75
+not L105
+L187: .data 375, -274, -801
+clr *r0
+clr r6
+L188: .string "boulzlcxvprkmlyusfhn"
+L189: .data 220, -140, 492, 550
+L190: .data 509, 983, -679, -624
+L191: .data -735, -884, 998
+dec *r2
+L192: bne *r6
+stop
+L193: .string "tfag"
+L194: .data 931, 708
+L195: .string "nrguewadbfwhbiywkbwr"
+L196: .string "pmg"
+L197: .string "idzlzpfifzfnmkqytgpvuqj"
+add r5, *r0
+L198: .data -149, -921
+L199: .data 282
+L200: .string "yfhbitcc"
+L201: red L43
+prn *r7
+
+red L116
+L202: .string "fvjnkjwyiefndvzzvldyxod"
+cmp #-181, #202
+L203: .data -972
+L204: .string "dzdgpnnmohkqcicwl"
+dec *r0
+L205: mov #-14, r3
+L206: .data 347, -915, 477, 144, -477, 218, 947
+L207: .string "afybqkfkzevkkdtn"
+dec *r7
+dec L282
+cmp L318, *r0
+L208: .data -948, 169, -218, 964, -948, 430, -900, -826
+L209: .data -148, -461
+not L182
+add #71, r1
+L210: .data 483, 948, 593, -634, 721, -649, -170, -590
+L211: lea L24, L221
+L212: .data -649, 351
+rts
+L213: .string "leogr"
+sub #173, *r4
+mov r5, *r1
+L214: .string "ixspqvc"
+L215: .data -676
+L216: .data 292, -192, 455, 308
+bne *r3
+L217: .string "q"
+L218: not r2
+L219: .data -900, -934, 726
+L220: lea L240, *r5
+L221: .data -844, 303, -584, 681, 325, -321, 301
+mov r2, *r7
+L222: .data -140, -379, 770, 552
+L223: .string "brylpa"
+not *r6
+L224: .string "xrcamjw"
+L225: .string "dyb"
+rts
+L226: .data -804, 467, 484, -676, -870, -699
+L227: .string "qtuzjqru"
+L228: .string "sukhzqgjjndeumtfcohun"
+L229: not r0
+prn r6
+L230: .data -742, -311, -330
+L231: .string "kkgzkbkxsgjseamcik"
+add #-45, L247
+L232: .string "lxlbclvcdneyfgkmo"
+not r6
+L233: lea L71, L323
+L234: .string "zdntzudfarlcmvgrsrig"
+not *r0
+L235: .string "bcbsysvstpwddzhhz"
+L236: .data 898, -493, 195, 671
+L237: .data -574, -78, 378, 871, 469
+L238: .data -904
+not *r2
+lea L188, L11
+inc L326
+L239: .string "qnlinzxohsqullf"
+L240: .string "hxrsyfsxpbmqqxjrwzjllhj"
+L241: prn #-61
+dec r1
+stop
+L242: .data 607, -528, 947, 440, -404, 388, -704
+L243: .string "lqiuoetf"
+L244: .data 175
+L245: .string "ioblalviqxvzvdaauunnbkvh"
+L246: .string "op"
+L247: .string "rsnfgeiqtqhbdwwuhaa"
+L248: .data 196, 794, 114, 525, 400
+L249: .string "afaborhbrdkwg"
+rts
+prn L158
+L250: .data 151, 969, -231, -373, -534
+prn #183
+; comment
+
+clr L254
+L251: .data 934, -164, -234, -89, -675, -131
+stop
+L252: .data 418, -696
+L253: lea L249, L16
+L254: .data 991, -124, 803, 698, 580
+L255: .string "le"
+stop
+L256: .data 599, 445, -235, 597, 878, 175
+L257: not L277
+L258: .string "raerzefkh"
+L259: .data -472, 20, -902, 649, 585, 702, -840
+rts
+L260: .data -822, -979, -54, 999, 959
+L261: .string "mcnlldrtzkbengbxzfiss"
+L262: .string "ppw"
+L263: .string "aubxtdygfcyyykhqe"
+L264: .string "dlbseqottmdzwp"
+L265: .string "scfipzjydhrb"
+L266: .string "yjbuajnetlnbpupggzlk"
+L267: .data 934, 79, 382, -895, 952
+L268: .string "ns"
+dec L154
+L269: .string "buurfsibiohlyve"
+dec r6
+cmp L200, L128
+L270: .data -695, -187, 535, -713, 740
+L271: .string "dghcswngjbtoxtr"
+L272: .data -873
+red L308
+L273: .data -286, 919, 575, 600, 160, -715, -106
+prn #-168
+L274: .data -752, -264
+L275: .data -686, 912, 134, 876, -357, 961, -612
+L276: .data 173, 751
+not r3
+L277: .data -137, -740
+L278: .data -354, 131, 917, 467
+jsr L197
+L279: .data -981, 899
+L280: .string "eosjfibdkslwsbnsz"
+L281: .string "fydnduccmq"
+sub r6, L284
+L282: .string "evdbqrxnxmmcpmrogzroaay"
+L283: .data 924, -324, -939, -667
+prn *r3
+L284: add L286, *r3
+L285: .data -155
+L286: .string "xxpoyln"
+mov r2, r7
+L287: .string "gxdxzjbdbuedihevyk"
+
+sub r5, r2
+L288: .string "wiuvfkvhpovxsmnzrxjllie"
+L289: .string "smitsvbhjqiym"
+L290: .string "geqrfi"
+L291: .string "ektnjfyimankiufgi"
+L292: .data -32, 743, -328
+inc *r7
+red L324
+rts
+L293: .data 4, 145, -408, 343
+L294: .string "msdkcntxrkpa"
+L295: .data -990, 245
+L296: .string "afebixjrpsqqzsxbuyzibgjb"
+L297: .string "tbvhugneejvefrdi"
+jsr L309
+L298: .data -906
+L299: .data -204, -363, -859
+dec r0
+sub L79, *r4
+jsr *r6
+L300: .string "gefnxuccoqjkim"
+L301: prn #127
+L302: .data 439
+L303: .data -541
+L304: .data -97, 701, -484, -681, 663, -465, -776, 944
+L305: rts
+bne *r3
+L306: .string "qvoqaxswxyxzdaogo"
+L307: cmp r1, L329
+L308: .data 992, 841, -21, -217, -809, 330, 870
+L309: .data 751
+L310: .string "kigbsdbtbupiwutr"
+
+L311: .data 554, -930, 239, 422, 284, -936
+L312: .data -789, 976, 250, -877, 407, 732, 808
+L313: .string "erdrfkempdwttczfgckiv"
+L314: .string "vqnufkphrkhrn"
+L315: .data 614, -324
+add #-99, L321
+L316: .string "uslvpdkkcfzsteycndmezx"
+cmp r3, #12
+stop
+L317: .string "qvmtvvah"
+L318: add #222, r7
+cmp *r4, *r6
+L319: .string "poj"
+L320: .string "lmgqwyrqzabvgtygf"
+prn r6
+add *r3, r0
+stop
+L321: .string "oddmzmsgpfyyohphmquus"
+clr L303
+L322: add #138, *r1
+L323: .string "afcadxqxskelrejbfwng"
+red L179
+not L278
+L324: .data -383, 518, -706, -515
+jmp *r5
+red L277
+L325: .string "itnmvnwhwv"
+L326: .string "etqwvrrodwrdxnxyghq"
+L327: .data 752, 662, -93
+L328: .data -499, -939, 304, -346, -625, 834
+add L329, r6
+L329: .string "ndiplysvzqsieptwwocv"
+bne *r0
+L330: not r4
+stop
@@ -0,0 +1,525 @@
+; Generated by genCorpus --seed 4
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+L0: .string "wzzzvk"
+L1: .string "dtjhazccgxbrzw"
+L2: .data 105, -506
+L3: .data -13, 470, 738
+L4: red *r0
+L5: .data 389, 921, -460, 624
+L6: .string "jjolkavv"
+L7: .data 379, -840, -909, 533, -973, -913, -360, 211
+L8: mov r6, r5
+L9: .data 612
+sub #249, L317
+L10: .string "mps"
+L11: .data -73
+L12: .data -921
+L13: .data 545, 574, 909, 602, 924, -703
+cmp L0, r6
+L14: rts
+L15: .string "g"
+L16: .string "muzgssxzdxbexclft"
+lea L327, *r7
+cmp #-70, r2
+jmp L4
+L17: .string "yrxpvhsqrxtzeulnlpfpyqtw"
+jsr L7
+L18: .string "ssajjocjoly"
+L19: .string "rqftolsevqxnfmiw"
+L20: .data 593, 414, 23, -261, 655, 211
+L21: .data 630, -78, -378
+L22: .data 86, -457, 165, 734, 51, 726
+rts
+L23: .data -229, 819, -752, -126, 915, -762, 564, -227
+L24: .data 163, 18, -227, 625
+bne *r5
+clr r2
+lea L0, r4
+inc r1
+L25: .string "otetyuxvdadqubxho"
+L26: .data -887, 645, -408, -371, 822
+inc r7
+L27: .data -26, 421, -526, -636, 363, 805, 449
+L28: .string "ywyo"
+clr *r5
+L29: .data 22, -381, 33, -180
+
+L30: .string "qyqcnfpobuze"
+L31: .string "hsxxlyulswwurr"
+L32: .data -425, 730, 395, -654, 702, -930, 275, 613
+L33: .data 526, 969
+L34: .string "kohjeelq"
+add #-88, *r6
+L35: .data 220, -3, -108, -843, 259, 26, 62
+L36: .string "ys"
+L37: .string "nic"
+L38: .data -327, 551, -437, 635
+not r5
+jmp L24
+L39: .string "ctjjxmgmjzfvgwpolndr"
+add *r6, r7
+L40: .string "ctqrdtlet"
+prn r0
+lea L25, r1
+L41: .string "hhxgqeaucyfttqsblkh"
+L42: .string "rstoxzfwasucg"
+red *r5
+not *r3
+L43: .string "orhiyi"
+L44: .string "nxhmwdphewpraq"
+prn #152
+inc *r4
+L45: .data 663, 144, 45
+L46: .data 602, -471, 815, 14, 149, 873, -540, -390
+L47: jmp *r5
+L48: .data 399, -6, -71, -387, -620, 308
+L49: .string "xergrcthdurhjqjtcfqssivt"
+L50: .string "bcwucmbyqrxcmecayadgk"
+L51: .data 218, 310
+L52: .string "aivcrbw"
+L53: .string "porvhdwyllnuy"
+; comment
+L54: .data -771, -538, 230, 982, 281, -763, -752, 1
+not r4
+L55: .string "ovvi"
+L56: stop
+L57: .string "bhgvierd"
+L58: stop
+L59: .string "eqxqyi"
+inc *r7
+jsr L141
+sub L31, L152
+L60: .string "zgamgihoqxwplnnpqyvjuxhn"
+L61: jmp *r6
+L62: .string "lupqlfzsxr"
+L63: .data 755, 450, 799
+L64: .data 848, 641, 813, 278
+L65: .data 850, 94
+L66: lea L298, L326
+L67: .string "vkykknpfcqtefzlguzngsys"
+L68: .data -987, 373, -655, 98, -510, 649, -279, -445
+L69: .string "opfg"
+; comment
+L70: .data 662, 400, 990, 445, -199, 946, -683, 401
+L71: .string "lfj"
+L72: .string "kk"
+L73: sub *r0, *r5
+L74: .data 875
+L75: .data -717, 208, -146, -979, -962
+L76: rts
+dec *r4
+lea L243, r7
+L77: .string "y"
+L78: lea L278, *r1
+L79: .string "zqbsxfsftduocryauthsbdzf"
+
+L80: .string "wxzoxybxp"
+L81: .data -96, -774, 723, 957, -852, 324
+red L8
+; comment
+L82: .string "ptlfkldq"
+L83: .string "prpmctfpytwblqwqphn"
+L84: .string "bebvngzommf"
+; comment
+lea L285, *r1
+lea L57, *r0
+L85: .data 409, 979
+L86: inc L199
+clr L300
+L87: .string "cxzwtlunfhqkntvrxfaqsoyb"
+L88: .data -167, -83, -904, -870
+L89: jmp *r6
+add r7, r0
+L90: .string "jxqtnnzq"
+L91: .string "oqlwagcxczlkiuu"
+clr *r4
+L92: .data 259, -494, -589
+L93: .data 772, -841, -981
+L94: .data -145, -821, -920, 441, 851, -359
+prn #125
+L95: .data -485, -43, -74, 63, 297, 504, 736
+L96: .data -405, 416, -349
+add L240, r3
+L97: .string "kf"
+L98: .data 542, 196, -673, 280, -573, -405, -646
+red *r4
+not r4
+; comment
+L99: .data -981, 334, -407, 861
+L100: not r0
+prn L0
+L101: jmp *r7
+L102: .data 560
+L103: .data -92, 295, -129
+L104: .string "cxyoxzaqasyevsiysfxqzwc"
+sub *r6, L55
+L105: .data -824, 895, -169
+L106: .data 57, -462, -31, 215
+L107: .data 494, 91, -772, -283
+L108: .data -426, -758, 104, -955
+L109: .string "semc"
+L110: .data -538, -37, -241, -376
+L111: .data 841, -319, 42, 682
+L112: .string "rsexrpkckxmczr"
+L113: .string "hatquszcfnpbqlcyataikaz"
+L114: .string "inheujjcqkokyseex"
+L115: .string "gh"
+L116: .string "fkzskdujkrtnasveigee"
+; comment
+prn *r6
+L117: .data 630, 80, 311, 539
+L118: .string "ijxwgvwnuclerig"
+L119: dec *r0
+L120: .data -599, 805, -252, 340, -601
+L121: .string "mpetmljgbdpofldy"
+L122: .data 618, -929, -169, 567, -201, 226, -451, 223
+L123: .data -3, -502, 175
+L124: .string "syidmnnr"
+L125: .data 39, -573, -974, -114, -849
+L126: .data 895, -959
+L127: .string "fy"
+L128: .string "xumummkkenbshwbfpg"
+prn #-53
+L129: .string "r"
+L130: .string "bjrcuuofkydghncnmojp"
+L131: .string "awaurksq"
+inc r2
+dec *r6
+L132: .string "hyteqyykqk"
+L133: .string "szhfqtsa"
+L134: .string "iq"
+L135: .string "fnuys"
+L136: .data 600, 30, -518, -226
+L137: .string "ckddaofebpw"
+L138: .data -145, 834, -105, -954
+L139: .data 385, -706, -699
+L140: .string "aihspqocmughrhsvgrmczi"
+
+L141: .data -294, -16, 935, 829, -981
+L142: .data 73, 501, 335, 538, 321, -707, -16
+not L268
+L143: .string "negtlloz"
+L144: .string "uqpifxpyhktjirx"
+not *r6
+L145: .data -792, -636, -140, -436, 686, 915, 901, -968
+L146: .data -282, -96, -241, -363, 409, 830, -945, -152
+L147: .string "sdeiesglxhbyowomshspbc"
+L148: .string "yz"
+L149: .string "hjotovpqkddbmorhrgnhjtte"
+L150: .data 228, -523, 422
+; comment
+L151: .string "jhsdwjcl"
+red *r1
+L152: .data -91, 22, 927, 403, -502, 818
+L153: .string "vdosbzjypr"
+L154: .data 391, 719, 995, -760, 865, 385
+L155: .data -569
+L156: .string "zpfqfhi"
+not *r2
+L157: .string "skrjkrrwpcpqfbiit"
+L158: .data -299, -114, -57, 806, -731
+sub *r0, L46
+L159: .string "impumqbmm"
+dec r5
+L160: bne L30
+L161: red *r2
+L162: .data -577, -369, 548, 56, 413, -439, 849, -975
+L163: .string "uqo"
+L164: .data -514, 447, 47, -447
+L165: .string "j"
+L166: .string "tpugzzlrwszcqixubmzi"
+L167: .string "evafntmhrctmlxjigdw"
+L168: add #-254, L93
+not L309
+L169: .data -21, 460, 925
+L170: .data -916, -349, 172
+jmp *r5
+jmp L278
+L171: .string "ttgeakexfxhrmefbjqefjag"
+L172: .string "ytgavrverkiozbmlzj"
+L173: .data 758, -894, -279, 845, 689, -942
+L174: .string "rnwhcjqnay"
+inc r4
+L175: .string "fopshhyqpawh"
+L176: .string "tcluupqwtqhtuwyvuopfuex"
+; comment
+L177: .data 509, -842, -689
+rts
+L178: .string "yhmzlqblhkmiitsvl"
+stop
+add L241, *r1
+L179: jsr *r7
+L180: .string "pqwxnvuj"
+jsr L184
+L181: .string "lbofhz"
+L182: .string "rcsxfbes"
+cmp L269, r5
+L183: .data 845, 303, -823
+L184: .data 111, 15, -465, 365, 3
+L185: .data 187, 718, -584, 8, 70, 197, 967
+red r6
+L186: .data -172, -703, 367, -461
+L187: .data 769
+L188: .string "kpoxjzhveukm"
+L189: .string "gkqzuzwxhna"
+
+L190: .data -124, -658, -860, 270, -870
+clr *r5
+L191: .string "asevwsyuqgypbtypdlskay"
+L192: .string "tedfqtvuavdmgjmkkfrd"
+L193: .data 772, -538, 180, -19, -584
+L194: .string "yb"
+L195: mov #119, L244
+cmp L32, L243
+L196: .string "ryehqccpcprgpe"
+mov r4, L293
+L197: .string "zfbsjlcseo"
+L198: .string "rwooxykhpqcmbrmfd"
+L199: .string "vzvslbt"
+L200: .data -5, 629
+lea L349, r1
+L201: .data -497, -269, 859, -243, -824
+cmp L263, L326
+clr r6
+L202: .string "cqbdtkgedmwaipyksj"
+clr r1
+cmp *r4, #255
+L203: not r4
+L204: .string "pjmezybucxcibfwpjblrmvle"
+prn r6
+
+L205: clr r7
+L206: .data -215, 141, 994, -77, -597
+L207: .string "diieuuzgsiavueswzbgs"
+bne *r4
+add #-171, r7
+L208: .data 522, -229, -776, 480
+add *r4, *r7
+L209: .string "rzyrsqeybs"
+L210: .string "fubbgyolyoqsvqrpnaaw"
+L211: .data -169, 909, -859, 327, 797
+L212: .string "xhvnywvsgsnfzrdqjn"
+L213: .string "xgogkqlje"
+L214: .string "gjotooaviiyjxisieyvnsan"
+L215: rts
+L216: .string "fvyo"
+L217: .data 2, -499, -283
+L218: .string "hgzkh"
+stop
+L219: .string "tmodzfet"
+L220: .string "jzbpnjzyu"
+dec L230
+
+L221: sub L105, *r1
+cmp L119, L180
+mov L229, *r2
+L222: .data -876, 580, -429, -583
+L223: .data 510, -400, -86, 49, 454, -825, -570
+L224: .string "tzthudwaizlkz"
+clr r5
+dec r4
+L225: .data 738, -350, -301, -892, -780
+jmp L307
+
+L226: .data -132, -738, -397, -468, 396, -306
+L227: sub #-143, r2
+L228: .data 302, 717, -245
+clr L295
+L229: .string "lcpcf"
+L230: .string "figmccl"
+clr *r3
+L231: .string "tmmskplfganwhyrely"
+L232: .string "wxx"
+L233: .data 707, -752
+jmp *r5
+; comment
+dec *r7
+L234: .data -393, 71, 420, 324, 382
+L235: .data 723, 895, -411, -945, -814, -127
+L236: .data 48, 149
+dec r1
+rts
+sub #152, *r1
+
+L237: .data 179, -938, -979
+L238: .string "iggus"
+L239: .string "ii"
+L240: inc L318
+L241: .string "fvmdmkyqfljpokvz"
+L242: .string "msrcyhlpsnuxwuqvsgcggevc"
+L243: .data 283, -194, -415, 316
+stop
+L244: .string "zviajqpmht"
+L245: .string "uyxwkyivsyyfguujj"
+jmp L157
+L246: .data -36, 87, -487, 129
+
+L247: .data 778, 281, -993, -359, -434, 362, -921, 274
+L248: .data 779, -838, 321
+L249: add r6, *r4
+L250: .string "tlxmrupyhhy"
+L251: .string "acsqfqcay"
+L252: .data -87, 331
+L253: .string "gzmiibdcodkg"
+L254: jmp L241
+L255: .data 530, 18, -422, 297
+L256: dec r1
+L257: .string "fk"
+L258: .data 293, 393, 89, -377, -80
+jmp L9
+L259: .string "kbofyqgvrcrbzu"
+L260: .string "cfsm"
+; comment
+L261: .string "d"
+cmp r7, r3
+L262: .data 578, -709, -30, -366, 925, 784, -682, -823
+L263: dec r7
+L264: .data 171, 48, -527, 421
+L265: .data 247, 35, -540
+stop
+L266: .data -536, 12, -786, -310, 497
+L267: .data -814, -916, 542, 287, -466, 764, -440
+L268: mov *r3, r7
+L269: .string "chtjhfmwjsvaxo"
+L270: .string "cdrdpyxrpm"
+; comment
+L271: .data -347
+L272: .string "sjpitiliirhsk"
+L273: .string "geykbwhojottqhorwuc"
+L274: .string "tmzfkzzw"
+clr L337
+L275: .string "ei"
+L276: .string "npetjzohd"
+L277: .string "aezvyfrcskgrphzu"
+L278: .string "ooektly"
+L279: .data -133, -836, -274, -519, 78
+L280: .string "kqwspcvdplmvbsccdydafm"
+L281: .string "fwsivhllunpeekqjggeko"
+rts
+L282: .string "mocssectkf"
+L283: .string "bibhvfgdetm"
+L284: .data 111, 482, 462
+L285: .string "ktqeseilkd"
+L286: .data 239, 157, 360
+stop
+L287: .data -666, -209, -632, -580
+L288: .string "ztgzalbywfqwldpnc"
+L289: .string "qrzcgfwbxgmebevmtmlidtwf"
+L290: .string "qzbcybke"
+not L319
+L291: .string "ulcsfjrteiqnegbqms"
+L292: .string "oakexwyzmm"
+L293: jmp *r6
+L294: lea L261, r5
+L295: .data -254, 565, -865, 312, 738
+L296: .string "zzcgxbxoyipfpgqtiuuwl"
+L297: .string "rzxjyespczwtmfetzcbsedig"
+L298: .string "gx"
+L299: .string "m"
+L300: .data -106, 152, -489, -179
+jsr *r4
+red L337
+L301: .string "jmbpcmgjzdlqgjyfj"
+L302: .string "moswnbtdfhhmbbhnumasco"
+L303: .string "nhtjc"
+L304: .string "raw"
+L305: .string "iqthlgywdsv"
+L306: clr r3
+L307: .string "n"
+L308: .data 420, 482, -712
+sub r0, *r7
+L309: .data 632, 214, -693, -230, 387, 56, 792, -430
+L310: .data -316, -614, -827, -311, -137
+L311: .data -702, 981, -480, -274
+bne L174
+L312: .data 871, 721, -693, -505, 652, -102
+not r5
+red L111
+L313: .data -864, -593, -36, -378, 627, 824, -803, 35
+L314: .data 99, 830, 796
+L315: .string "rphjqjxsjzyewkdnreemwxn"
+L316: .string "isypnhyyptlnuulvmldibi"
+L317: .string "fxyxdfuxopaafcwvzyzd"
+L318: .data -17, -123, -281, 758, -520, 492
+L319: .string "iwrruphwepbqybagqobw"
+L320: .data 69, -511, 43, 993
+rts
+sub *r7, *r7
+L321: .data -765, -726
+L322: .string "hexuetr"
+L323: cmp r2, r5
+L324: .data -31, -686, -156, -797
+L325: .string "kyqfx"
+L326: .string "ksczjsgjtyzflgd"
+add #18, r1
+L327: .data -633, -941, 774, -214, -591, 252, 398, 493
+dec r1
+L328: .string "loyyigrirtrhhepbi"
+L329: .data 976, 610, 497, -129, -837, -144
+L330: .string "fxz"
+
+L331: .string "npkerdfqfookxyksgb"
+cmp #-127, #124
+jmp *r1
+L332: .string "tgvgrdeyh"
+L333: .data -583
+cmp r2, #-55
+L334: .data 749, -997, -391, 575
+L335: .string "hy"
+L336: .string "t"
+not *r0
+dec *r4
+jsr L345
+L337: .string "opvtjtaotdzwgchqdcdskz"
+rts
+L338: .string "pnyreuyqpehohmavtldcyg"
+L339: .string "tfzh"
+L340: .string "jhm"
+
+L341: .string "zoxszeuoftwlewquhjqka"
+jsr *r6
+inc *r7
+L342: .data 750, 475, -659, 936, 569
+L343: .string "ldoa"
+cmp *r1, #39
+sub *r3, *r3
+L344: .string "dkwsqfaaavvpgzidjxaqmgd"
+not L352
+rts
+L345: .string "pyiayzvacbdsbmroddds"
+stop
+L346: .string "oiachach"
+L347: .string "lmszkkxocx"
+cmp L209, *r2
+L348: .string "pqdaiimssjlhherncglsxjb"
+L349: .data -426, -788, 656, 481, 225, -441
+stop
+sub #-239, *r5
+L350: .string "umpabvmg"
+L351: .data -253, 955
+L352: .string "ur"
+L353: .data -870, -646, 439, -147, -903
+L354: .data -22, 676, 790, 16, 349, 920, -548, -42
+stop
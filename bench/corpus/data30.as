@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 31
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .string "exqyybs"
+L1: .string "bxvoptpdawmsnbnbgqaz"
+inc L172
+L2: .data 639, -242, -40, 314, 572
+not *r0
+L3: .string "qyhsbq"
+L4: .string "ubpcsnc"
+L5: .string "qdzjgtleghstsycqtmhffx"
+L6: .data 686, -582, -491, 87, -163
+L7: .data -742, 214, 565
+L8: .string "ymbwzctfgcbuoroqahjzaxe"
+L9: .string "lvjka"
+L10: .string "zzqjlzzuyinjfuxokhg"
+rts
+L11: .data 426, -874, -782, 517
+L12: .data -973
+not L0
+
+jsr L230
+mov L8, r0
+L13: inc *r6
+L14: .data 956
+L15: .data -295, -325
+prn L2
+L16: .string "rorfeybfe"
+L17: .data 941, 514, -812, -249, -172, -929, 950, 244
+L18: clr L16
+L19: .data -36, 892
+bne L199
+L20: .data 870, 813
+cmp *r0, *r1
+L21: not L39
+L22: jsr L247
+L23: .string "cpkxdiepgskhqo"
+L24: .data 312, 259, -39
+L25: .data 10
+L26: .data 812, 376, 229, 652, 849, -73, -49
+add L8, r4
+L27: .data -646, 427, 763, 156, 73, 780
+L28: .data -594, 903, 768
+L29: .string "jyru"
+L30: .data 395
+L31: .data 558, 295, -384, 83
+stop
+dec *r1
+L32: .data -710, 653, -236, -36
+dec r7
+L33: .data 71, -134, -444, -294, 242, -957
+L34: .string "qjqfooqfykrccvqphgc"
+L35: .string "qsznbzngossnhetzeglyhdr"
+L36: .string "cyjvxaesttkctcqjdnmarip"
+L37: .data -422
+; comment
+add r0, r2
+L38: .data -910, 962, -804
+sub *r2, L8
+cmp r1, *r0
+L39: not r3
+L40: stop
+L41: .string "bkonmomckdp"
+L42: .data -990, -680, 652, 91, -141, 364, -126
+not L27
+prn *r0
+L43: .string "xbcrxikgucdmgt"
+mov #203, L204
+; comment
+L44: .string "ydsb"
+L45: .data 948, -861, 899, -404, -693, -971
+L46: add #-115, *r6
+L47: .string "hmyg"
+not *r3
+L48: .data 698, 578, -241, 954, 45, -975, 477
+L49: .string "ykhrhzmsxbsldysjccw"
+L50: .data -964, 960, -478, 676, 641, -146, -351, -213
+L51: .string "gypnahjdrfmesruhsccguzon"
+L52: .data -892, 103, 783, 272
+add #-192, L37
+stop
+L53: .data -375, 39, 392, 830, -890, -109, -130, -590
+dec r4
+L54: .data -526, 563, 924, 854
+stop
+L55: .data -724, 473, 170, -631
+L56: .data 461, -481, -397
+L57: .string "ndrdji"
+L58: .data -929, 381, -371, -101, 318
+L59: .string "takolza"
+L60: .string "cxxhyrtdut"
+dec r6
+rts
+stop
+L61: .data -323, 763, -613, -816, 168
+inc r6
+L62: rts
+cmp #83, r2
+lea L298, r5
+L63: .string "okxpkyyxmnhvzrm"
+L64: .string "xugiuorvekuoxvcog"
+L65: .string "qjvzljeovmopcmimqzuradw"
+L66: .string "g"
+L67: prn *r0
+L68: .data 26, 727
+sub L97, *r6
+sub #69, r3
+L69: .string "linqzekjcvsburyckazglz"
+L70: .string "xwuampvafum"
+cmp r3, L223
+L71: .string "pdhqxsxv"
+L72: prn r0
+L73: .string "sj"
+bne L24
+L74: .string "hmjvady"
+bne L297
+L75: .data -596, -997, -909
+jmp L61
+; comment
+not r7
+L76: .string "bpquszyimgf"
+L77: .data 181
+L78: .data -92
+; comment
+L79: .data -780, 551, 930
+L80: .string "ogoucslzoepgsdsadqzkd"
+L81: mov r6, r0
+inc L55
+L82: .data 11, -802, 27, -58, -713, 194, -113
+L83: .data -767, 735, 732
+jmp *r0
+L84: cmp *r3, r6
+L85: .string "h"
+L86: .string "tknpahyfekjf"
+L87: prn r1
+cmp r6, *r1
+L88: .data -272
+clr *r0
+L89: .string "wcpgqdtfn"
+L90: .string "suktginztinhjbjuzkyqoq"
+bne *r6
+
+L91: .string "urizyvexxcqidxcuzhi"
+L92: .data -17, 645, 489, -521
+
+L93: .string "qocgtaxinbud"
+L94: .data 961, 945, -164, 917, -550, 353
+L95: .string "eryvqnisurjlajl"
+
+cmp L304, #54
+L96: .string "fpvpjournqkrtvkuvvr"
+L97: cmp *r6, r6
+L98: .data 948, -699
+L99: .string "payolmtlguyzhjm"
+inc L255
+mov r2, L277
+L100: .string "h"
+red r5
+L101: .string "lgcurh"
+L102: .data -791
+L103: .data 277, 94, -162, 1, -647
+L104: red *r6
+L105: .data -76, -575
+L106: .data 130, 263, -248, -256, -698, 105
+L107: .data -454
+jmp L70
+L108: red r6
+L109: .data -460, 227, 328
+L110: .data 351, -36, -678, -806, 130, -382, 368
+L111: .data -712, -711, -999
+L112: .data 715, 893, 590, -239, -401, -714, 491
+L113: .string "ahlnaigmyltdjszdup"
+L114: .data -36, 88
+L115: .string "fyv"
+L116: clr L119
+L117: .string "ocrhhnpzzgmkymrqzoqe"
+L118: .string "ejoekxlzzjbrbzpted"
+L119: .string "gpzxtgojdcev"
+L120: .string "tdbdnnbgolanecpnlvmvsm"
+L121: not r7
+L122: .data -968, -259
+L123: .string "iroxi"
+bne *r1
+jmp *r5
+L124: .data 108
+L125: .string "wwg"
+L126: jsr L280
+bne L2
+L127: .string "kmckadk"
+L128: .data -970, -985, -444, 246, 75, -841, 670, 139
+stop
+L129: .string "yhqoms"
+L130: sub *r3, L314
+L131: .data -767, -129, -37, -976, -538, 898, -524
+L132: .data 181, 585, -677, 828, -698, -708, 956, -912
+L133: .string "ykj"
+add r6, r1
+prn L39
+L134: .string "dhdndrrx"
+bne *r3
+L135: .string "gorfrmqmkxpvwhbih"
+L136: .data -741, -342, 936
+L137: .string "kwggpzxkjjxx"
+L138: .string "bryzklmxobqqw"
+L139: clr r6
+L140: .data -321, 102, -36, 959, -763
+jsr L131
+L141: clr r4
+L142: cmp *r4, #210
+lea L155, r4
+L143: .data 914, 521, -792, -693, -769, 124, 949, -664
+rts
+L144: .string "abkuqwkoaupfmlpqr"
+L145: .data -844, 725, -892, -887, 142, 627
+L146: .string "asvmkwkx"
+sub #-115, *r4
+rts
+L147: bne *r6
+jmp *r7
+L148: .string "fqzokrymc"
+; comment
+L149: .string "foxdjokslqdhektqsfd"
+L150: .string "attiwrxtwftrazsxoaomwjua"
+clr L28
+red L256
+L151: .string "ftvgovnmxdjvvefy"
+L152: .string "uitykqqqlt"
+L153: .string "ysorpedxzfqshxwqhtg"
+
+prn L191
+L154: .string "vbigbomtdcgeq"
+prn L193
+L155: .data 369
+L156: .data -970, -110, -612, 937, 208, 430, 678
+clr *r0
+L157: .string "jylmbjlcaobusacwhpgovmx"
+inc L281
+add r5, *r0
+rts
+L158: .string "uybqiazrg"
+L159: .data -350, 426
+L160: .string "jwp"
+L161: .string "kfdu"
+; comment
+prn r0
+L162: bne L281
+L163: .data 573, -281
+sub r0, L105
+
+L164: .string "rxegyiuqulaizlobeupb"
+bne L52
+dec *r5
+L165: .string "zwqzufrsfikemalxjzfsfatp"
+L166: .string "bhiw"
+dec r5
+L167: .string "vfo"
+mov *r2, *r2
+L168: .string "mkgeihrfnpyq"
+L169: .string "yriglxqniestvsfkdusflw"
+L170: .string "y"
+prn *r2
+
+add #-188, r4
+L171: .string "bo"
+mov L108, r3
+dec r7
+add r6, r0
+L172: .string "ysegqlwwdqvdcowqkqesjrna"
+L173: .string "dvxnuuogreiizogpz"
+red r2
+add *r4, L129
+L174: .string "rvxrdrdj"
+
+jmp L73
+L175: .string "xvr"
+L176: .data 65, 358, 668, 394
+L177: .data 132, -432
+L178: .data -498, -686, 235, 678, 289
+L179: .data -702, -222, 561, -803, 731, -32
+L180: .string "yhzsoeshsfkwymekl"
+cmp L320, L182
+L181: .string "wmwvaynnkns"
+L182: .data 872, -647, -397, 593, 7, -509, 726, -936
+L183: .data 284, 911, 876, 125, -646
+L184: .string "kubxbplfwiaabka"
+L185: .data -40, 464, 943, 419, 45
+
+L186: .data -359
+L187: .data 567
+clr *r7
+L188: not L278
+L189: .data 256, -661, -94, 370
+L190: .string "ii"
+L191: .string "gbwtzzltxazhhqrvlqza"
+L192: .string "xxghsekcglpkcoytkur"
+jsr L322
+L193: .string "evmjjowkitay"
+L194: .string "yielhgfolpuncghphr"
+add *r2, *r0
+L195: .data -410, -106, 166, -487
+red *r1
+L196: .string "hhlhsqvzfnkwzq"
+L197: .data 471, 130, 958
+not *r2
+L198: .string "bmhqlkbucii"
+L199: .string "kqurvehbnjbauwskshw"
+L200: .data 985, -951, -49, -699, 176, 367
+inc *r5
+L201: .data 507, -183, 526, 194
+L202: .data -275, -296
+L203: .string "nahbsnsxw"
+bne L315
+L204: .data -579, 450, -390
+L205: .string "mxvbyijdtlaldwiung"
+L206: .string "erhsmgfzrnmbnxc"
+L207: .data -533, -883, 337
+L208: .data -75, 668
+
+L209: .data -735, 622, -742
+inc L19
+inc L179
+L210: .string "gzgfsxclzxutnbtfxx"
+red L221
+L211: .string "uqbvkbbkuwooxpra"
+; comment
+L212: .string "ilac"
+L213: .data 440, -231, 937, -694, 569
+L214: .data 918, 753, -540, -987, -191, -351, -852, 618
+L215: .data 338, -608, 167, 388
+clr L288
+add #-31, *r3
+L216: .data 446, -880, 248, -934
+not L290
+L217: .string "dstijvmqq"
+L218: .data -430, -469, -298
+L219: .data 743, -367, -686, -929, 101
+L220: .data 200, -270, -93, 354, -77, -932, 444
+L221: inc L152
+
+L222: .string "broitplvmkixn"
+inc *r1
+L223: .string "jiizjjzjxtjawixlj"
+dec *r3
+L224: sub *r0, r7
+L225: .data 919, -307, -328, 780
+L226: .string "ezpemmzhnlphrhlcvl"
+L227: .string "we"
+L228: .data 47, 730, 117, 612, -285, 480, 852, -713
+L229: .string "uawlvxzzaakur"
+mov #209, *r0
+L230: .string "f"
+L231: prn *r4
+L232: .data 454, -990, 377
+L233: .string "zzikcwjjcdvuunjmjdcyw"
+L234: .data -811, 262, 947, 878
+not r1
+mov #-60, *r7
+L235: clr r6
+L236: .string "byzkacuwfakpthxckxyicx"
+clr L301
+
+L237: .string "atnwme"
+L238: .string "gllhmjbtze"
+jmp L308
+L239: .data -748, -982
+jmp L89
+L240: .data 280, 25, -187, -526, -235, 866
+
+sub #-111, r1
+red r2
+L241: .string "s"
+jmp *r2
+L242: .data -147, 119, -509, 820, -347
+L243: .data -228, -194, 616, -977, -633
+L244: .data 185, -276, -621, 170, -663, 266
+L245: .string "akonmbeu"
+jmp L262
+stop
+jsr L256
+L246: .string "zd"
+inc *r5
+L247: .data 638, 956, 24, 491, 981, -136, -72, -251
+L248: .string "hpjxieitkompmj"
+
+L249: .string "orrwabnd"
+; comment
+L250: .data 282, 903, -484, 567, -669, 696, -514, -99
+L251: .string "chjisvswbukzstpuplzlc"
+; comment
+L252: .string "foxqdozqwbeh"
+L253: .string "bwr"
+lea L82, *r7
+not r7
+L254: .string "opfbkwluorhemzmyqkoa"
+L255: .string "jfqkswkxabmlfqbdcd"
+L256: .data -339, 899, -764, 843, 496, -167
+L257: .string "estuppoznexkzmqgjzkv"
+L258: .data -147
+L259: .data -503, -282, -767, 661, 254, -214, 325
+L260: .string "pkhhcycwpmitlnxyu"
+mov L56, *r2
+L261: .string "nun"
+L262: .data -281, 859, -961
+L263: .string "gj"
+mov *r2, r3
+L264: .string "mapuqsdfymdyhicimjmgtpuo"
+L265: .data 19, 562
+L266: .data -776
+L267: .data -128, 890, 854, 955, 749
+not *r0
+L268: .data -64, 214, 506, -393, 700, -570, -295
+jmp *r4
+L269: red *r7
+L270: .string "u"
+; comment
+mov r1, r7
+L271: .string "inkdynlm"
+L272: .data -742
+mov *r1, r2
+bne *r2
+lea L281, r6
+L273: .data 995, 169, -76, 409, -698, 457
+L274: .data -572, -265, 953, 887
+inc *r1
+L275: .data 75, -830, 780, 991, 542, -520
+L276: .data -203, -653, -274, 179, 533, 394, 469, -898
+mov *r4, L221
+L277: inc r0
+L278: jsr L301
+sub r6, r1
+L279: .string "wdpyaywwqaiisbshdjzdfh"
+; comment
+L280: .data -192, -799, -602, 615, -327, 222, 179, -168
+L281: .data 753
+L282: jmp L289
+L283: .string "wkxnuuvcjagr"
+L284: .data 663
+L285: .string "xfpa"
+L286: .data 122, -448
+L287: .data -834, -13, -250, 320, -171, -341, 604, -209
+L288: .string "jkaqpyme"
+L289: .data -961, 274, 505, 70, -205, 472
+L290: .data 309, -367, 525, 71, -882, 384, -885
+lea L105, L7
+sub L95, L317
+L291: .data -304, -260, -48, -341, 161
+mov r0, L306
+L292: .string "xyabngau"
+inc L321
+clr *r7
+L293: .string "izkckcvkebilglkli"
+L294: .string "afbqjndyx"
+L295: .data -106, 876, -801
+L296: .string "z"
+inc r2
+; comment
+L297: .string "onfqf"
+L298: .string "vgidyazxwjmhrjs"
+
+red r4
+L299: .string "ht"
+not r4
+L300: .data -583, -458, -995, -174, 162, -688, 482, -832
+L301: .data -898, 736, 500, -423, 7, 649, 943, 790
+L302: .string "u"
+lea L68, L306
+L303: .string "coogzqlhqhgw"
+L304: .string "yqhkraus"
+
+L305: rts
+L306: .string "xcszjejfxlii"
+L307: .string "drgldlryim"
+L308: .data -755, 3, -2, 442, -605, 714
+L309: .string "ciwexcyzzgmaor"
+inc *r4
+L310: rts
+bne *r6
+rts
+L311: .data 262
+add L315, r5
+L312: .data -736, 760, 108
+cmp r4, L29
+L313: .data 581, 824, -898, -173, -108, -640
+add r3, r5
+L314: .string "apneag"
+L315: .string "muhyoaqsivylqq"
+L316: .string "iidzo"
+L317: .string "pwfemjj"
+L318: .string "y"
+rts
+rts
+L319: .string "reslf"
+dec r4
+prn r4
+L320: .data -843, -119, -845, -441
+mov r5, *r4
+jmp *r4
+L321: .string "vppgmfqufigdrefnv"
+L322: .data 161
+rts
+stop
+L323: not L26
+mov #-2, *r3
+stop
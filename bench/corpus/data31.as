@@ -0,0 +1,524 @@
+; Generated by genCorpus --seed 32
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: .data 71, 946, -200, -564, -372, -694, 470
+add L0, L285
+
+jsr L0
+L1: add L256, *r0
+L2: .string "siqaqemm"
+L3: .string "tireueejlgnkqpwxzrbzgt"
+rts
+L4: stop
+L5: .string "ccggormzlkgqrmvjmsc"
+
+; comment
+L6: bne L3
+L7: .data 760, -407, 672, -438, 222, 17, 675
+L8: sub r2, r5
+L9: .string "ukxljtyuxrlu"
+L10: .data -252, -990, 351, -933, 246, -866, -729, 617
+bne *r5
+inc r0
+L11: .data -117, -565, 426, 22, 603, 662
+L12: jsr *r0
+L13: .string "rnwpmtwjkuijvvfimg"
+rts
+L14: inc r3
+L15: .data 138, 515, -998, 745, -193, -78, 653
+L16: sub *r4, *r1
+L17: .data 80, -216, -584, 625, 242, -113
+L18: .data 183, 960, 574, -90, -497, -275
+L19: .data 715, 118
+stop
+jmp L102
+cmp r4, r2
+L20: .string "xxhyne"
+L21: .data 831, 787
+stop
+L22: .string "mcvgvxzsjnqqpcedgyzbss"
+L23: .string "dindozlzdnenhtxj"
+L24: .string "oxdmgiai"
+L25: .data -522, 462
+L26: .string "optdadxycqhf"
+L27: .string "gz"
+L28: .data 869, 855, 117, 975, 660, -929, 467
+L29: .string "tzbxpycbpnxdxf"
+L30: .string "rkzpoxkcki"
+bne *r2
+L31: .data -711, -831, -604, 636, -907, 770, -133
+L32: prn r3
+L33: .string "jexcgwykqksaxuudry"
+L34: .string "ufmlorsrsefidpmzdug"
+L35: not L2
+L36: .string "kojouxyocpk"
+sub L202, L157
+L37: .data -190, 91
+L38: .data -841, 170
+L39: .string "mggtbcrfvfw"
+L40: cmp L18, r2
+L41: .string "erhgcgbwloyvaotlpjsfhhph"
+L42: red *r1
+L43: .data 588, 309, -715, -203
+L44: .string "chuopqthg"
+red r1
+L45: .data 146, 776, 555, 828, -929, -765, -673
+L46: .string "ksmdqvaxkscysxddottq"
+L47: .data 980, -974, -631, 101, 990, 24
+L48: .data -448
+jsr L38
+L49: .string "vfldhdayypucupoddfzwvtjg"
+jsr *r6
+; comment
+
+L50: .string "ldvyuptvfmrpgxwzu"
+clr L162
+jmp L144
+L51: .string "mbd"
+mov r4, r4
+L52: .string "cvnfbdbjlrcnulphnpdpl"
+L53: stop
+L54: .string "cmyls"
+L55: .string "jnqcsjnfxa"
+L56: .string "mk"
+L57: .string "hhgzh"
+L58: .string "snlrvqyizgrxkxblbnlla"
+L59: .string "qzhxvlsgrc"
+L60: .string "sdbsn"
+add *r2, *r1
+L61: .data -494, -920, -867, -592, 62, 655
+L62: .data -584, -295, 437, 425, 398
+L63: .string "qjfiocxe"
+L64: .string "lhezdwpknscog"
+L65: .string "xbattvataw"
+dec L336
+L66: .string "ghpbisldifufftudgxhcgue"
+jmp *r1
+L67: .string "yhajpikpzumsikg"
+L68: .data 775, 549, 12, -498, 798, -543, -134, 224
+mov #250, r5
+cmp #168, L0
+
+; comment
+L69: .string "hcuuyiliozullznlemm"
+L70: .string "v"
+L71: .string "hdnpnielhphgn"
+L72: .string "fnw"
+L73: .string "lkotvjmomtjjmyr"
+L74: .string "wuac"
+; comment
+L75: clr L133
+; comment
+L76: .string "aulhvqujtfyvvop"
+lea L83, *r7
+
+; comment
+stop
+L77: .string "rifzau"
+L78: .string "wwilejcskszuxubthszonhbc"
+L79: .data 245, -604, 495, -80, 989
+add L70, L41
+L80: .data -898, 39, -886, -301
+L81: .data 239, -327, -399, -28
+not *r4
+L82: .data 702, 602, 693, 670, -5
+L83: .data 735, -601, -377
+L84: .string "r"
+rts
+L85: .data 207
+lea L134, *r3
+L86: .data 332, 104, 643, -245, -988, -479, -144, 498
+L87: .data 316, 376, 588, -70, -956, 260, 991
+L88: .string "tuyxopyjz"
+L89: jsr *r5
+L90: .string "jlrrbngwwk"
+L91: .string "rrkjoojmrhbmdkjocumtjkrx"
+; comment
+L92: .string "hweirwzhmwzfghjawucaslj"
+L93: .string "cktlxne"
+not L220
+L94: .string "joxarq"
+lea L32, L117
+rts
+L95: .string "kbdfsvciemgnaigzknkirc"
+L96: .string "veewfcvunip"
+stop
+L97: .string "txlkzs"
+add L334, r6
+L98: .string "l"
+L99: .data 481, 138, -310, 377, 118, 685, 530
+L100: .string "aajhxjsxfvlxtzopzcgaumg"
+red r5
+L101: .data -276, -991, -304, 632, -178, 88, -789, -658
+L102: .string "nrx"
+L103: sub L305, r7
+prn *r6
+L104: .data -140, -763, 274, -382, -507
+L105: .string "xvlmtkfwcwa"
+L106: .string "unnzibxqvh"
+prn *r3
+inc r0
+L107: .data 186, -189, 827, 421, 318, -120
+L108: .data -203
+L109: .string "pheovhnqtxjgdfqvriheml"
+L110: .data 726, -591, -668, -207, -449, 220, 533, 904
+bne *r1
+L111: .string "wpvgver"
+L112: .data 760, 71, -702, 439
+L113: .string "mqrolnwvuhwptlkjtkdef"
+rts
+L114: .data -662, -722, -825, -971, 60
+L115: .string "vwypfgxvshvbc"
+L116: cmp r6, r0
+L117: .data -436, 954, 848, 444, 234, -133
+bne *r6
+cmp r0, r0
+L118: .string "xwhxuqffuio"
+stop
+L119: .string "losoolhxxxvgg"
+prn #-135
+L120: .data -378, -437, -597, 195, 441, -389, 252, 18
+L121: .string "ewrxqnbmljiwxvdcblhi"
+L122: .data 392, -174, -211, -985, -853
+L123: .string "vhturppcoifgk"
+L124: .string "nl"
+L125: .data 369, -923, 797
+L126: not *r1
+stop
+jmp *r6
+L127: .string "wabeyk"
+L128: clr *r4
+L129: .data 365, -415, -929, 164
+jsr *r1
+L130: .string "txy"
+L131: .string "hkrajusvqtlswmdrg"
+L132: .string "isqgmtncu"
+L133: .string "pepjulknhp"
+L134: not L105
+L135: .string "lvdhtpgsrr"
+L136: .string "lxslqbq"
+L137: .string "pvmkxvmrrjhhvrcsa"
+L138: .string "jsmckosjq"
+L139: .string "mvqmoles"
+L140: .data 422, 491, -158, 47
+bne *r5
+prn #-100
+rts
+L141: .data -575, 310, 207, 690, 389, -58, -149, 745
+dec L104
+jsr L288
+L142: .data 114, 263, 666, 593, 424, 619
+L143: .string "juiluncwouyep"
+rts
+
+L144: .data -38, 43, 714, -796, 140, -284, 33
+L145: .string "nenczhkyrh"
+dec L140
+jsr *r7
+L146: .data 280, 472
+L147: .data -193, -437
+L148: .string "zwcslhljxkyqqxnsupuxji"
+sub #219, *r7
+L149: .string "uniqarcwoxnnyfqkeqnmsb"
+L150: .data 453
+; comment
+L151: .string "pj"
+L152: .data 45, -81, -739, 79, 621, -300, -143
+L153: .data -187, -38, -398
+cmp L288, *r4
+L154: .string "wqidcckgtqhvlpswtvjeg"
+L155: .string "ipinmruzpwqjqzgvqlrquzon"
+L156: .string "mod"
+L157: .data 988, 818, -177, -207, -213, 254
+stop
+L158: .string "d"
+lea L166, L132
+L159: .data -471, -758, -608, 468, 61, 700, 331
+L160: .data 624, 858, -258, 660, 239, -493, 368
+
+L161: .string "kc"
+mov *r5, *r7
+L162: .data 264, -958, -494, -941
+L163: .data 461, -277, 565
+L164: .string "clxcicpmwhiitbfzr"
+L165: .string "fnmw"
+L166: .string "hvcexnilqmflcntkbcym"
+L167: .data 293, -909, 955, 967, -565, 611, 206, 133
+L168: .string "bajyssmz"
+L169: jmp *r1
+lea L330, *r7
+cmp *r6, *r6
+L170: .data 698
+L171: .data -95, -923, 886, 764
+L172: .string "kkkpvdhhlobmofmpnvcyc"
+L173: .data 340, 244, 483, 485, 102, 470, -991, 572
+L174: inc r2
+
+L175: .data 310
+jsr *r4
+L176: .data 861, -990, 760, 515, -128, -431, -927, 978
+L177: rts
+rts
+L178: sub #-143, *r7
+lea L35, r4
+L179: .string "s"
+L180: .string "ljjgarjfakiszhfqzvrhpovs"
+L181: .string "amao"
+L182: .data -359, -33, 322, -733, -229, -408
+L183: .data -172, -201, -996, 603, -129, 692, 50, -334
+L184: .data -366, 665, -268, -974, 972, 96, 341, 577
+L185: red *r1
+red L326
+L186: .data -751
+L187: .string "bfmsreyh"
+L188: .data 396, -663, -736, -386
+L189: .data 392, 496
+L190: stop
+inc *r5
+L191: .string "ooduycxhn"
+L192: .data -459
+L193: .string "cantdkudwqechiunhlmgemvc"
+bne *r2
+L194: .data -840
+jmp *r2
+L195: .data 994, -51, -792
+red r5
+dec L237
+stop
+jmp *r0
+L196: .data -898, 80, -676, -466, 205, -922, -606
+L197: .string "lylozjmsxfaseapwgeft"
+L198: .data -71, -386, -366, 636
+L199: .data 535, 382, -944
+prn #-238
+L200: .data 455, 278, 95, -463, -610, -703, -964
+; comment
+L201: mov *r5, r5
+L202: .string "ektgjmygp"
+cmp *r7, L159
+L203: lea L301, L175
+; comment
+L204: .string "qiyqxwtegquonj"
+L205: .data -1
+L206: .string "peol"
+
+red L231
+inc *r1
+L207: red L137
+add #-226, L164
+dec L55
+L208: jsr L101
+L209: .string "lorqpwnpfxb"
+L210: red r3
+L211: .data -854, -908, -889, 561
+add r0, L133
+jmp *r6
+stop
+dec *r0
+prn #-172
+jmp *r7
+red r2
+L212: .string "vkafwydpsvdc"
+L213: .string "jpagunrnhknqtgvkfdkvys"
+L214: .data -842, 635, 934, -506, -334, 895, 63
+L215: .data -101, 118
+L216: .data 828, -101, 237, 959, -854, 507
+lea L12, r0
+L217: .string "zmebfglpkp"
+L218: .data 213, -865, -575, 281, -378, 866, 790
+L219: .string "ufzqxcvupvkwqpfmvul"
+L220: .data -453, 747, 734, -376, 689
+sub *r6, *r1
+L221: .data 819, 517
+rts
+not *r6
+L222: .string "sc"
+L223: red r5
+jsr *r7
+L224: rts
+L225: stop
+rts
+L226: clr r2
+L227: .data -278, 26, 272, -546, 558, 652
+L228: .data -544, 914, -537, -946, 630
+L229: .data -236, -483, -81, -303, -294, -116, 652
+L230: .string "pqdavaadfttoppmh"
+lea L87, L205
+L231: cmp *r6, r6
+L232: .string "ezpoaimmdytuoujxxqhuh"
+L233: .string "odddpcqyduayxufyv"
+stop
+inc *r2
+L234: .string "grpeemndrtrgl"
+lea L286, r2
+
+L235: .string "mqopoywuzqgctyxwrcut"
+L236: .string "zegxjgskpphkxuijgtjkfb"
+L237: .string "ouhbhkpzdleby"
+L238: .string "clxjnhkcyyprzljea"
+bne *r3
+sub #47, r2
+L239: .data 322, -403, -185
+L240: .data 652, 286, 168, -262, -802
+; comment
+
+L241: .data -819, 638, -74, 128, 99
+; comment
+L242: .string "jbnjwhnzrtexratktytjgflu"
+stop
+inc L146
+L243: .data 649, -291, 631, 591, -41, 240
+L244: .data -602, 820
+mov r4, L100
+L245: .string "uxd"
+L246: .data -129, 880, -624, 79, 569, 427, 881
+jsr *r7
+L247: .data -163, -156, -285
+L248: .data -581, -158, -551
+L249: .string "wkzeypjg"
+L250: .data 925, -190, -650, 54
+L251: .string "dnpnhlcooxlpkwedoyrht"
+L252: .data -583
+L253: .data 484, 599, 505, -978, 775, 546, 284
+L254: .string "ptpyev"
+L255: .string "wvvj"
+; comment
+L256: .string "fkqp"
+L257: .data -451, 918, 969
+L258: .string "fm"
+L259: .string "t"
+L260: .string "oqcnxqjlsmdjbv"
+L261: .string "ukeofroc"
+L262: .string "bqmwutkxfcnu"
+
+L263: .string "sltlyoxvjaotblayfsgeeao"
+L264: .data -967
+inc r4
+L265: .string "pbtpdpweknkpernqwcpvzm"
+L266: .data 245, -247, 477, -326, 684, 174, -706
+L267: .string "igfwoqaty"
+L268: .data -213, 183, -172, -408, 699, 259, 583, -41
+L269: .data 683
+cmp #-200, *r3
+L270: .data -956
+L271: .string "ej"
+L272: add r0, L292
+L273: .data 204
+red r2
+stop
+stop
+jmp *r3
+lea L248, r3
+L274: .data -275, -156, -378, 811, -474, -340, -617, 382
+L275: .data -862, 909, -130, -787, 928, -878, 831, -199
+inc *r1
+sub L8, r7
+jmp L260
+jsr *r7
+dec L298
+L276: .data -762, -422, -513, -318, 824, -656, -698, -246
+L277: .string "msjrcxukqcabmtiokjvgsfk"
+L278: .data 115, 67, 263, -943, 284
+L279: .string "dcygqqmglidudymkbrdtiyb"
+L280: .string "kggyajparfqmepudublvszd"
+prn *r7
+jmp *r6
+L281: .string "edxfdcvgylptaqsp"
+prn L296
+L282: .string "rtsanwkveanhiwfijr"
+L283: .string "ad"
+L284: .data -896, 618, 883, 202, 723, 85
+L285: .data -976
+
+sub L118, *r0
+L286: .data 707, -619, -222, -58, 870, -337, -237, -605
+L287: .data -675, -275, 43, -471, 380
+dec L145
+L288: .data -952
+L289: .string "plxiqzjkvttqokvbszqfjei"
+L290: .string "riqmmrsmbttblkj"
+L291: .data -776, -632, -244, -868, 961, 472
+; comment
+L292: .data -509, 908
+L293: .string "kikhfvrzymupjqqvmmt"
+L294: add L118, r1
+L295: .data -912, 964, 572, 454, 85, -870
+cmp *r5, r7
+L296: .data 609, -411, -326, -760, -97
+cmp L190, r5
+L297: .data -35, 356
+L298: prn *r5
+L299: .data -835, 461, -77, -197, -977, -504, -773, 479
+dec L297
+L300: .string "pywk"
+prn r6
+L301: .data -416, 75
+L302: .string "fbahcsapmebhzkuxjdnb"
+
+L303: clr L195
+
+L304: .string "poc"
+L305: .data 44, -770, 927, -337, 521, 984, 516
+L306: .data 559, 499, -960, -667, -568, -319
+L307: .string "bjt"
+L308: .string "dpjxdimnsyhggunyrneo"
+L309: .data -512, 945, 91, -445, 293
+L310: .data 59
+jsr *r4
+L311: .data 65, 295, -348, 375, -317, -236
+L312: .data -835, 59, 588, 124, -45, 86, 174, -660
+mov *r5, r7
+L313: .string "eiao"
+jmp *r6
+L314: .data 354, 60, 648, -247, 768, -398, -405
+clr r5
+L315: .data -431, 596
+jsr *r5
+L316: dec *r1
+L317: .string "qfhjatuohtjrd"
+L318: .string "zmpsfaexxwluuggqpon"
+jmp L319
+L319: .data -667, -123, -156, 248, 111, 242, -262, -589
+L320: .string "egg"
+L321: .data -660, -50, -690, -488, -423, -401, 155, -696
+L322: .string "yhqcju"
+L323: .string "rxoecz"
+L324: .data -20, 541, 252, -597, -187, 141
+L325: .data 587, 309, 996, 457, -971
+red r3
+stop
+L326: dec r1
+L327: .data -182, -745
+jmp *r0
+L328: .string "qmgqmibctmlufugvipokn"
+L329: .string "oylsmqs"
+L330: .data -535, -670, 342, -144
+L331: .string "ggpmccjbrpuymrqkz"
+L332: .data -388, 992, 891, 409
+L333: .string "vobwuin"
+sub L58, L229
+L334: .data -48, -994, -714
+L335: .data -769, -870, -979, -303
+L336: .data -972, 480, -464, 952, 334
+L337: .string "pixnvdohswvpldbxuv"
+stop
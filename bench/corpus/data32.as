@@ -0,0 +1,524 @@
+; Generated by genCorpus --seed 33
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: .string "xcnyuharg"
+L1: .string "jzsdb"
+L2: .string "bruspcxcapihfexrgcsmu"
+L3: .string "mjmvm"
+L4: .data -89, 607, 843
+lea L1, r7
+L5: not *r5
+L6: .data 757, -890
+L7: .string "qkkantcahmvmuzghovqehtk"
+cmp r6, *r3
+L8: .string "floazdqociwdtmspr"
+bne L174
+L9: jsr L1
+L10: .string "jmlvwd"
+L11: .string "sd"
+L12: .string "myi"
+L13: .string "hbkkenhrrtscsynbwdrgadaf"
+dec *r5
+mov #-119, L170
+red r3
+not *r6
+L14: .data 133, 595, 329, 226, 372, -857
+L15: .data 139, -890, 72, -838, 616, 723, -405, -403
+L16: .data 73, 594, 918
+L17: .data 439, -882, -594, 270, -321, -847, -326, -541
+; comment
+L18: .string "ag"
+red *r6
+L19: .data 682, 67, 300, -851, -572, -186, 266
+L20: .string "kylamajqsxyfi"
+L21: .string "qhnlmmvijistgevhjtx"
+L22: .data 233, 679
+L23: .data 66, -578
+L24: .data 574, -664
+L25: .string "pi"
+jmp L13
+L26: .string "ypni"
+prn *r6
+clr r4
+L27: .string "wnmegufabbgpvdrkjqs"
+L28: .string "fnzededtfokgkqiixhte"
+clr *r5
+L29: .data 433, -612, -472, -415, 618, -596, 458, 719
+L30: .string "d"
+sub #-186, *r3
+inc r1
+L31: .string "oajofaaguukaogkeoutwbzbh"
+L32: .string "ngbsajjef"
+; comment
+inc *r6
+L33: .data 374
+L34: rts
+red r1
+inc *r3
+L35: .data 929, 184, 833
+L36: .data 969
+L37: add *r2, r5
+L38: .string "e"
+red L34
+L39: .string "xmslodoolijkxmskgygaqpk"
+L40: .data -453, 363
+L41: .string "awcqesooiwz"
+; comment
+L42: .string "uutaolbjunugj"
+L43: .string "jwbvhhycylwwsoqxgi"
+L44: .data -558, -625, -269, 309, 132, -482, 151
+L45: .string "qbtpeiwrezvlkuvhuarggila"
+red r2
+L46: .string "qknw"
+L47: .data 119, -653, 515, 478
+L48: .string "msizrfdpfoqemorxrmpg"
+dec r3
+jsr L36
+stop
+L49: .string "lkchm"
+dec *r2
+L50: .string "olhorpwsiffpvseyxjibed"
+L51: .string "psrkrefzgxzwmwfz"
+L52: .data -699, 192, 598
+L53: .data 595, 65, -986, -4
+; comment
+L54: .data 920, 323
+L55: .data -603, -379, 34, 254, 376, 663
+
+dec *r2
+dec r7
+L56: .data -268, -233, -395, -228, -926, 293, 586, 529
+prn *r7
+L57: jsr *r6
+clr L177
+L58: .string "kmylrvuzs"
+sub L45, *r7
+jmp L245
+L59: .data 898, 811, -399, 549
+rts
+L60: rts
+L61: .string "ab"
+L62: .string "n"
+L63: .string "hnumq"
+L64: mov L86, r0
+L65: .data -894, 72, 498
+L66: .string "jdjngykrblebobcy"
+L67: dec r2
+L68: jmp L305
+L69: .string "rknipotz"
+L70: .data 796, 594, 65, 659, -838, 68
+L71: .data 386, -251, -912, 691, 133
+L72: .data 763, -785, 593, -96, -187, 87
+L73: .data -769, -715, 7, 95, -285, -231
+stop
+sub #235, L58
+L74: .string "zztdyfhlvhldubmpwnxjfnqu"
+L75: .data 456, 482
+L76: .data 351
+L77: .data 4, -755
+L78: .data 786, 68, -454, -154, 602, -844
+L79: .data -206, 417, 44, -163, -97
+L80: .string "fexefemvosyowt"
+L81: cmp #-15, #-245
+L82: .data 249, 682, -693, 785, 375, -382, -114
+L83: cmp #-102, L66
+L84: .data -881, -390, -376, 609, -626
+not *r7
+L85: .string "wtahkwxqigufuramkufojdoh"
+L86: .data 201, 924, 547, 319, -169, -154, -168
+dec r0
+jsr *r4
+L87: .string "hiojpyrdsxk"
+L88: .data -309, -53, 962, -221
+inc L27
+
+L89: .data -24, 234, 628
+L90: .string "ue"
+L91: dec *r2
+L92: not *r7
+L93: .string "hklssnxflebmnljvioatzov"
+inc *r2
+mov r1, *r0
+L94: .data -818, -402, -94, -889, 746
+L95: .data 369, 439, 607, -977
+L96: .data 95, -371, 86, -528, 113, 331, 559, -128
+L97: .data -4, -693, -11, 958
+L98: .data 949, 274, 894, 974, -973
+L99: .data 93, -344, -46, 877
+mov *r5, r2
+L100: .data 506, 950
+rts
+; comment
+rts
+L101: .string "qkrofbmxrqxplgovnbidt"
+L102: .string "qxk"
+L103: .string "pbhkcencqblvhggw"
+rts
+jmp L80
+L104: .string "hpxqilulldokcmupqzjb"
+L105: .string "gwxeprlzlxrqd"
+L106: .string "vvdmtpwltraovdpfwnzafx"
+red L293
+L107: .data 492
+L108: .data 646, -498, 223, 563, 909
+L109: .string "olbjz"
+add *r0, r7
+jsr *r0
+L110: .string "fswfcuexmyilf"
+L111: .string "zylnjgzb"
+jsr L344
+L112: .string "plsnisvlgntjxolbnwfw"
+L113: .string "ydyzozhzrfdhsooddboii"
+not *r2
+bne *r2
+L114: .data 478, 683, 232, -872, 843, -626
+clr r3
+add L92, *r7
+L115: .string "riyxned"
+prn *r7
+L116: .string "wlxchqxqplm"
+L117: sub #-197, *r0
+red L268
+L118: .string "mscujrghzszfajecc"
+add *r4, *r2
+L119: .string "ppyddiqadiqls"
+mov #201, L79
+L120: .data -837, 236, -657, -989, -844
+L121: .string "fyh"
+L122: .string "ujo"
+L123: .string "rvxdyk"
+red *r4
+L124: clr r7
+L125: .string "xgca"
+L126: sub *r2, *r5
+L127: .string "jxwoiikqwoxvgq"
+L128: jmp L69
+stop
+L129: .string "eymlzhnvfoycb"
+not *r0
+L130: .string "p"
+
+add #-246, L40
+L131: .string "gbiqasy"
+stop
+L132: .string "luvoxefdq"
+L133: .string "fqmiwcufpbtr"
+red r4
+clr *r1
+L134: .data -747, 543, -545, -211, -971
+prn L74
+L135: red *r0
+L136: .string "maucwxuzvxhcbsmjel"
+L137: .string "yukzlspzhobnw"
+L138: .string "wuughajytafsux"
+L139: .data 101, -422, 836, 543, 927
+; comment
+; comment
+L140: .string "ebg"
+L141: jmp *r6
+L142: .data -7
+L143: .string "jrpxenojorfurkdquwo"
+L144: .string "q"
+
+L145: not *r0
+L146: .string "eay"
+
+L147: add r3, *r2
+L148: .string "wldq"
+L149: .string "vrmjlsjckohrruftzqd"
+L150: .string "onhxjuccyiltwinaqx"
+L151: .string "igzgqei"
+L152: .string "jbhata"
+cmp r5, L255
+L153: .data -866
+red L121
+L154: sub #-175, L24
+L155: dec *r1
+L156: .string "ogrtnocalmdzjl"
+L157: .data 464, -860, -164
+
+L158: .data -51, -264, 457
+L159: .string "emsagvrzhbrqsdsmscnh"
+
+L160: prn #-12
+L161: .data -835, -720, 255, -989, 858
+L162: .string "wczpwxpyoxf"
+cmp r3, *r6
+L163: .string "vxzfrfg"
+L164: mov r5, r3
+not *r6
+L165: .data 128, 941, 181, 103, -595, -323
+L166: .string "xjqr"
+L167: .data -635, -144, -41, 810
+L168: cmp *r2, L304
+L169: .data 433, 850
+L170: stop
+sub L113, r6
+L171: .string "ygtvlonfpprqg"
+L172: .data -588, 12, 54, -772
+inc *r7
+rts
+L173: .data -642, 89, 316, 324, -61
+L174: .data 279, -400, 767, -432, 263, 606, 382, -3
+jmp L85
+red L266
+L175: .string "llpik"
+L176: .string "hvm"
+L177: .string "nofu"
+L178: .string "f"
+L179: .string "bglmzaexdbx"
+L180: .string "mquwassjjpxlc"
+L181: prn r1
+L182: .string "yahjiqzhutmlauwjnz"
+L183: .string "glevbvotehdworjk"
+L184: jsr *r3
+L185: .data 637, 863, -539, -673, 177, 270
+L186: .string "mcowiulnft"
+L187: .data -869, -821, 64, -732, 971, -169, 708
+not *r0
+L188: .data 450, -874, -555, -617, -154, -998
+L189: .string "ddnh"
+L190: .string "psgdoptqeixyndmwafcu"
+L191: .string "qmujhodpoindpvvxw"
+not L126
+not L166
+rts
+dec r1
+L192: .data -8, 27, 848, -798, -637, 381, 77, -895
+jmp L331
+sub *r1, L26
+mov *r2, *r5
+red L246
+L193: .data -975, 93
+stop
+red r6
+L194: .string "ueabzbvtibyzhxxdjqcwue"
+L195: .data 330, -707, 66, -986, -214
+cmp r1, *r4
+stop
+L196: .data 633, -964, -169, -220, 576, 711, -605
+L197: .string "qsvziqaveefrwrzm"
+L198: .string "yopxrqck"
+; comment
+lea L211, *r6
+L199: .string "zyakhnkwjpjwvixgzdic"
+clr r6
+L200: lea L16, *r1
+not *r5
+L201: .data 630, -825
+L202: .string "dpqssfr"
+
+L203: .string "pymnfhcyq"
+L204: dec *r4
+L205: lea L109, *r6
+jsr L56
+L206: .data 961, -570, 579, -343, -481, -981, -278, 26
+L207: .string "xmuijormyudqf"
+L208: .string "txkjzqybcyvigr"
+L209: .string "p"
+L210: .data -551
+L211: .string "uylq"
+L212: .string "nbsdyra"
+L213: bne L309
+L214: .data 960, -879, -139, 413, 557, -161, -46, -509
+L215: .data 847, 73
+L216: .data 841, -317, 698
+L217: .data 892, 82, 502, -964, -174, 917, 960
+L218: .data -616, 644, -436, 149, -421, 622, -932
+L219: .string "jbpmipmv"
+L220: .data 577, -698, 61, -477, 234, -365, 943
+L221: .data -247, 198, -557, -744, 256, -586, 574, -163
+L222: .string "zxzusnuvnnrjho"
+L223: .data 217, 550, 606, -746, 279, -692, -610
+L224: .string "pjtroellfrnkvbwlqorgkbc"
+red r2
+L225: .string "ktzvuwevcj"
+
+rts
+L226: .data 444, -966, -842, -636, 742, -334, -114, -287
+L227: .string "wmwldawqcud"
+L228: .data -783, 139, -850, -577, -299, -196, -929, -303
+jsr *r4
+L229: .string "loanxyvsbfyywlaylaakwd"
+add r2, r0
+L230: .data -949, -516, -300, 492
+lea L283, *r2
+stop
+L231: .data 358, 442, 579, 729
+L232: .data -68
+L233: .data -134, 887, 515, -553, -546, -102
+L234: stop
+L235: .string "wwgczv"
+L236: .string "zeavc"
+L237: rts
+L238: dec *r5
+L239: .string "wsrkmtqjiyoydkkxjlw"
+clr r5
+L240: .data -254, -615, 218, -309, 573, 645, 199, 556
+L241: .data -772, 140, -874, 238, 116, 948
+L242: .data 765, 245, -460
+L243: clr L252
+L244: .string "qhidmbuvn"
+L245: .data -693, -876, -526, -905, 225, 35
+add L192, L58
+mov r5, *r5
+add r2, *r1
+L246: .data -334, 53, 274, -241, -58, 12
+L247: .data 195, 481, -670, -897, -85, -557, -367, -924
+dec r5
+L248: .string "buzxvyhxefupdtl"
+red *r4
+L249: .string "pkjje"
+jmp L57
+rts
+L250: .data -587, -423, -3
+L251: .data 902, 806, 431, -825, 600
+jsr L327
+L252: .string "aupejjvbehnimzryqtyrhzs"
+L253: .data 391
+L254: .string "ryxerbxuuvtwriuyzqitpbzo"
+inc L300
+L255: .string "ubyqignpghcgbkhikja"
+L256: .data 483, 94
+clr L305
+L257: .data -881, 449
+L258: .data -880, 906, -598, 607, 848, -311, -77
+L259: .string "izgcmumlkkjtirkpaadog"
+L260: .data -93, -604, -246, 776, 560
+L261: .data -215
+L262: .string "vscmkytkdrhbk"
+L263: jsr *r2
+stop
+clr *r0
+L264: .string "jtjxauqj"
+mov #-37, L182
+lea L165, *r3
+L265: .data -719, 331
+sub r0, *r0
+L266: .string "iplomdpqpewcxuffgqi"
+L267: stop
+dec L309
+cmp L226, #-240
+L268: .data -296
+L269: .data -912, -709
+L270: .data 494, 238, -664, -157, -312, -352
+L271: .string "iyvrpvzrxsxxwf"
+dec L289
+L272: .string "grzysnfzbhvmfglcnqyw"
+L273: .string "pwikglt"
+jsr *r7
+L274: .data 364, -43
+L275: .string "jrypzdtxxtdbtnqp"
+L276: .string "tzw"
+L277: stop
+L278: .data 531
+L279: .string "qftz"
+L280: .string "udjiyk"
+L281: .string "qikttb"
+L282: .string "axr"
+lea L141, r2
+L283: .string "ijebtuwxfg"
+cmp *r5, L292
+L284: .data -717, -712
+L285: .string "licsjotzfzmgccvghbt"
+L286: .data 537, -466
+sub r1, L198
+; comment
+stop
+
+L287: .data -777
+L288: .data 430, 949
+L289: .string "lsht"
+L290: dec r0
+L291: clr L186
+L292: .string "twaoy"
+L293: .string "hnpxecmrpuuvqojdkjqmmnwg"
+L294: .data 228, 169, 639, -999, 488, -842
+L295: .data 883, 253, 370
+L296: .data -769, -445, 978, -330, -764
+rts
+rts
+L297: .data -362, 285, -189, 976, 720, -709, -28
+L298: rts
+L299: .string "djsidso"
+L300: .string "jnnofcj"
+
+L301: .data -841, -46, -134, 307, -669
+bne L292
+L302: .data 464
+L303: .string "jesafxdacruf"
+L304: .string "dyotzgbkqsbskfzm"
+inc r3
+L305: .data -734, -344, 527, -105, -4, -94
+L306: .string "nwvgqumwiood"
+L307: .string "dvrkqqnkegkxerx"
+clr L336
+L308: .data 322
+L309: .data -89
+L310: not *r3
+L311: .string "j"
+L312: .data -783, 217, 416, -308, -188, -603
+L313: .string "x"
+stop
+L314: .data 442, 410, 762, -639
+L315: .data -800, -4
+red *r5
+L316: .data -150, -50
+L317: .data -976
+L318: .data 6, -207, -315, 161, -128, 576
+L319: .data -189, 299, -19, -206, -222, -715, 836
+add r5, *r1
+L320: .string "peffeopdk"
+L321: .data 244, -887, -194
+mov r3, r2
+L322: .string "g"
+mov #111, L324
+jmp L336
+L323: .string "eowoiubmpaztdwxjhqrasn"
+mov r4, L251
+L324: .string "cpbhr"
+L325: .string "abgpgxetbawe"
+L326: .string "gbwasjfiotkhydzndvf"
+L327: jmp L335
+L328: stop
+L329: .string "ecrxkpihtph"
+L330: .data -288, 606, 683, -616
+L331: .data -365, 610, 200, 994
+L332: .data -949, 766, -45, -773, 545, 847, 623, -667
+L333: .data -312, 955, 337, -251, -547, -812
+not L70
+L334: .string "gxhhljmqferlbynpl"
+L335: .string "oqeqynqiedfbvrnogkwbdq"
+L336: .string "udjmkevuarsytw"
+L337: .data 436, 26, -294, 25, 418, -960, 704, 645
+L338: .string "eeembhfjrrqjykowv"
+L339: .string "opqqyqmzdgabadexkmca"
+prn #-167
+L340: .string "vafrtcnfcogccgoxrpa"
+L341: .data -591, -543, 729, 961, -318, 311, -737
+L342: .data -696, -198, -439, -647, 212, -468, -865
+
+L343: .data 801, 981, 351, -255, -583, 370, 991, -478
+rts
+L344: .string "fpghogkfzxxd"
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 34
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+not *r5
+; comment
+L0: .string "hklkqtibtghl"
+L1: .data 555, 107, -844
+L2: .data 760, -387, -538
+L3: .data 468
+clr L0
+L4: .data 808, -483
+; comment
+L5: .data 767
+L6: .string "izqjhinfytujxqsrycanhfya"
+L7: .data 302, -907, -324, -100, -995, -349, -774, 62
+not *r4
+L8: .data -328, -426, 42, -9
+; comment
+L9: .string "jmovvrjobkpmsgkzfaezpvl"
+L10: dec r2
+L11: .string "z"
+L12: .string "rwjcyvyigkgrztslaaqw"
+L13: dec r4
+L14: .data -947, -1, 569, 247, -502, 594, 45
+mov r4, L293
+L15: inc *r6
+rts
+L16: .string "rpaxkydhusudeeoneoaw"
+L17: .data 261, -32, -558, 45, 137, -927
+L18: .string "ybmzrnbau"
+L19: .data -27, -151, -468, -125, 353
+not L17
+L20: .data -324
+L21: .data 739, -25, -6, 151
+L22: .string "mtcmuhroakavcbsvti"
+L23: add r5, r3
+L24: .data 52
+L25: .string "lzueaavapzoxokpo"
+mov *r0, r5
+L26: .data 112, 761, -434, -136, 201, 216, 423
+L27: .string "wpkgoqvpkkvfuiq"
+L28: .data 755, 817, -601, -282, -583, 951, 292, -318
+sub L1, r1
+L29: .string "woyerimanbinypjtyv"
+L30: .string "gonaqqmj"
+L31: .string "epsqrcdswme"
+L32: .data -80
+L33: .data -998, 63
+mov #-67, *r6
+jsr *r0
+L34: .data -862, -702, -418, -563, -49, 423, -182
+L35: .data 880, 946, 888, -58
+L36: .string "qixetzumecjoozugb"
+L37: .string "uzhkocs"
+L38: .data 56, -448, -442, 673, 649, 658, -141
+inc r7
+L39: .data -720, -649, 597, -255, -624
+L40: .string "il"
+L41: .string "ttrbaebmwqbuwvint"
+L42: .string "skusvbpg"
+L43: .data 357, 89, 110, 219, -915
+L44: .data 910, 687, 469, 160, 734, -282
+L45: .string "pyptgqpmkfmhcuqeakcfgyhv"
+L46: .data -685, -457, 92
+clr *r4
+L47: .data 957, -591, -506, -892, -527
+L48: dec L17
+mov *r7, L34
+L49: .data -740, 557, 533
+L50: dec *r4
+mov #-31, L23
+bne L94
+L51: .data 221, -375, -546, 25, 351, 774, -762, 365
+L52: .string "oukbauxnyhkbfgkhez"
+L53: .string "r"
+L54: .string "yxlaffozaf"
+L55: .data 819, -829, -357, 938
+L56: clr *r7
+L57: .data 168, 34, 643, 892, -225, -70, -384, 231
+cmp r7, *r6
+cmp #234, L201
+L58: .string "tejchtezfkj"
+jsr *r7
+L59: .string "taxscqurabcjzcvzvrxtuc"
+L60: .data -77
+L61: .string "wpixwhsiqy"
+bne L61
+L62: .data -408, 379, -9, -405, -554, 953, 483, -473
+L63: .data -486, 941, -317, 544, -325, 143
+L64: .string "dnoxcbjpdlpum"
+L65: .string "qibe"
+add r1, *r0
+L66: .data -300, 346, 629, 95
+bne *r5
+L67: .string "bvctulguvwlwru"
+jsr *r2
+L68: .string "wzwcmxwnnbevsbtaphpigbxn"
+L69: .string "lkbf"
+L70: stop
+rts
+inc r7
+stop
+L71: .data 341, 463, -895, -584, -94, -692, -776
+mov L33, *r7
+L72: .data 769, -67, 983, 734, 123, 345
+L73: .string "mkuhlkgbvptli"
+add *r4, r1
+L74: .data 240
+L75: .data 970, 704, 959
+jmp L89
+L76: .data -830, 539
+rts
+red *r3
+L77: .data -822, -541, 71, 684
+L78: .string "dlyinmekxdakwnniy"
+L79: mov #190, L191
+L80: .string "svy"
+L81: .string "rhxwcqzn"
+L82: .data 404, 921, 448, 668, -83
+L83: .string "sjac"
+lea L94, L185
+L84: .string "cf"
+L85: .data -649, -568, 924, -535, 604, -837, 6, -22
+sub *r3, L185
+L86: .data -883, -889
+add L77, L61
+L87: .string "nwp"
+clr r2
+L88: dec *r1
+L89: .data -466
+L90: .data 389, 476, -199, 182, 312
+red r5
+L91: .data 356, -346, 127, 324, 176, -195, 883, 76
+cmp #60, *r6
+L92: dec r4
+L93: .data 886, 994, -67, 405, 76, -566
+mov #50, r7
+sub *r1, L282
+red L178
+dec L175
+add #13, L72
+add *r4, r4
+add r2, L88
+L94: .data -68, -92, 989
+cmp *r2, r2
+red r0
+L95: .string "pszqpna"
+L96: .string "gkckkruvgeqqfrsujuyio"
+L97: .string "jrmc"
+L98: mov #186, r7
+dec r3
+bne L182
+; comment
+mov #-95, *r3
+L99: .string "ljemedx"
+L100: .string "eh"
+L101: .string "ypxwucb"
+L102: .data -279, 457, 312
+mov *r5, *r6
+prn L114
+L103: .data -272, 990
+red L74
+inc r5
+L104: .string "y"
+L105: .string "qbmyff"
+L106: .data 396, -974, -517
+L107: .string "xhlhjvcxymhyehtbuu"
+L108: .data -246, -956, -57, 831, -993, 146, -231, 848
+L109: .string "blmcmejhehwftrtbd"
+mov r3, r2
+L110: .data -240, 732, -52, 853, -162, -871, 737, 943
+stop
+rts
+L111: .data 410, 610, -3, -608, 314
+L112: .string "fjwrargigxaptbozp"
+inc r7
+L113: prn r1
+L114: .string "nprwchfuk"
+jmp *r0
+
+L115: .string "wwqwebsxaorggeuholkd"
+rts
+L116: not r0
+L117: .string "unkpdwzhfhxrknfrhvzdhl"
+L118: dec L49
+; comment
+L119: .string "yzzjjvgif"
+L120: .string "ixzhxtmislmw"
+L121: jmp L285
+cmp L215, #-154
+red L120
+L122: .data 873, -896, 537, -41, -312
+L123: .string "xhi"
+L124: stop
+L125: .data -199, 984, 319, -565, -74, -885, -746, 157
+jmp L48
+L126: inc r4
+L127: .data -803, 198, -639
+cmp r0, *r7
+L128: .string "busxwpdmkmbahaorztvt"
+L129: .string "wguenarsafanxw"
+L130: .data 904, 504, -861
+L131: .string "nc"
+L132: .string "iu"
+L133: .data -613, 110, 751
+
+inc r7
+L134: .data -104, -358, 470, -849, -667, -975, -879
+L135: .string "pgnmkkrvfjeiwixxqwfb"
+dec *r3
+L136: .data -77, -198, -156, 384, -723, -925, 649
+L137: .data 312, -235, -508, 173, -877, -84, 812
+L138: .data 240, -275, 366, 949, 455, -914
+L139: .string "uaheukz"
+L140: .data 755, 933, -384, -102, 683, 813, -202
+L141: .data -557, 639, 379, -429
+; comment
+L142: .string "rbruklgmaudqrddiwcbtvrun"
+L143: .data -21, -584, 76, -530
+L144: .string "cadawytlye"
+L145: .string "jypxtxabdyzczvc"
+L146: .string "e"
+L147: .string "yxwhjenwhjy"
+L148: .data 118, -998, -629, -714, 664, -462, 394, 551
+L149: rts
+L150: .string "sgsyaz"
+L151: .data 46, -694, 131, -72, 33, 658, -77
+L152: .string "vukptojsgncchofmeqxvnxc"
+L153: .string "vfrxslwqakf"
+L154: .data -870, -973, -874, -571, -331, 761, 836
+L155: .data 129, 809, -565, 62, 760, -415
+L156: .string "kbbsunqluqtcftchthtesr"
+L157: .data 297, 241
+L158: .string "rgoeofnybmi"
+; comment
+prn r1
+L159: .data 592, -526, 712, 269, -596, -855, 724
+L160: .string "qe"
+L161: .data -324, -641, -69, -397
+lea L293, r6
+L162: red *r6
+lea L297, *r6
+L163: .data -81
+L164: .data 355, -384, 247, 43, -712, 178, 736
+L165: .string "sfybuhlo"
+L166: .data 360, 907, 800
+sub #215, r2
+inc r1
+bne *r4
+L167: .data -823, 69, 276, 671, -122, 977, 888
+
+L168: .string "kusxaaolmemargmh"
+not L9
+L169: .string "tbl"
+L170: .data 907, 744
+L171: jsr *r4
+rts
+L172: .string "ut"
+L173: .string "zcv"
+L174: .string "qjejxjdinlkdy"
+L175: .string "ndhozwroewtsbkvikudmq"
+L176: .string "rxvaduayufatzxcnkos"
+L177: .string "vdbyksfml"
+clr *r2
+lea L169, r5
+L178: .data -548, 764, 424, -850, 520, 575, -77
+L179: .data -59, -856, -591, -910, 856, -798
+L180: .string "dhskczsmoaldyktc"
+L181: .data 212, 214, -411, 512, 495, 879, 888, 234
+L182: .data 793, 547, -897, 797, 414, -572
+sub #155, *r1
+red L79
+L183: .data 236
+L184: sub #-195, r4
+L185: .data -437, -492, -620, -881, 670, 746, -133, 557
+red r1
+stop
+L186: .string "kncno"
+sub L214, L273
+L187: .data -576, -99, -570, -243
+prn L106
+L188: .string "ohsxrupkhomgpnifeibf"
+lea L222, r3
+L189: .data 558, 713, -287
+sub L326, r2
+; comment
+L190: .string "psswaarkznj"
+jmp *r2
+L191: .string "lkowycvl"
+L192: sub *r2, r2
+prn *r6
+add #159, r6
+prn #-178
+L193: .data -164, 103, -630, -929
+stop
+L194: .data -935, -909, 15, 873, -917
+jsr *r6
+L195: .string "gvfg"
+mov r3, L162
+L196: jmp L294
+bne *r3
+mov #-31, *r7
+jsr *r2
+L197: .data -809, 313, 294, -261, -771
+L198: .string "gmmymycxffycyypqyrbh"
+mov *r7, r2
+jsr L319
+rts
+
+rts
+L199: .string "dnvjswjcfusrkwcfz"
+L200: .data -476, -256, 807, -238, -7
+L201: .string "izvoqvpgvutjshiinastvb"
+L202: dec r7
+L203: not r7
+dec L281
+not r0
+; comment
+add r1, r6
+L204: .string "lbhvbmbqnl"
+add r3, r2
+L205: jmp *r1
+L206: .data 869, -635, 369, -92, -570, -327, -268
+jmp *r3
+L207: .data 523, 42
+L208: .data -318, 716, 141, -726, -969, -919, 500, 8
+L209: .string "azlheakynlhakxnkglth"
+L210: .string "atrwcopmwmktcvi"
+clr L253
+L211: .data -237, 128, 26, -222, 663
+L212: .string "hxpbwysxvgajexoqxymmoj"
+L213: .data 647, -497, -597, 701
+L214: .string "mgcjl"
+
+not L109
+L215: lea L289, *r5
+L216: rts
+jmp L269
+L217: .string "ibi"
+L218: .string "taciseuhxwdl"
+add #223, L81
+L219: .data 878, -873, 74
+L220: .string "uayzoavjsksohcug"
+L221: .data 773, 234, 233
+not L258
+L222: .data -684
+L223: .string "oq"
+L224: .data -11, -633
+L225: .string "jxckadxci"
+
+L226: .data 956, -118, -176, 983, 695, -983, -711
+add r2, L306
+L227: .string "yygcrjospqivm"
+L228: .data 444, 611, -229, 980, 627
+L229: .data -676, 630, 187, 460, -533, 687, -580
+L230: .data 65, -877, -505, -314, 191, -84, 16
+L231: .string "vcsbsged"
+L232: .string "mwsquumoyz"
+L233: .data -209, -975, -905, -411, 445, -938
+
+
+L234: .data 151, 823, 339, 135, 102, -773, 336, 454
+L235: .data -69, 812, -840, 746
+L236: .string "hx"
+L237: .data -774, -407, -320
+L238: .data 585
+L239: .string "ukmkwyymffvwznsghjblul"
+L240: .string "mgeiwjylxgnhjdtsza"
+L241: .data -850, -290, 794, 996, 901
+L242: .string "okcclgwjdrzvxlyzfntoojk"
+L243: .data -574, -742, 11, 232, -209, -947
+L244: .data -66, 240, 607, -341, 101, 832, -332, -475
+mov L301, *r7
+prn *r7
+stop
+L245: .data -357, -839, 448, 386, -97
+L246: .data -745, -247, -768, 402
+rts
+L247: .data 751, 366, 42, -400, 177, 263, 413, -240
+L248: .string "rsdtwfrxqcuxcvaeoug"
+clr *r6
+L249: .data -131
+L250: .data 720, -975
+L251: .data 344, -848, 326
+inc L277
+rts
+L252: .string "mexgdorrxucrcirxlmlid"
+bne *r3
+L253: .string "mye"
+L254: not *r7
+L255: .string "zdfod"
+L256: lea L264, L133
+L257: .data 901, 601
+bne *r7
+clr L94
+L258: .string "gfrdhzyfltyntmhb"
+lea L309, *r0
+inc L206
+L259: .data -576, -191, 870, 367, 430, 105
+L260: .data -571
+L261: .data -424, 528, 656, -3, -641, 741
+L262: .string "tdnmbdmg"
+L263: .string "oldugjoygshagsjt"
+L264: .data -657, -634, 338, -56, 46
+L265: .data -970
+L266: .string "njjuvyem"
+L267: .string "abeadba"
+add L180, L257
+L268: .string "drmsvbrrkcfmkjdr"
+L269: .data 805
+L270: .string "uwdvwigefz"
+L271: jsr *r5
+L272: .data 117, 18, 375, -249, 825, -398, -194
+jmp L72
+; comment
+L273: .string "zzerdspqkuk"
+L274: inc r6
+L275: .string "rmdujs"
+L276: red r7
+; comment
+L277: .data 856, -800, -868, 520, -466, 434, 644, -904
+L278: .data -154, 292
+L279: .string "bshgccvzgcfryit"
+sub #-252, *r3
+L280: .string "vexpcwbeentnawydmgqt"
+dec L314
+L281: .string "dhcbzw"
+L282: .string "psdonbcmogamevhlah"
+jsr *r2
+L283: .data 341, 431, -915
+L284: .data -585, -494, -695, -23, -61, 702, -737, -995
+L285: not L330
+rts
+L286: .string "ayqjrnipcpyqwunlyw"
+L287: .data 47, -800, -981, 857, -784, 659, -896
+add L217, *r7
+jsr *r2
+L288: .data -234
+L289: .string "aeijtympxqqz"
+L290: sub r2, *r6
+L291: .string "jzkqsx"
+clr L122
+not L205
+L292: .data -237, -714, -406, 329, -365
+L293: .data 133, -763, -806, -967
+; comment
+stop
+L294: .data -734, 739, -657
+L295: .data 118, 547, -429, -231, 469, -819, 321, -836
+jmp *r6
+L296: .string "ee"
+inc r2
+L297: stop
+L298: not L325
+
+L299: .string "ehjd"
+mov #149, *r0
+L300: .data 101, -258, -298
+L301: .data 952
+L302: jmp L330
+L303: .string "hhqkem"
+L304: .data -538, 982, 368, 185, -659, 773, 864
+L305: .data -281, -800
+L306: .data 464, 651, 973, 830, -148, 795
+L307: .string "juazjnps"
+L308: .data 353, 626
+not L322
+cmp #-217, L37
+L309: add L324, *r2
+L310: .string "bfddnj"
+L311: .string "gwc"
+lea L3, L302
+jsr L329
+rts
+L312: .string "atkivegakyiggd"
+L313: .data -389, 468, -600, 618, -794, 160, -348, 426
+dec L292
+L314: .string "csmvbiwagqcuvzvidurovpfv"
+L315: .data 278, 35, -100
+L316: clr r6
+L317: .data -573, -886, -35, 551
+bne L51
+
+add *r5, r2
+L318: lea L331, *r5
+L319: .data 422, 221, -423, -537
+L320: .string "lopkwepm"
+; comment
+L321: sub *r5, L304
+L322: .string "n"
+L323: not L48
+L324: .string "bfrlnlkxvwquvu"
+L325: .data -211, -738, -69, 17, -485
+not r7
+L326: .data 888, -777, 502, 666, -777
+L327: .string "owx"
+L328: .data -814, -371, 895, 174, 327
+L329: .string "kogezu"
+L330: .string "gnnfekbngfqgo"
+L331: .data 365, -111, -308
+L332: .data -585, 234, 970, -93, 993, 414, 929
+L333: .data -785, -683, 707
+inc *r2
+stop
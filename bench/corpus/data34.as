@@ -0,0 +1,524 @@
+; Generated by genCorpus --seed 35
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: .string "luqpmdqapcsqvpzlgde"
+L1: .data 788
+
+cmp r0, *r4
+L2: .string "wvgsccofidcard"
+L3: .string "yfjenujq"
+L4: .data -108, 568, -500, -217, 348, 628, -828
+L5: .string "kvffpoebjtbmmyvldwewau"
+L6: .string "uyyb"
+cmp #204, #13
+L7: .data 129, 709, -764, -211, -286, -873, -113
+L8: .string "nqmrcnizkoscy"
+bne L6
+cmp L3, r7
+bne L208
+L9: .data -565, -773, 699, 823, 412, 17, -107
+L10: .data -366, 593, -536, 155, -743, -643, 750, -47
+jmp *r5
+mov r2, r6
+L11: .data 694, -82, -582
+L12: .string "xnnysuemomvcbtvyvarpdot"
+L13: .string "diivctkllle"
+L14: .data -745, -131, -1000, 723, -572, 533, -155, -938
+L15: .data -17, 800, -158, 62, 862, -394, -524
+L16: .string "zm"
+L17: .data 924, -390
+add r3, r1
+L18: .string "qtkxcwxexhd"
+inc L121
+L19: .data 449, 415, 997, 584, -250, 100
+L20: .string "hy"
+L21: .data 911, -707, 50, -738, -560, 830
+L22: .string "bqjews"
+L23: .data 74, 34, 366, 402, -403, 906, -462
+L24: .data 240, 545, 23, -564, -959, 417, -563
+L25: .data 864, 17, 979
+L26: .data 113, -702, -752
+stop
+mov #66, r7
+L27: .data -187, 154, -359, -752
+L28: .string "rantgkwf"
+prn L7
+L29: .string "qqdouwxsovtlgpvd"
+rts
+rts
+sub *r0, L18
+rts
+L30: .data -50, 695
+L31: .string "qncvhhpoxyqgcubcicg"
+dec L27
+L32: .data 414, 906, -482, 682, 744, 588, 845, 646
+L33: rts
+jsr L40
+; comment
+add #2, L112
+L34: .data -228, 332, -629, -611, -521, -21, -201
+L35: rts
+L36: .data -807, -207, 478, -283, 119, 291
+cmp #-54, L16
+L37: .string "swvrfbg"
+L38: red L31
+L39: .string "ygkwkvtarngutpci"
+L40: .string "svcrrlzwbkriwebdcx"
+L41: add *r6, *r2
+L42: .data 600, 165
+L43: bne *r5
+L44: .data -694, 221, -963, -986, 370, -769, 121, -865
+L45: .data 832, -270
+clr r7
+; comment
+; comment
+
+red r0
+L46: .data -229, 538, -761, 636, 488
+L47: .string "evhmtgyjzq"
+red r2
+bne L35
+L48: .data -669, 342, -277, 490
+dec L4
+L49: .string "hetnzmbnumsqsyhbvlt"
+L50: .data 139, -170, -242, 702, 363
+L51: .data 902, 315
+L52: .string "rxigkmdxhdrdzeusu"
+L53: .string "xrytkmclddt"
+red L18
+not r1
+L54: .string "zt"
+; comment
+dec L304
+bne L41
+L55: .data -178, 889, -623, 426, 846, 75, -986, 207
+L56: clr *r7
+L57: cmp r3, *r2
+L58: .data 325, 424
+inc *r7
+L59: .string "to"
+L60: .data -208, -413, 253, -518
+L61: .string "ndsdtlcsncbevcwvmedh"
+; comment
+L62: .data 109, 454
+jmp *r4
+L63: .data 732
+bne L40
+L64: .string "t"
+L65: .string "rafbsshvermzmrvaxrofs"
+L66: .string "ly"
+L67: .data -861, -544, -689, 896, -21, 106, 686
+L68: .data -97, -960, -330, 402, -259, 782
+dec L28
+L69: .string "xyhpwkvhkcuutmdti"
+L70: .string "zpmwlganeomjgl"
+L71: .data 943, -283, -873
+L72: .string "npauaqsqfgcdmncjnfbsi"
+L73: prn #-136
+L74: .data -285, -121, -290, 616, 213, 977, 496
+L75: .string "isyls"
+L76: .string "ijnkzehwfdderanefr"
+L77: .data 87, 520, -152, -7, -369
+L78: .string "ngcdbahqlpqqtnaakak"
+L79: .string "szxcisaaclry"
+not *r4
+lea L156, *r1
+L80: .data 285, 382, -825, 761
+; comment
+L81: .data -314, 436, -679, -246
+L82: .data 827, 396, 610, -143, -560
+L83: .data -136
+L84: .data 49
+red r2
+jsr *r7
+inc L208
+L85: .data -765, 621, -663, -424, -608
+lea L186, L126
+L86: .string "irb"
+
+L87: .string "rcsuccttlfwnwubypqfz"
+L88: .data -354, 542, 676
+L89: .data -554, -158, -427, -152
+L90: .string "wgu"
+L91: inc *r3
+add L68, *r3
+red r4
+L92: .data -826, 840, -727, -141, 899, 45, -699
+L93: .data 321, -882, -279, -743, -452
+sub L66, *r3
+stop
+L94: sub r5, L232
+L95: .data -189, -277, -257, -201, 430
+L96: .string "bmazuvkvmerhowzz"
+L97: .data 198, -283, 412, -80, 783, -3, 667, -958
+L98: .data 595, -495, 924, -297, -121, 367, -557
+L99: .data 385, -989
+L100: .data -381, 310, 208, 348, 133
+L101: .data -103
+L102: .string "bkuywdircxhsgtggxdtfpb"
+L103: .string "neixrktqxnev"
+inc L41
+L104: .data 515, 491
+L105: .data -166, -577
+rts
+stop
+rts
+L106: .data -163
+L107: .data 243, -652
+; comment
+L108: .string "jzohverocc"
+L109: .string "yjeykoqqicczicupakrsc"
+L110: .string "ikld"
+L111: .data 271, 41, 927, 818, 468
+lea L100, r1
+L112: .data -104, -788
+L113: .data -868, -948, -91, -320, 194, -122
+stop
+L114: .string "sqhute"
+mov *r2, r7
+L115: bne *r1
+sub #251, L231
+L116: prn #74
+L117: .data 745, 27, 968
+L118: .data 189, -774, -417, 229, -193, 97
+L119: .data -856, 190, 804, 336
+dec L153
+L120: .string "vjufjudwizuxnpeqhpoih"
+L121: .data 857, 59
+L122: .string "qgimq"
+L123: .data -188, 338, 782, -506, 902, 717, 362
+stop
+L124: jmp *r4
+L125: .string "ullfavbtroivhsxdctbdnc"
+L126: .data -935, -247, 837, -739, 957, 470, -839, -16
+clr L100
+L127: .string "ngeucqksfxmbmvczlmxvbqyf"
+L128: .data 471, -274, 963, -515, -534
+; comment
+L129: .data 342, 229, -597, -380, -913, -619
+L130: .string "coxjlmbolxx"
+sub L131, r6
+L131: .data 565, 997, -290, -274, 824
+L132: .string "hhdxvuslfjii"
+jsr L46
+L133: .string "mjaupsfihjherahzpu"
+mov *r7, L67
+L134: .string "eqqiwjltqbtbjfqkre"
+L135: .string "pspdqolzxduemmgr"
+L136: .string "axaqkzghrdvrxhggoibcqgku"
+
+L137: .data -887, -380
+L138: .string "lswy"
+inc L105
+L139: jsr L123
+L140: .string "w"
+L141: .data -568, -979, -750
+add *r4, L276
+L142: .data 359
+stop
+L143: red L235
+L144: .data -344, 985, 45, -978, -736, -439, 525
+L145: .data 82, 707, -470, -443, 828, 596, -197
+L146: .data -396
+jsr L125
+dec L188
+L147: .string "fpottcwap"
+L148: .data 28, 730, -257, 643, -361, 23, 637, -334
+mov #-125, r3
+L149: .data 717, 157, 923, 246, 540, -759, -352
+cmp r6, #-36
+L150: .string "fdem"
+L151: .string "yvydirbblshjzhq"
+L152: .data 61, 632, 537, -589
+L153: sub r4, r5
+L154: .data 473, 47, -728, -383, 48, -565, 258, -726
+dec r2
+L155: .data 705
+L156: .string "rjfgsguuwmoodmpomlngg"
+L157: .string "fuadezjzzuwtscnrwqkqcgs"
+L158: .string "sdnqpwtqsaanzlwljios"
+bne *r4
+red r5
+L159: .string "vxptzybgccdecax"
+clr L52
+L160: .data 159, 287, -364, -487
+L161: .data 932, -773, -39, -125, -63
+L162: .data -383, -705, -818, 243
+cmp #-86, L231
+bne L82
+L163: .data 764
+L164: .data -624, 660
+lea L166, L91
+jmp *r4
+jmp *r7
+red L208
+red *r7
+L165: .string "lxy"
+L166: .data 308, -626, -147, 443, 864, -560, 39, -552
+L167: .string "cxqjhsze"
+; comment
+stop
+red *r4
+red L295
+inc L266
+L168: bne *r1
+L169: .string "s"
+L170: .data -287, 839, 545, -685, 211
+L171: dec L170
+L172: .string "dvqznmigpvltoakxvarrruh"
+L173: add L170, L329
+L174: .string "yguianjucdcyavwqddiehnlu"
+L175: .string "wjpmkuhslgoqnxuckytscyp"
+not r0
+L176: .data 941, -27, -876, 897, -370, 205, -619
+L177: .data -316, 389, -918
+prn *r0
+jmp *r0
+red L205
+L178: .data -597, -429, 128
+prn L13
+L179: .data -612, 210, 992, -957
+L180: .string "jdawiscixunrfnmo"
+cmp *r0, L267
+L181: .data -191, 453, -561, -741
+L182: .data 341, 829, 966
+L183: .data -584, -31, -665, -852, -259, 234, -355
+L184: .data 70, 707, -175, -730, 630, -775
+not r6
+L185: .data -986, 699, 414, 601, 944, 337
+L186: .data 523, -534, 680, -816, -1, -265
+lea L39, r7
+L187: .string "pbetovwjxhpsjwccihkr"
+L188: .data 473, 592, -586, -580, -596
+L189: .data -316, 47, 552, -399
+L190: .data -848, 969, 80, -62, 375, 406
+jmp L202
+L191: .string "eecnn"
+L192: .string "oqpuspdvkiwffgwlz"
+L193: .data -10, 889, 201, -551
+L194: .data -894, -321, 91, 756, -567, 61, 490
+L195: .data 205, -708, 256, -36, -858, -134, 235, -767
+; comment
+L196: lea L277, *r5
+L197: .string "taz"
+L198: .string "yneoj"
+dec r3
+red r0
+L199: .data 447, 664, -683
+L200: .data -982
+L201: .string "qbkejxvyrccgcwgpfaswkqaz"
+L202: .string "difbomqfddizsfv"
+sub L334, r6
+L203: .data -97, -480, 284, -222, -111, 15
+
+L204: .string "yrrjaxsxjfsdgpra"
+rts
+L205: .data -277
+L206: .string "gdafkrmb"
+L207: .data -842, 528, 480, -474, -665
+L208: .data -215, 98, 878, 412, -475, 221, 913
+red *r4
+prn L235
+L209: .data -232, 510, 150, -643, 622, -156, -364, 696
+L210: .data 356, -348, -837, -226
+L211: .data -992, -65, -987, -441, 576, 15
+L212: rts
+L213: bne *r5
+L214: .string "wdndg"
+L215: .data -217, -565, -200
+rts
+L216: .data 709, 732, -42, 363
+L217: .string "xvpckzsgctqyffzjdl"
+L218: .string "ijdlhgjvh"
+L219: .data 681, 47, 464, 964
+L220: rts
+L221: .string "dumklftzccqsdanpbfrnz"
+rts
+L222: .data 506, -462, -235, -771
+inc r6
+L223: .data 572
+L224: .string "oyvhxvisibaeadrk"
+L225: .string "vzcxtby"
+cmp #-66, r2
+L226: .data -571, -243, 724, -906
+L227: .string "bolox"
+L228: .data 327, -806, 921, -689
+L229: .data 446, 20, 60, 767, 432
+red *r5
+L230: .string "ycojlbdedbaauona"
+add r2, *r4
+L231: .string "xuaoyb"
+red L228
+L232: clr *r5
+L233: .string "surmfszmhennnupmmtpvowr"
+L234: sub L249, *r3
+L235: .data -291, -487, 46, -65, -688, -974, 259
+L236: rts
+L237: .string "aejuprmjmkjbpx"
+prn *r6
+L238: .string "bqiqhsw"
+jsr L123
+L239: .string "ubhfnz"
+L240: red r5
+sub *r5, r7
+cmp #193, L182
+prn *r1
+clr r6
+L241: .string "seemh"
+
+L242: .data 937, 958, -251, 492, 838, -4, -93
+L243: .string "yghwvcpdldzzxookedtl"
+
+stop
+L244: .string "skcouqiryqfcapx"
+L245: inc L311
+sub #-140, r4
+mov r4, r1
+L246: sub r3, *r6
+L247: .data 147, -523, -774, -681, 574, 275, 278, -215
+L248: not r3
+L249: .data 234, -745
+L250: .string "rrwt"
+L251: .data 274, 357, 673, 745, -381, 24, -625
+L252: .string "osohgbqo"
+rts
+L253: .data -142, -629, 287, 493, 554
+L254: .data 403, -570
+add #67, r5
+clr r5
+L255: .string "rqcqw"
+L256: .string "hkprfwhaiiqayhvr"
+L257: .data -436, 795
+lea L50, *r1
+L258: .string "ug"
+L259: .string "cwpmgwctipk"
+L260: .data -164, 968, -890, 563
+L261: .string "scyp"
+L262: .string "snyjisjp"
+L263: .data 544
+L264: .data -427, -560, -400, -219
+L265: .data -451, -90, -165, 697
+L266: .string "kiwjpirghoxr"
+L267: .data -567, -660, 423, -798
+L268: .data -222, 244, -856, 103, 304, -524, -305
+add *r3, L293
+L269: .string "r"
+mov *r6, *r1
+L270: .string "tljz"
+
+L271: prn #176
+L272: .data 475, -155, 340, 488
+L273: .data 265, 415, -726, -443, -343
+mov *r3, r4
+prn r2
+L274: .data 259
+L275: .data 377, 940
+L276: .data -778, -583, -472, 403, -343, 356
+L277: .string "x"
+add *r7, r6
+L278: .data -130, -707, 94, 876, -18, 177
+L279: .data -91, 627, -936, 889
+L280: .string "xdaqidqxg"
+L281: .data -665
+L282: .data 847, 520
+sub L304, L18
+L283: .data 582, 325, 419, -122
+L284: .string "vfqtbhepvtdhacapu"
+clr *r3
+L285: .data -555, -536, 828
+L286: .data -696
+L287: .string "yterxpexuvtirpybzdpv"
+L288: cmp L317, r5
+jmp *r2
+L289: dec r2
+L290: .data -527, 350, -190, 580, 900, 270, -550, -883
+L291: .data -424, 641, -646
+L292: .string "gr"
+L293: bne L326
+inc L43
+L294: .string "hpnpswoxidsrnfwccv"
+L295: .data -562, 35, 430, -959, -404
+add r2, L298
+L296: .data 93, -911, -906, 269, -169
+L297: bne L325
+L298: .data -647, 609, 569
+bne L318
+bne *r1
+sub #-138, *r5
+L299: .data 821, -10, 409, -736, 630
+L300: jsr *r6
+L301: .data 73, 94, 597, 856
+L302: .string "psgzrcyxuasoaylihx"
+L303: .string "vbbjfgijaeb"
+stop
+L304: .data 650, 121, 993, -813, 767, -942
+L305: .string "jnocfbocq"
+jmp *r4
+L306: .string "krksvnaacc"
+L307: .data 702, -100, 521
+sub L147, *r5
+L308: cmp L323, #38
+rts
+clr L36
+L309: .data 655, 264, 721, -625, -337, 112, -653
+clr *r5
+L310: .string "vaktwtktsgdv"
+L311: .string "pznbkmslswsibawbucbj"
+L312: .data -871, -964, 495, -547, -980, -689
+L313: .string "rdpfqmcgebnd"
+L314: .string "jevjrusua"
+not L321
+add *r5, *r3
+L315: .data 90, -84, 111, 321, 173
+add *r1, *r0
+L316: .data 636, 705, -99, 264, -801
+L317: .string "gpchndhilkaplgw"
+L318: .data -208, 714, -861, 957, 518, -350
+L319: .data -241
+L320: .data -563, -608, 348, 723
+L321: .data 921, 75, -361
+L322: .string "trbmthweqocvxfidnefbw"
+stop
+dec *r3
+L323: .data 801, -301, 372, 123
+L324: .data 846, 150, 427, 286, -409, -704
+lea L325, L87
+L325: .string "ssizmjjjocblh"
+L326: .data 328, 654, 495, -952, -600, -723, 285, 544
+L327: .data 982
+
+sub *r1, r3
+L328: .string "yvftcnzstgi"
+L329: .data -936, 731, 139
+L330: .data 465, 634, -424, -567, -892
+jsr *r7
+L331: .string "ixrmrghbxxr"
+L332: .string "dysidibqefvtcbutl"
+L333: .data 662, -803, 908, 971, -75
+sub *r0, r0
+jsr L77
+sub r3, L8
+L334: .string "yan"
+L335: .string "yrdspqurlmoo"
+L336: .string "cjwto"
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 36
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+rts
+L0: .data -482, -9, -573
+dec *r0
+L1: .string "ktpnwwogmgxgphdewuhded"
+L2: .data 229, 857, 877, -969, 353, 708, 661
+L3: .string "bhlbpybtkeduqch"
+
+L4: .string "fab"
+L5: .string "nelgdxlsbu"
+L6: jmp *r6
+L7: sub L6, *r5
+L8: not r6
+; comment
+L9: rts
+L10: .string "fdxk"
+L11: .string "mlbgk"
+clr r0
+L12: .data -554, 347, -717, -184, 525, 130, -571
+L13: .data 172, -423, -907, -48
+L14: .string "sbje"
+jmp L211
+L15: .string "pjkyvpvesdivektbo"
+clr r2
+mov L10, *r6
+L16: .data -13, 444, 347, -688
+L17: .data -683, -216, 475, -519, -464
+; comment
+bne L12
+L18: .data -833, -623, 850, -738, 543
+L19: cmp r2, L5
+L20: .data -39, -600, 841
+L21: .string "blgqeioswbwocagrxitqbe"
+L22: .string "ddfbigncjmeqlojq"
+L23: .string "jxlmrhbhquqgf"
+L24: .data 508, 409, 999, 360, 419, -568, 870
+L25: .string "mok"
+L26: .string "carcvnryfxdnnaigz"
+dec L157
+L27: bne *r1
+L28: .data 546, 433, -233, 707, 232
+L29: .string "r"
+L30: .string "qlwockjiilfk"
+clr L6
+L31: .string "rwxpnwuafkjvwgsvwrruwv"
+L32: .string "zdqeoysofixjuvsbhzf"
+L33: .string "ujsqnkpsofidbmepgc"
+sub L19, r1
+L34: dec *r5
+L35: .string "ufzgtojmvraynfmjxbhc"
+L36: .data -44, -861, -188, 545, 708, -629
+L37: .data 155, 170
+L38: .data 348, 740
+L39: .string "tbwdhyvov"
+clr *r5
+L40: .string "kljojli"
+jmp L93
+L41: .data 515, 643, 847, 182
+bne *r6
+add #70, *r2
+; comment
+
+dec r4
+L42: .data -50, 366, 517, -42, -296, -721, 666
+L43: .data 308, 267, 783, 522, 931, -9, 525, 3
+L44: .string "ihaxvbdkfkdsdu"
+L45: .data 679, -345, -430, -520
+L46: .data -674, 903, 63, 93, 928, -644, 417, -934
+L47: .string "wmshqm"
+L48: .string "ghpmynkjbo"
+L49: .data 396, 596, 769, 857, 268, -455
+L50: .string "xc"
+L51: .data 488, -701, 552, -577, 259, 192, -248, 611
+L52: jmp *r6
+
+cmp *r7, L273
+rts
+L53: .data -121, -633, -974, 831, -870, 704, -683
+; comment
+L54: .string "efiomzyfaxdwggnbjmzpzna"
+L55: .string "wru"
+L56: .data 271, -828, -33, 223
+; comment
+; comment
+red *r1
+L57: .data 377, -631, -95
+L58: .data -262, -873, 320, 911, 638, 829, 145, 31
+L59: .string "grermdlwi"
+add *r6, r4
+L60: .data 32, 513, 634, -718, 167, 626, 700
+L61: .data 616
+L62: .string "snnoosmzobxfsn"
+L63: .string "buarhutvldmeqtsimrfvn"
+lea L19, r4
+L64: bne L144
+lea L33, *r5
+red r1
+L65: .data 570, -13
+L66: .string "lnnppyhoila"
+L67: .string "riubzwbirxndpbuyhfakzdv"
+; comment
+L68: .string "hagav"
+jmp L42
+L69: .string "yjzozoekodko"
+L70: .data -243, -575, 755, -545, -570, 559, 590, -776
+L71: .data -361, -720, -210, 950
+inc r2
+L72: .string "uh"
+L73: .data -40, 984, 776, -420, 693, -912, -763, -760
+L74: .data 800, 778, -310, 810, 308, -65, -723
+L75: .string "grzdk"
+L76: .string "ssmqcachftj"
+L77: .data 97
+L78: .string "pdqtsk"
+L79: .data -492, -204, -629, -888, -738, -831, -470, -785
+L80: not L75
+L81: .data 705, 604
+sub r5, *r0
+L82: .data -203, -74, -994, 94, 254
+L83: .data 39, -843, 921, -175
+L84: .data -249, -240, 244, -156
+L85: prn r5
+L86: .data 175, -921, 361, 356
+rts
+L87: .string "piyyanbkqas"
+L88: .data -53, -907, -515, -701, -216
+L89: .string "xkzkna"
+L90: .data 940, -272, 42, 287
+L91: .data 843
+L92: lea L25, L321
+
+L93: .string "fnfmswdegbvpj"
+L94: .data -482, -969, 707, -614, -991, 981, 917
+clr L143
+bne *r6
+L95: .data -893, 551, -793, -170, 70, 897
+L96: .data -229, 819, -853, 352, -106, -989
+L97: .data 819
+L98: lea L41, *r6
+
+stop
+L99: .data -25, 348, -302
+L100: .string "ikg"
+rts
+cmp #-249, *r0
+L101: .data -82, 657, -958, 680, 61, 970, -630
+L102: .data -337, 980, -951, 786, 625, -169, -556
+L103: .data 376, -914, -364, 580, -28, 706
+L104: .string "qakncfliitcimugbwkxj"
+L105: .data -157, 154, -757
+L106: .string "akgcdifxqbbwgvrkwo"
+L107: .string "zffdnqfoliplcosjwgchrvt"
+L108: .string "temuispkhqms"
+stop
+L109: .string "yntolyostckryezeyykzddp"
+lea L136, r3
+stop
+L110: .string "uztgiecpg"
+L111: .data 211, 628, -811, 718
+L112: prn r4
+L113: .data -371, -751, -783, -583, -329
+not L42
+sub #-35, r7
+L114: .data 684, -392, -340, 752, -207, -233, -710, -675
+L115: .data 577
+bne L14
+L116: jsr *r5
+L117: .string "abioutqs"
+L118: .string "frjfkrfjtn"
+L119: .data -901
+L120: .string "khaehyywqcvartzkul"
+stop
+L121: .data 401, 146, -762, -97
+mov #-193, *r7
+L122: .data 347, 967, 185
+L123: .string "dreslvnayodkj"
+stop
+bne L308
+L124: .data -197, -998, 693, 234, -254, -768
+L125: .string "m"
+L126: .string "pjabgelg"
+jmp L167
+L127: .data -113
+; comment
+inc *r1
+
+L128: .data -577
+prn *r7
+L129: .string "ubegfhkdmkcyxpslqdhsf"
+dec r3
+L130: red L168
+mov L121, L160
+dec *r3
+L131: .data -121, -156, -891, -313
+L132: .string "sddkbh"
+red L208
+cmp *r0, *r5
+L133: prn #-138
+L134: .string "ynraqgfxtvje"
+L135: .data 282, -699, -821, 685, 726, 210, -244
+L136: .data -301
+L137: .string "jyfvpeinp"
+L138: .string "mposdtxhe"
+L139: .data 120, -541, -708, -910, -741, -956
+L140: .string "pfeidnazoyxwcyvlgcgjbdza"
+L141: sub L31, L174
+L142: .data 238, -334, -156, 387, -354, 597, -74
+L143: .string "vnqxgwmi"
+L144: .data -566, -108, -615, 958, 122, 215, 308, -341
+
+L145: .data -339, -449
+L146: .data -694, -292, 156, -325, -280, -897
+L147: .string "pjbeykwggkhbg"
+L148: clr r6
+L149: .data -753, -49, -481, -372, -273, -269, 895, 117
+mov #179, L198
+add L225, L144
+L150: .string "qtwpmau"
+sub r3, *r3
+L151: .data 795
+bne L223
+L152: .data 96
+L153: .string "c"
+L154: .data -894, -93, -835, 367, -487
+L155: .data -954, -197, -810, 432, 762, 936, -119, 736
+L156: .string "yoltwadgfmrshrvgavx"
+L157: .data 214, 675, -253, -705, 300, -929
+L158: .data 776, -434, 861, 994, 163
+jsr L220
+L159: .string "eekob"
+L160: .data 934, -654, 93, 395, -673
+L161: .string "gd"
+jsr *r6
+L162: .string "jtfwstitzotqvgazepmcsktt"
+L163: .string "lfabbotnjutovonokzxid"
+jmp *r5
+L164: .string "vfodbd"
+L165: .string "uxsfthpb"
+L166: .data 94
+; comment
+L167: .data -949, -538
+L168: jmp L119
+L169: .string "fpmsqyxwzxrtopgufxtqhlv"
+L170: .string "gojagreppjixxcl"
+L171: not L7
+L172: .data 202, -394, 509, -393
+L173: clr *r4
+inc L105
+L174: .data -527, -534, -874, -472, 682, -441, 473, -978
+L175: .data -127, 189, 400, 715, 581
+L176: .string "ump"
+add #232, *r1
+inc *r6
+L177: .string "sjwcpsg"
+dec *r4
+L178: lea L33, L92
+rts
+L179: .data 286, 354, 0, 735, 887, 784, 358, 166
+mov r4, L264
+; comment
+L180: add L71, *r3
+L181: .string "lnzeqjmqicadidygfvz"
+L182: .data -703, -378, 510, -563, 454, -733, -602
+L183: .data -113, -206, 891, -441
+L184: .string "rhhociy"
+sub L27, r3
+L185: .string "mgikoawnnxhc"
+inc L323
+bne L282
+L186: .string "mzzqnjorwebyptb"
+L187: bne *r6
+L188: .data -549, -859
+L189: .string "pmlhprnnjgnlfug"
+L190: .data -7, 335, 445, -413
+L191: .string "uwgkffyhpmwhpaowigwzc"
+L192: .string "rxvutlrupghtoaiioivtj"
+add #180, L272
+L193: .data -305, -106, -763, 395, 591, 33
+L194: .string "mjqlcnbdrgltnubjis"
+L195: .data -403, 878
+L196: .data -916
+L197: .string "ggguxapiewvcngxyxtdwsa"
+L198: .data 111
+sub *r7, L109
+; comment
+prn *r3
+L199: .string "gnhxtkzmkmzetid"
+not r2
+L200: .string "qnbszuszpvmc"
+lea L256, L244
+L201: .string "qsgfdzpbamotswwanqlj"
+red L142
+L202: .string "tczsgydjmcbiyqeerazn"
+L203: .data -557, 541
+L204: .string "mfkfvw"
+L205: .data 984, -709, 846, 489
+L206: .data 855, -384, -126, -554, -645, 896
+clr L219
+L207: not L297
+mov #213, L94
+dec *r7
+L208: .data -675
+jsr L292
+jsr L163
+L209: .data 832, -868, 427, -511, -963
+add #102, *r5
+clr r2
+L210: .string "y"
+L211: .string "fbvgqss"
+L212: .string "neysbscceevwbpnoplzkssw"
+add #159, *r6
+jsr *r2
+L213: .string "p"
+bne *r3
+mov #-12, *r3
+lea L260, r0
+L214: add *r2, L247
+not *r6
+cmp L305, #-159
+jsr L293
+L215: .string "xeuwgkbid"
+add L38, *r1
+dec *r5
+L216: .string "sqcaxv"
+jsr L104
+stop
+clr L130
+L217: inc r3
+prn *r1
+prn r3
+L218: .data 595, -650, -666, -199, -538, -701
+stop
+mov #-184, r4
+L219: .string "tyjimbbmx"
+L220: .string "lnbuqeuvkcbycbihnnms"
+bne L43
+L221: .string "aeawdgvisucosxlswksonjso"
+L222: .data -208, -459, -645, 756, 420, 480, 178, -982
+
+prn *r1
+L223: .data 220, -236, 703, -919, -948, 971, 49, -503
+L224: .data 120
+sub *r7, *r0
+L225: .data -176, -281, 69, 850, 482
+dec L263
+L226: .string "qbviozrfmqvuzmo"
+L227: .string "ltuepsl"
+mov *r2, L278
+L228: .string "facr"
+L229: add #212, L276
+cmp L307, *r1
+not *r0
+L230: .data -317, 489, 529, 803
+stop
+L231: .string "j"
+L232: .data -208, 763, 635, 221, 424, -744
+add r3, r3
+clr L263
+L233: .string "hdbarkcnbozkfz"
+L234: .data -579, -361, -122, -423, 266, -817, -455
+L235: .data -469, 350, -862, -701, 108, 191
+L236: .string "nosjkrajqaouykgp"
+add L323, L293
+rts
+L237: .data 187, 724, 723
+L238: .string "rsppcrcznojfzt"
+L239: .string "uvyscnhvacxjj"
+L240: .string "kgsfunufnyla"
+
+sub *r6, L299
+L241: .string "jjyxes"
+rts
+L242: .string "dvevuy"
+L243: .data 360, 929, 627
+L244: .string "ekrewnkqox"
+jsr *r2
+L245: .string "hqbcjpxvjhnrbzpf"
+L246: .data 374, -802, -849, -588
+lea L266, *r3
+L247: .string "ckthuiactmjpnzwm"
+L248: stop
+L249: .string "gkgsnajtzqocxjdbkv"
+L250: .data 345, 119
+L251: .data -473, -411
+L252: prn r4
+lea L304, *r0
+L253: mov r4, *r0
+L254: .data -570, -536, -91, -483
+lea L269, L36
+L255: .string "fjenehiv"
+L256: cmp *r6, L50
+lea L271, *r6
+stop
+mov L30, r5
+L257: .data 477, 537, 901, 18, -640, -675, 717
+L258: .data -339, 750, -658, 18, 762, -749, 603, -10
+L259: .data -295, 65, -94, 456, 527, 949
+L260: .string "atjjigbdbichcbgfq"
+L261: .string "opyarcwhxb"
+L262: .string "kkpvancuplocmsdpsfmdm"
+L263: .string "gehlsqdxrsplefpmxahdqql"
+L264: .data -637, 858, -554, -379
+L265: .data 528, 158, -12
+L266: .string "ahavqsmftjjbwunqcm"
+L267: .data -935
+L268: .data -268, -271, 514, 59, 88, -437, 948
+L269: .string "vauccrshkclbiazahyldis"
+L270: prn *r1
+L271: .data 763, -382, 164, -57, -232
+; comment
+cmp r4, r6
+L272: .data -363, -892
+L273: .data 852, -751
+L274: .data -964, 487, 655, 192, 434, 305, -271, -884
+L275: .data 447
+L276: .data -408, -953, -489, -40
+cmp *r6, *r0
+L277: jmp *r3
+L278: .data 880, 239, 911, -200, 930, -190, 412, -793
+inc *r3
+L279: .string "tkw"
+stop
+L280: .data -854, 865, -676, -942
+L281: .string "i"
+prn r2
+add r1, *r6
+L282: .string "gsligmd"
+sub r3, r6
+L283: .string "up"
+L284: .string "pqota"
+sub L285, r4
+
+clr L248
+rts
+L285: .string "bkistnyzhrpuanw"
+; comment
+clr *r6
+L286: .data 784, -373, -457, 594, 73
+L287: .string "yxgwqywvantamkgra"
+L288: .data -80, 39, -575, 767, 35, -705
+dec r3
+L289: .data -142, 132, 979, -250, -376, -75, -2, -121
+
+lea L140, *r4
+L290: .data 716, 557
+L291: .string "dxllmfdo"
+L292: .string "smajcaylhxque"
+L293: .data 217, -736, 5, -952
+L294: .string "avnvq"
+jsr L305
+L295: .string "t"
+rts
+L296: .data -540, -176, 898, 306, 410
+L297: .string "tuuamsfeqppxqdmgnfm"
+L298: .string "lfomjqmxilmcrucmc"
+; comment
+
+L299: .string "obrw"
+prn L319
+L300: .data -890, -322
+bne L310
+L301: .string "sdximuhasnfdhjsq"
+L302: .data 436
+rts
+L303: .string "cbligxowyl"
+lea L60, L317
+L304: .string "colyqeurfqxng"
+L305: .string "jvjtqkez"
+L306: .string "ydayvooagkj"
+L307: .string "oduwruvwd"
+L308: .string "fz"
+cmp #105, r1
+L309: .string "vbxevvuueknqfmjekptwwdr"
+L310: .data 547, 195
+L311: mov #-231, r0
+sub r4, *r3
+L312: .string "nsrvewwitvhl"
+L313: .string "zvlvhquqwcxxytoruruszybu"
+
+L314: .data 916
+; comment
+L315: .string "wullxqzy"
+clr L323
+L316: inc L323
+L317: jmp *r2
+L318: .string "qpduruyvwzvdxkbznlbq"
+L319: .string "xjqxplgtmrosddxcptwz"
+dec r1
+L320: .string "whmcn"
+L321: inc *r1
+
+L322: .data -364, -37, 534, 515, 207, -350, -695, -576
+clr r2
+L323: .data -982, -815, 529, 220
+; comment
+L324: mov *r4, r5
+L325: .string "eknfquaz"
+; comment
+dec r1
+L326: .data -876, -612, 593, -891
+add #-17, *r1
+stop
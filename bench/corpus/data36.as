@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 37
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+inc r3
+L0: .data 483
+lea L199, L131
+stop
+L1: .data 629, -758, 23, -678, -14, -114, -800
+jsr L261
+L2: .string "ncyrorzywszrsgodal"
+L3: .data -798, -602, 37, 317, 525, -809, 319
+dec *r3
+L4: rts
+L5: .string "xipvnkcsvbaalrwxp"
+red *r7
+L6: .data -643
+L7: stop
+L8: .data -211, -80, 438, -259, 34, -121, 969, -342
+L9: sub L317, r4
+L10: .string "uudecvfiwnhdqjw"
+L11: .data 728, -843, 99, -891, -371
+L12: .data 799, 681, 789, 418, -320, 520, -305, 19
+clr L3
+L13: .data -750, -386, -308, -363, 276, 741, 277, 260
+L14: .data 799, 820, -689, 796
+L15: .data 508, 314, 166, 292, 946, 939, 310, -7
+not *r4
+sub *r5, r5
+dec L5
+L16: .string "dtjwyutxsfxekppjck"
+prn L305
+L17: .data -599
+L18: .string "bsogjzpueebvpr"
+L19: .string "jjffudxfntdttoaqpulrs"
+L20: .data -377
+L21: .string "bagjwhibt"
+mov r5, r2
+L22: .string "zw"
+L23: .string "nvqhpksnpzdzd"
+L24: .data 607
+L25: .data -811, 738, -773, 632, 272, 915, 281, -644
+L26: .data 411, 725
+L27: .data 622
+jsr L12
+L28: .string "cazbcyfrxdmisvyfeoz"
+L29: .data 554
+L30: .data -732, -374, 100, 473, 387, 368, 28
+L31: .string "zsfiynudxhskbcjhbnqia"
+L32: .string "ribxaezalouqvntertrkj"
+L33: jmp *r1
+L34: .data -11
+L35: .data 135, 662, -423, 649
+jmp L217
+prn r7
+L36: .string "tvcmtunlbskhucyrx"
+L37: .data -834, -148, -647, -880, 922, -506, -576
+L38: .data 608, -277, 822, -842, 52
+L39: .string "dez"
+jsr *r0
+L40: .string "eddhl"
+L41: .string "nyhwca"
+L42: .data -203, 119, -89
+dec L12
+L43: .data 382
+L44: .string "bszk"
+jmp L103
+L45: .string "pfxmxvprdvn"
+L46: .data 891, 387, -500, -623
+clr *r6
+L47: .data -620, -565, -792, -593
+L48: .data -404, 196, -357
+L49: .data 702, -90, -562, 327, -151, -206
+
+L50: rts
+L51: .data 776, 113, 52, 326
+L52: .string "pohzrlemayove"
+L53: .data 182, -473, -17, -952, 631, -814
+L54: .string "fxbnfdvpet"
+rts
+L55: .data -720
+L56: .string "zxlaoyphhxvpssgyovvvork"
+L57: .string "qeboajgrubwmsbqqqr"
+L58: .data 399, -977, 193, 492, -811, -917, -669, -444
+L59: .data -999, -886, -925, 447, 274, 534
+L60: .string "pmweoc"
+L61: .data 723, -80, 287, 407
+L62: .string "jfb"
+
+L63: .string "auegfdlyzg"
+not r3
+prn *r5
+L64: jmp L121
+L65: .data 844, -459, -518, -13
+L66: .string "ifuovxhnjm"
+; comment
+L67: .string "bcctuxmwdgjaenghnysp"
+jsr L63
+clr *r2
+L68: .string "tirwntcwwgkaulnqlntddzpx"
+prn #226
+jsr *r6
+L69: .data -729, 70, -620, 198
+cmp #-72, *r4
+L70: .string "oie"
+L71: .data 321
+L72: .string "vsp"
+L73: .string "ut"
+L74: .string "nepszuilimjxlgjrbvqab"
+L75: .data 178, 14, -725
+L76: .data 503, 23, 720, -696, 432, -298
+L77: .string "uicmmmmkkim"
+L78: red r1
+L79: .data 672, 116, 171
+L80: .data 313, -897, 14
+L81: .string "hwpfpug"
+L82: bne L56
+lea L69, L228
+stop
+L83: jsr *r4
+L84: .data -547
+L85: .string "jbkdecetyoicmaroscd"
+; comment
+inc r2
+L86: .data 167, -865, -322, 341, -280, 246, 437, -715
+L87: .string "gvywcfhakmpaul"
+L88: .data -528, -537
+L89: .data 256, 560
+clr r5
+
+L90: .string "ciltgzskedaprkzbbmlyz"
+L91: .string "jbonirzcllcpxltegtavhiy"
+L92: .string "quybnmlrbsbgtztulpjfipri"
+red *r2
+stop
+L93: .string "bmqtmppbalcunv"
+L94: .data -963, -713, 308, 200, -128, 775
+L95: .data 303, -77, 194, -695
+L96: .data -981, 978, 373
+bne L202
+L97: .string "j"
+L98: .data 733, -442, -141
+L99: .string "lwetlmefqzvlphi"
+L100: .data 156, -652, 635, -767, 431, 638, 250
+L101: .string "rdujetoegeqbvyx"
+L102: .data 903, -128, -648, -561, -860, 554, 854
+L103: .string "ocwhp"
+dec *r0
+L104: .string "wokspao"
+L105: clr L42
+L106: .string "oauayaohwakxi"
+L107: .string "ptvajuziigopvetvzvdj"
+
+jmp L16
+cmp L198, #110
+L108: prn *r6
+; comment
+L109: .data -241, -782, -759, -803, -442, 634, 357, 994
+L110: .data -803, -380, -844, -464, 87, 920, -852
+L111: .string "kuioycixejuz"
+clr L81
+L112: .string "yeitm"
+add #96, r6
+add L103, L69
+L113: .string "nbktihzxchaiymjtviaowsfa"
+
+rts
+L114: .string "bhqulruxbreiyadbr"
+mov #130, *r0
+jmp L85
+L115: .string "mfogazzzozj"
+L116: .string "amqghvin"
+L117: .string "vvyamdeoertmnarnnflfz"
+L118: .string "mmjimwtodcaxkhuotrkynk"
+L119: lea L58, L58
+L120: jmp *r6
+L121: clr L7
+L122: lea L190, r0
+L123: .data -448, -683, -66, 193, 651, 560, -335
+L124: .string "fdzlgruzxwoprzhw"
+L125: .data 580, -630, -211
+rts
+L126: stop
+mov #242, L222
+L127: stop
+jsr L108
+L128: cmp *r6, L170
+lea L80, L307
+prn *r6
+L129: .data -238, -672
+add r5, *r7
+; comment
+bne L76
+L130: .data -765, 594
+L131: .data -500, 901, -785, -613, 659, -271, -73, -161
+L132: .string "ktvvaahnykzon"
+clr r5
+L133: .data -821, -314, 321
+red L80
+
+bne L70
+L134: .data -562, 967, -906, 163
+L135: .data -957, -583, -413, -193
+L136: .string "gilenqjynijmay"
+
+L137: .data 960, 607
+L138: .data 52, 349, -799, 59
+rts
+L139: bne L206
+L140: .data 352, -287, 169, 41
+stop
+bne *r1
+L141: .data -318, -677, 396, -256, -93, -795, -706, 518
+L142: .string "kuocl"
+L143: .string "fu"
+L144: lea L26, r6
+L145: .string "xulynpe"
+L146: .data -837
+L147: .string "emn"
+bne *r5
+L148: .string "nqkvnt"
+prn r1
+L149: .string "oulehhldtvyrbnkhlogah"
+jsr *r1
+dec L153
+cmp *r5, r5
+L150: .string "kshiiku"
+L151: .string "yqpqerifzxlgyavgtkhqu"
+L152: .data -110, 516, -548, 169, 880, 637, -155, -142
+inc *r2
+red r2
+L153: .data -606, -584, 965
+L154: .string "pizjsffwiblavxzxacm"
+rts
+; comment
+L155: .data 795, 830, -815, -175, 696
+L156: .string "utgfvxfjpgictlduqytqxmn"
+L157: .string "ifemzxculadopyncmhqc"
+L158: .data 101, -661, 904, 550, -687, 184, -898
+mov #193, L143
+not L238
+rts
+L159: .data -458, -301, -980
+L160: red r1
+lea L6, *r3
+L161: .data 924
+inc r1
+L162: .string "yicsahvreaulxpzho"
+L163: .string "nzemilxhlxqdl"
+L164: .data -119, -507, 850, 502, 394
+L165: .data -418, 65, -244, 172, 316, -851, 918, 547
+red r0
+dec *r5
+cmp #37, L294
+clr r0
+
+L166: inc *r3
+L167: .string "vpazbhrxnjkrtkvnhidj"
+mov #45, r6
+L168: prn #226
+L169: .string "yzjpegzmwqcyftoivbraqu"
+sub *r4, *r1
+L170: .data -596
+not L209
+dec r2
+L171: .data 781
+; comment
+L172: .string "pryhiyohjqfytynkdery"
+L173: .data -495, -468, 155, -696, 268, 339, -648, 59
+lea L309, r1
+L174: .data 563, -366, 859, 784, 227, 139, -858
+L175: .data -207, 815, -383, -853, 586, 220, -635
+L176: jsr L205
+clr r4
+L177: .data -508, 934
+L178: .string "zdbprfjagzqmsnvrucjgdx"
+bne *r3
+L179: .data -175
+sub r6, r4
+sub *r7, r7
+L180: .data -39, -452, 406, -887, -181, 734
+L181: .data -639
+L182: .data 4
+L183: .data 893, -699, 598, -183, 765
+jsr *r5
+L184: .string "xbevduprtsjhyfdqudzffwkx"
+L185: .string "fokptonuayznhoeydlvod"
+L186: stop
+inc L130
+clr *r2
+add #118, L162
+bne L271
+L187: dec *r3
+prn *r0
+prn r0
+L188: .string "safufbdilagclu"
+rts
+mov r4, r7
+L189: .string "zxcqajkmps"
+L190: bne *r5
+sub *r0, L221
+dec *r7
+L191: bne L183
+lea L282, r1
+mov r6, *r7
+L192: .data 193, -679, 180, -555, -325, -339, 957, -155
+dec *r2
+L193: .data -98, 459, 30, -342, 260, -373, -241
+inc *r4
+inc *r4
+add *r5, r3
+L194: .string "wjdgvfybqoopqwvofjyet"
+L195: jmp *r4
+L196: .data -276, -513, 534, -153, 78
+red r2
+L197: .string "ckquhd"
+L198: .string "siutlidgyoyzmp"
+L199: .data 107, 968
+L200: .string "xcz"
+L201: .string "cxfooiotrikahvrseeoldkt"
+rts
+L202: .data -754, -721, -495, -255
+not *r7
+red L217
+jmp L290
+L203: .data -452
+bne *r1
+red r1
+L204: .data -89, 438, -994, -703, -443, -878
+L205: .data 824, -307, 576, -932, 524, -320
+L206: .string "txmrzwdeuyywdn"
+L207: red r6
+L208: .data 445, -75, -400, -319, 646, 833, 765, -639
+L209: .data 149, -300, 370, 644, -453, 689, 146
+L210: .string "rquprcautl"
+add r7, L41
+L211: .string "lmonkmdohaviivdmztlapyny"
+L212: .data -682, -913, 988, 129, -497, 312, 558
+L213: .string "lyfnkierulqgfrlwasfh"
+L214: .string "zfaqthnk"
+L215: .string "rkussgqzakzoq"
+L216: .data -822, 67
+L217: .string "xdqqturjsltmt"
+L218: inc *r1
+L219: .data -278, -390, 849
+L220: .data -647
+add r2, *r1
+L221: .data 492, 511, -13, -220, -299, 296, -964, -765
+L222: .data 227, 991, -457, 771, -797, 733, 232
+clr L213
+
+rts
+L223: .data -696, -126
+L224: .string "kkgj"
+L225: .string "fgnoraoauzfhpvdasqvb"
+L226: .string "viwquebrdmetnzgruhy"
+L227: .string "bdlblyvduhfzqq"
+L228: .data -677, -717
+L229: .data 974, -419, 164, 824, -732, 894
+
+L230: .string "lrp"
+L231: .string "ukeyrxfunmbhsxyu"
+L232: .string "lfcflgdchgidtf"
+L233: .string "szuwkz"
+L234: jsr *r4
+inc *r3
+L235: .string "xfsmwosbxcfainminsfd"
+L236: .string "uncmtvpvmnxc"
+L237: .string "osvzwafihyq"
+L238: .data -985, 733, 238, -613, -955
+L239: .data -50, 66, -434, 812, -792, 302, -783
+L240: .string "qlrp"
+L241: .data 260, 493
+L242: .data -838
+L243: .data 536, -35, 75, -537, -606, -511
+L244: .string "ogtepsooaxunlv"
+L245: .string "xhbmmehrxn"
+L246: .string "deu"
+bne *r6
+bne *r1
+L247: .string "prjwcyynfqjhomfnpvy"
+L248: .data 985, 387, 825, -377, -611, -325, -945
+L249: .data 606
+L250: .string "grdfypmifvzinja"
+stop
+add r7, *r7
+L251: .data -98, -53, -982, -875, -676, -836, -993, 165
+jsr L274
+L252: .string "olahtemhqixigmcqcqfalhg"
+L253: .string "dezwadytkxnepbknayg"
+L254: .string "xxx"
+L255: .data 897
+L256: .string "gsfbcnfeddv"
+L257: .string "ztngnhvanevgpyj"
+L258: .string "fratdgfsy"
+prn #240
+L259: .string "gflmmrelzityogbjft"
+L260: .data -416, 124, 938, -859, 150, -774, 489
+cmp L38, r4
+rts
+sub L200, L82
+mov L214, L303
+L261: add L284, *r0
+L262: .string "wkknexim"
+L263: .data 31, 520, -950, 486
+sub *r0, r7
+jmp L275
+L264: jsr *r4
+L265: .data 674, -429
+L266: .string "nqnaanov"
+rts
+L267: .data 704, 775, 162, -602, -932, 594
+L268: .data -458, 235, -286, 985, -625, -860, -19
+red r2
+red *r0
+add #-157, r2
+rts
+L269: .string "ouzvt"
+L270: .string "gznxpdojokhnzbhfbrudfre"
+L271: .data 3, -996, -97, -746, -684, 212, 683
+L272: prn *r3
+L273: .string "cwagoubuzpkzoapfb"
+mov r2, L287
+
+rts
+L274: clr L285
+L275: .data 830, -935, -45, 416, 57
+clr r6
+L276: .data -661, -63
+lea L311, *r5
+L277: .string "sa"
+L278: .string "ynlulckxhsrht"
+L279: .string "abfjhvk"
+clr r2
+L280: .string "kzfaec"
+L281: add *r3, r4
+L282: .string "ruczqtmqmfuetwmnmodfgoq"
+prn *r1
+L283: .string "qye"
+cmp L320, #5
+dec r6
+L284: .data 245, 394, 916
+L285: .data 287, -153, -875
+L286: .string "gsfuvzwsslgluwxxvghvqfdy"
+bne *r2
+L287: .data 304, -771
+add *r6, r6
+not r5
+L288: .data -169
+L289: .string "lko"
+L290: .data 99
+L291: sub L54, L310
+L292: not r4
+L293: .data -3, 40, 621, -271
+mov #138, L119
+L294: .data 340, -586, -183
+cmp #89, L320
+
+L295: .string "iqqfpxzkzqidpuyp"
+L296: .data -222, -54, -893, -161, -365, -728, 918
+inc *r5
+L297: .data -878, 452, -752, -356, -963, 883, 844, -785
+jsr L301
+sub *r0, r6
+L298: .string "is"
+cmp *r5, L251
+clr r2
+dec r2
+L299: .data -130, -890, 250, 276, -191, -285
+L300: .string "iyxzfhqjtj"
+L301: inc L316
+L302: .string "lvo"
+bne L265
+mov #-11, L82
+red r3
+L303: .string "vqmf"
+L304: not *r4
+cmp r0, L301
+L305: .data 166, 175, -490
+rts
+L306: .string "ociklikyfsshrbogz"
+not r3
+L307: .string "o"
+
+L308: .string "yjxamujalwvwqphghoi"
+add *r0, *r5
+L309: .string "obbdzomwlscttlljg"
+L310: .data 870, -313
+L311: .data 260, -934, 684, 551, -12, 329, -4, -182
+L312: .data 416, -671, 139, 487, 901, -855, 263
+lea L4, L316
+L313: .data -177, -610, -6, -869, 878, -129
+; comment
+L314: .string "bjfffvnweyslanwaqqaqgq"
+L315: .data -392, 272, 71, -241, -313, -813, 284, 649
+not L319
+cmp #-212, #-113
+stop
+L316: .data 525, 232, 858, -492
+add r7, r5
+L317: .data 198, -560, 879, 889, -183, 450, -15
+L318: .string "xcaxoxjbcybmj"
+L319: bne L320
+L320: add L107, r5
+stop
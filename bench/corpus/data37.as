@@ -0,0 +1,524 @@
+; Generated by genCorpus --seed 38
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: .data -707
+prn r1
+L1: .string "iwyq"
+L2: .data 512, -673, 199
+L3: .data 713, 314, -154, 523, -219, -423, 922, -399
+jsr *r2
+L4: .data 840, -292, -32, -745, -42
+L5: .string "hgdf"
+L6: .data -442, -625
+cmp r3, *r6
+L7: .string "auhzdzlidacjecpiana"
+L8: .string "nrqkvvxhlcgw"
+L9: .string "jhoaonqzfsmfaqydhzs"
+L10: .data 556
+L11: .data -990, -384, 665, -597, -283, 328, 158, 956
+L12: jsr *r2
+L13: .string "dcydjbxkp"
+jsr L4
+L14: .data 247, 865, 507, -927, -829
+L15: .data 631, 343, 481, 437, -145, -568, -453
+L16: .string "aucwogxprmiqdzkohyj"
+L17: .string "gotclqcibdvbmcr"
+jmp *r6
+L18: .data -620, -232, -903
+L19: .string "bfpgbijzapxp"
+L20: .string "kdyxyblixnxs"
+cmp *r4, r4
+L21: .data -461, -115, -852, -275, 891, -20, 57, 287
+L22: .string "rlpl"
+L23: .string "k"
+L24: .string "xugsjvsdvlizdszpmbcy"
+L25: bne *r0
+L26: .string "dseltnnszbunamthjwtqvn"
+L27: not L8
+L28: .data -192, 865, -187, -861, -90, -587
+L29: .string "ekpfpqkourmtpyo"
+L30: .data -500, -619
+clr r1
+prn L0
+L31: .string "gdxzb"
+sub #-102, *r7
+bne L51
+; comment
+L32: .string "tlfezpq"
+L33: .data -559, -782, 467, -269, -355
+L34: .data 454, 394, 884, -141
+L35: sub r0, *r5
+L36: .string "oliwscpsckskcqdpx"
+L37: .data 364, 622, -291
+jmp L195
+sub #-111, *r3
+; comment
+L38: .data 606, 20, -217, -830, 669, -250, 467, -437
+L39: .data -808, 998, -777, 413, 612
+dec *r3
+L40: .string "lxwauwco"
+L41: .data -298, 269
+sub L20, L32
+L42: .data -822, 541, -128
+L43: .data -351, 255, -150, -892, 565, 45
+L44: .data -848, -617, -264, -384, 716, -543, -348, 450
+red *r0
+L45: .string "tilsqhxdgeyvnxazo"
+L46: .data -453, 945, -906, -292
+L47: .data -841, -245, 674, -160, -33, -11, 387, -382
+L48: .string "pegg"
+L49: .string "tsftonjkrjddualtxzrbklu"
+inc L332
+clr r4
+prn r7
+L50: .string "ghdjfzrxkhasu"
+L51: .data 419, 728
+L52: .string "fovlgjfcfewjqvitk"
+rts
+mov *r2, *r5
+inc *r2
+L53: .data 760, 594, 611, 35, -598, -987, -680, -322
+lea L333, r4
+L54: .string "rerykxbsnbyb"
+mov L336, *r6
+L55: .data 748, -333, -643, -482, -449, 364, 632, -248
+mov #-196, L34
+L56: .data 705, 508, -60, 182, 753
+L57: .string "yeaojowzh"
+L58: rts
+L59: .string "pozozraqljrlldhgb"
+L60: .data -787, 256, 653, 991, 335, 724, 659
+inc L320
+mov r4, L42
+lea L272, L72
+jmp L24
+L61: .data -140
+cmp #35, *r2
+clr r3
+L62: .string "unrclpppom"
+L63: .string "gvqeoosvdyfmijioht"
+L64: .string "ftdulypructh"
+L65: .string "fdwxbgfiplftihbfh"
+L66: .data -135, 142, 174, -247
+L67: .data 504, -722
+L68: .string "v"
+clr *r2
+L69: .string "jaqaislpvbbfdbtiba"
+L70: .data 392, 640, -903, -725, -866, -826, -312, -573
+L71: prn L267
+L72: .data 696, 420, -39, 719, 724, 387
+add #-191, *r3
+L73: .data -520, -553, 602, 994, -597, 663
+rts
+L74: .string "lz"
+L75: .data 493, 777
+L76: .string "qsps"
+L77: lea L147, L116
+L78: .data 26, -287, -572, -823, 443, 576, 994, -331
+dec L49
+L79: .string "gagmnxtuszndxkdw"
+; comment
+L80: .data -3, -499, 988, 641, 16, 341, 176
+L81: .string "nza"
+mov #170, r4
+L82: .data -874, -715, -905, 610, -913, -153
+L83: .string "hymsmtoygtmihxexv"
+L84: .string "bbxemdl"
+rts
+cmp r6, L317
+L85: .string "jzvjdhokhghnvonglms"
+L86: .string "pzm"
+bne *r2
+L87: .string "jfpewbisskctqfmczdwygvnn"
+; comment
+L88: .data -47, 941, 165, -572, 777, 693, -320, -157
+L89: .data -17, 742, -771, -444, 66, 59, 712
+L90: .string "fejeuvqzebwlzjhuucox"
+L91: cmp r6, #183
+L92: .data 848, -858, -881, -900, -546, -452, -230
+L93: .string "oayagdnpbhpvswgenapn"
+L94: .data -521, 190, 610, 196, 715, 943, -856
+L95: mov L308, L259
+L96: .data -543, -685, 448, -107, 293, 919
+L97: .data -848, -421
+L98: .data 362, -119, 461, 655, -320, 501
+jmp *r6
+L99: .string "nszl"
+L100: .string "bxzcjgbocbbqeicptvqqwxcv"
+L101: .data -68, 450, -670, 111, -834
+jsr L49
+L102: .string "ofnpdl"
+L103: .string "xeauhoizwbhsddx"
+L104: .string "ozspdkcsclvuqutfpxldlmcd"
+jmp L161
+L105: .data 869, 133, -411, -733, -449, -41, 932, 119
+L106: .data -356, -691, 995
+L107: .string "krsnxouigsqxievixvn"
+L108: .string "ta"
+not *r0
+L109: .string "ftmdd"
+L110: jsr *r4
+L111: .data -30, 423, 507, 547
+L112: .data -17
+L113: .data -944, -835, 814, 890, -624, 588, -119
+L114: .string "bxcc"
+L115: .data 960, 259
+L116: .string "omhrdzjiwynywnwmu"
+L117: lea L223, *r6
+L118: .data 523, 248, -300
+not *r1
+L119: .string "kuscygpkductdbywzchmm"
+not *r1
+L120: .string "krp"
+L121: .data -288, -768, 33, 663, 931, -803, 822
+L122: .string "j"
+L123: .string "g"
+L124: .string "ptkhjslufegxxedyuffbp"
+L125: .string "dtqbztlbufc"
+L126: .data -127, 241, -833, -670, 872, -676
+L127: .string "ffbayewrajtknhelipluf"
+clr *r7
+stop
+; comment
+L128: .string "lec"
+bne *r2
+L129: .data 719, -292, -306, 726
+rts
+L130: .data -446, -550, -452, -581, -842, 491, 339, -773
+L131: .string "qwv"
+L132: .data 275, 262, 609, -63, -168
+rts
+L133: .string "resjqdop"
+L134: .data -382, -499, -730
+L135: .string "xydmuyemdmg"
+L136: .data 865, 134
+rts
+L137: not L79
+L138: .string "jbwwyqcwtdihvfusves"
+L139: .data -24, -606, -333, -254, 372, 718
+L140: .string "uoqrvzskbjpbro"
+L141: .string "tuhqtdhvatfyxs"
+L142: .data -271, 331, 169, -810, -489, 861, -205
+L143: .string "bht"
+L144: .data -128, 759, -216, 719, -896
+L145: .string "yxuznkodrwpix"
+L146: .string "ecpklftkwsooqz"
+L147: .string "yz"
+L148: not L234
+L149: .string "mecmpuoygzjzwvreafyp"
+L150: .data -976, 821, -225, 816, 714
+; comment
+L151: .data -633, 15, 772, -858, -880
+L152: not L23
+L153: .string "cnikivgfuqzipwclmizmszqv"
+L154: .string "gmabsddcqaiugui"
+L155: prn L110
+dec *r4
+L156: .string "eybkvb"
+not r2
+bne L25
+L157: .string "qege"
+L158: .data 33, 544, -75, 781
+clr L40
+L159: .string "vqwba"
+add #-116, L255
+L160: .data -224, -120, 437, -932, 429, -690, 65
+L161: .data 476, 401
+L162: .string "cjdakateavdrvae"
+L163: .string "vrumknhtzgreaufzqexibl"
+L164: .string "octjmuiq"
+L165: .string "ttbetponkrd"
+
+L166: .data 250, 911, -735, 280, 915, -41, 931
+L167: .string "oeuzotvd"
+L168: .string "jtkrlbhqhlwgraioemokoor"
+L169: .data 613, -321
+L170: jmp L54
+L171: .string "kpsjclfwqs"
+L172: .string "fjvjwmhithkw"
+L173: .string "hlhkgielh"
+L174: .data 613, 767, 409, -982, -39, 962, 922, -750
+L175: .data 464, -981, -412
+dec L3
+L176: .string "plmyjpfsaoso"
+L177: .string "bgxspixbnkqkyftnu"
+L178: .data 522, -36, -506, 702, 2
+L179: .data -693, -136
+rts
+L180: .data 503, 982, 752, -920, -526, 381, 445
+L181: dec L336
+L182: .data -379, 582, 533
+jmp L118
+bne *r4
+L183: .data -193, -694, 894, -734, -422, 424, 49
+L184: .data -671, 546, -370, 283, 636, 0, -533
+L185: .string "orobareemjufufgir"
+L186: .string "icdvjcofscpfglttspzz"
+L187: .string "gxdlgnphlnamiie"
+L188: .data 30, -733, 106
+L189: .data 909
+L190: .string "egemdioxegbcflersdt"
+L191: .string "concrpiyfqystbyxq"
+L192: .data 893, -715, -934, 884, -523, -314, 516
+; comment
+L193: .data 268, -475, -854, -818, -919, 636, -260
+L194: .data -929, 756
+lea L251, *r0
+red r3
+L195: .string "qcsvlnbfqtcnfnlsfrzg"
+bne *r5
+L196: rts
+L197: .string "y"
+L198: .data 907, -532, 251, 586, -159, -405, 898, -14
+L199: .string "eseefllwxslwpirbvcvgdv"
+L200: .string "ntvdrmmfwwpkjz"
+L201: .string "zvzbgeqbsmytxlzyrbpzkc"
+L202: .string "nh"
+L203: .data -601, 408, 777, -745
+L204: .string "kgyjgk"
+L205: .string "mkwgsayggcuefvkjmp"
+mov #189, L208
+stop
+L206: .data 16, 723, -785, -61, 748, 164
+L207: .data -35, 680, 810, 721, -140, -9, -858, 911
+L208: .data -181, 32, 568
+L209: .data 328, 254
+red L239
+jmp L130
+L210: inc *r4
+L211: .data -222, -281, -43, -108, 375, 61
+L212: .string "cx"
+stop
+clr r1
+add r1, L146
+cmp L194, L41
+L213: .string "bpdjhseeszozbocfbllo"
+L214: .string "kgeivttexxdgej"
+sub r4, r0
+L215: .data -56, 732, -573, 563
+lea L5, r0
+L216: .data -544, -715, -469, 688
+L217: .string "ccgxweajxqbwvpxexkfukwc"
+L218: .string "fzu"
+
+L219: .data 651, 730
+L220: .data 802, -189, -790, 362, 298, 643
+L221: .data -816, 538, -393, 640, -78, 428, 319, 984
+stop
+L222: .data 337, 612, -959, 40, 685
+L223: .data 776, 835, -673, -770
+L224: .string "nkwhqc"
+L225: .string "hxvpdsijdxay"
+clr *r7
+L226: .string "ndauxqlpljbutdsywhovx"
+red r2
+; comment
+; comment
+clr *r0
+; comment
+L227: .string "bj"
+not r3
+L228: .data -785, -488
+clr *r4
+L229: .string "cuoztzirnujetdsupajnuh"
+L230: .string "opckjkyltuvp"
+rts
+prn *r6
+not r4
+L231: .string "qkgxdbotfbykge"
+inc r7
+rts
+L232: .string "dqa"
+L233: .data -766, -992, 404
+not *r4
+L234: .string "eunvqckztmoyjjaswxk"
+prn #-46
+L235: .data 240, 105, -444, 512, 299, 711, 709
+L236: .data 854, -446, -730, 899, 342, 824
+L237: .data -551, 465, 467, 663, -992, -734, -514
+L238: .data 815, 248, -953, -787, 924, 984, -378
+dec r3
+L239: .string "ewvqmneokyuksy"
+lea L20, L128
+L240: .data -185, -212, 300, 208, -952, 842
+L241: .data -956, 764, 669, 975, 302, 330, -91
+cmp L252, L90
+stop
+L242: .string "wmqa"
+L243: .string "itooyasctpwkirdvr"
+mov *r3, *r7
+L244: .data -375, 912, -5, 928, 554, 303, 634, -838
+L245: .string "wbtqmlvggpzctyrwsau"
+L246: .string "l"
+bne *r6
+not r2
+; comment
+L247: .data -75
+sub *r6, r4
+L248: .string "ookyegjp"
+L249: cmp #-108, L30
+L250: not *r7
+L251: .string "lhcbseulcohmcmkayztaimvd"
+L252: .string "q"
+L253: .data -960, 843, -719, -689, 189
+L254: .data -650, 866
+L255: .data 131, -35, -251, 284, 165
+L256: .string "xszpwra"
+clr L186
+L257: .data -344, 810
+L258: .data -203, 918, 436, -18, 779, -150
+jsr *r2
+rts
+inc *r2
+L259: jsr L85
+L260: .string "yzm"
+L261: .string "dlsfvmtazprpuizskypfewu"
+L262: not *r0
+L263: .data -614, -267, 134, 554, 868, 716
+jmp L309
+L264: .data 516
+L265: .string "ahdzcindsgrxpm"
+L266: .string "vzejwiejhcwwihadidcvo"
+jsr L299
+L267: .data 102, -148, 133, 34, 888, -203, -127
+clr *r7
+inc L311
+sub L303, r3
+L268: .data 422, 916, 249, -115, 331, 975
+jsr L9
+dec r4
+jsr *r7
+not *r7
+L269: .string "uxn"
+L270: jmp L17
+jmp *r4
+L271: .data 166, -37, -421, -421, -406, -895, -709, 642
+L272: .data 569
+L273: .string "bxclpchfsspsbgs"
+L274: .string "kdxnbyhqehicwiuq"
+L275: .data -540, -674, -800, -558, 232, 622
+; comment
+L276: .data -412
+L277: .data -150, -72, -257, -449
+bne L112
+
+prn L281
+L278: .string "mdllwvrgpm"
+L279: .data 585, 316, -278, 744, 593, -732, 395
+L280: .string "vhtokbdfyj"
+lea L308, *r1
+stop
+red *r2
+L281: .data -76, 441, -296, -842
+L282: .data -789, 447, -870, 324, -479
+L283: .data -211, 873, -285, -537
+L284: .string "xjkhdk"
+L285: .string "qpikkldlwysnvtaatuh"
+L286: .data 110
+jsr *r3
+jsr *r1
+L287: .data 518, -137
+L288: .string "x"
+L289: .string "ulddfcnrqzklki"
+mov #-233, r6
+L290: .data 434
+dec *r3
+L291: add #85, L248
+L292: .data -479, 966, -872, 421, 323, -24, -595
+L293: .string "lfpfkqwdgddqqohjzqcqkdd"
+L294: .data 778, -692, 331, 19, -707
+L295: .string "djbngxmuulioyzyoh"
+L296: .data 794, -749, 235, -446, 217, 72
+
+add r0, *r1
+L297: .string "pahoxksqooo"
+L298: .string "rbt"
+L299: .data -614, -428, -968, -223, -671, -818, 319, -607
+L300: .data -104
+L301: .string "zdtaaqtjchzblvrgfxcfx"
+L302: .string "jqkxujcwwyarfmtcxies"
+cmp L339, L335
+L303: .data 746, -649
+L304: stop
+L305: .data -163, 82, 966, -213, 880, -717, -689
+L306: .data 454, -401, -872, -35
+; comment
+L307: .string "msbafwrmfrhyhthzetlmpl"
+L308: .string "xtzv"
+L309: .string "pzksf"
+inc L316
+L310: .data 519, -595, -141, -17, -393, -105, -965, 826
+mov *r6, r2
+L311: .string "ff"
+sub #198, r3
+lea L236, *r3
+L312: .data 873, -243, -347, 47
+L313: .string "nhe"
+bne L74
+cmp #-93, r7
+L314: rts
+rts
+L315: .data -398, -982, 871
+prn *r6
+lea L340, L325
+rts
+L316: .string "mkredszyywzbjywcxgc"
+not *r4
+L317: .data -668
+L318: .data 25, -102
+L319: .data -36, 586, -600, -173
+jmp L325
+L320: .string "xjzysnfxiecxygybcgw"
+L321: .string "cwmbwkovjkbdfigyjedcsp"
+L322: .string "twdhxdbwkvirabn"
+L323: .string "lnhawaezes"
+L324: .data 371
+stop
+cmp #172, L332
+L325: .data 587, -141, 570, 388, 9, 830
+inc r3
+L326: .data -153, 99, -577, -454
+dec *r6
+L327: .data 263
+L328: .string "nulgmz"
+L329: .data 210, -889
+jsr L335
+L330: .string "whbvcv"
+L331: .data 910, 251, -233, 132, -937, -613, -854, -41
+rts
+L332: .data -541, -657, 914, 873, -570, -473
+inc r0
+L333: .string "hwzkanjozo"
+L334: .string "pefctjtueftolqieat"
+red L341
+L335: .string "ktysj"
+dec L268
+L336: .data -883, -526, -188, 757, 841
+lea L342, L192
+L337: .data 450, -810
+L338: .string "glkpcoxdrfkghtss"
+L339: .string "xbvlrqomvxhwysypx"
+L340: .string "ykpxfzlg"
+L341: .string "vnmofzkm"
+L342: .data 643, 530, 907
+stop
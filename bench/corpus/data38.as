@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 39
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+not r3
+red r4
+L0: .data -149
+L1: .string "ywptlgsvajsd"
+L2: .string "lauaklghimzrvvekuaczcw"
+mov #249, *r2
+mov *r3, r6
+prn r4
+L3: .data 549, -71, 538, 402
+L4: .data -345, -183, 691, 362, -858, -172
+stop
+jsr L282
+prn *r7
+jsr *r3
+jmp L272
+L5: .string "kwtsupjcffxvbgfdzmot"
+L6: .string "ch"
+L7: .data -681, 492, 604, 289, -959, -593, -705
+L8: .data -202
+L9: .data -402, -922, -453, 425, 493
+L10: .string "yebqzxvdqwaalddyojqr"
+jmp *r3
+stop
+L11: .data -925
+L12: .data -759
+clr *r6
+clr *r3
+L13: .string "whromseioyhdscd"
+L14: .string "zm"
+L15: .string "ab"
+L16: .string "jngqygoemm"
+bne L15
+L17: .data 83, -968, 243, 213
+L18: .string "amagjfmoo"
+sub #-182, *r7
+inc L215
+L19: .string "yvdxdqzgfleviwsnjst"
+red r5
+L20: .data -710, 380, 370, 927, -649, 134, -326
+L21: .data -635, -323, -203, 911, -599
+L22: .string "qhiyeiucnoxnbygs"
+L23: .data 720, 407, -826, -151, -245, 25, -586
+mov #-221, L238
+L24: .string "cpmncgkedtsolqull"
+lea L25, r3
+L25: .string "ksteqwxnhrunkogjhccyekoe"
+L26: .data -688, 417, -724
+L27: .string "zp"
+L28: .data 3
+rts
+clr L10
+L29: .string "hk"
+L30: .string "wozddtehiubtoeberqzqqq"
+lea L116, r5
+L31: .data 327, -593, -948, 162, -373, 299
+sub r7, *r3
+bne *r6
+L32: .string "ysuuzrsbyiofyfdv"
+L33: .string "ekwgrvxhlqqjfouxn"
+L34: .data -642
+L35: inc r2
+
+L36: .data 372, -297
+mov L19, L8
+L37: .data -652, 248, -852
+clr L108
+dec r7
+L38: .string "okhurcafppsf"
+L39: .data -394, -632, -958, -797, 990, 450, 387, -808
+L40: .data -693, 895, -346, 307, 301, -41
+rts
+L41: .string "rhokexrceooraqdr"
+prn *r6
+L42: .data -564, -999, 379, -611
+cmp L228, *r5
+L43: .data -819, 913, 510, 975, 696, 469, -229
+L44: prn *r4
+L45: .string "vvujodmhg"
+L46: .string "xrsfmlcsqzdegwqgtn"
+L47: .string "qwweiagahqh"
+L48: clr *r4
+L49: .string "mdsgisjgphe"
+cmp #57, #-78
+L50: .string "gdkibkg"
+L51: .string "bnvvibgvaols"
+L52: .string "yj"
+L53: .string "iymiaivadz"
+L54: .data 327, -485
+inc *r5
+L55: .data -385, 819, 581, 37
+L56: .data 185, -228, 252
+L57: .data -669, -304, -956
+L58: .data 83
+dec *r1
+L59: red r3
+L60: .string "g"
+L61: .data -918, 542, 952, 359, 196, -67, -192
+mov *r7, r5
+L62: .data -617, 421, 404, 708, 84
+rts
+L63: .data -24, -1000, -505, -267
+bne L316
+L64: .string "vdddfi"
+L65: .string "iuwufpxfrujgzuvdfrad"
+cmp L10, *r3
+jsr *r5
+bne L39
+L66: .data -284
+jmp L190
+L67: .string "cccztxeszfsto"
+L68: .data -773, 536, -864, 642
+L69: .string "vigjjtgihwexhisnhhezn"
+rts
+jmp *r7
+add r4, L29
+L70: .data 33, 376
+L71: .string "gapomrdnmadiqg"
+L72: .data -205, -106, -469, 575, 880, -392, -337
+L73: .data -540, 679, -560, -594, -912, -777, -54
+bne L34
+mov r6, L15
+L74: .string "hrbnqgyzqdueuqpfujvhp"
+L75: jsr *r3
+red r3
+L76: lea L74, L35
+inc L23
+L77: .string "kejdmhqvmqzyxeuhhvo"
+L78: .string "yohcyutsmi"
+stop
+L79: .data -138, 451, 777, -178, -363
+cmp L65, L141
+L80: .string "iwxdkgrnptdd"
+L81: .data 17, -405, 875, -712, 679
+L82: .string "lcnqktcxaftu"
+L83: .string "ovcofrx"
+L84: .string "twriycltneocehzaonuud"
+L85: .string "mabobx"
+; comment
+L86: .data 131, -743
+clr *r7
+not *r6
+L87: .string "bdnpuykapadhmcvmxdha"
+clr L253
+L88: .data 936, 958, -736, 964, 740, -825, -466, -917
+; comment
+L89: .data 927, -829, -715, 880
+L90: .string "ducc"
+L91: .data 643, 205, -489, -984, 626, -934, -848
+L92: inc r5
+L93: .data 925, -416, -981
+L94: .string "kavbxswjsvjjcwpweehurqw"
+L95: .string "gufexzdwmvtiehbh"
+L96: .string "rfawnaywajoqtgcxt"
+L97: .data 604
+jsr *r5
+L98: red *r3
+L99: .data 366, 643, 207, 599
+L100: .data -570
+L101: .string "etzyeswukxadelarto"
+L102: .data -938, -136, -166, 272, 968, 9
+L103: .data -643, -498, 440, 47, 812, 139
+L104: .string "mogsm"
+bne L180
+; comment
+L105: .string "sedqhllsnda"
+L106: .string "mw"
+L107: .data -813, 500, 868
+sub *r3, L83
+L108: .data 998, -113, -730, 458, -166
+L109: .data 212, -454, -202, 264, 999
+cmp *r0, L69
+L110: .data -948, 31, -749, 289
+L111: .data -946, 53, -712, -999, 231, -802, 9
+L112: .string "jajaxpvqxgfktx"
+L113: .data 726, 299, 833
+L114: .data -301, 671
+jsr L61
+jsr *r7
+dec L1
+jmp *r3
+jmp *r2
+
+L115: .data 814, -576, -785, 82, 16, -25
+red r2
+jsr L53
+L116: .data -185, 778, -185, -2, 469, -845, -46
+sub r1, L55
+L117: .data -69, 19, -348, 163, -118, -313, 879
+L118: .data -908, 950, -547, 869, -957, -832, -887, 187
+L119: .string "hcmjspcmyhmqjiahaazsi"
+clr r5
+inc L171
+L120: .string "zolwrelwcnrpjc"
+inc L257
+bne L88
+L121: .string "vjaypcuxvyxnqrtaqrkjsba"
+L122: .data 8, 527, -693, -571, -906, 70, -689, -29
+L123: .data -852, 89, 250
+inc L21
+
+rts
+L124: .data 254, 741
+L125: .data -133, -381, 851, -109
+
+L126: .string "kgplhoitixcersykp"
+jmp *r7
+L127: .data -425, -247, 895, 436, -606, -739, -194
+inc L102
+L128: .string "wuqihpqdmbs"
+L129: .string "jsjarogrhr"
+L130: .string "uw"
+L131: .string "ap"
+add L214, r7
+L132: .string "reagqagmjlyucfezmiy"
+L133: .data -293, -335, 453, -567, 111, -88, -56, 123
+L134: bne L80
+L135: .string "qjyesvnkzglijikti"
+
+L136: .data -452, -527, -280, -565, 7, 934, -37
+dec *r6
+L137: .data 184, -780, -348, -329, -54, -398
+L138: .data -228, 668, -797, 783
+L139: .string "lycusicn"
+L140: .data -818, -310, 807, 607, -846
+L141: .data 433
+red L316
+jsr *r4
+L142: .string "ariwhgyyxgnosw"
+
+L143: .data 584, 557, -568, -571, 611, -120, -617, 58
+L144: clr L96
+mov #-45, *r2
+L145: .data 16, 112, 624
+L146: .data 533
+L147: .data 904, -147, 176
+L148: .string "xblshvlawpe"
+jmp *r5
+stop
+cmp r0, #-10
+lea L213, L280
+mov #228, *r4
+inc *r6
+L149: .string "a"
+red r6
+L150: .data 442, -725, 159, -387, -533, -296, 50
+L151: .string "rk"
+inc L45
+L152: .string "bzzart"
+L153: clr L166
+L154: .data 666, 301, -3, -450
+L155: mov r1, *r4
+prn L170
+L156: .string "rua"
+add r1, r5
+L157: .data -761, -229, -132, -406, -466
+L158: .data -994, -792
+L159: .data -634, -753, -926, 128, 522, -873, 778, 20
+L160: prn r3
+L161: cmp #-150, #-20
+L162: .string "apgde"
+add r3, L234
+L163: sub *r1, r0
+L164: .data -561, 9, -311, 716
+L165: .string "tuwxoriroqk"
+L166: lea L12, r3
+L167: not *r5
+L168: .string "ksnkxgvvjguvzcysrutk"
+
+L169: .string "lugwzqexsejzxvcihrmdg"
+stop
+mov #217, r2
+lea L149, r4
+L170: .string "akrtqmrakg"
+L171: mov L7, *r2
+L172: .string "ejlha"
+L173: .data 488, -864, 781, -593, 700, 480, 118, -156
+L174: .data 576
+L175: .data 417, -221, -809, -280
+prn r6
+L176: .data -396, 931, 638
+L177: .data 505, 288, 810, -257, -634, 838, -225
+L178: .string "ozurdjbw"
+L179: .string "ilcuqkltvgdhadzznemn"
+L180: red *r2
+L181: .string "aohvnilsuxui"
+add L282, r2
+sub #124, L303
+L182: .string "vrwwquzxweeovzlzhaytm"
+L183: .data -742, -504, 80, -863, 817
+L184: .string "ykagt"
+L185: .data -327, -78, 499, -312, 928, 282, 446, -502
+L186: .data -718, 806, 468, -192
+L187: .data 206, 222, 267
+L188: .data 697, 950, -335
+L189: .data 79, 109, -425, -444
+jmp *r4
+bne L181
+lea L307, r6
+L190: .data 306, -384, -57, 631, -123, 655, 715
+L191: .data -454, 776, 549, -641, 424, -632, 777, -828
+stop
+L192: .string "rjjcgkfhxljojy"
+L193: .string "bovbrdtmgczhsa"
+L194: cmp #198, #133
+not *r2
+L195: .string "gydxajsnviy"
+L196: .string "syhjscqeufmqniizzinrq"
+L197: .string "uvyphfddnao"
+L198: .data -815, -167, -623, 449, 134, 607
+L199: .data -87, -844, 867, 249
+L200: .data -788, -351, -134, 211, 815, 124, 377, 808
+L201: .data -188, -399, 298, 230, 653, -120
+jmp *r3
+L202: jsr *r3
+L203: .string "lfapdcoic"
+dec L122
+L204: .data 330, 288, -529, 524, -639, 425, 356
+sub *r4, L10
+L205: .data 575, 491, -950
+L206: .string "ix"
+L207: .string "mzxjsbcecwvrd"
+cmp L290, r6
+L208: .string "etqx"
+rts
+L209: .data 533
+L210: .data -413, 865, 483, -9
+lea L270, L228
+clr *r2
+L211: .data 151, -349, 613, -667, -887, 280
+L212: .string "vdufoausikffowwjbu"
+; comment
+L213: .data 805, 105, 352
+L214: .data 45, 855, -985, 482, 114
+L215: .string "aalnhyiwwyeaiv"
+L216: .string "thvreo"
+; comment
+prn L56
+L217: .string "krvhauikrenihyord"
+L218: .string "lbpckpk"
+L219: .string "yerrvjb"
+L220: .data 691
+L221: .string "sbovsypbwc"
+not *r2
+L222: cmp r5, L314
+dec r4
+stop
+red r1
+L223: .data 3, 432, -613, -931
+rts
+L224: .string "kfmbgejuhekfpcxlyl"
+L225: jsr L179
+L226: .string "imsppozhedixuisuruelbqkl"
+jsr L113
+
+jmp *r6
+L227: not *r7
+L228: .string "nvgdcecza"
+sub L232, L242
+L229: .data 524, -406, -20, 659, -991, 376, 771
+L230: .string "u"
+L231: .string "yhxduqqfvxeqajml"
+L232: .string "kuqdchrlqogtomv"
+L233: .string "vtdzeozglgmwlzxbwm"
+cmp #-215, L303
+L234: .string "i"
+L235: .data -677
+L236: .data -329, 308, 42
+L237: .string "nox"
+L238: .data 916, -910, 85, 919
+L239: .string "flemlbimy"
+mov L249, L8
+rts
+add #-123, *r2
+L240: .data -277
+L241: .string "fustzotpovokcqwyfs"
+sub r3, *r0
+rts
+L242: .string "bttrvzrusje"
+red L289
+L243: .data -551, -164
+bne L260
+L244: .data -20
+stop
+L245: .data 527, 63, 85, -488, -295, -924, -952
+L246: .string "mldcvssvfouug"
+L247: .data -965, -662, -815
+L248: .data -704, -296, -423, 786, -490, -790, 384
+not r5
+L249: .data -265, 183
+L250: .data -889, 895, 125, 907, 157, -88, 907, -671
+L251: .string "mcsxghqedefrmfemiiszvnxc"
+L252: .string "tizdlshfunkdccx"
+sub #-91, L48
+stop
+L253: .string "tfn"
+L254: .data 806, 832, -205
+prn L192
+L255: .string "xzwxhjzvlcdx"
+bne L166
+cmp #179, *r6
+L256: .string "efhlshmsoiyoaw"
+L257: .data -45
+L258: .data 859, 792, 940, -602, -172
+sub *r4, *r2
+L259: .data -509
+L260: .data -241, 494, -976, 450, -653, 428
+dec r5
+mov r0, r6
+L261: .data -89, 628, -721, 332
+L262: .string "vjwkkin"
+L263: .data -312, 775, -997, 42, -200, -137
+L264: .data 369, 13, 526, 421, 230, 992, 889, 247
+L265: .string "cuguekkgrsktsxwfkugc"
+not r7
+L266: .data 845, 894, 332, 14, 287, 136, 513
+L267: .string "jtrponocpxndfgpyxpl"
+add r4, *r5
+L268: .data 695, -69, -401, -388, -287, -211, -232
+mov *r4, *r3
+
+L269: .data -843, -456, 825, -88, -135, -651, 199
+L270: .string "dwexxbopmiz"
+rts
+L271: .data -784, -488, 939
+L272: .string "ixtjhbvcejcdkgmkpfa"
+
+; comment
+L273: .string "krmbuzyxxylniogtdhlcjzw"
+L274: .string "dvmzromtuppo"
+jmp *r7
+L275: .data 754, -218
+; comment
+L276: .data -49, 295, 92, -329
+L277: .data -988
+sub *r6, *r1
+L278: .data -754, 661, 869, -429, 532, -297, -329, -63
+L279: .data 353, 924
+bne L302
+L280: .string "iczqptbjklqfvjrzkef"
+dec r3
+L281: .data 25, 808, -144, 656, -898, 670, -196
+bne L285
+L282: .string "rphwitlkbqodwka"
+L283: .string "xkfeskhpxwueaxodv"
+prn r0
+L284: .string "guys"
+L285: .data 774, -462, -804, 38, 217, -325
+L286: .string "brfurgeawkanutvjcnxwe"
+L287: .string "kjyjvfgzukyqmxejeddgv"
+L288: .string "kjmkxgwtzlo"
+jsr L290
+inc r2
+jmp L135
+L289: prn *r7
+L290: .string "ifevwxaacnyrprtbfoue"
+L291: .string "q"
+mov #46, r1
+dec L42
+L292: .string "rilhheewszbqmlb"
+L293: .data -312, 466, 864, -73, -31, 198, 385
+L294: .string "chqnvrauqdyeyyhqsrpyor"
+L295: .string "iewfjzthfnxyctvd"
+prn r7
+add *r1, L187
+L296: .data 842, -582, -539, 254
+clr *r3
+red r7
+L297: .string "uuivkljaeuxeben"
+L298: .string "pomrjjvvmotndmhhtqmboj"
+lea L304, L236
+L299: .string "lckfftlkwisljcmdc"
+L300: .data 163, 959, -523
+inc r2
+red L302
+L301: .data -572, 489, -893, 417, 773, 506
+L302: jsr L315
+clr L305
+L303: .string "zruqhufzau"
+prn #13
+add r1, L314
+L304: .data -472
+L305: .data -35, 328, -195, -408
+L306: .string "gwmeggqlezzxayoyd"
+lea L310, L314
+L307: .string "dlgiq"
+sub r0, r6
+L308: .data -736, -135, -756, -140, 797
+L309: .data -757, -540, -891
+red r7
+mov r5, *r2
+L310: .data -653, 453, -403, -962, 867, 505
+L311: .string "pyudwfdqvgfuxrx"
+clr *r6
+L312: .string "tzwgcecmfvtqq"
+cmp *r6, L93
+L313: lea L314, r3
+lea L314, *r0
+L314: .data -765, -278, -191, 805, -271, 630, -906
+L315: .string "ynpnppjuwiqoqqf"
+L316: .data -613, -713, 611, 205, -259, 100
+stop
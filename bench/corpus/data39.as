@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 40
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .string "ri"
+L1: .data -708, 227
+L2: .data -478, -722, -991, 21, -995, 238, -925, -608
+L3: .string "yqut"
+sub *r3, r4
+L4: .data -401, -744, -190, 440, -860, -370
+L5: .string "piwkylkqnftewlian"
+L6: .data -287, -483, 177, 555, -692, -294, 845, 332
+rts
+L7: .string "ipedinxvpld"
+dec *r5
+L8: .data -452, 506, -190, 557, 785, -594
+L9: .data -482, -397
+L10: .string "umbfzo"
+prn r1
+L11: .data 656, -436
+L12: .string "txkttqbib"
+L13: .data -897, 375, -221, 957, 317, -988, -349
+L14: .string "ewaeqgaad"
+L15: .data -21, -999, 547, 831, 673, -545
+L16: .data 362, 664
+
+jmp L118
+L17: .string "avchmwxomtwjfzurhbsqkqon"
+L18: .string "vonycakxwqmtnufewlpbhn"
+lea L9, *r6
+L19: .data 436
+L20: .data -745, 709, 854, -816, -33, -220, 692, -91
+prn r4
+sub #122, L250
+L21: .data -150, 31
+L22: .data 335, -694, -749, -112, 293, 711, 758
+L23: .data -622, -485, -943
+L24: stop
+L25: .string "yeafpnfbcdl"
+prn r7
+L26: .string "vvnwghjuymdatexlct"
+L27: .data -296, -299
+L28: .data -726, 178, -495, 523, 175, 896
+; comment
+cmp L279, r5
+L29: .data -473, -967, -35, -945, -573, 632, -990, -956
+L30: .data 286, 810, 172, -784, 821, -491, 127
+jsr *r5
+jmp L138
+lea L26, *r1
+L31: .data -645, -638, 435, 661, -479, 806, 758
+not *r2
+L32: .string "rwf"
+L33: .data -611, -759
+L34: .string "qafghnyvdbxz"
+L35: .string "ydtfkj"
+L36: .data -339, 241, -769, -690, -601, -43, -419, 135
+red *r5
+L37: .data 634, -260, 365, 316, -69, 214, 469, 793
+L38: .data 502, 867, -282
+L39: .string "qseytuafumtkqnknqtfsht"
+L40: inc r1
+L41: .data -874
+L42: .data -243, 671, 307, -671, -546, 384, 553, -497
+L43: .data 930, 830, 190, 187, -25, 185, 170
+add #-85, L9
+L44: .data 59, 26, -958, 970, -800
+L45: .data -909, -987, -396, -631, 519, 685, 606
+L46: .data 915
+L47: .data -239, 366, 299, -954
+L48: .data -525, 609, -253, -151, -72, 121
+L49: .string "ytefzluvnepbswgwgl"
+L50: .data -251, -530, -432, -884, -883
+prn *r0
+L51: .data -15, 759, 452
+not L313
+L52: .string "qgmupwuuhtvibrujf"
+stop
+L53: .string "jqishsvxzfihqsqfi"
+L54: .data -300, 240, -565, 407, 212
+L55: .string "zicpeimupvqqt"
+stop
+L56: .string "oahifypn"
+L57: .string "oag"
+L58: .string "nmoadkesipwxavgewo"
+L59: .data -555, 980, -198, -332, 431, -461, 602
+L60: .data 672, 202, -476, -986, -604, 374, 470
+red r6
+L61: .string "shdwmlgshgqtlfgdwmg"
+L62: .string "kpaifxbznjmyahnrysqp"
+L63: .string "nrwvqskhjcesryhutryl"
+prn r1
+jmp L202
+dec L13
+
+L64: .string "rqsdmmdcmfhmhinssrklz"
+mov r7, r5
+L65: .string "ezmilerdtqdkgzszxwp"
+L66: .data -715, 368, 59, 646, -628, 934, 627, -116
+inc L59
+L67: .data 436
+L68: .string "cdauyhyhya"
+cmp r4, r6
+L69: .data -688
+L70: .data -520, -841, 747, -936, -369, -75
+sub L220, *r5
+L71: .string "swe"
+inc *r1
+L72: .string "gecwnmypjrnwidpq"
+sub L71, L269
+rts
+
+L73: .string "hhahueysnyl"
+L74: .string "dkzjbabhsvb"
+jmp *r4
+L75: .data 794, -873, -860, 841
+cmp L29, #142
+L76: .string "kiasfazfpmiwtp"
+L77: .data -909, 4, 568, -202
+sub L229, *r1
+L78: .data 340, -361, 899, -982, -911, -965, -56, -31
+rts
+bne L151
+L79: .data 10, 990, 971, 140, 317, -799
+jmp *r7
+L80: bne *r7
+L81: .string "igfdgkdndzsqqzdchcsulxd"
+L82: .data 138, -500, 888, -563, -713, -791, 757, 979
+inc *r1
+L83: .string "fbyuswiiuftysrzcobnp"
+L84: jsr L70
+L85: mov r5, L48
+L86: .string "varipd"
+not *r3
+L87: .string "oxqvcxyxasobzlzro"
+L88: .data -824, -504, -465, 726, -419
+stop
+dec L71
+L89: .data -16, -180, 244, 414
+L90: .data -442, 641, 169
+
+L91: .data 748, 214, 768, 612, 407, -591
+L92: .string "qtxipztda"
+L93: .data 970
+L94: .string "klspvci"
+; comment
+bne *r6
+
+L95: mov *r7, *r0
+L96: .data 996, 167, 292, -958, -97
+L97: .data -488, -772, 809, -416, -63, -233, -174, -430
+L98: .data 486, 416, 828
+L99: .string "xvdunt"
+add L174, r4
+L100: .string "pzknlnad"
+; comment
+not r3
+rts
+L101: .string "lnofonnhjpxdfbr"
+L102: prn L3
+L103: .data 200, -112
+L104: .data 77, 426
+bne L125
+L105: .string "opdpijhitmph"
+L106: clr *r1
+L107: .string "jdkjuhtbcfe"
+bne L34
+
+L108: .string "ggmfwigxpiea"
+L109: .data 995, 233, 52, -250
+clr *r2
+; comment
+L110: .string "g"
+jmp *r4
+jsr L269
+cmp *r2, #62
+red *r3
+dec r6
+L111: .data 956, 197
+rts
+L112: mov L49, r0
+not r3
+inc L0
+dec L92
+L113: .data -179, -710, -153, -355, 989, 90, -760
+dec r0
+clr *r0
+bne L12
+L114: mov L147, *r6
+L115: .data -596, 366, -180, -962
+L116: .string "mtdwmabzutkcpvr"
+L117: .string "ubutyxhva"
+sub #152, L108
+L118: .data 356, -481, 49
+L119: .data 593, -347, 655, 196, -35, 60
+L120: .string "xlvccsayafkb"
+L121: .string "qvgxdemwqdqg"
+L122: .string "cjlexxurpf"
+jmp *r1
+L123: .data -916, -112
+L124: .string "pzclyzmftqltqqdjbuwp"
+cmp r7, #218
+L125: inc *r0
+L126: .data -853, 677, -496, -699, 71, 938
+jmp *r6
+L127: .string "rvwf"
+prn *r5
+L128: .data 986, 970, -423
+L129: clr *r6
+L130: .data -986, 107, -327, -64, 942, 673
+L131: .data -829, 544, -388, -869, 240, -668
+not *r4
+L132: .data 619, -313, -360, 178, 451, 875
+clr r2
+jsr L89
+red *r6
+not *r2
+cmp r5, #-161
+
+L133: .data 159, 569, 46, -423, 627, 922, -965, -868
+dec L130
+mov L37, L23
+L134: .data 848, -496, -89, 457, 533, -989
+
+L135: .data 547, -375, -909, -217, -294, 708, -463
+L136: .data 952, -886, 351, -219, -749
+L137: .string "vepnacfbuo"
+L138: .data -573, -943
+L139: red *r6
+dec L119
+clr *r5
+dec *r1
+L140: .string "d"
+L141: add r3, L136
+rts
+L142: .string "hvdbzzxndqwycm"
+L143: .data 639, 579, 160, 595
+L144: .string "gsqqnokqqcrkwfo"
+inc r1
+
+L145: .string "ywkitdlwvvsskphwweejl"
+sub L255, L309
+
+add r6, L95
+prn *r1
+L146: .string "xzbelbxxfwbbylau"
+; comment
+L147: .data -783, 649
+L148: .string "fjlfvctrwpdtgkgnjch"
+mov L92, *r2
+L149: .data -79, -706, 339, -801, -147, 797, 139, 660
+L150: .data -383, -899, -851
+cmp L23, r2
+stop
+lea L194, L257
+
+bne *r7
+L151: .string "ftuxwikirz"
+L152: .string "ucyhzugt"
+add L25, L180
+jmp *r3
+L153: .string "dnqossqqohbcnbykqitddbg"
+jmp L145
+L154: .data 413, 247, -930, 28, -266, 730, -966, 195
+cmp #1, L59
+L155: .data 782, 482, 594, 458, 700
+L156: .string "beqntnzsizmc"
+L157: .string "uslflsbryvenvvgmopzqbeyt"
+rts
+L158: .string "jgupbbjdfgyuuyuhzqdt"
+L159: .data -935, 857
+L160: .data -562, -507, -728, 585, -728, -25, 901
+L161: .string "iqlyljhxawiylxvzrnurvtfo"
+clr r1
+not *r7
+L162: .data -407, 707, 939, 2, -448, 855, 3
+L163: .string "ycrkuebpmmpskpgtmflf"
+L164: .data 698, 684, 422
+L165: .data -615, -860, -271, 29, 110
+L166: .data 534
+jsr L169
+L167: .data -691, 787
+L168: rts
+dec r3
+L169: .string "yyjyruwwygseltdawfdxy"
+L170: jmp L89
+L171: .string "gszcdbtnsoygdgtpuech"
+L172: lea L314, L103
+mov r7, *r4
+L173: .data 963, 865, -899, 66, -434, -980, 457, -947
+L174: .data 333, 504, 149, 373, 19, -684, 380, -253
+L175: .string "qpmvxinpbpabwqkvpvxxye"
+L176: .data 547, 237, 204, 577
+L177: .data -414, -476, 456
+; comment
+L178: inc L259
+L179: prn #96
+L180: .string "dvlwydzuxcyags"
+L181: .string "bkv"
+L182: .string "isvbgaqhfyrrjuhjbdt"
+L183: .string "pw"
+L184: jmp L70
+L185: bne *r7
+rts
+L186: add #15, r5
+L187: .data 454, 209, 459, -763
+L188: .data 315, -424, -947, -384, -386
+jsr L86
+red r1
+L189: .string "hwhjtgwdnrzkisuliqi"
+L190: .data -506
+L191: .data 882, -461, -702, -841, 462, 565, -360
+L192: sub r5, L122
+L193: .string "hc"
+L194: mov L6, *r4
+red L206
+L195: .data -425, -889, 542
+L196: .string "pdtpdlqigo"
+L197: .data 142, 497, -779, -212
+red r6
+L198: .data -138, 679
+L199: .data -646, -553, -945, 525, -631, 652, 14
+L200: .string "yzkoimc"
+cmp #-59, *r4
+L201: .string "vfzcfrsrsy"
+L202: .string "eswlolgh"
+L203: .string "gyzglbyrmlkd"
+L204: .string "dugvovkgmawwvsnmnlqsumu"
+L205: .data 569, 144, 982, 622
+L206: .string "arxrrvvejulciceo"
+L207: .data -581, -233, -844
+stop
+L208: .data 728, 545, 9
+L209: .string "uqiwvewpt"
+L210: .data -844, -666, 366, 864
+L211: .data -633, -609, 392, -681, 295, 668, -953, -617
+not *r1
+L212: bne L197
+not r0
+L213: .string "gowfqihonxjxc"
+L214: clr *r5
+L215: .string "dwrmtbdiapmnywrx"
+L216: not L154
+add #-131, L294
+clr r2
+L217: red L43
+L218: .data -573, -358, 979
+L219: .string "pisidyagnykpf"
+L220: .data 260, 1, -666, -547, -117, -702, -972
+; comment
+L221: .data -528
+L222: jmp *r1
+sub *r7, *r4
+L223: jmp *r1
+L224: .data 830, -26, 825, 982
+lea L94, r2
+L225: .data -161, -30, 73, -467, -947, -901, 785
+L226: .data -166, 272
+sub r3, r6
+L227: .data -451, 626, 75, 307, -610, 702
+; comment
+lea L265, L174
+prn r0
+red *r6
+L228: .data 41, -863, 614, -33, -175, -501, -581
+
+L229: .data -366, -607
+prn #72
+L230: .data 77
+L231: .data 386, 149
+L232: sub #-97, L281
+bne L199
+add r0, r5
+dec r1
+bne *r0
+L233: .data 247, 849, 804, 361, 653, 120
+L234: .string "yzdpluplrwxqzchgpqmuazth"
+
+prn *r3
+L235: .string "kujwurldpudgnhdgmtji"
+L236: .data 747, -69, -275, 913
+not L257
+L237: .string "zjkvccocmdoqmvwdnpryqp"
+L238: .data -596, 415, 775, 967, 610, -909, 891, -899
+L239: .string "zjokmtzewkz"
+L240: .string "mhegso"
+L241: .data 418
+L242: .string "nsfboelapv"
+L243: .data -108, -966, 80, 466, 411
+stop
+add L107, r0
+sub L184, L305
+L244: .data 231
+L245: .data -702, -797
+L246: .string "urekhamm"
+L247: .string "pcouvrpardopthqsslu"
+L248: .data -585, 933
+L249: .string "irkwelsled"
+L250: .string "zytigluliwa"
+L251: .string "luatqmtewhqodjjvhzcmo"
+L252: .string "cmtwgvji"
+L253: .data -896, -444, -910, 896, 501, 97
+L254: .data 976, 722, 187, -934, 924, -866, 116
+L255: mov #207, *r5
+L256: .string "vmagajebv"
+L257: .data -307, 649, 930, 992, -213, 659, -760
+L258: .string "dtmototkiftvrigk"
+L259: .data -630
+L260: cmp r1, #251
+L261: .string "spgaqga"
+bne L190
+L262: .string "saytqbsagyjwxfawhuattb"
+cmp r2, #-179
+L263: .string "f"
+L264: .data -433, 386, -558, 224, -438, 12, 323
+L265: .string "mllwjcwvkzpvxymsueforyj"
+prn L11
+L266: .string "kfgpcowoymxhde"
+; comment
+bne *r1
+L267: .string "qjadnyoqwwwengqzqxah"
+L268: .string "sbkqwofhiohvhuevbq"
+L269: add *r3, *r5
+red L213
+L270: .data 202
+L271: inc r2
+L272: .string "mfgwm"
+
+L273: .string "llhhndqqqownkh"
+clr *r6
+add r4, r1
+bne L283
+L274: .data -483
+L275: .string "s"
+inc *r4
+L276: .string "lta"
+L277: .data -714, 870, 75, 311, 801
+jsr *r0
+L278: .data -85, 706, 338, 989
+L279: stop
+L280: jmp L307
+not r4
+L281: .data -214, -296, -199
+sub #221, r1
+add L313, r0
+L282: .string "dv"
+L283: .string "ddwrestw"
+L284: .string "u"
+prn r3
+clr r2
+L285: .data -68, -686, 580
+L286: .string "rsxggyv"
+L287: .string "jjujkvmtwxbvsyuqzcnifal"
+sub *r0, r0
+L288: mov L142, *r5
+L289: .data -334, 263, -56, 389, -613
+dec *r3
+L290: .data 13, -517
+jsr *r6
+L291: .string "dabioepbnfzdfigrlfobs"
+L292: .data 160, -294, -431, 419, -638, -873
+L293: add L319, L84
+L294: .data -843, -416, 610, 947, 942, -142
+L295: .data -884, -163, 704, -865, -508, 820
+L296: .data -908, 824
+jmp L218
+L297: .string "hmg"
+inc L211
+L298: .data 860, -478
+inc *r2
+L299: cmp L62, L62
+L300: .string "dexbwqiqlgd"
+bne L225
+L301: .string "fq"
+bne L192
+L302: .data 366, 188, -452, -85
+L303: .string "mu"
+sub r2, L40
+L304: .string "hrntugytfvgalhargnumv"
+L305: .string "eqitsysfgvttgubcgy"
+L306: .data 821, 397, -586, 622
+clr L318
+L307: .data 916, 534, 5, 587, 732
+jmp *r5
+L308: .string "tdek"
+stop
+L309: .string "ktnawndixcdlflcuahhqr"
+cmp r3, #35
+L310: .string "awzmtsm"
+L311: .data 939, -551
+L312: .data 156, 313, 423
+L313: .data -796
+jmp L257
+L314: .data 985, -102, 652, -213, -670, 519, -255
+rts
+L315: .string "lwsvemr"
+L316: .string "xwukyo"
+clr r1
+L317: .string "pygq"
+clr r1
+L318: not *r3
+L319: .data -305, 794
+red L12
+L320: .data -14, 196
+stop
@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 5
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+L0: .string "io"
+L1: .string "tfyxsbtkzxnzdhgxjvae"
+L2: .string "wkflkmrdzsnukpguhdtyjps"
+
+add #24, r1
+L3: .string "on"
+L4: .string "xyhpzws"
+L5: jsr L240
+red *r4
+stop
+rts
+L6: .string "w"
+lea L1, r0
+bne *r3
+L7: .data 567, 337, -390, 670, 490, 843, 543, 578
+L8: .data -226, -169, -619, 976, 791, -856, -528, 189
+L9: .string "rwy"
+cmp #-72, #170
+L10: .string "niqcz"
+L11: .data 593, -418, -271, -415
+L12: .data -771, 24, -801, 870, -764, 57, -320
+L13: .string "ibwaw"
+L14: .data 887, 882, 997, 931, -54
+L15: .data 791, 90, -764, 945, 913, -856
+L16: .string "rjkcyc"
+L17: .string "xnfwylkcluyqxcq"
+L18: .string "yu"
+add #-151, r3
+L19: .string "amilxflaf"
+L20: .string "bzbzrxgqqjgilgov"
+lea L281, *r0
+add L3, L4
+L21: .data 523, 252, -628
+red L82
+L22: .data 905
+lea L96, L295
+L23: .data -684, -989, 9, -409, 247
+L24: .data 74, -845
+; comment
+prn r5
+L25: .string "bucgjbqmpiwoulszskag"
+L26: .data 163, 685, -537, 146, -303, -985
+L27: .string "hfuktpyix"
+L28: .data -738, 270, 382, 669, 502, 631
+not L83
+red r0
+L29: .data 300, 253, -153
+L30: .string "bejntfphxmvxtgkmtowflabc"
+L31: .string "roqanaiujpnhjptdjoxgpvn"
+L32: .data 67, 927, -86, -203, -474, -617, -848
+red L1
+sub #-172, L159
+stop
+L33: inc r4
+L34: .data 304, 77, 539, 893, -313, 595, 372
+L35: .data -836, 293, 875, 101, 625, 659, -89
+L36: .string "ffvbbbqgprsifajfjs"
+L37: .data -713, -146, 190, 472, 217
+add #-132, L138
+L38: .string "yilymmoqan"
+red L17
+L39: .data -336, 631
+L40: .data 285, -646, -178, 731, 871, -387, -16
+L41: .data 427, -76, 840, -759, -681
+L42: .data 268, 918, -961, 386, 245, 419, -206, 854
+jsr *r2
+L43: .string "sdbpqwrctxdlajzjfhk"
+L44: .data 624, -313, 780, 76, 590, 925, -632, 527
+L45: .string "txfuzcqetnhusfjix"
+L46: cmp r6, r5
+L47: .data 409, 207, 301
+prn #-221
+L48: .string "lugk"
+L49: .string "fogjknudjxbbiamydu"
+L50: .data -149, 242, -661, -355, 595, -180
+L51: .string "ognnhnjpyrwdwqnpicvo"
+rts
+not L45
+L52: .data 7, -248, -234
+dec L240
+L53: .data 873, 386
+not L24
+L54: .data 470, 502, 886, 279
+sub L95, *r2
+L55: .string "g"
+mov #64, r4
+jsr *r6
+L56: .data -254, -376, 88, -479
+L57: .data -7, 794, 434, -943, -736, -994, -707
+L58: .data -100, -216, 373, -259, -43, 5, 734
+red L82
+L59: .data 195, -801, 731, -472, -602, 222, 203
+L60: .data 777
+cmp #-252, *r3
+L61: .string "a"
+L62: .string "vrbodtqhtkuomhlabgmwjrad"
+L63: .string "f"
+L64: .string "yr"
+clr r7
+mov r2, *r3
+jsr L46
+sub *r0, r2
+L65: .string "kjt"
+L66: .string "yhvh"
+L67: .data 162, -881
+clr L18
+clr r5
+L68: .data -566, -392, -772, -760, -573, 505, 206, 331
+L69: .string "vgp"
+clr r1
+L70: .string "eydriorakzzptpeszpbbcffg"
+L71: .string "qmeglgu"
+L72: .data 611, 64, 1, 289
+L73: add #-75, r3
+add L64, r3
+L74: rts
+mov r1, *r6
+L75: .string "skbefcfk"
+
+add #13, *r1
+L76: .data 350
+L77: .string "vwpmnvraztqxhcznuuavcpqp"
+L78: .string "kgbvldjxcghuideoib"
+jsr L6
+L79: .string "migkbztgxaz"
+not L153
+L80: .string "kkejknhkh"
+inc *r0
+mov #-195, r0
+L81: .string "axlxdm"
+dec *r7
+L82: .string "gp"
+L83: .string "rtvztnkrsvgxse"
+L84: red L30
+rts
+L85: .data -224, -428, -315, 570, 710, 500, -772, -911
+L86: .string "papbgdkps"
+
+cmp *r7, r5
+bne *r0
+L87: .string "wbvzeadjuc"
+stop
+L88: .string "zuob"
+L89: .data -699, -911, -959, 305, 767, -272, -451, 866
+L90: .string "bbiftvlehvacgocafsji"
+L91: .string "tsvntq"
+jmp L267
+sub r0, r2
+cmp r5, L125
+sub #-251, r2
+L92: .string "hhksfrszwimextuaehrubg"
+L93: .string "nvv"
+clr L269
+
+not L225
+dec r4
+rts
+red r1
+L94: .data -670
+L95: .data 84
+stop
+L96: not r1
+jmp L298
+L97: .data 452, 421
+stop
+L98: .string "tbzfolinyhdkomel"
+add *r0, L14
+not L128
+L99: .string "lfnpfyfarhxwyzopqeh"
+L100: .data 997
+L101: .data -702, 473, 398, 622, -169, 823
+red *r4
+L102: .string "qavzdinm"
+clr L146
+sub #27, r6
+L103: .string "phsndcxdjikucckxngez"
+L104: .string "jnquwdoatczjsezt"
+L105: jsr *r6
+mov #82, r6
+clr *r2
+L106: .data -128, -625
+dec L51
+sub r7, L145
+L107: sub *r0, L3
+inc L146
+L108: .data 477, -446, -30, -615, -960
+cmp L83, #-221
+L109: .string "rvknty"
+L110: .data -70, -170, -689, -454, -835, -703
+L111: .string "qdospilfflurgafjt"
+L112: .data -837, 751, 140, -111, 138, 80, 196
+L113: .string "uzfynrjypnzrj"
+L114: .string "waigtvgwyjfzb"
+L115: .data 855, -862
+not L20
+L116: jmp *r5
+rts
+L117: .data 741
+L118: .string "qdfbtvtroo"
+
+inc *r1
+stop
+L119: .string "getuqbr"
+L120: .string "fosohfoprjqe"
+jmp *r3
+rts
+bne *r0
+stop
+dec r7
+L121: .data -899
+mov L44, L231
+
+L122: .string "gdwjldjc"
+L123: .data 165, 509, -38, 615
+L124: .data -34, -811, -98, -276
+L125: .data -602, -162, 858, 98, 429
+L126: .string "zzeup"
+L127: .data -11, 573, 70, -415, -206, 162, -952, -615
+clr *r7
+L128: .string "riondgsl"
+L129: .string "yzvsbqbbkv"
+L130: .string "ghal"
+red L252
+lea L63, *r2
+L131: .string "xhi"
+L132: mov L51, L121
+L133: .string "ppyhuripjisjifhal"
+lea L63, r4
+L134: .data -281, -907, -800, -375, 462, -522
+L135: .data -91, 119, -821
+L136: .data -339, -769, 822, -941, 539
+L137: .string "rqr"
+L138: .data -161, -523
+L139: .data -608, -554, -311
+L140: .string "fzaqlrgx"
+L141: .string "yszidhy"
+L142: .data -891, -84
+red r5
+L143: .string "khwabq"
+L144: .string "lahqat"
+add L24, r1
+
+L145: .data 671, 58, -4, 331, 232
+add *r0, r4
+L146: .string "ijiucdgksfjhmuqm"
+L147: .data -399, -490, -139
+L148: .string "lsbmpdebcbbyxrwmybizwdqm"
+red r4
+L149: bne *r3
+L150: .string "hkolkfpnhqovptbdjycouh"
+L151: .data -420, -289, -376, 939, 983, -324, -969, 896
+L152: cmp #229, #240
+
+stop
+cmp #235, L36
+prn r1
+; comment
+L153: .data 890, -137
+L154: .data 928, -367, 723
+L155: .data -797, 648, -899, 232, 577, -329
+L156: .string "lkexpzrhntaqoiwg"
+stop
+stop
+L157: .data -587, -113, 47, 69, -162, 665, -609
+clr r4
+L158: .string "dolemejhhatf"
+L159: .data -695, -412, 708, 253, 873
+jsr L46
+stop
+lea L52, *r2
+L160: .data -397, -333, 455
+inc r5
+L161: .data 376, 211, -530, 3, -41
+L162: .data -293, 407, 659, 910, 37, -93, 526, -740
+L163: .string "qwhdicxijpc"
+jsr L110
+L164: .string "tdqxrqdtbqkvhndjdgclxx"
+; comment
+L165: .string "hhj"
+jmp *r6
+L166: .data 8, -957, -579, -14, 825, -294, -285, 506
+L167: .string "mr"
+rts
+rts
+mov r4, *r2
+L168: .data 927, -806, -512, 274, -225, -419, 251
+; comment
+L169: prn *r5
+L170: .string "tzlzevgxefsosbbwjpmq"
+L171: .data 506, 651, -16
+L172: .data 601, 582, 885
+L173: .data -561, -526, 509, -147, -718, -896
+L174: .data 599, -709, 111, -846, 695
+L175: .string "pzvapvnkibhkkhncw"
+L176: .data -487
+L177: .string "mtlbtxnnrh"
+L178: .data 339, 257, -338, 590
+lea L2, *r6
+L179: mov r0, r0
+prn #137
+L180: .data 801, 725, 526, 663, 381, -172, -332, -254
+dec L232
+L181: .data -565, 402
+
+L182: .data 816, 708, -228, -534
+bne L256
+L183: jsr L269
+L184: .data -191, -120, 118, 4, 880, 538, -891
+L185: .data -845, -787
+red r4
+lea L307, r3
+L186: .string "wcn"
+L187: .data 516, -615, -214, 65, -957, -587
+L188: dec *r7
+lea L120, *r1
+L189: .data -722, -267, 691
+bne L7
+L190: .data 102, 303, -800, -853, -34
+L191: .data 201, -769, 110, 390, -381
+jsr *r6
+L192: add *r0, L106
+inc r2
+inc *r5
+L193: stop
+L194: .data -796, -975
+lea L69, r3
+rts
+jmp *r6
+rts
+L195: .data 108, 745, -701, -400
+L196: .string "rbxaunebnit"
+L197: mov L281, *r7
+L198: .string "nxmzlftsqmpxictvl"
+rts
+L199: .string "bsatcujfkputcktjehsdxh"
+L200: .string "msvcjskzrfmozygmzxdxbjhl"
+L201: .data -837, -97, -420
+L202: .data -575, 516
+sub r5, *r0
+L203: .string "rmhkvxvc"
+L204: .string "w"
+jsr L251
+L205: .data -968, -306, -699
+dec *r0
+L206: .data 113, 622, -479, -665, 706
+dec *r0
+L207: .data 584, -130, 937, 41
+L208: .string "lgn"
+bne *r7
+not L231
+L209: .string "ddhxoaxjkauekqwaqkglrp"
+L210: .data 753, 62, -698
+L211: .string "kvldshhm"
+lea L257, L231
+L212: .string "gsjugk"
+sub #191, L103
+L213: .string "opwslxzxcfb"
+L214: .data -44, 304, 149, -280, -349, 226
+L215: .data 144
+L216: .string "avmczuswkikc"
+L217: .string "rnwstdppsl"
+L218: .data 269, 715, -379, -927, -331, 190, -1000
+
+L219: .data 668, -521, 500
+sub *r6, *r1
+bne *r5
+L220: .string "leibbjrpvgoxochwdwwxw"
+L221: .string "atjopdwgrjjieo"
+L222: .data -144, 906, -321, -659, 429, 679, -993, -963
+L223: .string "guyttxpwxapgigliz"
+stop
+bne L231
+L224: .string "tsyhsilstjppkcmr"
+L225: .string "jmjyhbkxmdkwxgkbl"
+L226: .data 795, 592, -117, -205, -818, 466, -600, -782
+jmp L101
+L227: .string "hhhlrkvzy"
+jmp L90
+L228: .string "yozhyeobdblfdwqyktmbnuy"
+L229: .data -286
+rts
+L230: .string "egcsccjeldfgtaqufddq"
+L231: .string "dklijgljff"
+cmp r7, L239
+cmp #-110, r5
+L232: .string "nv"
+L233: .data 165, 150
+lea L218, r3
+L234: .data -317, -578, 505, -273
+stop
+L235: .string "qlafntkdkgxmf"
+rts
+L236: .string "wamlqfgxpuizx"
+red *r2
+L237: .data -961, -199, 220, 140
+L238: .string "izocph"
+L239: .string "zwycywrnluyyanioeeq"
+L240: .data 881
+L241: .string "lgvjikssry"
+L242: jsr *r6
+
+L243: .data 726, -892, 716
+L244: .string "ecpnifikrdv"
+clr *r4
+inc r4
+L245: .string "ethkcbusasedsqui"
+dec r1
+L246: .string "rcv"
+prn #-39
+L247: .data -720, 902, -717, 378, -825, -144, -259, -863
+L248: .string "vvkgmh"
+L249: .data 794, -254, -122, 362, -996, -61, -674, 111
+prn L282
+L250: .string "ksbtshvwct"
+mov L95, r2
+L251: .data 366, -232
+L252: .string "oqtloevewlrbqt"
+L253: .data -834, 503, 159, -151, 219, -439
+L254: .data -868, -216, 497, 822, -421, -799, 454
+L255: .data -745, 413
+L256: .string "k"
+L257: clr L236
+; comment
+bne *r2
+jmp *r5
+L258: cmp #-166, L66
+L259: .string "ceodupjhazkb"
+L260: .string "cxjykvwlhdqvogclndtwqm"
+dec r6
+L261: .string "roeku"
+L262: .data 625, -221, 405, 108, 268, -275
+L263: .string "wylnnrlkkny"
+L264: .string "wgqievdlfiloejrlixscumzv"
+dec *r4
+L265: .data -230, -57
+L266: .string "cgzzpslrscabksc"
+L267: .string "cikpcefu"
+L268: .string "j"
+L269: .string "rwcx"
+L270: .data 671, -4, -601, -549, -699, -293, 490, 34
+L271: .string "zmndosycxpcuzdeislooqhyk"
+L272: bne L285
+L273: .data -553, 560, 830, -359, 410, 865
+rts
+L274: jmp *r6
+L275: .string "fxki"
+dec r6
+L276: .data -291, 753, -947, -190, 843, 156, 737
+L277: .data -652
+not *r5
+stop
+not L292
+rts
+L278: .string "odmyl"
+L279: .data 527, -584, -298, 558, 360, 729, -349, -31
+bne L73
+jmp *r5
+L280: jmp *r6
+mov #-9, r5
+L281: .data 663, -15, -390, -291, -581
+sub *r5, L174
+L282: .string "hvpmiudspwugapdbvmmwf"
+L283: .data 804, -541, -602, -78
+L284: .string "sqjukeyyyoamreenqhfttso"
+L285: .string "laxngg"
+dec L304
+L286: .data 538, -312, 292, -502, -339, 871, -859
+L287: .data -30, -344, -948, 605, -537, -565, 661
+; comment
+L288: .data 578, -609, 308, -575, -442, 270, -465
+prn #-96
+L289: .string "iitwzwfbfvgyrlcu"
+L290: .string "xjmczhrmdootsnqub"
+L291: .string "bjhxiyhjhywpvo"
+; comment
+L292: .data -331, -677, -744, 69, -795
+L293: .data 572
+stop
+L294: .data 565, 509, 767
+L295: .data -234, -980, -168, -269, -690
+L296: .string "azihvcu"
+L297: .string "ierfuioqzetqbmbsimhdcj"
+jmp *r0
+L298: .string "ovgwjapwgwtigc"
+; comment
+bne *r4
+L299: .string "aaepaynxhxsynzrybxoshkuy"
+L300: .string "qpfiypzvibtwojppcphiz"
+mov r5, L235
+L301: .data 417, -825, -416, -829
+L302: .string "imfsmustya"
+L303: jmp L310
+L304: bne L16
+dec r7
+L305: .data 509
+L306: .data -495, -241, -386, 219
+L307: .data 718, 260, 591
+L308: prn *r1
+L309: .string "qtovxucfqth"
+L310: .string "sbikejc"
+stop
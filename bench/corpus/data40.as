@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 41
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .string "nubsdi"
+L1: .string "kqjckusenzlxb"
+L2: .string "pcykihockoobt"
+mov r1, L2
+L3: .string "mfrpuohfwsacrejq"
+L4: .data 217, -846, -908
+L5: .string "ekuapon"
+add *r7, r0
+L6: red r5
+stop
+L7: .data -101, -743, -866, 513
+L8: .data 46
+L9: .data 222, -627, -459, 762
+dec L8
+L10: .string "tltlucugyhyxopexmlgfrskk"
+L11: .data -888
+L12: add #-176, r3
+L13: .data -819
+rts
+add r4, L5
+L14: .data 530, 23, -735, -899, 114, 792
+L15: .data 884, -999
+; comment
+L16: .data 982, -344, 577, -35, 875
+L17: .data -575, -242, -487, 236, -764, -952, 822
+lea L86, r3
+L18: .data 558, 21, -229, 864, -324
+L19: .data 981, -623
+L20: .string "bsn"
+L21: .data -787, 700, -615, 852, 678, 685, 776
+L22: mov r3, *r6
+L23: .data 956, -565, 384, -289, -257, 575, -183
+L24: .string "hgvocxclyuxm"
+L25: .data 996, -59, -664, 408, -790, -735, 301, -554
+; comment
+L26: .string "mjhuhglquxodiwp"
+L27: .data 797, 620, 79, 448, 303, 278, -80, -761
+L28: .data 669, 82, -291, 532, 300, 589, 443, 64
+add r6, r4
+L29: .string "wakyaxoxalvkjbj"
+L30: .string "iooyrszxvkrhsbas"
+L31: .string "za"
+L32: red *r6
+L33: .data 595, 461, 765, -248
+L34: rts
+sub r7, *r5
+L35: .data 172
+L36: .data 998, -614, -155, -586, 831
+L37: .string "nheystmiiwgt"
+L38: .string "gsgmetcffq"
+L39: .string "tzhcukxmijqt"
+L40: .data 185
+prn r3
+dec L220
+bne *r4
+L41: .data 660, 334, -336, -866, 869, 880, 779, -996
+L42: .data -257, 975, -312, 738, -947, 380
+L43: .string "muzyypuoidbqk"
+L44: .string "lxrtkafdifovjmeqx"
+L45: .string "ruyanfiix"
+L46: .data -834
+L47: .data 626, 274, -666, -527, -526, 833
+L48: .data 744, 635, 32, -544, 308, -311
+L49: .data 790, -137, -968, 916, 563, 534, -405, -625
+L50: .data -942, -206, -511, 188, 313
+bne *r4
+L51: .data -65, -589, 715, -276, 379, 673, 716
+L52: .string "d"
+L53: .data 670, -710, 380, -905, 879
+L54: .data -615, 461, 440, 868
+L55: .string "nqifctededjyzixnqdij"
+L56: .data -928, 314, -595, -724, -823, -506
+L57: .string "lscuctmcmjplmuhz"
+L58: .string "y"
+L59: .string "ixqowgpfmysqcjjbgpow"
+; comment
+L60: .data -549, -667, -199, 794, 297, 392
+not r2
+L61: .string "cnwjvfuhkupkrf"
+L62: .data -608, 855, 273
+L63: .string "w"
+L64: red *r2
+L65: .string "xbeewfsv"
+L66: .data -800, -19, 504, 115, -506, 994, -740
+L67: stop
+clr *r1
+L68: .data -611, -919, 689, -248, 695
+L69: .data 522, -465, 887, -141, 316, -926, 698, -2
+L70: .string "cnjznjujdubkjisbnogwj"
+L71: prn r1
+L72: .data -190, 922, 473, -928, -731, 954, -276
+L73: .string "u"
+L74: .data 371, 563, -734, 665, -983, 383, -905, -742
+L75: .string "mmucfouv"
+L76: .string "uyjgxoephrebghk"
+add *r4, *r4
+mov *r3, r7
+L77: .string "hnnfbi"
+jmp L72
+sub *r0, *r4
+L78: sub L311, *r2
+mov L205, L196
+L79: .data 939, -89, 129, 576, -139, -874
+L80: .data 687, 997
+red *r5
+cmp *r3, L46
+L81: add *r6, L243
+
+add *r3, *r4
+L82: .string "luchchrrz"
+L83: .string "loqsxjitcmvvnxhsmgo"
+L84: .data -250, -486, -586
+L85: .string "iiiknnyexmwkozpgg"
+jmp *r0
+L86: .data 281, -268, -912, 281, 825, -489
+L87: .data 233, 541
+inc r5
+inc r6
+L88: .string "qpncaflem"
+inc *r1
+L89: .string "cbruch"
+L90: .string "flhpigtrabnzzalgjgncu"
+L91: .data -442, -736, -891, 289
+add L121, L15
+red L83
+sub r5, *r0
+mov L303, *r3
+L92: .string "nhpyvirax"
+L93: .string "rpjfpbfoofiulkyzzrmqoq"
+L94: .string "esjhdn"
+jmp L138
+stop
+rts
+L95: .string "ybzonoa"
+not *r4
+jmp L219
+L96: .string "ivlvybfbhdkzubiatst"
+L97: .string "yzsuj"
+L98: .string "dcplnvzqiwwma"
+L99: .string "wh"
+lea L85, *r3
+L100: .data 322, 480, -907, -290
+L101: .data -189, -52, 645, 345, 140, -417
+inc L211
+prn L32
+L102: .string "sadg"
+L103: .string "aohfxpnwwhgaaqdiaab"
+L104: .string "stdbtblemobwoz"
+L105: .data 437, -457, -465, 10
+bne *r0
+lea L54, *r4
+L106: add r5, r0
+L107: .data -594, 37, 365, -825, -833, 843, 390, -733
+L108: .string "llxvvkwyeqrwtsaxbvueick"
+L109: .string "wzjzugaxiejexy"
+inc r6
+L110: .data -836, 253, -80, 298, -263
+L111: .string "g"
+L112: .string "fh"
+L113: .data -411
+L114: .string "oxzp"
+L115: .string "vtrsrrgjedosxzxxh"
+L116: .string "geczmjqa"
+clr L135
+L117: .data 116, 721, -839, -13, -888, 890
+L118: .string "jmeiyuxbjpmsigwknih"
+L119: .data 377, -252, -509, -916, 861, 550
+; comment
+L120: .string "rhvqgdno"
+prn #176
+clr L241
+L121: .string "yovt"
+L122: .data 670, 421, 976, -154, -719, 162, 13
+lea L133, *r0
+L123: .string "imxlsnomufkaqqhwlxd"
+L124: .data 774, -873, -725, 688, -183, -592
+jsr L20
+L125: not *r0
+lea L322, r4
+jmp *r0
+L126: jsr L285
+clr r2
+L127: .data 191, 30, -882, -518, -167, 860, -195
+rts
+jsr L21
+bne L24
+mov *r2, r5
+L128: .string "vqqo"
+L129: .string "vbnxncuixbduikcveft"
+L130: .string "ua"
+L131: .data -960, -116, -281, 568
+L132: .string "l"
+L133: .string "izcihsygtsuotuiacgl"
+L134: .data -524, -797, 103
+L135: .string "mtyrmoth"
+jmp *r4
+L136: .data -826, 264, 185, 598, -453, 210, 873, 984
+mov L77, *r7
+rts
+inc *r0
+L137: .data 107, -457, -285, 406, -403, -512, -53, -412
+add r2, *r6
+dec L73
+L138: .string "txp"
+L139: .data 143
+L140: .data 204, -651, -679, 194, 410, 213, 214, 7
+L141: .string "zhgosuag"
+prn L181
+not L70
+clr r0
+L142: .data -968, -978, -256, 486, -107, 315
+red *r7
+L143: .string "zwy"
+inc L46
+jmp L152
+bne *r6
+jsr *r2
+bne L135
+lea L40, r7
+L144: .string "hftrhubg"
+stop
+L145: .string "pdernvlebnayxoxvilxqbo"
+L146: .string "cdjlqgw"
+L147: .string "ejqllxtafdzhjsvxdauxibq"
+jsr L46
+bne L322
+L148: .string "qwlnrnyou"
+L149: .string "mebtbiwecxxqnkkbebzeun"
+L150: .string "hhnhefi"
+L151: .data -436, 377, -943, 58, -619, 859, -35, -847
+jmp L258
+
+L152: .string "fqycfz"
+clr L215
+L153: .data -547, 672, 591, 558, -975, 900
+L154: .string "kdcvywirzpnfxsjldl"
+inc *r7
+L155: .string "yhzmxlmkhboas"
+L156: .string "brwgtziwxxdsgqgkzlhw"
+dec r7
+L157: .data -546, 70, 287, -528, 145
+L158: .data 822
+L159: clr L19
+jsr L110
+L160: .data -105, -63, 335, -733, -364, -152, 302, 505
+L161: .data -860, 270, 976, 391
+L162: red *r3
+L163: .string "xweaobjomwmpijrefos"
+L164: .data 59, -190, -73, 245, 125, -511
+L165: .string "pdogkaayzpaxn"
+L166: .data 662, 141, -690, -574, 790
+prn L224
+L167: .string "mxfcmo"
+L168: .data 276, -628, 983, 239, 698
+L169: .string "jbwesfejk"
+L170: .string "nczfymnqjcqjpabkdjlb"
+red *r5
+L171: .data 96, 253, -925, 922, -510, 623, -248, 129
+L172: clr *r4
+sub *r5, r7
+L173: mov r2, r1
+L174: mov #154, L27
+not r7
+L175: .string "angolzm"
+L176: .string "wcifylhpwra"
+L177: .string "g"
+red *r3
+L178: add #-99, L80
+
+L179: .string "gonlmaqu"
+L180: .string "pkmvjlbmnnenvobetsxfbu"
+L181: .string "fsdzobvo"
+L182: .string "kjzcj"
+L183: .data -388, -20, 904, 613, -608
+L184: .data 610
+add L325, *r7
+L185: .data -419, 816, 321, 876, -915, -1, 353
+L186: .data 239, 531, -197, 369
+L187: .data -247, -87, -600, 681, -334, -365, 483
+inc r5
+L188: .data -318, 258, 439, -17, 776, -209, -257
+rts
+L189: .string "pksjvmyjnlylikndhzxuxk"
+L190: .data -114, 76, 613, -478, 694, -145, 836
+red r0
+prn #209
+L191: .string "kcjh"
+L192: .string "tpwdhlhaktwsqljx"
+mov L290, r5
+inc L25
+lea L109, r1
+L193: .string "hcrbglvqactupvx"
+lea L55, r4
+L194: .string "gtbzs"
+inc *r0
+L195: .string "klcjvxbuy"
+L196: .data -275, -125, -851, 505
+L197: .data 772, -535, 987, -871, 845, -320
+; comment
+L198: .string "j"
+L199: .string "jixadpqlfwjvc"
+; comment
+clr L272
+L200: .data -237
+mov L117, L269
+L201: .string "cxsunhytefbndc"
+L202: .string "euiyzdbnujamxlkamalqkjr"
+L203: .string "usbvzsh"
+L204: .data -331, 88, 2
+L205: .string "ixysdmmjhglulnsu"
+L206: .data 801, -134, 419, 807, 898, 129, 279
+L207: .data -508, -648
+L208: .data -629
+jmp L238
+L209: .string "urn"
+lea L310, r0
+dec L325
+L210: .string "rnqybkpzyie"
+L211: .data -217, 258, 278, -947, 347
+cmp #-247, r0
+L212: .string "lpul"
+rts
+L213: .data 208, -78, 835, 785, 334, 183, -932, -388
+lea L262, r5
+L214: .string "romiqakhtcretxrnxifb"
+L215: red r3
+L216: .string "eommecwjjpfakocqgcydwntv"
+add r5, L241
+L217: stop
+L218: .string "rryybhgdyvaaqaulrvvmib"
+
+L219: .string "nyxdxdrsticgih"
+L220: .string "weghygauxrs"
+L221: not r5
+sub L317, *r2
+L222: .string "ndfjonpzrrslckqaivfrs"
+L223: .string "nxnuppn"
+L224: .data 179, 157
+L225: .string "cggijy"
+L226: .string "m"
+
+; comment
+L227: .data 270, -886, 702
+mov L74, *r4
+L228: .data 462, -348, 57
+L229: .data -827, -982, -538
+L230: .data -717, 682, 785, -877, 422, -262
+L231: .string "brnihrtgpiktadtfdyrldsqu"
+L232: .string "zhfssjbompnbqihsgetao"
+L233: .data -708, -401, 861, -979
+L234: .data -160, 974, -241, 642, 63, -526, -549, 744
+inc r6
+L235: .string "fhxklaspiaqgufzbzzgq"
+prn r2
+L236: .data 534, -584, -487
+L237: .string "x"
+cmp r5, #90
+clr L316
+lea L71, r7
+cmp *r0, *r0
+L238: .string "imrajoyqrorqpvdkybmik"
+jsr L284
+L239: .string "ldj"
+L240: .data -593
+
+L241: .data 463, 32
+L242: .string "sotoauxiryzatcz"
+L243: .string "cxpxfeuk"
+L244: .data 887
+L245: .data 540, 522, 926, -262, -456, 390, -947, 598
+L246: .string "qmxepn"
+rts
+jsr *r5
+rts
+L247: jmp *r3
+not L301
+L248: .string "gzglvbsfrlwzozpbcynrjg"
+red r5
+L249: .data 797, -737
+L250: .data -992, 972, -619, -891
+not r1
+lea L75, *r2
+jmp L176
+L251: .data -330, -746, -221, -140, 903
+L252: .data -323
+L253: .string "lpctkuyqkyaqtxnhh"
+sub *r3, r6
+L254: .data 656, -967, -865, 795, -835, -851, 956, 549
+L255: .data 860
+; comment
+L256: .string "yicipb"
+L257: .data 734, 509, -496
+L258: .data 510, -97, 602, -881
+lea L313, r5
+L259: .data 8, -712, -161
+red L292
+red *r7
+L260: .string "dxlbxxqpnsxz"
+jmp *r6
+L261: .string "quwautst"
+L262: jmp *r6
+L263: .data -620, -957, -600, -372, -459, -270, 436
+; comment
+L264: .data 360, -69, 149, -650
+L265: .string "idbarebkx"
+rts
+add #-92, *r4
+jsr *r6
+L266: jsr *r2
+L267: .string "ujmfsjsxvlhg"
+L268: dec r2
+L269: .string "eoszbeynojtalvwalczy"
+L270: prn *r1
+lea L97, r4
+L271: .data 298, 584, 791, -322, -516, -866, -148, -940
+stop
+L272: .string "qde"
+add L215, L31
+
+L273: .string "yhg"
+L274: .string "nrcx"
+L275: .data 676, 148, 297, 370, 472, -467, 279, -627
+L276: .data -747
+jmp *r4
+L277: .string "zuwweuuevispykd"
+L278: .data -351, 101, 516, -92, -618, -974, 510
+
+L279: .string "mkolsipzeosq"
+lea L76, r6
+L280: .string "vidkeyvthbgdhocqurkrsxgy"
+rts
+jmp L245
+L281: .data -162, 582, -297, 872
+not r1
+L282: .string "ridogfletjyfxmjlzsrgkvlm"
+; comment
+L283: .string "rfiwstzwdyifftug"
+jsr *r3
+L284: .string "termhkntwbrhwsae"
+bne *r0
+L285: .string "tatttluhuejuegisytcjxd"
+L286: .string "uiooxagljalsyf"
+L287: .string "cwi"
+L288: .string "owlkbhlogzijsaeyirxokjbw"
+L289: .string "ysqemazzvabablaxlfyulcs"
+L290: .data -101, -380
+L291: .string "hjn"
+L292: .data 985, -221, -865, 398, -645, 295, -645, -143
+L293: .string "nnpeqhatkqcdr"
+cmp #-49, r2
+; comment
+L294: .data -612, 303
+L295: .data -829, 42, 702, 303, 618, 645, -441, -842
+L296: jsr *r7
+stop
+L297: .data -113, 505, 57, 56, -942, 391
+red r1
+L298: .data 789, -186
+red r3
+L299: .data 925, -156, -517
+L300: .data -447, 569, -33, -314
+L301: .data 958, 169, 517
+L302: .data 616
+dec L304
+L303: .data -531, -856, -346
+clr L147
+L304: .string "hyimnrwljdix"
+L305: .string "rzkabxlkkfpc"
+mov r6, r1
+not r7
+L306: .data -390, -101, -997, 288
+L307: .string "j"
+L308: .data -933, 518, -144, -383, 792
+rts
+L309: .data 350, -740, -384, 951
+L310: .data -631, -674, -493, -845, 693, 645, -506, -495
+L311: .data -660, -502, -970, 777, 569
+L312: .string "guaikdwjfbrefgdkufdpu"
+
+L313: clr L323
+L314: .string "v"
+sub L154, *r7
+L315: .string "afkowayezzbbrmmdcuiua"
+add L110, r1
+lea L318, *r2
+L316: dec r2
+bne *r5
+L317: .string "erghwa"
+L318: .data 311, 969, 523
+L319: .data -422
+L320: .data -938, 884, -747, 316, -65, 168, 395
+add *r6, *r3
+clr L221
+
+L321: .data 731, -773, 85, -923, 689, 275, 541
+rts
+L322: .data 108, 279, -214
+L323: .data -350, 183, 296, -957, 515
+L324: .data 719
+L325: .string "sfyjfgs"
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 42
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .string "qqmjaixdptsz"
+L1: .string "gonlgrxzpp"
+L2: .data -536
+L3: .data -590, 622, -613, 424, -488, -111, -64, -413
+L4: .data -896, -213
+L5: .string "njczdepdxubwfeisljjsxoc"
+L6: .data -823, -325, 504
+L7: .data -581, 31, -607, -548, 11, 482
+inc L319
+L8: .string "fzdtvfsvuoszrfguwegmz"
+L9: .data -135, 903, 85, -192
+L10: lea L56, L1
+lea L157, r2
+L11: red L320
+L12: prn *r4
+L13: .string "qirfgqbsj"
+L14: .data 710, -746, 132, 389, -661
+L15: rts
+L16: .string "sktkm"
+L17: .string "vzremw"
+L18: .data 943
+L19: .string "vml"
+L20: .string "di"
+L21: .data 815, -217, -308, 727, 759
+jmp L9
+L22: .string "pcpvfl"
+L23: .string "skasqeadmtryrjps"
+L24: .data -732, -308, -348, -220, 907
+L25: .string "utzzqboaahpfdv"
+bne L146
+L26: jmp L93
+L27: .string "raniymvvlksqtg"
+clr r1
+L28: not L19
+L29: .data 687, 669, -944, -911, -893, -631, -580, 998
+jmp *r5
+L30: .data -276, 189
+L31: rts
+add r6, r7
+; comment
+cmp *r3, *r6
+jmp *r3
+L32: .string "pky"
+L33: .data -407
+L34: .string "jlzdamy"
+L35: .string "uvjwdthcnjor"
+L36: .data 579, -403
+L37: .data 54, 83
+L38: .data -972, 411, 255, -328, 488
+L39: .string "yagv"
+L40: .data 366, 539, -205, -611
+add #-192, r7
+L41: .string "s"
+L42: jmp *r3
+add #-200, *r0
+dec L98
+stop
+L43: .string "d"
+L44: .data 275, 411, -211, -617, -69, 980
+cmp *r0, #-159
+sub r4, *r1
+L45: jmp *r5
+; comment
+rts
+L46: .string "knl"
+prn L40
+L47: sub *r1, *r0
+L48: red *r7
+L49: .string "egrqlywyxxsqvhvxnjrgw"
+L50: .data -288, -470, 562, 982
+mov L59, L272
+mov *r3, *r7
+L51: .data 636, 640, 914
+L52: .string "guhtrvrtqqng"
+clr *r4
+jsr L33
+L53: .string "zcyzsvgsglwlwohbppiheg"
+L54: .string "bxpceufuknzzqorc"
+L55: .data -245, -73, 227
+mov L280, r6
+not *r1
+clr L55
+dec L93
+L56: .data 20, -73, 762, 28, 877, 828, 226, -30
+L57: .data 489, 499, -483, -475, 271, -429, 827
+L58: .data -320, 713, -238, 832, -805, 266, 718, 290
+prn *r5
+; comment
+L59: .data 416, -753, -924, -749, -836, 358, -510
+L60: .data 734
+L61: .string "pgs"
+
+L62: .string "cjrssjxhsitylsynl"
+L63: .data 193, 35, 909
+stop
+L64: .string "ifzk"
+L65: jmp L328
+sub L49, *r0
+L66: .string "vvtdafvmfjajrgep"
+L67: .string "manaqjxo"
+L68: cmp r7, *r4
+red r1
+L69: .string "ue"
+L70: mov *r0, L307
+L71: red r0
+; comment
+L72: .data 782, -238
+lea L19, *r6
+L73: .data 321, 374, 817, 793, -507, -10
+L74: clr *r7
+mov *r7, L38
+L75: .string "l"
+; comment
+mov L319, r3
+L76: .string "qonsmfpmofyvjs"
+L77: .data -87, 284
+L78: .data -67, 968, 920, -66, 619
+L79: .string "yzfeb"
+L80: .data -358, -804, 219, 687
+L81: .string "rddqzsfsxznlzqkgfsvb"
+bne *r5
+L82: .string "nfcpoozsnio"
+L83: .data 432
+L84: .string "balupmwtdsu"
+L85: .data 531
+L86: .string "kqebxnggf"
+L87: .string "fhh"
+L88: .data -545, -978, -469, -803
+L89: .string "hlayxmllkmxinx"
+L90: .data 395, -396, -150, -815, 248, 317, -684
+mov #-175, r7
+L91: cmp L87, r0
+L92: .string "i"
+L93: .data -430, -190, -932, -882, 536, 115, -159
+L94: prn #22
+L95: .string "qncwtwtkffgafel"
+L96: clr r3
+sub r0, r5
+L97: .string "cgfqlxqfqdhcngdwwlkyyha"
+L98: .data 154, -720
+L99: .string "mypq"
+L100: .data 33, 136, 373, -542, 715, -40, -172, 351
+clr L47
+L101: .string "fwbalc"
+not *r5
+cmp L256, L172
+L102: .data -601, 684, -516, 625, -445, -455, 454
+L103: .string "mglavwcdhbpgr"
+L104: .data 160
+; comment
+
+L105: .data 773, -75, 352, 859, 582, 533, 758, 932
+L106: .string "zeyujfuylsrpbfjpawtuw"
+L107: clr r1
+L108: .data -407, -375, -398, -995
+red *r3
+add *r6, L198
+sub L74, L145
+L109: .data 952, 38, 370, 675, 248
+rts
+L110: .string "lgmazhgdrsrnckd"
+rts
+dec *r1
+; comment
+L111: .string "ztvdaicvc"
+L112: .string "tfgyqxwcs"
+L113: .string "oteojkshr"
+L114: .string "b"
+dec L165
+L115: .data -543, 537, -962, 779, 740, -691, -396, -424
+L116: .data 889
+L117: .string "wxvbzx"
+dec *r2
+sub #-200, L306
+L118: inc L177
+L119: .data -858, -800, -996, 312
+L120: .string "qelihuxuxiergxlllufhgwac"
+dec *r5
+L121: .string "aptnqfvtl"
+L122: .data 601, -933, -734, -148, -338, -475, -765, 132
+L123: .string "i"
+L124: .string "ocv"
+red L9
+L125: .string "wdojzcnegihsxkzn"
+L126: .data -25, 429, 94, -425
+L127: .string "ihtflkabvglhiodjkrm"
+lea L160, r0
+L128: .data 854
+lea L332, *r1
+L129: .data 676, -885, 924, -280, -715, -886, 232
+L130: .string "xsef"
+jmp L133
+inc r2
+L131: .string "lmydeejyf"
+L132: stop
+L133: .data 325, -779, -108
+jsr *r5
+cmp r7, r2
+sub *r6, *r3
+L134: .string "khpxfqqlhtgnlcqqmovdzp"
+L135: .string "qzlisbgzzthds"
+rts
+L136: .data -955, 860, -748, -159, 562, -258, 783, 896
+L137: mov *r0, *r6
+red L44
+L138: .data -4, -309, 159
+L139: .string "l"
+clr L205
+L140: .data -393, 317, 269, -28, 963
+rts
+mov L158, r6
+L141: dec *r5
+L142: .data -240
+L143: .string "txmnofmtkvzy"
+jmp L88
+L144: .data 996, 323, 409, -490
+L145: jsr *r3
+L146: .data 132, 66, 848, -888, 344
+L147: .data -517, -94, 869, 815, 926
+inc *r5
+L148: .data 369, -355, 518, 499, 930, -53, -920
+L149: .string "uurybwmolvtvhnlstxxm"
+L150: jsr L77
+jsr L270
+L151: .string "t"
+L152: .string "pzxicx"
+prn *r6
+cmp #195, L289
+lea L293, L18
+L153: .string "otvpixcwgwoignarco"
+L154: mov *r7, L0
+L155: .string "e"
+L156: .data 262, -428, 160, 930, -346, 620, -480, 63
+rts
+L157: .data -439, -603, 463, -300, 918, -417
+jsr L127
+L158: .string "xmdxvfqzpc"
+L159: .string "vgydftulkutwkbruor"
+dec *r0
+
+L160: red r6
+L161: .data 543, -484, -733, -228, 969
+L162: .data -801
+L163: .data -585, -208, -279, 425, -354, -104
+L164: .string "l"
+L165: .string "xlqvjvxwrwvgukaokmt"
+
+L166: .string "ebgwpgimfy"
+L167: .string "ygagqczwlbqw"
+
+L168: .data 381
+L169: .data -460, 912, -525, -557, -456, -50, 25, 315
+L170: .data -574, -733, 509, 239, 182, -656, 989
+L171: .data 595, 301
+L172: .data 785
+L173: .data -917, -847, 988
+stop
+L174: .data -150, 823, 64, -171, 648
+L175: .data -215, 418, -946, 969, 503
+L176: .string "xknygogbum"
+L177: .data 956, 207, 624
+L178: .data -818, 482, 759, 505, 16, -56, -102, -458
+L179: .string "ffszlphmbhmkt"
+lea L175, r0
+L180: .data -864, -356
+not *r6
+L181: .string "xdlmzmessb"
+stop
+
+cmp *r4, r6
+L182: .data -585, -863, -821, -238, 667, 665
+cmp r6, L206
+L183: .data 667, 802
+L184: .data 313
+L185: .data 468, -575, -273, 524, 382, 888, -344, -990
+add L254, r5
+L186: .data 231, -133, 540, -643, 364, 259
+L187: .string "rmoextnoelhobnimmvpe"
+L188: .data 210, -82
+jsr *r0
+L189: .data -189, -144, -473
+lea L242, L53
+L190: .data -590, -607, 424, -394, 137, 413, 541, 493
+clr L120
+sub r1, L235
+L191: stop
+L192: .string "ftpwerflkvpcbzr"
+sub *r1, r1
+L193: .data 478, -310, -895, -559, 289, -185
+L194: .string "yvskbjprbcrqetdgtzue"
+inc *r0
+L195: .data -888, 208, 59, -287, -673, 978, 236
+L196: .string "qwtdlh"
+lea L195, r2
+L197: .data -860, 900
+bne L258
+L198: add #-28, r0
+L199: .string "buwauc"
+L200: .data 210, -959, -434, -143, -536
+L201: .data -46
+L202: .data 480, -194
+L203: .string "rpfjmtgxxblcntcgofqcjugv"
+L204: .data -339, -540, 105, 103, 611, -632, -360, 994
+L205: .data 125, -484, 726, 854
+L206: .string "gbggmazc"
+red L240
+L207: .string "esnfgnnv"
+L208: .data -207
+jmp L250
+L209: .string "rchqpvuexyygvjwse"
+L210: .string "nkmye"
+L211: .string "hlyp"
+mov L249, *r1
+L212: .data 691, -149, 148, 452, 956, -204
+L213: .data -579, 176, 694, -260, -153
+L214: .string "hubzvffuk"
+L215: .data -866, 737
+L216: .string "prw"
+dec r4
+L217: .data -616, -196, -761, -304, -173, -120, -222
+L218: .string "z"
+add r1, *r1
+L219: inc L154
+; comment
+L220: .data -676, 581, -504, 431, -804
+add *r0, *r1
+; comment
+L221: .string "kgrdfzqhbgcxtfyuglbsy"
+L222: .string "qfypcanvxuvpojjttr"
+L223: .string "gpkyshlflieli"
+sub L185, L264
+L224: .string "sowmxzkjosuvfoktvo"
+L225: .string "hmzqraki"
+L226: .data -848, 62
+L227: .data 121, 331, 349, 94, -64, -720
+L228: .string "irmkdlunzqiebeztwqx"
+L229: .string "bosatrjvm"
+add r7, L153
+; comment
+L230: .data 570, 230, 27, 615, -787
+sub #-152, *r4
+
+lea L154, *r4
+rts
+bne L263
+L231: .data 226, -486, -465, -439, -806, -403
+L232: .string "apbnailjwzuozxjlugvgmn"
+clr L295
+L233: .string "altkykmphgbmksxznk"
+L234: .string "wtlkazewzvgkfhlsilnumlr"
+dec r7
+L235: dec r4
+dec L261
+L236: mov L147, L242
+L237: .string "fjgghwczovfzdfv"
+not *r1
+L238: .string "pppbp"
+L239: .data -259, -314, 705, -203, 813, 953, 563, -404
+L240: .data -783
+jsr *r7
+L241: .data 634
+L242: .string "qlqqppetbowaqkzrokafcshd"
+L243: .string "mwle"
+
+L244: .data 563, -562, -303, -638, -735, -742
+L245: .data -370, 643, -994, 319, -880
+L246: .data -306, -665, 902, -548, 557, -121, -822, -813
+; comment
+L247: .data -709, 900
+L248: red L169
+mov *r1, *r0
+L249: .data -742, 10, 629, -731, -408, -180
+L250: .data 50, -611
+L251: .data 131, -95
+L252: .string "omyhmrkunorgtlo"
+jmp *r3
+not r6
+L253: .string "ulfpkrcogbswsrzbirq"
+L254: .string "rq"
+lea L329, r5
+L255: .string "tamczo"
+L256: .string "swlcnevzgeshi"
+rts
+jsr *r3
+L257: .data 957
+L258: .data 8, -367, -429, 344, -567, -818
+L259: .string "cxxnabdugpgt"
+L260: .data -442, 182, 309, 332
+L261: stop
+L262: .data 508, 589, 530
+L263: dec *r2
+L264: .data -938, 738, 107, -193, -724
+L265: .string "vnroop"
+L266: cmp L137, L141
+L267: .string "vsov"
+L268: .data 372, -316, -280, -568, 837, 332, -740
+red L273
+cmp *r2, *r4
+
+L269: .string "fhvdhhohuhdbchbvbfzpdnpm"
+mov r1, L276
+jsr *r3
+mov *r5, L225
+L270: .string "qzraxaraiocsl"
+L271: .string "ldwtbahssozmwiu"
+L272: .data 257, 474, 52
+L273: .data -638, 721, 818, -291, 123, -446, 987
+inc *r2
+L274: .data 495, -134, 220, 56, -984
+L275: .data 443
+L276: .string "bfcwereqyaukbuetbkgqzh"
+L277: .data 864
+L278: .string "jnabyegsqg"
+mov #210, L235
+L279: .data 224, -724, 835, -579
+L280: .string "jrknezzqtg"
+L281: .data -715, 720, 798, -659
+L282: .string "zazhtquqohldsfhqrlce"
+bne *r4
+clr L200
+L283: .string "edvzzcdexwakrsgesrpnbi"
+L284: .string "weg"
+L285: .string "klurwz"
+L286: .string "gaueskznofvibf"
+L287: .string "ovxtwknabewuemyp"
+L288: .data 469
+L289: bne L310
+L290: .data -448, -306, 722, -43, -425, 336, -865
+L291: .data -987
+L292: .string "yruhwlpwz"
+clr r5
+L293: .string "ar"
+stop
+L294: .string "sfsxcsunsrwc"
+L295: .string "psiyvutplgsmrkelc"
+L296: .string "yntrccooohugbe"
+L297: .string "xcojohjshylwzvhlxxhimik"
+L298: .data 312, 649, -424, 416, -976
+add r4, L50
+L299: .string "gtov"
+; comment
+jsr L315
+L300: .data -840, -320, 600, 233
+L301: .string "yrtajegbcectcmhbtytu"
+L302: .data 439, 341, -432, -796, -753, -529, 353
+L303: .data 158, 581, 164, 551, 991, 58, 711, 140
+L304: .string "nsxvgwtce"
+red L255
+inc L221
+L305: .string "vhhuqff"
+add #57, *r2
+L306: .string "pxyqtfykiwsfhtcaexzlehbv"
+L307: .string "ybf"
+L308: .string "yxnoodxglfpshzayzlnv"
+L309: .data 979
+L310: .string "qkebci"
+red *r1
+L311: .string "cjmzyyakuvmotvaatezheuwj"
+L312: .string "ioqjchbodnrbnd"
+L313: .data 357, -956, 477, 293, -56
+
+red L184
+L314: .string "ycnksoc"
+L315: .data 663, -839, 346, 974
+L316: .data -517, -525, 492, -138, 885, -710
+stop
+
+
+L317: .data 764, 588
+L318: .string "sflwhbycyfbronmchxzyui"
+L319: .data -972, 519, -674, -39
+jmp L142
+
+mov r6, *r0
+L320: .data 183, 129, 503, -985, -567, -153
+L321: .string "dvdqjyikdey"
+mov r4, *r0
+dec L6
+L322: .string "ippo"
+L323: .string "tnf"
+L324: .string "ufnkykrznejrcunnxqkoad"
+jsr L186
+L325: .string "nsdmstm"
+L326: .data -757, -751, -687, 967, -556, -866
+dec *r2
+mov r0, *r5
+L327: .string "zwmosqsfnkgd"
+bne *r3
+L328: sub #109, L224
+rts
+not L300
+sub L331, L329
+L329: .data 28, -977, 790, 707, 300, -371, 865, 365
+L330: .data -724, -401, 768
+L331: .string "xidctazolqpiwdsz"
+inc L212
+prn L151
+sub #-124, *r2
+L332: .data -639, -203, 205, -95, 622, -299, 496
+L333: .data -515, 585, -345, -130, -450, 458
+stop
@@ -0,0 +1,524 @@
+; Generated by genCorpus --seed 43
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: .data 321
+dec r3
+L1: .string "wwzizocez"
+clr L265
+red r0
+L2: .data -316, 865, -912, 831, -764, -486, -600, -553
+sub r6, L0
+L3: .data 335, 986, 340, -273, -885, 341
+L4: .string "onlwhbfxjfjuqmdocv"
+L5: .data 310, 409, 330, 163
+L6: .data -147, -288, 382
+L7: .data 159, -373, 942, -292, -577, 238, -21, -554
+L8: .data 78
+L9: .string "x"
+L10: .data -163, -128, -485
+L11: .string "fdwyoqbhyujazpwaoquw"
+L12: .data -16, -581, -188, -617
+L13: .data -370, -27
+L14: lea L8, r6
+L15: .data -292, 556, -873, 320, 257, -17, 707
+L16: .string "lhpjvld"
+jsr L0
+rts
+bne *r7
+L17: .data 324, -27, 931
+L18: .string "trejvcv"
+inc r4
+L19: .string "lej"
+rts
+inc *r7
+L20: .string "ucovgqqkbibinnaqaldyd"
+L21: .string "znvqsdvizgkbcpispydcixs"
+L22: .data 790, 145, -622, 159, 819, 604
+L23: .string "abxmu"
+L24: .string "mtpjnmphqgvmdef"
+L25: jmp *r4
+L26: .data 944, 439
+L27: .string "zvngvlfowfpgi"
+; comment
+L28: jsr L18
+L29: .data 463, 568
+L30: .data -790, 531, -394, 514, 229, -588, -616, -311
+L31: .string "cj"
+L32: .string "ghublensch"
+; comment
+L33: .string "yjuhgbdjnymwufdihz"
+L34: mov L1, r2
+L35: .string "qioznic"
+
+L36: .data -352, -563, 741, 155, 908, 260, -288
+L37: .string "lgijzfishzynnacpy"
+L38: .string "wrpvsrmguhnxewhtyn"
+jmp *r2
+add r6, r6
+L39: .data 140, 80
+L40: .string "ayveh"
+L41: .data -180, -261, -738, -912, 265
+L42: .data -190
+L43: .string "jlfcxvunoyfgabxecpc"
+L44: .data 56, -770
+bne L39
+add *r2, L42
+L45: bne *r0
+L46: .string "qxxwlilxupphhgy"
+cmp #-113, *r6
+L47: .string "ubneogmr"
+L48: .data -71, 353, 745, -418
+jsr *r4
+L49: inc r2
+jmp L146
+rts
+L50: .string "z"
+L51: .data 247
+L52: .data -551, -661, -139, 295, -424, 142, -906
+clr *r2
+L53: .string "zmel"
+L54: inc *r3
+rts
+L55: .data 782, -77, -462, -319, -872, 647, -402
+L56: .string "gnzesscimco"
+rts
+sub r1, r3
+L57: .data 502, -152, 627, 887, 985, 988, -742, -822
+L58: .string "zbninmoljof"
+L59: .data -435, -552, 988, 570
+L60: .string "ddkqovfhvkbiyxcdtxtcaotc"
+L61: prn #-203
+sub *r3, r7
+L62: .string "epmbkmicayephgtuqmgp"
+stop
+L63: .data 467, -769, -957, -990, 444, 267
+L64: .data -906, -474, 765, 312, 577, -782
+L65: .string "rsxiepbfyrgeb"
+L66: .data 726, 30
+sub L25, L24
+L67: .data -140, -446, -238, 715, 992, -330, -79, -154
+L68: .string "a"
+
+; comment
+stop
+cmp #-16, #-64
+L69: .data 445, 556
+L70: .string "ynudl"
+L71: .data 348, 756, 140, 995, 818
+L72: .string "auruitsttaj"
+L73: .data 0
+clr L124
+rts
+L74: .string "zgdjptl"
+lea L176, *r2
+prn r1
+L75: .string "aiuevy"
+L76: .string "vttihpqlcuaghzfw"
+
+L77: .string "wmpjqsogpwgsidfypxjfbg"
+L78: .string "mehajfclbqxnwxbyzdnbls"
+clr r5
+L79: .string "qddzsjdyjudggiaoxqjjoflu"
+L80: .data -430, 622, 368, -985, -398, 126
+L81: .data -562, 393
+L82: jsr *r4
+inc *r1
+L83: .data -782
+L84: .string "izrleplfrlguubaurm"
+L85: .string "jtuonplooihxvapkzhc"
+sub L187, L13
+not *r1
+L86: prn *r4
+L87: .string "hncjrbbdbaiarx"
+L88: .string "clidden"
+L89: .data -10, 815, 99, -532, 507
+jsr L292
+L90: .data -240, -794
+L91: inc L279
+
+sub #-107, r1
+L92: .string "zkgcessv"
+L93: .string "oqrnytllpospawthlw"
+bne L63
+L94: .string "nabncf"
+red *r2
+L95: not *r6
+jsr L110
+mov r2, r2
+L96: red *r4
+lea L219, L181
+L97: .string "dwers"
+L98: bne *r5
+L99: .string "jmfbhyltumtmldixcshiqr"
+L100: .data -999, 347, 901, 503, 621, -344, 544, 449
+L101: .data 361, 970, 360, 862
+L102: .string "xlmdejkyuickv"
+L103: .string "keimuouxafasgtrf"
+L104: cmp #-126, r0
+L105: .string "iwwoduostbbfq"
+L106: .data -721, -729, -586, 201, -136, 154, 569
+
+L107: .string "v"
+L108: .string "ymsugeajqjnaxjzpdeinf"
+L109: .string "cuqqinpjpkx"
+L110: .string "slqtfxx"
+L111: .data 658, -168, -391, 923, -824
+L112: .data -642, -26, -378, 444, 520, 565, 976
+; comment
+L113: .data -447, 359, -71, -146
+L114: .data -179, 867, 887, 656, -376
+rts
+jmp L54
+L115: .data 625
+lea L169, *r6
+clr r7
+L116: prn L46
+jsr *r2
+L117: .data 850, 955, 330, 551
+L118: .string "vzrnxrxktnllkd"
+bne *r3
+L119: .data 984
+add #-88, r4
+L120: red r2
+L121: .string "dwhanrakiqrbhfog"
+L122: .data -755
+cmp #105, *r3
+prn #74
+L123: stop
+L124: .data 633, -515, -214, -968, -983, 552, -565, 736
+L125: .data -905, -497, 448, 480, -849, -260
+dec *r6
+L126: .data 241
+L127: red *r3
+L128: .string "lgrghsapwnysnjtynkaxhzj"
+L129: .string "dc"
+L130: .string "cbviewexeknrrw"
+L131: .data 579, -720, -40, -86
+L132: .data 208, -430, 533, -412, 408, 165, -887
+jsr *r7
+prn L40
+L133: .data 882, 667
+L134: .string "sfg"
+L135: .string "uoflrsvnjlctatedxyg"
+L136: .data 770, 597, -406, -440, 557, 100, 49
+not r2
+add *r1, r7
+jmp L116
+stop
+prn r1
+L137: .data -655, -261, 924, -52
+L138: .data 219, 493
+L139: .string "htlsza"
+L140: .data 267, -971, -153, 945
+L141: .data -744, -339, -223, -300, 221, 390, 467, 191
+; comment
+L142: .data 294, 211, -655, 355
+stop
+L143: .data 323, 389, -984
+L144: .data -186, 791, -51
+
+stop
+L145: .data 324
+bne L63
+L146: .string "fn"
+dec L34
+bne L53
+L147: .data -871, 500, -593, 545, 949
+rts
+L148: .string "iejq"
+L149: .data -73, -701, 144, -654, -658, 371
+L150: .string "hbzafvnvxvnc"
+L151: .data -628, -544, -140, 978
+cmp #-202, *r5
+; comment
+L152: .string "tikohjuxqzwogkmtfhghynd"
+L153: .string "nfun"
+L154: .data 234, -470, 128
+L155: .data -188, -362
+L156: .string "jjdimwhphtjmqyfaq"
+cmp *r3, L146
+L157: .string "bltgxghsqpzli"
+L158: jmp *r4
+L159: .string "m"
+L160: .string "tdpghcyxovwaklygomwzmww"
+mov *r6, L263
+L161: .string "kxfedj"
+prn #-226
+L162: .string "zvb"
+L163: .string "lmwhjkzrqvmtlaus"
+cmp #155, *r6
+jmp L69
+bne *r1
+L164: .string "hdtihygdkrgmbr"
+L165: .string "zmvpsobtkuctr"
+cmp *r4, L17
+stop
+L166: .string "bgm"
+L167: .data 851, 191, -447, -973, -70, -16, 839, 15
+lea L152, *r7
+L168: .string "bvasifk"
+L169: .string "dsfsdtwoiwutjfminvyhn"
+L170: .string "humwudamo"
+L171: .string "yln"
+jmp L336
+L172: .data 139, 865, 224, 137
+L173: .data 354
+L174: .string "cbmjbfkkdsbqqrttfxza"
+L175: jmp L38
+L176: .string "ipfokpboaqty"
+; comment
+L177: .data -210, -724, -764, 248, -91, -807, 523
+
+L178: .data -718, -794, -125, 402, 265, -358
+L179: .string "rmrhoniylin"
+L180: .string "ramuyyvoclhbcrrgnq"
+L181: lea L102, L324
+L182: .string "sfhxnduyqhbnjq"
+L183: .data 221, -581, 956, 318, -429, 971, -874
+L184: .data 620
+L185: .string "winzifiwlzgv"
+L186: .data -915, -59, -764, -898, 373, 822
+L187: .data -69, -324, 282, 105, -477
+not *r3
+L188: .data -148
+L189: .data -862, 994, 310
+jsr L28
+L190: .data -267, 540, -215, 866
+L191: .string "prffn"
+L192: .data 625, -282, 202
+sub #188, L93
+L193: .data -11
+L194: .string "slzqmqc"
+L195: .data -927, 19
+add L134, r4
+add L132, r2
+L196: .data 873
+L197: .data -466, -145, -372, -50, -742, 804, -219
+not r4
+L198: .data 840, -808, 29, -386, 683, -505, 339
+rts
+L199: .string "kz"
+L200: .data 489, 893, 942
+L201: .string "ahzsxb"
+bne L157
+not *r6
+L202: .data 327, 165, 745, -516, 568
+L203: .data -902, 874, -453, -432, -519, -697, -950
+prn L197
+L204: stop
+sub L229, L196
+L205: .string "vbkwius"
+L206: red L82
+L207: .data 820, -322, -7, -584, -934, -540, -283, -439
+L208: .string "rknogwdmyviubkcwiolexojh"
+L209: .data -385, 638, 242, -690, 409, 307
+stop
+inc L320
+L210: .data 962, -74, 606, 168
+L211: .string "lawvnbicqpsgmndrstfcyx"
+L212: .string "caaftnj"
+bne *r0
+L213: .data -907, -87, -681, 841, 154
+jsr L162
+L214: .string "fj"
+not L243
+L215: .string "esdohmndjnwbquxphzemmt"
+L216: clr *r2
+L217: .data -942, -264, -40, -86
+jsr L243
+L218: .string "kgwncprmrzrrybqhnwsolh"
+L219: .string "sdbxn"
+L220: .data 292, -367, -642
+L221: .data 683, -58
+L222: .string "tagllhl"
+L223: .string "pbzqspyksgcolnjo"
+not *r1
+clr L255
+stop
+jmp *r7
+L224: .data -80, -282
+L225: .string "sunlaid"
+L226: .data 599, 587, -994
+L227: .string "xuikgqebqbgwprzgm"
+L228: .string "frfrz"
+L229: .data -237, -123, 236, -741
+bne *r7
+L230: .string "rqzzlanrx"
+not *r4
+cmp *r4, r6
+L231: .string "zqtyxgbqusanhgwh"
+L232: .string "raddwzftuk"
+L233: .data -762, -905, 985, 793, 991, -37, -774, 453
+L234: .data -634, 505, 439, 721, 843
+L235: .string "kxhwimclkqyrrmibszm"
+L236: .data 548, 232
+inc L125
+add L278, *r6
+L237: .data 286, -150, -908, 212, 48, -122, -335
+L238: .string "rhgclhxnlnhothui"
+L239: .string "rvaodeo"
+L240: .string "ebghmtelwgcfnwhmmrzp"
+L241: .string "serrqigcxlwkhpzvjkxtlm"
+L242: cmp #229, *r5
+
+prn L323
+lea L85, *r2
+add *r2, L265
+L243: .data -812, -344
+L244: .string "laek"
+L245: .string "zbtqpdgmiy"
+clr L308
+L246: .data -552, -50, 787, 435, -575, 885, 915
+rts
+lea L282, L70
+L247: .string "jainpdxkiqrgjwvbsutregsg"
+inc *r0
+L248: .data -581, -936, 367, -624, -64, 73, 356
+L249: .data -202, -71, 100, -683
+L250: .data -509, -84, -340, 262, -928, 961
+red *r7
+rts
+L251: .string "utfwjjledlhhueyupok"
+L252: .data -280, -203, 738, -231, -703, 866
+L253: .string "tjhogzcmjkgkcogvncw"
+L254: stop
+red *r4
+L255: .data 809, 193, -584, -643, 246, 91, 479, 286
+L256: .data 886, 541
+L257: .data 411, 734
+jsr *r2
+L258: bne L335
+stop
+L259: .data 554, 712, 268, -428
+
+L260: inc L36
+L261: .data 562, -971, -859, -917, -632, 973, 153, -156
+L262: .data 613, 58, 381
+jsr L314
+L263: .string "jwvcahkdgvsy"
+L264: bne *r3
+L265: .data -726, -540, -1000, 436, 888, 379, 565, 349
+L266: .data -604, -176, 749, -953, 649, 375
+L267: .string "isihqds"
+L268: .string "ouanblyzoo"
+clr *r4
+rts
+L269: .string "vubfxovlergsads"
+L270: .data -227, 314, -765, 161, 914, 473, 586
+jsr *r6
+L271: .string "ujczrvigbswet"
+L272: .string "kcsyailz"
+dec r1
+L273: .data -990
+stop
+prn *r0
+L274: clr L284
+L275: .data 995, -906, -402, -694, -659, 475, -866
+L276: .data 230, 648
+; comment
+add L286, r2
+L277: red *r2
+not r2
+L278: .string "wrwyzbugxlefxhgwsj"
+; comment
+L279: clr r6
+lea L303, L276
+L280: .data 588, 233
+L281: .string "gfobuzmlvqqmdehsypmqxq"
+
+L282: .string "fpstb"
+L283: .data -779, -110, 547
+L284: .data 333, 323, 943, 481, 91, -104, -16, -971
+jsr *r3
+L285: .data 59, 504, -533
+L286: .data 728, -768
+L287: .string "ckyxenvkbtdnmqmcsjtxs"
+
+stop
+L288: .data -870, -82, 75, 260, -929, -916
+L289: .data 571, 299, 588, 601, -390, -241, 736
+add *r0, *r6
+rts
+L290: .string "vqsxdurnrlxpn"
+L291: .data 165, 358, 49, -618
+lea L155, r1
+L292: .data 42, 819, 1, 988, 201
+L293: .data 395, 257, 513
+L294: .data -750, -527, -214, -147
+L295: .string "wbaaovuehuizzdgu"
+L296: .data 739, -344, -663, 684
+jmp L329
+L297: .data -237, 730, -352, -354, -937, 305, 28, 307
+L298: .string "nxjpvhz"
+L299: .string "wdxoegimdzydkevlczytugbl"
+L300: .string "wtmnnpzyterpx"
+L301: .string "mn"
+lea L321, L16
+L302: .data -485, -76, 360
+L303: .data 116, -708, -701, 250
+L304: .data 194, -626
+L305: .data 674, 809
+L306: .data -227, -694, 406, -134, 110, 937
+sub r5, *r2
+L307: prn *r1
+; comment
+L308: .data -175, 413
+L309: .string "i"
+L310: .data 835, 361, -809, 164
+L311: .string "pydbpuedcdug"
+L312: .string "iwyjngmfz"
+L313: cmp #-129, L49
+L314: .string "lraxgugfswokxjajur"
+cmp r2, r7
+L315: prn L170
+L316: .string "mrjgri"
+red *r5
+L317: .string "waau"
+red L316
+L318: .string "ekki"
+L319: .string "mfgvte"
+L320: prn r2
+L321: .data 51, 535, -36, 295
+L322: .data -993, -200, 176, 14, 38, -258, -490
+L323: inc L199
+L324: .data 174
+jmp L131
+inc r0
+red *r5
+L325: .data 949
+L326: .data -712, -129, 499, -116, 109, 407, 639, -938
+L327: .data -241, 295, 327, -474, 71, 575, 745, -503
+L328: .data 944, 873, 260, 421, 480, -667, -384
+inc r4
+L329: .data 980, -319, 330, -593, -555, 117
+L330: .string "hqvaztbfbbsgw"
+L331: .data -546, 539, -475, -638, 223, 767
+L332: .data 793, -173, 666, -909, -348, 235, -753
+
+L333: .data 735, -392, -776
+L334: .data 916, 399, 605, -391, 114, -164
+L335: .string "kfoqiilhxs"
+L336: .string "gbcbrqimyeyemeggsvbqc"
+red *r0
+not r0
+stop
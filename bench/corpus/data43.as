@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 44
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+
+prn #-152
+L0: .data -908, 810, -970, 626, 85
+sub *r7, *r1
+L1: .string "ewbq"
+L2: .string "ghpbnqqiwuctjknwrsiosys"
+L3: jmp L2
+L4: .string "femfwsjn"
+add *r0, *r2
+L5: .string "yfqqqmsz"
+L6: .string "yvdua"
+L7: .string "nfygszdycoumg"
+inc *r4
+bne L3
+jsr L3
+jmp L0
+stop
+L8: .string "cwkx"
+prn L8
+L9: .string "ujkftobpngn"
+bne L8
+L10: .string "dmzxzunhgebr"
+mov #-105, *r5
+sub *r2, L131
+L11: .string "vjzhxnmxablarmc"
+dec *r3
+L12: .string "bhaylsgq"
+cmp #-59, L12
+L13: add r7, L229
+prn #-89
+stop
+L14: .string "tiqkpxhuclifraptvgeq"
+lea L298, *r5
+
+rts
+mov r7, *r0
+L15: .data -372, 426, -757, 409, -565, 615, -994, -351
+L16: .data -871
+L17: .data -976, 446, 722, -712, 120
+L18: .string "osakiset"
+L19: .string "jvhzob"
+jmp L13
+L20: .string "xhiryatjdnzid"
+not *r0
+L21: .string "execu"
+L22: .data -378, -703, 616, -52, -464, -663
+L23: .data -667, -569
+L24: .string "suwfetxtxwcraaxrkevb"
+prn #148
+jsr *r2
+L25: .string "dvccjykeajmptedvli"
+cmp #-129, *r0
+L26: .data 118, 18, 884, -561, -562, -682
+L27: .string "lwc"
+L28: .string "fblayomfkr"
+L29: .data 40, -768, 439
+red L156
+L30: lea L309, r3
+cmp #180, *r4
+L31: .string "jvonwy"
+L32: .string "qoiafbowvuhawg"
+rts
+inc L115
+L33: .string "fdslgqyskeyrqqolblbny"
+L34: .data 566, 656, -613
+jmp *r1
+L35: .string "odhqvvoijteg"
+
+L36: .string "eyytr"
+; comment
+L37: .string "ppeqpzb"
+L38: .string "qcfethtxhxjfsgnsntn"
+L39: rts
+L40: .string "ggow"
+L41: .data -400, 667, -567
+mov #-27, L40
+L42: .data -137, -752, -20, -508, -530
+L43: inc r1
+L44: .data -978
+L45: .string "hhczkfilqxagcneuoamevh"
+L46: .data -381, -299, 685, -615, 340, -425
+L47: .data -928, -894, 609
+L48: .string "chlb"
+L49: .data -818, -240, 237, 622, 295, 741, -541
+L50: .data 383
+L51: .data -974, 984, 119, 820, 547, 323
+L52: bne *r0
+L53: .data -614, 744, 351, -265, 785, 975, -324
+L54: .data -198, -66, -466, 199, 384, -584
+inc L37
+sub L10, L25
+L55: stop
+L56: .data 847, 518, -760, 611, 318, 833, -329, 545
+jmp *r2
+prn *r0
+L57: .string "vqmrbhl"
+L58: .data -760, 988, 465, 297, -446
+L59: .data -986
+L60: .string "qaxpyvnh"
+L61: .string "cyjtmpgchlgi"
+red L49
+L62: .data 416, 753, 878, -708
+L63: .string "heyxmtcogtyffx"
+stop
+L64: .string "aowknqmxgpraqnouzev"
+red r7
+cmp r5, L321
+L65: .string "kntkgzupkgre"
+inc *r2
+clr *r5
+L66: lea L287, r0
+L67: .string "rzexkszdluiewiqfatayvaa"
+prn #142
+L68: .string "iicdxyvtawq"
+prn L2
+stop
+L69: .data 239, 302
+L70: .string "uqphc"
+L71: .data -806
+add r2, r5
+add #-70, *r1
+L72: .data 777, -568, -545, -770, -731
+rts
+L73: .data -194, 323, -316, 292, 37, 791, -314
+
+L74: .string "sqqwx"
+L75: rts
+jsr *r3
+L76: .data -374, 712, -507
+L77: .string "ckpqdminmts"
+L78: dec r5
+L79: .data -434
+clr *r6
+cmp L22, r5
+inc r5
+L80: .string "obeupgeuxobxslpywqwlbxb"
+add #66, r2
+prn L256
+L81: .string "abmchshdnstbdcykqlnrv"
+L82: .data 932
+stop
+L83: .data 253, -826, -654, 452
+L84: .data -886, -83, -223, 648
+bne *r1
+L85: .data -494, 839, -370, -261, 515, 784, 110
+L86: red *r6
+L87: .string "uezmffjm"
+dec L76
+L88: .data -738
+L89: .string "f"
+L90: dec *r4
+jsr L22
+L91: .string "zsvvsaqrvjbfuznnguyaqqz"
+L92: .data 123, -999
+L93: .string "falauwmfwb"
+L94: .string "zbeolicoooasnaohupfvoqa"
+jsr L25
+L95: .string "pglharmniirmabc"
+L96: .data -307, 173, -248, -851
+L97: .data 990, -534, -874, -947
+L98: .data -836
+L99: .string "asc"
+L100: mov r0, r2
+L101: .string "pwcrrocxoabvc"
+add r6, *r2
+L102: .string "urmnwilvfrjxplx"
+L103: .string "wslqayhgxjtxozwth"
+L104: .string "lkvmtdyaytbdsbxnumehn"
+L105: .string "vfnvmceyrazydu"
+rts
+not L101
+L106: .string "nlgebeslqzvuoo"
+L107: .data -338, -994, 793, -987, 57, 577, -682
+L108: .string "oxutnlbnvmqdexdraflcyu"
+L109: jsr L1
+L110: .data 385
+L111: .string "jrfaityumswrrjhcmuhi"
+bne L106
+clr r4
+L112: .string "nehrdpguvv"
+L113: .string "jzzbofznzq"
+stop
+L114: .data -221, 551, 652, -508, -33
+rts
+stop
+L115: .string "wmadcmsyjtlwlyyjyxejj"
+L116: .data 324, 746
+inc L54
+L117: .data 878
+L118: .string "neqhetaekngrynxhxxsevaof"
+L119: .string "koxapxejpiqh"
+jmp *r3
+L120: .data 543, -289, -704, 607, 347
+jsr L5
+L121: .data 472, -12, -667, 84, -415, -743, -771
+L122: .data -524
+L123: .string "axydqgmlfuivdrsdylxegsjp"
+L124: .data 697, -673, -1000, 198, 958, 673
+jsr *r1
+L125: .string "lsovxditrhtlsy"
+
+jmp *r5
+L126: .string "qywjehjwfvlfgycpsqml"
+stop
+L127: .data 336, -219, 314, 79, -110, -533, -799
+L128: .data 829, -120, -920, 230
+L129: jsr L317
+L130: .data -211, -664, 467, 571, 77, 726, 895, 871
+L131: .string "wymgmimdgtnlll"
+L132: .string "nifogvjvmecqmoi"
+L133: .string "sbeuenrztxm"
+mov *r2, L52
+cmp #-177, *r4
+L134: .data -215
+L135: .data -78, -362, 970, -72, -976, -970, -402
+not L158
+L136: .string "zcmdyigy"
+mov #19, L188
+L137: .data -853, 947, 268, -1, 397, 294, -737
+prn #210
+rts
+L138: .string "oexrpdsaghbpiug"
+L139: .data -4, -879, 443, -879, -18, -538
+L140: .data 42, 268
+L141: .string "pfpdmuuactfvqwyyp"
+L142: .string "fyouzrbvlldfenpows"
+add r6, *r1
+L143: .data 395, -108, 665, -499, -144, 141, 192
+L144: .data 518, 310
+L145: rts
+jmp *r1
+stop
+L146: .string "icxypzbhyrjitwkcsafnr"
+L147: sub r2, r0
+L148: cmp r4, #190
+L149: .data -429, 245, 400
+L150: .data -252, -103
+stop
+L151: .data 942, -28, -683, 221
+L152: .string "dbssfdz"
+L153: .data -857, 950, -123, -646, -703, -16, -3
+inc r3
+L154: .string "am"
+L155: .data 393, 377, 758, -544, 158
+bne *r2
+stop
+; comment
+prn r0
+L156: .data -435, -263, 799
+L157: .string "pkpbc"
+L158: .string "oyw"
+red r0
+L159: .string "rqpntpkikrkjccjjcnrr"
+; comment
+rts
+L160: .string "sainlshpohaequl"
+L161: .data 818, 565, 132, 523, 159, 243
+L162: .string "nlwcgkozbrp"
+L163: rts
+add L67, *r2
+L164: .data 994, 43, 506, -670, 434, -733
+stop
+L165: .data -875, 604, -344, -309, -339, -452
+L166: .data 269, 525, -700, 786
+bne *r5
+L167: .data -808, 602, -739, 759, -38, 575, -660
+L168: jsr *r2
+mov L314, L309
+add L323, L163
+L169: .data -970, -797, -176, -522, -747
+L170: .data 988, -878, 579, -726, -159, -955
+L171: .string "ndlwyqebcujjmhg"
+L172: .data -68, -492
+bne L189
+clr L318
+L173: .data -526, -235
+L174: .data -147, 748, 793
+L175: .data 609
+L176: .string "cojcngwzsfmxkigw"
+jsr *r6
+lea L264, r1
+L177: .string "fwetcgpsphyovp"
+lea L57, L246
+L178: .data 170, 204, 609, -89
+L179: .data 28, 986, 863, 704, 326, 558, -87
+L180: .string "xsijeioqicvd"
+jmp L28
+L181: .string "qytupngkilqklhtvuqpf"
+L182: .data -381, -236, 227, -144, -988, 100
+bne *r5
+sub L16, r7
+L183: .data -418, 799, 654, -381, -157, -105
+L184: inc r5
+rts
+L185: .string "ncnmvpasaqb"
+L186: lea L5, L254
+stop
+lea L295, *r7
+prn r5
+L187: .data 67, 449, 690
+L188: .string "ufdqwciy"
+L189: .data -290
+prn *r0
+L190: .data 847, -760, -211, -8, 291, -755, -593, 588
+lea L216, L175
+L191: .data 789, -116, -278, 45
+L192: .data -138, -618, -160, 528, -983, 89
+L193: .data -458, 589, 912, -478, -216, -295
+
+L194: .string "lrnma"
+L195: .string "x"
+L196: .string "yscodfaxlvsabuhekzoxx"
+dec r6
+L197: .data -342, 327, -43, 210, -476
+L198: .data -3, -398, -557, 997, -251, -300
+
+L199: .string "uwyfcdofrykygjp"
+add L195, r3
+L200: .string "pfh"
+L201: .string "rzuobrilsligwmjnmuiefyy"
+L202: .string "lkwuzophypxtlclzwe"
+L203: .data -291, -805, -703, -28, 570, 666, -228, 541
+prn *r0
+L204: .data 8, 257
+add *r3, *r6
+jmp L192
+L205: .string "hggkciapmbmoxenxo"
+L206: dec L265
+L207: .data -248, -939, -845, -220, -734
+L208: bne L57
+L209: .string "hewmkfmjjlicpic"
+L210: .string "ub"
+rts
+L211: .string "kldj"
+L212: prn L295
+L213: .data 723, -605, -823, -623, -287, 369, -505, -801
+sub #-142, r7
+L214: .data -141, 754, 820
+L215: .string "nrbdinqblndtedeusxwinanz"
+L216: .string "eparxigl"
+jsr *r2
+jsr *r2
+L217: .string "qqmkk"
+mov L8, L17
+jmp *r0
+L218: .string "xvsgyrxzxijumwdegmu"
+L219: .data 933, 63, -509, 123, 975, -488
+bne L135
+L220: .data 571, -968, -85, -967, -786
+rts
+L221: .string "tiygheylsncpxo"
+jmp L225
+L222: .data -467, 354, -924, 30, -486, -367, 476
+L223: .string "bezlsxungtwgkzlz"
+L224: .string "opvm"
+L225: .string "vtiabqvtlpjsllwgbno"
+L226: .string "hpram"
+L227: .string "lomhgvt"
+L228: .string "eplyczuzzhguzyvizwms"
+L229: .data -478, 246, -250, -574, -577
+clr *r2
+sub #177, *r4
+L230: .data -8, -896, 515
+stop
+cmp *r7, r4
+L231: .string "xfgvoahlbrtcwd"
+L232: .string "az"
+L233: .string "bgkqwlfzwelwtziljzehamxs"
+L234: .string "zgyqecnqmdais"
+L235: .data 134, 331, 341, -161
+dec L270
+lea L184, r1
+red *r1
+cmp #-86, *r0
+not r3
+L236: .string "mmlhromrkxbvju"
+L237: .data -295, -438, 28, -518, 375
+dec *r7
+L238: .string "rqdygw"
+L239: .string "ehey"
+L240: .data 990, 721, 885, -368, 636, -156, -841, 842
+L241: .string "bsbcnorkfxumxobfx"
+L242: .data -645
+L243: .string "eqf"
+L244: .data -618
+
+L245: .data -202, 898, 807, 298, -611, 333, 461
+L246: .data -220, 443, 227, -56, -41, 559, 363, 496
+L247: .data -994, 648, -337, -293, 976, -427, -79, 319
+red L283
+L248: .string "psxghpfmmzpsmwevdiv"
+L249: .string "hrqcl"
+L250: .data 836, 122
+L251: .data 948, -628, -218, -360, 800, -159, -285, 761
+L252: .string "zcqjbwjbvrmimiuvhhkhezt"
+L253: .string "ezn"
+
+L254: .data -940, 889, -46, -245, 846, 789, 724, 654
+not L93
+L255: .data -190, -37, 368, -173, 836, -241
+L256: .string "omzwbydfcaoop"
+L257: .string "dsqmbolycojbdlbsctejwigt"
+L258: .string "bxngjlpcs"
+L259: .data 951, 349, -960, -388, -907, -896
+jmp L80
+L260: .data -153, -204, -389, -61
+L261: .data -778
+red L249
+L262: .data -888, 45, 746, 813, 907, 581
+
+L263: .data -361, -652, 714, -431
+not r2
+L264: .string "tyfvekkjjznlvht"
+L265: .data 910, -286, 112, -787
+; comment
+dec r2
+L266: .string "kodanplhsstbnhsuaftevhvx"
+L267: .string "gcpheankfpx"
+; comment
+; comment
+L268: .data 628, 253, -438, -505, 557, -403, -238, 197
+L269: .string "biltwphiwjll"
+L270: .data 747, -10, 240, 335, -424, 781, 382
+L271: .data 135, 371, 747, 531, 947, -344, -899, 589
+L272: .data -749
+L273: .string "slrhgr"
+L274: .data -715, -888, 968, 737
+L275: clr r5
+bne *r2
+L276: lea L155, L294
+L277: .data -566, 920, 56, -831, -199, 225
+L278: .string "qjhhpyfcslkgmja"
+L279: .string "xcjtjielyktwcz"
+jsr *r6
+L280: .data -447, -371, 786, -607, -890, 175, -572
+L281: .string "ifajnsuisedqxl"
+L282: .string "vcjuqycfwgvhdxfkujoqfefl"
+stop
+L283: add *r4, *r7
+; comment
+L284: .data -786, 892, -842, 551, -266
+L285: .string "aypwfganpwxh"
+L286: .string "wygecledrj"
+L287: .data -292
+L288: .string "grmwntjkvqqoonfa"
+red L173
+L289: .string "jjuzc"
+L290: .string "eglllzftphvt"
+L291: .data 119
+L292: .data 558, 297, -233, -973
+L293: .data -514, 431, -8, -955, 102, 662
+L294: .string "ekdyzteuwjavelrrf"
+L295: .data 153, 122
+L296: stop
+L297: .string "alphykepnsxtxjxzg"
+L298: .string "wcdvymbwbjklttfauq"
+L299: .string "jnjclaer"
+inc *r6
+lea L7, r3
+L300: .string "wajdcqkckijuidqrlhi"
+rts
+L301: .data 615, 232, 760
+L302: .string "vtvudsaobmbkrjztiwhshy"
+L303: .data -931
+sub #-240, *r6
+L304: .data -41
+L305: .string "t"
+clr r7
+L306: .string "goyhgjxbjc"
+L307: .data -45, 166, 685
+L308: .string "efwxbihf"
+rts
+L309: stop
+L310: .data -893, 199, 131, -207
+L311: .string "djqibh"
+lea L314, r1
+L312: mov #-175, *r5
+L313: .string "koltrmpx"
+L314: clr r3
+L315: .string "fcncadgbmjdrsbnclz"
+clr *r4
+dec *r3
+L316: .data -994, 226, -485
+dec *r6
+mov r4, r7
+L317: .data -718, -80, 379, -271, 544, 131
+L318: .string "n"
+L319: .data 973, -288
+L320: .string "pcxjqe"
+L321: .data -638, 386, 697, -960, -69, 542, 308
+cmp L258, L322
+L322: .string "snnhao"
+L323: .string "tahg"
+L324: .data -311, -457, 813, -780
+not *r4
+red L126
+L325: .string "stw"
+cmp L326, #-143
+
+L326: .data 415, -694, -924, 136, 619, -108, 557, -459
+stop
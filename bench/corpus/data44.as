@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 45
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: sub #28, *r3
+L1: .data 900, -73, -498, 749, 183, -31, -152
+L2: .string "mjqbhsmowuizgnsmr"
+stop
+sub L1, L2
+L3: .string "nhrbabhocqojp"
+L4: .string "hjxmiawyjlfbsiheebvjrplt"
+L5: .string "naglnvunzhoboffkp"
+L6: .data 480, -870, -530, 937
+L7: .string "ewyrfottiihqsuivihgidpcw"
+L8: .data -212, 701, 189
+L9: .string "pv"
+inc r7
+L10: .string "s"
+clr L66
+red r3
+prn L0
+L11: .string "debvulaboxdbwptkt"
+L12: .data -784, -502, 435, -91, 73
+mov r2, *r3
+L13: .string "h"
+L14: .data -687, 878, -482, -792, -857, 947, -572, 477
+L15: .string "w"
+jsr *r6
+L16: .data 826, 88, -708
+L17: .string "d"
+L18: .data -202, 477, -63, -594, -76, 573, 251, -696
+L19: .data -305, 239, -195, 564
+L20: .data -811, -166, 462, 40, 177, -443, 996
+L21: .string "vfvaueqll"
+prn *r3
+L22: .string "vlpivofc"
+L23: .data 918, -538, 496, -306, 339, -361, 569
+L24: .string "yvkcjk"
+lea L233, r6
+red L19
+L25: .string "rjylyhawpuoiejjvqvre"
+L26: .data -597, -463, -3, 860
+L27: .data 266, -249, 533, -831, -108
+L28: .string "bokzvzpkvjcbgkzwfwbi"
+L29: .string "ffogxltakheyikqbl"
+L30: .string "sgfiszgifbbeutnj"
+clr r6
+L31: .string "unxcwfegypgxshovrgqxps"
+L32: .string "efrigtrqyjqdcvza"
+L33: .data -749, -88, 778
+L34: .string "zuderkyqnavogfie"
+L35: .string "ovba"
+L36: .data -696, -505, -263, -962, 378
+L37: .data 668, -862, 948
+L38: .string "ejzumeczol"
+L39: .data 566
+clr L248
+L40: .data -98, 333
+L41: .string "mjlrhgql"
+L42: .data -740, 157, 373, -944, 880
+L43: .data 951, 250, 404, 953, -963, 734, -355, -176
+L44: lea L160, r0
+L45: .string "qcabe"
+L46: .data 634, 735
+rts
+L47: .data -830, -629
+L48: .string "fivtcc"
+cmp #137, r1
+red r4
+rts
+jsr L47
+L49: mov L327, L75
+cmp #164, *r0
+not *r6
+L50: .data -849, -442, 31
+L51: .data -540, -239, -142
+L52: .string "xgtj"
+L53: .string "bihthqlt"
+mov r1, *r0
+L54: jsr *r4
+L55: dec L205
+L56: .data -786, -990, -533, -598, -951, 709, 863, -464
+L57: .data -736, -925, 960
+L58: .data -616
+L59: .data 371, -455, 655, 935, 650, -369
+L60: .string "zombbmmqdvidgdbb"
+bne *r7
+
+L61: .string "pwmwtc"
+clr L18
+L62: .string "hxssqrr"
+L63: .data 537, -105, 680, 431, -244, -123, -251, -18
+
+stop
+sub *r4, *r5
+cmp #193, r7
+L64: .data -90, 112, -757
+L65: .string "vkzihchrroq"
+bne L234
+L66: .data -439, -17, -636, -540, 782, -850, 427, 366
+dec L285
+L67: .string "xoftn"
+L68: .string "ohcjs"
+L69: dec L134
+rts
+L70: .data 731
+L71: .string "azlygwvfehdbudt"
+L72: .string "qqmcuqnhcrwfsbrcvq"
+jsr L230
+lea L65, *r2
+L73: sub #-251, L7
+L74: .data 0, -361, -535, 983
+L75: .string "uhncpht"
+bne *r2
+jsr L15
+L76: .string "rtee"
+; comment
+add r1, *r1
+stop
+L77: .data -735, -915, -750, -586, 551, 314, 612, -874
+L78: .string "pq"
+L79: .string "mcidcvqinfmtpqwjiqmoadvr"
+prn *r0
+L80: dec *r2
+stop
+L81: .string "pzmvse"
+L82: add r6, r0
+mov *r3, r6
+L83: .string "sykmjyssgm"
+mov L244, *r2
+sub L169, L0
+L84: .string "xaakr"
+rts
+L85: .data 437
+cmp #-207, r4
+; comment
+L86: .data -166, 983
+L87: .string "rotbuypvieu"
+rts
+L88: .data -370, 507, -270, -902, 453, -537
+L89: .data 292, -59, 362, -937, 821
+bne *r4
+L90: .data -959, -778, -535, -686, 273, -616
+L91: .string "mjidrojeos"
+L92: .data 636, 77, -384
+L93: .data -73, 858, 390, 472, 85, 445, -412
+L94: .string "myggkniedayprrmptoswyno"
+jmp *r4
+jmp *r2
+; comment
+; comment
+L95: .string "rpe"
+L96: .string "fuyzrylynnotto"
+jsr *r1
+
+L97: .data 397
+L98: .string "qsbwpjfefdinbng"
+jsr *r6
+L99: .data 475
+L100: .data -106, -945, -936, 488
+rts
+rts
+L101: .data 434, -589, -925, -528, -978, -291, 527, 551
+L102: .string "ywlqnwzukhzhyvmifh"
+mov *r7, r0
+bne L184
+prn L301
+jmp L72
+L103: .data 674, 754, -287, -889, -524
+L104: .string "obhkqflkxvcuhjl"
+L105: .string "vazzxjcr"
+L106: .data -694, -56, 104, 360, -168
+prn L37
+L107: rts
+L108: .string "unnu"
+
+cmp *r6, L257
+L109: .string "yjbswgg"
+lea L324, r7
+L110: .string "erratjfhtlyqmyg"
+prn *r4
+L111: .data 741
+L112: .data -169
+inc L225
+L113: .string "uujtna"
+stop
+mov r2, r0
+L114: .data 745
+L115: .data 981, 805
+L116: .data 545, -48, -360, -375, 898
+L117: .data 534, -791, -579, -915, 394, -696, -606
+L118: .data -402, -429
+L119: .string "zuvnljlwzyaf"
+dec r0
+red *r6
+L120: .data -611, -312, -378, 964
+jsr *r0
+dec L159
+L121: .string "pnlruxqyqdqzqpup"
+L122: .string "lzqzj"
+L123: .data 736, 456, 578, -897, 197, -203
+dec L21
+jsr *r6
+L124: .data -444
+L125: .string "oxv"
+L126: .string "fahrzglxxn"
+prn *r1
+
+L127: .string "ktorukwscxsaksuyinsmfa"
+L128: .data -557, 712, -548, 0, 16, 804, -777
+L129: .data 618, 122, -469, -377
+not L244
+L130: .string "zbnavqvrhrjvaofwmbenjcqz"
+L131: .data -91, -923, -116, -805, 799
+mov L316, *r2
+L132: .string "htshvwobrzozonqcpcqogmzt"
+L133: .data 241, 654, -773, -967, -912
+L134: .string "ijzlj"
+L135: .data -300, 980, 694, -282
+L136: .data -131, 523, -320
+L137: .string "k"
+L138: .data -321
+L139: .data -657, -524, 651, -4, -122, 652
+prn r6
+L140: rts
+L141: .string "iajvhro"
+add L30, r3
+L142: .string "bk"
+L143: .data -159, -489, 249, -183, 762
+L144: .data 771, 698, 509, -166, -867
+L145: .string "zwg"
+L146: jmp *r3
+stop
+L147: .data -270, 257, -596, -85, 525
+L148: .data -382
+L149: .data 893, 257, 173, 675, -732, -723, 233, -765
+L150: .string "jzbcozwzadzzkekx"
+L151: .string "auwxajuwuqhczbcgdjzbz"
+L152: .string "z"
+L153: .data 865
+L154: .data -510, 701
+L155: .data -675, -997, 311, 150, 678
+L156: .string "euvceltbcfwwgd"
+L157: .data -3, -922, 195, 937, 267, 65, 521, -538
+L158: .string "gdlcbjzgywdu"
+L159: .data 300, -621, -414, -834
+L160: .string "kqgudgclu"
+L161: .string "lm"
+L162: .string "mcwhvkfytu"
+dec r4
+add L297, L225
+L163: .string "aajtlkoullytzljk"
+L164: .string "hzorognedqp"
+L165: .string "unljywvgxbxrgshsxmkibbck"
+L166: .string "vm"
+L167: .string "cpvnoojdn"
+L168: .data 403, 119, -159, 787, 90, -334
+add *r2, r4
+L169: .string "vkbhszihtmhqncamrqhp"
+
+L170: .data -193, 340, -778
+L171: .data 158, 440, -768, 560, -317, -31, -717, -634
+L172: .string "fhfdszxtydgnrhmp"
+L173: red *r3
+rts
+L174: .string "eyhiwdbrqseqyal"
+lea L302, r1
+L175: .data -813
+L176: .data 330, 517, 286
+L177: .string "txqskwm"
+jmp *r4
+L178: .string "sjwmtzushjtk"
+; comment
+rts
+L179: .string "kfhlkljxvevgerqefiiug"
+L180: .string "oaigig"
+L181: .data 500, 751, -157, 232, 276, 553, -218, 403
+L182: .string "emjohzpv"
+L183: .data -458, 685, 62
+L184: add L176, *r0
+; comment
+L185: red *r2
+L186: .string "gww"
+cmp r3, L54
+L187: .string "xedmeeaueupcpesgukrajs"
+; comment
+L188: dec r7
+L189: .data -826, 929, -224, 117, -453, -93, 186, -588
+lea L232, L284
+not *r4
+L190: .data 795, 461, -59
+L191: .data -906, -936, 857, -883, -665, 794, -759
+jmp *r3
+L192: .data -447, 491, -981, 368, -990, -798
+L193: .string "isnpvlzjqritttixpcntcf"
+sub *r0, r7
+mov *r7, *r2
+; comment
+L194: .string "kbwyjkmpxvxsk"
+dec *r6
+; comment
+L195: .string "xulumrbvopnd"
+L196: .string "nxvxkknwvnouptxavxrivw"
+L197: .data -953, 255, -591, -597, -680, -290, 538, 32
+jmp L98
+L198: .string "ocbwopflchxll"
+cmp L252, L290
+L199: .data -909, -406, 28, -145, -439, -85, 693
+jsr L159
+L200: .string "rbaxiiye"
+inc L276
+cmp *r6, #101
+L201: .data -83, 673, 737, -625, -182
+L202: .data -713, -709, -440
+L203: .string "tdvnhbqgedbnmcnbgxkmvnv"
+L204: .data 821, 574, -51, 128
+L205: .string "araybqnqfmt"
+L206: .string "ipzysyy"
+L207: .data -122, -987, 735, 109, 631, -863, -355
+L208: .string "neusnplebx"
+L209: .data 125, 424, 954, -98, -71, -8
+L210: .data 328
+L211: .string "ngoqoxnhkqxns"
+L212: .data -66, -573, 4, 849, 931, 26, 665, -360
+clr L130
+L213: .data 511, -719
+L214: .string "m"
+clr *r7
+L215: .string "gduufhoiuimlllcnyn"
+L216: .string "lvpddgqszxlrg"
+L217: .data 69, 586, 966
+L218: .string "pqjroodxbs"
+rts
+L219: .data -236, 517, -515, -396
+L220: .string "heeqbxxkglytlwqq"
+L221: sub L210, r3
+L222: .string "gukntujnipwtz"
+prn #114
+L223: .string "ffpfaniuzejkdnfgdg"
+sub L191, L265
+L224: .string "gincqnsxtada"
+red *r4
+L225: .string "cojaidkusiclcpfeylyxrk"
+L226: .string "twbh"
+L227: .string "ulmuqugypisbte"
+L228: .string "vkpfhkzcpvsjnjiifeg"
+L229: .string "af"
+lea L253, r5
+L230: .string "ztebrvyryghn"
+L231: clr L147
+L232: .data -445, 746, 224
+inc *r1
+rts
+cmp #104, #-12
+L233: .data -652, -880, -551, 443, -726, -842
+L234: .string "irnryu"
+
+L235: .data -441, -632, -340, -667, -810, 437, -311
+L236: .string "ngcugrcgcpcaz"
+dec *r0
+clr *r4
+L237: lea L251, r3
+L238: jsr L178
+; comment
+L239: .data 177, -708, 439, -691, 85, -406, 698, 729
+L240: .string "hqmdifhcaygigddm"
+L241: .data 989, -349, -245, 609, 931, 970
+L242: .data 579, -133, 225, -935, 31
+stop
+not *r2
+sub #-165, r2
+inc L288
+stop
+cmp *r1, *r5
+L243: .data -683, 254, -139
+L244: .string "rorut"
+lea L321, *r7
+lea L291, *r3
+L245: lea L186, L84
+L246: .data 340, -719, 856, -261, 6
+L247: .string "xrzywymnd"
+prn #8
+L248: .string "xebzhzmufnuvnoqexnpy"
+L249: .string "gszmlydejfd"
+L250: .data 429, -551, 645, 242, 888, 504, -920
+L251: .data 511, 565, 196, 528, 699
+L252: .data -904, -928, 408, 625, 60, -442
+dec *r2
+rts
+L253: .string "krxnfl"
+L254: .string "oyiylhy"
+L255: .data -118, -797, 74, 132
+L256: .string "kxquvxebbaci"
+bne L305
+L257: .string "soxauciboxqn"
+L258: .data -707, 466, 418, 862, 908, 466, -815, 970
+L259: .string "wvpwlxeaxu"
+L260: .string "lknlofzjgze"
+L261: .data 989
+L262: .data 434, 335, -356, -21, 710, 365, -176, 639
+L263: .data -482, -727, -437, 573, 843, 448
+L264: jsr L226
+cmp L236, *r1
+L265: .string "tyddjajh"
+L266: .data -901, 123, 36
+L267: .data 933, 956, -188, -247, -481, 390, 485, -659
+prn r3
+L268: .data -643, -507, -173, -650, -629
+cmp L35, r6
+clr *r7
+L269: .string "lp"
+L270: .data -395, -443, -215, -721, -109, -158, -875, -817
+L271: .string "hyqlnikhojpbk"
+dec r0
+L272: not r0
+L273: .data -369, 89, 528, -20, -660, -643, 231
+cmp r2, L327
+L274: .string "vitqzdofoimwoousrmr"
+L275: .string "rweuhzjfvvyon"
+rts
+L276: .data -486, -232, 695, -539, 992, 329, -347, -229
+clr *r1
+L277: .data -999, -399, 56
+L278: .data 275, -497, -818, -677, -295, -709, 531
+L279: .string "hcmrukxcfbyeckynj"
+L280: .data 50, -760, -107
+L281: .data -898, 739, -146
+not r6
+L282: .data -434, -24
+cmp r5, #-140
+lea L114, L286
+L283: clr *r1
+L284: .string "nqedilztmccqcqliifr"
+L285: .data -941
+L286: .string "aeqgugoiqkmkqsblas"
+L287: mov L55, L308
+L288: .string "yervpkhzbzgwybue"
+L289: .data 823
+L290: .string "jcmm"
+L291: .data 60, 174
+L292: .string "liamfeyboaliaiasypcxpi"
+L293: .string "rtchorhcuvycu"
+L294: .string "hbwdhgjdotkfstbszdpqqov"
+L295: jmp *r2
+jmp L314
+L296: .data 762, -81, 249, 327, -704, 350
+L297: prn r3
+rts
+L298: .data -14, -195, -872, 856, 923, -548
+L299: .data 396, 942
+L300: .string "uudtf"
+L301: .string "aul"
+
+not r1
+dec L129
+L302: .data 831, -874, 930, -92, -449, -534, 319
+clr L263
+L303: .string "imxlylhgelqzafydd"
+sub L317, *r2
+jsr L244
+lea L321, L266
+L304: .string "czwvhwonhvjmiivfe"
+L305: .data 662, -521, -433, -357, 557, -994, -797, 524
+L306: .data 244, -154, -748, 904, -64, -303
+L307: .string "vgqtci"
+jmp *r4
+L308: .string "wf"
+inc L314
+L309: .string "crfygwjzfk"
+; comment
+L310: .string "sjff"
+L311: sub L322, L11
+prn r4
+L312: .string "xwzenlfavafkere"
+L313: .data -342, -805, 919, 578
+L314: .data 8, 659, 88, -445
+; comment
+L315: .data 22
+L316: .data -949, -854, -504, 400, 709
+add #-3, r2
+not r6
+
+prn *r4
+L317: jmp *r1
+L318: .data 837, 301, 546, -875, 763
+L319: .data 895, -13, -36, -439, 489
+L320: .data -38, 661
+lea L152, *r4
+L321: .data -8, 333
+rts
+L322: bne *r0
+lea L91, *r0
+L323: .data 247
+bne L326
+L324: inc L330
+L325: .string "yjjcpj"
+L326: .data -340, -376, 431, 704, 697
+L327: .data 116, -98, -562, 534, 368, 493
+L328: .string "vhvydrmwrzpfi"
+L329: .string "rpnigvhhywyxa"
+clr *r4
+L330: .data 537, -60, 423
+lea L289, *r3
+
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 46
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+jmp *r0
+L0: .data -452, -750
+L1: .data -611, 85, 805, -292
+red L1
+stop
+L2: .string "bgmoiybkzbvwlril"
+L3: .data -433
+L4: .data -481, -990
+L5: .string "yipnaushcwnunkbjl"
+L6: bne *r3
+prn #76
+L7: .string "kkqmowokeu"
+inc r6
+L8: .string "ycyygh"
+L9: .data -751, -51, -623, 27, 14
+cmp #-169, L36
+dec *r5
+stop
+add L7, *r0
+L10: .data -641, 400
+prn #46
+L11: .string "yrjoyczuplqcqmfxbwg"
+L12: .data 656, 308, 571, 823, -928, 772
+L13: .string "gfwfwlsesir"
+mov #-130, *r7
+L14: .string "htjcibdssvdtly"
+bne L251
+L15: .string "pfoatdygnhq"
+L16: .data 579, -524, -286
+L17: cmp L10, r1
+jmp *r1
+L18: .string "fmklajpxrqhpavp"
+; comment
+L19: .data -157, -720, 629, -733, 917, 95, -407, 581
+inc L94
+mov L319, L18
+L20: .data 520, 539, -552, -566, 387, 470, -108, 108
+stop
+L21: .data -857, 558, 315, 343, -964
+L22: inc r3
+L23: .string "sytyezl"
+L24: .string "bgfiqqfpvp"
+; comment
+add #-105, *r6
+L25: .string "epfgfvrkanejpwldlbfzl"
+L26: .data -924, 12
+L27: .data 296, -899, -480, 678
+L28: .string "j"
+
+mov *r3, L7
+jmp L19
+L29: .data -253, 716, 294, 784, 561
+L30: .string "utcefikrvfahizdpfg"
+L31: .data 652
+L32: .string "oijwdd"
+jmp L3
+L33: .data 549, -991, -322, 362, -714, 509, 761, -788
+L34: .data 944
+L35: .data -681, -312, 215, -529, 449, 346, 419
+L36: .data -889, -304, -174, 970, 731
+add #16, *r5
+L37: .string "bajajwwjch"
+; comment
+L38: add *r0, *r5
+L39: .data -246, 878, 223, -919, -758, 736
+L40: .string "uhmivmfhcffqelwl"
+sub L103, *r6
+L41: .data 569, 988, 868, 174, -335, 69, 236
+L42: .data -582, 990, 706, 64, 285, -816, 488
+L43: .string "lqgbzdtmdsbbytv"
+L44: .data -185, -9
+L45: .string "ohk"
+L46: .data -809, 869, 794, -430
+L47: jsr L119
+dec r7
+; comment
+cmp #-155, r6
+mov L22, r6
+L48: .string "wlivuwt"
+sub *r1, r3
+L49: .string "uhuhlzuxkmymlmhfkxn"
+bne L153
+L50: .string "mewibzuy"
+cmp L50, L230
+inc *r1
+L51: .string "swmjml"
+mov #-228, *r3
+L52: .string "ojfyeizkyaovmcbdtvmsfgt"
+cmp L174, #57
+clr *r6
+L53: .string "pzcipgogdmunnxmzfluxpn"
+L54: .string "cfbhnh"
+mov L64, r2
+L55: .data 166, 176, 407, 624, -617, -380, 189, 224
+L56: .data -150, -55, 912, 780, 792
+L57: .string "mjfmoqetlb"
+bne *r5
+bne *r0
+bne *r6
+L58: .string "xvxqnoumcpcocjndzxuq"
+L59: .data -479, -173, 822, 253, 323, -987, 469, -758
+L60: .data 175, 354, -377, 262, 712
+L61: .string "qu"
+L62: .string "cgaau"
+L63: .data -239
+L64: .string "todzmmz"
+lea L47, r6
+L65: .string "iwvvsdsebad"
+L66: .data -550, 935, 917, 568, -830, -561
+L67: .string "z"
+clr L47
+lea L35, L54
+L68: .string "nrupcy"
+L69: .data -771, -718, 697, 685, -6
+L70: rts
+L71: .data 364, -321, -230, 445, 723, -968, 701, 707
+rts
+L72: .data -818, 741, -348, -522, -644, 979
+L73: .string "vy"
+L74: .string "dxqpwmvjykmhzihquqgivm"
+L75: .data 108
+rts
+jsr L277
+inc r0
+jmp L66
+L76: .data 315, -192, 558
+lea L191, r6
+L77: .string "ttzlgmsyouesdikyfphoksaw"
+rts
+L78: .string "hwzgurdnyzrppm"
+L79: .string "orymptng"
+lea L2, L106
+dec L273
+L80: .string "fiqyeacnoxprjxuuinkv"
+L81: .data -375, 409, 525, -776, -13, 61, -720, -697
+L82: .data 537, -149, 854, -571, -479
+L83: .string "pslqish"
+L84: .data 121, -526, 923, -622, 673
+sub *r0, *r7
+L85: .string "pfijqkpzvfiphxgfttrxhxiv"
+L86: .data 130, -62
+jmp *r2
+prn L109
+bne L41
+bne L48
+L87: .data 394, 261
+L88: .data 497, -320, -723, -912, 633, -878, -42, 292
+L89: .string "ovvupimbz"
+; comment
+L90: .string "kzkjmeiacwngsdsxqrzchlh"
+L91: .string "ovrpsfsfztoddtfwqx"
+L92: prn L123
+L93: .string "crhmzuivg"
+L94: .data -632, 393
+L95: .string "hkxgyqwhpxoi"
+add L120, L13
+L96: .data 215, -54, 806, 606, 707
+L97: .string "nnogbgxnqrlpw"
+L98: .string "sioxgutmkjoz"
+L99: .string "tefgbmwasqf"
+L100: .data -340, -656
+L101: .data -78, -224, -178, 964
+L102: .string "zmkfbayjvdbrhcgkiumrpp"
+L103: .string "lpgeufysvcqjxev"
+jsr L71
+jmp L141
+L104: .string "e"
+
+L105: .data 735
+L106: .string "vhzubeguvqd"
+L107: .string "vr"
+L108: .data 908, 671, 303, -333, 751, -681, -557, 294
+prn #-247
+L109: .string "frlxeqafuphtw"
+L110: rts
+L111: .string "ibgiyzxakrm"
+L112: cmp *r2, #213
+L113: .string "fxkzxfwuaocnus"
+L114: .string "akxdkgylkcglphh"
+L115: .string "dflmzawhwozubojalpclgth"
+prn L272
+clr L151
+L116: .string "rwndxjhwkc"
+clr r4
+red *r4
+L117: .data -73, 491, -579, 801, -222, -313, -411, -105
+jmp *r3
+not L146
+L118: .data 39, -809, 718, 18, 727, -640, -985, -476
+L119: .string "lqu"
+cmp #54, r6
+L120: .data -664, -807, 362, -342, 858, -531, 389
+L121: .string "oxlqp"
+
+L122: .data 416, -802, 221
+L123: .data 171, 396, 914, -163
+L124: .data 588, 205, 319, 601, 789, 24, -55
+jmp L122
+stop
+L125: .string "amalniuwquhhjdlbnbrynb"
+rts
+lea L24, *r2
+L126: .data 809, -518, -216, 347, -338
+not L112
+L127: .string "omqijmkpb"
+L128: .string "mzwdqgajufoskvtdwesl"
+L129: .string "ykgvlrwcquxhsnia"
+L130: .data -24, -840, 445, -943, -829
+L131: .string "hzuzsrfmbojlnff"
+L132: .string "atzewprpcglnaqokgfebj"
+not *r0
+L133: .string "opecyqmoyfcgwqyjaonvazju"
+L134: .data 319, -767, 752, -574, 441
+
+L135: .data -885
+mov *r7, L292
+bne L164
+L136: .string "nxrqaewmklgfib"
+L137: .data -457
+L138: .data 390, 791, -134, 348, -144
+L139: .data -227, -963, -669
+L140: .data -989, 882, -947, 912, 339, -428, 547, -644
+L141: bne L24
+L142: .data 742, -866
+; comment
+L143: .string "jtwddqiaflafc"
+L144: .data -737, -929, 405, 26, -550, -122
+L145: .string "klfaaveymnx"
+L146: not *r1
+L147: .data 950, -57, 414, -420, -931, -708, 361, -300
+cmp #-180, L181
+L148: .string "qdcfwuyynbq"
+L149: .string "jlfekc"
+L150: .data -897, -490, 794, 331, 355, 152, 63
+L151: .data 924, -249, 156, -831, 149, 773
+L152: .data 678
+L153: .string "lruyronplnjextuwxjvw"
+L154: prn r5
+rts
+L155: .string "utkjysalnhgfeggfqd"
+L156: .string "sovwiyvaumhayh"
+L157: .data 670
+not L325
+L158: .string "gbt"
+L159: .data 416, 789, 254
+L160: .data 8, -914, -337, -437, 994, -421
+jsr *r0
+L161: .data -584, -85, 266, 139
+L162: .data -202, -26, 421, 236, 733, -656, -496
+L163: .data 625, 129, -652
+cmp *r0, #-205
+L164: .string "n"
+L165: .data -690, 738, -41, -488, -314, 8, -168
+L166: .string "npjwyggmqdslnesblpphfzk"
+L167: prn #-238
+sub L266, *r3
+L168: .string "jkdkqpksrazwbbfd"
+L169: .data -42, 903, 611
+L170: bne L73
+L171: .string "qrrfufjr"
+prn r5
+rts
+L172: .string "xmokrttmjmxnoppugh"
+L173: .string "ampbnnfhvq"
+L174: .data 543, 285, -998, 18, 130, -91, -100, -299
+inc r7
+L175: .string "yonpowjzdh"
+L176: .string "nrxeqvyczlocwcwlmjfmmduq"
+L177: .string "bgdatrcimcrzwwxcuanpco"
+L178: .string "vpbodprbsijc"
+
+; comment
+L179: .data 261, 245, -398, -413, 927, 676
+L180: .data -584, 35, 900, -325, 731
+L181: .data 77
+lea L259, r6
+L182: .data 624
+L183: .data 827, 473, -457, -223, -618, -674
+jmp L191
+inc L232
+L184: .data 92, -293, 115, -477, -857, 840
+L185: add #-144, *r6
+add L121, L318
+; comment
+L186: .data 651, -553, -241, 24
+prn *r1
+cmp r4, *r3
+L187: .data -852, -256, -785, -176, 691, -402, -791, -253
+L188: add *r6, r5
+L189: .string "thkjaqrgitiwkelmpaduuqm"
+; comment
+L190: .data -702, 260, -299, 850
+L191: .data 761, 127, -18, 786
+L192: .data -361, -863
+L193: .data 780, 394, 396, -78, -482, -327, 440
+L194: .data -13, 181, -161, 171, -788, -947
+clr *r3
+sub L206, L29
+inc *r4
+stop
+L195: .string "xsrf"
+L196: .data -116
+not L184
+L197: .string "kpitflomfozkjdqm"
+L198: add *r2, r0
+
+L199: .string "lbmarppriuxybcotsyg"
+L200: .data -496, -984, -10, -531
+L201: .data 450, -617, 782, 707, -959, -43, 332, -868
+L202: .string "cxpvlpznhxwxeyjxeitxlrlo"
+L203: .string "ryxyah"
+L204: .data -201
+L205: .data 22
+not *r4
+L206: .string "sadvhmbjeswodyfrkeukz"
+L207: .data 677, 666, -380
+L208: .string "hhtuvwq"
+L209: .data 279, 918, 179, -836
+L210: .string "zp"
+L211: .string "zohxeixxyjccxwas"
+L212: .data -426, 640
+L213: .string "dnikrc"
+L214: dec r1
+stop
+stop
+L215: .data 125
+L216: .string "dxqadhwwcpdjeqzpnkfcxk"
+add #134, *r6
+L217: .data 44, -667, -98, -678, -678, -457, -873
+L218: .string "gtllpilzccmxzvxbbdubhzpi"
+L219: .data -422, 881, 708, 133
+L220: .data 791, 978, -232, -121
+jsr *r2
+not L280
+L221: .data -782
+bne *r5
+L222: mov *r0, L50
+L223: .string "wadtxf"
+L224: .string "uqqhqtrkvw"
+L225: .data -857
+; comment
+cmp #25, #254
+L226: .data -397, -875
+mov *r5, r5
+L227: .string "odkmf"
+L228: .string "huniwhoqgcjjqox"
+L229: .data 406, -828
+lea L152, L88
+clr *r1
+L230: .string "oueoacceou"
+L231: .string "ebososdbdltjwxvsvaq"
+
+L232: .string "tv"
+L233: stop
+L234: .string "exgipxfzfdhvygfonxyy"
+L235: .string "pfxwrpnmullefsbokhoqg"
+red r6
+L236: .string "jjhymrovbvscqbrdfsipibi"
+
+L237: .string "ml"
+lea L12, r0
+dec L275
+L238: .string "ammgvfdm"
+L239: .string "bvmhtdizjgnvkdjtpg"
+L240: .data -663, 289, -1000, -551, 517
+L241: .data -614, 112, -126
+dec *r0
+L242: .data 416, 346, 473, 276, -624
+dec L39
+L243: .data -667, -987, -601, 148, -361, -234
+L244: .string "spxasoqfgjqwswtnselt"
+dec *r4
+L245: .string "lockvqmwo"
+inc L189
+clr r7
+L246: .data 818, 943, -734, -674, -499, -212, 974, 553
+L247: .string "cikqcq"
+L248: .data 502
+L249: .data 411, -556, -70, -716, -213, -253
+L250: inc r4
+bne *r2
+L251: .string "tmyxqk"
+L252: .string "oscobzzpigidfnksdtmgsz"
+sub L229, L55
+L253: .data -479, 367, -520, -130, 158, -345
+clr r4
+L254: .data -528, 725, 794, -989, 397, -546
+
+
+; comment
+lea L320, r1
+; comment
+L255: .data -455, 974, -686, -781, 18
+L256: .data 24, -363, 132, -945
+L257: .string "expnxeqwbjno"
+add *r7, *r1
+L258: .data -796, 453, 57
+not L93
+sub #-111, L237
+jmp L135
+L259: .data 444, 992, -511, -515
+L260: .data 375, -770, 959, 810, -67, 934, 9
+L261: .data 895, -569, 257, 589, 926, -248, -588, -286
+L262: .data 766, -901, -857, 398, 90, -4
+L263: .string "otyeodryutwaptyltqzscbwl"
+rts
+bne *r0
+L264: .string "cvpprrmhiujs"
+L265: .string "i"
+L266: .data -871, -802, -855, 291, -510, 976
+L267: .string "wxc"
+L268: .string "poyhnsro"
+L269: .data 924
+jsr L289
+L270: .string "ytyazxvbjpwhnz"
+L271: .string "ltudzhvxoew"
+L272: .data 88, 614, 488, 422, -43, 553
+L273: cmp *r0, L177
+L274: .data -302, 369, -534, 130
+L275: .data -797, -563
+L276: .string "kzs"
+inc r0
+L277: .string "woka"
+red *r3
+L278: .data -694, -573, 205, -863, -379, 494, -12
+L279: inc *r4
+L280: .data -548, 379
+L281: .data 826
+L282: .string "zugottocqhhfqrwjk"
+L283: .data -118, -168, -221, 351, 852, 640
+L284: .data -640, 121, 923
+L285: .string "vxhipcjzuugtlymadl"
+L286: .string "qdkpmufkpmryhfxyqyhtca"
+L287: .string "ugltwuoemsctm"
+L288: .string "nefnlerwd"
+L289: .string "lfdltqbc"
+L290: .string "un"
+L291: dec r1
+L292: .string "cvipmaglprpnsuairft"
+L293: .data -232, -661, -999
+mov *r5, L212
+L294: .string "xgkcaooanuyqlgody"
+L295: .string "vmd"
+L296: .data -723
+L297: .data -404, 173, 618, 43, -896, 466, 155, 663
+
+red r3
+L298: .data -221, -838, 471, -349, 361, 172, -250, -710
+; comment
+not *r7
+inc *r6
+L299: .string "bhxcyowhjbobvaforrvbjkbr"
+L300: .string "bepeakztpigvgxoghv"
+L301: .string "lygugrpsy"
+L302: add #165, r2
+L303: not L315
+bne *r6
+rts
+L304: .string "or"
+L305: .data 903, 938, -245, -719, -170, -960
+jsr *r0
+add #-85, L311
+L306: .string "dlapavg"
+L307: .data 328, 59, -572, -13
+not r1
+L308: sub r3, *r6
+jmp L202
+L309: .string "mwrygcobqtdamxwzsywcmqg"
+bne *r4
+bne L282
+L310: .string "gzzifnmfcuguzpzoye"
+L311: .string "pdqwgitxgdjl"
+L312: .string "ygvlbnslxof"
+not r5
+L313: .data -979, -259, -895
+L314: .data 711, 664, -309, -194, 279
+dec L193
+L315: .data -423, -995, 82
+L316: .data -189, -694, -98, 105, -739, -30
+add r4, r0
+stop
+L317: clr *r4
+L318: .data 433, -862, -195, 499, -430
+cmp #96, r6
+L319: .data -947, 87, 491, -109, 935, -847, -521, -553
+L320: .data -120, -368
+L321: red *r1
+L322: jmp L323
+sub #11, r7
+L323: .data 940, -347, -542, -887, 313
+L324: .data -865, -183, 204, -14
+L325: .string "rxhh"
+L326: .string "zywqrpzfcumufuwoonlbmq"
+clr L318
+L327: .data -233, -949, 911, 893, 201, -252
+not r2
+; comment
+L328: .data -631, 804, -419, -519, -54
+L329: .data -12, 529, -345, -210, 683, 467, -346, -302
+L330: .data -454, -284
+stop
@@ -0,0 +1,521 @@
+; Generated by genCorpus --seed 47
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+L0: .string "o"
+inc *r2
+L1: red *r1
+add L147, L1
+red r1
+L2: .data -403, -418, -76
+L3: .string "yvxwuweotrfqlmkhpb"
+rts
+L4: .data -50, -55, -818, -988
+L5: .string "dfclveuctsgyutfgv"
+L6: .string "edjdkqoncnegox"
+L7: .data -111, -547, -52, -451, 852, -273
+L8: .string "empqjvuldbuxqdzlhrhyq"
+clr *r4
+L9: .string "qbgjez"
+L10: .data 258, -698, 835, -392, 496, 472
+L11: .data -783, -513, -466, -674
+add r5, r0
+L12: .string "ffaaihddlhaxtmcrwkwut"
+L13: .string "zhunlykc"
+L14: .string "yehsftghirkxp"
+L15: .string "awvbcch"
+not r1
+cmp *r5, #30
+dec r2
+L16: .string "balkzclugkcpfwwrjzvq"
+L17: .data -887, 536, -41, -688, 726
+L18: .string "rxfchockihvpzvqwc"
+bne *r7
+L19: .string "ceuc"
+L20: .string "cfloawlxyc"
+; comment
+prn L19
+L21: .data 249, 522, 99, 195, 640, 730, -978, 925
+jsr *r4
+bne L0
+L22: .string "hmimzzmuyxiiarzgqqblqmca"
+sub L102, L78
+L23: .string "arrevofabbscmoayqqbv"
+bne L252
+L24: .data 778, 773
+L25: .string "hqudvoyydbgdbxmadfy"
+L26: .data -451, -138, 182, 183
+L27: .string "wg"
+L28: .data 485
+L29: .data 698, -427, 916, 366
+L30: .data 973, 551
+L31: .string "wqltyegcxvhdy"
+L32: .string "vx"
+lea L260, r3
+not r6
+mov L79, *r5
+inc r7
+L33: .string "nxikericofsuyc"
+rts
+lea L150, *r0
+lea L46, *r7
+L34: .data -909, 355
+L35: .data -403, 567, 358, 72, 166, -256, 304
+inc *r3
+cmp r0, L284
+L36: .data 436, -999, -964, -928, -948, 170, 306, 352
+L37: .data 331, -899, 985, -864, -644, 872
+L38: .data 187
+L39: .string "dmyioehsbniuxyumydo"
+L40: .string "zzpkqewfkscban"
+L41: .data 524, 17, 71, 615, 803
+L42: .data 681, 179, 900
+L43: .data 990, -870, 836, -761, 640, 557, -662, 69
+cmp *r2, #214
+L44: .string "kqb"
+L45: .data -988
+L46: .data -331, -914, 199
+L47: .data -347, -774, -666, -808
+
+L48: .string "ujrcfstbhwwuatsizvqld"
+L49: .data -576, -627, 123, -194, 994, 852, -447
+mov *r4, r0
+L50: .data 740, -472
+sub *r6, r6
+mov r6, *r3
+L51: .data 253, 728
+lea L11, *r7
+L52: dec *r0
+not r4
+
+L53: .data -335, 282
+L54: .string "uzgmfnjkncyj"
+inc *r0
+L55: stop
+L56: .data -970, 266, -2, 201, -522, -582, 414, 873
+
+L57: .string "xixcnadqqksdfviklsbksct"
+red r6
+rts
+rts
+cmp #217, L147
+L58: .string "cqcv"
+L59: inc *r5
+L60: .string "ctytjynfamcxtuthpjbcwjf"
+L61: .data -588, 80, -847, 304, 318
+mov #230, L112
+L62: .data 959, 927, 780, -35, -702, -724, -403, 408
+L63: .data -507, -766, 192, -779, 269
+L64: .data -396, 299, -864, -71, -122, 190, -104
+dec r4
+L65: .data 451, 885, -878, -916, 361, 588, -65, -588
+L66: .data -703
+inc *r1
+jmp L186
+L67: .string "gjgtezqofx"
+L68: .data -704, 999, -715, 944, 784
+L69: .string "kevopguwjfumhf"
+L70: .string "yhtvcsdaibhdp"
+L71: red r0
+L72: add L21, *r4
+L73: .data -632, 795, 214, 488, 79, 678, -99
+L74: cmp *r0, *r7
+sub #129, *r6
+; comment
+L75: .string "cfqdxfh"
+rts
+L76: .data 864, 581, 892, 930
+sub *r7, r2
+bne L45
+L77: .string "zaaaxccfnaao"
+mov r6, *r7
+L78: .string "f"
+L79: .data 316, -982, 634
+L80: .data 706, 55, 633, -104, -888
+; comment
+L81: .data -785
+sub *r0, L185
+add L242, *r3
+not L3
+red L62
+L82: red *r2
+L83: jmp L228
+jmp L105
+L84: .data -639
+L85: .data 51, -421, 721
+L86: .string "dyprwpwepyscxzdwtxczjasr"
+sub r2, L229
+L87: .string "bppyntuajj"
+bne *r2
+clr *r0
+L88: .string "mobpdgcsvf"
+L89: .data 584
+prn L45
+L90: .string "hqflxznixwkumlusjdo"
+L91: .string "xwnhliqtlukfzpnfvrmuw"
+lea L184, r2
+L92: .string "n"
+prn L93
+L93: .string "e"
+L94: .string "cddfdgcxk"
+L95: .string "d"
+mov L238, *r1
+mov #-218, r0
+L96: .data -914, 99, -418, -737, 762, 371, 801, 942
+L97: .data -633
+jmp L99
+L98: .string "tgcsiv"
+L99: .data -344
+jsr L4
+L100: .string "nyhkfujiiahl"
+L101: .string "s"
+L102: .data -92
+L103: .data 489, -274, -922, 253, 372
+L104: .data -90, 348, 25, 203
+L105: clr L100
+L106: .string "oezhl"
+L107: rts
+L108: lea L25, L112
+L109: .string "llyyhanv"
+L110: .data -262, -505, 448
+L111: .string "xwkdfkzdwjcrsxs"
+L112: .data 456, -131, -925, -134, -219, -989, 421, 107
+L113: .data 202, -554, 35, -333, 436, -708, -50, 270
+jsr L285
+inc *r7
+L114: .string "bchxgwxlivestmilrhy"
+L115: .data 504, 758, -900, 377, 237, -712
+red L283
+L116: .data 801, 643, -726, -291, 178, -485, -353, -502
+L117: .data -818, 106
+bne *r0
+mov L39, L235
+L118: .string "vkjkfkxjlfugpsyurwayb"
+L119: .string "altdhqqml"
+L120: .data -827, -295, -702, 634, -902, -859, 134
+lea L85, *r3
+sub r5, r5
+L121: .string "orcdwv"
+L122: .string "kxkiioageqvc"
+bne *r3
+L123: .data 669
+L124: .string "msrnsr"
+; comment
+sub #-158, *r0
+L125: rts
+; comment
+L126: .data 455
+sub L183, r1
+L127: .string "uzbixosglzfnwnq"
+add L71, r7
+; comment
+L128: .string "h"
+L129: dec r2
+L130: .data 756
+L131: .string "kgyobrqdetyj"
+sub r7, r3
+L132: .data -882, 158, 77, -634, -675, 555
+L133: .string "abpsjyrjlqztezxnzuloj"
+L134: .string "su"
+jsr L148
+stop
+mov #-51, r0
+red r5
+cmp #-214, *r1
+sub #8, *r2
+L135: stop
+L136: .string "z"
+sub #-136, *r1
+L137: .string "sbcahhykfbuxvga"
+rts
+inc L76
+L138: .data 403, 506, -735, -476, -662, 215, -701
+L139: .data 791, -245, -329, 682
+lea L49, r4
+L140: .string "jex"
+L141: .data -620, -946, 939, -711, -591, -974
+L142: .data 42, 686, -449, -504, -326, -228, 719
+L143: .string "fgizdk"
+prn #-103
+L144: .string "qbyxqzx"
+L145: .data -208
+add *r5, L18
+clr r0
+inc L207
+L146: .data 596, -948, -165
+L147: .data 724, -785, -943, -857
+L148: .string "bnmtwzcuijnaulldpr"
+sub *r4, L36
+prn r2
+L149: .data 7
+L150: add L250, *r6
+L151: mov *r7, r3
+add L206, L19
+L152: .data 675, -735, -268, 139, 418, -932, -842
+rts
+L153: .string "ermtp"
+prn r6
+cmp r3, *r7
+L154: .data -136, -679, -401, 813, -816, -155, -724, 353
+dec *r4
+L155: .string "ndcnqstvjhlgiopjadd"
+bne *r7
+stop
+L156: .data 388, 875, 75, 260, -528, 134, -225
+L157: .string "igv"
+jsr *r7
+sub #227, r2
+not L132
+L158: .data -15, -454, 923, -354, 129, 362
+rts
+jmp L169
+L159: .data 604, 821, 415, 367, 322
+; comment
+not r2
+L160: .data 706, 638, -837, -795, -706, 91, -604
+L161: .string "dwkgqwzlcbb"
+L162: dec r0
+jsr *r5
+L163: .data -147, 166, -997, -666, -749, 217
+L164: .string "gmtbhbvhzfbljhnsw"
+L165: .data 708, 62, 859, -785, -439
+
+L166: .data 442, 423, -856
+L167: .data -402, 72, 204, -881, 143, -6, -77
+L168: .data -521, -714, -661, 339
+not *r5
+L169: .data 32
+L170: .data 533, 234, -764
+L171: .string "kyrtwpmahe"
+red *r7
+L172: .string "uwhcpop"
+L173: .string "hmygzvecrrrvt"
+L174: .data -610, -376
+L175: .data -138, 647, 702, -114, 326, 857
+L176: .data 821, -756, 12, 257, -125, 360, 865, -166
+mov #-139, L167
+L177: .string "z"
+jsr *r0
+inc r0
+L178: .data 624
+L179: .string "lruxcvimwwxygyzmtftvd"
+prn r5
+L180: .string "nsfbbhmz"
+mov #98, r0
+L181: jmp L82
+L182: .string "ytreqjdsuuudgbhnaxe"
+not *r3
+add r0, L288
+clr *r7
+L183: .string "sekpyykegsglaivhd"
+jmp L223
+L184: stop
+jmp L22
+L185: .string "gtrjiwdfoiqyp"
+cmp #237, #235
+not *r3
+L186: .data 750, 926, 31, 853
+L187: .data -198, -869, 537
+L188: .string "yrlagncbdotfwpbbom"
+L189: .string "whhqgsppeboeknvdptcoefj"
+L190: .string "lnhkfew"
+L191: .string "ufrztouiyoune"
+L192: .string "drmftbiouyagwbfwtwufjcl"
+L193: .data 54, 400, 977, -955, -743, 317, 164, -346
+L194: .data -274, -831, 530, 173, 382, -889, -595
+
+prn *r7
+L195: .data 33, 564, 897, 30, 171, 587
+L196: .data 219, -932
+L197: .string "ooeu"
+jmp *r3
+L198: .data -185, 408
+L199: .string "jcbafojjuhrmxtozor"
+L200: .data 740, 834, 790, 238, 607
+stop
+L201: .data -100, -187
+L202: .data 922, -640, -314, -657, -78, -757, 753
+L203: .data 18, 906, 995, -52
+clr L230
+clr L196
+L204: .string "zzkklvwsas"
+L205: .data -152, 57, 793
+L206: .string "cttvrxnhoibgkvzmzbalf"
+L207: .string "azgjcuqatouvgvphta"
+not r4
+sub r0, r0
+jsr *r4
+mov L182, r4
+L208: sub *r3, *r2
+cmp #-200, L238
+lea L208, L155
+red L160
+L209: .string "pdrmle"
+L210: .data 528, 733
+jmp L194
+sub #75, *r0
+stop
+L211: .string "dhinoszjljtvq"
+L212: prn #-118
+L213: .data 218, 727, -454, 173, -169, -457, 662, 816
+L214: lea L140, r6
+L215: .string "ao"
+L216: .data 423, -264, 408, 91, -208, -747, 151
+L217: .data 572
+clr L230
+L218: .data 128, -253, -394, -758, -761, -383, -42, -5
+L219: .string "qquravmiovyejmhkauilt"
+cmp #-101, r6
+stop
+L220: .string "wzyvf"
+mov L112, *r1
+L221: .data 167, 574, -400, -44, 622, 258
+dec *r2
+L222: .data -53, -857, -656, 386, 885, -429, 121, -829
+L223: .string "pmf"
+L224: .string "vqpfhagkxuojvhxshksvknc"
+L225: .string "mlatcnhelmfuujdivbz"
+; comment
+L226: .data -532, 131, 184, 174
+L227: .data 881, -108, 262, -851
+L228: .string "nnrghe"
+L229: .data -987, -805, 529, 535, -946, 402, 186, 305
+L230: .string "minkzpoto"
+L231: .string "dvyjxjkz"
+L232: .data 473, 538, 984, -732
+L233: .data -936, 973, 709, 624, 474, -966, -604
+bne L280
+L234: .data -16, 614, 560, -311, -358, 218
+L235: .data 466, 883, -909, -663
+dec r1
+jmp *r3
+mov L78, L56
+rts
+L236: .string "rozqtuujrlozfvvzqohpo"
+dec L278
+L237: .string "xxndhilnzfrays"
+L238: .string "pgbxspepfylhyimoz"
+L239: .data 184, 797, -777, -628, 362, -871, -360
+L240: .data -30
+L241: dec *r7
+; comment
+stop
+L242: .string "bhujfuibyffanx"
+L243: .data 465, 65, 538
+L244: .string "pcnzhzuiziyixquy"
+add L62, *r0
+clr L83
+L245: .data 232, -540, 532, -655, 381, -618, -223, -974
+add *r3, r7
+L246: .string "ubqljvekvlwubwstj"
+dec *r1
+lea L269, r4
+L247: stop
+L248: .string "ksreyckfntdeaxujshf"
+L249: .data -805, 147, -806, -65, 90, -686, 765, 939
+lea L275, r7
+L250: .data -186, 561
+L251: .data -11, -576, 251, -673, 526, -349
+; comment
+L252: .string "kjppr"
+L253: .string "efcvgejtqinp"
+clr r1
+L254: .string "xcppy"
+L255: stop
+L256: .string "siaoitvghjjthwspykxew"
+lea L275, r6
+L257: .string "mpjevitgaynup"
+mov L144, r2
+L258: .string "nezdwateigo"
+not r0
+jmp *r1
+lea L266, r1
+L259: prn #108
+stop
+not *r1
+L260: .data 433, 186, 191, -628, -909
+L261: .string "zhrlx"
+L262: .data 252, 476, -440
+L263: .string "thuogetrpaytrmihysjyg"
+L264: .string "ymontezyymm"
+bne L281
+; comment
+cmp #-49, *r3
+L265: .string "zxdhbz"
+cmp L279, #-183
+L266: .string "c"
+inc L85
+cmp r3, r3
+L267: .string "alopljbvd"
+clr *r4
+clr *r7
+L268: .data 45, 947, -134, -174, 278, 373, 339
+cmp #186, #14
+L269: .data -44, 646, 305, 814, 756, -456
+jsr *r0
+jsr L272
+bne L0
+L270: .string "nyttxquekawfkhvzyoz"
+L271: .data -532, -140, 668, -924, -482, -466
+lea L284, L295
+L272: .string "fnupsv"
+L273: .data -610, 406, -915, 581, -483
+L274: .data -237, -831
+jsr *r1
+; comment
+L275: .data 825, -87
+cmp r3, L198
+dec *r3
+L276: .data 532, -539
+L277: .string "kdpcwdqpqihhs"
+L278: .data 895, -463, 351, 66
+L279: .data 821, -734, -838, 111, -230, -285, 632, 938
+L280: rts
+dec L214
+not *r5
+L281: .data -811, 615, 41, -164, -474, 855, -275, 39
+add #-178, r7
+add #71, *r1
+dec *r6
+L282: .string "rdncebsijpisfhmkcbeefz"
+clr *r5
+L283: .string "wbmdmperilhdnrjjnuezsfn"
+L284: .data 21, 922, 577, -352, 367, -322, -933, -435
+L285: .data -772, -85, 887, 182
+L286: .string "zkjyrhpdxjcbbz"
+L287: .string "hxpgbqtocykgvgpoyhzkayb"
+
+bne L69
+L288: add *r2, *r7
+L289: .data -601
+rts
+L290: .data -501, -424, 96, -132, -850, 855
+jmp L43
+L291: sub r3, L297
+dec r6
+L292: .string "renxoitwrbtsmigynebh"
+bne L220
+L293: .data -595, -399, -120, -894, -187
+red r4
+L294: .data -140, -977, 200, -492, 661, 716, 949
+L295: .data 387, -586, -25, -794, 676, -939, -807
+L296: .data -8, 492, 46, 182, 413
+L297: .data -848, -615, -743, -419, 247
+sub #46, *r5
+stop
@@ -0,0 +1,521 @@
+; Generated by genCorpus --seed 48
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+clr *r6
+L0: .string "kndgjbtapukzlav"
+red L2
+jmp L0
+stop
+red L251
+L1: .string "qtmxjscux"
+L2: inc *r6
+L3: .data 344, 80, -335, 996, 610, -280
+L4: jsr L3
+L5: .string "pcajbwoodptd"
+L6: .data -918, 991, -128, -867, -785, -216
+L7: .string "cyevcbuujyjpru"
+lea L230, L4
+L8: .data -300, 270, -318, 719, -265, -200, 259
+cmp r2, *r0
+L9: .data -50, -356, 695
+add L61, *r4
+L10: .string "jwskovfedcixksqmhswymnkk"
+not r4
+L11: add r5, r0
+L12: .string "qvnyinzlmjgbmmodgef"
+sub *r3, *r0
+
+cmp *r0, r2
+L13: .string "odlyrd"
+L14: .data 607, 857, 921, -645, 19, 515
+dec L238
+L15: .string "npeumvtocvbfppwddchxgz"
+L16: .string "rimzgqv"
+; comment
+sub r4, r4
+add *r5, L15
+L17: .data -834, 903
+jmp L11
+L18: .string "ux"
+bne L2
+L19: .data -616, -373, 344, -635
+add *r3, *r2
+bne L282
+L20: .string "ep"
+jmp *r1
+L21: .data -776, -546, 101, -523
+inc L4
+dec r6
+not L229
+L22: .data 898
+L23: .data -916, -233, 292, 836, 434, 557, -727, -283
+L24: .data 666, 983, 230, 904
+clr *r5
+L25: .string "u"
+L26: lea L8, *r0
+prn L20
+L27: .string "zuftxquzhoaby"
+red L8
+L28: not r0
+L29: .string "oenyhndd"
+cmp #161, #-246
+L30: .string "injcorknjktyqnoexgvtkx"
+dec r1
+L31: .string "htwntzlrzjaskeprj"
+L32: .string "ocab"
+L33: cmp *r1, L197
+not r6
+inc L28
+L34: .data -471
+L35: .string "bsmqlhbwbkrao"
+lea L34, r7
+L36: .data -466, 496, -953, -482, -763, 794, 517
+L37: .data 310, -843, -731, -356
+dec r3
+inc r4
+L38: .string "dajtedottsxmzfpulmbxyxh"
+inc L178
+L39: .string "ndnfbhjlmwavqymhooz"
+L40: .string "sgldcjod"
+; comment
+L41: .string "ostxdliinfqtpkhshqr"
+lea L8, L27
+L42: .string "kwpklqufvjnknynwbxic"
+lea L15, *r6
+L43: add *r4, L103
+L44: jsr *r7
+L45: .data 6, 588
+L46: .string "ziybolnd"
+mov r6, *r7
+L47: .string "tzqtmydtgfsnjdahm"
+L48: .data 887, 913, -198, 40, -465
+bne L54
+L49: .data 757
+L50: .string "nszlwqczmhhvhazzucdlg"
+
+L51: jmp L18
+rts
+L52: .string "hczyyojawcjmflwestdh"
+L53: .string "neuuhnim"
+L54: .data 408, -363, -493, 613, 684, -399
+jmp *r0
+L55: .data 356, -164, 868, 84, -215, 553
+clr r6
+L56: .string "brhgzfgksflyepsvfthk"
+L57: .data -482, 536, 254, -153, -973
+L58: .string "earaagkvm"
+L59: .string "bsijtqgcyac"
+L60: .string "istgbm"
+L61: .data -474, 933, 938, -474, -770, 393, 849, 274
+L62: .string "swnmbmoxxre"
+dec r1
+red *r4
+L63: .data -663
+not *r5
+L64: .string "yjefpnxnqywapw"
+clr r2
+bne *r1
+L65: .string "jopenzcvcupi"
+L66: .data -338, 383, -670, -750
+red r2
+L67: .string "ulsviiniir"
+inc r5
+not r1
+L68: .string "frldsqgrktkfcwmyjzzrba"
+lea L67, r7
+L69: .string "mywklkjda"
+not *r1
+stop
+L70: .data 309, -207
+dec *r0
+L71: .data -213, 124, -902, -807, -216, 417, 483
+cmp L1, *r5
+L72: add L148, *r2
+clr L2
+L73: .string "skyivgfqpwecrroiskisgc"
+red *r5
+L74: mov #59, L43
+stop
+L75: .data 829, -594
+jsr *r5
+L76: .string "kyd"
+L77: .string "nzphkdzvbtsvkqbuhq"
+not L288
+L78: .string "vvk"
+L79: .string "qtajzwfvtikh"
+L80: .data 746, -3, -163, 92, -956, -682
+L81: .string "iglqzyxdfmqqtyrbwco"
+L82: .string "ttqxypijyutdjpjwzvozqh"
+L83: .string "akvcvyipvdurh"
+L84: .string "lxuhowlavcrqnfbxgvtalrsu"
+L85: .data 20, 912, 758, 454, -189, -189
+L86: rts
+L87: .string "ujtivahevzt"
+L88: .string "juaawtwmuvzyras"
+L89: .data -93, -895, -989, -202, -295, 908
+; comment
+; comment
+stop
+prn *r6
+L90: .string "nfunycknvblipmpqtbey"
+L91: .string "ufiixsgjqfrvzenras"
+rts
+bne L79
+L92: .string "mimaygwkuvbvqkimno"
+jsr L165
+L93: .data -279, 695, 636
+stop
+L94: .data 630
+cmp r2, r6
+clr r0
+L95: .data -238
+L96: .string "lcvfo"
+stop
+clr *r7
+add *r3, L63
+red r5
+jmp *r7
+L97: .data 158, 335, 358, -352, -554, 900, 890, -867
+red L65
+L98: .data -660, -240, -53, 547, -940, 675
+sub L244, r4
+L99: .string "z"
+L100: .data -363, 926, -431, -357, 861, -813, 281
+jmp L219
+L101: .data -303, 601
+L102: .string "qmpwmjjmhjbynjzibjfclvzv"
+; comment
+L103: .string "dojshlsg"
+L104: .data -108, -901, 974, -523, -343
+sub L17, *r7
+L105: .data -650, 495, -535, 731, 126, 318, 676, -817
+stop
+cmp L201, *r1
+L106: .string "ztsbjpsnanncvcjoythb"
+L107: .string "dvsghvwcehlzlaatjcenq"
+L108: .data -169, 881, 693, -979, -724, -570
+
+L109: mov L71, *r6
+L110: .string "fynohshhdel"
+clr r7
+L111: .string "gpolicbovdjmlpfiyqy"
+jsr *r2
+bne *r7
+L112: .data 677, -479, 863, 323, -111, -687
+add *r6, L78
+dec r4
+L113: .string "bft"
+lea L94, r4
+sub #-120, L67
+red *r4
+L114: .data 654, 744, 892, 98, -878, -830
+L115: .string "ityfrxwsxawugncgblddhwah"
+L116: .data 723, -650, 676, 568
+; comment
+L117: .data -269
+L118: .data 37, 187, 29
+L119: .string "jikrpgst"
+L120: .data -790, -743, 504, 536, -870, 114
+L121: .data -458, -414
+L122: .string "o"
+
+; comment
+L123: .string "zzgcqgwjqhph"
+L124: .data -902, -433, 279, 374, 199
+; comment
+cmp r5, *r4
+L125: .string "slqryqxdum"
+L126: .data 658, 659, 74, -86, 91, -450
+inc r5
+L127: .string "ztdsalzqvovihnskgthmwv"
+jmp *r2
+L128: .string "b"
+L129: .data -829, -64
+L130: .data -226, 852, 773, -558, 638, -974, -640, 766
+L131: .data -578
+L132: .data -280, -237, -412, 119, 124, 807, 316, 619
+L133: cmp L133, #-76
+L134: .data 111, -814, -745, -444, 255, -993, -69, -487
+L135: .data 863, 547, 121, 365, -153, 894
+
+L136: jsr *r5
+not r7
+L137: lea L169, L189
+bne L5
+clr r2
+inc *r3
+L138: .string "ddo"
+cmp *r6, *r3
+L139: .data -318, -906, 663, 507
+L140: .data -11, -693, -524, -243, 349
+; comment
+L141: .data 970, -360, -226, -562, -338
+red r4
+L142: .string "islkhwdetbbuqnk"
+jsr L196
+L143: .data 632, 788, 750, -682, 952, -728, -938
+rts
+L144: .data 631
+L145: .data -959, 963
+L146: .string "mlvcjn"
+L147: .data -684, -518, 609, 90, -518, 374, 837, -378
+; comment
+L148: .string "nwumfbcvzxbadnxv"
+L149: .string "qwzgtvtvtnygejdidklgg"
+L150: .data -68, -984, 69, 641, 298, -540, 189, 702
+L151: .data 322, -902, -991, -127, -535, 961, -8
+rts
+bne *r3
+cmp *r3, r4
+L152: .string "upkzgqpuvmpfvw"
+stop
+rts
+L153: .string "qalihmfhpx"
+; comment
+L154: .data -777, -342, -858, 999, -724, 814, -389, 221
+L155: not *r1
+jsr L98
+jsr *r0
+prn #167
+L156: rts
+L157: .string "pwwhqkguuas"
+not r6
+clr r0
+cmp *r2, r5
+L158: .data 646, -875, -205, 503, -9
+L159: .string "bvzeb"
+L160: .string "teom"
+L161: .string "luuetuxaiuocs"
+not *r4
+add *r2, L300
+L162: .data -93, -771
+not *r2
+L163: .data -237, 933, 662, 995, -898
+L164: .data 632, -816, -287, 764, -895, 785, 888, -767
+rts
+L165: stop
+L166: .string "ndbqlfuvxbmel"
+clr r0
+L167: .string "qawfmyaxgutifxsss"
+L168: .string "dhgcvxq"
+L169: .data -920
+L170: cmp #58, r0
+L171: .data -245
+L172: .string "f"
+L173: .data -404, -702
+jsr *r2
+lea L160, L218
+L174: .string "tezrijpujrnqr"
+L175: .string "kmotfrmzxswtlwfcnnhene"
+L176: red r0
+L177: .string "lnupkifksymiabefwznwmzf"
+L178: .data 338, -728, -782, 519, -951, -301, -33
+lea L179, r2
+prn #201
+L179: .data -385, 58, 542, -331, 320
+L180: .data 431, 692, -366, 40, -98
+L181: .string "shkmlaxytbgvus"
+L182: .data 418, 226, 622, 93, 147, 1, -831
+inc *r5
+lea L210, *r1
+L183: .data 247, 583, 898, 217
+L184: .string "inirehebzq"
+L185: .string "obaukevlal"
+L186: .data -158, 383, 73, -304, 844
+lea L92, r2
+cmp *r7, r3
+L187: .data 956, 817
+L188: .data 742, -560, -626, 9, -592, -610, 549
+L189: sub r1, L209
+L190: .string "pkiu"
+prn r0
+L191: .string "ngwtfrqzphsket"
+L192: .data 86
+L193: .data -174, -254, -245, -300, 425, -797, 423, 888
+L194: .data 754, 673, 59, 792, -387, -876, 999, -877
+L195: .data -356, -214, -824
+L196: .data -59, 169
+L197: .string "ticzabkfhioioschczpvjpu"
+L198: .string "ihyyxnehidyopduq"
+lea L176, L263
+L199: .data 429, 340, 600
+L200: .data -226, 617, 763, -811
+L201: .data -321
+lea L209, L231
+L202: inc L204
+red *r3
+L203: .string "kvfzuceipvyvobi"
+mov L124, r7
+L204: .string "dtwptxginkizxynmkmsuna"
+L205: sub #-6, L276
+L206: mov L202, *r5
+L207: .string "c"
+jmp L236
+L208: .string "cgxsqxpejozbazwoih"
+L209: .string "karjwcy"
+L210: .string "olkzhesryezbkxvkaqswwp"
+L211: .data -223, 561, 651
+L212: .data 221, 165, 763
+L213: .data 889, 758
+L214: .string "tyepvubtdrfznltpldkby"
+L215: .string "arkzvowtcjwqwaeclygkjz"
+L216: .string "cldkk"
+L217: .string "nhvrwzdeje"
+L218: .string "iqxrm"
+bne L246
+L219: .data -411, -811
+L220: .data -849
+red *r2
+sub L243, L215
+not r1
+red r6
+rts
+lea L283, *r2
+L221: .string "bscnbhybhvenijhm"
+L222: .string "qzrwkhwfmcjlqntzd"
+L223: bne *r5
+L224: .string "sadjazn"
+L225: .data 279
+L226: .data 305, -625, 756, 103, 143
+L227: .data -168, -501
+jsr *r1
+L228: .string "eeiay"
+dec L191
+inc L294
+L229: red L86
+L230: .data -722, -821, -661, -986, -537
+lea L271, L261
+L231: .data 902, 165, 891
+rts
+L232: .string "uwfmvtryzxrmbmr"
+L233: .string "kgfjzscynezcahigtwwffk"
+L234: .data -425
+L235: .string "zwzkwamnbnqa"
+L236: red r6
+lea L266, *r7
+L237: .data 501, -936, 868
+L238: .string "vkezmbodfueificgsuqbbb"
+L239: .string "jgwujyjzyogjd"
+L240: rts
+L241: .data -318, 967, 9
+dec *r2
+L242: .string "qbpjvwdmkibesgmbeeeyte"
+L243: .data 925, 882, -115, 84, -159
+red *r2
+L244: .data 323, -154, -522, -938, -547, -532
+L245: .data 526, 877
+
+L246: .data 324, 7, -532, 716, -750
+L247: .data -554, -647, -772
+L248: .string "cdiywnusqx"
+L249: .data -791, -746, -720, -53, -167
+bne *r7
+L250: .data -330, 345, -252, 106, 245, -941, 636, 806
+L251: .data 73, -546, -990, -937, 604, 834
+
+L252: .data 242, 608
+sub r6, r6
+sub L277, L272
+L253: red r0
+L254: rts
+L255: .string "lddpznkqmikvxoqj"
+dec *r5
+L256: .data 439, -420, 801, 208, -729, -614
+L257: .data 879, 987, 444, 527, -161, 155, 526
+L258: .string "okrjvedagkmbdyua"
+clr r5
+
+L259: .string "qohoqkssqq"
+L260: .string "bddlexy"
+L261: .string "jbgc"
+L262: .data 924, -514, -997, 26, 855, -789
+prn r5
+L263: .string "ahipphwtxselucivrybi"
+L264: .string "j"
+L265: .string "lbedypehrgkkwwzkjbbblz"
+L266: .string "fjwumesbviuuhu"
+L267: .data -832, -329, -633, 861, -296, 640, -641
+L268: .string "sngftesbfmdcdtrzhc"
+L269: .data 539, 544, -635, 270, 508, 944, 995
+L270: .string "lpfkqgbf"
+dec L50
+lea L132, *r2
+jsr L284
+L271: prn *r7
+L272: rts
+L273: .data -782
+prn r1
+L274: rts
+L275: .data 221, -525, 58, 62, 407, 387, 18, -340
+L276: .data -882
+L277: .string "lbmtxsnotjpktx"
+L278: .string "wrudrxzdfkvok"
+L279: .data 797, -376
+add L136, *r5
+red L284
+L280: .data 798
+L281: .data -344, -370, -979, 450, 491
+bne *r5
+add r0, *r5
+stop
+L282: .data -598, 900, 657, -675, -620, -162, 863
+L283: .data 60, -135, 997, 158, -579
+jsr L106
+L284: .string "oknlyxirljsnweuareovtlat"
+
+mov r0, L285
+bne L298
+inc L301
+L285: .string "vgdk"
+jsr L184
+L286: .string "m"
+red L91
+red L289
+L287: .string "enjoefqtqfmuxbekbal"
+L288: .string "kritf"
+L289: .data 363, 914, -775, 130
+; comment
+
+stop
+L290: .string "qseeekxrpswqdwvwiq"
+
+not L300
+L291: stop
+rts
+L292: .string "quqr"
+L293: .string "teimvjfjzhuj"
+L294: .string "lwddnvqegx"
+L295: .string "wxontjbcezfztkvfkvka"
+prn #133
+bne L208
+L296: .string "uhqzcbpnewuewngqfgszhaq"
+
+L297: .data 992, -509
+red *r1
+cmp r3, L232
+cmp r1, *r5
+L298: .string "ctsxwgmiolrl"
+L299: .string "imrzsb"
+L300: .string "l"
+L301: .string "ewhxaiqaaixv"
+sub #16, *r0
+L302: .string "i"
+L303: .data 785, 373, -500, -677, 766, -917
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 49
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: bne *r6
+cmp r0, r2
+L1: .string "cubsqjfw"
+mov *r7, *r5
+cmp L236, r5
+inc r0
+bne *r7
+
+L2: .data -899, 477, 76, -380, 982
+L3: .string "gdnauqfaphow"
+prn *r7
+L4: .data 29, -162, -141, -928, -32
+add L106, *r5
+L5: .data 752, -741
+L6: .string "bmqjhysorew"
+L7: .data 814, -600, -547, -595, 172, -988, 223, -38
+not *r1
+not *r6
+L8: .data 689, 494, 399, 725, -926
+; comment
+L9: .data 420, 805, 532, -342, -160, 876, -116, -307
+L10: .string "dayu"
+; comment
+L11: .data -375, -229, -116, 185
+L12: .data -273, -431, -582, -736, 459, -27, 556, -661
+L13: .data 782, 753, 557
+L14: .string "tgqmwcxpemzxlpvpeadv"
+L15: cmp L134, *r1
+bne *r0
+L16: .string "ysjgcutzxgtq"
+L17: .data 83, 330, -263, 576, -400, -978
+L18: .data 882, 606, 200, -796, -453
+red *r4
+L19: .string "mrdzqosd"
+L20: bne *r7
+L21: .string "uxkukqj"
+
+L22: lea L45, L122
+L23: .string "fiyksbsz"
+rts
+L24: .data -32, -63, -313, 316, -540, 217, -663
+L25: .string "dcrsg"
+clr *r7
+L26: .string "nivqompznicqljpezxwwtxk"
+clr r2
+L27: .data -78, 580
+L28: .string "wgx"
+L29: .data -488, 439, 216, 116, 843, 304
+L30: .data 791, 23, -544, 628, -349, -660, -889
+L31: .string "zquiarbhemz"
+L32: .string "amys"
+mov *r4, *r7
+L33: .data 383, -835, -814, 667, -686, -769, -370, 619
+L34: stop
+L35: .string "rspnupmeesvkiqvqpgfo"
+L36: .string "jggm"
+prn r2
+L37: .string "n"
+L38: .data -48, -946, 472, -805
+L39: .data -212, 815, -51
+L40: .string "i"
+L41: .string "vacqfu"
+L42: inc r5
+prn #184
+lea L45, r4
+L43: .string "ncrxcga"
+L44: .string "haicgjyjj"
+prn #235
+L45: .data -204, -521, -244, -448, 959, 613
+add #-82, *r2
+stop
+L46: .data 230, -147, 868, -507, 334
+L47: .data 886, 685, 961
+clr *r0
+dec L289
+L48: .string "zujlymrcfiicdblfaauvrhba"
+L49: .data 21, -600, 174
+
+L50: .data -637
+stop
+L51: bne L40
+clr *r2
+lea L247, r6
+L52: .data 38
+mov r0, *r6
+L53: .string "cvciyfzcluhivqeagsl"
+L54: .data 638, 46, 207, 533, 779
+L55: .string "qffvmramdvxwynvvokor"
+L56: .string "xxzeufxawekxjfocylwcz"
+inc r5
+L57: .data 944, -569
+L58: .data 121, -404, 611, -137
+dec r6
+L59: .data -805, -832
+L60: .data 846, -53
+L61: .data 864, 981, 144, 785, 978, 757, 892, 269
+prn L17
+clr r7
+L62: jmp *r4
+inc L148
+cmp r4, r6
+jsr *r0
+L63: .string "jujsqwvsuttqe"
+L64: .string "jnu"
+lea L25, *r1
+
+L65: .data 553, 541, 963, -82, -698, 631
+L66: .string "kmqkr"
+add L4, *r2
+L67: .data -160, -501, 455, 656, -826, -864, -397, 852
+L68: .data 191, 974, 843, -779, 750
+L69: prn r5
+L70: .string "xhemhihqzlvszapwrtsqq"
+L71: .string "h"
+red L39
+L72: .data 969, -544, 579, 557, -470, -783, -135
+L73: jmp *r2
+
+inc *r4
+L74: .string "cohwwe"
+L75: .data 929, -500, -593, 477, -173, 341, -319, -5
+L76: .data -299, 132, -488, -968, 783
+dec *r7
+L77: .string "hevvipokmxr"
+mov r1, r7
+L78: .data 696, 152, -458
+red r2
+L79: .string "jyzfidozmfmzqoivzewft"
+L80: .string "m"
+cmp r3, #60
+L81: .string "googv"
+L82: .data -270, 162, 220, 588
+L83: .data -646, -215, -854
+L84: .data -143
+L85: .data -386, -804, -123, -107, -56, 800, 77, 577
+L86: cmp L282, r3
+mov r1, r1
+L87: .data -296, 217, -14, 105
+L88: .data -551, 962, -253, -239, -570, -37, 55, 824
+L89: .data -778, 577
+L90: .string "kcxuhqjpzujvbownp"
+clr L51
+L91: .string "xtgqyg"
+L92: .data 406, 160, -864, -48, 961
+bne *r3
+L93: .data 248, -283, 55, -290
+
+; comment
+L94: prn #247
+L95: .data 383, -848, 115
+L96: .data 284, 762, -56, 981, 220
+L97: .string "ivyxjshqcjqmntvo"
+L98: .string "ccmdfiq"
+add r2, r6
+L99: .string "evqtypqzmlypjdnfliwsfs"
+L100: .data 502, 354, 442
+L101: .string "ohkkcirodyiypqmtbirhgj"
+L102: .data 924
+L103: .data -658, 270, 719, 214, -907, -595
+rts
+L104: .data 135, -44, -677, -175, -943, 556
+
+L105: .data 287, -580
+add #130, r7
+not L163
+mov r0, r7
+L106: .string "wfchrxdh"
+L107: inc r0
+L108: .string "y"
+L109: .data -323, -890, -113, 611, -97, 696
+prn #-168
+L110: .string "igaqehxzesvvamobtyip"
+L111: not L264
+L112: .string "udhalc"
+rts
+red L151
+L113: .data 749
+L114: .data 519, -856, 818, -480
+L115: .data -816, 428, -74, 302, 786, 204
+L116: .data -983, -362, 766, 123, 865
+bne *r3
+L117: .string "xxqbhcx"
+L118: .string "lxtejtzhv"
+L119: .string "zdawcluekhvxqmkmpnhgwnxj"
+L120: .string "grkpodnckbgtyfpia"
+L121: .data 446, 603, -787, 705, 854, 215, 683
+L122: .data 560, 632, -317, -39, -794, -402
+jsr *r5
+L123: rts
+L124: .data -54, -23, -117, -867, -765, 244
+L125: jmp L152
+L126: .data -305, -649, 451, -771, -78, 928, 824, -671
+L127: .string "hubjpesusrujoivdlariwq"
+L128: .data 3, 79, -990, -711, 893, 733, 540, -28
+red L28
+L129: .string "dmdmoxa"
+L130: .string "fiwpvev"
+L131: .string "gxrrx"
+; comment
+bne L24
+L132: .string "zmawwiv"
+L133: .string "fflrrvpfiy"
+L134: .string "peqhwwjiqgmatsoenuubw"
+L135: .data -600, -737, -584, -590, -315, -749
+bne *r6
+L136: .string "fahvsxzk"
+L137: .data 937, -758, -456, -1000, -77, -902
+L138: .data -652
+stop
+L139: .data -400, 845, 444, -525
+L140: .string "auzghdgbnzmyykxfbsaszwb"
+L141: .string "vaoncpvchksewqpmvlvrx"
+L142: .data -736, -710, 986, 226, -235, 296
+L143: .data -386, -251, -91, 782
+
+L144: .data -777, 473, -566, -30
+L145: .data -868, 66, -736, -136, -223, 690, -287, -616
+
+L146: .string "eujbfkc"
+L147: .string "yobbtsvihugtcknrtizbtniz"
+L148: .string "qphlq"
+L149: .data -966, -308, -896, 652, -482, -925
+L150: .data -417, -325, -54, 42, -679, -485, -849
+prn #-38
+add L120, r2
+sub L210, r5
+L151: .string "rqtslpmrxctrx"
+red r6
+L152: .string "o"
+L153: .data 784, 186, 891, -846, -742, 883, -723, 371
+L154: .string "vzukdxwvfuobsvtzdonc"
+sub #-181, *r6
+L155: .data 679, -527, 494, -553, 822, 505, 353
+mov #59, *r4
+L156: .data 798, 258, -327
+L157: .data -594, 371, -149, 501
+cmp r5, L248
+L158: .string "ntqkdqrrsgfaav"
+bne L308
+L159: .data -787, -279, -515, -578, 381, -759, -955
+L160: jmp *r2
+L161: .string "rkwxhnhdqjgxnmykobiwdwl"
+L162: .string "skgg"
+L163: .data -241, 785, 559, 670, -159, 341
+L164: .string "dfacnwlobpwdnidbdmxsbzq"
+L165: .data -91, 962, -255, -505
+L166: .string "b"
+L167: prn *r7
+L168: rts
+L169: .string "qmruwvnafzaapmcy"
+rts
+L170: .data -955, 309, -461, 776, 277, -444, 431, 553
+L171: .data -833, 56, -572, -916
+L172: .string "g"
+L173: .string "bqeuyvzuupskfvgbnnz"
+jmp L17
+add L93, r3
+L174: .string "ysihjuh"
+inc r1
+L175: .string "vhixlhio"
+L176: .string "xzluoyzuzfdqia"
+L177: .data -524, -355, 386, -814, 888, 566, -619
+not *r6
+jsr *r2
+L178: .string "gbjcxqnbln"
+L179: .string "ncbxhjofjmt"
+L180: prn r7
+L181: .string "fewffuhoansywskt"
+L182: .string "cecsulsdteeetffo"
+L183: .data -661, -53, -417, -107, -458
+L184: .data 240, -406, -836, 230, -737, -585, -637
+jmp L39
+L185: .string "sokstbbzheakzn"
+; comment
+L186: .data -201, -503, -876, 636
+L187: .string "sccbbn"
+; comment
+inc L316
+L188: .data -453, -193, 652, 930
+L189: .data 396, -921
+L190: .string "kqw"
+L191: .string "dzrcfyzreswujhbby"
+
+L192: .data 697, -290, -967, -757, 672, 68, -765
+L193: .data -474, -127
+L194: .string "ctshbwvkurdybthqgn"
+L195: .data 138, 572, 275, -997, 471, -332, 419, -720
+L196: .data 857, -158, 748, -949, 788, -900
+L197: .data -9, 544, 34, 773, 741
+L198: .data 69, 968, 838, -11, 218, 322, -213
+mov *r3, *r3
+L199: .string "hrhqjzjieqldrgrsvkae"
+L200: .string "grggyrnetgeolrgcxkaa"
+L201: .data -320, -990, 153, -402, -114, 358
+L202: .string "ru"
+cmp *r6, *r3
+cmp L89, *r5
+jsr *r2
+L203: .data -218, 874, 746, 804, -114, -295, 675
+L204: .string "nm"
+L205: .string "ccgxseeixkoikijinrp"
+cmp *r0, *r5
+L206: .data 737, 517
+L207: .string "dwozbyonsyeeybqh"
+jmp L288
+L208: .string "qggeqz"
+L209: lea L300, r3
+sub #156, *r1
+L210: .data 36, 301, -46, -81, -545, -422
+L211: .data 371, -53, -967, 285, -934, -616, -77
+L212: .data 911, 549, -737, -438, -202, 977, -807
+dec *r3
+
+L213: .data -531, 974, 709, 675, -578, -232, -98
+not *r2
+lea L245, *r7
+jmp *r5
+L214: sub L140, *r0
+cmp *r3, *r2
+inc *r2
+L215: .data -683, 875, -356, 220
+L216: .string "txzozmjzvwcyo"
+L217: .string "hptnlxqrfcvnkjjkndk"
+L218: .string "duwtcsoersbfcvxhxjhq"
+L219: .data -244, 56, -628, 991
+jmp L199
+L220: .string "whjsvumfwdopvhdrhvsdlt"
+L221: .string "jcdwbblbbuidi"
+L222: .string "yqhrrxftnycoxattv"
+L223: .data 667
+L224: .string "snlmtptnuwsfvsjisfkx"
+L225: .data 766
+jmp L281
+L226: .string "ofjyjnrwqryime"
+not *r1
+L227: .string "qoictayfhag"
+clr L205
+lea L328, r5
+L228: .string "ttgppijma"
+L229: .string "iipbpnse"
+jmp L260
+L230: .string "obqcgfq"
+L231: .data -327, -538
+stop
+L232: .data -627, 888
+add *r2, r2
+L233: .data -915, -188, 291
+L234: .data 849, 952, -981, -36, 932, -809
+L235: .data -853, -912, -493, 419, -679, -722
+L236: .data 659, -806
+L237: .data -180, -412, 494, 718, -54, 779, -295, 823
+L238: .data -54, -931, -900, -203, 301
+clr L239
+L239: .string "lystrchkwuluxnfhsyzslqg"
+L240: .string "vvfrekuggjergdfdxssuc"
+lea L18, L58
+L241: .string "xnosdeca"
+sub #-145, r4
+bne *r4
+L242: .string "mzeqajiagkdilzberdk"
+L243: .string "ykdufbenyxojcium"
+not *r1
+L244: .data -635
+sub #230, r2
+clr *r1
+L245: .string "syrtl"
+L246: .data 478, -932
+inc r5
+
+L247: .string "bzpfnfcfgzxshisyrjc"
+L248: .data 178, -936, 688, -327, 460, -179
+L249: .string "ianhehwmbsaifxdiqgt"
+L250: .string "txngdvg"
+L251: .string "jvvdrsgcxp"
+cmp L202, L292
+lea L297, *r1
+L252: .data 223, -587
+L253: .data 533, -13
+L254: .data 56, 320, -241, -695, -179, 971, -10, -753
+L255: clr *r3
+L256: red *r1
+
+add L138, r6
+L257: .string "dnean"
+L258: .string "wybnnqtnibujssm"
+L259: .string "ldzxbqciqzgrwxrkbxwysnbv"
+L260: .string "rw"
+L261: .data -465, 549, 115, 954, -97, -390, 28, 72
+bne L69
+stop
+L262: .data 758
+L263: .string "gubztdratdxbbdsb"
+L264: .data -878, 128
+inc L280
+L265: .string "aly"
+jsr L298
+L266: .string "eawjf"
+L267: .data -84, 330, 408
+rts
+L268: .data 782, 981
+lea L27, L58
+rts
+L269: .string "gg"
+L270: dec *r4
+L271: .data -25, -187, -254, 714, -28, -791, -244
+L272: .string "r"
+L273: .string "mqmjfemhn"
+dec r5
+prn L182
+L274: .string "msdoadpcrszyvakmkga"
+L275: lea L77, L241
+L276: .string "gsraohrvslftpazadx"
+L277: not *r7
+jsr *r3
+lea L280, L303
+L278: .string "oovgdktymzjenfh"
+L279: .string "lcqe"
+L280: .string "ypoutz"
+L281: .string "gjmvqwpzpgwj"
+
+L282: .string "vw"
+L283: .data 436, 425, 809, -658, 584, 724, -449, 340
+L284: .data -79, -900, -382, -223
+L285: .string "gpaaigwb"
+clr L322
+bne *r2
+sub #-57, *r4
+stop
+L286: .string "cfyflamfqbyvbqx"
+stop
+sub #-23, L300
+L287: .data 774, 882, 135, -380, 318
+add *r6, L300
+L288: .data 881
+L289: .string "lajpyq"
+L290: .data 389, 103, -557, -379, 352, 662, 116
+L291: .data -343, 838, 926, -316, 300, -975, 532
+L292: .string "duntjpitbuhw"
+jsr L325
+L293: .string "nmzojeptxovcues"
+L294: .string "ksnjo"
+L295: .string "sgwxwoejpnuxnweeaygjijp"
+jsr L307
+L296: .data 55, 595, 500
+L297: .data -822
+L298: .string "bvjqyqf"
+; comment
+L299: clr *r6
+L300: .string "tanhozcben"
+not *r7
+L301: .data -885, -872, -882, -279, -474, 641, -984, 139
+L302: .data 123, 720
+L303: .string "jqqezbbxefzmxrx"
+L304: prn #28
+L305: .data -624, 751, -436, 683, -476
+L306: .string "zlqzowqcliawihxmlwsazwlp"
+L307: .data -526
+L308: .string "bkwlexmfoyzzcqzqyouke"
+L309: cmp #-135, L189
+L310: .string "vbszbze"
+L311: .data -217, -807, -341, 173, 477, 148
+bne L52
+bne *r1
+L312: .data 904
+L313: .string "h"
+L314: .data -384
+rts
+not *r2
+L315: .string "fszvjfvgmgjzg"
+sub L15, L247
+rts
+L316: .data 418, 971, 931, 455, 485
+L317: .string "dpvdux"
+add r4, r1
+jmp L321
+L318: .data 919, 595
+prn r6
+L319: .data -212, -555, -928
+L320: .string "fgirwjumdotvftltcincoioj"
+L321: .string "qpriyeidfarphqut"
+
+jmp L326
+
+L322: .data -960, 807, -302, -536, 7, -651, -853, -131
+L323: .string "kb"
+
+L324: prn L267
+L325: .data 86, 429
+mov L328, *r0
+cmp #-163, L60
+L326: .data -825, -408, 844, 115, 471, 311, -834, -998
+L327: .string "fkrszugzkgjtfyp"
+L328: .string "jjszvfka"
+L329: .string "qmmcdobdacgp"
+L330: not r2
+L331: .string "qyhfqfb"
+clr L332
+L332: rts
+rts
+
+stop
@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 50
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+lea L172, *r7
+dec L83
+L0: .data 18, 637, 497, 789, -982
+L1: .string "obebitrzmvhacjzvxdplfadm"
+L2: .data -554, 674, -156, -985, -717, 311, 382, -869
+; comment
+L3: not *r2
+L4: mov r1, L208
+L5: .string "glpztg"
+L6: .string "oj"
+L7: .data -861, 339, -604, -20, -158, -598, -259
+sub #135, *r7
+L8: .string "djuzdeqkqhjbhfrqjijc"
+stop
+bne *r6
+mov L0, r1
+L9: .string "dqmus"
+L10: .string "phyqzkjpmnzzluafxuiw"
+dec r5
+L11: .data -496, 989, 269, 624, -215, -943
+dec L75
+L12: .string "kaw"
+bne *r6
+L13: .string "wcpiwmbgfqbcqumora"
+L14: .data -711, -886, -470
+jsr L83
+L15: .data 101, 730, 927, 19, -126
+stop
+
+L16: .data -84, -854, -826, -130, -110, -499, 799, 359
+L17: .data -570, 484, -745, -285, 96, 914, -134, -808
+L18: .data -50
+
+L19: .data 656, -886, -119, -665
+L20: .string "xhonndy"
+sub #-256, r3
+L21: .string "ytyvgyvbqehgwgivjxx"
+L22: prn #-103
+L23: mov #62, L4
+inc r3
+L24: .string "bhaerupsdf"
+L25: .data 188, -792, 541, -809, 879, 889
+; comment
+L26: .data 953, 565
+L27: .data -877, -818
+L28: .string "jqfx"
+L29: .data -43, -368, 184, -183
+lea L6, L298
+L30: .data 594, -47, -674, -905, -181, 497
+inc *r2
+lea L4, *r5
+L31: .string "lghbeyncn"
+L32: add r0, *r6
+L33: .string "ggbcmzmlbpjmq"
+not L12
+L34: .data 87, -552, -74, -978, -676, 334, 20
+L35: .data -912, 751, -989
+; comment
+cmp L268, #-99
+L36: .data 656, 426, -330, -385, -145
+L37: lea L23, *r0
+L38: rts
+L39: .data -932, 252, 575, -101, 503
+L40: mov L261, r4
+mov L215, *r5
+jmp L217
+L41: .string "sfogzatiyhunygzh"
+dec L22
+L42: .string "zsmoflvsxtbuazdia"
+L43: bne *r3
+L44: .string "wof"
+L45: .data -449, -605, 651, 898, 922, 988, -403, -958
+L46: .data -818, 375
+L47: .string "fn"
+
+L48: .data 147, 13
+L49: .data -755, -39, 364, -231, -495
+L50: .data -782, -322, 937, 737, 657, 168, -953, -307
+red r1
+dec r0
+L51: .data 399
+L52: .string "igzdajotjvtcybnezlnnm"
+L53: .data 22, 53
+not r5
+L54: .data -315, -632, 406, 915, -941
+L55: red r4
+L56: dec L269
+stop
+bne L203
+inc r5
+stop
+L57: .data 479, -567, 855
+not r2
+L58: .data -470, -956
+L59: bne *r7
+not L1
+L60: .string "dppeyhaberdis"
+sub #-50, r4
+L61: .string "mgitubxjejvjfmxovr"
+L62: add L47, L63
+L63: .string "dcpxxgqayamkazlu"
+add #141, r4
+L64: .data -659, 675, -369, 628, -436, -501
+L65: .string "u"
+add L0, L42
+L66: .string "vwhyolugami"
+
+L67: .data 687, -580
+L68: .data 241, 352, -507, -464, 993, 517
+L69: .data -764
+L70: .data -527, -510, 337, -417, -426
+stop
+prn L220
+L71: .string "dtulmvtovboqfvjtgfnmsod"
+L72: .data -475, -188, 317, 956, -347, 866, -436
+L73: .string "alhrgecehurmbldcilfki"
+L74: .string "sptfyvntxpxddlyqbta"
+stop
+L75: .string "bgqdt"
+L76: .data -784, 912, -266, 78, 268, 583, -421, 985
+L77: .data -962, -995
+rts
+L78: .string "jkdviu"
+L79: .data 509, -205, -269, 44, -513, 716, -31, -963
+clr r6
+L80: .string "xfgvzokyrge"
+L81: .data -453, 218, -525, -536, 927, 760, 311
+L82: .data 551, -764, 883, 266, -993, -769
+L83: .string "jwrpituvryj"
+L84: .string "bizrvzwfx"
+L85: .data 777, -546
+L86: .data 673, -897, -120, 69, 746
+red r7
+prn *r4
+
+L87: .data 958, 711, 238, -410, -765, 992, 760, -255
+L88: .string "ee"
+L89: .data 673, 768, 123
+cmp *r4, *r5
+L90: .data 232, 754, 716, 182
+L91: .data 93, 561, 734, 345
+not r2
+red *r7
+L92: .data -13, -953, 180, -529
+L93: .string "iviygvdmsuyqi"
+lea L20, r3
+L94: .string "jou"
+stop
+L95: .string "vzpxrdiao"
+L96: .data 742, 281, 11, -575, 115, 533, -735, 549
+L97: dec *r0
+not L75
+L98: .data -52, -940, -214
+prn L46
+L99: .data 813, 439, -785, -380, 256
+L100: .data 643, 884, 815, 744, -266
+L101: .string "isvmglfdlulhpjnpzrzri"
+mov r0, r1
+rts
+clr r4
+L102: .data -54, 377, 983, -963, 517
+inc L86
+rts
+L103: .string "xinplpvmozqavukhaozgnlui"
+L104: .data 143, -344, -464, -21, -436
+L105: .data 142, 55, 886, -823, 823, -52, -568, 870
+clr L2
+prn *r0
+L106: .data -102, -559, -326, 256, 856, -431
+mov #117, L172
+dec *r4
+L107: .string "nimqlhnbircm"
+; comment
+prn r7
+mov r5, r6
+sub L46, r5
+L108: .data -83, -981, 554, -109, 544, 123, 458
+prn #169
+prn #-123
+L109: red r6
+L110: .data -934, -763, -290, -413
+L111: .data -575, -532, -795, 204
+L112: .data 155, 608, 366, 261, 924, 24, -652
+L113: .string "zesnwxegixzhmqrtvdfs"
+L114: .string "ta"
+L115: .data -641, 601, 551, -97, 985, 132, -137
+prn r2
+
+L116: .string "mhuqflujezl"
+L117: mov #89, *r1
+rts
+L118: .data 0, 698, 857, 872, 138, 72
+L119: .data -651, -795, -331, -643
+bne *r0
+dec L10
+L120: .string "jgvunrxagmehdwkne"
+red r0
+L121: dec L223
+dec *r6
+L122: .string "hewzdadhfzcqy"
+sub L51, r3
+not L10
+rts
+L123: .data -165, -10, -178, -523, -812, 468
+L124: .data -87, 897, -44, -813
+jmp L27
+L125: .data 791, -224, 570, 217, -140, -928, -631, 530
+not L152
+L126: .string "wxurbnjljvgvdsej"
+L127: .string "iauftsprasaubocapgzrm"
+L128: .data -206, 844, -319, -455, 745, -527
+bne *r3
+; comment
+sub r6, r0
+L129: inc r5
+sub r4, r5
+L130: .data -628, -854
+L131: sub r6, r4
+L132: .string "irme"
+L133: .data 84, 577, -194, 56
+L134: .data 181, -503, 444, 750
+stop
+rts
+L135: .data 492
+; comment
+L136: .data -728, -706, 864, -978
+mov *r4, r4
+L137: .string "djcl"
+L138: jmp L219
+L139: mov #192, *r0
+L140: .data 683
+L141: .string "xaioljvtblurt"
+L142: .data 248, 60, -351, 420
+inc L105
+L143: .string "rwgealzndnvfadokhrek"
+L144: .data -366, -183, -485, 972, 606, 98, 489
+rts
+L145: .data -34, 29, 521, 746, 850
+L146: .data 255, 858, 546, 336, 173, 809
+L147: .data 181, -211, 364, 422, -133, -455, -754
+L148: .string "csvcvpdzyjkbkpbjavofoaa"
+
+sub r3, *r4
+L149: .string "rcttgkqgbelyffoigt"
+L150: sub L241, L83
+L151: .string "geoozikrkqfplaszssbrpvl"
+cmp *r7, *r5
+cmp r1, L8
+L152: .string "kinuylcucdebksc"
+L153: .string "j"
+L154: .string "wfcsvjdwzq"
+; comment
+L155: inc L47
+L156: .string "ewneqjizsbjbistpfswmd"
+L157: .string "ckhfjzjhmaaxnhldrhdhbklw"
+add #-48, *r2
+L158: .data 341, -737, -759, 707, 750, -743
+L159: rts
+rts
+add r7, r2
+L160: .data 244
+L161: .data 297, 414
+L162: .data -140, 983, 281
+sub L169, L106
+stop
+add #-11, *r4
+L163: .data 924
+L164: .string "vyhwhon"
+mov *r3, r4
+L165: .string "yphqjkupyqlzuvnfmwiojlt"
+L166: .string "wqxchnfadpcezzgoxkdaty"
+L167: .string "yhcqnnlbyyzzjao"
+L168: .data -803, 646
+L169: .string "iyhqcyqv"
+L170: add L288, r5
+L171: .string "afrzgalk"
+L172: .string "cebrcnvnajbhs"
+red L10
+L173: .string "dmlwamwy"
+L174: .data 114
+L175: .string "cisxvfcknfybztribkkgi"
+L176: .string "bnfheblnjcmxowadhshx"
+L177: .string "iwouznxydlhotgtjekoo"
+
+L178: .data 555, -631, 426, 974, -250, 303
+; comment
+L179: .data 655, 826, 178, 652, -242, 373, 392
+L180: .data 480, 986, -955
+L181: .data 773, -251, 566, 911
+L182: .data 508, -803, 116
+L183: .string "hjrzmapavufultxpxlokxyvn"
+red L241
+L184: .string "mjqudzzsuukyyn"
+L185: .string "lculoelnuycywv"
+
+
+
+L186: .data 828, -607, 469, -213, 783
+mov #-194, *r3
+jmp L66
+L187: .data -596, -822, -128, 940
+jsr L219
+inc *r1
+; comment
+L188: .string "ep"
+L189: .string "elkuqotuhx"
+L190: .string "myrjlezsyxbyw"
+L191: .data -399, 758, 52, -156, -203, -912, 557, 746
+L192: .data 472, -584
+L193: .data 751, 649, 739, 912, -614
+sub *r0, L1
+
+L194: .string "rwjiawdpkxi"
+L195: red r4
+L196: .data -752, -209, 304, 867, 820, -64
+L197: .string "pmonmnbz"
+L198: .string "bwrjlrvnmuijdwmqkoddktvk"
+L199: .data -638
+
+prn #-242
+add r7, L188
+jmp *r7
+mov L180, L49
+L200: .data 250, -292, -50, 673, -74, -653, 553
+L201: .string "yqbvofwqumzdqrblowybs"
+jmp L211
+inc r6
+rts
+L202: .string "uwyobwuygrkygzrp"
+L203: .data 377, 554, -713, -115, -468, 739
+L204: red r5
+L205: cmp *r2, *r6
+stop
+rts
+prn r4
+clr *r7
+inc L150
+L206: red r1
+cmp #239, #-2
+L207: .data 8, 533, -520, 619, 373, 212, 845, -66
+; comment
+L208: .string "naoi"
+L209: .data -30, 693
+L210: .data -57
+L211: .data 336, -501, 483
+inc L204
+L212: .string "rnxy"
+; comment
+L213: not r3
+L214: clr r2
+
+red *r2
+L215: .string "lgbrbrl"
+L216: .string "qqqqipxqsqucapm"
+L217: .data -844, 46, -696, -70, -932
+L218: .data -736, -820, 315
+L219: .data 631, 980, 250
+dec L106
+L220: .data -588, -805, 959, 766, 436
+L221: .string "boiesakmkvcpxnclprm"
+lea L170, L217
+L222: .data 369, 19, 865, 768, -859, 255, 895
+stop
+L223: .string "wdefdfesqyeugtaibxox"
+L224: .string "znymlzfsefvpkzvia"
+rts
+; comment
+L225: .data -914, -403
+L226: .data 834, 6
+jsr *r2
+stop
+L227: add L281, r5
+L228: .data -209, 430, -607, -323, -707
+L229: .data -357, 917, 140, 381, 111, -382, 998, -580
+stop
+red L169
+L230: .string "c"
+not r4
+L231: .data -876, 679, 876, -109
+L232: .data 831
+lea L89, r4
+jsr L209
+sub *r4, *r0
+L233: .string "ewnqhsfsguzsbbmimqejmnp"
+L234: .data -519, 832, -204, 604, -752, 155
+prn r0
+
+; comment
+L235: .data -63, -679, 848
+bne *r1
+L236: .data -227, 764, -563, 760, 924, 18
+L237: .data 76, -544
+L238: clr L192
+L239: .string "ibcgpomdtegcntkmcbu"
+L240: .string "mvztyceu"
+L241: .data -338, -776, -288, 883, 940, 389, 234
+add #10, *r1
+mov L295, *r1
+L242: .data 366, -658, -882
+sub r2, L251
+dec r7
+red *r6
+L243: .string "ugzf"
+L244: .string "mxmvkjyaogcctwbmrzviq"
+L245: .data 765
+red L188
+L246: .string "hruqmlfccgrbpzhx"
+L247: .data -826, -560, 106, 286, 803
+L248: .data 851, 637, -993, -73
+clr r6
+L249: bne L254
+L250: .data -564, -713, -420, -679, 580, 557, 560
+L251: stop
+L252: .data -711, 909, 485, -308, 19, 377, -939
+dec L293
+L253: .string "gbamgrnzid"
+L254: .string "xjsxwdooubjjrwynj"
+inc r4
+L255: .string "ofuwt"
+clr r5
+clr r5
+L256: .data -324, 214, -757, 696
+L257: .data -87, 99, 395, 609, 773, 790, 536, 417
+L258: .string "xyiglqfdpord"
+L259: dec r6
+L260: .string "qkjuopnnucs"
+L261: .data 811, -501
+stop
+prn L268
+sub L178, L49
+L262: .string "qcadwrgmzedwdicbg"
+bne L82
+L263: .data 432, -811, -46, 694
+
+L264: .string "lulnsxopzws"
+L265: .data -572, -919, -351
+jmp L284
+L266: .data 935, 101
+mov r3, r4
+jsr *r0
+lea L24, *r6
+L267: .data 624, 697, -119, 898, -331, 742
+L268: inc r2
+L269: .data 653
+L270: .data 781
+not r5
+L271: .string "qgroyvoiyjrj"
+L272: .string "kwwrkpz"
+L273: .string "ibc"
+L274: cmp #-154, r2
+red L298
+L275: .data -174, 169, -246, 891
+L276: .string "akednyqicmmwiwtkrggwhdzc"
+L277: .data -296, -872, -294, -718, -498, -766
+L278: .string "ikaqhshcqjscrkh"
+L279: rts
+L280: .string "btdyaaecpqclmpdhbn"
+L281: .data -610, 579, -376, -686, -843
+L282: .string "nqyfre"
+L283: .data 412
+L284: .data -407
+prn r0
+
+L285: .data 327, 733
+L286: .data 456
+L287: .string "lkgfczflpgkdei"
+
+bne L158
+jmp *r4
+L288: .data -851, -716, -140, 200, 282, 993, 934
+L289: .string "fjykkvq"
+L290: .data 256, 915, -211
+L291: .string "kzwbosbsinagjjcdl"
+L292: .string "cofojfmfcvhfhjy"
+L293: .string "anpsjmwnzdcnpcrsqldwit"
+mov #52, L244
+L294: .data 155, 711, -489, -448
+stop
+L295: .string "eutbfuvttlpl"
+not L306
+L296: .data 770, -598, 268, -925
+L297: .data -930, 53, 783, 139, -575, -757, -230, -60
+sub r2, *r3
+L298: .string "lqeglwscvftvhnung"
+L299: .data 944, -953, -793, -702, 615, 921
+
+
+L300: .data 142, -984
+L301: red L226
+prn L302
+L302: bne L307
+L303: .data -55
+mov *r1, r1
+sub r4, r6
+L304: .data -742, -624, -42, 967, 786
+jmp *r6
+L305: .string "mgsmnnrzgyohzpezigge"
+L306: .string "ueosgvdeejphouhk"
+clr r2
+L307: .string "uiqojlcqlhnckjdd"
+stop
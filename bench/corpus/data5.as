@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 6
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+L0: .data 103
+jmp *r5
+L1: .data 655, -665, 356
+L2: .data -805, -62, -330, -161, 980, -999, 360
+clr *r2
+stop
+add L66, r1
+stop
+L3: .data -624, -776, 86, -198, -989, -698
+L4: .string "dvpoetcmavrtkxfsefxtsjt"
+L5: .data 811, 681, 683, -70
+L6: .data 778, 771, -610, 676, 218, -960, 272
+L7: .data -370, 717, -495, -537, -651, 961
+L8: .string "myayswpwacpcoiavockl"
+L9: sub L108, r1
+L10: .string "xhmjrfhqkbqakcpakl"
+L11: .string "leickpoodwj"
+rts
+sub r6, r5
+L12: .string "mkkvguyudthi"
+L13: .string "jrpiavnpde"
+L14: prn L2
+L15: .data 983, 537, 294, -241, 584
+L16: .string "tycjofwgrgmfyjpvbnzongx"
+dec *r7
+bne L2
+cmp #-188, L8
+L17: .string "rsismoywpjihk"
+clr r1
+stop
+L18: .string "gnhvkmvybghw"
+jsr L243
+red r0
+L19: .data 587, 857, 981, -185, 617, 310, -366
+L20: jsr L20
+dec *r2
+jsr *r5
+L21: .string "srxkxac"
+add r2, *r7
+red L221
+L22: .string "ljyvelkwehocgfbto"
+L23: .data 536
+L24: inc *r6
+L25: .string "bxctogimau"
+L26: .data 770
+L27: .data -554, 151, -525, 712, 756, 250, -552
+L28: .data -58
+L29: .string "gwncpexycdaetiroz"
+red *r3
+L30: .data 95, 259, 657, -177, -593, 239, -572
+L31: .string "zs"
+bne *r5
+mov #-224, r6
+sub *r7, r0
+L32: .data -361, -482, 39, -357, 92, -58, -722, -238
+not r2
+L33: .string "tfnxemxbmherfsrwis"
+L34: .string "lkkvduwkyfvnvngienzkzto"
+lea L260, r4
+L35: .data -680, 558, 914, -700, -435, 213
+L36: .data 570, -986, 492, 854, -28, 703, 405, 445
+L37: .data 926
+L38: .string "kwkkgvwiewsi"
+L39: .data -769, 568, -560, -48, 296
+L40: .data 553
+L41: .string "brwqqrcxet"
+L42: .data 158, -391, 290, 377, 674, -75
+L43: .data -612, 780, -678, 551, 173, -46, -537, 912
+L44: .string "xlrmawkikngtbjeuagy"
+clr r7
+stop
+dec *r3
+
+add #226, *r1
+L45: .string "yvhfwqqrzhfyprddvrwvre"
+L46: .string "twdqxhesaexdxgh"
+jmp *r0
+rts
+L47: .data 41, 240, 656, 753, -894, -129, -101, -486
+clr r5
+dec r6
+; comment
+L48: .string "hnkrxxanovynyffpnqbrvg"
+prn L297
+L49: .string "ooqcrfdrnljjwkvqlw"
+L50: sub #-50, L8
+jmp L50
+L51: .data 339, -928
+L52: prn L1
+; comment
+prn r1
+L53: .data -832, 484
+L54: .data -725, 876
+L55: .data 502, -351, 792
+; comment
+L56: .string "lsuescsfjsdgobjmvkbod"
+L57: .string "ydzun"
+L58: .data -248, -330, -457, 746, -396
+L59: .string "qhlytztitvjqeqxwm"
+dec r1
+L60: .string "sjkepsyzxzriyxbtntbynnm"
+; comment
+L61: .data 545, -122, 881, 862
+L62: .string "vwxfeydb"
+
+bne L244
+L63: .string "iclbbcpjknxuxavzpnbjqold"
+add *r3, r6
+not r2
+L64: .string "uf"
+L65: .data -660, 289, 728, -210, 568, -563, 824, -671
+L66: .string "fmxyg"
+stop
+L67: .data 110, 598, 714
+L68: .data 67, -58, -671, 688, 627, 481, -191, -381
+jsr L52
+L69: rts
+L70: .string "aipknjajw"
+L71: .data 145, -26, 568, -424, 572, -231
+L72: .string "sqixvgbeoel"
+L73: .string "eciubtmoteuyfhjllrsyvxnd"
+cmp #-235, *r4
+prn r6
+inc *r5
+L74: jmp L67
+; comment
+L75: .data -291, -791
+not r5
+add r6, *r2
+L76: .string "bhbqufktimphgcopt"
+prn L177
+L77: .string "waakemq"
+L78: .data -181, -858, 399, 582, 429, 542, -140, 710
+L79: .string "owl"
+L80: .string "mamxpmtsedtys"
+L81: .string "khorfgclciu"
+L82: .data -315, 845, 959, -16
+rts
+L83: .data 32, 382, -725, 891, 836, -127, 311, -895
+bne L74
+L84: rts
+not L203
+L85: inc *r4
+L86: .data -745, -859, 568, 16, -713, -765, -613, 393
+L87: .data -210, -427, 232, 231, 873, -808, 988
+L88: inc r3
+L89: .data -748, -877
+L90: .string "udltuhywzscmjlqqfxzwlq"
+L91: .string "tuvvdaoafr"
+L92: .string "fgitf"
+L93: .data 677, 622, -803, 652, -697, -91, 998
+sub *r3, L270
+L94: .string "osceqdogjdba"
+L95: .string "ynkskjsfgira"
+L96: .data 398
+L97: .string "fesdrje"
+L98: .string "vhb"
+L99: .string "sqret"
+L100: .string "omovijukzmomkpbhtxd"
+L101: .data -9, 349, -452, -336, -817, 49
+red *r5
+L102: .string "wim"
+L103: rts
+cmp #132, r4
+clr r5
+L104: .data -83, 372
+L105: .string "yntxxyleggergzevepayan"
+L106: mov L225, r1
+L107: .string "erwxnixqfxkx"
+L108: .string "clrafffoywyqv"
+L109: .data -671, -805, 442, -816, 260
+L110: .string "vciulecnovtzsngqd"
+L111: .data 281, -719, -845, 128, -488, -140
+L112: .data 193, -343, -694, 994, 152, -571, 885, -800
+L113: .data 45, -31, -540, 857
+stop
+mov r6, L87
+L114: .data -140, -668, -939, -945, -258, -256
+L115: lea L26, L79
+L116: .data -812, -485, -105, 664, -576
+L117: .string "xn"
+L118: .string "vfvteykfyovmquodljybkuhg"
+L119: .data -73
+L120: .string "xrekrtyucoydedqxunwfn"
+jsr L87
+L121: .data 775, 445, -386, 226, 347, 94, -299
+cmp L285, r7
+rts
+jmp *r4
+L122: .data -274, -432, 645, -979, -155, -811
+L123: .data -795
+L124: .data 856, 601, -885, -97, 255
+clr r0
+bne L61
+L125: .data -277, -842, -269, -53, 52, 333, -384
+; comment
+L126: .data 447, 746, 158, -856, 885, 968, -459
+L127: .data -248, 575, 49
+L128: .data 845
+L129: .data 177, -574, 132, 870, -487, 171
+L130: .string "dddfiufbbmdv"
+L131: red L48
+L132: .data 345, -722, 504, -887, 308, 952
+L133: .data 903, -434, -956, -213, -783, 43, 520, 904
+bne L85
+L134: .data -100, -883, 419, 267, -797, 569, -793, 544
+
+bne L61
+L135: .string "oysogenqvjk"
+inc r0
+L136: .data 850, 886
+L137: .string "ffvmguffaltcbnqcjwicqe"
+L138: .string "lydzm"
+L139: .string "tjmefdixwdtcoic"
+L140: .data 506, -542, 534, 461, -500, 782
+lea L147, L112
+L141: .string "pnmdaqhuotkzyzuh"
+L142: .data 215
+stop
+inc *r7
+cmp #122, *r1
+L143: .string "ruyunrshgnytbsruncuupa"
+jsr *r7
+bne *r7
+L144: .string "qtgqlqqwiosqrtvgyfcgad"
+bne L14
+L145: mov L6, *r0
+cmp *r4, r2
+L146: .string "aajufqdvraphpgukz"
+L147: .string "zhbshbl"
+jmp L169
+L148: .string "bipunbqmeupykocu"
+
+L149: .data 295
+L150: .data -178, -323, -80, 544, -546, -776
+L151: .data 478, 628, 978, 18, -563, 403, 677, -626
+
+L152: .string "pgvaxctnztwxgx"
+L153: .string "ugzlogosnbg"
+L154: .string "ghfdbilwcfttjmyzxdjzurll"
+L155: .string "hsbknblqccwqfi"
+L156: .data 151, -356, -117, 986, -112, 736, -319, 988
+L157: .string "pttwtqwmlusmmgqlrztrs"
+L158: .string "s"
+L159: .string "papinfrvbjq"
+clr *r2
+L160: .string "eam"
+red L236
+L161: .data 6, -517, 965, -715, 939, -173, -467, 65
+prn #-95
+L162: .data 808
+inc *r5
+stop
+jsr L223
+L163: .data -753, -702
+lea L6, *r1
+L164: .data 714
+not r7
+; comment
+mov r1, *r3
+inc L119
+L165: .string "lhwyhcry"
+not *r1
+bne L64
+L166: .data 238, -3, -93, -868
+L167: .string "klpzjhqxiqp"
+inc *r1
+bne *r3
+L168: .data -132, -982
+L169: .string "wknbccgcsia"
+inc L244
+bne *r0
+L170: .data -351, 47, -790, -12
+L171: .data 800, 492, 948, 893, -313, 615
+L172: mov L7, r2
+L173: .data -460, 375, -998, -462, 639
+jsr *r6
+stop
+clr L28
+L174: .data 473, 939, -953, 137, -759, -792
+add *r3, L16
+prn L115
+L175: .data 79, 121, -324, -921, 283, -506, -384, -594
+clr r5
+jmp *r4
+L176: .string "hrasfpu"
+L177: .string "qzquwal"
+rts
+L178: .data -143
+L179: .string "qhfhbjzeiuom"
+L180: .string "bniwegkxjydipxpyjaeg"
+clr L298
+cmp r3, *r2
+clr r6
+L181: .data -624, 598, 811, 63, 393, -966
+L182: .string "wvoslyvl"
+L183: .data 435, 852, 742, 583, 420
+L184: .string "bbbjfmqkpzmhuo"
+prn *r0
+L185: .string "vgxpplvhzjecvmkbkvnqptc"
+dec *r4
+L186: .data -66, 800, 44
+L187: .string "dnqglqn"
+L188: .data 346, -201, 919, -63, -108
+cmp #-60, L153
+L189: .string "jsueovsfamgjx"
+L190: .data -527, 923
+L191: .data 754, 827, -871, -930
+add r7, r0
+L192: .string "egayivjmq"
+prn #133
+L193: .data -303, -923, -195, -393, -648, 712, -570, -880
+L194: .string "mc"
+L195: .string "tbdbwbtgr"
+L196: .string "swntitxhyiohbeanugqcn"
+L197: .string "esslrea"
+rts
+mov r7, *r7
+L198: .string "ijslpazsz"
+L199: .string "ojhahnqvrfgnyaar"
+L200: .string "jdwmmx"
+L201: .string "goi"
+L202: .string "rjkxsoyqidklozwmd"
+red r0
+L203: .data -458, 869, -493
+lea L206, r6
+; comment
+L204: .data -755, -449, -536
+L205: .data 858
+L206: lea L169, L96
+L207: .string "chkarhondlmgkqzllr"
+L208: .string "tgmcqexbrljcki"
+; comment
+L209: .data -39, -848, -821
+sub r2, L67
+; comment
+L210: .string "rucl"
+L211: .data 444, -68, 866, 688
+inc *r5
+L212: .data -518, 121, -236, -413, -746, 737, -739
+not L114
+L213: .string "ndcjoxkauwfhjnxzjwvyhqkp"
+prn r5
+L214: .string "llv"
+L215: .data 872, -529, 33, 357, -153
+cmp #139, L80
+jsr *r0
+L216: .data -596, 923, -518, -842, -260, 667, -990
+bne L240
+L217: .string "u"
+L218: .data 173, -617, -973, 638, -73, 229, 823
+L219: .string "ztohrqsud"
+inc r4
+L220: .data 318, -900, -328, -883, 131, -431
+L221: .string "hwaqvgckurjbehs"
+red L2
+L222: .string "eriijnlxzm"
+inc *r0
+add #-256, L156
+L223: .string "wwcoawsutmuwzhi"
+L224: .string "pjbev"
+prn L0
+L225: .data 139
+L226: .string "pqnxunnyeihtfyexrcf"
+L227: .string "gwjnpudeob"
+L228: .data 146, -984, 914, -308, 549, 26, 456
+jmp L297
+cmp *r7, L232
+L229: rts
+prn L250
+L230: .data -920
+L231: cmp r6, *r3
+clr r4
+L232: .data -126, -516
+; comment
+L233: .string "xmpthhwpc"
+L234: .string "aqhsoygat"
+L235: .string "kuoyywbegvuygjreubdbl"
+L236: .string "spchdjnqafauaz"
+L237: .string "klxjkf"
+rts
+clr L5
+L238: lea L1, L296
+bne L297
+L239: .data 204, 50, -538
+lea L306, L297
+L240: .string "mih"
+L241: .string "acyocaxzj"
+L242: .data -310, -499, -248, 167
+L243: .string "ybyij"
+not r0
+L244: .data -108, -614, -499, -17, 949
+L245: .string "fpbdtnhdzjnstltcx"
+sub *r5, r2
+L246: .string "cpzhyheviwdgrzkxtpjfbmjb"
+L247: stop
+stop
+mov r3, L184
+L248: .data -979, 452, -584, 311, 201, 250
+mov L165, r7
+L249: .string "fgtdpckruzhzfzxagnfcr"
+L250: .string "mekjekfidggieqc"
+L251: clr *r4
+L252: .string "knikfhevyznhaimnkjsxexqi"
+jsr L262
+L253: .string "rohywyhdekbohinhmxfl"
+L254: .string "o"
+L255: .string "qxksm"
+; comment
+inc L158
+L256: .data -128
+L257: .string "awziqoftq"
+rts
+L258: .data -966, 236, 764, -738, 563, 457
+L259: .data -805, -559, -954, -327, -683, -594, 891
+L260: red L200
+L261: .string "gdrdzbcocgvolnfszmi"
+L262: prn L61
+L263: .data 142, -811, -791, 380
+lea L82, r3
+rts
+L264: rts
+jmp *r3
+L265: .string "iwtpktthxthfk"
+L266: .string "wdvcqltztpzggbuiz"
+L267: .string "bec"
+red r1
+prn #-182
+L268: sub L134, r4
+rts
+L269: .string "euufxfsojowyiskfjkqtpn"
+rts
+L270: .string "djfpzoculgvazenrxzpb"
+
+L271: .data 809, 620, 648
+
+add L260, L296
+L272: dec *r7
+bne L276
+L273: .data 937, -869, -37
+L274: .data -428, 538, 0, 747, 209
+L275: .data 253, -206, -696, -412, 853, 145, 98
+L276: .string "avpuweegwiznnkefsbyy"
+L277: .data 526, -518
+cmp L29, *r2
+L278: .data -183, -110, 790, 24, 586
+prn L175
+prn *r3
+inc *r7
+L279: mov r6, *r7
+L280: .data -492
+L281: .data 215, 967
+L282: .string "whjahwykfsiknrpwvbtsps"
+inc *r5
+L283: .string "fgwiu"
+not L124
+jmp L191
+L284: jmp *r1
+lea L298, *r4
+L285: .data 702, -522, -650
+L286: .string "jayfnslmtcibujiq"
+L287: .data -669, -207, 445, 530, -687, -507, 687, 848
+inc *r4
+L288: .string "qab"
+L289: .string "vfeiwnsikzag"
+L290: .string "rktug"
+red r1
+L291: .string "guvmbrqrnoglrfpwddpblclp"
+inc L248
+jsr *r4
+L292: .data -222, -997
+red L95
+L293: .data -888, 141, 45, -639, 460
+L294: .string "cpqlodfoknzjc"
+L295: .string "dxpwxkmowzpqjkpy"
+red L300
+L296: .data 714, 557, 384, 689, 181, 830, -821
+add *r4, *r2
+jmp L308
+lea L305, *r3
+L297: .data 602, -266, -174, 752, 418, 5, 778
+jmp *r1
+L298: .string "hjxkbmphvs"
+L299: .data 963, 559, 99, -163, -44, 970, -81, -126
+cmp r7, L198
+L300: .string "zzfapwxkl"
+L301: .string "ivxyjpwp"
+L302: .data 310, 580, 231, 393, 724
+L303: .data -223, -307, -494, 729, 777
+L304: .string "ubzfuwujur"
+not *r4
+L305: .string "ucitjv"
+rts
+L306: .data -816, 88, 533
+add *r4, *r4
+
+stop
+L307: .string "vmgfyjxhuzrgf"
+L308: .data -885, -713
+L309: .data 668, -242, -374, 114, -163, -184, 882, -234
+stop
@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 51
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+L0: lea L270, r1
+L1: .string "fubnzjbpumczbxq"
+L2: mov *r6, *r7
+L3: .string "rhxznegfdqplfd"
+L4: .string "sjvbxndtbqrqmh"
+red r7
+; comment
+L5: .string "bxxaglcipqyo"
+not r4
+L6: .string "epdyvlesmpqfwdxufznqs"
+bne L5
+L7: .data 856, -859, 81, 767, -234
+L8: .data 170, 867, 457, -351, 992, 577, 866, -779
+prn L4
+L9: .string "qgifppmatfvxlpzawcmvpc"
+L10: .data -52, 686, -845, -105, -263, -682
+jmp *r0
+L11: .string "kemnfdmmkdn"
+L12: .data -601, 2, 249, 425, 413, -385, -651, 142
+L13: .string "uihycihyu"
+; comment
+; comment
+clr L4
+; comment
+L14: .data 648, 67, -112, -650, 907, 974
+L15: .string "tkdxujt"
+L16: .data -545, 426, -441, 839
+L17: .data -778, 185, 607, 394, -425, -160, -801, -655
+L18: .data 67
+L19: .data -246, 937
+L20: .data -221, -322, -452, -318, -991, -538
+cmp *r5, r0
+L21: .data 200, -854, 130, -927, -865
+L22: lea L102, r3
+L23: .data 225, 332, 486, -716, -830, -355, 813, -47
+add #111, r6
+L24: .data 901, -452, -293, -990, 271, 382, -349
+L25: .string "mllykzymwcumovmn"
+L26: .string "aznoe"
+L27: .string "ki"
+L28: .string "suvlqwlyraszrxf"
+L29: add *r1, *r1
+L30: .data 629, -609, -798
+L31: .string "wruswbjiemxzmxnmescouj"
+
+lea L285, r2
+
+red *r1
+cmp *r1, r0
+L32: .string "kum"
+L33: inc r3
+cmp L240, L25
+cmp #16, r0
+L34: .data -992, 977, -682, -878, 600, 917, -325, -592
+jmp L41
+L35: .string "bh"
+L36: .string "vxropml"
+L37: .string "hn"
+L38: .data 140, -906, 918, -250
+L39: .data 443, 341, -562, -823, -194, 402
+clr r6
+stop
+; comment
+inc L102
+L40: .string "chmdjqa"
+lea L9, r6
+clr *r7
+cmp r4, *r4
+L41: .data 948, 495, 22, -277, 542
+L42: .string "ysxsee"
+L43: .data 973, 991, -199, 312
+jmp L93
+L44: .data -54, -901, 373, -415, 974
+rts
+
+L45: .data -652
+L46: .data -172
+L47: .string "f"
+add L37, r5
+L48: .string "xqvsuugbgxyzqvetofndhwgp"
+jmp L215
+L49: .string "rebxskzhey"
+L50: .data 207, 979, 411, 800, -474
+L51: .data 839, 342, 237, 613, -91
+red r2
+L52: .data -997, 842, -359, 30, -888, -726, 281
+L53: .string "vrbeasfddnvuyuv"
+inc *r3
+red r0
+jsr L4
+L54: .string "ywldkluxddcpmufbxqkg"
+L55: .data 378, -683, 998, 990, -745, 478
+L56: .string "hduqqwov"
+
+L57: .data 215, 195, 850
+stop
+L58: .string "cqeazz"
+L59: .string "moa"
+L60: .data 857, 817
+L61: .data -515, -535, 811, 888, 576
+L62: .data 880, -603
+not r4
+L63: prn *r1
+L64: .string "hnhvnzprzazfbqfewihxmfs"
+sub #-159, r7
+L65: .string "rxsscfjeghlciaflmlzefy"
+prn r7
+add *r0, L6
+L66: .string "bxmkhdwkalzilyyvrdzcq"
+not *r0
+L67: .data 112, 312, -89, 197, -572, 250, 989
+L68: .string "tmwctibcsw"
+L69: .string "dywm"
+L70: .data -89, 490, -565, -474, -87, 101
+L71: .string "m"
+L72: .data -773, 547
+
+L73: stop
+L74: .string "znduhofxmtq"
+inc L46
+lea L51, L7
+stop
+inc r4
+L75: .data -263, -45, 478, 532, -438, -501, -283
+; comment
+dec *r6
+red *r6
+L76: sub *r5, r3
+L77: .data -136, 256, 861, -665, -225, 337
+jsr L146
+
+L78: .data 339, -310, -342, 324, -946, -867, -777
+L79: .data -220, -533, -504, 929
+stop
+L80: .string "syqqbzazxwfdejmnzja"
+L81: .data 540, -476
+stop
+L82: .data -289, 111
+L83: dec r4
+L84: jsr L22
+L85: .data -693, -744, -892
+L86: .data -335, -223
+L87: .string "iwknltwb"
+L88: .data -474, 219, -180, -680, -826, -89
+L89: .data 863, 806, 743, -982, 277, 163, -657, 503
+jmp L62
+L90: .data 899, 699, 69, -58, 224, -460
+dec r4
+
+inc *r4
+
+L91: .string "kosah"
+L92: .data -316, -406, 581, 873, 386, -708
+L93: .data 666, -997, -720
+rts
+lea L49, L91
+L94: mov L105, r1
+L95: .data -16, -624, 306, 218
+inc L94
+L96: .data -89
+sub L51, L204
+prn #23
+add *r4, L84
+L97: .data 961, 409, 850, 846, 871
+L98: .data 468, -143, 597, 75, -800, 728
+L99: .data -342, 154, 607, -3, 719
+stop
+sub *r7, *r7
+lea L259, L58
+L100: .string "nzwncjwfv"
+L101: rts
+L102: not L132
+; comment
+L103: bne L90
+L104: .data -905, 403, -735, 538, -606, 19, 173
+dec L273
+L105: .string "braqc"
+L106: .string "gcuxwglqi"
+L107: sub L86, r5
+L108: mov #219, L272
+L109: .data 555, 711, 759, 590, -382, 807, -946, 867
+lea L261, L166
+red L288
+L110: .data 709, 599, -324, 870, -176, -160
+jmp L9
+L111: .string "lsfhjyikietqjigx"
+not *r6
+cmp #-102, r1
+L112: not L228
+L113: .data 716, 926, -757, -782
+L114: .data 211, -534, 164, 299, -443
+L115: .data 464, -556, 498
+L116: .string "yqffpyarcqm"
+L117: .string "ggqlekwq"
+stop
+L118: .string "loebivexdlf"
+L119: not r5
+L120: .string "ijztjrxjuvjbfodnmufdctua"
+L121: add *r5, *r1
+prn *r5
+L122: .data -738, -169, 487, -277, 492, -705, -724, 774
+clr *r4
+L123: .data -348
+L124: .data 654, 404, -186
+L125: .data -150, 736, -928, 294, -133, -105
+L126: .string "pdrbcpjtxmwb"
+prn #-22
+not L7
+L127: sub r7, *r3
+stop
+L128: .data -479, 752, 978, -399, -507
+L129: .string "vdnvhloouyqbnc"
+L130: .string "xusviqe"
+add *r1, L177
+inc r0
+L131: .data 568, -666, -969, -78, -546, -129
+
+L132: .string "bmovwhxtjivamdtqjxupmau"
+L133: .string "svyd"
+bne L161
+L134: .data -653, 526, 747, 495, 718
+L135: .string "ujljhfsvnjeyevueehbmmcab"
+L136: .string "szlbgmrriotljpezsmhnvfb"
+L137: .data 776, -603
+L138: .string "ffqelixbmm"
+L139: .data 916, -373, -54, -172
+L140: .data -626, -289
+L141: .data -363
+L142: .data 329, -513, -447, 176
+L143: .data 710, 177, 206, -753, -217, 387
+L144: .string "cjonwfvk"
+L145: .data -598, -194, 668, -679, -775, 284
+sub #90, L285
+L146: .string "sjr"
+L147: .data 609, -317, 590, -736, -617, -861, -912, 352
+L148: .data -374, -546
+inc r2
+inc r0
+L149: .data -809, -576, -86, -182
+mov *r0, r3
+L150: .data 823, -342, 547, 418, 338, -69
+L151: .data -720, 858, -830, -491, 448
+; comment
+L152: .string "ufjvjgqjmfqolxh"
+L153: .data 577, 374, 360, -600, 644
+L154: .data -195, -801, 657, -277, -430
+L155: .data -291, 753, -538, -76
+L156: .data -174, -971, 820
+; comment
+L157: .data 146, -46
+stop
+lea L116, L99
+sub *r5, L108
+L158: .string "fcorzpkvkxxsyic"
+L159: stop
+sub *r6, L52
+jmp *r2
+L160: .data 529, 873, -907, 334, 817, -238, -960, -334
+red r3
+L161: .string "sdcpmyuzr"
+L162: .string "zjouytm"
+clr *r1
+L163: .string "lnygaayhqi"
+L164: .data -25, 882, -785, -948, -652, -979, 654
+L165: inc r1
+L166: .data 5, 281
+L167: .data -236
+L168: prn #231
+; comment
+red r4
+L169: red *r3
+L170: inc r3
+L171: .string "lmmbysyvyshlbtwjcm"
+sub *r4, r2
+clr L219
+L172: .string "wtfepptagrxplqquva"
+mov #118, r1
+inc L26
+prn *r1
+L173: .data 178, 356
+; comment
+L174: .string "pilijlizva"
+jsr *r5
+L175: .data -779, 722, 79, 492, -483, -185
+dec *r3
+L176: .data 188, 708, 206, 342, -837, 754
+L177: .data 248, -807, 891
+L178: .data 962, -302, 403, -760
+L179: .data 98, 374, -460
+jmp *r1
+dec L212
+bne L301
+L180: jsr *r0
+L181: .string "htcdlwsliqfheqvuau"
+L182: red L145
+; comment
+L183: .data -371, -223, -625, 472, 680, -898
+L184: add r2, L237
+red L22
+sub #-185, L272
+L185: .data 568, -745, -989, 412
+L186: .data 638, 767
+dec L11
+jmp *r7
+sub #231, r3
+inc L17
+L187: .string "gnaav"
+L188: .string "wjvpcoj"
+cmp #35, #76
+L189: add L185, *r6
+L190: .string "lnrqpb"
+inc *r4
+L191: .string "bfv"
+prn L74
+L192: .data -734, 994
+not *r7
+L193: .data 539, -967, -907, -946, 925, -242
+L194: .string "vglskkpuegrrebizmsxamqtj"
+L195: .data 329, 59, -546, 556, 524
+L196: .data -910, 478, 67, -497, 36, -609, 864
+L197: .string "htkubxemfquiipoc"
+bne L108
+L198: .data 53, 799, -712, 0
+L199: .data -563, 2, -684, -851
+L200: .data 211
+lea L135, *r5
+L201: jsr *r0
+L202: .data -632, -410, -44, -207, 488, -677, 315, 529
+L203: .data -514, 18
+L204: .data -705, -451, -11, 848, 892, 427
+sub r0, L48
+L205: .string "qxltjgjpjgirebgwfkasjsq"
+L206: red *r6
+L207: .data -544, 313, 446, 414, 622, -132
+lea L119, *r0
+add r7, *r4
+dec *r5
+L208: .data 226, -158, 997
+sub r6, *r4
+L209: .data -744, -546, 694, -466
+L210: .data -78, -520, 907, -401, -545, 842
+L211: .data 333, 902, 951, -549, 350, -965, -590
+L212: .string "cffowuttrfqzw"
+L213: .data -29, -180, -489, -876
+L214: .string "z"
+L215: .string "pxfjbfnegzzeknupadwzqx"
+L216: .data 472, -797, -569, -68, -890, -501, 872, -299
+L217: jsr *r1
+L218: jsr *r1
+L219: .data -777, -243, 627
+L220: .data -352, -685, 214, 659, 499, 71, 901
+L221: .string "abtwmqeglfnqrrgwvaobuzo"
+L222: .string "nbdffdgrreznnxgp"
+L223: lea L242, L86
+L224: .data 920, 524, 868, 936, 419, -453
+L225: .data 901
+L226: .data -473, -113, 191
+sub *r3, L290
+cmp #240, *r5
+L227: .data 370, -75, -231, 230, 256, -883, 563, -724
+mov *r2, *r7
+L228: .string "qcao"
+L229: .string "yuday"
+; comment
+L230: .data -864, -282, -886
+prn L257
+lea L282, r2
+L231: .string "xklxpcnegnyatikvukwy"
+prn L176
+L232: .string "ni"
+L233: .data 27, -657, -749, -968, 118
+L234: .string "pphrcjegk"
+L235: .data -465, 922, 886, -48, 532
+L236: .data -229, 167, -219
+L237: .data -888
+L238: .string "ytquidanzciaoiiz"
+bne L308
+L239: .string "tkoe"
+L240: .data 56
+inc L250
+rts
+L241: .data -387, 414, -491, 300, 490
+L242: .string "dmfqjgivtkgwbsoyc"
+L243: .data 983, -237, 852, -67, 893, -227
+clr r3
+L244: .string "znndtlrfjgyfpsfsochuftkt"
+L245: .string "vpphyqgnqakefdlmthh"
+inc r5
+cmp L307, #-28
+
+L246: .data -646, -896
+jmp *r2
+rts
+L247: .data -796, -439
+L248: .string "bonyggcabs"
+L249: sub L3, *r7
+L250: .string "jtdvjijybbfwuwpcrcha"
+L251: .data 952, -212, 208, -18, -133, 573, 90
+L252: .string "nlixnfshdmwodtypunjta"
+L253: .data 574, 144, 288, -822, 336, 549
+L254: .string "egtzgkfhjjqtxhcgfokna"
+lea L134, r0
+bne L62
+
+; comment
+L255: .string "enrcfbrlmozjkhxvsrpn"
+L256: .string "yxebckclph"
+cmp r0, *r2
+add r6, *r7
+L257: .data -199, -640, -12, 344
+L258: .data -216, 253
+bne *r0
+prn #223
+L259: .data -416, 17, -782, -744, -94, 455
+; comment
+rts
+L260: .data -44, -912, 822, 754, 408, 261, 192
+L261: .string "zoyxxz"
+L262: .data -540, -232, -146, 850, 441
+L263: .data -580, -538, -786, 604
+inc L128
+dec r1
+mov L232, *r1
+jsr L59
+clr *r1
+stop
+add r4, *r3
+lea L102, r3
+red r5
+lea L270, r6
+L264: .data 214, 640, -546, 264, 619, -679, -474
+L265: .data 595, 67, -120, 408
+prn r4
+L266: .data 238, -426, -361
+L267: cmp L300, *r4
+L268: .data 960
+bne *r0
+L269: .string "jvvyk"
+L270: .data -782, -540, -598, -730, -886, 194, -905, -911
+L271: red L260
+rts
+L272: .data 626
+L273: stop
+L274: .data -930, -614
+L275: .string "eobmjnclvqlwd"
+L276: .data 586, -682, -913, 818, -669, 237, 978, -815
+prn *r3
+bne *r7
+L277: .string "a"
+L278: .data -958, -100, -63, -168
+L279: .data 390, 979, 538, 107, -256, 155
+L280: .string "uiawkgwd"
+L281: .data 983, 825, 895, -594, -864, -200
+L282: clr *r2
+inc L34
+L283: .string "jedqfiy"
+L284: dec *r3
+inc L308
+; comment
+L285: .data 4
+jsr L196
+L286: .string "uncwv"
+dec r5
+jsr L214
+L287: .data -948, -413, 737, -730
+L288: .data 949, 517, -90, -116, 722, -101, -232, 482
+L289: bne L284
+L290: not *r6
+L291: .data -742, -992, -83
+bne L303
+sub *r3, r0
+L292: .string "zqbptocpr"
+inc r5
+rts
+L293: .string "xaxshyxiwoquxtpclbfisv"
+L294: .string "ncbsgyroiscj"
+L295: .data -188, 70, 75, 829
+L296: .string "zdvjautrjpzjdkjlsg"
+sub r7, *r1
+L297: .string "lqosui"
+L298: .string "xe"
+stop
+L299: .string "yfnveupusqwvufvxcpd"
+L300: .data 355, -385, 317, -82, 984, -184, 463, 896
+L301: .data 557
+; comment
+L302: .string "nfvgwdworlcjosqg"
+L303: .string "ziqg"
+rts
+add #46, r4
+L304: .data 558
+clr r0
+lea L104, *r3
+stop
+L305: .string "i"
+L306: .string "hcfkguyzqgows"
+bne *r3
+L307: .string "btxrythekssudtplsxtzf"
+L308: .data 127
+L309: .string "y"
+stop
@@ -0,0 +1,524 @@
+; Generated by genCorpus --seed 52
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: .data -528, -189, 703, -679, 562, 875, 466, -645
+L1: .data 696, 546
+L2: .data -80
+lea L1, *r6
+L3: .data 331, 173, 656, -491, -544, 539, 886
+L4: .data 233, 312, 5, -640, 277, -118, -658
+
+not L4
+sub L1, *r2
+L5: .string "pgebjeuxkapluktq"
+cmp #-240, *r6
+red r3
+red *r4
+L6: .data 716, 704
+L7: .data -521, 393, 175, 630, 715, 298, -39, 179
+L8: prn #-84
+L9: .data 130, 146
+jmp L78
+stop
+stop
+L10: .data -761, -608, 247, 253
+L11: .string "rvqokbpjxazfkztdx"
+clr *r3
+L12: .data -141, 498, -797, -839
+L13: .data 401, 331, 911, -492, 28, 335, -412
+L14: .string "hdzewqqvacouijanuf"
+not *r7
+red r0
+; comment
+L15: .string "vrodkrib"
+L16: .data -35, -133
+
+rts
+L17: .data 439, -503
+L18: .string "cjomlnyfsiyrrestmnyqexfp"
+L19: .string "zpfhcxdrfvavekxge"
+L20: .string "paviatnwaqedbfqofkq"
+L21: prn *r4
+L22: .string "sqguvw"
+L23: .data 198, 182, -567, -597, -795, -598, 143, -520
+inc L151
+L24: .string "dxemxjsjldij"
+L25: .string "rkbscixjja"
+L26: mov *r7, r6
+L27: .data -401, 571, -902, 604, 300
+lea L78, L16
+L28: .string "ieanmajhkbzcglrkheo"
+rts
+lea L70, *r7
+L29: .data -626, -912, 394, -823, 25, -764, 361, -960
+jmp L28
+
+L30: .data 835, -459
+L31: .data 271, -804, -357, 291, 312, 509, 381, 849
+; comment
+L32: .data -1, 65, 904, 154, 899, 754, -650
+L33: .string "oawpgfhjhcbxz"
+L34: mov #-177, r1
+L35: .string "ocxbinjcnpaxrk"
+L36: .string "oxutuyyas"
+L37: .data -187, -104, 990, 408
+L38: .data 97
+L39: .data 706
+L40: .string "vfhglvflen"
+not *r6
+jsr *r6
+
+L41: .string "bnocnckcuorfiylubvif"
+dec *r7
+L42: .string "msqf"
+L43: .string "nevmsoqayvqzrzwjdfpc"
+rts
+L44: .data 116, -533, 180, -480
+L45: .string "nmtcxqnjprkkebkztyl"
+red L265
+rts
+L46: .string "hsmaivsbcqltwvlogj"
+not *r6
+L47: .string "yfdulut"
+cmp r4, r1
+L48: .data -219, -900, -488, -263, -418, -919
+L49: .data -682, -410, 940, -932, -924
+L50: .string "bpxww"
+jsr L31
+L51: .data 630, -336, -551, 969, -754
+L52: .string "zkcjlnauyud"
+L53: .string "cytumnwsdmbgrr"
+L54: .data -433, 403
+L55: .data 360, 971, 335, -632, 407, -305, 529
+dec *r4
+L56: .string "wzaluwgjqdnuzesleaiz"
+L57: .data 589, -597, -662, 397
+L58: .data 132, 545, 352, 322, 750, -15
+L59: .string "upbuaejlkoj"
+
+
+L60: .string "vewksoexmugdhxbaymz"
+; comment
+jsr L25
+inc r5
+lea L9, *r4
+L61: .string "sec"
+L62: .data -512, -542, 857
+L63: .data 723, 996, -280, 854, 642
+L64: .data 889, 920, 617, -881, -258
+L65: .string "dgqpkmgunipzskknshsd"
+L66: .string "beqpx"
+stop
+sub #195, L275
+L67: .string "crenvlmybktyetovheaekc"
+rts
+L68: mov r6, L292
+L69: .data -541, 943, 278, -104, -996, -516
+cmp r7, *r6
+sub *r1, *r6
+sub *r7, r6
+L70: .string "hmxhxqyob"
+L71: .data -516, 745, 438, -482, -70
+sub #88, *r6
+L72: .data 936
+L73: .data 702, 834, 677, -537, -243
+L74: .string "thzbfwdlfwnhbteoskkvhkxz"
+L75: .string "kghzeloudxk"
+L76: .data 240, -893, -539
+L77: .data 393, 478, 149, 335, -287, -347
+rts
+L78: .string "qaqcjpmhsnqknrvblv"
+L79: .data 759, -500, -637
+L80: .data -74, 272, 360, -335
+jmp L74
+L81: .data 996
+L82: .string "gsnh"
+L83: .data 277, -270, -573
+L84: .data -816, -862, -936, 827, 345, -881, 357, -909
+L85: .string "pizhywnwnsdgspztw"
+L86: dec r4
+L87: .string "zhaedv"
+
+clr r4
+add r2, r7
+L88: .string "rd"
+not *r6
+L89: .data 152, -709, -758, 164, 105, 258, 758, 938
+L90: .string "lxpbjlqarndhli"
+clr *r0
+L91: .string "vshxikfasrhhesyiwrqz"
+L92: .data -729
+L93: .data -463, -358, 603, -838, -114, -982
+L94: .data 995, 163
+L95: .data -609, 680, -16, -886
+L96: .string "xodnmslbyeaoirq"
+L97: .data -480, -191, 708, -910, 171
+L98: .data -657, 682, -530, 327
+
+clr *r4
+L99: .data -91, -161, 971, 588, -963, 517
+L100: .data -871, 941, -417, 314, 579, -447, 390, 619
+L101: .string "zxgminnmw"
+prn r2
+L102: .data 282, -110, 922, 605, 693, -324, 419
+L103: .data -613, 597, 152, -351, -670, 9, 719, -649
+lea L4, *r3
+add #-246, L127
+L104: .data -95, 233
+L105: .data -258, -972, 497, -555
+L106: .data 297, -440, 439
+L107: cmp r5, r3
+jsr *r3
+L108: .string "f"
+L109: inc *r5
+cmp #-255, r1
+L110: .string "jdkaiabiiklqncjme"
+clr *r4
+L111: .data 575, -391, -841, -722, 5
+L112: .string "rau"
+
+L113: .string "bopcabjerpiopvwlaj"
+rts
+L114: clr *r1
+lea L85, L45
+L115: .data -151
+L116: .string "hof"
+L117: lea L20, *r0
+L118: .data 809, -695, -284, 992, -102, 678, 412
+
+L119: .string "szeqocflqtxlsemocpsxeouk"
+prn #-122
+red L135
+sub #238, r2
+L120: bne L328
+L121: .data 190
+L122: .string "mlczvmhjmrxsbogmtafwpr"
+L123: .data 381, 540, -600, -387, -418
+L124: clr *r6
+
+bne L189
+L125: .string "obldzydtevepezfgzpn"
+L126: .data 956, -623, 613, -617, -936, -747, 258
+L127: .data 51, 225, 449, 619, 154, -999, -808, 664
+L128: .string "ghnbnaxgukjpsihvp"
+L129: .string "dpeu"
+rts
+L130: .string "mnnueenzkpuughjpnmcv"
+L131: .data -246, 47, 739, -728, 159, 570, -973, 842
+dec L198
+L132: .string "vrglyedhdtlfh"
+L133: .string "aoqjzaqapfjutydxjnbswuz"
+L134: .string "jbqweux"
+cmp r6, *r7
+L135: .data 890, 516, 486
+L136: .data -284, 592
+L137: .data 908
+L138: .data 625, -283, 665
+L139: .string "chn"
+L140: .data -928
+; comment
+L141: .string "ybpazchxunbmum"
+L142: .string "kiuzkxfycwtckwobexcd"
+L143: .string "koxlzaygynzklgu"
+L144: .string "rdvtuliegjblfkqbrrjns"
+L145: rts
+L146: lea L142, r3
+jmp *r6
+L147: .data -484, -571, -203, -758, 368
+not L0
+L148: .string "p"
+L149: cmp r6, L253
+sub #-97, L28
+L150: clr r3
+inc L290
+mov r7, r1
+L151: .string "acqlnyjqhotma"
+; comment
+L152: .string "thqoubbzzfifwmlmmwgsv"
+L153: .string "cbs"
+L154: dec L23
+L155: .string "mom"
+L156: .string "zzptdauheutlmnfvs"
+L157: .string "hfqtecqkylxwrqfyu"
+
+L158: .data -232, 455, -663
+L159: .data 511, -156, -400
+L160: .data -88, -205, 936, 143
+L161: .data 930, 440, 254
+L162: .data -802, -974, -492, -178, 621, -205, -163
+dec L208
+L163: .data 203, 886, 897
+clr r4
+; comment
+L164: .string "wnineeqywmdgbyv"
+L165: .data -467, 108
+L166: .data -638, -37, 975, 368
+L167: .data -196, -56, 271
+inc L284
+mov *r2, r3
+bne *r7
+rts
+L168: .data 744, 637, 546, -845, -863, 82, 146
+bne L228
+L169: .string "klhcfmujjvnuzxitactdefu"
+L170: .data 238, -177, -521, 840, -356
+L171: .data -835, -941, -330, -602, -28, 36, -925
+L172: .data -760, 862, -131, -626, 188, 46, -991, -952
+L173: .data 561, -606, 886, 999, -424, -61, 305
+red L313
+L174: .data -601, 263, -389, -781, 554, 50, -750, -105
+L175: .string "vkuvshnsknxcinehwaavigw"
+; comment
+L176: .data 75, -524
+L177: .data 190, -127, -487, -955, 328
+L178: .data 709, 735
+L179: .string "akympztcetggjffiobng"
+stop
+L180: .string "skwfcnykdnzvo"
+L181: .data -491, 332, 276
+dec L133
+L182: .string "yfmewkyolvci"
+L183: .data -2
+L184: .data 589, -386
+L185: .data 160, 401, 858, 784
+prn *r3
+lea L120, r7
+L186: .string "itytvcnkkpr"
+inc L135
+L187: .data -485, 535, -612, 589, -207, -456
+L188: .string "eqvbdyazfgqvnxmztdk"
+L189: .string "yweetmwlmhpxcydgjvnml"
+; comment
+L190: .data 438
+dec r6
+L191: .string "ylnuxfucdtsbiyyqvcvctvfa"
+L192: lea L167, L149
+L193: .string "kdd"
+L194: .string "lewbxdpf"
+L195: .string "mpkhygthnt"
+jmp *r1
+L196: inc *r4
+L197: .string "enryarkun"
+jmp *r2
+L198: .string "gmaruriuruyxk"
+L199: .string "g"
+; comment
+L200: .string "qhaeibjdsspzlysfamcciurd"
+jmp *r2
+L201: .string "erektdgpgconysfpu"
+L202: .string "slhdkpgivqmaujwjvag"
+L203: .data -114, -605, 784, -374, -865, 634, 531, 294
+jmp *r2
+inc *r6
+cmp #19, #103
+L204: .string "cvgasdydhdevhdjst"
+L205: .data -330, 358, -611, -976, 808
+L206: .data 344, -323, 223, 899
+clr *r7
+L207: .string "eutvg"
+L208: .string "wvbwxthuxanmuwbhlrmev"
+L209: .data -564, 993, 492, 45, 547
+prn r4
+L210: .string "hxfvzwyq"
+L211: .string "bbipsqbz"
+add r1, L100
+L212: .string "hofwbj"
+L213: .data -103, -5, -364, -531
+L214: .data 510
+L215: .string "qbymkppdxfz"
+L216: .string "kqyoric"
+; comment
+L217: .data -335, -644
+L218: .string "uinferwlyotkhbofycc"
+L219: .data -88, 221, -69, -566, -346, 419, 167, -704
+jmp *r6
+cmp *r1, L260
+dec r1
+L220: .data -227, 888, -849, -324, -975, 825
+add r5, r1
+L221: .string "pybokgg"
+L222: .string "abrtb"
+L223: stop
+rts
+L224: .data -336, 379, 255, -167, 655
+L225: .string "iodgalsrfadayx"
+jsr *r7
+jmp L294
+; comment
+mov #-13, L338
+L226: .data -253, -122, -9, -592, -174, -844, -191, -696
+L227: .string "ryhyhwhtk"
+dec r6
+L228: .string "adwvofoxtv"
+L229: .string "vicdkpe"
+L230: .string "rqtoahh"
+L231: .data -152, 364, -424, 153, 562
+L232: .string "xavospfzhp"
+L233: .data -397, 733, 925, 177
+
+mov L244, r2
+L234: .data 150
+dec L310
+L235: .string "vtlmdvecngbuhjet"
+L236: .data 803, -501, -42, -642
+L237: .string "kqlsstx"
+L238: .data 952, 93, -986, -370
+L239: .string "fljp"
+; comment
+L240: stop
+L241: .data -601, -318, -950, -586, 145
+red L309
+red r5
+L242: .string "gcjitdbia"
+L243: .string "xuekzcehryxuy"
+L244: .string "gcvzv"
+stop
+L245: .data 464, -157, -338, -443, 389
+L246: .data -760, 527, -781, 185, -452
+L247: .data 200, -778
+L248: .string "yvlmlocbz"
+not *r4
+cmp #-55, L167
+L249: .data -905, 345, 825, 320
+L250: .data 622
+stop
+L251: .string "rylscpotiftzqwsjrnuvikft"
+cmp L335, r5
+red L48
+jmp *r0
+L252: .string "fxgdftddpdmdbl"
+L253: .data -832, 696, 360, -957, 446, 798
+sub #-72, L13
+L254: .data 758, -193
+L255: jsr *r0
+L256: .string "fhaenaeccnpgjanswi"
+stop
+L257: .data -204, 108
+L258: .data 622, 29, -609, 307, -433, 920, 549, -682
+L259: .string "mygccsgznxqscxguemqc"
+L260: .string "nh"
+L261: .string "wokorylm"
+L262: .string "evv"
+rts
+L263: .string "zujfqzpfycmyz"
+L264: not L333
+L265: .data 771, 328, -764, 198, 254, 676, -991, -358
+L266: .data -248, -22, 758, 72
+L267: bne *r0
+L268: .string "zwumujxkal"
+add r7, L79
+L269: .data 939, -434, -847
+dec *r0
+L270: .string "fjqmtazbkirwzg"
+rts
+L271: .data 114, -933
+L272: .data 921, -250, 720, -648, -800, -109, 171
+L273: .data -814, -888, 505, 651, -503
+L274: .data -236, -411, -981, -36, -87, -286, 602, -365
+L275: inc *r0
+L276: .data 2, -4, 922
+L277: .string "qg"
+L278: .data -31, 11, -460, 407, 264
+L279: .data 394, 919, 44, 623, -720, -799
+jsr L313
+L280: .data -209
+L281: .string "kvliozxkgwqzyvdbtqpebcr"
+L282: .data 702
+L283: .string "nruiluesmkogtnt"
+L284: .string "owvgsi"
+L285: .data 593, -282, -994, 708, -636, 784, 698
+L286: .data -386, -699, 522, 451, -437
+L287: .data -231
+L288: stop
+L289: .string "soycdmtplvqete"
+jmp L142
+L290: .data 280, 884, 917
+L291: .data -416, 631, -427, -893, -597
+
+prn L328
+rts
+red *r5
+prn *r3
+L292: .string "jguxnptiuuwwthoqekdvqjvr"
+L293: jsr *r5
+L294: .string "hqxpmmjzlylwggfwyrkitsp"
+L295: .string "illxvbqv"
+L296: lea L38, *r6
+L297: bne *r7
+L298: .data -43, 839
+add *r4, r1
+L299: .data 310, 85, 71, 58
+L300: rts
+L301: .string "xqkwsvxcqjqar"
+stop
+; comment
+L302: .string "x"
+L303: .string "yavbsdubsdtvycncvzzsnkp"
+L304: .string "qda"
+L305: .string "fixmltcrbpjjhqdzavik"
+L306: .string "shljjsgzojnvvfrpkcvynrg"
+dec *r2
+L307: .data -42, 436, -234, -230
+L308: .data -232, -28
+L309: clr *r2
+L310: .data 773, 356
+L311: .data -777, 431, -234
+L312: .string "dmzeptxfy"
+L313: .data 377, -134, 315, 732, 805, 147
+L314: .data -519, -428, -952, 45
+mov r6, L329
+jsr *r7
+L315: .data -149, 599, -25, -701, -19, -351
+L316: .data 545, -171
+bne L330
+L317: .string "vrppsrqvbqpcepbniztvbg"
+L318: .string "cgetx"
+L319: .string "tlskdnphvcdmav"
+dec L329
+L320: .string "mezpfvnffyrwrucsswuzhfb"
+L321: .data 22, 205, -503, -818, 383, 311, -748, 438
+L322: dec *r5
+
+L323: .data 498, -632, -864, -578, -298, -980, 965
+L324: .string "uarysvnfnlpxrddmowwsar"
+L325: clr r0
+L326: .data -953
+L327: .data 620, -259, -98, 38, 541, 600
+L328: .data 723, -694, -826, 139, 733, 336, 853, -273
+L329: .data -576, 9, -668, 321, 801
+bne L79
+; comment
+L330: .data -419, -404, 901, -864, 963, -303, -162
+L331: .data -609, 307
+L332: .data 473, 357, 256, -331, 246, 847, 844, 515
+L333: .data -621, -891, 103, -108, -39, 529
+; comment
+inc L169
+L334: .string "rpnvxhmdpmvavauvdgnlkgn"
+L335: .string "xabtyspgsah"
+L336: .string "diulrxcfqhdywiaoyuxflnph"
+bne L338
+L337: .data -453, 769
+dec r7
+L338: .string "onpdvczgtn"
+stop
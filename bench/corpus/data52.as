@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 53
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+
+bne *r0
+L0: lea L0, r7
+jsr *r7
+L1: .string "biumsybwdrbimaaneef"
+jmp *r5
+red *r1
+clr L309
+L2: .string "ionpmpohspxkjj"
+L3: .data -665
+lea L211, L322
+clr *r1
+L4: .string "affoazcbvqtbjyte"
+L5: .data -338, 995
+L6: .data 376, -138, -729, -566, -872
+inc *r5
+prn L6
+L7: .string "fikesohgjnsslzo"
+L8: prn #223
+not r5
+add #-17, L8
+L9: .data -204, -208, 205, -630, 564, 159, 974
+L10: .data -876, 205, 966, 802
+
+L11: .string "iusfafwfackqlwhghwxidbph"
+jmp L112
+; comment
+L12: .data 844, -794, 370
+jmp L45
+L13: .string "jzsyecpamtvdxocj"
+red r7
+lea L11, *r0
+; comment
+L14: .string "dmspkvyfikumawovvgq"
+not L11
+; comment
+red *r6
+add L120, r1
+L15: .data -612, -458, -362, 245, -717, -241
+L16: cmp *r0, r5
+L17: .data 988, -286
+L18: sub *r1, *r0
+L19: mov #-131, *r0
+L20: .data 800, -598, -830, 132, 986, -685, 428
+L21: .data 114, 991, 37, 554, 792, -100
+L22: .data -783
+L23: .string "xkulfbaolqdp"
+L24: .string "ogjjirjkzekccngkeycdbpzn"
+L25: .data -656, -753, -484, 755, -819, -854, 826
+; comment
+L26: .string "yyyphrpriyexvyryc"
+L27: .data -86, -874, -577, 210, -135
+L28: .string "jzoavhes"
+L29: .data -823
+L30: .string "amxlsyhrajmqhnm"
+L31: jmp L311
+L32: .data -445, -72
+L33: .string "ihqwvjwljvjlaibssbmizvur"
+L34: .string "mg"
+L35: .data 550, 438, 691, -719, 566, -956
+L36: .data -561, 910, 908, 724
+mov #248, r4
+jmp *r1
+jmp L1
+L37: .string "dtarkuagrlgvxvanvr"
+L38: lea L283, L130
+L39: .data -38, -221, -64, 697, -956, 141, 566, -995
+L40: .data 330, 232
+; comment
+L41: .data 985, 618, -970, -94, -308, -269, 505
+L42: add r3, *r1
+L43: .string "arcktyzlbdoryuhxe"
+add L20, L18
+L44: .string "wghst"
+lea L42, *r4
+L45: .string "lcnldsgrzjlzx"
+inc r4
+L46: .string "ebprfvkkozognvxn"
+L47: dec *r5
+bne *r4
+mov #-88, r3
+bne L293
+L48: .data 948, 132, 59, -363, -532, -474, -684, -227
+L49: .data -980, 825, 404, 137, -293, 170, 292, -92
+bne L44
+L50: .data 704, 612, 724, 19, 149, -531, -742, 585
+L51: .string "vqmoj"
+L52: .string "hywkwmngnpnzb"
+L53: .string "aapdqlylbgtfhvlegnmgfa"
+L54: .data 406, -262
+L55: .string "yevldsxgoznjjwcjojcvhq"
+L56: .string "tlkcbqqi"
+
+L57: .string "cfdlqrvbrsxvtuohlcjyzf"
+red L107
+inc r0
+L58: .data -66
+L59: .data 259, 11, -47, -598, -754, 709, -309, -848
+inc *r0
+inc L222
+L60: .data -639
+jmp *r6
+L61: .string "qhuqvmlurszcltqzogwpccx"
+
+L62: .string "tdsrerjxxvikurpfqczkm"
+L63: .data -661, 148, -525, 677
+L64: .data 793, -787, 687, -509
+rts
+mov *r6, L57
+L65: .data 842, 713, -446, 355, -726, 113
+L66: .string "cq"
+L67: .data 756
+L68: .data 85, 949, 34, -387, -349, -840
+L69: .string "szrikfpvvfwne"
+clr L17
+L70: .data 129, 178, -400, -109, 632
+L71: .string "xwlwxmqnykadvxyqhpxezwkh"
+L72: .string "iawpraykkn"
+L73: red *r6
+L74: .data -674, -958, 790, 868, -102
+L75: .string "lmdixdtsttvgtoc"
+L76: .data -361, -176, 876, -428, -839, -509, 417, 442
+mov r4, L198
+L77: .string "rdclsycaasqggsl"
+mov r6, L302
+mov #-168, L61
+L78: .data 539, -795
+jmp *r5
+jsr L16
+rts
+red r1
+L79: .data 664, -872
+L80: prn r5
+L81: .data -274, -320, 354, -176, 368, 986, 143
+; comment
+L82: .string "qrehechapkvwxtqckumjh"
+L83: .string "inymifdr"
+L84: rts
+L85: .data 382, 67, -557, 580, 606, 698
+L86: .data 720, -623, 775
+L87: .string "zhhpsdf"
+L88: .data 386, 301, -720, -446, -270, 106, -898
+L89: .string "cxebffmci"
+sub L41, *r0
+mov *r2, *r6
+L90: .string "eqtxiinzphncxivrwrbcfmfm"
+L91: .string "ifwpfiji"
+
+bne *r7
+red r3
+L92: inc L45
+L93: .string "lyowhgbmuumw"
+L94: .data -664, -102, -365, -307, -76, -276, 46, 858
+L95: jmp *r4
+L96: .data 887, -703
+cmp r6, L41
+L97: .data -966, -287
+L98: .data 308, 48, -103
+L99: .data 653
+; comment
+L100: .data -28, 987, 775, 222, 149, -542, 841, -497
+L101: .data -55, 982
+jsr L89
+L102: .data -527, 516, 138, 569, -791, 4, -670
+dec L12
+cmp *r3, *r0
+L103: .string "fcwwiaqqzd"
+L104: .string "yolwtvhoolkknhspy"
+L105: .data 372, -618, -512
+L106: .string "zvmv"
+L107: .data -995, -74, 377, 867, 640, 662, 845
+L108: .data 933, 974, 951, -707, -912, -707, -284, 300
+L109: .string "yroxndomylskhxqkjzclr"
+L110: .string "bnrqdekaa"
+L111: .data 574, -750, 797, 180, 57, 720, 460, 90
+L112: .string "hrspgrshyrkjwgstw"
+L113: .string "hahmkwssj"
+; comment
+L114: .data 144, 401, -303, 755, -135
+L115: mov L110, *r3
+L116: .data -391
+L117: .data 963, 638, -587, 704, 491
+L118: .data 250, 673, 756, 173, 988, 241, -477
+L119: .string "vbakm"
+L120: .string "ntefrgmj"
+red r0
+L121: .data -849
+L122: .data 185, 792, 15, -568, -579, -801, -233
+L123: .string "fkkcp"
+not *r2
+clr r0
+bne *r5
+L124: .string "tarjyjlmpofm"
+L125: .data -687
+L126: .data -772, -797, 73, -159, -192
+L127: .string "t"
+L128: stop
+jmp *r6
+L129: .data -999, -99, 7, 676, 362, 983, 535, 65
+L130: .string "cvkbifcw"
+; comment
+L131: .data -195, -132, 461, 642
+L132: .string "bsprmqvxwvaywpmdgvprl"
+
+jmp *r0
+rts
+dec *r5
+L133: .data -411, 498, 774, -852, -179, 373, -894
+jmp *r4
+stop
+L134: .string "yyiemkczgbkmpabcvknick"
+L135: .string "pmqxozf"
+L136: .data 512, -744, -979, 705, 949, 415, -479, -960
+L137: .data -199, 332, 446, 82
+L138: .data -203
+L139: .string "tnqwknpfi"
+bne *r0
+L140: .string "qrdhwpiaswotlrynnztytn"
+L141: .data -655, -106, -811
+inc *r5
+L142: not r3
+bne L61
+L143: .data -52, -704
+L144: .string "hywdkovxaspiseonbnjkju"
+L145: stop
+L146: .data -11, 72, -880
+L147: .data 367, -1, 578, -549, 519
+L148: .data -388, -487
+L149: .string "krvannnqwszxo"
+L150: .data -784, 447, -932
+L151: .data -626, 945, 695
+L152: .string "nqgsmnvct"
+L153: .string "vjitxgdqwhehpxtc"
+L154: .data -551, 82
+L155: .string "aacdufswf"
+lea L249, r0
+L156: .data 367, 776
+L157: .string "eowrkiwmdm"
+
+lea L69, *r0
+L158: .data -35, -630, 23, -147, -282
+L159: .string "ztd"
+; comment
+L160: .string "csnqchjbjcxnysr"
+L161: .string "ftjcgrnrsxtt"
+L162: .string "budob"
+bne L176
+
+L163: .data 116, -700, 606, -245, 887, 275, 269
+L164: .string "tidrzcxjfwfzntpu"
+L165: .data -430, 485, -362, -723
+red *r4
+cmp *r2, r1
+add *r6, r4
+L166: .string "ubi"
+L167: .data 603, 665, 580, 459
+L168: .data -449, 951, -14, 709, -339, 628
+L169: .data -202
+L170: .data -977, 870, 687, 277
+
+L171: .string "iwrdkuzknekxlwhttyfvzzkl"
+L172: .data -910, -87, 2, -634, -114, 575
+stop
+L173: .string "vqdflzjcn"
+L174: .string "cdhiwyzzefvla"
+L175: .data 561, -237, 289, -964, 305
+L176: .data -880, 220, 173, 269, -530, 848, -636
+add r7, r6
+L177: .string "mocy"
+L178: .data 61, -426, -433, -545, -818, -618, 58
+inc L309
+cmp *r3, r6
+bne *r0
+L179: add *r3, *r0
+L180: jmp *r7
+L181: .data -160, -957
+rts
+L182: .string "gknazhqq"
+L183: .string "gzwatj"
+inc r5
+jsr L100
+red *r2
+L184: .string "vtmzroax"
+rts
+L185: .data 995, -698, 657, 264, 583, -57, 669, 181
+L186: .data -86, 713, -841, 156, 883, 268, 282
+lea L268, r1
+stop
+L187: .string "sbtajr"
+L188: .string "rdecxquy"
+bne L10
+dec *r1
+L189: jsr L242
+jmp *r4
+L190: .string "cuzzavcdbpcxzyxo"
+bne *r0
+L191: cmp *r3, *r6
+
+L192: .string "uuzpkvbwywcmqlovuuooe"
+red r1
+
+L193: .data 418, 52, -884, 619, 340, -423, 90
+L194: .data -5, 138, -250, 818
+L195: .string "bi"
+L196: .string "slgppnohiwcga"
+stop
+rts
+L197: .data 932, 97
+cmp r4, L321
+; comment
+dec r1
+L198: .data -548, 382, 904, -465, 431, 948, -285
+clr *r7
+L199: .data -560, 459, -829, -193, 57, 553
+L200: .data 165, -463, -601, -562
+lea L203, *r1
+dec *r7
+L201: .string "jvbyl"
+L202: .string "kbtuvqqeccyw"
+L203: .string "wgemvrzjvo"
+L204: .data 877, 929, 154, 939
+L205: .data 364, 234, 41, -201, -589, -321, -304, 930
+L206: sub *r1, r1
+L207: .string "jrqjkdsfoxuvfnwdpw"
+L208: .string "qrlucmrbmgxsquuzhapnlph"
+L209: jsr *r6
+
+L210: .data 342, -695, -38, 960, -288, 319
+L211: .string "om"
+L212: .string "qruxgc"
+prn L227
+L213: .string "ifuayrhuglnlcxiajhkin"
+L214: .data -482
+L215: .data -73, -906, -280, -848, -588, -827
+lea L278, r2
+L216: .string "htzcgmgnrgly"
+L217: .data -41, 26, -817, -219
+L218: .data -975, -636, -190
+L219: .string "zinclrrovddkcima"
+mov *r2, *r2
+L220: .data 323
+mov #-91, L182
+L221: .string "brzzbeizllamv"
+inc r7
+bne L63
+
+prn L107
+dec *r1
+
+L222: .data -12, -901, -809, 253, 97, 320, -176, -314
+L223: .data -98, 779, 41, 407, -793
+L224: .data -857, 906, 351, 399
+clr L261
+L225: .string "ekmlugtcjojgveybblbttk"
+L226: .data 864, 635, 561, 411, -945, -273, 284
+
+L227: .data -32, -96, 329, -105, 693, 842, 190, 918
+L228: .data 561, -150
+L229: .data 113, -820, -204, -367, -861
+L230: .data -291, -144, 851, -872, 92
+sub *r0, r3
+L231: .data -156
+L232: .string "ymksmvoyqwtskimiccackbew"
+L233: .data 289, 520, 712
+L234: .string "gxkhxqmqofsofwdtjrqs"
+bne L20
+L235: .data 729, 130, 966, 686
+L236: .string "qbmpdyz"
+
+dec *r4
+L237: .data -714, 569, 916, -666, -505
+L238: .data -194, 177, 500
+L239: .string "uioodmfgdkkooh"
+L240: .data 578, -237, 555, 943, 456, 360
+prn #-141
+dec L105
+L241: .data -72
+L242: .data -121, 319
+L243: clr *r5
+L244: .data 821, -481, 253
+L245: .string "ulhqteckprvqvwmhjdhunfo"
+L246: .string "sqksqdben"
+L247: .data 682, -61, 744, 82, 48
+L248: .string "mwlvozblaykgfnreezqlndl"
+L249: .data -281, 767, -939
+L250: .data 711, -284
+L251: .string "fnicgubsmtzicoqn"
+L252: .string "khopgfbfwaszrto"
+lea L271, r6
+not r0
+L253: .data -464, 475, 223, 15, -670
+L254: .data -73, 258
+jsr L288
+L255: .data -985, -561, 906
+jsr L104
+L256: .data 359, 57, -90
+L257: .string "hcgxmkmauqdqtirechkyhsy"
+L258: .data 905, -994, -360
+L259: .data -178, 63, -8
+L260: .string "oyb"
+inc r7
+L261: dec r2
+add L58, *r2
+L262: .string "dktwafvezqxdbtvh"
+L263: .string "knowtbodsx"
+L264: .data -948
+L265: .data -992, -785, 820
+dec r2
+clr L244
+L266: .string "rhwzzranismiog"
+L267: .string "yeuyahceefota"
+rts
+L268: .string "pldinjvyrwqqmyhunksz"
+not r0
+L269: .string "pdpw"
+L270: .data -268, -428, 383, -946, 699
+bne L282
+L271: lea L295, r7
+not L91
+; comment
+L272: stop
+stop
+L273: .data -277, -138, -652, -464, -833
+sub r0, *r2
+L274: bne *r0
+jsr L305
+L275: .data 786, -689, 242
+L276: .data 449, -616, -32, -662, 465, -332
+L277: .string "mgxnbiqkckltdtj"
+L278: .string "hp"
+L279: .string "utcyuuxxaplkpdwutctvpf"
+L280: .data 685, -538, 916
+L281: .string "dbimcoeeziieytzeeeetdeo"
+L282: .data -73
+L283: .string "iltfs"
+inc L148
+L284: .string "afnrbyti"
+stop
+L285: .data 535, 800, 902, -259, 246, 824, -33
+L286: .string "kiobcjmsefuxlgmcsd"
+L287: .data -670, -101, 250, 974
+clr L252
+L288: .data -592
+L289: .string "vahv"
+L290: .data 151, 460, 345, 471, 71, -473, -65, 635
+L291: .data -639, 176, -659, -425, 277, -17
+add r2, r2
+L292: .string "hjmohyfqln"
+L293: .string "kdhboaix"
+L294: .data -405, -507, -112, -980
+L295: .string "zu"
+L296: .string "hc"
+add *r1, *r1
+L297: .data 84
+L298: .data -169, -766, -959, -685
+jmp L315
+L299: .data 345, -392, -175, -317, 617
+L300: .data -446, -148, -959
+jmp *r6
+L301: .data -550
+jmp L101
+L302: .string "nqlsdistgmxiboxjqmxqbut"
+rts
+L303: .data 829, 17, 584, -239
+L304: .string "hkxpugbckhxrwspbogqtde"
+L305: .string "mwx"
+stop
+L306: .data -199
+L307: .string "hrinqjmneryzekqbnhrhcrjj"
+L308: .data 704, 437, -197, 185, 460
+L309: .data 68, 251, -517, -797
+L310: .string "sqhrvheat"
+bne *r2
+red r2
+L311: cmp *r0, #-170
+L312: .string "kxaebeeqpdotqunjnrti"
+L313: .string "oqdnbihalbdecshieiyzipak"
+L314: .data 301, -931, 282, -993, 513
+prn L315
+L315: .string "ob"
+L316: .data -42, 834, -608, 45, 107, -378
+L317: .string "oibswits"
+L318: jsr L22
+clr L319
+not *r6
+L319: .string "kvcwjomddsnjistt"
+L320: .string "wfq"
+L321: .data -304, -762, 856, 842, 342, 987, -740, 110
+L322: .data 19, -333, 555, 368, 790, -45, 852, -250
+L323: .string "gjbzxqzyrj"
+L324: .data 692, -541, 216, -404, 750
+red *r3
+L325: .string "kfatayqvobcrfoctfcf"
+L326: .string "knzbdtclnsiz"
+L327: .string "eqgxhoqilzijaruzr"
+L328: .data -704, -2, -375, -133, -713
+jmp L190
+
+L329: .data 76, -188, -898, -313, 433, -144
+L330: .string "ahmpn"
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 54
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .data -102, -452, 865, -774, 983, 737, 677
+not L0
+L1: .string "drbqsxp"
+L2: .string "jwptij"
+L3: .string "yycuuajlywpqpsdqrsgydni"
+
+L4: .data -913, -39, -447, -877, 159
+L5: .data 267
+rts
+
+L6: .data -380, 147, -40, -901, -578, -318, 548, -419
+L7: .string "eroezerkubquexs"
+L8: .string "gpzxayuq"
+
+L9: .string "xbwzomhxgbkibgdng"
+L10: .string "gxtxdvhmd"
+L11: .data -449
+L12: .data 154
+jmp *r3
+; comment
+L13: .string "bpgi"
+; comment
+L14: .string "xzdmfjhfjipmtenevyjrmkgc"
+L15: .data 417, 972, -913, 744, 112, 961, 889
+L16: add *r4, r2
+L17: .data -170, 915, 849, 542, 839, -274, 646
+jsr L7
+L18: red *r1
+L19: .string "kjzqzggwqciauj"
+; comment
+L20: .data 250, 696, 644
+add #187, *r6
+L21: .string "uvfogyaoxemfu"
+L22: .string "ppxxbqbyglplojxcvtqzm"
+L23: .string "lgsihmqjtleuiz"
+L24: .string "pbw"
+L25: dec L3
+L26: .string "ikdjjebilmlkvdhbcztpc"
+L27: .data -564, -245, -874, 368, 87
+L28: .data 171, -934, 47, -861, -513
+L29: .data 625, -238, -805, 143
+rts
+L30: .string "tgteplgqgsxyrnsqisolxmb"
+; comment
+L31: .string "fvjtag"
+jmp L25
+rts
+; comment
+; comment
+add *r0, *r4
+L32: .data -527, 135, -631
+L33: .string "abzkeafgryrfbmkfi"
+L34: .string "foocwlswfbmwbmdmnm"
+red r1
+clr L232
+stop
+L35: .data 204, -572, -800, 698, -115
+L36: .data -257, 938, -686, 242, -376, 171, -948
+L37: .data 577, -835, -102
+rts
+L38: .data 948, -515, 130, -419, -666, 475, 471, 560
+L39: .data -612, 665, -238, 492, -346
+mov r4, r1
+L40: .data -436, 471, -491, 836
+L41: red *r3
+L42: .string "nevvndeaariwmsbbarcaahqk"
+stop
+dec L287
+L43: .string "oaatpbufuxgdjok"
+L44: .data 797, -936
+red L153
+L45: .data -760, -854, 275, 789, -535, 213, 400, 315
+rts
+L46: .string "ezhklepqhxornbvujzbrijr"
+prn *r1
+L47: .data 629, 93, 898, -997
+L48: .string "q"
+L49: .string "uiatyxco"
+L50: .data -926, -999, 859, -50, 145, -549
+L51: .string "eosrgsc"
+cmp #102, L73
+L52: .data -345
+prn #148
+L53: .string "iaifvdukmbvbtqtaprngk"
+clr r6
+L54: .data -736
+L55: .string "thflrbourbqwrcaogohxmey"
+L56: .data 988, 605, -421, -72, -531
+add #-58, *r6
+clr L204
+L57: .string "wnganirmnudqwwwb"
+L58: .string "bmqmktyjrt"
+L59: .string "bfujep"
+L60: stop
+L61: .string "shdzitgbecvuhgnmrbkmnqt"
+L62: .data 239
+L63: .data -307, 664, 589, 325
+L64: .data 530, 764, -164, -676, 935
+L65: .data -128, -75
+L66: .data -770, 348, 158, 647
+cmp L158, L90
+L67: .data -986, -442, -427, 644, -551
+add #49, *r3
+L68: .data 844, 608, 272
+inc r7
+L69: .string "qhm"
+L70: .string "oykpzfexwiommcxxsa"
+L71: .data 323, -390
+L72: .string "f"
+L73: lea L136, L58
+L74: .data -776, -14, -212, -994, 321, -322
+L75: .string "dtzw"
+L76: .string "dhq"
+L77: .data -257, 132, -307, -601
+L78: .string "uyr"
+L79: .string "uxtzymsfurvvnryxdyo"
+L80: .data -346
+L81: .string "teahm"
+
+L82: .data -673, -736
+
+rts
+L83: .string "mbbxxqfusm"
+L84: .string "zuoykgyn"
+L85: .string "d"
+clr *r7
+prn L36
+jmp L63
+L86: .string "eoyuwqvtiakfsfkkwslbjipo"
+L87: .string "trcob"
+L88: .string "tcaxorkdbfjufpqnu"
+L89: .string "lnrlugmovcrlcriddkup"
+clr r6
+L90: .data 299
+L91: .string "nucasohjjoqeqdqb"
+not r1
+dec L43
+L92: .string "ysllxeifggpwarhr"
+L93: .data 255
+L94: stop
+L95: .string "ocptkftqojrbeahjzvmjw"
+L96: sub L9, *r4
+L97: .data -988, 737, 89, -355
+L98: .data -120, -666, -67, -574, 422, -785, 656
+lea L128, r2
+L99: .string "trqcqqqxyaipwaxwoncd"
+L100: .data -405, 80, 985, -363, 68
+red r7
+L101: red L0
+L102: .string "mspbucqvbclgeflykrvwktoh"
+L103: .string "xtj"
+L104: bne L250
+L105: .string "ugutjrkwfyccjbdf"
+red L278
+bne L152
+L106: .string "emgzf"
+L107: .data 143, -591, -983
+not r5
+sub #85, r5
+L108: .data -57, 455, -126, 261, -441
+jmp *r5
+L109: .string "ohcvchlunxyhiin"
+L110: .string "whryxwfgawhbnlkwrwnmposu"
+L111: .data -778, -462, -35, 278, 113
+L112: red *r5
+; comment
+L113: .string "fiylaumuehbousdxdftzne"
+L114: .string "cys"
+L115: .data 326, -865, 483, 878, -802
+L116: .data 133, 783, -466, -83, 286, 22
+inc r3
+L117: .data 836
+L118: .data -471, -920, 194, -875, 915, -669
+stop
+L119: .data 950, 70
+not L249
+L120: jmp L143
+mov *r3, r5
+jsr L221
+L121: .string "a"
+lea L66, *r7
+L122: .string "jucxs"
+L123: .string "okvadkfzpddrspyvfz"
+L124: .string "vrl"
+bne L76
+L125: .data 438, -877, -545
+L126: .string "akuml"
+L127: .data -537, 956, 865, 894, 407
+L128: .string "cfppsowgz"
+L129: not L330
+L130: .data 790, -101, 644, 235, -48, -544
+L131: lea L70, L145
+L132: sub #-194, r2
+bne L77
+L133: .data 944, -363, -283, 852, 678, -232, 731, -640
+L134: .string "pqgrcajnfqp"
+L135: dec r0
+L136: .data -109, -362, 631, -148, -95
+L137: .data -601, -452, 265, 449, 876, 647, -256
+L138: .string "wneogmzthtxngdsgibqgemc"
+L139: .data 854
+L140: .string "frmftlv"
+L141: .string "uyqlead"
+L142: .data 460, 894, 999, -349, -348, -984, 678
+L143: .string "pxfjxbvfihntxsp"
+jmp *r6
+L144: .data -248, 700, 912, 39, 688, 631
+L145: bne L296
+dec r3
+L146: stop
+red L101
+jsr L293
+mov r3, L76
+L147: .data 615, -666, 744, 501, 872
+L148: .string "fuikeniy"
+L149: .data -940, -738, 485, -852, 671, 645, 27, 859
+L150: .data 116, 709, 545
+L151: .data 766, -571, -225, -698, -730
+L152: .string "xvkcb"
+prn L314
+bne *r0
+L153: .string "xsxfnxiuhsmfvxrlkx"
+L154: .data -33, 773
+L155: .string "agzlky"
+; comment
+L156: not r7
+L157: .data -812, -194, 351, 155
+L158: .data 122, -627, 468, 389, 581, -454, -926
+L159: .data -860, 943, -648, 442, 59
+clr L216
+; comment
+L160: .data -471, 915, 291, -648
+sub r6, r7
+L161: .data 905
+stop
+L162: .data -435, -303, 587
+L163: .string "wjddhdmt"
+
+L164: .data 758, -742, 691, -641, -317
+inc r3
+L165: .data 837, 905, -947, 630, -837
+L166: .string "udwwigxcyu"
+L167: .data 209, -43, -969, -491, 42, -869, -388, 296
+
+dec L92
+L168: .data 327, -512, -845
+L169: .string "inokznlrnrecuzbeqiezs"
+not r5
+L170: .string "ourbupwaoinjoijpqykdthre"
+inc *r0
+jmp *r5
+L171: red r7
+L172: .string "ffzhzhkoj"
+L173: .string "pgeicb"
+L174: jmp L118
+L175: .string "oojhldpnmcjdsvafd"
+L176: clr r7
+clr r5
+prn r6
+jsr *r0
+L177: .string "fdrkfuztizy"
+L178: .string "utodaxyx"
+L179: .data -64, -283, -218, -183, 233, 489, 546
+; comment
+L180: lea L77, r2
+L181: .data -297, -828, -840, 174, -163, -136
+L182: .data -446, -197, -893, -33
+L183: .string "immos"
+L184: .data 231, 526, 11, 690
+bne L66
+L185: .data 554, 990, 490, 2, 475, 924, 547
+L186: sub L297, L315
+
+L187: .data -142
+L188: .string "ncstbpypllhr"
+L189: .data -62, 221, 47, -494, -641, -432
+stop
+cmp L300, #11
+add *r2, r1
+L190: .data 991, 644, 215
+rts
+prn #180
+L191: .string "lkvcned"
+L192: .data 937, 143, 430
+L193: .data -876, 114, -331, -365, -641, -91
+L194: .data 831, 805, 650, 596, 807
+; comment
+L195: sub #254, *r6
+L196: .string "lnmqggaas"
+clr L180
+
+L197: .string "gk"
+L198: .data -184
+L199: .data -858, -595, -958
+L200: .data -662, -888, 616, 245
+cmp r0, r6
+L201: .string "iuooosgqagd"
+L202: .string "dxk"
+bne L155
+L203: .string "xatjuzptgqtkzpr"
+L204: .string "wudxjkrikfnlqd"
+L205: .data -278, -194, 911
+L206: .string "rzzlcuj"
+L207: .string "ugvherhnjexryywrwn"
+jmp L263
+L208: .string "mhpuefzqao"
+L209: .data -25, 494, 705, 532, -92, -812, -108
+L210: .string "my"
+rts
+; comment
+L211: .string "slswngyfksziel"
+L212: .string "snqhjvgdhlnonhrpgqp"
+L213: .data 536, -926, 457
+
+L214: .data -188, 107, -418, -29, -22, 581, -214
+L215: .string "ke"
+L216: .data -566, 596, -724, -673, -310, -460
+L217: .string "rbnz"
+L218: .string "ruwzoswdjgaqyuiqdqiujbl"
+; comment
+inc r0
+L219: .data 197, 732, 233, -371, -29
+L220: .data 651, 219, 847, 242, -345, -515, -725
+L221: .string "qaoxuyawgkubqbmylzqh"
+red *r1
+L222: .string "evvntfqwncu"
+L223: .string "vfpsghqzpbb"
+jmp *r5
+L224: .string "ybebenfyxhfzbcvr"
+L225: .string "jq"
+
+; comment
+L226: .string "tdyfrtarutjqbcrqjavd"
+L227: .string "oly"
+not r7
+L228: .data -413, 157, -120
+L229: .data -860, -543, 669
+L230: .data 614, -604, -983, 28, 644
+L231: .string "ris"
+L232: .string "omfntgvvksrk"
+stop
+L233: .data -902, 225
+L234: .data -820, -852
+clr L118
+L235: .string "mymwussxhhbwiyslnekybyyp"
+stop
+L236: .string "fehxi"
+; comment
+L237: .data -444, 197, -811, 151, 644
+prn r0
+L238: .data -556, -3, 477, -321
+L239: .data -422, -513, -41, -419, 739, 130
+L240: .string "ezozgtjcadalpqjz"
+rts
+clr r4
+L241: add r0, *r5
+L242: .data -96, 748, 700, 520, 347, 663, 870, -377
+inc L311
+add #111, *r4
+add r5, r6
+L243: .data 569, 441, 11, -819, -868, 265, -824, 672
+L244: .data 23, -710
+L245: .string "uyojzctz"
+
+L246: .string "luozq"
+jsr L240
+clr L140
+L247: .data 946, 16, -586, -299, -644, -953, -627, 913
+L248: .data -132, -840, -277, -201, -514, -53, -974
+L249: .string "zuxsz"
+L250: .data 901, 21, 331, -812, -785, -12, 576
+L251: .string "wsydqkuchjwnuquukvomsi"
+L252: not r5
+L253: .data 24, -412, -79
+sub L16, L275
+bne *r3
+L254: .data -358
+L255: inc r5
+L256: .data -248, -407
+dec L85
+L257: cmp L276, *r3
+lea L55, L295
+clr *r1
+bne L267
+L258: red r6
+L259: .data 72, -892, 36, 246, 649
+L260: .string "jzkddbaidijhhkaxqo"
+L261: rts
+L262: .string "vkwnjmtwlz"
+L263: .data -830, 87, -413, 334, -766, -233
+L264: .data 325, 390, 677, 617, 144
+prn #-93
+L265: jsr *r0
+L266: .data -109
+L267: .string "pzyos"
+L268: .string "dzlkhygeacriillbhhsyozn"
+not *r7
+L269: .string "xamkvcxpcu"
+clr L106
+L270: jmp *r0
+L271: .data -321, 271
+L272: .string "txkpt"
+red L258
+L273: .string "bliwodp"
+L274: .string "idhysumylg"
+lea L152, *r2
+bne L139
+L275: .data 76
+L276: jsr L314
+L277: .string "ckiewzkewzbqmmvmrvpxb"
+L278: .string "ljytutyrpteytinpvvdvp"
+L279: .data 625, 783, -191, -588, 601, 468, -190, 944
+rts
+L280: mov *r7, *r6
+rts
+cmp #137, #169
+cmp r6, r4
+L281: .data 289, 683, -321, 385
+L282: .data 773, 759, -983
+L283: .string "gzjzqsdozwkkroo"
+L284: .string "ldckkprdxp"
+lea L125, L299
+L285: .data 81, -695, 850, -459, 247, 856
+L286: .string "ifoejdzvyus"
+dec *r3
+jmp L261
+L287: .data 698, -51, -590, -982, 959, 119, 819, -339
+L288: .string "aabxogoqdewoghtjwb"
+L289: .string "pchffzcwueahryixymh"
+mov #-182, *r7
+L290: .data -574
+not r0
+jmp L71
+add *r5, r2
+dec *r7
+L291: rts
+L292: .string "efedecfqvdmghpycujsf"
+L293: .data 900, -475, 625, 40
+L294: .data -587, 280, -947
+L295: .data -874, 40, -438
+clr *r5
+L296: .data 112, -220
+L297: .data 786, -211, 440
+L298: .data 833, 427, 872, -450, 134, 507, 21
+L299: .string "pptgeqcjpnagdweqr"
+L300: .string "afi"
+lea L323, *r6
+L301: bne L128
+L302: .data 385, 737, 417, -176, -797
+L303: .data -900, -752, -414
+L304: .data -755, -572, 24, 899, -301, 662
+jsr L149
+jsr *r6
+L305: .data 352, 594, 833, -593, 209, -601, 898
+L306: .string "zuvivbbvq"
+L307: .string "ikqu"
+add L161, L329
+lea L72, *r3
+
+L308: .data -283, -335, 81, 842, 55, -682, 870, -818
+clr r5
+L309: .data 893, -508, 115
+L310: .string "ndiqtdca"
+L311: .data 279, -255, -884
+red r7
+L312: .string "dytznfqp"
+L313: .data -819, 638, -781, -354, 664, -502
+L314: .string "otrugdujrrxprfoirxzom"
+
+red L91
+L315: .data 713, 341, 478, 556, 460, 371, 418
+L316: .string "vijdppjzijxlfwpuph"
+L317: .string "fxa"
+add #85, L326
+L318: .data -544, -201, -141, -966, -204, -674, -913
+L319: .string "gcsojmrkewammih"
+jmp *r1
+jmp *r4
+L320: .string "wzwm"
+not r5
+cmp L327, #104
+L321: .data -373, 133, -858
+inc r4
+L322: .string "gqokilaldoywhb"
+sub L230, r3
+L323: .data -315, -363, -275, 969, -821
+L324: .data -38, 915, 648, -119, 235, 436
+L325: rts
+dec *r4
+dec r7
+L326: .data -878, 954, -566, -935
+L327: .data -241, -814
+; comment
+L328: .data -196, -213, 591, 14, 759
+add L211, *r7
+L329: .string "bb"
+L330: .data 283, -65, -672, -858, -21, -274, 453
+L331: .string "eqvcpuwofvsxjoqjbse"
+prn r3
+not *r6
+stop
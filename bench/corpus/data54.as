@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 55
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .string "zgmzjylciqrgy"
+; comment
+L1: .string "qbhoitd"
+L2: .string "oauvzfyrwzqwkp"
+L3: .string "rhh"
+L4: sub L234, *r0
+
+L5: red *r7
+jsr *r2
+cmp r7, #-13
+L6: .data 591, 387, -59, -27, -583, -802
+inc *r4
+mov #-47, r5
+L7: .string "fwzruztqbgbpfaqkenk"
+L8: .string "aurvfnfiohsiom"
+L9: .string "xygijbiwqcixgdqguji"
+L10: bne L218
+L11: .data -913
+L12: .data -716, 72, -951, -855, -510
+L13: .data 336, 42, 233, 155, 375, -192
+L14: .string "gb"
+L15: add L315, L315
+L16: .string "ts"
+add r2, L5
+L17: .string "tbumonvifkddgzaorz"
+add *r7, r0
+L18: .data 130
+L19: .string "iiyruwfmgv"
+L20: .string "hroygapxijiplrvg"
+L21: .string "sadsyviyxylxyyoidvqnpf"
+add L238, r5
+L22: .data 574, 775, 382, 343, 615, 459
+L23: .data -336, -562, -893, 346
+L24: .data 306, 186, -822, 209, -209, 826, -406, 149
+cmp L14, r6
+L25: .data -550, -393, 62, -676
+L26: .string "yjzxzfjyhgecuguqj"
+L27: .string "wps"
+L28: .string "jtykjjueopla"
+L29: .data -681, 910, -527, -958, -853, 442
+L30: .data 752, -62
+L31: sub *r6, r2
+L32: sub *r0, *r1
+L33: lea L257, L119
+L34: .data 338, -192
+L35: .data -299
+L36: .string "ibcnxvcxcarpddbipnohty"
+
+L37: .data -123
+L38: .data -751, -87, 866, -868
+L39: .data -374, -549, 394, -252
+L40: .data -594, -888, 819, 221, 581
+prn *r1
+sub #-42, L305
+L41: mov r3, r1
+L42: .string "dihqsxbuavkcojmgyhfswl"
+L43: .data -435
+L44: .string "vacphuc"
+sub L74, r1
+jsr *r3
+rts
+L45: .string "hchhun"
+L46: .data 3, 454, -160, -643, -354
+L47: .string "qatykdogwoom"
+L48: .data 483
+L49: .data 159, -123, 115, -319, 918
+L50: .string "m"
+L51: .data 131, 3, 733, -199, -23, 789, -231, 556
+L52: .string "ztzaauewvwfxd"
+L53: .data -281, -483, 636
+L54: .data 451, -337, -685, 848
+add #12, *r2
+L55: .data -590, 369, -734, 100, 582, -160
+mov #229, *r2
+L56: .string "occoxtcuyrq"
+L57: .string "jhd"
+L58: .data -826, -818, 911, 131, 298, 211, 311
+L59: .data -222, -677
+inc r0
+clr L15
+L60: .string "tauglwibk"
+L61: .data -985, -649, 728, -99, 819
+L62: lea L79, *r3
+L63: .data -456, 302
+dec *r0
+L64: .data -969, -790, 480
+L65: .data 796, -968, 37, 945, -370
+L66: .string "ryoc"
+jmp L161
+lea L8, *r1
+L67: .string "otpyxlxdmemyeviokyenmx"
+L68: .data 75, 466, -577
+prn #-222
+L69: .data -321, 930, 619
+L70: rts
+L71: .data 980
+L72: .data 257, 237
+L73: .string "p"
+L74: .string "jmwdvhaznyaxjemvx"
+mov #-81, *r1
+; comment
+L75: .string "fjzweqttj"
+L76: prn *r2
+L77: .data 799, -152, 292
+L78: .string "pqvsfwyipeecmsauppjat"
+sub *r0, *r6
+L79: .data 911, 141, 503, 785
+L80: jsr L90
+prn #70
+inc r4
+clr r1
+jsr L98
+L81: .data -11
+L82: .data 820, -212, -333, -551
+
+not L31
+clr *r1
+red r0
+L83: .string "vqksppuzexhe"
+L84: .string "deypb"
+L85: .data 202
+L86: stop
+prn *r3
+jmp L44
+L87: .string "nsqzhptfgymihy"
+; comment
+
+L88: .string "divcmilruewerxgyvhu"
+sub *r3, L13
+L89: .string "jhl"
+L90: prn #191
+L91: not L283
+L92: jsr L158
+L93: .string "yxotmpqvttofinkbfsglqiyh"
+; comment
+prn r7
+clr *r4
+rts
+L94: .string "dqqufprhrkshvv"
+L95: .data -270, 701, -694, -50, 123, -944, 965, 196
+stop
+bne L238
+L96: .data 483, 244, 560, -751, -91, -936
+L97: mov #-193, *r0
+L98: .data 788, -260
+cmp r7, *r4
+L99: .data 895, -959, 680, 510, -896, -317, -468, -733
+L100: .string "kxxuqpckkcvndioenfpdww"
+L101: .string "jrexyuikzsezeuoniziyy"
+L102: .string "pihqjrovsxssfmjmjex"
+L103: .string "f"
+L104: .string "ckvhokpafubgzzwhf"
+L105: .data -785, 195, 520, 799, -535, -97
+L106: .data -831
+lea L97, *r3
+L107: .string "smqoe"
+mov #-217, r3
+
+L108: not L72
+L109: .data -832, -765, 190, 529, -164, -854, -697, 555
+lea L227, *r1
+L110: .data 163, 339, 981, 840, -775, 483, -948
+L111: .data -89, -385, -544
+
+prn *r2
+L112: .data -102, -808
+L113: .string "iqipfk"
+L114: .data -26, -931, -116, -379, 922, -941
+L115: lea L96, r2
+L116: .string "hdbkamiqskexcmu"
+L117: .data -159
+L118: .string "szabstzr"
+L119: .data 702, 822, -820, -187, -948
+L120: .string "vfc"
+clr r5
+; comment
+not r3
+; comment
+L121: .string "beorkanrjdpdp"
+L122: .string "nmnstzz"
+red L52
+L123: .data 762
+L124: .string "hqdayefegrqgzflxs"
+L125: .data 10, 104, -484
+L126: .string "iggpsmqclnktqgnynglx"
+dec L250
+L127: .data -537, 887, -659, -291, 179
+L128: mov #20, r6
+L129: .data 80, 671, 703, 183, 222, -701, 919, -970
+L130: .data -230, -182, 537, -109, 103
+L131: .data 594, -633, -397, -533, -264
+rts
+bne L2
+L132: .data -951, -65, -719, -885, 988, 887, 206, 362
+L133: jsr L140
+not r1
+L134: .string "hglkcijkpuotmhbs"
+prn #-145
+
+L135: .data -249, 888, 467
+inc *r2
+bne *r6
+L136: .string "vjglfvtuat"
+L137: .data 623, 12, 622, -770
+L138: .data 213, -321, -308, 455, 874
+L139: .data 572, 977, 862
+L140: .string "yqkeeypbtvie"
+jsr L253
+clr L22
+stop
+L141: .string "thaiuazklannjwsbikip"
+L142: .data 803, -966, 501
+L143: .data 896, -196, -565
+L144: .string "klqrceyujkacvl"
+L145: .data 191, 478, -233, -151, 995
+L146: jmp *r7
+L147: .data 282, 342, -364, -441, 382
+L148: .string "ftehjnnycjvieok"
+cmp #197, L192
+L149: .string "q"
+; comment
+stop
+L150: add r3, L120
+L151: .string "jzyqjnjsb"
+bne *r4
+L152: .string "wkiafc"
+L153: .data 12, 987, -383, -359, -973, 132
+L154: .data -364, 354
+L155: .string "hluhdtrjovjcktqko"
+add r0, r2
+not r1
+L156: .string "qhvoarprligof"
+clr L93
+L157: .data 259, -110, -64, -413
+L158: mov #145, L79
+cmp *r5, r1
+L159: jmp *r3
+dec *r0
+L160: .data 585, -533, 77, -239, -247, 335, -152
+jmp L192
+bne *r2
+L161: dec *r2
+L162: .data 462, -353, 527, -814, 567, -105
+L163: .string "i"
+; comment
+L164: .string "gzktev"
+L165: .data 543, -430, -423, -203, 784, -625, -268
+L166: .string "jaqmlqemqagagnnkqkz"
+L167: .data 673, -500, 936, 838, -565, 956, -555
+L168: .data 449
+bne *r7
+rts
+L169: .data -893
+L170: .string "muhiarwwaf"
+L171: .data 149, -610, -816, -970, 698, -506, 216, 612
+L172: .data -894, 682, 452, -2, 313, -49, 774, 651
+L173: .string "jngsmmvxxiaqqqdc"
+L174: .data 323, -708, 52, 571, -731, 994, 3
+add #-131, L130
+L175: .data 169, 509, -942, -358, -735, 572
+add L237, L188
+L176: .string "ejqbxathujnavwmqag"
+L177: .data 697, -868, -830, -152, -264, 990
+L178: .string "aamojimricoyvltkqrlujmmu"
+mov r1, *r1
+L179: .string "uuzaiyisdpvchun"
+dec L82
+L180: .string "pzvxtpyeqhnzkujbcxssdn"
+dec L154
+mov r5, *r4
+L181: .string "fpkeprwhmeraqqdg"
+L182: .string "uki"
+stop
+L183: .data 766, -390, 69
+L184: .data 999
+clr L17
+L185: .data 995, -981
+L186: .string "kmj"
+L187: .data 243, -706, -669, 806, 868, -238
+lea L67, L172
+L188: .string "goz"
+inc *r6
+L189: .string "qhwetizgnzmdiecl"
+cmp L113, *r6
+L190: .data -463, -127, -569, -832, 810
+rts
+L191: .data -780
+L192: .data 612, 299
+L193: .data 6, 928, 540, 153
+L194: cmp #14, #-162
+L195: .string "ibyyycsewuftipc"
+L196: .data 368, 349, 885
+L197: .data -514, -908, 478, 534, 790, 313, -915
+dec L313
+L198: .data -744, -622
+L199: .data 963, -868, -857, -742, -934
+bne *r5
+L200: .string "foqxtwdcmxvektwr"
+L201: .string "rphqwrwzv"
+L202: .data 361, -10, -71, 859, -393, 411, -745
+L203: .data 981, -506, 471, 821, -356, 220, -247, 293
+L204: .string "djqodihobuwi"
+L205: .string "sjanchow"
+cmp #114, *r0
+L206: not r2
+jsr *r7
+L207: .string "eke"
+L208: .string "f"
+rts
+L209: .data 735
+L210: .string "rrljsjd"
+L211: .string "lssqe"
+L212: .data 232, -940, -290
+
+L213: rts
+dec r1
+inc *r0
+L214: .data -266, -851
+clr L142
+L215: .data -684, 508, 1, -920, -193, 444, -183
+L216: .data 614, 62, 484
+L217: .string "fh"
+clr L128
+prn #-68
+L218: .data -819, -814
+L219: .data 251, 891, 893, 569, 266
+prn #82
+prn L241
+rts
+dec L328
+L220: .data -810, -897, -299, 940
+L221: .string "tabex"
+L222: stop
+cmp r0, L246
+L223: clr r5
+add *r4, r7
+jsr *r4
+L224: .data 456
+L225: .string "vdjvj"
+L226: .data -597, 755, 26, -254, 803, 549
+L227: .string "tllpznbect"
+L228: .data -767, -634, -445, -523, 651, 629, 278, 222
+L229: .string "lxj"
+
+L230: .data 199, 887, 793, 772, -739
+L231: .string "gmriau"
+rts
+L232: .data -511, 483, 897, 74
+L233: .data -941
+L234: .data -436, 813
+L235: .string "rwelzytwyrdmjskccxc"
+L236: .data 746, -343, 784, 491, -329, -334
+L237: red *r7
+L238: .string "tjptlwgmdyttvvojytwdhvr"
+bne L17
+red L289
+L239: .string "zqmvaxwmx"
+clr r4
+L240: .string "gb"
+clr *r1
+mov #-199, L218
+clr L304
+L241: dec L81
+L242: .string "zteeuqvcv"
+L243: .data -184
+L244: .data -853
+
+inc r3
+sub #-223, *r5
+L245: .data -330, -505, 855, 416
+L246: .data 317
+L247: .data -981, 814, -665, -750, -24, 677, 480
+L248: jsr *r0
+L249: .string "gfjgbdgninuiza"
+cmp L281, L313
+L250: inc L267
+L251: .string "hkvkdaahnrhdn"
+L252: .string "bamntjeiimsqra"
+prn *r5
+L253: .string "tgimmqf"
+L254: .data 358, 857, -87, -131, -345
+L255: .string "rfvo"
+L256: .data -80, 552
+L257: bne *r1
+L258: .string "gnoyraclrbailnxdw"
+L259: .string "qhoxshlkdzwywu"
+L260: .data 163, -806, -49
+L261: .string "bq"
+add #-131, r0
+jsr L306
+L262: .data 710, -429, 663, 463, -176, -446
+L263: .data -766, -111, -613, 716, 931
+L264: .string "ioyunpdehephpaur"
+L265: .string "xrcdm"
+; comment
+mov r5, *r2
+L266: rts
+L267: .data 255, -191, 522, -895
+L268: mov r7, L95
+L269: .data -715, 574, 16, 490, -270
+rts
+red *r1
+L270: .data 909, 109, 191, -451, 976, 937, 156, 432
+stop
+dec r4
+L271: .string "y"
+L272: .string "hkrfhfpgcivtxoboad"
+L273: .string "ntnpnzdimqzgbn"
+prn #48
+mov #243, L135
+L274: jsr L114
+L275: .data 556
+L276: rts
+L277: .string "wiej"
+bne L9
+
+L278: rts
+L279: sub #-175, L227
+L280: rts
+not L326
+L281: .data -820, -111, -366, -801, -875, -278, -93, -886
+L282: .string "epa"
+L283: dec r5
+L284: .string "synxnrsm"
+L285: .string "srcilaryelxhgxnelo"
+sub r4, L26
+; comment
+L286: .data 526, 269, -733, -974, -238, -408
+jsr *r6
+L287: clr r1
+L288: .string "bzybcvdwrrkrszdh"
+clr *r1
+L289: .string "xuxqyujrsfjxhpuhsynlry"
+add L298, r6
+sub *r7, *r1
+L290: bne *r6
+L291: .data -593, -133, 611, 178, -344, 285, 966
+sub #-179, *r2
+L292: .data 906
+L293: .data 597, -372, 330, -302, 69, -64
+L294: .data 823, 256, 625
+L295: .data 996, -867, -980, -495, -401, -737, -642, -109
+L296: .string "nogsgmujbrqv"
+L297: .data -24, -321, 997, -887, -985, -14, -79
+mov L299, r5
+jsr L257
+L298: .data 746, 533, 292, 610, -892, -467, 196
+L299: inc r1
+L300: .data 624
+add r6, L304
+jsr L306
+L301: .data 370, 50
+L302: .string "ocgulagapqjfctycmdedo"
+L303: .string "hvuauwuseheplqvreyyd"
+L304: .string "taduxpeqaiofgppfoywfxjk"
+L305: .string "dxuscrlqobqnnnejncc"
+rts
+L306: cmp *r1, *r6
+L307: .string "zwlscxxigvsxad"
+L308: .data -188, 710, 415, -62, -163, 83, -166
+inc r6
+L309: .string "rix"
+L310: .string "vh"
+rts
+inc *r4
+cmp #201, L326
+L311: add r1, L269
+rts
+L312: .data 22, -513, 596
+rts
+sub L227, r0
+L313: .string "fjoemlhfwzikesrjnac"
+L314: .data -965, 737, 562, -466, -429, -281, 163, -246
+add L322, L326
+L315: .string "ttttsxtmkqntkhehzqynfw"
+L316: .data 258, 788, -387, -249, 160, -89, 992, 326
+inc L318
+L317: clr L215
+L318: .string "zfnvwoccmdecebzl"
+L319: .string "xjbclupylxqvrm"
+prn r0
+red *r4
+L320: .string "mwy"
+
+
+prn L321
+L321: .data -466, -321
+L322: .string "hjgrxkmvijoeqc"
+L323: .string "voltkmsylnziepmlbpg"
+L324: .string "jdzinyvakdlumabsmguc"
+L325: sub *r3, r5
+add #-176, L95
+L326: .data -882, -799, -774, 586
+; comment
+L327: inc r2
+L328: .data 346, -939, -883
+stop
+prn *r0
+sub *r6, *r5
+L329: .data -37, 49, -540, -347, -252, -516, 444
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 56
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+red L94
+L0: .string "mcueqkmazlbkjmxz"
+bne *r3
+L1: .data -746, 745, 98, 650, 746, 580
+L2: .data -805
+lea L0, L153
+L3: .string "uibvrmaggvuva"
+L4: .string "ljxsxeyswdghqc"
+L5: .string "mlfncxbjtdnelcrwbq"
+
+cmp #-5, #96
+L6: .string "h"
+L7: .data 934, 225, 831, 190, -393, 307
+L8: .data -392, 141, 520, -541, 732, 735, 848
+
+L9: .data 143, 702, 523, -349, 664
+L10: cmp r4, L1
+L11: .string "ktxmgiibbh"
+L12: stop
+L13: .string "qagmbctnxp"
+L14: .data -781, 851, 471, -622, 999, 199
+; comment
+L15: .data 74, -664
+L16: .data -992, -361
+L17: .data 88, -434
+; comment
+L18: .data -121
+L19: .string "byiugonx"
+L20: .data -297, 736, -651
+L21: .string "tgpzho"
+not *r6
+L22: .data -723, -547, -514, -233, 929, -787
+L23: .string "fjsgbefvgxabadaxsnhilcm"
+L24: not L260
+L25: .data -518, -579, 438, 785, -615, 661, -588, -481
+L26: .string "knegllktcpyxwvb"
+clr r6
+jsr L265
+jsr *r0
+L27: .string "aqwxend"
+L28: .data -712, -49, -330, 839, 428, -741
+clr r0
+L29: add r0, L299
+L30: .data 565, 992, -922, 396, 372, 635, 602
+add *r0, *r4
+L31: .string "qzpmjdkqttlxqwrq"
+clr L5
+lea L325, *r6
+L32: .data -411
+L33: .data -435, 471, -786, 564, -579, -658
+not r5
+L34: .string "ncwgrhxysmbccvivtsnkg"
+L35: .string "p"
+L36: .string "xbbfcwdpllvglj"
+add L6, r2
+L37: .data 254
+L38: .data 635, 661, -733, 227, 85
+prn #1
+L39: .data 481, -643
+L40: .string "wykpxczjwojlotgsh"
+jmp L122
+L41: .data 12, -767, 635, 445, 161, 14, 128
+L42: .data -302
+L43: .data -69, -412, 537, -739
+L44: .data -184, 542, 680, 89, -1, 752, 572
+L45: jsr L155
+; comment
+L46: .data -733, -656
+L47: .data -797
+not L32
+jmp *r4
+L48: .string "azpvhygsjiqg"
+jmp *r4
+L49: .data 373, 313
+L50: .string "lneiadbi"
+L51: .string "thzzfndauny"
+L52: .data 500, 657
+L53: .string "kcnjkuftqqnaqebiiwmojg"
+stop
+inc L41
+jsr *r0
+L54: .string "xqecaamobxehriyeeyqb"
+lea L183, L57
+L55: clr r6
+L56: .data 243, -431, -89, -886
+L57: .data 345, 38, 827, 27, 617, -687
+mov L22, *r5
+cmp r3, #72
+L58: .data 235, 317
+
+L59: .string "hgnlfwb"
+L60: .string "xcnkzuzlwvzghy"
+L61: .data -279, 184, -128, 446, -845
+
+red *r3
+L62: add #-196, r4
+mov L216, r4
+L63: .string "fjtid"
+sub r3, L30
+jmp *r7
+L64: .string "iqeqwdehjlgxxtmffsisak"
+L65: .data -234, -904, -198, 308, -560, -967, 938, 377
+add r2, *r6
+L66: .string "nvarpszvupndhcbkbcjr"
+red *r0
+L67: .data 466, 645, 525, -161, 473, 721, 132, -642
+prn r3
+add *r1, r3
+L68: .data -660
+L69: sub L12, *r2
+dec L108
+L70: .string "elvxfysoevauqvkcg"
+L71: jsr *r1
+L72: .string "wkqmjihwyj"
+; comment
+red r0
+L73: jsr *r1
+L74: .data 458, -251, -477, -791
+L75: .data 778, 827
+sub L297, L132
+L76: cmp r1, *r4
+L77: .data -515, -387
+L78: add r0, L251
+mov L304, r6
+L79: .data 933, 878, -641, 617, -227, 188
+mov r4, r7
+L80: .data -325
+L81: .data 408, -545, 7, 301
+L82: inc r3
+rts
+rts
+mov #-113, L145
+L83: .data 243, 860, 80, 504, -123, -397, -167
+L84: .string "jvujvawumzykbwbnremn"
+L85: .data 44, 959, 944
+L86: .data 676, 866, 914, 390, 975
+mov L16, r1
+sub #-189, *r0
+jmp *r5
+not L47
+L87: .string "w"
+L88: .string "lqufndymbqhrwv"
+L89: .string "nvubjbhbygd"
+jsr *r7
+L90: .string "mkpydynv"
+sub #158, *r2
+L91: .data 893, 130, -317, -22
+L92: .string "nmkbpyoxtuirjcmhhatailoc"
+add #227, *r0
+L93: .data -314, 176, -523, -510
+add L138, r6
+L94: .data -993, 34, -942
+clr *r2
+mov r0, r1
+L95: .string "hgci"
+L96: .string "utnvgxvnbbfnlvxwc"
+L97: .string "bhtjgjzgkfvvkiamfqsc"
+stop
+jsr L91
+red *r1
+L98: .string "e"
+not L53
+L99: .data -519, -198, -617, 233
+L100: .data 364, 715, -108
+L101: .data 973, 743
+stop
+
+red r5
+L102: cmp #159, *r5
+L103: .data -134, 50, -294, -235, -998, 369, 649
+L104: .string "ybigxrovpzmxxryfygfs"
+L105: clr *r0
+L106: .data 300, -175
+L107: .data -579, -307
+L108: .data 464, 360, 240, -487
+; comment
+L109: .data -396, -96, -702, -261, -169, -700, -766
+L110: .data -94, -289, 171, 952, -353, 544, 847, 342
+mov L23, *r5
+L111: .string "ltgzvzopsalnedzqpmit"
+L112: .data 601, -985
+L113: .string "vjmdnntehuxsbndm"
+L114: .string "pal"
+jmp *r3
+L115: .string "loovuqgxcrgdfqfiigyj"
+L116: .string "ohxvxkxfp"
+cmp #120, r1
+mov r1, L44
+L117: .string "tjvxqpvjqyvkfveuxpyrxwtb"
+L118: .string "vkgctd"
+L119: .data -667, -217, -29, 834
+L120: stop
+L121: .string "wtzswhlbpxuzlnwtuj"
+L122: .string "idfkzszcyixewqnargem"
+L123: .string "vwijza"
+L124: .data 0, -883, 447, 553, -354
+L125: .data 588, 204, -661, 286
+L126: .data -976, 191, -18
+L127: .data -732
+L128: .data 336, -553, -112
+red *r0
+L129: .string "oqxbs"
+L130: .data 59, -11, -271
+L131: .data -832, 855, -16, -44, 768, -592
+L132: .data 668, -116, -275, 211, -661, 495, -575
+L133: .data -626, -736, -235, -817, -661, -603, 601
+rts
+jmp L288
+L134: .string "vawmhjdnd"
+L135: .string "tnptcliybka"
+stop
+L136: jmp *r4
+L137: .data -309
+L138: .data 830, -587, -216, 392, 173, -794, -749
+L139: .data -619, 760, -14, 599, 976
+L140: .string "fsug"
+; comment
+L141: .string "x"
+L142: .string "ybzawwfcprngugfqdjoqildp"
+stop
+L143: .string "ippnfvdbmwcezjrk"
+dec r3
+L144: .data -995, -830, 328, -866, 846, 809
+bne L60
+L145: .data 341
+
+not L97
+L146: not L141
+L147: .data 568, 725, 652, 887, 250, 831, -692
+prn *r6
+inc *r1
+L148: .data 15, 477, -139
+L149: rts
+L150: .data -338, 510, -64
+red r3
+L151: .string "ajwldlqsnuarywkqjwuadpdg"
+L152: .string "hgkkdpgvqrvdnauttw"
+L153: .data 746, 770, -377
+L154: prn *r5
+L155: .string "ytjuuklobe"
+lea L231, *r0
+jsr L155
+L156: .string "qilmf"
+lea L45, *r6
+jmp *r7
+dec L249
+
+L157: .string "nekcosyyaiigo"
+sub r3, *r1
+L158: .string "tkjfh"
+L159: .string "sebnxqsqihdgpbs"
+mov r0, L245
+L160: .data -699, -962
+L161: jmp L239
+L162: .string "sqkxhajcvhnzoa"
+L163: .string "ytyqrhyrzzlrehhrpiyzyt"
+stop
+L164: .data 262, -507, 791, 685, 18
+L165: .data 181, -444, -461, 832, -27, 311
+; comment
+mov L135, L198
+prn *r5
+prn L171
+L166: .data 817, -915, 221, 307, -876, -656, -659
+
+L167: .data -194, -85, -270, 150, -224, -529
+L168: .data -830, -949
+clr r5
+L169: .string "ugnmkgjqtcn"
+L170: .data -220, -708
+inc *r0
+bne L149
+L171: .string "naukistcwaqmn"
+mov #166, L295
+L172: rts
+L173: .string "dnulmaxamy"
+L174: .string "axteyhpppc"
+prn L203
+dec *r1
+L175: .data 795, -387, 706, 681, 798, -575
+L176: .data 155, 838, -229, -277, -563, -168, -497
+clr L4
+cmp L169, L154
+L177: .data 182, -473, -400, 329, 693
+L178: .data -872, -932
+L179: .string "jlzbtkew"
+not r6
+cmp r6, r1
+L180: .string "xhltsvicrsnjiw"
+L181: .string "jrnukdsqx"
+L182: .string "bnivmq"
+L183: .data 663, 292, -316, -236, 966
+red L202
+lea L191, r5
+L184: .data -829, 263
+cmp *r4, L111
+
+L185: .data 498, 267, -845, -1
+
+jsr L126
+lea L237, L104
+L186: .string "i"
+L187: .data 866, -343, -324, 879, -359, -577, 349
+L188: .string "tlnfdcyczcfaidcpdyrjjodg"
+inc r4
+L189: jsr L202
+stop
+clr *r6
+inc L195
+prn r6
+L190: .string "cjjirldlyyx"
+not L71
+L191: .string "juhgnzloikgblzuktkfifpm"
+L192: .data -547, -320
+L193: .data 982, -724, -879, 411
+L194: .data -421, 984, -473, 157, -141, 469
+L195: .data -812, -60, 256, 24, -979, 958, 406
+L196: .string "nc"
+L197: .string "phksqzhhzzd"
+lea L27, L30
+L198: .string "hhirwycjgsomqhs"
+L199: .data 960, -411, -865, -894
+L200: .data 753, -571, 528, 108, -17, 396, 103
+L201: .string "yssvufcobayovobvinvpalo"
+L202: .string "zviydqycmzvabf"
+dec L217
+bne *r4
+L203: .data -158, -135, 835, -732, 965, -776, 886
+L204: .data 419, 929, -308, 400, 821, 787, 978, -373
+L205: .data -892, 903, -136, -520, 745, 36, -585
+L206: .data 160, 556, 654, 3
+L207: .string "btveoojrf"
+L208: .data -171, 201
+L209: .string "gycrwlyou"
+L210: .string "mxvrylylisggqrbpnu"
+L211: .data -445
+L212: .string "ptxxrsozkipaas"
+L213: .data -625, 948, 336, -385, 736, -139, 801
+bne *r7
+L214: .string "hfblxjpevqfvgstioskmqlu"
+L215: .data 518, -582, -718, -348, 357, -645, -891
+L216: add r0, L9
+L217: .string "fkkcphuhfnkjmzzebtee"
+L218: .string "fngfgtbljgkvwaadri"
+red r0
+cmp L329, #58
+not r6
+L219: jmp *r3
+L220: .string "ijlhgs"
+L221: .data 908, -604
+dec r1
+L222: .string "arcmy"
+L223: .string "pvpmmiznshds"
+L224: .string "kmmoompvlm"
+L225: .data -860, 766, 435, -979, -983, -405, -735, 616
+L226: .string "ckxjwrzrlq"
+L227: .data 373, 448, -131
+not *r5
+L228: .data 866, 544, 355, -970, -566, -467, 437, -953
+stop
+
+L229: .data 695, 116, 69, -899, -240, 522
+L230: .string "arydlsyuwjdtxvh"
+L231: jmp *r5
+L232: .data -196, -814, -289, -165, 652, 511
+add *r5, *r2
+L233: .data -62, 552, -234, -11
+
+bne *r3
+clr r7
+mov #174, L270
+L234: .data -182, 741, -397, -839, -832, -478, -922
+L235: .data 101, 221, -73, -87, 314, -917
+L236: .data -967, 960, -41, -862, 908
+add L232, r5
+L237: .string "gistotjmlhz"
+L238: .data 58, 151, 835, -442, 259, -915, -949, 226
+mov r6, *r0
+L239: .string "ofxalldxlzacriua"
+L240: .data -678, 37
+L241: stop
+L242: .data -758, -962, -393, -858, 902, 590, 491
+L243: .data 282, -547, 418, -485, -918, 558, 601
+clr L51
+add *r6, *r2
+L244: .string "updxmt"
+L245: .data -391, 945
+L246: .data -966, 438, -631, -217, 462, 103
+L247: .string "vnblztathiomwhjf"
+L248: .string "ptwxqx"
+L249: .data -185, 330, 304
+prn *r4
+L250: .string "ozadwkzcjtaloyqoc"
+L251: .string "isafieamygsyklgiklctdrl"
+L252: .data -979, 588
+jmp L319
+rts
+L253: add *r7, r6
+L254: .data -136, -360
+add *r5, L255
+L255: .data -490, 192, -281, -780, -87, 343, 649
+mov *r1, L43
+stop
+stop
+L256: .string "ybzsykyxaau"
+; comment
+L257: .string "hjnluslbvhrkb"
+L258: .data 747, -979, -224, -727, 943, -260
+L259: .string "zzljdbypbuocz"
+L260: .data -345
+L261: .string "bt"
+L262: .string "rjewaoqbrblmgivpxg"
+inc r0
+add L296, *r1
+L263: stop
+L264: .data -40, -540, 286, 196
+L265: .string "ttanzsvvciniidk"
+L266: .data -853, -82, -247, 136, 279, -576
+L267: .string "gtx"
+L268: .data -828, 720, -931
+L269: .string "njq"
+L270: .string "liqnusu"
+L271: .data 647, -114, 825, 155, -215, 675, 445, -143
+mov L273, L294
+L272: .data 525, -731, -144, 889
+not L310
+L273: .string "maaqrkfvkmaujlmuneyc"
+L274: .string "puybyxfmprymlfzencwjes"
+L275: .data 700, -413, -772, -377, 684, -579, -476, 251
+L276: .data 431, -433, 539, -272
+L277: .data -513, 42, 194, -328
+L278: .string "wcelf"
+L279: .data -424, 679, -75, 999, -715
+L280: .string "mvmykwrispgaokmqyx"
+L281: .data -664, -869
+L282: .string "afubgskkkaczrfhdecxgzm"
+L283: .string "werkofelqwdt"
+L284: .string "bswdcpxhpxnolmcotb"
+red *r4
+L285: jmp *r7
+mov *r7, r1
+L286: .data 610
+L287: .string "werstkdikgzib"
+L288: .data -245, 971, -218, 902, 624, 606, 455, -844
+L289: .data 845, -305, -616, -282, 643, 617, -45, -222
+L290: .string "kjriwlwtfyrkmefjqqz"
+bne L206
+L291: .data -477, -984, 119, 778, -511, 669
+L292: .data -112, 917, -651
+L293: .data -435
+L294: .data 278, 8, 67, 625, -735, -968
+lea L197, r2
+prn #-11
+L295: .data 635, 727, 942, 525, 717, -436, 760, -581
+L296: jsr *r4
+L297: .data 99, 372, -339, -442, -853, 283
+jsr *r2
+L298: .string "cyieknzbhfstfqlze"
+L299: .data 869
+L300: red L214
+bne L306
+L301: rts
+L302: .string "uopbwfjquediata"
+L303: .string "syqxpehmbvtnix"
+L304: .data -13, -273, 648
+L305: inc L327
+L306: .data 334, 187, -139, -928, 93
+L307: .data 533, 705, 88, 128, -56, 824
+L308: .string "hpsnkjapecnvvvuribvlln"
+L309: .data -734, 495, -90, -279, -148
+L310: .string "pvpatvm"
+dec L312
+L311: stop
+L312: .data -719, -171, 786, 232, -13, 416
+L313: .string "svorsmus"
+L314: .data -27, -323, 706, -319, 119, 621, -98
+L315: .string "tkfedfyvpjkzeqkbidgy"
+L316: .data 264, -184, 273, 347, -102, -656, -766
+L317: .string "uegcrjidtwbefcpuqgalul"
+mov #-74, L48
+L318: jsr L313
+jsr L325
+L319: .data -251, -810, 856, 896, 24
+red r4
+L320: .string "pjfikyoyigpvncfnifut"
+prn L252
+; comment
+L321: .string "mrrxgssuhjshzw"
+L322: .data 738
+L323: .string "kvw"
+stop
+L324: .data -267, -716, -86, -353
+L325: .data -498, -285, 335, -383, -628, -114, 42
+L326: .string "txcfkdjhwveasdhpogznvkt"
+bne *r2
+L327: .string "mbyeyzrohzaqtvcxdcxehg"
+add *r3, r0
+L328: .string "vwbzzxpn"
+L329: .data -236, -407, 952, -685, -351, 28, -670, -772
+L330: .data 699, 400, -163, -57, -767, -863
+stop
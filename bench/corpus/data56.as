@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 57
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .string "kudpttwbphjmluzufzpdr"
+L1: .string "hzprcgdzg"
+L2: .string "jahcevnldwxxzdphggp"
+lea L170, r1
+L3: .string "ea"
+
+L4: .data -54, -350, 409, -123, 155, -461, 666
+L5: .data 961, -841, -274, -350, -402, 434, 744
+dec L292
+L6: .data -872, -507, -867, -389, -495
+L7: inc L243
+L8: .data -495, -596, -748, -905
+not L0
+jsr *r0
+L9: .string "zgkosbxcsmgpctgoo"
+L10: .string "xlfqygriwrkxmncpgpva"
+L11: .data -985, -90, -213, 994, -664, -192, 983, 707
+L12: .string "dflsrverwpgsedvhuht"
+prn r5
+dec L2
+sub #-217, r5
+L13: .data 672, -968, -117, 176, -664
+L14: not r7
+sub L11, *r5
+jmp L186
+L15: .data 507, -445, 557, -828, -126, -84
+L16: .string "valiklllx"
+jmp L242
+L17: .string "xtvomannzlfko"
+inc L129
+L18: .string "blpfdvvjmdtpwnbpxbsuom"
+L19: .string "dzmbcjaguiumbzcrvmiq"
+L20: .string "pmhaxxmavexx"
+L21: .data -268, 526
+L22: .string "frgfrncowemuanbnmi"
+not L42
+dec L211
+L23: .string "gxgsuttoz"
+cmp #-155, *r1
+L24: .string "lmfzmnreythtqjufccsoa"
+L25: .data 901, -989, -231, 176, 627, -460, -735, 7
+mov L146, *r3
+; comment
+clr r5
+L26: .string "lfuqafddhfv"
+L27: .string "ovpnkrduyuxnygdqficjvfy"
+L28: .string "juddmvdzyveppgjnowdvf"
+L29: inc r5
+L30: .string "inmxadtjvgoeklwyrkwf"
+lea L281, L27
+L31: .string "qiwinkzhzpiffcv"
+L32: red *r4
+L33: add L132, r3
+L34: jmp L25
+L35: .data -237, -949, -939, 854, 893, -205, -161, -956
+red *r5
+L36: .data -503, -115, 978, 139, 628, -778
+L37: .data -32, -274, 115, -277, -974
+L38: .string "csztlgxkgqx"
+L39: .string "vywhkdeginlejqjnuhl"
+L40: mov *r4, r7
+L41: .data -538, 293, 663, 789, 712, -54, -482
+L42: .string "lgmhtwytjldez"
+bne L25
+L43: .data 500, -890
+L44: .data -37, 112, -177, 397, -11, -386
+L45: .data 314, 634, 799
+L46: .string "eskhcyxwtkvlidogfhxxg"
+L47: .string "angyhpduyegxopn"
+L48: jsr *r5
+L49: .data 562, -333, 63, -631
+L50: .data -159, -813, 112, -725, 283, -265, -625
+jmp *r3
+clr r4
+L51: .data -589, -78, -111, 447
+L52: .string "rxhzqxxbaomdyjimivxgcjt"
+jmp L114
+L53: .data -98
+L54: cmp *r3, r6
+L55: .data 194, 461, 822, -301, -564, -822, -330
+L56: lea L41, L13
+prn L277
+L57: .string "kdrdbhtbsvarjukxfxgovbj"
+L58: .string "mljiluwafgprnpxw"
+red L53
+L59: .data -593, 700
+L60: .data 389, -504, -45, 604, -94
+L61: .data 61
+L62: clr L36
+sub r3, *r5
+L63: .data -978, 740, -311, -162, 983
+L64: not r6
+L65: .data 298, 278, -196, 462, 764, 452, -336
+L66: .string "ohbbxgszoilxqgtaxqy"
+L67: clr *r1
+L68: .data 493, 245, 659, -213, -465, 238, 721
+L69: bne L122
+L70: .string "dyypxkwtb"
+prn #-153
+; comment
+not *r3
+L71: inc r6
+L72: .string "t"
+L73: .data -442, -284, -195, -803, 548
+L74: .string "ujgmeiowpvx"
+L75: .string "yuxhpwzuabycdgjtwnmswzuc"
+jmp L220
+inc L47
+L76: .data -391, -126, -145, -387, 992
+L77: .string "uo"
+sub L57, *r0
+L78: .data -235, -841, -437, 882, -163, -452
+L79: .data 440
+L80: .data -395, -544, 401, -274
+clr *r5
+L81: stop
+L82: .data -839, 764
+L83: .data 30
+L84: .data 437, 924, -677, 213, 930, 354
+L85: .string "mwsweshzupggiym"
+L86: .string "iywuznlbfp"
+prn *r1
+
+L87: .string "dkrdvllxcdidr"
+L88: .string "udvrnlbtzyrfouitkl"
+stop
+L89: .data -26, -35, 401, 813, 582, -93, 184, 171
+stop
+L90: .string "qi"
+dec r7
+L91: .string "jfstkflmuvcdxcidhgujf"
+; comment
+L92: .data -436, -16, 200, 521, 59, 643, -464
+L93: .data 768, 701, 413
+L94: .data -609, 490, -336, 295
+L95: .string "vxvsdowtxfbmjvnltsmukig"
+L96: .string "yapmlr"
+L97: .data 515
+add *r7, r1
+L98: .data -1, -920
+; comment
+L99: .string "umrwlcqtnnhxjuwnkggut"
+L100: .data -748, -753
+sub #146, r1
+L101: .data -770, 480, -40, -850, 542, 221, 258
+L102: .data 71, -767, 753, -206, -146, 474, 929
+L103: .data 425, -177, 401, -825
+L104: .string "minrhnof"
+L105: .data -406, 282
+
+not *r3
+L106: .string "mmcmtgrkwbmcmpg"
+L107: stop
+L108: .string "dtssrwzbmd"
+; comment
+L109: .data -131, -800, -897, 182, -475, 489, -84, -875
+L110: .data 794, 537, -500
+jmp *r7
+L111: .data 117
+jmp *r2
+L112: bne L264
+L113: .data -311
+not L276
+L114: .data -819, 644, -15, 656, -645, 865, 586
+clr r7
+L115: .string "wjrwhnozvxibxzxwe"
+L116: jsr *r4
+L117: .data 820
+L118: .data -6, -514, 429, 335, 768
+cmp L68, r5
+L119: .string "bcf"
+L120: jsr L181
+L121: .string "jdxarcponhec"
+L122: .data 939, -459, 867
+L123: .data -236, -766, -626, 57, 436
+L124: .string "v"
+jsr *r5
+jmp L74
+add *r1, L28
+inc L226
+
+red *r4
+L125: .data 660, 653, -745, -826, -999, 342
+rts
+L126: .data 699, -682
+L127: .string "fczehvmkfz"
+L128: .string "aajrhjjveqaxomuetblez"
+L129: .string "wiwcawzndaavsidmwshmwkv"
+prn L257
+L130: .string "tspbldtwfdsbrkvhtte"
+stop
+L131: .data 174, -855, 628, -210, -534, 363, 568, 706
+add #-142, L112
+L132: .data -352, 229
+
+L133: .data -20, -867, -506, -12
+L134: .string "fbwbfcbxcod"
+L135: .string "utazzjjisrwokh"
+L136: .string "cvhenpnbzcwqbl"
+L137: .string "mszrtukvktclwzoprgzoqfxs"
+L138: .string "dx"
+L139: .data -998, 342, 854
+L140: bne *r2
+
+sub *r7, L271
+stop
+L141: .data 615, -705, 844, 760, -706, -103, -472
+L142: .string "oxzimx"
+L143: .string "h"
+L144: .string "kwphllxec"
+L145: not r3
+cmp L27, #232
+L146: .string "jebxeatrfgyjdpl"
+bne L166
+red r2
+L147: .string "jyampbnmw"
+L148: cmp r5, #-162
+L149: .data -535, 149, 57, -131, -771
+bne L48
+L150: .string "osih"
+red r7
+L151: .data -492
+L152: prn L288
+bne *r2
+red L258
+clr r5
+L153: .string "on"
+L154: .string "hippfkblypvmhiwijkncqyh"
+L155: .data -489
+L156: .string "pobiujaokszqrudmxqbuj"
+L157: .data -515, 513
+
+rts
+L158: .data 621, -784, -69, 291
+L159: .data -221
+
+L160: .string "qgiffvd"
+dec r0
+L161: .string "ndmhadhclbavntckwnqccw"
+L162: lea L100, L147
+red r5
+L163: .data -585, 285, 2, -731, -993, 109, -650, -987
+L164: .data 721, 500, 164, -554, -96
+L165: dec L45
+L166: .string "cedpkacdx"
+jmp L118
+L167: .string "x"
+stop
+L168: .string "gshppejqbtdkbgweqdxp"
+L169: .data 697, 344
+prn L322
+L170: .string "dajghufodhmvslrnp"
+L171: .data -217, 753, 692, -979, -448, -951
+L172: .string "bdfpudeggnsvadduhatruvfa"
+L173: .data 250, 532, -82
+bne *r1
+prn *r4
+
+L174: .data 811, -886, -616, -867, -566, -59
+L175: mov L274, L188
+L176: .string "eowdkrhizypzcxxatcb"
+L177: .string "rimdclhfdwflxpm"
+L178: .data -383, 369, 284
+L179: not *r4
+not r3
+dec r7
+L180: .string "hmnpqybpcphnw"
+L181: clr *r3
+L182: jmp *r7
+L183: mov r2, *r0
+L184: red r0
+L185: .string "njymuvcuqky"
+inc *r5
+L186: .data 149, 650
+jmp *r6
+L187: .data -174, -877, 775, 885, 504, -404, -189
+L188: .string "ljraj"
+jsr L170
+add #186, r0
+L189: .string "hbltl"
+L190: .string "hc"
+
+inc L330
+L191: .string "hyggavikfqikjw"
+cmp #-109, #-225
+L192: mov r5, L31
+L193: .string "vmxsdz"
+L194: .string "zjbzpieqtvey"
+L195: .data -720, -59, 688
+L196: .string "iqzvy"
+L197: .string "tbfqoumogoefgmtatsivz"
+L198: .string "wnp"
+L199: .string "x"
+clr L304
+L200: .data 361
+L201: .data -969, 854, 111, -819
+L202: .string "mpz"
+L203: .string "vsh"
+add L95, *r1
+L204: .data -457, 838, -495, -602, -970
+lea L141, *r4
+L205: .string "ygmkpyfryzdt"
+L206: prn #97
+L207: .data -30, -651, -3, -430
+dec *r2
+L208: .data -799, 42, -202, 340, 566, 103
+L209: .data 496, 286, 111, 871, 231, -854
+
+L210: .string "agmba"
+cmp r6, #-60
+sub r1, *r1
+jsr *r0
+L211: .data 329, -403, 554, 183, 397, 901, -308, 178
+L212: .data 365, 765, -166, 660, 178, -226, -338, -652
+add #152, *r2
+add r7, L90
+L213: .data -468, -805, 705, -542, 692, 349, -683, 509
+L214: .data -949, 13, 615, -506, 968, 778, -216, 927
+L215: .data -193, 230, -951
+; comment
+cmp #31, r2
+red r0
+L216: .data 963, 320, 837, -725, 621
+stop
+L217: .data 272, -496, 316, 916
+L218: .data -422, 300, 578, -478
+L219: stop
+add #187, r0
+
+L220: .string "cnouxotgqlwebai"
+L221: .data 691, -794, -59, 565, 260, -302
+L222: .data 769, 286, 166, 47
+L223: .data 212, -566, 353, 492, 691, 366, 112, 418
+L224: .data -346, -207, 880, 892, 660, 611, -512
+L225: jsr L46
+L226: .data 520, -624, -562, -981, -924, 792
+lea L329, L320
+L227: .string "zlvzrrsiw"
+not r3
+jmp L266
+L228: .string "kzdujvcigkdgflaziugcjj"
+L229: .string "vmwqpmbkljudimmkux"
+L230: .string "rjknppaafqyyuqwuxxcknwp"
+L231: .data 615, -99
+L232: .string "wtnfyaaj"
+L233: clr r5
+dec *r1
+L234: .string "slszbkrazdvlcuccqzqz"
+lea L292, r2
+L235: .data 429, -371, -767, 132, -786
+jmp *r0
+bne L239
+dec L200
+L236: .data -953, 112, 497, -137, 188, 827, 48, -93
+L237: .data -243
+lea L85, L322
+L238: .data -377, 429
+stop
+L239: .string "xsahjyfonpeqlgaa"
+L240: .string "qqbfgnquk"
+jsr L242
+bne *r7
+L241: .string "xwkvubmkxry"
+L242: .data 426, -665, -518, 933, -338, 963, 197, -572
+L243: .string "warouhnlongzhogc"
+lea L327, L326
+L244: .data -556, 255, 795, 270, -488, -419, -767, 426
+L245: .data -853, -573
+L246: .data 167, -96, -116
+L247: .data -682
+L248: .data -153, 8, -975
+L249: .data -930, 586, -95
+L250: not r6
+L251: .data -152, 520
+L252: jsr L320
+L253: .data -685, -430, -559, -983
+L254: .data -395, 975, 831, 11, 72, 752
+prn *r1
+lea L314, L332
+L255: .string "uhqrdmizkffflsnairjgzh"
+L256: sub r1, r0
+L257: .data 395
+L258: .data -160, 803, -118, 336
+mov r7, L323
+L259: .data 825
+L260: .string "udzmjjmyacscudd"
+mov L117, r7
+jsr *r5
+L261: .data 512
+L262: .data -461, -90
+L263: .string "yhaukkyukvfzm"
+L264: .data -847, 596, 601, -591
+L265: .data -828, 489
+L266: .data 489, 77, -636
+lea L290, L275
+L267: .data -836
+L268: .string "pyfuettmgavkgehiznjsne"
+stop
+L269: .string "fsf"
+L270: .string "afcxoznqrofsyzhavibeybfn"
+stop
+bne L290
+L271: .string "xaezebxw"
+not L218
+jsr L316
+L272: sub L281, r0
+L273: .string "fabnzojszsmuc"
+sub r2, L290
+L274: .data 707, -957, 656
+dec *r6
+L275: .data -502, 176, 530, -816, -3, 629
+L276: .data 829, 71
+L277: dec L165
+L278: rts
+L279: .string "tfepxcovflzqerqmpgpg"
+L280: .data 110, 153, -194
+jmp L299
+jsr *r5
+jmp *r5
+rts
+L281: .data -909, -477, -113, 856, -21, -105, -803
+L282: .data -41, 584, 687, -306, 910, 303, -694
+L283: .string "ozmsygudjkiogmpqyrhkpcd"
+L284: .string "gsmjdgdwje"
+L285: .data -88, 656, 50, 794
+L286: mov *r1, *r2
+L287: .string "tspzlkty"
+L288: .string "kjvbjexhflgpnkap"
+L289: .data -954, 76, 972, -576
+; comment
+L290: red *r7
+L291: .data -33, 306, 456, -673, -510, -897
+L292: .data 987, -548
+cmp r5, *r0
+L293: .data 559, 916, -219, 404, -944, -664
+add #70, L247
+L294: .string "cyyfpgidcblfzldinxbmb"
+red L322
+dec *r4
+L295: .string "cwkbdkqwjmuwr"
+jmp L301
+
+bne L199
+L296: .string "jsjuif"
+L297: .string "drfumijatgmepkasbeigbl"
+L298: .string "keknkcw"
+L299: .string "tumuiduhd"
+L300: .data -936, 399
+L301: not *r3
+L302: .string "zixiejvmlorhqudmny"
+L303: .data -804, -441
+add r7, L117
+L304: .string "jqbsfthzghea"
+L305: inc r4
+L306: .string "sonjtajnayvdawlzrpo"
+add L46, *r4
+stop
+lea L250, L208
+L307: .string "aeprlzvaenwiisx"
+L308: .data -277, 202, 814, -334, -331, -982, -564
+
+L309: .string "cpqqtoghlpgvag"
+sub L313, r3
+L310: .string "xmofy"
+stop
+L311: rts
+
+L312: .string "cwlujhzyqonlq"
+L313: .data -371, -573, 799, -55, 588
+L314: .string "jebyoxnerjrycxbhh"
+L315: .data 684, 153, -211, 343, -642
+L316: .string "pppjfjiivmxobogeofcho"
+L317: .string "oso"
+L318: .string "bbpgsqzgyhyamxmfqzha"
+L319: .data 334, 138, -429
+L320: .string "masxd"
+stop
+L321: .data -513, -497, -330, -718, 100, 429, 211, -249
+L322: inc r3
+; comment
+L323: clr L334
+jsr *r0
+not L233
+mov r5, *r5
+L324: .data -288, 373, -849, 765, -406, -525, -123, -878
+stop
+L325: .string "qflesydbgwjzu"
+L326: .string "uzysyuja"
+red L332
+L327: .string "jnqzvdljyveh"
+L328: .data 911
+L329: cmp *r2, r7
+jmp *r5
+L330: .data 895, 662, -747
+stop
+L331: .data 240, 429
+L332: .string "ynu"
+bne L334
+L333: .data 688, 858, -799, -233, 12
+L334: red r0
+stop
@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 58
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+not L265
+L0: red L222
+sub L26, L254
+stop
+L1: .string "evykvanlhjsodifsgz"
+L2: .string "zpjkthuqv"
+inc r5
+L3: .string "xlthiy"
+L4: .string "fenhojgmvbindhtjjya"
+cmp *r4, #157
+dec *r6
+jsr *r2
+not r3
+L5: jsr L2
+L6: .string "pwvfii"
+L7: .string "zbnhsjdm"
+L8: .data 42, -206
+L9: .data 60, -221, 397, 131, 882, -103, -475
+L10: .string "njqlezijtciaoceujjnoe"
+L11: .data 732, 298, -417, 788, 702
+L12: .data 795, -891, -296, -497, -58, -956
+L13: .string "kiqvflchfvqffpi"
+L14: .data -706, 558, 350, -433
+L15: .string "atqzd"
+L16: .data -301, -619
+L17: .string "rainbofu"
+L18: .string "cjgvohbsnw"
+L19: .string "dypbcupthxjkkzacgovxh"
+jmp *r0
+L20: .string "gvq"
+cmp #207, L95
+L21: .string "sdoc"
+L22: .data -850
+jsr *r6
+
+L23: .string "swtsihijio"
+L24: .string "kzmiyoyzujio"
+L25: .string "xccaoyqnkxyfhjmzodxrutcw"
+sub #-10, *r6
+L26: .string "lzzkkzjljxfgetfkwr"
+not L185
+dec L14
+L27: .string "xltwrn"
+L28: .string "mwxcfnv"
+L29: .data 348, 457, -470, -827, 983
+jsr L72
+sub r3, *r6
+L30: .string "paaxeszm"
+cmp r7, #94
+L31: lea L13, *r6
+L32: .string "bnyjzzewqqu"
+dec *r0
+L33: .string "yymoenpoqxjzengfc"
+L34: stop
+L35: .data 444, -620, 990, -811
+L36: .data -538, -348
+L37: .data -400
+L38: .data -315, -300, 590, 590, 556, -109
+L39: .data 468, -980, 500, -600, 608, -717, 760, 110
+L40: .string "khfeickjsvjmckbzxu"
+L41: .string "wrwwmvr"
+L42: .data 706, 90, -106, 721, 565, 899, 755, 352
+red r1
+L43: .data 487
+L44: .string "xaawukcdnlvbm"
+
+L45: .string "okicwomawkhhsh"
+L46: .data -583
+L47: .data -369, -642, 438, -781, -828, 452, -458
+L48: .string "mbmebubi"
+L49: .data -569, -806, -887, -28, 733, -554, -973
+not L7
+L50: .data 804, -230, -92, 369
+L51: prn L82
+clr L96
+L52: .string "jwekizihczh"
+; comment
+lea L20, r7
+L53: .string "gtjypknptsqme"
+L54: .data -28, -855, 246, -536, -939
+L55: bne L40
+L56: red L26
+sub L297, L9
+L57: .string "vpyyopxirfjzewgndexhs"
+not *r2
+L58: sub L250, *r7
+L59: .data 320, 187, -429, 66, 674, -849, 518, 363
+jmp *r4
+jsr *r2
+jsr L24
+L60: .data 479, 147, 502, -234, -523
+L61: .string "vrk"
+red r0
+L62: mov r3, r1
+L63: .data 674, 287
+L64: .string "rvaffnmpzwbellwlxpqvmf"
+L65: .data -460, 779, 863, 660
+mov #-205, L108
+L66: .string "k"
+L67: .data 753
+L68: .data 684, -820, -850, -627, 516
+L69: .data -470
+L70: .string "xjlovrispdqfmbouvifroud"
+L71: .data 111, 981, -844, -773, 667
+L72: .data 170
+L73: .data 218, -613, -135, 977
+L74: .data 73, 726
+L75: .data 71, 973, -645, -46
+L76: .data 927, 413, 311, -910, -9, 418, -840, -565
+L77: .data 74, 329, 523, 272, 336, -262, -164
+L78: .string "auljosd"
+L79: .string "lmtokujlegymbfb"
+L80: .string "gpuphtkvgwkku"
+L81: .data -1, -370, -920, -154, -549, 624, -4
+L82: .data -863, -435, 954, -566, -453, -501, -267
+L83: .data 929, 866, -209, 137, 535
+L84: .data -840, -783
+L85: .data -305, -71, 96, 421, 145
+L86: dec *r2
+dec *r4
+L87: .string "obfhbmamjotav"
+L88: .data -291, 536, -218
+
+lea L177, *r6
+red L50
+L89: .string "arbhmztniqtbmngklcxv"
+L90: .data 865
+L91: .string "ookvsjbcmlbwk"
+jmp *r3
+L92: .data 961, -307, -191, -374, 181, -930, -747
+not r6
+clr *r3
+L93: .data 560, -631, 396, 702, -390, -154
+L94: .data 838, 369, 90, 229, -373, 539
+L95: .data 854, -91, 900, 991, 701, -802
+L96: .data 438, 12, 180, -955, 529, -778, -108, -376
+rts
+
+L97: .string "tvbsdxde"
+L98: .string "jvjboajvizrdmbapx"
+L99: .string "cjwkcvtpxr"
+L100: rts
+L101: .string "slqzfvrms"
+L102: .data -75, -226, -688
+L103: .data 368, 179, 444, -178, 642, -677
+L104: .string "pez"
+cmp L20, *r7
+L105: .data 2
+L106: .string "kiqerjgpnwbcsu"
+L107: .string "hpt"
+L108: .data 627, -653, -490, 811, 655, -97, 160, 527
+dec *r4
+stop
+cmp #46, L132
+L109: .data 455, 374, 415, -738, 361, 543, 392, 317
+L110: .string "hoctqzxtyqdwfwbl"
+L111: .data 402, 288
+L112: .string "rcpfifvtsuxastgte"
+prn r1
+L113: .string "eexnccronemc"
+cmp *r7, *r3
+L114: .data 189
+L115: .data 35, -605, 958, 788
+L116: .string "kmlxysbnuifmftzmtazayz"
+L117: jmp L14
+L118: .data -381, 2, -703, -45, -824
+L119: .string "eeevaqroosjtfmx"
+red *r3
+add *r0, r5
+L120: .data -169, -751, 227, 98, -943
+L121: .data 25, -130, -507, 904, -439
+L122: prn *r7
+add #43, r7
+L123: .string "fxgomqkteyqzslijvf"
+L124: .string "kcwrikuzyydfw"
+L125: .data 3
+L126: .data -527, 428, 75, 715, -898, -40, 519
+jsr L68
+; comment
+L127: .string "o"
+L128: .data 977, 698, 832
+L129: .string "ckplsbhdavgdfpjeyirs"
+bne *r7
+L130: .string "gqrlwmxtoxxvnvidjfqojzl"
+L131: .string "tmuginygn"
+sub r3, L44
+jmp *r2
+; comment
+bne *r6
+jmp L43
+L132: .data -532, -49
+inc L278
+L133: .string "g"
+L134: .data 597, 910
+L135: sub r4, *r0
+; comment
+clr *r7
+L136: .data -119
+prn L63
+clr L55
+L137: .string "b"
+L138: mov #-172, r2
+L139: add r2, L125
+L140: .data 139, -41, 930
+red r4
+L141: stop
+L142: .data 763, -526, 328, 827
+L143: .string "whkcejly"
+rts
+L144: .string "tvkkmnqqykrvcxjobqpnbplg"
+jsr *r1
+L145: .data -932, -343, -680, -982, -22, -768, 633
+dec *r5
+L146: .string "wsd"
+L147: .data 249, -72, -176, 10, 500, 391, 36
+L148: .data -13, -477, 798, -44, 227
+red r3
+clr *r7
+; comment
+rts
+L149: .string "x"
+jmp L40
+L150: .string "mrsvfhnjyg"
+L151: .string "ezcqytdreocvbpedfnkawg"
+L152: .data -503, -94
+L153: .data 256
+L154: .string "f"
+L155: .string "cktrgtx"
+L156: lea L306, r1
+not L308
+bne L300
+L157: .string "doemgfdiesqfeqfztbxfyw"
+red r1
+L158: .string "j"
+L159: prn *r1
+L160: .string "zopf"
+cmp L228, *r0
+L161: .data -107, -782, -459, -624, 116
+L162: .data -180, 922, -972
+L163: .string "uszyjpjspcetodqpb"
+L164: .string "yndpqrhiaqssripvs"
+add *r6, *r1
+
+L165: mov #-129, *r0
+L166: .data -732, -540, 124, -561, 372, -547, 864
+mov *r0, *r3
+L167: bne *r4
+L168: .data 756, 405, -884
+rts
+red *r1
+inc r7
+L169: .string "bhxivoisoixyg"
+L170: .data -925, 421, -734, -893, 518, -711, 920, -180
+jsr *r0
+L171: .data -917, -773, -674, 466, 867, -968
+dec L124
+L172: .data 633
+L173: stop
+L174: .string "spituqmofhgmikbljztxmfj"
+stop
+jsr L155
+red L34
+cmp r5, #-212
+clr *r2
+not *r5
+L175: jmp *r4
+L176: .data -930, -468, -333, -632, -467, -766, 970
+L177: .string "dbiuife"
+L178: .string "atixuiwtvfshmig"
+add r2, r4
+not *r7
+prn r7
+L179: .data 45, 54, 19, 973
+
+bne *r6
+red *r4
+L180: .string "efuczowpmntuechs"
+bne *r7
+L181: red L214
+
+L182: .string "kaffptrfvymimjay"
+; comment
+L183: .string "nmxhbwgzzzr"
+L184: .string "sb"
+L185: .data -198, 81, 627, -166, -748, 847, -298, 187
+add r0, *r2
+L186: .string "jmrwyjhtwtikiqyamwsl"
+L187: .string "veh"
+red r1
+lea L291, r5
+L188: .data 76, 170
+; comment
+L189: .string "cffqffovlbsk"
+; comment
+L190: jmp *r3
+dec r4
+L191: .data 345, -251, 130, 327, -873, -446, 26
+L192: .string "bszsvuxkgrcqoheh"
+L193: .string "lpychkrtz"
+L194: .data -376, -239, 651, 146, -157
+mov #7, r3
+L195: .data 18, -98, -368, 729, 772, -396
+L196: .data -799
+L197: .data -442, 458, 215, 810, 577, -634
+bne L136
+lea L152, *r4
+not *r6
+sub *r3, *r7
+L198: .string "qemyefoomqkhybevimkse"
+L199: .data 535, 152, 71, 671, 477, -580, -371
+rts
+L200: .string "ahamtmnvhfmarvgpwlbxi"
+L201: .data -896, 451, 173
+add #188, *r0
+jsr *r0
+not r7
+jmp L104
+L202: .string "juqlyclqxcxdszkmyd"
+L203: .string "xynrnaiehovdw"
+red r0
+stop
+L204: .data 948, 215, 910
+L205: .data -681, -932, -469, -446, 956, 31, -886
+L206: clr r6
+L207: .data -573, -721
+L208: .data -667, -383, 571, 969
+; comment
+L209: stop
+L210: .data -125
+L211: .string "cixlmljhfdlonoulfokgcg"
+L212: .string "vyshdqfqfpeztbnyyca"
+L213: .data -570, -562, -89, 465
+L214: .data 261
+; comment
+L215: .string "juubqkdjrbzyhn"
+L216: .string "ytfxmkargcfiggyryp"
+bne L189
+stop
+L217: .string "jfjtmepfadofcfnnao"
+sub *r6, L155
+L218: .data -797, 556, 693, 207, -305, -354, 724
+jmp L72
+cmp #59, *r6
+L219: .string "jxinzwhizwamhdyqbbbzzflf"
+jmp *r7
+L220: dec r6
+L221: rts
+L222: .string "zmnrtoslhxwsgiitzd"
+L223: .data 368, -31, 734
+add r5, r3
+bne *r0
+stop
+L224: .data 511, 504, 109, 609, -546, -631, 562, 317
+add L182, L249
+L225: prn L116
+jsr L312
+L226: dec L290
+L227: .data -14, -766, -102
+L228: .data 448, -24, 590, 98, -230, 933
+L229: .string "rbikzslmylod"
+L230: .data -428, -316, 650, 951, -112, -859
+L231: .data -761, 341, -39, -12, 71
+L232: .data 207, -332
+
+L233: .string "ilypfqtxg"
+L234: .string "kytkrnpmntwz"
+L235: not r6
+L236: inc L135
+L237: .string "soniqfxteapmlzuc"
+not *r4
+L238: .data 440, -250, 614, 31, -208
+L239: .data 529, 484, 776, 703, -295, -332, -645, -40
+jsr *r5
+L240: .string "sfutgykwbymrzg"
+prn *r5
+dec r1
+L241: .data -315, -517, -453, 707
+not *r1
+L242: .data 389, -109, -362, -294, -427, -496
+L243: .string "sujucimvgtnugpyvfbbyztf"
+L244: .data 279
+sub r1, r3
+L245: .string "obvnpxvrwdbet"
+L246: .data 955, -119, -215, -476, -556, 737, 329
+bne L249
+L247: .string "etxsmtxoukvrord"
+L248: .string "dmuxinzpa"
+L249: .string "n"
+jsr *r7
+L250: .data 668, -593, -915, 838, 665, 777, 463
+bne L60
+L251: .string "pbjzrt"
+L252: .string "uftsd"
+lea L279, L296
+L253: .data 931, -818, -816
+sub L192, *r7
+; comment
+dec *r0
+mov L272, *r0
+L254: .string "iu"
+L255: .string "bspk"
+L256: .string "jyk"
+L257: clr *r2
+clr *r0
+L258: .data -847, 386, 21, -659, -5, -922, -329
+L259: stop
+stop
+L260: .data 27, -84, -835, -265, 994, -771
+L261: .string "qusliuiltfme"
+
+stop
+L262: .string "qdeljwxzhecwyaaf"
+dec r2
+L263: bne *r0
+inc *r3
+not r3
+L264: .data 875, -858, 940, -885, 756, -91, 805, -168
+L265: lea L299, *r6
+L266: .data 933, 437
+red L300
+L267: .string "qnrlawgxtxjeqbssgtvf"
+red r7
+L268: .data 177, -161, -230
+L269: .string "xvsgblxruvdgpisxqmwrlqud"
+L270: .data -484
+jmp L13
+rts
+L271: .string "fwcggsxvqwzxgfx"
+L272: .string "jxhuzfwp"
+L273: .string "hwgai"
+L274: .string "ytbjububrbluykufjlendc"
+
+L275: .data -256, -70, 277, 546, 88, -676
+L276: .data 252, -521, -442, -534
+L277: .string "xqoiyxwgm"
+jsr *r1
+L278: .data 962, 892, -513, 47, 754
+L279: .data 234, 386, -599, 145
+jmp *r2
+stop
+stop
+inc r6
+L280: .string "filxdoxz"
+L281: .string "erchlujbqjcbdifje"
+jmp L313
+L282: .string "zrtfmfudnaewfcxobwf"
+L283: red r2
+L284: .data 774, 915, -298, 656, -754
+L285: .string "kiqfiudaoy"
+lea L3, L304
+dec *r2
+
+L286: bne *r0
+L287: .string "bnxgvolbrsakjbwepwbei"
+L288: .data -388, 953, -713, -122, 663
+prn *r4
+; comment
+L289: .data 741, -983, 165, -870, -35, 270, 51
+cmp #-126, *r0
+inc r7
+L290: .data -1, -451, 572, 561, 548, 661, -452, 198
+lea L286, r1
+dec L33
+L291: .string "cck"
+L292: .data -754, 992, -168
+jsr *r7
+L293: .data -147, 192, -99, 69
+L294: red *r1
+stop
+L295: .string "pkhhtyvtiz"
+L296: .data -894, 880, 118, 221, -114, 962, 795, 947
+L297: sub #15, L89
+L298: .string "mgrenqwplpzxorxtgz"
+L299: .string "eezsguftapb"
+jmp L165
+jsr L137
+L300: .string "kjyzcvdbosyr"
+jmp *r3
+L301: .string "subfplpbtb"
+L302: .string "qjrigtj"
+sub *r5, L310
+bne L309
+bne *r0
+red L128
+
+L303: .string "jlqynn"
+L304: .string "wqbfqdszzrzqukkpkjcgodf"
+prn L46
+L305: .data -66, 346, -107
+rts
+L306: .string "qvqxcvorzehtke"
+L307: .string "gp"
+L308: dec *r6
+L309: .string "mqyhmzxifxwlcbs"
+prn L310
+L310: .string "qaultejksavbkkobxznblh"
+L311: .string "yppbxlkgzysl"
+L312: .string "mpotxe"
+L313: not *r2
+jmp *r2
+stop
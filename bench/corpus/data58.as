@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 59
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: add L333, r3
+L1: bne L104
+L2: .data -665, -578, 449
+jmp *r1
+L3: .data -165, -8, 894, 203, 648, -334, -360
+L4: .data 781, 716, 118, -596, 613, 786, 362
+sub *r2, r7
+cmp L148, L3
+L5: .data -579, 962, -93, -269
+L6: .data 785, 647
+L7: .data 660, -755, -719
+L8: .data -929, -533, 386, -80, 668
+L9: mov *r6, *r7
+sub r5, *r6
+dec *r5
+cmp r3, r3
+L10: .string "opvfrgbtppyjuecfxga"
+cmp r6, *r1
+L11: .string "swnoskpenlniarub"
+L12: .string "hgwkhzlajpks"
+add *r3, L6
+L13: .data 252, -788, 58, -491, 212, 21, -55
+L14: jmp *r0
+L15: .data -235, 99, -434
+L16: .data -697, -598, 26, 1, 825, -444
+stop
+; comment
+
+L17: .string "jdpcunypcsnxqt"
+L18: .string "bdag"
+L19: .data -194, -905
+jsr *r4
+L20: .data -365, -880
+L21: .string "rrfemihdjc"
+L22: .string "d"
+L23: .data -389, 993, -33, -288, 661
+L24: .string "wggyeciryypgfgrcvbfocy"
+L25: .string "koztio"
+L26: add r3, r5
+L27: .string "dwkfmkyi"
+L28: .data -579, 783, -606, 305
+; comment
+lea L17, *r6
+inc L263
+L29: .string "reeqbvgxrzrbj"
+sub L209, L19
+L30: .data 488, 371
+
+L31: .data -318, 587, -32, -96, -101
+bne L125
+L32: .data 897, -750, 191, 985, 26, 51, -563, -99
+L33: .string "t"
+L34: cmp *r0, L4
+jsr *r6
+L35: .data -926, -349, 465, 242, -857, 737, 160
+not r2
+L36: rts
+jsr *r4
+dec r2
+clr *r2
+L37: .data -81, -500, -313, -264, 749, -539
+mov *r3, *r0
+sub L22, r7
+L38: .string "trtyntccqxntegptngcvir"
+L39: .data -572, 2, -417
+L40: .data 431, 377, 903, 932, -776, 963, 80, 180
+L41: .data 201, 311, -781, -118, 512, 160, -230
+L42: .string "najkbikqrzjrytbbrjaaxuka"
+L43: .string "vfufgrgkozfyocydnqq"
+stop
+L44: .data -440
+L45: .data 9, -909, -147, -560, -77, -625, -628, 927
+rts
+L46: .string "dxlxdkaknqxryb"
+L47: .data -326, -221, 526, -967, 833, -831, 105, -241
+dec L210
+L48: .data 707, -868, -938, 925, 727, 162, -26
+L49: .data -969, -244, -266, 772, 663, 943
+L50: .string "dwubcgtpzyanhqspnvovzcmr"
+inc *r6
+L51: .string "goyqrpasws"
+L52: .data -31, 902, -497, -613, 103, 533, 294
+L53: .data 111, -449
+L54: .string "puw"
+L55: .data -30, 760, 115, -21
+L56: .data -371, -982, -646
+L57: .data -533, -789, -355
+L58: red L29
+L59: .string "fpbmzbcvdjwnwnrlycojuem"
+L60: .string "lizebmtvqayj"
+L61: .string "xbngxkpahhnflap"
+L62: .data 975, 236
+L63: lea L26, *r1
+inc r7
+mov r4, *r4
+L64: .data -367, 213, -50
+L65: .string "oqaiqbblilhxxlwz"
+L66: .data 958, 889, 790, 156, -473
+L67: .data -102, -945, 317, -425
+L68: .string "r"
+L69: .string "ugnmgkdlmrdkv"
+rts
+L70: rts
+L71: .string "ue"
+L72: .data 299, -102, 171, 268
+L73: .string "wszacfqbfsldgha"
+
+bne L20
+L74: .string "mozzaoqlbzpryspkxjbpuy"
+L75: .data 998, 81, 29, 530, -604, -232, -295, 547
+sub L126, r6
+jsr L31
+mov L274, L10
+inc r2
+L76: .string "wxhtscuhpolhaz"
+L77: .data 888, -555, 357, -805, -24
+L78: .data -895, -535
+prn L125
+L79: .string "zhdovwbrpacccyzlqdqpv"
+L80: .string "kpjqhrasrbim"
+lea L325, *r7
+L81: .string "cbwhysw"
+bne *r2
+L82: .data -697, 760, 81, -344
+rts
+; comment
+prn r4
+L83: lea L170, *r7
+L84: .string "tgxicngysvfngn"
+L85: .data 333, -684, 790
+cmp r0, #-184
+L86: .data 384, 271, -431, -456, -197, 517
+L87: red r7
+mov #62, r1
+not *r4
+cmp *r4, *r5
+L88: .data -892, -676, -982, 480, -810, -641, -146
+jsr *r3
+L89: .string "cgzrefsymch"
+stop
+L90: .data -660, 784, -679, 402
+L91: .data -102
+L92: .string "sepxslixxaahh"
+L93: .string "ibvdawrnkcnhnsk"
+prn #-143
+L94: clr r6
+L95: .data 705, -70, -370, 893, -855, 935
+jmp L302
+L96: .data 73, -898, 341, 642
+
+L97: .string "idxgmce"
+L98: .string "qoyunvjszkytxdvmott"
+L99: .string "qk"
+L100: .string "itcv"
+bne L21
+L101: .data 138
+rts
+L102: .string "cgnhv"
+L103: .string "hufzjlhcm"
+L104: .string "xkzitoewelhrccavnnzl"
+L105: .string "pdarfecluu"
+L106: .string "hzsxs"
+L107: .data 792
+stop
+L108: .data -821, 99, -109
+L109: bne L207
+L110: .string "csrirecqwpahtdqee"
+L111: .string "nwhvxsdagfzjiznov"
+jmp *r6
+L112: .string "jlgyvmbfduygeg"
+jmp L68
+L113: .data 635, -579, -867, 628
+red L166
+sub #-216, r5
+L114: .string "ziz"
+L115: .string "nksazewkpvkekmgvcqufgjkb"
+sub #-244, *r7
+add *r3, L6
+L116: prn L201
+L117: .string "pgxmrneyrkhyngikqubwjf"
+cmp *r0, L254
+L118: .data -410, -613, 474, -449, 273, -253, -80
+L119: .data -644, -520, 24, 495, 400, -28, 358, -975
+L120: .data -304, -877, 49, -328, -102, 342, -407, 231
+L121: .string "edbtiinmmyxl"
+cmp #-207, *r5
+L122: .string "rebuihgibjkhf"
+L123: .string "aruktt"
+mov #-256, r3
+L124: .data 702, -193, 481, -995, 813
+red r3
+; comment
+cmp #220, L87
+lea L23, *r6
+L125: .string "mwyqtrle"
+prn *r5
+lea L272, r5
+L126: .data 680, -936
+L127: jsr L116
+L128: .data -214, -293, -219, 236, -920, -48, 46
+L129: .data 664
+L130: .string "jwjncyzdhnyqyeomzcssa"
+
+L131: .string "ldedolumglagtqfycwf"
+L132: .data -168, -142, -559, 160, 22
+L133: .data 272, -803, 536
+jsr L21
+L134: .string "edfkzcbrscztc"
+L135: .string "jgwyhfcwsdlsxnpnvvyyqhss"
+inc *r0
+stop
+L136: .data -514, -392, 22, -20, -389, -469
+L137: .string "gcz"
+L138: .data 949
+L139: .data 424, 0, -534, 583, 691, 511
+L140: .string "jwwbxxyveeqpupgghapdwg"
+L141: .data 198, 974, 36, 422
+L142: jmp *r1
+L143: not L290
+L144: .string "mzuvpnpotl"
+
+L145: .string "rbjrggwngstm"
+L146: .string "myakntbajhudwvuorf"
+L147: .data -809, -178, 803, 123, 833, 821, -98, 274
+
+L148: .data -266
+sub #-86, *r5
+L149: .string "rdjszj"
+L150: .string "zinf"
+mov L233, r0
+not L76
+L151: .string "btvmpivkytjfhvgooqb"
+L152: .data -657, -272, -194, -361, 657, -183
+L153: .data 678, -647, 577, 698
+; comment
+L154: .string "jlmzu"
+clr r7
+L155: .string "sxucncvbaoftaof"
+L156: .string "abhjzsvjfv"
+L157: stop
+prn L137
+L158: .data -826, -585, 36, 440
+L159: .data 26, 505, 382, -577
+L160: .string "abzkyhnqaezxrsialxkakm"
+L161: .string "kocjyszoapcmtebwgym"
+cmp #-145, L132
+L162: .string "n"
+L163: .string "aux"
+L164: .string "erfapkewjzspojuylkq"
+L165: .string "srsyzohatu"
+L166: not L69
+L167: .data -986, -197, -233, 661, 473, -72, -262
+L168: .data -909, 820, -138, 890
+L169: .data -101
+L170: .string "gednkgkcwyoolow"
+L171: .string "myhtfdtjqyf"
+jmp *r4
+L172: .data -176, 646, 389, -241, -763, 140, 373, -957
+L173: .string "ovdccitlwf"
+prn *r2
+L174: .data -444, -772, -59, 743, -938, -496
+L175: .data -503, 186, 391, 187, 911, -150, -99
+L176: .string "gusryostf"
+L177: .data 844, -105, -677, -492
+inc *r6
+L178: .data -631, -856, -719, -517, 100, -118, -430, -451
+L179: clr L116
+jmp L191
+L180: .data -959, 807, 669, 373, -209
+L181: .data -28
+mov #151, *r6
+L182: .string "thgzyw"
+L183: .string "vtichvwomtowt"
+L184: .string "lsiopkkwtiygmgfkyxrynwyf"
+L185: .data 714, -504, 720, -76, -50, -24
+L186: .data -156, 963, 661, -131, 772
+L187: .data 639, 12, 106, 680
+L188: .string "kawasrymlhuu"
+; comment
+inc *r2
+; comment
+L189: .string "vvwhpdaeldqxcilq"
+mov *r6, *r0
+L190: .data 720, 67, 236, -827
+L191: .string "gbwevqzcmtzbdzce"
+L192: .string "nyvtnskcszvbgctqccqtrdk"
+L193: .string "vabof"
+L194: .data -898, -440, 932, -215, -98, 832
+L195: .data 663, 914, 322, -787, -100, -739, -922, 29
+L196: .data 350, -393, -530, -862, 222, 115, -842
+L197: .data 918, -268, 86, -753, 109, 925
+L198: not *r0
+jsr L58
+L199: .string "ypckqtrgiad"
+L200: .data -934, 24, 810, -419, 823
+L201: .data 628, -268
+L202: prn #42
+L203: .data -281, 497, 334, 182, 40, 583, 722
+L204: .data -972, -697, 296, -351, -203, -50, 567, 280
+L205: .data 541, -934, -323
+L206: .data 913, -754, 787, 483, 104, -846, 782, 382
+L207: not L120
+L208: .string "ljwzkxfokcoc"
+L209: .string "ffkcjn"
+L210: .string "mnfrdviricwikqglz"
+L211: .string "htfmv"
+L212: .data 192, -672
+mov r0, r1
+L213: .data 8, 320, -88, 162
+L214: .string "qashxxzlnajeaeavjxkiy"
+sub *r1, *r0
+L215: .data -397, -419, 862
+L216: .data -823, 885, -671, -501, -430
+L217: .data -146
+L218: .string "eqzcwjoywcahdihdxf"
+red *r0
+L219: .data 468
+L220: .data 178, 908, 351, 45, -440
+L221: .data 556, -877, -186, -625, 575, -979, -59, 10
+stop
+L222: .string "ffoaf"
+sub L202, L131
+L223: .data 128, -397
+dec *r6
+L224: .data 966, 568, 108
+clr r0
+L225: .data -835, -123, 727, -322, -280, -63, -339, -93
+L226: bne *r0
+not *r2
+L227: .data 727
+L228: .string "mv"
+
+lea L259, r5
+L229: rts
+L230: .string "rkebwhruszfiibghuooz"
+L231: .data -732, 825, -355, 970, -227, 231
+jmp *r0
+L232: .data -700, -781, -959, 24, 891, -683, 786
+L233: inc *r6
+inc *r1
+L234: .data -981
+L235: .string "cl"
+sub *r4, *r3
+L236: mov #233, L34
+L237: .data 344, -674, -642
+L238: .data -823
+
+L239: .string "qkvqmfjkxza"
+L240: .data -89, -715, -633, 502, 467
+L241: .data -250, 440, -415, 144, 568
+L242: .string "uaza"
+L243: add #-173, *r0
+L244: .string "oef"
+L245: .string "zcwcyktuehasifukmbpbnbi"
+L246: .data -517, 343, -826, 608, 396, 479, 353
+L247: .string "nievqumhcmfraft"
+L248: .string "qzhjayrbnvblrwzdlelheut"
+L249: .string "kavp"
+sub #-173, r0
+L250: .string "wscqryigtajlto"
+prn *r0
+L251: .data -332
+L252: .data 19, 715
+clr L184
+
+L253: sub *r1, L114
+L254: .data 703, 527, 465, 853, 257
+L255: .data -426, 806, 575, -520, 274
+mov r4, *r4
+mov L227, *r6
+L256: .data 6, -584, -739, 497, 497, 922, 714
+L257: .string "cejullpsliosakzzg"
+L258: .data 514, 439, 595, 737, 293, -752, -538, 180
+mov r7, r0
+sub r1, L1
+stop
+L259: .data -584, -483
+L260: .data -376, -878, 154, 758, -21, -463, -252
+L261: .string "bpvmwfvsrzizbrrfoq"
+not *r4
+L262: .string "hfdstlrgfidtzfegsfp"
+
+clr *r4
+; comment
+L263: .data -535, -681, 572
+L264: .string "ujsbooszldo"
+stop
+L265: .data 570, 238, 61
+L266: .data 455, -648, 969, 195, 911, -311, -813, 684
+L267: prn #-201
+bne *r1
+L268: .data 598, -875, -278, -76, -790, -824, -143
+
+L269: dec *r5
+L270: .data -686, -555, 721
+L271: rts
+L272: .data -624, 668, 814, 734
+L273: .data 109, 426, -808, -801
+mov L136, L162
+not r2
+stop
+red L108
+dec L329
+L274: .data 169, -801, -504, -393
+L275: red r6
+L276: .data 905, -467, -22
+L277: .string "ydoswfuk"
+rts
+L278: .string "x"
+mov *r1, L49
+L279: .data 45, 657, 813, -983, 719, 976
+sub L10, *r4
+L280: .string "lhtrvmppsuncxczwyd"
+mov r3, r5
+L281: .data 901, 708, -351, 338, 613, 552, -825, 337
+L282: .string "txc"
+L283: .string "ebl"
+L284: .string "qvzqivtrvrmixu"
+L285: rts
+inc *r1
+
+L286: .string "czljo"
+; comment
+clr r1
+L287: .string "qhjhhdqrayrmzvoalximvg"
+L288: .data 29, -692, 291, -911, 134, -835, -565, -926
+L289: .data 673, 654, -837, -493
+L290: .data 467, 446, 822, -71, -60, 781, -715
+L291: .string "yvhccotxnljrwhsjt"
+sub r1, *r3
+L292: .data 197, -776, 590, 650, 998, 273
+L293: .data -51, 210, -342, -878, -725, 148, 887
+clr r1
+L294: .data 685, -638, 279, -473, 491, -157
+dec L333
+mov r3, r2
+L295: .data -780, -691, -137, -898
+L296: .data -283, 197, -184, -243, -310, -156, -720
+L297: .data -62, 482, -482, -926, -866, -68
+; comment
+mov #43, L84
+clr r5
+clr L54
+L298: .data 99, -472, -196, 947
+dec r2
+L299: .string "ly"
+L300: .data 707, -668, 979, -14, 238
+red r4
+; comment
+; comment
+L301: .string "behpczslxvjwepgiqzdvqrg"
+L302: red r2
+mov L13, r4
+L303: .string "qwolpnctieuqcg"
+L304: jmp L158
+L305: .data 224
+; comment
+L306: .string "to"
+L307: .string "rnxexmjuoe"
+L308: .data -459, 812, 445, 521, -161, 978
+dec *r7
+L309: .data -841, 442, -383
+L310: .data -873, 510, 481, -560, 416
+lea L187, r1
+add *r0, L314
+L311: .data 700, 281, 630, -687, -333, -853, 981
+clr *r7
+L312: .data 642, -667, 85
+rts
+L313: red L160
+L314: .data 646, -773, 763, 299
+L315: .string "qjsg"
+L316: dec *r0
+cmp L239, L327
+L317: .string "tdjwmdepwavmpp"
+jmp *r6
+L318: .string "lbxatjirbwvkk"
+L319: .string "zzohuovmhdqthpmdhntb"
+L320: .string "vahcqvxitxl"
+L321: .data 407, -765, 384, -559, 922
+jmp *r3
+L322: .string "emwmy"
+L323: .data 292, 928, -911, 13, 63, -543
+bne L333
+L324: dec L331
+add *r2, *r6
+L325: .string "xlhhxbznfzxpaztv"
+L326: .data 655, -264, 966, -628, -275
+L327: .string "ccposmo"
+L328: .data 356
+L329: lea L207, *r6
+L330: .string "zkpdmkmwchxpwnnlq"
+L331: .string "qnmfiscdevqcvrdrokbhctld"
+L332: .data -535, -411
+L333: mov L147, L334
+lea L86, r3
+L334: .data 453, 973, -539, 467, -304, -354
+; comment
+clr *r7
+lea L323, *r7
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 60
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .data 67, -595, 330
+L1: .string "gysyesxczuwdtxzhn"
+cmp r6, L272
+L2: .data -302, 284
+L3: prn L2
+L4: .string "fikwsczkaccgzqtv"
+clr *r5
+L5: .string "zrkldkj"
+dec r0
+L6: clr *r7
+bne L184
+L7: .data 622, -453, -356, 767, 718, -821, -943
+L8: .string "n"
+L9: stop
+L10: .string "lpnodiflvjihucbb"
+add L10, L27
+L11: .string "zrdikgadwzzrkop"
+L12: .data -574
+stop
+not L7
+L13: .string "xisjhartrxhpkmpucpnflfo"
+L14: .string "cipuqvkhielallkgjpxlwkvj"
+L15: .data 951, 345, 459, -136, 791, 325
+clr *r4
+L16: .string "n"
+L17: .data 37, 103, 199, 593, 143, -384, -664, 301
+L18: add #132, r7
+L19: .data 994, 677, -625, -217
+L20: .string "teikvklirnlrhkczslnvgv"
+inc r6
+L21: .string "atblxacthvudjezkgim"
+L22: .string "ebpmitiauxvduy"
+L23: .string "okpbuoqdinxynnjoqj"
+; comment
+L24: .string "ykvheyolox"
+not *r4
+jmp *r1
+L25: .string "uodddnwrirrpznzodkj"
+L26: .data 80, -729, 955, -463, -346, -406, -228
+dec L7
+L27: .string "jdbg"
+
+L28: .string "sgznz"
+L29: .data 942
+clr r1
+jsr *r3
+
+; comment
+L30: .string "giavxiwhyfvnjdabezab"
+lea L2, *r3
+L31: .data -511, 843, -57, -794
+mov r6, r1
+mov *r6, *r2
+L32: .string "utdg"
+jsr *r2
+L33: .string "cjzpfl"
+lea L183, L188
+
+L34: .string "cfmmnjcgpnakt"
+mov r3, r1
+L35: .data 361, 226, 14, -577, -865
+L36: .string "ofgowtedyrcq"
+L37: .string "uzbbjyxtivvjgynzbwajp"
+L38: clr L220
+lea L290, *r3
+L39: .data -665, 474
+add #-47, r1
+L40: .data 372, -189, -25, -377, 847, -521
+; comment
+dec L117
+L41: .string "gjlexmdkfvqqnu"
+jmp L11
+L42: .string "aldarwgcgtxqkvcfnpm"
+L43: dec r5
+L44: .string "alqvxqeshyczotusvf"
+L45: .data 183, -836, 995, -10, -626, 201
+L46: .string "vkeiecdjwvafr"
+; comment
+rts
+L47: .string "nqwaea"
+L48: .string "vmywpdaxlqculjloryc"
+L49: .string "udzxlh"
+L50: .data -107, -395, -859
+L51: .string "updzfqeg"
+rts
+lea L15, *r5
+
+L52: .data 542, 565, -754
+L53: .string "lxlhizdjgaomjfbxoebwk"
+L54: .string "fdqotawsymogvelt"
+mov *r7, L318
+L55: .data -88, 971
+L56: .data -236, -914, -379, -571, -740
+L57: .string "cjaekmotf"
+L58: .data 177, 331, 517, -27, 964, 970
+L59: .data 687, -789, 736, -638, 952, 468
+L60: .string "kdifie"
+lea L37, r4
+L61: .string "ohmoyyhylcohqt"
+L62: .data -922, -36, 455, 752
+jmp *r3
+L63: .string "shafmi"
+jmp *r0
+mov *r0, r7
+; comment
+clr *r1
+dec L227
+L64: .string "lubkcfgjoisnkyurhqwfids"
+L65: .string "uph"
+L66: .string "qlarsstphdziidlajgv"
+L67: .data 875, -811, -892, -130, 792
+L68: .string "fsqxh"
+jmp L1
+L69: .string "fpceqauovfncdggp"
+add L15, r7
+L70: .data 996, -117, 112, 377, 126, 765, 54
+L71: sub L71, L225
+L72: .string "whadorrwwsygjsvwdcndtad"
+L73: sub L280, *r7
+L74: .string "mbkrdeuijmklilqosuelbp"
+L75: .data -221, -853, -441, 719, 984
+L76: .string "ndcjwsimo"
+clr L257
+lea L20, L155
+L77: .data -751, -599, 672, 90, 20, 734
+mov L3, L28
+L78: .data -383
+L79: rts
+jsr L68
+L80: .string "tgylfnr"
+L81: .string "tozopexsazkqguwytkuqxhwn"
+L82: .data -989, 878, -93
+inc *r7
+clr r5
+dec *r5
+L83: jmp L213
+L84: .string "sxescqlqhuzei"
+L85: .string "wqbzdngzuxwbfnwqm"
+L86: .data 369, -953, 94, 213, 543, 954, -274
+L87: .string "hqnzuatdrzdgmkfvduii"
+L88: .string "pqasjarfghplqd"
+L89: .data 433, -368, -100, -965, -921
+L90: .data -711, 524, 937
+L91: .data 499, -60, 82, 424, -584, -541, 41
+L92: jsr L307
+red r1
+inc r3
+L93: red r3
+L94: .string "ds"
+L95: .data 918, 362, 498
+stop
+add #156, r7
+L96: .string "dkgktiasxrprpmc"
+L97: inc r1
+cmp *r5, #242
+L98: .data 476, 578, 807, 929
+L99: .data 650, 936, -220, 361, 261, -121, -386, 266
+L100: .data 948, -45
+; comment
+L101: .data -477
+rts
+lea L189, r5
+L102: .string "tcqsiihpzhtznxpzdklol"
+lea L77, r4
+L103: .string "aesvvjsfzjyazkyaiayk"
+L104: .data -296, 819, 313, 671, 356, -464, 375, -912
+stop
+L105: .data -973, 974
+L106: .string "rcrytsbjgadebbwp"
+L107: .string "gxmsbnyzmwdxprsjg"
+cmp r6, L269
+L108: .string "htdcmvntguujsrmstqki"
+L109: .string "ktjefue"
+L110: .data -28, 988, -167, 432, 248, -699, 865
+L111: .string "obyo"
+L112: .data -382, 93, -148, -264, -497, -952, 166
+L113: .data 389, 958, 863, -287, 924, -848, 690
+L114: .data 134, -735, 128, -20, -517
+L115: mov L265, r3
+dec r1
+; comment
+
+L116: .data -72
+cmp #212, *r7
+L117: .data 370, 172, -609, 518, 348
+L118: .string "uszudlybgtcbisvztvva"
+not L22
+L119: .string "owvwicbjrtrk"
+jsr L95
+L120: .data 749, 875, 878, -169, 75, 794
+L121: jsr *r7
+L122: .string "ufguvsjlkcvrzuezjtjggxm"
+L123: .data -541
+L124: .data -818, 936, 730, 663
+L125: .string "pzyyuihdteixukoxfchgwpoy"
+dec L211
+L126: .data -13, 830, -477
+L127: .data 164, 55, 180, 597, -134
+L128: .data -587, 157, -585, -508, -848, 443
+rts
+stop
+L129: .string "ahjqyavcjqqmvnkch"
+L130: .string "iibefmgvxcqajuoqhaeq"
+; comment
+L131: .string "bvyvbclbgcsmdmoxi"
+stop
+mov L258, r2
+L132: .string "wy"
+L133: .data 987, 296, 253, 510, 668, -228, -716
+L134: .string "tqpgsd"
+jmp *r4
+L135: .data -245, 411, 716
+L136: .data -561, 239, -829, 987, 269, 338, -769, 829
+rts
+dec L132
+sub #-223, L215
+L137: .string "zgmjoukgwuwmsckyecwre"
+L138: .string "xiibsblgxrpmqq"
+L139: .string "udoezsemwtzhfihrqrru"
+prn #-106
+L140: .data -442, -734, 193, 799, 160, -427, 98
+L141: .string "oyzyxkeeiptch"
+L142: .string "enfryfu"
+L143: .data 28, 672
+L144: .string "niyqqkjschlkxkmscd"
+L145: .string "hgkrmdxqsrakkbkvub"
+L146: .data 775
+L147: .string "bge"
+L148: .data -112, 627, -663, 177, -838, 520, -683, -769
+L149: rts
+prn *r3
+L150: .string "qatjypys"
+L151: .data -566, 364, -302, -863
+; comment
+dec *r3
+jmp *r5
+L152: .data 730
+L153: .data -909
+
+L154: .data 640, 658, -821, 71, 131, 116, 250
+L155: .string "skjuaznzkeiblghwfr"
+not *r7
+L156: add #-154, L187
+L157: .data 254, 689, 602, -232, -959
+L158: .data 762
+L159: .string "ojualb"
+; comment
+L160: .string "fxdza"
+L161: .data 686, 51, 752, -492, -202, -599, 794
+jmp L297
+cmp L209, #161
+L162: jmp L285
+L163: .data -439, -266
+L164: .data 852, -834, -75, -171, 49, 849, -169
+jmp L313
+rts
+
+L165: .data 827
+L166: .data -580
+L167: .data -15, 823
+L168: .data -724, 571, -14, 608, 90, 115, 62, 502
+jmp *r5
+cmp *r4, L230
+L169: .data -227, -504
+L170: .data -686, -897, 185, -755, 997, 643, 820
+L171: .string "kj"
+L172: .string "cpytoyburjbghygbq"
+L173: .data 427, -133, 364, 458, -639, 25, -719, 46
+L174: .data -739, -50, -35, -629, -866, -481, -762, -440
+; comment
+L175: .string "wppbnnfnuj"
+add r7, *r7
+L176: cmp #219, L198
+L177: .string "zqczk"
+L178: .string "ticeyyukdfpvqigluibybhfu"
+jmp *r7
+L179: .data -489, 594, 604
+L180: .string "vgaopymzbzlrfndjube"
+L181: .data 184, 531, 791
+red *r0
+L182: .string "fhzgfeulukwiiojnkxahexz"
+L183: .data -48, -406, -95, 676, 733
+L184: clr L91
+L185: .data -787, 700, -758
+bne L171
+L186: .string "jelaqeqoszzvmixrhjqy"
+L187: .string "xohnnhe"
+dec r3
+L188: .data -738, 405, -858, -323, -344, 766
+lea L113, L83
+L189: .data -645, -337, 611, 486, -918
+jsr L161
+L190: .string "dlvhdu"
+L191: .string "dwyducpzesbwpxqzdldgzcg"
+L192: .string "buasvjtqkoq"
+sub L17, r5
+L193: .string "htcoydtzavgpu"
+L194: .data 326, -405, -534, -581
+L195: .string "bc"
+L196: .data -56, -372, 170, -892, 274, 93, 275
+L197: .data -372, 200, -822, 618, -741
+red *r3
+clr r1
+L198: .data 693
+L199: .data 568, 259, 595, -167, -760, 23
+L200: .string "dqqucnozswmk"
+bne L268
+clr *r3
+prn *r1
+L201: .data -781, -402, 663, 771, -601, 438, -793
+cmp *r2, *r3
+L202: .data 460
+L203: .data -44, 884, 170, -768, -856, -232, -907
+L204: .string "ipx"
+L205: .data -58, 919, -758, -641, 810, 729, -475
+L206: .data -787, -477, -279, 413, 533
+L207: .string "hfhfz"
+dec L78
+L208: .string "ijwynetd"
+L209: .string "gaaahobjpwlzkpeaycuduudq"
+
+L210: .data 859, -942, -53, -46, -594, -194, -238
+L211: .data -706
+L212: .string "lqnzekitsbjgdsfyqnxq"
+L213: .string "toeihaarepa"
+jmp L61
+L214: .data 343, -497, 476, 99, -71, 514, 13, 410
+L215: .data 728, -574, -905, -465, -856, 473
+L216: .data -338, -295, -961, 578, 401
+L217: .string "jbhiaklygfwggqepzdkeskk"
+inc L298
+stop
+L218: not L249
+L219: .data 756, 355, 340, -556, 261, -151, 555, 937
+L220: .data 886, -703, -389, 943, -104
+L221: .string "pienszdtc"
+L222: rts
+L223: add L283, *r0
+; comment
+L224: .string "visnvgxxhhn"
+L225: .string "lsubl"
+L226: .data 270
+L227: .string "bmc"
+L228: .string "tougloovndkkv"
+L229: .data -295, 757, -447, -40
+L230: rts
+mov L295, *r7
+mov r0, *r5
+L231: bne L328
+L232: .string "ixdibbsjiwdwbgog"
+L233: .data -25, -118, 508
+jmp L53
+add L47, r2
+L234: .string "d"
+L235: .data 236, -406, 613, 667
+L236: .string "ijuiyrwqiehisjkh"
+L237: .string "gaales"
+jmp L270
+L238: .string "cktcmvsgjtqpnztw"
+L239: .data 723, 622, -131, -442, -701, 786, -300
+jsr *r5
+L240: .data -230, 524, 156, -58
+bne *r6
+L241: .data 516, 665, -395, 494
+L242: .string "lcotureetfhfrhvyjeby"
+L243: .data 186, 349, -437
+L244: mov *r3, *r4
+L245: inc L225
+L246: .data 365, -353, -362
+jmp *r5
+L247: .string "oet"
+L248: .data 74
+red *r4
+clr L56
+L249: .string "ewmadixf"
+L250: .string "bss"
+L251: .string "jtpzrthxljynpuxlp"
+L252: .string "hbvcyyseyfbjwyiitkvtkvsb"
+L253: .string "xvfsqifquqarbu"
+L254: .data 474, 245, 277, -162, 581
+add L267, r4
+bne L57
+L255: .string "iipcaza"
+
+L256: .string "kvhygsdwgmjms"
+mov #-117, *r4
+L257: .data -812, -306, 759, 307, -655
+L258: .data 957, 970
+L259: stop
+L260: .string "beean"
+L261: .data 249, -599, -61, 343, 483, -271, 881
+cmp L26, #191
+sub *r5, L221
+L262: .string "oklculsdrkrcyuznlkyy"
+cmp #-176, L322
+L263: .data 531, 174, -708
+L264: .data -875, -835, -946, -56, 480, 921, 133, -578
+L265: .data -169, 816, 476, 789
+L266: .data -556, 554
+L267: .data 434, -575, -760, 638, -777, 332, -669, -670
+L268: .string "iqjcrmssbovo"
+dec *r1
+bne *r2
+; comment
+rts
+L269: .string "tjsgyxgbqwymvta"
+clr L214
+
+L270: .string "tsrvtweygujjci"
+L271: .data 368, 157, 889, -593, 592, 795
+jmp L174
+clr L242
+L272: .data -531, -996, 872, -323, -430, 903, -191, 325
+L273: .data 642, -710, -288, 23, 56, 187, -139
+
+L274: lea L192, L194
+L275: .data -709, -37
+jsr L34
+inc *r7
+L276: .string "sifedgvltiakmqxl"
+lea L207, *r0
+L277: .string "cvjuowswmdvofsqdeme"
+L278: .string "tzqorbgtkumrzlekjtd"
+L279: .string "dufjojdzhzxczpuor"
+L280: .string "acr"
+L281: .string "ryiaafmmwhgfwutwky"
+L282: .data 828, -619, 854, 81, -612, -949, 664, 202
+L283: .data 346, 468, 475, -460
+L284: .string "oottlegltnaiqeiihxojns"
+L285: .data 105, -511, -163, 611, 124
+L286: stop
+jsr L40
+mov L316, L216
+L287: .string "emxlubtbscni"
+not *r4
+bne *r6
+cmp r4, r0
+stop
+L288: jsr *r7
+L289: .data -428, 167, 182, -908, -102, -135
+
+L290: .string "okwkrkyxidl"
+rts
+inc *r1
+L291: .data -928, -486, 812
+L292: .string "ugzgznr"
+L293: .data 643, 988, -106, -12
+L294: .string "pctjnjvuqjblzchrmlaoqjho"
+L295: .string "yofbponmbdmcuriwer"
+sub L320, L314
+L296: .string "gggworzzvryjk"
+jmp L77
+clr r6
+cmp L101, *r4
+L297: .data -149, 234, 188, 7, -264
+L298: .data -778, -552, 170, 985, 371, -150, -698, -668
+dec L265
+sub *r3, L287
+L299: .string "slybisoqbl"
+sub r0, L117
+L300: .data -517, 254, 391, 244, -879, -69, 173, -221
+jmp L237
+L301: .data -997, -723, -149, 432, -285, 955, 244, -650
+L302: .string "iekg"
+L303: stop
+L304: .data 342
+L305: .string "rbwcx"
+L306: .string "hapgvykioyfsmvbnsioyalo"
+L307: .string "vfrffuushlbzjptjbiot"
+red r0
+L308: .string "kdxumbhrvh"
+L309: .string "sdeqqbo"
+prn *r4
+L310: .data 83, 637
+mov #-51, L31
+L311: .data -957, 471, 867, 739, -790, -910, -642, -357
+red L160
+L312: .string "duiminjntvrbvq"
+L313: .data 119, 776, 859, -886, 149, 311, -23
+not r3
+L314: .data 166, -613, -77
+L315: prn *r1
+L316: .data 150, -858, -698, 686
+L317: mov L325, L8
+L318: .string "vagwqjjolqvdyboqoohcylv"
+L319: rts
+L320: .data -139, 454, -619
+sub #-4, L313
+L321: rts
+L322: rts
+L323: stop
+L324: .data 437, 47, -76, 812, -554, -237, -516
+; comment
+L325: .string "lbzpbgzsxdqve"
+bne L211
+L326: not *r6
+L327: .data 601
+L328: .string "vntznkibhkmczxoii"
+L329: .data -225
+
+stop
@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 7
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+L0: .string "ydhgpgiyt"
+L1: .data -951, 598, 890, -617, 201, -300
+L2: .data -401, -439, -748, -672, -233, -381
+cmp L0, L219
+L3: .data 625, -736, 5
+not r4
+L4: .data 161, 904
+L5: .data -214, 763
+add r4, r0
+L6: prn L4
+L7: .data 416, -381
+; comment
+L8: .data 202, 662, -506, 259
+L9: .string "rw"
+L10: .string "quavljjnorujrkk"
+; comment
+L11: .data 581, 88
+L12: .string "yfpiawiyjo"
+L13: .string "py"
+L14: .data -746, 378, -98, 558, 225
+stop
+L15: .string "tt"
+L16: .string "epvgxulcvshtx"
+L17: .data 571, 186, 366
+bne *r1
+L18: .data 384, 484
+L19: clr *r1
+L20: rts
+L21: .string "wuo"
+rts
+jsr L16
+L22: .data 493, -769, -576, -655
+L23: .data 85, 950, 450, -343
+L24: .string "bjuvrgsgurkbz"
+L25: .data 392, -459, 637, 998, 618, -517
+rts
+L26: .data 847, -403, -808
+L27: cmp L295, r1
+add L179, *r5
+L28: .string "ig"
+red *r0
+L29: .data -720, 915
+jsr *r1
+L30: .string "dzelpllfqghzsrlsbyvent"
+clr r4
+L31: .data -377
+cmp L9, *r4
+cmp L1, *r3
+L32: .string "sdvixkqwxxr"
+L33: .data -509, -161, 767, 181, 963, 385, -202, 578
+
+L34: .data -16, 680, -273
+L35: prn #72
+dec r2
+L36: .string "cykk"
+stop
+jmp L150
+L37: jmp L26
+L38: prn r1
+lea L69, *r2
+add r1, r7
+lea L6, r7
+stop
+dec *r0
+L39: .string "iaixkuwizxmvttpkhyji"
+L40: .data 387, -682, 753, 347, -920, 685, -253
+add r6, *r5
+dec r7
+red r1
+L41: .string "olatghxtacwgq"
+L42: .data 450, -348, -686
+; comment
+prn L110
+prn #-68
+jmp *r0
+L43: .data 824, -497
+
+dec r5
+L44: .string "xhumaqujkebcyevesldcs"
+not L24
+L45: .string "bbsnfoyvndpfttoktxfh"
+sub #-158, r5
+L46: stop
+L47: .data 893, 57, -730, -136
+L48: .string "gt"
+L49: .string "yqbnajg"
+L50: .string "lzeqwglpevzugkwukqdnvm"
+L51: clr *r6
+L52: .data 897, -384, -46, -704
+; comment
+lea L30, r0
+add *r3, r1
+L53: prn *r5
+jsr L30
+L54: .data 740
+clr r2
+L55: .string "qkvnrzlgnkdopfyb"
+L56: .string "cngpp"
+L57: .data -162, 469, 558, -90, 484, -52, 843
+L58: .string "sjzbyymffufteviu"
+L59: .string "qhqfzgededqptyyaehkoz"
+rts
+L60: .string "asqbeequxuxprscd"
+mov r3, *r7
+rts
+jsr L82
+L61: .string "bgltirdmnsjiimxjplpv"
+
+L62: .string "xqzkghxa"
+L63: .data 644, -909, 545, 372, -310, 458
+L64: .data -207, -756, 441
+; comment
+L65: .string "thtzmiaogscicezibifs"
+clr *r2
+rts
+L66: .data 436, 593, -848, 229, -499, 501
+L67: .data -181, -425, 784
+L68: .string "tcogbvwaglpwxrfqprah"
+jsr *r3
+L69: .data 191, 919, -702
+L70: .string "fijsuexbdlkkefpaeogih"
+sub r1, *r5
+L71: .string "omhoikqhtmamoewcdpmsz"
+L72: add *r0, r2
+L73: .data 521, 41, 564, 124, -266, -239, -769
+L74: .data 40, 846, 80, 718, 349, -324
+L75: .string "zicdgow"
+stop
+L76: .data 320, 36
+mov r3, L208
+L77: .string "pfpa"
+L78: jmp L231
+L79: .string "soqjhimfnnqlbqqaojtcsprn"
+L80: .data -836, 921
+rts
+red L169
+mov #4, r4
+cmp L268, L74
+mov *r6, *r5
+L81: .data 767
+L82: .string "thzxgmcrbznyecumwephrlzj"
+red *r7
+sub *r1, r5
+mov #27, r0
+L83: .string "jddjbuldmnmephbwybrqef"
+L84: .string "wii"
+; comment
+L85: .data -483, 203, -553, 683, -38, 613, 587
+L86: not r3
+not L26
+L87: .data -15, -642, -332, 519
+jsr *r2
+L88: .data -368, 511, -15, -256, 108, -44, -676, -853
+L89: .string "taujlliytlvonqr"
+L90: .string "yypkitkwywfnuvcedzoes"
+L91: .data -185, -746, -77, -518
+bne *r4
+cmp #199, L251
+L92: .data 778, -423, -761, 987
+L93: .string "rklbewobbritawjpzairfjr"
+L94: .string "opfkgprv"
+L95: .data 242
+L96: .string "wvzygetxxecokdbbdeumcr"
+L97: .string "pnbyzayromtzn"
+L98: .data 375, -546, 540, 199, 372
+L99: .data 811, -584, -712, 878
+jmp L137
+stop
+sub r6, *r7
+L100: .string "jemmfsibzdfei"
+L101: .data -289, 772, 318
+L102: .string "ghpuvnqlsexrxayqiq"
+sub L264, *r2
+L103: .string "gvgbtgnd"
+L104: red *r6
+L105: .data 316, -530, 299, -639, 595, 980, 919, 565
+bne L131
+L106: .data 9, 198, 76, -984
+mov #238, L236
+L107: .data 456, -763, 201, -851, 808
+L108: .string "czam"
+L109: red *r4
+add #-255, *r6
+L110: .data -225
+red *r3
+lea L160, r2
+L111: .data -726, -292, 103, -512, -585, -949, 629, 731
+stop
+
+L112: mov r3, *r6
+L113: .data 112, -65, 370
+L114: .data 190, 827, 899, -30, -246, -380
+sub #-56, L42
+L115: .string "fhsqdhhtfpmtemiwzw"
+L116: .string "eyiaygwrwbziz"
+L117: .string "dhoghrwsixhtfemwzjqtkr"
+mov L98, L207
+L118: .data 209, -443, 789, 950, -704
+not r0
+L119: mov *r1, L272
+L120: .string "fnberhjkryg"
+; comment
+inc *r1
+L121: .data -681, 232
+jsr *r7
+red L254
+L122: .string "wucyfybukikongdhknewl"
+bne L292
+L123: .string "i"
+add L29, r4
+L124: .string "l"
+L125: .data 871, -357, -980, 898, 551, -361, -298
+L126: .string "fizhnqzegqfuq"
+dec *r1
+; comment
+L127: .string "cikxemjwyukhzvfjffhlptdz"
+prn L206
+jsr L78
+prn r4
+prn r7
+L128: .string "qprgfipfbrrbqcqwu"
+lea L51, r6
+prn r6
+L129: .string "ebfaqpreswvcp"
+jsr L211
+L130: .string "wblrw"
+L131: .string "xywlanbrugaycbvgelvz"
+jmp L44
+L132: .data 453, -753, 43, -445, 512
+add r1, r3
+rts
+L133: .string "e"
+L134: .data 340, -14, -912, -751
+L135: .data 133, -712, -399, -212, -128, 244, 346
+not L239
+; comment
+L136: .data -645, 99, -664, -513
+L137: .string "kaxdp"
+L138: .string "bsccclzvhxiqcsnxide"
+mov r1, L4
+red *r2
+L139: stop
+L140: .data -47, 756, 402, 796
+jmp *r0
+L141: .string "vnaulvwtjuwrdxtpelj"
+dec *r0
+L142: .data -482, 692, -663
+L143: .string "wasfnsmwtwkbrkfscy"
+jmp *r4
+red L223
+L144: .string "vsutxwhe"
+red r1
+inc L175
+L145: .string "spqicgkrlyrgrdsqjacvq"
+L146: .string "xpymllteaqxw"
+L147: .data -344, -603
+L148: .data -677, 579, -668, 865, -634, -793, 120
+L149: .string "ezehveifeokeslvcc"
+L150: .data -830
+L151: .data -25, 393, 967
+L152: .data -684, 242, -405, 293, 595, -94, 789
+L153: sub r0, *r3
+L154: .data -360, 931, 725
+L155: .data 635, 674, -846, -589, 860
+lea L138, L223
+L156: .data -592, -122, -99, 526, -616, -788
+L157: .string "gmaanutjqelrcmqmw"
+; comment
+L158: .string "whviodoihk"
+L159: .string "fihadctrwlqpbxoj"
+L160: .string "bbeeznbzcxzbksahbgsmjzu"
+mov #-80, *r7
+L161: .string "yp"
+L162: .data -146, -209, 301, 824
+add *r2, *r2
+L163: .string "ioa"
+L164: .data -428
+L165: .data -908, 897, 403, 197, -951, 732, 338
+prn L167
+L166: clr L117
+L167: .data -505, -846, 828, 26
+L168: .string "urekirgedv"
+L169: cmp L71, r2
+L170: .data 373, -339, 653, 430, -478
+jsr L49
+L171: .string "qfvxsgsivnbysuw"
+L172: .data 799, -926
+L173: .string "dvupdmeh"
+L174: .data -143, -857, 373, 706, 227, 900, 311, 310
+
+L175: .string "lscflbqh"
+red *r1
+L176: .string "rkl"
+L177: .string "xassnjdhvolklhmhoioxn"
+L178: .string "mqsbqsairkwmpziuoky"
+jsr *r4
+L179: .string "ehsuepou"
+L180: .data -45, 881, -165, -111, 694, -511, -957, 20
+L181: .data -533, -353, 132, -557, 757, -107
+L182: .data 943, 353, 383, 927, -954, -788, 374
+L183: jsr L134
+; comment
+L184: .data -243, -982, -727, 565, -594, -596, -205, -100
+add L191, r2
+L185: sub L207, r6
+L186: .data 182, 460, -7
+L187: not L300
+L188: clr L274
+lea L26, *r7
+clr *r3
+L189: .data -685, 87, -988, 631, -78, -203, -234, -585
+L190: red *r7
+L191: .string "egbt"
+bne *r1
+lea L96, *r6
+L192: .string "dobayiwrlkdzvpgivkk"
+L193: red r3
+lea L145, r6
+dec r7
+L194: .data -918, -667, 526, -902, -99
+L195: .data 439, -229, -170, 654, -39
+jmp L210
+mov r6, r1
+L196: .data 762, -8, 655, -850, -948, -193, 303
+lea L12, L218
+lea L254, r0
+L197: .data 81, 764, 750
+L198: .data 490, -787, -56, -582
+L199: .string "pgkuckdhfvkojvgsisymcvt"
+L200: .string "llunkauirgxbagduykr"
+dec L182
+L201: .string "cbb"
+L202: .string "ynljbtpqvkezizhpua"
+inc L89
+mov L206, r7
+L203: .string "cfngjshkwgdonvpuifetwx"
+L204: .string "upn"
+red *r5
+L205: .data -27, 638, 210, 611, 486, 798, -974, 320
+clr *r5
+L206: .data -444, -800, -8, -771, 465, 505, -2, 608
+L207: .data 416, 675, -524, 108, -962, -345
+L208: .data -269, 66, 921, 202, 417
+stop
+L209: .string "zzysdy"
+mov L219, r6
+L210: inc r4
+add L140, L10
+dec L212
+L211: .data -945, -691, -495, -380, 275, -139
+clr *r2
+jsr L273
+L212: .string "kmakppbsgdrdegvyoynmrjg"
+L213: .data 749, 562, -982, -60, -879, 448
+lea L124, L137
+L214: .data -384, -497
+L215: .string "losujnzktma"
+sub #-187, r4
+L216: inc r0
+L217: .data 132
+L218: .string "q"
+L219: rts
+L220: .string "ltbkskbnpttnanfpm"
+; comment
+L221: .data -546, -1000
+
+L222: .string "hjib"
+L223: .string "rrsnrtestdqkxtkg"
+L224: mov L69, *r0
+L225: .data -810, 81
+L226: stop
+L227: .string "amvdmyvwfj"
+L228: .data 312, 802, -15, 214
+
+bne L271
+L229: .string "tapefpzlwx"
+L230: .string "nkgzvoyjajxzyztlon"
+stop
+lea L164, *r2
+clr L261
+L231: .string "zoh"
+L232: .data 675
+cmp #81, L198
+inc L246
+L233: .data 499, 576, -504
+L234: .string "edgvvdsftihehwoggqytzhtz"
+L235: .string "dd"
+L236: .data -78, -437, 131, -685, -426, 717, 192
+L237: .data -615
+L238: .string "y"
+L239: .string "uatdncqiqiahrolgcxpn"
+add r0, r1
+L240: .string "zuwidtvh"
+L241: .string "iotfuduoy"
+L242: .string "anwyyjinwzldnnhe"
+L243: .data -247, 553, 738, -878
+L244: .data -389, -805, -874
+L245: .data -664, -636
+L246: .string "uanuqarhhp"
+
+L247: .data 756, 583
+L248: .string "wdauofmedq"
+L249: .string "cp"
+stop
+L250: .string "okanjqcozdceixy"
+add r0, r4
+add r4, L256
+L251: .string "pdypkopob"
+L252: .string "hzlipacozqtqrlbud"
+lea L235, L295
+L253: .string "pelyc"
+dec L272
+L254: .data -483, -12, 942, 45
+L255: .string "bxk"
+L256: .string "xtagws"
+prn *r6
+L257: .data 318, 384, 396, -447, 996, 415, 453, -834
+L258: .data 90, -734, -259
+L259: .string "rqfluyezxvmrsduhucnxx"
+prn L170
+L260: .data 321, 724, 431, -989, -495, 458, 416, -530
+jsr *r0
+L261: .data 574, 799, 584, 901, -812, 874, 106
+L262: .string "bzwui"
+stop
+bne L160
+L263: .string "blrpvjxssywapvrhvzft"
+L264: bne L178
+L265: .string "ytanikbjvtxondttejo"
+L266: .data -357, 821
+L267: .data 253
+L268: .data -799, -777, 221, 823
+stop
+stop
+mov #-194, r1
+mov #140, L299
+not *r2
+jsr L288
+L269: lea L255, L6
+L270: .string "hvejrbmbgmf"
+sub *r0, *r5
+L271: .data 17, 309
+L272: rts
+L273: .data -930, -414, 227, 464, -753, 209, -534
+jmp *r5
+L274: .data 206, 296, 153, 76, -457
+sub r3, L295
+L275: .string "noonadkhohuzwtvnwp"
+dec *r6
+L276: .data -588
+rts
+L277: .data 541, 869, 120, 255, 407
+L278: .data -598, -39, 923, 83, -168
+L279: .string "zwuosjvfgdl"
+L280: .data -575, 509
+rts
+L281: .data -838, 589
+L282: .string "nar"
+mov r6, L236
+L283: .data -641, -329, 454, 213, 892, 473
+L284: .string "c"
+L285: .string "ksxzlktmjjpxywafv"
+L286: add r6, r7
+
+L287: .string "msnv"
+L288: .string "s"
+prn *r3
+jsr L294
+; comment
+L289: .string "rvlbldjgqm"
+L290: .data 497, -364, 300, -197
+L291: .data 222, -307, -649, 649, -303
+add r3, r3
+rts
+L292: .string "hmjdkeyzxbsyjurz"
+L293: .string "ohpzutgjwkqwfnsood"
+not L300
+L294: .string "bhw"
+L295: jmp *r6
+L296: .string "aw"
+dec L304
+L297: .string "jvyavcltatgjls"
+mov *r2, L300
+L298: .data -802, 651
+L299: .data 662, -993, 966, -976, 337, 776, -747
+prn *r1
+jsr *r4
+L300: .string "symlrqzibubes"
+red *r0
+L301: .string "xuqekusfqzzzqn"
+inc L307
+inc *r3
+L302: clr r2
+L303: .string "wvfuqkrcckknlto"
+rts
+L304: .string "wdyemgrfqqoabpbicbec"
+L305: .string "achwej"
+L306: .data 226, -910, 782
+cmp #216, r6
+L307: .data 984, -463, 517
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 61
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+mov #-103, r7
+L0: .string "fuppfdhhaoosgrrswlrsyygx"
+L1: .string "qqlysqdyjxqfgbdezk"
+L2: .data -202, 530, -516
+L3: .data 206
+L4: .string "phhpblwxvfaqxbxfognej"
+L5: .data -483, -120
+L6: prn *r1
+; comment
+sub L4, r7
+L7: .data -59, 873
+L8: .data 818, -912, 654, -153
+L9: .data 908, -772, -242, -71
+L10: .data -251
+lea L4, *r4
+L11: .string "qlnku"
+L12: .data -442, 910, -327, -697, -495, 59, 107, -211
+inc L4
+L13: .data -119, 689, 278, 585, 28
+L14: add L214, r0
+L15: .string "zlptkwwaqdxmr"
+L16: .data 353, 16, 70, 247, -489, 844, -713, 590
+L17: .string "itnmrdmjyhyuusngyoeuwy"
+L18: .string "ldbmqbgrcrizuilblyaqqdb"
+L19: .string "uljmqmztirqzajlmhyip"
+L20: .string "qboakfyhkgjpyptleuyga"
+mov #-119, r5
+L21: .string "kcoxiikwlbacpxpkpfvp"
+mov r4, *r0
+inc *r0
+L22: .data 463, 336, -116, 918, 51, -630, -843, 227
+jsr *r4
+L23: .data -959, 521, 511, 254, -379
+L24: .data 543, -692, -980, 926
+L25: .string "jgxfz"
+L26: .data -910, 423, 617
+L27: .string "kwcclwesrg"
+L28: .string "dxwwfxwcxtidlgaa"
+L29: jmp *r6
+L30: dec *r5
+L31: .data 79, -592, -227
+L32: .string "gsmf"
+L33: .data 307, 906, -250, 810
+jmp L192
+L34: .data 532, -436, -748
+L35: .string "aaglscackyqrtkqseenglrif"
+L36: stop
+L37: .data -41, 361, 792, -801, -771, 341, -257, 810
+sub r0, *r2
+sub r4, L302
+L38: .data 388, -832, -443, 129, -601, -251
+L39: .string "dd"
+L40: .string "rpmacfqpelocos"
+L41: .data -286, -77, -943, 966, -909
+red *r3
+L42: .string "nnhvjjwlgoutmensiymvke"
+L43: .string "en"
+L44: .string "yqbwjkl"
+; comment
+L45: .data -273, 632, 807, 145, -939, -557, 439
+L46: .string "xwhoeypeqhyszlnkuxtpoz"
+L47: .string "p"
+L48: .data 685, -325, -404
+L49: .data 258, -944, 459
+inc L115
+add L0, *r6
+L50: .string "sxqdphuetpoljxehpnw"
+
+L51: .string "xcvvynsmg"
+L52: .string "cdabhxcp"
+L53: .string "risvdfnegkdfiandgkiskujv"
+jsr *r2
+jmp *r6
+bne *r4
+inc L272
+L54: .data -241, -892, 855, 676, -560, 631, 666
+rts
+L55: .data -580
+L56: .string "ktkephegbyj"
+L57: .string "gwzsnglqlrtsisxzcm"
+L58: .string "idzkhjqqwax"
+L59: .string "wsmmyhsmyzca"
+not L22
+L60: .string "gfonfcmbnifo"
+L61: .string "rongpuddmawndcxvvz"
+L62: .string "odogdfatzhwrhjcixb"
+L63: .string "ihsdvgijeq"
+L64: .string "zkfhd"
+; comment
+L65: .string "eluzpxswlsefbwszcmc"
+L66: mov r7, *r3
+L67: .string "cjipmvfh"
+L68: .data 744, 117, 424, -411, -12, -801
+jsr L55
+
+; comment
+L69: .string "roguoxbvjkcb"
+L70: .string "stqhqwmfwtq"
+L71: dec L65
+L72: .string "eltdvigvmuydtmzfuyzu"
+prn r7
+jsr L34
+add *r3, *r3
+L73: .data -317, 874, 439, 395, 175
+bne *r1
+L74: .data -372, 949, -53
+stop
+L75: .string "odrlyahhiifyyn"
+add r3, L306
+L76: .string "homlf"
+L77: dec L252
+L78: .string "ckbojupjlkximbrhls"
+L79: .string "ibvnfgqfarcsvjofwmsdi"
+L80: .data -46, 392
+L81: .string "bgzhs"
+L82: .data 35, 918, 497, 521, -798, 63
+L83: .data 595, -166
+L84: rts
+
+dec r1
+lea L40, r6
+L85: jmp *r0
+L86: .string "ndwupjbelqca"
+L87: .data -707, -705, -351, -420, 629, -829, 846
+stop
+L88: .string "typzdcbddvflignjanjpjbt"
+L89: .string "agsocrsgeucjsveofm"
+L90: add L16, L36
+L91: .data 543, -605, -9, 545, 266, 200
+; comment
+L92: .string "n"
+L93: .string "tmnfcmqgqsafbunexysgya"
+
+L94: .data 395, -721, -817, -862, -454
+dec L46
+L95: jmp L16
+L96: .string "whgaakkueosxtzdfbg"
+L97: .string "vfxv"
+red r2
+L98: .data 909
+rts
+L99: .string "dhcfkvynwz"
+L100: .string "oriqznbntjusrnfh"
+L101: .data 662, 252, 877, 274
+L102: .data -93, 165
+L103: .string "qzoqitjexgcopuxwag"
+L104: .string "heclwkhqjcf"
+red L193
+L105: .string "jnsjelkprytobfwtwqpj"
+L106: .data 659, -965
+L107: .string "hikdngbixwsiaswotzfs"
+L108: .data 708
+L109: .string "ldbbgefkkxdhcgr"
+mov #15, r2
+L110: .string "neovbavkajmagvsrveoga"
+L111: .data 253, 980, -91, 615
+L112: .string "ugqslluxc"
+L113: .string "eaoeeilmmdmmwxtkxeuzrd"
+L114: .string "oysewtkosdlwkutmvuvwf"
+L115: .string "qsskndipdrgqxcwzdkxwrooy"
+dec *r4
+
+; comment
+L116: .string "aixp"
+bne *r5
+L117: .data -740, 482, -813, -381, 255, -902, 985
+L118: .data -783, 696, -38, 316, 681, 941
+L119: .string "wziqoditjlouhntvasrcpzgy"
+cmp *r6, *r5
+sub *r3, *r2
+red r0
+L120: .data -603, -10, 738, -438
+lea L73, *r6
+jsr L209
+L121: .data -839, -948, -120, 830, -452, -884
+L122: .string "rxrsyzz"
+not *r4
+jsr L92
+lea L48, r5
+dec *r6
+L123: .data 956, -57, -375
+L124: .string "ye"
+L125: .data 568, -572, -926
+not *r3
+
+L126: .data -952, 976, -77
+L127: .data 54, 236
+L128: .string "lvhjcdngf"
+L129: .string "k"
+L130: .string "efgyedkdicnjltt"
+jmp *r1
+L131: .data 52
+L132: .data 899, -559, -112, -268, 23
+L133: .string "jsrbfgqfmyzhmtomwyzb"
+dec L217
+L134: .data 289, -789, 690, 902
+L135: .string "rtjoc"
+dec r4
+
+inc r7
+prn *r4
+dec L246
+jmp L77
+L136: .data -785, -35, 937, 422, 262, -653
+L137: .string "o"
+inc L102
+jsr *r1
+sub *r1, L18
+L138: lea L75, *r6
+
+L139: bne *r3
+L140: .string "hyzzcnmdhybqqcvteb"
+L141: .data -951, 425, -696, 295
+stop
+L142: not r1
+L143: .data -305, 991
+sub *r7, L44
+rts
+
+L144: .data -204, -991, -652, -287
+rts
+L145: .data 4
+L146: .string "ynz"
+not L208
+L147: .data 405, 971, -66, -58, -918
+L148: .data -805
+jmp L96
+L149: jmp L113
+prn #75
+jmp L10
+add L198, L206
+L150: .string "qgixd"
+L151: .data -1000, -955, 157, -712, 861
+L152: .string "ajsoopjxpmmxph"
+L153: .string "oqljquwkfcvqnnkqfyp"
+L154: .string "hajibitvvxtflcjrvngow"
+red *r7
+L155: .string "xspwhsprzpdhpm"
+; comment
+L156: .string "lgdlgazkimrypgdpvo"
+L157: .string "njlykwiirecrfhnigfl"
+L158: .data -907, 116, -710, -120
+bne *r7
+L159: .data 919, 620, 584, -652, -380, -179, 83, 602
+stop
+L160: .data -387, 603, -48, -559, 319
+L161: .data 639, -901, 67, 962, 966, -742
+L162: .string "chagpwouxnghrjbhfvuq"
+L163: .string "rbjfikmq"
+L164: .data -241
+clr r7
+red *r6
+add *r1, r5
+L165: jsr L255
+L166: .data -475
+L167: .string "beluaijbbzowpt"
+L168: .data -893, -730, -835, -416, 658, -234, -307
+L169: .string "vztqopqfwz"
+; comment
+L170: prn *r1
+bne *r1
+stop
+add #76, L251
+L171: stop
+L172: clr *r3
+L173: .data 394
+jsr L42
+L174: .string "apcoztfuxgkjy"
+L175: .data 606, 116, -718
+jmp L71
+L176: .string "atmhhxpxsvhoebnsk"
+L177: .data 389, -263, -490
+L178: bne *r3
+bne *r2
+L179: .data 54, -22, 960, 269, -932, -190, -6, 247
+L180: .data 843, 123, 310, 426, 945
+L181: .data -35, -996, 281, -566, 557, 907
+L182: .string "bkapyfmrhcurpzbprtcs"
+L183: .data 191, -733, 304, -991, 213, 99
+L184: .string "pnxbvetpxokptraocrd"
+L185: .string "glnxfgj"
+L186: .data 943, -575, 955, 203, 271, 491
+
+L187: .data -679
+prn L208
+L188: .string "ktnuhiphzypykhsljswwl"
+inc *r7
+L189: .string "fvn"
+L190: .data -878, 538, -19, 936, 140, -380, -830, 902
+L191: .string "ixnmxrq"
+L192: sub *r7, r3
+L193: .string "eoimkghgdzuq"
+L194: .data 314, -155, 987, 483, 824
+L195: .string "wmmnosvlgcrvjc"
+sub L268, r6
+L196: .string "tbhaizhc"
+L197: .data 205, -84, 79, -473, 111, -936, -422, 930
+; comment
+L198: .data 184, 370, 467, 280, 48
+not r7
+dec L26
+inc r6
+L199: .data 59, 712, 44, 936
+L200: .string "mnwjpbtzbpc"
+L201: .string "uj"
+L202: .data -135, 954, -603, 352
+L203: .data 87, 733, -777
+L204: .data 398, -478, 200, -312, 370
+L205: .data -89, 902, 834, -402, -21
+L206: .data -198, -264, -449, 40
+rts
+L207: .data 973
+L208: not L69
+L209: .string "zcqhzri"
+cmp *r7, r5
+L210: .string "caeramglmmmf"
+L211: .data 733, 920, 729, 679
+L212: .data -265, 774
+L213: .string "wtfnkbefivupwhfhdrknm"
+L214: .data -667, 975, 176, 142, -833, -89, -612
+L215: .data -163, 735, -296, -499, -6
+not *r6
+L216: .string "cn"
+L217: .data 628, 720
+L218: .string "p"
+prn r3
+rts
+sub #217, L232
+L219: .data -58, 357, 666, 315
+dec *r6
+prn *r7
+L220: .string "nbfuaaqdtyogwwuzdsm"
+L221: .string "heymupvdztudbcnxbmabgnd"
+L222: .string "xc"
+L223: not *r6
+jsr *r7
+L224: .string "ge"
+dec r3
+not r1
+L225: .data 763, 436, -728, -530, 589, -894, 2, -625
+sub L85, r7
+L226: .data 555, 949, 60, -857, 487, 354, 625, -637
+; comment
+L227: .string "idtkurjkwtye"
+jsr *r0
+L228: .string "jqvvtpyhvbt"
+L229: .data -157, 276, 340, -751, -906, -357, -230, -545
+L230: .string "zrhthzteq"
+L231: .string "axpvpq"
+
+L232: .data 654, 696, 82, -778, 143, -700
+lea L320, *r5
+rts
+L233: .data 672, 347, 16, -358, -979, -386
+L234: .data -596, 671, -385
+L235: .string "psfh"
+stop
+L236: .string "ukooo"
+L237: .string "ehfggrkxb"
+L238: .string "yzrqsjjuxgbilaymac"
+L239: .data -710, 734, -848
+L240: .data -723, 435
+
+L241: .data 275, -186, 716
+jsr *r6
+sub L194, L311
+red L119
+L242: .data -162, 305, -631, 817, -508, 535, 282
+prn #-109
+bne L222
+L243: .string "dutzp"
+L244: .data 125
+L245: .data -109, -413, 810
+sub #104, r1
+stop
+jsr *r2
+L246: .data -844, -379, -429, 441
+bne *r4
+L247: .string "fhnh"
+L248: .string "df"
+L249: .data -421, 866, 84, -791, -566, -785
+bne L323
+L250: .string "a"
+L251: .string "tj"
+L252: .data -251, -50, 379, 861, -55
+L253: .data 835, 639, 144, 162, -197, 918
+inc *r6
+stop
+L254: .string "t"
+L255: .data 837, -956
+L256: cmp #246, L13
+L257: .string "oamtgbvaxhqcfstztitd"
+L258: .string "eruswstdhzc"
+
+L259: .data 661, 62, 440, 650, -621, -809, 238, -472
+L260: .data -160
+L261: .string "afqghlfztf"
+L262: stop
+L263: .data -486, 856, 508, 761, 231
+prn L282
+L264: mov L321, *r6
+L265: .string "ulhcnuhftbweu"
+; comment
+inc *r2
+L266: .data 425
+sub *r4, L21
+L267: .data -639, 794, 538
+L268: .data -245, -456, -873, -697, -788, -380
+add #-103, *r6
+L269: .string "oahulbhozp"
+L270: add r3, *r0
+dec L254
+sub r5, r4
+bne L149
+L271: .data 716
+L272: .string "wqbrpsnwrqhyvenqdmrcy"
+L273: .string "sayzgoyj"
+L274: .string "ltvftqyovnuusgmmrnsjclt"
+L275: .data -779, 308, 700, 671, -928, 108, 998
+L276: .data 849, 537, 837, -889, 558, -619, -235, -560
+L277: .string "bmhosyypjryktufaonq"
+L278: .data 181, 753, 783, 702, -114, -685
+L279: .string "tkz"
+jsr *r6
+jmp L309
+L280: .string "ynmptcfozacajujbblbscsqz"
+L281: .string "coszqeviilx"
+L282: .data -691, 777, -904, 942, 647, 292, -347
+stop
+L283: jmp *r3
+L284: .string "cgerxbxl"
+; comment
+L285: .data -201, -94, 119, 132, 295, -469, 509
+L286: .string "bkuvvxzdnxqfvbcvau"
+L287: add *r3, *r0
+L288: .string "jka"
+jmp L177
+L289: .data 45, -218, 631, 823, 125
+inc L290
+L290: .data -325
+red r4
+L291: .data -69, 168, 338, 86, 60
+L292: .string "wnivkzbzkeu"
+dec *r6
+L293: .string "nlfwndykuf"
+jmp L213
+L294: .data 769, 765, -658
+L295: .string "poyytydehdbowkhggb"
+L296: .string "iowyvyiraaq"
+L297: .data 438, -914, 656, -352, 912, 819, 866
+add #-240, *r5
+not *r3
+L298: inc L198
+L299: .string "dmj"
+L300: .data -244
+cmp r3, r7
+L301: .data -289, 415, -516, 805, -668, 546, -161, 179
+L302: .string "gup"
+mov L322, r2
+L303: .data -369
+L304: .string "foysylcu"
+L305: .string "mtkgxdetbwoodvfsxrzmp"
+not r1
+L306: .string "qdzloo"
+L307: mov #22, L33
+bne L312
+L308: .data -674, 60, -900, -650, -756, -677
+; comment
+inc *r0
+L309: .data 636, 131, -857, -90
+L310: .string "hljusucnyufpigiik"
+L311: .data -532, 784, -236, -193, -329, 300, 505
+L312: dec *r2
+stop
+L313: .data 653, 476, -458
+bne L323
+prn L319
+; comment
+L314: .string "xjhdzrvxwferhfcis"
+L315: .string "dmrm"
+clr *r7
+cmp L163, r7
+L316: .data 254, 889, 619, 906, -373, -904
+rts
+L317: .string "uqvwl"
+L318: dec L218
+L319: stop
+L320: .string "fz"
+inc r0
+L321: .string "erijtuzmdnksbyneyjmx"
+L322: .data -495, -163, 223, -199, 738, 38
+prn L294
+bne L110
+L323: .string "gytgfianmkyikogsrabrgta"
+jsr L130
+rts
+L324: .string "wzfntpenjwuwuztjclfds"
+L325: .data 687, 9, 206, 457, -268, 766, 933
+L326: .string "td"
+L327: .string "ssqwqfrszlmazhbbpgzi"
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 62
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .data -611, -655, 330, -337, 783, -434, 185
+L1: .data 25
+L2: .data -706, 344, -37
+L3: .string "gwdqrzauvizmwqxstuuuuc"
+L4: .string "suokjvcxzefqsuqgeczoree"
+L5: .string "dviqxpsiijyouh"
+L6: .string "yzlcgwwzkxuektupzhgmzp"
+stop
+L7: .data 647, 869, 105, 13, 428, -875, -357
+jsr *r2
+L8: .data 154, -680, -363, 532, -178, -644, 970
+L9: .data -940, 896, 293, 959, 177
+; comment
+; comment
+L10: .data -518, 810, 34, 244, -896
+L11: .string "qakpdtasoyhrlrtthjajnu"
+clr r1
+L12: .string "bmdcybibntcynuvmlou"
+L13: .string "ngwcejjhaimulq"
+L14: .data 843, 395, 270
+inc r2
+clr L293
+prn r7
+mov #87, L19
+not L269
+L15: .data -501, 929, 923, 383, 244, 338
+rts
+L16: .data 869, 704
+L17: not L6
+cmp r2, *r4
+L18: .data -5, -239, -527
+L19: .data -48
+L20: .data 573, 65
+L21: .data -504, 582, -336, 628, -612
+L22: .string "ifyfqsumemxjjgmrcrifo"
+dec r7
+L23: .data 98, -178
+L24: .string "nq"
+jsr *r5
+rts
+prn #93
+sub L19, r7
+; comment
+L25: .data -127, -631, 751, 479, -30, 927
+add r1, r6
+L26: .data 314, 916, 662, -805
+L27: .data -931, 801, 422, 368
+inc *r2
+L28: .string "ftrqhejrgtljqpvcagtovn"
+L29: .string "cxhhgegtb"
+prn *r6
+rts
+L30: .string "yqk"
+mov #-104, *r6
+L31: .data 124, 154, -612, -731, 790, 786, 242, 740
+L32: .data -414, 976, 807, -373, 750
+L33: .data -854, -583, -720
+L34: rts
+jmp *r5
+L35: .data -205, 488, -381, -989, -609, -667
+L36: .string "jugixoiubuwzyjsdznkkaa"
+L37: .string "leivorlb"
+L38: .data 600, 624
+L39: .data 896, -333, 652, 762, -708
+
+L40: .string "llyzmz"
+not r0
+red *r0
+L41: .string "kgbhfwtrdwrvxsagv"
+L42: .data 285, 615, 864, 212, -824
+L43: .data 538, -359, 221, 489, -525, -606, 43
+L44: .data -594, -846, 22, 963, -481
+L45: .string "mceyzbhyudhlpcwsoasb"
+L46: .string "iunkzwsoz"
+rts
+L47: .data -647, -752, 974, 568
+L48: clr L67
+
+L49: .string "mlsplrxjtzooj"
+L50: .data -206, 93, -511, -659, 355, 665
+L51: .string "nqwumprg"
+; comment
+L52: .data 897, -696, -562, 820
+bne *r7
+cmp L181, #-189
+L53: .data -447, 974
+L54: rts
+add #-75, *r2
+lea L98, r3
+L55: .data 985, 463, 75, -492, -918, 351, 422
+L56: .string "zbaqxanvcipjwn"
+L57: .string "hcqer"
+L58: .data 435
+L59: prn *r5
+L60: .data -189, -3, -440, 977, -829, 412, -948, -404
+prn r4
+L61: .data -498, -745, 440, 170, -824
+L62: .data 402, -288, 472, 941, -232, -497
+L63: .data 864, 540, 183, 511, -628, -948, 125
+L64: .data 289, 48, 151
+L65: .data -378, -422, -156, 96, 831, 357
+L66: .data -841, -534, -550, 27, -537, 932, -543, 72
+L67: .string "jjlu"
+dec r3
+L68: .string "jptmxppvq"
+L69: .string "gqayswbvhxj"
+stop
+jmp *r7
+stop
+not L276
+L70: .string "hlfimdon"
+L71: .string "kmaresuiqkqjkhfnuuzwj"
+L72: .data -763, -707, -391, 741, 750, 346, -622
+jmp L88
+prn *r4
+clr r1
+L73: .data -601, 62, 123, -893, 706
+L74: .string "hkulvdgjvr"
+clr L18
+L75: .data -723
+L76: .string "imxbqculmdrtlzr"
+stop
+add L29, r7
+cmp *r3, #4
+L77: .string "zhtz"
+L78: .string "iowulkrcuweiadclrfrl"
+L79: .data -255, -738
+L80: .string "pbhumfvdcjhhfoudoxpiggcq"
+L81: .data 758, -382, -747, -970, -473, -642, -112, -267
+L82: .string "zdelrnynqoxlsspkr"
+L83: .string "sbqbbwofjsns"
+rts
+cmp r2, *r3
+L84: .data 127, 563, 341, 884, -360
+; comment
+L85: .string "clohpznwwpu"
+L86: .string "qrhgolrndkudhkih"
+L87: .data 445, -934
+lea L18, *r3
+L88: .data 350, -74, 297, -215, -715, 30
+L89: .string "mkmrxeqq"
+L90: .data 567, -621, -665, -880
+stop
+L91: jmp *r6
+L92: .string "czpaoawumcvpfq"
+L93: .string "dchnbpzandemqdbfrjdsbs"
+L94: .string "tz"
+
+L95: .string "jmluuulsothnrypwjygmfgo"
+L96: .string "limqjtx"
+; comment
+L97: .string "uptdsa"
+L98: dec r3
+L99: .string "iwkbhedh"
+L100: .string "bpdfxhjoumtlmmjhkbgkazr"
+L101: .data 591, 180, -757, -420, -669, 753, -717
+L102: .data 487, -34, 291, -815, 807, -202, -724, 62
+
+L103: .string "w"
+L104: .string "akbsutwxdeynenecnyluhm"
+L105: .data 80, -352, -39, 442, -527, -849
+L106: .string "mmoljfjdzgvdfqqauzsk"
+rts
+stop
+L107: .data 968, -156, 523
+L108: stop
+
+L109: .string "kdjoqdttlbamkljfru"
+L110: .data -449, -7, 83, -293
+stop
+L111: .string "vlbjqrgsiumy"
+L112: .string "tjqwnuqdtuj"
+L113: .data 85, -851, -588, 33, -866, 749, 915
+inc L137
+L114: .string "tyxsvdnkzipxdiajuvpifun"
+L115: .data -324, -806, 130, 493
+L116: .data 79, -56, -317, 832, -480, -537, -851, -707
+red *r6
+
+L117: .data 303
+L118: .string "ehtribcjf"
+add *r0, *r2
+; comment
+not *r3
+prn r5
+L119: bne L24
+L120: prn r3
+L121: .data 870, -336, -10
+L122: .string "jppvvbiwnifqdsrq"
+jsr L308
+L123: mov #-171, r2
+L124: .data 234, -123, 62, -836
+dec L40
+clr *r1
+L125: .string "xkgbimweorskxqtystttz"
+L126: sub r2, L44
+L127: .data -884, -564, -515, -28, 533, 369, -555
+prn #71
+mov #-247, r0
+L128: .data 630, 923
+L129: .string "tldebfubrluokglyyy"
+L130: .string "qpgkbxrxv"
+add *r0, r7
+sub L308, r3
+L131: .data -804, -135, 918, 994, 271, -191
+L132: .data -497, 707, 261, -772
+L133: .string "ghsyusobw"
+lea L208, *r0
+L134: .data 545, 884, 769
+rts
+add *r2, L145
+L135: .data -31, 429, -723
+L136: mov #40, *r7
+L137: .data 50, -756, 72, 835, 740
+cmp *r5, #-175
+sub r7, L176
+L138: .string "mhvtxd"
+L139: .data -715, -376
+L140: .string "yrhu"
+cmp *r3, *r0
+mov *r2, *r2
+not r6
+L141: .data -957, -326, -756, 118, -351, 254
+prn r6
+L142: clr L318
+lea L84, r1
+mov *r2, *r5
+add L57, r3
+L143: .data -162, 795, 469, 32
+L144: .string "hsankitlietquirihsfthv"
+L145: .data 42
+L146: .string "welvgvxcerxnbmuuulqf"
+L147: .data 167, -669, -295, -656, 701, 997, -65
+clr *r2
+L148: bne *r4
+L149: .data -593, 628, -207, 165, 63, -226, -555, -231
+L150: .data 687, 45, 716, 759
+L151: .data 634, -174, -217, 701, -2, 787
+; comment
+L152: .data -822, 88, 788, -361, 42
+L153: .data -964, -551, -899
+L154: .string "paxtw"
+L155: .data 880, -527
+L156: .data -275, -701, 46, -913, 574, 630, 710, 824
+L157: .data -817, -491, 81, -413, -323
+L158: .data -295, -26, -380, -493, -628, -6, 605
+; comment
+L159: .data -97, 642, -103, 897, -682, -609, -556
+L160: .string "hclozeept"
+red L159
+L161: .data -507, -379
+L162: clr *r7
+mov #-136, *r6
+L163: .data -367, 485, 352, -718, -568, 739
+L164: .string "impmxrvodbuwmmem"
+jmp L181
+L165: red r3
+L166: .string "e"
+
+clr L93
+jsr L100
+L167: lea L46, r3
+L168: .data 239, 41, 701
+L169: .string "etsfuhx"
+mov #118, r5
+L170: jmp L17
+L171: not *r6
+L172: .string "dmjqpwzfwkgd"
+inc r5
+jmp *r3
+L173: .string "xxlbwa"
+L174: .string "nblrwhnwaueyyhc"
+L175: .string "ymuaqveqzlw"
+L176: .string "winvckzweoczaosubpubfxra"
+; comment
+jsr L206
+jmp *r5
+L177: .string "cufgtchoqj"
+; comment
+L178: .string "tjpnvcbsnaxlfuxgzbq"
+; comment
+L179: .data 249, -913, 306, -109, -984, -718, -435, -609
+prn r2
+L180: .string "ylwdjahtqwhkykiz"
+L181: .string "olhvua"
+L182: .data 401, -191, -131, 665, 646, -319, 242
+L183: .data -14, -864, -217, 486
+
+L184: .data 941, 402
+L185: .data -659, 680, 334, -469, -582, 363
+L186: .string "qcqhestiseim"
+mov r3, L246
+L187: .data -762, -168, 876, -943, -450, -195, -804
+L188: .string "iiiuqthwfmvkoweprtrwaw"
+stop
+L189: .data -309, 291, 157, 914, -371, 374, -524
+L190: rts
+L191: .data 355, -694, 390, 271, 183, -779, 327
+cmp *r5, L102
+L192: .data -444, 841, -179
+L193: .data -10, -483, -497, -409
+L194: .string "wzowoydnvlgluwywijvlxve"
+L195: .string "qddjt"
+L196: .string "tsmhdovzoinmptqdxtvdsv"
+L197: .string "bpcxumdmxq"
+L198: .string "gheazwvawss"
+inc r4
+L199: .string "mduxb"
+inc *r4
+lea L256, L326
+lea L144, r5
+add r1, *r1
+cmp r6, r3
+L200: clr *r2
+L201: .data -117, -422
+L202: .string "ppl"
+L203: .string "cpbpzmyocevnsrfcvfdgv"
+L204: .string "uq"
+lea L240, L305
+L205: .data -973, -56, -692, 590, -227, -819
+L206: .string "ryfdasbqcxczugz"
+L207: .string "kukkmsijxtcsfpnkustyp"
+L208: lea L321, r4
+mov #-94, L314
+L209: .string "enlilmprvfgklkkxxbempsvy"
+L210: .data -228, 924, -481, 289, -536, -99
+L211: .string "wgoiwmkzmhaydoqlwgfbn"
+L212: .string "kwqqmzsivrqvxfdlra"
+not r2
+not L134
+L213: .data 103, -601
+L214: .string "rqtsptmlujddfwlzioryatcf"
+L215: .string "wtjufykxmwc"
+
+L216: .string "cy"
+sub r0, r2
+cmp L63, #136
+L217: .data -266, 670
+inc r7
+L218: .data 424, 972, -130, -563, -824, -56
+add #-186, r2
+L219: .string "dytcauikgemy"
+dec L41
+L220: .data -830, 123
+jmp *r4
+jmp L279
+L221: .data -449, 142, 978, -542
+L222: .data 920, -271, 163, -761, -119, 405
+L223: .data 278, 57, 304, 148, -720
+bne *r2
+mov #124, r6
+
+jsr *r0
+L224: .string "qpqnarxkk"
+L225: lea L280, L261
+L226: .string "sjdimi"
+L227: .data 369, -847, -637, 92, -220, -481, -769
+L228: .data -4, 937, 88, -410, 483, -780
+L229: .string "vgslhewthv"
+L230: .data 416, 983
+add *r6, r4
+L231: .string "eaaelouiot"
+L232: .string "milbggjkw"
+red r4
+lea L234, *r7
+mov r1, *r2
+L233: .data -448, 419, -478, 503, -809
+L234: add #-56, *r6
+
+add #-169, r7
+L235: .string "rr"
+L236: .string "kccndkdidrbo"
+L237: .data 3, -125, 133, -322
+L238: .data 799, -396, -726, -1, -101, -541, -304, -933
+bne L111
+sub #-87, *r6
+L239: .string "bhccrcbafuc"
+L240: .data -389, 566, -565, 78, 766, 438, 998, 879
+prn r2
+L241: .string "hwphklggttfbzujmdxwtyti"
+L242: .data -636, -232, -273, -410, 498
+L243: .string "askkejghxfeexwqfs"
+inc r6
+; comment
+jsr L295
+L244: .data -762, 911, -118, -537, 558
+sub *r0, *r1
+prn #169
+L245: .data 954, 545, 49, -79, -480, -539
+bne *r2
+L246: .data -79, 530, 802
+L247: .string "ubpdymikvuzpjwnytoiblef"
+L248: jsr *r3
+L249: .string "bdifnecomdoiqxi"
+L250: .string "bftzxnsnvrsurpatbicmofnx"
+add *r3, r0
+rts
+L251: .string "cuwyrwydtzhwbysvostt"
+L252: .string "bjopdckxicrp"
+L253: .data -734, -819, -678, -797, 156
+L254: .data -398
+L255: .data 127, -94
+L256: inc L196
+L257: .string "rjiirfsaklxkkoochqs"
+L258: .data -527, 970, -429, 761, -125, 447
+L259: .data 779, -817, 123, -192, 75
+L260: .data 118, 238, -562, -239
+rts
+L261: not r2
+L262: prn r0
+lea L15, *r3
+L263: .string "xejphqkkmpzb"
+L264: .data 948, -404, 797, 593, 395, 582
+L265: .data 717, 556, 4, -452, 764, -74
+L266: .string "zppxynemsr"
+L267: .string "orwhuqiodtqzaoyqhvvq"
+L268: .string "hlfombt"
+L269: .string "eknpeqhihszf"
+L270: inc r6
+red *r4
+not r7
+jsr *r7
+L271: .string "lxhgedcb"
+L272: .string "uvotnuuqcmtmdokzzpgfryak"
+L273: .data 965, -743, -864, 312
+L274: .data -392, -366, -258, 763, 557, 605
+L275: .string "wlektubxpvluvxduinitfkuj"
+L276: .data -849, 140, 773, -363, 373, -903, -540, 145
+jmp *r2
+bne L293
+L277: .string "uujjbqaf"
+L278: .string "icvvtzvgx"
+L279: .string "bnseynaqosajpnhwswurn"
+L280: lea L212, L300
+L281: .data -444
+L282: .data -597, -637, 466
+L283: .data 318
+sub L298, L168
+stop
+L284: .string "hshtfrivcknbee"
+L285: .data 602, -36, -922, -327, 307, -865
+clr *r5
+L286: .data -176, -108, 909, -833
+L287: .data 713
+L288: .string "eqdtgb"
+L289: .data -526, -867, -126
+L290: .data 10, -827, -70, 245
+not *r3
+L291: .data 655, 83, -291, -234
+L292: .string "nilghdgadquafakjktgabjjf"
+mov L113, r1
+L293: .data -513, 162, 293, 268, -701, -876
+jmp *r0
+; comment
+bne L303
+L294: .data 387, -690, -24, -552, -15
+; comment
+mov r6, L304
+L295: sub *r4, *r4
+L296: rts
+L297: .data -484, 980, -874
+L298: jsr *r1
+prn #-28
+L299: sub #104, L120
+L300: not *r3
+clr r1
+L301: .data -776
+rts
+L302: .data -90, 466, -484, -590, -915, -300, 390, -532
+L303: .string "jt"
+stop
+L304: .string "dxbujvtzkpam"
+lea L280, *r5
+L305: .string "x"
+L306: .data -273, -46, -351, 678, 301
+L307: .string "aetdpggyi"
+L308: .string "nlvfco"
+L309: .data 616, -838
+L310: .data 527, -841, 247, 803, -26
+L311: .data 547
+L312: inc *r1
+L313: .string "qwk"
+not *r4
+L314: .string "ic"
+L315: .string "keuu"
+L316: .data 830, -824, 750, -656
+L317: .data -435, 576, 638, 232, -569
+L318: .string "bdmrvbpxsa"
+L319: .data -575, -72, 454, -54, -351, 247
+L320: .data 699
+L321: .string "tizkiupabvktpvyqpv"
+L322: .data 869
+L323: .string "dcdlwve"
+L324: .data -572
+L325: .data -660, -774, -67, 511, -26
+bne *r2
+L326: inc *r6
+rts
+jmp *r3
+L327: .string "diaoutdnqltkbghrfwlq"
+stop
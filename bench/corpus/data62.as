@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 63
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .string "rqwgqzty"
+L1: .string "clt"
+L2: .data -339, -416, 119
+red r2
+L3: .data 387, 956
+L4: .data 24, -969, 166, -35, -891, -545, -369
+L5: .string "pfbbavm"
+L6: bne *r7
+L7: .data 664, -103, -677
+clr L7
+add r7, L1
+L8: jmp L2
+L9: stop
+L10: .data 25, 77, -743
+L11: .data 270, -602, -57, 297, -264, -481
+L12: .data -992, 124, -964, -103, 222, 716
+L13: .string "e"
+L14: .data -514, -224
+prn #-236
+L15: rts
+L16: .string "ehrtykgikhubhstv"
+jmp L6
+sub *r7, L92
+add *r5, L270
+L17: .string "ylnmegqpjglfoeggp"
+L18: .data -838, 630, -946, 756, 941, 225, 165, -399
+L19: .string "kmrjrnbplxarxitwdeyehrn"
+L20: .string "qnuodzfbnupgpobuxip"
+prn r2
+lea L6, L16
+L21: prn *r4
+
+L22: .data 132, 759, 720
+L23: .data 895
+inc r0
+L24: .data 36, 159, -387, -888, 424, -61, 643
+rts
+L25: .data -363, -387, 892, -720
+L26: prn L15
+L27: .string "gjtsogztagkldmhsikjoovp"
+L28: .data -801, -457, -708
+L29: stop
+jmp L291
+L30: .string "eiprckyvlgtyzwhcdwjdd"
+L31: inc *r4
+L32: dec r1
+L33: .data 671, -760, 30, 553, 117
+bne *r7
+L34: .string "fftxzlvsycoainex"
+L35: .string "zqkedgmehbmcsrafp"
+L36: .data -771, 398, -455
+L37: .string "luzqy"
+L38: .string "tybqvmqe"
+L39: .data 725, 175, -208, 953, 878, -255, 114
+L40: .string "h"
+L41: .string "ribmupluepkjrlfmwmtw"
+prn L6
+L42: .string "sqbwrnai"
+L43: .string "fvtrjt"
+L44: .data 37, 297, -373, -370, 57, -358, 921, 888
+cmp L240, r0
+jsr *r0
+L45: .data -670, -392, 645, -342
+L46: sub *r0, r4
+L47: .data 372, 143, -590, -609, 756, 826, -393
+L48: .data 58, 259, -177, -469, -84, -843, -491, 111
+dec r6
+L49: .string "gkjpwurhbgesemtbszb"
+L50: .data 806, -223, 76, 160, 413, -725, 56, 622
+L51: .string "sluiroini"
+L52: .data -846, -825, 723, -725, -846, -411, 533, -967
+L53: .data 983, -15, -723, -449, 637, 558, -162, 633
+cmp L311, #-244
+add L38, L91
+jsr *r2
+L54: .string "o"
+clr r0
+rts
+stop
+L55: .data -60, -169, 917
+L56: .string "ffewvgdjsyiqozsyp"
+prn #-200
+L57: rts
+jsr *r5
+L58: .string "is"
+L59: .string "medtoa"
+L60: .data -455, 386, -665, -236, -569, 346, -584
+clr L17
+add r6, r5
+L61: .data 693, -919, 296
+L62: .data -359, 226, -666, -320, -19, 453, -403, -818
+L63: .data 735, 196
+L64: .string "mwrzchmrfzuaznp"
+L65: .string "wgrzbozbksccgtakfqxnycq"
+L66: .string "la"
+L67: .data -531, -451, -792
+L68: .data 632, -790, 349
+add *r7, L17
+L69: .string "ird"
+L70: lea L304, r5
+L71: .data 22, 60, 119, 282
+L72: .string "jpwbzzxswm"
+L73: .data 837, -736, -3, -774, 260
+mov *r1, r6
+L74: .data 741, -431, -582, -299, 98, 90, 130
+L75: prn *r0
+L76: .string "six"
+L77: rts
+
+prn L322
+L78: .data -181, 4, 947, 765
+L79: .data -89, 31
+
+L80: .data 182, 953, -792, 436
+L81: .data 742, -65, -835, -327, -39
+lea L154, L274
+L82: inc r0
+L83: .data 7, -60
+jsr *r5
+L84: .data -572, -895
+L85: .string "xbhlgcfjx"
+bne *r6
+add #145, r1
+clr *r2
+L86: .string "zkfihd"
+red L37
+mov L39, r0
+L87: .string "aojxjlvrxhysvlidzsgbu"
+mov #58, *r2
+L88: .string "ojmdw"
+lea L44, L23
+L89: .string "uorj"
+stop
+L90: .data -732, 612, 638, 881, -695, -466, -694
+L91: .data -45, 875, 576, 981
+L92: .string "rbcsfzypnpizdkrwmuvyt"
+L93: .string "boqrmhxmzdaal"
+jsr L227
+L94: .string "t"
+L95: .string "vsopglbbguxyfpc"
+red L317
+L96: .data -759, -334, 803
+prn *r4
+red r2
+L97: .data -120, -311, 769, 850, 764, -168, -644, -912
+jmp L136
+L98: .data -367
+L99: .string "heokksedctx"
+jmp *r2
+L100: .data 102, 283, 443, 240, -957, 324, -486
+L101: .string "zcyvvurzmafvrbclowarpb"
+L102: .string "mbcumbtaepqkec"
+red r6
+lea L200, r0
+L103: .string "oxnuz"
+L104: dec r4
+dec L40
+L105: .data -913, 247, -553, 751
+clr r6
+L106: jsr L255
+L107: .string "u"
+L108: lea L105, L161
+L109: .string "oioxejrgjmwbwyi"
+L110: .string "btgdrcwfqlpjgr"
+L111: .data 896, -532, 200, -791, -699, 792, 664, 643
+lea L174, r3
+L112: .data -433, 446, 192, 410, 406
+L113: .data 612, -236
+L114: .string "jgocmigadajgembndurajgjv"
+L115: .string "arykt"
+; comment
+L116: .data 499, -445, -423, -35, 841
+L117: .data -868, 227, 227, 380, 421, 664
+L118: .string "lczwtapmzogaclyopggn"
+L119: .data 608, -456, 987, -945, 378, 587
+L120: .data -997
+prn r2
+L121: .data 644, 934, 184, 764
+L122: .data -912, -892, -508, 549, 843, -641, 738, -264
+prn r4
+L123: .data -699, -596, 906
+L124: .string "nreepenfxiymvxmuuohoxq"
+L125: bne *r6
+L126: .string "txlorwqtetzoxqfdx"
+clr L266
+L127: .string "beetcdserslfuubaqysc"
+jmp L7
+not r6
+L128: clr L312
+sub r1, r6
+L129: jsr L54
+red L67
+jsr *r1
+L130: .string "ihl"
+L131: inc r6
+inc r1
+L132: .data -635
+L133: .data 25, -580, -657, -680, -488, 561
+L134: .string "ortywnswfebasxtsus"
+rts
+L135: .string "ionbwoabswmmvcnq"
+L136: .string "xqrrcztynfegtktleiorbe"
+L137: .string "udecrnqsp"
+L138: .data -143, 263, -816, -197
+L139: .data 368
+prn L297
+stop
+L140: .data -931, -171, 43, 318, -468, 991
+stop
+L141: .data -828, 321, 83, 905
+L142: .string "kbjdsvygcyjxbpxzvbgakrf"
+not L203
+bne L314
+L143: .string "usd"
+L144: .data -286, 147
+L145: .string "t"
+L146: cmp *r0, L149
+L147: .string "cxinjyygy"
+prn L267
+
+L148: .string "duur"
+L149: .string "ykcujqykyfuqopcg"
+add r4, *r0
+L150: .data 842
+L151: .string "hnwgprnz"
+L152: not L134
+L153: .data -394
+stop
+L154: clr *r1
+L155: .data 792, -700, 635, 357
+red L87
+add r1, r7
+add r4, r6
+lea L152, *r7
+rts
+L156: clr r4
+L157: .string "thwglcjivbcfeznqnrslzrt"
+jmp L222
+sub L35, *r2
+bne *r4
+red r2
+; comment
+jmp L241
+inc L304
+L158: .string "cmmqlhdrwvfgxkkvacxwg"
+L159: .data 990, 939, 529, 620, 613, -362
+L160: .string "ogtrfayq"
+sub #-153, L135
+L161: .string "xgkoobvmhtzfv"
+add *r0, *r6
+L162: .string "ergwlogxyioimocrze"
+L163: .data 114, -586
+L164: rts
+
+L165: .data 665, -416, -996
+L166: .string "yvmrwgvjbjqsmx"
+add *r5, L230
+L167: .data -276, -753, -691, -32
+rts
+L168: .string "xlr"
+rts
+L169: .data -343, 241, 205, 413, -286, -530, -550, -137
+L170: .data -803, -490, -72
+L171: .string "bkpfxixbjpueronwapkrxfrb"
+L172: .data 784, 619, -599, 797, -447, 422, -434, 151
+L173: .string "zfmprhvomcvthzhs"
+L174: .string "seebrorvdj"
+L175: .string "nofxlsv"
+L176: .data 357, 985
+L177: cmp r1, L151
+L178: .data 453, -762, -117, -707, -127
+sub *r3, *r4
+L179: not L312
+lea L313, *r6
+red *r4
+L180: .string "ubicgoqsomlljhhfxueyzar"
+jmp *r4
+L181: .data 770, -487, 450, -266, 967
+L182: .string "bzhmdpjulggb"
+L183: .string "nudpfzz"
+
+L184: .data -856, 284, -922, -211, -288, 166, 516
+L185: .data 494, -786, 985, 620
+prn #-61
+L186: .data 578, -803, 671, -373, 565
+L187: .data 912, 587, 963, -570, -650
+L188: .data 110, -541, -821, -90, -843, 701, -191
+prn #98
+L189: .data 515, 266, -61
+L190: .string "plsndfbgrtwxymguozzu"
+L191: .string "ghefbazyvqpa"
+
+L192: .string "woaocfqhtpfauarbfjuoxzgp"
+L193: .string "eksgd"
+L194: .string "kmhbgypuqaulaffbjzw"
+jsr *r1
+L195: .data 572, -178, 125, -838, -225, -296
+; comment
+bne *r5
+L196: .data -296, -262, 376, 117, -169, 896, 951, 652
+L197: dec L318
+L198: .string "az"
+clr *r6
+L199: .string "ppyzhczro"
+L200: .string "xzrrf"
+L201: rts
+L202: .data -199, -191, 542, 541, 343
+L203: sub L226, L61
+L204: .data 86, 422, -887, 121, -898, -616, 124, 669
+L205: .string "icfdzu"
+dec *r4
+bne L249
+add #-238, r6
+L206: .data -237, -92
+lea L187, L194
+L207: .string "exqbpwdyslvbymwini"
+L208: .data -686, -526, -223, 778, 243, -827, -303
+L209: .string "mduukzet"
+L210: .data 860
+L211: dec L45
+L212: .string "uirgl"
+stop
+L213: .string "uvqp"
+L214: .string "nbvwmiywsi"
+
+dec r6
+L215: .string "iszprbd"
+add L72, *r7
+; comment
+L216: .string "oh"
+jmp *r1
+mov #197, r1
+L217: .string "ctwwmcuyzxtrecaun"
+not *r4
+jmp *r6
+L218: .data -347, -717
+L219: .string "ttzntpigjmqnwwkeqyfbxjp"
+L220: .string "tinki"
+L221: .data 203, -10, 779, -21
+L222: .data 700
+L223: .data 736, -642, 593
+jsr L36
+L224: .string "effjvvuwxiy"
+inc L162
+inc *r4
+L225: .string "nslq"
+L226: .data 916, 326
+L227: .data -328, -220, -378, -861
+dec L281
+L228: .data -798, -962
+L229: .string "vlab"
+L230: .data 701, -54, -719
+prn L116
+mov r5, L112
+L231: .data -635, -764, -330, -979, -149, 671, 912
+L232: .string "chibefyikhxoahrtiptgd"
+L233: .string "kuzan"
+L234: .data -196, -48, -631, -556, -351, 548
+L235: .string "rfokzcnjowz"
+stop
+L236: lea L283, L294
+L237: .string "gklgiikhfv"
+prn *r3
+bne L279
+L238: .data -521, 859, 908
+L239: .string "zwtyj"
+cmp *r7, #-129
+L240: .data -632, -618, 348, 92, -437, -375, 433, -366
+L241: .string "nbyxhrrsblyl"
+prn L264
+L242: .string "vdbsnkmbrdeqe"
+L243: .string "ifxqsobsflahtgd"
+not r0
+L244: .data -65, 732, 519
+L245: .data -404, -634, 695
+L246: .string "sqamdpuvllqq"
+L247: .data -515, -307, -490, -35
+L248: .string "pcjlzvsqnayhvo"
+L249: .string "omcmjmtigiydvcviq"
+
+L250: .data 74
+L251: .data 53, 824, 375, -153, -408, -521, -769, -161
+prn L272
+L252: .data 724, -181, 44, -91, 338, 598
+L253: .string "ludlqwenyfwgxqkuh"
+L254: .string "iwammqawmrujujc"
+L255: .string "gorbmpbqtabtb"
+L256: .data 112, 470, -457, 228, -909, -618
+L257: .data 146, -282, -74, -466, 465, 343
+L258: .data 745, 485, 416, -323, -409, 544, 647
+dec *r4
+L259: .data 551, 439
+clr r2
+stop
+L260: .string "oluiremdzpehlyvty"
+stop
+stop
+
+sub *r1, *r2
+L261: .string "ec"
+L262: .data 254, 303, 853, 624
+L263: .data 974, -398, 615
+L264: .string "p"
+L265: sub r5, r5
+L266: .string "khyzov"
+L267: .string "fftrqhetypmwpubdw"
+L268: .data 706, 273, -934, 238, -366, 741
+L269: .string "qaobmwzywfd"
+red L9
+L270: .string "wqljpltkdoet"
+L271: not r2
+
+L272: .string "fatdhlxsenlurcaipiribbyn"
+L273: .string "cqcetfepxkhbrqgpsesspaeu"
+L274: .string "tnm"
+L275: .data 48, -550, 710, -661
+bne L251
+
+red *r3
+
+add L53, r7
+L276: .string "uwtlrvoelgoyk"
+inc r3
+cmp #239, #192
+L277: .string "dizdkwseoegfwqnrfbiwa"
+; comment
+L278: .data -223, 844, -807, 888
+L279: .data -548
+L280: .data 965, 222
+stop
+sub r7, L311
+L281: .string "ttmfqnpiophbhpjgshct"
+L282: .data -239
+; comment
+jmp *r2
+; comment
+L283: .string "pamyeuoleqihxuuapkgsc"
+red r3
+not *r2
+L284: .data 369, -295, -683
+add L298, L3
+jsr L213
+L285: .data 368, 515, 676, 390
+lea L286, r1
+prn *r0
+L286: .string "blfbleocurrrxpdfie"
+L287: .string "qkyvvclsovgto"
+L288: .data 581, -43, 517, 743, -729, 396, 242, 712
+L289: .string "endqkdsfgwvxfzfclvlxvfeb"
+L290: .string "pagidbkqshgtrnxn"
+sub r6, L317
+L291: .data -202, -728
+L292: .string "dzzlqdxhrxkfpedbp"
+L293: .data 223, -106, 775, 181
+L294: .data -938, -646
+jsr L301
+L295: .string "uswytnmtaapahudjhhe"
+L296: .string "obqzcwuadxpyamqppfoko"
+jsr L309
+L297: .string "wfewjizscpyitxejnalz"
+L298: .string "slcxvtdbsjai"
+L299: .string "juipgirfnfpnjxfbiuql"
+L300: .string "jwoxfbvahojgnlrhdfrwu"
+L301: clr r4
+
+L302: .data -717, 567
+jsr L304
+L303: .data -912, -670, -70, -26
+L304: .data -882, 116, 240
+L305: .string "gnmrsfcfgaekulfvdgliyudf"
+L306: .data -556, 383, 657, -105
+jsr L305
+L307: .string "awtklmtrbbjjmj"
+L308: .string "pijefcgayeayxl"
+sub *r1, L89
+L309: .string "dcrkpsqzqeyeg"
+not r3
+L310: .string "wmoaurkgvdnqxgnpswmsmf"
+cmp #2, L316
+L311: .string "hscolmwlufwrgvjmierxp"
+L312: .string "vrihpaoh"
+jmp L86
+
+L313: .data -837, 298, -269, -105, 353, -191, -178
+L314: .data -111, 518, 784
+L315: add #198, L320
+L316: .data 389, 224, -834, -121, 859, 586
+prn r7
+L317: .data -21, 350, 931
+; comment
+L318: .string "lruztmtasepyaresdx"
+rts
+sub #50, r3
+L319: .data 852, -61
+L320: .data 593, 835, -718, -283, 189, -146, 143, -884
+
+L321: .string "dzyddclijntcmhsghluobs"
+L322: .string "utvrkewy"
+cmp #-149, r1
+not *r7
+stop
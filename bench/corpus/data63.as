@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 64
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: rts
+L1: .string "no"
+L2: not *r5
+L3: .string "myaqnnveqdnolghywgrths"
+cmp *r2, L3
+L4: .string "pyazvpcnultjvkdpxbbauopt"
+L5: clr r1
+add #197, L2
+L6: .data 826, 754, -935, -207
+L7: .data -743, 370, 292
+not *r0
+L8: .data 672
+L9: .data 763, 477, -110
+L10: .string "subivmjzaitxf"
+L11: .data -493, -83, -133, -604, -608, 727
+L12: .data 898, -587, -394, 151
+add r7, *r7
+L13: .string "ezteedwreqtblurunfu"
+L14: .data 236, 701, -525, 215, 768, 238, -224
+L15: .data -297, -934, -354
+L16: .string "pscbrvalchmrmhwdhaa"
+jmp *r3
+L17: .data -341, 214, 126, -92, -791
+L18: .string "psvskguu"
+L19: .data 637, 744, 647, -482, -871, 754, 99
+L20: .data -143, -558, -49, 778
+L21: .data 473, 762, -380, 989, 306
+L22: .string "ejamndtyvzfzstgklhbmal"
+L23: .string "zookfjgbrpp"
+L24: stop
+L25: not L79
+prn r0
+L26: .string "endejku"
+L27: .data -525, 393, 107, 886, -229, -948
+not *r7
+inc L108
+dec *r5
+L28: cmp r1, #-171
+L29: .data -461, -960, -540, -898, -180
+bne L24
+L30: .data -393, 860, 564, 922, -674, 414, -489
+dec r5
+; comment
+L31: .string "mogmyhljy"
+sub r2, *r1
+L32: .data 946, 849, -916, -164, 719, 599
+L33: .string "boxf"
+L34: bne L34
+bne L16
+L35: .data 856, 389, 101, 294, 497, -721, 559
+L36: .data -851, -311, 235
+L37: .string "eanbbgslqgygtqsifx"
+L38: .string "nutxjcuoswrmqutakpcuzo"
+dec L102
+sub L35, L243
+L39: .string "xshtcuspv"
+L40: .data -467, -697, -19, -16, -953, 987, -573, 955
+L41: prn *r1
+L42: .data -427, -984, 640, -329, -279, -625, 257, -311
+L43: .string "kfbo"
+add #167, L122
+
+L44: .string "invamediejfqmgg"
+clr L150
+L45: .string "vqhnndhxphsbvobivrrx"
+L46: .string "uglzsydbvgtooulww"
+L47: .data 934, 201, -235, -911, -194, 304, 469
+L48: .data -123, -471, 906, -258
+L49: .string "or"
+L50: .data -631, 810, -300, -135, 179, -30, -745
+L51: .string "nginkbsqyg"
+red *r0
+; comment
+L52: .string "ahfjvwgqktuwcwpauwqivce"
+L53: .string "ikrmzgubomyeptodeh"
+L54: .data 110, -336, 501, -515
+L55: .string "vjwycniz"
+L56: .data 252, 152, 427, -373, -736, -890, 327
+bne L319
+L57: prn L236
+L58: .data -370
+add L293, *r1
+L59: lea L49, r0
+L60: .string "hjvsyxrpygln"
+sub *r2, r7
+clr r3
+L61: .data -874, 115, 577, 132
+mov L35, *r4
+
+L62: .string "iza"
+red r3
+L63: .string "bdynldgbudjukndu"
+L64: .data -1000, -583, 413, -501, -605, 663, -580
+L65: .data -700, -709, -44, -862, 501, -814
+L66: .data -814, -337, -257
+dec r5
+prn r6
+L67: cmp L114, L309
+L68: .data -327, 386
+L69: .data 173, 323, 410
+L70: .string "lbvu"
+prn *r5
+L71: .string "zka"
+L72: .string "gtdxjkymwtsthvyuxfys"
+L73: mov L231, *r7
+jsr *r5
+L74: .data 342, 739, -185
+L75: .data 912, -447, 713, 620, -533, 539, -360, -237
+L76: .string "ucvtzivohjtxskuwflofjl"
+rts
+L77: .string "vjhpg"
+L78: .string "mjpyyapqxorpjipejzbpzag"
+L79: .string "rtavlyveklgwi"
+L80: .data 51, -938, -675, 618, 37
+L81: .data 692, 476, 665, 68, -100
+L82: .data 474, -557, 3, 394, -833, -364
+L83: .string "w"
+L84: .string "ajvepaxqbh"
+L85: .data -701, -861, -699, 678, -138, 777
+jsr L151
+lea L210, r6
+L86: .string "sjnayjlungiafovcsdj"
+dec *r7
+L87: .string "auqforizvqawko"
+L88: .string "pstqpezjifjtcslheszdutoo"
+L89: .string "xdhnuycicaqxaypuqkdpvyp"
+L90: prn #166
+L91: .data 305, -206, 349, 912, 997, -345
+L92: .data -883, -399, -676, 209, 260
+L93: .string "phmklqsfroyiqheglnkxt"
+L94: mov L78, L175
+add *r0, L319
+L95: .string "cnndcixg"
+; comment
+dec r5
+L96: .string "nlwsuywnwzdpbkiezowve"
+red r4
+L97: .string "edngt"
+lea L52, r5
+rts
+L98: .string "muaneowcyndxdjgiosewrr"
+rts
+L99: .string "tfpudnfztrlysctstkwxlbv"
+prn L8
+L100: red *r1
+L101: .data 437
+L102: .string "zjxydgktyctenjjris"
+
+clr r6
+L103: inc *r4
+cmp #157, L142
+L104: .data -336, -423, -390, -832, 260, 244, 588
+L105: .data 843, 104, -598, -274, 469, -764, 229, 455
+L106: .data -121, 380, 589, 7, -590, -815, 833, -799
+L107: .string "uvkqoeynxlgfybewuwjkz"
+L108: .string "m"
+mov r4, *r1
+L109: .data -640, -412, 255, 542, 934, 566, -995, -425
+L110: red *r5
+L111: .string "hacei"
+L112: .string "imno"
+red L205
+L113: .string "kmegoqluzayni"
+L114: .data 234, -177
+L115: mov *r3, r0
+jmp *r0
+cmp #-150, *r2
+L116: red r2
+prn r1
+L117: lea L117, L301
+jmp L270
+L118: .data 693, 381, -616, -272, -965, 251, 751
+L119: .data -355, 973, 767, 661, -934
+L120: prn *r0
+L121: .string "diocqgtpddblagpvwjrf"
+L122: .string "tttlwevmuxjvtdzss"
+stop
+L123: .data 120, 191, 12, -909, -927
+cmp r1, r4
+L124: .string "tevspgkjjiwldet"
+L125: .data 734, -28, -284, 240, -164, 277, 935
+L126: .data -770, -934
+L127: .string "uieyrkfsgoarlr"
+L128: .data 568, -302, -670
+inc *r3
+L129: jmp *r1
+; comment
+lea L223, *r1
+L130: .string "btus"
+L131: .string "ipbzctjrarnd"
+L132: inc L155
+sub *r1, *r3
+L133: .data 141, 799, 660, -834, -213, -392, 448
+inc L17
+L134: add *r6, L96
+L135: .data 467, -844, -763
+cmp #-77, #-106
+L136: .data -415, 187, -570, 16, -657, 31
+L137: .data 936, 84, -788
+jsr *r5
+L138: .data 259, 911, 427, 864
+L139: .string "zqgm"
+mov #71, L84
+L140: .string "auzfkd"
+
+L141: .string "qwfiohyqmnhtnach"
+clr r0
+mov L23, *r2
+prn r7
+L142: .data 126
+; comment
+red *r3
+; comment
+L143: .data 380, -65
+L144: .data 804, -542, 272, 825, 918, 5, 280
+red r2
+L145: .data -731, 526, 332, -742, 840
+dec L234
+L146: .string "vmoq"
+cmp *r2, #142
+L147: .data -352, 729, -615, -218
+L148: .string "ivnuskpjks"
+inc r6
+L149: .string "qdxyrf"
+red r3
+L150: .data -995, -594, -986
+L151: .data 785, 214, 914
+L152: .string "vgunkakggpg"
+jmp *r6
+; comment
+mov r1, r6
+L153: .data 753, 750, 572
+L154: .data -689
+not r6
+L155: .data -41, -397, 170, 619, 250, -445
+L156: .string "oyumlxazhud"
+L157: .data 473, 612, 268, 398, 979, -496, -609
+L158: .data 605, 491, 731
+jmp L145
+L159: .string "dksdkomndnidbxjdkkzzg"
+bne L170
+L160: .data -423, 966, -960, 336, -261, 378, 558
+L161: .data -196, -486, -568, -80, -72
+dec r1
+L162: .string "nupwaj"
+L163: .string "qzoqnoxnvigqxjyk"
+L164: bne *r7
+inc L45
+L165: stop
+L166: .data 82, -450, -732, 145
+L167: .data 33, -789, 923, 986, -437, -33, 976, -506
+L168: .data -543
+L169: .string "cpmwpgnvjpknkjmlvrdai"
+L170: .data 682, -707, 586, -221, -587, -563, -167, -685
+stop
+L171: .data -600, 654, 352, 562
+L172: .string "vdzfuzishjbkjdanakpkqvcx"
+
+L173: .string "ejkoxphklldvwnfxvtnofcsy"
+red L260
+L174: .string "pfloljxsbtrnokpktbaingw"
+L175: .data -523
+L176: .string "yhuuocf"
+L177: .string "eqayrul"
+stop
+red L87
+L178: .string "wypmbwqtnikequoit"
+L179: .string "xvtukfeojbjwfgrfkqfmu"
+L180: .string "dftco"
+L181: .data 518, -938, 138, 985, -534, 898
+L182: .data -458, 554, -862, 873
+L183: .data 219, 138, -275, -39
+L184: stop
+
+add #167, L53
+L185: .string "bdnwtk"
+L186: .data -862, -844, 587, -90, 626, -199
+L187: .string "mjjwikcmzahd"
+L188: .string "grejc"
+L189: .data -135, 565, -970, -905, 120, -51
+L190: .data 155, 509, -787, 607, 265, -166
+L191: .data -476, -450
+stop
+dec *r5
+L192: .string "jqwxf"
+L193: .data -382, -291, -429, 608
+L194: .data -412, 695, 220, -387
+L195: .string "lwqnbzw"
+L196: .data -678, 961, -369, -471, -865, -173
+L197: .data 475
+L198: .data 672, -852, -684, -407, -469, 359
+sub #-112, *r0
+L199: .data 307, -945, 222, 410, -894, 195, -582, 523
+clr L93
+rts
+L200: .string "klzyez"
+L201: .string "mfexniubywnbn"
+L202: .string "cylkhjwlhcijrknqo"
+L203: .string "iqsux"
+L204: .data 774
+L205: .data 175
+clr L177
+L206: .string "ndnuxevoyrf"
+L207: .string "ubmn"
+L208: cmp *r4, *r3
+L209: .string "attdjaprovhnxicjrlr"
+add r3, *r2
+L210: .string "nrwxwyjsmcd"
+L211: .string "uun"
+L212: .string "p"
+L213: .string "qsunncjr"
+inc *r7
+inc r2
+lea L290, r6
+L214: .string "sjapkkdcw"
+L215: .string "okfdphwclwrdfvifxpx"
+L216: .string "pivfmybunzqed"
+L217: .data 235, 236, 216, 809, 125, 187, -218, 82
+L218: .data -7, -739, 126, 785, -283, -987, -168, -556
+L219: .data -129, 626, 537, -502, -161, -187
+L220: .data -390, 907, 795, -67, -858, 171, 465
+L221: .string "rhzw"
+L222: .data 689, -479, -909, 277, 938, 317, -505, -247
+mov #206, *r6
+L223: red L25
+L224: .string "uzocjgls"
+L225: .string "qcxx"
+jmp *r4
+L226: .string "xyxsl"
+L227: .string "vqzhhj"
+L228: .data 990, -898, -66
+jsr *r7
+L229: .data 432, -20, -898, 811
+L230: .string "ezfzt"
+add #-36, r4
+L231: .data -289, -307
+L232: .string "rcej"
+prn *r3
+L233: .data 121, 398, -517, -124, 198, -345, 164, 170
+L234: .string "exxjiietjrxagknpxmhnzxl"
+
+jsr *r7
+L235: cmp r1, L161
+mov *r4, *r6
+L236: .data -527, -1000, 813, 453, 617, 630
+L237: .string "cjhlxuatcgdjaxs"
+cmp r1, *r5
+L238: .string "xnqzdfmbvesy"
+L239: .string "yeemlsfgjjtfpc"
+prn r0
+L240: .data 573, 394, -844, 253
+sub L143, L279
+L241: .data 363, -407, 423, 290, 827, -799, 504
+L242: .data 85
+L243: .data 343, 772, -588, 146, -680, -339
+jmp L271
+L244: .string "zyuscrtvtllte"
+L245: .string "rdtlkqsscuwndzaqyj"
+L246: .string "fkeuzco"
+L247: .string "vyxspcwrtvvbggwjajay"
+L248: .data -283, 364
+L249: .data -91
+L250: .data 563, 438, 352, -734
+L251: .string "lycbehwoacevnplpqtndxfpj"
+L252: .data 350, -754, 982
+L253: .string "swuzguvjphiousatizzky"
+cmp #-10, L268
+L254: .string "hft"
+L255: .data -427, 378, -739
+L256: .string "jzyumnnxljdnhljvu"
+
+
+inc *r7
+L257: .data -236, -677, 774, -324, 533
+L258: .data 723, -353, -6
+add #-67, L268
+L259: .string "lwpcwsivohpuzwr"
+L260: .data 565, 841, -313, -318, -854, -953, -932
+L261: .string "lufk"
+L262: .string "ufk"
+cmp L56, r6
+inc L264
+L263: .data 670, -539, 558
+L264: .data 846, -383, 300, 208, -169
+L265: .data 797, 862, 726, -47, 34
+L266: .data 727, -454, 602, 849, 947
+L267: .data -387, -701
+L268: mov L276, *r6
+L269: .string "edpwsgzqzjnionejae"
+prn *r6
+L270: .data 853, -898
+L271: lea L190, r7
+L272: .data -81, -505, 626
+jsr L78
+; comment
+lea L264, L161
+L273: .string "rpvgytcrbbgdvxvuhdwzr"
+L274: .data -516, 1, -507, 589, -102, 125, 669
+L275: .data -214, -553, -287, -729, 490
+L276: .data 899, -13
+red r3
+L277: .data -707, 345
+L278: .string "fw"
+L279: .string "hnznaq"
+prn L167
+L280: rts
+L281: .data 649, -623, -561, 871, -653, -917, -82, 947
+prn *r0
+
+jmp L317
+L282: .data -231, 383, 726
+L283: .data -436, 224
+clr *r7
+L284: .data -771, 865, 34
+clr r2
+red L259
+L285: .string "ysmbzhhuewahsakbazupsgr"
+L286: .string "zid"
+add #-113, L306
+clr L309
+L287: .string "ruzb"
+
+L288: .string "hvkfc"
+L289: .string "zlhmyzcppnyw"
+red *r4
+rts
+L290: .data 475, -829, -475, 634, -658, 424, 383, 59
+mov *r3, *r4
+not r3
+cmp *r3, L315
+L291: .string "tdiljbzayzjheuhm"
+add #61, r6
+L292: .string "ibsuuoiwrnftpyvvchjkzhj"
+dec L208
+
+not r7
+jmp *r7
+prn r3
+L293: .data 172, -120, 891, 763, -41, 468, 246
+L294: .data 830, 354
+inc *r0
+jsr *r1
+clr L317
+L295: .string "crrwoxzwbmdon"
+; comment
+L296: .data 188, 400, -696, 511, 38, 483, 900, -936
+L297: .data 595, -649, -608, -876, 903, -926, -245
+L298: .string "hwvnwexrzbz"
+not L107
+clr *r3
+stop
+L299: .string "lcylwzitem"
+L300: .string "ivewgvjvsymckereatbukavr"
+L301: .string "dllicjomforhopjjraanfgz"
+L302: .string "aqwdzwhf"
+stop
+L303: bne L308
+add r4, L308
+mov r6, L313
+mov #102, *r4
+L304: .string "m"
+L305: .data -521, -933, -668, 489
+red *r3
+prn #151
+mov L150, L326
+L306: .string "mucfufxrvlittp"
+L307: .string "vpnnwjmkuldedupstc"
+add #83, *r0
+sub L215, L233
+L308: .string "hzld"
+lea L181, *r0
+L309: .data -14, 7, -995, 519, -361, -567, -101, -95
+L310: .string "qawfkqdhr"
+add r6, r3
+lea L327, L311
+L311: .data 87
+L312: .data -908, -760
+jmp *r3
+L313: .data -999, -478, -163
+sub *r1, r2
+L314: .string "uzoi"
+L315: clr *r4
+L316: .data 281, -906, 480, -388
+bne *r6
+L317: cmp *r4, L325
+sub r4, L320
+
+L318: .data 498, 526, 945, 540, -368, -813, -526
+L319: .data 587, -591, 932, -3, 185, -873, -777
+L320: .data 916, 575, -185
+L321: mov L322, r3
+L322: lea L327, r5
+L323: .data 559, 281, 785
+L324: sub #201, L93
+not L325
+L325: .string "wprlksdwlhfx"
+L326: .data -111, 179, -847, -712, 622, 402, 965
+inc L327
+L327: .data -300, -459, 981, -100, 113, 734, -269
+prn r1
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 65
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .data -288, 559, -967, 693
+L1: .string "jt"
+L2: .string "tvwfxcyevv"
+L3: .string "vhbwopiynnadbz"
+L4: rts
+L5: .string "ubkofq"
+L6: .data 262, -569, 900, 859, -648, -223, -528
+L7: .data -905, -600, -733, 651, 608, 545
+L8: .data -117, -917, -287, -620, 790
+L9: .data -803, -634, 431, -317, 114, -623, 874
+bne L1
+clr *r7
+jmp *r3
+sub *r4, r4
+mov L202, *r4
+L10: .string "lebwe"
+L11: .data -712, -974, -280, 555, 539, 784
+
+clr *r1
+dec L2
+L12: .data -812
+L13: .data 136, 198, -309, 845, -153
+L14: .data 57, 5, -785
+not L183
+L15: .data -868, 285, 814, 475
+L16: .string "waadlbipexldqqzipqpfbvma"
+L17: .data -644
+L18: .string "ksrstbvltqcmvnkmbv"
+inc L11
+L19: .data 131, -622, -61, -782, 815, -55, 770, 971
+lea L1, L281
+L20: .data 114, 486, -682
+L21: mov *r4, r0
+L22: .string "nilwxrypwhrzflksndgol"
+L23: .string "qduryeihjjyldcklhj"
+dec *r5
+L24: .string "doqfdqbzmzcdoor"
+prn *r4
+L25: .data 233, 516, -859, 167, 661, -700
+L26: .data 201, 562
+L27: .data 439, 663, 265, 751, 16
+L28: .string "bdgeqyrevjgjoptnjfgz"
+L29: .data -739, 375, -334
+bne L11
+L30: .string "mmmgfsyrv"
+inc L0
+L31: .string "fsvsmzeerrtx"
+L32: .data -780, -163, -387, 869, 12, -398, -375
+L33: .data 430, -263, 546, -420, -521, -829, 988
+L34: .string "vwc"
+not r4
+L35: .string "cpxvgvdpbcjbchsyv"
+L36: .string "frjrxbkqkgaigymdo"
+red *r5
+
+inc L6
+L37: .string "hgnvcgdumbjsbej"
+jmp L92
+L38: .string "tjeietnyfnd"
+rts
+L39: mov L11, *r2
+bne *r0
+L40: .string "rjdlrmgaoxanuhrejeyghqz"
+L41: .data 287, -838, -820, -336, -714, -836, 948
+L42: .data 583, -710, -546, -863, -454
+L43: .string "lczylrbfonmfyfchiwhtngfj"
+stop
+L44: .string "gcwycxaoovwwpfswalkfsy"
+lea L30, r2
+prn r6
+L45: .string "hdcfkveqotjusy"
+cmp #116, #45
+L46: .data 76, 916, -698, -442, -342, -374, 172, 684
+L47: .data 585
+L48: .data 633, 538, 324, -521, 885, -812, -708
+jsr *r6
+L49: .data -766, -659
+L50: jsr *r2
+jmp L46
+prn *r2
+L51: .data -641, -211, -561, 108, -751, -907
+inc *r2
+prn *r5
+L52: .string "dpsgcyrkjhkmq"
+L53: .string "cr"
+L54: .string "vblvoypgkw"
+cmp L9, L314
+red L179
+L55: .data -267, -520, 717, 244, 979, 316, -684
+L56: .string "alatnmjqpq"
+prn r2
+L57: .string "llginfpsgmplcuapyw"
+L58: .string "niaiguz"
+lea L25, r2
+L59: not *r3
+L60: .data -120, -132, -213
+add *r0, *r4
+L61: cmp L109, L11
+L62: .data -31, -351, 64, 916, 619, -112, 571, -118
+L63: .data 464, -783, -18, -946
+L64: .string "xvetipaeptjgcaozl"
+
+L65: .data 951, 712, 671, -137, 736
+L66: .data 60, -320, 690, 968
+L67: .data -681, 235
+L68: .data 156, -527
+L69: .data -299, 962
+L70: .string "lqtnzxqoww"
+L71: .string "z"
+not *r4
+L72: .data 276, 460, 736, -842, -989, 41
+L73: .data -96
+L74: dec r7
+inc *r3
+clr *r0
+
+stop
+L75: .data -312, -813, -775
+L76: .string "xsxya"
+prn #-13
+L77: .string "rxumialaesuzkdzsmzdz"
+L78: .data 199, -866, 682, -320, -510, 129, 276
+L79: .string "euaktiacruhvbbbu"
+L80: .string "oukfmxmzhhacyjnyhyaforjp"
+L81: .data -900
+L82: .string "pezsnenphxll"
+L83: .string "ddpdjzebmzabqvjezhfrsix"
+L84: .data 984, -437
+sub #127, L72
+L85: .string "vdsofzpkzpwgbkfihj"
+dec *r2
+L86: .data 205
+L87: .string "mohpphhykeljnmmavykna"
+L88: .string "hlnvnrmtdcaq"
+
+L89: .string "jliyxchom"
+L90: .data -236, -972, 934, 252
+red *r2
+L91: dec r7
+L92: .string "izesaibciybo"
+L93: .string "stp"
+prn L76
+L94: .string "zxknwwlmvoxsdc"
+not *r3
+L95: .data -209, -877, 570, -407, 399, -796, -983
+L96: mov L22, r5
+rts
+L97: .data 369, -55, -739
+L98: .data 69, -992, -204
+L99: .data -842, -234, 918, 147
+; comment
+L100: .data -642, 318, -76, 269, -680, 945, 224, -860
+L101: .string "nakkucalrcftnlfeawocqptx"
+L102: .data -160, -805, 410, -129
+L103: .string "lapfnuwhjlidekqacvw"
+L104: jmp L99
+L105: .data 267, 631, -181, 219, -272, 307, 655, 508
+L106: .data 198, 890, -19, 208
+L107: .string "ofvgkvrfnllbdxvusct"
+L108: .string "cqfurscrpbqdbtkiqucamci"
+rts
+L109: .data -949, -924
+L110: .string "loflhtyg"
+L111: dec *r7
+L112: .data -783, -960, -20, -342, -193, 811
+L113: .data -393, -241, 634, 888, 837, 781, 601
+L114: mov #-188, r6
+dec r4
+jmp L7
+L115: .string "kqwylgwrqckgzbco"
+prn #-120
+; comment
+mov *r4, r6
+L116: .string "tcfwbxycmapaoeigey"
+L117: .data 900, -932, 833
+L118: .data 431, 279, -318, 528, 551, -50, 639
+prn r3
+L119: .data -705, -851, 161, -823, 68
+L120: .string "ngqcbnepeivqqsavk"
+dec *r0
+L121: jmp *r0
+L122: .string "ddiqcoltgatdideahrlte"
+L123: .data -648, 112, 683, 713
+red L74
+cmp r1, r5
+rts
+L124: .string "ncybzbkahojto"
+dec *r6
+L125: rts
+sub r0, r4
+L126: .data 234, -918
+L127: .data 151, 652, -610, -695, -646, -220, -128, 4
+red r0
+mov L24, *r6
+L128: .string "j"
+clr *r5
+L129: .string "osjrw"
+L130: .string "qesmxqpdrngbwu"
+
+not *r4
+L131: .string "vhijmevqxfnockuczqhzjyy"
+L132: .data 306
+L133: .string "bsl"
+L134: .data -68, 522, 406, -245, 104
+mov #240, *r4
+L135: .data -362, -639, -270, -822, 54, -938, 175, -117
+L136: .string "vaja"
+L137: .string "oeafp"
+L138: .string "fazdbcltyfpvsqgvmkcgatc"
+jmp *r0
+jsr L246
+
+L139: mov r2, r3
+sub #50, r6
+bne *r2
+L140: .string "jcndbpiiwpcvcuyljuvn"
+L141: .string "hqtcfosvcf"
+L142: .string "iyyuo"
+L143: clr L311
+prn L224
+L144: .data 844, -287
+L145: .string "mzkdiwgxucscgoakdwybz"
+red L306
+; comment
+L146: .data -965, 151, 398, 565, -605, 389
+L147: .string "gjhioozhvkfnbuh"
+L148: clr *r0
+L149: .data -145, -729, -762, 67, -224, 516
+L150: .data -32, -296, -75, -598, 80, 999, 461
+L151: .data -346, -563, 563
+L152: .data -85, -586, 589, 830, -489, 887, -751
+L153: .string "vvhwkgjqulgdfthbqfimpv"
+L154: .string "axllrtkfcuyoaglycbzsageh"
+L155: lea L275, L204
+L156: .data -251, -819
+L157: mov *r6, *r0
+L158: .data -669, 608, 326, -36, -260, 482
+add #-237, L183
+L159: .data -938, 163
+L160: .data 63
+L161: .string "smguqgradnxjojvwxkdv"
+jmp *r4
+cmp r4, *r4
+L162: .data -491
+L163: .data 210, 921, -440, 605, 890, -929
+L164: jsr L289
+L165: .data -520, 820, -108, -222, 127, -94, -942
+lea L224, r5
+
+L166: .string "bszkuotcfdr"
+L167: .string "dzcmhwgrqyat"
+L168: .data -558, 342, -556, -842, 785, -206, 162
+L169: .string "ltywzgpd"
+L170: .data 282
+L171: .string "deteeqmxoudxamxprmrgafv"
+L172: .string "clmmfvfzlpfwertwxhu"
+bne L172
+cmp #-40, *r7
+red r3
+mov r1, *r2
+L173: .data -42, -140
+L174: stop
+L175: .data 979, -870, 653
+L176: .string "qmzamlnomhww"
+L177: .string "vn"
+L178: .data -221, 131, 330, -243
+L179: .string "exjjvkawwudznlukyr"
+L180: .data -733, 68, 469, 905, -581, 649, 87
+bne *r4
+L181: .data 969, 239, -944, -730, 764, -997
+rts
+L182: .string "f"
+L183: .string "gkmvxkxemeklcjwpntz"
+prn #-113
+L184: .data -732, 125, 866, -750, 347, -388, 365, -48
+L185: .data -971, -27, 502
+jsr *r7
+rts
+L186: sub #-142, *r7
+jsr L245
+mov #-62, *r4
+L187: .string "vj"
+L188: .string "oiorflluiaoirlsyfcnamjd"
+L189: .data -404, 68, 381
+L190: .data 970, -884, 47, -68, 869
+L191: .string "ecbiuifftfbrqy"
+L192: .data 395, 862
+L193: .string "slhwi"
+red *r4
+L194: lea L304, L254
+L195: .data 45, -453
+L196: .data 828
+mov *r7, *r6
+L197: .data -79, -385, -91, 850, 578, -950, 838
+L198: .string "ehevedevcxobyk"
+L199: .string "pwomszfkfocccqtvxiurvobl"
+
+lea L256, L15
+L200: .string "sqonpbwivlnfnaqslriucsvl"
+L201: .data -823, 339, -822, 318, -678, -897, 472, -703
+rts
+bne *r0
+L202: .data -715, 236, -685, -373, 59, -362, -755, 674
+add *r3, r6
+add r4, *r4
+L203: .data -803, -153, -436, -118, 327, 519, 269
+; comment
+L204: .data -119
+L205: .string "onnaxhtsfrilbwnnxhzcwyh"
+mov *r4, L77
+L206: .string "cmnql"
+; comment
+L207: .data -907, -962, -195, 500, -781, -390, -548, -695
+L208: .data 466
+lea L260, *r1
+L209: .string "uytodfvbmeboupzatryovmia"
+clr L303
+L210: .string "gjwcazsjluteqbubflai"
+L211: .string "jkixkvhehnsc"
+L212: .data -807, -60, 797, 74, 48
+L213: dec *r2
+L214: dec *r3
+L215: .data 696, 573, -274, -750, -912
+L216: .data 919, -274, -53
+L217: .string "nrlp"
+jsr *r3
+L218: .string "vibusmrdikpbz"
+not r7
+clr r2
+jsr L236
+L219: .string "klnbjddk"
+stop
+L220: .data -488
+L221: bne L249
+L222: .string "tinhenyfsjpm"
+L223: .data 104
+L224: .string "slynkymmtzoodqgxhkz"
+inc r7
+L225: .string "lbjqir"
+L226: dec r1
+red L111
+lea L33, *r3
+L227: .data 628, 954, 155, 387, 585, -794
+jmp L254
+stop
+L228: lea L194, r0
+L229: .data 477, -978
+L230: .data -980, 542, 200, 147, 379, 415
+rts
+; comment
+L231: .string "bndbcvic"
+clr r0
+mov r4, L68
+L232: .string "jwlysbsrxextkixpqxbbg"
+prn *r5
+add L119, r3
+mov *r4, *r4
+stop
+L233: .data -696, 670, -28, -730, 171, 708
+not r0
+sub L301, r6
+stop
+L234: .data 461, 89, -562, -872, -146
+
+L235: .string "rgmwvnkxw"
+L236: .data 826, -559, 641, 288, 719, -413, -799
+L237: .data -972
+L238: cmp #3, *r0
+L239: .data -13
+L240: .string "sbwolidjoxozx"
+L241: .data 199, 847
+L242: .string "swwtvdfohitlpaqfbziz"
+L243: cmp r6, r0
+
+L244: prn *r7
+L245: .data 911, -614
+not *r4
+L246: .string "enyccmue"
+mov *r7, *r3
+L247: .string "ijsiuocuzxvuibso"
+L248: .data -853, -747, -105, -573
+L249: .string "fqd"
+L250: .string "dfzodshxtjamlxeur"
+sub r5, *r6
+L251: .data -610, 298
+L252: .string "ycfpnh"
+rts
+L253: jmp L196
+add *r4, r4
+L254: lea L82, L284
+; comment
+L255: .data -618, 888, -567
+L256: .data -498, -190, -401, 226, -219, -331
+L257: .data 103, 721, 726, 832
+L258: .string "peraavclntbvpwxsur"
+L259: .data -437, 146, -812, 570
+rts
+L260: .data 193, 64
+bne *r5
+bne L312
+L261: .string "tsumaxhovidcmtmoaiixkrqn"
+clr *r7
+L262: .string "xnzgjuxlueamekakealybu"
+L263: .data -932, -145, -578, -329, 40, -163
+L264: .data 592, -281, 786, 894
+cmp *r1, #113
+L265: .data 879, 684
+L266: .string "swglrn"
+jmp *r5
+L267: .string "dhihnhznftkz"
+L268: .string "kgsknjxkspsqlvoduncvhfly"
+clr r3
+L269: .string "tqs"
+L270: .string "bpqujtihld"
+rts
+L271: .string "qoqupoyzqniltjyol"
+mov r4, L307
+L272: .data -820, 179, -104, -990, -664, -426, 297
+L273: .string "xiyjsvopipo"
+L274: .string "zrozrvikp"
+clr r6
+jsr *r2
+L275: .data 177, -736, 20
+red *r2
+jsr *r3
+bne L318
+L276: .data 169, 679, -18, 129, -243, 279, 436, -84
+L277: .string "tprcjvdto"
+L278: .string "dpfyhzbmnywfcheajbozt"
+jsr L286
+L279: .data 677, -713, 908, -685
+L280: .data -829
+L281: .data 881, 346, 960, -419, 560, -354, 179, -412
+L282: .data 715, -793, 333, 75
+cmp *r6, L304
+L283: .string "rqpmu"
+not L173
+L284: .data -553
+L285: .string "yeq"
+prn #-25
+bne L90
+L286: .string "phrifuamnva"
+mov #80, r7
+L287: rts
+bne L149
+jsr L296
+L288: .string "xywmfwcxsxscvdtotylhmd"
+cmp r6, *r2
+not r2
+L289: .string "m"
+L290: .string "yt"
+add r1, *r2
+L291: .data 938, 181
+jmp L252
+L292: .string "olgnqlghiaxcxakkwexir"
+red *r2
+L293: lea L297, *r5
+L294: .data 601, 737, 383, 702, 550, 254, -153, 250
+
+L295: .string "twajkdnlz"
+dec r1
+cmp #-201, L182
+L296: .string "dpklhyjtloteopsj"
+mov #55, r6
+mov #47, L265
+add r4, L173
+L297: .data 678
+jmp *r7
+inc r3
+mov *r6, r3
+L298: .string "kfjcetqgspzkvdr"
+L299: .string "mnzrhzja"
+L300: jsr *r0
+L301: .data -898, -23, -395, -45, 411, 217, 312
+L302: .string "qtprjlxwyxtzibioopuosahn"
+red *r3
+L303: .data 14, 109, -156, -821
+L304: .string "muiiptieeq"
+L305: .string "nuha"
+L306: .string "rchfrmuqbgzabug"
+L307: bne *r3
+L308: .string "irammflifxsugmvrrcsra"
+L309: .string "jhukxpfi"
+L310: .data 741, -563
+L311: .string "glfpz"
+L312: .data 957, -204, -536, 606, -237, 947, -908
+cmp #126, L318
+L313: .data -388, 963, 439, 239, -575
+L314: .data 800, 465, -268
+jsr *r7
+clr L318
+L315: sub #-137, L320
+L316: .string "dirzqtt"
+L317: rts
+L318: .data -332, -653, -786, -594, -864, 610, 359
+L319: clr L320
+L320: .data 794
+L321: .data -240, -790, -459, -722, 75, 14, -488
+L322: lea L323, *r4
+L323: clr *r2
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 66
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+jsr L37
+lea L0, r7
+; comment
+
+L0: .string "ohez"
+
+L1: .data 86, -152, 356, 249
+L2: inc r2
+; comment
+L3: .data -225
+L4: .string "pedlnvi"
+L5: .data -201, 900, -508, -853, 854
+L6: .string "cwmdjjkqfngwqnxy"
+L7: .string "eajkwrptp"
+L8: .data 815, 682, -29, -269, 684, -492, -315, 775
+red r3
+rts
+clr L4
+L9: .string "netnhryaydzenrpen"
+L10: jsr L65
+L11: .string "cwnzu"
+dec *r0
+L12: rts
+L13: .data -577, 174, 621
+L14: .data -505, 72, -446, 823, -2, -261
+L15: .data -299, 71, 998, 208, -972, -206, -507, 62
+L16: .data -570, -314, 404, 94, -129
+L17: .data -448, 717, -891, 716, 849, 208
+prn r2
+stop
+L18: .data 228, -620
+L19: .string "aj"
+L20: .string "w"
+L21: .string "mucsukkcwbfhjzkhfwr"
+inc L21
+inc L64
+stop
+
+L22: .data 283
+L23: .string "hprvqcnzptq"
+L24: inc *r4
+L25: .string "dybfnbuxi"
+jsr L16
+L26: .data -678, 110, -365, -992, -245, -801
+L27: .string "qkswevjnnyrquckrcoolu"
+L28: .string "ux"
+L29: .string "yqlv"
+cmp r3, r4
+L30: .string "zldzzcwzfojcqmtfnykmo"
+; comment
+L31: .string "vayfigrrm"
+L32: .data -594, -419, 963, -182, -872, -270, -516, -946
+dec L227
+L33: .data -486
+L34: .string "csuscjmzzrxzilbedyeteey"
+L35: .data -994, 221, 790, 124
+inc r2
+inc L15
+red r1
+L36: .data -462, -332
+L37: .string "jihqktx"
+L38: .string "t"
+L39: .data -139, 181, -189, -495, 246, -561, 159
+L40: clr L285
+red r2
+sub r3, *r1
+L41: .string "ntbqjwtqvl"
+L42: stop
+L43: .string "hzwmiexyxykzwxmkwx"
+L44: .string "ksgymvyrwjxligvqx"
+lea L3, *r3
+L45: .data 755, 1, -152, -121, -947, 749, 296, -685
+L46: .data 421, 148, -581, 354
+L47: .data 493, -696, 76, -280, 689, -256, -583
+L48: prn r3
+sub *r4, L272
+L49: .string "gijpvowuz"
+L50: .data 665, -33, 625, -499
+bne L46
+L51: inc r5
+L52: sub r1, L40
+L53: .data -639, -485, 786, -977, -419, 323
+lea L16, L38
+L54: dec r0
+lea L266, *r4
+add L19, L26
+L55: .data 139
+stop
+inc *r0
+bne *r6
+rts
+L56: jsr *r7
+sub #-139, L279
+L57: .data 766, -370, -188, 318
+L58: .string "xcxggsrukgxoo"
+jmp *r5
+L59: .string "gbtpcpotomppjwtjvlw"
+L60: .string "etpkwxf"
+L61: .string "elyvptspnsnfg"
+red r7
+cmp *r3, #-101
+L62: .string "dfpcrwplprxfvhwnqhdyxa"
+mov r6, *r3
+L63: .string "pyy"
+L64: .data 492
+L65: .string "tzowihrpuafwi"
+L66: .data 205, -22
+L67: .data 836, -976, 601, -979, -788, -849, -221
+L68: .string "bmxj"
+L69: .string "lohyr"
+L70: .string "knmnioeqgiwqbkybajwb"
+L71: .data -300, 938, -492, 13, -11, -888, 440, 23
+L72: .data -214, 480
+clr *r5
+clr L25
+L73: .string "fxtlbzvktrlaosw"
+L74: .string "mawmgcxxgurqoutaysio"
+L75: .data 949, 717, -283, -847
+L76: jsr L45
+L77: .data 212, -313, 184, -609
+L78: .string "rmjzcqgp"
+L79: .string "uyfdr"
+L80: .string "zrgfxmfphquuqntruaasdfeg"
+L81: .data -952, -632, -534, -597
+jsr *r4
+L82: .data 726, 423, -230, -728, -621, -140
+add r5, L149
+rts
+L83: .string "arcpxweqvndwxoto"
+; comment
+lea L114, r3
+add r4, r5
+L84: not L44
+L85: cmp *r1, #37
+
+rts
+L86: .data 724, 31, -647, -572
+jmp *r2
+cmp L278, #209
+cmp *r2, L81
+L87: .data 333, 822, 967, -563, 115
+rts
+L88: .string "vuerauqkewnmdxibjzg"
+L89: .string "suvlbkcifukiaainyeqm"
+lea L122, r3
+L90: .data -555, 202
+L91: .data -436, 594, -439
+sub #-128, r3
+
+L92: .string "mafxhtxfzklojujylljxany"
+lea L6, *r1
+L93: .data -281, -380, 536, 752, 250, 898
+lea L55, r0
+sub #52, L215
+L94: .string "guze"
+L95: .data -96, 33, 760, -927
+L96: .data 176, 17, 266, -168, 564
+inc *r3
+; comment
+L97: .data 983, 296
+L98: .string "gwx"
+L99: .string "rnyyg"
+L100: .string "wevfsmaanxzjwckbrutfb"
+bne *r3
+jsr *r4
+dec L209
+L101: sub L16, *r3
+L102: .string "luhijbmc"
+L103: .data -237
+L104: .string "browbzgjr"
+L105: .string "zykmczl"
+L106: .string "ugtmbnzkokfgewvbccn"
+L107: .string "lkjwpkgizdwabswydgemtq"
+add r0, *r7
+add *r7, L51
+L108: .data -832, -295, 858, 913
+L109: .data 253, -956, -806, 39, 125, -131, -799, 281
+L110: rts
+L111: .data 326, 804, -922, 347, -2, 975, 14
+L112: .string "uhsnnafevyicerubyipwqpqq"
+L113: add L184, *r2
+cmp *r0, *r2
+L114: .data 664, 837, 723, -748, 647, -541, -614, -124
+L115: .data 347, -592, -14, -249, 813
+L116: .string "rbuynbmijocjq"
+L117: .string "lgngjgtryxsdmqvx"
+L118: .string "dukjxgsexfgafovsvoekl"
+bne L149
+add *r5, L169
+L119: .string "ehfib"
+L120: .data 865, -609, 331, -809, 829
+L121: .data -600, -682, -901
+rts
+L122: .string "lyxaucjpxprobrzoazeicgnn"
+L123: .string "sncsyzbzledqfbgwk"
+L124: .data -635, 362
+L125: .data 611, 487, -511, 407, -872, -267
+L126: .data 710, -315, 427, -844, -755, 489, 807, -421
+bne L3
+L127: .string "l"
+L128: .data -395, 706, -782, -557, 292, -787, 925
+prn #20
+L129: .data 440, 389, 39, -642, 499, -654, -465
+lea L38, *r6
+L130: .string "ieqrvcmniz"
+mov L81, *r4
+L131: .data -766
+cmp r0, r7
+cmp L232, L295
+L132: .data 204, 9, -958, 123, -119
+L133: .string "dhzaetbhfb"
+L134: .string "tb"
+red r3
+L135: .data 339
+L136: .string "rannveftpgclimxpwzvbat"
+L137: .string "dfzxvevkgnadk"
+L138: .data -529, -9
+jmp L230
+L139: .data 374, -578, -572, -743, 809
+L140: .data 946
+L141: .data -332, 623, 278, -650
+L142: .string "imcdhloq"
+L143: .string "nwxmiuwkf"
+L144: .data 451, -924, 531, -718, 728, -960
+lea L309, *r1
+L145: .string "et"
+inc *r5
+bne *r0
+L146: cmp r4, r3
+stop
+
+L147: cmp #-162, #123
+L148: .data -33
+L149: .string "f"
+prn r3
+lea L14, r6
+lea L252, L159
+L150: .string "qbaajdaatazdvdzxmbge"
+sub *r2, r7
+L151: .data 310
+L152: .string "erwaiqbejwphjai"
+L153: .string "zjwtpqzwknpuelami"
+L154: .string "qqmhnon"
+L155: red r2
+mov L147, L154
+L156: dec L173
+bne L87
+L157: .string "sdxqy"
+L158: .string "npaomdujymhoovuqcfxp"
+L159: .string "fiiuhwcqjnkohvoznrdrct"
+L160: .data 888
+L161: .string "tdovljs"
+; comment
+bne L68
+not L122
+jsr *r4
+cmp #-96, r3
+red *r6
+L162: .string "nbblknvte"
+L163: .string "yfwaneixsjt"
+L164: .string "lmtsq"
+L165: .string "fsatkrujycachp"
+L166: .data 907, 434, 177, -194, -999, -617, -144
+L167: .data -468, 65, -543, 468, -175, 458, 361
+L168: .data 270, -942, 862, -317, 618, 364, -197, 635
+L169: .string "bjfymfzrcwhy"
+L170: .string "ykdgh"
+L171: .string "czevaisnbmspqbuodpztk"
+L172: .data -34, 2, -444, -370
+L173: .string "sieirvdjtvzhbcifffj"
+L174: .data 511, 286, 199, -209, -224, 85, 852
+L175: not r0
+L176: .string "fh"
+L177: .data -392, 675, 367, -473, 95, 705
+sub r6, L199
+rts
+L178: .string "iugjyukhdnsn"
+L179: .string "ecujzmdilznzptxpurkou"
+L180: .data 205, -527, 181, -347, 998, 138, 824, -840
+L181: .string "gkemlqwddna"
+L182: .string "ihfcwdq"
+L183: .data 578, -94, 530, 331, -429, 894, 529, 694
+L184: .string "vgnvuayf"
+L185: inc r1
+L186: .string "iefubgpe"
+L187: mov #115, r5
+L188: .string "jolgfsv"
+inc r0
+L189: .string "iyzswtptsddpi"
+add *r4, *r5
+L190: .data -235, 474, 120, -957, 313
+L191: .data 3, 349, 741, 515, 833, 522, -251, 269
+L192: .data -686, -790, -815, 698, -52, 259, 950, -180
+dec L219
+L193: .data 371, -738, -208, 299, 883
+L194: cmp #-131, r1
+prn #-7
+L195: .data -699
+L196: .string "ffkeisjipsdnhmlxddl"
+L197: .data 52
+L198: add *r4, r1
+L199: .string "ngfojanfemuvbyk"
+sub r7, *r0
+L200: .string "stvusgwe"
+prn #173
+L201: .string "bnahmoeoii"
+L202: .string "pedktychhmysxgravutvqc"
+L203: .data 564
+L204: add *r6, r6
+bne L198
+L205: .string "zofrlydhaaelwms"
+L206: .data -915, -608, -802, 972
+lea L201, r5
+L207: .data 159, 676, -322, 275, -987
+prn #178
+L208: .string "xgntmgr"
+L209: .data 247, 937
+L210: .data -283, 539, 539, 908, -87
+L211: .string "ioqbzkmr"
+L212: .string "hrbhprpgxlovztsamjmc"
+rts
+L213: mov *r2, r3
+L214: .data 545, 840, 100, -923, -226, 345
+L215: .data 393, 113, 754, -492, -617, -233, 906
+cmp #-197, L73
+L216: .string "ercvi"
+L217: .data -977, -903, -216, -171, -25
+L218: .string "advdczjwxbnytr"
+bne *r5
+L219: .string "kanapfpdplerfcfja"
+L220: .data 857, -342
+L221: .string "otnplcr"
+not *r4
+L222: .string "wrlzputovmvboqhfculqt"
+L223: .string "lxhudcqtcpdfbuihrtwlz"
+L224: jmp *r7
+L225: .data 755, 400, -644, 68
+L226: .data -917, 229, 205, -90, 232, -362, -968
+L227: .data -414, -20
+L228: .data -782, -187, 993, 494, -345
+L229: .data -909, 150, 650, -900, -135, 234, -42
+stop
+L230: .string "wopwxvbmggvqzdgocmh"
+L231: .string "yghrahqwqary"
+add *r7, *r0
+L232: .string "yw"
+L233: .data 70, -227
+L234: .string "jtbbsfae"
+L235: .string "bwzmogdyrmxjdaf"
+rts
+L236: .string "eptxcrrnbzimowjnpw"
+dec L246
+sub #102, *r2
+inc r5
+L237: .data 313, -166, -933, -932, -653, -764, -104
+L238: .data 866, -583, -133, -819
+prn L280
+L239: .data -763, -878, -998, 225
+not r4
+; comment
+L240: .string "zgvmdcrolnghatwrqdn"
+L241: .string "gt"
+L242: .string "b"
+L243: .data -147, 93
+L244: .data -658, -399, 356, -174, -65, -848, 278
+clr L268
+bne L34
+; comment
+L245: .data -217, 794, -342, -307
+L246: .data -346, 382, -432, -158, -336
+L247: .data 921, -403, -345
+not L311
+L248: .string "goihzjqhh"
+L249: .string "lksplbcldwzjvoyoqqvj"
+prn *r2
+L250: .data -503, -428, -919, -982, 315, -804, 291
+L251: .string "soahmdramdq"
+L252: .string "mbcdnwnlgujxmzaioeauf"
+clr *r5
+clr L106
+L253: .data 965, 192, -977, -685, -64, 27
+L254: .string "juszdrgcwklgkgsnudpxfdv"
+L255: .data -649, -26, 600, -450, 547, -350, 673, 149
+L256: .string "cznmmlvyqodwtgmiurmkacs"
+jsr *r3
+rts
+
+L257: .string "t"
+lea L147, *r2
+mov #-112, *r5
+L258: .data 639, 798, 351
+sub L172, *r3
+L259: .string "sozrucrvjzoepurlqzzx"
+not *r6
+add r7, r4
+mov *r0, *r1
+
+; comment
+; comment
+L260: rts
+red *r2
+cmp L136, #156
+L261: .data -864, -124, -696, -306
+L262: lea L150, r1
+L263: .data 847, 119, 221, -124, 480, -305, 123, 710
+sub L22, L145
+L264: .string "pnqwmiyhwrcgjqx"
+L265: .string "rraaznrkghsis"
+L266: .data 315, -480, -848, 629
+L267: .string "huxpvoedt"
+L268: .data -123, 204, -360, 185, -744, -245, -466, -978
+L269: inc L197
+L270: .data -963, 388, -818, -569, 953, -388, -291, 775
+L271: sub L308, L287
+; comment
+L272: .data -789
+cmp r3, #-196
+sub r4, r4
+L273: .string "fbiiklpsjd"
+sub L5, L104
+clr L314
+L274: .data -744, -975, 932, -584
+L275: .data 867, -625, -368
+L276: not L280
+red *r0
+L277: .data 886, 252, 952, -514, 936, -961
+dec r4
+inc r4
+L278: .data 223, -864, 91, 596, -335, 440, -528
+L279: .string "goqu"
+
+L280: bne *r1
+L281: .data -972, -52, -47, -592, -883, 0, 529, 975
+
+mov *r5, L304
+bne L305
+stop
+L282: .data -323, 227
+L283: .string "ciphzh"
+
+red L299
+L284: .string "xa"
+L285: .data 870, 799
+L286: .data -902, 773, -699, -47, -776, -128
+
+; comment
+; comment
+L287: .data 282, -289, 133, 245, 620
+not *r5
+red L321
+L288: .data 135, 32, -437, -546, 828, -978
+L289: .string "bocfbqxuybrqzoeqkispyzdw"
+bne *r5
+L290: .string "ngytyxxoyvdhyxnpbzzepy"
+cmp r4, *r3
+L291: lea L13, *r0
+bne L121
+L292: .string "vzeddemkzm"
+L293: .string "sqlirpetfcupbwchj"
+L294: .string "nlxy"
+clr r5
+L295: .string "lknvurbfpntknmrdy"
+L296: .string "ep"
+L297: .data -493, -626, 541, 837
+not L104
+clr *r2
+jmp *r5
+L298: .string "gfoggoqkuv"
+L299: .string "iqkbolssictflvsbyxxujih"
+L300: .data -856, -803, -908, 160, -359, 146
+red L320
+L301: .data 799, 60, -994
+L302: .string "yesbmfj"
+prn *r0
+L303: .data -800, 20, 185, 558
+L304: .string "pjtfm"
+not L312
+L305: add L33, *r4
+L306: not r2
+L307: jmp L41
+L308: .data 371, 453
+L309: .data -1, 822, 21
+inc r4
+L310: .data 493
+L311: .data -597, -6, 985, 768
+L312: add #6, *r2
+L313: .string "oyomzydrxkwxuxgxtnutaor"
+rts
+L314: .string "yoi"
+L315: .data 823
+not r6
+L316: inc r2
+L317: .data -466, 695
+stop
+L318: .data -775, -490, -378, 412, 11, -52, -143, 959
+L319: .string "rezkedvqhpr"
+L320: .string "wgh"
+; comment
+L321: .data 740, 139, -591, -706, 777
+; comment
+stop
@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 67
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+L0: .data 561, -819, 417, -854, -102, -48, 872
+L1: .data 523, -318, 309, -727, 464
+mov L1, L0
+bne L112
+bne *r3
+rts
+L2: .string "dvtocishse"
+not L0
+L3: .data -786, -842, 260
+L4: .data 386, 514, -844, -261
+L5: .string "doxo"
+L6: .data -705, 367, -308
+L7: .string "reyapwpf"
+L8: .string "my"
+L9: lea L215, *r1
+dec r1
+
+L10: mov L287, L2
+L11: .string "jepl"
+bne *r0
+jsr *r7
+L12: stop
+L13: .data 479, 250, 327, 394, 205, 69
+L14: .string "lzosrlinnt"
+L15: .data 870, 809, -514
+L16: .string "whhnmlwcaqbilhtqjkozsha"
+lea L11, *r7
+L17: .string "tnzs"
+L18: .string "gfxrwzdebsatpwok"
+not *r5
+L19: .string "bvohibxjsr"
+L20: clr *r0
+dec r5
+inc *r4
+mov *r6, *r3
+
+L21: .data 609, -28, -318, 135, 22, -761, 108
+L22: lea L147, *r7
+clr r1
+L23: bne *r2
+L24: .data -969
+L25: .data 838, -451, -408, 117
+L26: .string "mymezukbmck"
+L27: .string "wbsclguulmubfxrchwghysl"
+L28: .data 479, -804, -724
+L29: .data 539, 569, 280, -602, 89
+L30: .data 571, 724, 420, -204, -521, -817
+add r0, r5
+bne L8
+; comment
+not *r6
+L31: .data 794, -226, -697, -71, 739
+stop
+L32: .string "fxjshtxfaktkyhp"
+L33: .string "bo"
+L34: .data -364
+red r6
+red *r1
+bne *r3
+prn r0
+L35: .data -75, 404
+
+dec r0
+L36: red r2
+dec r5
+L37: .string "morexsbbopfiqizw"
+red *r1
+L38: .string "prmrucpmorkrny"
+L39: .data -892, 399, 516, 508, -837
+jsr L220
+L40: .data 535, -476, 759
+L41: .string "fjslp"
+sub r6, r0
+prn #10
+L42: .string "p"
+
+L43: .string "oietxwxdu"
+L44: add r6, r5
+bne L96
+L45: .string "zgktsfvk"
+red r7
+L46: rts
+jsr L9
+L47: .string "tyzhqx"
+L48: .string "obxbwyk"
+not r3
+L49: .data -643, -510, -597
+L50: .string "ghskuuukvlozolxpbcwo"
+L51: .string "aunz"
+add L17, r2
+inc L144
+L52: .data 574, 677, 920, -313
+L53: .data 328, -517, -995, -970, -918, 779, -706, 866
+prn *r2
+L54: .string "fxgwsayulfcjfuocu"
+not *r0
+red r5
+L55: .string "nbznqp"
+add #-40, r7
+L56: .data -712, -959, 559, -717, 105, -618, -35, 380
+L57: .string "afgwxlkaipicroii"
+L58: .data -42, 544
+
+L59: .data 68, -564
+L60: .string "potqwpiufgkbgqqq"
+L61: .data 955, -677, 706
+L62: .data -34, -294, -506, -2
+
+bne *r6
+L63: .string "aiixui"
+L64: not r4
+L65: .data 607, 401
+L66: rts
+
+L67: .data -587
+L68: .string "jfywb"
+prn #101
+L69: .data 175, -743
+jsr L48
+L70: .data 686, 152, -698, -831, -944
+L71: .data -32, -683, 752, 60, 375, 388, 800
+jsr L64
+L72: .data -6, -155, 795, 820
+not L201
+L73: .string "ohlaatpwkaefp"
+L74: .data 652, 444, -136, -829, -337, -991, -166
+inc r3
+L75: .string "uymxssjkiqy"
+add r7, L48
+L76: .data 211, -907, -402, -1, -988, -837, -177
+L77: .data 234, 178, 146, -389, 757, 207, 849, -557
+L78: .data 545, 62, -388, -793, -525, 913, 780
+L79: .string "efdncsc"
+mov L59, *r0
+L80: .data 628, 98, -663, -858, 713, -861, -943
+mov *r6, *r3
+L81: .string "jrpendo"
+L82: .data -34, 102, -45, 867, 264, -688, 78, -540
+L83: .data 657
+L84: .data -403, 943, -977, -251, -802, 73
+L85: .data -357
+L86: .string "zgm"
+L87: .data -770, -913, -215, -715, -496, -971
+red *r3
+stop
+bne L26
+bne *r2
+prn L140
+clr L61
+L88: .data -398
+inc r5
+bne *r5
+prn #131
+L89: .data 941, 974
+not r6
+L90: .data -939, -257, 643, -157, -795, 122, 804, 139
+L91: .string "dnzxovffrmuqddtkbejhdnzr"
+L92: .data -805, -397, -715, 709, -126
+L93: .data -164, 472, -715, 538
+jmp *r2
+L94: .data 970, 236, -496, -5, 852
+L95: dec *r3
+L96: .data 950, -64, 726
+stop
+L97: .data -902
+L98: .data 685, -837, 517, -815, 141, -703
+clr *r6
+L99: jmp L25
+bne L42
+mov *r4, r5
+L100: .string "isiuhallb"
+rts
+L101: clr r3
+L102: .string "d"
+mov r3, L303
+L103: .data -635, 438, -779, -354, -428, -104, 243, 382
+red L111
+L104: .string "jivuxbbkxsrema"
+L105: .data 939, -670
+L106: .data 331, -388, -676, -330, -959
+L107: .data 165, 829, -639, 419, -752, 975, 42, -956
+dec r0
+inc L31
+L108: .string "biddvvcwsxivityqyize"
+L109: .data -840, -287, -513, 720, 818, 741
+jmp L272
+L110: .data 465, -741, 192, -725, 957, -661
+; comment
+L111: .string "otaq"
+; comment
+L112: .data 165, 295, 744, 115, 893, -104
+not r0
+L113: .string "yhwkm"
+L114: .string "tpmvzoho"
+L115: .data 751, -219
+clr *r3
+L116: .data -961
+L117: .data -272, 667, -653, 466, -914, -611, 640, 527
+L118: .data 807, -938, 62, -574, -497, -150
+rts
+L119: .string "vze"
+L120: stop
+L121: .string "sgtjttxr"
+add *r3, *r4
+stop
+cmp r0, *r5
+jmp *r3
+; comment
+mov L178, *r2
+L122: .string "rdktycjmglasqfyvdyb"
+; comment
+L123: .string "yesmnyvrslgzccll"
+mov r7, L154
+L124: .data -116, 347, 711, -58, -345
+L125: .data 816, 768, 369, 50
+
+inc L114
+L126: .data -639, 680, 536, -715, 88, 371, 53
+bne L63
+L127: .data 66, 74, -422
+L128: .string "nhynkhdftrgpm"
+
+L129: .data 589, -650, -321, -13, 63, 214, 135, -315
+stop
+L130: .data 46
+L131: rts
+L132: .string "e"
+L133: .string "tnvthmlxzto"
+dec r2
+L134: .data -373, -854, 455, -176, -379, 686
+jmp *r4
+L135: .data 192, -329, 132
+L136: .string "qtirm"
+; comment
+L137: cmp #178, *r3
+L138: .string "gfyakdi"
+L139: .data -861
+L140: .string "tvhxjezngfvucy"
+L141: .string "z"
+L142: .data 362, 382
+L143: .data 699, -468
+red r3
+L144: .data -658, -716, -381, -72, -85
+L145: .data 982, 521, 538, -16, 927
+L146: .data 926
+dec L81
+L147: prn #121
+L148: dec L69
+L149: .data 948, 981
+L150: .string "liycfgbxupvjootimov"
+
+mov r5, r3
+L151: .string "xhdehjopi"
+L152: .data 973, -986, 470
+L153: .data -807, -60, -985, -717, 531, -785
+L154: .string "worgxwyglzslmehu"
+L155: .string "dpfbxluxdjigqoxwclxiyyir"
+dec r3
+lea L65, *r1
+L156: .data -151, 885, 78, 564, 375, -884, 910
+L157: .data -895, -612
+L158: .data -142, -532
+L159: .data 65, -372, 790, -646, 237
+L160: .string "sdajfzyog"
+L161: .string "dya"
+not L223
+L162: .data -671, -862, -644, -328, -236, 92, 680
+L163: .string "f"
+L164: .data 195, -832, -617, -887, 673, -633, 867, 610
+L165: .data -644, 907, 530, -584, -70
+lea L16, r6
+L166: .data 973
+L167: not L18
+dec r2
+jsr *r2
+prn r7
+L168: .string "oht"
+inc *r0
+L169: .data -936, 631, 778, 152
+L170: .data -357
+L171: .data -641, 658, -339
+L172: .string "zalisd"
+L173: .data 164, -780
+L174: .data 762, 257
+L175: .string "hssoxhvi"
+L176: .string "vogedqinwoxdm"
+stop
+jmp L147
+L177: .string "pogrdnt"
+clr L295
+L178: .data 807, -275, -771, 552, 63, -854, -245, 270
+L179: .data 691, 853, -571
+L180: .string "attohcgolcddupsvtfyhtu"
+dec r1
+L181: .data -81, -258, 241, -717, -285
+add *r0, L183
+L182: .data 724, -290, -863, 885
+L183: .data 198, -515, 753, -426, -474, 224
+clr L58
+L184: .string "dqzwuwjxfxdscxnxdviog"
+L185: .data 241
+L186: .data -421, -157, 778, 223, 327
+inc L287
+L187: sub r4, L157
+L188: .data -406, -242, -302, -719
+L189: .data -676, 108, 207, 434, -541, 299, 254
+L190: .string "mw"
+L191: .string "hkifidge"
+lea L120, r6
+rts
+jmp *r6
+red *r3
+clr r4
+cmp L266, r4
+L192: .data -689, -383, 285
+L193: .string "e"
+sub *r5, L159
+
+cmp *r2, L222
+L194: stop
+L195: .string "efpywcdhppttmonvaz"
+L196: .string "tzrvtjwn"
+L197: .string "fkckdtxoauxwq"
+; comment
+L198: .string "pnudqtkeim"
+L199: .string "tcwyhr"
+L200: .string "datmrwfwlccbrjhytqqfwrz"
+L201: .string "kgzmujfzwidzoa"
+rts
+L202: .data -496, 518, -264, -85, 213
+rts
+L203: .string "zbukwvjchilsqnlu"
+bne *r4
+L204: .data 168, 48, 407, -616, -65, 704
+jsr L199
+L205: .string "mphnodtlcibvvafvwddlz"
+L206: .string "mfqwnifsuzfvuqkarozzzwr"
+L207: .string "irisvmgrxdifv"
+L208: .string "xmsxvtnnyarqwcqdkxkcwh"
+L209: .string "lskfjdzhfcpvjzuhzn"
+L210: .data -152
+L211: not L248
+bne *r0
+jsr *r6
+L212: .data -156, -820, 366, -244, -979, 97
+bne *r6
+
+inc *r5
+L213: red r2
+L214: jsr L60
+L215: .string "soopkwspbxpuaykbgvjh"
+jsr L223
+L216: .string "jtdlk"
+L217: .data -340
+L218: cmp L290, #189
+L219: .string "ajwwemubbbrmze"
+L220: .string "tphrrwrdfguezzfpb"
+bne *r6
+L221: .data 272, -749, -766, -371, 868, -665
+L222: .data 585, -481
+dec L103
+L223: .data -793, -138, -348, 38, 508, -864
+L224: .string "sgjmzcrl"
+L225: .data -634, -455, 877, 498, -326, 324, 679, -452
+L226: .data 227
+add r1, r1
+inc L184
+L227: .string "nuqmdbnv"
+L228: .string "gqxdlqrri"
+jmp L278
+L229: .string "vavwxssolykwvjjdyzxrrpn"
+cmp r1, r3
+L230: .data -561, 325, 858, 664, -714
+L231: bne *r4
+L232: .string "cdscxgwn"
+L233: .data 282
+L234: .string "nxuasoamwziuxlninx"
+L235: .data 653, -13, 56, 438, 899, -556
+prn r4
+lea L211, *r1
+L236: bne L223
+L237: .string "xpqkru"
+L238: .data -145
+L239: .string "yfplvcjgrbwicqcagas"
+red *r5
+mov #73, r7
+; comment
+L240: cmp L3, r0
+jsr *r7
+cmp #-83, L257
+L241: .string "lfpunmwhkknkfugcps"
+jsr L302
+L242: add #-42, L51
+L243: .string "qqbifdmdumldydvwvy"
+L244: .data -22, -364, -408, -801, -132, -315, 565, -472
+L245: .string "ephnviffrlqnfzpsm"
+add L83, r2
+clr r4
+L246: .string "va"
+; comment
+L247: .string "ilzxyj"
+add #102, r5
+inc L30
+L248: .string "lolor"
+L249: mov r2, r4
+L250: .data 936, 103, 840, -295, -491, -98, -696
+not *r2
+L251: .string "kbotqplypxpxyqglqcretpp"
+jsr *r5
+L252: .data -364, -359, 423, -918, -346, 159, -516
+L253: .data 228, -392, -799, 416, -980, -931
+L254: .data -219, 4, -941, -269, 407, -583, 476
+L255: .string "ufyodgvdewov"
+L256: .string "wukivkuurta"
+L257: .string "rebbg"
+L258: .data -633, -269, -916, 445, -947, 183, -188
+L259: .data -5, -856, -278, 472, -940, -23, -523, -478
+L260: .string "hotwwhws"
+lea L32, L267
+L261: .string "petluv"
+mov r3, L289
+jmp L286
+L262: .data -533, -849
+add r3, L188
+L263: not r0
+stop
+L264: .data 456
+L265: .data -174, -503, 270, 876, 663, -337
+mov L209, r7
+L266: bne *r7
+L267: .data 6, 848, 444, -629, -935, -326, 80
+L268: .data -187, -764, 785, -517, -298
+L269: .string "bizjvelnhmwfefxelgsumk"
+L270: .data -62, 212, -350
+L271: .data -819
+L272: .string "dmgh"
+L273: .string "gocomokevdzhjscuf"
+L274: .string "esgerizzezmckpq"
+mov L295, r2
+L275: .data 426
+
+jmp L280
+mov r1, r3
+L276: .string "zgojxegvu"
+lea L182, L302
+L277: .data 326, -446, -817, -676, 984, -501
+L278: .data -923, -319, -121, -792, -111
+
+L279: .string "ytqzubbwjylepvzuwmy"
+not *r7
+L280: .string "mccnxdoyr"
+red r3
+sub #104, L4
+dec r0
+jsr L225
+L281: .string "ye"
+prn L114
+L282: .string "yzw"
+L283: .string "wowagayrihhwfhnxph"
+L284: .data 914, -142, -868, -864
+prn r7
+L285: .data -621, -332, 130, -21, -125, 619, 691, 592
+L286: .data 103, 511
+L287: .string "qitravouatoydjlyksvl"
+clr L297
+add L61, r7
+L288: .string "pk"
+L289: .data 162, -332, -156, -24, 772, -811
+rts
+L290: .string "kbavsyeerxkvulfv"
+L291: .string "tyvlgpptbnx"
+red r6
+rts
+L292: .string "xidsjkpbuete"
+
+red L242
+L293: add #215, L243
+jsr *r2
+L294: .string "luz"
+cmp *r4, r3
+jsr L207
+L295: .string "me"
+; comment
+red r2
+L296: .data 288, -107, -965, 303
+add L2, L235
+; comment
+L297: .string "eaypdless"
+L298: .string "xbzbkgkcikb"
+; comment
+L299: .data -622
+L300: .string "bicxqzqfrrjajmzvdtdm"
+L301: .data 386, -396, 550, 869, 701, 316, -182, 977
+rts
+L302: .string "djfgjmnajgh"
+L303: .string "uasjn"
+stop
+bne L304
+dec r4
+L304: .data 799, 840, -862, 664, 936
+stop
@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 68
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+L0: .string "vvolukohsk"
+lea L121, L0
+L1: .data -586, 999
+bne *r6
+L2: .string "wtlaazzfn"
+L3: .string "qzrjww"
+L4: .data 775, 323, -613, 271
+L5: bne L3
+L6: .data 775, -53, 42, 563, 624, 719, 882, 175
+red *r4
+L7: .string "pykyguitqadngmvkf"
+L8: .data 743, 477
+L9: add r5, L228
+L10: .data -393, 76, 974
+L11: .data 769, -886
+L12: .data 595, -208
+clr r7
+rts
+red r6
+L13: .string "ltcqlevjqgcpywvwvggz"
+L14: .string "gywfdfhusn"
+L15: .data 949, 696, -320, -374, 554
+L16: red L119
+L17: .data -405, -561, 810
+L18: .data 766, -998, 276, -109
+L19: .string "hzxuhyrze"
+cmp r3, L16
+L20: not *r7
+L21: .string "hvutrnxzm"
+L22: .string "xtnfosstcurvqtk"
+L23: .data 761, 487, -808, 344, -604, 361, 807
+L24: .string "udh"
+; comment
+L25: add r0, *r3
+L26: not *r2
+L27: .string "ghinoonyd"
+L28: .string "yfutqz"
+L29: .string "sznglwgl"
+stop
+L30: .data -315, -7, -853, 144, 281
+L31: .string "qntqskoygvquydchjvbrq"
+L32: .string "t"
+inc *r4
+not L6
+jmp L2
+; comment
+sub *r5, L152
+jmp *r2
+mov #-239, *r5
+L33: .data 476
+prn L48
+jsr L296
+L34: .string "vubzdozzatdhrsmxdoth"
+L35: .string "csarngvmatgi"
+L36: .string "qxxkljoohhfmwapamifdw"
+L37: add *r4, L29
+L38: .string "yhjqelqqcjvhy"
+lea L35, L178
+L39: .string "zximzw"
+L40: .data 706, 338, 521, -395, -217, 281, -241
+sub r5, r3
+rts
+L41: .string "bekqrlckfao"
+L42: .data 550, -96, 364, -612, 613
+L43: .data 856
+not *r3
+L44: .string "ymozdqtdefiwantefodzbtym"
+inc r0
+cmp r6, *r1
+L45: .string "kewarvdrckbwlzmdavjwbrr"
+L46: .data -817, 424, 827
+L47: .data -116, -945, -48, 609, -737
+L48: .data 647, 888, -417
+dec L150
+L49: .data 857, 767
+L50: .data 450, 360, -284
+L51: .string "bsussxzkxbrabdqgkalrn"
+L52: .string "sgdxafhqes"
+L53: .data 545, 60, -30, 611, 837, -224, 775
+L54: .data -433, -11, -387, 309, 814, 643
+inc L53
+L55: .data -934
+stop
+L56: .string "xn"
+mov L304, L10
+lea L10, *r2
+jmp *r5
+L57: .string "nvilcfw"
+add L13, *r4
+rts
+L58: .string "pwjvxvoicjqid"
+clr *r4
+L59: sub r2, *r3
+clr L97
+L60: .string "uvwfpbgezrwyeqpffvszjzf"
+L61: sub L66, *r1
+L62: .data 819
+L63: .data 260, -446, 301, 260, 501, 659, 77, -715
+L64: .string "adctwizkir"
+L65: .data -973, 868, -464, -238, 166, 403
+L66: .string "exqtubdcffp"
+stop
+L67: .data -34, -925, 448, 800, -426, 790
+L68: .string "fvfproteshwlhfnxurmudl"
+L69: .data 616, -77, 426
+L70: .data -395, -691, -203, 822, -573
+L71: .data 773, 799
+L72: .data -864, 425, 663, -343
+cmp #-28, L155
+jmp L278
+not r6
+L73: .string "zgxwki"
+L74: .data -99
+L75: .string "im"
+
+jmp *r0
+cmp #-197, #-64
+L76: .data 175, -494, 560, 36, -228
+L77: .data 37, -561, -4, 649, -310, -902, 838, -171
+L78: .string "mxidaahkpltmbdercxnwpia"
+L79: inc r1
+L80: .string "cdvtcncbfroohgvmiou"
+lea L278, L292
+L81: .string "jcye"
+L82: .data -515, 9, 428
+
+sub r0, r0
+L83: .string "bpagketki"
+prn *r7
+rts
+L84: .string "telhiedspkzjfogqjhmy"
+L85: .string "xbyuhpoqtgnjzjrwvoi"
+L86: .data 207, 762, -620
+L87: .string "jwoymff"
+L88: .string "pxfcnlaqunhofvmke"
+L89: .string "doehltimucwmxptnlk"
+L90: .data -529, 505, 622, 128, -567, -689, 861, 566
+L91: .string "qyjkgcrvtle"
+stop
+
+jsr *r2
+bne *r6
+L92: .string "vqizvhngdgijcloz"
+L93: stop
+L94: .string "hbhtmrrcukodgvlr"
+add #-139, L48
+L95: .data -101, -487, -589, -210
+L96: .string "brasypcvzqweulsmkuxmbc"
+cmp #-6, r0
+L97: .string "dgwtxfnwyp"
+bne L283
+inc *r7
+L98: .data 317, 4, 150, -459
+L99: .data 781, 763
+inc r7
+sub L203, L35
+L100: .string "muxqellvqbqbqaokvvae"
+rts
+L101: .data 938, 787, 698, 201, -325, -628
+L102: .string "qhzd"
+L103: lea L194, L268
+red *r4
+L104: .string "smptyzs"
+L105: .data 644, 695, -355, -11, 166, 463, 245, 459
+L106: .data -273, 384, 66, 269, -249
+; comment
+L107: clr *r6
+L108: .string "kttvtjmcpjg"
+L109: .data 57, -296, -735, -670, 142, 739, 184, 476
+L110: .data 746
+dec L105
+lea L35, *r2
+L111: .data -83, -643, -992, -49
+L112: .string "imzjkrdnifquqjargzgbsb"
+L113: .string "nbbgjflhw"
+rts
+rts
+jmp *r1
+not *r5
+jmp *r5
+
+L114: .data -447, -692, 954, -57, -615
+L115: .string "fxsiemkmqvlzgzdwetv"
+L116: .data 892, 191, -862, 922
+L117: .data 681, 304, -915, 310
+
+bne *r4
+
+L118: .data 80, 775, -167, -727, -39, -271, -490
+L119: .data -774, 824, -983, 726, 775
+L120: .data -164, -483
+L121: .data 712, -682, 682, 532, -503, 882, 355, 692
+L122: .string "tnwiincgp"
+jmp L272
+L123: .string "ps"
+lea L110, *r7
+prn r2
+L124: .string "xblnmxqpmguams"
+jmp *r3
+L125: red L51
+mov L284, r1
+not L108
+L126: lea L293, r0
+L127: .string "nrpjwnblmrlpdvjyzbuyu"
+bne *r1
+rts
+L128: .data 477, -611, 617, -635, 805, 911
+L129: .data -634, 466, -924
+L130: .string "kxrusg"
+cmp *r7, #69
+L131: .string "qowqai"
+L132: .string "dgrckufmeoakpyr"
+L133: .data 551, -380, 997, -444, -28, -972
+bne L44
+L134: .string "mvmajc"
+L135: .data 593, -568, -1
+L136: .data 933, 930, -501, -968, -841, 553
+L137: .data -697, 100, 527, -938, -997, -356, 644
+L138: .string "jonobduvfqjpbfngnwzvz"
+clr L217
+stop
+L139: .data 477, -191, 102, -790, 792, 379, 788, -395
+L140: dec L122
+L141: .data 977, 979, -304, 585, -385, 886, -101, 835
+not *r7
+L142: .string "zels"
+jmp L270
+lea L260, r1
+not *r1
+
+L143: .string "xhkltzgvjykzdvzekfgwf"
+L144: .data 643, -324, 121, -647, 934, -356, -40
+clr *r1
+L145: .string "cfdspqvgrxjgsgakapvle"
+L146: .data 344, 854, 735, -186
+L147: .data 142, -458, -40, 889
+inc L4
+L148: jsr *r0
+L149: .data -691
+L150: .string "xudjpez"
+cmp r0, #56
+not r4
+bne L305
+L151: .string "szqgvqgfwf"
+stop
+L152: .string "kcjgp"
+L153: .string "ophjfwdb"
+inc r1
+lea L287, r2
+prn *r5
+L154: .data 118, -303, -95, -707
+L155: .data -217, -612, -735, 261
+L156: .string "fahrcbcvk"
+L157: .data -298, -430, 894, -648, -606, 557, -843, -737
+prn r7
+L158: .data -552, 780, 376, 163, -850, -803, 980
+L159: .data 836, 183, 988, -651, -200
+L160: .string "vwxydlswkzsep"
+L161: .data -567
+L162: .data -703, -25, 680, 672, 400, -611, -525
+L163: .string "okzunx"
+clr *r7
+L164: .string "hoxhgmfhlwgxkzqxbu"
+L165: .string "smnwlfhccyvcziflqtdzaoa"
+L166: .string "zbwdekluqcpl"
+jsr *r4
+L167: .string "gpinhwjgokgpr"
+L168: .data -443, 677, 536, 476, 85, 707, 71
+L169: .data 268, 791, 413, -284, 694, -684
+L170: .data 165, -821, 5, -66, -814, -919, -794, 987
+L171: add #117, L260
+dec L92
+L172: add *r7, L253
+L173: .data -37, -680, -25
+L174: .data 902
+L175: .string "xlnvghontwibucqvtbl"
+L176: .string "frueqanskskwkwlwgbp"
+lea L193, r3
+jmp *r7
+jmp *r5
+dec r0
+L177: prn #-73
+L178: .data 380, 258, -172
+L179: .data 397, -692, 790, -378, -239, 233, 705
+L180: .data -450, 560, 934, -659, -684, -529
+add L153, r7
+; comment
+L181: .data -62, -890, 136, 710, -546, 718
+inc *r1
+cmp *r1, *r3
+L182: .data 884
+jsr *r2
+inc L56
+L183: .string "jpguxirwibaj"
+L184: .string "vyslvmpc"
+; comment
+inc r2
+dec L49
+L185: .data -273, -55, -972, 210, -259, 437, 915
+inc *r7
+lea L125, L297
+L186: .data -168, 681, -97, 209, -29, -955
+L187: .data -69, 608, -511, -171, 619, -228, -888
+L188: .string "sofpwlat"
+dec L307
+L189: .string "umtthfgj"
+L190: .data -103, 399, 753
+L191: .string "qvngciktyfeeoksgdecwxt"
+inc L174
+sub *r3, r1
+L192: .data 382, -11
+jmp *r4
+L193: .data -209, -667
+inc *r5
+rts
+L194: .string "nqlhxmgxgohwpbmgopqwvo"
+jsr L240
+jmp L292
+L195: .string "dukmafppqzqwfzaiezntp"
+L196: .data 312, -833, -58, 799, -771, -24
+L197: .data 882, 693, -579, -298, 647, 647
+L198: .string "ilp"
+; comment
+L199: .data 495, 141, -187, -443, 667, -635, -286
+bne *r1
+L200: .string "oif"
+; comment
+L201: .string "czfkjrhkrbxv"
+
+L202: .string "iwjkofcnhsuytxpkyckfjfp"
+L203: .string "bhatanasfqk"
+L204: .string "lxonub"
+L205: .data -480, 54, 54, 134, -877
+L206: .data 984, -167, -93, -471, 750, -876, -968
+L207: .string "ngjgvcvhkqlwf"
+L208: .string "hwvxprnbimf"
+dec *r2
+L209: .data -740, 834, -612, 542, 458, -945, -20
+L210: .data -540, -203, 984, -946, -192, -62, -668
+L211: .data 696, 974
+L212: .string "xvwpppproxvclbxy"
+L213: .string "edq"
+L214: .data -568, 648, 358
+L215: .data 254, 542, 240, -447, -521
+
+L216: .data -108, 35, 128, -668, 883, 177, -57, -102
+L217: .string "rbsdfwrexgavuo"
+clr L267
+L218: .data -865, 643, 411, 581
+mov *r6, L275
+L219: .string "jhyyymxy"
+jsr L302
+L220: .data -236, 750, 139, 528, 95, -534, 41, -116
+L221: .string "hyngyx"
+L222: .string "qqskaccnj"
+L223: dec *r7
+red *r3
+L224: .data -590, 95
+L225: .string "qfchnrkslvuidhrolu"
+L226: .data 188, 214, 112
+L227: .string "etcoclhzfqhced"
+L228: .data 847, 70, -752, 819
+; comment
+L229: .data 51, 941, 250, -849
+L230: .string "pzbttbzxbuvnsxlyavabaceq"
+L231: .string "zaziiptcxqfafnsadf"
+L232: jsr L120
+rts
+L233: .string "rmiazbiophuegukhapfiaxf"
+red *r6
+L234: .string "epnqsonjg"
+lea L276, r7
+clr *r1
+L235: .string "sgexwf"
+rts
+rts
+L236: .data -890, 70, 773
+L237: .string "fupbszxtnujyauzkfclk"
+L238: .string "oi"
+L239: .data -898, 605, 707, 256, 625, -620
+jmp *r4
+L240: .string "kntp"
+L241: .data 552, 674, -597, -650
+prn r5
+L242: .data 622, -161, -766, -227, -850, 309
+L243: .data 331, -623, 507, -593
+L244: .string "eerrrltkd"
+; comment
+cmp *r0, #126
+L245: dec r0
+L246: .string "ddjoiotqbjlvsasvdguzv"
+L247: .string "mywhvkksirrtrhgmczs"
+L248: .data 247, -323, -135, -471, -165, 795, 947
+L249: .string "bwfrlyiqneiaxeoykfxypxyz"
+L250: .data 175, -235, 161, -637, 543, -179
+L251: .string "ocgtgioovl"
+L252: .string "pebuukcazslvgdcagmwqvma"
+L253: .data 361, -326, 94, 515, 768, 179, -821, 952
+bne L210
+L254: lea L151, *r2
+add #-154, L162
+prn *r0
+rts
+L255: .data 89
+
+L256: not L197
+jsr L270
+L257: .data 746, -119, 343, 132, -104, -451
+L258: .string "u"
+; comment
+L259: inc L149
+mov L141, L72
+L260: .data -61, 802
+L261: .string "onswtlqatjjvzxzeept"
+stop
+sub *r6, L266
+L262: .data 87
+L263: stop
+; comment
+L264: .string "nkzjozelqabsvbkgo"
+add *r2, *r2
+L265: .string "wsiopdbbsktaxdgcpvxpgez"
+L266: .data -550
+rts
+stop
+L267: .data -929, 604
+L268: .data -918
+prn *r7
+L269: .data -48, 682, 984, 103, -933, -569, 515, 672
+L270: .data -299, 68, -402, 676, -940, -395
+L271: .data -534, -486, 225, -85
+L272: dec r2
+not *r0
+L273: .string "ygueqmgccumpgspw"
+L274: .data 628, -393
+L275: .data -690
+add L260, L246
+cmp L34, #94
+L276: .string "zvd"
+stop
+L277: .data 471, -131, 358, 257, 825
+
+
+L278: .data -315, 133, 943, -621, -295, -934, -967
+L279: bne L235
+L280: .string "oyt"
+L281: .string "wnwfhfwyh"
+L282: .data -308, 85, -330
+L283: .string "whmq"
+prn r4
+not r6
+inc *r5
+red L298
+sub L53, L298
+L284: .string "yqmifme"
+L285: .string "wrflw"
+bne L244
+
+L286: .data -170, 855, -117, 714, -377, 655, 446, 162
+stop
+L287: .data -249, 389, 934, -32, 899, -290, 31, -381
+clr r6
+L288: .string "eawbmjqnnpnzt"
+L289: .data -404, 931, 372, -925, 156
+jsr *r1
+L290: .string "tdguvo"
+L291: .string "ffdka"
+L292: .string "akpzcowawhv"
+; comment
+L293: .data 279, -69, 373, -452, 567
+rts
+; comment
+prn *r6
+L294: .data 287, -886, 531, -791, 236
+L295: .data -494, 828, 962
+clr *r7
+L296: .string "foagwscmfzwfp"
+jsr L166
+L297: .data -337, 742, 7, -869, -216, 150, -256
+L298: .data 781
+L299: .string "yvziiummij"
+L300: .data -172, -505, -921, -728, 588, -32, -852, -968
+prn r2
+L301: .string "petyzqpraxhiwixuunvb"
+clr *r2
+L302: .data 993, 309, 420, -577, 786
+L303: .data 166
+L304: .data 100, -151, -641
+L305: .string "nlroecqfx"
+add *r5, *r5
+L306: .string "yhogtwlfznt"
+red *r6
+L307: .string "rkzupjxecfqrwqvadeoqe"
+L308: .string "oselrqiohglnzhiljzb"
+sub r4, r5
+L309: .data 614, 40, 236
+L310: .data 531, -505, 254
+L311: .string "qaiqowpyzhiuphoshfmlt"
+L312: .string "itqezokqsyrzdvycoutysiku"
+not *r2
+stop
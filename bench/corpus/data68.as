@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 69
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+L0: .string "jqb"
+rts
+mov #-100, L0
+; comment
+L1: .data -882, 807
+L2: .data -134, 49, -244
+L3: bne *r1
+bne *r2
+L4: .string "uyy"
+L5: .data -279, -38, -496, -1000, -493, 696, 266
+L6: .string "yppbrgyow"
+; comment
+L7: .string "hqritiyftwitqjknpod"
+bne L149
+cmp *r3, r4
+L8: .string "kajh"
+L9: .data -36, 689
+L10: .data -499, 700, -108, -812, -569, 493
+L11: .string "irqoyproyhpkbtbs"
+prn r0
+L12: .string "ybrfvwqmheyfugs"
+L13: .string "xmiy"
+L14: .string "roqkiujjtxqzwrkbumoywbo"
+sub L7, *r7
+L15: .string "cfbocrfuqjqjy"
+L16: .data -177, 693
+mov r2, r6
+L17: .string "kglohb"
+L18: .string "nrt"
+
+inc *r6
+rts
+L19: .data 795, -531, 383, -619, -751, -114
+stop
+L20: .data 456, 608, 427, -680, 939
+L21: .data 763, -630, 826
+L22: .data -782, -317, -554, -382
+L23: .string "oimyurbblanoodlsvvdniz"
+L24: .string "p"
+inc *r7
+L25: .data 207, -523, -374, -865, 204, -429
+rts
+L26: .string "namduct"
+L27: .string "sntfvcddquappzgkvhtwggt"
+L28: stop
+L29: inc *r3
+L30: .string "muijnsjbofdhovgg"
+L31: add r7, *r5
+jmp *r3
+L32: cmp #57, L226
+L33: .data -232, -824, 726, -583
+L34: .string "dyuxpsnvxfdodopatbw"
+jmp *r4
+L35: .string "nguikh"
+L36: .data -911, -843, 294, -741, -989, 643, -813
+; comment
+cmp *r3, *r6
+L37: .string "aftqhdcjdmdf"
+rts
+L38: .string "oikrd"
+jmp *r6
+L39: .data 515, 62, -926
+L40: .data -569, -742, -332, 9, -821, 144, 493
+L41: .data -801, 339, 285, -712, -874, -256, 788
+
+L42: .string "nmfvouneinlmjnhd"
+L43: .string "gvwxwylevegu"
+L44: .string "kieapyskjkyrmtqk"
+L45: .string "c"
+L46: .string "puwdigqcdbaymccxlyfkx"
+dec *r5
+sub r1, L259
+not *r7
+; comment
+stop
+red *r2
+jsr L214
+L47: .data 145, -747, 88, 725, -315, 597, -264
+L48: .data -649, -621, 605, -78, -732, 231, -376
+L49: .string "lcxujnoec"
+L50: .data -638, 896, 849, -757, 149, -69, 512, -197
+L51: .data 496, -916, -280, -166, 137
+L52: .string "iqibyqohjjyxosm"
+L53: .data -270, 395, 11, 58, -834, 977, -962
+L54: .string "arnebtpienhrfgjy"
+L55: .string "zbsvxoohu"
+L56: sub r4, *r2
+dec L285
+L57: .string "hedcgxtrmoezoph"
+L58: .string "wdlndgpttwuyyovp"
+L59: .data 67, 751
+L60: .data 176
+L61: .string "ntivdmsk"
+L62: .string "rsiejyplhqmxis"
+L63: .string "qesjnset"
+not L193
+jmp L283
+L64: .string "zkrxnplfjlzuwyp"
+add r2, r2
+
+L65: .data 945, 534
+add *r5, L44
+mov #-204, *r0
+L66: .data 138, 530, -95, -984, 751, -951
+
+L67: .string "xyzqlxco"
+red *r2
+not *r6
+L68: .string "o"
+L69: sub *r4, r2
+L70: mov *r1, r1
+stop
+L71: .data -693, -163, -7
+clr *r0
+L72: .string "ognsxdbfkv"
+L73: .data -8, 219, 552
+L74: .data 782, -685, 339, 397, -499
+red r6
+inc r7
+L75: .data -499, 832, -349, 681, -434, -196
+L76: .data 839, 306, 543, -771, 741
+L77: .string "rxcqvvbpbfhgxzprvktv"
+jmp L58
+L78: .string "rqjlbjceqohftlddj"
+prn *r3
+L79: .string "vlfbudewe"
+L80: .string "ytuodtmhuqytqnanxnefnhon"
+
+bne L54
+L81: .data -435, -603, -489, -675
+stop
+not *r4
+L82: bne *r7
+L83: .data -330
+L84: .data -414, -662, 864, 743, 36, 3, -366, 649
+add *r6, *r6
+L85: .string "uzfmefcsmebokdvjwp"
+red r7
+L86: .string "agbnnaiknufprkcwgw"
+L87: .string "jaggjkbenut"
+L88: sub r4, r0
+inc L228
+clr L63
+L89: .string "ielywqydpbkefuc"
+sub L36, L70
+; comment
+mov #-129, *r2
+L90: .string "dswroanmwsxuowphdzcbqqvb"
+L91: .string "mlcodtol"
+L92: stop
+L93: .string "np"
+L94: .data 258, -309, -814, 552, 217
+
+L95: .string "xdjzbdojqtmiqavuvf"
+add *r1, r4
+L96: dec L102
+clr *r1
+L97: cmp *r1, *r6
+; comment
+L98: .string "j"
+L99: .string "oxum"
+stop
+dec r1
+
+red *r0
+; comment
+L100: .string "yewbvetadggweotjdg"
+L101: .string "dklgkkllbytnqkqpuevdyfj"
+L102: .data -375
+L103: .data 9, 400, -978, 655
+lea L110, L255
+inc *r4
+bne *r4
+L104: .string "ri"
+add *r5, *r0
+stop
+L105: .data -208, -102, 676, 678
+not *r0
+stop
+L106: .data -873
+inc L186
+red r3
+L107: .data -379
+L108: .string "utifikdehrhqpkl"
+L109: .data 111, 574, 599
+L110: .string "twgbgrvwrnnk"
+add r3, *r4
+L111: .string "ulnerctjkmzj"
+dec *r1
+jmp *r2
+not r6
+clr L235
+jmp *r4
+L112: .string "fxdq"
+L113: .string "gbieppodigvnvhgm"
+L114: .data -660, -848
+add r0, *r0
+L115: .string "awnzymk"
+L116: .string "frroroulyljsykcweacpaw"
+L117: .data -877, 171, 299, -706, -606, 382, 692, 24
+red L172
+L118: .string "gdimwrnqvuyutxoauanplas"
+L119: .string "jcimxtagqnkxhdlt"
+L120: .data 392, 564, 764, 391, 959, 887
+L121: .string "ezoltdkpdcvfpgwoozrrwzf"
+L122: red L234
+jsr *r6
+
+jmp L272
+lea L282, r3
+clr r7
+dec r7
+L123: .data -540, 685, -719, 127, -929, 448
+L124: .data 153, 704, -137, -331, 651, -201, -559, -695
+L125: clr *r5
+L126: .string "eqseookfvhefvo"
+sub *r7, *r0
+cmp r1, r0
+inc *r6
+L127: .data 738, 649, 663, 716
+L128: .data 229, 409, -939, -204, 516, -855, -611
+L129: .data -947, 756, -137, -825, 82, -509
+L130: .data -87, 299, -326
+L131: .data 406, -681, 990, -352, -967, 746
+jmp *r2
+L132: add r5, r5
+cmp *r5, r1
+jmp L239
+add r4, *r4
+L133: .string "rnaqsakvgdpnooucoujdqfhn"
+L134: red *r4
+L135: .data 380, 588, -287, -817, 619, -347, -560
+L136: .data 706, 497, 545, 949, 907, 959, 56, -587
+jmp L135
+L137: .string "ttlr"
+red L245
+L138: .string "atetaaielwjcthawljjraeb"
+jsr *r7
+L139: .data 974, 250
+L140: mov *r5, r0
+jmp L47
+L141: .string "xmsztrrkxuodbezr"
+
+L142: .data -706, -651, -991, 497, -23, -108, 343
+L143: .string "pnxqzmndnpvqo"
+L144: .data -740, 255, 839, -894, 314, 511, 832
+L145: .data -923, -106, -749
+stop
+L146: .data -583
+; comment
+red r2
+jsr *r2
+L147: .string "mkvnzrbtalezc"
+L148: prn *r7
+L149: .data -332, -947, -313
+L150: .data -461, 90, -633, 706
+L151: .string "xqeezkuextivd"
+L152: red *r6
+L153: .data 468, 745, -771
+add #90, r1
+inc *r5
+rts
+
+L154: .data 964
+not *r0
+L155: .string "csquahojeyzmeso"
+L156: .data -328, 801, 570, -274, -282, -680, -979
+L157: inc r0
+L158: .string "frkllf"
+L159: .data -899, -905, 76
+L160: .string "kmgavxlyevqvzcjevo"
+L161: .string "gypatdwmptjmdip"
+L162: .string "q"
+prn r7
+inc L66
+L163: .data -587, -365, -8, -861
+L164: .string "ebknucrcbjzhtwxlzqkndt"
+L165: .data -698, 583, -94, -826, -631, -708, -101, 128
+L166: .string "yzm"
+clr *r3
+L167: .data 538, -270, 148, 213, 644, -611, 4, 869
+jmp L284
+L168: .data 395, -529, 775, -963
+sub L280, r4
+jmp *r6
+bne *r6
+add L136, *r3
+sub L57, L200
+L169: .data -134, -900
+not r0
+red r7
+L170: .data -233, -228, 497
+stop
+L171: .string "dbv"
+L172: .string "ruefgqzhwiabobwuzfn"
+L173: .data 686, 271, 483
+L174: .data -560, -525
+L175: .data 654, -822, -946, -944
+L176: .data -605, -618, -800, 853, 743, 517
+L177: .string "prrwebfkgn"
+bne *r0
+L178: .data 691, -125, -759, 102, -693, -825, 696, -344
+; comment
+L179: .string "wrdjqsgbrtlqvglh"
+; comment
+L180: .string "eqpomuijxxdeptzoxx"
+L181: .string "wsxi"
+jmp *r3
+stop
+L182: .data -648, -1, -318, 831, 680, -53, -112, 164
+L183: .data -879, -690, 261, -870, 460, -527, -668, 282
+L184: prn L21
+
+L185: .string "owuywmmqvhgdopzfeuclngz"
+L186: inc L255
+L187: .data -829, -777, -679, -377, 908, -376
+L188: .string "yntduecxfuxntmatciag"
+sub L64, L108
+L189: .string "g"
+L190: .data -953, -159, -303, -335
+cmp r7, r0
+L191: .data -914, -380, -464, -453, 510
+L192: .data 855, 132, -224
+L193: .data 134, -344
+L194: .data -77, -504
+L195: .data 437, -358, 441
+
+; comment
+L196: .string "xtzosbqnoztkf"
+
+clr *r4
+L197: .string "quanrumosfeqju"
+stop
+L198: .data -368, 704
+prn r2
+mov L265, L86
+L199: .data 926, -914, -315, 689, 31, -2, 224
+L200: .data 554, 825, 902, -230, 239
+L201: .data -649, -562, 858
+L202: .string "wxwaledtdjcutptegpynsqha"
+L203: .data 463, -241, -705
+mov r4, L92
+L204: .data 196, 688, -702, 637, -947, 462, 297
+L205: .data 675, -248, -344, 119
+L206: .data -685, 596, -901, 727, 213, 785, -118, -405
+stop
+L207: .string "ayrjzqgsekiu"
+lea L231, L270
+L208: .data 537, 771, -730, 863, -595, 813, -11, -798
+L209: .string "zzhttnbdhc"
+L210: cmp #136, L207
+L211: .string "ojjce"
+L212: .data -578, 876, -223, -505, -360, 677
+L213: bne *r0
+L214: .data 407, -477, 168, -784
+L215: .string "nctjw"
+lea L62, r4
+jsr L225
+L216: .data 663, -146, -803, -532, 40, 190, 73
+dec *r0
+L217: .data 262, -61, -547
+stop
+
+jsr L149
+L218: .data 317, -798, -291, 736, -634, -368, 729, 584
+L219: .data 568
+L220: bne *r7
+
+lea L105, *r6
+L221: .string "pximwmhlyskqgxbuhwjb"
+L222: .data 759
+dec L163
+L223: .data 634, 801, 411, 512, 695, -516
+L224: .data -6, 155, -92
+L225: .string "gwnqaleblirwx"
+L226: rts
+; comment
+L227: .data 244, -839, -94, 665, 566, -513, -587, 179
+bne L215
+jmp L254
+lea L119, L276
+L228: .string "nsvuz"
+stop
+L229: .data -158, -150, -134, -250
+mov *r0, *r7
+L230: .string "brtilgsibdmswvklpdwj"
+; comment
+L231: .data 446, -698, -80, 833, 856, 615, 320
+jmp *r2
+inc L259
+jsr *r6
+L232: .string "dswsptbzts"
+L233: .string "muvlffb"
+L234: .string "yitkjjbysjunbzbjqmp"
+L235: .string "rzmyajxlhtdjtttkuuecywv"
+L236: .data -648, 588, -388, 133, -327, 932, 524
+L237: .string "lzp"
+L238: .string "clxppgehimxgsnvhlvrla"
+L239: .data 696, -280, -569, 568
+L240: lea L257, r7
+L241: .data -620, 95, -708, -124
+inc r1
+L242: .data 255
+L243: .string "ltk"
+lea L75, r4
+L244: .string "mxjmaela"
+L245: .data -948, 437
+L246: .string "wps"
+add *r1, r2
+L247: .data 288, -651, -438, -381, 355, -894, 344, 490
+; comment
+L248: .data 613, -364, 484, -959
+bne L247
+red *r3
+cmp r3, r7
+L249: .data 78, 700, -715, -893, 369, -867, 265, 504
+L250: .string "uynonxbyauanehgjovgbqaxd"
+L251: .data -246, -398, -493, -256
+cmp r0, r6
+inc *r2
+prn #-55
+L252: .string "cxvtseqa"
+stop
+L253: .string "v"
+; comment
+L254: .data 941, 375, 728, 959
+mov r4, L152
+L255: .data -431
+L256: .string "gfet"
+L257: .data -449, -280, 990, -587, -503
+stop
+L258: .data 927, -826, -190, -654, 904
+jsr *r0
+sub r1, *r6
+L259: .data -337, -617, 46, 239, 579, -67, 160, 946
+add r4, *r4
+; comment
+L260: .string "dqmhggakxkq"
+L261: .data -43, 832
+rts
+L262: .data -316, 515, -606, -62, 324, 593
+L263: .data 126, -726
+L264: jmp *r1
+L265: mov r1, L298
+prn r1
+L266: .string "tbblqxapuhkykpixjnnwfdz"
+L267: inc L299
+red *r4
+L268: .string "vizdpxsetahkzkmblchyaeq"
+L269: .string "pswwlv"
+L270: .string "clmrtsxtvucnpndaeyuw"
+jsr *r4
+L271: .string "jonmaclomw"
+L272: .data 347, -157
+L273: .data -840, -498, -760, 542, -107, 934, -202
+L274: .string "suazlqrpaoyu"
+L275: .string "jbejekcexvgeknqt"
+L276: .string "qdjkgpmwcgeeznjik"
+L277: .data 645, 747, -833, -566
+L278: .data -854, 417, -927, 892, 522, 226, -504, -331
+; comment
+L279: .string "xaslfebbxppebsqz"
+L280: .data 161, 973
+sub L287, r3
+mov *r7, *r0
+sub L291, L138
+jsr L290
+L281: .string "vwolmhznjrhrfskpg"
+
+L282: .string "hdqhenkwvfez"
+L283: .string "zhb"
+L284: .data 942, 496, -513, -558, -897, -432
+dec r6
+L285: .data 495, -200
+L286: .data -351, -575, 437, -615, -994, 808, 926, -572
+L287: .data -996, 720, -199, -252
+; comment
+L288: mov r5, r0
+mov *r3, r0
+L289: .string "gty"
+dec L300
+L290: .string "drifly"
+L291: .data 768, -11, -999, 868, 201, 138, 360
+L292: .string "zyndhhjntivwzk"
+sub L300, r6
+L293: .string "ootsibn"
+L294: .string "radctezzhbuvaknvzorysjpk"
+L295: .data -82, 613, 0, -915, -469, 911
+cmp *r6, #163
+not L146
+L296: .data 750, -873, -339
+L297: .data 764
+L298: .data -461, -86, 141, 357, 580, 410, -580, 621
+L299: .data -854, 156, -418, 181, 368, -665, -510, -854
+L300: .data 327, -147, -85, -108, 955
+L301: .string "rrtyq"
+L302: .string "u"
+L303: .string "cwctdboieujhryp"
+L304: jsr L305
+L305: .data -804, -791, -891, -305, 872, -249
+stop
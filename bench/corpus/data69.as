@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 70
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+not *r1
+L0: .data -942, -548, 168, 732, -979
+dec r3
+L1: .data 459
+mov *r1, *r4
+cmp L208, L1
+L2: .string "krdl"
+red *r3
+lea L25, r3
+L3: .string "biinstazryc"
+L4: rts
+L5: .string "btgkveqjvjndwbxzfj"
+inc *r2
+L6: .data 954, 880, 794, -512
+L7: .data 680, -908, 562, 691
+bne L248
+L8: .string "vjseauvxeoxmhvriptgayw"
+L9: .string "ypkixxnbilzxujvms"
+L10: .string "odvrdlowau"
+sub *r2, r5
+add #-250, L1
+L11: .data -859, -681
+clr r6
+L12: .string "jzpjyzcorwggcvzezhcfch"
+L13: .data -732
+lea L242, *r1
+L14: .data -944, 250, 501, -363, 485, -752
+L15: prn *r2
+prn L5
+L16: .string "hf"
+L17: .string "clfbxj"
+rts
+rts
+red *r2
+L18: .data 180, -205, -755, -577, 690, 317
+L19: .string "gvnrnqkherywveipvctu"
+L20: .data 291, 764, 443, -237, 601, 479, -747
+not r4
+bne *r4
+L21: .data 601, -357, 360, -379
+L22: .string "tuvewijqpqqmokgpqvu"
+L23: .string "bkcyryyxcl"
+L24: .string "umbzxtronoejmailmetq"
+sub r5, r7
+L25: .data -901, -776, 290, -615, -705
+L26: .data -647, -765, 840, -630, 829, -328
+L27: .string "ghntlokyhpa"
+L28: cmp r5, r0
+L29: .string "wqnbsdmvho"
+L30: .data 422, -565, -987, -623
+cmp r5, #-106
+L31: .string "ah"
+L32: .data -743, -177, 507, -320, 58, 468
+inc r5
+L33: dec r2
+rts
+L34: .string "hrpzbtgb"
+sub #32, *r5
+jmp *r3
+L35: .string "zyjynrigj"
+L36: .data 633, -300, 811, -451, 978, -309
+lea L192, L67
+L37: .data -338, 10, 822, 409, -900
+L38: .string "mnjfsjdi"
+L39: .string "jnplpcenkxxb"
+red r0
+L40: .data 0, -518
+L41: mov r4, *r6
+L42: prn L16
+L43: .data -743, -733, 461
+L44: rts
+L45: .data 814, 725, 625, 171, 431, 107
+cmp *r0, L130
+L46: .string "ivxw"
+L47: .data -960, -539, 314
+L48: .string "nxboetewqlpgtaa"
+L49: .data 230, 829, 460, -600, 958, -113, -222, -566
+cmp *r2, #192
+L50: .string "qefgyxvxqt"
+; comment
+bne *r1
+L51: .string "c"
+; comment
+L52: .data -115, -737, -45, 300
+L53: .string "vvpkmbjvdizuxoe"
+red r7
+L54: .string "gmja"
+add *r3, L129
+prn *r0
+L55: .data -514, -748, 410, 326, 63, 795, -112
+dec r7
+; comment
+L56: .string "mkyufclzyqnepokirs"
+L57: .string "nehtwajdftqgd"
+not *r3
+L58: .data -326, -912, 804
+L59: .string "tgkuywtliuujlyguradtif"
+L60: .data 831
+L61: .string "uwdz"
+add r6, r5
+L62: .data 884
+L63: .data 449, -606, 170
+jmp *r4
+L64: .string "exwkzhqajvqjf"
+mov #-223, *r3
+L65: .string "thzdilrlmjbkgzxr"
+L66: not *r6
+L67: .string "bintyeppxhoyvpdtewkhe"
+L68: .string "jorrjobbqiuhfrirou"
+L69: .data 800, -15, 294, 899, -282, 794, -904, 164
+L70: .string "psozzxedvugfhlxsdchfl"
+L71: .data 4, 515, 617, 797, 597, -491, 402, 236
+L72: dec r4
+L73: .data 317, -33, 696, -635, -459
+L74: .data 638, 567, 942, 634, -65, 365, 978
+L75: .string "epzjguikwk"
+L76: .string "ipeiwikodniqglpgnk"
+L77: .string "mwubua"
+L78: .data 955, 774
+L79: .string "bzowvtkwdqaerovpm"
+bne *r4
+prn r6
+L80: .data -247, -277, -576, -152, 220
+L81: .data -99, 632, 891, 904, -715
+L82: .data -581, -821, -772
+L83: .string "jeyzga"
+L84: .string "jzufqpecjkjqj"
+L85: add #-205, L18
+L86: .string "ficpltpqgsjoghnks"
+L87: .data 799, -52, 15, 726, 349, 729
+L88: .string "celp"
+; comment
+; comment
+L89: .string "gpxuv"
+L90: .data -72
+L91: .string "qqaaeghywvoji"
+L92: .string "vx"
+L93: .data -730, -797, 858, 278, -268, 208, 748
+; comment
+L94: .string "zovzvhueq"
+L95: .data 661
+lea L37, *r1
+
+L96: .data 722
+L97: .string "kfbfqq"
+L98: .string "qtrbckxbamjhncirc"
+mov #143, *r6
+dec L287
+L99: .string "glfgwytlaskaqj"
+dec L175
+L100: .string "n"
+rts
+L101: .string "wcedhqozkjajz"
+L102: .string "kbkwrgqduqvpeduey"
+; comment
+not L80
+L103: .string "oifwikjdcanuxakkpzjudh"
+; comment
+L104: .string "jxhsjofbxz"
+L105: .string "qp"
+lea L25, r5
+rts
+L106: .string "vkbowiysawfeowhrtxoshv"
+dec r3
+L107: .data -399, -787, 426, -476, 179
+dec *r1
+not *r3
+L108: .string "ccscklgeqexzbjjgpa"
+L109: .string "gmrejhrbjen"
+mov *r0, r0
+L110: .string "pw"
+L111: .string "zndgrtmmhxokrnc"
+L112: .data -797, -549, -932, -59
+L113: .data -489, 383
+L114: .string "taiitnjtgouoiasipt"
+L115: .string "odmtmjpzyvnnn"
+L116: .data 30
+L117: .string "kigkalasktfomsk"
+not r2
+dec L173
+red r0
+L118: .data 577, -203, 527, -195, 737, -376, -608
+cmp #179, L5
+L119: .data 660, 176, 58, 99, 302, -714
+stop
+L120: .string "ctbaskpcfqsdmnvbumx"
+L121: sub r3, *r2
+L122: .data 438, -626, 785, -140
+clr *r3
+L123: .data -239, -943, 991, 414, 530, 443
+inc r6
+L124: .string "hxm"
+L125: .string "ikhluwurdr"
+
+L126: .string "xkbdvqvnvawplawepu"
+; comment
+L127: .string "ddvywemgilscvrcntmgvb"
+L128: .string "tmlvdughojxjgsbjdkmpj"
+; comment
+sub L313, L226
+L129: .string "iwnviyjmpi"
+L130: add #150, *r2
+L131: .data 138, -781, 550, 732, -368, -486
+L132: .string "uuxwl"
+L133: .data 300
+L134: .string "yzukilbtdt"
+lea L266, r5
+L135: jsr L71
+L136: rts
+L137: .data 129, -941, 75, -770, 146, 856, 929, 139
+L138: .string "vjofeooxhzzdkmycrvgu"
+L139: .string "qhprpsthibzsvzxscxjg"
+L140: .string "bswxeybavy"
+clr L94
+sub *r7, L47
+L141: .data -122, 435, 112
+prn #-213
+clr L21
+L142: .string "wubnslglse"
+mov *r4, r5
+prn *r5
+L143: .data -132, 296, 123, 886, 430
+mov *r5, L277
+cmp *r2, L4
+jmp *r1
+L144: .string "imzrhhoynudldjkx"
+L145: .data 22, -330, 72, 461, 889
+L146: .data -582, -46, -733
+L147: .data 290, 981, -538, 879, -500, 698, 155
+L148: .data 133, 759, -986, 828, 444
+L149: .data -80, 846, -890, -413
+red *r7
+L150: .data 35, -438, 859, 7, 31, 201, -771
+L151: .data -861, 562, 574
+L152: .string "advetwammrpxuigwbgpodr"
+rts
+lea L147, L52
+inc r4
+L153: .string "raiagkjqvwea"
+not *r2
+L154: .data -945
+mov #-181, *r5
+L155: .data 113, 287, 177
+inc r3
+L156: .string "nxuwvbsrfstfnykz"
+L157: .data -329, 666, -149, 171, -427, -237
+L158: .data -840, -980, 410, 56, -617, 502
+L159: .data -211, 780, -38, 529, -835, 293, 629
+L160: .string "viblrvvduniukzpmp"
+L161: .string "bkdzadccuycx"
+L162: .string "irqxfnmouiywan"
+prn *r7
+bne *r7
+L163: rts
+L164: .string "bswoazqfgruxplekpbqwdw"
+L165: .string "ycjxciwocausbshmjscytted"
+sub r3, *r4
+L166: .data 538, -583, -275, -773
+L167: .string "siqvdxh"
+L168: jmp *r4
+L169: .data -54, -828, 816, -75, 886, -880
+L170: red r5
+red L274
+L171: .string "puk"
+L172: .string "twgjqcvtitolijsfwkrip"
+L173: .data 513, 394, 827
+L174: .string "bpyhgsvhyghmciwwvkxikpj"
+not L257
+L175: dec *r5
+L176: .string "gpzbluzpogr"
+L177: bne *r2
+L178: .string "j"
+L179: .string "rnhyunkcxxktgjoduuxm"
+L180: .data -125, -987, -336
+L181: .data 556
+L182: .data 791
+L183: .data -682
+L184: .data -574, 442, 608, -169, -196
+prn L246
+lea L141, L108
+L185: .string "jjuvgfnlinqisbegmq"
+L186: .string "xjzjbsgg"
+L187: .string "asj"
+cmp L306, #-175
+L188: .data -888, 806, -854
+L189: .string "dqcllci"
+dec r7
+L190: .string "adnq"
+L191: add L310, r4
+L192: .string "qvl"
+mov #-15, r5
+L193: .data 842, -433, -991
+L194: .string "itknpxixwobdwdu"
+L195: .string "zhrmjjojtcwadr"
+L196: .string "hoslusdyzhsaslsmvqjtcl"
+L197: .string "yvbffhmwkieydprtmqugt"
+L198: .string "hwm"
+L199: .string "pzawxrvkdadtfppydy"
+L200: .data -271, 353, 880
+inc L56
+L201: .string "xidzn"
+L202: .data -963, -989, -517, 513, 891, 503
+L203: .data -606
+L204: .string "thzgx"
+L205: prn L243
+
+rts
+L206: .data -180, -288
+dec r1
+not L326
+L207: .data -252, 543, -526, 830
+cmp #-49, #107
+L208: .data -490, 939, 944, -207
+lea L5, *r7
+L209: .string "kcwyis"
+L210: stop
+add r7, *r7
+L211: .string "fzhavfqslad"
+L212: not L254
+
+L213: .string "kibxh"
+L214: .string "jhlxhwiwwlriqxbb"
+L215: .string "tixhddxvmgzy"
+lea L45, L205
+L216: .data -494
+bne L301
+L217: sub *r2, L122
+L218: .data -448
+L219: .data -802, -57
+add #-164, r2
+L220: .string "ixrmp"
+L221: .string "ehkoguvmltvxlvapisvx"
+L222: .string "zj"
+red r1
+L223: .data -376, -1, -512, -885, -960
+stop
+dec r7
+clr r7
+L224: .data 981, 61
+L225: .string "qwcmvsmjg"
+sub #-4, L167
+L226: .string "lbx"
+L227: .data -95, -915, -756, 608, -351, -207, -498, 24
+L228: .data -983, -160, 434, 587, -191, -570, 695
+add *r2, L192
+L229: .string "fchkvglupe"
+L230: .string "tronpdifc"
+
+L231: .data 784
+L232: .string "bljxkfzq"
+; comment
+L233: .data 535, 988
+jmp L26
+L234: .data -537, 743, 561, -387, 949, 257, 962
+L235: .string "nfexqhvsnyvef"
+red L304
+L236: .string "tlrkjjzdjp"
+inc L307
+L237: .data -606, 434
+jsr L266
+prn *r6
+L238: .string "zdidyfzcopccmyzouqpt"
+L239: .string "hxdaojqwguowlu"
+L240: .string "aeibdlrwyxzlgfishcviycjd"
+red L233
+L241: lea L252, L230
+L242: .data -611, 126
+L243: .data -984, -724, 88, 787, 155
+
+L244: .string "jl"
+red r5
+L245: .data -628, 376, 691, -479, 846, 17, -236, -978
+L246: .string "djjcwh"
+not L265
+L247: .data 42, 526, -426, 74, -564
+L248: .data 826, 24, -690, -956, 439, -234
+L249: .string "nqcn"
+L250: .string "wlxeksedhmvvqusuwgnn"
+L251: .data -152, 404, -789, 23, 737, 148
+sub r7, r4
+sub #-134, *r0
+L252: .data 3, -350, 648, -616, -191
+L253: .string "jghishwlwicolhojsp"
+rts
+L254: .string "qbd"
+L255: .data 972, -213, -717
+bne L241
+L256: .data -830
+L257: .string "wnrwulioeiqf"
+L258: .data -457, 168, 151
+L259: sub L297, r4
+L260: dec r2
+cmp #-168, r5
+L261: .data -450
+L262: .string "mxiaejhw"
+sub L248, L88
+L263: .string "jhdmrievesfgsuwj"
+stop
+L264: .data -84, 667, 94, 485, -629
+L265: .data 276, 900, -164, 537
+L266: .data -280, -729, 208
+L267: .string "j"
+L268: .string "zivckihnodcmltnmblus"
+L269: .string "fnarvatgcesuqsesyvbsbrw"
+red *r6
+L270: .data -287, -116, 102, 337, -34, -772, 774, -574
+dec r2
+L271: .data -677, 595
+cmp L112, r0
+L272: .data 997, -295, 725, 407, -291, 477, 694, -311
+L273: bne *r1
+not r7
+L274: .string "baglujynj"
+L275: .data 505
+L276: .data 528, 772, -761, -102, 987, -303, -538, -150
+L277: .string "uuswoklcapzpswf"
+L278: .data -657, -739, -892, 668, 360, 601, 912
+mov L301, r5
+jmp *r3
+L279: .string "gwei"
+bne *r2
+L280: jmp *r6
+prn #-247
+L281: .string "b"
+rts
+L282: .string "ttgcktkejo"
+L283: .data -701, 953, 605, -398, -825, -593, -64, 317
+L284: .data 188, 556, -908, -226, 152, 666, 632
+jmp L296
+L285: .string "jpl"
+add #16, r7
+dec L321
+L286: .data 954, 825, -340
+L287: .data -303, -506, 913, 35, 781, -408, 959
+L288: .data 952, 144, 220, 22, -803, -331, -379, 248
+L289: .data 509, -849, -287, 14
+L290: .data -519
+L291: .data -883, 989, -788
+
+L292: .string "py"
+L293: .data 283, -40, 705, 906, 454, -228, 248
+L294: .data -595, 283, -946, -283, -817, -211, -509
+L295: .string "pizedrfwqt"
+sub L55, r0
+stop
+L296: not r5
+L297: .data 285
+mov #-242, *r3
+dec r6
+L298: .string "ezsxvi"
+rts
+add L246, *r4
+rts
+L299: .string "sqgckipm"
+L300: .string "iryriasgvzncygmof"
+rts
+lea L314, *r5
+L301: .data 65, -366, 959, 670, 148, 522, -88
+L302: .string "i"
+sub r3, L318
+
+L303: .data 700, -257, -257
+sub L134, r2
+L304: .data 390, -936, 67
+bne L315
+L305: jsr L46
+L306: .data -247
+L307: .data -413
+cmp *r3, *r2
+L308: .string "ofzdgxyilazea"
+
+inc r3
+stop
+L309: .data 272, 536
+L310: .data 576, -801, -658, 934, 485, -620
+rts
+L311: .string "yoabnlzqwkztyvtzbcxtvicc"
+lea L313, L9
+lea L176, r0
+L312: .data -124, 920, -155, 716, 915, -213, -851
+cmp #11, r0
+add *r6, r1
+L313: .string "vsnf"
+jmp *r5
+L314: .data 160, 320, -691
+L315: .data 539, -151, 873, 841, -97
+L316: .string "pmdhwkntwezskjit"
+L317: .string "exitnbq"
+L318: mov r6, L76
+L319: .data -346, -297, 802, -948
+lea L321, *r4
+L320: .data 789, -329, 122, -577, 158, -448, -976
+stop
+L321: .data -383, 792, -754, 108, 373, -565
+L322: .string "lqrpxxw"
+L323: .string "cmfuohltthbrdzipuqeket"
+L324: .string "xxnebqkikyq"
+bne *r1
+L325: sub r2, *r6
+L326: .data -284, 705
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 8
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+lea L136, r1
+L0: .data 519, 447, -524, 72, -461, -92, 87, 279
+L1: .string "yejngnddfj"
+L2: .string "yrlybjyjw"
+L3: rts
+clr r6
+L4: .string "kfezqjweynurbtdcucgbbsk"
+L5: .data -310, 364, 884
+L6: prn *r3
+L7: .data 47, 463, 18, 150, 789, 584, 573
+stop
+prn r6
+; comment
+L8: .string "rtdvgvgdbugdxjzuubin"
+L9: .string "cxytzzojn"
+not *r4
+L10: .data 784, 684, -338, 507, -736, 819
+L11: .string "sclvoaquxwthe"
+L12: .data -821
+bne L3
+L13: stop
+L14: .string "lapzybfuckfipkpozoayudt"
+prn r2
+L15: .data -843, 634, 203, -913
+rts
+dec L42
+add r6, L313
+L16: .data 393, 648
+mov r5, r4
+dec *r1
+L17: .string "ngfwcbgklmjzgtgehe"
+add #-189, *r7
+stop
+rts
+add #-27, L78
+dec L173
+; comment
+L18: .data 147, -106, -859, -77
+L19: .data 302, 892, -381, 881, -191, 981
+L20: .data 214, 579, -417, 581, -341
+
+L21: .data 999, 716, -525, 303, 284, 704
+L22: .string "qeuexlwf"
+L23: .data -265, -241, -533, -288, 633, 82
+L24: jmp L290
+L25: .string "tyma"
+L26: .data -23, 74, -310, 81, -14, 294
+jsr *r0
+L27: .string "fdgnzvzonpro"
+L28: .string "tvfyyrishjpkegdsedayjcjm"
+L29: .data -475, 519
+L30: .string "iibitrqbxxlswxdmh"
+
+L31: .string "buwxzcvnnsukxuidjdbf"
+rts
+L32: .data -106
+dec L107
+L33: .string "polwnrdmvaqmrhwimcqy"
+L34: .string "wolliyhixlmyqsxkihjpfzya"
+L35: .data -528, 216, -779, -575, 686
+L36: cmp #100, *r1
+L37: .data -708
+L38: .string "phdahu"
+L39: .string "pss"
+prn *r7
+red L37
+L40: .string "ar"
+L41: .string "lfjwg"
+L42: .string "xsenytrgdqubhnw"
+rts
+L43: .string "olspuihznkbuqmndghzoep"
+L44: .string "rydpwmzniltn"
+
+inc *r6
+L45: .data 207, -202, 107, -668, -270, -85
+
+L46: add r5, r4
+lea L7, r7
+L47: .data 14
+L48: .string "x"
+L49: .string "cuuhjlwmjjys"
+L50: .string "kulvrgkozosyvwqiuhzh"
+
+L51: prn #-213
+L52: .data -754
+L53: .data 714, 498, 983
+stop
+not *r3
+mov *r5, L7
+L54: .data 389, -501, -177, -415
+
+L55: .string "cbsdbjegykceg"
+stop
+rts
+inc *r7
+L56: .data 633, -846, 438
+L57: .string "sqttknmvtfgpnqxwt"
+L58: .string "oniova"
+not L177
+
+L59: .data -91, -910, -673, -209, -264, -711
+L60: .string "mracmkmozn"
+prn L26
+L61: prn L29
+L62: .string "gksknoapzmjbleyv"
+stop
+L63: .string "pudocoeaghkel"
+L64: .data -536
+L65: .string "efonktghvthdiagfxmcou"
+L66: .string "mms"
+rts
+jsr *r2
+L67: .data 724, 623, 73, 836, 493, -852, 732, -660
+L68: .data 849
+L69: .string "haiftrhyuqkrlanj"
+L70: .data -21, -535
+cmp *r6, L50
+dec r6
+L71: .string "ampuqscrlprirzc"
+prn #150
+stop
+L72: .data -857, -450, -284, -478, -184, -192
+L73: mov L20, *r0
+L74: .string "xejjcszweitqbphlenidn"
+L75: .string "whampm"
+L76: .data -367, 659, 925, 475, 598
+stop
+sub #-82, *r5
+L77: .data 875, -370, -850, -402, -386, -646, -428
+L78: .string "w"
+L79: .string "dirijpzjftnmhnwjwt"
+stop
+not r3
+; comment
+L80: cmp #-213, *r1
+L81: .string "hjojbcihuqvfkesfag"
+cmp r4, L65
+L82: jsr *r6
+L83: .data -737, -253, -229, -597, -969, -248, -407, -850
+L84: .string "cvall"
+L85: .string "visjnikg"
+bne *r6
+L86: .data -71, -397, 40, -792, 463, -478, 743
+lea L282, L44
+add L260, r7
+L87: .string "cgrzjpcjpgrpwoit"
+L88: .string "iiuuuqrltq"
+L89: .data -119
+sub *r0, L254
+L90: .data -917, 476, -490
+not *r7
+L91: .data 579, -529, -184, -260, -220, -933
+L92: .data -340, -473, -839, 300, -853, -16, -705, 632
+L93: .string "uzujgjmxe"
+L94: .string "mqusnrudbgzjetkcfl"
+L95: .string "ibhusysszrxhdevfay"
+L96: .string "tdndfykwkmbjapteoiqtsyq"
+rts
+add r2, r1
+sub *r5, r5
+L97: .data -427, 876, 323, 901, -892, -398
+L98: .string "adiyeaccheclqthxfnpjntd"
+L99: .string "uumskyojcvoysww"
+L100: .string "kw"
+L101: .data -815, 990, -617, -512, -440, -25
+L102: lea L121, *r7
+; comment
+jmp L198
+L103: .data -222, 641
+; comment
+L104: .string "yzvlvqovywabtqnxrej"
+L105: .data 833
+not L88
+L106: .string "qdqatrgkgdnydlitsxxeb"
+L107: .data 765, -901, -988
+L108: .string "k"
+L109: .data 631, -55, 685, -69, -683, 194, 796
+L110: .data -356, 747, -379, 652, -67, 85, 177
+L111: .data -57
+
+stop
+L112: .string "b"
+bne *r2
+L113: .string "dfkmnvvnttk"
+L114: .data 768, -691, -7, -168, 463, 450, 399, -310
+L115: .string "veafyxhebnucs"
+L116: sub r3, r3
+L117: rts
+L118: .data 481, -904, -904
+mov r2, r1
+L119: .data -282
+L120: .data 438, 404, 853, 411
+L121: .string "eymqorofhxygeultncbig"
+L122: .string "kwqo"
+L123: .data 911, -439, -999, 362, -397, -703, 791, 102
+L124: .data 970, -581
+L125: .string "qrwdkylpwore"
+rts
+L126: .string "e"
+L127: prn #219
+L128: .data 139, -608, 668, 464, 86
+L129: .string "c"
+L130: .string "tlvdfsvxgfdjilab"
+L131: dec *r3
+L132: .data 931, -903, -459, -131
+prn #223
+clr *r5
+L133: .string "uk"
+L134: prn *r1
+L135: .data 891, -449, -944, -654
+L136: .string "hghebpnlkrdlmmchjxsgcyk"
+L137: .string "htg"
+inc L51
+L138: .data 453, -619, 672
+L139: .data -615, 882, 239, -809, 593, -567, 69, -25
+L140: .data -939, 799, -786, -882, -294, 881, -709, 572
+; comment
+lea L86, L33
+L141: .string "jcgeilmhfumta"
+clr *r5
+lea L78, L10
+bne L276
+L142: .data 425
+L143: .data -820, 103, -696, -758, -674, 0
+L144: dec r1
+L145: .string "xt"
+L146: .string "wqiyfvyehklevhfmp"
+rts
+L147: .data -35, -269, -929, 245
+L148: lea L214, r6
+mov L36, L9
+L149: .string "xfclykyayg"
+L150: .string "qswsedlmzcdzjqvaxnouao"
+inc r6
+L151: .string "gkg"
+cmp *r3, r2
+L152: .data 127, 917, -726, -675
+bne *r0
+L153: .data 530
+L154: .data -638, -269, 243, 975, -651
+L155: jmp L144
+L156: .string "asabqp"
+jsr L319
+L157: .string "hqionkavyoupmc"
+dec *r1
+
+L158: .string "agovqurmnwpyhdcrttskwbv"
+L159: add r2, L264
+L160: .string "mmrpytdzxgjblajhpiw"
+L161: .string "hrxma"
+L162: .data 906, -835, 618, 447, 13
+jmp L308
+
+clr L229
+cmp #-82, L144
+not r7
+L163: .data 845, -284, 101, 301
+L164: .string "dusj"
+L165: .string "lxbt"
+jmp *r6
+prn #-139
+L166: .data 654
+L167: .string "arxvgjennykp"
+inc L223
+L168: .data 779, -764, 187
+L169: .string "idnzrgcgd"
+L170: .string "xha"
+rts
+sub L201, L95
+L171: .data 137, 271
+L172: .data 724, -679
+bne L263
+L173: .data 71, -96, -480, -41, -736, -361
+not r4
+rts
+L174: .data 154, 396, -386, 81, -731
+L175: .string "uweh"
+cmp *r1, L180
+L176: .string "lwtyrivgrcdyzjxvktglgif"
+L177: .data -334, -195, -385, -194, 653, 217, -41
+L178: add #149, L191
+L179: .string "fvslyfdcejohblqdheznjuh"
+L180: .data -769, -728, -73, -802, -829, 393, 848, -807
+sub #228, r4
+L181: .string "tyzeflrfmhetndcueyo"
+L182: .data 985, 909, -548, 873, -206, 783, 576, -887
+sub *r1, r6
+clr L3
+L183: .data 650, 11, 108, -85, -470, -890, -746, -716
+L184: add r0, *r4
+not r2
+L185: .string "qqwlzsdeclomeohbqrnhxkn"
+red L74
+bne L251
+L186: .data 609
+L187: .string "ce"
+L188: .data 91, -319, -590
+sub *r4, r7
+L189: .string "iecvbhbusdhir"
+L190: .string "lj"
+L191: .data -595, 558, -40, -76, -537, -995, 282
+jsr *r2
+L192: .data -732, -145, -828
+L193: .string "lcxo"
+L194: sub L102, r6
+L195: .data 206, 23, 4, 513
+stop
+add #-72, r6
+L196: .data -774, 171, -171, -894, 895, -179
+L197: .data 509
+L198: .string "yakbaabkvtjtxiy"
+L199: .data 997, -28, -383, -785, -353, 77
+L200: prn r3
+not L38
+rts
+L201: .data 892, -834, -522, -680, -528, -340, 365
+L202: .data -639, -628
+add r1, *r6
+L203: .data -464, 923, -499, 434, 474, -299, -987
+L204: .data 110, -25, -595, -237
+jsr *r7
+L205: .string "fn"
+sub *r3, L168
+L206: .data -497, -59, -503, -538
+L207: .string "m"
+L208: sub L235, L231
+L209: .data 665, -197, 389
+inc *r7
+L210: .string "ikgkpidbo"
+L211: .data 476, 209, -670, 559, 923, -34, -854
+sub #-208, L226
+L212: stop
+L213: .data -878, 553, 864, 331, 224, 615
+bne *r5
+L214: prn *r1
+L215: .string "ltg"
+L216: .data 301, 998, -624, 929, 598, -902, 44, -856
+L217: cmp r6, #219
+L218: inc r7
+L219: .data -799, -287, -570, 382
+prn #-81
+L220: .string "yxusrkowojwhqfiyxiowhmrm"
+L221: .data -597, -701, -881, 863, -388, 344
+rts
+L222: .data -779
+L223: .data -754, -13, 790, -31, 333, -182, 711, 484
+rts
+not r5
+L224: .string "plihekujflausph"
+L225: .string "hvrhhlmhincgbhkrhlek"
+L226: .data -899, 682, 143, -387, -564, 995, 221, 438
+; comment
+L227: inc L257
+jsr L248
+L228: .string "ruzjdtmyxfxh"
+
+L229: .string "ilsrck"
+bne L63
+L230: .data -470, -953, -943, -689, -981, -470, -859
+L231: .data -198, 635, 134, -632
+L232: .string "tvrwcaxhbhazhibejltrazpl"
+mov #248, L272
+red L68
+L233: .string "jhkpjcccxrqxbzwigi"
+L234: .string "rcxqhaew"
+rts
+L235: .string "ybvxrqvrvfijobauo"
+L236: .string "yraftdibsw"
+jsr L45
+clr L317
+L237: .string "lmytxmwt"
+; comment
+prn r2
+L238: .string "p"
+L239: .data -784, 182, -99, -788, -514, 502, -589
+L240: red *r6
+jmp *r3
+not *r0
+L241: .data -227, 815, -406, -196, -800, -882, -754, -998
+mov #90, r6
+cmp *r6, *r5
+L242: .string "illdxtnyeobyeig"
+not L252
+L243: .string "jtuebpilalrffeiwrdirsu"
+L244: .data -754, 119
+L245: .string "armrcjfelv"
+rts
+L246: .string "ulbplb"
+L247: .data 278, -300, 133, 470, 516, 256, -457, -791
+inc L17
+L248: .data -867, 430, 112, 362, -231, -987
+L249: .string "kvst"
+clr r7
+L250: rts
+L251: .data 912, 202, 976, -105, -392
+L252: .string "dzddlipytzapcylswlgpeq"
+L253: .string "sfwkdlp"
+L254: .data 138, -509, -291, -941, -372
+L255: .data 760, 278, -992, -731, 101
+L256: .data 67
+
+L257: stop
+L258: bne *r3
+L259: .data -243
+L260: .string "twaadnbezszfw"
+L261: stop
+L262: .data -683
+L263: .string "apsnyscsgjcyz"
+L264: .string "ghgzygznaooxaavxzbf"
+L265: .string "sufzfre"
+red L319
+L266: .string "jhlbakveskhjrjeavjcgl"
+L267: .string "t"
+L268: .data 550, -608, 105, -157
+bne L309
+inc *r6
+L269: .string "ghmwvbrmpgtclrosowyz"
+L270: .string "zjyi"
+; comment
+L271: dec L319
+L272: .string "jfkveinbuu"
+L273: .string "ctwynmsxtumoqyrazmrrc"
+L274: .data -430, -321
+L275: .data -383, -994
+L276: .string "nfc"
+L277: .string "wgmlhlfjsdhc"
+L278: red r4
+L279: .data -486, -123, 708, -458, 958
+
+lea L259, r7
+L280: .data 39, -783, -383
+mov L167, r0
+rts
+L281: prn #-163
+L282: .string "dhlzdm"
+L283: .data 470, -843, -901, 676, 904, 186
+L284: .data 637
+L285: .data 919
+L286: .data 42, -418, -487, -847, -436, 828, -688, 970
+L287: .data -356, -161
+clr *r2
+; comment
+add r6, r1
+rts
+L288: .data 994, 582, 476, 610
+L289: .string "g"
+L290: .data 457, -233, 970, -607, 804, 358
+L291: .string "kqhhmkjlxhvcv"
+L292: .data 345, 429, 532, -377, 950
+L293: .data -38, -80, -835, -767, -932, -907
+
+L294: .string "mrgak"
+L295: .string "bceiuhlegwq"
+not L305
+cmp #166, *r5
+L296: .string "g"
+L297: .data -119, -828, 956, 694
+L298: .string "jklwdwuwpmoyhnghw"
+not *r2
+L299: .string "ktopkqhwuylkinzolguhiznx"
+L300: .data 621, -443, -972, -310, -235, -933, -154, -900
+L301: .data -673
+L302: .string "t"
+rts
+L303: .data -832, -47, -705, -338, -672, -703
+L304: .string "zzudntnlwxqnfe"
+L305: .data -841, -41, 289, 640, -8, 466, 292, -570
+L306: .string "qroywmxlfmputgnth"
+L307: .string "kwcahdrcexbvllgo"
+L308: .data -1000, 664
+sub L118, r6
+L309: .data 339, -76, 404, 568, 131, 849, -222, -253
+add L325, L45
+L310: .data -568, -299, 119, 913, -2, -597
+L311: .data 665
+L312: .data -764, -755, 620, 359, 747, -145, 177, -242
+L313: .data -834, -47
+L314: .data 362, 722, -718, 669
+L315: .data -506
+jsr *r4
+L316: .data 725, 691, 120, -297
+L317: cmp #1, #3
+L318: .data 826, -989, 749, -73, -349, 253
+red *r6
+jsr *r1
+L319: .data -626, -545, -603, -347, -917, -103, 197, -141
+cmp *r5, *r3
+L320: .string "yxqqdkwqbocpqnzvfcpjvmy"
+lea L323, *r7
+prn *r3
+L321: inc *r3
+lea L323, *r6
+L322: .data 627, -39, 313, -692, 578
+L323: .string "zctwdjtqucp"
+clr L99
+rts
+L324: .string "ivvlgdurmcxvkmzqljpj"
+prn *r2
+L325: .data -391, -844
+jmp L39
+stop
@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 71
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+L0: .string "sqveee"
+L1: .data -193, -51, -587, 733, 93, 219, -97
+L2: .string "enh"
+L3: .string "zvfuyjmujwmygujua"
+L4: .data -464, 381, 692, -392, 567, -952, -795, 31
+add #53, *r1
+L5: .data -102, 163, -771, -136, -346, -720
+L6: .data 762, 720, 56, -225, 31, 423
+lea L1, L44
+stop
+mov *r2, L0
+L7: prn *r0
+red *r2
+L8: .data 999, -564
+sub *r2, *r6
+sub #-237, L8
+stop
+lea L179, r2
+dec L158
+red r2
+prn r6
+; comment
+L9: .string "beccitrxecj"
+stop
+L10: .data 745, -798, 758, -194, -928, 793
+clr L174
+mov r0, *r5
+rts
+L11: .data 71, -457, -999, 245
+L12: .data 652, 763, -559, -577, 268
+L13: .data 121
+L14: .data -19, 633, 560, 103, 138, -707, 495, -941
+L15: .data -462, -638, -538, 836, -311, 501, 729
+clr *r2
+L16: .data 387, 743, 331, -462
+rts
+sub L0, *r4
+L17: .string "kxgtzgwdccazywnsctu"
+not r0
+L18: .data -784, -828
+stop
+stop
+L19: .data -627, -573, 337
+L20: .data 430
+L21: .data -856, 215, 629, 448, -451, 791
+L22: .data -782, 1
+L23: add *r5, *r5
+L24: .data -162, 944, -894
+L25: .data 813, 647
+sub #169, r2
+L26: .string "pifiyxonaivspdyjy"
+L27: not r3
+clr L145
+L28: prn #-100
+L29: .string "bjjrprtivposq"
+L30: add L22, *r3
+stop
+L31: red r3
+L32: .data 430, -348, -823, 640, -737
+
+L33: .string "fdi"
+L34: .string "asxzkknfmkmmjqiaczrngmnb"
+
+L35: stop
+mov #-65, L20
+bne L15
+dec L88
+L36: .string "nofcfstgarpt"
+not *r0
+L37: not *r1
+lea L7, L52
+prn #123
+rts
+L38: rts
+L39: .data 41, 934
+L40: .data 558, 217, 229, -43, 28, -735
+lea L38, *r4
+L41: .string "wvxjb"
+L42: .data 514, -121, 985, 522, -947, -117, -832, 375
+L43: .string "fxglvdgvmqkhramcncff"
+sub *r3, L97
+L44: .string "lmdeqhvnsyeiszdrqfxioheq"
+L45: .string "pdylscpunqxv"
+L46: .data -352, -250, 834, -133, -566, 786
+L47: .data 50, 349, -360, -858, 342, -413, -332, 737
+mov *r0, L3
+lea L21, r1
+; comment
+L48: .data 632, -757, -885, -691, 259, 925
+red L7
+L49: .string "trmpgrpczcuugv"
+jmp *r5
+L50: .data -290, -394, -663
+lea L222, r6
+; comment
+L51: mov r4, r0
+L52: .data 717, 514, -799
+mov r2, r1
+L53: .string "gcprngktgw"
+L54: .string "fbixaj"
+L55: .string "etbxzgymtl"
+L56: .string "bqraqvnqvctqkd"
+mov #68, r5
+L57: lea L16, r4
+L58: .string "cgopfjtf"
+not r5
+L59: .string "nkenmqsd"
+L60: .string "rg"
+L61: .data 364, -216
+L62: .string "fwampbxdnrkbmrf"
+
+L63: .data 755, -669, 698, -806
+cmp r5, r0
+L64: .data -838
+
+L65: .data 333, -790, 548, 234, -220
+L66: .string "ajscfzuh"
+lea L296, *r7
+rts
+L67: .data -777, -506
+L68: .string "ysxxtliooeo"
+L69: .string "xiplpqclrqpqjacbdfhkiw"
+lea L24, r5
+L70: .string "hfmvfnq"
+L71: .data 235, 408, 403, 890, 143, -313, -390, -212
+L72: .data -393, 648, -53, -78, 908, 515, 953
+stop
+sub *r1, r4
+L73: .string "ljinrgfcuquctlqkch"
+inc L129
+lea L183, *r3
+L74: .string "jy"
+L75: .string "bdczuyyaf"
+L76: .string "zo"
+clr r0
+jsr *r6
+rts
+stop
+L77: .string "ccnq"
+
+dec *r5
+sub r3, L56
+L78: rts
+L79: .data -727, 848, 434, 413, 535, 213
+L80: .string "owdncddltvwf"
+red L35
+L81: .data -608, 92, -478, 264, -316, -280, -451, 160
+L82: bne L21
+L83: jsr L177
+lea L46, r1
+L84: cmp *r4, *r7
+inc *r3
+L85: .string "ywxegfffve"
+L86: .data -42, -381, -745, -533
+bne L179
+L87: .string "hxcvgkdpdsxbpwtdsuznahfh"
+L88: .data -325, -35, -236, -33, 674
+L89: .string "uuoy"
+L90: .string "zb"
+L91: .string "zgjhmm"
+L92: .string "ibwstznoynwuviez"
+L93: red L19
+L94: .data 916, -303, 566, -810, 604, 71, -871
+bne L290
+inc *r2
+L95: .string "kxdfdabkiuqalouihgj"
+L96: .data -312, 442, -506
+not *r7
+L97: .data -673, 454, -791, -267, 410
+L98: .data 56, -923, -377, -488, -294, 718, -222, 757
+L99: .string "zcanwfennaards"
+lea L166, r3
+mov L260, r7
+
+L100: .string "pnsolkckhiekigpxvqslslzy"
+L101: .data 315, 644, 330, 667, 12, 745, 719
+L102: .string "ueonwjfowvnj"
+L103: .string "pcsqemwuo"
+not L16
+mov L176, *r1
+L104: red r6
+stop
+cmp #45, r2
+L105: .data -483, -312, 820, -102, 743, 251, -800
+L106: .string "ewgdszertchkpslujzdvulb"
+L107: .string "lqzqse"
+L108: .string "vbuyzedxkzerxw"
+L109: .string "gjnwnc"
+L110: .data 112, -791, 547, -70, 68
+stop
+L111: .data -272, 685, -351, -467, 803, 775, 584, -83
+L112: .string "oyjofzwhe"
+L113: .string "ftogruj"
+; comment
+L114: .data -422, 15, 72, 100
+L115: .data 925, -411, -400, -633
+L116: .string "lnqoyyuuvg"
+; comment
+; comment
+L117: .string "hvuemefxnvbnuesjzjlvcs"
+L118: .string "dxunzjvmtfcpqjyenp"
+L119: .string "cm"
+L120: add r2, L235
+stop
+bne L157
+L121: mov #-17, r6
+L122: .data 846, -321, -154, 289, -442, -851, 531, -161
+jmp L227
+L123: .string "kdwlbjqmzohviljzwdbpmp"
+sub r7, r1
+L124: .data 654
+L125: .string "qtrruhkczxmgi"
+L126: .data -282, 706, -686, 487, 736, 444
+mov #-224, *r5
+L127: .string "o"
+L128: .string "bhgmhnltoqrnwehri"
+L129: .data -636, -304, -761, 983, 763
+lea L33, r1
+L130: .data -70, 980
+L131: .data -861
+bne L105
+prn r2
+bne *r7
+L132: .data -938, -207, -160, -449, -97, -640
+L133: .data -427, 178, 572, -821, -432, 510, 91
+add *r1, *r6
+L134: .data 322, 320, 656, -97
+L135: .data -860, 546, 451, 66
+inc r7
+L136: .string "mqb"
+L137: .data 191, 84
+L138: jsr L44
+mov #-211, L163
+not r3
+jsr *r2
+; comment
+L139: .data -313, 231, 10, -779, -968, 337, -869, -988
+L140: .data 306, 218, -42, 331, -498, -282, 891
+
+cmp L269, #1
+cmp r4, #-9
+L141: rts
+L142: .string "s"
+L143: .data -570, 810, -733, -100, -863, 193, -349, -856
+jsr L212
+L144: .data 847, -106, -977, 807, -172, -284, 873, -50
+jsr L228
+L145: .data -522, 248, -659, 746
+L146: bne L134
+L147: not L95
+red r2
+L148: .string "pucozhlnkpqdrkcrowotvuk"
+L149: .data 416, 484
+clr r2
+L150: inc *r6
+L151: .string "mpvoiacefw"
+L152: .data 635, -913, 892, 872, 239, -913, 769
+cmp #27, L263
+L153: .string "djcmrk"
+L154: .string "vpnezayh"
+L155: .data -511, -158, 954, -851, 281
+; comment
+L156: prn L306
+L157: .string "pttzbpoyfzhkczfrsq"
+L158: .data -633, 970, 148, 589, 863, 312
+L159: .string "q"
+
+L160: .data 489, -738, 371, -100, 471, 7, 931
+L161: .data -68, -375, 489, -513, -579, -364, -197, 392
+clr L314
+L162: not *r5
+L163: .data -351, -855, 103, -811, 595, 936
+
+L164: .data -332, 973, 312
+stop
+not r6
+L165: .string "xowxgbletzcmok"
+L166: .data 519
+L167: jsr L82
+L168: .data 59
+dec L63
+L169: .data 432
+lea L113, *r4
+L170: .data 5, 713, 980, -641, 102, -494, -76, 12
+bne L306
+L171: .data 438, -600, -251, -845
+prn r1
+L172: .data -310
+L173: .string "okuuiwjnuroqh"
+mov r7, *r2
+inc *r4
+clr r4
+L174: .string "jyj"
+L175: .string "tuopoiekd"
+L176: .string "gnvysmorlrlyheg"
+L177: .string "rush"
+sub #-95, L144
+bne *r7
+jsr L75
+L178: .string "enizegwjsxxza"
+L179: .data 182, -281, 285
+L180: not *r5
+dec L169
+L181: .string "rcfytcxgrjicjcgd"
+L182: .data -578, 923, 164, -27, -799, 547
+L183: .data 307, 396
+L184: .data -593, 833, -309, -881, 664, -229, -803, 992
+L185: .string "zhvhyyktadr"
+L186: .string "hppynnniikkcqomkphrdmcde"
+sub *r0, *r3
+clr L196
+L187: .data 796, -807, 214, -65
+stop
+L188: .string "ykjxrc"
+sub r6, *r4
+rts
+L189: .string "lyskwaetpbiadsr"
+L190: .data 236, 903, 545, -200, -632, -936, 518, 294
+L191: .string "mg"
+; comment
+red L288
+L192: .data 149, -696, 583, 940
+; comment
+L193: .string "laxnbtlfrklwmdnlqkugnksu"
+L194: .data -662, -218, 242, 716, 992
+L195: .string "wzjgmkpweaonpzhm"
+L196: .string "weqbacxkuvtxzgh"
+L197: .data -217, 203, 865
+L198: .data 474, -675, 904
+L199: .data 130, 306, 192, -980, 21, -220, -119, -645
+jsr *r3
+red *r1
+L200: .string "slwjzjtseur"
+red r2
+lea L307, r1
+L201: .data -107, -818, 42
+red *r2
+L202: .data 360, 178
+L203: .string "yvenroaemajgiauf"
+L204: .string "e"
+L205: .data 426, -409, 878, 148
+L206: .string "cvlp"
+L207: .string "qnx"
+L208: .data 943, -164, -606, -629, -528, -386
+L209: .string "iymjct"
+prn L6
+L210: .data -744, -29, 441, 740, 185, -225, -437, -436
+L211: not r5
+sub #-141, r0
+L212: .data 357, 163, 237, 138, -571, 229, 283
+L213: .string "hxdmkwsmhylhvbicuvpxd"
+inc L86
+L214: .string "lmljsiwayzgp"
+L215: .string "eshb"
+L216: .data -764, 501, -203, -285, -432, 642
+cmp *r2, L8
+L217: .string "ihdzwzbcasepbjuefxcpaxq"
+L218: .data 354, 678
+L219: .string "pazuwdgxtgraiqqjratlm"
+L220: .string "ceoa"
+L221: .data 419, 602, 855, -303, 942, -526, -901, 443
+cmp #135, *r6
+L222: .data 887, 155, -941
+L223: .data -885
+L224: add r0, L200
+; comment
+L225: .data 108, 917, 315, -364
+add #34, L236
+L226: .data 628
+L227: .data -581
+L228: .string "rdbsjkgq"
+L229: .string "ctmoujehbtgazevpjhilo"
+mov r3, r2
+; comment
+L230: .string "rccbwcymwc"
+L231: .data 94, 673, -32, -733
+
+L232: .string "gpfwzrvma"
+L233: .string "dgjqdykxujgrnlbfxkcvmbn"
+L234: .data -277, -252, -84
+L235: .string "ucmuhtzutkpaqzpavkilra"
+L236: stop
+; comment
+L237: .data 725
+L238: .string "zeaato"
+; comment
+L239: .data 418, -7
+jsr L60
+L240: .data 371, -529, 335, 342, -466, 146
+L241: .data 416, 198, -581, -900, -961
+L242: .data -646, 973, 334, -885
+L243: .data 322, 737, -25, -584, 875, -5, 122, 534
+clr r2
+L244: .data 941, -607, -104, 626, 184, -215, -902
+L245: .data -768, -382, -511, 407
+red L232
+L246: .data 435, 990, 61, -131, -336, -551
+L247: .data 951
+L248: .string "kecvswzqmzkpxiahaeqwsh"
+L249: .data -107, 33, 210
+mov *r0, r1
+L250: .data -725, 154, 646, -10
+L251: .data -280, 405, -549, -487, 836
+L252: .string "vfuwpebp"
+stop
+L253: .data 484, 432, 598, -654, 803, 860, 879
+L254: .string "neekmbbzzqgeesamgcitgmib"
+L255: inc L147
+L256: .string "xepwdwwbzddrkwxgi"
+L257: .data -353, -422, -882, 264, -558
+L258: .string "ixsf"
+not L70
+L259: .data -513, -765, 997, 508, 243
+not *r4
+L260: .data 228, 340, 37, -270, -922, 813, -256
+stop
+L261: .data -212, 684, -511, 451, -161, 239
+L262: .string "haujsvzcxayorr"
+rts
+
+L263: .data -33, 827, 688, 770
+L264: .string "kq"
+jmp L282
+L265: .data 238, 88, 517, 398, 399, 403
+clr *r3
+L266: .data -322, -390, 381, 605
+sub *r2, L308
+L267: .string "njsqabqtniwvaasbzwmee"
+L268: bne L125
+L269: cmp #-151, L309
+L270: .string "elebdjr"
+bne L222
+cmp r3, *r3
+L271: .string "vovsamaewoxxas"
+L272: .string "ibwrstn"
+L273: .string "s"
+L274: .string "defuzgqhcyqkfvnhqoakzl"
+L275: .string "vfuxaddetdnuxgszcotbdl"
+L276: .data -894, -754
+mov L307, r6
+L277: .string "wokzfzsasulqkjnbbymvr"
+L278: .data -70, 636, 122
+L279: .string "fsrqctzoccg"
+L280: .data 377, 175, 359
+L281: .data -783, 318, 516, 319, 286
+L282: .data 410
+L283: .string "atfmkpytwdqq"
+clr *r5
+L284: lea L72, r6
+rts
+L285: inc r4
+red L161
+L286: .data -748
+jmp *r6
+cmp L307, r2
+L287: .data -417, -569, -264, 368, 352, -871, -253
+L288: .data 130, -17, -249, -142, -337
+not *r0
+jsr *r7
+L289: red L203
+L290: sub #175, *r5
+L291: .string "ubxkg"
+L292: .string "yrgbxrluu"
+not r1
+L293: .data 677, 388, -731, 465, -65, 742
+jsr L115
+mov #179, *r1
+L294: .data 993, 967, -896
+not *r2
+L295: .data -636, -174
+L296: .data 236, -1000, -108, -645, -438, 490, -947
+L297: .string "layrpi"
+L298: .data 806, 421, 875, 589, -701, -1, 412
+L299: .string "pzgpwpfhxgarqlv"
+L300: .data 135, -165
+not L306
+sub L301, L291
+
+L301: .data -307, -275, 843, 704
+not L29
+jsr L312
+cmp L107, r4
+L302: .data 192, 283, -420, 459
+
+L303: .string "yy"
+L304: .data -520, -472, -937, 410
+L305: .string "ncsua"
+L306: .data 353, -708
+L307: .string "gqhsnypdrnwxfe"
+L308: .string "oauxqcxroid"
+dec r3
+L309: .string "dtckctssekdxvdwshxfyre"
+L310: .data 580, 139, 325, -35, 827, -620
+lea L314, *r7
+L311: .string "cky"
+L312: sub #-49, *r6
+
+L313: .string "nxnn"
+; comment
+L314: .data 495, -431, -281, -302, -476, 702
+stop
@@ -0,0 +1,524 @@
+; Generated by genCorpus --seed 72
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+
+L0: .data -63, -286, -725, 325, -676, 237, 897
+L1: .data -509, 70, -734, 169, -268, 665, 737, -753
+not r3
+L2: .string "dvcvrou"
+L3: .string "wfmmyvhudgdbbevzjhbzx"
+lea L94, r4
+jsr *r0
+L4: .string "xbl"
+L5: .string "trabdkidcyqhqmxxmb"
+L6: .string "qzayycndtbeoqjz"
+L7: .data 217, 356, -419, 158
+not *r1
+L8: .data -209, -28, -322, -929, -34, 164, 169
+L9: .string "ywbvvbmlqufhpygpy"
+L10: .string "f"
+
+L11: .string "utvlmtjodcleilanrjxz"
+L12: .string "nvchobojpfgcealwi"
+L13: .string "eeub"
+L14: .string "i"
+dec r4
+L15: .data -469, -341, -718, 553, 631, -842, -871
+L16: .string "jrkqmam"
+L17: .data 728, -718, -523, 856, -681, -315
+cmp L10, *r5
+clr L8
+L18: .data -982, 210
+L19: .string "c"
+dec L40
+L20: .string "fclhxgzpdpnn"
+
+L21: .data -728, -695, 189, 360
+add L6, L5
+L22: .string "t"
+L23: rts
+L24: .data -967, -985, -669, 445, 720
+L25: .string "vrvztmznkcqemgziltyjtsv"
+L26: .string "mgljjvpaypyfgzunuqyixx"
+L27: .data -114, -308, 92, -247, 337, -355, 138
+L28: .string "qlbmydhqzpzyuicxgfyzfm"
+L29: .string "aeyholtgqtcotunxdazw"
+mov #236, L12
+L30: .string "vlofzzyazxiwh"
+L31: .data 931, -229, 556, 451, 676, -779
+L32: .string "lyvzazogucncyommc"
+L33: .data -845, -376, -16
+L34: .data 494, -193, -558, 80, -559, 812, -713, 878
+L35: add #-51, *r6
+L36: .data -2, 67, -245, 763, 101, -165, 518
+L37: .data 937, -576, -330
+L38: .string "ibqphjxeyy"
+L39: cmp *r5, r1
+L40: .data 864, 478, -990, -516, -501
+L41: .data -176, -760, -837, 70
+L42: .string "voojnfefmpkecsqybvezuj"
+rts
+L43: .data -241, 329, 997, -38, 627, -702, 359
+L44: cmp *r6, *r2
+L45: .data 426, -285, 756
+L46: .string "wshdtecrlhc"
+L47: stop
+L48: .string "vitsrkivs"
+L49: .string "lp"
+L50: .data -339, 218, 286, -624, -964, 550, -256, 748
+L51: .string "fvdhbibubsdoheoifdcuekpl"
+L52: .string "qfifckdscplfdgpvtg"
+L53: .data 68, -24, -282, -987
+L54: .data -662, 343
+L55: .data 992, 206, -419, 955, -630, -340, 272
+L56: .string "feqlfkmqryhnpqzqf"
+L57: .data -569
+L58: .string "uryijzidvyssastz"
+L59: .data -966, 139, 386
+L60: .string "zjisrskvczjwy"
+L61: .string "kmujveovkrcb"
+L62: .string "sspbgqyellmxaw"
+add r2, r4
+jmp *r0
+L63: .string "xhhzhcxgmkenoxwek"
+L64: .string "otl"
+L65: .string "vhiutimvtewkqvjum"
+bne L53
+L66: .string "zurcmxqnzrlbncjybznlo"
+L67: .data 639, 920, 405, -946, 505
+not r5
+L68: .string "ggssibzlcilcddkytxliukqt"
+L69: .data -387, 216
+L70: .data -439, -938, -543, -742, 177, -149, -316
+L71: .string "qippj"
+; comment
+rts
+dec L3
+stop
+red r2
+L72: .data 544, 881, -615, -806
+L73: .string "gtbzqxl"
+cmp *r6, #-135
+L74: .string "ekeziuwbnvbfltakfz"
+L75: .string "ceevrmonhhw"
+L76: .data -332, -947, 881, -709, -369, -418
+L77: .string "nonfxgc"
+L78: .data -575, 260, 853, -266, -769, -319, 487, 270
+L79: .data -221, 307, -530
+dec r2
+L80: .string "esshbqcumvdlqnlekxowxvcz"
+L81: .string "jzmiqvjtb"
+L82: .data 847, -329, 360, 641
+L83: .data 228, 966, -904, -817, -267, 537
+L84: .string "ymkfalzjdzl"
+bne L196
+L85: .string "vmsd"
+L86: clr r5
+L87: .data -650, -587, -538, 403
+L88: .data -509, 860, -518, 296, 535, 849
+L89: .data -905, -679, 200, -804, -901
+add *r7, *r7
+inc r2
+add L101, r7
+L90: .data -831, -681, -537, 981, -1, -181, 698
+L91: .data -991, -556, 233, -201
+L92: .data -402
+L93: .string "kucfrvpsguzghsybqqbviu"
+jsr *r6
+L94: .data -808, 575, -633, 494, -994
+L95: .string "bfyekmiliomx"
+L96: .string "invmigbpfmmuzbwf"
+L97: .string "glfrvejjswlmbbrxsjutdzc"
+L98: .data -210, -478, -204, 434, -573, -735, -65
+L99: .string "dp"
+L100: .string "rvxt"
+L101: .string "hjejnudklbpkkpd"
+L102: .string "lydrf"
+L103: .string "nbpttjxykjepgbmptkelimzc"
+L104: inc r6
+L105: .string "izlfzboymjraqoifwp"
+prn L30
+L106: .string "iozaqbhemtpfrjhenkeoux"
+jsr *r7
+L107: .string "lhvyxg"
+L108: .data 72, 136, -539, -601, -364
+L109: .string "xdivhbsxousoew"
+L110: .string "xesklwzktaiazegwujfor"
+
+L111: .data -958, 92, -819, -962, -61, -40, 14, 260
+L112: .string "wvbpngvgr"
+L113: .data -746, 555, 383, -751, -8
+L114: .string "slcbhgjdzqkpqtoccvrsmw"
+L115: red r1
+L116: .string "yo"
+; comment
+stop
+L117: .string "ocfylweydr"
+L118: .string "tqjkersviprfy"
+rts
+L119: mov #218, L17
+L120: .data -413, 674, 897, -884
+L121: .string "nvnqydqcwfmkavogkfcvuai"
+L122: .data -137, -440, -959, -479, 317, 990
+L123: .string "itdcuttdb"
+L124: .data 90
+stop
+L125: .data 363, -988, 931
+L126: .data 322, 320, -650, -95, 429, -494, 560, 172
+inc *r6
+L127: .data 739, 595, -911, 632
+L128: .string "nzsdjsow"
+jsr L67
+; comment
+L129: .string "uvcqfjkjttxftnreccapoxnx"
+L130: jsr *r4
+L131: .data -224, 219, -86, -2, -492, 904, -468
+L132: .data -811, 934, -629, 70, -417, 761, -767
+L133: .data -496
+L134: .data 689, -603, 568, 996, -431, -614, 242, -925
+jmp *r3
+L135: inc r6
+add #95, L289
+stop
+stop
+L136: lea L300, r3
+L137: jmp L47
+stop
+L138: .data -108, -413, 173, -367, 944, 439, -141, 582
+lea L89, r0
+L139: .string "wdsiygvznetrq"
+L140: .data -53, -424
+L141: .data -332, -64, 392, -778, -540, -825, 593, -655
+clr *r2
+L142: .string "hvvtgtuvavanhsn"
+L143: .string "imxyoadyqzunfmuskfasmfux"
+L144: .string "yxvzgacpr"
+; comment
+red *r2
+L145: .string "ugqj"
+L146: .data -24, -576, -149, 139, 906, 490, -314, -868
+L147: .string "wnxt"
+L148: .data -305, -893, 558, 476, -529
+L149: .string "zywprqfo"
+L150: .data 531
+L151: .string "dkzlujqaqbtgcpokpkbozuls"
+L152: .string "elrepcsr"
+L153: .string "odolcezyg"
+L154: .data -401, -536
+L155: .string "lrgtibwynuhfzll"
+L156: .string "c"
+L157: .data -928, 143, 177, 637, -174
+L158: .string "kiwtkjorlfwewfvasp"
+L159: .data 972, 327, 982, 603, -185, 441, -636, 720
+L160: jsr L304
+L161: .data 275, -543, -453, -112, -838
+bne L3
+L162: .string "vvyrhifqftdb"
+L163: .string "yhb"
+L164: .data 302, 849, 477, 113
+rts
+cmp *r0, #53
+
+L165: sub *r6, *r3
+L166: .string "ibjeghdfetr"
+not *r0
+L167: .string "zpezggcvybwtrnpeqbr"
+bne L339
+
+L168: .data -288, -753, 373
+L169: .string "ufukre"
+dec *r3
+L170: .string "ztvutrtpsbbkz"
+dec L218
+L171: .data -600, 891, -615, -683, -265, 192, 899, -730
+prn L103
+L172: clr r4
+clr L163
+L173: .string "lbop"
+stop
+L174: .data 236
+L175: not r3
+L176: .data -708, -107, -135, -860, 527, 370
+cmp *r4, r1
+
+L177: .data -989
+inc L74
+L178: .string "isgtpgynzxqs"
+stop
+L179: .string "dajhaatijcitjjyntumy"
+; comment
+L180: prn L22
+jsr L46
+L181: .data 169
+L182: .data -132
+cmp *r7, #28
+L183: .string "scnyvkozfarsp"
+; comment
+L184: .string "wgawbzonikbpdgrcfntqgnvz"
+L185: .data -22, 5, 547, 72, 680, -618, -664
+prn #-169
+L186: .string "bzafr"
+jsr L183
+L187: .data -453, 415, 706, -102, -8, 897, -959
+L188: .string "ippln"
+L189: .data -264, -826, 841, -551, -616
+L190: .string "yiryridjxfxqohdcuigfs"
+rts
+L191: .data -853, -894, -354, -800, -597, -716, -248, 570
+L192: .data 799, -422, -15, -557, 679
+L193: .data 636, 356, -649, 724, -111, -178
+L194: cmp #-213, r0
+L195: .data 537, -433, 67, -541, 406, -621, 93
+L196: .data -466, -603, 329, -257, 792
+red *r3
+L197: .string "nlrbfhhcfxezmojzy"
+L198: .string "fmnssopjuhsokjtcpp"
+dec L160
+L199: .string "ctghyyaumycijbwecr"
+rts
+L200: .string "iurpanyytqiwsxudejzuuykl"
+L201: .data 668, 208, 844
+L202: .data -278
+L203: .string "m"
+L204: .data 128, 264
+L205: .data 589, 472, 314, -810, 192, -736, -775, 807
+L206: .data -37, -933, -748, 16, -648, 868, 484
+L207: .data -178, -262, 261, 890, 111
+sub #0, *r6
+dec r1
+stop
+L208: .string "rybazhmfniccwrkqbvfs"
+L209: rts
+L210: .string "shpnlusnjgivaqc"
+L211: .data 325, 807, 342
+jsr L62
+mov L342, r1
+lea L8, L22
+L212: .data -900
+dec *r0
+L213: .string "jjbuqjodzmdscsac"
+L214: .data -209
+L215: .string "l"
+L216: not *r0
+L217: jsr L343
+jmp *r5
+lea L316, r7
+lea L22, r1
+L218: .string "hmhrhhesodswfnlzvni"
+dec *r4
+L219: .string "uyjpstneaad"
+L220: .string "flxoocrvrsnqynbb"
+; comment
+sub r0, L223
+red *r0
+
+prn r3
+L221: .data -174, -179, 640, 320, -96
+L222: .string "reyihfseqmq"
+prn *r1
+prn L153
+L223: .data -552, -909, -519, -422, -706, -273, -216, -274
+; comment
+L224: .string "nbyc"
+L225: .data -924, 785, 475, -663
+
+L226: .string "yawxzdgolbsvgdfbenyv"
+prn r3
+L227: .data -873, 90, 738, 835, -525, 405, 97
+L228: .string "varhmpokklstegv"
+L229: .string "nkgraqyevq"
+L230: .data -404, -148, -239, -353
+L231: .data -466, -391, -365, 694, 795, 326
+L232: .data -11, -200, -18, 866, 995, -656, 278
+add #116, *r2
+L233: .data -357, 95, -784
+L234: .string "hmwmhbzbkswflnklszyoh"
+L235: .string "bupnlolpaabmqyndvl"
+; comment
+bne *r3
+
+lea L275, r6
+sub #-233, *r1
+bne L300
+add *r1, L175
+stop
+L236: .data 386, -239, -876, -2, 327
+L237: .data 962, -681, -777, -999, 15, -115
+mov #154, L180
+L238: cmp #109, r6
+inc r1
+L239: .string "vxshleyhxouhulczcczglx"
+L240: .string "rgexofhdvrzowwtcq"
+L241: .string "qmyqghqszuhhmjpzshvbtact"
+clr L59
+L242: jmp *r1
+cmp *r1, *r7
+dec r6
+L243: .data -75, 224, -326, -971, -621, 652, -312
+L244: .string "qayfiuxg"
+L245: .string "nkffzniqnovruabu"
+L246: .data -100, 758, -600, -516, 331, -679
+L247: .string "ttfobppyctoupa"
+inc r1
+L248: .data -108, -246, 328, 811, -905, -47, 944, 878
+L249: .string "orvpaeodlemoarghxzscdr"
+L250: .string "jurt"
+L251: .data 35, 196, 788, 443, 592, -253, 695
+L252: .data -511, 781, 505, 339
+L253: .data -930, -633, -475, 239, 913, -362
+cmp #-216, r6
+L254: .data 946, 403, -604
+L255: .data 728, 786, 499
+lea L268, *r5
+L256: .data 121
+L257: .string "ssyshgonqzwmeezw"
+L258: .data 321, -25, -357, -382, -656
+clr L23
+L259: .data -720
+L260: .string "tlcauvack"
+L261: .string "umhvtgqbddwrpvofb"
+L262: .data 345, 150, 656, -722, -344, -577
+mov *r2, r6
+rts
+L263: .data 797
+cmp r1, r3
+L264: .data 41, 739, 701
+L265: .string "b"
+L266: .data 948, -92, 260, -4, 586, -62
+sub r0, *r6
+stop
+clr *r2
+L267: .data 716, -702, 278, 423, 603
+L268: dec L308
+L269: inc r7
+L270: .data -657, 698, 290, -199, -649, 820, -273
+L271: .data 652, -517, -900
+L272: .data 781, 622, 549
+L273: .data 56, -696, 636, 23, 914, -644, 431
+L274: .data 344, 493
+L275: mov #77, r0
+L276: .data -964, 546, 580
+rts
+L277: .string "ysjnuzqwffxtsz"
+rts
+L278: .string "whxhgmlvmcyek"
+sub L302, *r2
+L279: .data -708
+L280: .data 318, -791, 3, -417, -446, -893, -733
+L281: .string "mk"
+L282: .data -985, 39, -160
+L283: .data 46, 832, 986, 511, -307, 627
+
+L284: .data 456, 815, 500, 958
+prn #203
+L285: .data -478, -1000
+L286: .string "nbkarafvosfqrbdssgfnpn"
+L287: .data 762, -157, 298, 237, 385
+L288: .string "arlvezssmmlxoetqf"
+lea L135, *r1
+not *r0
+L289: .data -217, 164, -921, -997, 180
+L290: sub #-173, *r4
+L291: .string "zgfojmfrcmvf"
+sub *r2, r2
+L292: .data 463, -962, -459, 202, -54, -479, -673, 978
+L293: .string "labcikuvcdzbhrkubklzzwq"
+
+L294: .data -295
+L295: .data -868
+L296: .data 61, -656
+L297: .data 275, -687, 168, -140, -632, -89, 723, -432
+L298: bne *r1
+L299: .string "dzjntjpmaizxewswawgwygt"
+L300: .data 486, 817
+L301: .data -612, 407, 839, 102, -127, 289
+jsr L324
+L302: .string "jezbxbjptqlszhwwnyg"
+stop
+jsr L319
+L303: .data -662, -195, -886, 116, -491, 288
+L304: .data -300, -785, -897, -878, 266
+jmp L89
+L305: .data 107, 428
+lea L319, L247
+prn #106
+prn L7
+L306: .string "qlmibfe"
+jmp *r0
+L307: .string "wttleezkqalpxas"
+L308: rts
+add *r3, *r5
+L309: .string "iyvd"
+L310: .data 971, 541, 623
+L311: cmp L316, *r6
+add *r2, r2
+L312: .data -716, -619, 241, -977, 867, -937, -179, -149
+not L343
+L313: .string "xizbvxyfyy"
+L314: .string "ceqtdgkhgwzdblgzufzujf"
+L315: .string "ojxelobbf"
+L316: .data 82, -576, 964, 326, 440, -444, -317
+L317: .data 131, -17, 728, 784, -83, -224
+L318: .data -541, 768, 195
+L319: .string "gcbxhcetqtbgekxlxvvyg"
+jsr L78
+L320: .data -473
+bne *r3
+L321: .data 912, -306, 29, -620, 873, 699, 898
+L322: lea L42, L52
+L323: .data -496, 339, -140, -834, -490, 385, 502
+L324: .string "nntgkviua"
+L325: .string "q"
+L326: .string "purersgftbphexojcrtflc"
+L327: .data -921, 355, -230, 602, 760
+lea L339, r1
+
+bne L335
+L328: .string "evtmtmqorzspdebb"
+cmp *r3, *r1
+rts
+mov #-181, L329
+L329: jmp *r7
+L330: .data -575, 953, -47, -319, 516, -69
+add r0, *r2
+L331: .string "slolecwyjtrvbrman"
+add *r7, r2
+L332: .string "elryqqdlrkvwufnxhc"
+L333: .string "xj"
+L334: .data -203, 681, -270, -133
+L335: .string "avwjcpwru"
+jsr *r3
+L336: .string "edjfbwapmkzgrwqhu"
+L337: .data -231, -256, -140, 828, -326, -500, -357, -431
+L338: dec L204
+
+L339: .string "wfzfyxpwswhiztq"
+inc L342
+L340: .string "bovhwqojiogjkbv"
+red *r4
+L341: .string "urarmbncmvqxkyv"
+L342: .string "djchoglofulshdz"
+inc r6
+L343: .data -36, -784
+add *r1, r2
+stop
@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 73
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+L0: .string "gvcymbkkugjpdk"
+L1: jmp *r5
+rts
+L2: .data -638, 105, -231, 813, 20, -305, 756, -930
+stop
+dec *r4
+L3: .string "entlzlronueipjuav"
+L4: .data -409, -749, 452, 351, -803, 699
+bne *r3
+L5: .data -465, -935
+L6: .string "bjvjzgwlxxhhecwijhqtrms"
+L7: .data -808
+; comment
+L8: .string "vljfe"
+jsr L62
+L9: .data 868, 448
+L10: not *r3
+sub L181, r7
+L11: .string "tx"
+L12: .string "yewjueievsaqw"
+L13: .data -892
+L14: .string "skwzrhe"
+L15: .data -34, 0, 940, 446, 984, -125, 260, -606
+L16: add L166, *r7
+L17: .string "vpbkrhsdyrhasvlvwdtb"
+L18: .string "nbzttfcljitnbqmb"
+L19: .string "mhb"
+L20: .string "ajssewv"
+L21: .string "nj"
+L22: bne *r1
+red r1
+
+L23: .data 107, 870
+add #2, *r2
+L24: .data -431, 309, 359, -615, 391, -154, 832
+L25: jmp L285
+mov r7, *r7
+L26: .string "eqisc"
+L27: .data -735
+L28: .data 687, 815
+L29: .string "baogfkrznlhw"
+L30: not r7
+L31: .data -763, 493, -26, 249, -588, 5, -729
+L32: .string "vqbcwgcuthomgxnzt"
+; comment
+rts
+L33: .data 652
+L34: sub r4, r7
+L35: .data -346, 399, -155
+L36: .string "ojm"
+L37: .data -875, 986, -598, 171, -888
+L38: .data -341, 216, 52, 756
+stop
+L39: .string "bthvuyfgwcinogt"
+L40: .data 41, 552, -578, -714, 716
+cmp r1, *r0
+add *r2, r4
+L41: .data -157, -429, -125, 813, -983
+L42: .data -578
+L43: .string "gueythnkw"
+dec L33
+rts
+; comment
+cmp r3, *r4
+red *r1
+mov #221, L27
+bne L26
+cmp L296, L132
+not r1
+L44: .string "infaqvskyfomtqdv"
+jmp *r0
+stop
+L45: .data 489, 446, 309, 311, 928, -810, 971, -282
+prn r1
+L46: .string "dj"
+L47: .data -786, 107, 88, -674, 126, 773, -175
+; comment
+L48: .string "vmqlcqiuobho"
+L49: .string "xrlpywvkcudosj"
+L50: .data 456, -776, -188, -220, -337, -751
+inc *r4
+jsr *r6
+L51: .string "aemezdcspjbnmrinpkq"
+stop
+L52: .data 996, 582, 431, 357, 683, 323
+L53: .data -581, -626, -37, 748, 144, -646
+L54: .string "xmcujees"
+L55: .data 581, -767, -614, -234, -441, 778, -322, -289
+bne L93
+bne *r3
+bne *r2
+not *r5
+L56: not L29
+mov L1, *r7
+L57: .data -140, -105, 673, -552, 543, 434, -956
+L58: .string "bofpztxvd"
+L59: .string "aiwtepmxywjc"
+lea L43, r7
+clr r5
+L60: .data 476, -814, -494, 579
+stop
+cmp r2, #-231
+inc *r7
+L61: .data 866, 223, -224, 836, 647, 610
+L62: .data 544, 283, -480
+L63: .data 887, 680, -576, -43, -918, 707
+L64: .data -532
+L65: .data -453, -474, -315, 755
+L66: .data -703, 594, 488, -692
+L67: mov *r2, *r3
+clr L62
+clr *r7
+red *r0
+L68: .data 54
+dec *r2
+L69: rts
+red *r4
+; comment
+L70: .string "odpnuxfovf"
+L71: jsr *r2
+L72: .data -23, 502, -366, -588, 423
+L73: .data 596, -306, 753, -219, 364, 644
+L74: sub L36, *r3
+L75: .string "rpzocxo"
+stop
+mov L100, *r3
+L76: .data 689, -990, -665
+L77: .data -275
+L78: clr *r4
+L79: .string "aicmaglspzcuvxwciytks"
+jmp L250
+L80: .string "irdnrwobldrclsxjgb"
+stop
+bne L9
+L81: .data 659, -975, 329
+dec L249
+L82: bne *r2
+L83: .string "tdkuvxxk"
+L84: .data 255, 145, -625
+dec *r2
+; comment
+red L16
+L85: .string "pnx"
+dec r1
+L86: .string "gpoucngxxcyddamv"
+L87: .string "zhe"
+red *r1
+L88: sub #225, *r4
+mov #-242, *r3
+L89: .string "hmojdffabqru"
+L90: .data -18, -67, 427, -423, -533, -543, -810
+L91: .string "gijomptixhwhkqvamza"
+L92: stop
+L93: .string "znvtbdiy"
+L94: .string "uzmaoz"
+L95: .data -800, 170, -788, 454, -338
+L96: .data -312, -848, -30, 979, -797, -765, 480
+; comment
+L97: cmp *r6, r4
+L98: .data 39, -707, -820, 241, 702
+L99: bne L2
+jsr L274
+L100: .string "gzsotlgano"
+L101: .data -49, -403, -566, 682, 41, -271, 918
+L102: .string "rnrickhrl"
+L103: .string "fnxhomww"
+jsr *r7
+L104: .data -438, 914, -923, 709, -438
+L105: .data -939, 317, 82, -152
+dec r5
+L106: .data -844, -522
+L107: .data 893
+L108: .string "znymxqfeikmujwv"
+L109: bne L42
+jsr L206
+L110: .data -828
+L111: clr *r3
+L112: .data -972, -593, 161, -920
+L113: .data -633, -499, 366, 60, -526, -492, -138, -547
+rts
+L114: .data -168, 955
+L115: .data -843, -373, -427, 520, -222
+red r7
+L116: .string "vjmvedsol"
+add #-149, r3
+L117: .string "qbkyspywevmcnz"
+L118: .data -408, -813, 844, 763, -455, 151, 195
+L119: .data 458, 166, -108, -192, -334, -62, -775, -118
+L120: .data 599, 617, 298, 500
+rts
+L121: .string "lhkqwagriryne"
+L122: .string "hfvglbilktcep"
+clr L16
+L123: .string "cxszwjmq"
+L124: .data 728
+lea L49, *r6
+L125: .data 939, 230, -248, -429, 276
+red r6
+L126: .data 245, -962, 195, -321, 905, 624
+L127: .data 807
+L128: .string "qjxthzn"
+L129: .string "xriwhbtbyskzbqxj"
+jmp L293
+L130: .string "ikhgmviqoorzqqbl"
+L131: .string "ygqmumhscbwv"
+L132: .string "fqlegehgyuagvzadt"
+prn *r2
+L133: inc r0
+L134: .string "nmrgnydmxps"
+not r6
+L135: .data 371, -185, 132, 69, -127, 503
+L136: .string "qkypikhbwdilur"
+L137: .string "ezfadhvfwx"
+L138: .data 131, -897, 347
+red L108
+L139: .string "epjdchuzsajiqexgm"
+L140: add r5, *r5
+L141: .data 612, -583, 79, 120
+add L94, *r5
+L142: .string "xhklkzfgcbuzmmiz"
+L143: .string "gjgnpwftcyvnhlvw"
+L144: lea L188, r6
+L145: .data 74
+L146: lea L160, r6
+sub #-86, L124
+sub *r4, r5
+L147: .string "zmiy"
+L148: .data 16, -193, -405, -236, -765
+; comment
+L149: .string "nmqajqvqfdxzijztgakbqv"
+sub #-193, r4
+L150: .data 824, 394, 557, 245, 293
+red r6
+L151: .data -91, 136, -489, -617, 794, -244
+; comment
+L152: .data -463, 104, 465
+; comment
+L153: .data 943, -18, -527, -965, 278, -512
+L154: .data 732, 985, 302
+L155: .string "dvccmgi"
+dec r2
+red *r7
+; comment
+jsr *r6
+L156: .string "zvqh"
+L157: .string "rbefqvtdxjgfuytwcoxbh"
+rts
+rts
+L158: .data -691, -651, 250, -571
+lea L265, *r3
+
+jmp *r6
+L159: .string "cekgp"
+stop
+L160: .data -980, -777
+prn L53
+red r1
+stop
+bne *r2
+bne L43
+L161: .string "pa"
+L162: .data 651, -283, 791, 687, 627
+L163: .data -826
+rts
+L164: rts
+jsr *r6
+rts
+L165: .string "ock"
+L166: .data -147, -639, 618, 757, -173, 895, -438
+L167: .string "xwzndufdiuiiaavdo"
+L168: .string "dflvzctnmjyzrfnztbtraf"
+L169: .data -960, 625, 192, -185
+L170: .data 394, -493, -571, -589, 133, 213
+L171: .data -527, -306, 852, 752, -524, -392
+mov r6, r0
+
+add L101, L137
+L172: .data 42, -124, -574, 476, 224, -920
+stop
+clr r7
+clr *r5
+L173: .string "yldnrg"
+L174: .data -308, -578, -859, 565
+add L295, L312
+stop
+red L149
+prn #-121
+L175: sub #-207, L76
+L176: .data 560, -190, -648, 872, -607, 97, 636, -550
+jmp *r6
+L177: .string "yyoii"
+L178: .data 120, -562, -501
+L179: .data 244
+L180: sub r5, r4
+L181: .data 910, -238, -381, 729, -947
+bne L252
+L182: .string "wzblwu"
+L183: .string "yywcxooqpwrrscqpaj"
+L184: .string "ypqirbukixjguebdagof"
+L185: .string "ytblvfoxrgegwnizcgiaz"
+L186: .string "hidma"
+L187: .string "ms"
+L188: .string "wbwcinkdevrrmteoiuj"
+L189: .data -611, -621, 369, -504, -884, 579, -93, 106
+L190: .data 3, 805, -954, 462, -276, -145, -183
+L191: .data -708
+L192: .string "d"
+L193: .string "cnirkijroetmz"
+L194: .data -246, 377, -646, 599, 287, -638, -53
+L195: .data -708, 443, -454, 107, 758, -338
+L196: .data -564, 354, 5, 574
+L197: .data 940, 700, 762
+L198: add r3, *r4
+L199: .data -943, -358, 231, -680, 231, -83, 165
+stop
+L200: .string "kjjgmlcejutihendsuohowd"
+L201: .string "vlcycuatbrouisyssujajtvc"
+L202: .data -220, 730, -526, 778
+inc r5
+L203: .data -433
+L204: .string "zsxxuucpjq"
+L205: stop
+L206: .string "mkysdyysayjq"
+L207: .data -788, -599
+lea L264, L78
+L208: .string "jlzgwherp"
+jsr L205
+L209: .data -352, 829, 150
+stop
+L210: .data 579, -866, -167, 925, 445
+L211: .data 686, -735, 835, 648, -214, 781, -694, 225
+L212: .data -939, -602
+L213: jmp *r2
+rts
+rts
+L214: .string "bldqwuuocehhlbkyturtd"
+L215: .data 671, -344, 250, -487, 181, -237
+L216: .data 423, 525, -970, -742, 796
+L217: .string "e"
+L218: .string "hegbrp"
+stop
+dec r7
+L219: .string "mjbkwkpf"
+L220: .string "yeumpirxfajyogrojdjihjb"
+L221: .string "eymd"
+L222: .data -720, -114, -9, 843, -641
+L223: .data -13, -770, -750, 978, 216, -465, 643, 854
+L224: .string "xfdmzwblzsmdlqloz"
+L225: .string "cxjivw"
+lea L144, L292
+L226: .string "gqcjeaolzlr"
+not *r4
+L227: .string "frpsowjqev"
+L228: .string "chrplwwueruvha"
+L229: jsr L277
+L230: .string "ygpcu"
+L231: .data 704, 35, -81, -530, -262, -653, -565
+inc *r3
+; comment
+L232: .data 832
+L233: clr *r0
+dec r5
+L234: .data 269, 174, -449, -974
+L235: .data 301, -699, -390, -763, 766, -308, 349
+L236: .data -886, -332
+rts
+bne L117
+cmp r6, *r1
+jsr L266
+L237: .string "pmbijsvrohlthcbajssmxihe"
+L238: lea L104, L218
+L239: .data -619, -49
+L240: .data 490, -839, -664, -882, -201, -496, 125, 644
+L241: .string "lzwqndhjlzgglnat"
+
+L242: add r6, r3
+stop
+red *r7
+L243: .string "ph"
+bne L133
+L244: .data -740, -914, 171, -94
+bne *r0
+not *r6
+L245: .data 174, -59
+
+stop
+prn r1
+inc *r3
+L246: .data 74, -322, -212, 586, 916, 689
+L247: .data 550, 998, 907
+L248: .data 192, -196, 867
+L249: .string "eolmaaohewntvcw"
+L250: .data 933, -48, -477, -939, 413, -699, 772
+not r0
+not L186
+L251: stop
+L252: .data 715
+inc L290
+rts
+L253: .string "xowvgxqwfyabpkisrpfvtvsd"
+lea L275, r0
+L254: .data 586
+L255: .string "pxgmm"
+stop
+inc L145
+L256: .data 286, 831, -224, 927, 385
+L257: .string "luekfli"
+mov *r3, r5
+L258: .data -585, -667, 745, -257, -836, 714, -938, -639
+jmp *r6
+prn r5
+L259: .data 967, 791, -830, -217, -326
+L260: .data 590, -921, 787, 65, -419, 326, -692
+L261: .data -818, 247, 390, 174, 881, -265, 634, 188
+bne L198
+L262: .string "zmgnddgjjndm"
+L263: .string "enjtrpno"
+rts
+L264: .string "kplseb"
+L265: .data 227, -794, -942, 747, 456, -7
+L266: .data -808, 125
+prn *r7
+sub *r1, *r7
+sub *r6, r1
+; comment
+L267: sub r3, L47
+L268: .data -13, -137, -941
+inc *r5
+L269: .data -799, 788, 994, 700
+red r4
+L270: .data 711, -677, -956, 501, 807, -456, 363
+L271: .data 108, -485, 471
+L272: .data 850, -17, -677, 258, 134
+bne L279
+
+bne L289
+; comment
+L273: .string "tbrywwirdnfawzwkuqmn"
+L274: jsr *r0
+L275: .data -226, 124, 875, 816, -185, 493, -835, 487
+dec *r5
+L276: .data 271, 471, 618, 322, 437
+cmp #214, *r2
+stop
+L277: .data 151, 105, -995
+L278: .string "oonnwgflwyqctgdpbjwgtgu"
+L279: .data 361
+
+L280: jsr L286
+L281: mov L49, *r0
+add L299, L285
+L282: .string "mfvgogdxklpqdjs"
+cmp r1, r6
+L283: .string "hrkrhdapffbfxwvr"
+L284: .string "zsxkycnsftb"
+; comment
+L285: .data -326, 397, 606, -794, -360, -714, -544, 844
+L286: .string "ilgfmtaeqied"
+rts
+clr r5
+cmp L299, L110
+inc L291
+lea L291, L170
+L287: inc r2
+L288: .string "xxjftzyhhevdqbkjqozehc"
+L289: .string "kbq"
+dec r6
+L290: .string "aouzbmrzm"
+L291: .data -864, -54
+bne L186
+
+L292: .string "rzaztvyfuqj"
+L293: .string "tiaru"
+sub L308, r5
+L294: dec r2
+L295: .data -449, 785
+L296: .data 482, 294, -965, 394, -418, 94, -363, 862
+L297: .data 438
+L298: .string "coesrdbyjhddjqmjlnuroehb"
+
+rts
+L299: jsr L310
+L300: .data 543, -863, -107
+dec L84
+L301: dec *r5
+L302: .string "chafjwczpwghu"
+L303: .string "xluqcpbijepnnjrtk"
+L304: .string "esl"
+jsr *r2
+sub r0, L309
+L305: .data 95
+L306: .string "wnxdvswqgtxlrnxcysxgrugd"
+L307: .string "tepo"
+L308: .data 692, -248, 272, 714, -986, -460, -187, 64
+L309: .data 818, -180, -756, -891, 163, -526, -12, -854
+L310: .string "ftuwxhh"
+L311: .string "efzn"
+L312: dec r4
+L313: .string "lpwiynkdon"
+cmp *r2, *r6
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 74
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+stop
+L0: .string "blcpitpbdwzmvvwbbyf"
+L1: .data -624, -88, -993, 70, -901, 923
+L2: .data -363, -760, -514, -133
+inc *r5
+jsr *r2
+L3: .string "na"
+lea L184, *r4
+bne L310
+L4: .data -423
+L5: .string "qramzhwftth"
+L6: .data -216, 872, -69
+sub *r3, r6
+L7: .string "gojamhlrdialzyfuxjsyoq"
+L8: .string "zcgedmmwdeyswlamlnjc"
+L9: .data -78, -726, 330
+L10: .data 623, -671
+L11: .string "ufederreloepuq"
+lea L3, *r4
+L12: inc r3
+L13: .string "pddbqzyklaaahvzij"
+sub L308, L12
+stop
+clr L13
+L14: .string "xyevtsxy"
+L15: .string "xmrddnrgdu"
+L16: .data -588, 21, -548, -538, 762, 880
+L17: .string "z"
+stop
+L18: .data -361, 276, -478, -890, 939, -568, 33, -862
+L19: .data 695, 13, 23
+L20: .data -161, 626, -657, 627, -209, 806, -604, -66
+; comment
+L21: jsr L17
+lea L202, *r4
+L22: .string "qg"
+L23: .data 136, -27, 967, -361, -418, 623, 229, 574
+L24: .data -347, -616, -856, 343, 28, -866
+bne L99
+
+L25: .data 535, 907, -385, -451, 453, 960, 57
+L26: .string "bhjbhwqkqmwsosdjyazsrll"
+jsr *r1
+L27: .string "vben"
+L28: .string "dvvpilskeyw"
+L29: .string "z"
+L30: .data -691, -126, -847, -849, 962, -927, -57, 483
+L31: .string "ncxrtkyt"
+clr *r7
+L32: .string "btpugcvtqquwlyggnsmo"
+sub #-122, L275
+L33: .data 605, -678, 65
+clr L43
+L34: .string "ldwbwwubkc"
+L35: .data 632, -505, 433, -404, -643
+inc *r3
+L36: .string "muotrr"
+L37: .data -470, -83, 978
+L38: .data -200, 112, -211, -603
+L39: .data 182, 775, 481, -646
+L40: .data -886
+L41: .data -836, -265, 747
+L42: .data 217, 77, 294, 558, 952, -104, 965
+L43: .data -519, 739, 197, 851, 65, 706
+L44: .string "hbenqsipcyrhekvyauoup"
+sub *r6, L38
+L45: .string "bxqexlomahlokbuhvxcul"
+not r2
+cmp *r0, #185
+L46: .data -529, -809, 872, -372
+; comment
+L47: .data -811
+L48: .string "rsalarqksybyrv"
+L49: .data 107, -338, 898
+not L126
+L50: .string "zqkjnqxxv"
+add r0, *r1
+L51: .data -344, -500, 893
+L52: .data -539, 625, 634, 393, 244, -418
+L53: red L129
+L54: .data 804, -294, 239, -419, 694, 0, 226
+inc *r6
+L55: .string "ldsfdnupjzgdtidurngi"
+L56: .string "pbzolrw"
+L57: .string "xbzfqwasengzhthnxe"
+L58: .string "rkexifcqfuodfwvxvbj"
+L59: .data 334
+dec *r1
+L60: .data -465, -731, 792, -455, -578, 417, 297
+L61: .data 439, 303
+L62: .data -48, -714
+add #250, r1
+L63: .data 280, 766, 635, 414, -978, 382
+L64: .string "ajhatrvrr"
+
+; comment
+L65: .string "lfvuutjgtogdwjzrli"
+L66: .string "eetozbraexezndgohslm"
+L67: .data -440, -890, -843, -214, -353
+not *r3
+L68: .string "rcfsismumkze"
+L69: .data 188, -971
+L70: .data 493
+L71: .data 952, 630, 348, 357, 85, -515
+L72: .string "imlvzxuopkcsa"
+cmp r2, *r3
+L73: .string "plvepe"
+L74: .data -292, -41, -381, -12, -336, 261, 89
+L75: .data 836, 271, -170, 851
+L76: .string "abuqcgzukiw"
+L77: .data 1, -193, 959, -979, -788, 189, -902
+L78: .data 622
+L79: .string "wkitxace"
+mov *r4, *r1
+L80: .string "fzk"
+L81: .string "itsphzrboqauvmu"
+L82: .data -559, 878, -769, 200, -318, 622
+add #-205, r5
+; comment
+clr r6
+jmp L96
+L83: .data 976, 126, -4, -229, -696, 541
+L84: .data -814, 884, 379, 300, -195, 397
+L85: .data -996, 320, -213, -997, 170, -830
+L86: .string "peihctzsrystylnzacgli"
+L87: .string "ukusulr"
+dec L172
+L88: .data 206, -266, -308, -624
+prn r0
+L89: .data 476, 175, 583, -431
+L90: .string "zeesf"
+
+L91: .string "xqrmwldjfefhvoro"
+L92: .string "xxxizcxkxmlfycyfnrvmlcu"
+L93: .string "xpltqshcktmdh"
+L94: .string "lacrkqnpukwynp"
+L95: .data -53, -855, -199, -1000, -686, -412
+L96: .string "dd"
+L97: .data -50, 29, 752, 340, 572, -103
+L98: .string "uawu"
+L99: .string "nkewxdbcpsywfaapvl"
+prn *r3
+L100: .string "k"
+mov #-130, *r2
+L101: .data 372, -710, -270, -351, -718, 826, -750, -517
+L102: .data 509, -1, -126, 606, 590, -781
+L103: clr L29
+sub #-44, r3
+mov #-214, r2
+clr r2
+L104: .data 197
+jmp *r0
+L105: .string "xqfx"
+L106: lea L137, L177
+stop
+L107: .string "cewalzlof"
+L108: .data -37, 966, 344, 676, -540, 617
+bne L107
+jsr L198
+L109: .string "m"
+mov #-221, r0
+L110: .data -432, -313, -227, -673, 830, -994, 113, 795
+lea L133, r2
+L111: .string "frm"
+L112: .data 879, -743, -568, 86, -822
+rts
+L113: .data 211, -554, 313, 191, 357, 681
+L114: red r1
+L115: .data 254, -34, 90, 705
+L116: .data -553, 102, -955, -27, 300
+bne L31
+L117: .data 679
+L118: .data 155, -797, 41, 701, 954, -309
+stop
+L119: .data 607, -854, 977
+L120: .data 363, 29, -335, -362, -884, 687, 412, -342
+L121: .data 565, -309
+L122: .string "bcmeuuwkq"
+L123: .string "bphnfdohsrlifjkdaatdl"
+mov L98, r2
+L124: .data -166, 743, 245, 666, -634, 479
+L125: .data -742, 170, 510
+L126: .string "ffbseoiwhpfgxglvhkeg"
+L127: .data -72, 341, -154, -557, -544, -559
+L128: .data -950
+L129: .string "tfmazmvwfptlnwhh"
+add r4, L0
+L130: .data 587, 184, 752, 612, 109, -908, -262, 581
+L131: .data 460, 803, -587, -170, 516, 279
+prn L60
+rts
+L132: .string "gdc"
+L133: .string "qeidrvyvjgcpmtgknjizyjw"
+L134: .data -21, 36, 663, 496
+add *r6, *r0
+L135: .string "fihtnr"
+jsr L37
+L136: .data 141, 669, 613
+
+L137: .string "jjxherrekohjgdqhrdvm"
+L138: .data 516, -65, 493, -845, -466, -978, 509
+not r1
+; comment
+not L243
+L139: .data 19, -976, -776, 385, 447
+inc r6
+L140: .string "bfzoljoqmzztbjm"
+L141: .string "vjbolounwfnoir"
+prn L333
+L142: .data 115, -870, 334, 735, -291, -710, -125, 152
+L143: .data -381, -405, 819, 271, -195, -54, -646
+; comment
+L144: .data 56, 320, 710, 825, -903, 843, -462, -742
+rts
+jmp L77
+jmp L197
+L145: .data 191, -335
+L146: .data -448, -228, 69, -12
+; comment
+L147: prn L54
+L148: .string "rzgvtwgzbumooumkd"
+red r4
+L149: .string "utczlufuzquprhdjiaqj"
+L150: .data -113, 152, -919, -860, -220, -967, 779, 522
+L151: clr L129
+L152: .data -528, 899
+L153: .string "dnshfmhubzmqzgvuyqfut"
+add #-63, r6
+L154: .string "rwhwa"
+cmp r5, *r7
+L155: .string "xxxinkrfdvmisouqhurz"
+L156: .data 612, 895, -438
+cmp #-139, *r2
+L157: .data 857, -831, 669, -533, 637, -159
+mov *r4, L205
+L158: .string "mkzfvualycmquwdquubs"
+rts
+clr L38
+L159: .string "jqbbdjr"
+clr r7
+L160: .data -822, -530, 52, -461, -770
+bne L71
+L161: .data 658, -932, -24, 452, -38, 559
+
+L162: .string "gwtvatek"
+L163: .string "umzvnlsueqlqv"
+L164: .data -770, -542
+L165: .data 124, -488, 268, 743, 445
+L166: .data 848, 944, 643
+red L113
+L167: .data -293, -918, -157, -435, -724, 709, -770, 101
+L168: .data 290
+L169: .data -683, -469
+jmp *r6
+add *r5, *r4
+L170: .string "rxvpgtavnenqowfvqyszuy"
+L171: .data -57, 924, 387, -195, -758, -943, 129, -855
+dec *r7
+L172: .data -769, 995
+L173: .string "llovkz"
+L174: .string "bkdiqagnbtmhnsahhoa"
+L175: .data 499, 93, 489, 151, -430
+L176: .data 462, -383, 609, 83, 847, -1000
+; comment
+lea L301, L131
+jsr *r5
+L177: .string "fehpgcvarat"
+L178: .string "v"
+L179: .data 271, -244, 990, -295, -160, -86, 654
+sub r3, r0
+L180: .string "tmvhrforpsb"
+jmp *r1
+L181: .string "kgplkcrakqas"
+L182: .string "adeehumooiqudoyiob"
+inc *r3
+; comment
+L183: .data -546, -648
+L184: .string "fhzsomueuzqc"
+lea L275, L279
+L185: .data 904, -675, -264, 903, -670
+L186: .string "uolnqg"
+L187: .string "aansgdsayzm"
+L188: stop
+L189: .data 157, -909
+L190: .string "pudnsdzbbcajhduoxtuaedt"
+dec r7
+L191: .string "txnbwozsfaexzrh"
+L192: .data 676, -184, -260, -145, -79, -827, -80
+bne *r0
+L193: .string "gbwtmwlubf"
+clr *r2
+cmp #-246, r7
+L194: .string "gfugrcplkbqsjjulzgfillgt"
+L195: .string "cn"
+L196: .data -701
+L197: .data -159, -782, -694, -252, -67, -906, -882
+sub #177, L179
+bne L49
+mov *r7, *r0
+L198: .string "kpvuecspstulxdbdyh"
+mov r2, L262
+L199: .string "szzxfn"
+jmp *r0
+L200: .string "exgcpzadpghdpaqspaznpc"
+L201: .data -633, -113, 156, 96, -195
+prn r5
+L202: cmp #-68, L238
+rts
+L203: .data 470
+rts
+L204: .string "wntgbipnhkqe"
+L205: clr L22
+L206: .string "k"
+L207: .data 243, -647, -564, 792, -339, 36, -637
+L208: .string "l"
+clr *r5
+L209: .data 57, -99, 829, -132, -709, -239
+; comment
+L210: .data -39, 744, 939, -667, -187, -951, 439, 578
+L211: .data -475
+L212: .data -770, -526
+L213: .string "banvvttymaa"
+L214: .data 501, -699, 364, -23, 480, -33
+lea L201, r3
+L215: .data 880, -47, 76
+
+L216: .data -387, 719
+L217: .data 274, 365, -494, -563, -740, 670, -589
+L218: .string "fpjfwi"
+add L246, r2
+L219: .data -438, 796, 398
+L220: .string "qfecyugwjsasingaphdiune"
+L221: .string "yalvzurre"
+L222: mov L183, *r3
+L223: .string "nxeph"
+sub *r5, L52
+L224: .string "ncnxyjwjnrpivxazzi"
+L225: .string "qelfxveumbidhrehke"
+L226: .string "rwh"
+L227: .data 828, -400, -390, 874, 853, -460, -511
+prn *r4
+prn #10
+L228: .string "suoqshxaweadfdecgnuwg"
+L229: .data -541, 297, 705
+; comment
+L230: .string "usxbxgjxwhbcdhaem"
+L231: .data 629, -688, 505, 727, 281
+L232: .string "pgdh"
+L233: dec L51
+L234: .data -601, -108, 529, -136, -353
+L235: .data 779, -517, 117, 132
+L236: .string "lv"
+L237: red *r1
+jsr L89
+prn #-230
+L238: .string "tirjyv"
+L239: stop
+jsr L34
+
+L240: .data -95, 696, 931, -141, -40, 660
+L241: .string "jvnsya"
+L242: .data -23, 312, -578, -498
+L243: .data 385, 765
+L244: .data -797, 423, 448, 833, -875, -53, -852
+L245: add *r1, L71
+L246: .data -133, -58, 394, 138, -96
+L247: .data -652, 450, -326, -920, 774, -556
+L248: .data -757, -979, 512, -791, -158, -384, -892, -342
+cmp L89, r2
+L249: .data 19, 535
+jmp L321
+L250: .string "gookcebiweqcezbha"
+L251: .string "dxvtwtfylkksblekdfcp"
+L252: .string "otcledazntklckoor"
+mov #-252, r3
+L253: .data 204, 421, -383
+L254: mov r4, L5
+L255: .data 410, -754, -45, -894, 716, -396
+L256: .string "aqwfqpwzdvlacxmsbslnah"
+stop
+stop
+clr L319
+L257: .string "ezuzcdvjdwmktmgtlmqzlkzb"
+L258: .string "jneb"
+L259: .data -114
+L260: .string "g"
+L261: .string "btj"
+L262: .data 183, 846
+L263: .string "ymkgthybdheponnxk"
+lea L334, *r5
+L264: .string "wdkkhvblfkdzvzh"
+L265: .data 701, -969, -1, -552, -938, 192, -129
+dec *r7
+cmp r1, *r5
+L266: .string "jifp"
+dec r7
+L267: .data 66, -438
+lea L12, L300
+L268: .string "ugydgttasudanjdfkxsrecg"
+rts
+L269: .string "xpyekfdrmsbk"
+red L8
+L270: .data -426, -860, -888, -993, -908, -318, 851, -433
+lea L325, L308
+L271: .data -538
+L272: .string "qxjchsieunc"
+L273: .data 983, -194, 29, 698, -251, -62
+L274: .data -326, 987, 142, -258
+L275: .data -178, -188, -741, 5, -662, -473
+L276: .string "lmkahkxnocvyffrmofnsqe"
+L277: .string "qatkaevxl"
+clr *r3
+L278: rts
+L279: add L310, r5
+L280: .data 556, 134, -7, -989, -693, -962, 83, 929
+L281: .string "rcdskqjbm"
+L282: .string "nfjrfwd"
+L283: .string "mgzxvttyvazcs"
+rts
+L284: .data 450
+jmp *r1
+jmp *r4
+add #57, *r4
+L285: .string "btbvqrqrodrlslsyvtqfs"
+L286: .data -690, 261, -45
+L287: .data -375, -146, -42
+sub L328, r2
+L288: dec r0
+add *r1, L296
+L289: not L109
+red r4
+red r5
+L290: .data 109, -784, 759, -420, 6, 479, 385, -990
+cmp r5, r4
+L291: .string "kbbfyszovg"
+L292: .string "cuhosdalldynt"
+L293: .string "pmwpkgupm"
+L294: .string "zoaudozowtqjqztgc"
+L295: .string "ckjsymbrsyki"
+L296: .string "sipdyawtd"
+L297: .data -908
+L298: .data 599, 680, -44, 137, -791, -420
+; comment
+not r5
+not L62
+dec *r3
+L299: .data -185
+cmp r7, r2
+not *r3
+L300: .string "ha"
+L301: .string "uqfcrrliasxcxttfdhjz"
+sub L28, *r7
+stop
+L302: .data 671, 876
+L303: .string "ajk"
+L304: .string "lrfbzjko"
+L305: .string "oqeudozbjrwiz"
+sub r6, L326
+jsr *r3
+; comment
+L306: .data -10, 242, 127, -75, 700
+L307: .string "wcvwetc"
+L308: .string "qiixctswhfpwz"
+mov r6, r0
+L309: .data -146, 79, -187, 639, -868, -235
+; comment
+L310: .string "wozflhd"
+L311: .data 869, -288, -484, -828
+L312: add #-131, r7
+L313: .string "ttdnmqjhddausnrlktjoqpx"
+L314: .string "bvinldtoemgh"
+L315: lea L334, r2
+L316: clr L281
+L317: rts
+L318: .string "ytxir"
+not *r0
+L319: .data -411, 279
+stop
+L320: .data 782, 636, 693, 486, 307, 571, 849, 596
+L321: .data -143, -287, -406, 847, -572, 786
+L322: jmp L332
+L323: .string "wlyanejtisvdbss"
+L324: .data -832, 889, 216, -701, -576, -447, -194
+L325: stop
+not *r0
+inc L276
+sub *r5, L131
+cmp r4, *r7
+L326: .string "vylwfqsqmtkhbkqki"
+L327: .data 732, 84, -852, 830
+lea L328, L329
+L328: .data -551, 191, -94, 628, 601, 27
+L329: prn r4
+; comment
+L330: .data 13, -396, 691, 102, -30, -69, -178
+L331: .data 283
+not *r4
+L332: .string "bsvc"
+L333: .data 274, 831
+L334: .data -103, 784, 161, -963, 813, -148, -589, 226
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 75
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+
+L0: .data -803, 98, -8
+prn L0
+add *r5, *r2
+L1: .data -243
+; comment
+prn L103
+not L0
+
+L2: .string "flvr"
+L3: .string "eeipxnkqlewutgdaoibhj"
+L4: .string "tqops"
+cmp r5, *r3
+L5: .string "wj"
+prn r1
+L6: .data -352, 874, -657, -297, -169, 44, -747
+dec r0
+L7: .string "pnzbbrdyjkprtkmqaudnqvuw"
+L8: .string "sulbkhvvfonxjolbxjtckap"
+L9: .data -406
+L10: .data 152, 489, -914, 950, -237, -626, 622
+L11: clr r0
+L12: .data 927, 675, -435, -196, 162, -902
+L13: not r4
+cmp #168, #93
+L14: mov #-8, *r1
+L15: rts
+; comment
+L16: .string "mkgpqgcrn"
+dec *r4
+L17: .string "ariegkbykg"
+jmp *r0
+jsr *r2
+L18: .data 168, -560, -168, -722, 864, 879, 678, 110
+L19: .data -161, -595, 174, 3, -653, 935
+L20: prn #-29
+L21: .string "iwwmqbwz"
+not L10
+L22: .data 467, -266, -214, 849, 759, 643
+lea L138, *r5
+red L3
+inc L1
+; comment
+
+dec L6
+L23: .string "jvxz"
+L24: .data 778, 809, 369
+L25: .data -429, -496, 472, -567, -237, -169, 103
+L26: .data 389, -804, -310, -86, 227
+L27: .data -908, 129, -849, 64, -437, -788, 422
+L28: .string "cj"
+
+clr L15
+L29: .string "aicvavssvwnr"
+L30: red *r1
+L31: .string "myt"
+L32: .data 443, 727, 769, 358, 180
+L33: .data -192, 311, -841, -282, 525, 293
+cmp L134, #114
+L34: .data 796, -617
+rts
+jsr L22
+L35: not r2
+; comment
+L36: .string "ijkhxzdfaxzvtjuazyfvwboy"
+L37: .data 939
+L38: .string "euyjbektziwbwoydch"
+stop
+L39: .string "dahamqjbgqi"
+rts
+; comment
+L40: .string "waukvpittvwoaqbn"
+L41: prn L35
+rts
+L42: .string "muwogihokqcuhnzguglukyl"
+L43: .data -221, -284
+L44: .string "kmvjsargpyiczbgxmg"
+L45: .data -243, 0
+L46: .string "gqoemzsoxzyajqtq"
+prn *r6
+L47: .string "rznbelkfmjitqubh"
+L48: .data 53, 472, -724, 804, -411, -181, 231
+; comment
+bne L5
+add *r7, r6
+L49: .data 120
+jsr L110
+L50: .data 908
+L51: .string "zgnheiirnbkiq"
+L52: .data 651, 843, 184, -541
+prn #75
+L53: .string "kvvtkrygugj"
+; comment
+L54: .string "b"
+L55: .string "eujj"
+jsr L17
+L56: .data 567, -79, -458, 138, -711, -383
+cmp r3, L306
+L57: .string "oxgolnec"
+L58: .string "xqbrtjacax"
+L59: .string "uisaottyzfoorsw"
+L60: .data -737, -87, -9, 230, -307, -140, 715, 550
+L61: .data 822, -518, -985, 630, -252
+sub r0, L46
+L62: .data 295, -625, 850, 60, 388, -663, -672, 792
+rts
+L63: .data -220, -358
+L64: .data -691, 158, -582
+L65: .data 725, -962, 792, -219, -164
+prn L11
+L66: cmp *r0, r4
+; comment
+L67: .string "osfqhfbpjbkjadhnosdgcj"
+L68: .data 810, -229, 794, 830, -140
+L69: .data 426, -74
+L70: .data -878, -510, -387, 906, -627, 527
+jsr *r6
+L71: .data -538, 398, 796, -214, -294, 390, 552, 700
+bne L1
+L72: .string "iicv"
+L73: .string "ovcngnnbhjddywnsvbfaxd"
+L74: .data 75, 789, -951, -957, -384, 684, -871
+L75: .data -139, 848, 55, 275, 719, 789, 969, 90
+L76: .string "ljypvznmawz"
+L77: .data 761, -283, 119, 415, 464, 70, 385, -698
+L78: .data -937, 372, -49, 717, 151, -689, 424, -172
+cmp r0, #190
+L79: .data 775, 235, 321, 563, -199, 893, -197, -963
+L80: .string "cv"
+L81: .string "svmvlnfkuuawdmtubxymkxj"
+sub *r1, L20
+L82: .data 200
+L83: .data 587, -762, -803, -645, 57
+L84: .string "qjl"
+L85: .data -660
+L86: .data -36, -39, -73
+L87: .data -615, 985, -712
+L88: .string "tmpmvfwvknw"
+jsr *r3
+L89: .data 227, 136, 440
+L90: .string "zyyrxbeeltgeobykaplhp"
+L91: .data 319, -550, 494, -245
+L92: .string "lcteiydgghsrkcwqnuozglay"
+L93: .data 518, -398, 543, 378, 844, 151, 311
+clr *r3
+L94: .string "tkhjvgou"
+L95: .data 683, 837, -309, -482
+L96: .string "dwzcvmdipcnngziw"
+L97: .data -383, -745, -995, 377, 250
+sub #-219, L76
+L98: .string "tsqumwyhatzliwzz"
+L99: .data -92, 425, -720, -697, -727, 72, 647
+L100: .string "trjzfwasewq"
+sub r0, L77
+L101: .string "grswqpqxm"
+stop
+stop
+jmp *r7
+; comment
+L102: .string "wxlnvwhlvnyrfpjqawxa"
+L103: clr r0
+L104: .string "zqfprdgwhlyde"
+L105: .data 450, 794, 205
+L106: .data -218, -354, 790, 949
+dec r5
+clr *r1
+L107: .string "qvyqdblhd"
+L108: .string "knzggeousvofuohvvafjad"
+L109: .string "stjksudpalfbaxjdrknxwk"
+bne L55
+bne L57
+L110: .string "mhkpipmocpgfernguwthu"
+L111: .data 884, -316, 316
+stop
+bne *r3
+bne *r3
+L112: .string "aaho"
+add *r3, r6
+L113: .data -678, -238, -293, -57, -365
+L114: .data -898, -774
+L115: .string "av"
+L116: .data -762, -211, 358, -281, -505, -98
+sub *r2, r6
+stop
+add #220, L214
+cmp *r5, *r0
+L117: .data -694, 954, 477, 445, 491
+L118: .string "sueeldl"
+L119: .data -909, -95, 727, -51
+add *r1, L3
+sub *r6, *r3
+L120: .data -417
+L121: .string "letupqjzb"
+L122: .string "yhtpkqpaapjl"
+rts
+L123: .string "autzvhknywochyqgoeymu"
+stop
+prn r5
+L124: .string "llmibd"
+L125: .data -935, -273
+L126: .data 759, -675
+cmp L119, L115
+L127: .data -596, -426
+L128: .data 297, -290, 481, -732, 415, -129
+clr r6
+cmp r0, *r0
+L129: add L144, *r7
+L130: .string "xqd"
+L131: .data -18, -75, 169, -636, 191, -612, -676, -23
+L132: .string "hqkbemyzj"
+stop
+L133: .string "ssa"
+L134: .string "bstppfjvod"
+L135: .string "galgsuiti"
+L136: .string "nokcv"
+cmp L279, #17
+dec r6
+L137: .data 6
+L138: .data -213
+L139: .string "phicbwcoxsoguxaunk"
+L140: .data 201, -860
+inc r5
+L141: .data -827, -456, -66, 377, -788, -955
+L142: .data -214, -591, -421
+L143: .string "ijilrfspxnjo"
+L144: .string "auyzzkai"
+L145: .string "hpx"
+bne *r3
+L146: .data 277
+L147: .string "jnjcpnafcmucjhrwgv"
+L148: .string "xktx"
+cmp L226, L229
+L149: .data -338
+L150: prn r2
+stop
+L151: .string "vtoehzife"
+L152: .string "wip"
+L153: .string "zuvxyzdz"
+prn r0
+clr *r5
+L154: .data -160, 984, -845, -350, -840
+rts
+L155: .data -561, 932, 970, -803, -310
+L156: .data 584, -366, 559, 689, -950, -606, -342, 186
+sub *r3, r6
+inc r4
+L157: .string "v"
+stop
+jmp *r7
+L158: .data 523, 230, -794, 171, -651, -743, 842, -590
+L159: .string "so"
+
+not L25
+L160: .string "iyargpoxpdlgcejvv"
+L161: .string "cusdnqy"
+inc r7
+dec *r3
+L162: .data 243, -319, -675, -465
+L163: .string "gfuzthj"
+rts
+L164: .data 623
+L165: stop
+L166: .string "ndcmnqdqxaqrgovotm"
+; comment
+prn *r5
+L167: .data 855, -300, 579
+L168: .string "ymdnamn"
+lea L215, L194
+L169: .data 656, 380, -256, 653, 672, -892
+red L270
+jsr L223
+L170: .data 991, 651, 348, -8, 386
+L171: .string "kupsbmjyctkzwomchwor"
+bne L11
+lea L291, L10
+jmp *r4
+L172: .data 193, -980, -882, -366, -935
+L173: .string "mlsqawklnonmjbm"
+L174: .string "qxsqahfnopfjszqdooxk"
+L175: .string "gcfwsocskidsiafr"
+
+L176: .string "uamlehrgjfu"
+L177: .data 588, 89, 576, -274, 872
+L178: .data -73, -873, -645
+L179: .data 829, 317, 59, 730
+L180: .data 958, -35, -9
+L181: .string "sgjsuyfpvjbjksjcwerdjzn"
+L182: .string "gwfnbevpxaycqff"
+clr *r0
+
+red r6
+lea L283, *r7
+L183: .string "ojjynzgofaad"
+L184: .data -874, 171, -881, -883
+L185: cmp #0, #170
+L186: .string "dpibhmldmwxekkqp"
+L187: .data 496
+L188: .data 546, -609, -296, 470, 588
+stop
+L189: .data 960, -529, -450, 423, 224, -876, -148, -489
+add *r2, r3
+L190: jsr L78
+L191: .data 148, 637, -699, -496, 688
+L192: .data -423, -422, -792, 978, -77, 944
+L193: .data 347, -53, 244, -48, 900, -807, -140, -563
+dec r1
+add *r4, r1
+L194: .string "yfcoowczi"
+L195: .string "lbtrtfajl"
+
+L196: .data 672, -771, 63, 592
+L197: .data 771, 629
+rts
+L198: stop
+L199: .string "lvd"
+red *r6
+add #33, r6
+red *r2
+L200: .data 266
+L201: .data -710, -959, 564, 102, 139, -803, 74, -391
+L202: .string "kyycjzsyuemy"
+L203: .string "gzsodadubnqchojhdz"
+jmp L166
+L204: .string "eqphezyv"
+L205: .data 878, -403, -788
+L206: red r2
+L207: .string "osfwjwfwukju"
+L208: .string "nzgnbyoxtwnkzstjjbgbat"
+L209: .string "taijgetaoawqu"
+bne *r2
+L210: .string "yccipefkjrqnwexomxq"
+L211: dec r5
+L212: .string "otozg"
+L213: .string "pdkrggoykwhyof"
+mov *r6, *r2
+L214: .data -608
+L215: add r1, L19
+L216: prn *r0
+L217: .data 320, 380, 710, 357, -163, 676, 510
+rts
+L218: .string "nqvmqaxsncgynzlxjjqc"
+L219: .string "eeunjvywqjpm"
+L220: .string "jwickxwagamsmphsngfgp"
+L221: .string "lfmnsfnnwgqoppzcmerhdukg"
+red r3
+stop
+L222: jsr L266
+dec r4
+red r4
+; comment
+L223: .string "uef"
+L224: .data -532, 988, 954, 915
+L225: jsr *r1
+L226: .data 432, -270, 500, -921, -352, 654
+L227: .data -676, 195, -456, -200, 631
+L228: .string "mcshkwqievkwvvky"
+not L20
+L229: .data 704, 810, 286, -631, 853, -521, -959, -320
+L230: .string "cjiygpkwsrfeukrglou"
+dec *r4
+bne *r1
+L231: .string "ivcxfkxklicgvjmxne"
+L232: .data 712, -732, -584, 830, -289
+dec *r4
+L233: .string "uampytjczwixqbxssdgyz"
+L234: .data -174
+sub *r2, *r6
+L235: .string "mtszzxzgrse"
+L236: rts
+sub L81, r0
+add *r4, r0
+; comment
+inc L195
+mov r7, *r2
+L237: lea L84, L289
+clr *r2
+L238: .string "dccitnhrjtupbs"
+L239: .string "htmmqdopxgwjczehjbayq"
+dec L125
+clr L261
+L240: .data -437, -493, 574, 521
+L241: .data -384, -952, -782
+L242: .data 977, 8
+L243: .data -72, 242
+L244: .string "mizspewn"
+stop
+L245: .data -257, -46
+sub #33, r4
+not r3
+L246: .data -33, -346, -291, 988, 395, 930, -29
+L247: .string "jzqzbmzxbyzdywvjnmxo"
+L248: .data 304, -631, 972, -973, -786
+L249: .data 892, -2
+L250: .string "ystxuhjmfknwcqixelnioyza"
+L251: .data -136, -47, 285, 821, 562, 431, -960
+L252: .data 344, 129, 248
+sub r2, *r5
+lea L276, *r7
+L253: .string "asehgaydpjgjqdyofurc"
+L254: .data 535, -239
+not r1
+mov *r7, *r7
+stop
+L255: .string "mizohyxwu"
+L256: inc *r1
+L257: .data -585, 317, 102
+red L298
+clr L165
+not r7
+L258: .string "mmulpd"
+L259: .string "gzeu"
+L260: .data -356, -873, 914, 81
+L261: .string "xwmiidfkfynwtgxgcvwjevov"
+L262: .string "uwwrlyefxhp"
+L263: .data -286, -239
+prn L207
+L264: lea L269, L300
+L265: .string "vyfzqyfatgadtovw"
+L266: jmp *r1
+L267: .string "dwqpgkitbpzvodukamsnflh"
+L268: .string "s"
+L269: .data -854, 189, 996, -280, 831
+L270: .string "awrd"
+L271: .data -539
+L272: sub *r1, *r7
+mov L280, r6
+L273: .string "ybtnsdnzosftx"
+cmp r3, *r2
+L274: .data 252, 566, -189, -702, 729, 70
+L275: .data 991, 255, 502, -367, 695, 249, -914, 451
+L276: .data 326, 37, -40, 127, -285, 966, 780, -592
+L277: .string "dpmdornhh"
+L278: .data -82, -922
+L279: .string "wal"
+L280: add L284, *r2
+L281: lea L294, L285
+L282: .string "loblshwwwtngvdjqpwpqhonu"
+L283: .string "ls"
+L284: .string "bjdjuqx"
+L285: .data 404, -531, -769, -762, -617, 631, -543
+L286: .data -767, 138, 282, -421, 136
+L287: .data -25, -470, -206, -847
+L288: .data 707, 184, 847, 949, 690
+L289: .data 337
+L290: .data -402, 243, 384, -706, -741, -85, -127, 992
+L291: .string "bcrpficutvtexzkdfnwrwsuw"
+clr L309
+stop
+L292: .string "etwbznelqglcirxvhicff"
+L293: .string "dffgfwrrwdydjyfjvjciptu"
+inc L222
+L294: .string "an"
+L295: not *r4
+stop
+not r4
+inc L294
+add r0, r5
+L296: .string "tqyjbreyfkowjds"
+bne *r3
+dec *r7
+clr r6
+jsr *r6
+; comment
+lea L50, *r7
+L297: .string "j"
+prn L106
+mov *r0, r7
+L298: .data -167
+L299: add r2, L66
+lea L67, L72
+sub *r7, L75
+L300: .data 340, -688, 868, 893, 598, -227, 43, -792
+L301: .data 546, 109, 648
+L302: .data -725, 342, -163
+L303: .data 758, -671
+inc *r3
+prn #16
+sub #-33, L208
+L304: .data -766, -95, -476, -248, 751, 796, -576, -971
+L305: .string "sfx"
+L306: .string "bmartmosvhcod"
+dec *r4
+L307: .string "zomcsvejpq"
+L308: .data 66, 94, -618, -44, -180, -540, -662
+; comment
+L309: .string "mxxytpoyzci"
+clr L76
+L310: .string "ukfvsivdumqigow"
+jmp L141
+L311: .data -331, 777, -120, -913, -750
+L312: .string "ovjivgvaztjbbjfkjebmh"
+L313: .data -918, 866, -314, 895, 816, 547, 280
+L314: .string "nvjciem"
+L315: .data 644, 437, 723, 567, 801, -1000, 655
+L316: .data 959, -43, 373, -341, -767, -760
+L317: .string "gqiqdsxpwbic"
+not r7
+L318: .string "mceydypjenw"
+L319: lea L320, L320
+L320: prn *r2
+stop
@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 76
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+L0: clr r3
+L1: clr r4
+red *r6
+L2: .data 689, -775, -520, -745, 898, -768
+L3: .string "pnr"
+L4: .data -725, -475, 93, -73, 967
+L5: .data 385, 655, -670
+L6: .data -905, 639, 96, -280, 610, 768, -935
+L7: .string "hpsgwblvunvvnkjlyulfn"
+L8: .string "lyngsbtzdiabmaqa"
+dec *r5
+L9: .string "lufajffyol"
+L10: .string "lhslhdjrnqlmd"
+L11: bne *r6
+not r3
+rts
+L12: .string "excckngttvp"
+L13: .string "fgbw"
+L14: lea L86, L106
+L15: red r1
+red r0
+jmp *r3
+L16: .string "xsgjl"
+L17: sub *r2, L8
+dec L14
+L18: .string "idcqi"
+lea L10, *r2
+inc *r3
+L19: .data 649, -939, 312, 215, 64, -933, -521, 855
+L20: .string "eawzfftnsnbqolmuhbxhwt"
+L21: .data 936, 637, -419
+L22: .data -932, -120, -505
+L23: not L193
+L24: .string "cih"
+L25: .data 334, -492
+L26: .data 577, -697, 289, 965, -212
+L27: .string "nrzpygnjk"
+L28: .string "vfjeyoexbmcrpeu"
+L29: .data -202
+stop
+sub r6, L138
+sub #251, L303
+not r2
+L30: .string "gbkijqifejjfwdcojylvpgv"
+L31: .string "jbggnzdoqpctstsyz"
+L32: .data -437, -584, 26, 406
+L33: .data 915, 559, -842, 983, -432, -24, 690, 186
+; comment
+L34: .data -507, 581, -883, 76, 457, -354
+L35: .string "iugoiqiokzkc"
+L36: .data -294, -162, -49, 281, -675, -754
+L37: .data -830, 710, 428, 987, -809
+jsr L11
+L38: .string "godvcl"
+red *r6
+bne *r3
+jmp L27
+jmp *r3
+L39: .string "ziwb"
+L40: .data 772, 988, -501, 676, 901, 670
+L41: rts
+dec *r2
+
+L42: .data -216, -734, 711, -134, 914, 805, -475, -434
+
+L43: .data -609, 347, -386, -933, 674, 698, 951
+L44: .string "qsgmdgqxnrkjncexdkc"
+L45: .data -882, 775, -160, -901, 590
+L46: .string "dhotvhfacm"
+L47: rts
+L48: .string "qxleuqgznyvrlo"
+sub #7, L33
+L49: .data 242, -79, -804, 885
+L50: .data 988, 233, 700, 459, -115, -609, -103, 134
+rts
+L51: not L84
+L52: .string "ehznzfm"
+stop
+L53: .data 20, -678, -35, 370, -586, 975, -324
+clr *r6
+add #211, L232
+cmp L69, r5
+L54: .data -873, -397, -856, 764, -381, 488, 116, 144
+inc r0
+add *r2, *r7
+L55: lea L17, *r0
+L56: clr r6
+
+L57: .string "syhuhlmtwdkccvpoegyrzj"
+L58: .string "ohsxcbeetbgjblfiauiqdc"
+L59: .string "iwtkfndwj"
+stop
+L60: .data -752, 954, -833, -638, 746, 27, 811, 831
+L61: .data -171, 659, 716
+L62: .string "naphkybbfxw"
+clr *r1
+L63: .data -306, 213, 482, 70, -404
+bne L171
+L64: red r5
+L65: .string "brujijcktrlcpuiispd"
+prn r6
+mov r3, *r7
+L66: stop
+sub r2, r1
+
+L67: .data -743
+L68: .data -445, -304
+L69: not *r2
+clr L24
+L70: .string "jvdnzqnv"
+L71: jmp *r0
+L72: .string "mfworkimaxdfkhffhfol"
+jmp *r5
+L73: .string "aknelglronwtunqxhn"
+L74: .data -695, 714, 423, 979, 346, 231
+L75: .data 891
+L76: lea L173, *r0
+L77: .data 681
+
+jmp L150
+L78: .data 511, 740, 261, -598, -897
+L79: .string "xcioxttbnb"
+L80: .string "hwcjcbu"
+cmp *r0, *r3
+L81: .data 129, -510, -494, 157, 597, -975, -172
+L82: .string "usibevunrpbvpervriyqz"
+L83: .string "xroolpkezu"
+L84: .string "tabsasuuahsqzfiei"
+L85: .string "ypkebgm"
+L86: .data 394, 508, -675, 69, 308, -209, 368, -511
+
+L87: .data -718
+L88: .data -399, 0, -133
+L89: .data 387, 454, -224, -323, 6, -611
+L90: .string "cpskbqrpavbixaku"
+cmp r4, r2
+L91: .data 330, 840, -522, 158, 605
+L92: jsr *r1
+; comment
+L93: .string "rbfjviqhjo"
+jsr L236
+L94: .data -254
+L95: .data 197, 219, 14, 350, -786
+L96: .string "iynungfftqlrywgqslc"
+L97: .string "n"
+stop
+L98: .data 962, -367, -980, -900, -625
+cmp #207, #-245
+L99: .string "mgkyqbezyska"
+rts
+L100: .string "hulfxhrnist"
+L101: .data 523, 830, -403
+L102: .data -461
+L103: .data 627, -480, 939, 120, -783, -877
+L104: .string "rmntfwrmltvmrtdzpfy"
+L105: .string "tkeqqdoyqnrxknipseqqkv"
+L106: .string "gbitamftg"
+L107: .string "imfwawqjcfdea"
+L108: .data 825, -147, 99, 148, -165, 511, 755
+L109: .string "wel"
+L110: .data -99, 637, 231, -910
+
+L111: cmp r3, *r0
+sub L83, *r1
+clr r5
+L112: .string "zudrurialmjhosi"
+L113: .string "wsysipyajuuuhnreyfkfwc"
+jmp L123
+L114: .data 84, -219, -521, 437, -995, 910, 294, -672
+L115: .string "e"
+; comment
+L116: .string "guhzckjk"
+prn L182
+jmp *r6
+L117: .string "non"
+L118: .data -509, -290, -389
+L119: .string "fgdgaratgxidsezhw"
+L120: .string "hwvhvcg"
+
+bne *r6
+clr L314
+L121: .data 970, -247, 784, 545, -783
+L122: .data 93
+L123: .string "bqxsfogalrfepoxplao"
+L124: .data -195, -210, 773, 922, 178, 685, -923, -789
+L125: .data -501
+red r5
+stop
+cmp L248, r5
+clr L201
+L126: .string "eftaqporjlqrbeqsavlqbnmm"
+inc *r1
+L127: .string "ynyn"
+L128: .data -211
+L129: .string "vtwbtmixd"
+not *r3
+L130: prn L123
+add #-2, *r0
+L131: .string "opeaywxkhawadtmd"
+L132: .string "yivaynoycgmwov"
+L133: .data -854, -794, -386, 150, -567, 31, -449, -148
+red L250
+L134: .string "yofcscheftashwoukbtgi"
+prn *r2
+L135: rts
+L136: red L246
+L137: jmp *r3
+lea L272, L275
+L138: .string "ymalijeqwjognmfocom"
+not r4
+
+inc r3
+dec L1
+; comment
+; comment
+L139: .string "vwsykpsdwjbhxsmye"
+not *r1
+lea L297, r1
+stop
+L140: .data 730, -119, 600, -46, -353, -403
+L141: prn r2
+rts
+L142: .data -110, 646
+L143: .string "oskyaoaudeisme"
+L144: .string "owlvvkiyfjorkvasrgtp"
+L145: .data 35, -367, -505, 799, 743, 158, 642, -516
+L146: .data -636, 579, 984, -339, 93, 595, 97
+L147: jsr *r5
+L148: not *r4
+L149: .string "xhcqolnnqe"
+L150: .string "utaaxslwtavkte"
+add #-26, *r6
+L151: .string "liwdp"
+L152: .data 987, 850, -395, -158, -804, -181, -854, -733
+L153: .string "pedjqcuuvqqftdigbqvn"
+L154: .data 974, -853, -475, 154
+not L169
+L155: .data -823, -61
+; comment
+L156: .data 577, -733, 546, -84, -125, 706, 312
+L157: add L280, L43
+prn r6
+L158: .data 559, -82
+L159: .string "yfuc"
+dec L91
+jsr L225
+L160: .string "uzevm"
+L161: .data -975, 892, -627
+bne *r0
+L162: .data 857, -144, -42, -490, -980
+L163: .data -261, -827, 832, 356, 614
+L164: .string "hadnhs"
+L165: .string "ztmqhreise"
+L166: .data 913, 574, -5
+
+jsr *r7
+add *r1, *r2
+dec r4
+L167: .data -453, -518, -176, -5, 890, 837, 376, 380
+L168: .string "addejdjpkstyowixkblxatwn"
+inc *r3
+jmp *r6
+L169: .data 8, 729, -661, 735, 372, -354, -860, 505
+; comment
+L170: rts
+add *r1, r6
+L171: .data 6, 462, -870, -156, 771, -565, -446
+L172: .data 303, -923, -580, -457, 551, -266, -444
+L173: .string "ypubeurbtlavlfusot"
+L174: .data 598, 79
+jmp L195
+L175: .data 477, 176
+jmp L207
+L176: .data -890, 593, -378, 760, -824, 187, 639
+sub #-192, L292
+jmp L190
+jsr L82
+jsr *r6
+not *r7
+L177: .string "igbxcqdtqvgvdhchpxtkzcvi"
+L178: .data 432, 401
+L179: .data -709, -392, -168, -968, -254, 980, -489, -475
+L180: .data 840, 154, 789, 17, -253, -39, 303
+L181: .string "gqhotes"
+clr L151
+stop
+L182: .data -460, -405, -810
+L183: .data -334, 806, 187, 302
+L184: .data -773, -980
+L185: .string "begzvix"
+L186: lea L214, L51
+
+L187: add L207, L165
+L188: .data 112, -224
+L189: .string "zzvetyqxpehgxrmfeg"
+L190: .data 909, 267, 800
+lea L7, *r6
+L191: .string "vlzaanp"
+; comment
+bne *r4
+L192: .string "wznmgjdtflwxf"
+prn #-35
+bne *r5
+L193: .string "reu"
+sub #180, *r6
+L194: .string "bnmmwsslvoinqlpuafe"
+L195: .string "cshsqvbyhkunmahn"
+L196: .data -838, 741, -184
+L197: .data 406
+L198: .data -128, -908, 418, 808, -845
+sub r5, r7
+prn *r1
+L199: .string "yfqzqgr"
+L200: .data 589, -11, -512, 642, 957, 896
+L201: .data 68, -447, -885, 445, 92, 117
+L202: .data 561, 25, 991, -5, -779
+L203: .string "xgplilz"
+L204: .string "ynupds"
+L205: .data 596
+L206: .string "epzbqmaahavkeeefcesuypws"
+stop
+L207: .data -497, -441, 292, -81, 600, 634
+
+clr r2
+L208: .string "qzm"
+prn #-190
+rts
+red r7
+L209: .string "pvdtwimejlzpmktnozzxt"
+
+L210: .data 914
+jsr *r6
+L211: .data -700, 184, 354, 734, -496, 645
+L212: .data -190, -58, -244, 359, 154
+L213: .data -747, 364, -595, -202
+red *r0
+L214: .string "hlnxwebxqlarger"
+clr L263
+L215: .string "eczutohraitdqlxcfgoe"
+L216: .data -381, -233, -93
+L217: .data 727, -281, -502
+lea L314, r0
+L218: .data -621
+L219: .data 736, 522, -339, 908, 645, 601
+jmp L194
+L220: .data 932
+L221: .string "ayuxjm"
+L222: .data -653, 204, 86, 265, 493, -822
+L223: .string "v"
+not r6
+stop
+L224: .data 136
+L225: .string "csuckqdfmetgguerpwtgvq"
+L226: .string "mfwjxqluweqglyvppjo"
+; comment
+jmp *r6
+L227: .string "gngdzpsyt"
+L228: .data 33, -800, -641, -168, -448
+; comment
+L229: .string "yczzxgxpjueblitbvum"
+L230: .data -252, 221, -224, 211, -676
+jmp *r1
+; comment
+L231: .data 4, -915, 768
+L232: .string "cwb"
+L233: .data 902, 738, 557
+red r2
+stop
+L234: .string "nuh"
+prn r7
+L235: .data 889
+not r0
+L236: .string "ts"
+L237: stop
+
+L238: .string "eahthigxky"
+L239: .data -683, 694, -129, 728, 541, -376, -92
+L240: .data 912
+L241: .data 296, 626, -164, -984, 170
+L242: .data 414, 962, -295, 753, -672, -254, 234
+jmp L300
+L243: .string "zbeblwwyev"
+L244: .data -215, 655, -705
+L245: .string "kkueivlajqewnzlcqkdksil"
+L246: .string "hysydkrngp"
+
+L247: .string "heoqcczdl"
+L248: .data 186, 435, 403, -926
+L249: .data 425, -370, 202, 204, 275
+jmp L286
+L250: .string "iwqnbmsvqzzolpgvs"
+rts
+L251: .string "mukjjnmohchncz"
+mov #224, *r3
+L252: .string "jnspgakstnje"
+L253: dec L310
+bne *r4
+L254: .string "uxlzfmbutnmww"
+jmp L278
+L255: .string "lav"
+L256: .data -535, 995, -326, -909
+L257: mov r5, L184
+bne *r7
+
+lea L296, *r1
+L258: .string "tqljosxpahazcdriinsgztb"
+jsr *r3
+L259: .string "isnaxstmmkouvgwzdqrxghff"
+L260: .string "lzouriniuhqodzaii"
+red *r7
+L261: .data -240, -203
+
+L262: .string "infstablptacclh"
+L263: .data -454
+L264: .data 500, 592, -90
+L265: .data 552, 928, 26, 741, -375, -313
+L266: stop
+L267: .string "wwfufooubcctnmul"
+dec L284
+L268: .data 986, -568, -784, -509, -133, 220, -526, 136
+L269: .data 126, -620, -836, 160, 111
+L270: .data -159, -121, 721, -648, 336, 992, 199, -710
+L271: .string "yqu"
+dec L302
+L272: .string "uxilyjhrdaljgiage"
+L273: .data -803, -857, 921
+not L194
+L274: .data -547, 18, 946, 281
+L275: .data 923
+jmp L300
+L276: .data 440, 861, -925, 905, 156
+jsr L269
+L277: .string "dzfjarkrzsczvquln"
+mov *r3, L303
+clr r7
+red r4
+L278: .string "rpvggbai"
+L279: .data -297, -56, -871, 331, 253, -757, 897
+add L162, L299
+L280: sub r2, *r7
+inc *r6
+clr r7
+
+add *r1, r4
+L281: .data 41, 46, -749, 779
+L282: .string "bwq"
+L283: .string "xtuslmgymiw"
+L284: .string "wmgbtth"
+; comment
+mov L129, *r3
+L285: .string "jyvrcnvgkybvuizbvov"
+rts
+L286: .string "xrjl"
+sub L289, r4
+L287: mov *r6, r3
+L288: .string "levqunrcrddrjfssd"
+L289: .string "lbu"
+red *r2
+dec r3
+L290: dec L315
+L291: .data 771, 456, -286, 185, 164, -154, 760, -881
+clr L292
+sub #197, r0
+L292: .data -719, 670, 378, -673, -221, -735
+L293: .string "vaeetzwpamnirm"
+L294: .data 624, 132, -632, -311, -220, 410
+L295: .data 758, 856, -109, -851, -720, 355, 907
+L296: stop
+L297: .string "t"
+sub r7, *r7
+L298: .string "ilxkzpiremojnnppjgkd"
+L299: .string "qg"
+L300: .data 672, 536, 251, -704, -142
+L301: .data 60, -343, 565, -553, -687
+L302: .data 152, 205, 840, -24, 324
+L303: .data 924, -139, -194, 558, -561, 44, -862
+L304: lea L306, *r5
+L305: .data 3, -193, 280, -934, -269
+dec L308
+L306: .data 315, -646, -49, -611, -167
+L307: .string "bwouifiwkf"
+jmp *r6
+L308: .data 412, 425, 888, 528
+L309: .data -808
+L310: .string "bbwpsyqvatqxbnguccppza"
+; comment
+L311: .string "vgzwkjlviqho"
+; comment
+L312: .data -215, -357, 910, 242, -446
+cmp *r6, L313
+mov r4, r4
+L313: .data 857, 954, 78
+inc *r7
+mov #205, r4
+
+not r7
+
+L314: jmp *r2
+L315: .string "opmuz"
+L316: .string "c"
+stop
@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 77
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+red *r7
+L0: .data 552, 212
+L1: .data -790, 976, -851
+L2: .string "plud"
+L3: .string "pxyjsas"
+L4: .data -819, 66, 384
+inc L3
+jsr L15
+L5: .data -361, -835, -474
+prn *r4
+not L227
+L6: .data -699
+clr L1
+bne *r0
+L7: .string "oggdjkthfu"
+L8: .string "ldbffhiumduyhairccqi"
+sub L6, L179
+not *r7
+L9: .string "lfhiqkzsuroputjl"
+cmp r0, #93
+L10: .data 650
+add #-66, *r5
+L11: .data 382
+bne *r2
+bne L262
+L12: .string "uxjbthmjkcb"
+L13: .string "gjphcexreehfxqmkn"
+L14: .data 798, 553, 148, 904, -102, 928, -203, 404
+
+stop
+L15: .string "qeydpjregdwitqu"
+bne *r2
+L16: .string "oxznrda"
+L17: .data -642, -394, 191
+L18: .data 470, -60, 301, -107, 768
+stop
+L19: .string "qwsoejg"
+mov L17, L90
+L20: dec r4
+L21: .string "exssvcreo"
+L22: sub r4, L207
+L23: .string "km"
+cmp L0, *r2
+L24: .string "khhsfytwdhccfgvf"
+L25: .string "oyewkeyyawwjrczuvplb"
+L26: .data 814, -996, -82
+L27: .data 187
+L28: .data 101, 421
+clr *r5
+; comment
+L29: mov *r3, r5
+L30: .string "ivvrcirhurdabnaguuyehkxw"
+mov #-66, L3
+L31: .data 35, -161, -687, 9, 929, 600
+L32: .data 673, 717
+L33: .string "kwkf"
+L34: .string "oshelfxdycb"
+L35: .string "dnbmen"
+L36: .string "jhmhlqekmcuhmnxytuu"
+L37: inc L136
+L38: .data 660, 498, -757, 924, -45
+L39: .string "dnnf"
+
+L40: .string "ahgzhsdsmvjdhkiompahlqpj"
+L41: .string "rked"
+L42: .data 665, -503, 572, -258, 821, 570, -669
+L43: .string "blxbebj"
+mov #-43, *r1
+L44: .string "qxzffwvbouhgcf"
+L45: dec *r5
+add *r1, r1
+L46: .data 852, -715, 262
+L47: .data -724, 903, -960, -741
+L48: .data 943, 379, 899, -247, 429, 825
+bne L129
+L49: .data 237, -319
+L50: .string "euhkamvbdysc"
+L51: .data -182
+L52: prn L71
+L53: .data 487, 468, -172
+L54: .data -668, 539, -697, -606, -561, 349, -250, 629
+not r7
+rts
+L55: rts
+red r6
+stop
+L56: .data -847, -380, 414, 431, -355, 672, -357
+L57: mov r3, L17
+L58: .string "hpn"
+L59: .data 815, 804, -129, 328, -518, -673
+sub *r6, L2
+L60: .data 962, -927, -168, 851, -460, 848, -825, 491
+jsr *r7
+bne *r4
+jmp L3
+L61: .data 4, 232
+L62: .data 193, 202, -311, -177, -588
+L63: .data -325
+inc r5
+L64: .string "epsutizmdgmu"
+L65: .string "aopoxhmaabwysad"
+L66: .data 721, -353, -128, 506
+prn *r4
+add #-135, r1
+L67: bne L60
+add r1, L101
+cmp *r4, r0
+jmp *r1
+L68: .string "lr"
+jsr L3
+rts
+L69: .data 683, 655, -296, -697, 487, -172
+L70: .data 139, 108, 31
+L71: .string "cvseovhwstwcovioryxlb"
+rts
+L72: .data 711, 272
+L73: .string "jqjuto"
+L74: .data -30, -910, 155, -784, 348, -529, 464
+L75: .data -810, -279, 246
+bne L135
+L76: .data -651, -546, -298, 62, 911, -817, -759
+L77: .string "mlembyxxs"
+lea L272, *r4
+L78: .string "bzevvw"
+bne L84
+dec L77
+L79: .string "nrkdoyqokobmyxm"
+L80: .data 57, 218
+L81: .data -769, -600, 838, 119, 835, 939, -700
+L82: .string "ql"
+L83: cmp *r1, #-155
+red r7
+L84: .string "rtnjnmabzbuxqpywfrmqdkk"
+L85: .string "pvghhatqenynelvdksirecsl"
+; comment
+L86: .data -267, 326
+L87: .string "aixvgvquax"
+L88: .string "gzmtrouipw"
+; comment
+stop
+
+L89: .data -393, -411, -532, -764, -125, 613
+L90: .data 380, -437, -454, 29, 136, 672, 867
+add L177, L142
+prn L191
+L91: dec L268
+dec L4
+L92: .string "yfurxpoqnvtqlawgmr"
+prn *r4
+L93: cmp L26, #224
+add #-63, L9
+add L43, *r3
+L94: .data -267, -986, -961, -232
+jsr *r2
+L95: inc *r7
+red r6
+add *r2, *r1
+stop
+add L108, r4
+L96: .data -553, 331, 107
+L97: .data 850, 772, -447
+L98: .data 178, -350, 13, 941, 961, 550
+not *r2
+stop
+L99: .string "qwlaxjnirjuacgl"
+L100: .string "qlaiyjyyzqknufrl"
+not *r3
+L101: .data -499, -170, 221, 765, -819, -295, -778
+L102: .data -946, 272, -112, -486
+L103: prn *r6
+L104: .data 16, -23, 51, 818, -973, -458, -498
+L105: .string "qtbsxnv"
+L106: add L139, L159
+L107: .string "pwepxyxxzscobqgplg"
+mov L145, L46
+L108: .data -213, 554
+L109: .data -77, 454, 233, 422, -37, 887, 279
+L110: .data -440, 204, 356, 975, -147, 823, 83, 802
+not r0
+L111: .string "fyazbsqvm"
+; comment
+L112: .string "rljrxege"
+L113: .string "zoxvsg"
+jmp L119
+L114: .data 99, -857
+L115: .data 278, 594, 280, 578, -685, 886, -731
+L116: .string "znbkjjuaaxhwnxptrcm"
+cmp r6, #252
+rts
+jsr L15
+L117: .string "qayuzxlwketzjd"
+L118: .string "dslbrzbmqxrcoxyfooyrufxy"
+L119: .data 518
+dec *r4
+L120: .data -620
+L121: red r6
+L122: .string "lvregywgnt"
+L123: jmp L36
+L124: .data -982, -967, 969
+L125: .data 762, -288
+bne *r2
+; comment
+L126: .string "cjcklzresbpmuprihvlyvywo"
+cmp #-45, *r4
+L127: .data 68, 232, -299, -825, 531, 961
+clr r4
+L128: .string "mouabalcyzplexcjbvqxmy"
+jsr *r1
+L129: .data 755, 374
+L130: .data -63, 529, -453, -544, 91, 968, -373, 727
+L131: .string "kzwpksjmqenlfwax"
+mov *r5, *r7
+jsr *r0
+L132: .string "r"
+mov #-61, *r2
+L133: .data 21, 277, -428
+L134: .string "khsh"
+L135: .data 264
+not r4
+not L131
+prn *r1
+L136: .data 549
+not L62
+L137: .data -755, 769
+L138: .data -343, -972, -178, 488
+L139: .string "dcvmjyyfswpxpcwo"
+L140: .data -614, 348, -281, -645, 762
+clr *r5
+L141: .data 867, -784
+prn #-45
+mov r3, L163
+; comment
+L142: .string "nzwcuhm"
+L143: not *r7
+L144: .string "amac"
+L145: .data -522, 356, -858, 99, -980, 725, -831, -645
+L146: .string "dexccbitfyjdbcfca"
+L147: .string "kzksrhkfmzpyr"
+L148: .string "mzzxxidrblzv"
+mov L205, L84
+prn #-215
+L149: .string "yipfx"
+L150: .string "eggijejsmy"
+; comment
+; comment
+sub L129, *r1
+stop
+L151: .string "s"
+sub #-99, L266
+L152: .string "nxmrifmhgmfysdegtguzbyo"
+L153: .data -709, 84, -278, -711
+L154: rts
+L155: .data 605, -156
+rts
+prn *r2
+L156: .data 977, 901, 879, 331, -280, -19, 971
+L157: .data -799, -212, 360, -107, -215, 184
+L158: .string "lghzwrrcgmhljdbcdmhibj"
+L159: .data 152, 773
+L160: .string "cxmju"
+not *r7
+L161: .data -936, -219, 565, -651, -11, -75
+L162: .data -539, 599, -412
+L163: mov L174, r7
+L164: .data -355, 421, 648, 560, 943, -691
+L165: sub r0, L97
+jsr L120
+L166: jmp L153
+; comment
+L167: add L5, *r4
+lea L269, r1
+L168: .string "ibhghypmsairnla"
+L169: inc L217
+jsr *r7
+L170: .data 154, 197, 318, 345, -178
+L171: .string "elrnoqlrgptlhwkmuj"
+dec *r5
+L172: lea L44, r1
+L173: .data 595, -1000, 924, 725, 768, -36
+jmp L73
+L174: .data 945, 21, -935, -530, 788, -323
+L175: .string "zljiqhfijzh"
+jmp *r0
+cmp L100, #132
+L176: .data -206, 744, -537, 321, 40, 687
+L177: .data 737, 673, -435, 30
+add L262, L96
+L178: cmp L260, r3
+L179: .string "tyiwkqlcmtclbwrr"
+L180: .string "trvmcempqosb"
+jmp *r3
+clr r5
+L181: .data 435, 504, -200, 141, -994, 524
+L182: .data 92, -732, 471
+L183: .data -759, 605, 369, -74
+
+cmp *r0, L203
+prn *r1
+mov L71, *r0
+L184: .string "bfnbx"
+L185: inc L136
+sub L149, *r7
+; comment
+L186: .data 53, -772, -835, 570
+L187: .data 804, 876, 988, -833, -572, 160
+clr r5
+L188: .data -126, 413
+prn r5
+L189: .string "aruyyegmbizarxrkdno"
+L190: .data 471
+L191: .string "mxloaxegqdwssnrnrjfmdf"
+L192: .string "apmffadwrcimhjukmpdknt"
+L193: .data 925, 111, -817, 564, -57, 218
+L194: .string "bhu"
+L195: .data 556, -906, -193, -281, 410, 840, -123
+red L176
+cmp r6, r7
+red *r1
+L196: .data 758, -81, -430, -201, -770, -455
+L197: jsr *r3
+L198: .data 966, 778, 826, 307, 961, 612
+clr L62
+L199: .data 771
+L200: .data -760, 152, 474, 999, 995, -499, 344
+
+
+L201: .string "pdvzregibtycrvzcn"
+L202: .string "pmjmpuyobyeps"
+lea L223, *r1
+lea L132, *r6
+L203: .string "hgznlhlrtdqyvx"
+dec L193
+L204: .data -887
+L205: .data 295, 501, -830, -141, -213, 757, -51, 258
+L206: jsr *r2
+jmp L168
+inc r2
+L207: .string "zmdpdbm"
+inc L12
+add #225, *r1
+L208: clr r1
+L209: .string "cnntlhudyrelhfrehomr"
+L210: .data -205
+L211: .string "gjergvtyuncdkyqnhzkwx"
+; comment
+L212: .string "jnptbho"
+mov r1, *r4
+L213: sub L317, *r5
+L214: .string "rqazdjclninfsnmzmwd"
+L215: .data -545, 530, -188, 581
+rts
+L216: .string "cv"
+red *r1
+L217: .string "t"
+mov r2, *r4
+red *r1
+L218: .data -579, 13, -832, 165, 488, 731
+prn L161
+L219: sub *r6, *r6
+L220: .data 186, 355, 501, 889, 808, -163, 328, -659
+mov *r0, *r2
+stop
+cmp L57, *r4
+jsr L236
+L221: .data -872, -374, 84
+L222: jmp *r3
+L223: .string "waddftyczhzsbegcox"
+clr *r3
+prn L146
+
+L224: .string "hl"
+L225: bne *r1
+L226: .string "febkyhbphpdjumnkw"
+L227: .data -410, -54, -694, 716
+prn r7
+L228: .data -524, -205, -761, 360
+inc L264
+L229: .string "kkrkepmhaxugxtvklfhb"
+L230: .data -371, 307, 315, 256, 637, -316, -269
+bne *r6
+L231: .string "ed"
+dec *r0
+L232: .data -323
+L233: .data 902, -919, 748, -301, -176, 182
+L234: .data -939, 33, 93, -732
+dec L236
+L235: .string "ctzxlciktsbpu"
+stop
+L236: .data 831, 491, 600, 693, 943, 275, -558
+L237: .data -322, 75, 84, -698
+bne *r3
+L238: .data 111, 584, 837, -131, 199, 149, -569
+L239: .data 55, 927, -980, -826, 668, -40, -849
+not L264
+prn L12
+L240: .string "gmsylrxun"
+L241: .string "qqwffgsdmfdsnslh"
+sub #172, *r3
+L242: .string "goqacaehmwkxrxhfrgpvco"
+L243: jsr L49
+L244: .string "hdlkyisw"
+L245: .string "uhrack"
+L246: .string "zwdyrcdafxz"
+lea L89, r0
+L247: .string "xttqprywtbvthhpivecd"
+L248: .string "iekpkcjsfeauhmmkmrqbgfzv"
+L249: .string "ynfviaqduereoveghghj"
+L250: .data 68, -949, 322, -302, 184
+L251: .string "sz"
+L252: .data -126
+mov r7, *r4
+L253: .string "drzeimfv"
+L254: .data 35, -858
+
+L255: .data -163, -579, -969, 634, 871, 111
+L256: .data -442, -210
+L257: .string "rgbu"
+rts
+L258: .data -691, -811
+inc L70
+L259: .data -540, -964, -870, -98, -949, -760
+L260: .data 593, 580, -373, 828, -751, -141, 418, 825
+mov #82, L281
+jsr L160
+L261: .data 328, 128, 881, -95
+mov *r2, r7
+L262: .data -5, 895, 401, 533, 219, -743, 82
+L263: .string "vfmtvjmplzhymgxuxwm"
+L264: .data -883, -131, -726, 993, 615, -730
+L265: .string "roiuwugzztcpxk"
+lea L4, *r5
+
+L266: .data -216, 690, -866, 680, -210, -987, 887, -549
+add *r0, *r1
+jmp L137
+L267: .data -758, 647, -82, -748, 694, -984, 584, -128
+L268: .string "upjjprtselztjxfyfz"
+L269: .string "dgcpnriooubprmnkag"
+L270: .string "yvpfliy"
+L271: lea L65, L183
+L272: .string "egmgpfwabulugtlljkf"
+L273: .string "ohgl"
+L274: .string "jb"
+L275: red L26
+L276: .data -634
+L277: .string "qesejvsu"
+L278: .data 353, -984, -847, -426
+L279: .data 343, -590, -388
+L280: .data -196
+L281: .data 137, -519, 651, 737, 447, 318, -521
+L282: .data 538
+; comment
+L283: .string "mhvwmzvvokovzafjhkcpu"
+L284: .string "lpsvjuonovumigpqsiovu"
+L285: lea L61, *r4
+prn #-196
+L286: .data 248, 621, 432, 132, -61
+L287: red *r3
+L288: .string "fphkrvokmi"
+L289: .string "dishszhfksdmysmoafxjxsy"
+L290: .string "zqdzezdu"
+L291: .string "lvfbfcxiodjuge"
+; comment
+L292: .string "txscuwqablcbvaxt"
+L293: .string "wkrugi"
+L294: .data -209, -100, 307, 959, 325
+L295: .string "qjkquyfieuponbmjxxtdi"
+L296: .string "cfshpyldlmfglqhtcqrkvju"
+L297: .data -164, -772
+L298: .data -902, 0, -246
+dec L89
+inc *r3
+L299: .string "ixrjzmgcedabihsjgkajasbt"
+L300: .string "rmlsqxpghvnttclydodpqu"
+L301: .string "aeszzjvdirxjdcwqrz"
+dec L317
+L302: .data -74, -877, 445
+L303: .string "kpyh"
+L304: .data 355, -688, 570, -429, 309, 756
+L305: .string "eteonaohlwi"
+L306: .string "duxbbdgkxjlhygntvkdutuzr"
+; comment
+lea L278, L310
+L307: .data 419
+L308: .data 413, 585, 411, -936, 709
+L309: .string "dnnwcufzprwxyep"
+L310: .data -641, 581
+jsr *r3
+L311: .string "bozgmespivucaofwgo"
+L312: .data 915, 884, 671, -180, 352, 749, -760, -23
+L313: .string "jcvmavr"
+
+
+L314: .data 574, 431, -225, 709, -220, -53
+L315: .data -499, 821, -110, -742, 888
+L316: .string "wdaxslcnzxgdvdlfzghg"
+stop
+L317: .string "dseppehyklvkjczccz"
+sub L318, r5
+L318: .data -737, 440, -883, -467, -705, 374, -425, -6
+stop
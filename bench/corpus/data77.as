@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 78
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .string "zzjyy"
+cmp *r4, *r5
+L1: .data 866, -585, -793, 387
+stop
+prn #15
+L2: .data -13
+L3: .data -76, 848, -979, 214, -135
+mov r7, L192
+L4: .data 836, -628, 470, -946
+L5: .string "qlpojwpjjbjxrixyducgk"
+rts
+L6: .string "tojlbdajnzdogbvtvcn"
+L7: .string "xlnwmprzjzxriv"
+clr L274
+L8: .string "trnomtutnvpmhba"
+rts
+inc L102
+
+L9: .string "dshwjbebkquierrbgnn"
+L10: .data -765
+L11: .string "sn"
+not r3
+
+L12: .string "jeynoiyyjotwz"
+L13: .string "wyghqbpgidemk"
+L14: .string "hhg"
+L15: .data -716, 432, -290, -546, 762, 841
+L16: .string "xhxtopscoeaysoxyhlu"
+L17: .data 178, -581, -742, -98, 224, 145
+L18: .string "vrlckncfrznjhotvgm"
+
+L19: .data 857, 665, -877, 501, -919, -131, -330, -788
+L20: .string "ahsy"
+stop
+L21: .string "qcv"
+jsr L10
+L22: .data 404, 13, -397, 520, -254, 632, 728
+clr *r6
+L23: .string "hfdadpixubp"
+L24: prn r3
+L25: .data -159, 766, -950
+jmp L14
+L26: .data -905, 6, -410, -317, 522, -121, 640, -216
+lea L20, *r5
+
+L27: .data -699, 545, -961, 215, 444, 597, 610, 879
+L28: .data 179, -978, 131, -750, 545
+L29: .data -745, -410
+L30: .data 388, -856
+bne L70
+L31: mov L62, *r5
+L32: .string "gmvbuxiad"
+L33: .data -434, 753, -832, 967
+L34: .string "dw"
+L35: .string "eabzgymzvkdwdfmzgyjqq"
+L36: .data -214, -780, 611, -864, 61
+L37: .string "hvywyvexg"
+L38: .data -929
+L39: rts
+L40: .data -817, -161
+L41: .string "bzgsdbrpmklntwbcix"
+stop
+prn r2
+L42: lea L14, L97
+L43: .string "kmvitaxajsfysshgj"
+L44: red r1
+inc L32
+not L65
+L45: .data 361, -256, -237, -287, -720, -350, 557
+L46: .string "hopvnzaqigwwnn"
+L47: .data -862
+rts
+L48: .data -665, 578, -299, -175, -393, 787, 893
+L49: sub r7, *r2
+prn *r0
+L50: .data 289, 409, 241, -857, -354, 939, 675
+; comment
+L51: .string "cfgzgfntb"
+inc L92
+
+L52: .string "bclxqpcqryojeuhdvujgkdkw"
+; comment
+L53: .data -472, 795, -55, -582
+L54: .string "qzybvkxvokfnhtpopiuwuqur"
+L55: .string "rgwodeiaxcnlvvniyxthv"
+L56: .data -376, -453, 864, 840, 281, 559, -214, -945
+L57: .data 853
+L58: .data 479
+mov #-215, *r5
+L59: clr *r0
+L60: .string "gvrgtlcrkycipdba"
+L61: .string "txsuyetmaebm"
+L62: .data -94, 184, -747, -864, 143, 632
+not r7
+L63: .data -616, -152, -370, 986
+L64: .string "mzxksboncdq"
+L65: .data 364, 912, 426, -436, -838, -425
+L66: .data -512
+L67: .data 809, -525, -231, -873, -559, -677, 313, -618
+L68: .data 873, 993
+dec *r4
+L69: lea L40, L25
+prn *r5
+mov r0, r4
+bne L2
+L70: .string "iblapuhnc"
+L71: .data 703, -570, 813, -353, -65, -294
+L72: .string "jiztzukiuobhwaka"
+add *r7, L61
+L73: .string "zqybwrgymzxqxlqpvicug"
+L74: .string "btrnifqhbhknuewy"
+jsr *r7
+L75: .string "jlllenprtdzsdhisr"
+cmp *r6, r4
+L76: .data 222, 98, 952
+L77: sub r4, *r6
+L78: .data 70, -638, 947, 707, 20, 682, -215
+L79: .data -526
+L80: .data -683, -774, 678, 690
+bne L193
+L81: .string "jweymurabegc"
+not r5
+add r2, r6
+L82: .data -613, 969, 483, 525, -31, -914
+L83: .string "lfxueplphklzwzskntwkez"
+L84: .string "dofxwkemup"
+jsr L222
+not *r7
+not r1
+L85: .data -543, -297, -721, -768, -144
+L86: .string "thoejtgewotmftbm"
+jsr *r0
+L87: .string "vjgskvkswirzipeujhjuz"
+L88: .data 73, 582, -918
+L89: .string "vs"
+stop
+lea L47, L185
+L90: .string "nangtulnzbvoyfbdzcdrko"
+jmp L251
+L91: .data -50, 464
+L92: .data -461, 485, 939, 590
+red *r1
+
+L93: .data 3, 638, 303, 231
+L94: .string "urrodecrzg"
+L95: .string "lyeu"
+L96: .string "rfeplvejudxkmeh"
+add L93, r5
+L97: .string "miypgvvmbdzyvsfua"
+
+L98: .string "fkriw"
+L99: .string "bbdnugmgnalve"
+; comment
+L100: .data -930
+sub #-139, *r3
+lea L122, *r7
+L101: .string "jevveplrjxicuvwzuz"
+L102: .string "opibqcccdpxadqax"
+L103: .string "oynwmnex"
+L104: .data 459, -347, -429
+L105: .data -68
+prn *r7
+L106: .string "xnthr"
+L107: .string "qgtuojqufkbfocq"
+stop
+L108: .data 848, -127
+clr r2
+L109: cmp #-193, *r0
+dec *r0
+L110: .data -48, -609, -946, 141, 306, 477, -239, -643
+L111: .data 420, -995, 895, 579, 74, 500
+L112: .data -433, 829, 537, -763, -780, -442, 796
+L113: .string "eentbminmcq"
+L114: .string "cewjebowticnkfxgudiaed"
+L115: inc L179
+L116: .data -157, 604, 374, -748, 95
+L117: .data -90, -900, -985, -986, -869, -974, 867, -360
+jsr L198
+L118: .string "wtl"
+L119: .data 620, -162
+dec L133
+L120: .string "dcid"
+L121: .string "zrbcwjnpbfltshva"
+add *r5, r0
+bne L79
+L122: .string "pmnkpkhlstuacbfxrkys"
+L123: stop
+L124: .data 863, -236, 633, -115
+L125: dec *r3
+bne *r5
+L126: bne L11
+L127: .string "dwliwjsdfjcafz"
+L128: .string "uwzzthjrzmacxnbilqrgfdj"
+dec r1
+L129: .string "ohjffmqougru"
+inc r6
+L130: .data 288, 173
+L131: .string "kk"
+L132: .string "irrdqrvnc"
+L133: .string "vtqlipyebuefednaogulud"
+prn r0
+L134: .string "wjpgwaldtrvo"
+L135: .data 526, 44
+inc L155
+L136: .string "cpzffux"
+L137: .string "ew"
+L138: .data 269, -479, -69, -558, 503, -373, -495, -805
+; comment
+L139: .string "eplc"
+L140: .string "hbhjuqemrzipghbceqcgp"
+inc *r4
+dec L248
+
+L141: .data -26, 511, 872, -654, 941, 205, 45, 768
+L142: not r4
+add L295, *r4
+L143: .data -53, -428, 934, 856, -8, -599, 550, 496
+L144: .data -913, -684, -305, 581
+L145: clr L60
+L146: .data 721, 508, 574
+mov L67, r5
+not *r6
+cmp #-81, L184
+L147: .string "idkt"
+; comment
+stop
+not r5
+L148: .data 258, -40
+L149: .data 520, -426, 95, -809, 422, -331, 897
+L150: .data -19, -428, 47, 89, -357, 784
+jmp *r7
+L151: .string "vni"
+dec r5
+L152: .data 989
+L153: .string "oopdbipttpiovdxmej"
+inc r4
+not *r5
+L154: add #-239, r6
+jsr *r2
+
+L155: .data -722
+prn r7
+L156: .string "jznxuohiclvsizkaofzqcvca"
+L157: .data 546
+L158: .string "jdyiunuvlxefihesozeijj"
+L159: lea L203, r4
+L160: lea L145, *r2
+lea L233, L284
+L161: .string "zclaa"
+
+L162: bne L263
+not L276
+L163: .data -366, 711, -714, -868, 191
+L164: .data -727, 164, 309, -711, 548, 627, -515, -343
+L165: .string "aaxisftmfljjxdljmjaly"
+L166: .data -982, -398, 272, -855, 257, -77, -887, -72
+mov r3, *r7
+inc *r2
+L167: .string "ybsrojotybpafqyxo"
+L168: .data -151, 494
+L169: .string "dkynkitqionkbtkjboonfuc"
+L170: dec r7
+L171: .string "lzyqvvxxg"
+L172: .string "ebbotwmvccfxwc"
+L173: .data -65, -294, 279, 924, -813, -132
+sub #-35, L316
+dec L26
+L174: .string "bebjaroepqdbzxrja"
+rts
+L175: inc L297
+L176: .string "alwxxcafcagradlpyianyuv"
+L177: .data 0, -578
+L178: .string "mqhlrfblryrjvgctqd"
+stop
+stop
+L179: .data -280, 6, -705, -656, 579, -105, 866, -649
+cmp #-192, #-196
+L180: .data 983
+jmp *r1
+L181: .data 269, 443, 841, 887, 631
+L182: .data -972
+jsr *r5
+L183: .string "eiwudwqazavilb"
+L184: .string "tqqgjwmjoh"
+L185: .data 7, 716, -334, 519, 610, -952, 412, -383
+
+sub *r3, *r0
+L186: .string "n"
+lea L197, L295
+L187: .string "osiqprrcgxcb"
+L188: .data 679, 974, -550, 675, 6
+L189: .data -591, 197, -914, 477
+L190: .data 708, -499, -760, 744, -288, -11
+L191: lea L325, *r3
+clr *r4
+inc *r5
+L192: .data 762, 770, 29, 965, -620
+L193: .string "g"
+L194: .data 876, 808, -1, 939, -116, -255
+L195: .string "iiyfpoevmdlx"
+L196: .string "wppqalvejfqafeq"
+clr r4
+rts
+clr r1
+L197: .string "uegmfvygvga"
+L198: .string "zuocmyzeef"
+L199: .string "bnumorgzwkj"
+L200: .data 640
+L201: .data 289, 481, 726, -72
+red L226
+L202: .string "zixibedihkhoscmeeymlk"
+mov r7, *r5
+red L238
+lea L234, L261
+red L275
+L203: .data -845, -875, 525
+prn *r7
+L204: .data -930, -897, 398, -426, -198, 815, 172
+L205: .data 14
+L206: .string "eieucoouoppnfwlywlmvrkp"
+not L38
+L207: .string "qkkxiridrczaewneyqa"
+cmp r5, *r6
+L208: .string "nh"
+L209: .data -760, 979, 306, 721, -368
+L210: .data -120, -103, 363, 51, 820
+jmp L319
+jsr *r0
+not L235
+L211: .string "k"
+L212: .string "ycrgue"
+L213: jmp L223
+L214: stop
+L215: red r7
+L216: .string "qnqmwmewf"
+L217: .data 526, -689, 503, -929
+L218: .data 215, -43, -307, -602
+mov *r5, L45
+L219: .string "rplimfmejotppudrglhjkxx"
+L220: .data 936, -989
+L221: .string "le"
+L222: .data 455, 296, 979, 283, -32, -358, -311, 628
+L223: .string "eflxiwqttpgout"
+stop
+clr r0
+L224: .data 213, 32, 434, 240, -806, -19, -30
+L225: .string "lejnmmqnl"
+inc *r0
+L226: lea L227, *r5
+L227: not L175
+L228: .data 564, 18, 679
+L229: .data -194, 860, -396, -379
+L230: .data 709, 968, 942, -430, -512, 420, -900, 100
+L231: .string "mpvkxykezmzx"
+L232: .data -115, 166, -550, -493
+L233: .data 209, 433, 956, 299
+L234: .string "inajtlbbcrqhsdlbyuff"
+L235: prn L94
+L236: .data -715
+L237: .data -77, -377, -512, -635, 344, -445
+red *r4
+L238: .data -747, 853
+L239: .string "lbiapgc"
+clr *r5
+L240: mov r2, r3
+L241: .string "akrxpje"
+stop
+L242: .data 493, 917
+L243: .string "bpjuxjgpxrtluxjt"
+L244: .data -164, 102, 356, 641, 822, 772, 808, -717
+lea L57, *r4
+L245: .data -855, -119, 539, 802, 347, -675, -606, -847
+L246: .data 610, -449, 218, -872, -452, -41, -713
+L247: .string "irwfjlnlflsjcwgqplmbsyb"
+L248: .string "joypeehkzs"
+
+L249: .string "rab"
+L250: .string "dydgsnnrhkphg"
+mov r3, L317
+L251: .data 266, 938, 691, -228, -441, 115, 97, -454
+stop
+L252: .string "itnrdbnxsugfpepbwup"
+clr r0
+L253: .data 220, 278, -854, -556, -679, 222, 719
+L254: .string "pfjngzouaroxyqhthq"
+L255: .string "jbihto"
+prn *r0
+L256: .string "knsfaadjfmxkalqdsalh"
+L257: .string "bvcugmnsvmdahfiaswmdmgr"
+L258: .data 111, -660, -454, 83, 221
+L259: .string "tesnieym"
+add r2, r2
+L260: .string "nqiqrvo"
+L261: .string "wlngnucdhwvfyvpqld"
+rts
+sub L275, r0
+L262: .data 519, 912, -752, 181, -232
+L263: .string "chnxwfropahcou"
+L264: stop
+L265: .string "ihlgsfqncdvfyqwideg"
+L266: .string "azitrsejpxdkarllsiuuv"
+sub #183, r3
+L267: .data 924, -455, 167
+; comment
+jmp L231
+L268: .string "zajrgjuvkupyjjqkttjcuzh"
+not r3
+clr r2
+L269: .data 105, 956, -510, -987, -593
+L270: .data -735, 834
+lea L205, r6
+L271: .data -200, -38
+prn r2
+L272: .string "pteogtviqzr"
+L273: sub L17, *r2
+L274: .string "hbmtgglpnlxuhvo"
+rts
+L275: .data 694, -591, 470, 161, -872, -877, -172, 246
+L276: .string "kszairp"
+L277: .data 197, 461, -232, -642
+prn r7
+red r5
+clr r5
+L278: .string "ijukzkq"
+L279: .data -671, 249, -137, -87
+L280: .string "ejmbzcxfvdfrdaccsbbn"
+sub *r4, *r0
+L281: .data 340
+L282: .data -179, -112, -588, -80, 694, 139
+L283: .string "nulbvioyoxyverxushuzkp"
+L284: lea L225, r2
+red *r0
+L285: jmp L212
+sub *r3, r4
+L286: .data 729, 530, 721, -434, 14, 251, -994
+dec L174
+not r0
+L287: .string "vliogaygzygiihybixgtj"
+L288: .string "uglyjvgtlm"
+L289: .data 848, 303, 350, 107, -918, -836, 72
+L290: .string "qlzyvwz"
+L291: .string "fyx"
+L292: stop
+
+L293: .string "csoongwqryfxrakvoyhguizf"
+L294: .string "cxi"
+L295: .data 793, -110, -2, -214, -29, 506, -248
+L296: .string "encogpdlbu"
+not L171
+L297: .data -697, 782, -891, 856, 340, 623, 470, -170
+L298: .data -859, 193, 946
+L299: .string "wwgdbotqdhhxvir"
+L300: .data -336, 444
+L301: .string "vjcbq"
+L302: .string "rilziwfyxc"
+L303: .string "xbdqxmq"
+L304: .string "eofwwzziniooznfqitsqkpq"
+clr r0
+L305: .data -535, 280, 442
+L306: .string "rbpemhuxlxvwhprmmojpq"
+L307: .data 285, -227, -793, 696, -797
+L308: .string "cqbt"
+L309: .string "ryboptlasapmizcx"
+L310: .string "fvjuzeurvhss"
+L311: .data -569, 227, 454
+lea L164, L326
+L312: add #138, L318
+; comment
+L313: mov r5, r3
+not r4
+prn r1
+clr *r6
+L314: .string "dquwcbhzqnzq"
+L315: .string "fsvcyrawfgzzejckaohl"
+
+mov *r0, L228
+L316: cmp #84, #-163
+L317: .data 5, 895, 362, -46, 284
+bne *r1
+rts
+
+L318: .data 372, -911
+L319: .string "oafujnog"
+mov r2, L13
+L320: .data 786, 451
+jmp *r3
+; comment
+L321: .string "epezdakvpqswtnxodvr"
+prn r1
+L322: .data 919
+L323: .data 35, 703, 207
+L324: .string "dixppp"
+sub r2, r4
+L325: .data -174, -888
+jmp L326
+
+
+inc L157
+bne *r3
+L326: .data -143
+stop
@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 79
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+dec *r3
+; comment
+L0: inc r5
+L1: .data 876, -898, -595
+L2: .data -712, -810, 832, -67
+dec L0
+L3: .string "e"
+inc *r6
+L4: .string "sisotdqdvoi"
+bne *r0
+add *r2, r2
+L5: .data -736, -420, -93, -283, -987, 72, -489, 846
+L6: .string "pzwxcizyu"
+sub *r3, *r7
+rts
+L7: .string "axqyhvd"
+L8: .string "x"
+bne *r3
+L9: .string "niodbgvtlky"
+L10: .string "uhjlqwfkqqs"
+L11: .data -941, -712, 25, -705, -747
+L12: .data -662, 84, -654, 381
+L13: cmp #-233, r4
+dec r2
+add *r4, *r4
+L14: jmp L87
+L15: stop
+L16: .string "cpzgwoynub"
+; comment
+not *r2
+L17: .data 866, 518, 101, -584, -246, 349, 537
+sub *r6, r3
+lea L137, *r5
+mov *r0, r7
+L18: .data 756, -167, -129, 132
+L19: .string "fmklcklwzjahz"
+L20: .data 287, 56, 198, -652, -292, -504, 78
+rts
+red L142
+
+L21: .string "njit"
+cmp #-123, L166
+L22: .data 562, 988, -116, -607, -582, -384
+add L258, r5
+L23: .string "zykqjtzdwgq"
+L24: .string "kqscncqufjas"
+L25: .string "lancqorsirkbzjhe"
+
+not *r0
+L26: .string "mpnw"
+L27: .string "yvjqoikkhj"
+L28: .data -561, -448, 420, 238, -773, 127, 675, 479
+L29: .string "xj"
+
+
+bne L137
+dec r6
+; comment
+L30: .string "lixssmwefjqxbdrah"
+
+L31: .data 525, 420, 291
+L32: .data -533, 341, 768
+L33: .string "dncssxjpdxf"
+L34: .data -89
+jsr L7
+L35: .string "wkmfu"
+L36: jsr L13
+L37: .data 444, -65, -642, -737, 155, -534, 475
+L38: .string "tifvvscktcjbyz"
+L39: .data -622, -511, 869, -426, 143, 260, -611
+L40: .data 639
+L41: sub L10, *r5
+L42: .data -595, 858, -3, 131, -757, -153, -254
+
+L43: .string "rgsfahramqkysqja"
+jmp L186
+L44: .data -939, -405, -422, -135, 854, -851
+inc L182
+L45: .string "zxkssky"
+L46: mov #-2, *r3
+mov L35, *r1
+L47: .data 917, -89, -51, 659, -385
+L48: .string "oeniebidzwlakqljy"
+not L142
+
+add L57, L20
+L49: .string "neppxkiygmqjphskmgkzz"
+L50: .data 177
+L51: .string "dxdpjltsvxwr"
+L52: .data 472
+stop
+L53: .string "lkawasiusjluuryvih"
+L54: .string "ckorlez"
+; comment
+L55: .data -667, -957, 184, 466, 642, -300
+bne *r0
+L56: clr L64
+L57: .string "rxyfhnutqectuvbpucgtxgb"
+rts
+not r5
+L58: .string "fuzrmgz"
+L59: .data -962, 995
+L60: .string "o"
+; comment
+
+L61: .data -946, -112, 953, 409, 152
+L62: .data 147, -413, 56, -612, -601, 452, -384
+L63: .data 624, -362, 766
+L64: .data -723, -759, -190, 33, 954, -498
+sub *r6, L159
+L65: .string "fyvgdoeuvy"
+L66: lea L30, r4
+L67: .data 614, -271, -932, 170, -806, 787
+L68: .data 873, 677, 800, 833, 100
+L69: .data -310, 354, 26, -72, -588, 713
+dec *r5
+L70: .string "qiepissmmzvseepjysbv"
+L71: red r7
+L72: .string "x"
+L73: .data 125
+clr *r3
+L74: .data -313, -937, 783, -419, -450, 683
+L75: .data 767
+; comment
+add #-166, *r3
+L76: .data 99, -208, -347, -30, -762, -822
+L77: .data 693, 158, -771, 59, -200, 517, -120, 325
+L78: .string "vcdamqwpzssm"
+L79: .string "laopigezijclancruhqilp"
+L80: .data 254, -19, 895, 479, 888, 534
+prn #148
+rts
+red L8
+L81: .string "nlcfv"
+L82: .string "zrqnhlzotjjkjv"
+L83: .string "iicql"
+L84: .data -625, -913, -997, -84, 317, -943, 755
+add #-138, r2
+L85: .string "sgchyuaghm"
+L86: .data -5, -780, 640, -760
+L87: red *r3
+L88: .string "chzpdmfwybmrtreismnmjwwo"
+bne *r7
+L89: .data 488
+L90: .string "ghrvqkhhuxdca"
+clr *r7
+L91: .string "ffvrt"
+L92: .data -283, -101, 87, -352, -544
+L93: .string "rpobwmkvjrbfnfbylgqxc"
+rts
+L94: add L313, *r0
+L95: .data 288, 79, -694, -903, -641, -156, 872, 749
+L96: .data 56, -13
+bne *r5
+L97: .data -205, 657, -12, 380, 69, 703, 81, -630
+L98: .string "k"
+L99: .data 745, 721, 473
+lea L73, r1
+lea L4, L98
+bne L19
+L100: .string "cjilxmrhktshvdselvbtlf"
+L101: .data -968, 791, -497, 780, 931, 176
+L102: not r7
+cmp L284, #-29
+L103: .data -771, 313
+dec r7
+L104: jsr *r6
+add *r3, L23
+L105: .data -477, 450, -820, 156, 340, -950
+L106: .data -110, 621, 387, 821, -35
+L107: .data 215, -974, 672, 374, -808, -832, 355
+add *r3, *r2
+L108: .string "ezxqbqc"
+L109: .data -845, 89, 857, 963, 269
+L110: .string "skiuxwfcpbxahntftpi"
+L111: .data -609, -377, 181, 106, -270, -169, 15
+clr r2
+L112: rts
+red r7
+L113: .data -519, 927, -243, 325
+L114: .data -907, 844, 449, -188, 350
+L115: .data 180, -86, 186, 283, -704
+prn r3
+L116: .data -168, 844, -944, -878
+L117: .string "ljbavjffgsha"
+L118: .data -216, 32, 493
+L119: stop
+rts
+L120: .string "mcmlaitvohano"
+sub r5, r2
+red r6
+add #-142, *r0
+lea L199, L205
+L121: .string "yessbdnpnllgnpuwgnegh"
+L122: .data -952, -725, 430
+add *r4, L76
+dec L120
+add r0, *r5
+bne *r7
+L123: .string "aaevzbtlwqcalyewhsjfxind"
+L124: .string "phxsdmwcvadaw"
+L125: .string "axcpmsjjqfludpwzsc"
+L126: .string "idwghujhbgtnbmaz"
+cmp r5, r7
+L127: .string "lxpypbjs"
+inc r6
+jmp L89
+L128: .string "qrhidjtnf"
+dec r1
+L129: .data -105, 720, 792, 673, 698, -413, -824
+L130: stop
+L131: .data 291, 730, -116, -334, -755, -777
+L132: .string "bakl"
+L133: .data 380, -583, -183, -623
+red r7
+L134: .data 213, -274, -487, 44, 172, -790, -856, 640
+L135: .data -723, -760
+lea L248, r5
+L136: .data 94, 381, -362, -957, -818, -539, -938
+L137: .data -91, 814, -89, 558, -68, -874
+L138: .string "nfrhxadyhkhnkvkpyvr"
+clr *r4
+L139: .string "vbtpoahpgdtodtw"
+jsr *r0
+L140: .data -236, -253, -669, -440, 265, 770, -317
+L141: .data 774, -776, 789, 232
+L142: prn #229
+L143: .string "okdodzduvgnaydqylp"
+add *r6, L227
+L144: sub #190, *r0
+L145: .string "qoadnttlpneltsmzmptewmc"
+L146: .data 543
+lea L4, *r2
+jmp *r3
+L147: stop
+red *r0
+add #-124, r3
+jsr *r1
+L148: .data 480, 280, -949
+L149: .data 9, -367, -370, 824, 97
+mov #200, L171
+mov L202, L256
+prn *r6
+L150: red L93
+L151: .data -955, -549, -219, 660
+L152: .data -148, -49, -78, 113, -191, -141
+L153: .data 355, -643, 452, 729, 726, 959
+L154: .data -775, -44, 172, 349, -403, -616, 199, 515
+L155: .string "awxn"
+L156: .data -241, 595, -863, -111, 686, -634, 768
+L157: .string "eencgtrhwlwpbgnvnqoy"
+L158: inc L28
+lea L228, L83
+L159: .data -863, 921, 190, -500, -790, -748, 713, 666
+L160: .data 497, 897, 82, -596, -468
+L161: .string "kc"
+L162: .string "pivgmyppbwigncblpnml"
+L163: .data -136, -688
+L164: .string "jjnsssthymxqjnwbnki"
+L165: .data 384, -683, -121, 791, -716
+L166: not r3
+L167: add r5, r5
+cmp *r2, #-234
+stop
+rts
+L168: rts
+L169: .data -753, -271
+sub L287, L52
+L170: .data 625, 821, -223, -23
+L171: .data 801, -421
+L172: .data 636, 975, -744, -505
+L173: .data 198, 808, -459, -535, 563, -733
+L174: .data -596, 198, -116, -288, 684, -863
+L175: .string "urbivvdxrhbujpuebwoa"
+L176: .data 927, -356
+L177: .data -390, -37, 117, -276, 791, 887
+L178: .data 371, -151, -541, 166, 112
+L179: .string "zoducnjelasrgawblppord"
+L180: cmp *r1, L208
+L181: .data 477
+L182: jmp *r2
+bne L160
+L183: .string "ia"
+rts
+L184: .data 197, -997
+L185: .string "yncqnlbbwnguwvsexwozsx"
+L186: .data -469
+L187: .string "skvjh"
+rts
+L188: .data 212, -399, 753
+; comment
+cmp r4, r4
+L189: .string "cfnlugswruzgbl"
+L190: .data 855, 796, -826
+L191: clr r1
+L192: .string "ilb"
+red L283
+L193: stop
+add *r6, L280
+L194: .string "pqcxwgzqupelqqpoubyas"
+L195: .data -981, 306, -866, 235, -682
+L196: jsr *r4
+rts
+L197: .data 730, 587, 170, 844
+L198: .string "olsjkcqyggjtpqaiycua"
+not L208
+L199: not r7
+L200: .string "xlxajlsyturdwnw"
+L201: .data 975, -960, 61, 795
+stop
+add #-58, *r5
+L202: .data -970, -955, -949
+L203: .string "ubnlarslyrqaqtmfyoavk"
+L204: .string "jgmmotdlz"
+L205: inc L257
+inc L185
+jsr L53
+mov L312, *r1
+L206: .string "qokltejntnkeqdudrt"
+L207: .data -532, 470, 708
+L208: .string "dycsdicp"
+L209: .string "oodzzvo"
+add *r7, L306
+L210: jsr *r2
+cmp L45, L272
+dec r4
+mov r3, L102
+not *r5
+L211: cmp #-91, r0
+add #-88, *r6
+red r3
+L212: dec *r7
+L213: not *r3
+L214: .data 101, -354, -975, 851, -186, 130, 974
+L215: cmp *r0, *r7
+L216: .string "gbgrzoxlpujhic"
+jsr L295
+L217: .string "qzufjvq"
+jsr L161
+L218: bne *r7
+L219: .string "qnqefkuevbtysefzlggjhsv"
+L220: jmp L61
+L221: .string "ezfdjuikpygwjwniofkr"
+cmp *r1, *r5
+L222: .data 248, 290, -689, 759
+rts
+L223: .string "osyaqzeeevg"
+cmp L208, #-40
+add *r2, r6
+jsr L235
+lea L261, L294
+L224: .data -711, 462
+L225: .string "yuilegm"
+add L301, L177
+; comment
+
+clr L260
+stop
+L226: .data 885
+prn L217
+L227: .string "zoirtrhumy"
+L228: .string "kinfxexnddyxjkjxwjkhkcaw"
+L229: .data -292
+clr L271
+
+L230: .string "fyqtor"
+L231: .string "ztdyskusiqrsjcqkntnpwjaz"
+prn #-100
+L232: .data 691, -121, -469, -327, 312
+L233: .string "painohrrolhcfqazycio"
+L234: .data 986
+stop
+L235: .data -426, 581, -38, -576, 837, 66, -806, 299
+cmp r4, #-167
+L236: .string "yrgssgydcpjc"
+L237: .data -236, -393, 924, 604, 328, 347, -648
+L238: .data -591
+L239: .data -717
+bne L269
+lea L56, *r0
+rts
+L240: .string "eyopgsgilihvpn"
+bne *r1
+
+rts
+L241: .data 864, 895, 972, 947, -773, -44, -920
+jmp *r2
+lea L275, *r5
+L242: .data -394
+L243: sub #188, r1
+L244: .data -153, -860, 4, 47, 362, -848, 434, -607
+sub L145, *r4
+bne L309
+stop
+L245: .string "qortxuthixrg"
+inc *r4
+L246: .data 45
+L247: .data 661, 620
+L248: jmp *r7
+L249: .data 356, -986, -650, 496, 672, 100, -760
+L250: .data -903, 134, -457, -56, 350, 942, 226
+L251: .string "oextgnagsvqqztin"
+L252: .data -672, 627, 616, -259
+L253: .string "ubnmjacnngtqhlt"
+L254: .string "ciuthivu"
+L255: .string "qzikhnycevhwneiqaosmr"
+add L302, r1
+L256: .data -775, 500, -894, 522, 322, 842
+rts
+lea L179, *r3
+cmp L15, r7
+L257: .data 120, -237, 455, -691
+L258: .data -634, -282, 642, 705, 227
+L259: .string "pairnte"
+L260: .string "mvraetdueshslyhubyuk"
+
+L261: cmp *r7, r5
+inc *r6
+L262: .string "xyflhzpshcow"
+L263: .string "yfzxjuw"
+L264: .string "nddotxbqmvumrsbbqw"
+L265: .string "xdmzlnwrcbexkzmrwunwzbl"
+L266: .data 649, -179
+L267: .data 608
+L268: .data -792
+L269: .string "vfxgfbfge"
+L270: .string "rucangjocrhn"
+L271: .string "vj"
+dec *r4
+L272: .string "guihcnzpybggbmdknihuznhq"
+L273: .string "dazguy"
+L274: .data -734
+
+L275: .data 833, -976, 605, 279, 976, 390, -130, -656
+L276: .data 243, -534, -829, 338, 306, -771
+mov #161, r7
+L277: .data -539, -810, 835, 616
+dec L259
+L278: .data -345, -141, 750, -281
+L279: .data -152, 767, -78
+L280: .string "zknpsqh"
+L281: .data -870, -294, -103, -821, -900, 357, 673
+stop
+L282: .string "jihhueniuw"
+L283: .data -754, 339, 656, 368
+L284: .data 187, -539
+L285: .string "dqgxkzgrtqojbnem"
+L286: .string "rkutsfgohdmxejhlmdcex"
+L287: cmp r5, L294
+L288: .data 457, 741, -762, -669, 276, -563, -278
+dec L300
+L289: .data -57, -862, -522, -840, 454
+L290: .string "sdthitkcpgoxwourmkrd"
+L291: .data 683, 328, 905, 827, -74, -318, 20, -454
+prn *r3
+L292: .string "qehj"
+lea L27, *r0
+L293: .string "wfcaf"
+L294: .data -921, 340, 964, -299
+add r3, *r1
+L295: .data 60, 148
+inc r6
+prn L252
+L296: .data -83, -760, 2, -332, -8, -377
+L297: .data 285, -726, 862, 752, -866, 884, 3, -580
+L298: .data -219, 707, 50, -325, 357
+; comment
+red r7
+L299: .data -947, -474, 607, 993, -952, 583, -830
+cmp #-90, r0
+L300: .data 470, 329, 640, 229, -862
+L301: stop
+L302: .data -174, 653, -731
+jmp L316
+jmp L306
+red r2
+L303: .data -76, -166, -821, 757, -432, 154, -208
+L304: .data 995, 586
+L305: .data 191
+L306: .data -264, -775, 890, -321, 980, -484, 942, 910
+clr *r6
+L307: clr L312
+L308: .data 435, 7
+dec r4
+stop
+L309: .data -248, 132, 144, -415, 842
+L310: .data -844, -982, -783, 937
+L311: .string "oyjruggaywylovduz"
+inc *r7
+inc r7
+mov r7, L314
+bne L313
+L312: .data 844, -324, 911, -57, 642
+L313: .string "ykanlajgkw"
+lea L280, L317
+L314: .string "biaqsf"
+L315: .string "ulnykzht"
+L316: .string "kkzwqygnvlntqgrvmsx"
+L317: .string "pwaaahvexzfrnmyc"
+L318: .string "ifjmtz"
+stop
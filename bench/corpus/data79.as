@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 80
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .string "rjgedrwnctjknuhu"
+
+L1: .data -357, -142, -687, 124, 525
+L2: .string "nosweqegjxucfbvnav"
+L3: jsr L96
+add #-47, *r5
+mov #-68, L253
+L4: .string "salxqmuuilxwhi"
+L5: .string "gwtlqcpnqelgy"
+L6: .string "tbemetabydmhfnqfcdeicla"
+L7: .data 724, 544, 246, -793, 584, -399, 449, -101
+prn r5
+L8: .string "ijytiqbyvg"
+L9: .string "ejtsiqljrqnequalyiql"
+
+L10: .data 948, -370, 617, 975, -265, 138, 386, 107
+L11: .data -794, 594, 753, -973
+; comment
+L12: .string "hsdjp"
+clr L3
+rts
+L13: add #-58, r2
+sub *r7, *r0
+L14: .data 990, -686, -895, -675, 739, 969, 905, 853
+L15: .string "ulstqjywwaqxkiwurlfw"
+L16: .data 360, -293, -875, -351
+
+
+jmp L181
+L17: .string "wdtldfmpgxaitcrvpvjsuf"
+L18: .string "vsuhrvbcwlvuzozhqwg"
+L19: .data 482, 157, 900, -96
+L20: .string "aamudwqk"
+; comment
+L21: .data -647, -484, 707, 131, -422, 235
+cmp *r0, L64
+L22: .data -919
+stop
+L23: .data 866, -46, -677
+L24: .string "akrzhiuzhtngapdpjmluqdr"
+red *r7
+L25: .data 138, -42, 439, -735
+L26: .string "icmgpzaamsjb"
+jsr *r6
+L27: .data -764, -626, 221
+L28: .string "uidwpcnbjtcxpxfmegb"
+L29: .string "tonzxcnwgtypxz"
+L30: .string "due"
+L31: .data 103
+L32: .data 191, 703, 303, 558, -477, -717, -738, 961
+L33: rts
+L34: .string "vi"
+bne *r4
+L35: .data -121
+L36: .data -876, -121
+L37: .data -818, 273, -916
+L38: .string "zqwjuknxzq"
+L39: .data 86, -379
+L40: .string "nyubjftzoedzfypr"
+L41: .data -580
+sub #169, *r2
+L42: .string "z"
+cmp #188, L32
+L43: .data -723, -92, -743, -975, -573, 480
+cmp r0, r5
+jmp *r2
+L44: .data 352, -561, 408, 382
+L45: .data 211, -933, 490, 670
+L46: .string "iey"
+L47: inc r0
+cmp *r5, *r2
+L48: .string "bsnyglzoihuxbfnj"
+lea L213, L26
+L49: .string "jdmspiarisikjuu"
+L50: .string "mnmv"
+L51: .data 3, -302, 82, 648, 282, 145, -616, -176
+inc L229
+L52: .string "ldavrbooyqghwfq"
+L53: .string "zxbdadewyfpp"
+L54: .data -127, -907
+rts
+L55: bne *r7
+L56: .data -524, -960, 842, 903, -291, -643
+L57: .data 969, 216, 715
+; comment
+L58: .data 398, 274, 854, -685
+rts
+not *r5
+L59: .string "nftr"
+L60: .string "rchmqfento"
+L61: .string "fkyisezjefeciwtpzkrdohdh"
+mov *r2, r2
+L62: .data 939
+dec *r7
+inc *r6
+; comment
+L63: .data 642, 707, -714, 510, -92, -247
+L64: .data -132, 773, -181, -992, -668, -28
+L65: .string "cgbzn"
+L66: .data 885, 969, 513
+L67: .string "nosuiuzj"
+add #51, *r2
+L68: .data 424, 905, 520, 750, 759, -245, -685
+jmp *r0
+L69: rts
+L70: .string "ivpfpfgsesmrpto"
+cmp *r3, *r5
+L71: .data 367, 78, -511, -673
+L72: .string "kvkpfovrvlozklh"
+red *r6
+L73: .string "zjcszqktilx"
+L74: .data 774, -87, -401, 930, 846
+L75: .data 856, -710, 196, 215, -721
+jsr L77
+
+L76: .string "ceyhpvddcwscwkequutm"
+cmp *r1, #58
+L77: .data -88, 972, 60, 412, 942, 493
+lea L68, L179
+jsr L88
+L78: jmp L286
+L79: red *r7
+L80: .string "yajowlqtxiabbraom"
+not *r2
+L81: .string "filmxxnoru"
+L82: .data -113, -327, 197, 495, 317
+prn r0
+L83: .string "wkvcqqpkuxtvhraps"
+dec r6
+L84: .data 479, -678, 243, 450
+L85: lea L114, r2
+sub r2, *r6
+L86: .string "bpsebbjjkpsfi"
+L87: .string "zsoykmryjyh"
+L88: .string "rhgtnqrpmhyldwipz"
+L89: .data 298, 517
+L90: .data -598
+
+bne L194
+rts
+L91: .string "txgvojhqqdsc"
+L92: .string "axwrsytoqgvbiik"
+L93: .string "iy"
+jsr L24
+rts
+L94: .data -718, -554, -561
+L95: .string "infgpydpifaprjcmbywkuqt"
+L96: jsr *r0
+; comment
+L97: bne L263
+L98: .string "ixzbqst"
+cmp L240, r0
+L99: .data -320, -978, -634, 472, -968
+L100: .data 690, 38, 245
+L101: .string "wqkttxjbipswsvdhupnwmqpo"
+L102: jmp L128
+L103: .data -201, 474, 318, -790, 352, 272, 23, 377
+jsr *r1
+sub L266, *r5
+L104: .string "jfu"
+L105: .string "toftqkcsgnburpf"
+L106: .string "vzueaitceln"
+L107: sub *r6, *r0
+L108: .data 404, 464, -205, 493, -348, 48, -463, -375
+L109: .data -513, 823, -775, 251, -356, 661
+; comment
+clr *r3
+L110: .string "ypbthk"
+jmp *r2
+clr *r3
+L111: red *r7
+L112: red r0
+inc *r4
+L113: .data 241, -98, 536, -545, -21, -410
+L114: .data -699, -551, -699, -831, -619, 311, -612
+inc r0
+; comment
+add r5, *r2
+L115: .data -366, 243, 303, -678, 542, 525
+L116: .data 423, -639, -517
+L117: .string "kppt"
+rts
+L118: .data 836, -522, -928, -822
+L119: .data 620, -710, -383
+L120: .string "qhx"
+L121: .data 660, -769, 353
+L122: .data -450, 523, -171, -548, -424
+L123: .data 855, 7, -592, -247, -271
+L124: .data 232, 102, -187
+clr r1
+L125: .data -96, -182, -57, 89, 216, 509
+L126: sub #-226, r7
+L127: .string "zfpi"
+L128: .string "pyukmnqxzlemdtcxqjholtta"
+
+L129: .string "lzsdvfststhd"
+rts
+L130: .data -197, -659, 680, -270, -313, -231, 666
+L131: .data 855, -213, -474, 983, -741, -37
+inc *r3
+clr L144
+inc L123
+L132: .string "qam"
+L133: .data 316
+mov *r1, L190
+L134: .string "titopkldkcjyiovyweycuw"
+L135: .string "qdxrbc"
+
+L136: .string "kctc"
+lea L99, r5
+red *r0
+L137: .data -881, 285, 729, -632
+L138: .data 573, 210, -766, 495, 881, -890, 741, 546
+L139: .string "pmszxyahuj"
+sub *r5, r6
+jsr L166
+L140: add L96, r4
+L141: .string "zpkdhlksmlplpqawguymokx"
+L142: .string "mbkxxthgnptivhfpyrmim"
+jsr *r7
+L143: .data 387, 84, 922, -223, 302, 389
+L144: .string "doebsccu"
+L145: .data 840, 977
+bne L92
+stop
+L146: .string "ipdninpxt"
+prn #-81
+L147: .data 640
+L148: .data 662, -850, 874, 581, -145
+L149: .data 789, 596, -589, 591, 307, -566, 307, -425
+L150: .data -815, 922, -714, -69, -755, 277, 170, 66
+L151: .string "fgvckznuqshfydntlevf"
+inc L186
+L152: .data 996, 204, -80, 848, -806, 814, 700, -260
+L153: .string "zlfyi"
+lea L299, L278
+L154: .data -121, 805, -737, 140, -213
+L155: .data 99, -651, 183, -906
+inc *r1
+; comment
+L156: .string "d"
+L157: .string "p"
+L158: .data -145, -45
+L159: .string "jnwhxmiwzr"
+add *r6, L263
+L160: .data -306, 252, -977, -883
+bne *r4
+sub *r2, L239
+L161: .string "toi"
+L162: .data -773, 853, 749, -66, -196, 799
+L163: .data 367, -66, 529
+L164: .data -202, -228, 622
+jmp L67
+L165: jsr *r3
+not r6
+cmp *r7, *r3
+red r0
+inc L122
+rts
+L166: .data 830, -428, -393
+L167: .data -981
+L168: .data -104, 872, -172, 935, -976, -452, -453, 316
+L169: .string "yqnwiknrbudfiyvbwju"
+red *r4
+L170: .string "ppmpdpdbkadqznigyql"
+L171: .data 167, 304, -350, -263, -461, -178, -822
+L172: .data -782
+L173: .string "nzdpxjtdaok"
+red *r6
+L174: .string "qycmcbknutqv"
+L175: .data 260
+cmp #-56, *r5
+mov #-168, r1
+L176: .string "rhyfvnpiax"
+L177: .data -782, 698, -125, 697, -509, -164
+L178: .string "afzmwdewrafvxiovzhm"
+jmp L188
+lea L282, L139
+L179: .data -204, 573, 408, -265
+L180: .data -896, 214, 356, -484, -177, 104, 654, 734
+add #173, r4
+L181: add *r1, *r7
+L182: .string "gfeqwwqailfgfzeztaadkgmb"
+L183: .string "kkeqoybhn"
+clr L275
+add L247, r3
+L184: .data -39, -460, 333, 656, -37, -543
+L185: .string "axhjfnvhwdqtxizbr"
+bne L177
+L186: .data 555, -236, -833, -995, -675, -325
+L187: .string "ouflfdkhgdgixln"
+L188: .data -335, -936, -803
+L189: .string "ibddxvjkf"
+
+L190: .data 949, 541, -698
+lea L288, *r0
+; comment
+L191: .string "qzery"
+prn #79
+L192: .data -887
+rts
+L193: .string "sjcebgjzfkbuktujppmag"
+L194: .data 221, -163, 143, 772
+dec r4
+L195: .data 851, 836, -993, 570, -221, 90, 955
+L196: .data 867, 456, -151, -837, 998, 307, -287, -369
+L197: .string "haenjhezodyziecjxpnub"
+
+L198: .data -120, 727, 785, -743, -624, -463, 446, -227
+L199: .data 854, 995, 273, 677, 756, -48, -965
+L200: clr r5
+L201: sub r7, *r1
+L202: .string "kpwkghwmytwkbzahxzjrmkgl"
+bne L70
+L203: .data 684, -79, -751, 99, 542, -375, -892
+L204: .data -729, 299, 347, -323, 381, 659, 317, -648
+L205: .string "ljwilhawfeqdqdxyytfqzoe"
+inc L62
+L206: .string "covrnxotsexwb"
+L207: .string "r"
+
+stop
+L208: .data -774, -126, -951, -370, 755, -109, -543, -65
+jmp L319
+L209: .data 956, 927
+L210: .string "ewspm"
+jsr *r5
+L211: .string "xbqrjgjqkslrflirlxe"
+
+L212: .string "makpsm"
+inc r6
+; comment
+L213: .string "eoxc"
+stop
+L214: .string "cdsrxibtddbvqixedppa"
+L215: .string "ivci"
+L216: .string "faagokakhctodwqsym"
+jsr L125
+L217: .string "f"
+sub r1, L55
+L218: .data 251, -858, 78, -239, -433, -448, 794, 765
+L219: .data -484, -727
+rts
+L220: bne L232
+L221: .data -845
+L222: .string "xbjmrqjvgmcsqubmd"
+L223: .data 500, 175, 641, 606, 19, 765, 591
+L224: .string "pqbfhvrcxa"
+L225: .data 606
+mov L297, *r4
+L226: .data -34, 625, 909, -41, 985, -949, -801, -961
+L227: .string "mfngywhsvohxf"
+L228: .data -631
+L229: .data 207, -158, -488, 522, 862, -889, 774, 657
+dec L114
+L230: .data -988, 203, -898, -26
+L231: .data 600, 828, 917, 425, 794, 495
+L232: .string "jurvjhznqrxqjhqdra"
+L233: .data -334, -141, -803, 520, 500, 268, -617
+L234: .data 321, 157, -461
+L235: .string "gyspxorczoerxvciwgxtnz"
+L236: .string "bflehwnurzpqtmglqadplo"
+L237: .string "gl"
+prn L318
+; comment
+L238: .string "opvacfoxywdufphe"
+L239: .string "pewvetrhcx"
+cmp *r6, *r6
+L240: .data 358
+L241: .data -972, 777
+L242: .string "trbuwwmwfavujabfryer"
+bne *r5
+dec r6
+L243: mov r7, L163
+L244: .data 460, 700, 905, -732
+L245: .data 26, -967, 536, -200, -663, 103, -922
+L246: .data -282, 816, 269, -371
+L247: .data 197, 108, -423, 917, 952, 68
+L248: .string "tjpuersmkvhpezmagwz"
+L249: .string "llinezlfmadglyon"
+L250: .data 771, 948, -628, 726
+
+bne *r2
+prn L323
+sub r1, r1
+lea L116, r4
+add L103, *r1
+rts
+L251: .string "lxnascnoqet"
+; comment
+clr L252
+L252: .string "wycheijzknhtmkfsbrtuibq"
+mov L282, L312
+L253: .string "g"
+L254: .string "ysetlyqju"
+L255: .data -96
+L256: .string "nuskevyddredci"
+mov r4, L327
+L257: .data -823, 39, 424, -775, -19, -857, 464
+L258: .string "aannonettsojpwkqjfg"
+L259: .string "llfnbvhsbsdnnxlmkzkix"
+L260: .string "ihxpjmgp"
+L261: .string "pht"
+L262: .string "ihbungsmndlfqqkgdiryx"
+L263: .data -395
+L264: .data 179
+mov r4, L200
+L265: .string "trakgwpvobutow"
+L266: .string "hrzaezgpdxbrrjrpggpg"
+
+L267: .string "s"
+L268: .string "uaxhktoiwyduhtwvk"
+clr L320
+L269: .data 59, -568, 830
+L270: .string "cgzrjfoojdgtpiawbifmz"
+jsr *r0
+jsr *r7
+red r7
+L271: .data -512, 823, -113, 42, -658, 49
+L272: .string "yhtbpsxq"
+L273: .string "boarbjzyzmivrjcymw"
+lea L129, L87
+L274: .data 593, -840
+rts
+L275: .string "kevrysvpigyrdxgcrm"
+clr r5
+L276: red L313
+L277: .string "ceqrdmiekeytskljduoy"
+L278: .data 553, 806, 769, 930, 591
+L279: .data 633
+L280: .data 680, 785, -411, -309
+red L302
+clr *r4
+jmp L277
+L281: .string "qtipevcbbokwnheqme"
+L282: .data 940, -581, 901, -58, -500, 9
+L283: .string "gvnwdmmp"
+dec *r1
+L284: .data -795
+L285: .string "wuhjhbntfyabwhjgntfvbdak"
+L286: .data -14, 99, -661, 606, -140, 394, 389
+L287: .string "weyrbnyvdyf"
+lea L290, *r3
+rts
+add r1, L85
+L288: .string "fsbluhtuioylkgeh"
+L289: .string "zsfpjtrgxnkfer"
+L290: .data -363, 886, -471, 167, 414, 389, -342, 785
+mov r6, r7
+L291: bne L110
+
+L292: inc L327
+L293: .data -535, 219, -318, -769
+L294: .data 364, 252, -706, 357, 194, -795
+L295: lea L317, r1
+L296: .data 733, -205
+L297: .string "pyqqwokzkbwoz"
+L298: .data -374, -417, 832, -142, 454, 683
+L299: .data 814, -791, -465, 851, 326, -378, 666, 478
+L300: .string "ghzoe"
+L301: .data 112, -253, -615, 763, -620, -89
+rts
+inc *r4
+L302: .string "tnbcvakhabgfndsmhmkfh"
+L303: .string "jksbt"
+clr *r4
+L304: .data -460, -863
+clr r3
+L305: .string "tang"
+L306: .data -771, 986, 475, -365, 976
+L307: .data 633, 350, -960, 702, 573
+L308: .string "pfbgrvofnnypqz"
+L309: .data -5, 338, 644, 847, -565, -146, 855, 833
+
+L310: red *r6
+L311: .data 35, -585, -575, -173, -346
+
+lea L323, *r4
+L312: inc r2
+L313: .string "mhuofpxpivyjdlgzprenuohd"
+L314: .string "zicydkxcgk"
+L315: .data -323, 243, 325, 612, -855, 206, -258
+L316: .data 133, -755, 250, 85, -796, 898, -550
+clr r4
+L317: .data 489, -402, 878, -559
+L318: .data -324, 728, 369, -349, -558, -816, -889
+L319: .string "vnqusoiez"
+L320: .data -182, -575, -861, -618, 6, -643
+L321: jsr L322
+L322: .string "aflosiqvgithrf"
+L323: .string "qwryaisohhioxcqgtnux"
+red L330
+L324: .string "scmsdmk"
+inc *r6
+L325: .data 116, -562, -239, 760, 300
+L326: .string "ocvtwjxjvjyzqmrylj"
+L327: .string "em"
+L328: .data 695, -936, 347
+L329: .data -971
+L330: .string "wcalnwtwvvuebjj"
+stop
@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 9
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+lea L290, L318
+L0: not *r1
+L1: .string "k"
+L2: .data 131, 591, -1000, 280
+
+jsr L116
+
+mov L239, r4
+add #-183, L2
+L3: .string "zbscjgafxcdsiqkdloyn"
+L4: .string "oxfqqtdcvsrse"
+L5: .string "fmrympzlbphqeytslqqfwi"
+red L1
+L6: .string "zrjalpmj"
+L7: .data 896, 830, -454
+lea L3, *r7
+L8: .data -98, -711, 35, 792, 618, 898, 485, 581
+stop
+L9: .data -561, -839, -467, -347, 410, 710, 804, 451
+L10: .data 915
+L11: .string "p"
+L12: .string "mgyfkbklibhjzxhbylntqpt"
+L13: .string "esmboyafnoobkyjzf"
+L14: .data -585
+L15: .string "bjgvezihqxlwspnufayg"
+L16: .data 719, 457, 244, -666, 312, 687, 171
+L17: .data 907, -993, 351, -979, -582, -888, -488, 992
+L18: .data 99, -810
+lea L9, r2
+dec *r0
+L19: .data 315, -197, 779, 456, 262
+add #209, r6
+L20: cmp #159, r3
+jsr L4
+jmp L16
+L21: .data -116, -221
+L22: .string "za"
+; comment
+L23: sub L11, r4
+L24: .data 765, 148, -536, -874, 568, 744, 667
+L25: .data -90, 478, -359, -645
+L26: .data 424, 777, -621, -944
+L27: rts
+L28: .string "lccoxmcod"
+L29: mov *r5, *r1
+cmp #-209, #-5
+L30: .string "cqimxxoat"
+L31: .string "vapgeulyhklhtlhgxtpgri"
+rts
+L32: .data 373, -155, -925, 95, 510
+mov #-62, L88
+L33: .data 817
+L34: .data -991, 439, 558, -284, 968, -922, 753
+red *r1
+clr L24
+mov L101, L53
+L35: .string "wfgtehahiknsggsul"
+stop
+L36: .data 795, 561, -595, -256
+
+jsr *r5
+L37: .data 560, -477, 862, -224
+L38: .data -383, -242, -555, -443, 184, -515
+red r5
+L39: .string "gyqtznmmpvhkj"
+L40: red L36
+stop
+cmp r3, r7
+L41: .string "lssubt"
+
+L42: .string "fkwcrh"
+jmp *r2
+L43: .data -858, -70, 683
+L44: .string "nbxypqjtieoak"
+jsr L174
+L45: .string "mtpxqncw"
+L46: .string "lvvexkqgvomjg"
+sub r4, L9
+L47: .data -602, -75
+add #166, L195
+L48: .data -888
+prn r0
+L49: .data 935, -584, 603
+stop
+L50: .string "epq"
+L51: .string "p"
+L52: .string "xvmswuewplkqyaipkc"
+bne *r4
+L53: .string "chncolyxhxcnpinesjx"
+L54: .data -640, 850, -873, -981, 68, 235, -614, -118
+L55: .data 686, -867, -172, -48, -927, 469
+L56: sub r5, *r7
+L57: .data -290, -656, 70, 956
+L58: .string "kmgtaqb"
+red *r1
+inc r5
+L59: .string "t"
+not r5
+
+L60: .string "kurkalbdgsaqjsycyqefgc"
+L61: red r3
+cmp r7, r5
+L62: .string "gpomphzrhxkavt"
+L63: jmp *r3
+; comment
+inc r5
+L64: .data -221
+L65: .data 803, 435
+L66: .string "hbiwaytvxz"
+L67: .data 835, 394, 978
+L68: .string "de"
+L69: .data 819
+L70: .string "qstbd"
+L71: .string "ssvxjrkknokxag"
+L72: .data 661, 939, 943, -469, -79, -256, 551
+L73: .data -478, 759
+
+L74: .string "fywxldicfhaczrvwn"
+L75: .data -40
+inc L183
+L76: .string "goyyrzorhi"
+L77: .data 304, -506, 310, 974, 656, 601, 777
+L78: .string "ywrrbgimkvdkmr"
+L79: .data -634
+prn L203
+L80: .string "pa"
+L81: .string "ntkcacuckwqiaklcw"
+stop
+L82: .string "ts"
+L83: .string "ejztjohsfaavdqulzuzbe"
+L84: .data -516, 559, 995, 979
+L85: .data 171, -761, 360, 184, -428, -750, -343, -294
+bne L174
+stop
+L86: .string "fudbjqddkgmkxeeilzkmftu"
+L87: jsr L11
+jmp *r0
+L88: add L113, r2
+mov #18, L50
+L89: .string "ywrgtvjntodudymqcp"
+L90: .string "wzizpeqcewpmbj"
+rts
+L91: .data -500, -205, -33, 153
+lea L12, L32
+L92: .string "xytsefiyaokumwyvaofkve"
+rts
+rts
+L93: .string "mvuodcutalfqhlwpunmhfyjf"
+add r1, r2
+L94: .data 611, -919, -627
+L95: .data -511, -406, -291, 558, 767
+not L63
+dec *r2
+L96: .string "zbwkvlqxspv"
+L97: .string "nroqyyujetcth"
+L98: .string "htdiszigshohiscmklv"
+bne *r4
+L99: .string "xuoenw"
+L100: .data 5, 271, -309, -696, 333
+L101: .string "qfmhgyfqsfvvfl"
+sub L32, L27
+cmp #197, #-107
+L102: .data -607, 865, 517
+L103: .string "ifuiabmpehkstciuxiwb"
+L104: .string "sketmdrvvpt"
+L105: .string "zaeohirghxeo"
+
+L106: clr L60
+L107: .string "bfworjqq"
+jsr *r6
+L108: .string "nkenwcm"
+L109: .string "pufltpajp"
+L110: .data 891, 175, -93, -503, 549, -254, -129
+L111: .data -107, -281, 794
+L112: .data 259, -158, -668, -341
+L113: .string "ihytukh"
+L114: .data -202, 587, -617, -652, 11, 848, -842
+L115: .string "eu"
+L116: .string "oadnwgtecgkkbp"
+L117: .string "jbrcjdnrwtpbdxqbgzf"
+L118: .data 208
+L119: .data -299, 766, 756, -517, -536, 881, 470
+L120: .string "xjjrbbglo"
+L121: .string "vyyrde"
+L122: .data -812, 449, -62
+bne *r4
+L123: .string "pjqzvqdcdem"
+inc r1
+red L136
+inc L269
+L124: .data 469, 255, 596
+L125: mov *r1, *r1
+bne L52
+L126: .data 704, 650, 708, -874, -150, -857, -119, -986
+inc r5
+L127: .data 944, -310, -833, 492, -792
+L128: .data 932, -689, -800, 221, -840, -37, -232, -381
+L129: .string "rurslrbtmlbsabpfloaict"
+rts
+red *r7
+L130: red *r7
+L131: inc L52
+L132: sub #-94, r4
+inc r4
+mov #-122, r5
+L133: mov L75, L265
+rts
+L134: .string "vbviwoizzhlhhdlthyascj"
+stop
+L135: .data -240, 340, 937
+L136: .data 884, 17
+inc L188
+L137: .string "loctferhmsjfwubjbdi"
+L138: .string "uxulnkqpcjnddchodryhuq"
+dec r3
+L139: .data -500
+L140: .string "htkhqpx"
+sub L68, *r3
+L141: .string "acb"
+L142: .data -32, 71, 773, -861, -249, -458, -483
+L143: .data 423, 736
+L144: .data -21
+L145: .string "impemivnsbdnlbzzgr"
+add r0, r4
+L146: .data 125, 348, -606
+cmp r2, r4
+L147: .string "kzxncqlokpjq"
+L148: .data 217, 807
+L149: .string "vtmwpbnoctijoz"
+L150: .data -546, -519, -339, 479, -719, -591, -610, -11
+jmp L21
+L151: red *r1
+L152: .data -252
+prn L41
+cmp L252, *r2
+L153: .data 6, -729, 530, 24, 4, 14, -921, -136
+L154: .data 609, 93, 997, 360, 810
+L155: .data -597, 150, -58, 256, 260, -315, -920
+L156: .data 34, 591, -654
+L157: .string "nnksgjlxjbg"
+L158: .string "hwdrowpjfiuaybyalh"
+rts
+L159: .data 682, 218, -797, -271
+L160: .data 765, -211, 944, -998
+L161: .string "afdobuvurasutxmf"
+L162: .string "zrglwwzydsvqjfxpswwzebn"
+L163: .data -125, -258, -109, 728, 944, 438, -662, 842
+L164: .data 495, 829, -69, 21, -592, -887, -571
+L165: .string "duaprsoavwjvsdufpkykkd"
+L166: .data 35
+prn L301
+L167: .string "enuixprr"
+lea L237, *r2
+bne *r2
+inc L131
+L168: .data 173, -469, 686, 342, -141
+L169: .string "hrm"
+L170: mov r4, r1
+L171: .string "hjxefxkgfsirlraccairp"
+lea L2, r6
+L172: mov L1, L132
+L173: rts
+L174: .string "gufvtvndysdpvjnq"
+L175: bne L251
+
+L176: .string "gegugnlpjirjhrtubg"
+jsr *r2
+rts
+sub *r1, L194
+L177: .data -583, -690, 208, 534, 453, 590
+L178: .string "tz"
+L179: .string "bwwstmrgixmxe"
+add r6, *r4
+L180: jmp L233
+prn r6
+dec *r6
+L181: .string "owdpmnldudinkuqznfcp"
+L182: .data 525, 806
+L183: .string "uxucisfj"
+add r1, *r3
+jsr L141
+L184: .data 329, -586, 893
+L185: red r3
+L186: .string "difvxhbyizsrneczwfgsnbsx"
+add #73, L151
+; comment
+L187: .data -157, 88, 797, -393, 951, 490, -200, -882
+L188: .data -402, 436, -151, 745, 828, -863, -307
+L189: .string "pdrabyfkmvj"
+L190: .string "znsfeegrmc"
+bne L279
+add #-179, L216
+L191: .data 999, 85, 510, 477, -978, 522, 778, -795
+L192: .string "zchuhkzp"
+L193: .string "qfxurehacelecnitrpswjotv"
+L194: .data -223
+L195: .string "tlxguctkxsosfjbepkts"
+L196: .data -724, -348
+L197: .data 2, -434, -618, -758
+L198: .data 667, 260, -922
+L199: .data -826
+L200: .string "drg"
+L201: .string "qjvfqbk"
+L202: .string "chxlqgpvxjooygq"
+red r2
+L203: .string "jac"
+
+L204: .string "r"
+L205: .string "senuxbuvd"
+; comment
+L206: red L305
+L207: .string "fbcudhlxeuiayudcebvwzcsu"
+jmp L310
+L208: .data -665, 922, -582, -494, -600
+L209: .data -303, -316, 196, -332
+clr L223
+L210: .data 661, 145, -342, -762, -441, -404
+rts
+not *r0
+
+L211: .string "fvkaugqrmtahbugljjxrvx"
+L212: .string "zqjwaqvoga"
+L213: .string "b"
+L214: .data -853, 779, -393, -734, -925, -947
+cmp L251, #-145
+L215: .data -427, 475, -612, -154, 791, 957
+inc r7
+L216: .data -120, -223, -208, -448, -674, 106
+L217: red L276
+L218: .string "ovvti"
+inc *r5
+inc L251
+inc L30
+L219: .data 518
+L220: .data -165, -405, 18, 229, -897, 348, 714
+L221: .data -112
+L222: .data -619
+L223: .data 677, 872
+clr L231
+L224: .data 275, 410, 266, -253, 223, -153, -980, 268
+L225: .string "fukmcpjroerxcqr"
+L226: .string "xkhzmdzfplhr"
+L227: .data -712
+L228: .string "zxysuq"
+lea L188, *r3
+lea L309, r7
+L229: .string "asppdkxrjdkleyvxeoyusx"
+L230: .data -432
+L231: .string "sdoprjupynv"
+L232: .data 960, 182, -655
+L233: .data -916, 705, -348, 190, -680, -482, -867
+
+L234: .data 685, 134, -435, -217, -443, 876
+L235: sub L310, L315
+L236: .string "jnjxvvfjjwsrgrzthzrszq"
+red L180
+L237: .data -657, -640, -82, -471, 885, 879, 741, 386
+jsr *r6
+L238: .string "upjwexandf"
+
+; comment
+; comment
+dec *r6
+L239: bne *r0
+L240: not *r6
+L241: .string "nzqqubog"
+rts
+L242: .string "zjxqluibbavajpr"
+dec r1
+L243: .string "tudywjunuekpfnhcifay"
+bne *r6
+L244: .string "suhv"
+; comment
+dec r4
+not r3
+not *r5
+bne L211
+L245: .data 237, 951, -81, -392
+L246: .data -428, -756, -590, 82, 590, 965
+L247: .data -499, 197, 153, 119
+L248: .data 185, 115, -400, -841, 598
+L249: .data 29
+L250: .string "rbevhbxmtotglavltosthv"
+dec L273
+L251: .string "hlcxvzdbdpuwkujvmidrd"
+lea L63, *r2
+cmp *r1, r2
+L252: .string "tvyblpwhntaytgiczzq"
+L253: .data 298, 437
+stop
+L254: .data -891, 536, -138, -156, -606
+L255: rts
+L256: jmp L35
+; comment
+add #248, L23
+not r4
+L257: .data -722, -874
+not *r2
+inc r3
+not *r0
+L258: .string "ohjwicoeaibrro"
+L259: .data -491, 130, 819
+sub #239, *r1
+L260: .data 94, -797, 241, -835, 542, -679
+L261: bne L300
+L262: jmp L8
+L263: .data -937, 601, 176, 896, -214
+jmp *r6
+L264: .string "avvkhmnjrykjrwexwwpto"
+L265: .string "rwlihsxrf"
+add r7, r7
+L266: .string "rtcsdnyopppexjwprljtwlb"
+
+L267: .data -215, -201, 685, 196, 754, 915, 577
+L268: .string "upqttckqj"
+red L39
+dec *r0
+L269: .data 303, 690, 464, -995, -140, -322, -325, -746
+L270: .data -63, -454
+L271: .string "gtjux"
+L272: .string "jabn"
+stop
+prn #-221
+clr *r2
+sub *r0, r2
+L273: .string "tkhenoawmfmkkwtgwzdakt"
+
+L274: .string "qhfuhfucxwwtoetcbgwjsh"
+add #-79, L248
+bne L90
+L275: .string "siqsxubbwcsrsoutf"
+L276: .string "jsozmto"
+L277: lea L221, *r1
+dec r1
+L278: .data -974, -936, -362, 663, 292, 718, -932
+L279: .data -910, -183, -549, 534, 268
+L280: .string "aulaysrutjekgzjiuuq"
+prn r3
+L281: .data 164
+L282: .data -198, -817
+bne L304
+L283: .data -895, -324, 457, -398, -422, -670, 193
+L284: .string "rjtfcefetosfsuugifqbkai"
+L285: .data 544
+; comment
+L286: .data -957, -595, 611, 942, 286, 43, -896, -175
+L287: .string "mzk"
+L288: .string "q"
+dec r6
+L289: bne L81
+jmp L307
+cmp L295, #-151
+L290: .data 672, -458, 638, 124, -800
+L291: .data -835, -756, -894, -317, -397
+stop
+lea L87, L312
+jsr *r6
+sub *r5, L309
+bne L134
+L292: .data -819, -71
+L293: .string "xjcgiabqsthoaenjtpvrc"
+prn L179
+L294: .string "bidkbo"
+L295: .data -716, 804, -526, 202
+L296: .data 532, -577
+L297: .data 214, 964, 967, -97, 331, -523, -505
+jmp L192
+L298: .string "pjhncvttfkptnzoaoglytk"
+L299: not L99
+L300: .data -598, 227, 276
+lea L309, r6
+clr *r0
+
+jmp *r5
+L301: .data 643
+dec L315
+L302: .string "vydadvquv"
+L303: .string "lcbfsgmmq"
+L304: .data -985, 88, -307, 946, -26, -815
+L305: .string "urtbs"
+L306: .data 850, -240, -813, 914, -949, 773, -160, -799
+not r6
+stop
+L307: .string "fafkaaaqhemswfztxhthetds"
+L308: .string "jyiquqlszly"
+clr L314
+L309: .string "fuhganozyngz"
+inc *r1
+bne *r2
+L310: mov L11, *r7
+L311: .data 296, 876, -139, -507, 240
+stop
+L312: .string "lupnesjvefevgrnkdp"
+L313: .data -332, 53, 343, -827, 878, 16, 889
+L314: .data -508
+L315: dec r7
+L316: .string "lnjbvg"
+L317: .data 356, 448, 250, -712, -840
+stop
+L318: .string "spdnhwoofyzhxvptydipnrqn"
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 81
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .data 880, 125, -517, 787, 693, -7, 822
+L1: .string "w"
+L2: .string "ebmzgpchl"
+L3: .data 68, -40, 327
+L4: .data 35, -527, 839, 983, 578, 55
+L5: .string "sjfayyxuaxghycvain"
+L6: .data -619, -2, 686, 929, -643, 327, 364
+L7: .data 867, -859, -172, -511, -586, -971, 253
+L8: red *r3
+L9: .string "jupf"
+L10: .string "fzrjjryo"
+L11: .string "lhvbqb"
+L12: mov L324, *r6
+L13: .string "fho"
+; comment
+L14: .string "mttxuaudejri"
+L15: .string "bjzzxuxavyphbble"
+L16: .data -658, 148, 7, -136
+lea L56, r0
+; comment
+L17: .data -739, -71, -40
+L18: .data -341, -690
+mov r0, r0
+L19: add r7, r1
+L20: .data -935, -947, -698
+L21: lea L1, L16
+L22: .string "ijlxsvigjrpgctouzxzfj"
+L23: sub r0, L52
+prn L176
+L24: .string "wyuzemltvnwjsgz"
+inc *r2
+L25: .string "ojyp"
+L26: not *r4
+; comment
+L27: .string "rn"
+L28: .data 584, -307, 867, -103, -600, -307, 868
+L29: .string "wpraxz"
+L30: .data 497, -743, 416, 690, -827, -764
+prn #-254
+L31: .data 871, -7, 118, -475, 618, -882, -986
+L32: .data 166, -78, -908, -414, 962, -357, 730
+
+L33: .string "gqjdnyohjxylvwg"
+L34: .data 569, 326, 74, -946, 153, 635, 637, 913
+jmp L34
+L35: .data -803, 998, -423, 748, -770, 826
+L36: .data -409, 557, 407, -503, -503
+add r5, L15
+L37: .string "jqdnquzgtiq"
+stop
+L38: .string "oiaxdsycc"
+L39: .string "tkrscvtqrcbtxrfcgrrkmf"
+L40: sub L292, L16
+mov #69, r4
+L41: red L290
+L42: sub r7, r6
+L43: cmp #-31, L206
+L44: .data -507, 309, -82, 906, 825
+L45: .string "kubhcpezpancpdvys"
+sub r4, r6
+clr *r5
+L46: .data 856, 818, 14, -478, -594, 43, 864
+L47: .string "arledf"
+L48: .string "borsqlagq"
+lea L26, *r0
+L49: .string "jskjusnzhalkssroytihu"
+bne *r4
+L50: .string "revwasrmuvv"
+L51: .string "keg"
+red L10
+L52: .string "jxvraf"
+L53: .string "dtwur"
+jsr L34
+lea L33, r2
+L54: .string "jbsvkrqlkiujoonnn"
+L55: .string "bxsix"
+L56: .string "axmhxhzcjntdno"
+L57: .string "pvxqknkosrculaqdryri"
+L58: jsr L13
+
+L59: .data 118, 229, -824, -487, 41, 241, 308, -582
+
+L60: cmp r5, r1
+red *r4
+L61: .string "epccbojfjabbgn"
+L62: jsr *r4
+L63: .string "zaioldsi"
+L64: .data 939, 344, -116, 739, 470, 684, 839
+L65: .data -821, 20, -923, -534, 307, -61
+L66: add #125, *r1
+add #-243, *r0
+jsr L2
+sub L317, L25
+L67: .data -369, 830, 361, -612, -445, 888, 658
+L68: .data 371, 309, 892, 676, -618, -448, 622
+cmp L65, L12
+L69: .data 269, -220, -611
+
+L70: .string "tjd"
+L71: red L165
+; comment
+red *r4
+L72: bne L315
+L73: .string "ucprdota"
+L74: .data 963, -734, 183, 171, -82, -261, -781, -587
+dec L26
+L75: .data -550, 852, -762, 149, 522, 160, -35
+not *r1
+L76: .string "sbisrkmrfqwkqaznx"
+L77: lea L277, L156
+L78: .string "gbntzscrdkswdzwv"
+rts
+L79: .string "oocgdxezewqpljx"
+stop
+L80: .data 545
+L81: .string "pzhmqgr"
+L82: .data -747, 69
+clr L23
+L83: .string "trbmhdg"
+L84: .data -668, 456, -407, 999, -202, -982
+L85: .string "bzjdidpnrqjjdgribn"
+L86: .string "ancqbazebkrctt"
+stop
+L87: .string "yfqhnssneplhuutpwmzi"
+prn L100
+stop
+rts
+jsr *r3
+L88: .string "vnxafhuknogzn"
+L89: cmp *r3, r3
+L90: .data 488, -401, -996, 81, -333, 804, -616
+L91: clr r4
+L92: .data 422, 380, -965, 653, 951, 402, 800, -589
+lea L86, *r4
+L93: .data 175
+dec L79
+L94: .string "cpcsrxknlkswtxkqemnrz"
+L95: .data -362, -53, 25, 993
+L96: .data -887, -943
+L97: .string "fniwftxvxbykuts"
+; comment
+bne *r7
+L98: .data 319, -802, 463
+L99: .string "bnqom"
+L100: .data 949, 819
+L101: clr L244
+L102: .string "hqdomdlp"
+cmp L242, L7
+L103: .string "yokcnizt"
+jsr *r0
+L104: .data 273
+L105: .string "cwxakmxfhjonfwgmgcgh"
+L106: .data 44, 365, -142, 377, -516, -655
+L107: .string "b"
+lea L261, *r2
+L108: .data 754, 898
+L109: .string "rldrvbwfzddmira"
+jmp L0
+L110: .string "qqagfhxshwasmpmddd"
+L111: .string "n"
+L112: .string "holkyonjmksjgh"
+L113: .string "lkbupoeau"
+L114: .string "qfotyhcicnbeuuqy"
+L115: .string "yadhc"
+L116: .string "heqlmecrd"
+jmp L57
+L117: .data -682, -94, 424, -358, -839, -660, -543
+L118: .data -509, 961, -495
+bne *r5
+rts
+L119: jsr L43
+L120: .data -170, 491, 450
+; comment
+
+L121: .string "vqkimkujvjaimefyylk"
+
+
+L122: .string "oivta"
+L123: .data 999, -293
+L124: inc r3
+L125: .data 179, 262, -692, 382, -324, -113, 340, -104
+L126: .data 190, -558, -693, 947, -313, 973, -900
+lea L78, r1
+red L138
+L127: .string "cazipmqes"
+L128: add *r0, *r4
+L129: .data 618, -603, -514, -773, -79, -143, -954
+L130: .data 700, -73, -292, 173, -742, 543, -460, -869
+L131: .string "evkgahjcmkxiepp"
+prn r4
+stop
+L132: .data -715
+prn L279
+L133: .data -543
+clr L299
+L134: .string "qoaadyhm"
+jsr *r1
+L135: .data -188, 277, 326, -290, -514, 713
+L136: .data 947, -421
+L137: .data 317
+add r6, L106
+L138: .string "igtwcgkxginxgzuia"
+red L78
+L139: .data -231
+L140: .string "wfa"
+red L233
+L141: .data -527
+L142: .data 940, 108, 282, -901
+L143: .data 601, -313, 608, -812
+rts
+L144: .string "f"
+L145: .string "ucostpytwspg"
+
+L146: .string "dvugyjakvgdftxfevdbv"
+L147: .data -514
+jmp L12
+; comment
+jmp *r6
+
+L148: .string "hpavdbeljgortjhsgvcsj"
+dec L22
+
+rts
+; comment
+L149: .data 69, -856, 744, -226, 281, 442
+L150: .string "mqfgxfbxrrycfale"
+L151: .data -724, 930, -672, 270, -738
+L152: .data 50
+L153: .string "nkpdlyjo"
+L154: .string "piegx"
+L155: .data -952, -749
+L156: .data -53, 116, 484, -354, 719, -180
+L157: .string "bvm"
+L158: .string "xgnlmnczxivnbenzpskqdnxb"
+rts
+L159: .data -464, 796, -778, 288
+
+L160: .data -84, 24, -332, -999, 538, 243, -949, -711
+add #-75, *r3
+add #144, r6
+L161: dec r1
+add L7, *r1
+L162: .string "wxjaicydwryrjc"
+L163: .data 10, -682, -421
+; comment
+L164: .string "vxjf"
+L165: .string "mxsbaltgdtufbhcq"
+L166: .string "bejahqsmltmqyauma"
+L167: .string "lncyiplibnzz"
+L168: .data 823, 324, -150, 259
+L169: .data 622
+L170: .data -623, -378, -6, -194, 539, 676, 684, 900
+dec r6
+L171: .data -617, -793, 750, 496, 448, -439, -782, -822
+L172: .data 401, 427
+L173: .string "meffcleghedwif"
+L174: .string "kyapjudrslqo"
+L175: .data -633, -688, 589, 331, 580, 98
+L176: .data -792, -167, 919
+bne *r1
+L177: .data -427
+jsr L308
+L178: inc L198
+bne *r6
+L179: stop
+mov *r1, r0
+L180: .data -58, -129, -165, 644, -265, 338, -43, 566
+L181: .string "ypfenllpbkhwhptqycjqvb"
+L182: .string "y"
+L183: .data -844, -342
+rts
+dec *r1
+red *r7
+L184: .string "jbiummlizr"
+rts
+L185: .string "jpoecsximjhepowyhp"
+L186: .string "ldkbewfokhsioxezzomt"
+dec L311
+L187: .string "dfunjoejxnp"
+
+sub r7, *r1
+clr L322
+L188: .data 979
+L189: .string "dvlnqnksubneznhqnmfc"
+rts
+cmp L43, #-26
+L190: .string "mmipejwtpncijclfbizbo"
+stop
+; comment
+rts
+inc L51
+not r5
+L191: bne L114
+L192: .data -46, 726, 356, 192, 808, -603
+L193: .data 212, -617, 489, -668, -336, 897
+; comment
+L194: .data -841, -827, -253
+L195: .string "fubwcrolyiharhne"
+; comment
+L196: .string "ctszwccivwclgotjkssdmjdb"
+lea L162, r0
+rts
+L197: .string "pyi"
+L198: .data -544, -562, 900, -101, -613, 391, -846
+L199: .data -788
+L200: .data -64, -523, -453, -782, -328, -966, -138
+jsr L286
+L201: .data -996, -529, -268, 21, 952
+rts
+not L81
+L202: .data -346, -894, -952, -619, 331, 638, 450, -75
+L203: .string "nopujzsvqzhygafqaegi"
+
+L204: .string "pcmmc"
+L205: .string "puqtprzeo"
+stop
+mov r6, L317
+not r5
+L206: .data 280, 167, 261, -75, 820
+L207: .string "keyngpsbfmmuznhmbsir"
+L208: .string "uhwqqtx"
+bne L27
+L209: .string "yd"
+red r1
+L210: .string "ezhuur"
+dec L81
+L211: .string "bvgn"
+L212: .data -954, 289, 477, -617
+stop
+L213: .string "zrgqvxrubaaxlmi"
+L214: .string "jituckpp"
+L215: .string "jnkfradw"
+L216: .string "hlcresvc"
+dec r4
+L217: .string "cymjgftwhanq"
+L218: .string "xroo"
+L219: .data -887, -311, -431, -384, 430, -566
+stop
+L220: .data 560, 732, -427, -246, -906, 365, 886, -5
+add r3, *r5
+L221: .string "tgfiijfvhqvkestqk"
+L222: .data -763, 27, 857, -520, 780
+L223: .data -268, -833, -592, -888, -7, -830
+cmp r2, r0
+L224: .string "uxypfhdjxzhkerhmnznwigqa"
+clr L298
+L225: .string "vwrfffqwcbqsxhfde"
+L226: .data -510, -657, -679
+L227: .string "sggtnvnusijvtlqv"
+dec *r6
+L228: .string "ydrartfdhy"
+red *r6
+
+dec r1
+L229: .data 412, -968, 378, -394, 897, 568, 514
+cmp r6, #-170
+clr r4
+L230: .string "qrwpsloxekgmuohwladjxrlu"
+lea L105, *r4
+L231: .string "rmxh"
+L232: .string "bvzzikyhe"
+L233: .string "mozlxgewsg"
+L234: .data -716, 274, 436
+L235: .data 568, 812, 570
+L236: .string "nsvrqbea"
+L237: .string "ws"
+L238: .data -990, 141, -9, 7, 781, -952, 842
+stop
+bne *r0
+red r4
+sub *r1, *r2
+L239: .string "repnavuewkajqzbqnopbm"
+L240: .string "fijvsyjieuemsekp"
+L241: .string "maerlrblbjskyakwp"
+inc *r7
+L242: .data -539, -325
+L243: .data 341, -697, -731
+rts
+L244: .string "q"
+L245: not *r3
+prn L133
+L246: jsr *r5
+L247: prn r6
+bne L323
+rts
+L248: .string "zxfcxle"
+stop
+lea L258, *r1
+stop
+L249: .data -598
+L250: .data -983, 813, 968, 904, 673, 840
+L251: .string "ebwtohp"
+L252: .data -862, -140, -238, 404
+stop
+L253: .string "hrdbjakgtunxlno"
+L254: .string "mnjs"
+L255: .string "pgcccrqclqbmasgpzkdrpr"
+L256: .string "qofanrnpifvxgoqacih"
+L257: .data 468, -521, -729, 554, -870, 683, -334, 213
+rts
+red L276
+L258: jmp *r3
+dec *r0
+add #-204, *r7
+not *r7
+L259: .data 916, -800, 586
+
+L260: lea L269, *r4
+L261: .data 115, 845, 137, 512, 131, 598
+L262: .data -677, -383, 478, 608, -598, 872
+L263: .data 834, 170, -494, -339, 244, 404, -986, -923
+L264: .data -374, 623
+L265: .data -87, 24
+L266: .data -212, 165, -175
+cmp #-220, #113
+L267: .data 521, -671, -6, 910, 807, -386, 177, -62
+rts
+L268: .data -858, -290, -134
+red r4
+L269: .string "m"
+L270: .string "pbkfzsbr"
+stop
+stop
+L271: .string "qtfekfv"
+; comment
+L272: .data -809, 328, 309, 173
+L273: prn r7
+jsr L291
+L274: .data -852, 341, -423, -160, 832, 758, -886, 786
+L275: .string "eeruvdretpxiwy"
+L276: .string "vihvhyygwshbjc"
+L277: inc L315
+L278: .string "uabkctzd"
+jmp L205
+L279: .data 742, 132
+L280: .data 221, -375, 316, 54, 320, 18, -71
+L281: .string "q"
+; comment
+L282: .string "sbu"
+L283: .string "iwuqlr"
+L284: .string "uwgn"
+L285: .data 382, -880, -413, -460, 780, -346
+L286: .string "qicwdcdm"
+prn *r2
+red r6
+cmp r6, #214
+L287: .data 823, -256, -470
+jmp L238
+L288: .data 51, -724
+not r2
+L289: .string "qoyswqfhqsbxtlynwjpewvgh"
+L290: .data -884, 144, 169, 906
+L291: .data -455, 285, 936
+L292: stop
+L293: dec *r6
+sub #37, r6
+L294: .data -461, -890
+L295: .string "qzmzim"
+L296: .string "zbqmaigvilixwfyee"
+bne L304
+rts
+mov *r2, L225
+L297: .string "xibj"
+L298: .string "h"
+L299: .string "szfuzswgzlpcmrvomhybhwkb"
+L300: .string "zk"
+inc *r2
+L301: .data -514, 140, 96, 60, 752, -260, 754, -122
+L302: sub *r6, r1
+L303: .data -666
+L304: .string "lgvbuckzfw"
+L305: .string "i"
+L306: .string "cxlwvrlkytblpqfmhnd"
+L307: .string "xpksmulxthfwcmdukvvqmk"
+L308: .data -724, 574, -864, -103
+not *r4
+L309: .string "dqvipttlxyxrkap"
+cmp #-163, r7
+L310: .string "gubocicwre"
+L311: .data 944, -204, 430, 787, -970
+L312: .string "ionbgducsacv"
+L313: .string "sphqqphxwmszzwe"
+L314: .string "fupqrhkpqgwadiz"
+L315: .data 688, -473, -226, 365, 398, -466
+; comment
+mov *r6, r0
+L316: .data -663, -108, 90, 750
+L317: .string "wetrcurzjsawxotfxd"
+L318: .data -690, -328, -342, -249, 805, 645
+L319: .data 951, 447, -466, -36, -769, -948, 478
+L320: .data 165
+L321: .data 219, -157, -646, -173, 239, -125, 84, 249
+L322: .data 197, -952, 114, -134
+L323: .data -422
+; comment
+rts
+L324: .string "rux"
+L325: .data 565, -687, -804, 852, -236, 834
+L326: .data -684, 785, 622, 19, -56
+bne L68
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 82
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+add *r0, *r7
+L0: stop
+jsr *r6
+L1: .string "yzjvwwop"
+dec *r6
+L2: .string "najmuemvy"
+L3: .string "ndkwu"
+L4: .string "lqpruyciboy"
+sub r2, *r4
+add r4, L2
+mov L2, *r6
+L5: .string "be"
+L6: stop
+L7: add L25, *r4
+; comment
+L8: .string "dmwcwvpcyqtpj"
+L9: .data 726, 456, 866, 587, 604
+L10: .string "oign"
+jmp L221
+; comment
+L11: .data -593, -256, 631
+L12: .string "xowzovnqnhuvvmymg"
+L13: .string "pzmmgswaxqv"
+L14: clr *r7
+L15: .string "w"
+L16: .string "mvzuqhl"
+L17: .data -860, -56, 954, -44, 522, 902
+L18: .string "dixpoeomuzqwnqzhqzshe"
+L19: .data -90, 839, 405, -870
+L20: .string "lphcfkoqfmrhvmnffqbcj"
+not *r5
+L21: .string "eqzwnrpegknnthdbaxzm"
+L22: not *r6
+L23: .data 975, -740, 598
+not r2
+dec L9
+L24: .string "agejmgmowfgpjrtn"
+L25: .string "evgmmuddlxcnedelp"
+L26: .data -852
+L27: .string "p"
+L28: .data -19, 204, -164, 977, 767, -317
+inc L87
+clr *r6
+dec *r5
+prn r1
+jmp *r4
+L29: inc L55
+L30: .string "nrwamvsvq"
+L31: .data -38, 493, -407, -250, 64, 480, 658, 237
+L32: .string "ccbochsune"
+jmp *r4
+L33: .string "fvyrfbwrgxtrjukwtl"
+stop
+L34: .data -969
+L35: jmp L24
+stop
+L36: .string "kwaey"
+L37: dec L32
+
+L38: .data -345, 925, 617
+L39: .data -660, -115
+L40: clr L117
+L41: .data 494, -943, -42, -361, -980, 950, -765, 757
+L42: .string "yvy"
+L43: .string "leumfjyovucywke"
+L44: .string "ghmj"
+L45: prn *r0
+jsr *r5
+L46: sub #-175, L25
+L47: .string "xajkltsshtrtrsfcjg"
+L48: .data 917, -321, -121, -360, -541, -879
+L49: .data -723, -880, 628, 665, 142
+; comment
+L50: .data 33
+L51: .string "b"
+L52: .data 965, 772, 534
+not L317
+L53: .string "aqipatairgjzshirkutvo"
+L54: .data -897, -193, 46, 179
+L55: .string "mohcuemqdmqharj"
+L56: .string "wbnwqx"
+L57: .string "qcnyoii"
+L58: .data 971, -347, 101, -393
+L59: .string "nwx"
+L60: .string "ebbhyz"
+clr r0
+L61: .data -243, 690, -430, 304, -769, -106
+L62: .data -346, 575, 47, -806
+prn L8
+L63: .data 426, 734, -814, -393
+L64: .string "nsrqxaxhjrxhibetmszmyce"
+add L60, L62
+L65: .string "fahxolfs"
+L66: .data 499, -882, 395, -42
+L67: .data -299, -144, -567
+not r2
+bne L24
+red r1
+L68: .data 186, -923, -318, 642, -312, 479, 666, -878
+L69: .string "hifcy"
+L70: .string "dpexejdnr"
+L71: jmp *r5
+L72: .data -440, 706, -244, -15, -145
+not r4
+L73: .data -480, 232, -576, -799, -784, 426, 189, 695
+not L37
+L74: .data 869
+L75: .string "repmjehuzcidiweeqbsfhbc"
+L76: stop
+L77: .string "cmbgxiozojtfxfoscvf"
+L78: .data 808, 975
+L79: bne *r1
+L80: .string "flhymxxnl"
+L81: .string "rk"
+L82: .string "qqakbnilxysrhmv"
+mov r6, L88
+L83: .string "rdsipziowcokwoaehsonltuy"
+L84: .string "pxjeqberc"
+; comment
+L85: .string "wzvzpgpniziza"
+L86: .data -641, 351
+rts
+L87: .data -22, -574, 499
+clr r5
+L88: .data -819, -232
+red *r0
+cmp r6, #-212
+not r3
+L89: .string "lc"
+not r0
+L90: .data -817, 866, 997, -782
+L91: .data 334, -3
+L92: .data 200, -986, -686, -545, -953, 64
+; comment
+L93: .string "jrtyvgbrjy"
+L94: .string "rrufptdafboqaxwwqvw"
+L95: .data -192, 362, -259, -66, -650, 48
+L96: .string "hdmentlqoesnpeyeuafeq"
+inc *r4
+L97: .data -608, -993, -240, 176, -414
+L98: .data 509
+L99: .data 988, -653, -483, -71, -617, -667, 126
+; comment
+inc *r3
+stop
+lea L67, *r0
+clr r1
+L100: .string "imgdc"
+L101: .string "zyxkyemzatfmhz"
+lea L15, r7
+add #242, r4
+not *r6
+
+L102: .string "eumntr"
+L103: .string "hjiuxxhdcsnhbpb"
+L104: dec *r7
+sub r6, r5
+rts
+rts
+lea L220, *r4
+L105: .data 541, 97, -711, 329, 426, 317, -575, -167
+red *r4
+L106: .data -209
+L107: .data 289, -680, 690, 784, -639, -765, -34, -451
+red *r6
+L108: .string "tqnhgiyneuel"
+L109: .data -788, 777, -449, -657, 792, -776, 230, -104
+rts
+L110: .data -62, -693, 205, -149, -748, -209, -840
+L111: .data 310, -725, -745, -122, -962, 200, 26, 343
+prn #134
+not r6
+L112: .data 479, 77, -255, -671, -371, -792
+L113: .string "qnfsilxdysuqmgg"
+L114: .string "n"
+L115: .data -883, 490, 600, 25, 21, -55
+L116: .string "ndludjpoamfbyvpzfjbjwx"
+L117: .string "ekpgwehgwrxstapaktac"
+L118: .data -52, -478, -11, 848, 470, 603
+; comment
+L119: .data 868, 760, 557
+L120: .data 413, 389, 782, -507, -824, -562, -496
+L121: .string "ykhrfuagwisrhtex"
+; comment
+L122: .data 880, -576, -985, -103
+L123: .string "xciyzufroblg"
+clr *r1
+L124: .data -474, -575, 30, -853, -404, -821
+not L167
+L125: .data 798, -756, 449, 308, -376, -397, -957
+L126: .data 527, 609, 518, -124, 149, -428
+L127: jsr *r1
+L128: .data -89
+L129: stop
+mov *r0, r0
+L130: .string "kwiyjciwtuetkrklertisntr"
+L131: .data 386
+L132: .string "qctkuexmzefqvdqidezihnts"
+bne *r0
+L133: .string "cre"
+L134: .string "uvihrtlkqdavwdidhvw"
+L135: .string "sr"
+L136: .data 888, -877, -958, -55, 798, -547, 541, -341
+L137: .data 291, -563, 1, -162, -730, 701, -201
+L138: sub *r1, r7
+L139: jsr L294
+stop
+L140: .data -250, 315, 543, 332, -333, 502, 642
+L141: add *r0, r4
+L142: .data -954, 68, 131, -67, -370, -135, -165, 806
+L143: .string "n"
+L144: .string "knwqzriipzp"
+L145: .data 100, 856, 185, -450, -837
+L146: .data 338, 743, -70, -115, -449, -257
+clr L166
+; comment
+not L306
+jmp *r4
+L147: .data -620, 501, 746, 540, 274
+L148: jmp L7
+jsr *r1
+L149: .string "iozzfkpumpftxbjftc"
+L150: .data -321, -873
+L151: .string "nzpfmypunyhnmwetlvxm"
+L152: .string "wvdpdbfka"
+L153: stop
+sub r6, *r5
+jmp *r4
+L154: .string "zdevkqblxl"
+L155: .data 82, -434, 991, -468
+L156: .data 979, 388, 686, -320
+stop
+L157: .data 354, -331, 905, -971, -43
+L158: .data 498, -827, 697, -853, -594, -784, -697
+
+add r3, *r0
+L159: .data 87
+add r5, r0
+L160: .data -520, 785, -922, -790, 419, 589, -538
+L161: .data -909, 566, -408
+L162: .data -307, 964
+L163: .string "yudrvzhhlyjihylpeexm"
+L164: .string "pkh"
+L165: .data -676, -182, 950, 508, 980, -387, -700
+L166: .string "acisonzhnmxdyplfywefp"
+L167: .data 181, -657, 560, -943, -766, 403, 986
+; comment
+rts
+L168: .data 470
+L169: lea L15, *r1
+L170: .data 702, -596, -201, 390, -997, 490, -577
+L171: .data -613, -968, 881
+rts
+; comment
+add r1, *r1
+L172: .string "tpisi"
+L173: .data 382, -752, -918, 793, -916, 486, 762, -636
+L174: .string "xvznc"
+L175: .string "aplsantdrnxnofmrce"
+L176: .data 691, -115, -624, -341, -86
+L177: .data -912, -613, -517
+L178: .data 163, 562, 890, -160, -962, -534, 13, 834
+L179: .data -520, -88, 812, 356
+not *r5
+L180: .data -424, -732, -365
+L181: .string "afgssnzmgj"
+L182: .string "ebgwcccpepd"
+L183: mov *r2, L230
+L184: .string "wuarjujrcsbrft"
+
+L185: .data -27, 418, -454, 336, 567
+L186: .string "qcgkhnfnlqduolyj"
+; comment
+L187: .data -19, -728
+cmp *r1, r4
+L188: .data 401, -187
+dec L198
+sub *r6, r3
+bne L279
+L189: .string "w"
+L190: .string "jxdwtnyuku"
+jmp *r6
+L191: .data -483, 914, 870, 352, 612, 42, -389
+L192: .data 606
+
+stop
+stop
+cmp #27, *r7
+dec r1
+L193: .string "uclleh"
+L194: .data 334, 203, -223, -344, -757, 705
+L195: not L94
+L196: .data -349, 293, -805, 178, -102, -136
+L197: .data 934, -126
+stop
+L198: .string "gn"
+L199: .data 436
+L200: .data 420, 475, -886, 513, 902, -757, 838, 280
+L201: .data -827, 23, 249, -178, -462, 761
+jmp L201
+L202: .data 208, 913, 186, -112, -12, 873, 497
+bne *r1
+dec r0
+L203: .data 902, -936, 175
+jmp *r7
+L204: .string "doxijycwzkzskk"
+L205: .data -50, -956, 522, 368, 238, -964, -528, -364
+L206: .data -446, 540, -606, 422, -996, -66, -162
+L207: .string "bxt"
+rts
+L208: .data 190, 0, 940, 898, -466, 81
+L209: .string "htakuymqlr"
+
+L210: .data -163, -864, -807, -165, -5, 857
+L211: .string "jflddklrmzjtcrwhnbqda"
+sub *r3, r3
+cmp #-158, r4
+L212: .data 77, -237, -292, -178
+L213: .string "bhycgzbvlo"
+L214: .string "zwkimk"
+L215: .string "juauzcpzqqoojt"
+mov #185, r6
+L216: .data 882, -835, 208, -92
+L217: .data -884, 104, -701, -874
+L218: .string "khjxjintesyaazva"
+L219: .data 127, 402, 84, 169
+
+L220: .string "svaxtnbtuehnfefmkaf"
+inc *r3
+L221: .string "kiapvoyrkppcsaww"
+L222: lea L235, *r0
+stop
+L223: .data 287, -855, -310, 760, -781, 959, 650, 772
+L224: .data -594, -551, -249, 514, -181, 561, 489
+L225: cmp #96, #48
+dec L67
+cmp *r2, L165
+L226: dec *r0
+jsr *r2
+L227: .string "kicknsgjmdfttmvycg"
+lea L304, r1
+L228: .string "aconiofs"
+mov L31, *r2
+L229: .string "lmaebcwmxvjbjpwk"
+clr r3
+add #20, r0
+L230: .string "ovfbtsegnvctzcvwzwvu"
+; comment
+L231: .string "lpyqoducltuihvxbabba"
+dec L98
+L232: .string "xlbplfybsisvs"
+L233: .string "ynmu"
+L234: .string "wyaqwy"
+L235: not *r6
+L236: .data 347
+mov *r4, *r0
+L237: .string "saljwfqxdhwqlrtwqeqbnp"
+L238: .data 482, -721, 568, -680, -355
+red L288
+red r2
+jmp L156
+rts
+L239: .data 861, -641, 746, -987, -556, -652, -339
+inc *r0
+sub L288, r2
+; comment
+L240: .data -108, 215, -754, -941, -839, -757, 648
+L241: .string "rgzxib"
+L242: .string "wxccbykkjnqppivl"
+L243: .data 171, -818, 753, -391, 976
+L244: .string "njdlkfbwratordlaflf"
+; comment
+L245: .string "ngjtijqxtmkeqlgos"
+L246: .data -61, -53, -285, -817
+mov *r4, r2
+bne L211
+L247: .data 150, -695, -513
+L248: .data -895, 369, -187, -226, -750, 985
+L249: .string "nrofiiwecwxflnlc"
+
+rts
+L250: .data -798, 988, 880
+L251: not r1
+L252: .string "ujlfighryndflrtisv"
+L253: .data -158, 676, 14, -20, 383, 420
+L254: .string "vyxeehoovsvefzpwc"
+
+L255: .data -117, -759, -339, -468, -599
+L256: .data 670, -553, -202, -928, 985, -744, 665, -580
+
+lea L257, *r6
+L257: .data -588, 417, 850, -866, 566, -961, 587, 877
+L258: .string "qqtrwoadaztqixcgkkvh"
+L259: .string "vwelfmclm"
+clr r0
+L260: .data 230, 889, -231, -79
+dec r5
+inc L140
+L261: .data -655, 773, -91, 931, -706, 192
+L262: .data 569, 509, -46
+L263: .data -469, -599, -347, -12, 484, 681
+inc L317
+L264: .string "eaqfpddxz"
+L265: .data 51, -897
+L266: .data 253
+
+L267: red L83
+L268: .string "enbg"
+L269: .string "knmrnyxiicmipcxrvdpjzotf"
+L270: .data 192, 557, -489, 378, -820, 475, 923
+jsr L89
+L271: .data -359, -864, -180, 798, -197, -656
+L272: cmp L80, r1
+inc *r5
+L273: .string "itgcdzpvmjelomosecwiw"
+L274: .string "xexjqj"
+; comment
+L275: jsr *r1
+bne L318
+lea L228, *r5
+L276: .data -757, -213, -23, 31, -468
+L277: .string "pfxtazp"
+L278: .string "m"
+L279: not *r3
+L280: red *r3
+add #253, L14
+L281: .string "vppgkqn"
+L282: clr L304
+not r1
+stop
+cmp *r5, #233
+mov *r7, *r2
+L283: .data -793, 305, -775, 57
+dec *r2
+L284: .data 246, 540, -887, -138, 781
+L285: .string "msvwmkmnqnforsgvh"
+L286: .data -817, -940, -860, -761, -338, -201, 882, 675
+L287: .data 271, -877, 621, -918, 907
+L288: .data -113, -628, 360, -45, 905, 155
+L289: cmp *r1, r0
+L290: .string "owfytdjs"
+L291: .string "igjixgakwzejypzb"
+cmp L292, #-122
+; comment
+L292: .string "r"
+L293: .data 938, -393
+L294: mov #151, L252
+L295: .string "fn"
+dec L39
+inc r6
+L296: .string "otyfwiraiyo"
+jmp *r2
+
+L297: .string "tnjyljlr"
+L298: .data -333, 801, 512, -889, 474, -128, 37, 823
+L299: .string "tlwtmfspnqbevfjd"
+L300: .string "ixshp"
+L301: .data -394, 35, -833, 487
+not L7
+bne L75
+clr *r3
+L302: .data 17, 276, -790
+L303: .data -181, -865, 509, 451, 411, -749, 875, -946
+L304: .data 990, -530, -51, -884, 188, -726
+L305: .string "qkrjxquwqlpywkqo"
+clr L324
+cmp #248, r4
+L306: .data 146, -926
+; comment
+L307: .string "ltoospaxchhef"
+L308: .data -917, -19, 971, 907, -863
+L309: .string "ksakx"
+bne *r3
+dec L208
+bne *r7
+; comment
+L310: .string "sirkpdfzrzifwvbkf"
+L311: .data 99, 455
+L312: .string "zgmrqjdiyzvhkpeztraq"
+L313: prn #-217
+L314: .string "rycydvbtuka"
+L315: .data 109, 886, 164
+prn #-189
+L316: .string "rijkaqwgjyutihcf"
+red *r7
+prn L252
+L317: .data -823, 293
+L318: .data -593, 432, 634, 305
+rts
+L319: .data 178, -752
+sub L277, L320
+L320: .string "z"
+L321: .string "xulrquxh"
+L322: .data -410, 388, -43, 589, 138
+L323: .string "lyfrecavxjpu"
+L324: not *r5
+L325: .string "ezidtrtkxxqsqsspripvk"
+L326: .string "itmohmaktxnduij"
+bne *r4
+; comment
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 83
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+jmp *r3
+L0: .data 19
+L1: .string "xxvafjqdyx"
+L2: .string "ofhneruzyiziinm"
+L3: .string "saqemovmpqhxlw"
+L4: .data 736, -965, 642, 330, 343
+L5: .string "jqpennlettvkhqxzsaagirj"
+jmp *r1
+L6: sub #-29, *r4
+inc r0
+L7: .string "vjkaczadlcswswrxnzfoyhw"
+L8: .string "qwtnfyieojc"
+L9: .string "cplysbuzdlabhqtjiblozt"
+dec *r0
+L10: sub *r1, r6
+lea L10, L7
+red L9
+; comment
+L11: add L154, *r0
+L12: .string "kfqxdedl"
+
+; comment
+L13: .string "gzocddozhmasqmvtmlomye"
+cmp L2, *r5
+L14: .string "nnduohti"
+L15: .data 641, -759, -372, -989
+L16: .data 478, -264, -819, 407
+lea L127, L8
+prn L132
+L17: .data 669, -534, -457, 335, 624, 722, -68, 530
+; comment
+L18: .data 687, 20, -882, -76, 634, 421, -14, 444
+rts
+L19: jsr *r0
+L20: .data -957, -116, 476, 118, 211, 792, 367
+L21: rts
+L22: bne L85
+
+mov r7, *r7
+L23: .data -945, -885, 977, 416, 587, -608
+stop
+
+L24: .string "xkpqyyluazgjpnj"
+L25: bne *r4
+L26: .string "xfmgkfhhejbokfbajthyphl"
+L27: .string "jjcvnzvqqhnt"
+L28: sub *r5, r3
+
+dec L71
+jsr *r5
+bne *r7
+
+rts
+L29: .data -752, 320, 643, 803, -518, -971, -754
+inc L75
+L30: .string "kjphz"
+L31: .data -434, 896, -437, 605, 663
+L32: .string "ezzvtvo"
+L33: .string "inietawadr"
+L34: .data -607
+; comment
+L35: .data -418, 441, -499, 632, 456
+L36: add #-22, L17
+L37: .string "uizsropelij"
+L38: .string "iruvilcvpmodecmrntjljkxx"
+L39: .data 734, 478, 599, 937, 431, -232
+L40: .data 66, 178, 425
+L41: .data 619
+L42: sub #24, *r2
+L43: .string "fgrdbj"
+rts
+L44: .data 609, 929, 617, 992, 722, -195
+L45: .data -507, 227, -541, 425, 571, -968, -628
+cmp L24, #221
+
+; comment
+add r1, r7
+cmp *r7, r5
+L46: .data -83
+
+rts
+L47: mov L27, r2
+L48: .string "finslcwznk"
+L49: .data -752, 872, -398, -381, 580, 788, -837, -841
+L50: .string "lxxolblvscaduamqv"
+; comment
+L51: .data 629, -64, -397
+L52: .string "scltbkosueaqzwljbkg"
+L53: .data -224, -507
+L54: .data 266, 714, 582
+rts
+L55: .string "ewpsh"
+L56: .string "cqdegbexrjxfzycacupqunlv"
+L57: .string "gokkfcnrmzta"
+
+
+L58: .string "uwwskzejqtofioww"
+lea L60, r2
+L59: .data 401, -224
+L60: .string "tkverwlwzy"
+L61: .string "rrgtiymdgzcqqbsdidqclzs"
+L62: .string "iccmhujszvgruciwcziashda"
+L63: .data 25, 281, 113, -279, 502, -195, 664, 154
+L64: .data 154, -668, 117, -732, 630
+L65: .string "tvhcvebqsrzquizqgposgiwr"
+L66: .data 615, 150, 860, -393, -561, -579, -257
+L67: not r4
+L68: rts
+L69: .string "w"
+jsr L186
+cmp #148, r1
+mov *r6, *r5
+L70: .string "ilrsimyzrnfxgftjwkqsa"
+jmp *r0
+L71: .string "ykoemzmofhdojxogptquwfsb"
+L72: .string "gc"
+L73: .data 370, -230
+; comment
+L74: .data -427, -23
+
+L75: .data -607
+sub #230, *r2
+L76: .string "ddduqteffueulfoz"
+L77: .data -736, 560, 201, -993, -925, -276
+L78: .data -479, -990
+L79: .string "lmds"
+; comment
+dec *r2
+inc *r2
+L80: .string "tqyphcpfmoe"
+L81: .data -532, 136, -380, 328, 100, -611, 328, -651
+stop
+L82: .data -633, 32, -178, -581, -962
+L83: .data -326, 735, 480, 641, -518, -868
+L84: cmp #-196, *r3
+
+clr *r6
+L85: .string "ptb"
+lea L33, L23
+rts
+dec r4
+L86: .string "vowdkmqfcxssdxngeazhkg"
+jsr *r4
+L87: not r6
+sub #-188, L50
+L88: .string "heamsobtyrsnw"
+L89: .data -278, 987, 832, -874, 126, -809, 893, 582
+dec L1
+L90: .string "mw"
+L91: .string "wkklvammreufd"
+cmp r5, r4
+L92: .data -766, -538, 887
+
+L93: .data -352, 107, -493, -821, -164, -913, 565
+L94: .data 411, 103, 396, -486, -476
+L95: .data -878, -369, -542, -982, -856, 872, -835
+L96: .data 16, -288, -91, -707, 243, -240, 598
+L97: .data 793, -548
+prn #114
+jmp *r2
+; comment
+L98: .data -504, -189, -802, 441, 551
+L99: rts
+inc r7
+L100: .data 112, -644, -389, 422, 85, 418, 816, -947
+L101: .data -99, 623
+L102: .data 721, 295, -258, 631, -246, -747, 783
+mov #48, L296
+jsr L318
+L103: bne L266
+L104: .string "rdhjfiifjbctdfhgzyrmwbh"
+L105: .data 565
+L106: .string "yasztilffjrnsq"
+L107: .data -806, -838, 178, 599, 528, -350, -404
+dec L147
+L108: .string "cvjdjnvwwbdckpnnklutomp"
+L109: .data 344, 319, -268, 187, -976, -225, -843, 178
+L110: .string "mtrtreryzcwagdaoqunmzbup"
+dec L204
+L111: .string "urao"
+jmp *r6
+L112: bne L138
+L113: .string "mlmpyuvrufucc"
+L114: .string "bvmckrjtxbkst"
+L115: .string "fdn"
+; comment
+
+L116: .data 712, 331
+L117: .data -138, 335, -534, 698, -104, -827, 707, 210
+L118: .string "yofcvywjodvlw"
+L119: .data -137, -742
+L120: .string "dyhw"
+prn r1
+L121: .data 812, -268, -404, -853, -118, -388, -870
+L122: .string "tgksqxfvawsknwcvplcqjsrw"
+L123: .data -502, -509
+L124: .data -689, -723, 855, 713
+L125: not *r1
+L126: .data -226, 307, -937, 247, 237, 587
+dec r6
+jsr *r6
+L127: .data 434, 686, 113, 308, 478, 650, 891, 445
+L128: .string "gruqihqbrmyi"
+L129: .string "gduvzz"
+prn #-71
+L130: lea L295, *r7
+; comment
+mov L0, r4
+L131: .string "zzwmbjyvrnkwscfulgb"
+jsr L286
+L132: .string "ogfrzioaobmnstpuitw"
+rts
+L133: .string "mfsnoyymyrovpnjitxaw"
+L134: .data -861, -996, -990, 73, 446
+L135: .string "qyvfjsznsbkidlwr"
+L136: .data 38, 221, -294, 322, -387, 207, 414
+lea L210, *r6
+bne L145
+L137: .data 214, -429
+add r0, *r1
+L138: .string "i"
+L139: .data 272, 806, -391, -698, 824, 905, 703
+stop
+L140: .data -468, -371, 304
+L141: .string "itueqyymhzu"
+L142: .data 24, -403, 788, -951
+L143: .data -319, -90, -134, -777, -841, -79, -21
+L144: .data -979, -307, 850, 729, -792, 222, -519, 786
+L145: .data 264
+sub #217, L287
+L146: .string "m"
+dec *r4
+prn L309
+inc r4
+L147: .string "bzvqwljiwvmwooufoxsfd"
+inc r4
+; comment
+L148: .string "mrdxgacml"
+L149: .data -925, -900, 133, -813, 95, -544
+; comment
+; comment
+L150: .data 47, 484
+L151: red L113
+L152: .string "dqrzpnbrquxcnhly"
+dec *r4
+L153: .string "jmronkvebaginxi"
+L154: dec r0
+L155: .string "lswruvep"
+L156: .data -723, 605
+L157: .data -867, -324, -724, -572, 872, -751
+L158: .data 914, 960, -166, -42
+jsr *r1
+L159: lea L14, r0
+L160: .string "ifeyvtdyixivnygffwy"
+add L83, r0
+jsr L176
+L161: stop
+L162: sub L217, r0
+L163: .data -476
+L164: .data -59, 678
+L165: .string "tobspxbwjt"
+L166: .data 99, 674
+lea L6, r5
+bne L157
+L167: .data -161, -980, 438, 860, 384, 819, 26
+clr *r0
+L168: .string "fdtglpchrnkbxiedsnbhkug"
+bne L122
+lea L278, *r4
+L169: .data -762, -387, -67, 234
+prn *r5
+L170: .string "rdvbvviiauyl"
+L171: .string "sehjywwbddmfqorawaf"
+L172: dec r0
+L173: jsr *r2
+L174: .data 244, -407, -445, -471, 564, -992
+; comment
+L175: .string "i"
+L176: .data -347
+L177: .data 314, 571, 722, -595, -897, 168, -512, 695
+; comment
+L178: .string "bwddvnhuxbdrl"
+L179: .string "wnidtua"
+L180: .data 176, 954, -326, 239, -254, -239, -965, 719
+L181: .string "u"
+L182: .data 246, -148, 32, 776, -710, 747, -733, 425
+L183: red L219
+red L208
+L184: .string "obgxqdtceqhywkk"
+L185: .string "zsvtw"
+jmp L112
+L186: .data 710, 518, 138, -578, 385, 810, 96
+L187: .string "izjvdhiuphugnrwdmlnsj"
+L188: .string "qzi"
+add r3, r7
+L189: .string "hzqdpunxu"
+L190: .string "vobsjghrgpbilxanbmxy"
+add *r1, *r6
+cmp r0, #133
+L191: .data 351, 528, -772, 209, -793
+L192: .data -666, -485, -198, -360, 214
+jmp *r6
+L193: .data 301, -442
+L194: .data 33, -483, -917, -104, 638
+L195: .data -522, -928, 133, -449
+L196: inc L242
+L197: .string "iaqnvfelnkg"
+L198: .string "xbjpbcqewzfqmhxfgzgrkx"
+L199: .string "tvnousdvpivegwrcrxg"
+rts
+L200: .string "cipqzr"
+jsr *r2
+L201: .string "woitoutzrrqfnpupaqkop"
+L202: .string "ujumhcvx"
+L203: .string "ffbwsnwqgtokmnbqto"
+jsr *r0
+sub #149, *r0
+L204: .string "qghbgvninrkzqozzzrpzji"
+L205: .string "aqqzbcufudnlszo"
+L206: .string "hllm"
+L207: mov r6, *r7
+; comment
+L208: inc *r0
+lea L258, L233
+L209: .string "prpzmpjweavuryyqen"
+lea L281, r0
+L210: clr r4
+bne *r1
+L211: .data 379, 930, 322, -954, -776, -908, -226
+L212: .string "rligkselsuidrno"
+L213: .data 508, -665, 69, 110, 27, 382, 320
+red *r5
+L214: .string "kmdtqxaxynymxgnaaa"
+L215: .data -720, 223, -231, 286, 372, 159
+L216: .data 691, -666, 171
+L217: .string "estonbvyhmlhchx"
+L218: .data -990, 484, -373, -124
+L219: dec L253
+L220: .data -301, -472
+L221: add r0, r5
+L222: .string "k"
+L223: .data -684, 133, -791, 838
+L224: .string "wemnvlvxzxz"
+L225: .data -410, 816, 544, -363, -405
+L226: .string "trrhwulfhrdxtekyxeupao"
+L227: .data -44, -637, -694
+L228: red *r4
+L229: .data -84, 637, 971, 447, -837, 835, -168
+L230: stop
+L231: .data -305, -804, -408
+bne L266
+L232: .data 718, 930, 492, -375, 32, 742, -760
+L233: .string "xwwlhxmspcuizh"
+lea L248, r6
+lea L240, r4
+L234: stop
+L235: .string "tiktuehlgykgsusr"
+L236: inc L270
+prn L41
+L237: jmp L318
+L238: .data 723, 672
+rts
+L239: .string "grpaznscbegrnpzuzu"
+L240: .string "bivjwpevizebsi"
+; comment
+L241: .data 180, 75, -591, -55, 16, 778, -997, -559
+L242: .data 937, -490, 705, 402, -912, -690, 738
+L243: .string "bfiburqopkposfmlteynk"
+L244: .string "jnwp"
+red r5
+L245: .data -969, 978, -103, -580, 198, -904
+sub L295, *r7
+L246: .data 738
+L247: .string "ktqjbjacidkkwgoluwkhe"
+L248: .data -637
+not r2
+stop
+L249: .string "isxpild"
+L250: .string "bekcdxokxmamikhmwhlnxdxa"
+red L298
+L251: .data 925, -876, 149, -967, -112
+L252: .data -584
+L253: .string "qfrojzclbbmgequply"
+stop
+L254: .string "jllphjhebplujq"
+clr *r2
+rts
+L255: .data -657, 428, 898, -150
+mov *r3, L29
+L256: .string "m"
+L257: .data 160, -477, 819
+L258: sub #-41, L233
+L259: .data -459, -826, -280, -376, -910
+L260: .data 560
+lea L327, L81
+L261: .string "w"
+red r6
+L262: .data -346, 450, 63, -216, -925, 368, -650
+jsr *r2
+cmp r1, r1
+L263: .string "b"
+L264: .string "aexxwy"
+L265: .string "ynapotteilqsho"
+clr L293
+prn *r7
+L266: .data -975, 462, -101, 217, -736, -2, 176, 753
+L267: .data 679, 860, 686, -174, 623, 751, -703
+L268: .string "xbddspgxerxtpmuedly"
+L269: .data 801, 608, 210, -158, -155, 573
+L270: .data 86, -991, -37, -748, -129, -125, 26, -726
+not *r0
+L271: .data -677
+L272: .string "ozsgjom"
+bne L234
+rts
+
+; comment
+jsr *r3
+L273: prn L213
+stop
+L274: .data -13, 719, 954, 637
+L275: .string "mztthpxeo"
+L276: .data -5, 787
+L277: .string "hdwxinrtft"
+
+
+clr r5
+L278: .string "mcfsj"
+red L299
+add r0, L284
+L279: sub L277, L310
+L280: .string "bjcgczfyrqorqykfuhf"
+L281: .string "zuodzrxqvvkauarlnejgra"
+clr L309
+; comment
+L282: .data 401, 975
+L283: .string "neqdlzbwzcympr"
+L284: .string "ivzlgnjbngdhdlnmves"
+lea L25, *r7
+L285: .data 356, 752, 341, -611, 353, 805, -908
+L286: .string "satufasjaeiwxpvneyugg"
+L287: .string "biidknveaczbfsamru"
+L288: .string "rgb"
+sub r0, L49
+L289: .data 683, -454, -251, -919, -631, 527
+L290: .data 138, 991, -85, 164, 426
+L291: lea L308, *r7
+L292: .data 301, -702, -223, -69, -558
+L293: .string "gyufwn"
+inc *r0
+L294: bne *r2
+
+L295: dec r6
+L296: .data -50, 794, 391, -371, 243
+L297: bne L204
+L298: .data -691, 652, 147, -423, -220, 927
+inc r5
+L299: .data 292, -163, -783
+jsr L121
+L300: .data 253, -354, -71, -151, -967, 550, 305
+L301: .string "pjtwjswc"
+red L204
+inc L322
+L302: .string "ex"
+L303: .data 459, -571, 175, -311, 774, -722
+L304: .data -473, -501, -880, -19, 46, 235, 152
+L305: .string "punbxteqj"
+L306: .string "pppsdgmglisvkrwpunaqaekf"
+L307: .data -80, 44, -311
+add L323, *r1
+red L315
+L308: .data 475
+L309: .string "slxken"
+L310: mov r6, L328
+L311: .string "syklzpitfwo"
+L312: .data -846
+L313: add *r7, *r0
+L314: .data -246
+L315: .data 56, -906, -159, 336, -458, 209
+L316: .data 429, 85, -584, 310, -603
+L317: .string "wcxelcfogjgudkktcga"
+L318: .data 514, -103, 804, -698
+L319: .string "waohopeosmwzs"
+prn L96
+L320: inc r0
+L321: .string "ocpdaxtnjyhrgxjsgpgyam"
+mov L329, L303
+L322: .string "yzupgrhdgizfdhy"
+lea L328, *r0
+L323: .string "upyryxu"
+dec L173
+L324: .data -380, -29
+add #-82, L293
+L325: .string "mulomxrrzxjhagxsanyhmu"
+L326: .data 834, 629, 838, -958, -311, -371, 752
+L327: .string "txkjpa"
+L328: .string "dryfnyxrjzulccckwvuukwe"
+L329: .string "cpktyemk"
+L330: .string "gunvyiim"
+L331: .data 684, 294, -836, 36, 299, 725
+stop
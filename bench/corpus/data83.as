@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 84
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+inc L226
+inc L123
+L0: .data 511, -327, -897, -761, 291
+L1: .data 791, 315, -767
+inc L0
+jsr L1
+not r5
+
+L2: .string "styqpohujxfllg"
+L3: .string "bsm"
+jsr L2
+L4: .string "ueeeyzyvoolwhdmvvh"
+L5: .data -23, -982, -382, -846, 688, -529
+L6: bne *r2
+jsr L96
+L7: .data -708, 981, -338
+L8: .string "kqyvst"
+L9: .string "cyjicobsbksznznc"
+L10: .data -844, 19, -139, -395, -800, 660, -204, 469
+; comment
+L11: .data 262, 410, 745, -38, 773, 827, 512, -508
+prn *r5
+L12: .data 396
+L13: .data -712, -118, 849, -426, -592, -478
+prn *r6
+mov #118, r2
+L14: .string "xvl"
+L15: .string "wtkdhoiegzlzvq"
+L16: .string "inkatsmxowsy"
+L17: .string "fcvoyyzwyawv"
+L18: .string "egfdeiuvvyb"
+; comment
+L19: .string "avjrcnk"
+L20: .string "xqkji"
+L21: .string "fuugmvmk"
+stop
+L22: .data 607, -221, -835, -533, 900, -121, -495, 437
+inc L36
+cmp *r0, *r7
+add *r2, L13
+clr L20
+
+bne *r3
+L23: .string "uyouqu"
+sub r5, L8
+L24: .string "wwmbmyqlnqyhahllqa"
+L25: .data -806, -321, 164, 786
+bne *r5
+L26: .data -745, 575, -432, 961, 531
+add r7, r3
+L27: .data 240, -941, 20, -14, 338
+clr *r0
+L28: .string "udbznevklxigrhzalssid"
+; comment
+; comment
+L29: .data -47, -588
+
+rts
+jmp L20
+L30: .data 693, 218, 420, 658, -815, -172, -208
+; comment
+L31: .string "vkvx"
+L32: sub L13, *r0
+add L30, r3
+stop
+
+L33: .data 772, -393, -298
+L34: .data -191, 435, -448, 387, -840, 751
+jsr L128
+add #225, *r6
+L35: .data -790, 917, -709, 118, 749, -905, 786, 684
+red *r7
+dec *r4
+L36: .string "vsibvx"
+add #-119, r4
+L37: .data -533, -939, -739, -922, 411
+L38: .string "mwdoybgbbufyr"
+dec L289
+L39: mov L35, L25
+sub r0, r6
+L40: .data -300, -227, -420, -162, 492, 611, 327
+L41: .data -306, 813, 562
+L42: .data -260, 430, 526
+cmp *r5, #-201
+L43: .data -529, 289, -480
+L44: .data 557, 295, 417, 958
+L45: inc L200
+inc *r2
+L46: .data 539, 44, -829, -77, -555, 532
+L47: .data -331, -67, 188, -766, 120
+L48: .string "mfgicylsrxagesupbh"
+; comment
+L49: cmp r1, r2
+L50: .data -290, 770, -667, -902, -929, 734
+L51: .string "npwaxpnorg"
+L52: .data 58, -311
+L53: .string "fwavjwmihbjshvweal"
+cmp #-65, #134
+L54: .string "psgvbaujtxqhenznmms"
+L55: .string "upivkqmmixbethpnqrgdck"
+L56: .string "jovdnlotda"
+L57: jsr L223
+rts
+L58: .string "sdecvruymwdyjhwibrpw"
+prn #44
+prn r1
+L59: .data -302, 546, 901, -582, -418, -600
+prn *r0
+red L69
+L60: .data 571, -180, -637, -764, 50
+prn *r3
+L61: prn L58
+sub L195, L164
+
+inc r1
+L62: .data -659, 407, 351, -334, 71
+L63: .string "eyi"
+L64: sub L143, *r5
+L65: .string "qjcutwh"
+mov *r6, *r6
+L66: .data -141, -527, 602
+L67: .string "rv"
+L68: .data -775, -860, -711
+jsr *r6
+L69: .data -853, 392, -399, -999, 343, -319, -590, -538
+prn #70
+L70: .string "xqnfdtnjmvsixdv"
+L71: .string "bciaufkqzlnxprtiswpipgsm"
+L72: clr L255
+lea L66, *r5
+L73: .string "rfbojnfx"
+inc *r2
+L74: inc *r2
+L75: .data -533, 526, 617, -603, 336, 842, 577, -164
+L76: .data 318, 141, -818, -971, -450, -420, -40, -659
+L77: .string "aesutqkvdatbdf"
+L78: .string "z"
+L79: cmp L48, L58
+L80: .string "zuulhtmnvnbl"
+inc *r4
+L81: .data -911, -8, -891, 658, -152, 471, -68, 546
+L82: .string "odwvtvmwvsbnwbqxd"
+L83: .string "uormugkrjebyflmetbpejqbl"
+L84: .string "iiuvcnvujd"
+L85: .string "diqeuqnbdmuxvpapaigypevb"
+L86: .data -565, -831, 470, -955, -143, -634, 884, -962
+L87: .data 218, 358, 530, 714, 427, -710, 318
+L88: .data 1, 932, 360, -508, -639, 137
+L89: .string "vuujhcfnuomleu"
+add #-54, *r6
+L90: jmp L117
+; comment
+inc L160
+L91: .data -350
+L92: .data -24
+L93: .string "nhvppystfqlj"
+L94: .string "bovjecfprx"
+L95: .data -764, -258, 229, 235, -672
+L96: jsr *r1
+L97: .string "gfxmr"
+L98: .data 59, -81, 735, 443, 883, -400
+L99: .string "mxvgezm"
+dec *r1
+L100: .data -387
+L101: .string "qm"
+dec L73
+L102: .data -412, 522, -136
+L103: .data 369, -111, 706, -320, 689, 261, 628
+rts
+L104: .string "ranvsluaeefdcrruizea"
+red *r5
+L105: .string "oiazilukdezeeopptzhctax"
+L106: .data -269, 800, 653, 278, 705, -261
+jmp *r0
+L107: .data -589, -210, -707, -897, 655
+L108: .string "bwwchpcnuucolvy"
+L109: .string "yycemepfgbwtemerhddke"
+L110: .data 309, 948, -782, 595, -264, -621, 764, 851
+L111: .data -249, 183, -675, 671, 568, -132
+L112: .string "fijmrnbmas"
+L113: .string "kqpgzha"
+L114: .string "dkybyngruktfyqltiudcz"
+L115: .data -836, 897
+jsr *r2
+L116: .data -945, 368, 1, 918, -689, -445, 209, -376
+; comment
+L117: .data -356, -381, 151, -401, -812, 636, -498, -512
+L118: .string "uibwjdlodfangocdwb"
+bne *r6
+jmp L85
+jsr L226
+mov *r3, *r5
+L119: .data 226, -626
+inc *r1
+L120: .string "dadcycsi"
+mov L211, *r5
+L121: .data -844
+L122: .string "zqcsigsstzvrkecjifcb"
+red *r0
+cmp *r4, #-17
+not *r3
+L123: .string "tlvgydwbmyhr"
+red *r0
+L124: .data 399, 393, 878, -610, -643, 505
+prn *r2
+L125: .string "gp"
+red *r7
+L126: .string "h"
+L127: .string "fytywzrrymdurov"
+L128: .data 886, 37, -307
+L129: .string "vhfic"
+inc r7
+bne *r6
+L130: .data -798, 56
+cmp #-36, L203
+cmp r1, *r7
+L131: .string "okg"
+clr *r3
+L132: .string "i"
+L133: .data -886, 723
+L134: .string "axteegfgpwcpwpjf"
+L135: .data -719, 970
+L136: .data -470, -709, 688, 280
+lea L293, L185
+
+L137: .data -34
+red r3
+mov r0, *r4
+dec r7
+L138: .data -585, 527, 373
+L139: cmp #-230, *r1
+L140: .string "nlneyx"
+L141: .string "ssqchrxmouqibbjufam"
+L142: .data -634, -982, 393, 343, -684, -742, 685
+; comment
+clr r0
+L143: .data 458, 317, 980, -794, 753, -876
+L144: .string "ruradbml"
+L145: .data -834, 388, -200, -378, -625
+L146: .string "pwspjconaugjedngdisvoq"
+L147: .data -198
+L148: .string "aapc"
+L149: .string "ysytsqmtsfyqfg"
+L150: .string "iimbdvagvrvwjytmcjfowgts"
+L151: .data -611, 367, 479, -865, 869, -622, -378
+L152: .data 866, 828
+L153: .data -814, 104, 135, 279, 449, 915, -518, -433
+L154: .string "icu"
+L155: .string "nkvrxqltykdr"
+L156: red L319
+sub #78, r1
+L157: .data 417, 379, -95
+L158: .string "mrnbz"
+L159: .string "irrybijmrvyibo"
+L160: .data -943, 30, -747
+L161: .data -297, 24, -923, -727, 416, -428
+dec *r3
+L162: .string "thcxrzoagtykgh"
+L163: .string "pkzqxdjpxiwxusf"
+L164: .string "clorfjupacpbss"
+L165: .string "kfdhkbltikv"
+L166: .data -75, 623, -173, 370, 349
+bne L29
+L167: prn r2
+not L22
+L168: lea L43, r5
+L169: .string "nkwxccnpzf"
+L170: .string "dohgstwwvzjoqzihtlxtrfqz"
+not L187
+not r3
+L171: .data 683
+add #-163, r3
+L172: .data 732, 99, -440, -310, -893, 851, -704, -159
+not *r5
+L173: .string "vut"
+
+L174: .string "xbyjnjtsb"
+L175: .data -384
+L176: .data 649, 180, 610, 630, -386, -830, 113, -132
+mov *r4, *r1
+red r1
+L177: .string "vugvtrjewzxpax"
+L178: .string "qfwyxnwxyx"
+L179: .data -670
+L180: .string "rjadeuufskhwar"
+L181: .string "twpilrywdtiplffq"
+; comment
+L182: .string "rqqcodzknlfqxfgymmaezein"
+L183: .data 520, -899, -357, -152, 130, -443, -944
+L184: .data -734, -103, -469, 97, -713, -458, -144, 750
+jsr *r5
+jsr L277
+L185: .string "luchtxcxkntomfopqdldn"
+L186: rts
+
+jmp L130
+L187: .data -542, -338, 520, 613, 781, 231
+L188: .data -187, 54, 695, -627, 494, 460
+L189: .data -478
+L190: .data -582, -923, -468, -80, -360, 595, 256
+L191: .string "uoojtriqpqp"
+; comment
+L192: mov L315, r3
+L193: .string "nrpbfevkipzzzcfrl"
+inc *r2
+jsr L97
+L194: .string "wridzqjngsbksqhqz"
+lea L284, *r2
+L195: bne L319
+L196: .data 229, -911
+add #-78, *r3
+L197: .string "uusdntuofvrn"
+mov r0, r6
+clr r5
+add L113, L55
+L198: .data 298, -49, 470, 20, 622
+L199: .data 936
+jmp L178
+L200: .data 285, 945, 527
+L201: .string "nxybczeqhwnw"
+
+stop
+L202: .data 574, 363, 566, -960, -916, 979
+L203: .string "knwcctqbyxnuymnwoxss"
+stop
+L204: red r3
+stop
+L205: .data -584, -844, -665
+L206: .string "nqlfwdnpkvevdzcldyylwu"
+bne L293
+L207: .data 338, -287, -939, 823
+L208: .data 424, 487, 549
+L209: .data -800, 520, 584, 385, 301, -109, 626
+L210: .data -63, -892, 809
+L211: .data -33, 357, -990, -114, 195, -891, -45
+prn #141
+L212: .string "ri"
+L213: .string "lhyskvzgjrxxhxeki"
+L214: .data 28, 765, 5, -71, -950, 712
+prn #-194
+cmp *r4, L150
+L215: .data -443
+L216: rts
+L217: .string "hzn"
+L218: not *r7
+rts
+cmp #-11, *r4
+L219: .data -453, -33, -749, -1, 832, -209
+L220: .string "gkysgeukwiu"
+L221: .data 500, 822, -35, 605, -401
+dec r0
+L222: sub L35, r5
+L223: .string "vlktg"
+rts
+L224: .string "qnfgmcoagnqekpho"
+prn L68
+L225: .string "nhqjvlaaxdneypycjwnf"
+L226: .data 418, 973, 997
+lea L75, *r7
+L227: .data 778, -537, -146, -647, 118, -237
+jmp L226
+L228: .data 422, 656, -273, 384
+L229: .data -871, -286, -622, -585
+red *r5
+L230: .string "sqhoyluxqd"
+; comment
+L231: .data 667, 988, 53, -422
+L232: .string "kwhbrvresb"
+L233: .string "jzokoa"
+L234: .string "lbtizcwctiqqw"
+L235: .data -349, 991, 895, -499
+L236: .string "rybxffuuj"
+stop
+L237: .string "cpjekq"
+L238: not L233
+L239: .string "ebkmtqgcsz"
+lea L130, *r7
+L240: .string "qkehjofhorlryoysxfhzrg"
+L241: .string "juhkq"
+L242: .data -862, -522, 272
+L243: .data -641, 719, -2, -56, -771, -583, -699
+sub r2, L174
+L244: .data -141, -83, -714
+L245: .string "feejapewhrfwltzg"
+L246: .data 759, 85, 455, 451
+cmp *r6, r7
+L247: .data 695, 227, 413
+L248: .data -76, -16, 631
+L249: .data 725, -589, 441, -544, -961, -955, 227, 828
+L250: .string "c"
+L251: .data -544, -171, -358, -393, -451, -39, -192, 974
+jsr *r5
+L252: .data -680, -323, -418, 66, 758, -544, -426, -439
+jmp L275
+L253: .string "cpfvvyavdzoinnrnquwn"
+rts
+jmp *r5
+clr L319
+L254: lea L263, r4
+L255: .string "dzcwpvqctepcje"
+dec *r2
+not L197
+L256: .string "opovrtdeugpqfhw"
+L257: .data 959, 669, 583, 344, 101, -807, 589
+L258: .data -320, 356, -937, -721
+L259: jmp *r2
+stop
+stop
+; comment
+L260: .string "psebiwtskrqlceiuoruejcy"
+L261: .data -934, 518, 258
+stop
+lea L63, r2
+; comment
+L262: .string "xtjacklkydltpdikxshhxphj"
+stop
+L263: .data 205, 307, 462, -110, 448, 831, 588
+mov *r2, L297
+L264: .data 248, 490, -235, -778, 888, -171, -106
+L265: .data 882, -641, 606
+L266: .string "eohnt"
+L267: .string "khozmjhwpze"
+add L309, r2
+L268: .string "faiabexhtflgiuopw"
+L269: .data -102, -640, 956, -850, 79, 16, -586
+L270: .data 543, 477, 922, -142, -257, -547, -939, -607
+L271: clr L117
+L272: .string "ukavfpvljuxsy"
+L273: .string "mbfcptdmkmzepbuphq"
+L274: .string "crpvq"
+L275: .data -668, 312, 588, -57, -304, 679, 676, 367
+bne L278
+sub L125, L255
+L276: .data -628, -286
+L277: .string "kvvc"
+not L301
+L278: .data -438, 312, -639, -152, -184
+jsr *r2
+L279: .string "gc"
+L280: .string "e"
+cmp r5, r3
+L281: .string "uaqinujtaoiy"
+L282: .string "hiksk"
+not r1
+L283: .data 653, -718, -168, 245, 984
+L284: .data 344, -407, -673, -144, -767, -876, -371, -744
+stop
+L285: .data 526, -639, 482
+L286: .string "vnzttmpueokqehqgvhdfawws"
+L287: .data 547, -344, -647, 151, 575, 480, 531, -580
+mov #82, *r2
+L288: .data -902, 331, 903, 127, -977, -143
+L289: .string "pnidluwihrtpfajmfktvfu"
+L290: .string "l"
+; comment
+not L186
+jsr *r0
+L291: .data 757
+L292: .data 234, 791, 316, 688, -971, -907
+L293: .data 649, -712, 245, -894, 703
+sub L52, L310
+L294: .data 6, -676, 646, -347, -95, -426
+L295: .string "rsybnzdbm"
+L296: .string "wkjnpgnztfufqscu"
+L297: .data 16, 178
+stop
+L298: .data -210, 882, -46, -535
+
+L299: .string "vrzhauficuopfx"
+L300: .data -906, -948, 450, 27, 879
+L301: .string "nfmwcrvidgssohwwwmorl"
+L302: .data 724, 296, 586
+L303: .string "hoblm"
+stop
+L304: .string "qsnxbtcbqb"
+L305: .data -237, -637, 252, 655, -150, -802, -2
+L306: .string "uiwcnmusagkdvsoldqznsrnj"
+clr *r2
+L307: .data -971, -812, 136, -436
+L308: .data -670, 864, -342, -712, 664
+; comment
+add #174, L315
+L309: .string "juqwexdsenrvknvweltf"
+L310: .string "yulhrsruoriwindnfydrmoye"
+L311: .data -933, -67, -324, 317, -568
+; comment
+dec *r1
+L312: .data 859
+L313: .data 852
+mov #-224, r2
+bne L116
+prn L318
+clr L317
+L314: .string "uwtfwzsrjdbfjw"
+L315: .string "c"
+L316: not r2
+bne *r5
+L317: .string "s"
+L318: jmp L255
+L319: .string "ngdxfldtwuxfluygx"
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 85
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+; comment
+L0: .data -510, 234, -717, 922, -932, 197, 298, -640
+dec r2
+L1: .string "zdu"
+L2: .data 875, -275
+dec r5
+L3: cmp L0, *r2
+L4: .string "dxdzslbfwesyeskrrs"
+L5: .string "fwbivmwfiopz"
+inc *r7
+L6: .data -935, 205, 677, 98, 566, 284
+L7: .data 312, 179, -507, 538, 398, 882
+jmp *r5
+sub *r4, r4
+L8: not L4
+L9: .data -235, 663, 56, -805
+prn #250
+L10: .data -771, 350
+red r6
+L11: .data -714, -97, -932
+L12: .data 90, 361, -882, 854, -834, -309, -262, 636
+sub L161, L132
+L13: .data 388, -219, 135, -404, 760, 524, -275
+inc L234
+L14: .string "cfbqhkhi"
+jsr *r3
+L15: jmp L10
+L16: .data -8, 731, -603, 713, 465, 83
+L17: .data -53, -502, -469, 417
+L18: rts
+L19: .string "zzqspkzujhznnvjlnw"
+clr L231
+L20: prn r7
+mov *r2, *r1
+L21: .string "hyzjjfhavbfpzycveovjdm"
+bne L2
+L22: .data 124, 53, 393, 460
+L23: .string "llsxgyujvkmqstdvuirj"
+L24: .string "aylegnykuffzcjrq"
+sub r7, L4
+L25: .string "yzcbburjbcxupoxmnbxbszr"
+L26: .data 546, 3, 978, 858, 312
+L27: .string "kwvhlvbvksgltgk"
+L28: .string "ioseypvbapmrua"
+; comment
+dec r3
+red L237
+L29: .string "ptrqbue"
+L30: .data 876, 304, 848, 875, 493
+L31: .string "etthqrfityxloojqkaxwpq"
+L32: .string "giohmuzmc"
+L33: .string "p"
+L34: .data 789, -275, -403, -605, -825
+L35: .string "ibcqufpkehef"
+L36: .data -899
+; comment
+L37: .string "sjzc"
+lea L199, L247
+L38: prn #-114
+L39: .data 131, 173, 833
+mov r1, *r6
+L40: .data 257, 178, -332, -480
+jmp L105
+inc r1
+red *r2
+L41: .string "yynmtdod"
+L42: .string "gbqqycrvlth"
+L43: .string "wlvabvgcn"
+L44: .data -721, 93, -916, 960, -109
+stop
+mov *r7, L263
+L45: .string "py"
+clr *r7
+
+L46: inc r4
+L47: .string "vgjfkrzkurmewg"
+L48: .string "v"
+L49: .data 969, 912, -58, -222, 695, -883
+lea L243, r4
+mov *r5, r3
+L50: .data 971, -345, 624, 314, -603, 482
+L51: .data 660, 306, -830, 532, 459, -302, 887, 92
+L52: .data -401, 30, 593, 626, 580
+L53: sub *r6, r7
+L54: .string "ggpeyslgki"
+prn #181
+L55: .data 725, 662, -545
+L56: .data 408, 506, 579, 245, -986, 657, 381
+L57: .data 350, -270, 644, 936, 343, 432, 709, -47
+L58: .string "gtuxuxjymbciyw"
+bne *r3
+inc *r3
+L59: stop
+bne L278
+stop
+dec r5
+L60: .data 265, -359
+rts
+L61: .string "avbwmpsuxjd"
+L62: .string "pblbxceebcwx"
+L63: mov *r5, r2
+; comment
+lea L36, L0
+jmp *r4
+L64: .data -186, -650
+; comment
+add L59, L71
+mov r4, L52
+
+L65: cmp #228, r0
+L66: .string "w"
+L67: .data -14, 212, -396, -517, -163
+L68: .string "cvwiyowcezk"
+; comment
+L69: .data -170, -923, 499, 288, 126, 316
+L70: .string "lfkmqh"
+L71: .string "lhiistiwxukydzycdmnkbif"
+L72: .string "ecidezolve"
+sub *r4, r7
+L73: .string "osz"
+L74: .string "pzvprrtkaiawnjyabxseoh"
+L75: .string "h"
+L76: .string "lrcbpmkpwcqoufydltdtq"
+bne *r2
+L77: .data -583, -84, -452, -64, 141, -773, 317
+L78: .data 684, -265, 669, -886, -661
+inc L224
+L79: .string "pjhwiwecjopklqaa"
+L80: .string "rveueclumnejtwlmn"
+jsr L53
+L81: .string "ponmze"
+
+jmp L42
+bne L253
+dec r0
+L82: prn *r1
+L83: .string "fmjhyafdrxob"
+L84: .data 19, 557, 212, 813, 648
+L85: .string "aeitehzjhuvddprrnqhlzlmq"
+bne *r6
+L86: .data 28
+L87: .string "dmmncw"
+prn r7
+L88: .string "icvzznxeopo"
+L89: .data -686, -386, -665, -523, -49, 405
+L90: .data -826, -230
+L91: .string "eqvkwdnykbaikt"
+jsr *r1
+L92: .data 683
+L93: .data 710
+L94: .data -203, 498, -126, 691, -13, -208
+L95: .data -183, 494, -519, 992, -697, 566, -975
+jsr *r5
+L96: .data 217, 160, -739, 308, -118, -719, -569, 954
+L97: .data 147
+lea L218, L133
+rts
+stop
+L98: .data 68, 78, 305, 491
+prn L101
+L99: .string "lollibi"
+prn #-154
+L100: .string "yrparaxnqtqgrc"
+L101: .string "sfnsjfbssoaeqcbn"
+L102: .data 59, 69, 72, -765, 473, 985, -469, -236
+not *r0
+L103: .string "wdmssfuvj"
+L104: .data -953, -45, -368, -199, 872, -368, -642, 443
+L105: .string "bbhqjfpocorxvwzowpyt"
+L106: .string "qqpnyxwccek"
+L107: .string "gvfqnoutaydbbwqv"
+; comment
+dec r6
+not L305
+L108: .data -431, -709, 922, -381, -406
+L109: .string "qxgnfvjgnu"
+; comment
+L110: lea L128, *r6
+L111: .data 545, -549, -746, -383
+L112: .data 414, -945
+L113: .string "odojccbxrtgkkqjhznplymjh"
+L114: .string "jqomxlfjofedoyxdmgaw"
+L115: .string "yrwlzun"
+L116: .data -441, -335, -420
+L117: .data 173
+mov L4, L257
+L118: .string "ym"
+L119: .data 845
+L120: rts
+clr *r0
+L121: jmp *r0
+L122: .data 828, -643
+L123: .data -4, -465
+mov *r1, L14
+cmp L236, L59
+L124: .data 602, 866, 110
+L125: .data 371, -681, 968, -397, 870, -397, 262
+L126: .data -592, -448, -106, -150, -7, 101, -715
+L127: .string "uvvaai"
+L128: .data 513, 56, -589, -288, 459, -424, -112
+L129: .data 295, 906, -177, 349
+sub *r4, L313
+L130: .data 668, 500, -810, 512, 602, 557
+cmp r2, *r0
+L131: .string "bancqjdosapj"
+L132: .data 884
+inc r7
+L133: .data 970, 869, -956, -254, 156, -142, 167
+L134: .data 567, 724
+L135: .string "pjctvto"
+L136: .data -729, -414, 469, -616, -667, 834, 490, -231
+L137: .string "cncylfemagyni"
+L138: .data -774, -852, 450, 789
+L139: .string "lgjqexxnuqhd"
+L140: .data 276, 631, 101, -929
+L141: .string "tocztmxfqvyroqttnbiahk"
+red L259
+L142: .string "igtdrxbwgixxa"
+L143: .string "lq"
+L144: .data -56
+L145: .data 935, -175
+not r5
+L146: .data -250, 160
+L147: .string "jolptikp"
+mov r6, *r1
+not r6
+L148: jmp *r7
+L149: .string "bwcxynzggqspebmhhi"
+bne *r7
+L150: .data 956, -578, -905, 251, 102, -214, -468, 909
+L151: .string "btvqpd"
+
+L152: .string "cesxxqyeaencndughkglvv"
+L153: .data 523, 181, -591, -204, 20, -478, 914
+clr *r2
+L154: .string "ykobnesdjooktknldhhwyxx"
+L155: .data 406, 193, -164, 587
+L156: .data 571
+jmp L200
+L157: .string "d"
+L158: red *r6
+L159: .data 33, 285, 27, -40, 156, 784, -27
+rts
+L160: .data -247, -554, -354, -490
+L161: jmp *r3
+L162: mov L319, *r5
+bne L67
+L163: .string "taeksclfgdddzqjvibu"
+L164: .string "sgurqkxlsrxbmdjccy"
+L165: .data 526, -58, 335, -771, -424, 989, -280
+mov r0, r1
+L166: .data -783, -130, -355, 789
+L167: .string "fxinxhhcrdanebvchflbusle"
+stop
+L168: .string "wzwxtnnyogwgh"
+L169: .string "icdk"
+inc L139
+clr r1
+lea L214, L221
+rts
+L170: .data 816, 817, -412, 345, -519, -387, 255, -311
+clr r6
+L171: .data 873, -125
+L172: .data -703, 922, -654, 846, 245
+cmp r3, *r1
+inc *r3
+add *r3, *r1
+L173: lea L29, *r7
+L174: .data 43
+L175: .data 756, 629, -456, 556, -48, 942, -606
+L176: .data -103, 34, -419, 584
+L177: .data 576, 505, 949, 515, -899, -246, 282
+L178: .string "i"
+L179: .data -927, -962, -351, -742
+L180: .string "bdl"
+L181: .data 762, 577, 963, 989, 456, -692, 931, -935
+L182: .string "ssbzciptfhtr"
+bne *r3
+L183: red r4
+sub L239, L103
+L184: .string "jlrrov"
+inc r7
+L185: .data 962
+L186: .data -952, -738, -473, -52, 545, 24, 426, -771
+L187: .data -384, -302, -549
+L188: .string "iusldezd"
+L189: .data 170, -899, 272, -742, -161
+L190: lea L246, r2
+L191: .data 415, -132, -234
+L192: jsr L122
+L193: cmp r6, L322
+mov *r6, L68
+dec L8
+L194: .string "awlyw"
+prn r2
+red r5
+L195: .data -814, -53, -236, -658, -478
+L196: .string "qbtfpofhnhnworyyhy"
+L197: .string "qzrslgbeitr"
+L198: .string "ynpedi"
+L199: .string "fnanlcb"
+prn r7
+inc *r6
+clr L15
+
+L200: .string "w"
+not L2
+cmp *r5, r7
+cmp L57, r0
+L201: .string "mmhrvtg"
+L202: .string "ptzxcaebafhfy"
+add *r3, r2
+L203: .string "p"
+cmp L303, L285
+L204: .string "ljvzjdge"
+L205: .string "velsbgqoz"
+L206: .data 938, 458, -979, 575, -266, 563, 788, 154
+L207: .data -331, -757
+L208: .string "qkxvudcucqsqgbnc"
+L209: mov L212, r4
+L210: .data 388, 704, -730, -459
+L211: .data -43, 419, 548, 807, 203, 591
+sub r2, L199
+; comment
+L212: prn *r2
+L213: .data 922, 193, 611
+mov #125, r1
+L214: .data 459, -870, 137, -421
+L215: .string "pkhoihdhqq"
+L216: sub *r7, L233
+L217: .data 688, 338, 398
+L218: .data 101, 814, 409, 256, 833, -109, -638
+L219: .data -144, 627
+L220: .data -338, 976, -902, -327
+L221: .string "iyukzfukugk"
+L222: .data 166, 583, 258, 930, -282
+L223: .data -45, -543, -664, -981
+dec L56
+mov *r7, L39
+lea L68, L119
+L224: .data -871, 828, -231
+L225: .string "nvgrvpbgfsxrl"
+jmp *r5
+L226: .data 352, -129, -871, -677, -451
+L227: .data 925, -804, -850, -364, -315
+L228: .data 629, 157, 280, -11, 687
+L229: .string "cbestjf"
+L230: .string "aefmhqrwwt"
+jsr *r6
+L231: .data 381, -74, 147, 2
+sub L314, L309
+L232: .data -659, -794, -26, -101, 909
+L233: .string "zev"
+L234: .string "rvidwytqcovikwzwiommykmf"
+L235: .data 671, 402, 366, 18, -560, -914, -857, 432
+jsr L90
+L236: .data 184, -140, -236, 671, -666
+L237: .string "zpnwruvod"
+L238: .string "ultuvdrwvywb"
+L239: .string "h"
+L240: .string "njdfacm"
+L241: .data 123, 268, 99, -302, 85
+L242: .string "mmdtaxalkzkvlih"
+L243: .data 908, 691, 211, 788
+lea L188, *r0
+L244: .string "yqfbhldhdlkic"
+cmp r7, L139
+L245: .string "xyychlonmpfppqcntlbolwv"
+
+inc *r2
+jmp *r2
+L246: .string "idnnccmxzedu"
+clr L102
+; comment
+add #-54, L247
+L247: .string "fywhackhhcwxehoegvcivd"
+L248: .data -408, 389, -255, 176, -536
+
+L249: .string "cnngfusrfcvlfo"
+inc L25
+L250: .string "kxmfvhatjorafxdcp"
+L251: sub r7, r7
+L252: .string "lemgfjpjenxeaiu"
+L253: .string "leabafqapilzs"
+L254: .string "orbcuwnxpboawxbiiiglgkov"
+L255: rts
+cmp *r3, *r2
+L256: .string "wjseauycvrcuxf"
+add r5, L269
+L257: .string "nkmjttlpkqjpsgmvikrgbd"
+L258: .string "s"
+L259: .string "bqdckuhktampytds"
+L260: .string "fudmtvu"
+L261: .data -740, 721, 457, 646, -991, 61, -150
+L262: .data -21, 276, -442, 417, 673, 728, -561
+L263: .data -476
+L264: .string "sjoct"
+prn *r2
+clr L10
+jmp *r3
+L265: .data 263, 743, -829, -200, -169, -596, -757, 856
+L266: .string "vnfrxeioaisjwsvrkpgtfik"
+jsr L323
+
+L267: add r1, *r6
+L268: .data 900, 918, -560
+add r5, *r4
+L269: .data -758, 362, 399, -76, -852, 531, -420
+L270: .data 474, -805, -624, -585, 986, -23
+sub L319, *r6
+L271: .string "uyptaicwra"
+L272: .data -231, 287, 384
+L273: .string "dmzbenncadeo"
+
+L274: .data -68, -273, 308, 180
+L275: .string "lccppymuzuaevciu"
+jsr L322
+inc *r1
+; comment
+prn *r0
+L276: .data -522, -161, 488, -182, -229, -5
+L277: .string "fmrhhgnqofu"
+L278: .string "rfhbrqbvrgbcckjehy"
+L279: .data -389, -320, -143, 121, 259, 201
+add L146, L299
+L280: .string "rxxebxpkzmuqtlmqlljc"
+mov *r5, r2
+rts
+L281: .data 225, -466, 245
+L282: .data -626, -205, -862, 18, -286, 802, -364
+L283: .string "sykuhgndnyyacvktexroenwg"
+not L297
+jmp L286
+L284: .data 923, 979, 838, -609, -723
+bne *r7
+clr r6
+L285: .string "tmsyxtbhjayyxdpuiqoeyllo"
+L286: .string "qbyzsdydzj"
+sub *r1, L7
+L287: .data -836, 702
+L288: .string "vrdrudmfpoesqnbtbjxuk"
+mov *r7, r3
+L289: .string "hkstvxvvtxy"
+L290: .string "tlrauilgqbsomfkdrfjcm"
+L291: .string "wdvvgmjpcd"
+L292: .string "kgcarljbcuvd"
+sub r0, r4
+L293: .data 513, 347, 278
+L294: inc L311
+L295: .data 176, 780, -717, 325, -99, -39
+L296: .data 708
+lea L308, *r1
+red *r7
+L297: .data -751, -789, 728, 363, 981
+dec *r3
+L298: .data -901
+
+L299: .data 153, -437, 78
+inc *r3
+clr r5
+prn *r1
+L300: .string "shpbotlwxfpvi"
+jsr L233
+L301: .string "gwixu"
+L302: .string "os"
+sub #53, r6
+sub *r4, r7
+jmp *r2
+not L324
+L303: .data -950, -465, -70, 206
+L304: cmp L144, *r1
+L305: .string "dffuguubyygchcvyjo"
+L306: .string "nxehoalbnznsqrepcvgi"
+L307: .data -12, -75
+lea L319, L265
+L308: .data 661
+L309: .string "ndtftbhvntkqexboxc"
+lea L133, r5
+L310: .string "puddkpgwdodibbxnkxilhor"
+L311: .data 818, 576, 718, -968, -148, 83, -817, -4
+L312: .data 220, 607, 650, 84, -511, 170, -695
+
+L313: .data -208, 410, 777
+L314: .data -222, 294, 553, -37, 784, -844, 4, -391
+L315: .string "clmotpmciumyztyjy"
+L316: .data -549, 403, -908, 886, 77, 228, -921
+L317: .string "rvncrwhphs"
+
+L318: .data 405
+L319: .data 664, -867, 815, 355
+cmp L324, #227
+L320: .data 832
+L321: .data 439, -180, -652, -418, 889, -394, -146
+stop
+L322: .data 174, -24, 700, -490, -349, 412
+; comment
+; comment
+lea L323, L7
+L323: .string "ftlaptigwbjsuynzqz"
+L324: .data -16, 6, 243, 897, -394, 817, -848, 581
+stop
@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 86
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+L0: .string "gaqsnsusxyjzfzkuewfr"
+L1: .string "txetoqbijvtdcz"
+L2: .string "qnjguclogyiw"
+; comment
+L3: .string "ejnyzebohpiqchbpskmcbib"
+L4: .data -22
+sub #-122, r1
+L5: .data 942, 615, -548, 184
+L6: .string "fflzaxbfomgcbawakbhrxxnf"
+L7: .data -801, -977, 847, -541, -808, -464, 3, -753
+L8: .string "bkliylmhyj"
+L9: .data -762, -294, -268, -291, 285, -274, -787
+lea L224, *r0
+L10: .data 923, 821
+L11: .data -194, 216
+L12: .data 993, -62, -281, -658, -841, -720
+rts
+L13: .data 216, -560
+; comment
+L14: .string "fzifyetp"
+L15: .string "kotbdfswgopx"
+L16: clr r0
+L17: not *r6
+
+L18: .data -881
+L19: .string "jxebxsdevcoozcvwobwrgvo"
+sub L18, *r2
+L20: add r2, r3
+L21: .data 996, -589, 741, 348, 184, 110, -123
+L22: .string "lmtfjdmdvh"
+L23: .data 660, -910, 765, -406, 195, 587, 930
+lea L2, L14
+L24: .string "dnhohzqtzirjlaiyoaf"
+L25: .string "xqkmzarcxkntxiegdhoy"
+stop
+L26: .string "wvfqqqo"
+clr r6
+L27: jmp *r4
+add *r7, L114
+L28: .string "u"
+bne L6
+L29: .string "yhqzuxxtdffmnksclnl"
+L30: .data 923, -555, 826, -386, -738, 614
+jsr L168
+L31: .string "goikjxl"
+L32: .string "ydhnjoahltutq"
+L33: .string "hiefe"
+L34: .string "icyerdgdw"
+L35: inc L22
+L36: .data -611, -894, -317, -440, 126, 515, 405
+add r2, r3
+L37: .data 163, 931, -781, 465, -462, 633, -767, -764
+L38: .data 704, 409, -102, -998, 460, -859, 638, 290
+L39: .data 664, 196, -323, -611
+L40: .data -540, 683, 867, 568, -804, -616
+lea L22, r6
+L41: jsr L18
+L42: .data -41, 804
+L43: .string "cn"
+add #52, *r5
+; comment
+rts
+L44: .string "sep"
+prn r3
+L45: .string "wmkf"
+L46: .data -55
+L47: .string "jiwnlowoezqzqg"
+cmp #-72, *r5
+dec L13
+bne L28
+L48: .data -519, 650, 320, -840, 710
+bne L88
+L49: .string "v"
+L50: .string "yw"
+L51: .string "rwqkiqhhylelxw"
+L52: sub #-99, *r4
+L53: .string "pftd"
+L54: .string "hyoxogeeklsybauhrlkj"
+L55: .string "ewvbezsel"
+add L33, *r3
+L56: .string "uvtgybmcqsrg"
+L57: .data 19, -782, -622, 424, 774
+jsr *r3
+L58: .string "xdyorek"
+red L2
+
+L59: .string "mcpgkatscxnjkcjoq"
+L60: .string "sirgftljgwpaih"
+L61: .string "pqyswduqfkqkohm"
+L62: .data 134, 577, 430, 215
+jsr *r5
+L63: .data 693, 913, 312, 148, -145, 778, -213
+mov *r1, *r7
+
+L64: .data 394, 215, -38, 336, -307, 980
+lea L34, L34
+cmp L38, r0
+L65: .string "uv"
+L66: .string "gqjmudfbvs"
+inc *r6
+L67: .string "aopcukkasdrcwauf"
+lea L17, r0
+L68: .string "yeyaigan"
+not r2
+L69: .string "waqyxzuk"
+L70: .data 848, -186, -415, -721, 7, -980, -830
+mov r4, r5
+L71: .string "llnwabplekldgaxaxohohtng"
+L72: .string "ugbuaquiiue"
+L73: .data 809, -585, -190, -241
+inc r6
+L74: .string "dsgrxf"
+L75: .data 762, 929, 282, 748, 209, 571, -392, 68
+L76: .data 956, 34, 238, 890, -464, -526, -853
+L77: .string "futjphlmqxmuyehbcfcaa"
+L78: prn L1
+not L53
+L79: .data 703, -796, 362, 360
+L80: .string "pgjoolfzgzuytu"
+L81: .string "fanxebmkjnyzdakdgrydv"
+prn #21
+L82: .string "zdyjspilrdmy"
+L83: .data -713, -481, 886, 355, 548
+L84: .string "ojeu"
+jsr *r2
+L85: .data -307, -485, 299, -968, -555, -745, -975, -493
+mov *r7, L0
+L86: .data 781, -671, 672, -840, -118
+L87: .data -28, -283, -841
+mov L234, r1
+L88: .string "mjcdxxifphk"
+L89: .string "zerssvlezalmcdenkbjz"
+L90: .data -230, -936, 267, -713
+L91: jmp L84
+L92: bne *r3
+L93: .string "qt"
+; comment
+L94: .string "lvegaxdjqtmsjcwga"
+L95: not r4
+jsr *r0
+L96: .string "rgjsorvwtbocmncxdmwnlti"
+L97: .string "kntqnruptfqupffzbnb"
+L98: .string "sbxgmt"
+L99: .string "qwthsod"
+L100: .data 86, -702
+L101: .data -500
+; comment
+L102: .string "mvrfbjflbzttkpjuxwvtr"
+L103: .data 308, -495, -257, -131
+stop
+L104: .data -74, 792, 48, 6
+L105: .data 592
+clr L82
+L106: .data 154, -964, 336
+cmp r7, L87
+inc *r5
+L107: clr L46
+L108: .string "kvmnxt"
+dec r4
+L109: .data -590, -956, 257, 281
+L110: .string "xc"
+L111: .data -403, -77, 927, -834, 914, 934, -771, 798
+add *r5, L10
+not *r3
+mov *r3, *r6
+L112: .data -169, -535, 184, -691, -324, -899, -181
+clr L43
+L113: jmp *r2
+stop
+L114: .data 70, 201, 17, -343, -347, 651, -601
+L115: .data 798, -752, -658, 167
+bne L226
+inc *r4
+rts
+jmp L21
+L116: inc r1
+L117: .string "rfudyzauefpjphpozibmnsn"
+lea L144, r5
+L118: .string "yniikpyvlzivykq"
+L119: .data -236, -769
+sub #-89, L299
+stop
+L120: .data 82
+sub *r5, *r0
+L121: .data 348, 41
+L122: .string "xkyqsacqeilapbrbrs"
+L123: .string "h"
+L124: .string "nfhjbpbbnsmvofeut"
+L125: .data -621, 529, -532, 316, 909
+L126: .data 617
+L127: .string "meftxiaewwqcubu"
+not *r3
+prn L173
+L128: .string "zmrpgepxxnhwwkwxbuqmoop"
+sub r5, *r1
+stop
+L129: .string "mcdfvndd"
+L130: .data 400, -173, 148, 316, 200, 899, 111, -571
+L131: .string "osdejlfzhqfc"
+not *r4
+L132: .string "jusgy"
+L133: .data 70, 149, 923, 245, 253
+L134: .string "sir"
+L135: .string "ksugykpzq"
+L136: dec *r4
+L137: .string "ydeuwrrqhvbembmwwoeuy"
+clr *r5
+L138: .data 307, -658, 872, 531, 746
+L139: .string "acxmzb"
+L140: .data -211, 776, -840, -695, 482, -947, -935, -500
+sub #116, r2
+; comment
+not r3
+
+L141: .string "rmvqauvyu"
+L142: .data -307, 980
+L143: .data 213, -117, 48, 834, -791, 432, -484
+L144: .data 754, -771, 404, 581, 534, 602, 931, 764
+L145: .string "buqodzr"
+L146: .data 424, 215, -907
+; comment
+not L177
+rts
+L147: .data 473, -552, 376, -307, -992, -623, 983
+L148: .string "qzlwefkdela"
+L149: .data -773, -668, -944, -968, -528, 741
+L150: .string "gsz"
+L151: .string "iaetwmhkrqmtsggao"
+not L28
+L152: .string "gxftmdoqdotpj"
+L153: .string "xfsluduqfgskm"
+L154: .string "kqrqknyayvl"
+L155: .string "eptbvaxg"
+L156: .data -468, 842, 855, -578, 892
+sub r4, *r4
+L157: .string "cssioxgdfzvozdztqdrvrd"
+mov r6, L140
+L158: .string "cfunifeemzvdlcrxkvxx"
+add L37, *r6
+L159: .data -397
+L160: .data -898, 443, -395
+L161: .string "xdzxpnulystcov"
+bne *r4
+L162: .data 991, 271, 671, -926, 422
+L163: .data -888
+L164: .data -216, 173, -56, -296, 943, -125
+L165: .string "lqbtafoo"
+inc r4
+inc r3
+
+L166: .string "gxhz"
+rts
+rts
+L167: .data -530, 12, -541, -151, -102
+clr *r7
+L168: .string "ntgfuhxrvvfxerydyns"
+L169: .data -218, 576, 670, -759, 552, -375
+L170: .data -346, 185, -935
+L171: .string "ehxdjy"
+sub r0, L126
+; comment
+L172: .data -137, -196, 23, 647, -254
+cmp #83, *r0
+L173: jsr L20
+bne *r4
+L174: .data 104
+L175: .string "xjqwanfwinqjr"
+dec r4
+
+dec r0
+L176: .data 834, -86, 488, 464, -765, -902, 600
+L177: .data 856, 585, 579, 946, 917, 909, -180
+inc *r0
+L178: .data 661, 719
+L179: .data 40
+L180: .string "ujmfiqozol"
+L181: .string "qamwmzdbrwvsufqjtwkn"
+L182: .string "tyblvrdwqnzcoabjma"
+L183: dec r0
+prn r7
+not *r0
+sub L283, L84
+
+rts
+L184: .string "habekdsieicqylr"
+L185: .data 813, 742, -563, 70, 583
+not *r5
+L186: .data 651, -908, -691
+rts
+jmp L234
+L187: .string "sirojiuhoikicoxsituxd"
+L188: .string "vwbqwkvuucjvpshbwxmro"
+L189: .string "rs"
+inc *r0
+inc L282
+bne L192
+; comment
+
+jmp *r3
+L190: .string "u"
+inc r7
+L191: clr r7
+L192: .string "cs"
+L193: .data 587, -414, 290, 134, -746, -231, -115, -172
+add #-200, r7
+L194: .string "av"
+L195: .string "jgyuc"
+L196: .string "nwudzjqqlmpjxouwlarswl"
+L197: .data -490, -16, -205, 200, 102
+
+sub L229, L119
+L198: not r6
+L199: .string "revkmugpkin"
+
+L200: .string "hiyitlcz"
+L201: lea L209, r7
+L202: .data 664, 860, 51, 55, -646, -5, -842
+L203: .string "ryicuviocnnqekfzrcwx"
+prn #19
+L204: prn L292
+jmp L231
+L205: .data -791, 325, 595, 388
+L206: .string "thwlocx"
+L207: .string "azaxyvpqlplcmnduqnubxsnl"
+L208: .string "qvjbouirartyku"
+
+L209: .string "pjmdpfodgcfgoveqaschoscy"
+jmp *r5
+add L231, *r2
+L210: .string "cqzfinvl"
+cmp L133, *r3
+L211: mov L295, r0
+cmp #116, r4
+prn L151
+L212: .string "qkijkcghnor"
+; comment
+jmp *r5
+L213: .string "agyksdudyxh"
+L214: .data -5
+L215: cmp L38, #-48
+bne L52
+red *r5
+L216: .string "laotpjhgqiddgloxwmj"
+L217: .string "u"
+L218: .string "byvblguabqutsrrfxkf"
+rts
+prn r1
+L219: .string "xqwwmltxjqkkuxvahutmukl"
+L220: .data -663, 530, -421, -53, 473, 840, 294, -734
+L221: .data 337, -829, 149, -288, 686, 139, -929, 344
+L222: .data -195, 387, 257, -371, 792, -16, -916, 182
+L223: .data 854, 381
+L224: .string "oejhzaausosle"
+stop
+L225: stop
+not *r7
+L226: .string "xtkknyhpycggbefppavegz"
+L227: .data 924, 571, 351, -18
+L228: rts
+L229: .string "kewhorixx"
+inc r3
+L230: jmp *r7
+; comment
+L231: sub *r1, L165
+L232: .string "qbgboqi"
+lea L148, r2
+inc r7
+L233: .string "ciuqkwpckldxpv"
+L234: .string "wrxzdxqkutgrwkgqfrnsswg"
+L235: .string "nutk"
+mov *r2, L144
+jsr L306
+L236: .data 454, 594, -438, -600, -293, -377
+
+L237: .string "termvjqahma"
+L238: .string "ppscnejgz"
+sub r7, *r6
+rts
+bne L235
+jsr *r5
+red *r4
+stop
+L239: prn L124
+mov r4, r3
+cmp L104, *r3
+L240: .data 378, 913, -481, 673
+rts
+prn r3
+L241: .string "tarwcydltewvrdsfcx"
+L242: .data -694, 205, -79, -895, 99, -514
+prn L309
+L243: .string "afgcmtlmtvnuelrv"
+cmp r7, L159
+L244: .data -609, -221, 105, 214, 299
+L245: .string "dqpvzhyirsfswopcquea"
+stop
+L246: .string "hjcjmwnrvcrvzhwfvbfptoi"
+add *r2, L92
+L247: .data 275, 931, -58, 628, -255, 528, 102, 543
+L248: .data -647
+lea L306, *r5
+L249: .string "gisuavdcazh"
+add *r1, L253
+L250: .data 597, -696
+L251: .string "imxjtitmpzznv"
+L252: .data 461, 531, 482, 796, -249, -94
+red L50
+rts
+L253: sub L291, r3
+L254: .data -490, 803, 624, -151, 74
+L255: .data 347, 651, -500, -670
+inc *r5
+clr L265
+L256: .data 27, 702, -551, -290, 265, -513, 835, -239
+L257: .string "hugouyuh"
+not L274
+L258: .data -510, 267, -787
+L259: .string "awmqhfdtbdqtvzldmxjp"
+L260: .data 40, 780, -897, -674, 575, 858, -395, 96
+L261: .data 241, 860, 86, 365, 794, 709
+L262: .data 749
+L263: .string "zkvyjtnorqifhcmbt"
+inc r1
+L264: .string "qncuqhqzkqnjhtspxzdwev"
+L265: .string "jl"
+L266: .data -325, 685, -190, -48
+rts
+L267: .string "ezmezhgrmlzfjpnqbtarjeai"
+L268: .data -450, 594, 463, 847, 882, 586, -523
+add r7, L66
+L269: .string "esqxbdgeawqqsrobvjeyd"
+L270: .string "rcqmxdrixdnam"
+L271: jsr *r0
+L272: .string "jjmjopbr"
+add L280, *r5
+L273: .data -245
+L274: .string "ygucof"
+L275: .string "zkcptud"
+bne *r2
+L276: sub *r3, r3
+L277: .data 824, 705, -467, 932, -670, -309, -31, 686
+L278: .string "yihmaltzd"
+L279: .data 700, -82, -534, -691, 713, -271, -273, 790
+L280: .data 237, 831, 247, 827, -81, 313
+L281: .data 393, -380, 459
+cmp #-197, #253
+jsr *r2
+L282: .data 834, 637, -604
+L283: .string "ptxofxxkbx"
+L284: .string "dbzzuulfnzjjdthxa"
+L285: jmp L298
+red r0
+inc L300
+prn *r7
+jmp L288
+L286: .string "skx"
+L287: .data 998, 908, -328, -823, -303, -418
+lea L272, *r3
+rts
+L288: .data 632, -91, 827, -46, -616
+L289: .string "urychrinlsjosrtrzvj"
+; comment
+
+L290: .data -226, -578, -911, -529
+L291: bne *r3
+L292: not *r5
+L293: add r7, r4
+L294: .string "ihqykyigujohzvngrlacpy"
+L295: .string "zhybsrneqfxwssglqmowlx"
+dec *r3
+L296: .string "iijvfklpqpbrllu"
+L297: .data -113, 342, -866, -238, 773, 584, 802, -822
+inc L77
+L298: .string "jaoxxpomcuwtnfdxqvrk"
+dec L257
+bne *r6
+stop
+bne L307
+lea L289, *r2
+L299: .string "gdhwbd"
+not r4
+sub r2, L15
+L300: prn #132
+bne L31
+L301: .string "vozitxbxgvhgrizgkrarzcre"
+L302: .data -60
+clr L307
+L303: .string "pbjw"
+L304: .data -258
+L305: .data 56, -64
+dec L307
+sub r3, L6
+stop
+mov L309, r3
+L306: .data -681
+L307: .string "p"
+L308: .string "cbbsxfvuu"
+L309: .string "cjzuxcpgkztsz"
+red r2
+L310: .data -483, 919, 220, -673
+stop
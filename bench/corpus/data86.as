@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 87
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .string "ybatzb"
+L1: .data -851, 289, 21, 729, -399, -622, -708, 402
+L2: dec *r1
+sub #62, *r1
+L3: .data -147, 798, -995, -636, -413, -859, -876, -797
+L4: .data -823, 847, -382
+L5: .data -309, -599, 410, -896, -555, 610, -236, -16
+inc r4
+L6: .string "m"
+L7: .data -324, 22
+L8: .data -817, 863, 562, -621, -956, 430, 45, -803
+L9: .data 313
+L10: .string "kk"
+; comment
+L11: .string "arriznwuyhacb"
+L12: .data -865, -487, 363
+L13: .data 861
+mov L315, *r6
+L14: .string "se"
+dec *r5
+prn r2
+L15: .data -556, -950, -467, 175, 113, -56, -591, 477
+L16: .string "zdkfosqxcdwkdmlqlsaumk"
+L17: .data 851, 183, 688, 251, -499, -719, -875
+cmp L13, *r6
+jsr L71
+not L141
+L18: .data -150, 445, 364, -641, -830, -552, 315, 544
+sub L16, L16
+L19: .string "ewznmqskukczjumaajdc"
+L20: .data 710, 672
+L21: .data -690, 753, 103, -20, -794, 949, -325, -408
+L22: .string "hascufugumakuljd"
+L23: .data -536, -262, 29, -982, -15, -371, -446, 251
+L24: .string "axjojjkos"
+mov #-113, r4
+red *r2
+L25: .data -21
+add L61, r5
+stop
+add r6, L44
+mov L117, L166
+L26: stop
+L27: .string "cppbal"
+L28: .data 552, -413, -652, -633
+red L21
+inc *r4
+L29: .data -951, 739, 778, 810, 628, 754
+L30: .data -958, 897, 279, 220, -389, 335, -931
+clr r2
+L31: .data -839, 795, 561, -623, -324, 968, -121, 41
+rts
+L32: .string "dmbodvileupcygc"
+cmp *r2, *r6
+prn #-22
+L33: prn *r7
+not L323
+
+L34: .string "tdchkqdpvxqfcztvbjd"
+L35: .string "pn"
+
+L36: .string "ernmuaclvsxhrmyyfbol"
+L37: .data -623, 50, 562, 470, 326, -957, 332, -947
+inc r1
+L38: .data 238, -954, -787
+jsr *r1
+L39: .data -174, -770, -127, -608, -431, 570, 619, -776
+L40: .data 930, 397, 849, -653, -419, 593, -816
+L41: .string "rbx"
+L42: .data 45, 658, 840
+L43: .data -257, 665, 346, -667
+L44: .data -938, -230, -342, 798
+cmp r7, L159
+
+L45: sub *r0, *r4
+rts
+L46: .data 989, -998, 7, 698, 631, -568, -338
+L47: .string "pi"
+L48: .string "innuczmq"
+; comment
+L49: .string "hwomxwingmyexzkiyjx"
+lea L37, r0
+L50: sub *r1, L11
+L51: .string "u"
+L52: .string "eugwwdywiivy"
+L53: .data 229, 652, -603
+L54: .data 109, -112, -256, 945
+jsr L50
+L55: .data 194, 849, 839, -696, 5, -131, -340, -590
+lea L24, L33
+L56: .data -154, 57
+L57: .string "ezzotfxqdhtdp"
+L58: .data -771, -437, -612, -76, 661, -756
+L59: .string "cjcrs"
+L60: .data 73, -304, -364, -670, 308, -296
+L61: .string "szaqyozdgbwxa"
+L62: .data -723, 83, -410, 241, 765, -136
+L63: .data -632, 482, -699, 742, -423, 66
+
+L64: .data -751
+mov r4, L21
+L65: .string "brm"
+jmp L308
+sub r2, L33
+L66: .string "jvkledxyouxumloewhdyb"
+L67: .string "vgpl"
+L68: .data 709
+L69: .data 865, -425
+lea L60, L47
+red L51
+lea L56, *r5
+L70: .string "dro"
+L71: .string "teoyhaszxafmxnrx"
+L72: .string "kyycirjbawpbnaeias"
+L73: .string "x"
+L74: .string "uldtzgovhyevcqdr"
+L75: .string "cmczhdrsjkwdrpznglp"
+L76: .data -457, 720
+L77: .data 180, 155, 881, 969, 931, 74, -185
+inc L46
+dec *r1
+L78: .data 622, 142, -262, -86, 766, 293, 915, 53
+jsr L49
+L79: .data 317, 238, 375, 279, -892, 671, 228, 722
+L80: .string "vfu"
+L81: .data 94, 425, -78, 38, 131
+L82: .string "ezmpgojnvivmaxfxtuyuxq"
+L83: .data -697, 872, -676, -936, 857
+L84: .string "essdvvfyn"
+stop
+
+L85: .string "wlb"
+L86: .string "uloz"
+L87: .string "dopishherao"
+L88: .data 218, 919, -627
+bne L251
+L89: .data 829, -702, -905, 696, -264, -175, -238
+L90: .string "jgel"
+L91: .string "orhykzjb"
+L92: .string "oovixdfikxtavl"
+L93: .string "lwbwkeozqnrpubxnrzz"
+dec *r6
+L94: .string "lh"
+L95: .string "pbszm"
+L96: .string "rqwzdxatddtyaw"
+L97: .string "fxjwfspiaqgngvocq"
+L98: .string "cagwocakpdhosfmudxdc"
+clr L167
+L99: .data -120
+L100: .data -769
+lea L150, r4
+sub #-85, *r0
+L101: .data 7, 868, -346, 282, -213
+mov #78, r2
+dec r3
+L102: .data 295, -283, 838, 488
+jmp *r7
+L103: .string "zzgucidoychrskk"
+red L9
+clr r6
+L104: .string "cehho"
+cmp #93, r7
+L105: .string "fovhknuxpe"
+
+L106: .data 56, 236, 226, 494, -462, -727, 226
+L107: .string "cnavoqtghsgfgvwkyxg"
+not r6
+L108: .string "ufisoaqzkubi"
+L109: .string "tjrrugvmbjmhstlujzi"
+L110: .data -314, -692, 815, 339, 446, 691
+cmp L192, L198
+mov *r6, r2
+L111: .data 710, -712, 693, -220, -320, -746, -404, 223
+L112: dec *r0
+L113: .data -261
+red *r7
+L114: .string "wczsxalgprsjsah"
+not L3
+L115: .data -143, 44, -177, 761, -914, -731, 904, 989
+L116: .string "wwlgwbcwaajxfpyabqvwf"
+L117: .data -561, -556, 416, 557, 995
+L118: .data -351, 585, -510, 660, -791, -354, -680, -455
+L119: .string "uwacrnx"
+L120: .data 526, -564
+L121: .data 537, 650, -617
+add r3, L10
+prn #-193
+
+red *r5
+L122: .data -867, 92, -717, 169, 29, -188, -738, -873
+L123: .string "htoeptobuupelh"
+L124: .string "mynoqksviyficwculthp"
+L125: .data -196, 581
+not *r7
+L126: .string "uhuhnddhqkjs"
+L127: clr *r0
+L128: add *r3, L206
+L129: .string "ivjoxksosezwmmm"
+L130: add r7, L311
+L131: .string "ciuzpwocyforyozdum"
+L132: jsr *r2
+add #31, r2
+L133: .data 123, 188
+L134: .data -759, 71, -557
+L135: .string "apiyilnuuiwuqhdupttsdaz"
+prn L100
+L136: .data -62
+L137: bne *r5
+inc L282
+L138: cmp #-109, #-117
+; comment
+L139: .string "ecyqvijxmjidjmewrs"
+L140: .string "lytisaimhjyzlgnz"
+dec *r5
+
+L141: .data -605, -412, -435, 482, 15
+L142: .data -713, 602, -237, -278
+L143: .string "wxilmwdkubckbojoiq"
+L144: .string "cmlgowxiixzo"
+clr r4
+L145: .data -538, -237, -952, -368, 531, 197
+bne L34
+L146: .data 589, -975, 833, 277, -452
+lea L136, r2
+L147: jsr L10
+L148: .string "iwsdmdjqqfpt"
+
+rts
+L149: .string "izjujhtmfkl"
+L150: sub L325, *r5
+inc r2
+L151: .data 804, -290, -950, 164, -704, 576
+add *r4, L192
+L152: .string "srkwwxsiyqigyjsijjst"
+L153: .data 853, 235, -413, 558, 57, -207
+L154: .string "fpcklqqzqcwwfexivcm"
+L155: .string "soyxgetbirpnkajk"
+L156: .string "zhq"
+L157: .data 615, -211
+mov *r5, *r0
+L158: .data 837, 210, 747, -146, -690, -590, 986, -767
+L159: .string "ujgetz"
+L160: add *r7, L212
+inc r2
+L161: .string "aqaepexebb"
+L162: .data 371, -356, 220, -779, -609, 45, 820, -511
+stop
+L163: .data -105, -405, -152, -894, 19, 969, -984
+clr *r7
+; comment
+L164: .data 454, -383, 54, -801
+L165: .data 463, 292, -887, -495, -773, -344, -990, -799
+L166: .data 64, 364
+L167: .data -755, -482, 827, 50, 198, 800, 438, 380
+L168: .string "cwheimbylfceoosnagwtklod"
+L169: .data 757, -824, 776, 772, -797, 731
+L170: .data -569, -773, -490, 862, -584, -293
+lea L87, *r4
+L171: .data -152, 616, -348, -539, 887, -939
+L172: .string "hvezhrcxkaxzcpg"
+L173: .string "ghmcxoojget"
+L174: .string "wbfbgiqvpyokrmkmaad"
+L175: .data 636, -294
+
+; comment
+rts
+L176: bne L246
+L177: .string "ucxwvlicaaqjhpgmwwny"
+L178: .data 751, -431, 385, -371
+jsr *r1
+jsr L185
+prn *r5
+mov #226, *r3
+L179: .string "aeuzpypxxwpprqmvw"
+L180: .data 554, -164, -908, 481, 432, 641, -783
+L181: .string "lklfasnilfc"
+L182: .string "jaoedvpfllap"
+L183: .data -33, -718, 790, -290, 248, 510, -699, -89
+L184: .string "f"
+L185: .data -411
+inc L8
+L186: .data -337, -739, 144, -5, -428, -542, -157
+
+mov *r6, L146
+L187: .string "kjcriravqd"
+mov L154, L210
+L188: .data -586, -920, -165, 96, 944, -741, 243
+L189: .string "fmilblu"
+; comment
+L190: .data 443
+prn *r6
+dec r2
+add #-188, *r0
+L191: .string "nsrktwfvgv"
+red r2
+sub *r2, L249
+red r1
+L192: .string "hprmfxkzrfuzc"
+L193: .data 275, -883
+prn L103
+L194: .string "qoipdwicvzbubdkyyczcp"
+bne *r6
+L195: .data 73, 778, 691, 892, 892, 36, -505, -936
+L196: .string "zxzm"
+L197: .string "alwxrb"
+L198: .data 643, 701, 908, 699, -795, 208, -515, -906
+L199: .string "cvixbjxpvh"
+L200: lea L297, r2
+L201: rts
+L202: .string "vjmewdjhywllmelfasxupf"
+L203: .string "xmhpplxzpdmpxrwmqfdkna"
+stop
+sub *r7, r0
+add L103, *r2
+clr *r4
+dec L222
+add L256, *r7
+bne L242
+L204: .string "wfaoltsuoeoibeiahzt"
+L205: .data 511, 17, -428, -981, -612, -835
+L206: .string "cfizhgj"
+bne L83
+L207: .string "expzgwd"
+
+L208: .data 884, -254
+; comment
+L209: cmp *r7, r0
+add L224, L188
+L210: .data 5, 813
+L211: .data 878, -810, 898, -538, -906, -923, 249
+L212: .string "mjaelvtddqlbcprdx"
+mov *r0, r4
+L213: .string "yopfecphteo"
+L214: .string "fss"
+L215: .string "dxxaeuajwoibmucxabo"
+L216: .data -334, -877, -328, -348
+L217: prn L304
+L218: .string "oibbphmeqpqyzcc"
+L219: jmp L253
+mov #-232, *r2
+L220: .data 266, -575, -247
+L221: .string "pgegyvqghoprehzhion"
+clr L117
+L222: .string "ueybxfpjbqwqgvoxxgh"
+L223: .data -241
+L224: .string "jgd"
+L225: .data -210, -527, 846, 665, -128, -666
+add #108, *r4
+bne *r0
+rts
+L226: not L237
+lea L260, r0
+prn *r7
+mov #-21, *r1
+L227: .string "vzmwbdfqivtwanxubuxqo"
+L228: .string "mqnaubhilyv"
+not *r0
+L229: cmp L298, #72
+L230: .string "ayyamsqxwu"
+L231: .data -42, 628, -440, -8, 202
+bne *r2
+L232: .string "zecnbsofatfhvu"
+not L140
+L233: .data -11, 46
+jsr *r0
+L234: .string "ae"
+rts
+L235: .string "fzqjqxbqldlaemxbh"
+L236: .data 470, -413, -699, -763, -103, -730
+L237: .string "awfervslezqgihwcmsalgt"
+red *r7
+L238: .string "swmimtkdjmnffqsjtjlixp"
+L239: .data 254
+L240: .string "bdjpnzulckvgpzvrhzfk"
+L241: .data -894, -885, -341, 144, -235, 73, 186
+red L67
+L242: .string "oarsg"
+L243: .string "uz"
+stop
+L244: rts
+stop
+L245: .data -880, 581, -853, -938, 316, 578, 561, 358
+mov *r3, L270
+L246: .string "vmmdhtaf"
+
+L247: .string "z"
+L248: .data -583, 520, 345
+L249: .data 689, 653, -600, 549, 518
+L250: .data -582, -748, -413, -127, -137, 107, 786
+L251: .data 402, -598, -137, 914, -861, -533, -427
+L252: .string "mieskpqocbtwndbdtzpkftfp"
+L253: .data -353, 620, -964
+L254: stop
+L255: .data 585
+clr L229
+L256: .string "caabyexhfj"
+lea L188, L305
+L257: .string "eh"
+L258: .string "n"
+L259: .data -768, -617, 277, -456, -297, 164, 896
+L260: .string "hwqw"
+L261: .data 202, 195, 901, 614, 473, -228, 414
+L262: .data -263, 676, 516, -787, 724, -813, 96, 141
+L263: .data 710
+L264: .data 387, -53
+L265: .string "lsesnisgpbeuoejjismtohyz"
+L266: .string "rprvkianuhpdyncppghcgc"
+L267: .string "ebgh"
+L268: .string "huyzlzsgo"
+not r4
+L269: .string "wwglbzsd"
+L270: .data 815, -359, 590, -306, -273, -327, 468
+L271: .string "rlmjualaimujpstz"
+L272: .data 833, 557, -471, 160, 423, -727, 506
+lea L61, L159
+L273: .data 200, 614, 358, -416, 351, -57, 266, -76
+jmp L115
+L274: .data 789, 519, -153, 157
+L275: .string "ysfn"
+L276: .string "yzngcnpvvbmqpbaglwdv"
+L277: .data 917, 495, 646, -201, -232, 405, 969
+L278: .string "lmoavgbfdn"
+sub #-3, r5
+L279: .string "bzqvznyvshrwwm"
+jmp *r6
+L280: .string "mhcvwmxhvgm"
+not *r5
+L281: .data 230, -816, 464, 265, -747, 249, 614
+sub *r7, *r7
+L282: .data 803
+not L150
+L283: .string "thkdsuofgkzyafemmx"
+L284: .string "mufhadb"
+L285: .string "eckjzjxqwuewmdofwbihmpt"
+L286: jmp *r2
+L287: .string "dniszu"
+jsr L299
+lea L292, *r0
+L288: .string "hlkilvjqrrxsikzi"
+L289: .data 678
+L290: .data 389, -132, -609, -816, 334, 516
+L291: .string "hoie"
+L292: .data 612, -24, 422, -226, -587, -535
+L293: .data 15, 939, -51, 589, 142
+L294: .string "yznjstfjbbk"
+; comment
+inc r0
+L295: .string "jwgygnsdwssxxahhhzw"
+L296: .string "japwoslwcrgzydmygvieevg"
+L297: .string "svtjfoyfjfotlvp"
+L298: add #-101, L291
+lea L303, *r1
+add *r1, r2
+cmp #-64, *r5
+L299: .data 970, -482
+; comment
+dec L312
+L300: .string "klfbabiimm"
+L301: .string "jszuleryopgfc"
+L302: .string "ljnybzrwlwmxzwiertdyhoob"
+dec r1
+lea L314, *r7
+L303: .data -301, 500, -532, -776, -995, -85
+; comment
+L304: .data -384, 106, -962, 262, 238
+L305: .string "eiadr"
+not *r2
+L306: .data 406, -143, -29, -36, -870
+cmp #131, r4
+L307: jmp *r2
+L308: .data 176, 720, -729, 755, 511
+L309: .data -812, 210
+L310: .data 380, -219, 943, 261, -673, 126, -940, -606
+add *r7, *r4
+L311: .data 658, -916, 386, -117, -929, -388, -383
+add L296, r5
+L312: .data -627, -828, -475, -43
+L313: .data -667
+L314: .string "sygtx"
+L315: .string "pdudzyzztxdxothwudrpzptr"
+sub r3, L29
+
+L316: .data -586, -438, -945, 738, -945, -765, -95, 192
+lea L66, L239
+bne *r5
+L317: .string "hzag"
+jmp L321
+L318: .data 899, 618, -364, 358, -871
+L319: .string "zmhusupzyteuczmvqhbnp"
+L320: .string "mygydmdm"
+L321: jmp L63
+red L290
+bne L150
+
+L322: .string "nkbdkzspenfldkdrduzbkov"
+L323: .data -922, 567
+L324: .data 733, 770, -737, -794
+sub *r3, L325
+L325: red L108
+red r2
+stop
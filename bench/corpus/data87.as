@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 88
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: not *r2
+jmp L0
+mov r4, *r5
+L1: .data 601, -631, -704
+L2: .data -114, -426, 552, -38, 943, -981
+; comment
+L3: .string "myqqcub"
+L4: .string "lcaa"
+red L132
+L5: .string "foibbziqvroyelyypdbyz"
+clr *r3
+L6: .string "qjqpgvufdttlfkisbeyepne"
+L7: .string "bwilvyuhobvnsspitpict"
+lea L4, L203
+L8: .string "aglexztdbzvyzg"
+L9: .string "xfbhsmlgxkmkjwb"
+L10: .string "mycsxvpldqzpsgamdzctjtw"
+L11: .string "iqclnzoduyaphmebmkbei"
+clr *r0
+L12: .string "nwojmw"
+L13: .data 283, 58
+L14: not r4
+L15: .string "brnxqabmrcrujesaf"
+L16: .string "vhkogrtaqvns"
+L17: .data 98, -635, 539, 255
+bne *r6
+L18: .string "kar"
+L19: .data 470, 640, 848, 476, 570, -817, -725, -257
+L20: .data 308, -363, 314, 480, -859
+inc L142
+L21: .string "eujecncvtlwoykuourdexnto"
+lea L11, *r1
+L22: .data -975, -287, -946, 64, 852, -277, 35
+not *r4
+L23: .string "slorjjuzuxgwteuvcssq"
+L24: .string "sbscrndnqevkyjjpqjlr"
+L25: .string "ejrerowltenbizr"
+L26: .string "idpvqsvbupd"
+L27: .string "bqrhkgjpkwflftrbjryj"
+L28: .string "kqzteejbg"
+L29: .string "kclbmysnku"
+L30: .data -271, -575, 78
+L31: jsr *r0
+jsr L127
+L32: red *r5
+L33: .string "zzrfjpmsglgacxn"
+not L238
+L34: .string "alfoshfkqzl"
+L35: .data -218, -292, -564, -272
+L36: .data 116, -918, -517, -856, 310, 469
+L37: .string "xdj"
+bne *r1
+dec L288
+mov L285, *r6
+
+red r7
+L38: .data -671, 727, -711
+L39: .data -43, 939, 323, -16, 864, 831
+L40: stop
+L41: .data -787, 391, 454, -144, 430, -257, 63
+L42: .string "iwpqe"
+jsr L215
+mov *r2, r4
+rts
+L43: .data 315, -13, -653, -815, -253, 63
+red L304
+L44: .data -320, -901, -304, 259
+L45: .data -380
+L46: .data -684, 352, 259, 323, 535, 835, -4, 937
+L47: .string "cbomyzgryjjcoknnigxmeonk"
+rts
+L48: .string "qmmmswuhd"
+add #0, r5
+clr L174
+L49: .string "tuurujcjwqxxcuasuv"
+L50: .string "alkzapivvbqjzdjvkfgp"
+L51: .string "bxfdqeoldhom"
+L52: .string "xkymlagehsnrwventgouvqm"
+L53: .data -847, -574, 400
+sub L46, r0
+; comment
+stop
+L54: .data -679, -238, -964, 546, -30, -941, 995, -646
+L55: .string "nwgmlzlyeeyqkmgqqh"
+L56: .string "qplxqzxsjnxx"
+L57: .string "xvnqllbyybmuwotoj"
+L58: .string "xdtecmkiob"
+L59: .string "wcwnkkevxtyad"
+jsr *r3
+L60: .string "ulwayihdraysxriabeyrxqq"
+L61: .string "ukdnsihllntbx"
+L62: .data -754, 653, 139, -504, -471, 588
+L63: .data -477, -276, -678, 506, 349, 601
+L64: .string "iblkuvjymoezis"
+L65: .data -491, -414, -755, 615, -123
+; comment
+L66: .string "lbtqznms"
+L67: .data -22, 688, -655, 76
+L68: .string "boegelviujtlhvejubmygi"
+add r6, r2
+jmp *r5
+L69: .string "b"
+not *r6
+red r5
+L70: .data -292, 424
+jmp L172
+L71: sub L8, *r2
+L72: .data 651, -660, -736, -624, -100
+sub r5, r7
+L73: .data 503, 879, 647, -552, 195, 652, -935
+L74: .string "mvievnwibyzksuff"
+L75: add r6, *r4
+jsr *r7
+L76: .string "zm"
+L77: .data 165, -487, -808, 679, 659
+L78: .data 163, -680, 514, -724
+; comment
+dec r7
+L79: .string "ynkzeecjjchmbt"
+inc r5
+add *r6, r5
+L80: .data -787, -501, -286, 355, 983, 600, 291
+L81: .string "unswztfazduki"
+add L53, r0
+dec L58
+L82: lea L14, L40
+L83: .data -275
+L84: .data -153
+L85: .data -202, 931, 86, 857, 115, -291, -874, 983
+L86: prn #108
+
+L87: .data -330
+mov *r6, r6
+L88: .string "dijbfbyuawnmaywnmvoozt"
+clr L65
+L89: .string "oxcufriooexjlj"
+L90: .data 700, -372, 79
+sub r7, r7
+cmp #148, #196
+L91: .data -554
+L92: .string "gvjfjqixnwgowb"
+stop
+red *r5
+L93: .data -653, 53, 337, 359, 99
+mov r0, r4
+L94: .string "mkcifocnumhmqfdtyyoqd"
+L95: .data -376
+L96: .string "epiultudg"
+L97: .string "pffyevrrpvbghmjvmufvfq"
+lea L78, r6
+L98: .data -692, 787, -520, 905, -139, -900, -263, -233
+L99: .string "fjziiotqtrfmjqfpisaoicdg"
+L100: .data -637, -846
+L101: clr r7
+stop
+L102: .string "jdpmfabaelmedfnly"
+rts
+lea L166, *r2
+L103: .data -719, 500, -365, -975, -692
+L104: .data 943, 978
+inc *r5
+L105: .data 907, 436, 287
+jsr *r5
+L106: red r5
+L107: .string "drovfy"
+L108: clr L290
+jsr *r4
+L109: .data -918, -525, -67, 777, 421, -771, -656
+L110: .data -771, 325, 995, 357, 182
+L111: .data -212, -821, -785, -204, 404
+L112: .data -244
+L113: .string "g"
+L114: inc L134
+L115: .data 490, 530, 461, 649
+not L30
+L116: .string "xmcmadkkmj"
+add #-43, *r2
+L117: .string "g"
+L118: .string "qankxpuxyrqmroobnj"
+L119: .data -40, -366, -959, -567, -183, 318, -347
+L120: .data 45, -638
+L121: .data 255, -103, -979, 709, 63
+red r6
+L122: prn r7
+L123: .data 917, -429, 878, 963, 717, 690
+mov *r3, r6
+L124: .data 588, 965, 884, -857, 854
+L125: .string "iapigdwylvuwgjkbrqpyuf"
+L126: .data -915, -122
+stop
+L127: .string "zpusd"
+add #-48, *r3
+L128: .data -496, 336, 103, 830
+L129: lea L290, r7
+L130: .string "gauzfylm"
+L131: .data -932, -794, 286, -480
+stop
+inc *r1
+L132: .data 156, -835, 2
+L133: .string "fgbnqnnywdvezgeeobtcr"
+L134: .string "mgxgpdva"
+L135: .string "gkzggzkgrzpatsyvnijznhz"
+L136: .data -472
+L137: red *r0
+add r0, L16
+L138: .string "cceqs"
+L139: .data -319, -177
+L140: cmp #-56, r0
+; comment
+cmp L214, #214
+L141: .data 934, 7
+L142: .data 697, 547, 162, 682, 40, -529
+jsr *r1
+rts
+L143: jmp *r2
+L144: .string "hy"
+L145: .data -520, -668, 909, -468, 340, 511, -973
+L146: .string "qfajlxrwxxxfibjrrhwcoql"
+L147: .data -646, 3, -820, -385, 684, -987, 848
+stop
+L148: .string "hrcifjoiiuaamsolh"
+L149: .data -873, -327, -467, -796, 662, 52
+jmp L250
+L150: .string "dclcnzivdhoyqdbrbcqxs"
+
+L151: .string "jnhqde"
+not *r4
+L152: .data -933, -282
+L153: .data -253, 673, -314, 145, -883
+L154: .data 725, -633
+L155: .string "bulrgctyxlgyz"
+L156: .data 179, 762, 583, 55
+stop
+not L209
+L157: .data 407, 33, 555, 124, 388, -781
+L158: .string "rlzbyypfsyzaody"
+L159: .data 821, 436, -96, -250, 705, 279
+L160: .string "rmgtfbvqkikbgj"
+bne L145
+L161: .string "bwfopbavrzslnxywzyn"
+L162: .string "avdprihceldpskhosa"
+inc *r2
+L163: .string "whrqmyemuoh"
+L164: .string "rlox"
+mov L287, r4
+red r5
+L165: .data -374, -14, -823, -524, -147, -183, 532, 625
+jsr *r7
+L166: .data 422, 126, -642, -334, -65, 917
+L167: .data -151, -464, 599, -938, -314, -710, 905, 54
+L168: .data 719, 250, -24, -802, -681, -612
+L169: .data 977, 5, 172, 526, 226, -913
+lea L70, L203
+inc L265
+L170: .string "mdubie"
+L171: .data 762, 308, 851, 987, -664, 16, -723
+rts
+L172: .string "hnmujvmhqed"
+L173: .data -606
+L174: .data -540, -776
+add #-241, *r4
+L175: .data 766, -637, 332, 703, 468, 655, 378, 616
+L176: prn r1
+L177: .data -591, -947, -694, -893, -528, -61
+L178: .data 392, 332, -98, 757, 179, -373, -342, 360
+L179: jsr *r6
+L180: .string "peklvjsevicbxpfliaz"
+L181: bne *r1
+L182: .data -673, -811, 132, -338, 132
+L183: .data 588
+L184: .data 700, 88, 812, -748, 794, -810, -15
+inc *r7
+L185: .data -902, -961, -239, -452, -562, 708
+L186: .string "zwzpevakkekvewvf"
+L187: red *r4
+dec L230
+rts
+not *r2
+jsr *r6
+L188: .string "lthtgoexbtzencreyzvifvcf"
+L189: jsr L251
+jmp *r0
+lea L291, L138
+L190: .string "esmtvedaquqtg"
+L191: .string "cmph"
+jsr *r0
+L192: stop
+L193: .data -776, -551, 975
+
+L194: .data -449, -226, 272, -719, 523, -232, -754, -50
+L195: .string "scmdctdrde"
+L196: .string "xeaniinpcip"
+; comment
+L197: .string "zuijmt"
+L198: .data -983, 22, -366, -715, 779, -644, 973, -960
+L199: .string "qdswynwjyymafnlcc"
+inc *r0
+cmp #14, #-66
+L200: .data -428, -251, 840
+L201: .data 144, 740, -608, -294, 115
+add L196, L316
+L202: .data -565, -894, -647, 67
+L203: .data 375, 681, 849
+jsr *r4
+L204: .string "tzxwfcjzkrmmefnqkvofepgv"
+L205: .string "dkzpezv"
+lea L291, r1
+L206: add #118, L132
+not L227
+jmp *r1
+L207: .data -98, -245, 112, 816, -308
+bne *r0
+L208: .string "fnod"
+L209: .string "djhtgezlmvkvxlyvmp"
+L210: .string "dtdwljwahtchanvyis"
+L211: .data -667, 155
+L212: .data 615, 547, -544, 730
+cmp *r6, *r5
+L213: inc L140
+L214: .string "xhtwroebnhcaaodlcaywfe"
+L215: .string "rgiqjurunvnryvqqhadmfs"
+L216: mov L138, *r1
+L217: .data -965
+mov r2, *r2
+L218: .string "wwgzmxhotlddgwpd"
+add #-124, L325
+L219: .string "vbjamfaicwaomqyfh"
+clr *r1
+
+sub L263, r6
+L220: .string "odrsvfu"
+L221: .data 517
+stop
+L222: mov L189, r6
+L223: .string "ygudaqlwllvfypoa"
+L224: .string "nutlzmfalljxhwazsuulmdtm"
+L225: .string "laaxcfyfixidkytq"
+; comment
+L226: .string "qshecppreyh"
+L227: .data 609, -713
+L228: not r1
+not r4
+clr *r6
+mov r2, *r4
+L229: jmp L94
+L230: .data -114
+cmp L8, r7
+L231: .string "fw"
+L232: .string "bmzhcnwzxayuatdei"
+L233: .string "wzr"
+not L180
+L234: mov r7, *r6
+L235: .data -795, -899, -853, 876, -565
+
+L236: .data 748, -190, 157, -8, -2, 332
+L237: .data 2, 702, 508, 862, 653, 211
+L238: .data -880, -952, -110, -934, 547
+add *r7, r1
+mov r0, *r3
+lea L48, L254
+L239: red *r0
+bne L158
+clr r4
+L240: not *r6
+sub L269, L324
+sub r7, *r7
+L241: .string "potgfgplirxnokh"
+L242: .data 610, 977, 95
+mov #-122, L93
+
+dec r2
+red r5
+stop
+L243: .data 131, -700
+jmp *r0
+inc L95
+L244: .data -802, -403, 776, -213, -289
+L245: .string "klz"
+L246: lea L255, *r4
+stop
+jsr *r3
+L247: dec r6
+jmp *r7
+L248: .string "unyyhc"
+L249: .string "eywepecja"
+L250: .data -15, -968, -257
+L251: .string "saonhqnpmk"
+L252: .string "wwlvcjdsjvvxsylwxbh"
+L253: .string "onrjnqnhvy"
+prn L55
+not *r3
+dec *r7
+L254: .data -57
+bne L232
+L255: prn *r2
+L256: .data 478, -769, -905, 43, -553
+prn r2
+L257: rts
+L258: .string "fdkgoqjqgmhmkoq"
+L259: .string "hlydaqwxsqydcglsjae"
+sub *r0, r6
+L260: add *r4, r5
+add #191, L278
+L261: .string "djypajovyigoxs"
+L262: .data 196, -918, 18, 281, 471, 686, -206, -821
+L263: .data -620, 589, -577
+; comment
+L264: .string "jphscxjnluumxo"
+L265: red *r5
+L266: .string "khvjthckfpv"
+; comment
+L267: .data -378, -611, 648, 858, 204, 19
+L268: .data -721, 959, -264, 537, 313, 947
+L269: .string "mndxtgsh"
+L270: .data -534, 969, 919, -57, -773, 37
+prn *r4
+L271: .string "iawubewmcvhwm"
+L272: .string "gyjvnrwsfkvfmtzhpayifa"
+L273: .string "trh"
+red r1
+L274: .data 505, -344, 591, 257, -241, -309
+L275: add #208, *r1
+L276: .data 681, 193, -801, -353
+L277: .data 956
+L278: .string "ojomdpfmujfftppmrcoalp"
+L279: clr L1
+L280: .string "sjfufwepwyorkqlawfiq"
+L281: red *r3
+L282: .string "mpsrczqcxkchntlpp"
+L283: .string "okycz"
+stop
+L284: .string "zjnwbolsqohzbe"
+jsr *r4
+
+L285: .string "cnjoecfuqxrrm"
+L286: .data -806, 547, -832, 17, -207, -704, 135
+lea L294, L295
+L287: .string "xro"
+bne *r3
+L288: rts
+stop
+L289: .string "mdrayqtplvwpyixmmbjjn"
+L290: .data -138, 661, 625, 637, 852, 230
+rts
+mov *r0, r4
+jmp L109
+L291: .string "ivdax"
+L292: .data -202, -99, 574, -601, 443, 779, 243
+L293: .string "agjgdjoikgeihmfgswrq"
+L294: .data -66, 259, -340, 426, 655
+L295: .string "etlrwjiflirrcgh"
+lea L180, L319
+stop
+L296: .string "azp"
+sub #246, r4
+L297: .string "yinkws"
+L298: .data 453, 887, 353, 540
+L299: .string "qznvgf"
+L300: .data -886, 270, 514, -684, 287
+L301: .string "xqbkewyjllvp"
+L302: .data 192, -348, 964
+L303: .string "kcelshddbxqxbtoklbtz"
+L304: .string "vlbdyazdzxgywvxeo"
+sub r3, *r0
+L305: .string "kptzbky"
+L306: .string "pr"
+stop
+cmp L318, #-125
+L307: .string "reojtnsignxfvpdxfemn"
+clr L308
+lea L318, L324
+L308: .data 556
+L309: .data 568, 125, 545, 526, -986, 561
+L310: .data 904, 249, -343
+not r3
+rts
+L311: .string "qxelfohbslzpzzwouj"
+; comment
+L312: .data -919, -137, -805, 387
+L313: .string "hrumtsnkorvhxlvuxj"
+prn r2
+add r2, L316
+L314: .string "bfiglpgeydnyaavekzwwaoln"
+prn *r5
+L315: .string "ptmehfuwfxuyldxxqumbio"
+L316: .string "ryajagwcrmrwzzsqkwrbl"
+L317: .data -909, 978
+; comment
+L318: jsr L278
+L319: .string "wtroyh"
+L320: .string "tfnddvocetqqursqua"
+L321: .string "ykhpha"
+clr *r1
+L322: bne *r2
+jmp *r4
+L323: .string "szhaocqwfbvmjgpsybn"
+not *r6
+L324: .string "hwysfsopdevdgauo"
+L325: .string "srwi"
+L326: .data 523
+stop
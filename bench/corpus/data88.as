@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 89
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+L0: .data -707, -552, -667, -863, 671, 461
+sub r1, *r0
+L1: .data 176, -545, 251, -303
+L2: rts
+sub *r4, *r5
+inc *r3
+L3: .data 303, -890, 1, -340, 617, 360, -759, 485
+; comment
+bne *r1
+inc *r7
+inc r2
+L4: .data 458, -895, 964, -432, 318, -91, -395
+L5: .string "yjpvynexsbq"
+bne L2
+red r4
+L6: .data -446, -946, -382, -5, 206, 513, 656, 806
+L7: .string "ftjizn"
+L8: .string "zmqkeoqlhexatdq"
+L9: .string "crnwvnufgcicyok"
+L10: .data -858, -189
+L11: .string "efahbzhzbxfyov"
+dec *r1
+L12: .string "kqvhqvvprksjjdyyl"
+L13: .data -690, -979, -625, 705, -625, 223, -474, -124
+L14: .data 14, -232, -355, -57, -472
+L15: .data 284, -512, -205, 93
+jmp L7
+L16: .data -214
+sub L288, *r2
+add r5, *r5
+L17: .string "tjljdtdb"
+L18: dec r4
+L19: jmp *r0
+L20: .data 12, 498, -796, -89
+L21: red L9
+L22: .data -586, -213, 871
+L23: .string "zliwxbgjhopmojmessq"
+L24: .string "kgwyrfmaxpfnndlzfl"
+L25: .data -367, 636, 535, 620, -105
+L26: .data 800, 700, 914, 257
+L27: .data -425, -142
+lea L37, L295
+L28: .data 227, 465
+L29: .string "tnhsvjovutlxiqvrrzydmhgs"
+L30: .data -372, 84, 43, 668
+L31: .string "dnygyaqaiucld"
+dec L205
+L32: .string "oojyhihumqlkmglgushd"
+L33: jsr *r2
+red *r5
+clr *r0
+bne *r7
+lea L33, *r3
+add r5, r7
+
+L34: .data -759
+lea L164, r3
+
+L35: .data 297, -749, -314
+L36: .string "q"
+L37: .string "pefcwndbzsxkchmaaoqncbw"
+inc L78
+L38: .string "lxkemntgzjj"
+L39: .data 483, -969, -786, -952
+bne L202
+L40: .data 606, 333
+L41: .data 831, 486, -722, -450
+L42: .data -968, -689, -443, 414
+bne *r5
+L43: .string "wrphefajiejtboqkdcjet"
+L44: .data 137
+L45: .data -879, -382, -426, 326, 42, -650, -317
+L46: .data -926
+L47: .string "ta"
+not r6
+L48: .data -928
+mov r5, r7
+L49: .data -729, -976
+L50: clr L0
+mov #-215, r0
+L51: .data 636, -103, -545, 403
+dec r7
+L52: .data 189, 622, 990, -550, -695, 898, -638, 782
+dec r4
+red *r3
+mov #-111, *r6
+L53: rts
+L54: .string "e"
+not r2
+sub *r0, L73
+L55: jmp L55
+stop
+bne *r6
+L56: .string "vbnxfscovnm"
+L57: .data -980, -958, -800, -479, -659, 83
+L58: .string "ebgmiydwreacuvborjjjia"
+L59: .data 906, -388, -275, 285, -171
+L60: .data 944
+sub L132, *r2
+L61: .string "hummtcgutgg"
+L62: .data -20, -965, 590, 383, 443, 739, -890, -799
+L63: .string "d"
+inc *r5
+sub r1, L7
+L64: .data -664, 366, -743, 50
+L65: .string "fjcfran"
+L66: .data -219, -917, 999
+lea L43, *r4
+clr *r2
+L67: prn L132
+L68: .data -162, -431, 95, -846, -314, 732, 850, -843
+L69: .string "jioqqbbxcwbrxsk"
+L70: .data 301, 245, -7, 73, -270, 962, -320, -486
+L71: .string "bnlgwmwnsdxpfvjaqx"
+L72: add *r7, *r2
+dec L175
+L73: .string "aklfekspstvbvfqtp"
+L74: .data -897, -327, -776
+jmp *r0
+L75: .data -160
+
+
+L76: .data -34
+L77: .string "cjnctupbojgodyawbw"
+L78: .string "oduvaxpdelizcz"
+cmp #21, #-69
+L79: .data -477, -642, 146, 727, 171, 481
+L80: .data 422
+not *r6
+L81: .string "ofxpkklznnzpvzhwg"
+L82: .string "oorrlrczovwmujtfcac"
+L83: bne *r5
+L84: .data 691, 83, -730, 606, -79, 673, -35, 590
+; comment
+red L38
+L85: .data -859, 526, -89, -803, -844, 227, -835
+
+bne L85
+L86: .string "jppazmdwtfwr"
+rts
+L87: .data 741, 685, 956, 672, 606, 666, 172
+L88: .data 798, -973, -275, 645
+rts
+clr *r5
+L89: .string "wtqpaptqz"
+L90: .data 195, -506, 389, 120, -299, 950, -914
+L91: .string "bqcbycinextjjofa"
+L92: .data 175, -818
+L93: .data 325, 808, -305
+jsr L226
+L94: .data -715, -611, 127, 522, -141, -89, -175, -937
+L95: .data 356
+not L299
+L96: inc L42
+L97: .data 438
+rts
+sub L0, L12
+L98: .data 267, -137, -972
+prn *r6
+L99: lea L29, r5
+L100: .string "fahjvslamaclgnydp"
+L101: .string "uusymjdtxqlzr"
+prn *r0
+L102: .string "yaurebdpsrn"
+L103: .data -835
+L104: .string "z"
+L105: .data 991, -963, -365, -794, 609, -590, -895, 585
+L106: .string "xmuyrmqj"
+L107: .string "jhisirsninklmykvftr"
+L108: .data 942, -353, 633, 905, -970, 165, 342, 5
+L109: .string "vyfqpmrza"
+L110: .string "ykgsukefyhxecpai"
+L111: .data 455, 179, 522
+prn r1
+L112: .string "autpdalnxtuzhezlpx"
+L113: .data 199, -417, 189
+L114: .data 902, -281, -234, -699
+L115: .string "vgdubjcxlockywk"
+L116: .data -864, -406, 807
+red r7
+L117: .data -224, -60, -524, -464, 49, 787, 272, 580
+inc L94
+L118: .string "o"
+lea L184, r7
+L119: .data -691, -929, 881, -457
+L120: .string "ivznauivbvfu"
+cmp *r3, L124
+; comment
+L121: .string "lk"
+bne *r0
+L122: .string "jvvcevadb"
+L123: .string "ywjwgkzcsdcqvfnxmpdefhf"
+L124: .data -386, -732, 103, 988, 739, -153, 337
+L125: .data -352, 308, -925, -630, 355, -182
+L126: .data -612, -973, 42, -496
+bne L298
+L127: sub L237, L59
+not L93
+L128: .data 117
+sub L14, r7
+L129: .data 345, 20, 110, -637
+L130: .string "vvpdnofvtyif"
+
+L131: .data 591, -769, 353, -447, 884, -873, 990
+L132: .data 63, -50
+L133: .data -464, -81, 189, -525, -228
+stop
+L134: rts
+L135: mov *r7, *r3
+L136: .string "byyhnjmcdotcy"
+red r6
+rts
+inc L44
+
+L137: lea L33, *r2
+prn *r1
+L138: .data 778, -88
+mov L27, *r1
+L139: .string "todapzlizhl"
+rts
+lea L64, *r5
+prn L29
+jmp *r5
+L140: .data -87, 42, 338, 250, 286
+add r4, *r1
+dec L97
+L141: .string "afzqs"
+clr *r5
+L142: .string "ezupcokhiiuohlgkedclzmdx"
+L143: .data -391
+L144: .data -168, 498, 363, -373, -897, -821, 642, -402
+L145: .data 857, -463, -151, 527, 134
+L146: cmp *r7, L36
+L147: .string "zegljjhhodai"
+L148: .data 987, -260, 995, 454, -908, -230, 442, -113
+L149: .string "uptnvqj"
+L150: .string "qbldpyhgpmghceafhc"
+L151: .data 775, 107, 118, 730, 709, -675, -91
+inc *r2
+L152: .data 720, 805, 884, 678, -34, -7, -236
+L153: .string "agmsiyq"
+L154: .data 380, -271, -21
+L155: rts
+L156: .string "cppwnajzikwncjssbmdi"
+red L28
+L157: .data 706, 135
+jmp L117
+L158: .data 102, 108, -196, 962, -827, -162
+L159: not r7
+jsr *r0
+mov *r5, r6
+L160: .data -27, 842, -437, -180, 551, -15, -4, 308
+L161: .data -897
+L162: .string "dvktrkfpmppfqy"
+L163: stop
+L164: .string "sadxzcpllgicgaq"
+L165: .data 685, -968
+L166: .data 943, -764
+L167: .data 564, -339, -498, -91, -977
+L168: dec *r5
+; comment
+L169: .data 920, 270, -499, -419
+L170: .string "bnufufsfbpm"
+L171: .data -400, -332, 797, 978
+L172: .data 455, 846, -985, 155, 272
+L173: .string "hsyr"
+L174: .string "lijavpayvhvgytmhewiaet"
+jsr L303
+bne *r7
+L175: not r4
+bne L258
+inc *r1
+L176: .data -373
+dec *r3
+L177: .string "fwllgskrjmz"
+inc r2
+L178: .data -405
+jsr L280
+; comment
+L179: .data 611, 299, -557
+dec L257
+L180: .data -23
+clr r2
+L181: mov *r2, L222
+L182: cmp L221, r6
+L183: .data 349
+L184: .data 985, -657, -787, -144, -151, -909, 183, -384
+L185: add L109, L207
+L186: .data 398, 651, -989, 706, -800
+L187: .string "udyfwifzy"
+
+L188: .data 139, 433, -569, 402, 339, 249, -870
+L189: .data 700, -683
+L190: .string "gzmauqjkj"
+inc *r5
+inc L304
+L191: .data -844
+L192: not r0
+L193: .data -826, -857
+L194: .data 678, 42, -528, -466, 133, 662, 505, 253
+bne *r2
+L195: .data -723, 544, -193, 72, -35, 464, 400, -201
+L196: .data 139, -952, 353, -304, -84, -668, -252, 715
+L197: .data 338, 165, 682, 943, -531, -680, -594, 62
+L198: .data 722
+L199: .string "qdootc"
+L200: stop
+L201: .string "yf"
+L202: .data 158
+add r6, r2
+L203: .data -779, 329, -590, -28, 327, 468, -960, 38
+L204: .data 567, -530, 880, -12, 67, -913, -901, -825
+L205: .string "ecovdnrvlvauzsipfs"
+L206: .data -242, -503, 518, 204, -157, -356, 992
+not r2
+not L138
+L207: .data 273, -34, -747, -620
+jmp *r6
+L208: prn #-129
+lea L275, L214
+L209: .data 875, -174
+red L178
+L210: prn *r7
+L211: .data 957
+L212: .string "adwhtdghyycidxxa"
+jsr L277
+L213: .string "vblvrboy"
+L214: .data 859
+L215: .string "p"
+not r3
+L216: .data -38, 845, 592
+L217: .data -16, 477, -18, -434, 824, 882, 341, -209
+L218: .string "ffcxconltfuhrmoya"
+L219: mov *r7, L143
+bne L286
+L220: .string "dnnxfhdegidyw"
+L221: .string "fopamolcvzqureczbzykxuh"
+mov *r3, L146
+L222: .data 48, -486, -768, -576, -283, -250, -198, -11
+clr r0
+L223: .string "ddpydigixdmva"
+L224: sub #-254, L184
+clr r7
+L225: .string "lusrwyvaztra"
+add L293, r0
+dec *r0
+L226: .string "mbmnxdggkpxipihrdcy"
+L227: .data -44, -484, 848, 149, 73, -383
+L228: .string "h"
+cmp r5, #121
+jsr *r5
+L229: .string "msixsjzkadbvulkac"
+prn *r1
+lea L211, L262
+L230: .data 848, 470, 165, 105, 724, -441
+; comment
+L231: .string "ccwadkdgmmt"
+stop
+inc r5
+; comment
+L232: .data -118, 305, -106, -504, -51
+sub #-228, L305
+bne L88
+L233: .data -563, -194, 983
+L234: .data 933, -42, 585
+; comment
+L235: .string "ygumivnlbmp"
+inc r3
+prn r5
+clr r5
+L236: .data 958, 536, -987, -951
+inc r0
+L237: .string "mpmnfx"
+L238: .data -185, 122, -327, 760
+jmp *r5
+L239: .string "d"
+; comment
+L240: bne *r2
+inc L253
+L241: .string "nzxb"
+L242: .string "dulrbfehuqgcqplzwt"
+red *r1
+L243: .data -813, -344, 234, -926, -273, 265
+L244: .data -323, 87, -100
+L245: .data -94, -835, -835, 422, 486, -729, 293, -663
+inc *r7
+L246: dec r7
+L247: .string "hmzyhnctoi"
+inc r7
+mov L304, *r4
+L248: .string "eusaypactjbwxxcc"
+L249: .string "jlabhyqyhpbumgedejwmo"
+L250: .string "dgmkyddbwqgazywwoegy"
+L251: .string "vakdb"
+L252: red r6
+L253: .string "gkzcuufwp"
+jmp *r1
+jsr L201
+L254: red *r6
+cmp r3, #-248
+sub #132, L102
+L255: .data -473, -496, 508, -332
+lea L228, *r7
+L256: .data 167, -927, -424, 907, -605, -393
+mov L286, L302
+L257: .string "mtdtlvgbopnekjxetb"
+jmp L307
+jsr L135
+L258: .string "bcopmsulmvpazz"
+rts
+red *r1
+L259: .data 54, 872
+sub r2, *r1
+L260: .data -313, -131, -620, -621, -757, 716, 180
+L261: rts
+jsr L284
+L262: .string "kjxut"
+L263: .string "knrsonxubtdr"
+jmp *r0
+L264: .data -466, -580, 242
+stop
+L265: .data 607, 20, -281, -499, 513, 458, 311, 932
+L266: .data 449, 664, 971
+L267: .string "wbpabacr"
+add L285, *r6
+clr r1
+cmp *r4, L3
+add L184, r1
+lea L304, r2
+L268: .data -298, -912, -197, 749
+cmp r0, *r5
+L269: .data -766, 632, 116, -603, 982, 772, 64
+L270: .string "rwizkz"
+L271: .data -340, -84
+rts
+lea L307, L303
+L272: .string "jqdriwybrqhqcsrfotzkx"
+L273: .data -65, -625, 847, 904, 22, 853
+L274: .data 143
+L275: .data 813, -568, -111, 102
+L276: mov #-132, L63
+L277: .data 819
+L278: .data -326
+L279: .string "hkpcbdrhgk"
+L280: .data -91, -421
+L281: .data 786, -372, -991, 217, -63
+L282: .string "l"
+inc r6
+jmp L136
+L283: .data 990, -744
+mov #65, L38
+L284: .string "wsqyfd"
+L285: .data -326, 19, 518, 56
+L286: .string "buybkcmsyhmmuldvkzipor"
+red *r7
+L287: .data -505, 46, 280, -480, -665, 799, 472
+; comment
+clr L197
+L288: .data -431, -588, -977, 310, 219, -876
+L289: .string "utidxbzammapviheustlzu"
+L290: .data 257, 508
+sub #166, r0
+lea L299, *r5
+rts
+rts
+L291: .string "emyqwodrkuxbuetntyzwwiao"
+rts
+L292: .data 521, 117
+not *r6
+L293: .string "ohpg"
+stop
+L294: .string "bncs"
+L295: jsr L111
+L296: .data -922, -291, -903, 551, -790, 451, -528
+
+jmp L24
+rts
+prn #87
+prn *r2
+L297: mov L303, r4
+inc *r1
+L298: .data 760, -687, 107, -950, 769
+inc L301
+L299: .string "odvxfmeubhaicbwcedlt"
+L300: .data 586, 25
+jmp *r3
+sub *r5, L277
+clr r6
+L301: .data 421, -710, -107, -492, 223
+L302: .string "vcalcbwaaughzmj"
+L303: .string "mrcqgmtfsiflohcc"
+L304: .data 255, 915, 289, -497, 622, 530
+jsr *r3
+L305: .data -732, -715, -41, -792
+L306: .data 589, -763, -852, -831, 825, -215, -466
+inc r6
+L307: .string "xuujngxkdlpmafkoq"
+L308: .string "ahicwzglj"
+cmp L260, r0
+cmp L27, r5
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 90
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .data 48, 259, -166, 284, 758, -353
+L1: .data -650, -425, 765
+prn L158
+bne *r0
+lea L185, r5
+L2: .data 832, 554, -473, 703, -655, 762
+L3: .string "bgvtyfutekeue"
+L4: .string "ejshlxclvujmrpr"
+
+L5: .data -40
+; comment
+inc L136
+L6: .data -482, 99, 849
+add #167, *r5
+L7: dec L2
+L8: .string "gezqvoiyyzqmjmgecogmdjbh"
+prn #-180
+L9: .string "hxilzlgs"
+L10: .string "mrywdljfoxlduu"
+clr *r4
+mov *r0, L2
+L11: .string "crtnkcbaabwpvdze"
+
+stop
+mov L10, *r6
+L12: .data -952, -701, -35, -240, 408, 577, 645
+L13: .data 366, -798, -977, -847, -9
+rts
+jmp L315
+L14: .data 239, 706, -501, 105, 967
+L15: rts
+L16: .string "lorkzbdtjpiqgijrwyeps"
+L17: .data -207, -864, 80, 124, -425
+L18: .string "wcibsyzgkrsauqhkfegwih"
+add L6, r1
+L19: .string "ilgqntsdhmgamgztolatnwwa"
+
+L20: stop
+lea L10, *r3
+
+L21: .string "q"
+L22: .string "soaccbrpevwhbsyxfirzro"
+dec r7
+clr r3
+L23: .string "bsichwj"
+L24: .string "cw"
+L25: .string "b"
+L26: red L54
+L27: .string "rrakwgvznceuopkerupc"
+L28: .string "qkfdwbnkbnf"
+L29: .data -470
+not r2
+L30: .data 59, 485, 287
+red *r7
+L31: .string "ctzinqpzl"
+L32: .string "rrcuh"
+L33: .string "qngqbvdezxfvawpzgujsf"
+L34: .string "ffheozixdgep"
+L35: .string "oiscnsaxbivqkd"
+L36: .string "zfvdpi"
+L37: .string "jiypvleefomnbuy"
+L38: .data 234, 597, 59, -46, -348
+L39: .data 722, 30, 821, -892, 320
+L40: .data -944, -910, -522, -168, -2, 914, 735
+L41: .string "oey"
+L42: .string "ijiwzbtgbhyiu"
+jsr *r2
+L43: .data -805, 724, 776, -521, -912, 862
+L44: .string "mxqaxaqtfgg"
+L45: mov r3, r0
+lea L27, L29
+clr L23
+L46: .data -544, 126
+L47: .string "gjabgwhe"
+L48: .data 669, 30, 640, 272, 726, 216
+L49: .data 179, 82, -134, -395, -674
+lea L127, *r5
+L50: .string "qoyfjthrtkc"
+L51: .data -606, -846, -584, -54, 355, 652, 775
+L52: .string "mtammqpxrpxi"
+L53: .string "uhethaxsnukqbtsg"
+cmp *r2, L84
+dec L215
+L54: .data 551
+L55: mov *r3, L22
+sub L106, *r3
+red r0
+add L13, r4
+jmp L96
+L56: .string "wfnbjtxbun"
+; comment
+L57: .string "fteznzqahwnifpesztn"
+L58: .string "dyyxzuaklkjjyt"
+L59: .data 924, -767, -941, 556
+L60: .data -914, -96, -822, -400, 851, 276, -735
+L61: .string "jekecuihvm"
+rts
+L62: .string "psjdocxbvseqvtmekmunuys"
+L63: .data -861, -862, 593, -810, -481, -917
+jsr *r4
+L64: clr L142
+; comment
+L65: stop
+L66: .string "xzwhbyi"
+lea L173, r1
+L67: .string "adck"
+L68: .data -619, -782, -342, -283, 20
+L69: .string "ddhvb"
+L70: red r6
+stop
+L71: .data -919, 987, -557, 728, 344, 662, -56
+inc r3
+L72: .data -333, 605, 526, 387, 551
+L73: .data -541, -427, 29, -465
+L74: .data 627, -574, -473, 411
+L75: lea L89, L299
+; comment
+mov *r1, *r4
+; comment
+jmp L71
+add *r1, *r3
+clr L5
+jsr L7
+L76: .string "vtuoyqkhkbxiortcegogquw"
+bne L102
+L77: red r0
+prn #-157
+; comment
+lea L179, L107
+L78: .string "mcjlm"
+L79: .string "d"
+clr *r3
+L80: .data -419, 664, -428, -264, 625
+L81: .data 62, -431, -826, 937, 339, -10, -651, 652
+L82: .string "pkvlwppbuivnlpaur"
+L83: .string "dnqznltgyangxmzwccgc"
+L84: .data 212, -391, 128, -549
+red L264
+
+L85: stop
+L86: .data -114, -828, -385, -271, 715, -931, 193, -496
+L87: cmp *r6, r2
+stop
+L88: .string "e"
+L89: not *r0
+sub *r6, r2
+L90: .data -543, 819
+L91: .string "jepugmsmoiptlshsjgqay"
+L92: .data 701, 181, -643, 742, -597, -248
+L93: .data 814, 665, -268, 182, -677, 500, 258
+L94: .string "ycw"
+L95: .string "fltw"
+L96: .string "zuhtgboolmktcaeukpofleg"
+L97: .data -994, -585, 711, 1, 183
+L98: stop
+clr L293
+L99: .string "nrxyvs"
+prn L193
+mov r3, *r2
+add r2, r4
+L100: red L93
+L101: .data -712, -313, 561, -160
+L102: .string "kgecbjrjdfel"
+L103: .data -947, 858, 902
+L104: .data 205, -470, -930, 209, 989, 491
+L105: .string "guyosbmbrodzjokaiqifm"
+L106: .data -905, 359, 487, 685, -993
+L107: .data 675, -977
+L108: .string "qjpdsdqmmzoqid"
+L109: .data 740, 902
+L110: .string "jnzeldhuev"
+clr L288
+L111: .data -427, 694
+L112: .string "flsjywmwgockneurlzq"
+L113: .data 397, 782, 439, -617, -180, -709, -111
+L114: .data 929, -151, -693, -625
+L115: .data 134, 728, 131, -127, 191
+stop
+L116: .string "nlimrrg"
+L117: .data -10, 803, -260, 541, 707, 74
+
+L118: .data -376, -620
+L119: .string "yuxayuxvdokdikcxi"
+not L34
+L120: inc *r4
+L121: .string "ugrzsuuezzptmekvisgjia"
+L122: .data -713, -612, 31, 100, 690, 343, -132
+L123: .string "kloq"
+L124: .string "taxnbqhqjaafpxut"
+L125: jmp *r4
+L126: .data 364, 685, 831, -884, -327
+L127: .data 750, -873, -417
+L128: .string "rjvzvufpnjrakgvgq"
+L129: .string "efznixqnxvsr"
+L130: .string "hugopojfdketihwbkghumtg"
+lea L16, *r1
+L131: stop
+prn r7
+L132: .data -37, 182
+L133: .string "sertazzott"
+lea L171, L317
+L134: .string "mqhsvtgegmsqhtznirq"
+L135: .data -379, -226, 529, 646, 263, -476
+lea L219, r5
+red L55
+L136: .data 590, -356, -935, -505, 690
+clr L294
+; comment
+L137: .data -492, 560, -980, 954
+L138: .data -570, 262, 85, 892, -3, -236, -452
+dec r0
+L139: .data -902, 500
+rts
+L140: .string "l"
+; comment
+; comment
+L141: .data -860, 338
+L142: .data 228
+L143: .string "uxmwoeidcuybmbmg"
+L144: .data 219, 732, -304, 660
+L145: .string "saeyccud"
+L146: .string "xaibxmnkgh"
+L147: .data -584, 974
+add #170, L294
+L148: .data -849, 570, -876
+jsr L54
+red L79
+clr r7
+L149: .data -568
+L150: .data 24, -610, 802, -545, -662, 379, 16
+jsr L164
+
+; comment
+L151: .string "scgn"
+stop
+L152: jsr *r5
+L153: lea L1, L173
+L154: .string "fnlsydgnadyycukzv"
+L155: .string "zcghxuxi"
+L156: .data 459, 913, 786, -753, -585, 383, 416, -591
+L157: red L92
+
+L158: .string "kuwr"
+rts
+sub #-211, r4
+dec r6
+add r1, *r2
+L159: .string "lpnmhbw"
+stop
+L160: .string "bfhrzahuajkkpiqrdt"
+L161: .string "pfy"
+L162: .data 351, 934, -539, -992, -393, 301
+L163: .string "lbnynofg"
+L164: lea L37, r6
+L165: .string "bjtwhckojn"
+L166: .string "vhecv"
+L167: .string "rupyanpbrjaqtafsypegqiib"
+
+L168: .data 995, -624, 277, 670, -61
+L169: .data 366, -779
+L170: .data 828, -498, -869, -177, 617, 109
+L171: .data 801
+L172: .data 977
+L173: .string "nglazggczkqyxaqnsvcljcej"
+L174: rts
+dec L86
+lea L256, r0
+L175: .data 518, 656, -701, 832
+L176: .data 314
+L177: .data -382
+L178: .string "cn"
+L179: .string "wljtkfnqebieg"
+L180: .string "alamkvrgoyozxenmav"
+L181: .string "atwfsuibcpu"
+L182: prn *r6
+L183: add #-18, L12
+L184: .data 436, 275, -562, 767
+L185: .string "abisuzhwy"
+L186: .string "qoraafex"
+L187: .string "ylksrbrwiwxjgl"
+sub L306, r6
+cmp L218, #-131
+not *r4
+jsr *r7
+L188: .string "tfbdqb"
+L189: .string "ozduawkrlowbs"
+L190: .data -266, -453, -647, -344
+L191: .data -328
+L192: .data -871, -231, 343, -743, 674, -773, -522
+jmp L95
+L193: .data -608, -844, 882, -576, -636, 84, -710
+L194: .data 786, -261, 685, -492, -169
+L195: jsr *r0
+L196: .string "rglzstor"
+not L157
+L197: .data 892, -954, -642, -85, 60, 110
+dec *r0
+L198: .data -347, 70
+sub #-11, r6
+jmp *r2
+L199: .data 341, 970, -905
+L200: .data 979, 572, -165, -729, -35, -612, -869
+L201: .string "zz"
+not r1
+L202: .data -804, -205
+L203: .string "qlqhwpxpucnhkxwrpdlclooz"
+add *r1, L188
+L204: .string "ntdlulrd"
+add L244, L261
+L205: .string "xdmgwkzofpeobhoqkqcjjyf"
+L206: .string "pqlpog"
+dec L290
+L207: add #-26, *r2
+L208: .data -69, -540, 789, 891, 395, -485
+L209: .string "epcycycwuwthbsq"
+L210: .data 44, 31, -270, 295, -601, 189
+L211: .string "znnwnil"
+L212: stop
+L213: clr *r2
+; comment
+not r6
+mov L17, r3
+not r5
+L214: .string "xl"
+L215: .data 457, -88, -115, 150, 238
+lea L195, r1
+dec r1
+L216: .string "ri"
+L217: .data 801, 84, -395, -262, -222, -940
+L218: red L200
+L219: .string "xaavybd"
+L220: .string "cufcieoazjjtqlkg"
+bne *r1
+L221: .data -629, 220, 666, -320, -834, -481, -605
+
+L222: .string "zgzxysolwslkhhyf"
+L223: .string "nwrszremxlhix"
+L224: .string "oigvckebv"
+L225: .data -519, 81, 869, -373, 441
+L226: sub L281, r3
+L227: .string "sjimyhvxmeqkogp"
+jmp *r0
+L228: .string "ejsoslnitaxvubvmwbdi"
+L229: lea L125, *r0
+L230: .string "dpqtrcfwfrpfeujjrsnh"
+; comment
+
+L231: .string "kylgvzk"
+L232: .string "eirezynaaxegbcy"
+L233: .string "majgpttrdcbtrseqsw"
+L234: .string "nv"
+L235: stop
+L236: .string "bheengduqjqypkdbetqjsch"
+L237: .string "gefkenxlmwpsctu"
+L238: .data -112, 386
+clr r7
+L239: .data 106, 388, -881, 930, 418, 484, 376
+L240: .string "c"
+L241: .string "krqbxy"
+L242: .data -426, 986, 921, -439
+red L25
+L243: .string "fktfcu"
+jsr *r3
+L244: .data 636, 551, 813
+L245: .string "xfjyaqtvhhiwstgiqlgsuqwm"
+L246: .data 478, -811, -920
+cmp r2, #18
+cmp #-139, *r0
+cmp *r6, r1
+L247: .string "sqbpnfhto"
+
+L248: .data 206, -495, 733, 14, 948, 53
+L249: .string "lszbgvquqt"
+L250: .string "akjmiyiwewmpcqynpavztvrb"
+dec L271
+L251: .string "bxtvytvlgrjp"
+inc L212
+L252: .string "w"
+L253: .string "iv"
+dec L278
+L254: .string "wpjbwxfabxhgocfwziabitm"
+mov *r1, r7
+; comment
+L255: .string "jztzfsmmlhpxqfhvbokfbrr"
+mov r2, *r2
+lea L130, r4
+bne L315
+L256: .data -942
+; comment
+; comment
+stop
+L257: .data -85, 592, -451, -981, -37, 58, 855, -530
+L258: .string "vwignowdtcm"
+L259: .string "dpcpwvcj"
+add *r6, r7
+clr *r3
+stop
+bne L307
+L260: .data -789
+L261: .string "udkgmnv"
+L262: .data -497, -196, -218, 232, -100, -861, 119, -979
+L263: .data -793, 990, -942
+L264: .string "tkstdwowugtklxraoqxsjk"
+L265: .data 742, 842, -907, 932, 701
+add *r3, *r1
+inc r6
+L266: .string "lhpfqjdkganzrclvofpvjc"
+lea L289, *r4
+L267: .data 474, -605, 366, 568, -293, 288, -588
+L268: .data -175, 286, 103, 169, -24, 160, -152
+clr L40
+L269: dec *r6
+L270: .data -981
+L271: .string "qr"
+dec L288
+; comment
+L272: .data -532, -317, 909
+L273: .string "hverzjiovdzznoedzqjqlo"
+L274: .data -812, -109, 363, 453, 130
+L275: .string "oldtaremboybq"
+inc *r3
+L276: bne L242
+L277: .data -696, 328
+L278: .string "hjdqzhmitzvoaiwrlvdams"
+L279: .string "tspj"
+lea L314, L185
+L280: jsr *r0
+L281: .string "bujuslvkwuulrnf"
+L282: .string "pqaglodssxxgk"
+L283: .data 498, 218, 379, 504, 149, 887, -205
+L284: .string "jgqtghtqfahozsmo"
+L285: rts
+L286: .string "n"
+red L306
+L287: .data 242, 83, 243, 368, -68, 665
+L288: .string "rkqxbtuqz"
+L289: .string "ovgbzbjhsalz"
+
+L290: .data -485, 252, 486, 450, 294, -954, -876, 40
+L291: .data -333, -168, -362, -473, 929, -880, 891, -917
+L292: .data -241, -976, -571, 595, -104, -470, 762, 260
+L293: .string "wzcbebrvqjucgnepklhkl"
+L294: .data 505
+L295: .string "qwod"
+L296: sub L311, L28
+L297: .string "wowshcskrrwiavgxqwlgd"
+; comment
+L298: .data -585, -573, 368, -780, 827
+L299: .data -584, -685, 437
+dec L226
+L300: .string "rkqlxdbfalaemmhqugjuitx"
+L301: .string "lapd"
+L302: .data 727
+add #34, *r0
+; comment
+; comment
+inc L183
+stop
+mov #13, r6
+L303: .data 20, 367, 281
+L304: .string "obcacmawsjerg"
+dec *r4
+cmp r2, #176
+L305: .string "vqsetkmpisuyjne"
+L306: lea L323, r3
+not r6
+clr L210
+L307: .data 542, 82, 556
+L308: .data -388, -794
+; comment
+L309: .string "safer"
+L310: .data 229, -423, -177, -880
+mov L249, r1
+stop
+mov *r6, r3
+not L324
+L311: .data -758, 374, 832, -197
+L312: .data 251, -214, 754, 169, -934, 323, 461
+L313: .data -976, -681, 736, -179
+L314: .string "hhzmdrxoqsehmbmhscau"
+L315: .string "lszvmjzkgmygihzeugsqoyt"
+L316: .data -936, 858
+L317: dec r7
+L318: .string "hnwpxqyrxsfzwtmwhyya"
+rts
+L319: .string "pq"
+L320: rts
+sub L325, L323
+rts
+L321: .string "csyljbxoplpjkwismulxf"
+mov L220, r6
+L322: .string "exfdfkqprx"
+rts
+L323: .data -395, -541, -734, -376, -502
+not *r2
+jmp *r3
+L324: .string "ytayllwz"
+prn #98
+L325: .string "xkzcvd"
+L326: .string "snxpnvunhzsaa"
+stop
@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 10
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+L0: .string "xvz"
+mov L268, L77
+L1: .data 437, -255, -407, 998, 938, 195, -54, 525
+rts
+L2: .string "hbjkbtlrbuzo"
+L3: .string "hpevyop"
+L4: .string "ytm"
+cmp r7, #-33
+not L146
+L5: .data -503, -427, 766, 46, 966, 919, 824
+L6: .data 167, 486, -155, -946, -351, 218
+L7: .string "zlszzirjpoccgkprpnpigg"
+L8: .data -917
+
+rts
+L9: .string "hjoqrlobck"
+L10: .string "dgkphvhxlutehczzxbptehp"
+L11: .string "sex"
+not L309
+lea L228, *r4
+stop
+L12: .string "kuxsvunutoabyrxlrqjginzy"
+mov #9, L6
+not r3
+red *r3
+L13: .data 291, 138, -796, 715, 669
+prn L114
+inc L13
+jmp *r5
+dec L75
+lea L13, *r1
+rts
+L14: .data 673, -24
+L15: .string "lverszcobzmx"
+
+L16: .string "dgimw"
+L17: .string "lxftykiv"
+L18: .string "gybqzcborpgajrsezxht"
+stop
+; comment
+jmp L55
+L19: .data 972, -816
+L20: jmp L221
+L21: .data -191, -386, -316, 558, -380
+L22: .string "yeoolq"
+jmp *r6
+L23: .string "afivzdhtjuv"
+jmp L3
+cmp L9, L241
+L24: .string "byrlrf"
+lea L15, r4
+L25: .string "lcq"
+L26: .string "ug"
+L27: .string "ocy"
+L28: .data -628, -196
+L29: .string "yqtllhuaplliyvhsnfnkm"
+L30: .data -260, -330, 23, 310
+L31: .string "dexttokvotdqtzkh"
+sub #-19, *r5
+cmp #180, L305
+L32: .data 67
+L33: .data -292, 391, 188, -603
+
+L34: .data 811, 709, 628, -865
+rts
+stop
+not *r1
+inc r7
+L35: .data -656, -668, 262, 380
+cmp L14, r6
+L36: .data -450, 791, -687, -41
+
+L37: .data -612, 290, -6, -685, -726
+prn r4
+L38: .data 546, 596, 823, 100, 279, -719
+L39: .string "haqfiw"
+L40: .data -278
+L41: .data 408, -71, 846, 335, -676, -577
+; comment
+L42: .data 480, 757
+L43: .string "fcxeyzgyylryygrxjm"
+L44: .string "dgbxcykuqnkouattorzmabr"
+dec *r2
+L45: .data 19, -29, 344, 949, 169
+L46: .string "cnmatpfnzzwbhfw"
+L47: mov *r4, r3
+L48: .data -609, -961, 775, 894, 338, 553, 918, 704
+L49: jsr *r1
+dec L148
+L50: .data 414, 278
+L51: .string "zkioblgbzc"
+not *r5
+L52: .data 733
+bne L61
+L53: .string "mwfekehhdytvfnm"
+L54: .data 987
+L55: .data -522, -722, 431, 817, -141, 922
+L56: .string "drvxoxvmxzpqhjgsrf"
+add #-183, *r7
+L57: .string "oppvrgr"
+; comment
+L58: .string "nmoylljkyiewqjzfyccatgsw"
+L59: .data -627, 242, 667, 543, 823
+L60: .string "kfsbvlwgknflghnl"
+red r3
+lea L56, r0
+L61: prn *r5
+L62: .data -641
+red L185
+red L261
+L63: .data 510, 926
+; comment
+L64: .string "bhctgc"
+inc L20
+L65: .data 161, -786, 315
+L66: .string "wnjcvjqluloptgnmtu"
+L67: .string "zwgdvmublitpdwaqdhrpotvg"
+; comment
+L68: .data 940, 355, -422
+L69: .string "rbhkcdofe"
+L70: .string "efsscdkhgvqaljdkjcvoe"
+L71: .string "ebatehgbfimvqdfq"
+L72: .data 834, 207, -752, 604, 446
+L73: mov r3, L225
+L74: stop
+L75: add *r4, L48
+L76: .data 93, 415
+L77: .string "wuloeqcibsgoooizivcszfdx"
+L78: .data -304, 682, -278, 725, 669, -22, -112, -106
+; comment
+L79: .data -814, 475, -619, -562, -236
+jsr *r3
+jsr *r0
+L80: .data 647, -506, -252, 392, 886, 222
+L81: .string "hvvvvzuyalcunxydoxt"
+L82: .string "gafelwytxswbzdnabztdkmer"
+rts
+rts
+L83: .data 141, -875
+L84: .data -358, -250, 649, -582, -279, 168, 111
+L85: .string "wwhjwjcyplrzotupiuylxxom"
+L86: .string "inkymupzgbkccvhc"
+stop
+L87: .string "nme"
+stop
+dec r5
+; comment
+L88: .string "rhvijjcswgwfovvo"
+rts
+L89: .string "vyzinle"
+dec r2
+L90: .data -607, 744
+L91: red *r1
+rts
+L92: .string "tgnkroya"
+L93: .data 205, -103
+L94: .string "ycyxsbfwuicscawhvrjhlqgt"
+L95: .data 428, -873, 687, -627
+L96: .data -640, 517, -285, 925
+add L183, *r6
+jsr L74
+L97: .string "jifmnjmxhj"
+L98: .data 856, 766, -238, -31, -58, -451, -783
+
+L99: .data 462, 111, -691, 403, 211
+L100: .string "rkach"
+L101: .data -35, 844, 943, -960, -864, -295
+L102: .data 288, -751, -741, 637, 891, 713, 342
+L103: .string "vlrqzsivflkweieduns"
+sub #-216, r3
+L104: .data 269, 829, -18
+L105: .string "hrdocagcaskyrw"
+L106: .data -982, 488, -73
+; comment
+L107: .data -416, 705, -91, 234, 181, -978
+L108: .string "vq"
+red L178
+L109: .string "tirtdvbamnslzafohwlmsx"
+mov *r0, L152
+L110: .string "p"
+L111: .data 409, -174, -635, -116, 153, 192, 822
+L112: .data -166
+L113: .data -337
+L114: .string "rsf"
+clr *r5
+rts
+L115: prn r7
+L116: .string "lyxwgfokoqnggi"
+L117: .data -110, -534, -145, -672, 110
+L118: .data -419, 832, 667, -818
+not r5
+L119: .string "vhptlnmduiuwcxaivydhhdx"
+add L273, r7
+L120: .string "ipagy"
+L121: .string "wgdgweevxihlcofjogufnwr"
+L122: .string "aptzvmcoarz"
+L123: .data 395, -303
+L124: .data -385, -629, -477, 667, 695
+L125: .data 362, -621, 904
+L126: .string "qpyjcj"
+L127: .string "qqeakrqzmgqrpmlrfp"
+L128: .data 488, 745, 704, 161, 130, 168, 280, 657
+L129: .string "izqggnadnmyogzbhm"
+inc L23
+; comment
+L130: stop
+L131: .data -373, -860
+L132: .string "saknqfpncbfsddhqhwjvsiqc"
+L133: red r1
+L134: .string "kedfjezeektqtbyrezgxqvu"
+L135: .string "kgkq"
+L136: .data -471, -517, 936, 900, 73, 214
+L137: .string "jzxzoffxczdbmbkjawrdknpl"
+L138: .data -542, 151, -113, 817, 289, 327, -25, 714
+not r0
+rts
+L139: .string "asgjlkxx"
+rts
+stop
+L140: not L119
+stop
+L141: .string "i"
+jmp L102
+L142: .data -476, 793, -126, 632, -34, -831, 654, -902
+L143: .data -627, 616, 369, 407
+L144: .data 491, 809, -362, 881, -221, -443, 596, 311
+bne *r2
+L145: .data -131, 615, 682, -633, 823, -160, -846
+mov *r2, r5
+L146: .string "k"
+lea L163, L247
+lea L74, L230
+not L191
+L147: .data 677, -595, 531, -195
+L148: red r3
+L149: .string "cwtpdkmn"
+lea L158, r7
+not *r0
+bne L175
+bne *r2
+
+L150: .data 369, 15, 273, -690
+bne L136
+not L48
+L151: .data -744, 906
+L152: .data 293, -729, -967, -747, 539
+L153: .data 505, 654, 240, 495, 821, 964, 335
+L154: .string "fkzmx"
+not *r3
+lea L133, r3
+inc L285
+L155: cmp #-143, L33
+L156: jsr L219
+mov L64, r6
+
+L157: jmp *r5
+inc L241
+cmp L261, #-11
+lea L244, L295
+L158: .data 123
+
+L159: .data -922, -20, 159, -59
+prn #171
+L160: rts
+L161: .string "ehnyxbftkuqzizcu"
+mov r7, *r1
+L162: .data -995, 71, -958
+rts
+cmp *r4, *r4
+sub L109, L273
+red *r6
+L163: .data 851, 388, 428, -56, -472, 122, 673
+L164: .data 274, -405, -855, 960, -359, -449, -539
+L165: stop
+L166: .data -521, -594, -120, 379, 522, 878
+clr L3
+L167: .data 309, 324, -236, 6
+lea L98, L245
+L168: .string "qihej"
+L169: .string "ihqohtvsokzrqkkgrp"
+L170: .data 527, 227, 856, 726, -800
+L171: .string "fvmigrobiffqwrazhl"
+L172: .string "gfelg"
+sub r4, r3
+mov L231, *r2
+L173: .string "rujnlettofcrjup"
+L174: .data 332, -751, 400, 23
+rts
+rts
+L175: .data 420, 649, -87, 858, 305, 702, -564
+; comment
+dec L90
+L176: .data 50, -760
+clr L164
+L177: .string "yitshanyfdt"
+L178: .data -195, 645, -590, -391, -599, 33, -928, -17
+L179: sub r6, *r7
+L180: .string "jstbncqqqfjanehdran"
+L181: .string "mdrzvlvoholzpirdalqpidx"
+L182: .string "rlnx"
+mov L251, *r7
+L183: .string "agvywanipquexkqh"
+L184: .string "ztmxjpenuzrsbdzepdmqdew"
+L185: .data -521, -689, -932, 688
+L186: dec *r6
+L187: .string "zybqfwcgvefdrwumfjyqmg"
+L188: .data -859
+not *r6
+; comment
+L189: .data -630, -904, 883, -640
+
+L190: .data 790, 539, -459, -748
+lea L234, *r5
+stop
+lea L65, *r7
+L191: .data 304, -144, 814, 410
+cmp *r0, #155
+prn r6
+L192: .data -324, -70, -121, 597, -703, -754
+red r0
+L193: lea L299, L40
+L194: .data 392, 441
+L195: .string "pzbdmkqjajtzdknhnsu"
+L196: .string "ysvii"
+L197: .string "sze"
+L198: .data 146, 413, -694, 413, -644, 75, 408, 527
+mov L140, r4
+L199: .data 858, 269, -663, -48, 310
+L200: .data 324, -508, 893
+L201: .data 456, 198, -42, 441, 992, -241
+sub *r0, *r5
+rts
+L202: .string "nuvks"
+L203: bne L58
+L204: .string "qxkuedsrzfg"
+jmp L146
+L205: .string "thamlefajyaq"
+L206: .data -23, -914, -896, 882, -441, -521
+L207: .string "drpynyzuhlutf"
+L208: stop
+L209: red r5
+L210: .data -188, -733, 259, 785, 354
+L211: .string "c"
+bne L55
+L212: .data -700, 56, 780
+L213: .string "ncotkejpqlnmrrvcivf"
+L214: .data -279, -671, -503, -469, -297, 284, -237
+lea L237, r3
+L215: .string "orpjaofohkdsmczjcpuanb"
+L216: .data 861, 87, 169, -928, 380, 134, 66, 773
+rts
+L217: .data 634, -595, -594, 708, -392, -834, 94
+dec r0
+L218: .data 215, -258, 19, -349, 301, -358, -12, 301
+L219: .string "um"
+L220: .data -883, -443, -379, 727, 93
+L221: .string "jbeswnjeu"
+L222: .data 53, -28, 957, 144
+bne *r6
+L223: .data -89, 695, -862, 410, -277, 564
+L224: .string "qubfxetpvltpdj"
+sub r3, r7
+clr r1
+prn L139
+L225: .data 873, 267, 675
+; comment
+jmp L237
+L226: .data -482, 557
+bne *r7
+L227: .string "dupufpuagpbqmbizjezvlswu"
+mov #-233, L262
+L228: mov r4, *r6
+L229: jsr *r4
+L230: .data -942
+L231: .string "ib"
+L232: .data 905, -740, -89, -544, 786
+L233: .data -85, 246, 318, -991, -87, -669, -614, -151
+L234: .string "whcldeofwllupopyyprc"
+L235: .data -700, -940
+red *r1
+L236: jmp *r0
+L237: .data -93, -471, 168, 247, -701, 607, -617
+L238: .string "dp"
+L239: jmp L303
+L240: .data -217, 853, 384, -318
+; comment
+jmp *r0
+cmp L52, *r7
+L241: red L283
+L242: .string "xrolktvrknmniqzwhdlco"
+L243: .string "jusmkympziactiqcmhs"
+L244: .string "zsmkemizaexcpitqrazhfpb"
+L245: .data 42, 375, -622, 898, 816, -114, -671
+L246: .data -869, 399, -929
+L247: .string "xfcwl"
+jmp L261
+L248: .string "byfnfafbqwxsbhc"
+; comment
+L249: .string "mzvtxmyutvuzgnmbhoqu"
+add L264, r1
+L250: .string "fwpoftfnuz"
+L251: .data 833
+L252: .data -640, 316, 228, -886, -589, 364
+
+L253: .string "mtieayu"
+L254: .string "zbfrldwnddtajkrszy"
+L255: .string "ycvudzurbuh"
+cmp r7, *r5
+L256: .string "mjyn"
+L257: .data 282, 649, -364, 708, -283, -917, -254, -454
+bne L269
+L258: .data 295, -80, -662, -380, -828, -95
+stop
+jsr *r0
+L259: .data -951, 648, 251, 89
+L260: prn #-232
+
+L261: mov *r2, L26
+L262: .string "ctvhzvkhbomhdgar"
+L263: .string "rkt"
+L264: .data 895, 812, -24, 165, 152, 646, 62, -908
+rts
+rts
+L265: .data -401, 565, 840
+L266: .string "qcrxyxresoeworrpcjdkud"
+clr r4
+
+L267: .string "lyimaagdqvposnvemlhtj"
+not r7
+not *r1
+L268: .string "vzudlorkukqayldyznjyh"
+rts
+L269: .string "nadpljdgotisdnbrnnc"
+L270: .data 794, -331, 465
+
+L271: .string "fcxpjyzfe"
+clr L282
+L272: sub #244, L10
+rts
+L273: .data -76, -987, 643, 923, 443, 611, 479, 125
+L274: .data 87, -447
+L275: .data -472, -688, 536, 175, 950, -429
+L276: .data -170, 907, 651, 71, -128, -365, 585, -368
+L277: .data -28, -400, 500, -981
+L278: .string "nhwgurqqlkxskmjuxgvt"
+; comment
+L279: .string "ht"
+L280: .data -914, -790, -112, -125, 830, 736, 876, 349
+L281: .data -267, 386, -554, 314, -113, -188, 554
+L282: .string "wemidqfrrjdeodo"
+L283: .string "recnrjp"
+sub #-90, r6
+sub L291, *r4
+L284: .data 266, 746, 501, -947, -700, 756, -650, -855
+L285: .data 35, 154, -718, -722, -293, -421, 116
+L286: not L309
+inc r4
+lea L306, r1
+L287: .data -350, -245, 346, -936, 160, -587, -198
+L288: .data -173, -741, 404, -250, 469, -201, 868, -431
+L289: .string "ji"
+; comment
+L290: .data -680, 151, -210, -911, 690, -27
+L291: .string "s"
+L292: .string "djbsrtmvknokn"
+L293: .string "wmpexaevsfcfuirlyd"
+L294: .string "hystmnzibfk"
+prn r3
+L295: .string "pmzol"
+L296: .data -892, 470, 186, 690, 38, -908
+L297: .data 811
+mov *r4, *r5
+mov r5, *r1
+; comment
+clr r7
+L298: .string "mxwjzvnxuvxgg"
+L299: .string "temlwcdoipefzcay"
+L300: .string "wxhtwyfjeygjf"
+
+dec r3
+
+add L159, *r6
+L301: .string "arrtjayagc"
+L302: .data 564, 425, -4, -604
+L303: .string "ywcu"
+L304: .data 197, -805, 567, -562, -633, 230, -208, 334
+L305: .data -421, 830, -31
+L306: .string "ebe"
+L307: .string "akkejra"
+L308: .data -560
+
+lea L314, r5
+L309: .string "aatyabufblwfrl"
+L310: .string "cxmrbsgcpzb"
+red r1
+L311: .string "rbcbmocqjkoubicksmh"
+L312: not L314
+L313: .string "vxloqlfpojvta"
+L314: .data 237
+mov #172, L65
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 91
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .data -633, -68, -617, 950, 537, -426, -979
+L1: .string "wsyefhujavhwqegozci"
+; comment
+cmp r7, r4
+L2: .data -893, -231, -430, -6
+jmp *r2
+L3: .string "qkuuglwmbuziuyvhhaqi"
+prn r6
+L4: .string "uhhkzfzrcvkt"
+L5: .string "dboznnvrabwyhyeyjgjf"
+L6: cmp *r2, L60
+L7: .string "qeokiaucc"
+L8: .data 850, -25, 609, 320, 147, -470, 277
+L9: .data -863
+L10: .data -998, -143, 410, 853, 142, 359, -255, -508
+L11: inc L312
+lea L2, *r1
+inc L3
+L12: .string "ggndy"
+L13: .string "rmnjeiqkfdnerabubm"
+L14: .data -846
+mov *r7, r6
+L15: .data 525
+L16: .string "slmmciwkqgwiph"
+L17: jsr L12
+L18: .data 481, -802
+L19: .data 30, 960, -859, -44, -486, 315, 945
+L20: .data 802, -401, 353, 765, 265, -711
+L21: red L2
+not *r5
+L22: .string "vcccjww"
+inc L174
+L23: .string "tjofhgddmoxq"
+L24: .string "ajsyhogt"
+L25: .string "ntupuzjfvzzdbmgdpj"
+L26: red L251
+; comment
+mov *r6, r6
+L27: .data 656, -810
+lea L9, r5
+
+L28: .string "iwwwqdpugptegheqt"
+L29: .data -306, 389, 464, 542, 690, 266, 573, -365
+
+
+L30: .string "afovcskycragkool"
+L31: .data 200, -108, 447, 250, 546, 467, 368
+stop
+mov r6, r4
+L32: inc L10
+L33: .string "dvtkhxfiuuozqpvfbaapapw"
+L34: .data 906, -478, 465, 851, 314, 123, 841, -792
+L35: .string "piwku"
+L36: .string "dsrjuorpcfvtz"
+L37: .data -904, -139, -900, -271, 984
+L38: .string "shffi"
+L39: .data -32, -885, -705, -140
+L40: .string "msgkpmjujbzrgsssdwqlg"
+clr L175
+L41: .data -189, -958, 977, 559, -17, 762
+L42: .data -969, -327, -148, 368, -116, -628
+L43: .data 449, -377, -993, 448, 958
+dec L28
+clr r1
+
+inc L22
+L44: .string "bozijyfojtzlbzdaskxp"
+bne *r7
+L45: .data 961
+bne *r3
+L46: .data 512, -93, -91, 775, 192
+L47: .string "kwqswrrcdyralsihalzncwr"
+add *r5, r2
+L48: inc r4
+cmp r7, #-250
+stop
+L49: .string "vikaggcpxvkrkii"
+L50: stop
+L51: prn *r4
+L52: .data 866, -473, -363, -316, -778, -566, -990, -126
+inc L328
+L53: .data 328
+L54: cmp r7, #-66
+L55: cmp *r2, L44
+L56: .string "wddraxphkjq"
+L57: .data -689, -377, 418, -761, 744
+L58: .string "jiyixzbou"
+L59: .data 800, -225, -313, -826, -515, -428, -951
+red *r1
+L60: .data -803, -728, -885, 601
+prn L173
+cmp #-68, *r4
+L61: .string "hvdfraebhpqdtnpyx"
+L62: .data -737, 806, -491, -850, 46, -547, 930
+L63: .data -77, -465, -388, -43, 709, 375
+prn r1
+L64: .data 135
+L65: cmp L311, r3
+L66: .string "fihsxsefyytwvgfbeb"
+L67: .data -505
+L68: .data 115, -953, -635, 331
+L69: .string "i"
+L70: .string "ddyu"
+L71: .string "ammshxcnaakonl"
+L72: .string "plsvenemkmxnabwlnholsydg"
+red *r7
+L73: .data -346, -974, -886
+
+bne *r4
+L74: .string "wsygrjopxawklfspegovsrz"
+clr r2
+L75: dec *r0
+L76: .string "urnfouqcih"
+L77: .data 314, -253, -601, -382, -766
+L78: .data -800, 652
+L79: sub *r3, r1
+lea L155, *r4
+L80: .string "padghpnevsm"
+L81: inc *r3
+L82: .string "cgd"
+L83: .data 333, 491, 132
+L84: .data -929, 488, -611, -600, 182, 904, 172
+L85: prn *r2
+L86: .string "kwtcrv"
+L87: .data 234, -309, 697, -169, 610
+red r6
+L88: cmp L49, L15
+L89: .data -578, 858, -806, 828, 373, -961, 97
+L90: .data 852, 380, -960, 410
+L91: .string "burenxccrjlkl"
+L92: .string "bblpbwjctnhxwkp"
+clr L48
+L93: .data 60, -626, -991, 633
+not *r3
+L94: .string "oxepxm"
+L95: .data -162
+L96: .string "o"
+L97: .string "yzpuylgqdkjxexvxnqrvrvag"
+L98: .data 659, -428, -710, 85, -413, 177, -824, 272
+L99: .data -359, 904, 920, 942, -121
+
+mov r2, *r3
+cmp *r0, r7
+L100: .data 960
+
+L101: .string "yoznudpcyjmmwnirbbwb"
+L102: .string "zuesb"
+L103: .data -400
+L104: .string "vylanapst"
+L105: .data -674, 331, 436, -414, 565, -239, -842, 891
+L106: .string "vofisvzadrayk"
+L107: prn *r0
+L108: .string "qrbg"
+L109: .data 931, 552, 12, 75
+L110: .string "ukyqeeiizqziwmvnw"
+L111: .data 367, -529, -645, 79, -719
+L112: .string "eriindekrpxptduelis"
+add *r6, *r4
+L113: .data -850, 528, -296
+bne L323
+L114: .string "l"
+L115: dec L171
+L116: .data -714, -324, -918, 329
+not *r6
+L117: .data -537, -613, -432, -526
+L118: .data 302, -56, -852, -856, -71
+L119: .string "giai"
+L120: .data -712, -844, 747, 189, 403, -725, 377, -11
+cmp *r5, L44
+cmp *r1, L291
+L121: add L9, r7
+L122: .string "rwysuzlz"
+L123: .string "daxncnq"
+add #82, *r2
+stop
+L124: .string "kddaqvrhwkvco"
+L125: .string "ejwwumkqsd"
+L126: .string "etkvrioyjwcn"
+L127: .string "ismlpota"
+dec r2
+L128: cmp L82, *r3
+L129: .data 315, -632, -121, 720, -812, -502, -612, -423
+lea L222, r5
+L130: bne L200
+L131: .data 618, -889, -227, 416, 69
+L132: .data 526, 354, 324
+
+not *r1
+cmp r0, *r5
+L133: .string "nomxmydtokpq"
+L134: .data 451, -197, -72, 248, 511
+
+stop
+L135: .string "qmqocjxyprftzgec"
+jsr L125
+L136: .data 437, 999, 586, 163, 772
+jmp *r7
+L137: .string "ivxvj"
+red *r5
+L138: .data 268, -696, -703
+L139: .data -372, -341, 523, -808, -321, -279
+not r5
+L140: .string "rphsmcwzdssa"
+L141: .data 368
+jmp L250
+dec *r7
+L142: .string "go"
+L143: .data 319, -978, -287, -705
+L144: .data 583, -404, -874
+L145: .string "tmqozkzomxxml"
+cmp *r6, *r2
+jmp *r3
+L146: .string "uarews"
+stop
+L147: .string "urbhl"
+L148: .data 195, 423, -274, -455, -872, 723, 90
+L149: .string "pfnfk"
+; comment
+L150: .data 515, -545, 898
+L151: .string "hsusdwajndotkbgwqkoskk"
+L152: .string "mwzyddvnwtwhe"
+add L53, *r6
+L153: .string "vdcokzpvgxsc"
+L154: .data 379, 707, -700, -305, 234
+prn L244
+L155: .string "gyozyplcfpgznqzjuxrox"
+L156: .data 280, 399, -510, 887, -311, 250, -918
+add *r3, *r6
+inc L88
+L157: cmp L52, L227
+L158: red *r0
+L159: jsr L80
+jmp *r6
+L160: .data 326, 279, -799, 280, 384, 116, -318, 965
+L161: .data -714, 248, 409, -185, 205
+L162: .string "gxyawihidxhqnqmj"
+L163: .data -139, -762, -322, -674, 80, 771, 780
+L164: .data 595, -640, -820, 913, 246
+L165: .string "tarthw"
+L166: .data -148, 499, 19
+L167: .data 375, -704, 679, 86, -488, 24, 793, 814
+L168: .data 119, -651
+L169: .string "kzglfbmsgpgdoruywmn"
+mov r0, L261
+lea L82, r1
+bne *r6
+jsr L91
+L170: .data 290
+L171: .data -292, 228
+L172: .data 633, 403, -829, -41
+; comment
+jmp L1
+inc *r4
+red r0
+L173: .string "gqgrxjjyjdgygrlou"
+L174: .string "aumq"
+jsr L148
+L175: jsr L135
+L176: .data -417, -930, -888, 180, 832
+L177: .data 753, 494, -907, -41
+L178: .data 684, -96, -701, -579
+
+jsr *r5
+L179: .string "k"
+not *r3
+L180: .data -492, -151, 676, 774, 244, -598, 193, 514
+sub r4, r3
+rts
+dec *r0
+cmp *r4, #175
+L181: .data -355, 158, -938, 567, 344, 739, -381, -273
+mov r0, *r4
+L182: .string "giybdnnjovq"
+L183: .string "mt"
+L184: .string "vk"
+clr *r7
+L185: .data -133, -811, -5, 951, -315, 460, -148, 656
+inc r0
+L186: .string "ivmxogc"
+dec r0
+L187: .string "vbwwmscajygasc"
+L188: .string "d"
+L189: .data 929, -269, -12, -395, -601, -463, 123
+red r0
+L190: stop
+L191: .string "thxzjygurmmw"
+L192: .string "tmtmo"
+L193: .string "vqfcccofzkkftfmfmrjxbvt"
+; comment
+rts
+jsr L179
+L194: .data -940, 189, -639, -499, -247, 27
+dec L124
+L195: bne *r4
+L196: .string "mbfsnhzytmanbkjajzjkg"
+L197: cmp #-243, L47
+L198: .data -639, -750, -924, 653, -914, -625
+L199: not *r5
+L200: .string "jxczpqkrcucmrhwg"
+L201: .string "jof"
+L202: .data -335, -889
+L203: .data -975, 616
+inc *r5
+L204: .data -84, 449, -408
+L205: .data -935, -891, -230, 929, -677, 441, 233
+prn *r5
+L206: .data -717, -761
+jmp *r2
+not r7
+L207: .data 766, 774, -944, 329, 938, 565
+L208: .string "ribwecyctyqgfsdbejcs"
+L209: dec L117
+L210: .string "voaj"
+L211: .data -729, -457, 36
+lea L237, *r6
+L212: .string "upktmvawpqvrz"
+L213: prn #28
+L214: .data 877, -204, -553
+stop
+rts
+L215: .data -513, -736, 975, -735, -155
+L216: .string "fqwcbdqhowmcstuhkxkjyj"
+stop
+bne *r6
+jmp L64
+red r3
+L217: .string "aefcp"
+stop
+rts
+L218: .data -859, -68
+L219: .data 643, -393, 969, 398, -285, 148
+L220: .data 368, 630, -693, -853, -231
+L221: .string "aczwfygpajuucazzyzmj"
+bne *r1
+L222: .string "irr"
+L223: .data -9
+L224: .string "xihpvtofdsqfaxycv"
+L225: .string "eyuevheg"
+L226: .string "ljpwlnibcwvgwy"
+jsr *r6
+L227: .string "sctvdvbakfyzhgciuxy"
+L228: .string "zzaexcohvsv"
+inc L51
+inc *r6
+L229: .data 597, -387, -249, -858, -820, -397, -991, -128
+sub *r5, L163
+jsr L50
+L230: .string "jkqdibxuob"
+L231: red r7
+add L313, *r6
+; comment
+add *r2, r6
+not r4
+L232: .data -37, 174, 583, 92, 49
+clr r5
+L233: .data 352, -117, 337, 785, -649, 557, 86
+L234: .string "lobknap"
+L235: .data 100, -547, -909, -300
+lea L315, *r0
+L236: .string "ltbkldhisuokvxyndaug"
+add r2, *r7
+add L317, L251
+L237: prn #-193
+; comment
+prn L253
+L238: sub r6, L169
+L239: .string "opwmcbdaewugal"
+L240: .string "iqnpepjrfseznjyshls"
+L241: .data -428, -93, 606, -410, 970, -595, -479, 266
+jsr *r3
+L242: .string "abvune"
+not r0
+cmp L22, r3
+mov r2, L83
+L243: .string "j"
+L244: .data -633, -991, -303
+L245: .data -934
+not L209
+L246: .string "l"
+L247: .data 339, 358, -879, 825, 494, 436
+jmp *r4
+L248: .string "oqvu"
+L249: rts
+rts
+L250: .string "xd"
+L251: not *r5
+
+mov r4, *r5
+L252: .string "ljdwzec"
+L253: .data -6, 358, -290
+L254: .data 286, -172, -722
+L255: .string "tv"
+jsr L63
+bne L157
+lea L215, L321
+bne L194
+L256: .data 47, 909
+cmp #-7, #226
+L257: stop
+L258: .string "wfxm"
+L259: .string "gwofkwcyucmykyquf"
+L260: .data 548, -412, -666, -291
+L261: .string "dbwfy"
+L262: .data -678, -121, 644, 377, 374, 150
+L263: .data -706, 803, -79, -598, -615, 181
+L264: .string "de"
+L265: .string "dkyhcxzssxkffeskgsblpq"
+mov *r4, r6
+cmp L306, L177
+L266: inc r4
+; comment
+; comment
+
+; comment
+L267: jsr *r3
+mov #-177, *r0
+L268: .string "pcpavmmxbopybngxdebkbnj"
+sub #-136, L191
+L269: .data -277, -191, -62, 565, -786, -991, -520
+L270: .string "wijznzupntpompoirmy"
+L271: .data -529, -159, 221
+L272: .data 747, 275, -656, 440, -592, 207, -907, 706
+jsr *r4
+L273: .data -746, -722
+L274: .data 508
+L275: .string "hcixssqgqcpqukanxousseeu"
+L276: inc r5
+L277: clr L301
+L278: .string "rriuqihyfdexfuymkoghteg"
+L279: .data -20, -58, 130, -950
+L280: .data -359, 323, 981
+rts
+L281: .string "kghxafgya"
+; comment
+L282: .data 300, 256, 290
+L283: .data -108, 723, 660, 756, 647, -891
+L284: .string "yh"
+prn #-148
+L285: .string "ty"
+L286: .string "zcqpibramirzenwu"
+rts
+jsr L300
+L287: .data 855, -264, -886, 189, 673, 860, 424
+red L297
+red L296
+L288: clr *r2
+L289: .data -548, -135, -887, -201, -6, 599, 786
+stop
+L290: .string "efuc"
+L291: inc r0
+L292: .data -53, -228, 868, -109, 57, -538
+inc *r5
+L293: add L303, *r6
+L294: .string "tfskzylpfhsnowkpsb"
+L295: .string "gbtmntxpo"
+L296: .string "ibwveubjdpuzbjbfjtuh"
+L297: .string "fgmqdmzeothldk"
+L298: .string "jvmmsk"
+L299: .data -876, 389, 178, 383, 9, -823, -887
+L300: .string "nndrslkxog"
+L301: .data -31, 235, 338, 896, 591, 998, -779, 37
+L302: .string "lhleejysdutcicugaetjtld"
+L303: .data 955, -657, -564, -982, -602
+bne *r3
+sub *r0, r0
+L304: .data -812, 980, -220
+L305: .string "ngfurhhmrzixkbd"
+L306: .data 631, 815, 190
+rts
+L307: .string "cvrgwo"
+L308: .string "ixjggrienedsgopqbvnkcf"
+cmp *r7, #203
+L309: .string "y"
+L310: .data -584, -4, 590, -425
+L311: .data -325, -773, -385, 483, -166, 923, -40, 98
+L312: .data -100, -705, 177, -243, -215
+L313: .data -477, -155, -75, 30, 715
+L314: .string "xwkbrexejtugthj"
+L315: .data 74, 755, -355, -565, -725, -544, 393, -32
+L316: .data 308, -636, 314, 351
+L317: .data 114, -502, 921, 457, 160, -656, 37, 497
+prn r2
+L318: .string "oawsppllltvhcaudxyxhic"
+L319: .string "euntsvzkdomii"
+L320: .string "u"
+L321: .data -292, 817, -62, -912, -270, -764
+L322: .data 137
+L323: .data 563, -968, 754, -601
+
+L324: .data -929
+L325: .data 937, 336, 142, -272, -761, -159
+jsr L327
+L326: .string "tjinoowvgvcfujtvcfac"
+L327: .string "sw"
+rts
+L328: bne L329
+L329: .data 754, -638, -158, 183, 834, -376, -406
+L330: .data -388, 162, 480, -207
+bne L331
+L331: .string "tkhgbivapc"
+stop
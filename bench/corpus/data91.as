@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 92
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+L0: .data 865, -95, -118, 304, -817, -819, 407
+red *r4
+L1: .data 92, 430, 152, -589, -195, -585, 89
+L2: .string "xpyrlu"
+L3: .string "efdi"
+L4: .data 886, 486, -898, -687, -242, -874, 954, 351
+L5: .string "vovygkdhzyngyrdf"
+jsr *r2
+L6: .string "roxkoxxtiy"
+L7: .data 483, -124, -896, 825, -805
+L8: .data -233, 315, 375, 236
+L9: .string "fk"
+L10: .string "uupurqezf"
+L11: .string "cxhgfdlzmjpz"
+L12: .string "wtqpdwm"
+L13: .string "gofuuprzoprvg"
+mov L5, L1
+L14: .string "blcpmfqiv"
+jsr *r2
+jmp L150
+L15: .data -723, 722, 837, -400
+L16: .string "gibctvvrclzflrodrvalxvho"
+L17: .string "cpdsy"
+sub L4, *r0
+L18: red *r7
+L19: .string "msnxkresckddjdl"
+rts
+L20: bne L15
+rts
+L21: .data 507, 828, -314
+L22: .data 562, 533
+L23: .data -153, 311, 67, 487, 377, 201
+L24: .data 317, 898, -690, -879, 351, 422, -480, 12
+L25: .string "tkxzcpkiwgnbk"
+inc L130
+L26: .string "ekdoc"
+clr r6
+L27: .string "zoojftjfopdtsdqzxnfhr"
+; comment
+L28: .data -762
+not r7
+L29: .data -767, 7, -344, 114, 784, 302
+L30: .string "edcslctcbjjjahoc"
+L31: .data -116, 121, 235
+L32: .string "kxkcqwzascnjhhapl"
+; comment
+L33: .data -365, -464
+L34: .data -436, 285
+bne L251
+rts
+L35: .data -561, 627, 834, -270, -479, -696
+L36: .string "yecouxhu"
+jsr *r7
+L37: .string "sfegolpfzbo"
+stop
+L38: .string "xaxfdzkrkxatmjlk"
+; comment
+L39: .string "mdiumyvvumqkvjowkuspdr"
+stop
+L40: .string "ahipbqouo"
+L41: .data 417, -997
+L42: .data -977, 222, 867, 168, 730, -759, 234
+L43: .string "gd"
+mov L16, *r0
+not *r1
+L44: .data -345, 928, 680, 724, -276, -115, 286, 364
+L45: .data -96, -30, -160, -471, -302
+L46: .string "jvdvlsgopwqvugasppgl"
+not r3
+L47: .string "oih"
+L48: .data 900, -307, 28, -725, 193, -587, 381
+rts
+L49: .string "ydnmezirzdyn"
+clr r3
+L50: .data -237, 164, 642
+L51: .string "lmiyihcwyczrnaalosvmhe"
+stop
+L52: .data -578, 522
+L53: .string "wwsmjmiringcaoopelctj"
+red L244
+add L38, L11
+L54: .string "lnamqihyfvaxo"
+L55: .string "rnhn"
+L56: .data 337, -18, -696, -66
+bne *r2
+L57: .string "euehvpg"
+jmp *r5
+L58: .string "dfevwrnugs"
+jmp *r7
+L59: .string "sbkaxuhpyrkxogxmtfwzfddr"
+sub *r1, L10
+; comment
+L60: .data -575, -882, -785, 352, 192, -702, 833, 174
+mov r1, L88
+rts
+L61: .string "fsgfplrd"
+L62: .string "wduyjtaqjymbzhqh"
+; comment
+L63: .string "ynsjdugebksibbqwff"
+L64: .data 10, 32, -496, 859, -328, 87
+
+inc L46
+jsr *r2
+sub r6, *r1
+jsr L164
+bne *r1
+L65: .string "iicle"
+L66: .data -437, 140, -339, 613, -501, 63
+not r6
+L67: .data -442, 55
+; comment
+not L197
+L68: .data -763, -758
+lea L126, *r2
+
+L69: .data 153, -275
+inc L287
+stop
+L70: mov *r3, *r5
+L71: .string "oskvtrvizmcwx"
+L72: .string "togdoy"
+L73: jsr L31
+L74: .data 394, -935, -651, -452, 189, 459, -863
+L75: .data 939, 917, -861, 450
+L76: .string "qe"
+L77: .data -319, 838, 843, 102
+L78: .data 539, -597, 381, -682, -828, 202, -938, 751
+jsr L46
+L79: .data -959
+L80: .data -89, 859, 758, -230, -46, 136
+red L62
+L81: .string "kz"
+prn *r5
+L82: .string "ouihdhepdkukqqk"
+L83: .data -63, 131, 11, -698, 845, 792, 738, 622
+L84: .string "x"
+L85: .string "rorifkkkzkniabrtuhfog"
+; comment
+jsr *r2
+L86: jsr *r7
+prn L42
+inc *r1
+lea L22, *r5
+L87: .data -215
+cmp L42, r7
+L88: .data -382, 899, -988, 923, 503, 950, -441, -114
+L89: .string "baxlapra"
+prn *r3
+L90: .data 440, -576, 299, -569, -836, 337, -234, 898
+bne *r1
+L91: .string "mmtpw"
+L92: mov *r7, r3
+lea L196, L104
+inc r6
+L93: lea L151, *r4
+jmp *r5
+L94: .data -381, -168, -624
+L95: .string "sbnvvsrwk"
+jsr *r4
+L96: .string "ujbypbsukjgngyuik"
+clr L87
+L97: .string "jlwgerpivsfpurgrvcg"
+L98: .data -977, 346, 110, 522
+lea L49, r4
+inc r2
+clr *r5
+L99: .string "nrxtgfasx"
+L100: .data 160, 221, 8, -80, 117, 446
+L101: .data 57
+L102: .string "ylcvo"
+L103: .data 756
+L104: .data -54, 482, 168, 836, -330, 484
+L105: .data -625, -343, -924, -552, 766, 236, -156, 571
+L106: .string "pglbmtmovgzexwxpk"
+clr *r5
+sub #182, L42
+L107: .data -32, -575, 221
+L108: .string "nywlmvrursbbztqdyearfl"
+cmp *r3, #89
+L109: .string "exgkyoyanbpviks"
+L110: .data 981
+lea L53, *r4
+red L45
+L111: .data 728, 362, -84, -303, 400, -621, 712, -372
+L112: .string "cptqtmr"
+
+; comment
+L113: .string "asiobsvhoiyecvxesdq"
+sub r0, r5
+L114: .data -792, 104, 945, -554, -525, 59, 507
+; comment
+sub L221, *r1
+L115: .data 669, 706, -903
+dec r5
+L116: .data -158, 281, -453, 305, -866, -229, -703
+; comment
+jsr L267
+L117: .data 385, 637, -999, 824, 493, 41, -539, -316
+L118: .data -468, -963
+L119: .data 29, -43, -148, -594, 450, 325, 410
+L120: .data 510, -977, 82, 30, 347, 662, 356
+
+L121: .string "zxwxhqmgzmehthwlfjj"
+sub *r5, *r4
+rts
+L122: .string "krokmybhimj"
+sub L307, r3
+L123: .data 875, 4, 317, -296, -701, 187, 505
+L124: .data -281, 694, 665, 665, -453, 647, -219, -908
+L125: .string "ticrthck"
+L126: .data 641, 101, -714, -291
+; comment
+L127: .string "thysffsxxsolpkr"
+not *r1
+L128: .data 488
+L129: clr L101
+L130: .data -682
+jmp L200
+L131: .string "jsvngahtqiobcspxjdu"
+L132: .data -605, -952, 310, -264, 12
+prn r7
+L133: .data -274, 327, 213, -954, -635, 998, 29
+L134: .data 526, -393, -100, 60, -286, -247
+L135: .data 620, -832, -666, 821, -470, -873, 30, 879
+L136: .string "wkdpuyozxerv"
+L137: .string "bvwlbzcwnionwxrd"
+L138: .data -539, 250, 362, 466
+L139: .data 679, 210, 750, -25, 511, 613
+L140: .string "xzmfvheuduklhzmicdgzul"
+L141: .string "shsjppsmgnypcnhrzk"
+sub r5, r3
+L142: .data 41, -936, -952, 694, 229, 550, 434
+L143: .data -356, -774, 731, -165, 280
+L144: .data 198, -202, -763
+prn *r0
+L145: .string "fjxy"
+L146: .data -346, 282, -435, 629, 465, 559
+L147: .data 743, -270, -479, -934, 806, 524, 328, 751
+; comment
+L148: .string "dzfph"
+L149: .string "eap"
+L150: .data 417, -384, -121, -563, -17, 264
+L151: .string "mcebikrts"
+L152: .string "zxwmxpuhtbwfcgkucrvngekl"
+not L35
+L153: .data -494, 284, -887, -810
+L154: .data -630, -486, 809, 455, 150
+rts
+L155: .data 993, -441, -146, -493, 791, -479, 168
+mov #6, *r3
+rts
+L156: prn *r4
+L157: .data 244, 235, -768
+L158: .string "shmkli"
+L159: .string "xyvqlpjm"
+; comment
+L160: .string "mudak"
+L161: .string "wwdizruahribz"
+L162: .data -822, -102, 444
+L163: .string "dq"
+inc *r1
+L164: prn #-122
+inc *r7
+add L224, r6
+L165: add L139, r4
+
+L166: .string "fpc"
+L167: .string "i"
+L168: .string "deauqbtcoapmkrogblerab"
+jmp L295
+L169: .string "bljuvpdumonoeobxtezpv"
+L170: .data 895, 493, 780, 408, 940
+L171: .data 791, -358
+L172: .data -129, -702, 180, 280, -199, 837, 758, -691
+stop
+jmp *r0
+L173: .data -100, 64, 752, -210
+L174: .string "psxvlhlpgu"
+L175: .data -528, 687, -467
+jsr L110
+L176: .string "wsuyjrxgktznaaxdlxp"
+dec r2
+L177: .data 148, -268, 259, 208, 441, 213, 792, 479
+L178: .data -27, -765, 969, -144, 308, 154
+clr *r5
+L179: .data 387, 98, -346, -851, -243, 838
+L180: .string "hretqojyd"
+L181: .string "iax"
+L182: .data -277, 730, -956, 773
+not r2
+L183: .data -663, 258
+prn r3
+L184: .string "nunwooerntqiqbiyxrxejo"
+cmp *r3, #108
+L185: .string "uufnpuowbnvpfhxr"
+jmp *r7
+L186: .data -450, 716, -954, 732, -475, -880
+inc *r0
+clr *r3
+L187: .string "cajngzbzjqhzwuqfigacdokc"
+L188: .data -542, -921, -256
+L189: inc *r4
+L190: .data 804, -917, 122
+; comment
+inc r5
+L191: .string "chgspfvizovwhqb"
+sub #-197, r4
+not L256
+L192: .data 414, 537, 688, 453, 443
+clr L265
+L193: .data -962, -211, 365, -862
+L194: .string "vqrjlznrnzkdcrs"
+L195: .string "bxzcmgtmce"
+L196: .string "qrzgaz"
+L197: .data -168, 971, 425, -697, 666, 368, -469, 904
+L198: .string "egzahzjssrfxaypy"
+L199: .data 198
+L200: .data 106, 591, 756, 84, -754, 743
+cmp L230, *r3
+L201: inc r5
+L202: .string "mbjyzheuknhgggghbfiukdcs"
+L203: .data -141, -601, -844, -922
+bne L295
+L204: .string "hgmowfjlkalzcdgdmrs"
+clr L217
+L205: stop
+L206: .data 532, -805, -842
+red L168
+L207: .string "dwrcrlgpwkmlhvppqme"
+L208: prn L234
+bne *r4
+red *r3
+not r2
+mov #138, r0
+L209: .string "gapnlfoz"
+stop
+L210: inc *r3
+L211: .string "eighyuymkdnwyt"
+L212: .data -602
+
+L213: .data -389, -328, -469, -570, 938, -94, 180
+L214: .data -407, 499, -128, 685, -811, -455, -73
+L215: .string "tebppzgcsfomnlv"
+L216: .string "dacgxuahsqblc"
+L217: .string "ueteibzrqrzyrojyscntp"
+L218: .string "tunbvlqebkwn"
+prn *r2
+L219: .string "loahvmadmxjqvzzhfij"
+L220: .data 58, -178, 3, 676
+L221: .string "irktk"
+L222: .string "aelhptaektxi"
+prn L143
+; comment
+prn *r6
+jmp L110
+L223: .string "dmznb"
+red L291
+L224: .data -169, -85
+dec L228
+L225: clr r6
+inc *r1
+L226: .string "winmfswulthskmompmegeq"
+L227: .data -531
+L228: .data -603, 562, 288
+L229: .string "vsjeygrurdudjexvmq"
+mov *r0, *r6
+L230: .data -469, -91, -59, 718, 25, -374
+L231: .data 281, -749, -915, -704, -775, 845, 884, -176
+L232: .string "yxljtgzjjuczaqvrzrsuvdom"
+L233: .data 34, 60, -784, -835, 431
+L234: .string "cbtri"
+inc r6
+L235: .string "nbctenhkl"
+L236: .string "uevu"
+L237: .data 91, 584, -898
+inc *r2
+L238: cmp *r2, r1
+L239: .data 390, -231, 723, 483, -804, -329
+L240: .string "dnqja"
+L241: .string "l"
+L242: .string "uiturmkbbypx"
+L243: .string "x"
+sub r7, *r0
+jmp *r1
+L244: lea L255, L229
+L245: .string "vne"
+L246: .string "nvaeibjhx"
+L247: .string "qr"
+L248: .data -437, -994, 47, 567
+L249: not *r6
+jsr *r7
+L250: .data 61
+sub *r6, L275
+L251: .string "tlghkqsu"
+bne L175
+L252: .data 919
+clr L287
+L253: .data 65, 960, -761, -471, -50, 143
+L254: .data 840, -244, -505
+L255: .string "oddpcu"
+L256: .data -887, -804, -206, -533, -850, 440, 880
+L257: .data -633, -279
+clr L272
+bne L287
+L258: rts
+
+clr *r5
+; comment
+L259: .data 204, 18
+L260: .data 536, -754
+inc r5
+L261: .string "eikkimcwdlnatxhblmze"
+L262: .string "i"
+L263: .string "qi"
+L264: .string "wtmosbhlpuqw"
+L265: .data 898, -633, 166, -635
+L266: .string "rjwspvpjeufanlifetp"
+L267: .data 921, -558, -588, -907, 845, -634
+stop
+jsr L276
+L268: .data -710
+L269: .data -159, 618, 841, -580, 981
+L270: .string "uwkvs"
+L271: .data -231, 988, -688, -226, 144, -551, -362, 512
+sub r6, r3
+bne L127
+L272: .string "hmginknliprunoelno"
+red L285
+inc *r0
+L273: clr *r2
+L274: .string "ikrkqxl"
+L275: .string "dejciwxqho"
+L276: .data 158, 561, 648, 243, -550, -574, -297, -85
+rts
+mov L162, r3
+cmp #123, L246
+L277: .string "vbcsmyhwpqrg"
+L278: .data 676, -191, 189, 769, 843
+sub #-162, r3
+L279: .data 111
+lea L55, r6
+L280: .string "bnylqhxwrevraga"
+jsr L244
+L281: .string "mujdiumyeucvljf"
+jmp L75
+L282: .string "switrjgjoesy"
+L283: .string "tmksjidl"
+inc L198
+L284: .string "dvbwurjonpaethv"
+L285: .string "mwwgmqgvcq"
+red *r7
+L286: .data -19, -211, -983, 653, 770, 597, 825, 610
+not L176
+L287: .string "lcvofefeazstfcfxblpg"
+bne *r4
+L288: .data 475, -278, -382, 828, -862
+L289: jmp *r6
+L290: .data 575, -214
+L291: cmp L231, #-54
+L292: .string "vqxfcduwondk"
+; comment
+; comment
+mov #135, r2
+jsr *r4
+L293: .data -288
+prn #-158
+sub L36, L24
+L294: .string "cdvuprtldc"
+L295: cmp L296, *r0
+rts
+red *r6
+L296: .data -212, -441
+L297: .string "tnepgwpyfmsgsthzmvjxbckn"
+dec L5
+rts
+clr *r0
+bne *r1
+L298: .string "rwtnfwbyg"
+red L3
+L299: .data -967
+rts
+L300: .string "hjqbbdbnjxwblhophamsy"
+L301: .string "hxp"
+prn r0
+L302: rts
+stop
+L303: .string "xjwoze"
+L304: .string "evgosujismp"
+L305: cmp L130, L310
+L306: .data 349, -68, 659, 643, -658, 383, 332
+L307: .data 90, -596, -484, 697
+; comment
+L308: bne L312
+L309: .data -241, -68, 282, 891, -282, -184, -387, 732
+L310: .data 71, -470, 273, -899, 709, -800, 736, 643
+L311: .string "yqjvzrvfrylygl"
+jmp *r1
+L312: .data 807, 897, -645, 883, -423, -877, 270, -514
+L313: .string "ikwcdtmhxoe"
+; comment
+stop
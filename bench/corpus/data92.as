@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 93
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+L0: bne L128
+L1: .string "qviakrhqqotoq"
+sub #-60, *r7
+L2: .string "kqpytazaljjamuccktjm"
+L3: .string "rrq"
+
+L4: .data -424, 364, 918, 997, 685, -186, -474, 920
+L5: .data 937, -375, -276
+
+L6: .data -96, 722, -620, -459, -353, -19, -197, -959
+L7: .string "eyfsnhauakuz"
+lea L3, L5
+L8: .string "qzfrniflxvejvigirtv"
+L9: .string "kiomfyqoaxq"
+L10: .string "jxtahjd"
+clr L76
+L11: .data -992, 688, 489, -193, -754, -484, -574
+cmp r4, #-74
+L12: .data 829, -442, 499, -110, 774, 973, -943, 9
+L13: .string "hqdcyoee"
+L14: .string "tdfutqkrvulmgsdgpd"
+L15: .string "hnazqavfhhomjyncmqjqqll"
+L16: .string "cjuksjfwrxri"
+L17: .data 119, -742, 299, 31, -739, 133, -325, 347
+
+L18: mov r4, *r4
+L19: inc r1
+lea L181, *r0
+L20: .data 15, -442, 53, -882, -954, -18, -553
+
+L21: .data 148, -45, 875, 696, 188, 862, -94
+L22: .data -60, 115, 3
+; comment
+stop
+L23: .string "odczotqvixerpylzupwm"
+not L160
+L24: .string "pyalymifbehjuy"
+L25: .data -99, 419, -722, -712, -549, 916, 771
+prn *r1
+L26: .string "gdyjd"
+L27: .data 322
+clr L24
+clr L243
+L28: .data 995
+L29: .data -622, 879, 88, 118, -674, 553, 434
+L30: .data 361
+L31: .data -500, 796
+L32: rts
+; comment
+L33: .data 231, -586
+L34: .string "uqnjpdckezhbekcbqqablww"
+L35: .string "vydinrxeeqqb"
+L36: .string "zbemiscljupfedaudijf"
+L37: .string "ukumoy"
+add *r7, L35
+inc *r1
+L38: mov L34, *r4
+not r7
+L39: .string "rrumlraoaxdrzwgxpfupkrht"
+L40: .string "v"
+inc L11
+jmp L134
+; comment
+L41: rts
+bne L152
+
+L42: .string "oykgtndftiy"
+L43: .data -923
+sub L41, r5
+L44: .string "uccimzakaygwbgdc"
+
+add *r7, *r2
+L45: .string "jicweyu"
+jmp L277
+sub L38, r6
+L46: .string "xdzjtqvyu"
+stop
+L47: .data -96, -243, -333, -193
+L48: .data -248, -588, -972, -423, -361, 513
+L49: .string "ulwxgarxlvhgvrtsvn"
+L50: .data 801, -341, 695, 121, -948
+L51: .string "sccpk"
+L52: .string "jlnhcmsmwznrimofj"
+L53: .data 290, 776, 687, -694, 999
+stop
+stop
+L54: .string "qafvcfbnnfte"
+dec r1
+L55: .string "rnujixqekqumdsi"
+jsr L131
+L56: .string "hfxogmburku"
+L57: .string "csxzdlpgi"
+L58: .string "koghptzhorbuolbdrkpjohp"
+jsr L231
+L59: .data 214, -739, -408
+L60: inc *r1
+L61: .string "qfsgdffgmecqte"
+L62: .string "mfmzmxpqta"
+L63: .string "g"
+L64: .data 819, 480
+L65: jsr L78
+L66: prn #226
+L67: .data 92
+L68: .string "zgterctyydimyuyrbaeledh"
+not *r5
+stop
+add L67, L270
+clr *r1
+L69: .string "efvboizxllzsovlgftob"
+L70: .string "jpy"
+L71: .string "znqrxvuvr"
+L72: .string "ohkhmmanfo"
+L73: .string "zmxtimychqeo"
+L74: .string "dgqstolclcycssqexwwhcl"
+
+cmp *r0, r2
+L75: .string "asw"
+L76: .data 469
+L77: .string "mfprxayhvtmgbhhbzkg"
+stop
+L78: .string "pmikxgxkgezbwhqjeqbcz"
+not *r0
+mov #223, r0
+
+L79: .data 259, -292, -752, 36, -128, 681
+L80: .data 114, -711, 554, 227, 108, 486, 658
+; comment
+L81: .string "j"
+sub L68, r7
+mov *r0, r4
+; comment
+L82: .data 358, -365, -455, 526, 704, -861, -441, 838
+L83: .data 192
+L84: .string "cgx"
+L85: .data 493, -302, 724, -491, 388, 986, 880
+L86: .string "iooffsjskdkqfmdyd"
+clr L280
+L87: .string "sea"
+L88: .string "ftkvahlwodheqalylpttvk"
+L89: .string "kjmxbabkcfctkpzrvu"
+jsr *r2
+L90: .string "rbnjuabhyqdottfcrna"
+L91: .data -637, 448, 193, 11
+L92: .string "vfwlneeibcsxpzacps"
+L93: .data 536, -935, 924
+L94: .string "arhqqalrgf"
+dec L51
+add #-65, L69
+cmp *r4, L77
+L95: .string "rsug"
+
+cmp r4, L99
+bne L298
+inc L221
+L96: prn r7
+L97: .data 294, 41, -321, 675, 74
+L98: .data -962, -699
+bne L23
+
+jsr L225
+L99: .data 122, -12, 655
+L100: .data -874, -404, 749, 888, 419
+; comment
+L101: inc L98
+L102: .data -222, 620
+L103: .string "amwggafhoaypgz"
+L104: .data -355, -8, -139, -104, 699, -270, -84
+bne L96
+L105: .string "yffnejaocpdcevqpfn"
+jsr L43
+L106: .string "luyapfcmfyquzsxhrcxmgtr"
+L107: .data -374, 642, 433
+L108: .string "tlhvqgyry"
+lea L17, r2
+L109: .data -859, 292, -281
+L110: .string "rpkrtcbbiaibg"
+L111: .string "yeabawuptespfbwh"
+L112: .data 778
+L113: .data -211, 217, 436, 382, 676
+L114: .data -797, 855, -461, 641, -589, -950, 168
+L115: .string "brikmmsyf"
+L116: .data -143, 400, -255, 340, -705, -571
+add *r5, r1
+L117: .string "fvciphkuqtdawgzhwnjspq"
+L118: .string "vbinpdhgl"
+L119: .string "eowdrbitxtgkyw"
+L120: .data -60, 396, -658, 908, 205, -409, 907
+mov L51, r7
+prn *r2
+jsr L11
+prn #-140
+L121: .string "sbf"
+L122: .string "rlbbpfvvwieqbevvc"
+L123: .string "fefkfvchbhowb"
+L124: .string "axjiocnu"
+jmp *r2
+clr r2
+L125: .data -315, -677, 549, -334, 822, 240, -797, 715
+L126: .data -307, -364, 5, 335
+add L290, r4
+
+L127: .string "ggi"
+dec *r4
+L128: .string "jrpfrdnmnoyypigcpe"
+L129: .data 763, 461, -628, 271, -513, -812
+L130: .string "pnfpe"
+rts
+
+L131: inc r7
+L132: .data -154, 330, -287, -91, 934
+L133: .string "qaxq"
+not *r4
+L134: .string "raqpelnehx"
+L135: .data 471, -55, -252
+rts
+L136: .string "hilisebvuxkltxygjnywug"
+L137: .data -636, -88, 60, -463, -3, 649, -291
+L138: .string "hnyqmfefnrtbnqalvxtviyh"
+L139: .string "xzfvtrqwk"
+L140: add r5, *r1
+L141: .string "ioz"
+; comment
+L142: .string "hk"
+L143: .data 614
+L144: .data -489
+clr L60
+jmp L75
+add L292, *r2
+L145: red r6
+jsr *r2
+L146: .data -713, 794
+cmp *r0, r5
+L147: .string "wudbejkvtkpgs"
+L148: .data 61, -249
+lea L95, L232
+L149: .string "nlgpkwam"
+L150: .data 740, 446, -464, -367
+sub L270, L207
+L151: .string "phgeuotuzqmgmdbr"
+inc L148
+jmp L212
+L152: .string "szmgxgpbudggsnuonan"
+L153: sub r3, L36
+L154: .data -491, -62, -621, 670, -441, -728, 639, 449
+red L40
+L155: .data -598
+L156: .string "vclxrrclfeeydjzxe"
+L157: .data 768, 33, -106, -651, 961, -338, -336, 359
+inc *r0
+L158: .string "whov"
+L159: .data 882
+L160: .string "luca"
+jmp L123
+L161: .string "eqyoxsyxogyekhrvhdqse"
+cmp L140, L153
+
+L162: .data -256, 166, -243, -49, -752
+L163: .string "niovdogimbtezzidgrkjk"
+L164: .data -619, -842, -367, -724
+inc *r6
+rts
+L165: .data 990, -996, 316, 909, 282, -759, 495, -878
+L166: .string "xizcbyefufrfptbltcgxe"
+; comment
+rts
+L167: .data 460, 45, 527, 236, 985, -592, 958, 534
+L168: .string "jjihdtzmznj"
+L169: .data 3, 823, -810, -899, -891, -164, 731
+clr *r1
+L170: .string "gnncxxucnwhfxiqycox"
+rts
+lea L268, r1
+bne *r5
+bne L25
+inc *r3
+L171: .string "olb"
+L172: .data -141, 170, 907, 740, 68, 301
+clr L304
+L173: .data 417, -749, 599, 77, -890, -406, 79, -730
+stop
+L174: .string "vrobjlnpexbvpjyizx"
+L175: .data -379, -146, 734, 497, -513, 304, 658, -974
+L176: .data 851, 593
+L177: .string "kxsinazjfeu"
+L178: .string "ig"
+L179: .string "joimojaqrxumukxtvclr"
+jmp *r1
+L180: .string "jhzoqvsifvy"
+L181: .data 491, -180, 479, 473, -395
+L182: .string "elxoeai"
+rts
+clr *r3
+L183: .data -995, 638, -340, 585, 840, 970
+L184: .string "uyzvhkoaciydqcbgj"
+lea L85, L253
+red *r7
+; comment
+mov #242, L213
+add #-26, *r4
+L185: .data 948, 513, 73, -592, 740, 41, -655
+L186: .data 563, 739, -520
+L187: .string "irpjukvw"
+L188: .data -438, -88, -283, 124, 666, 304, 211, -69
+L189: .data 237, 8, 693
+
+inc L131
+L190: .string "y"
+L191: .string "nhqvcuhe"
+L192: .string "tbgpbkwdifkscai"
+red *r6
+L193: .data -104, -402, 477, -201, 408, -312, 642, 653
+red *r3
+L194: .string "dytlrv"
+L195: .data -187, -830, 88, 122, -528
+dec r0
+L196: .string "ljjr"
+L197: .data 392, -873
+L198: .data 712, 182, -444, -874
+L199: .string "zln"
+L200: .data -423
+bne *r4
+
+L201: .data 59, 793
+lea L159, r2
+L202: bne *r3
+L203: .string "iottcsa"
+L204: .data 982, 366, -569, 576
+L205: .data 117
+prn *r3
+L206: .data -121, 951, 417, -135, 354, 990, -211, -868
+cmp *r4, L221
+sub *r6, *r2
+stop
+L207: .string "g"
+clr L38
+L208: .data -611, 872, -364, -730, 106, 147, 196, -719
+L209: clr *r6
+mov r0, r7
+stop
+L210: .data 920, 167, 919, 879
+sub L291, L129
+bne *r3
+L211: .data -125, 529
+L212: .string "kobjyjwxpiclz"
+rts
+jsr *r3
+L213: .string "gb"
+not L9
+L214: .string "lufpbnttzwwmuuupvhcf"
+L215: .string "pmdrcvwkjwuonxmd"
+add L82, *r7
+jsr *r0
+L216: .string "abcxgneovrsvhqawdevm"
+L217: .string "tgyuetabbfakwjefapg"
+jmp *r2
+L218: .string "vtaptgn"
+L219: .data -872, -242, 296, 568, 747, -601, 446
+sub #-146, L49
+L220: .data -959, -743, -42, 830, 702, -16
+L221: .string "fcgshhl"
+L222: .string "ogyoph"
+add #-233, r3
+L223: dec *r2
+stop
+L224: .data -380, -127, 754, 905, -157, 574
+L225: .string "lvqlxrvopadu"
+bne L182
+dec L216
+dec L188
+L226: .data 651, 376, -325, -955, 574, -880, 144
+prn *r4
+L227: .data 578, 874, -422, -419, 146, 647
+mov r6, L297
+L228: dec r6
+L229: .string "mkcujzpmokrpqziwnfekii"
+L230: .data -495, 756, -147
+L231: .data -264, 861
+L232: .string "nyf"
+L233: .data -53, 754
+L234: .string "asmkwdmnmhsopaorjlcyjuy"
+L235: .string "jcrlspww"
+L236: .string "jgesiuaitpokjfhdrphigqwe"
+L237: .data 325
+L238: .data -24, 902, 21, -52
+red L27
+L239: .data -585, -306, 800
+dec L290
+sub L242, L191
+bne *r0
+L240: .string "leikendttwdgt"
+L241: .string "spky"
+L242: .data -683, 155, 598
+L243: .string "ebaaxutalckxdzspyanhl"
+L244: .string "sutlsqjfvivw"
+L245: .string "kvxvfdlqqhvnrmlwzm"
+L246: .string "lpnewbenlgzm"
+lea L89, r1
+L247: .data 349, 600, 913, -489, -595, -771, -227
+L248: .string "qvhofepe"
+bne *r1
+mov L292, *r6
+L249: .data -366, -980, -615
+L250: stop
+rts
+L251: .data -236
+L252: .data 427, -813, 307, 715, 490, 294
+L253: .data -331, 403, -959, 898, 84, 439
+add r6, r0
+L254: .string "vngflcsfxsnwbosha"
+add r4, r5
+L255: .string "m"
+rts
+dec L260
+L256: .data -953, -384, 180, -976, -353, -80, 355, 537
+L257: .string "yswpi"
+L258: .string "ekgflfwfvaqd"
+mov *r2, r3
+L259: .string "mevklucvu"
+prn L182
+jmp *r5
+
+cmp #239, *r4
+mov r5, r0
+dec r0
+
+jsr L214
+L260: .data -783, 417, -322, -105, 926, -590, 220
+L261: .string "zduohxamnpwryb"
+L262: .data 42, 85, 689, 623, 888, -807, -570
+bne L273
+L263: .string "b"
+L264: .string "gkbyvn"
+jsr L116
+
+L265: .data 444
+red *r2
+L266: .data -406, -584, -96
+bne L268
+L267: .string "unbunlkyw"
+red r7
+L268: .data -169, -367, -651, 641
+not *r6
+L269: .string "bs"
+L270: .string "i"
+L271: .data -230, -618, -34, -936, 96, 760
+L272: .data 967, -572
+stop
+
+L273: .data 833, 504, 0, -376
+L274: .string "dtbiktdlcbezoladphhlpi"
+L275: .data 298, 290, 486, -257, 105, 932, 364
+add #15, *r6
+L276: .string "e"
+L277: .string "nuydjndjmpsibpnzzsxjtr"
+L278: clr r7
+L279: .data -220, 479, -227, -367, 718, -719
+L280: .data -553, 639, -303, -907, 319
+L281: .string "rnzkzsfheunbjiopeuhc"
+L282: .data 921, -832, 639, 877, -265
+L283: .data -218, 814, 760, -362, -742, -407
+L284: .string "n"
+L285: .string "ydmqlnkjsnvaghqtkwv"
+; comment
+; comment
+
+L286: .data -577, -627, 248
+L287: .data -49, 805, 465
+sub #-67, *r1
+L288: .string "rtsk"
+stop
+L289: .string "mbofoqpzc"
+lea L211, *r0
+rts
+L290: .data -76, -132, -90, -432, -433, -604, -2
+L291: .string "vorqtxpwnz"
+prn r6
+L292: .string "aalctlwygrkw"
+L293: jmp L304
+dec L295
+dec r0
+
+L294: .data 724, 982, 573
+sub L298, *r2
+mov *r2, *r2
+L295: .data 435
+L296: .data -581, 49, 422, 357, 436, 296, 788
+stop
+prn #181
+L297: .string "kvjavkekcyyqfn"
+dec L300
+lea L59, *r2
+L298: .string "baymb"
+L299: .string "hbiznyrcps"
+L300: .data -810, 551, -77, -994, 691
+L301: .string "rnysouifiaszimwqfpezff"
+L302: .data 829, -405, 939
+L303: .string "oydp"
+jsr *r5
+sub L304, r6
+L304: .data 158, 490, 91
+stop
@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 94
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+L0: .data 709
+mov r7, r2
+L1: .string "ahrh"
+red *r7
+add #70, *r1
+L2: dec L2
+L3: .string "hflmn"
+L4: .string "npwuyewgzlnnfkgu"
+L5: .data 796
+red r3
+L6: .string "hmgh"
+L7: .string "ohiujr"
+L8: cmp #-53, r4
+jsr L4
+L9: .string "wmqapsxfmigr"
+L10: .data -366, -698, 299, 599, -200, 917, 123, -636
+clr *r6
+L11: .data -954, -157, 676, -507, -560, 538, 551
+L12: .string "ck"
+L13: .string "btlelbcspbndy"
+bne *r6
+cmp *r5, *r4
+L14: .data -140, 139, -850, -118
+L15: .data 340, 948, 35, 756, 33
+L16: .string "xhwgowxmytsmpsi"
+L17: prn #233
+L18: .string "ucdcnrvapdukphkmuyfdykq"
+mov *r2, *r0
+L19: .data -634
+L20: .data 26, -703, 387
+L21: .data 38, -954, 344, -333, -767, -276, 79
+L22: .string "gdbknrtwtkhahwcxk"
+cmp r7, r0
+L23: .data 229, 364, -710, 564, -925
+L24: .string "mykv"
+L25: .string "yr"
+L26: .string "lhgxkemazheatfpy"
+not *r6
+L27: .data -451, 347, 265, 388, -440, 440, 770, 444
+L28: .string "fne"
+L29: .data 950, -120
+L30: bne *r0
+lea L61, *r7
+L31: .data -753, -513, -762, 952, -360, -339, 48
+mov L5, L30
+stop
+L32: .data 658, -534, 71, 5, 377
+L33: .data 674, -129, -442, -521
+L34: .data 562, -323, -504, 573, 979, 413
+jsr L82
+L35: .data -146, 106, -956, 307, -406, -100, -764
+L36: .data 814, -453, 75, -633, -218, -145, 763, -962
+bne *r0
+jsr *r2
+L37: .data -287, -177, -236, 354, -877, -920
+L38: .data -800, 986, 360, 3
+L39: .data -313, -443, -665, -478
+L40: .data 821, 298, 480, 152, 750, -92, -879
+L41: .string "czhkn"
+L42: .string "eowbtimztmovoqkuydebdgku"
+L43: .string "c"
+not r0
+L44: .string "tzhyhsiy"
+L45: bne L44
+L46: prn *r1
+L47: bne *r7
+; comment
+L48: .string "katdpuswxkeboajqorxvx"
+L49: .string "a"
+clr *r2
+
+jsr *r0
+L50: .string "nwxxocybtgtx"
+L51: .string "acol"
+L52: .string "nbesqufuccdaztjzoyyclq"
+L53: .string "igdcernyrvo"
+L54: .data -300, -763, 531, 402, -978, 933
+L55: .data -367, -188, -529
+L56: .string "yywordleyugzdreijt"
+L57: .string "exexsrbfhyqpnkvgfhjxm"
+dec *r1
+rts
+L58: .data 4, -102, 817, 906, 603, 225
+
+sub *r6, r6
+L59: .data 116, 230, 26, -428
+L60: jmp L310
+L61: .data -914, -709, 779, -72, -987, 805
+L62: not *r5
+L63: .data 563, 348, -770, 729, 815, 270, -705, -973
+L64: .string "suhfzjpic"
+L65: .data -473, -874, -188, 280, 639, -894
+L66: .data 67, 147, 315, -563
+L67: .string "yveisxsldmlfnwqc"
+L68: prn *r7
+prn r0
+L69: .data -997, -929, 656
+not L23
+L70: .string "xrewrmbyhdn"
+L71: .data -960, -922, -58, -881, 945, -983, 953
+mov *r3, *r3
+L72: .data 551
+prn *r2
+clr L113
+L73: .string "ruppejkvgofhppwicj"
+L74: .data -858
+rts
+not L180
+mov L40, *r2
+L75: .string "myaqm"
+L76: .string "fuebrzdcsjvtznrimno"
+
+L77: .string "hxild"
+; comment
+L78: .data 621, 837, -612, -769, -335, -748, 47
+L79: .data -422, -246
+add L49, *r5
+L80: .string "rrapasqgtk"
+sub *r0, *r5
+L81: .string "iujrpqilsmrsfwpknroj"
+prn r5
+add #-77, *r3
+L82: .data -671, 451, -268, 578, -186
+red L18
+L83: .string "rxnqhtzlehd"
+lea L131, *r3
+L84: .data 411, 561, -163, 287, 354, 59
+stop
+
+lea L216, *r4
+; comment
+L85: .data -133, -163, -344, -302, 910, 617
+L86: .data 190, -118, 670
+dec *r1
+; comment
+L87: .data 805, -105, -417, -403, 274
+rts
+L88: prn *r6
+L89: .string "ynlagyzrdiickkca"
+dec L317
+mov #230, r4
+rts
+L90: .data 866, 365, 66, 687, 824, -128, -991, -403
+inc L211
+L91: .string "wwlgdczgmdbtzvxnhs"
+L92: .data 615, 664
+clr *r5
+L93: .data -847, -197
+clr r2
+prn #-202
+L94: .string "xrrsxtvqfnigoutiabg"
+L95: .string "yj"
+dec L58
+L96: .string "rwodogjrd"
+L97: .data 414, -179, -300, -991, 596, -59
+L98: .data 355, 135, 792, -331
+L99: .string "udbthypdtccgp"
+L100: .data 198
+sub r3, *r3
+cmp L289, #-41
+
+L101: .string "fgxbsksowsexxaidjzak"
+; comment
+L102: .string "gtnbxgueehymidfqqokmi"
+L103: .data 390
+L104: .data -83
+L105: .string "jbkpaaewzsuf"
+L106: .string "tydinwhwrficvquvdtcfoqug"
+L107: rts
+L108: .data -93, -172, -460, -759, -721, -532, -771
+clr r2
+L109: .string "ajilfdkkxzlcnwlblvuzy"
+red r2
+lea L41, r4
+L110: clr L31
+red r2
+prn L105
+mov *r6, *r5
+L111: .data 870, -171, 852, 155, -839, 242, 692, -246
+; comment
+L112: .string "ohbpix"
+L113: .data -471, -281, 652, -712, -629
+L114: .data -711, -761, 871
+L115: .string "xfbfwdjj"
+; comment
+L116: .string "s"
+L117: .string "xbalarfeobvyv"
+L118: .string "f"
+prn r2
+sub *r7, *r1
+stop
+L119: .data 216, -542, -911, -549, 67, 901, 420
+L120: .string "xwlqbcvgk"
+L121: .data -328, 454, -687, 60, 746, -456, 276, 295
+bne L31
+red r2
+L122: .string "qmqghbpvslprt"
+L123: .string "wktdwjvpgmuw"
+L124: .string "kxmbytvyppbisvziyxj"
+L125: .data -287
+L126: .string "drftptnzzdoufaizmgl"
+L127: .data 546, -122
+L128: .data -491, 543, -314, -833, 396, -591
+dec *r7
+L129: .string "vaonnskb"
+L130: .data 77, 758, -683, -28, -218, 372
+L131: sub L88, *r1
+L132: jsr L62
+rts
+cmp L54, #-220
+L133: .data -715
+; comment
+L134: .string "moxgwpoidit"
+L135: mov #195, r6
+not r2
+L136: .string "jeioxgzuezuuqdnyp"
+L137: .string "yckuhsr"
+L138: add r0, L164
+clr L102
+L139: .string "yshxhzxjag"
+L140: mov *r1, r3
+clr *r4
+L141: .data -161, 490, -509, 312, -656, -390
+rts
+
+L142: .string "jntunukjjixlhcoh"
+L143: .string "ebqk"
+red r1
+sub r2, *r6
+L144: .data 278, -801
+L145: jsr L6
+L146: .string "jjmhqvjkgzxcdxdoebqqt"
+sub L200, L247
+L147: .string "ejpzdrrgoxamaeldmkpa"
+prn #-94
+mov r6, *r4
+L148: .data 872, -930, -583, 251, -369, -472
+L149: .data -168, 801, -442, -347, 869
+L150: .string "sspzoyzjynfg"
+dec *r7
+L151: .data 524, -801, 207, -772, 554
+L152: .string "fmqz"
+dec r5
+L153: .string "gemttjpuzieuirodbpp"
+L154: .data -116, -436, -775, 791, 684
+L155: .string "rrjsojkrxstvsgdxf"
+prn r3
+cmp #-175, L214
+L156: .string "ovkhsnetanr"
+L157: .string "moj"
+red r1
+clr *r4
+L158: .string "rxbwwlmgeopm"
+L159: .string "fedvoabvxljjcekqagvgfle"
+L160: .string "zlwyknhmlysxv"
+rts
+L161: .data 491
+L162: .string "ibwsmtyiyyoxipdmn"
+jmp L78
+L163: .string "bsgrycr"
+L164: .string "jbzndpnanc"
+L165: .string "zggewqegtexuvxcnfh"
+L166: .data -117
+L167: .string "xcooxajwtwdnhcpyjmhlgzup"
+bne *r0
+L168: .data 173, 76, 972
+mov r6, L108
+stop
+red r7
+L169: jsr *r7
+lea L11, *r6
+L170: .data 787, 537, -79, 783, -96
+L171: .string "ctabb"
+add *r0, *r1
+L172: .data 942, 826, -631, 294, 93, -265
+L173: .data 690, 477, -819, -795, -804
+L174: .string "zmxzdszyirxcpjwegz"
+L175: .string "pfyl"
+L176: .string "wozneq"
+L177: .data -900, -743, -521, -739, 779, 739, -81, -530
+L178: rts
+L179: .data 316, 456
+L180: .data -650, -470, 377, -865
+add *r3, L282
+not *r2
+L181: .string "bd"
+L182: .string "mmtfpslmdbnzvsyqgbwmzeu"
+clr *r7
+L183: .string "tmjbqcojrvzccajrwklwqb"
+L184: .string "ukehjndgqbunwaymeq"
+
+L185: .data 342, 672, 162
+L186: .data -884, -886, 114, -773, 559, -834, 86
+
+bne L256
+L187: .data 129, -453, -186, -163, -473, -398
+L188: .data 443, -568, -877, 419, -846, 180, 196, -651
+L189: .data 704, -815
+mov L47, L229
+L190: add #-123, *r0
+L191: mov L256, r1
+; comment
+lea L124, r7
+L192: .data 507
+bne L237
+L193: .data -419, -422, -678
+clr L230
+L194: .data -276, 335
+L195: .string "ssfbykbzmojnxgupykasv"
+L196: .string "shdsoycrtmr"
+
+L197: .data 98, 231, 870, 497, -329, 341, 695
+L198: .string "amvnewptpqvtsidihinyhs"
+L199: .data 272, 453, 933, -200, -804, 153, 846, 332
+L200: .data -290, 642, -858, -162
+L201: .data 96, 838, 776, 711, 668, -407, -959
+L202: .string "xxrinzmmoq"
+lea L244, *r0
+L203: .data -806, 889, -988, -954, 913, -547, 400
+L204: .string "cnjumqblfgrmbeamrw"
+rts
+L205: .string "evwzoclarobxnwx"
+L206: .data 340
+sub #163, r5
+lea L301, r4
+L207: .data 86, 479, -692, -280, -584, -841
+L208: .string "jpjvcrnsgmgfsxs"
+mov *r5, r3
+L209: .data -703, -866, -748, -848, 642
+L210: .string "jhhfeicnralmbrcynjin"
+L211: .string "zpzazlbeepu"
+L212: .data 799, -406, 66, 78, -534, -3, 135
+clr L305
+L213: .string "bxocvhlo"
+L214: .data -656, -584, 421, -454, 551, 878, -247
+L215: inc r6
+L216: .data 161, 888, 60
+cmp L94, r3
+L217: .data 413, -215, 821
+L218: .data -665, 337, -342, 157, 765, 55, -514
+L219: stop
+L220: .string "xvpkisqz"
+L221: .string "zxfhlf"
+L222: .string "dxhngxwny"
+L223: dec *r6
+L224: .data -350, 598, -720
+prn r2
+L225: .string "tlisqrv"
+L226: prn r4
+dec L265
+L227: clr L314
+L228: prn L257
+L229: .string "qkkoqr"
+inc L267
+L230: .data 597, -21
+L231: .string "canqdekngrv"
+L232: .string "hewlgnphp"
+prn *r3
+L233: .string "klbjrj"
+L234: .data 791, 868, 499, 495, 408, 504, -415, 251
+bne L119
+lea L182, r6
+L235: .data 940, 490, 634, -158, -463, 35, 267, -976
+L236: .data -335, -880, -213, -172, -259, -818, 525
+L237: .data -190, 638, 369, 468
+L238: .data 7, 168
+not *r4
+L239: .string "nuhg"
+L240: .data -964, -406, -949, -394, -222, 337
+L241: .string "r"
+L242: .string "trhxcxxrswjspktujxuwwk"
+not L24
+L243: .string "clcnoqsxrb"
+L244: .data 164, -547, -232, -8, 491, -848, -799, -578
+L245: .string "qxgrnd"
+mov #-157, r6
+mov #-6, L134
+L246: sub r4, L261
+L247: .data -345, -691, -580
+L248: .data -845, 692
+inc *r5
+bne L120
+L249: .data -343, 764, 881, 999
+L250: .string "zzar"
+L251: .string "wswv"
+jsr L176
+L252: .data 242, 618, 181, 330
+L253: .string "wwghrbcidohhn"
+L254: .string "kjxncsdof"
+L255: dec r4
+prn #-106
+L256: .string "hwymioqteconbkxg"
+sub #113, r3
+L257: .string "grugfpzizgfgdplimp"
+jsr L194
+red L293
+L258: rts
+stop
+L259: .data -999, 966, -263, -9, -733
+L260: .string "ttemcmoywecndmupwzgesin"
+L261: clr *r7
+mov #-194, r2
+jsr *r7
+L262: .data -757
+bne L4
+L263: jmp *r0
+cmp #-61, r3
+L264: .string "erao"
+inc r6
+add *r5, *r6
+stop
+L265: .data 351
+L266: .string "j"
+L267: dec L302
+L268: sub *r3, L318
+dec *r3
+L269: .string "fckyqkicnbk"
+lea L275, L284
+L270: clr *r5
+bne L273
+jsr *r3
+L271: .data -466, -472, 164, -95, 880, 561
+L272: .data 164, -811, 809, 821, 433, -198
+L273: jmp L152
+L274: .string "veymjfqdxreqldm"
+L275: .data 666, 885
+L276: .string "dc"
+L277: .string "gdcgomrzbngw"
+; comment
+L278: .data -38, 671, 726
+L279: .data -798, -723
+L280: .string "jhopcdsgmjbhvyxe"
+L281: .data -802, 396, 577, 10, 261, -83
+L282: .string "cnofpo"
+cmp r6, L319
+L283: .data 951, 151, 690
+L284: cmp *r1, L314
+not r1
+L285: .data -657, -352, 890, -117, 292
+L286: .string "ddrdyuwepjdmj"
+L287: .data 655, 301
+L288: .data -884, -220, -347
+jmp L316
+dec L292
+L289: .data 256, -362, -778, -948
+L290: .data 954, -771, 169, 812
+L291: .string "ffsfkkrdjsjy"
+bne *r3
+L292: .string "ithsctccdzt"
+not r6
+L293: add r6, r5
+L294: .data -84, -124, -56, -499, -826, -307
+L295: .string "ajjffcprgwo"
+stop
+L296: prn #-52
+; comment
+L297: lea L299, *r0
+L298: .string "cbaldynhmjb"
+lea L312, r3
+prn #-150
+L299: .data 410
+L300: .string "tcxeowpbiyjwmhlvqicybzow"
+not *r0
+L301: .string "xtgirvazylbadzybqwvyfpgq"
+L302: .string "lfozljirotymzeen"
+L303: .data 245
+clr L313
+L304: .string "lyiioapm"
+inc r5
+L305: .data 441, 640, 798, 828, -338
+clr L47
+inc *r0
+L306: .data -748, 294, 481, 370, -753, -832, -137, -296
+L307: .data -734, -495, -609
+jmp L317
+
+L308: .data -952, -213, -170, -853, 385, -237
+L309: .data -326, 664
+L310: .string "zhfyxiavrikhhlziqscz"
+prn r7
+inc r7
+L311: .string "afprajvgdfporghixro"
+add #253, L52
+lea L314, L315
+L312: .data 565, -693, -830, 890, 942, 531, -363
+cmp L56, #-234
+jsr L318
+L313: .data -979, 315, 289, 985, -247, 635, -806
+; comment
+mov #-104, L315
+L314: .string "cimknsdsnhkvujoagadi"
+L315: .data -313
+cmp r2, #-15
+bne L163
+prn r7
+L316: .string "xpi"
+rts
+L317: stop
+L318: .string "wqbljdwilq"
+L319: not r4
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 95
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .data 954, -751, -201, 622, -188
+L1: .string "yqvyyuyghqdxjnsqzrr"
+L2: .string "pyijkffop"
+L3: .data 228, -339, 547, -957, -902, -862, -417
+rts
+L4: .string "thikurrpurenvtiyx"
+L5: .string "npmbnpzvpafteysnlibio"
+L6: .data -359, 187, -571, 848
+L7: .string "tisngaiaqdwhdxnbeo"
+L8: .string "zhkmmsti"
+cmp *r0, #218
+cmp *r4, *r3
+inc L256
+L9: .string "lgehmxoeswixyaz"
+L10: .data -642, 973, -545, 434, -246, 37, 282
+L11: .string "lxizswybxcdeohurdilngd"
+jmp *r6
+L12: .data -373, -559, -452, 961, -346, 991, -543, 8
+L13: .data -980, -547
+mov *r1, r6
+jsr L1
+L14: .string "jfahgbzarxvymtyrvlorc"
+L15: .string "mxdvcrgvsb"
+red L15
+L16: .string "oiktklhtlkmovbc"
+not *r6
+L17: .data 815, 595, -537, -736, -422, 437, 243
+L18: stop
+jmp L6
+prn *r5
+lea L15, r2
+L19: .string "hkapevxuxdoaxooouazq"
+L20: .data -565
+jsr L5
+L21: .data 990, -541, -522, -488, -90
+L22: jsr L132
+L23: dec r4
+L24: .string "recadzswjzq"
+
+L25: .data -210, 881, 147, -999, 157, -945
+L26: .string "vouev"
+
+L27: .data 240, 513
+L28: not *r6
+L29: .string "lnxeqfxmcruiopulzf"
+L30: .data 73, 737, 217, -798, 437, -681, -383, -27
+L31: .string "eazmhzxdazvibbqncm"
+L32: .string "suevmslpgnevbnrigguo"
+L33: .string "jmubcxbb"
+
+inc r5
+L34: .data 318, 50
+L35: .string "wqjpkpvjmqridcsqoyfwjx"
+L36: .data 639, 752, 179, 573, 995, -992
+dec *r4
+L37: sub *r5, L12
+L38: .string "cmjsvnnwj"
+jsr L14
+L39: .data 54, 285
+L40: .string "dklfebnwrpbdvzc"
+add *r6, *r3
+clr *r4
+jsr L152
+stop
+clr *r1
+sub *r6, *r6
+sub #179, *r2
+stop
+stop
+L41: .string "dcdmuqcpujbq"
+jsr L244
+L42: .data 883, 850, 21, 437, 655
+; comment
+sub L46, L38
+L43: .data 703, -525, -741, -80, -420, -143, -329
+L44: .data -327, -873, 817, 989, -4, -61, -818
+sub r5, L210
+L45: mov r5, *r6
+L46: .data -586
+L47: .string "xgopkiparzox"
+dec L28
+
+L48: .string "nmguefizspq"
+L49: .string "xvdvxvpkayabezticmbrxr"
+L50: .data 703, -209, -116, 268, 326
+L51: .data -165, 239, -542, -572, 994, -656, -780
+L52: .data -50, -709, -535, 158, 831, -811, -921, -356
+L53: .string "fktrxqfzrknrwvqx"
+inc L176
+L54: stop
+jsr *r0
+L55: .string "pq"
+; comment
+; comment
+L56: .data -284, -306, -463, 574, 38
+L57: .string "vlsgyk"
+jmp *r1
+red r6
+L58: not r3
+L59: .string "rudsxdwxjedpjztrqjlkvpv"
+L60: .string "hleknlbzptmlvqonddb"
+L61: .data 243, 288, -362, -971, 919, -122
+L62: .string "wqfrkplkw"
+L63: .string "kdummzbafvjbuom"
+prn r3
+L64: .data 913, -559, -821, -493, 172, 47
+L65: .string "lhgzratlxjmsik"
+prn #-18
+L66: .data 998, -564, 596, 414, 824
+L67: .string "vyjodfuuaagktwqtolxja"
+L68: .data 658, 904, -946, -9, 167
+L69: .string "nartxvzfgctflmlymdihr"
+L70: .string "brazgrxzpcqqapciyqcpqlm"
+L71: .data -945, 483, 614, 441, -503
+red *r0
+L72: .data 650, 308, -626, -144, -434, -249
+add L173, r5
+not L17
+sub #128, *r6
+L73: .data -639, 138, -269, -580
+L74: .string "qnxkupuvtoulhkvsuube"
+inc *r2
+L75: .string "ybjjahc"
+stop
+L76: .data -317, -13, -147, 246, 214
+cmp L95, *r2
+L77: .string "kbcoadoldrutf"
+
+L78: .string "lqqkizbhettcxwh"
+L79: .data 917, 48
+L80: .string "dfohpxzxjp"
+L81: .data 418, 882
+L82: .string "o"
+L83: .string "iebwtkoxxpgxgnwdegbfblzf"
+L84: .data 737, -757, -748
+; comment
+L85: cmp #250, L12
+L86: .data 780
+L87: .string "sinlg"
+L88: .string "qjwvbunqg"
+mov r6, *r4
+L89: jsr *r1
+L90: .data -674, -739
+L91: .string "mtcxlpqgoemqkqxp"
+L92: .data 204, -269, 459, -292, 511, 819, -177, 19
+L93: .string "hmuljyckktuqn"
+L94: .data 287
+L95: .string "gfxcdrfwbnhswdqlucoi"
+L96: .string "mr"
+mov r5, L234
+L97: .data -687, -85, 553, 338, -304, -177
+L98: .data 149, 975, -850
+stop
+L99: .data -744, -380, 695, 450, -404, -788
+stop
+L100: .string "cxfhmqankdvbstyvvjm"
+L101: .string "xlqsinq"
+L102: .string "jruhybqnfhshpwt"
+L103: .data -685, -575, -456, 933, 905, 922, 845
+L104: .string "ngzmpwnvyfnw"
+L105: .data -649
+jmp L49
+L106: .string "vbdrkehgkage"
+L107: .string "ytrqpoyrdzgh"
+L108: .string "ctdevipwmpbcpg"
+L109: .data -681, 98, 710
+L110: .data -967, 505, -249, 553, 44
+L111: .string "k"
+L112: .data 315, 914, 3, 837, 600, -278, 434, 869
+L113: .string "jgr"
+mov r6, *r0
+L114: .string "juow"
+clr r2
+L115: inc r3
+L116: .data -758, -312, -931, -586, 280, 67, 63
+L117: .data 266, -889, -794, -913
+lea L303, *r5
+L118: prn L32
+L119: .data 897, 342, -978, 576, 292, -96
+sub r6, L143
+L120: .string "wjrxhbuswo"
+L121: .string "sqmmxkjwjltunq"
+L122: .string "nyfrryacxdjbssv"
+L123: .data -373, -126
+inc r7
+L124: .data -196, -232, -363, 129
+L125: .data -588, 33
+L126: .string "ryie"
+L127: .string "fepgodlknbinashyr"
+L128: .string "evqyvfbmpfybvvikwjxcpcw"
+L129: .data 228, 471
+
+mov *r5, r5
+L130: .string "lxwmvumioo"
+L131: .string "vptpchukelpnjbripructzm"
+L132: .data 70
+L133: .string "iqvoghyspnxngsktsqncrb"
+L134: bne *r1
+L135: .string "ntzzhph"
+bne L153
+L136: .data -707, -425, -475
+clr r6
+L137: .string "rnjvnnu"
+mov *r7, L85
+mov *r7, L77
+L138: .data 857, -353, -174, 475, -359, 447, -843
+L139: .string "nuhzcoehfyptsyigakxntoh"
+lea L205, *r2
+; comment
+L140: .string "qsuuzwl"
+L141: .data 855, 364, -63, -363, 673, -775, 366
+L142: .data -163, -72, -820, -224
+L143: .data -476, -253, 558, -619, 784
+L144: .data 190, -651, 221
+L145: .string "stotm"
+L146: .string "sfcturzmorvnukq"
+mov #-78, L118
+L147: add *r7, L46
+L148: .string "lzuzrjemuktnjixvdyb"
+sub r0, L206
+mov L155, r5
+
+L149: .string "inndgegnbjhcnhes"
+L150: .string "ekhkpabmfpbvmpyct"
+L151: .data 428, 785, -674, -742, -6
+L152: .string "xyzvcgrnhthftcdbkb"
+bne *r3
+L153: .data 3, -497, 764, 607, -381, 448
+L154: .string "apjjreyzkovdgzyycatik"
+L155: .string "xrinjjflqazyrfgjdza"
+dec L249
+L156: .string "kvqoeefmgkcfcg"
+L157: .string "wmgszluabng"
+L158: .data 364, -615, -743, -610, -147, 621, 305, -325
+red r3
+L159: .data 234, 800, 167
+rts
+L160: .data -492, -381, 3, 529
+sub #-99, *r3
+mov *r6, *r6
+L161: .data -758, -693, -549, -817, -507, -420
+L162: .data -653, 533, 121, 343, 36, 499
+L163: not L193
+L164: .string "osyizdjjlvsosfw"
+dec L85
+L165: .data -132, 806, 156, 804
+L166: .string "ivhbec"
+lea L226, L118
+L167: .string "vttmjjnbrnkk"
+L168: .data -213, -571, 168, -301, 393
+stop
+
+L169: .string "iqbihweswk"
+L170: prn r2
+dec L194
+L171: .string "jvvwzhfohqbourcvcccexsc"
+L172: add r2, L39
+cmp L255, *r5
+not r3
+L173: .string "giwqxbcxpbqcvrssvtbjr"
+prn *r1
+L174: .data -41, -803, 798
+L175: sub r4, L198
+L176: .string "miwgygesccakvuo"
+lea L226, *r2
+clr r7
+L177: jsr L173
+dec r5
+L178: .string "awtjuwdkxphvrhxvivhtms"
+L179: .data -429
+red *r4
+L180: .string "tp"
+L181: .string "ypxtsfrvbqgpqu"
+prn r6
+L182: .string "zsafgq"
+L183: .string "dubomlyseudoumwabkgud"
+L184: inc r0
+L185: .string "jdqnefr"
+cmp L190, L108
+L186: .data -250, 677, -223
+prn #236
+bne L277
+rts
+L187: .data -914
+L188: .data 304, 907, -875, -614, 127, 88, 887
+dec r3
+lea L297, r2
+L189: .data 17
+L190: .data -500, -878, -261
+add *r2, *r4
+prn L119
+cmp L215, L240
+L191: .string "kz"
+L192: .string "w"
+L193: .string "cnqxzypppe"
+L194: .data -462, -905, 206, -69, -261, 583
+L195: bne *r2
+L196: .string "hqskgcmgofkidv"
+L197: .data 167, -250, 890
+sub r6, *r5
+cmp #-185, #249
+L198: .data 613, 448
+L199: .data 69, -160, -509, 295, -91
+L200: .string "a"
+L201: .data 308, -940, 988, -708, 700, -546, 565, 91
+L202: .data 178, -53, 835, 805, 470, -175, -368
+L203: .string "ad"
+L204: .data 940, 979, 401, 350
+add L263, *r5
+L205: .string "okrljpdpxswa"
+
+sub r6, r0
+L206: add L279, r4
+
+stop
+jmp L274
+jmp *r3
+L207: .data -205, -226
+L208: .string "tkkdellksqarjashxun"
+L209: .string "omqfxbyjtgtc"
+L210: .data -739, -126, 875, -11, 903
+rts
+L211: .string "pkgctw"
+jsr *r1
+L212: .data -420, 915, -364, 703, 488
+red *r5
+L213: .data -612
+L214: .data -903, -499, -640, 8
+L215: .data -864, -14, -458, -59, -623, -96
+L216: .data 101, -436, 617, 632, 850, 523, -82
+L217: .string "bicneiztxtxugnlgbutgp"
+L218: .data 200, 366, -196, 182, -925, -451, -75, 251
+bne L291
+jsr L0
+prn #22
+L219: .data -908, -59, -573, 633, 337, 133, -225
+jsr *r2
+L220: inc r1
+L221: lea L261, *r3
+L222: .data -292, 146
+cmp #-57, #106
+bne *r0
+L223: .string "n"
+dec r7
+L224: .data -967, -862, -448
+L225: .string "ryadxr"
+L226: .data 623, -794, 308, -180
+L227: .string "mkchtki"
+clr r3
+lea L25, *r6
+L228: .string "qoxjou"
+sub L240, r7
+L229: .data 386, 655, 507, 952, 15
+add L298, r0
+stop
+L230: inc r5
+L231: .string "wyfpwykx"
+L232: .string "d"
+L233: mov r5, r1
+L234: .data -149, -809, 289, 370
+L235: .data -825, -822, 351, -461
+L236: .string "egnmt"
+L237: .string "vdmbj"
+L238: .string "hkcxtshciiirgzeszpwada"
+stop
+L239: inc L213
+; comment
+clr L268
+lea L63, L312
+rts
+not r7
+sub r1, L115
+L240: .data 768, -110, -198, 339
+L241: .data -587
+L242: .data 122, -816, 717
+L243: dec r2
+L244: .string "akyvtgym"
+L245: .string "kjmggopgbsewzz"
+L246: clr L186
+L247: .string "igwbfgisfflvt"
+prn *r1
+bne *r3
+add #7, r2
+L248: lea L265, r7
+L249: .string "xacwtzrykylezdwxgbbb"
+L250: .string "hwevpfkadcgrvqphqrrhjom"
+jmp L127
+L251: .string "uepzeemxqnndb"
+not r6
+L252: .data 751, 37, 49, -66
+L253: .data 360, 50, -198, -118, 934
+clr L138
+red r6
+L254: .string "orh"
+clr r3
+L255: .data -414, 460, -790
+L256: .data -486, -164, -766, -232, 615
+sub #-206, L141
+L257: .data 35, -856, -898, -380, 393, -65, -891
+
+L258: .string "fa"
+L259: .string "tdvjvsdmxylplekny"
+red r6
+cmp #-70, L267
+red *r0
+
+lea L4, r3
+L260: .string "nebdtpgodl"
+L261: bne L290
+L262: .string "osmcgwlv"
+inc *r5
+rts
+L263: .data -392
+L264: dec r2
+
+cmp L195, *r6
+L265: .string "wpnlcvm"
+L266: .string "vsubdqowmedqdnp"
+L267: cmp L281, r2
+L268: .string "rjpznxjtqztycudk"
+L269: .data 241, -693
+L270: .string "yojgpvjgncpgahso"
+L271: .string "lpdemrbxdiaawsnc"
+L272: .string "irwufccffzujzedmlkhgup"
+L273: .string "pwzsmjvbore"
+; comment
+mov *r6, *r2
+dec L279
+L274: .data -684, 265, -69, -229, -984, -140
+sub #-25, *r2
+L275: sub L291, *r6
+L276: .data -605, 334, -54, 117, -227
+L277: .data 100, 359, 814, 47, 229
+L278: .data -129, 974, -410, -468, -890
+L279: .string "acvzffgu"
+jsr L293
+inc r6
+L280: .string "frieausg"
+L281: .data -861, 510, -61, -717, 279
+lea L293, r6
+cmp #-227, #195
+L282: inc r5
+L283: .string "qgdpn"
+L284: .string "unobjuaovdenrxdefzmfxsra"
+L285: stop
+L286: .data -316, -392, -147, -834
+; comment
+jmp *r3
+L287: .data -797, 322, -649, 730, -282, -762, -986, -977
+
+L288: .data 675, -295, 577, 336, 911, 667, -522, -482
+L289: .data -598, 240, -98, -308, -415
+L290: .string "floxvetcpwqgapxydw"
+L291: clr *r5
+dec r2
+L292: .string "vhhinkwuzlcwnpwwoeixt"
+L293: .data 674, -988
+L294: .string "rbtpsucto"
+L295: .string "ydmjwpgtyizsd"
+L296: .data -277, -526, 811, 387
+L297: .string "vnku"
+L298: .string "zscnirnbz"
+jsr *r5
+; comment
+L299: .string "ykz"
+L300: .string "uvnwubk"
+jsr L316
+L301: .data -661
+clr r3
+rts
+L302: .data -236, -161
+cmp L304, r4
+L303: .data 213, 487, 286, 861
+prn #-247
+L304: .data -81, -278, -77
+L305: .data 260, 172, 709, -267, -854, -127, -910, 94
+L306: .string "q"
+L307: .data -406, -69, -122, 938, 599, 377, -441
+L308: .data -449, 205, -318, -745, -471, 122
+L309: .data -886, -386, -322, -205
+L310: .string "gg"
+L311: .string "ksbxnnaairmqpclgixxgwwd"
+L312: .string "cktatrqiusadvmvolw"
+L313: .data 139, -795, -214, 120, 142, -16
+L314: jmp L157
+L315: .string "fdksoyiwxpqejpadhntkiv"
+L316: .data -710, -564, -89
+lea L214, r0
+L317: .data -761, 59, 497, -218, -719
+L318: .string "rcopqazzmwcucue"
+L319: .string "hqshjditsrvjolkdmkqbw"
+prn L185
+lea L321, *r7
+L320: .data -417, 902, 45
+jsr L321
+L321: .string "y"
+red *r2
+rts
+sub *r6, *r1
+L322: .data -58, -993, -379, -228
+stop
@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 96
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+L0: .data 470, -298
+L1: rts
+L2: .string "wqheerml"
+
+L3: .string "wznlyqgfva"
+not *r2
+cmp *r0, *r5
+sub L109, L2
+dec r0
+L4: .data 957, -406, -278, 264, -110, 214, -138
+L5: .data -508, -884, 839, -269, -333, 772, -191, -822
+L6: .data -445, -279, 682, -426, 771, -936
+lea L4, *r7
+L7: .string "hbkqyrlfruxpcsdsxawcorzt"
+L8: .data 263
+L9: .string "bp"
+L10: .string "cknsmisjtuchkeitazo"
+red r1
+L11: .string "zxtcnybedgreqgtlxipswszs"
+dec r2
+inc r4
+L12: stop
+L13: .data 672, 444, 364, -724, -544, -345, -129, 338
+L14: .string "xthxpg"
+red r6
+mov r1, L1
+L15: .string "mdhtpuhbqurakoi"
+L16: jmp *r4
+inc r0
+inc *r1
+L17: .string "fgzqtiwwtrq"
+stop
+L18: .string "o"
+L19: lea L24, *r0
+L20: .data -456, 966, -602, -749, -908, -454, 210
+L21: .data -770
+L22: stop
+; comment
+rts
+L23: .string "vojhvep"
+inc L45
+L24: .string "edmrhbvvyshwwhtkg"
+bne L21
+L25: .data 929, 913, 135, -586, -379, 702
+L26: .data -20, 447, -119, 229, -754
+L27: .string "rqvzfqzntapn"
+L28: .data -335, 735, 997, 538, -293, -133
+prn *r1
+L29: sub r0, *r1
+L30: .string "pvexddaefwmxqcmyfr"
+L31: .data -640, 958, -99, 857
+inc r1
+L32: .data -332
+L33: .data -990, -527, 795, 658
+add r6, L82
+L34: .data -356, 977
+
+L35: .string "msjwdnvqnpatgxze"
+L36: .data 435, 766, -65, 714, 416, -815
+prn *r2
+L37: .string "buui"
+L38: .data 695
+not *r1
+add #-93, r5
+add #-48, L25
+L39: .data -932, 575, 910, 614, -327, 593
+L40: .string "qpazzkknqcglfbkdwcaf"
+L41: .string "tyqijp"
+L42: .data 677, 570, 690, 775, -921, 779, 863, -401
+; comment
+L43: .data -609, -302, 959
+inc r7
+mov L5, L16
+clr L309
+L44: .data -739
+; comment
+not r0
+L45: .string "ctltovlgulqihlwsnwase"
+L46: .string "vdwahcejjtitbjqsoz"
+L47: .data 685, 654
+L48: .string "fxqfrk"
+add L274, *r6
+L49: .string "mxzcaqetjylj"
+L50: .string "nlertxdczakiymeyxqsitvxv"
+L51: .string "ejjehjyrqq"
+L52: .data -933, 247, -68, -951, 243, 711, 87
+lea L4, *r3
+L53: .data 469, 535, -564, 53, 799, 44, -284
+cmp #-116, L57
+L54: sub r7, *r3
+L55: .data -288, -120, 104, 672, -155, 507, 909, -99
+L56: .data 246, 50, 607, 23, 211, 968
+L57: .data -984, 811, 759, 906, 187, -61, -362
+L58: .data -852, -751, -328
+jmp *r3
+L59: .data 871, 160
+L60: .data -977, 620, -402, -373, 888, -688, 8, -646
+L61: mov L221, *r0
+cmp #7, *r1
+L62: .string "mticwsovwus"
+; comment
+
+L63: .data 553, -729, -675, 73
+sub r1, r2
+L64: .string "r"
+L65: .data 206, 223, -347, -739
+L66: .data -149, 675, 203, 303, 341, -458, 216, 226
+
+L67: .data 479, 846
+L68: .data -434, -121, 265, -802
+L69: .data -476, -350, 256, 996, 22, 530, 267
+rts
+not r6
+clr *r3
+L70: .data 396, 497, -795, -436, 387, -15, 5, -417
+L71: .data 616, 564, 23, 232, -401, -360, -66
+L72: .data -298, -554, 811
+L73: .data 94, -550
+clr L305
+L74: .string "camlqveuzlqb"
+L75: .data -828, 359, -404
+L76: .string "lunlokdazyhdltnbdvnuch"
+dec r6
+bne L48
+cmp #83, r1
+L77: not r0
+L78: .string "gzolyxjneqakpfesnis"
+L79: .string "wwnuueusuawuqvqqdapp"
+L80: .data -915, 775
+not L52
+jsr L202
+L81: .data -407, -697, -259
+L82: not r6
+L83: .string "lwayxaonuppi"
+stop
+
+L84: .data -98, 703, -299, 851, 719, 706, 159
+L85: .string "i"
+L86: .data 483, -929, 183, 866, 778, 320, -940, -936
+L87: lea L260, *r5
+L88: mov *r2, L16
+dec *r0
+bne L16
+L89: .string "rdfekbpjswn"
+L90: .string "e"
+L91: .string "my"
+jmp L32
+L92: .data -719
+L93: .data -132, 487, -138, -43, -704, 724, -769
+L94: .string "f"
+inc L72
+stop
+clr L44
+L95: lea L317, *r7
+jmp L240
+
+clr r6
+L96: .string "sdptogwowlwutsv"
+mov *r0, L214
+L97: dec *r0
+L98: .data 393, -77, 24, 256, -79, -190, 119, -854
+L99: .data 892, 450, 524
+L100: .data 960, 83, -393, -266, 249, -122, -558
+L101: .data 924, 125
+red L33
+L102: jmp *r6
+mov *r3, *r7
+L103: .data -404, 409, -73, -266
+L104: .data -958, 128, -166, -22, 298, 104
+L105: .string "flnehyzct"
+L106: .string "ctrkkqyiwsxosq"
+L107: .string "vpcygjfjydvdfwqalxaqz"
+L108: .string "taynjhvtoivpfcolzxxi"
+L109: .data -960, -959, 84, -854
+L110: bne *r0
+; comment
+L111: .data 235, -885, 220, -267, 907
+L112: .data 930, -786, 991, -450
+L113: .data -509, -186
+L114: .data 314, 283, -151, 701, -222, -691, 67
+L115: .data 473, -513, -299, -107, 952, -510
+stop
+mov r3, *r7
+L116: lea L181, *r7
+L117: .string "rawravzhjtjdbbyxcbmxndfa"
+L118: .data -769, -659, 663, 23, -148, -473
+L119: .string "xepkhbixsebcqvmwoyjciy"
+add L130, r0
+L120: rts
+L121: .string "auzyorfoxibfdtqqmzw"
+L122: .data 706, 474, -184, 212, 146, 772, -254
+L123: .data 344, 829, 749, 852, -317, 468, -687
+L124: .string "leyvq"
+inc *r3
+
+L125: .string "yndbhqybrssnawalpujzu"
+L126: .data -151, 652, -330, -649, 843, 459
+L127: .string "wtzhydncayoqu"
+L128: sub r5, r6
+L129: .data -126, 205, 600, 928, -338
+L130: .data 790
+L131: jsr L28
+not r7
+L132: not *r5
+L133: .data -585, -725, -702, -701, -222, -970
+
+L134: .string "nfrfcteeqnw"
+L135: .data -609, -869, -509, 918
+L136: cmp L215, L0
+L137: red r3
+L138: .data -702, 172, -10, -690, 207, 106
+L139: .data 170, 32, -784, -260, -817, -203, 580
+L140: .data -186, 521
+L141: .data 138, -725, 76
+L142: .string "mkiqldctfbgjwoettvrpkv"
+L143: .data -834, -825, -142, 88, 42, -621, 363
+stop
+add r5, *r2
+jsr *r5
+L144: sub r6, r0
+L145: .string "pvqskolkft"
+dec *r1
+L146: inc L190
+
+L147: .data -19, -413, -315, 607, 973, 50
+L148: .string "aaywsjhtftivow"
+lea L49, L185
+clr L17
+L149: .data 124, -891, 145
+sub L42, r2
+L150: .string "wcyrnsukflmntvptt"
+dec *r2
+L151: .string "dpwknjhftlppwhgfwf"
+mov L309, *r4
+bne *r3
+lea L188, r7
+L152: lea L314, r7
+L153: .string "yaqxlqdqpmlumr"
+L154: .string "nrvghvdjvagcbi"
+L155: .string "fnxiqnyaetmwucnylbr"
+L156: .data 852, 0, 946, -425, -954, 823, 12
+L157: .string "zjddbasqorttsnkbbhv"
+L158: .data 86, -355
+L159: .string "epfiynglmxzvcz"
+L160: .data -871, -486, 784
+L161: .string "ytuvboqknmgjloimpf"
+L162: rts
+L163: clr L39
+L164: .string "aojhlaazbmzhcv"
+inc L239
+bne *r6
+L165: .data -135
+mov #-25, *r3
+rts
+sub #-190, L259
+L166: prn r5
+L167: .data -912, 384, -158
+L168: .string "zhnyzwait"
+sub r7, L161
+L169: .data -38, -48, -443, -784, -339, 669
+L170: .string "fgnmejfk"
+L171: .string "wtxkwc"
+lea L20, *r4
+stop
+L172: .string "ktqyizgtrdvbebkedxylpmg"
+L173: .data 795, 622, -675
+prn *r5
+L174: .string "malqz"
+L175: .data 382, -731
+L176: .string "rbvokbnbovllvpn"
+L177: lea L291, r1
+L178: .string "ttebqnnlpnibhlzwjeue"
+L179: .data 400, -505
+L180: .string "i"
+L181: .data 733, -754, -42
+jmp L298
+lea L226, *r1
+L182: .data 379, -144, 651, -401, 147, -714, -446, 271
+clr *r0
+L183: .string "flgkmso"
+L184: .string "wdybzngnpiorzwy"
+add *r1, *r1
+add #-37, *r3
+lea L129, *r6
+L185: .string "lwnskinnykqzdvtkxfbq"
+L186: .string "lb"
+L187: .string "ofljnekxvkqb"
+add #-188, *r4
+mov L0, L306
+L188: .string "zrpa"
+L189: .data -959, -32, -214, -882, -76
+L190: .string "rqumdttqq"
+L191: .data 649, 745, -971, 537, 517, -720, 638, -807
+L192: stop
+L193: .data 393, -3, -399
+L194: .string "jiqttphmceahdfuy"
+jsr L176
+L195: .data -873, 95, -365, -406, -679
+inc r2
+
+rts
+L196: .data -548, -968, 948, 284, 109
+L197: .string "sglemrsptwjtzxadqqlpjt"
+L198: .string "uepygjbbzxeehfhsp"
+L199: .data 333, -819
+L200: .data -495, 407, 746, 468, -814, 67, -699, 875
+L201: .string "wwiulhmtvrzuvfmrmvbitohv"
+dec *r5
+cmp *r7, *r7
+sub *r5, L55
+lea L207, L129
+mov L205, r6
+L202: .data -51, -766, 981, -271, -988, 0, -78, 377
+L203: .data 94, 770, 715, 64, 191
+L204: .data 228, -635
+L205: rts
+L206: .string "axgsezsinfymrmvvgerxsvqo"
+L207: .data -86, 965, -738, 234, -833, -194
+not L91
+L208: .string "cisgtsez"
+add *r7, r1
+lea L286, r7
+lea L265, r3
+L209: .string "o"
+L210: .string "ocanndjlubxebmmxgkqvtr"
+L211: .string "kltihyxasyyicognwsbpkxxh"
+L212: .data 785, 104, 223
+L213: .string "ztoraicvyepnsjodivkhs"
+L214: .data -681, -138, 686
+inc L190
+L215: .string "yhitgachadnlcv"
+L216: .string "slcmjowndr"
+L217: .data 658, -45, -641, -564, -514, 783, -582
+; comment
+L218: .string "jckolwphoodvzj"
+L219: .string "n"
+L220: .string "wqqlgquiyurpwfhbxf"
+L221: .string "eipyiucjdxcptqwfrhcps"
+L222: .data 312
+add #-74, L54
+bne L303
+L223: .string "fgrjjpzgyilvtapnvajoac"
+L224: .string "skawdgnrpltxlb"
+bne *r0
+L225: .data 565, -312, 489, 114
+L226: .string "tzwrszqdkevvmmhqgalkje"
+L227: .data -998, 178, -357, -53, -349, 84, 721
+L228: .data 240, -629, -868, -277, 842
+jsr *r3
+L229: .data 134, -319, -530, -671, 937, 581, -43, 51
+L230: mov r4, L288
+jsr L75
+cmp *r3, L313
+
+jsr L289
+L231: .data -278, -663, 815
+L232: .string "ukpvebcfkhtmkbodtxlpeisu"
+L233: .string "wpagalvkcpzjbde"
+inc *r1
+rts
+L234: .data -395, -701
+L235: .string "dlmoxqhrvlmuphgwukyphp"
+L236: .data -766
+stop
+dec r2
+clr *r3
+add #-1, r0
+L237: .string "vsmmkabbwnavvkyxsjmvngkz"
+L238: bne L89
+L239: .data 725, -624
+L240: inc *r3
+L241: .string "vweemvxnqqomnzhyb"
+L242: .string "aozwdepmbrttmuqmtp"
+L243: .string "h"
+jsr L229
+bne L91
+L244: .data -691, 957, -946
+L245: .string "crlzhrvtnddwvd"
+L246: .string "jaavsnsrjzynptn"
+L247: .data -376, 362, 888, 704
+L248: .string "mfrqgppobgwmlmsufedobv"
+L249: .data -630, -319, -404, -983
+L250: .string "tmanorqapjlxrci"
+L251: not *r6
+L252: .data 600, -326, 614, 469, -409, -235, -750, 967
+L253: .data 53, -457, -514, -908, 65, 282, 36
+L254: .data -90, 554, 256, 194, -68, -947, -511, 857
+L255: .string "awicrrtfoiih"
+L256: .string "ykmzrjyamzgrhwlsik"
+prn L42
+; comment
+L257: .data -773, -949, 310, -629
+sub *r0, *r5
+mov #-66, *r6
+L258: .data 837, 953, -298, 665, -286, -935, 878, -291
+stop
+add #177, r5
+sub L57, *r6
+L259: .data 92, 840, 82, 217, 702, 274, -911, -310
+L260: .string "pmzcllncqhdhve"
+L261: .string "feialirngmojoqy"
+L262: .string "cwbwjphlfpiwotfkq"
+L263: jmp L21
+rts
+mov *r6, r3
+L264: .string "pffsbt"
+; comment
+prn *r2
+L265: .string "byylhozotdfexrwaxhhzwu"
+prn *r3
+L266: .string "oe"
+add *r5, *r4
+L267: .string "argivabbevjfr"
+L268: .string "fdcjyg"
+L269: .string "lffndnxafjktn"
+L270: .data -120, 597, 125, -285, -38
+L271: .data 139, -380, -970, -719, 926, 84, 253, -303
+L272: clr *r1
+L273: .string "czpnfkzliscsb"
+L274: .string "ysgxpwptrqnkhqonhb"
+L275: .string "adzmftmniplxtbcq"
+red r1
+L276: .string "vjywhcyfdjmgssrmhrhgvzb"
+sub r1, *r6
+
+red L22
+jmp *r4
+red *r1
+L277: .data 738
+L278: .data 47, -535, 860, -493, -952, -786, -305
+L279: inc *r3
+L280: .data -83, -598, 922
+L281: .string "dzkrhzqmmyif"
+; comment
+L282: .string "lycsmgcpml"
+bne *r1
+; comment
+L283: .data -917, 977, 743
+prn L56
+rts
+L284: .data -162, -303, -244, 23, 311, 41, 98
+L285: inc L296
+rts
+L286: .data -307, -657, -49
+add *r1, r7
+cmp L302, L296
+rts
+jsr L316
+inc r5
+jmp *r7
+L287: .string "npajxfvvuttnvhgbxdneax"
+inc r3
+L288: dec r7
+L289: .string "ictyfgleaxyefgqt"
+L290: .string "gwibtpuhgjayrpriyipbfzrx"
+L291: .data 782, -933, 807, -941, -833, 431, -324, -436
+L292: .data -49, 588, -549, 330, 791, 600, -522, 936
+L293: .data 486, 149, -35
+prn #-67
+L294: .data 353, -983, -816, 167
+L295: mov L306, *r4
+L296: .data -33, -285, 494, -812, -523, 335, 951, -405
+L297: .data -12, 189, 326, -335, -608, -956, -849, -141
+L298: .string "xvsemzgfrmufzoguft"
+L299: .string "ijexomktbuyzde"
+L300: .data 930, -424, 552, 229, 513, -982
+
+L301: .data 352, -900, 80
+rts
+L302: .string "xq"
+rts
+bne *r5
+L303: .data -720
+L304: .string "nsfchoxqoa"
+sub r5, *r2
+bne L216
+L305: .string "ycr"
+add *r0, *r1
+L306: .data 440, -771, 808, -861
+L307: clr r0
+mov *r5, L68
+L308: .data -9, -944
+; comment
+dec *r7
+L309: .string "fjcr"
+inc L310
+cmp r3, *r1
+L310: .data -692
+L311: .string "ndogawmyacnfacij"
+not r4
+L312: .data -496, -876, -718, -329, -87
+L313: .string "wbynuqzooyqlguxtlips"
+stop
+L314: .data -1000, -925, -571, 630, -706, -989
+prn r1
+L315: .data -201, 530, 103, -66
+L316: .string "k"
+L317: .data 776
+L318: .string "kjkbybdyvqdihtc"
+L319: .data -316, -367, -253
+stop
@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 97
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+bne *r5
+L0: .data 760, 533, 571, 61
+inc L0
+L1: .data -350, 895, -981, 148, 390, 689, 423
+inc L56
+clr L64
+dec *r3
+L2: .string "aydthtnhgwbdhttm"
+
+L3: .string "bqlkftg"
+red *r0
+L4: .data -24, -702, 427, -716
+; comment
+L5: .data 94, -702, 168, -423, -812, 832
+lea L199, L75
+L6: .data 417, 405, 790, -224, -63, 413, 505, -694
+L7: .string "pbii"
+jsr *r0
+L8: .string "occzrtzsaiktia"
+L9: .data 553, -547, 277, 631, -603, 574
+L10: .string "pzghtqcevzrtxnunx"
+L11: .data -262, -606, 734, 241, -645
+L12: .string "zbteg"
+mov #-175, *r1
+prn r6
+clr r1
+jmp L114
+mov *r7, L60
+L13: .data 605, 269, 280, 372, -701
+
+
+L14: .string "atwyfjvmherrvwdijmxtwuaz"
+cmp *r2, L129
+L15: .data 588, 273, 715, 478, -46, -242
+clr L264
+L16: .string "lsipqipqgncl"
+inc r1
+L17: .string "bl"
+L18: .string "brojkjgvdedvwdvnro"
+L19: .string "gkkhqujjoqt"
+L20: .string "xyutzmntpwqr"
+L21: .data -443, 137, 591, 562, -711
+L22: .data -277
+L23: .data -996, -741, -864
+jsr L3
+lea L324, L258
+L24: .string "lxqtrbqxjltadn"
+L25: jmp L51
+L26: .string "yjvadr"
+L27: .data 834, 625, -613, -556
+stop
+jsr *r4
+L28: .data -985, 357, 33, 312, 349
+L29: .data -388, -409, -438, 970, -607
+L30: .data -609, -10, 974, 982, -961
+inc L208
+; comment
+add #255, r3
+L31: .string "tpdrqiptmtjsibxkvvr"
+L32: .string "fswqlh"
+L33: .string "vvtnokkqtetiseaiwbwvh"
+L34: .string "tgjhmktpmxzhrhzfrka"
+L35: .data -222, 935, 405, 238, 39, -895
+L36: .data 116
+L37: .string "fhdqqymxos"
+L38: .string "dtjzhlgbgazj"
+clr r5
+L39: add *r2, *r0
+clr L81
+L40: jsr L166
+prn *r1
+; comment
+add *r2, *r7
+L41: .string "ucs"
+L42: .string "bhbpcxvexmpax"
+L43: .data -275, -722, -142, 61
+sub r7, r1
+L44: .string "nq"
+L45: mov *r6, L40
+L46: .string "dxduqnzwlzzpkvzsspyochk"
+L47: .string "eiuhuxlkxgbp"
+L48: .data -486, -637, -681, -881, 365, 692, -235
+prn #-240
+L49: .data -757, 690, -91, -148, -892, -399
+L50: .string "vtjdsqjifq"
+L51: .string "tooiqlskucttwvsm"
+L52: .string "hrjiwrtucdm"
+inc L52
+L53: .string "kqqgezfbudkc"
+prn *r3
+L54: bne L46
+L55: .data -431
+inc *r3
+clr r6
+L56: .string "jetlmofzykrayakynb"
+L57: .data -201, 81, 622, 932, 768
+clr r7
+L58: .string "byl"
+jsr *r4
+jmp *r2
+L59: .data 20, 948, -277, 376, -282, -687
+add L20, L42
+L60: .string "wmdvsfu"
+L61: .string "bcmzaasxnpfsgtf"
+L62: .string "fjqdbxowkyrilzw"
+L63: .data -37, 463, -151, 361, -964, -905, 620, 374
+L64: .data 740
+lea L284, L61
+add *r0, L8
+; comment
+L65: add *r3, *r5
+sub r2, *r2
+prn *r2
+jmp *r6
+L66: .data -319, -936, 987, 104
+L67: .string "n"
+rts
+L68: .data 807, 204, 718, 169
+L69: clr L117
+L70: .data -845, -811, -891, -859, -424, -444, -507, -382
+inc L291
+L71: dec L86
+L72: .string "fuhai"
+L73: .string "r"
+L74: .string "dflhxpz"
+L75: .string "ogzandstgvkkrbv"
+
+L76: .string "rwhapjkgmsohxpusydpr"
+
+L77: .string "ienfcoxx"
+L78: .string "rpycazstqouqknwbipilp"
+mov L319, r7
+L79: .data -565, -951, -909, -781, 420, 967
+L80: .data 719, 288, 773, -716, -71, 925, 119, 28
+L81: .data -716, 377, 700, 55, -99, -823
+L82: .string "fwekjqtpmkljdfxnnf"
+L83: .data 276, -831, 185
+stop
+L84: .data 602, 250, -276, 0, 657
+red *r6
+L85: .data -324, 892, -1, 339, 520, -15
+mov #118, L40
+L86: .string "nmogklgciuehjactrl"
+L87: .data -684, 482, 51, -475, -165, 29, 392, 805
+inc *r2
+L88: sub *r0, L51
+L89: .string "ehoiaejlnlafgyu"
+L90: .data -574
+stop
+L91: .string "qqnrf"
+L92: .data 962, 976, 856, -795, 946, 146, 546
+prn r0
+L93: .data -582
+L94: .string "kngkefdoatl"
+L95: cmp #110, L0
+rts
+L96: .data 926, -353, -668, -303, -682
+L97: .data -92
+red *r4
+L98: .data -162, 415, -887, -609, 696, 394
+L99: add r2, L140
+L100: .string "anrtybmwykaphoppuifugpr"
+L101: sub *r5, L90
+bne L254
+L102: .string "afposteiecunjpwaqmlh"
+L103: .string "fa"
+cmp r7, r7
+L104: .string "mk"
+L105: .string "krqtyorfjpsrfgjfx"
+L106: .data 904, 96, 941, 655
+L107: .string "scxdbepfdo"
+dec L219
+L108: .string "xucyygiw"
+sub *r2, *r7
+L109: .data 352, 33, -957, -609, -912, -136, 838
+L110: .string "lztsuyzxxbclgamrxcjyt"
+jmp L154
+inc L64
+inc r4
+red *r1
+not *r7
+sub r0, r5
+L111: .data 702, -590, 927
+L112: .string "ajz"
+L113: .data -73, 745, -24, -377, -70, 541, -578, -650
+L114: not L206
+L115: .data -199, 971
+red L272
+; comment
+
+L116: .data -571, -740, 343, -193, 22
+add r6, r1
+L117: .data 28, -6, 126, -33, -709, 724
+L118: .string "thhxnysfvnyxu"
+L119: .data 201, -39, -317, 365, 916, -64, 103
+L120: .string "kmmoom"
+mov #-208, L17
+L121: .data -249, -716, 432, -952, -797, 216, -501, -622
+
+cmp #-186, #82
+; comment
+L122: .data -873, 882, 795, -866, 932, -916, 913
+sub L222, r7
+L123: .string "boqotgbzhnieeekg"
+lea L171, L168
+; comment
+L124: .data 804, 181, -930, -487, 149, -740, -198
+L125: jmp L202
+
+L126: .data 376, -215, -215, 563, 481
+L127: .string "tadtyirttlvqqscrsxq"
+inc *r5
+cmp #58, *r2
+L128: .data 725, -290, -893, 7, 658, -932
+L129: .string "uxchaddcjnfxh"
+L130: .data 60, -279, 374
+L131: .string "yhnsxpnfjvsenpzyuix"
+L132: .data -870, -625, 64, 829, 793, 467
+L133: .data 716, -908, -231, 946, 278, 489
+mov r6, *r3
+L134: .data 325, 537, -234, 194
+L135: .string "dimifccbxjvu"
+L136: .string "qeinfsvjkkrep"
+L137: stop
+L138: .data 150, -379, -654, 545, 782, 697
+cmp L224, L51
+L139: .data -217, 33, 300
+L140: .string "mvffzdcpydctdcecsdqatzp"
+L141: .data 249, 270, -411, -911
+L142: .data -339, -998, -283, -778, 594, 299, 636, 868
+sub L46, *r6
+L143: .string "jevrogp"
+L144: .data 428, -359
+mov r4, r6
+
+clr *r3
+cmp L252, *r5
+stop
+L145: lea L54, L106
+L146: .string "dwbulwxddqpgkbgvnjeok"
+cmp #-126, #70
+dec L36
+bne L194
+L147: .string "q"
+L148: .string "fj"
+L149: .string "brnyjraiguhx"
+rts
+L150: .data -386, -808, 413, 257, 307, 601, 662, -261
+L151: .string "woielvukciuwohswvczvmps"
+L152: .string "gkehzbdbarqvmji"
+L153: .string "szgxn"
+L154: .data 695, 218, 19, -687
+not r2
+L155: .string "iehkcbmdcumzfksvby"
+L156: .string "jfjmtsufrifduxfdkgez"
+L157: .data 721, -663, -368, -6
+rts
+L158: .data -373, 495
+L159: .data 486, 270, 920, -625, 870, -193, 770
+L160: .string "mrgefdlftlccrfz"
+red r3
+L161: .string "tci"
+L162: .data -461, -735, 555, -806, -549, -537
+bne L265
+L163: .string "fjmuyfchrmhkmxqftzacywgw"
+L164: .data 742, 187, 502, 77, 5, 788, 473
+jmp *r0
+L165: .string "bfulgonikabhhdv"
+L166: .string "xfffapcu"
+L167: .string "fzuvvdpucatgbnnqfkdu"
+L168: .data -767, 300, 795, -670, 541, 724
+clr L182
+L169: .data 824, -73, -475, 652
+L170: .string "kihqmlulggws"
+L171: .data -980, -249, 285, 934
+L172: prn r6
+mov *r4, *r1
+L173: .string "cqrzkkrytjwgz"
+add r1, r5
+L174: .string "l"
+L175: .string "yrggqitlqgcog"
+L176: .data 19, -439, -318, 471, 737, 216
+L177: .data 417, 347, 825, -868, 729, -998, -818, -662
+L178: .string "elvqirutpisscdzmdvhriak"
+L179: .string "bmac"
+L180: .string "ycrcmyavvhizdzch"
+L181: .string "jtolvaokvdnhl"
+L182: .string "xdvvylskwc"
+L183: .data 491, 724, 561, 235
+add r6, L307
+L184: .string "jcrbrfavqa"
+L185: .string "olbpzzg"
+L186: .string "stuyqle"
+L187: .data 332, 786, 280, 180, -706
+L188: .string "oswvrorfdhhymg"
+L189: .string "osoebxe"
+L190: .string "hmcklhal"
+dec r2
+L191: .string "ecfbrl"
+L192: .data 381, -255, -37
+L193: .data 761, 111
+L194: .string "itjqhbpakfyinhsqnqrw"
+inc L116
+jmp *r4
+L195: .data 711, 488
+L196: rts
+red L137
+jmp *r7
+L197: .string "aazeugjlgorvicurohwkmiff"
+mov *r7, r2
+L198: .data -314, -721
+L199: .data 995, -449, 230, 375
+bne L241
+L200: .string "nzfvsfrlfofwmzrnouuo"
+L201: .data -8, -388, -97, -358, -736, -125, 752
+lea L152, L134
+L202: .string "yidwfwtqigodkrst"
+; comment
+L203: .string "akargnlbwhkznkhkwzdbzsx"
+L204: .string "ggpjkfmxzdzdiou"
+L205: .string "ewagvgcjkynkvnln"
+L206: .data -990, -125, -531, -252, 621, 453, 230, 143
+L207: cmp r6, L115
+L208: .data -488, 65
+L209: inc r3
+L210: .string "wguso"
+rts
+L211: .data -271, -332, -347, 453
+L212: .data 93, 498, -975, 628
+clr L238
+L213: .data 447, -898, 951, 705, -262, -926, 191
+L214: .data 195, -218, -699, -695, 438, -525, -927
+bne *r4
+add L225, r2
+L215: .string "gxwwxmoliueseqz"
+L216: .data -443
+L217: red r5
+jsr *r4
+sub L94, L163
+L218: inc r0
+jmp L268
+L219: .data -376, -422, 902, -176, 500, 895
+bne *r3
+L220: cmp #57, L159
+L221: add #-151, r2
+L222: .data 66, -591, -903, 929, -799, -854
+L223: .data 963
+L224: .data -681, 780, 993, 412, -935, 695, 149
+L225: .string "ulyhjfkn"
+
+L226: .string "pokopgz"
+L227: .data 483, 138, -682, -194, -770, -668, -913
+L228: .string "xdivavnhahfebtqoiuda"
+sub L299, *r7
+L229: .string "hxopwhlejmanqpdusdammg"
+bne L54
+L230: .data 610, 26
+L231: .string "ivjwzyz"
+L232: .string "vs"
+dec r1
+sub #204, L243
+L233: .data -160, 793, 294, 249, -383, -536
+L234: .data -244
+L235: .data -760, -699, -857
+L236: .data -925, 377, 120
+; comment
+L237: .data -416, -341, 541
+red r5
+L238: .data -663, 354, 112
+L239: .data 770, 961, -635, 71, 379, -268, -365, -111
+L240: cmp r2, #-132
+prn #-228
+prn r7
+L241: .string "cwjdarsk"
+L242: .data 339, 651, -736
+L243: .string "eytbuxovmxswngmtpumhwt"
+lea L168, L289
+L244: .string "ecrtvrx"
+L245: .string "xvkhuhvk"
+lea L311, L289
+L246: .data -718, -994, 712, -84, -131
+L247: .string "acqjrgkxkmulsvzeblst"
+L248: .string "nwmnkgf"
+L249: .string "elgnxhhjenyzuipt"
+
+
+L250: .string "kdqcvwoidekgpjidbtafsj"
+L251: .string "cahrlsqsunsgxfeeyxwvbr"
+L252: .data -812, 75, 578
+L253: .data -308, 39, 781, 867, -948, 144
+cmp *r6, L300
+L254: .data -51, -482, 822
+L255: .data 527, -287, 968, 785, 576
+rts
+L256: .string "d"
+L257: .data 289, -339, -228, -226
+not *r5
+bne L267
+L258: .string "caeaiwmfvx"
+
+; comment
+L259: .string "kdcwzorlinjxlu"
+dec *r3
+L260: .data -828, 701, -956, -509, 72, 535, -242, -782
+L261: .data -817, 152
+L262: .data 599, -23
+; comment
+L263: .string "xuncpfbps"
+red *r3
+L264: .data -992, 992, 725
+cmp L129, #-4
+L265: .data -743, -192, -615, -911, -56, 611, 180
+red L267
+L266: .data -124, 195, -964, 733
+jmp *r6
+L267: .string "zdiqsaajbwoeycwwyadq"
+cmp r3, #-192
+L268: jmp *r2
+L269: .string "piqi"
+L270: .string "qea"
+L271: .data 435, -226, -924, 381, -573, 917, -767
+jmp *r1
+dec L37
+L272: .string "uyk"
+L273: .data 495, 263, -348, 115, -247, 157, -451, -885
+L274: .data -271, 852, 602, 240, -511, -328, 9
+L275: .data -759, 275, -351, -501, 819, 159
+L276: .string "bktxtvtedpxkwfvplxboevny"
+bne *r6
+L277: .data -704, -437
+L278: .string "ysijqocsbrevmwirgcrfp"
+inc *r6
+L279: .data 873
+L280: .data -383
+L281: jmp L230
+L282: .data -677, -400, 22, -389, 197, 28
+red *r4
+mov L323, *r0
+L283: .string "wsybtgdnarxhpndgimvwp"
+; comment
+L284: .data -29, 267, 321, -590
+cmp *r5, #-152
+L285: .data -541, -699, 250, -574, 576, -684
+L286: .string "mnjo"
+L287: .string "xuyjqbesptbvjlxnnmqbc"
+L288: .data 281, -360, 87, 853, 162
+L289: .string "ziufgjova"
+L290: .data 631, -9
+dec *r4
+; comment
+L291: clr r0
+prn #-216
+L292: .data 184, -270
+L293: .data 539, 335, -347, -222, 240, 807, -290
+inc r2
+L294: .string "qaldwlltalfjjykhvdewvkaa"
+L295: .data -799, -204, -136, 213
+L296: .string "tfnc"
+L297: .string "nhuviewqwtw"
+L298: .data -450, -875, 596, 994, 130, -723, 738
+L299: prn *r3
+L300: .string "zgudm"
+L301: bne L314
+L302: .data -873, 2, -977, 41, -620
+; comment
+L303: .string "elpc"
+L304: .data 965, -34, -451, -196, 342
+red r5
+dec *r0
+L305: .string "qnedkznbgkogkjchdum"
+add r2, L307
+; comment
+dec r5
+lea L318, L22
+L306: .data -360, 282, 192, -987, -761
+jsr *r1
+add r2, L124
+L307: .data -462, 263, 932, 523, 282, 224, 493, -573
+jmp *r2
+L308: .data 629, -700, -275, 622
+; comment
+L309: .string "vcmipggcjinymifscl"
+L310: .data -786, 266, 86, -819, -545, -663, -977
+L311: .string "levqmzgyhomeygygpkde"
+prn L323
+L312: .data -601, 632
+bne *r0
+L313: .string "lmubhlymzqbzdedc"
+L314: .data 971, -411, 788, 703, 79, -70, -87
+red *r2
+L315: .data 259, -354, 457, -137, -371, 260
+L316: mov r2, *r4
+L317: .data -640, -177
+L318: .string "jslkzbd"
+L319: .string "i"
+L320: .data 108, 381, 968, 719
+L321: .string "hbtkahrxvnfjafblvljgsrdu"
+L322: .string "xibknioe"
+L323: .string "qujg"
+L324: .data -527
+stop
@@ -0,0 +1,522 @@
+; Generated by genCorpus --seed 98
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+L0: .data -138
+L1: .data 719, -354, -667, 89, -7, 266, 535
+L2: not r1
+L3: .string "hg"
+dec L1
+L4: .string "kotgsodowgthkbnig"
+L5: .string "fftolyddcztadcwvsmbgd"
+L6: .string "oqw"
+stop
+L7: .data 508, 212
+L8: .string "nvhwwn"
+jsr *r0
+jmp L2
+L9: .data 55, 237, 701, 804, 255, -997, -716
+L10: .data 892, 332, -992, 578, 982
+add *r4, L1
+L11: .data 277, -414, -463, 108, -266
+lea L29, L265
+inc r7
+jmp L135
+L12: .string "avawzhnfid"
+L13: .data -196, 675, 54, -217
+jmp L162
+L14: .string "farxtqoiycqqxktrli"
+L15: .string "xy"
+jsr *r2
+; comment
+L16: .data 361, -380, 957, -814
+L17: .string "iiiaebq"
+L18: .string "mkhuuyltskttdpxfg"
+L19: .data -573, 237, 155, -400, -696
+L20: .data 913, -5, -104, 234, 904, 819, 811, 902
+L21: .data -63
+; comment
+L22: .string "plrbq"
+L23: .string "apr"
+L24: .data 648, -992, -790
+L25: .data 408, 364, 666, -891, -502
+stop
+L26: .data -953, 589, -122, -393, 192, -249, -559
+L27: .string "oobfyudv"
+jsr L238
+L28: rts
+add r4, L21
+L29: inc r4
+clr *r4
+L30: .string "sxvyyudzoq"
+L31: .data 927, 367, -725, -936, 74, 890
+L32: .data -359
+rts
+not *r3
+L33: .string "dbbkhssdmwhekzb"
+L34: lea L15, *r3
+not L134
+L35: .data 687, -873, 712, 44, 551, -437
+L36: .data -79
+L37: .string "qvin"
+L38: .data 105, -270, -128, 715, 140, 428, 921
+L39: red *r5
+
+L40: .data -38, -78, -657, -214, 338, -653, 510, -332
+L41: .string "onnwfrbjpkfqqzj"
+L42: .string "ociuodajs"
+L43: .string "iplc"
+jmp *r5
+L44: .data 88, 594, -383, 517, -53, 169
+L45: .string "tdad"
+L46: .data -935
+L47: .data -391, 749, -753, 62
+L48: .data 417, -46, -910, -753
+L49: .string "uqsuplswt"
+L50: .data -729, -228, 997, 841, 8, 273, -154
+L51: .string "onettlgjrspcifwmfdnz"
+L52: .string "pgyoebqsf"
+L53: .string "nruwtnlcrzrrsfaqhtef"
+L54: .data 985, -44, -562, -859, -200, 720, 732
+L55: .string "vvvklgje"
+L56: .data -85, 777, 187, 183, -489, -829, 745, -584
+L57: .string "rvtrcnofjblgqgvhymcdt"
+dec *r6
+L58: .string "buwdozqppgtgbzdqqgy"
+L59: .string "pllmtzsvlmtwlhrdlxbeg"
+L60: .data -676, 649, 420, -566, 462, 358, 728, 291
+L61: jsr *r7
+L62: .string "ikjnes"
+L63: .string "sfyvvgfyglc"
+L64: .string "zalpdqerxibnlnsbnx"
+dec r5
+not r2
+L65: .data -121, -132, -974, -986
+L66: .string "m"
+; comment
+bne L171
+L67: .data -218, 210, 421, 747, 693, 52, -934, 370
+inc L165
+L68: .string "fwwvhackflwbzttupechhg"
+jsr *r2
+rts
+sub r3, *r1
+L69: .data 612, 109, 40, 983, -397, -453, 358, -424
+red *r6
+L70: red r0
+L71: .string "cvgruh"
+L72: lea L101, r1
+L73: .data -726, 528, 124, -226, -541, 264, -942, 219
+L74: .string "hjsjcxrzygjolu"
+L75: .data -890, 728, 748
+L76: .data 162, -856, -728, -738, -487
+jsr L52
+rts
+L77: .data -376, 339, 334, 753, 753, -12, -262
+L78: .data 425, -76, 533, -767, 122, 171, 906, 36
+rts
+L79: red L194
+L80: .data 876
+L81: .string "efngddvkqwovgskbdii"
+add L81, r7
+lea L215, *r5
+L82: .string "hrrnjuoayvamnrqxwwnoak"
+red L155
+L83: .string "vlux"
+lea L98, r3
+L84: .string "joxrraybfurs"
+L85: sub *r4, *r2
+L86: .string "zfex"
+bne L37
+lea L22, *r7
+L87: .string "whoraullfwpsgfncmlfewil"
+
+L88: .string "njc"
+bne L0
+jsr L283
+sub r4, r5
+L89: .string "rxgeuswyrsadfpwpllufrout"
+lea L114, r2
+lea L297, r2
+L90: .string "wsdekqmjonwivunnaykoxbeo"
+; comment
+L91: .string "bs"
+L92: .data -461, -585, -812, -487, 130, -783, -885
+L93: .string "alfbngukiuudebyzw"
+sub L301, r3
+L94: .data -901, 203, -882, -284, 776
+lea L213, L255
+bne *r7
+L95: .string "kpaxzgheagpcota"
+stop
+mov r5, *r5
+red L219
+L96: .string "hdcoyqmyekvjtpuj"
+L97: .data 131
+L98: .string "pfr"
+L99: .string "wtzipepznwyzocqrwotbz"
+L100: .data -224, 244, -369, -109, 316, -666, -923, 458
+L101: rts
+L102: .data -947
+L103: .data -262
+
+stop
+L104: .data 987, 975, -228
+L105: .string "spsyhqezomcxesucpsxmfypt"
+red r5
+add L53, *r4
+
+red L54
+L106: .data -337, -35, 709, 508, 394, 620, 818
+; comment
+L107: .data 170, -198, 283, 398, -402, -385, 684, 827
+L108: .string "khdl"
+L109: jsr L39
+L110: .string "sgmrcbllrxuhwrogqhblwg"
+L111: .string "yskqjs"
+L112: .data -749, 826
+not L166
+L113: .data -241, -953, -570, 370, -666, 145, 298
+jmp *r4
+dec *r7
+L114: mov r3, L12
+jmp *r6
+
+L115: .data -85, 124, 129, -195, 116, -547
+L116: .string "lnqpetyfbvlatvbu"
+dec L103
+L117: .string "purfkxzfdus"
+L118: .data 559, -260, 303, 367, -355, 594
+bne L1
+L119: .data 571, 700, 291, -996, -143
+L120: .string "oxhybbwf"
+L121: .string "odogdwesjslhsplg"
+L122: .data 948, -802, -40, -749, -811, -633, 993, 796
+L123: .data 678, -207
+L124: .data -11, -671, 139, -623, 533, 338, -447
+L125: .string "hxtygvycyet"
+L126: .string "qrrvokwlhtorljk"
+jsr *r3
+L127: .string "lqyfgwxgsdyupqsovxnydxhe"
+L128: .string "siblczvx"
+sub #148, L109
+L129: jmp L123
+L130: .string "tnvocylxuykho"
+mov #-95, r0
+L131: .string "qbhnwwyymaatbigh"
+L132: .data 340, 991, 854
+not r1
+L133: .data -734, -416, -579, -308, -877, 128, -266
+; comment
+; comment
+L134: .data 242, 392
+L135: .data -791, 804, -501, -883, -386, 115, -331
+sub #-199, r3
+L136: .string "yqppxpuuggqepkbdoriopxe"
+L137: mov r0, *r5
+stop
+L138: .data 294, -265, 529, 560, 38, 923
+not L92
+cmp #111, *r3
+L139: .string "nflrcnsvmryqvsuywa"
+bne *r1
+L140: .string "ffrsoebiejhdnpgcczams"
+L141: .string "pqjxjgpeo"
+clr r5
+
+L142: .string "vrspwynfqztmrmrxjssfbec"
+sub L196, L128
+L143: .string "xlqogwbnnfw"
+red *r0
+stop
+sub #-190, r2
+stop
+prn L206
+L144: clr *r3
+L145: .data 418, -164, -733, -112
+L146: .data 198, 24, -243, 513, -6
+mov #169, L255
+rts
+dec L176
+lea L59, L91
+L147: red r2
+L148: .string "mkjimtkmcepytxg"
+L149: .data 395, -82, -648
+L150: .string "zkpnykravhalcniwmccfsbro"
+rts
+jsr L130
+sub *r4, *r5
+mov #121, r0
+L151: .data 360, 755, -971, 867, -579, 164, 179
+L152: .string "ilzebfldrbf"
+L153: .string "fcqrnwgqdczgdfywxsps"
+jmp L204
+L154: .data -302, -76, -570, 423, -253
+L155: .data -445, 868, 381, 137
+add *r5, r1
+not *r0
+L156: .string "iq"
+L157: .string "kgqfq"
+jsr L159
+L158: .string "rukvtzgxguslcfhtd"
+L159: .data -338
+L160: .string "maf"
+L161: .string "xxxdwdekcdizpgniaxrr"
+L162: .string "jqmkmmfxagpdypidkpdu"
+red r0
+L163: .data -381, 374, -336, -612, -316
+L164: .string "rufpouugfqejnrcozuhfwg"
+; comment
+L165: stop
+L166: add L212, *r3
+L167: prn #181
+not L74
+; comment
+bne *r6
+L168: .string "ktqjeghodvmuilku"
+add L255, *r5
+lea L264, L163
+L169: bne *r0
+L170: .data -404, -69, 999, -364, -569, 807, 144
+L171: .data 862, -971
+L172: not r1
+L173: .string "hjwb"
+jmp L207
+L174: mov r7, *r0
+L175: .data -15, -820, 542, 954, -107, -919, -87
+cmp r7, #168
+L176: .data -369
+L177: .string "pmgddmzdqwyjtj"
+L178: .string "eyzobwny"
+L179: .data 904, -241, 911, 933
+
+L180: .data 201, 215, -961, -559, 108, 98, 306, 695
+L181: cmp #-122, *r5
+; comment
+L182: .data 616, 732, 212, -208, -93
+inc r3
+jsr *r1
+stop
+prn r3
+stop
+L183: .string "fyngmfxsksxvgkblkpaaqmb"
+stop
+rts
+inc L142
+rts
+lea L165, r1
+L184: .string "kqt"
+L185: .data -957, -131
+L186: .data -857, -470
+; comment
+L187: .data -547, -871, 691, 826, -275
+L188: .string "okkkuuxkdnmozyj"
+L189: .string "kfeuhcamqkwbjvsaqloglg"
+L190: .string "yozxr"
+L191: .string "eavu"
+L192: .string "mclp"
+L193: .string "sxodvarexcecxnlzppgbacdw"
+dec *r0
+L194: .data 592
+L195: .string "dxvacfkybpfkyflfzx"
+L196: .data -70, 585, -614, -231, 79, 822, 274, 482
+L197: bne L237
+inc r3
+clr L150
+mov *r4, r4
+dec L244
+L198: .string "srdexbzivdvanamnrhckvfu"
+L199: .string "ik"
+L200: .data -979, -133
+
+L201: .string "guirvjrfgyiyiraszrrnybf"
+jsr *r7
+L202: .data 63, -230, -755, 598, -567
+lea L260, L268
+L203: .data -882, -476, 375, -656, 878
+lea L155, *r4
+L204: .string "qmjahifvmcrigz"
+L205: .string "yjmtotawhxfldtmnf"
+L206: rts
+L207: add L279, *r2
+L208: .data 942, -145, 778, -792, -408, -8, 549, 453
+L209: .data 630, -220, 239, -624, 303
+L210: .string "ejv"
+L211: clr r7
+L212: .data 285, 421, -862, 443, -280, 717, 599, -946
+L213: .string "ourrnbduubgnuqsqsxw"
+jmp *r1
+L214: .string "avpdza"
+L215: .data 46, 707, -303
+L216: .string "jjhyhysklz"
+L217: .data -803, -248, 897, -583, -154, 997, -668, -641
+L218: .string "jpwgpsksvwtdiugprcqnacz"
+L219: .data -680, 404, -198, -922
+; comment
+L220: .string "tiklgp"
+
+L221: .data -464, -572, 226, -659
+cmp *r3, #0
+L222: .string "nbruslcn"
+L223: .data -834, -20, 988, 172, 93, 669, -295
+L224: .string "jbnifdmozulmlymggrmo"
+L225: cmp *r0, #-210
+L226: .string "tj"
+stop
+L227: .data -213, 815, -574, 371, -889, -256, -655, -858
+red r2
+L228: .string "tpjdzkkmvgdgqcswkymeihxo"
+mov r3, r0
+L229: .data 316, 308, -916, -392, -289, 1
+L230: jmp *r0
+L231: .data -484, -346
+rts
+L232: .string "jgvctrvnvvy"
+jsr *r5
+L233: .string "tnbtgafmeqrxmcnc"
+L234: .string "vjzyzsaeogl"
+L235: .data -719, -866, -598, 437
+L236: .string "dskfpzhvmdghxclhs"
+L237: add #-19, L43
+L238: .data -473, -594, 429, 72, -405, 277, -956, -164
+L239: .string "nicucneeplpphhknytpl"
+mov r5, *r4
+L240: .data 138, -784, 477, 674, 791, 737, 430
+L241: .string "vjkthfgpeeurqwmmlgmjrx"
+mov L290, *r0
+L242: .string "vjeeqskcwifulmbt"
+L243: .string "drmuuynpwhbdnxwboypm"
+L244: .data 364, 251, -223
+L245: .data 814, 491
+L246: add L149, r5
+add r1, r3
+; comment
+not r7
+; comment
+L247: .string "feeyfbjsvvsgk"
+cmp L287, L305
+L248: .string "kuqganmb"
+not r7
+dec r2
+L249: .string "sl"
+L250: .data 900, -566, -840, -853
+L251: .string "prcbjyenlilgnebiopmzzqzc"
+stop
+sub L299, L174
+L252: .data -433, 896, -430, 101, -512
+L253: cmp r0, #-160
+dec L259
+L254: .string "rllmveobfwnrqior"
+cmp #129, #128
+L255: .data -869, -59, 954, 148
+L256: .data -483, 924, 890, -270
+L257: .string "vxumqtqxxrvv"
+cmp r2, #-4
+dec L259
+stop
+L258: .data 173, -762
+jsr *r0
+L259: .string "zuyxbnaofsrnkjt"
+L260: .data 247, -946, -236
+L261: .data -139, -134, -853
+
+L262: .data -138, 973, 109
+L263: .data -684, 131
+L264: .data 773, -646
+prn *r1
+L265: mov L308, L303
+L266: .data 213, -259, -278, 625
+clr r1
+not r5
+L267: .data -352, -248, -290, -355, -530, -790, -754
+; comment
+L268: .data 309, 598, -80, 901, 276, -521, -719, 57
+L269: .string "mqyaqwpjufyppiu"
+L270: .data 983, -755, 931, -710, 591
+jmp *r3
+L271: .string "yczmjvagesrqiiqknag"
+L272: .data -195, -615, -368, 664, 206, 529
+L273: .data 880, 510, -451, -422, 573, -145
+stop
+L274: prn #-157
+L275: .data -398, 392
+mov #-195, r6
+bne *r0
+L276: .data -983, 255, 790, -846, -21, -906
+L277: .data -115, 275, 909
+L278: .string "wzwbcvdesstxdzrswb"
+prn L305
+L279: .string "mgtcfdippdigdurkvm"
+L280: .string "snw"
+L281: .data 137, 12, -52, -135, -102
+prn #-6
+not r2
+L282: add L314, r3
+L283: .data -769
+L284: .data -591, 199, -826
+L285: .string "wfdvcjukskuqxlvl"
+jsr *r4
+L286: .data -363, -428
+L287: .data -404, 879, -775, -474, 212
+L288: .string "dhxtcwqjqqawkhtn"
+L289: .data -675
+L290: stop
+; comment
+L291: .string "hynglcc"
+prn #9
+L292: inc r1
+L293: .string "wd"
+L294: prn *r3
+cmp r4, r6
+stop
+L295: .data 688, 365, -209, -864, 840, -559, -531, -95
+not *r5
+L296: .data 640, -749, 46
+L297: .string "nmvaqlwd"
+L298: .data -499, -793, -597, 511, 752, 38, 558
+red *r1
+L299: .data -743, -449
+sub r5, *r3
+
+rts
+L300: .string "sjhutwvf"
+L301: .string "bfywaqgutsrjx"
+L302: dec *r0
+L303: .string "k"
+jsr L309
+L304: .data -211, -908, 276, -190, 184, -68, 711, 702
+
+inc L307
+L305: .string "sqrvfpwdlyhnriqtds"
+L306: .string "uapmjrupmvhvikieuyxkxb"
+L307: .data -925, 575, -226, 574
+jsr L42
+L308: .data 676, -97, 388, 315, 575
+L309: .data 78
+L310: .data 533, 345, 960, 74, -507, -682
+L311: jsr L15
+L312: .string "znsamcvsvlmghjpuslb"
+L313: prn *r1
+L314: .string "rmnrbmzhbjzkghgyq"
+clr *r6
+L315: .data 96
+L316: .string "ewgezndsuimzidtljlrwjv"
+add r0, *r4
+stop
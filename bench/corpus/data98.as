@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 99
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+jsr *r6
+L0: .string "kkqkkbqzavdneu"
+L1: .string "rqbjujxtaoj"
+L2: .data -858, 340, -846
+L3: .data -258, -249, -192, 213, 984, 660, -937, -503
+; comment
+L4: .data 297, 577, 826, 849, -569
+L5: .string "fhficsw"
+lea L329, r4
+L6: .data 282, 355, -807, 746, -840, -785, -267, 288
+L7: not r4
+L8: .string "eznhato"
+L9: .string "gtsvwiinymixg"
+; comment
+L10: .data -113, -16
+bne *r5
+
+L11: .data -817, -328, 873, -138
+L12: .data -213, -844, 257, -728, 811, -634, -431, -756
+L13: .string "itut"
+jsr L2
+L14: .string "gdibuuqjmpkungmksqiyqv"
+L15: .data 229, -630, -634, 935, 595, 308, 781, 995
+L16: .string "csdwrf"
+L17: .data -985, -573, 522
+L18: .string "lqeqcbmltqswwffxsrcln"
+L19: .string "kafpignwj"
+L20: .string "zleezpwdmpam"
+L21: dec *r3
+L22: .string "wq"
+L23: .string "jrbqm"
+jsr L275
+L24: .string "ydnwcgotbsg"
+L25: .string "fjldzqoqmflnwij"
+bne *r6
+cmp r3, r2
+L26: not r2
+L27: .string "hfrnjjeoqryfgddfylpifl"
+L28: .data 425, 616, -405, -354, 64, -992
+L29: .string "wknjhwizvltw"
+L30: .string "onelxgtu"
+; comment
+L31: .data 391, 551, -360, 675, -433, -534, -196, 789
+L32: .string "z"
+not L92
+L33: .string "jpvcezximewsn"
+L34: .string "lyoxl"
+L35: prn L249
+lea L219, L19
+L36: .string "qbfcmdmkgmzde"
+sub *r2, *r1
+lea L20, L26
+L37: bne L42
+; comment
+L38: .data -562, -438, 379, -303, -682, -487, 109, -908
+L39: .data 82
+L40: .data -155, -889
+L41: .string "wpwhxfroynalyslzvlvh"
+L42: .data 982, -489, 348, -661, 984, -797, 981
+L43: .string "aecoyrliuflwwltxn"
+L44: .string "uix"
+
+jsr L322
+prn L169
+L45: .data -462, 567, -803, -641
+L46: .string "kcytl"
+dec r5
+L47: inc L189
+L48: .data 276, 551, -646, -230
+L49: .data -944, 540, -152, -320, -211
+L50: .string "qg"
+L51: .data 991, 780
+L52: .data 210, -377
+L53: .data -966
+L54: .string "dgcujakgtvi"
+L55: .string "tlrvjvh"
+dec r1
+jmp L298
+L56: .string "nurcuxmairbzzymdymidur"
+L57: .data 251, 848, 226, -498, -224, 66
+cmp L27, *r6
+dec L247
+; comment
+stop
+L58: .string "yugkq"
+L59: .string "qzkptrjirbmpvj"
+L60: dec L199
+L61: .string "m"
+L62: sub L59, *r5
+lea L56, *r1
+L63: .data -541, 819
+L64: .data -217, -747, 300, -159, -92, -982, -327, 492
+prn *r4
+L65: .string "cc"
+L66: .string "qnpifpsrinyxpual"
+not r2
+L67: .data 5, 36, 684, 895, -673, 501, 46, -461
+L68: .data -939, -150, -478, 546, -360
+L69: .string "zqyd"
+L70: .data 870, -123
+L71: .string "oyewr"
+red r1
+L72: .string "jhsbmtpwzfabkzwlqkikqrv"
+L73: .data 359, -52, -403, 99, -329, 166
+L74: .data -560, 161, 562, -70, 678, -797
+red *r7
+L75: .data 241, -171, 524, -574, -258, -733, 553
+L76: .string "s"
+L77: .string "idbkctrtrombstdqka"
+L78: .data -21, -646, -941, -836, 245, -774, 903, -763
+L79: .data 901, 887, 412, -947
+lea L251, r1
+L80: .string "jxswrhdqkuhfvvjys"
+L81: .string "bmvfchqryspvyhj"
+L82: .string "jjb"
+jsr L134
+clr L193
+L83: .data 597, -983, 506, -199
+L84: bne L17
+L85: dec r4
+L86: .string "ahaxrvqhitb"
+L87: .string "bjdssetpvjmkykmkmqviqm"
+L88: .string "lscguxqfo"
+L89: .string "z"
+L90: .data 222, 798, 758, -702, 869, -690, -398, 330
+not *r2
+L91: .data 582, 307, 282, -355, 505, -765
+L92: .data -946, 665, -356, -170, -595, -281, 35, -844
+L93: .string "iuyfvqqnrtljji"
+L94: .data -424, 632, 809, 971
+cmp r4, *r0
+; comment
+L95: .string "wxdbgfrwtizpvobsuvjdz"
+L96: .data 951, -275
+L97: .string "qqtrxf"
+L98: .data 273, 640
+lea L44, *r3
+L99: .string "xtkldq"
+jsr L95
+L100: .data 663, 443, -478
+L101: .string "vyrvnxguamvghubidlzb"
+
+L102: .string "huviyhwzugyd"
+L103: .string "daqmacnhxqykcusm"
+L104: .string "ysrglbpckfqkqdgekp"
+clr r7
+L105: .string "hwxehmxviyccjv"
+L106: .string "xsakjxyodwtqu"
+L107: .string "pvoqaamuytlihktfkkn"
+L108: .string "zrcrknfjqqnbzrflxbslhxnq"
+jmp L110
+; comment
+clr L35
+L109: .string "hghhhj"
+L110: .data -861, -798, 561, 804, 268, 541, 605, 815
+inc *r1
+jmp *r1
+L111: .data 250, -873, 867, 73
+L112: .string "depoqogtqjgtlb"
+L113: .string "xtqdxckwdgxj"
+bne *r5
+; comment
+L114: .string "kfrwgmvznmmnlyeyqgkdtzof"
+L115: clr L111
+L116: .string "sculprhzpnwjbdjvsei"
+L117: .data 145, -986, -264
+L118: .data 989, 193, -292, 439, 475, -65, -528, -800
+L119: .data -290, 723, -376, 869
+L120: dec L255
+red r4
+L121: lea L225, r4
+L122: .string "dlcvccrarvqwsplfhoar"
+L123: .string "iutjvvat"
+L124: .data 373
+; comment
+L125: .string "jfzjyjdtxcyimnsfgqmwv"
+clr L58
+jsr L73
+L126: .string "snofmakijxeixq"
+L127: clr L10
+L128: not r7
+not r5
+L129: .data 378
+L130: .string "ttisxk"
+sub *r2, r5
+L131: .data -579, -984, 877, 52
+
+L132: .data 187, 138
+L133: .data 612, -456
+stop
+L134: .string "uuqkqhsejgjmoj"
+; comment
+sub *r2, r6
+red *r1
+cmp #183, r4
+clr r6
+dec r1
+; comment
+L135: .string "tyyyzwhcnjjhmij"
+L136: .data -481, 569, 636
+clr r6
+lea L127, L223
+L137: .string "htshar"
+prn r5
+L138: .string "qkxxztslnkdmwiqd"
+L139: .string "jjqusurrmbariegriyguuw"
+L140: .string "aj"
+L141: .string "owybuonxvsfimkfpkaas"
+L142: .string "ewrtj"
+add L102, *r1
+L143: .data 282, -141, -292, -887, -575, 318
+inc *r6
+L144: stop
+L145: .string "nr"
+lea L236, r5
+L146: sub L142, r0
+L147: .data -519, -842, -346, -255, 295, 23, 581, -429
+L148: .data -670, 158, -90, -196
+L149: .data 722, -143
+add *r2, r0
+L150: .data 912, 482, -394, -793, 862, -976, -304
+; comment
+jmp *r4
+L151: lea L91, *r7
+L152: .string "uxnoxwovkeajycm"
+; comment
+L153: .string "qcujlqamyuzgruanalngfz"
+L154: .data -307, 238, 615, 564, 135
+; comment
+L155: .data 991, -702, 564
+dec *r4
+L156: .string "vqwmcbsrvnyl"
+L157: .data -262, -569, 361, 269, -149, 293
+L158: .data -862, -56, 486
+L159: .string "xqeojfuorblrpyvuegrg"
+; comment
+stop
+L160: .data -273, 697, 294, -183, -560
+lea L53, *r1
+L161: .string "jrqeruvuoyv"
+L162: .data 842, -305, 439, -138, 168
+L163: jsr L272
+stop
+L164: .string "ezwxiykqkgzb"
+rts
+L165: .data 971, 28, 981, 719, 643, 724, -598, -305
+red r1
+L166: .data 306
+; comment
+stop
+L167: .string "qljqyhcm"
+L168: jsr L330
+; comment
+L169: .string "ozw"
+L170: .string "wgtfke"
+clr r5
+L171: .data 88, -417, -7
+L172: jsr L259
+L173: .data 418, 922, 721, -399, -974, -537
+dec *r5
+L174: .string "eqbyhnppsafwxwusixhqz"
+L175: .string "yssmfzhqorcpcnfjnzie"
+L176: .string "npbegbtfmdkmosn"
+L177: .data -498, 663, -183
+rts
+rts
+L178: .string "swdzqmzuzsqywqtsrd"
+L179: .data -37, 137, -163, 975
+L180: .string "qdkylgpyx"
+L181: .data -157, -509, -644, -900, 928, -400, 378, -555
+dec L306
+rts
+L182: .string "lgvftmduvvmlxhypurulxosw"
+L183: red *r6
+L184: .data -294, 381, -572, 841, 291
+lea L319, *r1
+L185: cmp L197, L1
+L186: .string "kjekncnjlryrjhdcpygpw"
+sub #69, *r0
+stop
+; comment
+L187: .data 531, -725, 225, 677, 544, -543, 742
+L188: .string "qanpjneuajzsqjtqglkedal"
+L189: .string "ntdfjfvkredzeuiyo"
+L190: .data 314, -471, -751
+jsr *r5
+L191: .data -198
+L192: clr *r6
+L193: .string "vmbs"
+not *r0
+prn #78
+bne L105
+L194: .data 927, -843
+L195: .string "zsentzhgbgp"
+L196: .string "gnzdsauhreur"
+L197: .data -675, 727, 774, -939, -563, 880, 941, -13
+L198: clr *r4
+mov *r3, L13
+stop
+L199: .string "bswaozcyljcm"
+L200: .string "kf"
+L201: .data 952, 804
+jmp *r6
+red L117
+L202: .data -501, -755, -340, -724, -923
+L203: .string "nipfriqjfmagjzlyodisubli"
+L204: .string "bkchulkvjfgtplo"
+L205: .string "iyb"
+add r0, L329
+L206: .data 960, -131, 712, -318, 884, 393, 113
+L207: .data 779, -186, 352, 203, -577, -618, 120
+inc r2
+; comment
+prn *r5
+L208: .data 795
+L209: .data -772, -666, 495, 612, -455
+L210: .data 391, 906, 501, 806, -179, -563, 753, 406
+L211: .data 534, -583, 636
+L212: .data -996, 120
+clr r3
+L213: not *r5
+L214: .string "bsuaktltiwrcdcxcppczco"
+L215: jsr L188
+L216: .data -936, 874, -809
+
+L217: .data -796, -658, 494, 373, -743, -558, -535, 828
+L218: .string "yrncvy"
+L219: .string "ni"
+L220: .data 541, 99, 115, -49, -974, -403, -861
+not L309
+L221: .string "jalliesgkqzrfrto"
+L222: .string "dgxxxqrkgbytnxgwlwmzralb"
+L223: .data -545, -656, -241
+L224: jsr L300
+mov r5, r3
+L225: prn *r7
+L226: .data 835, 73, 757
+L227: .data -702, 741
+; comment
+L228: .string "oibkuqhhulzzjtbdzlrfpnxk"
+L229: .data -631
+jmp *r4
+L230: inc r3
+L231: .data 512, 449, 963
+L232: .data -980, 354, -85, 899
+L233: .string "nbajaucwjiicvoxkphe"
+L234: .string "ahxigvkuikmtthmzuqpa"
+L235: .data -482, 552, 229, 524, 74, 515, -340
+L236: .string "wsvyrfzsnxtrkpsw"
+L237: .string "jwbnaenraibuuhoskybzzbco"
+L238: .data 205, 403, -67
+L239: .string "tosixcgktailvizlekbptrh"
+L240: .string "zureakrhqtxsmetq"
+
+L241: .data 240, 664, -769, 984
+clr *r2
+L242: .string "scbdpdlghzpbscgapqsnvyri"
+L243: .data 458, 621, 904
+L244: .string "gqxnqulhpdtpzpij"
+L245: .data 511, -311, -83, 851, -639, 891, -215
+lea L157, r7
+clr L295
+jsr L272
+L246: .data -707, 698, 566, 231, 519
+stop
+L247: .string "xylbkhuqdyidgujjffeos"
+L248: dec L39
+L249: .data 690, -846, -101, -924, 209, -344, -252
+mov *r4, *r5
+rts
+clr *r0
+L250: .string "n"
+L251: .string "lflz"
+L252: .string "tpxfdpbyuij"
+clr *r5
+L253: .string "liop"
+L254: add L160, r2
+L255: jmp L330
+red L1
+L256: .data -468, 994, 924, 815, 646, -753, 346, -108
+rts
+rts
+L257: .string "pfapwtfznpjfekduqgflcyo"
+L258: .string "u"
+L259: rts
+L260: .string "bdjgtzdvczv"
+stop
+add L45, L159
+L261: .data 764, -841, 392, -589, 81, -479
+L262: inc r2
+cmp *r5, r7
+lea L310, r1
+jsr *r3
+; comment
+rts
+L263: .string "tndgezegvgnbujgydeeqm"
+L264: .data -520, 374, 120
+L265: inc L313
+L266: .data -478, -552, -865, 841, -601, -543, -3
+L267: .data 464
+clr L261
+L268: .string "gktvllcresboxtwshytv"
+L269: .string "uktcovvng"
+jmp *r0
+L270: .data -492, -310, -650, 424, -781, 821, -682, -197
+bne L173
+L271: .data 857, 893, -879, 314, 157, 511
+L272: .data -331, 541, 234, 570, -170, 883
+L273: .string "qgaqawtu"
+L274: .string "flkwleyshypxmzknm"
+mov L326, r3
+lea L28, r1
+L275: .data -93, 409, 283, 597
+L276: .data 991, 324, 183, -506, -373
+L277: .data 254, 764, 440
+cmp r2, L116
+dec L322
+add r6, L41
+L278: .data 299, 152, -82
+clr *r6
+L279: .data 406, 335, -975
+L280: .string "nwekquywissknitw"
+L281: .data -289, 425, 191, -629, -607, 658
+dec L313
+L282: .string "upj"
+L283: .data 374, -652, 589, -521, -769, 701, 151
+L284: .string "xlieguyzjanlua"
+L285: .string "l"
+L286: .data 268
+inc *r0
+sub *r7, *r5
+bne *r7
+L287: .string "diznspzevqbvjircsyztz"
+L288: .data 606, 307, 947, -17, -35
+dec r3
+L289: .string "shzpcjuoybyqsbw"
+L290: .data 480, 61, -546, 270, -110, -77, -366, 8
+L291: .data 45, 532, 925, -782, 148, 669, 541, 895
+L292: .string "ygytaccmikbpdkskcix"
+jmp *r6
+mov *r0, r3
+jsr *r3
+inc *r5
+L293: .string "mwtjirgoxcdesrabzbojyw"
+L294: .data 667, -628, 259, 63, -754, 279, 545, -309
+L295: .string "aejlbdepkam"
+L296: .data 592, 791, 718, -719, 607, -350, -106
+L297: .data 263, -24, 101, 894, 850, 14, 752
+red L319
+L298: .string "zjpeuodf"
+L299: dec *r3
+L300: .data -664, 485
+sub L179, r1
+cmp L150, r4
+L301: .data 780, -81
+jsr *r5
+L302: add L281, *r3
+L303: .string "txmxnb"
+L304: .string "vcngytgiahebtab"
+clr L65
+L305: .data -938, 401, 177, 641, -993, 150
+not r6
+L306: .data -4, -660, 206, -266
+prn L313
+L307: sub *r6, L58
+L308: .data -262, -878
+L309: .string "pysvebmngqndj"
+L310: .data -253, -835, 872, 39
+bne L19
+L311: .string "opdjnrftsur"
+L312: .data -176, -659, -220, 404, -513, 615
+L313: .string "bhatxmjtxhfiz"
+rts
+L314: .string "baxpmlbmnue"
+stop
+L315: .string "xjbgppzmps"
+L316: .data 950, -368, -518, 741, -460, -102, -245
+L317: .string "pnnkyoukylrilidgqv"
+bne *r6
+L318: .data 817, 120, 93, 561
+L319: red *r6
+L320: .string "mhgeokahhdhckbb"
+jmp L9
+jsr L311
+L321: .string "ocb"
+
+rts
+
+; comment
+L322: .string "j"
+L323: .data -49, -231, -22, -312, -10, 501, -674
+L324: .string "diviideywfmocnqpmcy"
+L325: .data -645
+L326: .string "saafzjatriwdidddgrv"
+L327: .string "xfxapclklvjwwh"
+L328: jmp *r1
+L329: .data 750, -530, -991, -763, -290, -88, 39
+clr *r3
+L330: stop
+mov L111, r1
+stop
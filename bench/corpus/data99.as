@@ -0,0 +1,523 @@
+; Generated by genCorpus --seed 100
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: .data -728, -726, -562
+L1: .data 806, 279
+L2: .string "ysedsjpnhqmgehgelkz"
+L3: .data 661, 961, -348
+L4: .data 7, -55, -81, 127
+L5: .data 178, -890, 203
+inc r6
+; comment
+L6: .string "fqtojetlmngozuqd"
+L7: stop
+L8: .data 430
+; comment
+L9: .string "kidxmgzyzbd"
+L10: .string "yktiooikqo"
+L11: .data 958, 919, -136
+L12: rts
+L13: .string "bpcndxcarvo"
+L14: .data 165, 489
+jmp L3
+L15: .string "upuqrjornbeah"
+L16: .string "iyivhsucduj"
+L17: .data -686, -254, -274, 859, 807, 272, 339, -954
+bne *r3
+cmp r7, #-174
+L18: .string "qicfszlzbklfsqlkdmh"
+jsr *r6
+L19: .data 503, 308, -191, 590, -231
+bne L274
+L20: .string "xlysyvaqktifx"
+L21: .string "sfctrjxwjdgn"
+L22: .data -424, -411, 630, 169
+L23: .data 121
+L24: .string "typacunjosqinjfjrrf"
+red r2
+L25: .data 890, 957, -622, -951, 884
+L26: .data 342, -645, 287, 40
+L27: .string "rljay"
+L28: .string "igmrcbkuaovezhr"
+rts
+L29: .data -364, 132, 596
+inc L286
+L30: clr *r7
+L31: .data -731, 35, 126, -758, 985, 91, 678, -730
+L32: .string "fairbbffvvstxtafcdootdyw"
+L33: .data 27, 24, -579, -44, -973
+rts
+L34: .data 947, -735, 222, 691, 585, -174, 426
+lea L24, r3
+L35: .string "bngiruojcmj"
+L36: sub #136, r5
+L37: not L122
+L38: .data -91
+L39: .data 343, 629, -698, 855, 2, 709, -628, -314
+add L163, L20
+L40: .data -498, -921
+lea L28, L107
+add r7, L22
+L41: .string "seogbdvhvtfxohqlhkfjl"
+L42: .string "ngksskkljtwbp"
+jsr *r3
+L43: bne L29
+L44: .string "scpbqohajuaofkca"
+mov *r0, L230
+L45: .data 776, -513, 111, 479, 890, -624, -648, -651
+L46: .data 209, -391, -123
+L47: .data -638, -893, -823
+L48: .string "qsslrj"
+lea L230, r6
+jsr L143
+not *r6
+L49: .data 142, 928, 339, -352
+L50: .string "gepibwlng"
+L51: .data -852, -61, -525, 19, 909, -55
+L52: .string "xmwgyjbnebidfqajud"
+; comment
+L53: .data 524, -563, 826, -561, -789, -368
+L54: .data 15, 859, -83, 865, -823, 610, 879, -254
+L55: .string "d"
+clr L51
+clr r5
+sub #54, L284
+L56: .string "ivri"
+jsr L140
+L57: .string "izebqyopdhxgr"
+L58: .string "foxttpseokcspzo"
+L59: .data -862, 965, 370, -840, -183, -988, -66, 813
+L60: .string "tobzubbzrf"
+jmp *r2
+L61: .string "xqdajrldxwnmkjs"
+L62: inc *r6
+L63: cmp L1, r4
+L64: .data -929, 24, -101, 320, 342
+red r5
+L65: .data -143, -49, 241
+L66: .data -436
+sub L30, r4
+L67: .data -805, -612, -774, 737, 996, -193, -723, -669
+L68: .data -105, -309, 871
+L69: sub r6, L94
+L70: .string "zibqnnsqlcbcsxweo"
+L71: .data -221, -872, -470, -942
+L72: .data 77, 459, -253, -99, 946, 846
+cmp L61, #43
+L73: .string "gtbttaknhykdwfruilppbte"
+L74: .string "tghvopbwmysxyvihtozhc"
+L75: stop
+L76: .string "hauorsifiuk"
+L77: .string "zuoyuztznxg"
+L78: .string "ijqtkwbihvikldsitllylkku"
+L79: .string "gg"
+dec r6
+L80: .string "isps"
+L81: .string "irtolcnanriyagepgdzper"
+L82: .string "bulimmcdnqpxhrgslodgxb"
+L83: .data -988, -485, 200, -613, 463, 655, -1000, -720
+L84: .string "omddschdihqzzyspbmvzbm"
+bne *r1
+L85: .data -97, -188, -357, -960, 21
+lea L49, r7
+L86: .string "lrsajtr"
+L87: .string "viufbudpzaxsevvykps"
+red *r4
+inc *r7
+; comment
+L88: .string "bxrbxygs"
+L89: .string "jcnih"
+L90: .string "qblxobemgwnqfvshytnpwxi"
+L91: .string "buuugyp"
+L92: .string "j"
+L93: rts
+L94: .string "tbxvccvvqtojnbhsvyxleti"
+L95: .string "xesubjndcqosv"
+L96: .string "sfkinbtqvpxhrp"
+bne *r0
+bne *r5
+L97: .data -336, -977, 843, 196, -742, 563, -415, -650
+L98: .data -851, 151, -656, -545
+prn *r4
+L99: .data 8, -253, 312, 42, 552
+clr *r0
+L100: .data 244, 581
+L101: .data 627, 413, 366, 790, -695, 124, -314
+add #217, r0
+L102: .string "ctrhftujszyvgrzadghol"
+prn #-171
+add r3, *r0
+L103: .data 140, -40, 189, 179, -929, 501, 561
+jsr L4
+L104: .data 649, 410, -471, -643
+L105: .string "hytobgexgzpoegggogis"
+L106: .string "umsrltrvjnxlyesomcdghbci"
+L107: .string "idjaxzlj"
+L108: mov #192, L54
+L109: .data 351, 9, 139, 688, 909
+L110: .string "rc"
+; comment
+L111: .data -983
+L112: .data -692, 417, 531
+L113: .data -477, 743, 282, -357, 607
+L114: add L184, r4
+L115: .string "faildjbakoycrqllyvknun"
+L116: .string "xqrvwgmnbxycxmwqrv"
+L117: .string "nxdafojof"
+L118: .data 797
+stop
+clr L110
+not L16
+jsr *r1
+L119: .string "drudsmxim"
+L120: .string "fztxdbg"
+L121: .string "tbqi"
+L122: .data -854, -84, -472, -907
+red L136
+L123: .string "pvicjhn"
+L124: .data 630, 886, 902, 443, 96, 715
+L125: jsr L172
+L126: .string "puikeixykmkessmu"
+L127: .data 388, 787, 47
+L128: not L271
+L129: .string "ice"
+L130: .data -976, 485, 107, -672, -560, -167, 596, 3
+L131: .data -488, 470, -314, -9, -546
+L132: .string "vrutudkx"
+L133: .data 443
+L134: .data 269, -478
+; comment
+L135: .string "nvfqexslbnkhijhbxnmnnji"
+L136: .data 527
+bne *r4
+L137: .string "qsfawme"
+red L278
+L138: .string "lajff"
+; comment
+L139: .string "svyywczrlmprtqowdpsfvb"
+L140: mov r4, r6
+clr L249
+mov r1, L7
+dec *r7
+add *r6, r4
+inc *r7
+L141: .string "v"
+L142: .string "kuzbxfuxyvoozemfzlfzl"
+clr *r6
+L143: .string "zmjbeufzcbsirxqoa"
+L144: .string "as"
+L145: .data 575, 226, -701, -862, -128, 842, 176, 46
+L146: .string "dhgnx"
+L147: .string "dhnhbmzxymssiytvlbenwed"
+L148: .data -288, -545
+L149: .data -133, 754, 480, 518, -286
+L150: .string "nokqjurxnfytkxetyfzcdvvs"
+clr L215
+L151: .data 838, -892
+L152: .data -392, 995, -684, -624, -827, 107, -298
+L153: stop
+; comment
+; comment
+L154: .string "xxydtkq"
+L155: .data -428, -781, 73, -765, -508, -669
+L156: .string "dl"
+jsr *r4
+cmp L39, *r3
+L157: red L9
+L158: .string "ecqsgvlqbhvtmaghmnuizua"
+lea L106, L150
+L159: .string "vngtrewit"
+L160: stop
+L161: .string "ir"
+L162: .data 283, 11, -562
+L163: .string "pkwbuzcsjiomodzhpzrqoiw"
+L164: .string "pmpjijfpz"
+lea L257, *r3
+L165: .string "kqctwuzax"
+cmp *r0, *r5
+bne *r3
+L166: .string "skyltqexkv"
+L167: .data 436, -800, -994, -660, 3, 292
+jmp L295
+L168: .data 935, -861, -946, -303, -883, -419
+L169: .data 358, -556, -288
+prn r2
+L170: .data -154, 141, -298
+L171: .data -557, 578, 910
+L172: .data -758, 887, 497, -124, 203, 514, 662
+L173: .string "qjezfnpifzixlmwpkxaw"
+L174: .data 156, -22, 861, -589
+L175: .string "ckfrowdfkvjvnammedm"
+rts
+L176: mov *r3, *r7
+
+dec *r7
+lea L24, L241
+L177: jmp *r4
+L178: .data 671, 216, -756, 990, 707, 92, 85
+; comment
+L179: .data 629, -679
+cmp r1, #-13
+L180: .data -127, 847, -944, -337, -514, -864, -632
+jsr L20
+L181: .data -244, -405, 704
+L182: lea L164, L26
+L183: .data -160, -404, 738, -327, -12
+L184: .data 594, -417, -805, 90, 467
+L185: .string "ms"
+L186: .string "qugiyuafdhmgabfhb"
+L187: .data -791, 815, 209, -998, -427
+L188: .string "jegfysqyqgpoykwjumhoeavd"
+L189: .data 6, 601, 460, -888
+mov *r5, L9
+L190: .string "hcmxcqbprgxsawnmi"
+L191: stop
+inc L172
+red *r5
+L192: .data -508, 391, 704, -539
+L193: .data -40, -832
+L194: .data 483, 250, 821, -669, -258, -344
+
+L195: .string "escgunm"
+rts
+inc L230
+mov L272, L269
+L196: inc L141
+rts
+L197: .string "tmkhudisoltdhltf"
+L198: .data 879, -248
+jsr *r0
+jsr L126
+jmp *r0
+red L70
+L199: .data 604, 411, 770, 951, -789
+L200: .data 59
+L201: .string "upq"
+lea L45, L128
+L202: .data -212, 460, -788, -152, -290
+L203: .string "o"
+rts
+L204: .string "wwqea"
+not *r7
+mov L212, r3
+L205: sub L137, r0
+L206: .string "avtd"
+L207: .string "bckvkebsnuuckbmwqetrpwb"
+bne *r1
+L208: add *r2, *r2
+L209: .string "cahavcun"
+bne L9
+L210: .string "hfq"
+L211: .string "cwmibha"
+L212: .string "dzczfyeevgcjnxeiedw"
+L213: sub *r7, L196
+L214: not L253
+L215: .data -566, 898, 707, 961, 22, -946, -524, -261
+inc *r4
+inc r3
+L216: .data 286
+inc r6
+L217: .data -53, -912, -691, -799, 936, -573, -237
+L218: .string "rxbjrdmmnhpjeklxemyg"
+L219: .string "oslhacrhz"
+L220: .data 168, 982, -440, -680, -980, 304, -775, 239
+L221: .data 394, -942, 56, -578, 207, -803
+lea L252, *r5
+L222: .data 627, 833, 763, 358, -854
+red *r3
+L223: .string "ssfgcpfbedzkqmkiwv"
+inc *r4
+jsr L105
+L224: .string "jymozcnsnzmvrrrzpo"
+prn r7
+prn *r2
+L225: .string "p"
+L226: .data -87, 678, -989, -969, -12, -977, -539, 467
+inc *r1
+L227: .string "yjsniog"
+L228: .string "ozgosnpfnmoqphqceiadw"
+dec *r2
+L229: .data -438, -651, 330
+L230: .data 192, -174
+; comment
+L231: .data -538, 616, -372, 499, -625, 929, 84, -49
+L232: .string "amaegwr"
+dec r6
+rts
+clr r1
+dec *r7
+L233: .string "xjpudzranuyovzdbj"
+L234: .string "bcsksfyxtduym"
+L235: .data 568, 524, -660, -313, -40, -984, 3
+L236: .data -641, -178, 941, -1, -261, -566
+L237: sub *r6, r0
+L238: .data -423, -25, 516, 88, 242, 424, -813
+clr *r6
+jmp *r2
+jmp *r1
+L239: .data 3, 446, -365, 217, 339
+prn *r5
+L240: .data 65, 525, -716, -9
+L241: clr *r5
+mov *r5, L153
+L242: .data 839, 152, 77, 607, 189, -191, 534
+
+L243: .data 813, 242
+not r0
+jsr L275
+jmp L16
+L244: .data 613, -85, -20, 775, -589
+red *r3
+L245: .data -123, -305, 628, -828
+L246: .string "mssmkufgtjr"
+L247: stop
+L248: .string "anvstunzixiqhtlcsjmiqsre"
+L249: .data -567, 991, -119, 221, -58, -812, -948
+red r4
+L250: .data 126, -742
+inc r7
+dec r6
+L251: .data -53, 437, -372, 884, -824
+L252: .string "galpqr"
+L253: .string "rsryvjpcoya"
+L254: .data -974, 618, -428
+L255: .data -138
+L256: .string "orbkjczpzzpbrjvcdlncxb"
+L257: .data -530
+clr *r7
+red r7
+L258: .string "gyxvvmywidihekyrhgug"
+L259: .string "fpbhxhdnxmlaywcevkjr"
+L260: .string "wzsc"
+L261: bne L294
+L262: .data -246, -528
+stop
+L263: .data 546, 294, -273
+L264: .data 635, -987, 750, 22, -989, -390, 951, -780
+stop
+cmp r6, L122
+L265: .data -440
+L266: sub r3, r1
+; comment
+mov #157, r0
+clr r4
+clr r5
+L267: .data 690, 825, -360, 40, 151, 517, 472
+L268: .data -102, -997, -54, 283, 697
+L269: .string "zztwdjwymjn"
+not L274
+clr r3
+L270: .data -170, 613, -837, -204
+dec r3
+L271: .data 813, 536, 479, -41, 457, 550, -810
+bne L304
+L272: .data 301, -892, -969, -906, 131, 57, 839, -389
+bne *r5
+L273: .string "bx"
+add r4, r1
+L274: .string "sp"
+jsr *r3
+clr L311
+L275: .data -37, -480, -499
+L276: .data 387, -853, -549, 254, 220
+L277: jmp *r5
+; comment
+not L58
+prn r7
+L278: .data -441
+stop
+L279: .string "aiqyfarpkd"
+L280: .data 663, -557
+L281: bne L205
+L282: .data -106, -484, -30, -139, -382, 980, -335, 183
+clr *r3
+dec L320
+L283: clr *r4
+inc L222
+L284: .string "fh"
+lea L189, r1
+L285: .string "hk"
+L286: .data 956
+cmp L132, #5
+L287: .data -372, 624, -207, -300, 633, -131
+L288: .data -136, 813
+L289: .string "jrlwjesbusykwcbioydmgj"
+prn *r5
+L290: .data -112, 584, -363, 321, 797, 374
+rts
+lea L239, *r5
+; comment
+L291: .data -741, -978, 242, -870, 472, -693, 92, -799
+L292: .string "tywqbewb"
+red r5
+inc L304
+L293: .string "bvb"
+rts
+clr r4
+bne L322
+; comment
+L294: .data 93
+L295: .string "clhuizlsacm"
+L296: .string "bkemhdbqnyycrnyxr"
+L297: .string "za"
+L298: .data -507, 757, -892, -787, 721, -792
+L299: .string "k"
+L300: .data 40, -660, -968, 704, -212, -3, 260
+L301: .data 712, 178
+not L298
+dec L313
+L302: .data 466
+L303: .data -304
+L304: sub L147, r6
+jsr *r6
+L305: .string "eyt"
+L306: sub r3, L33
+L307: .string "zqusypqbyuoeaistbqxkxxyn"
+L308: .data 651, -905, 314, 341
+L309: .data -753, 40, -776, -283
+jmp L322
+L310: .string "jtqigsqkruucssdulzwoy"
+L311: .string "jwn"
+bne *r5
+L312: .data -444, 444, -541, -871
+L313: .data 245, -168, -555, 205, 236, 29
+L314: .data -359, -564, -552, 906, -582, 84, 98
+stop
+dec L56
+L315: .data 861, -579, 797, -526, -752, 751
+L316: .string "temcejzt"
+L317: .string "naxkq"
+not r1
+sub L322, *r0
+
+L318: .data 173, -884, 664, 844, -443, 66, 235
+L319: .string "wkbagxoao"
+L320: .string "pypzpsk"
+L321: .data -261
+not *r7
+L322: .string "jvsvlxxizkzmebodhxdbpjr"
+L323: add #-3, r6
+jsr *r4
+dec r7
+; comment
+L324: .string "tdewywfco"
+stop
@@ -0,0 +1,1045 @@
+; Generated by genCorpus --seed 1
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+inc X5
+L0: rts
+sub r7, *r3
+bne X2
+jsr L0
+prn r1
+L1: cmp r1, #-87
+mov L0, r0
+not r2
+clr L119
+
+rts
+L2: .data 408
+L3: mov #221, r3
+stop
+L4: bne *r1
+prn *r6
+sub #203, r6
+cmp r4, #153
+jmp *r6
+rts
+L5: .string "vaml"
+sub X4, *r7
+add #58, r5
+inc *r0
+red r0
+bne *r6
+jsr *r7
+L6: .string "sxxvecpjap"
+L7: stop
+sub *r0, r4
+mov r4, r0
+L8: .data -795
+clr *r3
+mov r7, *r2
+L9: jmp *r4
+jsr *r0
+prn #55
+clr *r3
+sub *r0, r2
+prn r2
+L10: red *r2
+mov r0, *r2
+L11: bne L3
+red *r4
+bne *r4
+inc L9
+prn L1
+L12: bne X22
+L13: lea X4, L227
+red L0
+L14: .data -451, 385, -714, -758, -556, 348
+lea L6, r1
+cmp r0, r6
+add *r6, *r1
+add r4, *r6
+red X16
+prn #122
+L15: inc X20
+L16: add *r4, L6
+sub #-61, L10
+inc X22
+
+bne *r0
+L17: jsr *r0
+bne *r1
+add *r1, X20
+L18: mov r4, *r5
+L19: bne *r0
+L20: mov r7, X14
+not *r1
+sub r3, *r0
+L21: .data 65, 254, -614, 503, 770
+clr L3
+not X2
+L22: lea X5, r0
+L23: mov r0, X15
+L24: .string "lyxxqckpfgtntlm"
+prn #-152
+bne L1
+jmp L221
+add X14, L268
+bne *r0
+L25: .string "mznhlqmv"
+sub *r7, L201
+inc *r2
+rts
+lea L16, X15
+lea X17, r3
+add *r4, *r5
+rts
+prn #70
+L26: stop
+rts
+bne X24
+dec *r3
+L27: .data -533, -955, -975, -54, -729
+L28: add X7, X14
+jmp *r4
+
+L29: jsr *r1
+L30: .data 129, 966, -210
+prn L22
+jmp L217
+inc r6
+inc L28
+lea L48, *r4
+not *r5
+cmp *r6, X22
+L31: sub L14, X12
+cmp X13, L12
+mov *r2, r4
+L32: lea L176, L24
+not *r3
+cmp #228, X24
+not L11
+rts
+red *r4
+jmp X0
+bne L18
+L33: cmp X1, #229
+L34: .data 513, 828
+red *r7
+prn r0
+dec L151
+mov #-70, r6
+L35: rts
+dec L14
+stop
+add #-170, *r3
+red L48
+not *r6
+add r6, X12
+
+not L69
+L36: jmp *r5
+inc X18
+cmp L32, r2
+prn L25
+jmp L153
+L37: cmp L29, *r2
+L38: .data -490
+inc X9
+add r2, *r6
+add r3, r1
+L39: add L77, *r7
+prn *r4
+mov #245, X9
+clr *r3
+L40: .string "xrstwemvegxccdv"
+L41: clr L6
+red r3
+L42: lea X23, r7
+dec *r5
+clr *r3
+prn r5
+; comment
+red *r7
+lea L54, X0
+L43: dec L22
+mov *r6, X8
+L44: .string "qqmjlhqcmtoctjen"
+jsr *r5
+cmp X22, *r2
+jsr *r1
+rts
+inc X4
+; comment
+not r5
+L45: .string "bctittnybuzzaolpgkjb"
+jmp L77
+jmp X2
+rts
+mov r1, r2
+dec L193
+L46: not *r1
+jsr *r6
+lea L127, L4
+L47: .string "aukeroyvbwpqmkuyhyzz"
+not r0
+L48: stop
+prn #-244
+clr *r1
+; comment
+cmp #-29, #166
+L49: clr r4
+L50: add L137, r6
+jsr L127
+jmp L178
+L51: dec *r0
+jsr X3
+rts
+L52: .string "pgsozhsftq"
+mov *r7, *r1
+inc r2
+mov *r1, r0
+stop
+L53: cmp *r7, L30
+add X6, *r2
+L54: .string "rgakegpid"
+add r4, r3
+L55: prn #-254
+add r1, L14
+sub *r2, L5
+lea X0, r7
+red L260
+; comment
+L56: sub *r4, L29
+sub L24, X17
+lea X0, X1
+cmp X19, X17
+red r2
+rts
+L57: .data -424
+L58: .string "oitkfuf"
+L59: .string "ixshghdevmytwpovofo"
+inc *r2
+; comment
+sub #-186, X5
+not *r2
+
+cmp r7, #-57
+; comment
+dec *r0
+bne L102
+sub r6, r4
+L60: rts
+mov r1, L3
+cmp X13, r5
+L61: bne *r6
+jmp *r3
+bne *r3
+mov *r5, L47
+
+stop
+sub *r7, r5
+prn r3
+rts
+prn r2
+; comment
+rts
+bne X12
+L62: lea X22, r3
+clr *r3
+L63: .data -494, -633, -177, -770, -28, -959, -447, -860
+stop
+cmp #-76, L253
+sub #237, L196
+; comment
+lea L33, *r3
+prn *r5
+L64: jsr *r5
+L65: bne X0
+L66: .data 69, -257
+red *r0
+bne L51
+prn *r7
+jsr *r2
+L67: .string "nepprlvgbrdip"
+dec r4
+rts
+sub *r2, X4
+prn *r0
+dec L13
+L68: add X3, X15
+add X23, *r1
+cmp L56, L230
+red X21
+inc r7
+L69: rts
+inc r7
+L70: .data 865, 952, 981, -89
+not X12
+L71: red r2
+rts
+L72: mov r1, *r4
+bne X11
+clr r2
+stop
+inc L105
+dec *r7
+cmp #21, L216
+cmp L32, X16
+mov #133, r7
+cmp X22, *r4
+mov *r2, r0
+L73: inc *r6
+cmp L160, L148
+L74: jmp L240
+prn *r3
+jmp X5
+dec L9
+add #-103, X14
+clr r4
+prn *r0
+sub *r5, r0
+not r7
+L75: lea L170, L46
+bne *r6
+lea X5, *r2
+add #-70, *r5
+lea X6, *r6
+L76: jsr X21
+L77: sub *r5, r4
+prn #-248
+; comment
+jmp *r5
+L78: inc *r5
+add r6, *r4
+; comment
+L79: .string "nnawklfwlilevqxddoegj"
+not X19
+red X2
+L80: dec L61
+jmp *r3
+not r2
+prn r1
+prn #222
+prn r5
+L81: prn *r7
+sub r3, L105
+jsr *r1
+add *r4, *r7
+rts
+L82: lea L63, r6
+bne L123
+bne L125
+jmp L18
+mov *r1, L70
+stop
+L83: lea L22, *r1
+; comment
+L84: .data -937, -90
+red L181
+prn L157
+cmp #205, *r3
+add #-103, r5
+L85: inc r4
+L86: cmp *r3, L190
+clr *r4
+jmp *r4
+dec *r1
+jmp *r6
+rts
+L87: dec X0
+L88: prn X14
+L89: .string "ryfyfadg"
+L90: .data -95, 179, 391, -320, -618, 618, -131, 253
+add #-145, *r3
+L91: red r7
+lea X19, r2
+bne *r6
+jmp L7
+L92: rts
+bne *r0
+mov X2, L4
+stop
+prn X20
+dec X2
+; comment
+L93: cmp #186, *r1
+L94: .string "qyuyycgegrniuqyzhpq"
+jmp L89
+L95: .string "wasijpfme"
+L96: mov *r4, r4
+cmp X19, #-197
+sub r4, r6
+not *r0
+not *r4
+L97: .string "glkpoafrjtltknigo"
+not *r5
+L98: .string "ffvrhozasai"
+dec *r2
+rts
+L99: .string "ngehwktnoibjllnxuhqflzmn"
+red X20
+L100: .data -719, -346, 316, 968
+L101: rts
+sub L38, X18
+red *r3
+jsr *r2
+L102: lea L83, *r3
+L103: .data 321, -103, -338, 951
+L104: clr *r3
+inc X8
+mov X13, L226
+add #-212, r7
+sub L245, r0
+inc *r1
+add *r5, *r1
+stop
+add #-221, L186
+L105: clr r6
+dec r2
+L106: mov *r7, L186
+red *r4
+L107: cmp #-194, L28
+L108: red X3
+L109: .string "bwqern"
+lea L167, *r4
+cmp #43, X2
+not L46
+lea L255, r0
+stop
+L110: mov r0, L51
+L111: jmp *r1
+prn #46
+stop
+lea X17, X14
+L112: .data -225, -11, 686, -445
+L113: .data -651, 412, 837
+add r7, *r5
+jsr *r3
+jmp *r7
+sub L110, L5
+L114: mov *r7, *r5
+L115: sub r5, L164
+rts
+L116: rts
+L117: .data 603, -247, 723, -262
+rts
+red X14
+jsr L230
+inc L64
+bne X0
+clr r4
+not r5
+lea X16, *r6
+add *r6, *r0
+dec *r5
+rts
+L118: cmp *r2, r0
+L119: mov #-131, r4
+rts
+jsr X1
+red *r3
+mov L50, r1
+L120: clr *r7
+clr X21
+L121: jsr L114
+not r2
+sub #-237, r3
+red *r5
+jmp *r0
+L122: .string "u"
+jsr *r7
+mov r6, *r6
+stop
+L123: lea X19, *r1
+add *r4, r2
+cmp *r7, #-125
+sub r5, r6
+dec L242
+
+cmp *r0, r3
+bne X19
+clr *r2
+L124: .data -1000, 574, -689, -221, 967, -522, 625, -820
+L125: .data -333, -219, 412, -824
+dec L37
+rts
+stop
+L126: .data -592, 183
+L127: dec r4
+red X1
+L128: .data 143, -665, -915, -146, -809
+
+dec r0
+L129: mov r2, r6
+
+L130: bne *r5
+L131: jmp *r1
+stop
+red r0
+jmp X12
+jsr *r0
+dec X18
+L132: mov *r5, X24
+rts
+lea X20, r3
+jsr *r7
+L133: clr *r4
+not r4
+add #-128, r2
+clr r0
+
+L134: .string "zeilbbf"
+; comment
+stop
+red r1
+L135: stop
+cmp #198, #62
+jsr L75
+dec *r6
+dec *r5
+L136: not *r3
+L137: cmp L18, *r5
+L138: .string "mzgunj"
+clr *r3
+L139: cmp r2, X10
+
+rts
+L140: inc *r2
+jmp *r7
+mov L65, *r5
+inc X6
+red X12
+stop
+prn r0
+mov #-85, r6
+sub #-87, X24
+jsr X5
+L141: .data -72, 526, -714, 511, 747, 351
+jsr *r1
+bne L128
+prn *r0
+L142: add X13, X23
+inc r1
+clr r6
+lea L156, L71
+mov L40, L68
+stop
+jsr *r1
+dec X9
+stop
+jsr L149
+dec *r0
+L143: jsr L61
+jsr *r1
+red X2
+cmp X16, r5
+L144: .string "ehcbcnsljrjbq"
+prn r3
+
+cmp #203, *r6
+L145: .string "nwntpahdvk"
+L146: lea L184, *r4
+dec L274
+L147: cmp L15, *r6
+sub #-206, L258
+L148: jsr *r1
+L149: .data -592, -27, 879, -40, -108, -351, 252, 50
+lea X24, L205
+L150: red *r1
+L151: jsr X23
+L152: .data -850, 279, -996, 94, -307, -582, 542
+not r4
+cmp L196, r6
+jsr *r7
+L153: cmp #-12, r7
+lea X22, *r3
+; comment
+L154: lea X4, r4
+L155: .string "suzobusqvwuubkfguhzbs"
+jmp L267
+rts
+inc *r0
+stop
+L156: inc *r1
+stop
+jmp *r5
+L157: not *r2
+L158: .string "omnycnvpuw"
+stop
+L159: clr *r0
+red r0
+dec *r3
+rts
+L160: bne *r4
+L161: .string "jaljugunowvougt"
+lea L258, r6
+cmp #20, L239
+add X22, *r6
+prn r0
+L162: lea L237, L164
+inc *r5
+L163: .string "hotwgv"
+jmp L145
+L164: .string "pcfswgepzy"
+sub *r3, r6
+L165: prn X15
+not X15
+cmp X8, #107
+inc r1
+jsr *r2
+dec X10
+inc *r2
+L166: sub r3, X2
+bne *r5
+prn X1
+L167: bne X1
+add #-62, r4
+prn r1
+bne X9
+dec X12
+L168: add #43, r0
+jmp *r0
+sub *r6, r4
+
+red *r4
+bne *r7
+stop
+
+; comment
+cmp #-236, X8
+
+mov *r1, *r7
+clr L137
+L169: sub L154, *r6
+; comment
+add #-78, *r3
+L170: .string "wsbigqjlrufpathkqfqgjhx"
+jmp *r5
+L171: not *r3
+L172: .string "dffwgtxbwrpreiraysfhdwz"
+L173: prn *r0
+inc X18
+not r1
+sub r4, *r1
+jmp *r4
+L174: add #178, *r4
+L175: clr r1
+mov #-48, L215
+stop
+mov L261, r7
+L176: .string "nwrffxppizzlm"
+L177: .string "mckaozgvldxopy"
+inc L259
+; comment
+not *r2
+
+L178: mov #-64, L241
+add #195, *r0
+jmp *r7
+bne *r6
+L179: lea L218, L136
+prn r4
+L180: lea L16, X14
+jsr X19
+L181: sub r3, L273
+prn #74
+prn *r6
+L182: clr *r1
+red *r7
+bne *r0
+prn r4
+L183: mov L113, L157
+bne *r5
+mov #156, r2
+red L265
+clr X15
+L184: stop
+sub r6, *r1
+stop
+red *r2
+add *r1, *r3
+cmp #-100, #-4
+rts
+lea X12, *r5
+red *r0
+; comment
+jsr X3
+add #-58, L173
+add *r2, L123
+L185: .data -364, -274, -253, 665
+cmp *r6, r3
+bne L263
+jsr X2
+L186: bne *r7
+not *r4
+L187: .string "brzfoqgxjqedvpkmbdc"
+L188: stop
+not L258
+jmp *r6
+L189: mov L164, X12
+L190: inc L71
+mov *r4, r7
+red *r4
+prn *r6
+
+rts
+L191: .data 891, -169
+L192: .data -72
+L193: .data -793, 289, 907, 416, -449, -396
+add #28, r7
+bne X6
+add L246, *r3
+prn #-3
+sub *r2, *r1
+red *r4
+clr r0
+prn L231
+prn #-160
+not r5
+jmp *r5
+L194: .data 758, -851, -104, -938, -25
+L195: not r1
+L196: bne *r2
+; comment
+bne *r7
+L197: clr r4
+sub L33, r4
+jmp X14
+stop
+L198: jsr L105
+clr L205
+L199: dec *r5
+stop
+L200: .string "bjbblrbfhmakxvlell"
+L201: .data 721, 604
+L202: jsr L211
+jmp *r0
+L203: sub #143, r7
+stop
+inc L141
+jmp *r0
+
+jsr *r7
+L204: clr *r4
+bne X2
+jsr L274
+prn *r5
+red X9
+sub #-159, L100
+sub #42, r5
+jmp L259
+prn *r4
+L205: .string "nxcpicjofubv"
+bne L122
+clr *r4
+stop
+mov L239, *r4
+inc X24
+cmp L183, r4
+red X3
+L206: inc *r2
+stop
+L207: .data 344, -66, -591, -58, -215, 933, 617, 817
+dec r4
+not *r4
+add *r7, *r3
+prn r0
+stop
+red r0
+not r6
+L208: .string "egjqvfpmvevwnvgsfljg"
+lea L234, X11
+cmp r2, r6
+rts
+L209: sub r5, X15
+jsr L265
+cmp L253, #214
+bne X17
+L210: .string "qnlwyvbolv"
+inc r6
+mov *r2, r1
+L211: rts
+; comment
+mov *r1, L194
+jmp L2
+; comment
+inc X10
+add *r0, r1
+red X16
+stop
+L212: not r5
+L213: not L255
+lea X24, *r7
+lea L30, X8
+cmp r7, X18
+L214: stop
+clr r2
+L215: jmp *r5
+sub *r6, L246
+not r5
+rts
+clr r2
+L216: .string "hqybgijit"
+prn #-181
+L217: .string "opg"
+L218: stop
+red L52
+stop
+inc *r4
+jsr L208
+; comment
+prn *r7
+mov *r2, X10
+cmp L61, L225
+stop
+L219: sub *r4, *r1
+prn #-39
+cmp *r3, r6
+inc *r3
+jmp *r2
+mov X5, *r4
+L220: prn #114
+inc r6
+lea L77, *r7
+not L78
+stop
+L221: lea X16, X23
+; comment
+L222: .string "pcqdrdrduydfqgemmppwon"
+L223: bne X21
+jmp L69
+L224: .string "wzkjcuornvixrkxwvd"
+lea L192, r4
+inc *r1
+mov r4, *r7
+mov #166, *r3
+rts
+stop
+mov #-97, X7
+jmp *r2
+dec r4
+clr r4
+dec L271
+add X5, L263
+lea X15, *r7
+jmp *r1
+sub L141, *r6
+rts
+clr *r2
+dec r7
+red X15
+prn *r2
+; comment
+L225: rts
+not L128
+not r6
+L226: .string "ubegtcbkamtzl"
+bne *r7
+bne L101
+not *r0
+L227: prn *r0
+rts
+L228: inc *r3
+red X16
+red *r7
+rts
+red r4
+not r6
+L229: .data 500, 264
+L230: cmp X5, *r1
+mov *r2, r6
+L231: .string "nvzbjivce"
+L232: not X10
+sub L130, X17
+L233: .string "bquqhswsspg"
+lea L187, r6
+clr *r3
+jsr L238
+jsr *r4
+L234: .data -462, -32, -235, -750, -401
+L235: .data 233, -590, 847, -537, 246
+rts
+L236: add X7, r6
+inc *r7
+prn #151
+add #-249, *r3
+add L144, r1
+red L266
+cmp L194, X2
+L237: .string "mmucopgubhiszgddfxpkexgk"
+add *r6, r4
+cmp #-143, *r4
+L238: bne *r2
+mov L247, X16
+jmp L273
+stop
+L239: .string "mjrx"
+red *r0
+add L249, r4
+jmp L267
+prn L245
+prn #-98
+L240: lea X18, r7
+L241: rts
+; comment
+L242: not r7
+bne X6
+sub *r0, L59
+L243: prn L272
+L244: .string "ienrjnxxgjggxurd"
+prn *r4
+jmp X11
+L245: .string "hwgyocu"
+L246: inc X17
+stop
+rts
+mov *r4, r2
+L247: not r7
+not r2
+stop
+L248: lea L180, r7
+inc *r7
+L249: .data 553, 951, 478, -116, -947, 50, -207
+jmp *r3
+bne L260
+jmp L261
+mov r0, L251
+inc *r0
+L250: add *r1, X6
+inc r3
+jmp *r2
+rts
+dec *r4
+inc X7
+add #-130, r3
+not *r1
+L251: inc r3
+rts
+not X13
+lea L47, *r7
+sub #50, r3
+; comment
+L252: red r3
+sub *r2, *r1
+L253: rts
+dec *r7
+stop
+sub X12, L267
+cmp *r0, X16
+dec r2
+mov #153, L267
+stop
+inc L263
+L254: prn #-40
+L255: rts
+add *r3, L273
+jmp X20
+L256: red *r0
+L257: jmp X19
+red *r2
+L258: mov #-89, X24
+jmp *r2
+jsr *r4
+cmp r3, r5
+L259: stop
+; comment
+
+clr X17
+L260: add r5, r0
+L261: jsr *r3
+not r6
+stop
+jmp X19
+lea X7, L262
+L262: sub X11, *r1
+sub *r3, r3
+L263: red r1
+L264: .string "crzriqofmdxtudarhpdgmz"
+L265: jsr X9
+add r4, r7
+sub r2, r4
+sub #179, *r6
+mov *r2, L266
+clr r1
+
+L266: prn r5
+rts
+jsr *r3
+L267: stop
+stop
+sub #-95, *r6
+mov #-200, r7
+L268: lea L134, L270
+; comment
+clr *r4
+not r5
+jmp L272
+lea X14, r5
+not *r2
+mov #-134, r3
+L269: lea L163, r0
+inc *r7
+bne L271
+rts
+inc *r7
+L270: add r7, L271
+jsr *r5
+L271: dec *r0
+stop
+red L272
+bne X3
+mov *r2, *r7
+jmp *r3
+rts
+add r3, X0
+
+L272: clr r5
+dec *r7
+jsr *r3
+L273: clr *r7
+jsr *r4
+lea L34, X16
+L274: bne *r6
+clr L159
+clr X15
+stop
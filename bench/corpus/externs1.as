@@ -0,0 +1,1045 @@
+; Generated by genCorpus --seed 2
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+rts
+dec r6
+lea X8, r4
+lea L123, X6
+dec *r4
+rts
+lea L265, r1
+L0: jmp X6
+sub L0, r1
+dec *r1
+sub #14, r6
+add X10, r1
+prn r1
+jsr X13
+bne L0
+prn L212
+L1: dec r2
+; comment
+L2: .data 902
+clr r5
+jmp *r2
+L3: .string "qtgznhhtodxwvtt"
+inc L2
+L4: .data 646, -679, 967, -863, -329, -307, 389, -806
+stop
+L5: inc r4
+L6: mov *r3, X19
+L7: inc r1
+L8: lea X4, L5
+sub #-218, X10
+jsr L57
+jsr *r2
+rts
+dec L1
+L9: bne *r4
+
+red r7
+L10: sub r7, *r0
+jmp L2
+jmp *r1
+red *r3
+red *r6
+L11: cmp r2, #138
+L12: .data -532, -398, -779, -111, -375, 640, 715, 614
+bne X16
+prn #193
+clr *r4
+not *r3
+bne *r4
+cmp #-162, *r4
+L13: .string "z"
+clr r3
+; comment
+dec L67
+cmp X22, *r1
+L14: dec r4
+inc X24
+inc X15
+L15: rts
+add #211, r4
+jmp L8
+jsr X22
+L16: prn L6
+clr X18
+prn #-101
+L17: sub L1, r6
+add r4, r7
+add #-207, L11
+lea X15, r5
+prn *r2
+L18: not X21
+sub L8, *r5
+L19: red r3
+mov L39, *r6
+L20: bne *r6
+rts
+inc r6
+bne *r4
+; comment
+dec *r3
+L21: red r6
+L22: stop
+
+mov *r1, r3
+not *r0
+L23: jmp L134
+not r2
+add *r0, r0
+clr *r0
+rts
+lea X14, *r2
+jmp *r3
+stop
+lea L16, X21
+L24: prn X10
+sub r6, *r5
+L25: lea L23, *r1
+cmp *r3, *r0
+
+dec L259
+jsr L23
+L26: .data 939, -42, 873, -788, 849, 422, 731
+add *r5, *r6
+L27: lea L170, *r6
+L28: .data -632, 661, -548
+inc X7
+prn #36
+inc r7
+mov r7, L23
+L29: .string "mbwrptgziifikyprjddxl"
+prn r5
+L30: .string "dfknjvmrcyedp"
+jmp *r5
+inc L117
+L31: lea X16, L121
+not L62
+not *r5
+L32: .string "pphzsyapvvrg"
+jsr X19
+clr *r1
+stop
+bne *r0
+stop
+L33: jsr *r5
+lea L196, r5
+L34: .string "nkwz"
+mov *r6, r7
+stop
+L35: cmp r1, *r6
+L36: bne *r4
+mov r2, X11
+L37: add #-44, r1
+L38: jmp X21
+L39: red r3
+dec X19
+sub *r7, *r0
+inc *r2
+add r3, r3
+jmp X3
+sub #-13, L37
+red r7
+L40: .string "mizhxqkbvh"
+; comment
+jmp *r2
+L41: add *r6, X6
+rts
+stop
+not L4
+dec L119
+sub *r1, *r7
+jsr *r6
+add r3, *r6
+sub #-122, *r6
+not *r2
+rts
+clr r6
+L42: inc *r4
+not r3
+jmp *r4
+mov #73, *r7
+rts
+L43: not r1
+lea X19, X13
+stop
+sub r4, *r1
+cmp #219, #-225
+L44: stop
+bne X17
+jmp L101
+clr *r2
+L45: .data 310, 106, -462, -572, -60, 58, 988
+mov X8, X9
+rts
+L46: .string "zklewsiuchfrjtruc"
+prn *r4
+red *r7
+not r7
+jmp L4
+inc r0
+jsr X12
+prn L235
+L47: bne L33
+jsr *r4
+red *r7
+mov #-15, L25
+cmp r1, *r2
+bne *r6
+inc *r7
+add r4, L129
+bne L59
+L48: red *r1
+L49: add r2, L32
+L50: .string "jvpaaxofboxauycg"
+bne *r7
+cmp r3, X10
+red L253
+stop
+L51: red *r0
+L52: red r3
+lea X10, r5
+prn *r4
+mov L228, *r7
+L53: stop
+mov #251, L0
+prn *r2
+L54: .data -488, -346, 282, -825, -674, 434
+inc r4
+rts
+bne X3
+inc L4
+sub #114, *r6
+L55: .string "jzneadrcqxglgobqnf"
+red L86
+jmp X3
+
+mov #-129, L50
+not *r2
+dec L124
+clr r1
+L56: .data -691, 299, 941
+L57: cmp r6, X5
+L58: mov #-212, L193
+L59: jsr X22
+prn *r6
+jsr *r4
+mov #-201, r7
+L60: .string "gmoljohbvd"
+cmp X16, L116
+lea L42, L51
+prn *r6
+bne *r3
+red X22
+prn r0
+L61: cmp r6, *r7
+add #5, r4
+dec r7
+lea X15, r5
+mov #101, *r0
+jsr *r4
+L62: add r4, *r2
+dec L43
+jmp X14
+red L60
+mov r2, r1
+L63: add r3, *r2
+L64: bne *r5
+red X7
+jsr X0
+inc L63
+clr X2
+mov X3, r1
+mov L250, *r1
+lea X14, *r7
+stop
+red r2
+L65: .string "rpnjzpkquftiylxcz"
+L66: .data -278, 53, 225, -50, -410, -230, -483, -116
+prn X9
+sub L169, X17
+L67: .string "rjyyixtvxigvjkuhjxfjwdsu"
+add #31, r1
+bne L274
+lea L115, *r6
+prn #86
+L68: clr r6
+red r6
+not X2
+; comment
+L69: stop
+L70: inc r7
+L71: stop
+L72: stop
+sub r5, r4
+not r2
+L73: dec *r2
+jsr X22
+L74: dec L99
+clr r6
+prn X3
+cmp *r4, L45
+red L266
+L75: stop
+add #201, *r7
+cmp L223, #22
+stop
+bne L8
+inc *r6
+L76: cmp *r2, L262
+L77: .string "guhyh"
+L78: .string "xttfkaosdhowdvymn"
+add #-156, X6
+dec r0
+L79: .string "dwxxxevzb"
+cmp #95, L74
+L80: .string "lkmglukzohnrxdtgcirxcl"
+L81: .string "lgfpisrlwiuey"
+lea X11, r2
+prn L251
+jmp *r7
+cmp r5, L23
+jsr X3
+lea L202, X15
+L82: dec r1
+L83: .string "wtsi"
+jsr L58
+cmp r3, r0
+mov r2, X22
+dec X2
+L84: jmp L269
+lea L70, *r0
+stop
+mov X2, L39
+dec X19
+jsr X17
+L85: .string "hicscxxvtzoyjcubgupghimf"
+red L85
+L86: clr r7
+rts
+rts
+L87: .data 455, 512, 61, 370, -967, 509, -992
+jsr X18
+dec L248
+; comment
+L88: lea L222, *r0
+L89: .string "eyholfxpwjxc"
+L90: prn *r7
+sub L67, L27
+jmp *r7
+L91: .data -870, 473, -192, 254
+L92: inc r6
+stop
+red X2
+mov X14, r0
+dec *r1
+jsr *r6
+L93: cmp *r0, #-135
+lea L67, *r4
+L94: sub *r4, X15
+dec *r0
+
+clr r7
+bne *r7
+dec L11
+clr r6
+sub *r4, X19
+
+cmp L135, #-163
+lea X19, *r6
+red L6
+jsr *r5
+L95: red r3
+jsr L157
+L96: sub r6, *r0
+L97: inc *r1
+mov #24, L4
+cmp #-131, r1
+clr r6
+red *r6
+prn *r6
+cmp *r5, r4
+rts
+stop
+L98: jmp *r3
+jmp *r7
+dec X6
+prn *r6
+add *r4, L123
+cmp *r7, #-170
+prn *r1
+cmp *r5, *r7
+L99: inc L191
+mov #31, r7
+add r5, L70
+prn *r2
+L100: jmp L193
+mov #255, *r3
+rts
+dec *r0
+
+rts
+bne *r2
+L101: .string "b"
+red r5
+add r1, *r4
+cmp L14, #102
+rts
+dec *r3
+; comment
+cmp L104, #255
+add X23, *r0
+L102: .string "mnylfn"
+inc L82
+L103: lea L141, r3
+clr L199
+not X11
+sub *r4, X13
+sub #-189, L190
+L104: .string "fomzcyiikquptovj"
+jmp *r1
+dec *r6
+L105: .string "fp"
+bne *r6
+; comment
+add #-238, X23
+mov #133, X2
+L106: .data 24, 692, 378, 797
+L107: mov X19, *r0
+not X0
+L108: .string "pzwemrsfkx"
+L109: .data 512, 581, 615, 788
+stop
+not X7
+clr X3
+stop
+L110: jsr L28
+L111: not r7
+stop
+inc *r2
+lea L19, L248
+L112: not r4
+cmp r7, *r2
+bne X8
+bne L272
+cmp X13, *r4
+mov X15, r5
+clr r1
+red r7
+L113: mov r7, L9
+dec *r4
+inc *r6
+prn *r5
+lea L140, r3
+sub X21, *r7
+red r7
+L114: bne L4
+red L35
+L115: not r3
+L116: .data -934, -79, -441
+not *r4
+L117: add X1, X7
+jmp X7
+not X8
+sub #-48, L12
+lea L174, *r3
+L118: jmp L1
+sub X22, r1
+L119: .data 196, 820, -149, 913, -438, 697, -467
+L120: .string "zhtyefu"
+jmp *r5
+inc r6
+sub r0, X12
+prn *r1
+not r6
+sub *r5, *r2
+inc X10
+bne L118
+add #35, L232
+stop
+add X19, *r3
+L121: clr *r1
+inc *r2
+cmp *r6, L118
+L122: .data -930, 947, -270, 79, 605, -169, -511, 597
+bne *r7
+not r4
+rts
+red *r2
+rts
+L123: red X3
+stop
+L124: .data -932, 5, 71, 724, 556, -95, -242, 989
+add *r7, *r1
+jsr *r5
+jmp X23
+red X6
+red *r1
+mov *r3, X3
+lea L156, L62
+inc *r7
+L125: mov #66, *r5
+jmp X12
+stop
+L126: sub #-244, r0
+L127: stop
+jmp X16
+add *r7, *r5
+prn #255
+bne *r6
+clr *r3
+dec L212
+jmp L101
+L128: clr *r1
+prn #-67
+L129: stop
+cmp L75, r1
+sub X11, r6
+L130: .data 116, 831, 879, -116, -753, -175, 271, -368
+rts
+lea L112, *r4
+L131: .data 82, -55, -532, -375, 179, -274
+red L151
+inc r7
+L132: mov *r7, *r7
+; comment
+clr r5
+L133: lea L17, *r1
+L134: .data -83, 930, -212, 535, 649, -44
+mov #192, L220
+stop
+L135: .data 279, -930
+not r6
+jsr L37
+add *r6, *r2
+L136: bne L156
+stop
+not r5
+stop
+prn r0
+cmp #-135, #78
+red X10
+prn *r7
+lea L202, *r3
+prn L159
+L137: lea L50, r5
+clr *r5
+add #-181, *r3
+prn *r4
+L138: prn X14
+; comment
+L139: cmp #99, r4
+L140: .string "xjipr"
+clr *r3
+jmp *r7
+prn *r6
+jsr *r6
+sub #-70, *r3
+L141: .data 627
+cmp #27, #-217
+prn #65
+L142: not r6
+add L174, r1
+lea X0, r1
+clr r3
+lea X6, r7
+add X0, *r7
+L143: jmp L142
+L144: cmp *r5, #-192
+L145: .data -924, -226, 79, -481
+prn #-74
+L146: .string "nb"
+inc X18
+lea X2, L147
+mov X19, X3
+inc L85
+not L89
+L147: .string "qgdveirocxmfmzlnywaeiymd"
+jmp *r1
+prn X6
+jmp X21
+add #76, r3
+dec L68
+L148: .string "xqqrpzrdyq"
+jmp *r4
+bne L12
+sub r7, r2
+inc r6
+L149: sub *r5, *r5
+L150: dec L161
+L151: .data 62, 226, -626, -944, -48, -958, 759
+L152: .string "yknqbqqpcrnmwccmiml"
+jmp L27
+inc X15
+rts
+lea L181, *r2
+red r7
+clr r4
+jsr *r0
+prn r0
+; comment
+L153: jsr X18
+L154: cmp X24, #-244
+dec r6
+; comment
+inc r0
+cmp X17, #-206
+jsr *r6
+jsr *r7
+not r3
+; comment
+mov *r4, r2
+L155: .string "iexsjarlskialwuztb"
+rts
+L156: red r5
+L157: lea L258, L33
+L158: .string "nkdx"
+; comment
+bne L128
+mov #114, r7
+rts
+mov #-145, L129
+stop
+red r0
+mov #-22, *r7
+red r3
+not *r4
+L159: .string "ip"
+L160: bne X4
+prn r2
+bne L149
+lea X9, L253
+not L223
+L161: bne *r5
+L162: rts
+clr *r6
+mov #-38, X6
+jsr L185
+; comment
+prn *r7
+prn r2
+mov r1, *r1
+jmp *r2
+L163: lea L44, r2
+mov #87, r6
+L164: lea X7, X15
+L165: red r3
+inc r4
+L166: bne X20
+bne *r5
+L167: .string "tcivkljjuhh"
+red L267
+bne *r0
+; comment
+jsr X13
+red X2
+clr *r4
+L168: cmp *r5, #-254
+not L72
+rts
+L169: clr r7
+sub L248, *r2
+L170: mov *r6, *r0
+stop
+add #4, L32
+clr r4
+jsr L190
+L171: rts
+L172: add #114, L227
+L173: jmp L57
+L174: stop
+inc L269
+jsr X2
+L175: prn #-59
+L176: sub *r6, *r6
+L177: cmp X22, *r6
+red L130
+not X11
+bne X20
+L178: add #103, r1
+sub r6, r7
+rts
+lea L231, L77
+sub X10, r0
+jmp *r2
+; comment
+rts
+jsr L249
+dec r4
+lea L106, L187
+lea L39, *r7
+L179: mov #-50, *r2
+rts
+prn L220
+jsr *r5
+lea L229, r2
+L180: jsr X7
+not *r5
+mov *r2, X16
+sub *r2, *r6
+jmp *r2
+jmp L78
+L181: mov #-157, L141
+L182: clr L226
+not r6
+inc L78
+inc L208
+lea L55, r4
+L183: .string "cpmhhbughbdnz"
+bne *r0
+lea X4, L156
+rts
+jmp *r7
+red L236
+add L26, *r6
+; comment
+rts
+cmp *r6, *r2
+stop
+inc r0
+cmp *r2, *r3
+rts
+L184: rts
+L185: .string "n"
+prn *r1
+lea L35, X2
+L186: cmp r5, *r5
+dec X21
+
+cmp r5, *r4
+L187: stop
+jmp *r0
+L188: .data -219, 921, 667
+sub L93, X18
+stop
+L189: lea L206, X15
+L190: .string "fnsnemluykui"
+L191: .string "jzcyatpfrpybajxzovjc"
+red r0
+prn r2
+red r2
+L192: .data 838, -159
+lea L188, L52
+sub *r0, L233
+L193: .data -323, 498, -205, 283, -241, 646
+bne *r0
+prn r5
+cmp L238, r0
+lea L241, *r4
+bne L207
+L194: add #-141, X12
+; comment
+sub L162, L191
+L195: .string "gqnh"
+L196: prn #-235
+rts
+clr *r1
+L197: .string "a"
+lea L260, *r5
+jmp *r4
+not r5
+jmp X17
+jsr L199
+bne L147
+inc L202
+L198: .string "cnjwxelrgrqwtcdt"
+jmp *r4
+bne *r3
+rts
+clr X11
+L199: red *r1
+jsr *r7
+L200: mov #227, L32
+cmp r6, #-95
+rts
+inc L248
+L201: lea X9, L109
+cmp L242, r0
+L202: .data -680, -868, 515, -3, -520, 988
+bne *r2
+L203: jsr *r5
+L204: bne *r7
+red r3
+L205: .data 405
+stop
+L206: inc r5
+lea X3, X13
+add *r4, r1
+L207: .string "xaxpmcunbkn"
+clr X14
+cmp #-87, *r2
+L208: clr *r6
+jsr L263
+stop
+jsr *r4
+add L257, L221
+lea L231, r4
+not r7
+not r3
+red r5
+L209: red X16
+clr *r3
+cmp #-68, r4
+mov X23, r3
+L210: rts
+lea L227, r5
+sub *r2, *r6
+not r6
+clr *r2
+L211: dec r7
+L212: add *r1, L96
+stop
+stop
+prn r7
+dec *r4
+red L262
+stop
+clr r1
+jsr *r4
+sub *r2, L246
+red r5
+inc *r3
+jmp L244
+L213: .data 926, 708, 823, -436, 102, 297, 285
+
+L214: prn r0
+stop
+L215: .string "cjlpulj"
+lea X2, r0
+L216: mov *r7, *r7
+mov *r4, r3
+bne L21
+not r5
+L217: add L31, X5
+L218: jmp *r4
+L219: .data -37, 78, 623, 49, 767, -657
+bne L251
+prn X23
+mov r6, L249
+jmp L257
+
+; comment
+lea L45, r7
+prn #119
+clr *r1
+red r7
+inc L177
+; comment
+jsr L153
+L220: .data -372, 112
+not L274
+L221: .data 192
+lea X0, r2
+L222: .string "kohmvotcg"
+jmp X23
+stop
+cmp *r1, *r1
+dec L213
+add r7, r0
+L223: .data 987, 945, 677, -473, 906
+cmp *r5, #-155
+red r7
+rts
+jmp L211
+L224: jmp L174
+inc X3
+clr L212
+L225: stop
+clr L196
+jsr X20
+bne *r6
+L226: rts
+L227: .data 585, 785
+jsr *r7
+L228: .string "emcyojqqnvjkapnlhlcqcqgk"
+rts
+lea X17, *r0
+L229: .string "pnkkmqb"
+L230: cmp #-231, r4
+inc X9
+cmp r4, #-144
+L231: .data 959, 854, 478
+L232: .data 445, -138, 426
+cmp r3, *r7
+not X14
+bne L130
+jsr X8
+L233: stop
+add X7, r6
+lea L112, X18
+bne *r0
+
+jmp X9
+rts
+lea X0, r2
+L234: jmp *r0
+red X8
+sub r0, *r1
+L235: .data -197, -501, 112, -754, 89, 403, 982, -605
+lea X8, L153
+L236: bne X22
+L237: dec r3
+dec L263
+L238: .data -685, 136, 231
+sub *r5, r1
+sub *r6, L182
+L239: .string "pfbhyxhedqflsvk"
+L240: stop
+cmp *r3, r1
+red *r1
+red r5
+bne *r2
+stop
+inc L254
+
+stop
+lea L265, *r1
+L241: .string "zcyjtupsfoldsrgfzgnso"
+red r2
+L242: cmp *r1, r3
+cmp *r4, r2
+jsr *r7
+mov *r6, L252
+add #-73, *r7
+L243: red L231
+cmp *r3, X11
+L244: .string "srzheduldkplgidsq"
+L245: inc r0
+clr *r6
+dec r2
+clr r2
+dec X19
+L246: jsr *r3
+L247: .data 883, -981, 912
+L248: add r7, *r5
+sub #155, L263
+rts
+rts
+sub #26, *r6
+lea L41, r3
+stop
+add L34, r7
+prn #107
+L249: cmp r4, r6
+sub #-3, *r5
+dec *r2
+L250: .string "dvbaomenmktczozk"
+jmp *r3
+jmp X2
+L251: sub L264, L269
+L252: .string "ftfkyxqsnkdzdoiollopm"
+clr *r0
+L253: sub *r1, *r2
+add X13, *r4
+clr *r0
+cmp *r7, #-255
+L254: .data -837, -306, 677
+bne X6
+mov *r6, r2
+cmp #-41, *r3
+sub *r3, r0
+bne *r6
+rts
+jsr L247
+L255: bne *r7
+dec L262
+red *r5
+L256: .string "gl"
+sub *r3, *r1
+add r2, L36
+lea X20, *r7
+inc r2
+sub *r4, L37
+jmp *r2
+L257: .data -292, -983, 184, 978
+L258: stop
+jmp *r5
+rts
+L259: sub X6, r2
+clr r5
+cmp #-64, *r4
+L260: .string "bfufbfdhmiwquj"
+L261: bne L77
+L262: jsr X5
+
+lea X15, r2
+stop
+L263: prn X18
+bne X12
+L264: cmp r6, *r0
+bne *r1
+; comment
+L265: rts
+jmp *r0
+rts
+clr r5
+jmp L2
+dec r1
+prn #250
+red X19
+add *r2, r6
+L266: lea L271, r3
+L267: .string "pmh"
+L268: .string "pn"
+jmp *r1
+jmp L273
+lea X0, X9
+L269: mov L179, *r0
+L270: cmp r4, X19
+mov L162, *r4
+mov L111, X7
+L271: jsr *r3
+L272: prn #208
+jmp L263
+mov r4, r4
+L273: rts
+L274: rts
+stop
+mov #-48, L112
+not r6
+not r7
+not *r5
+stop
@@ -0,0 +1,1044 @@
+; Generated by genCorpus --seed 11
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+clr L114
+cmp r2, *r6
+not *r7
+clr r4
+jmp L152
+rts
+jmp L68
+bne X20
+inc L0
+sub r1, r7
+prn r4
+; comment
+not *r7
+jsr *r4
+L0: jmp *r7
+prn #-221
+not L4
+clr r4
+cmp r1, L203
+cmp *r4, r2
+L1: .string "mawixrideakqif"
+dec r3
+L2: .data -630, -615, 86, 910, -758
+cmp *r3, r6
+jsr *r5
+stop
+jsr X21
+bne X7
+L3: .data -794, -837, 706, 711, -408
+L4: .data -217, 369, 375, 895, 372, 249, -9
+dec r7
+dec r0
+L5: inc L213
+; comment
+jmp X4
+L6: .data -776, 959, -744, -729, 453
+L7: rts
+L8: .string "rtyvouwso"
+prn *r2
+clr L8
+bne *r1
+stop
+prn r0
+jmp L5
+cmp *r4, L261
+add #-63, *r6
+not *r2
+bne X15
+stop
+prn r7
+prn L5
+rts
+L9: sub L1, r3
+lea L27, X11
+lea L260, *r6
+L10: prn *r5
+sub #71, r3
+bne *r4
+not *r2
+L11: rts
+not L118
+; comment
+mov r4, r5
+L12: .string "iotlachvswzeccjv"
+L13: not r2
+L14: not r1
+; comment
+inc r5
+dec *r0
+lea X5, r5
+mov *r1, *r2
+lea X21, *r0
+not r0
+L15: .string "b"
+L16: inc L10
+L17: .string "icrlbhgkm"
+not *r7
+lea X2, *r3
+add *r4, r5
+bne *r0
+inc r5
+
+L18: .data -543, -948, -285, 280, -625, 660, 697, -284
+lea X5, L6
+L19: sub L23, *r4
+
+add r2, L223
+not *r5
+inc X21
+L20: .data 768, 980
+L21: dec X4
+red L10
+clr r5
+inc L13
+jsr *r7
+inc r4
+not L121
+dec *r7
+L22: .data 387, -904, 866
+; comment
+red r6
+add *r3, r1
+L23: jmp *r6
+inc *r3
+red r2
+clr *r0
+clr X16
+L24: not X1
+jsr L52
+dec *r0
+sub *r4, L3
+L25: cmp *r1, X14
+L26: .string "lqasaknsasu"
+not r2
+bne *r6
+bne L6
+L27: cmp *r0, X6
+red r2
+bne *r4
+jsr *r5
+lea X24, r6
+L28: .data -700, -707, -927, -877, 860, -864
+L29: jmp L163
+lea L21, *r7
+inc r7
+mov *r1, *r2
+inc r5
+L30: .data 345, -961
+jsr L252
+L31: .string "zh"
+inc X11
+; comment
+L32: stop
+L33: .string "wf"
+inc r7
+clr L164
+prn r4
+cmp r4, r5
+inc X8
+; comment
+dec r0
+cmp #-209, #142
+red *r5
+L34: sub #83, X8
+not r2
+bne *r0
+not r5
+mov *r6, *r2
+L35: rts
+jsr X21
+stop
+inc r5
+stop
+jsr *r0
+lea X13, X22
+L36: cmp *r6, *r7
+sub #-170, r6
+not *r0
+L37: .string "bljygcc"
+L38: .data -913, -436, -250, -891
+prn L66
+L39: not *r5
+red *r2
+jmp L16
+clr *r6
+L40: not r7
+L41: .string "ixbjaymradh"
+L42: .data -184, 77, 539, -248, -746
+mov X24, L59
+dec *r3
+bne *r1
+lea L3, r0
+L43: .string "pbarvvhsxgbhvtrgtrjau"
+mov r5, X17
+L44: rts
+bne X15
+jsr *r0
+L45: bne *r5
+L46: cmp r1, *r7
+clr L11
+prn #119
+inc L214
+L47: .data -540, 39, 854, 839, 870, 609, 526
+add #-236, L43
+L48: bne L184
+L49: red L31
+not r0
+add r1, X21
+jsr *r1
+not *r3
+jmp *r1
+cmp *r3, r7
+inc *r4
+inc r4
+; comment
+bne *r6
+L50: red *r0
+lea X23, L226
+L51: stop
+prn r6
+add X10, r2
+inc r7
+L52: lea L34, *r6
+dec r2
+; comment
+L53: mov r3, *r0
+rts
+add L42, *r0
+L54: dec X20
+clr L0
+; comment
+dec L121
+sub r1, L78
+L55: stop
+rts
+jmp L10
+mov L164, r7
+add #-170, X9
+rts
+L56: .string "dxgb"
+clr *r5
+jsr *r0
+add #215, L205
+red L238
+L57: .string "xfmrimmksfchpfc"
+jmp L9
+L58: mov L203, *r0
+L59: .string "qt"
+L60: add L3, *r0
+rts
+not X14
+jsr *r7
+sub X11, *r6
+stop
+add X5, L256
+not *r4
+
+add *r0, *r1
+bne L59
+sub #-135, *r2
+red *r4
+L61: .string "hdzobqcxhzqgixadyscgydof"
+L62: prn #37
+not X10
+L63: .string "qqj"
+prn #-220
+L64: .string "zirzupdtcwtygewtycbx"
+jsr L121
+bne L59
+L65: .string "alkikorkxhkjijdpwwvume"
+inc *r6
+clr L13
+lea L101, r6
+L66: .data 986
+L67: add r4, r3
+bne L56
+bne X8
+rts
+jsr *r5
+L68: lea L17, r0
+L69: .string "eqehpfqnldelmz"
+stop
+L70: .data -560, 497, -836, -236, 524, 120, 972
+L71: prn #115
+bne *r7
+prn #-76
+L72: .data -329, -671, -534
+bne X19
+not L60
+jsr *r7
+rts
+not *r5
+red L54
+bne X0
+L73: jmp L28
+jmp *r1
+L74: stop
+L75: clr X1
+prn *r4
+mov X6, *r3
+not L225
+jmp *r1
+sub r6, *r3
+stop
+jsr X11
+mov L5, r2
+dec *r3
+add #252, *r7
+sub *r5, *r3
+jsr *r3
+cmp X9, #62
+add #140, *r1
+jmp L40
+rts
+jsr *r7
+cmp X21, r0
+jmp *r5
+not L146
+red r4
+not X20
+not r6
+L76: stop
+red X11
+sub *r5, X23
+L77: inc *r7
+not r6
+L78: .data -417, -45, -724, -948, 834
+rts
+jmp L252
+L79: .data -832, 547
+inc *r1
+L80: .data -61, -473, -624, 682, -915, 903
+cmp X4, X14
+jsr L17
+stop
+dec r3
+dec *r5
+clr r6
+mov r6, X18
+L81: sub #-183, X9
+inc r1
+dec r2
+L82: add #29, *r0
+jsr L183
+mov *r0, L14
+L83: lea L93, *r2
+L84: .data -967, -935, -892, -712, 387, -241, -434, 956
+cmp r0, r5
+red L6
+stop
+L85: mov #-227, r6
+L86: inc *r4
+dec X3
+not *r1
+rts
+L87: bne L102
+bne X22
+add *r1, *r4
+red *r2
+
+sub *r4, *r5
+
+cmp L127, L97
+lea L175, L195
+mov L30, *r3
+dec r4
+
+L88: inc X3
+L89: .data 230, 80, 427, 68, 414
+prn r4
+inc r3
+sub #-242, X4
+stop
+prn #-14
+L90: .data 663, 131, -505, 896
+lea X10, *r0
+jmp L242
+bne *r5
+L91: mov #209, L14
+L92: .data 209, 831, -872, -135
+dec r7
+L93: inc r1
+sub *r3, r2
+
+jsr *r7
+rts
+jsr *r0
+L94: .data -188
+L95: .data 246, -307, -852, 162, 530
+add r1, L59
+
+lea L159, X17
+not L183
+L96: .data 855
+L97: dec r4
+lea X10, *r6
+cmp L1, L0
+bne X18
+L98: add r7, X15
+jmp *r1
+jmp *r0
+inc *r4
+L99: .string "hhhgppquxt"
+dec L37
+jsr *r7
+lea X1, L148
+bne X16
+L100: add L234, L220
+rts
+inc r1
+L101: clr *r4
+sub r0, L190
+L102: stop
+L103: cmp r6, r2
+L104: lea L246, *r0
+jmp L45
+add r2, r3
+L105: stop
+rts
+; comment
+cmp L59, #151
+mov r1, r3
+stop
+; comment
+not L140
+stop
+L106: rts
+jmp L83
+rts
+clr r2
+mov L30, r7
+L107: rts
+add L92, r5
+lea L203, r7
+dec r2
+clr L160
+jsr X20
+rts
+L108: lea X2, r0
+lea X9, L8
+stop
+lea X16, *r2
+L109: .string "yorackgcmqglf"
+red *r5
+L110: .string "izwskdqm"
+add #-99, L193
+not r3
+L111: jsr X18
+inc r7
+L112: mov #-230, L13
+stop
+L113: not r5
+bne *r2
+L114: stop
+jsr L135
+lea L110, *r0
+clr r3
+sub #225, r0
+sub #19, X2
+L115: red L188
+stop
+L116: stop
+L117: .string "pnzyixgqzr"
+jmp *r7
+lea L48, X22
+inc *r7
+add #-218, r7
+L118: .string "jsshxn"
+L119: .data -197, 800
+cmp *r2, r1
+lea L200, r0
+clr X10
+cmp X23, *r5
+L120: .string "zqeup"
+stop
+jmp *r2
+stop
+cmp L17, r3
+L121: .data 447
+L122: bne X24
+L123: mov #-4, r6
+L124: add r4, *r2
+L125: mov L137, *r1
+cmp #-3, X24
+L126: .string "momuglccakum"
+bne L155
+mov *r3, L71
+prn *r6
+L127: inc r4
+clr r5
+prn *r0
+L128: inc r2
+L129: dec L155
+red *r3
+mov L237, r2
+L130: mov X7, X21
+rts
+L131: .string "wpxbdmqpyxrmpht"
+jmp X24
+prn #184
+cmp #-217, #85
+bne L199
+bne X12
+; comment
+L132: rts
+; comment
+sub *r1, X10
+lea X5, r3
+sub *r2, r5
+inc r1
+L133: dec r6
+inc *r0
+prn #-117
+add *r7, X3
+L134: red *r2
+L135: jmp *r7
+L136: inc *r2
+bne *r0
+L137: .data -352, -265, -761, -500, 231, -208, -451, -31
+dec r7
+clr r7
+add r1, r6
+inc L34
+red r3
+prn X21
+red *r5
+jmp X22
+red X13
+inc r1
+L138: lea L35, *r0
+L139: prn #137
+mov r5, r0
+lea L54, L258
+jmp L238
+dec L69
+not r7
+sub *r7, r4
+clr r0
+L140: .string "xqamtze"
+L141: mov L257, r5
+clr *r4
+red *r4
+bne *r6
+L142: red r6
+sub r6, r1
+L143: clr L113
+L144: .string "cmnjfkwvamkimatyicuvvx"
+prn *r5
+
+not *r3
+cmp *r4, #90
+not L187
+cmp *r1, r6
+dec *r0
+L145: prn r2
+mov #-197, r4
+lea L112, L97
+L146: red r5
+
+mov #40, r0
+jsr *r0
+not r4
+
+inc *r0
+add *r2, *r7
+bne L24
+L147: .data -446, -103
+prn #12
+inc r5
+bne L190
+; comment
+L148: .data 538, -121, -790, -610, 91, 886, 825
+jmp L83
+mov L175, r4
+mov r2, X19
+clr L155
+dec r4
+lea L58, r0
+L149: jsr *r3
+cmp #-161, X14
+prn r3
+L150: .string "c"
+inc r1
+inc r7
+lea L217, r0
+L151: .string "twjnijyjwixv"
+not *r6
+inc *r6
+red X7
+L152: dec r5
+red L207
+sub *r6, r3
+jsr *r3
+bne L223
+inc r5
+not *r3
+L153: jsr L48
+jmp *r0
+dec X21
+; comment
+bne L210
+prn r6
+L154: .string "mddohw"
+sub #213, L102
+lea L240, L236
+prn *r1
+red r3
+inc r1
+L155: cmp #-77, r1
+not r0
+L156: .string "t"
+stop
+rts
+add L36, L142
+stop
+clr *r5
+L157: dec r3
+mov *r3, r3
+stop
+jmp X10
+bne L92
+rts
+jsr L86
+jsr L84
+clr L210
+L158: bne L203
+dec r4
+lea X14, *r5
+L159: inc X1
+clr *r2
+clr L209
+cmp #192, r4
+L160: mov r0, *r6
+clr X0
+L161: sub #-15, *r5
+L162: .string "kznaxfulhdmmjrziqwjmgpm"
+L163: red *r7
+jmp *r5
+dec r3
+dec X8
+L164: not *r6
+
+red *r4
+L165: mov *r0, *r6
+add r3, r1
+stop
+L166: red L203
+L167: lea X24, L119
+rts
+jsr L132
+inc *r1
+mov L246, X24
+clr *r0
+; comment
+sub *r1, r1
+dec *r4
+red L188
+cmp X0, r4
+red *r1
+L168: red r7
+inc r1
+red *r7
+add X20, *r4
+L169: sub *r1, X10
+L170: .data -612, -46, 808, 325, -949, -706
+jsr X17
+jmp L173
+bne L19
+not X24
+red L195
+not X23
+inc r1
+L171: rts
+L172: .string "btoixzfctiuljruz"
+jmp X1
+L173: not L183
+inc *r2
+rts
+sub #139, r4
+cmp #-212, #-214
+add X6, *r1
+inc r1
+lea L205, r3
+clr r4
+L174: sub X12, X24
+L175: .string "ueeonxhsjtkkjdsujzjsvp"
+jmp *r1
+inc r2
+dec X9
+L176: .data 323, 235, 670, -553
+L177: bne *r0
+red r2
+L178: cmp *r5, X19
+prn r5
+L179: .data 499, 666, -146, -670, -347, 32, -91, -949
+
+rts
+
+L180: .string "rikfpevadnmaibhq"
+prn *r6
+L181: cmp *r3, #138
+L182: .string "njsmqhckhbjwjxfpkput"
+prn *r3
+rts
+L183: .string "bceaxpkfulybdzaxanfq"
+mov r5, X17
+L184: rts
+L185: jsr X10
+clr *r1
+L186: lea X10, X8
+clr r0
+L187: red r5
+L188: inc L73
+L189: .data 793, 753, 814, 170, -577, -634, 180
+L190: stop
+prn r3
+rts
+L191: stop
+L192: .string "jqdfvgetzaxojkrj"
+
+jmp *r6
+dec *r3
+stop
+rts
+stop
+; comment
+L193: not r7
+dec r6
+not *r1
+jmp *r2
+dec L240
+
+inc L257
+mov L197, *r4
+L194: sub r6, r4
+L195: inc *r5
+lea X12, r0
+jsr X4
+L196: red *r7
+L197: stop
+jmp X1
+; comment
+clr r2
+prn #167
+sub r4, *r0
+L198: .data -370, -181, 24, -591
+inc r7
+L199: .data 262, 344, -19, -805, -446
+dec *r2
+not r0
+
+L200: .string "tcbmhhjcicfuoenlybdsexr"
+dec *r1
+
+L201: inc *r1
+
+L202: add r3, X3
+sub *r7, L137
+cmp #120, r4
+prn *r3
+prn r4
+jmp *r3
+sub r3, X12
+clr r7
+clr r1
+dec *r0
+inc *r4
+L203: red L181
+
+lea X18, r5
+L204: mov r5, X1
+jmp *r1
+sub r4, L13
+mov #180, *r4
+dec *r2
+stop
+not *r3
+rts
+lea X7, r7
+lea X13, r2
+L205: prn *r2
+; comment
+L206: clr X3
+jsr *r3
+sub L177, X8
+; comment
+rts
+L207: lea X12, *r7
+red r1
+L208: .data 799, -907, -628, -861, 698, 519, 929
+jmp X10
+not *r1
+L209: .data -613, 851, -129, 540, 512
+add X8, *r4
+L210: mov r2, L59
+stop
+stop
+rts
+add L35, r4
+add #204, L222
+rts
+
+dec r2
+jmp L254
+lea X14, L203
+mov r0, *r7
+L211: red *r6
+sub r2, L109
+jmp *r4
+cmp L230, L233
+; comment
+bne *r4
+L212: .string "avvjysewllnyosybvdbwblop"
+bne *r5
+L213: stop
+dec r1
+; comment
+rts
+red r7
+clr r1
+jmp *r0
+add *r3, r4
+L214: prn L47
+L215: .data 565, 449, 441
+sub *r3, *r1
+prn r6
+dec *r3
+
+L216: sub #161, L72
+inc X12
+dec *r3
+jsr *r2
+jsr *r0
+bne X3
+sub L255, r3
+red *r2
+L217: add *r5, L261
+lea X12, L257
+mov #-63, *r4
+sub X2, *r0
+L218: rts
+jsr L155
+L219: .data -965, 362, 756, 923
+prn #80
+L220: .string "ldejmvgzfzl"
+clr r6
+rts
+
+; comment
+red r5
+rts
+L221: jsr *r3
+cmp *r1, r2
+dec X14
+stop
+dec r1
+L222: .data -55, 920, 31, -697, -86
+dec L158
+add *r7, *r6
+rts
+; comment
+rts
+rts
+cmp *r3, *r7
+L223: jsr L254
+red *r4
+clr *r5
+lea L20, *r5
+L224: not r5
+jsr X3
+L225: clr r5
+stop
+sub X21, r7
+cmp *r1, #155
+cmp r3, #181
+L226: jmp *r3
+L227: .data 114, -437, -114
+
+dec L9
+L228: add X17, r6
+L229: .data -285, -451, 110, -717, 420, 327
+cmp L196, r2
+L230: .data 602, -929, -163
+mov *r0, r6
+bne *r7
+not *r0
+sub r1, X14
+sub *r2, r0
+L231: .data 670, -69, -901, 776, -876
+dec *r4
+L232: .string "vsv"
+red X22
+L233: add *r4, r7
+red *r6
+bne L240
+L234: .data 973, -518, 895, 725, 88, 305, -710, 165
+L235: inc r1
+rts
+L236: sub L251, r2
+jmp L140
+add *r3, L237
+dec X16
+inc L69
+L237: jmp X14
+L238: bne L247
+not r7
+prn L73
+jmp X0
+not X13
+inc *r2
+prn #-178
+not *r1
+jsr *r5
+bne *r6
+L239: inc r1
+inc L162
+L240: bne *r6
+L241: .string "vizbcsacj"
+rts
+jmp L258
+bne X22
+L242: .string "xyofecqvilwghtvo"
+add L178, r2
+sub L243, r2
+sub #100, X23
+L243: .data 327
+not L68
+stop
+bne *r7
+jmp *r7
+cmp L141, L32
+; comment
+mov #70, r7
+not r3
+cmp L36, *r2
+; comment
+mov r3, L261
+dec *r2
+stop
+stop
+
+mov *r5, r0
+L244: .data 47, 382, 228, 351
+lea L71, r0
+L245: cmp r0, *r4
+mov X16, L248
+not r2
+inc *r2
+L246: bne L255
+sub X1, r6
+lea X23, X8
+prn *r5
+
+bne L254
+jsr X6
+prn #-65
+stop
+L247: .string "uskpxcxfhnkgoeueuzlgthm"
+rts
+jsr L258
+cmp r6, *r4
+rts
+; comment
+dec L252
+mov L195, *r1
+clr r3
+L248: bne X9
+L249: prn r7
+L250: .string "wgvoy"
+mov L245, r1
+jmp *r5
+cmp L247, #185
+sub r6, L40
+; comment
+L251: mov *r1, X4
+dec r3
+cmp *r3, L231
+L252: .data 381, -605, -427, -316, 609, 912, 837, 137
+stop
+jsr *r2
+clr r5
+not r5
+lea L251, r1
+not *r1
+jmp *r3
+L253: jsr X1
+stop
+jsr *r1
+L254: .string "ebaleiznsikhevjfbzififi"
+L255: jmp *r4
+not r7
+not X16
+lea L261, X17
+rts
+sub #-226, r7
+stop
+cmp L253, r3
+bne *r3
+
+L256: stop
+cmp L259, *r6
+red *r2
+L257: lea L104, L253
+cmp *r1, #-135
+L258: inc r3
+L259: .string "rczawciy"
+rts
+cmp #51, r7
+not X4
+clr L260
+inc *r7
+L260: not *r4
+jmp *r0
+jmp X10
+bne *r0
+L261: add *r2, X21
+rts
+sub r0, *r0
+
+dec *r5
+stop
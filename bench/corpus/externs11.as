@@ -0,0 +1,1044 @@
+; Generated by genCorpus --seed 12
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+jmp *r6
+bne L206
+lea X11, *r7
+jmp L6
+mov #117, *r1
+red L47
+dec *r2
+inc r4
+L0: .data -126, -367, 711, 704, -714, -79, -808
+sub #-189, *r6
+
+prn #208
+dec *r1
+add r6, L25
+L1: cmp *r4, *r4
+bne X21
+jmp *r2
+inc r0
+lea X9, L37
+lea X9, L158
+L2: bne *r2
+L3: .data -740, 362, 576, -700, -273, -85, 429
+red r4
+L4: add r4, L193
+add r1, *r4
+add *r4, r6
+cmp r2, #161
+; comment
+mov #242, *r5
+sub *r4, r2
+jsr L92
+L5: .data 437, -774, -648, 15, 563, 295, -645
+; comment
+L6: inc r5
+red L205
+lea L254, L5
+mov L1, *r0
+add #-218, r5
+L7: not r1
+L8: .string "wbnzfnntauezc"
+L9: rts
+add *r6, *r1
+L10: .string "dgyz"
+lea L123, *r2
+stop
+jsr *r6
+rts
+L11: jsr *r2
+prn *r2
+; comment
+lea L10, r0
+
+jmp *r7
+jsr L9
+L12: lea X21, r0
+L13: red *r2
+sub *r0, *r6
+not X19
+L14: .string "nfkad"
+rts
+red *r3
+stop
+L15: clr r0
+clr r1
+add r2, *r7
+prn #189
+dec X13
+L16: jmp L6
+dec X5
+L17: clr *r1
+rts
+L18: sub *r7, X15
+
+add #219, r3
+add *r1, *r1
+L19: sub #50, *r6
+jmp *r5
+L20: cmp L173, *r5
+L21: rts
+dec L198
+add L119, *r0
+lea L177, r6
+stop
+L22: not *r7
+red L238
+L23: prn *r4
+bne X14
+lea L11, r5
+sub X6, r5
+stop
+not *r5
+stop
+L24: .data 718, -249, -732, -548, 405, -311, 81
+L25: dec X17
+L26: not L73
+lea L9, r3
+L27: rts
+red L16
+add #40, L10
+rts
+sub #18, L69
+add L10, r3
+lea L240, r5
+cmp *r5, r4
+add *r4, r2
+lea X2, r2
+mov *r5, *r4
+cmp #-156, L72
+jsr *r4
+L28: lea L66, *r1
+
+clr r6
+dec *r2
+L29: .data 113, 788, 13, -964, -850, 63, 215, 309
+mov *r0, r4
+; comment
+sub #114, X5
+L30: .data 22, -191, -593, 830
+jmp *r4
+mov #-20, r2
+L31: red *r4
+prn r3
+sub #163, r6
+not r7
+not X13
+
+L32: cmp *r0, X19
+stop
+jsr *r6
+rts
+sub #57, L150
+L33: .data 585, 893, -307
+L34: .data 82, -750, 687, 607, 463, 895, -39, -159
+prn r2
+stop
+jmp X11
+bne *r0
+bne L7
+lea X24, L56
+L35: cmp r1, #236
+inc L15
+L36: red r1
+L37: lea L128, X8
+dec X18
+L38: dec *r2
+jsr *r7
+sub #-13, X2
+inc L33
+L39: rts
+L40: dec r3
+lea X19, L3
+clr L238
+
+; comment
+dec r7
+; comment
+L41: .string "bzlzbmetgcosabkqfdaygkn"
+sub X22, L22
+cmp *r0, L243
+bne X21
+inc *r4
+cmp L19, r6
+L42: rts
+add #-126, *r1
+add r4, *r3
+red X19
+jmp X11
+not *r5
+L43: .string "fqasp"
+dec r3
+; comment
+cmp *r0, X5
+jmp X7
+stop
+inc X16
+jmp L0
+
+L44: .data -71, -168
+L45: .string "olljtvszicibktpnyn"
+red *r1
+add r3, r0
+red X7
+mov r5, *r2
+dec *r5
+prn *r5
+bne *r0
+; comment
+mov X11, *r0
+
+L46: add r2, r5
+L47: .string "orfaeyufqmejilgr"
+rts
+L48: .data 979, 833
+jsr *r2
+inc r4
+red *r7
+L49: .string "kwpkxsktlxplq"
+L50: .data 338, 456, 147, 737, 808, 998
+clr X17
+L51: rts
+clr *r0
+L52: .string "zbjnebzbfpoozkvzlp"
+L53: .string "tryhbszbcielqkwt"
+red L44
+L54: .string "iipjnfmhowjrhbayem"
+L55: add r0, r4
+not *r0
+jmp *r1
+red r2
+jmp *r1
+L56: .string "nockrszszwftuxyokv"
+jmp *r5
+inc *r1
+bne *r2
+L57: .string "jibxeuybennfimazkowy"
+rts
+stop
+jmp *r5
+not L143
+L58: lea L29, L15
+L59: lea X1, *r7
+rts
+L60: prn r1
+L61: jmp *r6
+L62: red X2
+stop
+L63: add *r3, *r7
+add #-236, L21
+dec r6
+stop
+cmp X15, *r7
+lea X10, *r3
+stop
+jmp *r5
+
+mov X24, L43
+L64: mov r5, L38
+bne L20
+lea L61, L135
+red L198
+; comment
+jsr L58
+bne *r7
+; comment
+L65: stop
+inc *r1
+red X1
+L66: mov r7, L173
+add L3, L239
+not X0
+mov #-181, r5
+L67: mov L115, X17
+not r6
+jmp X9
+sub X20, r7
+
+red L227
+stop
+clr L37
+cmp r3, *r2
+jsr L62
+L68: cmp #81, *r6
+jmp L232
+stop
+inc *r3
+lea L43, *r6
+L69: .data 419, 69, -372, -547
+L70: .data -9, 890, 616, -75, 424, -497, -884, -731
+inc r7
+; comment
+L71: inc *r0
+L72: clr *r7
+not X22
+L73: .string "xnsfcg"
+dec r6
+jmp *r0
+L74: lea L177, L178
+L75: jsr X0
+stop
+L76: dec X24
+sub #58, r3
+stop
+dec *r3
+jmp *r1
+L77: inc L36
+L78: lea L45, *r3
+add r2, L255
+mov #93, r5
+rts
+; comment
+not *r2
+dec r4
+add #107, *r0
+lea L8, L35
+inc r3
+L79: .data -391, 391, -343, -447
+sub r5, *r0
+dec r1
+stop
+cmp r4, L52
+inc *r3
+stop
+not r6
+add #-213, X19
+sub r7, L59
+L80: .string "tgbxpkzffrjydanxs"
+L81: clr L78
+add *r2, r6
+L82: .string "aglupiguxij"
+L83: cmp *r4, *r7
+L84: .string "kqz"
+inc r6
+sub *r1, *r0
+
+
+sub X17, r1
+jmp *r3
+mov #197, L118
+L85: .data -11
+L86: prn L35
+rts
+jmp X23
+not *r0
+add *r0, X7
+
+not L36
+clr r7
+dec *r7
+L87: jsr *r2
+jmp *r5
+L88: .data 436, -344, -426, 145, -49, -610, 319
+rts
+dec r5
+add *r7, r7
+L89: .string "wicedcjljjmcg"
+L90: clr L51
+dec L11
+dec r5
+lea X23, r4
+L91: .string "phwqsvoyuxkhigrz"
+add *r2, r2
+L92: mov L122, X10
+stop
+L93: inc L171
+rts
+add *r0, *r7
+rts
+add #6, r0
+L94: .data 524, 234, 833, -363, -532
+add r0, r0
+bne *r5
+inc *r4
+L95: .data 152, 597, 932, -959, 61, 775
+L96: .string "dmajuyidiwsy"
+L97: .data -275, -725, -357, 523
+sub *r5, r3
+inc *r3
+stop
+jmp L237
+L98: .data -364, 963
+not *r7
+not *r0
+; comment
+sub #224, *r6
+prn r4
+cmp r1, *r0
+rts
+prn *r5
+stop
+cmp #48, #-95
+red r3
+L99: jmp X14
+jsr *r3
+rts
+stop
+clr X1
+sub L151, r0
+mov r0, *r5
+prn X7
+L100: inc L10
+not *r0
+; comment
+stop
+L101: lea X13, *r6
+prn L184
+L102: stop
+rts
+dec r2
+sub *r7, r5
+sub *r0, X12
+clr L100
+dec X22
+L103: lea L214, *r0
+lea L2, r4
+rts
+dec L232
+jsr L13
+rts
+L104: .data -989, 82, -469, 291, -198
+add L104, *r1
+stop
+jmp *r1
+lea L56, L35
+cmp X3, #-61
+dec *r7
+inc *r4
+L105: .data -300
+L106: .data 289, 845
+rts
+dec *r7
+L107: .data -856, -145, -783, 965, -847, -998
+sub r0, r1
+L108: clr r0
+jmp *r3
+cmp #-161, r7
+not r6
+jsr L197
+rts
+prn X0
+inc *r6
+L109: .string "yogdcafafyeosoflbviwt"
+L110: .string "ieksggudvlsbojzl"
+
+prn #-25
+sub L30, L51
+L111: .data 514
+bne X9
+red *r7
+L112: .string "jxsksgrzudjfgwrjqln"
+jsr L191
+inc *r1
+L113: not L191
+mov X6, *r7
+jmp *r6
+not r7
+add X21, L62
+add #-179, r1
+cmp r5, L53
+
+stop
+jmp L115
+L114: inc L8
+L115: inc X8
+bne X12
+inc X1
+mov L169, *r0
+cmp X9, *r0
+add L78, *r4
+not r5
+; comment
+bne L193
+jsr *r1
+inc r3
+L116: .data 285, -128, -694, 140
+L117: .data -329, 908, 510, 725, 369, 288, 942, 942
+L118: sub *r4, r1
+L119: stop
+jsr *r5
+add #54, L130
+add #-238, *r6
+red *r5
+jmp *r3
+clr *r2
+lea X19, *r4
+mov r1, L33
+lea L170, X20
+jmp L211
+L120: .string "i"
+red L191
+not *r6
+mov #72, *r1
+lea L158, *r1
+rts
+sub X14, r0
+rts
+cmp r4, X10
+L121: .data -513, 652, 557, 480, 167, -742, 471
+jmp *r5
+L122: not r6
+lea L218, *r5
+; comment
+L123: not X9
+not *r4
+cmp *r7, *r5
+prn #102
+lea L123, *r2
+bne *r0
+bne L193
+; comment
+jsr L144
+stop
+clr X12
+clr r4
+L124: dec X19
+; comment
+mov r5, *r3
+L125: jmp *r4
+clr *r5
+cmp *r6, L139
+; comment
+inc r5
+dec r2
+jsr L222
+not r5
+sub #39, *r2
+clr r6
+L126: .string "gweogioyqnxnsrip"
+add r0, L149
+L127: jmp L238
+L128: dec L239
+clr *r0
+red L103
+L129: jmp *r3
+inc *r6
+jsr *r4
+L130: .string "xrlriojmv"
+
+clr r6
+rts
+inc L178
+
+not r3
+L131: dec L236
+L132: .string "givwaqshamlnuzlmermonkwm"
+lea L257, L170
+
+prn *r3
+sub #-15, X9
+prn *r1
+prn #-227
+mov *r7, *r7
+L133: prn r3
+cmp #195, #162
+clr X15
+L134: .data 836, -175, 111, -505, 735
+sub *r5, X20
+inc r0
+jmp L229
+bne *r0
+jsr *r1
+jsr L70
+; comment
+L135: stop
+L136: .data -895, -260, -349, -658
+add *r6, L46
+; comment
+L137: .data 684, -459
+L138: lea X7, X20
+L139: prn r0
+sub r1, *r4
+sub *r6, X15
+L140: clr *r2
+red X0
+mov *r4, L98
+L141: sub r5, *r3
+sub L218, L183
+L142: .data 899, 378, 470, 222, 403, 103
+dec L217
+not r7
+L143: .data 405
+mov #117, r2
+L144: lea L188, r5
+clr *r2
+sub r3, r5
+add X13, *r5
+jsr *r2
+bne X8
+bne *r3
+lea L141, *r4
+L145: .data 652
+L146: inc *r3
+jmp X3
+sub *r7, r2
+L147: .string "fhceiv"
+L148: clr L158
+; comment
+clr r0
+inc r7
+sub r5, *r4
+L149: lea X16, r0
+inc r1
+L150: jsr L156
+prn X6
+red L65
+jmp *r0
+L151: prn #26
+L152: .string "bdzcfjxjcieuladtazuchv"
+L153: .data -183, 356, -442, -371, 335, -689, 407, -429
+L154: cmp #124, r7
+; comment
+add #59, *r2
+stop
+clr *r2
+not X18
+L155: jmp *r3
+sub r7, *r2
+clr *r4
+L156: dec X13
+lea L235, *r3
+add L169, *r0
+mov r5, *r5
+not *r4
+sub r3, *r0
+dec *r4
+jmp *r4
+clr L133
+red X2
+bne X9
+bne *r1
+L157: .data 298, 804
+cmp r4, #213
+
+clr L128
+inc *r5
+L158: jsr *r2
+inc L259
+stop
+L159: dec *r1
+mov X1, *r0
+cmp r2, X4
+sub *r6, L179
+clr *r6
+inc r3
+; comment
+L160: lea L33, *r7
+jmp *r1
+L161: .data -774, 790, 721
+L162: .data -512, -827, -726, 599, 25
+jmp *r4
+rts
+inc r5
+sub *r5, *r2
+lea L37, *r7
+lea X2, *r5
+jsr *r1
+rts
+dec r5
+bne L185
+L163: stop
+stop
+red *r7
+; comment
+red r4
+L164: add r6, *r3
+jmp *r1
+bne *r4
+L165: jsr *r3
+dec L206
+bne X13
+cmp *r7, L181
+prn r3
+not X13
+add *r0, L245
+jmp *r2
+jsr *r6
+prn r2
+red r0
+L166: .string "pezrzpnqqwakttkikzfbkf"
+jsr X20
+bne X6
+bne L1
+L167: .data -449
+clr X11
+jsr L2
+L168: cmp L138, #-41
+jmp *r6
+cmp *r4, *r3
+; comment
+jmp X0
+rts
+bne *r7
+; comment
+prn *r0
+bne *r5
+add #34, *r3
+L169: mov #-229, r1
+sub X22, *r7
+inc r0
+add r4, r4
+inc X7
+L170: jsr L78
+L171: red X15
+jsr *r3
+jsr L209
+bne L106
+L172: red *r6
+mov r0, r1
+inc *r2
+dec r6
+prn L255
+L173: lea X17, X24
+; comment
+; comment
+
+cmp #-82, #203
+mov X1, r0
+L174: jsr L100
+not *r0
+not *r2
+L175: .data -166, -509, -61, -7, 278, -66, -756, -333
+add X22, L152
+L176: .data 471, 563, 292, 648, 679, -355
+jsr X4
+L177: inc L229
+L178: .string "pa"
+jsr L221
+cmp #170, X12
+jsr *r6
+stop
+sub r5, X5
+
+rts
+prn X14
+L179: jmp L130
+bne *r2
+cmp r4, X2
+stop
+bne *r6
+not L90
+L180: lea X5, X2
+mov #-93, X2
+dec L211
+dec *r4
+sub #189, X20
+not *r1
+jmp L35
+clr r2
+mov *r3, *r1
+L181: jmp *r3
+L182: .string "xpcfrcdwzwwn"
+jsr *r6
+mov #99, X24
+stop
+clr L224
+sub #103, r1
+cmp *r7, #252
+not *r4
+clr L41
+; comment
+add r7, X19
+L183: stop
+L184: .data 900, 45, 707, -155
+cmp *r0, *r2
+cmp X0, r0
+L185: cmp r6, #58
+stop
+rts
+L186: inc *r1
+clr *r3
+jmp L232
+prn *r7
+cmp L227, #-233
+jsr *r4
+clr L259
+mov *r3, *r6
+jmp *r6
+lea L206, *r3
+L187: .data -549
+sub *r2, r6
+lea L58, r3
+L188: stop
+jsr X9
+red *r5
+jsr L122
+red *r7
+mov #98, r2
+L189: red L118
+jmp L207
+jmp *r4
+stop
+dec r2
+; comment
+L190: red *r7
+L191: .data 318, 97, -465, 880, 398, -180, 964
+L192: lea L235, r4
+dec L264
+L193: .data -584, 737, -754, 592, 637, -728
+L194: lea L230, *r2
+bne *r7
+lea L249, r7
+L195: cmp r1, X9
+bne X0
+clr X14
+lea X9, r3
+not *r5
+inc r3
+red *r7
+clr *r0
+bne L161
+lea L78, *r7
+add r3, *r3
+L196: .string "fmnzkvuofuequugwsfdiybn"
+L197: .string "sursgukojifbss"
+L198: add L202, *r1
+L199: stop
+stop
+add *r6, *r4
+L200: sub *r1, r6
+L201: dec r4
+L202: prn *r4
+not *r7
+inc L261
+inc *r3
+red *r5
+L203: rts
+
+L204: sub X11, r6
+prn *r5
+lea X6, r0
+L205: mov r5, X24
+L206: .string "oxctiglsvwqcbfr"
+mov #-232, *r5
+L207: bne *r6
+L208: stop
+clr r4
+prn r7
+jmp *r3
+not *r4
+sub X0, *r6
+jsr L253
+rts
+L209: clr *r2
+L210: dec *r5
+L211: rts
+rts
+L212: red L262
+prn *r3
+dec *r6
+L213: .data 834, -809
+prn L221
+dec r3
+cmp *r7, r4
+L214: not r7
+; comment
+L215: inc r4
+sub #133, *r4
+L216: .string "ydjvgrvb"
+mov #-26, r1
+lea L246, X5
+jsr X16
+L217: not L265
+
+red L173
+mov X16, *r0
+rts
+L218: inc X6
+add X8, *r1
+jmp *r3
+mov #3, *r3
+; comment
+L219: .data 157, -376, 706
+not *r2
+cmp *r4, *r6
+clr L241
+sub *r3, X19
+add *r2, r4
+rts
+clr r0
+L220: jmp *r3
+L221: stop
+L222: add #219, L230
+cmp L246, *r7
+not *r7
+lea X22, *r4
+not r4
+jsr *r2
+sub *r6, r1
+L223: inc r5
+rts
+L224: .data 838, 530, 564, 693
+jmp *r2
+inc *r4
+cmp r7, L193
+L225: stop
+L226: red r1
+add *r3, *r7
+lea L228, r2
+lea L21, L248
+lea X24, X2
+L227: .data -721
+red r3
+L228: mov r4, L211
+mov #-87, *r1
+stop
+L229: jsr *r7
+
+L230: inc *r4
+bne L260
+jsr *r7
+jmp L242
+L231: .data -788
+red *r2
+bne *r0
+mov r7, *r4
+rts
+mov *r6, r4
+bne *r6
+bne *r0
+sub r6, r5
+L232: lea L108, *r7
+L233: sub X24, X21
+L234: .data -6, -461, 139, -774, 176, -83, -978, 783
+inc r2
+L235: .string "ppllxhdsvoectzgddplt"
+L236: stop
+L237: clr X17
+red *r5
+L238: red r7
+L239: red X13
+L240: dec r3
+L241: .string "hommuuoznhkdvdznk"
+dec L209
+sub L249, L245
+stop
+; comment
+lea X14, X7
+L242: rts
+L243: jsr L95
+rts
+lea L254, r0
+mov #-130, r1
+bne *r5
+L244: .data 30, -145, 311, 614, 926, -200, -646, -713
+bne L253
+L245: clr r6
+not X8
+add r3, r6
+L246: .string "kzb"
+L247: red r4
+prn *r7
+L248: .string "kxypnebpacwij"
+lea X22, r6
+clr r0
+cmp *r1, r6
+cmp L128, r4
+jmp *r7
+add L120, X10
+L249: inc *r5
+lea L258, L253
+
+inc L23
+L250: sub r3, r3
+L251: bne *r5
+jsr *r5
+lea X21, *r1
+mov *r7, r2
+L252: jmp *r7
+rts
+jmp L263
+bne *r7
+jsr L263
+prn r3
+sub *r1, *r4
+L253: .string "dopmaljhutus"
+lea L255, *r4
+not *r6
+prn r7
+L254: stop
+jsr L259
+rts
+inc *r5
+jsr X15
+L255: .data -182, 499, -341, 32, -823, 968, 94
+clr *r7
+L256: clr r7
+add r6, r7
+L257: bne L114
+L258: .string "aessjrfvlogalgnnslal"
+rts
+add *r2, *r7
+mov L259, r5
+inc L84
+inc *r3
+prn r1
+clr *r2
+L259: bne X6
+prn *r3
+L260: .data -373, 486
+mov L263, *r5
+L261: red *r7
+inc *r4
+L262: .data 187
+cmp r1, L125
+red r3
+not X9
+prn *r2
+L263: inc r0
+jmp *r3
+mov L161, X7
+bne *r1
+L264: bne *r5
+jmp L12
+not X1
+add X14, X11
+; comment
+cmp L265, L265
+sub #218, *r4
+L265: mov X15, *r4
+L266: bne *r2
+stop
+stop
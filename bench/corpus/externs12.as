@@ -0,0 +1,1044 @@
+; Generated by genCorpus --seed 13
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+clr *r4
+add #135, L107
+jsr *r0
+stop
+jmp *r3
+prn L139
+add *r1, *r1
+prn X24
+mov *r0, X0
+L0: prn r5
+L1: .string "twsdeujunpvgeoyte"
+rts
+L2: inc r5
+jmp X18
+dec *r3
+L3: sub X22, r4
+rts
+jsr L8
+not *r6
+L4: bne *r4
+rts
+red r4
+clr X22
+cmp #233, *r2
+prn *r4
+inc L1
+jmp L2
+sub r5, *r5
+jmp L53
+lea X10, *r5
+; comment
+L5: .data -863, -985, -824, -712, -561, 656, 802
+dec *r2
+dec X24
+rts
+stop
+jsr L3
+add r5, L245
+not L219
+cmp *r5, r3
+stop
+dec r6
+not r1
+inc *r4
+dec r6
+mov L2, L4
+dec L3
+L6: jsr L5
+; comment
+L7: .data 774, 154, 30, 36, -31, -378, -970
+
+L8: add r3, X14
+jmp *r6
+lea L8, *r2
+add *r3, *r4
+red L149
+bne *r6
+prn L62
+add *r5, L7
+L9: not r5
+clr r0
+jmp X20
+stop
+
+clr X4
+add r5, L197
+L10: stop
+bne *r5
+L11: .data 613, 138
+L12: bne *r5
+add #-135, *r0
+red X8
+inc X13
+L13: clr r0
+L14: .data -841, 116, -548, -599, 182, 897, -86, -527
+jsr X17
+rts
+cmp r5, *r1
+sub *r3, r3
+L15: dec *r6
+L16: .string "ygqkcanuzuuh"
+inc L237
+dec r0
+jmp *r1
+L17: not *r7
+mov X15, L263
+L18: .string "qvpqfkwxdywugfgqouvbno"
+dec L28
+L19: bne L264
+; comment
+sub r7, L51
+L20: not X8
+
+inc *r6
+sub *r3, *r0
+L21: .string "ubv"
+sub *r0, r6
+L22: .string "ipy"
+
+cmp L21, #158
+add #63, r4
+bne X7
+clr L241
+add r7, X20
+bne L182
+L23: stop
+bne L11
+not *r0
+jsr L10
+L24: sub *r6, L214
+dec X17
+lea L78, *r6
+L25: add #-68, *r7
+prn *r4
+mov #-87, *r3
+bne L1
+stop
+lea X12, *r7
+stop
+bne *r2
+L26: .data 187
+add r4, L9
+add #128, L1
+rts
+sub X3, *r4
+cmp L4, #-172
+add *r0, *r5
+add *r5, *r4
+add X2, r1
+rts
+stop
+lea L7, L8
+jmp *r5
+clr r4
+L27: dec L14
+L28: prn #216
+dec r7
+L29: .string "cybdcmhdskoq"
+L30: .string "pfqptweanbldahlgxuvuo"
+inc *r5
+L31: jmp L27
+L32: inc *r5
+L33: red *r2
+L34: stop
+L35: rts
+L36: dec *r2
+L37: mov r2, r6
+red *r6
+L38: stop
+mov *r6, X19
+dec r2
+L39: .data -515, 330, 535, 647
+clr L0
+cmp *r6, X0
+red L3
+mov *r2, *r3
+L40: jsr L30
+L41: prn r7
+lea L17, L14
+red r1
+L42: inc *r0
+dec L4
+red r1
+rts
+add #-46, *r3
+red r2
+bne *r5
+L43: .data -483, -192, 715, -263, 633
+rts
+add L18, r1
+dec L34
+L44: .data 530, 178, 474, 367, -65
+add *r2, r1
+jmp *r0
+bne *r3
+L45: not r1
+red L172
+red r6
+jsr *r4
+rts
+bne *r2
+inc r3
+red L25
+L46: clr *r1
+not r7
+prn L10
+prn *r7
+
+L47: .data 712, -731, -788
+mov r3, r0
+sub #199, L3
+cmp *r6, *r5
+cmp #-29, r0
+L48: sub r2, r3
+L49: inc r4
+dec r7
+inc r1
+
+not X17
+L50: cmp X0, *r4
+sub X14, r0
+add X2, *r1
+mov r2, *r0
+sub #-131, *r3
+inc *r5
+L51: prn L63
+rts
+inc *r6
+
+L52: jsr L258
+not r7
+L53: red *r3
+L54: .string "cqpt"
+dec L203
+jmp L110
+dec r2
+sub #-236, r5
+not *r0
+jmp *r6
+bne X15
+add #-146, X3
+clr *r7
+lea L30, *r6
+
+sub r1, r7
+L55: dec L134
+L56: prn *r6
+jmp *r1
+prn X22
+not *r4
+L57: .data 535
+bne *r6
+rts
+L58: sub r5, *r2
+add r6, X12
+sub X10, r1
+sub r0, r5
+; comment
+L59: lea L183, L0
+L60: .string "wbjyd"
+L61: dec *r4
+L62: mov X4, *r1
+L63: jsr *r0
+inc r2
+red L24
+sub *r3, L32
+rts
+L64: .data 460, -75, 782
+bne *r1
+lea L55, L70
+cmp *r7, X22
+mov r4, *r2
+cmp r1, X11
+L65: .string "yolq"
+L66: .string "wmsytntwiupxqhsgdalyb"
+L67: .string "hmwicoebnsyutllmya"
+jmp L26
+not *r5
+inc *r0
+L68: rts
+inc *r1
+rts
+red r1
+L69: jmp *r4
+; comment
+inc r3
+L70: bne *r6
+L71: .data -837, 285, -353, 441, -609, -474, -44
+rts
+lea X18, L54
+L72: .data -557, 458, -277, 84, 111, 470, -573
+jsr *r3
+rts
+mov X0, r4
+add X15, *r1
+mov r5, *r7
+; comment
+inc *r6
+L73: stop
+jsr L29
+sub L30, r6
+L74: dec *r4
+jsr L7
+add *r6, X5
+L75: red X3
+L76: sub r7, L69
+prn X9
+L77: .string "wfzutfeswgjxvkoihofsv"
+bne *r2
+jmp L74
+mov #122, *r2
+inc r3
+jsr *r5
+L78: .string "zcgovkirlibiackvv"
+inc L30
+jmp L7
+jmp *r7
+add L186, X0
+L79: mov X24, *r3
+rts
+mov X6, *r7
+
+clr r0
+
+L80: jmp X22
+inc r1
+red L135
+clr *r6
+; comment
+L81: bne X23
+jmp *r4
+cmp L101, *r3
+stop
+jsr L15
+prn #-145
+jmp *r6
+jmp L116
+sub *r2, r4
+dec r0
+L82: mov r6, r4
+L83: bne *r1
+L84: .string "pag"
+sub #192, L95
+add L49, r1
+L85: dec r1
+L86: .data -278, 895
+L87: red X15
+jmp L176
+add *r7, *r2
+clr r2
+L88: rts
+mov *r7, *r3
+L89: .string "hjgldhgoivlzwkmk"
+inc *r1
+L90: .data -27, 539, 912, 733, -913, -408, -176
+L91: jmp L74
+L92: jmp X16
+mov r4, L113
+L93: inc L69
+sub L179, r2
+
+L94: red r6
+add r7, r6
+L95: jmp L6
+L96: stop
+bne *r0
+dec X20
+stop
+jsr L154
+L97: stop
+inc *r3
+jsr X5
+red *r0
+not L168
+not L35
+bne X11
+jmp X16
+not r3
+rts
+L98: .data 823
+L99: .string "ta"
+red r7
+L100: .data -626, -883, 279, 967, -381, 57, -658
+mov L36, r6
+bne L242
+clr L56
+L101: stop
+mov X20, L55
+mov r2, r2
+jsr X8
+clr X17
+cmp L89, X7
+stop
+prn r2
+rts
+red r0
+
+L102: prn L2
+jsr L40
+L103: mov *r6, L7
+sub #75, *r7
+dec L153
+dec X9
+cmp *r7, r1
+cmp r7, L184
+clr *r3
+bne *r3
+bne L84
+L104: .string "ewsxpsfqsxfuidnphjs"
+prn *r6
+dec r3
+jsr *r5
+stop
+L105: .data -430, -421, 205, -952, -862, -119, -446, -518
+L106: .string "vlctocijeyh"
+stop
+dec L199
+L107: lea X1, X6
+sub #99, *r2
+lea L95, *r6
+bne *r2
+bne *r5
+sub X18, X0
+rts
+stop
+jmp *r4
+
+L108: prn L85
+; comment
+inc *r7
+sub L247, X17
+prn r6
+add #-177, *r4
+L109: not *r2
+dec r0
+rts
+inc r3
+not *r1
+inc X23
+L110: bne *r4
+rts
+mov r1, *r0
+add *r0, L176
+clr r6
+dec r2
+L111: stop
+clr r3
+clr r4
+lea L201, *r1
+L112: prn r2
+L113: jmp X16
+cmp r4, X19
+inc L213
+red L56
+sub r4, r5
+rts
+inc X10
+stop
+bne X12
+L114: rts
+
+sub r3, X0
+L115: .data -434
+lea L112, L92
+clr X15
+
+sub *r5, r4
+red *r6
+L116: .string "oae"
+jsr *r7
+add *r2, *r5
+bne *r3
+L117: red r5
+dec *r3
+inc *r5
+mov r7, *r6
+jsr X16
+mov L254, *r7
+inc r7
+inc L104
+not r3
+clr r6
+L118: .data -335, 852, 103
+rts
+add #220, *r3
+L119: jmp *r7
+L120: sub #1, r3
+prn *r4
+dec r1
+not *r7
+red X22
+rts
+jsr *r2
+
+jsr *r5
+L121: .string "udjcidgqoktwuzxtq"
+inc r0
+clr *r5
+dec r4
+
+L122: .data 237
+L123: jsr X11
+stop
+mov *r1, X0
+sub #-210, *r7
+stop
+stop
+sub L139, *r1
+bne L61
+cmp #-141, X5
+stop
+lea L5, L39
+not *r3
+mov *r3, L50
+L124: cmp *r6, r6
+sub X9, L80
+lea L16, L166
+add r4, *r5
+add #138, L185
+cmp L209, #79
+L125: .data -29
+jmp *r4
+L126: .string "ajuysgmlunwl"
+red *r7
+L127: .string "oym"
+not X12
+not L48
+inc L2
+L128: jsr L219
+rts
+red r7
+L129: clr r6
+L130: .data -360
+clr *r4
+sub #-150, r4
+L131: not *r0
+L132: .string "ohqjuhygvlotxmpgfxzqdz"
+L133: jsr *r6
+L134: .data -33
+dec r2
+bne L198
+add #25, L9
+L135: dec *r4
+L136: .data 937, -940, -286, -868, 578, -85, 308, 599
+dec X24
+L137: prn r7
+stop
+L138: .string "uvtqwbrqsqjeahjdjxm"
+L139: sub *r1, X13
+L140: sub r3, L3
+L141: lea X16, X21
+stop
+stop
+L142: red r6
+rts
+prn L154
+jmp *r4
+dec *r7
+not r3
+stop
+mov r6, *r3
+bne L177
+mov #36, r7
+cmp X20, r5
+mov L198, L146
+inc *r5
+L143: lea X22, L203
+jmp *r3
+L144: rts
+jsr *r4
+red *r2
+cmp *r6, L101
+L145: dec L138
+lea L20, L64
+clr *r0
+mov *r6, X0
+stop
+not *r2
+not r5
+prn r0
+jmp *r1
+clr L27
+inc X15
+prn X9
+inc L216
+dec X5
+add #-234, r5
+L146: inc L177
+L147: .string "smaemppoamlpoxaq"
+cmp *r2, #-174
+L148: .string "mxhgvwdqwlxjcjdeiy"
+inc X16
+L149: not *r4
+sub *r6, *r2
+stop
+bne L130
+L150: clr X4
+L151: .string "oyxkj"
+stop
+cmp #-51, X13
+inc *r0
+L152: .string "gphevzcqlwlzxnpwojhwa"
+not X11
+mov X16, L10
+L153: stop
+add #-99, *r0
+bne L127
+red X5
+cmp X15, #-147
+
+
+L154: clr r0
+inc *r3
+jmp *r7
+dec L209
+cmp X16, #-189
+L155: bne *r5
+; comment
+cmp #35, *r4
+L156: .data -462, 488, -766, -502
+L157: inc X5
+red r6
+L158: .data -548, -921, 82
+sub L227, r4
+prn *r6
+prn #-235
+stop
+dec r0
+jmp *r2
+clr L134
+prn *r5
+L159: jsr L112
+prn *r2
+inc L49
+dec *r5
+sub *r6, *r1
+not r0
+sub r7, *r7
+L160: not r6
+dec *r1
+mov r0, *r3
+cmp #55, X2
+L161: rts
+L162: .data -446, 279, 420, -748, -950, -185
+jsr *r6
+L163: .string "qjwkktulxhlchhovfbcjswp"
+jmp *r5
+not L205
+rts
+dec *r0
+mov r2, X22
+cmp *r5, #-189
+L164: inc X0
+stop
+L165: jmp *r4
+not X16
+rts
+dec r7
+bne L187
+dec *r2
+L166: mov *r6, L247
+L167: jsr L152
+mov X14, r7
+L168: mov r3, L187
+sub #122, r7
+rts
+clr *r2
+clr X7
+stop
+jmp *r6
+clr L14
+rts
+L169: stop
+stop
+inc r2
+L170: dec r4
+L171: bne *r3
+L172: .string "wbzgndeapzikawtnintwgrn"
+
+L173: .string "mbqnnfc"
+L174: red r2
+inc *r4
+dec L118
+inc *r5
+dec *r4
+clr X1
+red *r0
+jsr *r1
+cmp *r3, r3
+; comment
+mov L250, *r6
+L175: rts
+inc *r1
+clr *r5
+stop
+L176: cmp #-211, r4
+L177: dec *r1
+jsr *r6
+stop
+L178: stop
+dec r4
+bne L107
+lea X14, *r5
+cmp X3, L182
+cmp *r5, *r0
+rts
+; comment
+
+cmp *r5, *r4
+L179: .data 180, -111, -542, 585
+stop
+add *r6, r3
+L180: jsr *r6
+jmp X2
+jmp *r5
+stop
+mov #-169, *r4
+bne *r3
+jsr X8
+mov #-28, r0
+not r4
+
+lea L120, r3
+sub L2, *r7
+cmp *r7, L215
+L181: .data 575, 905, 630, -838, -815
+L182: red L59
+L183: .string "zphnbsralymludecskmqmv"
+lea X20, *r2
+cmp *r3, L91
+jmp L54
+not *r3
+bne *r0
+mov r1, r3
+inc *r2
+
+jmp *r4
+L184: inc r3
+prn X10
+L185: .string "mfrbmgpopewzzqkr"
+inc r6
+stop
+add #-165, X17
+
+inc *r4
+bne *r6
+cmp X4, X16
+L186: .data -532, 399, 275, 209, 683, -488, -142, -315
+lea L177, r6
+mov X2, r4
+L187: not L261
+cmp #-22, r1
+cmp r6, r0
+dec *r6
+L188: rts
+dec *r7
+lea L244, r4
+L189: cmp #-155, *r6
+L190: stop
+red *r6
+clr r5
+jmp *r7
+mov X2, *r6
+L191: .string "krilvbghequx"
+lea L5, *r5
+rts
+jmp *r4
+L192: .string "tvatlgaqf"
+sub X7, r1
+cmp *r0, *r3
+mov r2, *r4
+prn #-173
+L193: not L222
+clr r2
+sub r6, *r7
+jmp *r4
+sub *r3, *r4
+lea X11, r0
+jmp X2
+prn #216
+lea L91, L210
+prn r0
+dec r3
+L194: .data 538, -311, 661, -859, 352, -645
+L195: .data 941, 866, -746, 9, 821, 686, 588
+rts
+L196: not r7
+
+prn *r5
+add *r0, *r2
+L197: clr L35
+dec L247
+clr L228
+inc *r5
+stop
+dec r7
+red L82
+L198: red *r0
+bne *r0
+dec X2
+L199: cmp #50, L144
+L200: not *r4
+dec *r6
+mov *r4, r7
+bne X3
+inc *r1
+dec L128
+L201: .string "dvmcg"
+sub #9, X4
+sub X2, L192
+L202: add r3, X18
+L203: not X1
+stop
+dec *r1
+inc r5
+L204: prn L51
+clr r1
+clr *r4
+clr *r1
+L205: inc L252
+L206: red *r3
+dec *r2
+L207: clr *r7
+L208: cmp r3, r7
+red r0
+stop
+dec L227
+L209: .string "lfnublw"
+L210: clr L130
+L211: add r2, r4
+L212: cmp L68, #133
+rts
+clr L213
+not L251
+jsr X6
+L213: rts
+add *r0, *r5
+L214: stop
+L215: jsr L125
+prn *r2
+L216: .string "navbxnq"
+L217: .data -27, -713, 58, -656, 479
+sub #19, r5
+lea L124, *r4
+prn *r4
+add *r4, *r2
+
+lea L147, *r7
+L218: .string "izccxpcxdk"
+L219: jsr *r1
+L220: red r4
+inc X4
+L221: cmp #56, #-115
+; comment
+L222: red *r2
+jmp *r7
+dec *r2
+prn *r4
+L223: dec *r1
+lea L249, *r3
+
+prn *r3
+clr r2
+rts
+red L224
+stop
+stop
+inc r6
+not r1
+lea X2, X9
+; comment
+L224: .string "e"
+jmp X1
+bne *r7
+L225: bne L110
+
+L226: jmp *r7
+clr r3
+prn r7
+cmp #158, L113
+red *r4
+L227: add *r2, *r7
+clr L161
+mov *r3, X9
+not L51
+L228: .data 808, -366, -671, -859, -310
+clr *r7
+lea X9, r2
+inc L256
+add *r2, *r6
+; comment
+inc X20
+bne *r5
+inc *r1
+prn *r7
+jsr L258
+stop
+L229: .string "jjumywruxberaqltyo"
+cmp L163, L244
+L230: .data 752
+add r5, *r1
+dec *r4
+L231: bne L248
+rts
+sub *r6, *r6
+jsr *r0
+
+add #227, *r6
+sub L79, *r6
+add #-190, r5
+red L237
+
+dec X21
+L232: .data -369, 36, 397, -9, -293, 448, 106
+red X2
+not L237
+mov *r1, r0
+L233: red L234
+L234: sub L249, r3
+L235: not L192
+bne *r3
+bne *r3
+lea L106, X22
+L236: cmp #94, X23
+stop
+lea L239, r0
+L237: add *r1, *r0
+jmp *r0
+clr X20
+cmp r5, r3
+L238: .data 203, 230, 509, -73
+red *r4
+mov L236, L252
+clr L118
+cmp X7, r5
+jmp *r7
+L239: .string "kwhlzvghgjiutj"
+lea X5, X2
+prn r3
+bne X0
+inc X20
+lea L249, *r5
+not *r1
+L240: clr r3
+L241: cmp X17, X20
+L242: .string "gxkvqubmugc"
+red L93
+L243: inc *r0
+jmp *r0
+; comment
+dec *r0
+sub #218, r6
+red *r6
+L244: lea L181, r4
+L245: clr r1
+inc *r5
+inc L144
+L246: jmp L100
+L247: stop
+cmp #87, #59
+lea L250, r2
+lea X3, *r1
+L248: .data 146, -361, -169, -439, 58
+add *r4, X22
+L249: .string "vyjptryvfed"
+lea X0, L129
+L250: .data -961, -290, 72, -799
+cmp X24, #-208
+red L262
+rts
+inc *r6
+rts
+jmp *r3
+add X5, *r4
+L251: sub *r0, *r3
+add X22, r7
+L252: .data 397, -561, 519, 240, -900, -771, -225, -85
+red *r6
+L253: red r2
+jsr L190
+prn X12
+inc L263
+stop
+clr *r0
+L254: prn #-49
+L255: .data 98, 88, 15
+L256: .data -346, 60, 339, -512, 699, 966
+dec X1
+lea L258, r4
+L257: not L2
+sub X24, X19
+L258: jmp *r1
+lea L263, *r3
+rts
+clr *r7
+dec L259
+inc r4
+jmp *r2
+sub r5, *r4
+L259: stop
+L260: .data 327, 366, -514, 667, -792, -777
+jsr L263
+rts
+inc *r1
+clr r0
+L261: jsr L173
+stop
+rts
+mov L263, r6
+add #-116, *r1
+rts
+mov L264, r5
+lea X11, L195
+jsr L175
+dec *r4
+L262: jmp L183
+lea X22, L264
+L263: .string "vehodkdatsrya"
+mov X20, *r6
+L264: clr *r2
+stop
@@ -0,0 +1,1044 @@
+; Generated by genCorpus --seed 14
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+L0: .string "ducuteouhubpwpnfehacyqca"
+L1: .data 197, -751, -784, -934, 484, 337, 466, -354
+L2: .data 705
+jsr *r1
+prn *r3
+jsr *r6
+red *r1
+cmp #-74, r7
+rts
+
+L3: mov #-38, r5
+dec *r0
+stop
+cmp r3, *r7
+stop
+lea X13, *r7
+cmp *r0, #135
+inc *r0
+L4: jsr *r6
+add r7, X6
+add r1, r5
+inc X23
+bne L213
+prn #-145
+
+jmp L268
+L5: jmp *r3
+inc *r4
+; comment
+jsr L3
+stop
+rts
+stop
+dec r6
+add r5, r6
+rts
+dec r3
+not L108
+stop
+L6: .string "b"
+L7: .string "hufrmnovibeodnpgesymi"
+L8: sub *r4, *r5
+L9: jsr L9
+jsr X17
+L10: bne *r6
+lea X21, r4
+L11: jmp *r6
+red L126
+dec r4
+rts
+L12: .data -496, -826, 294, -239, -287, 400, -212, 538
+inc X19
+lea L3, r4
+red r2
+jmp X0
+inc *r6
+dec L6
+
+rts
+prn *r2
+; comment
+bne L91
+rts
+jmp X10
+bne *r2
+not r0
+inc *r0
+red L117
+L13: .data 624, -480, 747, 334, -107, 366, 65, 460
+stop
+
+stop
+
+L14: mov *r0, *r7
+bne X14
+mov r7, r0
+stop
+cmp r6, #-87
+L15: .data -458, 493, 405, 769, 961, 76, 526, -853
+L16: add r1, r0
+clr r0
+bne *r5
+sub X14, r7
+jsr *r6
+cmp r3, L213
+L17: add r3, *r3
+L18: .data -140, -655, 370
+L19: .data -157, 754, 411, -239, -240, -426, 641
+inc *r0
+mov #-186, r5
+clr r5
+dec r6
+L20: .data 600, -372, -850, -594
+lea X23, *r7
+jmp *r2
+jmp *r5
+prn r4
+inc *r2
+rts
+sub *r3, r1
+not L59
+L21: bne *r1
+clr r4
+inc *r4
+lea L12, *r0
+L22: rts
+stop
+dec *r4
+L23: add r2, *r0
+L24: rts
+lea X4, *r5
+mov L15, *r0
+L25: bne L107
+inc L15
+L26: .data 267, -405, 978, 880, 57
+inc *r1
+L27: cmp #-85, *r6
+L28: .string "elwbn"
+jsr L178
+clr X3
+cmp #-159, #-89
+mov L16, *r5
+L29: inc *r7
+clr L1
+; comment
+bne L101
+L30: clr *r7
+; comment
+L31: .string "cvraanmfvlckreh"
+mov *r6, *r6
+L32: not *r3
+L33: cmp X3, r2
+L34: mov #225, *r7
+L35: not *r7
+bne *r1
+rts
+stop
+red X5
+jmp L231
+dec *r7
+prn L39
+bne *r2
+jsr *r6
+jmp X16
+mov #-189, *r3
+jmp L236
+clr L18
+jsr *r7
+L36: clr r2
+L37: .data 427
+stop
+not r1
+bne *r0
+sub r7, L4
+clr r4
+L38: prn L85
+stop
+add r3, L212
+bne X5
+cmp *r4, *r0
+cmp X8, X14
+mov L16, *r4
+
+stop
+L39: red r3
+inc *r3
+L40: jmp *r3
+L41: inc *r0
+L42: inc X12
+dec *r5
+jmp X0
+add *r0, *r6
+clr r0
+L43: red *r7
+stop
+add L100, r7
+prn r1
+L44: .string "jgmozrosuibxvmmngi"
+L45: not r3
+bne X20
+cmp L32, r2
+add #-78, X4
+prn r0
+L46: inc X12
+sub #-134, *r1
+mov *r4, r2
+red r5
+clr r0
+bne *r0
+L47: .data 389, 911, 317, -752, -732, 447, 680, 588
+prn #40
+L48: mov *r7, L35
+rts
+mov #-73, r5
+L49: .data -409, 415, 880, 12, 24
+L50: red L59
+cmp *r3, *r0
+mov L223, X4
+bne X7
+; comment
+L51: stop
+L52: clr r7
+; comment
+jmp *r2
+L53: .data -451, 327, -488, -166, -319, 578, 399, 74
+jsr *r1
+stop
+stop
+L54: .data 21, -107, 341, -813
+L55: not *r4
+mov *r6, X4
+inc r2
+cmp #-24, r7
+L56: lea L170, *r0
+sub L92, L102
+not r2
+jmp X23
+red r6
+jmp *r7
+L57: mov L27, X2
+mov r0, *r4
+jsr L3
+not r1
+add *r3, *r0
+inc *r0
+add *r0, X0
+add #55, r3
+L58: inc L56
+L59: sub r1, *r2
+L60: .string "gjucjiq"
+lea X22, L22
+jmp *r4
+clr *r3
+not L28
+inc L37
+L61: dec L47
+jsr L54
+L62: .string "wo"
+not X4
+add *r2, *r1
+L63: .string "mifsbnrsyxdacqoxh"
+lea X0, *r4
+L64: jmp X21
+stop
+L65: add *r1, r0
+mov #6, X1
+red L224
+; comment
+jmp X0
+L66: .data 479, -115
+clr *r2
+bne X10
+jmp *r4
+jsr *r3
+; comment
+red r7
+inc L228
+L67: dec r5
+stop
+L68: clr r4
+mov *r5, r5
+rts
+add *r1, r3
+L69: red L31
+jsr L33
+rts
+red *r1
+rts
+dec r7
+L70: inc L36
+rts
+prn L191
+jmp X1
+jsr *r1
+sub #-216, *r7
+red *r0
+add *r3, r3
+jsr X7
+; comment
+L71: rts
+L72: rts
+red *r7
+mov *r5, r7
+dec L33
+sub L255, L22
+
+dec L20
+L73: clr *r7
+not *r7
+bne X5
+L74: lea L132, *r0
+stop
+L75: clr L32
+
+lea L75, L200
+rts
+L76: .string "dpusl"
+cmp #29, #238
+stop
+stop
+
+L77: mov *r3, L13
+L78: inc *r3
+L79: rts
+bne *r5
+L80: dec r2
+L81: .data -248
+red *r5
+L82: .data 162, 91
+red r1
+prn L207
+jsr *r6
+
+not *r3
+L83: .string "uhwvcxodyfeu"
+inc L106
+L84: jmp *r5
+cmp *r3, r7
+stop
+inc L63
+L85: .data -216, 161, -747, -889, -467, 763, -802
+rts
+L86: mov *r2, L129
+L87: .string "vbuviyrwbyauufvzw"
+stop
+not *r0
+inc X13
+jsr *r3
+L88: mov #-82, L87
+prn #216
+L89: .string "vvwrfpxgosriteimeknvpwl"
+stop
+bne X19
+mov *r2, *r7
+L90: rts
+dec r4
+L91: .string "wflajwztvdgnvr"
+L92: cmp *r2, #-186
+lea L56, r7
+mov *r0, r6
+L93: .data 622, -130, -372, 966, -252, -325, -959, 516
+inc r1
+not L150
+mov *r7, r5
+L94: .data 565, -857, -832, 33, -619, -162, -108
+mov L7, r2
+not L31
+lea X13, *r5
+rts
+add L218, *r3
+not r7
+rts
+lea L247, r1
+
+L95: .data -121, -996
+cmp X0, *r6
+not *r6
+jsr X10
+bne *r7
+inc L72
+L96: bne *r7
+L97: .string "cbvaytt"
+L98: lea L55, r2
+jmp *r7
+rts
+red r5
+L99: cmp *r1, r3
+not L35
+add L7, r3
+not X19
+cmp *r5, #-179
+not *r6
+L100: .string "zknlkbekuvvt"
+lea L28, r6
+L101: dec r3
+L102: red r0
+dec *r4
+rts
+dec r2
+lea X5, r7
+jmp L1
+inc X24
+add r6, r7
+jsr *r1
+L103: .data -417, 783
+prn *r4
+L104: prn r4
+red r5
+L105: .data 269, 105, -691
+not r1
+L106: jmp X12
+L107: stop
+inc r3
+cmp r3, *r6
+prn X13
+inc L243
+L108: red L135
+L109: lea L70, L261
+not r1
+L110: jsr *r5
+jmp L188
+dec L262
+stop
+bne *r2
+rts
+dec *r7
+not r5
+not *r6
+L111: bne *r7
+L112: stop
+L113: dec r7
+L114: mov r1, L87
+inc *r7
+
+red r1
+rts
+dec X20
+dec *r2
+jmp *r5
+L115: rts
+prn *r5
+
+jsr *r2
+L116: prn #185
+dec *r5
+clr r4
+sub r0, r7
+sub r5, *r4
+inc r7
+jmp *r2
+red r7
+red *r1
+L117: lea L22, X13
+mov r1, r0
+sub X16, r5
+lea L141, X4
+L118: jsr *r6
+add r3, L138
+prn X22
+rts
+lea L23, r3
+not *r5
+L119: .data 800, 821, 730, -908, 49, 784, 554, -290
+L120: prn X17
+clr r6
+inc *r5
+lea X7, r6
+not *r6
+L121: jsr *r4
+sub #110, *r0
+jmp *r0
+lea L72, *r0
+red r1
+cmp L149, #209
+jmp *r1
+jsr *r2
+dec L49
+red *r7
+red *r7
+inc L145
+add L165, X6
+L122: .data 939, 568, 290, -965
+not r3
+cmp r7, #198
+bne *r3
+
+L123: lea L234, L241
+clr r5
+jmp *r6
+stop
+dec *r1
+stop
+bne L62
+bne L13
+rts
+L124: .string "pnbmb"
+prn #-163
+clr r2
+clr *r2
+sub L233, X10
+mov #53, r0
+L125: .string "naeo"
+jsr *r6
+L126: jmp X12
+red r0
+mov #-233, r6
+lea X17, X0
+rts
+clr r4
+L127: .data -982, 122, 684, -340, -817, 471, -4, 227
+stop
+jmp *r6
+prn L126
+L128: clr *r1
+L129: .string "vzddtnlzmfbirpzazrnn"
+prn #0
+bne L159
+sub *r7, *r3
+lea L90, X7
+red X22
+prn #-203
+prn L87
+; comment
+cmp #113, L29
+stop
+L130: add r7, *r1
+L131: red *r6
+clr L223
+jsr L58
+L132: .data -59, 158, -557, -161
+not *r7
+mov *r7, r4
+jmp L242
+inc r0
+jmp *r2
+mov #255, *r2
+L133: stop
+clr r1
+cmp #-210, *r1
+red r6
+L134: cmp X13, #157
+inc *r4
+L135: .data 748, 683, 12, -541, 311
+rts
+bne *r0
+; comment
+inc X16
+L136: .data 297, -155, 594, -939, -466, 794
+prn *r1
+rts
+mov r2, r5
+prn *r0
+stop
+sub L50, L182
+L137: .string "db"
+jsr X14
+cmp r1, #194
+L138: sub #-155, *r7
+prn L175
+jsr X1
+not *r3
+L139: dec X2
+
+jsr L110
+L140: prn *r5
+L141: not *r1
+bne L208
+dec r6
+jmp *r0
+inc *r2
+jmp *r3
+
+dec *r5
+not r5
+L142: lea X23, L150
+bne L255
+lea L198, *r5
+red r3
+L143: .string "gjfdkfxuckyiarbx"
+add L248, *r5
+; comment
+lea L59, L8
+cmp L116, r1
+dec L234
+lea L196, r3
+sub X10, r7
+L144: mov X20, *r0
+not *r3
+jsr L174
+clr *r7
+L145: not r4
+jsr *r6
+stop
+jmp X23
+rts
+L146: .data 896
+
+rts
+L147: red *r2
+mov L225, *r1
+clr r0
+L148: jsr L21
+L149: stop
+rts
+red L91
+L150: add #-193, r7
+L151: .string "ckyofgzsrchtobkmw"
+L152: prn r7
+prn #208
+clr L44
+stop
+dec *r6
+L153: red *r0
+L154: bne L241
+bne *r6
+L155: clr X22
+; comment
+L156: mov *r1, X19
+not *r3
+red L190
+prn #-96
+clr r0
+L157: add *r1, L179
+prn #21
+inc *r4
+jsr X4
+clr L111
+stop
+rts
+sub *r2, *r7
+jmp *r5
+lea L51, *r5
+red r7
+L158: mov *r0, X14
+L159: cmp *r4, #-166
+sub #-75, L3
+L160: .string "gpyluhyyzjnx"
+sub *r1, *r2
+L161: red X6
+rts
+prn *r1
+; comment
+L162: rts
+L163: .data -455, -673, -627, 916, -435, 457, 979
+jmp *r4
+L164: .string "fikpwyikqpsqzz"
+L165: cmp r5, #64
+prn #178
+L166: .data 354, -513
+bne *r5
+L167: red *r0
+rts
+add #-166, X6
+inc *r4
+L168: sub r7, L157
+L169: add L241, r5
+L170: add #-238, *r4
+L171: lea X2, *r5
+mov *r7, r3
+L172: .string "ogbcosqfhwsrzw"
+
+L173: cmp X10, #84
+; comment
+sub X2, *r7
+jsr L147
+prn #225
+add L219, r2
+L174: stop
+stop
+
+jsr L43
+L175: .data -140, 116, -854, 524, 953, -532, 456, 973
+L176: cmp #-163, r4
+lea X0, r4
+L177: .string "bjrtwkkrhpreikipamvepn"
+jsr L207
+mov *r1, r2
+prn *r7
+L178: stop
+dec r2
+bne *r6
+L179: .data 478, -370, 436, -902, 561, 690, -438
+rts
+L180: sub r3, r7
+cmp X19, r5
+prn #160
+L181: .string "rtdwcrhwbhhchkrkf"
+red *r7
+; comment
+bne *r0
+stop
+rts
+L182: not *r0
+stop
+L183: .string "fqxicwuvhu"
+clr L210
+L184: red L103
+cmp #-5, r3
+L185: mov #-244, L47
+; comment
+cmp #-242, r2
+stop
+add #75, r5
+jsr *r1
+inc *r6
+stop
+cmp #-174, #223
+not r6
+cmp *r2, L198
+L186: mov *r6, X16
+red *r3
+bne X18
+not *r4
+prn #-125
+dec X13
+inc X13
+red X23
+bne *r4
+inc r6
+red L243
+prn X20
+L187: .string "op"
+lea L74, r3
+bne L55
+red r2
+prn *r3
+inc *r6
+L188: not *r6
+not L133
+cmp #-83, *r6
+L189: add r3, r0
+bne L40
+not L193
+bne *r0
+L190: .data -125, 456, 709, -539, -919, -895, 946, 695
+stop
+rts
+jmp *r2
+jsr X8
+L191: .data 496, 519, -678, -472
+rts
+red r0
+L192: .data 652, -180, -275, -719
+clr *r6
+clr r6
+L193: red L201
+dec r2
+jmp *r0
+lea L51, X7
+prn #-104
+L194: jmp *r7
+rts
+L195: .data -480, -599, -990, -240, -352, 543, 320, 781
+jsr L230
+prn X4
+clr *r6
+lea L203, r7
+jsr L221
+rts
+prn *r0
+jmp L247
+L196: bne X14
+L197: jsr X1
+clr X15
+jmp *r6
+not L158
+lea L116, *r4
+dec X17
+cmp r2, L93
+lea X23, *r4
+stop
+stop
+jmp L48
+L198: stop
+add *r0, r7
+sub #-128, X0
+bne *r2
+lea L26, *r5
+L199: sub #105, r3
+L200: mov r1, L36
+clr L25
+jmp L240
+; comment
+clr L239
+L201: bne *r1
+red L251
+mov #-41, *r3
+dec X23
+L202: dec *r0
+jmp *r1
+jmp *r7
+prn L249
+L203: dec r2
+sub #226, r7
+L204: red *r2
+sub L229, r1
+add *r6, *r2
+add #-222, *r4
+L205: cmp L114, *r2
+bne L252
+dec L255
+jmp *r3
+dec L212
+L206: add *r4, r5
+L207: .string "fkggox"
+L208: add *r1, L67
+; comment
+add r3, r5
+add r3, X8
+stop
+L209: prn #232
+L210: .data -407, 458, -104, -269, 954
+jmp L219
+sub #-31, *r7
+jsr *r4
+red *r7
+cmp r4, #169
+bne L220
+; comment
+stop
+cmp #-126, X12
+lea X4, L94
+lea L39, r6
+L211: add #-9, L132
+clr r6
+jmp *r1
+jmp *r7
+stop
+stop
+not *r5
+L212: jmp *r3
+L213: prn #-38
+L214: jmp *r1
+not X19
+mov #-92, L60
+stop
+red *r3
+not r3
+red *r4
+clr *r7
+add X20, *r6
+jsr *r4
+L215: lea L217, *r5
+red *r3
+L216: .data 205, -433, -428, -244, 310, 878, -242, 151
+clr r2
+dec r5
+dec r0
+sub #72, X22
+jmp *r3
+clr X0
+bne L251
+prn *r2
+sub #-103, *r6
+inc r5
+not r6
+L217: .data -705, 230, -575, -942, -49, -344, -898
+L218: clr r4
+rts
+cmp *r4, L225
+lea X8, *r4
+not *r5
+lea L162, *r5
+jsr L255
+sub #249, *r2
+prn L37
+prn r7
+inc *r5
+
+stop
+mov r0, L248
+L219: mov r7, r1
+L220: .string "xhmamx"
+not r1
+L221: mov *r3, L77
+rts
+prn #-200
+add r7, X4
+L222: add #230, *r0
+not *r6
+not X15
+jsr *r3
+L223: not r1
+L224: inc X17
+rts
+L225: lea L263, *r2
+jsr X13
+L226: clr X14
+L227: sub X6, *r6
+inc *r5
+L228: .data 450, 945, -364, 836
+stop
+prn #-49
+L229: stop
+L230: mov #-20, r3
+jmp *r3
+L231: cmp r0, #-222
+L232: add L177, *r0
+inc L212
+dec X13
+dec *r1
+
+lea L252, r3
+add r2, L267
+L233: .string "liifkxs"
+L234: jsr X10
+L235: cmp L247, #119
+L236: lea L160, *r7
+cmp #-225, #14
+add *r5, r4
+inc r3
+dec L99
+mov *r5, r2
+lea X13, L182
+sub *r3, r0
+L237: .string "lu"
+L238: not *r4
+L239: .data -966, -508, 842, -560, 160, -543, 587, 79
+inc r4
+prn #-161
+rts
+cmp *r3, r1
+inc L146
+L240: .data 46, -470
+bne X12
+clr L198
+cmp *r4, r4
+lea L254, r3
+sub r2, r6
+add r0, L175
+bne X19
+sub r1, *r4
+red *r5
+add #-256, X10
+L241: jmp L264
+L242: rts
+L243: add *r7, *r3
+inc r6
+jmp *r0
+L244: not r2
+L245: .data -223, -519, -264, 91, -902, -552
+sub *r5, r5
+red r3
+mov r3, X14
+stop
+L246: lea X19, r5
+add #-97, r4
+lea X0, *r6
+L247: .string "otzyxwau"
+inc *r4
+L248: .data 476, 679, 831, -331, -99, -300, -910, -398
+red r5
+lea L257, L19
+; comment
+dec *r5
+L249: .data -499, 177, 837, -607, 126, -828, -575, -926
+clr r3
+L250: add X23, *r3
+lea X0, L253
+L251: lea X21, r2
+dec r4
+red r7
+dec L262
+L252: .data 568
+L253: cmp X6, r2
+jsr *r3
+lea L255, r6
+jmp X22
+lea L254, L261
+prn #-11
+add r6, *r3
+L254: sub *r4, r4
+cmp *r6, *r2
+L255: bne *r6
+cmp L256, #-50
+jmp *r0
+L256: prn #242
+mov r6, r4
+rts
+lea L259, *r3
+add #-137, r6
+clr r6
+inc *r0
+L257: .string "qhjzzwxbjhumkjivryses"
+L258: bne *r7
+prn L74
+L259: dec r7
+L260: jmp *r5
+; comment
+L261: sub #28, *r1
+L262: stop
+rts
+not L266
+not r6
+mov *r7, L132
+jsr *r3
+L263: rts
+cmp r3, *r3
+dec r6
+L264: .data 361, -519, 771
+add #29, *r2
+mov *r4, r6
+mov L265, L45
+; comment
+sub *r2, *r4
+cmp *r5, r7
+dec *r4
+prn *r0
+add *r1, r3
+red r1
+mov #118, *r7
+prn L268
+L265: inc X24
+L266: jmp *r7
+L267: .string "ezcucoaonoutbubtl"
+add *r4, *r1
+L268: rts
+L269: jsr L226
+red L178
+cmp *r6, *r5
+stop
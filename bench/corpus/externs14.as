@@ -0,0 +1,1044 @@
+; Generated by genCorpus --seed 15
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+jmp *r4
+add r0, *r7
+clr r0
+bne L53
+L0: clr L25
+stop
+mov X24, r5
+prn r6
+L1: add #-151, *r3
+mov r6, r4
+mov #76, *r6
+L2: red r2
+L3: not L2
+L4: .data -227, -385, -746, -701, -583, 121, -771
+not r3
+not *r4
+
+L5: cmp L46, *r1
+prn r2
+prn #46
+lea L166, r7
+L6: .string "ippnrenag"
+L7: .string "vhyyynvkafxsktpycid"
+rts
+red *r0
+L8: bne L8
+bne *r4
+L9: red *r6
+jsr *r1
+red L166
+red L0
+prn r1
+L10: .data -949, 791, 161, -844, 312
+jsr *r0
+inc r3
+inc L4
+sub #-27, X17
+clr r3
+L11: .string "lihpcfjjvf"
+lea X12, L51
+cmp #118, r0
+L12: .string "gum"
+L13: sub X1, r4
+jmp X1
+rts
+rts
+rts
+red r6
+dec L4
+dec *r5
+dec X6
+stop
+L14: dec r2
+; comment
+L15: cmp r5, X0
+cmp *r1, L15
+stop
+L16: lea X9, *r5
+; comment
+dec L249
+bne X4
+; comment
+not *r5
+jsr *r1
+L17: lea L145, L152
+jsr *r5
+prn #-140
+stop
+cmp L9, *r6
+L18: prn *r7
+mov r2, *r1
+L19: mov r0, *r5
+L20: stop
+lea L2, L0
+L21: red L65
+not L150
+not *r6
+jmp *r7
+add r2, L52
+dec r5
+not r0
+L22: .string "xynqwnl"
+mov r7, *r6
+L23: stop
+L24: .string "ryywjnbrhfxpeqmvtszdxoxn"
+jsr X0
+inc L12
+L25: rts
+L26: jmp X18
+not L198
+inc r1
+L27: .string "geks"
+; comment
+stop
+inc r3
+not X8
+lea L75, X5
+dec *r7
+rts
+L28: bne *r4
+L29: red *r1
+lea X5, X0
+prn r5
+rts
+red *r2
+jsr L15
+add X22, r6
+clr *r4
+jsr L9
+rts
+dec X15
+prn L188
+L30: not L42
+add L71, r7
+L31: jmp L55
+jmp L135
+
+bne X3
+L32: .data -823, -98
+; comment
+sub *r4, L125
+L33: .string "skconfmwcmhgqquykbecjbpb"
+lea L18, L33
+rts
+stop
+
+clr r4
+jmp *r6
+stop
+lea L199, *r2
+L34: red *r2
+sub #-237, *r1
+add *r4, *r1
+L35: .string "krllgzzaljsm"
+L36: .data -418, -613, 862, 8, 376, -208
+mov *r2, X0
+clr r5
+mov *r2, r4
+clr r7
+prn r4
+L37: .string "spigirgmwqhev"
+L38: dec r6
+mov #142, r2
+jsr X17
+jsr *r4
+prn *r0
+L39: stop
+L40: stop
+prn L5
+red r2
+lea X6, r2
+inc *r0
+jsr L5
+not *r1
+clr *r1
+mov #-234, *r3
+
+cmp *r1, #192
+L41: prn r2
+lea L241, *r4
+cmp X5, *r5
+lea L167, L39
+L42: .string "gibxhqxmxjta"
+inc L22
+L43: .data 28, -78, 137, -48, -635, -717, -824, -872
+rts
+prn L67
+cmp *r2, L87
+red X23
+inc r0
+jsr *r0
+L44: .data 953, 884, -359, -487, -158
+not L189
+dec L48
+prn #-102
+mov *r5, r3
+jmp *r4
+jsr *r2
+rts
+clr *r3
+
+L45: inc L38
+mov r1, r3
+jsr *r3
+inc r2
+jmp L27
+bne *r7
+cmp r4, *r1
+dec *r7
+L46: .string "dnsbkfwffzfepk"
+inc *r0
+prn #-167
+rts
+clr r6
+not r3
+stop
+L47: dec r0
+L48: .data -413, 993, -146, 647, 560, -828
+
+mov r2, L184
+red r3
+L49: add *r3, X4
+dec *r7
+red *r5
+L50: .string "khmuajiij"
+L51: .string "bprzfjrxprqqtkontqcfb"
+rts
+lea X14, L118
+bne *r2
+mov #26, L36
+clr r0
+jmp *r2
+jsr X11
+L52: not X24
+add *r1, X14
+dec *r2
+jmp X15
+jsr L35
+L53: add r5, X11
+L54: rts
+cmp r0, r7
+L55: jsr L29
+not r4
+red L87
+rts
+L56: .string "ahagpuhrtzuwvoefidufjoyy"
+L57: .string "gdu"
+L58: add r1, L28
+red r0
+L59: jsr *r1
+cmp *r7, r0
+prn *r1
+L60: jmp X20
+jsr *r6
+dec L53
+L61: sub #21, r2
+cmp *r0, #139
+not X20
+L62: clr *r2
+rts
+add L47, L53
+red r4
+rts
+sub #6, r6
+prn L15
+red *r2
+; comment
+rts
+jsr *r5
+L63: inc r6
+red r1
+jmp *r7
+cmp r3, r1
+jmp L24
+dec r2
+cmp *r1, *r4
+stop
+stop
+prn *r7
+mov r7, *r0
+cmp #50, X15
+sub #201, r0
+not r7
+L64: red r4
+cmp #-31, *r6
+add #59, *r2
+L65: add L50, r5
+inc r6
+L66: stop
+L67: .data 652, -985, 443, 423, -323, 920, -999
+add X6, r6
+; comment
+L68: .data -693
+lea X16, X15
+L69: sub r5, r4
+lea L5, L254
+L70: jsr *r4
+mov r3, X6
+L71: red r2
+lea L30, *r7
+rts
+red L238
+not r7
+prn r4
+L72: prn *r4
+cmp #2, X11
+stop
+dec *r4
+L73: clr L60
+cmp #48, L119
+mov X21, L30
+L74: cmp L64, *r5
+cmp *r2, r5
+lea X15, *r2
+L75: .string "x"
+inc X8
+add *r0, r1
+L76: stop
+bne L31
+; comment
+L77: rts
+L78: jsr L206
+L79: not L11
+dec *r1
+prn *r5
+sub #-170, r4
+lea L135, r3
+cmp *r1, L109
+jmp *r6
+clr r7
+
+L80: mov #-221, *r2
+L81: lea X21, L14
+jmp *r7
+cmp #81, #99
+L82: jmp *r4
+dec L91
+L83: red r5
+sub *r6, L220
+cmp L76, r7
+cmp L140, *r2
+L84: red *r5
+red r0
+sub #-122, r0
+jsr *r7
+dec *r6
+bne L112
+L85: red X10
+L86: stop
+mov #-149, L225
+L87: .string "wbkovvnsbrecl"
+rts
+
+red *r6
+jmp X23
+L88: .data 242, 240, -307, 692, 86, 503
+bne *r5
+jsr L30
+clr r3
+; comment
+dec *r4
+L89: .string "thohaexovathbmhq"
+red *r1
+jmp *r7
+L90: mov L215, *r1
+L91: jsr *r7
+L92: inc *r1
+L93: .data -400
+L94: inc r7
+prn L147
+sub #-198, r4
+L95: rts
+add r7, *r4
+L96: rts
+prn X14
+L97: dec *r7
+inc L226
+jmp *r2
+L98: mov #-72, r7
+jsr *r0
+prn r1
+L99: red *r6
+jmp L37
+sub #21, X15
+L100: mov r0, r0
+
+not L43
+L101: not r7
+jmp L202
+sub *r5, *r2
+jmp L202
+L102: rts
+L103: jmp X11
+inc L16
+not *r5
+sub L116, r0
+red *r4
+L104: .data 399, 475, -567, 469, -652, -706, 642
+jsr *r2
+inc L129
+clr *r7
+red L134
+L105: .string "ysyldmpfekuhrvpuqm"
+cmp X3, r3
+jmp *r5
+red L121
+rts
+L106: .data 360, 226, -402
+L107: red X4
+mov L93, r0
+rts
+add *r7, r2
+inc *r0
+L108: .data 803, -282, -934, 936
+cmp L25, #133
+L109: mov #40, X24
+inc r5
+not r7
+bne X2
+bne L108
+stop
+L110: prn X0
+jmp L107
+jmp L251
+dec *r4
+prn #-197
+L111: mov #141, X11
+lea X15, L14
+red r4
+L112: add *r3, L50
+L113: clr r3
+red *r3
+rts
+L114: prn r7
+mov L149, r0
+rts
+L115: stop
+bne X20
+cmp #-224, #-11
+not X0
+L116: .data 529, -748, 982, 68
+add r0, r0
+bne *r4
+add L147, *r3
+red L61
+L117: stop
+cmp r7, r0
+L118: rts
+L119: .string "wxszzwsrickkdiv"
+dec X9
+mov *r4, r2
+not L228
+add *r2, *r0
+L120: .data 734, -99, -75
+L121: jmp *r4
+bne *r1
+dec r7
+; comment
+L122: bne *r1
+; comment
+clr X11
+jsr L23
+stop
+L123: clr L120
+inc *r4
+mov *r5, L104
+stop
+L124: .string "iolgxrljb"
+
+inc X1
+clr *r5
+sub #-1, X5
+add r0, *r6
+not L168
+sub #50, r7
+inc r2
+inc L126
+L125: .string "jaapbcslesprjhizgdgishrm"
+stop
+red X14
+add #-247, L106
+L126: cmp X17, r2
+red X22
+L127: lea L16, X17
+sub L178, L31
+dec L212
+jsr *r0
+dec *r4
+not *r1
+mov r4, *r4
+L128: .data 261, 984, -201, 637, -283, -853, -686, -865
+add *r6, *r3
+red L59
+not L92
+not L248
+lea L205, X6
+red X9
+L129: jsr L164
+lea X12, X9
+add #-177, X18
+sub #119, r5
+add *r4, *r0
+inc *r5
+stop
+not r0
+rts
+jsr X21
+inc *r4
+cmp X20, X8
+mov L110, X17
+dec L235
+jmp L155
+L130: dec X22
+lea L229, r7
+L131: .data -582, 740, -278
+L132: not r3
+L133: rts
+stop
+jmp *r7
+clr L5
+sub X9, *r6
+red *r7
+lea L233, *r5
+L134: inc L260
+cmp r7, #37
+L135: cmp #134, X23
+not X2
+cmp r7, X12
+sub r5, *r0
+L136: red r0
+prn *r1
+clr *r4
+L137: sub *r1, L70
+rts
+sub *r6, X24
+cmp *r2, r6
+jsr L146
+red L193
+prn *r7
+lea L148, r3
+L138: .data -482, -871
+L139: .data -221
+L140: stop
+jsr *r3
+sub L187, X16
+jmp *r2
+L141: not *r7
+lea X20, *r6
+red *r1
+bne *r1
+bne *r2
+not *r2
+add *r6, X17
+sub #226, r0
+L142: .data -523, 427, -851, -780
+bne *r7
+L143: red *r5
+L144: red X10
+cmp X16, L167
+red r5
+dec L217
+L145: dec L33
+L146: prn r2
+bne *r7
+sub #215, L240
+inc *r0
+cmp r5, L50
+dec L66
+lea L167, X20
+L147: .data -34, -739, 613
+L148: inc X0
+cmp L194, *r2
+clr L250
+L149: prn L76
+add r4, L109
+clr *r0
+L150: .data -127, 512, 316
+cmp X16, #-100
+add X11, *r2
+jsr *r1
+not *r5
+cmp #45, *r0
+L151: dec L114
+dec *r2
+sub r2, X10
+L152: prn *r7
+jsr L109
+add L92, r2
+L153: sub *r1, *r6
+red X15
+not *r0
+red X5
+not r3
+clr r4
+bne L65
+sub *r1, X19
+bne *r1
+jsr X10
+L154: red *r0
+cmp r3, r2
+add L214, r2
+red *r2
+; comment
+L155: stop
+L156: .data -624, -470
+L157: .string "bqzdxqgodbixogsinx"
+mov #77, *r2
+mov #19, *r4
+lea X7, X18
+jsr *r3
+red *r5
+stop
+sub #-226, *r0
+bne L173
+dec r3
+lea X21, L79
+mov #-25, *r7
+jmp *r0
+dec *r4
+clr L121
+clr *r6
+L158: add r6, X11
+rts
+inc *r7
+; comment
+L159: .string "jzhobhamefgvappqjgt"
+sub #135, X22
+L160: .data -121, -359, 737, -551, 614, 760, 810
+inc *r1
+rts
+red L55
+; comment
+cmp L108, r7
+clr L228
+red L233
+lea L159, *r5
+L161: lea L84, r0
+mov X22, L53
+mov #-21, *r0
+
+red *r1
+dec *r4
+L162: sub L220, r1
+prn r3
+prn #-146
+sub X24, r6
+L163: dec r4
+clr L44
+not L128
+L164: cmp L234, L164
+; comment
+clr r3
+cmp r1, r6
+L165: .string "tcfvry"
+L166: .string "fhm"
+cmp r6, *r4
+add *r0, *r1
+L167: lea L122, *r0
+red *r0
+dec X10
+rts
+L168: bne X3
+jmp *r6
+cmp #-110, #63
+rts
+clr r0
+L169: red *r1
+L170: .data -912
+clr X15
+rts
+jsr X20
+mov L70, r2
+rts
+jsr *r6
+L171: .data 94, 921
+L172: .string "rkwxdfqndsyqnssct"
+rts
+L173: stop
+stop
+red *r4
+not *r1
+jsr L37
+lea L66, *r7
+bne L191
+L174: stop
+L175: prn L258
+prn r4
+L176: .data 167, -140, -837, -447, -343
+lea L252, *r0
+L177: jsr *r0
+inc *r5
+inc *r3
+; comment
+jmp *r4
+; comment
+L178: .data 146
+L179: not L181
+L180: jmp *r1
+cmp #55, #-252
+dec r0
+add X11, L16
+add *r1, X14
+jsr L10
+; comment
+rts
+clr *r2
+L181: .data -535, -903, 679, 511, -956, -294
+mov *r7, *r6
+add r3, L235
+stop
+jmp X2
+rts
+clr L128
+prn r2
+jsr *r0
+red *r0
+L182: prn r2
+L183: bne *r2
+stop
+not *r2
+rts
+mov #-17, X17
+L184: stop
+rts
+dec *r4
+not r0
+inc X21
+; comment
+cmp #51, #225
+L185: jsr L228
+prn #165
+sub #-246, L245
+jsr *r0
+L186: cmp #142, #43
+add *r7, L218
+sub #129, X6
+sub L187, *r4
+L187: inc *r7
+mov r0, r0
+; comment
+lea L113, r0
+add *r3, r5
+sub L95, *r5
+jsr *r3
+L188: .data 864, -874, -320, -667, 349, -185, 266
+L189: bne X14
+add #6, *r7
+rts
+clr r0
+L190: bne L38
+cmp #165, r2
+cmp #-181, #-247
+add #223, *r4
+bne L55
+L191: .string "bc"
+L192: not r6
+lea L248, *r4
+sub X17, r1
+rts
+L193: stop
+sub r7, r7
+bne X24
+not L221
+dec L96
+mov #133, *r3
+L194: .string "arrdxylvktxunbgftwkfi"
+stop
+L195: inc L218
+jmp *r0
+dec r7
+rts
+mov *r6, L202
+mov r3, *r5
+add r1, r6
+inc r0
+clr r0
+add X8, r6
+L196: inc *r3
+cmp #153, L238
+L197: .data 744, -521
+bne L256
+L198: .string "qdqvqfhhkvgmuwvagxehhb"
+L199: .data 483
+cmp r4, #-151
+; comment
+lea L201, r3
+L200: .string "tnrryatk"
+L201: .data 331, -544, -185, 458, 446
+inc *r2
+lea L219, L72
+
+add #177, L188
+red r2
+sub r0, *r2
+clr *r3
+rts
+jsr *r1
+L202: not *r0
+jmp *r2
+clr X1
+clr r1
+add L163, *r6
+inc *r6
+inc r4
+L203: .string "pn"
+L204: .data 687, 339, -702, 356, 914
+L205: rts
+red r2
+L206: sub *r4, X14
+jsr L242
+clr L190
+inc L55
+add X4, r4
+; comment
+add r3, *r0
+prn r5
+red r6
+L207: rts
+L208: rts
+L209: jsr *r4
+L210: sub L249, r7
+clr X0
+jmp X13
+L211: stop
+clr X20
+jmp X1
+lea X0, r1
+L212: bne L222
+mov L102, *r4
+L213: prn r6
+dec *r6
+L214: jsr *r1
+; comment
+stop
+not *r7
+prn *r1
+L215: rts
+lea L252, *r0
+inc *r4
+add #175, X16
+L216: not *r7
+clr L10
+lea L246, *r6
+rts
+L217: cmp #229, r1
+bne L238
+L218: jsr L40
+sub *r3, *r6
+L219: clr r7
+lea X11, *r4
+add L242, *r2
+jsr *r0
+jsr L136
+sub r0, r6
+lea X2, r7
+L220: not *r2
+prn r2
+L221: prn #-225
+rts
+stop
+L222: .data -669, -280
+lea L228, r3
+clr r6
+jsr *r5
+red L5
+sub L12, r4
+mov *r4, r1
+not L235
+L223: sub *r3, r2
+sub L244, X13
+L224: .string "ntabpi"
+bne L211
+add #-217, r4
+stop
+L225: not *r6
+clr L245
+; comment
+lea X21, X2
+jmp *r0
+not *r3
+mov r0, L109
+sub #-193, *r2
+L226: stop
+rts
+lea L228, r3
+prn r4
+L227: .data -488
+dec *r6
+jmp *r2
+not X20
+jmp *r6
+L228: dec L35
+stop
+sub r7, L143
+L229: .data 194, 710, -568, 771, -673
+mov r0, *r2
+cmp r3, #51
+jsr X18
+dec L251
+L230: jmp L246
+not r7
+red r0
+mov *r2, r4
+red X23
+mov #111, *r3
+bne *r3
+add X4, r6
+jsr X2
+inc X3
+sub #-174, *r5
+not X7
+L231: lea X21, r7
+L232: red L256
+cmp #9, X24
+L233: add *r5, r6
+L234: .data 690, -401
+dec *r7
+L235: .string "caphfrly"
+L236: .data 16
+L237: clr *r4
+lea L244, *r5
+L238: not *r4
+inc *r5
+
+stop
+red r3
+L239: jmp *r1
+not X23
+
+red X14
+mov *r7, r2
+inc L244
+inc r2
+not *r6
+sub X14, r3
+rts
+L240: add X15, *r6
+L241: jsr *r1
+L242: .string "ntdgxvdsiwxtobxenyqt"
+bne *r5
+add X11, L102
+
+L243: jsr X12
+red *r2
+not r6
+jsr X22
+L244: .string "ddzowkruwquaithhaztn"
+L245: dec L3
+lea X21, L252
+jmp L114
+sub #-72, L251
+L246: lea L132, *r6
+inc r1
+lea L254, r6
+inc *r5
+dec *r1
+not r2
+rts
+not r1
+bne *r0
+; comment
+sub X19, L257
+prn r4
+clr X18
+bne *r3
+L247: cmp #-72, r2
+prn X15
+rts
+L248: bne *r5
+L249: clr L260
+dec X23
+mov r7, *r3
+inc *r7
+; comment
+stop
+bne *r0
+not r5
+jsr X19
+inc L254
+L250: jmp X5
+mov *r6, r5
+sub r5, L257
+red *r6
+jmp *r5
+L251: sub r0, r2
+; comment
+
+rts
+inc X13
+add r3, L259
+L252: .data -19, -12, -376
+jmp *r5
+L253: .data -684, -844, 680, 627, -105
+L254: .data -583, -937, -396, 231
+L255: red X19
+L256: .data 99, 460, -855, -860
+L257: .string "xspbylfftrshnp"
+dec r7
+sub #-70, *r4
+prn *r5
+; comment
+bne X12
+red *r5
+cmp #128, *r6
+rts
+sub r4, r1
+inc r1
+rts
+L258: .data -840, -508, -671, 10
+prn r1
+; comment
+jsr L161
+jsr L260
+mov r2, X2
+L259: jmp *r1
+jmp *r7
+inc *r4
+rts
+L260: jmp L53
+dec *r6
+stop
@@ -0,0 +1,1044 @@
+; Generated by genCorpus --seed 16
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+L0: sub #29, *r0
+prn #-33
+red X10
+add #-178, X23
+L1: sub #-204, L0
+inc L1
+prn L210
+mov r0, X22
+mov L0, L253
+jsr L37
+lea L1, r3
+not r3
+L2: not L204
+L3: bne *r3
+sub L0, r3
+dec L241
+bne *r7
+bne *r1
+stop
+L4: .data -530, -33
+clr L207
+L5: .data 852, -844, 946, -544, -130, -659
+red r1
+rts
+L6: .string "av"
+bne X0
+inc r7
+dec *r5
+red L28
+dec X11
+sub #104, L3
+L7: stop
+L8: rts
+lea X11, X9
+cmp L19, #63
+jsr L158
+L9: mov *r5, r1
+; comment
+L10: .data -223, -385, 653
+jsr X20
+cmp r2, r1
+rts
+rts
+stop
+add r6, L229
+bne *r3
+rts
+L11: dec X18
+jmp *r7
+L12: cmp r7, r5
+lea L5, X6
+clr *r4
+stop
+L13: cmp #160, *r2
+rts
+not r1
+clr r1
+L14: rts
+dec r4
+jsr *r5
+mov *r4, *r7
+cmp L232, #-100
+prn r0
+
+L15: not *r1
+red L77
+L16: add *r6, L16
+L17: jsr X8
+L18: inc L118
+L19: bne L16
+clr *r0
+rts
+
+rts
+mov #-241, *r1
+L20: inc r3
+prn #128
+prn *r2
+stop
+L21: not *r4
+prn #47
+bne *r7
+red L2
+L22: bne *r2
+red X24
+sub #-137, r6
+inc *r3
+lea L96, r7
+clr *r2
+L23: .string "ggackywwvcilhtkhnivasnr"
+jmp L181
+L24: cmp r5, #173
+sub *r1, r4
+not *r3
+red r4
+prn r2
+inc X10
+L25: sub r3, r3
+
+mov *r5, r2
+lea X23, r4
+prn X22
+L26: cmp X13, L22
+jsr X4
+; comment
+add L82, *r7
+L27: .data 484, 659, -75, -180, -178, 579, 837, -840
+red *r3
+red X12
+mov #-124, *r1
+prn X20
+sub *r3, L54
+L28: not L89
+L29: .data -535, 794, 498, 245, -261, -255, 51, 706
+prn L19
+rts
+L30: rts
+bne *r4
+stop
+rts
+mov *r3, *r0
+stop
+L31: clr *r4
+inc *r6
+lea L179, r6
+jmp X14
+lea X23, r5
+cmp L133, r4
+inc L95
+add L114, *r2
+add #13, *r1
+mov L52, *r1
+prn L74
+not *r7
+mov L23, r1
+L32: lea L255, *r4
+jmp *r7
+dec r6
+L33: .data -474, -593, -797, 183, -561
+mov *r6, *r7
+stop
+L34: cmp r4, *r6
+red L6
+mov r2, r5
+clr r0
+L35: .string "o"
+L36: lea X19, r6
+jsr L31
+mov r6, *r0
+mov #175, *r6
+jmp L32
+lea L201, X17
+L37: mov #-62, *r6
+bne L51
+stop
+jsr L37
+clr L1
+dec L185
+L38: .string "tgshfiwh"
+red r5
+inc L248
+cmp *r0, *r5
+rts
+L39: rts
+L40: dec r5
+dec r6
+add X9, r0
+red *r3
+not L94
+inc r4
+not L5
+L41: stop
+L42: .string "zhjpels"
+bne X13
+red *r1
+lea X15, r4
+
+stop
+clr *r2
+L43: clr *r2
+not *r6
+prn *r1
+bne L32
+; comment
+jsr L2
+L44: .data 175, -9, -245, 673
+L45: jmp *r0
+cmp #-216, *r0
+bne *r2
+inc L18
+lea L21, L187
+bne *r1
+prn r2
+inc r4
+rts
+rts
+clr r6
+add L161, *r3
+cmp X16, #53
+clr *r5
+jmp *r5
+clr *r2
+jmp *r2
+cmp r5, *r3
+not X19
+bne L15
+L46: .data -371, 69, 666
+not X18
+rts
+not *r5
+prn *r0
+bne X22
+L47: .data -92, -137, -249, -421, -879
+red L19
+bne *r0
+dec r0
+rts
+L48: stop
+bne *r6
+clr *r1
+dec r3
+L49: red r5
+bne *r6
+inc r5
+lea L88, *r1
+dec r3
+rts
+dec *r6
+L50: mov *r4, X15
+inc *r3
+L51: mov *r2, r3
+; comment
+prn #-248
+not X5
+L52: bne *r5
+prn r3
+sub *r1, r0
+prn r2
+red r3
+not *r2
+L53: cmp X1, X0
+dec L90
+lea L91, r1
+dec X14
+L54: cmp r6, *r6
+add #-244, X23
+jmp L117
+inc r5
+bne L27
+L55: prn L84
+L56: .data -599, -31, -64, 175
+red *r1
+rts
+prn X21
+not *r7
+rts
+lea X17, r2
+bne X11
+mov #167, r1
+inc L18
+clr *r4
+jmp *r2
+rts
+lea L172, r6
+jsr *r1
+bne X3
+L57: dec *r4
+jmp *r7
+L58: .data 868, -785, 205, 147, 393, 286, -632, -548
+L59: dec *r0
+rts
+L60: lea L117, *r3
+red r7
+red *r1
+L61: clr *r7
+stop
+rts
+bne *r2
+
+L62: add r2, *r4
+L63: red *r7
+red *r3
+dec r5
+; comment
+L64: clr r5
+L65: .string "fhfuxwxprszzamxzotosema"
+not r1
+L66: inc r4
+dec r7
+L67: cmp *r4, r1
+rts
+prn X13
+L68: .string "of"
+L69: not *r1
+L70: .string "q"
+L71: clr r4
+L72: bne *r6
+L73: .data -516, 70, 750, 471, 30, -334, 38, 502
+cmp L24, #-154
+; comment
+L74: not r0
+cmp #-57, L47
+L75: jmp L63
+mov L3, r3
+prn L28
+L76: lea L147, *r5
+stop
+
+jmp L48
+mov L108, *r2
+; comment
+add *r6, X10
+jmp *r2
+sub r3, r7
+jsr *r0
+red r2
+jsr *r1
+; comment
+
+sub r5, X21
+jsr L78
+inc L95
+cmp #-239, #-138
+inc L21
+sub L216, *r2
+add L13, X11
+L77: .string "zffsh"
+L78: add *r1, r3
+L79: .data -975, 436, -688, 125, -272
+stop
+jmp *r1
+cmp #-108, *r3
+dec *r4
+jsr L156
+red r0
+L80: .data -353, -551, 212, 780, -850, 250
+L81: dec r6
+clr r4
+L82: sub r6, *r4
+L83: mov X11, L168
+L84: .string "gotmxwmzqv"
+not *r3
+jsr L168
+jsr X7
+sub r4, *r1
+L85: sub X20, X18
+L86: rts
+red r4
+dec *r3
+inc *r6
+dec X13
+lea X16, *r4
+cmp L71, X20
+jsr *r6
+L87: jmp L156
+dec X18
+jsr *r6
+L88: .data -660, -357, 440, -338, -523
+bne *r4
+jsr *r2
+red r7
+jsr L89
+dec *r0
+L89: .string "eiyv"
+L90: lea L181, *r5
+lea L101, *r7
+jsr *r2
+L91: .data -488, -695
+sub X3, *r0
+not r2
+add *r7, r6
+L92: mov *r2, r1
+red *r1
+dec r5
+bne *r4
+mov r6, r2
+L93: stop
+dec *r6
+L94: mov #152, X9
+L95: lea L159, *r7
+; comment
+mov r4, r4
+L96: .data -49, 309
+dec L23
+sub #-241, r4
+bne L67
+inc r3
+L97: sub #-134, *r7
+
+L98: .data 154, 173, -340, 50, -226
+L99: inc X10
+jsr *r3
+stop
+mov L22, *r3
+clr r2
+L100: .string "kslfyaxvxxxe"
+L101: jmp *r2
+stop
+stop
+cmp X2, r5
+L102: .string "gfhlvreczuzl"
+L103: .data 605, 509, 669, -264, 902, 870, 435
+L104: clr X23
+prn r4
+L105: .data 564, 26
+bne L85
+cmp r4, L26
+rts
+clr *r4
+L106: .string "m"
+L107: .data -705, -496, -456, -564, 94, -421, 926
+L108: .string "tzligiso"
+sub r6, X13
+prn r2
+not L162
+lea L116, L32
+L109: .string "uaodlhibzskmizgczdqd"
+jmp L86
+cmp r7, r1
+add #-7, *r6
+L110: add r2, r3
+not *r0
+L111: .string "jvz"
+sub *r3, X4
+clr r3
+L112: .string "vibmgbqgntslzspdrcku"
+
+
+cmp #-154, #242
+rts
+add #-126, L184
+jmp L238
+red L76
+
+cmp L132, r6
+jmp *r2
+jsr *r4
+; comment
+clr r0
+L113: .string "nighexzfikjvgvra"
+L114: .data 472, -334, -273
+bne X8
+lea X19, r6
+L115: sub *r5, r6
+L116: dec X14
+L117: .data -230, 868, -943, -163
+prn L236
+rts
+dec L74
+L118: bne *r0
+L119: prn #-29
+L120: .string "vufuy"
+sub X20, L119
+L121: .string "uvqoxuyxwkyedxokiukl"
+not r3
+inc L182
+add *r3, r7
+rts
+L122: .string "cujegdmzwbuaqfn"
+; comment
+cmp r0, X7
+L123: bne L127
+L124: .data -448, -105, -698
+clr X15
+L125: .data 198, 602, 823, -800, -537
+dec *r4
+L126: lea L183, *r4
+clr *r4
+jmp *r7
+L127: .string "sz"
+stop
+inc *r3
+cmp r1, r0
+rts
+cmp L174, r0
+L128: cmp r2, *r2
+L129: not r6
+lea L0, *r6
+L130: .data -991, -461
+prn X7
+bne *r5
+inc L54
+L131: .string "iuhunakkzitktsfuyav"
+bne *r3
+L132: bne *r3
+add X10, L131
+lea X24, r5
+dec L86
+bne *r6
+L133: bne *r5
+L134: sub #226, *r3
+cmp X16, r0
+sub L134, r6
+L135: lea L166, *r1
+lea L204, L44
+L136: .string "lkdezpmytduvdutxrh"
+jsr *r5
+dec r0
+prn *r7
+L137: lea L203, X18
+stop
+L138: .string "aqjncsikrwaekvrayze"
+dec L232
+L139: add r0, *r3
+bne *r1
+red X12
+stop
+prn *r4
+red X6
+jmp X24
+add *r0, *r3
+L140: stop
+rts
+bne *r5
+jmp X14
+not *r4
+red *r6
+jsr *r5
+inc X17
+clr *r6
+L141: rts
+jsr X8
+L142: jsr *r2
+add #254, r3
+bne *r2
+not *r3
+L143: jsr *r6
+add r2, *r7
+L144: dec r2
+mov #-254, r6
+L145: sub *r1, L140
+L146: .data -283, -782
+L147: stop
+jmp *r7
+prn X11
+L148: .string "ccedah"
+mov *r4, L69
+cmp *r3, #-6
+L149: stop
+prn *r3
+red L3
+L150: add r6, *r0
+red L93
+cmp X13, X2
+dec *r4
+jsr X13
+red r2
+L151: stop
+add *r4, L98
+sub *r7, *r7
+jsr L65
+sub X21, r2
+lea X6, *r5
+bne L197
+dec *r7
+mov #-98, X24
+L152: .string "gyqphespt"
+L153: lea L231, r6
+bne *r4
+not r7
+prn *r1
+jsr *r2
+L154: .string "hnseb"
+add X10, *r2
+jmp L7
+not *r0
+L155: .string "im"
+add X14, *r0
+clr r7
+
+cmp r5, #250
+L156: .string "naqstaodhunij"
+L157: dec r1
+red *r4
+not X7
+clr *r7
+L158: .string "sokmevnjzxvrpmkudst"
+lea L82, r1
+dec r1
+dec *r3
+rts
+rts
+L159: jsr *r2
+L160: inc *r6
+stop
+L161: .string "yxklvwdh"
+dec *r1
+cmp #141, r4
+bne *r7
+inc *r4
+dec L56
+stop
+red *r1
+cmp X8, #-228
+L162: clr r1
+jmp *r0
+mov *r1, L202
+lea X22, r5
+jsr X5
+not r5
+dec X24
+dec r0
+inc *r0
+rts
+add X10, X2
+dec r7
+red *r5
+red *r3
+lea L177, *r3
+L163: .string "hnjvkzsgbochxxhs"
+L164: add X3, r0
+L165: .data -654, 374, 14, 369, 36, -202, -565
+L166: jmp L185
+not *r7
+L167: jmp *r4
+inc *r1
+not *r5
+lea L136, r5
+mov L10, r5
+prn *r6
+L168: .data -610, 500, -565, -696, 463
+L169: lea L174, *r7
+L170: clr *r0
+add L227, X5
+mov *r3, r2
+mov #-82, r2
+cmp r6, r5
+dec r1
+jmp L180
+not *r7
+mov *r4, L259
+L171: red *r0
+bne *r4
+inc L144
+jmp L141
+not r7
+add *r7, *r3
+L172: cmp *r5, *r3
+dec X12
+clr L18
+prn L199
+
+stop
+red *r5
+L173: inc L220
+red *r7
+sub X9, r0
+bne L261
+L174: lea L172, *r4
+dec r3
+add L51, *r1
+mov L7, X18
+add *r4, r7
+mov #-174, *r7
+inc X3
+prn r3
+; comment
+sub L254, r4
+clr X10
+stop
+rts
+mov #-223, r1
+
+clr *r3
+clr L217
+jmp X22
+L175: .string "vsktgzoyuxmqlsn"
+inc L237
+lea L99, X23
+rts
+bne L4
+bne X24
+jmp *r6
+L176: sub #-248, r0
+
+mov r0, X9
+bne *r3
+jmp L11
+L177: jmp *r1
+not r6
+mov r3, *r5
+; comment
+rts
+dec *r3
+L178: .string "u"
+rts
+L179: not *r1
+rts
+L180: prn r2
+dec *r5
+jsr *r5
+L181: mov #122, X7
+jmp *r0
+mov *r7, *r4
+cmp *r7, L205
+L182: inc X10
+clr X4
+L183: prn *r3
+L184: prn #55
+
+cmp #91, *r6
+L185: jsr *r2
+L186: jmp *r6
+rts
+stop
+lea X9, L213
+L187: add r4, r0
+rts
+sub *r1, *r6
+bne L119
+not r6
+rts
+L188: rts
+sub *r0, r2
+dec r3
+rts
+; comment
+rts
+prn X5
+
+L189: .data -43, -579, -793, 864, -802, -483, 920, 326
+clr X19
+add #-115, X13
+; comment
+inc L244
+L190: .data 144, -137, -116, -759, -677
+stop
+jmp L246
+dec r6
+bne *r5
+L191: .data 544, -700, -529
+rts
+sub r5, *r2
+L192: cmp r6, *r7
+L193: clr X4
+L194: mov *r3, X4
+stop
+prn #56
+; comment
+dec L144
+prn X5
+prn L204
+clr L261
+add *r5, r5
+; comment
+; comment
+
+inc *r0
+sub #24, L239
+L195: jsr X14
+L196: .string "lpcqwwarchwl"
+L197: .data 575, -48
+not *r5
+L198: prn r5
+jsr L156
+add X8, r5
+dec *r2
+jmp *r7
+L199: bne *r0
+cmp r6, #-129
+red r2
+L200: .data -409, -402, 671, 934, 474, 906, -685, 628
+sub X19, L191
+sub r2, r0
+dec X24
+stop
+not *r3
+L201: .data 739, 422, 695, 251, -480
+L202: mov X17, *r4
+not *r4
+prn #-197
+red X22
+jsr L166
+mov L240, r6
+cmp *r2, *r0
+L203: not L50
+bne *r2
+rts
+L204: .string "cbdwou"
+sub r6, X1
+stop
+L205: .string "vy"
+sub *r4, r5
+L206: red *r2
+L207: .data -163, 85, -462, -114, 913, 172, 999, 480
+cmp *r7, L94
+rts
+bne X10
+L208: bne *r6
+rts
+sub *r7, *r6
+red *r6
+clr r3
+jsr X15
+bne L56
+jmp L251
+jmp L110
+L209: .data -779, 587, 852
+cmp r2, #-73
+jmp X22
+jsr *r7
+prn #80
+L210: .data -473, 58, 114
+L211: .string "pfgyn"
+cmp *r1, L237
+sub *r6, r1
+red X5
+; comment
+inc r2
+cmp *r6, *r0
+jsr L258
+lea L235, r1
+rts
+L212: lea X4, X14
+sub r2, r5
+dec L248
+bne *r1
+stop
+prn r7
+L213: clr r4
+L214: inc r6
+
+bne *r5
+L215: red L206
+jsr *r0
+prn r2
+inc r6
+add *r3, X4
+sub *r1, *r5
+L216: clr L258
+dec L260
+prn #174
+stop
+jsr *r5
+; comment
+cmp #-158, *r6
+jmp *r0
+L217: prn L200
+L218: sub #-217, X20
+red L239
+L219: .string "g"
+cmp #154, r7
+stop
+jsr L31
+L220: clr r1
+
+sub #-16, r3
+not r1
+prn X19
+mov *r1, X20
+mov r5, L226
+L221: .string "szaxnytwltdhlccwjgznjt"
+prn X4
+inc r4
+cmp #-132, #45
+sub L44, L10
+L222: mov #-211, *r3
+L223: .data -377, 963, 794, -108
+L224: .data -322, -83, 471, -771, -138, 112, -729
+not X4
+red L8
+inc *r1
+L225: jsr L119
+stop
+stop
+
+L226: rts
+mov L250, *r6
+L227: mov L238, *r7
+L228: bne X23
+L229: dec X5
+clr *r7
+stop
+lea X1, r1
+jsr *r1
+dec *r7
+add *r0, L243
+add L215, *r0
+dec X22
+L230: stop
+sub L32, *r4
+; comment
+not X24
+bne *r3
+L231: .string "turdhheejwxtlkgra"
+L232: .string "ujnejwhscmhcjcwuz"
+jmp *r0
+not *r7
+L233: .string "cvxvfthpfy"
+red *r1
+
+not *r7
+prn X16
+rts
+L234: inc L222
+mov #-27, r0
+add #-57, r5
+L235: jsr *r2
+stop
+not r0
+L236: sub L240, r1
+stop
+not r0
+L237: cmp *r1, *r2
+add #141, *r3
+mov L76, L74
+mov #210, *r1
+jsr X5
+; comment
+bne X2
+rts
+lea X11, r7
+not *r7
+L238: .string "rbcsib"
+sub r1, *r6
+mov *r2, X1
+dec L211
+; comment
+inc r3
+sub #-231, L243
+L239: .string "uvjhmhtq"
+jsr *r5
+clr *r0
+L240: cmp r1, L124
+L241: .string "jdvawrqxrtmpkbklxqfiipq"
+jmp *r6
+
+lea L51, X4
+clr r7
+sub L135, *r4
+L242: .data 91, -341, -590, -674, 982, -155, 901
+
+jsr X2
+dec r5
+mov r5, *r4
+jmp *r7
+L243: .data -664, 539, 563, -86, -842
+sub #-115, r1
+sub #-10, *r3
+add #-181, X6
+lea X2, X20
+clr L121
+cmp r5, #-33
+lea L16, *r2
+stop
+red L12
+rts
+L244: not *r5
+cmp *r6, r5
+sub L260, L260
+not X2
+stop
+L245: clr r4
+stop
+red *r1
+L246: .data 907, 263, 222, -37, -385
+jsr *r1
+L247: .data 266, -142, -195, -721, 325
+L248: inc r4
+L249: add r7, *r4
+add #-90, L48
+stop
+L250: .data 470, 907, -136, 330, 65, 195
+jsr *r2
+not r7
+red L146
+L251: inc r7
+prn X22
+L252: lea X0, *r4
+jmp X20
+rts
+red r7
+lea L119, X16
+L253: not X7
+inc *r6
+L254: rts
+clr X23
+L255: add X23, X18
+dec X2
+dec r0
+cmp r6, r3
+L256: add *r5, r0
+L257: .data -230, 475, 327
+stop
+clr L242
+mov r4, *r6
+dec L261
+jsr X9
+sub #-36, r5
+
+mov r2, r7
+L258: not r5
+sub r2, X2
+L259: stop
+not r3
+L260: dec r6
+L261: clr r5
+rts
+jsr L36
+inc X18
+stop
@@ -0,0 +1,1043 @@
+; Generated by genCorpus --seed 17
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+L0: .string "zqsazbixdcfejuod"
+add L0, r1
+not L0
+jmp *r0
+add L103, r1
+L1: dec L61
+prn #-183
+sub *r7, L179
+lea L60, L0
+L2: stop
+bne L56
+L3: .string "dlbvkhrysr"
+rts
+bne L43
+mov r0, *r6
+not *r7
+clr *r6
+dec *r1
+red r6
+L4: .data 423, -634, -44
+dec r7
+sub #-145, r7
+L5: .data 534
+dec *r3
+prn #60
+L6: lea L4, r5
+L7: prn r3
+L8: .data -453, 511, -367, -617
+dec r6
+L9: .data 28, 161, 978, 286
+L10: cmp #130, #-50
+dec r4
+L11: inc *r3
+clr X11
+not L181
+lea L4, *r7
+L12: inc r2
+add L222, *r7
+jmp *r0
+; comment
+L13: mov *r5, *r7
+L14: red L1
+L15: sub r0, L178
+cmp r2, X9
+; comment
+stop
+not *r2
+L16: sub *r5, *r4
+jmp X19
+lea L26, *r6
+dec *r0
+sub #155, *r4
+L17: rts
+dec *r7
+L18: .string "vnshvkvn"
+sub r3, L44
+L19: sub r0, r6
+add #-185, *r1
+stop
+dec L18
+jmp *r0
+sub X3, L101
+L20: jsr X13
+add *r4, L8
+sub L16, L20
+L21: lea X17, r5
+jmp *r1
+dec r0
+red r4
+jmp L3
+inc *r2
+red *r7
+not r6
+add r5, r0
+add #-181, r5
+L22: lea L59, X7
+mov #-102, X0
+not r3
+L23: rts
+add r7, L82
+L24: .data -951, -800, -680, -305, 690, 257
+L25: jmp *r0
+L26: dec *r7
+not r0
+mov *r2, X12
+
+dec L68
+L27: .data -620, 882, -502, 660, -205
+bne *r7
+; comment
+sub #-153, L19
+jmp *r7
+sub *r3, *r3
+bne *r4
+inc L187
+L28: .string "ezinigylrobpr"
+mov #-209, X5
+not *r5
+cmp #-191, #198
+dec r6
+bne *r2
+L29: add r5, *r2
+inc *r6
+; comment
+inc L4
+prn L237
+sub #240, L232
+jsr X12
+red *r7
+dec L18
+lea X14, *r2
+sub *r4, *r1
+mov #132, r6
+L30: sub *r5, L105
+jmp *r2
+dec *r2
+red L14
+red L152
+cmp r0, *r3
+rts
+prn *r3
+cmp X20, r5
+red X23
+L31: clr L173
+rts
+dec r1
+L32: .data -959, 408, -683, -978, 659
+lea L9, r2
+prn *r1
+L33: .string "unaba"
+sub X10, L63
+add #-228, X23
+L34: bne *r2
+stop
+L35: .string "jofvzkjtyrcafwcd"
+inc *r0
+prn *r7
+prn r0
+bne *r2
+clr X3
+stop
+lea X3, r4
+jsr *r1
+
+jsr L13
+L36: red r4
+bne *r6
+L37: lea L46, *r5
+sub L22, r2
+L38: .data -416, -470, 721, 448, 346
+L39: jsr L167
+red *r2
+jsr L37
+lea L26, X23
+dec *r4
+rts
+stop
+red *r1
+clr r0
+mov #87, L35
+sub *r6, *r1
+jsr L201
+bne L14
+clr r0
+stop
+L40: .data -708, 489, -266, 494, 428, -437, -397, 445
+prn L242
+add r2, X7
+L41: prn *r2
+; comment
+cmp X16, L194
+L42: dec r0
+jmp L207
+sub L32, *r2
+L43: .data 595, -466, -344, 297
+L44: .string "onxsckxfkxjpexzx"
+L45: rts
+clr *r7
+lea L187, r2
+add r4, r5
+rts
+mov *r3, r4
+add r5, r0
+jsr L124
+bne L190
+not L29
+not r5
+prn L13
+prn *r1
+red L107
+inc *r2
+lea X17, *r2
+red *r5
+L46: .data -353
+cmp #162, #111
+bne L73
+dec *r4
+mov *r1, r3
+not X1
+
+
+cmp r4, *r3
+L47: clr *r1
+L48: jmp X0
+L49: .string "jqshpmle"
+rts
+lea L84, r4
+rts
+lea L238, *r2
+sub r7, r3
+prn #124
+L50: jsr X14
+jsr X11
+jmp L227
+bne L134
+jsr *r5
+mov *r4, *r2
+L51: not L130
+L52: jmp L111
+L53: not *r2
+lea X24, r2
+sub #216, L155
+jmp X2
+
+cmp *r5, L224
+not L33
+inc X11
+prn r0
+cmp r7, *r6
+L54: .data -914, 546, 168, 728
+mov #-255, r2
+L55: cmp *r4, X5
+rts
+dec *r0
+prn r0
+cmp *r3, *r1
+clr *r0
+L56: mov r7, X0
+L57: jsr *r6
+red *r1
+bne L23
+inc r5
+; comment
+
+not r7
+
+L58: bne X7
+lea X11, r7
+dec L144
+clr L231
+clr *r1
+not *r5
+not *r2
+jmp *r7
+cmp L40, L78
+inc X24
+add #-166, *r5
+clr L140
+inc L58
+mov #135, *r5
+jsr X5
+L59: lea L234, r0
+L60: .string "hbqmvsyhamfohyvxdfrhzvgj"
+prn *r6
+red *r0
+L61: not *r2
+L62: jmp L181
+prn r1
+stop
+L63: not X2
+L64: rts
+sub X23, *r0
+L65: .data -939, 810, 866, 282
+L66: .string "xcsjlvrrvrcs"
+L67: inc r4
+L68: bne *r1
+rts
+sub #-28, *r2
+jsr *r2
+mov r7, *r6
+red *r7
+L69: mov L14, X17
+cmp r3, #227
+add L41, X9
+lea X9, L70
+
+prn X11
+red r2
+jsr X14
+add *r4, r7
+L70: .data 32, -333, -142, 211, 879, 47
+rts
+not X18
+add #-81, *r2
+L71: not L36
+jmp L104
+red r6
+add #-9, r7
+mov r6, *r7
+L72: inc r1
+lea X19, *r7
+jsr L22
+L73: jsr L61
+lea X15, r1
+mov L48, r7
+add r2, X9
+L74: .string "evmoqagcfvjcbaclws"
+cmp X2, *r4
+jmp *r4
+L75: bne *r2
+sub *r5, *r1
+jsr L46
+inc X22
+L76: sub X14, X8
+L77: red r1
+cmp r5, r2
+dec r6
+red *r3
+
+stop
+add r3, X8
+L78: .data -47, 203, 402, 138
+stop
+mov r5, *r3
+L79: lea X14, X9
+L80: .string "godzrqcnur"
+L81: .string "lyjpfihqvr"
+L82: jmp L51
+jmp X18
+; comment
+L83: lea X0, L137
+red X16
+L84: .string "tiyrnumfsjgtnwwtumhfyndc"
+L85: stop
+L86: sub X2, *r4
+sub *r6, r5
+L87: .string "irrhaysowivqbecchnfcobg"
+L88: rts
+
+mov #-64, *r4
+cmp r1, r6
+L89: jsr *r2
+prn *r3
+; comment
+prn *r5
+rts
+dec *r6
+clr X23
+jsr *r1
+cmp L29, *r0
+sub X19, X1
+add #-101, *r6
+L90: clr *r1
+L91: cmp *r5, L23
+not L144
+jsr *r5
+red r4
+cmp *r3, *r6
+prn #-121
+L92: add *r1, L73
+L93: inc r5
+red X23
+bne *r5
+L94: .string "rukjsbcxnxbkzdpy"
+inc X12
+rts
+
+dec *r3
+L95: rts
+dec r7
+not r7
+L96: jmp X17
+mov X12, X1
+L97: stop
+L98: red r6
+bne X13
+L99: .data -701, -750, 709, 586, -970
+rts
+rts
+inc *r3
+jmp *r0
+cmp #-72, #188
+L100: inc *r3
+dec r7
+L101: jmp *r0
+jsr *r2
+
+mov L55, L183
+prn X10
+; comment
+rts
+cmp X14, *r7
+L102: jsr *r6
+L103: dec r5
+add #-109, X21
+L104: .string "wegnpociykh"
+dec *r1
+prn r1
+jmp L155
+dec *r5
+L105: sub L210, *r3
+mov r2, X11
+cmp #144, L2
+dec L32
+prn X12
+jmp *r3
+add *r5, *r0
+add *r7, L29
+inc *r4
+add #-103, *r5
+
+rts
+mov r1, *r1
+rts
+L106: .data -147, -111, -97, 796, -349, -180
+rts
+L107: not *r2
+L108: inc X18
+
+clr *r7
+dec r3
+cmp X6, X19
+dec r7
+bne L144
+red *r7
+prn #-184
+not L63
+inc L139
+rts
+sub *r2, X20
+dec r2
+L109: .string "xmqyvhsxizlrijxvzqci"
+mov #65, *r0
+L110: inc L251
+dec L66
+sub #-229, L64
+prn r2
+lea L173, *r0
+; comment
+L111: .string "v"
+red *r1
+L112: .data 506, -385, 522, -264, 343, 557, 435, -85
+L113: prn *r4
+rts
+clr *r1
+not r2
+L114: sub *r1, r4
+jmp X12
+cmp #49, #-41
+cmp r5, X12
+red L97
+stop
+cmp r1, *r7
+L115: .data -101, -227, -379, 492, 338, 499
+prn r0
+jmp L158
+L116: .data -83, -566
+red L205
+L117: stop
+add r7, *r6
+inc r5
+clr r6
+lea X14, *r2
+L118: dec r3
+jmp *r6
+L119: mov *r7, r4
+L120: .string "adsqzzlaw"
+dec r3
+L121: bne L235
+jmp *r2
+rts
+rts
+inc L110
+L122: not L85
+mov r5, *r1
+cmp #92, L184
+
+inc X18
+sub *r4, *r4
+not L167
+inc X14
+sub X10, r7
+sub #-156, L14
+jsr L10
+L123: add L142, *r0
+
+mov #-190, *r7
+jmp L242
+L124: bne *r6
+L125: mov #144, r1
+mov L8, X20
+add *r1, L11
+red X19
+clr *r0
+L126: not L16
+mov L249, *r0
+red L67
+L127: clr L10
+L128: sub X15, L74
+not L40
+L129: .data 408, -139
+L130: lea L118, *r7
+L131: .string "aylm"
+L132: jsr *r5
+prn X3
+inc X8
+lea L72, L69
+
+L133: bne *r1
+red L109
+L134: jmp L114
+prn *r1
+jsr L102
+prn #139
+mov #-243, r3
+L135: sub #230, *r3
+bne *r1
+L136: sub r5, *r0
+clr r2
+mov #60, r1
+L137: .string "uebukorpjzqvrbrzttzam"
+prn #106
+not *r5
+lea L180, X2
+; comment
+inc r1
+cmp #230, *r0
+jsr *r7
+L138: jmp *r3
+; comment
+sub r6, r1
+cmp *r3, *r4
+sub r0, r7
+L139: lea X13, r7
+cmp #-207, r1
+lea L80, L215
+stop
+jmp L173
+not L242
+prn L91
+inc *r7
+jmp *r1
+bne *r5
+add *r3, r2
+L140: add #60, r6
+stop
+inc r7
+not r1
+; comment
+L141: .string "fubxzicwlvnwlvpdivzbj"
+mov #-139, r1
+rts
+L142: .data -507, -370
+cmp #-81, *r0
+L143: .data 771, -903, 606
+rts
+not *r0
+L144: .data -252, 693, -416, 434, -38, 956
+inc r3
+mov #-31, *r1
+prn #-109
+L145: .string "upriygvnrsffvvemqsms"
+clr r7
+rts
+L146: cmp *r1, #-94
+add #208, r7
+clr *r0
+stop
+jmp *r3
+rts
+add r7, L227
+L147: dec r6
+jmp *r7
+sub *r0, *r4
+L148: .data 156, -239, -846, 989, 693
+dec L187
+jsr X17
+L149: .string "nuevykfcgnjoochpfirsbhdi"
+bne *r2
+jmp L7
+L150: .data -848, 340
+; comment
+not r3
+bne L224
+L151: rts
+add *r2, *r7
+L152: mov *r7, r3
+red r4
+inc L241
+bne *r7
+L153: .string "rvg"
+L154: stop
+L155: jmp L95
+L156: .string "s"
+L157: .string "fbypctcptzmsypjgtxjfotew"
+cmp X19, X12
+jmp *r6
+sub *r4, r4
+dec L192
+L158: cmp r0, *r3
+red L181
+; comment
+inc r6
+prn #-119
+
+L159: .data 934, -120, 413, -319, 231
+add #-228, *r1
+rts
+clr r7
+add *r5, *r4
+L160: .data 59, -87, 285, 715, 722, 859, 450
+dec r2
+red L142
+
+bne L138
+sub r6, X10
+bne *r3
+inc L88
+L161: clr X16
+not X9
+jsr *r1
+L162: .data -914, 957, 890, 518, 578
+add *r3, *r7
+rts
+lea X1, X15
+prn r6
+clr r6
+L163: jmp X3
+; comment
+L164: clr X11
+clr r6
+inc X8
+not r4
+L165: .data -953, -317
+L166: rts
+rts
+rts
+
+inc r1
+inc X4
+L167: add r2, X10
+L168: red L160
+jmp *r5
+prn r6
+stop
+prn *r5
+L169: .string "t"
+add L20, *r7
+L170: .data 296, 754, 178, -487, -144
+L171: .data 640, -576, -608, -917
+mov #-169, L108
+dec X24
+jsr X3
+L172: .data -209
+stop
+L173: .data -895
+L174: .string "nr"
+red r0
+stop
+dec L2
+jsr L132
+not *r6
+clr *r3
+mov #-119, r2
+L175: not X17
+red L144
+L176: .string "vvcesvlzdzbfnjydtuu"
+L177: jsr *r7
+red r6
+jmp *r2
+add r3, L44
+mov r0, r7
+L178: rts
+L179: .string "rlqvvwsivwi"
+bne *r1
+stop
+prn X8
+lea X15, L240
+L180: .data -836, -956
+rts
+not r4
+not L250
+lea X4, L207
+L181: cmp #216, #-11
+L182: cmp r1, *r7
+red r6
+jmp X21
+L183: .data -201
+L184: .data -906
+red r7
+prn #-113
+stop
+jsr L190
+prn r4
+prn L246
+jmp *r6
+dec r1
+L185: .data 987, -639, 843, -182, 752, 824, 398
+mov L238, L231
+L186: red L10
+cmp *r3, *r5
+dec r4
+lea L212, r3
+sub *r3, X5
+jmp *r6
+bne *r2
+L187: rts
+stop
+L188: sub #51, *r5
+L189: red *r6
+prn X1
+sub *r4, *r2
+L190: jmp *r6
+not X13
+stop
+clr L233
+jmp L172
+rts
+jsr L247
+add r2, X11
+L191: .data -134
+stop
+; comment
+L192: .string "ejqwaqldpmsfzopf"
+L193: .data 554, 113, -809
+jmp L218
+jsr *r3
+L194: sub L88, *r3
+bne *r5
+L195: .string "u"
+L196: add *r5, L145
+rts
+
+cmp #175, *r2
+sub *r2, L3
+L197: inc *r3
+stop
+stop
+jmp *r5
+inc L91
+bne X20
+inc *r7
+bne *r7
+dec r5
+dec r0
+inc *r0
+
+jsr *r0
+L198: .data -610, -64
+clr X13
+jmp *r3
+red *r7
+add #-251, *r0
+L199: .string "qrjmalosfjhrzafepkhwdwoo"
+L200: .data 581, 935, 635, -397, 994, -423, -672, -655
+cmp X0, #210
+jsr *r2
+clr r1
+; comment
+L201: cmp r1, *r4
+prn #26
+dec r5
+bne *r2
+clr X5
+red *r4
+not L65
+inc X1
+add *r4, X4
+L202: .string "nysckhynlaitdddvopxecq"
+red r3
+L203: .string "qeknfjczsskiajiklk"
+mov X7, r3
+red *r0
+prn *r3
+L204: .string "pbnttspwhlfgotjuemo"
+jsr *r3
+L205: lea X19, *r4
+L206: .data 285, -809, -461, -871, -78, -339, -468
+lea X18, *r0
+L207: lea X9, r4
+L208: rts
+clr L197
+L209: .data 946
+inc L224
+L210: .data -446, -579, 877, -281
+cmp *r6, X7
+red r1
+cmp *r1, #36
+inc r1
+stop
+
+cmp #94, r7
+not L64
+red X17
+lea L236, *r5
+L211: dec L168
+bne *r1
+rts
+red L222
+jmp *r6
+stop
+L212: sub r3, *r5
+stop
+prn r0
+clr L167
+not X20
+clr *r1
+prn *r3
+red *r6
+red *r6
+lea X9, *r7
+not *r4
+dec L45
+L213: .data -654, -279, 447, 628, 586
+L214: not r1
+clr r4
+red r0
+inc *r5
+sub #170, r2
+jsr L238
+add X18, r6
+clr r6
+L215: .data -405, -163, 136, 362, 280, 226, 940, -57
+jsr *r4
+L216: cmp *r2, L119
+jsr X0
+cmp r1, #-78
+; comment
+jsr *r3
+jsr *r2
+lea L123, *r4
+red r5
+L217: inc r5
+bne L34
+jsr *r7
+L218: .string "eapycfiwngglrxxhlan"
+
+mov r0, r1
+rts
+bne L79
+sub r7, r5
+prn *r5
+mov *r3, *r2
+clr *r6
+prn L173
+stop
+L219: clr *r5
+rts
+L220: .string "xjxmljqkvubyvrvmnsn"
+stop
+mov r1, r6
+jsr X5
+mov *r3, *r5
+clr X19
+L221: .data 168
+cmp #184, #-146
+lea X14, X3
+prn L232
+; comment
+clr L95
+mov *r2, r7
+stop
+jsr X18
+L222: clr *r6
+; comment
+L223: cmp r1, #-7
+L224: .data -496, 933, -798, -40, -380
+dec *r6
+cmp #76, *r2
+lea L245, L233
+L225: clr *r7
+L226: .data 291, -239, -389, -200
+jmp X23
+jsr X24
+add *r2, *r1
+L227: bne *r4
+mov #-132, r0
+rts
+L228: not r5
+rts
+dec r1
+dec r3
+cmp #-52, r1
+stop
+add *r1, X21
+bne L137
+add X18, r3
+add *r6, X21
+mov r2, *r5
+lea X23, r7
+L229: .string "xayug"
+not L248
+stop
+L230: cmp *r6, L239
+jsr *r5
+inc r0
+rts
+sub *r1, *r4
+
+lea X23, r0
+rts
+stop
+dec *r1
+inc L130
+L231: red X0
+; comment
+L232: jmp L236
+L233: .data 314, 812, 879, -717, -950, -156, 202
+red r1
+inc r6
+lea L241, r2
+rts
+red r3
+dec r2
+L234: .string "gkwjxfpdglbesnpcp"
+red *r2
+not *r6
+L235: not r5
+L236: .string "xahwoddytpdqr"
+dec X24
+cmp *r2, r6
+prn #217
+L237: .string "njyptemrxv"
+L238: jsr L155
+L239: .string "jnvmgxbnofae"
+dec L137
+not r5
+L240: .string "hwouapjrlpffvadqnprelh"
+not *r5
+stop
+
+clr r4
+L241: .string "kcmvffscfthnsfyzi"
+red r1
+rts
+rts
+sub r4, r1
+add r2, X7
+bne X19
+stop
+dec r1
+inc L33
+L242: lea X21, L196
+inc r6
+
+L243: dec L164
+bne L249
+lea L202, r0
+rts
+sub *r5, L245
+dec *r2
+add X13, L195
+L244: jmp *r4
+L245: red L252
+stop
+L246: mov *r2, L252
+L247: .data 969, -284, -221, 930, 983, -964, -827
+jsr *r4
+sub X4, X9
+inc L248
+bne L250
+cmp *r2, r1
+L248: inc X3
+clr *r5
+bne *r4
+clr L190
+stop
+lea L134, *r6
+clr *r0
+L249: stop
+add *r1, X9
+prn r4
+mov L252, *r7
+bne *r7
+rts
+inc *r2
+dec *r5
+L250: dec L252
+inc X5
+not L141
+
+rts
+clr *r7
+jmp *r3
+jsr L83
+add r3, r3
+L251: mov X24, L235
+; comment
+sub r2, r4
+clr r6
+lea L252, r5
+lea X19, L252
+bne L210
+L252: .string "urioi"
+stop
+jmp *r1
+rts
+cmp #196, r0
+prn r4
+bne *r4
+stop
@@ -0,0 +1,1045 @@
+; Generated by genCorpus --seed 18
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+inc *r1
+L0: .string "yjilexqsymnfbwynxw"
+sub #-152, r7
+inc *r6
+jsr X16
+jmp X21
+jmp L0
+L1: .string "cqlibhodrejlaqyxgbpxy"
+dec r0
+dec *r1
+lea X16, *r2
+not *r3
+red L30
+red r4
+bne X1
+stop
+mov #-52, X19
+rts
+not L26
+red X14
+add r2, r2
+bne *r5
+clr r7
+dec r7
+sub *r1, r2
+jsr *r7
+stop
+; comment
+prn #-191
+prn L54
+mov #28, L0
+L2: inc X7
+clr r4
+dec *r5
+L3: mov *r4, L228
+inc L1
+L4: .data 198, -213, -738, 772, -120, -823, 53
+L5: lea L134, r5
+dec *r0
+rts
+L6: .string "quns"
+L7: stop
+not X16
+cmp L7, L42
+clr r7
+L8: .data -787, -604
+L9: prn r7
+cmp *r3, *r6
+bne X20
+red L182
+dec r1
+bne L8
+L10: stop
+rts
+L11: red r1
+stop
+L12: lea L2, *r3
+L13: jmp L12
+jsr X4
+stop
+rts
+L14: rts
+L15: .data -885, -787, 405, -311, 672, 600, -3, -513
+red r2
+sub #75, *r5
+cmp #207, *r2
+add L11, *r6
+; comment
+rts
+not L13
+inc r2
+L16: bne *r4
+L17: stop
+red r7
+not *r0
+L18: jsr *r0
+sub #-143, r7
+not r4
+L19: dec L251
+L20: rts
+jmp *r0
+red *r7
+mov *r3, X20
+L21: jsr X12
+L22: lea L179, X6
+dec r2
+L23: jmp *r6
+jmp *r1
+L24: red r7
+; comment
+L25: .string "nhqtexbnhtogswqsvar"
+L26: inc *r0
+stop
+red r7
+jsr *r7
+clr *r6
+L27: rts
+sub *r1, *r6
+inc X18
+sub X1, r4
+inc r4
+cmp L14, X18
+dec *r4
+; comment
+bne *r5
+L28: dec r7
+add *r2, L2
+bne *r0
+bne L91
+not r6
+stop
+L29: add r1, X24
+L30: inc *r2
+rts
+bne L65
+cmp X10, r7
+add #-30, r6
+jsr X4
+prn r5
+sub *r2, *r3
+add *r2, r1
+clr *r2
+inc L28
+L31: cmp #23, r5
+stop
+dec r7
+lea L267, *r3
+dec *r5
+red *r6
+red r1
+prn X7
+cmp r4, X7
+jsr L23
+dec *r0
+bne *r6
+sub *r6, r7
+cmp X10, *r1
+sub X13, r0
+L32: prn L29
+bne *r4
+; comment
+cmp *r0, #193
+jmp *r4
+jmp *r2
+stop
+lea L23, L16
+L33: inc r1
+jsr *r7
+sub X6, *r7
+bne L29
+bne *r2
+L34: not *r0
+clr *r3
+jmp X1
+jsr *r7
+red X5
+red *r7
+rts
+inc r7
+cmp L172, L11
+L35: lea X20, *r1
+not L32
+L36: .string "edctzxav"
+stop
+stop
+bne L144
+jsr *r0
+rts
+mov L87, *r4
+red r4
+; comment
+add r6, *r7
+L37: rts
+stop
+bne *r5
+; comment
+L38: stop
+L39: .string "zcitmvkohwrnykgnadlc"
+L40: red r1
+add r6, r5
+mov #173, r2
+lea L35, r4
+lea X8, L40
+
+sub X6, r2
+red X14
+L41: sub *r7, X18
+clr *r6
+mov r0, X18
+lea X6, *r4
+prn *r1
+L42: .string "kxns"
+sub #-240, *r3
+L43: .data 638
+mov #-203, r6
+L44: prn *r4
+sub r5, L21
+sub #-216, X12
+L45: .data -837, 563, -325
+inc r3
+sub #14, r5
+clr *r2
+L46: bne *r4
+not L3
+L47: .string "dksdbfk"
+rts
+rts
+L48: red *r7
+L49: jmp *r1
+bne *r5
+mov #-206, *r0
+bne *r5
+dec X20
+L50: .string "vduqcnon"
+L51: lea L35, r5
+mov *r4, L8
+cmp *r2, #-107
+jmp *r1
+L52: clr r4
+bne *r6
+dec r4
+
+lea L195, *r1
+cmp r4, *r6
+L53: .data -497, -206
+mov r3, *r6
+rts
+L54: sub *r3, *r2
+add *r6, L14
+inc L144
+L55: .data 441, -114, -76, -391, 40, -507
+L56: bne *r1
+lea L95, X21
+L57: .data 517, 855, 954
+add X10, L36
+dec *r6
+rts
+stop
+lea L37, r1
+; comment
+lea L54, X21
+lea L6, *r7
+not L139
+add r2, r3
+inc *r3
+
+L58: jmp X16
+jmp *r7
+sub *r4, X19
+L59: red *r3
+inc *r5
+L60: jsr X19
+rts
+L61: red *r0
+L62: .data 979, -413, 42, -104, -127, 329, -462
+L63: jmp *r5
+L64: stop
+sub r2, *r4
+
+sub X6, X17
+dec *r5
+L65: .data -234
+L66: mov *r1, X13
+lea L193, L99
+prn #-215
+clr X12
+dec X18
+L67: dec r5
+jmp *r4
+L68: red *r1
+inc L213
+
+mov L48, *r6
+sub X12, *r1
+L69: stop
+prn r7
+L70: .string "qcxjllnqkpnglfghvku"
+mov #-59, r2
+dec r2
+L71: .data -84, 640, -797, -860, 33, -148, -125, -570
+sub *r7, X15
+L72: .data 690, 562
+
+L73: cmp X0, r4
+rts
+jsr X1
+L74: .string "wwbewa"
+
+lea L32, *r1
+L75: stop
+not L248
+mov *r5, L0
+jmp *r4
+lea X9, r6
+bne L40
+clr r4
+jsr *r1
+lea X1, X11
+L76: not L173
+prn *r4
+dec X14
+red *r5
+inc *r1
+stop
+jsr *r5
+L77: .data 148, -955, 439, 829, 865
+jmp L59
+jmp *r1
+inc *r3
+L78: prn L234
+prn r7
+rts
+; comment
+add r3, X20
+bne L138
+not L94
+jmp *r4
+L79: .string "ycrgyqfbhshj"
+L80: add r5, *r1
+bne L69
+not r7
+dec r4
+L81: .data 15, -979, 862, -633, 377, 242, 728, -59
+L82: prn X5
+add #-251, X7
+lea X5, *r6
+dec L44
+
+lea L25, L151
+mov #17, *r1
+clr r5
+inc X19
+mov #133, *r2
+bne *r2
+red X0
+L83: .data -476, 988, 876
+L84: .data 996, 108, 250, -763, -671, -929, -789
+stop
+L85: .string "bmknfaieshdwm"
+mov *r2, r2
+L86: .data 515, -44, 134, -626, -761, 64
+dec r2
+not r0
+L87: lea L34, r2
+clr *r7
+L88: .string "q"
+L89: red L53
+lea X0, X14
+L90: .data -55, 901, -679, 168, 928, 518, -250, 706
+L91: add X7, *r4
+L92: .string "uigwiymzjbfoumobwqqhiqc"
+cmp L35, #205
+L93: inc *r7
+mov r3, r3
+rts
+inc L171
+rts
+red X17
+cmp *r6, *r1
+L94: add *r0, X21
+L95: clr L80
+red *r0
+L96: .data -959, -227
+add #-6, L262
+L97: stop
+jmp *r6
+; comment
+L98: .string "qfijrslovatfi"
+inc *r2
+prn #-88
+cmp L73, *r2
+mov #-144, r5
+L99: cmp *r3, r5
+; comment
+jsr X24
+add r1, *r5
+sub *r4, *r6
+jsr *r0
+L100: .string "foarnrfrwut"
+rts
+L101: jsr L55
+sub #-131, L37
+lea X21, *r6
+mov r4, r3
+jsr L210
+mov r5, r6
+L102: mov #50, *r7
+bne L65
+L103: not r1
+jsr L4
+sub r2, L125
+L104: add #55, X17
+L105: jmp L126
+bne *r3
+L106: .string "nxupknbjvovpeeooo"
+mov L117, r5
+lea L219, X23
+L107: bne X9
+add *r5, r5
+clr r3
+L108: .data 559, -548, 693, 237, -23, -238, 776, -146
+L109: red r7
+cmp r6, #253
+cmp #185, #-90
+clr *r0
+rts
+L110: .data -732, -261, -63, 91, 166, 210, -820, -86
+L111: stop
+L112: .data 743, -222, -498, -382, 628
+not X23
+cmp r3, L95
+L113: mov #-191, X8
+mov #9, L21
+add L97, *r5
+sub #-137, X9
+L114: add *r6, r0
+prn r7
+
+stop
+lea X0, *r4
+bne *r0
+red r0
+clr r3
+lea X0, r4
+lea X6, r3
+mov #-58, *r7
+L115: bne L47
+clr *r0
+rts
+sub #-191, *r6
+bne X16
+dec *r1
+
+mov *r4, r1
+rts
+dec X16
+sub L51, *r3
+rts
+rts
+
+jsr L67
+L116: .string "zme"
+jsr *r6
+L117: .string "uoushiicfjvdfoyefhnnih"
+not *r0
+stop
+mov *r1, *r3
+mov L40, r6
+add *r0, r1
+red r4
+add r4, r0
+rts
+L118: dec *r6
+L119: lea L95, r5
+L120: sub X23, X12
+cmp r7, *r5
+cmp r3, #-200
+L121: prn r5
+L122: add *r3, *r4
+add X1, *r6
+cmp r3, #148
+not *r4
+add L248, r0
+
+add *r7, X11
+mov #10, *r2
+L123: .data -888, 860, 872, 633
+cmp *r1, L273
+cmp *r4, *r6
+lea X17, *r4
+L124: lea X9, *r2
+prn X9
+rts
+L125: .string "ykvsnqsfscdc"
+prn *r0
+sub r3, *r4
+add r4, r4
+rts
+L126: .data 840, -815, -193, -187, -51, 595, 178
+bne *r4
+prn L253
+sub #-34, r7
+L127: sub #72, X0
+add L44, *r4
+mov #150, L49
+add #-239, r1
+jmp *r3
+prn #-12
+jsr L235
+L128: not L59
+L129: .string "ozfxthjzyfoxpvbllqbtjjp"
+L130: .string "egqkxkv"
+bne *r7
+red X24
+L131: cmp L90, #108
+inc L195
+not r5
+mov L267, L164
+cmp r7, r0
+stop
+L132: .string "jorqupuuzrzdyjdq"
+dec X21
+lea X7, L40
+lea X14, L205
+jmp X7
+add r6, *r6
+L133: clr X21
+L134: mov r5, L151
+L135: .data -942, 133, -717, -874, -658, 104
+lea L219, X0
+; comment
+sub r3, r2
+jsr *r4
+not r7
+lea L128, L188
+L136: .string "mnxxpljobjz"
+dec *r3
+
+add #-38, *r4
+L137: inc r3
+L138: mov #75, *r4
+jsr *r4
+L139: red r2
+prn *r7
+not r1
+jmp X11
+L140: jsr L147
+L141: .string "fzgbc"
+stop
+clr r2
+not *r5
+rts
+lea X18, X15
+prn L202
+stop
+stop
+stop
+red r7
+L142: jsr *r0
+not L103
+lea L146, *r1
+L143: mov *r0, r3
+lea L224, *r4
+cmp r2, r1
+jsr *r0
+L144: .string "fxszqtcshqhzpzu"
+rts
+L145: .data -103, -831, -576, -663
+dec r0
+mov r2, r4
+sub r3, L230
+cmp *r1, X1
+L146: stop
+cmp r7, *r5
+inc *r2
+L147: add r1, X24
+lea L278, r5
+add #192, r1
+; comment
+L148: bne *r2
+lea L132, L13
+rts
+jmp *r5
+L149: rts
+mov r2, r6
+add #-96, *r1
+prn X3
+L150: not *r1
+L151: not X16
+L152: .data -488, -379
+prn L221
+L153: .data 855, -943, -973
+jmp X6
+jsr *r3
+L154: bne L5
+inc L29
+L155: jmp L160
+L156: .data -592, -154, -454, -924, -511
+clr *r5
+clr *r6
+L157: .data -603
+stop
+red L131
+dec L187
+red *r5
+L158: .string "jidhbmnufcukw"
+L159: sub L126, L251
+jmp *r3
+mov #21, L167
+jsr L104
+add #5, r5
+not *r3
+stop
+clr r2
+lea X0, r7
+L160: .data 943, 960, -343, -139, 685, -426, 68, -351
+L161: rts
+L162: clr X14
+jsr L237
+dec *r7
+stop
+red *r4
+cmp *r1, #174
+add r7, r4
+not r4
+cmp r5, #249
+not r4
+clr *r0
+red *r1
+not *r7
+clr r1
+add *r1, *r4
+L163: clr *r4
+red *r7
+L164: .data -816, -487, -804, -19, 483
+L165: .string "czclhnplkhxvlcrrgzdyq"
+jmp L187
+jmp *r1
+clr *r6
+L166: .data 951
+lea X6, r5
+mov *r2, *r7
+red X23
+lea L213, *r1
+cmp #106, #200
+clr *r4
+cmp #169, #172
+clr *r7
+mov #-204, X18
+inc L130
+L167: inc L166
+
+lea X16, *r1
+; comment
+L168: .string "kunreygvrjmxzguxzhf"
+not L170
+jsr *r0
+L169: bne L195
+sub *r3, r6
+red L115
+jsr *r1
+prn r1
+add *r4, *r6
+cmp #-97, L1
+L170: .data -555, 880, -954, -134, 583, 133, -201
+red r0
+L171: prn X4
+red r6
+L172: stop
+prn r2
+sub *r4, *r4
+red *r0
+L173: jmp X16
+dec *r1
+jsr *r0
+prn *r2
+add #-47, *r0
+stop
+jmp L137
+L174: .string "iwokgzeiasxw"
+jmp L54
+not X3
+inc r4
+clr *r3
+L175: jmp X17
+L176: bne L246
+jmp *r7
+L177: .string "hmmtprbxnxhkghgrxfifiyef"
+prn #180
+red r0
+mov L87, L56
+cmp r7, #-151
+stop
+jsr *r4
+; comment
+not r2
+L178: jsr *r6
+lea X18, *r6
+lea X14, *r3
+L179: .string "gaezydhydzqtevbcoai"
+inc r2
+add #-203, L95
+red r2
+clr r6
+rts
+; comment
+mov r1, X16
+lea L210, *r7
+mov L70, L48
+add *r0, *r5
+L180: clr L71
+; comment
+sub *r5, *r0
+cmp #-44, X11
+L181: .data -654, 863, -431
+not X15
+L182: jmp L93
+not L79
+L183: inc L18
+L184: jmp L270
+
+L185: .string "kykdsfixwmyujkunpdev"
+bne L276
+L186: jsr X13
+L187: inc *r5
+clr *r4
+L188: dec r4
+jmp L211
+rts
+rts
+L189: .string "kfjavlcqq"
+rts
+
+L190: dec X23
+jsr *r2
+lea X22, L163
+L191: rts
+L192: mov *r6, L39
+stop
+dec X12
+L193: jsr *r5
+inc L241
+L194: sub #105, X13
+add *r1, *r4
+sub *r4, L144
+L195: mov #191, r7
+bne *r7
+inc *r6
+inc r7
+jsr X16
+rts
+jmp L130
+L196: jsr *r3
+L197: dec L254
+L198: not r7
+red L219
+jmp L279
+prn r7
+dec *r0
+stop
+bne *r6
+L199: cmp #32, #247
+L200: inc L228
+L201: not L257
+L202: not r3
+add r7, *r4
+dec r0
+L203: .string "ngso"
+jsr X3
+jmp L55
+; comment
+sub L104, r6
+inc L214
+L204: .data -766, -785, 303, -332
+cmp r5, *r6
+dec L262
+lea X13, r3
+
+red L161
+mov r7, r0
+rts
+rts
+jsr L241
+L205: inc X17
+L206: bne *r4
+L207: prn r5
+clr r0
+lea L99, r3
+L208: inc r2
+L209: .data -832, 396, 676, -236, 830, 170
+
+red *r2
+rts
+lea X17, r1
+jmp *r3
+L210: bne *r0
+L211: stop
+jsr *r5
+prn L231
+L212: .string "lknkbaynvuwwdigjseisxoh"
+L213: .string "alvhfyklkxhgxf"
+add L275, X8
+L214: .string "partxadssvztf"
+bne *r6
+clr *r1
+add r3, L113
+L215: sub r2, r4
+bne *r0
+bne *r2
+lea X24, L254
+L216: .data -275, -798, 630
+clr X16
+L217: .data 605
+L218: not r3
+clr *r2
+cmp r2, *r0
+mov *r1, r4
+L219: jsr X3
+L220: .string "fmqyootaidqowzyspivssffl"
+red *r4
+inc r6
+prn *r5
+bne X6
+sub L268, L182
+clr *r7
+mov r4, r4
+dec r2
+inc *r5
+L221: not L38
+jsr L4
+sub r2, r5
+lea L229, r4
+bne *r3
+cmp *r1, L254
+clr *r3
+jmp L90
+mov r0, r2
+L222: not *r0
+L223: .data 606, -486, -863, 613
+; comment
+add X2, r7
+L224: jsr X23
+L225: cmp *r4, *r7
+dec r3
+bne L229
+bne L135
+stop
+mov #-35, L89
+lea L264, X18
+red r5
+add *r6, X15
+dec r4
+L226: not L131
+sub #99, X5
+; comment
+inc L43
+; comment
+lea X7, X24
+mov r5, L52
+red r7
+dec L131
+stop
+not *r4
+jmp X17
+L227: prn X1
+sub r0, r1
+jsr X22
+add X8, r0
+sub *r7, *r4
+; comment
+mov #-220, X23
+dec *r5
+L228: .data 530, 536, -172
+
+L229: sub r3, L100
+rts
+L230: bne *r7
+rts
+L231: rts
+L232: .data -812, -284, -879, -851, -609, 691, -611
+jsr *r4
+cmp r4, *r7
+bne L225
+L233: .string "ordkpmeusotug"
+; comment
+; comment
+L234: jmp L145
+stop
+prn r4
+L235: mov r0, r0
+; comment
+jsr L142
+L236: prn *r1
+jsr *r1
+sub r6, *r7
+red L199
+clr L249
+L237: lea L269, X18
+L238: clr r2
+L239: .data -124, -690, -699, -718, 81
+inc L275
+jsr *r2
+dec r4
+L240: cmp L178, *r4
+not *r6
+not r7
+not L272
+L241: dec *r0
+lea X0, r7
+jmp *r4
+red *r4
+clr L19
+; comment
+dec L268
+prn *r6
+cmp X1, #-159
+prn L165
+sub r2, r7
+L242: prn X23
+red X22
+L243: clr X23
+dec *r2
+L244: rts
+L245: prn L14
+L246: mov *r1, X10
+L247: .data -929
+L248: .data 620, 502, 634, 676, 806, 226
+clr *r2
+lea L162, L128
+L249: jmp L27
+add #-195, L281
+; comment
+L250: prn r0
+red *r6
+L251: bne L278
+clr r0
+L252: sub r1, r2
+red r3
+dec r5
+mov r0, L16
+L253: clr X19
+rts
+lea L153, L260
+rts
+jmp *r0
+add *r3, *r2
+not r0
+lea L138, r2
+not r1
+add X24, *r2
+L254: not L263
+L255: inc *r1
+mov r4, r1
+L256: dec L278
+rts
+L257: jsr L14
+L258: cmp X20, #-52
+stop
+L259: .string "xopkwmukatjankvh"
+rts
+jsr *r4
+L260: stop
+dec X1
+mov *r1, r6
+L261: stop
+sub L169, *r4
+
+dec X19
+add r3, L241
+stop
+lea L73, *r3
+clr *r1
+L262: jsr X24
+sub #125, *r3
+L263: bne X14
+L264: add r7, L276
+rts
+jmp L270
+L265: mov *r7, L216
+L266: jsr *r2
+lea L5, r1
+cmp L188, #-100
+prn X2
+L267: .data -7, -790, -82, -381, -532
+clr *r2
+L268: stop
+stop
+L269: cmp #-99, *r2
+rts
+bne L44
+L270: bne X24
+L271: sub L273, *r7
+lea X3, r0
+prn *r0
+L272: .string "yfhakgivx"
+L273: red L279
+cmp X22, *r4
+jsr X11
+L274: .string "pzvrbzrlslndfazqnqnyhtp"
+cmp L276, X20
+clr *r2
+inc L276
+lea X21, X1
+prn r5
+inc X19
+L275: mov *r0, *r1
+bne X6
+L276: sub r4, *r5
+sub #-168, *r0
+cmp #44, #-173
+L277: cmp #-166, *r5
+L278: sub r3, L281
+L279: .data 804
+cmp #-164, r1
+L280: cmp r6, *r3
+mov L180, L281
+L281: bne L81
+not r5
+not r1
+add *r6, r5
+stop
@@ -0,0 +1,1045 @@
+; Generated by genCorpus --seed 19
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+dec r1
+jsr *r5
+cmp #4, #-227
+not *r1
+L0: red *r2
+L1: stop
+L2: .data 542, 981, 691
+sub L2, *r2
+; comment
+stop
+prn L89
+L3: prn L0
+dec L246
+jsr X0
+prn *r3
+mov r7, L256
+L4: lea X12, *r2
+sub X21, r5
+L5: prn #155
+red X19
+L6: .data -569, 665, -884, -578
+not r2
+L7: jsr *r3
+cmp #171, #193
+not X4
+dec L268
+add r4, r5
+L8: sub *r1, L16
+L9: dec r2
+; comment
+add L104, L1
+add #123, r6
+red r0
+dec L5
+jmp L4
+
+jsr *r0
+prn r1
+not L225
+stop
+rts
+sub r3, *r1
+bne X0
+not L2
+mov *r7, r5
+sub #-84, X23
+L10: .data 943, -578
+L11: prn L58
+mov #-91, r7
+inc X19
+inc *r1
+bne X24
+L12: red r4
+dec r2
+L13: dec L11
+cmp #33, r0
+bne L31
+stop
+L14: bne *r1
+stop
+L15: stop
+L16: bne L1
+L17: prn *r3
+prn X3
+add #-24, L81
+L18: .string "vsmsxr"
+not *r6
+lea X22, L252
+clr r0
+L19: .string "rfpjms"
+bne L5
+
+rts
+inc r3
+L20: dec X5
+add L19, X11
+L21: .string "yqaa"
+lea L19, L0
+mov *r6, L108
+L22: sub #141, X16
+mov r3, r5
+prn L16
+rts
+dec *r7
+dec r6
+L23: sub r4, X17
+L24: .data -978, -366, -79, -173
+dec r4
+jsr L157
+prn #-251
+sub *r6, L187
+L25: .string "eyogyig"
+add *r5, X2
+L26: rts
+mov #-62, *r5
+L27: .string "vixlxnqqjr"
+L28: .data -271, 584
+add r0, r6
+L29: prn r7
+clr *r5
+not L25
+L30: rts
+lea X0, X2
+L31: .string "wphsrrysmxjgwzfwbxqbmuj"
+L32: red r7
+sub *r4, L159
+clr L126
+red r3
+
+clr r1
+prn *r3
+mov *r1, L14
+L33: red L13
+; comment
+inc X17
+prn r7
+L34: clr r0
+; comment
+prn *r6
+L35: clr r1
+dec *r0
+clr *r0
+cmp r6, *r5
+prn *r4
+jmp X2
+dec L111
+L36: .string "iyb"
+L37: .string "pdmgksgtld"
+stop
+cmp r4, X8
+jsr L26
+inc r2
+mov *r3, r1
+L38: .string "dtnaxmkvko"
+lea X8, r6
+rts
+L39: jmp *r1
+clr L24
+mov *r0, *r2
+inc r3
+red X24
+stop
+sub r2, L4
+not L0
+; comment
+dec r2
+L40: .data 215, 584, -832, -791, 774, -646
+prn L13
+lea L17, r2
+prn #-192
+jmp *r5
+L41: inc L39
+L42: inc r7
+inc X15
+jsr *r6
+L43: bne *r5
+
+jsr *r3
+mov #196, *r6
+jmp *r3
+cmp L233, #-64
+L44: .string "obeydrkqrj"
+jsr *r4
+L45: .string "gnigmijuwn"
+L46: jmp L26
+dec *r7
+bne X4
+L47: red X20
+; comment
+jmp X4
+lea L211, L21
+
+L48: stop
+
+L49: rts
+L50: .data -346
+sub *r1, r2
+cmp #-128, #-210
+stop
+L51: lea L244, r1
+L52: jsr L10
+not r6
+; comment
+L53: .data 565, 231, -815, 125
+red r7
+sub *r2, r7
+lea X8, r5
+not L28
+bne *r5
+sub L203, X1
+lea X24, L45
+inc r2
+rts
+dec *r2
+cmp #-37, *r2
+stop
+L54: rts
+L55: inc X22
+jsr L49
+L56: jmp X7
+L57: dec r6
+prn r1
+L58: not r2
+L59: stop
+sub #57, *r3
+add r2, L8
+clr X14
+L60: clr r0
+stop
+jsr L19
+jmp *r6
+cmp r0, #253
+L61: sub X21, L148
+not L156
+cmp L45, r7
+lea L51, L269
+mov *r2, *r6
+rts
+mov *r6, r2
+rts
+rts
+L62: red r1
+L63: add r4, r4
+L64: inc *r7
+cmp r1, #241
+prn X0
+rts
+red X5
+mov *r3, *r4
+sub r6, X17
+rts
+red X21
+jmp *r1
+sub r7, L230
+red r2
+not L33
+L65: .data -152, -40, 995, 279, -205, -437, 288, 265
+not *r3
+bne *r5
+L66: .string "yltgneaabkxt"
+lea X21, r7
+L67: .string "jyaptfvfpox"
+L68: red X21
+clr r0
+
+stop
+L69: .data 141, 849, 870, -439, -246, -634, 14, -564
+rts
+add #-127, r0
+red X7
+mov *r5, L119
+jmp L59
+bne X18
+sub X23, r1
+stop
+stop
+L70: dec r1
+rts
+
+; comment
+jsr *r2
+add *r1, r7
+dec *r7
+prn *r5
+mov #-209, L51
+jsr *r3
+add X8, *r3
+clr *r5
+inc *r0
+stop
+L71: inc r1
+L72: add *r3, r2
+red X6
+dec L102
+mov X4, L48
+L73: .string "nnzmrnkkvhrmskjowv"
+L74: dec r0
+L75: prn L82
+inc *r6
+red r7
+; comment
+red *r1
+stop
+mov #216, r7
+dec X20
+clr *r7
+L76: .data -915, -799, 9, -815
+L77: .data 870, 326, 443, -822, -736, 633, 999, -100
+lea X4, *r5
+jmp X11
+jmp *r5
+L78: stop
+L79: not X12
+cmp r1, *r3
+inc L255
+dec *r5
+stop
+jsr L214
+rts
+lea X2, r5
+lea X7, L55
+not r4
+L80: add *r5, r6
+jsr *r3
+add #-134, r0
+mov *r6, *r5
+L81: .data 859
+L82: rts
+inc r3
+rts
+sub X18, X7
+L83: rts
+not r4
+jsr L190
+L84: inc r7
+L85: .data 950, -672
+L86: stop
+sub r0, L63
+L87: inc L29
+jmp L50
+sub r5, r5
+rts
+L88: clr X23
+clr *r7
+L89: sub r6, L185
+bne L126
+add L145, X15
+L90: .data -897
+mov L236, L136
+sub *r3, L19
+not L121
+add *r3, r0
+
+L91: red r6
+cmp L29, *r2
+sub L53, r2
+dec L14
+rts
+
+stop
+L92: inc *r6
+L93: stop
+add *r3, r7
+L94: sub r4, r5
+L95: add #-132, r4
+stop
+not r3
+
+red r4
+L96: sub r0, L0
+jsr *r3
+rts
+lea L87, r1
+prn #-238
+stop
+inc X0
+mov *r3, L186
+sub r6, *r2
+stop
+sub r5, r6
+L97: sub #-236, *r1
+L98: sub *r4, L251
+L99: stop
+cmp #243, *r3
+L100: rts
+jsr *r0
+L101: .string "cygwlygxyohm"
+jsr *r2
+L102: jmp L84
+bne X15
+L103: cmp #133, *r2
+jmp *r1
+add r0, X19
+cmp r0, X13
+red r3
+L104: stop
+lea L153, X4
+clr *r3
+lea L26, L55
+L105: prn r6
+; comment
+clr X21
+rts
+L106: red r0
+inc X7
+sub r3, r4
+bne X21
+L107: sub r5, r7
+jsr X19
+jsr X8
+L108: inc r6
+not L79
+L109: clr r0
+add *r7, X2
+rts
+prn #-75
+jmp X20
+add #99, X16
+L110: stop
+add r5, r3
+rts
+add X13, L60
+
+mov L244, r1
+L111: .data -924
+sub #-12, L60
+
+L112: cmp *r1, L104
+cmp *r3, X5
+dec L171
+dec r0
+not r3
+; comment
+sub *r0, *r4
+; comment
+clr X1
+L113: jsr X5
+bne X19
+rts
+prn #175
+
+jsr L265
+dec *r3
+jmp *r0
+sub #-66, L217
+bne *r1
+L114: .string "lvkzcrkhepqhhj"
+
+not r4
+L115: jsr *r7
+clr r2
+inc *r2
+stop
+
+prn r7
+L116: cmp *r0, r6
+
+rts
+cmp #-58, r5
+L117: inc L45
+mov X11, L19
+sub #192, L72
+add #-134, X7
+red *r5
+jmp X18
+sub L255, r0
+dec r3
+L118: jmp *r1
+L119: not X13
+sub #-165, *r5
+
+L120: .string "z"
+cmp #120, *r3
+dec r3
+bne X8
+cmp r1, L186
+bne X10
+; comment
+inc X17
+clr *r1
+inc X9
+L121: cmp L169, r1
+bne *r1
+inc *r1
+rts
+L122: not *r1
+; comment
+stop
+bne X23
+jmp X3
+jmp *r6
+lea L107, X5
+red r4
+sub L61, L203
+L123: bne *r5
+red r0
+jsr L159
+prn X0
+
+not L114
+red X13
+clr r3
+L124: .string "hwvfbyxmotbsnyk"
+jsr *r4
+lea X1, *r3
+L125: .data 104, 393, 248
+lea L181, X19
+lea L238, L250
+bne L135
+cmp #-40, L7
+cmp r0, *r1
+L126: jsr X1
+L127: inc L39
+jsr X10
+prn #33
+L128: red L188
+dec *r3
+mov #94, X6
+; comment
+jsr X1
+stop
+L129: rts
+mov #219, r0
+cmp *r0, #107
+sub r4, X20
+rts
+L130: lea X16, *r6
+L131: prn r3
+jsr L216
+sub X13, *r4
+mov #-206, L155
+prn #87
+stop
+prn L271
+not X13
+stop
+L132: lea X9, *r3
+L133: mov r6, X22
+L134: add #-65, r3
+cmp L72, L86
+prn *r2
+stop
+mov X21, *r3
+jmp L87
+L135: add r1, r0
+sub #-12, L108
+dec L7
+L136: prn #105
+L137: .data 801, -838, -98, -995, -97, -87, 859
+lea L169, *r2
+jmp *r5
+bne L243
+prn r3
+lea L226, *r6
+sub #-46, L234
+cmp #-186, r2
+clr *r4
+; comment
+mov L246, *r3
+L138: jsr *r1
+red *r5
+
+cmp #128, #156
+clr *r3
+L139: cmp *r1, *r5
+L140: rts
+jmp X15
+jsr X12
+not L79
+L141: .string "wvtlacknzezxcoycioevtw"
+; comment
+red X14
+red r1
+not *r4
+clr *r1
+jmp L224
+L142: cmp *r5, L231
+jmp X3
+L143: jsr *r3
+L144: bne X5
+rts
+dec r7
+red r2
+jsr *r5
+dec X4
+; comment
+inc r7
+L145: .string "bvodkoszfzagiukn"
+L146: stop
+L147: .data -946, 377, -369, -922, 580, 406
+sub #195, r3
+L148: .string "edqdlktvmeqvhu"
+jsr *r5
+lea X21, *r0
+prn #134
+red r4
+
+L149: .data -609, -790, -985
+red *r1
+L150: .data 778, 305
+bne *r5
+L151: add #88, L157
+red X13
+
+L152: .string "hliawimjhegmo"
+sub *r0, *r1
+not *r5
+rts
+L153: .data 800, -624, -441
+L154: .string "rhaqu"
+L155: lea L7, r4
+lea X16, L248
+cmp *r5, X18
+lea X3, *r6
+jsr L0
+red r7
+L156: bne L25
+L157: sub *r5, L55
+cmp r1, r1
+jsr *r2
+lea L246, *r0
+sub #182, *r3
+jmp X1
+L158: clr L168
+jsr L222
+jmp L170
+cmp *r4, r6
+cmp #-201, X3
+add *r5, r2
+L159: prn *r0
+L160: .data 72, 383, 784, 112, -949, 813, 985
+lea L189, r7
+stop
+L161: clr X6
+jsr L231
+L162: cmp #246, X18
+L163: add *r4, X21
+L164: cmp #178, *r3
+cmp #-246, r6
+inc r6
+prn r3
+jsr L185
+inc *r0
+; comment
+not r3
+cmp X23, L139
+clr r5
+stop
+L165: not r3
+cmp L126, r3
+rts
+red *r2
+L166: dec r0
+L167: stop
+rts
+L168: .string "qynsiycwrwfvzjzrsr"
+not r7
+red r2
+stop
+bne L14
+L169: .string "dwora"
+lea L85, r6
+L170: not *r3
+L171: inc X1
+clr L236
+L172: bne *r0
+L173: sub *r7, *r5
+L174: lea L189, *r6
+L175: .string "hmbmfpbfbqnbcuwhq"
+dec *r1
+sub r3, *r4
+add r3, r5
+; comment
+
+rts
+jmp *r1
+jmp L120
+jsr *r5
+L176: stop
+prn #23
+sub #-82, r2
+; comment
+bne *r3
+L177: dec L267
+sub *r7, X19
+; comment
+not r2
+sub X18, *r7
+L178: cmp *r4, X22
+not L94
+prn L242
+L179: rts
+rts
+prn r4
+not r6
+bne X16
+L180: lea L230, *r7
+red *r7
+
+L181: mov L83, *r1
+inc *r0
+L182: .string "ndrzzzzjbjfnkmer"
+red r2
+red X21
+L183: bne L187
+cmp *r3, *r0
+rts
+L184: bne *r6
+jmp *r6
+rts
+lea L88, X20
+L185: jsr X3
+jmp *r4
+add r6, r6
+dec r0
+inc L165
+dec L229
+red *r0
+clr *r0
+not L191
+mov L221, X16
+jsr L203
+jsr X13
+red r4
+L186: .data -316, 506, 529, -103
+mov r1, L215
+stop
+L187: sub *r7, r6
+
+L188: prn *r1
+L189: .string "pluqrsnbeutfgdsfmgvky"
+not X1
+add #235, *r7
+lea L179, *r7
+mov #138, *r5
+L190: mov #-112, r7
+lea L202, *r7
+add *r7, X8
+cmp #108, r2
+bne *r3
+cmp *r7, *r4
+dec *r5
+jsr X18
+L191: .string "xvahlmdlwldepxkdhheb"
+sub L165, r3
+mov r1, L209
+L192: lea L111, r3
+inc X15
+prn #-7
+prn r1
+inc r1
+L193: .data -610
+lea X5, r2
+L194: .data -524, -398, -762
+L195: dec r1
+L196: .string "kbieexzvobhzyxvsuknpi"
+mov r0, r7
+L197: .data -589, -43, 548, -163, -327, 76
+L198: .data -271
+inc *r1
+not *r4
+bne *r6
+bne *r4
+cmp X24, X10
+inc r5
+L199: .string "tjxgti"
+L200: .data 503, -892, 594, 729, -633, -849, 205
+not L197
+L201: clr L26
+L202: jsr X12
+L203: add *r4, X12
+clr *r6
+rts
+L204: mov #5, *r4
+L205: mov #-119, r2
+jmp X9
+inc *r0
+bne *r2
+sub *r7, *r3
+add *r7, *r1
+dec *r6
+rts
+rts
+mov r5, *r1
+L206: not L96
+lea X14, *r4
+add L230, *r7
+add #148, L6
+L207: .string "xopc"
+L208: .string "xtsepimqjk"
+L209: add r4, *r1
+add r2, *r1
+bne X8
+; comment
+L210: .string "bdnrmhztopfvhywdnzqvhuo"
+bne L247
+L211: .data -596, -79, 137, 441, 884
+red *r1
+stop
+L212: red *r0
+stop
+dec r6
+jmp *r3
+stop
+clr X14
+clr L115
+L213: dec L66
+red X16
+L214: .data -197
+jsr *r2
+prn #227
+L215: mov #-88, r6
+L216: jsr L48
+sub *r6, r7
+L217: .string "cycmmgvbgxiqwsjomgfctcvb"
+lea L247, r7
+dec r6
+cmp r1, *r1
+
+L218: .string "jtliyzryxmdgntp"
+L219: cmp #-145, r3
+bne L219
+red r6
+bne L123
+prn X12
+inc *r5
+L220: .data -140, -676, 274, 137, -297, 681, -458, -36
+inc L138
+jsr *r4
+red L269
+cmp *r2, r4
+L221: bne *r0
+L222: stop
+L223: .data -244
+; comment
+inc r3
+rts
+L224: red L0
+add *r7, L236
+lea L226, r0
+L225: prn r5
+; comment
+sub L267, X2
+red r0
+; comment
+L226: cmp *r4, r4
+add L241, *r5
+add r6, r5
+prn *r7
+L227: prn #-168
+stop
+rts
+jsr *r6
+red *r2
+rts
+L228: rts
+L229: jmp L257
+L230: stop
+
+mov *r2, *r6
+prn r2
+rts
+L231: bne X9
+mov r3, *r1
+dec r7
+add *r7, *r4
+; comment
+clr r3
+lea L231, *r2
+add r7, *r3
+L232: bne X6
+cmp #-96, r2
+bne X0
+add r5, *r2
+rts
+L233: dec *r6
+bne X11
+mov r1, *r2
+L234: .string "taybwzscawy"
+L235: prn #46
+prn r1
+L236: sub r1, *r3
+jsr *r2
+not r7
+prn r4
+dec X1
+jmp *r7
+L237: jsr X2
+not *r2
+
+L238: .string "bkyvcbfxbtdos"
+jmp *r3
+L239: .data -939, -346, 415, 394, -256, 270, 567, 4
+inc r4
+rts
+not L260
+rts
+dec *r6
+L240: jsr *r2
+not L102
+mov #11, L260
+rts
+sub r1, *r5
+stop
+
+sub r6, r2
+sub #185, *r2
+stop
+L241: jsr X8
+prn #-25
+jsr *r1
+add L196, X0
+clr r1
+L242: .string "hvyj"
+sub X9, *r4
+inc L265
+sub L272, r2
+inc *r0
+inc X17
+rts
+cmp L200, r6
+prn *r1
+
+lea X22, *r4
+L243: .data -660, 530, -825
+jmp *r1
+not *r1
+rts
+red r6
+bne L244
+stop
+L244: jsr *r6
+sub X24, L269
+mov *r3, r2
+L245: .string "knvdxqgfqaisiigx"
+stop
+prn *r3
+not *r7
+inc *r5
+L246: .data -970, -519, 718, 605, 686, -458, 347, -180
+prn r3
+L247: rts
+stop
+jsr *r3
+L248: stop
+jmp L264
+mov #-144, *r3
+; comment
+jsr X18
+L249: bne *r1
+jsr X5
+clr *r0
+clr L252
+rts
+L250: .string "mbez"
+jsr L255
+clr r0
+L251: bne *r2
+prn X16
+clr r7
+L252: .string "y"
+sub #94, *r2
+add r5, *r5
+dec L164
+; comment
+L253: add #-33, r1
+L254: sub L271, *r0
+L255: bne X17
+bne L140
+inc X16
+L256: cmp *r1, #-103
+L257: .data -146, -335, 309, -74, 977
+jmp L268
+lea L261, r3
+jsr L271
+clr r6
+; comment
+inc r4
+bne X12
+cmp *r1, X24
+L258: mov #-18, L95
+sub #-3, r4
+L259: cmp L269, L55
+L260: not r5
+mov #-155, X8
+stop
+jsr X0
+lea L271, r2
+not r6
+L261: inc *r1
+L262: prn #18
+jsr *r4
+L263: .data 563, 504, -221, 818, -656, -221
+rts
+dec r7
+add *r1, r4
+L264: rts
+sub r3, *r5
+lea X4, L72
+L265: rts
+red L267
+L266: jmp L268
+red L115
+cmp r4, #130
+L267: lea L108, X7
+bne *r4
+sub L64, r1
+not L269
+L268: dec *r6
+jmp *r2
+sub r6, L271
+dec r4
+L269: sub #41, *r5
+L270: lea L42, *r5
+lea L112, *r1
+jsr *r6
+L271: not r7
+jmp L272
+mov #-150, *r6
+L272: .data -598, 587, -809, -86
+stop
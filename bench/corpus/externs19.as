@@ -0,0 +1,1043 @@
+; Generated by genCorpus --seed 20
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+L0: .string "ww"
+clr L147
+inc X14
+L1: stop
+prn r7
+prn r0
+lea L1, *r6
+L2: not L229
+mov *r3, *r5
+L3: prn #126
+L4: .data 522
+sub X7, r4
+jmp L0
+rts
+; comment
+
+red *r6
+L5: mov r6, X6
+clr r6
+lea L120, r3
+L6: bne *r0
+red L199
+mov #242, L0
+rts
+not r1
+L7: mov #-29, L69
+L8: bne L62
+cmp *r3, r2
+add #-166, L51
+L9: bne *r1
+jsr X24
+sub L88, *r0
+sub #228, r7
+lea X4, r5
+lea L0, r0
+prn L152
+L10: mov #-185, r6
+stop
+; comment
+bne X15
+jmp L9
+not r3
+L11: bne *r3
+L12: lea X17, *r5
+L13: lea L10, r5
+dec r4
+L14: .string "ybvbrcvljhmfff"
+jsr L76
+sub r7, *r6
+clr r6
+rts
+mov #-208, *r1
+lea L106, X4
+clr r2
+red L3
+red *r5
+red r2
+rts
+sub *r3, *r5
+bne L13
+inc *r6
+dec r2
+inc r7
+stop
+bne X24
+jsr X17
+L15: inc X22
+add #231, r3
+stop
+stop
+L16: .data 507, -987, 808, 18, -789, -401, -275, -59
+cmp *r5, *r0
+rts
+inc L244
+stop
+L17: jmp L129
+rts
+clr L119
+L18: .string "b"
+dec *r2
+L19: jsr L17
+mov r7, *r6
+red r0
+not X12
+cmp *r4, *r2
+
+not r4
+L20: dec r2
+jsr *r4
+L21: jmp X21
+add #-255, L141
+cmp r0, X15
+jsr *r1
+cmp #203, L0
+; comment
+L22: jsr *r1
+L23: clr X8
+
+L24: jsr *r5
+L25: jmp X4
+mov *r5, r2
+lea L14, r0
+prn *r4
+L26: jsr *r7
+lea X22, *r7
+L27: .data -766, -657, -231, -299, 642, -54, -280
+not r7
+stop
+rts
+sub L39, L155
+stop
+red r0
+bne *r0
+cmp L6, X0
+dec r2
+cmp *r5, #75
+L28: prn *r3
+L29: rts
+L30: .data -963, -323
+L31: add r1, r0
+mov *r2, L158
+L32: .string "mwpn"
+bne X18
+; comment
+prn r3
+lea L30, *r1
+sub #-11, r3
+L33: rts
+inc X6
+dec *r6
+inc *r1
+dec L17
+prn r7
+bne X14
+lea L1, L24
+add X17, r3
+rts
+; comment
+jsr L29
+L34: add L67, *r7
+mov X16, X7
+add L15, r6
+L35: jsr L34
+rts
+L36: inc r7
+L37: .data -325, 315, -642, -525, -621
+L38: cmp r0, #174
+dec r4
+inc L126
+stop
+stop
+rts
+L39: add L114, *r0
+not X9
+L40: dec *r1
+prn #-68
+sub X4, *r3
+add *r1, *r0
+rts
+prn #-82
+clr r3
+prn X14
+not *r1
+bne L194
+L41: .data -917, 96, -703, -616, -12
+red *r0
+stop
+cmp r6, #-239
+L42: .string "yqyxnrvgkaicj"
+L43: sub *r3, r5
+prn *r3
+L44: dec r2
+L45: .string "lhrzurkrlypg"
+L46: .data 378, 807, -936, 437, -930, -686, 496
+L47: .string "oykmghmaocd"
+bne X8
+L48: inc *r3
+mov #-40, L134
+bne *r0
+lea L36, L24
+
+L49: add *r1, *r3
+lea L241, r5
+inc r5
+mov *r5, r5
+L50: .data 201, -446, -679, -435, 672, 298, 928, 796
+jsr *r6
+mov r2, *r0
+rts
+L51: not *r4
+clr L5
+red L210
+prn r2
+jsr X11
+lea X13, r0
+mov #132, r1
+L52: not *r4
+lea X21, r2
+sub #60, *r5
+stop
+L53: jsr L243
+sub *r2, r1
+clr *r4
+L54: jsr L19
+lea L152, *r0
+red L7
+L55: jsr X20
+clr *r4
+bne X16
+prn *r2
+cmp #210, #11
+prn X7
+prn #205
+add r6, X16
+L56: stop
+L57: add r5, X10
+jmp L138
+rts
+sub r1, r4
+lea L101, *r2
+red *r4
+mov r4, *r2
+stop
+; comment
+rts
+L58: bne *r1
+jsr *r4
+L59: cmp L203, *r5
+L60: clr r1
+clr r5
+bne *r5
+L61: prn #-126
+L62: .data 358, 529, 27
+dec L32
+L63: prn #-86
+add *r2, L237
+add r6, r0
+L64: red X20
+lea X19, r3
+add r7, *r6
+lea X7, L68
+L65: not r1
+sub *r3, X14
+cmp r4, #-188
+prn #220
+L66: clr *r1
+sub #-156, *r1
+not r6
+add r0, r0
+L67: add L152, X5
+jsr *r7
+rts
+sub *r7, L115
+cmp r6, L83
+jmp L182
+inc r1
+inc r1
+dec r7
+clr *r5
+L68: .data 824, -287, -923, 679, 28, 679, -186, 951
+jmp L97
+rts
+dec r0
+L69: mov *r0, *r0
+red L191
+inc L210
+rts
+; comment
+add *r2, *r1
+mov r6, X8
+red r2
+lea L117, L68
+L70: cmp #183, #104
+bne *r0
+stop
+rts
+L71: inc *r3
+rts
+L72: clr *r1
+cmp *r4, *r3
+lea L30, r1
+inc *r0
+jsr *r4
+L73: sub #-141, X12
+lea L174, *r6
+prn *r0
+add *r4, X24
+prn X14
+inc X8
+clr r6
+bne *r5
+L74: jmp *r7
+red L220
+L75: .data 500, 366, -582
+stop
+not *r0
+
+dec r4
+clr r2
+rts
+lea X14, r0
+sub r7, X7
+mov L146, L21
+L76: lea X19, *r4
+inc *r6
+L77: .data -312, 33, -747, 913, 122, -237
+L78: mov r5, *r4
+L79: jsr X23
+lea L18, X23
+L80: .data -626, 583, -142
+clr *r6
+inc r0
+stop
+stop
+add r7, *r7
+rts
+L81: .data 11, -188, 954, 622, 299, 218
+L82: jsr *r7
+bne L4
+; comment
+not *r2
+rts
+L83: cmp X0, r4
+L84: prn r0
+cmp L117, *r1
+inc X20
+L85: .data 554, -284
+prn r2
+not r3
+L86: jsr *r2
+L87: dec L35
+not *r3
+inc *r2
+lea X10, r4
+lea L229, *r5
+L88: stop
+lea L21, r7
+dec r2
+bne *r0
+lea L41, *r1
+L89: not *r6
+sub L61, *r0
+sub #96, *r6
+cmp r7, X17
+stop
+rts
+bne *r6
+clr r1
+inc L35
+red r2
+lea L220, *r2
+rts
+jsr X1
+L90: red *r5
+
+not L80
+sub #59, L56
+cmp #219, *r0
+inc X19
+L91: red *r2
+cmp r3, X24
+inc r6
+rts
+lea L234, L143
+clr *r5
+L92: .data 281, 824
+L93: .data 759, 302, -703, -467, 356, 445
+prn L119
+mov r3, *r6
+L94: prn *r1
+L95: mov #90, L29
+dec r5
+jsr *r4
+not r3
+L96: .string "rqgx"
+
+dec X11
+L97: .string "qwkwqxbexsffzgatmt"
+; comment
+L98: cmp r0, L60
+not r3
+add #-88, *r5
+clr r4
+bne X11
+L99: .data 102, 600, 699
+
+red *r6
+stop
+L100: clr r0
+jsr X22
+cmp L88, L222
+L101: jsr L203
+inc L217
+mov r6, r6
+not L60
+jsr L63
+add #-193, X12
+dec r4
+L102: clr *r6
+L103: sub #83, *r0
+dec *r4
+inc r5
+clr X20
+cmp #-69, r0
+L104: rts
+sub #-24, X23
+cmp X11, r6
+L105: bne *r7
+stop
+mov *r0, *r1
+L106: red r3
+add L6, L148
+jsr X1
+L107: .data 639, 280, 64, 904, -548, -545, -319
+L108: .data -581, 634, 569, -814, -661, -525, -356, -758
+jmp *r3
+clr *r3
+cmp L103, *r3
+clr X1
+sub L209, r2
+dec *r2
+dec r1
+L109: .string "ekomsrknioxrdiplrarig"
+prn r5
+add *r4, X20
+
+prn r4
+mov *r6, r0
+jmp L215
+prn L20
+jsr *r5
+bne X6
+sub #57, r2
+sub #-24, *r7
+clr *r0
+rts
+add *r0, *r1
+not *r0
+bne X9
+; comment
+L110: .string "cypkykjjvnpyuyemios"
+cmp r5, L181
+mov *r1, *r5
+clr r4
+sub #212, X19
+not r4
+L111: .data 69, -38, 681, -423, 490, 7, 840
+L112: lea L156, L78
+stop
+L113: .string "wghx"
+bne L164
+red *r6
+jsr *r5
+dec *r4
+dec L14
+L114: add r2, r4
+L115: dec r2
+rts
+jmp L178
+inc r7
+red X2
+lea L177, *r5
+add #-75, L30
+sub L15, r0
+prn *r0
+add X24, r6
+L116: red r7
+cmp #89, L64
+L117: .string "gxawlihrxea"
+jmp X1
+lea L59, r6
+mov L241, X15
+mov *r2, X6
+add #13, r2
+lea L163, r6
+lea L165, L94
+L118: rts
+inc r1
+clr r3
+inc L44
+sub r3, *r2
+L119: rts
+L120: .data -866, 115, 381
+lea X19, r2
+red L97
+L121: prn L201
+
+clr *r6
+jmp *r6
+lea X3, *r3
+L122: sub *r6, *r1
+L123: .data -254, 658
+rts
+jmp *r1
+stop
+rts
+stop
+L124: clr X18
+L125: mov X2, r7
+red X4
+red *r2
+red *r3
+lea L164, X21
+inc L89
+L126: bne X14
+
+dec *r2
+; comment
+L127: .data 28, 418, -471, -794, 156, 380, 276
+clr r6
+L128: stop
+dec r2
+not *r4
+L129: jmp L17
+dec r7
+lea L144, r2
+L130: not *r7
+L131: mov *r1, X23
+L132: add r3, L10
+jmp X18
+not *r1
+mov r0, *r2
+L133: .data -185
+L134: .data 346
+dec L134
+L135: jmp L213
+L136: jmp L103
+cmp r1, *r7
+sub r1, *r5
+
+red *r7
+L137: .data -716, -998, 274, 631, -595, -539, -91, 243
+L138: .string "gbodlerwkxwj"
+L139: inc *r4
+bne X19
+not r6
+sub r7, *r1
+sub #182, *r5
+L140: dec X14
+clr X6
+lea X5, X7
+cmp #67, X21
+jsr *r4
+L141: .data -323, 283, 532, 674, -167, -24
+inc X18
+lea X2, r3
+mov *r2, *r2
+jsr *r0
+sub #-189, r4
+L142: jmp X23
+dec *r0
+prn r1
+cmp *r5, #-93
+prn r0
+add r4, r3
+; comment
+stop
+not X24
+L143: mov #-16, r5
+mov L186, X16
+bne L22
+bne X13
+cmp X7, *r5
+not L96
+L144: prn r1
+
+clr X1
+sub r3, X5
+L145: inc L150
+cmp X9, *r0
+L146: .string "nsktnpsjokcagj"
+sub r7, r0
+L147: clr X14
+L148: cmp L132, #-203
+L149: jmp X13
+inc r2
+prn #234
+L150: .data 108
+mov *r1, r1
+
+clr r2
+; comment
+not r0
+mov *r3, L29
+jsr *r6
+jsr X17
+red *r6
+jmp *r1
+jsr L26
+cmp r5, r1
+L151: jsr *r3
+L152: mov r3, X15
+L153: .string "detjoaiip"
+sub r7, X4
+dec L69
+not *r0
+not L54
+L154: bne X19
+L155: inc *r6
+prn L239
+rts
+jmp L180
+inc X20
+L156: cmp *r5, L236
+jmp *r4
+stop
+mov L188, *r3
+L157: cmp X24, #-193
+clr L110
+mov #-238, r3
+sub X7, *r7
+sub *r5, X11
+jmp *r0
+bne *r2
+inc *r4
+bne X6
+bne *r5
+clr r0
+stop
+L158: .string "aayacqqzjbs"
+stop
+L159: .data -318
+L160: .data -422, 425
+sub r1, *r4
+not *r1
+lea X23, r0
+rts
+stop
+L161: .string "zqcdrohowsabnlbadnlto"
+cmp #-142, *r5
+cmp X9, #10
+cmp *r7, r4
+sub #191, r1
+prn L142
+L162: cmp r6, #141
+lea L95, L165
+bne *r6
+L163: mov *r0, X13
+rts
+L164: jmp *r3
+mov #-81, r3
+lea L103, r3
+inc *r5
+cmp L18, *r4
+
+L165: cmp #1, *r7
+L166: jsr *r7
+prn #130
+L167: .data -86, 717, -323, 247, 137
+; comment
+prn *r1
+rts
+not *r6
+mov r5, X8
+mov #238, r7
+red *r4
+red *r6
+lea L223, L99
+stop
+stop
+bne L82
+
+L168: .data -381
+inc L128
+add X19, L235
+red L240
+L169: .string "jvzhmwlkxscyh"
+; comment
+stop
+
+inc r2
+L170: rts
+sub X8, *r3
+jmp *r6
+jsr *r1
+L171: .string "cghfaqp"
+sub r1, r5
+L172: not r4
+stop
+rts
+; comment
+L173: dec L135
+cmp r1, *r1
+not r0
+L174: not r7
+L175: dec L182
+L176: .string "kosqdfsnnmpbitbkwhd"
+red r5
+red *r4
+prn L223
+L177: cmp #-198, r7
+L178: jsr *r1
+
+not X17
+L179: .data 485, 506, 18, 329, 839, -646
+L180: stop
+dec r2
+inc r3
+prn X10
+cmp r4, *r0
+dec X21
+L181: .string "pu"
+jsr X22
+; comment
+bne L41
+L182: .data -987, 568, -130, 480, -884
+cmp #-193, r1
+add L184, r7
+rts
+lea X14, L221
+not r0
+
+jmp L157
+dec L231
+L183: jmp *r7
+L184: add r6, r0
+red r5
+L185: prn r7
+add *r7, r0
+inc r0
+jsr *r1
+L186: .data -603, -687, -37
+inc r7
+L187: .data -986, 473
+dec r2
+sub L123, X8
+stop
+jmp L125
+jmp L221
+cmp L223, r2
+rts
+inc r7
+jsr L231
+cmp r1, L234
+lea L134, L181
+jmp *r3
+L188: red r3
+bne *r5
+L189: jsr L174
+not r7
+stop
+dec r7
+add r1, *r6
+clr r5
+bne *r3
+cmp *r0, r2
+rts
+clr r1
+L190: dec L47
+dec X11
+L191: .data 575, -557, -847
+red r6
+inc *r4
+rts
+clr *r6
+L192: jsr X17
+red L41
+mov r0, *r3
+bne *r4
+L193: jsr L224
+not L69
+not *r2
+L194: .data 286, -687
+inc L203
+rts
+L195: .data 307
+L196: .data -647, 595, 153
+not r4
+prn *r3
+bne X15
+stop
+; comment
+inc r4
+dec r4
+; comment
+L197: rts
+not r1
+bne L156
+rts
+rts
+L198: dec *r3
+lea X22, *r1
+cmp #-32, #-158
+red L146
+bne *r4
+L199: .data -285, 322, -733, -187, -680, 540, -656
+cmp *r2, #252
+clr *r0
+
+L200: .data 725, -538, -25, -956, 731, 798, -453
+; comment
+L201: dec *r6
+L202: .data -44, -371
+cmp #140, L234
+inc L231
+lea X3, L112
+inc L248
+L203: add #-68, *r5
+sub #-60, L187
+rts
+L204: lea L74, L224
+stop
+cmp r6, r3
+red *r7
+dec X2
+sub #139, X0
+jsr *r0
+L205: bne *r2
+cmp *r4, r4
+clr r4
+rts
+inc r6
+cmp r4, *r1
+L206: cmp X4, #32
+L207: lea X7, *r5
+
+L208: red r2
+bne *r3
+not L83
+L209: .string "jp"
+L210: clr *r1
+add L236, X1
+rts
+stop
+rts
+L211: .data 445, 115, 371
+stop
+sub X23, *r4
+dec r0
+not L242
+inc L31
+mov r3, r7
+mov L130, *r4
+L212: .string "cigzaivkyawrbpaepzr"
+inc r3
+cmp X12, *r7
+sub L122, L69
+L213: dec *r1
+sub #197, *r6
+bne L236
+stop
+inc X0
+rts
+sub X13, L23
+dec *r6
+not L71
+not L235
+L214: .data -618, 418, 164, -153, 267
+L215: not X11
+lea X7, *r7
+add r1, L225
+not r1
+clr L246
+cmp X3, L125
+L216: add X20, L224
+mov r4, L165
+mov r4, *r3
+clr r0
+stop
+L217: dec *r1
+mov #73, *r2
+sub L145, L225
+L218: rts
+L219: jmp *r0
+L220: red *r3
+sub #-128, r0
+add r0, *r5
+stop
+L221: inc L89
+bne *r2
+inc r0
+jsr *r6
+sub *r3, *r1
+jsr *r5
+L222: .string "djovnfefibkgcqepodwere"
+sub *r3, r1
+L223: stop
+lea L113, *r7
+add r7, *r5
+lea X16, X21
+inc r7
+prn *r2
+bne L217
+jmp L182
+dec L225
+jsr X11
+L224: bne *r7
+cmp r3, *r4
+L225: .string "ltannejptsalan"
+add r7, r7
+L226: rts
+L227: .string "bvlczijzuwd"
+L228: prn *r6
+prn L159
+cmp *r4, #202
+L229: add #187, *r6
+sub r2, r5
+; comment
+lea L248, r1
+L230: jsr L243
+L231: mov r7, L146
+not *r4
+
+inc *r0
+inc L161
+L232: .data -542, -291
+lea X13, *r6
+not r4
+L233: add L244, X4
+; comment
+clr r2
+prn L142
+rts
+bne *r1
+red r4
+red *r5
+jsr *r0
+red *r4
+L234: sub r1, L47
+mov r4, L218
+L235: .data -541, -765, -853, 759, -389, -677, 702
+L236: jsr X20
+bne *r4
+inc *r4
+L237: clr L58
+mov r2, L238
+sub *r5, r2
+clr X15
+
+red *r3
+inc L245
+stop
+cmp L246, *r1
+inc r5
+not L149
+lea X2, X21
+prn r6
+rts
+prn *r6
+lea L135, r4
+inc r0
+sub r1, L241
+dec r5
+L238: .data 663, -431, -586, 368, -376
+L239: rts
+mov X6, r2
+rts
+jmp L228
+lea L41, *r1
+L240: dec *r5
+not X0
+mov r6, X17
+inc X16
+; comment
+rts
+lea L245, r3
+L241: stop
+jmp X19
+lea L93, L79
+; comment
+L242: add L150, *r2
+dec *r0
+not X4
+L243: .data -796, -622, 213, 998
+lea L247, *r0
+clr r5
+clr *r5
+cmp *r5, r2
+cmp *r0, X18
+not L89
+bne *r1
+rts
+red r7
+lea L244, *r1
+; comment
+clr *r7
+add r7, *r5
+clr *r6
+; comment
+jsr *r0
+inc *r0
+L244: cmp #-37, #-99
+cmp #-170, X5
+prn r0
+jsr *r4
+L245: .string "uexzjqffsqlqaecnkyygid"
+add *r7, L247
+sub X2, *r2
+red L246
+; comment
+dec L129
+
+L246: not X2
+cmp r7, X18
+stop
+L247: cmp #104, #152
+L248: inc *r0
+dec *r2
+inc r6
+sub r0, X7
+stop
@@ -0,0 +1,1043 @@
+; Generated by genCorpus --seed 3
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+sub r5, L75
+L0: .data -528, 537, 956, 759
+clr r5
+add L196, r3
+cmp #-238, r5
+L1: .string "liklnncvwexutiurivwohh"
+L2: .string "dnkqbhqwxew"
+clr *r5
+mov *r1, r1
+prn *r7
+stop
+add #-238, r6
+red r1
+L3: clr *r3
+
+L4: .data -491, 945, -401, 781, 365, 294, -131, -434
+
+rts
+stop
+inc *r4
+add L3, *r1
+prn r7
+rts
+L5: mov *r2, r3
+L6: .data 167, 59, 874, 934
+prn #59
+jmp L186
+L7: prn L6
+clr r5
+prn r4
+L8: stop
+L9: add #-64, *r4
+inc *r2
+rts
+stop
+cmp r2, X7
+rts
+bne *r5
+
+clr X9
+mov L101, *r2
+sub X16, X16
+bne L112
+
+
+lea L204, r7
+add X9, *r4
+red *r7
+clr L2
+L10: .string "azvmzlphwd"
+
+sub r1, r7
+cmp #118, *r2
+L11: .data -160, 192, -432, 13, -822
+bne X2
+L12: .data 603, 196, -250, 488, -68, -754, -812
+L13: stop
+
+L14: cmp L121, r3
+L15: .string "hprnwykvqthhid"
+; comment
+L16: jsr *r4
+jmp *r0
+inc *r2
+stop
+; comment
+add L237, r5
+bne *r7
+L17: prn *r2
+; comment
+red *r0
+cmp X1, L43
+red L227
+not r6
+prn r5
+L18: .data -852, -476, 691, 35, -100, -382, -889, 439
+dec *r2
+bne *r0
+L19: .data -63, 754
+add r3, *r3
+add *r5, r2
+inc L25
+bne *r6
+inc L149
+sub *r0, r2
+L20: .string "hunlkteyjqbvqewb"
+; comment
+
+sub #-241, L205
+L21: prn r4
+jmp L211
+jsr *r2
+cmp *r2, X12
+L22: lea X24, r7
+L23: jmp *r3
+L24: .string "orzswrueqafvy"
+jsr L126
+lea L241, L37
+not *r0
+L25: bne L74
+; comment
+clr X14
+stop
+add *r3, X9
+
+inc L11
+jmp X5
+clr r0
+prn L3
+
+L26: cmp #121, X6
+sub r0, X11
+inc r4
+bne L33
+rts
+not r1
+lea L115, L0
+
+mov r0, *r3
+not *r3
+prn r0
+stop
+L27: .data -953, -368, -871, 978, -770, -163, -66, 857
+jmp X14
+red r5
+L28: .string "urivgfhbknnqnfmtnz"
+prn *r0
+stop
+clr L61
+rts
+clr L91
+L29: jmp *r7
+inc *r7
+L30: .string "uyyxectvtula"
+add *r7, L19
+mov L27, r4
+bne *r6
+prn X18
+cmp X1, r7
+cmp r0, r3
+clr *r5
+
+L31: add L66, r1
+clr X23
+stop
+L32: .string "gmgvpuwpdeswfgzgxx"
+inc X14
+L33: .string "nwr"
+jmp *r5
+jsr L180
+clr L195
+jmp *r5
+bne *r2
+L34: .data 93
+jsr *r2
+rts
+L35: .data -866, -308, -329, 452, 593, 496, -33, -73
+lea X13, r6
+prn *r4
+clr *r4
+L36: clr *r1
+L37: jmp L6
+stop
+red *r4
+L38: rts
+stop
+stop
+dec L27
+stop
+sub *r7, r2
+L39: .data -488, 731, -974, -866, -16, -265, 404, 371
+clr X0
+clr L63
+clr L162
+mov L41, X9
+lea X20, L25
+L40: stop
+L41: .data 3, 57, 880, 233, 824
+; comment
+bne *r6
+sub *r3, r0
+L42: inc *r3
+add L104, *r1
+dec r2
+sub #-254, *r7
+stop
+jsr *r6
+L43: clr r0
+jmp X18
+L44: red r3
+add L37, r6
+L45: sub *r1, L26
+prn #193
+L46: lea L43, L124
+prn #255
+L47: red r7
+add #109, *r5
+bne L49
+not L217
+lea L225, X0
+L48: .data 802, 113, 607, -425
+stop
+lea X3, *r3
+L49: not r0
+jmp L144
+red L128
+bne X4
+dec X5
+inc L106
+L50: .string "fotbjihaoqydwdqlbceygn"
+mov #89, *r4
+dec *r3
+prn r4
+clr *r3
+L51: jsr *r1
+jsr L70
+bne *r6
+inc *r7
+L52: .data -916, -103, 504, 153, 597
+jsr L2
+jsr L94
+cmp *r4, r1
+cmp *r1, *r4
+prn *r7
+
+dec r3
+jsr X18
+add #-249, *r5
+dec *r3
+inc r2
+clr *r7
+not *r0
+add *r5, X1
+cmp L39, #161
+L53: prn #-95
+L54: add X12, X11
+sub *r5, X4
+red *r5
+red L57
+jmp X1
+lea L18, r3
+dec L231
+L55: not r4
+not r2
+rts
+dec *r1
+lea L223, *r2
+red r4
+L56: dec *r6
+cmp L128, #55
+rts
+bne X3
+red r1
+
+sub r2, X13
+rts
+clr X10
+L57: .string "pcwcmvznyzaplvbqdppdpdf"
+red L46
+L58: clr r6
+mov L243, r6
+L59: .string "fkftsmrffjmc"
+L60: .string "qrpyplbamrwp"
+clr X17
+stop
+L61: .string "iosjxxjmgnmozoeslmsh"
+L62: stop
+red r7
+cmp L34, r1
+stop
+L63: cmp X21, L198
+clr r7
+cmp #-28, #171
+jsr *r4
+L64: .data 595
+rts
+lea L65, *r5
+not r7
+dec X8
+L65: .data 411
+clr r7
+not r5
+L66: jsr L154
+dec r4
+mov L64, X16
+jsr X15
+jsr X22
+cmp X20, r6
+L67: sub r4, *r3
+jsr L45
+lea X21, r0
+L68: not r7
+stop
+mov r2, *r0
+sub X16, *r4
+red *r2
+cmp #41, *r0
+L69: stop
+prn *r3
+stop
+rts
+mov X24, *r2
+bne L31
+clr L37
+stop
+mov r2, *r6
+clr *r0
+stop
+jmp *r0
+L70: mov r4, L84
+jsr L162
+prn r6
+
+dec r6
+stop
+dec r3
+L71: .data 796, -402, 313, 473
+rts
+sub L34, r1
+jsr X17
+red *r5
+not r0
+not X16
+rts
+red L58
+L72: cmp r6, *r6
+rts
+stop
+L73: .string "phvbshflyhtvmgohxz"
+rts
+stop
+dec L51
+jsr *r7
+cmp L198, #-147
+L74: .string "cetiaqkvmgnvw"
+sub r6, L82
+L75: .data 342, -418
+L76: .data -480, -438
+inc *r4
+jsr L236
+jsr *r0
+red r1
+; comment
+inc *r6
+L77: rts
+cmp *r0, X14
+mov L200, r7
+inc L36
+L78: jmp L29
+mov #-118, *r6
+dec *r7
+L79: add L129, *r7
+L80: prn #-233
+lea L183, L105
+L81: .data -52, 789, 411, 651, -306, -496
+stop
+L82: rts
+L83: bne *r2
+inc *r2
+jsr L14
+dec r2
+stop
+prn r3
+rts
+L84: .data -364, -588, -611, -551, 805, -28
+L85: .string "fwngxrrclqbujtaipz"
+L86: .data -326, -896, 684, -981, -83, 140, -877, -16
+stop
+L87: clr *r6
+jsr L101
+red *r1
+not L95
+prn r5
+prn #244
+bne X1
+stop
+jsr L73
+clr L57
+stop
+stop
+dec L46
+bne *r4
+add #51, X23
+sub r6, *r5
+prn *r6
+inc X20
+red r5
+add *r7, *r5
+L88: not *r7
+L89: not *r5
+stop
+sub *r3, X16
+jmp L90
+red L78
+cmp r7, #67
+L90: bne *r6
+rts
+cmp r7, *r6
+L91: jmp *r1
+mov *r6, L103
+L92: bne *r3
+L93: add L75, *r4
+prn *r5
+mov L6, X6
+red *r7
+L94: .data -154
+L95: jmp *r0
+L96: mov X0, *r1
+lea X13, *r0
+sub r4, L178
+prn #237
+prn r7
+bne *r4
+sub r1, r7
+inc *r2
+dec *r7
+lea L93, r5
+jsr *r0
+sub *r7, *r4
+dec r0
+red X19
+prn r2
+inc *r3
+add #-246, L1
+lea L167, *r5
+L97: .string "gvr"
+add *r1, *r3
+lea L54, r5
+jmp L48
+jsr L228
+not X11
+stop
+dec *r1
+stop
+L98: .data -714, -317, 314
+L99: .string "dizefvdjcxgigypfzq"
+red L243
+inc *r3
+add L152, *r7
+L100: .data -476, -361, 148, -545
+jsr X0
+add *r1, L222
+L101: .data -213, 58, -37, -563
+jsr *r2
+inc r4
+L102: .data -327, -26, 531, 872, -956, 850
+L103: sub r1, r0
+L104: jsr X5
+L105: .data 47, 214, 165, -192, 569
+clr *r1
+bne X4
+clr *r4
+rts
+L106: lea X4, L50
+not L92
+jsr X23
+sub r4, L205
+jsr *r0
+prn #248
+L107: jmp L155
+L108: stop
+L109: .string "xvbjfzwpjgqkfmjmdzaifqwx"
+bne X22
+L110: lea L82, r0
+sub *r2, *r3
+jmp *r0
+lea L175, *r4
+L111: jmp L70
+; comment
+lea L42, r2
+prn #-215
+L112: .string "el"
+not X9
+lea L81, X18
+prn *r1
+prn *r6
+clr r7
+inc *r1
+cmp #72, X10
+L113: prn r6
+L114: jmp *r2
+cmp r1, *r5
+red r6
+mov #-215, L71
+mov r5, L41
+L115: stop
+L116: clr *r1
+clr *r0
+bne L240
+bne *r0
+inc L32
+L117: rts
+jmp X3
+sub #-199, *r5
+jmp X4
+add r1, X23
+L118: jmp X5
+dec r2
+jsr *r0
+stop
+clr X16
+red *r1
+L119: rts
+dec r0
+jsr *r4
+jsr L84
+mov r2, *r4
+not *r3
+not *r1
+jmp *r7
+clr r7
+lea X21, L47
+jmp L207
+stop
+mov X24, r2
+jsr X3
+red L50
+L120: add L110, *r4
+prn X22
+L121: red r2
+L122: .string "yyrzyfbfvtrdzb"
+clr *r4
+red r6
+cmp r7, r3
+L123: .data -801, -286
+not r4
+lea L211, X4
+jsr L119
+L124: .data 810
+
+stop
+red X12
+red X3
+L125: .data -543, 801, -780, -200
+L126: .data 678, -823, 762, -347
+L127: .data -277
+not *r5
+stop
+bne L31
+cmp *r6, L146
+stop
+jmp *r2
+jmp X7
+cmp #-50, X6
+L128: jsr *r3
+add X8, r3
+lea L224, *r5
+lea L229, *r3
+L129: rts
+L130: rts
+mov X22, r0
+L131: .data 626
+
+stop
+stop
+cmp #-6, X18
+prn r7
+inc L4
+add r7, *r1
+inc r2
+jmp X13
+L132: .string "xwvrgpflkqfgmvy"
+inc X14
+not r7
+L133: clr *r4
+prn L126
+jsr X16
+add *r3, *r1
+L134: .string "ggx"
+not *r7
+mov #18, X21
+L135: add *r6, *r2
+rts
+L136: .string "iiizibptmtcylbuczupzvq"
+clr *r7
+prn *r7
+jmp *r4
+red *r0
+L137: .data -382
+rts
+
+sub X0, *r4
+L138: .string "kcspfkhkznfxkpch"
+cmp *r3, #95
+L139: jsr *r5
+L140: dec L165
+lea L20, r3
+clr r1
+rts
+red X2
+; comment
+bne *r1
+lea L110, *r7
+inc *r5
+L141: rts
+not L221
+dec r1
+bne *r7
+add L116, r1
+jsr *r6
+clr *r0
+L142: .string "mqjhlftlw"
+jsr *r4
+red r1
+; comment
+not r2
+jmp L218
+clr r4
+L143: .data -282, 219, -995
+prn X13
+not r1
+L144: .data 35, 631, -928, 322, -192, -311
+jmp *r6
+stop
+prn r7
+L145: not r2
+L146: .string "msfimvjgadosubs"
+L147: jmp *r7
+L148: .data 206, -171, -76, 260, 269, 167, 196, -220
+prn #-171
+cmp #-166, L42
+L149: red *r0
+add *r4, r3
+add *r2, X14
+sub r1, r2
+lea L237, *r6
+rts
+L150: rts
+L151: clr r0
+L152: .string "szbnsizxqtoncpfvfijlkqit"
+not r2
+inc *r1
+bne L189
+
+not L136
+clr X14
+stop
+L153: .string "ggnblx"
+prn L115
+cmp X3, #229
+cmp L42, r6
+lea L97, r3
+L154: stop
+not L143
+bne *r4
+dec *r0
+; comment
+red *r4
+bne *r2
+not L22
+red *r2
+L155: red X22
+clr *r5
+L156: jmp *r2
+L157: dec r5
+rts
+bne *r1
+L158: .data -179, -580, -171, -737, 26, -780, -263
+; comment
+jmp L224
+jmp *r3
+jsr *r4
+not *r6
+jmp X20
+L159: not r4
+jsr *r5
+stop
+cmp *r7, #45
+add *r3, r5
+L160: .data -421, -390
+jmp L157
+clr r7
+dec X22
+clr *r4
+sub #53, *r7
+mov #-215, r6
+jsr X6
+red *r6
+L161: inc X6
+L162: .data -166, -609, 21, 857, -477, 159
+jsr *r1
+bne X18
+L163: rts
+L164: .data 381
+jmp *r3
+L165: dec L225
+mov r3, r4
+sub *r4, *r4
+lea L244, r7
+jmp *r6
+stop
+jmp X11
+jmp L94
+L166: sub *r1, r2
+jmp *r4
+; comment
+prn r2
+L167: not *r7
+L168: stop
+prn #149
+
+L169: .data 42, 478, -870, 989
+stop
+jmp L63
+L170: dec L25
+mov L240, L27
+
+cmp r3, L233
+red r1
+jmp *r1
+lea L192, *r0
+add *r0, L97
+add #-148, *r4
+L171: red r2
+jsr X15
+L172: jsr *r4
+lea X3, r0
+bne X11
+clr r7
+bne L112
+clr *r0
+sub *r2, L42
+sub *r4, r7
+L173: rts
+cmp X14, #114
+L174: rts
+lea L143, r2
+L175: red *r5
+L176: .data -416, -283, -326
+stop
+mov L197, r1
+lea L205, r3
+not L41
+clr r7
+dec *r2
+red *r1
+prn r5
+not *r3
+jmp *r3
+mov #-253, *r4
+sub r3, X24
+add L57, r7
+inc L190
+prn r4
+L177: red X6
+red r2
+sub L20, r0
+rts
+mov #-200, r7
+lea X6, *r5
+rts
+L178: add #210, r7
+cmp L90, #-203
+L179: stop
+L180: .string "d"
+L181: lea L52, r4
+L182: .data 21
+red X19
+; comment
+dec r2
+bne X0
+L183: sub X23, r7
+dec *r2
+rts
+rts
+inc L34
+jmp *r4
+bne *r2
+prn #134
+inc *r7
+jmp L31
+
+red X22
+L184: .data 217, 506, 187, 312
+lea L101, L46
+L185: .data -675
+L186: clr *r4
+mov #-186, *r1
+jsr L189
+jsr L192
+inc *r6
+cmp *r1, *r3
+L187: sub X16, X21
+L188: cmp #-219, *r5
+not *r3
+cmp *r6, #55
+prn L181
+bne X4
+L189: .data 778, 897, 802
+inc r4
+L190: add r7, X7
+cmp r3, #-157
+red r7
+
+lea L197, X7
+clr X17
+prn #25
+L191: prn *r1
+L192: .data 215
+L193: jsr *r2
+
+sub r6, *r4
+dec r0
+L194: .string "gfsywfmwnqodhzdimbbpa"
+L195: mov #-23, r4
+clr r7
+inc *r7
+L196: rts
+red r0
+not r7
+jmp *r0
+
+cmp L67, #198
+lea X24, r7
+rts
+jsr X16
+L197: .data -665, -810, -415, -234, -899, 588, 91, 80
+cmp #32, L212
+L198: bne *r6
+lea L144, X9
+mov *r3, L210
+cmp r3, #146
+L199: prn r1
+L200: .data 371, -898, -995, -512
+L201: .data 751, -47, -36, 677, 256
+L202: .data 515, 898, -747
+prn X5
+stop
+L203: prn L197
+L204: .string "oidgagazuorpaflcpgatk"
+rts
+not X3
+prn *r2
+not *r4
+L205: .string "martwhdjayffpqggflw"
+jsr *r2
+sub r7, *r5
+jsr *r0
+jmp *r2
+not *r3
+L206: .data 312, -82, -989, -340
+L207: cmp *r3, *r3
+stop
+L208: stop
+lea L195, *r5
+L209: mov #-212, r2
+
+clr r7
+L210: dec r3
+add r7, r2
+bne L107
+stop
+L211: .data -920, 278, 323, -283, 832, 363, 656, -791
+stop
+not L227
+dec *r4
+cmp #92, *r2
+not L43
+rts
+sub #90, *r4
+mov *r5, X15
+clr *r0
+L212: .string "wdohimhc"
+L213: .string "wluunalepqxvfabugarub"
+not X7
+prn *r7
+mov L232, *r4
+lea X22, X3
+sub L96, r0
+prn r6
+mov *r5, *r6
+jmp *r6
+inc r3
+L214: inc *r6
+; comment
+mov r4, r1
+cmp L224, #219
+cmp #119, *r7
+bne *r4
+L215: sub #244, *r0
+mov r1, *r7
+L216: .data 375, -565, 883, -41, 110
+sub L223, L149
+L217: lea X12, r5
+dec r1
+mov L220, *r6
+L218: sub r6, *r5
+prn L243
+prn #247
+jsr *r7
+mov r3, L232
+L219: stop
+red *r3
+not *r3
+L220: sub *r6, *r7
+stop
+prn *r1
+add X20, *r0
+L221: cmp X18, #161
+L222: .data -333, -402, 696, -967
+L223: add r6, L114
+L224: add r0, X3
+prn *r0
+not r5
+L225: jsr L244
+add #-34, *r3
+stop
+bne X19
+mov #-95, r4
+jsr *r3
+bne X24
+mov r6, L40
+L226: .string "jttagfbcozpwzwcds"
+jsr *r5
+
+jmp *r0
+jsr *r6
+L227: rts
+L228: .string "ck"
+prn L168
+sub *r4, *r7
+L229: clr *r5
+mov #-76, *r1
+add #-89, *r0
+not L6
+dec L24
+inc L240
+; comment
+inc *r7
+inc *r7
+inc X6
+sub *r5, r0
+jsr *r4
+cmp L103, #65
+prn X23
+rts
+prn L244
+prn #41
+; comment
+stop
+L230: mov r3, r0
+dec L26
+L231: clr X23
+; comment
+add X9, *r3
+L232: .string "fxerctfpx"
+sub L229, r1
+jsr L124
+inc *r7
+
+jsr X8
+stop
+cmp *r6, #-131
+L233: .string "lxfobkqrbpkk"
+red r4
+jsr *r6
+bne L238
+red *r4
+stop
+prn r2
+clr *r7
+add *r0, r5
+jmp *r0
+clr X11
+not *r3
+stop
+cmp *r3, r2
+L234: .string "qrgqrkoozobcw"
+cmp L133, L240
+L235: prn r4
+jmp *r7
+not *r7
+not r4
+add r6, X2
+jmp *r5
+jmp *r2
+bne *r0
+L236: sub L239, r5
+lea X1, L133
+L237: prn #-214
+stop
+L238: add r4, r3
+not r3
+not *r6
+mov X2, *r6
+L239: lea X18, r6
+L240: .data 648
+L241: cmp r2, r4
+cmp r1, *r7
+rts
+dec r3
+L242: sub X3, r2
+jmp L243
+prn #168
+L243: rts
+L244: dec r0
+lea L81, L245
+mov #-46, r2
+L245: not X23
+cmp L189, r5
+stop
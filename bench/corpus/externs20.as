@@ -0,0 +1,1044 @@
+; Generated by genCorpus --seed 21
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+L0: bne X17
+stop
+jsr *r3
+mov r3, r4
+mov *r6, L0
+rts
+
+clr L0
+red X12
+
+L1: mov *r2, *r2
+L2: .data 481, 14, -229, -318
+dec r6
+L3: lea L179, *r7
+jsr *r6
+cmp L247, r2
+L4: rts
+bne X17
+jmp L169
+inc X11
+not r4
+dec r4
+; comment
+red *r7
+L5: .string "kytjgw"
+mov #-117, L1
+jsr *r3
+red L4
+dec r6
+clr *r7
+dec X16
+L6: cmp *r7, #50
+dec X15
+jmp L130
+sub r4, L179
+bne L170
+red r5
+red X7
+mov #118, r1
+L7: bne *r7
+L8: .string "fvdaqjurflvezrfsebtusnu"
+L9: .string "rlalptecrjemtrwmt"
+L10: .data 37, -379, 284
+L11: stop
+red X9
+prn X15
+stop
+L12: cmp L3, r7
+L13: .data 174, 911
+dec *r3
+dec r7
+red r2
+mov #-229, *r0
+bne *r4
+clr L7
+not r5
+jsr L225
+rts
+L14: add L5, r4
+lea X18, L6
+rts
+prn #103
+L15: add #165, r0
+rts
+red r4
+L16: bne L253
+inc *r5
+L17: .data 414, 752, -412, 37, -744
+L18: .data -443, 700, -656, -949, 676, -114, 895, 504
+prn *r7
+L19: jmp L3
+rts
+sub r2, r2
+L20: jmp *r5
+prn L8
+jmp *r4
+sub r3, X1
+L21: clr X18
+add *r5, L245
+L22: red r6
+mov *r7, L166
+not *r4
+not L16
+stop
+red r6
+sub r5, *r5
+rts
+sub r5, L147
+mov *r2, r2
+L23: cmp L13, r1
+stop
+mov r6, *r3
+L24: stop
+lea L136, *r1
+cmp *r4, r1
+L25: .data 442, -525, -678, -647, 850, -18, 767
+L26: add *r2, *r6
+bne X3
+dec L12
+add #-48, *r1
+; comment
+dec *r7
+lea X8, *r3
+L27: .data 220, -782
+
+L28: jsr *r5
+L29: cmp L21, #-89
+L30: red r5
+dec L12
+L31: jsr *r6
+lea L14, *r3
+L32: add *r6, *r1
+red L55
+L33: .string "rixgelkby"
+cmp *r5, *r3
+red *r3
+red r1
+bne L225
+add r4, *r1
+dec L27
+rts
+dec L31
+lea X2, L25
+mov *r2, r7
+inc r6
+sub r4, L7
+inc *r1
+prn #-228
+lea L50, L14
+clr r2
+; comment
+L34: .data -730, 259, -897
+L35: lea L35, L5
+L36: not r1
+lea L16, r2
+cmp #-130, *r2
+prn *r0
+lea L190, r7
+lea L33, L131
+L37: .data -925, -981, 890, -301, 84, 539, 390, -50
+
+jsr *r0
+L38: .data 516, 53, 723, -734, 548, -442, 789
+L39: .data 185, 509
+L40: sub L128, *r0
+add *r6, r5
+stop
+; comment
+rts
+add *r1, *r0
+stop
+red r4
+clr L16
+jmp L23
+prn L38
+jmp L154
+inc X12
+jsr L96
+L41: .data -916, 57
+cmp #-234, r6
+L42: dec r6
+jsr X2
+lea X10, X0
+L43: .data -967, 688, -343, -337
+inc *r0
+prn *r5
+dec r1
+prn L36
+bne X7
+L44: bne *r0
+L45: .data -659, 595, 889, 309, 534
+jmp *r3
+not r0
+add #-246, X16
+mov *r5, r4
+rts
+L46: prn L206
+rts
+stop
+L47: .string "qsnlqwuhnhivawgmay"
+L48: .string "dtbcyvhcslpnjmepvxidbwc"
+rts
+not X6
+L49: cmp *r3, r3
+bne L13
+jmp *r7
+clr r6
+L50: .data -164, -9
+L51: prn *r4
+add L40, *r3
+clr r0
+L52: .string "tcuhmngjhqjacgsykhjxpp"
+L53: lea L73, L235
+jsr L40
+L54: .data 467, -676, -360, -883, -3
+not *r3
+L55: .string "wdcfvmvxp"
+dec r2
+lea L200, L128
+not r7
+L56: stop
+prn *r3
+rts
+jmp *r4
+L57: stop
+cmp X22, L27
+clr *r2
+jmp X7
+rts
+L58: .string "zhg"
+rts
+jmp L198
+L59: jsr L39
+mov L0, r0
+add r6, r4
+clr X10
+L60: lea L209, *r0
+not L159
+bne X17
+jmp *r3
+cmp X2, X15
+add *r5, L58
+bne L183
+not L27
+L61: jmp L28
+not *r2
+red L54
+jsr X15
+inc L30
+sub #-78, *r3
+dec r1
+L62: .string "pgqya"
+inc L0
+rts
+L63: not r2
+; comment
+cmp #176, r6
+L64: sub X4, L86
+mov *r0, *r4
+L65: .data -304, -525, 661, -122, -773, 274
+stop
+L66: bne *r4
+L67: mov #113, *r3
+lea L47, *r2
+sub L112, *r2
+clr r6
+mov L41, L69
+
+mov r3, L19
+L68: red r7
+L69: .data 463, -738
+sub r2, X14
+jsr *r1
+jmp L50
+clr L11
+L70: bne L3
+red L77
+inc r4
+add L197, *r0
+clr L224
+jsr *r6
+L71: stop
+mov #-126, r2
+sub #183, L95
+sub *r5, r6
+L72: .data 324, 450, 483
+red r1
+cmp r7, r3
+mov #120, X2
+jmp *r7
+prn r6
+sub #94, *r6
+prn *r6
+cmp r0, r0
+not r7
+sub #107, *r3
+not r3
+L73: jsr *r4
+mov #-36, X6
+add r5, *r5
+stop
+jsr *r5
+cmp #-230, #125
+clr L232
+
+L74: not *r5
+stop
+not r7
+rts
+L75: bne L48
+red *r5
+L76: jmp *r7
+red X9
+
+lea L7, L15
+L77: .data 498, 453, 289, 798, -358, 392, -342, -591
+sub #-137, *r3
+bne L189
+sub #129, X6
+add #-16, r1
+L78: dec L0
+red L61
+not *r5
+L79: .data -304, -618, 471, 111, 597
+cmp #216, r1
+inc *r7
+L80: dec r3
+
+bne *r1
+not *r7
+stop
+L81: rts
+cmp *r4, *r6
+rts
+; comment
+jmp *r5
+L82: clr *r7
+inc *r2
+L83: .data -563, -868
+mov *r2, *r1
+L84: bne L31
+mov *r1, *r6
+clr r5
+
+clr *r4
+; comment
+red *r1
+rts
+L85: .data -947, 360, 87, 632, 5, -539, 954, -460
+dec *r6
+inc X7
+dec L17
+cmp r3, L92
+L86: not L81
+L87: .string "cxykxrsrcefsvhftkn"
+red *r0
+lea X22, *r2
+add *r0, L3
+rts
+dec r4
+; comment
+mov #3, L73
+sub X13, *r6
+; comment
+stop
+prn *r4
+dec *r6
+
+L88: dec r4
+add L16, *r4
+jsr L5
+L89: .data -906, 398
+
+lea L37, r6
+inc r4
+add *r6, *r1
+clr *r4
+clr X19
+not r2
+L90: add r0, X20
+sub *r3, r0
+cmp #254, X24
+rts
+mov *r2, r4
+not *r0
+not r4
+lea X13, r6
+mov #-199, r1
+prn #14
+
+L91: .string "dn"
+L92: lea X1, r5
+cmp *r6, *r2
+L93: .data 955, 119, -111, 801, -232, -317
+jmp *r7
+jmp X3
+red *r4
+mov r6, *r6
+prn X1
+cmp *r6, *r4
+L94: prn *r7
+rts
+cmp r6, *r7
+dec *r5
+rts
+red r7
+red *r6
+stop
+red *r2
+sub X19, r7
+lea L94, *r2
+inc r1
+jmp *r5
+add X18, L41
+sub #-189, *r3
+red r7
+L95: red r4
+not r1
+lea L250, X21
+not *r0
+sub #241, *r1
+prn L176
+L96: red L104
+add #241, X12
+cmp r6, #-192
+jsr *r0
+not *r7
+not L161
+L97: .data 322, 517, 808, -361, -792, 533
+sub r4, r6
+red *r6
+L98: red r0
+L99: clr *r4
+L100: .data 632, 653
+dec *r0
+L101: prn r6
+stop
+L102: inc r2
+dec r3
+L103: mov L97, *r5
+prn L11
+inc *r0
+cmp X12, L185
+inc X13
+bne *r3
+stop
+lea X2, X23
+L104: .data 827, -86, -50, -54, -316, 238
+sub *r3, r1
+jmp *r0
+L105: lea X2, r4
+jmp L211
+L106: mov r7, r3
+L107: inc *r5
+add r1, r7
+L108: rts
+L109: .string "ckypslyqrvmkxdwgh"
+clr *r6
+prn *r2
+jmp *r0
+rts
+rts
+clr L19
+rts
+prn X5
+L110: jsr L58
+inc r2
+L111: jsr *r6
+prn #-8
+
+bne X24
+stop
+bne *r4
+jmp *r5
+sub #18, *r1
+L112: .string "nzqnkscssjawvosut"
+; comment
+cmp *r0, L107
+rts
+lea X9, *r0
+mov #-125, L243
+add L129, X21
+L113: clr L179
+not r2
+L114: inc *r7
+L115: bne *r2
+stop
+jsr L134
+add #143, r3
+L116: sub X23, r3
+L117: .string "kkatehpanxhrkpvbdjbgzlwi"
+L118: jmp *r6
+dec X6
+L119: .string "ishcuijdzcc"
+lea X12, *r3
+L120: dec *r6
+red *r3
+L121: .data -955, 501, -33, 701, 682, -607
+mov #-3, *r3
+not r7
+inc r3
+L122: not L2
+L123: prn r3
+
+L124: mov X7, X18
+inc X12
+red *r6
+dec r7
+rts
+prn r7
+L125: .string "qwijlc"
+cmp *r2, X14
+cmp #1, r7
+sub #-206, *r2
+L126: .data 205, 162, 493
+not r4
+stop
+clr *r7
+L127: .string "aiuew"
+bne *r2
+L128: cmp r0, r5
+lea X10, r1
+bne L203
+L129: dec *r0
+red r5
+L130: .data 517, -212, -368, -40
+L131: .data -122, 993, 787, -161, -383
+jmp X7
+L132: .data 783, 397, 325, 586, 22, 672, 558, 550
+inc X4
+cmp #107, r5
+L133: .string "ikojfswlscwr"
+lea X13, X8
+dec X20
+bne *r7
+inc L30
+lea L86, *r6
+clr *r6
+lea L199, r5
+L134: inc r6
+stop
+L135: mov #-35, r3
+; comment
+add *r2, *r0
+mov r7, r4
+L136: cmp X8, #-48
+; comment
+prn *r2
+not *r4
+jmp *r5
+dec L78
+L137: .data 571, -876, 115, -97, 944, 851
+prn *r2
+cmp #-191, *r0
+rts
+clr r4
+L138: sub #-189, r1
+dec *r3
+jmp *r6
+red L134
+; comment
+red X24
+lea L172, *r6
+L139: .string "jbmkbxjmydemrko"
+; comment
+lea L211, *r6
+stop
+stop
+lea X11, L153
+add L197, *r6
+
+red L84
+L140: clr *r7
+prn *r5
+; comment
+not r7
+L141: bne L112
+red r2
+bne L89
+; comment
+L142: .data -274, -374, 614, 659, -365, -712, 151, 377
+L143: .string "qlxput"
+clr L160
+rts
+L144: red r6
+mov *r1, L74
+L145: .data -453, 77
+jmp L141
+L146: .string "mpmgmbkibxgfysfwaxts"
+rts
+not *r2
+prn X22
+L147: jsr *r2
+; comment
+not L182
+inc X3
+L148: .data 855, -841
+L149: red L202
+bne X5
+L150: dec r3
+L151: inc r7
+L152: cmp #-132, L157
+L153: cmp L123, *r6
+L154: jsr X9
+L155: add #219, X2
+jmp X8
+jsr *r3
+L156: lea X17, L141
+jmp *r0
+jmp *r1
+jmp *r6
+not X13
+not *r0
+jsr *r0
+rts
+not *r7
+L157: rts
+sub r3, r3
+add *r0, *r0
+red r6
+jmp L189
+bne *r2
+mov X13, r2
+L158: mov *r3, *r5
+L159: dec *r7
+not *r7
+prn r4
+L160: cmp *r5, r4
+mov X5, L166
+
+bne X10
+prn *r5
+add X24, *r4
+L161: .data 752
+L162: clr X0
+lea L198, r3
+cmp L202, r4
+jmp L43
+jsr L41
+mov #122, *r7
+L163: jmp *r1
+bne L24
+red *r5
+jmp *r5
+dec r3
+mov r6, r4
+L164: .data 747, -665, -819
+bne L209
+jsr *r2
+red *r6
+clr *r4
+add *r5, *r6
+not *r5
+L165: dec *r7
+L166: .data -610, 376, 63, 147, 960, -416, -949
+; comment
+lea L75, *r1
+L167: bne *r2
+lea X14, *r7
+L168: cmp X7, #-106
+L169: not r1
+inc *r5
+
+lea L248, *r5
+L170: .string "kl"
+mov r4, r1
+L171: sub *r0, r0
+rts
+not L6
+L172: .data 731, -564, -346, 454
+mov *r6, X13
+stop
+clr *r4
+rts
+L173: clr *r5
+L174: red *r0
+rts
+prn *r4
+clr *r7
+red L260
+bne *r0
+add L0, L63
+L175: lea L238, *r7
+L176: .data -66, 582, -519, -915, -746
+prn L7
+bne *r6
+L177: .string "kqxcpewvjzwkbceaghpnsmue"
+add *r0, *r1
+red X4
+L178: stop
+L179: bne X6
+
+L180: jsr *r1
+L181: red *r6
+stop
+prn r2
+mov #-45, X14
+L182: .string "puldozksoqunqskjjf"
+bne L225
+cmp #-221, r5
+rts
+sub *r3, *r2
+L183: red X6
+jmp *r0
+L184: jsr *r6
+prn *r3
+jmp L208
+add #61, *r2
+L185: add *r6, X2
+not X8
+prn *r5
+add L245, *r7
+L186: not X16
+L187: .string "bkysxoeckdabzbbrnshkq"
+sub r0, r5
+cmp r7, *r1
+lea X21, *r1
+not L241
+lea X11, X24
+red L36
+stop
+jmp *r3
+L188: rts
+L189: .string "aucjrfxyz"
+red X2
+L190: stop
+cmp L214, *r1
+stop
+L191: .string "nvzsy"
+; comment
+clr *r2
+L192: .data 735, 229, -596, 371, -36, -578
+L193: red L248
+inc r0
+mov L255, L228
+not r3
+dec r2
+stop
+not r1
+rts
+jmp *r0
+L194: bne *r4
+inc X14
+jsr L57
+inc *r6
+; comment
+mov X20, *r4
+not r7
+clr r1
+red *r4
+red L219
+mov *r0, *r6
+stop
+add #-193, *r2
+jsr *r6
+stop
+prn r1
+lea X7, r0
+L195: inc X17
+jsr X16
+sub #183, *r0
+L196: dec X4
+; comment
+L197: prn #229
+L198: .string "df"
+mov X21, r3
+sub r4, *r4
+L199: stop
+cmp L12, r7
+bne *r4
+cmp L257, *r7
+red L256
+stop
+prn r4
+dec X12
+not *r6
+not *r7
+L200: jsr X4
+L201: not r3
+; comment
+bne X16
+L202: red *r4
+not *r0
+L203: rts
+L204: lea L154, L89
+cmp *r0, X13
+add r1, r5
+red L101
+clr r5
+not X11
+L205: lea L93, *r6
+L206: cmp X2, L216
+L207: sub *r7, *r4
+red L209
+inc *r2
+clr X19
+L208: .data -320
+dec *r5
+red L241
+L209: bne L238
+L210: prn r7
+lea L232, r2
+clr r1
+L211: .data 159, 226
+not *r1
+L212: .data -34, -31, -67, -609, -629, 988, -295
+stop
+L213: lea L112, r4
+lea X12, X9
+L214: red *r3
+jsr *r7
+L215: sub #132, *r1
+cmp #-7, L226
+bne *r0
+lea L259, r7
+add r4, *r1
+inc L217
+stop
+lea X15, r6
+prn #-129
+add #-193, X22
+mov #-28, X6
+prn r2
+L216: .string "nhhf"
+jmp *r6
+cmp *r7, X7
+L217: .string "nrvxtouzextrbcdbbygrcca"
+cmp *r2, *r5
+mov #53, r3
+mov r2, r0
+bne *r3
+sub *r4, r6
+stop
+L218: .string "yjcslwv"
+L219: .data 641, -588, 74, -241, 746
+add X2, L239
+inc L117
+L220: clr *r0
+mov #-160, *r1
+stop
+inc *r5
+rts
+L221: .data 987, 401
+sub X0, L248
+rts
+clr r0
+lea L75, L95
+bne L238
+inc X20
+jsr *r0
+stop
+dec r5
+inc L9
+sub X4, r3
+red r6
+bne L226
+L222: rts
+L223: sub X3, r5
+
+lea L122, L257
+clr r3
+bne *r2
+L224: jmp *r3
+dec r4
+add #-35, r1
+L225: .data -455, -961, 608
+dec *r7
+clr *r2
+prn #185
+prn L246
+rts
+L226: not *r7
+lea X23, r7
+jsr *r1
+lea X4, L254
+L227: inc *r3
+stop
+dec X20
+clr L182
+; comment
+inc r2
+prn X10
+L228: stop
+add #122, *r0
+L229: bne *r0
+jsr X14
+prn #209
+dec *r1
+jsr L67
+L230: prn *r7
+cmp L240, r7
+L231: jsr L6
+L232: cmp r7, *r0
+add r4, r3
+L233: bne *r6
+inc *r5
+bne L70
+inc *r3
+L234: prn #-26
+L235: .string "bdqtxclpkiukjv"
+clr r0
+sub *r5, r3
+stop
+L236: .string "aaxlrqjgp"
+L237: .string "kurqror"
+mov *r4, r0
+rts
+jsr *r6
+mov r5, *r7
+cmp #68, r1
+L238: dec X3
+dec r1
+red r5
+prn r0
+bne L245
+rts
+
+dec *r3
+inc *r6
+mov r4, *r7
+bne *r1
+add *r7, L260
+sub *r2, L148
+L239: not *r2
+red *r2
+sub *r4, *r1
+L240: .string "pzltpfeqzsgqpevg"
+not *r5
+stop
+L241: jmp *r6
+inc *r4
+red r0
+L242: clr *r3
+bne *r0
+prn L251
+stop
+lea X1, r0
+mov r5, r1
+inc *r6
+prn X3
+mov *r7, *r7
+L243: jsr X10
+jmp L254
+L244: dec r2
+jsr X2
+sub X3, *r7
+L245: lea L18, r2
+stop
+rts
+red *r5
+clr L248
+rts
+L246: dec r1
+not r1
+sub #-66, X10
+
+prn #-210
+jsr *r3
+L247: rts
+not X12
+L248: lea L220, L253
+red *r0
+rts
+clr L208
+mov #-38, *r1
+dec L186
+clr *r1
+add *r1, *r3
+inc X19
+L249: red r4
+prn *r1
+add *r7, L253
+inc *r6
+L250: .string "yrlhzctyd"
+clr L23
+; comment
+clr *r5
+L251: .data -479, 349, 104, -887, 238, 825
+L252: inc L195
+add r3, L257
+lea L259, r5
+prn #211
+L253: not r1
+prn #231
+lea L257, *r0
+not r0
+clr *r4
+add r0, r5
+add r1, L255
+cmp L180, *r2
+inc *r6
+lea L247, *r6
+L254: jsr X1
+red L253
+inc *r7
+L255: .data 87, 356, 990, -864, 999, 296, -592, -114
+jsr *r0
+bne L257
+; comment
+mov #-45, r7
+
+stop
+not X24
+not X20
+
+lea L23, r2
+sub r7, r2
+lea L62, r1
+L256: .string "esa"
+rts
+inc r6
+L257: stop
+cmp *r7, r6
+L258: red r7
+L259: stop
+red *r6
+rts
+L260: cmp r0, #-96
+red r5
+not r3
+stop
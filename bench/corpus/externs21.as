@@ -0,0 +1,1043 @@
+; Generated by genCorpus --seed 22
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+L0: clr *r5
+bne *r4
+jmp *r6
+L1: .string "jjkxe"
+prn X22
+L2: red L2
+L3: jmp L1
+L4: cmp X10, *r2
+
+red r0
+
+mov *r4, *r7
+bne L1
+jmp L169
+L5: sub r6, r7
+inc r6
+jmp L0
+L6: jsr *r5
+L7: .data 552, -411, -152, 27
+mov r4, *r2
+clr *r3
+L8: .data -274, 715, 594, 690, -924, -345, -193
+L9: inc *r2
+L10: inc *r6
+L11: not X14
+bne *r7
+stop
+add r7, X21
+red r6
+sub r2, *r4
+stop
+
+mov *r4, r6
+mov #39, L65
+not L230
+rts
+lea L5, X24
+L12: not r6
+mov r2, r0
+not X18
+red *r4
+clr *r1
+jmp *r6
+mov r3, *r1
+L13: inc *r1
+L14: red r5
+L15: .data 997, -288, 569
+not *r0
+
+sub L9, X19
+cmp *r7, *r3
+L16: cmp #139, *r3
+jmp X17
+add L13, X14
+L17: .data -836, -824, 880, 236
+
+L18: clr *r3
+lea X4, r2
+dec L228
+prn r4
+jsr L220
+inc X4
+bne *r6
+L19: jsr L65
+; comment
+sub L12, *r7
+not r7
+L20: cmp L63, #185
+not X22
+L21: bne *r5
+L22: .string "fettwroclbtlenv"
+add r4, L192
+jsr *r1
+not *r3
+prn L201
+mov L3, r5
+lea L15, L7
+L23: jsr L4
+cmp L211, X3
+L24: .string "vloyrehcncbrxazzdeykdzu"
+cmp #201, r0
+lea X0, *r4
+rts
+rts
+sub #58, L9
+rts
+sub #-199, *r3
+cmp L41, #85
+jmp *r0
+red r4
+cmp #181, #36
+jsr L24
+clr L184
+red r6
+L25: red L12
+lea L7, *r4
+not r2
+not *r0
+jmp *r0
+jmp *r4
+L26: sub #-185, r5
+mov r3, *r2
+L27: clr *r3
+
+
+stop
+L28: not *r7
+inc *r1
+L29: jsr *r2
+red X1
+jsr *r4
+sub r5, *r4
+cmp r6, *r5
+L30: add X24, L116
+mov r3, X6
+L31: bne L29
+bne *r2
+jmp L27
+add #97, L20
+L32: cmp L39, #16
+cmp *r1, #121
+lea L97, r0
+rts
+L33: .data -326, 686, -735, -428
+L34: mov r5, X21
+sub *r2, *r4
+L35: jsr *r6
+L36: red *r4
+rts
+cmp #-156, #-99
+L37: jmp *r4
+L38: bne L195
+mov *r2, r6
+L39: .data 439, 506, 500, -536, 655, -697
+mov #203, r4
+mov r7, X23
+mov X18, X11
+L40: stop
+sub #-82, *r0
+clr r0
+inc L6
+mov X6, L78
+cmp L199, L61
+L41: bne L7
+L42: rts
+dec L151
+sub r2, *r7
+jmp X23
+sub *r4, r1
+jsr X16
+L43: .string "gtmgxovvyujbxojugrat"
+bne L13
+inc *r3
+mov #150, r0
+L44: clr r3
+L45: clr *r2
+
+add L25, L89
+add X13, L8
+L46: .string "gargferoyurkzivvlajp"
+inc *r3
+rts
+not r7
+clr L35
+red L158
+jmp *r6
+sub r1, r4
+L47: inc X4
+; comment
+add L112, *r2
+lea L100, L4
+cmp r6, X15
+L48: clr L130
+L49: bne *r4
+inc r4
+stop
+L50: .data 369, 12, -451, -373, 446, -443, -31, -507
+red L165
+red r4
+red *r4
+clr *r7
+L51: .string "wuckbslmiayeqeu"
+L52: lea L43, X3
+not r3
+; comment
+add L8, r2
+L53: rts
+L54: inc L229
+rts
+prn *r1
+inc r5
+add *r1, X7
+inc r3
+L55: .data -714, -837, -892, 109, 828
+prn #244
+bne *r7
+L56: .data 336, -257, 283, -447, -653, -173, -538
+L57: lea L6, r5
+jsr L168
+; comment
+jmp X13
+L58: bne L99
+jmp *r2
+add *r7, r2
+prn X11
+inc X2
+L59: lea X14, r4
+lea X4, *r5
+cmp X8, X13
+clr *r1
+jmp *r5
+stop
+add *r1, L23
+dec X23
+cmp #-205, X13
+
+L60: lea L124, *r5
+L61: .string "odz"
+cmp #-9, L7
+clr *r5
+add r3, L163
+inc *r0
+add #-3, L43
+rts
+stop
+; comment
+bne X11
+L62: .string "efjau"
+bne L227
+dec X9
+stop
+L63: cmp r5, r7
+clr L36
+dec r6
+inc r4
+clr r3
+mov X24, L106
+rts
+lea L188, r1
+cmp r3, L44
+L64: dec r2
+jsr *r0
+red X21
+cmp X21, L121
+rts
+jsr L65
+dec *r7
+L65: .data -94, -868, -641, -714
+red *r7
+jmp *r4
+prn X18
+L66: jmp *r5
+mov #244, L121
+rts
+; comment
+L67: inc r3
+prn X4
+sub r3, *r5
+bne *r1
+rts
+L68: .string "jyozeyzsbifplynvnixhphx"
+clr L240
+not r4
+prn #182
+L69: lea X24, r5
+stop
+inc X13
+L70: .data 336, 753, -389, 174, -152, 251, 623, -646
+L71: prn #-182
+jsr L102
+cmp X2, *r0
+dec r0
+mov #-220, L184
+L72: bne L95
+cmp #-91, *r7
+jmp X16
+rts
+not r1
+inc X19
+jsr X23
+L73: not *r5
+bne *r6
+L74: red X14
+sub *r4, *r5
+L75: rts
+red r7
+prn r0
+add #219, *r0
+
+jmp X4
+mov #180, *r4
+sub r7, L102
+L76: .string "txlmizcbde"
+add *r2, *r0
+mov L137, *r6
+L77: .data -809
+dec *r7
+red *r0
+bne L66
+
+inc r2
+clr r3
+
+dec r7
+jsr *r3
+L78: red X10
+L79: mov #-184, L53
+sub X17, L152
+dec L214
+inc L50
+rts
+jmp *r1
+
+L80: cmp r7, r7
+jmp *r2
+inc r4
+bne X13
+dec L248
+L81: cmp *r4, *r4
+not L74
+add L129, L125
+mov #211, r6
+cmp r1, *r7
+clr L116
+L82: jsr X0
+mov #65, r0
+cmp #179, L32
+L83: lea X18, *r6
+L84: mov L122, *r2
+L85: add #143, r3
+cmp #-137, *r3
+jmp X6
+lea L225, *r5
+sub #212, r6
+stop
+add *r3, *r6
+stop
+clr L27
+dec L161
+prn #231
+L86: dec r1
+L87: prn X7
+L88: not r0
+dec *r6
+prn L24
+clr r6
+mov *r5, *r3
+jsr X9
+L89: .string "verkoswnvdf"
+jmp L33
+L90: not r7
+sub #50, r5
+sub L85, *r1
+L91: bne *r5
+jsr X13
+cmp r6, r1
+L92: .string "islnidhjov"
+sub L156, r6
+not X10
+inc r5
+lea L241, L18
+stop
+cmp #-118, *r2
+inc *r4
+cmp *r0, X7
+jmp L201
+L93: .string "uudizgbaywfqdnqhp"
+dec X20
+
+bne *r3
+L94: cmp L252, r2
+L95: .string "rl"
+L96: rts
+mov *r0, *r2
+L97: .data 921, 47, -326, -466, -758, 450, 932, 485
+clr r3
+L98: jmp X2
+L99: .string "zujdnxkunmsawjodqstemd"
+rts
+
+not r4
+L100: clr r0
+L101: bne *r2
+sub *r4, *r5
+stop
+
+stop
+red *r1
+stop
+clr r5
+bne L183
+L102: .data -361, -397, 233, 954
+add X19, r1
+add #-144, X16
+bne *r2
+L103: cmp #-139, #-8
+mov r3, r7
+red *r6
+prn L151
+L104: .data 98, -712, 180, 175
+inc L94
+
+jmp *r6
+dec r2
+stop
+jmp L56
+stop
+rts
+add r5, L90
+L105: .string "crkccopyulyptwbyiqzvuib"
+L106: jmp *r6
+L107: .data -543
+prn *r1
+inc X13
+sub r7, L112
+clr *r1
+sub L118, r6
+clr *r5
+L108: stop
+L109: rts
+
+cmp L136, *r3
+bne L217
+not r4
+bne X5
+not X10
+bne L175
+rts
+stop
+bne *r3
+not L242
+jsr *r1
+L110: .data 335, -74
+prn #-4
+L111: cmp *r2, r7
+clr *r1
+clr *r2
+clr r1
+L112: prn L205
+dec *r7
+dec *r0
+jsr *r4
+rts
+cmp #-115, L28
+jmp *r1
+inc L47
+dec L188
+dec *r7
+L113: red *r2
+jsr L16
+stop
+
+; comment
+bne *r6
+clr *r1
+bne *r5
+dec L2
+sub X11, *r6
+sub *r1, X21
+bne *r7
+cmp r3, L123
+cmp L128, L14
+L114: rts
+rts
+add #-89, L110
+L115: red *r7
+stop
+rts
+L116: .string "xbwzlcnrvdaeaf"
+prn #-155
+stop
+inc X11
+L117: .string "rdwwcb"
+
+not r5
+L118: red *r2
+; comment
+L119: not *r7
+prn #-95
+L120: .data -301, 498, -694, 368, -442, -372
+jsr *r7
+L121: .string "r"
+inc *r7
+rts
+jsr *r3
+prn #-96
+L122: .string "vkebgaekzz"
+inc r5
+
+stop
+L123: prn X3
+inc r2
+add *r3, r2
+L124: stop
+L125: .data 104
+clr *r5
+jsr L141
+bne L10
+L126: .data -189, 688, 512, -72
+not *r7
+L127: mov r7, *r7
+clr L225
+prn r6
+not r6
+dec r3
+; comment
+sub r4, X4
+L128: clr L60
+sub X20, r6
+L129: .string "xhtjbvqnnzbuuqdfca"
+cmp *r0, *r7
+cmp #171, r3
+sub *r3, *r5
+L130: .data -3
+lea L19, L170
+prn #236
+sub *r1, L90
+clr *r6
+sub #168, *r0
+L131: red L243
+prn L11
+inc *r6
+stop
+L132: mov r6, *r7
+bne L141
+red *r5
+sub #-106, *r6
+dec *r2
+jsr X3
+bne *r4
+clr *r7
+
+L133: .data -797, -357, 404, 802, 210, -712
+add #-30, L209
+L134: dec r5
+; comment
+mov *r7, *r7
+lea X4, L33
+bne *r2
+stop
+sub L118, L171
+prn L214
+sub #250, *r1
+cmp #93, *r0
+stop
+inc L183
+clr *r4
+clr L66
+inc X3
+lea X14, *r6
+prn #226
+mov X19, *r3
+rts
+cmp X18, r0
+jmp L105
+L135: .data 52, -984, 292, -677, 973, 766
+clr *r0
+jmp X2
+sub r0, *r0
+L136: bne L178
+jmp X8
+L137: jsr *r5
+mov *r2, L161
+L138: jmp L191
+L139: not *r5
+mov *r5, r1
+mov #107, X17
+inc L239
+
+red r2
+add *r0, r1
+L140: lea L8, r0
+cmp #111, *r3
+jsr *r1
+dec X6
+not r0
+rts
+stop
+prn r2
+L141: jmp *r3
+L142: bne L101
+bne L211
+bne *r3
+prn *r4
+clr r1
+red r5
+L143: bne *r5
+bne *r5
+mov *r5, *r3
+add r4, r5
+prn r3
+not r2
+clr *r7
+dec X7
+mov r5, *r4
+bne *r4
+inc *r6
+L144: sub L204, L86
+cmp L218, #41
+not X8
+jmp *r1
+jsr L26
+prn *r4
+L145: clr *r4
+jmp *r6
+rts
+
+L146: inc r1
+L147: bne *r7
+inc r3
+prn #-180
+not *r0
+L148: .data -687, 324
+rts
+L149: mov #-96, X1
+L150: inc X20
+L151: .string "ocejybstcwcvpcfgisr"
+
+dec *r1
+clr r5
+L152: sub *r1, r2
+L153: .data 494, -326
+bne L162
+sub #57, L211
+sub r7, r4
+inc r1
+bne X5
+jsr *r4
+red L234
+dec *r7
+L154: .string "tpjuxcfxwlwpxycosex"
+prn #-191
+lea L246, X23
+clr *r3
+lea L79, *r5
+L155: not *r0
+jmp *r4
+clr r7
+red *r7
+L156: .string "lqeishgppmxaqfs"
+
+rts
+rts
+inc *r7
+L157: .string "htlvyyfoghndpg"
+lea L8, *r7
+inc r3
+stop
+red r7
+; comment
+jmp X0
+inc L225
+clr r7
+prn r2
+sub *r0, X11
+clr *r0
+red X18
+L158: .string "ayle"
+L159: .data 153, 572
+L160: not *r5
+L161: .string "vzqdxuglki"
+clr *r0
+mov *r4, X3
+bne *r7
+red r1
+L162: jsr *r4
+jsr *r6
+L163: not *r6
+jmp L111
+prn r3
+dec *r6
+cmp *r3, X13
+L164: add L251, *r2
+; comment
+L165: clr r4
+lea X15, L31
+; comment
+cmp r7, r4
+
+; comment
+not X14
+cmp r0, #173
+rts
+red r5
+L166: .data 411
+L167: .string "fwcivhuzupry"
+mov #61, *r3
+dec L88
+clr r7
+L168: add L15, r2
+not *r2
+mov *r3, *r3
+cmp X11, L235
+dec X12
+cmp #186, #25
+inc *r0
+L169: stop
+L170: cmp *r1, *r6
+L171: .data 257, -141, -724, 278, -759, 724, -210, 358
+sub r1, r3
+clr r2
+stop
+clr r2
+L172: red *r7
+L173: clr r6
+L174: inc r0
+L175: rts
+L176: .string "beqvyemsvgprlgrogirnwhds"
+red L186
+sub X13, r7
+L177: .string "qtkxronifxhnxac"
+dec r4
+rts
+cmp *r0, r2
+L178: sub r2, L240
+lea L54, X19
+not r5
+sub #-190, *r0
+L179: .string "nmbrvqizyahvxcnx"
+prn *r2
+L180: .data -305
+rts
+L181: clr L89
+bne *r6
+L182: jsr *r5
+sub *r3, *r3
+stop
+L183: prn *r7
+bne *r2
+L184: .data -198, -512
+lea L191, *r1
+; comment
+rts
+red r3
+lea X5, r4
+cmp #185, X15
+prn r7
+not *r5
+L185: .string "hhbtmhnybpbmvsmcarwd"
+red *r7
+L186: not r4
+L187: dec L221
+rts
+L188: prn r0
+jmp L52
+L189: jsr *r0
+L190: .string "rlfdvxeffnhvd"
+sub *r6, L213
+prn #-167
+stop
+L191: .string "ytpsxrabrnyh"
+inc *r7
+L192: add #210, L239
+not X21
+
+add *r1, *r5
+L193: .data 484, 216, 210, 639
+; comment
+L194: .string "aquyaecbbvzftoiheimnla"
+not r1
+bne *r6
+L195: rts
+rts
+red X21
+cmp r4, *r2
+red *r6
+
+add *r0, *r4
+rts
+not r5
+mov #-256, X7
+dec *r0
+not X0
+
+sub X2, L199
+jsr L247
+cmp #198, *r5
+not r1
+stop
+L196: .string "gyhyjgaogy"
+L197: .string "bidiirandvh"
+add #-51, *r1
+prn *r7
+inc *r4
+not *r3
+L198: inc *r0
+jsr L227
+dec X12
+jmp L216
+L199: rts
+L200: .data 139, 851, 288, 376, 172, -985
+inc *r4
+L201: .string "zbvicvkazfiaaxjp"
+jsr *r0
+red X4
+add #-25, *r5
+red r4
+not *r2
+inc L233
+L202: .data -647, 223, 391, 146, -311
+L203: .data 909, 446, 22, -598, 362, -132, 770, -871
+jmp *r6
+inc r0
+lea L152, r4
+dec *r6
+mov *r0, X24
+rts
+add #-48, r7
+inc *r4
+add L232, X1
+rts
+
+L204: stop
+stop
+clr r0
+L205: mov X11, L128
+L206: dec r2
+L207: .data -288, 618, 258
+jmp L185
+stop
+
+L208: cmp r6, L98
+lea L235, X0
+L209: lea X12, *r5
+jsr L210
+
+cmp *r2, *r3
+L210: .data -356
+red L42
+inc r1
+L211: prn *r7
+L212: lea X18, X2
+L213: rts
+lea L250, r1
+L214: .string "wtutoxss"
+inc *r3
+mov #-6, r7
+lea L146, *r4
+prn L126
+jsr *r6
+L215: .data -865, 129, -598, 52, -77, 127, 616, -154
+mov #-110, *r5
+L216: .data -210, 763, 682, -434, -716, 611, 802, 148
+mov L168, r5
+inc r3
+inc *r1
+dec *r1
+prn #-63
+inc L121
+mov r2, *r0
+jmp *r0
+L217: add X16, r6
+clr *r3
+; comment
+not *r6
+mov r6, r6
+clr *r1
+; comment
+rts
+jmp *r2
+L218: .string "g"
+L219: lea L64, r0
+L220: .data 402, 971
+sub *r7, r5
+bne L235
+L221: sub *r3, *r0
+L222: lea L253, r2
+red *r5
+L223: cmp *r6, *r6
+dec *r4
+jmp L252
+add r6, *r7
+
+inc *r6
+L224: dec *r5
+stop
+L225: lea L242, *r3
+clr *r1
+L226: mov X23, r5
+L227: clr *r6
+sub r0, L216
+bne *r6
+jsr *r3
+; comment
+stop
+add L1, r4
+stop
+inc r7
+prn #172
+add L57, X5
+add #83, *r1
+sub L0, L242
+clr *r3
+prn *r6
+jmp *r3
+L228: prn #116
+L229: prn r4
+clr L247
+
+prn *r0
+red X8
+clr r2
+bne *r1
+not X22
+add r1, *r0
+stop
+
+cmp #-234, r7
+bne *r4
+L230: .string "csumvguwiaho"
+jmp X21
+L231: jsr L120
+rts
+cmp #64, #195
+jmp L245
+not *r3
+L232: not *r5
+L233: not r6
+L234: .data -20, 923, 621, 30, -161, 509
+bne *r0
+jsr L247
+inc *r6
+L235: dec r0
+add #65, r4
+bne X21
+clr *r6
+mov r0, *r6
+jsr *r3
+sub *r6, r4
+jsr X2
+mov #38, *r6
+prn #-241
+prn #-64
+L236: lea L250, *r4
+prn *r5
+not *r3
+sub *r1, r7
+L237: .string "cpybqtkftjbwsug"
+mov X9, L241
+not r4
+inc *r2
+bne X15
+stop
+dec X8
+L238: lea X18, r5
+jmp *r4
+L239: mov #-63, r6
+L240: dec X24
+prn #-199
+cmp #-53, r5
+dec L147
+mov #-36, L251
+L241: jmp X6
+dec L243
+jsr L64
+clr *r0
+L242: add #-211, L246
+L243: cmp *r5, r7
+inc *r0
+L244: .string "evi"
+cmp *r3, *r4
+lea L247, *r7
+mov *r0, *r0
+L245: clr r1
+stop
+inc L253
+L246: clr *r7
+rts
+mov #-177, X24
+jsr *r7
+L247: .data 47, 368, -179
+not *r5
+jsr *r0
+not r5
+L248: rts
+clr X22
+dec r4
+mov r0, r5
+L249: jsr *r6
+dec *r3
+L250: jsr *r7
+L251: .string "i"
+L252: cmp *r1, *r5
+lea L253, r1
+rts
+dec L144
+jsr L253
+
+prn L142
+L253: jmp L154
+; comment
+red *r0
+
+bne L12
+clr *r2
+add r2, r5
+sub #-152, *r1
+add r1, *r5
+prn r2
+cmp #193, #27
+stop
@@ -0,0 +1,1042 @@
+; Generated by genCorpus --seed 23
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+dec X10
+add X5, *r0
+cmp r6, r4
+L0: jsr X13
+L1: inc X20
+sub #9, L1
+L2: .data 393
+L3: mov *r0, r6
+jsr *r3
+dec r4
+bne X15
+inc r2
+L4: .string "pjjcbgzhq"
+cmp #29, r1
+mov #102, r5
+; comment
+dec L5
+clr r2
+jmp *r2
+; comment
+L5: .string "yaneviximgxzwx"
+lea L0, r2
+jsr L182
+L6: dec r6
+not *r4
+clr r7
+sub L3, r2
+lea L66, *r1
+red L1
+not r4
+dec r4
+red r3
+not *r7
+sub #249, L138
+inc r6
+sub #80, r3
+mov #129, *r7
+cmp #78, *r2
+cmp L0, X10
+; comment
+L7: lea X10, *r5
+bne *r5
+L8: .string "navwiob"
+jsr L106
+lea L8, r6
+L9: inc *r5
+rts
+sub L4, L5
+mov #198, X0
+lea X23, *r4
+L10: stop
+cmp #59, r6
+inc L4
+prn *r5
+lea X16, r0
+prn *r4
+L11: cmp *r4, X21
+mov L6, r1
+mov #-45, L31
+L12: bne L91
+add X16, r0
+jsr X19
+L13: cmp L46, #189
+L14: sub L96, *r7
+lea X24, *r1
+inc r4
+cmp *r1, *r1
+red r2
+sub L89, L211
+bne L73
+inc *r7
+L15: bne L49
+add L11, *r7
+rts
+bne *r5
+L16: .string "zygqovpxuchnodhrxit"
+L17: .data 324, 154
+red L20
+L18: .data -251, 653
+jsr *r7
+inc r5
+; comment
+L19: .string "njjyqdasukzpgowchr"
+mov L134, *r1
+cmp X8, L11
+dec L189
+lea L16, r6
+bne X6
+dec *r4
+mov #-108, L3
+red r1
+; comment
+lea L6, r1
+rts
+prn *r5
+L20: lea L194, L9
+rts
+L21: cmp r3, *r1
+jmp L10
+L22: .data -456, -849
+stop
+red r4
+lea L20, L65
+
+sub r1, L100
+jmp L11
+L23: .data -670, -973, 515, 486, -24, 708, -614, -341
+L24: rts
+L25: .data 899, 410, -295, -561, 877, 26
+bne *r5
+clr *r7
+L26: .string "qsugyaymfsrvaq"
+stop
+prn X21
+L27: sub *r6, X24
+L28: add #-230, L135
+L29: .string "rtsrklggxryfyaslxhzm"
+rts
+L30: .string "pof"
+prn r2
+add L14, *r0
+lea X22, r2
+dec *r7
+jsr X12
+inc L122
+stop
+dec *r0
+L31: .string "mzwrflolm"
+clr *r1
+L32: .data -631, 827
+L33: sub X18, *r7
+jmp *r0
+sub *r3, X24
+red r5
+inc r4
+jsr *r2
+sub L109, r3
+inc *r2
+jmp *r7
+rts
+inc *r2
+sub L26, X10
+prn r6
+red *r4
+cmp #53, r4
+clr X11
+not r3
+clr *r4
+mov *r1, *r0
+sub *r5, *r3
+jmp L40
+add r0, L33
+lea X5, X24
+rts
+stop
+rts
+not r2
+bne L0
+L34: sub #-83, L10
+red *r2
+clr r6
+not *r7
+jsr L209
+L35: lea L17, L4
+bne *r0
+bne *r6
+sub L191, r1
+sub L232, *r4
+add #-87, r4
+add #-181, L28
+dec X23
+cmp r6, *r7
+rts
+jsr L212
+cmp #-186, #-9
+clr r3
+cmp *r7, *r7
+L36: .string "kjoucjsakrvbhbdfmpgbb"
+L37: bne *r1
+jmp L7
+lea X23, r4
+clr L4
+sub #-131, *r6
+clr r0
+
+prn r6
+L38: .string "bxsvpooosdsfchdwpqyrmq"
+cmp *r7, *r1
+add r4, r7
+dec r2
+lea X10, *r4
+lea L116, r0
+rts
+L39: red L8
+red r3
+rts
+cmp *r3, *r4
+L40: .data 232, -323, -89, 905, -755, -796, 575
+dec *r4
+L41: .string "ruit"
+inc r6
+rts
+sub r7, L28
+prn r5
+stop
+clr L36
+jsr *r5
+bne X15
+add *r2, *r3
+stop
+jsr X0
+stop
+L42: .data 371, -671, -630, 122
+cmp X9, X4
+inc r2
+stop
+red L113
+red *r7
+not *r1
+add #116, X24
+rts
+stop
+bne L76
+lea L217, *r6
+jmp *r1
+L43: .string "nbdsphkdahvgajxzynbmdnel"
+L44: rts
+L45: cmp r6, #45
+inc r0
+
+jsr X23
+
+stop
+not r3
+L46: stop
+L47: .string "fdaoinsouomjvywrluozls"
+stop
+clr X2
+L48: cmp r1, L127
+not L78
+rts
+L49: stop
+L50: .string "mxsvepkvrw"
+prn *r6
+add L185, r6
+bne X0
+add X0, L155
+not *r2
+dec r0
+cmp X5, *r0
+stop
+L51: dec *r2
+prn #253
+L52: bne L38
+L53: .data -955, -409, 209, 205, -123
+rts
+cmp L53, r0
+inc r3
+jmp *r6
+L54: .string "vxyzngxxtmm"
+cmp #99, #-186
+; comment
+L55: dec r2
+L56: add #2, r3
+prn #255
+
+sub #-180, r0
+inc r2
+not *r7
+jsr X4
+L57: bne X16
+L58: .string "fcehhbiyjru"
+L59: cmp #-7, X5
+cmp *r0, *r0
+lea L37, r6
+bne *r0
+mov r6, *r3
+jmp *r3
+dec L10
+
+jsr L9
+; comment
+L60: .data 34, 191, -585, -782, -616, -551, 162
+bne *r5
+bne *r4
+cmp *r0, X7
+clr r2
+jsr X20
+red r0
+L61: jmp *r5
+dec r1
+not r4
+dec *r4
+; comment
+L62: .string "d"
+L63: add #-253, L201
+jmp *r6
+L64: mov *r6, *r7
+clr r2
+sub #-76, r4
+L65: jmp *r5
+bne *r5
+cmp *r3, *r2
+prn r2
+L66: inc X1
+; comment
+add #-55, L46
+L67: mov r0, L229
+; comment
+stop
+not *r0
+inc r0
+cmp L65, #186
+jsr *r7
+inc L67
+jsr *r5
+L68: sub r0, L17
+L69: jsr X20
+L70: lea X16, L75
+cmp L10, *r7
+add *r5, L54
+inc X10
+L71: add #-230, L50
+mov #141, r0
+prn L238
+L72: .string "rpylbp"
+L73: jsr *r2
+L74: jsr X5
+bne *r7
+; comment
+L75: .data 902, -7, 72, 655, 338, -198, 449, -576
+L76: red r7
+L77: inc L164
+jsr L74
+bne *r0
+prn #49
+mov r2, *r5
+L78: .string "puxhzf"
+L79: jmp X23
+stop
+dec *r5
+rts
+rts
+L80: dec X20
+mov X6, r3
+L81: not *r4
+
+jmp *r0
+inc r2
+sub #6, *r1
+L82: .data 619, -171, 57, -679, 428, -108, -183, -797
+bne X1
+clr L167
+mov *r0, r5
+dec r3
+mov X2, X21
+add #-210, r2
+inc r6
+rts
+
+sub r4, L40
+red L194
+L83: rts
+prn *r1
+stop
+L84: stop
+; comment
+lea X13, X4
+dec r4
+rts
+dec *r2
+prn #-165
+clr *r0
+clr L2
+lea L48, L25
+sub *r7, *r2
+stop
+dec r6
+L85: sub r7, L75
+L86: .string "nvebfwlnmyhmbgaprbp"
+not r4
+red *r0
+add *r6, L68
+clr L74
+cmp r1, #-127
+prn #246
+prn L49
+L87: cmp r6, r1
+not *r0
+bne *r0
+L88: .data 872, 64, 86, -283
+clr *r7
+bne *r7
+bne *r3
+red r4
+red L79
+L89: rts
+dec r6
+clr X12
+cmp r4, r1
+jmp *r4
+stop
+cmp #82, #-177
+lea X6, *r3
+clr r6
+mov #200, L143
+jmp L146
+not *r6
+L90: .string "c"
+stop
+clr *r1
+L91: rts
+dec *r0
+red r4
+stop
+rts
+red *r2
+clr L225
+cmp #80, *r3
+L92: mov r3, r5
+jmp *r0
+prn #-256
+mov *r2, L62
+stop
+L93: clr r3
+rts
+mov *r4, L69
+L94: clr r0
+dec r2
+L95: not L167
+cmp r1, *r1
+L96: .data 53, 804, -670
+mov #-249, *r7
+L97: .string "nljhk"
+stop
+prn L158
+stop
+bne *r4
+inc X7
+not *r3
+lea X3, X7
+dec *r3
+L98: .string "buxqsmkbqmstaaobtyd"
+cmp r4, #-231
+bne *r7
+prn *r5
+L99: stop
+dec L187
+rts
+
+L100: .string "ushndznhoxixbwofkwm"
+clr *r4
+add r5, r3
+clr r5
+L101: dec *r0
+L102: jsr L70
+cmp *r4, r4
+jmp *r7
+not r2
+rts
+inc L127
+bne *r1
+red r1
+stop
+sub *r0, r5
+L103: .string "mthyaotswpnxcymk"
+L104: .data -291
+L105: .data -860, 343, 572, -166, 351, -612
+jsr X0
+L106: .data 213, -994, 390
+rts
+dec r7
+L107: sub *r5, L191
+rts
+stop
+inc r0
+cmp r0, *r7
+cmp L132, *r3
+bne X12
+jsr L152
+prn L110
+L108: red L148
+L109: bne X24
+L110: sub r3, *r5
+bne X5
+cmp *r0, *r3
+cmp #-10, X11
+jsr X3
+prn #3
+L111: not X19
+add #-81, r7
+L112: cmp X13, r4
+lea L11, X1
+L113: bne L15
+L114: .string "olxlmkpgjromjhi"
+cmp r1, r7
+L115: .data -80, 569, -275, 374, 398, -449, -713, 486
+L116: red L101
+; comment
+bne *r7
+mov r0, L101
+add #-240, r4
+L117: rts
+L118: .string "xdmvhksb"
+L119: .string "vwjzttffudvxzb"
+lea X22, r6
+L120: .data 870, 741, -131, 18, -263, -670
+cmp X17, r6
+rts
+clr r7
+bne *r3
+add #31, r2
+mov r0, r5
+
+bne L93
+not r1
+jmp X4
+L121: lea L226, r3
+not *r5
+rts
+add #1, r4
+L122: prn X7
+prn r0
+sub L179, *r6
+stop
+red *r5
+jmp *r4
+L123: stop
+inc X2
+L124: mov #189, r7
+L125: stop
+clr L82
+mov r2, X22
+dec r5
+add r2, r5
+L126: lea L215, *r3
+add *r6, r4
+stop
+stop
+cmp r5, #181
+jsr *r5
+L127: .string "lzdfvscwjwmvj"
+inc L48
+L128: .data -726, -37, -583, 604
+L129: .string "qhu"
+sub #-216, *r4
+L130: stop
+L131: bne *r3
+prn *r3
+mov r3, L204
+L132: .data 590, 863, -520, -597, -816, -656, -951
+L133: prn r4
+stop
+clr r0
+L134: clr X9
+red r5
+L135: cmp *r3, X2
+bne *r6
+L136: .string "cmonatfubtzvdvkbhcdtjgrk"
+jmp L15
+L137: stop
+L138: .string "epanoefxkqukyfz"
+stop
+lea L172, L77
+clr L108
+bne L73
+L139: inc r4
+bne X17
+mov r3, r3
+bne X5
+stop
+L140: .data 671, 352
+jsr X6
+jsr *r4
+mov #-175, L5
+L141: .string "moupyb"
+jmp X21
+cmp *r0, L223
+sub *r2, L187
+L142: jmp *r6
+rts
+jsr *r1
+clr L188
+inc L219
+jmp L45
+lea L60, *r0
+prn #-249
+bne *r6
+inc X10
+sub *r7, L140
+rts
+cmp #-35, *r5
+red X21
+add L135, *r3
+dec r2
+clr L112
+stop
+add r2, *r0
+sub L193, r5
+inc L197
+bne L180
+clr X3
+add r5, L69
+inc *r2
+lea L147, *r6
+jmp *r3
+rts
+sub r7, *r5
+clr X21
+add #244, r2
+bne L123
+stop
+lea L234, *r3
+L143: add X17, *r0
+
+lea L184, L135
+add L164, *r2
+mov *r4, L103
+sub *r4, L57
+add #134, *r2
+add #166, *r5
+inc *r2
+L144: inc r1
+L145: .string "zaunuccmdovgguh"
+L146: jmp *r7
+dec X19
+dec *r3
+L147: stop
+sub L102, *r0
+sub #-144, L98
+sub r2, *r3
+L148: .data -531, 597
+clr L228
+; comment
+cmp *r3, *r3
+mov *r6, r7
+red r4
+L149: .string "gadgxujqtbgvclpw"
+
+mov r4, X24
+not X0
+stop
+jsr X3
+stop
+rts
+lea L206, X12
+stop
+stop
+lea L179, L207
+rts
+L150: cmp #-227, L170
+inc r1
+L151: prn #-62
+L152: .data 815, 229, 698, -518, 884, -217, -442, -344
+jsr *r0
+rts
+dec *r6
+L153: dec r6
+not *r5
+jsr L55
+jsr *r2
+lea L71, *r3
+sub #183, *r7
+sub #-140, X4
+clr r0
+rts
+L154: cmp *r1, *r7
+L155: inc r7
+add L83, r7
+clr r6
+mov #58, L211
+rts
+; comment
+prn #-28
+L156: lea X7, *r7
+add #201, r5
+L157: dec r0
+stop
+inc L201
+not L161
+lea X12, *r5
+dec L134
+cmp #-18, L3
+L158: lea X13, r0
+lea L28, r3
+jmp L154
+clr r3
+L159: prn *r5
+jsr *r2
+clr L84
+; comment
+not X7
+L160: .string "wflvyzbhepfdtzdgyhrp"
+inc *r7
+L161: jmp *r7
+lea L187, L177
+; comment
+inc *r0
+red r1
+stop
+add *r7, *r7
+; comment
+mov *r0, r2
+stop
+prn *r7
+L162: add L162, *r2
+sub r2, *r7
+L163: .string "gvuvvomjbimcqrvuwl"
+
+sub *r6, L4
+
+prn *r0
+prn #133
+L164: not r5
+not X16
+inc r7
+inc L8
+L165: .data -517, -861, -267, 729, 373, -652, -412, 306
+jsr *r4
+L166: .data -234, -531, -442, 315
+L167: .data 336, -543
+mov #195, *r6
+L168: add #223, r3
+L169: .data -548, -222, 563, -637, -889, 15, 432
+jmp *r2
+; comment
+add r4, L57
+clr *r2
+sub #193, *r2
+
+not *r1
+sub #96, X13
+clr L49
+add #53, *r6
+not r1
+L170: clr r6
+L171: .data 167, -706, -579, -241, -217
+add r2, X19
+L172: .data -710, -760, 489, -276, 639, 66, -664
+jmp *r2
+stop
+cmp #-153, *r5
+lea L210, X0
+dec r2
+not *r0
+jmp L204
+sub L222, L177
+sub *r4, X11
+L173: clr *r0
+add L49, r2
+
+L174: add *r7, L79
+L175: .data 744, 0, 281
+L176: .data 459, 800, -272, 57, 526, -422
+L177: lea X2, r1
+bne *r4
+rts
+mov *r7, L181
+L178: prn r3
+L179: red L20
+
+rts
+red r3
+L180: not *r4
+jsr L47
+L181: dec r2
+L182: .data -464, 36, -11, -913, 80, 979
+not *r1
+jsr L79
+not r0
+sub r5, *r4
+L183: clr r4
+rts
+; comment
+; comment
+L184: clr r6
+L185: .data 924, -344, 15, -652
+sub L188, r7
+L186: .string "dskphg"
+mov L57, r2
+; comment
+L187: inc L209
+stop
+jmp X13
+rts
+L188: .string "j"
+mov r3, *r1
+jmp L217
+cmp *r3, #85
+L189: jsr X10
+L190: add #-65, r5
+red r7
+inc L227
+add *r7, r6
+cmp r0, *r3
+lea X12, *r1
+L191: .data -746, -824, 377, 196, -117
+L192: not *r6
+L193: stop
+rts
+lea L199, *r3
+prn *r3
+mov r3, L173
+not *r4
+stop
+; comment
+dec *r7
+rts
+inc *r6
+stop
+jmp X6
+bne L156
+clr r3
+clr r5
+L194: .data 164, -308
+jsr L149
+not *r3
+lea L32, L108
+inc r0
+; comment
+cmp #-90, L210
+lea L164, r1
+stop
+rts
+add #-252, X24
+sub #-215, r1
+L195: cmp X22, L235
+L196: jsr *r2
+jsr X24
+L197: dec X0
+L198: .string "akaxntdd"
+bne L221
+add r6, X5
+L199: clr L182
+L200: .data 769, -372, -768, -685, -75, 784, 791, -275
+L201: .data -861, 626, -904, 283
+inc r3
+L202: .string "ukcddijiuzrkclhibpqd"
+bne *r1
+jmp L34
+inc L169
+L203: .string "evvnfrisixhcomimyfh"
+not X15
+prn r5
+mov X12, X14
+not r0
+jsr L229
+L204: inc r0
+stop
+add r2, X14
+L205: not L206
+inc r7
+jmp *r6
+add r4, r5
+red r4
+L206: rts
+L207: clr L235
+
+bne L212
+dec *r4
+dec L223
+L208: inc *r1
+not *r0
+rts
+L209: not X10
+L210: jsr X16
+L211: sub #-63, *r2
+L212: lea L198, r2
+lea X0, X10
+add L23, X21
+L213: .data 705
+clr L22
+L214: sub *r4, r4
+L215: stop
+; comment
+L216: rts
+lea L226, *r1
+rts
+jmp L215
+rts
+rts
+stop
+
+L217: clr *r0
+inc *r2
+mov X15, r4
+dec L113
+clr *r2
+not r6
+L218: .string "eqqegyoiejucuukgxzrrohe"
+rts
+jmp L61
+jmp *r0
+jsr L164
+jmp *r1
+mov r4, r0
+mov *r0, *r6
+L219: stop
+L220: inc *r2
+not *r5
+
+L221: lea X14, r0
+not r7
+bne *r0
+dec r5
+inc X24
+stop
+L222: sub X14, r5
+mov *r1, r5
+cmp L231, *r0
+L223: .data 321
+
+inc L231
+prn r2
+clr *r5
+lea L228, *r7
+L224: jsr *r4
+L225: not X8
+sub r3, L167
+bne L116
+dec X10
+mov X2, L177
+dec r2
+stop
+mov *r7, *r7
+rts
+clr r0
+stop
+jsr *r1
+
+L226: cmp *r1, #-241
+jmp *r3
+
+sub *r2, *r0
+lea L10, L235
+L227: .string "nfrhcyalaljdhpd"
+red L233
+jmp *r3
+sub L154, X23
+
+not *r0
+L228: inc r6
+sub *r2, r4
+red r0
+lea L215, *r3
+L229: .string "dg"
+prn r7
+lea X0, r2
+red X10
+mov r5, L234
+rts
+bne *r2
+sub X14, L236
+rts
+L230: prn X0
+jsr *r4
+jmp *r0
+jsr L28
+red *r1
+clr r0
+prn r0
+inc *r2
+red r0
+rts
+cmp L45, X6
+L231: mov *r0, r4
+sub #248, *r0
+lea L237, *r4
+prn r7
+jsr *r7
+L232: .data -656, 193, 498, -143, 768
+clr r6
+sub X17, r6
+add #-164, r0
+rts
+add *r6, *r5
+clr r2
+L233: .string "udgzlwrpjiszadeohso"
+
+L234: stop
+red *r5
+mov L195, r3
+mov L72, r2
+jsr L237
+add L62, X14
+; comment
+L235: .data 519, 456
+stop
+prn *r2
+cmp r2, r5
+red L236
+mov #54, r3
+L236: sub *r5, *r1
+jsr X17
+not *r0
+L237: .data -221, 692
+sub *r6, r7
+red *r3
+L238: prn *r6
+; comment
+stop
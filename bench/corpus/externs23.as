@@ -0,0 +1,1043 @@
+; Generated by genCorpus --seed 24
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+L0: bne *r5
+bne L63
+bne X24
+mov #-190, *r6
+dec X17
+L1: red r7
+L2: bne L198
+inc r4
+
+stop
+jmp X23
+L3: .data 160, 14
+L4: rts
+inc L4
+bne L19
+L5: not *r7
+L6: .string "aimwhpv"
+prn L3
+inc r3
+red L138
+L7: jmp L4
+L8: add #-213, L140
+dec L7
+L9: .string "qu"
+
+not L1
+L10: add r0, r6
+rts
+not *r0
+cmp #21, L228
+
+L11: .data -863, 489
+L12: prn X16
+bne X7
+mov X4, r0
+jmp *r3
+dec *r5
+not r4
+red X15
+bne *r1
+inc *r3
+red *r6
+not *r5
+stop
+cmp *r5, #-115
+red *r7
+sub *r1, *r2
+cmp *r0, *r2
+L13: inc r1
+mov *r7, *r0
+; comment
+L14: cmp r1, L171
+clr *r3
+jmp L10
+L15: clr *r6
+dec r4
+clr *r3
+red L117
+L16: .string "wkmvxa"
+inc *r2
+L17: bne *r2
+not L234
+L18: bne L15
+add #-119, r7
+rts
+red *r1
+; comment
+lea X17, r0
+red *r0
+lea L7, *r4
+clr *r7
+mov r4, *r6
+stop
+prn L228
+L19: stop
+jmp X6
+inc L234
+jmp *r3
+bne *r1
+dec *r1
+cmp *r3, r4
+inc *r0
+L20: .data 818, -48, -684
+L21: .data 77
+L22: mov *r3, *r3
+lea L134, L19
+jsr *r2
+cmp *r4, #98
+sub r7, L118
+cmp r7, r1
+lea L21, *r1
+L23: dec *r2
+bne *r1
+red *r0
+rts
+jmp *r6
+rts
+mov *r7, L13
+not X2
+add L1, L225
+jmp *r5
+stop
+mov #-226, r4
+add r2, L18
+inc r0
+L24: .data -370, -507, -200, 700, 120, -364
+red *r5
+cmp r6, *r1
+prn #148
+inc X17
+L25: dec *r1
+rts
+L26: prn L1
+lea L16, r0
+mov #24, r3
+L27: stop
+stop
+cmp L5, #100
+clr X3
+stop
+clr X23
+dec X8
+L28: .data 747, -937
+sub *r4, *r3
+inc *r1
+bne *r6
+dec L111
+L29: cmp *r5, r5
+jsr L164
+L30: not r7
+L31: mov #-53, L25
+lea L174, *r7
+not r6
+bne X3
+L32: sub L30, *r0
+L33: .data -426
+red L15
+not r6
+L34: prn r2
+cmp #145, L129
+cmp r6, *r6
+jmp *r3
+cmp *r2, r2
+add r4, X15
+jsr X23
+rts
+add L21, *r4
+rts
+
+L35: sub r5, X8
+inc r2
+clr X2
+not *r5
+add #-211, r3
+stop
+not L14
+jmp *r7
+red *r4
+red r2
+lea X9, r3
+L36: jmp L123
+stop
+mov #-148, *r6
+prn *r2
+not *r6
+red L214
+sub r7, L35
+L37: add L215, X18
+inc *r3
+jmp *r1
+L38: clr r0
+stop
+L39: mov L8, *r0
+prn *r7
+red r3
+L40: .string "cecmqklsvp"
+jsr *r7
+L41: cmp L39, r5
+prn #-28
+red r1
+
+L42: clr *r2
+red r6
+; comment
+L43: dec r3
+clr L42
+dec r1
+L44: .string "djotvmziqwrtxq"
+lea X11, r3
+clr r1
+jmp *r2
+L45: sub L41, *r5
+prn r2
+L46: .data 244, -119, 379, 45, 249, -147
+add #-54, r1
+mov r2, *r4
+jmp *r6
+L47: not r5
+red r7
+lea L21, *r7
+L48: .data 135, 295
+sub r3, L41
+; comment
+cmp #-133, L36
+bne L234
+inc *r3
+jsr *r7
+rts
+add X23, *r1
+clr r4
+rts
+jmp *r7
+bne L63
+dec *r6
+stop
+add X12, *r7
+jsr *r4
+inc r0
+bne L221
+L49: .string "jppahsoxvalnermraf"
+L50: .data 990, -721, -403, 116, -128
+stop
+clr r0
+L51: .string "vpxigdcnnuztlcxjue"
+prn r5
+dec L14
+jmp L171
+L52: .string "waquausdlcphdhhwborigkkv"
+L53: stop
+
+stop
+mov L227, *r6
+prn *r2
+prn L198
+stop
+L54: dec *r1
+L55: .string "jh"
+bne *r6
+bne *r1
+not r4
+not r4
+L56: .data 577, 154
+L57: .data 541, 599, 472, 604, -910, 471
+mov X14, L25
+add r3, *r6
+add *r2, r2
+not *r5
+L58: .string "bjkiqxkxkeckz"
+sub #43, X15
+add *r7, L51
+L59: rts
+L60: jsr L123
+add *r4, X12
+; comment
+dec L53
+stop
+add #-108, L100
+L61: add X23, r7
+cmp L53, L196
+mov #-30, *r3
+jsr *r6
+clr r4
+cmp L39, *r2
+lea X3, L43
+sub #108, r0
+cmp #-194, *r2
+red r1
+; comment
+add #-164, r4
+
+dec r0
+L62: sub r7, *r5
+not r7
+not X12
+clr *r6
+red r1
+not r1
+prn r0
+cmp *r1, X0
+add #-19, L62
+rts
+jsr *r7
+bne *r6
+jsr *r1
+stop
+clr r7
+lea X6, X3
+L63: lea X21, *r4
+
+L64: inc L67
+; comment
+rts
+rts
+mov r5, *r0
+bne X5
+L65: .string "dyouefgydpnfacwajfd"
+
+add #-164, r6
+jmp X7
+L66: .data 893, -610, 693, -270, -563
+stop
+cmp *r2, #71
+sub #233, L44
+sub *r7, r7
+not L241
+L67: prn *r4
+L68: sub *r7, L27
+sub *r7, *r3
+inc r1
+jmp *r5
+
+stop
+not r4
+jmp L82
+mov r5, *r0
+L69: .string "v"
+jsr *r7
+bne X23
+L70: .data -23, 948, -919, -207, -237, -655
+L71: .data -823
+L72: cmp #103, *r1
+mov L71, *r2
+jsr L175
+red r7
+lea X6, L137
+stop
+L73: lea L88, *r1
+L74: .data -646, -714, 892, -28
+L75: lea L201, *r0
+; comment
+jsr *r2
+bne *r0
+jsr L80
+L76: clr *r0
+L77: .data 257
+stop
+rts
+L78: .data -214, 758, 547, -441
+prn r4
+L79: add L67, *r4
+red L117
+rts
+L80: bne L192
+mov *r6, *r0
+jmp *r6
+L81: jmp *r7
+bne L53
+lea X20, L63
+not *r7
+lea X18, r0
+L82: prn *r3
+clr L145
+jsr L49
+cmp #41, L1
+jmp *r5
+L83: bne L222
+L84: cmp r6, L119
+clr *r7
+mov X24, *r0
+prn r0
+L85: jsr *r5
+jsr L150
+add L27, r0
+lea L58, *r0
+clr X22
+; comment
+mov *r3, *r5
+jsr *r1
+L86: .data -798, -560, 521, -876, 87, -685, 32
+L87: mov *r5, X6
+add r4, X5
+; comment
+jmp L95
+L88: sub #-236, r6
+
+mov X13, L59
+inc *r1
+inc *r3
+L89: lea X5, L82
+L90: .data -352, 954, 744, -632, 402
+inc r2
+
+red *r7
+L91: .string "eoyonjkekjxzbbzawx"
+mov r0, *r3
+L92: jmp *r4
+prn r5
+inc X23
+prn *r5
+lea X23, r6
+prn L83
+cmp r6, #-231
+L93: sub X5, r7
+add *r7, *r4
+L94: red r6
+L95: .data 974, -890, 778, -905, -473, 61, 286, -132
+L96: not X15
+mov r6, *r7
+; comment
+dec r7
+rts
+jsr *r1
+add #-85, L11
+L97: rts
+L98: .string "dedwwtnsdkjivquw"
+L99: inc r4
+sub r0, *r4
+prn #169
+clr r3
+jsr L175
+clr r1
+L100: stop
+jmp L140
+L101: lea L195, r5
+stop
+bne L1
+lea L120, r6
+red *r6
+cmp X13, X13
+inc X15
+red r7
+rts
+L102: .string "lfydvpfmmtrg"
+jsr *r6
+L103: jsr *r4
+not X16
+red L45
+red *r5
+jsr *r7
+add r3, *r0
+jmp *r1
+inc r0
+L104: red r5
+L105: bne X21
+sub #-179, *r1
+stop
+L106: prn r0
+L107: bne *r5
+; comment
+L108: lea X17, *r6
+L109: prn r3
+jsr *r4
+rts
+prn r0
+L110: bne *r4
+L111: add L242, r7
+cmp r2, #189
+not r3
+L112: jsr X19
+sub L29, *r6
+rts
+not *r4
+jmp *r4
+prn #220
+clr *r0
+dec L104
+jmp X22
+jmp *r6
+L113: .string "qogpefbqqbfnkczottwixjz"
+dec L154
+stop
+L114: .data 533, -122, -307, 472, 875, 213
+mov X23, *r0
+prn *r4
+rts
+L115: .string "cgkdfpkqznjjwaz"
+L116: .string "gmimseu"
+jsr L156
+dec *r1
+clr *r6
+cmp L28, *r3
+stop
+L117: dec r2
+clr *r7
+L118: jsr *r6
+lea L86, r6
+not *r6
+jmp *r6
+L119: lea L15, r4
+dec X20
+clr *r0
+prn *r1
+jsr L34
+cmp #-8, L60
+add r1, r4
+rts
+lea L31, *r4
+L120: .string "eridvhsrfbwdohmwxqzgbeti"
+stop
+jmp *r6
+bne L172
+prn r0
+mov r0, X0
+clr *r3
+L121: dec *r2
+; comment
+cmp r0, #-8
+red *r3
+red X17
+sub *r1, *r5
+jsr L189
+L122: not *r3
+L123: .string "auyhdjopfvldxqchaux"
+not r3
+red L230
+clr *r4
+L124: jsr *r0
+prn L28
+add *r6, r0
+
+L125: .string "hgsiptqejajnykreenulq"
+L126: jsr L64
+L127: .string "halbnlstdvawvjl"
+L128: lea L120, r3
+clr r2
+
+inc X20
+lea L224, L48
+cmp #-158, r1
+L129: prn r2
+cmp #-35, r5
+L130: bne *r0
+L131: .string "i"
+clr L144
+L132: .data 359, 579, 515, 261, -460, 943, -399, 549
+add *r3, r5
+sub r7, r0
+clr r7
+L133: sub r6, *r7
+prn #113
+L134: jsr X17
+mov r6, r6
+not r7
+
+lea X19, *r5
+L135: inc r2
+not X1
+L136: not *r3
+L137: .data -585, 900, 384, -497, 712, -791, 668
+L138: prn L193
+L139: inc X11
+lea X14, *r2
+; comment
+dec r7
+jmp *r1
+inc X14
+; comment
+sub r1, L221
+dec *r3
+rts
+L140: .string "qehbeqwtdffubnwwm"
+L141: .data -363, -446, 793, 703, -437
+L142: lea L46, *r0
+lea L164, r0
+lea L82, L46
+inc r3
+not L223
+
+L143: .data -732, -758, -718, 565, -564, -65
+L144: .data 563, -36, 404, 592
+clr *r1
+jmp *r4
+rts
+bne *r5
+L145: bne *r7
+prn r0
+mov *r5, X19
+cmp *r5, *r3
+inc L27
+L146: .string "flhxpfmx"
+L147: stop
+add #117, L76
+not L230
+add *r4, r2
+
+red *r0
+L148: dec *r5
+not r4
+bne *r0
+inc r5
+mov #-5, r4
+stop
+L149: lea X22, L31
+lea L7, r1
+
+red L141
+rts
+dec *r0
+L150: cmp #-109, r3
+lea X2, L89
+cmp r5, #129
+sub L163, r2
+stop
+
+prn r2
+L151: stop
+L152: stop
+inc *r2
+L153: .data -339, -194, -206
+L154: stop
+lea X20, r7
+add #136, L90
+L155: red *r3
+; comment
+L156: sub *r3, L223
+not X12
+bne *r2
+jsr *r1
+sub L160, L142
+; comment
+stop
+prn r0
+sub r6, *r4
+not r4
+add X17, L195
+jsr L162
+mov r4, L185
+clr *r2
+L157: .data -127, -762, 308, -920, 657
+jmp L154
+L158: .string "rbd"
+cmp L198, #-190
+cmp *r5, r0
+; comment
+lea L121, r1
+lea X9, r7
+; comment
+prn *r4
+prn L234
+dec X3
+not *r6
+sub #199, *r2
+L159: jmp L159
+jmp L228
+clr *r5
+red r4
+jsr *r6
+red *r3
+L160: mov L108, *r6
+not *r5
+mov r0, *r4
+inc L187
+not X4
+L161: bne *r1
+mov *r5, L160
+jsr L225
+mov X18, *r6
+dec *r3
+sub X20, L208
+stop
+; comment
+L162: red *r1
+dec L126
+jsr *r2
+L163: prn #3
+rts
+rts
+not r2
+
+L164: .data -733, 657, -970, -657, -727, -628, -894
+L165: cmp *r4, L113
+red X14
+add *r4, *r1
+jsr L151
+lea L101, L238
+jmp L85
+L166: .string "kqmufxovwztnheqqktidr"
+lea X0, r7
+L167: .data -816, 665, -646
+prn L3
+jsr X12
+L168: stop
+L169: add *r6, L225
+lea L236, L131
+inc L156
+not r2
+cmp #135, L189
+; comment
+not *r0
+
+L170: stop
+cmp #-170, X3
+red r0
+sub r7, *r1
+stop
+cmp *r3, L47
+red L2
+L171: .data 392, 503, 506, 240, 46, -560, -528
+mov #130, r4
+stop
+dec *r2
+cmp L111, #73
+jsr *r3
+rts
+prn r0
+mov #-233, *r7
+L172: lea L160, *r3
+lea X17, *r5
+
+red r5
+L173: .string "jvts"
+prn *r7
+prn #73
+L174: .data -118
+stop
+inc *r0
+red X3
+L175: inc r6
+L176: .string "qpciszhtwyxyxber"
+jsr L187
+L177: .data 471, -585, 522
+sub L196, r6
+sub r7, L225
+jsr *r6
+L178: red *r5
+cmp *r0, r5
+L179: bne L242
+inc r2
+mov *r5, L219
+sub L59, *r0
+jsr L147
+L180: stop
+inc r6
+jsr L234
+not r0
+red r4
+L181: dec L61
+not r1
+L182: stop
+add r6, r7
+; comment
+add *r2, r0
+clr r2
+prn #18
+L183: inc L219
+stop
+cmp X6, r0
+cmp L99, r6
+L184: jsr L190
+cmp *r0, r1
+prn X22
+L185: .data 554, -72, 452
+inc *r0
+L186: clr r6
+bne X19
+L187: clr L126
+mov X24, r4
+lea X3, L242
+mov #-22, *r7
+lea L141, r5
+red L212
+jmp *r3
+mov *r4, *r1
+
+
+mov *r0, r5
+add r1, X14
+L188: inc X15
+add r7, L135
+jsr *r4
+red r2
+sub #-205, *r7
+mov #-181, r0
+L189: sub r1, r1
+add L38, *r7
+clr r5
+add #-159, *r2
+not L233
+not L211
+
+sub r2, r2
+
+cmp *r7, r4
+L190: rts
+L191: mov #107, L223
+jmp L222
+inc L225
+red r1
+prn X24
+L192: .data -836, 169, 604, -501, 81
+L193: add X7, *r7
+jsr L222
+L194: rts
+red *r4
+prn #22
+not r4
+bne X16
+clr *r6
+rts
+L195: bne *r0
+cmp *r5, L158
+jmp *r0
+L196: .string "uqjrc"
+L197: dec L219
+L198: jsr X4
+L199: .string "zqzoczrej"
+dec X6
+L200: jmp L222
+rts
+L201: lea L28, *r1
+L202: lea X18, X9
+add r4, *r3
+L203: jsr *r0
+prn #-115
+dec r3
+red r0
+jmp *r4
+cmp X16, *r2
+dec r5
+sub *r6, L236
+L204: rts
+not *r6
+not r2
+cmp *r6, #210
+; comment
+prn #146
+red r0
+L205: red r3
+bne *r4
+jsr L32
+L206: .data -259, -864, -230, -329, -550, -689
+bne *r4
+lea L90, *r1
+jmp X8
+stop
+stop
+bne X7
+cmp *r6, *r4
+cmp r1, r6
+L207: sub r6, *r7
+jmp *r6
+L208: lea X24, L85
+add r6, r1
+clr *r7
+L209: .string "tqypp"
+jmp X6
+cmp *r5, #-45
+not *r1
+mov *r7, r2
+L210: .data -276
+add r4, L172
+clr *r0
+L211: inc *r1
+red X0
+
+rts
+jmp *r0
+not r7
+dec *r4
+; comment
+clr X21
+sub #59, r1
+L212: .data -606, 365, 836, -355
+bne L228
+prn *r5
+mov #-152, r1
+rts
+L213: not r7
+mov #223, L226
+stop
+L214: .string "bidwkqdetivbcqvxkvmji"
+stop
+add *r4, X17
+red L218
+lea L216, *r6
+L215: prn X24
+jmp L217
+sub *r5, X16
+; comment
+jsr *r2
+L216: not r1
+jmp L194
+jsr L29
+rts
+prn L233
+cmp *r4, L1
+red *r3
+sub r2, X5
+mov #-15, r1
+; comment
+L217: .data -442, 488
+
+add *r5, *r3
+L218: sub *r4, *r6
+lea X13, X24
+L219: .string "idpaefjycjfzwvuscew"
+jmp *r5
+L220: jmp L240
+mov *r3, X23
+rts
+lea X11, *r4
+jsr *r3
+inc *r4
+L221: clr r0
+inc r1
+sub r2, L128
+L222: prn #206
+; comment
+clr *r0
+lea L203, *r1
+; comment
+jmp L224
+bne *r1
+L223: mov r2, L51
+L224: prn L236
+L225: sub L242, X17
+prn L237
+dec *r6
+jsr X11
+red r4
+lea X2, L27
+mov *r2, r6
+L226: prn *r1
+inc r7
+L227: lea X10, r1
+not X11
+L228: inc *r6
+L229: dec X10
+L230: mov L240, *r1
+red X3
+L231: jmp *r5
+sub *r2, r2
+
+jsr *r7
+sub r0, *r6
+inc X8
+lea L60, L237
+add *r1, r5
+add #19, X15
+L232: jmp *r2
+add r1, X16
+dec X6
+red *r0
+L233: bne *r4
+L234: jsr X14
+sub L240, *r0
+dec L32
+clr r2
+sub #-162, *r6
+bne L238
+bne *r2
+; comment
+L235: .string "mymbonujpa"
+add L238, r1
+inc X14
+prn r2
+L236: rts
+clr r3
+jmp X13
+inc *r0
+jsr X24
+sub r2, *r5
+mov #6, *r5
+not r0
+lea L240, *r1
+prn L139
+rts
+red L239
+dec r7
+prn r6
+jmp L97
+bne X22
+L237: add *r4, *r0
+sub X2, *r4
+jmp *r4
+stop
+jsr *r6
+add *r4, r7
+mov *r4, *r7
+L238: .string "rnuhrgjmqanawn"
+add X21, L13
+; comment
+prn #73
+L239: .data -185, 685, -854, -875
+L240: .data 694, 983, 454, -874, 788
+add r7, *r6
+not *r0
+cmp *r3, #92
+sub #246, L67
+clr *r6
+cmp r7, r6
+L241: prn r0
+lea L85, X10
+rts
+rts
+jsr *r2
+inc L243
+inc r7
+add *r6, X20
+cmp *r6, r1
+cmp r6, r1
+mov #-17, *r0
+add *r1, r4
+L242: .string "hlrlm"
+add L244, *r3
+stop
+L243: inc L244
+L244: clr *r4
+cmp *r7, *r3
+dec r4
+stop
@@ -0,0 +1,1044 @@
+; Generated by genCorpus --seed 25
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+sub L130, *r3
+mov r4, r4
+prn r0
+bne X7
+bne *r5
+rts
+prn *r1
+L0: inc L182
+add #87, X0
+L1: .data -360, 269, 214, 284
+
+bne *r7
+clr r4
+not r7
+bne L160
+add *r0, *r0
+mov r3, L1
+jmp L131
+L2: cmp X22, r0
+bne *r0
+jmp X12
+red *r4
+bne *r7
+add r4, r4
+L3: cmp #-185, #-106
+dec *r0
+rts
+add L1, *r2
+L4: cmp r2, r5
+L5: jmp *r1
+L6: .data 734, 256, -327, -452
+L7: not X21
+not r2
+clr *r3
+bne *r6
+jmp L12
+add *r2, *r0
+stop
+rts
+; comment
+stop
+jsr L198
+lea L2, *r0
+jmp *r1
+lea L2, *r7
+; comment
+not *r4
+L8: jsr *r6
+add *r1, L141
+cmp r5, #85
+L9: mov *r2, *r4
+clr L114
+L10: .data -965, 252, 476, 824, -332
+bne L111
+prn *r1
+jmp X19
+jmp L251
+L11: inc L208
+L12: .string "wonow"
+red *r7
+prn r0
+bne L8
+clr *r4
+sub r6, r5
+not L62
+stop
+L13: inc *r0
+L14: dec L198
+inc X13
+bne *r2
+stop
+jsr L9
+not r7
+inc L246
+L15: jsr *r5
+L16: .data -744, 671, 98, 694, -648
+not r6
+stop
+rts
+
+bne X8
+; comment
+rts
+sub *r6, L13
+dec *r7
+lea L12, X10
+jsr X6
+L17: red L230
+stop
+L18: inc r6
+jmp *r3
+sub r1, *r1
+L19: rts
+L20: lea L26, *r4
+L21: clr *r6
+L22: .data 505, -507, 222, 926
+
+red *r7
+jmp *r5
+jmp *r4
+jsr L29
+L23: sub *r7, X2
+inc L70
+L24: red r1
+L25: red *r1
+L26: .string "kevqhqgiebdr"
+lea X17, r3
+L27: sub #136, *r3
+L28: clr X20
+prn *r0
+add *r4, X17
+inc L8
+clr r5
+L29: .data -50, -952, 962
+not L24
+jmp X11
+not *r4
+L30: bne X5
+sub *r3, *r5
+cmp #-228, r5
+clr X22
+stop
+clr X4
+add *r0, r7
+add *r7, L225
+L31: .string "ctdpfksunw"
+inc r7
+L32: .data 600, 620, -610, 224, 663, -169, 831, -698
+add #192, *r4
+dec *r1
+red r3
+; comment
+dec *r5
+bne L19
+L33: .data 346, -28, 41, -464, 551, -722, -710
+L34: dec *r6
+jmp *r3
+L35: .data 850, -423, -271, 192, 897
+cmp r6, *r7
+L36: .data -461, 835, 908, -260
+cmp *r3, #17
+not r5
+jsr L8
+dec X22
+inc *r2
+prn r5
+; comment
+rts
+rts
+rts
+sub r4, r4
+bne *r7
+cmp *r2, *r1
+lea L70, *r5
+stop
+L37: mov r1, L78
+jmp L81
+lea L118, r7
+jmp *r6
+add r6, r0
+L38: rts
+L39: clr *r1
+jmp X18
+lea L46, L71
+lea L28, *r0
+cmp L205, *r3
+sub L5, *r3
+lea L28, r0
+sub #238, *r3
+jmp *r7
+lea X8, L198
+cmp #42, *r6
+
+dec *r5
+lea X19, *r6
+jmp L201
+red r0
+L40: .string "ngypnotpfdjnuz"
+add #-22, r2
+inc *r5
+dec X7
+add r3, *r5
+jsr X4
+prn #-172
+jmp X1
+add L231, L6
+inc r4
+L41: .data -83, -895, -802, -149, 12, -95
+rts
+prn *r6
+L42: .data 272
+L43: prn *r3
+red X7
+jsr *r2
+sub X17, L104
+jmp *r1
+stop
+lea X8, L23
+L44: .string "kyrhjsnbcbf"
+; comment
+
+L45: .data -27, -172, 56, -213, -593
+L46: prn X8
+L47: sub r5, *r3
+L48: red r5
+bne *r7
+jmp L41
+jmp *r6
+L49: jmp *r4
+jsr *r2
+sub *r1, r4
+jsr X16
+not *r4
+jmp *r0
+L50: rts
+L51: mov r6, r7
+cmp #-43, *r7
+stop
+sub #-170, L48
+stop
+rts
+dec r5
+sub r1, *r4
+bne *r1
+not *r6
+add #-96, *r2
+jsr L33
+L52: sub X24, r2
+lea X9, L190
+bne L29
+cmp r6, *r4
+prn #130
+L53: jmp L255
+stop
+cmp r1, r4
+L54: jmp L1
+stop
+L55: cmp L90, r4
+bne *r1
+mov *r7, r1
+not X7
+L56: .data -389, -401, 534, 466, -598
+; comment
+cmp X2, L255
+clr L52
+L57: jmp L32
+L58: dec X2
+jmp X17
+red *r5
+rts
+L59: .data 35, 49
+; comment
+L60: rts
+jmp X2
+dec X11
+L61: mov X14, *r7
+prn r5
+not r5
+L62: lea L58, *r6
+L63: bne L174
+L64: jsr *r4
+cmp L138, X21
+dec *r2
+dec r5
+jsr *r2
+L65: jmp X24
+jsr L16
+not r5
+prn L57
+clr *r6
+lea L33, X13
+; comment
+inc r2
+not X19
+jsr *r3
+prn r2
+L66: .data 592, 852
+cmp r2, r1
+L67: .data -209, 947, 848, -981
+not *r4
+dec *r7
+mov L20, r3
+; comment
+L68: add *r2, L74
+L69: .data 511, -850, -682, 751, 280, -984, -669
+L70: add #158, r0
+dec *r0
+L71: not *r3
+rts
+red X8
+inc X20
+L72: prn *r2
+stop
+bne *r4
+
+L73: rts
+rts
+red r5
+bne *r5
+rts
+L74: .string "vczyi"
+L75: red r5
+L76: lea X19, *r5
+L77: prn *r7
+not r5
+L78: add *r5, *r3
+L79: .string "by"
+stop
+bne X6
+L80: clr r4
+rts
+rts
+L81: .data -443, 427, -922
+sub #165, r7
+sub *r5, r4
+mov L247, X8
+jmp *r6
+cmp #204, r3
+
+mov L177, r5
+L82: sub L103, *r6
+red r0
+not X7
+inc *r2
+sub r5, L115
+not X22
+L83: red *r4
+dec r2
+L84: .data -796, 225, -144
+stop
+L85: .data -973, 212, 35, 62, 581
+L86: clr *r1
+inc L162
+add L32, X13
+L87: .data 629, 281, 445, 493, 746, -347, -670, 324
+lea L26, L1
+add #-81, *r3
+inc X21
+add #197, L152
+L88: bne L109
+L89: .string "biyzyyipapcwluugldxl"
+not *r7
+rts
+not r4
+red *r1
+stop
+inc r5
+L90: .string "yzxbvtdie"
+cmp #202, X0
+L91: cmp #-199, X5
+rts
+dec r1
+sub L60, *r1
+not L177
+red *r1
+red r4
+red X23
+red X6
+bne X9
+cmp L232, #161
+prn #22
+cmp #208, L165
+prn X0
+rts
+
+inc L125
+prn L48
+; comment
+jmp *r1
+not r2
+L92: red X5
+sub *r2, X16
+dec r5
+mov *r2, X18
+bne *r2
+inc r4
+; comment
+L93: rts
+add L245, *r2
+; comment
+L94: cmp #104, L105
+L95: cmp r4, r5
+rts
+L96: .data 784
+jmp X7
+L97: stop
+jmp *r3
+dec r3
+add r0, X10
+cmp L5, r2
+prn L8
+stop
+mov *r0, *r0
+L98: prn #-80
+not r4
+jmp X5
+L99: rts
+prn L11
+prn X20
+not r2
+add #-211, *r1
+L100: jsr *r4
+clr L186
+add *r5, *r7
+red *r2
+L101: add X13, *r1
+lea X18, *r4
+L102: dec *r1
+inc L1
+L103: .string "zmmhuqckizewhptksi"
+jsr X8
+not *r1
+L104: .string "euvqluflmsfcoadwkcwzf"
+L105: .string "colixsjibtzmyjqzwiiwh"
+mov X21, *r0
+jmp *r1
+rts
+jmp X24
+rts
+L106: sub r3, r1
+L107: .data 108, -403, 317, 460, 212
+dec *r6
+mov #-87, X24
+jmp *r6
+stop
+sub #-152, *r5
+prn L254
+bne *r1
+add *r5, L249
+clr r4
+L108: .string "xidmouightnae"
+stop
+not r5
+L109: .data -92, -474, -178, -849, 138, -4, -28
+L110: mov #29, r6
+L111: .data -70, 581, 339, 985, 693
+jsr L140
+L112: stop
+stop
+rts
+bne *r2
+add #88, *r4
+dec r1
+dec X20
+L113: .data 238, -274, 653, 607
+sub *r4, r6
+mov #-186, L38
+prn #-67
+prn r7
+L114: .data -673, 247, 351, 530, 756, -310, -493, 215
+rts
+not *r7
+; comment
+sub *r4, *r3
+dec L133
+jsr *r2
+L115: rts
+prn r5
+dec *r0
+red r3
+add r7, r0
+prn #171
+sub *r2, *r6
+
+clr *r1
+inc *r0
+jmp X19
+L116: .string "nlpxqalinbqcwrwknbp"
+jsr L50
+add X13, r0
+
+rts
+L117: dec X12
+red X8
+not L20
+prn #71
+L118: cmp #-25, X9
+add #22, r6
+inc *r0
+sub #-112, *r5
+L119: clr *r6
+cmp X23, L239
+; comment
+clr *r6
+sub L157, X20
+red r0
+clr r6
+jmp *r4
+clr *r1
+stop
+L120: red *r1
+L121: red r5
+; comment
+stop
+lea X7, *r6
+mov #223, r2
+mov *r7, L195
+stop
+L122: .data -291, 963
+jsr *r6
+; comment
+prn L179
+lea L125, *r3
+mov L140, X13
+red r4
+clr r5
+L123: add L187, *r1
+inc *r6
+inc *r6
+add #-102, *r0
+red r2
+; comment
+red r2
+L124: .data -172, 747, -417, 794
+L125: .data 866, -258, 870, 788
+L126: sub r5, r6
+L127: .string "fpzxswbezaoxoixhzdlnkx"
+jmp L115
+inc L31
+L128: lea L189, r7
+stop
+prn #100
+not *r5
+L129: add *r6, r3
+; comment
+sub L154, *r5
+inc r1
+L130: .data 599, 274, 763, -360, 501, -211, 460
+not L240
+L131: not r2
+L132: jmp L17
+jsr *r7
+L133: not *r0
+sub #150, r0
+not L21
+add #-84, *r0
+dec *r2
+jmp *r3
+not r7
+sub *r5, *r3
+clr r0
+dec *r1
+stop
+L134: .data -473
+mov *r5, r6
+jmp L217
+L135: .data 49, -39, 104, 332, 135, -304
+L136: .string "shelhmcqqgaucp"
+inc L155
+mov #170, X3
+L137: .data -517, -359, 706, -122
+L138: stop
+L139: rts
+jmp X22
+cmp *r7, X1
+not *r4
+prn *r1
+
+cmp *r2, L133
+not L188
+jsr X7
+rts
+lea L234, *r2
+L140: clr r4
+rts
+inc r7
+; comment
+L141: red L48
+sub #140, L218
+rts
+cmp L112, L41
+clr *r4
+sub r4, r0
+add #-17, *r3
+inc r1
+L142: .string "cupxilxwgzgknjewldobunvv"
+bne L182
+bne L25
+L143: red *r1
+red L217
+L144: bne L236
+L145: .data -960, 288, -474, -912, 876
+; comment
+stop
+mov r4, *r4
+
+sub X12, *r0
+prn #-151
+prn *r5
+bne *r0
+prn r0
+L146: .string "qeowvuceniqtremg"
+mov r7, r6
+sub L28, *r2
+L147: stop
+bne *r4
+clr r5
+L148: .data 299
+inc X10
+bne *r1
+L149: rts
+L150: lea X5, r6
+jmp X9
+red *r3
+L151: jsr L8
+L152: not X9
+not r0
+mov *r7, r6
+L153: cmp L101, *r6
+; comment
+L154: red r1
+add #-235, *r1
+L155: cmp #-232, #107
+lea X2, L178
+rts
+mov X22, r7
+not X9
+L156: jmp L154
+L157: .data 615, -420, -733
+L158: .string "rpb"
+prn r6
+mov *r1, r1
+L159: mov L189, r2
+L160: rts
+bne L19
+inc L245
+L161: .data 712, 604, 955, 284, -992
+jsr *r4
+stop
+jmp *r3
+L162: clr *r7
+rts
+stop
+L163: .string "ioyulhajze"
+L164: .string "igtnffignjrdvgnhmktppo"
+dec *r7
+L165: .data -769, -231, -792, -847, -695, -936, -803, -155
+not L190
+stop
+L166: .string "ktrwuobypnnqiiqawmoencbq"
+prn L151
+add #147, *r6
+rts
+red L58
+stop
+sub *r1, *r0
+L167: not L211
+not X9
+cmp X6, r7
+L168: .data 748, 809, 141, 990, 659, -978, 728
+add r7, X15
+L169: jmp X2
+red X19
+rts
+bne *r4
+L170: add *r7, *r2
+add X9, *r5
+L171: .string "nvoeeqgezel"
+sub #115, r4
+; comment
+mov #1, L39
+lea X16, L222
+bne *r6
+jmp L183
+mov r1, X24
+inc r3
+L172: dec *r3
+stop
+jsr X24
+stop
+
+inc L200
+red X10
+
+; comment
+jmp L21
+bne *r7
+stop
+cmp L141, #-181
+red r2
+lea L254, *r4
+mov *r6, *r0
+not *r4
+rts
+L173: stop
+L174: .string "meivyeyl"
+add r3, L179
+rts
+add r5, *r3
+L175: .data -420, -772, 947, -185, -831, -733, -380, -960
+inc *r3
+L176: .data 362, 568, -100, 743, -842, 861, -556
+clr L93
+bne *r4
+sub *r2, L64
+; comment
+not *r1
+; comment
+inc L20
+L177: bne *r0
+rts
+L178: red *r0
+jsr *r3
+inc *r7
+L179: .data 216, 801
+sub #138, r1
+inc r5
+prn r4
+L180: .string "dqgghxclbdped"
+; comment
+add #-47, L112
+rts
+inc L191
+L181: .data -913, 138, -533
+red r5
+inc r4
+L182: mov r7, L148
+bne *r6
+L183: .data -395, -399, 614, 532
+add L131, *r2
+rts
+L184: stop
+add L244, r6
+L185: .data -133, -575
+L186: cmp r5, #227
+lea X8, *r6
+L187: bne L224
+rts
+L188: .string "upzhhvxpjda"
+L189: jmp *r4
+L190: jsr *r3
+mov r3, *r7
+bne L97
+rts
+not r7
+not L198
+not L202
+L191: cmp r2, L150
+L192: .data -206, -581, -176, 375
+L193: bne *r6
+stop
+add r2, r7
+jsr L124
+inc X8
+; comment
+L194: red r3
+sub r0, L32
+not L59
+bne *r5
+inc X24
+sub *r4, L235
+L195: clr r2
+bne *r4
+red X5
+not r2
+; comment
+jsr *r1
+L196: red L88
+clr X5
+add X23, *r2
+L197: .data -608, 747, -992
+mov #252, *r1
+mov X21, *r1
+red r1
+clr *r0
+jsr *r7
+clr *r0
+not *r7
+; comment
+prn L192
+L198: bne X2
+
+red *r3
+L199: cmp *r1, #154
+prn #245
+sub *r0, r2
+L200: .string "hpzxeyfluaysatqtw"
+jmp X17
+not r0
+dec L163
+L201: .string "fxqjk"
+L202: .data 621, -360
+clr r6
+mov X22, *r7
+bne L77
+
+add #-61, X15
+bne L26
+cmp #175, *r7
+L203: .data -210, -954, -649, 626, 380, -259
+mov L224, *r3
+dec r0
+inc L45
+mov L208, L220
+bne *r7
+bne L183
+
+add #79, *r3
+L204: red *r2
+jsr X3
+L205: .data 553, -452
+prn #-55
+lea L205, r6
+clr L47
+sub *r1, *r2
+L206: lea L248, *r0
+lea L132, *r4
+bne *r7
+clr *r2
+clr *r3
+rts
+rts
+dec r7
+L207: .data -471
+L208: dec r0
+L209: red r1
+add #-254, r1
+jmp *r0
+L210: bne L195
+cmp #-150, L194
+red X13
+L211: red r4
+jsr *r4
+sub r3, r4
+L212: lea L242, L7
+
+lea L208, r5
+jmp X0
+add L37, X22
+rts
+L213: .data -567, 841
+stop
+stop
+L214: .string "yqcxlygkmtfquonwd"
+sub L81, r7
+stop
+stop
+L215: lea L240, r5
+rts
+L216: .string "frvuvfxzxojlhxkvopsvgjr"
+clr L194
+L217: .data -547, -745, 26, -543
+L218: lea X23, r4
+L219: .string "libzluwbovvixzpjwl"
+L220: .string "pbyxgkzlrrfvpffzrslahyc"
+lea X10, L247
+L221: mov r1, *r0
+L222: .string "wbgkf"
+mov *r4, r1
+L223: bne *r4
+bne *r5
+rts
+L224: jsr X6
+jmp L248
+rts
+add *r0, X10
+L225: inc L138
+red X11
+dec *r0
+not *r1
+jsr L245
+lea L241, r1
+L226: not r5
+dec X6
+prn L228
+dec r6
+prn *r5
+lea L28, r3
+
+add X23, X16
+inc L238
+mov #234, X20
+lea X5, X15
+L227: .string "pwbwizvbnpxqymzygjbsuz"
+cmp r5, L157
+cmp r0, L15
+cmp #-98, L219
+bne *r2
+red X6
+dec *r0
+add *r2, L233
+rts
+L228: .data 543, -825, 539, 698, -671, -458, -294, 564
+L229: not L242
+stop
+mov #-185, r5
+L230: stop
+bne *r4
+jmp *r6
+jsr *r0
+L231: lea X5, L192
+lea L233, L255
+sub X6, *r6
+L232: .data -619, -771, -979, -103, 17, -723, 75, 456
+prn L229
+L233: jmp *r4
+red L13
+bne *r3
+inc *r3
+rts
+red r2
+L234: mov L101, r7
+L235: clr L100
+L236: jsr *r6
+jmp *r2
+
+lea L73, r4
+L237: .data 694
+add *r6, *r7
+bne *r7
+red *r6
+mov #-21, L246
+cmp X18, #-244
+bne *r4
+jsr *r2
+cmp *r5, r7
+sub *r5, r5
+prn #88
+L238: jsr L209
+stop
+not X10
+red L245
+L239: bne X8
+L240: .data 174, -686, 989, -719, -138, 751, 892, -911
+rts
+dec r2
+add r4, r3
+stop
+add *r6, L31
+rts
+cmp r6, r5
+L241: .data 575, 528, -635, 816, -362, -737, -907, -704
+bne *r4
+not *r2
+sub #249, L147
+not *r4
+L242: .data -83, 160, -105, -948, 189, -165, 943, 933
+cmp r0, r3
+red r7
+mov X12, X22
+sub r7, L246
+L243: clr r4
+cmp r2, *r0
+prn r0
+bne *r7
+L244: rts
+L245: not *r1
+L246: .data -814, 642, 878, 138, 367, 488
+; comment
+add X7, X11
+rts
+cmp #134, *r7
+jmp *r1
+dec *r6
+red r4
+dec *r6
+clr *r5
+L247: inc L252
+red L28
+inc L90
+stop
+
+
+lea L252, *r4
+L248: inc L71
+add X22, r6
+dec r6
+bne X21
+jsr *r0
+dec *r4
+lea L66, r7
+clr L253
+L249: .data -254, 158, 908, -12, 892, -888, 633
+add #92, r1
+add L136, *r2
+mov #-244, L17
+not X4
+add *r0, r6
+L250: jsr L256
+L251: add #-245, X18
+L252: .string "anwtcpwbldtgsqn"
+not r6
+add L40, *r2
+mov L57, *r2
+mov r2, *r4
+clr *r2
+
+L253: add r2, *r1
+mov *r6, L255
+not *r4
+L254: clr r6
+not L214
+prn r3
+sub #6, r4
+mov *r2, L254
+add *r1, *r1
+L255: add L256, *r4
+L256: lea L113, *r0
+inc *r3
+sub L3, *r4
+stop
@@ -0,0 +1,1045 @@
+; Generated by genCorpus --seed 26
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+red r4
+stop
+clr *r1
+L0: clr L273
+; comment
+L1: clr X16
+stop
+add *r3, L1
+red r4
+stop
+rts
+dec L56
+clr *r4
+inc X6
+L2: .string "glyuurgaldremlaifdg"
+mov *r6, L1
+dec *r5
+not r7
+L3: .data -756, -341, 404, 265, -787, -257
+lea X13, *r0
+stop
+sub L208, r7
+stop
+lea L1, r4
+L4: bne *r0
+add r0, r1
+inc *r1
+dec *r7
+bne *r3
+not r3
+dec r6
+L5: dec r2
+mov *r5, *r4
+clr L4
+
+L6: red r1
+mov r3, *r5
+mov #60, L6
+inc r2
+dec r0
+prn *r0
+stop
+L7: not r5
+L8: sub #64, X22
+prn r7
+L9: rts
+bne X5
+jmp *r6
+red *r2
+; comment
+L10: red *r7
+; comment
+L11: rts
+L12: dec X3
+L13: .string "dlomruugzlskvdwthdlwea"
+jsr *r6
+mov *r5, r7
+
+not r1
+L14: clr L8
+L15: .data 786, -457, 983, -501
+prn #55
+L16: rts
+jmp L79
+L17: .data 898, -198, 839, 828, -516, 277, 790, -732
+jsr *r0
+L18: prn *r4
+rts
+inc L85
+red r0
+; comment
+add #-81, r3
+stop
+jmp *r7
+prn r7
+prn #226
+L19: .string "ubbgshxqtpomv"
+jsr X19
+mov L7, r6
+prn r3
+bne *r5
+jmp L59
+stop
+sub X1, *r2
+stop
+bne *r6
+L20: rts
+L21: clr L225
+prn L99
+L22: prn r6
+sub *r2, L48
+rts
+prn X4
+sub r2, X5
+jmp *r1
+bne *r2
+jsr *r7
+L23: stop
+clr r7
+cmp r5, r4
+L24: .data -727, -868
+L25: mov r4, X5
+rts
+red *r7
+jmp *r0
+prn L3
+dec r3
+rts
+inc X0
+rts
+L26: clr L15
+dec r6
+bne *r5
+jsr *r2
+rts
+sub *r2, *r1
+L27: .data 327, 708, -542, -601
+clr L7
+red r0
+dec *r0
+dec r3
+jsr *r5
+L28: .data -296
+clr *r6
+cmp L12, *r0
+jsr *r1
+lea X4, L80
+dec r0
+prn #201
+stop
+L29: mov X21, r3
+L30: jsr L2
+L31: inc r4
+red r2
+inc *r3
+L32: .data -854, -97, -452, -285, 567, 256
+dec r4
+L33: red L60
+jsr *r2
+L34: .data -950, -55
+rts
+cmp #-224, #48
+L35: .data -616, 549, 499, 898, -996
+L36: stop
+add r7, X7
+dec L133
+L37: .data -920
+L38: jmp *r6
+lea X16, r2
+
+bne *r3
+jmp *r3
+inc L31
+red r6
+L39: cmp *r6, *r0
+L40: mov *r2, L253
+dec X9
+rts
+L41: prn r3
+L42: .string "tcvfskwwhs"
+add L23, r4
+red *r7
+add X18, r6
+; comment
+bne *r6
+L43: add L88, *r5
+dec L2
+add X9, *r5
+mov #88, r0
+L44: not r5
+mov #153, r4
+stop
+jsr *r1
+add r4, r0
+mov *r1, r6
+L45: bne X4
+L46: red r1
+; comment
+sub r1, L155
+mov *r1, L229
+L47: clr r3
+inc L260
+stop
+stop
+L48: not r2
+lea L187, r1
+cmp *r3, L55
+clr r6
+rts
+lea L267, X1
+L49: cmp L137, r6
+L50: stop
+red r4
+; comment
+red L161
+not r4
+dec *r6
+jsr *r0
+L51: prn #-101
+L52: .data 342, -55, -820, 383, -315, 417, 194, -436
+rts
+L53: rts
+dec L262
+L54: lea L32, *r0
+inc *r7
+sub *r7, X13
+jmp *r0
+L55: jmp L67
+L56: rts
+jsr *r6
+jsr *r5
+bne L39
+
+lea X10, *r3
+rts
+rts
+jmp *r6
+red r7
+dec r0
+dec *r4
+L57: .string "wjqqptbzff"
+inc L44
+L58: bne X9
+add r5, r4
+L59: .string "ri"
+add #-59, r3
+L60: lea L243, r0
+L61: stop
+L62: sub r7, r6
+L63: .data 413, -209, -777, 12, 834, 927, 505, 892
+inc L3
+not r0
+L64: .data 62, 175, -424
+stop
+sub #-105, *r0
+red *r1
+mov #-13, L34
+mov *r6, *r5
+sub L216, r0
+lea L266, *r7
+jsr L32
+; comment
+red *r2
+not *r6
+mov r2, r2
+L65: prn *r6
+sub r4, *r1
+clr *r3
+L66: bne L197
+L67: sub #-105, L135
+add r4, L107
+L68: bne *r1
+red r6
+mov #-229, X24
+; comment
+
+inc L202
+cmp *r4, #-181
+L69: red *r4
+dec L189
+stop
+L70: jsr X8
+L71: .string "rawvkiuwfhqvwrjxyfatxoq"
+L72: bne *r7
+L73: .data 712
+L74: prn L195
+sub r2, r1
+L75: .string "nipummjslstkliamarhtbawt"
+mov #-74, L26
+prn #110
+rts
+; comment
+L76: lea L1, r3
+jsr *r3
+add #172, *r5
+L77: not *r5
+L78: .string "rynygf"
+red L55
+prn #-154
+
+dec L159
+L79: mov #59, r3
+mov *r5, X7
+L80: stop
+rts
+jmp *r3
+inc r5
+jmp X4
+bne X24
+bne L75
+dec r6
+lea X21, r6
+rts
+L81: stop
+L82: .string "wrpiragz"
+cmp r3, r7
+L83: .string "fellbhrxanavlmnrtkvigj"
+jsr *r0
+L84: .string "fldwlxmmzoa"
+L85: inc *r7
+L86: cmp *r0, X2
+L87: .string "zkdsbavjtipggdnmry"
+sub *r7, r1
+; comment
+bne *r2
+rts
+L88: .string "ch"
+red r3
+inc *r2
+cmp r5, #19
+red L184
+add L11, r6
+bne *r1
+prn r0
+cmp r0, #-172
+jsr L2
+add #175, *r0
+jmp *r4
+prn #-179
+L89: add *r6, r5
+L90: add #83, *r0
+rts
+inc L147
+red X6
+L91: clr r7
+mov #43, *r6
+bne L3
+bne X18
+L92: sub r2, r3
+jmp X21
+lea X20, *r4
+stop
+jsr L203
+sub #20, L254
+jmp *r5
+L93: mov *r4, *r4
+not r6
+not r1
+lea L229, r2
+red *r4
+L94: not L23
+mov *r4, r7
+mov r0, r6
+jmp *r2
+L95: .data -799
+jsr L2
+jsr L254
+L96: .string "fkixbqkjmzgonyqem"
+not *r1
+rts
+L97: dec *r4
+red *r4
+L98: jmp *r0
+L99: lea L214, r7
+bne X21
+mov #-180, *r1
+stop
+cmp #-46, #-47
+red *r0
+L100: rts
+lea X0, L235
+L101: not *r5
+L102: .string "cgctvvaknlya"
+stop
+inc L196
+L103: .data 325, 726
+sub L198, r5
+prn L103
+jmp *r6
+jmp X10
+cmp #-73, r2
+mov #75, X7
+cmp *r4, r5
+L104: red L17
+sub #154, L190
+not X1
+L105: .data -306, 166, 785, 907, -824, -774, 817
+L106: clr X24
+rts
+L107: not *r5
+jsr X24
+dec L16
+jmp *r4
+lea L153, r0
+red L38
+cmp *r3, r7
+prn r7
+prn L205
+stop
+bne *r3
+L108: .data 925, -248, -583, -205, 21
+; comment
+L109: prn r3
+L110: dec L262
+L111: not *r0
+L112: cmp *r6, *r1
+add *r2, r5
+rts
+sub L66, L109
+L113: clr r4
+L114: bne L28
+rts
+lea L39, L215
+L115: .data 263, 588, 340
+L116: .string "dmqjtmuxf"
+L117: .string "aywropeqxvhiempwygtildh"
+red *r6
+rts
+cmp *r6, r3
+red r5
+prn *r0
+inc X23
+L118: inc *r5
+inc L113
+not L52
+L119: not X10
+L120: cmp #-3, X14
+L121: clr X0
+L122: .data 244, 53, 863, 77, 289
+add *r0, r7
+clr r5
+clr r6
+clr r6
+L123: .data -611, 892, -967
+inc *r6
+red r7
+L124: .data 646, -786, 579, 300, 731, -229
+rts
+clr *r2
+prn *r5
+clr X15
+
+clr r0
+rts
+L125: .string "sngqputyygxuxmj"
+L126: red r4
+jsr L232
+lea L101, X2
+mov *r4, *r4
+dec L144
+L127: rts
+L128: lea L267, X18
+stop
+stop
+rts
+jmp L167
+cmp *r1, r3
+bne L65
+red r6
+inc *r5
+inc *r2
+L129: not *r4
+clr r5
+prn #-105
+dec X9
+dec r0
+red *r1
+prn #-254
+jmp L59
+dec *r2
+cmp X6, r4
+L130: rts
+L131: .string "ypu"
+L132: inc L239
+L133: .data 305, 5
+red *r5
+L134: jsr *r0
+L135: lea L60, r0
+sub L129, L4
+L136: .data 524, 834, 931, -240, 603, 535, 412
+stop
+dec r5
+cmp r6, *r1
+rts
+bne L269
+rts
+inc L98
+inc r5
+dec r1
+stop
+L137: not *r3
+L138: prn *r4
+lea L254, X2
+L139: jsr *r2
+cmp #-133, #-145
+L140: jsr *r5
+add L255, *r3
+L141: rts
+sub #173, L240
+L142: mov #-119, r6
+sub X21, *r4
+L143: inc r0
+stop
+rts
+rts
+L144: cmp X8, L25
+inc *r1
+stop
+bne *r1
+L145: bne L103
+L146: .data 922, -472, 287, -158, -417, -308, -965, -434
+bne L191
+prn #51
+bne X23
+L147: .string "llhs"
+dec r5
+L148: .string "kmxdnlgimvpbwo"
+prn r0
+prn #238
+bne L161
+sub *r6, r4
+not r4
+L149: jsr *r7
+L150: bne L182
+L151: clr L32
+add #-111, *r3
+lea X3, X24
+jmp *r3
+stop
+mov #-90, r6
+dec L76
+L152: add r6, *r0
+L153: .data -936
+; comment
+L154: .string "zlsvwhmlwopnokdhgthc"
+jsr L186
+jmp L137
+L155: clr r6
+mov #236, r1
+stop
+sub L164, *r7
+L156: prn X16
+mov #34, r1
+jmp *r4
+dec r7
+clr *r6
+clr X4
+mov #164, *r3
+stop
+L157: add X21, L66
+not L213
+jmp *r4
+cmp L227, X22
+dec X19
+bne X8
+cmp #-143, r7
+inc L185
+prn L214
+stop
+L158: .data -518, 730, -603, -40, -856, -786, -936, 725
+clr L75
+add r2, *r7
+sub r2, r3
+add *r2, L181
+jsr L244
+jsr *r6
+jmp X12
+not L180
+add *r5, *r3
+inc L266
+sub #113, *r3
+jmp *r5
+L159: stop
+not *r6
+jsr *r3
+sub X11, *r3
+bne *r7
+L160: cmp r3, *r3
+L161: lea L223, *r7
+not *r6
+L162: rts
+mov X3, r6
+; comment
+; comment
+mov r5, r7
+not r7
+rts
+lea L222, r5
+clr *r3
+not L261
+inc r1
+
+dec r0
+L163: .string "yyeauhqwvg"
+L164: .string "cdfufunulv"
+bne *r5
+clr r4
+cmp *r7, #44
+L165: clr r5
+jsr *r5
+add L115, *r2
+not r3
+jsr *r7
+prn X2
+L166: bne *r6
+not r0
+prn #192
+L167: red r1
+sub *r1, *r4
+clr *r4
+jmp *r7
+bne *r4
+L168: .string "ttbjdyltkanzuorbzigdtxb"
+mov r4, *r2
+red *r4
+rts
+jmp *r5
+clr r4
+L169: inc r3
+sub L260, r1
+; comment
+L170: rts
+L171: jsr X18
+L172: stop
+L173: rts
+dec *r7
+cmp *r1, *r0
+mov #142, r2
+L174: rts
+L175: add r5, *r3
+jmp *r0
+L176: .string "qmcdrfzzcpzxaq"
+L177: dec r1
+L178: red X19
+not L130
+L179: .string "qsirug"
+inc X8
+L180: sub *r4, *r3
+L181: jsr *r3
+sub L40, X5
+L182: mov X21, r3
+not *r5
+L183: .data 208, 999, 893, 367, -522, 420, -440
+L184: .string "baoxlkwmxrnfsnycnqyi"
+L185: .string "gxiehvklcbzjpgkqskhhx"
+add *r2, *r0
+lea X2, *r4
+prn #159
+
+L186: jsr *r0
+not r2
+add #-186, L192
+L187: rts
+prn *r6
+mov *r1, r7
+
+L188: .string "sohalxdirs"
+clr X6
+jsr L42
+lea L258, L224
+inc L54
+stop
+mov L38, r1
+lea X19, *r2
+stop
+L189: jsr *r1
+prn #200
+L190: stop
+dec *r2
+inc r1
+L191: .string "zohdoegsyicb"
+L192: bne X19
+L193: dec L197
+rts
+stop
+bne *r3
+red X14
+clr r1
+jsr *r4
+prn r1
+dec L143
+; comment
+L194: red r0
+jmp L251
+inc r4
+jsr *r2
+
+L195: sub #83, L186
+L196: lea X12, L272
+stop
+inc *r2
+inc L68
+rts
+inc r6
+cmp r2, X16
+cmp *r1, r4
+jmp *r3
+L197: sub *r6, r2
+bne *r4
+not X20
+
+rts
+not r6
+inc *r6
+bne *r6
+red X2
+L198: rts
+sub *r5, L228
+L199: inc X12
+add L150, *r6
+L200: jsr L11
+add #-87, r5
+jmp L169
+bne L167
+rts
+cmp X15, X22
+L201: sub *r5, r7
+add *r6, r6
+L202: clr *r1
+L203: add *r4, r4
+red *r0
+rts
+cmp *r4, *r6
+add #9, r1
+dec L140
+L204: cmp L122, *r3
+bne *r7
+jsr *r1
+rts
+prn *r0
+clr r1
+L205: inc r2
+rts
+lea L211, r5
+mov r3, r6
+bne L237
+L206: .data 321, -347, 303, 675
+red *r0
+sub X20, *r6
+red X11
+prn *r7
+red *r0
+jmp L256
+L207: cmp *r3, #-113
+L208: inc r3
+prn L272
+not r0
+jsr *r7
+bne X12
+
+add L264, r1
+L209: .data -615, -560, 827, 765, -62, 26, 879
+; comment
+lea L264, r1
+L210: .data -501, 188
+L211: .string "dwprhdtpnp"
+rts
+L212: .data -21, -168, -676, -249, -281, 723, 622
+L213: dec *r1
+jsr L203
+not L25
+prn *r4
+inc *r3
+clr *r2
+L214: .data -394, 908, -770, 170, 578, -633
+
+dec *r0
+cmp r1, #-168
+sub #-51, r4
+
+L215: .data -611, -56, 837, 150, -112, 155, -318
+inc r2
+red L200
+cmp *r0, L160
+L216: prn #-156
+prn *r5
+stop
+red r3
+not r3
+L217: .data -291, -541, 931, 791, 430, -990, 26
+lea L263, r6
+stop
+jmp *r1
+rts
+L218: bne L234
+lea X9, L6
+L219: dec L37
+add *r3, *r3
+cmp #128, #106
+L220: .string "awctrximtevbrollqltrhmzl"
+bne *r0
+cmp *r5, #-208
+
+bne *r7
+cmp *r4, X4
+L221: clr r6
+rts
+mov r5, r5
+; comment
+bne L64
+L222: sub #192, r3
+jmp L115
+sub *r2, L252
+add #32, r0
+sub *r5, *r2
+L223: .data -281
+not X1
+rts
+cmp #-198, r1
+dec r0
+rts
+L224: bne *r7
+add X10, *r3
+L225: .data -43, 622, 792
+bne *r2
+L226: .data -507, -482, -330, -96, 6
+
+rts
+cmp X10, r4
+L227: clr r3
+inc r3
+L228: stop
+
+jsr *r5
+
+L229: add *r4, r3
+not *r2
+mov L264, r4
+dec X24
+L230: sub r0, r4
+L231: dec L274
+stop
+L232: add r2, *r7
+red r6
+mov *r1, L216
+L233: .data -519, 108, -965, 166, 599, 320, -33
+prn r5
+; comment
+lea L140, *r4
+not r6
+
+not *r5
+rts
+
+lea L203, L273
+
+prn *r4
+L234: jmp *r5
+L235: dec X1
+dec *r3
+red X21
+red L154
+sub r1, *r4
+lea L267, r3
+jsr L268
+rts
+; comment
+rts
+prn #51
+lea L257, X13
+stop
+inc L78
+inc r3
+cmp #-202, *r5
+; comment
+bne *r6
+L236: .data -994, 688, 207, 761, -922, -375, 153
+L237: cmp L119, *r5
+L238: red *r3
+jsr *r1
+lea L270, r2
+L239: add r1, *r0
+L240: inc *r7
+jmp X9
+; comment
+add r6, r0
+rts
+L241: prn *r6
+rts
+inc L88
+lea X1, *r7
+cmp *r3, *r3
+
+
+L242: not L276
+lea L255, r5
+; comment
+dec L277
+L243: red r4
+cmp #-10, r7
+L244: not r6
+L245: lea X13, r0
+L246: .data -36, -291, -33, 53
+cmp L250, #46
+prn L44
+not L69
+L247: not X9
+mov #27, L253
+bne L272
+not L53
+L248: mov #-188, L251
+mov #-216, L255
+bne *r3
+L249: not r7
+add L85, *r7
+L250: inc *r4
+cmp X14, L73
+L251: jsr *r5
+sub r7, *r6
+prn *r7
+jmp *r4
+L252: red *r2
+rts
+L253: sub #4, L218
+prn #-233
+L254: mov *r2, X4
+
+L255: sub X16, X17
+red L94
+L256: prn L125
+rts
+not r1
+mov #-236, *r0
+mov X9, X6
+L257: red L107
+L258: dec L252
+lea L270, r0
+red L237
+bne *r1
+dec X22
+dec L72
+L259: add L272, r1
+rts
+jsr *r0
+L260: stop
+lea X20, *r5
+lea L273, L4
+cmp *r0, #133
+L261: .data 499, -363, 480, -604, 722
+L262: jsr L269
+inc L253
+dec L1
+clr r4
+lea L272, *r3
+not X11
+sub r6, r7
+L263: .data 601, 190, -497, -595, 955, 560, -363, 327
+bne *r7
+stop
+L264: stop
+add #185, X15
+stop
+dec r3
+mov X21, r6
+rts
+dec L272
+clr r6
+stop
+red r3
+sub #151, X1
+L265: bne L266
+
+L266: red *r1
+bne X14
+rts
+sub r2, r4
+not r7
+L267: prn r0
+dec r3
+sub r4, X15
+dec X6
+cmp #15, *r5
+bne *r4
+bne *r5
+rts
+L268: .data 627, -275, 338, -201, 403, -381, 586
+clr r6
+add L275, *r6
+red L11
+L269: stop
+inc X1
+sub X14, L272
+jsr *r3
+inc L273
+rts
+jmp *r5
+L270: dec L18
+L271: .string "iqqinpcsfrhub"
+
+jmp *r5
+rts
+L272: bne X8
+jsr *r2
+inc L87
+add #-46, *r7
+jmp L275
+dec X18
+L273: prn #224
+inc L274
+L274: .data -490, 844, -19, 974, 612, 457, 540
+jmp *r4
+L275: inc r6
+mov *r3, *r2
+L276: clr *r2
+L277: .string "ehupijyoq"
+not X17
+; comment
+mov r7, X24
+clr r6
+not r3
+stop
@@ -0,0 +1,1046 @@
+; Generated by genCorpus --seed 27
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+not r0
+L0: .string "b"
+L1: bne *r5
+red *r2
+clr *r1
+add *r2, *r0
+jsr X12
+add L0, r7
+add *r3, r4
+L2: add r5, *r7
+L3: .string "isxnqs"
+sub X12, *r4
+cmp #-85, L248
+L4: .data -158, -496
+dec L2
+not r2
+L5: add *r2, *r6
+jmp *r2
+jmp L143
+L6: dec *r4
+add r6, X16
+bne X14
+L7: inc *r6
+L8: .data -105, 937, 337, -863, 870, 997, 77
+inc r2
+clr L5
+sub #23, *r3
+; comment
+lea X22, r3
+L9: .string "xmudqttxzhjqtetg"
+dec r6
+red r0
+jsr L143
+L10: dec r5
+cmp #-252, X15
+jmp X20
+; comment
+rts
+L11: sub *r3, r3
+jmp *r4
+inc r2
+rts
+L12: red L3
+L13: bne L5
+red *r5
+inc *r0
+lea X13, *r5
+L14: .string "rwltvafynpvtbvppblu"
+L15: sub *r3, *r6
+L16: jmp L159
+jsr X5
+sub L209, r7
+cmp X8, X4
+add r0, *r1
+jmp *r2
+L17: .string "qrye"
+rts
+L18: stop
+inc *r6
+L19: .data 343, -260, 428, -616, 481, 137, -787
+sub L180, *r4
+prn L216
+L20: dec L269
+cmp L13, #-75
+L21: rts
+L22: cmp r0, *r3
+L23: .data 768, 98, 919, -963, 310, -409
+L24: prn #-108
+L25: lea L224, L211
+jmp *r5
+lea X5, r1
+mov r1, r1
+jmp X6
+L26: .data 678, 277, -975
+stop
+lea X22, *r4
+mov L14, *r2
+sub *r3, r6
+lea X12, r0
+jsr L26
+bne *r7
+L27: mov L7, L20
+stop
+cmp *r5, #-59
+L28: dec *r6
+L29: jsr X6
+clr *r3
+; comment
+L30: .string "qgxytq"
+dec L172
+sub X18, *r3
+L31: .string "adivkkar"
+stop
+cmp r4, r5
+bne L160
+mov #8, L163
+L32: jmp L55
+mov L7, r3
+L33: .string "yajadvocbdok"
+red *r4
+lea X10, *r4
+L34: jmp *r1
+L35: jsr L32
+mov *r5, r1
+; comment
+L36: sub r5, L282
+jsr X20
+L37: lea L168, *r3
+inc r0
+prn #-228
+jmp *r7
+L38: .data 30, 526, -696, 462, -582, 44, 89
+prn X22
+prn #190
+stop
+not *r3
+bne L34
+lea L2, r4
+L39: not *r7
+clr *r0
+L40: inc r3
+prn #-35
+inc X23
+L41: add L58, *r1
+
+cmp X8, #-42
+L42: jmp L17
+L43: prn #-236
+L44: .string "uotugtrmqhriozqrqlg"
+L45: cmp r7, *r4
+L46: .string "wwyfabvfhjuxwsnqyibmvmqm"
+jmp X21
+cmp L30, r3
+stop
+mov L238, *r5
+lea L10, r0
+cmp r1, *r7
+not *r1
+red r2
+L47: .data -988, 82
+dec L47
+L48: .data 383, -677, 325, -991
+not r6
+L49: mov L68, X14
+stop
+bne L288
+mov #174, r1
+add X8, *r1
+stop
+bne X19
+jsr *r1
+L50: rts
+cmp r2, #-167
+bne L36
+lea X11, *r0
+sub #49, *r5
+dec r3
+L51: .string "vlvjdgzlcr"
+L52: inc r6
+dec L0
+; comment
+L53: stop
+jsr *r7
+jmp *r7
+L54: cmp *r6, r5
+jmp *r5
+dec L240
+L55: inc L48
+lea X2, L285
+add #216, *r4
+L56: prn L143
+L57: .data -182, -307, -954, 486, 950, 464
+L58: .data 112, 366, 470, -945, 995, 824, 879, -388
+L59: mov X21, *r1
+clr L36
+L60: bne *r6
+red r0
+not *r7
+L61: bne *r1
+add L150, *r0
+prn #-100
+clr r3
+L62: .data 759, -539
+sub *r3, r6
+red r0
+prn L41
+clr L263
+sub r3, *r1
+mov X24, L54
+dec *r4
+sub *r2, L2
+not *r4
+clr r7
+red L156
+cmp r3, L159
+inc *r7
+clr r1
+red L39
+inc L168
+red L53
+rts
+not r3
+L63: clr r7
+sub L34, L221
+L64: bne *r7
+L65: jsr X23
+L66: rts
+L67: dec *r2
+L68: lea X0, X12
+prn #152
+jmp L119
+L69: .data 305, -991
+L70: jmp *r6
+L71: not r4
+L72: jsr L28
+red r0
+jmp X4
+jsr L114
+L73: .data 548
+L74: mov X5, *r1
+prn #-170
+clr *r7
+lea L106, L215
+not r1
+dec *r2
+jsr *r4
+mov L231, *r1
+L75: dec *r3
+L76: lea L257, *r5
+jmp *r1
+stop
+rts
+; comment
+; comment
+stop
+
+L77: .data -23, -963, 598, -463, -708, -734, -639
+bne L41
+clr L272
+; comment
+bne *r3
+; comment
+stop
+not r5
+clr *r5
+L78: prn #152
+L79: cmp r5, #20
+rts
+L80: rts
+dec *r5
+clr *r1
+L81: cmp #141, #-150
+rts
+lea X7, r3
+red r3
+L82: prn r5
+jsr X8
+prn #134
+L83: add *r2, r5
+L84: .data -226, -755, -570, 791, 385, 556
+L85: inc *r7
+
+sub *r5, *r1
+prn r7
+sub #176, L234
+jmp L28
+inc X1
+inc *r2
+L86: cmp r5, L165
+add #-243, r0
+dec L93
+prn *r5
+cmp r6, *r5
+L87: lea X7, r2
+L88: jsr L61
+sub #-139, L87
+L89: stop
+lea L40, L213
+lea X2, *r6
+L90: stop
+L91: stop
+L92: clr r6
+not r2
+L93: .data -85, -127
+red *r4
+dec r3
+lea L217, X12
+L94: clr r5
+L95: .string "sysxngovwvxpaub"
+L96: .string "nyafjsdkx"
+rts
+not r6
+; comment
+stop
+add L47, L227
+mov #-188, L195
+stop
+L97: .data 301, -659, -845, -140
+; comment
+bne L74
+add X9, *r5
+jsr *r2
+jsr X12
+L98: .string "k"
+add *r6, X21
+L99: not X12
+
+L100: rts
+dec r1
+rts
+L101: .data -931
+jsr X18
+L102: .string "jinzemjenvxlhwjn"
+lea L157, *r2
+bne *r0
+inc *r6
+L103: add *r0, *r3
+cmp #222, #195
+clr X17
+jsr *r2
+L104: add #-204, *r6
+jmp *r7
+rts
+L105: jsr X14
+sub L227, *r5
+stop
+clr L55
+stop
+add *r7, r7
+add *r4, L156
+cmp L147, X4
+rts
+L106: sub r4, X19
+cmp r3, *r3
+inc r6
+L107: .data -160, 922, -57, -666
+
+cmp r6, L272
+lea L70, L118
+red r2
+mov X7, *r5
+bne *r7
+mov r4, *r0
+rts
+jsr *r1
+bne L234
+mov X15, X6
+stop
+cmp *r5, X16
+lea L0, *r1
+prn r3
+prn #18
+bne *r7
+L108: .data 309, -745, -193, 396, 764, 66
+stop
+L109: .data 448, 557, -499, -897, -545
+prn L236
+add X1, r5
+cmp r1, *r1
+prn X3
+cmp L92, r1
+L110: prn #7
+red r5
+red *r6
+jmp X15
+L111: .data -451, -289, 487
+L112: clr L100
+L113: lea L157, L117
+bne L276
+L114: lea X1, *r0
+L115: .string "wzmedqhtjhqzkrmuse"
+
+not L60
+L116: clr r3
+clr *r2
+add #253, r2
+not r2
+mov #0, L96
+jmp *r1
+L117: stop
+L118: stop
+L119: mov X13, L270
+stop
+prn *r5
+L120: jmp L9
+bne *r3
+add #201, *r4
+jsr L167
+L121: clr *r5
+red L49
+cmp r0, #81
+rts
+rts
+mov r1, *r1
+prn #86
+not r4
+clr L38
+L122: .data -175, 943, 461, -913, -44, -518
+mov L130, *r2
+cmp #2, X11
+L123: mov r2, *r0
+L124: .string "ifcoriqqoeyblpcb"
+L125: add L143, X19
+L126: .string "xdamgfvpijdpj"
+lea X21, *r5
+L127: .string "mvhdhdscu"
+L128: bne *r0
+L129: rts
+prn #250
+jsr L121
+sub #-196, X6
+clr r5
+L130: .data 826, -127
+bne *r3
+L131: clr r2
+jmp *r5
+add *r7, *r1
+prn r3
+mov r5, L293
+sub *r4, L17
+L132: prn X23
+lea X6, *r3
+rts
+inc r6
+red r1
+lea L206, X13
+inc X5
+L133: inc L243
+L134: .data -625, 738
+prn X17
+; comment
+L135: .data 207
+dec r6
+sub L212, *r3
+L136: .string "rei"
+clr *r6
+clr r4
+not r1
+cmp *r1, L263
+cmp #-238, *r1
+; comment
+L137: dec r0
+L138: .data -341, 471, 665
+sub *r6, r7
+jsr L36
+sub L176, X11
+L139: .data -462
+add L117, X16
+bne L38
+L140: red L245
+L141: lea L263, r6
+add #-254, X12
+; comment
+dec L95
+jsr L122
+mov *r5, r5
+sub *r3, r7
+L142: rts
+inc r2
+sub #76, *r5
+lea X4, r3
+clr r2
+
+rts
+lea L96, r5
+L143: .string "djcjuqpgspz"
+L144: mov *r5, *r2
+lea L174, *r7
+inc *r3
+mov r7, X18
+clr r0
+jsr *r7
+jsr *r7
+lea L127, *r2
+L145: .data 148, -847, 424, 369, -605, 367, 631, -411
+clr r4
+L146: add *r4, r7
+jsr *r4
+
+sub r5, X22
+L147: lea L226, *r6
+rts
+dec r2
+rts
+jsr *r5
+; comment
+L148: red r4
+inc *r3
+L149: bne *r5
+L150: sub *r1, r2
+not *r1
+not X16
+rts
+L151: dec r2
+clr *r2
+L152: lea X24, L222
+sub X12, L232
+not X15
+lea L220, *r1
+red r7
+stop
+jmp *r7
+not L2
+L153: dec *r1
+
+rts
+jmp X23
+lea L53, r5
+mov r0, r0
+add L162, r1
+L154: rts
+
+L155: lea L108, *r5
+inc *r2
+L156: red X20
+L157: red r6
+bne *r6
+clr *r2
+bne *r2
+sub #-253, X19
+clr r5
+red *r1
+; comment
+lea X13, X10
+
+L158: jsr *r7
+L159: inc r0
+jmp *r4
+add #-42, L50
+; comment
+cmp r4, r5
+prn *r1
+sub L128, *r1
+cmp r4, #-147
+cmp X23, L20
+prn X16
+L160: stop
+red r3
+jmp L253
+lea L182, r1
+red *r2
+red *r5
+L161: .data 237, -625, -223, 161, -447, 186, 914, -705
+clr X10
+prn L99
+prn r4
+add *r5, *r2
+L162: .string "xpmgnttblluyecgzivwawpf"
+dec L206
+L163: jsr *r2
+cmp *r3, #126
+inc r0
+L164: cmp #-39, *r4
+cmp X5, #-91
+L165: bne L222
+L166: .data -462, -582, 979, 540, 312, 764, 992, -435
+L167: jmp L123
+L168: .string "ntmjhslv"
+prn X13
+; comment
+L169: add #114, r5
+L170: .string "bk"
+rts
+; comment
+rts
+L171: clr r5
+L172: .data -41, 963, -234, 222, 906
+; comment
+not *r1
+L173: dec L225
+L174: prn #-117
+lea L70, r5
+not r5
+bne *r4
+cmp r7, *r0
+inc L261
+mov #-184, X19
+red r0
+cmp *r2, r4
+not *r7
+prn L86
+add L287, *r5
+mov #-22, *r2
+rts
+prn *r1
+prn *r0
+L175: .string "pybhqanqzrug"
+dec X5
+dec *r5
+sub #152, r0
+L176: add r1, *r0
+L177: .string "zm"
+inc r3
+mov #-56, *r4
+sub X11, r4
+bne *r7
+bne X1
+red r2
+L178: bne *r2
+mov #-210, *r5
+clr r0
+L179: jmp L102
+inc X1
+jmp X12
+jsr *r3
+L180: jsr *r2
+bne *r7
+L181: jmp X12
+dec L204
+dec *r7
+red X11
+prn X7
+mov *r6, L135
+L182: .data -828, -347, 478, 800, -257
+red *r7
+not *r1
+red *r4
+inc *r6
+jsr *r5
+L183: bne *r0
+jsr L235
+L184: not L195
+L185: .data 727, -705, -435, -748
+cmp *r5, *r3
+L186: .data -122, 318, 775, -431, 123
+lea X14, r2
+L187: sub L225, r1
+red L175
+jmp X1
+rts
+L188: stop
+lea L139, X5
+L189: .string "dlrqvqbpgervzgxtgl"
+sub r1, *r4
+inc L45
+jsr *r5
+mov *r1, r0
+add r0, *r7
+cmp L195, #-239
+L190: sub *r0, r7
+rts
+sub *r7, *r7
+not r3
+L191: bne *r3
+stop
+
+red X22
+L192: .string "iaxspkrwqeawyersot"
+L193: .data 399, -889, -531, -763, 83, -396, -426, 554
+L194: stop
+; comment
+
+rts
+red *r7
+L195: stop
+jsr L26
+not L99
+stop
+L196: red X4
+mov X24, X13
+jmp L212
+stop
+cmp X4, X23
+sub *r0, X6
+red r6
+L197: dec *r7
+; comment
+prn *r3
+L198: red X14
+prn #108
+L199: .string "xx"
+bne *r4
+L200: cmp #57, #-232
+cmp L3, r7
+sub L205, L91
+add *r5, *r7
+add #-88, X23
+cmp #121, *r7
+cmp r2, L22
+L201: .data 907, -829, 318, -197, 235, 656
+jsr *r2
+L202: jsr *r4
+mov #253, L238
+not *r0
+bne X4
+clr L177
+L203: sub #-16, X17
+lea X10, X19
+clr *r7
+L204: .string "slinkpzrvfw"
+sub X19, X18
+lea L164, X12
+L205: add X12, r1
+L206: .string "vvptdwiozcffblatzse"
+L207: stop
+bne *r0
+L208: .string "jwlo"
+L209: dec *r4
+; comment
+add r1, *r3
+L210: red r6
+not *r4
+sub *r1, r5
+cmp L208, L246
+L211: add r2, L132
+L212: .string "ikxp"
+L213: mov *r6, *r1
+L214: bne *r7
+add L185, r4
+; comment
+
+cmp #-39, X21
+jmp L243
+rts
+red *r4
+rts
+jsr *r7
+not L265
+L215: cmp r7, #-200
+dec r5
+L216: prn X11
+bne *r7
+clr L216
+L217: .string "syttz"
+not *r1
+L218: clr X22
+L219: lea X2, X11
+L220: rts
+L221: .data -357, 994, 806, -389, -767, -261
+L222: .string "uqkkouoiknqreqancvqysfge"
+; comment
+dec *r5
+L223: .string "zaomlbfmarjzw"
+dec r5
+L224: add *r6, *r6
+dec L168
+mov #-195, *r1
+not r1
+mov X8, L114
+mov *r7, r6
+prn r0
+mov r2, r5
+rts
+cmp #-45, X2
+
+stop
+cmp *r5, r2
+L225: clr *r6
+sub r1, r6
+prn r1
+L226: red *r2
+jmp L257
+prn #118
+mov *r4, r3
+jmp *r5
+L227: .data 105, -616, -788, -226, 25, -987, -525, 886
+inc r2
+L228: add *r6, X20
+stop
+L229: jsr L164
+not *r2
+add L174, L247
+bne *r2
+dec L98
+L230: rts
+; comment
+prn *r7
+stop
+inc *r4
+L231: dec r3
+not *r7
+L232: clr r1
+not X13
+L233: add r7, L279
+
+not r6
+L234: .data 709, 395, 182, 477, 733, -293, 310, -155
+
+L235: dec r3
+L236: jsr L59
+red r5
+dec L272
+bne *r4
+lea L268, L262
+red L243
+bne L23
+bne L159
+red r3
+L237: .string "bzhmoqefqpcibo"
+prn *r5
+L238: jmp *r7
+rts
+L239: .data -472, -233, 391
+jsr *r6
+jmp X0
+L240: inc r5
+lea X0, *r6
+sub #22, *r1
+jmp *r4
+L241: clr r5
+L242: .data 565, 61, 854, 537, 1, 797, -875, -733
+L243: not *r5
+L244: red X4
+add *r4, r2
+sub L258, *r5
+add r5, X19
+add L263, *r5
+; comment
+L245: red r2
+; comment
+not *r2
+L246: .string "yustuoahoi"
+dec *r1
+not X3
+L247: .data -730, -743, -133, -915
+inc *r0
+L248: .string "lpmuabynlvmami"
+rts
+cmp *r2, #64
+stop
+L249: inc *r6
+dec r3
+rts
+; comment
+inc r6
+red *r2
+add *r4, r5
+inc *r4
+L250: stop
+rts
+jsr X19
+not r1
+bne X21
+L251: rts
+; comment
+lea L140, *r3
+L252: red *r2
+sub r6, L267
+red L143
+jmp *r5
+red X14
+sub #-145, *r0
+stop
+jsr L270
+not L41
+L253: lea L288, *r4
+L254: red *r0
+jsr L285
+stop
+L255: rts
+inc L266
+
+mov #58, *r4
+rts
+L256: red X14
+L257: jsr *r6
+L258: mov *r3, *r0
+rts
+lea X12, *r3
+clr *r1
+rts
+bne X1
+jsr L20
+; comment
+stop
+jsr *r0
+bne *r0
+L259: jsr *r7
+red *r2
+L260: prn L283
+sub r1, *r0
+lea L47, L190
+stop
+L261: red r1
+stop
+clr r2
+sub X9, r5
+rts
+L262: .data -894, 292, 124
+jsr *r0
+lea X4, X10
+L263: jsr X5
+L264: .string "pcqhqaolfpgdricqbqmab"
+L265: .data 705, 939
+prn r7
+; comment
+
+L266: cmp X9, r2
+mov *r5, r1
+L267: mov L284, X10
+L268: jmp *r3
+mov X10, r4
+prn *r2
+jsr *r6
+inc r0
+prn #11
+; comment
+rts
+mov #162, *r7
+bne X9
+inc r3
+L269: .string "k"
+L270: .data 874, 737, 37
+rts
+clr r6
+inc r1
+inc *r5
+add r5, r7
+mov X18, r2
+stop
+add *r6, r5
+L271: dec *r1
+mov L278, *r4
+L272: jsr *r2
+
+L273: .string "rnmglnt"
+L274: jsr *r2
+rts
+prn #-58
+L275: mov #172, X11
+lea X2, L289
+
+stop
+sub *r4, r0
+stop
+stop
+sub *r0, *r6
+rts
+L276: .string "fhkhxfubf"
+clr r2
+
+jsr X12
+not r5
+bne *r3
+red L284
+rts
+L277: .data 196
+stop
+cmp X6, r7
+L278: sub *r6, r0
+dec r2
+L279: sub r6, X15
+; comment
+sub *r5, r4
+jsr *r5
+L280: mov r6, r2
+not X1
+lea L293, *r7
+jmp X4
+add L293, X0
+L281: .string "yrcqgewkkwg"
+; comment
+prn X24
+rts
+L282: .data -655
+clr *r7
+L283: mov *r3, X1
+
+L284: .string "lbearkgzqavnkf"
+mov X12, *r1
+clr r6
+lea X5, *r7
+cmp r6, *r3
+clr r5
+; comment
+jsr *r1
+cmp *r5, #-125
+L285: stop
+bne *r7
+L286: jsr X5
+L287: .data 392, 604, -75, 371, -811, -297, -477, -657
+mov r7, r2
+L288: jmp *r2
+not r2
+dec r3
+jmp *r1
+L289: .string "l"
+red r1
+sub L249, L277
+cmp *r2, #-252
+L290: .data -243
+jmp L247
+jmp *r4
+L291: add X23, L293
+not L32
+prn X23
+L292: .data -799, 400, 680, 165, -560, 7, 249
+inc X23
+prn #-118
+add L232, *r0
+jsr L162
+
+not r2
+cmp X0, #-209
+cmp *r1, #-160
+stop
+jsr *r5
+jmp L205
+prn *r6
+L293: sub r5, r0
+stop
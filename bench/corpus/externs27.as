@@ -0,0 +1,1045 @@
+; Generated by genCorpus --seed 28
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+L0: jsr *r2
+bne *r0
+; comment
+L1: lea X24, L90
+not *r7
+sub L1, X9
+L2: jsr *r1
+inc L182
+add *r2, r7
+jmp X3
+not X12
+cmp *r5, *r0
+L3: mov #100, *r5
+dec r4
+L4: .string "punjhghvbhz"
+
+dec *r3
+prn #-59
+sub r5, r5
+mov L1, *r0
+; comment
+L5: lea X1, L3
+jsr *r3
+L6: bne L4
+L7: add r2, r3
+red L1
+L8: red r5
+clr r0
+rts
+L9: lea L120, *r6
+sub #40, *r4
+L10: .data -272, 292, -39, -919, -384, -464, 27
+L11: .data -373, -739, 697, 673, -578, 284, 72
+cmp *r3, #-159
+sub X17, r2
+
+not X2
+sub r0, X23
+stop
+cmp r6, r5
+jmp *r2
+not *r2
+
+L12: stop
+not r3
+prn r3
+red *r7
+L13: dec *r3
+red L7
+prn r3
+L14: dec X15
+L15: .string "myg"
+inc r4
+red r4
+L16: not *r2
+L17: jmp L51
+L18: .data 35, 139, 371
+lea X8, L151
+; comment
+bne L18
+dec r3
+lea L226, r6
+rts
+not X17
+cmp #-220, #81
+L19: .string "lurddrsbdnzflaqgs"
+lea L9, r0
+jsr *r0
+mov *r1, r4
+jmp *r5
+L20: .string "tdatdrmxgik"
+dec *r5
+L21: mov #3, L61
+cmp *r0, #30
+L22: .string "qojtmuykkzhowpqhwowwovo"
+; comment
+lea L7, r0
+L23: red *r3
+L24: clr L142
+L25: add r5, L62
+clr X15
+add r5, *r2
+rts
+
+cmp #123, r7
+inc *r1
+L26: prn #60
+inc *r7
+add #-256, *r3
+; comment
+L27: .string "vbp"
+cmp *r2, r2
+stop
+bne L6
+L28: dec r4
+bne *r1
+L29: .string "wbrsjfxoa"
+L30: .string "syaqqnyj"
+; comment
+L31: .string "hescoahacdvcmfhoouwaeriw"
+dec *r3
+mov *r4, X9
+add L28, L9
+L32: .data -141, 433, 676, -761, -374
+not X20
+L33: .string "zdoagyfqtmmnhnuxtn"
+L34: stop
+L35: prn r4
+add #35, r6
+L36: cmp r6, r1
+prn L89
+L37: mov r6, *r2
+inc *r0
+clr L23
+bne X18
+jmp L0
+
+stop
+inc *r2
+sub X17, r3
+inc r7
+L38: dec *r5
+prn L117
+clr *r5
+L39: prn r6
+L40: cmp r4, X19
+add L7, r2
+prn r7
+L41: sub r6, *r4
+sub #-22, *r3
+L42: sub r0, r1
+L43: .data -67
+L44: mov r3, L23
+L45: bne L279
+inc X24
+L46: jmp *r5
+L47: .string "vfoxtjb"
+lea X10, r5
+jsr *r3
+add L7, X9
+L48: .data -741, -499, -891, 835, 150, 673, -913, 743
+clr r6
+L49: prn #123
+sub r0, L1
+jmp X18
+mov *r3, L135
+lea L7, X17
+not *r2
+L50: .data 53, -729, 560, -551, -814, -32, -54
+add L31, *r5
+L51: .string "dauhvnzajkhlqxkmmzhh"
+cmp r4, r6
+inc *r6
+L52: jmp X23
+stop
+jsr *r6
+L53: .string "ul"
+L54: add *r4, r7
+L55: add *r6, X19
+cmp X11, r0
+red *r6
+prn r6
+dec L24
+L56: .string "kubtvaqbrlt"
+bne X20
+stop
+L57: stop
+L58: stop
+rts
+bne *r7
+rts
+prn #-256
+L59: not r0
+L60: .string "isislimnq"
+lea L217, L37
+jmp L41
+red X23
+L61: not *r0
+red r2
+L62: lea X16, *r5
+inc L144
+rts
+jsr *r1
+bne L169
+jsr *r1
+prn X21
+L63: lea L34, r0
+; comment
+stop
+L64: mov *r0, *r4
+
+stop
+mov r4, X10
+prn *r6
+jmp *r5
+lea X22, r7
+L65: .string "jpswkwzikutoxyhplplkq"
+lea L119, L32
+rts
+dec L47
+not r2
+red L65
+not L126
+L66: .data 278, 990, 671, -847, 147, 223, 638, 935
+L67: bne L21
+add #69, *r0
+inc r0
+L68: .data -186, -13, 616, -380
+lea L217, *r2
+bne *r1
+mov r0, r4
+add #-61, r2
+jsr L269
+jmp *r6
+sub *r0, r0
+jmp *r0
+mov #-68, L22
+add r4, *r4
+L69: rts
+bne X17
+L70: .data 486, 803, 485, -887, -978, -337, 242
+L71: .string "e"
+L72: stop
+L73: .string "zmhargiojva"
+cmp X1, r4
+sub X18, X18
+L74: sub X9, L197
+red *r3
+clr r3
+clr L139
+bne *r5
+rts
+add *r4, *r2
+lea L2, *r0
+stop
+prn L33
+cmp *r5, r1
+mov X7, *r6
+; comment
+L75: not *r0
+rts
+L76: .data -920, -183, -814, 14, 88, -68, 217
+red X8
+
+cmp L180, r4
+not r7
+prn r6
+clr L43
+mov *r2, *r6
+mov #126, r0
+L77: sub L19, X9
+jmp *r2
+rts
+red L258
+jsr *r5
+not L29
+L78: .data 273, 542, 174, -497, -936, 253, 499
+mov X8, *r1
+mov L139, r4
+L79: cmp r2, r3
+L80: .string "vjhjojznajtjvwudnqmuiwo"
+stop
+inc r3
+lea L26, r5
+rts
+L81: clr r7
+not *r2
+cmp L188, L51
+prn L24
+red L2
+; comment
+jsr *r7
+inc L49
+bne X21
+jsr L33
+mov r4, *r4
+prn X3
+bne X14
+jmp *r5
+mov *r0, *r0
+not r5
+L82: .data 660, 421, 216, -610, -667, -972, -619
+L83: .string "mx"
+L84: lea X0, r3
+; comment
+inc *r6
+prn X13
+rts
+mov L12, r7
+cmp *r1, X23
+L85: stop
+jmp *r1
+clr X17
+sub r5, *r4
+jsr *r7
+lea X19, r1
+inc r2
+not r3
+; comment
+dec *r3
+stop
+jsr X17
+bne L258
+L86: rts
+L87: .string "flqrjpvhzmcvgwkyyezuhy"
+not *r4
+rts
+cmp X23, X4
+L88: .data -937, 366, 442, 104, 34, 132
+L89: cmp *r0, X6
+sub #64, *r6
+cmp *r5, *r6
+inc L59
+stop
+L90: sub r6, L280
+sub L240, r1
+sub r1, *r0
+L91: jsr L61
+cmp L86, r2
+lea X9, *r3
+inc r7
+cmp r5, #68
+add r4, *r6
+L92: clr X17
+sub X12, *r4
+L93: .data 530, 930
+not X11
+L94: mov #-8, *r1
+L95: .data -432, 747, 105
+jsr L121
+L96: jmp *r0
+; comment
+L97: bne *r5
+; comment
+L98: rts
+L99: .data 70, -335
+clr *r6
+
+bne *r6
+mov #232, r7
+add *r6, *r2
+rts
+add r4, r4
+clr X18
+; comment
+red r7
+jsr L53
+; comment
+dec *r4
+L100: sub X2, L238
+rts
+L101: .string "yizypquseg"
+L102: mov r6, L24
+clr *r0
+red r3
+jmp *r4
+rts
+cmp #-74, L20
+L103: .data -853, 44, 740, -720, -961, -536
+jmp *r5
+stop
+stop
+prn *r7
+L104: .string "frenatsepymld"
+mov *r3, L225
+L105: add r4, *r3
+lea X19, L112
+jsr X16
+stop
+L106: rts
+L107: red r6
+bne L58
+
+jmp *r7
+sub L91, r2
+stop
+inc L104
+jsr *r7
+L108: .data -18, 803, 259, 805, 885
+L109: .data -213, -592
+stop
+L110: stop
+jmp *r7
+L111: .data -154, -905
+mov #134, *r1
+prn *r4
+L112: .data -663, 971, 121
+add L8, *r0
+prn r2
+red r6
+L113: .data 854
+jsr L50
+L114: .string "vkglwatimxvz"
+jmp *r1
+prn *r7
+L115: sub #-3, r4
+dec r1
+sub X15, *r2
+sub X15, X3
+dec X12
+jsr *r3
+lea L97, *r0
+bne *r4
+L116: clr X11
+L117: cmp r6, #242
+sub #146, r5
+prn #-116
+
+stop
+stop
+clr L171
+; comment
+dec *r0
+inc r1
+dec *r0
+dec *r2
+rts
+dec L187
+L118: lea L198, X8
+L119: .data -887, -726
+sub *r4, *r1
+add r7, *r6
+clr L255
+; comment
+mov *r3, r7
+L120: .data -148, 61, -100, 479, 657, 807
+stop
+clr *r1
+L121: add r4, *r1
+sub r2, *r3
+lea L201, r4
+clr X16
+jmp *r0
+lea L33, *r4
+L122: add r4, *r7
+cmp L14, r7
+L123: stop
+inc L93
+L124: clr r2
+L125: cmp r5, L127
+
+lea L242, X6
+dec *r5
+cmp *r6, r0
+L126: red r0
+prn #59
+L127: bne *r3
+inc r7
+jmp *r7
+clr r1
+bne L62
+mov #-122, r1
+sub #-157, r6
+bne *r0
+L128: add *r1, *r4
+L129: rts
+bne *r5
+jsr *r2
+L130: sub #129, X2
+red X5
+jmp *r6
+mov #238, *r3
+L131: .string "vpozlamckucgibrj"
+inc L183
+bne *r1
+L132: mov r7, r4
+L133: .string "kxmckvgwxxuvvha"
+red *r4
+L134: dec r1
+L135: .string "gqkbfvisjivbwgwueulmpeu"
+jsr L189
+sub #165, *r6
+red L95
+L136: sub *r4, *r5
+jmp L46
+L137: .data -312, 372, -437, 550, 445
+prn r3
+rts
+L138: red X3
+add r7, r4
+L139: red L138
+jsr *r4
+; comment
+dec X17
+red *r4
+L140: dec *r6
+not *r5
+red r6
+not r7
+L141: rts
+add L137, X7
+stop
+lea L200, X17
+bne X14
+red r5
+add #96, *r6
+L142: dec *r3
+clr L72
+red r3
+L143: .string "srghlzkzvnipetygcsabhg"
+inc L211
+inc r1
+jsr L196
+rts
+not *r2
+rts
+not X19
+red L129
+stop
+bne L79
+clr *r4
+L144: clr X3
+inc X4
+mov #-54, X22
+jsr L63
+inc L103
+dec X18
+L145: red L70
+cmp L212, L149
+L146: inc r2
+jmp L82
+add r7, *r2
+bne *r6
+L147: .data -970, -359, 711, 907, -504, -880, 235
+L148: .string "fe"
+sub L138, L102
+not r2
+prn *r5
+L149: stop
+rts
+cmp *r2, *r5
+inc L277
+inc L25
+add #2, L220
+bne L141
+
+; comment
+rts
+L150: lea X0, r7
+not *r0
+sub *r7, *r6
+red L167
+dec *r6
+L151: sub *r2, *r6
+red *r5
+inc *r1
+L152: stop
+lea L134, L90
+L153: bne *r3
+cmp *r6, r1
+sub *r6, r1
+L154: .data -673
+cmp r2, #238
+inc *r2
+not *r0
+lea L223, L201
+prn *r3
+mov #-221, *r3
+cmp #170, L48
+jmp *r4
+rts
+clr *r5
+L155: bne X5
+add #197, X0
+jmp *r0
+inc *r2
+
+sub L205, X22
+prn L30
+bne L257
+rts
+bne X5
+L156: dec r2
+sub *r2, r4
+dec r7
+lea X16, L136
+L157: .string "xlhtshmlevn"
+cmp L95, X21
+dec r3
+L158: inc r0
+jsr *r3
+clr L234
+prn L83
+jmp *r3
+L159: bne X4
+cmp *r5, #174
+cmp #-114, #212
+bne L263
+cmp #100, #92
+L160: .data -302
+L161: .string "r"
+L162: lea L273, L102
+prn r7
+clr r3
+red L26
+inc L100
+jmp L230
+prn L70
+L163: .data 76, 629
+jmp L45
+not L279
+mov *r6, X4
+jsr L38
+jmp *r1
+bne X4
+lea L122, r1
+add #116, L78
+add *r4, r4
+jsr L6
+red L121
+rts
+dec *r1
+inc r3
+add #-153, X4
+clr L47
+clr r0
+L164: rts
+bne X23
+red r5
+red r3
+bne X23
+cmp #147, r6
+mov L163, *r3
+L165: add *r7, r5
+cmp r4, #-2
+mov *r1, r7
+L166: dec r5
+lea L220, X19
+L167: .string "nizicuwivfxkwdhxzr"
+cmp *r2, r5
+clr r7
+cmp #-142, L79
+lea X16, r2
+L168: sub *r7, X6
+jmp *r3
+L169: .data -203, -369
+prn #102
+
+dec X11
+clr r4
+dec *r0
+jmp X15
+bne L258
+prn r3
+lea X8, X6
+lea L276, *r5
+cmp #-73, *r3
+; comment
+
+L170: .string "tfje"
+dec *r1
+L171: jsr *r4
+prn r3
+prn #-124
+L172: jmp L178
+L173: lea X9, L156
+red r5
+L174: cmp #-67, *r3
+rts
+L175: rts
+jsr *r3
+bne X18
+L176: jsr L226
+red X11
+L177: dec X5
+inc *r0
+L178: bne *r3
+inc L209
+bne L241
+dec *r4
+red *r7
+jmp L234
+
+L179: lea L259, L28
+lea L187, *r0
+bne *r3
+rts
+L180: stop
+dec r6
+jmp L193
+bne X10
+L181: bne L183
+L182: .data 160, 988, -500, -977, -727
+red X3
+dec *r0
+lea L248, *r6
+L183: bne *r0
+L184: stop
+inc r7
+L185: red *r6
+L186: .data -223, 81
+L187: .string "venuyoaoteljrg"
+bne *r1
+L188: red X0
+red *r7
+L189: .data -931, -863, -543, -476, 466, -542, 40
+not *r1
+bne X11
+L190: .data 293, 108, 274
+stop
+rts
+clr L139
+L191: .string "afofknmcchibhtqzilbn"
+not *r6
+dec *r3
+L192: .data -331, -607
+L193: not L69
+lea L22, L204
+bne L256
+clr L122
+L194: .data -660, 909, -229, 275, -821, 763, 121, -653
+L195: cmp L184, r3
+not r7
+prn *r2
+not *r7
+lea X8, X14
+add #-2, r6
+stop
+; comment
+jmp X15
+L196: stop
+L197: .string "ylgm"
+L198: .string "ckfnvyjwkucztfyserppjuzu"
+red *r6
+lea X22, L225
+stop
+bne *r6
+cmp *r1, r1
+rts
+sub L78, L200
+add r3, *r6
+rts
+jmp *r6
+
+L199: add r3, *r7
+add X16, *r5
+L200: .string "auevbueoesufb"
+L201: rts
+jsr *r4
+jmp L12
+L202: .string "uyxjdddivcrzb"
+bne *r4
+sub #55, r0
+L203: cmp r7, r7
+L204: clr X12
+sub r4, r3
+clr *r6
+inc L186
+inc X19
+L205: jmp X19
+L206: bne *r4
+L207: mov r1, L36
+cmp L262, *r7
+L208: cmp *r4, X5
+cmp #30, *r2
+bne X23
+lea L5, *r6
+inc L253
+L209: mov #-104, r1
+prn r5
+red r5
+prn r7
+add X0, *r6
+sub #-153, r1
+jmp *r2
+jsr *r7
+L210: mov #-236, *r7
+not *r3
+L211: rts
+L212: add r1, L116
+L213: .data 136, -788, 202
+L214: red r7
+red *r0
+rts
+cmp #-92, *r6
+clr L232
+jsr *r2
+L215: .string "dece"
+jmp *r1
+
+L216: rts
+red X1
+L217: red *r7
+dec r1
+jsr L231
+mov *r6, X24
+add #252, L236
+not r3
+sub L246, r4
+L218: .data 354, -666
+cmp #-90, X20
+not *r1
+jsr *r4
+jmp *r7
+L219: mov L109, L266
+L220: inc r5
+prn r2
+jsr *r2
+prn #-223
+jmp *r2
+; comment
+L221: cmp #-78, #73
+cmp r3, r1
+L222: cmp r3, *r0
+not r7
+L223: .string "rtqyssfkcfixf"
+L224: bne L139
+inc L275
+stop
+inc r2
+clr *r3
+L225: red *r6
+L226: .data -947, -533, 561, -227, 138
+L227: jsr *r7
+bne X13
+sub L126, *r4
+L228: bne *r4
+mov r7, r0
+not X2
+inc *r7
+cmp r5, X4
+L229: .string "ubhs"
+L230: dec L277
+add *r6, L134
+lea L220, *r3
+L231: .data 511, 751, -316, 352, -733, 307, 291, 400
+cmp #166, X14
+L232: jmp L271
+cmp #-218, *r3
+clr *r6
+prn *r5
+L233: .data 197, 923, -654
+add #229, X11
+not L181
+L234: jsr *r5
+sub r5, r4
+jsr L262
+; comment
+rts
+dec L37
+stop
+stop
+bne X12
+lea L107, *r5
+bne *r5
+lea L66, *r5
+lea L257, *r4
+jmp L274
+jmp *r4
+inc r4
+prn *r6
+cmp X4, L224
+L235: jmp L256
+; comment
+jmp L275
+L236: jmp *r4
+clr *r7
+rts
+clr L60
+mov L252, *r5
+bne *r0
+L237: prn *r0
+not *r6
+stop
+add *r3, *r1
+L238: jmp *r2
+; comment
+not r4
+sub *r3, *r2
+add L43, X8
+L239: rts
+L240: red X4
+prn r2
+L241: .data 46, 530, -687, 492, 716, 988, -395, 321
+L242: .data 477, 386, 195, -577
+rts
+add r1, L252
+sub L267, r4
+jmp *r0
+rts
+L243: sub L274, r3
+L244: .string "sdzihmbzgilmifugvor"
+L245: cmp *r2, #-140
+bne L145
+prn #-106
+L246: .string "xlnju"
+cmp #-13, L131
+dec X17
+L247: .data 441, -666, -222
+L248: .string "mmuav"
+lea X16, r1
+L249: dec X2
+sub *r2, L273
+cmp *r6, #149
+jmp *r2
+jmp *r2
+sub #24, *r4
+cmp #39, L23
+L250: sub L81, r3
+add r5, *r5
+L251: mov *r1, L203
+bne *r0
+L252: .string "jejvkdsqqx"
+clr X11
+jsr *r4
+L253: .string "hfemytatfstfgt"
+; comment
+red *r2
+L254: bne L269
+L255: mov r0, *r2
+sub X16, *r7
+inc X23
+inc r2
+jmp *r3
+L256: stop
+inc L20
+L257: red r4
+L258: stop
+mov L274, r4
+cmp L273, r0
+rts
+lea X13, L268
+rts
+L259: rts
+clr r0
+stop
+mov r2, r6
+red r4
+prn *r6
+rts
+L260: .string "rqcdbzyrtuaxvckopoank"
+dec *r6
+not r3
+stop
+jsr L170
+not *r5
+clr *r5
+L261: not r0
+jmp L95
+lea X5, *r0
+red *r4
+L262: inc r0
+stop
+dec r1
+L263: .string "zt"
+bne X7
+add #-51, L134
+jmp *r0
+rts
+L264: jmp *r1
+jmp *r2
+inc *r0
+cmp r2, X23
+L265: dec r1
+inc L25
+L266: inc L243
+L267: .data -252, -712, 635, -539, -296, -993, 296
+red L68
+inc *r4
+cmp r4, L118
+rts
+inc *r7
+jmp *r6
+L268: .string "pzbqdafrqslcndnsooxde"
+rts
+L269: prn #-149
+lea L279, L221
+prn L13
+not *r7
+inc *r6
+mov L274, r2
+L270: not r4
+inc L77
+lea X21, *r0
+inc r1
+mov r1, r6
+inc X19
+red X21
+bne L273
+L271: add *r2, *r7
+L272: mov X12, *r0
+
+L273: prn #-78
+L274: cmp *r0, #-32
+cmp L279, *r3
+rts
+L275: add *r2, r0
+L276: inc r6
+clr *r7
+L277: .data -378, 498, -789, 643, 977, -191
+red *r2
+L278: .data 143, 494
+mov #-1, X12
+L279: jmp X24
+not *r5
+dec r2
+rts
+lea L214, *r5
+L280: .data 249, -121
+rts
+stop
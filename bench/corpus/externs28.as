@@ -0,0 +1,1044 @@
+; Generated by genCorpus --seed 29
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+red r4
+L0: mov L0, L0
+prn L0
+jsr *r3
+L1: .string "fjus"
+
+inc L0
+lea X9, *r1
+rts
+L2: .string "blocn"
+L3: .data 749, -371, 692, -274, 614, 829
+L4: inc L19
+rts
+rts
+red L3
+jmp X10
+clr *r0
+L5: .string "utaeghtwsl"
+clr *r0
+stop
+jmp X21
+stop
+cmp *r5, *r5
+sub r3, *r2
+L6: .string "wczzjinyxvvmmu"
+inc L4
+L7: .data 602, 204, -116, 345
+rts
+L8: jsr L8
+bne *r2
+mov X12, *r1
+L9: lea L96, r1
+bne X20
+clr r1
+L10: .data 236, -187
+L11: rts
+L12: .data -845, -695, 845, 51
+L13: lea L122, X1
+jsr *r7
+; comment
+sub *r2, *r4
+cmp *r1, #96
+L14: lea L121, r1
+jmp L9
+L15: mov *r3, *r2
+add L119, X2
+lea X10, *r7
+jmp L65
+inc L124
+prn *r1
+red r0
+bne X6
+add X23, L5
+prn #-250
+L16: .string "fjujyigbbhxngcj"
+L17: cmp *r3, #16
+rts
+L18: .string "gveqfv"
+L19: inc *r5
+jmp *r4
+cmp r0, L110
+L20: .data 243, -728, -453, -607, -957, 806, -80
+L21: lea X17, *r3
+clr X8
+cmp L3, *r3
+lea X2, L134
+L22: red X11
+red X4
+inc *r6
+add L164, L21
+L23: mov *r4, L11
+L24: sub *r4, L52
+lea X10, *r7
+bne L7
+red *r0
+
+add #248, X10
+jmp *r6
+L25: .data -28, -36, 734
+rts
+jsr L8
+L26: prn X4
+prn X4
+clr L31
+L27: jsr L107
+rts
+prn #39
+not r0
+cmp L7, *r1
+add #222, *r6
+stop
+jmp *r2
+L28: cmp *r6, #-6
+inc X24
+red X5
+; comment
+inc r6
+add r3, r7
+L29: mov X20, X9
+cmp *r3, X19
+not L183
+
+L30: .data 125, -857, -507, -315, -884
+rts
+rts
+L31: .data -813, 402
+L32: cmp #52, L167
+mov r5, r6
+stop
+L33: .string "iym"
+; comment
+sub #17, r3
+inc r3
+lea X3, r7
+stop
+jmp L0
+lea L237, *r2
+L34: rts
+L35: cmp X23, *r7
+
+L36: mov *r3, r0
+; comment
+L37: .data -259, 552, 410, -655
+mov L172, L2
+prn L50
+L38: jsr L35
+jsr *r5
+not *r5
+red r2
+clr *r5
+not r3
+add #210, *r4
+dec *r3
+L39: add *r6, r5
+add r0, r1
+L40: mov L146, L126
+jsr L60
+clr L20
+bne *r0
+dec *r6
+inc r4
+
+mov #-69, X22
+sub r7, r6
+inc *r2
+sub *r0, *r2
+L41: red *r2
+not r5
+add *r5, r5
+jmp L15
+L42: .data 877
+; comment
+sub r2, r6
+jmp X23
+inc r3
+L43: rts
+rts
+bne X21
+L44: prn X15
+; comment
+inc L43
+dec *r7
+bne *r1
+inc X1
+prn r1
+stop
+; comment
+L45: .data -620, 863, 711, 28, 139, -773
+dec r6
+stop
+
+L46: dec r5
+L47: bne *r6
+jmp *r4
+mov r7, X2
+bne L46
+jmp *r5
+L48: .data 491
+not *r7
+jmp L210
+sub r0, r2
+prn X3
+L49: add #106, r7
+L50: red X17
+mov *r2, r2
+jmp *r0
+add r5, r2
+L51: .string "klhtrc"
+clr *r7
+add #-248, r6
+add *r5, *r7
+L52: not X1
+inc r5
+; comment
+lea L239, *r5
+cmp r0, #238
+cmp X3, #-111
+mov *r0, *r5
+L53: jsr *r1
+cmp #-227, #78
+mov #-132, r3
+lea L267, L179
+stop
+stop
+L54: lea X7, *r3
+L55: cmp *r0, L147
+rts
+inc *r1
+prn *r6
+L56: .string "pahssjbxrgqttmnjtsfamcum"
+; comment
+sub X10, r5
+rts
+cmp #246, X11
+bne *r5
+rts
+red *r6
+L57: add *r5, *r6
+prn #9
+L58: rts
+not r4
+L59: not *r4
+L60: .string "xhrhbciynmn"
+mov r0, *r2
+mov X14, *r7
+jsr X24
+inc r3
+L61: .data 618, -685, -667, -21, 527
+red L13
+
+lea L32, L36
+sub L47, r5
+prn #-183
+lea L210, *r0
+L62: clr L31
+L63: .data -811, 837, -40, -412, 887, 495
+add #142, L50
+add r6, r2
+mov r7, r6
+add L140, X23
+L64: not X21
+
+prn r6
+clr *r4
+bne L160
+; comment
+lea L10, L61
+add #-127, *r3
+L65: .string "sdlficsvzrrupump"
+not X6
+red r0
+rts
+L66: sub #-225, *r5
+L67: inc *r0
+L68: .data -101, 314, 11, -355, -587
+L69: mov #190, *r7
+jsr *r6
+L70: mov #135, L241
+jmp L259
+dec r2
+red X24
+clr r2
+not *r3
+mov #189, r4
+stop
+L71: mov *r2, *r6
+inc r0
+; comment
+L72: clr *r0
+L73: .data 964
+
+prn #-4
+L74: sub r1, *r1
+jmp L193
+
+not *r4
+sub r1, *r4
+
+L75: .data 414
+L76: red L259
+red L65
+L77: .string "gyocoukkgqpgogbzxvwoue"
+mov #-59, r1
+; comment
+add #241, X4
+rts
+L78: not r7
+jmp *r5
+; comment
+mov #-186, X18
+L79: lea L199, r1
+not *r6
+mov #203, L265
+L80: .data 487, -689, -459, -201, 830, 623, 512, 755
+L81: inc *r5
+stop
+red r2
+inc r4
+
+L82: prn #62
+sub L93, r7
+
+jsr *r7
+stop
+not r7
+jsr *r2
+L83: .data -730, -10, -876, -197, 148
+red *r4
+L84: add r7, *r1
+cmp X5, #-81
+prn *r6
+clr *r3
+add *r7, L130
+prn *r2
+dec L194
+sub *r1, L185
+mov #-206, r1
+L85: rts
+; comment
+jmp *r6
+stop
+L86: rts
+inc *r0
+add #-71, L56
+sub #65, L138
+bne L258
+inc L208
+rts
+L87: mov X10, r2
+L88: add X7, r6
+sub *r6, X22
+inc *r5
+sub #-222, *r2
+L89: inc r5
+red X0
+L90: .string "iwet"
+sub r4, L114
+add r5, *r2
+cmp r3, #112
+red r2
+red L192
+add *r2, L8
+not L152
+inc *r6
+dec r3
+L91: inc L44
+clr X10
+add r1, L85
+add *r2, L150
+L92: inc L76
+lea X11, L130
+red *r6
+L93: bne *r3
+rts
+L94: .string "mynfvvdjkzgksnuecebovjtk"
+prn #-183
+add #-55, X12
+; comment
+prn #-175
+bne L119
+lea X6, r5
+lea L90, r4
+jmp *r7
+bne X16
+bne X9
+L95: .data 280, -120, 724, 988, 870, 940
+rts
+L96: not *r1
+not r7
+L97: red r2
+not *r6
+L98: prn L223
+mov r3, L48
+L99: red *r5
+cmp *r6, r6
+dec r1
+clr r0
+L100: .data -48, -860, -581, 162
+jsr L31
+L101: .string "sqfklbhgalfkbvorkwi"
+
+rts
+
+not *r0
+clr r7
+inc r4
+cmp *r7, L142
+mov #-144, X9
+bne *r2
+L102: .string "ypvplwladq"
+red r2
+bne X6
+jmp L266
+bne L38
+bne L153
+inc r6
+red X4
+dec L8
+rts
+stop
+stop
+inc L75
+lea X12, *r1
+dec *r0
+
+not *r1
+; comment
+dec r6
+lea X18, *r1
+mov r3, X20
+rts
+jsr *r2
+stop
+prn #111
+jmp *r0
+L103: rts
+not r3
+L104: .data -868, -262, -733
+L105: .string "cstsjvdupklradrepljlva"
+not X4
+L106: add r2, r0
+not X10
+L107: sub r3, L233
+L108: .string "c"
+L109: add #33, X6
+L110: red X17
+stop
+L111: .data -57, -822, 563
+L112: sub #61, *r2
+
+L113: .string "hdpdelrrwx"
+L114: jmp *r1
+bne L226
+red *r6
+mov #-19, *r0
+mov #-144, X0
+dec X15
+sub r2, *r4
+
+jsr *r5
+lea X0, *r2
+mov #-142, r2
+clr *r2
+stop
+cmp X5, *r1
+stop
+stop
+inc r1
+L115: sub #209, X19
+stop
+L116: lea X4, *r3
+; comment
+jmp X15
+cmp X11, r1
+jmp X4
+lea L126, r0
+not *r7
+red X13
+
+red X9
+L117: red *r4
+L118: .data 126, 666, -898, 426, -388, -807, 892
+inc *r7
+L119: jsr X0
+add r1, r7
+; comment
+not L6
+bne *r0
+clr X11
+mov r7, X21
+mov *r7, *r1
+red *r2
+prn L195
+rts
+bne *r4
+rts
+prn #-227
+L120: stop
+add L28, r0
+add #-191, *r4
+jmp *r1
+clr X2
+L121: .data -374, 903, 678, 819, 65, 790
+L122: mov r6, r1
+L123: .string "vw"
+L124: stop
+dec r1
+mov r0, *r5
+jsr *r7
+clr r4
+rts
+inc r2
+add *r1, *r6
+L125: stop
+rts
+L126: .string "wcxzevgcorjkixt"
+L127: lea L22, *r2
+not X17
+prn X11
+
+jmp *r7
+add L161, L10
+rts
+stop
+L128: mov X24, *r3
+inc r2
+L129: red r4
+L130: bne L135
+bne X13
+clr *r1
+L131: .data 772
+not r6
+
+rts
+; comment
+clr *r0
+red r7
+jmp L199
+rts
+rts
+stop
+
+stop
+jsr L232
+mov X19, X5
+
+sub *r0, r5
+jsr L192
+prn *r7
+not *r6
+L132: jmp *r6
+dec X7
+prn r4
+L133: .string "vtfoqmvyac"
+jmp *r7
+L134: red *r6
+L135: .data -794, -548, 533
+L136: .data -695
+prn *r4
+L137: inc X24
+L138: rts
+clr r5
+clr r7
+sub X10, r7
+red r7
+mov L88, L196
+L139: sub #127, *r3
+rts
+clr r4
+mov X4, L164
+L140: .string "zqblf"
+mov r1, L257
+stop
+clr X22
+stop
+cmp L204, r1
+L141: bne *r2
+inc r7
+prn *r5
+L142: sub #187, *r4
+lea X17, *r2
+clr X11
+L143: jsr X22
+cmp *r1, #58
+bne X6
+sub #-185, X3
+L144: .data 834, -623, 10, 662, -598, -354, -640, 105
+L145: red r4
+clr r7
+clr r1
+mov L132, *r2
+red X5
+L146: .data 256, 125, 158, -630, -919
+L147: add L120, r6
+
+prn L81
+lea L235, *r1
+
+stop
+L148: sub r4, X12
+prn *r3
+; comment
+L149: not L116
+L150: add #0, *r5
+L151: jsr X6
+not L205
+; comment
+L152: .string "kkjwysrqoewwffi"
+rts
+cmp L213, r4
+; comment
+rts
+L153: dec L95
+L154: bne L60
+bne *r3
+L155: bne L239
+cmp *r2, #-148
+rts
+prn #-188
+jsr L186
+prn *r7
+lea L223, *r7
+L156: jmp L61
+mov L261, r2
+L157: red r4
+inc r1
+red *r0
+
+red *r2
+lea X8, X7
+L158: lea L1, *r1
+jmp *r0
+clr X0
+
+mov X8, X2
+L159: jsr *r0
+bne L253
+L160: .data -983, -235, -768
+L161: sub X24, r0
+L162: add r1, r2
+add *r6, *r4
+add L255, X12
+cmp #10, #-1
+bne X23
+L163: mov *r2, r2
+inc X16
+jmp *r7
+L164: .data -536, 497
+lea L21, *r3
+red *r1
+L165: rts
+L166: .data 907
+red X24
+bne L88
+L167: clr *r5
+L168: mov *r0, r0
+red *r3
+add r0, *r1
+lea X18, *r4
+L169: .data -445, 226, 962
+L170: .data -652, -797, -874, -515
+dec r2
+sub r0, r7
+clr *r3
+mov X5, X2
+L171: .string "ovelhgvqijcubyaswhcmfr"
+dec r5
+prn #170
+inc r7
+inc L182
+not *r2
+cmp X1, *r6
+L172: sub #155, X14
+L173: stop
+jsr *r0
+sub #-24, *r0
+inc X8
+L174: lea X8, *r7
+L175: jsr *r2
+lea X17, *r5
+prn #116
+add r6, r0
+not *r1
+jsr L218
+dec *r6
+dec L216
+L176: prn *r6
+red r4
+inc r2
+L177: .string "uxdyhdlfgke"
+prn L186
+bne X5
+L178: jmp L229
+cmp r6, *r0
+L179: red r0
+jsr X5
+L180: .data -443
+sub *r5, L233
+L181: .string "jhjyrp"
+cmp #83, #-97
+jsr X16
+L182: .string "ou"
+add #239, *r7
+sub *r3, *r1
+L183: not X21
+L184: jmp X15
+L185: .data -732, 335, 436, -811
+red r3
+bne X7
+clr X23
+mov *r2, r3
+bne L130
+dec r7
+L186: .string "aayjdhkigxubnkvmvk"
+not *r0
+prn X23
+lea X10, *r7
+L187: rts
+not *r6
+sub X13, r1
+red L252
+sub L73, *r2
+L188: .string "ljdkeuqalhtzmodlvsltu"
+L189: .data 244, -770
+L190: lea X2, *r1
+red *r2
+red r5
+L191: .data -676, -485, -476, -307, 153, 665, 149, -873
+cmp #-197, r1
+L192: mov L50, *r7
+jmp *r6
+prn X2
+cmp r3, r1
+L193: red L91
+inc *r3
+
+add L248, *r0
+jmp *r1
+clr r4
+add #-36, *r3
+L194: .data -747
+clr r6
+L195: inc *r7
+prn r0
+lea L166, L209
+mov #-131, r1
+; comment
+
+bne L236
+jsr L10
+L196: stop
+jmp *r3
+mov L53, X23
+add L213, r7
+not r5
+stop
+L197: jsr L235
+L198: bne *r7
+
+; comment
+dec r7
+red *r0
+bne L207
+add L101, L73
+prn *r6
+; comment
+sub *r5, *r1
+; comment
+add L244, L257
+L199: rts
+not *r6
+lea L81, X9
+L200: prn r1
+L201: rts
+lea X2, L228
+L202: sub r7, r1
+sub r7, r3
+not *r2
+inc *r1
+dec X12
+cmp X7, L264
+rts
+dec L44
+bne *r0
+L203: red L181
+bne *r3
+stop
+stop
+inc L96
+clr r7
+prn L217
+L204: bne L118
+cmp r2, *r0
+lea X2, r0
+cmp *r3, #-94
+stop
+L205: .string "ltvcxnqermcxrts"
+dec *r7
+clr L225
+L206: .string "ransggjwq"
+rts
+clr X6
+dec r0
+L207: jmp L74
+; comment
+L208: .data 95, -788, -394, 987, -55, -368, 96, 399
+jsr X17
+L209: rts
+dec X24
+inc X6
+L210: prn #14
+clr *r5
+L211: sub *r4, *r6
+bne X4
+L212: .string "zlfwdoswbsyghtap"
+L213: clr *r6
+L214: .data 340, 757, -804, 464, -261, -447, -496
+lea X21, r3
+stop
+L215: .data -10, 38
+L216: cmp *r1, r7
+prn #18
+L217: mov #27, X19
+clr *r6
+rts
+not X8
+; comment
+lea X23, r2
+rts
+L218: .data 761, 626, 773, -503, 12, -576, 633, -136
+sub r7, *r2
+L219: prn r4
+L220: .data -736, 59, -338, 896, -983, -684, -72
+prn L81
+mov r7, r0
+clr L250
+jsr *r3
+add r2, r0
+L221: rts
+jmp *r7
+mov *r7, *r5
+clr *r7
+; comment
+not X14
+jsr L249
+L222: .data 479, 798, -613, -808, -870, -138, 604, 866
+bne *r3
+dec X1
+; comment
+stop
+mov *r2, *r6
+mov X1, X13
+L223: .string "wznovmvawll"
+clr X14
+jsr *r6
+L224: .data -108, -270, -826, 17
+inc L242
+inc L75
+sub r3, *r7
+bne X11
+inc *r5
+L225: lea L80, r2
+jmp *r2
+stop
+L226: .data -777, 500, -728, -82, -399, 338, 302
+jsr *r1
+red *r6
+jsr X22
+L227: .string "trvqzdqhuqxgo"
+not r5
+mov X14, *r7
+L228: .string "cbzajy"
+cmp *r0, #-218
+sub #-74, *r2
+prn #37
+L229: .data -580, 281, -106, -350, 929
+cmp *r7, r2
+; comment
+add #-34, r7
+add L112, *r1
+stop
+L230: cmp L68, X18
+rts
+prn #-42
+cmp X14, #-211
+L231: cmp *r6, X9
+L232: rts
+not *r3
+L233: mov *r3, r2
+bne *r2
+L234: .string "ctvxwdownirly"
+L235: bne *r3
+sub *r6, L35
+L236: bne *r7
+sub r6, r0
+not L254
+L237: dec *r3
+cmp L162, X9
+L238: .data -819, -621, 446, 423, 754, -240
+add #168, *r0
+clr r5
+jmp *r3
+bne X5
+; comment
+L239: add X14, *r1
+clr X11
+dec r1
+L240: bne L45
+L241: .data -316
+cmp #44, L259
+bne *r1
+cmp r6, r1
+lea X9, L134
+L242: .data -201, 147, -106, 338, 89, -307, 40, 327
+; comment
+clr *r2
+clr X17
+L243: prn #-70
+inc r7
+sub r6, X19
+L244: .string "xhztuxiyhdkcvla"
+red r5
+L245: jsr L247
+L246: sub #-225, L231
+; comment
+lea X24, *r1
+dec L257
+clr L252
+inc L254
+not *r4
+L247: jsr X15
+prn r2
+not *r4
+rts
+L248: .data -421, 354, -532, -844, -676
+L249: .data -363, -125, -420
+sub *r6, *r5
+mov r6, *r6
+clr *r6
+mov *r5, L264
+jsr X20
+red r3
+bne L240
+sub L60, X10
+L250: .data -690, 929, 681, -555
+jmp L259
+L251: .string "wkscpucjgitaz"
+red X9
+lea X6, *r2
+inc r6
+prn *r5
+not *r0
+lea L253, r2
+sub r3, *r7
+rts
+L252: .string "rzbrpddipqsqq"
+red *r1
+prn L125
+inc *r2
+jsr L255
+stop
+rts
+lea L66, *r4
+sub *r4, r6
+mov *r7, L257
+L253: sub r4, L187
+jsr *r7
+L254: jmp X0
+L255: sub *r2, *r0
+lea X3, *r1
+L256: prn r0
+L257: .string "ixnabqpoa"
+bne X14
+add *r2, X17
+not L259
+L258: clr r2
+L259: .data -375, -767, 866, -767, 946
+cmp r7, #122
+not *r1
+jsr *r2
+L260: sub L201, *r1
+jmp L263
+add r7, r1
+stop
+lea L124, *r1
+L261: sub #30, X10
+L262: clr X7
+sub L268, r7
+add L219, r7
+bne *r4
+jsr *r6
+inc L74
+L263: add r2, X14
+not *r7
+
+jmp L265
+rts
+dec r5
+
+bne *r6
+jmp L121
+L264: cmp X8, #-151
+rts
+L265: .data 979, -330, -45, 329, -541, -455, 976
+L266: .data -848, -175, 408, 325, -724, 582
+bne X18
+clr r0
+clr r1
+add L267, r0
+red r4
+; comment
+add *r7, L174
+mov #88, r2
+L267: .data -318, 589
+rts
+L268: lea L90, *r4
+jsr X11
+mov *r3, *r4
+jsr *r4
+
+stop
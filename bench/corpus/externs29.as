@@ -0,0 +1,1043 @@
+; Generated by genCorpus --seed 30
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+
+cmp r3, #-227
+jsr L133
+L0: .data -956, -766, -560, -589
+prn X22
+L1: cmp #178, r7
+jmp X4
+stop
+stop
+L2: jmp *r4
+prn *r0
+L3: inc L146
+dec *r2
+red *r7
+
+dec r2
+inc *r7
+red *r1
+jsr X23
+jsr *r3
+add *r3, r0
+prn L3
+bne *r6
+mov #-19, *r2
+clr *r1
+clr r5
+jsr L132
+lea L155, *r4
+L4: prn X10
+lea L51, X17
+stop
+rts
+L5: stop
+jsr L4
+inc *r0
+prn r5
+rts
+lea X4, r1
+bne *r3
+dec r0
+add *r6, r4
+L6: .string "dvkfzuxzinlcnt"
+sub r3, *r3
+not *r5
+clr r3
+dec r7
+lea L138, *r2
+bne L105
+bne *r7
+L7: .string "kgjagiwmx"
+clr L110
+clr r3
+L8: stop
+jmp *r5
+stop
+L9: clr X16
+bne X0
+dec *r2
+sub *r3, r2
+dec *r0
+L10: cmp *r4, X22
+prn r5
+L11: inc *r3
+jmp *r1
+clr r6
+not X11
+add #-130, r4
+sub #-128, *r0
+L12: .data 431, 331, -828, -161, -444
+
+bne L88
+not r6
+rts
+clr r0
+prn r6
+lea L229, r1
+
+stop
+red r2
+jsr X21
+mov #54, r4
+L13: not L5
+L14: cmp L6, L2
+L15: .string "fblgmiugolraprqyd"
+clr r3
+not X12
+sub L132, X10
+L16: .data -766, 225, -928, 196, -403
+jsr L50
+bne *r7
+lea L4, r7
+L17: mov r1, *r5
+cmp L2, *r2
+bne *r5
+cmp X17, *r0
+jsr *r1
+not *r0
+L18: cmp r7, *r4
+lea L4, *r7
+jsr L5
+jsr L30
+jmp X4
+stop
+not X13
+lea X24, *r1
+prn *r0
+L19: clr r3
+L20: not L13
+L21: add r6, r5
+L22: stop
+dec *r3
+rts
+L23: cmp r3, *r4
+inc L129
+L24: inc X20
+L25: .data 486, -834
+not r7
+jmp *r3
+lea L13, X8
+L26: cmp #75, *r1
+lea L10, r7
+rts
+L27: stop
+cmp r3, X21
+stop
+L28: jmp *r4
+cmp r7, r6
+not L15
+L29: red r2
+cmp r2, *r2
+mov X18, X18
+L30: .string "hmidzlzpfifzf"
+L31: red r2
+L32: mov #-7, *r3
+L33: .string "qjutfgszhlxkk"
+L34: .data -425, 166, -133, -979
+clr r7
+rts
+prn r0
+L35: inc *r4
+not *r5
+red L141
+not r1
+cmp r0, r4
+prn #-198
+; comment
+L36: .string "vzzvldyxodlgrkmruilmdz"
+cmp #-179, r3
+L37: mov #237, L8
+dec r1
+dec *r0
+mov #-14, r3
+red L1
+dec *r2
+red *r7
+L38: dec L55
+L39: lea X0, *r5
+bne L53
+; comment
+rts
+inc r7
+L40: .string "tdghmo"
+L41: mov r4, L22
+not r6
+dec r4
+red r6
+L42: dec r2
+prn r3
+jmp *r7
+red r1
+L43: rts
+jmp *r6
+bne L0
+mov *r0, X1
+inc *r5
+L44: lea X20, *r1
+L45: .string "xqimfpnnamixspqvczsgd"
+red X5
+L46: prn *r5
+sub r0, *r6
+rts
+add #250, *r2
+rts
+lea L104, r3
+; comment
+prn r0
+cmp L239, r2
+inc *r3
+sub #-115, L156
+; comment
+jmp X8
+rts
+L47: not *r6
+prn *r1
+L48: jsr X21
+; comment
+rts
+rts
+L49: bne *r2
+cmp *r3, L34
+lea X20, *r6
+L50: jmp L43
+inc L237
+L51: .data -153, -785, 250, -602, -361
+clr r5
+lea X7, X3
+L52: clr X6
+dec X20
+rts
+stop
+add *r1, *r7
+L53: cmp *r2, *r1
+L54: not r6
+sub #118, r2
+add #-164, *r0
+L55: .data 412, -997, -246
+L56: .string "bqlx"
+jmp *r6
+jsr *r6
+clr *r0
+bne *r0
+L57: dec L126
+L58: .data 97, -714, -893, -585, -295
+bne *r3
+jsr *r5
+sub X5, r4
+L59: stop
+L60: .data 420, 839, -160
+L61: cmp *r7, *r6
+L62: not *r0
+not *r1
+rts
+L63: stop
+L64: mov #114, L28
+mov X16, r1
+clr r3
+bne *r3
+inc *r4
+
+bne L48
+dec X16
+bne L32
+cmp *r4, r5
+sub r7, r2
+cmp L90, L83
+rts
+mov L4, *r1
+red *r4
+L65: .string "sx"
+jmp *r2
+lea L92, r3
+inc r3
+jsr *r4
+prn r0
+L66: not X5
+not L167
+lea L218, *r2
+mov #114, r5
+stop
+L67: jsr L113
+L68: prn *r5
+L69: jsr X0
+not X4
+stop
+L70: clr *r6
+prn *r0
+jsr *r7
+dec L128
+mov X21, r0
+jsr *r4
+dec r6
+jmp L8
+add *r0, *r6
+lea X21, r2
+L71: clr X13
+bne *r0
+L72: stop
+bne *r7
+red r5
+L73: .data 416, -938, 212, -471, 76, 658, 763
+lea L17, X1
+inc r6
+clr L209
+jsr X16
+L74: .string "rpxzywwlnffcyl"
+prn r4
+L75: .string "gqfledpnlltratyfmcw"
+dec *r6
+rts
+clr L190
+red *r6
+
+prn *r1
+cmp *r0, *r3
+lea X21, L210
+add #247, L45
+jsr *r4
+sub #85, *r1
+red X8
+L76: add *r7, r3
+cmp *r6, #192
+dec r7
+inc L90
+prn #28
+bne X23
+lea L74, L145
+lea X2, *r7
+rts
+stop
+mov r0, r1
+not r3
+jsr L20
+L77: sub r3, *r5
+; comment
+bne L121
+sub L106, r1
+add #-219, r4
+rts
+prn *r7
+L78: .data 952, 840
+jmp *r2
+dec L62
+L79: .string "uurfsibioh"
+inc *r1
+prn #71
+L80: not r5
+prn *r1
+stop
+prn #84
+cmp X12, #-235
+rts
+cmp #-219, *r0
+dec r0
+jsr *r3
+dec *r5
+jmp L144
+; comment
+dec *r2
+not X0
+mov #29, r4
+L81: lea L170, *r5
+not X9
+lea L54, r5
+inc *r5
+red *r1
+stop
+lea L148, *r3
+jsr L108
+jmp *r3
+mov #138, X2
+sub *r5, L1
+L82: dec r1
+red *r3
+L83: .string "fydnduccmq"
+sub r6, X22
+L84: .string "evdbqrxnxmmcpmrogzroaay"
+prn r4
+lea X20, *r3
+add X14, *r3
+prn #-243
+prn *r1
+L85: .data -710, 46, 353, 839, 904, -913
+add L157, r3
+stop
+clr L69
+stop
+rts
+rts
+L86: red L154
+lea L38, L73
+rts
+add *r2, r5
+add r1, *r4
+L87: cmp L55, r5
+clr r1
+clr r2
+L88: add #12, *r4
+jmp X19
+stop
+cmp *r0, *r0
+sub X5, r1
+L89: jsr L119
+L90: .data 869, 547, -963, 74
+add #-14, r0
+dec *r3
+rts
+not X18
+stop
+mov r3, r3
+add *r1, r7
+L91: sub #57, L97
+prn *r5
+add #63, L64
+jsr L26
+jsr L246
+lea X3, L40
+add #135, r1
+inc *r4
+L92: cmp *r7, #41
+red *r7
+red *r5
+jsr L82
+bne *r1
+add X6, r5
+L93: mov #-76, r0
+rts
+L94: prn *r4
+jsr *r0
+L95: lea L76, *r6
+lea L31, *r4
+lea L118, *r2
+add *r1, *r0
+L96: lea X22, *r0
+stop
+bne L77
+inc X19
+stop
+L97: .string "y"
+rts
+bne *r3
+dec *r4
+L98: inc r2
+not L98
+dec *r1
+L99: .string "ogobxrflkxg"
+dec *r3
+stop
+L100: .data 870, 391, -384
+inc *r7
+
+prn *r1
+prn r7
+; comment
+L101: jsr L141
+mov L197, L27
+L102: rts
+lea L33, r2
+red X8
+L103: rts
+L104: lea L118, r6
+rts
+L105: .string "dwttczfgckivgqvqnufkph"
+jmp X11
+
+stop
+jmp L152
+jsr X0
+mov X10, r3
+jsr *r2
+add #27, r6
+L106: .string "ycndmezxlvn"
+lea X19, *r4
+sub *r1, X23
+stop
+
+; comment
+rts
+; comment
+stop
+cmp *r4, *r6
+clr r7
+bne *r0
+dec r2
+rts
+lea X18, *r3
+mov L176, L54
+L107: .string "iyhaenc"
+prn #-35
+sub #165, L188
+L108: .data -126, -592, 847
+inc *r6
+; comment
+prn #-108
+clr L71
+lea L222, *r4
+L109: .data 332, 277, -485
+not L133
+red *r0
+L110: red r5
+bne *r4
+red L189
+jsr X12
+sub X19, X9
+L111: jsr *r5
+sub *r4, L15
+prn L214
+mov X10, *r3
+L112: prn #-221
+jmp *r6
+jmp L182
+L113: cmp r0, *r5
+dec X2
+rts
+red L208
+dec r7
+bne X19
+rts
+L114: jmp X13
+jsr *r2
+L115: .string "ysvzqsie"
+sub L16, X5
+inc *r6
+lea L65, *r5
+L116: .string "ovkeejgjaerxqofnbtbni"
+lea L175, *r6
+L117: red L15
+inc L195
+clr X16
+L118: sub r2, r6
+L119: .string "vbejbmrhtivch"
+prn L6
+add r1, *r4
+; comment
+clr *r6
+not L103
+red *r0
+; comment
+rts
+L120: .string "blgaointvuujzkuvvlvrvny"
+inc *r1
+; comment
+mov *r5, L189
+prn *r3
+add *r3, r4
+L121: stop
+L122: .data -490, -877, -821, -490, 842
+L123: .data -192, 55, -908, -116, 772, 569, 508
+L124: .string "bpeolwoldrj"
+red L37
+rts
+clr L70
+cmp r2, #-195
+jmp *r5
+jsr L170
+L125: jsr *r0
+cmp X22, *r5
+; comment
+red r7
+L126: dec L144
+prn r1
+L127: red r5
+L128: stop
+inc r6
+L129: red L173
+not *r6
+jmp *r6
+sub #-136, L8
+mov #-71, r7
+L130: .string "onnkhwdbjejpopeieoqajn"
+L131: .data 494, -393, 957, 123, 794, 765, 441, -738
+clr r1
+bne *r4
+sub L227, X23
+; comment
+L132: .string "qhyqftkstumfmjyiwmougzox"
+prn r2
+inc X20
+rts
+inc *r6
+prn X4
+red *r7
+sub #45, *r7
+sub *r7, r1
+jmp *r0
+lea X18, r1
+add *r1, *r6
+red r0
+L133: jmp *r2
+red X8
+L134: mov X12, X13
+rts
+L135: .data -713, -460, 689
+L136: .string "hhav"
+L137: .string "krllzbbkbsnqhgonpwtjvdrj"
+jmp L37
+stop
+mov X2, r4
+prn r3
+sub r2, X15
+lea L131, *r1
+clr r3
+prn r0
+prn *r6
+jsr X1
+inc *r4
+jmp X23
+L138: .string "orjwwvoobtokujmlggwio"
+mov X0, r5
+L139: not r6
+prn L212
+bne *r6
+clr L122
+; comment
+clr X7
+sub r6, r4
+L140: not L82
+inc *r0
+not r3
+jsr *r6
+add r0, *r5
+prn *r3
+rts
+prn #-234
+rts
+add #-16, *r2
+L141: .data 777, 638, -747
+dec *r5
+L142: .data 683, -257, -323
+clr *r6
+prn *r3
+jsr L150
+red r4
+cmp r4, #-40
+red *r0
+bne L32
+cmp L189, L184
+L143: clr L223
+sub L163, *r6
+bne *r3
+jsr *r7
+L144: dec r5
+; comment
+L145: .string "etmbsyyueimcnz"
+add #58, r5
+L146: inc *r6
+L147: clr L3
+
+inc r7
+L148: .string "hesiwkttfqlst"
+clr *r5
+dec L80
+prn X18
+mov *r3, X8
+stop
+bne *r0
+jsr L118
+inc *r7
+L149: .data 103
+not r6
+lea L166, r7
+L150: .string "sfkwrqgfpgpkllidxfi"
+not L191
+add L3, *r1
+L151: stop
+prn #-170
+L152: jmp L230
+prn #103
+add #-11, r3
+; comment
+L153: rts
+rts
+clr r4
+clr L246
+L154: .data -938, 398, 138, -441
+L155: jsr *r2
+not *r0
+prn #-145
+add X0, r4
+prn r0
+dec r4
+L156: .data 981, -43, 992, -105, -281, 382
+jsr *r2
+L157: .data -342, 242, 115, 539, -181, -236, 680
+prn X20
+jmp *r2
+; comment
+L158: mov *r0, L217
+jsr *r0
+not r6
+L159: mov *r3, r1
+jmp *r6
+sub r5, r3
+stop
+
+not L237
+prn L160
+not L170
+dec r7
+prn X3
+L160: prn X5
+jsr L185
+rts
+add *r3, L179
+stop
+stop
+not *r0
+dec X15
+L161: stop
+sub r2, *r3
+L162: .data -872, -620, -786, -667, 892, -831
+rts
+jmp L88
+red r0
+inc *r1
+L163: rts
+red r0
+prn r6
+bne *r4
+jsr *r3
+; comment
+add X10, r1
+stop
+; comment
+jsr L214
+L164: red *r3
+L165: .data -92, -174, 667, 449, -792, 71, 648
+L166: .string "zfzckklox"
+not L138
+L167: .string "hhigdfw"
+L168: cmp X3, L5
+not r3
+L169: .data 170, 58, -701, 536, 191, -811
+jsr X22
+bne L212
+dec r6
+jsr *r3
+lea L54, *r7
+jmp *r0
+sub r5, L60
+dec *r1
+lea X21, *r2
+sub #-226, *r1
+add r2, L86
+add #23, r1
+mov r6, *r3
+stop
+L170: dec L111
+add r1, *r6
+bne X9
+mov X4, L72
+L171: jmp *r7
+dec r4
+bne *r2
+L172: .string "bqddqeivhomlr"
+L173: red *r0
+not r3
+cmp r3, L168
+sub L233, r4
+lea L140, X15
+L174: .string "hijl"
+prn *r4
+red r1
+dec *r2
+prn #-221
+not X23
+bne *r7
+L175: bne *r4
+L176: prn r1
+L177: add *r2, r0
+jmp *r1
+L178: clr L187
+L179: bne *r6
+dec L244
+inc L55
+red r6
+mov *r6, *r5
+inc *r2
+red r5
+L180: add r6, r5
+L181: jmp X3
+clr *r1
+L182: sub X1, *r0
+L183: .string "cnrqni"
+
+L184: .string "poijqdahmwtkhiuq"
+L185: .data 605, 422, 75, 260
+inc *r6
+jmp *r3
+inc L180
+sub L232, *r4
+rts
+prn r2
+L186: rts
+mov r4, *r0
+jmp L194
+L187: stop
+jmp *r2
+; comment
+sub X18, *r6
+jmp L120
+clr L87
+dec r0
+L188: clr L199
+inc *r0
+
+L189: jmp L173
+dec r2
+lea L68, L243
+jsr *r1
+clr L143
+L190: .string "ajmhoehyfoidpqq"
+L191: mov *r2, *r5
+stop
+mov r0, *r4
+sub *r5, L146
+clr *r1
+L192: red r2
+L193: cmp #239, #-122
+not r7
+L194: dec *r1
+
+L195: red *r0
+L196: rts
+L197: .data 690, -107, -981
+add L220, *r4
+dec X3
+rts
+jsr *r6
+; comment
+cmp r0, *r5
+prn L22
+mov r1, L222
+jsr *r1
+mov *r3, *r3
+rts
+not X0
+not r5
+lea L244, r1
+lea X17, r4
+L198: not r7
+inc r1
+bne L158
+cmp r4, #178
+L199: .string "mcktbvtwxramkqtqwejs"
+L200: lea X4, L96
+mov #-137, *r2
+red L217
+lea L232, *r0
+L201: dec L0
+mov r2, *r3
+rts
+lea L189, L109
+prn r6
+L202: .data -489, -10
+not X24
+lea L109, r1
+L203: dec *r0
+; comment
+sub #-194, *r5
+L204: .string "znzpgaebevoregaolsuymwn"
+dec X10
+clr L57
+rts
+add *r1, X12
+L205: .data 556, -245, 24, 281, -465, 515, 83, -134
+add L210, X19
+cmp *r5, r2
+add *r5, r7
+L206: rts
+L207: red r7
+; comment
+not X19
+L208: lea X1, *r6
+jsr L214
+L209: not X19
+not X16
+dec r3
+L210: stop
+rts
+bne L220
+L211: red *r5
+prn L41
+add L128, X8
+L212: not *r3
+mov X9, *r3
+mov r2, L241
+L213: .string "vkxbbckwcqdyycqu"
+red r2
+not L40
+L214: red X12
+L215: .string "cmojawgqkkljifprgy"
+add X1, r1
+sub r6, *r1
+not *r0
+jsr *r3
+L216: sub #174, L78
+dec *r1
+cmp L82, r4
+bne X3
+stop
+L217: jsr *r0
+L218: .string "ljsjjwk"
+lea X21, L233
+L219: prn r6
+stop
+stop
+L220: .string "dfpirtsiiygsqzvdiuhh"
+L221: .data 685, 987
+not L106
+mov r0, *r0
+L222: .data 287
+mov r3, *r6
+red *r3
+L223: not r5
+not r1
+rts
+L224: inc L242
+dec r2
+jsr X18
+bne L235
+add r1, r7
+
+add r0, *r0
+not L144
+cmp L105, r5
+L225: bne X5
+sub *r2, *r0
+clr *r1
+L226: .data 730, 880, 710, 465, -930, 187, 665, 825
+rts
+dec *r3
+
+not r2
+rts
+; comment
+; comment
+sub L45, *r2
+L227: .data 221, -857, -904, -420, 244, 580, -271
+red X5
+L228: rts
+bne L230
+prn #1
+inc *r0
+L229: .data -771
+rts
+lea L13, L244
+clr L236
+red r6
+inc L171
+not r3
+dec r3
+lea L234, r4
+jsr *r7
+dec r5
+inc r4
+L230: cmp #-203, *r3
+stop
+L231: inc *r2
+L232: add #250, r3
+stop
+jmp *r5
+prn L164
+rts
+jsr *r7
+dec *r5
+mov #21, L22
+jmp *r7
+; comment
+add r7, L233
+sub X5, r6
+prn #-163
+L233: prn *r4
+clr r6
+prn L245
+sub L246, L238
+L234: cmp *r2, r5
+red r5
+L235: bne L242
+L236: bne X9
+L237: .data -47
+clr *r1
+lea X13, *r1
+; comment
+mov #90, r0
+bne X21
+sub *r1, L240
+L238: .string "sjmphslphj"
+sub L232, r2
+
+L239: .data 321, 989
+mov r3, *r7
+
+L240: cmp r4, *r4
+bne L245
+not L10
+dec r3
+add #176, L212
+L241: not r7
+cmp #-46, L117
+; comment
+L242: .string "jaagtgk"
+lea X16, X2
+rts
+L243: lea X1, L244
+dec *r2
+clr r4
+mov X2, r6
+rts
+clr L244
+cmp *r3, r3
+L244: prn #87
+; comment
+cmp *r2, X19
+prn #-219
+lea X24, r7
+L245: .data 537, -594, 586, 934, 471, -104, 65
+sub #175, r0
+L246: cmp *r4, #47
+bne *r5
+add #7, r0
+stop
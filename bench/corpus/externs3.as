@@ -0,0 +1,1045 @@
+; Generated by genCorpus --seed 4
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+L0: add *r7, L0
+L1: add L28, L1
+L2: .data 995, -760, 865, 385, 354, -936, -569, -790
+L3: not r1
+cmp *r1, r6
+L4: .string "agqskrjkrrwpcpqfbiitvih"
+not *r6
+L5: jsr *r2
+mov *r6, *r1
+mov #-100, L22
+jsr L2
+jsr L5
+red *r2
+stop
+inc *r7
+prn #-171
+cmp X16, *r2
+lea L44, *r7
+L6: .data 440, 703, 619, 219, -581
+clr *r0
+clr L193
+lea X11, *r3
+prn X9
+bne *r2
+add L6, r4
+L7: .string "ctmlxjigdwmieoup"
+not L0
+add r4, r2
+add #-21, *r1
+jmp *r1
+rts
+inc r5
+L8: rts
+L9: .data 966, 188, 708, 348
+not r5
+L10: .data 405, -548, 28, 273, -809, 487
+; comment
+L11: .string "jagjvytgavrverkiozbmlzjw"
+jsr X21
+clr L139
+jsr *r4
+L12: red *r5
+
+inc L192
+L13: lea X8, L271
+inc *r0
+red r4
+L14: jsr L78
+red r0
+jmp X18
+bne *r7
+lea L12, r7
+jsr L185
+add *r5, X7
+clr *r4
+L15: clr L8
+sub L106, L6
+stop
+stop
+stop
+add X8, *r1
+jsr *r7
+L16: .string "pqwxnvuj"
+jsr X14
+L17: jsr *r1
+L18: .data 31, 297, 635
+jmp *r7
+add *r1, r7
+L19: .data -567, -47, 244
+add r5, r2
+clr L16
+inc X15
+red *r6
+sub *r0, r6
+jsr *r3
+L20: jsr L111
+jmp *r3
+prn #-119
+prn r0
+L21: .data 175, 69, -427, -745, 401, -654, 616
+bne L182
+lea L21, r7
+
+L22: .string "rkcoikcsdjtslasevwsyu"
+not *r4
+; comment
+L23: stop
+jmp L157
+bne L177
+red X2
+clr L16
+L24: mov r1, r0
+L25: sub *r2, r1
+L26: .string "ukukchapbybq"
+; comment
+inc X10
+cmp L15, #-10
+L27: .string "ryehqccpcprgpe"
+mov r4, L62
+jmp *r5
+; comment
+mov L14, r4
+red *r7
+L28: add *r4, L7
+L29: .data 422, -16, 915, 673, 554
+inc *r2
+not r7
+inc r5
+
+jsr *r1
+L30: sub L42, r6
+jmp *r4
+inc *r3
+clr *r1
+clr *r3
+clr r7
+clr r6
+not r2
+mov r5, r0
+prn *r1
+mov #-246, r3
+; comment
+add *r7, L17
+L31: .string "gpybaltpjmezybucxcibf"
+mov L19, r6
+L32: stop
+cmp #172, r6
+L33: inc *r4
+inc *r4
+cmp L129, #35
+L34: jsr X1
+prn #159
+mov #174, r5
+add *r0, L234
+mov *r5, X22
+clr r7
+prn r2
+; comment
+mov #-238, *r4
+inc *r7
+cmp r1, *r1
+bne L30
+bne *r3
+L35: .data -15, -655, 770, 292, -894, -753, 804
+not *r0
+cmp #141, X12
+add *r0, X9
+jsr *r5
+mov L129, *r2
+L36: mov L152, *r1
+stop
+cmp r2, r1
+L37: bne X20
+dec *r2
+add X23, r6
+L38: lea L229, *r4
+jmp L68
+L39: stop
+L40: bne L68
+red *r2
+add L77, r7
+L41: dec L18
+L42: .string "ayhgzk"
+red r7
+inc L83
+L43: inc L30
+mov r5, r7
+sub L116, r2
+
+L44: .string "blotsvfbfhzwe"
+mov X1, *r2
+L45: .data -876, 580, -429, -583
+not r6
+L46: dec r1
+rts
+stop
+L47: .string "qtzthudwaizlkzlsrm"
+stop
+lea L98, X20
+jmp L190
+L48: rts
+L49: jsr L78
+lea L191, r2
+L50: cmp *r6, L160
+sub #-62, *r5
+L51: .string "cfrwfigm"
+L52: .data -937
+L53: .string "dn"
+cmp r0, #64
+dec r3
+inc *r0
+jsr L3
+mov r6, r2
+rts
+L54: jsr *r2
+cmp r0, X7
+L55: rts
+L56: .string "vbcxvcmeapnrfpgrh"
+jmp L168
+cmp *r3, #152
+clr r0
+red L18
+dec *r4
+; comment
+lea L128, *r6
+inc X0
+L57: .string "fvmdmkyqfljpokvz"
+jsr *r2
+dec *r0
+bne *r3
+jmp X21
+cmp *r0, #251
+prn *r0
+bne X6
+
+bne *r3
+not r4
+L58: stop
+L59: .string "zviajqpmht"
+not *r0
+L60: .data 732, -914, -270, -664, -857, 546
+not *r1
+prn *r4
+jsr *r1
+L61: add #-247, L23
+L62: cmp X22, r2
+cmp r1, *r2
+L63: stop
+bne *r2
+sub *r1, *r7
+not *r4
+lea L237, *r7
+bne *r0
+L64: .data -50, -275, -600, 506, 518, 388
+rts
+L65: jmp X3
+L66: add #97, *r3
+jsr *r0
+; comment
+not r4
+jsr *r0
+not r4
+L67: bne *r4
+not *r6
+red r2
+add L71, r1
+L68: .data 357, -220, 293, 393, 89, -377, -80
+L69: jmp L55
+clr r5
+dec L102
+cmp r2, L50
+L70: .string "cfsm"
+L71: dec X15
+L72: cmp r7, r3
+L73: dec *r2
+sub *r2, *r0
+rts
+L74: .data 188
+L75: stop
+add r3, r1
+jsr *r2
+stop
+red L72
+; comment
+lea L16, L10
+inc *r4
+mov #-70, X24
+bne *r4
+clr r7
+red r2
+L76: dec r0
+cmp #225, #197
+L77: jmp X14
+inc r0
+L78: jmp *r5
+not r5
+mov X5, X7
+dec *r6
+jsr X17
+; comment
+bne X1
+bne L167
+L79: mov r6, *r6
+jmp *r0
+L80: jsr L163
+not r7
+L81: .string "zfkzzwtetgs"
+jmp L178
+red r4
+L82: .string "zohdxt"
+not r7
+sub #-155, X16
+L83: mov #29, X18
+rts
+rts
+L84: rts
+L85: add #12, r7
+L86: .string "noromtoif"
+rts
+prn #162
+L87: cmp #-107, L172
+L88: red L178
+jmp X13
+stop
+lea X21, L200
+; comment
+red r2
+stop
+sub #220, *r6
+clr X4
+L89: .string "kulmocssectkfxcbibhvf"
+add X0, L169
+L90: .data 319, 625, 748, -455, -622, 82, 458
+prn #79
+L91: rts
+inc *r2
+inc L82
+sub *r7, X14
+dec r3
+L92: bne *r6
+cmp r2, *r3
+not r3
+L93: clr L80
+inc r5
+L94: stop
+mov #255, r7
+red X16
+sub *r5, r5
+L95: mov L13, r1
+red *r0
+red *r0
+add L22, L19
+cmp #197, *r6
+L96: .string "rteiqneg"
+L97: .string "msfdoak"
+L98: .string "wyzmmjjuagwifn"
+jsr L8
+mov *r6, r5
+inc r4
+stop
+cmp r4, *r2
+L99: jsr *r5
+prn *r5
+L100: .string "uwlvf"
+cmp L265, #126
+
+add r2, *r4
+jmp L23
+L101: jmp X16
+lea X8, *r5
+sub #92, *r3
+rts
+mov r5, *r5
+lea L172, r0
+clr *r7
+L102: stop
+lea L0, L250
+L103: .data -253, -895, -275, -555, -304
+not *r6
+jsr *r1
+sub L138, r3
+jmp *r4
+dec *r4
+L104: bne X7
+L105: sub r3, r0
+L106: red r5
+lea X24, L5
+cmp #36, #47
+bne *r5
+L107: inc X1
+L108: cmp *r2, #-54
+mov r7, r1
+stop
+lea X14, L74
+mov *r7, r4
+add L91, r2
+jsr X5
+rts
+jsr L195
+jmp *r7
+lea L218, r4
+L109: .data -530, 951, -864, -593, -36, -378, 627
+mov X10, r3
+not *r7
+L110: not L195
+; comment
+clr r6
+L111: inc *r4
+mov #-12, *r1
+L112: red L152
+cmp r0, L203
+cmp r1, *r6
+L113: .string "lnuulvmldibixlfxyxdf"
+add L84, L6
+jmp *r2
+jsr *r7
+clr L136
+mov #-194, *r6
+prn X9
+L114: .string "wepbqybagqobwxpvlzfo"
+sub *r7, *r7
+clr r3
+add #70, *r6
+L115: jmp X4
+L116: cmp X9, r5
+lea L267, L162
+L117: prn #-183
+
+not r6
+bne L22
+prn X19
+L118: jsr *r3
+lea L128, r1
+; comment
+L119: inc r3
+rts
+add L53, X19
+jsr L96
+rts
+bne L127
+red r3
+L120: .string "pbionmwrvhylwfxzghl"
+jmp *r2
+dec *r3
+inc r5
+mov #-140, L37
+add X16, *r0
+prn L193
+mov L265, r3
+lea L15, L141
+L121: lea L167, X0
+inc *r7
+add #-224, *r6
+L122: .data -192
+red r5
+bne L160
+bne *r1
+clr r7
+L123: .data 223, -573, 499, -976, -840
+; comment
+clr r7
+lea X20, *r6
+L124: rts
+jsr *r1
+add X0, X23
+rts
+red L27
+inc *r3
+L125: cmp #-250, *r6
+sub r5, X24
+add r5, r1
+mov #135, *r1
+L126: bne *r4
+mov #-77, X18
+prn *r6
+rts
+sub X15, L125
+inc *r7
+dec *r6
+sub X19, X16
+
+prn *r1
+L127: bne *r4
+L128: .data -898, 739, 152, -821
+
+L129: rts
+clr r4
+prn #-73
+bne L175
+L130: .data -947
+prn r1
+jsr L66
+sub *r4, r5
+L131: .string "bpyiayzvacbdsbmrodddsnwb"
+L132: lea L32, *r0
+L133: cmp X11, *r4
+clr X2
+rts
+rts
+sub L25, X9
+rts
+jmp X12
+bne L94
+red *r7
+red r1
+
+lea L239, *r1
+bne *r6
+lea L261, X6
+cmp X2, r4
+mov L97, L117
+red *r3
+L134: cmp #-57, r4
+
+add r5, r4
+inc r4
+rts
+dec r0
+lea L217, X16
+red *r0
+L135: .data 927, 375
+L136: jmp *r2
+cmp #53, L128
+prn L150
+clr L97
+stop
+L137: .string "lppbfpbezhwongfozpx"
+sub r5, L258
+stop
+L138: rts
+L139: dec X20
+stop
+red L91
+L140: dec r5
+not r4
+L141: .string "xjz"
+sub r5, r1
+L142: clr r2
+L143: .data -487
+prn #-236
+cmp L107, L197
+; comment
+L144: clr L213
+sub *r2, *r6
+L145: mov L208, L98
+stop
+L146: lea L37, X3
+inc r5
+inc *r4
+
+L147: mov *r6, L151
+cmp r1, #-176
+not X20
+bne L181
+L148: mov r2, L36
+add *r1, X1
+L149: add *r6, r4
+jsr X22
+prn #-158
+inc r3
+mov X15, r7
+stop
+jmp L79
+dec r7
+mov #-121, *r3
+L150: .data -190, -711
+
+L151: .string "x"
+clr *r6
+dec X24
+L152: red *r2
+red L258
+dec *r0
+prn L245
+stop
+jsr *r2
+inc r3
+prn X9
+prn L93
+L153: mov #-245, L220
+sub r5, *r5
+stop
+cmp *r6, L73
+rts
+add r4, L116
+add *r2, *r6
+L154: jsr X3
+cmp r4, r7
+cmp r0, X21
+jmp L198
+not r0
+stop
+L155: jsr *r5
+sub X23, r2
+L156: .string "saqyjtoildgnlomwhedqlfw"
+dec r6
+jmp *r5
+L157: .string "pak"
+L158: red r1
+L159: .string "pabgvgstox"
+L160: .data -383, 123, -783
+add X8, L184
+mov L169, r7
+stop
+L161: cmp X1, X14
+L162: .string "oukxszeg"
+cmp X23, r0
+L163: not *r4
+bne *r1
+; comment
+stop
+sub *r0, L102
+red r4
+L164: .data 242, 401, 505, 766, 337
+L165: inc L258
+dec X22
+rts
+jsr *r5
+inc *r0
+L166: inc *r2
+jmp L73
+stop
+inc L109
+L167: lea L114, *r6
+cmp X3, X23
+red X20
+rts
+stop
+L168: dec r2
+prn #-100
+inc r4
+not X19
+stop
+rts
+L169: .string "hhdcmrszparcx"
+L170: .string "rbua"
+L171: .data -121, -664, -367, -55, 111, -120
+L172: bne *r6
+dec L174
+sub #11, *r0
+jmp X6
+bne *r6
+jsr *r5
+not r0
+add #25, X2
+jmp L47
+prn L26
+add #245, L254
+lea L210, L152
+dec X13
+
+red *r5
+
+
+jsr *r2
+inc *r5
+sub r5, L175
+jmp *r3
+clr X22
+L173: stop
+red L7
+L174: not r5
+L175: lea X9, L253
+L176: .string "yrhqnirbypyxrs"
+jmp L182
+inc *r0
+not L214
+red *r4
+dec r5
+inc r5
+stop
+jmp *r7
+dec r4
+dec r1
+sub #-45, X18
+jmp *r0
+L177: lea L249, r0
+bne L276
+
+stop
+clr *r3
+not *r2
+jsr X8
+prn L276
+dec r6
+clr *r5
+L178: .data 665
+cmp L156, #-191
+L179: add #139, *r4
+
+
+L180: .data 915, 161, -945, 252
+red r5
+L181: clr L173
+jmp *r1
+prn r6
+red *r3
+dec X4
+L182: .data -343, 917, 684, -147, -108, 485, -34, -422
+bne *r0
+lea L227, L227
+stop
+inc *r4
+rts
+bne L146
+red L203
+
+L183: jmp *r4
+L184: inc r3
+dec r7
+
+sub *r6, r5
+L185: .data 218, 571, -218, -683, -967, 319, -510
+inc r1
+L186: .string "qoodhaztfhzlxrfw"
+stop
+lea L19, *r2
+cmp L7, *r1
+dec r0
+jmp *r6
+cmp r2, #-167
+jmp X19
+cmp #56, X14
+L187: dec L52
+L188: .data 818, 50, -517, 194
+jmp L277
+L189: add r0, L192
+L190: stop
+inc X6
+bne L171
+L191: prn r4
+rts
+stop
+stop
+jmp L100
+sub *r5, r3
+red *r2
+mov X1, r7
+; comment
+
+jmp L170
+not *r4
+L192: jmp X10
+not *r0
+red *r4
+not X3
+L193: stop
+L194: stop
+rts
+prn #-95
+L195: rts
+mov *r5, L241
+stop
+L196: .string "lkzox"
+add X7, r7
+; comment
+rts
+; comment
+L197: .string "uo"
+L198: red r1
+L199: jmp *r1
+clr L186
+; comment
+jmp L139
+jmp *r2
+L200: inc *r3
+inc r5
+L201: stop
+cmp *r4, *r3
+rts
+add L62, L198
+not X2
+sub *r6, X12
+L202: .data -109, 799, 322
+L203: .string "ssbaz"
+cmp r1, L104
+not r2
+L204: .string "uarrvjkzjtivijzyvnwl"
+cmp *r0, X20
+L205: not L266
+clr *r6
+L206: prn L1
+clr *r7
+L207: .string "kkutferfxeulicqwunxexgsf"
+L208: sub #112, r5
+L209: lea L179, r2
+; comment
+L210: .data 939, 956, 10, 735, -489, 771, -680
+bne *r3
+L211: .data -900, -237, 282
+jmp X20
+L212: jsr *r0
+mov #239, r7
+jsr *r6
+prn r7
+L213: .string "cujp"
+L214: .data -854, 657, -639, 153, -422, -344, -897
+prn *r1
+L215: clr L240
+clr L254
+inc r0
+L216: red X16
+
+jmp L277
+prn L161
+L217: red L180
+jsr *r4
+stop
+bne *r7
+L218: jmp X1
+L219: stop
+rts
+clr r7
+lea X24, X1
+L220: jmp *r0
+add *r0, r4
+prn r3
+red r5
+lea L1, r6
+dec L243
+jmp X21
+L221: red r4
+rts
+L222: dec r2
+stop
+stop
+rts
+inc L100
+jsr X2
+not *r5
+red *r0
+L223: .data 646, -169, 45
+stop
+L224: cmp *r5, X18
+L225: .string "zsrkvcohoypbk"
+dec r5
+jsr *r2
+add *r1, *r3
+lea L191, L266
+inc r1
+bne X7
+jsr L99
+L226: dec r0
+L227: .data -864, -396
+L228: .data 36
+cmp X16, #92
+prn *r7
+dec X11
+cmp #45, #-134
+inc r1
+jsr *r2
+clr *r5
+L229: .string "qxnuholerkmuktjzpd"
+prn *r6
+red r4
+rts
+rts
+lea X0, *r2
+stop
+lea L231, r4
+L230: dec L250
+clr r2
+jmp *r2
+L231: inc L237
+stop
+sub X20, *r0
+jmp L256
+L232: .string "udtvfacefej"
+rts
+bne *r3
+L233: sub #32, *r6
+not X22
+L234: .string "ndfkqqzxjmeoocm"
+rts
+not *r1
+jsr *r3
+L235: inc X9
+bne *r7
+
+jsr *r7
+L236: clr *r7
+jmp L210
+jmp X21
+bne X10
+stop
+sub X18, r5
+lea X10, L263
+mov r0, L273
+not *r5
+inc L260
+mov r3, *r2
+; comment
+cmp X11, #184
+L237: sub r7, L257
+prn #13
+L238: jsr L257
+L239: .data 417
+sub r2, L178
+clr r3
+L240: .string "brirairgymaoguferlpnij"
+L241: stop
+mov L266, *r7
+jsr X19
+jmp L186
+prn *r2
+bne L261
+L242: .data 450, 131, -989
+prn r6
+sub #86, r3
+jsr X17
+rts
+bne X3
+mov #-93, *r4
+bne X22
+L243: bne *r3
+clr X16
+lea X13, r2
+prn #-233
+jmp *r1
+cmp #121, r1
+
+prn X4
+not L259
+L244: jmp X24
+L245: bne *r1
+lea L25, *r0
+L246: prn *r4
+L247: red *r1
+jsr *r1
+sub X15, r2
+L248: sub r1, *r4
+L249: rts
+mov #-89, *r3
+lea X6, L79
+cmp #-74, *r1
+jmp *r2
+add X23, L6
+sub #-145, *r6
+red *r6
+L250: sub r3, *r5
+stop
+L251: lea L268, r7
+bne L163
+L252: .string "jbhhwobsw"
+
+L253: .data 656, -599, -544, 33, -935, -452, 985, -713
+stop
+stop
+L254: prn #89
+dec r7
+not L212
+rts
+add r2, *r1
+rts
+jmp X1
+inc X7
+rts
+L255: mov L264, X9
+bne *r7
+; comment
+L256: add L270, *r6
+clr r3
+lea L18, r3
+sub #101, r1
+red X16
+mov L114, X1
+L257: clr r7
+L258: mov r6, *r3
+clr X14
+prn #237
+L259: .data 724, 644, -547, 930, -995, -54
+mov *r0, *r7
+cmp *r5, r7
+L260: .string "aqgbknqlm"
+L261: stop
+inc r7
+lea X7, r2
+dec X16
+stop
+L262: clr r4
+; comment
+add *r1, *r5
+L263: .data -453, -280
+L264: .data 773
+lea L266, r1
+jsr *r7
+L265: .string "pvspysrdhodyzrrhupeymqbu"
+clr r6
+L266: jmp L222
+clr *r1
+L267: .string "owitwkrsxbed"
+L268: dec *r5
+lea L275, L277
+jmp X7
+L269: lea X22, X3
+lea L260, L277
+not *r1
+not r5
+rts
+cmp r0, L271
+cmp X22, X21
+jsr L21
+; comment
+prn r5
+add r4, L273
+rts
+L270: clr *r5
+L271: prn *r5
+red r4
+L272: bne L10
+L273: lea L275, r2
+rts
+mov #-154, X19
+lea L275, r0
+L274: dec r2
+lea X10, *r5
+prn r5
+L275: clr r5
+L276: add #-61, L171
+L277: cmp *r7, *r5
+stop
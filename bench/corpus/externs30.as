@@ -0,0 +1,1044 @@
+; Generated by genCorpus --seed 31
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+L0: .data -336, 949, 35, -418
+L1: .string "ixftvgovnmxdjvvefyohuity"
+not r6
+bne *r3
+L2: sub *r4, L186
+L3: rts
+clr r1
+jsr X7
+jsr L1
+bne L0
+stop
+lea L0, *r5
+; comment
+dec r7
+
+dec *r6
+prn X4
+L4: inc L4
+rts
+bne X8
+L5: not *r5
+rts
+dec X22
+not r6
+L6: .data 869, -1000
+bne L6
+lea X7, r6
+not *r2
+L7: clr *r6
+prn L187
+jsr X4
+mov *r6, *r6
+prn *r7
+L8: red *r1
+cmp *r2, *r2
+jsr X5
+red L194
+bne L6
+lea X0, r5
+stop
+L9: sub r0, L8
+stop
+L10: .data 841, 830, 80, -150, -722, -638, -464, -732
+cmp #248, r1
+mov L1, *r2
+lea X16, *r5
+rts
+stop
+L11: .data -788
+jmp L6
+L12: .data -534
+rts
+prn #169
+cmp r5, L0
+L13: .data 547, 931, 39, -573, -678, 710
+dec r5
+stop
+L14: .string "fouo"
+bne L16
+rts
+not r4
+not L8
+sub #-112, r5
+bne *r6
+add L171, *r4
+not r3
+L15: dec X9
+not X21
+L16: dec L4
+not r2
+add #-188, r4
+inc *r3
+dec *r1
+add #-56, r0
+dec r2
+L17: stop
+rts
+add #-30, r4
+dec r0
+mov r2, L11
+sub *r0, *r2
+L18: lea L16, r7
+L19: .data 80, -227, 467, 349
+L20: .data -674
+L21: .string "reiiz"
+bne L17
+lea L250, L14
+L22: inc X7
+cmp r3, r3
+jmp *r6
+L23: sub L217, *r5
+add r1, *r4
+add X7, L68
+bne *r6
+jmp L18
+jmp *r3
+; comment
+clr *r2
+clr r2
+L24: lea X10, L3
+; comment
+not L261
+jmp *r2
+jmp *r6
+L25: add *r6, r0
+red L13
+prn r4
+L26: mov r0, X18
+
+red r0
+red *r4
+inc *r5
+add r6, *r6
+jsr *r7
+L27: inc *r3
+L28: prn *r0
+prn r6
+; comment
+; comment
+prn #-120
+inc *r5
+
+mov #161, *r0
+stop
+L29: .string "vcciqexiriegpiiqdgbw"
+clr r7
+stop
+red *r6
+L30: sub r5, *r5
+red *r4
+red *r1
+L31: add r1, r1
+L32: mov #48, L47
+prn *r6
+L33: mov X1, L51
+rts
+L34: clr r0
+sub *r3, r4
+mov *r6, r6
+L35: .string "vyielhgfolpuncghphr"
+add *r2, *r0
+L36: lea L15, r3
+L37: mov X7, *r3
+red *r2
+L38: not r7
+cmp L217, *r5
+add r2, *r6
+mov *r7, *r1
+bne *r6
+red r1
+dec *r2
+not L163
+; comment
+jsr *r6
+clr *r5
+stop
+jmp L112
+L39: rts
+L40: prn L24
+L41: cmp L158, r7
+rts
+jsr L179
+L42: not L202
+mov X7, r5
+cmp #-151, *r7
+not *r2
+cmp r0, *r5
+L43: bne X0
+lea L232, r3
+L44: inc *r7
+L45: mov X17, *r2
+inc *r6
+rts
+lea L58, *r7
+jsr *r3
+L46: .string "nxcrwjlbmvxaqycjselztz"
+inc L0
+cmp *r1, #155
+L47: add L55, *r0
+sub r7, r1
+L48: .string "nhrpgduqbv"
+; comment
+L49: clr L196
+bne X14
+cmp *r1, #-221
+L50: add r2, *r1
+prn #-31
+L51: .string "rilqpivbnsgflscpmnm"
+bne L255
+cmp r6, r6
+L52: dec *r2
+
+L53: rts
+jsr X14
+clr r5
+lea L200, L36
+sub *r1, r7
+L54: jmp L88
+rts
+L55: mov *r3, r3
+; comment
+lea L2, X20
+L56: clr X20
+L57: .string "lvmkixndqntgjiizjjzjxt"
+inc *r2
+; comment
+stop
+jmp *r0
+mov r3, *r0
+red r7
+red L26
+add L53, *r2
+rts
+clr *r7
+jsr *r7
+L58: jsr *r5
+rts
+L59: inc r6
+jmp L47
+L60: inc *r5
+prn r0
+prn r5
+prn *r4
+dec X1
+L61: stop
+sub #254, r4
+L62: red *r4
+cmp X0, #17
+L63: prn *r4
+sub *r6, L198
+red r2
+L64: .data -228, 667, -983, 756, 533, 129, -638
+prn X12
+L65: .data -948, -228, 236, 357
+L66: red L175
+
+clr *r0
+
+lea L10, *r0
+L67: clr X14
+prn #186
+L68: bne L63
+jsr *r5
+red r4
+red *r6
+dec r5
+prn r5
+jsr X6
+jsr *r0
+dec r7
+L69: .data -459, 169, -327, -374, 189
+clr L143
+mov *r7, *r1
+prn *r1
+dec L37
+mov X24, *r2
+L70: red *r0
+L71: .data 505, 387, 277, 770, 331, -896, 254, -655
+red *r5
+lea X16, *r5
+; comment
+prn #-58
+mov r7, *r5
+cmp #11, *r1
+add X17, X11
+dec *r0
+
+L72: .string "l"
+not r5
+L73: add X8, *r1
+clr r7
+clr r7
+not X16
+jsr X24
+jmp *r1
+sub L44, *r1
+mov *r0, *r6
+
+
+mov r0, *r1
+not L51
+lea X7, X17
+red r6
+clr *r4
+bne *r5
+rts
+L74: not *r0
+mov r6, *r7
+
+L75: cmp L49, r5
+L76: rts
+add r3, r6
+red *r7
+prn L69
+L77: mov r4, r7
+dec r4
+L78: red X15
+L79: inc L121
+sub *r1, r3
+L80: not r1
+dec *r1
+L81: cmp #216, L204
+prn *r2
+cmp X17, #106
+not L230
+L82: jmp X10
+; comment
+jmp *r0
+jmp *r5
+clr r4
+sub #49, *r3
+dec L103
+sub #-81, r2
+red r1
+not r2
+
+L83: .data -349, -839, 448, -147, -412, 158, -503
+
+L84: jmp *r6
+L85: .data 435, -560, -449, 498, 795, -357
+L86: add #94, r7
+mov *r7, X16
+lea L103, r1
+add *r2, L175
+L87: .data 859, -961, 147, 673, -922, 689, -280, -202
+bne X18
+stop
+lea L92, *r1
+clr L82
+cmp #134, *r0
+cmp #200, X20
+lea L170, r0
+L88: mov r4, L25
+clr r1
+dec X11
+rts
+L89: add r4, X16
+clr r3
+stop
+; comment
+
+dec L237
+jmp X24
+stop
+not r4
+jmp X6
+L90: dec r0
+add #-70, *r2
+bne X4
+L91: lea X18, r6
+bne *r3
+L92: cmp #-175, *r1
+L93: not r4
+stop
+L94: cmp r7, r1
+L95: jmp *r3
+bne L140
+L96: bne *r5
+red r3
+jsr L155
+not r4
+stop
+prn r2
+mov X13, *r3
+inc r4
+jmp L115
+jsr X19
+add *r2, r6
+not *r3
+prn X0
+L97: .string "fhdjjodivxsn"
+L98: .string "gnjkmfepw"
+dec *r5
+L99: .string "vcjagrggtqtxfpaivwkqnwr"
+rts
+
+
+sub #215, L228
+add *r7, *r6
+prn #101
+inc *r1
+L100: .data 472, 264, 982, 309
+jmp *r7
+not *r3
+L101: .string "uwcgjbdlucftvukgsvfq"
+L102: red r0
+L103: .string "obxyabn"
+mov *r0, *r0
+L104: jsr L219
+mov #-190, L126
+L105: dec *r0
+prn r2
+red r3
+not *r6
+mov #-2, r5
+prn L74
+L106: cmp X19, #-105
+lea L65, *r6
+dec *r0
+L107: jmp *r4
+stop
+not r3
+add #183, r0
+L108: stop
+clr *r7
+prn X24
+not r3
+mov #-181, *r3
+inc r0
+lea L176, r2
+bne L101
+stop
+L109: not *r4
+cmp r1, r6
+prn #-208
+lea L229, *r7
+jsr *r0
+not *r4
+sub #249, r0
+clr L117
+prn #83
+; comment
+L110: inc X19
+prn *r6
+sub r6, *r7
+sub #-3, r3
+clr X22
+jmp *r1
+add L202, L126
+L111: .data 3, -2, 442, -605, 714, -165
+; comment
+rts
+L112: prn #190
+sub *r0, L181
+L113: .string "rhamckvqyacauzfjvbl"
+bne L119
+L114: sub #-207, *r1
+add L183, L44
+L115: red L41
+jsr X13
+rts
+not X14
+not L196
+bne X22
+sub #-57, X22
+L116: prn #80
+jmp *r6
+prn *r5
+L117: add r4, X5
+bne X24
+L118: .string "qreslf"
+L119: dec r4
+L120: prn r4
+stop
+red L102
+mov r5, *r4
+L121: jmp *r4
+L122: bne L236
+L123: bne L60
+L124: sub *r4, r7
+L125: not r3
+jsr *r0
+; comment
+L126: rts
+stop
+not X24
+mov #-2, *r3
+prn #-195
+sub X6, r0
+jmp X11
+lea X9, *r0
+sub r4, r1
+lea L190, r5
+prn #3
+L127: dec *r4
+inc r4
+stop
+red r6
+; comment
+stop
+not r2
+rts
+mov r7, r7
+add #-194, L17
+cmp X14, *r5
+L128: add r0, r5
+red L118
+inc X20
+rts
+dec r5
+L129: prn L121
+inc L124
+dec L213
+dec L99
+L130: red L128
+L131: sub *r3, X5
+L132: .data -356, -51, 316, 938
+L133: stop
+red r3
+jmp L90
+add r5, *r0
+rts
+dec r2
+L134: prn r6
+bne *r2
+L135: not L65
+L136: .string "hjdeglfjnc"
+jmp L25
+not X16
+add #173, r6
+dec r2
+prn *r3
+rts
+dec r5
+L137: cmp *r6, r1
+
+L138: clr L233
+inc *r3
+dec r6
+sub *r4, X22
+L139: prn *r4
+clr *r1
+
+inc r0
+not r1
+L140: inc *r2
+L141: jmp X7
+dec X14
+cmp r0, X1
+jsr L221
+dec L146
+sub *r6, *r3
+lea L257, L58
+L142: .data 649, -804, 689, 154, -186
+mov *r7, *r2
+bne *r4
+red *r4
+inc r3
+
+rts
+lea L99, r1
+add X10, *r2
+inc r0
+clr L34
+sub r5, *r6
+L143: jmp *r6
+L144: add #-141, X5
+prn L145
+L145: prn L41
+sub *r0, X20
+inc L41
+L146: red r4
+jsr L99
+red *r4
+dec *r6
+inc r7
+L147: .data 250, 831, 845, 72, -892
+sub X24, X2
+L148: rts
+L149: bne L183
+L150: .data 413, -740, -844, -513, -132, -672
+cmp #-17, #164
+add X15, *r0
+; comment
+L151: dec r0
+prn *r0
+L152: .data 873, -688, 550
+jmp *r0
+prn r0
+L153: jmp X12
+add #-80, *r1
+stop
+cmp *r5, X20
+L154: not X21
+L155: stop
+rts
+inc r1
+dec r2
+rts
+L156: jmp L223
+L157: inc L197
+dec *r5
+cmp r5, *r1
+bne L257
+dec *r6
+bne *r7
+L158: .data -610, 767, 737, 785, 759
+red r4
+jsr L209
+clr *r5
+mov r1, r1
+L159: cmp X14, #-9
+stop
+jmp X18
+stop
+L160: lea X19, *r2
+sub *r0, r1
+L161: .string "xsucegwckxjvukheoki"
+L162: jsr *r2
+add #158, L220
+sub *r5, r5
+stop
+rts
+rts
+lea X19, *r2
+mov r7, *r0
+clr *r1
+L163: rts
+L164: .data -90, 793, 635, -192
+stop
+stop
+jmp *r7
+L165: .string "dwxvsnveaunxgfktfj"
+red *r1
+L166: mov *r7, X8
+L167: inc L191
+; comment
+sub *r5, r6
+inc r4
+add *r2, r0
+lea X12, X14
+lea L224, r0
+clr *r0
+not *r3
+stop
+prn L90
+inc r3
+not r1
+lea L259, r5
+L168: rts
+
+mov *r6, r0
+mov #-187, *r1
+mov r1, r5
+red r7
+L169: sub X9, r7
+jsr *r5
+lea X5, r0
+rts
+L170: jmp L180
+stop
+inc X20
+cmp *r2, L239
+add *r6, r6
+L171: .string "uvzeznilxzk"
+bne L1
+rts
+L172: .string "yvqtcofpqxcvueyoyubyzrur"
+cmp L162, #-232
+stop
+stop
+stop
+mov r1, r3
+
+sub X9, L211
+inc *r4
+add L51, *r2
+add #230, r5
+L173: .string "bopy"
+L174: .string "kwlqqxwmncursyibyapv"
+lea L256, L163
+red *r5
+
+inc r2
+L175: .string "vyofuyxfgwbqjrp"
+cmp #-118, L220
+cmp X10, *r0
+L176: .data -929
+not r2
+red r5
+prn r5
+jsr L150
+L177: lea L80, *r7
+
+L178: .data -374, -134, -890, 558, -300, 459, -886
+; comment
+stop
+prn *r7
+jmp *r4
+add r6, L155
+cmp L104, r5
+L179: lea L135, L92
+sub #-86, r0
+bne X17
+L180: .data 310, 619
+prn r7
+add r4, r1
+clr r0
+L181: mov #240, *r5
+clr *r2
+L182: .string "zbawwgloqo"
+add X7, *r5
+dec L188
+not *r6
+mov L121, r5
+clr L54
+jsr *r6
+L183: inc X12
+L184: .string "qvfgmufjveyvbvjywe"
+sub r7, r5
+rts
+L185: .string "aaxya"
+stop
+jsr L228
+clr *r0
+mov *r1, *r2
+rts
+jsr *r7
+; comment
+L186: add #-189, *r6
+sub r2, *r6
+L187: .data 456, -407
+stop
+
+; comment
+cmp r6, r7
+dec X0
+sub r0, *r6
+bne L217
+stop
+not *r6
+red *r6
+add #-224, *r3
+dec r4
+add #9, L101
+bne *r2
+jmp *r0
+sub *r5, r7
+red X14
+add *r7, X16
+rts
+dec *r0
+dec L124
+add *r1, r5
+L188: add *r6, X11
+prn r4
+mov *r1, L91
+L189: inc r2
+lea L212, r2
+not X10
+cmp #247, *r2
+L190: add #96, *r4
+inc *r3
+mov *r0, L260
+L191: inc L48
+L192: sub *r6, r6
+L193: rts
+stop
+prn *r0
+add *r7, L36
+add r2, L9
+L194: .string "ypwpkw"
+L195: jsr *r5
+prn X8
+lea X4, *r5
+L196: .data -560, -601, -226
+L197: .data -724, -574, -286, 496, -557, -424, 670
+L198: inc L205
+
+prn r7
+; comment
+rts
+sub X12, r1
+prn #-31
+bne L255
+lea L221, L42
+clr X19
+stop
+inc *r2
+L199: jsr L234
+prn L138
+prn *r6
+mov X4, *r6
+bne *r6
+cmp X12, r4
+prn #-84
+clr r4
+sub L206, r2
+prn r2
+dec r0
+L200: .string "zhuqxaahwiutm"
+red r6
+not r1
+L201: .data -993, 120, -340, -719
+mov r3, r7
+lea L240, X8
+clr r4
+cmp r0, L141
+jsr X9
+bne *r1
+not *r3
+L202: .string "mhzfvlubwrzsmsauzj"
+L203: rts
+jsr X10
+
+cmp L253, *r6
+sub X2, L257
+L204: red *r0
+lea L28, r6
+L205: dec *r7
+sub #133, r2
+L206: .string "sb"
+lea L212, r7
+red X22
+stop
+not r7
+L207: .data 22
+jmp *r6
+
+mov #-84, *r1
+L208: .string "valg"
+jmp *r7
+inc L84
+inc *r7
+L209: .string "tjfzzusvctazyqxiahoco"
+mov X12, L258
+L210: sub X7, r0
+mov r3, L197
+add *r3, *r5
+L211: .data 869, 384, 109, 511, -93, -228, 176
+bne *r7
+mov X23, L159
+clr r4
+lea L228, r2
+red L257
+
+jmp *r2
+prn #-30
+bne X23
+lea X17, *r4
+L212: jmp L140
+red *r3
+clr *r6
+rts
+cmp L261, r2
+prn r6
+rts
+bne *r1
+L213: jmp *r0
+clr X0
+L214: prn #196
+L215: bne X4
+inc r1
+rts
+L216: .string "lvobbddtilsm"
+not r3
+jsr *r3
+rts
+rts
+lea X7, r5
+prn #-66
+dec r1
+L217: .data 930, -707, -414, 265, -143, -241, 695
+L218: mov r3, r1
+clr X14
+; comment
+; comment
+stop
+L219: cmp *r4, #149
+bne *r7
+L220: clr X12
+rts
+L221: .data -761, -910, -654, 385
+sub r4, X13
+L222: clr r6
+L223: cmp #169, L261
+L224: mov #-201, *r0
+jsr X4
+mov X7, r4
+add r3, *r2
+cmp #112, *r2
+stop
+; comment
+; comment
+L225: jsr L232
+jsr *r7
+inc X8
+L226: .data 727, 955, 840, -203, -92
+L227: jmp L232
+clr *r1
+clr L130
+sub *r6, r3
+not r4
+L228: .data -151, -304, 687, -1, 743, 345
+add L31, L213
+L229: .string "i"
+jmp X23
+lea X9, *r2
+prn r3
+stop
+mov r6, *r7
+cmp *r5, r4
+L230: .string "tlfwgbiu"
+lea L214, L233
+stop
+rts
+not X0
+rts
+L231: prn *r6
+L232: .string "mabwhjrzg"
+bne X0
+rts
+sub #241, X9
+clr L183
+dec r5
+L233: lea X24, X5
+; comment
+not r4
+dec r2
+L234: .data 241
+sub *r0, *r6
+L235: stop
+bne *r3
+stop
+stop
+mov r4, *r0
+L236: .data -707, 248, -869, 541, 911, 944, -934
+jsr *r6
+jmp L256
+L237: sub X11, r3
+L238: jmp *r0
+dec *r6
+cmp #-180, #95
+; comment
+L239: stop
+prn *r5
+inc L95
+bne L242
+; comment
+inc r0
+rts
+L240: .data -797, -128, -195, 764, 713, -223
+bne L195
+L241: add #168, *r4
+prn r0
+red r0
+dec r1
+rts
+L242: inc r6
+rts
+jsr *r0
+lea L243, *r6
+L243: clr L23
+L244: .string "lqsltqktuuwzjraezjwg"
+clr *r0
+dec r0
+rts
+not X4
+L245: clr r1
+bne *r7
+; comment
+cmp r4, r5
+jsr *r4
+L246: mov #-201, r6
+not r3
+not r5
+red *r6
+dec r2
+L247: .string "zxriatkamybtlnithtwcdtny"
+add r1, *r2
+L248: cmp L21, r1
+; comment
+bne L111
+L249: .string "hayrgyizwqmrmvyvzqxgvkc"
+sub X1, *r7
+stop
+L250: .data -874, -291, -962, -375, 33, 44, -47
+add #-150, r0
+stop
+L251: bne L149
+jsr *r1
+prn #-4
+L252: lea L175, L254
+
+rts
+clr L157
+jsr *r4
+clr L254
+add #-66, r4
+; comment
+L253: red r2
+prn #66
+cmp *r3, r6
+L254: mov X0, r1
+dec *r5
+dec L214
+sub *r6, L257
+L255: stop
+L256: .data 456, -794, 837, 494, 766, 886, -85, 812
+L257: .string "ckqqtcnch"
+cmp #-52, #-126
+cmp *r2, #-67
+cmp X8, r7
+bne *r5
+L258: lea X21, L58
+L259: add #-125, r0
+not L260
+L260: stop
+L261: not r0
+sub X15, *r6
+stop
@@ -0,0 +1,1045 @@
+; Generated by genCorpus --seed 32
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+L0: mov #101, r0
+L1: stop
+mov X18, *r1
+L2: not r0
+L3: sub *r3, *r7
+bne *r5
+L4: .string "sskfrypix"
+L5: .string "rgguclqzmjfsdidgdscj"
+L6: prn *r7
+; comment
+L7: stop
+bne L92
+rts
+sub *r1, X12
+sub *r4, *r4
+jmp *r1
+cmp #141, #233
+L8: .data -362
+jsr *r0
+rts
+L9: .data -555, -597, -81, -933, 985
+mov #-221, *r7
+L10: .data 709, 985, 66
+L11: mov #243, *r5
+stop
+clr *r2
+bne X6
+rts
+mov r4, r7
+bne *r0
+L12: .data 543, 928, 293, -448
+cmp #18, #101
+L13: .string "oxnnyfqkeqn"
+dec *r5
+inc L3
+jmp *r7
+L14: add *r5, r5
+inc r4
+jmp X13
+L15: .data 521, -463, 818
+rts
+add #162, r0
+rts
+prn L237
+bne *r2
+stop
+L16: sub X0, *r3
+clr *r2
+L17: .string "lipinmruzpwqjqzgvql"
+inc *r2
+jmp L229
+add #69, L12
+L18: inc L7
+L19: clr L105
+inc L13
+inc r1
+L20: add #-68, X6
+; comment
+rts
+dec L14
+red *r3
+L21: .string "kc"
+mov *r5, *r7
+prn r0
+L22: bne L11
+clr *r5
+
+mov #55, r2
+prn *r3
+L23: .string "hiitbfz"
+clr X18
+cmp #-26, #155
+sub L9, *r6
+L24: .string "mflcntkbcymypfl"
+sub r3, r6
+jsr L21
+red *r0
+L25: prn *r5
+jmp *r1
+lea X21, *r7
+L26: cmp *r6, *r6
+; comment
+dec r6
+sub L21, L225
+L27: lea L137, *r1
+; comment
+L28: jmp L5
+L29: sub L158, *r3
+; comment
+L30: prn #-85
+L31: jsr L174
+
+mov *r1, r0
+rts
+jsr *r4
+red *r5
+bne X22
+jmp *r2
+rts
+L32: .data 328, 713, -807, 15
+lea L2, *r5
+dec X3
+sub X21, X7
+L33: jmp X21
+not X8
+lea L61, X16
+L34: .string "vam"
+L35: not r4
+
+L36: .string "ojnyevef"
+L37: .string "basyjjwbeiuirfxrbhqg"
+lea X24, *r7
+red L31
+not *r7
+cmp r4, L110
+jmp L77
+inc *r7
+L38: dec r0
+jsr L108
+inc *r2
+dec *r3
+L39: inc *r0
+inc *r7
+L40: prn #193
+prn #254
+rts
+stop
+rts
+prn r3
+L41: .data -970, 324, -224
+jsr L30
+not *r0
+jmp *r2
+rts
+bne L42
+mov L16, L243
+mov *r6, r0
+lea X3, r1
+red r0
+inc r7
+sub *r4, L60
+not X3
+L42: bne L43
+sub X9, r4
+L43: add r6, L142
+sub *r7, *r7
+L44: jmp L62
+mov *r5, r5
+jsr X20
+jsr L263
+not L11
+clr r0
+L45: lea X18, L34
+jmp *r6
+bne X5
+prn r4
+L46: .data 744
+L47: .data 839, 854, -384, -1, -96, -333
+L48: sub *r4, *r4
+L49: .data 721, -681, 479, -252, -791, -269, 649
+lea L263, L172
+inc *r7
+L50: jsr L170
+add L47, L28
+jmp *r1
+red r3
+cmp r2, #127
+jmp X15
+red r1
+jmp *r6
+stop
+L51: .string "ykgsbplx"
+L52: .string "tpv"
+add *r5, r6
+jmp *r0
+L53: jsr *r0
+lea X15, L210
+clr r5
+mov r6, r0
+inc L40
+; comment
+L54: not L28
+sub *r6, *r7
+inc *r1
+L55: sub *r4, *r4
+; comment
+clr *r2
+L56: .string "qhxtkvhzmebfglpkpmgrn"
+jmp *r6
+L57: .data 423, -582, 474, 487, 363, -292, -671
+not *r6
+red r4
+; comment
+L58: prn r1
+add r4, *r2
+L59: prn r3
+not r1
+
+bne X0
+clr *r3
+L60: jsr L155
+lea X3, *r1
+jsr *r3
+L61: inc *r7
+rts
+clr r2
+L62: .data -278, 26, 272, -546, 558, 652
+; comment
+L63: lea X13, *r6
+L64: jmp L108
+jmp L59
+stop
+jmp X1
+clr *r4
+sub r1, r0
+L65: clr *r4
+sub #-189, L102
+bne *r2
+rts
+red r3
+lea X23, *r2
+prn #148
+cmp *r7, #184
+L66: prn r7
+stop
+lea L131, *r2
+L67: jmp *r7
+sub #-252, r5
+L68: .data 472
+inc L168
+stop
+inc *r2
+mov #-244, L24
+prn r3
+inc *r7
+prn r4
+L69: .data -257, 125, -582, -288
+not *r4
+lea L14, r4
+L70: .string "gctyxwrcutmtzegxjgs"
+L71: add X10, r7
+lea L27, L19
+bne L61
+L72: cmp L41, L264
+add *r0, X12
+clr *r1
+
+not r6
+stop
+L73: stop
+red r7
+bne X17
+L74: red r0
+stop
+sub *r7, X22
+stop
+inc L18
+add *r2, r4
+lea X1, *r3
+cmp *r7, r3
+jsr *r4
+inc *r7
+L75: cmp r2, r5
+L76: .string "ktytjgflurnvfiwt"
+cmp X16, r0
+L77: lea L210, *r4
+inc r6
+jsr L95
+L78: bne L39
+L79: inc r3
+jmp *r3
+stop
+cmp *r5, #251
+mov *r3, *r1
+L80: mov r0, r5
+lea L32, L171
+L81: rts
+L82: rts
+jmp L192
+L83: jmp *r3
+add #-180, *r7
+; comment
+L84: bne L72
+prn X24
+lea X21, L55
+not L84
+clr L219
+add r3, X16
+jmp *r5
+jmp *r7
+L85: .data 521, 272, -294, -451, 918
+cmp r1, L275
+L86: jmp *r5
+rts
+mov #199, *r6
+jsr *r6
+not L172
+
+; comment
+L87: lea X1, *r7
+L88: .string "szbqmwutkxfcnubpysltl"
+prn #165
+jsr *r0
+mov L253, *r7
+bne L141
+lea L132, r4
+dec L0
+clr r5
+rts
+bne L98
+bne *r3
+dec r0
+L89: clr r5
+L90: mov #246, L32
+lea L183, *r0
+jsr X4
+not r0
+L91: bne *r3
+L92: stop
+prn #-221
+red r7
+add #-29, L243
+sub #200, *r1
+L93: cmp *r1, *r7
+mov X9, r0
+lea L124, *r1
+red r4
+L94: jmp *r0
+lea L35, r6
+sub *r4, r6
+jmp *r2
+L95: clr X3
+bne *r1
+inc *r1
+sub L83, r1
+mov r0, X19
+dec X18
+clr X3
+inc r0
+dec *r2
+red *r2
+mov r1, L84
+L96: .data -970, 537, -206, 39, -720
+not r5
+inc *r4
+red L20
+; comment
+stop
+jmp X18
+sub #-160, *r6
+L97: dec *r2
+jsr X15
+stop
+not X15
+jsr *r3
+dec *r5
+L98: not *r0
+
+not *r2
+jmp *r2
+L99: inc *r0
+rts
+lea L28, L182
+red r4
+bne *r1
+L100: clr r3
+inc *r3
+inc r5
+prn L63
+inc r6
+
+L101: dec r4
+
+lea X6, r1
+dec X23
+bne *r0
+rts
+cmp L23, *r1
+inc *r1
+lea L92, r3
+add r5, *r0
+dec r3
+cmp r0, r0
+jsr *r3
+jsr L21
+red L127
+L102: clr r1
+lea L7, L267
+not *r5
+L103: jmp L87
+lea X0, L239
+L104: stop
+mov X0, *r0
+prn #-154
+sub #-60, *r2
+sub *r0, L188
+L105: jmp L45
+L106: .string "cczylzxhevskikhfv"
+cmp L27, L103
+L107: .string "m"
+red r1
+L108: rts
+L109: .string "devgge"
+L110: .data -870, -407, 698, 797, -141, 815
+cmp #217, L148
+L111: .string "tuljzpnsaq"
+L112: .data 799, -835, 461, -77, -197
+L113: .string "d"
+inc *r3
+stop
+; comment
+L114: clr L151
+prn #63
+rts
+inc *r0
+sub r3, *r3
+bne *r6
+add #-61, *r2
+stop
+L115: .string "kuxj"
+sub L192, L85
+
+L116: add r0, *r7
+L117: not r6
+inc X9
+
+L118: dec L114
+L119: jsr L207
+L120: .data 391, -357, -61, 547, 541, -19
+L121: jmp *r4
+L122: bne *r6
+rts
+cmp #-234, #-255
+add r5, *r2
+L123: .data -512, 945, 91, -445, 293
+add #-173, L71
+jsr *r7
+prn r3
+prn r7
+L124: clr r4
+lea L90, r2
+jsr L232
+not X5
+jmp *r6
+L125: stop
+not *r4
+mov L266, L178
+L126: .string "md"
+cmp X6, X12
+L127: prn X0
+dec *r2
+rts
+cmp r1, L192
+cmp #-169, *r7
+add #223, L203
+L128: .string "gqponhmewohvxighmkr"
+L129: cmp *r4, *r6
+cmp r4, *r6
+mov L54, *r5
+
+cmp #224, X23
+clr r7
+L130: .string "czndg"
+clr X13
+clr *r4
+sub L74, *r3
+L131: .string "gvtmpunpnuamqmgq"
+rts
+L132: bne *r4
+clr *r3
+add r2, *r5
+L133: .string "oknhqoylsmqstzpa"
+L134: .string "xmggpmccj"
+inc L267
+mov X21, L135
+dec r1
+L135: jmp L47
+mov #-66, r3
+L136: .data 148, 16, -135, -961
+clr r0
+L137: .string "sbfaplramaueqehpixnvdoh"
+not *r5
+L138: inc r7
+cmp r2, L249
+inc L265
+red *r2
+; comment
+red X8
+prn *r3
+sub r0, *r2
+mov #-226, X4
+lea X17, *r2
+L139: red *r1
+stop
+cmp X17, *r2
+jmp *r3
+dec *r7
+cmp L59, r4
+L140: jsr *r3
+L141: stop
+prn r6
+prn #205
+jsr *r3
+prn r6
+not L29
+L142: .string "bxwjtajtmyuvvkkzgiqsolu"
+bne L206
+jmp L66
+bne X11
+dec *r7
+inc *r4
+L143: lea X22, *r2
+dec *r5
+cmp L21, #-118
+rts
+L144: jmp L257
+red *r3
+bne X1
+sub #5, L199
+add r6, r1
+bne X5
+L145: mov L29, L41
+; comment
+mov *r5, L174
+add r0, L252
+L146: dec r1
+L147: mov L135, r1
+inc *r3
+; comment
+L148: .string "extvmhivqk"
+jsr *r4
+clr *r4
+rts
+not *r0
+inc X9
+; comment
+dec r3
+jmp L53
+
+not X23
+red r4
+clr *r7
+prn L215
+L149: dec r3
+stop
+clr r1
+cmp *r2, r1
+mov r5, L2
+red L248
+L150: add r6, L241
+prn r7
+rts
+mov *r1, r7
+mov *r5, *r7
+L151: stop
+L152: rts
+L153: .string "kbazgnlhmcuciyk"
+L154: add #152, *r2
+prn r4
+add r2, *r4
+dec r1
+L155: .data -221, 961, -627, 890, -198, -721, 313
+add *r7, X11
+L156: add #63, r3
+rts
+add #-163, r2
+not *r1
+L157: cmp #-46, L135
+; comment
+stop
+
+jmp L160
+red r1
+not r4
+add r6, *r3
+mov X19, *r7
+add L148, r6
+dec r6
+inc X16
+L158: red r6
+sub r4, L10
+L159: sub r4, *r3
+rts
+jsr L175
+inc *r1
+jsr *r3
+not L199
+clr r6
+clr L265
+jmp X21
+cmp *r3, r5
+jsr *r0
+dec *r3
+
+rts
+
+cmp #62, #-138
+sub r1, X6
+L160: inc r5
+dec L135
+jmp *r5
+
+L161: .string "jtkjahvoiyeb"
+lea X3, r7
+L162: dec L218
+L163: dec *r1
+mov *r4, r1
+prn #180
+sub L130, *r0
+lea L274, r7
+; comment
+mov *r7, r6
+jmp *r2
+jmp L237
+cmp #-75, #-70
+jmp *r2
+not L199
+red r7
+bne L176
+inc X22
+inc L80
+L164: mov *r5, r6
+L165: .data 884
+L166: .data -263, 108
+L167: mov #237, r5
+dec *r5
+L168: cmp *r7, X7
+L169: prn *r1
+L170: bne L179
+L171: .string "hbcwmypwljbv"
+sub *r2, r4
+jmp *r1
+jsr X10
+L172: .data 837, 302, 442, -791
+jsr L187
+L173: add X5, *r6
+L174: add r0, X19
+L175: jsr L114
+L176: .data -952, 319, -646, -456, -623, 22, -902, 109
+clr X16
+bne *r4
+
+mov #-9, *r4
+rts
+sub r5, *r4
+jsr X11
+red r1
+clr r3
+red r5
+dec r0
+red *r4
+not L112
+; comment
+L177: dec r7
+L178: .string "lnsk"
+cmp L0, *r2
+L179: mov #176, X15
+mov r1, L224
+lea L152, *r5
+L180: inc L161
+L181: sub X13, L130
+not *r6
+add *r4, L217
+L182: bne *r3
+add #236, X21
+rts
+L183: red r2
+stop
+clr X23
+L184: mov r2, X1
+L185: .string "bxvfoytzv"
+L186: bne L3
+red X8
+stop
+clr X1
+red r1
+red r6
+L187: not *r5
+L188: prn *r4
+L189: jsr *r0
+red *r5
+sub r1, r7
+rts
+jmp *r3
+L190: .data -970, 169, 804
+L191: add r1, L127
+L192: .string "ewduv"
+bne L41
+jsr *r0
+L193: add #130, X0
+stop
+L194: inc r7
+mov #-76, r2
+jmp X6
+red *r1
+red r3
+jmp *r0
+clr L234
+prn *r7
+L195: dec *r5
+mov #-45, X9
+sub #-53, X10
+add r4, *r7
+sub L247, *r1
+add L233, X12
+L196: mov r5, *r0
+clr L268
+L197: .string "iw"
+; comment
+sub #-20, *r3
+prn r3
+add #4, *r3
+mov #30, r6
+lea L219, r5
+prn X3
+rts
+stop
+stop
+add #-99, *r7
+L198: .string "gevwtqfdyquwyrkzntxcr"
+dec L155
+L199: add L61, r3
+L200: .data -39, -168, -520
+L201: dec L201
+bne *r6
+cmp *r2, r2
+dec *r2
+L202: inc r2
+prn #-97
+stop
+L203: .data -434, 828
+
+clr r2
+lea L248, L133
+L204: lea X1, *r5
+cmp *r0, #-11
+cmp X18, #184
+clr r7
+jsr X15
+mov X9, *r1
+L205: .string "nibuezdpxpcxhwm"
+L206: sub #94, X7
+add #-154, r4
+L207: .string "wifvdfbllcnsjxliwhgskhoi"
+stop
+
+red r5
+L208: inc r2
+L209: not r4
+L210: red *r4
+bne *r7
+L211: inc L227
+L212: jmp X10
+dec *r0
+L213: .data -482
+red *r7
+red L263
+L214: cmp L259, *r3
+red r0
+L215: cmp #66, r1
+sub *r3, *r1
+sub L76, L232
+L216: .data -2, 945, -448, -796, 436, 67, 409
+bne L234
+prn r7
+
+; comment
+jmp *r0
+bne *r2
+L217: lea L226, L109
+jsr X7
+L218: mov L20, X7
+L219: mov r0, X21
+prn X4
+mov r3, r7
+
+L220: prn L253
+clr r1
+L221: cmp X3, r4
+cmp #45, *r4
+dec L240
+L222: .data 764, 89, 473, -869, 678, -214, -803, 4
+bne L235
+bne *r0
+L223: dec L236
+; comment
+L224: red L68
+red L67
+sub L28, X10
+L225: stop
+add L50, r7
+dec r6
+sub *r2, r4
+not *r1
+mov *r7, L149
+rts
+mov #-201, r2
+mov #-180, *r7
+L226: stop
+bne *r4
+lea L78, r4
+lea L11, L94
+dec L267
+L227: stop
+bne X19
+add r1, L180
+; comment
+L228: .data 729
+jsr *r2
+
+not L203
+rts
+red *r4
+L229: .data 981
+dec r5
+L230: jmp *r5
+; comment
+L231: .string "tsrphfscjrxxtvyyrvowzpy"
+prn r5
+L232: .data 422, 220, -52, 756, -15, -606, 125, -509
+not L176
+cmp r1, #14
+L233: not *r3
+red *r7
+sub r0, X10
+jmp *r1
+add X19, *r2
+L234: cmp r2, #7
+clr r6
+; comment
+prn r3
+bne *r5
+bne L116
+lea X5, X5
+mov #-10, r1
+add r5, r0
+jsr L238
+L235: prn r2
+L236: red r0
+jmp X1
+lea X3, r5
+dec *r5
+red r4
+rts
+jsr L67
+jsr L237
+L237: red L131
+not *r3
+clr L171
+bne L183
+red *r7
+L238: rts
+stop
+L239: .data 680, 223, -491, -537, 573, -86, 823, 869
+jmp *r1
+not L263
+red r7
+prn *r2
+L240: .string "iin"
+jsr L12
+jmp *r3
+bne *r6
+L241: clr r1
+inc X21
+L242: .string "lraqpbcy"
+dec *r3
+stop
+L243: .string "hcfjksjjhgetdpjyvowomrl"
+inc X12
+L244: .string "bkyeybqanczohha"
+stop
+prn *r6
+jmp L257
+jsr *r4
+inc *r5
+L245: inc *r1
+L246: sub *r4, L217
+cmp *r0, r6
+stop
+add r0, L261
+lea L268, r5
+L247: jmp L233
+jsr *r3
+red *r3
+L248: bne X24
+stop
+lea L264, r0
+L249: .data -226, -171, -547, 274, -918, 534, 623
+jsr X11
+L250: mov *r1, r2
+red *r2
+not *r2
+rts
+clr X14
+jsr X9
+prn #-104
+rts
+jsr L152
+mov #-114, r0
+; comment
+stop
+jmp *r5
+red r3
+L251: inc *r3
+rts
+; comment
+cmp #97, *r0
+jsr *r6
+L252: inc *r1
+jmp *r6
+L253: clr *r2
+mov L270, r4
+L254: .string "egfdosluwtifygfxlnib"
+L255: stop
+bne *r3
+dec L6
+stop
+add *r5, X4
+dec L195
+cmp *r3, #-98
+add *r2, L153
+lea L23, *r4
+L256: jsr L70
+L257: .data 291, -704, 231, 38
+not r0
+cmp #-168, r5
+dec *r5
+not r5
+
+clr r3
+jmp *r7
+L258: .data 342, 137
+bne *r3
+L259: .data -612, 704, 367, 523, -968, -17, -897
+L260: red *r6
+mov X8, L180
+dec X7
+
+sub X24, *r1
+L261: rts
+prn X11
+not *r1
+lea L266, r0
+dec r4
+sub *r4, *r5
+jmp L273
+L262: .data 151, -727, 470, -962
+mov X9, *r3
+lea X16, L268
+L263: rts
+L264: .string "dgtehqdrsqoaow"
+L265: rts
+add r2, r3
+jmp *r0
+clr *r5
+bne *r5
+sub #31, r2
+not X10
+L266: jmp *r3
+; comment
+bne *r5
+lea X17, r0
+prn r3
+jsr *r3
+prn r4
+add *r0, r6
+cmp #83, r7
+lea X6, *r7
+not X19
+jmp *r0
+not *r7
+L267: rts
+; comment
+L268: red r3
+L269: prn X6
+rts
+sub #-75, L274
+inc *r5
+clr *r1
+inc *r6
+sub r4, r7
+; comment
+prn #16
+bne X3
+L270: sub *r7, *r5
+not r2
+clr r7
+L271: lea X0, r7
+
+lea X23, r2
+L272: .string "fjnggoysoa"
+
+stop
+lea X4, L63
+prn r7
+mov *r0, *r2
+L273: jsr *r0
+L274: clr *r1
+L275: prn r0
+L276: red *r3
+stop
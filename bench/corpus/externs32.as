@@ -0,0 +1,1044 @@
+; Generated by genCorpus --seed 33
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+prn X12
+rts
+jmp *r3
+prn X15
+lea X19, L100
+L0: .string "ltwinaqxymigzgq"
+bne X1
+stop
+cmp r6, r6
+cmp r5, X15
+mov #230, L0
+L1: sub #-175, L142
+dec r5
+clr *r6
+inc L88
+mov r0, L1
+not L68
+not *r2
+clr L185
+add #-64, r0
+
+jmp *r7
+jmp *r4
+prn X6
+L2: mov #161, X17
+dec *r1
+prn L0
+add *r2, *r0
+jsr *r2
+jmp *r0
+rts
+cmp r1, r3
+bne X19
+L3: jsr *r7
+L4: jsr *r3
+not L130
+red X3
+bne *r0
+
+jsr *r5
+clr X15
+L5: .data 681, 484, -389, -635, -144, -41, 810
+cmp *r2, X6
+mov X0, *r3
+jsr *r2
+
+L6: rts
+red X21
+sub r3, L1
+stop
+L7: stop
+dec L4
+
+L8: rts
+lea X6, r3
+prn *r1
+L9: lea X13, *r7
+dec *r0
+stop
+not *r5
+L10: jmp L1
+not *r3
+clr *r1
+cmp L229, *r3
+L11: jsr X10
+clr r1
+; comment
+
+dec r5
+add r0, r6
+jmp X1
+sub X3, X1
+L12: .data 608, 128, -90, -991, 139, -189, 229
+cmp #-212, r1
+rts
+cmp *r6, r7
+rts
+dec *r1
+L13: .string "mlauwjnzyhglevbvotehdw"
+L14: .data 737, 380
+jsr *r3
+; comment
+jsr *r7
+jsr *r1
+not r1
+L15: not X23
+L16: dec X14
+inc L9
+sub #-132, r7
+L17: prn *r2
+dec *r5
+bne L0
+add X17, L11
+red r6
+add r6, L4
+rts
+L18: sub *r1, L4
+L19: clr X6
+dec *r2
+L20: .string "hodpoindpvvxwunb"
+rts
+not L256
+L21: dec r1
+sub r0, *r0
+bne *r5
+clr r1
+add r2, r2
+L22: .string "u"
+jmp X7
+prn L15
+jsr *r1
+
+clr r3
+bne X3
+L23: not r0
+jsr *r1
+cmp r2, L13
+clr L0
+add *r4, *r3
+prn *r5
+bne L47
+L24: .data -796, 807, -320, 654, 633, -964, -169
+prn #15
+red *r7
+L25: .string "vziqaveef"
+red L256
+inc *r6
+prn r1
+L26: .string "ckqqqkccqud"
+jsr L231
+jmp X23
+sub X23, *r7
+prn r1
+rts
+lea L94, *r7
+L27: .data 185, 878, -844, -731, -401
+jmp L82
+red X15
+not L239
+mov L11, r5
+add #-122, r4
+prn #-154
+dec L41
+mov #34, L14
+red r7
+sub *r2, *r4
+inc L53
+not L142
+; comment
+add r1, *r3
+red L20
+L28: not *r0
+dec r0
+dec *r4
+mov L28, X22
+L29: .data 986, -79, 806, 579, -223, -824, -817, 976
+L30: .data -190, 960, -798
+L31: not L25
+jsr *r5
+inc *r3
+; comment
+cmp r1, *r2
+cmp r2, #-162
+lea X11, r5
+L32: .data 270, -616
+prn #221
+sub *r4, r7
+sub r3, r4
+L33: inc *r1
+lea L57, X10
+inc L14
+red *r0
+rts
+L34: .data -981, 853, 971, 819, 935, -718
+L35: lea X16, L9
+L36: stop
+L37: rts
+; comment
+rts
+L38: .string "cmbegcc"
+stop
+L39: cmp X8, #243
+
+L40: stop
+L41: jmp *r2
+L42: clr r0
+stop
+L43: mov #173, r0
+L44: stop
+rts
+L45: red r2
+stop
+L46: jmp L30
+L47: rts
+prn #-9
+L48: .string "aufnmyewkmof"
+cmp *r4, *r6
+L49: .data 548, -18, -878, 800, -900, -527, 379, -1
+L50: jmp *r6
+inc X21
+jmp *r7
+L51: lea L266, r7
+L52: jsr L14
+sub *r4, L17
+jsr X4
+mov r2, *r2
+L53: rts
+dec *r3
+sub #-20, *r4
+lea L246, L86
+
+L54: .data 457, -112
+lea X16, r3
+stop
+not r7
+jmp *r6
+not *r0
+stop
+jsr X0
+bne L15
+L55: .string "dxcws"
+jsr L192
+stop
+L56: bne L208
+L57: prn #111
+cmp L54, L234
+; comment
+add r5, r7
+lea L68, *r6
+prn #-108
+add L85, X11
+prn #156
+inc X3
+sub *r7, *r3
+jsr *r4
+bne *r1
+red r5
+jmp L52
+mov r5, *r5
+add r2, *r1
+add L40, r6
+lea X20, X3
+sub r1, *r0
+not L157
+not L144
+inc L56
+L58: .data 239, -489, -637, -910, -52, 725, 516, 521
+mov r1, *r1
+L59: .string "ranaz"
+cmp L22, *r7
+L60: .data -891
+mov L62, r0
+L61: clr *r1
+red *r5
+bne *r3
+L62: .string "zryqtyrhzseulux"
+L63: stop
+not *r4
+jsr *r7
+add *r7, r6
+stop
+mov #28, r0
+lea X17, X23
+inc *r3
+bne L28
+dec r2
+L64: .string "ghcgbkhikjak"
+L65: .data 94, 733, 776, -555
+mov L183, *r6
+L66: dec *r2
+inc L250
+lea L48, *r0
+rts
+clr *r4
+clr L108
+
+lea X4, L75
+prn *r0
+dec L10
+lea L203, r2
+L67: .data -355, -907, 365, -651, 916
+jsr *r2
+L68: .string "tieljt"
+stop
+red r6
+dec r0
+lea L26, r6
+L69: clr *r7
+red *r1
+jmp *r3
+inc r2
+L70: mov X19, X5
+mov r1, X19
+dec r5
+dec L92
+L71: dec *r0
+not r7
+cmp L40, #120
+mov #134, r0
+sub #245, r6
+mov r0, X19
+not *r5
+jsr *r3
+clr r3
+lea L161, L215
+bne *r0
+red r4
+L72: dec X18
+stop
+L73: jsr *r0
+L74: sub #-79, *r5
+not L229
+L75: clr r2
+mov *r5, X24
+stop
+L76: .data 364, -43
+bne *r3
+L77: .data -5, -733, 221, -389, -275, -909, -595
+L78: cmp r5, r4
+red L18
+; comment
+stop
+cmp #-245, #187
+bne *r7
+cmp *r5, *r1
+cmp *r0, #169
+jsr L198
+jsr *r4
+L79: bne L20
+stop
+rts
+not r2
+stop
+cmp #-111, #-39
+stop
+L80: lea X17, X11
+jsr *r5
+add *r1, *r0
+stop
+L81: add X16, L191
+stop
+; comment
+L82: cmp #-144, #-90
+inc X1
+jmp *r1
+cmp *r3, r1
+not *r0
+jmp *r3
+red r7
+L83: jsr *r6
+jsr L8
+
+clr *r6
+mov L66, r4
+L84: sub *r2, r6
+L85: red r5
+jmp *r7
+L86: not r6
+jmp *r6
+prn r4
+prn r5
+L87: mov X14, *r1
+L88: dec L206
+cmp r1, #174
+L89: .data 883, 253, 370
+sub #247, L6
+rts
+L90: .data -274
+L91: rts
+clr L143
+prn *r5
+rts
+red X20
+sub #-196, *r6
+sub r5, L191
+L92: inc *r4
+L93: .data -134, 307, -669
+bne L188
+dec X13
+L94: .string "safxdacruftpdyotzgbkq"
+lea L58, *r6
+L95: .string "lmxgetfkecrn"
+L96: mov L70, r6
+bne L218
+rts
+L97: jsr *r7
+mov *r2, r4
+bne L12
+jmp *r5
+jmp L58
+bne *r0
+stop
+L98: .string "pwyjirllmyorasxnkxmw"
+add L108, *r3
+clr r3
+cmp *r6, L177
+L99: jsr L61
+dec *r6
+not r3
+clr *r2
+L100: jsr X6
+jsr L255
+cmp *r7, r2
+lea X11, *r2
+prn X22
+L101: stop
+red r2
+L102: .string "g"
+; comment
+lea X11, *r1
+rts
+L103: stop
+L104: .data -291, -872, 302
+bne L109
+rts
+red X11
+sub #167, *r5
+L105: prn r6
+bne *r0
+L106: .string "lgzcicpbhrina"
+L107: inc X12
+red L108
+dec X18
+prn r0
+L108: prn #-209
+L109: jsr X0
+rts
+inc *r1
+L110: cmp X10, r1
+L111: dec *r7
+stop
+cmp *r0, #-191
+red X3
+L112: jsr *r1
+sub r3, X8
+L113: mov L138, *r2
+dec r3
+not X20
+inc *r5
+; comment
+L114: clr L249
+clr r6
+L115: .data 376, -368, 792, -296, -945, -53, 441
+L116: cmp r0, #-231
+L117: prn r7
+jsr L45
+rts
+clr X1
+lea L116, X15
+L118: .string "rnogkwbdqabudjmkev"
+L119: add *r5, *r2
+L120: .string "zheyglagoru"
+mov #-74, L98
+clr L25
+jmp X5
+rts
+sub L125, r6
+bne L63
+L121: prn #91
+bne *r4
+red *r2
+mov *r4, *r1
+sub *r5, r3
+L122: jmp *r6
+L123: .data -402, -112, 910, 584, 524, 188, 220, 715
+stop
+inc *r6
+rts
+jmp *r1
+jmp X13
+mov *r0, L60
+L124: lea X9, X6
+inc X20
+inc r6
+prn r1
+jsr L222
+mov X12, r1
+jsr *r3
+inc *r5
+not X4
+sub r6, X23
+L125: jmp *r5
+lea L0, r6
+L126: .data -264, -570, 332, -878, -643, -860, -789, 759
+cmp r2, r3
+inc r1
+L127: .string "oriqkzghflblxn"
+jmp *r1
+rts
+jsr *r5
+
+L128: rts
+L129: bne *r3
+; comment
+L130: clr r1
+L131: red r4
+; comment
+L132: cmp r2, L205
+lea L211, *r4
+stop
+L133: rts
+mov #14, r3
+cmp L24, L167
+; comment
+L134: jsr *r4
+L135: clr r7
+L136: clr r0
+dec L265
+dec X12
+bne *r3
+lea L263, *r1
+mov r4, r5
+stop
+not *r3
+jmp *r1
+bne *r1
+clr r3
+L137: .string "syfkqlpwwmwyankzdmzre"
+jsr L211
+L138: clr r1
+clr *r3
+cmp X16, r4
+L139: jmp X11
+L140: .data 330, -253, 717, -471, 578, 391, -309, 822
+L141: jsr *r3
+jmp L132
+L142: .string "us"
+; comment
+L143: .data -318, -561, 891, -739, -774, -990, -95
+stop
+L144: red X0
+L145: .data -515, -731, 295, -777, 881, -821, 909
+L146: jsr L169
+not X16
+mov r0, *r2
+
+stop
+L147: jsr L116
+L148: prn #229
+dec L101
+inc r4
+jsr X11
+L149: red *r0
+not X12
+dec L223
+L150: prn #194
+mov *r4, *r2
+L151: prn X13
+L152: mov L227, r0
+inc r5
+jmp X15
+L153: jsr L245
+cmp r7, L159
+clr X0
+add #-138, *r1
+stop
+bne L56
+jmp L142
+red r6
+prn X17
+not r7
+inc *r6
+clr *r7
+lea X18, X5
+L154: prn r4
+clr X17
+sub L180, L217
+L155: mov r7, L165
+stop
+lea L167, L149
+L156: .string "mdzqcmejwid"
+L157: .string "rtdqyrow"
+dec L27
+L158: .data -190, -615, -967
+clr r7
+clr L220
+L159: stop
+stop
+dec r3
+red L107
+mov r4, *r7
+L160: sub X12, X16
+lea L44, X20
+inc r1
+clr X4
+L161: .data -147, -733, -214, 289, 66
+jmp *r0
+jmp X5
+L162: mov X2, r7
+rts
+mov #93, r1
+dec X24
+sub #88, *r7
+cmp r4, #34
+jsr *r7
+L163: rts
+cmp #93, r4
+clr X5
+not L180
+lea L93, L56
+not *r7
+L164: cmp r3, *r1
+cmp *r0, #167
+clr r1
+L165: mov r3, *r2
+L166: add *r6, L92
+dec *r2
+sub X4, *r6
+L167: inc r5
+add r6, L218
+L168: .data 492, 685, -636, 272
+stop
+clr X4
+L169: stop
+jmp *r7
+mov #-135, *r5
+dec *r5
+rts
+jsr *r6
+rts
+L170: rts
+jsr *r3
+red *r1
+dec r4
+dec *r2
+L171: add r7, r0
+bne X24
+L172: dec r1
+sub r6, *r6
+lea L210, *r4
+red L135
+
+L173: not r6
+sub r6, L197
+prn *r7
+L174: not r3
+L175: add #-78, *r0
+jsr X14
+prn r2
+; comment
+red L146
+jmp *r0
+inc *r3
+L176: .data -188, -760, 932
+not *r4
+jsr *r2
+bne L196
+red r2
+
+clr r2
+dec r0
+L177: stop
+prn r3
+L178: rts
+sub *r3, r0
+
+clr L254
+L179: .data -984, 69, 101
+L180: inc L112
+prn #-134
+red X9
+clr r6
+red r0
+clr X8
+L181: rts
+jmp *r3
+L182: .data 857, -514, 39, 59, -225, -780, 431
+add #-90, *r2
+mov L97, r0
+; comment
+clr *r4
+sub #86, r5
+not X13
+add *r5, X6
+rts
+stop
+lea L140, L249
+not *r7
+stop
+L183: .string "sdvrazgbffjvbw"
+bne *r7
+L184: add #-174, r6
+L185: not X4
+L186: mov #-153, X4
+sub #-48, *r4
+lea L86, r5
+lea L113, r7
+L187: clr X15
+bne *r4
+clr L13
+sub #120, L244
+inc r1
+jsr X3
+not *r3
+cmp *r0, r4
+L188: lea L45, r5
+stop
+lea X13, r5
+L189: inc r2
+clr *r5
+L190: clr X5
+L191: rts
+rts
+L192: .data 446, 686, 811, 555, 133, 480
+rts
+red *r7
+L193: clr X12
+stop
+prn r4
+inc X23
+dec *r4
+prn #250
+sub *r7, r7
+L194: dec *r0
+add r7, *r3
+lea L192, *r7
+L195: .data -626, 966, 34, 664, 726, -534, -333, 468
+bne X14
+add r0, r2
+L196: .data -915, 528, -978
+jsr *r0
+dec X15
+jsr X1
+stop
+add r7, r1
+L197: not *r6
+clr r2
+red *r5
+L198: .string "fa"
+L199: rts
+sub L228, r3
+inc L70
+L200: red *r7
+add *r4, *r7
+clr L233
+red r1
+jsr X23
+red r7
+rts
+L201: .data 458, -797
+bne L128
+inc *r7
+lea X19, *r4
+not r2
+bne L190
+L202: .data -426, 472, -597
+L203: add *r2, *r1
+add *r3, X16
+prn #87
+jsr *r1
+lea L51, *r4
+L204: inc r5
+red r6
+jmp *r1
+cmp *r2, X12
+mov #-37, L128
+L205: not X18
+L206: dec r0
+mov *r3, *r4
+mov X8, *r6
+not X15
+bne X10
+L207: add L29, L106
+not X1
+L208: bne X21
+clr *r3
+L209: not *r6
+L210: bne *r6
+rts
+L211: cmp #180, *r1
+rts
+stop
+dec L236
+prn *r0
+bne *r5
+L212: .data 492, -32, 553
+red r2
+add r2, *r5
+add #70, L106
+lea L183, L209
+L213: inc *r2
+mov L193, r2
+sub #-151, L53
+rts
+jsr *r7
+inc *r5
+stop
+jmp L103
+bne *r5
+inc X14
+L214: jmp L38
+stop
+bne X11
+rts
+clr *r7
+red L231
+sub r5, L261
+dec X6
+jmp *r7
+clr r3
+jsr *r3
+cmp r5, *r4
+cmp L70, #63
+cmp X24, r4
+jsr X0
+cmp #-242, *r2
+stop
+not X17
+dec r6
+prn r2
+L215: .data -135, -990, -61, -315, 916, -602
+mov r6, r2
+
+stop
+L216: stop
+; comment
+cmp r7, X14
+add #-10, L237
+L217: add #-141, L241
+stop
+inc *r2
+rts
+L218: .string "jvfc"
+L219: lea L220, L237
+L220: dec *r3
+mov r6, L257
+bne X14
+cmp r3, #80
+L221: .string "n"
+jmp *r1
+inc *r4
+stop
+L222: .data -482, -446, -325, -149, -133, -781, 634, 732
+sub #-18, r4
+inc L95
+L223: red X4
+L224: not *r5
+
+stop
+L225: jsr L134
+not *r1
+bne L136
+rts
+stop
+L226: cmp #-115, #-186
+not r3
+sub #195, *r2
+lea L240, *r6
+
+mov L53, r5
+L227: prn L236
+sub X8, L114
+clr L38
+rts
+L228: .data 568, 129, 154
+L229: .data 215, -315, -804, -67, -366, 582, 538, 458
+add *r2, *r6
+red *r5
+jmp L170
+jsr *r3
+red L226
+
+red *r6
+rts
+L230: .string "nsvebhwydbh"
+jsr *r1
+add #-41, *r2
+cmp #-167, #-121
+sub *r7, r0
+red X0
+rts
+sub X0, *r5
+add *r3, r0
+jsr *r5
+dec L211
+jmp *r5
+jsr *r2
+L231: inc r4
+L232: .string "nbtjcfrcjia"
+sub r6, X15
+jsr X1
+L233: red r3
+inc r1
+inc *r3
+inc r1
+sub *r6, L256
+jmp X9
+jsr *r0
+clr *r4
+inc r5
+stop
+red L81
+red r0
+L234: sub X1, r7
+L235: jmp *r0
+cmp *r7, r4
+L236: cmp r6, *r3
+L237: .string "skefpved"
+cmp #198, L231
+L238: .data 375, 891, -587, -361, -284, -751
+rts
+cmp L258, r6
+cmp #149, X20
+inc *r1
+prn #59
+jsr *r6
+clr *r4
+L239: jsr L75
+; comment
+not L263
+not r2
+red *r7
+stop
+L240: inc *r4
+lea L140, r0
+not X11
+mov #225, *r5
+cmp X2, #-178
+stop
+L241: .data -126, 871, 264, -432, -667, 602, -628, 627
+L242: dec r1
+L243: jmp L209
+L244: dec *r4
+; comment
+lea L255, X12
+stop
+L245: add *r3, X7
+cmp L266, *r3
+
+mov L116, r3
+L246: rts
+prn L256
+not r6
+add *r0, r5
+add r6, *r7
+rts
+L247: .data -428, -409, -243, 72, -672, 778, 822
+L248: stop
+cmp r1, r7
+L249: .string "gpscasnpwsizqgbnn"
+not r0
+mov *r3, r6
+rts
+L250: .string "rckkzr"
+not r6
+mov *r1, *r2
+red X4
+L251: .data -597, -112, 68, -790, 332, -980, -374, -818
+L252: mov r1, L255
+rts
+L253: stop
+stop
+L254: sub r3, r0
+rts
+L255: add r6, r0
+lea L261, *r7
+clr r2
+dec *r2
+prn r4
+lea X22, X12
+dec *r0
+not X6
+red *r6
+sub L55, *r5
+stop
+red *r1
+L256: lea L260, L24
+jmp L161
+add #-54, X11
+not L19
+red r5
+dec r6
+mov L263, r4
+L257: rts
+L258: prn #-88
+cmp #-194, #29
+inc r5
+jmp L17
+cmp #-90, X23
+add L260, *r5
+L259: mov X9, *r0
+jsr *r6
+L260: jsr *r1
+add #-9, X7
+bne L265
+L261: sub #197, r5
+prn *r1
+L262: bne L265
+L263: cmp *r3, L264
+L264: .data -468, -387, 570
+L265: not L98
+inc r6
+cmp *r4, *r0
+jsr L117
+mov r0, *r1
+stop
+L266: .string "kdvubcdouwlmpuu"
+add L267, *r4
+dec *r6
+L267: rts
+stop
@@ -0,0 +1,1044 @@
+; Generated by genCorpus --seed 34
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+sub *r0, L142
+
+L0: jsr X16
+lea L0, r2
+red *r1
+bne *r5
+L1: .string "uk"
+clr L0
+rts
+jmp X9
+L2: .data 950, -358
+; comment
+clr *r7
+L3: .string "nsvfrxslwqa"
+L4: .string "aoqvst"
+jsr *r4
+L5: .data 129, 809, -565, 62, 760, -415
+jsr *r0
+red L1
+not *r0
+bne *r6
+sub r2, *r5
+sub r2, *r3
+rts
+jmp *r1
+L6: .string "rgoeofnybmi"
+L7: .data 511, -191, 957, 638, 592
+L8: bne L233
+prn X12
+lea L4, X8
+red *r3
+jmp L8
+lea X2, *r6
+L9: inc X8
+rts
+red *r7
+L10: sub #-246, X10
+mov L0, *r1
+not r2
+; comment
+sub #99, L256
+L11: inc r1
+bne *r4
+jsr L8
+L12: inc *r1
+L13: .data 541, -689, -284, 864, -474, -971, 746, 610
+dec r6
+prn *r0
+L14: jmp L3
+L15: .string "woytblipzkh"
+clr *r6
+clr *r2
+inc X15
+add X4, r7
+L16: lea L14, X17
+add r6, *r4
+red *r7
+prn r6
+L17: jsr L147
+L18: .string "kvikudmqjcrxva"
+L19: clr r6
+bne L233
+clr L110
+not X6
+L20: sub L227, X11
+red L15
+L21: sub r7, r5
+L22: bne L15
+not L170
+jsr *r0
+jmp L114
+L23: inc r5
+not X23
+lea L17, r0
+add r2, *r7
+prn *r5
+dec *r7
+mov *r2, *r1
+
+inc r6
+prn r4
+red *r1
+L24: .string "pgdcsjepuikfxqez"
+not r3
+clr r2
+cmp r0, #-42
+L25: stop
+add L15, L16
+add r3, r5
+rts
+clr L24
+cmp r6, r0
+sub r0, r2
+L26: .string "mgpni"
+sub *r6, *r3
+L27: .string "hmrpfmiz"
+jmp *r5
+bne L25
+inc *r3
+not *r0
+bne X9
+clr r7
+jmp *r2
+bne *r5
+L28: .string "wycvl"
+L29: .data 578, -857, 50
+L30: .string "gesbbmmmeazkbwl"
+stop
+add #-95, *r7
+cmp r5, X9
+L31: .data -3, -501, 648, -856, 239, 947, 842
+L32: .data -943, 62, -197
+cmp *r7, r0
+dec *r2
+inc *r3
+bne L2
+rts
+sub X7, r0
+prn *r6
+lea X18, r2
+L33: rts
+bne X0
+mov r5, *r0
+not L103
+bne X11
+rts
+L34: rts
+red *r5
+stop
+L35: inc L3
+dec L59
+prn #-186
+L36: cmp r1, #-100
+dec r2
+cmp *r5, *r7
+L37: jsr L79
+mov r2, L201
+add *r1, *r2
+clr r7
+dec r7
+not r7
+dec X12
+not r0
+mov *r7, r2
+rts
+stop
+cmp L163, X12
+bne *r7
+
+stop
+sub #130, L34
+L38: .data -635, 369, -92, -570, -327, -268
+jmp *r3
+L39: .data 523, 42
+; comment
+stop
+; comment
+L40: lea L133, X9
+sub #-67, L4
+add *r3, r1
+not *r5
+L41: .data -826, -313, 283
+L42: .string "iatrwcopmwmk"
+jmp X21
+clr X20
+cmp #203, #-238
+bne *r7
+jsr *r3
+L43: sub r2, r0
+L44: stop
+L45: .data -766
+L46: sub *r7, X15
+prn #-156
+prn L19
+inc r5
+mov #-148, X23
+L47: .string "myibeqefofebyinuiibixlta"
+L48: .data -660, -42, -814, 861, 831
+L49: .string "laihsm"
+red r2
+L50: .data 74, -382, 543, -712, 654, 226, -843, 532
+bne *r3
+prn #-48
+bne *r0
+L51: .string "joncxid"
+L52: lea L88, r1
+L53: not L197
+stop
+dec r1
+L54: .data 726, 518, 349
+sub *r4, L140
+add #255, *r1
+cmp *r3, *r2
+L55: .string "rsy"
+prn #176
+L56: jsr *r6
+bne *r6
+not r4
+L57: sub #228, *r3
+prn r5
+not r6
+L58: sub #115, r4
+L59: .data 65, -877, -505, -314, 191, -84, 16
+dec *r1
+add *r5, L41
+not X14
+L60: lea L267, L37
+jsr *r1
+stop
+jsr *r6
+L61: bne *r0
+inc r7
+red *r6
+L62: sub #62, L125
+mov *r6, *r7
+sub L203, r5
+mov X22, *r0
+prn #8
+lea L174, r0
+inc L61
+red r3
+add X23, r4
+dec X24
+L63: .data 205, 636, -625, -809, -439, 183
+cmp #203, *r1
+L64: lea X19, *r5
+clr *r0
+not r4
+red X5
+stop
+jsr *r5
+jsr *r2
+sub X23, X6
+L65: .string "zwozgh"
+clr L124
+
+sub X18, L120
+prn L64
+inc r5
+lea L226, *r1
+sub r1, *r2
+L66: .data 415, 751, 366, 42, -400, 177
+stop
+clr *r3
+bne *r4
+cmp r6, r5
+L67: .string "cuxcvaeougx"
+stop
+L68: rts
+cmp #69, *r1
+dec r7
+bne L153
+add *r5, *r4
+lea L232, *r4
+jsr *r5
+not *r7
+L69: .string "rxl"
+dec *r0
+jmp L11
+bne X11
+L70: not *r7
+L71: sub #153, L225
+lea X7, L251
+jmp *r1
+; comment
+sub r5, L9
+stop
+L72: rts
+L73: cmp L31, #205
+stop
+inc L208
+cmp L186, X8
+inc L18
+jsr X20
+inc *r1
+rts
+L74: mov L51, *r0
+clr *r5
+L75: inc *r3
+L76: sub X11, X11
+jsr *r4
+L77: .string "ug"
+L78: inc r0
+lea L231, X19
+mov #183, r2
+mov *r3, X24
+L79: stop
+L80: sub r5, *r7
+L81: .string "mpmabeadbasvtiqhhpzdrms"
+L82: clr r3
+sub #150, *r6
+lea L142, r5
+inc X5
+clr X4
+rts
+prn X11
+L83: .string "difihtxkglatue"
+
+L84: bne *r3
+bne *r5
+mov r4, r2
+L85: lea L159, r7
+dec *r0
+L86: jsr L138
+L87: .data 151
+mov #-44, X9
+prn #188
+jmp L230
+red r3
+
+L88: .string "vzgcfryithokm"
+red r3
+inc r1
+cmp #8, X4
+L89: jmp *r5
+lea L128, r4
+clr L154
+prn X11
+L90: add r3, r5
+cmp X5, #-73
+L91: .data 580, 596, -186, 334, -46
+L92: bne *r7
+clr *r5
+jsr *r2
+inc *r5
+inc r0
+stop
+stop
+bne *r1
+red r7
+clr r4
+rts
+prn *r7
+L93: .data -960, 944, 107, -161, 881, 20, -499
+bne *r0
+prn #-86
+L94: jsr *r4
+add r6, X19
+cmp #27, #82
+L95: clr X2
+inc L65
+; comment
+L96: rts
+L97: .string "aeijtympxqqz"
+L98: .string "ycwc"
+L99: clr r5
+; comment
+add #223, *r3
+mov *r6, L76
+prn r6
+add X12, r5
+jsr X11
+L100: stop
+prn *r2
+red *r6
+inc L29
+; comment
+clr L267
+not r1
+lea L34, L31
+rts
+bne L156
+jmp *r0
+L101: .string "yonsfgslkmpetkvfhhqkem"
+L102: .data -538, 982, 368, 185, -659, 773, 864
+bne *r7
+dec r5
+dec r5
+L103: .string "nirjuazjnpsah"
+jmp L115
+stop
+cmp #-217, L90
+cmp X2, *r5
+clr r3
+L104: clr r7
+L105: stop
+
+L106: bne X24
+lea L58, X11
+prn #-151
+L107: rts
+L108: .string "atkivegakyiggd"
+L109: red X18
+L110: mov *r6, r4
+add #24, *r6
+stop
+inc r6
+mov r3, *r2
+mov #-238, *r2
+stop
+red X9
+mov X23, *r1
+red r2
+rts
+red r5
+lea L121, L110
+; comment
+L111: stop
+cmp #-238, *r5
+L112: not r4
+dec X12
+L113: jsr *r3
+rts
+L114: .string "phvlopkwep"
+L115: lea L109, L103
+L116: .string "mhhknbbfrlnlkxvwquvuuyly"
+L117: sub X13, r7
+mov #160, X16
+stop
+inc r0
+L118: .data -444, -356, -814, -371, 895, 174
+stop
+cmp L173, *r1
+prn X14
+inc *r7
+lea L105, *r2
+mov *r0, *r5
+jmp L92
+add *r3, r6
+jmp L166
+L119: .string "smejowupotcmflogteseusfm"
+L120: stop
+L121: clr X17
+L122: .string "rppodmxhrrqsvh"
+stop
+jmp *r6
+clr *r1
+sub r5, X2
+bne *r1
+dec X23
+lea X16, r2
+not r4
+rts
+lea X23, *r5
+rts
+jsr L162
+sub #-239, X11
+mov r3, L31
+rts
+jmp L91
+
+; comment
+L123: stop
+jmp *r6
+L124: not r4
+not *r4
+prn *r4
+L125: clr *r2
+prn r4
+bne *r2
+cmp r6, r5
+dec r6
+L126: add r4, L126
+not X10
+L127: bne X12
+L128: .data -572, 979, -611, -351, -393, -991, -52
+
+clr L140
+clr *r0
+inc *r0
+add *r1, *r5
+bne *r0
+L129: cmp #-126, L239
+L130: .data -666, -491, -110, 883, 58, -89, 583
+inc L2
+clr r4
+L131: not *r2
+stop
+rts
+stop
+prn *r3
+mov X11, r1
+sub #9, L254
+clr L265
+L132: jmp L55
+mov r5, r4
+bne *r3
+L133: rts
+not L158
+clr L85
+prn r7
+bne X6
+lea L133, X23
+red r0
+clr L234
+L134: .string "ebojnqexlwhkhcztqayledcc"
+jsr *r3
+jmp *r0
+dec *r0
+prn L45
+clr r6
+cmp #-253, #50
+stop
+; comment
+cmp *r1, X23
+sub #-11, *r0
+prn *r1
+L135: prn X6
+L136: lea L238, r0
+add #14, X1
+add *r5, r1
+L137: jmp X12
+not r6
+red L0
+clr *r6
+L138: rts
+add r1, *r4
+not L266
+clr r7
+not r3
+clr r1
+L139: .string "nmrjmjnlglxjbjajdfhtm"
+clr *r7
+inc X16
+L140: dec *r0
+L141: dec *r2
+add L239, r3
+L142: cmp *r7, X8
+jsr *r0
+add #-132, X16
+prn X17
+add *r0, L51
+lea L101, r2
+sub r6, X1
+L143: red *r7
+sub #-61, r3
+add X15, *r4
+dec *r5
+L144: .string "mqhskpbfdbfio"
+red r5
+cmp r0, *r0
+red L166
+; comment
+sub X10, L205
+prn *r2
+inc *r7
+clr *r4
+clr *r6
+bne *r5
+L145: dec r4
+jmp *r2
+jmp *r4
+clr *r3
+L146: sub #147, *r6
+dec *r5
+rts
+L147: jsr L93
+sub r1, r0
+inc *r4
+L148: prn r7
+bne X8
+not L185
+L149: clr *r6
+sub r0, r7
+L150: .string "tqphfoakkusbk"
+L151: cmp r0, #107
+mov #125, L181
+; comment
+not *r1
+sub #226, r7
+cmp L28, r6
+L152: stop
+L153: inc r5
+sub r6, *r1
+add X10, *r6
+L154: .data -803, -847, -49, -865, -21, 939, 691
+cmp r4, r4
+red X18
+lea X9, X20
+clr *r7
+L155: .string "lvjwwmcmysp"
+L156: jmp X20
+inc r2
+jmp *r6
+sub r1, *r5
+mov *r4, X9
+L157: stop
+
+L158: cmp *r0, L154
+jsr X7
+L159: mov *r0, r4
+not r3
+L160: dec *r7
+jsr *r6
+bne *r5
+L161: mov r6, *r4
+mov L3, r1
+rts
+not *r2
+jsr *r2
+prn #-121
+not r1
+add L195, *r1
+L162: inc L218
+inc r5
+cmp X23, #-238
+jsr L4
+clr *r0
+L163: .string "ypq"
+L164: .data 695, 8, 70, -445, -627, -792, 287, 46
+inc L247
+prn #201
+jsr X4
+jsr *r4
+sub X24, *r2
+L165: jmp L185
+sub #116, r4
+bne L13
+red *r4
+cmp L180, r2
+prn #-88
+mov L237, *r7
+stop
+sub r2, *r2
+clr r0
+add X19, r2
+clr r7
+sub X3, r1
+bne *r4
+L166: mov *r6, *r0
+rts
+prn #-80
+L167: bne *r3
+bne *r1
+jsr X23
+cmp r4, *r3
+jmp X8
+not r3
+jmp *r3
+not L6
+not *r3
+L168: sub L195, X12
+rts
+not r1
+
+L169: .data -20, -843
+dec L259
+L170: inc r6
+cmp L32, *r1
+L171: clr *r4
+inc r5
+inc r6
+rts
+L172: .data -463, 74, -850, 466, 928
+jmp L119
+L173: .string "rscjcjzqhatvitkujz"
+prn *r6
+L174: .data 825, 33
+L175: rts
+jsr L130
+dec r3
+; comment
+red r6
+bne *r1
+cmp L262, #-11
+L176: jmp L56
+L177: prn #128
+bne X11
+jsr L52
+dec X21
+not *r7
+bne X20
+jmp *r6
+clr r6
+inc *r5
+L178: not *r5
+L179: prn #29
+not X12
+L180: lea L203, *r2
+not L261
+jmp X11
+sub X0, X22
+L181: .string "dhnvlbqhuvhqgfqq"
+dec X8
+lea X16, *r6
+bne *r2
+not L61
+clr L216
+L182: jmp *r6
+add *r4, *r1
+inc *r6
+L183: rts
+sub #-3, r0
+cmp L217, r2
+L184: bne L241
+L185: .data -304, -103
+lea L209, r1
+jmp *r4
+inc r3
+L186: .data -770, 808, 862
+not *r5
+clr X2
+L187: not *r0
+jsr L216
+jmp *r3
+bne *r1
+L188: clr L10
+clr r1
+
+cmp r0, r3
+sub #-4, L265
+rts
+not X19
+lea X9, r7
+bne L198
+add *r7, r6
+rts
+; comment
+cmp L112, r1
+not *r5
+L189: inc *r1
+jmp X1
+L190: .data 512, 505, -631, 843
+rts
+add #37, *r5
+add #94, L260
+bne L151
+L191: dec L16
+jmp *r0
+L192: .data -895, -833, 198, 632, 79
+L193: lea L41, *r0
+red *r6
+lea X7, r3
+stop
+jmp *r2
+L194: mov r3, X23
+dec L271
+L195: clr r6
+lea L214, X9
+sub #113, L214
+rts
+jsr L271
+L196: add X12, *r2
+L197: add *r2, *r2
+bne L123
+L198: prn *r1
+clr r4
+jsr *r5
+; comment
+sub L218, *r0
+; comment
+L199: .data -541, 82
+not X9
+prn L202
+L200: lea X2, L216
+L201: .data -25, 799, 655, -401, 775, 855
+L202: add *r3, X2
+L203: cmp X10, r0
+L204: dec *r0
+stop
+L205: jsr *r5
+add X5, r7
+mov #32, r0
+red X18
+stop
+L206: .string "qvcewfftknytvmljxavl"
+sub #-44, L271
+red r4
+L207: .data -441, 325, 361, -977, -547, 233, 443, 164
+L208: rts
+not r5
+red X4
+jsr *r4
+not r2
+L209: lea L217, L238
+rts
+clr *r2
+inc L234
+L210: .data 669, -759, -448, -245
+red X0
+L211: clr X16
+lea X23, L269
+inc r5
+L212: jmp L131
+L213: .string "vilsqomckmnmibqoh"
+inc L219
+jsr X8
+not L144
+red *r4
+L214: prn #-132
+jsr *r1
+bne L261
+dec L257
+prn L78
+jsr *r3
+jsr X9
+prn r5
+rts
+L215: not r1
+L216: .data 643, -565, 604, -66, 541, -808
+jsr L263
+bne *r5
+jsr X0
+bne L265
+jsr L10
+cmp L85, r7
+inc *r1
+bne *r1
+not X12
+rts
+jsr X16
+L217: dec X9
+L218: dec *r3
+add X0, r0
+mov #-183, *r2
+L219: .data -405, 14, 455, 285, 817, -123, 848
+L220: .data 262, 450, -617, 194, 764, 274, 658, -239
+add r5, r2
+jsr L15
+; comment
+dec *r4
+inc L135
+stop
+inc *r1
+clr *r7
+red X4
+L221: .data -6
+lea L185, *r5
+red r3
+not X19
+L222: cmp *r6, L232
+L223: cmp L179, X1
+L224: jsr *r7
+; comment
+; comment
+bne L237
+dec X11
+rts
+prn r7
+L225: .data 627, -451, 368, 403, 453, 978, 868
+prn r0
+sub *r6, r1
+
+L226: bne L30
+lea X23, r6
+dec r7
+jmp L57
+mov #-240, r0
+sub *r5, L204
+red X10
+rts
+not r7
+L227: .string "metnsihpgxcweeq"
+L228: .data 991, -563, 94, 826, -711, 379
+L229: rts
+jsr L242
+L230: .string "hgyj"
+L231: .data -13, 136, -457, -471, -348
+prn r1
+clr r5
+stop
+not *r4
+sub #140, L269
+cmp *r2, #-228
+L232: lea X18, r2
+L233: jmp L113
+lea X23, X12
+inc *r0
+L234: red *r1
+L235: inc r3
+L236: clr L269
+L237: red X2
+jsr L255
+clr *r1
+lea L266, r3
+jmp *r5
+L238: jsr *r6
+dec L253
+L239: mov L265, r5
+mov *r1, *r5
+jmp *r0
+inc L249
+add r1, *r1
+jsr X0
+dec *r7
+lea X16, X7
+clr *r5
+rts
+
+L240: inc L265
+L241: not *r3
+mov #-135, L196
+; comment
+dec *r5
+clr L269
+mov X16, X2
+stop
+mov r7, r2
+add r4, L248
+cmp r3, #-234
+L242: cmp r0, r4
+L243: .data 173, 833, -709, -385, 216, 533
+L244: bne *r4
+prn *r6
+L245: .data 676, 488, 555, 797, 117, 52
+L246: .string "peg"
+stop
+prn r6
+add *r0, L133
+lea L248, X9
+L247: .data -750, 854, -481, 741
+clr *r7
+rts
+prn *r6
+L248: .string "rkgx"
+stop
+inc r1
+red *r7
+L249: inc r1
+mov *r5, r3
+red *r0
+bne X11
+L250: .string "b"
+dec r5
+clr *r4
+sub r6, X4
+L251: dec *r0
+jsr L58
+lea X6, r7
+rts
+L252: dec L258
+L253: .data -459, -994
+
+clr L260
+L254: .data 869, -563, 675, 52, 172, 851
+clr r4
+bne *r4
+L255: jsr *r6
+add L159, L65
+L256: .string "rabvmqobit"
+L257: dec r6
+dec *r1
+L258: .string "lomzgcryv"
+
+not X15
+L259: cmp #116, r3
+prn *r4
+clr L161
+not r3
+inc L263
+clr *r0
+prn r1
+add r4, r6
+red X19
+red *r6
+not X16
+lea L148, r0
+not *r6
+L260: .string "fpocusd"
+; comment
+lea X6, L242
+red X6
+inc *r7
+L261: .data 579, 719, -867, -763, 225, -34, -787
+inc L210
+inc r2
+jmp L125
+stop
+jsr *r0
+cmp #154, *r5
+inc r6
+dec X9
+cmp #36, r6
+lea X7, *r0
+stop
+L262: rts
+L263: prn X4
+mov L271, L34
+inc r0
+L264: stop
+L265: .string "cm"
+L266: lea X11, L267
+red r5
+rts
+; comment
+L267: sub r7, *r5
+add r6, r7
+mov X24, L271
+jmp *r0
+L268: inc *r5
+sub X24, X12
+red r1
+L269: prn X14
+
+red r3
+not *r2
+; comment
+mov *r0, L271
+jmp L200
+not *r5
+red *r5
+not *r0
+prn r5
+L270: .string "rzurgkxrbcdawe"
+add r7, r3
+; comment
+lea X8, L19
+jsr *r1
+cmp r6, r1
+L271: cmp r7, *r1
+stop
@@ -0,0 +1,1045 @@
+; Generated by genCorpus --seed 35
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+L0: mov r0, L0
+L1: .data 246, 540, -759, -352
+cmp r6, #-36
+not L132
+L2: .string "ayvydirbbl"
+dec X15
+jsr L0
+mov X3, *r4
+L3: bne *r1
+inc *r7
+mov L16, L218
+sub #249, r4
+inc L80
+lea L2, X11
+dec r2
+L4: lea L95, r6
+sub *r4, X12
+clr r3
+mov *r3, r0
+clr r2
+mov *r2, *r4
+dec *r3
+L5: rts
+cmp X8, *r7
+add *r4, L70
+L6: rts
+clr *r6
+L7: not L4
+red r5
+rts
+rts
+sub r7, r3
+rts
+cmp #202, #139
+dec *r0
+inc *r2
+not L187
+L8: .data -487, -48, 260, 932, -773
+L9: cmp r1, X17
+inc *r3
+cmp #-86, X17
+
+add r7, r0
+; comment
+dec L2
+not L140
+L10: not *r3
+prn L8
+L11: dec X4
+L12: clr r1
+bne *r7
+rts
+L13: sub r4, r5
+L14: sub #104, L226
+add r4, X23
+; comment
+add X11, *r4
+; comment
+; comment
+
+lea L178, X10
+add #-116, r4
+
+stop
+jmp *r3
+dec L151
+rts
+cmp r0, r3
+dec L5
+red r2
+bne L1
+stop
+L15: clr X18
+add L12, L126
+not *r2
+L16: .data 99
+L17: stop
+L18: not r3
+bne L0
+mov r5, r2
+L19: sub r5, *r3
+L20: .string "j"
+
+prn #-146
+clr X4
+dec *r3
+L21: jmp L4
+L22: stop
+add *r4, X14
+dec X16
+jsr L228
+jsr X9
+jsr X6
+mov L1, X16
+add *r3, r0
+prn L198
+sub #106, L84
+jmp *r4
+add *r0, r6
+sub *r7, *r1
+L23: inc r6
+; comment
+add #-139, L19
+jmp *r7
+sub #170, *r5
+rts
+L24: jsr X19
+stop
+lea X20, L7
+L25: jmp X0
+
+rts
+L26: rts
+jsr *r6
+L27: .data 601, 944, 337, 651, 533, 523, -534
+mov #-217, *r4
+clr r4
+L28: .data 27, 27, 797, -571, -12, -577, -618, -701
+rts
+clr X22
+add r2, *r4
+L29: .data -150, -797
+red r1
+dec *r4
+L30: lea X9, L239
+clr *r1
+dec *r7
+rts
+jmp X6
+mov #-206, L120
+lea X14, r4
+not r7
+inc r2
+bne *r3
+L31: bne L18
+red r1
+cmp L227, r3
+L32: prn L8
+inc L10
+rts
+add r1, r4
+L33: .data 240
+inc r4
+L34: add X3, r4
+prn L220
+L35: dec r3
+red r0
+rts
+bne *r0
+jsr L168
+inc r3
+bne L113
+lea X12, L2
+clr r2
+dec r6
+rts
+prn r4
+L36: .string "ifbomq"
+L37: .string "dizsfvzvpbbmhfdqkm"
+L38: .data -558, 321, 399, 960, 363, 93, 369, -100
+red r5
+jmp *r4
+clr r7
+inc r6
+mov #67, L198
+prn r0
+L39: sub *r1, r4
+; comment
+dec X10
+add *r1, *r6
+lea X13, X11
+L40: prn X18
+lea L95, r6
+L41: prn #224
+sub r4, r3
+not r5
+dec r5
+stop
+dec *r6
+bne *r5
+L42: red *r2
+jsr *r5
+rts
+lea L153, L252
+lea L132, *r3
+L43: .data -932, 175, 768, 170, 584, 701, -610
+prn r1
+L44: .data -633, 179, -569, -48
+bne *r1
+clr L2
+stop
+L45: .data 681, 47, 464, 964
+L46: .data 172, 183, -314, 186, -44, -711, 599
+jmp *r2
+add *r0, X17
+stop
+red r5
+L47: jmp *r6
+L48: dec r2
+bne *r5
+inc r6
+L49: sub #116, r7
+rts
+mov L236, r0
+lea L44, r3
+mov L126, r7
+inc r6
+cmp #-66, r2
+; comment
+L50: red L173
+dec *r7
+mov r6, r4
+red L254
+rts
+L51: prn *r4
+L52: .data 432, -477, 550, -771, 44, 759, 746, -154
+L53: not r7
+L54: sub L31, r2
+add #163, L251
+
+lea L223, r4
+mov r3, L138
+dec X12
+L55: rts
+prn L218
+L56: sub *r1, *r5
+stop
+clr r5
+prn #29
+red *r0
+add L158, r5
+
+jmp X13
+L57: not r0
+bne *r6
+cmp X0, r4
+stop
+jmp L2
+jmp *r5
+L58: clr X11
+red L44
+L59: dec r6
+rts
+jsr L252
+L60: .string "bhfnzpgrhizqd"
+L61: cmp #193, L145
+L62: not *r5
+not r7
+prn *r0
+bne L220
+rts
+cmp *r5, #110
+lea X5, L257
+L63: sub #169, r7
+cmp X20, *r2
+L64: rts
+not r5
+L65: .string "hzwsk"
+bne L38
+sub #-112, r0
+add r5, X20
+; comment
+sub #-140, r4
+mov r4, r1
+sub r3, *r6
+; comment
+stop
+red r2
+L66: stop
+L67: .data 278, -215, 62, -289
+red *r1
+add r0, X23
+L68: dec L68
+jsr *r1
+red *r7
+sub r0, r4
+L69: clr *r3
+lea L10, L13
+add *r1, *r6
+L70: add #67, r5
+clr r5
+rts
+prn L19
+rts
+L71: jsr *r1
+lea L14, L24
+L72: .data 272, -533, 549, 501, -215, -903, -436
+sub #128, r4
+L73: .string "zt"
+prn #-41
+L74: .string "wpmgwctipki"
+L75: .string "scffz"
+mov #48, r4
+inc *r7
+L76: mov r2, r1
+jmp L132
+red L126
+lea L180, *r7
+L77: .string "iwjpirghoxrpvti"
+stop
+bne L0
+L78: .string "acxswbtr"
+L79: .string "aryoshjmptl"
+L80: jmp *r5
+prn #176
+not r3
+jsr L26
+cmp r2, L28
+sub r4, *r3
+L81: bne *r0
+red r1
+; comment
+lea X22, r0
+L82: red r4
+jsr L87
+stop
+inc *r2
+jsr L56
+not *r7
+L83: .data 627, -936, 889, -662, 440, 19
+L84: .string "qidqxgj"
+mov r7, *r7
+mov r1, X13
+L85: jsr L170
+jsr *r6
+not *r3
+L86: .data -895, 957, -415
+dec L188
+clr *r0
+L87: .string "up"
+inc *r2
+bne *r0
+lea L89, *r4
+cmp *r7, r1
+; comment
+L88: cmp *r7, X17
+L89: sub #73, *r5
+stop
+jsr *r1
+not *r3
+clr r1
+add #201, *r7
+inc L185
+prn *r2
+L90: clr r2
+mov L184, L269
+
+bne *r0
+L91: bne *r5
+cmp r7, L209
+rts
+cmp *r5, *r1
+sub L68, *r2
+
+not r6
+L92: jmp X4
+add *r1, r1
+
+clr L2
+L93: .string "a"
+red r2
+L94: .data 569, -574
+not L260
+cmp r0, *r0
+jsr *r4
+jsr X14
+rts
+jsr *r6
+jsr *r1
+not *r0
+stop
+L95: jmp *r4
+not *r1
+L96: lea L79, X8
+prn X8
+clr X24
+L97: stop
+stop
+clr *r0
+prn r4
+lea L39, X18
+L98: red *r2
+stop
+mov X4, r3
+red *r2
+bne *r3
+prn X10
+jsr L94
+dec r6
+rts
+dec X0
+L99: .string "hwnhtdlukiqq"
+clr L84
+not *r0
+L100: jmp *r7
+dec r5
+prn L122
+L101: .data 273, 668, 715, -994, -769, 240, -200
+L102: .data 716, -757, 917, -709, -123, 221
+prn *r4
+L103: .string "wsibawbucbjilvmxfahtx"
+L104: .string "pfqmcg"
+L105: not r7
+cmp #-32, r6
+cmp r1, *r2
+lea L81, X13
+jsr L66
+add #-217, *r5
+add *r1, *r0
+prn #-76
+jmp *r0
+inc r6
+bne *r0
+jsr *r5
+jmp X10
+lea L116, L82
+red *r6
+; comment
+bne L39
+clr L220
+bne *r3
+stop
+
+prn L161
+L106: clr X14
+mov #-186, L88
+stop
+L107: clr L214
+L108: stop
+dec *r3
+L109: clr *r1
+red X21
+L110: jsr L123
+L111: stop
+dec X15
+L112: .string "ojfg"
+not L31
+L113: clr L238
+jmp *r5
+jsr *r0
+L114: not *r0
+L115: mov L213, r6
+cmp r6, X13
+L116: .string "yvftcnzstgi"
+L117: red r0
+L118: sub r6, r1
+add #177, L252
+cmp *r0, r1
+mov r6, *r1
+red r7
+L119: .string "dysidibqefvtcbutl"
+L120: bne L120
+L121: sub L88, r0
+jsr L75
+stop
+sub *r7, r1
+L122: bne L272
+
+L123: dec r5
+L124: .data 884, 240, 219, -179, -626, 64, 6, 414
+lea L128, r7
+L125: .string "qplnijlvkvjg"
+cmp r2, L51
+bne *r3
+jmp L214
+L126: bne L45
+not L24
+inc L3
+sub r5, *r7
+sub #-249, L16
+sub #-64, L11
+L127: prn *r2
+lea X11, X7
+L128: rts
+L129: .string "bfpzepiur"
+inc X20
+L130: not r2
+
+not L255
+L131: .data 883, -106, 133, -928, -32, -445, -333
+red *r2
+L132: .string "zlpmtengmrhsedtejpkpdba"
+rts
+stop
+L133: stop
+sub *r2, r3
+add *r6, *r5
+L134: .string "ecysozbhb"
+jmp *r2
+sub r7, *r2
+L135: .data 433, 901, 956, -33, 449, -1000
+dec r1
+lea X23, L230
+L136: dec r6
+cmp r4, r6
+L137: prn *r0
+mov *r1, *r3
+stop
+dec *r3
+add r6, r2
+L138: rts
+L139: red *r7
+add #245, *r1
+sub *r6, X5
+not r4
+clr L178
+L140: dec X17
+dec r3
+
+add *r3, *r0
+dec X23
+stop
+lea L141, r1
+stop
+jmp *r3
+inc r0
+clr L204
+L141: .string "nfyqjcbrhincsqljff"
+L142: .data 49, 824
+bne *r2
+prn #-248
+L143: clr r0
+sub X16, *r4
+not L248
+L144: red L191
+rts
+prn X21
+clr *r7
+red X4
+sub L249, r7
+L145: bne *r0
+rts
+bne *r0
+cmp r3, #223
+jmp *r1
+rts
+L146: jsr *r3
+clr r4
+dec r3
+L147: prn L86
+L148: cmp L133, X7
+clr r1
+L149: lea X20, X10
+dec r2
+L150: dec *r0
+lea X13, *r3
+L151: sub #-99, *r7
+bne X2
+L152: clr *r3
+L153: .string "amixxy"
+red r4
+red X8
+L154: .data 393, -811, 474, -221, 187, -246, -248
+bne L123
+L155: lea X4, X15
+clr *r6
+bne *r1
+dec *r4
+cmp *r7, #-216
+jsr X22
+L156: red X18
+L157: .string "nlplap"
+red r6
+jmp *r3
+jsr L128
+prn r3
+L158: jmp *r4
+L159: lea X11, *r0
+L160: .data -253, 429, -50, 545, 583, -280, 928, 391
+mov *r3, *r2
+cmp *r1, #-219
+sub *r4, X2
+sub *r2, *r6
+cmp *r0, r5
+jsr *r2
+not r0
+jsr L7
+L161: not L172
+stop
+L162: rts
+sub r0, L244
+L163: bne *r2
+red *r7
+add X10, r4
+rts
+dec X13
+lea L240, *r3
+mov r0, *r4
+inc L209
+
+L164: bne L24
+lea L151, r6
+bne L197
+cmp r6, L265
+jmp *r7
+red X12
+L165: .data 715, -898
+stop
+prn #213
+add X13, X23
+add X4, r7
+bne L257
+L166: rts
+clr r6
+mov #115, *r3
+stop
+L167: add L58, r1
+clr *r6
+inc L235
+mov #45, *r1
+sub #79, r6
+L168: stop
+jmp X13
+L169: .string "xgyx"
+not X20
+sub r6, r6
+inc X9
+dec *r4
+jmp *r5
+prn r1
+L170: .string "xyqkmvojqejzky"
+stop
+; comment
+L171: .string "wcjlbvvybk"
+not r7
+rts
+L172: .data -105, 484
+; comment
+mov *r6, *r5
+prn L180
+L173: stop
+rts
+stop
+stop
+bne *r1
+red X18
+L174: lea L168, r7
+L175: rts
+clr *r1
+red r1
+L176: .string "aiznwvvsxhmaniqoaio"
+red L56
+inc *r3
+cmp r4, r2
+inc X17
+L177: .data -889, -668, -959, 698, -881, 651, -512
+dec X13
+prn L43
+cmp X24, *r4
+inc r6
+lea X24, L212
+mov r3, *r6
+sub #-240, r3
+inc *r3
+L178: .string "mqkfjdgeqa"
+not *r6
+stop
+L179: .string "xvhipnmwhwlgwxgogvsw"
+stop
+inc r1
+L180: .data -939, 250, -429, 340, -594, 30
+prn X21
+red *r5
+L181: add L237, r7
+add L234, *r7
+red r3
+L182: stop
+L183: cmp #61, X3
+red *r3
+inc r5
+cmp r7, r6
+inc L82
+; comment
+L184: add L181, r5
+L185: jmp *r2
+L186: clr *r5
+stop
+red r3
+mov r7, *r3
+L187: lea L87, *r7
+L188: dec *r5
+jmp *r6
+; comment
+L189: sub *r0, *r4
+add *r0, *r1
+L190: prn *r1
+L191: not L89
+lea L106, *r5
+jmp X18
+L192: .data 314, -81, -237, 400
+not *r7
+prn #-223
+prn *r7
+dec *r5
+lea L225, L216
+bne X18
+inc *r0
+jmp L141
+inc r1
+sub L188, *r5
+L193: clr *r0
+clr *r6
+cmp #-96, *r3
+L194: .string "wbrohrgpbzbndworsgr"
+rts
+sub *r0, L270
+rts
+cmp L89, *r6
+stop
+sub *r0, *r5
+L195: jmp *r0
+mov r6, r5
+L196: .data 677, -907
+L197: not *r2
+clr *r0
+L198: bne X24
+inc *r3
+L199: .data 843, -150, 394, -705, -727
+not X9
+L200: inc r3
+add #183, *r6
+L201: inc L123
+prn L41
+cmp *r4, *r4
+inc L23
+inc L263
+red *r1
+cmp #-141, X12
+prn #255
+L202: stop
+L203: .data -526, 321, -672, -530, 979
+red X14
+L204: .data -811, 175
+; comment
+bne *r0
+L205: .data 231, -672, -629, -208, 415, 493, 506, -269
+L206: mov #-97, L271
+add r5, *r7
+L207: .data 33, -615, 502, -345
+jsr *r7
+jmp L19
+lea X9, *r3
+prn r2
+add *r2, L218
+dec *r3
+clr r2
+lea L18, r1
+add #-219, L251
+stop
+prn #148
+dec *r3
+sub L80, *r7
+L208: bne *r1
+stop
+lea X0, *r3
+L209: clr *r3
+L210: .string "kbylrmwl"
+mov L106, r3
+lea X16, r6
+; comment
+sub X6, *r2
+jsr L157
+clr L210
+jsr *r7
+bne L224
+L211: sub #-75, *r6
+mov #37, *r0
+add r7, *r2
+prn r1
+L212: .data 541, -500, -512, 579, 47
+lea L272, L227
+not r7
+; comment
+bne *r3
+lea L244, r7
+sub #-198, *r2
+jsr *r6
+lea L257, *r2
+red r6
+mov #-84, *r1
+L213: .string "nuqvhwnmfwozigripe"
+bne *r6
+prn L194
+jsr *r3
+dec *r5
+bne *r3
+mov r3, *r7
+L214: .string "khxalqwcgmrzpkq"
+L215: bne L262
+rts
+prn *r3
+clr *r3
+
+L216: inc *r6
+bne X3
+stop
+red *r7
+add #101, *r5
+add r5, X18
+clr X12
+inc X16
+L217: .data 133, 278, 527, 581, 114, 549, 924, -762
+L218: .data 10
+clr *r4
+jsr X2
+inc X9
+L219: jsr L241
+mov #-60, L242
+L220: clr r5
+L221: rts
+L222: stop
+lea L184, *r6
+L223: .string "nvxjgmnlbleou"
+prn X10
+dec *r0
+rts
+jsr X17
+cmp X15, #111
+rts
+; comment
+lea X19, L235
+add *r4, r4
+cmp *r4, L94
+jmp X3
+clr L237
+dec X7
+clr *r4
+sub L254, L224
+cmp r3, #-43
+inc *r3
+; comment
+cmp #-168, r4
+; comment
+dec r7
+rts
+sub #-121, r2
+red X20
+not *r7
+L224: red *r4
+red L42
+L225: bne *r1
+jsr L244
+L226: .data -639, 902, 787, -85, -86, 802, 719
+inc L253
+L227: .string "gifod"
+bne *r5
+not L272
+cmp r1, L126
+rts
+jsr X24
+cmp *r2, *r5
+sub X11, *r5
+L228: rts
+not r2
+jmp *r5
+lea X5, L242
+rts
+clr r2
+not L237
+mov #129, r2
+L229: .string "uiyithpt"
+cmp #-163, #-119
+jmp *r6
+jmp L270
+rts
+rts
+L230: not r5
+lea L253, L155
+L231: red r3
+not L116
+inc X0
+add L206, L242
+rts
+L232: add #139, L195
+jmp L129
+inc L240
+inc L241
+
+dec *r1
+rts
+not r2
+rts
+L233: .data 344, 251, 905, 343
+L234: prn L244
+rts
+; comment
+L235: lea X1, *r3
+L236: .data 881, 915, 336, 880, 998, 852, -88, -998
+bne L271
+clr X4
+sub r6, *r5
+dec *r3
+mov r1, L189
+rts
+cmp r0, X12
+clr *r1
+lea L237, r7
+lea L105, *r7
+clr *r6
+L237: lea X18, *r0
+red r2
+L238: .string "nswbnjgfbfwhcsqbif"
+; comment
+lea L47, L32
+stop
+L239: lea X23, *r1
+clr *r1
+cmp #9, L82
+jsr X16
+L240: .string "hnmzhzvveq"
+L241: .string "sdfwbjttmzijduzngrv"
+bne *r4
+clr *r1
+dec L183
+prn r1
+L242: .string "pqoymv"
+not L197
+L243: .string "inlgfltpybp"
+L244: .string "fzboibzggeypubtnazzcopp"
+L245: .string "towgdjplrlsnbewxgutfd"
+L246: bne L101
+prn #214
+dec r7
+jmp *r0
+dec *r1
+L247: jmp X14
+clr r1
+add *r1, *r0
+L248: .string "cvhdkjzbmzeenxdy"
+red r6
+inc *r5
+stop
+
+add #-175, r2
+add r3, r6
+L249: .data -765, -962
+rts
+jmp L270
+not *r1
+L250: inc *r7
+dec L37
+L251: inc *r4
+prn #217
+jmp *r4
+stop
+L252: red *r0
+L253: jsr L272
+sub #242, r6
+L254: prn *r1
+; comment
+L255: .data 744, 845, -731, 633, -867
+cmp r0, #-132
+L256: bne X20
+L257: jsr *r5
+clr r1
+dec r1
+L258: .data -285
+; comment
+L259: .data -453, -676, -554, 891, -785, 228
+L260: mov #-27, L225
+red X12
+cmp r7, #-46
+
+rts
+add *r2, *r2
+red *r6
+mov L263, *r2
+jmp *r7
+L261: bne L79
+L262: .data -310, -825, 126, 931, -330, 599, 257
+L263: cmp #32, X19
+mov #198, X3
+L264: jmp L267
+L265: .string "mj"
+jmp X3
+not r7
+red L271
+inc *r7
+mov L269, r5
+add r4, X6
+mov r7, L268
+add *r7, X7
+jsr L246
+mov L105, *r2
+clr *r1
+L266: .data 474, -458, -478, -482, -680, 841, 907
+not *r3
+L267: .data -272, -110, 186
+L268: inc L222
+stop
+L269: .string "ygahnzft"
+lea X3, *r6
+L270: .data 356, -418
+L271: jsr *r4
+inc r1
+jmp X12
+mov r0, *r7
+red X19
+bne L272
+L272: .data 79, -548, -424
+stop
@@ -0,0 +1,1044 @@
+; Generated by genCorpus --seed 36
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+clr X18
+cmp L54, r3
+inc r7
+rts
+L0: lea L0, *r5
+not X3
+lea L0, L0
+bne *r3
+inc r1
+L1: .string "fpqxbj"
+L2: sub r6, *r3
+mov X14, *r2
+clr r4
+cmp #-237, #-18
+lea L1, r3
+sub #1, *r2
+jsr *r1
+rts
+jmp L2
+lea L1, *r1
+L3: .data 731, 245, -893, 663, -648, 919
+red r5
+stop
+L4: .string "sfthpbpciqklna"
+jmp L112
+
+L5: stop
+inc *r2
+not X18
+jsr *r7
+stop
+L6: prn L6
+inc X1
+; comment
+sub #-210, *r6
+sub #92, r0
+clr X13
+jsr *r2
+L7: clr L3
+add r2, X7
+clr *r4
+inc L4
+stop
+L8: jmp X3
+add r1, *r6
+prn L188
+jsr X7
+L9: bne *r2
+
+dec *r1
+inc *r6
+L10: .string "sjwcpsg"
+dec *r4
+L11: .string "zouwsolpmmwrtgimkrufufsy"
+L12: clr *r3
+
+L13: .data 978, -865, -781, -265, 862
+lea X9, *r2
+
+L14: inc r3
+
+rts
+cmp r1, r6
+L15: jmp X12
+rts
+red L7
+; comment
+; comment
+stop
+prn *r3
+jmp *r2
+bne L1
+L16: lea L13, r6
+prn #74
+rts
+L17: dec r3
+L18: .string "hcpyciqc"
+cmp r4, *r4
+inc L3
+L19: .string "webyptbg"
+L20: sub *r1, r3
+L21: .string "spmlhprnnjg"
+jsr *r1
+rts
+L22: lea L13, r3
+lea X16, *r2
+jmp *r2
+red *r4
+add L75, L89
+L23: .string "d"
+L24: lea L129, *r3
+sub #-171, *r5
+stop
+lea L0, L118
+add #180, X18
+L25: .data -305, -106, -763, 395, 591, 33
+L26: .string "mjqlcnbdrgltnubjis"
+cmp L15, #-156
+jmp *r6
+rts
+L27: prn *r3
+mov r2, X22
+L28: bne *r4
+stop
+L29: .data 867, -769, 354, -766, -506, 995, -640, 111
+
+rts
+stop
+not r2
+L30: jmp L26
+L31: rts
+L32: .string "hxtkzmkmze"
+L33: .data -891, 990, 198, -726, 710
+
+dec *r1
+L34: .string "uszpvmcqtmfowtfrqs"
+rts
+stop
+jsr *r1
+stop
+bne L255
+L35: .data 894
+L36: stop
+rts
+jsr *r3
+jsr *r0
+clr *r5
+rts
+stop
+bne X11
+; comment
+L37: .data 687
+not X2
+dec r4
+clr L7
+clr L84
+bne *r7
+L38: .data 315, 984, -709, 846
+cmp *r5, r0
+bne L5
+inc r4
+L39: not X19
+mov #213, L8
+L40: dec L206
+jsr L86
+L41: .data -235, -417, 532, 832, -868, 427
+jmp *r2
+dec r6
+jsr *r5
+L42: bne X23
+L43: .string "fbvgqss"
+prn *r3
+; comment
+bne L150
+not r6
+red *r5
+cmp L27, r4
+bne L8
+stop
+bne L85
+sub #-101, L105
+prn #-29
+sub #137, *r4
+L44: .data -982
+bne L65
+not *r6
+cmp X7, #-159
+jsr X11
+L45: bne L34
+L46: .string "kbidsrquvrmlzxlsqcaxv"
+L47: .data 757, 177, 807
+clr L23
+L48: .string "kivavlznpkgzspzscsug"
+stop
+
+stop
+L49: mov L71, L8
+sub X5, r4
+dec L16
+inc *r0
+jmp X23
+clr r2
+bne L36
+inc r4
+bne X2
+L50: .data 896, -754, -526
+L51: not L44
+L52: add #-234, X13
+add #-54, r0
+jsr *r4
+prn #26
+add #156, L1
+lea X6, r3
+jmp *r2
+mov #163, *r7
+L53: inc r3
+; comment
+dec *r5
+L54: .data -288, -951, 532
+L55: bne *r6
+prn X23
+prn r7
+L56: cmp #30, X0
+mov *r3, L207
+dec r6
+sub #94, r1
+clr r2
+sub L10, r0
+lea X2, r5
+clr X10
+L57: .string "oqljbhxhggjszk"
+sub r5, *r0
+L58: .string "hqhb"
+red L156
+; comment
+L59: jsr *r0
+jmp L55
+not *r4
+stop
+inc X21
+stop
+rts
+L60: cmp *r7, L196
+L61: not *r3
+lea X13, *r4
+dec *r2
+clr X7
+not *r2
+not r6
+L62: .data -823, 411, 486
+clr *r2
+rts
+inc *r3
+L63: prn r5
+jsr *r2
+red *r4
+cmp #-153, r6
+sub L188, X18
+L64: not *r6
+inc *r1
+L65: rts
+L66: lea L71, r2
+L67: bne X21
+jmp X19
+not L145
+bne L106
+prn X19
+dec *r2
+mov *r2, r7
+clr r3
+add *r5, r0
+jmp *r5
+jmp X5
+mov *r1, L70
+jsr *r2
+sub r1, *r7
+rts
+inc *r7
+jmp *r1
+L68: .data -497, -655, 471, -229, 455, -109
+rts
+L69: .data -588, -852, 664, 134, 939, 697, 867, -458
+inc *r4
+sub r2, L63
+rts
+L70: .string "nzwmpu"
+jmp L17
+sub #-69, *r1
+prn *r2
+jmp *r5
+inc r3
+mov L201, *r7
+L71: .data 155, 68, 748, 481, 237
+jsr *r0
+mov r4, *r0
+prn r6
+mov X1, r3
+L72: rts
+L73: dec r5
+dec *r7
+L74: .string "nehivrosvgsijeg"
+L75: inc r7
+mov L73, *r2
+rts
+clr X18
+dec r5
+not *r5
+not r2
+add r3, r4
+L76: clr *r1
+L77: bne X24
+dec *r6
+cmp L32, r3
+L78: .data -510
+sub *r1, L22
+jmp L79
+clr r2
+stop
+red *r2
+prn #102
+L79: .data -956, -197
+add #-73, *r0
+prn #-130
+red r0
+inc *r7
+L80: lea X20, *r7
+; comment
+lea X21, *r0
+clr L46
+lea X4, *r0
+rts
+jmp *r3
+red r6
+L81: jsr X3
+not *r1
+cmp *r7, #-75
+not *r2
+jsr *r3
+L82: .string "wunqcmryndwcdofejg"
+L83: stop
+jsr *r0
+L84: prn *r4
+L85: jsr L249
+stop
+inc *r4
+jsr L161
+inc *r4
+prn *r1
+red r3
+L86: .string "dumxt"
+prn r6
+clr X8
+stop
+jmp L72
+L87: lea L66, r1
+lea X22, r3
+L88: .data -489, -40, 825, 46, -586, 358, 416, 385
+L89: .string "qhsh"
+L90: inc r2
+L91: bne X0
+lea X9, r2
+lea L100, r4
+L92: .data -448, 910, -268, 279, 362, -6
+inc L203
+L93: .string "sligmdlbpky"
+inc *r6
+L94: clr *r4
+jmp L215
+sub X2, r4
+add L58, r2
+not r6
+add #55, *r0
+L95: sub r1, r2
+mov r2, L153
+dec L102
+bne *r5
+L96: dec L56
+L97: add *r4, L89
+add *r2, L183
+jsr X0
+L98: inc *r7
+dec r3
+lea L216, r0
+jsr L123
+jsr X16
+L99: lea L172, L59
+clr *r4
+inc r6
+L100: .string "smajcaylhxque"
+prn r1
+dec *r0
+inc *r6
+cmp X13, L127
+L101: .string "t"
+L102: .string "ekwcewji"
+L103: .string "uamsfeqppxqdmgn"
+L104: .data -275, -344, 217, 911, -686, 866, -543
+; comment
+L105: .string "ilmcrucmczqqjobrwq"
+clr r6
+rts
+jmp L94
+L106: add r2, X2
+inc r4
+lea L103, r1
+sub r2, *r6
+dec r6
+cmp L68, #-28
+L107: jsr L108
+lea L99, L154
+prn *r1
+rts
+bne L225
+mov r5, X9
+L108: inc *r3
+L109: sub *r6, r1
+rts
+add *r3, L12
+dec *r6
+add X24, r7
+L110: add *r5, r5
+bne *r5
+cmp r1, L61
+L111: .data 174, 205, -605, 293, 886, -143
+
+dec r2
+bne *r0
+L112: .data 503, 106, -458, 809, -53, 658, 898
+L113: red L124
+L114: red *r0
+jmp *r0
+sub r4, *r3
+mov r5, *r1
+L115: sub *r2, L21
+clr *r1
+L116: inc *r1
+red r1
+L117: mov #92, X10
+red r7
+mov L194, r7
+L118: .data 526, -251
+; comment
+mov #-181, *r7
+add *r3, L168
+not L243
+inc X6
+jmp *r2
+L119: jsr *r4
+L120: .string "uruyvwzvdxkbznlbqwxxjq"
+clr r7
+mov r6, r2
+rts
+clr X6
+jmp *r4
+jmp X3
+L121: prn #-160
+L122: jmp X1
+L123: .string "lz"
+rts
+inc L248
+inc *r1
+L124: .string "tultyjxuboosuhkbeknfqu"
+not *r1
+dec r1
+dec X13
+jmp *r2
+prn r4
+jmp *r2
+bne L182
+mov #-128, r0
+clr r6
+not L172
+clr *r1
+jmp *r4
+not *r3
+L125: sub r3, X20
+stop
+
+L126: .string "nhpczfpmgo"
+L127: jsr *r0
+L128: sub X0, *r2
+lea L24, L135
+L129: rts
+L130: jmp *r4
+L131: rts
+L132: .string "fzylpwjgovcoruupiwkeb"
+bne X24
+L133: red L150
+bne *r5
+L134: cmp X0, r4
+sub #-196, r7
+L135: not L65
+bne *r5
+cmp X23, r1
+add *r2, X4
+L136: jmp X7
+bne X12
+L137: jsr *r5
+L138: sub #211, L0
+L139: .string "wjaya"
+jsr L238
+
+stop
+L140: add r5, X18
+add r0, L52
+prn #56
+bne *r1
+mov r6, r6
+inc r0
+L141: jsr X18
+L142: clr *r2
+add r2, *r0
+jsr X21
+inc L82
+stop
+inc *r3
+red X12
+L143: .data -563, 165, 882, 396, 584, 639
+lea L153, r6
+prn #-7
+stop
+not X15
+L144: .data 342, -418
+prn X8
+not r1
+add #162, *r1
+prn X0
+L145: .data 172, 187, -472, -839, -640
+red *r2
+sub *r0, L28
+cmp X6, #-204
+inc *r1
+
+L146: .data -604, -860, -963, 423, -598, 331, -342
+not *r3
+L147: dec L2
+not r6
+
+stop
+L148: bne L138
+L149: sub r5, *r6
+prn X9
+L150: sub #-22, X4
+add *r0, *r1
+dec L113
+prn *r4
+L151: bne *r5
+bne *r7
+not X18
+inc r5
+jmp *r1
+dec L222
+inc r5
+cmp #-231, *r2
+cmp L37, #-32
+jsr *r6
+jmp X10
+stop
+L152: lea X9, *r1
+jmp X15
+L153: sub #53, *r5
+L154: .data 724, 95
+add L138, L67
+not *r6
+prn *r4
+add *r4, X8
+L155: stop
+L156: bne *r3
+sub #126, r7
+L157: stop
+not r4
+L158: bne *r2
+sub #158, *r3
+jsr *r3
+L159: clr X2
+prn X23
+dec *r5
+L160: red *r0
+
+sub #162, *r2
+inc r3
+L161: red X11
+L162: jsr X17
+stop
+
+L163: prn #-249
+not r3
+mov r2, *r4
+bne *r7
+jsr X1
+clr X11
+not X6
+cmp #-189, #236
+lea L81, X3
+cmp L72, r7
+sub r6, L51
+not *r4
+dec X24
+red r5
+red r2
+cmp *r1, L264
+rts
+add #176, X13
+
+sub *r6, L230
+L164: .data -917, 841, 992, 885, -425, -291
+stop
+jsr *r7
+; comment
+sub r4, r5
+rts
+
+bne X13
+add r2, *r6
+L165: .data 992, -93
+jmp *r0
+inc r1
+L166: prn #-174
+L167: .data -754, 866, -216, -126, 682
+add #242, X10
+prn L120
+L168: cmp #-6, L118
+rts
+
+L169: .data 993, -855, -913, -365, 20, 585, -481, 193
+L170: dec L223
+not L244
+jmp L149
+inc r1
+dec *r7
+sub r0, *r7
+L171: .string "koymmwmsiplvsmqv"
+cmp L249, r1
+not X20
+lea L89, *r3
+clr L77
+cmp L33, *r3
+add *r6, L56
+cmp X3, L39
+
+clr r2
+inc r6
+rts
+; comment
+sub *r1, X13
+stop
+sub r5, *r2
+prn *r7
+not r6
+inc r3
+rts
+L172: red *r3
+L173: dec *r7
+jmp L116
+mov #-62, r4
+cmp #-242, r1
+prn #205
+L174: red X23
+stop
+L175: cmp X0, #-210
+L176: .string "g"
+prn L212
+dec *r5
+cmp L131, r6
+jsr *r0
+red *r7
+L177: red r1
+sub L264, X1
+red X17
+jmp X9
+sub #-51, *r4
+L178: add #-124, L204
+L179: bne *r6
+red *r4
+jsr *r6
+L180: sub r7, L205
+; comment
+stop
+dec *r2
+L181: inc *r2
+mov r6, *r6
+not r4
+dec r0
+bne *r0
+L182: clr r2
+; comment
+jsr *r4
+not r3
+prn L42
+; comment
+L183: .data -318, -53, 842
+add r7, r4
+inc X19
+sub #198, *r6
+red *r4
+mov r3, r0
+rts
+stop
+; comment
+lea X24, X21
+lea L71, *r2
+red L12
+mov *r5, r6
+L184: clr *r7
+stop
+jsr X8
+add L86, *r2
+prn #23
+jsr L1
+rts
+; comment
+L185: lea X7, L81
+rts
+inc X7
+L186: lea X11, r1
+L187: .string "gkjthkpqtjstlibrdstvlwui"
+lea L249, *r2
+red X24
+jsr *r3
+lea L211, *r6
+clr r6
+not r6
+L188: mov X12, L257
+not r7
+sub *r5, *r5
+jmp X10
+mov *r5, X20
+mov r7, r4
+dec *r7
+bne L257
+L189: add #169, *r1
+L190: lea L126, r7
+inc r0
+lea L190, *r3
+lea L9, r6
+sub #-99, r2
+
+stop
+inc r6
+inc *r1
+dec L212
+sub *r5, L214
+bne *r4
+L191: jmp L115
+L192: not *r1
+L193: prn #-89
+bne X14
+lea L214, *r6
+jmp *r5
+L194: .data -357, -471, -268
+; comment
+stop
+; comment
+inc L235
+L195: dec L71
+lea L24, X22
+clr *r6
+stop
+sub L111, X6
+L196: not r7
+; comment
+not L107
+jmp *r6
+stop
+L197: .string "pofilvylllxwp"
+not L206
+red *r4
+sub #-247, L74
+L198: jsr *r0
+clr L29
+L199: red *r5
+not *r3
+rts
+cmp #-170, *r7
+red r6
+jmp *r4
+L200: rts
+cmp *r1, #-20
+L201: sub r3, L165
+stop
+L202: dec L97
+rts
+prn #13
+jsr *r2
+L203: not *r7
+L204: .data 222, 725, 562, 457, -258, -997, 813, -946
+L205: .data 13, 159, -847, -213, -103, -779
+sub #58, r6
+mov L64, *r0
+add #-151, r4
+L206: inc L62
+L207: .string "cbeonxyqa"
+lea X12, r7
+dec *r5
+clr L196
+not r5
+inc r3
+cmp r4, *r0
+clr r1
+L208: rts
+stop
+mov X17, L263
+L209: .data 689, -211
+red *r2
+prn *r3
+L210: .data -406, 870, 446, -814, 554, -946
+add X19, r4
+mov r5, X4
+L211: red L99
+prn r7
+prn L233
+clr *r0
+dec L184
+L212: bne X11
+not *r1
+stop
+L213: inc L90
+L214: jmp L60
+dec *r5
+clr X13
+lea L222, r2
+add *r3, *r4
+lea X9, *r3
+jmp X0
+; comment
+L215: red *r3
+lea L155, r6
+not *r5
+add r2, L255
+red L219
+L216: .string "gfeaakgmecif"
+add r5, *r1
+red *r7
+prn r4
+bne *r1
+stop
+stop
+red r4
+jsr *r5
+inc r6
+L217: .string "wpgkmcyzexwwhpmt"
+L218: .data -255, -706
+dec L112
+stop
+L219: inc r3
+L220: prn #160
+L221: .data -743, 22, -639, 96, 990
+sub #-237, X22
+cmp #155, r4
+jmp *r2
+cmp *r2, #221
+sub *r5, L262
+L222: .string "qefbtnrwkzu"
+add L195, X13
+red *r0
+lea L264, *r1
+; comment
+jmp *r7
+lea L149, X16
+L223: cmp *r0, X9
+clr r3
+sub X22, *r4
+L224: lea L162, r0
+L225: sub #-234, X7
+L226: prn L171
+L227: mov r7, r0
+L228: sub X15, X15
+L229: jsr *r0
+dec *r3
+L230: lea X5, *r7
+prn r2
+red L133
+lea X7, r0
+prn L244
+L231: .string "quecypanbygjwucih"
+L232: .string "dwotbsttsse"
+add L214, *r6
+cmp L261, *r5
+rts
+add #-80, r4
+dec L146
+bne *r5
+stop
+L233: jsr X17
+jsr X12
+L234: rts
+not r2
+prn *r7
+red *r2
+rts
+not r7
+sub *r4, r4
+; comment
+L235: not *r0
+red r5
+stop
+jmp L256
+bne X15
+L236: inc *r6
+L237: red r6
+clr *r0
+inc *r7
+red *r0
+stop
+L238: inc L145
+
+sub *r6, X9
+not L2
+L239: .data -834, 648, 663
+L240: .data -550, 280, 761, -111, -217, 109, 812
+not r1
+clr *r4
+mov r5, L143
+dec L250
+lea L99, r0
+L241: rts
+add #-105, *r5
+add X10, *r5
+stop
+L242: dec L39
+L243: stop
+inc L261
+dec r1
+prn #233
+stop
+sub r7, *r4
+cmp r2, L209
+sub L163, *r6
+L244: .string "gwydcs"
+jmp *r6
+lea X5, L261
+L245: add X11, X21
+lea X4, *r6
+L246: .data 97, 446, 432, -532, 191, 923, -544
+L247: .string "zrgjk"
+cmp r3, L20
+stop
+L248: rts
+L249: lea L248, r0
+L250: clr r2
+L251: not L143
+L252: sub r4, *r3
+rts
+bne *r6
+inc L203
+
+dec X13
+L253: lea L147, *r3
+mov r5, r6
+red r7
+L254: add r3, r3
+dec r4
+lea L103, r0
+sub L226, r7
+inc *r2
+rts
+inc *r0
+not r7
+inc *r5
+cmp X24, r5
+bne *r0
+dec *r2
+dec *r3
+inc L258
+mov *r2, r3
+rts
+red *r3
+prn *r3
+clr r3
+not r0
+lea X23, L211
+prn *r5
+prn #-220
+lea L261, L117
+red *r7
+dec *r7
+inc *r1
+L255: stop
+prn L138
+rts
+L256: mov #255, r5
+bne *r7
+mov #-42, L262
+L257: bne X13
+dec r0
+L258: .string "pko"
+rts
+dec *r2
+L259: stop
+lea L182, *r2
+cmp r3, r4
+L260: mov *r2, *r3
+dec *r1
+add #-55, *r0
+mov *r5, *r2
+L261: inc r2
+jmp *r1
+prn #-186
+clr *r7
+stop
+jsr L264
+jsr X16
+red X16
+mov *r6, *r1
+jsr *r2
+jmp L262
+cmp #-197, r2
+L262: dec L264
+cmp *r0, #54
+L263: .string "tg"
+bne X22
+dec *r6
+L264: .data -529, 433, 127, 376, 675, -491
+jmp *r1
+prn r5
+lea L170, L239
+sub #-92, r0
+not r7
+not r3
+dec *r5
+stop
@@ -0,0 +1,1044 @@
+; Generated by genCorpus --seed 37
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+lea X17, *r7
+red r3
+red L204
+L0: rts
+clr L0
+L1: jsr *r3
+L2: cmp #-205, r4
+cmp *r5, r5
+lea L2, X17
+rts
+jmp L1
+L3: not r7
+L4: .string "zxlgya"
+L5: jmp X22
+cmp *r6, X15
+L6: prn #-255
+dec *r5
+bne *r0
+bne *r4
+add *r2, X15
+inc X10
+inc *r4
+clr *r6
+add r7, L86
+jsr L0
+L7: .data 172, 795, 830, -815, -175, 696
+bne L0
+sub r7, X10
+add *r6, *r3
+L8: .string "qytqxmnnjifem"
+cmp L138, *r7
+not L3
+not X21
+prn *r5
+sub #30, *r0
+not r4
+cmp *r1, #-122
+L9: bne *r7
+L10: .string "y"
+rts
+red *r3
+L11: prn X18
+sub L106, X13
+L12: bne *r4
+mov #-172, r4
+mov L221, *r0
+inc *r5
+; comment
+jmp X16
+sub L8, *r3
+clr L3
+L13: jsr *r4
+cmp L19, X7
+jmp L225
+rts
+L14: red *r5
+L15: mov #-246, *r1
+prn L154
+clr r0
+prn r4
+red *r3
+jsr *r6
+clr r5
+cmp r1, r6
+red *r0
+L16: cmp r1, *r3
+; comment
+L17: mov #45, r6
+prn #226
+L18: sub L10, r4
+dec r6
+rts
+
+mov *r3, r2
+prn L59
+bne L49
+jsr *r2
+dec r6
+L19: red X10
+jmp L1
+add *r3, L56
+dec *r0
+jsr *r0
+L20: stop
+not r2
+red r7
+L21: lea L19, *r4
+L22: sub #4, r0
+sub #230, *r0
+cmp L56, *r3
+dec *r3
+rts
+L23: bne L166
+L24: sub *r4, *r5
+prn *r4
+clr r4
+rts
+L25: .data 934, 34, 493, 303, 87
+inc *r1
+; comment
+red *r6
+L26: sub #62, r3
+red X20
+jsr L53
+inc L8
+sub r6, r4
+L27: sub *r7, r7
+sub L150, r3
+
+L28: .data -639
+L29: .data 4
+cmp #-235, L121
+jsr *r5
+sub r3, r0
+clr *r6
+stop
+inc r2
+L30: red *r0
+sub X5, *r7
+sub r0, X8
+L31: lea X22, r5
+
+L32: jsr X0
+L33: red X7
+dec X0
+cmp #185, r7
+cmp *r0, X24
+add #118, L93
+L34: .data 272, -304
+prn r4
+bne L111
+lea X0, *r6
+inc r1
+mov r2, r4
+stop
+rts
+; comment
+L35: mov r4, r7
+L36: add X4, *r6
+L37: dec *r0
+L38: .string "smrrdqybsegqxu"
+prn *r7
+
+prn L98
+L39: mov r6, *r7
+cmp r1, L140
+L40: clr *r5
+dec *r2
+L41: sub *r6, X8
+prn r7
+inc *r4
+inc *r4
+L42: add *r5, r3
+bne X18
+jsr X13
+L43: add r2, X11
+prn #-67
+L44: .data -81, -170, -778, -629
+jmp *r4
+; comment
+lea L180, L79
+sub X6, X19
+jsr *r5
+; comment
+rts
+bne *r7
+rts
+cmp *r2, *r0
+inc X12
+cmp r0, X3
+dec *r0
+rts
+L45: add L249, r2
+sub X22, *r1
+sub r4, r2
+mov r3, r5
+L46: rts
+prn r6
+inc L100
+inc *r3
+jsr L119
+L47: cmp r0, #-118
+stop
+cmp r3, L31
+rts
+not *r5
+bne *r5
+L48: mov L36, r7
+L49: .string "xmrzwdeuyy"
+bne *r7
+L50: red r6
+bne *r5
+jsr L124
+clr L46
+prn *r4
+sub L108, *r2
+bne *r3
+mov #-36, *r3
+L51: add r7, L245
+L52: .string "monkmdohaviivdmztlap"
+L53: .data -350, 764
+not L25
+inc L88
+stop
+prn r5
+L54: rts
+L55: prn *r5
+dec r6
+prn r3
+L56: .data 232, -104, -459
+inc *r7
+jsr *r0
+dec r3
+inc r4
+prn L93
+
+L57: not r7
+L58: .string "zoqwpuhzixdqqtu"
+inc *r0
+L59: .data -518, 545, -785, -69, -711, 287, -118, -278
+add L53, r7
+add #-223, X17
+L60: inc *r4
+jsr X10
+L61: not X16
+stop
+red r5
+mov L2, r6
+add X24, r3
+; comment
+L62: .string "j"
+dec *r5
+L63: .data -348, -671, 596, 104
+dec L63
+cmp r5, #-202
+L64: lea L183, *r6
+L65: mov #50, r3
+L66: red r4
+lea L21, *r6
+stop
+L67: lea L49, *r1
+stop
+add r7, r1
+clr *r4
+L68: lea X23, r0
+L69: jsr L54
+prn *r5
+stop
+L70: bne *r1
+cmp #231, #-164
+mov #-115, X0
+clr r5
+sub *r7, L124
+cmp L178, *r1
+mov r4, *r3
+cmp X4, *r3
+L71: add #236, r5
+L72: sub #215, *r3
+inc *r1
+jmp L229
+L73: rts
+L74: .string "cfainminsfdpxuncmtvpvm"
+clr *r2
+add *r2, *r5
+inc r2
+cmp *r1, *r6
+red X8
+not *r5
+bne L41
+lea X17, r3
+lea L8, L40
+L75: dec L68
+clr *r7
+L76: .data 423, -411
+lea X10, *r6
+L77: lea X20, r3
+clr X15
+jsr *r7
+L78: dec L148
+L79: .data -585, -470
+stop
+L80: mov *r2, r6
+L81: bne *r1
+jsr X20
+jsr L30
+clr *r2
+clr r2
+L82: dec L36
+dec L65
+L83: .string "zhnaiulqgrdfypmi"
+L84: .data -237, -918, -667, -247, -74, 839
+add r7, *r7
+L85: bne *r6
+sub *r5, L101
+L86: .string "dawqolahtemhqix"
+L87: .data 446, -994, 906, 410, 992
+clr *r7
+stop
+L88: lea X12, *r5
+rts
+L89: .string "ytkxnepbkn"
+rts
+bne X23
+red L42
+jmp L80
+sub L126, *r7
+L90: cmp X2, r1
+red r1
+cmp L17, L179
+stop
+L91: not r3
+L92: .string "tdgfsycsy"
+rts
+jmp X19
+add *r5, r7
+L93: jmp L52
+lea X16, *r7
+L94: .data 124
+add L176, X23
+L95: cmp r4, *r3
+jsr *r4
+; comment
+stop
+mov #-175, r2
+L96: red r6
+add L166, r1
+stop
+bne X8
+lea L73, *r7
+L97: mov *r6, *r2
+mov #215, *r6
+clr r5
+clr r2
+jmp L197
+stop
+L98: .data 478, 208, -7, 898
+jsr L86
+stop
+bne L45
+rts
+rts
+sub *r1, r4
+clr r2
+L99: .data 686, 328, -134, -436
+sub #-118, r7
+L100: .data -962, -91, -3, 409, -178, -954, -1000
+L101: .string "xpdo"
+sub *r4, *r5
+
+inc *r1
+L102: sub r4, r3
+cmp *r6, *r3
+lea L197, X5
+red X16
+prn #36
+lea X8, L208
+bne L1
+mov r2, X20
+L103: cmp *r5, *r4
+L104: .data 988, 830, -935, -45, 416, 57
+clr r6
+bne *r3
+jmp X14
+not *r5
+
+cmp #-250, r4
+lea L96, L17
+mov r5, r0
+rts
+not *r3
+jmp *r5
+mov X8, L130
+L105: red r0
+L106: rts
+add *r3, r4
+add *r1, *r6
+jmp X20
+L107: .data 425, -640, 368
+inc *r6
+stop
+dec *r3
+jmp X14
+prn *r1
+stop
+add *r2, r1
+jmp *r7
+dec r0
+L108: bne L122
+L109: add #83, *r7
+stop
+L110: jsr X19
+lea X1, L78
+stop
+lea L240, *r3
+
+cmp L66, #106
+stop
+bne X4
+clr r6
+not r6
+
+L111: .string "zcbjul"
+mov *r7, L37
+inc r1
+
+L112: dec *r5
+lea X22, r5
+L113: jmp L201
+; comment
+sub *r2, *r6
+cmp L71, *r3
+dec *r7
+rts
+add *r1, *r1
+cmp #-219, #182
+L114: .data -484, -332, -591, 458, -842, -222, -54, -893
+inc *r0
+rts
+inc *r5
+; comment
+stop
+bne L132
+red *r7
+jsr X9
+sub *r0, r6
+sub L154, *r5
+L115: jmp L166
+L116: add #175, L94
+rts
+L117: add #-87, r4
+cmp *r2, r3
+jsr *r4
+inc r5
+L118: .string "znxelvokccqgcfxfjpqfln"
+clr *r6
+L119: inc r3
+
+L120: cmp r0, L81
+L121: bne L139
+prn #-124
+rts
+lea L158, L108
+clr X3
+L122: .data -162, -847, -677, -197
+dec X7
+add *r1, X24
+add r6, r2
+L123: jsr L85
+prn L110
+L124: rts
+mov L197, *r5
+stop
+jmp *r0
+prn *r7
+bne X18
+cmp X7, r1
+rts
+L125: .data 719, 260, -934, 684, 551, -12, 329, -4
+add #142, *r1
+sub r5, L236
+sub X20, *r3
+clr *r6
+L126: .data 878, -129, 780, -568
+jsr *r5
+clr X20
+red r6
+dec r7
+L127: rts
+L128: .string "aqqaqgqmdwkrd"
+stop
+red r1
+not L186
+lea X4, r2
+sub X8, r2
+L129: .data 879, 13, 992, -130, 198, -560, 879, 889
+cmp *r1, L211
+L130: mov r4, r1
+L131: cmp *r4, r4
+sub *r4, *r0
+add L62, *r0
+red *r6
+jsr X13
+add r2, L31
+L132: jmp L199
+mov #-120, r0
+inc r5
+add r6, *r4
+rts
+L133: bne *r0
+
+L134: .string "ykggbpcrnhtv"
+; comment
+mov *r5, r5
+sub r0, X11
+mov #167, r5
+jmp L158
+inc X5
+bne *r2
+cmp #74, *r1
+L135: .string "bijlxmxdysdx"
+jmp X13
+stop
+L136: prn *r4
+L137: .data 129, -447, 884, -610
+dec r6
+mov #-141, *r6
+prn X1
+jmp X15
+inc *r0
+L138: jsr *r1
+; comment
+lea L41, r6
+mov #-9, L46
+L139: cmp *r1, r0
+not *r6
+sub r1, *r5
+lea X10, *r6
+clr L259
+inc *r3
+L140: .data -699, 297, -569, -830, -321, 31, 157
+dec r6
+sub *r6, *r5
+L141: bne *r4
+prn *r3
+cmp #127, *r7
+bne *r2
+bne X2
+jmp *r1
+add L166, r3
+dec *r4
+prn L256
+L142: .string "hm"
+jmp L247
+sub *r1, X22
+rts
+jmp L249
+mov #-212, *r7
+; comment
+rts
+stop
+L143: .string "rt"
+stop
+rts
+jsr *r5
+prn *r1
+sub r3, r5
+cmp *r6, *r2
+sub L236, X10
+rts
+not *r6
+jmp *r0
+bne X21
+L144: .data -516, -749, -262, 766
+L145: .string "hrnet"
+; comment
+not r0
+add r3, *r1
+L146: not r2
+prn *r0
+clr *r7
+rts
+L147: .string "ptktspibzeyktpbw"
+clr L63
+stop
+stop
+bne L118
+L148: .string "xojdrienchmnegkhve"
+prn #-23
+; comment
+L149: jmp X24
+L150: red X10
+inc X8
+add *r2, X9
+L151: cmp #-245, r5
+red r7
+stop
+clr *r3
+lea L215, *r3
+stop
+add r1, r2
+dec L122
+L152: .string "zbbayoaxjiferglwo"
+jmp L232
+dec r3
+
+L153: add #188, *r7
+clr r2
+rts
+L154: inc L94
+mov r0, X1
+clr r7
+jsr *r2
+clr r4
+not X18
+not L224
+clr X21
+prn L163
+L155: .data 265, 19, -42, -406, 466, 510, 108
+L156: prn *r1
+red r3
+L157: stop
+not *r1
+inc *r5
+L158: inc *r1
+dec r0
+mov #253, *r2
+prn L208
+add *r7, *r0
+L159: .data 38, -911
+L160: rts
+L161: .string "obttexchiywl"
+
+jmp X19
+add L70, *r2
+sub *r0, r5
+add *r2, r6
+rts
+clr *r0
+
+bne L126
+not X20
+
+L162: .data 669, 972, -833, -275, 517, -381
+not *r5
+red *r5
+clr *r6
+jmp *r7
+bne L139
+L163: not r1
+mov r5, *r2
+mov L257, *r1
+bne L75
+not X4
+
+bne X18
+L164: inc L227
+sub X8, r3
+lea L124, r4
+inc r6
+L165: sub #131, *r3
+mov L39, L200
+red X5
+mov #-78, L224
+prn *r4
+
+jsr X21
+cmp *r0, L234
+L166: .data 757, 204, 599, -786, -222, 573, 110, 416
+L167: jmp *r2
+not L43
+rts
+L168: .data -526, -395, -548, 580, 161, -548, -403
+L169: jsr *r1
+L170: .data -310, 304, 546
+L171: .data 680, -835
+bne L242
+L172: .data -460, -707, -973, -93, 912, 609
+bne *r6
+; comment
+stop
+red X2
+L173: not r0
+prn X0
+rts
+jmp L55
+stop
+clr r0
+clr r1
+jsr *r5
+L174: .string "atbzliwejadflctacfxf"
+prn *r6
+; comment
+clr r4
+dec *r7
+red r6
+L175: bne L77
+inc r5
+red *r0
+bne L54
+prn X20
+mov r1, *r2
+lea L163, r2
+add *r0, *r7
+inc *r5
+not *r3
+dec L256
+L176: jmp L75
+cmp X2, #3
+sub X2, *r3
+not X5
+dec *r3
+cmp r3, r2
+bne L107
+L177: .data 641, 336, 970, 815
+L178: jmp L146
+clr *r4
+bne L238
+L179: jmp *r4
+rts
+inc X24
+clr L112
+L180: .data -1, -181
+rts
+jmp *r3
+
+L181: .string "kzsybtrsf"
+add L198, r2
+L182: add L149, X17
+bne *r1
+add r2, r2
+sub #2, X8
+L183: .data 16, 153, -389, 554, -727
+; comment
+L184: cmp r7, r6
+L185: .string "bemtzaoozl"
+jsr *r0
+L186: red *r3
+bne *r3
+L187: prn L228
+L188: bne *r7
+sub r2, r3
+jmp *r1
+L189: prn *r4
+; comment
+mov #94, r0
+L190: dec L94
+L191: rts
+red X3
+bne *r1
+jmp *r1
+sub #-123, L243
+; comment
+stop
+not *r5
+bne *r5
+L192: .string "aldsouhfwnxrjru"
+add *r1, r4
+bne L236
+jmp *r1
+lea X22, X18
+not X18
+cmp L165, *r2
+mov r4, r7
+clr r0
+jsr *r2
+cmp #-197, r3
+L193: .string "pqr"
+red *r6
+bne *r3
+bne L113
+inc X13
+add X18, r0
+cmp #-204, *r7
+red *r1
+L194: .data -861, -258, 484, 352
+red L220
+prn L179
+clr r6
+prn *r7
+not *r6
+jsr *r6
+L195: sub *r2, L232
+sub *r7, r0
+L196: lea X2, X5
+L197: lea X16, *r7
+L198: sub r2, *r6
+cmp #-181, #113
+L199: bne *r7
+bne *r5
+L200: clr L210
+bne *r7
+L201: .data 268, 211, 504, 912, -523, -771, -507
+lea X7, *r7
+dec r4
+cmp r2, *r3
+L202: stop
+L203: .string "fx"
+stop
+add X21, r6
+cmp r3, #-172
+rts
+
+L204: mov #-186, *r6
+L205: dec r1
+L206: .data -974, -337, 695, 899
+inc r3
+jmp *r6
+; comment
+red r7
+sub L245, r5
+add *r7, *r1
+L207: .data -138, 24, -263, 827, 38
+mov *r5, L235
+L208: .data -372, 726, -552
+L209: lea L251, *r2
+L210: rts
+rts
+red r1
+L211: clr X13
+lea X18, X24
+mov L232, r0
+red r5
+sub #-212, *r4
+
+mov r6, r6
+mov L177, *r1
+mov #-64, X0
+add r1, X18
+inc L241
+jmp *r3
+lea L18, r4
+add *r6, L225
+L212: mov X0, L240
+clr X15
+add X3, X16
+lea X4, r3
+L213: .data 767, 841, -513, 331, 619, -904, -799
+dec r5
+add r0, *r7
+jsr *r7
+L214: clr *r5
+sub L165, *r4
+L215: add r6, X4
+clr r7
+L216: .string "obvuzf"
+L217: add X7, *r6
+bne *r2
+jsr *r6
+mov L223, X17
+mov #-8, *r5
+L218: .string "tfarjkamrtvhpbrlvb"
+L219: cmp #69, #140
+not L233
+L220: .data 193, -342, 479, 804, 773, 392, -807, -851
+bne *r7
+clr L58
+cmp *r6, *r6
+prn *r0
+cmp #163, X21
+add r1, X11
+stop
+dec *r6
+dec r4
+inc r1
+jsr *r0
+lea X9, r4
+jsr L145
+mov r0, r5
+prn L224
+inc *r1
+inc r4
+L221: .string "xrmqbdhdqn"
+stop
+L222: .string "zjrcwbjwmiixluknqcujctd"
+L223: clr L236
+L224: .string "jobjybvbmwemyqcjyt"
+add #-117, r2
+stop
+prn #-162
+stop
+inc *r0
+bne L258
+not L183
+sub r2, X5
+L225: stop
+jmp *r3
+prn L127
+not *r6
+red r5
+not r7
+L226: .data -782, -786, 889, 658, 921, -423, 402, -156
+L227: lea X3, r4
+add r7, L228
+L228: jmp *r4
+red *r2
+red r0
+clr *r1
+cmp *r1, *r1
+jsr X15
+add #-134, X21
+add #38, *r1
+L229: prn #-164
+; comment
+jmp X1
+L230: .string "vlzwtrreppfsivvr"
+cmp L2, #-125
+red *r7
+stop
+dec r3
+L231: bne *r6
+L232: .string "nguzbr"
+lea L247, X11
+L233: jsr X5
+L234: .data -997, 567, -733, 230, -991, -371, -646, 759
+L235: .string "pbfpffss"
+jsr X2
+rts
+cmp #129, *r2
+dec *r5
+jsr *r3
+L236: jsr L137
+L237: red *r4
+L238: jmp L258
+mov *r1, r7
+; comment
+jmp X16
+jmp *r2
+cmp X4, #222
+L239: bne *r6
+L240: not r2
+mov r2, r3
+add #-198, L195
+inc X24
+L241: .string "xsqrfrdecxmrjkxclaqugnsz"
+jmp X20
+jsr *r6
+dec *r4
+L242: add *r4, L251
+clr *r7
+L243: bne *r3
+lea L18, r3
+not r2
+lea X8, L235
+L244: .data 601
+L245: .string "pnbxyafgzvfk"
+L246: dec r1
+rts
+red *r1
+L247: sub r4, X4
+clr *r5
+sub #-202, r1
+not r2
+clr r3
+cmp r7, L11
+clr *r0
+lea L253, L255
+
+red *r6
+lea X21, r4
+rts
+bne *r1
+jmp *r2
+dec *r2
+prn L56
+L248: bne *r0
+
+; comment
+mov L62, r1
+sub #-212, r6
+red r5
+sub L250, *r1
+dec r5
+L249: inc *r0
+cmp *r6, #-69
+not L256
+sub X23, r4
+L250: dec X24
+rts
+prn *r7
+prn *r6
+dec L257
+not *r7
+L251: red *r5
+L252: .string "yksldatxatuvwbe"
+sub r4, L260
+jsr X9
+prn #45
+jmp *r6
+add X0, *r2
+jsr *r6
+L253: mov L260, L192
+not L236
+L254: .data 638, -404, -318, -436, 666, -489, 426
+lea L61, L187
+L255: .data 232, -44, 813, 591, -459, 148, 752
+lea X17, r2
+prn *r6
+cmp #-87, #241
+; comment
+sub r4, r3
+mov r6, r4
+L256: .string "kmwryrunuhgchy"
+L257: cmp *r7, X6
+bne *r0
+lea X9, X12
+mov *r1, *r3
+L258: .data 370, 676, -461, -919, 224, -438
+red X17
+mov #94, *r4
+jmp *r4
+add *r5, r2
+lea L167, *r3
+bne *r1
+rts
+jsr *r2
+L259: stop
+lea L145, X6
+L260: inc X18
+stop
+lea L129, r6
+stop
@@ -0,0 +1,1045 @@
+; Generated by genCorpus --seed 38
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+L0: .string "ecpklftkwsooqz"
+mov L145, X21
+L1: .string "mecmpuoygzjzwvreafyp"
+lea X21, X14
+dec *r4
+stop
+L2: .string "kyikfsklcniki"
+cmp #-167, #20
+jmp L18
+jsr L1
+L3: .string "qvswgmabsddcqaiugu"
+mov #213, *r6
+dec *r4
+L4: jsr *r6
+not r6
+L5: jsr *r6
+clr X9
+prn #-16
+red X8
+dec *r3
+L6: .string "j"
+clr L6
+inc *r7
+lea L184, r4
+L7: .string "fuuyodgtgxkxidh"
+L8: rts
+mov r1, X16
+L9: .string "avdrvaehtvrum"
+mov r3, r5
+add r2, *r0
+jmp *r2
+bne *r6
+cmp r1, r2
+mov r5, r2
+L10: bne X7
+clr X7
+jmp *r2
+L11: red r7
+red L174
+
+jmp X9
+red r7
+; comment
+prn #57
+not *r1
+stop
+clr *r5
+inc r1
+L12: jmp *r5
+L13: mov L8, *r0
+bne L272
+L14: lea L223, X4
+L15: .string "yvibkpsjclfwqsijfjvjwmh"
+rts
+; comment
+red X3
+dec L14
+rts
+not r7
+L16: jsr *r7
+jsr *r1
+add L67, X14
+sub #-200, L274
+sub L13, L139
+L17: rts
+
+lea X5, *r2
+sub *r3, *r1
+sub X0, L15
+stop
+L18: mov #-236, L5
+bne L170
+rts
+red r7
+rts
+dec *r2
+clr X6
+inc r7
+add L63, r2
+lea L12, r7
+add *r2, *r0
+jmp *r6
+jmp X8
+lea L242, L166
+prn r2
+not X7
+L19: cmp *r5, *r0
+sub #179, X23
+clr *r0
+dec r6
+L20: bne *r5
+not r5
+; comment
+L21: bne *r1
+L22: inc *r6
+rts
+L23: .string "lg"
+inc L243
+lea L8, r2
+not X14
+L24: mov X21, r4
+not r5
+prn #-123
+not r3
+prn L118
+mov r1, *r0
+L25: .data -243, -212, -699
+jsr L270
+L26: rts
+L27: mov r7, L21
+not *r5
+; comment
+L28: .data -314, 516, -725, 164, -122, 268
+L29: jsr L26
+lea X21, *r4
+rts
+add #-176, r3
+L30: inc *r3
+L31: red r2
+add r1, r3
+inc *r5
+mov L25, L1
+mov *r7, *r6
+stop
+mov *r7, X18
+sub *r1, r2
+bne *r5
+prn #-56
+L32: not *r3
+sub #63, X11
+L33: .string "rbvcvgdvkxntvdrmmfw"
+prn L31
+not L13
+red r4
+not r0
+dec *r5
+stop
+stop
+L34: cmp #-29, r3
+L35: .string "cydnhxjtcjdlzkg"
+bne *r4
+L36: prn r1
+not *r6
+not *r6
+L37: bne L78
+not X5
+sub #55, r4
+jsr *r4
+L38: bne *r7
+jsr X15
+red *r4
+L39: jmp *r5
+mov *r1, r7
+rts
+inc *r2
+L40: sub #-32, r1
+mov *r3, L236
+
+L41: clr *r7
+prn #-85
+jsr X7
+L42: prn r5
+clr *r6
+clr *r5
+red r2
+L43: sub L0, r5
+lea X18, r7
+red L1
+L44: jsr L38
+L45: jmp X8
+rts
+L46: .string "bllohpkgeivttexxdg"
+lea L219, r0
+inc *r0
+lea L17, r5
+add #180, *r0
+jsr *r0
+mov *r4, r2
+cmp #250, #-147
+red r1
+rts
+L47: clr X12
+
+mov r6, r0
+L48: rts
+jsr X24
+not r3
+jmp *r2
+not *r2
+
+add *r2, L262
+add r0, *r4
+inc *r7
+not r1
+prn L29
+sub #43, *r6
+L49: cmp X15, *r1
+add *r5, r5
+cmp X5, #-78
+jsr *r3
+rts
+prn L104
+prn r7
+prn *r5
+rts
+L50: stop
+L51: .string "jbut"
+L52: .string "ywhovxhjeqtrvosgrbj"
+L53: not r3
+L54: clr X12
+clr *r4
+L55: .string "cuoztzirnujetdsupajnuh"
+lea L60, L34
+L56: .data -650, -929, -543, -202, -204, 874, 958, 238
+sub #132, *r2
+
+not X20
+prn r1
+stop
+L57: prn #-156
+L58: not r6
+inc X5
+red X24
+bne X4
+L59: not *r4
+L60: .string "eunvqckztmoyjjaswxk"
+prn #-46
+jsr L92
+L61: .string "vxbraiobuade"
+L62: cmp L33, *r6
+clr r7
+L63: .string "fyyqqulwvewvqmne"
+bne L48
+not X20
+prn #190
+L64: add #90, *r7
+lea X23, *r1
+rts
+prn #-139
+inc *r2
+L65: jsr *r5
+sub *r5, r0
+stop
+prn r4
+lea L70, *r7
+rts
+add *r4, r2
+clr L136
+inc *r7
+L66: .string "yfjbcpfch"
+
+add r2, X15
+; comment
+L67: jmp *r6
+lea L36, *r1
+bne *r0
+L68: sub *r0, r6
+cmp #63, *r3
+not *r3
+bne L14
+sub *r6, r4
+
+inc r2
+add *r6, *r5
+clr X14
+cmp r4, *r2
+L69: inc r7
+jmp *r2
+cmp *r2, *r7
+bne L232
+mov *r4, *r1
+red *r6
+dec X6
+L70: dec *r0
+lea L15, L9
+bne *r4
+red L9
+L71: dec X6
+red L264
+clr L6
+L72: cmp #82, L53
+prn *r3
+add L50, r4
+; comment
+L73: jsr L90
+add #141, X8
+L74: .string "sfvmtazprpui"
+L75: .data -942, 502, -155
+L76: jsr X17
+not *r0
+L77: .data -614, -267, 134, 554, 868, 716
+jmp X22
+clr *r4
+jsr *r2
+red r5
+L78: rts
+lea L32, X24
+L79: bne *r4
+red L74
+L80: .string "jhcwwihad"
+add r0, r0
+jsr X1
+clr X2
+jsr L23
+L81: clr *r7
+inc L23
+jmp L235
+clr X16
+cmp X0, X10
+L82: dec *r7
+prn X6
+not *r7
+stop
+bne L47
+mov X17, *r4
+bne *r6
+L83: sub r3, X16
+bne *r0
+cmp *r6, L19
+; comment
+bne *r3
+L84: .data -109
+L85: .string "gsolkdxnbyhq"
+bne *r0
+mov *r6, X13
+L86: .string "cyqyaznueexig"
+inc r2
+L87: .data -974, 309
+prn L48
+jmp L103
+rts
+inc *r4
+L88: cmp *r7, *r1
+lea L29, *r2
+cmp X20, #90
+sub r1, r3
+lea L247, *r7
+red *r2
+prn r4
+L89: .string "ukcndmubj"
+red L135
+inc r3
+jmp X11
+bne L67
+; comment
+L90: prn *r3
+inc *r0
+L91: .data -425, -741, -329, 306, 518
+L92: red *r5
+red *r6
+L93: jsr *r3
+
+L94: cmp L159, r5
+mov r7, *r4
+jmp *r5
+inc r3
+clr *r1
+prn r6
+L95: .string "ujgcqickjjawlzncs"
+; comment
+jmp X21
+
+mov L103, r5
+cmp #98, *r1
+prn L246
+mov L48, *r4
+mov r1, *r4
+add #35, *r5
+clr *r1
+sub r1, r3
+dec r4
+cmp *r0, *r1
+lea L69, L210
+cmp #202, *r3
+mov r1, r2
+sub *r1, L20
+add *r0, r0
+bne *r7
+sub #-17, *r4
+mov X7, r1
+L96: .data -104
+add #135, *r5
+bne X7
+L97: jmp X10
+sub L62, r7
+dec L227
+cmp #-26, r4
+jsr L98
+bne *r5
+L98: .data -876, -373
+mov #-78, *r5
+L99: .string "xnort"
+L100: add r7, r6
+L101: .string "uvmfdkzqrodahrmsbaf"
+not *r0
+cmp L137, L136
+inc L195
+sub r1, L101
+lea X8, *r3
+L102: inc X24
+not r7
+clr *r7
+stop
+stop
+L103: sub *r0, L34
+red *r5
+inc L237
+L104: red *r6
+not r3
+L105: red *r3
+; comment
+clr L112
+red r2
+L106: bne L200
+dec X24
+L107: rts
+rts
+L108: stop
+L109: add *r2, r4
+L110: .data -132, 454, 16, 885, -367, 21, 664
+L111: .data 778
+lea X2, r0
+sub *r0, X13
+stop
+L112: .data -372
+red X6
+jsr L177
+L113: .data 25, -102
+rts
+sub #-78, r3
+jmp X17
+clr X7
+L114: .data 12, -659, 759
+cmp #46, *r1
+L115: bne L136
+bne X3
+L116: mov *r4, r2
+L117: add #-17, *r4
+jmp *r1
+lea X20, *r7
+L118: dec *r5
+prn *r5
+rts
+; comment
+L119: .string "dbwkvira"
+clr *r7
+cmp r5, r0
+add #200, *r6
+not L79
+L120: cmp #172, L65
+L121: .string "hwgdcdhnrrpx"
+inc r0
+jsr L35
+prn L161
+not r7
+bne *r2
+stop
+jsr X18
+L122: sub L144, *r2
+L123: jmp L239
+stop
+prn r3
+add r6, r5
+red X23
+rts
+stop
+inc r0
+red X14
+L124: jsr L110
+L125: rts
+inc *r0
+jmp *r4
+inc L55
+prn *r3
+jmp L258
+L126: .data 501
+L127: .data 924, 726, -759, -412
+prn X13
+cmp #-9, L116
+L128: clr X7
+L129: cmp #-234, *r7
+L130: prn r5
+mov L40, L122
+
+L131: .string "xdrfkghtsscmxbvlrqomvxh"
+L132: .data 408
+lea L154, *r0
+cmp r5, X11
+L133: red *r3
+; comment
+
+rts
+L134: stop
+inc r6
+rts
+add r2, r6
+L135: jsr X23
+inc X12
+jmp L58
+bne *r4
+jmp X23
+lea X4, r7
+jmp L16
+sub #-151, *r4
+add *r5, *r7
+L136: prn r6
+inc r2
+inc *r4
+inc r7
+not L170
+stop
+L137: jmp *r1
+dec r0
+L138: add r7, r5
+L139: rts
+L140: dec L237
+L141: .string "jqasignddqrggluxwyufs"
+bne *r3
+L142: .string "c"
+prn r6
+dec r4
+jsr L199
+red *r2
+inc *r2
+prn #168
+L143: .data 85, 574
+bne *r1
+L144: .string "tzctdyefavgbkqx"
+rts
+L145: .string "yfksnplghgaraxhyjktvpy"
+bne *r0
+L146: dec X3
+jsr *r5
+stop
+L147: stop
+add X9, *r5
+inc *r6
+L148: add L93, *r1
+clr r6
+jmp *r6
+L149: prn r6
+dec *r5
+lea X7, r1
+cmp X2, L95
+dec *r1
+jmp X10
+not X14
+L150: .data 783, -88, 571, -578
+; comment
+red r2
+inc *r0
+stop
+prn #102
+L151: .string "eaemmrtbkorsbqzvq"
+L152: sub r3, *r1
+red X7
+; comment
+mov X8, L66
+prn X14
+L153: jsr *r2
+stop
+add #132, X2
+red r5
+stop
+L154: stop
+clr L211
+L155: jmp *r1
+prn r6
+jmp *r2
+L156: mov X7, r6
+L157: mov *r5, L166
+L158: jsr *r1
+red *r3
+lea L175, r3
+add #78, *r4
+jsr *r0
+stop
+dec *r7
+L159: sub X6, *r2
+sub r7, r3
+add #115, L233
+bne *r0
+cmp *r5, *r3
+bne *r4
+add r7, *r2
+mov #199, r4
+clr *r4
+bne L226
+dec X13
+L160: .string "ypvx"
+cmp #-74, #222
+bne *r2
+bne X21
+bne L105
+add #-235, L22
+mov #-150, *r0
+jmp *r1
+
+bne *r0
+; comment
+L161: .data 33, 889
+red L118
+not *r7
+L162: stop
+L163: .string "uftnievhpgtw"
+rts
+inc *r6
+L164: .string "irjqdlavkvazevchhycwnax"
+stop
+inc *r6
+L165: .data -685, 574
+mov L79, *r4
+L166: jsr *r5
+jmp *r7
+jmp *r4
+dec r1
+cmp r5, #-80
+jmp L30
+sub r7, r7
+red X1
+inc L113
+jmp L140
+inc *r3
+not *r1
+inc r0
+L167: not L170
+L168: jsr *r1
+L169: .data 918, -392, -716
+dec *r7
+L170: red L100
+not r1
+L171: red *r1
+L172: inc r4
+mov *r7, *r5
+clr r0
+L173: add #229, r5
+lea L243, X21
+add X18, r4
+clr r7
+cmp X9, #36
+jsr L202
+jmp *r1
+jsr *r6
+L174: red X19
+stop
+add r4, r5
+L175: .data -95, -474, -150, 990, 63, -25, -4, 270
+L176: lea L141, X23
+red *r7
+jsr *r2
+L177: mov *r6, L219
+lea X4, L273
+cmp #-213, *r5
+
+
+L178: jmp X23
+lea X21, r5
+jmp L240
+mov r5, X11
+rts
+L179: clr X3
+inc r2
+sub #215, *r5
+L180: mov #213, r4
+L181: .data -753, 643, 258, 10, -357, -972, -998
+L182: add r1, L78
+
+L183: .data -202, 415, -80, 685, 106, 660, -550, 177
+inc *r0
+clr *r2
+L184: prn *r6
+L185: .data -852, -451, 691, 877
+L186: rts
+jsr L57
+jsr X14
+rts
+L187: .string "eb"
+jmp *r6
+clr *r7
+clr *r3
+jsr X19
+L188: stop
+jsr L230
+red L91
+prn *r2
+L189: cmp X11, L273
+L190: red L183
+bne *r5
+prn X19
+red r7
+
+inc X5
+mov *r0, r6
+sub *r6, r5
+mov X8, L73
+lea X3, L260
+sub #111, X12
+add r0, *r0
+; comment
+prn *r2
+jsr *r0
+bne *r0
+stop
+L191: prn *r3
+rts
+clr r0
+stop
+L192: red X7
+bne X1
+not *r0
+inc L234
+not X13
+jmp *r0
+sub *r1, *r1
+stop
+lea L234, r1
+add r6, r2
+L193: .string "idxhcobjkhflmhgpox"
+L194: jmp *r6
+L195: .string "vqqqxuuafppia"
+add r5, L78
+prn *r2
+L196: .data 739, 478, -568
+inc r7
+prn #247
+L197: prn L138
+bne *r5
+L198: .data 629, 341, -964, -800, 306
+not *r4
+red L250
+rts
+L199: stop
+add #-175, *r4
+inc L275
+clr r4
+sub *r6, *r7
+L200: .data -94, -325, -760, -942, 408
+not *r4
+inc L228
+red L214
+L201: add #-155, X17
+L202: lea X6, *r0
+stop
+L203: prn *r4
+stop
+L204: inc r0
+not *r3
+L205: cmp #204, #-234
+jmp X3
+inc r1
+clr L157
+cmp r2, r3
+rts
+L206: jmp *r1
+clr r4
+L207: .string "pvfeaqrvxjugefuf"
+add *r3, r6
+bne L78
+L208: add L176, *r7
+mov #26, L264
+cmp r6, *r6
+jsr X24
+bne *r1
+cmp L42, X21
+L209: .string "nrcfyifahargoluconqpgyq"
+sub X4, *r2
+L210: .string "gcdsczfjkcep"
+sub L29, *r3
+; comment
+clr *r6
+dec X15
+lea L154, r7
+lea L226, X8
+clr r7
+dec X9
+stop
+jmp *r3
+L211: mov *r5, r5
+clr r4
+jmp L177
+mov X23, *r5
+prn *r4
+stop
+stop
+rts
+jmp L26
+L212: inc *r2
+L213: .data -303, 728, -230, -833, 531, -140
+prn r4
+add r1, X15
+bne L205
+sub *r5, *r4
+L214: .string "m"
+cmp r5, X12
+L215: not X7
+L216: rts
+cmp X19, L254
+prn #84
+L217: .data -71, 506, -363, 287, 532, -583
+red r3
+stop
+jmp L168
+clr X21
+stop
+bne X2
+add L77, X24
+L218: clr *r4
+inc L263
+L219: lea L217, *r4
+clr *r4
+mov *r4, *r2
+mov *r2, *r3
+inc r6
+L220: cmp *r4, X6
+clr *r3
+not r4
+clr X0
+stop
+sub *r1, r0
+; comment
+not L269
+jmp *r0
+bne *r0
+L221: sub #6, r3
+red L105
+add r1, L142
+red *r6
+red r1
+; comment
+L222: .string "zxmdcwe"
+bne *r3
+rts
+clr r4
+jmp L108
+not X23
+sub r3, L80
+L223: .data -665, -102, 988
+L224: lea L271, L175
+bne *r0
+L225: red *r4
+rts
+cmp #-41, L67
+jmp L33
+dec r7
+rts
+inc *r3
+clr L212
+L226: .string "fm"
+L227: .data -126, -904, 261
+cmp L67, #68
+not *r1
+L228: red L214
+L229: .string "fmaxabmpwhpvkebrn"
+red r5
+lea X9, X10
+L230: jmp L203
+rts
+red *r5
+clr r0
+L231: red r2
+L232: .string "mdbqqv"
+red *r0
+bne X22
+L233: .data -956, -305
+rts
+rts
+L234: mov L78, X24
+; comment
+L235: not r0
+stop
+sub #147, r7
+L236: .string "cvxahmust"
+L237: not X12
+add #31, r3
+sub #-25, L233
+jsr L55
+L238: jmp *r4
+stop
+mov X11, *r7
+L239: bne *r2
+jmp L240
+add *r0, X7
+dec *r6
+add X19, r3
+L240: sub *r1, L107
+red *r2
+jmp L250
+bne *r1
+inc *r3
+L241: cmp #-93, *r2
+L242: clr *r3
+L243: .data 710, 848, 993, -346, -273, 198
+L244: inc L170
+bne *r0
+L245: jmp X4
+stop
+inc *r1
+; comment
+rts
+L246: bne X8
+bne X18
+prn r6
+L247: .string "huapvbypzkrw"
+L248: sub #143, r6
+L249: bne *r6
+L250: prn L263
+clr r6
+
+L251: prn L264
+cmp L255, *r7
+prn *r4
+add L106, r6
+L252: cmp #-209, L60
+clr r7
+bne L187
+rts
+inc *r4
+prn #182
+inc *r3
+sub r6, r1
+L253: not *r4
+stop
+L254: bne L85
+stop
+rts
+mov r7, L261
+clr L264
+L255: lea X18, r6
+L256: .string "lbizjineoqvtmr"
+jmp *r5
+L257: .string "dvytzko"
+bne *r0
+prn #236
+L258: lea L264, r7
+L259: dec L214
+bne *r6
+rts
+inc r7
+stop
+inc *r0
+jmp L35
+L260: .string "gdoarrgaktcvcaxhgetuasul"
+L261: inc L66
+jsr *r4
+L262: rts
+clr X22
+L263: stop
+clr r3
+cmp X12, #-108
+L264: .data -967, 292, -63, 806, -482, -852, -638, 12
+rts
+L265: .string "ssoz"
+L266: .string "x"
+dec *r5
+sub r1, X6
+L267: jmp *r5
+; comment
+lea L270, r4
+clr *r6
+cmp L25, *r4
+L268: lea L272, L11
+prn r0
+lea L270, *r5
+cmp *r7, r4
+not r3
+cmp X12, r7
+L269: .data -195, -317, -391, 983, 42
+cmp *r6, #243
+L270: not *r5
+not L40
+inc *r4
+
+sub #57, *r6
+not X11
+rts
+prn *r1
+rts
+jsr L177
+L271: rts
+sub L273, X4
+red *r4
+red r3
+bne X8
+jsr L274
+mov r1, *r0
+; comment
+sub *r0, r7
+lea X21, *r1
+L272: cmp *r3, #-234
+L273: mov #199, r3
+lea L275, *r4
+
+cmp #-108, L274
+L274: prn *r3
+
+L275: jmp *r1
+sub L33, *r0
+not *r3
+cmp r1, r7
+lea X11, L73
+stop
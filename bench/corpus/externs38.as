@@ -0,0 +1,1044 @@
+; Generated by genCorpus --seed 39
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+bne *r6
+red r7
+mov *r1, r5
+not L55
+sub r6, X20
+rts
+not L239
+stop
+add *r5, r4
+lea L134, r2
+bne L119
+stop
+dec r6
+add r7, r0
+dec r3
+cmp *r0, X23
+stop
+jsr X0
+add r6, *r4
+L0: inc r3
+prn #2
+add #-17, *r5
+L1: mov X5, *r2
+clr L0
+prn r7
+add r2, X24
+bne X7
+bne L1
+add r3, *r2
+clr L0
+
+bne *r7
+clr *r1
+stop
+dec r6
+lea L2, *r3
+mov #228, *r4
+inc *r6
+L2: .string "a"
+red r6
+stop
+not r3
+inc L253
+lea L2, L2
+jsr *r7
+inc L164
+prn L0
+L3: add L0, r1
+mov #-100, X0
+jsr X11
+L4: .string "zjyxtadrquwyfyidtmt"
+L5: bne X2
+add #-20, r3
+cmp #-150, #-20
+lea X12, *r1
+not L0
+rts
+stop
+L6: .data 929, -839, -440
+jmp *r7
+L7: cmp X9, *r3
+not r7
+L8: .string "iroqkgsqaqfgrpshksnkxgvv"
+L9: clr X18
+stop
+L10: rts
+L11: dec *r7
+prn L37
+L12: lea L211, *r2
+L13: prn r6
+not r3
+
+L14: inc *r4
+sub r4, *r0
+L15: stop
+L16: mov #217, r2
+lea L12, X9
+add #135, *r0
+not X5
+add #-115, L7
+mov #194, *r3
+jsr L10
+dec r7
+lea X19, *r0
+L17: dec r3
+jmp *r7
+mov #-53, L16
+red *r1
+L18: rts
+cmp #162, r6
+rts
+inc r7
+add L24, X17
+stop
+red L155
+bne L5
+L19: .string "hadzzn"
+lea L1, X8
+not *r1
+inc *r6
+jsr X18
+lea L17, *r2
+L20: bne *r4
+prn r1
+inc L198
+dec X7
+sub r6, r6
+lea L8, *r2
+lea L4, r0
+dec X16
+lea L39, L8
+L21: bne *r0
+L22: dec L9
+sub *r6, *r0
+not X22
+sub *r2, r6
+L23: .data 51, 79, 109, -425, -444, 145
+jmp X0
+L24: .data -916, 182, 240, -788
+not L6
+L25: dec X2
+L26: inc r0
+stop
+add #-147, X18
+L27: cmp #191, L19
+jmp L209
+jmp *r7
+; comment
+mov r2, r5
+inc *r1
+cmp r1, r2
+lea L80, *r1
+mov *r0, r6
+
+bne *r2
+L28: .string "d"
+clr *r5
+L29: add X4, *r4
+prn *r4
+red X19
+L30: dec *r6
+L31: inc r6
+L32: .string "i"
+sub X3, *r6
+dec *r6
+inc X18
+jsr *r3
+cmp *r6, r5
+L33: .data -623, 449
+rts
+inc X13
+prn r1
+inc r4
+L34: jmp X15
+L35: lea X6, r4
+jmp X3
+mov L55, r3
+prn #129
+stop
+rts
+red *r4
+L36: mov #70, r3
+stop
+
+prn *r2
+dec r4
+L37: .data 356, 475
+not X12
+add #-38, L1
+L38: .data -283, 445, -300, 996, -49, -315, 453
+mov r6, r6
+add X22, *r5
+inc r3
+rts
+sub r6, r4
+red *r1
+L39: .data -304, 795, -413, 865, 483, -9
+L40: lea X16, X17
+clr *r2
+inc L3
+jsr *r0
+L41: add X14, r7
+rts
+mov *r0, r6
+jmp *r0
+L42: mov #-55, *r2
+dec r2
+L43: jsr *r0
+rts
+lea L235, *r0
+jsr X18
+inc r0
+dec r4
+rts
+prn #-188
+cmp r5, X20
+jsr L36
+cmp X0, #-26
+cmp L151, #-12
+inc L182
+not X14
+L44: jsr L22
+L45: dec L182
+rts
+prn #71
+inc L28
+mov r7, X18
+rts
+jmp L72
+rts
+add *r4, X14
+jsr *r1
+jmp L202
+L46: red r1
+red r3
+dec L112
+; comment
+L47: mov X16, r6
+L48: jsr X12
+L49: .data 665, -836, -431, -201, -962, -441
+jsr L143
+stop
+rts
+L50: .string "ppozhed"
+L51: lea L97, *r7
+mov #227, *r4
+add L126, *r4
+jmp *r6
+not *r7
+L52: jsr L221
+red X20
+jsr L35
+
+clr *r5
+clr *r4
+L53: add #11, r0
+red X21
+prn r2
+inc r3
+L54: prn #30
+L55: .data 355, -854, 786, -656
+clr *r1
+red r6
+lea X19, *r1
+jsr X18
+red r2
+clr X15
+L56: red r1
+L57: lea L33, *r0
+mov X1, *r2
+rts
+L58: cmp #-215, X2
+sub #-78, r0
+sub L38, X0
+jsr L5
+prn *r5
+L59: stop
+clr r5
+red *r4
+red r6
+lea L233, *r5
+not r6
+add #-123, *r2
+rts
+L60: dec *r6
+jmp *r2
+lea X19, L32
+mov *r6, r4
+mov r2, r3
+L61: .string "mkyubttrvzrusj"
+L62: lea X9, L112
+L63: lea L156, r0
+L64: lea L124, r5
+mov L160, X21
+stop
+dec *r2
+L65: .string "fouugcgvsf"
+inc L246
+L66: bne X9
+L67: .data 589, -510, 793, -265, 183, 590
+inc r7
+clr r5
+mov r1, X22
+prn #9
+L68: not *r0
+
+L69: jmp L132
+L70: jsr L55
+L71: not r3
+inc *r0
+L72: red r5
+not *r7
+cmp #5, X3
+L73: mov X4, r3
+prn L6
+stop
+jmp L147
+inc r6
+dec r4
+L74: .data -398, -392, -21
+jmp *r0
+red *r7
+jmp *r7
+bne *r7
+bne L10
+mov r2, *r6
+jsr X22
+red r7
+rts
+L75: bne L72
+dec r5
+mov r6, r3
+mov #-226, *r3
+L76: add #-32, L16
+L77: rts
+jsr *r6
+L78: dec r3
+lea X5, *r7
+L79: mov L27, X4
+lea L73, L56
+stop
+clr *r0
+; comment
+sub *r0, L9
+clr X5
+dec L198
+bne L159
+L80: mov *r4, X7
+sub *r5, *r1
+rts
+mov *r6, r6
+stop
+prn *r5
+not X12
+mov L246, X16
+L81: lea X16, r1
+L82: .string "fgpyxplyhc"
+jmp *r0
+L83: rts
+stop
+sub r4, *r5
+L84: mov #214, *r0
+red *r5
+rts
+L85: jsr X12
+L86: cmp L257, r0
+; comment
+jmp *r5
+prn r2
+mov r6, r2
+
+mov r5, X13
+
+sub L64, r3
+add r0, r0
+lea X11, *r1
+L87: jsr L168
+sub *r3, r1
+clr r5
+jsr X13
+L88: sub r1, r2
+jsr *r4
+red r3
+L89: jsr L242
+dec r6
+cmp L112, r1
+jmp L43
+sub r7, r7
+stop
+dec *r3
+bne L58
+stop
+not *r5
+L90: red X21
+jmp L46
+bne X19
+prn *r0
+lea X18, *r5
+jsr X13
+sub r5, r3
+add *r7, r0
+; comment
+red X8
+dec r6
+not *r2
+bne *r4
+add *r1, r5
+L91: dec *r5
+clr X2
+L92: not *r0
+rts
+add r0, r6
+L93: clr r0
+dec *r7
+clr L133
+
+not *r7
+prn r0
+
+red *r6
+lea L95, L207
+sub #-220, X2
+rts
+L94: cmp #68, #-170
+prn *r1
+L95: lea L185, X8
+lea L182, L45
+dec *r2
+dec r4
+L96: lea L66, *r3
+mov r1, *r0
+jsr L64
+prn X4
+; comment
+jsr X4
+
+jmp L192
+rts
+L97: prn *r7
+L98: .string "ifevwxaacnyrprtbfoue"
+clr L27
+rts
+stop
+L99: .data 807
+L100: jmp X6
+stop
+dec L38
+L101: mov *r6, *r5
+prn *r3
+L102: stop
+sub *r0, r0
+stop
+L103: jmp L164
+add r2, *r1
+jsr L81
+add #72, *r3
+L104: .string "rpyorybiewfjzthfnxy"
+L105: not *r3
+L106: cmp #99, r2
+L107: add X10, L102
+L108: .string "shpnla"
+L109: .string "cuuivklj"
+mov #-76, *r4
+cmp *r5, *r5
+clr L136
+stop
+stop
+clr L147
+L110: sub *r1, X22
+lea L171, r7
+stop
+L111: prn r0
+L112: prn #-125
+L113: lea L204, *r0
+not *r2
+jmp *r0
+dec *r2
+L114: jsr L57
+inc r2
+L115: red X8
+mov X14, *r1
+L116: jsr L164
+L117: .string "zvycnzruqhufza"
+lea X18, X21
+add *r4, L153
+sub X5, X11
+lea L34, r6
+cmp *r7, L46
+L118: mov #-143, r4
+sub r6, X8
+lea L133, *r3
+red X8
+bne L24
+prn L45
+L119: .data 963, -226, -521, -168, -601, 445
+L120: jmp L254
+jsr *r6
+; comment
+L121: .string "epyudw"
+L122: .data 614, -461, -60, -95, 148, 339
+jsr *r5
+red r4
+lea X23, *r6
+prn *r2
+clr r5
+lea L9, r7
+L123: red r4
+lea L210, X14
+stop
+mov r6, *r2
+L124: jmp *r1
+rts
+rts
+add *r2, r1
+L125: .string "pjuwiq"
+dec r6
+cmp r5, r7
+
+clr *r4
+L126: .data -749, -144, 362, 418, -837
+rts
+L127: clr r7
+L128: red r2
+lea X19, *r7
+inc *r6
+jmp *r3
+add r2, X19
+L129: mov r7, r2
+
+cmp r4, *r6
+L130: lea L229, *r4
+dec *r0
+L131: jmp L53
+L132: add r7, L222
+L133: jmp L251
+L134: .data -603
+L135: .data 260, 626, 141, -515, 153, 830, -547
+dec *r0
+clr L13
+; comment
+L136: .data -820, 989, -977, 396, 719, -747
+red *r6
+; comment
+rts
+; comment
+cmp #-105, #24
+not r2
+lea L256, r1
+bne *r2
+L137: bne *r6
+dec r1
+L138: .string "vhpbcrvoxdgclbobiiimek"
+prn r3
+L139: add r1, L72
+add #99, *r1
+prn X13
+cmp L165, r5
+L140: .data -106, -351, 491, -168, -437
+add *r2, r6
+bne X20
+prn #-196
+L141: jmp *r3
+L142: .data -849, -34, 49
+sub r0, *r6
+L143: cmp L157, #168
+lea L109, r7
+L144: mov #92, r3
+mov r6, r2
+rts
+L145: inc L96
+dec X23
+stop
+prn #249
+stop
+mov L262, *r1
+bne X9
+not r5
+clr r6
+L146: .data -732, -959, -418
+L147: .data 330, -83, -602
+not r3
+not *r4
+jsr L43
+L148: rts
+mov L95, r2
+cmp r2, #-105
+; comment
+stop
+cmp *r2, *r0
+rts
+clr r5
+clr L157
+L149: .string "alvfsqrypznypjrmyszh"
+rts
+L150: .string "ysqdbqjf"
+bne X14
+bne L252
+L151: .string "vhj"
+bne *r0
+; comment
+red L171
+L152: .data -122, 700, 64, -527, 596, -869
+L153: .data 634, 366, 610
+mov #110, r5
+inc r1
+L154: red X23
+bne L9
+
+rts
+prn #111
+dec *r0
+L155: cmp X20, r3
+sub #20, *r1
+jsr L136
+not *r3
+L156: .data -903, 338, 414
+L157: lea X18, *r6
+dec *r6
+prn #-212
+dec r7
+L158: .data -525, 60, 545, -189, 625, 34, -667, 85
+L159: stop
+jsr *r2
+mov #186, *r3
+red L240
+not *r1
+sub #108, *r3
+clr X23
+sub L258, *r5
+L160: clr r6
+L161: prn L175
+L162: rts
+L163: .string "yngtflq"
+prn *r7
+jmp *r1
+lea L141, r4
+jsr L182
+L164: jsr L196
+rts
+L165: add *r7, r0
+prn *r6
+; comment
+L166: cmp r7, L7
+L167: bne L144
+sub *r7, X8
+mov *r2, *r7
+rts
+cmp X8, L260
+mov #47, r4
+
+
+not X9
+L168: stop
+L169: dec X5
+dec r1
+rts
+sub X8, X4
+inc X8
+jmp *r0
+cmp *r6, #161
+bne *r5
+L170: mov L122, *r1
+rts
+red r5
+; comment
+
+jsr *r5
+L171: cmp #-204, r4
+inc *r2
+jsr *r3
+mov #224, r2
+L172: rts
+jsr *r2
+prn *r0
+clr L239
+jsr *r3
+L173: jsr *r4
+sub *r2, *r0
+cmp #18, *r7
+add X4, L237
+bne X16
+jmp *r5
+clr *r6
+; comment
+add L39, *r3
+red *r3
+L174: .string "ktakywhpuooqavjxhllsuk"
+clr r5
+dec X11
+cmp *r6, r2
+L175: .string "cvvtukxrjgyhejwijpn"
+clr r5
+rts
+jsr L97
+; comment
+prn X0
+bne L69
+; comment
+red *r6
+L176: .data -837, 457, -137
+red *r2
+clr *r7
+L177: add r0, L262
+jmp L51
+rts
+jmp *r0
+lea L260, L62
+bne X14
+not *r7
+clr r3
+not *r1
+not *r1
+L178: inc L14
+inc *r3
+jmp L169
+prn r7
+lea L245, r5
+prn *r7
+L179: .data 744, 529, 256, 710, 582
+clr *r0
+lea L194, r6
+stop
+add r0, *r6
+prn #-52
+L180: .string "qstcvxkkzospbfonxzr"
+L181: stop
+sub X3, L221
+L182: .data 302, -596, 718, -364, -803, -981, 877
+L183: jmp L73
+red *r7
+L184: clr L168
+jsr X14
+sub *r7, X15
+red L245
+inc r5
+mov #-16, *r7
+L185: .string "nwhyvwr"
+clr X9
+L186: stop
+L187: add L255, *r6
+
+sub *r1, r2
+sub r6, *r3
+
+
+L188: .string "ntfhqdwjmazgchwelnorg"
+rts
+L189: bne *r0
+prn L188
+rts
+stop
+L190: .data -881, -75, 488, -316
+cmp *r7, *r6
+jmp *r6
+L191: stop
+lea L251, r0
+mov #102, *r5
+L192: jmp *r7
+clr r1
+not *r6
+jsr L106
+prn L260
+mov r4, r1
+lea L195, *r5
+dec r3
+L193: cmp X12, r3
+L194: stop
+bne *r2
+mov *r1, X16
+prn r4
+dec L158
+red *r0
+L195: .data 157, 601, -626, -820
+inc L217
+cmp *r2, #147
+L196: cmp #-85, #-81
+mov r0, r3
+L197: jsr *r0
+stop
+prn #186
+jsr L220
+clr *r6
+jmp *r1
+red r5
+L198: dec L223
+bne *r7
+not r3
+L199: dec r0
+; comment
+L200: .string "grbzapwjftmaqyvphjsynhb"
+lea L22, *r0
+red X22
+L201: stop
+red r3
+dec r6
+clr *r7
+L202: .data -417, 825, -834, -291, -101, 717, -157
+stop
+L203: cmp X6, #122
+dec r2
+dec *r2
+prn #144
+dec *r2
+L204: jmp X9
+dec L233
+jsr L106
+dec X5
+not *r0
+jsr *r2
+L205: .string "drmndsjrv"
+prn L262
+red L247
+prn *r3
+prn #229
+inc *r4
+add *r7, *r0
+cmp X8, #-89
+bne *r0
+L206: add #251, *r2
+jsr *r3
+lea L248, L127
+L207: prn #-138
+mov L221, L254
+jmp *r6
+dec *r7
+sub r2, *r6
+not r7
+bne *r1
+clr *r1
+sub L119, r2
+L208: inc X22
+inc r4
+L209: .data 943, 314, 254, -967
+inc X14
+sub L212, X22
+cmp #99, *r7
+red X23
+L210: .string "uyrumkltvl"
+stop
+jmp X16
+inc r1
+lea X12, L212
+; comment
+L211: .data -57, 236, 271, 618, -251, -98, 530
+clr r3
+not X13
+dec L49
+mov #50, *r5
+lea X17, L100
+lea L174, X11
+
+not r3
+L212: add #211, r3
+L213: prn L226
+bne L60
+stop
+prn r1
+prn #250
+sub r6, X17
+lea X21, r5
+L214: dec *r5
+L215: .string "pzveicxxkbxeyae"
+cmp *r3, *r6
+clr r3
+L216: rts
+red *r4
+not r0
+bne L242
+rts
+inc L206
+sub r2, r6
+dec r5
+bne *r2
+red L181
+prn r3
+L217: .string "a"
+prn r3
+
+L218: jmp L261
+not *r5
+; comment
+
+prn *r1
+jsr L94
+cmp r7, r5
+cmp r4, #245
+add r0, *r0
+L219: .string "urjupwbdxscrgirhywsduo"
+sub r0, r5
+L220: rts
+L221: .string "xyajqwkgarj"
+bne L254
+
+L222: .data 438, 166, -874, 445
+L223: jsr X11
+inc *r3
+dec X4
+rts
+L224: rts
+inc X18
+L225: clr L22
+sub r3, *r5
+prn #-175
+rts
+L226: jmp *r7
+sub r6, *r4
+; comment
+L227: dec L53
+stop
+L228: not *r6
+red r6
+L229: not r6
+jmp L233
+cmp *r0, *r5
+bne L9
+L230: .string "wjjfhuhysotrohna"
+add r1, X5
+inc *r7
+bne X18
+clr L22
+prn X9
+jmp X13
+bne X5
+sub *r1, r5
+L231: not r4
+rts
+L232: .data 283, 62, 210, -570, -422, 635, 833, -101
+L233: sub L5, L236
+L234: .string "iages"
+L235: stop
+sub r2, X23
+not *r3
+lea L190, *r6
+rts
+jsr *r0
+clr r7
+stop
+sub r4, r2
+bne L43
+bne *r7
+; comment
+sub #233, r7
+cmp *r7, r0
+L236: lea L121, X13
+cmp L243, #127
+dec *r3
+stop
+sub r5, r4
+L237: lea L173, L100
+jsr L171
+L238: .string "ymdhrle"
+lea X17, r0
+bne L20
+L239: add #228, *r5
+inc r1
+stop
+L240: red *r6
+jsr X14
+L241: sub L257, X17
+red L262
+inc *r0
+jmp *r3
+add *r3, r3
+dec *r1
+mov *r6, r6
+red X19
+L242: dec L166
+L243: clr r4
+L244: .data -950, -624, 869, -929, 620, 844, -599
+stop
+dec *r0
+jmp X24
+L245: red L40
+jsr L7
+lea L242, r0
+mov r0, r7
+L246: rts
+L247: prn *r5
+L248: not r2
+L249: mov r0, X5
+L250: .data 553, 220, 739, 329, 485
+L251: red *r7
+L252: dec r6
+jsr L69
+; comment
+sub #75, r5
+prn *r6
+clr r5
+lea L260, L254
+jsr L146
+L253: jmp L132
+clr r0
+
+inc *r4
+add L262, X22
+L254: prn *r3
+mov X14, r0
+clr r0
+jmp X19
+jmp L6
+L255: .string "gmsfgh"
+L256: .data 322, 116, 751, -853, 108, -72, 669
+inc L259
+red L235
+L257: sub *r4, L121
+stop
+inc r0
+L258: inc *r5
+L259: cmp L229, #-224
+jsr L251
+cmp *r1, r2
+L260: .string "bcqvcy"
+L261: add *r5, *r5
+cmp r0, r5
+L262: add r6, X24
+stop
+bne *r1
+jsr *r4
+rts
+cmp #179, #-41
+stop
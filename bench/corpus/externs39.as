@@ -0,0 +1,1044 @@
+; Generated by genCorpus --seed 40
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+prn #86
+sub #-246, X17
+rts
+cmp *r0, #160
+dec *r6
+jsr *r1
+dec *r5
+prn *r4
+clr X21
+lea X10, r1
+prn #-241
+jmp X5
+inc *r6
+L0: dec *r4
+rts
+L1: .string "dxzbelbxxfwbbylaux"
+rts
+cmp L121, r5
+jmp *r5
+L2: prn L1
+jmp *r0
+L3: prn *r1
+red *r5
+L4: mov L4, L166
+not *r7
+L5: .data 139, 660, 876, -526, -383, -899
+clr L0
+red r7
+L6: lea X23, X16
+L7: clr L2
+cmp r3, #-183
+L8: add #-86, X23
+stop
+inc r4
+dec *r7
+bne X12
+clr *r6
+L9: .data -621
+jmp *r3
+clr *r7
+jsr L237
+prn *r6
+L10: sub r4, X13
+prn #154
+L11: .data 459, -537, 558, 769
+add X1, *r5
+
+L12: not *r6
+add *r3, L5
+cmp #-20, #-42
+L13: bne L236
+sub L196, *r5
+red *r0
+sub *r0, r7
+L14: .data -531, -697, 177, -454, 459
+; comment
+prn r6
+L15: .data -557, 618
+bne L8
+sub #-190, X7
+L16: red r6
+lea X24, r7
+jmp L229
+dec *r3
+L17: .data 199, -705, 763
+cmp L6, *r5
+mov L1, r7
+rts
+rts
+inc r7
+sub r1, L10
+L18: sub r1, *r5
+L19: sub #-7, X16
+L20: not *r6
+
+not *r7
+add *r1, *r3
+L21: .string "nnlfycrku"
+mov L54, L168
+prn r2
+L22: .string "fpmokkywnozvowiqxg"
+lea L194, *r6
+dec r3
+L23: prn #196
+prn L126
+mov #-4, X3
+L24: .data -445, 942, 870, 731, -449, -717, -728, 817
+bne *r3
+inc *r2
+L25: .data 702, 99, 407, 539
+jsr L6
+red L20
+mov #157, X20
+jsr *r5
+dec *r3
+inc *r4
+rts
+stop
+L26: red X16
+L27: .data 457, -947, 963, 575, 333
+mov L42, L202
+mov L139, *r1
+jmp *r7
+rts
+jmp L178
+clr *r5
+L28: sub #218, L98
+lea L131, r0
+jmp *r7
+jsr L189
+L29: rts
+jsr *r3
+L30: inc *r2
+L31: red L8
+lea L88, r1
+; comment
+L32: clr *r2
+rts
+dec r1
+L33: .data 186, 807, 697
+bne *r7
+L34: inc *r3
+inc *r7
+sub *r1, r4
+jmp L75
+jmp *r6
+add #15, r5
+clr r6
+jmp *r5
+sub #-125, *r5
+dec *r5
+L35: .data 165, 19, -151, 241, -157, -782
+clr r3
+red r2
+L36: .data 463, 133, -321, -762, 96, 732, 122, 171
+L37: lea X17, L36
+L38: bne *r2
+L39: stop
+not *r0
+L40: sub r5, L10
+jmp *r2
+mov L173, L250
+red *r2
+; comment
+stop
+not r1
+jsr *r5
+clr r5
+add *r6, *r3
+sub *r1, r4
+L41: red r6
+L42: .data -138, 679
+L43: .data -646, -553, -945, 525, -631, 652, 14
+jsr X22
+mov #88, r0
+cmp #-59, *r4
+jsr *r1
+L44: clr X17
+L45: stop
+lea X17, L8
+prn L82
+red r3
+L46: lea X23, *r7
+L47: bne *r4
+cmp *r5, *r6
+; comment
+bne X9
+jmp L181
+L48: .data 27
+L49: add r4, L6
+mov *r0, r3
+L50: cmp #46, *r0
+stop
+bne *r7
+cmp r3, L229
+sub *r6, r4
+rts
+; comment
+add r7, *r7
+cmp *r0, X22
+mov #162, *r0
+L51: .string "wpt"
+bne *r4
+L52: rts
+not L12
+L53: .data -681
+stop
+lea L49, L240
+clr *r4
+mov #100, r6
+dec L130
+L54: dec r1
+; comment
+inc X5
+clr L151
+L55: .data -991, 263, -265
+mov *r1, *r1
+L56: bne X13
+not L75
+prn L238
+L57: clr r2
+red L20
+add r2, *r6
+lea L264, r0
+dec *r5
+bne X5
+red *r4
+L58: jmp L42
+prn r2
+mov #57, L11
+stop
+red X15
+cmp *r3, *r6
+cmp *r4, r0
+not r2
+sub *r7, r1
+L59: clr *r3
+jmp L217
+sub r3, r6
+L60: lea L260, L200
+L61: lea X14, L236
+red *r3
+jsr L218
+L62: jmp L106
+sub r3, r2
+L63: jmp X1
+L64: .data 77
+not *r2
+jsr *r4
+L65: stop
+L66: prn X4
+mov #-10, r7
+dec r5
+L67: dec r1
+bne *r0
+jsr *r7
+jmp L56
+mov r4, *r1
+L68: .data -78, 95, 337, -159, 178, 665, 420, -721
+L69: rts
+L70: inc *r7
+L71: dec r2
+rts
+clr *r5
+L72: dec L190
+L73: .data 38, 791, -60
+add X5, *r4
+L74: jmp L170
+bne X13
+bne X22
+sub X3, X1
+L75: rts
+jsr *r3
+L76: .data -990, 258, -592, 88, -112, 621, 356, 430
+L77: .data -920, -309, -637, -673, 193, 42, 602, -11
+L78: .data -596, 415, 775, 967, 610, -909, 891, -899
+L79: mov *r3, r2
+not X3
+rts
+rts
+prn r6
+clr L214
+mov *r4, *r2
+jsr *r7
+L80: .data 123, -106, 230, -715, -944, -781
+L81: .data -452, -108, -966, 80, 466
+sub r2, r6
+inc r0
+L82: .string "wihqcfqlcp"
+bne *r0
+L83: stop
+not *r4
+lea X3, L77
+add *r0, X9
+prn r5
+mov X21, r0
+add X4, X8
+L84: dec X0
+prn *r2
+L85: .string "led"
+sub *r3, L70
+stop
+L86: lea L253, r4
+red *r2
+L87: stop
+; comment
+L88: .data 826, 826, -507, 682
+L89: bne *r7
+stop
+L90: clr r5
+L91: bne L109
+lea X7, L26
+L92: lea X6, L122
+add *r0, *r3
+L93: add #6, L19
+bne *r2
+mov X15, *r4
+clr r7
+L94: clr L74
+bne L25
+not X14
+bne X12
+L95: jmp L167
+jsr *r6
+add #27, r2
+cmp r1, #251
+clr L154
+dec r0
+L96: .data 984, 268, 888
+inc L38
+L97: red r1
+not X9
+L98: cmp *r1, r6
+dec *r2
+not L134
+stop
+add #-179, X3
+red r7
+bne X12
+lea X4, L111
+L99: jmp X13
+not r7
+clr *r4
+prn #46
+add X19, *r5
+L100: prn L20
+clr r3
+not r2
+; comment
+L101: .data -576, 714, -715, -455, 619, -960, 153
+bne *r1
+jsr *r6
+L102: jmp X6
+L103: not r0
+L104: not X20
+jmp X20
+prn r4
+L105: stop
+cmp L191, *r6
+add X18, *r7
+; comment
+jsr X18
+jmp L190
+jsr *r3
+
+bne *r4
+mov *r7, r2
+L106: .string "mfgwm"
+L107: inc r5
+L108: clr *r1
+L109: clr L183
+L110: not r2
+L111: red *r1
+clr *r6
+add r4, r1
+bne L73
+dec r3
+L112: mov *r7, *r4
+L113: prn *r3
+L114: jmp L1
+rts
+L115: sub r1, r3
+mov *r3, *r2
+bne *r7
+jmp X16
+not r4
+L116: rts
+add *r0, r3
+L117: mov L192, r1
+L118: prn X23
+cmp X6, r5
+L119: .string "restwgcugxthxakcckc"
+inc X23
+L120: inc *r2
+bne *r3
+not L194
+prn X9
+add X18, X23
+dec r0
+jmp L42
+sub *r0, r0
+mov L10, L227
+L121: stop
+mov L107, r1
+L122: jmp *r3
+jsr *r6
+jmp X0
+jsr X7
+clr L96
+L123: .data 750, -508, -861, 995, -67, -778
+clr L144
+add X12, *r2
+L124: jmp X15
+clr L32
+dec L183
+sub X12, r7
+prn #175
+L125: jmp X12
+mov L209, r6
+add r4, r1
+L126: mov L208, *r2
+cmp L89, #-70
+jmp X2
+red r2
+lea X11, r5
+bne L106
+jmp *r0
+bne L124
+sub *r4, r3
+mov X11, *r7
+bne *r6
+L127: .data 636, 267, -839, -515, -975, -378, 16
+L128: bne *r3
+stop
+mov #-163, r4
+inc r7
+L129: not *r1
+mov L86, r2
+L130: dec *r1
+dec r5
+red *r4
+red r0
+; comment
+L131: prn r5
+clr *r6
+clr X13
+clr *r4
+rts
+jsr *r4
+jmp *r5
+prn r5
+inc r4
+stop
+L132: .string "ktnawndixcdlflcuahhqr"
+cmp r3, #35
+inc L36
+L133: lea X20, *r1
+sub L92, X19
+dec r1
+add #-189, X10
+add #-125, X20
+L134: rts
+jsr L126
+L135: cmp *r4, r6
+L136: .string "wukyoffbuppy"
+L137: not r5
+mov L131, r1
+inc *r3
+red L99
+bne L187
+cmp *r3, L174
+inc r7
+stop
+clr r5
+L138: .string "hgwmgnsxarcfyhtybgtaa"
+prn #-176
+lea L148, X13
+rts
+jsr L103
+lea L259, *r7
+clr *r1
+
+L139: .data 375, 13, 946, 650, -407, 355, -567
+jmp *r4
+mov *r5, X10
+cmp #-54, *r4
+rts
+L140: .data -352, 860, 184, -87, -635, 19, -253
+L141: .string "fozykptrkgzxbxljmsvfsj"
+lea X15, r6
+prn r3
+mov L5, X5
+L142: stop
+prn X17
+L143: red *r4
+inc *r0
+L144: rts
+add #-52, *r1
+L145: red X24
+sub r5, r4
+rts
+lea L202, r2
+L146: prn *r1
+L147: jmp *r5
+mov X13, r4
+L148: lea X9, *r5
+mov X14, *r3
+cmp #-251, #249
+L149: not *r0
+prn r2
+L150: clr L225
+L151: .string "arjjishxyklzvovhmy"
+not *r7
+L152: .string "xm"
+dec r4
+prn #-191
+jsr *r3
+bne L179
+jsr *r3
+sub r2, r0
+jsr *r0
+L153: .data -831
+mov #-23, r2
+bne L184
+L154: .string "elaohug"
+red *r5
+bne X21
+L155: jsr L196
+red X7
+
+lea L103, *r6
+jsr X2
+not r6
+jmp *r4
+L156: sub #-188, *r5
+
+
+red *r1
+L157: .data -446, 183, -673, 816, -89, -950
+not *r7
+inc r1
+prn X19
+dec X21
+clr *r5
+jmp *r4
+jmp X21
+L158: add X1, r4
+inc *r5
+bne X7
+L159: .data 228, 5, 281
+
+mov *r5, r7
+not X19
+jmp *r2
+clr L109
+sub r4, r5
+L160: .data 982, 694, 801
+stop
+L161: not r5
+stop
+prn r4
+jsr L257
+inc L239
+add r7, X23
+; comment
+lea X15, r5
+L162: clr r5
+add r3, r6
+lea L30, L54
+rts
+jmp *r4
+mov r1, r5
+red r3
+mov #131, *r1
+lea X9, *r5
+sub r2, *r3
+mov *r5, L150
+L163: add r7, L108
+mov X16, *r2
+rts
+rts
+prn *r4
+L164: sub X8, r6
+inc r5
+inc *r7
+prn #-5
+stop
+sub *r7, r6
+jmp *r4
+inc L258
+sub *r0, L167
+L165: cmp *r7, r0
+not *r2
+jmp *r3
+jsr *r6
+; comment
+L166: mov #-141, r0
+prn X20
+jsr L244
+L167: jsr L216
+inc *r1
+L168: .string "mbxbaydrbqllycslu"
+dec r1
+cmp r1, r7
+stop
+dec r2
+add #-10, *r1
+L169: .string "efrzay"
+mov r5, r2
+red L260
+inc L214
+red *r1
+L170: jsr *r0
+
+
+bne X19
+cmp X8, *r1
+L171: sub *r6, X21
+dec L34
+not *r4
+red r1
+bne *r5
+not L197
+L172: .data -385, -250, -889, -336, 923, -974, -176, -651
+bne *r1
+rts
+lea X15, *r7
+L173: mov *r5, *r5
+red r4
+rts
+L174: rts
+L175: rts
+add r2, *r2
+
+L176: stop
+stop
+
+not r6
+not X20
+
+L177: sub #15, *r6
+sub *r6, r5
+red r5
+sub X5, r6
+L178: prn r5
+sub #131, r4
+sub *r2, *r4
+clr X3
+
+not L234
+L179: .data 26, -985, 376, -393, 571, -492, 408, -809
+mov #183, *r7
+L180: not *r1
+rts
+L181: bne X19
+not r5
+add #192, *r3
+; comment
+cmp *r0, L259
+not *r2
+rts
+L182: .string "vdxccfoelfjqgqob"
+rts
+
+jsr L18
+; comment
+sub L258, r5
+cmp *r1, r2
+mov *r1, *r0
+mov L8, *r5
+red *r2
+jmp *r6
+clr X8
+L183: mov L86, L42
+stop
+stop
+not r2
+bne L162
+L184: cmp *r2, #3
+L185: mov #190, *r4
+not r3
+clr X8
+jsr L216
+stop
+L186: inc r1
+sub *r3, L176
+lea X13, *r1
+cmp *r3, X12
+sub r7, r4
+add #145, X24
+bne L131
+red *r6
+L187: red X10
+stop
+jsr *r7
+lea L87, *r6
+add X2, *r1
+add #18, X20
+prn L165
+prn #58
+L188: jmp *r3
+L189: .string "fqndpugorxnqvjjtp"
+rts
+jsr X13
+not X10
+add L186, r1
+rts
+add r3, *r0
+L190: .string "z"
+L191: .string "s"
+L192: .string "xy"
+jsr *r4
+stop
+not r6
+prn X8
+sub *r3, L140
+jmp X10
+stop
+rts
+stop
+clr L122
+cmp r5, r4
+L193: mov #-49, r1
+prn r0
+jmp L182
+red L241
+inc r3
+mov #187, r6
+L194: red L242
+L195: mov #185, X5
+prn r3
+L196: jmp *r1
+red *r5
+not r0
+L197: lea X22, *r5
+stop
+jsr X23
+prn L4
+rts
+jsr *r1
+mov r3, X15
+sub #115, r6
+cmp #231, r5
+bne L251
+bne *r6
+stop
+lea L181, r5
+bne *r3
+stop
+bne L239
+sub *r5, *r0
+dec *r3
+L198: not L233
+inc L70
+inc r5
+red L242
+L199: .data -756, 773, 254
+red L238
+L200: red L44
+inc L111
+red r2
+; comment
+L201: inc L222
+L202: .string "blzcp"
+jsr *r4
+add L123, r3
+L203: cmp L67, L94
+add *r4, r4
+cmp L2, r4
+L204: rts
+L205: jmp L213
+sub r7, L53
+L206: .data -409, 629, 229, -485, -938
+add X17, *r6
+dec r4
+mov #-202, L231
+cmp *r4, L213
+sub r3, *r0
+mov r7, *r2
+inc X16
+sub *r1, X22
+stop
+jmp *r7
+L207: bne X20
+L208: .data 520, 94, 951, 504
+jmp *r0
+add L62, r5
+stop
+bne X13
+not *r3
+mov #-111, r4
+
+jsr *r7
+lea X18, *r4
+sub *r1, X6
+L209: rts
+dec L211
+lea L127, X22
+dec *r1
+inc *r0
+bne X24
+lea L223, *r3
+L210: .data 79, 966, 700, -363, -594
+sub X21, r1
+cmp #55, r1
+clr r1
+clr X10
+mov *r4, r4
+not r1
+cmp #43, #-91
+mov r5, *r7
+bne *r1
+L211: jsr X11
+inc r7
+clr X21
+bne X24
+clr L248
+rts
+L212: dec *r3
+L213: dec *r0
+inc *r2
+jmp *r1
+inc *r5
+not L55
+lea L181, *r2
+rts
+rts
+stop
+inc L261
+dec L218
+bne L219
+inc X7
+add *r1, L219
+L214: .string "tczpdoyepvbozlqqvhqo"
+L215: jmp *r5
+L216: .data 925, 384, -769
+dec L178
+jsr *r1
+L217: lea L138, r4
+L218: bne *r1
+dec r0
+L219: .string "dinqlxazrcpjxvmmr"
+cmp L252, L166
+dec *r4
+L220: .string "husrewnsudftyeieckis"
+stop
+dec L204
+L221: .string "b"
+sub L49, *r3
+; comment
+
+L222: cmp r3, L248
+L223: jmp L246
+prn X14
+prn L240
+L224: .string "ebtanfcmnxddgybqtmics"
+L225: inc *r2
+inc X14
+cmp *r3, *r5
+L226: .data -441, 729, -666, 994
+lea X1, L109
+jmp L228
+jsr L139
+prn r2
+jsr L258
+inc X13
+rts
+cmp r4, r7
+L227: .data -648, -129
+L228: stop
+cmp #-125, X22
+prn X10
+jsr *r2
+red r6
+red L243
+jmp *r6
+L229: jsr *r5
+L230: bne *r7
+inc X14
+lea X17, r5
+prn r4
+bne *r4
+red r1
+lea X7, L256
+not L52
+not *r5
+mov X14, L262
+add L233, r1
+mov *r6, r0
+dec r1
+sub #210, *r7
+red r5
+L231: add L71, L202
+jsr X9
+red *r7
+inc *r0
+cmp X18, *r2
+L232: add L3, r6
+lea X12, r6
+jmp X18
+L233: .data -388, 410, 447, 724
+L234: sub #175, r2
+L235: jsr *r1
+cmp X14, #242
+jsr *r7
+inc X8
+L236: clr r4
+prn r6
+sub r5, *r5
+sub #186, *r7
+mov *r2, *r3
+clr r1
+cmp L194, #-133
+L237: jsr *r2
+L238: .string "nbcggualryoelvdxsgfdq"
+L239: .string "qpvb"
+L240: dec r4
+rts
+L241: inc X23
+prn *r6
+L242: .string "zuuox"
+bne X23
+cmp *r5, #-176
+jsr X7
+prn X16
+stop
+bne X24
+lea L255, L247
+mov r6, *r0
+L243: inc *r2
+jmp *r7
+mov *r3, L206
+L244: not X2
+cmp L207, #-125
+clr *r2
+L245: lea X4, *r5
+inc L187
+prn X4
+L246: .string "tyvarknszpibcyucprndjsqa"
+jmp *r2
+dec *r3
+sub r5, r7
+L247: jsr *r5
+prn *r1
+L248: rts
+add L54, *r6
+jmp L259
+L249: .string "wdzyhzgcx"
+mov r5, L147
+inc X13
+rts
+dec r0
+L250: .string "wnm"
+; comment
+jsr X13
+
+L251: .string "pnuejjyyxfyr"
+clr r6
+red L244
+lea L201, *r4
+mov r1, X20
+jmp L259
+stop
+L252: .string "fiodutyvazitwiacih"
+sub *r2, X21
+rts
+L253: cmp #-255, #-199
+stop
+add *r0, r4
+L254: dec r0
+clr *r3
+not L178
+L255: mov r4, *r3
+lea L261, r3
+add *r6, X23
+red L237
+L256: .string "kksrpulbofxhakexzrtbksrl"
+L257: cmp r5, *r4
+rts
+add r6, X4
+lea L151, *r0
+red r6
+bne L83
+; comment
+prn #245
+L258: not L261
+jmp X17
+; comment
+sub X20, r1
+mov r0, *r3
+clr L261
+L259: stop
+cmp r6, #130
+L260: not L133
+inc L32
+add L262, r0
+L261: mov *r7, r2
+L262: stop
+bne X1
+clr L263
+stop
+mov *r3, L225
+jsr *r4
+mov r2, *r2
+L263: inc r1
+bne *r7
+cmp #16, r6
+jmp *r7
+lea L20, *r3
+clr *r4
+cmp r6, L264
+cmp r1, *r4
+L264: .data 580, 846
+; comment
+rts
+sub *r0, L103
+jmp L123
+; comment
+mov *r3, *r7
+bne *r4
+stop
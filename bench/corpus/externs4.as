@@ -0,0 +1,1044 @@
+; Generated by genCorpus --seed 5
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+prn X7
+inc r1
+; comment
+stop
+L0: add #17, r7
+jsr X12
+rts
+inc X19
+sub L0, *r3
+L1: sub *r2, *r2
+jmp *r1
+inc L0
+rts
+L2: cmp *r7, X17
+mov r5, r5
+bne X24
+jmp L0
+jsr *r5
+lea L0, r2
+stop
+prn *r3
+dec r5
+cmp *r5, #-150
+jsr X10
+rts
+L3: .string "ntynywrmcy"
+dec r4
+add r4, *r4
+bne X1
+mov *r7, r3
+L4: .string "q"
+not *r2
+jmp L202
+red L0
+cmp *r7, #-19
+sub *r1, *r4
+rts
+lea L219, *r0
+bne *r2
+prn *r3
+sub #-27, r0
+lea L90, L2
+L5: .data 561, -247, -353, -933, -826, -484, 980, 438
+L6: .data 487, -420, -289, -376, 939, 983, -324
+stop
+; comment
+L7: cmp #229, #240
+clr r1
+mov r5, *r7
+prn r1
+clr X15
+L8: stop
+jmp X8
+red L207
+L9: clr r1
+L10: .data -105
+L11: red r6
+cmp L7, r1
+L12: add *r2, r0
+dec *r7
+clr X12
+inc X15
+L13: .data 510, 420, -895, -941, 951, 448
+jmp X6
+; comment
+jsr *r6
+jmp *r3
+L14: prn L140
+cmp L1, r4
+stop
+prn #-197
+add *r2, *r3
+stop
+inc r5
+jsr L21
+red r7
+stop
+L15: sub r3, r5
+red r4
+L16: inc *r4
+lea X6, r3
+prn r3
+bne *r6
+lea X21, *r3
+bne *r3
+prn r1
+jsr L12
+stop
+inc r7
+not *r1
+L17: jmp *r5
+mov *r1, r1
+jmp *r6
+stop
+stop
+mov r5, r1
+add r2, *r1
+
+jsr L258
+lea L0, L16
+L18: inc *r3
+sub #62, *r5
+sub L7, *r5
+L19: dec r6
+cmp #-46, #-219
+red r3
+jsr L18
+add r0, X1
+rts
+jsr *r5
+inc *r5
+clr X10
+L20: prn r3
+inc r7
+prn #141
+cmp L11, L7
+L21: sub #106, *r3
+lea L55, X1
+L22: .data -633, 621
+L23: .data 735, 197, 627, 975, -205, 339, 257, -338
+not *r7
+sub *r1, r0
+red *r6
+dec *r4
+jmp *r7
+jmp *r6
+L24: .data -172, -332, -254, 144, 759, -770
+sub r1, *r2
+sub *r3, X22
+add *r0, X17
+rts
+clr L9
+mov *r4, *r2
+jsr *r1
+red *r3
+L25: rts
+lea L207, r3
+L26: inc r4
+rts
+sub r5, L2
+
+jsr X15
+lea L249, L20
+L27: .string "sudffkstexekotxkmztf"
+not r2
+mov L90, r2
+L28: inc *r5
+stop
+clr X0
+lea L256, *r6
+jmp *r6
+rts
+not r4
+cmp r0, L3
+red r6
+sub *r3, *r6
+jsr X14
+inc *r7
+rts
+L29: dec r1
+L30: rts
+L31: cmp r7, r4
+add *r1, r0
+L32: .string "vlgutbsatcujfkputc"
+lea L262, X15
+jsr X7
+L33: .data 500, 689, -542, -996
+stop
+inc L15
+bne L19
+sub r5, L46
+add r7, L25
+prn r3
+jsr *r0
+L34: .string "rmhkvxvc"
+lea L201, r0
+prn *r0
+L35: .data 992, 551, -24, 965, 268, 113
+L36: not *r7
+L37: bne X11
+L38: .data 584, -130, 937, 41
+L39: .string "lgn"
+bne *r7
+not X3
+sub X8, r3
+L40: lea L165, X18
+lea L13, L22
+jsr *r2
+jmp X10
+L41: .string "vld"
+prn X0
+lea X20, X12
+not r6
+
+L42: .data -306
+L43: lea L0, X0
+L44: bne L8
+stop
+clr X2
+stop
+jsr L19
+L45: jsr L192
+L46: mov #-202, r0
+sub *r6, *r6
+L47: .string "kikci"
+L48: jmp *r1
+dec r1
+L49: sub L75, X19
+L50: sub L13, r2
+lea L15, *r6
+L51: .data -799, -638, 479, -619, 504, 364
+jmp L1
+cmp L6, *r5
+lea X14, r0
+; comment
+inc X11
+L52: add X2, *r3
+bne X3
+L53: jmp L108
+inc *r2
+inc X4
+inc *r2
+dec r6
+add L31, L131
+bne X22
+not L164
+cmp r7, r5
+L54: lea X24, L30
+L55: .string "pkcmracjmjyhbkxmdkwx"
+not r7
+jmp X20
+L56: .data -205, -818, 466, -600
+bne *r2
+red X5
+jmp *r5
+cmp r0, L252
+add L109, *r4
+inc *r2
+L57: .string "bdblfdw"
+; comment
+L58: bne L206
+sub *r2, *r0
+L59: bne X11
+add *r2, r2
+
+L60: jsr L206
+L61: not L127
+clr *r1
+add *r1, *r0
+cmp *r1, *r5
+clr r7
+cmp r7, X16
+cmp #-110, r5
+
+cmp X10, L32
+red L61
+sub r3, r1
+inc *r4
+lea X22, X6
+bne *r4
+L62: .data 902, -109
+rts
+L63: .string "wamlqfgxpuizx"
+red *r2
+mov r7, r4
+lea X16, X17
+L64: jsr *r2
+add r2, L9
+L65: clr X0
+dec *r0
+red *r4
+L66: not X22
+dec *r4
+cmp X1, r4
+dec L20
+jsr *r6
+L67: jmp L191
+lea L14, L242
+L68: not r5
+red L67
+L69: inc r4
+jmp *r0
+L70: jsr *r2
+not *r4
+L71: not *r2
+bne *r4
+not L8
+cmp #-6, X7
+L72: prn #-39
+lea L126, r7
+dec *r1
+mov L40, r6
+jsr *r7
+L73: add *r6, *r4
+red X21
+jsr L254
+dec X14
+prn r7
+dec r7
+mov L66, L14
+mov r5, L13
+dec L197
+
+jsr *r2
+stop
+L74: stop
+clr r7
+L75: .data 219, -439
+L76: inc *r4
+mov X4, L56
+stop
+clr r0
+add L45, r2
+jmp L31
+cmp #-166, L45
+L77: sub #-20, L134
+clr r4
+sub #-101, r5
+; comment
+L78: .data 296, -748, 531, -846, -541, 613
+sub #9, r0
+add L70, L57
+not X21
+sub #-54, *r0
+L79: dec r1
+red r4
+lea L262, *r7
+jmp *r1
+inc r2
+red X2
+lea X2, *r5
+; comment
+clr L10
+
+L80: cmp L234, #-132
+; comment
+rts
+clr r0
+sub #156, *r2
+L81: stop
+lea X8, L127
+L82: .data 562, -994, -988, 435
+mov #192, *r7
+L83: prn #-22
+sub #-78, *r2
+jmp L159
+jsr X21
+cmp r7, #191
+sub X15, r6
+stop
+clr X18
+not *r0
+L84: .string "pcuzdeis"
+
+rts
+bne L237
+L85: bne X11
+jsr *r7
+dec *r1
+L86: .string "wlhyxdfxkiyfebwnnf"
+bne *r4
+L87: jmp L171
+add L49, r1
+L88: rts
+prn #88
+inc *r6
+sub *r7, r0
+rts
+L89: not X1
+jmp L83
+jmp *r5
+jmp *r6
+mov #-9, r5
+cmp #-241, X9
+sub r6, X12
+add r4, r3
+stop
+add #-120, X19
+rts
+not *r4
+red r7
+red *r6
+L90: mov r5, *r4
+red X10
+not *r4
+L91: red r6
+add *r0, *r4
+L92: prn #-61
+add *r7, *r3
+stop
+L93: cmp L30, L143
+clr X18
+sub #206, X13
+mov #130, L152
+L94: rts
+bne L142
+sub L41, L160
+L95: rts
+not L64
+add r2, *r1
+bne *r4
+L96: stop
+cmp X23, #-181
+red r4
+L97: .string "xjmczhrmdootsnqub"
+rts
+clr *r3
+L98: cmp r0, #-221
+L99: red *r6
+mov r7, L36
+L100: jsr *r0
+jsr *r0
+L101: mov #175, L99
+inc r4
+L102: rts
+L103: lea X10, r6
+dec r4
+L104: .data -802, -344, -897, 773
+
+L105: rts
+jmp *r0
+lea X2, *r7
+rts
+cmp #-91, #238
+L106: lea X4, r1
+L107: .data -892
+clr *r1
+lea L124, *r2
+L108: .data -322, -718, 556, -244
+L109: bne *r4
+clr r2
+mov *r1, r4
+L110: stop
+L111: stop
+red r4
+bne *r3
+red L62
+bne *r0
+mov #20, r2
+L112: .string "iypzvibtwojppcphizczpm"
+jmp *r6
+L113: sub L13, *r1
+L114: not *r5
+lea L9, *r6
+L115: jmp X23
+bne L222
+bne *r0
+mov L89, *r6
+sub #-110, L40
+bne *r2
+L116: .data 291, -28, -893
+jsr L129
+red *r5
+rts
+prn r0
+L117: rts
+L118: .data 372, -605, 374, -571, -590, 761, 750, -419
+cmp r1, r5
+not r1
+not *r2
+prn *r0
+bne *r3
+lea L29, *r6
+jsr X19
+jmp X20
+jsr L36
+L119: .string "djaaipfnakqxq"
+L120: add r7, *r4
+bne L95
+stop
+sub #188, r4
+L121: bne *r7
+L122: red *r2
+L123: .data 705, -869, -256, 262
+mov *r4, *r4
+
+bne *r7
+L124: stop
+L125: rts
+clr X4
+jsr L11
+L126: not X1
+prn #-127
+bne X2
+jsr *r3
+dec L8
+cmp r0, L188
+L127: sub #56, r4
+jsr *r4
+L128: mov r1, *r3
+rts
+L129: .string "gbsffolsbchxgexhouefg"
+bne L146
+not L185
+red *r0
+red r0
+add *r7, X20
+prn #-202
+L130: rts
+red L106
+sub r2, r7
+L131: dec r2
+L132: jsr X18
+stop
+L133: jmp L128
+
+L134: lea L84, r3
+L135: .string "axcpalgfresoadfj"
+not *r3
+rts
+mov *r5, L70
+dec r2
+mov L152, *r3
+L136: .data 769, 254
+jsr *r7
+L137: jsr *r1
+L138: .string "uxwihhrjjbizsuojhdplmlnq"
+lea L247, X8
+sub #-131, L18
+lea X12, L110
+jmp *r1
+L139: dec r7
+prn #-124
+L140: cmp L82, #-107
+jsr L109
+mov *r0, *r2
+not r4
+L141: prn *r4
+L142: jmp L8
+mov *r0, *r3
+lea X5, r7
+L143: .data -390, 178, 312
+L144: stop
+L145: add #32, X18
+L146: stop
+rts
+jsr *r4
+add #99, *r7
+jsr X24
+jmp L28
+jsr *r4
+prn *r7
+L147: .string "wafziahujktvumr"
+lea X21, X1
+L148: jsr X16
+prn *r2
+jmp X8
+red *r7
+
+dec L247
+bne L84
+lea X6, *r1
+rts
+jmp L189
+red r0
+clr *r4
+L149: not *r5
+rts
+prn *r7
+; comment
+add r7, r1
+sub r2, *r5
+mov r4, r4
+L150: bne *r3
+L151: not L115
+jsr *r5
+L152: cmp *r3, L100
+dec L218
+; comment
+stop
+add r4, r1
+sub X6, *r3
+L153: clr L228
+not r5
+clr L17
+L154: mov #-224, X15
+
+L155: .string "ruxcwjar"
+; comment
+mov L212, L233
+not L42
+
+; comment
+cmp *r4, r7
+red r0
+prn *r7
+not *r7
+mov *r2, r2
+L156: sub r1, r4
+lea X15, *r6
+jmp *r5
+stop
+L157: red *r0
+dec r6
+red X8
+lea L54, X12
+red r1
+stop
+L158: .data 129, 352, -840, -574, 254
+not *r3
+L159: .string "p"
+; comment
+jmp X3
+not r2
+not r3
+clr *r6
+bne L226
+mov *r1, *r2
+clr L254
+lea X9, r6
+jmp *r7
+dec r6
+prn #126
+stop
+cmp X2, r4
+cmp *r0, *r1
+L160: .string "cjdmcxfucfqaeysfpnma"
+L161: .string "qvqxoox"
+L162: clr X9
+clr *r7
+L163: bne *r4
+cmp X5, *r2
+lea L243, L215
+sub r5, L172
+L164: not *r4
+not r6
+stop
+jsr *r6
+not r7
+lea L198, X4
+L165: bne X10
+
+jsr *r4
+red r7
+not X12
+bne L226
+L166: add *r0, *r4
+L167: clr r0
+prn r3
+red *r0
+L168: lea L209, *r2
+cmp r1, r4
+add X20, X7
+cmp X13, r3
+lea L208, r2
+not r1
+L169: add *r0, r6
+prn r7
+sub #207, *r5
+L170: jmp *r5
+dec r0
+cmp X12, L203
+lea X16, r3
+L171: mov *r1, X7
+dec r7
+L172: add r0, r2
+inc *r0
+L173: red r2
+inc *r7
+; comment
+dec r1
+L174: .data 625, -321
+L175: dec r5
+L176: .data -542, -716, 444, -934
+L177: .data -602, -864, 628, 563, -473, -971, -696, 858
+clr r2
+sub X17, r1
+
+clr r2
+L178: red *r5
+L179: red *r2
+sub X5, r3
+L180: mov *r2, r2
+not *r2
+inc *r2
+L181: .string "ey"
+mov X16, *r3
+cmp r7, r0
+sub X7, r5
+sub #238, *r2
+dec r4
+not *r1
+L182: inc *r1
+L183: .string "eekhocxfcxchbjkncxskghl"
+; comment
+lea X3, L28
+L184: stop
+; comment
+cmp r7, X6
+bne L53
+L185: red *r6
+clr L129
+not L139
+jmp X23
+red r6
+add r3, *r0
+add r4, *r2
+stop
+L186: inc *r6
+red X11
+L187: .string "sibbcarfgilce"
+jmp L191
+bne *r5
+rts
+inc X6
+rts
+; comment
+sub *r2, *r5
+not L108
+add *r2, X18
+stop
+red r6
+clr L21
+L188: .data -15, -454, -186, -304, -465, 422, -926, -317
+cmp r2, #-174
+L189: red *r2
+dec X6
+jsr X20
+; comment
+add #-37, r4
+sub r2, *r3
+sub *r3, X21
+mov #68, L154
+not *r4
+clr *r6
+L190: not *r5
+jsr *r7
+bne *r1
+rts
+L191: lea L75, L192
+L192: stop
+L193: .data -483, -685
+red r4
+clr *r7
+add X24, L108
+L194: not X16
+L195: not r6
+prn *r6
+L196: clr r1
+L197: sub #-238, r6
+lea X4, r7
+cmp *r6, r7
+bne *r5
+L198: .data -339, -725, 519
+L199: cmp L159, r3
+bne *r0
+cmp *r7, *r3
+L200: sub #-16, X4
+dec L205
+
+rts
+L201: .data 982, 298, -844, 409
+dec *r7
+; comment
+L202: sub *r2, r2
+L203: .string "qf"
+L204: .string "uedbfpjlofvuklvrxcjqwb"
+add r1, *r1
+
+inc r3
+L205: prn *r6
+mov *r1, r6
+stop
+jsr *r0
+prn L192
+add #-29, *r2
+rts
+dec r0
+L206: .string "alvhxd"
+L207: jsr X21
+red r0
+not r7
+mov #17, L247
+red *r6
+sub *r4, *r1
+L208: .data 231, 162, -480, 110, -95, 448, 75, 542
+clr *r7
+red r5
+L209: jsr *r3
+stop
+; comment
+jmp *r3
+clr r1
+L210: bne L236
+L211: .string "uiamakwk"
+L212: not L215
+lea X16, X22
+cmp L206, r4
+stop
+rts
+L213: mov *r1, r6
+; comment
+L214: .data -84, 52, 262, -459, -912, 897, -333
+rts
+red X0
+L215: .string "hy"
+L216: clr *r5
+cmp #201, *r0
+L217: .string "o"
+jsr *r1
+clr L58
+red X0
+not *r7
+add *r6, *r2
+
+L218: .data -550, -665, -71, 968, -637, -745
+rts
+jsr *r6
+dec r4
+not r4
+L219: .string "vvkbnmtrmqrxpsg"
+L220: not r2
+L221: red *r7
+prn *r7
+lea X9, r6
+jmp *r6
+; comment
+rts
+sub #143, *r3
+lea X10, r1
+L222: .data -753, 99, -54, -215, 941
+add #243, r1
+L223: .string "pndvifrhlmhfbspu"
+L224: clr *r4
+rts
+add #-186, r2
+not r2
+dec X20
+stop
+not r3
+bne L225
+prn *r0
+bne *r1
+prn *r4
+clr *r2
+L225: bne *r6
+lea X1, r1
+rts
+prn *r4
+L226: add L248, *r0
+L227: inc r0
+; comment
+sub *r7, *r3
+L228: sub #-75, L10
+rts
+L229: add r7, X13
+jsr *r6
+L230: add #-123, L257
+not *r2
+L231: .string "amjaicqwfw"
+L232: not r3
+clr r5
+dec *r4
+clr L238
+dec L237
+bne *r3
+L233: .string "ihxfsjezazqktnibh"
+not r7
+L234: .data -292, 518, -2, 353, 757
+dec r0
+sub *r5, X5
+L235: .string "jpojmzcr"
+
+L236: .string "drkrncxxmbcfysr"
+L237: .string "rmtgbksvrycgv"
+stop
+red X12
+
+clr r0
+L238: .string "eahbkxpwqzcru"
+dec *r2
+; comment
+L239: .string "ythdbvndusv"
+clr *r1
+prn r7
+inc *r3
+L240: .data 654, -773, 175
+L241: red r5
+L242: bne L130
+red r1
+not *r0
+L243: .data -519, -170, -358, 834, 197, -316, -905
+not *r6
+clr *r3
+jsr *r4
+dec r5
+L244: add *r3, r5
+sub #17, L51
+prn *r1
+jmp X9
+inc *r0
+cmp L224, r7
+L245: lea L192, *r6
+L246: stop
+add L248, *r1
+prn *r6
+cmp r5, r3
+sub *r2, *r1
+dec r2
+mov #-3, r6
+cmp r3, r5
+jsr X4
+jsr *r6
+lea X24, *r3
+not L3
+bne *r0
+red X19
+dec X4
+L247: prn r3
+cmp L257, *r5
+not r6
+sub *r5, *r1
+jsr X18
+L248: .data -495, -444, -707
+inc X12
+dec L70
+jmp *r6
+mov r2, *r1
+cmp *r0, *r4
+stop
+; comment
+
+L249: stop
+L250: .string "evbhi"
+lea L262, *r2
+inc r1
+; comment
+bne *r4
+prn X14
+
+dec *r7
+L251: .data -58, 799, -569, -140, 43, 174, 966, -26
+jsr L1
+rts
+dec L254
+jsr *r6
+sub #245, L44
+rts
+clr r7
+bne L30
+; comment
+jsr X17
+clr r6
+; comment
+dec *r2
+dec L259
+clr *r6
+L252: .data 12
+prn *r7
+clr r5
+L253: add #43, L260
+bne X15
+jmp *r1
+L254: .data -613, 925, -997
+not *r7
+
+dec r2
+sub L206, *r7
+L255: .data 162, 924, -606, 745
+inc r3
+jsr X5
+bne L139
+inc L127
+L256: .data 385, 587
+cmp r5, *r0
+rts
+; comment
+rts
+clr r1
+prn L261
+red L1
+rts
+not L43
+stop
+not L216
+rts
+; comment
+clr L240
+L257: cmp X18, X24
+jmp *r4
+; comment
+add *r6, L259
+L258: .string "lfjmidzwruhfagujbtcbopxj"
+inc r6
+clr L213
+L259: .data 497, 747, -529, -827, -213, 152, 872, -921
+jsr L140
+L260: bne *r3
+L261: jsr *r1
+lea L262, r0
+clr L262
+jsr *r5
+inc L262
+clr *r7
+red *r7
+cmp r7, *r2
+jmp *r5
+L262: .data 402, 109, 420, 890, -166, -224
+cmp #152, *r5
+bne *r7
+stop
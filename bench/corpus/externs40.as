@@ -0,0 +1,1044 @@
+; Generated by genCorpus --seed 41
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+stop
+L0: lea X22, X10
+not r7
+inc *r0
+mov #-107, *r0
+clr X17
+L1: jsr *r0
+jsr *r1
+L2: .string "svxdauxibqfmmkiizwhmqwln"
+L3: .data 422, -790, 86, -869, 421, -916, 968, 381
+sub r4, X24
+jsr *r6
+L4: stop
+L5: lea X20, r5
+rts
+prn r6
+not *r7
+L6: clr *r0
+
+bne *r7
+L7: .data -943, 58
+L8: jsr *r5
+jmp *r4
+bne X19
+clr r4
+L9: add #1, *r5
+not X3
+
+; comment
+dec r6
+jmp X0
+bne *r6
+stop
+not L72
+L10: cmp L4, X10
+L11: .data -510, 167, 637, 140, 796, 899, 329, 816
+L12: jsr *r4
+mov r1, r4
+mov r3, r1
+prn *r7
+jmp L10
+cmp *r0, #-130
+not *r3
+inc r0
+mov r5, L0
+dec L43
+clr L62
+L13: prn L5
+stop
+jmp *r3
+prn #134
+cmp r3, #-10
+L14: dec L12
+dec L169
+dec r5
+L15: inc *r4
+add *r7, L8
+sub *r2, L10
+L16: stop
+L17: jsr *r1
+lea X6, *r2
+rts
+dec *r6
+red L15
+L18: lea L261, L116
+L19: jsr *r5
+clr r7
+stop
+L20: not r4
+L21: clr *r4
+lea X23, X13
+L22: clr X8
+L23: cmp *r5, *r2
+red r4
+inc *r4
+prn r2
+cmp #-164, L261
+prn X11
+L24: clr r0
+jsr *r7
+dec L115
+inc r1
+clr *r4
+sub *r5, r7
+L25: .data 226, 657, -783, 856
+lea L21, *r5
+inc X23
+cmp #106, L9
+bne L5
+mov r7, r2
+L26: jsr L129
+red *r3
+add #-99, L135
+mov r0, r1
+jmp X10
+
+rts
+
+jmp X6
+inc *r3
+bne *r1
+not *r3
+L27: .data -52, 357, 200, -997, 337, 1, -912, 826
+stop
+jsr L188
+L28: .data 564, 707
+lea L219, *r2
+lea L162, L123
+add X7, *r7
+clr r5
+dec r4
+clr r1
+dec X6
+sub L1, *r0
+L29: cmp *r3, r7
+red L37
+L30: .data -17, 776, -209, -257, 502, 42, -603, 643
+L31: lea L26, X2
+stop
+L32: not L18
+jsr *r1
+jsr L29
+not r4
+jsr L11
+L33: red r0
+L34: .data 345, -351, -381, 612, -742
+jsr *r1
+L35: .string "pwdhlhaktwsqljxojefzpnyg"
+mov #0, *r4
+lea X10, X19
+inc *r3
+cmp *r4, *r1
+rts
+sub r7, r4
+L36: prn L19
+prn #51
+red r6
+L37: inc *r0
+dec r0
+jmp X0
+L38: .data 4, 88, 284, 619, -275, -125
+clr *r2
+clr r1
+sub L31, L125
+lea X5, L16
+stop
+sub *r1, *r2
+prn X16
+mov *r0, L138
+L39: .string "tytdcxs"
+prn r5
+add L25, r3
+add L147, r0
+
+cmp r3, *r1
+; comment
+L40: .data -429, -268, 558, 32
+mov r4, *r1
+L41: jsr *r6
+not L15
+dec *r4
+bne *r0
+bne *r7
+lea L154, L35
+add L125, r0
+bne X16
+red L156
+dec *r4
+mov #192, r1
+not r2
+clr r6
+jsr *r4
+jsr L0
+dec X9
+sub *r1, X5
+stop
+not r3
+prn #220
+sub #-33, *r6
+clr r1
+lea X16, L1
+dec r6
+cmp r0, *r3
+jmp L18
+L42: lea L228, r5
+red *r0
+dec *r2
+rts
+lea X15, *r6
+sub r3, *r3
+L43: .string "bvdnpz"
+not r2
+lea X18, L205
+add *r2, *r0
+add *r4, r2
+cmp r7, *r7
+; comment
+jmp L15
+jsr *r3
+mov #77, L0
+inc r2
+mov #-26, *r3
+L44: .string "mibtyznyxdxdrs"
+L45: red r0
+L46: add #181, r2
+L47: lea L6, r6
+L48: .data -425, 308
+not r5
+L49: sub X2, *r2
+inc r1
+L50: .data -417, -300, -305, -175, 765, -235, 741, 588
+stop
+lea L97, *r7
+jsr L238
+jsr *r6
+L51: .data 409, -145, 689, 179, 157, 311, 61, 504
+L52: lea L39, *r0
+add #72, r2
+L53: .data 702, -424, -459
+jsr X23
+L54: .data 462, -348, 57
+mov *r5, *r6
+L55: jsr *r3
+add X22, *r4
+stop
+stop
+L56: red *r4
+jmp *r7
+L57: mov r4, r5
+L58: add r1, r3
+not L171
+mov #75, r1
+red X9
+cmp r0, *r1
+jmp *r4
+lea L73, r6
+lea L34, X15
+stop
+dec L110
+bne *r0
+inc r6
+sub r1, *r5
+not X12
+clr *r0
+bne X0
+L59: clr *r3
+cmp *r6, #35
+L60: .data -974
+rts
+mov X12, L0
+dec X10
+stop
+rts
+L61: lea L159, r1
+L62: bne L166
+L63: prn #-40
+stop
+add r4, L26
+jmp L29
+bne X3
+rts
+rts
+jsr X22
+jmp X0
+clr *r0
+L64: inc *r1
+L65: jmp *r0
+bne L19
+prn #-250
+cmp *r1, *r7
+L66: .string "czwzcxpxfe"
+bne L47
+sub r4, X13
+mov *r5, r2
+L67: jsr L56
+red r6
+jsr *r5
+L68: rts
+
+L69: .data 318, -651, -680, 45
+sub L76, L75
+L70: .string "lwzozpbcynrjgb"
+rts
+; comment
+sub L36, X22
+jsr *r6
+jsr *r4
+lea L26, L33
+red L28
+prn r7
+L71: .string "salpctkuyqkyaq"
+sub r3, r3
+sub *r3, r6
+add r0, r7
+sub L61, L48
+mov L0, *r7
+jmp X9
+L72: .string "sjuhwpoqa"
+L73: .data -643, 464
+L74: bne L104
+sub L172, *r4
+sub r5, *r7
+L75: .string "qpns"
+jmp *r1
+sub *r7, *r0
+mov #50, *r5
+mov r1, L42
+prn r0
+lea X11, *r1
+red r3
+L76: .string "tqidbarebkxwmim"
+L77: jsr X3
+not *r1
+bne *r3
+lea L182, r0
+sub X12, L62
+cmp r0, *r4
+stop
+L78: jmp L167
+; comment
+cmp *r7, r2
+not r0
+inc L236
+lea L25, L151
+mov r6, *r6
+lea L255, r5
+lea L55, L32
+cmp *r4, X20
+L79: sub X1, *r0
+L80: stop
+prn #49
+bne X4
+clr r0
+L81: .data 739, 492
+L82: inc r1
+add *r2, r6
+lea L60, *r0
+L83: prn r6
+L84: not X16
+prn *r2
+not *r1
+red *r4
+lea L110, L53
+L85: .data -103, -47, 436, 57, 54
+L86: sub r1, *r1
+prn #-16
+red L53
+clr *r2
+dec *r0
+; comment
+lea L211, *r6
+jmp L71
+sub *r6, L77
+cmp #-97, X22
+add *r3, L182
+not X22
+L87: cmp L25, #230
+red r2
+rts
+sub r5, r4
+L88: rts
+not L44
+add *r3, X6
+dec *r3
+red L193
+jsr X2
+stop
+L89: .string "brhwsaeyfeevtatttlu"
+L90: .string "ejuegisytcjxdjtui"
+rts
+L91: .data -568, 554, 629, 885, -812, 275
+add #31, *r2
+lea X11, r0
+bne *r4
+jmp *r5
+rts
+L92: .data -260, -997, -708, 324, -566, 172
+L93: .data -941, 76, -618, 137
+jmp X12
+lea L10, r5
+jsr *r0
+L94: red *r3
+stop
+dec *r1
+jmp L215
+not *r1
+L95: .data -266, -846, 219, -391, -197
+not r1
+red r6
+sub r3, X7
+L96: red r1
+L97: add *r5, L124
+rts
+L98: cmp r1, #-49
+stop
+bne *r4
+cmp #-25, *r7
+red *r6
+inc *r5
+L99: .data -123, -879, 71, -185, -210, -315, -113
+cmp L91, r0
+cmp r1, X19
+clr *r0
+L100: .data -156, -517, -406, 891, -447, 569
+inc L243
+cmp L4, #-209
+L101: bne *r3
+L102: .string "aanojnnfhyimnr"
+bne *r5
+jsr L168
+inc L168
+clr *r0
+L103: prn r5
+L104: dec *r3
+not r1
+not r7
+L105: stop
+L106: .data -101, -997, 288
+jmp X24
+lea X6, *r0
+rts
+L107: .data 350, -740, -384, 951
+jmp *r1
+not *r3
+jsr *r6
+
+inc r4
+L108: .data 777, 569, -54, -844, 724, -956, 232
+L109: .string "dwj"
+L110: jmp *r7
+bne *r4
+L111: cmp *r0, r5
+jmp L77
+not X4
+stop
+sub L39, X20
+L112: dec X4
+add #104, r1
+jmp *r3
+stop
+L113: lea L197, *r0
+mov *r5, X3
+jmp L203
+jmp L110
+bne *r5
+inc r6
+red r7
+L114: not L176
+cmp r3, #-30
+lea L23, r7
+mov r2, *r6
+; comment
+L115: .string "zcmursrrtnbxleusinorum"
+stop
+mov r3, r0
+L116: inc r6
+L117: .data -118, -73, 863, -914, -188, 185
+; comment
+add #113, *r3
+clr X3
+rts
+bne *r4
+red r4
+L118: jsr *r5
+jmp X9
+L119: prn *r0
+bne *r7
+cmp L128, L17
+lea L21, r4
+prn r6
+clr X9
+add r5, r7
+L120: .data -814, -880, 18
+red *r7
+jmp *r6
+sub L259, L35
+clr r5
+clr X22
+L121: .string "oarfobodnarlrql"
+lea X23, L25
+L122: dec L67
+prn #93
+sub L136, *r3
+inc r2
+mov r1, X3
+jsr X7
+inc *r0
+inc r0
+jmp X7
+L123: bne X4
+jsr L4
+stop
+jsr *r7
+L124: rts
+L125: add r5, r7
+L126: cmp L86, L161
+inc *r2
+mov *r2, r0
+L127: add #-158, L71
+dec X14
+L128: stop
+jmp L95
+add #73, r0
+L129: .data 261, -598, 469, -497, 10, -455, -626
+rts
+mov #157, *r5
+L130: .string "kbzqxugofo"
+L131: .data 521, -313, -360, -599
+sub #39, L132
+L132: sub r3, *r4
+sub #-218, r4
+; comment
+add L103, L73
+inc r4
+rts
+clr L106
+inc *r3
+L133: lea L253, r0
+mov *r7, *r5
+L134: bne *r5
+L135: jsr X20
+sub r3, r7
+red *r1
+stop
+L136: not X11
+L137: inc r0
+add *r4, r2
+jmp *r5
+inc r5
+dec *r0
+mov *r0, r1
+prn L134
+L138: clr r4
+inc r6
+add r2, r2
+jsr *r7
+jmp X20
+L139: .string "shbwnc"
+lea L38, r7
+L140: jsr L232
+clr r0
+prn L221
+dec *r0
+L141: .string "frkicjxplptvymdnx"
+bne *r7
+rts
+red X2
+rts
+L142: dec *r0
+dec *r6
+add #-89, L183
+lea X9, *r3
+cmp #48, r3
+rts
+; comment
+red X9
+add #-35, r4
+cmp #-89, *r0
+red *r2
+red *r2
+cmp L192, X23
+jsr L112
+L143: dec r6
+add L165, *r6
+
+inc L22
+rts
+cmp r3, *r1
+add r1, *r6
+clr L157
+L144: .string "hwxyaezmpisvtjaswebbbr"
+mov *r7, L204
+clr *r0
+rts
+dec X23
+sub r0, X0
+add *r1, *r1
+L145: prn r2
+bne L135
+L146: .data -740, 514, -398, -799, 330, 180, -940
+jsr X23
+clr *r3
+rts
+mov L46, X0
+bne *r3
+L147: inc *r2
+add #19, L164
+mov #253, L190
+cmp X3, r1
+L148: red L201
+bne *r0
+add *r6, L133
+inc r2
+cmp *r3, *r4
+inc r6
+prn #38
+; comment
+not X18
+; comment
+L149: red *r0
+L150: .string "vigeglxtkitotguf"
+red L149
+sub L250, *r3
+L151: .string "tpwhymcyobrdtuyknuu"
+red L147
+L152: rts
+clr r0
+L153: lea L8, L8
+L154: not *r7
+red r0
+jsr *r3
+mov r6, *r4
+clr *r0
+clr L67
+bne L167
+stop
+
+not L195
+cmp r0, X21
+L155: jmp X20
+red r2
+clr X23
+rts
+stop
+
+clr *r4
+red r7
+lea X11, *r0
+rts
+jmp X5
+jsr X6
+L156: red *r2
+inc L36
+jsr *r6
+inc r0
+dec *r2
+jmp *r4
+L157: .string "zhjosxaeuxp"
+rts
+lea X13, X15
+; comment
+; comment
+L158: .data -758, 778, 378, -946, -894, -314, -103
+red L214
+lea L170, *r1
+stop
+dec *r3
+clr *r6
+inc X16
+red L227
+not *r1
+L159: .data 76, 363, 415
+jsr L150
+stop
+not X1
+
+not L245
+; comment
+prn *r2
+red L5
+L160: .string "hpbnogppfsusexnjheu"
+sub #66, *r0
+L161: jsr L214
+rts
+bne *r3
+L162: .string "jqleuavkphwztqokbbmnnm"
+jsr X3
+jsr *r3
+dec *r6
+add #-156, L229
+dec *r0
+inc *r5
+mov X5, r3
+sub #69, *r5
+mov X17, L117
+lea X10, *r4
+L163: .data 879, 91, 335, -347, 917, -390, -866, 369
+red r7
+red *r5
+jsr X9
+not *r2
+L164: sub L197, X19
+red *r7
+clr L216
+sub #-212, *r6
+jmp *r6
+inc X15
+mov r3, L157
+L165: .string "emesoxjivxkkkukxoxrxpqtz"
+dec r2
+prn L197
+cmp L23, *r1
+sub X4, *r2
+L166: stop
+sub *r4, *r4
+L167: lea L66, *r4
+stop
+L168: .string "dwcexmaxxjkv"
+inc *r5
+lea X11, X9
+mov *r4, r3
+mov *r2, X17
+mov #66, *r3
+cmp X23, #-228
+bne *r2
+jmp *r6
+cmp #137, r5
+L169: dec *r1
+L170: .string "cqmy"
+bne *r1
+not L156
+clr r5
+red r3
+sub L187, *r4
+L171: .data -490, 594, 998
+jmp *r7
+L172: stop
+red r5
+jsr X23
+stop
+inc r5
+L173: add *r2, L145
+sub #156, r2
+sub r3, *r3
+L174: prn *r6
+bne *r3
+L175: cmp r6, r1
+clr r5
+add r5, r3
+L176: prn r3
+red L226
+bne *r7
+red r0
+add *r6, X7
+L177: jmp L145
+lea X19, r0
+sub r0, X18
+L178: stop
+rts
+
+prn *r3
+rts
+L179: clr r5
+cmp r3, r6
+not r7
+bne *r3
+bne L217
+L180: .data 325, -21, 309, -71, -171, 919, -53
+rts
+prn *r2
+rts
+prn r2
+L181: bne *r0
+stop
+red X10
+stop
+L182: .string "hgsbatv"
+L183: .string "vprr"
+L184: .string "bvqzqbivbzwlupjbdlxook"
+
+stop
+inc r7
+L185: red X16
+L186: add #189, X2
+jsr X3
+L187: rts
+cmp L213, #99
+L188: prn L233
+mov #128, *r3
+inc L254
+L189: jmp *r0
+clr *r3
+rts
+sub r7, *r5
+L190: clr *r3
+mov *r6, *r2
+jsr *r2
+stop
+L191: .string "gjeiphnbrqzwqcpwdo"
+L192: stop
+L193: not *r2
+rts
+sub *r3, L196
+L194: add L255, *r5
+bne *r2
+mov #241, L251
+L195: sub r6, *r5
+L196: .data 134
+L197: cmp #151, r3
+cmp #-245, X7
+
+L198: .data -140, -553, -318, 257, 962
+lea L256, *r7
+L199: .data 301, 572, -85, 290, 635
+L200: stop
+sub L236, X24
+L201: .string "vdtshmmdxacgmfshts"
+lea L245, *r4
+inc X10
+inc *r4
+L202: rts
+L203: .string "qzgfsjyauwpdyqeisrlr"
+clr r7
+not r6
+jsr L248
+bne L259
+jsr *r7
+L204: jmp *r6
+bne *r5
+mov #-154, r2
+L205: .string "fhwp"
+L206: bne *r0
+L207: inc r4
+rts
+L208: sub #53, r0
+L209: .string "zbc"
+bne *r2
+inc *r2
+L210: sub L81, X23
+L211: .data 283, 536, -179, 787, 87, 828
+prn #83
+dec r5
+jsr *r6
+L212: not X4
+L213: cmp r6, L199
+prn *r6
+rts
+L214: cmp *r0, r6
+sub r1, r6
+L215: .data 226, -787, -213, 469, 762, 691, -67, 952
+bne *r4
+add #-17, r3
+L216: red r7
+mov r7, r0
+L217: stop
+bne *r6
+stop
+prn *r1
+clr L225
+L218: prn *r2
+sub *r0, *r7
+cmp *r2, *r2
+rts
+L219: inc r3
+clr r5
+L220: clr L229
+red L258
+jmp *r2
+dec *r7
+lea X12, r6
+L221: .data -637, 461, -88, -792, 587, -268, 903, -144
+add #-229, *r3
+lea X2, r3
+; comment
+add r6, r6
+L222: .string "yva"
+cmp X19, r1
+inc L21
+L223: .string "uzndexsupckegq"
+
+bne L255
+lea L261, *r4
+bne L253
+prn r6
+mov L6, *r1
+bne X3
+L224: jsr X10
+jsr *r6
+L225: inc *r6
+red L254
+prn r0
+L226: prn X9
+L227: jsr *r7
+clr X8
+sub #-55, *r1
+jsr L37
+
+L228: stop
+red *r7
+stop
+sub r4, *r7
+cmp #58, *r7
+red r0
+prn *r6
+L229: bne *r2
+L230: prn #83
+inc *r2
+not r1
+inc L124
+L231: .string "ytkjiqgigx"
+add r5, *r4
+jmp X20
+not L258
+L232: add r7, *r7
+rts
+L233: .string "haorjeajxhlbgsyes"
+rts
+clr X11
+sub *r7, r2
+cmp X4, *r3
+L234: .string "grwweajcpbrtkdnxrkolls"
+prn *r1
+jmp *r6
+bne L251
+L235: .data -925, 395
+jsr X13
+L236: dec r5
+L237: add #-199, *r3
+rts
+L238: red *r4
+L239: jsr *r4
+jsr L56
+prn r3
+prn *r1
+jmp *r2
+L240: .data 583, 887, 72
+rts
+stop
+L241: not *r3
+cmp L246, *r1
+stop
+L242: add *r6, r0
+L243: .data -568, 355, -971, -494, 267, 916
+not *r5
+lea X21, *r6
+bne L118
+L244: .data -624, 152, -514, 540
+cmp r6, *r2
+lea L251, r4
+L245: .string "chxciny"
+L246: bne L52
+L247: jmp *r3
+jsr *r5
+dec X7
+jmp *r5
+L248: dec L67
+dec X12
+red r6
+prn #204
+L249: add *r3, L264
+prn #52
+stop
+mov r2, r7
+
+; comment
+L250: jmp X5
+prn #-7
+inc L5
+L251: mov r1, *r6
+cmp *r6, L135
+lea L264, *r2
+L252: inc L232
+lea L253, r6
+L253: inc r0
+cmp *r1, r6
+rts
+L254: bne *r4
+L255: jsr X14
+prn L198
+rts
+L256: jmp *r6
+red X9
+not *r0
+sub #143, L259
+jsr X19
+L257: rts
+red r1
+L258: jsr *r0
+inc r6
+
+sub *r4, r3
+clr r1
+add #-31, *r3
+not L259
+dec X20
+prn r5
+lea X1, *r6
+jsr L261
+clr r7
+stop
+L259: .data 956, -306
+add r7, *r1
+L260: lea X9, r5
+jmp *r7
+red X23
+mov r6, L197
+mov *r7, L263
+lea L71, r6
+prn L107
+L261: clr r5
+L262: stop
+red r6
+prn L264
+L263: .string "dclctnvfjlwgzhqhg"
+clr *r4
+clr r7
+; comment
+sub r5, r2
+L264: clr X7
+rts
+stop
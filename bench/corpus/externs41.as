@@ -0,0 +1,1044 @@
+; Generated by genCorpus --seed 42
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+not X17
+stop
+dec L162
+dec *r7
+cmp #-66, L68
+
+red r6
+add #215, *r3
+lea L202, r5
+stop
+dec r1
+not L198
+L0: rts
+bne *r7
+L1: .data -823, -347, 999, 624, -927, 358, 891, -490
+L2: .data 198
+prn #186
+stop
+jmp X6
+sub #-32, X2
+L3: mov r4, *r3
+L4: .string "agqczwlbqwb"
+lea L0, X0
+red L188
+bne X17
+L5: clr L106
+prn L233
+L6: dec L1
+L7: .data 407, -527, 548, -150, 823
+dec r0
+L8: .data -215, 418, -946, 969, 503
+L9: jsr *r5
+add X16, r0
+
+rts
+bne *r2
+lea X7, L9
+cmp #-80, *r6
+lea X3, *r1
+jsr *r5
+prn r5
+L10: mov #157, r5
+stop
+stop
+L11: .string "srooqhmdr"
+red X8
+cmp *r2, *r0
+cmp r7, L3
+rts
+not *r7
+jmp *r2
+sub X2, *r1
+L12: .string "kzl"
+bne *r0
+L13: cmp #71, #25
+inc r6
+L14: .data -990
+L15: add X14, r5
+L16: clr X17
+L17: .string "wplxrmoextnoelhobnimmv"
+L18: jmp L14
+not *r1
+L19: dec r2
+red X18
+sub #-12, L12
+L20: inc r1
+mov *r1, L8
+lea X9, L3
+bne *r7
+not X5
+add *r3, *r3
+bne *r7
+not *r5
+sub r2, r1
+
+clr L3
+jmp *r7
+
+sub #-185, L10
+jmp *r5
+lea L200, r4
+L21: red r6
+not r0
+dec *r6
+mov #243, r7
+L22: .data 330, -187, 936, 932, 605
+clr r7
+lea L28, *r1
+jmp X24
+L23: .data 92
+L24: .string "qwaovbuwaucysubcdankg"
+red L192
+inc r1
+jsr *r2
+inc L196
+L25: .string "n"
+red X17
+jmp L114
+prn L234
+L26: prn X11
+L27: mov #-198, X0
+lea L54, r7
+L28: .data -580, -332, -671
+prn r3
+jmp *r1
+stop
+L29: mov *r3, L144
+jmp *r0
+jmp *r6
+not r3
+mov r6, X7
+clr r4
+L30: .string "ygvjw"
+add *r3, *r3
+prn #196
+L31: bne *r3
+red L0
+cmp r5, #-79
+stop
+clr *r3
+prn #-188
+prn r4
+clr *r6
+
+L32: stop
+
+dec *r2
+red r7
+L33: sub L33, r6
+jmp *r2
+clr *r0
+dec r4
+rts
+rts
+mov #-81, *r3
+mov *r5, L17
+L34: .data 873, -177
+L35: lea L31, r4
+jsr X21
+add *r0, *r1
+rts
+inc r4
+L36: .data 363, -981, 311, -286, -47, 301
+bne X21
+cmp *r6, #179
+L37: sub *r6, *r1
+add L127, r1
+inc r4
+inc *r6
+red r1
+L38: inc *r7
+prn *r5
+dec r2
+jmp *r7
+jmp L51
+sub L18, X11
+jmp L97
+; comment
+L39: .string "josuvfoktvolrhmzqrakiwz"
+dec r4
+jsr *r3
+L40: clr *r0
+L41: .data -990
+L42: dec X1
+cmp r0, r1
+not r4
+jsr X21
+not r3
+inc r7
+L43: .string "atrjvmylhmbrx"
+L44: inc *r2
+rts
+sub r5, X2
+bne X17
+L45: rts
+jsr L226
+bne X3
+L46: mov X14, *r1
+add X8, *r5
+cmp L222, r6
+cmp #60, X23
+L47: stop
+L48: mov #-53, L70
+clr L242
+dec *r7
+prn *r4
+prn X0
+L49: inc r4
+dec L154
+dec *r0
+red *r6
+mov r6, *r3
+jmp L43
+L50: .data 28, 359, 565, 910, -204
+inc r0
+not *r0
+dec L253
+jmp L39
+L51: mov L155, *r7
+mov #-225, r6
+L52: .data 351, -793, 689
+L53: sub L16, *r1
+prn r1
+; comment
+jmp *r4
+L54: stop
+
+L55: rts
+L56: .string "vbxshw"
+jmp *r1
+stop
+L57: not *r2
+add r2, L100
+sub *r7, r4
+lea X8, *r7
+L58: dec *r0
+jmp L54
+inc L20
+prn *r5
+clr X22
+bne *r2
+sub #-58, *r6
+L59: .string "p"
+inc *r7
+L60: rts
+lea L51, L172
+prn r0
+sub #192, *r1
+not L231
+add L19, L57
+bne *r3
+jmp X13
+bne L94
+add *r1, X6
+jsr *r6
+jmp *r3
+L61: not r6
+rts
+bne L233
+bne *r4
+add #223, r4
+L62: not *r7
+
+rts
+L63: clr X19
+inc *r4
+dec r4
+L64: jsr *r6
+clr r4
+bne L62
+lea L28, X23
+L65: .string "eshigfb"
+red L40
+jsr X21
+mov L170, *r1
+L66: jmp *r4
+inc *r4
+bne *r2
+sub r3, r6
+jsr X2
+add #-139, r0
+L67: bne L10
+bne *r7
+L68: .data -227, -889, -13, 713, 28
+not L146
+sub L46, X13
+L69: rts
+stop
+L70: jmp L24
+mov X10, r3
+prn *r1
+rts
+add *r4, L33
+jsr *r1
+stop
+cmp #-155, #193
+clr L24
+
+L71: clr X10
+L72: inc X0
+mov r1, X24
+jsr *r3
+mov *r5, L169
+prn *r7
+cmp #245, *r5
+not L62
+L73: sub r6, *r3
+rts
+L74: .string "ahssozmwiulahayn"
+not *r1
+L75: bne *r3
+bne *r7
+L76: bne L69
+L77: add #-80, L77
+L78: .string "bfcwereqyaukbuetbkgqzh"
+sub #-104, *r1
+clr *r0
+cmp *r2, *r4
+; comment
+lea X14, L213
+; comment
+L79: dec X21
+clr L85
+L80: .string "z"
+stop
+add X16, L135
+
+sub r3, *r1
+sub L40, *r7
+jmp *r0
+L81: clr L49
+L82: .string "arcbwpreledvzzcde"
+inc r4
+L83: .data 706, -802, 470, -382, -201, 591
+stop
+clr L161
+dec X4
+rts
+L84: .data 611
+L85: .string "nbgauesk"
+L86: cmp r0, r7
+prn L132
+lea L143, X15
+inc L51
+L87: add #-3, r0
+jsr L238
+not *r0
+not L16
+L88: .string "grzcyruhw"
+L89: .data -708, -87, 397, -617, 741, -266
+jmp L229
+red *r3
+lea L62, L101
+lea X14, r4
+lea X17, X19
+not L158
+L90: red r6
+L91: jsr L139
+dec *r6
+; comment
+not r2
+lea L243, r0
+L92: prn L178
+prn r2
+sub *r3, *r3
+jsr *r7
+cmp *r0, *r0
+add #-256, L213
+L93: add r4, L165
+L94: red *r5
+prn r5
+L95: jsr X23
+L96: jsr *r0
+dec *r1
+L97: not *r6
+cmp L100, *r5
+rts
+L98: lea L34, X18
+rts
+; comment
+bne X14
+L99: jsr X22
+inc *r0
+L100: .string "dkpdqhgownsxvgw"
+L101: .string "ertxg"
+inc L13
+rts
+jsr *r3
+dec *r1
+jsr L210
+L102: bne *r7
+clr *r2
+L103: add r7, r4
+prn *r0
+clr r3
+lea L104, *r4
+red *r1
+
+add *r7, L24
+jmp *r2
+L104: rts
+sub r6, L60
+; comment
+
+not r1
+red r5
+inc *r3
+
+clr *r0
+prn r0
+mov r0, r3
+inc *r5
+mov r0, *r2
+dec L11
+inc X23
+inc *r1
+inc *r6
+add X17, r0
+rts
+red r1
+stop
+not L154
+stop
+sub r4, *r4
+clr L212
+L105: .data 980, -189, 486, 530
+lea L212, L61
+L106: cmp *r6, X8
+red *r6
+jsr X19
+
+L107: sub L1, L122
+prn L24
+
+; comment
+red r2
+stop
+; comment
+add L64, *r4
+bne *r4
+stop
+not X1
+add *r5, X9
+L108: mov #207, *r7
+jmp *r7
+cmp r6, *r5
+inc *r0
+L109: .data -378, 804, -309
+dec *r0
+sub #70, L38
+mov #-181, *r5
+jsr X13
+red r7
+L110: .string "ufnkykrznejrcunnxqkoad"
+jsr L9
+not L78
+L111: rts
+red *r5
+L112: .data -751, -687, 967, -556
+L113: not L6
+sub #-198, L178
+add #178, *r4
+add r5, r0
+
+bne *r3
+L114: sub #109, L119
+not L75
+L115: jsr *r4
+lea X3, X23
+L116: rts
+red r5
+jmp *r7
+L117: .string "xerxxidctazolqpiwdszt"
+L118: .data 364, -396, -603, -538, 99, -245
+prn #-73
+L119: .data -458, -639, -203, 205, -95, 622, -299
+dec *r5
+clr r7
+L120: not r2
+sub r5, r5
+jmp L70
+sub *r1, L252
+L121: jsr L206
+stop
+stop
+inc L15
+jsr X17
+red *r0
+
+L122: prn #136
+
+lea X13, *r0
+L123: sub *r5, r3
+add #84, r4
+jmp X3
+L124: .string "xzwzlap"
+clr L85
+cmp L94, L35
+L125: lea L163, L74
+lea L88, r5
+dec L22
+inc *r6
+L126: not L142
+bne *r6
+L127: jmp L23
+L128: bne L237
+rts
+prn r1
+red X21
+sub X17, r2
+sub #-153, r7
+jsr L19
+L129: .data 952, -731, 830, 583, -954, 466, -833, -213
+L130: cmp #-58, L39
+L131: stop
+L132: lea X19, *r0
+sub *r7, r6
+jsr X24
+stop
+L133: jmp *r0
+red r5
+stop
+inc r7
+L134: .string "tf"
+L135: rts
+jmp L63
+add X10, r0
+clr L212
+L136: jsr *r6
+red L206
+not L115
+bne L5
+stop
+
+clr *r2
+L137: jsr X10
+clr L188
+L138: clr L187
+lea L248, L38
+rts
+L139: stop
+cmp #-145, #206
+dec r4
+clr r2
+jmp X2
+L140: jsr *r4
+L141: add L173, X15
+red r5
+clr *r0
+dec r7
+clr L69
+bne X10
+cmp r6, L145
+rts
+red *r4
+rts
+rts
+L142: .string "jbbbyjphbqmeotg"
+jsr L75
+inc L105
+stop
+L143: inc X7
+stop
+cmp X16, #-144
+inc L11
+not r7
+
+L144: mov r2, X21
+bne L240
+L145: lea L118, r0
+mov X17, r0
+prn #-22
+jmp L118
+bne L71
+dec L31
+rts
+L146: .data 267, 364, 687, -728
+cmp #-194, *r0
+L147: .data 172, 263, 732, 650, -395, -512
+L148: jmp *r0
+L149: bne L55
+L150: stop
+prn #-55
+add r5, *r5
+sub *r2, r5
+stop
+dec L249
+not *r2
+prn r1
+L151: jsr *r6
+clr *r4
+dec *r2
+mov r1, *r7
+add #-84, *r5
+; comment
+lea L169, *r0
+L152: add r7, r6
+red r4
+L153: clr r5
+; comment
+not r4
+lea X16, *r4
+sub *r4, X7
+L154: mov #-216, r7
+add L110, r5
+clr r6
+stop
+L155: mov X16, r6
+bne L38
+L156: mov *r2, r5
+mov X5, X20
+add X10, *r3
+cmp *r7, r6
+; comment
+add L164, L248
+L157: jmp L137
+rts
+dec r1
+L158: cmp *r7, *r3
+L159: .string "zhqoxbcewenptsrtdvlp"
+red L134
+rts
+jmp X20
+lea X21, X3
+bne *r0
+not X5
+dec *r0
+sub r0, L231
+L160: .string "zmxqbuqaota"
+jmp L158
+sub #-119, *r1
+add *r2, *r5
+jsr X9
+L161: stop
+inc *r2
+red *r4
+prn L204
+mov L163, L159
+clr r6
+L162: .data -153, -189
+rts
+stop
+dec r2
+clr L179
+add r4, *r2
+L163: rts
+stop
+L164: lea X3, L52
+cmp *r2, r3
+; comment
+L165: rts
+prn *r3
+jsr L150
+mov L214, L24
+L166: rts
+jmp X15
+add X15, *r7
+L167: .data -9, 869, -802, 9, 210, -770
+sub *r3, r2
+mov #-37, *r3
+L168: .data -464, -721, -844, 324, 396, -436, -890
+L169: jmp *r7
+L170: .string "ncfmhrrgtaeva"
+clr L52
+rts
+add L27, *r0
+cmp L238, X1
+
+rts
+jsr *r3
+bne L254
+sub *r2, *r2
+stop
+; comment
+L171: .data -354, -792
+jmp X10
+clr L168
+sub r2, r3
+prn r5
+mov *r5, L178
+not r4
+mov r7, r0
+lea X24, X5
+jsr *r4
+L172: inc L202
+stop
+clr r1
+L173: dec *r3
+L174: bne *r4
+cmp *r6, r1
+not r1
+jmp *r2
+sub #244, *r7
+sub r3, r7
+bne *r3
+inc X21
+inc r4
+prn r1
+mov #-256, *r7
+L175: .string "pxhkorsxgwsrshgopyi"
+stop
+prn L200
+not r1
+L176: inc L48
+rts
+inc r4
+sub L235, *r7
+L177: inc *r1
+stop
+lea X8, L3
+prn *r7
+inc *r2
+L178: .string "kxcnjosigddknm"
+prn *r1
+L179: red *r1
+clr X2
+lea L64, L224
+L180: .string "khxfkdbjgsecdpjtpckwek"
+; comment
+lea L188, r7
+L181: .data -867, 77, -619, -733, -198, 696
+L182: .string "miqqelwf"
+jsr L138
+clr r3
+stop
+L183: .string "nffwafqhspqdyfxkyzeplzev"
+L184: mov *r4, X22
+mov r5, *r1
+stop
+L185: .data 127, 678, -942
+inc *r0
+mov X9, r7
+L186: .data 501, 75
+; comment
+L187: .data 787, 176, 588, 625, -733, 820
+dec L7
+sub *r5, *r6
+add *r4, r2
+cmp r5, *r2
+rts
+inc L245
+lea L226, L198
+L188: jsr X7
+mov #4, *r3
+jmp *r7
+L189: .string "ydgyjkjibehzzdnbxuzd"
+rts
+lea X24, L37
+L190: .data -543, -645, 952, -924
+rts
+L191: .string "ecksenrfapvgacyeoa"
+not *r2
+L192: red L207
+rts
+L193: .data 565
+add X13, *r5
+lea X19, X24
+L194: lea L213, *r0
+cmp r1, L73
+bne *r5
+add r7, *r7
+jsr L93
+red r4
+red *r5
+stop
+jmp *r3
+; comment
+add #149, *r2
+not L218
+L195: .data 916, 132
+L196: .string "apnpvanygqjdhihp"
+bne L104
+add L224, *r1
+jmp *r5
+; comment
+L197: mov r3, *r0
+red r7
+dec X13
+L198: sub r5, X22
+stop
+lea X3, r1
+cmp *r1, #-80
+rts
+L199: .string "tyylsoyprknftu"
+rts
+lea L24, *r1
+jmp L207
+cmp r6, #150
+clr *r4
+cmp L160, *r4
+L200: mov #72, *r6
+not *r0
+L201: .string "xugsomupjdmh"
+; comment
+lea X0, *r6
+L202: cmp L233, *r1
+prn *r2
+jmp L115
+lea X1, X3
+sub r1, r6
+sub r2, X4
+prn #191
+prn #-99
+stop
+sub L159, L208
+dec *r7
+not L221
+prn #254
+sub *r1, r2
+
+dec L29
+add X3, r5
+L203: .string "jegnjnehmhmyzlhhukszmitx"
+L204: prn #48
+not *r1
+dec L214
+L205: sub r7, *r4
+L206: .data 270, -520, -482, 961, -432, -130
+bne X10
+inc *r7
+jmp *r6
+sub L76, *r7
+stop
+jsr X5
+L207: red X4
+mov #63, L145
+red r6
+add #32, X2
+cmp r3, #177
+prn L209
+sub *r5, *r3
+prn *r1
+L208: add #-87, *r2
+rts
+L209: .data 96, 734, -256
+prn X2
+; comment
+not L239
+stop
+bne L107
+
+
+L210: inc r5
+bne X21
+jsr L71
+add *r6, L232
+add X13, r5
+L211: .string "uieekshfss"
+L212: jsr *r4
+prn L165
+prn *r1
+L213: inc *r7
+; comment
+lea X10, L219
+stop
+cmp *r6, *r5
+red *r7
+sub *r0, r5
+
+
+bne *r5
+L214: .data 662, -549, -798, 11
+add #-179, *r5
+inc *r7
+L215: clr *r3
+clr L47
+mov *r2, X3
+not r2
+red *r3
+L216: .string "pbfbfizhayxkckfz"
+L217: lea L57, L253
+L218: clr L241
+L219: mov *r2, *r3
+not r6
+clr r2
+
+red *r5
+mov r5, r2
+dec *r0
+prn r1
+cmp r4, *r7
+L220: .string "ernpkmkcylrohioucqvx"
+L221: .string "fddvacgepwxhmvmwestb"
+stop
+L222: rts
+mov r7, *r1
+red X0
+dec *r5
+not r6
+rts
+jmp *r1
+; comment
+clr *r2
+inc r1
+lea L36, X15
+L223: not *r0
+lea X22, r2
+L224: clr X13
+L225: .string "wxgafjqtshszeoyxxekwqz"
+L226: jsr *r2
+sub #-28, X3
+clr L83
+sub r2, *r6
+bne L15
+inc r5
+bne L61
+lea X18, X7
+L227: dec *r3
+L228: prn *r4
+L229: .string "ucirobumoclqjrdcimpbzbd"
+not L22
+dec *r0
+not *r6
+prn r5
+L230: inc r5
+clr L107
+not *r3
+not *r4
+
+L231: add *r6, r5
+L232: clr L248
+
+L233: .string "tmeiauymt"
+L234: .data -914, 486
+add #-200, r7
+L235: lea L238, r1
+bne L250
+jmp *r3
+sub r6, r1
+bne *r3
+L236: .data -241, 52, -52
+L237: mov L71, *r6
+mov #198, *r1
+mov r0, r5
+jsr *r3
+L238: .data -23
+add #-39, L123
+sub L245, X18
+lea L246, L249
+inc r2
+cmp *r6, L240
+red *r1
+add r6, L38
+sub #-42, *r5
+inc L240
+lea X14, r1
+dec r3
+sub *r4, r0
+L239: red r2
+mov #-247, r6
+stop
+L240: mov X8, L36
+
+; comment
+sub r5, r4
+prn #-112
+red r3
+L241: cmp *r3, r1
+jsr L245
+inc L139
+cmp *r5, #250
+rts
+not *r0
+L242: .data -510, 541, -104, 914, 906, -887, 10
+L243: .data 438, 867
+jmp X5
+lea X3, r1
+inc *r5
+L244: .string "xsgqqau"
+L245: .data -567, 452, 171, -505
+mov r3, r6
+red X0
+jsr *r5
+cmp #170, #33
+dec r2
+lea L253, r4
+not r4
+jsr X0
+L246: cmp #192, L247
+; comment
+cmp X13, #181
+L247: inc r5
+L248: sub X14, r7
+add *r2, r4
+prn L253
+L249: jmp *r7
+L250: .string "ah"
+sub #168, *r7
+stop
+prn L254
+not *r2
+stop
+dec *r4
+jsr L179
+bne *r7
+prn *r4
+prn #-52
+clr *r3
+L251: .data 368, 677, -279, -877, 193, 992, -633
+L252: rts
+inc X0
+prn *r3
+clr X13
+not r3
+
+clr *r6
+lea L253, X24
+mov #119, L255
+stop
+L253: not *r4
+red X22
+; comment
+dec L237
+jmp L256
+L254: .string "mwhonmjdnr"
+
+L255: rts
+sub r0, *r6
+L256: bne X11
+inc *r6
+stop
@@ -0,0 +1,1045 @@
+; Generated by genCorpus --seed 43
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+L0: rts
+clr *r1
+mov r2, *r7
+prn r5
+L1: red r1
+not X5
+L2: .string "xywpkjjdimwhphtjmqyfaq"
+cmp *r3, L0
+lea X9, *r3
+lea L18, r3
+not L257
+L3: mov #-253, *r5
+; comment
+jmp L2
+stop
+add L2, L60
+rts
+mov r0, *r2
+mov *r6, L2
+clr *r7
+stop
+bne *r7
+prn #-226
+mov *r5, X13
+stop
+stop
+bne L34
+L4: jsr *r2
+L5: red X19
+rts
+L6: .data 361, 104, -861, -914, -106, 657, 478
+L7: bne *r2
+sub X10, L6
+L8: .data -434, -619, -318
+L9: clr *r2
+
+jsr *r4
+clr L6
+L10: .data -63, 890, -716, 134
+clr X18
+; comment
+L11: .string "tbgybgmqjvfndcstd"
+lea L1, *r4
+not r7
+L12: .string "ifkmods"
+jsr X9
+L13: lea L104, X18
+L14: rts
+lea X22, X20
+dec X20
+not *r7
+L15: rts
+mov #-75, r0
+jmp *r1
+lea L3, r1
+dec r4
+dec *r2
+red L9
+L16: red r2
+rts
+jmp L76
+L17: jsr *r1
+L18: jsr *r1
+mov L18, *r3
+add r1, r4
+cmp L111, L1
+not L28
+jsr *r3
+L19: .string "jampanwrorm"
+inc r2
+L20: .string "ylinhzramuyyvoc"
+jsr *r5
+mov L135, r4
+bne *r4
+cmp *r5, L3
+jsr *r3
+L21: cmp #26, *r5
+clr r3
+L22: add #94, *r3
+L23: .data -429, 971, -874, -940, -696, 620, -262
+; comment
+not *r3
+red *r7
+add #227, *r0
+sub *r5, L242
+jsr L3
+lea X23, *r0
+sub X2, L30
+L24: rts
+jsr L6
+red r4
+cmp *r6, #191
+L25: .data 401, -545, -347, -190, 625, -282, 202, 507
+prn #-4
+mov r2, L62
+L26: dec *r7
+prn #-52
+bne *r1
+jmp *r2
+jsr X15
+lea X12, *r0
+add r0, r6
+L27: .string "bwccoby"
+bne L12
+L28: .data -386, 683, -505, 339, 902, -492
+jmp L5
+cmp L214, #-93
+stop
+L29: .data -377, -542, -456, -801, 699, 350, -895, -106
+L30: stop
+; comment
+stop
+L31: .data -516, 568
+mov *r2, r3
+dec r7
+L32: .data 257, -602, 961, -201, -197
+cmp r0, *r1
+bne X6
+inc r2
+lea L72, X23
+L33: .string "evmmcddhdrknogwdmyviu"
+red X11
+not r5
+L34: .string "ojhlhpsispzdtyxtozyiwkon"
+clr r4
+cmp L122, #-179
+L35: .string "mndrstfcyxdic"
+prn #-59
+cmp L23, #141
+lea X19, L250
+; comment
+bne *r1
+jsr *r6
+cmp #120, L178
+; comment
+L36: dec *r2
+cmp X7, *r5
+lea X17, r7
+rts
+L37: add #45, r7
+bne *r3
+bne L127
+L38: mov X6, X21
+rts
+jsr L25
+stop
+jmp *r5
+lea X19, *r0
+L39: dec r1
+sub r4, r3
+jmp *r1
+sub *r4, L33
+sub *r3, L22
+red *r7
+L40: .data 959, 191, -69, -883, -964
+lea L190, *r2
+not *r7
+L41: .data 894, -754, 89, 333, -392, -290, -845
+stop
+jmp *r7
+L42: .data -80, -282
+dec L20
+red r0
+stop
+L43: jsr L6
+inc *r1
+lea L230, r7
+rts
+red L5
+inc *r0
+jmp L37
+L44: jmp *r6
+sub r5, L41
+L45: stop
+L46: jsr L15
+clr r0
+jmp *r5
+not *r4
+; comment
+add #-145, r6
+stop
+jmp X2
+cmp *r1, *r0
+rts
+add r3, r0
+sub X1, *r5
+clr *r1
+clr *r4
+lea X13, L1
+L47: sub *r5, *r4
+L48: .data 439, 721
+sub #10, L166
+L49: bne X5
+rts
+L50: lea X4, *r0
+; comment
+L51: mov r4, *r1
+prn #-105
+rts
+bne X12
+inc *r1
+not *r6
+L52: .data -908, 212, 48
+rts
+jmp *r7
+clr *r6
+L53: add L45, *r1
+inc r7
+jmp L240
+cmp r6, *r5
+rts
+L54: .string "xebghmt"
+L55: add X4, *r3
+jsr L182
+stop
+L56: clr *r5
+jsr X14
+jmp X6
+dec L14
+
+L57: clr r1
+L58: .string "xtlmrwryzfw"
+L59: clr *r0
+lea L169, r2
+bne X3
+rts
+rts
+L60: cmp #128, X19
+lea X6, L14
+bne *r3
+mov #104, *r5
+sub #-192, L61
+L61: red r1
+L62: .data 758, 956, 907, 641
+stop
+dec L209
+clr *r6
+inc *r5
+sub #-220, r1
+bne *r4
+clr X14
+cmp r4, #34
+bne *r1
+mov X19, *r7
+dec r1
+prn #-221
+rts
+cmp #-243, L9
+lea L56, *r7
+rts
+dec X8
+jsr L270
+L63: lea L5, L22
+L64: .string "khvwpkddcui"
+L65: cmp r3, #228
+stop
+mov #235, *r4
+L66: not L217
+clr *r2
+stop
+red *r4
+not *r1
+L67: jmp L135
+L68: inc L254
+clr *r1
+L69: .string "brsyaxy"
+stop
+cmp r2, #-252
+prn L9
+add *r7, r5
+jsr *r0
+clr *r4
+lea X8, *r5
+dec L93
+clr *r5
+not r7
+prn X13
+rts
+rts
+bne *r3
+not *r2
+prn #124
+mov r5, *r0
+L70: .data -176, 749, -953, 649, 375
+L71: red L176
+L72: clr L169
+cmp #-190, #-181
+stop
+stop
+L73: lea X11, r1
+lea X0, *r2
+L74: sub X9, L44
+add *r2, L51
+L75: .data -765, 161, 914
+; comment
+add X21, L53
+bne *r5
+inc L194
+L76: bne X8
+L77: inc L24
+prn *r7
+inc X18
+jsr X10
+prn *r0
+clr L41
+L78: rts
+red L186
+sub *r6, X23
+add *r1, L138
+red *r2
+L79: not r2
+not r4
+
+add #-173, *r6
+lea L19, *r5
+mov #254, *r0
+clr r6
+L80: lea X17, L121
+jmp X9
+L81: jsr L21
+L82: lea L133, *r4
+add X8, r0
+inc r4
+inc X12
+L83: lea X5, *r5
+L84: .data -779, -110, 547
+bne *r5
+red L41
+dec L22
+lea L221, L221
+clr r0
+not r7
+lea L124, *r7
+L85: red *r2
+dec *r2
+clr r1
+dec r7
+stop
+clr X0
+L86: prn r4
+stop
+L87: rts
+sub r4, X9
+L88: dec X20
+L89: prn *r6
+cmp #-205, *r6
+cmp r2, r5
+L90: .data 121, -919
+inc r3
+jsr L39
+not X22
+L91: .data 188, 42, 819
+jmp X24
+L92: .string "tnfpslqzzdwb"
+not r0
+sub *r4, X14
+sub L239, *r3
+red r1
+L93: lea L114, *r7
+red r0
+L94: not *r1
+lea X0, L182
+clr *r7
+L95: prn r0
+stop
+clr X13
+
+L96: .data -887, -504, -25, -530, -392, -59
+L97: .data -623, 524, 885, 648, -186, -491, -379
+not X8
+L98: mov L23, X20
+
+jmp *r0
+; comment
+not r4
+L99: .data 454, 198, 956, -468, -719, -270, -485, -76
+mov *r3, *r4
+L100: red r2
+cmp *r6, r1
+bne *r3
+L101: jsr *r2
+rts
+L102: add *r1, r3
+clr *r2
+L103: prn *r1
+L104: .data 65, -175, 413, -194, 944, -894, 379, 451
+red *r7
+prn *r3
+clr *r3
+stop
+L105: red r6
+L106: .data 693, 880, 288
+L107: .string "iwyjngmfz"
+L108: cmp #-129, L28
+jmp *r5
+dec r6
+lea X20, *r0
+L109: prn r1
+L110: .data -870, 643, 361, 315, -190, 443, -81, 196
+jsr X9
+clr X14
+not r0
+L111: red *r5
+inc L184
+L112: .string "sweg"
+sub *r4, r6
+L113: jmp *r0
+jsr X12
+add #99, L153
+stop
+lea L67, r0
+L114: .string "ialpuflgezcoobwkntptctr"
+; comment
+mov r3, X7
+inc r0
+stop
+inc X1
+stop
+inc *r1
+add *r0, L134
+jsr X10
+L115: .string "fmb"
+L116: add r5, r1
+prn r4
+red r5
+jmp *r5
+red X12
+not X4
+sub L149, L105
+L117: .data -348, 235, -753, -875
+mov *r7, *r0
+rts
+clr L181
+
+lea X21, X3
+L118: dec r1
+stop
+L119: sub *r5, r2
+L120: red r1
+jsr X6
+bne L83
+add *r0, *r5
+cmp *r6, r6
+; comment
+not r0
+L121: cmp *r3, *r2
+inc *r6
+dec *r6
+lea X7, X20
+sub L53, *r5
+inc L122
+not r3
+jsr L267
+mov r6, r6
+L122: add X15, r7
+L123: rts
+L124: stop
+jsr L195
+cmp *r3, *r7
+L125: .data 71, -716, -763, 690, -47, -355, 985, -317
+bne *r3
+L126: not X3
+jmp *r3
+add L251, r0
+L127: jsr *r0
+mov L37, r5
+stop
+L128: .string "necuxqxv"
+stop
+sub X22, X9
+dec *r2
+L129: bne *r0
+add #-138, *r0
+L130: not L111
+L131: .string "lceikhgtmpg"
+sub r3, *r0
+L132: .data -641, -394, -430, 341, 106, -969
+clr *r0
+; comment
+lea L140, r1
+jsr X17
+not L15
+L133: not L146
+red *r4
+L134: lea X21, *r0
+jsr *r4
+dec L129
+clr *r1
+prn L49
+cmp r4, r0
+L135: .string "jcnnveaxvqmlxwcwcbsldi"
+add *r0, r0
+L136: prn *r4
+rts
+cmp *r5, *r6
+jsr L183
+L137: prn r3
+L138: jmp *r7
+add #-16, X9
+prn X23
+add L135, r0
+L139: .string "hxiyrzmmwy"
+L140: .data 685, -994, -824, 261, 311
+not r7
+L141: not L182
+L142: .data -151, 582, -164, -462
+L143: red L24
+sub *r3, r7
+L144: .data -831, -401, 701, 97, -22, 816, 790
+bne *r1
+
+mov *r0, X16
+jsr X2
+dec r0
+L145: add *r5, *r0
+red L164
+rts
+clr r2
+L146: prn L33
+L147: cmp r3, X19
+L148: jmp *r1
+dec X0
+sub *r0, X1
+dec *r2
+stop
+prn *r0
+L149: .data 240, -634, -617, 543
+L150: .data -491
+stop
+inc *r6
+bne *r4
+add r2, X20
+L151: jmp *r5
+jsr *r1
+sub r7, X24
+clr L94
+clr *r2
+
+L152: .string "ob"
+lea X18, r1
+cmp L154, r7
+stop
+L153: not *r6
+bne *r6
+prn L263
+; comment
+bne *r6
+dec *r1
+
+L154: jmp X6
+L155: .string "njjpwgaqngynwiq"
+L156: .data -871, -66, 554, 722, -230
+cmp *r1, X11
+add #99, r6
+; comment
+cmp #-83, X0
+L157: .string "klhelcchthqqzfvasir"
+L158: sub X14, X9
+add r3, r2
+add #140, r3
+jmp *r0
+inc *r4
+inc r4
+L159: .data 976, 970, 234, 160, 632, 565, -162, -733
+L160: .string "zdvk"
+add r6, L112
+rts
+inc *r7
+sub #-53, r7
+L161: .data -7, -883, -2, 307, -156, -107
+L162: .data 113, 415
+L163: .data 441
+L164: stop
+L165: not r1
+sub r4, *r6
+L166: prn r1
+add r5, r7
+add L28, r4
+prn #-161
+inc r2
+L167: add #80, *r6
+lea X21, *r3
+red *r4
+
+mov *r2, *r4
+bne *r1
+lea X2, r3
+L168: dec r2
+sub #-141, r3
+cmp r3, X8
+jmp *r5
+inc L261
+red r6
+stop
+L169: prn #-240
+jmp L221
+not *r4
+
+L170: jsr L158
+bne *r0
+not X18
+jmp L122
+lea X8, r0
+inc r3
+not *r7
+inc r0
+jmp X11
+L171: red *r1
+clr r0
+not L254
+prn *r1
+stop
+lea X15, *r5
+bne *r5
+stop
+jmp *r1
+inc L207
+rts
+red L122
+jmp *r1
+
+prn r7
+lea L13, *r0
+L172: .data 364, 373, -151, 999
+jmp L27
+clr L123
+L173: .string "p"
+red *r4
+L174: mov r0, X1
+clr *r1
+L175: .data -623, -203, 810, -745, -377, 186, 751
+L176: jsr L190
+lea X18, r5
+L177: .string "rjqbkgu"
+mov L165, r5
+sub #-25, X4
+L178: jmp X23
+jmp *r2
+stop
+L179: inc r2
+sub *r6, r2
+inc L244
+prn *r5
+sub L217, X12
+jmp *r1
+L180: .string "kqovqlhrejpopsidqxtzba"
+dec L210
+stop
+red *r5
+not L155
+jmp *r7
+mov r7, *r0
+lea X16, r6
+L181: .string "etyusavnchlemupzlta"
+inc r2
+L182: jsr *r2
+lea X21, r0
+L183: .data -544, -54, 271, 468
+clr *r7
+jmp X23
+red r1
+L184: mov L222, r2
+jsr X4
+; comment
+bne *r6
+sub r0, *r0
+stop
+sub L147, *r0
+clr *r6
+lea X19, *r6
+
+inc L191
+jsr *r0
+dec *r5
+not *r7
+stop
+rts
+stop
+jsr L229
+bne *r1
+L185: .string "iyddwtmtuuxrmozswfzjcqi"
+L186: .string "jwijgirimmp"
+not X22
+
+rts
+L187: jmp *r4
+red r7
+bne *r1
+L188: .string "siqvkgn"
+cmp *r3, r6
+bne X8
+clr *r3
+cmp *r0, r0
+L189: clr X15
+L190: jmp *r0
+L191: clr r2
+L192: .data 55, 920, -202, -7
+jsr *r6
+bne *r6
+inc r2
+clr r0
+clr r5
+lea L117, *r2
+L193: .data -153, -114, 461, 32
+add #86, *r0
+stop
+clr X2
+L194: .string "ydpwg"
+; comment
+add r5, *r7
+L195: .data 52, 900
+red *r5
+L196: .string "sdxoaxezgytaefqkextwdpqs"
+not *r3
+prn #111
+cmp #-4, #-66
+L197: .data 72, 8
+jsr L266
+L198: clr L7
+jmp *r1
+not *r4
+bne *r5
+L199: lea X2, r0
+jsr X11
+L200: .string "ergwmijwrfvf"
+L201: stop
+L202: rts
+prn L83
+L203: jmp L101
+jmp *r4
+not *r6
+prn X20
+red *r0
+L204: red *r4
+mov #17, X14
+L205: lea L39, X9
+L206: .string "mq"
+cmp L245, *r7
+L207: prn *r1
+not L255
+bne X12
+add X11, *r5
+prn X17
+prn r6
+stop
+L208: .data 349
+L209: prn #195
+L210: dec L219
+not X10
+; comment
+L211: stop
+sub #130, *r0
+L212: .data -779, -991, -610
+inc r0
+stop
+prn *r0
+sub r7, X11
+L213: dec *r5
+jmp *r4
+cmp #178, *r0
+jsr *r7
+bne X12
+
+L214: .string "vccwybovni"
+L215: .string "xdn"
+L216: .string "fr"
+L217: jsr X4
+not L251
+jsr L268
+bne L69
+L218: .data 239
+L219: stop
+L220: not r7
+L221: .data 106, -653, 4, 157, 389
+L222: stop
+clr r3
+stop
+sub r4, *r1
+red *r3
+L223: jsr *r6
+bne L240
+rts
+cmp *r0, r5
+stop
+cmp X0, *r7
+cmp L259, #84
+mov L122, *r1
+sub #2, r7
+L224: red *r5
+jsr *r6
+L225: .string "khpwhzmhxkto"
+inc r0
+sub #141, r2
+inc *r0
+
+sub #40, L110
+dec r5
+lea X14, r7
+L226: .string "sxbstcgmatwgnlv"
+jmp L103
+jmp *r7
+L227: mov X12, r5
+red r6
+add r1, *r0
+bne L109
+jmp L259
+red *r2
+rts
+not r1
+L228: not *r6
+L229: .string "tynkeafacj"
+inc L230
+not *r3
+L230: .data 19, 904, 707, 847, 625, -143, 499
+L231: .data -401, -274, 306
+
+jmp X14
+stop
+jmp L237
+inc r7
+L232: cmp #-204, #-188
+jsr X21
+L233: red X6
+mov r1, r1
+bne X14
+sub r6, r4
+L234: .string "jzfknxe"
+L235: stop
+add #-234, *r7
+inc r1
+cmp X6, r6
+inc r2
+sub r0, r0
+lea L50, *r3
+L236: .string "kemxzkvpevnifv"
+sub #50, *r1
+cmp #-166, r3
+prn L244
+jsr *r4
+L237: .string "uxmhygklfytfrwui"
+bne L156
+dec *r5
+sub *r4, *r7
+jmp L85
+L238: sub #235, L260
+L239: lea L261, L275
+dec *r1
+stop
+clr X23
+jmp L159
+mov X15, L193
+add L271, L264
+lea X8, X20
+jsr L258
+dec *r7
+L240: sub r6, L262
+inc r6
+red r5
+L241: sub L126, X9
+cmp *r1, #-153
+sub #-239, X17
+add #-197, X17
+add X17, L67
+inc *r4
+bne L243
+prn *r5
+red *r1
+L242: add L167, L194
+not r1
+prn r7
+L243: mov X5, r3
+mov r3, X13
+cmp r5, X11
+jmp *r2
+red *r6
+dec *r2
+jmp X14
+L244: .data -8, 795, 39
+dec *r2
+bne L257
+prn *r3
+L245: stop
+not r2
+L246: jsr L253
+jsr X24
+L247: not *r7
+
+mov r2, L264
+L248: .data -404, 106, 199, -221, 42, -469, -295, -267
+not *r1
+jsr X0
+L249: .data 728, -27, -742, 824
+clr L259
+inc *r4
+stop
+L250: .data 575, 778, 642, -625, -491
+jsr L255
+add #131, *r4
+jmp L274
+mov X23, r6
+rts
+add r6, *r1
+rts
+L251: cmp L180, r2
+rts
+sub *r7, L268
+not L168
+lea X15, r7
+; comment
+dec r2
+L252: bne L269
+lea L267, *r6
+L253: lea X2, r4
+lea L136, L268
+jmp *r3
+sub X3, *r2
+sub #212, *r4
+mov #-201, r2
+red X1
+add #-151, L258
+prn X21
+dec *r1
+sub *r5, *r4
+cmp r3, L27
+jmp X18
+L254: not *r2
+L255: inc L163
+clr *r7
+L256: dec *r1
+add *r2, X20
+L257: .string "ze"
+bne *r2
+not r3
+dec L271
+L258: jmp X21
+L259: .data 113, -275, -33, 37, -809, 731
+L260: bne *r1
+bne L267
+L261: jmp L265
+lea X5, *r0
+L262: clr r0
+sub *r4, L80
+dec *r0
+lea L67, *r5
+L263: .data -761
+jmp *r3
+clr r0
+cmp #-126, #142
+dec *r2
+clr L179
+add #-82, *r2
+dec *r0
+red X24
+dec r6
+sub #193, L271
+add *r4, X8
+jmp *r2
+
+not X20
+lea L83, *r7
+inc r5
+; comment
+inc *r2
+cmp L271, L268
+L264: lea L56, *r1
+L265: clr X22
+lea L187, *r6
+clr L275
+inc X22
+not *r5
+sub r6, r3
+mov #-182, X2
+L266: .string "svlkxokcvjcfxfvyv"
+add #12, *r1
+L267: .string "qqeecmpwnnawgxpx"
+inc r4
+
+red r0
+L268: mov *r0, r3
+red *r7
+prn r6
+L269: stop
+cmp #-50, r5
+not *r1
+prn #247
+prn r2
+L270: .string "vaavnnqnkl"
+lea X24, *r4
+jmp *r1
+cmp #-256, #59
+L271: .string "s"
+sub r1, r5
+jmp L237
+jsr *r7
+L272: inc r0
+jmp L273
+L273: .data 101, -957, -23, -999, -933, -933, -201, 507
+red r4
+L274: jsr L39
+L275: add L72, *r2
+stop
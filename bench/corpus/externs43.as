@@ -0,0 +1,1043 @@
+; Generated by genCorpus --seed 44
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+
+rts
+add #120, *r6
+L0: not X7
+L1: bne *r7
+L2: rts
+prn r4
+dec r2
+mov #19, L225
+rts
+sub r4, L0
+prn #210
+rts
+lea L1, r5
+sub #-74, *r7
+sub r0, r2
+stop
+jsr X18
+jmp L1
+add #127, *r3
+clr r5
+lea L2, *r5
+red *r6
+bne L58
+L3: jsr L3
+cmp r3, L235
+mov r7, X1
+L4: add r6, *r1
+L5: jmp L5
+clr r5
+dec r1
+L6: rts
+rts
+rts
+jmp *r1
+L7: stop
+sub #34, *r1
+rts
+jsr *r5
+L8: cmp #9, r0
+sub #158, r2
+not r7
+clr X16
+L9: lea X24, L64
+add r5, L188
+L10: cmp r2, r6
+prn X11
+L11: not L8
+sub X12, r7
+rts
+jsr L1
+inc r3
+rts
+L12: cmp #200, r4
+cmp L4, *r7
+L13: .string "oyxsuqtdfngpkpbczioywxvg"
+L14: add r3, r1
+inc *r1
+not *r0
+jsr L151
+clr X14
+clr r1
+rts
+red r6
+lea X12, *r5
+cmp *r3, #-134
+dec r3
+sub X15, X9
+red r2
+L15: .data -178, 234
+prn #14
+L16: .string "rpaydoxhwg"
+clr r3
+add *r2, r7
+sub X4, *r3
+clr L22
+clr *r2
+bne *r5
+lea L64, r2
+inc r5
+L17: .string "shlnuzgkfqm"
+red r2
+L18: jmp X3
+L19: .string "bgbwojgjtbgndlwyqebcujj"
+dec r4
+stop
+jmp X18
+L20: .string "q"
+L21: .string "f"
+sub L9, *r2
+clr L20
+jmp *r7
+lea X6, L21
+bne *r0
+stop
+lea X16, r3
+L22: .string "dhhxdabfwetcgpsphyovp"
+L23: lea L6, L19
+add #233, L20
+add r0, r6
+cmp X2, #-148
+cmp #240, #78
+L24: prn *r7
+sub L19, L62
+red L251
+not *r7
+L25: mov *r5, *r1
+L26: stop
+L27: .string "pfptxmtumeqnzpzmfdpih"
+not L163
+stop
+inc r5
+rts
+dec *r1
+bne *r6
+L28: sub L119, X19
+red r0
+not L233
+stop
+add #57, *r4
+L29: stop
+clr r2
+red L215
+L30: .data 515, -388
+add *r0, *r1
+mov *r4, *r0
+clr r7
+mov L15, *r4
+L31: lea X13, L152
+sub L101, r5
+rts
+L32: rts
+dec r1
+cmp *r5, *r5
+
+bne X3
+lea L21, L235
+L33: sub X8, *r2
+not L205
+inc *r2
+rts
+jsr X23
+dec *r6
+L34: .data 608, 324, -450, 857
+L35: .data 327, -43, 210
+prn *r5
+clr L9
+prn #221
+L36: not L21
+prn r2
+jsr *r4
+mov #6, L24
+red r0
+L37: red r2
+L38: .data -871, -191
+not L27
+jmp *r0
+L39: stop
+lea L56, r5
+red L38
+jsr X18
+cmp r4, *r2
+L40: .data 669, 193, -256
+stop
+jsr *r1
+L41: .data -153, 572, -492, -317, -905, -291
+sub L22, r5
+L42: prn *r0
+red *r0
+jmp X18
+L43: mov *r1, r6
+L44: lea L199, r0
+
+bne L40
+lea L93, X17
+jmp *r2
+not L15
+prn *r2
+rts
+; comment
+jsr L47
+lea X12, L107
+bne L203
+mov L213, L79
+clr r4
+jmp *r6
+add r3, *r1
+jmp *r1
+stop
+inc X6
+
+inc r2
+red *r4
+L45: dec r1
+clr L33
+mov X19, *r3
+L46: not *r4
+dec r5
+bne L23
+L47: jsr *r7
+prn L39
+rts
+not r5
+jsr X7
+L48: .data 44, -674, -936, -130
+prn #176
+L49: jmp L167
+red *r3
+dec L3
+L50: not r2
+sub L111, L84
+inc *r2
+L51: bne L177
+L52: inc X0
+mov *r2, *r7
+jsr L186
+L53: cmp *r6, L42
+L54: .string "h"
+prn #87
+bne *r4
+L55: inc *r2
+jmp X8
+jmp X4
+prn *r2
+jmp X9
+L56: .data 129, -663, 918
+sub *r3, *r1
+not r0
+L57: .string "zkbopvmngv"
+inc L18
+sub L233, r1
+stop
+rts
+prn X4
+red *r3
+cmp X5, r6
+sub *r2, L21
+not *r2
+L58: sub X23, *r4
+cmp r5, *r0
+stop
+lea L29, X7
+L59: .data 246, -250, -574
+inc r7
+add r4, *r4
+lea X17, *r3
+stop
+cmp *r7, r4
+jsr *r3
+; comment
+add L107, L215
+dec L193
+lea X16, X9
+lea X20, r6
+mov r4, r5
+L60: add r1, *r2
+; comment
+L61: not X12
+L62: not L54
+lea X18, *r2
+stop
+L63: .data 802
+red r6
+sub X13, X21
+lea L40, *r3
+lea X11, r6
+mov *r2, r4
+L64: clr r0
+sub r7, *r6
+cmp *r5, r5
+jmp L165
+L65: add #-190, r0
+jsr *r1
+
+sub *r5, r0
+mov L23, r2
+L66: rts
+L67: stop
+not L172
+prn r2
+stop
+L68: .string "sbcnor"
+rts
+jsr *r4
+bne *r0
+jmp *r5
+mov #-205, L23
+jsr X7
+inc *r6
+rts
+bne *r2
+clr L29
+L69: prn r3
+mov r7, L7
+L70: not L232
+jsr *r7
+L71: red X8
+bne X22
+stop
+mov r1, X20
+inc X9
+prn #43
+inc r5
+not *r5
+
+dec *r7
+lea X22, *r7
+prn #-178
+mov #-231, L190
+stop
+rts
+not *r3
+not *r5
+inc L80
+L72: rts
+L73: rts
+L74: jsr *r5
+mov X8, X22
+L75: .string "nwslqzwn"
+not *r4
+not L38
+not X13
+dec X9
+jmp X19
+red *r5
+L76: add r1, *r2
+
+L77: .string "kvdsqmbolyco"
+stop
+jsr *r5
+
+L78: .data 531
+lea L229, *r4
+dec r1
+L79: clr *r5
+inc *r4
+not *r5
+L80: .data -960, -388, -907, -896, 577, 358
+L81: .data 860
+sub r4, r3
+L82: .data -778
+L83: red L96
+clr L253
+sub X23, *r7
+L84: .string "rsc"
+; comment
+L85: dec r7
+prn X22
+L86: .data -311, -791, -745, -375, 515, 769, 521
+clr r3
+not r0
+L87: clr X15
+add *r7, X16
+L88: rts
+stop
+cmp r1, #130
+jmp *r5
+L89: .data -74, -174, 521
+L90: .data 275
+jsr *r1
+not *r4
+L91: lea L58, *r6
+red L83
+jsr *r4
+clr r7
+clr r2
+jsr L84
+L92: .string "wphiwjll"
+inc *r3
+L93: .data 335
+mov L15, r3
+L94: .string "lctp"
+L95: clr L237
+L96: .data 649, 497
+mov L18, r0
+jmp *r5
+jsr X24
+lea L154, r1
+red X20
+L97: mov X0, *r6
+dec r1
+stop
+L98: jmp X4
+dec L68
+L99: red X10
+L100: .data -845, -477, -953, -48, 878
+clr X5
+L101: mov #211, *r7
+L102: .string "i"
+jmp *r2
+jmp L144
+clr L116
+L103: red L96
+L104: prn r6
+clr *r0
+inc *r4
+cmp *r2, *r4
+cmp *r0, r7
+jmp *r5
+mov #23, X22
+bne *r3
+stop
+add *r4, *r7
+mov r4, *r4
+rts
+stop
+L105: rts
+prn r0
+L106: .data 24, -213, -444, 778, -843, -513, 778, -219
+L107: sub r1, X10
+L108: mov *r3, *r1
+clr L180
+bne *r6
+clr *r4
+sub r7, r5
+add *r6, X15
+add r5, r4
+bne X14
+L109: dec *r4
+L110: not r0
+rts
+jsr *r3
+L111: jsr *r3
+jsr *r5
+inc L233
+L112: red L62
+cmp L227, X12
+jmp X13
+sub #31, r0
+lea L134, r3
+sub r1, *r1
+cmp *r7, X8
+L113: .string "hykepnsxtxjx"
+jmp X6
+L114: mov #-135, *r0
+add r4, *r5
+mov X14, *r4
+prn *r4
+L115: stop
+stop
+red *r2
+jmp L7
+red r4
+lea X1, r4
+L116: bne L174
+rts
+not r6
+L117: mov #135, L70
+jmp *r5
+add *r4, X7
+mov r5, r5
+sub *r3, X14
+inc r1
+mov r7, r3
+rts
+add X18, L209
+sub #-240, *r6
+; comment
+L118: dec X6
+stop
+clr r7
+jsr *r4
+add #247, X21
+clr r0
+inc r3
+rts
+L119: .data -65, -618, -275, 204, -265, 403, 136
+jmp *r6
+; comment
+clr r3
+stop
+L120: red *r4
+L121: clr *r3
+not r3
+cmp #64, r5
+L122: dec r0
+mov L89, *r4
+dec L155
+inc L58
+inc r3
+mov r0, r1
+dec *r4
+jsr *r3
+L123: .string "nc"
+jsr *r5
+; comment
+L124: .string "o"
+sub *r2, r2
+sub #121, *r0
+stop
+prn #-201
+stop
+jsr X4
+L125: jmp X20
+mov r7, r5
+dec r5
+clr X8
+lea L120, L147
+L126: not *r1
+clr r4
+jsr *r3
+bne *r0
+cmp r3, *r2
+not L149
+mov r3, *r7
+L127: clr r6
+rts
+lea L48, r2
+rts
+cmp #225, X18
+prn X17
+inc *r2
+prn #-61
+L128: prn L189
+inc *r3
+clr L211
+add L64, r2
+dec r3
+prn r0
+prn *r1
+prn #-140
+inc *r4
+cmp X12, *r1
+add L101, L192
+bne L5
+jmp *r5
+L129: stop
+not r7
+L130: stop
+prn r3
+cmp *r7, *r4
+add L57, *r5
+jmp X10
+L131: .data 837, 868, -843, 690, 918, -398, 885
+add r5, *r6
+L132: .string "dmtva"
+sub r1, r6
+lea L30, *r6
+dec *r5
+sub r7, r1
+L133: .string "qymocfbomzxcexuxp"
+; comment
+L134: cmp *r3, r2
+stop
+prn L24
+not r4
+inc *r5
+L135: dec L151
+L136: .string "qbvorsro"
+L137: clr *r6
+
+not X15
+jmp X7
+dec r5
+L138: bne *r1
+cmp #98, L154
+L139: .data 982, -744
+L140: .string "hfhkxhfqhbnuezkzikrp"
+jmp L4
+stop
+cmp r1, L124
+cmp *r4, r4
+
+; comment
+not *r1
+mov #59, *r3
+L141: mov X6, *r5
+add #-156, r7
+inc *r5
+L142: sub r2, X2
+L143: .string "mbbwvlhkkgixvdpamltmfad"
+L144: .string "mwjspimtyvilkxubmh"
+jsr *r7
+jmp *r3
+jmp X5
+
+red *r0
+sub L231, *r4
+stop
+
+jsr L201
+L145: dec L214
+; comment
+dec *r3
+L146: lea X0, L207
+lea L91, L243
+L147: cmp L200, *r3
+L148: stop
+sub L89, *r7
+not L134
+jsr *r7
+mov L98, L146
+lea L171, *r0
+prn r0
+cmp X8, *r3
+L149: mov r1, r6
+prn *r2
+mov X0, r5
+clr *r4
+not *r6
+rts
+mov r5, r0
+lea X22, r2
+L150: .string "nolxj"
+L151: cmp *r7, L226
+L152: .string "zofvtxqrsojswgdrt"
+jsr L198
+bne X1
+red *r2
+red r0
+red *r6
+L153: sub #186, *r4
+add X15, r2
+; comment
+jsr *r3
+clr X6
+L154: .data -711, 773, 1, 805, 34, 189
+red *r5
+inc *r7
+L155: bne L142
+clr *r7
+L156: .string "zdkwjuwgmthkjmu"
+red r4
+mov #-128, X6
+L157: .data 908, -212, 320, 326, 104
+clr *r1
+clr r5
+lea X11, *r6
+inc L61
+mov *r0, X8
+L158: clr *r2
+L159: red r1
+L160: stop
+sub #-147, r5
+clr L214
+rts
+jsr X4
+lea L244, *r7
+L161: jsr *r5
+not *r6
+not *r6
+dec r2
+cmp L116, *r4
+stop
+cmp #198, L180
+L162: inc r0
+L163: inc r5
+dec r4
+jsr *r6
+lea X18, L39
+prn #-74
+stop
+cmp r6, r6
+L164: .string "eqxenzxymoeow"
+lea X6, r0
+cmp L196, L254
+; comment
+clr X13
+jmp *r1
+L165: .string "pcpndeb"
+L166: rts
+lea L173, L75
+sub X12, r0
+jmp *r3
+cmp L49, *r5
+mov *r7, X24
+jmp X0
+L167: .string "wvnrzashjhmfmntd"
+lea L21, r7
+L168: .string "q"
+prn #-2
+
+inc r2
+L169: .string "ovu"
+cmp r7, *r7
+L170: cmp #-161, *r7
+L171: .data 273, -635, -506, -198
+L172: cmp r6, #-2
+prn r1
+dec *r3
+dec r2
+inc L27
+jsr X17
+cmp *r2, #155
+L173: rts
+lea L193, *r7
+L174: stop
+lea L244, *r1
+L175: lea L202, *r6
+jsr L144
+jsr *r4
+prn #-20
+L176: jsr *r4
+jsr L96
+L177: .string "iunwimtuwzwrxge"
+prn #-138
+L178: sub #200, *r4
+prn *r6
+inc *r1
+jmp L248
+not r1
+not X12
+cmp r6, r6
+prn L112
+stop
+lea L200, r7
+not *r3
+L179: .data 369, -144, -389, -305, -223, -184, -182, 311
+sub L85, *r1
+L180: stop
+lea L190, *r3
+inc r4
+L181: .data 21, 978, 169
+stop
+rts
+bne L199
+L182: .string "qg"
+jsr L185
+not L170
+
+mov #147, L214
+cmp L131, L132
+sub #48, X14
+not r3
+bne X15
+dec r4
+jsr L122
+L183: prn *r5
+mov X9, r3
+jsr *r4
+clr r5
+dec L253
+mov L142, L235
+cmp *r2, *r7
+red *r4
+mov r0, *r0
+rts
+jmp X22
+prn #167
+L184: .data -720
+inc *r2
+L185: .data -113, -491, 529, -941, 129, 269, -516
+prn r6
+lea X5, L91
+L186: jsr *r2
+L187: prn r5
+L188: .string "gwozneavoa"
+jsr *r1
+; comment
+L189: .data 938, -401, -706, -384, 475, -9
+jmp *r2
+L190: prn *r2
+L191: .data 70, -787, 102
+mov *r3, *r0
+L192: cmp *r6, X8
+sub r1, *r4
+dec L149
+clr r0
+lea L46, L231
+jsr *r6
+dec r3
+sub #129, *r5
+L193: prn *r6
+red r0
+
+mov X9, L187
+clr r5
+rts
+L194: stop
+dec *r4
+clr r1
+
+cmp #214, *r6
+mov r1, r4
+red *r3
+red *r5
+rts
+prn L244
+cmp X21, #-224
+L195: add L252, *r6
+jmp *r4
+rts
+jmp L187
+inc *r3
+rts
+L196: .data 430, 856, -622
+jmp *r2
+L197: jmp *r1
+lea X9, *r3
+cmp r6, *r0
+L198: .string "ycoflywtzsrg"
+red X12
+cmp L82, r2
+red *r4
+L199: .string "coailbwkyoespkyybt"
+mov X14, L175
+L200: stop
+L201: prn #-255
+; comment
+L202: cmp #243, #4
+L203: .string "ulhrgbdypkoskgfwlhopyjy"
+prn r6
+L204: sub #121, *r0
+not *r4
+bne L90
+red r2
+jmp *r2
+L205: .data -463, 907, -725, -627, 917, 252, -732
+mov r3, *r7
+clr *r6
+L206: .string "lkpixcjwmmxiuzfdhjiipym"
+L207: add *r4, *r5
+jsr *r1
+stop
+L208: .string "ekzxxby"
+prn L250
+jsr L229
+sub *r4, *r2
+stop
+jmp *r3
+clr r6
+stop
+rts
+not X14
+not L127
+clr *r0
+
+lea L242, X22
+prn L242
+lea L184, r3
+sub #55, *r7
+sub #251, r6
+L209: .string "eepyyrteqvupdrbxdx"
+cmp r3, r1
+stop
+L210: .data -836, 389
+L211: .data 815, 125, 353, -477, 559, 330, -825
+mov #-240, r0
+L212: not r4
+L213: stop
+stop
+L214: clr L180
+add #-76, *r2
+lea X7, r0
+sub L218, *r3
+clr *r0
+jsr *r1
+add L26, r6
+prn r3
+L215: lea X0, X4
+mov #-105, r4
+mov r3, r5
+L216: clr L72
+L217: prn #238
+
+add r3, X12
+inc *r7
+L218: sub #213, *r2
+mov #125, r5
+rts
+add r5, L176
+L219: jmp L254
+prn *r7
+L220: .string "olfxnflbkxcveulnc"
+lea X0, r0
+clr X13
+clr *r4
+L221: bne *r7
+L222: prn *r7
+lea L158, X8
+L223: prn r2
+clr L237
+lea X7, L24
+jmp *r5
+L224: .data 768, 806, 910
+sub *r6, *r3
+inc *r6
+inc r3
+jsr *r7
+lea L105, L242
+not *r4
+cmp #60, #-66
+
+L225: dec *r5
+L226: .data 797, 576, -812, 3, 769, -834
+inc *r3
+inc L156
+mov *r5, *r0
+dec r3
+rts
+sub #102, X1
+red r1
+L227: .string "dm"
+prn #-45
+clr L128
+not r4
+L228: .string "w"
+jsr *r0
+
+mov #-36, L58
+jmp *r1
+jmp *r0
+L229: inc *r1
+inc r2
+L230: .data 453, -448, -44
+prn #-176
+L231: mov r6, r4
+jmp *r4
+L232: .data -246, 709, -333, -869
+red r7
+clr *r6
+
+sub X16, *r1
+red X14
+rts
+L233: red r5
+clr *r5
+
+stop
+rts
+add r0, r7
+; comment
+L234: clr r5
+clr *r1
+L235: not r4
+L236: .string "ghnodnpmehuzuvjkflkbht"
+dec r7
+inc r2
+rts
+; comment
+bne L237
+not *r3
+red *r0
+inc *r5
+sub *r4, *r3
+L237: red L249
+clr *r1
+not r2
+jmp L255
+clr *r1
+L238: prn #-50
+prn X3
+L239: dec r5
+prn L244
+jmp L193
+inc *r5
+L240: .data 413, 866, -85, -507
+L241: .string "rkapspjndjoj"
+stop
+rts
+L242: jsr X21
+not L131
+jmp *r5
+bne L191
+cmp #170, r0
+not r4
+sub *r3, *r1
+add r3, *r1
+L243: .string "bekhbfngo"
+L244: .data -820, 995, 709, 288, 878, 522, 396, 709
+stop
+jsr X12
+not r0
+L245: rts
+inc X19
+not *r2
+L246: red *r4
+L247: jmp X4
+cmp #-174, L248
+not r2
+L248: red r1
+stop
+inc r2
+L249: mov *r0, r5
+lea X17, X22
+rts
+mov #245, r3
+L250: sub *r6, X18
+L251: .data 915
+lea L188, *r4
+
+rts
+stop
+sub *r5, L252
+jsr L254
+jsr *r4
+L252: prn *r3
+sub r5, r1
+L253: sub *r3, *r7
+L254: inc *r3
+cmp #-85, r1
+L255: jmp *r3
+rts
+prn r0
+dec r7
+; comment
+clr *r3
+jsr L218
+lea X21, X1
+add *r4, r6
+stop
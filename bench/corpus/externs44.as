@@ -0,0 +1,1044 @@
+; Generated by genCorpus --seed 45
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+L0: stop
+not r5
+; comment
+red L77
+clr *r0
+jmp X15
+clr *r4
+L1: .string "fmgxjeuvcelt"
+clr r5
+add #18, *r2
+inc L1
+sub X12, *r3
+lea X14, *r7
+inc *r6
+prn r4
+inc *r4
+red r6
+dec r6
+mov *r2, *r2
+lea L99, X11
+cmp *r2, #-177
+L2: red L1
+L3: .string "ukunbybpc"
+lea L3, r7
+lea L3, r5
+stop
+cmp r6, *r2
+clr X9
+dec r7
+add r6, *r5
+inc *r1
+stop
+stop
+add #29, *r7
+L4: jsr *r3
+L5: .string "hsxmkibbcksjvmz"
+mov #31, r1
+L6: .data -151, 773, -97
+clr *r3
+stop
+jmp *r2
+bne L0
+prn r3
+sub *r3, *r4
+red *r7
+L7: .data -51
+L8: prn L3
+red L65
+prn *r7
+L9: prn *r0
+stop
+not r0
+dec L6
+lea L103, *r4
+L10: .string "tydgnrhmpvszavieyhiwdb"
+inc *r6
+not X8
+L11: clr *r6
+L12: rts
+inc r1
+L13: add #203, *r2
+L14: .string "ytutxqskwmfvcn"
+L15: sub *r7, L181
+L16: not L98
+L17: add L143, r3
+stop
+red r5
+L18: .data -773, -324, 903, -92, 384, 557
+bne L39
+not X24
+L19: not *r6
+; comment
+not L0
+inc *r0
+prn L118
+L20: .data 854, 529, 464
+L21: cmp r7, L101
+L22: clr *r2
+jmp *r0
+not r6
+L23: .data 498
+L24: lea L185, *r3
+sub L253, X2
+cmp #-244, #-58
+; comment
+not *r3
+mov r4, r0
+not *r7
+lea X20, *r5
+L25: inc *r7
+rts
+jmp X22
+L26: red *r4
+lea X7, X5
+not *r4
+cmp *r3, L4
+L27: rts
+mov X10, r1
+L28: jmp *r3
+cmp L10, #-198
+bne *r5
+dec *r5
+L29: inc X11
+jsr L11
+stop
+clr *r7
+sub #-255, L21
+add #35, r0
+L30: bne *r3
+add *r7, X16
+bne L151
+jsr *r1
+cmp *r2, #218
+not L26
+L31: lea X9, X0
+mov r5, X6
+; comment
+inc r5
+add *r5, r7
+L32: jsr L254
+
+L33: .string "xrivwcvpnvps"
+not *r0
+L34: jmp L78
+lea X19, *r6
+jsr *r7
+mov r5, *r7
+L35: .data -361, -647, -495, -670, -1, -531
+not *r2
+lea L54, X11
+L36: inc X4
+sub #-97, *r0
+lea X22, *r7
+cmp *r6, #101
+rts
+L37: prn L90
+add L3, X24
+stop
+clr L23
+L38: dec r6
+L39: red X22
+not L245
+prn *r3
+clr L257
+not r0
+cmp *r4, r2
+bne *r2
+inc r1
+L40: .string "pwipzysyypgmtfrf"
+jmp *r6
+jmp *r6
+rts
+not *r7
+jmp L134
+clr *r0
+add *r1, L149
+jmp L73
+L41: .string "xnhkqxn"
+not *r7
+not X24
+red L238
+jmp *r3
+sub X6, r0
+bne *r2
+L42: inc X0
+inc r6
+L43: clr *r2
+mov *r0, *r7
+jmp *r6
+clr L247
+stop
+inc r3
+red *r6
+rts
+jmp *r5
+red L216
+; comment
+rts
+lea L259, r6
+bne *r7
+clr r6
+lea L111, *r4
+stop
+cmp *r0, #23
+clr *r0
+L44: .string "ytlw"
+lea L39, L40
+lea L58, L102
+L45: mov r4, r5
+prn #114
+jmp *r7
+cmp X4, r6
+L46: add L55, r5
+jsr L116
+L47: cmp #-1, #122
+clr *r3
+
+lea L43, L134
+stop
+not *r4
+prn X14
+L48: not r6
+L49: bne *r2
+add *r0, *r1
+prn r3
+L50: prn *r5
+
+L51: .string "keztwbhwlulmuqugypisbt"
+add #202, *r4
+jmp *r3
+
+jsr L18
+L52: .data 543, -70, -674, -533
+not *r7
+jmp X9
+not r3
+dec r1
+L53: red r1
+lea X18, *r7
+not r5
+sub L21, r2
+red r0
+inc *r1
+L54: .string "scowsdgoxz"
+L55: add *r3, r4
+inc r7
+not L46
+L56: .data -340
+L57: jsr X14
+clr L199
+prn #129
+mov *r0, X23
+jmp X20
+clr *r4
+lea X3, r3
+jsr L80
+dec *r1
+L58: .data -691, 85, -406, 698, 729, 936, 159, -255
+dec X3
+L59: stop
+L60: red *r6
+add *r2, L54
+jsr *r5
+L61: .data 609, 931, 970, -103
+lea L192, r7
+L62: not *r2
+sub #-165, r2
+inc X8
+stop
+cmp *r1, *r5
+sub *r5, r5
+bne X24
+jmp L214
+cmp *r5, r4
+sub r6, *r3
+L63: .string "euopivysfazupoxrzywymndq"
+
+dec L8
+stop
+inc r7
+add #-155, r2
+clr L239
+inc X13
+stop
+add *r0, *r6
+L64: stop
+not X4
+L65: .string "fupfracqqjeblqutbpis"
+mov L40, *r2
+rts
+stop
+L66: .data -107, 311, 561
+jmp *r5
+L67: not L179
+L68: .data -828, -335
+L69: sub *r3, r4
+L70: stop
+sub *r5, r2
+L71: .string "eb"
+L72: inc *r2
+rts
+bne X6
+jsr *r6
+dec L131
+lea X9, r3
+; comment
+stop
+clr r2
+not L50
+lea L98, r5
+L73: .data 652, -253, 864, -194, 50
+L74: jsr X8
+add L225, r4
+jsr L48
+bne *r4
+sub *r5, X0
+jsr L73
+sub #157, *r2
+inc r1
+prn *r6
+L75: cmp *r7, r2
+red r3
+bne *r1
+prn *r3
+L76: sub #64, *r5
+lea L219, r5
+prn r3
+L77: clr *r5
+jsr *r6
+L78: sub L50, *r6
+clr *r7
+jsr *r3
+clr r7
+jsr *r1
+inc L122
+sub #109, *r6
+inc r6
+prn L42
+jmp X16
+L79: dec *r2
+L80: mov r6, L101
+L81: lea X0, *r2
+jsr L100
+clr *r7
+bne *r1
+prn L60
+L82: .string "ousrmrlcrweuhzj"
+jsr *r7
+dec X7
+mov r2, r7
+; comment
+dec r5
+sub L43, X1
+L83: .data 462, 275, -497, -818, -677, -295
+sub r5, *r7
+mov *r7, *r6
+stop
+rts
+L84: cmp r2, #-188
+dec r5
+; comment
+sub *r2, *r5
+L85: .data -898, 739, -146
+not r6
+dec *r6
+L86: mov L45, r4
+L87: add #25, X3
+clr *r1
+sub *r5, *r2
+inc r7
+jmp *r2
+L88: .string "qcqliifroafzhaeqgugoiqk"
+prn *r0
+prn L95
+mov L66, *r7
+L89: red L166
+jmp *r0
+clr *r5
+clr *r2
+bne *r2
+dec *r0
+stop
+jsr *r1
+mov *r2, L64
+
+clr r0
+add #-41, X13
+L90: bne L133
+not *r4
+bne *r6
+L91: .string "idurtcho"
+stop
+cmp #-92, L76
+L92: jsr L201
+clr L20
+prn r6
+L93: cmp #133, L27
+stop
+L94: .data 744, 631, 433
+; comment
+add L134, X12
+inc *r7
+dec r4
+L95: sub r6, r5
+L96: bne *r0
+mov r4, L37
+prn #90
+not L164
+L97: .string "uldqvdm"
+lea X5, *r7
+L98: rts
+bne L6
+clr L103
+mov #176, r1
+L99: .string "hgelqzafyd"
+cmp r1, *r2
+L100: jsr X15
+not r4
+L101: dec *r7
+jsr L250
+L102: .string "wvhwonhvjmiivfeyfs"
+stop
+inc *r5
+not X15
+clr *r6
+L103: prn #-168
+jmp *r5
+; comment
+L104: .string "tci"
+L105: jmp *r4
+L106: dec *r0
+L107: .string "odtqxcrf"
+not r4
+cmp L137, L97
+jsr *r3
+L108: clr r3
+mov #-77, X17
+lea L140, *r5
+inc X19
+prn L67
+mov r3, L191
+red X9
+L109: .data 173, -313, 904, 22
+lea L241, r5
+add #-3, r2
+not r6
+prn #-138
+lea X4, *r4
+
+L110: .string "pni"
+L111: prn r3
+lea L17, L60
+L112: lea L171, r0
+L113: clr *r2
+L114: red r4
+stop
+L115: jmp *r4
+L116: .data 720, 247, 18, -792, -465, 445, 511
+inc r1
+clr r0
+stop
+clr *r3
+sub X10, X4
+L117: cmp L244, *r6
+dec *r4
+prn X23
+L118: add r5, *r0
+clr X12
+add *r4, X19
+add #217, r7
+L119: .string "yxavlezinuvyxcfat"
+
+clr r6
+mov L54, X4
+not *r6
+; comment
+bne *r6
+L120: .string "gjgai"
+cmp *r0, #-65
+red r7
+L121: dec X14
+mov X20, r4
+L122: cmp X11, *r2
+L123: .data 634, 853, -300, -245, -669, 389
+jmp X23
+rts
+not r2
+bne X18
+dec X6
+prn *r7
+stop
+prn X3
+L124: jmp *r3
+L125: bne X13
+L126: .string "fab"
+sub #-213, r1
+lea L217, r6
+red r2
+L127: add X13, *r4
+mov *r5, r2
+L128: cmp #70, *r3
+L129: mov L107, r7
+
+lea L117, r2
+red *r2
+sub *r6, *r0
+jsr L25
+L130: red r4
+clr L132
+
+stop
+L131: .string "jkyevps"
+stop
+stop
+clr L57
+red L197
+L132: stop
+L133: .data 30, 13, 983, 898, 321, 154, 712, 479
+red r7
+stop
+jsr X15
+jmp *r6
+lea L86, *r4
+stop
+dec r1
+add L222, L143
+L134: sub #-237, r7
+L135: dec r4
+L136: bne L260
+dec L20
+L137: dec *r1
+L138: .data -191, -115, 698, 21, 449
+add #-224, L207
+L139: .data -185, -747, -584, 52
+inc *r5
+L140: red X22
+dec r2
+stop
+not r3
+L141: .string "jaflli"
+red X21
+L142: red r0
+bne *r1
+bne *r5
+jmp *r6
+L143: .data -318, 472, -638, -49, -96, 688
+L144: jmp *r1
+not L181
+L145: stop
+dec r6
+sub #-233, *r2
+rts
+not X19
+L146: stop
+red *r5
+lea X7, L154
+L147: stop
+red *r1
+bne *r0
+L148: .data 540, 816, -239, 565, 441, -417, -779
+clr X8
+
+lea L129, *r7
+inc *r1
+jsr *r6
+L149: .string "catytiqxfxclpptx"
+L150: stop
+L151: jmp *r0
+bne *r5
+cmp #-238, #214
+L152: dec *r2
+sub #12, *r3
+lea L189, *r7
+rts
+cmp X2, *r4
+sub L135, *r3
+L153: .string "bbrztryiueuycb"
+jsr L247
+rts
+L154: .string "uqvkxzkufgjzmxmxlbkclzil"
+L155: inc *r0
+prn #-178
+add r2, r2
+clr L192
+clr *r6
+mov X22, X5
+inc X0
+dec *r2
+jsr *r7
+jsr *r1
+inc *r7
+jsr *r4
+L156: .string "lzwfonnhprra"
+; comment
+cmp *r5, r5
+L157: jmp *r6
+prn #82
+L158: .string "ievpcerrotw"
+add L33, X7
+jsr *r7
+L159: .data 733, -576, -580, 996, -805, -922, -104
+lea L187, *r2
+not *r0
+L160: jsr X23
+L161: bne *r5
+stop
+L162: .data -567, -774, -369
+red *r5
+rts
+cmp r1, *r6
+clr *r7
+rts
+L163: jmp X12
+inc L154
+L164: jsr L171
+L165: clr X9
+jmp X0
+cmp L227, L172
+mov L118, *r2
+bne X8
+prn r1
+mov *r3, *r1
+L166: .string "scho"
+cmp *r0, r0
+mov #200, r7
+not r1
+prn #-71
+L167: cmp L51, #-1
+L168: .string "urppakqitmargsonlsmhkjmc"
+inc X6
+dec r3
+add r7, *r5
+lea L99, r6
+L169: .data 828, 890, 186, 427
+prn #188
+stop
+not r1
+red r5
+L170: .data 751, -181, -447, -128, 307
+stop
+jmp L233
+stop
+L171: rts
+rts
+L172: .string "hp"
+rts
+L173: .string "zihwlpvuegzsn"
+L174: .string "difjce"
+L175: .string "tqqfataecbtbus"
+clr X8
+inc r4
+; comment
+L176: .string "taqioocoi"
+red L76
+sub *r0, L211
+rts
+cmp L45, r4
+jmp X18
+not r4
+
+bne *r6
+jsr L258
+lea L207, L83
+mov L79, *r3
+L177: jsr X22
+L178: .data 613, -445, 637, -937, 313
+bne *r1
+
+rts
+L179: .data -353, 611, 601
+jmp *r5
+; comment
+inc r2
+sub *r7, *r2
+jmp L28
+
+rts
+rts
+stop
+not r6
+L180: .string "djq"
+prn #-62
+sub L157, *r5
+L181: .string "mzbrfpfw"
+L182: .string "llqbkeqjpj"
+L183: rts
+L184: sub r2, *r5
+dec r2
+add *r5, X8
+not L194
+red r3
+L185: .string "mcojowqryjwbqaoszqnkj"
+stop
+not X23
+add r3, X9
+lea X21, *r3
+L186: .string "kdkkrqjuvbwo"
+dec r2
+red X11
+red L224
+sub L189, *r0
+not r6
+; comment
+L187: rts
+; comment
+dec L235
+L188: .data 812, -783, -402, -287, 193, -163, 901, -998
+inc r7
+add *r4, X3
+lea L231, *r1
+L189: not *r1
+mov *r2, r2
+sub X11, X12
+; comment
+inc *r0
+dec r6
+; comment
+prn #-200
+mov X21, L227
+prn r7
+lea X9, *r7
+L190: jmp L226
+L191: mov #51, *r3
+clr r0
+L192: .string "rlbkvmryyenelvf"
+dec *r0
+L193: add L26, *r2
+not X12
+L194: .string "tegtfv"
+not r7
+clr L169
+prn *r1
+L195: add *r6, r4
+L196: .data 157, 346, -446, 353
+prn *r1
+prn X9
+not X19
+stop
+clr r5
+cmp #-172, r4
+L197: jsr X19
+jsr X16
+jsr *r1
+rts
+lea L115, L151
+clr r3
+inc *r2
+inc *r4
+clr r1
+prn r4
+bne *r3
+inc r2
+jsr *r5
+add #-37, L17
+not r7
+not *r2
+jmp L167
+L198: .data -519, 651, -506, 604
+L199: prn #105
+add r7, r2
+L200: .string "hrvfwknlx"
+inc r3
+prn #-164
+jmp *r4
+bne L222
+rts
+add X4, L202
+L201: stop
+L202: clr *r4
+cmp X20, #-131
+L203: dec *r5
+jsr L202
+L204: jmp L196
+mov X21, *r7
+prn #169
+rts
+red X14
+L205: bne X17
+bne *r4
+L206: prn L152
+clr *r7
+L207: jsr *r2
+jmp L136
+L208: jmp *r7
+bne L226
+red r2
+
+L209: red *r5
+rts
+stop
+L210: mov L201, *r6
+L211: stop
+L212: .data -451, 908, 558, -935, -474, -221, -971, -739
+stop
+clr X6
+L213: add r4, *r3
+jmp X17
+cmp #-126, #-22
+rts
+inc r1
+jmp *r0
+mov L249, *r2
+
+lea X2, r0
+lea L94, r6
+L214: clr X9
+red r5
+mov *r6, r7
+add #149, L229
+clr L250
+inc L85
+sub r7, X13
+L215: .string "qdxapfuvb"
+inc r6
+add L70, X16
+bne X22
+L216: .data 610
+rts
+lea L239, L222
+mov L255, *r1
+L217: prn #251
+lea L48, r5
+inc X20
+dec *r3
+L218: rts
+L219: clr r2
+
+bne L256
+lea L253, L52
+add r3, L260
+not L254
+jsr L173
+L220: stop
+not *r7
+cmp r6, X11
+dec L24
+; comment
+L221: stop
+L222: cmp #-225, L230
+L223: .string "auxyrumcrvzil"
+jsr *r7
+L224: .string "aul"
+lea X14, L230
+lea X14, L258
+sub *r6, *r7
+lea L184, L254
+sub X19, r0
+L225: rts
+inc X24
+red L204
+stop
+clr L254
+sub *r7, r1
+clr *r2
+rts
+mov r6, L240
+L226: dec *r5
+rts
+mov r6, L229
+rts
+L227: jsr *r6
+L228: .data -19, 309, -520, 203, 105
+L229: rts
+add #138, *r0
+L230: .data 676, 113, -920, 992
+L231: dec r7
+inc r4
+L232: sub r2, r2
+prn #150
+mov #-226, L249
+cmp #25, L66
+rts
+clr r7
+rts
+jsr *r5
+stop
+sub X21, r3
+jmp X10
+sub #-74, L255
+red r0
+L233: .data 452, -494, -853, 575, -454, -391, -839
+mov X16, *r1
+stop
+inc *r2
+mov X11, X14
+rts
+clr r4
+sub r3, r1
+cmp X11, L77
+red *r5
+L234: .data -90, -516, -456
+L235: .string "cfgv"
+mov #-76, X20
+clr r6
+rts
+L236: .data 73, -649, 838, -269, 10
+cmp L227, *r2
+; comment
+red X5
+dec X8
+prn X0
+stop
+cmp r0, #55
+L237: .string "krokoiytcijjehmf"
+rts
+L238: .string "fnkkgjqugoxle"
+inc *r1
+rts
+mov *r1, r1
+add X9, *r4
+add #-107, *r7
+mov X20, *r3
+stop
+clr r5
+not L244
+L239: dec X23
+L240: inc *r3
+lea L148, r1
+stop
+inc *r5
+red L95
+L241: .data -101
+stop
+L242: inc L246
+L243: jsr L253
+not *r5
+bne L245
+L244: jsr X11
+L245: dec *r1
+L246: bne *r3
+clr *r2
+
+jmp L249
+not r4
+jsr *r0
+; comment
+stop
+clr r3
+clr X14
+not r5
+L247: mov r7, X2
+jsr X1
+rts
+inc L25
+
+L248: .data 861, -351, -249, -226, 784, -793
+mov L247, r3
+dec X15
+red L214
+cmp *r6, X2
+L249: .data -758, 910, -265, 422, -107
+clr X8
+L250: prn #104
+L251: prn #49
+bne L258
+jsr L92
+cmp r5, r0
+add L15, *r0
+dec r1
+L252: .string "dveztnrltevcaxi"
+inc r0
+jmp L25
+lea X24, X12
+mov *r4, L143
+prn r4
+sub *r2, X12
+jmp *r5
+bne X0
+stop
+not r3
+jmp *r3
+lea L255, r0
+stop
+jsr *r0
+sub L259, L14
+cmp r5, #105
+dec X16
+L253: .data -1000, -704, -660, -454, 871, -129, -458, 890
+L254: mov r5, X22
+cmp X19, X4
+L255: sub X24, *r2
+L256: .data 588, -760, -593
+red *r3
+jmp X22
+jmp *r0
+prn *r5
+red *r2
+; comment
+cmp *r2, #56
+cmp #-144, r3
+sub X21, L119
+bne *r0
+L257: not r5
+rts
+L258: .string "dfjebgdgpdqcam"
+lea L259, r0
+not r6
+jsr *r5
+mov *r7, *r6
+L259: mov #188, L260
+add L260, *r4
+lea X1, *r2
+clr *r7
+L260: .string "qpkrkttxgt"
+red L223
+dec *r5
+jsr *r2
+inc r7
+cmp r6, #-173
+jsr *r5
+prn #215
+not r5
+clr r6
+jsr *r1
+sub r7, *r2
+clr r1
+jmp X0
+dec *r7
+lea X7, L173
+jsr *r6
+stop
@@ -0,0 +1,1045 @@
+; Generated by genCorpus --seed 46
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+jmp *r1
+L0: .data 677, -935, -148, -410, -150, -130, 836
+cmp #-151, X16
+mov *r7, *r1
+add *r4, r2
+dec X8
+lea L38, r0
+sub r0, *r1
+not *r4
+inc *r0
+bne *r7
+L1: .data -885
+mov *r7, X21
+bne X18
+jmp *r3
+jmp *r4
+dec L0
+red *r3
+rts
+L2: .string "ufuwuxim"
+dec X23
+clr r2
+inc *r2
+L3: clr r3
+L4: prn r4
+L5: .data -818
+dec X17
+L6: not X0
+L7: red r0
+stop
+red *r6
+not X13
+clr L215
+L8: inc X0
+rts
+L9: .string "klfaaveymnx"
+not *r1
+bne *r6
+L10: .string "ehibubk"
+prn L246
+
+add r2, L243
+lea L2, r7
+sub r0, *r0
+prn *r7
+rts
+add r3, *r7
+mov X1, L99
+add #46, r3
+; comment
+stop
+L11: not L73
+L12: jsr *r5
+jmp L7
+rts
+cmp r1, *r4
+L13: inc *r6
+jmp *r0
+sub #107, r4
+prn X5
+; comment
+inc *r4
+
+red X7
+clr r0
+jmp L189
+prn #134
+clr L275
+mov *r6, X18
+add *r2, *r5
+lea X14, L6
+not L1
+jsr *r0
+clr X15
+add r7, r6
+rts
+L14: .string "daayk"
+jmp *r4
+cmp *r0, #-205
+red X4
+rts
+not r7
+mov *r0, r2
+L15: rts
+L16: sub r5, X24
+prn *r4
+jmp X10
+lea L7, L179
+lea X9, *r5
+L17: sub *r0, *r4
+L18: stop
+sub #-23, L117
+mov r2, r6
+sub r1, r7
+L19: bne X11
+bne L62
+stop
+L20: add r5, L19
+inc r7
+jsr L44
+prn #64
+L21: .data -303, -168, -419, -890, 161, -241, -466, 813
+jsr X15
+L22: not X23
+clr *r3
+inc *r1
+inc r2
+inc L266
+bne *r4
+jsr *r1
+L23: inc L4
+jsr *r2
+bne *r7
+L24: .data 700, 231
+stop
+stop
+clr *r4
+sub #180, *r5
+dec *r4
+not L15
+L25: red *r0
+cmp *r6, *r5
+L26: .data 703, -140, 543, -565, -318
+L27: .data -440
+L28: .string "wwxcuanpcohtvpbodprbsijc"
+L29: mov r0, r5
+L30: jsr L272
+L31: not X10
+prn r3
+rts
+L32: mov X1, X0
+rts
+cmp #120, L124
+L33: .string "iixczepmfn"
+mov L165, *r7
+mov *r4, X14
+add L203, *r2
+L34: .data 131, 651, -553, -241, 24, 644
+add X8, *r6
+sub *r7, *r0
+inc r3
+L35: not r3
+add *r6, r5
+L36: add *r3, r6
+L37: jsr L52
+add X18, r4
+L38: .string "paduuqmxgnuylyqbp"
+inc r2
+sub X12, L20
+lea X23, r2
+clr L133
+lea L244, r1
+red L29
+inc *r4
+stop
+
+L39: .string "srfbkmknyptnkpitfl"
+dec *r7
+dec *r2
+L40: .string "qm"
+L41: add *r2, r0
+stop
+add *r1, r0
+rts
+red X11
+prn #-167
+lea X16, L0
+red X16
+rts
+clr r7
+bne *r6
+red r5
+lea L148, *r5
+cmp X11, L116
+L42: inc X15
+L43: .string "itxlrloczryxyahkcxgky"
+not *r4
+sub #-110, *r1
+cmp L17, #216
+prn *r7
+not X20
+prn #-228
+jmp *r2
+; comment
+add #126, X0
+L44: clr X15
+L45: lea L36, L267
+L46: red L24
+L47: prn L34
+stop
+L48: sub #-15, r0
+
+dec X21
+cmp *r0, #-107
+
+sub #-168, r4
+dec r1
+stop
+stop
+not *r5
+red L42
+rts
+L49: .string "wwcpdjeqzpnkfcxkggarcv"
+L50: .string "jsogzxefgtllp"
+add L18, *r3
+L51: cmp r7, r3
+L52: .string "bhzpilnutqjopdkijdjew"
+mov #41, L110
+L53: jsr *r0
+add #-94, L59
+add *r7, X19
+red L46
+clr L10
+stop
+mov *r0, r1
+cmp #25, #254
+L54: rts
+cmp r5, #-234
+clr r5
+jmp X13
+L55: mov #-53, r6
+
+bne *r0
+L56: add r6, L253
+jsr X8
+L57: .data 406, -828
+lea L36, *r0
+clr *r1
+inc L26
+add *r0, r2
+not *r2
+L58: .data -143, -258, 588, 142, -592, -73, 875
+L59: clr r5
+clr r3
+jsr X8
+not r4
+L60: cmp X19, *r3
+; comment
+sub #42, *r1
+clr *r3
+clr r3
+rts
+lea L242, *r4
+inc r1
+inc *r0
+clr r5
+L61: .data 897, 455, 414, 219, -510, -767, -856
+add r0, *r2
+red r6
+L62: .string "jjhymrovbvscqbrdfsipibi"
+
+inc *r6
+
+L63: .data -508, 962
+not X14
+mov *r2, *r2
+lea L271, X6
+jmp *r1
+L64: mov L255, *r5
+mov L55, X18
+L65: bne *r4
+cmp X24, L44
+L66: dec X1
+L67: dec r4
+dec r1
+prn #-184
+lea L29, X24
+prn r6
+lea L91, r0
+L68: add *r1, X23
+mov *r4, L131
+stop
+red L127
+L69: .data -910, -136, -664, -323, 480, 872, 200, -42
+inc L199
+L70: inc r2
+stop
+bne *r2
+
+clr L46
+L71: jsr L78
+not L6
+L72: clr X19
+add #-141, X0
+lea L65, r1
+not L237
+L73: jmp *r0
+
+L74: .data 715, 571, -585
+L75: clr *r4
+lea L150, *r3
+jsr X17
+L76: red L9
+
+clr r3
+L77: clr r7
+mov *r6, *r5
+mov #-192, *r0
+jsr X22
+not r3
+jsr X19
+jmp L70
+lea L103, *r2
+
+mov X5, r3
+lea L95, r6
+prn L248
+add *r7, *r1
+bne X3
+cmp *r2, *r0
+sub #-111, L79
+lea L27, L25
+L78: red *r7
+not X8
+rts
+cmp L16, L193
+prn *r5
+
+; comment
+; comment
+stop
+; comment
+add #169, r6
+L79: red r4
+rts
+stop
+inc X21
+prn *r3
+jmp L136
+L80: cmp #-14, L245
+bne *r0
+L81: bne *r6
+red *r5
+sub r6, *r6
+L82: mov r4, r0
+L83: not r5
+L84: .string "xpcqocw"
+jsr X16
+jmp L137
+bne *r2
+prn #-204
+jsr X3
+stop
+L85: .data -549, -524, -598, -305, 35
+red *r3
+inc X7
+clr *r2
+jmp *r6
+L86: jsr *r5
+L87: inc X1
+L88: mov #205, *r6
+mov *r5, L46
+jmp L80
+bne *r2
+bne X3
+clr *r2
+prn r6
+L89: inc r0
+jsr *r2
+prn *r2
+L90: red *r3
+not *r2
+L91: .string "nbawragnrobhqi"
+cmp #-161, *r4
+L92: bne *r5
+bne X6
+jmp *r2
+inc *r5
+L93: add *r5, *r0
+L94: red L183
+L95: bne X23
+cmp X23, L190
+stop
+L96: clr *r2
+L97: .string "lymadluz"
+L98: dec r2
+inc *r0
+jmp L21
+mov L220, *r6
+L99: jsr *r6
+bne L68
+jmp *r2
+L100: not r0
+add *r4, L191
+cmp *r1, r1
+mov X1, *r7
+stop
+clr r7
+jmp L262
+L101: .data 245, 288, 426
+L102: jmp L39
+lea L95, X10
+jmp *r2
+dec r2
+clr r7
+L103: rts
+bne X1
+L104: .data 61, 114, -44
+L105: mov *r0, *r6
+prn *r2
+not *r6
+L106: .data 108, 814, -529, -718, 798
+L107: inc r4
+bne *r6
+L108: clr X2
+L109: bne *r4
+clr *r3
+dec L107
+L110: red r3
+rts
+stop
+L111: red L81
+lea L70, *r7
+L112: inc *r6
+L113: .string "bhxcyowhjbobvaforrvbjkbr"
+stop
+L114: jmp *r2
+sub #48, *r3
+red *r2
+bne *r4
+; comment
+prn *r7
+L115: stop
+clr r7
+rts
+dec *r6
+jmp *r2
+bne L59
+bne X16
+
+L116: bne *r6
+L117: rts
+cmp X22, *r5
+stop
+add r1, r0
+; comment
+jsr X10
+red X5
+inc L12
+jmp L181
+red r3
+
+red r2
+jmp *r7
+; comment
+L118: jsr L250
+L119: stop
+add *r4, *r3
+prn #166
+not *r0
+L120: jmp *r2
+L121: lea L252, *r0
+bne L42
+cmp #26, #-10
+mov r1, *r7
+stop
+L122: not L42
+L123: mov #40, *r7
+red *r4
+lea X8, *r5
+prn #-192
+bne *r7
+; comment
+jmp *r3
+inc *r0
+bne *r3
+red X12
+sub #-97, r7
+L124: .string "o"
+
+clr L179
+mov r6, *r0
+add r6, r2
+L125: cmp L15, r2
+L126: not *r5
+L127: .data 987, -836, 516
+L128: mov r5, *r4
+L129: .data 433, -862, -195, 499, -430
+; comment
+lea X12, r7
+L130: clr r3
+red r1
+stop
+stop
+red r0
+L131: .string "bljs"
+L132: .string "t"
+dec *r6
+L133: .string "kmtitvyprtmmzdrxhhvrzywq"
+jmp *r7
+; comment
+not r6
+rts
+sub *r4, L115
+inc r6
+clr L251
+jsr *r3
+inc r1
+L134: prn *r6
+L135: .string "actabxerjid"
+stop
+not *r3
+rts
+bne X21
+L136: .string "vplmpmgpedlxkjsbma"
+mov L179, L27
+L137: mov #114, *r3
+L138: stop
+L139: sub *r5, *r0
+jsr X11
+stop
+clr r1
+cmp L275, *r4
+prn r2
+L140: jsr X22
+rts
+cmp r2, L233
+L141: clr X23
+L142: not *r1
+mov *r6, r4
+L143: not r7
+dec *r1
+lea L67, X12
+dec X17
+; comment
+jsr X16
+prn #63
+prn r6
+L144: .data -260, -630, -709, 88, -960
+lea X11, X4
+mov r0, X17
+L145: .string "xtmvgiqymzfodwafydybw"
+rts
+jsr L209
+stop
+L146: not r5
+rts
+red *r3
+L147: dec X8
+sub *r1, r6
+L148: sub L131, r1
+sub *r6, r2
+bne X23
+; comment
+prn *r5
+L149: .data 547, -293, -441, 725, -730, 681, -952
+L150: .string "zevapqgt"
+rts
+jsr L58
+lea L103, L2
+jmp *r2
+prn *r1
+L151: .data -132, 953, -275, -119, 903, 825, -243
+bne X20
+cmp r0, r5
+prn X10
+red X14
+sub #44, *r5
+inc L255
+jsr X13
+jsr *r4
+clr *r6
+rts
+L152: clr L255
+L153: .data -424, -143, 618, -100, -290, -170, 956
+dec *r7
+L154: rts
+red L265
+bne *r2
+jsr L71
+L155: lea L203, L91
+L156: .string "mypqcahmojyhs"
+inc L20
+L157: mov *r2, *r4
+prn X3
+L158: .string "zxax"
+add L182, *r2
+stop
+jsr *r1
+cmp r0, *r3
+clr L273
+add *r3, r0
+clr L80
+L159: clr *r3
+not *r2
+jmp *r2
+red L254
+dec r3
+lea L264, *r0
+inc L187
+rts
+L160: red X19
+not r3
+not X5
+L161: .string "lqaqgjzskyirblo"
+bne *r2
+dec *r5
+cmp *r5, r2
+not r3
+not *r1
+inc L255
+not *r5
+L162: lea X8, *r0
+mov *r7, r1
+L163: bne *r5
+lea X20, *r3
+L164: .data 463, 101, -961, -785, 79, -409
+L165: .data 93, 199, 585, 29, -57, 507, 66
+clr *r4
+mov r0, *r1
+prn *r4
+L166: rts
+L167: cmp *r3, r4
+jmp X8
+sub *r2, r4
+L168: .string "mnaetoa"
+jmp L93
+prn r5
+lea L243, *r4
+stop
+L169: .string "tlpjyrykqprtvcvemx"
+L170: red *r5
+; comment
+jmp L176
+prn #-35
+; comment
+L171: red *r4
+not *r7
+mov *r5, r0
+
+mov r5, X2
+stop
+sub #175, L215
+rts
+inc *r4
+dec *r3
+prn r0
+L172: not r7
+not X3
+sub #114, *r6
+L173: lea X19, X5
+L174: .string "rznbzwnslaqe"
+cmp #-65, r0
+L175: cmp *r2, *r6
+stop
+add *r0, *r4
+L176: not r2
+rts
+cmp r4, #76
+not L232
+bne X13
+L177: clr r6
+cmp *r3, r7
+inc *r0
+add *r6, L227
+L178: jsr *r7
+add #-8, *r4
+prn r3
+sub *r7, X12
+red *r4
+clr *r3
+add *r6, r5
+L179: .data -375, 170, 449, 789, -733, 875, -976
+clr X5
+L180: .data 928, -82, -85, -950
+cmp #-194, #-46
+jsr X20
+L181: jsr L199
+bne *r4
+prn X16
+stop
+lea X20, r4
+dec L108
+jmp *r3
+red r6
+lea L71, L214
+clr *r6
+clr *r4
+jsr *r4
+jsr X11
+clr *r6
+L182: add #-195, X14
+sub L211, r4
+L183: bne *r4
+red X22
+L184: .string "pggrunfpxrzojx"
+add *r2, *r7
+jmp *r1
+; comment
+L185: dec *r2
+sub *r6, L210
+bne *r4
+L186: .data 18, -367, 591, 240, 415, -289, 662, 683
+mov r0, *r2
+cmp #-94, L234
+inc r0
+L187: .data 566, -916, 631, -11, -586
+L188: red r0
+add #10, r6
+
+
+mov r0, X8
+L189: .data 988, -365, -785, 342, 401
+jmp *r5
+bne *r4
+lea X21, *r4
+bne X9
+red L25
+prn L69
+rts
+clr *r5
+
+add r2, *r0
+red X20
+; comment
+stop
+jsr X21
+red L230
+prn r3
+L190: .string "makowmwihbuqytamkw"
+prn *r6
+bne *r5
+L191: .data 971, 416
+L192: mov r0, L209
+jmp L250
+lea L255, *r3
+red r5
+add *r3, X22
+L193: inc X12
+add #-181, *r1
+clr r3
+inc *r0
+red r4
+L194: sub r1, L200
+L195: .data 481, 571, 763, -985, 574, -805, 603
+clr L40
+L196: not r3
+lea L268, X24
+L197: cmp *r4, r4
+mov r6, L121
+prn r5
+cmp #-247, r1
+cmp r4, r6
+L198: prn *r3
+red X11
+mov #-220, *r6
+red X0
+rts
+red L234
+; comment
+sub X21, *r5
+add L83, L23
+L199: rts
+jsr X8
+L200: bne L42
+not L197
+L201: rts
+dec X19
+rts
+L202: .string "egjncug"
+clr L213
+L203: lea X19, L118
+jmp *r7
+L204: .string "cjfioo"
+sub *r3, X9
+inc X9
+L205: jmp *r4
+mov *r5, r2
+L206: .string "r"
+add *r0, X19
+L207: jsr *r6
+add L107, X5
+inc *r3
+L208: .data -316, 901, -6, 99, 689, -897, -19
+jsr L130
+L209: .data 808, 893, 602
+add #193, X6
+not r2
+not X12
+clr L136
+L210: dec r4
+stop
+add *r5, *r4
+mov *r6, r4
+stop
+not X3
+inc *r2
+jmp X19
+sub X6, L92
+jmp L168
+bne L260
+L211: sub r5, L100
+jsr *r3
+mov r7, *r3
+L212: add X6, L167
+L213: sub #4, *r1
+clr X23
+L214: mov #-251, r3
+jsr *r4
+lea L252, r4
+add L268, L269
+sub #4, L272
+red r4
+cmp #83, X14
+lea X19, L223
+L215: add #120, *r7
+stop
+
+L216: stop
+jmp L235
+prn *r0
+jmp *r3
+L217: lea L155, r2
+jsr *r7
+cmp *r4, #136
+L218: .string "hcsouvqrfyijc"
+L219: .data 727, -60, -942, -153, -921, 922, -399
+clr *r7
+sub r4, *r7
+L220: rts
+jmp *r2
+mov r2, r4
+cmp *r4, r2
+dec X0
+L221: bne *r7
+L222: red L271
+prn *r1
+L223: .string "fbsjmafgbuszftnyf"
+lea L15, X21
+stop
+stop
+jsr L72
+bne X15
+clr *r5
+jmp *r4
+lea L253, L128
+L224: .string "gzmhdovvcbkhduym"
+lea X7, *r5
+jmp L252
+L225: add #233, X23
+L226: .string "uatwguwmapjfeterokfwb"
+L227: .string "dyyzsfbhlqouc"
+prn #172
+jmp L251
+sub *r7, *r4
+jsr L115
+red X12
+stop
+bne X2
+inc L148
+stop
+L228: add *r5, L242
+mov L7, *r0
+red r2
+inc r1
+L229: sub L265, *r2
+red r0
+not r6
+sub r3, *r3
+L230: sub L188, L241
+prn #-98
+L231: .data 662, -411, 458, -456, 110, -248
+prn #-122
+L232: .string "mllyn"
+L233: sub *r5, r3
+rts
+clr r5
+jsr *r5
+sub #-34, r1
+L234: mov #-4, *r4
+L235: add *r4, L250
+L236: mov X23, L171
+prn #-195
+dec X9
+clr *r5
+
+L237: cmp *r6, L207
+cmp r4, *r7
+add #-151, L249
+L238: prn X0
+mov *r0, r4
+L239: rts
+L240: .data -580, -541, 211, 412, -533, -638
+L241: lea X0, *r7
+mov *r3, *r6
+lea L236, *r5
+clr r5
+L242: .string "chmgz"
+not r2
+dec r1
+L243: .string "ejtjwjcryoenvuodnokzg"
+bne X13
+dec L178
+jsr *r6
+; comment
+cmp X0, X9
+sub *r5, r7
+cmp L5, r3
+jmp X0
+bne *r3
+dec L95
+L244: prn *r1
+clr *r7
+lea X5, r0
+L245: add *r4, *r7
+L246: rts
+L247: not X0
+jsr *r2
+stop
+mov *r4, L250
+not r6
+L248: dec L261
+jsr *r1
+L249: bne L274
+inc *r7
+L250: prn r0
+L251: red X10
+jsr *r2
+L252: red X7
+L253: jmp *r7
+stop
+L254: stop
+bne *r6
+rts
+rts
+jmp *r4
+jsr *r3
+clr X11
+; comment
+cmp r1, #165
+clr r0
+sub r6, *r4
+prn L46
+stop
+jsr L274
+mov *r4, L268
+prn r3
+add #181, *r3
+sub *r5, L128
+stop
+dec r0
+rts
+prn #-202
+L255: sub L261, r5
+sub *r1, X4
+L256: mov *r5, X6
+lea X14, r6
+dec r5
+dec L36
+L257: sub #-126, r0
+L258: .string "sabjpvinwhorjzacomzqboxl"
+cmp X14, *r4
+dec X18
+jsr L179
+L259: .data 701, -529, 816
+jsr *r5
+mov r2, r5
+not L175
+clr *r5
+L260: .string "tplj"
+prn #101
+mov *r0, X5
+not r1
+jmp *r1
+mov r4, r4
+L261: .data -757, -279
+bne L262
+jmp X19
+jsr X2
+L262: red r7
+L263: .data 20, -980, 260, -79, 374, 279
+jmp L172
+mov *r2, r7
+L264: jmp *r4
+cmp *r3, L32
+mov r6, *r2
+L265: lea X20, *r0
+L266: .string "syebpksgarxbhoafbl"
+lea L269, *r2
+; comment
+L267: .string "pwjbuvzwpvbo"
+L268: .data 529, 392, 520, -999, -26, -864, -959, 306
+cmp #241, *r4
+inc r0
+cmp X8, X9
+jsr *r4
+L269: .string "xkzbkvxasxw"
+L270: not *r1
+clr L102
+clr *r0
+clr *r0
+L271: .string "mjowsqxpxczvfboejaaflpj"
+red *r0
+
+mov *r2, L102
+L272: prn #-121
+add #40, *r0
+L273: .string "rornanyfwi"
+L274: .string "oavhbbfrwjpj"
+L275: lea X14, *r5
+stop
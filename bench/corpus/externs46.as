@@ -0,0 +1,1043 @@
+; Generated by genCorpus --seed 47
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+add r3, L5
+stop
+L0: add #249, *r1
+inc r5
+bne *r0
+L1: inc r5
+prn *r3
+cmp X5, *r2
+not L0
+inc r5
+jmp X17
+L2: inc r4
+dec r7
+not r3
+add L13, *r0
+L3: dec L25
+L4: jsr L9
+inc X24
+mov *r4, r3
+stop
+sub #215, r7
+clr r1
+jmp L0
+L5: .data -8, 735, 795
+L6: bne L6
+jsr *r3
+bne L1
+prn r2
+rts
+mov r2, r3
+jsr X20
+not X4
+L7: .data 325, -112, 699, 579, 427, -21
+not L31
+L8: bne L3
+L9: .string "rmtpgpgrv"
+sub *r7, *r7
+L10: .data -401, 813
+dec r4
+jmp X24
+rts
+bne *r7
+mov r4, r7
+red *r1
+inc *r0
+L11: dec *r5
+L12: bne *r1
+bne *r7
+stop
+cmp *r4, r3
+L13: prn #158
+inc *r2
+dec L7
+inc X13
+sub *r6, L16
+jsr *r2
+sub *r1, r6
+jmp X4
+L14: mov #-60, X17
+
+add *r3, *r3
+rts
+L15: bne L90
+sub #-196, *r3
+prn #-20
+mov #-89, L3
+dec r0
+jsr *r5
+L16: sub L9, r3
+cmp L188, r7
+cmp X20, r1
+L17: .data 145, -431, -201, 112, 910, -434, -564, 708
+not *r7
+L18: .data 772, -94
+add r0, L13
+lea L8, *r3
+L19: stop
+L20: rts
+L21: sub r6, *r5
+mov #-184, L176
+prn #201
+L22: .string "r"
+jsr X24
+dec *r2
+red *r7
+sub *r4, *r1
+prn L174
+prn L183
+stop
+L23: stop
+not *r5
+; comment
+L24: .string "tjziufnkjsoqrf"
+L25: inc r4
+L26: lea L2, r0
+mov L14, L88
+sub #103, r0
+L27: lea X1, r3
+clr r1
+L28: dec r2
+mov *r2, r6
+lea X0, *r1
+cmp r3, #15
+clr *r7
+L29: .data -417, 407, 159, 691, -74, 793, 24
+lea X4, X7
+L30: .data 426
+bne *r1
+bne X15
+bne X8
+inc *r3
+jsr *r0
+jmp L0
+L31: .string "mwnyvpbbysek"
+jsr L82
+rts
+
+bne *r4
+dec r3
+jsr *r6
+stop
+L32: jsr *r1
+mov *r1, *r4
+lea X13, r0
+stop
+clr r0
+lea L81, *r4
+red X1
+; comment
+red r6
+inc *r2
+add *r3, X13
+rts
+inc r4
+dec *r2
+inc *r0
+clr L14
+jmp L169
+add r5, *r6
+lea X7, L24
+sub r5, L5
+prn r7
+L33: inc L9
+L34: bne *r2
+bne X4
+inc *r5
+cmp *r2, #-246
+mov *r7, *r1
+L35: .string "rmftbiouyagwbfwtwufjclev"
+rts
+dec L1
+prn *r7
+rts
+not r2
+clr X5
+cmp #106, r1
+L36: clr *r4
+jmp L18
+L37: .string "kpdooeujrbyjtkydjcba"
+stop
+L38: prn r7
+bne *r5
+L39: mov r3, *r7
+L40: .string "by"
+prn *r6
+L41: not *r7
+; comment
+cmp #237, r6
+add #-162, X18
+jmp L236
+L42: .data 589, -698, 501, -646, 845
+L43: .data 104, 331, 57, 367, -405, 14, -214
+L44: red r2
+bne X16
+add #209, r0
+lea L179, L11
+L45: .data -327, -286, -308, 419, 419
+dec *r3
+dec *r1
+red r2
+L46: cmp *r3, #162
+not *r5
+not L32
+jsr *r3
+rts
+not r4
+sub r0, r0
+jsr *r4
+mov L191, r3
+L47: .data 538, -926, 969, -788
+dec *r4
+cmp #148, r1
+red r0
+red L149
+jsr *r1
+L48: jsr L31
+cmp #85, L22
+sub #75, *r0
+stop
+cmp #105, r2
+inc r4
+sub r5, r5
+jmp L64
+red *r2
+stop
+add X18, r0
+lea L46, X6
+L49: bne L23
+mov #-45, L34
+dec X8
+inc L178
+red L67
+rts
+L50: sub X4, *r4
+sub *r7, *r2
+prn r4
+L51: .data -330, -267, 482, 68, 306, 246, -543, 567
+L52: cmp #-101, r6
+L53: stop
+rts
+L54: prn #107
+add L113, r7
+not L27
+not L233
+
+cmp *r5, r3
+L55: .string "adhhlcepm"
+clr r6
+L56: .string "pfhagkx"
+prn #33
+jsr *r1
+rts
+; comment
+not *r3
+lea L221, r5
+bne *r6
+cmp r0, X13
+mov *r5, r4
+stop
+red *r4
+L57: bne *r4
+red L1
+jmp L69
+clr L50
+inc *r3
+inc L137
+not r2
+jmp *r0
+L58: add #77, *r3
+sub #51, *r4
+L59: stop
+stop
+cmp *r5, X20
+jsr *r3
+cmp *r0, #29
+not *r5
+jsr L206
+bne L49
+jsr X10
+cmp *r2, *r3
+bne *r3
+cmp #45, L239
+L60: mov L106, r4
+L61: rts
+L62: not r1
+L63: dec *r6
+L64: sub #52, L53
+
+stop
+stop
+jmp *r4
+prn r1
+mov #-189, r3
+cmp L0, X23
+red r7
+clr *r4
+
+rts
+cmp #119, #-189
+inc X12
+L65: clr r0
+jsr *r4
+add #18, L14
+clr *r4
+add L58, *r0
+L66: .data 854, -425, 931, -603, -983, -791, 484, 231
+L67: stop
+L68: .data -441, 624, 923
+jsr L181
+add L86, X20
+jsr *r7
+jmp L47
+not X20
+rts
+mov *r5, *r5
+L69: stop
+L70: mov L50, L162
+prn L55
+L71: bne X7
+L72: clr r2
+dec r3
+rts
+inc *r7
+dec *r3
+red *r4
+L73: jsr L83
+L74: dec *r1
+lea X20, r4
+stop
+jmp L17
+prn #94
+
+cmp X6, *r6
+jsr L55
+stop
+; comment
+stop
+L75: sub r2, L109
+sub #115, X7
+stop
+inc *r6
+jmp *r5
+jsr L196
+red r5
+prn #131
+stop
+L76: sub X5, r5
+rts
+L77: .string "ejtqinpzqrfaxcppy"
+L78: stop
+
+prn *r4
+mov #-60, r7
+lea X18, L25
+sub *r6, X10
+lea L66, r7
+lea L18, r0
+red r0
+rts
+jsr X7
+jsr L59
+
+L79: bne *r0
+red X6
+L80: stop
+L81: not *r0
+L82: .string "vsnfxid"
+prn r5
+L83: cmp #-16, #47
+not *r1
+add #-55, *r7
+lea L65, X9
+L84: .string "esqaqcthuogetrpaytrmihy"
+lea L181, *r4
+add #159, *r2
+L85: sub #182, *r0
+bne X23
+inc *r4
+L86: .string "fvbzxdhbzfz"
+bne *r4
+jmp *r0
+mov r3, *r1
+L87: .data -853, -881, -797, -174
+; comment
+not r2
+cmp L249, r5
+L88: .data -451, 803, -137, 365, 902
+clr *r2
+bne L135
+dec L209
+L89: .data 646, 305, 814, 756, -456
+jsr *r0
+jsr X2
+bne L230
+bne *r0
+cmp X5, #-4
+not *r6
+inc L199
+add #191, r5
+lea L28, *r4
+mov r2, X13
+L90: jsr *r5
+cmp #-89, #-69
+stop
+L91: prn *r6
+clr r5
+; comment
+cmp r1, L152
+mov X13, r7
+sub L72, *r3
+rts
+cmp #141, #52
+L92: .data -753, -568, 508, 27, 192, 697
+rts
+not r5
+L93: rts
+; comment
+red *r1
+inc *r6
+stop
+jsr L232
+red X12
+dec L152
+dec L135
+
+L94: cmp #110, r5
+stop
+L95: add #-178, r7
+add #71, *r1
+dec *r6
+rts
+jsr *r3
+jsr X24
+add *r1, L87
+red X17
+jsr X17
+L96: inc r1
+clr *r6
+bne *r4
+sub *r3, *r7
+bne *r7
+jsr *r1
+L97: .string "nuezsfnunvufavkl"
+clr r3
+L98: .string "zcyxzkjyrhpdxjcbbzos"
+inc X23
+L99: .string "toc"
+rts
+rts
+L100: .string "gpoyhzkaybdawdhkai"
+red *r5
+L101: mov r6, L38
+dec L69
+L102: not *r0
+sub r3, X12
+dec r6
+not *r1
+add r7, r6
+red r3
+L103: red L8
+
+bne *r2
+L104: clr *r2
+add #-8, *r4
+clr L148
+red r4
+L105: .data -140, -977, 200, -492, 661, 716, 949
+prn *r3
+rts
+stop
+L106: rts
+prn L21
+mov #-26, r5
+add #56, L74
+L107: .data -506
+not L174
+lea X6, L83
+L108: dec L1
+clr *r3
+L109: dec X3
+lea L18, r4
+L110: inc X7
+; comment
+jmp *r4
+rts
+L111: jsr *r7
+lea L143, X15
+L112: .data -334, -516, 79, -694, 589
+L113: .string "myrq"
+not *r4
+jmp X6
+add #-110, X8
+dec L27
+jsr *r0
+bne L111
+bne L148
+jsr L115
+mov *r1, X24
+clr L51
+inc L26
+rts
+L114: not r5
+lea L164, r4
+sub *r2, r7
+add #101, X12
+jsr L203
+mov *r7, L220
+red X16
+mov *r1, *r2
+clr *r6
+bne *r3
+L115: add L89, r6
+dec X21
+jsr L88
+L116: cmp L136, #131
+not X15
+rts
+jmp L204
+add *r0, X6
+dec *r3
+jsr X22
+rts
+L117: .string "lorovwztmcxfh"
+sub *r7, r5
+inc X23
+sub *r4, L117
+mov X5, r6
+L118: .string "wljaitlszeqpbcfldbilyhki"
+sub L157, r0
+clr r1
+jmp X10
+add #205, *r4
+cmp X1, *r3
+L119: cmp *r5, *r1
+L120: prn r1
+inc r5
+jsr L72
+L121: lea X15, *r7
+L122: jsr X16
+lea L151, X7
+stop
+mov L180, *r1
+jsr *r4
+not L205
+cmp #-33, r2
+bne *r4
+rts
+
+L123: stop
+sub #207, r5
+jmp *r1
+L124: .data -334, 682, -998, -716
+jmp L49
+add *r0, L25
+lea L189, r6
+cmp *r6, *r0
+dec X5
+L125: stop
+stop
+L126: inc L191
+rts
+
+
+L127: .data 55, 163
+red L221
+red *r5
+clr *r5
+sub *r7, *r2
+lea L181, L105
+not r0
+lea L43, *r2
+add #-195, X19
+dec L228
+L128: jsr L70
+bne *r1
+jmp *r6
+bne L208
+sub #-232, r1
+not *r3
+bne X4
+L129: sub #-86, r3
+L130: .data -440
+stop
+L131: inc L58
+L132: mov #22, *r7
+L133: jmp *r5
+add #-92, L128
+mov *r6, L218
+add *r7, L89
+not *r2
+lea L243, *r3
+sub r6, r3
+rts
+red *r6
+stop
+; comment
+red r5
+L134: sub #-146, *r1
+sub #234, *r3
+prn #85
+sub *r7, r7
+L135: .data 491, -93
+not L141
+dec r2
+L136: .data 953
+not r6
+L137: .string "yiqbwhqpnhdpvrzdbhzcfc"
+jmp L121
+; comment
+stop
+mov #-147, r5
+mov *r3, L247
+cmp *r6, #-256
+jsr X19
+; comment
+sub r2, X12
+cmp *r3, *r6
+inc L194
+dec L168
+
+jsr L38
+L138: .string "ozmkqbmfqmbcxk"
+sub #-41, X23
+L139: .string "jfcc"
+bne *r4
+cmp *r2, #-202
+rts
+L140: bne X18
+clr L9
+L141: dec r7
+rts
+L142: bne *r4
+bne X2
+inc r4
+dec r7
+prn #33
+prn L83
+clr *r0
+jsr *r6
+L143: add #-253, *r3
+L144: not *r6
+not X15
+L145: .data -374, -135, 52
+jmp L184
+jmp L6
+red r2
+L146: .string "pw"
+cmp *r1, #187
+mov L65, *r0
+mov *r5, r6
+L147: lea L143, r2
+L148: .data -46, -934, 467, -442, 815
+lea L11, r6
+prn X12
+jmp L160
+prn *r0
+jmp *r3
+dec L37
+
+dec L238
+L149: add r1, r7
+red X7
+bne X17
+mov r2, r0
+mov *r4, r2
+L150: .data 710, 603, -874, -834, -175, 68, 965, -63
+mov X2, L4
+stop
+prn *r0
+jsr L90
+dec L229
+; comment
+rts
+lea X0, *r2
+cmp L47, *r4
+rts
+L151: jmp L61
+not L1
+stop
+jmp X4
+rts
+L152: .data -798
+L153: rts
+dec *r2
+prn *r6
+L154: .string "sbg"
+not *r6
+prn X9
+not L75
+L155: .string "zmj"
+L156: mov *r5, r5
+red r6
+dec r3
+L157: .data 525, 27, -794
+lea X12, *r1
+L158: .data -376, -124, -917, 543, -168, -422, -726
+L159: bne *r5
+jsr X18
+
+cmp #-21, L197
+add X1, L198
+rts
+dec L229
+red *r5
+lea X24, L113
+sub X9, *r7
+stop
+L160: add #-101, r1
+L161: bne *r4
+prn L17
+sub *r6, *r3
+jsr *r2
+bne *r3
+jsr X21
+prn X21
+cmp *r1, *r6
+jsr *r6
+jmp *r0
+; comment
+clr r5
+L162: .string "ahxrwhaiiq"
+not *r3
+jsr *r0
+prn #215
+L163: dec r0
+inc X0
+bne *r1
+red r6
+; comment
+not L78
+sub #-28, L83
+bne X10
+L164: .data -593, 999, 899
+dec *r4
+red r2
+sub L217, *r0
+inc *r6
+not r1
+
+sub r2, *r7
+mov X19, *r3
+L165: mov #-112, L128
+clr r3
+prn L246
+inc r3
+bne X11
+rts
+stop
+L166: stop
+cmp r1, #-221
+L167: .data -112, -617, -306, -376, -904, -185, 949, -133
+bne *r7
+bne X21
+stop
+L168: not L59
+L169: .data 338, 728, 666, 75
+stop
+clr r5
+L170: .data 338, 476, 94, -235, 736, 126, -883
+L171: clr L215
+
+jsr L13
+cmp L238, *r1
+L172: dec *r7
+dec L151
+cmp X13, #-99
+L173: dec r0
+prn L235
+L174: prn #168
+L175: clr *r3
+cmp *r4, L245
+sub *r0, L174
+stop
+inc r1
+rts
+L176: stop
+add L197, r6
+rts
+inc *r6
+not *r5
+sub X14, X24
+stop
+L177: .data 417, -850, 515, 656
+dec r5
+L178: sub #88, L216
+inc r1
+dec *r3
+add #172, X20
+L179: cmp *r3, *r2
+L180: not *r0
+L181: cmp #-69, #66
+sub r0, L244
+L182: .string "bbkkozmww"
+cmp #-158, X13
+add L215, L199
+inc *r0
+inc L179
+L183: sub #178, *r1
+L184: inc L50
+stop
+add #40, r0
+sub L16, r7
+lea X13, r0
+red L90
+stop
+prn r3
+stop
+L185: rts
+L186: mov #7, L34
+jmp X11
+
+red r5
+L187: sub X14, *r0
+clr L22
+L188: rts
+jsr *r6
+L189: bne L32
+L190: mov L93, r3
+mov r4, L230
+not L230
+bne L174
+add *r2, X7
+clr *r0
+rts
+L191: mov L220, r0
+inc L232
+not X9
+L192: .data -793, 948
+bne L122
+L193: .string "qkehmebrmipckzabmawvxqmb"
+jmp L123
+inc *r0
+not r1
+L194: .string "dslopqfyicftllbh"
+lea X12, *r4
+cmp r0, #24
+bne *r5
+L195: .string "cvzfanzz"
+stop
+add L235, *r0
+clr L8
+L196: prn X10
+L197: .data 105, -819, 865
+red r7
+; comment
+L198: .string "xpzxzmdcrfmfg"
+L199: .string "xqdizcqzgyupdvplf"
+bne L215
+add *r2, *r3
+lea L211, X24
+mov #80, r3
+L200: .data 545, -274, 23, -849, 126, 483, -171
+inc *r5
+stop
+; comment
+
+inc *r3
+cmp X7, L207
+prn r2
+sub *r3, L50
+lea L216, r5
+L201: jsr L209
+red *r2
+inc r4
+L202: .data -959, -962, -957
+stop
+clr L128
+lea L218, *r4
+mov *r5, r6
+L203: red X7
+L204: cmp r7, L230
+lea X21, L225
+L205: dec X2
+jmp *r5
+not *r0
+bne *r0
+L206: .string "otjpbdfwowugtcoxqofsqiu"
+dec L164
+lea L133, *r7
+L207: lea L68, *r5
+lea L212, L185
+; comment
+dec *r4
+L208: lea L104, L236
+cmp X6, *r2
+L209: inc r2
+sub #-84, *r3
+L210: cmp r0, L248
+jsr *r5
+stop
+L211: .string "lxwjjpddidferebo"
+lea L226, *r2
+dec r2
+mov r3, *r6
+jsr L52
+not X17
+cmp *r0, #175
+L212: not r5
+red *r2
+add *r6, X23
+sub *r1, L235
+L213: rts
+L214: .data -687, -363
+L215: cmp *r3, r2
+prn #65
+dec *r6
+L216: dec *r7
+not *r6
+inc X4
+not *r2
+mov *r4, r7
+prn #-11
+stop
+stop
+not L129
+mov X20, *r7
+L217: .string "vdddlhz"
+L218: .data 194, -781, 358
+cmp *r2, X9
+L219: .data 716
+mov r5, X18
+L220: .data 434, 760, -990, -378, 877, -724, -309
+L221: stop
+jmp *r5
+lea L224, L216
+L222: .data 628, 175, 934, -796
+cmp *r6, L238
+jmp X20
+mov X11, L246
+L223: .string "tkmdaecpe"
+rts
+mov X12, X15
+L224: inc *r1
+L225: red *r6
+inc X24
+L226: .data 381
+prn L234
+; comment
+add r1, *r4
+not X20
+mov X7, r5
+L227: .data -159, 251, 801, -257, 558, -744, -876
+add #-239, *r1
+L228: .string "tznwby"
+prn *r5
+dec L7
+add *r2, r7
+bne X4
+L229: jsr *r0
+L230: lea X6, *r6
+L231: add X7, X12
+dec *r2
+stop
+cmp #-64, r4
+stop
+not X22
+jmp *r1
+inc L246
+jmp *r7
+
+dec r1
+inc *r0
+L232: cmp #104, *r7
+L233: lea L248, L242
+not *r5
+red r5
+L234: clr L248
+L235: sub X21, r6
+rts
+L236: rts
+jsr X3
+L237: jmp L30
+not *r7
+cmp r7, r4
+L238: lea X22, L240
+prn *r1
+L239: .string "khhdheyqfhkc"
+not L53
+L240: .data -419, -197, -349, 844, 389, -256, -482, -888
+L241: jsr L249
+cmp r4, r5
+L242: jsr *r7
+L243: not *r6
+L244: prn #7
+mov *r2, L17
+jsr *r1
+inc *r0
+red *r3
+not *r3
+sub X21, r6
+stop
+sub *r0, L245
+sub *r5, L247
+jmp L247
+; comment
+
+stop
+sub r4, X8
+clr r5
+cmp #128, #-64
+sub *r0, *r5
+rts
+rts
+sub r2, L247
+prn L248
+cmp r1, r3
+L245: sub *r7, r6
+jmp L211
+
+dec *r6
+L246: lea X18, L193
+L247: .string "aazidsjt"
+jmp X1
+jsr X20
+L248: add r0, r7
+mov *r7, *r2
+not r4
+bne X0
+L249: .string "mkxkfvvqiczxjzw"
+cmp L64, r7
+stop
@@ -0,0 +1,1045 @@
+; Generated by genCorpus --seed 48
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+clr r0
+red *r2
+jsr *r5
+clr *r7
+bne L32
+not r7
+clr L44
+L0: add *r4, L0
+L1: dec *r3
+jsr X8
+L2: cmp #-32, *r2
+mov r2, *r7
+L3: .string "cilfoxujtpcyohslqryqxdum"
+not L2
+L4: add r6, *r6
+clr *r5
+cmp L4, r5
+dec r0
+
+L5: .string "ns"
+rts
+; comment
+jmp *r6
+lea L4, *r0
+cmp r1, r0
+L6: cmp r6, #125
+L7: bne X10
+not L230
+inc r3
+prn r4
+stop
+
+sub X19, *r4
+lea X11, L7
+inc X1
+jsr *r3
+cmp L1, L6
+jsr *r4
+rts
+inc r0
+mov L6, r5
+L8: .data -273, 751, 451
+add *r1, *r6
+cmp *r6, *r3
+L9: jsr *r2
+L10: rts
+stop
+L11: .string "edvedjbgskqeq"
+not r0
+L12: lea L5, r6
+clr X22
+stop
+inc *r4
+prn r0
+L13: jsr X17
+L14: .data 632, 788, 750, -682, 952, -728, -938
+rts
+add #79, r1
+L15: jmp *r4
+
+dec L9
+jmp L67
+jmp L13
+rts
+L16: bne L16
+dec L193
+L17: stop
+L18: .data 299, -152, 189, 311
+stop
+cmp X2, #69
+lea L226, *r3
+dec r2
+inc X16
+; comment
+L19: .data 746, -236, 447, -68, -984
+jsr *r2
+prn X14
+L20: rts
+bne X23
+cmp L19, L251
+L21: .data -396, -797, 21, 322
+L22: jmp L189
+inc r1
+prn X14
+mov r6, r1
+mov #-67, X12
+L23: .string "pxzcvxaoveovhoafhoduhj"
+dec L60
+sub *r1, L168
+lea L149, r6
+bne X15
+mov L26, *r1
+prn *r5
+red r7
+clr *r1
+cmp X12, r3
+L24: red r4
+dec r4
+cmp *r4, #185
+lea L17, L15
+not L235
+L25: add r6, L245
+not *r2
+jmp L235
+red *r5
+stop
+mov #25, X10
+mov L12, X4
+L26: inc r1
+stop
+lea L8, r7
+clr r0
+L27: cmp #172, #-76
+jmp L38
+mov #105, X13
+lea L262, r1
+; comment
+rts
+L28: stop
+clr *r4
+dec *r1
+dec *r3
+dec L1
+L29: mov r3, *r4
+bne *r1
+L30: .data -157, -540, 552, -654, -979
+not *r4
+L31: .string "zrijpujrnqrdj"
+L32: add *r2, r5
+L33: jmp L30
+add r3, *r7
+; comment
+
+red L71
+red r0
+inc *r3
+jsr X10
+dec L215
+mov #150, L245
+red X11
+cmp r7, *r2
+mov *r7, L14
+jsr X2
+add #88, L125
+L34: add *r5, L152
+prn *r0
+not L10
+rts
+rts
+sub *r7, *r3
+inc *r3
+L35: .data 881, 398, 418, 226, 622
+clr r1
+jmp *r0
+jsr L77
+mov L7, *r2
+cmp r1, #-113
+L36: lea X0, r5
+; comment
+L37: .string "robaukevlalq"
+prn *r7
+cmp #244, #-93
+rts
+jsr L178
+L38: stop
+red L69
+L39: .string "uqcmruatdjlufxyhpk"
+L40: dec *r4
+L41: red r6
+clr r6
+not *r7
+L42: .data -451, 169, 417
+L43: mov *r4, L2
+cmp r2, *r3
+prn X23
+mov #-225, *r1
+sub #-11, *r7
+red *r2
+lea L21, L197
+L44: .data 116, 619, -240, 701, -252, -1, -837
+L45: bne X5
+L46: .string "hczpvjpua"
+L47: inc *r1
+L48: add #55, X19
+dec r2
+rts
+; comment
+
+L49: .string "uwugiunturiehpezhrwup"
+L50: lea X21, X24
+inc X20
+red *r3
+red r0
+jmp *r7
+prn *r4
+not r1
+dec *r4
+L51: inc L20
+mov r7, r5
+cmp r2, L175
+L52: lea X14, X10
+L53: red *r4
+rts
+L54: mov #71, *r3
+mov *r2, L234
+sub L173, L16
+jsr X17
+rts
+not r4
+; comment
+L55: cmp r2, X10
+cmp *r3, *r0
+mov X10, r0
+cmp L6, *r5
+not r0
+jmp *r0
+lea X12, *r3
+L56: prn L253
+L57: .string "wwphszdrdwxpfqb"
+; comment
+rts
+L58: .string "tyepvubtdrfznltpldkby"
+prn L121
+jsr *r2
+prn r2
+jmp X4
+add #-226, r6
+not *r5
+jmp L272
+L59: .data -278, 344, 913
+sub r1, r2
+L60: .data 150, -755
+lea L10, *r1
+dec L127
+mov L6, r7
+L61: red *r2
+sub X24, L20
+cmp L28, *r4
+jsr *r6
+stop
+L62: bne L61
+add X20, *r5
+jmp *r4
+inc L34
+not *r2
+sub r4, *r1
+prn X4
+cmp r6, X23
+stop
+L63: bne *r5
+jsr X4
+jmp *r2
+; comment
+stop
+L64: .data 279
+inc *r1
+L65: inc *r7
+inc *r1
+mov r5, X19
+lea L38, L26
+jmp *r6
+L66: not r3
+jmp L32
+not *r3
+rts
+stop
+L67: lea L155, X9
+bne L50
+red r2
+prn r4
+clr *r5
+mov r5, r4
+jmp X24
+jsr X2
+clr *r4
+rts
+prn X15
+bne X18
+L68: .data -640, 224, 659, -935, -296, 476
+L69: dec r4
+L70: red L143
+not X8
+L71: cmp r6, *r3
+mov *r4, r5
+bne X14
+bne *r0
+prn #5
+clr r4
+sub #-123, *r5
+cmp *r2, #103
+not r0
+prn *r2
+L72: cmp X21, #11
+L73: prn #-108
+cmp #-255, L70
+red r6
+add *r2, X1
+add *r2, L65
+stop
+clr *r1
+mov #30, L109
+rts
+L74: sub *r0, X19
+rts
+L75: .data 925, 882, -115, 84, -159
+red *r2
+stop
+clr r6
+rts
+rts
+L76: clr r0
+cmp *r5, #233
+L77: prn #239
+L78: lea L7, r1
+lea L118, r4
+L79: mov r2, L185
+lea L67, *r2
+cmp r2, r6
+cmp #130, L89
+rts
+jsr *r6
+L80: bne *r4
+bne L59
+dec *r3
+rts
+not r3
+clr X21
+bne *r3
+dec r6
+clr X2
+inc X3
+bne L44
+L81: sub X12, X2
+jsr L214
+L82: jmp L29
+not L160
+inc *r6
+L83: inc X2
+inc L75
+rts
+lea L33, *r2
+add L17, r1
+L84: add #239, X3
+; comment
+lea X7, L55
+inc r1
+not r3
+L85: .string "gc"
+L86: jmp *r4
+not *r2
+L87: stop
+sub #-101, *r2
+sub #-181, r5
+L88: inc r0
+sub X2, L173
+jmp *r0
+L89: .data 317, 880, 725, -87, -907, 949, 729
+rts
+L90: inc L228
+L91: jmp X4
+not r3
+L92: not X19
+cmp L142, L57
+; comment
+lea X9, L122
+lea L8, L113
+inc L190
+L93: not r5
+L94: bne X17
+L95: .data -842, -31, -375, -115, -717, -891
+bne *r6
+L96: sub #-83, *r4
+L97: dec X6
+stop
+clr r6
+bne L102
+dec r2
+lea L215, L236
+red r6
+inc *r7
+L98: mov *r4, L82
+inc r3
+L99: .data 407, 387, 18, -340, 773, -896, -882
+add L182, *r5
+bne *r0
+
+jmp *r4
+sub X19, L107
+stop
+cmp L196, r0
+dec r1
+clr r2
+jmp *r0
+cmp L164, #-8
+L100: dec *r5
+L101: .string "qpynsrbuf"
+
+stop
+L102: jsr *r1
+not X7
+L103: clr X13
+red L13
+not *r5
+prn X1
+inc *r0
+clr *r0
+clr *r1
+L104: .string "snweuareovtlat"
+dec r3
+mov L102, X8
+L105: inc L87
+red X0
+L106: prn X18
+mov #-48, *r3
+lea L3, X16
+L107: add #-57, X16
+cmp *r3, #165
+L108: .data 723, -317, 852, 144, 861, -48, -401
+L109: prn #-76
+sub *r3, L137
+bne *r2
+dec L262
+L110: .data 104, -102, -818
+dec *r1
+L111: .data 858, -684, -345, 156, -333, -540, -652
+L112: not *r6
+sub *r5, L244
+mov *r4, r2
+sub L87, *r7
+stop
+clr *r7
+dec r0
+jmp *r0
+L113: sub r7, *r6
+dec r7
+cmp r2, r6
+jmp *r3
+; comment
+; comment
+lea L11, r1
+L114: inc L10
+prn #133
+bne L184
+L115: not *r1
+bne *r4
+stop
+L116: .string "ewuewngqfgszhaqqxjwzpj"
+cmp L49, r2
+cmp r1, *r5
+red r0
+jsr X24
+L117: rts
+L118: .string "olrlxdimrzsbpilyjewhx"
+prn *r0
+not r6
+
+L119: stop
+L120: .data 712
+L121: mov #220, X5
+clr r5
+lea L93, *r7
+bne L207
+L122: inc r6
+jmp *r2
+sub L270, L73
+L123: prn #205
+bne *r2
+L124: lea L51, *r5
+L125: not L34
+L126: .string "zzzgoieyxadkaguu"
+L127: cmp *r5, *r1
+; comment
+inc r1
+L128: mov X13, r4
+sub X12, L138
+cmp r3, r6
+L129: .data 143, -786, 690, -66, 81, 207, -696
+
+rts
+bne X16
+not r7
+sub *r0, *r0
+L130: mov #-124, *r1
+jsr L168
+jsr *r4
+L131: clr *r5
+jsr *r5
+prn r4
+dec *r3
+clr r5
+cmp *r7, #-37
+mov r3, *r0
+L132: mov r7, r7
+inc X17
+stop
+L133: mov *r3, X10
+not *r1
+prn r4
+L134: jsr X21
+L135: inc *r2
+prn #79
+L136: prn L85
+stop
+bne L124
+sub r7, *r5
+L137: red r6
+stop
+add r2, *r5
+lea X12, r0
+cmp r6, L50
+L138: .data -551, 518
+inc *r0
+sub #-84, *r1
+stop
+jsr *r4
+dec L163
+red r2
+cmp L69, X17
+L139: .string "scxxknpvyzqnif"
+sub *r1, L53
+clr X13
+L140: jsr *r5
+L141: .data -652, 219
+lea X3, r0
+L142: .data 695, -769, 158, -106, -207, -606, 754
+bne *r7
+stop
+L143: .string "c"
+jsr X17
+jsr *r3
+lea X2, r2
+rts
+jsr L159
+rts
+red r2
+L144: .data 542
+dec r3
+inc L104
+rts
+L145: bne *r7
+cmp *r6, r1
+L146: not r5
+prn #205
+L147: .string "prjhxtv"
+jmp *r0
+cmp r2, *r3
+jmp L217
+lea X6, L147
+L148: .string "spjdraqzml"
+L149: sub X12, r2
+cmp *r6, *r7
+mov r0, X16
+lea L74, *r4
+red r2
+L150: .string "xctiokety"
+lea L143, r1
+L151: bne *r4
+sub *r0, L156
+add L202, *r2
+mov r0, *r5
+clr r1
+clr r1
+red r4
+L152: dec L27
+jsr *r0
+L153: prn #199
+rts
+rts
+clr L222
+bne *r0
+jmp *r7
+L154: .string "wtiknzeaamclhwfldu"
+lea L73, L163
+L155: stop
+; comment
+bne X9
+red X3
+dec X24
+L156: .string "qtnhfrjgjoscccfnn"
+not r0
+red *r2
+L157: add L167, L249
+dec r4
+L158: cmp L230, #152
+not r4
+mov #-36, r6
+lea L196, r3
+cmp r3, X8
+stop
+jsr L223
+sub *r3, r0
+cmp *r3, #-59
+stop
+not *r2
+bne *r4
+add r1, r2
+L159: .string "hueykxdwqzkdzpvrqoppoui"
+; comment
+L160: prn *r4
+L161: dec r0
+dec r3
+L162: inc r6
+rts
+jmp X14
+add #-121, *r2
+lea X0, *r7
+stop
+L163: cmp *r7, #107
+L164: .data 678, 404, 63, 96, 94
+not X17
+jsr L20
+stop
+L165: not X2
+bne *r2
+L166: .string "qadw"
+add #-128, r4
+L167: .data 354, -441, 179, 682, -913, 690
+
+inc r2
+not r6
+; comment
+L168: .data 524, 687, 263, 302, -406
+sub *r2, *r5
+rts
+L169: jsr *r2
+red X2
+rts
+dec *r4
+L170: .data 115, -423, 306, 974
+prn #207
+bne *r3
+; comment
+L171: dec *r4
+L172: jsr *r6
+L173: red *r2
+L174: dec *r7
+jmp X7
+not r5
+cmp *r4, #66
+jmp L64
+L175: sub r4, r5
+prn *r2
+prn *r4
+stop
+cmp r1, #36
+L176: sub #-128, L250
+cmp #-83, *r2
+not L255
+rts
+cmp r4, *r0
+clr L54
+red *r1
+clr *r6
+L177: .string "lplhmyzeevbqspyxjpiu"
+jsr L10
+stop
+add r3, *r4
+jsr X1
+
+L178: not *r0
+L179: jmp X19
+bne L219
+L180: .string "jcachkvzkrkpi"
+rts
+add X21, r0
+L181: dec X2
+not *r6
+L182: mov r4, r2
+red X13
+stop
+not r7
+dec r2
+clr X9
+L183: jsr X10
+clr r3
+jmp *r7
+L184: .string "tgffsganhkdnwdckedqs"
+L185: .data 830
+jsr L211
+L186: lea L252, X23
+L187: .data -89, -855
+L188: lea L54, *r5
+sub *r1, L42
+bne L71
+stop
+sub *r5, *r0
+L189: inc r5
+rts
+inc *r0
+L190: .data 764, 294, 405
+; comment
+sub r1, r6
+dec *r6
+not X1
+jsr *r4
+L191: rts
+sub r4, X1
+sub #112, L216
+stop
+sub L62, r1
+L192: not *r7
+jmp X12
+L193: sub #-120, r6
+L194: .data 429, 120
+prn #151
+not r0
+prn #150
+cmp X6, r2
+stop
+lea L108, *r1
+lea L86, *r6
+lea L198, *r1
+not X10
+; comment
+not r3
+add X24, r5
+L195: .data 428, -954, 250, -406, -798, 823
+inc L77
+L196: stop
+L197: .data 687, 14, -890, 348, -41, -440, -904, -946
+lea L222, r5
+clr *r7
+dec *r0
+mov r0, *r3
+bne L63
+lea L3, r4
+L198: not *r7
+L199: .data 365, -617, 111, 383, 409, -273
+cmp #-119, #187
+inc L87
+dec L108
+cmp r6, L102
+; comment
+L200: lea L50, *r6
+jmp L222
+mov r4, r1
+prn #-70
+lea L193, L208
+L201: .data 466, 149, -621, 871
+L202: .string "lkrhefnzjazpfdn"
+mov *r7, L231
+add L23, X9
+L203: dec *r4
+mov r0, L258
+mov #-43, r1
+lea L71, L7
+L204: .string "hph"
+jsr *r7
+L205: .data 632, -816, 800, 427
+mov *r2, r2
+prn #133
+L206: clr L157
+prn *r4
+mov r7, *r7
+add #116, r6
+bne L211
+prn *r5
+inc *r1
+red r2
+sub #-111, *r2
+L207: .string "b"
+dec *r7
+prn L269
+stop
+L208: jsr X2
+add *r1, r0
+jsr *r2
+inc L18
+lea L268, *r4
+L209: sub L20, *r2
+prn r7
+bne L169
+inc r3
+prn L1
+rts
+L210: dec *r3
+mov X9, *r1
+L211: not r1
+red L41
+L212: clr r5
+jmp X16
+L213: cmp #178, r5
+L214: .data -960
+L215: .data 959, -453
+jmp L137
+
+sub X14, r7
+
+
+dec r3
+stop
+stop
+sub #-204, r6
+cmp #-89, *r5
+jmp L246
+clr X11
+bne *r7
+L216: .data 657, -38
+L217: jsr L268
+bne *r4
+L218: mov r0, r2
+jsr *r6
+bne X2
+L219: clr r5
+red *r7
+L220: inc r3
+clr r0
+prn r7
+bne X23
+L221: .data 37, -138, -3, 460, 123, 233
+jsr X19
+L222: red r5
+lea L71, r1
+jsr *r1
+cmp *r0, *r6
+L223: .string "tgaucu"
+cmp *r1, #210
+L224: .data -79, 149, -857, -951, -836
+L225: inc r1
+; comment
+lea L258, X5
+add r7, *r4
+L226: rts
+rts
+prn L271
+red *r7
+clr *r4
+jmp L263
+L227: jsr L233
+L228: cmp *r4, r2
+red X24
+mov *r0, *r0
+sub #-191, *r5
+
+
+add r3, *r5
+L229: .string "eifndaee"
+L230: inc *r2
+prn r3
+add L9, r2
+L231: prn *r0
+mov L219, L173
+cmp X17, *r2
+dec *r0
+red *r2
+L232: .string "aztkhkuf"
+mov *r3, L89
+lea X7, r3
+L233: not L203
+dec *r0
+stop
+L234: red r7
+L235: .string "iulnajlmamr"
+L236: mov L255, r6
+lea L58, L254
+mov #63, r7
+dec *r3
+L237: jmp X1
+L238: .data -52, -360
+dec r6
+lea X6, r5
+L239: .string "nusbwqxyayupncdnrhjk"
+prn X0
+inc r1
+sub *r4, L126
+inc r6
+jmp L55
+L240: red *r2
+; comment
+L241: .string "wononkoicqhzndhwfpxafr"
+bne *r5
+lea L254, r5
+jmp *r7
+cmp L271, *r4
+L242: mov *r0, r2
+not *r0
+add *r5, *r5
+L243: clr *r2
+clr r4
+dec *r4
+L244: red L247
+rts
+add r3, L4
+prn r3
+L245: lea X24, *r7
+L246: inc *r4
+stop
+jsr L271
+L247: .string "omcntmyf"
+cmp r3, X8
+L248: inc r2
+add #-208, *r2
+cmp #-237, L255
+red r4
+red *r2
+inc *r5
+; comment
+lea L257, *r1
+jmp *r1
+L249: .data 595, -444, 301, -948, 339, -205, 379, -376
+L250: rts
+rts
+clr *r7
+add *r1, r3
+lea X6, r7
+jmp L73
+L251: .string "ekebmvegbuzafsaoceuqtxb"
+L252: add #214, X4
+bne X21
+mov *r5, L269
+dec r7
+L253: dec *r7
+bne *r2
+L254: .string "wrwhtaboeqa"
+jmp *r6
+L255: .data -118, -844, -666, -350, -585, 847, 171, 426
+lea L264, r1
+cmp *r5, *r3
+jsr X21
+lea L93, r4
+L256: sub #-222, *r3
+L257: sub r4, r4
+L258: bne *r6
+L259: .string "lbk"
+L260: .string "olc"
+jmp *r7
+clr r1
+mov #124, *r1
+prn *r3
+L261: rts
+prn L270
+dec r5
+clr r6
+clr *r2
+inc *r5
+
+L262: inc r3
+cmp #-48, *r0
+red *r3
+dec r2
+lea X23, *r2
+inc r4
+L263: .string "yyy"
+add *r0, L268
+clr *r5
+mov L35, *r1
+L264: clr r5
+mov r2, r1
+lea L132, r1
+dec L266
+bne *r5
+red r5
+stop
+jsr *r1
+jsr X15
+mov r4, r1
+mov *r7, L200
+L265: .data -615, 854, -319, 0, -859, -419, 981
+bne X4
+mov #77, r3
+prn *r5
+dec r3
+dec X23
+inc r6
+; comment
+sub r6, r7
+L266: not *r6
+jmp *r0
+stop
+mov *r1, *r4
+cmp L270, L43
+L267: mov r6, r4
+L268: mov #112, X3
+mov #88, r6
+sub r5, *r5
+sub #20, r1
+inc *r2
+bne L272
+stop
+jmp L272
+inc r7
+stop
+L269: .string "icuhyhvj"
+L270: add *r5, *r2
+cmp #39, r6
+L271: stop
+dec r1
+cmp X4, *r5
+mov #-110, r3
+mov r4, L272
+dec X0
+mov L170, *r1
+dec *r3
+red *r4
+jsr L94
+red L262
+clr L32
+L272: .data -177, 127
+inc L247
+stop
+stop
@@ -0,0 +1,1045 @@
+; Generated by genCorpus --seed 49
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+L0: red X11
+bne X6
+dec L0
+L1: sub *r2, *r5
+red L1
+lea L0, r3
+L2: prn *r7
+L3: rts
+clr *r7
+L4: inc r1
+bne *r4
+red *r6
+rts
+not *r1
+not r6
+L5: cmp L1, *r4
+lea L3, r3
+
+; comment
+sub L233, *r2
+prn r5
+clr *r4
+L6: .string "qr"
+stop
+L7: mov *r5, L170
+L8: add *r3, r6
+clr r5
+not r1
+jsr *r7
+
+
+L9: rts
+stop
+lea L7, r7
+L10: add r2, L10
+not r3
+lea L5, L1
+dec L1
+L11: jmp *r6
+L12: jmp *r1
+L13: not r7
+prn *r7
+bne *r4
+sub X24, r6
+clr *r7
+rts
+cmp #23, L3
+L14: jsr L3
+mov r4, *r7
+L15: rts
+L16: jsr *r0
+rts
+sub *r4, L1
+L17: cmp #-168, r4
+bne L7
+jsr *r3
+mov L117, L8
+prn #-182
+mov #-17, X9
+mov #-66, X22
+prn L268
+jsr L51
+L18: .data 236, 593
+; comment
+add L0, *r4
+not X15
+stop
+jmp L49
+L19: cmp r7, X1
+red L4
+bne *r7
+stop
+L20: .string "oyzuzfdqiaxaahk"
+bne L14
+add *r5, r2
+clr L19
+bne *r0
+L21: .data -637, 725, -167, -454, 307, 778, 653, 489
+stop
+stop
+bne *r7
+L22: rts
+clr *r3
+inc X10
+bne L127
+L23: .data -888, 987, -620
+prn #-16
+L24: not r5
+stop
+; comment
+dec r6
+prn L96
+rts
+; comment
+rts
+cmp r1, #-85
+prn r3
+L25: inc r6
+; comment
+rts
+dec L201
+L26: stop
+red L19
+jsr *r2
+not L46
+jmp *r7
+L27: .data 646, 435, 689
+rts
+inc r7
+cmp #116, r5
+L28: rts
+mov #119, *r1
+inc L277
+; comment
+red X2
+bne *r1
+lea X24, L71
+mov r7, X0
+lea X16, r4
+add r5, r1
+lea L1, X18
+L29: dec r3
+; comment
+L30: cmp *r1, r1
+add r0, X0
+cmp *r0, X3
+sub L25, L201
+lea X21, r3
+L31: dec r5
+cmp *r4, r4
+L32: lea L3, r5
+jsr L17
+L33: rts
+jsr X12
+mov *r3, *r3
+lea X16, *r4
+stop
+cmp L34, X7
+L34: lea L157, X24
+red r1
+mov *r6, r1
+prn r4
+add #-127, X23
+clr *r4
+lea L25, *r6
+not X23
+L35: sub *r1, *r6
+L36: bne *r1
+jmp *r1
+bne *r5
+sub *r6, L21
+prn *r1
+L37: red r1
+inc *r3
+add *r2, r1
+rts
+prn #60
+L38: .data -980, 658, 982, -634, 977, 704, 539
+L39: .string "nuwmnqfjhihdwo"
+jsr *r2
+L40: .string "syeeybqhdaix"
+lea X5, L0
+L41: .string "wmqpxqw"
+stop
+L42: .data 629, 36, 301, -46, -81, -545
+add #22, r3
+cmp L9, #-122
+inc L25
+jmp *r0
+L43: lea X11, L5
+red *r0
+not L160
+L44: jsr *r6
+add r1, *r5
+L45: .data -110, 655
+L46: .data 297
+L47: bne *r6
+bne *r4
+add #243, *r3
+L48: .string "eotxzozmjzvwcyonmhptn"
+jmp *r2
+L49: jsr *r0
+L50: clr X15
+jsr X13
+bne L33
+L51: bne *r4
+L52: rts
+dec r5
+add X20, *r1
+red L103
+dec r4
+; comment
+lea L91, L15
+jmp *r4
+jmp L12
+jmp X15
+
+red r5
+sub *r7, *r1
+sub #-7, L13
+; comment
+jsr *r3
+L53: .data 295, -94, -459
+L54: mov *r0, *r7
+stop
+clr *r7
+
+mov *r2, *r4
+L55: cmp X24, #-93
+lea X19, X0
+cmp X4, *r4
+sub X19, *r2
+red r3
+lea L165, *r6
+L56: .string "ofjyjnrwqryime"
+not *r1
+jsr L40
+L57: .data -828, 948, -355, -783
+not L52
+L58: .data -87, -390, 585, 153, -475
+L59: add #59, *r6
+jsr *r0
+inc L163
+bne X1
+L60: .data -130, 906, 577, -78, 633, 831
+stop
+L61: .string "bqcgf"
+rts
+L62: .data -327, -538
+stop
+inc L55
+; comment
+L63: bne L18
+clr L13
+jmp X14
+L64: prn r1
+clr *r0
+L65: red *r1
+not r1
+L66: .data 680, 87, -180
+L67: .data 718, -54, 779, -295, 823, 878, 244
+add X22, r5
+sub r0, *r6
+sub #-138, *r5
+L68: .data 80, -496, -146, -501
+dec r5
+stop
+sub #248, *r4
+stop
+mov #-16, r1
+clr L23
+
+prn *r1
+L69: lea X1, r5
+L70: stop
+bne L13
+; comment
+L71: red X0
+inc X1
+L72: inc X14
+not X9
+L73: .data 775, -444, -238, -759, -900, -697, 770, -562
+inc r6
+prn r2
+L74: .string "kdilzbe"
+jsr *r2
+rts
+inc X8
+add r7, r5
+mov r2, *r0
+L75: mov *r0, *r1
+L76: cmp #-40, X14
+not r2
+clr *r1
+bne X1
+L77: jmp *r1
+rts
+jmp L2
+jsr X20
+inc r3
+L78: clr r5
+L79: prn L177
+lea L162, r5
+lea L64, L21
+L80: bne X6
+inc X19
+lea X21, r6
+red *r1
+dec r6
+clr r6
+L81: cmp r7, *r5
+L82: clr X6
+stop
+inc r7
+red r6
+rts
+inc r1
+clr *r2
+cmp r3, #154
+prn r4
+cmp #73, r5
+L83: rts
+L84: cmp L54, #56
+L85: inc X21
+rts
+L86: .string "ehnbft"
+add L47, r2
+lea X10, L269
+L87: add #121, r5
+not r5
+L88: .data 780, -53, -458, -612, 282, -169
+L89: stop
+; comment
+cmp L12, #-122
+L90: .string "grwxrkbxwy"
+dec *r5
+L91: jmp L2
+rts
+inc *r5
+red X10
+lea X12, r1
+L92: stop
+bne L204
+add #-89, L254
+dec *r3
+stop
+jmp *r7
+dec L219
+dec r4
+L93: cmp r3, *r2
+L94: stop
+L95: .data -494, 523, -405, -989, -316, 894
+lea L193, X5
+L96: .string "qlelwdc"
+clr L159
+L97: prn L98
+stop
+prn *r6
+L98: stop
+jsr X22
+cmp #5, #113
+rts
+mov #116, *r7
+L99: red r0
+L100: .string "ywpqdbaekm"
+L101: not r0
+L102: .string "pcrszyvakm"
+not *r2
+L103: .string "xnhvpufgsraohrvsl"
+stop
+jsr *r0
+jsr L94
+rts
+stop
+jsr *r3
+lea L140, L124
+not r7
+lea L76, r3
+L104: jmp X8
+cmp *r3, L69
+L105: red r4
+jsr L41
+stop
+sub *r5, L263
+inc L28
+L106: .data 4, -559
+L107: jmp L271
+cmp L44, r4
+lea X0, *r1
+mov r2, *r2
+L108: .data -152, 206, -485, -771, -655, -559, 468
+L109: bne *r2
+L110: .string "dbsvwgcfy"
+red *r4
+mov r0, L252
+L111: prn r7
+L112: .string "x"
+not r1
+jmp L88
+prn *r2
+add *r6, r1
+inc *r1
+red r7
+L113: mov r1, X14
+not r7
+red L108
+sub *r1, X9
+lea X11, r1
+lea L268, X14
+lea L74, X5
+
+jmp X14
+L114: .data -551, 543, 33, 202, -251, 134, -60
+prn *r7
+L115: .string "snjocksgwxwoe"
+red r7
+; comment
+L116: .string "we"
+L117: bne L253
+L118: rts
+L119: sub r5, *r2
+cmp r2, r3
+prn X3
+L120: bne L26
+L121: bne L193
+clr *r6
+
+L122: jmp *r6
+cmp r2, r2
+red r1
+L123: not *r7
+L124: .data -885, -872, -882, -279, -474, 641, -984, 139
+lea X20, r6
+clr r0
+add L246, *r7
+jmp L120
+prn #28
+cmp #8, r4
+L125: .data -778, 975, 153, 823, -560
+inc X6
+not *r2
+bne X19
+red r7
+not r2
+L126: .data 767, 277, -614, -624, -526, -764, -12
+jmp L109
+stop
+not L256
+; comment
+lea L101, *r0
+L127: bne L121
+L128: clr r7
+lea L179, *r5
+red *r1
+clr L8
+clr *r2
+dec *r4
+bne *r1
+L129: .data 904
+L130: bne X17
+mov #238, L260
+lea L58, L70
+not r3
+L131: red r3
+
+L132: .data 925, 759, 583, 422
+stop
+lea L208, r5
+L133: clr X11
+cmp *r1, *r3
+lea L223, L67
+stop
+red *r7
+not *r2
+lea L190, X9
+L134: clr r3
+lea X16, X13
+clr L257
+jmp X14
+not r6
+inc *r5
+cmp #-134, #120
+sub X9, r7
+not r3
+L135: bne *r6
+sub r0, r7
+dec *r2
+mov r5, r5
+prn L125
+prn L95
+cmp *r5, #-39
+L136: .string "wkxwldzekdlqijdnmcmw"
+red r3
+L137: bne *r2
+rts
+L138: .string "gjtfypibjjszvfkan"
+sub *r2, L229
+jsr *r4
+add *r1, *r7
+add #6, r0
+jmp *r6
+jmp *r5
+L139: .data 787, 294, -602, 517, 380, -929, -684, 353
+prn r0
+L140: .data 227, -131, 299, -638, 136, -767
+
+
+jmp X5
+jmp L238
+; comment
+
+L141: .string "lnxwgfpbhjgmjx"
+jmp L121
+clr L164
+jmp *r6
+jmp *r3
+inc r2
+stop
+L142: .string "swej"
+L143: inc r4
+lea L20, r3
+not r3
+cmp L249, *r4
+L144: .data -201, 978, -393, -622, 58
+jsr X5
+prn *r0
+L145: lea X12, *r7
+cmp #-229, *r6
+L146: inc X17
+rts
+jmp *r4
+L147: dec *r2
+bne *r0
+cmp r7, X1
+L148: red *r5
+cmp #-94, *r1
+inc *r6
+cmp #100, L205
+jsr *r6
+mov L179, *r6
+jmp L45
+prn *r6
+dec *r3
+L149: stop
+L150: add #207, *r2
+L151: .string "mqopr"
+stop
+mov *r2, *r5
+L152: inc X11
+
+L153: rts
+add L208, X13
+dec r7
+inc *r4
+rts
+cmp r7, #-213
+L154: cmp r0, X4
+prn *r2
+cmp L224, #-246
+L155: mov *r6, X15
+L156: cmp #225, L6
+rts
+L157: .string "pcct"
+red r1
+cmp #-38, *r7
+clr r5
+inc L187
+red *r7
+bne *r4
+dec r7
+dec *r7
+L158: .data -514, -363, -430, -71, 875
+L159: .string "yrwxhoxlaxzsjfcysuiy"
+add r5, r4
+clr r4
+inc *r1
+L160: lea X8, *r0
+L161: inc r5
+bne X9
+lea X6, *r5
+lea X5, r0
+jmp *r7
+lea L268, r0
+L162: .data 522, -841, 1
+sub #-211, r0
+
+mov X12, r0
+lea L276, X10
+sub L235, X4
+cmp L159, *r2
+inc r1
+lea X3, r3
+sub r3, L234
+jsr *r5
+
+add #127, X9
+L163: jmp *r4
+L164: .data -389
+; comment
+; comment
+sub X12, r5
+bne X15
+dec L199
+jsr *r5
+rts
+not X0
+
+stop
+lea L269, r5
+jsr *r3
+; comment
+mov r4, r0
+L165: .string "dbpmw"
+
+dec *r7
+L166: .data 794, 283, -57, -66
+add *r1, L94
+stop
+bne *r3
+L167: .data 325, 119, 151, -535, -464, -212, -884, -632
+clr r4
+inc r1
+lea L66, r1
+sub r5, r1
+bne *r4
+bne *r6
+inc *r3
+jmp *r5
+bne *r3
+L168: jmp L58
+mov L38, r5
+bne *r6
+add r6, L196
+L169: .data -490, 390, 380
+sub r1, r0
+mov #129, r1
+bne *r0
+L170: jsr X2
+L171: add #-208, L251
+L172: .string "ddlwwcphwfjxuvlgdxppgd"
+L173: .data 509, 365, 713, -661
+jmp L219
+dec r1
+red *r3
+dec r5
+add #29, *r1
+bne L196
+L174: .string "feo"
+add L182, *r6
+cmp *r3, L102
+L175: .data -221, -54
+stop
+inc r0
+sub *r6, L73
+bne L156
+stop
+prn r0
+prn r7
+L176: inc *r4
+clr *r5
+L177: stop
+stop
+prn L57
+rts
+not *r2
+inc X13
+cmp L33, *r4
+mov #-205, L196
+bne L89
+cmp *r1, #109
+inc L174
+stop
+red *r6
+bne *r4
+prn L79
+L178: .data 628, 677, 402
+lea L28, X5
+red *r3
+; comment
+L179: cmp r3, L176
+L180: .data -860, -779, 291, 309, 57, 822
+sub #24, r7
+L181: cmp L238, r0
+bne L194
+L182: .string "eli"
+jsr *r6
+L183: .string "gcvmanwpnglg"
+L184: jsr L158
+cmp L247, L113
+bne X24
+stop
+bne L202
+jmp L84
+jmp *r1
+L185: .string "zwgbrebjoguiktlyl"
+bne *r4
+clr L230
+prn #129
+rts
+L186: rts
+L187: .data 909, -646, -991, -306, -430, -247, 550, -598
+inc X5
+clr r6
+jmp *r3
+add L171, *r2
+lea L264, L231
+add X10, X6
+L188: .string "tmdfdykbujxk"
+rts
+L189: clr X0
+dec r7
+L190: stop
+jsr X13
+L191: bne *r1
+lea X13, L248
+L192: .string "slfedlraklfvxhdug"
+red L238
+cmp L107, X16
+L193: stop
+mov L194, r6
+jsr X9
+L194: prn #211
+jmp *r4
+not X3
+prn *r2
+rts
+L195: inc r0
+L196: add r5, r3
+rts
+inc *r6
+dec r0
+add #121, X19
+prn #62
+
+not r3
+stop
+jmp *r2
+red *r3
+prn *r7
+jmp *r0
+jmp *r7
+clr *r5
+sub *r3, *r2
+mov #-172, L55
+stop
+not X13
+rts
+dec L159
+mov #-206, X6
+jmp L21
+lea L199, L205
+L197: .data -697
+red *r3
+L198: rts
+sub *r7, L198
+prn r2
+lea X10, X5
+L199: .string "ttlgjgdsvz"
+mov #-240, *r2
+; comment
+; comment
+L200: red L185
+dec *r4
+add X17, *r0
+jsr X3
+prn X24
+add *r2, r2
+L201: not r3
+bne X21
+L202: .data 151, 677, 999, 357, 96, -492
+dec L9
+jmp *r0
+clr *r7
+dec *r1
+cmp L242, *r2
+sub r6, X11
+; comment
+lea L43, r3
+L203: mov *r1, r1
+sub #-197, *r1
+red *r6
+L204: clr r6
+bne L209
+cmp #-115, r6
+stop
+L205: .string "douulioeeqhkbpyswlq"
+L206: sub #-153, L164
+L207: .data 375, -65
+clr X3
+jmp *r6
+add *r1, *r2
+bne X11
+L208: dec X0
+dec L33
+L209: cmp *r6, X15
+L210: clr L176
+sub #50, *r1
+clr *r6
+
+L211: red *r1
+L212: bne X10
+stop
+sub r5, r0
+
+dec r6
+inc r3
+not X10
+dec X20
+not X15
+dec *r5
+L213: .data -960, 130, -342, 105, 333, 39
+L214: rts
+sub #4, *r7
+jsr X7
+prn #148
+L215: prn L272
+jmp L235
+L216: prn r5
+clr L219
+red L252
+dec *r6
+clr r0
+dec *r3
+prn X8
+prn #42
+stop
+L217: .string "eqjiazgnmrsdimzbfgqw"
+add r5, r5
+L218: add *r4, X6
+L219: prn *r3
+prn X5
+L220: not r4
+add *r1, *r5
+red X18
+L221: dec *r1
+L222: add X14, L88
+L223: dec *r2
+clr L261
+L224: add X0, r0
+mov #-81, r3
+L225: .data -653, 197, 405, -647, -644, 547, -722
+cmp #221, r4
+prn L2
+not *r2
+L226: sub r2, r6
+L227: .data -671, 978, -753, 319, 73
+; comment
+red r6
+L228: not X19
+L229: .string "gkyuvohmmjkwtqydmttj"
+L230: .data 892, 973, -974, 604, 289
+sub #14, X24
+L231: .data 469, -524, -741, -712, 860, -382
+; comment
+cmp r2, r6
+stop
+cmp #141, *r5
+; comment
+dec X5
+bne *r3
+red r5
+clr X13
+stop
+L232: .data -515, -514, 130, -535, 361, 256
+L233: .data 445, 55, 915, -897
+L234: cmp *r7, #-126
+jmp X14
+mov *r3, L274
+L235: .data 889, -671, 40, 245, 245, -108, 777, 191
+inc X11
+clr L277
+L236: .data 401, -505, 397
+inc r0
+mov r1, *r0
+cmp r0, *r7
+L237: not r6
+rts
+L238: inc *r1
+L239: cmp r0, *r6
+L240: add r6, r4
+dec r1
+L241: rts
+red *r6
+red r3
+stop
+bne X13
+dec L244
+L242: jsr *r7
+rts
+L243: .string "wajnayrobiain"
+sub #152, r1
+stop
+; comment
+L244: .string "duss"
+inc *r1
+not *r2
+jmp *r3
+not L168
+L245: stop
+bne L273
+add *r1, L254
+not *r5
+not r7
+dec *r0
+rts
+stop
+L246: .string "qra"
+clr X13
+add *r7, *r2
+clr X17
+prn r5
+red *r4
+prn r0
+mov r0, X6
+sub #32, X4
+L247: .string "hxegnp"
+red r0
+clr X16
+L248: jmp L255
+L249: mov *r6, *r5
+not r6
+L250: .string "batrhyhodfsutubfobskger"
+clr *r4
+L251: bne *r4
+L252: .string "rechabblqyjtzytqyk"
+jsr L237
+stop
+add #213, L262
+dec *r7
+
+lea X3, r1
+mov *r2, L220
+L253: not L275
+red *r2
+sub L273, L276
+jmp *r7
+L254: .string "gejmepltpzttjazfdsnaeiz"
+L255: cmp *r2, *r1
+L256: bne X14
+L257: red *r0
+sub *r7, L240
+jmp L262
+L258: .string "sit"
+bne X4
+
+
+sub *r4, X4
+not *r3
+L259: .data -886, -289, 114, -950, -869, -31
+L260: prn *r0
+add X18, *r4
+red r6
+bne *r3
+L261: .data 221, -300, 324, 732
+not *r1
+inc *r4
+lea L241, r4
+; comment
+lea X20, *r3
+sub L272, r7
+L262: mov X4, *r2
+stop
+clr X23
+L263: .string "kjginwlgpzapaurscsu"
+dec r0
+L264: .string "eqjedbdvqsslybcimaydqxxf"
+add r6, X13
+prn *r1
+
+L265: prn L268
+mov #-4, X5
+L266: jsr L277
+stop
+L267: add r6, L268
+jsr *r1
+bne *r5
+L268: cmp r4, #8
+dec r1
+L269: .string "ctnhyxafwyfrrupvptl"
+jmp L226
+bne L276
+red L271
+not r6
+L270: stop
+bne *r5
+red r1
+jmp L129
+prn *r7
+sub #133, X23
+add *r3, *r4
+cmp r6, L271
+L271: inc L274
+
+mov *r0, *r4
+bne L277
+L272: .string "aqzqkvswcsrgt"
+not *r5
+red *r2
+L273: stop
+L274: jmp *r6
+red L178
+clr L151
+add *r1, r4
+L275: add *r2, X11
+dec *r6
+red *r2
+L276: inc X22
+sub X17, r6
+bne *r6
+lea L277, r0
+jsr L28
+sub L45, X6
+jmp *r5
+prn r4
+L277: jsr X3
+mov r3, X20
+red r5
+L278: sub L59, *r4
+inc X18
+lea L115, r2
+stop
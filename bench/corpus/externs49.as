@@ -0,0 +1,1045 @@
+; Generated by genCorpus --seed 50
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+jmp X12
+mov *r7, *r3
+L0: .data -364, -355, -719
+jsr L0
+L1: .string "gbely"
+L2: red *r6
+L3: prn *r1
+sub X11, L45
+not r2
+dec L56
+L4: stop
+not *r1
+stop
+sub *r2, *r0
+bne *r3
+red *r3
+cmp *r7, *r5
+L5: cmp r1, L2
+rts
+not L114
+L6: jmp L1
+prn r6
+bne X0
+L7: .string "jwfcsvjdw"
+clr L6
+add r0, r2
+; comment
+stop
+lea L1, L7
+L8: add *r5, *r3
+L9: add *r4, L44
+L10: mov r1, L183
+lea L71, *r3
+inc r5
+L11: .string "bklwwscssepbntve"
+L12: .data -442, -758, 923, -57, -384, 562, 668
+mov #222, r1
+L13: not *r2
+prn r1
+sub L43, r5
+stop
+add #-11, *r4
+prn #-204
+red X18
+red r1
+L14: not r0
+L15: .string "ckzyyphqjkupyqlzuvnf"
+dec *r4
+not r5
+L16: .string "nwqxchnfadpcezzgo"
+L17: red *r5
+L18: .string "yduyhcqnnlbyyzzjaopjfoox"
+L19: rts
+rts
+stop
+not r4
+bne *r2
+cmp *r6, *r5
+
+stop
+L20: bne *r7
+L21: red *r2
+sub #-101, L1
+stop
+mov r5, L11
+clr *r3
+dec *r3
+jsr *r7
+mov r0, L214
+dec r2
+L22: .string "cisxvfcknfybztribkkgi"
+L23: add r7, r5
+stop
+mov X24, r4
+dec *r4
+mov #-59, *r0
+L24: .data -881, 323, 940, -486, 294, -996, -951, 713
+red X12
+L25: clr L19
+clr L14
+rts
+red L8
+not *r7
+L26: red *r6
+inc *r2
+lea L3, *r0
+L27: add L21, L273
+bne L49
+L28: inc X14
+L29: .data -898, 45, -810, -793, 886
+sub *r7, *r5
+clr r5
+dec X14
+sub r3, X3
+mov L44, *r5
+L30: .data 376, 8, -522, 882
+L31: dec r1
+inc *r3
+rts
+dec X19
+clr L54
+lea L252, r5
+prn #249
+jsr *r7
+mov #-194, *r3
+jmp L14
+sub #-94, r4
+L32: jsr X16
+inc *r1
+stop
+
+jmp L162
+L33: bne *r2
+mov *r2, *r0
+L34: .string "hamyrjlezsyxbywhhjscezov"
+add *r1, r0
+bne L219
+dec r3
+rts
+dec L16
+cmp *r1, #-123
+rts
+L35: prn #5
+L36: stop
+dec r6
+red r4
+jmp *r0
+L37: .data 867
+
+L38: .string "vpmonmnbzntbw"
+jmp *r5
+jmp *r1
+lea X3, X15
+L39: rts
+dec *r1
+red L12
+L40: .data -638
+jmp L59
+stop
+stop
+inc *r4
+jmp *r7
+mov L4, r1
+L41: .data 250, -292, -50, 673, -74, -653, 553
+lea X8, *r5
+prn r4
+prn #-78
+L42: inc *r4
+stop
+jmp *r4
+L43: .string "bsjswfhewgnluwy"
+L44: add L33, r7
+dec X21
+L45: .string "utpcfxadjcjnay"
+L46: .data -9, -458, 324, 423, 492, -563, -993
+L47: inc *r5
+L48: lea X3, *r1
+mov r4, *r4
+L49: .data 533
+mov r5, r5
+not X17
+jsr L3
+jmp L0
+stop
+stop
+L50: bne L34
+not *r4
+L51: dec L23
+L52: not r6
+add r5, r2
+dec L206
+rts
+red r3
+inc L46
+not r2
+mov #-228, r5
+L53: .string "qucapmbkacgui"
+not r0
+; comment
+sub L62, *r0
+L54: inc *r2
+sub #-36, L31
+prn *r7
+L55: .string "esakmkvcpxnclprmwpuoxsx"
+jsr L61
+; comment
+jsr *r7
+stop
+red *r6
+
+; comment
+L56: .string "fesqyeugtaibxoxpizny"
+lea L245, r5
+L57: sub r0, *r7
+L58: .string "koe"
+L59: cmp *r5, #-79
+L60: bne L33
+stop
+add L31, *r6
+prn r6
+; comment
+clr r5
+stop
+L61: sub L39, r6
+L62: lea L148, r2
+dec r6
+prn #197
+sub #47, L7
+L63: .string "mawmw"
+jsr L35
+bne X5
+red *r0
+L64: bne *r4
+L65: jmp X18
+mov #-243, X4
+dec L194
+L66: jsr L144
+L67: jsr *r0
+prn #-104
+sub #-109, r6
+L68: .data -982, -63, -679, 848, 354, 327, 897
+add L43, r4
+bne L49
+clr L108
+add #-3, *r4
+L69: clr r4
+L70: .data 906, 312, -44, 851, -405, 148, 518, -226
+jmp X16
+rts
+jmp *r1
+rts
+rts
+L71: dec L14
+mov #-117, *r5
+add *r0, r6
+L72: .data 629
+jsr *r1
+cmp #-6, *r6
+L73: .string "rcjo"
+L74: cmp #-18, r3
+L75: .string "opugzfnkmxmvkjyaogcctwb"
+prn L70
+lea X15, *r5
+red r3
+L76: stop
+L77: .data -238, -754, -484, -115
+L78: .data -966, 854, -71
+; comment
+
+jsr *r5
+dec r6
+dec r6
+red r3
+red *r7
+L79: .string "cikavsmiyruhkz"
+dec L49
+clr r4
+red *r5
+L80: dec X20
+stop
+
+not r6
+prn *r1
+jsr *r0
+L81: .string "mx"
+L82: jmp L36
+mov *r0, X22
+inc r6
+sub L159, r4
+rts
+jmp L251
+rts
+clr r0
+clr r3
+lea L9, r1
+red *r1
+jsr X17
+L83: .string "xyiglqfdpord"
+dec r6
+rts
+bne X18
+prn *r5
+cmp r2, *r0
+L84: lea X24, r4
+clr r6
+L85: sub L134, X20
+mov #-170, r5
+; comment
+sub *r6, *r4
+clr *r3
+L86: dec *r1
+
+L87: bne L100
+L88: sub #-163, L235
+; comment
+clr *r7
+cmp #-31, #-91
+jsr L81
+prn L197
+jmp L0
+L89: jsr L65
+lea L90, r4
+mov r6, *r5
+dec *r1
+L90: bne *r6
+inc r2
+L91: lea L80, r6
+L92: .string "adqgroyvoiyjrjokkwwrkp"
+L93: inc r2
+rts
+clr r1
+L94: .string "tszkpnc"
+sub *r1, r3
+dec r4
+rts
+L95: prn X5
+lea L50, r0
+rts
+inc L34
+mov r5, *r6
+bne *r0
+mov *r2, X16
+rts
+L96: bne L215
+; comment
+clr *r2
+sub *r4, r6
+L97: sub *r0, r5
+L98: red L70
+L99: .data -571, -232, 782
+jmp L227
+clr L90
+red *r2
+jsr L76
+rts
+cmp r2, r0
+lea L32, r0
+L100: red X2
+L101: clr *r0
+mov r5, *r2
+L102: mov L31, r1
+L103: lea L232, L133
+rts
+L104: jmp *r4
+lea L40, *r2
+L105: jmp L61
+jsr L233
+lea L57, r6
+L106: dec r7
+dec r6
+
+jmp L14
+mov L201, r3
+not r0
+L107: stop
+L108: add X9, r2
+L109: inc *r5
+jmp *r0
+rts
+clr L114
+L110: .string "wnzdcnpcrsqldwi"
+red r0
+L111: lea L119, r3
+
+stop
+dec r5
+sub #-114, *r1
+jmp X20
+cmp L6, r7
+not r3
+L112: bne L84
+L113: .data 53, 783, 139, -575, -757, -230, -60
+sub r2, *r3
+not *r1
+dec *r0
+sub *r6, *r3
+sub r3, X7
+stop
+lea L125, L145
+L114: bne L2
+L115: mov r7, L233
+L116: mov *r2, X14
+prn #65
+L117: mov *r1, r1
+sub r4, r6
+; comment
+prn *r0
+; comment
+stop
+bne *r3
+
+jmp *r6
+rts
+lea L195, r6
+; comment
+not L268
+L118: jsr X16
+lea L205, r2
+add X13, *r3
+stop
+L119: inc r4
+jsr L266
+L120: red L218
+lea L166, *r5
+stop
+L121: dec *r3
+; comment
+stop
+stop
+not *r3
+add r6, *r0
+L122: .data -350, 571, -580, 241, -72, 968, -130, 742
+clr r4
+sub r2, r3
+
+dec r7
+mov L54, r2
+prn L255
+L123: clr *r6
+; comment
+jmp *r3
+L124: add #119, X16
+rts
+L125: sub X4, X0
+bne *r3
+rts
+stop
+add #22, r3
+L126: jsr X18
+inc *r2
+not *r6
+L127: dec r7
+jsr L162
+L128: stop
+L129: .string "utsrkptfbvwokomiwtqtfq"
+red r0
+L130: cmp L72, #-154
+red *r5
+sub r2, X18
+not r5
+L131: .string "xbgqgothkektryllmo"
+jsr X14
+bne *r4
+red *r4
+L132: jmp *r7
+mov *r1, *r4
+cmp r2, L81
+L133: add L32, *r0
+stop
+prn #216
+stop
+red r2
+jsr L31
+; comment
+; comment
+dec X3
+jmp *r1
+jsr L258
+prn *r1
+sub *r2, *r3
+jsr *r1
+L134: rts
+stop
+cmp L100, *r6
+jsr X12
+rts
+
+inc *r7
+stop
+prn r7
+add r7, X11
+rts
+red X11
+rts
+
+inc X18
+stop
+L135: .string "xqbjamvbhj"
+clr *r6
+cmp *r2, r5
+jsr L199
+L136: rts
+lea L100, L191
+jmp *r5
+sub *r3, *r2
+L137: bne *r2
+rts
+jmp *r7
+L138: jmp L102
+rts
+cmp X14, X20
+L139: .string "ehvjehmhzwuyyuhlx"
+L140: cmp *r6, r7
+L141: sub *r2, L126
+L142: add r0, *r1
+clr L265
+L143: .data 765
+rts
+clr X24
+prn r7
+stop
+prn *r5
+red X22
+cmp *r7, X4
+mov X12, L167
+clr r7
+stop
+dec r0
+not *r3
+L144: lea L195, *r4
+stop
+bne X7
+L145: .data -164, 36, 463, -23, 57, -900
+bne *r6
+rts
+clr L139
+bne *r6
+sub r1, X15
+red *r0
+lea L260, *r5
+cmp X16, r7
+L146: dec r7
+L147: .data -307, 707, 858
+L148: .data -405, 122, 330, -66, 85, 797, -820
+mov #-43, X22
+cmp L246, r2
+sub *r7, *r7
+clr r5
+stop
+bne L180
+L149: prn L265
+red r3
+rts
+jsr *r3
+sub *r5, r1
+inc *r6
+bne L107
+not *r2
+jsr X16
+rts
+jmp *r3
+dec L261
+lea X2, *r3
+jmp L222
+inc *r0
+rts
+rts
+sub L26, L168
+add L57, r1
+L150: not *r6
+L151: rts
+L152: jmp *r3
+rts
+; comment
+add L235, L221
+stop
+jmp *r3
+inc r2
+add r7, X13
+dec r7
+L153: jmp X14
+add *r2, *r6
+inc *r7
+L154: not r0
+dec L114
+L155: bne *r1
+inc *r2
+prn L63
+L156: lea X2, X1
+L157: .string "aqwpzu"
+cmp *r3, L53
+inc *r3
+cmp L19, r4
+mov r4, r0
+L158: mov r6, *r3
+L159: dec L147
+L160: jsr *r3
+sub #45, *r1
+rts
+L161: not L26
+L162: cmp *r0, r6
+L163: clr L149
+
+L164: prn r4
+sub L52, r2
+cmp X19, #-10
+dec *r6
+L165: prn *r5
+prn L145
+not *r7
+not *r6
+prn *r2
+add *r7, *r0
+sub L253, L255
+not r1
+sub X23, *r5
+L166: stop
+L167: rts
+add #-136, r6
+dec r6
+red r1
+L168: .string "nujlbwcxhkaggeespqjytc"
+L169: red *r6
+clr *r1
+stop
+add L129, *r7
+jsr *r3
+red X5
+jsr *r5
+inc L19
+lea X11, X20
+jsr X13
+L170: .string "pfgtwroxtsjlowz"
+L171: lea L147, *r5
+L172: .string "jhqncjggaujnauehoiqsqtu"
+sub r5, r0
+add *r5, X15
+sub *r7, X10
+jsr *r5
+mov r4, *r1
+L173: .string "jgaclqroiaoggwsbw"
+cmp r0, X0
+bne *r0
+L174: .string "gxrrrqtjyrylfgmjr"
+dec X19
+clr *r6
+dec r1
+prn X19
+add r6, *r1
+red X11
+red r5
+dec L199
+
+bne X13
+lea L80, *r3
+mov *r7, *r3
+rts
+stop
+not X16
+not X18
+bne *r1
+inc r3
+L175: sub *r1, X4
+not r6
+mov L232, L214
+red *r0
+
+inc X20
+mov r2, r6
+lea L123, r7
+; comment
+jsr *r7
+L176: .string "e"
+lea L73, L218
+inc L11
+mov r6, L197
+L177: sub *r3, *r1
+bne *r2
+inc *r7
+L178: prn *r0
+mov L221, L84
+red X19
+red r0
+lea L251, X24
+red r6
+dec L187
+prn L164
+inc r4
+L179: .data 860, -42, -92, 626, -377, 797
+L180: .string "ibmifputffyf"
+L181: .data 922, -138
+mov *r7, *r2
+bne X19
+jsr L233
+L182: stop
+mov X7, r6
+red r6
+cmp L231, L231
+dec *r7
+lea X5, X13
+mov *r7, *r6
+cmp *r0, *r3
+L183: cmp *r4, #27
+clr L261
+jsr *r4
+not *r7
+red *r7
+L184: inc r0
+mov *r5, r2
+L185: jmp *r2
+cmp *r1, *r7
+L186: .string "uigsdya"
+; comment
+L187: .data -159
+
+jsr L31
+L188: add *r7, L260
+add L195, r4
+add #219, *r1
+not *r5
+rts
+L189: clr *r4
+L190: sub #192, r0
+inc r2
+L191: .string "seleoibgvnn"
+red *r6
+mov #-114, L63
+L192: lea L154, L117
+L193: stop
+jmp L246
+stop
+L194: rts
+clr L212
+lea X3, r4
+stop
+L195: .string "acyapnygsdf"
+mov X8, X6
+
+L196: .data 112, 80, -683, -882, -940, 383, 536
+cmp r1, X22
+L197: mov *r2, r6
+jmp *r0
+mov #145, L259
+L198: .string "pdpjgpcmwgsmnpo"
+L199: inc *r0
+jmp X24
+jsr L33
+; comment
+add r5, r3
+rts
+L200: dec L265
+mov r5, L145
+red L79
+bne L233
+L201: inc L260
+rts
+clr r6
+L202: .data 887, -584, -908, 480, -22, 882
+prn *r5
+clr L223
+L203: prn #90
+lea L104, r0
+L204: jmp *r3
+dec *r3
+dec X0
+sub #-160, X2
+; comment
+jmp L196
+add r6, *r6
+red L128
+; comment
+prn r4
+lea L63, L260
+add L104, L226
+L205: .string "dwygzpnqysbkfcydr"
+jmp L60
+sub *r3, *r0
+red X24
+L206: .string "ipybeqnojczdmqigyuc"
+clr *r6
+clr r2
+jmp X14
+jsr L84
+cmp X23, r0
+; comment
+dec L56
+L207: add #-186, X5
+add #171, r0
+dec L95
+bne L58
+L208: lea L159, *r2
+clr *r6
+L209: rts
+not r2
+L210: mov L100, r1
+L211: jmp L256
+L212: rts
+L213: cmp r0, *r4
+dec *r7
+jmp X10
+mov #26, X24
+sub *r5, X19
+stop
+not r2
+prn #-201
+not r6
+stop
+add r3, X11
+stop
+clr *r3
+lea X3, X8
+mov r0, r5
+inc L34
+inc *r6
+bne *r2
+bne *r0
+L214: clr *r3
+sub L216, *r0
+jsr L127
+lea X6, r4
+clr r7
+mov r0, *r1
+sub *r6, L128
+mov *r1, *r7
+
+sub *r2, r6
+dec r4
+L215: not X7
+cmp r5, L238
+L216: prn X0
+add #-115, X24
+L217: prn #148
+red L268
+L218: .string "edkh"
+L219: dec *r6
+L220: jsr *r7
+mov #-1, r1
+cmp L263, r3
+L221: .string "mmjtmzvhq"
+dec *r0
+jmp L212
+L222: bne X0
+red X5
+jmp L230
+mov L167, r1
+add X8, r7
+L223: dec *r4
+stop
+not r3
+mov #158, *r3
+prn *r0
+add X10, L58
+L224: inc r2
+prn #-101
+dec r1
+L225: stop
+mov L241, *r2
+cmp #30, *r0
+clr *r2
+lea X22, r0
+L226: .data 909, -218, -346, -479, 799
+dec r1
+dec L257
+L227: rts
+prn #-180
+L228: lea L268, *r6
+L229: dec L240
+L230: .data 790, 518, -768, 42, -309, -837, 567, 989
+L231: .string "biapjmlgdb"
+bne *r4
+L232: not r5
+inc r5
+L233: add #133, *r2
+; comment
+prn *r0
+prn r5
+rts
+dec *r1
+bne X9
+; comment
+L234: prn #108
+L235: .string "mrq"
+
+sub #-101, *r7
+bne L259
+cmp #-5, #6
+
+inc L260
+jmp X3
+; comment
+L236: .string "bkjpav"
+prn *r1
+L237: cmp #236, #225
+jsr L81
+L238: .string "hxzema"
+mov *r2, r1
+L239: clr *r4
+mov L272, r5
+mov *r1, r6
+L240: .string "nqptxqjnsxfddzxhc"
+; comment
+L241: sub #166, *r2
+jmp X11
+rts
+L242: sub L267, r7
+red X19
+add r4, r7
+; comment
+L243: not r6
+
+red *r3
+L244: .string "pknbs"
+not *r5
+L245: cmp r0, X14
+; comment
+red *r3
+L246: mov *r3, r7
+L247: mov *r7, L252
+cmp L111, L132
+bne L266
+add #180, X23
+lea X16, r4
+cmp L98, *r1
+mov *r4, *r7
+add r5, *r3
+sub r5, *r6
+inc *r7
+bne X18
+inc r1
+mov r5, r2
+jmp L258
+lea L254, *r3
+prn r5
+not r7
+L248: .string "ychtcgwxvzaczazquwh"
+add *r3, *r3
+L249: dec *r2
+clr r5
+L250: rts
+sub #231, L181
+L251: add *r6, L257
+not r2
+jsr *r6
+jmp *r5
+rts
+prn X0
+
+L252: .string "vfmtcpznyjyg"
+dec r7
+red *r5
+L253: .data -113, 964
+cmp *r5, #-143
+sub #101, *r0
+lea L270, L274
+rts
+inc X20
+jsr *r5
+lea X19, r4
+red r2
+L254: .data 600, -949, -91, -371, 125
+L255: .string "tdbqwsue"
+stop
+L256: sub X22, r2
+inc L272
+dec L270
+mov X20, *r3
+not r3
+
+add #-32, r0
+red *r0
+L257: cmp r3, *r3
+red *r6
+dec r7
+lea L275, r6
+L258: .string "tbak"
+jmp *r3
+red L262
+lea L82, r6
+L259: rts
+bne L267
+L260: dec *r0
+mov #-144, X17
+L261: jsr L263
+lea X3, r5
+inc *r0
+L262: sub L265, X5
+L263: sub *r3, *r3
+red *r6
+jsr *r7
+mov r0, *r5
+sub r7, r2
+rts
+mov #131, r0
+clr *r0
+jmp *r1
+L264: jsr *r2
+L265: inc r7
+bne L5
+L266: jmp L239
+L267: .data -555, -732, 159, 522, -378
+L268: jmp *r2
+add #-139, *r4
+L269: mov L159, L186
+L270: .data -583
+L271: sub L274, r6
+lea L272, L251
+stop
+stop
+inc *r6
+L272: add L273, r5
+bne *r6
+lea L129, r4
+jsr *r7
+L273: .data -170, -864
+dec *r2
+L274: stop
+rts
+clr r1
+L275: .string "j"
+inc r1
+stop
@@ -0,0 +1,1044 @@
+; Generated by genCorpus --seed 6
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+bne L42
+rts
+
+L0: jsr *r3
+jmp L22
+inc X12
+bne *r1
+dec r3
+not *r0
+L1: mov #72, *r3
+L2: not *r7
+bne *r6
+L3: .data -988, -660, -773, 875, 218, -79
+lea X17, *r4
+lea L150, *r5
+lea L36, r6
+L4: dec *r4
+L5: stop
+L6: .string "mdaqhuotkzyzuhxwnj"
+L7: inc *r7
+L8: .string "ucfqvruyunrsh"
+not L8
+lea L233, r6
+clr L74
+bne *r7
+lea L71, X20
+add *r6, r6
+lea X4, *r6
+red L140
+L9: bne L2
+cmp *r2, #-72
+cmp *r4, r2
+dec *r2
+prn r0
+clr L126
+rts
+jmp *r1
+L10: .data -230, -865, -185, -450, 259
+inc X7
+jsr *r1
+dec r3
+prn r1
+L11: .string "unbqmeupykocuoycprta"
+clr L8
+jsr *r6
+prn *r2
+clr *r5
+not r2
+clr L6
+L12: stop
+mov r5, r7
+prn r2
+stop
+mov *r0, r5
+jsr L73
+L13: .string "gwzghfdbilwcfttjmyzxdjzu"
+jmp *r5
+L14: add L2, r1
+cmp L1, *r4
+clr r6
+stop
+; comment
+lea L11, L251
+cmp r7, #175
+rts
+lea L4, *r0
+rts
+prn r7
+sub L209, X23
+; comment
+L15: .data -909, -238, 275
+jmp *r1
+clr *r4
+clr *r2
+dec r4
+bne X10
+L16: .string "mhcfzh"
+sub r5, r4
+L17: .data -303, -240
+mov r2, X8
+L18: .data -965, 899, -847, -753
+bne L15
+sub L113, X18
+L19: .data -197
+jmp L2
+L20: bne X9
+inc r4
+L21: .string "cryeuziuig"
+jsr *r6
+clr r4
+inc *r0
+jmp *r1
+L22: .data 836, -615, 616, 746
+clr r7
+cmp *r3, r6
+cmp #-206, *r2
+lea L193, r4
+not L12
+
+L23: .string "evctfrfwwsloaylnpmp"
+dec *r1
+bne X15
+stop
+add *r7, r7
+not *r5
+L24: lea L1, r3
+
+L25: .string "mssbgmbexe"
+sub *r7, r1
+lea L20, *r5
+prn L211
+mov *r5, L172
+red *r2
+not *r1
+rts
+mov *r0, X15
+mov L16, *r1
+; comment
+stop
+L26: stop
+cmp *r0, *r0
+L27: lea X22, r2
+add #-112, L6
+red L25
+; comment
+stop
+L28: .string "gjd"
+jmp *r1
+inc *r6
+bne *r1
+not r5
+dec X13
+L29: cmp *r5, r2
+jsr X2
+lea L22, L228
+prn #-251
+jsr *r1
+sub r0, *r4
+L30: stop
+L31: jmp X21
+; comment
+prn *r0
+L32: .string "vgxpplvhzjecvmkbkvnqptc"
+L33: .string "qioqosxcdnqglq"
+sub #-52, L262
+L34: prn L12
+mov #52, X5
+prn #-20
+jmp X2
+dec L98
+L35: cmp X24, r2
+L36: .string "ykfbswsaegayivjmqq"
+L37: .string "xxpdbfcmakplmc"
+rts
+mov L21, L2
+L38: .string "eswntitxhyiohbea"
+stop
+rts
+rts
+dec L101
+add *r2, r7
+dec r6
+L39: mov r7, *r7
+bne L24
+cmp r0, r0
+L40: .data -105, 606, -397, -913
+L41: rts
+inc *r0
+cmp X20, r6
+L42: .string "rnzjdwmmxemgoimirjkxs"
+L43: .data -324, -430, 895, -68, -631, 710, 637
+L44: .data 723, -285, 505, -144, -643
+bne L181
+clr r2
+L45: .data 291, 199, -86, -755, -449, -536, -507
+dec r4
+rts
+lea X1, X10
+L46: mov r2, r3
+stop
+prn X14
+add *r4, *r5
+stop
+red L31
+prn *r0
+rts
+add L226, L239
+jmp *r2
+cmp #163, r3
+L47: .data -614, 917, -616, 105, 955
+red *r6
+L48: red L153
+bne L148
+not L109
+; comment
+rts
+L49: jmp *r6
+rts
+sub *r0, r1
+; comment
+lea X18, L46
+L50: .string "jnxzjwvy"
+L51: inc *r6
+L52: red r3
+jsr *r2
+sub L34, *r7
+jmp *r7
+L53: .data -909, 489, 658, 168, 677
+L54: red r5
+not *r3
+L55: add *r4, X7
+prn r1
+clr L46
+clr r3
+not X23
+jsr X10
+prn L22
+L56: .string "dbma"
+jsr X22
+clr r1
+L57: prn *r5
+lea L18, L119
+clr L188
+; comment
+jsr *r6
+clr X19
+dec r3
+stop
+cmp r5, #215
+dec L188
+L58: not *r5
+clr r4
+; comment
+L59: .data 778, -768, 906, -424, 333
+bne L33
+prn *r4
+stop
+jmp *r4
+L60: clr X11
+sub r0, X13
+clr r3
+cmp #-237, r0
+not *r3
+L61: cmp X14, L13
+clr L41
+L62: red X9
+prn #-55
+jmp L177
+L63: lea X6, L71
+cmp *r7, X8
+L64: rts
+prn X20
+stop
+dec L65
+bne *r5
+inc L255
+L65: lea X11, *r0
+stop
+L66: stop
+; comment
+sub #81, r0
+mov *r2, *r0
+prn *r2
+rts
+stop
+prn #-36
+lea L179, X5
+clr L24
+clr r4
+L67: stop
+jsr *r1
+
+L68: clr r7
+mov X4, r0
+mov r2, r6
+L69: .string "bklxj"
+add r6, L33
+lea L189, r1
+L70: bne L19
+L71: add #-38, r4
+jsr *r0
+L72: not r5
+lea L42, L16
+add *r4, r1
+jsr *r7
+red *r5
+mov r6, *r0
+inc L151
+
+mov r4, *r2
+clr L217
+L73: jmp *r3
+jsr *r1
+clr r7
+inc *r0
+inc r3
+L74: dec X10
+jsr L230
+L75: rts
+jsr *r7
+dec *r6
+jsr X2
+not *r3
+mov r1, r5
+; comment
+inc *r7
+; comment
+stop
+stop
+L76: mov r3, L158
+L77: .string "ysztwulmgivguf"
+dec L256
+lea L120, r1
+L78: jmp *r4
+not L102
+L79: .string "mekjekfidggieqc"
+clr *r4
+bne *r0
+inc r2
+sub L134, r7
+jsr X17
+sub *r3, *r3
+dec *r2
+lea X10, X24
+stop
+L80: .string "ywyhdekbohin"
+jmp L196
+bne X6
+lea X6, L49
+jmp *r6
+prn #-152
+jsr L184
+L81: not X11
+jsr L55
+add #-124, *r3
+cmp #-122, r1
+rts
+L82: cmp X16, r4
+L83: lea X1, r5
+sub X18, *r6
+bne X13
+; comment
+sub r2, *r2
+L84: .string "vywohahviovlcajoqlppt"
+lea X0, *r0
+clr *r3
+cmp L72, #16
+prn X7
+not r3
+sub X1, r0
+clr r2
+L85: jsr *r2
+clr r4
+red r1
+L86: prn #-182
+sub L50, *r6
+dec L107
+L87: jmp *r5
+mov #221, *r6
+bne X1
+L88: red *r6
+add X4, X21
+L89: jmp *r1
+L90: inc *r6
+
+
+L91: sub *r3, r1
+lea X13, *r3
+L92: sub #18, *r1
+lea X3, L202
+mov *r0, *r7
+L93: bne X23
+mov *r1, L86
+prn *r0
+L94: sub L23, X13
+jsr *r2
+inc *r4
+red *r6
+L95: add #180, r6
+not r5
+L96: .data 16
+inc X24
+mov #-119, *r2
+cmp L111, *r2
+prn L36
+L97: add #117, *r2
+prn *r3
+L98: inc *r7
+L99: mov r6, *r7
+stop
+dec L15
+; comment
+not L136
+lea L124, *r6
+rts
+lea L32, L202
+inc r7
+add X8, X8
+rts
+mov *r3, r0
+jmp L17
+red r4
+bne L80
+L100: prn *r6
+rts
+; comment
+add r1, r2
+red *r2
+clr *r7
+L101: not r3
+not *r6
+dec r7
+red r5
+bne *r5
+inc *r7
+jmp L84
+not X7
+
+inc *r6
+L102: rts
+jmp X8
+L103: jmp L123
+inc *r3
+mov #-5, r1
+prn r0
+prn r0
+clr *r4
+; comment
+L104: .string "glrfpwddpbl"
+dec *r3
+L105: inc L43
+red r6
+cmp *r3, r3
+inc r1
+; comment
+L106: .string "njyegcpqlodfoknzjcaldx"
+cmp *r7, *r0
+dec X3
+mov L157, *r0
+clr L48
+clr r1
+jsr L141
+L107: prn *r2
+L108: jmp X11
+lea X8, *r3
+jsr X9
+bne X5
+add X11, *r1
+sub r7, *r3
+L109: dec r7
+L110: clr *r7
+stop
+red *r3
+L111: clr L261
+L112: .string "xxcwtozzfapw"
+cmp *r5, *r7
+; comment
+L113: .data 362, -849, 685, -362, 787, -131
+lea L131, L83
+L114: .data 729, 777, -780
+cmp *r5, r7
+rts
+prn #137
+dec r6
+bne X16
+
+; comment
+bne *r5
+L115: .string "aqyizwoomabvduvmgfyjxhu"
+L116: .data -738, 641, 864, 617, -885, -713, -926, 831
+lea X14, *r0
+L117: .data 650, -474, 350, -462, 824, -606, 397
+dec *r3
+L118: sub #120, *r6
+not L67
+mov X15, X11
+dec *r1
+mov r5, r2
+not *r4
+lea X19, *r7
+add #-210, r7
+jmp L226
+L119: red L197
+not L214
+L120: .data -128
+red *r5
+sub #-124, *r3
+dec r7
+prn *r5
+jsr L112
+jsr L57
+lea L142, L22
+L121: mov r2, r7
+add *r5, r6
+clr X11
+add #25, L96
+bne *r3
+inc L101
+rts
+L122: red *r1
+not r5
+L123: inc X2
+prn *r4
+L124: add #217, r2
+L125: bne X6
+L126: .data 682, -818, 35, -794
+cmp #-139, L28
+mov r3, *r5
+; comment
+red r6
+stop
+jmp *r6
+prn r5
+L127: rts
+stop
+add *r7, *r4
+rts
+jsr *r1
+inc r0
+L128: stop
+stop
+dec X1
+L129: mov L53, X15
+jsr X2
+L130: dec r7
+mov r6, *r7
+L131: jmp *r5
+cmp #161, r0
+L132: .string "xdhrdewiv"
+L133: red L60
+inc r4
+stop
+L134: red L119
+clr r7
+jmp *r4
+L135: not L43
+clr r7
+prn r3
+L136: rts
+cmp *r1, X2
+L137: prn *r2
+mov *r3, *r4
+sub #-81, *r4
+sub X5, L142
+rts
+L138: cmp #20, r2
+mov L141, *r2
+stop
+bne *r5
+L139: add X7, L201
+L140: .data 920, -66
+L141: jsr L60
+L142: bne *r4
+mov #75, L167
+red r3
+sub r5, r6
+dec r3
+L143: inc *r3
+L144: bne *r7
+lea X9, L217
+prn #241
+clr r6
+L145: bne L250
+jsr *r1
+add L231, L6
+prn #-207
+stop
+add #-236, *r3
+stop
+L146: cmp #29, r0
+jsr L258
+bne X1
+stop
+L147: prn *r2
+cmp *r3, *r0
+; comment
+stop
+jmp *r2
+clr r0
+lea X8, L67
+L148: lea L178, r0
+jmp X21
+clr L223
+jsr *r7
+clr r2
+L149: dec *r0
+stop
+L150: mov r5, r5
+
+bne L235
+L151: add #-13, L76
+cmp r6, r1
+
+add *r4, r0
+lea L192, X7
+clr r3
+rts
+add #-17, *r2
+dec L9
+rts
+bne *r4
+mov r5, r1
+dec L183
+jsr L46
+L152: bne *r1
+L153: .string "pskkzcejmmoxatp"
+prn *r2
+prn X16
+red L152
+inc *r7
+jsr L51
+dec *r3
+L154: prn r5
+jmp *r2
+cmp *r1, *r6
+red *r1
+red *r2
+L155: clr r4
+mov r3, r3
+L156: .string "ocftvipmdtpitwsaak"
+inc L39
+bne L71
+prn r4
+red *r5
+inc r4
+dec X22
+L157: clr X1
+L158: .data 544, 700
+bne L131
+mov r7, L223
+rts
+L159: inc r5
+L160: stop
+L161: bne *r3
+rts
+stop
+; comment
+L162: .string "hqeu"
+jsr *r0
+; comment
+not *r6
+lea L205, *r1
+sub *r0, r5
+L163: bne *r1
+L164: inc L106
+L165: clr *r1
+jmp *r0
+lea X23, *r5
+clr *r3
+L166: prn *r0
+; comment
+prn r2
+lea L193, *r0
+L167: .data 215
+dec *r1
+bne *r0
+bne *r3
+L168: not *r0
+dec r0
+L169: add L198, r7
+clr X17
+cmp r7, *r0
+prn *r5
+L170: dec *r0
+L171: red L51
+rts
+dec r0
+red *r2
+jmp *r0
+mov #-5, *r0
+inc r5
+prn #-170
+rts
+L172: .data 786, 531, -303
+not r0
+L173: .data -514, 232, -193, -318, -654, 286, 442, -862
+clr X24
+L174: mov *r1, X6
+L175: dec r3
+prn L33
+L176: not r0
+
+prn #-103
+clr X19
+rts
+jsr *r1
+clr L205
+L177: .data 234, 0, -393, 434, 418, 58
+cmp #122, L171
+mov X22, *r6
+; comment
+red r1
+dec *r7
+lea L50, r2
+L178: .string "zsoahcnywqsl"
+jmp X8
+sub X0, L235
+not *r1
+red *r0
+L179: mov X7, L207
+L180: sub r5, *r3
+L181: sub r7, *r2
+L182: .data 767, -140, 328, -480, 876, 730, 465, 403
+L183: not *r6
+L184: bne *r4
+L185: stop
+inc X10
+mov L111, r3
+prn *r7
+prn r1
+mov #38, *r1
+L186: .data 128, 394, 625
+not r1
+L187: .data -418, -445, 263
+L188: .string "ilqfkzlpqspyaln"
+cmp #181, #-176
+L189: inc *r0
+L190: .data 285, -36, -423, -131, 444, 863
+sub r5, X8
+L191: mov r0, X17
+sub r2, X16
+
+jmp L251
+L192: add r5, r5
+not L215
+sub *r1, L16
+bne X14
+L193: .string "wtuujitahwuubzpwyqfynfr"
+L194: prn r0
+bne *r5
+stop
+clr L197
+dec *r2
+L195: .data 550, -132, -236, 194, -809
+L196: .string "qgcpug"
+inc L218
+cmp *r0, #133
+L197: jsr X4
+stop
+clr L59
+L198: not *r6
+lea L255, L261
+stop
+lea X7, *r0
+jmp *r4
+red *r6
+add r4, L128
+inc *r1
+mov r3, *r5
+L199: not X16
+L200: mov #-73, r5
+stop
+L201: stop
+stop
+not r3
+L202: .string "iuqcqvmqawgyulkirlz"
+jmp *r6
+jsr *r7
+bne L203
+L203: add L68, X10
+clr X18
+jsr L125
+mov #-168, L262
+
+mov *r3, r0
+; comment
+bne L106
+rts
+jsr L107
+bne L242
+L204: .string "idmvqdxednrgpj"
+L205: jsr *r6
+L206: jsr L82
+L207: bne *r5
+dec r2
+add *r0, r7
+inc *r6
+bne *r6
+jmp *r7
+lea L224, r3
+add L245, X18
+L208: .data -67, -296
+jsr *r0
+jsr X19
+dec X3
+clr L230
+rts
+L209: clr *r2
+L210: lea X10, L223
+L211: rts
+L212: lea X5, L195
+L213: red X6
+L214: clr r2
+L215: inc r2
+prn *r6
+cmp X15, L246
+not L243
+inc *r7
+not r4
+stop
+bne *r7
+
+stop
+bne *r4
+L216: cmp r3, r4
+jmp L108
+L217: stop
+
+jmp L247
+L218: jmp *r7
+bne *r6
+L219: jsr *r3
+jsr *r0
+jmp *r0
+red X17
+stop
+mov L240, r1
+L220: red r6
+lea L205, *r1
+prn r7
+
+inc r5
+
+cmp *r4, r4
+L221: .string "ymnsssmyl"
+cmp #-197, *r4
+L222: red *r4
+add #-19, L237
+mov L169, X0
+bne X6
+L223: add r0, *r5
+inc r7
+rts
+add r3, *r4
+mov *r4, r5
+dec X2
+L224: not X17
+L225: bne L243
+inc *r4
+dec *r7
+L226: .string "cfigbspe"
+not *r3
+sub L239, *r1
+cmp r3, *r3
+not r7
+add *r6, X8
+mov *r5, *r6
+lea X23, r7
+red X7
+L227: dec r6
+lea L232, *r1
+bne L237
+sub #-37, L216
+rts
+sub r2, r4
+dec X3
+L228: stop
+jmp *r2
+L229: prn r5
+inc X23
+L230: jsr *r4
+cmp r6, X10
+dec L242
+jsr *r5
+bne *r5
+dec *r2
+not L166
+stop
+cmp *r5, X13
+L231: .data -558, -910
+L232: .data -422, 496, 449, -647, 920, -457, -92, 684
+rts
+prn r3
+lea X23, r7
+L233: inc X4
+clr L54
+clr *r4
+add L235, L83
+dec X17
+L234: bne *r3
+rts
+L235: red L240
+lea L260, *r7
+inc X22
+
+L236: add #-120, r6
+mov r2, r3
+L237: .string "sv"
+rts
+rts
+jmp *r1
+bne *r5
+prn #115
+cmp #-158, #-117
+dec X10
+cmp #-187, #-143
+red X14
+L238: clr r4
+L239: .string "gilgadgdjhdumflzlqnlsw"
+L240: not L83
+sub *r0, L183
+clr X14
+stop
+bne L249
+sub #171, X2
+jsr X16
+red *r2
+not r2
+L241: .string "dgwkckahxw"
+clr X2
+L242: .string "immszfjqjpyqzesbvlh"
+jmp *r1
+jsr X2
+jsr L258
+clr *r7
+jsr *r7
+sub #185, *r2
+sub #213, L218
+jsr L250
+prn #38
+inc *r1
+bne *r4
+red X16
+stop
+clr L108
+jmp L249
+L243: red r5
+sub r5, *r6
+mov r3, X12
+L244: jmp *r7
+bne *r4
+not L249
+stop
+L245: add *r7, *r1
+L246: .string "uvswohzthndoouogbkqz"
+dec *r6
+bne L248
+red *r1
+L247: .data 469, -257
+jsr L98
+prn r4
+L248: .data -784, -163, -276
+not r6
+L249: .string "oqewifegkhcbjyiqjdl"
+rts
+cmp r0, #-1
+L250: clr r1
+L251: mov L257, L253
+L252: .string "oxiysuwgajjsqtlmik"
+add #136, *r7
+bne *r7
+clr r0
+cmp L222, #228
+prn r6
+lea X18, r4
+L253: .data 249, -187, -672
+L254: .data 369, 740, -349, -121, -204, 240, -70, 856
+bne X24
+add *r0, r3
+sub r5, L159
+red r3
+cmp r7, *r4
+mov r4, X3
+stop
+bne *r6
+jsr L70
+jsr X18
+jmp *r3
+dec *r5
+stop
+L255: jsr *r5
+L256: .string "bh"
+not *r7
+L257: dec r7
+mov L54, L258
+jsr *r3
+add *r4, X15
+red r6
+red r5
+; comment
+L258: .data 241, -690, 979, 676, -457
+not L50
+; comment
+mov #-175, X19
+jmp *r2
+
+inc L261
+L259: rts
+; comment
+bne *r6
+
+L260: .data 496, 912, -620, 433
+L261: .data 527, -938, -363, 293, 76
+red r6
+jsr *r0
+L262: .data -170, -267
+
+jsr X24
+lea L195, r3
+mov r6, r7
+stop
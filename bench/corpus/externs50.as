@@ -0,0 +1,1046 @@
+; Generated by genCorpus --seed 51
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+L0: dec r2
+L1: mov *r0, r3
+L2: .data 823, -342, 547, 418, 338, -69
+clr *r0
+add *r5, r4
+L3: .string "ufjvjgqjmfqolxh"
+rts
+lea L0, *r2
+lea L3, r2
+sub L0, r2
+bne *r4
+jmp *r1
+bne X24
+not X12
+stop
+jmp *r6
+
+; comment
+cmp #-192, *r7
+; comment
+mov L2, *r2
+clr L142
+mov r3, X3
+red L2
+not *r1
+L4: cmp X17, *r0
+bne *r6
+sub r0, r5
+lea X12, r7
+inc r6
+L5: sub r2, r4
+L6: .data 509
+L7: .string "wdlnygaayh"
+L8: bne L186
+bne *r4
+L9: .string "yhbhkjxffkyiszezhiffbp"
+jsr *r0
+
+clr r4
+red r2
+dec L37
+stop
+stop
+jmp X1
+dec r2
+L10: lea X14, X8
+cmp X21, r0
+stop
+L11: sub r6, L21
+cmp *r0, #-151
+L12: bne L150
+jmp *r4
+jmp X11
+jmp X3
+prn r6
+cmp r4, L163
+dec *r5
+mov L34, *r5
+L13: bne *r4
+clr *r0
+L14: .string "ytwsewvcowix"
+sub #67, *r2
+
+L15: .string "cawafzzaetgkie"
+clr L15
+L16: .string "tcdlwsliqf"
+jsr X15
+L17: .string "uvqxnkd"
+jsr *r1
+inc *r0
+L18: not *r7
+add *r0, *r3
+L19: cmp *r5, r0
+inc X12
+rts
+red r7
+L20: red *r4
+cmp *r7, #-216
+clr L53
+L21: sub #231, r3
+inc L17
+lea X14, L204
+lea L10, *r3
+L22: cmp #35, #76
+add L5, *r5
+clr X12
+prn r1
+inc *r4
+add *r3, r3
+prn L108
+jmp L1
+L23: stop
+L24: .data 539, -967, -907, -946, 925, -242
+L25: stop
+L26: .data -130, -779, -540, 300
+L27: add X0, L42
+sub #-217, r0
+inc *r2
+L28: lea X11, *r1
+L29: sub *r4, *r1
+rts
+L30: .data 67, -497, 36, -609, 864, 402, 23
+red r0
+dec *r3
+L31: add #185, r4
+rts
+L32: lea L237, L120
+sub L21, r3
+clr X24
+jmp X0
+stop
+L33: bne L23
+inc L210
+rts
+prn L197
+L34: .string "reimfvzrs"
+lea L151, L82
+L35: rts
+rts
+sub L130, *r7
+L36: inc r0
+clr r5
+; comment
+add L274, r6
+lea L0, r0
+cmp *r6, *r4
+lea L167, *r2
+L37: stop
+L38: .string "qi"
+mov L53, L116
+L39: .string "igdwoyugvqgvrlkgwzuh"
+sub *r3, X0
+dec r3
+bne X18
+red *r3
+L40: bne *r6
+jsr *r3
+lea X7, L140
+stop
+red r5
+inc *r1
+L41: .string "zzeknupadwzqxcbqflskxul"
+; comment
+L42: jsr *r5
+sub L34, *r3
+mov *r0, *r6
+red *r7
+L43: jsr *r6
+L44: add X24, *r4
+dec *r3
+jsr *r0
+jmp *r2
+mov X11, *r6
+inc *r7
+stop
+inc r1
+L45: cmp r1, #1
+jsr L13
+stop
+L46: .data -980, -475
+lea L19, L183
+prn #91
+sub *r0, r6
+; comment
+stop
+L47: .data 891, -206, 75, -24, 843, 110, 121, -240
+mov *r5, r7
+bne *r1
+L48: rts
+L49: dec r3
+lea L22, r7
+
+prn #224
+bne X17
+L50: rts
+sub #-248, L2
+L51: rts
+
+L52: .data -800, -744, 924, 964, 34, 162
+jsr L34
+bne *r3
+L53: inc *r1
+dec r7
+; comment
+mov X19, *r2
+L54: mov *r2, r5
+add #197, *r3
+add r4, *r7
+red *r6
+jsr L198
+L55: inc r1
+not *r4
+L56: not *r7
+add *r0, r5
+add r7, L33
+L57: jmp *r4
+cmp #-22, #77
+not *r1
+L58: rts
+bne L176
+L59: sub *r6, r5
+
+L60: red X19
+rts
+jmp L3
+L61: .string "wuyl"
+L62: not *r4
+add r0, *r2
+red r7
+rts
+rts
+sub r2, *r6
+jmp X18
+mov L26, *r5
+clr r5
+L63: .string "qlznndtlrfjgyfpsfsoc"
+sub #197, *r2
+red r2
+inc L60
+L64: rts
+dec r6
+L65: .data 206, -987, -227, 987, 512, 195, -595
+L66: .string "kvhlbdgopnryslvi"
+
+dec X11
+L67: add L183, X19
+L68: mov *r5, L269
+jsr L148
+L69: red *r7
+inc X21
+
+inc *r7
+add #-30, r0
+clr r3
+L70: lea X2, X7
+sub L235, r7
+rts
+stop
+inc r0
+L71: clr L156
+sub X9, *r3
+sub L21, L34
+dec *r7
+prn *r0
+L72: jmp *r2
+L73: .string "hjjqtxhcgf"
+L74: mov #-173, r4
+; comment
+cmp r0, #-246
+L75: .data -648
+not r6
+red r3
+L76: jsr X20
+red r4
+bne *r1
+prn L30
+inc *r7
+L77: lea X22, r7
+L78: .string "clp"
+clr *r7
+L79: dec L31
+L80: .data -329, -126, 819, -199, -640, -12, 344, -734
+cmp #-91, *r1
+L81: mov #180, L0
+jmp L273
+clr *r3
+rts
+prn #254
+; comment
+mov L231, r6
+rts
+L82: sub r5, r4
+prn #102
+bne *r2
+sub #254, r4
+L83: inc L36
+prn X15
+stop
+L84: mov X4, r0
+L85: red r1
+jmp *r2
+sub #-100, *r4
+L86: rts
+prn *r4
+red L31
+inc *r4
+not *r2
+rts
+L87: rts
+L88: dec L277
+rts
+L89: .data 595, 67, -120, 408
+L90: prn r4
+sub *r6, *r7
+; comment
+cmp X10, #159
+mov #-214, L286
+inc L272
+L91: sub r2, r2
+L92: .data 194, -905, -911
+red L12
+mov #202, r1
+jmp L190
+bne L27
+L93: clr L10
+jsr L47
+add *r7, *r3
+clr L184
+red r3
+stop
+red L5
+L94: bne X7
+add L28, L90
+L95: stop
+lea L56, *r2
+sub r5, *r1
+inc r0
+mov L161, L111
+rts
+inc *r7
+rts
+cmp #116, #-39
+L96: .string "ijvieqyvygokwunc"
+mov r0, r5
+jsr L58
+; comment
+L97: .data 737, -730, -241, -337
+jsr *r6
+lea L94, L76
+not *r6
+; comment
+L98: add *r0, L66
+cmp r2, r4
+L99: dec *r0
+cmp *r5, X18
+prn r7
+inc r5
+L100: .data 93, 169
+; comment
+inc r7
+lea X24, r6
+prn r3
+L101: cmp *r7, r3
+add #-253, *r3
+sub *r5, *r0
+L102: lea L211, r7
+L103: .data -188, 70, 75, 829
+stop
+cmp L205, *r2
+
+jsr *r1
+cmp r5, #23
+red r6
+sub r7, *r1
+stop
+clr r4
+L104: .data 966, -518, -92, -575, -17
+bne *r0
+add #95, X11
+mov r4, r2
+not r2
+jmp *r1
+prn X2
+inc *r7
+clr L188
+L105: dec L37
+add r7, r3
+L106: lea L30, *r7
+add L175, r0
+L107: .string "iqgaigmqwb"
+mov *r5, r0
+lea L244, r7
+stop
+mov *r0, L77
+dec *r6
+not X10
+lea X8, r3
+cmp #-107, L288
+L108: .string "ekssudtplsxtzfwyllwyltsz"
+L109: .data -693
+L110: .string "jkninxaxcgmzmnbrazij"
+L111: lea L19, L75
+cmp L30, #-174
+add r0, L284
+lea L155, X20
+L112: bne X4
+not *r5
+L113: bne X19
+rts
+red *r7
+clr r5
+lea X15, *r5
+L114: .data -525
+L115: not r3
+sub #-50, r0
+not r5
+cmp r1, r2
+not X4
+inc *r4
+jmp X7
+clr r4
+cmp r5, *r5
+bne X7
+L116: .data -677
+add #-187, r1
+red X5
+L117: lea X2, L156
+L118: jmp *r7
+rts
+L119: .string "celolxn"
+L120: red *r0
+add r1, L100
+bne *r5
+cmp r7, r1
+rts
+add L86, *r4
+clr X17
+jmp X21
+inc *r6
+jmp L24
+clr *r0
+rts
+jmp *r1
+dec L196
+L121: stop
+jmp *r1
+rts
+L122: .data -298, -74, 838, 361, -348, -197
+L123: red *r0
+L124: bne L250
+jsr *r4
+add *r0, L50
+not *r4
+jsr *r1
+L125: lea L132, r6
+lea X24, *r4
+bne *r1
+L126: cmp L98, r2
+jmp L188
+rts
+red *r4
+L127: .string "laashi"
+
+L128: .string "csvntoergjgfiy"
+sub L123, *r4
+clr r5
+sub r3, L191
+jmp *r7
+bne *r1
+jsr *r3
+red r2
+L129: clr *r0
+L130: red *r6
+stop
+L131: add r4, r5
+sub *r7, L157
+dec X5
+sub #30, r4
+rts
+inc *r1
+red L5
+lea L177, *r2
+rts
+clr L89
+jmp *r4
+jsr L243
+mov L288, *r7
+clr L18
+not X9
+mov #-112, X17
+red *r1
+L132: dec r4
+clr r6
+cmp r1, #248
+L133: jsr X19
+lea L110, L230
+bne *r3
+jmp L219
+bne L181
+cmp r2, L49
+inc *r7
+L134: .string "evfrfrzacbf"
+L135: cmp r1, *r7
+dec r1
+L136: .string "vaqugjomqqwulycvxdb"
+L137: rts
+mov r5, X11
+L138: prn L170
+L139: mov L76, *r4
+not r2
+rts
+inc *r3
+L140: .data -859, 645, -719, 687, -159, -233
+clr *r1
+L141: rts
+sub #-223, *r3
+clr r0
+jmp *r1
+inc r3
+L142: clr L72
+bne *r7
+rts
+not r4
+sub *r3, r0
+cmp X11, #-136
+jsr *r3
+jmp *r0
+inc *r7
+rts
+
+prn r4
+not r1
+inc *r6
+inc X19
+jsr *r1
+dec r1
+bne *r5
+; comment
+add L260, L208
+L143: cmp *r0, #-74
+L144: .string "zeuctffqjsxqpaycwqmmm"
+dec L183
+clr *r6
+L145: rts
+L146: .string "slqqllp"
+L147: lea L268, r7
+L148: rts
+; comment
+dec r5
+L149: .data -283, 321, 961, -130, 319, 64, 795, -809
+inc L23
+stop
+stop
+prn r4
+L150: bne *r3
+; comment
+cmp *r4, #151
+L151: .string "juffkzncvto"
+red r3
+
+L152: rts
+dec r5
+not L122
+L153: not X15
+L154: bne L49
+cmp r0, r1
+L155: .data 546, 561, -310, 428, -681, -592, 613, 332
+L156: stop
+add L215, L158
+dec r2
+L157: jmp X20
+L158: jmp *r2
+add #-195, *r4
+dec L154
+L159: .string "v"
+L160: .data 101, 226, 252, 16, 833, 406
+L161: add #133, *r5
+L162: cmp #-123, L154
+
+red *r1
+stop
+jsr L246
+clr r7
+lea L168, *r0
+L163: red L172
+jmp X24
+L164: .data -287, -733, 751
+red X8
+; comment
+L165: sub #49, r7
+L166: add #165, X20
+clr r7
+inc L202
+dec L157
+L167: rts
+L168: mov L193, L258
+rts
+dec r6
+clr X13
+sub *r1, *r5
+add *r3, r7
+L169: .string "cqzjzxxbtsa"
+L170: red *r1
+not *r3
+bne *r3
+bne *r1
+mov L174, r5
+not *r4
+rts
+; comment
+rts
+L171: jmp X9
+stop
+L172: jsr *r3
+rts
+jmp L270
+rts
+lea L254, r7
+L173: lea L96, L168
+L174: red r7
+jmp *r6
+mov r0, r6
+rts
+prn #-217
+lea X24, r3
+not r4
+L175: cmp L58, #218
+inc *r2
+L176: jmp *r0
+L177: red r0
+cmp #93, *r1
+; comment
+L178: .data -304, 674, -838, 774, -126, -384
+mov X10, r3
+L179: .string "tdxuxaiokpnqsuawqs"
+red r6
+clr *r2
+jmp L78
+bne X16
+; comment
+bne L181
+stop
+inc *r0
+clr *r0
+add L219, *r2
+red r2
+L180: .string "puobdqnhvzsbc"
+L181: sub #0, r0
+L182: add #-77, *r2
+rts
+L183: .string "yuoxmldzolahwisnd"
+jmp *r6
+L184: add #164, L261
+prn L246
+jsr L58
+mov #-21, *r1
+rts
+add #-55, r4
+red *r1
+sub #239, *r3
+dec L252
+add #-4, *r6
+stop
+clr *r4
+not *r0
+inc X16
+
+cmp *r6, X8
+L185: lea X8, r3
+lea L69, *r3
+clr r3
+lea X20, *r2
+jmp X13
+bne L241
+cmp r3, *r4
+clr *r4
+
+sub *r5, *r6
+inc *r4
+L186: .string "ktvx"
+add L216, L256
+L187: .data -833, 800, -714, -271, 381, 275, 767
+rts
+cmp X3, L234
+mov r0, *r1
+prn L235
+cmp r1, r2
+lea X19, *r3
+L188: clr X20
+lea L122, *r2
+rts
+stop
+L189: .data 735, -47, -147, -41, 203, -603, 933
+not *r1
+L190: lea X3, L50
+jmp *r2
+L191: lea X21, *r4
+bne X4
+L192: .string "glllzwwej"
+L193: not *r4
+L194: clr *r2
+L195: .data 142, 256
+lea L180, *r2
+L196: red X3
+bne L127
+jmp L7
+mov *r7, *r2
+cmp #-30, #-162
+mov X3, r3
+cmp r7, *r4
+cmp r0, *r6
+clr r3
+; comment
+L197: inc r0
+cmp #-230, #2
+L198: .string "fygyufnjs"
+stop
+L199: .string "eevnyxfsx"
+mov L204, L255
+stop
+cmp #14, *r3
+jmp X11
+bne X3
+L200: .data -199, -596, 689, -706, 459, 55, -216
+L201: not X2
+mov *r7, *r6
+L202: cmp r4, r3
+mov r0, X19
+L203: .data -319, 627, -61, 678, -837, -126, 936, 689
+red *r0
+L204: .string "jqmlgefnu"
+L205: jmp *r1
+cmp L256, r2
+lea X14, *r4
+lea L22, r1
+L206: jmp *r2
+add #4, r1
+L207: .data -201, 443, -969, -188, -945, 907, 120, 363
+L208: .data -413, -887
+mov r2, r6
+L209: prn r6
+L210: add L95, L267
+L211: cmp *r6, #-4
+red X14
+sub r6, *r1
+; comment
+add *r4, r6
+red *r0
+L212: prn *r1
+red *r7
+jmp *r6
+L213: inc *r3
+bne L263
+bne L274
+jsr *r4
+jmp X5
+mov #148, r0
+; comment
+cmp *r7, r1
+bne L147
+jsr L190
+cmp r2, r1
+L214: add L19, *r7
+clr r5
+clr r0
+dec r5
+clr *r2
+cmp *r0, #47
+L215: .data 992, -574, 512
+L216: jmp *r0
+bne L270
+cmp #-93, #12
+L217: .data -238, -154, 554, 890, -903, -222, 959, -325
+stop
+L218: bne *r6
+L219: lea L251, r3
+jmp *r0
+jsr *r7
+L220: prn r6
+L221: not L20
+rts
+L222: .string "dxmp"
+L223: mov #82, *r0
+L224: .data -345, -188, -490, 846, -58, -112, -319
+inc X8
+L225: .string "vzkjcm"
+L226: .string "tjaswaggwmwnngjlisnvnr"
+add #255, r1
+sub L276, L184
+stop
+red r4
+L227: bne X3
+stop
+L228: add X17, *r3
+jsr *r5
+; comment
+clr *r5
+bne X20
+inc X11
+lea L199, *r6
+
+cmp *r1, *r3
+L229: sub *r0, *r6
+jmp X23
+red *r1
+cmp r5, L182
+sub r4, L6
+clr X21
+not L261
+L230: .string "thrwhrk"
+L231: bne *r3
+jsr L266
+L232: not *r2
+L233: dec r5
+L234: sub *r7, *r4
+bne X3
+L235: .data 252, 668, -471, -537, 774, -546, -874
+jmp *r7
+not X6
+jsr X20
+cmp r3, *r4
+dec *r7
+L236: red r0
+L237: .data -162, 412, 653
+
+L238: stop
+inc r6
+jsr L284
+cmp X9, r0
+add L240, *r6
+L239: .data 322, 328, 578
+L240: jmp X19
+L241: mov L268, r6
+L242: not *r4
+dec r4
+bne *r0
+L243: .string "zoqsiqtgklkibxenpuogivs"
+rts
+L244: cmp r7, r0
+bne *r4
+L245: stop
+L246: sub *r2, r5
+not r3
+lea L168, *r4
+; comment
+sub *r3, *r2
+add L21, *r5
+; comment
+clr r1
+inc L2
+L247: dec X23
+clr L158
+cmp #169, r0
+add X12, *r7
+not *r7
+L248: dec X22
+clr *r1
+mov *r6, *r7
+not *r0
+jmp *r3
+L249: not r2
+L250: .data 120, -183, 733, -815, -371, -888, 692
+inc X9
+L251: prn r7
+cmp #206, *r7
+cmp #-173, #-11
+
+dec L198
+L252: .string "sgrr"
+L253: clr r5
+bne X4
+dec *r7
+lea L269, *r5
+sub r2, L208
+lea L30, L185
+not r1
+L254: cmp #182, L277
+L255: mov L79, L272
+clr *r7
+stop
+jmp *r2
+
+L256: prn X23
+L257: .data 619, -845, -236, -726, -312
+stop
+not r6
+not X2
+red *r4
+clr L19
+red X4
+L258: sub r4, r1
+L259: sub #-101, *r7
+dec *r7
+L260: clr r5
+dec X8
+add #163, *r5
+jsr *r6
+; comment
+L261: jsr L271
+L262: .string "eiduwiezkmbhbxnvok"
+jmp *r0
+L263: .data -376, 481
+L264: clr *r4
+rts
+L265: dec r1
+dec r6
+L266: add L282, L278
+prn #-194
+stop
+L267: stop
+L268: jmp *r3
+jsr *r5
+jmp *r5
+not r7
+cmp *r1, r4
+; comment
+; comment
+jsr *r3
+not r6
+prn X4
+bne X10
+sub r0, r6
+inc L154
+stop
+
+jmp *r5
+not *r5
+red X19
+L269: .string "kaoi"
+L270: sub #177, *r1
+red r3
+rts
+add *r5, *r0
+L271: .string "zhcy"
+jsr L277
+jsr L288
+dec X18
+jmp L156
+not *r6
+L272: .string "ckqwhmaxykmsgfcqtahz"
+bne L76
+
+L273: clr L59
+sub #106, *r5
+L274: sub r5, r5
+L275: lea L13, r7
+L276: inc *r4
+prn r2
+L277: lea L56, r4
+red r6
+L278: clr *r3
+jmp *r3
+jsr *r7
+bne *r6
+not r4
+L279: jsr *r2
+cmp *r6, #231
+bne L287
+clr *r5
+not X13
+L280: .data 293, -46, -396, 657, -537, 892
+jsr X10
+jsr L287
+not r7
+L281: dec r1
+L282: inc L285
+L283: cmp *r5, *r5
+red *r3
+jmp *r2
+jmp X19
+L284: .string "kxaytiqdxklc"
+prn r2
+mov *r5, r1
+red *r4
+rts
+stop
+inc r4
+jmp L285
+L285: lea L119, L10
+rts
+L286: add L289, *r2
+; comment
+L287: inc L118
+rts
+jsr L288
+sub #-46, L288
+lea X15, r5
+dec *r4
+not *r7
+cmp r0, L289
+L288: .data -582, -46, 893, -883
+stop
+jsr *r2
+jsr L177
+clr *r0
+cmp #147, r1
+sub #21, *r4
+rts
+prn r7
+prn #-159
+inc X15
+add #-29, *r7
+jmp *r2
+cmp L63, r7
+inc L2
+red L56
+L289: .data -357, -553, -209, -881, -633, -69
+add *r6, L130
+red *r3
+jsr *r2
+bne *r7
+jmp X19
+rts
+cmp r1, r1
+add #-152, r6
+rts
+rts
+not r2
+prn X1
+inc r3
+stop
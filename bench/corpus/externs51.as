@@ -0,0 +1,1045 @@
+; Generated by genCorpus --seed 52
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+bne *r2
+L0: stop
+cmp *r4, *r3
+lea X9, r4
+L1: .data 563, 919, -306, 906, -230, 133, -719
+cmp *r6, #106
+cmp X13, *r2
+lea X22, *r3
+add X2, r3
+L2: sub L0, L0
+cmp #-242, #-130
+L3: prn X19
+L4: jmp *r6
+inc X4
+jsr L261
+red *r2
+mov L243, X10
+L5: sub #-97, L1
+stop
+red r0
+stop
+inc r3
+stop
+
+jmp X15
+L6: .string "lnyjqhotmas"
+cmp #-7, X3
+prn L3
+L7: jsr L65
+clr *r6
+add *r2, *r3
+; comment
+add r0, r1
+cmp X23, #228
+L8: lea L5, L1
+L9: add L197, X11
+clr *r2
+clr *r3
+sub *r1, L89
+lea L87, r1
+L10: lea X0, *r0
+stop
+
+sub *r7, X14
+L11: .data -205
+L12: .string "yekaetqq"
+L13: .string "wtpjkvblmoncf"
+L14: clr r4
+rts
+L15: clr r2
+jsr L10
+L16: .data -860, -246, -981, 792, -159
+L17: .string "wpbc"
+sub r2, r7
+L18: dec X4
+L19: mov r7, X21
+mov *r2, r3
+L20: bne *r7
+rts
+jmp L111
+red *r2
+bne L48
+rts
+not r3
+L21: .string "fmujjvnuzxitactdefuywiv"
+stop
+mov #-127, *r5
+red L10
+red L269
+L22: .data 188, 46, -991, -952, 477, -866, 561
+bne L3
+jmp *r3
+stop
+rts
+sub r7, X19
+add *r2, *r3
+L23: .string "kuvs"
+
+L24: jsr X19
+clr L22
+stop
+prn *r6
+L25: cmp #100, *r5
+add L8, r6
+L26: .data -955, 328
+cmp X10, r3
+
+dec L184
+stop
+dec *r1
+L27: not r7
+L28: .data 138, -832, -335, 543
+add r1, L4
+cmp *r5, #-60
+red L47
+rts
+add X1, *r0
+mov X24, X8
+L29: not *r2
+not *r3
+stop
+lea L106, L14
+inc *r0
+jmp L131
+L30: red *r5
+stop
+bne L77
+L31: add L15, X8
+add X2, L25
+clr r7
+lea L235, X18
+; comment
+clr X14
+sub r6, r1
+clr *r2
+stop
+L32: red r6
+red r2
+lea X15, r0
+red *r3
+stop
+sub *r0, r6
+clr *r1
+L33: .string "ahaueaaivylnuxfucdtsbiyy"
+add r4, r0
+red *r3
+bne L28
+rts
+clr r6
+add *r3, X2
+cmp #-180, L23
+L34: jmp L0
+dec *r0
+mov L268, L29
+mov #105, r6
+sub X1, *r4
+L35: rts
+cmp L13, #6
+add #121, *r3
+rts
+prn L35
+; comment
+cmp #-188, *r0
+inc r3
+L36: .data -116, 691, -835
+inc r0
+cmp L19, X12
+bne L32
+L37: sub L66, *r4
+; comment
+lea X20, r5
+L38: dec r4
+L39: clr L208
+L40: dec r2
+L41: .data 809, 959, 222, 33, 804, 144
+L42: .data -684, -840, -256, -513, 998
+jmp *r0
+bne *r7
+; comment
+; comment
+dec X9
+red L32
+inc *r6
+cmp #19, #103
+jmp L41
+not r7
+L43: not *r1
+clr X20
+L44: jmp *r2
+cmp *r4, *r6
+clr X9
+L45: red *r5
+inc *r5
+cmp r4, #4
+L46: lea L25, r4
+cmp L204, L233
+clr X10
+sub L15, X7
+L47: lea L37, L20
+L48: bne *r5
+red r1
+jsr X15
+L49: jsr *r3
+L50: clr *r5
+bne L131
+L51: inc r7
+cmp #81, X13
+cmp #-65, r0
+L52: red L58
+clr X17
+bne L7
+L53: rts
+stop
+L54: .data 499, 269, 731, 115, -282, 480, 468, -568
+rts
+
+rts
+dec r5
+cmp L175, *r6
+jsr *r2
+L55: red L148
+L56: jsr L245
+L57: sub *r0, L46
+clr *r2
+L58: rts
+red L23
+not X5
+L59: jmp *r6
+dec r1
+bne *r5
+mov r4, X17
+L60: stop
+clr r1
+not X9
+stop
+
+rts
+prn *r0
+prn *r1
+red *r1
+stop
+rts
+mov #-200, *r7
+cmp r4, L274
+rts
+rts
+L61: jsr L10
+jmp X18
+L62: jsr *r7
+jmp X2
+L63: .data -352
+sub r5, *r1
+stop
+red L64
+prn X1
+mov r4, L22
+red r6
+dec r6
+L64: not L147
+stop
+dec *r2
+L65: .string "vlcvicdkpeqorqtoahhb"
+lea L31, *r6
+cmp r0, L170
+jsr *r5
+cmp #107, r5
+clr r3
+mov X5, r2
+prn #94
+L66: dec L32
+inc *r1
+jsr X23
+L67: bne L216
+dec *r3
+mov r2, X24
+; comment
+not r6
+not r7
+L68: .data 519, -499, 361
+red L203
+L69: .string "fljp"
+L70: mov r3, r7
+bne X20
+red X9
+red r5
+sub #-40, *r3
+prn L12
+L71: .string "mxue"
+rts
+sub *r2, X24
+clr r4
+rts
+L72: .string "cvz"
+L73: inc *r0
+lea L33, *r2
+prn #231
+
+cmp #-100, X22
+not r2
+sub r2, *r0
+L74: rts
+L75: clr X12
+prn L105
+add #-42, L87
+L76: .string "wyfufrylscpotiftzqwsjrnu"
+jmp L62
+cmp L140, L63
+lea X19, X23
+L77: inc r1
+jmp *r1
+
+L78: sub r0, *r3
+L79: red *r5
+dec r0
+red r6
+sub #-72, L11
+L80: jmp X21
+L81: .data 402
+jmp *r5
+L82: lea L28, r4
+; comment
+red X10
+cmp *r2, *r7
+cmp L202, r6
+clr X17
+L83: mov X3, *r2
+dec r4
+rts
+dec r7
+stop
+L84: jsr X4
+L85: .data 184, 564, 940, 134, 680
+inc *r5
+cmp L149, #94
+L86: .string "lmrye"
+jmp *r6
+prn #123
+L87: .data 721, -240, 547, -993, 837, 152
+not *r4
+stop
+; comment
+add r6, L48
+L88: prn *r6
+prn L46
+mov *r6, r2
+stop
+dec L1
+mov *r2, *r5
+prn #123
+add r7, L189
+bne *r6
+jmp X12
+
+jsr *r1
+L89: rts
+L90: mov r4, *r3
+mov #89, *r5
+lea L253, *r5
+rts
+cmp *r0, #-152
+red *r2
+lea X5, *r1
+clr r4
+jsr *r4
+L91: cmp *r2, r7
+L92: dec *r1
+add *r4, L57
+add *r4, r3
+prn r0
+; comment
+jsr X19
+inc r1
+jsr X3
+cmp #-25, *r6
+L93: .string "liozxkgwqz"
+L94: add X2, L151
+L95: .data 659
+cmp #214, #54
+L96: .string "uilu"
+L97: mov #218, r0
+L98: dec L76
+clr *r2
+cmp *r2, *r2
+L99: rts
+jmp X8
+; comment
+dec L14
+jsr L85
+dec r7
+cmp L140, *r1
+L100: add L35, *r2
+red r1
+L101: lea X16, *r0
+L102: prn L35
+L103: stop
+L104: jsr *r3
+cmp #185, r2
+rts
+red *r5
+prn *r3
+inc r7
+prn *r7
+stop
+red L91
+dec *r3
+L105: .string "qekdvqjvrdxfj"
+
+L106: .string "xpmmj"
+L107: jsr *r6
+jsr L256
+mov *r3, *r4
+cmp #-109, r7
+lea X18, *r3
+L108: .data -964, -960, 552, -378, -108, -642
+bne *r7
+bne *r5
+L109: .string "saorkhqbjwenoxqkwsv"
+
+prn *r3
+not r1
+stop
+stop
+mov #-159, r6
+L110: lea L243, L0
+cmp r7, *r4
+L111: sub #-241, r5
+prn r2
+red L13
+bne *r3
+stop
+dec r2
+
+
+
+jmp *r7
+L112: clr r1
+rts
+inc L257
+L113: .data 782, 788, -701, -737, -515
+jsr X7
+prn r3
+stop
+jmp *r3
+jmp L266
+jmp *r4
+dec *r2
+L114: .data -42, 436, -234, -230
+dec L43
+mov *r1, L70
+L115: add r7, r2
+mov L263, L109
+bne L42
+
+L116: .string "zexhom"
+L117: clr r7
+L118: rts
+; comment
+L119: .string "xvldtrrflhrqrvb"
+bne X8
+stop
+clr *r7
+red L166
+red r4
+L120: .string "epbni"
+L121: clr *r7
+L122: inc X16
+dec *r4
+sub r2, *r1
+jsr L91
+stop
+stop
+; comment
+dec r6
+dec *r0
+dec r2
+L123: inc *r2
+L124: dec r5
+L125: inc L21
+; comment
+L126: inc r7
+add *r0, X17
+L127: .data 163, -721
+jmp *r6
+
+cmp *r7, r4
+rts
+dec *r5
+L128: sub r6, r0
+dec X20
+L129: .data -531, -830
+dec *r2
+lea L39, L43
+red *r0
+L130: dec r4
+prn *r1
+clr r0
+cmp #-49, *r5
+lea X13, X23
+inc *r2
+rts
+L131: sub X3, L216
+cmp #-87, L96
+stop
+prn r6
+L132: .data 901, -864, 963, -303, -162
+L133: jmp *r7
+
+L134: rts
+
+L135: cmp L70, r4
+red r5
+L136: .data 103, -108, -39, 529, 482, -193
+L137: cmp #-71, r6
+L138: .data 585, 889, 277, 111, 620, -635
+stop
+mov r6, *r4
+mov X11, r1
+add #-77, r2
+stop
+L139: .string "tyspgsahrt"
+jsr X13
+jsr *r2
+clr X15
+L140: prn #-74
+L141: lea L109, r5
+jsr *r5
+bne X4
+rts
+; comment
+L142: .string "mvrfvonpdvczgtnzjl"
+L143: stop
+sub L233, r1
+bne L252
+jmp *r3
+red *r0
+L144: .string "edxkz"
+clr r6
+dec *r3
+L145: .string "swtzzxaemtadvefn"
+clr X3
+not *r1
+L146: add X19, *r1
+L147: rts
+lea X15, *r1
+L148: dec r2
+
+; comment
+lea L181, L250
+jsr *r7
+L149: .data -781, -333, 460, 869, 109
+red r6
+L150: not X17
+L151: .string "qfzxcwiwxuqrzsyojemzqq"
+stop
+cmp L250, #-115
+rts
+L152: not r0
+L153: inc *r3
+add r5, L268
+lea L120, *r3
+lea L62, *r7
+mov #-67, r4
+lea L205, *r4
+L154: mov #-207, r3
+bne X3
+prn *r7
+jsr X15
+L155: jsr X7
+jmp *r3
+rts
+L156: .string "davwsbyfr"
+not r0
+clr L231
+jsr X1
+cmp #-21, r3
+L157: jmp L205
+L158: .data -485, -903, -435, -984
+inc *r4
+stop
+red r2
+L159: .data 937
+L160: lea L106, r3
+L161: mov r5, r7
+rts
+add *r5, *r5
+
+cmp #-190, #197
+dec r2
+L162: .data -897, 235, 847, 943, 372, -91, 982, -228
+rts
+prn r6
+L163: .string "ks"
+prn #103
+L164: jmp *r2
+L165: .string "raejxqfogebcxcubqakh"
+sub r0, L105
+sub r6, r3
+L166: dec r7
+bne *r6
+mov X2, r2
+red L219
+bne L41
+mov X16, *r2
+L167: clr r2
+L168: .data -954, 117
+mov L229, r5
+clr r1
+not r3
+jmp L139
+L169: .data -106, -55, -426, 177, -125, -199, 126
+; comment
+add X13, X21
+clr *r4
+not L73
+L170: dec *r5
+rts
+L171: .string "uevhkchqeedmlwxgngabhea"
+rts
+jmp *r1
+red *r5
+cmp *r0, #-172
+not r4
+jmp X18
+; comment
+mov r2, *r7
+red L162
+dec *r2
+L172: .string "lrqgpyryphevxt"
+jmp L133
+not X8
+L173: prn *r2
+red *r5
+rts
+add L189, L213
+stop
+bne *r4
+dec r1
+cmp r7, X20
+not L179
+stop
+sub L107, r2
+add r2, *r5
+add L257, X2
+add L149, r2
+prn #-205
+L174: .string "xdyxqj"
+clr *r5
+jsr L232
+lea L112, X1
+L175: sub *r5, L186
+stop
+not r5
+jsr *r7
+cmp X19, *r6
+jsr X4
+L176: add r3, *r7
+red L55
+L177: sub #-19, L88
+dec r0
+L178: rts
+stop
+mov #66, *r6
+prn #-96
+jsr *r2
+L179: bne *r7
+jmp *r0
+L180: .data -97, 749
+add L261, *r7
+stop
+stop
+dec *r3
+clr L88
+inc X9
+jsr *r4
+bne L232
+L181: .data -911, 262, 847, -478
+clr *r5
+jsr L23
+L182: .data -289, 734, 662, -38, -136
+bne *r3
+
+jsr X24
+sub *r2, r0
+bne L148
+L183: .string "tjrevawmlxchzabxxbshtit"
+dec L145
+cmp r5, *r5
+lea L274, *r1
+
+L184: not r5
+L185: rts
+rts
+clr r7
+red r7
+bne L207
+L186: stop
+stop
+prn r6
+rts
+jsr *r3
+; comment
+red *r7
+sub #-83, r4
+L187: .string "ntblz"
+jsr L199
+rts
+jmp L32
+dec r3
+jsr *r7
+clr *r5
+prn r5
+L188: jsr *r3
+; comment
+L189: cmp L197, L101
+jsr L129
+L190: inc L94
+inc *r7
+clr r0
+clr X22
+
+; comment
+inc *r7
+bne L193
+L191: .data -69
+L192: jmp *r5
+L193: stop
+stop
+lea L203, *r2
+not *r6
+stop
+lea X10, r6
+inc *r1
+L194: .string "gmxncybsnmdzuhktmfqqq"
+
+prn r6
+lea L171, L268
+mov #-130, X23
+add *r1, r7
+L195: bne *r0
+not r4
+L196: not X19
+lea L86, *r0
+; comment
+cmp r5, L99
+dec L195
+L197: not *r4
+jsr L72
+L198: cmp #196, r2
+clr r0
+bne *r7
+not *r7
+clr *r4
+bne L97
+stop
+
+
+jsr X18
+L199: dec r5
+; comment
+add r3, L37
+cmp #84, X6
+L200: add #-162, L126
+L201: stop
+inc *r2
+jsr L259
+jsr *r3
+not L184
+red X23
+; comment
+inc r7
+not X23
+mov r4, *r2
+L202: not *r4
+prn *r2
+mov r6, *r7
+lea X24, L101
+jsr *r4
+L203: .string "vruta"
+L204: sub #-241, r6
+add r4, *r4
+rts
+prn *r1
+dec r1
+cmp *r6, L43
+L205: .string "xtrjedyj"
+dec *r6
+jsr L233
+sub X9, r1
+not L229
+L206: clr L153
+L207: bne *r2
+jsr L267
+add X13, L230
+L208: red X22
+sub #84, r7
+L209: rts
+mov X11, *r3
+sub #213, r2
+jsr L185
+rts
+mov *r6, *r7
+prn *r1
+L210: lea L205, L210
+clr r0
+add #-144, r1
+stop
+cmp *r3, L266
+stop
+red r3
+L211: mov *r1, *r6
+stop
+L212: .string "djosyoinffsvlqxmsqnao"
+jsr *r5
+rts
+L213: .string "ykhurfxjenuhhhrr"
+prn *r5
+stop
+add #-9, *r5
+L214: clr *r3
+sub #8, r0
+clr r3
+
+not *r4
+L215: bne *r5
+dec *r2
+mov r5, r3
+
+mov #-47, L115
+L216: add *r2, X17
+mov #-233, X21
+add L137, r0
+sub #-227, L247
+prn #-197
+L217: .data -14, -328, -85, 407, -72, -49, -76
+L218: cmp #27, *r5
+bne X19
+red L226
+clr *r7
+not r2
+L219: cmp #-158, #-112
+L220: clr *r4
+cmp X10, X8
+dec L35
+red *r3
+sub #167, *r0
+L221: .data -199, -865, -784
+clr r6
+dec X24
+mov r5, r4
+L222: add #-190, r7
+L223: jmp *r4
+jmp X0
+jsr L258
+not r4
+clr L214
+L224: red L156
+mov #-144, *r3
+L225: jsr L238
+L226: stop
+dec r4
+red r6
+bne *r3
+L227: .data 786, 950
+L228: jsr *r0
+jmp *r6
+prn #-205
+L229: .string "pzyumioikbxikqkexx"
+L230: bne X11
+rts
+L231: .string "xymjbuhmebjnfqgkpqz"
+L232: .string "jzzixp"
+cmp #202, X14
+sub L260, r6
+sub *r4, r0
+inc r1
+clr L242
+dec r4
+jsr *r0
+rts
+jmp *r4
+L233: .data 420
+prn r1
+L234: mov *r6, L69
+prn r3
+L235: .data 17, -140, -860, 255, -279, -47
+L236: red r4
+jsr *r2
+jsr *r0
+L237: mov *r0, r3
+L238: clr r1
+L239: not *r2
+
+jmp L115
+L240: .string "gaguvrckokqnehmgbnfin"
+L241: jmp *r3
+L242: not L270
+jmp *r6
+bne *r7
+dec *r4
+L243: .data -159, -994, -720, 59, -794, 61
+not L152
+lea X14, *r4
+rts
+jsr *r0
+clr X11
+L244: .string "dsrlsskpzhmvhgebzabxuk"
+stop
+red L154
+lea X24, r0
+L245: .data 899, 213
+prn #176
+dec L77
+L246: mov X19, r4
+L247: bne *r7
+lea X4, X18
+L248: lea X24, X5
+
+L249: .string "hflhhcttxgcjvx"
+rts
+; comment
+jsr *r4
+jsr *r1
+L250: jsr L254
+add r2, *r5
+L251: not r7
+jmp L271
+clr *r1
+prn L117
+L252: .string "hzslqooyjw"
+prn r0
+lea L95, L44
+bne *r1
+
+clr *r0
+
+mov *r3, *r1
+L253: clr L259
+L254: add *r1, r4
+jmp *r5
+lea L141, r0
+rts
+lea X1, L259
+red r5
+clr *r7
+; comment
+red X17
+inc L270
+mov X9, X8
+cmp *r3, r6
+add #-173, r6
+L255: .string "hotkxlkodqgkznhpifh"
+L256: dec L230
+jsr *r0
+L257: bne L276
+jsr X8
+add X11, r2
+not L261
+add *r2, r4
+inc *r5
+; comment
+inc *r2
+L258: stop
+dec *r3
+
+sub #76, X11
+L259: lea X14, X12
+mov r6, r6
+prn #78
+sub r7, *r2
+L260: jmp *r1
+L261: lea L264, r0
+bne L269
+L262: inc *r1
+cmp #-212, L96
+stop
+prn r4
+prn X10
+L263: .data 893, -924, -578, 388
+L264: .string "ppiez"
+mov L271, r6
+jmp L236
+inc *r3
+jsr *r0
+sub L108, L143
+L265: .string "vycnro"
+lea L160, r5
+prn #-4
+lea X18, r6
+L266: dec r5
+L267: sub #186, L248
+L268: jmp L272
+L269: cmp X7, #173
+jsr L273
+jmp X0
+jmp *r0
+L270: .data -965
+jmp *r6
+not *r6
+bne *r6
+bne *r2
+L271: .string "teovlvuyzuc"
+add *r4, *r1
+bne *r7
+bne *r4
+L272: sub L96, L31
+prn *r6
+clr r4
+L273: .data 844, 196
+cmp *r1, L82
+jsr X5
+L274: jmp *r4
+L275: rts
+inc r1
+lea X23, r2
+not r7
+; comment
+jsr L269
+L276: bne *r6
+dec *r5
+bne *r3
+stop
@@ -0,0 +1,1046 @@
+; Generated by genCorpus --seed 53
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+; comment
+dec r3
+L0: red L0
+lea L0, *r4
+cmp r3, r4
+L1: jmp *r4
+add L1, *r5
+not r3
+bne L1
+jmp L7
+clr *r2
+sub #-44, X14
+L2: .data -500, 0, 494, 200
+inc r1
+red X8
+stop
+L3: jmp L0
+lea L2, *r7
+rts
+cmp #17, *r4
+L4: .data -591, -438, -107, -739
+sub #56, L82
+L5: clr *r0
+inc *r0
+L6: bne L6
+mov L158, L56
+inc *r7
+L7: .string "itxgdqwhehpxtcyvjkrc"
+L8: dec *r6
+L9: jsr L0
+sub #-187, L4
+bne *r7
+L10: .data 585, 166, -122, 420, -419
+L11: mov #-28, L3
+L12: lea L6, L1
+L13: add r5, *r1
+L14: .string "tdswscsnqchjbj"
+L15: .data -521, 120, 318, 961, -155, 843, 379, 391
+stop
+bne X24
+red L1
+L16: .string "budob"
+L17: .data 748, 677, 749, -744, -810, 116, -700
+not L15
+mov r3, L1
+rts
+clr X13
+L18: stop
+sub r1, L15
+bne *r6
+clr r5
+prn L13
+cmp *r6, *r7
+lea X15, r0
+L19: .data 603, 665, 580, 459
+clr r7
+L20: .data 709, -339, 628
+inc r6
+jmp *r7
+rts
+inc L36
+lea L186, r3
+bne *r4
+add r1, *r3
+
+L21: cmp #-75, L164
+jmp *r5
+bne *r2
+rts
+not r7
+bne L61
+L22: .data 551, -185
+L23: add r0, L277
+L24: .string "yzz"
+L25: not L288
+dec *r1
+L26: red X5
+L27: add *r0, r5
+clr L6
+red r5
+rts
+clr L136
+not L18
+inc r6
+rts
+L28: .data -425, 719, -94, -183, -366, 475, -85, 870
+bne *r0
+add *r3, *r0
+jmp *r7
+sub L279, r7
+L29: .data 155, 498, -579, -115, -438, -610, -969
+jsr X17
+L30: prn r5
+inc r5
+jsr L200
+L31: rts
+L32: bne L90
+L33: .data 669, -368, 186, -83
+rts
+L34: .data 995, -698, 657, 264, 583, -57, 669, 181
+dec *r2
+cmp r4, r4
+add #-66, *r1
+inc r7
+prn L48
+add r7, r7
+inc r6
+bne *r0
+bne L18
+rts
+dec *r1
+; comment
+L35: .data -546
+L36: .data 908, 741, 415, 482, -818, -595
+L37: jsr X7
+L38: cmp r5, *r5
+red *r5
+L39: lea L257, *r3
+bne X9
+prn #148
+stop
+L40: .data -411, -687, 248, 324, 702
+; comment
+prn #137
+bne *r0
+L41: bne L53
+mov X7, *r2
+prn #211
+
+cmp *r1, r3
+add *r2, X24
+L42: mov L231, *r5
+L43: inc X24
+add #184, r0
+; comment
+rts
+clr *r4
+jmp *r3
+prn X16
+L44: mov #-150, L270
+L45: not r7
+L46: inc X4
+L47: stop
+inc r5
+dec r3
+inc L3
+; comment
+L48: .string "igtrcshwmnymjvby"
+L49: cmp X8, L207
+bne L192
+mov *r1, L26
+L50: .string "rzjvoazvtclcjcspxndwun"
+rts
+cmp X9, L32
+red r3
+dec r2
+stop
+add r1, L17
+dec *r6
+L51: not r7
+mov #250, X15
+dec X17
+prn *r1
+inc X14
+L52: inc L40
+rts
+L53: .string "pkxskerolomonqruxgcw"
+clr L138
+dec L10
+sub L27, r5
+bne *r4
+mov L26, r6
+mov *r5, X19
+L54: mov #-4, L11
+rts
+L55: rts
+L56: .string "phtzcgmgnrglyg"
+red X8
+L57: .data 290, -975, -636, -190, 912
+inc *r4
+cmp #221, r3
+add r1, L10
+bne L12
+stop
+L58: add L258, X19
+L59: inc r4
+L60: lea L132, L46
+L61: jmp *r2
+bne *r7
+sub r2, L29
+prn L24
+jsr *r5
+L62: dec *r4
+L63: .data 253, 97, 320, -176, -314, -335, -188, -98
+L64: .data 407, -793
+sub r7, r7
+inc r5
+L65: .string "erekmlugtcjojgveybb"
+L66: .string "ttknswhhhtlchebi"
+L67: dec r7
+jsr L238
+L68: .string "ihwfgolhbwbwhcixes"
+L69: .data 651, 856, -156, 317
+L70: inc r0
+mov *r4, r0
+rts
+mov *r5, r6
+dec X20
+L71: .string "ckbeweibokmpgxk"
+L72: inc L202
+rts
+; comment
+L73: not r3
+lea L51, L30
+not r5
+red r2
+rts
+not *r6
+rts
+red r5
+inc r3
+lea L60, L6
+rts
+stop
+red r6
+jmp X17
+L74: .string "oodmfgdkkoohuhmhfzgwc"
+dec r0
+clr *r0
+mov #16, L69
+clr *r5
+lea X19, *r7
+not r7
+jsr L72
+add r5, r4
+jsr L50
+L75: cmp r0, L226
+dec r4
+not r0
+L76: red *r0
+cmp *r4, *r3
+L77: mov *r0, X9
+dec r5
+L78: add X19, *r4
+dec *r3
+L79: red X23
+inc r7
+L80: stop
+inc L60
+inc L224
+prn #191
+jsr *r4
+L81: .data 248, -245, 330, 170, 167, 15, 22
+not *r4
+L82: inc L48
+add r2, *r1
+L83: jmp L3
+jsr *r2
+lea X22, r6
+not r0
+bne X0
+inc r2
+add X8, L277
+jsr X14
+add L72, r2
+L84: .data -90, -180
+; comment
+red *r0
+jsr L184
+rts
+add X12, r3
+L85: prn *r5
+lea X11, *r0
+L86: .string "mqoscpoeoo"
+L87: .string "znvglgsjrw"
+sub *r5, L249
+rts
+L88: lea L47, r5
+cmp L66, *r1
+not r2
+lea L82, *r1
+L89: sub #-60, *r2
+dec *r4
+dec r2
+; comment
+prn *r0
+clr *r7
+red r3
+inc r6
+L90: .data 556, 318, 194, -92, -672
+cmp #-210, *r0
+add *r3, r6
+mov r2, *r4
+rts
+L91: .string "pldinjvyrwqqmyhunksz"
+L92: not r0
+add r5, r3
+rts
+; comment
+L93: lea L78, *r2
+rts
+jsr *r4
+bne L185
+not L10
+stop
+stop
+L94: bne X12
+L95: prn #183
+sub r0, *r2
+bne *r0
+jsr X21
+L96: jmp L189
+sub L0, r1
+L97: prn X20
+add L256, X0
+lea L207, r3
+cmp r7, L85
+not *r6
+prn X14
+red r4
+L98: jsr *r0
+; comment
+L99: red *r5
+L100: stop
+stop
+L101: clr L62
+prn r6
+red *r2
+not X2
+prn r4
+not *r2
+sub r0, *r0
+; comment
+stop
+inc r2
+L102: .data -73
+lea L4, r4
+L103: inc L123
+stop
+L104: bne *r1
+jmp *r6
+
+L105: dec *r3
+not r0
+L106: rts
+L107: clr r0
+L108: inc L201
+dec *r2
+inc *r6
+rts
+jmp L37
+mov #152, r7
+red *r3
+add *r5, L16
+mov #149, X23
+cmp L198, #-223
+L109: stop
+stop
+stop
+L110: inc L264
+dec L102
+add r2, r2
+jsr *r7
+L111: jmp L256
+jsr X2
+cmp r6, r3
+jsr X12
+sub #-29, r5
+dec L123
+L112: bne *r1
+sub *r2, r1
+red r5
+L113: .data -602, -261, -169, -766, -959
+red L258
+L114: .data 345, -392, -175, -317, 617
+add *r2, *r1
+L115: jmp *r6
+mov #-110, X8
+red L20
+stop
+L116: .data 894, -494, 871, -722
+mov L176, L204
+stop
+dec L227
+clr r5
+jmp L226
+stop
+bne *r7
+L117: bne X2
+L118: dec L182
+L119: add r1, *r6
+L120: .data -113, 128, -789, -798, -128, -870, -25, 55
+jmp X14
+inc X9
+L121: red *r3
+add r0, L38
+prn *r3
+sub r1, r2
+red *r3
+not X12
+sub L59, r3
+sub r1, r6
+L122: prn r1
+inc L218
+bne *r2
+red r2
+cmp *r0, #-170
+L123: prn r6
+red *r0
+stop
+L124: mov #-76, *r5
+mov r0, *r1
+L125: jsr *r1
+
+L126: .data -401, -58, 822, -33, 861, -407, -848, -471
+not r7
+stop
+prn #160
+; comment
+dec L268
+rts
+clr r6
+stop
+lea L5, L139
+L127: mov *r1, L69
+rts
+bne L260
+L128: clr *r2
+L129: dec *r2
+L130: bne X3
+; comment
+mov L180, r0
+L131: .string "qfrkvcwjomddsnjisttxmwf"
+L132: lea L72, *r2
+rts
+sub #38, *r7
+red *r3
+dec *r3
+prn *r4
+jmp X0
+sub L124, X2
+L133: prn #107
+mov #-250, r4
+L134: .string "skf"
+prn r2
+add *r3, *r5
+add L22, r1
+add r3, r0
+jsr *r5
+L135: red L223
+dec r3
+L136: rts
+mov *r4, *r7
+inc L118
+L137: red r1
+lea L9, *r4
+dec *r1
+L138: .data -943, 574, 357, 759, -151, -812, -347, 76
+L139: .string "hxmzuahmpnyymqgcsefqcro"
+bne L44
+L140: jsr *r5
+rts
+; comment
+stop
+prn #-2
+jsr *r7
+L141: lea L95, r2
+L142: sub X10, *r1
+cmp L244, X13
+L143: .string "sstxgkqbv"
+mov L241, *r4
+L144: red *r4
+sub L63, L293
+jmp *r1
+lea L90, L14
+L145: .data -977
+inc *r1
+rts
+rts
+mov *r6, *r6
+lea X16, *r6
+cmp L70, #-37
+L146: rts
+stop
+jsr *r4
+cmp r6, X4
+bne X0
+L147: .string "kryxiecdljjj"
+stop
+prn X9
+
+L148: rts
+add L266, X7
+L149: mov r5, *r1
+dec r2
+cmp L15, *r6
+sub *r7, L229
+rts
+add #-143, r6
+lea X6, L60
+add r3, *r3
+add r6, *r6
+stop
+dec r2
+L150: .data 457, -828
+bne *r3
+
+; comment
+dec *r0
+sub r0, X5
+mov X12, *r2
+dec *r4
+; comment
+L151: jsr *r3
+; comment
+L152: .string "tyjmtgfzqdovnqx"
+red r0
+stop
+
+L153: .string "xaudjzkgxdwxgsg"
+L154: cmp #-58, X15
+clr X4
+sub r3, L285
+lea L211, L243
+lea X11, L221
+jmp *r1
+prn #-13
+L155: bne L221
+mov X20, r7
+jmp *r5
+L156: mov L162, L235
+not *r0
+inc L185
+L157: jsr *r1
+inc *r2
+L158: .string "lllewzqduxq"
+dec L148
+L159: rts
+L160: cmp #216, *r0
+prn *r5
+jmp X15
+L161: jsr L297
+L162: .string "rvktqdpdmmevrgp"
+prn #-54
+prn X14
+jmp L195
+bne *r2
+L163: jsr *r1
+
+prn #66
+; comment
+cmp *r5, r7
+jmp *r1
+L164: sub *r0, X2
+jsr L167
+lea X12, L86
+mov L34, r4
+clr *r5
+L165: inc *r4
+L166: lea L168, L108
+L167: jsr X4
+jmp L203
+jmp L171
+bne *r2
+L168: clr L237
+L169: .data 394, -706, -403, 144, -452, 947, 928, -223
+bne *r0
+jmp L136
+jmp L73
+red *r4
+L170: .data 940, 813, 474, 938, 228, -162, -440
+stop
+not X9
+cmp X7, r0
+jmp L266
+sub #78, r2
+rts
+add L214, X20
+bne X19
+L171: clr r4
+red r2
+cmp X21, #-230
+L172: .data -128, -541, 246, -318, 184, -522
+red *r0
+jsr *r7
+lea L230, *r3
+dec r7
+L173: sub #107, *r2
+inc *r1
+not *r1
+L174: dec X3
+L175: .string "vcgvz"
+L176: rts
+L177: lea L9, r4
+L178: cmp X21, #129
+L179: red r0
+jsr *r0
+L180: .data 530
+L181: .data 501, -25, 165, -660, 846, -148, 491
+jsr *r1
+L182: mov #23, *r2
+sub #46, L4
+lea L134, *r3
+bne X19
+L183: prn r2
+inc *r7
+mov *r4, r3
+L184: sub #79, *r4
+jmp L38
+L185: lea L4, *r1
+L186: cmp #-186, *r5
+L187: mov #30, r5
+L188: rts
+dec X9
+lea L276, X12
+clr r7
+L189: sub *r2, *r0
+L190: .data -455
+dec *r7
+jmp L282
+inc L86
+; comment
+L191: .data 208, -953, -778
+L192: .data 102
+sub #67, *r6
+clr X0
+L193: .data 295, 945, 752
+dec *r4
+add L259, X16
+mov *r5, L132
+mov #126, X16
+cmp r7, L117
+
+L194: .data -721, -58, -953, -828, 42
+L195: mov r3, *r5
+red r3
+L196: bne L10
+; comment
+L197: sub r5, L226
+cmp r5, r6
+rts
+L198: .data 592, 819, 47, 836, -277, 450, 285, 601
+L199: .string "xkwzgq"
+lea L287, r3
+red *r0
+L200: .string "dedpwaqfluujodi"
+L201: cmp L191, L240
+L202: .data -255, 410, -300
+red r4
+L203: .data -908, -842, -854, 286, 639, 715, -118
+L204: rts
+clr L240
+L205: .string "qorvnqddegiwagvf"
+L206: jsr X9
+stop
+inc *r1
+sub r2, X4
+; comment
+add r3, r2
+jmp X20
+mov *r6, r2
+red X14
+
+bne L284
+lea L287, *r6
+bne *r1
+red L271
+mov #-238, X2
+bne *r3
+mov #196, r5
+clr *r5
+clr r7
+jmp X9
+rts
+L207: jmp *r5
+dec r2
+jmp L235
+bne *r6
+lea X9, *r2
+L208: jsr L196
+sub L209, *r2
+L209: .data -556
+dec X13
+lea L78, *r4
+L210: bne X16
+L211: .data 958, -803, -770, -401, 717
+L212: .data 994, -102
+L213: stop
+stop
+sub #204, *r2
+jsr *r3
+L214: .data 685
+L215: .string "b"
+lea X5, r3
+inc L128
+jmp *r7
+add *r1, *r3
+mov #74, *r6
+
+mov r0, r7
+add L217, r7
+L216: mov #-66, *r3
+cmp r6, r0
+dec *r7
+cmp *r0, r1
+not r0
+stop
+L217: .string "irchxhbtcsyozusbev"
+prn r2
+cmp #-150, *r4
+jsr *r3
+rts
+jmp X10
+clr X21
+add r6, L79
+L218: .string "zdwazxu"
+rts
+L219: clr r3
+jsr L250
+inc *r2
+; comment
+stop
+dec *r5
+jsr L243
+bne *r4
+prn *r2
+L220: cmp X12, *r6
+inc *r3
+sub L178, *r1
+L221: bne *r0
+mov r2, L260
+not *r1
+L222: rts
+dec *r4
+clr r1
+L223: .data 958
+L224: clr *r6
+L225: not *r1
+add #11, *r5
+bne *r6
+red L54
+dec *r1
+inc *r0
+L226: mov r0, L296
+jsr X21
+rts
+prn r7
+; comment
+red X1
+prn *r0
+L227: bne L222
+L228: jsr *r5
+L229: sub X7, r7
+cmp L148, r7
+rts
+not r2
+not *r7
+bne *r6
+red *r4
+bne L29
+red X24
+sub L127, r6
+L230: bne L226
+prn L244
+L231: inc r3
+dec L111
+L232: jsr L235
+bne L283
+lea L297, r0
+L233: sub X6, *r3
+dec r5
+not L231
+L234: .string "jdhhishte"
+L235: .data -960, -264, -648, 515
+L236: .string "ygtqebtcuwjkzxqeqaiequr"
+stop
+L237: bne *r6
+inc *r5
+L238: red *r7
+L239: .data -259, -513, -618, -267, -634, 211
+rts
+clr *r5
+rts
+red L81
+inc L285
+lea X9, X0
+L240: inc r5
+lea X15, L285
+bne L264
+add *r2, *r1
+rts
+L241: lea X24, X3
+not *r6
+L242: .data -293, 91, 30, -23, 497
+L243: rts
+inc *r7
+sub r2, L132
+rts
+not *r2
+stop
+L244: add #-79, L261
+jsr X12
+clr *r5
+L245: .string "jipkbbleizzbrzsjthe"
+prn r1
+L246: .data -61, 788, 449, -22, 915, 837
+jsr *r5
+cmp r3, *r0
+not *r5
+add L259, r7
+L247: prn r0
+L248: bne L296
+not X4
+not *r6
+cmp r3, *r2
+stop
+not *r5
+
+bne X21
+dec *r7
+L249: sub #203, r7
+lea X0, *r2
+L250: lea L275, *r1
+L251: jsr *r5
+red *r5
+red L218
+rts
+cmp *r4, #-105
+cmp L279, r0
+L252: jsr L94
+not L272
+clr *r7
+mov r0, *r0
+red *r1
+cmp *r6, r2
+rts
+mov #145, r7
+L253: dec r3
+sub r6, X8
+red r5
+prn *r5
+jsr X5
+L254: .string "ygfuorfqwbenikldbnqgni"
+stop
+L255: .string "rh"
+dec *r5
+jmp L273
+dec *r3
+clr r6
+rts
+
+dec L281
+rts
+not r3
+L256: prn *r5
+L257: sub #95, *r2
+; comment
+jsr *r7
+mov *r2, *r5
+L258: mov #225, X4
+L259: .string "sngjavtwnhdqfmmshuocjrg"
+rts
+L260: not r3
+prn L282
+L261: dec L219
+L262: dec r3
+inc *r6
+add *r7, X16
+clr X1
+sub r3, r5
+dec r6
+dec *r1
+jsr *r2
+bne *r2
+not L278
+L263: .string "lomgdwhskzfjqwatbcr"
+dec r5
+stop
+red r2
+cmp #247, #-188
+L264: stop
+; comment
+jmp L274
+dec *r2
+mov #-28, X24
+prn X14
+bne L235
+stop
+jmp *r5
+jmp *r7
+rts
+
+clr *r7
+not L159
+dec L277
+prn #212
+prn *r5
+inc r1
+sub L296, r7
+L265: sub r0, *r7
+L266: not L74
+add r1, *r5
+inc r0
+not *r7
+cmp r3, #106
+L267: .string "lcakhxtuomhzmyngwnfbq"
+dec X23
+add *r4, L279
+bne *r1
+
+mov *r3, X0
+jsr *r0
+L268: red r1
+L269: sub *r0, *r5
+lea L288, X6
+L270: clr X17
+lea L279, r1
+sub #63, r5
+jsr *r6
+not *r5
+L271: .string "yemwh"
+rts
+L272: add #-70, *r0
+L273: jsr L167
+L274: red L275
+stop
+L275: clr r5
+jsr *r6
+L276: not *r2
+inc *r4
+stop
+inc *r6
+L277: .data -841, 916, -35, 283, 683
+sub r1, X17
+red r4
+L278: .string "cjcpfptmuudjdwvbxt"
+mov *r3, X21
+L279: lea L164, *r1
+bne *r6
+inc *r4
+
+sub L284, r5
+add r7, r7
+L280: mov #-243, r2
+L281: inc X1
+; comment
+not X12
+lea L254, *r0
+L282: add #135, r6
+; comment
+bne L242
+rts
+L283: .string "ed"
+L284: clr L289
+L285: clr r0
+dec L74
+L286: bne *r1
+jsr L119
+; comment
+L287: .data 909, -926, 927, -726
+inc r7
+jmp L297
+L288: bne L292
+jmp *r0
+rts
+jsr *r7
+jmp *r1
+inc X11
+L289: dec *r2
+mov r2, *r0
+lea L293, r4
+red L290
+stop
+stop
+bne *r6
+sub r0, X0
+stop
+L290: .string "zivqcoeuql"
+stop
+L291: .data 535, 33, -831
+; comment
+L292: .data -30, -250
+L293: red *r3
+dec r2
+clr *r5
+L294: .string "dtnohchthehxjhlvibzffrda"
+stop
+lea L61, *r4
+L295: .string "yjyflbwjgusiaygmco"
+inc r3
+rts
+
+clr *r6
+dec *r1
+; comment
+stop
+L296: sub L297, r1
+lea X1, X0
+lea L297, L297
+L297: .data 921, -778
+stop
@@ -0,0 +1,1045 @@
+; Generated by genCorpus --seed 54
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+jsr X1
+clr L27
+jmp X22
+L0: inc r6
+jsr L260
+sub r2, r5
+L1: .string "sorlyknqxvkcb"
+L2: .string "vr"
+L3: .data 544, -174
+L4: jmp *r0
+jsr *r1
+clr *r0
+L5: sub #-102, L6
+L6: sub *r5, *r1
+L7: inc r3
+jsr L3
+rts
+; comment
+L8: .data 887, 975, 657, -557, -812, -194, 351
+sub L46, r5
+L9: jsr L8
+L10: prn r0
+add r5, L4
+jsr *r1
+L11: .string "alnkpzdevdwyzrxgrwjd"
+jsr *r5
+rts
+L12: .data 768
+lea L4, r7
+L13: jmp *r7
+prn X3
+rts
+L14: .data 153
+prn L11
+rts
+L15: jmp L15
+; comment
+jmp *r7
+L16: .string "hicikqiwfybkhsminok"
+L17: .string "lrnrecuzbeqi"
+bne *r2
+not r5
+cmp r4, *r1
+sub #-205, *r6
+bne X19
+L18: prn #-1
+stop
+L19: mov *r4, r5
+stop
+L20: jsr L1
+L21: .string "hjrpuuffzhzhkojmdpgeicbj"
+rts
+lea X19, *r2
+red L222
+stop
+not r5
+clr L5
+jsr *r3
+inc *r1
+clr *r7
+not *r1
+L22: .data -166, 263
+jsr *r2
+jmp L85
+red *r3
+inc r3
+; comment
+jmp X20
+sub X11, *r6
+cmp L157, #-23
+dec L19
+jsr *r4
+mov *r5, r4
+sub *r3, *r7
+L23: cmp #-50, *r6
+not L7
+not L73
+clr r4
+rts
+add *r2, L89
+L24: sub L11, L36
+L25: mov *r6, r3
+lea X6, L11
+red r5
+sub X21, *r2
+inc *r7
+L26: cmp X7, #11
+add *r2, r1
+; comment
+L27: .data 644, 215, -314, -28, 932, -148, -370, -890
+L28: jsr X0
+red r7
+bne X18
+L29: .string "poe"
+L30: jsr *r7
+jsr L124
+add #111, *r3
+L31: dec r3
+rts
+stop
+mov X0, L6
+L32: .data -435
+L33: .data 917, -892, -374, 657
+L34: add *r7, *r0
+clr r6
+L35: .string "tviqgvzrkfyfgiuooos"
+lea L242, X8
+jsr L25
+cmp *r6, r6
+cmp r4, r1
+sub *r6, r6
+clr L57
+L36: mov *r5, r7
+dec r6
+bne *r1
+L37: stop
+mov L30, X17
+rts
+sub L125, *r1
+L38: red r0
+L39: not X23
+jmp *r5
+inc *r3
+inc r0
+L40: not r6
+red r6
+stop
+L41: .string "dmhpuefzqaovgxkdiksqr"
+jmp L100
+rts
+clr *r3
+L42: add #-27, *r6
+
+rts
+rts
+L43: .data -12, 719, -474
+bne X16
+inc r3
+bne *r3
+jmp *r4
+jmp *r3
+L44: red r4
+jmp *r2
+mov *r1, *r2
+rts
+prn r6
+; comment
+L45: add L155, X6
+clr *r4
+lea L216, L33
+L46: .data -418, -793, -218, -906, -533
+L47: .data 630, 885, -263, -328, 470, -314, -532
+L48: .data -676, -121, -912
+L49: prn *r7
+red L108
+L50: .string "klkpvvs"
+L51: not X22
+bne *r5
+sub L26, r3
+bne X24
+dec r2
+L52: .data 831, -504, -842, 581, 737, 866, -191
+red *r1
+cmp *r6, r3
+jsr *r1
+dec L27
+cmp *r7, L129
+L53: jsr L45
+L54: .data -679, -867
+rts
+L55: inc L9
+not r7
+mov L19, *r0
+stop
+L56: .string "bjqxtrntdyfrtarutjqbc"
+cmp #-223, *r1
+L57: cmp X7, r4
+L58: not r7
+inc *r3
+clr L53
+L59: .data -248, 756, 614, -604, -983, 28
+prn #82
+L60: sub #212, r3
+L61: dec *r5
+red L86
+
+not r6
+L62: stop
+rts
+jmp X3
+jmp L3
+jsr *r2
+L63: .data 178
+; comment
+dec r6
+L64: mov L53, *r6
+bne X15
+L65: bne X21
+bne L183
+lea L130, L36
+prn L26
+prn r0
+bne *r4
+clr L11
+L66: add r7, r3
+bne L174
+; comment
+L67: red L12
+dec *r6
+L68: .string "qjzsbbywjwgpnzcuiudd"
+rts
+stop
+inc L167
+L69: .string "vcevzmcxxbhvtoxcsotlghtu"
+add *r3, L1
+L70: .string "qlu"
+L71: dec L64
+bne X14
+dec L50
+dec r5
+lea L216, r4
+mov r7, r3
+L72: .string "gzuxszsizflsfge"
+lea L115, *r4
+L73: dec X15
+stop
+mov r4, X14
+add r6, r6
+mov *r6, L200
+L74: prn X13
+dec r5
+
+L75: cmp *r7, r7
+mov *r7, r5
+; comment
+L76: cmp #-191, #-247
+stop
+L77: jsr *r1
+jmp L60
+L78: cmp #65, r0
+inc r1
+cmp *r0, r5
+red r6
+sub #32, X21
+L79: .string "vjzkddba"
+L80: .string "ijhhkaxqomvjvkwn"
+L81: jsr L262
+L82: inc r5
+bne *r3
+not *r7
+rts
+prn L61
+
+L83: .data -133
+jsr *r0
+L84: .data -109
+mov #-239, *r0
+add #-31, *r3
+inc X17
+L85: .string "eacriillbhhsyoznaebhz"
+inc L214
+dec r7
+add *r5, L118
+inc *r4
+jmp *r7
+L86: .string "txkpt"
+red L55
+L87: not X13
+
+
+jsr *r4
+cmp #-43, X19
+L88: mov #-116, r6
+lea L44, L141
+stop
+L89: prn #4
+jsr L197
+lea L62, X14
+bne L182
+L90: .data -893, -752, -769
+clr *r5
+L91: cmp r4, L23
+lea L47, *r6
+rts
+stop
+mov r5, L71
+stop
+L92: dec r1
+L93: .data -588, 601
+L94: .data 944, -394, -632
+not *r3
+not *r1
+lea L138, r6
+sub #169, L94
+L95: jmp X23
+; comment
+L96: .string "kgzjzqsdozwkkroo"
+lea L81, *r6
+clr r1
+red L156
+sub *r1, r2
+L97: .string "hkvlczsifo"
+add r5, *r3
+L98: .string "sqtttsxdk"
+L99: inc r5
+bne L208
+clr r1
+add #-27, r0
+not X0
+rts
+L100: add #-34, r1
+red r3
+jmp X24
+jsr *r5
+L101: sub #-92, r0
+L102: .string "ryixymhasapx"
+L103: .data -574
+L104: not r0
+jmp L127
+add L38, *r7
+rts
+L105: stop
+sub #-7, L78
+inc X10
+not L104
+lea X20, L30
+L106: jsr *r0
+L107: .data -587, 280, -947
+prn *r6
+mov *r5, *r5
+jsr *r0
+prn r2
+bne *r0
+clr r1
+sub #166, *r3
+jsr L201
+L108: cmp #86, #-40
+jmp *r5
+bne X19
+prn #-65
+sub *r2, *r4
+lea L75, *r2
+mov #0, X10
+jmp *r0
+red r2
+lea L24, *r4
+mov r3, *r5
+add *r2, *r3
+rts
+L109: add *r0, X7
+jmp *r2
+cmp #145, #209
+prn r3
+jmp *r6
+red X4
+lea L0, X21
+clr *r3
+L110: jmp L268
+red r5
+jmp *r2
+stop
+rts
+rts
+not *r7
+jsr L16
+red *r7
+L111: inc *r4
+prn r5
+not r3
+add r1, r3
+mov r5, *r7
+lea L43, *r3
+L112: jmp *r5
+not *r6
+mov *r4, r4
+
+sub #84, r4
+inc L144
+L113: red L191
+red *r4
+mov r3, L0
+not *r5
+L114: .data 460, 371, 418, -393, 457
+
+dec r1
+clr *r7
+L115: sub *r7, L193
+jsr X6
+L116: lea L39, *r4
+clr X17
+clr *r0
+stop
+red r4
+not X22
+L117: add #168, r7
+not *r0
+prn #-32
+dec L244
+jsr *r1
+L118: .string "edwzwmgytbpgbswruzjef"
+rts
+prn r5
+add #-20, L125
+L119: .data -408, -234, -452, -57
+L120: .string "tepo"
+sub r4, X0
+cmp r3, L209
+cmp r4, *r0
+red X2
+inc *r3
+bne X15
+jsr *r7
+bne *r2
+lea L110, *r2
+L121: cmp r2, *r7
+
+cmp r7, X8
+inc *r6
+sub *r5, *r2
+mov #23, L268
+L122: prn L23
+cmp #-212, r1
+prn *r4
+red L207
+L123: bne *r2
+dec *r0
+L124: inc *r2
+add *r4, L61
+mov r5, L180
+L125: jmp L105
+jmp L223
+clr X12
+not *r2
+L126: inc *r7
+inc L41
+jsr *r4
+L127: jmp *r0
+cmp *r3, r7
+lea L60, X3
+cmp #-153, r1
+L128: red *r1
+sub r6, r4
+L129: .data -208, 911, 776, 322, 188, 216, 270
+sub #183, *r0
+L130: add #7, *r5
+
+red r0
+L131: rts
+stop
+L132: not r1
+bne *r6
+; comment
+dec r7
+rts
+inc r6
+
+lea X22, X24
+add L6, L142
+L133: mov r0, L66
+cmp *r0, L169
+add *r2, r0
+; comment
+L134: stop
+
+dec *r0
+L135: rts
+rts
+L136: clr r5
+rts
+L137: lea L106, *r1
+lea L102, *r1
+sub #33, X8
+sub #-168, r0
+L138: .data -405, 895, -893, 310, -982
+bne *r3
+inc *r1
+jsr *r6
+stop
+L139: .data -305, -583, 973, 869, 631, 714, 16, 496
+
+L140: .string "xcybmnueyrryeoaqrxfb"
+rts
+red L228
+L141: clr *r4
+L142: .string "mycivzyhoquuuj"
+L143: .data 544
+L144: .data 801, -876, 451, 296, -574, 911, 927
+mov L41, r0
+cmp #-78, *r2
+not X22
+jsr L231
+L145: jmp L44
+cmp *r5, *r1
+prn L70
+mov X5, *r3
+L146: .data 932
+not r7
+add #-251, X22
+mov r4, r1
+sub L217, X8
+
+L147: dec *r6
+sub X8, X19
+jsr *r1
+clr *r2
+lea X9, *r5
+sub *r1, *r5
+L148: sub #-55, X13
+L149: .string "mlvrhnjjbofokvgwuej"
+L150: add r1, X23
+stop
+L151: rts
+jsr L53
+L152: dec *r6
+L153: jmp *r2
+cmp r2, #-193
+L154: .string "mm"
+inc *r5
+dec r5
+L155: prn #94
+rts
+mov #155, *r0
+L156: prn X22
+L157: clr r5
+inc r2
+L158: .string "majdqr"
+L159: rts
+inc L29
+add #73, r2
+inc X2
+stop
+prn X10
+clr r7
+stop
+L160: dec L187
+
+sub L47, r7
+L161: .data -464, 736, -942, 45, -897
+; comment
+red L203
+; comment
+add #144, r2
+rts
+
+rts
+clr *r0
+red *r7
+L162: .string "gxnwwegchfgjxnf"
+jmp L242
+dec *r5
+sub #103, *r7
+cmp r4, *r1
+rts
+L163: rts
+L164: jsr *r1
+red r0
+not X0
+lea L211, r1
+L165: .string "bmxzvt"
+jsr L144
+lea X22, *r5
+inc X13
+not *r3
+bne X10
+L166: .data -326, 754, 949, 693, -353, 927, 173, -606
+jmp *r4
+add X16, r1
+jmp *r6
+lea L201, L198
+red r7
+L167: jmp *r6
+L168: .data -161, -576, -448
+lea X13, r2
+inc X14
+cmp L200, #65
+stop
+lea X10, L247
+red r4
+red *r4
+cmp *r0, #-32
+mov *r3, L51
+prn L50
+sub L218, *r3
+add *r1, L252
+clr r5
+bne *r1
+L169: .string "hwmvnr"
+cmp #90, r6
+rts
+L170: .string "ghrewshymtniriponblv"
+stop
+add *r5, *r3
+inc r7
+prn *r1
+L171: .string "wlclkmhdirq"
+L172: inc *r1
+sub X15, X7
+add *r6, *r0
+bne L98
+L173: jsr *r1
+L174: .data -722, 827, -368, 660
+inc r7
+L175: clr L193
+; comment
+clr r6
+
+jmp X12
+sub *r2, L161
+mov *r0, *r1
+bne L194
+dec L183
+L176: mov *r5, *r6
+; comment
+dec *r3
+L177: not L80
+inc L115
+dec L77
+jsr L212
+inc r4
+mov #-114, X20
+prn X18
+lea L146, X16
+mov *r1, r0
+stop
+L178: sub *r3, r6
+prn L110
+sub r6, X14
+L179: .data 327, 980
+mov L51, *r0
+clr X6
+L180: jmp *r4
+inc *r5
+stop
+not *r3
+add *r7, *r6
+bne X3
+clr r4
+rts
+cmp #243, r6
+red *r1
+L181: clr L275
+cmp L197, #179
+not X5
+mov r0, L264
+L182: red L122
+L183: jmp L93
+not r3
+L184: .string "lihihnevhzzsect"
+stop
+sub #-198, r0
+clr L226
+add #-187, X9
+L185: .string "djivgsqwphu"
+L186: prn L123
+L187: .data 639, 815, -227, -533
+jsr L123
+L188: sub L256, X24
+L189: dec *r1
+add *r5, *r4
+L190: .string "los"
+jmp L223
+add L35, r7
+lea X21, *r7
+red r7
+
+rts
+L191: mov X16, L157
+L192: dec r7
+clr X9
+add *r0, *r6
+L193: cmp #15, *r3
+; comment
+bne *r2
+cmp *r4, *r1
+mov X21, *r1
+dec L31
+prn X15
+dec r3
+bne L210
+
+red X6
+
+bne *r4
+jsr L205
+rts
+mov #-90, r4
+jsr *r1
+L194: mov X24, r2
+dec *r1
+dec X13
+add L240, *r6
+inc r7
+mov *r6, *r5
+prn L257
+inc r6
+dec X5
+L195: inc L259
+mov r2, L37
+sub #-141, *r5
+L196: .data 84, -365, -897, 200, 339, 231
+dec L254
+not r6
+jmp *r6
+L197: jsr L106
+L198: .data 346, -405, 998, -338, -491, -787, -675, -159
+inc r2
+cmp #-71, X19
+L199: .data 668, 446, -503
+L200: .data 148, 329, 424, 390, -864, 456, -164
+jmp *r7
+L201: add r5, r6
+jmp X16
+mov #-93, L153
+L202: .string "dcvmdjwhtiyihi"
+clr r0
+sub *r0, r3
+L203: bne *r6
+jmp X2
+cmp r3, r3
+clr r4
+prn r7
+prn #-182
+dec *r1
+clr *r1
+L204: add #-67, *r2
+add X11, r4
+red *r3
+inc X7
+dec r5
+add #111, r2
+prn *r3
+
+rts
+mov r1, *r2
+clr r1
+prn #143
+sub *r4, *r2
+jmp X3
+clr r4
+clr *r5
+stop
+jmp *r3
+red r5
+prn L245
+L205: .string "s"
+cmp X7, r1
+L206: jsr *r5
+lea L222, r6
+inc *r7
+add #32, r3
+add r6, r2
+prn L235
+clr *r7
+jmp *r2
+sub #-248, L117
+
+cmp r1, *r5
+L207: dec r6
+rts
+lea X1, r7
+L208: not *r2
+L209: bne L68
+L210: .string "czekqbek"
+L211: clr X17
+
+jmp L202
+not L104
+jsr *r6
+sub L132, r7
+clr *r1
+clr L50
+dec *r2
+
+mov #-96, r3
+L212: cmp #-148, *r7
+jmp *r5
+L213: not L61
+L214: rts
+bne *r0
+L215: jsr *r6
+L216: cmp r7, L271
+not L252
+L217: .data 639, -195
+L218: .string "qvots"
+mov #-198, X1
+L219: dec X20
+red r4
+mov X18, r5
+; comment
+L220: red L231
+L221: .string "lhizxgfcmtlyugfnsria"
+L222: inc *r0
+L223: jsr L263
+red X3
+red L225
+L224: jsr *r4
+
+L225: .data 678, -236
+red L243
+rts
+L226: clr r7
+jmp *r1
+jmp *r7
+jsr *r6
+; comment
+cmp r7, X10
+L227: .data 125, 666, 759, -785, 299, 485
+sub X18, L218
+L228: rts
+rts
+bne X2
+sub X18, *r1
+prn *r6
+prn #-20
+L229: sub *r7, r0
+dec *r4
+rts
+inc *r2
+jsr L247
+cmp r6, L244
+stop
+cmp r6, *r5
+jmp *r5
+stop
+not *r6
+stop
+L230: jmp L236
+add #-3, r4
+inc r1
+red X5
+add *r7, *r4
+sub #86, L28
+L231: mov r4, r7
+lea L255, X14
+lea X16, X10
+L232: jsr X9
+jsr L269
+mov r1, *r3
+L233: lea X15, r7
+not X0
+rts
+L234: prn #-187
+dec L260
+cmp L28, #85
+add X8, r6
+cmp L39, X14
+L235: mov #201, r4
+not *r3
+sub #-5, *r2
+prn r0
+stop
+stop
+bne *r3
+lea L255, r3
+L236: dec X13
+not L272
+L237: add #-225, r1
+L238: .string "yerz"
+L239: .data 644, -809, 871, 678, 769
+L240: clr r7
+prn r3
+add #11, r5
+jmp *r3
+sub L213, r6
+L241: .data 931, 306, -283, -716, 179, -902, 262
+clr *r1
+clr X16
+inc L245
+prn #-32
+stop
+
+L242: dec X13
+L243: dec *r5
+stop
+clr *r4
+; comment
+cmp *r4, #36
+mov L267, X2
+L244: inc *r6
+stop
+clr r1
+lea X14, *r4
+L245: dec L275
+sub L137, r1
+inc r2
+lea X13, r5
+L246: inc L248
+L247: .data 499
+L248: .string "ecpzbztqjworumx"
+clr L266
+L249: .string "pqejexnwjyju"
+bne *r5
+L250: lea X10, r7
+clr *r2
+dec *r1
+rts
+add #-35, *r2
+add X11, *r4
+add *r2, L268
+jmp X16
+L251: sub *r1, *r0
+not L163
+add L49, r6
+jmp *r5
+L252: bne *r2
+rts
+sub L273, *r0
+dec *r7
+clr *r3
+L253: dec L272
+rts
+L254: lea L271, *r3
+L255: .data -220, 115, 542, -844, 287, 568
+L256: sub *r5, *r5
+L257: .string "zrvwysasjbkwclmmhm"
+bne *r5
+red *r1
+sub r0, r6
+L258: not r0
+cmp L244, r4
+bne L102
+L259: inc *r6
+stop
+red X14
+L260: inc L187
+rts
+L261: lea L77, r3
+prn L112
+bne X1
+L262: inc *r4
+add #243, L275
+bne *r2
+clr L270
+stop
+dec *r2
+L263: stop
+prn X11
+prn #-169
+
+rts
+jmp *r2
+mov *r5, r2
+L264: jsr *r1
+L265: stop
+sub L273, r7
+L266: clr *r6
+dec X7
+mov L245, *r5
+dec *r4
+inc r5
+prn #223
+bne L276
+sub *r0, X16
+add r3, X2
+sub *r4, *r7
+rts
+stop
+L267: dec X3
+lea L111, r3
+lea X14, L166
+lea L270, r2
+add #164, r2
+not X12
+rts
+L268: .data -159, 361, 178, -912, 354
+red *r4
+jsr X23
+L269: lea L46, r1
+jmp *r7
+cmp L128, L160
+not L274
+jmp *r3
+not r4
+mov #-53, *r5
+L270: clr *r2
+bne *r6
+red *r2
+clr *r3
+cmp X2, L276
+L271: add *r1, *r7
+not L204
+prn r3
+dec r4
+jsr X24
+jmp *r6
+stop
+rts
+L272: .data 662, 473, -284, -288
+mov L181, L276
+cmp L48, #87
+L273: .string "ywfeeslwwiujpwwitj"
+rts
+
+L274: .string "zjcjpfe"
+L275: .string "ijdhuyecpudkjzuwf"
+L276: clr X6
+mov r0, *r1
+stop
+not r1
+stop
+stop
@@ -0,0 +1,1045 @@
+; Generated by genCorpus --seed 55
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+L0: cmp #-166, #104
+jmp *r6
+cmp L0, *r1
+L1: sub #-178, L192
+; comment
+L2: sub #51, r6
+rts
+jmp *r4
+L3: rts
+L4: jsr *r0
+add X16, L4
+L5: inc L3
+not L4
+L6: .data 792
+cmp L102, *r5
+inc *r1
+L7: .string "uxucynnbjbpchsifybms"
+L8: dec r7
+L9: jsr L46
+stop
+stop
+cmp #76, L4
+L10: .data -883
+L11: rts
+clr r6
+inc *r1
+L12: jsr L86
+bne *r0
+L13: add *r1, X20
+lea X14, L4
+bne L6
+L14: jmp X13
+sub #221, r0
+jmp L151
+L15: .data -893
+red X3
+; comment
+rts
+L16: .string "wwaftpzkiawiquzh"
+bne L0
+L17: inc r3
+L18: mov r1, r6
+rts
+rts
+L19: .data -857, -119
+not *r0
+lea X14, *r6
+red L9
+bne *r2
+lea X2, r4
+jsr *r5
+bne L2
+jsr L138
+L20: not X0
+L21: .data -395, -961, 670, -605, -1, -554, -33
+red L0
+rts
+not r5
+jsr *r4
+bne X15
+L22: lea L207, *r3
+bne X11
+bne L18
+stop
+L23: mov *r5, L6
+L24: .string "g"
+L25: stop
+L26: cmp *r1, #-250
+add *r7, *r2
+rts
+L27: lea X1, L230
+jmp X23
+not r5
+clr *r7
+red *r1
+bne L160
+L28: inc L264
+L29: .string "ssdngebcwzjlkzrfpkep"
+sub *r1, L75
+add #-43, *r2
+L30: add *r2, L12
+L31: .data 69, -619, 264
+L32: stop
+clr L36
+cmp r3, X15
+mov r3, L24
+L33: rts
+prn *r4
+add r7, L132
+bne X21
+inc *r6
+cmp r6, X10
+L34: .data -527, 246, -909, 831, 720
+inc L1
+cmp L115, *r0
+prn L175
+L35: .string "bcyfzmtrlgauvhqewkzaiby"
+add *r0, r0
+add *r7, *r0
+red r4
+add #69, *r7
+not L26
+; comment
+
+clr L239
+L36: sub L29, *r3
+lea L29, *r5
+red L155
+stop
+
+L37: mov L185, r2
+rts
+jsr X12
+mov r1, r4
+L38: .data 94, 7, -61, -803
+not L86
+stop
+sub r5, L18
+jsr X3
+; comment
+L39: bne *r7
+cmp *r2, X4
+L40: mov L181, X20
+jsr L180
+; comment
+bne *r0
+L41: add *r0, *r4
+L42: .string "btcyek"
+add *r0, L11
+inc *r6
+L43: sub L6, *r5
+L44: dec *r3
+not X12
+clr X10
+L45: .string "yk"
+L46: .string "xz"
+dec r1
+rts
+clr r7
+L47: mov L12, *r1
+mov r4, r3
+add *r6, X6
+clr r5
+clr X15
+L48: .data -941, -151, -819, -814, 90
+prn r3
+; comment
+L49: .data 628, -500, -790
+prn X16
+rts
+dec X13
+sub r6, *r5
+lea L26, L237
+cmp r0, L87
+L50: jsr *r2
+rts
+L51: lea X2, *r4
+jsr L246
+sub X23, *r4
+L52: clr r3
+L53: .string "vjsdtllpznb"
+rts
+L54: .data 69, -257, -767, -634
+red r3
+
+L55: .data -481, -422, 127, 401, -81, -277, -3
+prn r7
+cmp #117, *r5
+L56: .string "riauavddhxiag"
+red *r1
+lea L48, *r0
+stop
+stop
+rts
+jmp L168
+lea L105, *r5
+add *r5, *r1
+L57: dec L13
+L58: prn r4
+L59: .string "jptlwgmdyttv"
+stop
+L60: add r6, L26
+L61: .string "awpxdiaylszqmvaxwm"
+sub X21, *r1
+L62: bne *r5
+L63: .string "sqndygrjyi"
+dec L53
+dec r5
+
+bne X0
+
+red L194
+dec *r1
+L64: inc r3
+sub #-223, *r5
+; comment
+L65: sub *r7, r0
+stop
+L66: dec L272
+not L5
+dec *r3
+dec r5
+dec L270
+L67: .string "ninuiza"
+cmp X16, X23
+L68: .string "vrcw"
+jsr L67
+L69: add *r5, *r5
+stop
+clr r4
+clr L225
+sub X22, X23
+mov L2, r7
+L70: rts
+inc L21
+mov L209, X19
+stop
+add r5, r1
+add #25, L104
+jmp *r0
+add r0, *r1
+not X18
+stop
+L71: .string "lnx"
+jmp L30
+L72: clr L4
+L73: stop
+add r3, L40
+prn *r3
+add r4, *r1
+add *r0, r2
+dec L147
+L74: .data 710, -429, 663, 463, -176, -446
+L75: sub #74, r3
+lea X16, r6
+rts
+dec X9
+prn X17
+sub r2, *r7
+L76: lea X3, *r7
+add #16, L79
+L77: .data 251, 255
+jmp X9
+red L23
+not L6
+add *r6, r1
+jmp X9
+clr *r5
+dec r4
+
+stop
+dec r4
+dec X4
+L78: cmp L114, X8
+add #-90, r3
+inc L165
+red L140
+cmp L27, #-216
+rts
+L79: cmp #17, L64
+
+L80: mov r6, X15
+add r7, *r0
+lea X17, L30
+bne L41
+rts
+L81: sub #-175, L248
+not X12
+L82: lea L44, r5
+L83: add r2, *r2
+L84: prn L22
+clr X5
+rts
+cmp r3, r2
+lea X2, *r4
+L85: add r4, r0
+not *r1
+jsr L194
+sub #-125, L39
+prn *r6
+L86: .data 269, -733, -974, -238, -408, -811, 963
+rts
+L87: clr r1
+bne *r5
+clr X8
+L88: cmp r6, r7
+bne *r0
+jmp *r1
+L89: .string "bjzxuxqyujrsfjxhp"
+L90: mov L206, *r3
+prn *r5
+L91: stop
+L92: dec r6
+sub *r7, *r1
+bne *r6
+dec *r7
+sub r2, r5
+rts
+sub #-179, *r2
+inc r2
+rts
+L93: jsr *r4
+add *r5, r3
+bne *r0
+
+prn r4
+clr *r1
+L94: inc *r6
+L95: red r3
+L96: cmp #154, #-12
+lea L49, *r7
+red L44
+L97: .string "obglvduxtchjeqaxgmizcfhd"
+add #-88, r7
+rts
+inc X17
+mov *r0, *r1
+bne X3
+L98: rts
+lea L99, L36
+jsr *r4
+L99: red r4
+add r0, *r0
+inc *r1
+L100: jsr X21
+mov #-216, r3
+L101: .data 825, -696
+clr r0
+L102: bne X2
+not *r6
+clr r3
+inc r6
+dec *r2
+jmp L108
+prn *r0
+red L151
+L103: .string "xuscrl"
+not *r3
+dec X8
+not r7
+add #-82, r2
+jmp L213
+L104: jmp X4
+prn L38
+L105: jsr L195
+L106: sub *r4, X13
+L107: clr X16
+L108: sub *r3, r7
+prn r2
+cmp X4, r3
+prn X15
+L109: cmp #-234, *r7
+L110: .string "ajiu"
+add *r7, L246
+; comment
+L111: .data -360, -85, 970
+inc *r6
+L112: mov #-247, *r1
+add r2, *r0
+prn L94
+
+cmp r3, L260
+stop
+L113: red *r2
+jmp *r0
+L114: rts
+jmp X9
+inc *r7
+L115: jmp L145
+add *r7, X16
+mov r5, *r6
+jsr *r6
+jmp *r2
+prn L91
+dec L9
+not r7
+rts
+stop
+clr L41
+red *r0
+add #24, L218
+jsr *r1
+cmp L126, #-55
+add X21, L71
+dec *r3
+dec *r5
+lea X9, X2
+rts
+L116: prn X3
+sub X4, X3
+jmp L10
+L117: prn X12
+prn *r6
+lea L112, r1
+prn *r0
+rts
+jmp *r3
+mov *r1, *r3
+; comment
+jmp X12
+inc r7
+mov L40, X23
+add *r2, r2
+; comment
+
+mov #99, r3
+L118: rts
+; comment
+L119: .data -648
+mov #213, r3
+L120: .string "gc"
+mov r4, *r3
+L121: add *r5, L277
+L122: mov r2, *r3
+L123: jsr L77
+prn L92
+dec L251
+L124: bne *r0
+jsr L224
+stop
+jmp *r4
+jmp *r3
+clr X1
+L125: clr X1
+L126: .data 379, -179, 484, -473, -412, -948, -958
+jsr *r6
+not r6
+L127: jmp L221
+dec X12
+add #80, L244
+L128: cmp *r5, #-163
+jmp *r7
+clr *r6
+bne *r7
+inc *r2
+
+add r1, X12
+L129: stop
+sub #-163, r2
+not *r4
+rts
+prn L267
+L130: inc r0
+dec *r7
+mov *r0, *r6
+sub r1, r6
+sub r7, L271
+L131: .string "utuitujhytrvwpckyydaaz"
+L132: lea L51, r5
+stop
+clr r0
+jmp *r3
+stop
+L133: .string "wuww"
+lea L28, *r7
+dec L251
+lea X10, *r0
+rts
+L134: cmp L201, L38
+
+cmp #106, *r3
+jmp *r6
+L135: red r3
+jsr L98
+jsr L256
+dec *r6
+sub #-226, *r4
+; comment
+cmp *r1, L57
+inc *r0
+sub r0, L242
+cmp #-47, *r6
+L136: .string "sstakryeyzhwntyaaujkn"
+inc r6
+L137: prn L273
+L138: .data 138, 562, -87, 954, 866, -380, 787, -658
+prn *r7
+not *r1
+stop
+add r7, r2
+clr *r6
+red r5
+L139: red r5
+bne *r4
+not X16
+jmp L185
+L140: .data -604, -108, -236, 222, -301, 922
+L141: .data 386, 368, -847, -611, 182, -140, 153
+sub X23, r3
+; comment
+not *r2
+sub r0, L245
+add X11, r3
+L142: cmp #146, *r1
+prn L54
+
+L143: .data 312, 869, -592, -18, -385, -709, -869, 185
+cmp L59, L32
+stop
+bne *r6
+L144: .data -712
+bne *r0
+add r2, *r4
+inc r6
+mov *r3, *r3
+not L160
+L145: .string "morksf"
+cmp #94, r0
+L146: stop
+jmp L33
+rts
+; comment
+rts
+dec r6
+lea L232, *r1
+prn r6
+rts
+stop
+jmp *r3
+L147: .string "knqjyl"
+bne X13
+rts
+jsr *r3
+L148: add r0, *r2
+stop
+cmp r5, *r1
+L149: sub r3, L71
+cmp *r3, L240
+stop
+lea L235, L218
+L150: .data -722, -531, 689, -653, -913, 479
+mov *r1, *r5
+; comment
+L151: mov r1, L90
+jmp *r3
+jmp *r2
+
+L152: add #-172, r6
+jmp L261
+L153: red r4
+lea L160, r1
+jsr L43
+L154: not r3
+inc L167
+rts
+rts
+L155: jsr *r4
+red X14
+not L168
+not *r2
+
+L156: lea L223, *r0
+cmp *r1, *r0
+L157: .string "bcmoyjt"
+L158: inc r0
+
+add r4, *r1
+inc X24
+rts
+lea L280, *r5
+dec L142
+; comment
+L159: cmp *r1, *r1
+cmp r6, *r4
+cmp r0, #155
+rts
+L160: jsr *r3
+clr r1
+add *r3, X10
+jmp L273
+L161: .data -757, 2
+clr L222
+L162: stop
+add r7, X13
+stop
+inc X23
+L163: .string "fcbrd"
+clr r4
+stop
+jmp *r5
+L164: .string "bwxrrhhfpskmfcghjrqn"
+clr r7
+L165: jsr L242
+prn r2
+sub #212, *r2
+
+not r7
+L166: jmp L42
+mov *r3, r5
+L167: mov *r7, *r0
+
+L168: inc X8
+mov #-1, r3
+sub r5, *r0
+not r3
+L169: cmp L105, r5
+L170: prn *r7
+L171: clr *r1
+clr r2
+jmp L74
+L172: mov #-119, *r0
+not L201
+red r5
+L173: .data -569, 621
+cmp X2, *r5
+dec L279
+L174: cmp X4, r6
+jsr *r4
+stop
+L175: dec *r7
+L176: .data -926, -274, -16, 425, 537
+dec *r1
+mov *r2, r7
+mov #-26, X18
+clr *r6
+stop
+prn r6
+jmp L85
+dec X17
+red r5
+jmp *r7
+L177: prn #133
+lea L171, L217
+jsr X9
+L178: .data -25, 533, -880, 661, 167, 26
+inc r4
+jsr X3
+jsr *r0
+L179: mov #205, *r5
+red *r6
+L180: sub *r4, L208
+L181: clr r2
+red r6
+add X9, L260
+L182: add *r7, r1
+L183: red *r6
+L184: add #112, r3
+not r7
+L185: add #130, L51
+L186: cmp #-251, L67
+rts
+red *r1
+add #94, r7
+bne L70
+jsr X0
+L187: .string "bnsjnsjqfichpqlvjjtfbqk"
+red *r2
+not *r4
+cmp L222, L203
+L188: .data 339, -297, 179, -370, -785, -650
+L189: dec r7
+not r4
+lea L223, L8
+dec r0
+mov L195, *r7
+inc *r6
+mov r5, L255
+L190: .data 83
+prn r5
+L191: sub X11, r5
+dec *r1
+L192: .string "ctodmdzjn"
+bne X21
+L193: cmp L247, r7
+prn r6
+
+cmp X11, #161
+jmp *r2
+L194: .string "oxvmqbunknqlyyv"
+L195: .string "dgrqzuv"
+lea X7, *r1
+lea X0, r2
+cmp r0, *r0
+red L42
+L196: prn *r0
+jmp *r3
+sub r5, *r0
+L197: .data 923, -86, 530, 853, -697, 97
+L198: .data 521, 454, 560, 314, -769, 583, 489, 541
+inc r2
+L199: lea X2, r0
+L200: cmp #-83, *r5
+add L273, L62
+lea X3, *r1
+jsr *r3
+lea L112, *r2
+jsr L236
+add X8, X15
+cmp X20, X3
+clr r6
+stop
+L201: rts
+red X22
+cmp r7, r4
+clr *r6
+L202: .data -224, -3, 716, -102
+L203: dec r4
+
+L204: .data -231, 40, 112, 836, 465
+L205: lea X24, r1
+rts
+sub *r3, r6
+L206: red r5
+stop
+not r5
+L207: mov #114, L122
+bne *r6
+lea L46, *r3
+L208: mov #-57, L117
+L209: red r2
+sub #-124, *r4
+L210: inc r4
+L211: .data 343, -223, 823, 732, -370, -787, 368
+L212: sub #115, X19
+bne *r5
+L213: .string "grmajeprnloiagvegai"
+red *r1
+cmp L168, *r6
+jmp X0
+stop
+red r3
+dec r1
+mov #205, r5
+not L236
+inc *r7
+rts
+L214: sub #-110, L269
+
+stop
+prn *r6
+not r1
+bne *r1
+L215: cmp r4, r4
+prn *r7
+L216: lea L274, r2
+L217: .string "bjsivekzqw"
+add L177, *r7
+lea X3, *r2
+cmp X20, r3
+clr r4
+L218: not X23
+
+inc r5
+L219: clr L277
+; comment
+mov *r5, X6
+; comment
+L220: dec r4
+L221: .data 675, -887
+red r5
+L222: sub X20, r0
+L223: mov L51, r1
+bne L246
+; comment
+rts
+L224: dec r0
+; comment
+L225: bne *r0
+mov *r5, r0
+L226: sub L250, X2
+L227: sub r5, X1
+sub *r1, *r4
+sub #94, *r3
+rts
+jmp X11
+rts
+bne *r1
+clr *r0
+inc *r6
+sub r2, X24
+not *r1
+rts
+L228: rts
+dec L199
+dec X17
+add #-220, X12
+jmp X8
+cmp *r1, *r7
+L229: sub r3, X0
+red *r3
+red L197
+add *r6, X23
+red r3
+sub L264, L25
+L230: .string "iaqkehzusnwywioxkflfyc"
+rts
+L231: .string "fxat"
+stop
+; comment
+stop
+dec r1
+
+stop
+prn *r4
+dec L259
+
+stop
+lea X17, r5
+L232: sub #241, *r4
+clr r3
+stop
+clr r6
+
+cmp L144, #-156
+L233: cmp L81, X9
+jmp X6
+mov *r7, r0
+clr *r0
+dec r7
+L234: .string "fgsiqim"
+L235: not r4
+rts
+L236: bne *r2
+L237: inc r4
+; comment
+L238: jmp L45
+not r3
+sub r2, r6
+add r0, X19
+L239: jsr *r3
+bne L3
+bne *r7
+inc r3
+rts
+; comment
+prn #-232
+cmp *r2, r6
+stop
+stop
+cmp #175, #11
+L240: .string "iybmgujqwklktuewwzw"
+inc *r0
+stop
+cmp *r6, r3
+stop
+not *r5
+L241: mov #82, X19
+prn *r0
+stop
+bne L1
+dec r2
+red r5
+add X13, L146
+red r7
+inc r2
+clr r2
+L242: mov #146, *r2
+clr *r1
+clr r2
+L243: stop
+sub #111, L267
+lea L160, *r2
+L244: .data -38
+rts
+stop
+L245: jmp *r4
+rts
+lea L212, r7
+L246: add *r7, r4
+L247: red *r7
+red *r3
+prn *r6
+stop
+dec r7
+inc *r7
+
+L248: sub *r5, *r3
+L249: mov *r2, *r5
+rts
+not *r0
+cmp #-147, L126
+L250: jmp *r1
+jmp L266
+rts
+inc *r4
+dec *r3
+add #168, r1
+red r5
+
+jmp *r5
+jmp L37
+red *r5
+
+not L250
+red L147
+L251: .string "nldgnpcyytof"
+L252: .string "rpumvgza"
+L253: cmp r5, #-225
+jsr *r7
+lea X24, r6
+lea L263, *r6
+L254: .data 668, -615, 483, -9, 95, -370
+lea X15, L88
+stop
+inc L12
+jsr *r4
+not X14
+L255: jsr *r0
+L256: .data -248, -836, 601, 493
+L257: .data -404, 150, -29, 37, 45, 712, -903, 939
+L258: .data 198, 597, 370
+L259: .string "crxrtzymfwyldapufrz"
+jsr *r1
+clr r3
+cmp r3, r1
+L260: .string "sbc"
+sub *r6, r2
+dec *r2
+
+prn #-241
+not r4
+L261: jmp L246
+L262: rts
+red L35
+L263: .data -686, 898, 684, -576, -89
+rts
+red r7
+L264: inc L274
+red L269
+clr *r6
+clr r3
+bne *r0
+; comment
+red r2
+dec L274
+L265: .data -266, 214, -564, 923, -628, -337, 337
+jmp L269
+lea X19, L46
+L266: add #141, L17
+cmp X7, L276
+rts
+
+not r1
+L267: add X18, X3
+L268: prn #27
+jmp L62
+L269: mov r3, r5
+bne *r0
+L270: .string "jfkpkaezwpadx"
+red X5
+jsr *r7
+dec L121
+L271: mov X8, *r7
+not X23
+not *r7
+clr *r2
+mov X22, r5
+bne L117
+not *r7
+stop
+L272: rts
+prn #152
+clr *r3
+add *r6, r6
+prn r2
+jmp *r0
+dec r6
+rts
+not *r4
+; comment
+red r6
+cmp #-30, r2
+L273: .data -980
+L274: .string "termrjpm"
+stop
+; comment
+sub L278, *r6
+rts
+L275: dec L276
+add #227, r1
+inc L279
+clr L277
+stop
+clr X2
+cmp X17, X21
+lea L277, L170
+stop
+rts
+inc r0
+sub *r0, *r3
+L276: mov #131, L41
+L277: prn *r3
+not *r1
+bne L279
+L278: .data 246, -108, -153, -969, -393, -589, 915
+; comment
+lea L231, r2
+jsr X13
+add r3, *r6
+stop
+dec *r1
+jmp *r6
+jsr *r3
+dec *r1
+stop
+L279: mov *r5, L280
+jmp *r6
+L280: add *r7, L253
+lea L214, X5
+prn r2
+stop
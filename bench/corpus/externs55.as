@@ -0,0 +1,1044 @@
+; Generated by genCorpus --seed 56
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+stop
+sub #221, *r6
+dec X20
+
+L0: prn L241
+jsr L0
+lea X19, *r0
+L1: .string "mlh"
+; comment
+rts
+jsr L238
+red r3
+
+L2: .data 143
+L3: bne *r5
+jmp L22
+L4: .string "ywkqjwuadpdgnnhgkkdpgvqr"
+sub L0, *r7
+L5: .string "ikshycxozytjuuklobeqvcmk"
+L6: .data -174, 688, -393, 118, 436, -326
+add L2, L2
+; comment
+
+L7: jsr *r0
+L8: rts
+jsr X24
+lea X14, *r4
+dec r6
+L9: bne X11
+L10: bne *r3
+red *r1
+sub #-137, L10
+lea X7, r5
+jsr L113
+jmp *r0
+cmp r4, #-45
+L11: .string "f"
+clr *r1
+jsr L3
+; comment
+dec *r6
+rts
+add r5, r1
+bne *r5
+jmp *r4
+bne *r5
+not r0
+L12: add L4, *r5
+red *r0
+jmp *r5
+L13: inc r4
+inc L7
+prn *r5
+stop
+clr *r3
+L14: clr *r4
+L15: red *r5
+stop
+cmp #97, r7
+L16: .data 407, 52, -194
+clr r5
+jmp L2
+clr X24
+dec r0
+cmp X15, *r6
+dec *r3
+L17: jmp L11
+jsr *r2
+rts
+bne *r2
+; comment
+prn r4
+cmp *r5, #-247
+prn #167
+bne X7
+; comment
+jsr L36
+bne L1
+
+rts
+L18: prn #246
+jmp L13
+stop
+jsr X12
+cmp L195, *r5
+L19: .string "yshaxteyhpp"
+jsr X10
+cmp #120, #113
+lea L233, L84
+not X21
+sub X3, r5
+not *r1
+clr r5
+; comment
+red *r3
+lea X0, r5
+stop
+L20: .string "yaljlzbtk"
+prn #-74
+L21: rts
+L22: .string "pmbbqtxhltsvicrsnj"
+L23: dec X9
+red *r5
+rts
+L24: .string "sqxuxbnivmqngvqisyvigz"
+L25: .data 149, -835, -54, -387, -35, -391, -829
+stop
+cmp *r4, L141
+rts
+red *r3
+L26: red *r2
+jsr L167
+add #-135, L228
+dec *r6
+rts
+bne *r4
+inc *r7
+L27: clr r7
+cmp X19, L18
+inc X3
+mov L5, *r7
+L28: clr *r0
+stop
+bne *r1
+L29: .string "ihvjtw"
+not L47
+prn r6
+stop
+bne X6
+not *r1
+cmp L149, *r1
+not L1
+rts
+red L25
+rts
+L30: .string "gblzukt"
+L31: add r6, r3
+dec r1
+clr r3
+sub *r4, r3
+L32: .data -421, 984, -473, 157, -141, 469
+L33: .data -812, -60, 256, 24, -979, 958, 406
+dec *r1
+
+jsr X2
+L34: lea L240, X10
+jsr L22
+bne L73
+sub r0, *r4
+mov *r5, r4
+L35: .data -212, 963, 768, -916, 59, 960, -411
+inc r3
+not *r5
+L36: dec L27
+red *r6
+bne L170
+mov *r7, r2
+L37: dec *r4
+clr *r6
+cmp L13, *r5
+L38: jsr *r1
+L39: .string "dqycmzvabfefweqbevu"
+bne *r3
+L40: .data -776, 886, 652, -985, 419, 929
+lea X12, r3
+add *r4, *r0
+L41: mov X15, L12
+; comment
+red *r0
+; comment
+jmp *r2
+L42: rts
+rts
+red L39
+jsr *r6
+dec r2
+mov r6, *r0
+prn *r1
+jmp X10
+jsr X7
+; comment
+not r2
+mov *r7, L233
+L43: add #-101, X1
+L44: .string "xrsozk"
+dec *r6
+not r4
+rts
+inc *r0
+inc r5
+L45: jmp X24
+add *r5, *r3
+L46: jmp *r3
+clr *r5
+mov r7, L233
+bne X20
+not r2
+prn *r6
+add *r4, *r3
+jsr X14
+
+sub X0, *r2
+not L9
+stop
+sub X6, L45
+sub L206, r1
+clr *r3
+lea L30, *r2
+sub *r0, L233
+; comment
+bne L213
+rts
+mov *r6, r6
+jmp *r3
+jmp *r6
+L47: jsr *r7
+rts
+mov L108, L16
+lea X13, *r6
+L48: .string "pvpmmiznshds"
+not X8
+dec r4
+prn r7
+L49: .string "bjsslrzppmcpckxjwrzrl"
+
+rts
+bne *r0
+clr *r4
+clr r7
+L50: bne L151
+clr L201
+clr *r7
+prn X10
+L51: add X21, r2
+L52: clr r2
+dec r4
+stop
+clr r1
+cmp X2, L153
+bne *r3
+lea L86, *r2
+red *r2
+mov *r5, *r2
+clr L208
+mov #174, L6
+L53: not L171
+dec r6
+rts
+jsr *r5
+stop
+L54: .string "doqvkzcsovy"
+L55: .string "hqkgistot"
+; comment
+add L31, L3
+rts
+L56: .data -949, 226, -840, 531, 662, 231
+L57: .string "rofxalld"
+jmp *r3
+add #-203, L28
+L58: .string "xlfmmmbykqv"
+dec L23
+sub *r6, L20
+stop
+add *r6, *r2
+red r6
+sub X6, r2
+L59: jmp *r1
+sub X13, L43
+L60: .string "vnblztathiomwhjf"
+L61: lea L84, r2
+clr r2
+stop
+add #-100, *r4
+stop
+mov #-171, *r5
+rts
+prn r0
+L62: clr L21
+L63: .string "ocloisafieamygsyk"
+jsr X24
+inc *r7
+cmp L17, L121
+lea X17, r7
+dec L210
+mov *r6, X6
+dec *r6
+rts
+L64: dec r4
+cmp r1, #194
+; comment
+stop
+clr *r7
+stop
+L65: dec *r6
+cmp X5, *r2
+cmp #-78, #165
+jmp L112
+clr *r6
+cmp r7, L33
+add L164, r7
+lea L207, r7
+jmp *r2
+jmp *r4
+
+dec L100
+not *r1
+
+clr r1
+stop
+L66: .string "a"
+lea L56, L79
+clr L154
+clr r2
+jmp X14
+cmp r1, r0
+prn *r4
+L67: .string "ttanzsvvciniidk"
+lea L232, L112
+add *r1, r4
+bne X19
+L68: bne X23
+L69: add *r6, r2
+not L162
+mov r7, r1
+sub L119, r5
+L70: red *r6
+rts
+L71: .data 11, 525, -731, -144, 889, -802, -651, 931
+clr L107
+bne L150
+clr L22
+red *r2
+prn r4
+lea X7, *r0
+L72: prn r4
+L73: .string "mp"
+L74: cmp #204, r5
+clr X6
+rts
+clr r6
+L75: stop
+; comment
+lea X23, X24
+sub r3, r7
+sub #-179, L217
+L76: .data -812, -26, -320, -806, 13, -33, -844
+lea L196, X2
+prn r2
+not r0
+jsr L2
+prn #126
+mov *r2, *r7
+L77: .string "rmzafubgs"
+add *r2, *r2
+L78: jsr *r5
+sub X3, r0
+jsr X6
+L79: rts
+dec *r4
+add L106, *r5
+inc *r1
+jmp X19
+; comment
+red *r7
+jmp *r7
+not *r0
+; comment
+not *r3
+L80: red *r4
+jmp *r7
+L81: .string "rghhusaqwerstkdikgzibvb"
+L82: .data -218, 902, 624, 606
+stop
+L83: prn L90
+mov *r3, r3
+L84: bne L110
+red r4
+stop
+bne *r7
+not L111
+jmp *r2
+bne *r2
+dec r4
+L85: .data -477, -984, 119, 778, -511, 669
+L86: .data -112, 917, -651
+L87: cmp #-155, L48
+red *r1
+L88: mov #131, X2
+L89: .data 552, -483, -619, 695, 635
+stop
+not *r5
+lea X19, *r4
+L90: inc *r3
+prn L92
+jsr *r2
+jsr L135
+L91: .data -323, -341, 233, 315, -239, 336, -571
+red *r3
+jsr L69
+red L131
+; comment
+sub X11, r4
+mov X16, r7
+L92: .data -990, 205, -840, 188, 125
+prn X17
+L93: .string "xpehmbvtn"
+add L120, *r0
+inc X21
+L94: jmp X12
+L95: .data 93
+prn X5
+mov #-128, *r7
+clr L59
+prn L216
+add r5, *r3
+mov L200, L73
+lea L231, *r0
+L96: rts
+
+clr *r6
+
+L97: .data 48, -640, -690
+jsr *r6
+L98: jsr *r5
+bne L113
+stop
+dec r4
+red r0
+lea L130, *r2
+jmp *r5
+not r3
+inc X2
+L99: inc L136
+jmp L24
+L100: add r6, L129
+not *r0
+L101: .data -102, -656, -766, 343
+jsr L68
+jmp *r4
+inc L155
+jmp L64
+L102: mov *r1, X6
+L103: dec *r7
+rts
+L104: .string "ulhpyf"
+rts
+cmp #141, *r0
+dec X20
+lea X10, *r1
+prn #-44
+
+L105: rts
+L106: rts
+mov r5, r6
+jsr *r6
+L107: cmp #-39, #117
+inc L150
+lea L139, *r0
+L108: .data 817, -192, -145, 53, -458, 984, -136, 738
+L109: clr r2
+jmp X9
+red r4
+L110: .string "fcypdrwgmjstxcfkdjhwveas"
+jmp *r3
+
+bne *r3
+
+L111: mov r2, X9
+L112: jsr L50
+rts
+stop
+L113: red X11
+bne X0
+bne *r5
+L114: prn L86
+add *r3, r0
+rts
+L115: inc *r0
+cmp L67, r5
+stop
+prn L157
+lea X14, r3
+dec *r7
+jmp *r7
+red *r0
+L116: .data -494, 594, -361, 226
+L117: red *r7
+not *r2
+prn *r5
+L118: red r5
+L119: red L8
+jsr X4
+red r6
+L120: .data 641
+cmp r1, #-43
+inc *r4
+inc r6
+inc L159
+L121: .data -51, -695, -214, -225, -219, 977, 183, 847
+mov L256, r6
+lea X18, r6
+sub X14, r3
+L122: .string "n"
+L123: not r3
+sub #-183, r4
+inc L135
+L124: .data -672, -733, -932, 872, 257, 927, 694
+add #-188, *r7
+stop
+cmp L6, #-213
+L125: clr *r3
+L126: jsr X18
+jmp L175
+rts
+stop
+jmp *r5
+red r3
+L127: jmp *r3
+jmp *r0
+jmp X21
+L128: red *r5
+jsr X11
+jsr L55
+stop
+not *r3
+jsr L182
+jmp L28
+inc r1
+L129: .data -415, 341, 967, -110, 195, 925
+dec r1
+lea X17, X16
+dec *r1
+
+rts
+L130: sub *r1, X3
+L131: dec *r7
+L132: .data -228, 120, 76, -418, 963, 756
+dec X21
+red X7
+cmp X19, *r1
+red *r6
+rts
+jsr *r1
+prn X13
+lea L137, r6
+L133: bne L86
+L134: not r0
+dec *r5
+clr *r0
+rts
+cmp #-22, #-9
+dec *r5
+cmp *r1, X22
+jsr *r7
+L135: bne L115
+dec L26
+L136: .data -301
+rts
+prn L210
+L137: jmp *r1
+clr L57
+sub *r2, *r0
+add L97, *r2
+sub #51, L221
+rts
+
+lea X5, *r7
+prn r2
+dec L64
+jsr X23
+mov *r4, L86
+dec *r4
+not r7
+sub L30, r5
+L138: .string "zhhf"
+not L232
+jsr X11
+sub r3, L54
+lea L53, L144
+; comment
+not L70
+prn X14
+L139: rts
+L140: prn #-207
+not r7
+jsr L44
+L141: mov *r0, r2
+lea X18, r6
+mov *r5, r7
+L142: bne L241
+add X21, *r1
+stop
+clr X18
+
+L143: .data -462, -422
+sub #-226, r6
+L144: inc L73
+L145: .string "cstlowybumknynozmyqt"
+L146: mov #187, L103
+rts
+prn #14
+stop
+L147: .data -55, -640, 61
+L148: .string "xlghzgbzcizdxuytgzonmak"
+lea L207, *r3
+prn #29
+sub L96, *r1
+jmp L246
+not X12
+clr L248
+cmp *r4, r7
+lea L254, L158
+bne L177
+; comment
+L149: .string "prpwby"
+cmp #106, r6
+rts
+cmp X14, *r5
+rts
+clr r7
+jmp L0
+dec r1
+jmp X24
+stop
+cmp X5, L17
+L150: bne X5
+cmp *r1, L18
+
+dec *r6
+lea X8, *r4
+L151: inc r4
+red r0
+L152: .data -544, -748, -643, 898
+prn #122
+jmp X15
+lea X4, r6
+
+clr L231
+clr *r6
+sub #-44, *r4
+red *r1
+L153: jmp L64
+inc r2
+jmp L238
+stop
+stop
+mov *r0, L162
+L154: .data 259, 929, -378, -43, -324, -795, 600, 279
+sub r1, *r6
+sub #34, r3
+bne *r1
+jsr X7
+cmp *r3, *r6
+dec *r4
+jsr L181
+add #154, r3
+stop
+jsr L156
+stop
+L155: add *r4, r7
+L156: stop
+lea L208, *r0
+L157: jmp *r7
+not r0
+cmp X16, r0
+mov *r6, r1
+bne L180
+jsr X20
+stop
+not *r1
+L158: clr r4
+L159: mov *r6, r2
+cmp L52, *r1
+inc *r4
+L160: .string "wumtyxpxkfq"
+L161: add *r0, r2
+L162: .string "pojsw"
+inc r0
+prn L239
+
+cmp r2, *r1
+L163: jsr *r6
+lea L96, X13
+sub L189, r3
+L164: .string "uqvcgslbuwwzykmbkofdht"
+inc X3
+jmp L169
+
+lea X7, X9
+clr *r7
+L165: .string "tioanrjm"
+cmp L95, #-130
+jmp X5
+L166: .string "wvnagnyxhfwbncg"
+bne L208
+prn r7
+cmp *r5, L164
+not *r1
+dec L174
+bne *r5
+stop
+add *r0, *r6
+L167: prn L84
+cmp #-25, *r6
+bne *r7
+; comment
+prn L185
+inc L188
+jsr *r0
+L168: sub *r1, *r1
+rts
+L169: add #231, *r7
+rts
+L170: .string "pmpfnrspn"
+mov r2, L201
+inc r1
+L171: .data 729, 425, -52, -921, -576, 876
+L172: lea L22, L237
+add *r7, X13
+
+jsr X16
+L173: jmp *r0
+L174: mov X0, L182
+inc *r7
+L175: .data -29, 126, -246, -825
+L176: inc r2
+L177: stop
+inc X16
+rts
+clr L84
+mov #-256, r3
+lea L136, r0
+prn L227
+dec *r0
+lea L172, *r5
+jmp L106
+clr r3
+mov X10, *r4
+L178: .string "bytfaihdoigxcizbf"
+L179: .string "paamindlptqe"
+; comment
+clr *r7
+lea X7, *r2
+prn r1
+add r6, r3
+clr *r0
+L180: .data -207, 821, 622, 625, -997, 110
+L181: .data -459
+jsr *r4
+L182: prn L36
+inc r6
+L183: jsr X17
+L184: inc L212
+stop
+red r1
+stop
+sub *r6, r6
+stop
+L185: jmp *r0
+inc L18
+L186: mov r0, r1
+add r4, r4
+sub r7, L187
+inc X11
+inc *r0
+L187: not r3
+cmp *r4, #-255
+red r1
+L188: .data 301, -158
+
+not *r7
+stop
+bne *r3
+; comment
+add r5, L205
+rts
+cmp #-193, *r7
+L189: lea X18, X22
+red L211
+bne X21
+L190: cmp #166, *r4
+cmp L238, X12
+L191: sub #165, r5
+L192: mov #-91, L202
+not X19
+add #109, r0
+cmp L63, r5
+mov r2, L38
+L193: stop
+add #-137, *r6
+jsr X12
+jsr *r1
+inc *r6
+L194: red *r7
+L195: lea X15, r0
+clr L73
+add *r3, L217
+jsr L209
+jsr L69
+add #221, *r2
+L196: bne *r3
+mov #-220, r0
+L197: .string "awcxwbqifiyccldqiatsby"
+bne *r2
+rts
+lea L210, L219
+L198: .string "iu"
+L199: red *r7
+mov *r0, *r3
+rts
+sub L241, X16
+add #129, X14
+stop
+L200: bne *r3
+L201: not *r3
+rts
+clr L81
+L202: .data -206, -52, -159, -154
+inc *r3
+inc *r7
+stop
+clr *r5
+prn *r7
+add #-208, *r0
+prn L29
+not r0
+L203: jsr *r5
+L204: .data 934, 89, -620
+prn *r4
+L205: bne *r5
+cmp #62, #92
+mov L125, L209
+; comment
+L206: cmp *r5, r6
+L207: .data 515, 78, 441, -650, -133, -426, 202, -917
+not *r7
+prn *r2
+L208: .data -127, 137, 570, 26, -748
+L209: .string "gujrubwdhefltxmof"
+not X6
+mov r7, *r2
+mov *r6, r1
+cmp X5, *r2
+L210: clr L242
+bne *r1
+rts
+stop
+jmp L137
+L211: jmp L142
+clr *r1
+cmp #-58, *r4
+jsr *r1
+mov r6, X6
+L212: stop
+; comment
+not r6
+; comment
+cmp #-33, #150
+red *r5
+lea L196, r2
+not *r1
+dec *r3
+L213: rts
+L214: .data 738
+not *r5
+jsr *r4
+clr *r4
+lea X15, L85
+; comment
+L215: stop
+L216: .string "waixypdpqxejoxqw"
+mov L96, r6
+; comment
+stop
+L217: not *r6
+; comment
+bne *r4
+mov #149, *r2
+sub *r0, *r1
+sub X0, r7
+dec r0
+cmp #-1, *r4
+bne *r2
+L218: .string "cbkminbsxfkzlytypulfzynq"
+L219: inc *r1
+
+L220: sub #241, X6
+prn #133
+stop
+inc *r5
+stop
+stop
+not *r7
+; comment
+L221: .data 148, -675, -986, 453, -762, -708, -870
+prn L96
+L222: .data -986, 354
+cmp *r6, r3
+lea X16, r1
+L223: prn r2
+L224: stop
+jsr *r6
+L225: stop
+red r0
+add *r0, *r7
+add r1, *r3
+L226: lea X2, X20
+L227: stop
+jsr L141
+; comment
+sub #188, *r0
+bne X8
+dec r0
+sub #121, X15
+L228: inc *r1
+stop
+L229: sub r2, r0
+stop
+L230: .string "pu"
+not L6
+clr L243
+lea X8, *r6
+dec L127
+cmp X20, X15
+L231: add *r3, *r4
+L232: cmp #-244, L251
+cmp #-141, *r2
+jmp L16
+L233: .string "llkweazdwakpd"
+jmp X2
+L234: not r7
+red r4
+
+cmp r3, #-235
+jsr *r4
+L235: .data -812, 301, -144
+lea X7, r3
+lea L26, r4
+L236: inc r2
+L237: jsr *r7
+jmp L58
+mov #184, *r2
+rts
+L238: .string "bbdbz"
+clr *r3
+inc *r1
+inc *r6
+stop
+L239: dec *r6
+jmp *r0
+L240: inc L231
+prn *r2
+cmp *r4, *r2
+jsr *r6
+L241: jsr *r2
+L242: .data -542, 800, -87, 913
+dec L223
+L243: lea L131, r5
+L244: .string "cphdwuitgyiwquxycuy"
+jmp X18
+L245: jsr L249
+prn L256
+
+clr r7
+add r0, *r0
+bne L30
+bne *r0
+; comment
+cmp r5, r3
+not r3
+add #62, X9
+L246: .data -31, -447, 318
+L247: bne *r1
+inc *r2
+L248: inc r5
+prn r3
+sub #-34, *r0
+L249: .data -814, -810, -856, 749, 526, -924, -192
+mov *r5, r2
+L250: .string "dedgmsoeskfzbkeuhnqa"
+L251: inc X21
+not *r1
+rts
+not L254
+cmp r3, *r2
+rts
+L252: .data -707, 605, 526, -948
+jsr *r6
+L253: .string "knljsujbzokyfvdvncyw"
+inc L256
+jmp X10
+rts
+L254: .string "pnoijjmaflmznluognu"
+cmp *r7, #80
+rts
+; comment
+L255: mov #140, *r3
+clr X18
+L256: dec *r4
+red X19
+stop
@@ -0,0 +1,1044 @@
+; Generated by genCorpus --seed 57
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+bne *r0
+add r1, r4
+lea L122, X12
+L0: add X12, L241
+jmp X13
+red L0
+rts
+L1: rts
+bne *r2
+sub r2, r4
+L2: rts
+L3: bne *r4
+not *r7
+lea L0, *r5
+prn r5
+dec r7
+L4: red L9
+L5: dec *r5
+cmp r5, X15
+not r3
+cmp L154, #165
+not L3
+rts
+add r1, L1
+inc L204
+L6: .string "laiu"
+mov r6, *r2
+jmp *r1
+L7: lea X1, r4
+rts
+red r1
+L8: jsr *r5
+clr X19
+L9: bne X7
+prn *r5
+red r7
+stop
+L10: mov #204, L101
+L11: clr L7
+L12: jmp *r3
+clr r1
+; comment
+L13: inc L46
+L14: inc X22
+jsr *r4
+cmp L12, #2
+L15: red X3
+dec L0
+stop
+inc r5
+rts
+jsr L24
+not r6
+L16: stop
+not *r4
+L17: inc r1
+rts
+red X5
+jmp *r1
+rts
+L18: .data 923, 621, -784, -69
+red L11
+L19: .string "qgiffvd"
+L20: dec r0
+L21: .string "ndmhadhclbavntckwnqccw"
+L22: lea L19, L93
+jsr X15
+L23: .data -731, -993, 109
+rts
+jsr *r4
+L24: jmp L30
+L25: .data -536, 351, -766
+L26: dec *r2
+clr *r0
+prn #181
+L27: red L26
+L28: rts
+L29: mov r7, r3
+prn *r3
+sub X9, X2
+jmp L16
+L30: .string "dxppjhyuzeegs"
+jmp L18
+L31: lea L25, L125
+L32: inc r1
+inc r7
+jmp X2
+cmp r7, L14
+lea L18, r0
+cmp #-73, L19
+red L26
+L33: rts
+prn *r2
+prn *r2
+L34: jsr *r4
+rts
+L35: prn L199
+add #213, *r5
+mov L201, L84
+L36: .string "wdkrhizypzcxxatcb"
+L37: .string "rimdclhfdwflxpm"
+bne X19
+lea L0, r3
+dec r7
+stop
+prn L5
+L38: bne L15
+L39: .data -825, 986
+clr *r3
+jmp *r7
+mov r2, *r0
+red r0
+L40: mov *r1, r6
+
+dec r4
+prn *r2
+not X0
+jmp *r5
+L41: .data -989, 454
+bne X23
+; comment
+jsr L85
+prn r7
+L42: .string "jlqtm"
+L43: add #186, r0
+L44: .string "hbltl"
+cmp L27, r6
+L45: inc *r1
+jsr *r4
+bne L164
+L46: not r2
+mov #-157, X12
+sub #-225, r7
+L47: clr L166
+jsr *r6
+red *r1
+jsr *r3
+clr L31
+lea X22, r4
+add L29, r6
+lea L41, X0
+clr X16
+mov *r0, *r0
+lea X16, *r7
+prn r6
+not r5
+
+bne X6
+sub #-251, *r7
+mov L139, r3
+stop
+rts
+inc *r1
+add #-209, r3
+add L34, L175
+cmp *r4, r6
+L48: jmp X19
+L49: .data -344, 411, 636, -160, -13, 954
+lea X10, L100
+; comment
+clr r4
+dec r7
+L50: .data -651, -3, -430
+dec *r2
+L51: .data -799, 42, -202, 340, 566, 103
+; comment
+jsr L151
+stop
+add *r5, *r6
+rts
+L52: .string "ahbyuwbrjgttxguljlqp"
+L53: clr *r4
+bne L19
+add #58, L180
+lea L236, *r7
+red r2
+mov r4, *r1
+; comment
+L54: .data -683, 509, 791, -185, -949, 13
+stop
+rts
+mov *r0, L47
+rts
+cmp X3, r3
+add r6, *r1
+lea X12, X16
+L55: jsr *r0
+L56: .string "slraa"
+L57: bne L110
+L58: red r0
+
+jsr L7
+mov r0, *r6
+L59: .data 328, 606, -753, 478, -100, -213
+L60: .data -794, -59, 565, 260
+bne X19
+L61: not *r7
+L62: .data 212, -566, 353, 492, 691, 366, 112, 418
+rts
+rts
+rts
+jmp L25
+dec *r4
+cmp *r1, X1
+not L33
+inc X14
+lea X15, *r3
+inc X8
+
+bne L58
+jmp X3
+inc X16
+L63: .data 669, 373, -138, 382, 64
+not *r2
+L64: .string "aziugcjjup"
+sub *r2, *r7
+dec L216
+L65: dec L126
+add #161, *r6
+jmp *r0
+clr *r5
+prn *r5
+dec *r4
+not *r2
+L66: not L129
+jmp X3
+cmp r5, L127
+red r4
+L67: dec L16
+jsr L222
+sub *r3, L92
+jsr L93
+L68: jsr L201
+prn L176
+prn #-147
+dec L60
+L69: .string "ce"
+jmp *r0
+bne X5
+dec L10
+inc X22
+stop
+lea L188, *r5
+L70: lea L35, L9
+stop
+clr *r0
+inc r0
+bne *r7
+bne *r4
+L71: sub L25, r4
+prn r0
+L72: .data 163
+
+L73: .data -430, 850, -444, -59, -310, 833
+
+bne *r7
+inc *r1
+L74: not r5
+rts
+clr r2
+cmp L49, *r7
+add L47, *r2
+stop
+L75: .string "rouhnlongzhogcqqxswhe"
+L76: .data -556, 255, 795, 270, -488, -419, -767, 426
+stop
+cmp r3, *r2
+L77: .data -116
+prn #-114
+clr r7
+mov L6, r1
+
+sub *r4, r0
+
+jsr X0
+; comment
+L78: .string "ajlr"
+clr *r7
+inc r0
+L79: dec L136
+mov L18, r3
+clr X0
+sub r0, L169
+cmp L33, *r4
+L80: stop
+clr r5
+L81: sub r3, r3
+L82: mov r0, r4
+red X7
+L83: .string "xxojyyoxw"
+rts
+not *r5
+L84: add r1, r2
+not L84
+jmp *r0
+cmp #62, X21
+red *r2
+dec *r7
+cmp r6, *r4
+L85: dec L58
+mov #226, X7
+red r0
+L86: .string "sd"
+L87: jmp *r1
+prn L137
+clr X10
+rts
+inc X15
+L88: bne L242
+inc *r7
+L89: mov *r1, L26
+L90: jsr L46
+dec *r7
+stop
+add X15, X12
+not r6
+L91: inc *r5
+L92: lea L55, r7
+
+cmp #-182, r5
+lea X15, r4
+
+clr X17
+rts
+L93: mov r0, *r5
+L94: rts
+lea L78, *r6
+L95: clr r2
+jsr X17
+sub X22, r0
+red X15
+sub r1, L81
+dec *r2
+dec L225
+lea L11, *r0
+dec *r6
+rts
+clr L144
+; comment
+jsr *r1
+clr L211
+red *r4
+L96: sub r5, L191
+add r1, r7
+L97: .data -811, 630, 40
+L98: red r5
+add #218, r1
+not X6
+bne *r7
+jsr *r1
+clr r2
+rts
+red r7
+; comment
+sub r5, L28
+inc r6
+inc r5
+rts
+L99: .string "ms"
+L100: mov *r0, L189
+not X15
+prn *r7
+L101: clr X0
+stop
+L102: .string "gsmjdgdwje"
+clr r0
+dec L112
+L103: cmp #-214, L18
+L104: stop
+red L251
+stop
+stop
+add L168, r3
+inc L21
+
+lea L53, *r4
+lea L241, *r3
+jsr *r2
+L105: mov r2, r1
+L106: cmp r4, L73
+dec r5
+L107: inc L164
+L108: mov *r0, X18
+
+L109: clr r0
+lea L34, L249
+cmp L157, #-59
+inc *r6
+stop
+
+
+stop
+L110: red r2
+prn #-148
+not *r2
+L111: .data 744, -484
+add r2, *r0
+
+jmp X21
+bne X24
+L112: .string "pjsjuifaddrfumijatgm"
+; comment
+L113: clr r2
+lea X5, *r3
+stop
+sub *r4, r6
+cmp *r4, #-60
+dec r4
+mov #-46, L249
+prn L110
+lea X24, L6
+; comment
+L114: jsr *r0
+sub #-107, X24
+jsr L104
+cmp #-33, *r7
+L115: inc L20
+sub X18, *r1
+sub L207, r6
+L116: inc r4
+inc L176
+L117: stop
+red r5
+cmp *r0, r7
+rts
+lea X4, r2
+add L181, *r7
+lea L138, *r5
+inc r0
+L118: add r7, r1
+jsr L96
+bne L63
+not X14
+L119: .data -982, -564, 249, 244, 837, 894
+jmp L36
+L120: mov L176, r2
+L121: bne *r5
+dec r1
+red r4
+inc X4
+lea X23, *r4
+lea X20, *r1
+inc X10
+L122: .string "qaapvlfshg"
+red r3
+add *r7, X9
+cmp X12, X2
+red r4
+lea L136, r4
+L123: .string "pjfjiivm"
+inc *r5
+L124: add #-144, r1
+add r6, *r2
+dec L198
+L125: .data 781, -956, -944, -670, 819, -852, -640, -545
+; comment
+not L97
+; comment
+sub r0, L212
+red *r4
+dec *r0
+jsr *r7
+mov r7, r6
+bne X11
+stop
+inc r3
+L126: .data 265, 412, -769, -235, -677, 536
+not L183
+inc *r6
+jsr L194
+inc *r2
+red r2
+
+
+lea L70, r0
+L127: sub r6, L148
+prn r4
+L128: .data 120, -952, 966, -989, -272
+L129: .data -857, -99
+L130: sub r5, *r2
+L131: jmp *r3
+
+L132: .string "vehjapvwgvrvbpp"
+bne *r6
+L133: jsr *r4
+jmp X8
+add *r1, L158
+cmp L36, L201
+not r6
+bne *r2
+L134: .data -588, -280, -585, -821, -582, -160
+jmp *r2
+lea L212, L54
+inc *r1
+mov *r0, r1
+L135: clr X1
+sub r3, r0
+L136: .string "epx"
+prn #-95
+not X8
+L137: red X18
+cmp L157, L224
+rts
+bne X0
+red *r3
+clr *r5
+inc L176
+L138: jmp L142
+
+lea X20, *r4
+L139: red L146
+sub L171, *r2
+prn r2
+stop
+jmp L30
+red X1
+lea X5, X3
+clr *r7
+add L143, r4
+stop
+lea X6, r6
+; comment
+stop
+jsr L123
+prn L146
+L140: prn *r0
+L141: jsr L57
+red L199
+sub L232, *r3
+stop
+red *r4
+stop
+L142: inc r0
+inc X5
+rts
+; comment
+L143: dec r7
+dec X13
+rts
+red r4
+inc r6
+L144: red r0
+rts
+add #-97, r0
+; comment
+rts
+; comment
+not r7
+red r2
+L145: lea L235, *r4
+mov X8, X6
+add L46, L92
+cmp X2, *r5
+prn r3
+red X21
+cmp r3, #-193
+stop
+
+L146: jsr X18
+red X8
+L147: cmp *r5, *r0
+clr *r7
+sub X2, r6
+inc r5
+add *r0, r0
+L148: not r3
+L149: sub #25, r7
+L150: prn X10
+red r3
+prn L219
+L151: .data -16, 716, 702, -960, -144, 935, 37
+L152: .string "spkunnkdfki"
+L153: rts
+clr r2
+stop
+bne *r0
+L154: add #62, r4
+mov r1, *r6
+add #-75, L255
+stop
+not *r0
+; comment
+add *r0, *r5
+sub #20, *r6
+rts
+dec r2
+prn #119
+dec *r1
+clr r6
+bne *r1
+jmp X8
+lea X14, *r7
+jsr L86
+L155: .string "ughbidfhhva"
+jmp L211
+
+dec *r5
+; comment
+stop
+L156: .string "u"
+stop
+stop
+cmp *r4, r1
+not *r5
+L157: rts
+clr r5
+prn #71
+L158: bne X22
+inc r4
+
+jsr *r1
+rts
+stop
+inc *r6
+add r5, X17
+dec *r0
+add L102, *r7
+inc *r3
+jsr X1
+jmp *r0
+add *r3, r2
+L159: inc r3
+mov #-202, *r4
+L160: .string "axeemkrjftnvljxsqpuv"
+cmp *r5, r2
+mov *r0, *r1
+dec r6
+dec r0
+red *r4
+; comment
+
+L161: .data -300, -999
+L162: bne *r5
+L163: dec *r5
+cmp *r5, *r7
+bne L104
+L164: .data -272, -270, -55
+mov L230, r3
+dec *r1
+L165: jmp *r4
+lea X20, X9
+L166: .data 60, 753
+; comment
+dec r0
+jmp X23
+mov *r3, X18
+cmp r7, #-202
+L167: .string "pyoflciuoqdfcynjpsgok"
+sub r4, r4
+add #31, r7
+L168: rts
+L169: bne *r6
+inc L94
+not r7
+dec L252
+not r1
+L170: jsr *r6
+bne *r7
+L171: .string "jkszbotdrbaksjtotjcno"
+rts
+L172: red r1
+cmp *r1, r0
+mov *r4, *r1
+red *r1
+L173: lea L172, *r5
+bne L208
+dec X17
+jsr L103
+sub r2, L221
+red L245
+L174: cmp *r7, *r4
+stop
+cmp #148, r0
+L175: .string "kyqdthvqk"
+bne X6
+clr *r7
+rts
+dec *r6
+stop
+prn r2
+cmp L167, #107
+dec L196
+red r3
+red *r6
+bne X5
+not X2
+cmp *r7, *r2
+
+L176: add r4, X20
+L177: .data -242
+dec *r5
+jsr *r0
+jmp *r3
+dec *r1
+bne L49
+L178: mov #153, X7
+inc *r6
+prn *r6
+jsr *r7
+stop
+L179: sub L203, X13
+dec *r6
+L180: stop
+dec r3
+L181: .data -272, 32, 213, -606, -736
+L182: jsr *r2
+red r1
+mov *r5, X23
+red *r0
+clr r1
+add r2, *r5
+lea L251, r4
+lea X17, *r1
+L183: .string "mgkcwkx"
+; comment
+rts
+L184: add *r6, X8
+cmp X9, #91
+L185: .data -923, -374
+L186: bne L240
+inc L182
+rts
+mov *r5, L81
+inc L70
+inc *r2
+lea X12, X23
+L187: .string "nqozxxybvmluszsqpozhv"
+inc L61
+jsr *r0
+mov r1, *r2
+L188: cmp *r7, r2
+add #11, L18
+L189: .data 288, 31, 621, 295, -539, 52
+L190: .data 984
+lea L68, r5
+L191: .data -508, -713, 740, 908
+bne *r2
+add #243, X4
+clr r7
+red *r2
+L192: .string "jydtxs"
+jsr L218
+cmp #-160, #82
+lea L111, r0
+L193: .string "abaiibeg"
+L194: .string "frcrqlrdcpsj"
+lea X0, *r4
+stop
+lea L148, r0
+L195: dec *r6
+sub r1, L157
+L196: clr L23
+cmp L238, #-131
+clr *r0
+dec X11
+rts
+lea L211, X16
+lea X19, r2
+L197: .data -720, 171, -69, -472
+bne *r6
+sub r2, L204
+mov *r6, *r5
+L198: .string "rwofpqsrnkrtf"
+jsr L144
+L199: red r6
+rts
+inc r1
+dec r7
+lea X3, r2
+stop
+add r3, r0
+L200: not *r0
+not *r3
+
+dec X9
+clr *r1
+prn r2
+bne L121
+prn r0
+jsr L204
+L201: prn *r1
+L202: mov X19, *r6
+bne L45
+lea X5, *r6
+clr r0
+L203: .data 429, 993, 206, -809, 447
+sub #163, r3
+not r0
+L204: cmp *r1, X9
+stop
+L205: .string "zohkgftdtzrl"
+cmp r0, #-140
+not L53
+inc r7
+sub r6, r7
+jsr L214
+add *r7, X2
+jsr *r0
+rts
+red *r6
+rts
+lea L94, r0
+red L44
+not r3
+not L60
+inc *r2
+not *r4
+dec L242
+; comment
+prn L228
+L206: sub r2, X20
+stop
+cmp *r3, r7
+L207: .string "vzp"
+L208: stop
+L209: add #124, *r1
+add r7, *r0
+L210: .string "lytzznaokyysr"
+L211: stop
+clr *r7
+mov r2, r7
+bne L253
+L212: clr r6
+not r7
+L213: add r5, r6
+L214: prn #179
+cmp *r5, X7
+red r4
+
+inc L79
+L215: clr *r0
+L216: .data 154, 646, 971, -690, 867
+mov r5, X15
+red *r5
+add r7, *r5
+red r7
+dec *r5
+lea L3, X18
+sub r1, r5
+L217: .string "uizjezssbvrsk"
+sub L236, r3
+bne X16
+rts
+L218: .string "yzcdtapudmfnlnelci"
+not *r4
+clr *r1
+L219: inc L191
+L220: sub #109, *r0
+bne *r0
+clr *r0
+L221: .data 225, -27, 245, 770
+lea L224, *r2
+L222: rts
+mov *r3, *r1
+add *r2, X10
+not *r1
+add *r1, *r2
+mov *r7, r3
+clr r2
+bne *r5
+L223: .string "qhehhxhcahjxxeltpio"
+prn X9
+not L88
+cmp *r1, #20
+lea L83, *r2
+red r1
+jsr *r6
+add #237, L234
+red X10
+
+L224: dec r5
+lea L30, *r5
+jmp *r5
+dec r2
+cmp *r6, #-131
+jsr X3
+red r5
+mov r5, *r0
+L225: inc *r5
+inc *r4
+red *r2
+add *r7, *r1
+rts
+lea X11, X17
+not L52
+mov X6, *r6
+rts
+L226: prn L38
+
+not L109
+jsr *r4
+inc X18
+; comment
+L227: .data -27, 290, -628, -849, -758
+cmp r0, *r5
+inc r1
+; comment
+clr *r4
+bne *r7
+cmp X0, *r6
+L228: .data 90, -649, -319
+inc L234
+add *r1, r2
+inc r4
+L229: not r2
+L230: .data 780, 714, -805, -861, 97, -504, 493
+inc r6
+cmp r2, X0
+
+cmp r6, #-60
+
+inc *r4
+rts
+lea L163, r1
+jsr *r4
+L231: .string "qeyrwtmkswpfxshrhyoonbda"
+stop
+inc *r4
+sub #-164, L237
+mov X16, L198
+L232: .string "mzhxwzvcrzwkchcpayoe"
+bne X11
+mov *r3, *r7
+stop
+L233: red L246
+lea X9, *r6
+L234: red *r1
+cmp #41, #22
+lea L220, r1
+rts
+bne L246
+cmp *r2, X21
+L235: jsr *r3
+bne *r7
+mov *r1, *r0
+clr r3
+dec r5
+bne X15
+jsr L245
+cmp #131, #203
+dec *r2
+L236: sub L254, r7
+prn #207
+L237: dec r6
+L238: .data -932, -593
+L239: lea L244, r2
+cmp X16, #-171
+stop
+jmp L36
+red *r5
+prn #-38
+not L250
+inc r5
+L240: .string "ibwzbpm"
+bne X18
+L241: .data -378, -197, 484, 425, 654
+L242: .string "tgzjtfvowruwqhpnqrnxy"
+bne *r5
+L243: cmp L149, *r2
+L244: bne X11
+L245: jsr X9
+jmp L202
+red X6
+L246: .string "omjjg"
+prn r6
+L247: add #126, r2
+L248: .string "ettzvdzdryx"
+L249: mov L250, L254
+; comment
+rts
+stop
+add L250, r5
+L250: bne *r5
+prn r7
+rts
+stop
+mov L252, r0
+jmp X0
+L251: .data 135, -268, -296, 952, -244, 957
+L252: .data 957, 409, 424, -312, 109, -986, -672, 55
+jmp L81
+jmp *r5
+cmp #30, #246
+bne X1
+lea L74, r5
+red r3
+not X21
+red r3
+stop
+jmp L253
+not r5
+L253: mov L254, r4
+L254: prn r5
+prn #57
+L255: inc L125
+not *r7
+L256: jsr *r0
+lea L257, L18
+L257: sub r1, r1
+not r7
+stop
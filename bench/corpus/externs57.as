@@ -0,0 +1,1044 @@
+; Generated by genCorpus --seed 58
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+red r3
+L0: clr *r7
+rts
+rts
+mov #63, X0
+add #-151, L195
+L1: cmp L0, #38
+clr *r7
+L2: prn *r2
+L3: red r7
+dec L3
+jmp X22
+L4: .data -308
+bne L2
+
+jmp L130
+L5: stop
+jmp L1
+L6: cmp *r1, r4
+stop
+L7: .string "fbsclhwcqfkjd"
+prn *r4
+mov r3, L0
+stop
+mov *r1, *r1
+jmp *r5
+L8: prn #-149
+stop
+L9: .data -736, 93, 20, -758, 377
+red L213
+
+cmp L12, #105
+prn X16
+dec r1
+bne X3
+L10: .string "uszyjpjspcetodqpb"
+mov #110, r7
+L11: .string "rhiaqssripvsa"
+bne L30
+mov #-129, *r0
+cmp *r4, #164
+inc *r5
+dec r6
+dec *r3
+L12: bne *r4
+L13: mov *r4, r4
+rts
+L14: red *r1
+inc r7
+not L51
+dec *r4
+prn *r6
+L15: .data -564, -268, 384, -393, -925, 421, -734, -893
+L16: rts
+; comment
+mov #157, X19
+jsr *r3
+not *r3
+mov #106, *r4
+stop
+L17: mov L44, L11
+lea X0, r1
+L18: dec *r6
+dec X22
+L19: .data 325, 220, -413, -153
+L20: .data -552, 792, 405, -765, 157, -111
+L21: bne *r7
+L22: jsr L31
+add *r5, X12
+lea X20, r3
+mov X20, *r6
+stop
+jmp L13
+not X24
+clr *r7
+rts
+L23: .string "tvfshmigclslqwnfazzeplg"
+red *r3
+L24: bne *r6
+red *r4
+not L1
+dec r2
+not r2
+jsr *r2
+lea L5, L6
+L25: rts
+dec X18
+bne X24
+inc *r7
+; comment
+jsr L12
+L26: red L25
+bne *r4
+stop
+L27: .data -768, 708, 391, -199, -873, -959, 136, 497
+L28: .data 466, -57, -198, 81, 627, -166
+prn r6
+L29: sub *r7, L249
+sub r4, r0
+L30: dec r1
+
+bne *r4
+add *r2, *r0
+add *r4, *r2
+bne *r2
+jmp *r3
+jmp X19
+stop
+lea L235, r1
+add r2, *r3
+rts
+sub L210, X8
+L31: .data 559, 531
+dec r4
+sub *r1, X2
+L32: stop
+bne X6
+L33: jsr X23
+red r1
+bne L4
+lea L237, r3
+sub *r4, L197
+inc r4
+mov L141, L105
+red L168
+dec r4
+L34: prn L228
+
+rts
+add r2, L214
+; comment
+mov #237, r0
+L35: .string "ucezw"
+sub *r7, *r4
+prn #114
+mov *r7, X23
+L36: .string "hybevim"
+dec r2
+jsr X2
+stop
+inc X4
+rts
+L37: lea X9, *r4
+cmp #107, L30
+lea X9, *r4
+cmp r1, #13
+
+L38: .string "hiuavgdzkuobtajinnju"
+lea L206, *r3
+not X12
+clr *r4
+prn X23
+jmp X24
+L39: stop
+rts
+bne L37
+L40: .string "beqrdagnsnwxclw"
+lea X5, r6
+red r3
+inc L44
+L41: .data 70, 647
+dec L199
+L42: .string "xlmljhfdl"
+not *r4
+lea L114, r0
+bne *r2
+L43: .data -364, 535, 139, 850, -597
+L44: not L256
+red L37
+bne L188
+not *r1
+L45: jmp L11
+clr r2
+prn r2
+lea L33, L101
+stop
+cmp #27, L166
+mov r0, r7
+dec r4
+bne *r6
+L46: .string "opkhrbjfjtm"
+prn X23
+jmp L35
+jmp *r2
+rts
+sub *r6, L45
+L47: rts
+red r5
+L48: .string "oatozkdgtsklljxi"
+red L33
+sub #216, *r7
+jmp L24
+L49: cmp L111, r1
+cmp r0, r6
+; comment
+L50: .string "zmnrtoslhxwsgiitzd"
+red L12
+add r5, r3
+L51: .data 40, 967, -246, -217
+inc r5
+jmp L17
+
+L52: clr X22
+L53: .string "wl"
+prn #173
+L54: not r6
+L55: dec X5
+dec r2
+bne L8
+mov *r2, X22
+L56: red L42
+clr r1
+lea L38, X22
+prn *r7
+; comment
+L57: jsr *r4
+stop
+L58: jsr *r4
+stop
+stop
+cmp r4, X23
+not X1
+red L211
+L59: .string "kytkrnpmntwz"
+L60: .data -146, 543
+lea L67, r2
+red r2
+cmp L89, X0
+clr r2
+not *r4
+; comment
+lea L91, r5
+stop
+jmp L201
+prn r0
+L61: .string "lepsfutgykwbymrzguihqapd"
+; comment
+L62: jsr *r3
+L63: .string "qddrnhsabercsuj"
+not *r4
+rts
+sub #89, r0
+L64: .data 304, 647, -213, 977
+inc r5
+jmp *r1
+L65: mov r3, X9
+L66: red r4
+L67: bne *r7
+sub r3, L27
+jsr X6
+L68: .string "jnqs"
+jmp *r2
+add *r5, r6
+bne *r7
+L69: .data 885, 459, -170
+prn *r7
+inc L18
+mov L245, *r3
+inc *r4
+stop
+L70: mov r5, r7
+L71: bne L137
+rts
+cmp L40, #62
+jmp *r3
+sub L5, X2
+sub r6, *r4
+not r1
+cmp #157, L194
+dec r1
+L72: red *r3
+inc *r0
+inc *r0
+L73: clr X17
+
+L74: lea X6, X15
+dec *r0
+cmp *r5, #-228
+clr *r2
+L75: .data 152, -435, 838, -847, 386, 21, -659, -5
+rts
+stop
+stop
+stop
+inc *r3
+L76: .string "hcfcjq"
+not *r5
+rts
+bne L257
+lea X5, r7
+not *r4
+L77: .data -484, 209, 381, -749, -610, -414, 182, 196
+L78: .data 937, -976, -843, 58, -718
+jsr L21
+L79: not r3
+red r3
+rts
+lea L171, r4
+rts
+inc L11
+cmp X20, #47
+dec L35
+red r0
+L80: add #-173, r1
+L81: jsr X12
+L82: .data -364, -749, 545
+jsr *r5
+stop
+prn *r1
+
+add r7, *r1
+rts
+not *r7
+jmp *r6
+clr r6
+red X2
+rts
+L83: .data 501, 47, -388
+rts
+L84: jmp L110
+dec *r4
+rts
+prn *r7
+rts
+add *r6, r5
+stop
+mov *r3, L25
+not *r7
+stop
+jmp X20
+lea X24, L194
+mov r5, *r1
+L85: inc *r4
+clr *r3
+cmp r7, #62
+L86: prn *r1
+L87: clr r2
+L88: jsr *r2
+stop
+add L237, L145
+red L60
+inc r7
+add *r2, *r1
+
+lea L99, X12
+lea L19, *r2
+bne *r1
+L89: .string "ybddmc"
+clr *r5
+prn r1
+L90: stop
+L91: .data 299, -352, -24, 416
+jmp X1
+add r7, r7
+dec L67
+clr X17
+not *r2
+bne *r1
+clr *r2
+jsr X18
+mov *r2, *r4
+L92: inc *r7
+
+L93: .string "qypeshakgylkiqfiudao"
+lea L3, X21
+dec *r2
+prn *r3
+dec r4
+L94: jmp *r1
+rts
+jmp L221
+mov *r0, *r7
+not X23
+clr r2
+add #-44, L93
+prn *r4
+mov r6, *r1
+jsr L26
+cmp #-126, *r0
+
+L95: inc L197
+L96: .string "bkjgmmbjwxxunpfnqcckg"
+bne L186
+L97: jsr *r6
+L98: sub L122, X21
+stop
+prn L230
+stop
+cmp *r1, r6
+L99: .string "lsggjeulzbc"
+stop
+jsr *r1
+prn L253
+prn r4
+bne *r7
+stop
+L100: sub L219, r2
+jsr L170
+red r6
+not *r1
+L101: not L112
+rts
+L102: cmp L68, L201
+lea L41, r4
+bne L169
+sub X18, r3
+inc *r5
+L103: .string "tbowqjrigt"
+clr r2
+jsr X12
+bne X14
+bne *r0
+L104: .string "etffvjl"
+rts
+L105: .string "nf"
+not *r6
+clr *r2
+L106: jmp L13
+clr L36
+L107: .data -507, 794, -638, 382, -511, 339, 564
+clr *r4
+jmp X21
+jsr X1
+L108: add L109, r4
+cmp L65, #212
+L109: .string "gp"
+dec *r6
+bne L78
+jmp L258
+jsr *r6
+
+dec r0
+L110: prn L164
+clr r0
+add r1, r1
+L111: not *r0
+sub r6, L21
+red L47
+L112: stop
+red r5
+clr *r3
+; comment
+L113: .data -109, -22, -588, -523, 434
+jsr L227
+jmp X8
+L114: .string "be"
+lea L115, L99
+bne X19
+jsr *r6
+jsr *r1
+jmp L102
+sub *r5, L101
+bne *r5
+mov *r0, *r1
+mov L106, r6
+cmp r2, *r4
+L115: add *r5, *r6
+cmp r7, L89
+clr L2
+L116: .string "sgfgtdlsvc"
+L117: stop
+jsr X0
+lea X5, r0
+sub *r6, *r7
+rts
+sub r4, r1
+L118: .data 25, 556, -672
+not r6
+stop
+lea X11, *r3
+bne X20
+jmp X11
+L119: .string "skgobieqkqfblakjjeff"
+add X13, X4
+clr L22
+not L98
+L120: clr r4
+dec r7
+L121: .string "m"
+; comment
+red L70
+lea X7, r1
+not r1
+L122: lea L130, X17
+jsr *r5
+not *r2
+not r0
+rts
+prn L18
+L123: mov #-114, r2
+stop
+lea L118, X16
+; comment
+red *r6
+L124: rts
+cmp L242, #-146
+rts
+L125: jmp *r7
+jmp *r6
+prn #-3
+jmp X17
+add L241, *r6
+L126: jsr L85
+prn *r6
+bne *r6
+L127: cmp r7, #-170
+clr r2
+not r2
+L128: sub r7, L158
+bne X19
+L129: .string "znlcg"
+sub X19, *r3
+clr r2
+add r2, *r4
+stop
+jsr *r0
+L130: jsr L48
+L131: .data 597, -390
+red *r3
+mov #-226, L175
+; comment
+dec *r4
+L132: rts
+lea L172, L20
+L133: stop
+red X17
+jsr L208
+L134: clr L143
+mov *r0, L224
+rts
+inc *r5
+sub r4, *r5
+not *r7
+dec *r0
+clr r6
+lea L212, *r0
+bne L220
+
+L135: jmp L81
+red r2
+L136: cmp #-140, X24
+lea L233, r0
+rts
+inc r4
+clr X12
+dec *r3
+bne X12
+lea L168, *r4
+red *r2
+L137: bne *r0
+clr *r2
+L138: mov #-1, r6
+; comment
+stop
+inc *r6
+dec r7
+red r0
+add *r2, r6
+red X13
+jmp X21
+jsr X23
+bne *r4
+prn #251
+L139: add *r6, L226
+bne X7
+L140: not r7
+L141: jsr L181
+lea L86, L248
+L142: cmp r4, L144
+rts
+clr r2
+inc *r2
+inc *r4
+L143: lea L148, X9
+inc r2
+prn #-213
+rts
+rts
+sub #-144, *r3
+clr r3
+clr *r4
+L144: rts
+lea L179, *r2
+
+mov #-192, X17
+stop
+L145: inc *r2
+; comment
+stop
+prn #153
+bne X2
+cmp #230, X12
+add X19, r2
+lea X2, r0
+L146: clr *r3
+dec X12
+L147: not r3
+add X3, r5
+not X17
+L148: add L233, *r2
+cmp #83, *r2
+clr X0
+jsr *r7
+dec *r7
+prn #176
+dec X8
+jmp L16
+stop
+L149: .string "ewgbwm"
+lea L225, L90
+prn r0
+L150: cmp X4, r2
+L151: not r1
+stop
+jmp L207
+lea L59, L103
+L152: not X9
+dec *r3
+sub #-159, *r4
+cmp *r5, *r7
+add #-87, L182
+add #-154, r7
+L153: .data -261, 741, 161, -559, -205
+stop
+red r3
+inc *r3
+not *r4
+cmp r2, *r6
+; comment
+L154: .data 180, 465, -225, 695
+rts
+L155: sub *r5, X1
+L156: .data -168
+jmp *r1
+L157: jsr L83
+jmp *r4
+dec r7
+dec r5
+inc *r4
+jsr L130
+prn #-142
+L158: .string "junqklrih"
+jsr *r1
+L159: lea X3, L96
+rts
+prn *r3
+not r3
+jmp L81
+jmp L247
+red r3
+add r2, L225
+; comment
+dec L180
+inc *r0
+L160: lea L0, *r7
+cmp r3, r7
+red r0
+L161: prn *r7
+L162: .data -556, -743, -615, -958, -403, -401, 366
+L163: jmp X1
+stop
+not r1
+clr L171
+L164: jmp *r5
+not X23
+bne *r3
+prn *r1
+lea X21, r4
+L165: .data -560
+L166: .data -85, 266, 882, -156, -778, -159, -614, 277
+L167: .string "sejzlm"
+L168: prn *r6
+lea X7, *r3
+L169: .data 635
+L170: sub *r6, X16
+L171: .string "xsbxkfsefpkbvyd"
+L172: rts
+prn *r0
+stop
+jsr X6
+lea X12, L96
+stop
+L173: stop
+prn r3
+prn X0
+jmp L83
+rts
+L174: jmp L252
+jsr X17
+lea L243, r5
+L175: inc L210
+L176: prn r4
+L177: rts
+L178: .string "affiosxewgpdz"
+L179: .data 588, -815
+stop
+stop
+inc r3
+jsr L115
+
+not X7
+sub *r2, r5
+not *r2
+prn #168
+jmp L236
+L180: inc *r4
+L181: add r2, X8
+rts
+bne X20
+red *r6
+jsr X2
+L182: .string "xclqbye"
+mov #202, *r0
+jsr X11
+not X17
+sub L255, *r5
+rts
+L183: jsr *r1
+prn r0
+cmp X1, X21
+prn *r4
+bne *r1
+jmp *r1
+lea L261, r7
+sub #-191, X23
+lea L142, r1
+stop
+lea L200, *r7
+L184: inc L35
+red *r0
+L185: .data -891, -292, 430, -948
+jsr *r7
+dec *r4
+L186: .string "tndwelovtxxyczmtpscxrgr"
+L187: .string "eoy"
+dec L13
+lea X14, r1
+prn r2
+rts
+clr L157
+rts
+lea X7, r7
+add X5, *r0
+stop
+sub L91, X23
+jmp *r6
+not L191
+dec *r5
+dec L5
+add L219, r5
+L188: mov r1, L204
+red *r3
+L189: mov *r0, X1
+mov *r4, r4
+cmp r2, *r4
+jmp *r4
+stop
+L190: .string "pzpsyajbnaepirmfpdbxiwnj"
+rts
+L191: not *r5
+L192: dec *r6
+cmp #-91, #-138
+cmp *r2, r0
+
+jsr X7
+L193: lea X7, *r6
+jmp *r6
+L194: red L200
+bne L224
+inc *r3
+bne *r0
+clr r6
+L195: inc L28
+inc *r3
+; comment
+L196: red L241
+L197: .data 189, -246, 394, 815, -450, -756, 424, 702
+L198: cmp r7, #-244
+L199: rts
+L200: lea L223, r4
+clr *r2
+cmp #145, *r4
+L201: clr L141
+clr L240
+add X21, L215
+
+stop
+prn L92
+jsr X2
+lea X14, L237
+L202: .string "fgqp"
+; comment
+L203: .string "mavxqam"
+prn *r1
+red r4
+inc *r0
+jmp X5
+red r2
+not L107
+prn X15
+not L244
+rts
+lea L18, r4
+L204: add X20, X23
+jmp L10
+jmp *r6
+
+L205: .string "iw"
+not *r0
+jmp *r5
+dec L180
+bne *r2
+L206: inc *r1
+sub #-60, *r3
+prn L249
+prn X15
+bne L27
+cmp #179, r4
+bne L1
+clr r5
+red L244
+prn X9
+; comment
+jsr *r2
+mov r1, r0
+L207: .string "nwncojhqposhrtjmvfpceauh"
+cmp L248, r4
+mov r2, *r5
+red *r3
+add *r4, L201
+stop
+sub r4, L55
+L208: inc X1
+mov r0, X5
+L209: prn #-190
+L210: .data 820, 89
+red r0
+L211: .data 863, 978, -101
+L212: .string "xuqwunndz"
+dec X4
+
+L213: lea L199, *r7
+L214: jsr X22
+not L67
+jmp *r2
+L215: red *r0
+cmp L237, X19
+prn *r2
+rts
+jmp L100
+not r4
+L216: .string "hpifozotstvalibicw"
+L217: clr L152
+jsr *r0
+; comment
+L218: red *r0
+L219: .string "uszuidtrj"
+prn r5
+jsr L235
+L220: stop
+mov *r6, X1
+sub *r1, *r6
+lea L230, L174
+red *r7
+L221: red X6
+; comment
+bne L19
+
+lea X18, *r2
+add #111, r2
+not r7
+jsr L251
+mov *r1, *r0
+lea L257, r2
+; comment
+mov r1, *r1
+not *r4
+L222: jsr *r2
+rts
+bne *r2
+L223: .data 249, 486
+jmp *r7
+L224: stop
+cmp *r0, *r1
+L225: stop
+inc *r2
+not r7
+L226: add #-108, *r0
+inc L256
+; comment
+red X18
+prn r1
+red r7
+bne *r4
+cmp r4, r3
+L227: jsr *r5
+cmp r6, *r3
+
+rts
+L228: lea L248, *r1
+lea X12, r1
+clr *r7
+rts
+stop
+sub X8, L17
+L229: .string "pyhv"
+L230: inc X0
+red *r5
+L231: .data -705, 621, 693, -298
+stop
+rts
+L232: dec r2
+add L236, r1
+prn X14
+
+rts
+L233: add #233, *r3
+
+jmp L244
+rts
+L234: .data 380, -203, 484, 788, -387, 329, 676
+inc L243
+red *r7
+jmp X17
+lea L81, *r0
+jmp *r5
+red r7
+L235: .string "dwletrdcpia"
+L236: .string "adqtaawh"
+L237: add L246, L258
+L238: jsr *r0
+L239: clr r0
+L240: .string "nrhpw"
+L241: .string "umerrp"
+L242: dec L248
+mov X2, L240
+stop
+L243: jsr L15
+lea X18, *r6
+inc r6
+bne *r1
+L244: .data -787
+jmp X0
+cmp *r0, L260
+L245: not X7
+L246: .data -484, 102, -764, 951, -648, -586
+L247: dec r1
+L248: .data 386, -381, 515, -70, -302, 534, -466
+bne X21
+cmp r4, *r4
+red *r6
+inc *r0
+cmp r2, X21
+L249: .data -130, -228, -345, 981, 292, 283
+L250: dec r3
+bne X21
+L251: lea X17, L261
+mov L17, r6
+sub r4, r7
+sub X12, *r4
+mov L257, *r7
+rts
+inc L63
+L252: dec L159
+; comment
+L253: .data -421, -505, -386, 294, -715
+lea L173, *r3
+jsr *r4
+mov #19, *r1
+rts
+jmp *r7
+L254: add X22, *r3
+cmp #-179, r0
+inc L145
+prn #-21
+L255: cmp *r6, r5
+L256: lea X22, *r1
+L257: .data -434, 778
+prn r2
+bne X22
+dec *r3
+stop
+prn r4
+clr r5
+clr X20
+L258: prn L260
+lea L260, *r6
+L259: .data -665, -741
+jmp L261
+jsr *r6
+inc r5
+rts
+L260: red X10
+mov *r4, L123
+stop
+L261: lea L89, X2
+
+stop
+rts
+not L15
+stop
@@ -0,0 +1,1043 @@
+; Generated by genCorpus --seed 59
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+L0: lea X14, r6
+L1: dec *r3
+rts
+not *r6
+jmp *r1
+not X7
+jsr *r0
+L2: cmp #-23, r5
+inc *r3
+stop
+clr L0
+L3: inc *r2
+mov #-183, *r2
+red r1
+cmp *r4, *r2
+jmp *r7
+bne *r7
+not *r6
+clr L47
+bne *r7
+not r3
+L4: jmp *r6
+; comment
+mov *r0, r3
+prn *r6
+jsr L0
+red r7
+cmp #-229, X4
+L5: .string "hxqtcuzvizabtvmpi"
+jmp L153
+sub r5, *r6
+L6: bne X4
+L7: clr *r0
+not L115
+sub *r1, L6
+lea X19, r6
+clr r7
+L8: .string "sxucncvbaoftaof"
+jsr *r0
+L9: clr X8
+rts
+L10: jsr *r3
+red X17
+L11: rts
+clr r3
+rts
+stop
+L12: prn #-111
+sub *r1, *r7
+add X16, r6
+rts
+L13: inc r4
+L14: .data 719, 7, 925, 482, 2
+mov r5, L250
+
+add *r4, r1
+rts
+not *r4
+L15: .data -866, -278, 421, 860, -923, -988
+rts
+L16: .string "xannxexunjiauxjaerf"
+dec r2
+dec X14
+dec *r4
+cmp *r4, L159
+cmp #-103, #-146
+L17: clr *r5
+mov r2, X5
+prn r6
+rts
+sub r5, *r0
+add #-157, *r4
+rts
+add *r0, r2
+L18: not L53
+dec *r4
+rts
+mov *r4, r3
+rts
+L19: .string "kmyhtfdtjqyflbeib"
+L20: .string "zzhmxplzovdccit"
+L21: .data 3, 292, 922
+bne X6
+L22: lea L3, r6
+L23: cmp *r7, r7
+add X22, r0
+
+sub #116, *r7
+cmp #-45, #143
+sub #215, *r6
+L24: .data -631, -856, -719, -517, 100, -118, -430, -451
+clr L118
+bne *r5
+sub #-103, r5
+L25: jsr *r4
+mov #48, L18
+red r1
+L26: .string "z"
+rts
+add X19, *r2
+lea L0, r5
+not *r5
+L27: stop
+stop
+L28: jsr L12
+add *r4, r2
+mov *r6, L0
+jmp *r4
+L29: clr *r4
+red L116
+dec L25
+prn #139
+L30: .data 772, -936, -125, 639, 12, 106
+mov L144, r4
+L31: .data 398, -410
+jsr *r2
+L32: .string "rqkvwdvvw"
+stop
+cmp L58, L154
+not *r4
+L33: mov *r6, *r0
+stop
+red r3
+
+; comment
+L34: .string "gbwevqzcmtzbdzce"
+rts
+not L31
+inc *r0
+mov *r5, L28
+jmp X20
+add r1, X6
+L35: lea L94, r0
+L36: .data -440, 932, -215, -98, 832, 169, -905
+stop
+bne X0
+clr r5
+clr L202
+bne X8
+lea X7, r7
+L37: clr X1
+mov L32, r2
+lea X9, *r5
+clr X13
+L38: sub r4, *r0
+L39: .string "zwxwwwmugcrbuo"
+mov r2, r7
+prn r0
+L40: jmp *r6
+L41: stop
+mov *r2, r2
+clr L220
+red r0
+bne L27
+prn #246
+sub r1, *r3
+lea L6, *r6
+dec *r5
+L42: .string "kcjncumnfrdviricwi"
+mov #64, X20
+lea X3, X16
+cmp #-24, #-65
+mov r1, X8
+dec *r2
+jsr L38
+jsr *r5
+L43: clr *r7
+L44: .data -182, 26, -618, 812, 673, -185, -919, -884
+L45: prn #-29
+L46: bne *r1
+dec *r2
+red r6
+not L37
+sub *r0, L216
+not *r1
+L47: .string "joywcahdihdxfdvigqy"
+inc L87
+L48: clr r7
+stop
+lea X0, r5
+L49: .string "hmk"
+L50: stop
+sub #-82, r3
+clr *r0
+; comment
+add #194, *r0
+red r2
+L51: .data -374, 966, 568, 108, 333, 377, -816, 171
+inc r5
+stop
+not *r1
+clr X16
+L52: .string "uqbcxbnmvhuingh"
+jsr X12
+clr r2
+sub #-37, *r2
+L53: rts
+jsr *r2
+not r2
+; comment
+add #92, r0
+jsr X20
+L54: .data 231, -639, -409, 848, -142, -210
+
+red X16
+jsr L155
+L55: inc *r1
+inc r3
+prn X23
+L56: .data 132, -398, -485, -56, -684, 241, -457
+L57: .data 785, -718, 344, -674
+not L13
+prn *r6
+; comment
+jsr X2
+stop
+L58: dec L36
+prn r5
+stop
+rts
+red r4
+L59: rts
+mov L15, X13
+jmp X24
+L60: sub r0, L208
+L61: jmp *r6
+clr r4
+mov *r0, L41
+L62: .string "ifukmbpbn"
+stop
+
+stop
+rts
+sub r6, L47
+rts
+rts
+red r6
+cmp *r0, *r1
+L63: bne L238
+red *r0
+L64: .data -665, 139, -265, -618, 802
+L65: .string "nvblrwzdlelh"
+mov *r1, *r3
+L66: .string "vpz"
+L67: .string "wwbv"
+L68: .string "cqryigtajltosssrwqs"
+cmp r3, L23
+sub r6, *r0
+; comment
+L69: mov *r4, *r7
+L70: jmp *r1
+L71: .data -426, 806, 575, -520, 274
+L72: mov r4, *r4
+mov L57, *r0
+not X11
+jmp *r2
+add r0, L10
+cmp r7, #71
+lea X5, r7
+sub *r3, r2
+stop
+red L113
+prn #51
+L73: .string "cxhrad"
+cmp r1, X17
+not X22
+add *r3, *r4
+jsr *r3
+sub L67, X4
+inc *r5
+sub r3, X0
+not *r4
+
+bne *r3
+L74: inc X7
+sub #229, L100
+inc *r0
+L75: lea L237, *r4
+L76: prn *r2
+cmp r4, X9
+stop
+lea L8, X17
+rts
+L77: stop
+L78: add *r2, *r5
+L79: .data 455, -648, 969, 195, 911, -311, -813, 684
+prn #-201
+L80: bne *r1
+L81: jsr L252
+prn *r0
+L82: jmp L11
+L83: cmp *r2, X8
+not *r0
+lea X19, *r5
+add #-9, r5
+not L64
+not r2
+stop
+
+L84: clr X3
+L85: inc *r0
+; comment
+red r7
+mov r3, r6
+stop
+L86: bne *r5
+add r7, *r1
+rts
+bne L28
+rts
+add #-23, r6
+jmp *r7
+L87: dec r5
+clr *r5
+
+inc *r3
+clr L132
+L88: jsr *r3
+L89: .string "rvmppsuncxczwydwptvv"
+L90: rts
+stop
+L91: jsr L137
+L92: mov r1, r2
+red r6
+stop
+bne X5
+rts
+clr *r5
+jmp L188
+cmp r3, #-236
+clr *r6
+inc *r1
+jmp *r4
+L93: prn X24
+dec L41
+cmp L193, L184
+stop
+
+rts
+clr r1
+L94: jmp L106
+prn *r5
+lea X4, r3
+jmp L126
+dec L23
+L95: .string "ybmkvkdtkgyvh"
+L96: mov *r2, r7
+jmp *r1
+L97: .string "hsjttnvkbwbvs"
+not r6
+jmp *r6
+L98: .string "yydmtlwnorp"
+bne *r7
+sub r0, X8
+mov r3, r2
+L99: .data -780, -691, -137, -898
+jmp X22
+mov L140, *r5
+bne X24
+L100: not r1
+L101: .data -829, 987, -630, -276, -483
+lea L115, r5
+red r0
+lea X9, X24
+L102: .data 167
+lea X4, r6
+red r4
+rts
+L103: .data 814, -343, -80, -83, -629, -966, 367
+
+clr X4
+prn *r3
+prn #200
+red *r3
+L104: add r4, X18
+
+clr L6
+L105: not *r2
+lea L181, *r5
+L106: .data -570, 750, -902, 632, 993, 732, -346
+prn r0
+L107: dec X23
+stop
+lea X0, L217
+bne *r2
+not L61
+L108: lea X14, r0
+rts
+stop
+red r7
+add L85, r1
+dec r4
+L109: .data 121, 703, 953, 906, 666, -840, 317
+L110: .string "kcqz"
+L111: rts
+jmp *r3
+jsr *r0
+L112: inc r2
+L113: bne *r5
+L114: .string "dhiw"
+red *r3
+L115: sub r4, L122
+mov #-193, *r1
+jsr *r0
+jsr X17
+L116: jsr *r7
+red L239
+L117: .data -888, 537, -884, -289, 231
+jmp *r6
+L118: lea X15, r2
+stop
+clr *r5
+cmp *r7, *r6
+rts
+L119: .string "zohuov"
+add X23, X16
+dec r5
+L120: jmp *r7
+add *r5, *r1
+lea X1, r1
+
+sub *r4, r3
+dec *r2
+L121: jmp *r3
+prn #-228
+L122: .string "myfjwczldrqiujgajik"
+L123: .string "nkfpxlhhxbz"
+L124: .data -403, -759, -971, 950, -911, 421
+clr *r4
+inc L100
+prn *r6
+L125: .string "osmoycsqrenkyuszkpdm"
+add #80, *r7
+inc r6
+jsr *r7
+dec *r7
+bne *r4
+stop
+dec X0
+not r0
+rts
+inc r7
+inc r2
+inc L137
+cmp r1, L29
+red *r6
+red r4
+dec X22
+red X3
+clr r3
+dec L191
+L126: inc *r1
+mov #-28, r7
+stop
+red *r2
+jsr L43
+jsr L154
+rts
+sub r6, *r4
+not r3
+L127: stop
+L128: inc L251
+L129: prn *r1
+cmp #18, #101
+stop
+jmp X8
+L130: add r7, L11
+lea X8, r1
+jsr *r0
+mov #-183, *r4
+jsr L45
+L131: .string "pvtb"
+
+L132: .data 929, -286
+stop
+L133: .data -432
+L134: .data 695, 503, -12
+
+prn *r7
+mov X11, r2
+L135: add X3, L162
+mov #115, r7
+inc X15
+cmp #-2, *r5
+jmp *r2
+cmp *r1, r7
+mov L176, *r3
+bne *r5
+; comment
+mov X3, *r3
+dec r3
+cmp r0, r7
+L136: jsr X20
+sub #-49, r0
+dec r0
+red r6
+L137: .data 841
+sub r5, L254
+cmp *r3, *r6
+dec *r2
+dec *r4
+prn r6
+
+jsr *r0
+sub r3, *r3
+
+not *r2
+L138: .data -780, -418, 387, 756, 855
+
+not *r4
+L139: .string "cbjmduir"
+rts
+cmp L238, r3
+L140: .string "jbzsunssrqkstymykrr"
+L141: bne *r3
+L142: .string "saiasisjzvwoflh"
+bne *r5
+stop
+not r0
+
+add r6, r7
+stop
+lea X23, r3
+inc r6
+jmp X0
+L143: jmp *r3
+L144: .data -700, 248, -159, 467, 638, -490, -983, -187
+L145: .string "gvcsftihlv"
+dec r6
+L146: .string "nmiiqryshixccmngyvu"
+L147: .string "nxcyacwvwrjhubcjugdlsg"
+L148: lea X5, X0
+sub L156, *r0
+L149: rts
+stop
+red *r0
+bne L66
+stop
+L150: add *r6, r7
+stop
+L151: lea L170, *r2
+stop
+jsr *r0
+stop
+bne *r1
+sub r0, L179
+rts
+L152: rts
+prn r1
+dec r2
+clr *r5
+L153: .data 705, 603, 831, -19, -456, -2, 507
+red L145
+lea X20, X9
+rts
+lea X2, *r7
+L154: not *r1
+cmp *r1, *r3
+jmp *r7
+prn r5
+dec L205
+cmp #115, r4
+add r1, X24
+jsr X20
+prn #-110
+red *r7
+
+L155: bne *r1
+L156: jmp L122
+red X15
+dec *r2
+L157: .string "crfehroxcc"
+jsr L136
+inc *r5
+prn L100
+L158: dec L10
+L159: jmp L147
+mov *r6, *r6
+stop
+jmp *r7
+jmp *r7
+jmp L127
+mov L56, *r3
+lea X9, r0
+red *r0
+mov L190, r4
+L160: lea L235, X20
+not X15
+rts
+L161: cmp #134, L213
+stop
+L162: rts
+bne *r6
+rts
+L163: prn X18
+clr *r1
+dec *r0
+mov #-112, r2
+cmp *r2, X19
+lea L250, L58
+not X13
+lea L131, L118
+L164: clr *r1
+clr L189
+rts
+L165: .string "bncpzbcu"
+cmp L109, X24
+lea X4, *r3
+sub *r2, *r5
+red *r6
+lea L120, *r5
+cmp #-55, #173
+mov L224, r6
+clr r1
+red r1
+lea X7, L96
+jsr *r0
+L166: .string "xrkbygkifofw"
+jsr L148
+stop
+L167: jsr X11
+dec *r1
+clr r7
+L168: .string "mlpyuytlvcedndwjkmrdvq"
+lea L233, r6
+lea X3, *r0
+
+; comment
+L169: .string "ldgmjsyfy"
+dec *r4
+clr r5
+L170: .string "mmkukeyerbkrrvg"
+inc *r2
+jmp *r7
+mov L65, r0
+sub *r3, *r7
+not *r5
+L171: prn #-157
+inc L149
+lea X4, r1
+add r4, L186
+jmp *r6
+stop
+L172: stop
+L173: lea X14, r1
+not r3
+lea X0, X6
+inc r2
+dec *r0
+bne *r3
+prn #211
+lea L187, r5
+stop
+jsr *r3
+L174: not *r2
+inc *r1
+bne X5
+bne *r1
+sub r6, r0
+add L176, r7
+mov #34, *r0
+bne *r3
+mov *r5, r7
+add L184, L201
+not r6
+stop
+; comment
+L175: not L31
+dec L108
+clr X7
+sub *r7, L36
+bne L178
+red *r0
+sub r1, X7
+bne L238
+jsr *r7
+stop
+dec X23
+add *r0, L14
+mov X2, L161
+; comment
+L176: jmp *r3
+stop
+
+clr r1
+L177: clr r4
+L178: lea X13, *r7
+sub #3, L116
+L179: .string "lapcioj"
+jmp X14
+not X9
+red X16
+prn *r1
+sub L82, *r0
+L180: .data -223, 901, -30, 184, -312, -228
+cmp *r5, #111
+red *r0
+prn #-201
+mov X22, *r0
+
+add *r2, *r2
+bne *r1
+mov r2, r0
+bne *r2
+prn X22
+inc r3
+not X5
+L181: dec *r5
+L182: stop
+bne L98
+prn L247
+sub r7, *r4
+stop
+jmp X3
+L183: .data 653, 86, 433, -20, 885, 450, -859, 78
+L184: jsr *r5
+L185: bne *r4
+L186: cmp *r3, X24
+clr L78
+clr r0
+dec *r6
+inc r4
+prn r5
+L187: prn #-21
+stop
+mov #-200, *r1
+dec r6
+rts
+prn r0
+red X5
+dec r5
+jmp X20
+L188: bne L199
+; comment
+inc r4
+L189: clr *r2
+dec X13
+red X18
+dec *r4
+lea X11, X15
+jsr *r7
+clr L230
+L190: .string "ktu"
+lea L130, *r6
+not L246
+L191: cmp r6, X17
+add #-190, *r0
+jsr *r7
+dec *r4
+jmp X9
+L192: lea L0, r4
+not r2
+L193: stop
+bne *r5
+bne *r6
+cmp r4, *r2
+inc *r6
+cmp X15, *r7
+inc X19
+bne *r1
+mov L129, *r6
+L194: .data 691, -119, -163, -507, -880
+stop
+red r3
+
+cmp #208, L239
+red L24
+add r1, r0
+add #183, r5
+L195: jsr *r6
+clr r1
+prn *r7
+rts
+lea L208, L221
+sub L200, r2
+L196: inc r6
+L197: .string "vxgrxkmqacjv"
+jmp X20
+lea L254, L218
+
+cmp *r7, *r6
+lea X9, r3
+cmp #-194, X18
+L198: .string "txkuqlvvmwdposi"
+lea L12, r0
+sub #-61, r4
+mov r4, X11
+; comment
+sub *r4, *r4
+
+jsr L199
+stop
+cmp *r5, *r2
+L199: .data 200
+L200: .string "ednhlhzysbguuhdqhfmut"
+inc *r7
+L201: .string "acsvaqooqnmmkfbe"
+rts
+bne X20
+; comment
+; comment
+stop
+L202: jmp *r5
+L203: mov #-209, r5
+add L208, r5
+clr r4
+L204: bne L177
+dec L239
+sub r1, L83
+L205: jsr *r4
+; comment
+add #243, r0
+sub L147, X17
+L206: sub r4, *r7
+not *r0
+dec r4
+red *r0
+dec L235
+stop
+mov r5, *r3
+sub X15, *r7
+jsr L27
+sub #69, r3
+red L4
+red L233
+L207: sub #128, r0
+L208: .data 947, 697, 644
+clr r6
+L209: not r3
+add #-191, r5
+not r0
+cmp *r5, r0
+not *r7
+cmp X17, r5
+cmp L236, r1
+inc r2
+not *r3
+lea X13, r6
+jmp *r3
+L210: inc *r0
+stop
+clr r2
+clr L254
+sub r6, L214
+not *r5
+mov L57, r4
+mov X12, r1
+L211: stop
+stop
+inc *r6
+mov L49, r7
+
+clr r6
+not *r5
+inc *r0
+jsr L247
+L212: lea L74, X6
+L213: mov *r1, r7
+mov #-26, r1
+L214: .string "jndmxeyll"
+L215: .string "vbxkxrhmddwpohnlgbkj"
+dec r0
+lea L236, L217
+stop
+L216: jmp *r2
+rts
+not X2
+stop
+L217: stop
+L218: .string "yhacpzipaxaerhysz"
+L219: .data -228
+prn r7
+add r3, X17
+L220: .data 914, -615, 801, 372, -30, 402, -756
+red *r7
+prn r0
+L221: clr X6
+L222: not *r4
+bne *r6
+; comment
+jmp L88
+lea X19, r5
+L223: .string "narherhcbodkyvllumzerz"
+stop
+cmp *r0, L62
+rts
+red r0
+L224: .data -344, 334, 222, 137, 348, -299, -79
+L225: jsr *r1
+L226: .string "eerq"
+prn #7
+add *r0, L232
+jsr *r0
+inc L246
+L227: lea L135, r1
+jmp *r3
+clr r6
+jmp *r0
+L228: .data 429, 822
+red r7
+rts
+jsr L20
+jsr X7
+clr L224
+stop
+
+sub #235, L247
+stop
+rts
+lea L232, r7
+bne L211
+L229: .data -854, -543, -110, -24, 995, -893, -293
+prn r3
+L230: .string "jyf"
+sub *r6, L212
+L231: .string "ecpmcrvqymongvs"
+L232: red X13
+bne *r4
+bne *r0
+clr *r1
+add X0, *r0
+prn *r6
+L233: rts
+cmp L248, L190
+clr L159
+L234: sub X16, *r3
+prn #-74
+L235: jmp *r3
+L236: lea L191, *r5
+stop
+inc L204
+red r4
+jsr *r1
+clr L141
+jmp *r0
+stop
+prn *r5
+not r6
+lea X12, L251
+L237: bne *r0
+L238: .data -298, 325
+add #-48, *r4
+lea X24, *r0
+sub r2, r1
+red X23
+clr X2
+red L7
+L239: .data 164, 84
+L240: prn r5
+L241: inc r7
+inc *r2
+L242: .data -312, 744, 856, -841, 708, -153
+jsr X24
+rts
+jsr X9
+cmp r1, *r1
+inc *r2
+L243: .string "odggfiy"
+L244: add L252, r2
+mov X20, *r4
+mov #41, r1
+lea L238, r0
+dec r2
+rts
+prn r7
+inc r4
+jmp X6
+not L247
+mov r3, r7
+L245: stop
+L246: cmp r6, #-74
+lea X8, r2
+rts
+L247: .data 800, -787
+L248: .string "izbjwuoujfsignrhiiphrsk"
+sub #-156, X6
+L249: red *r0
+rts
+inc r3
+L250: add #119, *r2
+add r5, X14
+mov *r0, r5
+lea X11, r4
+add *r1, r5
+L251: bne *r3
+dec *r4
+mov *r4, L254
+jsr *r5
+clr r4
+rts
+red L57
+L252: .string "iksqydyeevjxjxsivsunboz"
+add #159, r5
+L253: .data 475, 559, -729, -281, -991, 534, -561
+L254: jmp *r7
+; comment
+L255: sub #-18, r4
+not *r1
+jsr *r0
+prn X24
+stop
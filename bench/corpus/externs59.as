@@ -0,0 +1,1045 @@
+; Generated by genCorpus --seed 60
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+L0: lea L57, r6
+add #129, X6
+sub r3, *r2
+L1: clr L0
+cmp L210, L0
+L2: clr X23
+jmp *r0
+inc r6
+; comment
+clr *r1
+clr r6
+; comment
+L3: bne *r0
+prn r2
+stop
+L4: .string "sguinbwyog"
+sub #-11, L4
+inc r3
+L5: lea L74, r7
+L6: .string "qpnqyb"
+inc L0
+bne *r5
+rts
+L7: dec L3
+L8: prn L55
+cmp #-43, *r4
+L9: red L41
+rts
+L10: .string "mscky"
+L11: .data 770, -919, -258, -879, -835, 711, 680
+not X20
+stop
+prn X1
+lea L26, L0
+sub #-242, r6
+; comment
+L12: .data 845, -620, -961, -263
+lea X14, *r4
+not *r6
+L13: rts
+; comment
+jmp *r0
+jsr L0
+dec *r4
+jmp X3
+L14: not L100
+mov *r0, X15
+L15: .string "uapkebtn"
+lea L10, X5
+
+L16: .string "x"
+not r4
+L17: .string "et"
+jmp X3
+L18: .string "xqsrakkbkvub"
+prn #143
+prn *r3
+bne L203
+red r1
+; comment
+mov X20, X8
+L19: .string "qatjypys"
+inc X14
+bne *r1
+dec *r3
+L20: jmp *r5
+L21: jmp X8
+mov r4, X15
+bne *r7
+L22: red r2
+cmp X11, r0
+add X4, *r2
+rts
+L23: .data 846, -229, 358, 193
+L24: red r0
+stop
+add #-154, X6
+not *r6
+jmp L26
+mov *r0, r4
+L25: inc r6
+jsr *r5
+L26: lea L21, r2
+; comment
+not *r3
+dec L53
+jmp L15
+L27: clr r7
+lea X23, *r3
+not *r1
+rts
+clr *r4
+L28: .data -171, 49, 849, -169, -895, -260
+L29: not *r6
+jmp L103
+dec r4
+cmp X1, r4
+L30: sub *r0, X12
+rts
+L31: .data 653, -823
+rts
+prn X4
+dec L29
+rts
+L32: bne *r1
+clr L124
+cmp #77, r0
+dec L24
+L33: .data -804, 533, 185, 695
+; comment
+inc r4
+clr *r3
+stop
+sub r4, *r1
+cmp L15, L11
+not *r6
+mov r5, L19
+clr *r5
+jsr *r0
+cmp *r7, r0
+stop
+L34: .data -381, 609, -564, 237, 311
+lea L33, *r0
+stop
+L35: red *r6
+L36: rts
+bne X17
+sub r7, *r4
+rts
+L37: prn L1
+prn r7
+inc r1
+sub r3, *r7
+; comment
+lea X9, *r4
+mov r6, *r5
+stop
+inc X22
+sub X18, L26
+mov r7, L24
+not X7
+lea L35, L24
+bne L175
+jsr L230
+L38: .data 596, -48
+add L56, L165
+bne *r4
+add *r6, *r7
+L39: .string "jelaqeqoszzvmixrhjqy"
+L40: stop
+rts
+
+; comment
+sub L97, r5
+sub *r5, r5
+rts
+clr *r6
+lea L164, X10
+prn r7
+red *r2
+L41: jsr L3
+clr X18
+jsr *r2
+prn *r3
+prn #59
+bne L12
+dec X7
+clr r7
+jsr *r1
+L42: .string "cgxqbuasvjtqkoqlfmmwdk"
+prn L141
+dec L141
+cmp #249, #-252
+sub *r3, X1
+L43: cmp r6, #-194
+mov #-30, *r2
+clr r3
+prn #-96
+add *r3, *r1
+red L19
+mov L222, r3
+cmp #63, *r3
+red *r6
+L44: .data 505, -854, -515
+L45: mov #-52, r2
+dec r0
+L46: .string "huyfguxgtfb"
+rts
+L47: stop
+cmp *r2, *r3
+red r4
+stop
+rts
+; comment
+prn *r0
+mov #253, r2
+L48: .data -461, -728, -834, -58
+L49: stop
+add r2, *r5
+L50: .data -787, -477, -279, 413, 533
+dec *r5
+L51: .data 851, -11, 592, 939
+inc *r1
+stop
+
+L52: .string "y"
+cmp #181, r4
+inc r0
+bne X1
+stop
+; comment
+red X15
+mov L151, r2
+L53: jmp L96
+clr r6
+sub *r3, r6
+not r6
+mov *r6, *r3
+prn r1
+L54: add #-168, X18
+clr r5
+; comment
+jmp X10
+L55: .string "jstoeihaarepajszvsldzwx"
+L56: .string "bmshkcxhitb"
+prn *r1
+L57: inc *r1
+clr *r5
+inc *r0
+mov *r5, *r0
+L58: cmp #20, *r4
+rts
+jsr *r5
+mov #70, L10
+L59: .string "p"
+not X24
+inc L20
+prn L37
+mov #222, *r3
+L60: inc L178
+dec *r5
+add L169, r2
+jsr *r3
+jmp L83
+red r2
+L61: red L49
+sub L195, r2
+not *r1
+L62: .data 270
+stop
+bne *r4
+not L145
+mov *r5, *r6
+clr L57
+sub #-21, *r5
+jmp L132
+prn *r2
+stop
+mov r0, *r5
+bne X2
+not L182
+dec L208
+bne L6
+L63: not r4
+; comment
+bne *r2
+
+L64: jmp L50
+cmp *r3, #-78
+inc X24
+red *r2
+jsr *r5
+inc *r5
+not *r4
+L65: sub *r6, r2
+red r6
+L66: red r3
+L67: lea L169, *r2
+L68: bne *r6
+
+lea L66, *r2
+lea X22, *r3
+add L162, L248
+
+L69: .data -701, 786, -300, -299, -325, 741, -42
+L70: red r4
+lea L273, L160
+jsr X16
+L71: sub *r2, *r6
+inc r2
+stop
+clr *r3
+L72: jmp *r3
+L73: .string "ebyccujzcyrrut"
+jmp X18
+bne *r7
+rts
+jmp *r5
+jmp L153
+dec *r2
+red *r4
+clr L21
+stop
+not *r6
+L74: mov r2, r3
+lea L201, L56
+L75: .data 809, 309
+L76: .string "ljynpu"
+stop
+jmp *r7
+L77: inc r3
+L78: jmp L20
+prn *r5
+inc *r6
+lea L33, L37
+lea X16, r3
+L79: clr r2
+not r6
+not *r6
+red L52
+L80: add L210, L156
+L81: .data -782, 162, -3, -613, 727
+rts
+mov #-193, *r0
+clr X19
+lea L16, r6
+L82: cmp *r6, #139
+L83: .string "sglnmduqofxfshf"
+add r4, *r7
+rts
+prn *r1
+bne L194
+L84: stop
+red L266
+L85: jsr X19
+L86: sub *r5, L60
+L87: .data 186, 625, -272
+not *r2
+clr *r4
+clr *r6
+L88: not r7
+
+L89: prn #166
+cmp #-176, X22
+bne X24
+lea L130, r0
+; comment
+cmp X8, r7
+dec r5
+L90: lea L71, r2
+jmp X23
+lea X16, r4
+add L229, r6
+stop
+L91: prn X3
+inc X16
+add r6, *r6
+cmp r6, *r4
+clr L10
+lea X2, r5
+lea L148, *r3
+not L82
+not *r0
+; comment
+; comment
+sub *r0, L53
+cmp r0, r1
+mov #94, *r0
+not L202
+L92: lea L60, *r5
+L93: .data 642, -710, -288, 23, 56, 187, -139
+sub #70, *r1
+L94: add r0, X16
+sub X21, *r7
+jsr *r2
+stop
+rts
+
+jsr L22
+cmp X11, *r4
+prn r1
+L95: lea L46, *r6
+add *r5, L207
+dec *r4
+clr L121
+not L68
+prn *r1
+clr r4
+cmp L185, *r6
+inc *r1
+prn *r7
+jmp *r4
+dec L11
+L96: not X22
+cmp X22, r7
+not *r3
+dec r0
+mov r1, r1
+L97: lea L83, r0
+add r2, L157
+not *r6
+not *r4
+jsr L11
+mov *r3, *r2
+L98: prn r4
+L99: bne *r4
+L100: rts
+L101: sub L261, r1
+jsr X22
+not L59
+L102: .string "nsoeftzxurxwoger"
+L103: .string "hickxemxlubt"
+L104: stop
+L105: .string "niyhucpobpohgjx"
+jsr *r0
+clr L78
+add X14, *r6
+not r6
+stop
+mov #-9, r3
+L106: .data 111, -990, 569, 384, -350, -928, -486
+lea X0, *r5
+dec r3
+clr *r3
+red L12
+inc X15
+L107: stop
+inc L26
+L108: .data 337, -911, 636, -397
+jsr L163
+lea X15, L229
+sub r5, r1
+add L107, r7
+L109: .data -276, 429, -933, -643, -158
+L110: prn X19
+prn #-248
+L111: mov #-138, L232
+L112: .string "yjkfspoxcwrnuysktkro"
+L113: lea X22, X23
+add L102, X18
+L114: .data 43, -14, -181
+L115: .string "b"
+jsr *r0
+clr r5
+add *r4, L43
+sub #-73, *r1
+clr L83
+prn X23
+red r6
+L116: mov r6, *r3
+clr *r0
+L117: .string "moxbiekghjyekurbwcxn"
+rts
+red r5
+L118: .data 878, 846, -876, -722
+not L192
+jmp *r4
+L119: bne X14
+jmp L223
+L120: red r1
+stop
+dec r4
+L121: jsr *r3
+stop
+L122: cmp r5, r1
+bne X10
+red r6
+L123: .string "dxu"
+lea L49, L271
+jsr L57
+rts
+prn *r4
+jmp *r3
+clr r4
+L124: .string "dlbtvtjbsoeftagefjd"
+bne X9
+inc r1
+L125: clr r1
+sub r0, L133
+sub *r5, L264
+L126: red r2
+rts
+sub r4, X4
+red *r6
+rts
+not L234
+lea X22, *r5
+; comment
+dec r2
+L127: stop
+cmp *r1, *r1
+cmp *r1, #60
+rts
+mov L163, r6
+inc *r5
+rts
+L128: .data -868, 308, -368, 456
+rts
+rts
+
+L129: stop
+L130: .data 437, 47, -76, 812, -554, -237, -516
+stop
+L131: lea L79, r5
+lea X1, *r4
+cmp *r2, #210
+inc X19
+lea X15, *r7
+clr *r3
+clr *r4
+sub L264, *r1
+rts
+L132: .string "fwxjz"
+stop
+L133: .data -729, -273, -150, 475
+not *r1
+L134: .data -108, -850, -306, -909, -69, -272, -637
+L135: .string "cqtpmxrumcb"
+L136: .string "rzgogiedokmyosmhu"
+dec L36
+prn *r1
+mov *r6, r0
+stop
+L137: red L229
+L138: .data 768
+jsr *r4
+L139: cmp #-3, #-193
+L140: bne X20
+stop
+bne *r3
+bne *r3
+red r6
+L141: red X8
+clr *r5
+add *r2, L88
+stop
+L142: .string "rihbtyedebjjkxgzny"
+prn r7
+add #-183, r1
+red L7
+inc L84
+inc r6
+L143: mov *r4, X1
+L144: prn *r2
+lea X3, *r3
+red L223
+not X20
+stop
+clr r1
+cmp *r3, L233
+cmp r5, *r5
+L145: .string "piwkffiq"
+L146: .data 329, -839, -68, -323, -580, 855, -16
+sub L135, r6
+; comment
+L147: .string "fcbuozqr"
+clr L191
+L148: .string "skrbqpirclhurfvadhukf"
+clr *r7
+clr r6
+L149: .data 126, 516, -970, -211, 499, -166, -712
+prn #-76
+lea X8, *r6
+inc r6
+L150: sub r5, *r4
+lea L52, r7
+not r6
+clr *r6
+lea X7, *r5
+dec *r4
+bne X14
+stop
+add L184, X21
+L151: stop
+clr X14
+add *r2, *r5
+L152: add r7, r3
+jmp L27
+jmp *r1
+L153: prn *r2
+bne *r7
+inc *r4
+stop
+dec r1
+L154: red L218
+jsr X19
+not r6
+jsr *r2
+clr r4
+jmp L89
+L155: rts
+L156: sub r4, *r7
+; comment
+red r5
+dec X7
+inc r7
+L157: red L28
+clr *r6
+not r4
+L158: .data 591, 235, -146, -165, 851
+; comment
+dec r7
+L159: .data -747, -553, 852, -259, 275, 541
+prn r7
+cmp L38, X15
+L160: not *r0
+jsr L228
+jmp *r2
+jmp *r5
+dec *r1
+L161: clr *r4
+L162: jmp X8
+lea X12, L26
+; comment
+cmp r2, *r1
+L163: .string "idplppoxqsim"
+rts
+lea L223, L45
+jmp X15
+stop
+
+L164: not r5
+prn #7
+add L106, r6
+jmp *r0
+L165: bne L264
+cmp X18, L223
+inc L226
+not r3
+cmp #-177, L55
+L166: .data 407, 204, -288, 311, 841, -686
+inc *r5
+red X8
+bne X22
+jsr *r1
+add *r3, *r6
+L167: .data 835, -706, -662, -29, -585
+red r6
+jmp L234
+L168: .data -167, 999, -793, -889, -23, 9, -385
+L169: rts
+mov *r5, *r7
+L170: jmp *r7
+L171: .data -296, 201, 973, -866, -711, 708, 746
+prn *r5
+red *r6
+clr X24
+lea L84, r2
+rts
+dec *r0
+inc L215
+L172: .string "kmgfvfuscqhkimmnuklufrya"
+L173: .data -563, 443, -621, 863
+L174: clr r4
+L175: .string "t"
+dec r1
+mov L184, r6
+L176: red X24
+jsr L88
+rts
+not *r0
+L177: .data 540
+sub #-94, L160
+L178: .data 466, 576, -414, -913, 579, 908, 661, 652
+jsr *r4
+jsr *r5
+mov *r7, r4
+prn #-227
+rts
+; comment
+sub r1, r4
+L179: .data 728, 581, 486, 316, -123
+; comment
+L180: .string "plrhjqjryabvjddwnzlqof"
+L181: jsr L42
+red r1
+L182: .data 818, 159, -690, 843, 916
+inc *r0
+dec L218
+L183: inc *r0
+jmp *r0
+inc *r4
+L184: .string "mxzfciyzvrnbtkgwrjeiewj"
+red r3
+sub #185, *r1
+L185: red *r5
+L186: cmp *r0, L217
+bne *r0
+lea L171, X6
+add *r5, X2
+L187: clr *r4
+L188: stop
+lea L230, r4
+L189: jmp X16
+jmp *r0
+L190: .string "auibghrebijafbnskpjxutlu"
+mov L182, r1
+rts
+prn L216
+cmp r1, #245
+cmp r2, L34
+L191: jsr *r2
+cmp #219, r6
+jmp *r3
+clr r6
+jsr *r2
+jsr L105
+dec r2
+stop
+jmp L199
+L192: .string "pkulllmhs"
+red X20
+L193: bne *r1
+bne L138
+L194: red L73
+L195: .data -238, -97, 381, -436
+; comment
+jmp *r4
+L196: stop
+L197: prn #-177
+lea L180, r2
+not r6
+L198: inc X21
+stop
+prn r2
+L199: bne *r3
+not L150
+sub #-210, X22
+L200: .string "mnfapwbbwlsnxtyiwftq"
+jsr *r3
+lea X4, *r1
+inc X19
+bne X24
+mov r6, r4
+red r4
+clr X12
+jmp *r2
+L201: .data -57, -88, 802, -748, 898, 39, -68
+not *r4
+L202: .string "je"
+not *r1
+not *r5
+bne X18
+red r0
+add r5, *r3
+L203: mov *r4, *r6
+cmp #4, *r3
+L204: cmp r2, X0
+jsr *r2
+bne X9
+
+sub r0, *r5
+sub L131, r6
+not L244
+lea L199, X2
+prn #-156
+L205: .data -794, 95
+prn *r1
+L206: sub L231, L251
+red r5
+not *r7
+L207: red r3
+mov #198, X1
+L208: mov *r6, *r3
+dec X2
+inc r5
+jmp L230
+inc *r5
+L209: mov #-115, r1
+L210: .string "eluqw"
+L211: lea L263, L70
+L212: cmp *r2, #89
+rts
+rts
+L213: clr X15
+dec X0
+mov *r7, *r5
+jsr *r6
+mov *r2, L94
+L214: prn X24
+sub *r5, X15
+lea L98, *r5
+L215: mov *r1, r7
+prn *r0
+L216: mov X17, *r2
+add *r6, L257
+lea X11, L72
+L217: .string "pzassxtyal"
+L218: .string "lwwhudeeiwrdzowute"
+stop
+red r3
+bne X24
+L219: .string "mwycfu"
+L220: stop
+L221: add #159, *r2
+jmp L186
+L222: dec L16
+mov #138, X17
+L223: .data -15, 110, 897, 788, -645, -196
+prn r0
+bne L179
+prn r2
+L224: .data -34, -198, 11, 782, 522, 870, -885, -566
+prn #82
+L225: inc r2
+bne L269
+dec r1
+L226: .data 643, 605, -529, -386, -651, -366
+mov *r4, r5
+L227: clr r6
+L228: stop
+L229: .data 889, 112, -73
+bne *r2
+L230: prn X5
+L231: cmp *r1, r4
+L232: not X4
+jmp *r7
+dec L242
+prn L259
+jsr *r7
+inc *r4
+L233: jmp X7
+prn X22
+dec *r4
+add *r5, r7
+jmp *r2
+not r0
+L234: not r4
+clr *r0
+inc X0
+add *r2, X15
+add #-31, L264
+jmp *r7
+L235: not r1
+L236: clr L266
+L237: bne L247
+L238: jmp *r3
+; comment
+inc X16
+L239: .string "wqkklskgildjuursnrr"
+prn #-256
+bne *r6
+red r6
+not *r2
+; comment
+not r4
+not L248
+bne *r1
+jsr X22
+not r5
+inc *r5
+cmp *r6, r7
+lea L115, L21
+prn *r4
+mov X6, *r1
+L240: bne L179
+L241: stop
+mov r2, L107
+L242: inc L256
+not *r0
+dec r2
+rts
+jsr *r2
+stop
+cmp *r2, #-208
+L243: prn r1
+L244: clr r4
+mov L272, L31
+rts
+L245: .data -398, -584, -222, 855
+L246: stop
+dec X7
+lea L262, L175
+clr L126
+cmp #-44, r6
+jsr *r4
+not *r2
+stop
+L247: lea X23, r6
+not *r1
+jsr L271
+not r6
+L248: prn r5
+cmp #244, #136
+jmp *r7
+L249: .data -659, -609, 530
+prn L69
+cmp #140, L132
+red L255
+L250: prn X15
+mov *r7, *r4
+bne *r6
+jmp *r4
+prn X1
+rts
+L251: sub L161, *r1
+L252: lea X24, *r0
+clr *r7
+dec L203
+sub *r3, L61
+dec L84
+sub X18, L69
+L253: .string "fofhhsndfj"
+bne L273
+L254: add #-232, X3
+; comment
+not *r7
+jsr L67
+bne *r4
+L255: .data -228, -575, -720, 21, 100, 759, 342
+stop
+mov L272, *r1
+prn *r7
+L256: .string "ovhowubpzg"
+add X2, *r1
+L257: .string "rdkgletmsxpceavbsckvp"
+L258: not r5
+cmp X10, *r0
+rts
+red r4
+not *r1
+prn L268
+; comment
+jmp *r0
+L259: bne *r3
+red r3
+not *r3
+rts
+mov #-64, *r3
+rts
+L260: red L267
+lea L264, *r1
+inc X2
+mov #249, *r0
+rts
+L261: .data 646, -778, -881
+lea X11, r4
+not L53
+mov r5, r7
+not *r1
+mov L51, r2
+mov r1, *r7
+L262: rts
+L263: red L71
+L264: inc L268
+add *r0, r0
+cmp *r2, #-44
+stop
+not r1
+inc L30
+L265: add r4, L271
+mov *r2, r7
+dec r0
+dec r1
+add r1, r4
+red L268
+lea X16, X4
+sub r5, X12
+lea X23, r7
+L266: rts
+clr L155
+L267: cmp *r1, *r4
+clr *r2
+bne L53
+add #-159, *r2
+not X0
+stop
+stop
+mov X20, X6
+inc *r6
+L268: clr r2
+jmp *r4
+lea L272, *r1
+red r4
+L269: .data -463, 0, 388, -860, 916, 198, -975, 488
+dec L251
+L270: not *r6
+not r1
+inc L273
+not L273
+bne X5
+sub #-37, L273
+clr r6
+L271: red X17
+dec r1
+dec *r6
+L272: jsr *r6
+jsr L152
+mov X21, r0
+L273: dec *r6
+lea X22, r1
+mov r2, r1
+jmp L274
+stop
+jmp L274
+mov L90, r5
+prn *r1
+jsr X23
+mov X2, L274
+L274: .data 8, 658, 952, -602, -280, 597, 511
+stop
@@ -0,0 +1,1044 @@
+; Generated by genCorpus --seed 7
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+L0: jmp *r6
+add *r3, *r5
+jsr X12
+L1: cmp #-66, r1
+L2: jsr X19
+cmp #126, r2
+sub r1, *r0
+L3: prn #232
+L4: jsr *r2
+dec *r5
+L5: red r0
+; comment
+prn *r4
+jsr *r3
+red r2
+inc *r6
+L6: red *r0
+dec r3
+red L5
+sub *r5, X13
+dec *r2
+not X5
+not L3
+mov r6, *r6
+L7: .string "dpygbsccclzvhxiqcsnxid"
+mov #-185, L7
+red *r2
+stop
+L8: .data -47, 756, 402, 796
+L9: jmp *r0
+clr X15
+L10: prn *r5
+L11: stop
+L12: .data 915, -642, -854, 899, -141, 49
+L13: clr X12
+inc *r4
+dec X18
+prn X7
+not r2
+stop
+L14: .string "mwtwkbrkfscyh"
+sub #203, X10
+L15: .string "vsutxwhe"
+red r1
+L16: inc L14
+lea X8, r6
+lea L0, r2
+L17: .data 258, -446
+L18: stop
+bne L16
+red X22
+mov L4, *r0
+clr L18
+jsr L236
+prn L147
+sub #-20, r6
+sub r4, r1
+prn *r4
+rts
+L19: bne *r5
+bne L196
+not *r7
+cmp r7, *r4
+L20: bne *r5
+red r5
+L21: .string "gbptemjrckresvew"
+bne *r6
+prn L5
+dec *r5
+L22: .string "g"
+dec *r6
+add #-256, L4
+L23: .data -487, 899, 684, 356, -288
+L24: rts
+L25: add X6, r5
+jmp L14
+prn r0
+L26: stop
+stop
+sub #147, *r5
+mov r3, L4
+; comment
+red *r7
+prn *r1
+red *r4
+L27: clr r3
+L28: .string "xzbksah"
+clr *r2
+bne *r5
+not L15
+L29: .string "zypcjydhoa"
+rts
+
+L30: .string "yaioadecnik"
+; comment
+L31: red *r1
+L32: lea L246, r5
+mov #78, r3
+stop
+bne X2
+cmp *r7, *r0
+
+L33: jsr L139
+cmp L93, *r1
+lea L22, X8
+; comment
+add *r6, L1
+
+bne X20
+red L8
+prn #-63
+L34: inc *r1
+L35: inc r5
+lea L8, r5
+stop
+jmp *r5
+bne *r4
+stop
+rts
+L36: .string "hlscflbqhlrnj"
+bne *r4
+sub *r4, *r2
+bne L15
+stop
+jmp L11
+L37: .string "hoioxntumqsbqsairkwmpzi"
+lea L33, *r4
+inc *r6
+inc X17
+cmp #-170, *r7
+red X14
+rts
+jmp *r4
+jmp *r3
+inc r3
+jsr *r1
+; comment
+inc L250
+L38: lea L117, r7
+L39: .data -243, -982, -727, 565, -594, -596, -205, -100
+L40: .data -161, -697, -606, 882, -197, 737
+not r0
+rts
+L41: dec *r6
+lea L18, *r5
+L42: jmp *r0
+lea L6, r5
+sub r5, *r3
+stop
+prn r2
+jsr X14
+prn r6
+red X20
+
+bne *r1
+L43: .string "lezieudob"
+rts
+dec *r4
+inc L39
+cmp r0, *r3
+; comment
+rts
+; comment
+L44: inc *r4
+bne *r7
+lea L32, r4
+add X23, r1
+L45: .data -229, -170, 654, -39, 177, 694, -451, -938
+L46: .data 22, 469, -975, -916
+not L20
+lea X24, L26
+cmp X8, X0
+mov #-166, *r4
+L47: .data -133, 490, -787, -56, -582
+red *r3
+rts
+bne X18
+L48: jmp *r1
+stop
+L49: rts
+lea L141, X23
+L50: lea X11, *r2
+L51: clr *r4
+sub *r2, L63
+
+L52: sub *r2, X1
+bne *r0
+prn *r4
+clr r0
+jmp *r2
+jmp L40
+inc r5
+L53: rts
+sub #170, L13
+L54: jmp L18
+jsr X19
+dec X10
+inc L194
+add r4, L205
+cmp *r5, L30
+inc r1
+rts
+; comment
+bne X17
+L55: clr L188
+stop
+jsr X11
+L56: rts
+not *r0
+clr *r5
+stop
+L57: inc r0
+L58: .data 465, 505, -2, 608, 293, 269
+dec L141
+stop
+cmp #187, *r1
+add X20, r3
+L59: jmp L200
+mov X15, r6
+inc r4
+add L6, X13
+bne X10
+clr *r5
+L60: jmp L1
+L61: .string "fem"
+jsr X18
+L62: mov *r4, r7
+; comment
+L63: bne L45
+lea L186, r3
+not r7
+not r5
+clr r2
+prn L219
+rts
+L64: .data 875, -935, 596, -87, -384
+inc X18
+mov #132, L10
+L65: red X1
+L66: prn X8
+L67: inc r0
+L68: jmp X14
+mov *r6, *r0
+L69: .data -869, 220, 414, 40, -245, 233, -685, 23
+jsr *r4
+L70: .string "pmbetqizffhjibfzrr"
+
+L71: .data 59, -232
+add r5, L233
+bne X18
+rts
+red *r0
+clr r6
+L72: jmp *r2
+jmp X20
+L73: .string "yvwfjdzoczokswtivht"
+
+jsr L221
+jmp L200
+L74: .data -994, 933, 517, 360, 536
+jmp X8
+sub #179, *r3
+add r7, X12
+cmp L159, X22
+add r6, r6
+L75: .string "tkvt"
+L76: .data 863, -159
+red *r4
+bne *r0
+mov *r7, r7
+prn L15
+jsr *r2
+clr r5
+rts
+rts
+bne L116
+inc *r3
+cmp r1, r5
+prn *r2
+sub r3, X17
+rts
+dec r4
+mov #91, *r4
+bne *r3
+jsr L185
+lea X22, X1
+rts
+stop
+stop
+sub *r3, X15
+cmp r1, #134
+rts
+inc L22
+mov *r4, L55
+add #-80, *r7
+L77: bne *r2
+rts
+bne *r0
+jsr L252
+L78: sub L75, *r1
+cmp *r2, #-158
+sub r6, L85
+dec L20
+prn #-168
+sub L148, *r1
+prn r1
+L79: jmp L170
+lea L242, X18
+L80: .string "ffcokanjqcozdcei"
+L81: sub *r2, r0
+L82: .data -806, -497, 284, 900, 233
+
+cmp #5, L241
+add L72, *r5
+clr L131
+L83: prn *r5
+L84: .string "qrlbudwmnpqetiopelycwgzu"
+L85: .data -483, -12, 942, 45
+
+add L32, r7
+stop
+lea L10, *r6
+cmp r6, #36
+jmp X3
+not r2
+L86: add *r5, *r4
+jsr L125
+L87: mov *r3, r3
+L88: add X0, *r1
+mov *r3, *r7
+prn L102
+L89: .data 724, 431
+red L202
+jsr *r0
+jmp L84
+jsr L167
+lea X21, L181
+L90: .string "fmzblrpvjxssywapvrhv"
+L91: red X17
+dec L223
+rts
+sub #137, r4
+jmp *r3
+red L134
+cmp L249, #-95
+
+jsr *r0
+clr *r3
+jmp *r5
+stop
+stop
+stop
+mov #-194, r1
+mov #140, X7
+not *r2
+jsr X16
+lea L0, r2
+L92: cmp *r3, L154
+sub #-121, r2
+jsr *r6
+mov r5, r1
+L93: jmp *r6
+L94: .data -930, -414, 227, 464, -753, 209, -534
+jmp *r5
+L95: inc r6
+mov L217, r3
+sub r1, *r1
+stop
+not r5
+dec *r6
+stop
+L96: not L5
+jsr *r5
+prn L33
+not r4
+L97: .string "ijdapbt"
+prn *r1
+L98: sub r0, *r2
+jmp L45
+stop
+jmp *r6
+jsr *r5
+L99: cmp X6, #-111
+add X5, *r0
+; comment
+mov r6, L98
+jsr *r7
+L100: rts
+jsr L125
+mov *r0, r0
+L101: jsr *r1
+L102: mov r0, r1
+
+inc r4
+mov r7, *r3
+rts
+L103: .data -754, 719, 899, -224, -86, -11, -591, 938
+mov #-68, *r3
+L104: jsr L35
+dec L220
+jsr *r1
+sub #132, L154
+prn #-253
+L105: cmp #22, L148
+L106: add r3, r3
+rts
+inc X11
+stop
+cmp #-16, *r3
+clr *r0
+rts
+jmp L152
+jmp L43
+bne *r2
+cmp *r0, #-12
+jmp *r6
+L107: prn *r3
+L108: not X21
+L109: clr r5
+sub #201, L117
+not *r0
+clr *r5
+bne *r7
+inc L20
+jmp *r4
+red r7
+stop
+add #238, X9
+; comment
+; comment
+jmp L24
+rts
+inc r0
+L110: jmp L191
+L111: .data -47, 572, 845, 44, 286, 368
+dec *r3
+L112: not *r0
+; comment
+lea X5, r0
+L113: dec *r5
+clr X12
+not L162
+red L47
+inc X11
+inc *r3
+clr r2
+L114: .string "wvfuqkrcckknlto"
+; comment
+lea L155, r0
+L115: .data 753, -104, 272, 786, 564, -563, -353, -785
+L116: mov *r3, *r0
+L117: prn X7
+jsr X24
+red X15
+not L121
+rts
+clr *r0
+jmp *r6
+
+
+L118: .string "sjjcs"
+L119: bne X19
+not r6
+dec *r5
+L120: .string "lmvfjzdptuer"
+not *r0
+L121: prn #-181
+dec r7
+
+stop
+L122: jsr X22
+L123: red *r1
+mov L39, L113
+L124: lea L9, X7
+L125: lea L1, L95
+L126: .data 723, -213, -829
+dec L12
+L127: .data 256, 951
+add r2, X7
+jsr X16
+prn #82
+not *r4
+; comment
+L128: .string "tc"
+red *r4
+L129: bne X3
+clr *r7
+sub #-117, L75
+lea L249, r7
+lea L152, *r3
+bne L209
+rts
+jmp *r3
+L130: .string "rptskfbirdekqdkdvixjpdlp"
+rts
+rts
+L131: jsr X17
+not L130
+not r6
+lea L217, X13
+L132: cmp r2, *r4
+sub X22, L63
+dec L146
+bne X18
+red r7
+prn L21
+L133: sub X18, X5
+cmp L164, #58
+rts
+stop
+rts
+mov L143, L59
+red r2
+L134: .string "mdcsgsvsnoxnmlfff"
+L135: .data -499, 686, 872, 273, -64, 893
+red L234
+jmp X12
+red L240
+red L41
+jsr *r2
+prn #-21
+stop
+lea L56, X18
+cmp r4, X5
+L136: prn *r1
+L137: .data -204, 678, 273, -45, -926, 790, 6, -512
+stop
+bne *r1
+bne *r5
+cmp #-121, #-21
+L138: jsr X3
+prn *r6
+rts
+L139: jmp L190
+L140: red r4
+dec *r0
+L141: red *r0
+add *r5, X13
+jsr *r6
+cmp X17, #185
+L142: rts
+mov #104, r1
+add X6, L158
+sub r4, r0
+L143: dec L232
+dec r2
+L144: .string "jup"
+L145: bne L29
+rts
+L146: jmp *r4
+
+L147: .data 262, -792, 211, 49, 298, -163, -383
+add *r7, *r0
+L148: .data -336, -750, 695, 847, -413, 702
+stop
+bne X16
+sub #27, r4
+
+bne *r0
+mov X4, *r0
+stop
+bne *r3
+L149: rts
+bne *r7
+L150: .data -189, 809, -572
+cmp *r3, L148
+L151: add *r7, L84
+cmp X10, L191
+L152: .data 99, 869, 184
+mov #191, L157
+cmp #213, X5
+L153: add L171, L189
+not *r7
+L154: not *r6
+lea L10, *r4
+red r4
+; comment
+dec r6
+stop
+L155: dec *r1
+rts
+dec X13
+L156: rts
+dec *r6
+cmp X16, X8
+prn L155
+L157: .string "merpzspvxaanhqckoxc"
+stop
+L158: red r2
+cmp *r3, r4
+not L112
+red r7
+add #-192, *r7
+not *r5
+cmp L121, X6
+L159: .data -293, -566, 695, -450, -24, 335
+add X11, *r2
+add r7, r3
+not *r5
+lea L229, L191
+not L158
+mov r2, r4
+bne *r2
+L160: add r0, *r5
+prn r4
+not r5
+red r1
+cmp X20, *r2
+jmp *r5
+clr *r4
+jmp *r4
+red r6
+L161: .data 998, 594, -280, -542, 228, 929, 919
+not L26
+cmp #-49, *r3
+add X17, L184
+lea L125, L221
+rts
+L162: .data 54, -192, -318, 999, 823, -903, -365, 443
+L163: dec r0
+rts
+lea L170, L107
+prn r4
+red L177
+jmp *r2
+dec X13
+dec r5
+bne X24
+L164: .data -270
+mov L215, *r0
+add *r6, r5
+L165: .data -746, 352, 397
+dec r6
+sub X4, r5
+jsr *r3
+L166: bne L170
+not *r6
+red X14
+dec L214
+dec r1
+dec r2
+dec r2
+not *r3
+jmp *r3
+
+L167: jsr L1
+L168: jmp *r1
+inc *r2
+prn #-86
+L169: bne *r3
+L170: rts
+mov r2, r2
+red X10
+inc *r3
+mov #-217, r3
+jsr X5
+clr X1
+bne *r7
+L171: .data -766, -975, -329, -596, -321, 726
+add X6, L194
+lea X20, *r0
+dec r7
+cmp *r4, r0
+L172: .data -306, 62, 485, -946, 143, -836, -239
+jmp *r2
+jmp *r3
+mov L214, L136
+L173: add r6, L167
+; comment
+mov r1, *r0
+L174: lea L184, *r7
+dec L128
+prn #114
+not L177
+jsr *r7
+clr r6
+prn #-170
+bne *r1
+bne X17
+not r4
+L175: mov #196, r4
+; comment
+L176: cmp r2, *r4
+jsr *r0
+rts
+sub r3, L109
+jmp *r6
+sub r3, r6
+; comment
+; comment
+L177: .string "uo"
+cmp *r3, #71
+L178: prn r2
+inc X4
+L179: .string "abufmxwxazorr"
+mov r4, *r1
+jsr L192
+sub L166, r6
+bne L193
+L180: jmp L209
+cmp #-54, r5
+L181: prn *r7
+dec L228
+prn #-213
+L182: dec *r3
+L183: mov #17, r5
+mov r7, L246
+mov L117, r3
+bne *r1
+stop
+add #215, *r6
+L184: lea L245, r5
+L185: .string "gin"
+mov *r2, r6
+sub #-102, r3
+L186: bne L129
+
+
+jmp *r3
+L187: not r6
+lea L220, L206
+mov #-244, *r2
+bne L138
+stop
+rts
+jmp *r6
+jmp L10
+add *r2, *r0
+L188: .data 582, -342, -72, 262, -235, -407
+rts
+add #-172, X24
+dec X20
+clr r6
+L189: dec r2
+L190: rts
+stop
+bne X15
+cmp #250, #-101
+L191: add r3, L224
+inc r5
+cmp #-87, #79
+rts
+stop
+L192: jmp *r0
+; comment
+L193: sub *r6, r2
+sub r4, r1
+add L113, *r0
+cmp *r4, *r3
+rts
+L194: clr r3
+L195: cmp r3, #19
+cmp #-81, *r0
+lea X18, r1
+mov X6, *r4
+jsr X20
+red r6
+lea L134, r5
+mov *r3, X21
+jmp *r7
+red r0
+inc *r5
+lea L10, *r1
+bne *r5
+
+L196: .string "rmbjytbbeugygvgwbhkywrc"
+L197: .data 540, -327, 857, -928, -27, -881, -904, -646
+red *r2
+sub X20, r7
+jmp L228
+L198: .data -399, -919, -743, -812
+rts
+sub r3, *r0
+lea L206, L35
+clr r1
+rts
+lea L233, L223
+add X18, X5
+L199: red *r6
+clr r3
+L200: clr *r0
+
+red L229
+L201: .string "deqywubobimllxm"
+L202: .string "nuisqtduf"
+jsr L76
+jsr L253
+L203: .data -420, -487
+dec X6
+L204: prn L200
+dec X13
+mov r7, L129
+add r3, *r4
+jsr L79
+L205: .data -544, 374, -892, 204, 34
+bne *r2
+L206: add *r1, L242
+L207: .string "siwguurkladhesrnykcfqef"
+; comment
+lea X17, r3
+jsr *r4
+rts
+cmp #109, L155
+sub *r2, *r1
+inc L257
+mov *r2, r6
+jmp *r2
+rts
+L208: stop
+not r5
+L209: red r5
+not L233
+add r0, *r7
+inc *r0
+not r5
+add #-46, *r6
+lea L151, *r0
+L210: clr X9
+dec X1
+jmp *r0
+sub r3, r1
+L211: .data -958, -310, -537, -503, -205, 775, 546
+red X2
+not *r7
+L212: .data 600, -972, 439, 334, -439, 390
+L213: clr r1
+L214: not *r6
+cmp L67, #-72
+L215: jsr *r6
+prn #-15
+add r6, r3
+L216: mov X9, *r3
+inc *r7
+jmp X10
+
+L217: jsr *r1
+not X10
+jsr *r3
+cmp X23, *r5
+mov *r6, r6
+L218: prn *r6
+L219: dec r7
+cmp r3, X1
+clr r6
+rts
+sub #29, L231
+add r7, *r3
+L220: add r4, r2
+jmp X14
+lea L251, L207
+jmp *r0
+stop
+
+jsr L121
+not *r1
+L221: dec r2
+clr L128
+
+stop
+L222: sub #-214, *r4
+prn #150
+dec r1
+red *r5
+stop
+L223: bne L52
+jmp L193
+; comment
+L224: .data 772, 78, 283
+
+jmp *r0
+L225: .data 503, -496, 212, -35, 413
+lea X15, L144
+bne X9
+rts
+L226: bne *r7
+L227: stop
+rts
+L228: prn *r1
+L229: jsr *r5
+cmp L252, #-227
+L230: .data -298, 913, 149, 221, 843, -286
+L231: mov L246, *r6
+clr *r1
+L232: .data 377, 472, -781, 571, -519
+red r1
+L233: add *r6, *r1
+L234: .string "dcrrkozsnxgyqudvjkkehzp"
+add r3, *r6
+L235: .data -42
+L236: not *r7
+L237: .data 328, -169, -932, 385, 536, -579, -115
+jsr *r3
+prn r7
+lea X21, *r6
+not r0
+dec *r2
+clr *r4
+L238: .string "wjtkhea"
+; comment
+dec *r6
+L239: not r6
+jsr *r3
+prn *r3
+L240: rts
+red *r4
+mov *r0, L227
+cmp *r2, *r1
+jsr L251
+clr r5
+prn r6
+prn r1
+L241: red r6
+cmp *r0, *r3
+L242: .string "rsasdy"
+L243: stop
+jmp *r3
+sub r6, r4
+jsr L255
+not *r4
+dec r0
+inc *r1
+L244: .data 297, 884, -497, -646, -101, 463, 76
+inc r7
+clr r4
+prn *r0
+L245: .string "lkxcqryaq"
+prn #253
+stop
+not r6
+jsr X17
+add L255, *r1
+L246: rts
+prn r6
+rts
+lea L255, L247
+L247: .string "rj"
+lea X20, *r5
+L248: .data -193, -218, 432, -265, -392, -467, -664, 921
+
+; comment
+L249: .data 606, 754, -254
+jmp *r7
+stop
+jmp *r3
+clr X19
+rts
+bne *r0
+cmp #-118, L12
+jsr L254
+inc L70
+prn r7
+rts
+L250: dec *r3
+dec r7
+L251: dec *r2
+dec r5
+sub *r7, r5
+
+L252: .string "zmkdlisdrzdugitccizqx"
+not *r5
+bne X11
+L253: .string "hctglf"
+L254: mov r0, *r1
+bne X19
+prn #59
+add r4, r4
+L255: .data 344, -440, 565, -153, -747
+bne *r5
+L256: inc r6
+inc r2
+lea L258, L259
+L257: .string "nyvbupanvtoagwmwn"
+jsr L260
+cmp *r2, *r5
+stop
+prn r5
+stop
+cmp r5, *r6
+not L259
+red X13
+add #66, X18
+red X4
+bne *r7
+red L258
+mov *r3, *r1
+lea X21, L121
+L258: .data -518, -192, -475, 973, -606, 854, 151
+add L260, *r5
+stop
+red L259
+dec *r3
+mov *r6, X21
+
+clr r7
+jsr X3
+L259: .string "soehkhsf"
+jsr *r7
+L260: cmp r5, r3
+not r7
+bne *r3
+stop
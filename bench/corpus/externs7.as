@@ -0,0 +1,1045 @@
+; Generated by genCorpus --seed 8
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+stop
+L0: dec *r4
+red *r2
+L1: add *r5, r7
+stop
+L2: dec L0
+add L71, r5
+L3: not r2
+not *r6
+clr *r1
+; comment
+clr X4
+add *r0, r4
+L4: cmp *r1, r1
+sub #190, *r4
+lea L271, L1
+L5: .data 657, -56, -581, -10, 170, 283
+clr L58
+dec X14
+rts
+mov L3, *r1
+bne *r3
+sub #-83, *r2
+prn *r0
+add *r5, *r2
+rts
+mov #243, *r4
+stop
+lea X18, X11
+jmp *r2
+bne L54
+L6: .data 818
+L7: dec r6
+; comment
+L8: .data 499, -118, -236, 59
+
+L9: .string "jsfqaomukerzrvxqaoe"
+L10: jsr L9
+rts
+
+jsr L3
+clr r0
+prn #61
+L11: .string "vyoupmcmsdtziagov"
+L12: .string "r"
+L13: not *r6
+jmp X16
+dec *r3
+cmp *r2, #-213
+L14: cmp *r7, *r7
+stop
+not L9
+
+jsr X19
+L15: inc r2
+jmp *r1
+mov r7, L283
+L16: .string "rxma"
+lea X15, L58
+rts
+red X18
+L17: lea L14, r5
+red r6
+L18: rts
+L19: stop
+cmp r5, #-115
+clr *r3
+jmp L203
+L20: .data -145, 99, -39, -79, -661, 62
+; comment
+L21: mov L81, X19
+inc r5
+bne *r6
+jsr *r6
+not r7
+stop
+
+L22: .string "wvmxiiidnzrgcg"
+jmp *r2
+red X10
+sub L12, X4
+L23: .data 271, 688
+cmp #-111, *r0
+lea L190, X9
+L24: .data 782, 277, -276, -42, -240, -372, 154, 396
+not r5
+sub r4, L17
+rts
+cmp X4, r6
+jsr L88
+prn r0
+stop
+rts
+inc r5
+jmp *r7
+not *r6
+cmp #-52, L199
+clr X3
+L25: .string "gkxxhcryfvslyfdc"
+add r4, L16
+sub r0, *r5
+jsr X15
+inc L277
+L26: red L2
+lea L23, X14
+jmp X14
+stop
+jmp L254
+jmp *r0
+L27: lea X23, r7
+cmp L2, r0
+cmp r2, X9
+; comment
+L28: prn r4
+prn r2
+sub #243, r6
+L29: .data 410, 767, 376, -348, -580
+not r2
+L30: not *r6
+bne X24
+bne *r2
+L31: add r2, L155
+inc *r7
+red r7
+not *r3
+L32: rts
+clr r2
+L33: rts
+dec L91
+L34: jsr *r0
+rts
+jsr L25
+sub *r4, r7
+clr L10
+L35: .data -871, 3, -650, 894, -751, -885
+mov L29, *r2
+not r6
+mov #-1, L31
+L36: add r2, r7
+; comment
+sub r5, r3
+L37: lea L31, r6
+L38: .data 206, 23, 4, 513
+L39: .string "wwx"
+rts
+dec *r2
+sub X20, L83
+L40: .string "yakbaabkvtjtxiy"
+mov L24, L18
+
+; comment
+not L187
+stop
+rts
+L41: lea L79, *r5
+L42: .data -639, -628
+L43: add r1, *r6
+L44: add *r0, r5
+bne X13
+L45: jmp *r6
+L46: stop
+clr r5
+cmp r2, L66
+bne *r3
+red r1
+L47: .data -59, -503, -538, 831, 904, 652, 11, -691
+red r7
+L48: .string "bkxlbbdx"
+rts
+dec *r4
+L49: .data 525, 968, 261, -485, -642
+red r4
+jmp L168
+add r4, *r2
+red r7
+mov X3, r3
+dec r2
+inc r4
+add X13, r3
+rts
+L50: .data 301, 998, -624, 929, 598, -902, 44, -856
+cmp r6, #219
+inc r7
+clr r1
+L51: jmp L282
+stop
+red r2
+L52: jmp L63
+not *r4
+jsr L33
+mov #203, r2
+L53: add r4, *r2
+dec X24
+inc X19
+rts
+lea X12, L50
+jmp *r2
+stop
+prn *r6
+
+L54: .string "qplihekujfl"
+L55: bne L13
+cmp r3, r3
+clr *r7
+prn r0
+L56: .string "gbh"
+not X23
+mov #126, r5
+; comment
+inc X20
+clr *r0
+L57: .string "orvokwfjru"
+stop
+inc X19
+bne *r7
+cmp r0, r5
+prn L0
+rts
+bne L48
+not L15
+L58: .string "jhp"
+add r6, X16
+jsr *r1
+prn #-164
+L59: jmp *r3
+sub #-173, r4
+L60: stop
+not X19
+stop
+not *r7
+inc *r4
+dec X17
+red L54
+L61: jmp *r5
+
+L62: jsr *r6
+L63: .string "xrqxbzwigizlrcxqhaewwnq"
+add r5, *r3
+L64: bne *r3
+; comment
+jsr L40
+L65: prn #172
+jmp *r2
+red *r5
+cmp L20, *r5
+bne *r5
+clr X11
+prn r5
+add #-129, X5
+red *r4
+sub *r4, X6
+not L199
+not *r3
+red *r6
+jmp *r3
+L66: .string "ywhhj"
+L67: add #-232, L159
+lea X18, X20
+bne *r5
+L68: rts
+mov L280, *r5
+L69: not r2
+L70: jmp L285
+not L62
+clr r3
+rts
+; comment
+clr r0
+L71: .string "lrffeiwrdirsuulujor"
+L72: .string "mrcjfelviebulbplbw"
+inc *r4
+jsr X6
+stop
+L73: cmp r5, *r1
+L74: jmp *r5
+not r2
+cmp L15, r2
+L75: red *r3
+stop
+L76: rts
+L77: sub #-232, L12
+add L273, X6
+stop
+L78: .data -371, 0, 691, -60, 854, 245, -342, -256
+red L173
+not L31
+dec r7
+sub X13, *r5
+red L15
+rts
+dec X16
+mov r2, r2
+clr r3
+mov X4, L56
+stop
+L79: sub r0, r0
+L80: inc L36
+dec X3
+L81: rts
+clr r1
+rts
+lea L75, r4
+jmp *r2
+not L210
+bne *r5
+L82: dec r2
+clr X5
+clr X9
+red X15
+red r3
+L83: red *r3
+
+stop
+L84: jsr L51
+
+L85: stop
+dec L279
+rts
+red *r5
+L86: jmp L244
+bne L167
+; comment
+stop
+L87: sub *r0, r3
+bne X22
+inc *r6
+jsr *r2
+L88: .data -6, 245, 905, -573, 470, 597, -528
+stop
+not L58
+bne L43
+L89: red r3
+not r2
+; comment
+prn #5
+sub L96, X0
+L90: sub X17, r4
+L91: lea L43, *r2
+L92: cmp r4, #92
+L93: .data 489, 422, -497, 372, -401, 563, 218
+rts
+L94: .string "jlhrizunfce"
+red *r6
+L95: add r7, r5
+jmp L18
+red r4
+mov #-222, X17
+not *r4
+L96: jsr *r3
+jsr *r2
+add r1, L168
+; comment
+L97: dec r6
+prn #-163
+L98: cmp X16, L37
+mov L14, *r0
+add r0, *r4
+L99: dec *r3
+L100: stop
+add *r1, *r4
+lea L91, X15
+jmp L104
+not r1
+rts
+L101: mov r2, L126
+L102: dec L88
+stop
+L103: add X8, *r4
+L104: dec L7
+rts
+jmp *r1
+L105: sub L69, L165
+stop
+L106: .data -651, -38, -80
+clr *r4
+L107: .data -478, -380, 26, 45
+add #64, X15
+
+bne L105
+mov *r4, *r6
+cmp L76, *r6
+jsr *r0
+bne L100
+L108: lea X8, L139
+cmp #206, *r3
+mov #18, L96
+dec L141
+L109: stop
+not *r6
+; comment
+L110: .string "hwu"
+dec *r4
+not *r5
+not L105
+bne *r3
+L111: stop
+mov r5, X15
+L112: jsr *r6
+lea L265, L6
+clr *r1
+L113: inc r0
+jmp *r5
+sub L29, L181
+red X4
+mov r7, *r7
+L114: jmp L102
+rts
+clr *r4
+L115: sub *r2, r4
+clr X21
+jmp X5
+jmp *r5
+red L252
+not L32
+lea X15, r1
+dec r1
+L116: jmp L62
+cmp *r5, *r0
+stop
+red r4
+mov r1, r3
+add X9, L210
+L117: .data -299
+stop
+jmp X0
+mov L80, X9
+sub r1, r3
+L118: cmp *r1, L34
+; comment
+L119: .data 56, -506, -683, -203
+lea X0, X3
+L120: cmp #1, #3
+L121: mov X11, *r7
+red r3
+bne X7
+jmp X24
+inc *r5
+sub L85, r5
+L122: rts
+L123: .string "syxqqdkwqbocpqnzvfcpj"
+L124: stop
+dec X2
+red *r3
+; comment
+prn *r3
+L125: inc *r3
+lea X17, *r6
+clr *r3
+cmp X3, r2
+jsr L238
+L126: inc r2
+not r5
+clr L59
+lea X13, *r5
+add L151, *r7
+L127: jsr X24
+mov r5, r3
+prn *r2
+inc X6
+jmp X11
+L128: .data -920, -848, 797, -714, 857
+
+red X13
+L129: cmp #192, #-7
+dec r6
+jmp *r4
+mov X3, *r1
+add #105, X0
+mov *r0, *r5
+red r1
+L130: stop
+inc X4
+mov #-181, *r4
+clr L226
+sub X5, X23
+clr r1
+jsr L78
+cmp r2, X6
+prn r3
+lea L61, *r6
+prn *r1
+clr *r5
+jmp *r7
+; comment
+sub *r4, *r0
+L131: bne *r1
+cmp *r1, *r0
+cmp #-133, *r5
+L132: .data -462, -453, 864, 145, -268, -635, -303, -288
+jsr *r6
+mov *r3, X3
+mov *r4, *r3
+jmp *r0
+L133: stop
+inc X13
+sub #-235, r5
+prn X14
+L134: cmp *r4, *r6
+L135: stop
+L136: inc *r5
+L137: prn r4
+jmp X6
+L138: .data 773, 643, -245, -632, 94, -816, 196, 239
+L139: mov L123, *r3
+prn X0
+add #-16, r4
+prn r0
+lea L105, L14
+
+jmp X4
+cmp *r2, *r0
+; comment
+cmp r4, #162
+prn L236
+cmp X21, r0
+L140: cmp *r3, L163
+L141: .string "rdrzchmkhvkptwcvbcsf"
+red *r4
+jsr L24
+L142: prn r4
+not r2
+mov #27, L160
+add L164, r2
+L143: stop
+L144: not X13
+red r0
+L145: red L261
+stop
+prn *r4
+inc *r6
+dec L143
+prn r2
+prn X21
+not r5
+L146: rts
+jmp *r1
+L147: sub #-225, X8
+L148: .string "lbrqdpofbopabsuijbdqaesf"
+inc r4
+L149: add *r1, *r4
+red L125
+sub r3, r2
+mov L153, X7
+stop
+L150: bne L102
+jmp *r0
+
+stop
+jsr L257
+; comment
+clr r5
+clr *r3
+L151: jmp L222
+bne *r1
+
+lea L2, *r6
+L152: .data 826, -811, 271, 992, -94, -349
+bne X8
+red *r6
+sub L36, r3
+lea L100, r2
+dec X5
+red L116
+L153: prn r2
+
+red r7
+lea L184, *r1
+L154: .data -67, -855, 329
+red r4
+red L175
+clr r2
+L155: .string "mp"
+L156: bne L149
+rts
+
+prn X22
+sub *r4, *r4
+stop
+jsr *r0
+L157: .string "vjoedqzuldydflisvhrvgvwa"
+L158: lea X7, X7
+cmp X9, r2
+rts
+lea X3, r7
+lea X15, r5
+L159: mov L240, *r7
+mov r4, r3
+L160: .string "cqnzclsnwyl"
+stop
+rts
+cmp L53, #-234
+bne *r1
+; comment
+mov #-79, L34
+L161: red X19
+prn X20
+lea L238, L210
+L162: clr r6
+stop
+inc X13
+add *r7, *r5
+L163: inc L18
+dec r2
+lea X14, *r2
+L164: inc *r2
+; comment
+inc *r1
+not X7
+add *r2, *r7
+not L207
+sub *r3, *r6
+red X3
+L165: .string "gdtkslgqzlozvqjiebssqxf"
+L166: cmp r5, #-7
+add L162, X6
+L167: red L12
+prn r1
+not r6
+add #246, *r6
+sub r2, X10
+L168: .data -599, -712, 15, -136
+L169: .string "t"
+L170: lea L214, L111
+mov #-7, *r3
+jmp X3
+jsr *r4
+L171: .string "equ"
+L172: cmp X14, #-184
+L173: .data 842, 633, -889, -250, -220, -521, -646, 927
+L174: bne *r5
+dec X8
+dec X13
+rts
+
+stop
+red X14
+red X16
+prn L149
+dec *r3
+
+bne *r3
+L175: dec *r5
+dec *r4
+
+bne *r2
+L176: .string "jkkywf"
+cmp #-130, r2
+dec r3
+red L60
+L177: .string "kzcu"
+red *r4
+clr r5
+mov L224, *r6
+L178: sub X11, X5
+L179: red L221
+lea X23, L283
+L180: .data 832, 76, 19, -906, 971
+add L44, *r6
+L181: .string "mesmwotxvsekjjttgsjvruy"
+jsr L166
+bne *r7
+mov *r5, r0
+prn *r1
+add *r5, r7
+inc r1
+L182: .data 774
+L183: .data 846, -676, -255, 645, 9, 828
+prn L207
+jsr *r3
+L184: .string "skpcfouwwfmvlew"
+L185: .string "vsoyzuvgvypbvgvks"
+jsr *r6
+cmp *r4, *r6
+cmp #203, *r0
+jsr *r4
+L186: cmp *r4, #-202
+cmp #-41, r7
+add #-246, r6
+rts
+clr *r2
+L187: .string "ygnskgmgqpdwohk"
+inc L52
+; comment
+stop
+lea X13, *r5
+L188: .data 141
+sub X8, r7
+add r3, *r3
+stop
+lea L256, r7
+cmp *r5, *r3
+jmp L137
+dec *r1
+clr *r1
+L189: not r7
+L190: .string "rckmubj"
+L191: .string "yhjgaftmxxzuqaroabx"
+jsr *r0
+L192: cmp L194, #56
+stop
+L193: not *r7
+rts
+jsr *r0
+not *r3
+
+L194: dec r0
+L195: jsr *r6
+L196: jmp L212
+rts
+L197: sub r7, *r1
+cmp #216, L195
+bne L278
+cmp #-198, r7
+L198: cmp *r7, #223
+lea L92, X3
+L199: bne L36
+L200: jmp *r5
+mov L193, *r5
+lea X23, X16
+bne X10
+cmp r3, #-98
+L201: jsr L233
+inc X18
+L202: add #132, *r4
+L203: red *r2
+
+jsr L213
+L204: stop
+L205: .data 639, -49
+jmp X11
+red r6
+clr r3
+lea L163, *r1
+stop
+L206: red *r5
+L207: .string "avyllagk"
+not r2
+L208: .string "nqnpjgtgglaza"
+add X3, r3
+add L201, r5
+add #-21, *r6
+sub *r5, r7
+L209: .string "qufrh"
+inc *r6
+jsr L159
+L210: .string "tndcsnp"
+dec *r5
+L211: lea X8, L270
+; comment
+inc *r4
+red r3
+cmp *r1, *r3
+L212: clr r5
+L213: .data -828, -448, -197, 601, -452, 279, 453, -547
+clr r3
+lea X11, r0
+rts
+L214: .string "nevyztchffpcd"
+L215: .data -801, 8, 653
+; comment
+rts
+L216: .data -685, 964, 58, 821, -291
+red X8
+L217: .data 359, -80
+jmp *r0
+L218: jmp L251
+L219: stop
+bne *r2
+cmp L118, #87
+jsr L229
+prn L237
+L220: .string "f"
+not *r1
+L221: .data -572, -993, -837, -37, -97
+L222: mov L156, L140
+jmp X16
+rts
+cmp r6, #-127
+sub L46, r1
+L223: mov *r0, X7
+jsr L256
+inc X11
+L224: .data 866, -88, 859, 297, -388, 781, 946
+bne *r5
+L225: rts
+L226: lea X22, L111
+L227: not *r4
+jmp L103
+add *r0, L263
+L228: prn r5
+L229: .data -481
+inc L285
+L230: .data -319, -391, -799, -199, -304, 659
+L231: .data -97, 243, -965, -42, 859
+not r1
+bne X1
+bne *r2
+L232: add r6, r5
+cmp #-199, r7
+bne X11
+jsr L276
+sub *r7, *r7
+bne X24
+stop
+L233: .string "firhnyuyoyspfgpwmxbf"
+add X6, r7
+
+jsr L217
+bne *r5
+inc X21
+L234: lea L265, X3
+rts
+inc r3
+sub *r6, *r0
+L235: bne *r3
+L236: rts
+jsr *r3
+rts
+stop
+stop
+L237: .string "wcn"
+sub #119, *r0
+add r7, *r3
+L238: mov r5, L252
+inc L204
+prn X20
+bne *r5
+cmp *r2, X0
+not r1
+clr *r5
+not *r2
+L239: red *r4
+jmp *r0
+bne *r1
+L240: add X4, r7
+clr r3
+L241: add *r3, L266
+rts
+clr r5
+stop
+bne L106
+jsr *r4
+L242: lea X10, X12
+L243: .string "zntlvxkjcohmlcgjzolmv"
+jmp L281
+L244: .data 657, -53
+red *r1
+L245: rts
+L246: lea L258, *r6
+L247: jmp L198
+L248: add *r7, r4
+mov L176, r7
+jsr X3
+L249: rts
+L250: .string "aqnzfgvmxyz"
+lea L239, X9
+rts
+not L215
+dec X13
+lea L271, *r1
+mov r6, r2
+rts
+red L257
+L251: .data -561, 795, -738, -853
+jmp *r3
+red *r7
+L252: add #-72, *r5
+clr *r1
+L253: prn r0
+L254: .string "ycazbtlpl"
+dec L262
+dec X19
+jmp L256
+not L111
+L255: cmp #207, r0
+red r5
+L256: prn X15
+; comment
+bne L265
+L257: cmp r1, *r3
+clr r0
+L258: red *r5
+inc X15
+L259: prn *r4
+cmp *r4, #-126
+add r6, X12
+not X8
+L260: clr L277
+not *r5
+L261: .data 417
+; comment
+prn X9
+rts
+inc *r3
+lea X12, *r1
+stop
+rts
+add r2, L275
+jsr *r5
+L262: mov #-216, L165
+red *r2
+add *r2, r7
+bne *r1
+rts
+lea L251, r1
+jsr L274
+lea L172, r2
+inc *r5
+; comment
+mov r0, r6
+L263: dec X4
+L264: .data 246, -32, -327, -797, 162
+L265: cmp *r3, L179
+L266: sub r4, *r5
+add #-156, L276
+stop
+L267: .string "khrrssoysofvtxoptob"
+sub *r0, L272
+rts
+L268: .string "fdetnpwk"
+mov r7, *r1
+inc r6
+bne *r0
+bne *r7
+jmp *r1
+red *r6
+clr L270
+inc X8
+red X20
+dec *r0
+
+clr L270
+L269: .data 873, -7, 510, -815, -386, 302, -896
+mov #49, L273
+inc r6
+lea L263, r7
+cmp L236, X10
+dec r2
+dec r6
+clr X2
+L270: sub *r6, L279
+cmp L283, r4
+L271: .data -613, 669, 71
+rts
+bne L136
+
+L272: .data -379, -546, -848, 653, -702, -696
+L273: dec *r2
+not X1
+L274: .string "ghwyu"
+jsr L278
+clr *r7
+jmp X6
+L275: rts
+lea L26, L286
+L276: sub *r0, *r7
+; comment
+L277: bne L283
+clr X23
+cmp X7, X6
+L278: .string "skvxdbijfvajrrfemwv"
+add *r5, *r3
+L279: not X0
+jsr L174
+stop
+stop
+L280: lea L59, r6
+prn *r5
+add *r2, *r3
+jmp *r3
+stop
+mov L196, *r4
+L281: .data 12, -196, -250
+stop
+mov #205, *r7
+; comment
+rts
+lea L284, r3
+rts
+dec *r1
+cmp r5, #-215
+not X18
+L282: stop
+rts
+inc X21
+L283: sub #223, *r1
+L284: .string "ikim"
+mov L65, X0
+L285: inc *r5
+mov X13, *r0
+inc *r6
+mov r5, L119
+dec X5
+bne X6
+stop
+L286: sub #-195, *r6
+mov #-221, L179
+not *r3
+; comment
+inc L244
+stop
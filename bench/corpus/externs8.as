@@ -0,0 +1,1044 @@
+; Generated by genCorpus --seed 9
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+lea L216, L7
+L0: rts
+L1: .string "hnqoktsvim"
+L2: inc *r2
+prn L1
+
+stop
+clr r3
+jmp L146
+
+rts
+lea L141, L1
+L3: red L2
+sub L72, *r6
+add r3, L1
+L4: stop
+sub L0, X22
+cmp #-48, X23
+L5: bne *r7
+L6: .data -519, -339, 479, -719, -591, -610, -11
+jmp L47
+L7: .data -332, -832
+L8: prn #-223
+sub L7, r6
+add L110, X4
+not L7
+jmp *r5
+L9: mov *r3, *r3
+rts
+L10: rts
+dec *r5
+; comment
+L11: jmp X16
+bne *r2
+sub r2, *r4
+L12: inc *r3
+red *r2
+cmp X4, L9
+jmp *r3
+add *r0, *r3
+rts
+dec X24
+jsr *r2
+L13: add r1, *r3
+clr L125
+stop
+mov L7, L11
+L14: .data 992, -189, -449, 620, -61, 530, -66
+clr r2
+L15: clr *r0
+sub *r7, r3
+dec r1
+sub X18, *r7
+bne *r7
+L16: mov r3, *r3
+mov #-82, L16
+inc *r3
+L17: jsr X4
+clr L128
+clr X9
+L18: lea L5, *r5
+prn L8
+prn #-55
+bne X24
+jsr *r6
+stop
+L19: .string "nuixprr"
+lea X21, *r2
+bne *r2
+inc L57
+; comment
+clr *r6
+rts
+L20: red r2
+stop
+jmp X11
+L21: prn L226
+cmp L7, r4
+mov X23, X22
+mov #-8, r6
+red r4
+L22: .data -22, 895, 510, -296, 313, -43, -682, -639
+red *r6
+stop
+inc *r2
+jmp *r3
+L23: .data -737, 586, -200, -487, -129, -817, 559, -1
+add *r6, r0
+sub X0, X21
+lea L23, X6
+L24: .data -991, -628, -961, -838, 757, -597, -630, 502
+sub *r1, X20
+L25: .data -583, -690, 208, 534, 453, 590
+L26: lea L25, X20
+L27: prn *r7
+L28: .data 806, 918, -177, 408, -3, -450
+add r6, *r4
+jmp X1
+L29: prn r6
+L30: dec *r6
+L31: .string "owdpmnldudinkuqznfcp"
+stop
+jmp *r6
+cmp r4, L26
+dec L31
+jmp *r3
+L32: jsr L10
+bne *r6
+L33: .data -972, -293, 233, 247
+cmp #-245, L9
+L34: .string "zsrneczwfgs"
+jmp *r0
+jmp X17
+cmp L11, r3
+mov X1, X18
+; comment
+L35: .data 436, -151, 745, 828, -863, -307, -72
+bne *r3
+L36: .data 973
+mov X7, X14
+jmp *r1
+L37: lea L114, *r6
+rts
+bne X7
+add #-179, X24
+dec r7
+jsr L116
+add L67, L165
+L38: dec r5
+lea X4, X23
+rts
+L39: inc r0
+prn X23
+L40: cmp *r3, r1
+add *r1, r5
+inc r0
+jmp L33
+L41: .string "uctkxsosfjbepktswpyqsfo"
+L42: not L7
+sub #-114, *r0
+rts
+bne X13
+lea X17, r7
+cmp *r7, *r5
+rts
+; comment
+L43: jmp *r1
+L44: prn *r3
+sub X9, *r0
+prn #11
+L45: red L221
+prn #-201
+L46: bne L235
+not *r3
+rts
+stop
+L47: cmp *r1, L27
+L48: bne X3
+sub L74, r5
+red L23
+add #-217, X14
+L49: red X14
+rts
+rts
+jmp X17
+; comment
+L50: lea X18, r0
+L51: not L8
+prn X9
+red *r5
+L52: jsr *r2
+rts
+stop
+L53: lea X10, X13
+jsr *r1
+lea L4, r2
+cmp #19, r6
+dec r3
+jsr *r7
+L54: red *r4
+L55: cmp L182, #58
+L56: inc L199
+dec *r6
+clr *r3
+stop
+bne *r5
+L57: cmp L38, r4
+L58: jsr *r3
+lea L43, r7
+bne *r0
+jmp L255
+L59: red X0
+dec *r4
+red *r5
+add r7, *r7
+prn r4
+inc L134
+mov *r4, X20
+bne *r7
+lea L204, *r0
+jsr L32
+clr X22
+sub r3, r2
+red r7
+lea X21, r4
+mov #-226, r1
+jsr L149
+rts
+add r7, r7
+L60: .string "zmdzfplhrmeslnzxys"
+dec r4
+rts
+clr r4
+sub #158, r4
+inc r6
+; comment
+lea X8, *r6
+L61: inc r5
+inc L150
+jsr *r4
+mov #-204, *r1
+red r0
+prn *r6
+jmp L35
+add r2, *r7
+L62: .data 960, 182, -655
+stop
+not *r1
+prn *r0
+not r5
+sub L149, L43
+jsr *r0
+red *r4
+L63: .string "jnjxvvfjjwsrgrzthzrszq"
+L64: .data 169, -206, -217, 71, -657, -640, -82
+cmp L196, L45
+; comment
+add L30, *r4
+L65: cmp L153, #-232
+jsr L76
+not *r6
+add r7, r6
+L66: lea L184, X10
+L67: .string "xqluibbavajprutjcdtudy"
+rts
+L68: cmp *r7, #200
+prn r3
+L69: inc r4
+L70: .data -122, -538, 898, 365, -354, -493, 803, -968
+add X7, r3
+prn *r7
+L71: sub *r5, L17
+
+L72: .data 237, 951, -81, -392
+L73: sub L134, L37
+L74: sub L69, X10
+L75: red r7
+rts
+red *r5
+clr X18
+not r7
+sub r2, L38
+L76: stop
+add r1, *r2
+prn r1
+stop
+dec L27
+lea L79, *r5
+stop
+L77: clr X21
+bne L73
+bne L185
+lea L40, *r1
+L78: add L28, L205
+red r5
+L79: mov r1, X18
+jsr X16
+cmp X4, L143
+L80: .data -891, 536, -138, -156, -606
+rts
+L81: jmp L116
+L82: .data 464, -933, 251, 552, 526
+jmp L143
+rts
+L83: .data 642, -289, -155, -965, -962, 256, -952, -356
+jsr X22
+; comment
+rts
+L84: .data 734
+L85: dec X21
+L86: .string "lwz"
+bne *r3
+prn r2
+cmp r5, *r3
+jmp *r6
+
+; comment
+; comment
+mov r1, *r6
+L87: not *r4
+L88: stop
+cmp #168, *r1
+stop
+rts
+red r6
+cmp L160, r1
+L89: cmp #222, L138
+sub *r4, *r5
+lea L78, *r4
+stop
+bne *r7
+L90: .string "dfztiwrtcsd"
+L91: clr L223
+jsr L22
+clr r5
+jmp *r4
+cmp X17, *r1
+stop
+clr *r2
+red r6
+dec *r3
+prn L70
+L92: bne *r3
+L93: red r0
+
+bne L167
+bne X10
+not *r6
+bne *r1
+add #-188, r5
+jmp L95
+stop
+dec *r5
+stop
+prn #-221
+clr *r2
+sub *r0, r2
+L94: mov L44, r3
+dec r2
+add r6, *r4
+L95: .string "gwzdaktfefqhfuhfucxw"
+lea L31, L28
+cmp *r5, *r0
+cmp #101, *r2
+lea L256, X24
+not *r6
+L96: red X16
+rts
+sub #-14, *r5
+jmp *r6
+inc r0
+L97: sub *r1, X7
+jmp *r3
+cmp #115, L26
+mov *r7, r6
+L98: lea X15, *r3
+L99: rts
+lea L124, r2
+L100: rts
+add r2, X8
+not L27
+dec *r6
+prn r3
+add #-116, X2
+L101: inc r0
+L102: .string "goxafweqllyrjtfcefetos"
+inc X2
+L103: add #-135, L0
+lea X19, r3
+L104: stop
+red r3
+not r3
+L105: dec *r0
+add *r3, X5
+add #-154, *r2
+add *r1, X12
+bne *r5
+jsr L3
+L106: lea L216, *r5
+lea L194, L50
+inc L141
+L107: .data -922, 683
+; comment
+clr X20
+bne L31
+cmp X16, #-81
+L108: jsr X24
+L109: prn r0
+not L40
+L110: add L200, r5
+bne X12
+L111: .string "lbidkboxlayswlx"
+prn r0
+rts
+rts
+prn r7
+sub L136, r4
+rts
+jsr *r1
+clr r4
+sub L134, *r5
+red L262
+rts
+stop
+L112: bne *r2
+not L49
+add *r3, X22
+L113: jsr L113
+L114: sub #32, r5
+jsr *r0
+red *r7
+red X4
+sub *r3, r7
+L115: .data 920, 615, -593, -520, 549, 672, -343
+jmp L104
+lea L168, L9
+mov #198, r3
+stop
+; comment
+L116: cmp r2, #107
+bne *r5
+L117: dec X21
+rts
+L118: stop
+prn r7
+L119: rts
+sub #208, *r6
+lea X9, *r6
+stop
+jsr *r3
+inc r7
+L120: bne *r1
+L121: bne *r2
+red *r2
+L122: mov #148, L42
+lea L162, L152
+L123: .string "a"
+L124: jmp X19
+; comment
+lea L99, *r7
+bne L10
+stop
+stop
+L125: jsr L11
+jsr L197
+L126: cmp *r5, r6
+dec r7
+L127: lea L44, *r7
+bne *r1
+jsr L111
+L128: .data 16, 889, 677, 224, -508, 960, 770
+inc X15
+clr *r1
+cmp #37, #188
+dec L111
+sub r6, *r7
+; comment
+red r4
+rts
+jsr L14
+clr *r1
+L129: mov r4, X11
+L130: .string "mczjnxlxmiyayevhwvjw"
+inc *r2
+L131: prn #-205
+inc L89
+L132: not X10
+dec *r3
+sub X14, *r2
+mov #76, X0
+inc *r1
+L133: jsr L237
+L134: rts
+L135: jmp *r7
+jmp L232
+clr r1
+stop
+clr L164
+L136: prn X11
+add X16, *r3
+L137: add *r4, L236
+not L59
+prn X16
+; comment
+sub r5, *r1
+L138: sub X14, r1
+L139: dec *r1
+clr *r5
+mov X16, *r2
+L140: clr X0
+mov *r4, r6
+sub L235, *r7
+L141: .string "euuitvnjbnkujb"
+L142: .data -636, -538
+L143: bne *r1
+prn #-17
+cmp L35, *r5
+L144: .string "aynusn"
+L145: cmp #-122, X16
+inc *r1
+stop
+L146: dec *r1
+add L232, *r5
+rts
+jmp L51
+L147: .string "aqxcdoaqyfubwdgdqvoghfv"
+bne X0
+mov #34, X24
+not *r5
+rts
+L148: stop
+inc X7
+add *r6, L178
+rts
+red X10
+jsr X14
+jsr L73
+not *r2
+inc *r6
+L149: prn r5
+bne *r0
+rts
+lea L130, r1
+
+jmp *r5
+jmp X24
+red r3
+stop
+clr *r4
+
+stop
+L150: red r1
+dec r2
+stop
+bne L257
+jsr L33
+cmp *r6, r1
+stop
+L151: .string "nwqaeqasi"
+sub r3, *r5
+red r4
+red *r6
+add #-106, L161
+cmp #-39, L194
+stop
+inc X18
+dec L100
+not *r2
+L152: .string "mbflxpxspvqghh"
+L153: lea L6, r3
+prn #-125
+prn #221
+jsr *r6
+not *r3
+stop
+
+add *r7, L45
+L154: add *r6, X18
+inc L223
+mov *r4, X3
+stop
+prn X5
+prn #-109
+dec *r4
+L155: .data -40, 498, 652
+L156: stop
+prn L75
+clr *r1
+lea L248, r3
+jmp *r6
+rts
+jmp X16
+not *r2
+mov *r4, r4
+L157: .string "mmjbhmrytwvyaxuof"
+dec L63
+L158: .string "hytijxgyfmae"
+L159: sub #39, r7
+sub #-18, r6
+prn r0
+cmp #231, L172
+L160: .data 11, -61, -441, 958
+L161: .data -564
+L162: bne *r7
+L163: stop
+sub #-244, *r4
+inc L210
+mov r2, *r2
+sub r5, *r4
+clr *r5
+L164: .data 782, 450, -597, 452, -504, -246
+L165: .data -395, -815, -930, -751
+stop
+jsr X3
+stop
+L166: .data -900, -104, -986, 664
+bne *r6
+; comment
+rts
+add X7, L206
+L167: .data -294, 881
+clr L195
+L168: sub #-18, *r0
+L169: dec r6
+dec r0
+L170: lea L204, *r4
+inc r3
+prn #108
+jmp L218
+rts
+clr *r7
+jmp X24
+clr *r3
+prn X16
+clr *r6
+L171: rts
+jmp X13
+L172: clr *r0
+L173: mov #-246, *r6
+dec L0
+L174: mov #114, *r3
+inc X3
+clr r0
+L175: sub X23, X21
+bne *r0
+clr L224
+jmp *r3
+cmp *r7, r3
+L176: lea L60, *r7
+jmp *r0
+not X8
+jsr L240
+lea L62, r5
+prn r2
+not *r4
+cmp L240, r5
+inc *r5
+prn r0
+dec r3
+mov *r4, *r4
+L177: rts
+not *r7
+stop
+jsr *r3
+add *r4, *r5
+L178: .data 897, 39, 43, -900
+; comment
+jsr X18
+L179: cmp L8, #-45
+add r5, r6
+clr *r3
+L180: sub r0, r3
+red r2
+prn *r5
+add #-55, L30
+L181: add *r0, L198
+inc *r1
+L182: mov X9, *r1
+
+clr r4
+L183: .data 871, 438, -940
+red r7
+mov L263, r6
+L184: .string "xsesgcxovhmjilq"
+L185: rts
+bne L197
+rts
+lea X16, X16
+not *r1
+L186: dec *r0
+jsr *r6
+sub L115, L9
+clr r5
+
+L187: .data 573, 947, -907, 812
+bne *r7
+L188: .data -445, -558
+L189: not L220
+not r1
+L190: .string "xmnxzavynnztoemiatsbr"
+not r0
+sub *r7, r4
+L191: inc L196
+sub #-155, r3
+add *r4, L227
+inc X3
+not *r3
+L192: .data 620, -822, 931
+bne *r3
+stop
+L193: sub *r5, *r5
+mov X22, L75
+inc *r6
+dec *r7
+L194: mov r2, L74
+inc X18
+prn r2
+
+not *r4
+bne *r5
+L195: inc r0
+L196: jmp L6
+
+prn L160
+sub #-250, r5
+L197: .string "ehmocqijnzdjvpixvg"
+sub L261, *r1
+L198: prn *r3
+not r1
+dec L162
+prn r2
+; comment
+mov L253, L133
+L199: .data 765
+L200: .string "buttyiysymycn"
+red *r0
+rts
+red L244
+L201: cmp r2, r1
+; comment
+cmp *r2, #-210
+inc r5
+not *r3
+mov L160, X24
+rts
+prn L204
+jmp X12
+L202: mov *r4, *r7
+L203: .data -314, -798, 552, -257, -190, 329, -206
+mov X8, *r3
+stop
+dec r5
+L204: clr X3
+mov r7, *r6
+jmp *r3
+L205: .data -702, -922, -681, 309, 201, 164, -930
+rts
+not r0
+lea X3, X14
+stop
+jmp *r2
+inc L228
+rts
+lea L257, *r5
+stop
+L206: sub r5, X2
+inc r5
+L207: add r0, r6
+rts
+L208: .data 508
+lea L185, r6
+
+prn L224
+L209: .string "ujyeuxvjumj"
+add *r1, X4
+jsr X21
+sub L245, X7
+jsr L58
+jsr *r4
+clr *r5
+cmp L212, *r0
+add r1, *r3
+L210: .string "uotyexs"
+mov X1, r0
+inc *r2
+lea L62, r1
+stop
+L211: sub r7, L149
+add r5, L22
+prn L71
+jmp L233
+stop
+lea X17, X5
+cmp #160, #-248
+rts
+
+mov *r1, *r1
+L212: rts
+inc r1
+L213: .data -676, -432, -120, 630, 981
+mov X20, X4
+L214: .string "thhjgekl"
+stop
+add r2, r2
+jmp *r7
+lea L54, L242
+bne *r6
+bne L98
+lea X12, r7
+rts
+add L101, r5
+L215: red r4
+jsr *r1
+rts
+clr r4
+sub X24, L224
+rts
+L216: .string "bfnnocblublrbxf"
+jmp L187
+
+jsr *r6
+L217: .data -308, 265, 344, -24, -273, 501
+inc *r5
+clr *r2
+add r4, *r6
+L218: .data 974, 975
+dec *r2
+prn #-191
+bne L255
+jsr X1
+L219: .data 128, -146, 954
+inc X3
+prn #148
+L220: .data 920, 227, 591, 476
+L221: .string "iyzabywzpspejae"
+stop
+rts
+red r0
+inc L230
+; comment
+sub L238, r7
+; comment
+mov X12, r5
+mov #7, r3
+rts
+L222: bne *r0
+rts
+L223: jsr *r7
+lea L245, r3
+add *r3, r1
+jsr *r3
+jsr *r6
+bne L235
+; comment
+prn r6
+cmp L17, L213
+prn L241
+lea X24, L254
+rts
+add #252, *r4
+L224: not r0
+bne *r4
+prn X4
+bne *r6
+dec r7
+L225: rts
+bne L245
+bne X1
+inc *r0
+prn *r2
+L226: .string "wdcivdsrhyho"
+inc X13
+
+; comment
+jmp *r5
+cmp #97, L237
+sub *r4, r4
+inc X23
+L227: .string "bhkdul"
+cmp r6, r3
+; comment
+rts
+jmp L103
+jmp *r4
+rts
+lea L128, *r5
+
+L228: .data -709, -411, -684, -598, 516, -742, 168, 297
+inc X11
+L229: stop
+cmp X22, *r1
+jsr *r1
+cmp X18, #109
+L230: bne *r5
+clr r3
+cmp #4, L263
+prn r5
+L231: .string "fhspendfbiihl"
+inc *r4
+L232: not r3
+jsr *r0
+clr *r1
+rts
+inc r7
+clr *r1
+not L92
+L233: .data -46, 68, -646, -322
+cmp #109, #189
+red r2
+inc X17
+red L256
+jsr X13
+L234: .data -171
+prn r6
+dec r2
+cmp r7, #-172
+prn #167
+prn *r6
+L235: .data 88, 522, 459, -317, 184, -512
+L236: clr X8
+L237: inc r1
+dec *r2
+mov X16, X1
+prn *r2
+cmp r6, L189
+not r6
+L238: .string "kvxgahkujvva"
+L239: dec *r1
+rts
+sub X2, *r0
+sub L249, L242
+add #-109, r4
+add #31, L8
+L240: cmp r0, #120
+L241: jsr X12
+; comment
+L242: .string "dxnubbcip"
+L243: mov r3, r5
+stop
+red *r1
+lea L245, r6
+sub #31, r4
+cmp r5, *r7
+L244: inc *r6
+L245: .data 811, -368, 875, 894, -798, -234, 541
+bne L255
+L246: bne L145
+not *r6
+mov #-137, r7
+prn #68
+lea L53, L247
+stop
+clr X17
+L247: red L253
+L248: .string "sqpijzc"
+cmp #-177, r2
+bne *r1
+red L213
+lea L113, X6
+L249: add X19, r1
+red r7
+L250: .data 82, 394, 785
+clr r0
+L251: inc *r0
+L252: stop
+lea L56, *r1
+cmp r6, X20
+inc L210
+prn *r6
+prn #-98
+cmp L46, #-13
+bne X15
+add X15, X8
+inc X9
+stop
+lea L189, *r3
+stop
+not *r1
+L253: .string "uobihzwfizztdbatlfd"
+inc *r0
+L254: .string "upqpqdmureevbztvvigp"
+L255: clr *r6
+L256: inc *r5
+add r0, r7
+L257: .string "harhapdvpke"
+lea L260, *r7
+jmp X2
+L258: dec X4
+L259: prn *r2
+dec L260
+L260: not L262
+rts
+mov #136, L263
+inc *r1
+dec r5
+cmp *r2, *r7
+rts
+L261: .data 583, -246, 891, -68, -812, 40, -283, -825
+clr *r1
+red r0
+dec L139
+jsr *r5
+red r2
+not *r0
+mov X23, *r4
+inc *r1
+L262: inc L263
+stop
+red L167
+L263: jsr L199
+inc r1
+stop
+stop
+; comment
+inc X16
+lea L125, L175
+add L229, L228
+lea X3, X19
+sub *r5, *r2
+mov *r0, *r2
+stop
@@ -0,0 +1,1044 @@
+; Generated by genCorpus --seed 10
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.extern X5
+.extern X6
+.extern X7
+.extern X8
+.extern X9
+.extern X10
+.extern X11
+.extern X12
+.extern X13
+.extern X14
+.extern X15
+.extern X16
+.extern X17
+.extern X18
+.extern X19
+.extern X20
+.extern X21
+.extern X22
+.extern X23
+.extern X24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+L0: rts
+cmp L0, r4
+inc L0
+jmp *r7
+L1: add *r2, *r6
+L2: .string "asgjlkxx"
+rts
+stop
+not L2
+L3: stop
+L4: .string "vynodbwzciwleak"
+sub X19, r1
+inc r1
+rts
+jmp *r5
+prn r2
+stop
+bne X19
+stop
+add r7, L107
+add *r5, r0
+not r5
+rts
+dec X0
+lea L203, r3
+not L1
+sub X6, *r3
+rts
+L5: red r7
+rts
+mov r7, r0
+dec r4
+; comment
+clr r3
+L6: stop
+not *r0
+L7: bne X15
+bne *r2
+add *r3, X23
+not r2
+add X0, L1
+mov *r6, *r5
+L8: stop
+L9: cmp X12, *r1
+L10: not L138
+inc r4
+L11: red L1
+not *r3
+lea L8, L212
+L12: add X19, L180
+L13: .data 50, -232, -431, -232, -732
+L14: lea X23, *r5
+inc X2
+cmp X0, #-11
+lea X3, X8
+red *r3
+prn L5
+L15: inc X11
+; comment
+rts
+L16: inc L30
+L17: mov r7, r7
+add #14, X12
+L18: .data 952, 191, 639, -456, 921
+red r5
+stop
+bne X6
+lea L8, X13
+sub *r3, *r6
+not L0
+L19: mov #-158, *r6
+not *r3
+cmp #-63, r5
+stop
+bne *r7
+not *r3
+add *r5, L220
+sub X14, *r4
+add #106, X24
+cmp #-50, *r1
+L20: .data -580, -943, -146, -89, 902, -346, -323, 727
+L21: cmp #198, *r7
+L22: jmp L174
+sub L38, *r0
+rts
+L23: dec *r1
+stop
+jmp L5
+dec L157
+L24: .string "razhlukgfelgdbg"
+bne *r0
+jsr *r4
+dec *r3
+L25: rts
+inc *r5
+sub X12, r2
+L26: .string "rjupybmnylaokoqdlgdea"
+L27: .data -80
+L28: sub *r4, *r2
+L29: mov L5, X18
+L30: rts
+inc L76
+rts
+
+stop
+cmp X5, X9
+cmp L27, r6
+L31: jsr *r5
+bne *r2
+jsr *r1
+prn #-134
+L32: .data -311, -530, 617, 798, 47, -309, 873, 344
+clr *r6
+dec r5
+jmp *r3
+L33: .data -259
+prn X4
+L34: bne *r5
+not L156
+clr *r4
+red X11
+L35: sub #77, r4
+L36: prn r0
+stop
+L37: .data -773
+L38: .string "anipquexkqhjs"
+inc X0
+jsr *r6
+cmp #-125, L169
+stop
+L39: lea L98, *r2
+L40: .string "vhtgkengfzzyb"
+L41: mov X13, *r3
+
+jsr *r3
+add *r2, *r7
+mov *r4, L45
+not *r6
+lea X20, r3
+; comment
+add *r3, r3
+jsr L155
+red *r5
+stop
+lea L1, *r4
+sub #168, *r2
+L42: cmp *r0, #155
+prn r6
+prn L201
+L43: .data -754, -557
+sub #228, *r4
+L44: bne *r3
+add r1, r1
+red X18
+sub r6, *r2
+L45: .data -29, 547, -597, 769, -292, 661, -475
+; comment
+not r5
+prn *r2
+inc X7
+add *r7, L110
+clr *r5
+L46: lea X2, X20
+not r4
+; comment
+L47: lea L232, r0
+L48: add #60, r1
+clr L4
+dec r3
+rts
+dec *r5
+rts
+clr *r1
+dec r0
+; comment
+bne L219
+add *r1, X13
+L49: stop
+add r3, L246
+L50: .data -291, -973
+clr *r2
+rts
+stop
+prn r0
+sub *r6, r4
+jsr *r6
+
+bne *r7
+jsr L39
+prn X20
+L51: not r7
+L52: .string "fhbbvxeifnhgcecgmmxugw"
+mov #140, L136
+red *r6
+cmp L99, *r5
+stop
+L53: inc r4
+jsr *r6
+not *r1
+cmp r7, #235
+lea L227, *r0
+L54: .data 455, -151, -807
+rts
+bne *r2
+sub #-5, r6
+dec *r5
+prn X10
+L55: .data -724, 663, 861, 87, 169, -928
+lea L46, *r6
+
+L56: clr *r4
+mov *r6, r3
+mov *r7, *r6
+red r5
+L57: add #-187, L166
+bne X7
+jsr *r5
+L58: .string "jbeswnjeu"
+L59: .data 53, -28, 957, 144
+bne *r6
+add X20, r2
+sub #-136, *r2
+lea X1, X13
+sub r7, *r3
+clr L23
+inc *r5
+L60: jmp L35
+mov *r1, L42
+dec *r6
+clr r6
+L61: .data 957, -673, -674
+inc X20
+add r5, L219
+jsr L98
+sub L155, L76
+mov #-233, X4
+L62: .data 324, 684, -626, 853, 231, -92, -133, -872
+bne *r1
+dec *r2
+lea L122, L160
+L63: .string "fjdqbwjwhcldeofwllupopy"
+rts
+red r4
+not X10
+red *r1
+L64: jmp *r0
+inc r3
+
+mov r3, L108
+red r1
+prn X12
+sub r5, L43
+cmp #-191, L159
+inc L140
+inc r1
+
+L65: .data -928, -67
+
+L66: sub *r3, X3
+lea X0, *r3
+L67: not r2
+bne *r0
+add #-216, L59
+lea L22, X11
+L68: .string "zuzsmkemizaexcpitqr"
+rts
+cmp r1, L46
+add r2, X11
+jmp X6
+L69: .data -881, -444, -65, 179, -992, 344, 779, -799
+mov X17, r7
+add X17, X14
+not L25
+L70: inc r4
+cmp r0, r1
+sub X17, r3
+clr L86
+bne *r7
+bne X6
+jsr *r3
+rts
+cmp L122, r4
+jsr *r5
+L71: cmp *r3, *r0
+jmp *r5
+dec X14
+red X3
+rts
+add r4, r2
+L72: rts
+mov r1, X22
+L73: cmp r3, #147
+sub L55, L151
+mov *r2, L230
+clr X20
+L74: cmp #-93, L135
+jsr *r3
+dec *r2
+cmp *r7, *r1
+prn #125
+sub *r2, r4
+L75: add #43, *r7
+
+add #-244, *r7
+jsr *r0
+mov r1, L56
+mov #-153, X2
+sub L195, *r7
+jmp *r7
+inc L38
+dec r5
+lea X3, r1
+L76: .string "fnfaclyieomieu"
+inc L205
+not *r3
+jsr L47
+L77: .string "eworr"
+red r1
+
+L78: not L57
+prn *r4
+lea L207, r0
+L79: not *r2
+L80: inc L0
+stop
+bne X17
+red *r6
+mov r6, *r1
+L81: mov #-45, *r0
+clr r6
+jsr X5
+mov *r6, *r5
+L82: add L66, L246
+jmp L71
+red r2
+prn X10
+clr L99
+red *r4
+L83: add *r5, *r4
+jsr X10
+stop
+L84: .string "yzfefncjbqgx"
+L85: lea L17, r5
+
+L86: sub r3, r5
+sub L0, *r0
+dec L49
+sub r6, L82
+red X24
+sub #120, *r3
+bne *r5
+L87: .data 238, -134, -33, 52, -486
+cmp *r7, #74
+not *r4
+jsr X2
+sub r1, L47
+not *r0
+L88: red *r0
+lea L222, r6
+add r4, X4
+bne L28
+L89: lea X21, *r7
+mov #243, r1
+not L111
+sub r5, *r4
+L90: not r6
+sub L46, r1
+stop
+add *r5, r4
+prn *r1
+red X4
+bne X4
+L91: .string "uhyxqsifexwxccm"
+L92: sub *r0, *r5
+add #119, *r3
+prn *r5
+L93: .data -431, -257, -255, 847, 206
+sub #189, r7
+L94: .data 690, -27
+clr L129
+L95: stop
+clr *r0
+clr r6
+L96: jmp L70
+L97: sub #-127, *r6
+red *r5
+rts
+L98: .data -154, -701
+lea X22, *r5
+L99: not X5
+L100: cmp #-190, r6
+
+jsr L233
+; comment
+red *r7
+lea X12, *r5
+; comment
+jsr L9
+L101: rts
+prn r0
+L102: sub #-42, *r2
+
+mov r5, *r1
+red X1
+rts
+L103: lea X18, *r7
+L104: inc X3
+clr r2
+not L250
+add r0, L165
+inc X20
+mov *r6, *r4
+; comment
+clr r7
+not L136
+lea L92, L248
+add L34, *r0
+L105: .string "rrtjayagcajkvgc"
+clr X14
+prn #-82
+stop
+jsr *r7
+not r6
+dec L59
+not r3
+add #-49, *r6
+not X4
+
+red L40
+L106: dec r4
+L107: .string "hq"
+jsr X8
+not r4
+L108: lea L164, r6
+L109: inc *r1
+clr *r4
+L110: jmp L193
+prn *r7
+L111: inc L249
+L112: .string "rbcbmocqjkoubicksmh"
+L113: .string "mlccvxloql"
+clr r4
+L114: cmp X16, r0
+clr r4
+L115: .string "crtztmzoeoozyhcz"
+L116: .string "uwprizqpwmeclnbffbdsuixx"
+add L237, L64
+stop
+L117: .data 59, 252, 557
+inc X10
+clr r0
+L118: mov *r1, X18
+lea X3, r3
+jsr *r5
+L119: prn *r3
+jmp *r2
+
+L120: .string "mj"
+dec X6
+add r7, *r6
+add L208, L77
+L121: .string "cmapc"
+
+red r5
+clr L86
+rts
+L122: cmp *r2, *r7
+jmp X4
+L123: bne *r1
+dec r6
+L124: mov #-59, *r5
+inc *r7
+not *r3
+prn r4
+jmp *r1
+stop
+not *r6
+; comment
+lea X15, *r5
+prn *r3
+lea L241, L11
+inc r3
+L125: sub L70, r5
+L126: sub *r6, r7
+L127: lea L145, r3
+clr L162
+L128: prn X0
+jmp L100
+cmp *r6, X17
+jsr *r0
+rts
+not *r4
+L129: .string "qtquwcsdozbwaddjwlpjzy"
+not L118
+L130: .string "wzr"
+cmp r0, *r1
+lea X17, r4
+add L25, *r6
+; comment
+L131: .data -847, -528, 196
+jmp *r6
+not *r3
+L132: sub L128, r7
+inc *r1
+clr *r0
+cmp L196, #240
+mov r5, *r1
+prn L251
+cmp L116, *r1
+bne *r1
+cmp r6, r4
+dec X16
+L133: jmp *r0
+mov *r0, X8
+add L87, *r4
+L134: red X7
+L135: .data 102, 710, -892, 9, -69, -17
+L136: add r1, X8
+inc L59
+red *r3
+lea L221, r3
+prn #-109
+dec L50
+inc *r5
+L137: .string "psgsuhgttwbf"
+clr *r6
+L138: .string "qibvnlzmidnuwbw"
+jsr *r7
+jmp L79
+L139: inc *r0
+stop
+red r0
+jmp L78
+not *r3
+bne L69
+red L140
+L140: .data -386, 48, 859, -415, -100, -825, -216
+inc X15
+bne X19
+L141: sub #-37, r0
+mov #203, *r7
+rts
+L142: .string "cmnwlwasnlu"
+jsr L24
+bne X10
+add *r4, *r7
+sub #159, r1
+jmp L152
+red r7
+dec *r0
+cmp r1, *r2
+prn L32
+red *r4
+dec L95
+L143: clr X7
+L144: stop
+L145: jmp L229
+rts
+L146: .string "kvvdzadjp"
+jmp X6
+stop
+clr r3
+jmp L64
+mov #-13, r7
+L147: .string "nnrhqouxvjjy"
+clr *r7
+rts
+L148: .string "wolncuzlqgxniturldgodrya"
+add #-25, *r0
+L149: .string "pnccov"
+red *r3
+not r4
+jmp *r4
+stop
+L150: cmp r1, X21
+not *r2
+lea X2, r4
+prn *r1
+not r2
+L151: red r7
+L152: dec r4
+rts
+jsr X5
+
+L153: jmp *r1
+stop
+lea X1, L99
+dec *r7
+add #-40, X7
+jmp X14
+stop
+add L92, X15
+stop
+sub #-193, L223
+rts
+lea X13, r7
+add *r0, r2
+bne L122
+L154: add #149, *r6
+; comment
+L155: .data 849, -559, -325, -755
+dec r2
+inc r5
+sub *r0, r6
+jmp L194
+cmp *r1, X14
+stop
+L156: .string "egqhjwvtaxgfyml"
+L157: .data -129, -20, -276, -312, 21, 496, -467, -734
+rts
+red r0
+jmp L161
+jmp *r7
+L158: .data 485, -232, 689, -934
+not X20
+cmp *r7, r5
+red r6
+L159: lea L19, L196
+sub X20, *r6
+bne L112
+dec r6
+add X7, *r5
+bne L199
+L160: .string "fplguxrscmmg"
+L161: .string "ss"
+add *r6, r3
+jsr X11
+clr r3
+add *r3, L199
+mov *r4, X15
+L162: rts
+not *r3
+jsr *r5
+rts
+red *r4
+jmp X20
+jmp *r3
+clr r7
+L163: sub L229, *r4
+L164: .string "w"
+L165: red r2
+; comment
+dec *r7
+inc r6
+L166: clr *r3
+jmp L152
+L167: .string "rbbpkwqwyzfoeyva"
+L168: mov L77, r4
+rts
+; comment
+jmp L187
+stop
+stop
+rts
+L169: bne L250
+bne L36
+red r7
+L170: not *r6
+stop
+
+rts
+L171: stop
+mov X7, r7
+L172: cmp #209, *r3
+jmp *r2
+prn L131
+mov #29, L238
+dec L102
+cmp *r7, *r4
+clr *r4
+rts
+L173: .data -563, -827, 196, -113, -637, 928
+sub L167, X12
+mov *r7, L196
+L174: not *r5
+clr *r1
+L175: .data -480
+jsr *r1
+bne *r0
+clr *r4
+mov *r3, L195
+lea L220, r2
+L176: .string "j"
+red X17
+bne *r7
+lea X2, r1
+dec *r3
+cmp r5, r1
+sub *r2, *r2
+dec *r2
+L177: red X13
+L178: inc r6
+inc *r6
+jsr *r7
+red *r1
+L179: .data 949, -279, -122, 310
+L180: .data -84, 931, -919, -520, 284, 477, 667, -530
+prn L261
+not r6
+L181: mov *r2, r0
+L182: bne X9
+L183: bne L15
+L184: .string "zkce"
+L185: bne L130
+prn r0
+cmp L16, L161
+L186: sub *r1, L210
+L187: clr r5
+jmp L233
+clr L213
+dec L151
+clr L259
+stop
+L188: .data -851, -174, -656
+red *r7
+clr X15
+; comment
+mov r5, X2
+prn #144
+L189: bne *r0
+prn *r7
+L190: dec r3
+not X7
+inc r6
+L191: mov L224, L20
+L192: .string "akms"
+add r5, L238
+L193: .data 75, 567, -26, 383
+not X5
+dec r7
+L194: .string "dawsy"
+L195: .data 34, -51, 217, 143
+sub r0, *r4
+bne *r7
+jmp X17
+rts
+stop
+L196: jsr *r6
+L197: .string "ixzarusbrsbruv"
+add r5, r7
+cmp r2, r1
+dec *r3
+inc L157
+rts
+sub *r2, *r5
+L198: dec r3
+L199: jmp L222
+sub r7, r4
+not r4
+cmp L34, #60
+lea X1, *r0
+rts
+stop
+clr *r3
+; comment
+mov L61, L251
+rts
+lea L246, X15
+L200: .data 764, 374
+red L211
+not r0
+mov X4, L172
+dec L215
+prn *r4
+bne *r5
+L201: mov r2, L231
+L202: not *r0
+L203: dec r1
+rts
+clr *r0
+clr *r7
+sub X19, r0
+sub r3, *r0
+sub L221, r3
+add r4, *r0
+inc X2
+red r6
+sub r4, r7
+not r1
+L204: jsr *r2
+stop
+mov #240, *r7
+red X23
+stop
+jsr *r6
+lea L184, *r7
+dec r5
+; comment
+mov r4, *r3
+L205: sub X8, L217
+not X15
+not r4
+; comment
+L206: jmp *r2
+rts
+L207: red r5
+L208: .string "dthvttuvn"
+cmp r6, L162
+L209: add #-46, X20
+dec L247
+L210: rts
+jmp L59
+L211: not r4
+bne *r4
+cmp r0, X6
+clr *r0
+cmp *r2, #-98
+L212: lea X13, *r4
+L213: bne *r6
+mov #199, L259
+stop
+jmp L175
+
+add *r0, r3
+rts
+L214: add r3, L260
+clr *r6
+L215: rts
+L216: clr *r4
+L217: mov r2, *r4
+bne *r3
+; comment
+L218: .data 784, -705, 687, 354
+
+lea X15, L226
+lea X2, *r5
+mov X10, *r4
+rts
+cmp X5, #-37
+jsr L242
+stop
+jsr X8
+L219: .data 54
+mov *r0, *r6
+bne *r5
+L220: sub r6, *r4
+clr r7
+L221: mov r0, L192
+sub #242, r3
+jsr X11
+jmp L213
+prn #109
+L222: stop
+stop
+L223: .data 192, -864
+
+red r6
+red *r2
+
+lea X24, *r1
+lea X17, r0
+L224: mov r2, *r4
+rts
+not L243
+clr r5
+sub *r4, *r4
+L225: .data 490, -51, 354, 946, -177
+rts
+lea X3, r1
+L226: .data -783, 401, -472, 622, -266, 778, -144, 237
+mov L234, r0
+L227: inc *r5
+bne *r0
+dec *r5
+bne L28
+lea L254, r6
+jsr L75
+bne *r4
+add #37, *r4
+; comment
+L228: cmp L230, *r3
+sub #-22, r6
+L229: jmp X6
+inc *r2
+lea X22, L13
+L230: .data 437, 654, 175, 49, -131
+mov #-104, *r5
+cmp r0, #50
+L231: .string "itevlxmgdmktlkkkwfa"
+
+L232: prn *r0
+dec X8
+sub X12, L256
+bne L28
+L233: jsr L88
+L234: bne *r4
+clr r0
+bne *r0
+cmp *r4, #-90
+rts
+jsr *r0
+not r4
+L235: .string "vjvhqyryjqlvtnldolkt"
+add #-18, X10
+prn #-103
+inc r0
+rts
+dec r2
+L236: .data 215, 984, -10, -553
+L237: .data -827, 143, 948, -180, 625
+cmp *r5, L66
+inc r7
+rts
+inc r1
+mov #20, r3
+L238: .data -559, -164, 990, -484, 898, 645
+sub *r7, r1
+prn *r0
+jmp L259
+clr r5
+add L239, r3
+L239: jmp *r6
+L240: .data -998, 26, 580, 941, -512, 974
+stop
+jsr L248
+rts
+L241: stop
+cmp #30, L248
+red r5
+rts
+bne X14
+
+L242: inc r2
+L243: .data 140, 351, -214, 782, -500, 478
+L244: .data -998, -805, 692
+L245: jmp X3
+lea L258, r3
+L246: .data -448, -987, -83, -236, 168, 435, -524, 752
+sub r1, L261
+inc r1
+prn *r0
+jmp L113
+prn L249
+stop
+prn r4
+L247: bne *r0
+lea X3, *r1
+lea L260, X24
+L248: mov *r5, r0
+L249: .string "fl"
+bne L64
+add #133, r1
+rts
+lea L260, r1
+inc *r5
+L250: .string "ezukngdzjfjzyakj"
+rts
+L251: .string "sqvcmmnvqsi"
+red X12
+jmp X22
+L252: clr L257
+rts
+not r4
+jsr *r0
+jsr L173
+mov X19, *r6
+not L99
+; comment
+red r5
+cmp L261, #-97
+L253: sub X7, *r3
+jmp L227
+L254: stop
+clr r6
+bne L99
+not r0
+add #-127, L255
+bne X18
+L255: .string "ksvmxafluxshrlqoglriqexg"
+L256: inc r6
+L257: lea L260, r1
+dec X20
+L258: add #-181, L5
+jsr *r6
+L259: .data 783, -54, 236, -897, -24, 224, -540, 104
+prn r3
+jsr *r5
+prn #133
+mov *r1, X14
+L260: .string "jlqxwazimph"
+sub *r1, r6
+mov #90, L261
+not *r6
+jmp X24
+
+mov *r3, L263
+not r1
+dec r2
+clr r2
+L261: inc *r4
+inc *r1
+lea L197, r1
+L262: stop
+mov r4, *r7
+dec r3
+L263: mov r7, L82
+clr r4
+jmp L36
+red *r7
+cmp r6, #36
+stop
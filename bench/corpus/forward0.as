@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 1
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+inc L314
+L0: rts
+L1: sub r7, *r3
+bne L5
+jsr L236
+L2: stop
+L3: prn r1
+cmp r1, #-87
+L4: mov L350, *r1
+L5: mov *r1, r5
+
+dec *r2
+L6: .string "ycouglxdfqblmmgtmnfwzbe"
+L7: lea L15, *r6
+stop
+L8: red r0
+rts
+cmp r1, *r3
+jsr *r2
+mov *r4, L270
+dec L204
+L9: .string "sbdnnhsxxvecpjapfzgm"
+L10: add #-32, *r4
+not *r6
+dec L178
+sub #187, r1
+L11: add L40, *r7
+mov #8, L41
+L12: .data 842, -776, -697, -230
+L13: prn r2
+red *r2
+mov r0, *r2
+L14: .data -21
+stop
+sub r3, r2
+L15: sub #-185, L154
+jmp L109
+lea L336, L132
+not *r7
+jmp L142
+red L294
+L16: bne L255
+jmp L242
+L17: lea L264, *r5
+cmp L269, #-189
+not r6
+rts
+clr r2
+L18: inc L177
+L19: red L30
+prn #122
+L20: .data 121, -730
+L21: add *r4, L157
+clr L303
+rts
+mov L255, L136
+L22: not *r3
+dec L280
+L23: bne *r1
+L24: add *r1, L113
+mov r4, *r5
+bne *r0
+
+inc L101
+L25: clr r6
+cmp r7, r0
+mov *r4, *r6
+L26: add r2, *r4
+L27: rts
+L28: inc L135
+add L169, *r5
+dec L147
+L29: .data -1000, 190, -995, 638, 139, -510, 225, 809
+dec r0
+clr *r6
+L30: cmp L87, #12
+L31: prn #-230
+L32: .data 659, -374
+jmp L92
+L33: prn *r5
+lea L350, r7
+bne *r0
+sub r4, *r7
+L34: .data -526, 822
+clr L196
+prn r0
+prn r3
+bne L42
+lea L75, r7
+lea L282, r3
+add *r4, *r5
+L35: rts
+L36: prn #70
+stop
+rts
+bne L219
+L37: .string "hsydhrulmbnniozjrqozxjz"
+L38: bne *r6
+not *r5
+; comment
+L39: sub r1, L202
+L40: .string "ginrlgsq"
+red L160
+inc L211
+jsr *r6
+not *r1
+jsr *r5
+inc L137
+prn r1
+L41: clr *r5
+jmp *r3
+prn #242
+L42: bne L97
+inc r2
+sub L360, L266
+sub L341, L335
+not L262
+red *r3
+bne L54
+red L199
+L43: bne L61
+L44: .string "xatyfdgnmjunyiy"
+prn L50
+mov *r6, r6
+dec L187
+bne *r2
+L45: mov *r0, L232
+not r7
+not *r6
+add r6, L354
+not *r0
+mov *r1, *r5
+jsr *r4
+
+prn L155
+L46: sub r7, r4
+L47: jmp L120
+jmp L345
+add L67, L234
+add #-192, r7
+L48: inc L242
+L49: .string "ekkvrrdensh"
+clr *r7
+prn *r4
+L50: mov #245, L191
+L51: clr *r3
+red r3
+L52: jmp L306
+add #-127, L54
+L53: .string "dvhweaqnbpaqv"
+L54: stop
+bne *r0
+L55: dec r5
+inc L143
+jsr *r3
+stop
+; comment
+L56: lea L288, L353
+L57: inc L338
+L58: prn *r0
+not r1
+L59: .string "vnqqmjlhqcmtoc"
+jsr *r0
+red L65
+cmp L263, *r2
+jsr *r1
+rts
+; comment
+jsr L193
+L60: .string "lon"
+stop
+lea L109, L98
+L61: clr *r1
+cmp #-240, r1
+L62: prn *r5
+L63: jmp *r6
+red *r3
+L64: jmp L123
+L65: .string "z"
+jmp L122
+L66: clr L345
+not *r1
+L67: jsr *r6
+
+add *r0, r1
+L68: add r1, L70
+L69: mov *r2, L342
+red r2
+inc r6
+L70: rts
+L71: mov #149, r7
+jmp L164
+L72: .data 660, -812, 205, 885, -263
+inc *r0
+sub #166, r4
+lea L92, *r6
+add *r5, *r7
+L73: cmp #25, *r4
+lea L85, L142
+L74: .string "spfp"
+lea L361, *r0
+L75: red L300
+bne *r0
+jmp *r7
+add #-82, r3
+mov r1, *r7
+; comment
+L76: inc *r0
+add L303, *r2
+bne L320
+not r6
+lea L153, *r7
+prn #67
+L77: .string "yovroznct"
+L78: .string "rralazdgspt"
+L79: .string "i"
+jmp L130
+; comment
+red L273
+sub L183, L339
+
+lea L223, L127
+; comment
+cmp L337, *r3
+red r2
+rts
+L80: stop
+L81: mov #-184, L170
+cmp *r1, #129
+L82: bne L281
+add L187, L207
+L83: prn #29
+lea L323, L224
+; comment
+L84: jsr L139
+lea L208, L143
+add r1, L234
+L85: inc r0
+lea L314, L265
+; comment
+stop
+not r4
+L86: rts
+mov r1, L307
+L87: .string "rpfzbqzgvz"
+red r7
+red L333
+L88: bne L166
+
+stop
+sub *r7, r5
+L89: prn r3
+L90: rts
+L91: .string "wdsm"
+rts
+jsr *r4
+sub L194, r5
+rts
+L92: .data -9, -494, -633, -177, -770
+prn L339
+stop
+cmp #-76, L240
+clr *r4
+jsr L143
+L93: jmp *r4
+L94: red *r3
+L95: cmp *r3, #-134
+jsr *r3
+jsr L270
+L96: dec r1
+jsr *r3
+L97: .string "ayrlncgbndiugnepp"
+jsr *r7
+L98: bne *r3
+clr *r7
+L99: dec r4
+rts
+sub *r2, L349
+prn *r0
+dec L304
+jmp L135
+red L271
+add L194, *r1
+cmp L147, #-195
+not L351
+jmp *r0
+L100: inc r7
+rts
+L101: inc r7
+stop
+sub L155, *r6
+clr L325
+prn *r6
+mov r1, *r4
+bne L250
+L102: clr r2
+stop
+L103: inc L326
+L104: lea L175, r0
+clr L130
+jmp *r5
+rts
+L105: inc r1
+L106: bne L332
+clr r7
+
+jmp *r3
+L107: bne L214
+bne *r0
+; comment
+L108: .data -455, -663, 185, -179, -313, 905, 477
+L109: mov #217, L164
+clr L251
+L110: jmp L360
+L111: dec L314
+not r4
+jmp *r6
+red *r4
+L112: prn #174
+L113: dec L119
+dec *r6
+jmp *r4
+rts
+cmp L173, #232
+L114: add *r5, L115
+add r5, *r2
+prn *r3
+jsr L150
+mov #86, r2
+add *r3, *r5
+L115: add #-52, r0
+; comment
+L116: .string "pntzopuhwffinnawklfw"
+stop
+lea L203, r5
+L117: stop
+jmp L140
+L118: sub *r2, r7
+L119: red L341
+dec L159
+jmp *r3
+sub *r2, *r4
+stop
+cmp #52, *r4
+L120: red r4
+L121: rts
+L122: .data 455, -965, 247, 292
+L123: .string "pv"
+jmp L160
+L124: add r6, *r5
+dec *r0
+clr L255
+clr r0
+L125: bne L172
+bne *r2
+L126: dec L168
+not L274
+jmp *r7
+lea L272, *r6
+; comment
+L127: clr *r1
+L128: .data -637, 667, 856, 724, -134, -524, 693
+inc *r4
+L129: .string "lelkyjadpugna"
+L130: red r3
+cmp r5, r4
+jmp *r4
+dec *r1
+jmp *r6
+L131: .data 795
+stop
+L132: .string "dskevryfyfadgodxphasc"
+clr *r2
+lea L362, *r0
+L133: .string "shdikincrmjkzkmbyqxuc"
+lea L209, *r4
+L134: .data -30, 992, -236
+L135: jsr L225
+dec *r2
+jmp *r2
+prn *r2
+L136: rts
+L137: .string "geg"
+L138: sub r4, *r0
+prn r5
+stop
+rts
+jmp L181
+jmp *r0
+mov #-80, *r1
+stop
+clr L321
+L139: add #-34, L217
+bne L167
+L140: sub r4, r6
+not *r0
+L141: not *r4
+L142: lea L232, *r5
+L143: .data -439, -663, 697, -247, 471, 613, -972
+jsr L250
+not *r5
+rts
+bne *r1
+sub L356, *r0
+L144: mov #132, r3
+L145: bne L245
+sub #-156, r0
+lea L302, *r7
+L146: jsr *r3
+L147: .data -980, -249, 492, -197
+L148: .string "mnljrskjrecicvtuhiue"
+dec r5
+red L221
+lea L316, r0
+sub #-221, L356
+L149: stop
+L150: clr *r3
+inc L251
+L151: mov L164, L218
+L152: .data -292, -204, -872
+L153: stop
+sub L236, r6
+mov r4, r2
+bne *r2
+L154: jmp *r2
+prn r2
+rts
+cmp L160, *r0
+clr *r0
+rts
+stop
+L155: not r3
+L156: stop
+red *r4
+cmp #-194, L347
+L157: prn r0
+jmp *r4
+L158: clr r4
+rts
+L159: prn L316
+rts
+bne L350
+prn L219
+clr r4
+L160: .data 981, 853, 146, -564, -524, -346
+prn L356
+L161: stop
+mov r0, L281
+L162: red *r5
+cmp #-168, *r7
+lea L272, L288
+L163: mov r7, L319
+bne L176
+
+add r7, *r5
+jsr *r3
+jmp *r7
+L164: .string "xbmalzdkibnbrz"
+L165: .data 251, 131, 892, 102
+rts
+L166: sub r3, r3
+add *r3, L247
+L167: .string "ipydrzmyyewnloakwzcly"
+L168: not *r6
+add *r6, *r0
+L169: .data 277, 342
+
+not L232
+L170: mov #-131, r4
+; comment
+L171: jsr L215
+L172: red *r3
+mov L295, r5
+jmp *r6
+L173: inc r5
+bne L226
+L174: clr L344
+L175: jsr L300
+sub *r3, r4
+clr L192
+lea L197, L360
+L176: sub *r3, r7
+lea L326, *r1
+add *r4, r2
+cmp *r7, #-125
+; comment
+L177: .string "zcuootgbxwudpqqebdxozz"
+
+L178: not r3
+L179: stop
+L180: rts
+jmp L306
+red r4
+L181: mov #-214, *r3
+inc *r7
+L182: rts
+L183: jmp L216
+L184: .string "vlselgbhjcptsdkcboceu"
+bne *r5
+L185: jmp *r1
+
+red r0
+L186: jmp L346
+jsr *r0
+dec L305
+mov *r5, L294
+rts
+lea L254, r3
+L187: jsr *r7
+L188: clr *r4
+not r4
+add #-128, r2
+L189: .string "oftezeilbbfqzlypdfqwu"
+rts
+jsr L312
+red *r6
+L190: rts
+dec *r5
+not *r3
+cmp L237, *r6
+clr r5
+prn r6
+add L319, *r3
+cmp r2, L273
+rts
+rts
+inc *r2
+L191: jmp *r7
+mov L203, r7
+clr L264
+add r6, *r3
+L192: .string "vukqtzybebprhdgnranae"
+rts
+
+sub r5, *r1
+L193: .data 684, 776, -570
+L194: prn *r0
+add L305, L222
+L195: inc r1
+clr r6
+L196: lea L295, *r2
+L197: .data -204, 888, 741, 643, 760
+not L326
+L198: red *r5
+L199: jmp *r0
+L200: .string "bthc"
+dec L346
+mov #-211, L311
+L201: jsr *r3
+L202: cmp r4, #-103
+cmp L315, r5
+
+L203: prn *r7
+L204: .string "cnsljrjbqilp"
+not r4
+red L276
+L205: cmp L251, r7
+bne *r3
+L206: inc r4
+not *r4
+L207: clr *r4
+L208: dec L358
+L209: .data 361, -322
+L210: cmp r6, *r3
+L211: dec r1
+prn L329
+red L331
+dec r7
+L212: mov #-71, *r2
+L213: .data 232, -301, -751, 171, -668, 680
+L214: red *r1
+L215: jsr L327
+rts
+rts
+L216: not L311
+clr r6
+L217: .data -76
+cmp L353, r7
+L218: .data 247, 831, 681, -908, -692, -237
+stop
+L219: lea L349, *r3
+add #96, L243
+prn #-92
+rts
+lea L325, r2
+lea L312, L270
+L220: clr *r2
+L221: stop
+inc r2
+L222: jmp L284
+L223: not L278
+dec L355
+L224: cmp r1, L339
+red *r0
+cmp #-176, L342
+L225: red r5
+bne L233
+clr *r3
+; comment
+mov #174, *r6
+bne *r4
+prn *r7
+; comment
+
+red L314
+
+prn *r3
+lea L305, *r0
+L226: not L227
+; comment
+cmp #20, L336
+L227: .data -567, 337, -578
+jmp L323
+L228: dec r0
+L229: .string "uoy"
+L230: add L236, *r0
+jsr *r6
+L231: inc *r0
+L232: red r0
+stop
+L233: inc r1
+L234: cmp L301, #132
+L235: mov *r7, r0
+sub *r3, r6
+prn L265
+L236: .data 238, 465, 585
+L237: .data 83, 396, -637, -705
+prn L351
+
+dec L281
+; comment
+L238: lea L350, *r1
+lea L358, r4
+cmp L257, #125
+cmp *r4, *r1
+L239: lea L321, L250
+rts
+L240: dec L246
+add #43, r0
+L241: jmp *r0
+sub *r6, r4
+jmp *r0
+L242: lea L310, L329
+cmp #-236, L345
+jsr L253
+prn r5
+L243: sub *r6, r3
+cmp L298, *r6
+clr L278
+sub r7, *r2
+dec L362
+L244: add L312, r1
+L245: sub #117, r4
+lea L246, *r5
+inc r1
+clr r3
+red *r6
+stop
+stop
+cmp #30, r7
+
+dec *r5
+sub *r6, r4
+bne L277
+L246: .data -307, 996, 798
+mov r6, L278
+jsr *r3
+L247: red L317
+L248: jmp *r4
+add #178, *r4
+L249: .string "biaodeigdqtrwgcbyunwr"
+L250: red r5
+clr r6
+sub L257, r5
+L251: dec *r4
+L252: not r5
+mov r3, L341
+red L325
+L253: add r6, L349
+
+mov #-204, *r6
+L254: .data -442, 154, 436, 875, -802
+L255: .data 627, 935
+L256: .string "sexhewwbkwaz"
+prn #1
+mov L286, r2
+jsr L284
+sub r3, L346
+inc *r0
+L257: bne L298
+clr *r1
+red *r7
+bne *r0
+prn r4
+mov L344, L294
+L258: .data -542, -191, 589, -328, 884, 340
+L259: inc L307
+L260: red r4
+
+lea L329, *r3
+L261: not *r1
+stop
+L262: red *r2
+add *r1, *r3
+L263: cmp #-100, #-4
+rts
+L264: lea L334, *r5
+red *r0
+L265: .data 990, 832, -297, -54, -164, 78
+L266: .data 291, -287, -390, 686
+L267: add L326, *r0
+red r6
+L268: red L313
+L269: not *r3
+bne L274
+red L319
+
+bne *r7
+L270: not *r4
+L271: add *r1, r5
+jsr L284
+clr *r6
+rts
+clr L312
+prn L294
+stop
+not L281
+L272: .data 879, -834
+mov L284, r2
+jsr *r7
+red L309
+mov *r4, r7
+red *r4
+prn *r6
+rts
+L273: rts
+cmp L335, *r0
+L274: .string "hvzje"
+L275: inc *r2
+lea L339, r4
+stop
+mov *r1, *r4
+bne *r3
+prn #-3
+L276: sub *r2, *r1
+L277: .string "adskmpqnciu"
+mov *r5, L315
+jsr L328
+clr L281
+L278: not r1
+bne *r2
+L279: jsr L347
+clr r4
+L280: .string "ht"
+stop
+dec *r1
+L281: lea L305, *r6
+; comment
+L282: stop
+prn L350
+
+rts
+dec *r5
+stop
+L283: inc r7
+L284: red *r5
+L285: clr *r5
+jmp *r4
+rts
+rts
+L286: jmp *r5
+rts
+L287: clr r5
+cmp L357, #133
+L288: clr r1
+clr r3
+mov r3, *r7
+L289: .string "cgdnnmwhlfjqsgyp"
+jmp *r4
+L290: .data 769, -844, -282, 781, 131, -877
+L291: add *r3, *r1
+sub #-48, r3
+mov *r6, r1
+lea L304, *r2
+prn r3
+
+jsr L340
+lea L323, L337
+bne L326
+rts
+L292: clr *r4
+stop
+mov L352, L299
+inc L310
+L293: cmp L332, L294
+red L312
+L294: inc *r2
+stop
+stop
+stop
+mov *r1, r1
+L295: jsr *r1
+
+L296: .string "wzoyerztupqbpfeghgkje"
+L297: bne *r2
+sub r1, *r3
+L298: .string "wnvgsfljgk"
+red r6
+sub L340, *r7
+add r6, *r3
+L299: stop
+clr L300
+jsr L334
+red *r5
+mov *r1, *r6
+bne L316
+dec L355
+inc *r4
+cmp L359, r7
+prn *r0
+not *r0
+cmp *r4, #-18
+jmp L340
+bne *r0
+dec *r6
+jsr *r0
+inc r2
+; comment
+L300: mov #185, *r7
+add r7, r6
+jsr L325
+L301: .string "ugsgk"
+inc L354
+prn *r0
+not L305
+L302: stop
+jsr L336
+L303: clr r2
+jmp *r5
+sub *r6, L314
+prn *r5
+clr L309
+add r0, L330
+L304: .string "ijityqb"
+L305: jmp L329
+add r3, L319
+L306: .string "pyovglcdkimvugmc"
+L307: lea L349, L349
+jmp *r0
+L308: .data 507, -978, -108, -498, 393, -396, 4, -287
+cmp *r3, r6
+inc *r3
+jmp *r2
+mov L339, *r4
+L309: .string "inkekjqvmvjqj"
+L310: .string "npck"
+inc r2
+L311: bne L321
+clr r2
+bne *r3
+clr *r7
+prn #-3
+stop
+L312: prn *r2
+L313: .data 965, 281, -928, 930, 405, 962, 330
+dec *r1
+lea L329, L324
+L314: clr r7
+mov #-196, *r3
+jsr L327
+L315: lea L349, *r4
+L316: .data -738, 117, 371, 692, 607
+L317: bne *r0
+sub #179, L352
+not *r3
+rts
+stop
+L318: mov #-97, L346
+L319: jmp *r2
+
+L320: jmp L339
+prn #249
+not r6
+L321: add L335, L363
+L322: .data 890, 100, -760, -278, 31
+L323: jmp *r1
+sub L342, L362
+L324: .string "gamntjbofcwciu"
+L325: not L352
+L326: prn *r5
+not L359
+inc L335
+L327: dec L356
+lea L343, L343
+L328: bne L338
+L329: jsr L334
+prn *r0
+L330: .string "ohdpbqvv"
+inc *r3
+rts
+lea L340, L346
+mov L340, L350
+L331: mov *r2, r6
+L332: jmp L337
+stop
+clr r4
+sub #-222, L350
+dec L358
+bne *r4
+clr L336
+cmp *r0, *r1
+L333: dec L338
+inc *r4
+prn L359
+red *r5
+bne *r5
+
+L334: red r3
+jsr *r4
+L335: sub #-198, *r5
+bne *r4
+prn L363
+stop
+L336: rts
+rts
+L337: add L363, r6
+inc *r7
+prn #151
+L338: add #-249, *r3
+L339: add L346, L357
+red L349
+red L353
+L340: bne *r5
+L341: jsr *r1
+stop
+L342: mov #106, r2
+inc r2
+sub r4, L353
+stop
+L343: jmp *r1
+; comment
+; comment
+rts
+L344: sub *r4, L350
+L345: mov #241, L354
+lea L348, *r1
+mov *r0, L361
+jmp L359
+rts
+L346: stop
+jsr *r6
+L347: stop
+L348: .data 995, -490, -656, 522, -927, 277
+L349: not L352
+jmp L352
+stop
+prn L357
+mov #-196, r4
+clr L362
+
+L350: rts
+add *r0, r2
+L351: lea L355, *r0
+L352: cmp r5, L360
+stop
+not r3
+inc r6
+L353: cmp r3, r7
+; comment
+not r6
+dec r4
+stop
+jmp L358
+jmp L360
+L354: prn *r5
+L355: not L362
+add *r7, L363
+stop
+rts
+mov *r4, r2
+L356: not r7
+not r2
+L357: stop
+lea L362, L363
+inc *r7
+L358: jsr L360
+not *r5
+bne *r1
+inc L362
+lea L362, r1
+
+L359: jmp L360
+jmp *r6
+red r3
+L360: dec *r6
+L361: jmp L362
+inc r3
+L362: jmp *r2
+rts
+L363: dec *r4
+stop
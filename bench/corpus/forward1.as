@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 2
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+rts
+dec r6
+lea L257, r4
+lea L12, *r6
+mov *r0, *r4
+rts
+lea L2, L191
+L0: jmp L329
+sub L343, L307
+dec *r1
+sub #14, r6
+add L79, r1
+prn r1
+jsr L231
+bne L91
+dec *r5
+L1: jsr *r3
+
+L2: .string "zfskpgplnkl"
+not r1
+bne *r1
+L3: .string "todxwvttdilmofvgldzh"
+clr r2
+L4: .string "pkmmbhqgpopalewwtnnnysss"
+bne *r6
+L5: inc *r6
+L6: jsr *r2
+L7: rts
+L8: dec L217
+stop
+L9: bne *r4
+prn r1
+stop
+sub r7, *r0
+L10: jmp L204
+
+jmp *r1
+L11: red *r3
+L12: red *r6
+cmp r2, #138
+lea L29, r1
+cmp #67, *r2
+L13: rts
+L14: .string "aylnfssnzkjidgewmzozl"
+jmp *r0
+L15: dec L67
+sub L92, r6
+cmp #198, #-201
+L16: prn r6
+L17: inc L230
+L18: .string "yzscjmchsxw"
+cmp #44, L310
+; comment
+L19: clr L59
+prn #-101
+L20: sub L342, *r7
+rts
+add r4, r7
+L21: add #-207, L166
+cmp #215, *r6
+bne *r4
+L22: rts
+L23: add *r7, r2
+sub L252, *r1
+jsr *r7
+L24: red L241
+lea L47, *r1
+not r7
+cmp *r2, L277
+L25: dec *r3
+L26: red r6
+stop
+L27: sub #-182, *r4
+red *r1
+L28: mov L308, r6
+not r2
+L29: add *r0, r0
+clr *r0
+; comment
+lea L302, *r2
+L30: jmp *r3
+L31: stop
+; comment
+not r2
+mov *r7, r4
+L32: jsr *r0
+sub r6, *r5
+lea L249, L335
+cmp *r3, *r0
+bne L102
+prn #-195
+rts
+L33: jsr *r1
+stop
+L34: rts
+sub *r1, r1
+L35: rts
+sub *r2, r2
+
+lea L110, *r4
+rts
+L36: .data -632, 661, -548
+inc L60
+L37: prn #36
+L38: .data 263, -216
+red L93
+add r2, r2
+stop
+L39: prn L321
+L40: .data 908, 632, -453, -330, -570, 72, 795, 381
+clr *r5
+L41: .data 772, 719, -43, -162, 860, 447, -821, -506
+cmp L184, r2
+dec r3
+L42: stop
+jmp *r5
+inc L282
+L43: .data 742, 116, 616, 492, 548
+clr r6
+red L303
+not *r5
+clr r7
+cmp L110, #-182
+L44: jsr *r3
+L45: cmp #-35, #249
+L46: .data 686, 57, -729, 130, -301, 168
+L47: stop
+jsr *r5
+L48: lea L82, L272
+L49: dec L106
+lea L340, L305
+L50: stop
+L51: cmp r1, *r6
+L52: bne *r4
+mov r2, L235
+add #-44, r1
+jmp L95
+L53: red r3
+dec L98
+sub *r7, *r0
+inc *r2
+L54: .data 915, -816, 931, 497
+; comment
+jmp *r3
+L55: prn r0
+bne *r5
+red r7
+stop
+cmp *r4, L343
+lea L321, r0
+jmp *r2
+L56: add *r6, L76
+rts
+stop
+not L228
+mov #124, r7
+L57: cmp r6, L177
+jsr *r6
+L58: add r3, *r6
+sub #-122, *r6
+not *r2
+L59: rts
+clr r6
+inc *r4
+not r3
+jmp *r4
+L60: mov #73, *r7
+rts
+not r1
+lea L133, L283
+L61: .data -177, -220, 960, 193
+cmp #219, #-225
+stop
+L62: .string "bhhczaidoccqcyu"
+prn #50
+L63: lea L314, r7
+L64: jmp L94
+dec r4
+red L268
+lea L88, *r1
+red r3
+L65: lea L164, *r3
+sub r6, r7
+jmp L79
+add r1, r5
+L66: lea L183, L159
+mov *r0, *r7
+L67: cmp L126, r7
+inc L245
+jmp *r4
+L68: jmp *r7
+L69: cmp *r2, *r3
+L70: .string "knoricng"
+lea L236, r5
+red *r1
+add r2, L72
+bne *r7
+L71: red L162
+L72: add L305, *r2
+red L93
+not *r2
+red *r1
+L73: red L248
+inc r4
+dec *r2
+L74: .string "aodazocodulc"
+add #240, *r6
+mov L205, L240
+red L142
+rts
+prn *r2
+L75: .data -488, -346, 282, -825, -674, 434
+inc r4
+rts
+; comment
+lea L249, L92
+jsr *r0
+add *r6, L293
+stop
+L76: .string "adrcqxglg"
+L77: prn L159
+L78: inc *r5
+L79: red *r3
+jmp L82
+lea L271, L334
+add *r7, L321
+L80: .data -878, -915, 874
+cmp L171, r5
+cmp r6, L270
+mov #-212, L122
+not r0
+bne *r4
+not *r5
+L81: red L302
+inc r7
+stop
+cmp #220, *r5
+jsr L131
+jsr *r1
+L82: cmp *r5, L221
+sub #-147, *r7
+inc L339
+inc r6
+not L247
+L83: red L131
+L84: prn r0
+cmp r6, *r7
+add #5, r4
+dec r7
+lea L115, r5
+mov #101, *r0
+jsr *r4
+add r4, *r2
+L85: dec L270
+clr r6
+L86: .string "zqmwdexgnnerryiunbr"
+L87: .string "jvilwnnculzzztitlhojmblx"
+jsr *r1
+lea L206, *r7
+L88: .data -916, -142, -456, 832
+L89: stop
+cmp r7, r5
+lea L291, *r6
+add L142, *r3
+L90: stop
+add L231, L105
+lea L166, r3
+; comment
+L91: add L186, *r7
+L92: cmp r3, L301
+L93: add r3, L206
+L94: add L140, *r7
+inc *r5
+clr r3
+L95: add #-158, L314
+cmp *r0, L335
+L96: lea L205, r1
+not L227
+clr r6
+red r6
+not L297
+L97: lea L126, L337
+sub r5, r4
+not r2
+dec *r2
+jsr L294
+dec L334
+L98: mov L296, L301
+L99: .data 110, -556
+L100: .data 655, 245, 115, 817, 992, -669, 791
+stop
+L101: add #201, *r7
+L102: .string "iz"
+sub #22, r2
+L103: .string "lizfkvaitjv"
+L104: .string "uguhyhioxttfka"
+bne L215
+prn #205
+sub #52, *r2
+mov #218, *r7
+dec r0
+add #-195, L309
+L105: sub *r3, r5
+L106: .data 615
+jsr *r6
+bne *r5
+inc L269
+L107: inc *r6
+L108: cmp #-193, L238
+inc *r6
+add #151, *r0
+L109: cmp r4, r4
+stop
+inc *r0
+L110: .data 996, -896, -590, 418
+not *r7
+L111: stop
+bne L282
+cmp #238, r1
+L112: .string "tbldszlhczmiwnaufgaiypvt"
+dec r4
+prn L221
+; comment
+L113: bne *r7
+L114: .data 32, -472, 31, 874, 979, -893, 522, 800
+L115: jmp *r1
+jmp L120
+rts
+L116: .string "zfepavgblnndk"
+L117: jsr L166
+not r6
+inc L201
+jsr L164
+lea L233, L144
+rts
+L118: inc r2
+sub #190, r6
+L119: stop
+mov *r7, *r4
+; comment
+L120: cmp r5, r7
+rts
+L121: rts
+sub *r7, *r5
+bne *r5
+
+jsr L232
+dec L319
+clr r4
+add #56, *r4
+L122: mov L134, L190
+L123: jsr *r1
+L124: red *r7
+L125: inc r4
+add r3, *r1
+inc r0
+not *r6
+jmp *r7
+red r2
+cmp #-234, r7
+rts
+stop
+L126: red L272
+L127: mov L333, r0
+dec *r1
+jsr *r6
+cmp *r0, #-135
+L128: lea L294, L272
+sub *r4, L294
+dec *r0
+L129: red r1
+L130: inc *r7
+L131: inc r0
+mov r3, r0
+L132: rts
+sub *r4, L349
+jmp *r5
+L133: jmp L230
+
+lea L208, *r6
+red L344
+L134: .string "jxxxxjcpkrlhymuprzqccc"
+mov r6, L293
+stop
+L135: cmp L176, r5
+not r2
+rts
+
+not L164
+rts
+L136: .string "vb"
+jmp *r7
+L137: dec L268
+prn *r6
+add *r4, L171
+dec r2
+L138: stop
+L139: .string "icrpcdgbjbqtnem"
+stop
+prn r2
+L140: .string "njeges"
+add L216, *r2
+
+lea L333, *r0
+L141: rts
+L142: .string "ocfenibjqzcdlkiptlgge"
+L143: not *r0
+dec r7
+L144: .data -608, -68, -414, -912, -9, 314
+L145: .string "lcg"
+stop
+jsr L248
+cmp r1, r0
+bne *r7
+L146: lea L170, *r4
+L147: red r7
+prn r5
+not L176
+sub *r4, L199
+L148: sub #-189, L308
+stop
+L149: stop
+stop
+inc L251
+lea L252, r6
+lea L310, *r7
+jmp *r1
+L150: dec *r6
+rts
+jmp *r5
+bne *r6
+jmp L215
+prn L286
+dec L184
+L151: rts
+clr L182
+L152: add L209, L235
+L153: .string "dsgjlpz"
+mov *r6, L333
+L154: bne *r6
+sub #-163, L279
+not L321
+clr L234
+stop
+L155: jsr L245
+lea L315, L211
+L156: .data 786, 590, 992, -437, -279
+L157: .data -797, 462, -668, 916, 633, -613, -489, -114
+add *r4, r3
+bne L329
+red *r5
+bne L278
+mov L227, r5
+L158: clr r1
+red r7
+mov r7, L244
+cmp #-228, #199
+jmp L296
+clr L160
+L159: sub r6, r3
+clr *r2
+red *r3
+L160: .data -878, 366, -216, -809, -976, -861, -553, -159
+lea L234, *r7
+bne L338
+not *r4
+add L348, L249
+jmp L317
+L161: not L272
+sub #-48, L249
+L162: .data -19, -408, -468, 894, 189
+sub L285, L278
+jsr *r3
+clr L270
+prn #-253
+jmp L181
+jmp L170
+red r6
+L163: inc L287
+L164: jsr *r6
+not L322
+bne *r7
+L165: prn *r1
+L166: not r6
+sub *r5, *r2
+inc L259
+bne L338
+clr L296
+red L223
+stop
+add L174, *r3
+L167: clr *r1
+inc *r2
+L168: cmp *r6, L346
+prn L199
+red r7
+L169: .string "ffghbsws"
+rts
+red *r2
+L170: .data 495, -571, -447, 599
+L171: mov r4, r7
+prn #73
+L172: not L192
+
+not r5
+L173: clr r1
+L174: .string "ktiuufmpm"
+bne *r1
+not *r4
+L175: .string "dnlhfnnnxeiaov"
+jmp L248
+stop
+sub #-244, r0
+L176: stop
+jmp L178
+L177: add *r7, *r5
+prn #255
+bne *r6
+clr *r3
+dec L299
+mov L202, *r5
+clr *r1
+prn #-67
+L178: stop
+cmp L290, L281
+sub L315, r6
+add r4, *r7
+L179: lea L227, *r6
+; comment
+L180: bne L285
+L181: .data -534, 69, 82, -55, -532
+cmp r6, r1
+not *r1
+inc r7
+mov *r7, *r7
+jsr *r0
+L182: .string "lctxhvmjhqutnecuewcuz"
+stop
+prn L186
+L183: not r6
+jsr L261
+L184: clr *r6
+rts
+stop
+bne L333
+L185: prn r7
+L186: not r5
+L187: .string "rcvgpyqrcbigu"
+L188: stop
+L189: .string "yqbjtyx"
+jsr L330
+inc r2
+lea L299, *r5
+add #-181, *r3
+prn *r4
+L190: .data 702, 364
+rts
+cmp #99, r4
+bne L337
+dec L256
+jmp *r1
+L191: .data 292, -202, -522, 645, 835, -322, -117, 424
+bne L305
+mov r1, L228
+inc L193
+not r6
+L192: add L334, *r1
+L193: cmp #86, L321
+L194: .data -100, 923, -276, 205, -879, -944
+L195: .data 570, -459, -795, 625, 849, -641, -287, 162
+mov #30, *r6
+jsr L283
+red L225
+inc L338
+red *r3
+jsr *r2
+lea L280, r6
+red L276
+; comment
+L196: cmp L318, r4
+L197: inc L312
+red r1
+; comment
+rts
+lea L240, *r7
+L198: cmp *r4, L244
+clr r5
+mov r5, L208
+; comment
+add *r4, L233
+L199: .string "sb"
+L200: jmp L260
+L201: sub r2, L230
+L202: sub #179, r0
+L203: .data -903, 433, 472, 112, 317, 333
+
+inc L232
+jmp *r4
+L204: bne L342
+jsr *r7
+stop
+jsr L254
+rts
+sub *r5, *r5
+dec L295
+L205: .string "wcaumymnq"
+L206: add *r6, r0
+clr *r6
+inc L262
+add *r4, r0
+mov #-171, L320
+L207: prn r7
+L208: stop
+jsr *r6
+lea L285, L261
+red r7
+; comment
+dec L293
+mov #107, L270
+lea L248, r0
+red r4
+L209: dec r6
+dec L298
+L210: cmp L277, #-206
+L211: jsr *r6
+jsr *r7
+L212: not r3
+bne L289
+L213: .string "uniexsjarls"
+dec r6
+jsr L257
+
+jsr L328
+clr *r5
+clr r2
+L214: mov #-189, *r0
+red L253
+L215: sub r2, *r3
+L216: inc r0
+mov *r3, L346
+L217: lea L255, r7
+stop
+red r0
+L218: mov #-22, *r7
+red r3
+L219: not *r4
+L220: bne *r2
+L221: stop
+L222: bne L304
+prn r2
+bne L337
+L223: rts
+L224: lea L271, L348
+L225: lea L288, r2
+bne *r5
+rts
+clr *r6
+L226: mov #-38, L282
+jsr L328
+L227: not *r4
+not L295
+bne L331
+not L243
+; comment
+lea L288, *r7
+add #184, *r1
+rts
+lea L228, L241
+red r3
+L228: inc r4
+bne L324
+bne *r5
+jmp L345
+bne *r2
+L229: jsr *r3
+add L273, L327
+stop
+L230: bne *r0
+L231: stop
+jsr L240
+L232: red L272
+L233: clr *r4
+cmp *r5, #-254
+not L348
+add *r5, r7
+sub L261, L332
+L234: .data 502, -727, -128
+stop
+add #4, L290
+mov L286, *r4
+rts
+inc L293
+lea L289, *r4
+; comment
+lea L259, *r7
+not L309
+L235: jsr L274
+L236: prn #-59
+L237: sub *r6, *r6
+cmp L279, *r6
+L238: red L279
+L239: .data -267, -674, -214, -670, -26, 624, -405
+add #103, r1
+sub r6, r7
+L240: rts
+lea L241, *r3
+; comment
+prn L266
+L241: red r7
+dec r1
+L242: .string "ix"
+not *r6
+not *r4
+L243: prn #175
+L244: .data 954, 577, 499, -792, -960, 844, -3
+L245: .data 208, 105
+stop
+L246: mov #-50, *r2
+rts
+L247: .data 944, -870, -425, 389, 605, -259
+lea L289, *r4
+add L271, L278
+L248: .string "s"
+add #-60, r3
+not r2
+rts
+jmp *r2
+L249: jmp L255
+L250: rts
+; comment
+mov r2, L317
+L251: .string "u"
+L252: dec r6
+bne L331
+rts
+L253: .data -305, 981, -518, 140
+clr L346
+cmp r4, #-1
+lea L352, *r3
+L254: clr *r0
+L255: sub L267, L313
+L256: dec r7
+prn L271
+L257: .data 230, 433, -373, -449, -349
+jsr *r2
+not L329
+dec L344
+L258: sub *r1, *r6
+L259: rts
+add r7, r0
+L260: cmp *r2, *r3
+rts
+rts
+prn #-127
+L261: prn *r1
+lea L264, r4
+L262: .string "bhlcxselkshxlcqfftu"
+red *r5
+L263: cmp r3, L274
+L264: stop
+cmp r1, r4
+L265: .string "ktb"
+rts
+L266: jsr *r3
+clr L280
+rts
+L267: .data -204, -880, -690, 208, -550, 648, -685, -441
+stop
+lea L295, r1
+L268: inc r6
+jmp L344
+stop
+L269: not *r3
+lea L306, L316
+red r2
+lea L347, L288
+not *r7
+mov r3, L302
+L270: clr L335
+L271: cmp L306, r3
+inc L341
+dec L327
+L272: cmp L353, *r3
+mov #-142, *r4
+L273: clr *r4
+bne L350
+sub *r4, L308
+L274: prn r3
+L275: jmp L321
+add L350, *r3
+add #1, L284
+clr *r5
+lea L312, *r4
+L276: bne *r2
+inc *r5
+jmp *r4
+not r5
+jmp L340
+jsr L318
+jmp L329
+cmp r7, *r4
+L277: .string "ntcnjwxelrgrqwtcdtxl"
+; comment
+L278: bne *r3
+rts
+L279: .data -776, 686, 435, 568, -351, -235
+red r0
+L280: lea L300, *r3
+L281: cmp r6, #-95
+rts
+inc L353
+L282: clr L321
+L283: prn *r7
+L284: .data 233, -299, 75, -872
+sub r0, L295
+lea L350, *r2
+clr *r5
+jmp *r2
+
+; comment
+red r3
+dec L349
+inc r5
+lea L333, L308
+add *r4, r1
+
+add r0, *r7
+L285: .string "unbkntxez"
+cmp #-87, *r2
+L286: .data 630, 181, -668, 381, 907, 320, -297, 149
+inc L322
+L287: .string "uilvcsjaosfiwrp"
+not r3
+red r5
+red L343
+clr *r3
+cmp #-68, r4
+L288: .string "dptrew"
+inc *r3
+mov L343, L304
+rts
+not r6
+L289: clr *r2
+dec r7
+add *r1, L293
+L290: clr r7
+prn r7
+dec *r4
+red L295
+L291: cmp r5, *r1
+L292: .string "uxesegsh"
+red r5
+L293: .string "ljookrjsoibycbzyk"
+stop
+dec L324
+L294: .data -137, -921, 922, -727, 617, -484
+L295: lea L346, L328
+inc *r7
+mov *r4, r3
+L296: .data -651, -438, 479, -786, -143, 197, 314
+L297: .data 389, -369, 14, 829, 730, 769
+inc *r4
+jsr *r6
+inc L337
+bne L309
+L298: stop
+L299: prn L323
+mov r6, L317
+rts
+
+mov *r1, r0
+red r1
+sub L335, *r4
+L300: dec *r5
+L301: prn L344
+stop
+L302: .data -449, -722, -343, 973, -379, -688, -536
+mov L317, *r0
+L303: not L325
+L304: sub *r0, r4
+jsr *r3
+L305: .string "eukohmvotcgdsvojlcz"
+add L315, L333
+L306: add r7, r0
+L307: .data 987, 945, 677, -473, 906
+L308: cmp *r5, #-155
+red r7
+rts
+jmp L315
+sub L351, L334
+jsr L310
+sub *r1, r7
+
+clr *r0
+bne *r2
+L309: .string "svca"
+cmp L339, L321
+L310: rts
+inc L340
+lea L317, L344
+clr L350
+L311: red L331
+L312: lea L350, r6
+L313: rts
+L314: .data 923
+L315: mov L341, L327
+L316: prn #-228
+prn r1
+dec L334
+inc L329
+L317: cmp r4, #-144
+L318: .data 959, 854, 478
+L319: inc *r5
+rts
+add L325, *r7
+not L352
+bne L327
+bne *r0
+L320: prn #-193
+add L324, r6
+lea L336, *r4
+L321: cmp L345, #159
+jmp L339
+rts
+L322: .string "rvgkdnidarspjodjhptho"
+L323: not r3
+rts
+L324: red *r6
+L325: .string "oiprwcaj"
+dec r3
+L326: dec L350
+red r2
+red r7
+sub *r5, r1
+L327: .string "apr"
+add *r4, r1
+stop
+jmp *r6
+L328: cmp L335, #-85
+cmp *r3, #-177
+cmp *r3, r1
+red *r1
+L329: red r5
+bne *r2
+stop
+L330: .data -239, -457, 611, 909, 983, 908, 680, -834
+red *r6
+cmp L351, #-144
+L331: cmp L339, *r3
+add L350, r2
+inc L339
+mov #75, r2
+L332: .string "jvzvailazbrgckstqxqcfcz"
+L333: red L339
+stop
+cmp *r3, L335
+L334: rts
+dec *r5
+cmp r4, r6
+L335: .data 984, 89, 977, 102, 110, 127
+L336: not r7
+L337: sub #133, *r6
+
+L338: inc r5
+not L342
+L339: dec *r5
+jsr *r5
+L340: bne *r3
+dec r3
+; comment
+L341: prn L346
+L342: red L351
+rts
+L343: rts
+rts
+sub #26, *r6
+lea L353, r4
+sub r2, *r5
+mov r4, *r4
+L344: dec *r1
+L345: .string "fkzehkdeiqkfdvbaomenm"
+L346: .data -708, -141, -728, -43, 58, -703, -183, -21
+jmp L352
+sub L350, *r5
+jsr L353
+L347: lea L351, *r0
+L348: inc *r4
+jmp L351
+L349: clr L350
+L350: red L353
+L351: not *r7
+mov r2, L352
+add L352, *r4
+L352: clr *r0
+L353: cmp *r7, #-255
+stop
+add r6, r2
+dec *r4
+mov *r6, r2
+cmp #-41, *r3
+stop
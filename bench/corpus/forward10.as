@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 11
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+clr L80
+add L90, *r6
+not *r7
+clr r4
+L0: jmp L263
+mov *r1, L74
+not L18
+L1: clr L197
+sub #-173, L76
+stop
+prn r4
+; comment
+not *r7
+jsr *r4
+L2: jmp *r7
+prn #-221
+L3: not L134
+rts
+clr r4
+cmp r1, L233
+L4: .string "owxuxrmawixrideakq"
+lea L216, *r4
+L5: .string "rcgsjqhfcdljxvmwzys"
+mov L138, *r3
+bne *r0
+inc *r7
+L6: jmp *r7
+prn L89
+L7: .string "svwztmqj"
+L8: .data -666, 216
+cmp #-244, #151
+mov r5, L305
+L9: red L39
+; comment
+add *r6, *r4
+L10: .data 925, -80, -534
+L11: jsr *r2
+L12: .data 839, -172
+sub #-151, L302
+clr L21
+jmp *r2
+add *r4, r3
+rts
+L13: not *r2
+bne L109
+L14: stop
+prn r7
+prn L16
+lea L123, r2
+inc r3
+L15: lea L255, r4
+add L200, r0
+L16: rts
+prn *r4
+not *r3
+L17: dec *r3
+sub *r5, *r6
+jsr L208
+not *r5
+L18: bne *r0
+red *r7
+
+jmp *r2
+L19: .data -777, -868
+L20: bne *r7
+L21: prn *r7
+
+lea L83, L136
+not r1
+red L227
+L22: dec *r0
+lea L196, r5
+L23: mov *r1, *r2
+L24: .string "rqxgcuilebfccgnvyic"
+L25: red r5
+L26: .data -426, 948, 574
+jsr *r4
+jsr *r3
+jsr *r2
+add #212, *r2
+jmp L335
+; comment
+L27: .string "d"
+jmp L196
+L28: inc *r1
+
+L29: lea L61, L314
+lea L106, L231
+lea L283, r5
+L30: .data -539, 382, 664, 293
+L31: inc L88
+mov L172, L211
+stop
+red L226
+rts
+clr r5
+L32: inc L75
+jsr *r7
+L33: .data -470, 388, 526, -302, 91, -873, 699, -512
+
+stop
+jsr L346
+L34: bne *r3
+not L148
+sub r1, *r3
+rts
+inc *r3
+L35: red r2
+clr *r0
+clr L101
+not L285
+L36: jsr L305
+L37: .string "aobokejhudstpytlo"
+L38: inc r6
+bne L192
+prn #220
+L39: dec *r1
+bne L286
+bne L111
+rts
+cmp *r0, L127
+L40: .data -502, -174, -471, 44, -683, -971, 573
+L41: lea L116, r6
+bne *r4
+clr L162
+dec r2
+rts
+L42: .string "goyplvjvdpcwxtkzfbrnnd"
+jsr L113
+L43: .string "bzhpuwrwlxvwfjgdvypoqsba"
+L44: cmp r4, r5
+
+L45: clr *r3
+L46: .data 782
+dec *r0
+stop
+mov *r3, *r5
+sub #83, L350
+not r2
+; comment
+stop
+L47: dec L253
+mov *r6, *r2
+L48: rts
+jsr L298
+stop
+inc r5
+stop
+L49: jsr *r0
+lea L305, L331
+L50: cmp *r6, *r7
+sub #-170, r6
+not *r0
+L51: rts
+rts
+L52: jsr *r7
+rts
+lea L131, r7
+L53: .data -891, -156, -427, -646, -58, -363, -322
+L54: .string "rycvet"
+bne L167
+L55: rts
+not r7
+prn *r2
+L56: cmp r3, *r0
+L57: lea L219, r6
+L58: .data 77
+L59: .string "c"
+mov L281, L107
+prn #125
+sub *r1, *r4
+red L243
+L60: .string "hipbarvvh"
+add r4, *r3
+L61: jmp *r3
+mov L183, r0
+mov r5, L99
+L62: rts
+L63: bne L121
+jsr *r0
+bne *r5
+cmp r1, *r7
+L64: .data 798, 65, 576, 628
+mov r7, L253
+L65: bne *r6
+L66: prn r6
+stop
+rts
+jmp L127
+lea L132, *r2
+mov #152, L130
+stop
+rts
+sub *r2, L196
+; comment
+jmp L253
+L67: clr *r6
+sub r1, L193
+L68: not r3
+stop
+inc *r4
+inc r4
+L69: dec r7
+rts
+
+L70: not r4
+lea L116, *r2
+inc L141
+L71: rts
+L72: add L349, r2
+; comment
+rts
+stop
+L73: lea L93, *r2
+not *r5
+bne *r0
+L74: stop
+red *r0
+rts
+L75: .string "iiiqweyublekwv"
+bne L142
+prn #-45
+inc r5
+bne L99
+L76: .string "olnuydalon"
+L77: inc r4
+L78: not L272
+L79: .data -909, -161
+L80: sub *r7, r0
+L81: jsr *r5
+dec r0
+inc L208
+prn r5
+bne *r0
+L82: jsr L273
+mov r2, *r4
+
+prn L276
+inc r0
+jmp L97
+sub #117, L115
+L83: .data 921
+L84: cmp *r5, *r1
+cmp #-132, *r0
+L85: .data -631, 800, 564, -443, 527, 991, 987
+jmp L322
+L86: .data 458, 973, 24, -95, 577, -245, 316, 645
+not *r4
+lea L340, *r1
+L87: .string "cqxlq"
+jmp *r2
+L88: red *r4
+clr r7
+L89: .string "obqc"
+L90: stop
+cmp r0, #2
+red r3
+L91: lea L280, *r3
+mov r4, r5
+L92: not L338
+L93: .string "qqj"
+prn #-220
+L94: .string "zirzupdtcwtygewtycbx"
+L95: jsr L162
+mov *r2, r2
+rts
+L96: .string "alkikorkxhkjijdpwwvume"
+inc *r6
+clr L116
+L97: jmp L161
+prn r7
+rts
+rts
+mov *r2, *r4
+L98: jsr *r2
+prn r5
+L99: dec L140
+L100: cmp *r5, r5
+L101: lea L274, r4
+L102: mov r5, L114
+stop
+L103: clr L187
+stop
+L104: cmp *r3, #255
+stop
+clr r0
+jmp L193
+mov #-20, L199
+L105: red L302
+lea L215, L316
+dec r4
+not L141
+cmp L217, *r6
+mov L244, r7
+L106: bne L215
+sub L260, *r0
+jmp *r1
+stop
+clr L203
+prn *r4
+mov L338, *r3
+L107: not L212
+jmp *r5
+jmp *r3
+L108: not *r3
+stop
+L109: .data -467
+lea L219, r5
+jmp L320
+L110: .string "ukatvkxhbtrvzndcwcg"
+dec r0
+L111: .string "sk"
+add #-210, *r7
+inc L154
+cmp r0, L165
+not L120
+mov r4, r6
+rts
+inc L288
+L112: not r3
+red *r0
+sub *r5, L336
+L113: inc *r7
+not r6
+lea L243, L124
+L114: rts
+L115: .data -306, -792, -715, 790, 793, -832, 547
+inc *r1
+L116: jmp *r3
+stop
+L117: dec r5
+L118: stop
+cmp L325, L207
+jsr L270
+lea L238, r0
+L119: lea L346, *r0
+L120: inc L208
+inc *r0
+jmp L304
+; comment
+inc r0
+; comment
+bne L256
+bne L146
+clr L350
+rts
+
+L121: jmp *r5
+L122: .string "gywvz"
+bne L246
+cmp #-96, r7
+not *r1
+inc L134
+red L312
+L123: .data 744, -324, -363, -911, 982, 335, -852, -636
+dec L297
+not *r1
+rts
+L124: bne L132
+L125: .data -840, -197, 547
+add *r1, *r4
+L126: red *r2
+mov r6, *r1
+
+L127: lea L144, L269
+red *r3
+lea L161, L326
+L128: .string "klugcv"
+L129: .string "q"
+prn L331
+
+jsr L342
+dec L228
+L130: .string "iduvvmqm"
+L131: sub r7, r4
+add r3, L147
+dec *r0
+L132: add L217, L237
+L133: mov L237, r0
+mov L172, L298
+red *r7
+mov L234, *r7
+L134: .data 347, 834
+red r2
+red r3
+inc r5
+red L192
+L135: prn *r4
+rts
+clr L330
+L136: add r1, L296
+red L327
+L137: clr *r7
+L138: prn #-255
+L139: not L166
+L140: inc L154
+dec r4
+L141: lea L142, *r6
+cmp L301, L238
+; comment
+prn *r0
+L142: prn r2
+inc L248
+
+jmp *r1
+jmp *r0
+L143: inc *r4
+clr L203
+jsr L289
+L144: lea L159, r0
+L145: bne *r1
+L146: jsr *r7
+lea L268, L326
+L147: not r2
+lea L237, L280
+L148: sub r7, r6
+inc r1
+clr *r4
+L149: sub r0, L200
+dec *r1
+sub *r7, r4
+jmp *r0
+L150: .data -1000, -575, 504, 870
+lea L213, *r6
+L151: .string "yklleqfi"
+inc r7
+jmp *r3
+L152: stop
+red L230
+L153: clr *r7
+rts
+L154: jmp L217
+add *r5, r2
+L155: mov L175, r2
+stop
+rts
+add L328, r7
+clr r4
+L156: clr r3
+L157: cmp r0, *r2
+clr L167
+L158: dec L159
+L159: .data -548, -582, 517, 152, 416, 968, -52
+inc *r4
+prn *r1
+L160: prn r4
+cmp r2, r2
+L161: .string "yorackgcmqglf"
+L162: .data -467, -456, 79, -898, 459, -326
+L163: mov *r1, r2
+add #-99, L270
+bne L339
+jsr L320
+L164: .string "dmiugtnkdglpubixrczqm"
+lea L183, r2
+mov L323, r4
+cmp *r0, r4
+sub r7, r3
+L165: .data -64, 146, 263, -937, 149, 81
+L166: inc L222
+L167: lea L294, r3
+L168: jmp *r7
+L169: lea L195, r5
+clr r7
+L170: .string "iykwhkljsshxnxzfezqktron"
+cmp L218, #149
+dec L235
+clr L269
+L171: clr r4
+L172: jsr L186
+red *r1
+L173: inc r7
+L174: cmp L323, *r3
+red r0
+inc L210
+L175: mov #108, r6
+not L268
+L176: .data -328, 273, -743
+bne *r4
+jmp *r4
+jsr *r5
+not L285
+lea L304, *r2
+
+L177: bne L308
+; comment
+dec r0
+red *r2
+sub *r5, *r6
+prn *r6
+L178: inc r4
+clr r5
+prn *r0
+inc r2
+L179: dec L299
+L180: jsr *r6
+L181: sub #-63, r7
+inc r2
+L182: .string "emnalyluwp"
+jmp *r5
+dec L194
+L183: sub L253, L257
+prn *r5
+L184: prn #184
+cmp #-217, #85
+bne L300
+cmp *r6, *r2
+bne L336
+bne *r3
+L185: lea L197, L322
+L186: red r6
+add r5, *r0
+cmp #129, *r7
+L187: red *r4
+mov r2, r7
+add L211, *r2
+jmp *r7
+inc *r2
+L188: .string "omzqrtedcvzg"
+L189: bne *r5
+prn r2
+sub L296, L317
+stop
+L190: rts
+red r3
+L191: prn L238
+L192: .data -195, -159, -118, -382
+inc *r7
+
+prn r5
+cmp #-184, *r3
+prn #-56
+prn #137
+L193: mov r5, r0
+L194: lea L316, *r5
+rts
+L195: jmp L274
+L196: inc *r0
+; comment
+L197: dec *r0
+jmp L231
+sub *r7, r4
+; comment
+prn #214
+rts
+jsr L326
+L198: .data 322, -392, -679, 366, -483, -325, 792, 573
+clr *r4
+red *r4
+bne *r6
+; comment
+L199: .string "nverbpw"
+bne *r1
+stop
+L200: clr r2
+red *r1
+L201: add *r3, r2
+dec *r4
+L202: dec *r6
+prn *r4
+sub L256, r5
+L203: .string "onboqiseadzqnyfjsmqcyfm"
+mov #-197, r4
+L204: lea L215, *r0
+lea L264, r5
+L205: .string "icncbhqwtimxlqymc"
+L206: not *r2
+not *r5
+cmp L286, L214
+L207: prn r0
+L208: clr L221
+prn *r7
+inc *r2
+stop
+add *r3, L270
+mov r4, L238
+L209: not *r3
+cmp #-112, r2
+bne *r5
+
+not r4
+L210: inc *r2
+L211: .string "zbbncchtpbsnt"
+clr r4
+stop
+sub L266, L293
+inc r7
+lea L288, L340
+L212: bne *r5
+bne *r3
+L213: .data 72, 643, 12, 168
+L214: sub r6, *r6
+inc *r6
+red L302
+dec r5
+red L244
+L215: add r2, *r5
+red *r5
+red L260
+L216: cmp L345, L296
+L217: sub L240, r2
+jmp *r0
+dec L277
+sub *r4, *r0
+dec *r3
+L218: rts
+cmp L277, L278
+add r4, L221
+L219: dec L350
+add r6, L328
+jsr L345
+red r3
+L220: inc r1
+cmp #-77, r1
+L221: not r0
+L222: .string "t"
+L223: stop
+rts
+add L313, r0
+L224: not *r2
+L225: stop
+; comment
+clr r0
+L226: inc L317
+red r3
+stop
+L227: jmp L238
+L228: bne L347
+bne L271
+jmp *r0
+jsr L256
+not L340
+add #58, *r4
+
+mov #-210, r4
+L229: not r2
+mov L309, L277
+add *r5, L291
+red r4
+L230: mov r4, *r3
+mov #166, L254
+not L310
+red L270
+L231: bne *r7
+L232: .string "fulhdmmj"
+inc L315
+rts
+jmp L275
+prn r4
+inc L261
+dec r3
+dec L266
+L233: not *r6
+L234: .string "akmqenyabbjhphbnhugy"
+not r0
+L235: lea L274, *r0
+jmp *r4
+L236: inc *r1
+mov L309, L292
+L237: not *r4
+L238: dec *r3
+L239: add L305, r7
+prn r6
+jmp L289
+L240: jsr *r0
+L241: .data 963, 270, 873, -877, 48
+inc L249
+red *r7
+add L302, *r4
+L242: .data 913, 493, -581
+L243: inc r5
+lea L277, L253
+L244: lea L327, r0
+L245: stop
+L246: .data -80, -242, 755
+
+not L291
+; comment
+L247: .data 940
+jmp L263
+L248: not *r0
+L249: .string "btbtoixzfctiulj"
+red r7
+jmp L276
+L250: .string "wzxbvoovmxcoteei"
+bne L288
+L251: cmp L283, #249
+L252: lea L265, L321
+clr r4
+L253: sub L325, L289
+L254: bne *r6
+L255: not *r4
+L256: inc *r1
+L257: .string "tkkjds"
+L258: dec r5
+inc r3
+jmp *r1
+L259: jmp *r7
+L260: .string "wiawhjfijelotpwna"
+
+cmp L320, r5
+stop
+inc *r2
+not r5
+dec *r3
+
+L261: rts
+jsr *r7
+stop
+lea L265, L306
+L262: inc *r2
+; comment
+not *r3
+dec L318
+L263: cmp *r3, #138
+L264: mov r1, L315
+mov r6, *r1
+cmp L277, r3
+L265: sub *r1, *r7
+L266: prn *r3
+rts
+
+sub r0, r0
+clr L337
+add r2, L283
+L267: .string "anfqmdxksqwnejivudiintiz"
+lea L324, r5
+L268: .data -599, -508, -838, -184, -28, -586, 793, 753
+L269: not r7
+rts
+; comment
+L270: .string "lhktwnjqdfvgetzaxojkr"
+sub #201, *r6
+
+L271: inc r7
+; comment
+L272: stop
+inc *r3
+L273: inc *r7
+not L343
+L274: jmp *r2
+dec L278
+add *r7, L276
+L275: red *r5
+jsr *r3
+red L335
+not r4
+L276: inc *r5
+
+red r0
+L277: cmp #29, *r2
+red L311
+stop
+jmp L295
+clr *r2
+add #248, *r3
+L278: sub #-124, L335
+not *r0
+jmp *r2
+stop
+L279: stop
+; comment
+L280: rts
+mov L346, L326
+not r0
+
+dec *r7
+L281: prn r0
+inc *r1
+L282: .string "cfuoe"
+jsr *r2
+clr *r6
+L283: .string "ricdfrmjcmdhcc"
+lea L331, L320
+L284: jsr *r0
+dec L299
+add r4, r4
+jmp *r3
+sub r3, L338
+clr r7
+clr r1
+
+jsr L314
+prn r1
+L285: clr L334
+lea L290, r5
+L286: mov r5, L288
+jmp *r1
+sub r4, L288
+jsr L305
+
+prn #-74
+L287: .data -658, -462, -861, -970, 812, 752, -194, -418
+cmp r4, #-62
+L288: dec r2
+prn *r2
+; comment
+clr L308
+jsr *r3
+sub L316, L326
+stop
+inc L292
+L289: stop
+L290: .data 687, -221, 796, -31
+add *r7, *r4
+L291: red *r7
+jmp *r0
+
+L292: rts
+not *r1
+cmp #-237, r7
+lea L337, L330
+prn #-125
+add *r2, L348
+stop
+rts
+L293: add L337, *r1
+prn *r4
+prn #-106
+stop
+L294: stop
+rts
+L295: .string "e"
+add L303, *r2
+L296: .data -291, 64, -75, 943, 588
+L297: jsr L302
+cmp r3, r6
+
+; comment
+bne L339
+cmp L348, L339
+L298: add #21, *r0
+inc *r2
+cmp #171, r2
+inc L303
+mov *r6, r5
+L299: .data 942, -624, -452, -963, 269
+stop
+jsr L337
+bne *r2
+
+L300: clr r0
+cmp L351, r1
+stop
+L301: clr r1
+jmp *r0
+add *r3, r4
+prn L343
+L302: sub *r2, *r1
+cmp r6, r3
+L303: jmp L350
+dec *r3
+jsr *r4
+cmp #0, #23
+inc L323
+L304: dec *r3
+L305: .string "qz"
+
+dec r6
+L306: mov #-221, *r2
+L307: .string "jvl"
+not L310
+L308: .string "ehfy"
+stop
+stop
+mov *r5, r7
+mov #-63, *r4
+sub L328, *r0
+L309: .data -860, -242, 263, -810, 798, -141
+sub *r4, *r4
+L310: .string "e"
+add r1, r3
+L311: dec L349
+sub r5, r6
+not *r1
+L312: .data -683, -459, 134, 533
+L313: stop
+L314: red L333
+L315: sub *r0, L329
+stop
+dec r1
+jmp L332
+inc *r2
+L316: dec L335
+L317: clr r2
+stop
+rts
+rts
+rts
+jmp L343
+bne *r2
+L318: stop
+jsr L326
+L319: prn r5
+L320: lea L337, *r0
+mov L348, L323
+L321: clr L328
+L322: .data 954, -699, -105, -949, -579, -162
+lea L340, *r1
+dec *r1
+stop
+L323: .string "r"
+jmp *r3
+mov *r2, L324
+dec L342
+L324: .string "ffy"
+cmp *r1, L327
+not L351
+cmp L350, *r7
+add r2, r7
+clr r6
+; comment
+jmp L338
+stop
+not *r0
+
+L325: red L348
+add r6, *r0
+dec r4
+not *r3
+; comment
+prn #63
+L326: .string "ivsvlyvfgeiknnsoowqf"
+not *r7
+L327: clr r7
+jsr L330
+jsr *r7
+jmp L341
+L328: inc L343
+add L334, r4
+add *r3, L334
+clr r2
+
+not r2
+prn L335
+prn r2
+bne L339
+L329: .string "etszxyb"
+jmp L334
+not L334
+inc *r2
+prn #-178
+
+lea L331, L351
+rts
+inc r1
+L330: inc L351
+L331: add *r3, r7
+L332: .string "izbcsacjgvigfcuszgezxyof"
+prn #-184
+jmp L342
+prn r7
+inc L342
+
+L333: clr *r2
+bne *r5
+jmp L348
+L334: .string "aunm"
+L335: red *r0
+stop
+L336: not L349
+dec *r2
+stop
+L337: inc L343
+L338: cmp L348, L340
+L339: bne L344
+L340: prn *r5
+stop
+L341: .string "zfvixmugsilzier"
+L342: jsr L344
+stop
+stop
+stop
+L343: mov *r5, r0
+jmp *r7
+not *r7
+lea L345, L344
+cmp r0, *r4
+
+L344: jmp L349
+dec L349
+L345: stop
+L346: bne *r4
+bne L348
+L347: lea L349, r4
+L348: .string "iuccrwqqyjkamtx"
+mov L351, L350
+stop
+stop
+jsr L350
+lea L349, L350
+L349: cmp #-18, *r6
+bne L351
+L350: stop
+prn L351
+L351: rts
+jsr L234
+rts
+; comment
+red L4
+stop
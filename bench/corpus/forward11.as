@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 12
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+jmp *r6
+bne L39
+prn #132
+add *r0, L337
+clr *r7
+mov #117, *r1
+red L239
+clr *r3
+L0: .data -764, -500, 679, 918, -126, -367, 711, 704
+rts
+
+mov r4, L207
+prn #248
+mov #85, *r2
+L1: red *r0
+rts
+cmp *r1, *r4
+add #106, r5
+cmp L190, r5
+mov #-254, *r3
+L2: mov *r5, L14
+L3: .string "ehnycdsncueqerbhldcyv"
+lea L333, L290
+L4: jmp *r4
+add *r4, r6
+cmp r2, #161
+stop
+; comment
+dec *r2
+clr *r6
+prn L242
+L5: .string "flwohuwbx"
+; comment
+L6: sub L215, L235
+lea L129, r6
+prn r6
+stop
+prn #-16
+L7: jsr *r3
+L8: .string "agyifdkmfxcwbnzfn"
+L9: stop
+clr *r4
+L10: .data 250, -170, -454, 438, 910, 797
+cmp *r3, r2
+mov L130, r4
+mov r2, r5
+sub *r6, r1
+L11: bne L92
+not r6
+; comment
+bne L292
+
+jmp *r7
+jsr L12
+L12: jsr L290
+L13: add #-24, *r4
+add r2, *r5
+not r6
+L14: .string "yqnfkadgfkhfxswdbzsnu"
+not L325
+jsr L181
+sub L305, L101
+L15: mov #-242, r3
+L16: jmp L107
+stop
+stop
+jsr L195
+L17: prn r4
+red r2
+L18: cmp #249, r4
+add #38, L118
+L19: cmp L264, *r6
+; comment
+rts
+dec L305
+L20: cmp *r1, *r0
+L21: prn r0
+L22: lea L179, *r2
+L23: rts
+L24: stop
+not *r7
+red L71
+stop
+L25: prn *r4
+bne L317
+L26: lea L208, r0
+clr r1
+prn *r1
+jsr *r6
+prn L190
+rts
+not L73
+L27: .string "rylfgqacscekekqzps"
+L28: red L136
+L29: mov *r4, *r1
+stop
+L30: cmp *r6, r4
+L31: add r5, L196
+jsr *r3
+rts
+jmp *r4
+L32: mov #-117, r1
+clr r6
+clr r4
+add *r4, r2
+lea L329, r2
+mov *r5, *r4
+cmp #-156, L315
+rts
+L33: jsr *r4
+
+jsr *r7
+stop
+L34: .data -979, 509
+jmp L60
+; comment
+clr r1
+L35: .data -964, -850, 63, 215, 309, -664
+bne L247
+rts
+L36: sub #114, L60
+jsr *r6
+jmp *r6
+jmp *r4
+mov #-20, r2
+; comment
+L37: cmp #-228, r3
+sub #163, r6
+not r7
+not L259
+clr r6
+L38: .data -991, 344
+L39: .string "paedsjpjrnagxhngnwstjv"
+inc r1
+prn r2
+stop
+jmp L331
+L40: bne *r0
+bne L95
+L41: jmp L234
+sub #-11, *r5
+L42: cmp r1, #236
+L43: inc L316
+stop
+L44: red r1
+lea L283, *r5
+cmp #-88, L263
+L45: dec *r2
+L46: jsr *r7
+L47: sub #-13, L151
+inc L218
+L48: bne L80
+; comment
+; comment
+rts
+
+L49: .data 568
+bne L130
+L50: add *r3, L307
+bne *r3
+cmp *r1, L286
+jmp L220
+L51: add *r6, L53
+not *r3
+sub #232, *r0
+red L85
+cmp #-251, *r4
+cmp *r0, L340
+L52: .string "ocmndgnbdxtfmiwskqv"
+L53: add r4, *r3
+
+not L156
+L54: add *r1, *r1
+jsr *r4
+inc L103
+inc L146
+; comment
+L55: .data 392, 713, -187, -470, -687, -354, 519
+L56: .string "frlszyjfqwmldgaxolljtvsz"
+lea L272, *r5
+inc r4
+jsr *r6
+jmp L108
+prn #-85
+bne L201
+stop
+
+not r0
+
+L57: clr r2
+L58: .data 23, 808, 972
+mov L243, *r0
+L59: .string "xgxnqlorfae"
+prn *r1
+lea L190, r1
+bne *r6
+L60: .data 979, 833
+L61: .string "ynlwjujcskwpkxsktlxplq"
+L62: stop
+L63: jsr L167
+jmp L296
+L64: .string "ucdusrvzbjnebz"
+L65: .data -319, -790, 110, -733, -534, 69, 435, 327
+sub r7, *r1
+L66: .data 759, 208, 239, -901
+L67: prn *r2
+sub *r6, *r5
+red L98
+L68: mov L337, L164
+jsr *r2
+L69: .data -478, -975, -97, -575, -909, 482, 332
+rts
+bne L188
+prn #134
+L70: .data -575
+L71: stop
+jmp *r0
+L72: add L154, *r1
+L73: cmp *r0, #-149
+L74: bne *r6
+L75: sub #191, r6
+inc L168
+L76: sub L90, *r7
+L77: jmp L203
+L78: bne *r5
+not L255
+L79: add *r1, *r7
+inc L190
+bne *r6
+rts
+lea L308, L203
+not L243
+jmp L323
+stop
+
+dec *r2
+L80: cmp #-165, L139
+inc L136
+jmp *r1
+L81: rts
+
+bne L190
+add *r3, *r7
+
+L82: prn #101
+cmp *r5, #-214
+not r1
+L83: jsr L194
+stop
+lea L275, *r3
+stop
+L84: jmp *r5
+cmp #21, r7
+inc *r3
+red L238
+
+cmp *r3, *r0
+jmp L137
+L85: dec r3
+stop
+mov #189, *r3
+L86: bne L268
+rts
+jsr L96
+bne L228
+prn r7
+L87: .data -45, -881
+L88: .string "iz"
+inc L162
+
+L89: add L213, r3
+L90: inc r4
+not L94
+L91: .string "ddbwpunjkpiko"
+rts
+jmp L168
+L92: sub L318, r7
+L93: lea L269, *r1
+L94: stop
+L95: clr L220
+jsr *r7
+sub *r2, *r2
+L96: lea L210, r1
+L97: add *r1, L160
+L98: sub r7, *r3
+L99: lea L161, *r7
+not *r3
+red *r4
+L100: clr *r7
+; comment
+add #-67, *r7
+lea L206, *r4
+L101: inc *r0
+clr *r7
+not L334
+L102: .string "xnsfcg"
+dec r6
+jmp *r0
+lea L229, L300
+cmp r5, *r7
+bne *r0
+clr r7
+sub #58, r3
+stop
+dec *r3
+L103: .string "nraiikcuwvjr"
+L104: sub *r3, r1
+sub #160, *r0
+L105: .data -843
+L106: rts
+L107: .data 342, 610, 944, 504, -708, 122, 568
+red *r0
+lea L224, r4
+; comment
+; comment
+bne *r4
+sub *r3, *r7
+cmp L214, L162
+L108: .string "vjllmp"
+L109: clr *r4
+inc *r3
+stop
+not r6
+add #-213, L174
+
+inc L132
+sub r2, *r3
+bne *r7
+L110: inc *r3
+L111: cmp r7, L336
+L112: .data -583, -402
+clr L194
+lea L315, r6
+jsr L321
+L113: .string "p"
+L114: dec r6
+stop
+dec *r1
+add #-214, *r5
+L115: .data 544, 693, -321
+jmp L117
+L116: cmp *r0, L164
+jsr L245
+L117: cmp L222, #-76
+clr L124
+jsr *r0
+jsr L150
+sub #-114, r4
+L118: .string "am"
+mov *r6, L178
+L119: clr *r6
+inc *r4
+L120: .string "mzcqjnzmxfxfsi"
+L121: .data 145, -49, -610, 319, 422, 16, -658
+L122: .data 854, -433, 394
+inc L223
+L123: not *r0
+sub #57, r7
+L124: cmp #-14, #197
+L125: .data 83, -971, -64, -866
+add #-144, *r1
+clr *r6
+
+L126: clr r4
+bne *r5
+inc r6
+rts
+L127: red L225
+L128: cmp *r7, *r4
+cmp L287, *r4
+add #-243, r7
+L129: jsr *r7
+not r7
+clr *r5
+red r2
+L130: not L230
+rts
+add #6, r0
+mov #180, r1
+L131: jsr L263
+mov r0, r5
+
+inc *r4
+L132: mov L162, *r1
+clr r2
+L133: sub r2, L191
+lea L302, r6
+dec r3
+clr *r3
+sub r6, *r7
+sub r4, *r7
+jmp L320
+L134: clr *r1
+prn r6
+rts
+inc *r2
+dec L273
+mov #-242, *r7
+L135: .data 291, 585
+rts
+dec L252
+clr *r1
+lea L243, L155
+jmp L184
+jsr *r3
+rts
+L136: .string "lysnneejhwkpse"
+L137: .data -311, -665, -993, -81, -682
+jmp *r5
+not *r0
+L138: .data -996, -669, -875, 188, 20, -874, -476, 353
+not r4
+L139: stop
+rts
+L140: dec r2
+sub *r7, r5
+L141: sub *r0, L161
+clr L330
+rts
+dec L255
+L142: .string "yxahciypgcgsoqgm"
+L143: .string "joannufq"
+
+bne *r3
+add *r1, L257
+L144: .string "lnvzsffpbk"
+L145: clr r0
+cmp L148, #-61
+L146: .string "bbfiu"
+L147: dec r6
+L148: jmp *r5
+L149: rts
+dec *r7
+bne *r0
+L150: inc L344
+add r3, L320
+clr r0
+jmp *r3
+
+prn r3
+inc L257
+L151: jsr L267
+L152: prn *r4
+L153: jsr L202
+prn *r4
+prn #-166
+add L230, r4
+sub *r6, r2
+dec r1
+
+sub *r0, L312
+rts
+lea L247, *r0
+L154: .string "lsbojzlogo"
+L155: .string "lfhtvlsyecyu"
+L156: rts
+L157: sub *r3, *r7
+clr L206
+lea L164, *r5
+lea L221, r4
+red L344
+clr r6
+bne *r0
+inc *r1
+not L295
+L158: mov #-231, L307
+inc L215
+L159: .data -281, 298
+jmp L179
+red L212
+prn L327
+cmp r5, L270
+stop
+rts
+stop
+jmp L325
+L160: .data 107, 297, -723, 38, -657, -289, -383, 233
+bne L244
+L161: inc L322
+mov L163, L172
+; comment
+L162: clr L321
+dec *r1
+mov #214, *r4
+not r5
+not r6
+red r0
+jsr *r1
+; comment
+add r6, L253
+add #120, r7
+lea L238, r6
+not L293
+L163: prn L266
+
+jsr L250
+L164: rts
+add L339, *r2
+rts
+
+red *r5
+jmp *r3
+clr *r2
+lea L284, *r4
+mov r1, L302
+jmp L216
+L165: .string "lvjnetskdcinwtrgsrisuyed"
+L166: lea L324, L278
+L167: rts
+L168: sub L188, r0
+rts
+cmp r4, L207
+L169: jsr L322
+clr r7
+add r1, r5
+L170: .data 118, 156, 442, -337, 802
+; comment
+L171: jmp *r0
+not L227
+L172: not *r4
+; comment
+L173: add r6, *r4
+L174: prn *r4
+L175: .data 777, 911, 846, -950, -750, -321, -920, 818
+dec *r1
+; comment
+clr *r2
+cmp *r7, r5
+dec *r1
+clr r4
+dec L335
+L176: prn #147
+clr *r3
+jmp *r4
+L177: .string "rtaynvhxmrfncwuzggcmorp"
+sub #39, *r2
+clr r6
+jmp *r6
+L178: bne L223
+not *r4
+not L218
+
+L179: jsr L320
+L180: .string "oufolstqj"
+L181: dec L248
+
+L182: .string "azblozzlhxq"
+L183: not r1
+L184: prn r0
+clr r1
+jsr L260
+L185: mov r3, *r4
+not r7
+sub #-164, L313
+L186: mov r0, L249
+mov L321, L287
+L187: .data 362
+sub #132, r5
+mov r1, *r6
+L188: .data 402
+red *r2
+L189: lea L280, *r2
+clr *r1
+inc L192
+L190: sub r4, *r0
+clr L307
+jmp L242
+mov *r7, *r7
+prn r3
+L191: .data 27
+L192: dec r5
+sub #-102, L229
+jmp *r7
+L193: .string "azgr"
+L194: bne *r7
+
+jmp L298
+not r5
+mov L334, *r6
+L195: stop
+rts
+L196: rts
+jsr *r2
+sub L292, L279
+rts
+L197: sub #-26, L307
+L198: .data -459, 572, 116, 207, 832
+L199: .data 595, -140
+L200: inc *r3
+
+jmp *r4
+sub *r6, L297
+clr *r2
+red L255
+L201: mov *r4, L306
+sub r3, *r2
+sub r1, *r7
+L202: inc L312
+not *r5
+red L325
+red *r0
+L203: clr *r0
+bne L204
+inc r5
+mov #117, r2
+lea L297, r3
+jsr *r3
+bne *r3
+L204: sub L275, L333
+L205: .string "jrmsgo"
+L206: jmp L254
+
+bne L256
+lea L215, r7
+L207: bne *r1
+bne *r7
+sub *r7, r2
+L208: lea L230, *r2
+L209: bne *r5
+dec L245
+bne *r1
+dec *r6
+L210: inc L338
+
+L211: lea L224, *r2
+dec r0
+L212: .string "cxkdyzsljzyzld"
+L213: .string "eicqzbdzc"
+cmp r5, L344
+mov *r5, r5
+clr r3
+L214: bne L314
+cmp r1, #126
+clr r7
+stop
+red L279
+red *r2
+L215: add #59, *r2
+L216: stop
+clr *r2
+not L268
+; comment
+clr r3
+L217: stop
+stop
+lea L228, r0
+L218: not r4
+lea L337, r4
+sub *r1, *r2
+mov #216, *r3
+clr *r5
+not *r4
+L219: sub r3, *r0
+dec *r4
+jmp *r4
+clr L340
+rts
+L220: .data 917, -573, 674, -894, 20, -16, 770, 553
+jmp L247
+prn L317
+lea L334, L317
+L221: .data -955, 925, 677, -511, -326, 303, -622, 347
+sub #207, r5
+cmp #241, L331
+L222: dec r7
+bne *r6
+clr L239
+; comment
+lea L276, *r6
+inc r3
+L223: not L343
+; comment
+L224: red *r7
+jmp *r1
+clr *r2
+L225: rts
+jmp L318
+jsr L309
+jmp *r4
+rts
+L226: inc r5
+L227: sub *r5, *r2
+lea L304, L254
+L228: lea L280, *r5
+jsr *r1
+L229: rts
+dec r5
+bne L237
+rts
+stop
+L230: stop
+; comment
+
+; comment
+prn r4
+lea L273, *r3
+L231: jmp *r1
+bne *r4
+jsr *r3
+L232: .string "ffzkmyrhknviwygdhctiqa"
+not *r7
+L233: .data 492, -639, -99, -998, -43, -571
+not L335
+L234: red r0
+L235: .string "pezrzpnqqwakttkikzfbkf"
+jsr L315
+bne L294
+bne L276
+jsr *r0
+inc r6
+
+not *r6
+not L242
+L236: cmp L302, #-41
+jmp *r6
+cmp *r4, *r3
+not L274
+prn *r2
+jmp *r3
+L237: prn *r0
+bne *r5
+add #34, *r3
+mov #-229, r1
+sub L257, *r7
+inc r0
+add r4, r4
+inc L324
+jsr L319
+L238: inc L316
+L239: .string "thjsjtkgetnmxu"
+not *r3
+mov r1, r4
+add #96, *r4
+jsr L326
+L240: lea L279, L294
+cmp #-69, L247
+prn r0
+cmp #225, L294
+
+cmp r3, *r7
+L241: mov *r4, r0
+L242: .string "ldnokmpghud"
+dec *r6
+L243: dec r5
+L244: stop
+red r0
+stop
+L245: clr *r2
+lea L249, r2
+prn #41
+jmp L320
+dec r2
+cmp #170, L259
+jsr *r6
+stop
+L246: sub r5, L258
+mov *r4, L279
+L247: .data -747, -235, -210, -734, 21, 746, -311
+inc r5
+cmp L266, L268
+L248: inc L327
+lea L283, L266
+L249: mov #-93, L322
+dec L272
+add #4, r3
+mov L308, r6
+L250: sub L265, *r7
+prn L295
+mov *r3, *r1
+jmp *r3
+mov r3, r6
+
+L251: sub *r1, *r5
+L252: .data 281
+L253: jsr *r6
+mov #99, L257
+L254: .data 416, -610, -395, -439, 491, 720
+L255: inc r1
+cmp *r7, #252
+not *r4
+L256: clr L279
+jmp *r2
+inc L270
+jmp *r2
+sub #85, L274
+rts
+L257: dec r2
+cmp L297, r0
+cmp r6, #58
+stop
+rts
+L258: .string "tj"
+L259: .data -399, -330, 599, -784
+L260: jsr L324
+L261: cmp L307, #156
+inc r5
+prn L302
+L262: add #-64, L279
+L263: not r7
+L264: not *r2
+jmp L288
+red L316
+L265: sub *r2, r6
+L266: lea L281, r7
+L267: red L324
+
+L268: cmp r3, L337
+bne L296
+rts
+L269: inc r4
+L270: .string "cjbtxk"
+jmp L301
+L271: not L288
+L272: stop
+dec r2
+add r7, L327
+not L281
+not *r4
+lea L336, L341
+dec L322
+jsr *r5
+L273: mov L322, r0
+L274: lea L326, r7
+L275: add *r1, *r4
+dec L285
+L276: prn r1
+inc r1
+rts
+L277: .data 338, 514, 350
+clr L309
+lea L290, r3
+not *r5
+L278: inc r3
+
+L279: jsr *r5
+clr r2
+L280: .data 371, 261, 892, 812
+mov #82, *r7
+add r3, *r3
+lea L287, L325
+L281: stop
+
+L282: prn r2
+L283: prn *r0
+not r4
+L284: rts
+red L331
+jsr *r5
+clr *r2
+
+L285: .string "ukoji"
+red r4
+prn *r1
+mov #-201, *r1
+L286: stop
+stop
+add *r6, *r4
+sub *r1, r6
+L287: dec r4
+L288: prn *r4
+L289: not *r7
+inc L297
+bne *r2
+red r7
+clr r3
+sub L341, r6
+prn *r5
+L290: lea L336, r0
+mov r5, L335
+L291: .string "oxctiglsvwqcbfr"
+mov #-232, *r5
+L292: bne *r6
+stop
+L293: clr r4
+L294: prn r7
+jmp *r3
+not *r4
+L295: sub L309, *r6
+jsr L310
+L296: .string "npqkrhe"
+rts
+L297: red L322
+L298: clr r2
+red L335
+L299: stop
+
+L300: bne *r4
+L301: clr r4
+jsr L334
+cmp *r7, r4
+L302: .string "zpnaqj"
+mov L323, L337
+sub r1, *r7
+inc L333
+not r1
+L303: lea L324, L335
+add L311, L342
+mov #-70, *r3
+not r4
+L304: stop
+L305: mov L319, *r0
+L306: .string "bpoyvrha"
+jmp *r1
+L307: .data 468
+L308: sub L322, L330
+L309: mov *r6, *r2
+cmp *r4, *r6
+L310: clr L312
+L311: lea L322, L324
+L312: add *r2, r4
+L313: .data -211, -248, -831, 713, -77, 903
+add #219, L341
+red r1
+add L344, *r6
+
+stop
+L314: lea L322, *r4
+L315: not r4
+jsr *r2
+L316: sub *r6, r1
+inc r5
+rts
+L317: .data 838, 530, 564, 693
+jmp *r2
+L318: inc *r4
+L319: cmp r7, L341
+rts
+L320: .string "lbmkthzmhovvdcogregj"
+L321: cmp r5, #-3
+mov r2, *r2
+L322: .data -721
+red r3
+mov r4, L337
+prn #-128
+jmp L326
+jsr *r7
+inc L341
+L323: bne L342
+jmp *r7
+; comment
+jmp L340
+L324: inc L337
+L325: red *r2
+bne *r0
+mov r7, *r4
+rts
+L326: mov *r6, r4
+bne *r6
+L327: bne *r0
+sub r6, r5
+lea L331, L340
+sub L338, L333
+jsr *r2
+L328: .string "ewbqtdpmztpp"
+cmp r5, r7
+prn r4
+add #91, r4
+L329: sub L335, *r7
+clr L332
+red *r5
+red r7
+L330: red L338
+L331: .string "tzehommuu"
+dec r7
+L332: cmp *r7, r5
+inc r6
+L333: dec L338
+L334: .string "hyolxkwpxfge"
+L335: dec *r6
+lea L341, *r7
+not r6
+L336: lea L342, L337
+mov #-130, r1
+bne *r5
+inc *r6
+L337: inc *r6
+not L340
+L338: .string "vjqvfgsbp"
+add *r7, *r3
+L339: rts
+not r0
+L340: .string "bpiuuh"
+rts
+prn #-229
+rts
+sub L342, r4
+L341: rts
+dec L342
+bne L344
+rts
+L342: clr r0
+cmp *r1, r6
+cmp L344, *r7
+lea L344, *r1
+; comment
+dec L343
+jsr *r1
+L343: clr L344
+L344: dec L110
+bne *r4
+stop
@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 13
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+clr *r4
+add #135, L297
+L0: bne *r1
+mov r1, *r3
+prn L156
+inc *r2
+cmp r1, #205
+dec r0
+add #-173, r5
+L1: prn r5
+L2: .string "twsdeujunpvgeoyte"
+L3: rts
+L4: inc r5
+jmp L167
+dec *r3
+L5: sub L208, r4
+rts
+jsr L178
+clr L96
+L6: bne *r4
+rts
+red r4
+clr L20
+cmp #233, *r2
+prn *r4
+inc L78
+lea L163, r2
+sub r5, *r5
+jmp L50
+dec L339
+
+L7: .data -337, -808, -618, -863, -985, -824
+mov r0, *r0
+L8: mov *r0, L261
+rts
+stop
+jsr L102
+inc r3
+jsr *r1
+lea L232, r2
+inc L290
+inc *r7
+dec r6
+not r1
+inc *r4
+L9: dec r6
+mov L152, r4
+L10: clr r0
+
+L11: .data 271, 315, 469, 408, 82
+; comment
+L12: bne L313
+rts
+add *r4, *r6
+rts
+rts
+add r3, L42
+jmp *r6
+lea L216, r4
+L13: bne L48
+jsr L237
+add r4, r3
+not r5
+; comment
+rts
+clr *r2
+L14: clr L61
+jmp L156
+L15: .data -832, -239, 820, 3, 720, 743, -954, -227
+L16: inc *r6
+add r5, L192
+stop
+stop
+L17: bne *r5
+L18: .data 613, 138
+bne *r5
+add #-135, *r0
+red L237
+L19: inc L330
+L20: clr r0
+L21: .data -841, 116, -548, -599, 182, 897, -86, -527
+jsr L222
+rts
+cmp r5, *r1
+L22: sub *r3, r3
+dec *r6
+L23: .string "ygqkcanuzuuh"
+inc L208
+L24: prn #159
+
+jmp *r1
+L25: not *r7
+; comment
+cmp *r6, r5
+L26: lea L248, *r7
+L27: .string "fkwxdywugfg"
+not L132
+L28: .string "oi"
+; comment
+add L181, L247
+rts
+L29: red *r3
+stop
+dec L65
+not L133
+L30: lea L277, L282
+red r4
+bne L52
+sub *r0, r6
+L31: jmp L66
+lea L158, *r7
+stop
+L32: lea L299, r0
+L33: lea L220, *r5
+dec r6
+add *r3, L90
+prn *r0
+add r5, L313
+mov r3, L310
+jsr L119
+L34: .string "ckri"
+red L36
+stop
+red *r2
+stop
+add L93, L147
+add r4, r4
+L35: mov #-87, *r3
+bne L307
+clr r4
+L36: bne L44
+inc r2
+stop
+bne L262
+L37: add r4, L101
+L38: jsr L55
+bne L98
+L39: .string "jxqvcnjhxewc"
+L40: .string "etr"
+add *r5, *r4
+L41: add L144, r1
+L42: rts
+L43: stop
+L44: lea L120, *r1
+L45: add r4, *r7
+L46: clr *r1
+L47: prn #-55
+red L89
+L48: lea L330, *r6
+sub *r6, *r5
+prn #-135
+L49: .string "koqtgpfqptwea"
+inc *r1
+L50: clr r5
+inc *r1
+L51: add L161, r5
+L52: clr *r4
+L53: jmp *r3
+L54: inc *r5
+red *r2
+L55: stop
+L56: rts
+dec *r2
+mov r2, r6
+red *r6
+L57: stop
+mov *r6, L77
+L58: .data 842
+clr r5
+add r7, L99
+bne L245
+L59: .data 13, -75, 707, -674, 864, 560
+red r2
+add #-141, L257
+stop
+L60: add #215, *r4
+dec L138
+L61: not *r7
+dec *r2
+L62: jmp *r4
+dec r4
+dec r2
+red r1
+L63: rts
+add #-46, *r3
+red r2
+L64: bne *r5
+; comment
+L65: .string "ydtteoryyotlko"
+dec L91
+prn *r2
+add r7, L259
+sub L67, L158
+L66: sub *r1, r3
+L67: inc *r7
+red r6
+L68: not *r1
+; comment
+rts
+L69: bne *r2
+inc r3
+red L314
+red r7
+jmp L276
+prn L237
+L70: lea L174, L265
+L71: mov L153, *r3
+L72: bne L289
+; comment
+L73: red r7
+sub L340, r5
+L74: cmp #-29, r0
+L75: .data 890, -747, 635, 543
+lea L285, L147
+cmp L319, #-75
+cmp L134, *r4
+sub L303, r0
+add L143, *r1
+mov r2, *r0
+sub #-131, *r3
+inc *r5
+L76: prn L132
+dec L305
+; comment
+L77: prn L330
+L78: jmp *r6
+L79: sub r3, *r3
+inc L82
+red L164
+lea L324, r0
+L80: .string "egqziqpp"
+not *r0
+jmp *r6
+L81: bne L174
+add #-146, L299
+clr *r7
+lea L107, *r7
+
+L82: inc L208
+L83: .data 336, 785, 482, 116, 507, -524, -682, -818
+L84: jmp *r1
+L85: prn L235
+L86: not *r4
+cmp #-193, *r1
+L87: rts
+rts
+sub r5, *r2
+L88: .string "gffjrjlrzxjhecfy"
+lea L116, *r4
+dec r4
+add #44, *r5
+prn r0
+cmp #144, L115
+L89: .string "bbkjkavmmpcbynosii"
+L90: .data -350, 460, -75, 782, 882
+L91: .string "wbhpqjuqdv"
+not *r5
+L92: red *r0
+inc *r3
+L93: add L297, *r0
+jmp *r3
+prn *r7
+lea L272, r2
+L94: prn r5
+
+L95: lea L293, *r2
+L96: red *r6
+L97: .data -81, 914, -703, -775, -231, 279, -14
+not *r2
+lea L205, L115
+L98: .string "lmyalecuggcj"
+inc *r0
+rts
+L99: inc *r1
+rts
+red r1
+; comment
+clr L300
+L100: inc L190
+rts
+lea L272, r1
+L101: inc r4
+rts
+lea L340, L166
+L102: rts
+L103: jsr L170
+sub #23, *r3
+L104: .string "fmuvutpqwpgxcj"
+mov r5, *r7
+bne *r4
+rts
+stop
+jsr L204
+L105: .string "hqqmgyqzebqpcvemgaho"
+red L129
+sub r7, L209
+prn #-107
+inc L237
+L106: add r5, *r3
+clr *r0
+add #-17, L281
+; comment
+prn r4
+; comment
+L107: lea L174, *r1
+lea L307, L119
+add *r7, r3
+jsr *r5
+
+L108: mov r6, r0
+cmp #-242, r7
+lea L239, r0
+red *r7
+jsr *r0
+mov L135, r4
+jmp *r7
+add L294, r3
+jsr L274
+rts
+L109: sub L134, r1
+L110: jsr *r6
+L111: .data -835, 308, 792, -671, 417
+rts
+L112: add #-233, r1
+L113: red L226
+L114: .data -849, -770, 174, -270, 172, -389
+L115: bne *r3
+lea L239, *r5
+rts
+red r5
+L116: mov L158, L288
+jmp *r6
+L117: .string "byz"
+sub *r2, r4
+L118: .data 856
+L119: mov r6, r4
+L120: bne *r1
+dec r3
+L121: lea L312, r2
+jmp *r6
+
+L122: jsr L127
+L123: cmp L186, L247
+L124: add r3, L302
+L125: jmp L331
+jsr L322
+dec L231
+L126: bne L241
+inc *r3
+L127: jmp *r1
+inc L298
+cmp #-190, *r7
+sub r0, *r6
+rts
+inc *r1
+inc r5
+L128: sub #-235, r0
+dec r6
+rts
+L129: .data 753, 770, 407
+L130: .data 431
+prn *r4
+L131: .string "byfajthdydcss"
+red r6
+add r7, r6
+L132: jmp L223
+L133: not *r2
+L134: jsr L299
+mov *r7, r4
+cmp *r1, r7
+mov r5, *r3
+stop
+red *r0
+L135: not L278
+mov *r4, L199
+bne L244
+
+L136: add L159, r3
+rts
+L137: mov #255, r1
+inc *r3
+inc L208
+not *r7
+stop
+red L214
+jsr *r3
+lea L298, L247
+jmp *r2
+L138: .data -711, 215
+mov L168, L196
+red *r3
+bne L248
+mov r2, r2
+L139: .string "ppubvjminupmoboksixjh"
+L140: .data 534, 559, -729, 897, -744, 194
+rts
+cmp #155, r3
+L141: dec *r1
+stop
+dec L145
+L142: sub #83, r1
+cmp *r7, r1
+cmp r7, L152
+lea L274, L322
+bne L228
+lea L211, r4
+; comment
+L143: jsr L189
+; comment
+clr r6
+dec L315
+cmp L195, *r6
+dec r3
+L144: jsr *r5
+stop
+lea L150, *r0
+bne *r2
+add L194, r4
+inc r6
+L145: mov L301, L221
+inc r1
+mov #137, *r0
+rts
+cmp #67, #99
+jsr L316
+L146: sub *r7, *r6
+bne *r2
+bne *r5
+L147: sub L296, L308
+L148: rts
+L149: stop
+L150: jmp *r4
+clr r5
+L151: prn r4
+stop
+inc *r7
+sub L261, L332
+not r3
+not *r4
+L152: stop
+; comment
+prn *r2
+L153: .string "j"
+L154: dec *r7
+jmp *r6
+; comment
+cmp r6, L297
+jmp L307
+L155: .data -421, 952
+add *r0, L338
+jmp *r7
+not *r2
+L156: bne *r5
+dec *r5
+stop
+lea L336, r1
+lea L162, *r1
+add #-254, r7
+prn L182
+inc L191
+jmp *r1
+mov *r4, *r3
+L157: .string "byfewtjga"
+L158: prn L243
+sub r3, L316
+L159: add #6, r6
+L160: bne L230
+dec r0
+clr L247
+jmp *r2
+clr r4
+red *r6
+add *r6, L290
+
+stop
+L161: .string "ctzgfnnmlsmdbqf"
+mov r7, *r6
+jsr L180
+mov L267, *r2
+
+L162: .data -417, 783, 637, -828, -214, 890
+L163: not r3
+clr r6
+cmp *r1, #-225
+rts
+add #220, *r3
+jmp *r7
+sub #1, r3
+prn *r4
+L164: dec r1
+not *r7
+red L319
+rts
+jsr *r2
+L165: sub L290, L293
+jmp *r0
+add L213, r2
+inc L332
+jsr *r6
+inc r0
+L166: .data -667, -672, 815, 972, -884, 496
+dec L205
+L167: .string "fwgroyapmonfzbbdirhprcmw"
+jmp *r1
+L168: .data 157, -181, -545, 215
+lea L253, L207
+bne *r6
+lea L323, L170
+L169: rts
+not *r2
+rts
+L170: sub *r3, L261
+L171: .string "cfyzjuvlvnvmrmzryyagsbg"
+cmp L173, #244
+stop
+L172: rts
+L173: .data 385, -589, -804, 948
+L174: sub #209, L189
+L175: .string "l"
+lea L297, r1
+stop
+dec r2
+L176: rts
+L177: .string "fdugyoiejzrpiti"
+stop
+L178: sub *r6, *r7
+inc *r2
+L179: .string "koflcpsifiynecfohqjuhy"
+L180: dec L209
+L181: cmp L308, *r5
+L182: stop
+red *r3
+jsr *r7
+L183: not *r0
+inc r1
+add *r6, L241
+L184: add #25, L186
+red L263
+sub r1, r2
+lea L269, L273
+bne *r4
+sub r7, r2
+bne *r1
+rts
+bne *r3
+lea L228, L246
+L185: sub L224, *r3
+bne *r5
+L186: mov r3, L298
+rts
+lea L194, *r2
+clr r7
+L187: stop
+stop
+red r6
+L188: rts
+prn L207
+stop
+jmp *r4
+dec *r7
+not r3
+stop
+mov r6, *r3
+bne L261
+mov #-120, r1
+stop
+cmp L259, r5
+L189: mov L255, r1
+L190: .data 427, 911, 729, 933, 876, -975
+add *r7, r4
+L191: .data -143, -845
+rts
+L192: jsr *r4
+red *r2
+cmp *r6, L257
+jmp L265
+L193: mov #196, *r0
+L194: .data -555, -248, 653
+L195: add L210, L231
+rts
+lea L206, *r2
+L196: .data -939, 276, 375, 568, -639
+stop
+cmp L282, r3
+L197: inc L318
+prn L202
+inc L265
+inc L253
+add *r4, *r4
+
+; comment
+L198: prn *r7
+rts
+lea L297, *r6
+mov r3, r6
+dec *r3
+L199: lea L294, *r2
+
+prn *r4
+L200: .data -783, -947, -70, -409, 722
+L201: stop
+mov #19, L325
+L202: .data -188, -574, -42, 735
+mov *r4, L271
+sub *r6, *r2
+stop
+bne L239
+dec L337
+jsr *r4
+not r7
+dec r7
+L203: cmp #-51, L331
+inc *r0
+L204: red r4
+clr L242
+red r2
+clr r7
+cmp r1, L275
+L205: jsr *r4
+L206: not L213
+L207: cmp #193, r4
+clr L254
+L208: stop
+L209: .data -827
+cmp #138, *r5
+L210: .data 611, 530, -200, -595, -487, -711
+clr L252
+not L297
+mov r7, r1
+red *r0
+jmp L309
+cmp L219, #-189
+L211: bne *r5
+dec L292
+L212: not L286
+L213: bne L253
+inc L340
+red r6
+add *r4, *r2
+sub L235, L218
+L214: prn *r6
+L215: prn #-235
+stop
+L216: dec r0
+jmp *r2
+clr L314
+clr *r2
+clr *r6
+red L309
+not r7
+red L230
+dec *r5
+L217: sub *r6, *r1
+not r0
+sub r7, *r7
+L218: not r6
+L219: dec *r1
+L220: .string "ivpjmfxpvgsjqlkaybrtevkq"
+; comment
+L221: .string "ktulxhlchhovfbcjswpldvu"
+L222: not *r4
+mov *r0, *r0
+mov r2, L335
+cmp *r5, #-189
+inc L283
+stop
+jmp *r4
+not L334
+rts
+
+jmp *r2
+L223: not *r4
+add #-6, *r0
+not *r3
+add r4, L249
+L224: dec r0
+L225: cmp L258, r0
+inc r2
+jsr L293
+L226: prn *r2
+stop
+rts
+clr *r2
+clr L297
+L227: stop
+jmp *r6
+; comment
+
+red r6
+L228: .string "thagqnec"
+stop
+sub r6, *r5
+L229: clr r1
+sub #-164, L319
+add #184, L253
+jmp *r6
+add r3, L260
+add L341, r7
+lea L283, r0
+lea L267, *r6
+inc *r5
+; comment
+rts
+lea L295, *r3
+lea L253, r1
+L230: .string "nxeg"
+L231: cmp *r2, r3
+L232: .string "xlbjitlnelzwstf"
+L233: jsr *r6
+stop
+stop
+dec r4
+bne L324
+inc L333
+bne *r5
+
+cmp *r5, L319
+L234: stop
+cmp *r5, *r0
+L235: .string "np"
+L236: bne *r2
+lea L247, L340
+stop
+
+add *r1, r5
+inc r1
+not L292
+L237: .data -745, -968, 484, -785, -748, 468
+bne *r3
+jsr L271
+L238: mov #-28, r0
+not r4
+red r6
+rts
+L239: clr r6
+red *r5
+red L283
+L240: inc *r2
+L241: stop
+jmp *r1
+not r4
+inc r6
+add L292, r0
+L242: .data -643, -643, 219, 491, 429, -431, -66, -279
+mov r4, r5
+mov L305, *r2
+bne L324
+L243: .data 938, 770, 289, 466, 745, -726, 883, -619
+sub *r3, L339
+bne L263
+L244: red L265
+mov r1, r3
+L245: inc *r2
+not L246
+inc r3
+prn L318
+clr L306
+cmp r4, #213
+L246: mov L341, *r3
+mov #35, *r5
+rts
+stop
+add #-165, L313
+L247: .string "nwmnirvttxwmobed"
+L248: .data 683, -488
+L249: bne *r4
+L250: dec L320
+
+not r5
+jmp *r3
+L251: prn *r0
+clr L337
+mov *r7, r1
+stop
+rts
+inc r0
+rts
+L252: rts
+rts
+dec *r7
+L253: lea L330, r0
+L254: prn L324
+L255: rts
+not r3
+lea L330, L291
+stop
+mov L281, *r6
+L256: .string "krilvbghequx"
+lea L312, r6
+jsr L308
+L257: prn L308
+L258: red L270
+L259: not r4
+L260: red *r5
+lea L262, *r2
+L261: dec L286
+sub *r5, r4
+lea L328, L294
+L262: clr r2
+L263: sub r6, *r7
+L264: jmp *r4
+sub *r3, *r4
+L265: lea L319, r0
+L266: jmp L278
+prn #216
+lea L329, *r7
+stop
+L267: .string "cvugtztx"
+L268: add L300, L341
+L269: not L303
+L270: cmp L315, *r6
+stop
+inc *r4
+not *r2
+not *r0
+L271: add L342, L305
+prn L291
+L272: clr L314
+L273: red *r6
+clr r0
+L274: .string "pkpyyhewafeuvpjv"
+L275: .string "lmiycnwsicueczpkymr"
+inc *r1
+dec L326
+L276: lea L328, L319
+prn r4
+; comment
+red r6
+L277: .data 701, 877, -277, 543, -308, 68
+L278: add r3, L340
+L279: not L339
+stop
+L280: dec *r1
+
+L281: mov L311, *r2
+bne *r6
+L282: cmp L299, L340
+L283: inc L290
+L284: lea L290, L291
+clr *r7
+
+sub r7, *r3
+L285: clr r7
+L286: dec L336
+bne L324
+cmp r4, r5
+dec *r7
+sub #-47, L321
+stop
+lea L323, *r1
+; comment
+L287: .string "bgvdaob"
+mov L339, *r6
+stop
+L288: rts
+
+L289: bne L328
+L290: stop
+jsr L310
+clr r6
+add r6, r4
+L291: sub L317, r7
+prn L326
+dec L306
+sub #61, *r3
+L292: .data -994, -653, -940
+prn *r4
+add *r4, *r2
+mov #-16, r3
+L293: jmp *r7
+
+L294: jmp L297
+mov r3, *r1
+cmp *r5, L322
+mov #183, L301
+cmp #56, #-115
+L295: stop
+L296: .string "ibhpmyqs"
+bne L326
+L297: .string "udvah"
+sub #-20, *r3
+clr r2
+L298: rts
+red L309
+sub r7, *r0
+L299: not r7
+
+lea L309, L318
+bne L308
+jmp L319
+bne *r7
+; comment
+mov L337, r1
+L300: .data -163, -514, 683, -108, 563, 255, 633, -844
+rts
+clr *r0
+jsr *r2
+L301: lea L342, *r7
+L302: clr L304
+L303: jsr L331
+cmp r1, *r0
+L304: cmp *r7, #-60
+mov *r1, *r2
+L305: clr *r7
+lea L333, r2
+inc L322
+L306: stop
+add *r2, *r6
+cmp r3, *r6
+bne *r5
+L307: .data -295, -268, -830, 903, -507, -108, -821, -196
+jsr *r3
+jmp *r3
+bne L319
+sub #-245, *r6
+stop
+L308: .string "ltyolfyoxtkoxyo"
+dec r7
+clr *r1
+dec *r4
+bne L316
+bne L331
+rts
+L309: dec r5
+L310: sub #-6, L314
+L311: .string "hxozjasmkirxhxaoseigcav"
+not *r4
+L312: clr r3
+dec r3
+
+clr L340
+lea L339, r1
+L313: sub #-213, L329
+L314: lea L326, L334
+L315: red L336
+not *r2
+clr L327
+L316: red *r3
+L317: sub #-90, L340
+cmp #94, L341
+stop
+lea L319, r4
+L318: .string "ybykfxsfzid"
+L319: cmp r5, r3
+L320: .data 203, 230, 509, -73
+L321: red *r4
+L322: .string "tibuyi"
+inc L329
+dec r1
+jsr *r2
+inc *r1
+L323: sub r2, *r4
+not *r3
+jmp *r4
+L324: inc r1
+add #-161, *r4
+L325: .data -495, -549, -876, -473, -300
+stop
+L326: sub *r6, L334
+jmp L331
+dec r2
+sub L333, *r1
+clr r3
+cmp L329, L327
+L327: dec *r4
+L328: .data 85
+L329: .data -975, 282, -378, 836, -762
+L330: red L339
+jsr *r1
+L331: mov L336, *r0
+L332: mov #-93, L340
+L333: not *r3
+L334: not r1
+stop
+L335: sub r6, *r5
+lea L337, r7
+prn #33
+dec *r4
+not r3
+L336: stop
+L337: .data 623, -56, -93, 444, -125
+jsr *r1
+not r4
+sub L341, L339
+bne *r7
+L338: cmp *r2, *r4
+L339: prn *r7
+jsr L341
+sub L342, *r5
+cmp *r3, #-241
+stop
+jsr *r7
+sub r1, *r7
+not r1
+cmp L340, #-208
+L340: red L342
+red r7
+L341: .data 902, 433, 837, 779, 762, -871, 135
+clr *r4
+L342: sub *r0, *r3
+stop
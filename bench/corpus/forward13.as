@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 14
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: .string "ducuteouhubpwpnfehacyqca"
+L1: .data 197, -751, -784, -934, 484, 337, 466, -354
+L2: .data 705
+jsr *r1
+prn *r3
+L3: jsr *r6
+red *r1
+cmp #-74, r7
+rts
+
+L4: mov #-38, r5
+dec *r0
+stop
+cmp r3, *r7
+stop
+lea L211, *r7
+L5: cmp *r0, #135
+inc *r0
+L6: jsr *r6
+add r7, L12
+add r1, r5
+inc L32
+bne L84
+jmp L78
+
+jmp L120
+L7: jmp *r5
+sub r2, L313
+; comment
+add #7, r6
+stop
+dec r6
+add r5, r6
+rts
+dec r3
+not L92
+not *r2
+mov r0, r5
+not L270
+L8: .data -799, -702, -797
+L9: .string "dnpge"
+L10: prn *r6
+L11: bne *r2
+prn #-131
+L12: jsr L217
+jsr *r0
+L13: not *r2
+inc r4
+jsr *r1
+cmp #-199, r6
+L14: .string "baquvmkybeuehrsqmxk"
+jmp *r4
+rts
+bne L319
+lea L279, L255
+lea L171, r6
+clr L273
+; comment
+prn *r2
+inc *r6
+
+L15: lea L339, *r3
+stop
+bne *r2
+not r0
+inc *r0
+red L329
+stop
+L16: .data 624, -480, 747, 334, -107, 366, 65, 460
+stop
+
+stop
+
+L17: mov *r0, *r7
+bne L320
+mov r7, r0
+stop
+cmp r6, #-87
+L18: .data -458, 493, 405, 769, 961, 76, 526, -853
+L19: add r1, r0
+clr r0
+bne *r5
+sub L307, r7
+jsr *r6
+cmp r3, L165
+L20: not *r7
+L21: .data -5, 751, 194, -140, -655, 370, -829
+L22: .string "ehfwknliqoos"
+rts
+jsr *r2
+clr L281
+cmp r0, #-202
+L23: .string "xpbvthdwbvdwlqnsksdyx"
+jsr *r6
+L24: inc L51
+bne *r1
+clr r4
+inc *r4
+lea L192, *r7
+L25: dec *r7
+L26: dec *r4
+L27: add r2, *r0
+rts
+L28: lea L213, *r5
+mov L250, L53
+L29: bne L160
+L30: clr *r3
+lea L127, *r3
+L31: sub *r0, r7
+L32: mov L245, r6
+not L191
+red L260
+L33: jsr L278
+jmp *r0
+L34: .string "xklo"
+inc r1
+L35: stop
+L36: .data 617, 733, 751
+cmp r5, #132
+cmp L343, #19
+jsr *r5
+jsr *r4
+L37: bne L313
+red r4
+
+lea L155, r6
+L38: sub *r5, L73
+
+L39: .string "glffgjpqmqxazstfahpevlu"
+jmp L291
+L40: clr r5
+L41: dec *r7
+L42: prn L336
+L43: clr r1
+bne *r1
+rts
+jmp L300
+mov #-189, *r3
+jmp L134
+lea L130, L343
+cmp r5, L313
+mov r7, r6
+L44: cmp *r1, #67
+L45: sub r0, *r0
+mov L228, r5
+not *r4
+stop
+add r3, L297
+L46: prn *r0
+L47: .string "dweqchhyzbfqavb"
+prn r4
+lea L130, r3
+inc *r3
+jmp *r3
+inc *r0
+L48: inc L186
+dec *r5
+jmp L249
+L49: add *r0, *r6
+clr r0
+red *r7
+stop
+
+jsr L196
+L50: inc L192
+L51: jmp *r1
+L52: clr r2
+L53: not r5
+L54: bne L245
+L55: jsr *r3
+L56: dec *r3
+not L92
+sub *r2, L186
+L57: jsr L248
+inc r2
+prn *r7
+inc *r4
+L58: .string "lnsvzsczl"
+L59: mov *r4, r2
+red r5
+clr r0
+bne *r0
+not r5
+L60: inc L169
+inc *r4
+prn #40
+mov *r7, L261
+inc L233
+inc r5
+L61: .data -409, 415, 880, 12, 24
+red L176
+L62: sub L136, L167
+jsr *r7
+dec L281
+L63: .string "ymefbebmxpkaljfsyle"
+L64: inc *r5
+jsr *r7
+stop
+bne *r5
+; comment
+L65: jsr *r6
+L66: clr r0
+
+not L70
+L67: .string "opa"
+dec *r7
+lea L289, r4
+dec r1
+L68: .data 583
+L69: rts
+red r5
+not r2
+jmp L163
+L70: red r6
+jmp *r7
+mov L333, *r5
+not *r0
+sub #-250, r5
+lea L86, r5
+L71: cmp *r2, r2
+dec L155
+add *r0, L264
+add #55, r3
+inc L73
+L72: inc L102
+L73: not L330
+rts
+L74: jmp L244
+L75: add *r4, L347
+L76: .string "zsfbgnrtipoernfhopc"
+lea L288, *r2
+jsr *r6
+add L297, L199
+not L159
+L77: red r7
+L78: dec *r0
+cmp *r1, r5
+L79: .string "xdacqox"
+cmp #176, L238
+prn L311
+L80: .data 218, -574, 25, -870, -496, -584, -232, 862
+sub *r6, r6
+L81: cmp L300, L326
+red r1
+L82: inc L303
+add *r6, L114
+red L132
+; comment
+L83: add r0, *r7
+L84: .data -996
+red *r5
+clr r5
+stop
+prn #-234
+; comment
+lea L295, r1
+dec r3
+L85: sub #-57, *r5
+not *r1
+L86: jmp L134
+cmp *r0, r7
+inc L126
+inc r4
+L87: clr *r2
+L88: cmp L219, *r5
+sub L197, r4
+stop
+red *r0
+add *r3, r3
+L89: jsr L238
+mov *r6, L249
+mov *r5, r7
+L90: dec L327
+jmp *r1
+dec L262
+cmp L163, #-220
+sub *r6, r3
+L91: stop
+; comment
+L92: mov r2, L224
+L93: lea L213, L327
+stop
+clr L101
+dec L346
+add L292, *r5
+; comment
+rts
+L94: lea L286, *r2
+clr L164
+mov *r7, L265
+L95: add r2, L171
+L96: inc *r3
+L97: rts
+; comment
+red *r0
+lea L102, L156
+L98: .string "dgdzlrwd"
+dec L108
+cmp *r4, *r1
+red *r3
+; comment
+L99: inc L336
+L100: cmp *r7, #-197
+L101: lea L132, r0
+L102: mov L298, *r2
+L103: sub r7, *r7
+L104: .string "irmmkpbvfrekgaafdcnv"
+mov r1, L229
+L105: .string "wbyauufvzwpacqdz"
+prn #141
+red r0
+mov *r6, r0
+
+prn #216
+L106: .string "vvwrfpxgosriteimeknvpwl"
+stop
+L107: bne L306
+mov *r2, *r7
+rts
+dec r4
+L108: .string "wflajwztvdgnvr"
+L109: cmp *r2, #-186
+L110: lea L225, r3
+L111: .data -346
+mov *r6, L114
+not L234
+sub L324, r1
+not L259
+L112: dec *r6
+inc r5
+L113: .data 565, -857, -832, 33, -619, -162, -108
+mov L278, r7
+bne L213
+sub *r4, r4
+L114: sub L155, *r1
+add L305, *r6
+L115: .data 694, 572, 747, 680, 732, 977, 109, 345
+L116: stop
+rts
+jmp *r4
+L117: .string "dtmysxczslxeft"
+inc L256
+dec *r1
+stop
+L118: .string "cbvaytt"
+lea L277, *r1
+bne *r5
+stop
+L119: rts
+red r5
+cmp *r1, r3
+not L124
+inc *r5
+; comment
+L120: .data -711, -461, 222, 395, -563, -881, 185, -562
+clr L243
+stop
+not *r3
+L121: sub #-243, L237
+not L256
+L122: jmp *r4
+L123: .string "xtraqw"
+L124: sub r3, r0
+mov #-66, r5
+add #-155, r2
+sub r1, L193
+L125: inc r3
+clr *r2
+sub *r6, *r5
+inc r2
+jmp *r7
+L126: prn *r4
+L127: .string "ypxxsazrfaqnzwhznrxvlbbu"
+not *r1
+L128: cmp *r7, L207
+L129: clr r5
+not r5
+L130: lea L302, *r6
+lea L137, r1
+jsr *r5
+jmp L200
+bne L303
+clr *r7
+bne *r2
+L131: .string "vvmvnqdacdttkbngp"
+jmp L333
+L132: sub r5, *r5
+L133: red r1
+L134: .data 788
+lea L188, r1
+L135: stop
+L136: jsr L271
+jsr L322
+add #-256, L262
+jsr *r6
+lea L337, r7
+L137: sub r5, *r4
+L138: inc r7
+L139: jmp *r2
+L140: red r7
+red *r1
+lea L346, L147
+jsr L326
+L141: jmp L168
+L142: sub #-48, r4
+clr L190
+jsr *r1
+jsr *r6
+L143: add r3, L342
+L144: cmp #-11, #-25
+L145: rts
+L146: lea L215, *r1
+sub *r6, L340
+
+jsr L330
+dec *r6
+prn L320
+L147: clr r6
+inc *r5
+L148: lea L156, r6
+not *r6
+
+inc L257
+L149: rts
+mov #153, r0
+lea L171, r4
+dec L199
+cmp L180, r0
+cmp L228, L161
+dec L194
+jsr *r0
+stop
+L150: red *r7
+L151: inc L200
+stop
+add L264, r2
+L152: mov L236, *r0
+bne *r6
+prn r1
+sub r0, L306
+sub *r4, *r4
+L153: dec *r3
+L154: .string "vvldzlilmszfk"
+L155: lea L284, L241
+sub L251, *r1
+jmp *r2
+jsr L262
+clr r2
+L156: clr *r2
+sub L303, L339
+bne L338
+jmp L184
+sub #170, r5
+stop
+not *r2
+L157: clr r3
+stop
+L158: mov #244, L197
+lea L296, L329
+rts
+clr r4
+L159: .data -982, 122, 684, -340, -817, 471, -4, 227
+stop
+jmp *r6
+L160: prn L257
+; comment
+L161: clr *r1
+L162: cmp r7, r1
+stop
+jmp *r3
+sub #-5, *r0
+cmp L235, L344
+stop
+prn #0
+L163: bne L187
+L164: .string "mdojemjymesx"
+red L238
+prn #-203
+prn L271
+sub *r1, *r1
+jsr *r3
+L165: .data 26, 167, 863, -772, -663, -797, 964, 558
+clr L328
+L166: red r6
+rts
+sub *r1, *r5
+not *r7
+not *r7
+mov *r7, r4
+L167: .data -16, -895, -82, 767, 818
+mov L283, L319
+cmp *r7, L229
+cmp #-210, *r1
+L168: red r6
+L169: .string "ximhpncpck"
+L170: sub #11, r6
+bne *r0
+jsr *r0
+cmp L202, L327
+jsr L233
+bne *r6
+mov r2, r5
+; comment
+L171: rts
+L172: dec *r3
+L173: cmp *r0, r7
+L174: mov L285, *r7
+L175: jmp *r2
+jsr *r1
+L176: .string "ownuxvbypklgpucvkp"
+red r0
+prn r3
+jsr L190
+add #-142, *r6
+rts
+jmp L318
+L177: cmp *r0, #102
+jmp *r0
+L178: inc *r2
+L179: jmp *r3
+L180: bne L346
+not r5
+L181: .data 237, -877, 622
+L182: prn L249
+prn L293
+
+add *r4, *r2
+L183: .string "vjlh"
+lea L274, r1
+jsr L305
+bne L258
+jsr *r2
+L184: clr L273
+mov L233, r7
+L185: .data -669, -2, -239, 416
+cmp L295, #43
+jmp L198
+L186: stop
+bne L199
+mov #247, r3
+jsr L237
+L187: inc *r5
+
+jmp L249
+L188: clr r5
+L189: lea L258, *r6
+stop
+not r4
+jsr *r6
+stop
+jmp L233
+
+sub #40, r6
+red *r2
+L190: mov L259, L250
+clr r0
+L191: jsr L344
+bne *r6
+L192: .string "s"
+L193: dec *r2
+; comment
+stop
+dec r3
+dec r0
+dec r7
+dec *r4
+L194: jsr L218
+rts
+jsr L343
+prn r7
+L195: prn #208
+clr L250
+mov r0, *r6
+red *r0
+bne L261
+L196: .string "bcf"
+; comment
+lea L285, L254
+L197: mov *r6, *r3
+red L211
+jsr L248
+L198: clr r0
+L199: add *r1, L223
+clr r4
+clr *r0
+L200: lea L319, *r5
+L201: .data -25, -981, 7, 582, -389
+L202: add *r3, *r1
+red r4
+mov #-51, r7
+jsr *r5
+stop
+L203: mov *r0, L248
+L204: cmp *r4, #-166
+sub #-75, L237
+L205: sub *r3, L347
+; comment
+L206: dec L303
+clr L210
+sub *r1, *r2
+red L309
+rts
+L207: prn *r1
+jsr L256
+cmp r5, #69
+cmp r1, L214
+jsr *r0
+add L309, r6
+dec *r2
+rts
+sub L270, *r4
+mov #-240, r6
+jmp L300
+L208: sub L237, *r6
+L209: add #-166, L280
+inc *r4
+L210: .string "zlkrogvsqlspcuug"
+prn #-62
+L211: stop
+mov r5, *r2
+stop
+; comment
+L212: sub r5, L298
+L213: .string "sqfhwsrzwxv"
+jsr *r1
+L214: .string "frvffhtnizwvwqvorsrfc"
+L215: bne *r7
+inc L286
+L216: .data -323, -689, -140, 116, -854, 524, 953, -532
+mov L281, r7
+L217: prn #48
+bne L246
+red L268
+stop
+L218: cmp *r4, *r1
+L219: cmp r3, #164
+L220: prn #201
+L221: rts
+dec r4
+L222: .data -379, -438
+; comment
+L223: jsr *r0
+; comment
+jmp L285
+not *r7
+dec r2
+bne *r6
+L224: dec L275
+prn *r1
+; comment
+add *r3, *r3
+L225: .data 697, -975, 439, -931, 939, 429, 964, 480
+L226: mov L248, *r5
+dec *r7
+L227: .string "b"
+clr *r2
+cmp *r1, *r1
+red *r7
+L228: inc L325
+L229: stop
+rts
+L230: .string "wbtrf"
+dec L337
+L231: prn #-147
+clr *r5
+L232: not r2
+L233: .string "jkhaxwnvzksq"
+bne *r6
+; comment
+rts
+cmp #-242, r2
+L234: stop
+L235: add #75, r5
+jsr *r1
+L236: .string "evxewivg"
+mov *r1, L270
+L237: mov *r4, *r2
+not L275
+L238: red *r3
+
+not r6
+L239: not *r4
+prn #-125
+dec L320
+inc L294
+red L345
+bne *r4
+inc r6
+red L285
+L240: red r1
+dec r0
+jmp L245
+L241: sub #211, r1
+red *r2
+L242: not L346
+not L249
+red r1
+not L287
+not L262
+L243: clr L280
+add *r2, L267
+L244: .data 204, 269, -647
+rts
+not L304
+L245: sub *r1, r7
+inc *r0
+jsr *r1
+L246: jmp L270
+rts
+jmp *r2
+L247: jsr L278
+lea L310, r0
+rts
+red r0
+L248: .data 652, -180, -275, -719
+clr *r6
+clr r6
+red L260
+inc *r6
+L249: .data -523, 152
+lea L306, *r0
+mov L276, L275
+L250: .string "rronymk"
+inc *r5
+jsr L335
+L251: bne L317
+mov L270, r6
+L252: bne L333
+stop
+jsr L264
+L253: jmp L282
+mov L292, *r5
+L254: .data 228, 964, 309, -756, -285
+jmp *r0
+inc *r1
+cmp *r6, r4
+jmp L292
+sub #-22, *r4
+dec L317
+cmp r2, L298
+jmp L294
+L255: cmp *r4, r7
+L256: jmp L262
+mov r2, L292
+stop
+sub #-128, L275
+bne *r2
+lea L319, *r0
+clr r4
+jmp L329
+L257: stop
+jmp L317
+red *r5
+L258: jmp L262
+mov *r5, L270
+jmp L285
+L259: bne *r1
+red L318
+L260: cmp #188, r5
+L261: sub #-107, r5
+dec *r0
+jmp *r1
+; comment
+inc *r4
+L262: cmp #-30, *r0
+L263: add *r3, *r2
+sub r3, *r2
+sub L270, L303
+L264: add *r6, *r2
+add #-222, *r4
+L265: cmp L280, #-190
+bne L332
+L266: jmp L309
+inc r1
+L267: jmp *r3
+dec L301
+not r2
+lea L328, r5
+L268: bne L319
+cmp *r6, L327
+sub *r0, r7
+sub L271, *r3
+clr L316
+L269: prn #232
+L270: .data -407, 458, -104, -269, 954
+L271: jmp L280
+; comment
+sub #-31, *r7
+jsr *r4
+red *r7
+L272: cmp r4, #169
+L273: .string "cmlydhsqzovyqfpcqqmiihz"
+sub r6, r0
+inc L341
+lea L341, r5
+jmp *r7
+stop
+stop
+
+not *r5
+jmp *r3
+prn #-38
+jmp *r1
+L274: not L347
+mov #-92, L332
+prn r3
+L275: dec r6
+rts
+sub r5, L344
+L276: stop
+L277: add L283, *r6
+L278: jsr *r4
+L279: lea L301, *r6
+jsr *r5
+sub #231, L335
+lea L292, r5
+L280: prn *r0
+red L287
+mov r4, *r4
+L281: add *r1, L345
+lea L337, L318
+stop
+L282: prn *r2
+sub #-103, *r6
+L283: .string "nufobwdwfkbu"
+L284: not r0
+lea L315, r5
+stop
+jmp L339
+stop
+not *r4
+L285: not *r5
+lea L310, L324
+jsr L304
+lea L307, *r2
+prn L307
+L286: .string "vjnov"
+L287: cmp r0, r0
+dec L324
+mov r7, r1
+inc r7
+jmp L324
+jsr L310
+mov *r3, L288
+jsr L331
+dec *r3
+stop
+not L301
+; comment
+not *r0
+L288: not *r6
+L289: not L345
+L290: .data 107, -626, 675, 937
+inc L348
+L291: rts
+lea L324, L328
+jsr L326
+clr L325
+L292: sub L327, *r6
+L293: inc *r5
+jsr *r2
+jmp L333
+L294: prn #-49
+L295: stop
+mov #-20, r3
+L296: jmp *r3
+cmp r0, #-222
+L297: add L331, r2
+L298: mov r5, *r4
+jmp L309
+L299: .string "sphumxecwparecuek"
+jsr L302
+add r6, r2
+L300: jsr L339
+L301: cmp L340, L348
+lea L328, *r3
+L302: stop
+L303: cmp #-225, #14
+add *r5, r4
+inc r3
+dec L331
+; comment
+mov *r5, r2
+lea L312, L326
+L304: .data -74, -197, 585, -264
+L305: sub L335, *r0
+L306: lea L331, r2
+L307: dec L334
+inc L317
+prn #-161
+L308: rts
+cmp *r3, r1
+inc L327
+add r1, r2
+bne L311
+L309: .string "ledzusdwuhhdn"
+L310: lea L348, r1
+L311: .data -325, -1000, -175
+L312: add r7, L341
+sub r7, *r1
+prn r1
+jsr L313
+jsr L342
+L313: .data -698, 146
+rts
+add *r7, *r3
+inc r6
+L314: jmp *r0
+not r2
+lea L328, *r3
+add #67, r5
+cmp L323, r0
+stop
+red L322
+L315: stop
+L316: lea L338, r5
+L317: add #-97, r4
+lea L323, *r6
+red *r0
+L318: red L332
+L319: .string "uhuozvillnvauwbztqjvtzc"
+dec L330
+dec *r5
+rts
+stop
+L320: clr r5
+jmp L326
+bne *r5
+L321: .string "jax"
+lea L337, *r6
+L322: .data 441, -104, 476, -359, -288, 221
+L323: prn *r0
+L324: not r3
+
+inc *r6
+L325: .data -434
+stop
+L326: dec L330
+stop
+L327: stop
+stop
+add L347, *r4
+add *r1, r6
+L328: .string "yqsuazguqabwmvc"
+L329: inc L335
+sub *r4, r4
+cmp *r6, *r2
+bne *r6
+cmp L338, *r4
+L330: rts
+L331: jmp *r0
+L332: prn #242
+mov r6, r4
+L333: rts
+lea L344, L345
+add #-137, r6
+L334: clr r6
+inc *r0
+mov #-36, r1
+cmp L338, r1
+inc r0
+rts
+stop
+L335: .string "rysesylxspndretdxr"
+L336: clr L345
+prn #-111
+L337: stop
+L338: rts
+; comment
+L339: not r6
+L340: mov *r4, r0
+add r0, L344
+jsr *r3
+rts
+cmp r3, *r3
+dec r6
+L341: mov *r1, L345
+dec r6
+add #226, L347
+L342: .string "eicpgcmwfusnan"
+add L348, L345
+prn *r0
+add *r1, r3
+
+lea L343, L348
+prn L345
+stop
+inc L345
+jmp *r7
+red *r6
+L343: jsr L344
+mov #174, r6
+L344: not *r7
+L345: dec L348
+L346: .data 348, 873, -255
+rts
+L347: jsr L348
+L348: rts
+red L115
+not r2
+stop
@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 15
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+jmp *r4
+add r0, *r7
+clr r0
+bne L163
+L0: stop
+clr L100
+prn r0
+clr L39
+L1: jsr L266
+L2: add #-151, *r3
+mov r6, r4
+L3: mov #76, *r6
+L4: red r2
+L5: .string "c"
+prn *r2
+rts
+; comment
+L6: inc r3
+cmp L274, *r3
+not *r4
+not L48
+L7: .string "sxafcuiyqjsnkytsuippnre"
+L8: .string "gegvhyyynvkafxs"
+add r1, r6
+lea L195, *r0
+L9: bne L196
+L10: mov *r3, *r3
+L11: add *r5, r1
+red L222
+inc *r5
+stop
+jsr L91
+L12: .string "afhncajvknnrhtbvipcfusin"
+lea L286, *r6
+clr L16
+sub L61, L334
+mov L181, L92
+not r0
+L13: .string "gum"
+sub L40, r4
+jmp L329
+L14: .string "ajekiragmciluhzrxicmuhv"
+L15: jsr *r7
+cmp L289, L157
+L16: stop
+stop
+lea L221, *r5
+sub #-178, L188
+bne L191
+inc r0
+clr *r1
+jmp L229
+L17: red *r7
+; comment
+L18: mov *r5, L66
+lea L105, L347
+L19: clr r6
+L20: prn *r7
+; comment
+L21: stop
+bne *r1
+; comment
+stop
+mov L149, *r0
+L22: cmp #-242, *r5
+cmp #235, L180
+prn *r5
+stop
+red r6
+L23: not *r1
+cmp r2, r2
+L24: inc L329
+L25: dec r5
+L26: not r0
+L27: dec L218
+sub *r4, r7
+mov r7, *r6
+L28: stop
+add r3, *r0
+bne *r1
+jmp *r7
+L29: .string "pe"
+dec *r7
+L30: clr r7
+L31: .string "oxnvyw"
+red r0
+prn r7
+L32: rts
+L33: jmp L167
+not L161
+clr r4
+L34: .string "vgeks"
+; comment
+stop
+inc r3
+not L175
+lea L312, L44
+inc r1
+stop
+L35: rts
+L36: bne *r4
+red *r1
+lea L57, L267
+prn r5
+rts
+red *r2
+jsr L299
+L37: red L220
+lea L141, *r4
+L38: jsr L296
+red *r0
+clr *r3
+L39: prn L59
+clr *r1
+L40: inc L193
+jsr *r4
+
+stop
+L41: .data -858, 744
+
+L42: rts
+L43: .string "lfp"
+dec L114
+dec r1
+cmp *r4, r6
+
+stop
+bne *r0
+stop
+inc r4
+L44: dec *r7
+cmp #-214, *r6
+jsr L315
+L45: .data -378
+L46: .data 820
+stop
+jmp *r7
+lea L226, r1
+sub #129, L225
+clr r4
+L47: .data -42, 839
+L48: lea L112, *r6
+bne *r5
+add r4, L178
+add *r4, *r1
+dec r4
+L49: jsr *r5
+L50: rts
+red L91
+stop
+lea L308, *r3
+not r0
+dec r6
+L51: add L152, L285
+mov *r2, r4
+clr r7
+
+sub #196, L115
+L52: dec *r2
+sub #-136, r0
+clr L339
+red *r0
+L53: .string "rqdyvwlnykaqxzg"
+L54: clr r5
+L55: .data -245, -470, -452, 324
+bne *r4
+bne *r3
+dec r0
+stop
+cmp r6, r1
+clr *r1
+L56: .data -546, 54, 555, -255, 89
+L57: rts
+jmp L348
+L58: inc r4
+jmp L87
+red r1
+jmp L193
+L59: jsr L311
+jmp *r5
+; comment
+L60: cmp L252, *r0
+cmp r7, *r7
+lea L328, *r7
+red L338
+stop
+inc *r2
+cmp #-3, r0
+L61: mov *r4, r6
+L62: .string "bmkhzoovetip"
+rts
+dec L290
+not r1
+prn L186
+not L204
+mov #107, *r2
+L63: sub #180, r0
+L64: .string "sfjxofxakhshob"
+; comment
+red r4
+mov r1, r3
+L65: jsr *r3
+inc r2
+jmp L266
+L66: .string "txdnsixwntrfdnsbkfw"
+L67: .data -635, -831, 302, 11, 244, -561, -92, 328
+prn #-167
+rts
+clr r6
+not r3
+stop
+dec r0
+L68: sub L276, L160
+L69: prn #128
+inc r1
+clr r7
+red r3
+add *r3, L78
+L70: dec *r7
+L71: red *r5
+not r0
+L72: jmp L212
+sub *r4, r4
+L73: lea L103, r7
+red *r7
+L74: .data -988, -930, -967, -288, 748, 161, -141, 582
+L75: .string "beutrizaaactgomc"
+L76: lea L153, *r3
+dec *r5
+L77: bne *r6
+prn #-10
+stop
+L78: cmp r2, *r1
+sub *r5, *r2
+bne *r4
+L79: stop
+jsr *r2
+L80: prn r2
+L81: add r5, L253
+rts
+cmp r0, r7
+L82: jsr L152
+L83: clr r3
+L84: lea L147, r4
+rts
+cmp r0, L253
+; comment
+not L151
+clr *r2
+L85: clr L349
+bne *r0
+stop
+sub #-54, *r3
+add *r5, L91
+jmp L212
+red r3
+mov L195, r2
+inc L276
+L86: rts
+jmp *r0
+rts
+bne *r3
+rts
+L87: dec L152
+not r4
+clr r2
+L88: cmp *r0, #139
+not L238
+L89: clr *r2
+L90: .data 309, -944, 254
+stop
+; comment
+L91: .data -775, -77, -992
+L92: prn *r3
+L93: prn *r6
+rts
+L94: prn L218
+jmp *r6
+L95: add #-130, r5
+L96: jsr *r2
+rts
+red r1
+jmp *r7
+cmp r3, r1
+L97: jmp L316
+dec r2
+bne *r2
+cmp *r4, r7
+L98: prn *r7
+mov r7, *r0
+cmp #50, L265
+L99: sub #201, r0
+not r7
+red r4
+L100: .data 265
+bne L320
+red *r2
+L101: add L258, r7
+clr *r1
+; comment
+L102: stop
+L103: cmp *r4, r3
+L104: stop
+clr L141
+jmp L162
+not r5
+L105: mov r4, r2
+sub r5, r3
+L106: red L205
+lea L311, r1
+; comment
+L107: inc r5
+L108: clr L184
+red L279
+red r2
+L109: lea L318, L189
+L110: rts
+L111: red L157
+lea L351, *r3
+prn #-226
+lea L338, L123
+L112: stop
+dec *r4
+clr L297
+bne *r0
+mov L327, *r0
+cmp *r2, r3
+L113: jsr L201
+L114: sub *r4, *r5
+L115: cmp *r2, r5
+L116: .string "pfesssxdojioewqzvsw"
+bne *r7
+; comment
+rts
+jsr L117
+L117: .data -949, 294, -106, -429, 400, 137, 425
+prn *r5
+sub #-170, r4
+lea L196, *r1
+; comment
+cmp *r1, L234
+L118: .string "hqznnvosxmaagcjmya"
+dec *r3
+stop
+L119: cmp #81, #99
+L120: jmp *r4
+L121: dec L190
+L122: .data -835, -931, 123, 578
+L123: not L246
+L124: mov L255, L129
+stop
+L125: cmp L323, L342
+red *r5
+L126: red r0
+sub #-122, r0
+L127: jsr *r7
+dec *r6
+bne L181
+L128: red *r1
+L129: red r7
+mov #-149, L229
+L130: rts
+L131: lea L221, L219
+jsr *r4
+L132: inc *r2
+
+jmp L148
+L133: rts
+not r4
+stop
+jsr L200
+L134: dec r4
+L135: rts
+L136: stop
+bne *r5
+L137: jsr L172
+jmp *r4
+L138: .string "sfebdthohaexo"
+jsr L163
+stop
+add r2, r0
+cmp L345, #97
+L139: .data 834, -771, -839, -907
+L140: red L162
+cmp *r0, #55
+jsr *r4
+clr r1
+L141: .data 816, -382, -669, -260
+L142: rts
+add r7, *r4
+rts
+L143: prn L305
+dec *r7
+L144: .string "dupvdmgooklvx"
+dec r7
+L145: jmp *r7
+L146: rts
+jmp L224
+L147: cmp r4, L284
+stop
+mov r0, r0
+L148: clr L222
+inc *r6
+L149: not L288
+L150: rts
+L151: rts
+L152: rts
+sub *r5, *r2
+jmp L326
+L153: prn *r1
+L154: not *r4
+inc L274
+dec r4
+L155: clr L244
+prn #164
+mov r7, r4
+L156: not r3
+cmp L171, *r5
+jsr L187
+red *r0
+L157: .data 831, 387, 476, 797
+dec r3
+jmp L332
+cmp L205, r0
+lea L211, r3
+L158: mov *r2, r1
+lea L312, *r3
+L159: clr L229
+L160: .string "kk"
+bne L228
+red L245
+mov L244, L310
+L161: rts
+L162: .string "xpafwkwrbkw"
+L163: mov L278, r5
+dec *r0
+lea L298, r7
+; comment
+L164: jsr L180
+
+bne L265
+dec *r2
+prn r4
+L165: cmp *r4, L306
+L166: cmp *r1, #-123
+lea L174, *r4
+dec *r0
+L167: .data -864, 810, 161, -532, 753, -575
+
+stop
+dec r6
+red r4
+add *r3, L248
+sub L283, r2
+sub *r4, *r7
+mov L351, L288
+rts
+L168: .data -66, 602, -455
+cmp #-224, #-11
+not L201
+lea L277, *r4
+L169: add r0, r0
+bne *r4
+L170: add L218, L207
+L171: red L344
+L172: add r1, L347
+mov *r4, r4
+cmp *r7, L261
+jsr L292
+not r6
+L173: .string "d"
+red L314
+lea L214, L324
+clr L346
+inc *r6
+bne L237
+jmp *r4
+L174: bne *r1
+dec r7
+mov *r7, *r6
+clr L349
+jsr L333
+dec r5
+clr *r7
+lea L290, L191
+add *r1, *r7
+L175: rts
+mov #102, L219
+L176: jmp *r1
+stop
+rts
+inc L303
+L177: clr *r5
+sub #-1, L278
+L178: .string "ukgcxgyxpqiglzpy"
+L179: inc L325
+L180: cmp #143, r0
+not r5
+mov #129, *r4
+L181: inc r3
+L182: jmp L345
+red r6
+prn L221
+L183: stop
+L184: red L237
+L185: add #-247, L322
+add L265, *r3
+add r3, *r5
+lea L258, *r6
+L186: rts
+L187: rts
+sub L290, *r0
+L188: inc r7
+dec L320
+mov L208, *r6
+lea L205, L234
+mov #186, L326
+stop
+clr L268
+inc L303
+L189: .string "ffvqtywptsus"
+L190: .data -385, 556
+L191: sub *r6, *r2
+mov L312, L349
+prn *r0
+stop
+L192: lea L262, L202
+add #-177, L249
+sub #119, r5
+add *r4, *r0
+inc *r5
+L193: stop
+not r0
+rts
+L194: .string "afppidhdi"
+jmp *r7
+L195: mov L335, r1
+L196: sub #-248, L245
+sub L203, r5
+dec L244
+lea L323, L330
+L197: not *r2
+L198: prn *r6
+jsr *r6
+L199: stop
+jmp *r7
+clr L319
+stop
+sub L274, *r6
+L200: .string "zgfzugallae"
+L201: red r1
+red *r0
+L202: clr L308
+L203: jsr *r3
+not L220
+cmp r7, L235
+L204: .string "vmcxbmaynnqk"
+sub *r1, L306
+add *r3, r6
+cmp *r3, L244
+inc r5
+add *r2, r3
+L205: red *r1
+lea L281, r7
+mov L291, r7
+L206: jmp L314
+mov r7, r5
+sub r1, r0
+L207: not L280
+jmp *r2
+not *r7
+lea L238, *r6
+red *r1
+bne *r1
+bne *r2
+not *r2
+add *r6, L326
+sub #226, r0
+L208: add r5, L335
+bne *r7
+red *r5
+red L314
+
+L209: clr r6
+L210: .string "vgvbze"
+L211: .string "zikcuzdcxyurppedndwxtx"
+mov L337, L343
+prn #172
+cmp L268, *r0
+lea L226, *r3
+add *r5, *r7
+rts
+prn L261
+jmp L334
+bne *r7
+mov L344, *r1
+add *r2, L303
+inc r3
+clr *r0
+prn *r1
+dec r1
+L212: cmp r0, #-100
+add L224, *r2
+jsr *r1
+
+L213: .string "lmlckswxjoecshlqbsusul"
+jsr L292
+L214: .string "pua"
+red r2
+sub *r1, *r6
+L215: red L333
+; comment
+add #139, L240
+not r3
+clr r4
+bne L333
+L216: stop
+sub *r1, L231
+bne *r1
+
+not L314
+L217: dec L285
+L218: sub r2, L319
+red L243
+red *r2
+L219: sub r1, *r0
+L220: add L236, *r1
+inc *r0
+not L229
+L221: mov L254, L261
+
+mov #77, *r2
+mov #19, *r4
+L222: .data -670, 357, -725, -583, 993
+L223: .data -885, 563
+inc r7
+sub #-226, *r0
+L224: bne L337
+mov #-56, r4
+jmp L324
+cmp L301, #-25
+L225: cmp r1, L306
+dec L265
+prn L265
+red L269
+L226: rts
+L227: not *r2
+L228: .data 805, 823, -909, 114, -822, 735, 883, -307
+L229: add r1, r0
+dec r6
+L230: red L240
+L231: lea L265, *r4
+inc L254
+bne L273
+L232: .string "ou"
+L233: .string "lzubichs"
+L234: mov L341, L302
+L235: inc r7
+inc r7
+red L311
+lea L299, r2
+mov L335, *r1
+not r0
+mov L253, L246
+L236: clr L317
+L237: jmp L313
+stop
+L238: .data 626
+L239: prn r1
+L240: bne *r7
+prn L309
+L241: sub #76, *r3
+; comment
+inc L328
+; comment
+L242: .string "fjipsqoczaffqyffnwmgb"
+L243: jmp *r1
+L244: sub L286, *r5
+jmp L321
+clr r0
+bne *r3
+prn L319
+not r2
+
+dec *r1
+L245: lea L299, r1
+L246: .string "xeco"
+clr L294
+L247: rts
+prn *r1
+stop
+L248: not r4
+add #63, L349
+L249: mov r6, *r0
+mov #-59, L330
+rts
+L250: jsr L338
+L251: mov L302, *r1
+bne L321
+not L346
+cmp r0, L320
+red *r7
+L252: dec r5
+not r6
+cmp #36, *r7
+rts
+stop
+
+red *r4
+L253: not *r1
+jsr L327
+stop
+lea L330, L349
+L254: bne L317
+jsr *r4
+clr r5
+stop
+L255: prn r4
+bne L316
+; comment
+jmp *r4
+L256: jsr L290
+clr L279
+mov r6, *r7
+L257: .data 279, 449, 215, -772
+L258: prn #128
+bne L261
+mov #89, *r1
+cmp #55, #-252
+L259: dec r0
+add L306, L344
+jmp L269
+lea L309, L311
+bne *r6
+L260: .data 442, 92, 277, -535
+L261: cmp r7, #-254
+mov *r7, *r6
+add r3, L300
+stop
+L262: stop
+jmp L304
+rts
+clr L322
+not r3
+add L315, r2
+L263: .data -429, -182, -670, -271, -78
+stop
+L264: not *r2
+rts
+mov #-17, L317
+stop
+rts
+dec *r4
+not r0
+inc L322
+lea L277, *r1
+jsr L289
+L265: mov #-252, r3
+L266: lea L350, *r6
+L267: .string "ytaogjsaxskkxxmxtjcdtzqs"
+prn #7
+L268: .string "mjihusilmrvqkqktnhftbeds"
+L269: .data 843, -693, 690, 166, 864, -874
+L270: dec L315
+; comment
+bne L299
+L271: .data 654, -234, -65, 614, 29
+L272: .string "oqwovfkznohwxapsy"
+stop
+prn #90
+; comment
+add r5, r1
+inc r6
+mov *r4, *r3
+not L331
+sub L341, r1
+rts
+L273: stop
+sub r7, r7
+bne L320
+not L296
+lea L351, *r2
+mov #133, *r3
+cmp #-14, L277
+L274: .string "lvktxun"
+L275: .string "ftwkfiftzibjbbsyrzq"
+L276: mov *r6, L279
+bne L346
+L277: add L301, r3
+rts
+inc r0
+L278: clr r0
+L279: add L312, r6
+
+red r1
+lea L307, r1
+rts
+L280: cmp #-49, *r2
+L281: red L310
+L282: jsr L329
+L283: jmp L285
+jmp L302
+L284: dec *r2
+L285: clr L339
+not *r7
+stop
+dec *r3
+L286: cmp r4, #-151
+inc L319
+L287: prn *r4
+red L319
+L288: jsr *r7
+; comment
+dec L351
+prn r0
+L289: stop
+L290: add *r7, *r2
+lea L346, L307
+sub *r7, L337
+rts
+L291: sub r2, r5
+bne *r3
+L292: mov L341, *r3
+L293: rts
+L294: jsr *r1
+not *r0
+L295: jmp *r2
+clr L300
+L296: clr r1
+add L308, *r1
+not L298
+inc r4
+jsr *r1
+sub L304, L348
+bne L320
+L297: add r6, L349
+clr r2
+L298: clr L339
+clr r2
+sub r5, L301
+L299: .string "nnykng"
+L300: red L333
+prn r5
+red r6
+rts
+rts
+jsr *r4
+sub L330, *r7
+L301: stop
+clr L302
+L302: .string "glrjcmyziwgmvduvxus"
+sub L311, L319
+inc *r4
+prn r6
+L303: dec *r6
+jsr *r1
+; comment
+stop
+not *r7
+prn *r1
+rts
+lea L308, L344
+L304: inc *r4
+add #175, L307
+not *r7
+clr L313
+L305: .data -663, 754, 429, 325, 433
+not r1
+lea L309, L345
+mov r5, *r1
+add L334, r2
+L306: rts
+L307: clr r7
+L308: lea L339, *r4
+L309: .data -713, 528
+L310: cmp *r2, L349
+jsr L318
+prn r7
+mov #126, L311
+L311: clr r7
+not *r2
+prn r2
+prn #-225
+rts
+stop
+dec *r3
+mov #25, L313
+mov r5, r6
+jsr *r5
+red L330
+cmp r1, *r6
+L312: rts
+L313: stop
+prn #-226
+L314: lea L326, L328
+L315: .string "yvnw"
+sub L341, L350
+L316: .string "dntabp"
+L317: .data -308, 868, 386
+L318: cmp *r4, r1
+L319: lea L344, r5
+L320: jsr L351
+jsr L324
+; comment
+L321: not *r0
+jmp *r0
+L322: not *r3
+mov r0, L333
+; comment
+sub #-193, *r2
+stop
+rts
+lea L326, *r4
+red L350
+red r0
+dec *r6
+L323: jmp *r2
+L324: not L348
+L325: .data 222, 912, 33, 555
+add #-49, *r7
+inc L329
+
+L326: prn #-38
+L327: rts
+mov r7, *r7
+mov r2, *r3
+L328: .data -213
+L329: jsr L349
+dec L342
+L330: inc L350
+jmp *r6
+L331: lea L348, L350
+bne *r4
+red L350
+L332: mov #111, *r3
+bne *r3
+add L351, r6
+jsr L348
+inc L349
+sub #-174, *r5
+; comment
+L333: dec L334
+L334: cmp #86, L345
+cmp r3, r1
+mov L336, *r2
+L335: not L342
+jsr *r2
+inc *r7
+L336: stop
+L337: sub r2, L341
+sub r5, r2
+mov #197, *r4
+lea L340, r3
+; comment
+not *r4
+inc *r5
+jmp *r3
+lea L339, L341
+sub L341, L341
+L338: mov *r7, r2
+inc L346
+rts
+L339: inc r2
+not *r6
+L340: sub L345, r3
+; comment
+; comment
+cmp *r7, *r6
+jsr *r1
+jsr *r1
+L341: .string "gxvdsiwxtobxenyq"
+cmp *r5, L351
+L342: .string "xsh"
+L343: .data 293
+L344: prn #57
+L345: .data -758, 190, -888, -474, 405
+L346: .data 572, 410, 971, -271, 79, 35
+mov *r2, *r4
+not L350
+add L351, r1
+
+red L351
+rts
+cmp #-249, #222
+L347: stop
+stop
+bne L348
+L348: prn r2
+L349: .string "iauuowhhd"
+add r6, L351
+
+not L351
+clr r7
+mov L351, L351
+L350: add *r6, r1
+bne *r0
+lea L351, L351
+add #28, L351
+L351: stop
+cmp *r2, r3
+stop
@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 16
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: sub #29, *r0
+prn #-33
+red L283
+add #-178, L4
+L1: sub #-204, L215
+L2: prn r3
+dec r3
+prn L68
+dec L142
+not r5
+mov L97, L20
+not *r5
+L3: add *r1, *r4
+L4: add #136, r3
+L5: red r1
+sub *r3, *r3
+red L69
+sub L181, L61
+dec L320
+L6: .string "bvcxpfxnwxrgguylzei"
+bne L149
+L7: .string "zcrvavaakxnidynfln"
+cmp *r5, #21
+inc r3
+L8: .string "rksrnwsmdkxqujlmm"
+L9: not L47
+add #-30, r0
+rts
+clr r1
+cmp L291, r5
+jsr L54
+L10: cmp r2, r1
+L11: rts
+rts
+stop
+add r6, L213
+L12: not L78
+; comment
+L13: .data -95, -782, -335, -319, -385, -743
+red *r3
+jsr L135
+L14: dec L61
+not L92
+L15: stop
+cmp #160, *r2
+rts
+not r1
+L16: clr r1
+rts
+L17: dec r4
+jsr *r5
+mov *r4, *r7
+cmp L275, L110
+L18: prn r0
+rts
+not *r1
+red L336
+L19: jmp L278
+mov L183, *r2
+red *r7
+L20: sub #-151, L204
+inc L205
+lea L136, *r0
+; comment
+L21: stop
+clr L185
+L22: sub #116, *r4
+L23: add *r7, L192
+L24: prn #47
+L25: bne *r7
+red L39
+L26: add *r5, r3
+; comment
+stop
+cmp r0, r5
+L27: rts
+inc *r3
+lea L286, r5
+stop
+L28: clr *r2
+rts
+not L195
+mov #-252, *r4
+L29: jsr L45
+L30: jsr *r2
+jsr *r2
+red *r2
+jsr *r1
+not r0
+L31: .string "lfyrpaxgcs"
+sub r3, r4
+L32: prn r2
+inc L278
+L33: sub r3, r3
+stop
+mov *r5, r2
+lea L55, r4
+L34: prn L270
+
+clr r4
+clr r6
+lea L246, L162
+L35: jsr L116
+rts
+; comment
+red r4
+L36: .data -180, -178, 579, 837, -840, 547
+dec r3
+bne *r0
+L37: mov #-124, *r1
+prn L108
+sub *r3, L72
+L38: add *r0, *r1
+L39: .data 271, -535, 794, 498, 245
+sub L102, *r1
+L40: prn L128
+L41: rts
+bne *r4
+stop
+L42: rts
+mov *r3, *r0
+stop
+L43: clr *r4
+L44: inc *r6
+lea L294, *r2
+rts
+jmp L180
+lea L185, r5
+cmp L202, r3
+L45: prn r0
+add L192, L160
+not *r2
+add #13, *r1
+mov L100, L219
+prn L194
+L46: lea L131, r5
+bne *r7
+jmp *r4
+L47: .string "kchejpp"
+dec r6
+mov #-114, *r3
+L48: stop
+inc L129
+add r7, r3
+lea L300, L327
+L49: .data -489
+L50: bne L269
+L51: prn #-135
+mov #-124, L187
+stop
+not r2
+lea L100, L111
+L52: dec L73
+rts
+rts
+jmp L226
+clr r0
+stop
+L53: .string "esjikygucsxcjfhscj"
+stop
+clr L177
+clr r1
+mov #115, r7
+L54: jsr L186
+L55: sub #6, *r3
+sub L155, *r3
+dec *r6
+dec L318
+rts
+dec r5
+dec r6
+L56: add L330, r0
+L57: .string "beybzofvcuj"
+bne *r7
+L58: stop
+jmp L250
+
+sub *r5, r2
+lea L142, *r1
+L59: lea L60, r4
+inc *r5
+add *r5, *r2
+not *r6
+
+rts
+L60: .string "eil"
+L61: lea L308, L136
+red *r7
+stop
+sub L171, r1
+prn #-94
+dec L120
+inc L205
+not *r1
+L62: sub #51, L299
+jsr L210
+prn r2
+L63: inc r4
+rts
+L64: rts
+L65: clr r6
+L66: add L282, *r6
+red *r1
+clr r4
+clr L269
+jmp *r5
+L67: .data -678, 657, -185, 722, -807
+sub L291, r6
+dec L158
+sub r7, L257
+jsr L281
+cmp #-226, *r5
+L68: .data 474, 848, -414, -142, 35
+mov r4, L246
+sub L281, *r6
+sub *r3, L253
+mov *r7, r1
+L69: not L319
+dec r3
+red r5
+bne *r6
+L70: inc r5
+lea L305, L120
+dec r3
+rts
+dec *r6
+mov *r4, L180
+inc *r3
+L71: mov *r2, r3
+mov #40, L252
+L72: sub #-134, L201
+
+sub r6, L80
+prn r2
+L73: red r3
+not *r2
+cmp L276, L260
+dec L235
+lea L274, *r5
+red *r0
+L74: mov r4, *r3
+rts
+L75: not *r2
+lea L110, r1
+L76: dec L274
+inc r5
+bne L311
+jmp L321
+clr *r1
+L77: sub L174, r3
+L78: .string "mmdvkgbdgy"
+sub #-65, r2
+bne L112
+mov #167, r1
+inc L163
+bne *r3
+prn L193
+rts
+lea L193, r1
+rts
+jsr *r1
+bne L288
+dec *r4
+jmp *r7
+cmp r4, r5
+red L109
+L79: lea L138, L180
+red r7
+L80: .data -413, 86, -321, -29
+L81: jmp *r5
+add r7, *r2
+L82: stop
+bne *r2
+sub *r2, *r3
+L83: rts
+inc r7
+sub #-18, *r2
+clr r5
+
+L84: not r5
+L85: red L242
+inc r3
+lea L258, *r1
+; comment
+L86: dec r2
+L87: .data -58, -992, -226
+prn L212
+L88: prn #169
+inc *r2
+L89: prn r1
+rts
+prn L255
+L90: .string "of"
+L91: not *r1
+L92: .string "q"
+L93: clr r4
+L94: bne *r6
+L95: .data -516, 70, 750, 471, 30, -334, 38, 502
+L96: cmp L258, *r4
+
+L97: red *r1
+mov L217, L219
+L98: stop
+jmp L336
+red *r1
+L99: bne *r7
+rts
+
+prn L130
+mov #-72, *r4
+; comment
+lea L223, r2
+L100: red L275
+clr *r1
+not *r2
+dec L255
+L101: jmp L271
+
+; comment
+sub r3, r7
+jsr *r0
+red r2
+jsr *r1
+prn L181
+clr L242
+jsr L285
+L102: .string "xfcjhwpuqlmuksvj"
+L103: inc *r6
+L104: .data -358, 173, 970
+cmp *r4, #99
+inc *r1
+jsr *r2
+inc L322
+add r7, r1
+prn #85
+L105: .string "dhnhyyof"
+L106: dec *r4
+jsr L294
+L107: bne *r4
+L108: dec *r5
+L109: .string "ekqyspqncshzcjcchy"
+L110: lea L192, L334
+prn #125
+prn L275
+jmp L167
+L111: rts
+L112: sub L297, *r7
+jsr L245
+sub r4, *r1
+sub L133, L331
+rts
+red r4
+dec *r3
+inc *r6
+L113: dec L153
+lea L268, *r4
+cmp L304, L184
+L114: .data -299, -818, -175, -502, -460, 941
+bne L310
+bne *r5
+rts
+bne L328
+mov *r5, r5
+L115: .string "tulpxbwuchkdulxeiyvyxu"
+L116: clr L242
+lea L204, *r2
+stop
+L117: .string "iqleffrjhsqehwqyldqg"
+bne L287
+red *r1
+L118: dec r5
+L119: bne *r4
+mov r6, r2
+stop
+dec *r6
+mov #152, L240
+L120: lea L231, r3
+inc *r0
+L121: red L166
+L122: lea L312, r4
+; comment
+L123: jmp *r3
+L124: .data -867, 548, -574, 708, 177, -310, 453, 335
+jmp *r3
+dec L269
+mov *r4, r5
+lea L253, L194
+L125: jsr *r3
+
+L126: .data 365, -817
+L127: bne *r3
+clr r2
+cmp r2, #19
+L128: cmp #-202, r3
+jmp *r5
+L129: .string "tolpvzjfrj"
+L130: bne *r6
+clr r3
+jmp *r2
+not *r0
+L131: .string "velbzagalxuzncjcmh"
+L132: .data 866, -796, 471
+L133: prn L325
+prn L284
+L134: .string "jpwccmhcbswkcna"
+dec *r5
+cmp L139, *r2
+add r7, *r2
+lea L235, L315
+L135: .string "bgmlidaytoaluaodlhibzskm"
+L136: .data 144, 928, -209, 237
+L137: .data -799, -522, 276, 855, 466, -807
+sub r7, r2
+lea L168, *r3
+L138: add r3, r7
+mov L269, *r3
+L139: .string "hyaxvmjdrvibmgbqgntslzs"
+cmp L298, *r6
+stop
+cmp L210, #242
+L140: rts
+add #-126, L242
+L141: .string "elotdyhkrvbhkrypov"
+red L331
+prn #-91
+L142: .string "eznighexzfikjvgvr"
+
+; comment
+L143: add #-198, r2
+lea L150, L278
+dec *r3
+rts
+clr r6
+; comment
+cmp L162, r2
+prn L164
+L144: jsr *r4
+
+rts
+L145: .string "uouizqkkdqevufuyrxtucq"
+L146: .data 314, 635, 312, -987, -860, -142
+red L270
+rts
+L147: prn #116
+L148: jsr *r4
+L149: .data 938, -820, -965, -770, -164, -197, -993
+jsr L214
+add *r3, r7
+rts
+L150: stop
+L151: not L207
+L152: .string "dmzwb"
+L153: dec L309
+L154: .data 217, 119, 56, 513, -788, 32
+bne L200
+clr *r2
+dec L330
+lea L209, *r6
+L155: .string "afslqgbe"
+
+jmp L175
+L156: add #89, *r7
+L157: .string "sz"
+stop
+L158: .data -245, 873, -465
+cmp r0, *r1
+L159: cmp r4, #239
+dec r3
+bne L268
+L160: .data -484, 652, -22, -916, 160, 276, 214
+L161: red r1
+red L216
+stop
+L162: bne *r5
+inc L213
+L163: red *r2
+L164: rts
+L165: dec *r0
+L166: .string "kkzitktsfuyavozduhzunfo"
+L167: lea L306, r1
+rts
+add r5, *r1
+L168: .data -933, 242, -213, 870, 258
+inc L294
+L169: add L331, L324
+inc L263
+rts
+add *r4, L315
+sub *r6, *r1
+L170: lea L243, r2
+L171: rts
+sub #-35, r3
+add L211, r4
+L172: lea L291, r3
+L173: dec r5
+L174: .string "ptzaaewwzwohgzalbjriaq"
+stop
+cmp *r6, #56
+cmp *r2, #-246
+L175: jmp *r0
+rts
+L176: .data -256
+L177: sub #78, L241
+L178: dec *r3
+bne *r1
+red L309
+stop
+prn *r4
+red L196
+jmp L246
+add *r0, *r3
+L179: stop
+rts
+bne *r5
+jmp L293
+not *r4
+red *r6
+jsr *r5
+inc L270
+clr *r6
+L180: rts
+jsr L311
+L181: jsr *r2
+L182: add #254, r3
+bne *r2
+not *r3
+L183: jsr *r6
+add r2, *r7
+L184: dec r2
+mov #-254, r6
+L185: sub *r1, L290
+L186: .string "jzevbxnyhlbrncce"
+L187: cmp *r1, #70
+prn #186
+jsr *r1
+L188: .data -528, 834, 423, -140
+rts
+red r3
+L189: stop
+sub L281, r7
+dec *r6
+L190: not r5
+cmp L231, L295
+dec *r4
+jsr L229
+red r2
+L191: stop
+L192: add *r4, L333
+add r2, *r7
+L193: stop
+L194: jsr L237
+cmp r5, L322
+bne L209
+rts
+clr L275
+jsr *r7
+L195: .string "heycckmjkgyqph"
+L196: mov #75, *r4
+rts
+not r1
+add *r2, *r4
+not r7
+L197: .string "lhvoimhnseb"
+L198: add L212, *r2
+jmp L227
+L199: bne L222
+L200: .string "im"
+add L260, *r0
+clr r7
+
+cmp r5, #250
+L201: .string "naqstaodhunij"
+L202: dec r1
+red *r4
+L203: not L278
+clr *r7
+L204: .string "sokmevnjzxvrpmkudst"
+lea L307, *r6
+jmp L315
+dec *r3
+L205: rts
+rts
+L206: jsr *r2
+L207: inc *r6
+L208: stop
+L209: .string "yxklvwdh"
+L210: dec *r1
+cmp #141, r4
+bne *r7
+inc *r4
+dec L332
+prn r3
+jmp *r1
+cmp *r0, #-228
+L211: clr r1
+jmp *r0
+mov *r1, L317
+dec *r5
+bne *r0
+clr r0
+lea L316, L254
+prn L241
+dec L234
+rts
+add L242, L332
+L212: dec r7
+red *r5
+L213: red *r3
+lea L259, r2
+L214: .data -441
+L215: jsr *r3
+L216: .string "zsg"
+L217: red r6
+jsr *r3
+L218: stop
+prn *r5
+mov *r1, *r5
+not L221
+jmp L320
+jmp L239
+L219: .data 989, -545, -399, -695, -4, -657, 189
+L220: cmp *r3, L253
+L221: mov L247, r0
+clr *r2
+bne L290
+L222: bne L262
+not r3
+mov r4, *r7
+lea L316, *r0
+dec r5
+bne L319
+L223: dec *r0
+rts
+red r2
+mov #-82, r2
+cmp r6, r5
+dec r1
+L224: jmp L283
+dec L283
+mov *r4, L258
+stop
+
+lea L307, r7
+sub #133, *r1
+L225: mov L295, L337
+add *r7, *r3
+cmp *r5, *r3
+dec L270
+L226: clr L267
+red *r1
+prn r3
+dec L297
+jsr *r1
+L227: add L319, *r7
+sub L302, r0
+bne L251
+; comment
+lea L317, r5
+lea L259, L264
+mov *r6, *r0
+L228: jsr *r6
+jmp L235
+
+add #129, L280
+add *r7, L326
+rts
+L229: .string "vfjdzapt"
+prn L279
+clr *r6
+mov #-223, r1
+cmp L301, L287
+clr L336
+red *r6
+L230: rts
+; comment
+prn #-191
+prn r6
+mov #-245, r0
+L231: inc r7
+L232: inc L309
+stop
+; comment
+inc r2
+sub *r1, L250
+L233: .data 457, -820, 530
+rts
+L234: rts
+jmp *r5
+L235: rts
+sub #-248, r0
+not L320
+L236: rts
+L237: prn r2
+inc r1
+prn *r1
+L238: mov L271, *r6
+rts
+L239: mov r3, *r5
+L240: add *r0, *r3
+
+mov #-66, L308
+L241: rts
+L242: prn r2
+dec *r5
+jsr *r5
+mov #122, L285
+L243: jmp *r0
+mov *r7, *r4
+L244: cmp *r7, L333
+inc r1
+cmp #-139, L256
+prn *r3
+L245: prn #55
+L246: stop
+cmp #91, *r6
+jsr *r2
+; comment
+jmp L251
+lea L309, L249
+; comment
+L247: .data 876, -70, 744, 246
+sub *r1, *r6
+bne L305
+; comment
+not r6
+L248: .data -933, 698, 512, 674, -742, 864, -382
+sub *r7, L280
+dec r2
+clr L260
+stop
+L249: .data -483, 920, 326, 525, 436, 715, 619
+add #-115, L296
+jmp *r0
+L250: lea L308, L322
+L251: lea L281, *r6
+L252: inc L285
+dec r2
+jmp *r1
+; comment
+dec r7
+rts
+sub r5, *r2
+cmp r6, *r7
+clr L272
+; comment
+
+; comment
+bne L333
+prn #56
+L253: jmp L268
+L254: .data -732, 661, 214, 680
+L255: .data -328, -762
+inc *r6
+L256: prn #55
+add *r5, r5
+clr *r5
+inc *r0
+L257: sub #24, L332
+L258: lea L321, r3
+red *r1
+mov *r6, *r4
+L259: .string "hwlwjvkmjjejhxgaxqilw"
+clr r5
+dec *r2
+L260: jmp *r7
+bne *r0
+cmp r6, #-129
+L261: .data 10
+L262: stop
+stop
+L263: stop
+not r6
+add *r3, L335
+clr *r5
+not r3
+L264: sub r2, r0
+dec L319
+L265: stop
+L266: .string "zzktsvlqojwjtogvowexbjg"
+add L331, r4
+mov L319, r2
+L267: .data 974, 410
+rts
+L268: mov *r3, *r4
+L269: .string "lyajfcbdwoufjawlbrb"
+cmp L337, *r4
+jmp *r3
+bne L329
+L270: clr *r2
+not r4
+stop
+L271: dec r6
+inc r1
+bne L334
+dec L282
+red *r6
+sub *r7, *r6
+L272: .string "kjdzv"
+not *r6
+bne L281
+dec *r6
+sub L336, *r7
+L273: .data -233, 26, -779, 587, 852, 201, 379, 42
+L274: .data 209, -580, -772, 247, -923, -899, -457, -796
+mov #-28, r7
+add *r6, *r5
+L275: jmp L323
+; comment
+add L319, r3
+sub *r6, r1
+red L297
+sub r1, L284
+not *r0
+L276: jsr L289
+dec *r5
+not r3
+jsr *r6
+lea L305, L282
+sub r2, r5
+L277: dec L307
+L278: clr *r3
+
+stop
+L279: prn r7
+clr r4
+inc r6
+prn *r3
+clr L324
+rts
+L280: not L293
+prn r2
+inc r6
+add *r3, L334
+L281: sub *r1, *r5
+
+bne *r6
+red r4
+L282: dec L302
+L283: dec *r7
+jsr *r5
+L284: .data -472, -246
+not *r1
+inc r4
+clr r4
+L285: lea L301, L305
+
+rts
+bne *r2
+L286: not L325
+prn *r7
+L287: inc r5
+L288: .string "cxpqrttakyjmu"
+L289: cmp #45, #18
+mov *r1, L307
+mov r5, L299
+jsr *r5
+L290: dec *r6
+L291: .string "ytwltdhlccwjgznjtapuyn"
+L292: .string "tyosptxmvyzar"
+L293: bne L319
+rts
+red *r3
+L294: stop
+red *r4
+cmp *r6, L298
+; comment
+L295: dec r6
+cmp r7, r1
+L296: jsr L305
+L297: add L336, *r4
+L298: cmp r7, #142
+L299: mov L329, r6
+not L327
+lea L321, L324
+jmp L336
+stop
+clr *r7
+stop
+lea L323, r1
+L300: jsr *r1
+dec *r7
+; comment
+bne L324
+prn L336
+L301: .data -365, 265, 520, -256, 320, -882, -653, 967
+L302: .data 675, 464, -403, 556, 316, -38
+not L317
+bne *r3
+L303: .string "turdhheejwxtlkgra"
+add #56, *r1
+; comment
+stop
+add r4, *r0
+jmp L320
+L304: prn *r3
+jmp *r0
+not *r7
+L305: bne *r4
+sub r3, *r3
+jsr *r3
+L306: rts
+red *r1
+jmp L321
+L307: prn L309
+rts
+inc L337
+clr *r4
+clr r0
+
+prn r7
+jsr *r5
+add r6, r0
+sub L335, L337
+L308: .string "jmbwrockgrjrurhvcojlmku"
+add *r1, L320
+clr *r2
+dec r7
+
+lea L314, r7
+not *r7
+L309: .string "rbcsib"
+sub r1, *r6
+L310: mov *r2, L334
+L311: dec L329
+L312: .string "hapnmdgyrmotuvjhm"
+clr L328
+
+jsr *r6
+L313: mov L323, L319
+cmp L321, L320
+L314: .string "qxrtmp"
+; comment
+inc r5
+jmp L335
+bne *r6
+jmp *r6
+L315: .string "lrmbj"
+add #-107, r7
+sub L318, *r0
+prn *r6
+sub r2, r6
+jsr *r5
+jsr L317
+dec r5
+mov r5, *r4
+jmp *r7
+prn #-208
+L316: sub r2, r3
+mov L321, r4
+not *r3
+add #-181, L333
+lea L319, L337
+L317: clr L321
+jmp *r3
+jsr L330
+L318: .data 775, 904, -603, 578, 903
+red L320
+L319: .data -962, 932, 925, -55, -698, -418, -909
+L320: clr r1
+L321: add *r2, L332
+L322: jmp L325
+stop
+L323: .data 300, -412, -25, 339, 54, -887
+L324: inc r3
+stop
+not L331
+L325: stop
+cmp *r4, *r2
+L326: clr L336
+add #146, *r7
+cmp #50, #-90
+inc r6
+lea L330, L330
+L327: add L337, L330
+cmp r3, r3
+L328: dec L337
+stop
+L329: prn L332
+lea L336, *r4
+jmp L333
+rts
+L330: red r7
+L331: .string "xothqfkatcpxoszftss"
+jsr *r6
+add #207, r2
+L332: jsr L337
+L333: mov L336, r3
+add *r5, r0
+bne L337
+
+stop
+L334: clr L336
+add #251, L335
+L335: dec L336
+sub L337, *r3
+L336: lea L337, L337
+L337: add L80, r5
+sub r2, L35
+stop
+not r3
+stop
@@ -0,0 +1,1026 @@
+; Generated by genCorpus --seed 18
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+inc *r1
+L0: .string "yjilexqsymnfbwynxw"
+sub #-152, r7
+inc *r6
+jsr L367
+jmp L147
+jmp L294
+L1: .string "gcqlibhodre"
+sub r0, r2
+L2: clr L65
+stop
+not r7
+mov #-148, *r4
+jsr *r0
+stop
+add *r2, *r3
+inc *r2
+lea L228, L58
+not L276
+prn L149
+rts
+not L180
+mov r6, *r2
+add r2, r2
+bne *r5
+clr r7
+dec r7
+
+add L258, r1
+L3: inc *r4
+prn #-191
+L4: prn L25
+lea L210, L290
+lea L314, L72
+L5: lea L201, *r2
+prn r4
+L6: .string "nzewzmusp"
+L7: not *r0
+L8: cmp L99, r6
+lea L343, *r0
+L9: .string "rqunsxwu"
+L10: jmp *r1
+jmp *r5
+inc r5
+inc r5
+L11: .string "sfnkkpppohsgokqfpmznocxp"
+L12: bne L362
+mov r6, r5
+jmp *r4
+dec L21
+stop
+sub L187, L212
+L13: lea L243, *r6
+inc *r3
+L14: clr r1
+dec L341
+L15: red r2
+L16: sub #75, *r5
+cmp #207, *r2
+add L106, *r6
+rts
+L17: jmp L55
+L18: .data -667
+inc r2
+L19: bne *r4
+stop
+red r7
+
+red *r5
+jmp L120
+cmp *r7, *r6
+L20: prn #179
+L21: lea L200, r1
+dec L243
+mov *r3, L286
+L22: jsr L363
+lea L61, r5
+rts
+L23: jsr L90
+L24: jmp *r6
+jmp *r1
+L25: red r7
+clr *r2
+L26: stop
+L27: cmp *r5, *r1
+clr r5
+L28: stop
+lea L319, L158
+L29: not r7
+; comment
+L30: .string "lflrfzjo"
+L31: rts
+rts
+sub *r1, *r6
+inc L348
+sub L317, r4
+L32: inc r4
+cmp L97, *r5
+jsr *r0
+clr L249
+L33: jmp *r0
+dec r2
+rts
+
+L34: clr L124
+L35: bne *r0
+bne L260
+L36: dec r1
+rts
+stop
+add r1, L52
+L37: inc *r2
+L38: rts
+L39: bne L269
+dec L302
+inc r7
+add #-30, r6
+jsr L140
+prn r5
+sub *r2, *r3
+add *r2, r1
+clr *r2
+inc L261
+L40: prn L195
+stop
+jsr *r0
+mov r4, L264
+jsr *r3
+L41: dec *r5
+red *r6
+red r1
+L42: prn L301
+cmp r4, L329
+L43: jsr L357
+inc *r0
+mov *r5, L126
+not r7
+cmp L72, *r1
+L44: sub L83, r0
+prn L311
+
+bne *r4
+prn L260
+dec L183
+prn L292
+stop
+L45: lea L95, r2
+rts
+lea L255, L265
+inc *r1
+L46: sub #198, L240
+L47: jmp *r3
+bne *r2
+L48: not *r0
+L49: clr *r3
+L50: jmp L327
+jsr *r7
+red L331
+L51: red *r7
+rts
+L52: inc r7
+cmp L266, #-255
+L53: .data -854, 812, -236
+stop
+bne L54
+not r3
+prn r7
+lea L137, L114
+sub r7, *r4
+cmp #-254, L370
+
+mov L139, r2
+L54: lea L350, r2
+L55: red r3
+stop
+
+L56: stop
+L57: .string "jlfexzcitmvkohwr"
+L58: inc *r6
+not L90
+red L362
+cmp *r3, *r6
+clr L236
+; comment
+bne L339
+inc r5
+L59: prn #-185
+lea L209, r4
+red *r1
+cmp L102, r5
+inc L186
+L60: .data -693, -7
+clr *r6
+L61: .data 104, 431, 916, -382
+lea L247, *r4
+L62: prn *r1
+L63: jsr *r0
+L64: jmp *r4
+L65: .string "wkjkcaget"
+not *r4
+add #-237, *r5
+jsr *r4
+L66: not r0
+L67: dec L97
+L68: .data -837, 563, -325
+inc r3
+sub #14, r5
+L69: clr *r2
+L70: bne *r4
+not L212
+sub *r6, r2
+L71: mov L297, r6
+rts
+L72: .data -425, -959, -369, -431, 786, -993
+L73: jsr L342
+sub #-150, r5
+L74: dec L231
+clr *r5
+L75: jsr L352
+stop
+bne *r4
+; comment
+L76: cmp L285, L83
+lea L132, *r1
+L77: .data -820, -163, 641
+inc *r5
+add #-118, r6
+L78: dec r4
+bne L261
+prn #-222
+L79: .string "jeackbdwudzbscnkvp"
+L80: add *r2, r1
+dec L117
+L81: .string "v"
+jmp *r5
+cmp *r4, L321
+bne *r1
+L82: lea L107, r0
+not L315
+
+stop
+add *r5, r3
+sub L208, r1
+rts
+rts
+
+L83: lea L209, r7
+jmp *r4
+prn #81
+L84: prn *r5
+jmp L202
+L85: red L271
+not L236
+L86: cmp *r3, *r4
+L87: .data 953, 467, 212, -159, -730, -192, 766, 17
+L88: inc r3
+L89: rts
+L90: prn L355
+; comment
+bne *r7
+sub L342, L338
+L91: .data 400, 870, 726, 979, -413
+L92: add #-87, r2
+L93: jmp *r5
+stop
+sub r2, *r4
+L94: add r1, r3
+L95: sub #151, r6
+jsr L302
+L96: mov *r1, L189
+L97: lea L327, *r0
+; comment
+L98: cmp #188, #-215
+clr L215
+L99: dec L364
+dec r5
+L100: .string "gfbtfjyoaxwzbhkeuzrimk"
+L101: cmp r4, r7
+inc L318
+L102: .string "llnqkpnglfghvk"
+lea L213, r2
+L103: .string "mrvquhetgroxarsguf"
+
+L104: bne L200
+jmp *r7
+L105: sub #-162, r0
+L106: .string "ozwwbewaqudhldarnirouici"
+; comment
+prn *r7
+L107: lea L260, *r3
+rts
+red r6
+bne L122
+prn L116
+jsr *r1
+lea L286, L252
+not L332
+prn #214
+L108: lea L195, L128
+L109: clr *r3
+cmp r5, r5
+red r4
+jsr *r5
+jmp *r6
+add *r5, L255
+L110: .string "hwjcpbip"
+stop
+rts
+L111: red *r3
+L112: red L134
+L113: bne L271
+sub *r6, *r4
+
+jmp *r4
+red r4
+rts
+jmp L266
+L114: .data 921, 408, -699, -647, -534, 387, 629, 99
+L115: cmp *r0, *r2
+stop
+not r7
+dec r4
+L116: .data 15, -979, 862, -633, 377, 242, 728, -59
+L117: prn L250
+add #-251, L315
+lea L137, *r6
+dec L187
+; comment
+jsr L165
+not *r7
+L118: stop
+L119: jmp *r0
+dec L193
+clr r5
+inc L224
+L120: .string "feeizqhfydjec"
+L121: .data 757, -762, 996, 108, 250
+jsr *r7
+L122: .string "dobmknfa"
+lea L305, *r4
+L123: .string "u"
+L124: add *r2, r5
+L125: red *r6
+L126: not *r0
+dec r2
+L127: .data -40, -292, -941, 798, -832, -222
+L128: red L279
+stop
+L129: .string "q"
+L130: red L132
+L131: .string "yipbuiupzdxae"
+rts
+L132: rts
+bne L271
+not *r4
+rts
+not *r0
+mov #106, r4
+jmp *r3
+L133: cmp *r0, #-226
+L134: jsr L196
+L135: inc *r0
+L136: .string "tmmdcvfwtoxjclcxmv"
+rts
+L137: clr *r3
+L138: inc *r2
+
+L139: .data -766, -535, 970, -58, 744, 963, -197
+clr *r0
+stop
+L140: prn #-213
+dec L186
+L141: jmp *r2
+; comment
+bne L355
+L142: cmp r1, r6
+inc r4
+lea L159, r0
+L143: .data 269, -700, 303, -491, -608
+inc *r2
+L144: prn #-88
+cmp L274, *r6
+bne L336
+jsr *r1
+add r3, r3
+L145: jsr L310
+L146: add r1, *r5
+L147: sub *r4, *r6
+L148: jsr *r0
+prn *r5
+prn #-41
+L149: inc L275
+L150: rts
+mov L325, r7
+L151: .data 811, 748
+jsr L350
+clr L310
+L152: mov *r6, *r7
+lea L314, L166
+L153: dec *r7
+L154: .data -346, -376, -116, -6, -525, 863
+L155: bne L181
+sub *r5, r5
+L156: add *r1, L183
+L157: add L375, *r2
+lea L308, *r1
+L158: .string "hcopnzsnxup"
+L159: bne *r3
+L160: .string "ovpeeoooottkutpg"
+clr *r0
+L161: lea L178, *r0
+L162: clr r2
+rts
+jsr *r5
+clr r3
+L163: prn r7
+L164: lea L365, *r0
+; comment
+red r7
+cmp r6, #253
+cmp #185, #-90
+clr *r0
+rts
+sub r4, L267
+rts
+bne L249
+L165: rts
+lea L198, r4
+not L369
+cmp r3, L352
+rts
+mov #-191, L334
+
+dec L344
+prn r2
+cmp L281, *r5
+sub #-137, L325
+add *r6, r0
+prn r7
+
+stop
+L166: .string "iloyixsl"
+jsr L206
+L167: .data -528, -972, 0, -580, 436
+lea L217, r3
+mov #-58, *r7
+L168: bne L343
+red *r0
+mov *r3, r1
+inc r2
+L169: dec r4
+dec *r1
+L170: jmp L357
+L171: jsr *r6
+L172: dec L209
+sub L232, *r1
+red *r6
+L173: clr L294
+L174: prn r7
+bne *r6
+lea L307, r5
+L175: dec L226
+inc L178
+
+stop
+jsr *r1
+L176: .string "efh"
+jmp *r2
+jsr L353
+stop
+L177: mov *r1, *r3
+mov L233, *r3
+not *r2
+L178: .string "lvdayxapkeicqqxdalill"
+jsr *r5
+jsr *r2
+L179: cmp r7, *r5
+cmp r3, #-200
+L180: .data 821, 282, -682, 43, 615, -692, 682, 993
+red L360
+cmp r3, #148
+not *r4
+L181: add L374, r5
+mov *r2, *r7
+jmp *r3
+mov #10, *r2
+jsr *r0
+lea L243, *r1
+clr r0
+L182: stop
+L183: .string "oegqndfsuqpohvu"
+L184: .data 114, 859
+L185: rts
+rts
+L186: red *r6
+jmp L370
+bne *r0
+prn r6
+prn *r0
+sub r3, *r4
+L187: .data 876, 736, 476, -138
+lea L361, L289
+red L199
+L188: prn #-31
+bne *r7
+sub #-34, r7
+L189: sub #72, L252
+L190: add L338, *r4
+L191: .data -868
+not L335
+
+add #-239, r1
+jmp *r3
+prn #-12
+jsr L286
+L192: .string "hqrjego"
+sub r3, r5
+
+sub #-15, L259
+L193: jsr *r1
+L194: jsr L369
+clr r1
+L195: dec L294
+L196: lea L223, L292
+L197: inc L280
+inc r1
+L198: dec *r6
+L199: .string "hqiat"
+not r5
+mov L371, L272
+jmp L303
+inc r0
+stop
+dec L320
+jmp L357
+L200: add *r3, r1
+inc L203
+mov #156, L259
+L201: lea L289, *r7
+L202: clr *r2
+stop
+L203: stop
+sub #-166, r1
+bne L242
+inc L274
+L204: .string "hxsl"
+jsr L340
+L205: .data -59
+bne *r3
+rts
+not L277
+L206: stop
+L207: inc r6
+jmp L371
+stop
+L208: sub L231, *r4
+not r7
+lea L248, r4
+
+L209: prn #132
+add *r5, L309
+jmp *r2
+sub r7, L233
+L210: stop
+add #-38, *r4
+inc r3
+mov #75, *r4
+L211: jsr *r4
+L212: red r2
+L213: .data -265, -434, -304, 825, 289, 824, 735
+L214: dec r6
+L215: .data 690
+inc *r5
+clr *r3
+L216: not L255
+bne L246
+L217: rts
+L218: .string "bbmgqmxero"
+stop
+stop
+L219: .data 620, 215, -411, -551
+mov *r3, r4
+stop
+lea L254, r4
+jmp L272
+L220: .data -980, -889, -960, 736
+L221: prn *r4
+cmp r2, r1
+jsr *r0
+jmp L251
+L222: bne *r6
+L223: jmp L317
+add r1, r3
+mov *r5, L337
+dec L291
+L224: .string "fkxidrtuj"
+L225: lea L290, *r5
+L226: clr r7
+cmp r7, *r5
+inc *r2
+add r1, L359
+lea L292, r5
+jsr L241
+add L312, r2
+lea L308, L266
+sub L342, r5
+L227: rts
+mov r2, r6
+add #-96, *r1
+prn L296
+not *r1
+not L362
+L228: rts
+jmp L332
+L229: .string "rhhiljlzwhfphns"
+L230: .data -147, -820, 223, -91
+lea L347, r2
+cmp #125, #-8
+rts
+L231: .string "dbbvvrismndno"
+rts
+jsr *r0
+jsr L285
+red *r5
+jmp L282
+inc r5
+dec L329
+not L374
+sub L373, r5
+red r3
+L232: jmp *r3
+; comment
+prn L337
+
+L233: .data 672, 178, -745, 384, 938, 384
+clr r5
+not *r3
+L234: stop
+clr r2
+L235: lea L326, r7
+add r7, r1
+jsr *r6
+prn L349
+mov *r1, r4
+L236: .data 260, 144, -373, -537, 23, -125
+prn #241
+L237: rts
+cmp #174, *r3
+L238: inc r4
+not r4
+cmp r5, #249
+not r4
+L239: clr *r0
+L240: red *r1
+not *r7
+clr r1
+add *r1, *r4
+clr *r4
+red *r7
+L241: .data -816, -487, -804, -19, 483
+jsr L317
+dec *r5
+red r3
+mov r1, L276
+L242: sub r6, L251
+L243: not L342
+not r1
+L244: .string "bbibolglpbedaosqll"
+stop
+jmp *r4
+clr r4
+add L338, L360
+dec r1
+lea L343, r4
+; comment
+L245: not L284
+L246: lea L337, r6
+jsr L315
+add *r0, *r4
+L247: .string "wqaxkqgk"
+lea L348, r0
+clr r1
+L248: not *r1
+prn #-237
+jmp *r3
+
+stop
+mov L357, L305
+mov r2, r3
+L249: bne *r2
+L250: not L291
+; comment
+jmp *r7
+cmp #123, L360
+L251: .data 102
+cmp #-97, L319
+L252: inc L256
+dec r2
+L253: stop
+L254: jsr *r3
+; comment
+L255: .string "tzuhhknalqlky"
+L256: rts
+L257: lea L270, *r4
+L258: red r0
+red L272
+L259: mov #34, L264
+cmp L335, L333
+rts
+inc *r3
+L260: .string "okgzeia"
+bne *r2
+
+L261: lea L262, r1
+bne L306
+lea L269, r4
+L262: cmp L375, *r7
+L263: dec L271
+cmp r7, *r6
+jmp *r5
+L264: jmp *r5
+red *r4
+L265: not *r4
+jmp *r3
+dec r2
+L266: add #207, r0
+lea L342, *r5
+prn L280
+jmp *r2
+cmp r7, #-151
+stop
+L267: jsr *r4
+L268: not *r7
+L269: add L302, L276
+L270: mov r6, L321
+inc *r3
+inc L276
+prn L309
+sub #-185, *r4
+stop
+mov r7, r2
+L271: bne L341
+L272: add *r0, *r1
+L273: stop
+L274: lea L276, *r5
+lea L297, L342
+add *r6, *r6
+L275: .data -330, -836
+inc L375
+sub *r5, r2
+
+add *r0, *r5
+clr L335
+L276: .data -101, -730, -987, -299, 320, 25, -476, -692
+jmp *r4
+inc r2
+inc r6
+
+L277: red r1
+dec L296
+not L361
+cmp r2, #-102
+add L279, *r0
+L278: dec L306
+L279: mov #-193, L370
+L280: red L352
+add r4, *r3
+clr *r0
+L281: inc r4
+L282: .data 370, -907, 940
+
+dec *r3
+clr L324
+dec r4
+jmp L288
+L283: prn *r6
+L284: mov #100, *r5
+not *r1
+L285: rts
+L286: .data -858, -158, 656, -158, 100
+L287: .data -369, -270, 76, -498, 629, 422
+mov *r1, L320
+L288: .string "hviybsbwyzpljyw"
+cmp r3, #105
+cmp r3, *r2
+jmp L315
+L289: not L294
+add r0, r7
+dec L349
+inc r0
+L290: .data 265, 407, -203, 342, -784, -309, 758, 1
+prn *r6
+L291: .data -459, 603, 608, 155, 549, 238
+L292: prn *r4
+stop
+red L309
+mov L317, r7
+L293: prn r7
+L294: .data 128, 71, -78
+clr *r1
+mov #44, L367
+mov r3, r7
+rts
+clr r6
+sub r2, L353
+prn #-157
+mov *r3, L295
+bne *r2
+L295: stop
+inc L314
+add r6, L369
+mov #-182, *r7
+L296: cmp r6, *r1
+red L313
+prn L314
+rts
+not r5
+L297: not *r2
+L298: .string "wsutj"
+; comment
+dec r7
+L299: sub #7, L316
+L300: rts
+rts
+jsr L345
+clr L370
+sub *r3, r4
+sub L330, *r4
+L301: mov *r2, L371
+inc r2
+red L332
+prn #38
+L302: add #187, *r2
+L303: rts
+
+L304: cmp r1, r1
+
+L305: cmp r2, L347
+jsr *r5
+prn L311
+cmp #-162, r2
+clr r5
+add #31, L350
+prn r4
+L306: add L319, L335
+L307: add r1, *r4
+sub L331, L363
+bne *r5
+not *r3
+; comment
+clr L369
+clr L364
+L308: .string "artxadssvztfmtczedqdpnoi"
+; comment
+L309: sub r2, r4
+bne *r0
+L310: bne *r2
+lea L350, L350
+L311: rts
+L312: .data -275, -798, 630
+clr L343
+jsr L350
+L313: clr L337
+L314: .string "fu"
+; comment
+; comment
+L315: mov *r1, r4
+jsr L349
+jsr *r3
+L316: dec L357
+
+cmp #-186, r0
+L317: dec *r1
+add #-69, L362
+L318: rts
+jmp *r1
+red *r4
+L319: inc r6
+L320: prn *r5
+L321: .data -582, -244, 235
+L322: clr L357
+bne L328
+clr *r7
+L323: mov r4, r4
+dec r2
+L324: inc *r5
+not L355
+L325: lea L352, *r6
+sub r2, r5
+L326: lea L351, *r5
+lea L341, *r2
+L327: cmp L337, #-139
+
+red *r0
+prn r0
+mov r0, r2
+not *r0
+not *r6
+L328: add L352, r1
+prn r1
+L329: inc r4
+add *r1, *r4
+L330: add r0, r3
+L331: bne L359
+L332: red L362
+L333: .data 135, -872, 288, -475
+L334: .data 99
+jmp L349
+add *r5, r6
+L335: red r5
+add *r6, L351
+; comment
+L336: bne L349
+rts
+L337: stop
+L338: inc L356
+L339: not *r6
+L340: red L363
+jmp *r5
+lea L363, L375
+L341: mov r5, L357
+L342: sub r0, L352
+cmp r3, r6
+dec *r1
+not *r2
+prn L358
+sub r0, r1
+jsr L345
+add L366, r0
+sub *r7, *r4
+L343: cmp #156, #-219
+L344: bne L365
+jsr *r2
+L345: bne L361
+sub r3, L374
+L346: lea L366, r6
+L347: rts
+jsr L368
+L348: .string "xnvnzgzncwfmyjhfywordk"
+sub #224, L362
+clr *r6
+L349: cmp #-119, #41
+red r7
+prn r4
+L350: mov r0, r0
+L351: mov L366, r6
+
+add L353, r3
+red *r0
+stop
+red L363
+mov L352, L372
+L352: lea L361, L370
+clr r2
+L353: clr r4
+L354: not L373
+inc L366
+cmp L357, #-96
+L355: lea L368, L366
+L356: lea L365, *r1
+inc L358
+clr L369
+L357: dec L367
+L358: .string "rndiffyhlrfb"
+jsr L368
+L359: stop
+bne L366
+L360: cmp L362, #-159
+prn L364
+stop
+L361: sub r2, r7
+L362: prn L368
+red L367
+clr L368
+L363: .string "ckefmsmoexznqlodyzuo"
+L364: add #-66, *r5
+dec *r4
+mov *r3, L366
+L365: .data 161, -812, -44, -450, -973, -614, -468
+L366: jsr *r0
+dec L373
+red r3
+L367: red L370
+mov L373, r0
+sub r1, r2
+L368: red r3
+dec r5
+L369: mov r0, L371
+add L372, r6
+lea L375, L370
+L370: prn *r6
+L371: jmp *r0
+L372: .data -221, 2, 802
+not r0
+L373: lea L374, r7
+add *r3, r2
+L374: jmp *r6
+jsr L375
+L375: rts
+bne *r7
+stop
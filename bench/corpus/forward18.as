@@ -0,0 +1,1026 @@
+; Generated by genCorpus --seed 19
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+dec r1
+jsr *r5
+cmp #4, #-227
+not *r1
+L0: red *r2
+L1: stop
+L2: .data 542, 981, 691
+sub L35, r5
+; comment
+stop
+stop
+L3: prn L319
+add #5, L124
+dec L356
+stop
+jsr L275
+L4: prn *r3
+mov r7, L128
+L5: add #-64, L31
+L6: add r1, L261
+L7: .string "kblrp"
+add L363, r4
+L8: not *r3
+add L141, *r4
+red r1
+not L129
+L9: dec L226
+L10: dec *r3
+L11: prn *r5
+; comment
+rts
+cmp *r1, *r7
+dec r2
+L12: jsr L209
+jmp L296
+; comment
+red *r0
+red r6
+red r0
+dec L342
+L13: stop
+jmp L210
+not r5
+jsr L173
+cmp *r4, r5
+L14: jsr *r6
+L15: .data 195, 957, -735, -782, 814, -282, 650, 926
+L16: dec r5
+dec *r6
+L17: stop
+stop
+L18: jsr *r4
+L19: prn *r4
+L20: not *r1
+L21: inc *r4
+clr r4
+prn #-172
+clr r7
+L22: inc L250
+inc *r1
+L23: bne L194
+L24: red r4
+L25: dec r2
+L26: dec L198
+sub L294, r0
+L27: .data -149, 114, 277, -505, -766, 529, -751
+L28: stop
+stop
+bne L147
+L29: .data -438, -549, 388, 189, -587
+L30: mov *r4, L128
+
+red *r5
+stop
+L31: dec r2
+stop
+L32: .data 431, 390, -804, 864, -264, -678, 986
+jmp *r7
+clr r0
+L33: red r3
+inc *r5
+add #26, L195
+L34: cmp r6, r5
+sub #-132, *r0
+add L270, *r1
+L35: bne *r3
+L36: .string "qaaoidrlhihcy"
+rts
+rts
+stop
+jmp L136
+L37: .data 874, -192, -484, 440, -769, -5
+jmp *r4
+L38: clr r3
+mov *r0, *r7
+L39: .data -490, 971, 879, 964, 134, 35
+L40: .data -733, -978, -366, -79, -173, 48, -623
+L41: lea L49, r4
+L42: prn #-251
+L43: sub *r6, L137
+L44: add L215, r4
+L45: bne L234
+add *r5, L162
+L46: .string "oyovbxvix"
+L47: jmp *r7
+mov #143, *r3
+jmp *r0
+add r0, r6
+
+red r5
+lea L117, *r7
+jmp L183
+L48: sub #-133, L309
+
+not r1
+dec r1
+L49: mov *r2, r1
+
+add r7, *r7
+L50: jmp L302
+dec *r3
+add r3, *r4
+red *r0
+rts
+clr L65
+jsr *r3
+L51: .string "j"
+L52: .data 372, 898
+red L85
+not L78
+L53: red L56
+clr r7
+L54: clr *r4
+L55: .string "zlkcssiapnng"
+prn #21
+clr r1
+L56: red *r2
+L57: jsr L260
+jmp L131
+L58: dec L355
+cmp L194, *r7
+clr L106
+dec L228
+L59: dec L245
+; comment
+cmp r4, L254
+L60: .data -235, 260, -128, 847, -514
+add #-206, r0
+jmp *r1
+clr r7
+rts
+L61: jmp L113
+L62: prn #-204
+add r2, r6
+rts
+L63: jmp *r1
+; comment
+mov #143, L306
+mov *r2, r5
+red *r5
+inc *r7
+L64: .string "ajvpumnlygraloixfskd"
+rts
+L65: .data 377, -809, -250, 772, 188
+L66: not L370
+cmp *r4, #-192
+jmp *r5
+L67: inc L146
+; comment
+inc r7
+L68: inc L274
+; comment
+L69: jsr L133
+
+L70: jmp *r1
+L71: .string "oqmwhnznjaaiaqano"
+jsr L247
+L72: jmp L90
+L73: stop
+L74: jsr *r4
+L75: add L187, L282
+add r4, L117
+
+L76: .data 525, -64, 23, 463, 818, 304
+L77: cmp r3, L237
+not r6
+prn r4
+lea L205, L207
+clr r7
+prn *r3
+L78: mov *r3, *r1
+prn *r1
+dec r4
+rts
+stop
+lea L158, L153
+L79: jsr L220
+L80: add *r7, r2
+jsr *r5
+L81: stop
+L82: jmp *r3
+clr L106
+L83: add L280, r5
+L84: lea L270, L110
+bne L338
+L85: sub L112, r0
+prn #-236
+L86: jmp *r6
+stop
+inc r3
+inc r2
+rts
+L87: dec *r2
+cmp #-37, *r2
+stop
+rts
+inc L101
+jsr L173
+cmp L207, r0
+jsr L367
+jmp L90
+L88: stop
+L89: sub #57, *r3
+L90: add r2, L288
+mov L164, L195
+mov r5, L161
+add L126, r3
+dec r5
+sub L358, L305
+red *r2
+cmp L327, L309
+red r7
+lea L270, *r4
+prn #-162
+mov *r2, *r6
+rts
+L91: .string "qhwsybwdwtweuzghtjd"
+dec L221
+rts
+L92: .data -429, 75, 117, -670, -968, 350, -405
+sub #115, r6
+L93: .data -233, -874, -973, -871
+L94: jsr L195
+jmp *r7
+; comment
+jmp L141
+L95: .data 90, 846, 163, 388, -526
+stop
+inc L132
+red *r3
+sub #-239, *r0
+red L129
+lea L299, L251
+not r2
+jsr L273
+L96: lea L343, r7
+L97: cmp *r1, *r6
+stop
+
+; comment
+stop
+stop
+cmp #221, r7
+prn *r5
+dec r0
+stop
+jmp *r5
+jmp L120
+rts
+not L254
+L98: lea L262, *r7
+L99: jmp L146
+clr L162
+not r4
+cmp #-55, *r2
+L100: .string "lrxdspb"
+L101: stop
+L102: dec r1
+rts
+add r5, L124
+
+cmp r7, #-198
+stop
+prn *r5
+mov #-209, L215
+not *r1
+L103: .string "hqdmtpkdxeaflvnqapn"
+L104: .data 152, -866, -969, 432
+cmp L194, #-3
+inc *r5
+L105: bne *r3
+L106: red r7
+L107: clr r6
+sub r0, L271
+L108: jsr L135
+red *r2
+inc *r4
+mov #-99, L207
+inc *r6
+red r7
+L109: dec *r1
+cmp r0, #216
+L110: rts
+stop
+dec L346
+clr *r7
+L111: .data -915, -799, 9, -815
+L112: add r6, r3
+L113: add #65, *r4
+lea L276, *r5
+jmp L356
+L114: jmp *r5
+stop
+not L345
+L115: cmp r1, *r3
+L116: .data -858, -482, -504
+L117: dec *r5
+stop
+L118: jsr L287
+L119: lea L279, r6
+add L243, r4
+L120: clr r5
+L121: inc *r2
+prn *r2
+L122: jsr *r6
+jsr *r3
+add #-134, r0
+L123: .data -242, -642, 757
+inc *r3
+rts
+L124: inc r3
+L125: rts
+; comment
+L126: cmp L148, *r4
+rts
+not r4
+jsr L221
+bne *r3
+; comment
+mov L215, r3
+L127: stop
+L128: dec L200
+cmp r2, *r6
+L129: jsr *r0
+L130: inc L215
+L131: inc L321
+rts
+
+add #142, r3
+L132: inc L155
+prn *r3
+mov *r4, r6
+L133: dec r1
+cmp L250, r2
+stop
+mov r0, r6
+not *r3
+sub r1, *r6
+sub *r0, L154
+clr L262
+L134: add *r3, r0
+L135: bne *r0
+L136: rts
+cmp L171, L308
+L137: sub L297, r4
+bne L264
+L138: .data 422, 26, -841, -225, -189, 414, -217
+add *r3, r7
+L139: sub r4, r5
+add #-132, r4
+L140: stop
+not r3
+lea L313, *r7
+L141: dec L296
+prn L157
+L142: rts
+lea L295, *r3
+cmp #120, *r7
+inc L193
+L143: mov *r3, L180
+; comment
+sub r6, *r2
+stop
+L144: sub r5, r6
+sub #-236, *r1
+sub *r4, L170
+not L252
+L145: sub *r3, L181
+L146: dec L323
+prn #-126
+L147: cmp *r6, r0
+not r6
+L148: jsr *r2
+jmp L279
+L149: rts
+bne L195
+cmp #133, *r2
+jmp *r1
+L150: add r0, L218
+cmp r0, L282
+red r3
+stop
+
+dec *r4
+L151: .data 302, -296, 285, -798
+sub #-96, *r3
+
+L152: mov *r1, *r4
+inc *r7
+clr L262
+rts
+red r0
+; comment
+stop
+
+rts
+L153: sub r3, r4
+bne L263
+sub r5, r7
+jsr L172
+; comment
+rts
+jmp *r7
+L154: mov *r6, L358
+prn L336
+add *r7, L176
+L155: .data 152, -99, -319, 288, 622
+
+L156: add #99, L323
+L157: stop
+add r5, r3
+rts
+add L255, L322
+; comment
+dec L182
+L158: sub r2, r3
+
+prn r0
+lea L353, L248
+L159: rts
+jmp *r1
+L160: not L349
+sub L368, *r1
+clr *r2
+dec r0
+not r3
+mov r6, r4
+L161: prn #-107
+L162: mov *r7, r2
+jmp *r2
+
+L163: .string "mwaxxfctrpkp"
+sub L236, L338
+L164: not *r7
+inc *r3
+cmp *r5, L336
+jmp L281
+; comment
+mov L232, r5
+L165: jmp L368
+jsr *r7
+L166: clr r2
+inc *r2
+stop
+sub #-249, r1
+L167: not *r3
+; comment
+jmp L216
+not r5
+inc L217
+jmp L239
+L168: rts
+add *r7, L371
+L169: mov L178, *r2
+L170: dec *r5
+jsr L247
+clr r0
+red *r3
+
+add #246, r0
+dec r3
+jmp *r1
+L171: .string "uplyjhh"
+stop
+prn #-103
+L172: .data 272
+rts
+sub #130, r2
+mov L298, L231
+jsr L267
+prn #-169
+L173: stop
+L174: inc L264
+clr *r1
+inc L335
+L175: cmp L255, L273
+bne *r1
+inc *r1
+
+not *r1
+mov r2, L325
+L176: jmp L280
+L177: jmp *r6
+lea L225, r4
+add L193, r3
+cmp L307, #178
+L178: dec r2
+L179: cmp L293, #77
+lea L358, L358
+jsr *r6
+red *r5
+rts
+red L285
+clr r3
+bne L180
+sub L258, r4
+L180: lea L277, r6
+L181: dec r5
+L182: lea L199, r3
+red *r2
+mov L279, L230
+mov *r1, *r4
+clr r7
+L183: mov *r5, *r2
+L184: bne L344
+lea L215, L219
+inc *r7
+L185: dec r1
+L186: .string "wvrzojvte"
+sub L326, *r3
+mov *r0, r0
+mov r0, r6
+prn r5
+L187: jsr *r2
+L188: bne *r7
+L189: rts
+L190: mov #219, r0
+
+rts
+L191: dec *r3
+sub r4, L227
+
+L192: lea L331, *r6
+prn r3
+L193: jsr L219
+L194: rts
+sub L279, *r4
+mov #-206, L239
+cmp #-80, r7
+L195: .string "ernaezkbiszizvgxsoxmoo"
+
+L196: bne *r1
+clr L239
+jsr L368
+prn *r2
+stop
+L197: mov L362, *r3
+jmp L287
+L198: mov *r7, L282
+L199: sub #-12, L254
+L200: lea L263, L279
+mov L252, L305
+clr *r1
+sub #241, *r7
+lea L322, L248
+; comment
+rts
+L201: .string "qtrqxopluwbsodpvdvgote"
+L202: clr *r4
+L203: .data -739
+stop
+L204: .string "kxbzlbstxrkms"
+L205: prn L245
+cmp *r1, *r5
+rts
+jmp L363
+
+L206: .data 262, 398, 871, 487, -127, 909
+lea L309, L312
+L207: .data -185
+jsr L209
+L208: lea L228, L277
+inc *r2
+; comment
+L209: .data -976, -736, -733, -118, 953, 62, -964
+prn L247
+jmp L210
+prn L347
+L210: .string "nkxmvwrd"
+L211: .data 824, 308, 230
+L212: rts
+dec r7
+red r2
+jsr *r5
+dec L251
+sub r0, *r5
+L213: inc r3
+L214: rts
+clr r0
+dec r3
+clr L343
+lea L284, *r5
+not L218
+L215: prn *r3
+mov r6, *r5
+clr L258
+sub r2, r1
+lea L341, L313
+sub L251, r3
+L216: inc *r4
+L217: .string "rpmhqojunhovxfy"
+jmp L291
+L218: add #88, L340
+L219: jmp *r2
+prn L270
+L220: prn r5
+L221: bne L342
+L222: prn r7
+not r4
+add r6, *r3
+cmp *r5, L329
+add #72, L323
+L223: jsr *r4
+
+prn #-31
+inc r3
+not *r4
+L224: cmp r2, r7
+L225: prn r1
+L226: add L369, r4
+L227: cmp *r1, #110
+jsr L237
+L228: dec r2
+L229: inc r2
+dec r3
+L230: .data -643, -760, -937
+L231: jsr *r1
+stop
+cmp r1, L326
+lea L370, r5
+L232: .data 472, 430, -56, -869
+jmp L260
+L233: clr L259
+L234: cmp L292, r1
+L235: jmp L283
+L236: stop
+L237: cmp *r4, r6
+L238: cmp #-201, L318
+L239: .data -987, -787, 682
+prn *r0
+L240: inc L369
+dec L294
+; comment
+; comment
+L241: stop
+not r4
+prn r7
+clr L268
+L242: jsr L341
+stop
+cmp #246, L329
+; comment
+add #-199, *r5
+L243: cmp #178, *r3
+cmp #-246, r6
+
+dec r4
+L244: sub r5, r5
+L245: dec r7
+cmp #-256, *r6
+sub L298, r1
+L246: dec *r1
+clr r5
+L247: stop
+not r3
+cmp L317, *r7
+L248: red r3
+bne L350
+; comment
+L249: stop
+L250: rts
+L251: .string "qynsiycwrwfvzjzrsr"
+L252: not r7
+red r2
+L253: stop
+bne L278
+stop
+L254: clr *r7
+prn *r3
+rts
+lea L275, L255
+L255: not *r3
+inc L272
+clr L341
+stop
+bne *r0
+sub *r7, *r5
+lea L293, L322
+bne L342
+red L283
+cmp L338, r3
+not L279
+prn #156
+L256: cmp r3, r2
+L257: .string "vln"
+L258: jsr L367
+jmp *r1
+L259: jmp L320
+; comment
+L260: jsr *r5
+L261: .data 224, -289, 763, 676, 710
+L262: inc L264
+cmp r0, #-224
+prn #-13
+L263: not r1
+L264: cmp r5, *r0
+bne *r1
+sub L341, L267
+cmp L364, *r5
+bne *r4
+jmp L287
+rts
+rts
+L265: .data -68, -546, -835, -914
+L266: bne L323
+L267: lea L284, r4
+L268: stop
+red *r7
+stop
+L269: mov L309, L347
+inc *r0
+L270: .string "ndrzzzzjbjfnkmer"
+red r2
+L271: .data -998, -404, -270, 718, -449, 915, -39
+L272: cmp *r3, *r0
+L273: .string "dgr"
+L274: red *r6
+L275: .data 144, 269, -552, -12, -373, -205
+L276: .data -579, -822, -671, 853, 132
+add r6, r6
+dec r0
+inc L368
+L277: stop
+dec L362
+not L280
+L278: .string "um"
+L279: .data -255, 87, -392, 913, -317, 602
+jsr *r3
+L280: mov L318, r0
+L281: jsr L310
+L282: red r4
+inc r4
+add L359, r1
+L283: jmp L346
+L284: stop
+sub *r7, r6
+prn #-102
+L285: cmp r4, L358
+dec L361
+inc L347
+red L320
+sub #202, L364
+not L331
+add #235, *r7
+L286: lea L303, L354
+L287: mov #138, *r5
+mov #-112, r7
+lea L323, r7
+L288: .string "yjgsyjyajmm"
+L289: .string "vcdeusjnpgiz"
+L290: inc *r3
+clr r1
+sub *r5, L333
+; comment
+L291: .string "xk"
+cmp r5, #135
+L292: .string "tkdwrwxbzocpcsnbnojdje"
+dec L326
+prn r1
+L293: inc r1
+stop
+dec *r4
+lea L305, r4
+add #90, *r0
+bne *r4
+lea L328, r2
+L294: red *r3
+rts
+L295: .string "zyxvsuknpiib"
+dec r7
+bne *r3
+L296: jsr L370
+L297: lea L337, *r2
+jmp L360
+L298: .string "yahejjxk"
+jmp L316
+inc r2
+jsr *r1
+; comment
+L299: .data -678, -123, 438, 503, -892, 594, 729, -633
+L300: inc L347
+jmp *r4
+clr L316
+rts
+jsr L344
+add *r4, L358
+L301: .string "cg"
+mov #5, *r4
+mov #-119, r2
+jmp L326
+inc *r0
+L302: bne *r2
+L303: sub *r7, *r3
+L304: .data 975, -323, 177, -576, -43, 310, -538
+; comment
+mov r5, *r1
+not L344
+L305: red r6
+rts
+bne L336
+L306: clr r5
+; comment
+not r2
+dec r6
+; comment
+L307: jmp L327
+cmp *r1, *r1
+jmp *r1
+L308: lea L356, r6
+L309: inc L341
+lea L364, r2
+dec r2
+not L369
+add *r5, L329
+lea L351, r1
+L310: jsr *r1
+L311: prn #-67
+L312: clr L316
+
+rts
+add *r6, L316
+mov #-156, r1
+L313: cmp #203, r1
+L314: stop
+red *r0
+stop
+
+L315: not L369
+sub r5, L331
+clr L369
+L316: mov #4, L338
+red L343
+clr *r3
+L317: jsr *r2
+prn #227
+L318: mov #-88, r6
+jsr L336
+dec L322
+L319: .string "nxcycmmgvbgxiqws"
+L320: cmp #164, #-89
+prn L324
+L321: red *r0
+rts
+not L339
+dec r6
+cmp r1, *r1
+rts
+L322: sub *r5, r5
+L323: rts
+; comment
+L324: .data 960, -795, 706, 969
+bne *r3
+L325: .string "ul"
+L326: sub r2, L356
+red L346
+bne L356
+red L344
+inc L365
+L327: not *r4
+L328: lea L347, r6
+lea L343, L353
+sub #-165, L349
+mov L329, *r4
+bne *r0
+
+sub #244, L362
+red *r3
+red r5
+L329: jmp L345
+L330: jmp L347
+lea L366, *r3
+mov #247, L342
+jsr *r7
+L331: .string "sddtinz"
+rts
+lea L366, L346
+L332: rts
+prn L352
+not r5
+prn *r7
+prn #-168
+stop
+; comment
+jsr *r6
+L333: .data -478, -426, 22, -175, 950, -332, 842
+red r5
+mov *r2, *r6
+prn r2
+rts
+bne L364
+L334: mov r3, *r1
+L335: dec r7
+add *r7, *r4
+red L339
+L336: .data 853, 177
+inc *r2
+add r7, *r3
+bne L343
+L337: cmp #-96, r2
+L338: .string "bbgpxjamuco"
+bne L362
+L339: mov r1, *r2
+sub *r3, r0
+stop
+L340: lea L369, L343
+prn #46
+prn r1
+; comment
+L341: inc r3
+L342: red L345
+not r7
+prn r4
+dec L368
+jmp *r7
+L343: .string "ltiaqqbabkyvcbfxbtdoshz"
+sub #183, r6
+inc *r0
+L344: not L345
+jsr L365
+jmp L353
+L345: .data -273
+rts
+jsr *r2
+not L365
+; comment
+L346: mov #11, L347
+L347: sub *r3, r1
+L348: stop
+jsr *r5
+sub r6, r2
+L349: sub #185, *r2
+L350: .data 464, -969, 533, -300, -900, 735
+jsr *r1
+add L362, L370
+L351: jsr *r4
+jmp L365
+; comment
+not *r3
+jsr L362
+prn r2
+L352: inc r2
+L353: sub L362, r4
+L354: bne *r7
+L355: dec *r1
+clr r6
+cmp L365, r7
+rts
+prn *r1
+jsr L368
+L356: bne L367
+L357: add #218, r1
+jsr *r6
+L358: .data 310, -189
+cmp *r2, #10
+jmp L361
+cmp *r3, L371
+L359: jsr *r7
+mov #250, r7
+L360: bne *r7
+L361: add r1, L362
+rts
+L362: stop
+L363: lea L366, *r4
+not *r7
+L364: prn *r3
+not *r7
+L365: inc *r5
+prn r6
+L366: cmp *r5, *r6
+sub #236, r3
+L367: rts
+stop
+L368: jsr *r3
+L369: stop
+jmp L370
+stop
+L370: mov #-144, *r3
+cmp L371, r2
+red r5
+L371: .data -495, -883, -636, -472
+stop
@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 20
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: .string "ww"
+clr L17
+bne *r2
+L1: red r7
+prn r7
+prn r0
+lea L204, *r4
+L2: not L138
+clr *r0
+L3: rts
+L4: .data -219, -700, 112, 534, -250, 624, 522, 267
+L5: cmp r3, #-100
+jmp L144
+jmp L179
+; comment
+
+not L332
+L6: add *r0, L244
+lea L203, L184
+bne *r0
+L7: red L32
+bne L218
+stop
+prn *r3
+rts
+L8: not r1
+L9: mov #-29, L136
+jsr L183
+bne *r1
+L10: not L273
+add #-166, L124
+bne L14
+jsr L129
+sub L181, *r0
+dec *r4
+lea L132, r6
+L11: dec r5
+lea L182, r7
+
+prn L151
+inc r4
+L12: inc r6
+L13: stop
+L14: inc L35
+L15: mov L283, *r7
+not r3
+L16: .data -701, 844, -415, -265
+sub #-43, r1
+not *r0
+bne *r0
+L17: bne L331
+rts
+sub L297, r1
+jmp *r1
+prn r3
+inc r2
+L18: dec L106
+inc L336
+clr r6
+rts
+mov #-208, *r1
+lea L315, *r3
+rts
+not L229
+red L280
+jsr *r0
+L19: jsr *r1
+add *r3, r3
+jmp *r2
+dec L27
+L20: .data 62, -880, -159, 506, 495, 627
+inc L141
+jmp *r5
+dec r4
+L21: inc L149
+L22: add #231, r3
+stop
+stop
+L23: .data 507, -987, 808, 18, -789, -401, -275, -59
+cmp *r5, *r0
+L24: rts
+inc L282
+sub r1, r6
+lea L76, L199
+mov #48, L191
+; comment
+jsr L320
+L25: cmp #191, r0
+not r5
+L26: mov *r1, r4
+cmp *r4, *r2
+stop
+not r4
+dec r2
+; comment
+L27: jmp L84
+L28: clr *r2
+; comment
+L29: cmp L126, *r1
+L30: stop
+dec *r3
+L31: add L135, *r0
+red r4
+L32: stop
+bne *r5
+L33: .string "pkadrbrzrk"
+sub L212, r0
+add #176, L270
+mov #60, r4
+jsr *r7
+lea L165, *r7
+clr *r2
+inc *r5
+bne L324
+L34: clr *r7
+rts
+L35: sub L158, r7
+L36: jsr *r1
+L37: .string "ouatcjbkcojresiabuvq"
+L38: red r2
+sub *r1, L127
+L39: .string "ddcssusahjop"
+mov #-217, L204
+
+L40: mov #124, r3
+lea L111, L315
+sub #-11, r3
+L41: rts
+inc L198
+dec *r6
+inc *r1
+dec L131
+red r7
+stop
+bne L181
+lea L227, r5
+jmp L276
+; comment
+jmp L285
+L42: rts
+L43: stop
+jsr L329
+L44: inc L91
+inc L245
+L45: mov L131, L106
+L46: .data -846, 279
+L47: sub *r6, *r6
+jsr *r6
+L48: rts
+inc r7
+clr *r3
+sub *r3, r1
+L49: inc r4
+rts
+L50: dec r4
+inc L99
+L51: sub r7, r2
+jsr *r1
+sub *r0, *r1
+lea L126, r4
+dec r3
+L52: jmp *r5
+L53: clr *r2
+add L174, L62
+L54: .data -748, -301, -972, -411, -878, -761
+not *r1
+bne L241
+jmp L268
+L55: .data -616, -12
+L56: red *r0
+stop
+L57: cmp r6, #-239
+L58: .string "yqyxnrvgkaicj"
+L59: .data 891, 665, 949, -396, -378, -645, 320
+L60: .string "wjlhrzurkrl"
+L61: dec *r6
+L62: inc L103
+mov L309, L286
+mov *r0, L161
+lea L167, *r2
+; comment
+L63: dec L327
+red L238
+cmp #-38, L293
+mov #64, *r0
+L64: .data -253, -909, 215
+rts
+add *r1, *r3
+lea L177, r6
+L65: jsr *r3
+clr r6
+L66: clr r5
+rts
+inc L338
+clr L270
+lea L221, r3
+L67: add r0, r6
+sub #-171, L102
+jsr *r2
+bne L338
+L68: sub *r5, r7
+not r1
+red *r0
+L69: dec *r0
+lea L140, *r4
+lea L278, r2
+L70: sub #60, *r5
+stop
+jsr L153
+sub r2, *r0
+cmp L267, L144
+cmp r4, *r5
+inc L186
+red L231
+L71: prn L139
+L72: sub L92, *r6
+sub r4, *r2
+cmp #210, #11
+prn L221
+prn #205
+add r6, L324
+stop
+add r5, L198
+; comment
+not L311
+L73: rts
+sub r1, r4
+L74: lea L184, r3
+L75: bne *r3
+prn #-213
+prn *r2
+L76: stop
+L77: .data 642, 137, 73, -827, 923, -228, 825
+L78: jmp *r3
+L79: red r5
+clr r1
+clr r5
+L80: bne *r5
+L81: prn #-126
+L82: jsr L329
+L83: sub #-31, *r4
+L84: sub #80, L168
+L85: add r6, *r7
+add r6, r0
+red L178
+L86: lea L191, r3
+add r7, *r6
+lea L134, L284
+red r5
+L87: jmp *r6
+sub r1, r1
+inc r0
+lea L92, r3
+jmp *r0
+lea L132, r6
+add r0, r0
+add L142, r4
+cmp #13, r7
+rts
+L88: .data 687, -163, -911
+rts
+add L281, r6
+lea L340, *r1
+L89: not *r2
+cmp r0, L260
+L90: inc L216
+mov r0, r5
+; comment
+lea L93, L255
+L91: sub #78, L114
+mov *r0, *r0
+red L190
+L92: bne *r3
+cmp r1, *r4
+add *r2, *r1
+mov r6, L268
+L93: red r2
+lea L232, L120
+L94: red L257
+inc r0
+bne *r0
+stop
+rts
+L95: inc *r3
+rts
+clr *r1
+cmp *r4, *r3
+lea L254, r0
+jmp *r4
+mov L146, *r4
+sub L194, *r1
+L96: rts
+sub r7, L217
+L97: .data 138, -716, -91
+stop
+dec L159
+; comment
+inc L213
+L98: clr r6
+bne *r5
+jmp *r7
+red L255
+red L191
+L99: not L116
+sub #-92, *r1
+L100: .string "kyuuiawledzzwiwmzvuqln"
+L101: cmp L175, #115
+L102: dec L138
+L103: rts
+L104: .data -312, 33, -747, 913, 122, -237
+mov r5, *r4
+L105: jsr L334
+lea L119, L119
+clr r2
+not L255
+prn *r7
+L106: .string "vlevdstweppoykpan"
+L107: stop
+stop
+; comment
+bne L155
+add *r5, *r6
+L108: cmp L283, r4
+L109: prn r0
+cmp L252, #-182
+cmp r6, #-151
+L110: .data 554, -284
+L111: prn r2
+not r3
+L112: jsr *r2
+L113: dec L197
+red *r1
+sub r6, *r4
+prn L329
+prn #51
+L114: cmp r5, #93
+L115: stop
+lea L268, L207
+dec r2
+bne *r0
+L116: lea L223, *r0
+L117: jmp L340
+sub L225, *r5
+dec *r0
+L118: mov *r6, r3
+stop
+jsr *r2
+stop
+rts
+bne *r6
+clr r1
+inc L226
+inc r7
+L119: add #146, L196
+; comment
+add *r5, r6
+prn r4
+jsr *r6
+prn *r0
+L120: sub r4, *r3
+cmp r5, L257
+not *r7
+jsr *r6
+red *r2
+cmp r3, L251
+L121: .data 838, -826, 668, 99, -522, 228
+L122: .data 342, -275
+lea L223, r1
+L123: cmp #-75, L134
+L124: jmp *r4
+L125: clr L152
+mov L237, L148
+prn *r1
+mov #90, L145
+L126: .string "wjjfgmwpk"
+; comment
+L127: clr r6
+L128: .data 624, -556, 408, -189, -592
+; comment
+L129: bne L336
+L130: lea L146, L174
+L131: jmp *r6
+add r0, r6
+cmp r0, L241
+L132: .string "bpguqlzzsyeidvp"
+
+rts
+mov r2, L134
+L133: stop
+clr r0
+jsr L145
+L134: cmp L144, L262
+sub L236, *r6
+L135: red *r3
+not r4
+L136: mov r6, r6
+not L212
+add L261, *r3
+L137: add #-193, L254
+L138: dec r4
+clr *r6
+sub #83, *r0
+L139: dec *r4
+inc r5
+L140: clr L238
+cmp #-69, r0
+rts
+L141: sub #-24, L215
+cmp L228, r6
+L142: bne *r7
+L143: stop
+L144: mov *r0, *r1
+red r3
+L145: .data 377, -215
+L146: .data 69, 240, 265, 933, 834, 405, 776, -46
+L147: rts
+L148: inc L216
+lea L199, L278
+cmp *r3, r4
+add L180, *r2
+sub L285, *r3
+not L190
+L149: .string "fbsvuuscvoezlu"
+prn #102
+lea L175, *r3
+
+rts
+sub L220, r7
+jmp L288
+L150: dec *r3
+jsr L163
+red *r5
+inc *r7
+prn #-166
+rts
+jsr L340
+sub #-71, r5
+cmp #-110, L318
+bne L286
+
+L151: .string "ki"
+sub #-24, *r7
+L152: clr *r0
+rts
+L153: add *r0, *r1
+not *r0
+L154: .string "ypptucypkyk"
+L155: red *r5
+jmp *r0
+L156: .string "emiosnj"
+clr r5
+jmp L336
+cmp *r5, L173
+sub #212, L191
+not r4
+L157: stop
+L158: rts
+jsr L291
+add r0, r7
+stop
+mov r3, *r4
+sub r4, L162
+clr r2
+dec r1
+L159: red r2
+rts
+L160: jsr *r5
+dec *r4
+L161: .data -957, 651, 0, -886, -257, 2, -585, -284
+dec r2
+rts
+jmp L246
+add r3, L255
+mov r4, L192
+lea L240, r5
+cmp #-97, *r3
+L162: cmp #-94, r4
+L163: mov #-58, L265
+red *r7
+not r0
+inc r0
+L164: jmp *r6
+L165: .data -262, 522, -658, 929, 398, 100, 453, -260
+inc L262
+lea L245, *r4
+L166: stop
+; comment
+jsr *r4
+rts
+mov L283, *r5
+L167: jsr L338
+L168: .string "vfwavjesftogowkf"
+jmp L294
+dec *r6
+rts
+inc r1
+clr r3
+L169: inc L299
+L170: red L180
+L171: stop
+add *r1, L197
+L172: clr *r7
+dec r1
+bne *r0
+L173: lea L338, L294
+; comment
+cmp L196, L188
+
+L174: .string "ggvjicujstieshvjvkjdx"
+prn L322
+L175: dec r0
+stop
+red L184
+L176: red *r2
+L177: red *r3
+lea L312, r2
+L178: inc r7
+L179: cmp *r0, r2
+L180: bne *r2
+dec r3
+bne L232
+lea L250, r4
+L181: .data 706, 302, -41, -416, -73, -958
+L182: .data -364, 257, 50, -902, 371, -53, 208, -5
+inc *r2
+L183: prn *r1
+L184: lea L317, *r0
+add L233, L213
+red L307
+; comment
+jmp L339
+L185: .string "vqlsfecoploumqirujofggn"
+L186: .data 692, -311, -583, -669, 1
+L187: not *r3
+red r7
+jsr *r3
+prn r4
+inc r2
+L188: bne *r5
+jsr *r3
+lea L306, r1
+clr L222
+add L339, r4
+L189: .string "ochetezjpgfnoslrkog"
+bne *r4
+jsr L297
+mov L262, *r1
+dec r1
+lea L299, L339
+L190: clr L198
+L191: cmp #215, *r2
+lea L313, r0
+red L224
+L192: dec *r5
+sub #3, *r3
+
+lea L303, r0
+rts
+L193: dec *r3
+cmp L219, #-93
+prn r0
+L194: add r4, r3
+rts
+stop
+L195: not L246
+; comment
+lea L255, L285
+L196: clr L321
+L197: cmp *r2, L220
+bne L261
+L198: .string "znwnstqqkcrnbbfukbvtgb"
+inc *r2
+L199: mov *r3, r1
+L200: lea L271, *r5
+L201: red *r4
+L202: red r7
+not r6
+L203: .string "agjzhnvqbroip"
+jsr *r5
+
+mov L314, *r5
+; comment
+red r4
+mov *r4, L332
+not *r1
+cmp *r5, r2
+inc *r2
+dec L339
+mov L263, r7
+rts
+L204: jsr L227
+L205: red *r6
+L206: .string "hdmokujvbjtd"
+L207: red r0
+stop
+red L328
+dec r1
+L208: mov L313, L246
+L209: sub r3, *r6
+sub #8, L303
+sub *r5, L288
+add L304, r4
+L210: stop
+L211: inc *r6
+prn L230
+prn *r1
+not L341
+L212: inc L239
+cmp *r5, L268
+L213: red *r7
+L214: prn r0
+jsr L291
+clr *r1
+L215: jmp L232
+stop
+clr L286
+bne L336
+lea L315, r2
+stop
+L216: .string "mtay"
+L217: sub L286, L220
+L218: .data -780, 514, 86, -381, -169, -734, 709, -699
+L219: .string "edkeaayacqqzjbsncu"
+bne *r1
+add L319, r3
+prn *r4
+cmp #-199, r3
+stop
+L220: .data 455, 313, 148, -53, 968, 292, 191
+L221: jsr L314
+mov #10, r1
+inc r2
+jmp *r7
+stop
+L222: add L251, r5
+cmp L308, #10
+cmp *r7, r4
+L223: sub #191, r1
+L224: prn L265
+L225: bne *r7
+L226: not L286
+mov #-161, *r4
+dec *r4
+bne *r6
+
+L227: rts
+L228: dec L261
+L229: rts
+L230: .data -125, 312, -320, 983, -783, 443, 940, 628
+; comment
+L231: prn r5
+L232: sub r4, L290
+stop
+stop
+jsr L336
+cmp #1, *r7
+jsr *r7
+prn #130
+bne L320
+clr r1
+add #218, r6
+
+L233: .string "qxxfzoaiubtjxud"
+add *r4, L286
+inc L340
+sub r7, r6
+L234: .data -166, -969, -346, -48, -381
+; comment
+lea L336, r1
+
+prn L315
+L235: add r4, *r0
+inc L241
+sub L262, r1
+rts
+L236: .string "cyhopgzhgmbpoephvxwfjry"
+L237: not *r6
+L238: clr r0
+dec L252
+cmp L324, L245
+; comment
+L239: add #-245, L243
+cmp r1, *r1
+L240: not r0
+L241: not r7
+L242: dec L302
+L243: .data -958, -856, -426, -438, 348, 561, -305, 676
+inc L295
+inc *r3
+stop
+L244: prn #-139
+L245: jsr *r3
+; comment
+red *r4
+L246: .data -22, -793, -98, -791, 800, -398
+L247: stop
+inc r7
+jmp *r6
+rts
+L248: bne L305
+L249: jsr L267
+L250: .string "ryv"
+add r5, r4
+
+dec *r1
+L251: .data -526, 704, -288, 515, 713
+jsr L255
+bne *r0
+clr L296
+prn r4
+jmp *r4
+
+mov *r0, L306
+stop
+L252: inc L270
+L253: cmp r7, L292
+lea L301, L335
+L254: rts
+not r0
+add L313, *r1
+L255: dec L271
+L256: .string "rv"
+add r6, r0
+L257: .data 285, -716, -245, 855, 58, 342, 815, -115
+dec r6
+L258: mov L317, r2
+jsr *r3
+inc r7
+stop
+cmp *r1, #139
+add r5, *r4
+sub #101, r7
+L259: jmp L341
+L260: clr r6
+cmp *r6, L299
+L261: cmp L264, *r7
+L262: bne *r5
+mov L276, L321
+L263: jmp *r2
+L264: bne L341
+rts
+not L310
+jsr *r3
+sub r7, r2
+clr *r5
+add #-87, L334
+L265: inc *r0
+jmp *r2
+L266: stop
+cmp #142, L322
+L267: .data -797, 329, 306, -320, -737, -470, -378, 445
+add L296, r4
+sub #127, L332
+add r3, r3
+not *r7
+L268: not r6
+clr *r6
+jsr L330
+red L292
+L269: mov #199, r2
+red L290
+jsr L302
+L270: .data 86, -406, 156, -271, -642, -164, 234
+add L299, r0
+jsr L336
+L271: .data 307
+L272: .data -647, 595, 153
+not r4
+prn *r3
+bne L306
+stop
+; comment
+inc r4
+dec r4
+; comment
+L273: rts
+not r1
+bne L334
+prn *r6
+dec *r3
+L274: lea L288, *r1
+L275: cmp #-32, #-158
+red L289
+lea L322, L339
+bne *r5
+L276: .string "oxaqy"
+prn L326
+bne *r6
+
+L277: .data -956, 731, 798, -453, 593, -816, 123, 638
+; comment
+L278: cmp #-11, L295
+L279: .data 27, 667, -913, -838, 897, -860, 264
+lea L324, L336
+not L326
+mov L318, *r2
+L280: clr L294
+L281: lea L289, r4
+stop
+bne L333
+L282: red L300
+cmp r6, r3
+red *r7
+dec L288
+sub #139, L323
+jsr *r0
+bne *r2
+L283: cmp *r4, r4
+clr r4
+rts
+inc r6
+cmp r4, *r1
+cmp L296, #32
+L284: lea L308, *r5
+L285: rts
+; comment
+L286: bne L293
+sub *r0, r7
+rts
+L287: .string "jp"
+L288: clr *r1
+add L323, r0
+rts
+cmp *r7, *r3
+add L317, r3
+L289: .string "l"
+clr *r0
+not r6
+rts
+not L313
+stop
+jsr L306
+red L321
+L290: .string "ggcxufucigzaivkyaw"
+stop
+jmp *r0
+dec r1
+L291: cmp r5, r1
+clr r1
+rts
+inc r5
+jmp L300
+add #-139, r5
+jmp *r0
+clr *r6
+bne L333
+not *r7
+L292: .data -975, 6, -581, -71, -82, -712, -704
+L293: sub *r1, r7
+not L328
+dec r6
+jmp *r3
+L294: bne L332
+bne L303
+L295: not L316
+lea L326, *r7
+add r1, L315
+not *r1
+jmp *r5
+L296: inc *r4
+cmp L315, L304
+clr r5
+L297: clr L299
+L298: inc *r0
+L299: red L310
+not *r0
+red r0
+sub L318, *r0
+L300: lea L320, r2
+bne *r5
+mov r3, L315
+not *r1
+L301: red r3
+jsr *r3
+L302: .string "f"
+mov *r3, r7
+L303: clr r7
+jmp L333
+bne *r2
+inc r0
+jsr *r6
+sub *r3, *r1
+jsr *r5
+inc L309
+rts
+sub L332, *r6
+L304: sub *r6, r4
+mov r0, *r2
+L305: .data -48, 635, 706, -701
+prn L338
+L306: bne *r4
+L307: .data -17, 586, 963, 615, 767, -11, 348, -162
+L308: cmp L339, #23
+L309: dec r4
+rts
+L310: add *r0, L333
+L311: jmp L325
+
+dec L333
+L312: not *r4
+L313: clr *r2
+cmp r1, r3
+
+lea L323, r0
+stop
+L314: .data 381, -315, -487, 142, -248
+L315: inc L336
+red *r3
+L316: inc r6
+; comment
+cmp r3, #193
+add r5, L341
+prn *r6
+L317: prn L339
+sub L330, r2
+add #187, *r6
+sub r2, r5
+not L336
+L318: clr L337
+jsr L329
+L319: .data 499
+L320: inc L325
+bne L330
+sub r4, r7
+L321: cmp L331, #1
+L322: bne *r4
+inc L327
+rts
+
+inc L334
+red L331
+red *r2
+clr r2
+L323: prn L337
+mov *r2, *r1
+red r4
+L324: red *r5
+jsr *r0
+red *r4
+sub r1, L332
+bne L339
+jmp L325
+L325: dec r3
+L326: .string "fplg"
+L327: jsr L341
+bne *r4
+inc *r4
+clr L333
+add #127, r7
+L328: inc L339
+add L329, r6
+jmp *r3
+red *r3
+; comment
+mov *r6, L339
+jmp L334
+L329: add L332, L336
+red L334
+jsr *r5
+; comment
+L330: red *r4
+red *r6
+prn *r6
+L331: .data 795
+cmp L340, r5
+L332: dec r3
+L333: cmp *r4, r6
+dec r5
+add #175, r6
+dec L334
+clr *r5
+red *r6
+jmp L335
+lea L338, r1
+
+jmp L339
+L334: not L339
+mov r6, L336
+; comment
+L335: cmp L341, *r4
+jmp L340
+L336: bne *r7
+jmp L341
+lea L340, *r3
+red L340
+L337: .data -217, -817, 377, -637, -78, -672
+lea L340, r1
+rts
+red *r2
+
+rts
+
+L338: jsr *r1
+L339: not *r0
+clr r5
+L340: clr *r5
+L341: cmp *r5, r2
+cmp *r0, L260
+not L232
+jsr L27
+stop
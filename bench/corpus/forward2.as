@@ -0,0 +1,1023 @@
+; Generated by genCorpus --seed 3
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+sub r5, L17
+L0: .string "twvghbb"
+jsr L54
+bne *r7
+red r4
+L1: .string "nzlliklnncvwexutiurivwoh"
+L2: .data 554, 145
+jmp L294
+jmp L300
+L3: rts
+bne *r0
+jsr L294
+rts
+L4: cmp #-246, r7
+; comment
+L5: .string "gapezzlnlnjlnjjxizg"
+
+rts
+stop
+inc *r4
+add L24, r2
+jmp L316
+L6: rts
+L7: mov *r2, r3
+L8: .data 167, 59, 874, 934
+prn #59
+jmp L259
+L9: inc *r5
+not r6
+L10: clr r5
+L11: prn r4
+L12: stop
+add #-64, *r4
+inc *r2
+L13: rts
+stop
+L14: cmp r2, L207
+rts
+
+cmp L262, r6
+rts
+mov L62, L237
+sub L206, L206
+; comment
+
+stop
+not r0
+bne L179
+bne L192
+L15: .data 208, -816
+
+lea L156, *r3
+bne *r0
+L16: .string "azvmzlphwd"
+bne *r3
+L17: .string "tbgigwuokianuikafq"
+L18: not L49
+; comment
+L19: lea L109, L107
+L20: .data 348, -561, -173, 904
+
+L21: clr L322
+add *r6, *r6
+red L300
+cmp L175, #201
+
+L22: dec r0
+add r6, L157
+L23: jsr L283
+
+stop
+stop
+L24: prn *r2
+bne *r0
+dec L34
+L25: .string "zjrlwqwvucmmnfrbwu"
+L26: red r4
+bne *r7
+L27: .string "oupwhdlgqtfgjokfw"
+bne *r7
+mov r3, *r1
+rts
+inc L249
+cmp r6, #170
+L28: add r7, *r4
+L29: .string "kteyjqbvqewbianudt"
+; comment
+
+bne L120
+L30: jmp L160
+jsr *r7
+bne *r2
+bne *r5
+L31: stop
+L32: lea L47, r7
+L33: .data -277, 322, -668, -740, 353, 33
+not L242
+dec r2
+inc *r2
+L34: jsr L311
+; comment
+lea L283, *r5
+L35: dec L191
+prn #42
+
+L36: bne *r4
+inc *r5
+inc L39
+not r6
+
+L37: add r7, L230
+L38: cmp L122, #181
+stop
+mov #-251, *r3
+sub r1, r1
+clr *r7
+sub r0, L223
+
+bne L271
+L39: sub r5, r6
+prn L264
+stop
+L40: .string "wtlrggbu"
+red *r6
+inc L112
+L41: .string "jnnchumj"
+L42: not r1
+dec L118
+L43: sub L116, L69
+L44: red L116
+red *r5
+L45: clr r1
+jsr L321
+L46: .string "asvphgwuoxvhnzxzjhdvg"
+sub #40, L73
+mov L274, r5
+mov *r6, L143
+jmp *r0
+jmp *r0
+jsr L119
+sub *r4, L299
+
+L47: jmp L172
+stop
+cmp r0, r3
+L48: .string "xgyls"
+add *r5, *r5
+L49: .string "kbqxgmgv"
+sub *r2, L81
+rts
+prn L268
+prn r7
+inc L139
+L50: .string "nwr"
+jmp *r5
+jsr L295
+L51: .string "ldejfzhmzshsvl"
+sub *r6, *r7
+not r7
+prn L320
+L52: stop
+L53: lea L228, r6
+prn *r4
+clr *r4
+L54: clr *r1
+jmp L129
+add r3, *r4
+rts
+stop
+stop
+L55: .string "edoj"
+sub *r7, r2
+not r0
+sub *r6, L84
+red r2
+L56: jsr *r5
+L57: bne L66
+L58: .data 688, -260, -386
+
+jsr L124
+cmp *r0, #5
+L59: sub #63, *r5
+cmp r5, #-181
+cmp #33, #153
+L60: bne *r6
+sub *r3, r0
+inc *r3
+L61: add L272, L252
+dec r2
+L62: sub #-254, *r7
+L63: stop
+L64: jsr *r6
+clr r0
+L65: jmp L297
+red r3
+L66: add L288, *r4
+not L262
+jsr L91
+prn #193
+lea L87, L232
+L67: .string "aeztbdyadc"
+jsr L238
+inc *r6
+L68: inc r0
+jsr L197
+mov r1, r4
+lea L302, *r7
+L69: stop
+lea L203, *r3
+L70: .data 968, 465, -258
+L71: lea L189, L84
+rts
+L72: bne L283
+dec L131
+L73: inc L259
+lea L175, r1
+stop
+jmp L180
+L74: .data 744, -369, -794, 615, 782, -511, 779
+dec r0
+prn r0
+lea L213, r2
+red L75
+clr *r3
+
+inc L183
+cmp r6, *r3
+rts
+inc *r7
+inc L222
+mov L304, *r5
+bne *r5
+lea L109, L225
+inc L221
+L75: cmp *r4, #94
+L76: stop
+cmp #167, r5
+rts
+L77: jmp *r2
+dec *r1
+L78: jsr L80
+inc r2
+L79: clr *r7
+not *r0
+L80: add *r5, L258
+cmp L124, L130
+prn #-95
+add L157, L181
+L81: sub *r5, L108
+red *r5
+red L149
+bne *r2
+bne L220
+; comment
+L82: jsr L162
+dec L323
+stop
+L83: .data 156, 174, -400, -318, -730, 912
+rts
+L84: cmp #66, L222
+cmp *r3, r4
+L85: .string "wzbzltij"
+L86: .data 610, -700, 53
+red r1
+L87: rts
+L88: .data 690, 662, 918, 188, 70, 157, -43, -261
+L89: jsr *r6
+cmp *r4, *r2
+sub L279, L125
+inc L169
+L90: clr *r1
+sub r7, L142
+L91: clr L127
+rts
+L92: .string "phqryysxf"
+bne *r7
+prn *r5
+jsr *r1
+bne L168
+L93: .data 175, -522, -873, 121, -583, -398
+add L225, L311
+dec *r3
+L94: sub #134, *r1
+jsr *r3
+lea L197, *r1
+rts
+not *r3
+lea L226, r1
+L95: inc r5
+inc L286
+L96: jmp *r1
+L97: jsr L222
+mov *r0, L187
+cmp #-28, #171
+jsr *r4
+clr *r3
+rts
+L98: lea L232, L126
+not r7
+dec L105
+sub #-13, *r0
+stop
+not r5
+L99: jsr L149
+rts
+dec r4
+mov L282, *r3
+rts
+lea L230, *r5
+L100: not r2
+cmp L160, r6
+sub r4, *r3
+
+dec L218
+lea L288, r0
+not r7
+L101: .string "j"
+add r0, L190
+cmp L238, L193
+prn L268
+stop
+prn *r3
+stop
+rts
+mov L315, *r2
+L102: bne L199
+jmp *r1
+stop
+L103: .data 807, 696, -909, -22, 621, -58, -819, 171
+dec r1
+stop
+L104: dec L137
+stop
+cmp *r1, L110
+L105: .string "ydir"
+dec r6
+L106: .string "rfddmozzm"
+L107: .data 180, 186
+bne *r1
+jsr L150
+red *r5
+not r0
+
+not L315
+L108: red L158
+add L299, r6
+rts
+stop
+L109: not r7
+jmp *r1
+rts
+L110: jsr *r1
+L111: dec L282
+dec *r2
+L112: .string "zgloqywnnthnzrtactwsceti"
+L113: lea L306, L135
+L114: jmp L128
+L115: rts
+jsr *r0
+prn L120
+not r1
+dec L238
+lea L143, L224
+clr L236
+L116: .data -17, -38
+L117: .data -871, 914, -952, -115, -879, 764, -968
+L118: .data -974, 458, 478, 207, -609, -258, -239
+sub #121, L286
+L119: mov #88, r0
+rts
+dec *r7
+add L184, r0
+stop
+prn #-233
+lea L255, L294
+clr L239
+L120: lea L204, L260
+rts
+bne *r2
+inc *r2
+jsr L205
+rts
+dec r2
+stop
+prn r3
+rts
+lea L313, r1
+jsr L162
+L121: cmp #-77, #195
+L122: red L236
+not *r4
+sub r4, *r5
+jsr *r7
+add #148, *r5
+lea L154, L133
+L123: jsr L139
+L124: red L246
+not L230
+L125: jsr L198
+prn #244
+L126: bne L308
+L127: stop
+jsr L244
+cmp L276, #-183
+stop
+L128: .data 321
+L129: not L292
+L130: red *r2
+dec *r6
+clr *r3
+stop
+not *r5
+prn *r6
+inc L301
+red r5
+add *r7, *r5
+not *r7
+not *r5
+stop
+sub *r3, L258
+jmp L264
+lea L245, L192
+red *r4
+sub *r5, L148
+sub r2, L276
+L131: .data -938
+rts
+jmp *r6
+L132: jmp L232
+add L139, r1
+prn #-2
+jsr L208
+dec r2
+add L152, *r6
+L133: .string "ltwsfasqnoxkxsuzvyywhiu"
+L134: .data -124, 239, 79, -414, -945, 884
+sub r1, r7
+L135: inc *r2
+dec *r7
+L136: .string "ddvcxxbs"
+sub *r7, *r4
+L137: dec r0
+L138: .data -96, -506, -28, -149, -902, 95, -496
+red L211
+cmp *r2, r4
+L139: .data 617
+L140: jsr L151
+L141: add *r5, r2
+L142: .string "vxwtefemph"
+not L233
+jsr L210
+bne L180
+cmp r0, L312
+L143: stop
+bne L155
+clr r7
+rts
+cmp *r7, L243
+L144: rts
+L145: jmp L310
+L146: lea L166, *r3
+L147: .data 607, 423, 191, -117, -709
+add L260, L277
+L148: not *r4
+stop
+L149: prn r5
+not *r6
+L150: add *r1, L245
+
+cmp r3, *r3
+clr r7
+L151: .string "dyixpgpmikvpnzkb"
+add #-10, *r4
+inc r5
+dec *r5
+L152: not L301
+rts
+lea L157, r4
+sub L217, *r2
+L153: not r6
+L154: lea L296, *r0
+bne *r3
+L155: prn *r3
+jmp L230
+L156: mov #40, L247
+L157: red r7
+L158: stop
+lea L160, r7
+red *r4
+stop
+red *r4
+L159: lea L310, *r7
+sub #238, r0
+not L269
+add r4, *r7
+inc *r4
+L160: dec L179
+mov r1, *r0
+lea L236, *r2
+lea L170, *r6
+jsr L182
+L161: rts
+L162: bne *r2
+prn #-215
+stop
+L163: cmp *r3, *r0
+mov r4, L180
+inc L244
+prn *r1
+prn *r6
+clr r7
+inc *r1
+cmp #72, L254
+prn r6
+jmp *r2
+cmp r1, *r5
+red r6
+L164: mov #-215, L241
+jmp L186
+L165: dec L184
+L166: .string "nthjsaukznezqd"
+clr *r3
+dec L213
+inc *r3
+L167: .data 414, 893
+jmp L235
+add r1, L198
+jmp L213
+L168: .data -566
+
+stop
+mov r5, L268
+red *r1
+L169: .string "mijlgzuwd"
+L170: .data 971
+L171: .string "ckupmpjrznnwdccghcus"
+stop
+jmp L307
+red *r0
+jsr *r1
+red L275
+mov #107, L319
+add *r5, L189
+L172: jmp L218
+L173: jmp *r3
+prn *r3
+clr L225
+sub *r1, r7
+L174: inc *r3
+L175: cmp L266, r4
+red r6
+L176: .string "bhvebzqcfsipiuxq"
+
+jmp *r4
+L177: prn r3
+cmp #-254, #-65
+red L197
+red L279
+L178: jmp *r1
+jmp L311
+red L211
+L179: .data 880, -277, 382, -957, -723, 439, -942
+L180: prn *r5
+stop
+L181: cmp *r6, L318
+lea L211, *r1
+mov r3, r4
+rts
+L182: .string "axrrcxninpells"
+rts
+L183: not *r4
+L184: jsr *r6
+red *r3
+L185: .string "wfoetmjckdhvpcq"
+jsr L279
+inc *r7
+L186: not *r1
+prn *r7
+L187: .string "rntypixqvsx"
+not *r7
+
+red *r1
+L188: .string "fgmvyzkjeel"
+inc r7
+L189: lea L255, *r2
+L190: jsr L295
+add *r3, *r1
+clr r2
+L191: bne *r6
+jmp *r0
+
+add L280, r2
+rts
+inc r6
+L192: add L271, *r7
+dec r1
+inc L285
+mov L303, r1
+L193: not *r1
+jmp L287
+stop
+L194: .data 743, -863, 543, 516, 227, 855, -688
+clr L251
+lea L270, L323
+
+inc L291
+jmp *r6
+inc L208
+L195: .data -336, -831, 618, -599, -807, -294
+sub #95, r7
+L196: jsr L272
+L197: .string "udcwffzzxvqnh"
+mov *r0, *r1
+jmp L253
+dec r0
+L198: stop
+L199: .string "tcsxgnbywdirbmhvs"
+L200: bne *r1
+L201: .string "czkkxsmqjhlftlwx"
+stop
+lea L284, *r6
+L202: bne L301
+mov #-28, r6
+lea L217, r5
+prn L297
+not r1
+not *r3
+L203: stop
+L204: dec L294
+L205: .data -402, 919, -76, -725
+inc r0
+bne L313
+dec L305
+; comment
+stop
+bne L304
+L206: bne L275
+L207: .string "rgjctcujhesgqvfc"
+bne *r0
+cmp #203, L226
+bne L321
+add *r2, L296
+L208: sub r1, r2
+lea L240, L227
+rts
+rts
+
+L209: jmp L232
+mov r5, L305
+clr *r4
+red r5
+L210: mov L300, *r4
+inc *r2
+L211: lea L313, r2
+L212: inc *r1
+bne L235
+jsr L239
+L213: .data 989, -355
+
+red *r7
+cmp L259, r7
+inc *r4
+clr r6
+inc *r1
+L214: rts
+mov #229, r5
+bne L268
+not L281
+jsr *r1
+L215: .data -706, 157, 849, -927, 663, 658, -103, -324
+dec *r0
+inc *r3
+lea L269, r2
+sub #168, L296
+red L301
+clr *r5
+jmp *r2
+dec r5
+L216: rts
+L217: .string "zymxqrly"
+prn L305
+prn *r5
+L218: inc *r7
+L219: .data 845, -452, -578, 562, 710, 209
+lea L220, r4
+L220: jsr *r5
+stop
+L221: cmp *r7, #45
+L222: add *r3, r5
+jmp *r3
+add L258, L324
+prn r0
+not r2
+L223: clr *r4
+sub #53, *r7
+; comment
+mov L290, L248
+L224: mov r3, L241
+L225: clr r0
+jsr L267
+; comment
+L226: .string "jjzkcyrsfqzdhxoj"
+prn #155
+mov r3, r4
+L227: sub *r4, *r4
+lea L294, *r5
+
+jmp *r6
+stop
+jmp L282
+jmp L290
+add r6, L255
+jmp *r4
+L228: red L311
+not *r7
+L229: stop
+prn #149
+cmp L307, *r2
+clr *r1
+rts
+prn L241
+rts
+inc L258
+L230: jmp *r5
+inc L303
+L231: not *r1
+sub r5, r6
+L232: prn r2
+L233: .string "hbcaiiizem"
+rts
+mov *r1, L237
+prn #189
+L234: lea L315, r4
+red r5
+inc L321
+dec *r2
+mov *r0, *r5
+L235: clr r7
+bne L248
+prn L322
+sub *r2, L252
+prn r2
+prn *r7
+rts
+L236: cmp L318, #114
+rts
+lea L286, *r4
+bne *r3
+clr *r2
+dec r2
+L237: stop
+L238: mov L315, r7
+cmp #-96, *r0
+L239: mov *r3, *r5
+L240: .data -33, 685, 840, 951
+L241: dec *r2
+L242: .data -567, -924, -509, -155, -994, 94
+sub L316, r4
+
+clr r3
+stop
+L243: sub #90, r2
+jmp L244
+lea L295, *r1
+jmp L264
+red L279
+red r2
+sub L257, r4
+mov *r0, *r0
+jsr *r4
+not *r1
+
+clr r2
+L244: .data -107, 543, -855
+jmp L309
+L245: .string "lnydczliaaoiad"
+L246: red L303
+red r4
+bne L297
+bne *r1
+cmp #-104, r0
+mov *r6, r7
+L247: stop
+L248: bne L306
+stop
+prn *r1
+add #-172, *r7
+cmp r1, *r1
+L249: .data -851, -557, 919, 537, 897, 661, -613, 217
+add r0, *r4
+L250: dec r4
+L251: bne L306
+lea L288, *r4
+
+L252: lea L270, L315
+stop
+add L278, L260
+L253: clr r1
+L254: .data -538, -773
+L255: sub L261, L296
+; comment
+dec r2
+clr r3
+L256: .string "sk"
+L257: prn r4
+jsr *r1
+red *r0
+L258: mov *r3, *r2
+jmp L324
+L259: lea L319, L302
+cmp r3, #-157
+
+stop
+inc *r4
+not L321
+dec *r4
+L260: .string "nmuovouvgwbhbmdt"
+L261: inc *r7
+L262: prn #174
+mov *r4, L297
+mov *r1, L266
+mov *r1, *r3
+L263: inc L269
+L264: .string "acsneenyjbnpezds"
+L265: .string "rxbkxxtbtcgssjc"
+L266: .string "fsr"
+L267: dec L296
+stop
+L268: stop
+L269: .data -234, -899
+lea L304, L283
+jmp *r6
+bne *r6
+lea L310, L316
+L270: .string "szeqsorxngmwtpypr"
+not *r0
+jmp L282
+lea L286, r3
+L271: bne *r4
+jsr *r7
+L272: .data -783, -404, -436, -735, 907
+L273: lea L300, L281
+prn L277
+L274: clr r0
+L275: red r0
+L276: clr *r2
+; comment
+mov *r6, L317
+L277: prn *r2
+not *r4
+prn *r4
+not *r3
+L278: .data 469, 29, 748, 796, -51, -25
+L279: jsr L295
+cmp L299, L288
+inc r3
+jsr *r5
+mov L280, r2
+sub *r3, r6
+red *r1
+not L321
+L280: stop
+L281: .string "kndtgtaqaogtnvxeexejb"
+L282: .string "yobiwpmvekx"
+jsr L295
+L283: cmp r6, *r4
+L284: lea L296, *r1
+mov #238, r6
+cmp #-171, r6
+sub #90, *r4
+mov *r5, L315
+clr *r0
+stop
+L285: stop
+; comment
+stop
+lea L298, L299
+lea L319, *r7
+dec L314
+L286: dec *r5
+red L299
+L287: .data -351, 118, -685, -866, -871
+lea L322, r0
+L288: jmp L307
+jsr L301
+not *r6
+L289: sub L313, r7
+prn #208
+prn r6
+mov *r5, *r6
+jmp *r6
+L290: inc r3
+inc *r6
+cmp #211, #-57
+L291: cmp L298, #-73
+prn r1
+L292: mov r2, *r2
+clr L309
+L293: lea L302, *r1
+L294: .data -425, 484, 375, -565, 883, -41, 110, 955
+L295: cmp r3, L318
+L296: rts
+dec r4
+bne L298
+L297: dec r1
+mov L319, L309
+sub r6, *r5
+L298: prn L310
+jmp L300
+jsr *r7
+mov r3, L321
+stop
+L299: .string "ylimjvgyxxbgsfuzshnu"
+cmp L318, #161
+; comment
+sub r6, L302
+red r3
+L300: rts
+L301: .data -86, 131, 752
+inc L308
+not *r6
+L302: sub L305, *r7
+rts
+L303: add #-34, *r3
+stop
+bne L304
+mov #-95, r4
+
+sub r2, r6
+sub #91, *r4
+cmp L324, #223
+red r0
+mov L320, *r5
+clr *r5
+prn *r5
+rts
+jsr *r5
+L304: not L321
+
+L305: cmp *r6, *r1
+L306: bne L312
+jmp *r1
+L307: sub *r4, *r7
+; comment
+stop
+L308: .data 812
+lea L311, L314
+mov *r0, r6
+add #-202, r6
+
+L309: inc L318
+bne L320
+stop
+L310: .data 551, -305, -834, -786, -469
+sub *r5, r0
+jsr *r4
+cmp L315, r0
+cmp #65, #-58
+rts
+prn L315
+rts
+prn #41
+clr L322
+red r0
+dec L321
+bne *r0
+stop
+L311: .data 298, -831, -64
+red *r3
+L312: red r1
+cmp #-13, #-55
+red r1
+L313: sub L322, r3
+L314: jmp *r4
+clr *r3
+inc *r7
+not L316
+L315: prn r1
+rts
+L316: not L317
+sub L324, r1
+L317: dec *r7
+stop
+jsr L322
+not *r5
+L318: clr r2
+L319: .data -980, 492, -557
+L320: inc L321
+stop
+bne *r7
+stop
+L321: add *r0, r5
+jmp *r0
+clr L324
+L322: not *r3
+L323: stop
+cmp *r3, r2
+add #114, r6
+L324: bne *r6
+not r1
+stop
@@ -0,0 +1,1023 @@
+; Generated by genCorpus --seed 21
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+L0: bne L118
+stop
+jsr *r3
+L1: mov r3, r4
+L2: mov *r6, L98
+jsr L322
+
+jmp L3
+bne *r5
+
+L3: mov *r2, *r2
+L4: .data 481, 14, -229, -318
+dec r6
+L5: lea L72, *r1
+stop
+jsr *r6
+L6: cmp L224, L220
+rts
+bne L192
+jmp L265
+lea L290, *r6
+add #56, r4
+; comment
+L7: red *r7
+L8: .string "kytjgw"
+mov #-117, L144
+jmp *r1
+sub r7, *r7
+mov #22, L316
+inc r6
+dec r1
+L9: add r4, L222
+sub L142, *r4
+sub r3, *r5
+lea L20, r1
+jsr *r3
+jmp *r3
+lea L250, *r6
+rts
+L10: jmp L96
+L11: .string "fvdaqjurflvezrfsebtusnu"
+L12: .string "rlalptecrjemtrwmt"
+L13: .data 37, -379, 284
+L14: stop
+red L294
+prn L185
+stop
+L15: cmp L215, r7
+L16: .data 641, 174, 911
+dec *r3
+L17: dec r7
+red r2
+mov #-229, *r0
+bne *r4
+clr L184
+jsr L23
+jsr L31
+sub *r2, *r4
+L18: lea L324, *r2
+dec L123
+inc L85
+prn r2
+L19: dec r3
+dec L96
+lea L184, *r4
+L20: inc *r5
+inc L124
+L21: .data -744, 257, 135, -443, 700, -656
+L22: .data -114, 895, 504, 980, -826
+inc *r6
+L23: jsr L158
+sub r2, r2
+jmp *r5
+L24: prn L140
+add L213, *r7
+sub #-210, r5
+cmp L275, *r5
+L25: rts
+dec r7
+L26: red r6
+mov *r7, L73
+inc L244
+not L244
+L27: stop
+stop
+red r6
+sub r5, *r5
+rts
+sub r5, L320
+L28: prn #90
+add L216, L213
+jsr *r1
+L29: stop
+mov r6, *r3
+stop
+L30: .string "wxjulbiqzhpywxed"
+L31: bne L320
+rts
+bne L132
+bne L36
+
+dec L148
+lea L87, *r0
+L32: .string "mtxcjrsh"
+
+L33: bne L139
+L34: jsr *r5
+L35: stop
+clr L141
+L36: red r5
+dec L227
+L37: mov L240, r7
+sub #-114, *r3
+L38: .string "uwhbaswysor"
+prn r6
+lea L39, L82
+clr L156
+rts
+sub r5, L129
+mov *r7, r3
+prn L182
+cmp #100, L68
+not r6
+red L57
+not L152
+cmp #-134, *r2
+inc r6
+rts
+sub r4, L305
+jsr *r4
+
+L39: .string "ouevlkrhgyneg"
+L40: jmp *r2
+L41: rts
+red L258
+red L162
+red r5
+not r1
+lea L56, *r6
+L42: .data 432, -730
+; comment
+add #-178, r4
+L43: .data -680, 225, 9, 407, 284
+L44: .data 775, 419, -949, -730, -486, -266
+L45: red r3
+sub *r3, *r3
+rts
+; comment
+mov L118, *r6
+prn L64
+prn *r5
+rts
+cmp L245, L242
+L46: sub L130, r6
+add L115, r2
+bne *r5
+mov r3, r4
+clr L176
+L47: .string "es"
+cmp L229, L204
+L48: jmp L117
+L49: clr L264
+jmp *r2
+L50: .string "hrrctpeqnqmjoh"
+mov r3, *r2
+clr r2
+jsr *r0
+L51: red r0
+cmp r7, L250
+L52: not r0
+L53: .data -172, -459
+mov L180, *r0
+rts
+bne *r0
+red r5
+red *r5
+L54: rts
+jmp *r3
+not r0
+L55: .string "mistcidsc"
+L56: .string "jutxalyhqsnlqwuhnhiva"
+L57: not *r2
+rts
+L58: bne L174
+jmp *r4
+mov r5, *r0
+jmp *r1
+L59: .string "epvxidbwc"
+L60: rts
+not L286
+L61: cmp *r3, r3
+L62: .string "mqtlhjduuhvchsmac"
+L63: jsr *r6
+mov *r3, r2
+L64: .string "ltcuhmngjh"
+rts
+L65: .data 854, 528, -638, 460, -796, -189, 333
+jsr *r3
+lea L314, *r6
+L66: stop
+L67: cmp r5, *r4
+red *r5
+prn r4
+mov L252, *r3
+L68: jmp L85
+rts
+L69: red L91
+L70: jsr *r0
+dec *r4
+L71: .string "ayoufrqbhdi"
+bne *r6
+jmp *r4
+L72: stop
+cmp L144, L185
+cmp L125, L306
+inc *r2
+L73: bne *r7
+rts
+rts
+jmp L277
+L74: sub L247, *r7
+mov L111, L143
+add r6, r4
+clr L175
+L75: lea L232, *r4
+mov *r1, *r3
+add *r6, r7
+jmp *r3
+L76: cmp L131, L230
+add *r5, L310
+L77: sub *r2, *r6
+L78: .string "wwnpvav"
+lea L132, r3
+jsr *r7
+L79: not *r4
+
+jmp *r1
+L80: add #-14, *r0
+add *r3, *r0
+L81: .data 988, 885, -778, 654, 26, -158, 95, -460
+prn r1
+L82: rts
+L83: not r2
+rts
+cmp #176, r6
+sub L158, L284
+L84: clr r2
+
+bne L202
+L85: dec *r5
+L86: .data 274, -809, 114, -673
+prn #128
+L87: cmp r3, #-224
+red r3
+sub *r3, *r3
+L88: lea L296, r4
+rts
+mov L181, L178
+not L243
+sub r2, r0
+stop
+L89: red r7
+lea L272, r7
+bne *r5
+red *r1
+L90: .data 168, 457
+lea L106, L141
+bne L121
+jmp *r3
+jsr L220
+stop
+prn *r1
+not r6
+not *r5
+jmp L117
+jsr *r6
+stop
+L91: mov #-126, r2
+sub #183, L306
+L92: not L122
+prn *r6
+add #-6, r3
+jsr *r1
+sub r3, *r0
+; comment
+L93: dec L309
+jmp *r7
+L94: prn r6
+sub #94, *r6
+L95: prn *r6
+cmp r0, r0
+L96: not r7
+sub #107, *r3
+
+mov r5, *r4
+L97: .string "iwglillaphrvv"
+cmp #-230, #125
+clr L297
+not *r6
+sub L312, r7
+L98: rts
+bne L266
+mov r4, r1
+L99: .data 163, -116, 407, 359, -259, 780, 562, -448
+prn #3
+dec L260
+L100: inc *r5
+; comment
+not r0
+add L299, *r0
+sub *r6, r4
+L101: jsr *r4
+L102: cmp L114, *r0
+mov #1, L309
+; comment
+mov r5, L183
+L103: not *r5
+bne L164
+L104: .data 597, -183, 552, -960, 771, -687, 895, -356
+inc *r0
+L105: red r2
+clr *r6
+red *r7
+; comment
+cmp *r4, *r6
+
+clr r7
+jsr *r2
+L106: .string "ekezzwiicghgowgr"
+mov *r1, *r6
+clr r5
+red *r5
+prn L155
+L107: jmp L329
+L108: .data 87
+mov L226, r0
+L109: clr r7
+lea L206, L171
+inc L261
+jmp L321
+
+rts
+jmp L163
+
+mov L150, *r1
+mov L216, r6
+inc *r3
+
+L110: not *r3
+stop
+dec L198
+L111: .data -430, -214, -582
+; comment
+L112: jmp *r3
+L113: red L194
+lea L226, r3
+lea L325, L132
+dec *r3
+stop
+L114: prn *r4
+dec *r6
+L115: lea L274, L204
+clr L284
+jsr L250
+jsr L292
+not *r4
+stop
+mov r7, r6
+inc r4
+
+L116: .data 676, -343, 109, 958, -740, -179, 636
+L117: stop
+bne L248
+L118: .data -408, -389, -788, -830
+sub *r3, r0
+L119: cmp #254, L199
+rts
+mov *r2, r4
+not *r0
+not r4
+L120: lea L322, r6
+mov #-199, r1
+prn #14
+lea L265, r4
+jsr L173
+clr r2
+not r2
+stop
+jsr *r7
+jmp *r0
+red L128
+jmp L306
+red *r4
+mov r6, *r6
+prn L132
+cmp *r6, *r4
+L121: prn *r7
+rts
+L122: cmp r6, *r7
+dec *r5
+rts
+red r7
+L123: red *r6
+stop
+red *r2
+sub L212, r7
+lea L190, r0
+add r2, L207
+L124: .string "xwpqllvneje"
+red L189
+L125: red r4
+L126: not r1
+L127: lea L166, *r0
+L128: .string "kuo"
+sub #241, *r1
+L129: prn L146
+jsr *r1
+L130: bne *r3
+add #241, L155
+L131: cmp r6, #-192
+jsr *r0
+not *r7
+not L239
+dec r5
+bne *r0
+stop
+mov L325, L174
+L132: .string "mtcezrkcpsr"
+dec *r0
+prn r6
+L133: stop
+inc r2
+L134: dec r3
+L135: mov L190, *r5
+jsr L192
+L136: stop
+L137: .string "mclbdjvxaefzblqprbcutusz"
+bne L317
+add *r2, *r6
+sub *r3, r1
+jmp *r0
+lea L232, r4
+jmp L142
+prn #-181
+inc r3
+L138: inc *r5
+add r1, r7
+L139: rts
+not *r6
+
+prn L223
+dec L197
+lea L317, r0
+clr L156
+prn *r2
+L140: .data -576, -154, 54, -899, -105, 173, -216, 609
+; comment
+prn L196
+jsr L276
+cmp r5, *r5
+stop
+rts
+L141: prn #-8
+L142: lea L182, *r7
+L143: bne *r4
+L144: jmp *r5
+sub #18, *r1
+sub #121, r4
+cmp *r6, #10
+L145: not L164
+L146: .string "sutgtmifipzksmrde"
+L147: mov #204, *r7
+prn #-222
+L148: .string "geccaf"
+clr L184
+L149: stop
+L150: not r2
+L151: .string "vg"
+sub *r7, *r6
+dec r5
+add #143, r3
+L152: sub L271, r3
+L153: cmp r4, *r0
+
+L154: mov L267, r7
+L155: cmp r6, L283
+inc *r1
+add L316, *r1
+jmp L162
+stop
+L156: .string "cish"
+add *r0, r7
+stop
+dec r4
+L157: .data 137, 22
+L158: red *r3
+not L191
+inc *r5
+L159: .string "rixoghwjsrvjezqr"
+red L252
+L160: red r4
+mov L309, L228
+inc L251
+L161: red *r6
+dec r7
+L162: .data 555, 271, -188, -619, 922
+L163: .data -455, -739, -714
+cmp *r2, L306
+L164: .string "p"
+L165: stop
+L166: inc r4
+L167: .data -286, -136, -830, 205, 162, 493, -50, 375
+prn r5
+lea L280, *r6
+lea L198, *r2
+cmp r0, r5
+lea L287, r1
+bne L242
+bne L172
+L168: red r5
+sub r5, r0
+L169: mov L328, *r3
+
+jmp *r2
+sub *r2, *r7
+L170: clr *r2
+
+dec r6
+inc L209
+cmp #107, r5
+clr r6
+L171: .string "jfswlscwrcalacjmcvaeyxn"
+inc L223
+bne L234
+stop
+rts
+L172: red r5
+inc r4
+mov r2, L246
+inc r6
+; comment
+mov #-35, r3
+rts
+L173: .data 802, -434, 944, 376, -609, 207, 31
+
+cmp L323, #-48
+inc r2
+bne L178
+jmp *r5
+dec L196
+; comment
+jsr *r3
+L174: prn r7
+dec r4
+
+add L303, L327
+L175: clr r4
+sub #-189, r1
+dec *r3
+; comment
+L176: .string "bnqxyunvkdklfklwosqjbmk"
+L177: .string "jmydemrkogmcrq"
+lea L313, r4
+red r1
+L178: cmp L190, *r5
+red L193
+L179: .string "fnmkyt"
+clr L310
+L180: .data -850, 360, 695, -718, 754
+bne L204
+mov *r2, *r3
+jsr *r1
+L181: mov r6, r6
+; comment
+red L307
+stop
+L182: .data -221, 169, 387, 582, 117
+L183: clr L307
+sub *r3, r6
+L184: mov *r1, L295
+L185: dec r1
+L186: sub L245, r7
+L187: cmp *r3, *r1
+L188: add #4, *r0
+L189: not *r7
+L190: rts
+red *r6
+L191: stop
+lea L195, r6
+not *r2
+prn L248
+jsr *r2
+mov *r7, r0
+sub r3, r5
+dec *r7
+stop
+L192: red L205
+add *r4, L198
+jmp *r7
+L193: clr *r1
+prn #-15
+prn L291
+clr *r2
+L194: red L251
+L195: dec L270
+lea L221, L260
+lea L295, L327
+L196: cmp L272, *r5
+L197: jmp *r0
+; comment
+inc r1
+jmp L228
+add *r6, *r0
+L198: .string "igqspevdju"
+L199: sub *r6, *r5
+dec *r6
+rts
+jmp L201
+red L202
+mov L273, r2
+L200: mov *r3, *r5
+dec *r7
+not *r7
+L201: prn r4
+cmp *r5, r4
+mov L249, L229
+L202: .string "uuuysqdkbpxpkfmqbeweohh"
+mov r3, *r1
+cmp *r3, L291
+jmp L301
+add L278, L247
+mov *r7, r1
+red r2
+L203: bne L210
+L204: .string "dfppyhbstaz"
+
+clr r3
+L205: stop
+L206: clr r2
+L207: bne L213
+L208: sub *r3, *r6
+clr *r4
+; comment
+add L315, L294
+L209: .data 359, 370, 86
+not L317
+L210: dec *r3
+mov #-44, *r2
+red *r1
+L211: .string "wqbjbzrztvaasodjznvpou"
+sub L259, r4
+cmp *r3, #151
+prn r1
+sub *r0, r0
+L212: rts
+L213: not L280
+bne *r3
+sub #-178, *r0
+add *r7, L257
+L214: clr *r4
+L215: rts
+clr *r5
+L216: red *r0
+L217: .data 694, -132, 157, 940, -841
+red L312
+L218: jmp L268
+L219: .data 393, -915
+add #98, r7
+lea L307, *r4
+L220: inc *r4
+L221: not *r1
+; comment
+L222: rts
+L223: prn L241
+jsr L292
+L224: dec r0
+lea L299, *r6
+L225: .string "zwkbceaghpns"
+rts
+rts
+prn *r2
+mov L309, L236
+L226: stop
+bne L327
+L227: prn L319
+red *r6
+stop
+L228: prn r2
+L229: mov #-45, L244
+L230: clr r1
+mov L279, r0
+prn *r2
+L231: not r0
+L232: .string "jjfoarpqvkb"
+red *r6
+sub *r3, *r2
+red L307
+jmp *r0
+jsr *r6
+prn *r3
+jmp L306
+red L247
+L233: lea L300, r3
+L234: .string "wxpeakrabouagtiiqods"
+jmp L256
+L235: red *r6
+rts
+add r6, r1
+L236: .string "rnshkq"
+
+sub #-173, r1
+L237: .data -26, 977, -340, 538, -267, 146, 762, 913
+L238: not L323
+mov #81, *r2
+cmp #26, r5
+L239: prn L293
+jmp *r3
+rts
+jmp L324
+rts
+stop
+L240: red r7
+L241: dec L265
+add *r7, *r1
+inc *r1
+
+jmp *r2
+prn r3
+cmp #136, r5
+mov *r0, L247
+lea L248, *r0
+L242: bne *r1
+inc r0
+L243: mov L249, *r0
+mov #-3, L251
+dec r2
+stop
+not r1
+L244: rts
+jmp *r0
+bne *r4
+L245: inc L319
+; comment
+L246: prn #-184
+L247: .string "dkemdugk"
+prn *r6
+L248: stop
+L249: clr r1
+red *r4
+red L291
+mov #10, *r3
+rts
+L250: stop
+add #-193, *r2
+jsr *r6
+stop
+prn r1
+L251: lea L288, r0
+L252: inc L281
+; comment
+L253: not *r5
+L254: sub #183, *r0
+dec L284
+L255: red L321
+L256: not *r5
+inc L295
+dec r3
+sub r4, *r4
+L257: stop
+cmp L284, #11
+L258: inc *r1
+L259: lea L297, *r7
+L260: bne *r3
+mov r4, L275
+inc L315
+jsr *r6
+L261: .data -114, -720, 943, 261, -646, 708, 879
+not r3
+L262: cmp *r6, r5
+L263: red *r4
+L264: not *r0
+rts
+lea L296, r4
+L265: .data 439, -679, 426, -312, 361, 26, -137
+add r1, r5
+L266: .data -738, -602, 476, -963
+jsr *r6
+L267: sub #-254, L305
+lea L312, L304
+L268: red r0
+add r3, *r7
+L269: sub #43, L325
+dec *r1
+add L327, *r5
+dec r0
+inc r3
+L270: bne *r4
+mov *r6, r7
+lea L306, *r1
+rts
+dec r7
+add L315, r1
+inc L321
+L271: .string "sydnflwjfamgocuasnjjmkyz"
+lea L303, r3
+dec r7
+L272: .string "mvpshmwnuyguzplnux"
+L273: prn r1
+L274: inc L282
+inc r4
+red L314
+rts
+prn #-129
+L275: .string "pclhsmeng"
+L276: .string "byxjnhhfxtanexfiersnr"
+red L289
+rts
+L277: stop
+mov L295, L281
+sub r4, L306
+L278: bne L281
+bne L322
+L279: .string "bfiduekepzvusl"
+not r4
+not L316
+dec r4
+jmp L321
+prn *r7
+add *r1, r2
+L280: sub L308, r5
+clr L315
+L281: add #-224, *r0
+sub L305, *r5
+rts
+jmp *r3
+jmp *r1
+L282: red r4
+L283: sub *r4, L293
+; comment
+lea L288, L324
+cmp r2, *r0
+jsr L322
+L284: jmp L298
+dec L287
+L285: jsr *r5
+L286: .data 31
+sub L308, r3
+red r6
+L287: bne L299
+sub *r3, L328
+mov L298, *r4
+L288: lea L297, r1
+clr r3
+bne *r2
+jmp *r3
+L289: dec r4
+add #-35, r1
+lea L329, L296
+inc *r7
+
+prn #185
+prn L299
+L290: dec *r6
+cmp r4, r3
+L291: jsr L325
+clr r4
+jsr L297
+not *r3
+inc *r3
+L292: stop
+dec L296
+L293: clr L323
+L294: add #167, r2
+prn L325
+L295: stop
+add #122, *r0
+bne *r0
+jsr L301
+L296: prn #209
+L297: .string "llqrwxqo"
+stop
+cmp L312, r3
+inc L300
+L298: .data 585, -305, 327, -710, 904, 330, 855
+L299: .data -325, -126, -753, -666
+inc *r5
+L300: bne L327
+L301: dec L321
+prn #-26
+L302: prn L321
+L303: mov L306, L314
+rts
+prn *r1
+red *r0
+mov r2, *r6
+sub r7, r0
+; comment
+clr r5
+rts
+sub #-63, r6
+add #181, r5
+add L324, L328
+rts
+L304: jsr *r6
+mov r5, *r7
+cmp #68, r1
+L305: .string "rpucnphvkbmewxfuqvqvpx"
+clr *r0
+stop
+L306: prn r7
+bne *r1
+add *r7, L310
+L307: inc *r2
+bne L308
+bne L322
+red *r2
+sub *r4, *r1
+mov r5, L325
+inc *r0
+mov L328, L324
+clr r6
+L308: mov L326, r6
+inc *r4
+L309: red r0
+clr *r3
+bne *r0
+L310: prn L329
+add r4, *r0
+jsr *r0
+mov r5, r1
+inc *r6
+prn L325
+L311: mov *r7, *r7
+jsr L321
+jmp L315
+; comment
+dec r2
+jsr L316
+L312: sub L322, *r7
+L313: lea L326, L324
+L314: stop
+rts
+red *r5
+clr L319
+jsr L323
+L315: jmp L317
+sub #-66, L322
+add #32, *r5
+inc L324
+L316: rts
+inc r4
+cmp #-111, L317
+lea L322, *r6
+L317: .data 593, 860, 125, 760
+lea L319, *r1
+; comment
+prn *r5
+L318: .data 746, 6
+L319: jmp L321
+red *r3
+red r4
+prn *r1
+L320: add *r7, L327
+bne *r1
+not L328
+sub L324, L327
+red r0
+inc *r6
+rts
+clr *r5
+mov L327, L321
+cmp r7, r7
+L321: jsr L325
+prn #19
+L322: lea L325, *r6
+L323: .string "wcnynriifkxdsrbiidqtvm"
+add r0, r5
+add r1, L328
+
+L324: cmp L329, #146
+
+inc *r6
+lea L325, *r7
+not *r4
+
+prn r3
+prn #68
+inc *r7
+L325: .data 87, 356, 990, -864, 999, 296, -592, -114
+jsr *r0
+bne L329
+L326: stop
+cmp #-52, r4
+L327: stop
+L328: prn r6
+cmp L329, #-107
+jsr L329
+L329: jmp *r7
+jmp L1
+inc r2
+stop
@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 22
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: clr *r5
+bne *r4
+jmp *r6
+L1: .string "jjkxe"
+prn L89
+L2: red L9
+L3: jsr *r2
+L4: jmp L222
+
+clr r6
+; comment
+red L281
+red *r6
+L5: prn L159
+L6: dec r5
+mov L47, *r5
+L7: sub r6, r7
+L8: inc r6
+L9: .data -850, 752, 798
+jsr *r5
+stop
+L10: .data -411
+L11: mov r0, L149
+L12: bne *r6
+L13: red *r6
+not r2
+bne L211
+L14: inc *r2
+inc *r6
+not L71
+bne *r7
+; comment
+add r7, L261
+red r6
+sub r2, *r4
+stop
+jmp L331
+L15: prn *r0
+prn r5
+bne *r5
+L16: not L149
+lea L286, L66
+bne L71
+L17: mov *r0, L297
+L18: dec *r1
+L19: bne *r3
+L20: .data 685, -802, -303, 145, 583
+not r3
+
+lea L74, L290
+jsr *r2
+L21: jsr L211
+add #-94, L151
+prn L167
+L22: .string "it"
+; comment
+L23: red *r0
+red *r3
+jmp L327
+add L246, *r3
+jmp L188
+lea L138, L261
+sub #-84, r5
+L24: add *r0, L335
+
+prn r4
+jsr L268
+L25: mov r5, *r6
+bne *r6
+L26: jsr L47
+L27: .data -373
+cmp r6, #-109
+stop
+not r7
+cmp L138, L282
+L28: not L234
+bne *r5
+L29: lea L143, L214
+L30: clr L246
+L31: .data -817, 920
+jmp *r2
+inc r6
+jmp L179
+cmp L38, r4
+clr L60
+mov L251, *r5
+clr r6
+stop
+cmp r0, L254
+jsr L172
+prn L242
+bne *r1
+stop
+dec r6
+L32: stop
+inc L234
+rts
+cmp *r3, *r7
+jsr *r4
+inc L217
+L33: prn #69
+stop
+L34: rts
+; comment
+; comment
+jmp *r0
+L35: lea L196, *r4
+rts
+L36: rts
+sub #58, L232
+jsr L57
+jmp *r3
+cmp L249, r4
+L37: clr r3
+dec r5
+L38: prn L296
+L39: mov #189, *r1
+clr *r5
+L40: rts
+L41: bne *r6
+red r6
+red L336
+prn #-196
+L42: .data 915, -416, -204, -226, 286, 586, -850, 562
+L43: mov L121, *r3
+prn r4
+L44: inc r5
+L45: mov r3, *r2
+L46: clr *r3
+prn r7
+L47: not *r7
+L48: inc *r1
+jsr *r2
+L49: .data -374, 851, -875, -833
+L50: prn r3
+clr *r4
+cmp r6, *r5
+L51: add L306, L332
+jmp L80
+stop
+jmp *r2
+mov #-52, L101
+bne *r6
+L52: jmp *r3
+L53: add #97, L110
+lea L114, r4
+lea L88, *r0
+jmp L300
+stop
+cmp *r0, *r3
+L54: .string "uxgqbrblydmoigtdotz"
+prn *r1
+lea L112, *r1
+lea L97, r7
+L55: mov *r2, r6
+L56: inc *r7
+
+prn #-185
+stop
+L57: .string "vnkef"
+L58: stop
+clr L155
+jsr *r7
+not L308
+sub #-82, *r0
+clr r0
+L59: inc L140
+L60: stop
+; comment
+jmp L211
+bne *r3
+cmp L83, *r5
+L61: prn L117
+L62: mov r4, *r6
+dec L305
+jsr *r7
+L63: .string "br"
+prn #158
+sub *r4, r1
+jsr L136
+L64: sub r0, r6
+L65: .data -802, -151, -47, 384
+L66: mov L208, L253
+rts
+; comment
+L67: prn L154
+L68: cmp L220, *r3
+L69: mov #150, r0
+clr r3
+clr *r2
+clr L110
+sub r1, r3
+red L272
+L70: .string "vwgmfga"
+cmp *r7, *r1
+L71: not L204
+L72: .data 840, -905
+L73: sub r2, *r3
+inc *r3
+; comment
+not r7
+L74: clr L289
+bne *r0
+not *r6
+jmp *r6
+sub r1, r4
+L75: inc L225
+jmp L105
+inc *r2
+add #-147, L146
+inc *r4
+L76: lea L171, *r1
+lea L180, *r7
+bne *r4
+inc r4
+
+L77: inc L301
+L78: .string "urhr"
+red L107
+cmp r4, #171
+sub #133, *r7
+clr r2
+bne L148
+L79: rts
+sub #-2, r2
+
+add #-74, L331
+L80: .data -671, -891, 728
+not r3
+rts
+add L321, L91
+L81: rts
+inc L108
+prn *r4
+rts
+cmp r3, L169
+cmp r2, #-89
+rts
+L82: red L335
+sub #-27, r4
+L83: mov #218, *r7
+inc *r0
+inc r1
+red L91
+jsr *r5
+not r5
+jsr L86
+L84: .string "nstce"
+add #163, *r1
+L85: red L120
+stop
+L86: rts
+L87: bne L206
+cmp r3, r6
+; comment
+L88: sub L260, r4
+dec r0
+prn L102
+prn *r1
+mov #101, *r1
+L89: .string "dtcqhr"
+rts
+rts
+sub #-216, *r4
+L90: cmp #-205, L157
+dec L259
+L91: stop
+L92: .data 621
+L93: dec r4
+clr L116
+inc r5
+sub r5, *r5
+add r3, L260
+L94: clr *r7
+mov *r4, *r0
+mov *r7, L275
+bne L155
+prn #-42
+cmp L235, *r4
+rts
+L95: cmp L197, r6
+stop
+L96: cmp r5, r7
+clr L116
+L97: lea L261, L166
+clr r3
+mov L218, L243
+dec *r4
+
+L98: prn #94
+L99: jsr *r1
+sub r5, *r0
+L100: .string "w"
+add L229, *r3
+add *r1, *r6
+L101: .data -204, -279
+red L198
+lea L223, *r7
+mov r2, *r7
+; comment
+red *r7
+jmp *r4
+; comment
+L102: clr L226
+inc *r0
+L103: prn #119
+L104: not r3
+rts
+dec r1
+sub #69, r6
+sub r3, *r5
+bne *r1
+; comment
+L105: stop
+not *r6
+dec L207
+stop
+prn L229
+L106: stop
+jmp L144
+red L286
+inc L138
+jmp L243
+L107: not r4
+L108: prn #182
+lea L111, r5
+stop
+L109: inc L180
+L110: prn r0
+L111: jmp *r6
+L112: mov r7, *r4
+lea L295, L171
+cmp L253, *r0
+dec r0
+mov #-220, L215
+add *r4, L280
+cmp #-91, *r7
+jmp L178
+rts
+not r1
+L113: inc L282
+L114: jsr L269
+L115: not *r5
+bne *r6
+red L218
+sub *r4, *r5
+rts
+red r7
+L116: .string "uuyfyssvstvyganu"
+sub r7, L163
+L117: rts
+sub L299, L283
+sub *r3, *r4
+L118: add *r2, *r0
+L119: mov L219, L301
+prn #-81
+L120: .data 95
+red *r0
+bne L138
+add r7, r2
+clr r3
+rts
+dec r7
+jsr *r3
+L121: red L252
+mov #-184, L195
+L122: .data 13, -591, -758, -723
+prn *r4
+; comment
+dec r2
+L123: bne *r2
+L124: .data 730, 166
+L125: jmp *r1
+lea L292, *r7
+L126: .string "ijjccg"
+sub #104, L154
+L127: prn L189
+L128: .string "ivumo"
+add L254, L168
+
+stop
+L129: mov #211, r6
+L130: cmp r1, *r7
+clr L253
+rts
+
+dec *r6
+mov #65, r0
+cmp #179, L252
+bne L180
+clr *r6
+L131: .string "owycygmtsf"
+cmp #-137, *r3
+jmp L158
+lea L178, *r4
+L132: clr *r0
+lea L300, r6
+red *r6
+L133: stop
+L134: .string "m"
+not *r0
+
+jmp *r3
+prn #231
+L135: dec r1
+L136: prn L294
+not r0
+dec *r6
+prn L211
+L137: .data 304, -50, 872, -78, -131, 164
+L138: red r4
+L139: .string "cmverkoswnvdfbiz"
+not L141
+inc *r0
+add *r5, *r5
+inc r0
+add L319, *r5
+mov r2, *r7
+L140: not r1
+L141: stop
+
+mov *r3, r4
+L142: jmp *r1
+mov L314, r4
+jmp *r6
+not L256
+inc r5
+lea L303, *r0
+rts
+cmp L160, #-118
+add *r7, *r4
+cmp *r0, L266
+L143: .data 75
+jmp L270
+L144: rts
+bne *r2
+L145: jmp L153
+prn #197
+L146: lea L243, *r5
+dec L317
+add *r3, r1
+cmp L237, r2
+L147: mov L159, r0
+rts
+mov *r2, *r7
+cmp r2, *r2
+bne L289
+L148: jsr *r1
+L149: lea L274, L324
+cmp r7, L257
+stop
+
+
+L150: add *r1, *r7
+lea L257, L207
+jmp L231
+clr r0
+bne *r2
+sub *r4, *r5
+stop
+inc L179
+cmp r5, *r5
+L151: bne L178
+cmp *r3, r3
+cmp *r2, L271
+L152: add L321, r4
+lea L220, L285
+clr *r0
+L153: .string "jphraaejwvxspcikpvzikcmr"
+cmp *r0, *r2
+stop
+jmp L300
+L154: .data 230, -950, 803, -131, -427, -358, 75, -625
+
+not r5
+L155: rts
+; comment
+L156: prn *r5
+add #159, r7
+L157: .data -145, 366, -996
+bne *r5
+L158: .string "b"
+jmp *r6
+red L199
+not L267
+L159: mov *r3, *r7
+L160: .string "imrdjzdsdwwkvldlosdhslcy"
+sub *r6, L204
+; comment
+stop
+L161: prn *r2
+inc L198
+L162: jmp *r2
+L163: not r1
+L164: .string "hqpvydx"
+red L326
+jmp *r1
+inc L309
+L165: .data 602, -654
+sub r5, *r1
+L166: clr *r2
+clr r1
+prn L257
+L167: mov #72, r0
+inc r5
+; comment
+L168: lea L217, L276
+L169: rts
+stop
+L170: .data 729, 495, -965, 856, -923, 140
+dec L224
+L171: add #127, r3
+jsr L173
+L172: .data 464, -537, 809, -133, -686, -571, -962, 973
+sub L178, *r0
+sub *r1, r3
+jmp L226
+rts
+L173: sub *r1, L255
+L174: bne *r7
+L175: cmp r3, L273
+cmp L245, #-58
+jsr L203
+L176: rts
+rts
+add #-89, L298
+bne *r1
+stop
+stop
+rts
+mov L296, r5
+; comment
+L177: .data 209, -53, 797, 16, 424, -82
+cmp #-188, L296
+L178: jsr *r3
+
+jsr *r5
+prn *r0
+clr *r6
+lea L301, r3
+not *r7
+L179: prn #-95
+cmp L242, *r0
+L180: rts
+lea L236, r0
+sub r2, r6
+jsr *r3
+L181: prn #-96
+mov L256, r3
+bne L326
+red r7
+L182: jmp *r4
+L183: stop
+L184: prn L294
+inc r2
+L185: .string "xdgnuyydevlabifymevgztl"
+dec *r0
+not *r7
+mov r7, *r7
+L186: clr L282
+jsr L293
+L187: not r6
+dec r3
+L188: inc r7
+L189: prn *r3
+jmp *r7
+prn #-110
+sub L327, r6
+
+cmp L214, r1
+cmp *r7, r5
+L190: cmp *r2, #-153
+clr *r4
+cmp *r0, *r7
+cmp #171, r3
+sub *r3, *r5
+bne L261
+prn L299
+bne L309
+L191: prn #236
+L192: sub *r1, L287
+cmp L239, r0
+dec *r0
+red L330
+cmp #69, #7
+inc r3
+L193: rts
+stop
+mov r6, *r7
+bne L237
+cmp r3, L210
+not *r6
+dec *r2
+jsr L325
+bne *r4
+clr *r7
+inc *r5
+L194: red L285
+L195: bne L197
+L196: add r2, L205
+prn L309
+L197: not r7
+stop
+L198: lea L275, L295
+stop
+bne *r2
+
+L199: sub L245, *r2
+L200: sub #211, *r5
+L201: clr L250
+lea L259, *r4
+jsr L304
+L202: .data -715, -776, 79, -803, 845, -396, 557
+stop
+L203: inc L299
+L204: bne *r7
+L205: .data 731, 164, -716, -154, 52, 548
+
+mov L317, *r3
+rts
+L206: cmp L230, r0
+L207: .data 885, 578, -635, 356, 629
+prn #44
+sub L271, *r0
+jmp L282
+sub r0, *r0
+bne L253
+stop
+jmp L225
+jsr *r5
+L208: .data 954, -524, -432
+L209: clr r1
+prn #-10
+add *r4, r0
+rts
+L210: jsr *r1
+mov #107, L227
+inc L280
+cmp *r3, #42
+L211: .string "sfbwzvhvuivqpsxrzhm"
+; comment
+prn #214
+rts
+mov *r7, L225
+L212: .data -773, -942
+not r5
+dec L293
+prn *r2
+L213: stop
+
+prn *r4
+clr r1
+red r5
+bne *r5
+bne *r5
+mov *r5, *r3
+add r4, r5
+L214: .string "jsnwvbbknwho"
+L215: .data -397, 900, -318, 181, 284, 527
+L216: add *r3, r3
+L217: .string "zdfxjbpeb"
+lea L322, r0
+jmp *r1
+jsr L248
+dec L243
+L218: clr *r4
+jmp *r6
+L219: rts
+dec *r0
+cmp *r3, r7
+rts
+red r4
+L220: prn *r4
+
+L221: stop
+cmp L327, #128
+; comment
+prn #41
+; comment
+; comment
+add *r4, L239
+prn L237
+rts
+jsr L298
+L222: .data 298, -143
+L223: .data -556, -651, -359
+dec *r1
+clr r5
+sub *r1, r2
+L224: rts
+cmp *r2, *r0
+red L228
+lea L322, *r1
+sub r7, r4
+inc r1
+bne L319
+L225: jsr *r4
+L226: red L252
+L227: .data -269
+inc r2
+jsr *r3
+add L318, L309
+mov L269, *r6
+L228: not *r1
+L229: prn #-191
+L230: lea L270, *r6
+L231: jsr *r5
+L232: .data 12, -624, -550, -704
+mov #245, L249
+jmp *r4
+L233: .data -1, -141, -564, -33, -573, -154
+cmp #-30, #-20
+cmp #91, r0
+red L286
+L234: not *r6
+rts
+inc *r7
+add L336, L247
+L235: .string "oghndpgmqmyizxzgtv"
+red r7
+L236: .data -292, -897
+dec L282
+L237: not *r5
+L238: jmp *r4
+L239: sub *r3, L270
+red r5
+sub #171, L258
+L240: rts
+sub *r6, L273
+L241: .data 572, 846
+add L306, L280
+; comment
+cmp #58, r0
+dec r5
+L242: mov #-86, r3
+L243: add L300, *r3
+L244: lea L274, r5
+L245: jmp L261
+L246: .string "qputexjyoc"
+cmp *r3, L265
+L247: add L311, L307
+L248: sub L285, L292
+stop
+L249: lea L295, L289
+stop
+L250: stop
+L251: .data -204, 126, -382, 720, -911, -711, 403, 848
+lea L278, r5
+sub #-109, *r3
+jsr L324
+L252: .string "uzuprykk"
+jsr *r3
+L253: dec L264
+mov L311, r1
+; comment
+inc r4
+L254: .data 769, 122, -376, -790, -901, -860, 971
+; comment
+L255: .data 286, 41, -652, 922, -124, 432, 131
+not L307
+bne L301
+L256: add #-129, *r2
+jmp L311
+inc r3
+lea L301, r6
+L257: sub r1, r3
+; comment
+L258: lea L264, r2
+red *r7
+clr r6
+inc r0
+rts
+dec r5
+; comment
+L259: bne *r4
+prn #-18
+jmp L299
+cmp *r5, #226
+rts
+L260: .string "whdstmtdln"
+L261: .data -987, 825
+L262: inc *r6
+not r0
+cmp L314, #105
+red L312
+L263: not *r0
+bne L325
+add #155, *r3
+inc *r6
+L264: clr L277
+L265: .data -812, -453, -506, 19, -506
+not r5
+L266: .data -454
+sub #173, L333
+jsr *r5
+lea L307, r1
+stop
+red r1
+jmp L279
+L267: .data -305
+L268: .data -596, -346, 458, 547, 34, 617
+rts
+jsr *r5
+sub *r3, *r3
+stop
+prn *r7
+bne *r2
+jsr *r2
+dec L303
+bne L294
+add *r3, r3
+
+L269: prn *r6
+jmp L315
+L270: jmp *r5
+L271: dec r3
+L272: inc L286
+L273: .string "hhbtmhnybpbmvsmcarwd"
+red *r7
+not r4
+
+L274: prn L282
+L275: rts
+L276: prn r0
+jmp L321
+
+jsr *r0
+L277: .string "rlfdvxeffnhvd"
+sub *r6, L304
+L278: jmp L308
+L279: stop
+L280: red r0
+L281: inc L326
+sub *r7, r3
+L282: .data -833, -523, -73, 682
+prn *r3
+red L317
+inc r3
+rts
+add *r1, *r5
+L283: .data 484, 216, 210, 639
+red L294
+L284: .string "yaecbbvzftoiheimn"
+stop
+not L286
+bne *r6
+rts
+rts
+red L328
+cmp r4, *r2
+L285: red *r6
+L286: bne L301
+cmp #190, *r0
+; comment
+mov #-256, L319
+dec *r0
+not L287
+
+sub L289, L295
+sub L296, *r5
+L287: .data -898
+L288: add L303, *r7
+L289: .string "gyhyjgaogy"
+not *r1
+rts
+L290: stop
+L291: mov #95, L315
+L292: inc *r2
+L293: mov L296, r6
+inc L303
+not *r3
+L294: inc *r0
+
+mov L299, L324
+L295: cmp L317, r4
+rts
+L296: jmp *r3
+red *r0
+L297: lea L311, r1
+L298: stop
+L299: inc r5
+rts
+bne *r0
+
+clr *r0
+dec L309
+inc L327
+red L336
+add #-25, *r5
+red r4
+not *r2
+inc L300
+red L328
+inc r2
+cmp *r7, L314
+L300: add *r4, r1
+L301: jmp *r6
+inc r0
+; comment
+dec *r1
+dec r4
+L302: dec *r6
+L303: mov *r0, L323
+rts
+add #-48, r7
+inc *r4
+
+jsr L309
+lea L325, L320
+L304: .string "emlscblguovkawemmjemc"
+jmp *r4
+L305: cmp r6, L307
+add #-147, r4
+mov L326, L318
+not *r5
+jsr L328
+L306: lea L319, r2
+L307: sub *r0, L328
+L308: .data -412
+inc r1
+L309: prn *r7
+L310: lea L314, L316
+L311: rts
+lea L316, r0
+jmp *r7
+L312: add L314, L327
+mov r0, r0
+mov *r2, r4
+mov #-252, L325
+L313: prn L315
+jmp *r7
+not r7
+inc *r2
+L314: prn r7
+mov *r0, L327
+jsr L335
+sub *r6, r3
+L315: .string "ybyiaejtndjiv"
+dec *r1
+L316: prn #-63
+inc L333
+L317: cmp #-117, *r7
+dec L336
+add L331, r6
+L318: clr *r3
+L319: jmp L333
+L320: mov r6, r6
+L321: clr *r1
+prn *r1
+sub *r2, L331
+not r6
+dec r0
+L322: sub L326, L330
+inc *r2
+not L323
+sub *r3, *r0
+L323: lea L327, L325
+L324: red *r5
+cmp *r6, *r6
+L325: .data -980, -495
+add L329, L330
+inc r7
+inc *r6
+L326: dec *r5
+stop
+lea L330, *r0
+L327: sub L334, *r5
+jsr L336
+clr *r6
+sub r0, L336
+L328: .string "nsnzzxdgzbohawfzptu"
+dec *r2
+L329: cmp L333, r3
+lea L336, *r1
+L330: sub L332, L331
+jmp L335
+red r6
+not L336
+L331: prn #116
+prn r4
+L332: clr L335
+L333: .string "k"
+L334: rts
+dec L336
+mov L335, r3
+jmp L336
+stop
+
+red L335
+L335: stop
+
+cmp #-234, r7
+; comment
+L336: red *r4
+sub *r0, *r0
+red *r4
+dec *r4
+cmp *r1, #246
+inc *r4
+mov r0, r1
+stop
@@ -0,0 +1,1023 @@
+; Generated by genCorpus --seed 23
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+dec L106
+add L0, *r0
+cmp r6, r4
+L0: jsr L24
+L1: inc L99
+sub #9, L75
+L2: .string "adkcwbwfpxguwysiajd"
+L3: add L253, r7
+bne *r2
+jmp *r2
+cmp #29, r1
+mov #102, r5
+L4: .data 928
+cmp r4, L263
+jmp *r2
+; comment
+lea L143, L72
+dec r6
+prn #161
+; comment
+L5: .string "sdunyzulcyxzud"
+rts
+not *r4
+L6: clr r7
+sub L123, L163
+lea L145, L218
+red L81
+L7: jmp L189
+dec r4
+red r3
+not *r7
+L8: sub #249, L212
+L9: red L183
+sub #80, r3
+mov #129, *r7
+cmp #78, *r2
+cmp L296, *r5
+cmp r1, #161
+jmp L265
+
+L10: cmp L179, L220
+add #-14, L65
+L11: .data 807
+lea L40, r6
+rts
+L12: inc *r5
+rts
+sub L265, r7
+lea L137, r6
+sub L93, *r4
+L13: add *r4, L282
+red r6
+inc L15
+sub #38, *r4
+clr *r1
+lea L310, L173
+L14: lea L255, r1
+L15: cmp *r6, L204
+L16: dec *r4
+L17: jmp *r2
+bne L281
+mov *r5, *r5
+L18: not r5
+L19: bne L295
+clr r6
+L20: clr r5
+sub L43, *r3
+stop
+lea L188, *r1
+inc r4
+cmp *r1, *r1
+L21: red r2
+sub L70, r0
+L22: stop
+red L97
+L23: .data 306, -385
+L24: .string "oqxqvylalxefwmjf"
+sub *r1, r4
+L25: .string "vpxuchnodhr"
+inc *r5
+jsr *r4
+; comment
+L26: .string "obpobldlzdrhtgnxnjj"
+add *r7, L109
+lea L107, r0
+mov L57, r0
+mov #247, L198
+rts
+L27: cmp L76, r0
+bne *r7
+clr r5
+; comment
+L28: red r0
+not L134
+rts
+L29: dec *r4
+mov #-108, L211
+L30: red *r1
+cmp L322, #213
+L31: .string "vuw"
+L32: rts
+jsr L94
+jsr *r4
+; comment
+cmp *r6, L220
+not L97
+L33: .data 954
+L34: mov L266, r3
+L35: .string "auxfyadqkuxzjdbefbutq"
+L36: rts
+jmp *r2
+L37: .string "iiaunuwpdgjf"
+clr *r2
+sub L303, L225
+L38: add #-148, *r2
+L39: bne L316
+L40: .string "vaqp"
+prn L281
+L41: .data -738, -286, 232, 574, 794, 508, 194
+L42: mov r7, *r3
+red *r1
+add r4, *r6
+bne *r1
+add L69, *r5
+sub r1, L220
+add L308, r7
+bne L297
+L43: .data -958, -632, 252, 630, 115, 922
+cmp *r0, *r7
+L44: .string "ycpkamnrghspkmz"
+L45: dec r1
+L46: stop
+prn r4
+clr *r1
+jmp *r1
+sub r5, *r2
+L47: sub r1, L115
+bne *r7
+lea L264, *r7
+red r5
+red *r3
+jmp *r4
+dec r3
+inc *r2
+jmp *r7
+L48: rts
+inc *r2
+sub L295, L92
+mov #59, r3
+L49: bne L200
+clr r4
+clr L202
+not r3
+L50: clr *r4
+mov *r1, *r0
+sub *r5, *r3
+jmp L299
+L51: rts
+L52: add r0, L73
+clr r3
+jsr L121
+sub *r7, *r6
+prn *r2
+L53: bne L273
+L54: sub #-83, L223
+mov r0, L159
+not r4
+inc r4
+L55: red *r6
+lea L139, r5
+rts
+add #-182, *r0
+bne *r6
+sub L238, r1
+L56: jmp *r5
+red L203
+lea L82, r4
+L57: .data -733
+L58: dec r4
+L59: mov #-178, *r5
+cmp r6, *r7
+rts
+jsr L224
+lea L248, L184
+; comment
+sub L243, r7
+L60: .string "kjoucjsakrvbhbdfmpgbb"
+bne *r1
+jmp L79
+L61: red r3
+mov #168, L320
+mov L209, r5
+jsr L268
+L62: dec r4
+sub *r2, L268
+bne *r5
+lea L235, r0
+L63: .string "hdwpqyrmqfepmfelqapomqk"
+clr r4
+L64: .data 492, 327, 54, -456, 477
+inc L276
+rts
+cmp L148, r3
+L65: rts
+cmp *r3, *r4
+not L178
+stop
+L66: cmp L252, #72
+prn *r3
+sub *r4, *r7
+jsr L174
+inc *r6
+L67: .data -302
+prn r5
+stop
+clr L251
+add L117, r0
+not *r2
+bne L74
+L68: stop
+jsr L94
+stop
+dec r3
+jmp L174
+cmp *r0, L158
+L69: .string "ibtvdxalojgdvyeiqqomryyy"
+L70: stop
+L71: jsr L131
+bne L301
+; comment
+L72: red *r7
+; comment
+cmp r7, *r3
+L73: red L218
+L74: red L303
+L75: .string "zynbmdnelihpietnvyntsvsu"
+stop
+not r3
+L76: stop
+cmp L318, *r2
+mov r6, *r4
+L77: dec r7
+L78: .string "wrluozlsxraeoppjdnmak"
+bne *r0
+jsr L239
+cmp #25, #137
+dec L164
+L79: clr *r4
+add *r2, L210
+not r6
+bne L274
+L80: add L279, L141
+L81: mov *r5, r0
+L82: rts
+L83: .data -271, -667
+stop
+L84: bne L121
+not *r4
+dec L231
+L85: .string "pbmbttthe"
+cmp L278, r3
+; comment
+L86: inc r3
+L87: jmp *r6
+cmp *r5, r6
+
+inc L264
+sub *r2, r0
+sub #-186, *r0
+jsr L246
+L88: add *r3, r4
+L89: .data -181, 168, 116
+L90: stop
+mov r5, *r6
+jmp *r5
+L91: add *r1, *r2
+dec L189
+cmp #-128, r3
+inc *r6
+; comment
+red L144
+
+L92: .data -395, 25, -202
+dec *r0
+lea L152, *r3
+rts
+bne *r0
+mov r6, *r3
+jmp *r3
+L93: dec L211
+rts
+rts
+jsr L196
+; comment
+L94: .data 822, 34, 191, -585, -782, -616
+L95: cmp *r2, L279
+jmp L197
+L96: dec L184
+clr r2
+L97: jsr L238
+L98: red r0
+jmp *r5
+dec r1
+not r4
+L99: dec *r4
+; comment
+jsr L116
+L100: prn r3
+; comment
+jsr L324
+not r2
+rts
+bne *r5
+lea L125, *r1
+prn L298
+L101: bne *r5
+L102: cmp *r3, *r2
+L103: prn r2
+L104: inc L260
+stop
+add #-55, L316
+dec *r7
+L105: dec L295
+dec *r7
+not *r0
+L106: .data -368, 393, 297
+L107: lea L122, L193
+L108: inc L298
+inc r5
+
+L109: .string "biseoixyasof"
+L110: jmp *r1
+L111: mov L310, *r6
+mov #-42, r2
+rts
+L112: jsr *r3
+lea L116, r7
+L113: .string "alyvieyhx"
+L114: dec L322
+inc L126
+jsr *r2
+cmp L220, L190
+prn #-228
+L115: bne *r7
+red *r7
+L116: rts
+; comment
+L117: mov r2, *r1
+dec L234
+inc L187
+L118: .data -528, -855, -347, 64, -990, -163
+L119: dec *r0
+cmp #-249, *r1
+clr L230
+prn r3
+jmp *r1
+rts
+add r7, r5
+jsr L227
+
+dec r0
+clr r5
+L120: bne *r6
+sub #-129, r1
+dec L259
+L121: sub #6, *r1
+; comment
+inc *r5
+cmp L269, L306
+not r4
+clr L263
+dec L271
+rts
+jsr L241
+mov L213, L314
+add #-210, r2
+inc r6
+rts
+L122: rts
+L123: .string "ydvxidjzdhcewppd"
+jsr L179
+jsr L218
+dec r4
+rts
+L124: dec *r2
+prn #-165
+clr *r0
+L125: clr L260
+red L293
+dec L260
+L126: .data 43, 546, 655, -940
+add r0, r6
+L127: sub r7, L182
+stop
+prn *r5
+inc L305
+L128: rts
+clr *r0
+bne *r4
+jsr L284
+clr L183
+add #107, *r0
+add *r6, L290
+red *r3
+stop
+jmp L136
+cmp #-127, #-244
+L129: not r1
+L130: .data -189
+cmp r6, r1
+not *r0
+L131: bne *r0
+sub r0, *r6
+L132: jsr *r3
+L133: inc r1
+L134: stop
+bne *r3
+L135: red r4
+red L243
+L136: lea L322, L266
+L137: mov *r1, r4
+L138: stop
+jmp *r5
+lea L189, L210
+L139: lea L179, *r3
+clr r6
+mov #200, L253
+L140: clr *r0
+jsr L227
+L141: jmp L222
+L142: bne *r5
+L143: .string "omlmrkunqnjizssbof"
+dec L299
+L144: .data -397, 464, -803, -895, -693, -296, -28, 704
+mov #214, *r5
+sub L176, r2
+red *r0
+L145: add #24, r1
+red L224
+dec r2
+not L172
+stop
+L146: .data -511, 922, 721, 99
+add L163, L164
+jmp *r7
+prn r3
+L147: red L202
+prn L168
+prn r2
+
+L148: .data 11, -381, -668, -194, -903, 131, 12, -909
+prn #-170
+mov *r0, *r3
+not L289
+L149: cmp *r2, *r4
+L150: inc *r6
+rts
+clr r0
+prn L273
+jmp *r7
+lea L165, r7
+prn *r5
+stop
+L151: dec L226
+stop
+L152: .string "p"
+L153: .data -26, -305, 671, -899, -227
+L154: .string "oxixbw"
+mov L283, *r5
+L155: .string "wjpubrclueulm"
+cmp *r4, L158
+sub #217, L229
+L156: jsr L300
+jmp *r2
+dec r5
+cmp r4, L260
+add #39, L188
+lea L215, r0
+cmp #248, r5
+clr L163
+rts
+L157: add #5, *r5
+L158: prn r4
+L159: add r4, r2
+L160: rts
+jmp *r2
+jsr L311
+dec r7
+sub *r5, L168
+L161: stop
+rts
+L162: stop
+L163: inc r0
+L164: cmp r0, *r7
+L165: .data -407, 420, 997, 594, -981, -798
+bne L253
+L166: .data -270, 333, 596, 333, -205, 136
+L167: clr r5
+
+dec r2
+not r3
+sub r3, *r5
+L168: bne L309
+L169: .data 592, 438, -485, 297, -820, 174, -635
+L170: .string "vsnjyihmw"
+add *r2, L252
+L171: .string "lhwzecvbqckckggbcj"
+dec r4
+inc r5
+prn *r1
+mov L248, r1
+jsr L323
+jmp *r7
+; comment
+inc r1
+L172: clr L328
+stop
+L173: rts
+red L194
+cmp *r2, L215
+inc L320
+L174: add r2, *r0
+dec L281
+inc *r3
+L175: lea L279, *r1
+L176: rts
+clr r2
+L177: sub L285, L256
+stop
+L178: jmp *r7
+L179: stop
+lea L303, r6
+prn L324
+clr r1
+bne *r5
+L180: bne *r7
+rts
+L181: rts
+clr r7
+bne *r3
+add #31, r2
+L182: .string "ibjsusuwxqgl"
+jmp L290
+L183: .data -511, -98, -160, -591, 227, -290, 268, -931
+L184: .data -952, -183, 884
+prn #149
+L185: rts
+L186: red L207
+sub L241, *r5
+rts
+L187: .string "thfncddlkhgsvobxdivm"
+L188: rts
+mov r2, L291
+dec r5
+L189: add r2, r5
+lea L281, *r1
+L190: red *r2
+L191: not r4
+L192: .data -791, 695, -939, -104, 637, 405, 803, 877
+prn #183
+L193: sub L212, *r4
+L194: .string "wmvjtfulwhxqtpglwq"
+inc *r3
+L195: prn #-139
+prn r2
+sub r4, L321
+L196: sub r6, r6
+rts
+clr *r6
+L197: inc r3
+dec *r1
+L198: .data -788, 103, 525, 695
+mov L327, r3
+L199: stop
+clr L250
+L200: .data 227, -878, 151
+L201: not r7
+dec L277
+prn r7
+L202: rts
+sub L262, r7
+lea L223, r7
+stop
+rts
+L203: red L246
+bne L240
+prn *r4
+jsr L308
+prn r5
+rts
+bne L238
+red r7
+lea L292, r3
+jmp L313
+L204: not *r0
+inc r0
+rts
+jsr L309
+lea L301, r0
+red *r6
+L205: red r4
+jmp *r7
+mov L296, L292
+mov L236, L315
+inc r1
+dec *r5
+lea L294, r1
+jmp L275
+cmp *r0, L302
+stop
+L206: sub *r2, L225
+inc *r7
+rts
+L207: rts
+; comment
+stop
+cmp L229, #-83
+inc L307
+prn L247
+prn r4
+not r0
+mov #-16, L251
+L208: bne *r6
+L209: .data -267, -415, -885
+L210: add r7, L278
+rts
+cmp #-35, *r5
+L211: red L307
+L212: add L218, r5
+red L263
+clr L290
+L213: .data -982, 43, -118, -861, -144, -533, 681, 174
+add *r4, *r7
+
+sub *r6, *r6
+jsr *r5
+clr L287
+L214: .data -595, 826, 346, -402
+
+inc *r2
+lea L229, *r3
+rts
+L215: jmp *r3
+rts
+sub r7, *r5
+clr L314
+add #244, r2
+bne L229
+inc r4
+bne *r1
+L216: red *r3
+add L218, *r0
+L217: sub #-70, *r0
+L218: .data -36, -721, 495, -150
+cmp #233, *r1
+L219: add #-154, *r0
+L220: rts
+L221: red *r3
+bne L270
+add L322, L273
+add #166, *r5
+inc *r2
+L222: inc r1
+clr r3
+not r3
+prn #-96
+L223: dec L272
+L224: mov #184, r1
+clr *r0
+dec r1
+dec *r3
+stop
+; comment
+cmp #-78, *r3
+L225: mov r0, L259
+bne L287
+L226: add L266, r5
+jsr *r4
+not r1
+sub L242, *r3
+mov *r6, r7
+red r4
+L227: dec L292
+L228: jmp L247
+stop
+dec r1
+lea L290, L239
+L229: mov r4, L236
+not L278
+L230: stop
+
+mov r6, r6
+L231: .data -859, 209, -947, 627, -978, -313, -777, -585
+lea L294, r1
+L232: not L311
+cmp #-227, L267
+; comment
+inc r1
+prn #-62
+cmp r7, L251
+prn r6
+; comment
+jsr *r0
+L233: rts
+dec *r6
+L234: dec r6
+not *r5
+L235: .string "ttjnpmuypyxgntslarz"
+
+lea L319, *r1
+; comment
+rts
+cmp *r1, *r7
+L236: inc r7
+add L252, r4
+stop
+clr r6
+L237: .string "uupnvkoqimaej"
+cmp #191, *r4
+L238: .data -723, 448, -451, -608, -617, 607
+L239: .data 237, -832, -242, -36
+mov L289, L317
+L240: jmp *r0
+L241: .string "vybwi"
+jmp *r2
+
+lea L299, r0
+lea L296, *r5
+L242: red L314
+; comment
+cmp L262, #-10
+clr r7
+bne *r6
+add L244, *r3
+clr *r1
+L243: red *r7
+L244: .data -686, -555, -757, 881
+bne *r1
+L245: .string "zdgyhrpjxb"
+jmp *r7
+lea L322, r4
+mov *r6, *r7
+cmp #-229, r1
+stop
+add *r7, *r7
+red r2
+mov *r2, *r4
+not L325
+L246: jmp *r2
+dec *r3
+; comment
+L247: add L250, r4
+L248: .data -137
+L249: .data -390, 855, 645, -768, 54
+L250: rts
+not L271
+not r0
+L251: sub *r6, L266
+L252: dec *r4
+L253: bne L265
+; comment
+not r5
+not L295
+L254: inc r7
+inc L274
+L255: rts
+L256: .data -517, -861, -267, 729, 373, -652, -412, 306
+jsr *r4
+dec L262
+rts
+sub r1, r1
+L257: mov #195, *r6
+add #223, r3
+; comment
+; comment
+L258: lea L312, L311
+L259: .string "mbadobmrhtmcjuxmqs"
+not *r1
+L260: .string "g"
+L261: cmp #-244, L320
+; comment
+L262: red L320
+mov *r6, r1
+clr r6
+stop
+L263: .string "qnjlqnaaxmogakby"
+inc r0
+jmp *r2
+stop
+L264: cmp #-153, *r5
+L265: lea L281, *r7
+stop
+not *r3
+L266: add *r4, *r1
+lea L296, r5
+stop
+L267: .string "do"
+L268: mov *r3, r4
+L269: inc L276
+prn #66
+clr *r0
+clr r2
+inc L321
+mov r0, L277
+mov #177, r5
+; comment
+dec r1
+L270: not *r4
+rts
+inc r6
+jmp L271
+rts
+mov *r7, L311
+rts
+L271: .data 547, -61, 597, 458
+dec r4
+rts
+red r3
+not *r4
+; comment
+prn #-229
+inc *r3
+bne *r5
+dec *r5
+inc L316
+not r5
+L272: not *r6
+L273: jsr L322
+sub r5, *r4
+L274: clr r4
+L275: .string "jtngxlsmzyrldlft"
+stop
+not r1
+L276: prn #-159
+L277: .data -328, -547, -39, -528, -76
+L278: .data 595, -769, 29
+mov r7, *r1
+L279: .data 763
+L280: rts
+jmp L281
+inc L298
+L281: .string "vmm"
+cmp *r3, #85
+jsr L325
+L282: add #-65, r5
+red r7
+inc L326
+L283: lea L286, r6
+cmp r0, *r3
+lea L306, *r1
+L284: rts
+lea L314, L315
+jmp L287
+lea L293, r1
+sub #-94, r0
+L285: red L299
+L286: dec L303
+; comment
+stop
+clr L324
+L287: rts
+L288: inc *r6
+stop
+jmp L315
+L289: bne L304
+L290: lea L326, L326
+L291: stop
+L292: jmp L322
+not *r7
+bne L320
+L293: .data -123, -525, 772, 314
+dec L300
+L294: stop
+L295: dec *r1
+
+L296: not r2
+red *r4
+red *r6
+inc r1
+stop
+rts
+add #-252, L303
+; comment
+L297: lea L301, r1
+mov *r5, r3
+clr *r3
+bne *r0
+dec r0
+add r7, *r7
+L298: .string "a"
+jmp *r3
+cmp r2, #204
+jmp L314
+rts
+dec *r2
+clr L322
+rts
+L299: stop
+L300: inc r4
+dec r5
+; comment
+L301: stop
+clr r3
+red *r0
+L302: sub r2, L310
+mov *r2, r7
+add r0, *r7
+L303: red L311
+jmp L309
+dec L312
+L304: .data 498, 274
+; comment
+clr r4
+jmp L314
+add #-37, L306
+cmp *r2, #41
+L305: jsr L326
+L306: rts
+add #239, L318
+bne L320
+jsr L327
+stop
+bne L327
+jsr L311
+L307: prn r2
+inc r0
+stop
+L308: add r2, L318
+not L313
+
+L309: inc r7
+jmp *r6
+; comment
+L310: sub #-48, L328
+prn *r5
+L311: .string "cfywwlnaotyecctvbujgp"
+mov *r6, L316
+jsr L326
+sub #-63, *r2
+
+add r1, L313
+L312: lea L315, L313
+L313: add L317, r0
+bne *r3
+mov L326, r6
+L314: .string "csaqppaivjut"
+add L326, *r7
+clr *r6
+rts
+stop
+clr L321
+inc *r2
+mov L325, r4
+L315: dec L322
+L316: red *r4
+add *r3, L327
+rts
+L317: not r0
+mov *r0, *r2
+jsr L319
+not L324
+sub r7, L318
+rts
+jmp L325
+jsr *r5
+L318: dec r2
+rts
+sub #-199, *r1
+mov r4, r0
+mov *r0, *r6
+L319: .data -925, 834, 958, 153, -467, -575, 796, 909
+L320: prn *r0
+mov *r6, r2
+jmp L323
+L321: jsr *r2
+dec r7
+sub L328, r5
+L322: .string "lzhvhhy"
+
+L323: add #167, L328
+inc L328
+lea L324, r6
+clr r3
+not L325
+inc *r1
+
+L324: .string "axjn"
+red L325
+cmp *r6, L327
+L325: dec L327
+mov L327, L326
+jsr L326
+L326: stop
+mov *r7, *r7
+rts
+L327: .string "sdxbxlhcderzvnv"
+sub *r2, *r0
+lea L328, r5
+L328: bne L238
+; comment
+stop
@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: bne *r5
+bne L251
+not r0
+jsr *r0
+mov *r5, *r0
+L1: dec *r2
+L2: red r7
+L3: bne L143
+; comment
+inc r4
+stop
+L4: .string "icpodsscfi"
+L5: red L189
+bne *r2
+rts
+L6: not *r7
+L7: .string "aimwhpv"
+prn L270
+rts
+inc r3
+L8: red L245
+L9: sub L309, *r4
+add #-213, L159
+L10: .string "oobpehquhmgoctchy"
+
+L11: rts
+L12: rts
+L13: not *r0
+L14: cmp #21, L45
+red r7
+; comment
+L15: .string "oz"
+L16: lea L93, *r7
+mov L341, r0
+jmp *r3
+dec *r5
+not r4
+red L207
+bne *r1
+L17: inc *r3
+red *r6
+not *r5
+stop
+cmp *r5, #-115
+red *r7
+sub *r1, *r2
+cmp *r0, *r2
+inc r1
+L18: mov *r7, *r0
+L19: jsr *r3
+; comment
+L20: jsr L189
+L21: clr *r3
+jmp L136
+L22: red r3
+rts
+dec r4
+clr *r3
+L23: .string "jdjpnwkmvxatl"
+L24: add *r5, r6
+L25: rts
+lea L282, L214
+L26: stop
+add #-119, r7
+rts
+red *r1
+; comment
+lea L269, r0
+red *r0
+L27: lea L193, L279
+clr *r7
+mov r4, *r6
+stop
+prn L173
+L28: inc r1
+bne *r1
+inc L330
+L29: bne *r7
+L30: red L112
+dec *r1
+cmp *r3, r4
+inc *r0
+L31: .data 818, -48, -684
+L32: .data 77
+L33: mov *r3, *r3
+lea L175, L216
+prn #13
+jsr L220
+lea L343, *r7
+prn *r7
+stop
+L34: cmp r7, r1
+lea L35, *r2
+jmp L341
+bne *r1
+red *r0
+rts
+jmp *r6
+rts
+mov *r7, L157
+L35: jsr L240
+dec L156
+L36: jsr *r4
+jmp *r4
+jmp *r5
+L37: .string "yoogwfubvfyxyqffe"
+jsr L246
+prn r7
+jsr *r7
+rts
+L38: not L339
+lea L312, *r0
+L39: jmp *r6
+prn L159
+jmp L323
+L40: prn L333
+mov #24, r3
+stop
+stop
+L41: cmp L192, L174
+clr L60
+stop
+L42: .string "fyibmmmnbz"
+sub *r4, *r3
+inc *r1
+bne *r6
+dec L97
+L43: add L251, r5
+jsr L165
+L44: cmp *r3, r0
+L45: lea L55, L153
+mov r0, *r4
+L46: stop
+not r6
+L47: bne L64
+L48: .string "en"
+cmp #-248, L235
+red L310
+L49: red r4
+rts
+prn r2
+cmp #145, L196
+not r3
+rts
+bne L189
+red L85
+L50: stop
+add *r7, L218
+
+L51: jsr L150
+rts
+add L309, L286
+rts
+prn r3
+clr L195
+L52: inc r2
+clr L97
+not *r5
+add #-211, r3
+stop
+L53: not L248
+add L164, L153
+red r2
+lea L167, r3
+jmp L276
+not r0
+lea L202, L193
+L54: not *r6
+red L155
+cmp r7, r1
+L55: red *r1
+add L308, L277
+L56: sub r4, L302
+cmp L315, r0
+jmp L275
+L57: .data 276
+rts
+L58: stop
+red r3
+L59: inc L306
+
+L60: not r4
+jsr L310
+; comment
+L61: stop
+inc *r5
+L62: lea L266, L315
+L63: .data 25, 569, -291, -67
+red *r3
+L64: dec r6
+L65: dec r3
+L66: clr L309
+bne L116
+L67: .string "djotvmziqwrtxq"
+lea L201, r3
+clr r1
+jmp *r2
+L68: sub L111, r1
+L69: clr r3
+add #-235, L239
+L70: .string "hy"
+dec L168
+
+inc L291
+jmp *r6
+not r5
+red r7
+lea L290, L246
+L71: lea L92, *r7
+L72: sub r5, L188
+cmp #-133, L313
+L73: add *r6, L259
+inc *r3
+jsr *r7
+rts
+add L159, *r1
+clr r4
+rts
+jmp *r7
+L74: .string "o"
+L75: .string "kcw"
+stop
+add L302, *r7
+L76: .data 228, 847, 368, -240, -974, 212, -634, -462
+dec L178
+clr r6
+jsr L106
+L77: .data -511, -593, 668
+L78: inc *r5
+; comment
+cmp r4, *r7
+clr r0
+stop
+L79: clr r0
+prn L241
+L80: red *r2
+L81: .string "nnuztlcxjueozpaadfopgfq"
+rts
+prn r6
+L82: prn *r4
+L83: mov #-214, L177
+L84: .string "dhhwborigkkv"
+L85: .string "hydrfaqgaw"
+add #-203, r7
+L86: clr L176
+cmp #89, L109
+inc L112
+L87: .data -208, -812, -722, -288, 356, 856, 873
+jmp L304
+clr r0
+L88: lea L239, *r1
+L89: jsr L346
+stop
+
+stop
+sub L109, *r2
+bne L301
+L90: jsr L92
+clr L153
+jsr L273
+dec *r2
+L91: jmp *r0
+red L267
+L92: add *r7, L135
+stop
+rts
+jsr L233
+
+L93: add *r4, L114
+; comment
+dec L172
+L94: lea L107, r1
+rts
+rts
+inc *r1
+jmp L170
+cmp L250, L250
+bne *r0
+dec r0
+red *r5
+not r2
+prn L259
+lea L145, *r5
+inc L280
+add L319, r5
+dec *r0
+rts
+L95: not *r3
+
+L96: jmp *r2
+; comment
+prn *r4
+L97: stop
+dec r0
+sub r7, *r5
+L98: .string "ngftpp"
+; comment
+rts
+red r1
+L99: .data -719, 276, -273, -392
+cmp *r1, L178
+add #-19, L253
+add *r5, L180
+L100: cmp *r5, r1
+stop
+L101: clr r7
+L102: lea L256, L183
+lea L259, *r4
+add r3, r0
+rts
+; comment
+rts
+rts
+mov r5, *r0
+bne L130
+L103: .string "dyouefgydpnfacwajfd"
+prn *r0
+prn #150
+L104: .string "hrnaduxshtdkwsz"
+L105: .string "j"
+L106: dec L294
+sub *r7, r7
+not L116
+bne L223
+sub *r7, L155
+rts
+L107: sub *r7, *r3
+L108: .data 681
+L109: jmp *r5
+
+stop
+L110: not r4
+L111: jmp L256
+L112: jsr L126
+L113: .data -760
+L114: mov r5, L133
+mov r7, r5
+L115: .data -919, -207, -237, -655, -546
+L116: dec L167
+L117: inc *r1
+L118: mov L257, L189
+jsr L142
+L119: bne *r5
+inc *r0
+bne *r0
+L120: rts
+add #79, r5
+jsr L157
+jmp L131
+rts
+L121: lea L203, *r4
+jmp *r0
+jmp *r1
+add *r1, L232
+jmp L138
+L122: clr L339
+L123: jmp *r6
+L124: mov r2, L206
+prn r4
+add L193, r0
+L125: prn r4
+bne L228
+bne L227
+sub #-190, r5
+mov L174, r1
+; comment
+L126: bne L161
+L127: stop
+L128: .string "k"
+L129: bne *r6
+L130: stop
+
+not *r7
+L131: lea L225, r0
+
+add r5, L180
+bne *r6
+inc L166
+L132: lea L167, *r7
+L133: .data -515, 834, -576, -7, 26, 627, 217, 635
+not L330
+; comment
+clr *r7
+L134: .data -674, -476
+rts
+L135: dec *r7
+mov L172, r0
+sub #-99, L315
+stop
+clr r0
+L136: lea L202, L203
+clr L329
+L137: sub #178, r7
+jsr *r3
+L138: jmp *r6
+L139: .string "borvmauxjtcgpolfd"
+L140: not *r6
+prn L298
+; comment
+lea L260, r5
+bne L265
+red *r7
+rts
+L141: cmp r4, r4
+L142: .string "mojruocuqkqinnulnz"
+L143: stop
+jmp *r0
+bne L200
+jsr L204
+red r1
+jmp *r5
+L144: rts
+add r0, r0
+L145: red r1
+stop
+lea L203, *r4
+add r4, L257
+L146: inc r4
+stop
+rts
+prn L229
+dec *r3
+L147: .data 321, -37, 637, 739, -720
+mov r2, r7
+L148: cmp #75, #166
+jmp *r6
+rts
+add r7, L163
+not L156
+mov r6, *r7
+inc L162
+L149: rts
+L150: jsr *r1
+L151: add #-85, L346
+clr *r0
+stop
+L152: inc *r1
+L153: prn #-23
+; comment
+L154: prn L302
+L155: prn r0
+prn #247
+L156: rts
+prn r3
+L157: mov L291, L210
+L158: sub r5, r0
+L159: stop
+lea L181, *r1
+L160: add r1, L229
+L161: red r7
+inc r7
+L162: bne L321
+jsr L255
+L163: not r2
+rts
+red *r6
+cmp L229, L324
+inc L172
+L164: .data 839, 22
+sub r5, L324
+jmp *r5
+L165: .data 471
+jsr L303
+L166: not r5
+prn *r1
+L167: .string "pgdpt"
+L168: .string "dbhngrvzspdhvzgvg"
+jsr L240
+red r4
+jsr *r1
+stop
+prn r0
+L169: bne *r5
+rts
+L170: lea L292, *r6
+prn r3
+L171: jsr *r4
+rts
+L172: prn r0
+L173: bne *r4
+add L326, *r1
+stop
+cmp r2, #189
+L174: not r3
+jsr L302
+sub L209, r0
+rts
+L175: .data 874, 916, 945, -833, 292, -924, -24
+prn L293
+L176: dec L332
+L177: bne *r6
+add r1, r6
+cmp *r4, *r0
+jmp L309
+L178: rts
+
+red r3
+not r1
+prn r1
+not r3
+stop
+L179: inc L221
+L180: .string "vgtnapuj"
+jsr L257
+sub *r0, L249
+rts
+L181: not r2
+prn #7
+jmp *r6
+
+L182: .string "jjwazpmgmi"
+L183: dec r0
+L184: .data 886, -156, -277, -321, -544, -890
+L185: cmp L228, L231
+inc *r6
+; comment
+stop
+dec r2
+clr *r7
+L186: jsr *r6
+lea L248, L329
+L187: not *r6
+L188: .data 574, 508
+bne *r2
+L189: .data -468, -80, 671, 935, 170
+clr *r0
+prn *r1
+jsr L265
+L190: bne *r4
+dec L244
+L191: lea L308, r4
+rts
+lea L214, *r4
+; comment
+not r6
+L192: red L308
+cmp #-67, L223
+L193: jmp L326
+L194: .data -806, -809, -910, -447, 12, -529, 344, 503
+L195: jmp *r6
+L196: bne L242
+L197: stop
+; comment
+red L290
+dec L261
+clr *r3
+; comment
+bne L267
+inc *r0
+dec r2
+L198: .string "fuur"
+L199: .data 712, -291
+L200: jsr L329
+prn *r1
+sub #-182, *r2
+lea L250, r7
+cmp L228, r2
+; comment
+L201: .data -370, 187, 190
+L202: .data -557, -529, 790, -361
+L203: lea L207, L317
+prn L277
+red L308
+cmp #195, #36
+L204: jmp L265
+cmp r2, *r7
+add L299, L311
+bne *r4
+sub *r5, L303
+L205: .string "yhalbnlstdvawvjlejwzosx"
+L206: clr r2
+clr r3
+inc L345
+stop
+
+red L294
+L207: stop
+cmp #-158, r1
+L208: prn r2
+cmp #-35, r5
+L209: bne *r0
+dec L238
+L210: stop
+prn *r6
+; comment
+stop
+L211: stop
+L212: red *r5
+L213: prn r1
+jsr L310
+sub L342, L231
+clr r7
+L214: sub r6, *r7
+
+prn L331
+L215: dec r0
+L216: red *r4
+not *r0
+L217: .data 636, 110, 107
+L218: inc *r5
+inc r2
+not L318
+L219: not *r3
+; comment
+L220: not L225
+inc L249
+prn L231
+not r7
+add *r4, r3
+; comment
+jsr L311
+L221: mov r1, r1
+inc L286
+bne *r3
+jmp L263
+lea L333, r1
+mov #80, L296
+rts
+L222: .data 153, 629
+L223: cmp #121, r6
+L224: .string "hofkpnlqmpghxiemtjhsacw"
+sub r4, L341
+mov r2, r6
+
+not r6
+red *r5
+; comment
+add *r5, *r7
+not r3
+lea L328, *r1
+jmp *r4
+rts
+L225: bne *r5
+bne *r7
+prn r0
+mov *r5, L286
+cmp *r5, *r3
+inc L290
+L226: red r7
+jmp *r3
+red *r3
+bne *r7
+add #117, L241
+L227: lea L244, *r5
+L228: add *r4, r2
+L229: not *r1
+mov #158, r6
+red *r2
+inc L346
+L230: clr L302
+
+L231: prn r4
+cmp L325, *r5
+inc r0
+L232: clr *r7
+dec L246
+rts
+stop
+; comment
+L233: .data 368, 296, -48, -503, 484, -645, 803
+L234: sub #-163, r6
+inc L290
+cmp r5, #129
+sub L248, r1
+bne *r0
+prn r2
+L235: .string "hzafwfgk"
+stop
+L236: .data 739, -55, 3, 31, 330, 672, 48
+sub *r5, r3
+dec L304
+L237: bne *r3
+L238: rts
+clr r6
+prn *r7
+bne *r2
+jsr *r1
+; comment
+cmp #-151, r6
+; comment
+L239: prn L275
+prn r0
+sub r6, *r4
+not r4
+add L305, L283
+rts
+jsr L293
+L240: .string "xokpzgvggwchcmidl"
+L241: lea L337, r2
+jsr *r1
+cmp L334, L331
+cmp *r5, r0
+inc *r3
+L242: jmp *r3
+mov L297, L265
+stop
+L243: stop
+prn *r4
+
+clr L320
+L244: .string "hvmd"
+rts
+sub #199, *r2
+L245: .string "cfxrclmub"
+clr *r3
+L246: rts
+lea L277, L250
+L247: mov L266, *r0
+L248: .string "klonylezgpfqqijeefngsdb"
+rts
+L249: .data 229, 370, 165, -900, 645
+mov L251, *r6
+dec *r3
+sub L299, L311
+L250: lea L310, *r1
+dec L334
+L251: stop
+jsr *r2
+prn #3
+L252: rts
+rts
+L253: not r2
+mov *r6, L292
+inc r4
+L254: bne *r2
+prn L273
+L255: cmp r0, #49
+add *r4, *r1
+L256: jsr L335
+inc r5
+; comment
+inc L284
+not *r1
+L257: bne L262
+L258: bne L345
+rts
+lea L279, *r0
+cmp r5, r2
+L259: lea L303, r5
+jsr L300
+mov L263, r0
+L260: .data 484, -579, 93
+clr L289
+L261: dec r7
+add *r6, L272
+L262: bne L343
+prn *r0
+L263: prn *r7
+inc L345
+rts
+not r2
+cmp #135, L320
+cmp *r6, #-160
+
+
+cmp #-170, L306
+red r0
+L264: sub r7, *r1
+stop
+cmp *r3, L285
+prn r6
+lea L336, r0
+stop
+L265: add #-154, L271
+mov *r4, L300
+L266: sub *r1, r0
+rts
+L267: red r1
+jsr *r3
+; comment
+prn r0
+
+L268: lea L338, r0
+L269: prn L289
+L270: red r7
+L271: bne L279
+mov r4, r1
+sub r5, r2
+L272: prn *r7
+L273: .data 97
+L274: rts
+dec *r7
+L275: inc *r0
+red L281
+inc r6
+sub r2, r6
+L276: rts
+dec r7
+jsr L316
+L277: prn r7
+lea L293, r6
+not L343
+L278: .string "jpxnbjotbza"
+L279: lea L301, *r6
+L280: red *r5
+L281: .string "arnusebkrxomqdvqanfddjv"
+not r5
+L282: not *r5
+red r7
+L283: mov *r5, r6
+L284: clr L343
+dec r3
+L285: lea L318, *r3
+not r1
+stop
+L286: add r6, r7
+not L305
+bne L301
+L287: bne L307
+L288: inc L297
+L289: cmp r1, L320
+inc L300
+not r3
+sub *r5, r4
+
+jmp *r6
+L290: mov r1, *r5
+L291: sub #112, *r2
+mov #-153, *r0
+clr r6
+L292: .string "jutglpmydxgmy"
+lea L335, L317
+add #216, *r0
+stop
+lea L318, r5
+jsr *r5
+jsr *r7
+L293: jmp *r3
+mov *r4, *r1
+L294: jmp *r0
+not r0
+L295: clr L343
+inc r2
+L296: inc L312
+L297: .data -201, 153, 451, 86, -375, -187, -75, 540
+L298: red r2
+sub #-205, *r7
+L299: mov #-181, r0
+sub r1, r1
+L300: .data 840, -649
+add L340, r5
+add #-159, *r2
+L301: not L311
+rts
+; comment
+sub r7, *r1
+sub r2, r2
+L302: cmp L314, r4
+rts
+; comment
+L303: prn r7
+not *r2
+L304: .string "iajhpormpfdknxs"
+not *r4
+cmp #-61, L316
+lea L308, L324
+not *r6
+L305: red *r4
+prn #22
+not r4
+L306: .data -86, 516, -83
+red L333
+L307: sub #-79, r5
+cmp L340, L309
+red *r4
+L308: prn L339
+dec L335
+L309: prn L335
+
+dec r3
+L310: rts
+inc L336
+jmp L343
+L311: lea L340, *r0
+stop
+cmp *r4, r4
+mov *r4, *r4
+lea L321, r4
+add r4, *r3
+
+L312: .string "q"
+; comment
+jsr L336
+L313: red r0
+jmp *r4
+L314: .data -772, 241, 66, -982, 656, 801
+clr r2
+L315: not L327
+bne L341
+rts
+not r2
+cmp *r6, #210
+prn #60
+L316: add r1, r3
+dec *r2
+L317: inc *r5
+L318: add L325, *r5
+
+dec r7
+add r2, *r4
+; comment
+cmp #170, #54
+jmp *r6
+L319: red *r7
+L320: stop
+L321: bne L329
+cmp *r6, *r4
+cmp r1, r6
+sub r6, *r7
+jmp *r6
+lea L346, L345
+inc *r3
+L322: rts
+cmp L330, r2
+L323: prn L338
+sub L335, r0
+L324: cmp *r5, #-45
+L325: not *r1
+L326: mov *r7, r2
+rts
+L327: mov #130, *r4
+prn r4
+
+clr *r0
+inc *r1
+red L345
+add *r1, L328
+prn r0
+red r5
+L328: clr L338
+sub #59, r1
+sub r2, *r4
+clr L341
+L329: inc L345
+L330: jsr L339
+L331: prn L332
+red r0
+prn r1
+stop
+clr r7
+mov #99, r3
+; comment
+L332: .data -497, 112, 977, -876, -787
+clr *r6
+inc *r6
+inc *r3
+L333: dec *r2
+bne L344
+rts
+red L345
+stop
+lea L346, *r1
+rts
+prn L345
+jmp L339
+clr L346
+inc L339
+L334: jsr *r2
+not r1
+jmp L337
+jmp *r4
+L335: rts
+L336: jmp L343
+jmp L343
+cmp *r4, L346
+L337: cmp r1, r3
+red *r1
+jmp L345
+cmp r1, #17
+L338: .data 488, -861, 650, 914, -435, 71, 699
+sub *r4, *r6
+
+bne L345
+L339: .string "mu"
+L340: .string "paefjycjfzwvuscewrxr"
+jmp L341
+L341: red r2
+red L345
+rts
+lea L343, *r4
+jsr *r3
+L342: inc *r4
+clr r0
+inc r1
+sub r2, L343
+prn #8
+rts
+cmp L343, #107
+red L343
+jmp *r1
+mov *r6, r2
+jmp *r0
+sub *r4, r2
+L343: .string "dprrvhuxqggnknjdliiij"
+prn L346
+lea L345, r6
+L344: stop
+L345: mov *r1, *r6
+add L346, r1
+L346: inc r7
+stop
@@ -0,0 +1,1023 @@
+; Generated by genCorpus --seed 25
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+sub L192, L152
+L0: mov r4, r4
+prn r0
+bne L225
+bne *r5
+rts
+prn *r1
+L1: inc L29
+L2: clr L126
+L3: .string "rilypssumdplrcybtuwmkc"
+; comment
+rts
+dec *r0
+mov r3, L115
+jmp *r0
+stop
+add L131, r5
+red *r2
+L4: clr *r1
+L5: dec r0
+red *r4
+bne *r7
+add r4, r4
+cmp #-185, #-106
+L6: dec *r0
+rts
+add L211, L279
+cmp r2, r5
+L7: jmp *r1
+L8: stop
+L9: .data 256, -327, -452, 414, -982, 125, -254
+L10: not r2
+clr *r3
+bne *r6
+jmp L74
+stop
+add *r2, *r0
+stop
+rts
+; comment
+stop
+jsr L251
+sub #98, L13
+not *r1
+jsr *r4
+
+L11: add L118, L316
+L12: red r5
+jmp L187
+jmp L113
+L13: lea L34, *r5
+mov *r2, *r4
+L14: .data 491, 405, -725
+red r3
+lea L209, *r6
+mov *r2, r2
+jmp *r0
+L15: lea L304, L127
+L16: .string "dbnggwonowfpfcpeukb"
+jsr *r5
+rts
+prn r7
+not r5
+not L43
+cmp r7, *r0
+dec L162
+L17: sub r2, r4
+L18: bne *r2
+stop
+jsr L169
+red L216
+inc L243
+jmp *r5
+L19: clr *r4
+L20: mov r2, r0
+L21: .data -562, 775
+rts
+jsr L86
+sub r6, L178
+; comment
+clr *r5
+
+rts
+stop
+lea L268, r7
+bne L208
+red L116
+L22: inc L68
+L23: inc r6
+L24: jmp *r3
+sub r1, *r1
+rts
+L25: lea L290, L134
+L26: clr *r6
+L27: jmp *r1
+L28: .data 926, 805, 595, -578, 207, -639, 319
+; comment
+jmp *r4
+jsr L69
+lea L300, L307
+inc L135
+L29: clr r1
+cmp r2, L146
+L30: mov #253, *r3
+L31: add #-18, *r3
+L32: .string "goqthdxgyivz"
+jsr *r2
+L33: prn *r0
+L34: add *r4, L137
+inc L269
+lea L306, *r2
+L35: not r2
+not L72
+L36: .string "wsecdksiwc"
+sub *r3, *r5
+cmp #-228, r5
+clr L113
+L37: stop
+clr L322
+L38: add *r0, r7
+add *r7, L237
+dec *r1
+dec *r7
+cmp r4, *r6
+cmp #-249, r7
+L39: .data 600, 620, -610, 224, 663, -169, 831, -698
+add #192, *r4
+L40: .data -447, -141, -384
+red r0
+add L113, r0
+dec L299
+; comment
+cmp #111, *r2
+dec *r6
+L41: .data -13, 992, 332, 850
+L42: cmp L270, L137
+not L296
+L43: .string "uyvg"
+sub #17, *r0
+L44: .string "eekhkt"
+jmp L310
+add #7, *r4
+L45: rts
+rts
+rts
+sub r4, r4
+; comment
+cmp r1, *r2
+rts
+L46: jmp L325
+mov L100, *r0
+sub L150, L144
+mov r7, *r4
+bne L282
+mov r1, r6
+L47: add r6, r0
+rts
+clr *r1
+jmp L201
+lea L233, L120
+L48: red L132
+L49: not r4
+stop
+dec L238
+clr L256
+sub L245, L310
+lea L277, L265
+sub #238, *r3
+jmp *r7
+lea L295, L105
+bne *r0
+bne L132
+; comment
+inc *r4
+clr *r2
+L50: add *r1, L86
+lea L83, L58
+L51: .string "pnotpfdjnuzokaqmxdh"
+dec L158
+add r3, *r5
+L52: jsr L262
+L53: prn #-172
+jmp L187
+add L284, *r7
+L54: sub r1, L165
+jmp *r5
+jmp L305
+L55: .string "qgkyyakifbriybxahleqoce"
+rts
+jmp *r1
+L56: .data -91, -288, 283, -89, -526
+L57: cmp r2, *r4
+prn r7
+clr L191
+bne *r1
+mov *r1, r5
+prn #195
+inc r1
+L58: .string "tvhbtf"
+
+
+L59: .string "pt"
+L60: prn *r4
+L61: stop
+L62: jmp *r6
+jmp *r4
+jsr *r2
+sub *r1, r4
+L63: jsr L122
+not *r4
+jmp *r0
+rts
+L64: mov r6, r7
+cmp #-43, *r7
+L65: stop
+L66: sub #-170, L309
+prn r6
+dec r5
+sub r1, *r4
+bne *r1
+L67: not *r6
+add #-96, *r2
+jsr L87
+cmp r1, L164
+add #-228, L260
+rts
+red r2
+L68: prn #-220
+not r7
+rts
+rts
+lea L159, r0
+L69: prn L245
+cmp r1, r4
+jmp L326
+L70: red L108
+inc r1
+L71: sub #234, L239
+bne *r1
+jmp L247
+L72: prn #4
+L73: .string "uiuhrxwcfzuylosk"
+; comment
+jmp L274
+dec L300
+L74: bne *r6
+L75: stop
+L76: bne *r2
+clr *r1
+jmp *r1
+L77: .data -95, 548, -288, 752, -800, 864, -872
+; comment
+L78: mov L239, *r7
+prn r5
+not r5
+L79: lea L220, *r2
+rts
+bne L137
+L80: jsr *r5
+L81: lea L108, *r1
+L82: clr L205
+clr L266
+clr r5
+add L116, L171
+lea L133, r5
+L83: prn L201
+sub L332, L112
+not L245
+mov #135, r2
+not L95
+jsr *r3
+
+L84: red *r1
+cmp #140, L295
+stop
+jmp L100
+L85: .string "p"
+not *r4
+L86: .data -449, 920, 285, -350
+prn #70
+red *r2
+bne L256
+
+L87: cmp *r6, r6
+L88: .string "kafocism"
+L89: dec *r0
+not *r3
+L90: rts
+red L239
+inc L112
+prn *r2
+L91: stop
+bne *r4
+lea L200, r5
+; comment
+L92: jmp *r6
+jsr L233
+inc L280
+add L250, *r7
+L93: red L225
+L94: .data -856, 493, -326, 710, 365, -364, -773
+L95: add L165, r2
+L96: prn r0
+L97: clr r4
+rts
+L98: rts
+L99: .data -443, 427, -922
+sub #165, r7
+sub *r5, r4
+L100: mov L232, r4
+cmp r1, r6
+cmp #204, r3
+L101: .string "fbzokbtpjsajcpfus"
+not L317
+add *r3, *r5
+clr r6
+L102: add *r5, r7
+red *r4
+; comment
+stop
+L103: bne L207
+jmp L186
+L104: prn r4
+red *r5
+clr *r1
+inc L218
+L105: red *r1
+add r3, L285
+L106: .data 629, 281, 445, 493, 746, -347, -670, 324
+lea L151, *r6
+L107: .data 945, -582, -148, 359, -126, 99, -1
+L108: inc L239
+lea L165, L119
+mov #-50, r1
+L109: .data -518, 706, -645, 412, -360, 686
+jsr L230
+mov L319, *r5
+inc L302
+add r6, *r5
+L110: lea L282, r7
+L111: .data -670, 744, -800, -555, 23, 553
+clr L250
+not L238
+clr r1
+cmp #-199, L304
+L112: rts
+dec r1
+L113: .data -508, 869
+dec *r1
+L114: not L178
+prn r3
+jmp *r1
+prn r4
+L115: prn *r3
+not L309
+rts
+rts
+stop
+cmp L306, L305
+prn #22
+cmp #208, L167
+stop
+prn L256
+rts
+
+inc L255
+not *r1
+; comment
+jmp L207
+inc L182
+L116: add r4, r5
+sub *r2, L328
+dec r5
+mov *r2, L328
+L117: bne *r2
+inc r4
+; comment
+L118: rts
+add L195, *r0
+
+L119: sub L322, L262
+L120: prn L141
+stop
+L121: .data 569, -472, 784, -719, 46, 25, 732
+stop
+L122: jmp *r3
+dec r3
+add r0, L303
+cmp L169, L285
+prn L282
+L123: dec L301
+mov #-96, L184
+L124: not r4
+L125: jmp L310
+rts
+prn L302
+L126: stop
+prn L135
+not r2
+L127: add #-211, *r1
+jsr *r4
+L128: clr L215
+L129: jsr L284
+jmp *r3
+jsr L239
+L130: stop
+inc *r1
+L131: lea L197, *r4
+dec *r1
+L132: .string "mojlrzmmhuqck"
+rts
+L133: stop
+L134: .string "hptksivurlw"
+L135: .string "te"
+lea L295, r0
+cmp L230, L289
+not *r4
+prn #-226
+cmp L159, #138
+L136: sub *r5, *r3
+L137: .data 813, -587
+add #-183, L277
+dec L327
+mov L179, *r0
+jmp *r1
+rts
+jmp L187
+rts
+sub r3, r1
+rts
+L138: .data -403, 317, 460, 212, -336
+mov *r0, L154
+clr L278
+L139: .data 619, -748, 336, 516, -315, 196, 137, -613
+L140: rts
+L141: .string "dhm"
+bne *r6
+L142: jsr L304
+jsr L291
+clr L207
+L143: lea L165, r1
+sub *r2, *r6
+cmp L320, #-34
+L144: not L149
+L145: .data 88
+jsr *r6
+L146: add #130, L222
+jsr *r2
+jmp L262
+L147: .string "qluqsme"
+lea L218, L254
+cmp #179, *r6
+; comment
+inc r2
+lea L251, L316
+jmp *r6
+L148: prn #-67
+prn r7
+stop
+inc r7
+L149: inc r4
+add r7, r6
+cmp r4, r2
+; comment
+L150: jsr *r0
+cmp r1, #189
+stop
+L151: .data -668, 347, -363, -720, -862, -312, -893
+not r2
+red *r0
+
+L152: prn #171
+L153: sub *r2, *r6
+jmp *r3
+cmp r3, #217
+bne L241
+L154: add L302, L191
+L155: jsr L258
+mov #-230, *r0
+bne *r1
+L156: cmp L187, r6
+add L269, r0
+
+rts
+dec L200
+red L229
+not L167
+rts
+prn #71
+cmp #-25, L326
+L157: add #22, r6
+L158: inc *r0
+; comment
+mov #125, *r5
+red *r1
+jmp *r6
+clr L164
+cmp L327, r5
+L159: .data 395, 245
+L160: mov *r3, r0
+; comment
+dec L216
+prn L266
+stop
+red *r1
+red r5
+L161: stop
+stop
+lea L220, *r6
+mov #223, r2
+mov *r7, L216
+; comment
+stop
+L162: .data -291, 963
+L163: .string "yswzwvimhvpsqjwv"
+L164: lea L321, *r5
+L165: .string "klg"
+clr L278
+clr L289
+L166: inc *r6
+inc *r6
+add #-102, *r0
+red r2
+L167: jmp *r2
+
+not L250
+inc L232
+L168: .data 870, 788, -165, 967, -611, 956, 758
+red L284
+L169: jmp *r0
+L170: add r0, r6
+not L299
+L171: clr *r1
+L172: cmp r5, #87
+jmp L315
+L173: sub r4, L229
+lea L256, *r5
+stop
+stop
+prn #100
+not *r5
+add *r6, r3
+jmp *r1
+L174: .data 124, 635, -435, 751, -252, 657, -304
+not L202
+mov L283, L187
+L175: .string "gzihkbfl"
+L176: .data -769, 78, 464, 432, 27, -48, 798, 869
+mov *r3, r7
+inc *r4
+L177: .string "wqkonvjajrxazazpaqqmpxf"
+L178: mov r0, L181
+L179: not *r4
+add L207, *r1
+cmp #148, r0
+bne *r4
+jsr L182
+; comment
+rts
+not L279
+rts
+lea L252, r5
+add #248, *r1
+L180: jmp *r2
+red *r1
+bne L243
+; comment
+L181: bne *r7
+cmp *r7, L189
+not *r4
+prn *r1
+red r2
+L182: bne *r7
+stop
+jmp L231
+L183: .string "dkafewrolqleb"
+inc *r6
+inc r7
+L184: dec *r3
+not *r6
+L185: sub #140, L196
+L186: .data 665, 149, 84, 151, -514, 609, -212
+; comment
+stop
+clr *r4
+
+sub #-201, L221
+stop
+mov r7, r1
+inc r0
+mov L281, r7
+L187: .data 279, 818, -896, 253, 505
+mov #-153, r4
+red L330
+L188: stop
+bne L288
+inc L205
+L189: .data 979, -543, 689, 835, 370, 665, 602
+sub *r6, *r1
+red r4
+L190: dec *r6
+L191: dec r4
+stop
+mov r4, *r4
+L192: lea L259, r2
+L193: mov #184, r4
+not L274
+dec r3
+L194: dec *r7
+
+L195: not r0
+L196: jsr L323
+L197: stop
+mov #-61, L218
+dec r3
+inc r6
+sub L243, *r7
+L198: add r2, *r4
+L199: .data 205, -340
+L200: .string "lkongpjoeigu"
+mov *r1, r7
+L201: dec *r4
+L202: red L240
+L203: dec L255
+lea L305, *r0
+not r3
+L204: .data 953, 86
+L205: mov L225, r3
+dec L225
+clr *r1
+L206: cmp #-232, #107
+lea L328, L246
+cmp *r0, L275
+L207: .data -562, 880, -197, -766, -367, 438, -253, -339
+L208: .data -990, 615, -420
+red L224
+L209: .data -972, 471, -642, 552, 790, -951
+dec r0
+jmp *r4
+L210: .string "uaicoaupflrqluq"
+L211: lea L241, *r3
+lea L321, L268
+stop
+rts
+stop
+L212: not L279
+L213: lea L331, *r5
+sub *r4, L260
+L214: inc *r5
+L215: .string "gnjrd"
+L216: stop
+L217: not r3
+add #-93, r1
+prn #56
+stop
+L218: lea L326, L268
+mov L325, L243
+L219: .data -474, 815, 230, -531, -723, -920, 8, -912
+sub *r5, r7
+; comment
+L220: lea L275, *r4
+L221: bne L250
+sub #124, L233
+dec r4
+sub r6, *r3
+jsr L272
+L222: stop
+sub *r1, *r0
+not L305
+jmp L291
+
+cmp L304, r7
+mov *r4, *r5
+; comment
+; comment
+not *r2
+sub r0, L246
+L223: prn r1
+red L297
+rts
+bne *r4
+L224: add *r7, *r2
+add L325, *r5
+rts
+L225: add r7, r2
+L226: .string "gezelpufnycsuja"
+L227: clr *r7
+lea L304, L298
+dec *r7
+L228: .string "cs"
+red *r0
+L229: .string "zq"
+L230: lea L330, *r1
+red *r5
+rts
+
+jmp *r1
+; comment
+not r1
+L231: stop
+red L308
+L232: dec *r1
+mov L316, L296
+stop
+L233: .data 482, -123
+stop
+prn r3
+dec r4
+L234: .string "dlhiwkctaa"
+; comment
+lea L268, *r4
+bne L285
+L235: lea L292, L320
+L236: .data 598, 822, 938, 275, -683
+red *r3
+inc r4
+L237: red *r1
+red L313
+L238: .data -636, 478, 362, 568
+lea L264, L268
+bne L299
+L239: red L281
+add #-41, L316
+L240: .string "lcpdtszcraezdellzldx"
+L241: rts
+jmp L303
+L242: prn *r6
+cmp r1, L256
+L243: .string "mdqgghxclbdpeddg"
+L244: mov L305, r1
+L245: rts
+L246: inc L323
+rts
+add *r7, L312
+bne *r7
+inc L276
+stop
+L247: mov *r5, *r2
+L248: .data -932, -37, -395, -399, 614, 532, 346
+L249: cmp L317, *r2
+rts
+stop
+add L265, r1
+not L300
+
+L250: cmp r5, #227
+lea L327, *r6
+L251: bne L272
+dec r2
+add #41, *r1
+L252: sub L272, L317
+L253: jmp *r4
+jsr *r3
+mov r3, *r7
+bne L312
+; comment
+rts
+L254: not r7
+not L259
+red L308
+L255: .string "lhyrccsxlsvw"
+stop
+bne *r6
+L256: stop
+add r2, r7
+jsr L315
+rts
+inc L309
+; comment
+red r3
+L257: sub r0, L260
+; comment
+L258: not L279
+L259: sub *r7, L315
+red *r3
+add #-145, *r0
+L260: .string "cocfunlwleyoih"
+jmp *r3
+dec *r3
+cmp L282, L294
+L261: .string "besuuzuokizjq"
+L262: .data -604, 345, -167, 611, -991, -223
+L263: clr *r0
+jsr *r7
+L264: clr *r0
+; comment
+dec *r6
+prn L275
+lea L290, *r3
+L265: .data -789, -967, 222, -743, -732, -942
+prn #245
+sub *r0, r2
+L266: sub #-143, L286
+not *r5
+jmp L297
+prn #-7
+
+jmp L271
+L267: red L307
+L268: dec r2
+L269: .string "facfxqjkunbmzzsg"
+clr L271
+inc *r6
+mov r2, r2
+dec *r2
+L270: lea L321, r3
+rts
+cmp #175, *r7
+rts
+jsr L298
+bne L279
+cmp *r3, L276
+dec r0
+L271: .string "tozojyc"
+L272: add *r1, r0
+L273: bne *r7
+bne L297
+sub L290, L312
+L274: red *r2
+jsr L306
+stop
+L275: cmp L286, #-55
+lea L318, L286
+L276: clr L326
+L277: jsr *r2
+
+prn *r4
+clr *r2
+jsr L308
+prn #138
+L278: .data 4, -702, -269, -905, 909
+stop
+add L292, r6
+L279: .string "hyahmc"
+L280: mov r6, *r2
+prn *r2
+jmp *r5
+L281: dec L299
+sub #241, L321
+L282: .data -18, -509, 605, 617
+prn r2
+L283: .data -15, 180, -421, 351, 731, 293
+L284: prn #-140
+L285: .string "butwrzevboluvb"
+L286: .data -800, -918
+jsr L327
+L287: lea L310, L301
+L288: .string "jnuyqcxlygkmtfquonwdbntq"
+rts
+L289: add r7, *r4
+dec *r0
+mov r5, *r0
+L290: not r7
+stop
+add r1, r7
+cmp *r1, L318
+L291: not L302
+mov L301, *r5
+rts
+inc *r5
+L292: lea L308, *r1
+L293: lea L302, r4
+L294: sub L325, L332
+not L297
+jmp *r2
+red L330
+lea L317, L317
+L295: clr L324
+; comment
+clr r3
+clr L306
+jsr *r0
+cmp *r7, *r0
+L296: .data 808, 710, 577, 190, -581, -610
+mov r1, *r0
+prn #-76
+L297: red r0
+stop
+mov *r4, r1
+bne *r4
+bne *r5
+rts
+L298: .string "znxwopdeg"
+L299: add #-46, *r3
+inc L309
+rts
+L300: red L328
+L301: dec *r0
+not *r1
+L302: jsr L323
+L303: stop
+lea L326, *r2
+cmp *r3, L328
+L304: .string "klev"
+jmp L331
+L305: prn *r5
+lea L328, *r3
+red *r2
+jmp *r2
+L306: red *r5
+inc L331
+L307: sub #48, *r1
+L308: lea L332, r2
+L309: prn #-129
+not L329
+; comment
+not r1
+L310: .string "npxqymzygjbsuzbfvlwl"
+jsr *r3
+dec *r1
+lea L325, *r5
+jsr L311
+clr L331
+prn r0
+lea L323, *r4
+mov r0, *r7
+inc r7
+sub *r1, *r2
+L311: prn *r7
+jsr L329
+mov #-185, r5
+stop
+L312: bne *r4
+L313: .data 334, -955, 815, -120, -692, -946, -367, -495
+mov r3, *r4
+stop
+L314: rts
+clr *r0
+sub #82, *r5
+bne *r2
+rts
+L315: .data -619, -771, -979, -103, 17, -723, 75, 456
+prn L319
+prn L321
+L316: red L317
+red L328
+L317: .string "bmbwacjcoubtbwuiclhmhts"
+jsr L325
+not *r2
+lea L332, *r6
+not *r7
+L318: bne *r7
+red *r6
+mov #-21, L330
+rts
+L319: cmp L321, #-244
+L320: bne *r4
+L321: .string "afcrznjobkxuim"
+
+prn #186
+red L330
+sub L323, *r0
+not *r2
+rts
+cmp *r7, *r2
+clr r6
+inc *r1
+L322: rts
+dec r2
+add r4, r3
+stop
+; comment
+; comment
+not L324
+L323: dec r1
+red L325
+red L329
+jsr L331
+jsr L328
+prn *r5
+bne *r0
+jmp L331
+L324: .data 831, -4, 484, -249, -83, 160, -105
+lea L332, r1
+inc *r3
+red r3
+stop
+mov L329, L332
+L325: sub r7, L326
+L326: cmp L331, L327
+L327: .data 740
+stop
+dec *r1
+stop
+rts
+not *r1
+; comment
+L328: jsr L331
+add r0, *r2
+jmp *r5
+L329: mov #98, r1
+mov *r6, L332
+jmp L332
+red r4
+dec *r6
+clr *r5
+L330: inc L332
+L331: not *r1
+not L332
+L332: lea L72, r5
+stop
@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 26
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+red r4
+stop
+clr *r1
+L0: clr L180
+
+L1: jsr *r2
+L2: lea L229, r3
+sub L164, L179
+stop
+rts
+dec L176
+add L251, *r4
+bne L129
+add r2, r0
+L3: .data 118, -301, 373, 525, -118, 444, 639
+rts
+mov r5, L194
+not L140
+L4: .string "hnslzovcjsvfxidbb"
+lea L26, r4
+rts
+lea L356, L49
+cmp L345, *r3
+dec *r3
+L5: mov #-15, L11
+dec *r7
+bne *r3
+not r3
+dec r6
+dec r2
+mov *r5, *r4
+L6: clr L301
+not *r3
+rts
+; comment
+L7: mov r3, *r5
+mov #60, L15
+add r6, *r0
+add #-212, r0
+stop
+L8: not r5
+sub #64, L131
+L9: prn r7
+L10: rts
+bne L256
+L11: jmp *r6
+red *r2
+lea L167, r6
+L12: dec L159
+
+L13: clr L301
+; comment
+L14: jsr L303
+L15: jsr *r2
+L16: .data -167, -782, 3, -423
+sub r2, r0
+jsr *r6
+
+rts
+L17: clr r7
+L18: .string "rbrwxcuptqjzhkg"
+L19: inc L112
+L20: not L288
+L21: inc *r2
+L22: .string "avkwb"
+red r4
+L23: add #-50, L64
+mov L240, L338
+prn r0
+red r1
+; comment
+stop
+prn r7
+prn #226
+clr L26
+L24: clr r4
+L25: .string "qtpomvhuesmprpzqccxb"
+bne *r5
+jmp L284
+L26: cmp r3, L316
+clr r7
+bne *r6
+L27: rts
+clr L259
+red *r1
+bne *r5
+L28: prn r6
+L29: sub *r2, L206
+L30: inc L264
+L31: dec r3
+stop
+bne L214
+jmp *r1
+bne *r2
+jsr *r7
+stop
+clr r7
+L32: cmp r5, r4
+dec L177
+mov r4, L347
+L33: .string "uvdtcynipdmq"
+L34: sub *r7, L182
+rts
+clr L189
+lea L313, r5
+L35: clr *r1
+add *r3, L254
+cmp L267, #10
+stop
+clr L353
+L36: red L143
+dec *r0
+dec r3
+jsr *r5
+cmp #-208, L197
+L37: cmp L93, *r6
+L38: .string "pdqiuuqfliilsamlvkjwnr"
+sub L280, r5
+inc r4
+red r2
+inc *r3
+add L62, L166
+L39: .data -427
+L40: lea L353, r6
+L41: jsr *r2
+jmp *r2
+cmp *r1, #-224
+mov #236, r0
+L42: jsr *r2
+lea L130, r4
+L43: rts
+L44: jsr L181
+L45: sub *r4, r0
+L46: jmp *r6
+lea L50, r2
+L47: .string "nnnjjtcutfbbodmyicu"
+not L284
+L48: add L158, *r5
+rts
+L49: .data 339, 644, 961, 113
+L50: add r3, L151
+lea L117, r5
+L51: .data -75, -188, 931, -889
+L52: stop
+add L227, r6
+not L269
+L53: .data -853, 304
+L54: bne L223
+add #116, L128
+
+L55: clr *r5
+L56: mov #88, r0
+L57: not r5
+mov #153, r4
+L58: stop
+L59: jsr *r1
+add r4, r0
+mov *r1, r6
+L60: bne L86
+L61: .string "blfjtfriaiup"
+dec r2
+cmp L115, r7
+L62: dec L310
+; comment
+L63: not r2
+L64: lea L110, L344
+cmp *r3, L337
+not *r0
+rts
+L65: rts
+lea L246, *r0
+L66: red r1
+jsr L226
+red *r7
+red r4
+L67: dec r6
+L68: red *r4
+; comment
+jmp L196
+rts
+L69: jsr *r0
+prn #-101
+mov r6, r4
+inc *r1
+L70: bne L325
+dec L184
+mov #-115, *r5
+L71: clr *r0
+inc *r7
+sub *r7, L149
+L72: jmp *r0
+L73: jmp L336
+L74: red r5
+
+not *r7
+jsr L106
+not L211
+stop
+L75: sub L326, L346
+L76: .string "xuvsswulkqlwjqqptbzffzz"
+inc *r6
+L77: bne L130
+add r5, r4
+L78: lea L343, *r0
+clr r3
+lea L127, r6
+dec L138
+L79: inc r6
+L80: not L172
+stop
+lea L154, L256
+jmp *r3
+
+mov #-58, L130
+mov r3, *r7
+stop
+dec r5
+jmp L138
+jmp L207
+mov *r6, *r5
+L81: .string "qcxakqniffhphy"
+stop
+L82: jsr L226
+jsr L240
+L83: .data -629
+add L169, r6
+L84: sub r4, *r1
+L85: clr *r3
+L86: bne L315
+L87: .data -200, -145, 14, -442
+red *r2
+red L103
+L88: .string "etjxkqyidcaaalrj"
+dec *r0
+cmp *r4, #-181
+red *r4
+L89: dec L105
+inc L146
+jsr *r5
+not *r0
+rts
+; comment
+L90: bne L243
+inc r6
+stop
+L91: bne *r1
+cmp *r7, #53
+cmp *r0, *r5
+L92: inc *r0
+L93: mov #-23, r7
+stop
+L94: sub r2, r1
+prn r7
+mov L163, L271
+
+
+jmp L113
+bne L174
+L95: red L256
+L96: bne *r0
+lea L207, *r2
+L97: prn #110
+L98: .string "qpmkgfnppzioao"
+L99: clr r7
+L100: .data 821, -19, 414, -913, -736
+L101: dec L201
+add *r4, *r0
+L102: .data 736, -187, -119, 934, -719
+mov #59, r3
+mov *r5, L270
+stop
+
+L103: jmp *r3
+inc r5
+L104: jmp L108
+L105: bne L340
+L106: .string "yftmhicwtcz"
+rts
+L107: rts
+
+mov r0, L328
+L108: stop
+prn *r7
+L109: cmp r3, r7
+L110: not L125
+sub r5, L142
+not L212
+clr L228
+jsr L197
+dec L146
+mov L350, L127
+red *r4
+L111: prn r6
+L112: bne *r3
+L113: .string "umtlnzxzkd"
+L114: dec r4
+L115: .string "tipggdnmryleji"
+cmp #-70, r2
+L116: .data -391, -264, -845, -621, 772
+L117: sub r4, L143
+L118: clr L242
+L119: .string "vqwvdjvxeqlfsr"
+mov L353, r4
+
+mov L251, *r0
+stop
+L120: .string "rbiqqnuuy"
+dec *r2
+mov r3, *r6
+inc L299
+dec L316
+jmp *r4
+stop
+mov #43, *r6
+bne L309
+red r6
+not *r3
+stop
+bne *r3
+L121: jmp L147
+L122: lea L267, *r4
+stop
+jsr L132
+L123: jsr *r4
+L124: lea L253, r1
+red L295
+prn *r4
+not r6
+L125: not r1
+lea L350, L154
+red *r4
+not L239
+add #-214, L190
+mov r0, r6
+jmp *r2
+L126: bne L188
+mov L193, r2
+lea L323, *r3
+add *r1, L173
+cmp *r5, *r2
+L127: jsr L239
+bne L162
+rts
+dec *r4
+L128: .string "uvnmodtz"
+add L231, *r0
+bne L141
+L129: .string "ftimitbfow"
+lea L324, L323
+stop
+L130: not *r5
+mov r4, L338
+L131: jmp *r6
+L132: mov L195, L324
+add #-67, r7
+cmp L316, L168
+not r5
+prn L264
+inc L281
+L133: jmp L269
+cmp #-73, r2
+L134: mov #75, L279
+L135: .string "olpfmxm"
+jsr *r4
+bne L251
+L136: .string "iviyyokhzysdvwj"
+jmp L279
+clr L183
+stop
+dec L241
+mov L305, r3
+jmp *r1
+cmp #107, *r5
+L137: lea L190, r3
+inc *r3
+stop
+L138: .string "etzhmjhrcnyplnnqhdqqou"
+L139: jsr L258
+cmp *r6, *r1
+L140: add *r2, r5
+rts
+sub L311, r2
+L141: bne *r6
+clr r4
+bne L265
+red *r4
+stop
+mov #60, L177
+jsr L245
+lea L355, L166
+L142: .data -512, 704, 385, 45
+
+L143: rts
+L144: bne L304
+L145: dec L247
+L146: clr L287
+lea L341, r2
+sub *r3, L186
+jmp L180
+L147: not L202
+L148: red r5
+prn *r0
+inc L347
+L149: .string "zzvmtpsmsgyojpllcplimza"
+L150: .string "gkehlptkimbbf"
+L151: .data 717, 280, 614, 349, 32, -410
+dec *r5
+lea L357, L208
+inc L309
+not L174
+sub *r5, *r2
+prn *r5
+L152: clr L155
+clr L241
+rts
+L153: inc r6
+L154: inc *r2
+L155: jsr L269
+L156: .data 381, 282, -545, -842, -155
+red r4
+jsr L202
+stop
+lea L243, L311
+L157: .string "uigcqcvxfkaraymjg"
+jmp *r7
+rts
+L158: .data 655, 646, 425
+cmp *r1, r3
+bne L241
+add r1, L220
+clr *r3
+; comment
+L159: not *r4
+clr r5
+L160: .data 639, -672, -443, 206, -341
+L161: dec r0
+red *r1
+prn #-254
+jmp L210
+inc *r7
+L162: add L285, r3
+L163: lea L313, L210
+inc L270
+dec L279
+jsr *r5
+clr *r1
+mov #50, *r2
+prn L258
+cmp r7, L296
+add #245, L223
+L164: red r3
+L165: stop
+lea L284, r1
+L166: red r6
+jmp L167
+prn L357
+L167: inc L324
+rts
+inc r5
+dec r1
+stop
+L168: not *r3
+L169: .string "ugqvxfhhcft"
+L170: add L242, *r7
+L171: .data -59, 794, -547, 784, -976, -56, 99, 667
+rts
+L172: sub #173, L201
+L173: add #176, r7
+L174: rts
+L175: .string "syysztoxew"
+cmp L257, L207
+inc *r6
+jmp *r2
+jsr *r2
+not *r2
+red r7
+add #135, *r7
+lea L300, *r1
+mov r4, r3
+bne L206
+L176: rts
+L177: red r7
+jsr L254
+L178: clr r5
+prn *r3
+L179: jmp *r7
+mov #-174, *r5
+L180: red r4
+prn r0
+L181: prn #238
+bne L273
+L182: rts
+sub *r6, r4
+not r4
+jsr *r7
+L183: bne L258
+clr r3
+inc r0
+L184: add #-111, *r3
+L185: lea L313, L354
+L186: .data 707, -281, 552, 676, 606, -702
+not *r4
+prn L265
+sub *r6, r7
+L187: .string "x"
+red *r5
+L188: .string "vwhmlwopnok"
+inc *r2
+jmp *r2
+jsr L326
+jsr *r0
+prn #235
+L189: clr r6
+L190: mov #236, r1
+L191: stop
+sub L244, *r3
+stop
+prn L269
+mov #34, r1
+jmp *r4
+dec r7
+L192: clr *r6
+L193: .data -194
+; comment
+L194: .string "a"
+prn r7
+add L279, L334
+L195: not L344
+sub r1, L270
+cmp *r6, L231
+clr r7
+L196: lea L247, L244
+mov L282, *r4
+mov #43, L278
+sub #15, L245
+add L277, *r0
+jsr *r7
+rts
+inc L310
+L197: add *r7, L281
+not L243
+bne L273
+add L279, L264
+inc L201
+prn L213
+mov #7, r6
+jsr *r3
+inc L346
+jmp *r0
+L198: .string "dvlpfqdypftvnvpmx"
+bne *r7
+cmp r3, *r3
+lea L296, L358
+not *r6
+rts
+L199: mov L318, r6
+sub r0, L226
+L200: inc r3
+stop
+rts
+lea L347, L316
+clr *r3
+L201: not L237
+mov r6, *r6
+dec r0
+L202: rts
+cmp #84, *r4
+L203: mov r2, r1
+L204: mov L337, L265
+stop
+L205: mov r0, r3
+bne *r5
+; comment
+; comment
+L206: prn L278
+lea L335, r5
+clr r2
+cmp L208, *r2
+not r3
+jsr *r7
+L207: prn L324
+
+inc L329
+L208: .string "wuxqv"
+L209: .data -703, 88, 132, -691, 44, 724, -495
+stop
+stop
+bne *r4
+L210: inc *r5
+clr r1
+stop
+L211: rts
+jmp *r4
+bne *r7
+L212: prn *r5
+L213: stop
+red *r6
+L214: jsr *r3
+jmp L267
+L215: rts
+add r0, *r6
+jmp *r5
+L216: .string "qhibnvspurbpsxuiszcwx"
+inc *r6
+cmp *r0, #136
+rts
+sub *r6, r7
+clr *r3
+L217: jmp *r0
+cmp L252, *r5
+; comment
+L218: sub r7, r5
+L219: stop
+L220: sub #-70, r0
+L221: cmp r5, *r2
+L222: not L250
+not L271
+rts
+L223: prn L333
+L224: inc L298
+sub *r4, *r3
+L225: .data 435, 27
+L226: jmp *r4
+L227: bne *r6
+prn #29
+L228: .string "cvextm"
+rts
+L229: dec *r5
+L230: inc *r4
+mov r3, *r0
+L231: dec L275
+not r3
+L232: .string "fsnycnqyiregxiehvklc"
+L233: .data -841, -937, -758, -558
+L234: .data 540, -455, 933, -777, -534
+L235: add *r1, r4
+cmp r1, *r4
+prn #159
+
+L236: jsr *r0
+not r2
+add #-186, L310
+L237: dec *r4
+not L256
+cmp L344, *r1
+; comment
+L238: .string "al"
+inc L290
+prn L309
+L239: bne *r6
+L240: not L291
+cmp L354, L285
+rts
+inc L308
+rts
+L241: stop
+mov L302, r6
+L242: cmp #-126, L306
+add r5, r1
+L243: prn #200
+L244: .data -776
+L245: add r7, r6
+L246: red *r6
+inc *r2
+L247: mov #60, L270
+cmp *r4, *r0
+dec L322
+inc *r7
+bne *r3
+red L317
+L248: clr r1
+; comment
+L249: inc *r4
+L250: sub L269, L328
+jsr *r7
+mov L303, L282
+; comment
+L251: prn L303
+L252: not L282
+rts
+jmp *r6
+lea L264, L290
+bne *r7
+sub *r7, L313
+red r7
+not L260
+L253: bne *r6
+L254: stop
+cmp *r1, r4
+jmp *r3
+
+not *r0
+add *r1, r6
+inc L301
+rts
+not r6
+L255: inc *r6
+bne *r6
+L256: red L312
+rts
+L257: sub *r5, L277
+jmp *r6
+jmp *r2
+jmp L355
+clr *r5
+L258: not L285
+L259: add #-87, r5
+jmp L305
+L260: lea L275, *r3
+L261: rts
+L262: cmp L357, L324
+sub *r5, r7
+add *r6, r6
+clr *r1
+add *r4, r4
+L263: red *r0
+rts
+cmp *r4, *r6
+add #9, r1
+dec L272
+prn L320
+L264: jsr *r2
+L265: red r1
+stop
+jsr *r1
+rts
+L266: .data 880, -899, -434
+jmp *r1
+L267: bne L344
+clr r5
+L268: add L338, *r3
+not L349
+add r3, *r1
+L269: jsr *r3
+L270: red *r0
+L271: sub L315, *r6
+red L356
+prn *r7
+red *r0
+; comment
+lea L297, L300
+L272: .data -417, -516, 579, -764, -543, 788, -899, -442
+; comment
+dec *r5
+L273: .string "eacmkirtunvzdkbq"
+L274: .string "wglhck"
+dec r6
+L275: .string "nr"
+L276: sub #-213, L331
+clr r7
+sub r5, *r3
+rts
+bne L337
+lea L312, *r0
+L277: .data 21, 566
+; comment
+lea L311, r1
+red *r6
+L278: lea L322, *r2
+; comment
+L279: .data -394, 908, -770, 170, 578, -633
+jmp L280
+cmp r1, #-168
+sub #-51, r4
+L280: prn #134
+clr *r5
+rts
+dec r2
+inc r2
+L281: .data -142, -606, 960, -327
+not L357
+cmp #140, #-156
+prn *r5
+L282: stop
+L283: red r3
+not r3
+L284: add *r5, *r3
+L285: stop
+not L307
+L286: .string "fniqn"
+jmp *r1
+rts
+
+add *r0, *r4
+sub #-51, L288
+L287: jmp L292
+inc r2
+bne *r2
+; comment
+cmp #128, #106
+L288: prn r4
+L289: prn #-143
+clr L328
+L290: sub #-239, r5
+mov L297, *r1
+L291: .data 228, 631, 227, 978
+jsr L312
+jsr L303
+bne *r7
+cmp *r4, L335
+clr r6
+L292: rts
+mov r5, r5
+L293: .data 92, -854, 95
+bne *r0
+L294: .string "znk"
+; comment
+mov *r3, r2
+clr L337
+L295: add #32, r0
+sub *r5, *r2
+L296: lea L313, L339
+; comment
+cmp #-198, r1
+
+L297: prn #126
+bne *r7
+add L349, *r3
+L298: jmp L341
+L299: mov *r1, *r3
+L300: prn L323
+dec r3
+L301: rts
+cmp L312, r4
+clr r3
+L302: .data 371, -953, 703, -667
+cmp L305, *r4
+
+sub *r0, r0
+cmp r2, *r0
+
+dec L312
+L303: sub r0, r4
+; comment
+L304: lea L311, *r2
+
+add r7, r1
+L305: not r2
+L306: cmp #-256, #225
+red L343
+sub *r7, *r7
+L307: prn r5
+inc *r7
+bne *r4
+stop
+prn *r6
+
+cmp *r5, L313
+lea L345, r7
+jsr *r7
+sub #-222, *r1
+clr L335
+prn *r0
+prn r3
+; comment
+mov #-165, L354
+L308: .string "jxiqywbatuntmhocsycc"
+L309: dec *r4
+L310: bne *r7
+sub *r4, r7
+inc L342
+L311: not L356
+L312: cmp #-202, *r5
+jsr L335
+; comment
+rts
+not r7
+L313: cmp *r1, L334
+not L357
+clr L321
+jsr *r1
+lea L345, *r4
+; comment
+; comment
+L314: stop
+jmp L342
+
+stop
+L315: jmp L322
+cmp *r3, *r3
+L316: mov *r4, L323
+L317: inc L338
+L318: .data -260, 207, -174, 600, 879
+cmp *r3, *r3
+bne *r6
+L319: mov #181, *r4
+L320: not L352
+red *r0
+dec L329
+inc *r5
+L321: lea L352, L350
+inc *r4
+add #-222, r0
+L322: rts
+red r5
+L323: inc *r1
+jmp *r7
+L324: lea L331, *r2
+L325: lea L350, *r1
+add *r5, *r4
+mov #27, L349
+L326: jsr L333
+dec L351
+L327: red *r5
+mov #-188, L330
+L328: bne L335
+
+L329: jmp L347
+jsr *r6
+L330: rts
+stop
+add L341, r6
+stop
+inc *r4
+L331: cmp L340, L356
+L332: rts
+jsr *r5
+sub r7, *r6
+prn *r7
+jmp *r4
+red *r2
+L333: rts
+sub #4, L344
+lea L340, *r2
+L334: bne *r2
+L335: jsr L346
+add L336, r3
+lea L340, r5
+L336: .data -413, -122, 302, 564
+L337: jmp L340
+stop
+mov #-235, L353
+lea L344, r7
+clr r6
+stop
+jmp *r4
+L338: .string "ihpcvhqaygvloa"
+prn r0
+L339: mov L341, r1
+L340: mov L352, *r6
+L341: jsr *r0
+stop
+lea L351, *r5
+lea L356, *r6
+prn r2
+L342: cmp *r0, #133
+L343: lea L351, L351
+jsr L357
+clr *r3
+add *r6, r7
+L344: clr L356
+
+L345: lea L356, L348
+sub *r6, L352
+sub *r1, *r7
+stop
+cmp *r7, L357
+L346: jsr *r2
+clr L358
+add #185, L354
+stop
+dec r3
+mov L358, r6
+L347: rts
+dec L355
+L348: .string "uunvpphwjrgjmc"
+mov L352, r4
+jmp L358
+sub *r3, L351
+L349: lea L354, r3
+dec *r3
+red *r7
+lea L355, L358
+cmp L358, *r5
+bne *r4
+bne *r5
+L350: rts
+L351: .data 627, -275, 338, -201, 403, -381, 586
+; comment
+cmp *r2, L354
+sub *r6, r1
+L352: mov L356, *r6
+stop
+not r1
+not *r0
+jsr *r2
+jsr *r3
+L353: inc L355
+sub *r1, r5
+L354: .string "zzftgiq"
+rts
+L355: dec L356
+add L356, r5
+L356: jsr *r5
+L357: .string "cqrqrpy"
+L358: inc L6
+
+add #-46, *r7
+jmp L325
+dec r6
+stop
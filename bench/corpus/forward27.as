@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 28
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+L0: jsr *r2
+bne *r0
+; comment
+L1: lea L7, L103
+clr *r4
+stop
+L2: sub L152, r4
+inc r5
+jmp *r7
+red L60
+add *r2, r7
+jmp L223
+L3: not L176
+L4: cmp *r5, *r0
+L5: .data -52, 204, -83, -224, 921
+
+mov *r7, L217
+jmp L217
+clr L33
+dec *r3
+
+L6: dec *r3
+inc r7
+L7: clr *r5
+L8: dec L293
+dec L330
+L9: jmp L264
+inc L70
+sub *r0, L82
+L10: add r2, r3
+red L252
+L11: .data -463, -323, -835, -800
+L12: .data 668, -998, -232, -595, -109, -555, -890
+L13: sub #40, *r4
+sub *r0, L270
+
+L14: dec r7
+rts
+sub L48, r4
+mov L242, r1
+sub L156, r2
+mov *r2, L66
+; comment
+L15: mov *r3, L134
+stop
+L16: not L192
+clr L309
+L17: add r7, *r5
+sub #-157, *r3
+inc L244
+L18: red L176
+L19: .data -44, -157, -325, -992
+lea L356, r0
+lea L85, *r3
+L20: inc r6
+L21: jsr L71
+L22: .data -664, 74, -854, 35, 139
+red r2
+
+rts
+add r1, r7
+bne L122
+not *r6
+sub #184, r3
+stop
+L23: .string "iyvqrra"
+lea L76, *r3
+lea L117, r6
+jmp *r7
+red L147
+L24: .string "sovcnhiafts"
+mov *r1, r4
+L25: jmp *r5
+jsr L218
+L26: .data -179, 959, 620, -799
+; comment
+dec *r0
+L27: inc r0
+L28: dec *r0
+L29: dec *r1
+cmp *r0, #30
+prn *r0
+not *r5
+
+mov #-162, L290
+mov #-161, *r1
+L30: not *r6
+prn *r3
+prn r4
+; comment
+L31: .data -528
+bne L78
+red L269
+cmp L51, L186
+L32: add L182, L351
+L33: stop
+L34: .data 738, -234, 738, -727, 432
+L35: .string "vhpxqqqt"
+
+L36: .data 956, -408, -587
+red *r3
+add r3, r1
+rts
+L37: .data -958, -249, -974, -130, 267, -705, 586, -736
+bne L48
+L38: .data -168, 702, 117, 317
+L39: lea L283, L301
+L40: inc L119
+bne L133
+L41: clr L252
+L42: jmp L193
+L43: add #163, *r6
+stop
+cmp #134, L166
+not L121
+lea L321, *r0
+
+mov *r4, L303
+L44: add L356, r1
+cmp #-87, r4
+red r4
+L45: stop
+add *r2, r1
+jsr *r7
+L46: inc L183
+L47: bne *r2
+sub *r4, *r5
+L48: red *r5
+L49: inc *r7
+prn r4
+L50: add #35, r6
+L51: .data -114, 863, -479, -428, 541, 577, -157, -608
+L52: mov r6, *r2
+L53: inc *r0
+clr L213
+L54: cmp *r4, L64
+L55: .data 561, 846
+red *r7
+bne L279
+sub r1, L121
+L56: .data -327
+jsr L176
+L57: cmp *r5, r5
+prn r6
+cmp r4, L107
+add L301, L82
+prn r7
+sub r6, *r4
+L58: .data 34
+lea L174, L96
+L59: .data -67
+mov r3, L207
+bne L152
+L60: stop
+add r4, r1
+jmp *r5
+L61: .string "vfoxtjb"
+L62: lea L277, r5
+L63: jsr *r3
+add L191, *r2
+L64: red L314
+sub L132, L240
+stop
+L65: .string "okqldbcpqmtn"
+bne L305
+add r7, *r3
+L66: jsr L274
+L67: bne *r4
+lea L234, L174
+jsr *r0
+cmp *r0, *r2
+jsr L84
+L68: dec *r7
+L69: .data -464, 862, -529, 737, 325, -633, 262, 395
+lea L86, r4
+L70: rts
+prn r7
+L71: red r3
+prn r6
+L72: inc *r6
+L73: jmp L307
+stop
+jsr *r6
+prn L120
+add *r4, r7
+add *r6, L343
+L74: cmp L241, r0
+; comment
+rts
+L75: rts
+
+red r0
+prn L281
+L76: prn *r0
+lea L334, *r2
+red L100
+L77: .string "xhhdduwfjyyqgioszkisisl"
+add #175, r4
+clr *r1
+prn r0
+bne L103
+L78: jmp *r3
+red L142
+L79: .string "srxwuzveathwuulszttg"
+L80: dec L293
+jsr *r1
+L81: prn L302
+L82: .data -22, -641, -598
+prn #-77
+stop
+L83: mov *r0, *r4
+mov r0, L263
+L84: clr *r4
+bne L250
+clr L311
+not r7
+stop
+prn r7
+L85: rts
+mov #12, L356
+L86: .string "oxyhplplkqkzilcmqyakwm"
+L87: .data 847, -562, -933, 898
+L88: red L198
+L89: .string "abcjmngurtzlcvecdpvomhx"
+mov r4, *r4
+red r3
+L90: mov #84, L307
+dec *r2
+bne *r1
+mov r0, r4
+add #-61, r2
+jsr L310
+mov L253, L247
+bne L332
+L91: mov #-148, L175
+inc *r2
+stop
+lea L177, r4
+
+L92: jsr L157
+red *r1
+L93: .string "kwoeliwzmhargioj"
+cmp *r1, L335
+
+prn r5
+clr L166
+lea L119, r5
+dec *r4
+red *r3
+clr r3
+L94: clr L127
+mov *r1, L193
+rts
+prn #106
+lea L182, r4
+L95: dec r4
+L96: .string "tt"
+cmp *r5, r1
+mov L164, *r6
+L97: rts
+L98: .data 480, -282, -730
+L99: rts
+mov L352, L283
+red L216
+clr r1
+L100: prn r7
+sub #150, r7
+prn r6
+clr L328
+bne L211
+; comment
+not L265
+not *r3
+jmp L324
+rts
+clr L352
+add *r3, L320
+bne *r5
+jsr L259
+red r4
+rts
+L101: .data 174, -497, -936, 253, 499, 120, -559
+L102: .string "ihuhitapevzyzfcavj"
+L103: red L122
+
+cmp #95, r7
+jmp L296
+L104: sub *r2, *r4
+prn *r7
+inc r3
+L105: lea L153, r2
+jsr L227
+stop
+not *r2
+cmp L274, *r5
+not r5
+prn L184
+dec r7
+; comment
+prn #-228
+jsr *r7
+inc L230
+jmp L193
+L106: clr *r2
+L107: .data -831, -568, 671, 836
+not *r4
+cmp #221, *r6
+L108: stop
+L109: .string "pxuumqkeontcopwcry"
+L110: jsr L267
+sub #77, r2
+red *r5
+inc *r6
+prn L213
+L111: rts
+mov L301, L163
+cmp *r1, L262
+L112: stop
+jmp *r1
+clr L357
+sub r5, *r4
+jsr *r7
+lea L200, r1
+L113: inc r2
+not r3
+L114: .data 614
+sub r5, *r7
+L115: jsr L132
+L116: .string "uctflqrjpvhzmcvgwkyy"
+add L160, L267
+L117: prn *r1
+
+L118: cmp #-131, r0
+; comment
+L119: jsr *r6
+L120: .string "eupuolltz"
+dec *r3
+
+cmp *r5, *r6
+inc L290
+clr *r3
+inc r3
+bne L186
+cmp *r7, r6
+
+sub r1, *r0
+jsr L200
+
+cmp L248, *r7
+L121: bne L277
+not *r3
+L122: .data 79, 345, -165, 13, 148, -900, 554
+L123: inc r0
+not *r5
+red *r3
+jmp *r1
+L124: rts
+lea L151, *r6
+L125: .data -14, 456
+dec r3
+cmp #138, #115
+cmp L220, *r6
+jmp *r0
+L126: .data -715, -603, 450
+rts
+L127: lea L181, L334
+inc *r1
+rts
+mov #232, r7
+L128: add *r6, *r2
+L129: rts
+add r4, r4
+; comment
+sub *r7, r3
+sub r5, r6
+cmp L278, #244
+sub L326, L138
+jmp L246
+L130: .data 939, 182, -167, 262, -418, 356, 414
+L131: .string "bwhbhntpo"
+red r3
+L132: jmp *r4
+rts
+L133: .data 958
+clr r0
+not *r5
+L134: .string "mylax"
+clr L278
+prn *r7
+stop
+L135: .data 167, -418, 817, -992
+jmp L142
+L136: .data 447, 231, -984, -678, -781, 151, -913
+inc L234
+prn r3
+L137: lea L290, L158
+jmp *r0
+cmp *r7, *r3
+sub *r2, r3
+prn *r6
+jmp *r7
+sub L328, *r2
+add r7, L233
+L138: mov L286, *r4
+L139: not *r3
+jsr *r0
+cmp r0, r7
+
+inc *r6
+jmp L224
+mov *r7, L290
+
+L140: bne L216
+cmp *r1, #151
+lea L345, L304
+prn *r1
+L141: mov *r5, L222
+not r3
+L142: red L212
+L143: .data 673, 746, -956, 639, -283
+stop
+jmp *r1
+prn *r7
+; comment
+dec L249
+L144: .data -423, -149, -791, 930, 315
+bne L188
+clr L224
+L145: prn #-148
+clr *r5
+stop
+sub #-224, L248
+rts
+mov *r3, r5
+L146: cmp #-215, L349
+prn *r3
+L147: mov *r3, *r4
+lea L256, *r5
+L148: clr L288
+L149: stop
+; comment
+L150: stop
+mov r0, L355
+mov #48, r6
+L151: dec L284
+rts
+L152: lea L230, *r3
+cmp *r7, L171
+sub *r4, *r1
+add r7, *r6
+clr L299
+rts
+not r2
+sub *r7, *r5
+L153: lea L243, r7
+L154: stop
+clr *r1
+add r4, *r1
+L155: sub r2, *r3
+lea L172, *r1
+lea L297, L208
+mov #95, r2
+L156: .data 812, 314, 531, 556, -428, -953, 169, 293
+mov *r4, *r7
+stop
+L157: inc L347
+L158: .data 491, 106, 569, 435, -91, -791
+jmp L164
+L159: lea L318, *r4
+L160: .string "aglhkapidwa"
+prn #59
+bne *r3
+inc r7
+L161: jmp *r7
+clr r1
+L162: .string "wzq"
+mov #-122, r1
+sub #-157, r6
+L163: bne *r0
+add *r1, *r4
+L164: rts
+bne *r5
+; comment
+L165: clr r3
+L166: dec L207
+L167: jmp *r1
+rts
+add L286, r0
+rts
+L168: lea L256, *r7
+add L183, *r2
+prn #30
+L169: not r3
+inc *r7
+lea L278, L187
+mov r7, r4
+L170: dec r2
+clr r2
+L171: mov L269, *r7
+L172: .data -579, 995, 340, 851, -479, -100, -768, 68
+cmp r6, *r0
+L173: prn r1
+inc *r0
+clr L191
+not L282
+L174: rts
+lea L332, L268
+dec *r5
+not r4
+clr *r6
+red L253
+L175: stop
+sub *r4, *r5
+jmp L300
+L176: rts
+clr r0
+prn r6
+L177: clr r3
+sub *r3, L231
+L178: add r7, r4
+red L197
+not r7
+prn r0
+L179: .string "armawugghvvgquybikjae"
+L180: .string "ddls"
+not L283
+bne L323
+not r0
+L181: red r5
+add #96, *r6
+dec *r3
+clr L251
+L182: red L194
+jmp *r4
+jsr L198
+
+; comment
+inc r1
+L183: add L319, *r6
+L184: lea L322, *r2
+inc L269
+mov r6, L317
+L185: stop
+L186: red L213
+red r6
+not L250
+L187: red L249
+cmp r2, #-254
+L188: mov r5, *r4
+L189: clr L246
+inc L190
+L190: .data -78, 594, 316, -528, 565
+lea L293, r6
+jsr *r7
+dec L209
+red L327
+dec r5
+rts
+inc L321
+prn *r7
+sub *r1, r1
+cmp #-62, r7
+L191: prn *r2
+inc L222
+rts
+L192: cmp r3, #216
+
+mov L255, L297
+jsr *r1
+sub *r6, r2
+add #250, r7
+rts
+L193: cmp *r2, *r5
+L194: inc L320
+mov r6, r2
+red L225
+L195: .data 509, -428, 34, -456, 787, 375
+red L282
+lea L199, r7
+L196: not *r0
+sub *r7, *r6
+red L282
+add #-4, r3
+bne L335
+L197: red *r5
+inc *r1
+stop
+lea L247, r5
+dec *r5
+L198: .string "xlkqfnpuwxbuennfgwev"
+L199: .data -290, 975, -936
+L200: lea L354, r0
+sub #-224, r2
+red L346
+dec *r1
+lea L319, r6
+jmp *r4
+rts
+L201: .string "nqcmx"
+L202: add #197, L273
+jmp *r0
+inc *r2
+jmp *r1
+L203: add *r0, L251
+prn L285
+rts
+bne L236
+add *r2, *r6
+rts
+dec r2
+sub *r2, r4
+dec r7
+lea L305, L219
+L204: red L340
+inc *r7
+bne *r2
+L205: sub *r1, r1
+jmp *r3
+jsr *r1
+mov #205, *r7
+rts
+mov L320, L251
+add L233, r1
+L206: red *r5
+red *r2
+dec *r1
+L207: not *r0
+rts
+L208: .string "oaauonuixcycsncuy"
+mov L336, r0
+bne L285
+L209: rts
+prn r7
+L210: clr r3
+red L326
+L211: .data 19, 689, 98, -710, 545, 376, -821, -885
+jsr L311
+; comment
+jsr *r1
+lea L223, *r0
+jmp L248
+bne L320
+rts
+stop
+jmp *r5
+lea L216, *r3
+cmp *r4, r6
+; comment
+; comment
+L212: .string "eovu"
+prn #201
+L213: not L351
+bne L284
+jsr L307
+L214: not L215
+L215: mov L308, *r1
+inc r3
+L216: add #-153, L349
+clr L348
+L217: sub L325, r2
+add #82, *r3
+jsr *r4
+L218: red r0
+cmp *r1, #147
+L219: stop
+not r1
+L220: not L282
+sub *r6, r6
+jsr *r7
+lea L241, r1
+not L355
+L221: jsr L291
+
+L222: cmp #219, *r5
+L223: cmp r4, r6
+lea L253, L290
+dec *r5
+L224: jmp *r7
+sub L345, L330
+L225: cmp r1, #-142
+jsr L270
+L226: lea L243, r2
+L227: .data -721, -192, -676, 356, 993, 415, -485
+L228: dec L300
+prn #102
+bne L270
+L229: not *r2
+L230: lea L335, L310
+cmp *r0, *r1
+L231: not L271
+L232: .string "dkcrwsswrllrzmdsvwnll"
+L233: .data -961, 214, -864, 469, -543, -635
+sub #-52, *r3
+L234: prn #-124
+jmp L303
+L235: .string "mkudmounabvmpcnokdbho"
+not *r5
+L236: jsr L327
+L237: .data 830, 110, 211, 464
+L238: inc *r3
+inc *r0
+bne *r3
+L239: .string "snmguynkeeojhdtchbdcsf"
+rts
+inc L261
+L240: .data 252
+L241: mov #-191, *r3
+dec r3
+sub *r7, *r2
+L242: not *r0
+L243: .data -88, 658, -744, 917, -240, -110, 774
+L244: dec L270
+prn #-92
+lea L342, L273
+dec *r0
+L245: lea L282, r7
+rts
+L246: bne *r0
+; comment
+inc r7
+L247: red *r6
+L248: .data -223, 81
+L249: .string "venuyoaoteljrg"
+bne *r1
+L250: red L257
+red *r7
+L251: red r5
+jmp *r4
+bne L298
+jmp *r2
+L252: add r4, r2
+jsr L272
+rts
+; comment
+L253: jmp L327
+lea L297, *r3
+L254: .string "mcchib"
+L255: inc r6
+cmp #-97, r5
+not *r6
+L256: .string "lbvxxaohkfepoeyqmafa"
+lea L352, r7
+jsr *r2
+L257: jsr *r4
+L258: clr r3
+sub r1, *r1
+jsr L291
+stop
+sub *r4, L349
+L259: bne L353
+L260: lea L297, L268
+L261: add #-2, r6
+stop
+L262: clr r0
+cmp *r7, *r3
+lea L285, r7
+not *r7
+cmp r2, r0
+L263: dec *r6
+stop
+clr r4
+lea L351, *r3
+mov r4, r2
+rts
+lea L341, L280
+mov r2, r6
+L264: cmp *r1, r1
+rts
+L265: sub L349, *r2
+L266: jmp *r7
+L267: .data 771, 107, 494, -394, 113, -419, 918, 101
+L268: add r3, *r7
+add L280, *r5
+prn #-58
+bne L342
+L269: prn *r4
+bne L288
+L270: .string "npypaxj"
+not *r4
+; comment
+L271: bne *r7
+jsr *r3
+L272: dec r4
+red *r3
+bne *r4
+sub #55, r0
+cmp r7, r7
+L273: clr L346
+sub r4, r3
+L274: .data 358, -753, -465, -924, -933, 826, 719
+prn #50
+jmp L345
+bne *r4
+mov r1, L296
+L275: lea L330, L349
+L276: stop
+cmp *r4, L313
+cmp #30, *r2
+bne L342
+lea L321, L305
+; comment
+L277: red L286
+mov #-104, r1
+L278: prn r5
+red r5
+L279: .string "vyhruawf"
+L280: dec *r0
+jmp *r7
+L281: add L329, L313
+add r6, *r3
+rts
+L282: add r1, L307
+L283: .data -46, 136, -788, 202, -93, -367
+L284: stop
+red *r0
+rts
+L285: cmp #-92, *r6
+clr L290
+sub L293, r3
+red L286
+jmp *r1
+L286: .string "zoswxttkytziliz"
+L287: mov *r6, L323
+add #252, L321
+dec L302
+L288: .data -904, 603, 770, 328, -772, -605
+jmp L308
+L289: dec r1
+prn L348
+jmp *r1
+prn L354
+L290: .data -57, 460, 549, -552, 457, -678
+red L356
+prn r2
+L291: jsr *r2
+prn #-223
+L292: jmp *r2
+; comment
+cmp #-78, #73
+cmp r3, r1
+cmp r3, *r0
+not r7
+red L304
+prn #78
+not L345
+L293: jmp L351
+L294: bne L317
+add r0, *r6
+L295: add r7, r2
+clr *r3
+red *r6
+L296: not r5
+L297: sub L351, *r7
+; comment
+bne L315
+L298: sub L332, L339
+bne *r4
+mov r7, r0
+L299: not L341
+L300: inc *r7
+cmp r5, L323
+L301: add r4, L333
+dec L308
+lea L350, L332
+stop
+L302: lea L313, *r0
+
+stop
+L303: inc *r7
+prn #187
+L304: red *r0
+L305: cmp #166, L323
+jmp L331
+L306: .string "wymbjtuoyv"
+L307: .data 197, 923, -654
+add #229, L352
+L308: not L314
+red *r7
+clr L324
+stop
+L309: prn L318
+L310: .string "iuamyqpnbeqh"
+L311: add #-169, L325
+sub L336, *r4
+not *r1
+L312: .data -443, 124, -444, -319, 924, -894, -781, 972
+jmp L332
+red L321
+L313: .data 812, 964, 670, 902
+L314: .data -87, 104
+jsr *r2
+L315: not *r2
+prn L329
+jmp L330
+inc L347
+clr *r7
+rts
+clr L354
+L316: cmp #177, L334
+L317: mov L345, L356
+L318: dec *r2
+not L345
+L319: .data -463, 369, 449, -862, 380, -642
+bne L331
+sub *r2, *r1
+L320: .data 940, 933, 320, -942, 822, 451, 813
+
+jsr L337
+L321: red r6
+L322: bne *r4
+lea L356, *r3
+clr L330
+rts
+add r1, L328
+L323: red L339
+stop
+L324: add r4, r3
+L325: mov *r3, r4
+cmp *r1, r6
+bne L351
+lea L348, r2
+not *r4
+lea L331, L334
+L326: cmp *r2, #-140
+bne L342
+L327: red *r4
+L328: not r4
+jmp *r1
+clr *r1
+dec *r5
+L329: .string "oectblahcmfammuavmlptd"
+jmp L335
+L330: bne *r2
+add L357, *r1
+rts
+rts
+lea L350, *r1
+L331: stop
+bne *r0
+dec *r4
+cmp #39, L333
+L332: jmp *r5
+dec L348
+sub *r3, r7
+L333: .string "e"
+cmp L352, r2
+stop
+L334: mov L344, r5
+clr *r3
+L335: rts
+bne L342
+rts
+clr r5
+L336: stop
+prn *r5
+L337: red *r2
+L338: .string "tatfstfgtjhsu"
+bne L353
+bne L347
+dec L340
+sub *r2, *r7
+bne *r1
+inc r2
+L339: .string "dhzg"
+L340: red r6
+L341: red r4
+stop
+mov L349, r0
+lea L351, *r0
+stop
+mov *r4, *r2
+L342: dec L343
+jmp L348
+add #223, r7
+bne L354
+jmp L345
+L343: not *r6
+L344: prn L357
+sub L349, *r3
+L345: bne L354
+L346: add #-170, *r6
+; comment
+L347: cmp *r0, L348
+L348: bne *r7
+jsr L349
+L349: rts
+L350: not *r5
+L351: clr *r5
+L352: not r0
+L353: .data -912
+dec r4
+L354: .data -495, -513, 808, -685, 338
+prn r4
+L355: dec *r0
+jsr *r0
+L356: cmp r7, *r4
+L357: lea L358, *r7
+clr r6
+L358: .data -128, 198, 177, 783, -951, 753, 463, 962
+inc *r0
+stop
@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 29
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+red r4
+L0: mov L141, L262
+L1: sub L193, *r7
+sub L37, *r3
+L2: .data -4, 778
+
+inc L179
+rts
+lea L181, *r1
+L3: .string "sblocnx"
+L4: .data -371, 692, -274, 614, 829, 239
+L5: red *r3
+not *r6
+red L177
+bne *r4
+clr r5
+not r4
+L6: .data -417
+bne L75
+red r4
+red *r4
+mov r1, *r2
+rts
+stop
+L7: .string "fuhrzno"
+L8: add L18, L97
+L9: .string "nyxvvmmut"
+L10: not r0
+L11: clr *r3
+add #132, L297
+bne L216
+L12: bne *r2
+mov L274, *r1
+lea L224, r7
+L13: .string "knb"
+L14: clr r1
+L15: .data 236, -187
+L16: rts
+inc r3
+
+clr *r4
+dec r4
+L17: dec L225
+jsr *r7
+L18: stop
+sub *r2, *r4
+cmp *r1, #96
+lea L259, *r3
+jmp *r6
+prn *r0
+mov *r3, *r2
+add L265, *r5
+jsr L255
+stop
+L19: .string "zpqabxfwoztasj"
+L20: red r0
+bne L167
+L21: .data 308, -452
+L22: jmp *r1
+clr L178
+jsr L262
+L23: .string "yigbbhxngc"
+L24: jmp *r2
+sub #16, *r6
+jsr L284
+lea L100, *r5
+L25: jmp *r4
+cmp r0, L317
+bne L359
+mov r1, *r6
+L26: dec L342
+L27: lea L257, L30
+cmp L61, L223
+lea L135, L269
+dec L32
+
+red L78
+inc *r6
+L28: .data -520, -187
+cmp #105, #-133
+mov *r4, L129
+L29: red *r2
+lea L351, r4
+prn #98
+L30: sub r2, L179
+rts
+red *r0
+mov *r4, L281
+dec *r3
+not L273
+lea L156, *r3
+rts
+L31: not L250
+bne L270
+add L198, L201
+; comment
+jmp *r7
+rts
+L32: prn #39
+not r0
+L33: cmp L100, r2
+
+L34: .string "ueordnohgkaanjiyduyiq"
+inc r6
+add r3, r7
+L35: .data -597, -555
+L36: lea L248, *r3
+jsr *r4
+not L263
+L37: .string "navlzpmqemtbmrsw"
+; comment
+clr L142
+red *r5
+not L118
+not r6
+jmp *r0
+cmp L251, L192
+L38: clr r7
+L39: clr *r7
+
+L40: prn L109
+; comment
+L41: .string "pswmgdfcvo"
+inc *r0
+rts
+L42: sub *r0, r3
+red r0
+L43: add L325, L356
+L44: mov #241, r4
+jmp *r5
+rts
+jsr L170
+add L155, *r7
+L45: jsr *r2
+bne *r3
+L46: clr *r7
+sub *r4, r5
+L47: lea L271, L242
+inc *r2
+red L337
+mov L87, L246
+
+jmp *r0
+clr r7
+clr L341
+jmp L188
+L48: dec *r6
+inc r4
+inc r0
+L49: red L153
+L50: .string "bawxwmjqktmvgsso"
+; comment
+add *r5, r5
+jmp L76
+clr L59
+L51: jmp *r7
+add r6, L185
+rts
+L52: inc r3
+
+rts
+bne L284
+prn L135
+dec *r1
+inc r1
+dec *r7
+; comment
+L53: .data -113, -778
+sub L135, r7
+L54: red r5
+; comment
+L55: inc *r4
+L56: sub r0, r6
+stop
+rts
+dec r5
+bne *r6
+L57: .string "eidhmbjsagqslj"
+clr L187
+not *r7
+L58: jmp L220
+clr L217
+L59: clr r4
+L60: clr *r7
+add #106, r7
+red L112
+mov *r2, r2
+L61: .data 792, 730, -845, 893
+L62: sub *r5, r4
+inc L279
+bne *r2
+L63: stop
+add #-248, r6
+; comment
+L64: not L166
+not L170
+inc r5
+jsr L293
+L65: sub *r2, L237
+mov #238, r1
+add r4, *r0
+rts
+dec *r5
+jsr *r1
+L66: cmp #-227, #78
+L67: mov #-132, r3
+lea L220, *r3
+inc *r5
+stop
+L68: .data -996, -771, -943, 732, -653
+
+rts
+L69: mov L199, *r6
+L70: inc *r1
+prn *r6
+dec r1
+dec L104
+L71: red *r1
+stop
+L72: lea L93, *r7
+stop
+L73: clr r5
+L74: .data -238, 434, -630, -233, 875, -275, -364
+rts
+stop
+clr L296
+not *r7
+L75: .data -743, 861, 870
+L76: red *r6
+; comment
+not L257
+prn #9
+rts
+not r4
+L77: not *r4
+L78: .string "xhrhbciynmn"
+mov r0, *r2
+mov L283, *r7
+jsr L178
+inc r3
+L79: inc *r2
+
+L80: jsr *r7
+red L122
+L81: jsr *r4
+
+L82: prn r4
+L83: sub *r2, r3
+L84: .data 152
+cmp *r5, #28
+jmp L131
+L85: clr *r0
+L86: dec *r5
+L87: rts
+L88: .data -818, 661, -811
+L89: jsr L329
+inc L354
+L90: clr r4
+add *r7, L330
+mov r7, r6
+add L119, L290
+red r3
+stop
+L91: inc r4
+red L112
+L92: lea L285, r3
+dec r4
+; comment
+L93: not *r1
+L94: .data -569, 522, 464, 873, -600, -213
+
+stop
+L95: not L199
+L96: lea L117, L138
+
+inc r2
+clr r2
+
+L97: .string "gycdgpajbdouarqjptui"
+L98: rts
+L99: stop
+L100: .string "zkgyrjxmslmvnu"
+dec r2
+; comment
+inc L123
+stop
+L101: bne L135
+L102: mov #189, r4
+
+mov *r2, *r6
+L103: inc r0
+L104: clr r1
+mov *r0, r5
+L105: .string "ytrpuhbgd"
+L106: sub #-24, L169
+sub r1, *r4
+prn #168
+not L193
+
+L107: not r7
+dec r2
+
+clr r4
+bne L110
+not *r0
+dec *r0
+L108: .string "bzxvwouekknkx"
+dec *r0
+L109: cmp #-19, L324
+not *r1
+L110: clr r6
+mov #-186, L298
+lea L307, r6
+jmp L192
+mov #203, L204
+red L363
+inc r7
+L111: not L183
+
+prn L291
+mov *r7, r4
+L112: inc r0
+rts
+sub L151, *r5
+inc r5
+L113: clr *r7
+not r7
+jsr *r2
+L114: lea L214, L338
+L115: red *r4
+add r7, *r1
+cmp L117, #-81
+prn *r6
+L116: clr *r3
+add *r7, L197
+L117: .string "mecbqqlpejxgqmcwmnlej"
+jmp *r6
+stop
+rts
+inc *r0
+add #-71, L144
+add r0, *r5
+sub #37, L316
+prn L259
+clr r1
+L118: rts
+mov L134, r2
+add L346, r6
+sub *r6, L241
+L119: inc *r5
+sub #-222, *r2
+inc r5
+L120: red L343
+L121: sub r4, r0
+L122: .string "nkljlnmjnlmrpxaqzaqb"
+L123: dec r6
+red L246
+; comment
+L124: cmp #13, *r2
+mov L357, *r6
+dec r3
+L125: inc L180
+L126: lea L226, *r2
+inc *r3
+rts
+L127: .data -502, -766
+add r1, r1
+L128: inc L231
+dec r0
+L129: red *r2
+jsr *r5
+L130: red *r6
+bne *r3
+L131: rts
+bne *r6
+dec *r1
+inc r5
+L132: .string "zgksnuece"
+inc *r5
+L133: .data -78, -716, -248, 97, -230, 432
+
+add L243, L267
+; comment
+rts
+clr *r4
+lea L215, r5
+lea L150, L154
+jmp *r7
+L134: bne L208
+L135: .string "dpazuaymgyumm"
+jmp L359
+red r2
+not *r6
+prn L194
+not r3
+sub *r3, r7
+red *r5
+cmp *r6, r6
+dec r1
+clr r0
+bne *r0
+prn r2
+L136: jsr L227
+cmp r2, #-80
+; comment
+L137: mov r7, *r6
+
+cmp r4, r5
+rts
+clr L192
+jsr L226
+sub #-43, r7
+inc r4
+L138: cmp *r7, L217
+bne L344
+L139: red *r5
+bne *r2
+L140: .string "ypvplwladq"
+L141: .data -70, -126
+prn L305
+L142: not r3
+red L283
+L143: jsr *r2
+L144: .string "xgxhytxx"
+L145: clr r5
+L146: inc L210
+stop
+L147: .data 682, 481, 359, 502, 76, 56, 617, 637
+L148: cmp L317, #197
+
+L149: .data -219, 304
+L150: clr *r4
+lea L305, *r0
+stop
+sub *r2, *r6
+jsr *r2
+stop
+prn #111
+
+red L270
+clr *r1
+bne L195
+add L222, L351
+jsr *r2
+inc L232
+add L292, r5
+sub L293, r3
+jmp L193
+L151: add r0, *r0
+cmp *r3, r3
+L152: cmp #-148, r4
+
+L153: add *r4, r1
+add *r3, L271
+L154: stop
+add *r7, *r3
+sub #61, *r2
+L155: sub L241, r3
+
+prn L173
+L156: rts
+L157: .string "traqcjvxpi"
+mov #-19, *r0
+L158: mov #-144, L259
+L159: dec L285
+
+inc *r1
+prn L207
+clr *r0
+lea L306, r0
+add #154, L230
+stop
+cmp L165, *r1
+stop
+stop
+inc r1
+sub #209, L251
+L160: stop
+lea L265, *r3
+inc *r0
+stop
+L161: clr r5
+L162: .string "xlvqpkiyqwzhc"
+L163: not *r7
+L164: .data -965, -337
+L165: not r7
+cmp #219, #36
+cmp *r6, *r6
+add #-223, r7
+L166: dec *r5
+dec L174
+stop
+cmp L215, *r2
+L167: dec *r6
+bne *r0
+L168: .string "ziaprxhdcm"
+L169: stop
+prn L294
+bne L279
+
+jsr L243
+prn *r4
+L170: mov L297, *r2
+L171: cmp #12, #226
+L172: mov L229, r1
+L173: cmp L194, #-135
+L174: clr *r7
+L175: rts
+red L308
+L176: red L313
+L177: .string "vw"
+stop
+; comment
+cmp L225, #-174
+
+jsr *r7
+clr r4
+rts
+inc r2
+add *r1, *r6
+stop
+
+mov *r4, *r7
+L178: red r1
+bne L210
+
+dec r1
+inc L354
+bne L209
+not L291
+L179: prn L329
+prn L299
+add L328, L286
+L180: .data 118, -121, -152
+cmp #12, #163
+L181: inc r2
+L182: .data -108, -606
+L183: .data -656, 606, -478, 270
+jmp L197
+L184: cmp #-232, #166
+L185: cmp *r3, *r3
+clr *r0
+L186: red r7
+L187: jmp L286
+stop
+rts
+L188: rts
+stop
+red r5
+not L359
+L189: .data -785, 869
+mov r7, r3
+add #77, r5
+prn #-106
+jsr L273
+L190: not *r6
+L191: jmp *r6
+dec L194
+prn r4
+L192: inc L294
+sub *r2, *r3
+mov #-56, *r7
+L193: stop
+L194: red *r6
+inc L255
+jsr L203
+L195: .data -740, 655, -312, -874, 824, 870, 973
+L196: dec L303
+inc r1
+rts
+dec r7
+red r7
+L197: .string "xdjcalfhmnirox"
+L198: rts
+
+mov L318, L353
+lea L209, r3
+
+inc r7
+L199: cmp r2, #244
+stop
+
+L200: rts
+L201: prn #-1
+L202: cmp L204, r7
+jmp L295
+
+L203: .string "yufbwzucsxlvasluctnkqmde"
+L204: cmp #58, *r2
+not r3
+
+inc L316
+L205: inc r2
+L206: jmp L238
+not L249
+L207: clr r5
+prn r5
+lea L241, r6
+lea L279, L311
+bne L337
+not r1
+add L298, L282
+L208: clr r5
+rts
+L209: clr *r4
+L210: prn r2
+prn L350
+
+sub r4, L253
+L211: prn *r3
+L212: dec r0
+cmp r6, *r4
+mov L340, r0
+; comment
+not L356
+L213: not L282
+rts
+L214: .data 216, -962, -114, 729, -328, 52, 768, 754
+L215: add r5, L237
+L216: cmp L335, r4
+dec *r0
+red r4
+jsr L303
+cmp #-150, r3
+L217: bne L307
+not L346
+mov #30, L236
+L218: .string "f"
+L219: red L338
+inc L233
+L220: red L329
+L221: .string "gchudusammbqmnnbtoellty"
+lea L260, L334
+lea L296, *r3
+L222: jmp *r1
+L223: mov L277, *r3
+mov L317, L296
+jsr *r0
+bne L346
+L224: .string "mrrmfp"
+L225: .string "ocsblwac"
+add *r0, *r2
+cmp L226, L323
+cmp #10, #-1
+bne L358
+L226: .string "uoghewahztqpevklyxxcfnl"
+cmp *r3, #131
+red L315
+bne L321
+dec L290
+mov *r0, r0
+red *r3
+L227: add r0, *r1
+L228: lea L362, *r4
+L229: stop
+bne *r2
+bne L326
+L230: red r5
+L231: dec r2
+sub r0, r7
+L232: clr *r3
+L233: mov L249, L356
+mov L359, r1
+jsr L354
+mov L254, *r2
+bne L345
+L234: prn *r1
+L235: jsr L361
+prn #170
+L236: .data -737, -593, 193
+inc r4
+not *r2
+L237: cmp L326, *r6
+sub #155, L291
+L238: stop
+jsr *r0
+L239: .data -896
+clr r7
+L240: .string "iurimtrr"
+jsr L247
+dec r7
+L241: .string "esidspoonlfqgzfgesigs"
+add L246, r3
+dec *r7
+L242: bne L302
+L243: not *r3
+L244: .string "dlfgkeovbl"
+prn *r6
+L245: cmp #9, #-67
+jsr L359
+rts
+not r3
+red r5
+L246: .data 930, 491
+dec *r3
+add L341, L310
+clr r3
+L247: sub *r7, r1
+dec L267
+jsr L306
+clr *r2
+add *r0, *r6
+L248: .data -834, -413, -565, -495
+L249: .data 408
+L250: not r2
+cmp r5, r4
+inc L273
+L251: .string "qyxqngbzwasoriujumye"
+inc *r1
+L252: rts
+L253: bne L353
+stop
+not r2
+L254: clr r5
+inc L267
+
+rts
+not *r0
+prn L302
+lea L270, *r7
+L255: .string "ecbjcqebxtzilnb"
+clr L272
+L256: bne *r4
+sub r1, *r0
+L257: rts
+dec r3
+; comment
+
+inc r4
+red L268
+L258: cmp L344, L304
+lea L351, *r1
+red *r2
+red r5
+rts
+stop
+L259: lea L265, r1
+L260: jsr *r1
+; comment
+; comment
+L261: red *r0
+clr L294
+lea L273, *r4
+jsr L329
+stop
+; comment
+stop
+
+red L353
+L262: clr r3
+red r2
+jmp L288
+L263: not r1
+L264: red L357
+prn *r4
+L265: prn r3
+jsr L291
+bne L320
+inc L290
+lea L287, r7
+jsr L344
+lea L337, L362
+rts
+L266: clr L359
+L267: not L314
+stop
+jmp *r3
+L268: mov L282, L359
+dec *r5
+sub #-88, r7
+not r5
+L269: stop
+jsr L279
+inc L315
+L270: jsr *r0
+stop
+L271: .data 434, 872, -382, -68
+jsr L274
+L272: clr L315
+L273: .data 880, 352, -764, -90
+rts
+clr L293
+L274: prn L329
+L275: jmp L281
+
+L276: .data 908
+rts
+L277: not *r6
+L278: lea L339, r2
+L279: bne L291
+L280: cmp *r4, L303
+inc r7
+L281: red r7
+L282: inc r1
+L283: .string "nllyhsbfpsrirfxpqnek"
+L284: stop
+L285: .string "vgrlsjgbmwxhyhxht"
+inc L296
+lea L323, *r1
+L286: .string "asudmrnrmigycbnu"
+L287: dec *r2
+L288: red L293
+L289: sub *r5, r1
+bne *r5
+L290: rts
+prn r0
+
+stop
+red *r2
+L291: .data -969, -643, -969, -956, 200, 642
+mov #-233, *r7
+L292: bne L325
+L293: .string "qvloz"
+dec r0
+jmp L336
+bne L345
+inc L351
+cmp #88, r5
+L294: prn L309
+L295: dec L328
+inc L296
+prn #14
+
+stop
+clr L320
+L296: .data 274, -498, 422, -421, 17, 559, 425
+jmp *r0
+sub #-116, L336
+
+add L302, L338
+rts
+sub *r4, L325
+L297: .string "go"
+L298: add r3, r3
+stop
+L299: .data -10, 38
+L300: cmp *r1, r7
+prn #18
+mov #27, L311
+clr *r6
+rts
+L301: not L336
+lea L306, *r3
+add *r0, *r1
+L302: .string "rayhkjzjlkspkjsmzcgtiw"
+prn L309
+clr *r3
+inc r0
+L303: .string "vftbrvuhsueerbtggduthk"
+stop
+add *r4, r6
+L304: .data 777
+clr *r5
+L305: stop
+L306: inc *r3
+L307: .data -138, 604, 866
+bne *r3
+
+stop
+clr *r2
+L308: stop
+L309: mov *r2, *r6
+mov L326, L339
+stop
+add #167, *r4
+L310: inc L329
+L311: add L337, L314
+jsr *r6
+L312: bne *r4
+bne L345
+L313: .string "krjnmyhxvtlfqcaztu"
+L314: jsr L332
+jmp L337
+L315: jmp *r2
+L316: stop
+dec *r7
+L317: prn #70
+jmp L339
+L318: .data 579, 390
+not L332
+red r4
+L319: jsr *r1
+add r5, r7
+; comment
+L320: mov r2, L340
+clr r5
+clr *r4
+L321: inc *r5
+L322: .data -715, -580, -171, 654, -519, -330
+dec r6
+sub #-74, *r2
+L323: prn #37
+L324: inc *r4
+L325: .data -350, 929, 889, 506, -577, 735, 850
+; comment
+L326: add #-34, r7
+add L332, L333
+L327: stop
+L328: cmp L350, L360
+stop
+L329: .data 304, -786, 985, 673, -483
+L330: add #-211, L334
+L331: jmp L346
+L332: not *r3
+
+bne *r0
+add *r7, r3
+prn *r1
+stop
+inc r7
+L333: lea L362, L344
+L334: bne *r3
+sub *r6, L341
+red r5
+L335: .string "rcloitskzixvpjnjsfkz"
+L336: .data -819, -621, 446, 423, 754, -240
+add #168, *r0
+clr r5
+jmp *r3
+bne L363
+prn *r5
+red L339
+clr L363
+dec r1
+L337: .data 472, -506, 155, -126, -176, -316, 361
+mov #-123, *r5
+L338: .string "ltlnmbfythr"
+not L357
+rts
+stop
+stop
+red L353
+clr r7
+rts
+clr *r2
+L339: .data -891, 942, -156, -184, -958, 719
+L340: rts
+L341: inc L350
+lea L351, r7
+sub L342, r0
+lea L352, *r5
+stop
+dec *r3
+jsr *r2
+L342: rts
+L343: inc *r3
+L344: prn r1
+L345: lea L359, r0
+L346: sub #-211, r0
+bne L354
+L347: clr L358
+L348: .string "srqvuimzersqtsgsqmeehkwy"
+L349: lea L353, r4
+sub *r6, *r5
+mov r6, *r6
+L350: clr *r6
+L351: .string "hekhmpidcdvdgclksjt"
+rts
+inc *r5
+not L359
+L352: not *r1
+L353: jsr *r0
+inc r6
+L354: red L359
+mov *r3, *r0
+L355: red *r2
+L356: sub #225, *r7
+inc r4
+not *r6
+stop
+bne *r2
+rts
+L357: prn *r5
+not *r0
+; comment
+bne L362
+inc *r3
+sub r2, r6
+
+prn r1
+stop
+L358: clr *r5
+jsr L359
+L359: .data 24, -653, 228, 753, -652
+L360: .string "yhnnedgmem"
+stop
+rts
+lea L363, r0
+lea L363, r6
+mov *r7, L362
+; comment
+sub r4, L361
+L361: jmp *r5
+L362: .data -70, 211
+stop
+L363: sub *r2, *r0
+lea L298, *r1
+prn r0
+add #-246, L208
+; comment
+stop
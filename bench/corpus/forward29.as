@@ -0,0 +1,1023 @@
+; Generated by genCorpus --seed 30
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+
+cmp r3, #-227
+jsr L22
+L0: .string "fiqmxozyxlwwpjxyslfpjhea"
+add #-105, L188
+L1: mov #-121, *r3
+lea L234, r2
+inc *r7
+red *r1
+L2: jsr L25
+jsr *r3
+L3: add *r3, r0
+prn L60
+red *r1
+; comment
+L4: mov #-19, *r2
+clr *r1
+clr r5
+L5: jsr L236
+dec *r0
+dec *r3
+bne L139
+red *r4
+rts
+lea L261, *r6
+stop
+rts
+stop
+L6: jsr L61
+add r5, L26
+jsr L181
+lea L200, *r5
+L7: red *r2
+dec *r2
+rts
+not L87
+inc L161
+inc r7
+L8: sub #217, L106
+jmp *r7
+red *r3
+L9: .data 965, -787, -983, -621
+dec r7
+lea L71, r5
+add *r2, L180
+bne *r7
+jmp L172
+cmp *r0, #68
+prn r5
+L10: .string "tvpnlzznfpxmu"
+bne L128
+cmp #-230, *r3
+L11: bne *r1
+add #135, L36
+prn L64
+L12: prn r5
+inc *r3
+jmp *r1
+clr r6
+L13: not L178
+L14: add #-130, r4
+L15: sub #-128, *r0
+L16: mov #-25, L286
+prn L133
+jsr *r5
+not r6
+rts
+clr r0
+L17: .string "ymrzaiav"
+
+stop
+red r2
+jsr L72
+mov #54, r4
+not L294
+L18: clr *r1
+; comment
+jsr *r5
+bne L44
+mov r3, *r2
+add #-158, *r2
+L19: jsr *r0
+L20: sub L192, r5
+L21: .string "oahtbtfshoxdxskzgkpx"
+L22: lea L171, r1
+inc L115
+dec *r3
+L23: .string "j"
+jmp L285
+jsr *r3
+L24: rts
+L25: bne L257
+jsr *r5
+clr L210
+jsr *r1
+not *r0
+cmp r7, *r4
+L26: lea L134, L319
+jsr L62
+red L65
+mov r1, *r7
+red *r6
+inc r3
+lea L66, *r1
+prn *r0
+clr r3
+L27: not L284
+L28: jsr L40
+L29: inc *r7
+L30: dec *r3
+rts
+cmp r3, *r4
+L31: inc L150
+cmp r1, r2
+L32: not L127
+L33: .string "hnfjumcindzf"
+cmp #75, *r1
+L34: lea L204, *r2
+L35: stop
+L36: rts
+stop
+cmp r3, L288
+L37: stop
+L38: jmp *r4
+cmp r7, r6
+L39: not L190
+L40: jsr *r7
+add L134, r2
+L41: mov L115, L125
+lea L264, *r5
+red *r1
+L42: .data -120, -697, -57, -481
+L43: red r2
+L44: mov #-7, *r3
+L45: .string "qjutfgszhlxkk"
+L46: .data -425, 166, -133, -979
+clr r7
+rts
+prn r0
+L47: inc *r4
+not *r5
+L48: red L97
+rts
+not r1
+cmp r0, r4
+; comment
+L49: .string "fndvzzvldyxodlgrkmr"
+mov #33, *r7
+L50: jsr *r4
+jsr *r3
+mov #237, L88
+mov #206, *r0
+jsr L300
+add #-205, r6
+sub L83, *r2
+L51: red *r7
+L52: dec L294
+mov #47, L266
+
+bne L143
+clr *r6
+L53: .data -409
+L54: mov L132, r1
+bne L72
+lea L95, *r6
+lea L168, L288
+L55: not *r2
+add #71, r1
+cmp r3, #-7
+L56: rts
+L57: jmp *r6
+bne L138
+prn #210
+mov L313, *r6
+jsr L282
+L58: not *r1
+L59: .string "xqimfpnnamixspqvczsgd"
+L60: red L144
+L61: prn *r5
+sub r0, *r6
+rts
+add #250, *r2
+rts
+lea L251, *r5
+; comment
+rts
+prn r0
+cmp L203, #-61
+add r7, r3
+; comment
+jsr L284
+jsr *r1
+L62: rts
+inc r6
+L63: not *r6
+
+rts
+cmp L160, #-129
+L64: rts
+rts
+bne *r2
+L65: cmp *r3, L253
+prn #130
+L66: .string "zqtuz"
+red *r7
+rts
+L67: cmp #110, #252
+stop
+inc r6
+stop
+clr r5
+L68: lea L143, L306
+L69: clr L180
+dec L89
+L70: rts
+L71: .data -742, -311, -330
+L72: .string "kkgzkbkxsgjseamcik"
+add #-45, L148
+sub #-35, r1
+stop
+rts
+L73: jsr *r6
+L74: .data 552, -894, 413, 216, -592, -364
+rts
+L75: not r6
+lea L309, L306
+L76: cmp r5, r5
+L77: .string "udfarlcmvgrsrigqho"
+L78: not *r1
+L79: rts
+stop
+mov #114, L135
+L80: cmp #-199, r1
+L81: cmp L84, r2
+red *r7
+bne L284
+add r5, L178
+not *r2
+
+add L115, r4
+inc L193
+inc r2
+cmp L149, L176
+red L274
+L82: clr *r3
+rts
+not r3
+jsr L269
+L83: .string "pbmqqxjrwz"
+inc r3
+jsr *r4
+prn r0
+L84: not L213
+not L216
+L85: mov #44, *r2
+inc *r2
+mov #114, r5
+stop
+jsr L183
+L86: stop
+L87: prn *r5
+L88: jsr L216
+not L163
+stop
+L89: clr *r6
+prn *r0
+jsr *r7
+dec L305
+jmp L109
+bne *r0
+jsr *r4
+L90: dec r6
+jmp L229
+inc r6
+L91: dec *r6
+lea L118, r2
+L92: clr L254
+bne *r0
+stop
+L93: .data 327, 707, 411, -843, -248, 22
+dec *r4
+cmp #-134, r4
+stop
+cmp L244, #-244
+L94: .data -458, -771, 750, 446
+sub r5, *r4
+L95: .data -675, -131, 279, -909, 385, 418, -696, -340
+clr L239
+rts
+rts
+jsr L108
+
+L96: add #-164, *r1
+rts
+L97: stop
+sub L199, *r5
+not r6
+red r6
+lea L240, L237
+L98: mov r4, L275
+mov #-174, *r1
+not r6
+sub #-238, r2
+stop
+L99: inc *r4
+add #247, L261
+cmp L220, r4
+clr *r1
+red L108
+add *r7, r3
+cmp *r6, #192
+dec r7
+L100: inc L263
+
+prn #28
+bne L143
+lea L286, r7
+not L128
+inc L104
+L101: .string "patscfipzjydhrb"
+red *r2
+jsr *r2
+L102: .data -865, -638, 587, 53, 543, 225
+L103: inc r1
+add #-219, r4
+L104: rts
+prn *r7
+not L160
+jmp *r2
+dec L312
+stop
+not L158
+stop
+sub *r6, r0
+bne *r7
+add L228, r6
+; comment
+clr *r2
+cmp r4, #84
+cmp L191, #-235
+L105: rts
+cmp #-219, *r0
+dec r0
+jsr *r3
+dec *r5
+L106: jmp L149
+L107: red L285
+bne L165
+inc L147
+rts
+prn #-168
+L108: stop
+jmp L213
+L109: .data 912, 134, 876
+sub L284, r5
+L110: .data 21, -941, -704, 993, -137, -740, -320
+red r3
+jsr *r5
+prn #168
+stop
+jmp *r3
+L111: .string "eosjfibdkslwsbnsz"
+stop
+cmp L249, L150
+L112: bne L298
+sub r6, L238
+L113: bne L317
+inc L183
+L114: sub L246, L137
+rts
+stop
+add *r3, r0
+lea L239, r4
+L115: lea L156, *r3
+add L273, *r3
+prn #-243
+L116: prn *r1
+inc r2
+not L321
+inc L218
+L117: prn L229
+L118: stop
+L119: .data -411, 689, -723, -761, 150, 486, 883, 730
+jmp L202
+not r3
+inc L252
+lea L230, *r5
+jsr L257
+stop
+lea L190, L283
+L120: jsr *r1
+jmp *r2
+add *r4, L126
+jmp L295
+stop
+cmp *r0, *r0
+sub L163, r1
+jsr L167
+L121: bne L191
+red r2
+add #-14, r0
+dec *r3
+rts
+not L290
+L122: stop
+mov r3, r3
+L123: add *r1, r7
+sub #57, L240
+L124: red L172
+add #63, L309
+prn L147
+jmp L244
+L125: stop
+add L269, *r3
+red L270
+add #135, r1
+inc *r4
+L126: .string "bgjbjhtbvhu"
+prn r6
+bne *r1
+add L143, r5
+L127: mov #-76, r0
+rts
+L128: prn *r4
+L129: .string "qukdxgjcovrqfd"
+prn #51
+red r2
+L130: .string "oqj"
+rts
+
+lea L280, *r0
+stop
+; comment
+L131: mov r3, *r7
+clr *r7
+L132: stop
+inc L147
+bne *r3
+L133: dec *r4
+L134: inc r2
+not L257
+L135: .data -949
+cmp r2, *r0
+
+cmp r1, L276
+jsr L263
+sub r7, *r6
+stop
+dec L139
+lea L277, L187
+L136: .data -968, 347, -254, 624, 232, -247
+red *r3
+jsr L286
+L137: rts
+; comment
+; comment
+stop
+; comment
+sub #146, r7
+L138: lea L183, r7
+red *r5
+not *r4
+clr r0
+jmp *r6
+inc *r0
+mov *r2, L148
+L139: .data 739, 546, -107
+rts
+jsr *r1
+L140: .data -89, 843, 263, -687, 614, -324
+add #-99, L289
+
+jsr L310
+sub L222, r4
+red r6
+L141: .string "ycndmezxlvn"
+lea L181, *r4
+sub *r1, L150
+L142: stop
+add #222, r7
+L143: cmp *r4, *r6
+clr r7
+bne *r0
+L144: dec r2
+rts
+lea L227, *r3
+mov L262, L293
+L145: jsr L272
+L146: add *r3, r0
+stop
+L147: rts
+prn #-35
+sub #165, L172
+inc r2
+L148: bne L266
+jmp L311
+lea L209, L220
+L149: lea L151, r3
+lea L154, L300
+L150: .data 918, -206, -973, 643, -440
+red r5
+bne *r4
+red L186
+L151: .data -104, -62, -713, 251, -383, 518
+not L321
+L152: jsr *r5
+sub *r4, L302
+stop
+L153: prn L246
+L154: .string "vgsetqwvrrodwrdxn"
+stop
+dec r5
+
+red r0
+L155: rts
+red L189
+; comment
+L156: dec r7
+L157: .string "drcpevtndiplysvzqsi"
+add r5, *r0
+
+bne *r2
+inc *r6
+lea L182, L235
+L158: stop
+L159: .string "vkeejgjaerxqofnbtbn"
+L160: .string "kkdgpqfvdarjadsyhdhhp"
+L161: .string "tsbkvbejbmr"
+inc r6
+jsr L190
+L162: jmp L229
+add r1, *r4
+bne *r4
+rts
+L163: not L246
+stop
+
+add #-174, *r6
+L164: not *r1
+lea L208, r3
+L165: cmp #98, L228
+L166: rts
+sub r5, *r3
+L167: jmp *r2
+inc *r1
+cmp #214, L262
+not r4
+not L176
+L168: .string "axlqgbpgufwulwietigob"
+L169: .data -586, 899, -182
+L170: rts
+stop
+L171: jmp *r1
+
+L172: .string "whkfe"
+inc r2
+cmp r2, #-195
+jmp *r5
+jsr L320
+L173: jsr *r5
+L174: dec L258
+prn *r5
+sub r5, L298
+lea L254, *r1
+red r5
+L175: stop
+inc r6
+L176: red L311
+stop
+L177: not *r6
+jmp *r6
+L178: .data 0
+L179: .string "kikkhcraponnkhwdbjejpo"
+L180: .string "ieoqajnlv"
+not *r5
+sub *r5, L240
+add L219, L214
+L181: cmp L305, *r6
+inc L186
+sub #-72, r5
+rts
+add r2, *r5
+add r6, L224
+bne L239
+add r4, L297
+sub *r6, *r7
+L182: .string "wnusptd"
+sub #45, *r7
+L183: sub *r7, r1
+jmp *r0
+lea L294, r1
+L184: add *r1, *r6
+
+stop
+L185: mov L276, r0
+L186: clr L281
+prn *r4
+mov #206, L314
+prn L226
+sub r0, *r2
+stop
+not r1
+cmp L242, #-71
+not L238
+L187: mov *r7, *r0
+L188: .string "vdrjvgjrpdutevwqixhtre"
+bne *r2
+L189: .string "nxhxvld"
+sub #111, r4
+L190: rts
+not r0
+rts
+jmp *r0
+lea L215, r0
+L191: lea L227, r0
+inc *r2
+L192: sub L307, L235
+red *r6
+rts
+mov #128, r3
+L193: jsr *r5
+
+L194: .string "uhmluun"
+not r0
+L195: not r6
+L196: add L227, L277
+; comment
+L197: jsr L254
+L198: .data -342, -993, -563, 160, 718, -50, -509, -507
+jsr L230
+mov #165, r2
+red *r4
+lea L242, *r0
+rts
+add #-134, *r6
+jsr L272
+prn *r3
+L199: .string "zpswedjyywhtti"
+L200: cmp r4, #-40
+red *r0
+L201: .data -604, 385, -660, -471, 149
+lea L243, L227
+clr L297
+L202: add r1, *r7
+rts
+L203: add *r2, *r3
+jsr *r7
+dec r5
+; comment
+L204: prn L289
+bne *r2
+prn #-12
+rts
+L205: .data 66, -827, 463, -966, -804, 594, 723
+L206: jsr *r3
+not r2
+rts
+not r3
+inc r7
+add #-69, *r0
+L207: .string "kttfqlstvgrqgbfno"
+jmp L316
+L208: .string "bvyd"
+bne *r0
+jsr L288
+; comment
+L209: inc *r7
+bne L312
+jsr L287
+L210: prn *r2
+clr *r4
+add *r7, *r2
+cmp #208, L301
+
+dec L250
+clr L241
+not L269
+dec r5
+lea L293, *r7
+L211: prn #-170
+jmp L272
+inc L289
+add #-11, r3
+cmp *r6, L222
+clr L247
+jsr *r3
+rts
+L212: not L283
+jmp L269
+L213: .string "cfsnm"
+L214: not r4
+prn r0
+dec r4
+cmp L311, #95
+L215: stop
+not *r1
+bne *r6
+L216: add *r3, L316
+mov #-163, r4
+
+jmp L283
+bne L298
+
+bne *r1
+L217: mov *r7, L232
+L218: .string "vdp"
+L219: .string "zvgxhberptngfnckeqkf"
+prn #108
+L220: .string "zetepfvhytumi"
+L221: add *r3, L233
+bne *r7
+L222: .data 256
+dec L242
+stop
+sub r2, *r3
+cmp L229, *r5
+L223: lea L253, r6
+red *r3
+red L276
+cmp *r3, L312
+inc L261
+prn L275
+mov *r5, *r3
+not r7
+prn L241
+add r3, *r3
+L224: bne L238
+L225: sub L241, *r0
+dec r7
+stop
+L226: prn *r6
+inc L313
+jmp *r0
+L227: .string "shhigdfwjvjuxujfec"
+L228: red L243
+add r0, L241
+mov L229, L300
+stop
+dec r6
+L229: .string "foyeckctjhcxbfghtcomncbn"
+sub *r2, L248
+prn L253
+bne L283
+rts
+add #23, r1
+mov r6, *r3
+L230: stop
+L231: dec L276
+L232: sub *r7, *r2
+rts
+L233: bne L240
+L234: mov L296, L313
+L235: sub L321, L262
+bne *r2
+jsr L268
+stop
+jsr L246
+sub L300, L275
+L236: inc *r6
+L237: not L273
+red L259
+L238: bne *r5
+L239: .data -722, 368, -140, -900
+
+L240: .data -650, 403, -394, 890
+L241: .string "hijl"
+prn *r4
+red r1
+dec *r2
+prn #-221
+not L255
+bne *r7
+L242: bne *r4
+prn r1
+add *r2, r0
+L243: jmp *r1
+clr L310
+; comment
+bne *r6
+dec L261
+add r7, r6
+L244: sub r6, r0
+L245: add *r3, L321
+add r1, *r2
+; comment
+L246: rts
+red *r1
+prn L302
+jsr *r3
+jmp *r7
+L247: .data 640
+L248: clr L296
+lea L280, *r7
+cmp *r6, L265
+prn L295
+clr L295
+L249: add *r4, *r5
+L250: rts
+sub #23, *r6
+L251: jmp *r3
+; comment
+L252: mov *r5, L305
+L253: bne L299
+L254: .data -396, -21, -102, 22, -280, -105, -884
+dec L264
+jmp *r3
+stop
+jmp *r2
+; comment
+sub L257, *r6
+jmp L279
+lea L308, r3
+dec r0
+clr L276
+L255: prn r5
+mov #185, r1
+L256: mov r0, r2
+L257: lea L305, L263
+not r5
+L258: jsr *r5
+stop
+L259: dec *r5
+inc r2
+L260: .data 423, -578, -682, -681, -420, -889, 520
+L261: prn L276
+dec r6
+add r5, *r0
+stop
+L262: dec *r4
+sub *r5, L271
+add L315, L295
+cmp #239, #-122
+not r7
+L263: .data -39
+not r5
+mov *r6, r2
+L264: jsr *r2
+; comment
+jsr L281
+L265: .string "fzrkvzgep"
+L266: inc L280
+prn L287
+dec r7
+cmp r2, #-89
+L267: .data 681, -456, 522, 715, 656, -429
+rts
+not L285
+not r5
+L268: lea L316, L298
+L269: lea L301, r4
+; comment
+rts
+L270: inc L274
+bne L318
+L271: stop
+cmp r4, #178
+cmp r4, #-206
+L272: jmp *r1
+jsr L302
+lea L287, *r6
+L273: add *r7, r4
+L274: rts
+rts
+L275: stop
+add #-89, L298
+inc *r2
+L276: .data -252, -953, -244
+lea L308, *r7
+mov #-114, L307
+L277: mov r2, *r3
+L278: .string "gmzficvncvazdxswzjuwn"
+not *r7
+lea L292, L308
+mov *r4, r1
+not *r5
+L279: jmp *r4
+L280: add #-253, *r5
+dec L300
+not L301
+rts
+L281: dec *r2
+L282: .string "iogntcftosohnwljd"
+lea L299, L306
+L283: add *r1, L294
+L284: red *r4
+cmp *r5, r2
+L285: .data -379, -922, -785
+L286: .string "ijue"
+add r5, *r1
+L287: bne L302
+L288: .string "wyx"
+not L311
+not L318
+L289: dec r3
+stop
+rts
+L290: bne L292
+cmp r7, L307
+clr r5
+add L302, *r3
+inc L315
+; comment
+mov L309, *r3
+mov r2, L291
+mov L320, L311
+L291: clr r2
+rts
+add #-193, r0
+L292: .string "ujpgypfxaxjwq"
+stop
+L293: cmp #-92, #15
+
+rts
+add *r4, L303
+
+; comment
+sub L304, r5
+L294: .string "cllbknjquqrrvvcmp"
+red r7
+L295: dec *r1
+cmp L296, r7
+prn *r4
+add #255, *r1
+L296: .string "aljsjj"
+bne L310
+dec L300
+dec *r4
+sub *r7, r0
+red r1
+inc L315
+bne L319
+add #-130, *r3
+cmp #-90, L314
+cmp L321, *r3
+red *r0
+L297: stop
+dec *r0
+L298: cmp #-89, #-221
+L299: red *r6
+red *r3
+not r5
+not r1
+rts
+L300: inc L311
+L301: jmp L320
+L302: jsr L304
+bne L317
+; comment
+L303: add r1, r7
+stop
+add r0, *r0
+L304: not L314
+cmp L310, r5
+stop
+clr r2
+L305: rts
+rts
+L306: sub *r2, *r0
+L307: clr *r1
+L308: .data 730, 880, 710, 465, -930, 187, 665, 825
+rts
+L309: dec *r3
+
+not r2
+rts
+clr *r3
+L310: .string "xntkzqtnowei"
+jmp *r2
+
+L311: .string "yqughgshlywmwbuqlggtscl"
+L312: cmp L314, #100
+; comment
+L313: rts
+rts
+inc L315
+jmp L317
+dec r3
+L314: lea L319, r0
+prn L319
+; comment
+L315: .string "dzylmnwtdpmewu"
+bne *r3
+stop
+L316: jmp *r5
+prn L320
+jmp L320
+stop
+L317: dec *r5
+mov #21, L321
+stop
+L318: jmp *r7
+; comment
+add r7, L320
+add r1, r1
+add *r4, L319
+L319: .string "zzqsnzmlnpcdmvchrniun"
+clr L321
+L320: bne L321
+rts
+L321: bne L131
+stop
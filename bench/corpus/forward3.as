@@ -0,0 +1,1027 @@
+; Generated by genCorpus --seed 4
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+L0: add *r7, L202
+L1: bne L287
+L2: .string "prb"
+L3: jsr *r7
+red r1
+L4: .data -936, -569, -790
+not r1
+L5: cmp *r1, r6
+not *r2
+mov #108, L247
+dec r3
+not r4
+clr L320
+mov #-163, *r4
+jsr L64
+jsr *r2
+mov *r6, *r1
+mov #-100, L85
+L6: .data -46, -706, -608, -510, 613, 322
+prn L26
+prn *r7
+inc *r7
+prn #-171
+cmp L303, *r2
+L7: lea L357, *r7
+L8: .string "oqjphtpugz"
+stop
+red r4
+lea L27, *r3
+prn L202
+bne *r2
+add L108, *r7
+L9: prn L168
+L10: .data 645
+L11: jmp *r2
+L12: .data 308, 330, -568, 346, -252, -946, -831, 878
+; comment
+L13: .string "kubgxiuwzsjvrrmrrrktt"
+rts
+L14: lea L125, r5
+cmp L171, #89
+L15: stop
+; comment
+add #207, *r6
+L16: mov L159, r4
+add r5, *r4
+clr r2
+L17: mov r7, r1
+jsr *r0
+jsr L378
+clr L82
+jmp *r1
+prn r4
+jsr L57
+lea L298, r3
+L18: jsr L179
+jmp *r0
+mov r2, L109
+rts
+sub *r3, r0
+jmp L334
+bne *r7
+L19: .string "y"
+jsr L204
+L20: jsr L38
+L21: .data 490, 509, -842
+inc *r5
+dec *r5
+L22: .string "lqbl"
+jmp L83
+prn r6
+stop
+stop
+stop
+L23: add L306, *r1
+L24: jsr *r7
+clr *r5
+add *r3, L271
+sub L292, L138
+L25: .data 834, 31
+cmp r1, r7
+add *r1, r7
+; comment
+L26: .data -47, 244
+add r5, r2
+
+L27: inc *r3
+L28: prn r7
+inc *r3
+add *r3, *r0
+mov *r5, *r3
+L29: jsr L143
+L30: prn L66
+L31: .data 769
+
+L32: red *r1
+not *r5
+L33: .data 401, -654, 616, -894, 752, -554, -390, 488
+lea L276, *r4
+stop
+
+cmp #-121, *r4
+prn *r4
+L34: not r5
+L35: .data -162, 165, -906, 606, -288, -69
+bne L147
+L36: not *r4
+sub r1, L370
+; comment
+L37: bne L313
+L38: red *r5
+prn r5
+dec r1
+dec L344
+rts
+mov r6, *r6
+jmp *r3
+not L133
+prn L314
+jmp L119
+L39: mov r5, L41
+; comment
+add #181, *r6
+L40: .string "ryehqccpcprgpe"
+mov r4, L271
+L41: bne *r1
+jsr *r0
+L42: cmp r4, *r4
+L43: lea L329, L87
+L44: stop
+L45: bne L139
+lea L333, L159
+L46: sub *r6, r7
+inc r5
+L47: red r5
+jmp *r5
+lea L311, r1
+; comment
+prn r3
+sub L324, r6
+sub L118, L85
+L48: not r2
+mov r5, r0
+L49: .string "dmwaipyksjvjnzs"
+prn #255
+not r4
+red r5
+cmp *r0, L358
+L50: lea L381, r1
+L51: sub #-135, L187
+cmp *r7, L177
+inc L181
+L52: lea L101, r5
+L53: bne *r3
+lea L131, *r6
+L54: prn #159
+mov #174, r5
+L55: add *r0, L146
+L56: mov #-198, L257
+dec r3
+stop
+L57: prn r2
+L58: .data 480
+add *r4, *r7
+inc L76
+L59: add L316, L358
+L60: bne *r3
+cmp *r1, L185
+
+L61: .string "oqsvqrpnaaweepnxdhgbx"
+clr r3
+L62: .string "vsgsnfzrd"
+bne *r1
+L63: bne L231
+dec *r2
+add L351, r6
+L64: .data 294, 333, -670, 674, -812, -975
+rts
+prn *r1
+stop
+L65: bne L216
+L66: lea L349, *r5
+rts
+L67: prn r3
+inc L135
+L68: .data -499, -283, -266
+L69: .string "gzkhxhdtmodzfe"
+L70: .data -72, -413, -195, -329, -513, -421, 977
+sub #46, r2
+dec *r4
+sub L380, *r1
+cmp L260, L247
+mov L192, *r2
+prn r4
+L71: prn r1
+not r6
+L72: dec r1
+L73: .data -570, 937, 228, 235, 817, -375, -429, 848
+jmp L294
+jmp *r6
+cmp L212, #-225
+lea L350, *r3
+prn #-231
+
+inc L200
+jsr L344
+L74: .string "clcnzyfuqnlfl"
+sub #-62, *r5
+mov r4, r7
+rts
+inc L321
+L75: not L363
+jmp *r3
+cmp r0, #64
+; comment
+jmp *r7
+lea L323, L294
+L76: mov r6, r2
+L77: .string "xktpydlxugovbc"
+stop
+L78: .data 324, 382, 370, -67, 723
+inc *r7
+bne *r5
+jmp L331
+L79: bne *r6
+L80: sub #152, *r1
+mov r2, L102
+L81: dec *r4
+L82: not r6
+not L265
+not r7
+bne *r1
+stop
+L83: .string "mdmkyqfljpokvznlmsrc"
+bne *r3
+L84: jmp L95
+L85: cmp *r0, #251
+prn *r0
+
+dec L351
+bne *r3
+not r4
+L86: stop
+L87: rts
+jmp *r1
+L88: dec L139
+L89: .string "htgkuyxwkyivsyyfguujjxw"
+L90: prn L134
+L91: lea L111, L226
+add L353, r2
+stop
+L92: .data 138, 779
+L93: add L370, *r5
+L94: prn #-190
+L95: red *r3
+rts
+L96: inc *r7
+L97: .string "hybkacsqfqcayetfnfdgzmii"
+L98: jsr *r0
+not r4
+bne *r4
+not *r6
+red r2
+; comment
+cmp #209, L220
+stop
+rts
+L99: jsr L262
+cmp r0, L234
+rts
+L100: red *r0
+clr r1
+L101: prn *r0
+cmp r2, L111
+L102: rts
+inc L316
+not *r0
+not L228
+sub r3, L194
+; comment
+L103: sub *r2, *r0
+rts
+L104: cmp #-108, r2
+red *r0
+L105: jmp *r1
+bne *r3
+L106: .data -227, 132, -536, 12, -786, -310, 497, -108
+rts
+bne L154
+L107: .string "cgadyzidchtjh"
+inc *r0
+jmp L331
+L108: cmp #197, L334
+cmp r7, #-231
+sub L204, L266
+L109: lea L313, *r0
+L110: clr L129
+L111: .string "hskvcgeykbwhojottqhorwuc"
+L112: rts
+stop
+L113: cmp *r3, L360
+L114: stop
+add L226, L140
+rts
+bne *r0
+; comment
+jmp L176
+sub *r7, r5
+stop
+not r7
+L115: .data -131
+L116: stop
+L117: .string "kgrphzukuooektlynorom"
+cmp *r2, L311
+L118: lea L299, *r5
+inc *r6
+red L343
+L119: rts
+jmp L191
+L120: stop
+lea L146, L347
+red *r3
+L121: jsr L135
+L122: prn #58
+L123: not L142
+add *r4, *r0
+jmp L206
+dec L194
+L124: jsr L266
+bne *r6
+L125: jmp *r5
+red *r1
+dec L345
+L126: .string "mgllktqe"
+L127: .data -116, 551, 566, -193, 567
+L128: .data 157, 360, 887, 590, 539, -666, -209, -632
+lea L278, *r2
+inc L308
+add *r3, *r6
+red *r5
+clr r4
+L129: inc r5
+L130: stop
+L131: .data -217, 566, 191, -381, -416
+lea L386, *r2
+; comment
+mov L282, *r2
+cmp r7, #155
+L132: cmp #-174, L299
+not L157
+sub L272, *r6
+L133: clr *r7
+clr r2
+not L339
+jsr L343
+L134: inc L337
+bne L161
+L135: .data -430, 480
+L136: jmp *r6
+lea L213, r5
+jsr L202
+inc *r2
+rts
+L137: prn L263
+L138: prn r1
+L139: red L278
+jsr *r5
+prn *r5
+rts
+L140: prn *r0
+L141: red *r7
+cmp L335, #252
+L142: rts
+cmp *r7, *r5
+prn L312
+clr L327
+lea L263, r1
+L143: lea L261, r2
+sub *r0, L376
+jsr L357
+clr L193
+L144: .string "bpcmg"
+stop
+stop
+L145: red L181
+; comment
+lea L312, L301
+L146: bne L330
+cmp r5, L277
+L147: sub r1, L346
+bne L173
+sub #-29, *r3
+L148: .data 707
+L149: add L224, r2
+prn *r7
+inc *r4
+lea L245, *r5
+inc L192
+cmp *r2, #-54
+L150: .data 503, -576, -79, 215
+lea L325, L186
+mov #-150, r4
+prn *r5
+L151: cmp r2, r2
+L152: jsr L237
+rts
+L153: jsr L181
+; comment
+jmp *r7
+L154: lea L355, L207
+clr r6
+L155: stop
+dec r4
+
+L156: red L382
+cmp *r3, *r4
+inc *r5
+clr *r1
+lea L203, L355
+mov #-12, *r1
+red L335
+L157: .data -89, 304
+jsr L361
+L158: cmp r1, *r6
+stop
+red r3
+rts
+dec *r5
+prn L159
+sub *r5, *r7
+L159: jsr L343
+cmp *r1, *r7
+lea L204, L295
+L160: .data -425, 951, 909, -17, -123, -281
+L161: rts
+L162: mov #-194, *r6
+prn L207
+jsr *r2
+L163: .data -147, 534, 74, -379
+; comment
+L164: mov *r0, r0
+inc L304
+L165: sub L359, L231
+inc L351
+add #70, *r6
+jmp L341
+cmp L356, r5
+lea L217, *r3
+L166: rts
+lea L227, L337
+not L275
+jsr *r6
+L167: prn L193
+jsr *r3
+lea L192, L229
+rts
+L168: inc r3
+rts
+L169: add L242, r0
+jsr *r5
+
+L170: jsr L289
+L171: bne L252
+L172: .data -527, -213, -271, 370
+
+L173: stop
+L174: rts
+prn L353
+jmp *r3
+L175: .data -862, 181
+jsr *r2
+L176: red r1
+inc r0
+L177: .data 127, 412, -227, 744
+L178: lea L255, *r6
+L179: add L190, *r0
+prn L280
+L180: bne L283
+inc *r7
+red r2
+red r0
+L181: cmp L208, #-55
+dec L265
+cmp r7, L271
+L182: prn #111
+; comment
+clr L298
+prn L335
+not r5
+bne *r1
+clr r7
+add #-201, L183
+L183: mov #-251, r7
+; comment
+stop
+dec *r7
+rts
+rts
+jsr *r1
+add L335, L238
+L184: .string "ohma"
+L185: inc *r3
+cmp #-250, *r6
+sub r5, L354
+add r5, r1
+L186: mov #135, *r1
+L187: .data -564, 264, 188, -149, 283, -964, -557, -268
+L188: bne L328
+cmp #-94, *r5
+L189: jmp L380
+L190: stop
+L191: dec *r6
+sub L201, L333
+L192: cmp #178, L370
+lea L327, L218
+L193: .string "dkwsqfaaavvpgzidjxaqmgd"
+not L203
+L194: rts
+L195: .string "pyiayzvacbdsbmroddds"
+stop
+rts
+; comment
+L196: lea L305, *r4
+dec *r5
+L197: jmp *r6
+L198: lea L257, r6
+L199: rts
+sub L288, r6
+bne L382
+; comment
+L200: clr *r2
+L201: dec *r2
+prn r7
+stop
+L202: red r1
+red *r4
+L203: clr *r1
+clr r2
+jsr L313
+L204: jmp *r7
+stop
+L205: sub #-239, *r5
+red *r4
+mov L214, r2
+bne *r1
+L206: .string "fhurnemgbnpuvkywstko"
+; comment
+L207: .data 500, -44, 519, -9, 115, -861, -560, -920
+jmp *r7
+jmp *r2
+L208: cmp #53, L306
+bne L381
+mov r5, L309
+red L235
+L209: clr L265
+red L317
+red L212
+stop
+bne *r0
+L210: inc r3
+sub r5, L254
+lea L235, L367
+stop
+L211: red L270
+L212: inc L308
+not r4
+L213: dec r1
+L214: clr r3
+sub L280, *r6
+bne L340
+L215: prn #-236
+cmp L313, r5
+L216: bne *r1
+cmp L322, #-20
+L217: .data 378, -512, 486
+mov L318, r6
+dec *r4
+L218: .data 186, -220, 972, 927, -536
+L219: add L289, r7
+L220: .string "fweil"
+L221: .data 643, -583, 495, -743, -936, 888, 974, 897
+inc *r2
+L222: dec *r5
+cmp #-121, *r7
+L223: lea L347, *r1
+L224: .string "dyaeuszoduswojvbgjvrszx"
+jmp L237
+L225: clr L246
+mov #-121, *r3
+; comment
+jmp L365
+inc L306
+not *r0
+L226: .string "vpradu"
+L227: dec r3
+dec *r0
+prn L288
+jsr *r5
+L228: red *r7
+L229: clr r4
+L230: jsr L315
+jsr *r0
+stop
+L231: mov #-245, L277
+add r3, L343
+stop
+cmp *r6, L378
+red L369
+L232: prn r6
+sub *r2, L384
+rts
+jsr L373
+L233: cmp r4, r7
+cmp r0, L249
+L234: .data -822, 323, 947
+L235: .string "grrvdxpjreymgsaqyjtoildg"
+L236: .string "omwh"
+L237: prn r6
+red L264
+dec r1
+jmp *r2
+add L262, r7
+jmp L272
+dec L297
+mov #-61, r7
+mov *r1, r1
+add L258, L251
+L238: inc L373
+jmp *r3
+inc r1
+
+sub #-135, L249
+; comment
+
+mov #-73, *r7
+prn #-111
+jmp L358
+mov *r1, *r2
+stop
+L239: cmp r7, r6
+dec L271
+L240: bne *r0
+L241: lea L254, r1
+L242: .data 543, 356
+mov L267, L278
+rts
+jsr *r5
+inc *r0
+L243: inc *r2
+jmp L327
+add r7, L256
+L244: prn #-66
+red L350
+L245: rts
+cmp L277, L300
+red L277
+L246: rts
+stop
+; comment
+cmp *r4, #-100
+inc r4
+not L371
+stop
+rts
+jsr L328
+jsr L254
+L247: .data -529, 486, -405, 102
+L248: clr *r3
+L249: inc r4
+
+; comment
+L250: .string "udxtuclyykccvvyldwxkkzsh"
+not r5
+L251: clr L292
+add #25, L284
+jmp L284
+prn #65
+cmp L339, #245
+L252: .string "rviospexihvqawwblbdcvr"
+jsr L337
+clr L278
+sub #185, r1
+L253: clr L380
+not *r7
+red L369
+cmp *r2, L358
+
+L254: clr L300
+L255: inc L326
+L256: jmp *r2
+; comment
+mov r1, L333
+L257: .string "svietknesi"
+L258: lea L284, r7
+L259: .data 480
+clr r0
+jsr *r1
+L260: cmp r0, #60
+L261: dec r1
+sub #-45, L355
+jmp *r0
+lea L343, L361
+bne L318
+L262: bne L292
+L263: .string "kqmb"
+prn L308
+L264: clr L303
+L265: dec r6
+clr *r5
+jmp L365
+L266: jsr *r6
+sub #-191, r4
+L267: red *r4
+L268: not r7
+red L282
+L269: lea L336, L366
+stop
+sub L330, r3
+
+; comment
+bne *r0
+mov r0, *r7
+L270: cmp L308, #-211
+not r2
+cmp #68, *r0
+L271: lea L309, L327
+L272: inc *r4
+L273: rts
+bne L330
+L274: sub r3, L382
+L275: sub L330, L305
+dec r7
+L276: red r2
+L277: .string "dbg"
+add r6, *r1
+
+bne *r1
+; comment
+L278: .string "qoodhaztfhzlxrfw"
+L279: stop
+L280: lea L327, L315
+cmp L295, #-234
+
+dec r0
+jmp *r6
+L281: cmp r2, #-167
+jmp L311
+L282: cmp #56, L319
+dec L367
+prn r3
+bne L373
+jmp L383
+not r7
+L283: .data 950, 214, -854, 791, -129, -187
+L284: .string "aotdi"
+prn r4
+rts
+L285: .data 145, 60, 155, 71, 12, -933, -178, -875
+sub r3, *r2
+L286: mov L313, r7
+L287: jmp L303
+L288: lea L303, *r4
+jmp L301
+L289: .string "svwcqzic"
+L290: stop
+L291: stop
+
+L292: .string "rueslciwnhpklkzox"
+add L300, r7
+L293: .data -628, 149, 369, 246, -266, 803, 942
+L294: jmp *r7
+L295: jmp *r4
+dec L328
+jmp L360
+L296: sub L365, L366
+L297: .data -211, 199, 969, 294, 324, 566, -581
+L298: .data 93, 969, 864
+dec L353
+L299: prn *r3
+rts
+not *r6
+L300: not L326
+; comment
+L301: add r7, r1
+L302: prn *r0
+L303: clr L373
+sub L360, *r0
+not r2
+prn r2
+L304: lea L386, L328
+L305: inc r2
+jsr L311
+L306: prn r1
+mov r1, L344
+L307: bne L351
+jmp *r4
+clr *r6
+prn L327
+stop
+clr *r7
+rts
+L308: stop
+not L328
+L309: cmp *r3, L327
+L310: rts
+jsr L365
+bne L350
+dec L367
+jsr *r4
+mov *r5, L354
+rts
+L311: .data 730, -616, -930, -762, 939, 956
+add r7, *r0
+L312: bne *r3
+L313: .data -900, -237, 282
+jmp L362
+jsr *r0
+L314: mov #239, r7
+jsr *r6
+L315: prn r7
+L316: jmp *r2
+prn L348
+L317: rts
+L318: .string "xtmibosndiwqsrinzw"
+L319: .string "clevryjmcpdu"
+jmp *r1
+add r4, L366
+L320: jsr *r4
+stop
+bne *r7
+jmp L356
+stop
+L321: .data -817, 551, 924, -536, -590, 449
+mov #124, r3
+mov *r6, *r4
+L322: prn #231
+sub r3, *r4
+mov r2, L345
+dec L328
+add L348, L323
+L323: lea L386, r7
+L324: stop
+rts
+L325: inc L369
+bne *r4
+jmp *r6
+clr *r3
+L326: .string "xqennxhwbzffoozsr"
+not *r2
+mov r6, *r5
+L327: stop
+add #-4, L357
+L328: .data -442, -327, -206
+sub #124, *r1
+inc L369
+dec *r6
+L329: cmp *r2, #-75
+jsr L350
+; comment
+dec r0
+L330: lea L359, *r0
+prn L358
+red *r4
+prn *r7
+L331: dec L368
+cmp #45, #-134
+inc r1
+L332: jsr *r2
+clr *r5
+mov L340, *r2
+jmp L373
+
+lea L349, *r7
+L333: stop
+stop
+L334: jmp L369
+L335: .string "gwgqzqqxczwdizd"
+bne L363
+stop
+L336: .string "tboznottovbfpntic"
+L337: dec r0
+clr L384
+bne L375
+L338: clr r2
+add *r5, r1
+rts
+L339: .data 499, -837, 176, -88
+stop
+not *r0
+L340: inc L347
+clr *r5
+bne L374
+stop
+jmp L341
+L341: add *r2, *r6
+clr *r5
+L342: sub r7, L350
+bne *r7
+cmp L350, L350
+jmp L364
+; comment
+jmp L373
+bne L350
+L343: stop
+L344: sub L353, r5
+L345: lea L377, L381
+L346: sub #-165, L376
+L347: not *r6
+dec L375
+dec r7
+L348: mov r3, *r2
+L349: not L371
+jsr L382
+red L360
+red *r4
+prn L351
+add *r5, r0
+jmp *r3
+add r6, r2
+L350: clr r3
+jmp *r5
+L351: inc r7
+dec *r1
+L352: .string "maogu"
+
+L353: .string "lpnijp"
+L354: mov L362, L386
+jsr L377
+L355: jmp L385
+not L356
+L356: bne L359
+stop
+jmp L378
+red r3
+not *r4
+not r3
+jsr L359
+L357: rts
+bne L365
+; comment
+L358: prn r2
+L359: lea L376, L372
+red L360
+not L374
+lea L361, L361
+jmp *r1
+L360: lea L368, r4
+L361: jsr *r1
+L362: not L365
+jmp *r4
+L363: .string "klzke"
+L364: jmp L372
+mov #-22, r3
+L365: .data -507, -753
+L366: jmp *r1
+inc *r4
+L367: add r7, L384
+rts
+mov #-89, *r3
+L368: lea L378, L386
+; comment
+cmp #-74, *r1
+L369: .data -286, 410, 369, 227, 23, -514, -952, 368
+L370: .data -552, -105, 960, 430
+red *r6
+sub r3, *r5
+L371: .string "svnqnriskinrgjbhhwobs"
+dec r1
+L372: inc L377
+L373: jmp *r4
+L374: .data 807, -553, -460, 332, 945, 752, -185, 855
+L375: not L378
+cmp *r2, r2
+red r6
+L376: jmp L383
+inc L379
+rts
+mov L380, r2
+sub r2, *r7
+L377: lea L385, L382
+not r0
+sub #185, L381
+; comment
+L378: sub r4, r7
+cmp r1, #251
+mov L379, *r1
+L379: add r5, r7
+L380: mov r6, *r3
+clr L384
+L381: prn #237
+L382: sub L383, *r2
+clr L385
+dec *r7
+cmp *r5, r7
+L383: inc r2
+not r7
+lea L385, r7
+L384: inc r7
+L385: lea L386, r2
+L386: dec L200
+stop
@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 31
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+L0: .data -336, 949, 35, -418
+L1: .string "ixftvgovnmxdjvvefyohuity"
+not r6
+bne *r3
+L2: sub *r4, L16
+L3: sub *r5, r1
+jsr L193
+jsr L143
+jsr L305
+jsr L76
+lea L264, *r5
+prn #-203
+; comment
+rts
+
+L4: add *r4, L342
+inc L218
+L5: not L19
+L6: cmp #-218, *r5
+rts
+L7: dec L308
+not r6
+stop
+cmp L83, #-129
+L8: .data -68
+mov #89, r6
+not *r2
+clr *r6
+L9: prn L264
+L10: jsr *r0
+rts
+L11: prn #6
+not *r6
+L12: prn *r7
+red *r1
+cmp *r2, *r2
+jsr L58
+red L274
+rts
+bne L225
+L13: bne L207
+inc r5
+L14: .string "fcirxclvrxegyiuqulai"
+sub L308, *r6
+stop
+red r4
+dec *r0
+L15: stop
+L16: .data -841, -747, 640, -788, -543, 810, -233
+stop
+L17: .string "ikemalxjzfsfatpz"
+red *r3
+L18: add *r0, r5
+stop
+L19: .string "fouo"
+bne L146
+red L339
+L20: .data -721, 465, 495, -337, 331, -452, 696
+red L160
+L21: not *r1
+jsr L86
+lea L116, r1
+prn r6
+add L208, L154
+prn *r2
+bne L73
+L22: stop
+L23: prn r1
+L24: red r0
+jmp L273
+sub #152, r2
+L25: stop
+rts
+add #-30, r4
+dec r0
+L26: mov r2, L77
+inc L55
+add *r4, r0
+dec r7
+inc L303
+clr L110
+L27: dec L122
+L28: .string "iizogpz"
+L29: .string "sqewvhlevrvxrdrdjblsn"
+L30: .data -390, -71
+L31: jmp *r2
+sub L43, r1
+L32: cmp #72, #-44
+not L47
+jmp L355
+L33: bne *r5
+sub #165, *r2
+clr r2
+lea L106, L345
+L34: not *r6
+bne L150
+; comment
+red r1
+clr r2
+L35: bne L266
+; comment
+lea L153, L353
+mov r0, L129
+stop
+L36: red r0
+red *r4
+inc *r5
+L37: add r6, *r6
+; comment
+red L357
+red L141
+prn r6
+lea L190, r7
+red r6
+L38: mov #161, *r0
+L39: stop
+clr *r7
+
+
+rts
+L40: add #187, *r3
+
+bne L279
+dec *r3
+L41: .string "wtzzlt"
+jsr L325
+jsr L351
+jsr L97
+L42: jmp L266
+not L225
+mov #-124, *r7
+L43: prn *r6
+L44: mov L179, L289
+L45: cmp *r5, r0
+L46: sub *r3, r4
+mov *r6, r6
+L47: bne L172
+mov #-77, r6
+sub #195, L326
+L48: .string "hphremyvicbeucv"
+red *r1
+L49: lea L217, L115
+L50: not r7
+L51: cmp L261, L342
+L52: add r2, *r6
+mov *r7, *r1
+L53: bne *r6
+L54: red r1
+dec *r2
+not L175
+rts
+rts
+
+L55: stop
+rts
+clr *r5
+stop
+L56: jmp L309
+L57: dec L154
+L58: add #-75, r1
+inc L152
+inc *r5
+L59: bne *r3
+cmp *r2, *r1
+L60: clr r5
+mov L214, r4
+jmp L67
+L61: bne L297
+mov *r5, r2
+L62: clr r4
+L63: jmp *r7
+L64: mov #-245, *r5
+L65: stop
+mov L333, *r2
+L66: inc *r6
+L67: .string "rhsmg"
+stop
+jsr *r3
+L68: not L70
+rts
+L69: .data -533, -883, 337
+; comment
+L70: jmp *r4
+lea L256, *r2
+inc L140
+L71: inc L270
+sub L287, *r3
+L72: .data -830, 511
+jmp *r0
+sub r7, r1
+L73: clr L287
+
+L74: sub *r7, *r2
+jmp *r6
+clr L147
+bne L202
+jsr *r6
+L75: jmp L141
+inc r6
+L76: jmp L146
+
+add L268, L249
+L77: jsr *r1
+L78: .string "fls"
+dec L292
+
+bne L95
+cmp L127, r6
+L79: dec *r2
+not L192
+rts
+mov L296, *r1
+cmp *r2, *r5
+bne L129
+cmp #-97, L270
+L80: jsr *r6
+mov *r3, r3
+L81: lea L112, *r2
+prn r4
+L82: clr L95
+inc L102
+rts
+rts
+add r1, r0
+L83: jmp *r0
+jmp L147
+L84: sub r7, *r5
+inc L299
+L85: add r1, r0
+L86: mov r3, *r0
+red r7
+L87: .data -307, -328, 780, -294, -383, 464, 753, -591
+mov *r6, r7
+L88: .string "phrhlcvlwbwehhvghwjgqp"
+L89: jsr L178
+; comment
+red L277
+; comment
+mov *r2, L181
+L90: prn L239
+prn #17
+L91: prn *r4
+sub *r6, L254
+lea L282, r6
+L92: lea L205, *r1
+bne L182
+not L153
+lea L200, L252
+not r5
+jmp L337
+L93: .string "fieepbyzkacuwfakpthxckxy"
+rts
+dec r5
+prn r5
+jsr L186
+jsr *r0
+L94: dec r7
+L95: .data -459, 169, -327, -374, 189
+L96: clr L329
+jmp L160
+; comment
+jmp L170
+dec L284
+clr *r1
+jsr L299
+red *r0
+; comment
+L97: .string "rj"
+bne *r0
+L98: not L207
+clr *r5
+stop
+red *r5
+L99: jmp L110
+mov r7, *r5
+cmp #11, *r1
+add L307, L207
+
+; comment
+mov *r1, L128
+stop
+jsr L191
+clr *r1
+clr r7
+clr r7
+not L170
+L100: jsr L130
+jmp *r1
+; comment
+L101: clr r2
+L102: mov *r1, r6
+dec *r6
+clr *r0
+stop
+L103: mov r1, L161
+red L315
+L104: inc *r7
+L105: lea L192, L203
+lea L232, *r6
+L106: jsr L278
+not *r7
+L107: bne *r1
+lea L226, r6
+add r3, r6
+red *r7
+L108: prn L155
+; comment
+L109: mov r4, r7
+L110: dec r4
+red L201
+inc L158
+stop
+sub *r1, r3
+not r1
+L111: dec *r1
+
+L112: .string "zmyqkoalzjfqkswkx"
+; comment
+L113: jmp L197
+L114: .data 223, -808
+L115: jmp *r5
+clr r4
+sub #49, *r3
+dec L210
+L116: .data -4, -585, 329, 578
+red r1
+not r2
+jsr *r6
+red L122
+L117: prn *r1
+rts
+jmp *r6
+L118: add L335, r2
+L119: sub r2, *r6
+bne *r0
+add r1, r3
+L120: lea L318, *r2
+cmp *r2, *r5
+bne *r4
+; comment
+
+sub r3, *r6
+jmp L307
+prn r7
+stop
+lea L265, *r4
+L121: jmp *r6
+lea L220, L161
+mov L130, r1
+L122: bne L242
+red *r7
+L123: dec *r7
+L124: prn #34
+rts
+L125: sub L186, r4
+L126: rts
+dec *r2
+L127: stop
+lea L241, L148
+L128: stop
+inc *r0
+L129: bne L132
+jmp L309
+stop
+not r4
+jmp L201
+dec r0
+add #-70, *r2
+bne L271
+lea L144, r6
+L130: .data 995, 169, -76, 409, -698, 457
+L131: .data -572, -265, 953, 887
+inc *r1
+L132: .data 75, -830, 780, 991, 542, -520
+bne *r5
+
+
+L133: red r2
+jsr L314
+L134: lea L179, r2
+mov L335, *r3
+L135: .string "wdqfwdpyaywwqai"
+not *r3
+prn L336
+L136: .string "fhdjjodivxsn"
+L137: mov #160, L266
+L138: .string "epwkxnuuvcjagrgg"
+stop
+L139: not L353
+clr *r2
+L140: jmp L313
+inc *r3
+L141: rts
+dec L354
+inc L282
+bne L311
+L142: prn *r4
+prn L169
+cmp *r3, #-256
+L143: rts
+jsr *r5
+stop
+not *r3
+L144: lea L157, L302
+sub L339, L186
+sub #-200, r0
+sub L236, r0
+L145: red L349
+red *r2
+L146: stop
+stop
+mov *r0, *r0
+L147: jsr L218
+stop
+mov #-190, L293
+bne L205
+prn r2
+red r3
+not *r6
+mov #-2, r5
+prn L249
+
+L148: cmp L199, #-105
+L149: lea L301, r2
+not r4
+L150: dec r1
+lea L303, L343
+inc r0
+L151: stop
+L152: .data 807, 340, 357, 127, -301
+
+bne *r0
+L153: lea L176, r6
+L154: dec r3
+L155: .data -458, -995
+bne L313
+L156: dec r7
+not *r4
+L157: cmp r1, r6
+prn #-208
+lea L325, L189
+jsr *r0
+not *r4
+sub #249, r0
+clr L259
+L158: stop
+prn #83
+add r2, L189
+L159: rts
+not r7
+L160: .data -361, 171, 160
+L161: jsr *r3
+L162: clr L293
+jmp *r1
+add L252, r4
+lea L322, L215
+L163: add r2, L339
+L164: prn #190
+L165: sub *r0, L315
+L166: not r2
+L167: jsr *r4
+lea L303, L204
+
+L168: rts
+add L196, r5
+inc *r0
+mov #-127, *r4
+cmp *r1, *r5
+L169: jsr L310
+prn #114
+red L306
+cmp L287, L206
+rts
+rts
+L170: clr L182
+L171: lea L296, L263
+dec *r0
+rts
+
+prn #80
+jmp *r6
+prn *r5
+add r4, L230
+bne L205
+rts
+L172: jsr L323
+L173: dec L330
+rts
+prn #-89
+L174: lea L268, r3
+L175: stop
+mov r5, *r4
+jmp *r4
+L176: bne L334
+L177: inc r4
+L178: cmp #-124, r6
+L179: .string "refnvtmzyhai"
+L180: rts
+L181: not r0
+rts
+rts
+red *r0
+jsr *r5
+L182: not *r5
+mov L332, *r4
+L183: rts
+L184: .string "dkrlgadqrkfhijkqpog"
+L185: prn r1
+L186: lea L336, L336
+not r2
+rts
+mov r7, r7
+add #-194, L339
+cmp L337, L210
+L187: add r0, r5
+; comment
+L188: not r2
+jmp *r6
+lea L217, r5
+prn L274
+L189: cmp r0, *r4
+dec L226
+
+red *r7
+dec *r7
+L190: red L327
+L191: clr *r2
+sub L230, *r3
+lea L281, L256
+red *r0
+jmp *r2
+L192: add r5, *r0
+rts
+L193: .data 186, 116, 847, -826, -462
+clr *r6
+jmp *r4
+jmp L197
+stop
+; comment
+L194: bne L270
+jsr *r2
+jmp L216
+inc *r2
+jmp L319
+jsr *r6
+L195: dec r2
+L196: prn *r3
+rts
+L197: dec r5
+cmp *r6, r1
+mov L276, L234
+L198: stop
+red L199
+sub *r4, L255
+prn *r4
+L199: clr *r1
+L200: .string "qkextxfoxucsmwho"
+cmp r0, L297
+L201: jsr L333
+L202: inc *r7
+L203: .data -836, 795, 834
+not *r3
+lea L275, *r5
+; comment
+L204: prn #217
+prn L282
+L205: .data -120, 570, 519, -84, 626, -958, -561
+prn r3
+lea L250, r6
+L206: lea L240, *r7
+jmp L297
+sub *r2, L331
+clr L319
+L207: sub r3, r7
+L208: rts
+jmp *r6
+add #-141, L262
+prn L210
+cmp #-135, L348
+L209: sub *r0, L341
+L210: inc L266
+cmp r5, #-99
+rts
+L211: sub L248, *r4
+dec *r6
+inc r7
+L212: .data 250, 831, 845, 72, -892
+sub L231, L290
+rts
+bne L348
+cmp L270, #-244
+L213: inc *r0
+cmp #-17, #164
+add L285, *r0
+add #-131, r4
+L214: bne L345
+L215: cmp #142, L264
+L216: .data 104, 1, 360, -494
+L217: lea L258, *r1
+stop
+cmp *r5, L230
+not L314
+stop
+L218: rts
+inc r1
+L219: dec r2
+rts
+L220: jmp L285
+L221: .string "wrfnshxbnnodkshbvancwhdw"
+lea L346, r7
+red r4
+jsr L343
+L222: .data 183, 149, -72, 743, 113, -35
+jmp *r5
+L223: cmp r0, r7
+L224: jmp L267
+
+lea L336, *r2
+sub *r0, r1
+L225: red L287
+L226: dec r0
+not r0
+mov r1, L333
+L227: clr r2
+lea L329, *r2
+L228: mov *r0, r5
+stop
+sub *r5, r5
+stop
+L229: rts
+; comment
+lea L237, *r2
+mov r7, *r0
+clr *r1
+rts
+L230: inc r6
+L231: cmp r0, r7
+jmp *r7
+not r5
+L232: lea L305, L235
+L233: dec r3
+clr *r5
+rts
+red r5
+L234: .string "jcoxiqmdbczjyvwpk"
+rts
+inc r4
+L235: .data -806, 145, 448, -948, -944, -681, 537
+inc L338
+add L318, r0
+L236: clr *r0
+not *r3
+L237: stop
+; comment
+cmp L253, r5
+sub *r6, r4
+prn r0
+inc r5
+L238: .data 952
+L239: .data -966, -712, 392, -312, 605, 81, -63
+mov r1, r5
+red r7
+
+cmp *r0, *r7
+L240: .data 109, -868, 790, -365, 755, 540
+dec L349
+mov L296, *r4
+L241: .string "tmatmnquq"
+not r6
+clr *r2
+sub L289, r0
+L242: clr r7
+L243: not L284
+; comment
+L244: .data 716, -921, -98, -399, 172, -653, 304
+; comment
+L245: jsr *r6
+jsr L320
+add #-4, L277
+mov r3, r5
+L246: cmp L349, #-112
+L247: dec r7
+stop
+mov r1, r3
+L248: .string "dfyy"
+sub *r0, L341
+add L295, r1
+add *r0, r6
+L249: clr r3
+inc L309
+L250: .string "kwlqqxwmncursyibyapv"
+lea L253, L289
+cmp L266, L308
+bne L305
+L251: red L330
+lea L311, r0
+jsr L316
+L252: clr L291
+L253: .data 505, 372, -87, 821, 812
+add *r0, L333
+not r2
+L254: .string "psrxfgkchigkwcs"
+stop
+sub L359, L351
+prn r2
+L255: clr *r4
+add r1, r4
+add r6, L338
+
+L256: cmp L316, *r7
+jsr L265
+L257: .data -585, 962, -545, -968
+sub #-86, r0
+
+
+L258: jsr L296
+rts
+sub #251, r2
+stop
+lea L262, r0
+mov #240, *r5
+clr *r2
+lea L262, *r2
+L259: prn *r1
+prn #190
+add L360, *r5
+L260: dec L280
+stop
+not *r6
+mov L323, *r4
+clr r7
+stop
+lea L306, L323
+clr L338
+L261: not L298
+rts
+not *r3
+L262: stop
+not *r1
+inc *r3
+bne L272
+L263: red r4
+L264: jsr L269
+bne L295
+L265: mov r5, L322
+L266: rts
+L267: clr *r0
+mov *r1, *r2
+rts
+L268: jsr *r7
+add *r4, r4
+L269: .data 959, 458, 316, 942
+L270: red *r0
+L271: cmp r2, *r1
+red L317
+L272: .data -294, 750, -277, 895, 120, 142
+L273: .data 242, -632, 430
+L274: stop
+
+L275: not *r6
+; comment
+prn *r2
+dec *r2
+sub #215, L290
+jmp L356
+jmp L357
+L276: jmp *r0
+sub *r5, r7
+red L348
+L277: add *r7, L302
+rts
+dec *r0
+dec L298
+mov *r6, r5
+jsr L316
+L278: not r1
+prn r4
+mov *r1, L326
+stop
+L279: inc r2
+L280: .data 741, -597, -162, 615, -222, 702
+sub *r3, r0
+inc L315
+L281: .string "w"
+prn r1
+red r2
+dec L322
+rts
+inc L292
+mov r2, r5
+not r7
+L282: .string "mos"
+L283: inc L313
+not L303
+; comment
+inc L291
+clr L285
+L284: stop
+add #93, r5
+L285: prn L344
+lea L315, *r5
+L286: .data -560, -601, -226
+jmp L299
+bne L321
+L287: not *r7
+sub r3, r4
+L288: .data -125, 294, -661, -571, 935, -838, -520, -591
+prn #-31
+; comment
+prn L327
+L289: .string "kmdmqzzfzh"
+jsr *r7
+cmp *r5, *r3
+not L348
+L290: .string "wquaej"
+stop
+L291: clr *r6
+bne *r6
+cmp L344, r4
+L292: .string "utaglnhsoieqlswnevizh"
+not L333
+lea L335, r3
+add r4, L338
+L293: jmp L318
+mov #41, *r7
+; comment
+rts
+inc L306
+cmp *r7, r2
+clr r4
+L294: cmp r0, L308
+L295: jsr *r0
+not *r2
+jsr *r6
+add r7, r6
+L296: inc L320
+red L337
+L297: inc r4
+L298: add *r6, *r1
+clr *r5
+L299: rts
+L300: prn *r3
+cmp L352, r6
+rts
+L301: .string "vnbkmddcqkqfzbvmenhxaj"
+dec L306
+L302: mov L347, r5
+L303: sub #-121, L352
+lea L330, r3
+dec *r1
+stop
+not L304
+L304: .string "fyhvalgldlfkwjyhsxuetjf"
+L305: sub L355, *r0
+jsr L319
+; comment
+; comment
+bne L306
+L306: not r0
+cmp #-200, L314
+L307: dec L360
+mov r0, *r3
+L308: .string "njhmsfyjuajmllxwwwthkr"
+cmp #192, L324
+L309: clr r4
+L310: lea L315, r1
+L311: add r4, *r0
+inc L345
+add #-120, *r2
+dec r3
+lea L326, *r4
+jmp L332
+
+
+L312: sub r5, *r6
+rts
+L313: cmp L350, #71
+L314: .string "dwkexdlfudlccyeiiqpcj"
+L315: rts
+jmp L330
+L316: inc *r4
+clr *r7
+jsr *r2
+L317: .string "mawdlbxwg"
+lea L349, r5
+L318: .data 598, -976, 328, -183, -824
+rts
+bne *r2
+cmp L354, #-37
+red r1
+clr L320
+not *r7
+L319: .string "caluddlghketfxiurxpetnm"
+clr r6
+L320: cmp #169, L332
+inc r0
+L321: inc *r0
+jsr L358
+L322: mov L348, r4
+L323: .data 739, 778, 922, -423
+dec L355
+stop
+inc r5
+add L334, r1
+inc r2
+L324: clr L349
+
+sub #61, L347
+inc *r0
+L325: .string "dnkcxavwapt"
+not r4
+L326: add L343, L360
+cmp *r1, r2
+clr L353
+bne L347
+L327: jmp L332
+L328: .data 917, -391, -303, -934, 644, 323, 979, 967
+mov r6, *r7
+cmp *r5, r4
+L329: dec *r1
+L330: jsr *r0
+bne *r4
+rts
+
+L331: inc r2
+clr L332
+clr r6
+not L357
+
+prn *r6
+prn #38
+L332: .string "whjrzgeqzigh"
+mov L353, *r5
+L333: red *r2
+dec r0
+clr L340
+L334: stop
+inc r4
+L335: cmp *r2, #184
+lea L358, *r3
+not *r5
+not *r2
+L336: inc *r7
+L337: .string "dcwczkvcj"
+L338: clr r0
+L339: add L347, r6
+mov #-21, r5
+clr L350
+L340: jmp *r0
+dec *r6
+; comment
+prn #184
+stop
+L341: not L346
+clr r1
+dec r7
+bne L347
+L342: prn #167
+L343: .string "iypvgbyhf"
+bne L346
+L344: prn *r0
+
+sub #12, *r0
+L345: .string "ukrhankqsrru"
+lea L356, r6
+not r5
+L346: .data -661, -73, 635, -725, 2, 592
+inc L359
+jmp L349
+L347: jmp *r3
+L348: prn #-187
+inc r4
+L349: clr *r0
+; comment
+jmp L360
+clr *r7
+clr r1
+bne *r7
+jmp *r7
+
+L350: red r5
+sub #240, L354
+rts
+L351: not r3
+not r5
+red *r6
+dec r2
+L352: lea L356, L357
+L353: .string "amybtlnithtwcdt"
+L354: .data -182, -321, -783, -500, -862, 649, -995
+L355: mov L356, *r3
+bne L360
+L356: lea L360, r2
+inc r4
+L357: lea L360, *r1
+L358: rts
+inc L360
+L359: bne *r6
+L360: stop
+bne L290
+stop
@@ -0,0 +1,1026 @@
+; Generated by genCorpus --seed 32
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+L0: mov #101, r0
+L1: stop
+mov L194, *r1
+L2: not r0
+L3: sub *r3, *r7
+bne *r5
+L4: .string "sskfrypix"
+L5: .string "rgguclqzmjfsdidgdscj"
+L6: prn *r7
+; comment
+L7: stop
+bne L338
+L8: dec r3
+L9: rts
+jmp *r6
+add r2, L70
+jmp *r1
+L10: .data -315, -692, -783, -541, 880
+rts
+jsr *r0
+L11: .data -652
+L12: jsr *r7
+L13: .data 280, 472
+L14: sub L296, r5
+cmp *r0, #243
+sub L86, *r2
+bne L336
+rts
+mov r4, r7
+bne *r0
+L15: .data 543, 928, 293, -448
+L16: cmp #18, #101
+L17: .string "oxnnyfqkeqn"
+dec *r5
+inc L135
+L18: sub L344, r6
+L19: clr r5
+inc r4
+jmp L226
+L20: .data 521, -463, 818
+rts
+add #162, r0
+rts
+prn L147
+mov *r7, *r7
+sub L197, *r3
+L21: clr *r2
+prn *r7
+L22: .data -386, -921, 470, -123
+add r5, L194
+bne *r2
+sub *r5, *r4
+L23: bne *r6
+L24: cmp #210, *r4
+clr L221
+bne *r1
+L25: sub *r7, *r0
+; comment
+lea L195, L261
+inc r1
+add #-68, L126
+L26: .data 624, 858, -258, 660, 239, -493, 368
+sub r1, L367
+add L244, r3
+L27: mov *r2, L221
+L28: clr *r5
+
+mov #55, r2
+prn *r3
+L29: .string "hiitbfz"
+clr L306
+L30: cmp #-26, #155
+sub L35, L39
+L31: .string "mflcntkbcymypfl"
+sub r3, r6
+jsr L219
+mov r2, r4
+L32: rts
+jsr *r1
+jmp L71
+L33: mov L337, L116
+
+mov #146, L344
+jsr L268
+L34: lea L195, *r7
+
+L35: jmp *r1
+L36: rts
+
+L37: mov #-235, L341
+L38: inc L103
+; comment
+inc r4
+red r6
+rts
+jmp L41
+bne *r2
+mov *r5, L146
+inc L209
+L39: .string "xzcuuzifrtueaihih"
+dec L363
+sub L218, L125
+jmp L95
+L40: not L160
+lea L84, L293
+stop
+L41: .string "vam"
+L42: not r4
+
+L43: .string "ojnyevef"
+L44: .string "basyjjwbeiuirfxrbhqg"
+L45: lea L132, *r7
+red L236
+stop
+not *r7
+L46: cmp r4, L301
+not L69
+L47: stop
+inc *r5
+stop
+L48: dec r0
+L49: jsr L217
+L50: clr r5
+L51: add #237, L302
+dec *r3
+inc r0
+cmp #-196, *r6
+stop
+rts
+L52: .string "hlmgemvcqdymyyntmssoreni"
+L53: clr *r2
+add r7, *r5
+mov *r6, r0
+lea L132, r1
+red r0
+inc r7
+sub *r4, L177
+prn *r2
+clr *r2
+L54: lea L359, L289
+bne L79
+stop
+L55: not L238
+add r6, r6
+L56: inc *r6
+jmp L57
+L57: not r5
+clr *r0
+add #125, L242
+bne L364
+not r5
+dec L193
+L58: red L178
+red L110
+rts
+L59: bne L356
+L60: .data 484, 682, -672, 744
+L61: .data 839, 854, -384, -1, -96, -333
+L62: sub *r4, *r4
+L63: .data 721, -681, 479, -252, -791, -269, 649
+lea L164, L163
+lea L236, r5
+L64: bne L110
+add L232, r7
+lea L330, *r1
+red r3
+cmp r2, #127
+jmp L81
+red r1
+jmp *r6
+stop
+L65: .string "ykgsbplx"
+L66: .string "tpv"
+add *r5, r6
+jmp *r0
+L67: jsr *r0
+lea L238, L305
+sub L288, r3
+rts
+L68: inc *r7
+
+L69: sub r0, L335
+not r6
+sub *r6, *r7
+L70: inc *r1
+; comment
+rts
+L71: .data 828, -101, 237, 959, -854, 507
+lea L109, r0
+L72: .string "zmebfglpkp"
+bne L304
+L73: jmp *r6
+; comment
+L74: rts
+stop
+L75: add *r7, r4
+jmp L244
+
+L76: clr L261
+L77: red L162
+L78: lea L131, *r3
+not r1
+sub *r6, *r1
+L79: clr *r3
+L80: jsr L265
+rts
+L81: .string "sc"
+
+L82: jmp *r5
+L83: sub r6, L264
+jmp L334
+add *r0, L171
+jmp L323
+stop
+not r1
+L84: rts
+L85: prn L156
+add #-252, *r7
+jmp L231
+clr *r4
+L86: sub r1, r0
+clr *r4
+sub #-189, L138
+L87: bne L286
+L88: rts
+L89: red r3
+L90: lea L100, *r2
+prn #148
+L91: .data 671, -940, 528, -172, -5, 247, -761
+lea L179, *r0
+bne *r3
+inc r0
+L92: lea L283, *r0
+inc L329
+sub r7, *r2
+L93: mov #-244, L343
+L94: .data -905, -885, 783, -557, -465
+prn r4
+inc *r7
+L95: .string "yghmqopoywuzqgctyxw"
+L96: stop
+add #-117, L348
+bne L120
+L97: bne L171
+inc *r6
+L98: inc L176
+; comment
+sub r4, L131
+prn *r0
+L99: jsr *r5
+bne *r7
+jmp *r4
+L100: sub *r6, *r2
+red *r5
+inc *r2
+not r6
+stop
+stop
+red r7
+bne L342
+red r0
+stop
+L101: sub *r7, L297
+L102: .string "qmaockac"
+lea L215, r0
+L103: red L198
+red *r5
+jsr L309
+L104: stop
+L105: cmp r2, r5
+bne *r4
+clr L244
+not r7
+bne *r7
+L106: clr r0
+not r1
+L107: clr *r7
+L108: stop
+dec r1
+L109: rts
+prn #75
+; comment
+L110: inc r6
+jsr L254
+clr *r6
+inc r0
+L111: inc r3
+jmp *r3
+stop
+cmp *r5, #251
+L112: .data -581, -158, -551
+mov r0, r5
+L113: lea L178, r5
+red *r2
+rts
+rts
+jmp L176
+; comment
+; comment
+L114: inc *r2
+L115: .data -883, 711, 291, 82, 944
+prn L260
+L116: cmp L229, #-159
+lea L352, r6
+stop
+bne L326
+cmp r1, *r2
+stop
+red L346
+jmp *r5
+L117: jmp *r7
+lea L277, *r5
+L118: rts
+L119: cmp r1, L359
+mov L280, r0
+L120: mov r7, *r5
+inc r6
+L121: cmp r1, L174
+L122: lea L165, *r7
+lea L128, r2
+bne L132
+mov r5, r7
+bne *r5
+L123: not L354
+stop
+prn #165
+jsr *r0
+L124: mov L354, *r6
+stop
+bne L281
+mov #69, r1
+L125: inc r4
+dec L232
+jsr *r7
+clr r2
+prn L288
+bne *r3
+dec r0
+L126: clr r5
+mov #246, L336
+add #-122, L155
+dec r5
+L127: .string "qat"
+L128: dec r7
+sub r4, *r3
+red r7
+; comment
+mov r1, *r0
+not *r0
+dec *r1
+L129: cmp *r1, *r7
+mov L365, r0
+lea L155, L264
+red r4
+jmp *r0
+L130: lea L234, *r4
+L131: rts
+
+rts
+lea L141, L360
+L132: not L195
+inc r7
+bne *r3
+clr r0
+sub r1, L337
+L133: jsr *r7
+dec L182
+clr L312
+inc r0
+dec *r2
+
+L134: rts
+; comment
+mov r1, L207
+lea L291, r2
+stop
+dec L144
+inc *r4
+red L163
+L135: red *r7
+jmp L282
+sub #-160, *r6
+dec *r2
+jsr L256
+stop
+not L245
+L136: jsr *r3
+dec *r5
+not *r0
+L137: not r2
+add L229, L342
+L138: rts
+lea L170, L148
+L139: clr *r3
+jmp L331
+jmp *r6
+L140: sub r4, L176
+L141: .data 73, -622, -448, -147, 879
+red *r0
+L142: .string "qxuicbrtsanwkveanh"
+not *r1
+L143: add L340, *r4
+L144: .data -923, -896, 618, 883
+L145: .string "buom"
+bne *r1
+L146: .data 935
+L147: .data 295, 707, -619, -222, -58, 870
+L148: .data -605, -844, -900, -675
+clr r1
+lea L162, *r1
+; comment
+L149: mov *r6, *r5
+jmp L295
+inc L320
+sub #-130, L259
+mov L300, *r0
+prn #-154
+sub #-60, *r2
+L150: sub *r0, L326
+L151: .string "kj"
+mov L351, L185
+; comment
+L152: sub L180, L339
+L153: not r4
+jsr *r1
+
+L154: clr r6
+L155: dec L365
+L156: .data 704, -346, -957, -358, -631, 294, 203, 453
+L157: cmp *r5, #-4
+L158: lea L159, *r2
+clr *r7
+cmp #217, L319
+inc r1
+L159: .data 75
+jsr *r1
+clr *r4
+add L174, r5
+red *r7
+L160: mov r7, *r3
+stop
+clr *r3
+clr *r6
+L161: prn #63
+L162: rts
+inc *r0
+sub r3, *r3
+L163: .data -34, 378, 876, -917, 182, -374, -73, -673
+sub *r6, *r1
+L164: sub L237, L350
+sub L287, r0
+add r6, r6
+inc L213
+prn #-139
+inc L238
+L165: .string "uwbjtfvdpjxdimnsyh"
+L166: prn *r4
+cmp *r3, L297
+L167: red L186
+; comment
+red *r2
+mov r5, *r4
+L168: .data 65, 295, -348, 375, -317, -236
+L169: inc *r5
+sub #196, L230
+L170: lea L306, r7
+L171: .string "eiao"
+L172: jmp *r6
+L173: stop
+not *r4
+mov L186, *r5
+L174: .data -919, -991, -431, 596, 869, 41
+L175: .string "bdtqqfhjatuohtjrd"
+L176: cmp *r1, #-169
+add r2, r7
+jmp L217
+L177: lea L304, r2
+red L301
+L178: .data -593
+jsr *r4
+L179: .string "mkrpweggpzaucklj"
+L180: sub #141, r4
+L181: cmp #224, L346
+clr r7
+not *r4
+jmp *r5
+; comment
+clr L355
+clr *r4
+L182: sub L230, *r3
+L183: red r7
+dec r1
+L184: rts
+L185: jmp L322
+jmp L275
+rts
+L186: not r0
+rts
+L187: bne *r4
+L188: clr *r3
+add r2, *r5
+add r0, L296
+rts
+mov *r5, *r0
+bne L360
+L189: .data 342, -144, -571
+mov *r6, r6
+dec L265
+stop
+red *r2
+mov L359, L342
+L190: lea L280, r6
+red *r7
+mov #-66, r3
+jmp *r4
+L191: dec L244
+add #134, *r6
+sub r2, r1
+inc *r4
+dec r0
+not L203
+L192: dec *r3
+
+inc L215
+add L300, r1
+L193: red L349
+L194: clr r7
+L195: jmp L330
+; comment
+L196: .string "mbc"
+prn #-244
+add r3, r0
+not *r0
+prn *r2
+inc *r4
+; comment
+add #139, L309
+jmp *r1
+; comment
+L197: prn #250
+L198: add L310, *r4
+inc L243
+dec L285
+L199: jsr *r3
+stop
+prn r6
+prn #205
+jsr *r3
+prn r6
+L200: not L350
+jmp *r6
+jmp *r6
+clr r4
+stop
+L201: cmp *r4, #111
+L202: red L362
+L203: .string "qsoluoudgdvyreoowzp"
+L204: dec *r7
+inc *r4
+lea L317, *r2
+dec *r5
+L205: .string "yhpamyrkaa"
+dec r1
+L206: sub *r0, *r7
+sub #5, L272
+add *r3, *r1
+cmp *r6, *r2
+L207: mov L275, *r4
+
+L208: jsr *r6
+; comment
+L209: not *r1
+inc L356
+L210: sub #169, *r3
+sub #-216, r0
+jmp L236
+dec *r7
+inc r5
+inc L332
+L211: red *r2
+cmp #-9, #54
+L212: jsr *r4
+clr *r4
+rts
+L213: not *r0
+inc L368
+mov #59, L360
+sub L218, L251
+inc *r7
+prn L241
+prn L218
+add #185, *r7
+L214: clr r1
+; comment
+not *r7
+
+mov r5, L263
+bne *r4
+L215: inc L334
+stop
+rts
+; comment
+L216: .data 264, -44, 959
+inc L307
+L217: cmp L293, *r5
+L218: inc r7
+rts
+L219: rts
+rts
+dec L255
+
+red r3
+rts
+L220: dec *r0
+bne L255
+dec r6
+bne L245
+add r2, *r4
+dec r1
+stop
+not r1
+L221: clr L241
+L222: .string "grkqmsgjszu"
+L223: .data -331, 660, -742, 494, 91
+L224: jmp *r0
+add L285, L352
+L225: add L231, r5
+L226: red r1
+L227: not r4
+L228: .string "gqforwhf"
+inc L365
+sub *r2, *r0
+inc r7
+L229: .string "ilpapv"
+prn r1
+L230: jsr *r3
+L231: stop
+L232: lea L311, L361
+L233: .string "hnpr"
+clr r6
+jsr L237
+
+mov *r5, L304
+rts
+jmp L340
+cmp *r3, r5
+jsr *r0
+dec *r3
+lea L300, r6
+mov *r3, r1
+clr r2
+inc r5
+; comment
+L234: red *r3
+L235: .data -793, 805
+stop
+L236: dec r7
+jsr L293
+L237: cmp r6, *r0
+L238: dec r4
+L239: jsr *r6
+rts
+L240: stop
+L241: dec L365
+inc L352
+mov *r4, r1
+L242: prn #180
+L243: sub L341, *r5
+mov #140, *r6
+L244: inc r7
+L245: .data 878
+L246: inc r6
+jmp *r2
+jmp L278
+stop
+cmp #-75, #-70
+jmp *r2
+L247: not L249
+L248: rts
+L249: red r7
+L250: bne L251
+L251: not L288
+jsr *r5
+dec *r0
+L252: .string "ldqfyupllkw"
+L253: prn L295
+L254: .string "jhozpehconsaslgtx"
+jmp *r2
+mov *r2, r2
+L255: red L285
+sub *r2, r4
+L256: jmp *r1
+jsr L298
+add r5, *r2
+cmp L346, L307
+L257: clr L304
+rts
+add r0, L318
+jsr L330
+L258: add r7, L333
+mov L277, L344
+not L320
+L259: lea L282, *r3
+prn *r3
+inc *r4
+L260: prn L351
+add r1, r5
+L261: .string "zpfi"
+
+dec *r5
+L262: prn *r6
+clr L300
+dec r7
+L263: inc L303
+L264: lea L318, r2
+stop
+bne L301
+mov *r5, L304
+L265: jmp L321
+L266: .string "cqxybjtpvqjtdyocyzawa"
+L267: not r6
+L268: prn r4
+L269: .string "evt"
+L270: add #236, L318
+rts
+red r2
+stop
+L271: clr L331
+mov r2, L339
+sub #-47, r7
+L272: .string "ytzvcwqlljljplr"
+; comment
+L273: clr L293
+cmp r0, *r6
+L274: red L309
+prn L307
+L275: red *r5
+sub r1, r7
+rts
+jmp *r3
+L276: .data -970, 169, 804
+L277: add r1, L364
+stop
+L278: .string "ewduv"
+bne L344
+; comment
+jsr *r0
+L279: add #130, L314
+L280: stop
+L281: inc r7
+mov #-76, r2
+L282: jmp L348
+L283: red *r1
+red r3
+L284: .string "ibpt"
+inc L291
+inc *r6
+L285: clr *r0
+L286: sub r4, *r3
+L287: prn r7
+red L308
+prn r7
+L288: .string "dyserijkdb"
+jsr L289
+L289: red *r3
+; comment
+
+stop
+jsr *r7
+L290: jmp *r2
+rts
+L291: bne *r0
+L292: prn r3
+prn r3
+add #4, *r3
+
+L293: dec L295
+lea L332, L328
+L294: prn L353
+rts
+stop
+L295: .data -880, 53, 737
+inc r4
+rts
+L296: lea L348, *r1
+
+L297: add *r2, L339
+L298: prn r1
+L299: inc L352
+L300: dec L347
+cmp *r1, #68
+jsr *r3
+not *r1
+mov #88, L364
+red L367
+cmp *r2, r2
+L301: dec *r2
+inc r2
+L302: prn #-97
+stop
+lea L311, *r5
+jmp L307
+sub #34, L348
+L303: jsr L329
+clr *r5
+L304: cmp *r0, #-11
+; comment
+L305: .string "goybdrvcbkcbneavi"
+not *r4
+
+bne L344
+sub r5, *r1
+jsr L336
+L306: .data 577, 5, -793, -870, -964, 414, 983
+prn L351
+L307: not *r1
+
+L308: .data -931, -319, 980, 461
+rts
+L309: .string "liwhgskhoibqzx"
+jsr *r2
+bne L360
+L310: red *r4
+bne *r7
+L311: inc L355
+add L327, *r0
+inc *r0
+L312: dec *r3
+not *r3
+
+add *r2, r1
+cmp r0, *r3
+red r0
+cmp #66, r1
+sub *r3, *r1
+sub L326, *r1
+dec L347
+L313: not r1
+L314: dec *r4
+red r2
+add *r7, r4
+red r0
+mov L351, r1
+L315: add #114, *r6
+prn *r5
+red r5
+L316: prn r1
+L317: mov L353, r7
+mov #176, r0
+bne *r6
+prn L366
+L318: mov r3, r7
+L319: jmp L326
+L320: .string "x"
+L321: rts
+cmp L329, *r3
+lea L335, *r4
+dec L355
+L322: .data 663, 764, 89, 473, -869
+rts
+add L363, *r7
+jsr L330
+L323: dec L324
+not L340
+L324: .data 261, 318, -557
+mov r5, *r3
+cmp r4, r4
+L325: .string "nezrogltojsvkav"
+lea L354, r2
+L326: .data -938, -123, -185, 822, -280, 520
+inc r2
+mov #-180, *r7
+stop
+bne *r4
+lea L346, L341
+L327: lea L353, *r4
+L328: add L329, L329
+add r2, *r2
+sub *r3, L344
+L329: lea L331, L352
+cmp *r1, *r6
+L330: sub r1, *r3
+bne L349
+jsr L346
+L331: jmp *r5
+jmp *r6
+jmp L342
+L332: .data -444, 800
+red L362
+L333: sub L339, *r7
+not *r7
+L334: sub #-100, L345
+stop
+rts
+lea L352, *r5
+red L339
+bne L364
+jmp L361
+clr L364
+
+L335: sub r0, L357
+jmp *r1
+add L358, *r2
+L336: cmp r2, #7
+clr r6
+; comment
+prn r3
+bne *r5
+L337: bne L355
+bne L344
+L338: jsr L339
+mov #-10, r1
+L339: .data -379, -595, -1000, -939
+L340: rts
+bne L349
+red r3
+bne L351
+not *r4
+stop
+rts
+dec r5
+dec *r5
+L341: red r4
+L342: .data -344, 892, -320, 30, -395, 518
+stop
+jsr L359
+add r3, *r7
+red L360
+; comment
+L343: stop
+bne L353
+L344: .string "jfqvozitpfnc"
+L345: stop
+L346: .data 87, -823
+L347: not L351
+red *r3
+stop
+; comment
+L348: not L367
+L349: not r5
+jsr L364
+bne *r7
+sub *r3, *r5
+rts
+L350: cmp r3, L357
+inc r5
+L351: .string "pbcysdn"
+L352: stop
+not *r5
+L353: prn r3
+L354: .data 643, 141, 485
+L355: lea L359, r3
+bne *r4
+rts
+rts
+prn r3
+inc L363
+clr r7
+L356: mov #-224, L357
+; comment
+stop
+lea L368, *r2
+stop
+prn *r6
+jmp L361
+prn L361
+inc *r5
+inc *r1
+sub *r4, L360
+red *r2
+dec *r6
+L357: stop
+; comment
+L358: inc *r7
+L359: stop
+lea L362, *r5
+red r5
+jmp L362
+cmp L366, r2
+L360: sub *r2, L368
+lea L365, *r6
+
+dec L366
+clr L367
+L361: inc *r2
+jmp *r0
+rts
+L362: jmp *r2
+
+inc r6
+L363: .string "mva"
+
+sub L365, L366
+dec L368
+L364: add L365, *r6
+cmp #-12, r1
+L365: jmp *r3
+L366: prn r7
+L367: stop
+L368: sub *r1, *r0
+stop
@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 33
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+prn L320
+L0: rts
+jmp *r3
+prn L290
+lea L336, L29
+L1: .string "iltwinaqx"
+L2: mov *r2, r1
+bne L159
+red r7
+cmp r6, r6
+cmp r5, L249
+L3: mov #230, L291
+clr L43
+prn L256
+dec r5
+clr *r6
+inc L48
+L4: prn #-133
+dec L24
+L5: inc *r2
+; comment
+prn #-154
+jsr L243
+cmp #99, *r4
+L6: mov #240, r1
+cmp r1, r4
+prn L283
+mov #161, L59
+dec *r1
+prn L54
+red *r6
+add #-248, r1
+bne *r3
+L7: mov *r1, *r1
+L8: stop
+sub *r6, *r6
+jsr *r7
+jsr *r3
+; comment
+mov r5, r3
+not *r6
+L9: .data 128, 941, 181, 103, -595, -323
+rts
+sub L15, r4
+sub L189, *r1
+
+L10: bne *r4
+inc L188
+bne *r3
+jsr *r2
+L11: stop
+rts
+
+L12: lea L56, L335
+jmp *r5
+stop
+L13: stop
+dec L143
+prn #30
+lea L95, r3
+L14: prn *r1
+lea L171, *r7
+L15: dec *r0
+L16: stop
+L17: not *r5
+jmp L224
+; comment
+; comment
+rts
+sub L279, L89
+dec *r2
+red *r6
+L18: .string "nofu"
+dec L168
+add r0, r6
+jmp L330
+sub L42, L275
+add *r0, r6
+L19: .string "pxlcczpqtyahjiqzhutm"
+L20: .string "u"
+add L202, L313
+
+rts
+clr L99
+sub *r7, L281
+L21: jmp *r4
+L22: jsr *r3
+mov L258, r7
+jmp L28
+L23: not L87
+dec L198
+inc L309
+sub r0, r3
+stop
+prn *r2
+dec *r5
+L24: bne L316
+L25: rts
+add L96, L36
+L26: .string "psgdoptqeixyndmwafcu"
+not *r4
+bne L216
+L27: prn r3
+lea L229, L235
+clr r6
+jmp *r6
+not L288
+L28: .data -923
+jmp *r7
+mov r0, L210
+clr r1
+
+stop
+add r2, L269
+L29: jmp L185
+prn L63
+lea L84, *r5
+stop
+red r6
+jsr *r6
+not *r5
+L30: .string "vtibyzhxxd"
+jsr L337
+prn *r3
+L31: .data -707, 66, -986
+add L175, L39
+dec r1
+L32: lea L225, L193
+L33: .string "svziqaveefrwrzmzfyopx"
+jsr L337
+prn #-182
+prn #30
+L34: rts
+prn r5
+rts
+L35: .string "hnkwjpjwvixgzdicnis"
+lea L208, *r1
+not *r5
+inc r6
+stop
+mov *r3, L309
+not L311
+sub #37, r2
+inc r5
+add #-122, r4
+prn #-154
+dec L48
+jsr L93
+; comment
+inc *r6
+red r7
+L36: sub *r2, *r4
+inc L101
+jmp L209
+add *r7, r7
+L37: .string "txkjzqybcyvigr"
+L38: .string "p"
+L39: dec r1
+red L77
+stop
+; comment
+jmp L210
+L40: mov r0, *r2
+bne L111
+L41: .data 960, -879, -139, 413, 557, -161, -46, -509
+mov L285, L335
+L42: red L65
+lea L183, r5
+L43: dec *r6
+L44: mov #180, r3
+not *r7
+inc *r3
+L45: red r4
+L46: .data -231
+L47: lea L322, r3
+L48: add r7, L212
+L49: rts
+
+mov #-226, *r5
+L50: .string "zxzusnuvnnrjho"
+not *r1
+L51: rts
+
+L52: rts
+L53: stop
+L54: lea L113, L60
+stop
+L55: rts
+L56: lea L90, L99
+clr r0
+L57: stop
+mov #173, r0
+L58: stop
+L59: rts
+red r2
+L60: .string "ktzvuwevcj"
+not r3
+L61: .data -966, -842, -636, 742, -334
+L62: not L337
+lea L178, L265
+bne L312
+L63: sub r1, r6
+L64: inc L210
+jmp *r7
+L65: lea L246, *r0
+inc r4
+L66: jmp L294
+rts
+prn #-107
+dec L239
+
+L67: .string "d"
+add r2, r0
+jmp *r3
+lea L130, L109
+jmp L90
+red r2
+red r1
+dec *r0
+jsr L165
+L68: .string "svfrwwg"
+mov r5, L204
+bne L285
+L69: rts
+L70: dec *r5
+jmp L121
+; comment
+L71: mov #-75, L198
+add *r4, *r4
+dec L158
+prn L255
+lea L313, L328
+jsr *r4
+lea L127, *r6
+prn #-108
+add L186, L97
+add #-56, L237
+stop
+rts
+sub *r7, *r3
+L72: jsr *r4
+bne *r1
+red r5
+jmp L306
+mov #71, *r6
+clr L275
+L73: .data 170, -483
+bne *r2
+L74: .data 12, 372, -769, 195, 481, -670, -897
+sub r1, *r0
+L75: .data 243, -178, -11, -930, 337, -523
+jsr L115
+L76: dec r6
+cmp r7, r3
+bne L259
+L77: .string "jjenkcran"
+L78: bne *r1
+clr r4
+rts
+rts
+inc L168
+mov L251, *r0
+mov L140, L236
+bne *r3
+rts
+not r3
+L79: .data 221
+L80: .data 225, 123, 458, 374, -600, 391
+not r7
+L81: not *r4
+jsr *r7
+add *r7, r6
+stop
+mov #28, r0
+lea L274, L231
+; comment
+cmp r2, *r0
+jsr L256
+add r3, L309
+dec L210
+L82: .data 37, 746, -206, 897, 483, 94, 733
+mov L148, *r7
+L83: .string "gogmrondbwizgc"
+L84: rts
+dec r5
+add #133, L328
+L85: bne *r4
+L86: bne *r6
+bne L182
+prn *r0
+dec L332
+L87: rts
+L88: lea L223, *r0
+add r4, *r5
+L89: clr L94
+L90: clr r7
+clr *r0
+not *r1
+clr r3
+bne L228
+L91: mov #-37, L138
+lea L228, *r3
+clr *r1
+sub r7, r2
+L92: mov L253, L131
+mov r1, L137
+dec r5
+L93: dec L155
+bne L197
+L94: not r7
+L95: cmp L244, #-240
+dec *r0
+L96: not r0
+sub #245, r6
+mov r0, L316
+L97: .string "vrpvzrxsxxwfcpenofgrzys"
+inc r3
+L98: .data -433, -400, 43, -744, 345, -514
+L99: clr r2
+rts
+
+L100: not *r0
+add #58, r1
+jsr *r7
+sub L162, L198
+cmp *r3, r5
+sub L318, r7
+clr *r4
+L101: red L185
+inc L152
+mov r4, L117
+inc L206
+rts
+jmp *r6
+dec L251
+L102: mov #-108, r5
+clr L259
+jsr *r4
+stop
+L103: rts
+not r2
+
+L104: cmp #-111, #-39
+stop
+lea L162, L247
+jsr *r5
+add *r1, *r0
+stop
+add L159, L301
+L105: sub r5, r0
+mov #-90, L252
+; comment
+jmp *r1
+L106: cmp *r3, r1
+L107: not *r0
+L108: jmp *r3
+red r7
+L109: jsr *r6
+jsr L167
+dec *r5
+dec r0
+L110: clr L285
+L111: clr *r3
+add *r2, *r3
+L112: .string "npxecmrpuuvqoj"
+jsr L129
+bne L335
+L113: .data 101, 228, 169, 639, -999
+L114: mov *r1, r3
+clr r3
+L115: lea L137, r4
+rts
+rts
+L116: dec r6
+clr L281
+L117: sub #-82, r6
+L118: .data 206, 820, -853, 168, 756, -177
+not *r3
+clr L261
+L119: .data 489, 204, -841, -46, -134, 307, -669, 914
+not *r0
+L120: .data 464
+L121: bne *r5
+L122: lea L226, r7
+not r1
+L123: mov r3, L149
+not r5
+lea L290, L179
+not r3
+not *r3
+red L335
+mov r7, r2
+L124: .string "nwvgqumwiood"
+cmp *r5, r7
+mov *r2, r4
+bne L202
+L125: add L145, L186
+jmp L319
+mov r6, *r3
+bne L282
+L126: clr L191
+L127: lea L246, L288
+add r2, *r2
+jmp L276
+L128: lea L176, L219
+L129: not L235
+prn L201
+L130: .data -128, 576
+; comment
+not r3
+clr *r2
+L131: jsr L219
+L132: .string "znmpeffeopd"
+not *r2
+prn L313
+stop
+red r2
+L133: dec L248
+lea L330, *r1
+L134: .string "nyzeowoiubmpaztd"
+L135: prn r3
+L136: jsr L163
+bne *r0
+sub #-191, L177
+L137: prn #47
+L138: stop
+jmp *r4
+red L311
+L139: cmp #-197, *r3
+L140: inc *r0
+bne L311
+inc *r4
+mov r5, L274
+L141: rts
+inc *r1
+L142: cmp L194, r1
+dec *r7
+stop
+cmp *r0, #-191
+; comment
+L143: not r6
+jsr *r1
+L144: .string "jmatatpjeiskttmphdrb"
+L145: jsr *r5
+L146: mov r1, r5
+prn *r5
+not L211
+mov r3, r1
+red L236
+L147: .string "lbyn"
+L148: jsr *r6
+L149: .data -478
+dec *r2
+inc r2
+not r7
+inc r7
+stop
+bne L307
+L150: red r6
+rts
+clr r5
+clr L285
+clr *r6
+L151: clr *r2
+L152: .string "zheyglagoru"
+mov #-74, L210
+clr r5
+jmp *r4
+L153: jmp L289
+rts
+sub L188, *r2
+L154: not r4
+add r5, *r0
+red L183
+red *r2
+L155: mov *r4, *r1
+sub *r5, r3
+jmp *r6
+jsr *r6
+dec L292
+lea L330, *r0
+L156: rts
+rts
+L157: .string "px"
+bne *r7
+mov *r0, L198
+L158: .string "nevpfjlvbojicejfpghog"
+mov L256, r1
+jsr *r3
+inc *r5
+; comment
+L159: jmp *r3
+L160: sub r6, L168
+; comment
+L161: jsr *r4
+L162: prn r1
+; comment
+L163: sub *r4, r0
+rts
+lea L179, L174
+L164: inc r7
+red L216
+bne *r0
+; comment
+L165: rts
+L166: not L227
+L167: red L273
+jmp *r5
+L168: jmp *r1
+rts
+jsr *r5
+add *r2, r3
+rts
+clr r1
+red r4
+mov L195, L316
+not r0
+L169: .data 63, 759, -108
+stop
+L170: rts
+mov #14, r3
+cmp L325, *r5
+L171: jsr L175
+L172: .data 452, -19, -137, -153
+L173: clr r0
+dec L323
+L174: .string "q"
+
+L175: .data 243, -325, 44
+cmp r5, #237
+L176: jmp L203
+L177: .string "xuhrtt"
+L178: cmp *r3, L227
+sub #76, L294
+bne L336
+
+L179: add #-42, *r0
+L180: jsr L190
+L181: prn r5
+mov L325, r7
+clr r1
+clr *r3
+L182: cmp L257, r4
+jmp L227
+L183: clr *r2
+L184: red r1
+bne *r3
+L185: rts
+L186: jsr *r3
+jmp L259
+add L259, r2
+L187: inc *r2
+inc *r5
+add *r1, *r3
+rts
+not r3
+not L245
+stop
+jmp *r5
+jsr L295
+add *r7, r4
+mov r0, *r2
+not r5
+rts
+L188: rts
+L189: bne L299
+clr *r1
+L190: bne L298
+bne L317
+L191: sub #235, *r0
+L192: .string "ihmyndt"
+L193: .data 58
+L194: mov *r4, *r2
+L195: .string "itylboptybvrrcvcnyjitj"
+sub r1, r3
+L196: jmp *r5
+L197: inc L217
+not *r1
+stop
+L198: bne L250
+add L294, r4
+L199: red r6
+prn L332
+not r7
+L200: inc *r6
+L201: .string "xurxtpbpqfq"
+clr L298
+L202: sub L294, *r3
+L203: prn *r5
+mov r7, L323
+jmp *r4
+clr r1
+red L308
+cmp *r2, #21
+cmp #216, *r4
+L204: stop
+prn *r3
+rts
+stop
+inc r1
+rts
+L205: rts
+jmp L289
+rts
+L206: rts
+L207: add r2, r2
+cmp L293, r5
+rts
+L208: mov #143, *r7
+dec r3
+L209: .data -508
+mov r0, *r4
+clr r3
+L210: cmp L227, #114
+L211: lea L237, *r6
+inc L233
+L212: jmp *r0
+jsr *r4
+lea L305, r2
+L213: jmp *r0
+L214: jmp L217
+mov L216, r7
+rts
+L215: mov #93, r1
+dec L241
+L216: sub #88, *r7
+cmp r4, #34
+L217: jsr *r7
+rts
+cmp #93, r4
+clr L305
+
+L218: add *r7, L308
+inc L243
+L219: jsr L255
+L220: jmp *r1
+L221: sub r6, *r1
+bne L275
+clr r1
+; comment
+sub r5, L248
+rts
+jmp *r4
+L222: .data -105
+bne *r5
+L223: clr L229
+inc r5
+add r6, L260
+; comment
+L224: lea L250, r0
+stop
+L225: clr L234
+stop
+L226: jmp *r7
+mov #-135, *r5
+; comment
+lea L288, L273
+L227: .data -355, 587, 691, 665, 329, 880
+L228: mov #8, *r2
+add r7, r0
+bne L313
+dec r1
+sub r6, *r6
+lea L271, L325
+L229: red L266
+rts
+L230: .string "sopdimzshialqqfcqglotqd"
+mov #-217, L334
+jmp *r2
+
+jmp *r0
+inc *r3
+red L275
+prn *r1
+prn L277
+bne L335
+clr r1
+bne L335
+add #-55, r7
+L231: .data -101, 982, -789, 130, -877, -918, 376, -51
+clr L290
+L232: prn L233
+L233: jsr *r7
+L234: clr r5
+lea L309, L292
+cmp L313, r3
+dec L280
+L235: jmp L316
+sub #214, *r6
+stop
+sub r4, r2
+mov *r3, L278
+mov r6, r0
+prn L244
+sub #86, r5
+L236: not L316
+add *r5, L297
+rts
+L237: stop
+lea L296, r2
+L238: not r0
+L239: not *r7
+stop
+L240: .string "sdvrazgbffjvbw"
+bne *r7
+add #-174, r6
+L241: not L324
+mov #-153, L259
+sub #-48, *r4
+lea L320, r5
+clr *r0
+jsr L291
+inc *r2
+L242: jmp *r2
+cmp #-235, #139
+bne *r3
+L243: .data -621
+cmp #72, r0
+cmp L318, r6
+L244: .string "viuhiungffnvtcrzfwjf"
+dec L334
+L245: clr r2
+prn *r6
+rts
+not *r6
+L246: not L336
+dec L258
+stop
+L247: .data 905, -188, -169, -604
+L248: sub #7, L262
+dec *r4
+prn #250
+L249: sub *r7, r7
+L250: dec *r0
+add r7, *r3
+L251: lea L327, L277
+sub r6, *r2
+mov *r2, L311
+not *r4
+L252: .string "ecgxqlgujziyifpzuufz"
+add r7, r1
+not *r6
+clr r2
+red *r5
+jsr *r3
+L253: .data -261, 869, -102, 348, 100, 742, -317
+L254: inc L264
+rts
+red *r7
+add *r4, *r7
+clr L313
+L255: bne *r7
+cmp L333, *r3
+jsr *r6
+cmp L303, *r0
+rts
+L256: add #-153, *r7
+L257: lea L332, *r4
+not r2
+bne L335
+dec L297
+mov r2, L283
+L258: jmp L318
+L259: add r5, *r0
+L260: inc r1
+cmp #-154, *r5
+L261: inc *r4
+L262: inc r5
+red r6
+L263: jmp *r1
+cmp *r2, L301
+mov #-37, L308
+rts
+not L332
+dec r0
+L264: .string "hdqwtjmxaoaljmcwamhmcdf"
+prn L323
+jmp *r7
+bne L300
+L265: clr *r3
+L266: not *r6
+bne *r6
+rts
+cmp #180, *r1
+rts
+stop
+dec L281
+dec *r6
+dec L328
+dec L307
+L267: cmp r5, *r2
+stop
+bne L285
+prn *r2
+inc L278
+add #169, L331
+inc r7
+sub *r0, L303
+sub L338, L328
+jmp *r5
+rts
+L268: jsr *r7
+inc *r5
+stop
+jmp L318
+inc L296
+inc L323
+jmp L286
+jsr *r2
+dec r6
+L269: .string "mrdiwh"
+cmp r3, L285
+
+add #170, r3
+L270: jmp *r7
+
+cmp r5, r3
+L271: cmp r5, *r4
+L272: cmp L308, *r4
+stop
+cmp L305, r4
+jsr L333
+L273: .data -202, -214, 114, -825, -802
+L274: bne L315
+L275: add *r4, *r2
+prn L306
+red *r4
+rts
+L276: .data 334, -522, 138, -779
+stop
+L277: stop
+clr r7
+L278: .data 616, -511
+add #-10, L326
+clr L322
+L279: stop
+L280: not L298
+
+L281: jmp L333
+L282: sub L318, r4
+dec r1
+mov #59, L307
+not *r0
+inc r7
+L283: sub *r2, *r4
+jmp *r1
+red *r0
+mov #160, L290
+; comment
+inc *r4
+L284: stop
+L285: mov r6, r3
+sub r3, *r4
+sub #-18, r4
+L286: .string "i"
+L287: .data -173, -919, 910, -996, -2, -379, 733
+rts
+stop
+jsr L293
+prn *r0
+jmp L328
+; comment
+L288: add *r7, L290
+L289: prn *r6
+L290: .string "hkzfkiijxjkq"
+not r1
+jsr *r0
+mov L312, *r4
+mov r5, *r0
+prn r7
+bne *r3
+cmp r6, *r7
+bne L325
+jsr *r7
+jsr L333
+rts
+add *r2, L319
+L291: rts
+L292: .string "ddwvoifvbtn"
+add #-60, L305
+rts
+L293: rts
+L294: prn *r1
+bne *r4
+inc *r0
+dec r1
+jsr *r1
+cmp *r4, r6
+add L324, r7
+sub *r7, r0
+red L301
+rts
+L295: sub L332, *r5
+L296: add *r3, r0
+L297: jsr *r5
+dec L311
+L298: rts
+L299: .data -203, -939, -315, -246
+inc r4
+L300: .string "nbtjcfrcjia"
+sub r6, L307
+jsr L324
+red r3
+inc r1
+inc *r3
+inc r1
+sub *r6, L322
+L301: dec L313
+; comment
+jsr *r0
+L302: clr *r4
+inc r5
+L303: stop
+L304: red L318
+cmp r2, #-221
+cmp *r2, *r7
+jmp *r0
+cmp *r7, r4
+cmp r6, *r3
+L305: .string "skefpved"
+L306: cmp #198, L319
+L307: cmp r5, r3
+L308: jsr *r4
+
+rts
+cmp L338, *r3
+L309: not *r0
+clr L321
+
+clr *r4
+L310: prn r5
+stop
+not r6
+prn L324
+dec L337
+clr r1
+L311: .data -875, 50, -669, 815, 63, -809, 47
+L312: not r4
+cmp r0, #-10
+L313: .string "ltccezc"
+L314: jsr *r1
+jsr *r0
+rts
+L315: .string "pkluyrcsxostpkb"
+clr *r0
+dec *r0
+L316: lea L317, L322
+L317: .string "aofntyflyiycxeypbmofzssx"
+L318: bne L333
+lea L333, L328
+L319: add r6, *r7
+L320: rts
+L321: inc *r4
+stop
+L322: clr *r0
+add *r7, L332
+L323: inc *r3
+L324: dec *r5
+prn *r6
+not L333
+rts
+prn L331
+jsr *r1
+L325: not r0
+mov *r3, r6
+rts
+L326: dec r7
+prn #216
+stop
+clr r2
+not r6
+L327: jmp *r2
+red L333
+L328: clr *r3
+L329: dec L338
+lea L337, r1
+add L332, L334
+sub r3, r0
+rts
+add r6, r0
+L330: lea L332, r0
+inc L333
+L331: dec *r2
+prn r4
+lea L337, L335
+L332: dec *r0
+not L336
+L333: red *r6
+L334: sub L337, r0
+L335: .string "bbfsshhc"
+L336: stop
+rts
+rts
+inc L337
+rts
+jsr L337
+L337: .data 436, -66, -780, -926, 487, 253, -573
+mov L338, r0
+jmp L338
+L338: rts
+stop
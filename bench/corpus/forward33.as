@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 34
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+sub *r0, L203
+
+L0: inc r6
+L1: add #212, *r5
+clr *r6
+L2: add r0, r2
+L3: .string "yvukptojsgncch"
+not r6
+add #149, *r7
+jsr L256
+L4: .string "rx"
+; comment
+jsr L305
+L5: .string "aoqvst"
+L6: .data 836, 684
+jsr *r1
+L7: .string "grrhkbb"
+bne L204
+jmp L233
+rts
+sub r2, *r5
+sub r2, *r3
+L8: rts
+jmp *r1
+not *r1
+L9: .data -614, -26, 319, 235, -706
+L10: .string "idaprxegoirqfyrnqecvgpf"
+L11: red L268
+sub L173, *r6
+lea L299, *r6
+inc L115
+rts
+red *r7
+L12: sub #-246, L67
+mov L222, L295
+L13: not r2
+L14: mov r0, L39
+lea L287, *r2
+jsr L192
+; comment
+jsr L40
+L15: jmp L73
+inc *r0
+rts
+L16: jsr L213
+L17: .string "emargmhypswoytb"
+stop
+bne *r3
+L18: mov L141, *r5
+L19: .data 959, -358, -94
+L20: inc *r1
+add #-60, r4
+cmp r7, r4
+stop
+L21: clr L252
+sub #-5, *r7
+prn r6
+jsr L110
+L22: jmp L209
+L23: .string "kudmqjcrxvaduayuf"
+L24: add L155, L141
+not L133
+sub L144, L156
+dec r5
+L25: inc L217
+red r5
+L26: clr *r6
+L27: lea L324, L51
+clr L70
+jmp L250
+dec L139
+L28: not L256
+lea L208, r5
+mov *r3, r0
+stop
+prn *r5
+dec *r7
+mov *r2, *r1
+
+inc r6
+prn r4
+red *r1
+L29: .string "pgdcsjepuikfxqez"
+not r3
+clr r2
+cmp r0, #-42
+L30: stop
+add L270, L217
+jmp L172
+red r5
+rts
+clr L147
+not *r3
+L31: .string "sxrupkho"
+rts
+L32: .data -707, 934, -53, 818, -714, -277, 587, -788
+inc r2
+sub r7, r6
+cmp L295, *r0
+prn *r1
+inc *r3
+not *r0
+bne L212
+clr r7
+L33: .string "umjlkowycvlbykluwmgesbbm"
+L34: .data -938, -622, 603, -164, 103
+L35: .data 103, 186, -332, -935, -909, 15, 873, -917
+jsr *r6
+not L231
+sub #16, L306
+L36: .data -943, 62, -197
+L37: .string "lbg"
+dec *r2
+inc *r3
+bne L117
+cmp *r3, L169
+rts
+dec *r6
+not L137
+cmp L212, *r0
+L38: jmp L316
+L39: clr *r0
+not L122
+jsr L327
+rts
+rts
+L40: rts
+red *r5
+stop
+L41: inc L236
+red *r1
+lea L150, r6
+L42: cmp r1, #-100
+dec r2
+cmp *r5, *r7
+L43: jsr L249
+red L230
+L44: jmp *r2
+clr *r6
+jmp L316
+cmp r0, L47
+inc L45
+sub L53, *r0
+add r1, r6
+stop
+cmp L307, L161
+jmp L190
+add r3, r2
+; comment
+red r4
+not r5
+L45: .data -570, -327, -268, -911, 229
+L46: red r1
+L47: .string "mzwkrgtbmcixazlheak"
+
+red r1
+
+L48: rts
+clr r2
+rts
+stop
+L49: .data -685, -546, 446, 585, 663, -588, -350, -46
+L50: .data 712, -262, 594
+jmp L147
+clr L270
+cmp #203, #-238
+bne *r7
+jsr *r3
+L51: sub r2, r0
+L52: stop
+L53: .data -766
+L54: sub *r7, L209
+L55: prn #-156
+prn L257
+stop
+inc r5
+L56: .string "mgcjl"
+L57: .string "yibeqef"
+L58: .data -970, -671, 110, -268, 485, 702
+bne L129
+L59: .string "taciseuhxwdl"
+L60: add #223, L307
+L61: cmp *r6, r2
+bne *r0
+L62: .data -843, 532, -990
+L63: red *r4
+L64: mov #154, *r0
+rts
+not L240
+L65: .string "idoogmoebo"
+bne *r1
+jsr *r0
+dec *r7
+L66: .data 518, 349, -629, -6, -372, -991, -245
+not r2
+L67: dec L131
+cmp *r3, *r2
+jsr L292
+L68: lea L71, r7
+not r7
+not *r3
+L69: lea L298, *r3
+L70: .data -243, 862, -676, 630
+sub #115, r4
+stop
+rts
+L71: jmp *r7
+rts
+inc *r0
+dec *r1
+L72: add *r5, L78
+jmp L188
+dec r2
+L73: rts
+mov #-218, *r7
+jmp *r7
+jmp *r5
+clr r2
+jmp L293
+stop
+red *r6
+sub #62, L89
+lea L160, *r7
+L74: .string "qkvufunyfu"
+mov #-224, *r4
+L75: add #33, L242
+inc L158
+stop
+red r3
+L76: add L135, r4
+dec L176
+L77: not *r5
+lea L135, r1
+L78: .string "ajymcamftkokcclgwjdr"
+red r5
+
+add r5, L280
+L79: bne *r4
+clr *r2
+add r0, *r5
+red L212
+L80: .string "zcwr"
+mov L135, *r7
+prn *r7
+stop
+jsr L164
+L81: .string "zxr"
+stop
+L82: cmp #234, *r5
+inc L268
+L83: dec L205
+dec r2
+red *r1
+inc *r7
+jsr *r2
+dec r1
+L84: .data 870, 198, -76, -676, -546, -675
+stop
+rts
+cmp #69, *r1
+L85: dec r7
+L86: bne L128
+inc L234
+rts
+
+lea L197, L337
+jsr *r5
+L87: not *r7
+L88: bne L243
+red r3
+mov L90, *r5
+bne L304
+not *r7
+sub #153, L297
+jmp L188
+add r6, L123
+L89: jsr *r2
+sub r5, L262
+L90: cmp r6, L314
+L91: inc *r4
+jsr *r7
+L92: .data -693, 672, 361, 909, -452, 826
+L93: mov L270, *r1
+jsr L283
+dec *r6
+inc *r1
+L94: rts
+L95: mov L107, L310
+L96: .data 741, -177, -721, 3, 283, 449, -770, 961
+L97: inc r6
+jsr *r4
+L98: sub L232, L285
+lea L251, *r6
+cmp L105, r6
+bne L123
+dec L229
+L99: .data 837, -276, -353, -576, -898, -508, 309, -498
+; comment
+L100: sub #42, L183
+add L115, L249
+jmp *r3
+L101: red r4
+clr r3
+L102: sub #150, *r6
+L103: .string "drauhhjuwdvwigefzt"
+jsr *r3
+rts
+jsr L315
+cmp *r6, L251
+; comment
+L104: .data 450, 55, 635, -750
+cmp L126, #-160
+bne L173
+rts
+L105: jsr *r7
+dec *r0
+jsr L216
+inc L341
+L106: mov #-44, L136
+prn #188
+L107: .string "abwbshg"
+L108: not L203
+mov *r7, *r0
+not L177
+lea L188, *r7
+bne *r1
+mov #173, L129
+stop
+clr r6
+prn r6
+dec r5
+dec L340
+prn L148
+L109: .string "zwbrpsdonbcm"
+prn *r6
+bne L181
+L110: clr *r5
+jsr *r2
+inc *r5
+L111: inc r0
+L112: stop
+
+L113: bne *r1
+L114: .string "ddooeyuhtayqjrn"
+L115: .string "cpyqwunlywpqts"
+L116: sub L326, L289
+; comment
+jmp *r7
+jsr *r2
+cmp #-130, #-29
+lea L127, *r4
+L117: not r3
+L118: bne L295
+sub *r6, r2
+clr r5
+rts
+
+mov r5, L179
+not L255
+prn #-69
+rts
+add L272, r5
+L119: jsr L261
+L120: .string "ykhbqfsnzdvzboptapree"
+L121: .data -774, 215, 670, 572, 47, -714, -766
+prn r4
+red r7
+mov #149, *r0
+L122: .data 101, -258, -298
+inc L161
+lea L262, r5
+inc r4
+mov #201, *r6
+rts
+L123: dec r5
+L124: jsr L129
+
+L125: dec r5
+dec r5
+not L140
+L126: stop
+L127: .data 218
+L128: jmp *r1
+L129: jsr L247
+jmp L222
+sub r1, L327
+jmp *r2
+cmp L332, *r5
+L130: clr r3
+clr r7
+stop
+jsr L254
+not L167
+sub L295, *r4
+mov L181, *r6
+cmp *r2, L267
+
+L131: mov *r0, L155
+L132: red L338
+L133: mov *r6, r4
+add #24, *r6
+L134: stop
+inc r6
+L135: .string "biwagqcuvzviduro"
+L136: jsr *r1
+L137: .string "oudupwsuvxelzmmtju"
+L138: add *r5, r2
+lea L231, *r5
+sub r6, L233
+sub r3, L172
+L139: .string "pmppuxa"
+L140: not r3
+dec r6
+inc r0
+stop
+clr L233
+red L314
+cmp L186, *r7
+rts
+prn #-107
+L141: .data 17, -485, 238, 228
+L142: stop
+L143: mov #160, L168
+L144: .string "oowxaaurnghprkogezuxwgnn"
+inc L279
+inc r1
+bne L245
+bne *r1
+lea L300, *r2
+red r6
+jmp L229
+jsr *r7
+dec L235
+prn *r0
+cmp *r3, #166
+inc L254
+stop
+prn #-196
+rts
+lea L166, r6
+
+
+L145: mov L271, *r2
+L146: sub #87, *r7
+L147: cmp #-236, r5
+stop
+jmp *r6
+L148: clr *r1
+sub r5, L168
+bne *r1
+dec L273
+lea L263, r2
+L149: not r4
+L150: rts
+L151: lea L295, *r5
+L152: .string "anamhuzpogurrkhimipohs"
+
+mov r7, *r7
+rts
+L153: not r4
+not *r4
+prn *r4
+L154: clr *r2
+L155: .data 588, 834, 289, 722
+cmp r6, r5
+dec r6
+L156: add r4, L317
+lea L258, r2
+lea L284, r4
+red *r1
+stop
+jmp L249
+add *r6, r5
+sub #7, *r0
+L157: add *r1, *r5
+bne *r0
+cmp #-126, L298
+L158: inc *r6
+rts
+jsr L255
+stop
+stop
+inc L179
+stop
+clr r4
+L159: .data 418, 503, -426, 983, 84, -866, 451, 136
+cmp #-93, #-103
+sub #9, L251
+add L303, r5
+jmp L174
+L160: inc L341
+jsr L318
+sub *r6, L263
+
+clr L334
+jsr L220
+bne L168
+L161: lea L162, *r4
+L162: inc *r3
+L163: jmp L300
+sub #78, L220
+L164: jmp L214
+mov #-89, r6
+red r5
+L165: prn L276
+L166: dec *r5
+prn r6
+lea L175, *r3
+mov #6, r4
+jsr L292
+clr r6
+L167: .data -837, 728, -678, -41, 284
+cmp *r1, L285
+sub #-11, *r0
+L168: prn *r1
+L169: prn L272
+lea L193, r6
+L170: mov *r0, *r4
+clr L252
+jsr L200
+add L206, r6
+red L262
+mov L179, r2
+inc *r5
+L171: lea L197, r4
+clr r7
+not r3
+clr r1
+L172: .string "nmrjmjnlglxjbjajdfhtm"
+L173: clr *r7
+L174: inc L254
+dec *r0
+; comment
+rts
+bne L265
+not *r5
+sub L214, *r6
+L175: jsr *r1
+dec *r0
+L176: prn L203
+prn L214
+add *r0, L221
+L177: prn #-200
+L178: prn r6
+not L292
+L179: not L336
+L180: red *r7
+sub #-61, r3
+add L256, *r4
+L181: dec *r5
+dec L238
+sub *r6, L211
+L182: jmp *r7
+not *r3
+L183: .data 985, -53, 584, -114, -640, 755
+L184: not L270
+add r1, r7
+; comment
+L185: jsr *r5
+prn *r2
+inc *r7
+L186: clr *r4
+L187: clr *r6
+bne *r5
+dec r4
+L188: .string "ybxapspjybfemufw"
+jsr L290
+jsr *r3
+jmp L231
+rts
+L189: .data 143, 207, 194, -408, -488
+L190: lea L271, r2
+clr *r6
+sub r0, r7
+cmp #199, #-143
+L191: jmp *r6
+L192: add *r0, *r2
+
+L193: lea L278, r3
+mov #125, L209
+L194: jsr *r6
+inc *r3
+L195: dec r5
+inc L333
+cmp #223, *r7
+L196: inc r5
+sub r6, *r1
+add L322, *r6
+rts
+not r1
+inc L221
+red r3
+lea L221, L260
+L197: lea L253, L248
+clr *r7
+dec *r7
+red *r0
+L198: prn *r0
+L199: .data -434
+L200: .data 180, -289
+rts
+inc r2
+jmp *r6
+sub r1, *r5
+mov *r4, L251
+L201: stop
+bne *r2
+mov L309, *r5
+bne *r5
+mov *r0, r4
+L202: not r3
+dec *r7
+jsr *r6
+L203: bne *r5
+mov r6, *r4
+L204: mov L311, L235
+rts
+not *r2
+jsr *r2
+L205: prn #-121
+not r1
+add L217, *r1
+L206: cmp r0, #113
+L207: rts
+inc r5
+cmp L298, #-238
+L208: jsr L226
+not L293
+red r0
+stop
+not L304
+L209: mov *r3, L301
+not r6
+clr L330
+; comment
+L210: .string "ucilfytpbfhynyaxjlmkdy"
+bne L293
+L211: cmp r2, #-79
+cmp r1, #-9
+L212: add #-196, L281
+sub *r1, *r7
+stop
+sub r2, *r2
+L213: .string "aahgjkcjanjfoqankliesqqm"
+rts
+L214: .string "mcbjkrvxyybhjgktd"
+add *r4, L304
+L215: .data 779, -514, -414, -208, 286, 590, 974, 256
+L216: sub r5, L219
+cmp r7, *r6
+L217: not L238
+; comment
+lea L285, r1
+sub r3, L239
+red *r1
+L218: rts
+L219: jmp *r0
+lea L339, L226
+rts
+cmp #57, *r6
+bne L340
+stop
+dec L321
+red L227
+mov L228, r2
+L220: red L316
+L221: lea L235, r6
+rts
+L222: not *r1
+jmp L241
+dec L324
+jmp *r0
+L223: .string "uqzfjlixaghj"
+prn #-24
+inc *r0
+mov *r2, *r3
+jsr L341
+dec r3
+L224: mov #-250, *r7
+bne L275
+L225: jmp *r6
+L226: clr r6
+inc *r5
+not *r5
+L227: prn #29
+L228: .string "tisckawrcewmccfwaghjpi"
+L229: bne *r7
+L230: cmp r1, r5
+jmp *r1
+L231: .data -880, -847, 553, 964, 430, -275, -712, 460
+L232: dec L321
+lea L281, *r6
+L233: bne *r2
+not L282
+jmp *r4
+rts
+L234: red *r1
+jsr L317
+; comment
+lea L296, L286
+L235: lea L318, *r1
+jmp *r1
+inc r2
+rts
+stop
+mov L291, r1
+lea L240, r7
+; comment
+jmp *r4
+inc r3
+L236: rts
+bne L249
+L237: .data 573, -243, 806, 905, 627, -34
+cmp #-67, #8
+jsr L275
+red *r1
+cmp L296, r3
+L238: clr r1
+clr L306
+L239: .string "zsii"
+L240: prn L340
+not L270
+lea L258, r7
+bne L254
+add *r2, r2
+L241: not *r0
+L242: cmp L271, L252
+L243: not *r5
+inc *r1
+jmp L249
+lea L285, L326
+L244: add #37, *r5
+L245: add #94, L297
+L246: jsr L259
+jmp *r0
+L247: not r0
+mov L258, *r4
+jmp *r6
+
+inc L288
+; comment
+L248: .string "otxcumuybljxhqilzrhb"
+dec L286
+prn L326
+L249: lea L254, L303
+L250: .data -136, -327, 122, 875
+L251: bne L341
+L252: prn *r0
+L253: sub *r1, *r2
+not r2
+L254: add *r4, L281
+add #127, L303
+clr r4
+jsr *r5
+dec *r1
+L255: .string "zkyqxzpauoobqlsfeejpb"
+red *r7
+dec *r5
+L256: .data 655, -401, 775, 855, -70, 622, -645, 432
+L257: mov *r1, *r2
+jsr *r0
+dec *r0
+stop
+jsr *r5
+L258: add L320, r7
+mov #32, r0
+red L306
+stop
+L259: .string "qvcewfftknytvmljxavl"
+sub #-44, L300
+L260: stop
+red r4
+prn r7
+L261: jsr *r7
+L262: .data 443, 164
+rts
+L263: not r5
+red L296
+jsr *r4
+L264: not r2
+lea L313, L265
+mov #-34, *r4
+bne *r7
+jsr L278
+sub L303, *r3
+stop
+mov *r5, L288
+lea L329, L340
+L265: clr L339
+L266: .string "b"
+stop
+stop
+L267: lea L314, *r0
+mov #-170, r4
+lea L270, L338
+clr r7
+not r7
+jsr L290
+not L312
+rts
+red *r4
+L268: prn #-132
+L269: jsr *r1
+bne L340
+lea L277, L298
+L270: .string "byjbfrqimcdtsacnd"
+L271: .data -565, 604, -66, 541
+mov L329, r0
+L272: bne *r5
+; comment
+L273: add #115, *r2
+jsr L331
+mov *r7, r1
+clr L327
+L274: sub r7, *r1
+L275: bne *r1
+L276: .data -361
+jmp L336
+lea L284, *r7
+L277: dec *r3
+L278: add L279, r0
+L279: mov #-183, *r2
+L280: jmp L288
+; comment
+; comment
+jmp *r0
+clr L301
+stop
+L281: bne L320
+L282: .data 523, 45, 912
+add L341, L323
+dec *r4
+
+L283: red *r2
+prn r7
+dec L309
+stop
+red L321
+mov #-46, r2
+dec *r3
+sub L310, *r6
+inc L289
+L284: .data 309, -118, 423, 959, -519, 89, -836
+L285: .data 601, 922, 451, 757
+L286: inc *r7
+cmp *r0, L307
+L287: .string "jiaexfkefhyhjsgepwjumt"
+L288: .data 786, -852
+jmp *r3
+lea L315, r6
+dec r7
+jmp L299
+bne L332
+red L299
+L289: jsr L328
+L290: stop
+L291: red L302
+rts
+L292: not r7
+L293: mov *r0, *r3
+L294: stop
+L295: rts
+not *r7
+prn r6
+bne L324
+sub L303, r2
+L296: cmp r6, L329
+inc L300
+L297: red L321
+inc L302
+stop
+cmp #-84, r1
+clr r5
+stop
+not *r4
+sub #140, L309
+clr r6
+add #-228, r0
+
+L298: add r2, r0
+L299: stop
+mov L325, r4
+
+jmp L334
+dec L321
+L300: inc r3
+clr L326
+jmp *r5
+jmp L324
+L301: jsr L331
+L302: jmp *r4
+L303: .string "yqnhxdljjwmown"
+L304: inc *r5
+clr r1
+L305: .data -824, 98, 865, -239, -411, -271
+L306: .data -833
+rts
+L307: jmp L332
+L308: red r5
+cmp L311, r0
+L309: .string "ogzkfbmfwxsmvigczcdhoovk"
+clr L315
+dec *r5
+clr L318
+L310: .data -327
+prn #-98
+add *r7, r3
+stop
+L311: not *r2
+red *r1
+jsr L331
+red r0
+L312: .data -485, -696
+stop
+prn L321
+jmp *r7
+L313: mov L321, *r4
+not r2
+jsr L321
+clr r4
+L314: bne L330
+L315: .data -652, -269, -90, -374, -750, -104, 555, 353
+; comment
+add #89, *r2
+L316: .string "b"
+inc *r3
+bne L333
+L317: clr *r7
+rts
+L318: .data -818, 342, -349
+L319: cmp *r4, r7
+inc r1
+L320: .string "lrejg"
+; comment
+L321: clr r3
+L322: red *r0
+bne L335
+sub #-15, L331
+L323: clr *r4
+sub r6, L334
+dec *r0
+jsr L335
+L324: bne L333
+lea L337, L329
+lea L339, L339
+clr L339
+mov r5, *r5
+L325: red L337
+L326: .data 900, -206, -277, 36
+
+cmp *r2, L338
+stop
+cmp *r0, L339
+L327: .string "bvmqobitgemiwfw"
+dec r2
+not L340
+stop
+L328: mov r0, r2
+jsr L332
+L329: lea L330, r4
+clr L333
+jsr L341
+inc L330
+stop
+clr *r0
+L330: prn r1
+L331: add r4, r6
+red L336
+red *r6
+L332: not L341
+L333: .data -557, -137, -272, 451, -400, 270, -445, 262
+L334: not L338
+bne L340
+jsr *r4
+; comment
+L335: jmp L336
+red r3
+rts
+mov #-233, *r7
+L336: bne L341
+clr r1
+not r7
+L337: lea L340, r0
+
+jmp L339
+jsr *r5
+
+mov L340, *r5
+inc r6
+dec L338
+cmp #36, r6
+L338: lea L340, *r0
+stop
+L339: .data -63, -463, -621, 888, -495
+bne L341
+; comment
+rts
+L340: bne *r2
+dec r2
+L341: cmp *r2, #41
+stop
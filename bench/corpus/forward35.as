@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 36
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+clr L285
+cmp L0, *r3
+red r4
+inc r4
+L0: mov *r5, *r3
+jsr L6
+lea L309, L314
+lea L307, L28
+not *r6
+L1: .string "pqxbjtfwstitzotqvgazep"
+L2: prn *r4
+lea L119, r3
+sub #1, *r2
+L3: jsr *r1
+rts
+jmp L166
+inc L219
+stop
+add r1, *r5
+sub L64, L114
+L4: .string "nuxsfthpbpciqk"
+cmp r6, L258
+stop
+L5: .string "fpmsqyxwzxrtopgufxtqhlv"
+lea L68, r0
+; comment
+L6: sub #197, L23
+L7: jsr *r2
+clr L72
+red *r3
+add *r5, r5
+L8: sub #71, L324
+L9: prn r1
+; comment
+rts
+mov *r7, r6
+L10: rts
+prn L81
+L11: sub L193, L150
+add #232, *r1
+L12: inc *r6
+prn *r0
+jsr L218
+L13: rts
+mov #-245, *r4
+inc L293
+dec L44
+L14: inc r2
+
+inc *r0
+rts
+L15: .data -733
+lea L268, L284
+L16: .data 817, -237, 220, 978
+L17: inc *r7
+; comment
+L18: .string "mqicad"
+not *r2
+; comment
+L19: cmp r1, r6
+; comment
+rts
+not *r6
+L20: red L272
+L21: inc *r3
+L22: stop
+
+; comment
+sub L103, L261
+sub L255, r3
+L23: dec r6
+L24: prn #74
+L25: rts
+dec r3
+jsr *r7
+L26: rts
+L27: .data -54, -732, -894, 596, -871
+stop
+lea L65, L101
+L28: .string "rwe"
+L29: jmp L52
+L30: .data -693, -834, -719
+jmp *r5
+add *r1, *r3
+L31: jmp *r3
+red r1
+lea L144, *r4
+add r1, r5
+red r4
+L32: .string "gkffyhpmwhpao"
+L33: lea L124, *r0
+red r1
+red *r0
+jsr *r3
+dec r6
+L34: .data -964, -980, 144, 174, 600, 450, 459, 935
+L35: .string "oox"
+mov L122, *r6
+jsr *r7
+jmp *r1
+L36: mov r6, L68
+inc r3
+L37: lea L143, *r7
+jmp L247
+L38: .data 878, -538, -416, -916, -383, -3
+
+rts
+prn *r3
+mov r2, L202
+L39: bne *r4
+L40: stop
+L41: .data 867, -769, 354, -766, -506, 995, -640, 111
+L42: .string "zqmmjkkbjignhxt"
+
+red r6
+L43: .string "etidegwcxqnbszus"
+clr L121
+add #255, r5
+bne L321
+L44: sub *r6, *r7
+jsr *r1
+L45: .data -672, 878, -583
+L46: mov #152, L311
+jsr *r3
+jsr *r0
+clr *r5
+rts
+stop
+bne L70
+stop
+; comment
+L47: .string "iyqeerazngvtpbhm"
+jmp L133
+mov r3, *r3
+not *r2
+clr L142
+rts
+L48: .data -915
+inc r4
+not L165
+mov #213, L91
+L49: dec *r7
+jmp L114
+L50: add *r3, *r2
+clr r7
+L51: .string "g"
+sub L147, r6
+not L277
+bne L215
+L52: prn *r7
+L53: .string "gqsskkneysbscceevwbpno"
+stop
+
+stop
+lea L202, *r0
+stop
+bne L86
+bne *r0
+red L72
+mov #-12, *r3
+L54: lea L183, r0
+add *r2, L295
+not *r6
+L55: .data 134, 482, 948, 409, 5, 164
+add *r2, r1
+add *r0, r2
+jmp L137
+jmp L84
+L56: cmp #91, L314
+L57: .data 576, -952, -653
+L58: .string "wfhllq"
+bne L253
+L59: .string "ivavl"
+clr L122
+
+cmp *r3, r0
+L60: prn #-200
+prn r0
+stop
+mov L325, L327
+inc *r3
+clr *r5
+mov #184, L77
+lea L197, *r4
+stop
+L61: .data 796, 898, 386, 126, 373, 862
+L62: lea L173, L298
+L63: rts
+stop
+bne L177
+not L275
+dec *r4
+L64: not L326
+add #-54, r0
+jsr *r4
+L65: prn #26
+
+mov #-106, *r5
+L66: .data -236, 703, -919, -948, 971
+L67: jmp *r2
+mov #163, *r7
+L68: inc r3
+L69: prn #15
+jsr L228
+cmp #250, L290
+jmp *r6
+L70: prn r7
+L71: cmp #30, L97
+L72: mov *r3, L278
+not L187
+L73: .data -778
+bne *r5
+L74: .string "pfa"
+add r2, r4
+; comment
+L75: jsr L127
+L76: clr L254
+not *r0
+lea L110, r3
+stop
+rts
+mov r4, r0
+L77: sub r5, *r0
+L78: add r3, r3
+clr L185
+L79: bne *r1
+L80: jsr *r0
+jmp L224
+stop
+L81: .string "kf"
+inc L131
+stop
+rts
+L82: cmp *r7, L324
+sub *r2, *r4
+inc L264
+lea L277, *r2
+jmp L129
+L83: bne L224
+L84: sub *r1, r6
+L85: clr *r2
+L86: rts
+L87: inc *r3
+prn r5
+jsr *r2
+red *r4
+cmp #-153, r6
+L88: sub L98, *r4
+dec L261
+rts
+inc *r1
+rts
+lea L202, *r3
+L89: bne L143
+prn L183
+L90: inc *r1
+L91: bne *r3
+bne L230
+dec *r5
+L92: .string "yxesgqtdvevuybwylbff"
+dec r5
+L93: .string "nkqoxlvcphh"
+L94: rts
+inc *r7
+sub r1, *r1
+L95: .data -497, -655, 471, -229, 455, -109
+L96: rts
+not r4
+lea L208, *r3
+rts
+L97: inc *r4
+sub r2, L300
+L98: .string "jpnzwmputgkgsnajtzqocxj"
+jsr *r4
+red L160
+stop
+mov L120, r3
+L99: prn #-183
+L100: clr *r1
+dec L209
+L101: .data 852
+L102: red r0
+jsr *r4
+jsr *r6
+dec r5
+dec *r7
+jsr L263
+inc *r7
+cmp *r6, L121
+L103: lea L251, *r6
+L104: stop
+mov L203, r5
+add *r5, L303
+L105: .data 717, 878, 87, -339, 750, -658
+bne L314
+rts
+lea L166, r0
+inc L264
+not *r1
+jmp L194
+L106: .string "ichcbg"
+cmp *r4, L200
+add #-251, r2
+stop
+red *r2
+L107: prn #102
+; comment
+L108: jmp L183
+lea L149, L219
+red r0
+L109: inc *r7
+lea L283, *r7
+clr *r2
+L110: clr L237
+clr L210
+L111: clr L213
+sub r0, r1
+inc r3
+L112: .data -379, 82, 610, 528, 158, -12, -463
+L113: cmp *r7, #-75
+not *r2
+L114: jsr *r3
+L115: inc r6
+not r6
+not *r7
+mov L140, r1
+bne *r0
+sub #63, L116
+prn *r4
+L116: .data -531, 524, -308
+stop
+L117: inc *r4
+jsr L189
+sub r2, *r4
+L118: not *r3
+prn r2
+L119: .data -232, -514, 25, 679, -12, 679, -274, 189
+L120: .data -892, 455, -767, 852, -751, -517
+L121: stop
+L122: lea L241, r1
+jmp L335
+inc r3
+L123: .data -489, -40, 825, 46, -586, 358, 416, 385
+stop
+L124: .data -913, 880, 239, 911, -200
+bne L284
+L125: inc *r3
+lea L187, r7
+jmp *r2
+jmp L311
+dec *r4
+stop
+L126: add *r7, L315
+add *r2, L331
+rts
+bne *r3
+L127: inc L131
+L128: inc *r6
+L129: clr *r4
+jmp L329
+L130: bne *r5
+inc L319
+add L232, r6
+bne L287
+add #55, *r0
+L131: sub r1, r2
+mov r2, L212
+not r4
+L132: .data -457, 594, 73, 309
+L133: dec L165
+not L215
+sub *r5, L250
+add *r1, r4
+L134: .data 39
+L135: .string "xbehtypw"
+L136: .string "smdk"
+L137: .data -324, -139, -510, 510
+; comment
+L138: .data 369, 716
+clr L296
+stop
+clr *r4
+L139: inc r6
+add #-94, L281
+dec L189
+sub r6, r0
+prn r1
+dec *r0
+L140: inc *r6
+cmp L179, L287
+bne L226
+rts
+stop
+lea L239, *r2
+L141: sub *r3, r0
+L142: not r6
+cmp *r4, L160
+add r0, L200
+not *r0
+cmp r2, *r1
+L143: add *r1, L233
+L144: bne *r4
+mov *r2, r0
+L145: .string "obrw"
+
+clr r6
+rts
+L146: .string "ckmyjwt"
+L147: rts
+L148: sub r4, *r4
+inc r2
+jsr *r1
+sub r2, *r6
+L149: dec r6
+cmp L334, r4
+L150: lea L189, *r5
+lea L287, L262
+L151: prn #236
+rts
+cmp *r2, *r0
+L152: .string "qxngbpjvjtqkezwayday"
+; comment
+not r4
+not r5
+prn #-122
+stop
+add *r5, r5
+L153: bne *r5
+L154: .data 345, 489, -916, -623, -229, 73, -299, 174
+clr *r5
+rts
+jmp *r0
+rts
+bne L263
+inc L263
+L155: rts
+L156: cmp r2, *r3
+L157: .string "zrtosfzulhoyxmx"
+L158: clr *r1
+sub *r2, L282
+jmp *r1
+L159: .string "zvlvhquqwcxxytoruruszybu"
+jsr *r0
+prn r7
+stop
+add *r3, L170
+inc r5
+jmp *r6
+inc L336
+jmp *r2
+jsr *r4
+inc L260
+dec *r7
+bne *r3
+cmp L327, r1
+L160: sub L325, *r1
+sub #165, r7
+
+L161: .string "rosddxcptwzeghc"
+L162: prn #169
+L163: rts
+dec L339
+L164: jmp *r6
+L165: inc L175
+L166: red r2
+L167: .string "p"
+inc L232
+L168: add L301, *r0
+rts
+L169: lea L230, *r6
+lea L311, r6
+L170: jmp *r0
+not *r0
+red *r4
+jmp *r2
+L171: prn r4
+jmp *r2
+L172: bne L196
+L173: jmp L220
+L174: .string "n"
+sub *r6, L266
+
+clr *r1
+L175: jmp *r4
+not *r3
+L176: sub r3, L231
+stop
+stop
+not L334
+L177: red *r7
+L178: clr r2
+prn #-3
+red *r3
+cmp *r3, *r2
+lea L288, L259
+prn *r6
+L179: jmp *r4
+L180: .data -476, -5, -601, -628, 843, 247
+not *r6
+rts
+jsr L206
+bne L269
+L181: .string "ebw"
+rts
+add r3, L193
+not *r5
+L182: jsr *r1
+L183: .string "dkhcyutifptvkzxhxyvlzmgs"
+prn L308
+not r6
+bne L300
+jsr *r5
+
+L184: .data -145, 964, 574, 739
+inc *r6
+L185: jsr L314
+jsr L285
+; comment
+rts
+L186: stop
+L187: add r5, L263
+add r0, L267
+L188: not L317
+bne *r1
+mov r6, r6
+inc r0
+L189: jsr L327
+clr *r2
+add r2, *r0
+jsr L251
+inc L303
+stop
+stop
+inc *r3
+red L199
+jmp *r5
+jsr L255
+inc L326
+L190: stop
+bne *r6
+L191: prn #-7
+L192: .string "chjzniy"
+L193: prn L224
+not r1
+L194: add #162, *r1
+prn L213
+L195: prn #-252
+L196: sub #-159, *r3
+rts
+L197: add r2, r7
+add *r0, L295
+L198: dec L302
+mov L204, r4
+prn L229
+L199: sub *r6, *r3
+dec L214
+bne L267
+L200: mov r2, L262
+; comment
+sub r5, *r6
+prn L210
+L201: sub #-22, L328
+L202: add *r0, *r1
+dec L302
+
+L203: prn *r4
+L204: bne *r5
+bne *r7
+not L251
+inc r5
+jmp *r1
+dec L323
+mov r7, L333
+jmp L310
+jmp L210
+lea L304, L249
+rts
+bne *r4
+L205: mov *r1, *r1
+L206: jmp L307
+sub #53, *r5
+rts
+cmp #55, *r5
+; comment
+add #-70, *r5
+L207: .string "ycyyukmgtlbdclz"
+L208: sub #126, r7
+L209: stop
+; comment
+jsr L224
+L210: bne *r0
+
+sub r5, L228
+jmp L339
+L211: .data -252
+dec *r5
+red *r0
+L212: inc L247
+L213: .data 95, 976, -853
+L214: red L339
+jsr L291
+L215: stop
+L216: mov #-28, L261
+
+L217: .string "ivoinxnm"
+L218: mov L327, L225
+rts
+rts
+jmp *r0
+sub #236, r7
+clr *r5
+L219: .string "ijjqmiffpleffi"
+inc *r3
+lea L263, *r3
+L220: dec *r3
+bne L243
+jmp *r0
+jmp L263
+mov #-256, L280
+
+rts
+rts
+rts
+
+L221: dec L270
+sub L262, *r5
+stop
+jsr *r7
+bne *r7
+lea L338, *r2
+add #-245, r3
+L222: bne L310
+L223: cmp #-117, L289
+inc r1
+prn #-174
+mov #182, L240
+add *r4, r1
+L224: inc L254
+dec r0
+L225: cmp #-6, L245
+L226: .data 46, -544, 743, 993, -855, -913, -365
+L227: prn L318
+L228: dec L270
+prn *r6
+clr r1
+jmp L254
+L229: jmp *r4
+L230: jmp L330
+sub r0, *r7
+rts
+stop
+L231: bne L233
+L232: rts
+not L237
+inc r5
+L233: prn #-224
+; comment
+cmp L277, L253
+not L253
+L234: lea L329, r2
+red L261
+dec *r1
+jsr *r7
+clr r3
+L235: add *r6, L262
+
+L236: cmp L336, L251
+sub r5, r2
+inc r6
+
+L237: .data 678, -247, 722, -462
+stop
+stop
+sub r5, *r2
+prn *r7
+not r6
+inc r3
+L238: rts
+
+jsr *r0
+dec r1
+mov r1, r0
+prn *r7
+L239: prn L281
+sub L276, r3
+jmp *r2
+stop
+cmp L291, #-210
+L240: mov #216, *r5
+clr r3
+
+L241: stop
+clr L265
+prn *r3
+L242: rts
+L243: .string "gdxp"
+red r1
+sub L303, r3
+sub *r3, L279
+jmp L292
+sub #-51, *r4
+add #-124, L260
+L244: inc L291
+red *r4
+jsr *r6
+sub r7, L321
+dec L317
+bne L273
+bne L291
+mov *r6, r4
+L245: dec r0
+L246: bne *r0
+clr r2
+cmp L257, *r5
+red r1
+dec L307
+; comment
+add *r3, L272
+stop
+jmp L274
+cmp #179, #198
+lea L331, *r0
+sub r3, L290
+L247: mov #27, *r1
+L248: mov #-97, r3
+L249: prn r7
+prn *r3
+prn L260
+mov *r5, r6
+L250: .string "zt"
+
+lea L285, L314
+
+lea L333, *r5
+L251: prn r7
+mov *r3, L313
+cmp L335, L322
+prn #-226
+lea L305, r1
+L252: bne *r4
+; comment
+cmp r3, *r7
+lea L271, L293
+inc L307
+L253: .data 127, -248, -770, -580, -4, -450
+L254: sub r0, *r2
+red L255
+jsr *r3
+L255: lea L334, r2
+rts
+L256: clr r6
+not r6
+mov L287, L333
+prn *r4
+inc L318
+L257: dec *r1
+L258: prn *r0
+mov *r5, L308
+L259: mov r7, r4
+dec *r7
+L260: bne L331
+lea L270, *r1
+lea L269, r4
+L261: stop
+L262: inc r0
+L263: .string "vtyyvwcphbfufqxb"
+L264: .string "rzmihvbmvicxdovjrznk"
+clr *r1
+dec L308
+not *r1
+L265: prn #-89
+L266: .string "yzanoowdinzztqj"
+cmp #-124, r6
+inc L319
+add #-209, r0
+inc r5
+rts
+bne L299
+cmp L271, r3
+L267: cmp #-182, r2
+bne *r6
+L268: add r3, *r2
+L269: .data 755, 705, 775, 918, -89
+sub #-69, L333
+L270: red *r6
+L271: .data 773, -711, -650, -191
+not L278
+jsr *r3
+L272: prn r0
+jmp *r4
+lea L306, L312
+L273: not *r1
+red *r5
+L274: not *r3
+rts
+L275: cmp #-170, *r7
+L276: red r6
+L277: jmp *r4
+rts
+cmp *r1, #-20
+L278: sub r3, L309
+stop
+stop
+dec L338
+
+L279: rts
+prn #13
+jsr *r2
+not *r7
+jsr *r6
+L280: .string "rqj"
+clr r3
+clr r7
+jmp *r1
+jsr *r0
+bne L293
+cmp r3, #-206
+dec L306
+mov #183, L326
+add L301, r0
+L281: .data -753, 426, 750, 24
+L282: .string "i"
+stop
+not L294
+L283: jsr *r1
+L284: dec r4
+L285: .string "ndblpl"
+prn *r0
+L286: clr r1
+rts
+stop
+mov L303, L320
+L287: .string "xxlxcmicpspsai"
+bne L330
+clr L338
+prn #71
+
+jmp L288
+clr L334
+L288: prn r7
+prn L329
+stop
+L289: clr *r0
+L290: dec L294
+L291: dec r2
+L292: mov r6, *r1
+L293: stop
+L294: inc L295
+lea L328, *r3
+L295: dec *r5
+clr L324
+L296: lea L321, L307
+add *r3, *r4
+lea L304, *r3
+L297: .data 938, 375, -320
+L298: .string "vcovrbauwlh"
+add r2, L308
+L299: cmp r0, r4
+prn L322
+inc L327
+rts
+prn *r0
+rts
+L300: dec *r2
+inc r6
+L301: cmp r3, r4
+stop
+prn *r7
+jmp *r7
+red r4
+jsr *r5
+inc r6
+
+L302: stop
+rts
+clr L319
+dec r1
+mov r6, r7
+L303: stop
+L304: not L334
+jmp L323
+bne L328
+inc r3
+prn #160
+L305: prn #81
+
+jmp L336
+dec r6
+L306: .string "hodn"
+L307: .data -893, 770
+cmp *r2, #221
+sub *r5, L308
+stop
+bne L320
+red *r7
+L308: inc L337
+cmp #-78, L335
+cmp r6, r3
+dec L319
+L309: mov #-65, *r1
+L310: cmp L340, #-247
+mov *r5, L332
+cmp *r0, L320
+clr r3
+sub L318, *r4
+lea L327, L323
+sub #-234, L318
+L311: prn L336
+L312: .string "xxhcjxrnraodvusjt"
+lea L336, *r7
+prn r2
+L313: red L333
+inc *r7
+L314: .string "dgctlmnscquecypa"
+L315: .string "ygjwucihfkdwotbsttsseadi"
+prn r3
+not r1
+L316: red r4
+L317: bne *r6
+L318: add #-80, r4
+L319: dec L334
+L320: cmp *r1, L322
+bne L326
+dec *r3
+rts
+; comment
+rts
+L321: bne L325
+L322: red *r2
+rts
+L323: not r7
+sub *r4, r4
+dec *r1
+mov r1, r7
+jmp L328
+mov *r2, *r7
+inc *r6
+red r6
+L324: clr *r0
+inc *r7
+L325: red *r0
+stop
+inc L329
+clr r3
+L326: rts
+rts
+inc *r2
+not L340
+mov r2, *r0
+stop
+not L337
+cmp L332, #134
+jsr *r5
+clr *r0
+stop
+L327: clr L335
+jsr L332
+L328: jsr *r4
+not r0
+clr r0
+L329: rts
+add #-105, *r5
+add L340, *r5
+L330: stop
+dec L333
+L331: .data -801, 259, 645, 911, -730, 992, 87, 337
+prn #233
+stop
+L332: sub r7, *r4
+cmp r2, L339
+jmp *r1
+L333: lea L338, r2
+clr r4
+L334: prn r2
+add L335, r1
+L335: not r4
+sub #152, L336
+jmp *r5
+L336: jsr L338
+L337: stop
+jsr L340
+jmp L338
+inc *r0
+prn #-83
+inc r5
+lea L339, r5
+inc *r7
+L338: rts
+lea L339, *r7
+L339: .string "acaqwhjprcyxyqhmnrumdn"
+dec L340
+lea L340, r5
+L340: .string "x"
+clr r6
+red r7
+add r3, r3
+dec r4
+lea L339, *r3
+mov r1, L138
+bne *r7
+stop
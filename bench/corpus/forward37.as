@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 38
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+L0: .string "ecpklftkwsooqz"
+mov L133, L276
+L1: .string "xmecmpuoygzjzwvrea"
+inc *r1
+lea L3, L26
+dec *r4
+L2: .data 772, -858, -880, -258, 76, 697, -168, -360
+inc r7
+not *r4
+cmp #-167, #20
+L3: .string "pwclmizmszq"
+stop
+bne L128
+L4: dec r2
+red r6
+L5: bne L222
+rts
+bne L89
+red r0
+dec *r5
+L6: .string "ybkvbozqiuoeozq"
+not r0
+clr r1
+L7: dec r5
+L8: .data -548, 231, 47, 940, -513, -532, 578, 947
+L9: add *r4, *r6
+not r2
+L10: .string "o"
+jsr L196
+jmp L204
+jmp *r6
+mov r1, L91
+inc L215
+red L321
+L11: lea L259, r4
+add #191, r3
+L12: clr r7
+L13: add #248, *r3
+add *r7, L183
+
+stop
+bne L305
+; comment
+bne L97
+bne *r7
+jsr L107
+add r0, L226
+prn *r2
+L14: inc r0
+L15: red r3
+prn r2
+L16: prn #57
+L17: .string "vdvajtkrlbhqhl"
+mov #115, *r2
+; comment
+add *r2, *r0
+not *r3
+L18: jmp *r7
+jmp L270
+L19: dec L173
+prn L257
+L20: stop
+mov #-112, L77
+jmp *r5
+L21: lea L134, *r3
+; comment
+L22: add #56, L198
+rts
+rts
+L23: not r7
+L24: jsr *r7
+jsr *r1
+add L222, r1
+bne L93
+dec L301
+stop
+sub L330, r5
+red r4
+rts
+add #168, L75
+L25: add r2, *r2
+cmp r1, *r4
+L26: not *r3
+L27: clr r0
+dec L164
+rts
+L28: not L101
+sub #14, *r6
+L29: stop
+rts
+L30: dec *r2
+L31: clr L328
+
+L32: sub r2, r6
+L33: jsr *r4
+add #154, L164
+L34: .data -694, 894, -734, -422, 424, 49, 857, -42
+jmp L193
+lea L101, *r4
+inc L178
+L35: red *r6
+lea L81, L174
+mov r0, *r0
+bne *r5
+L36: red L165
+rts
+L37: .string "fglttspz"
+inc *r6
+L38: rts
+L39: clr *r3
+rts
+
+L40: .string "lnamiievgopkdkxouegemd"
+L41: prn #-123
+not r3
+L42: prn L220
+L43: jmp L349
+L44: inc *r0
+L45: bne *r4
+jsr *r4
+lea L320, *r7
+inc L268
+L46: cmp *r5, L121
+jsr L217
+prn *r4
+jsr L107
+lea L249, L241
+rts
+L47: add #-176, r3
+inc *r3
+L48: .data -94, 954, 203
+cmp L270, #-235
+L49: mov L285, *r0
+clr r1
+mov *r7, *r6
+L50: stop
+mov *r7, L78
+sub *r1, r2
+L51: bne *r5
+L52: .string "e"
+not *r3
+L53: sub #63, L208
+stop
+add r3, L289
+L54: rts
+cmp L330, r5
+inc L168
+dec r2
+L55: prn L177
+L56: clr L78
+jmp *r3
+L57: not r6
+L58: stop
+dec r6
+clr r7
+L59: cmp #-29, r3
+jsr L274
+; comment
+L60: stop
+red r3
+stop
+L61: mov L323, r6
+bne L226
+prn r1
+not *r6
+L62: not *r6
+bne L201
+dec r5
+L63: jsr L136
+L64: inc r4
+jsr *r4
+L65: .string "lhajlhay"
+jmp *r5
+mov *r1, r7
+rts
+inc *r2
+sub #-32, r1
+mov *r3, L305
+jmp L280
+inc *r4
+red r2
+L66: stop
+; comment
+prn r5
+L67: clr *r6
+clr *r5
+red r2
+sub L122, r1
+L68: clr L91
+; comment
+inc *r3
+jmp *r7
+clr *r6
+dec L258
+not r5
+rts
+L69: dec r7
+jsr *r0
+L70: jsr *r2
+dec L342
+L71: jsr *r2
+cmp L238, #-121
+sub r4, r0
+inc *r0
+lea L92, L293
+L72: add #180, *r0
+L73: .data 688, 920, 846, 516
+L74: .data -71, -44, -14
+L75: lea L122, L93
+L76: stop
+cmp *r5, #131
+L77: .data 144, -186, -779
+add L294, r3
+L78: .data 730, -738, 501, 802
+L79: red *r2
+; comment
+red r7
+L80: dec r7
+dec *r4
+L81: inc *r7
+L82: not r1
+prn L182
+cmp r0, r7
+not L205
+L83: prn *r1
+L84: .data 141, 339, -915, -327, 245, -981, 405
+prn *r5
+red L263
+L85: .string "hoondaux"
+L86: rts
+stop
+L87: .string "jbut"
+inc L216
+L88: inc r7
+clr L250
+L89: mov L331, r0
+lea L161, L359
+clr L92
+clr *r4
+L90: inc L91
+L91: add r3, L235
+red *r7
+prn L186
+bne *r0
+inc L101
+lea L135, r4
+clr *r2
+inc r6
+inc *r6
+L92: .data 958, 238, 587
+; comment
+lea L244, L277
+
+L93: prn r1
+stop
+prn #-156
+L94: not r6
+L95: inc L290
+red L355
+bne L348
+not *r4
+
+bne L349
+jmp L190
+clr *r6
+rts
+L96: add L203, *r0
+red L149
+add L137, r4
+dec r7
+jsr *r5
+rts
+bne L326
+L97: mov L145, *r3
+stop
+dec r6
+clr r7
+L98: mov r5, L281
+dec r3
+add L269, L240
+L99: cmp *r2, *r2
+add #134, L280
+L100: prn #190
+; comment
+L101: mov *r5, r4
+lea L298, L230
+L102: .data 975, 302, 330, -91, -327, 853
+L103: .string "bjg"
+L104: stop
+L105: prn r4
+L106: .string "agkitooyasctpwkirdvroyf"
+cmp r4, r1
+dec L217
+inc L240
+add #-151, r6
+L107: lea L150, r3
+cmp *r3, #243
+L108: bne L275
+cmp #63, *r3
+L109: .data 515, 178, 958, -249, -624, -75, 907
+add *r6, *r7
+inc r2
+add *r6, *r5
+clr L174
+L110: cmp r4, *r2
+inc r7
+jmp *r2
+cmp *r2, *r7
+bne L240
+L111: mov #-238, r0
+jmp *r0
+not r7
+inc L326
+dec r0
+sub L165, *r1
+rts
+L112: bne *r4
+red L170
+jsr L227
+
+red L247
+L113: .string "fqhsvksnhrumof"
+L114: .data -719, 354, -890, -321, -644, 154
+L115: jsr L201
+mov *r0, r2
+L116: .string "dlsfvmtazprpuizskypfewu"
+not *r0
+L117: .data -614, -267, 134, 554, 868, 716
+jmp L218
+clr *r4
+jsr *r2
+red r5
+L118: rts
+lea L135, r1
+jmp *r2
+stop
+lea L266, *r2
+dec r5
+jmp L347
+L119: .data 346, -825, 394, -389
+mov L293, L296
+clr L332
+jsr L277
+jmp *r6
+; comment
+L120: inc L157
+sub L217, r3
+L121: .data 422, 916, 249, -115, 331, 975
+L122: jsr L224
+dec r4
+L123: jsr *r7
+
+L124: add r7, r0
+jmp *r1
+mov L137, *r4
+bne *r6
+sub r3, L146
+bne *r0
+L125: .data 214, -807, -433
+; comment
+sub r2, L352
+
+red L288
+L126: lea L218, r7
+cmp r0, L298
+sub #192, *r6
+prn #-80
+clr L218
+bne L242
+jsr L273
+sub *r0, *r7
+bne L181
+jsr L193
+sub #-103, *r3
+clr *r6
+inc *r4
+cmp *r7, *r1
+lea L336, *r3
+bne *r1
+cmp r0, *r3
+L127: .data -260, 427
+lea L331, *r1
+stop
+L128: red *r2
+L129: prn r4
+cmp #206, #44
+sub r2, r1
+jsr *r5
+cmp r7, r5
+L130: .data -134, 217
+sub *r4, L224
+L131: .data 718, -741, 511, -291, -808
+L132: mov #-17, L263
+L133: .string "uhnu"
+not *r3
+L134: sub L140, *r1
+rts
+stop
+clr L233
+L135: clr *r1
+stop
+jsr *r0
+red L145
+prn r6
+L136: bne L328
+L137: rts
+rts
+L138: bne L357
+red L187
+L139: clr L244
+; comment
+rts
+L140: jmp L265
+L141: red *r5
+add *r3, r5
+L142: cmp #98, *r1
+prn L278
+L143: add #45, r3
+L144: mov *r4, *r7
+L145: .data -196, 778, -692, 331, 19, -707, 829, -376
+L146: .string "bngxmuulioyzyohzlmbx"
+bne *r0
+bne L157
+stop
+L147: .data 362, -453, 882
+cmp #53, #180
+add *r0, r0
+L148: .data 223, -661
+mov r2, r0
+jmp *r6
+inc r5
+dec *r2
+L149: .data 659, 629, 34, -998, -366, 707, 817, -256
+stop
+L150: sub r1, r3
+bne *r7
+L151: dec L185
+L152: sub L354, L164
+add #-126, r2
+jmp *r6
+L153: cmp #99, #-180
+add L353, *r1
+L154: cmp #-21, L276
+
+L155: .data -163, 82, 966, -213, 880, -717, -689
+add r6, *r0
+clr *r7
+clr *r0
+cmp #-231, *r3
+L156: mov L226, r1
+L157: .string "ze"
+inc L259
+clr *r3
+cmp L337, L343
+cmp *r2, r7
+red L172
+stop
+stop
+L158: clr *r7
+L159: stop
+stop
+sub *r0, L223
+bne *r1
+jsr *r3
+L160: lea L226, *r6
+not r3
+red *r3
+L161: cmp L257, *r2
+L162: red r2
+L163: bne L324
+cmp #-93, r7
+L164: rts
+rts
+stop
+add *r2, r4
+L165: .data -132, 454, 16, 885, -367, 21, 664
+L166: .data 778
+lea L266, r0
+sub *r0, L304
+L167: stop
+L168: add #-172, L211
+L169: not *r4
+jsr L355
+; comment
+L170: .string "encoqffoxsv"
+L171: .data -493, 169, -78, 12, -659, 759, 249, 764
+rts
+bne *r2
+L172: rts
+
+
+L173: lea L275, L308
+L174: prn L178
+prn r7
+prn L296
+lea L275, *r7
+L175: dec *r5
+prn *r5
+L176: rts
+sub L246, *r2
+rts
+clr L267
+clr *r7
+cmp r5, r0
+add #200, *r6
+L177: not L315
+stop
+cmp #172, L269
+jmp *r3
+red L207
+not r5
+L178: sub r3, r3
+inc r0
+L179: jsr L220
+L180: stop
+L181: prn L228
+L182: .data -840, 927, 578, -487, 210, -889, 117
+bne L341
+L183: .string "hbvcvchwztmhzmjcolt"
+inc r1
+rts
+stop
+inc r0
+red L344
+jsr L341
+L184: .data 223, 968, 904, -31, -991, -36, 271
+rts
+L185: .data -129, 852, 366, 307, 465, 988, -603, 248
+prn *r0
+L186: .string "biivmktysjajxwewfowt"
+cmp #-234, *r7
+L187: prn r5
+mov L218, *r7
+dec *r2
+L188: sub *r6, r1
+sub r4, L272
+L189: mov *r0, *r3
+L190: jmp *r1
+red *r4
+mov r5, L254
+L191: mov #-93, *r7
+stop
+bne L227
+jsr *r7
+dec *r7
+red *r6
+rts
+L192: .data 582, -586, 294, 714, 643, 530, 907, -210
+
+lea L288, L265
+jmp L354
+add *r3, *r1
+not *r2
+L193: .string "dubbnkrfanwhzeeytm"
+L194: stop
+prn r6
+
+cmp *r7, #-124
+inc r7
+L195: not L312
+stop
+stop
+jmp *r1
+L196: dec r0
+L197: add r7, r5
+L198: rts
+L199: dec L244
+not L227
+L200: dec r2
+L201: bne L337
+L202: jsr L216
+L203: rts
+inc *r5
+dec r0
+clr r2
+stop
+sub *r0, *r4
+stop
+L204: not *r1
+prn L248
+stop
+stop
+L205: red *r2
+inc *r2
+prn #168
+sub L326, *r5
+L206: cmp #-74, r5
+bne *r3
+bne L355
+L207: .string "bkqxqgt"
+mov L208, r7
+sub *r1, *r4
+jmp L335
+L208: rts
+jmp L217
+sub #154, *r0
+dec L267
+
+stop
+
+L209: .string "erlgqfxjaqhjyuinhvmbnimv"
+rts
+dec *r5
+L210: lea L248, r1
+L211: .data -897, -923, -767, 263, -17, -405
+dec *r1
+jmp L238
+L212: .data -170, -286, 279, 483, 783
+L213: mov r6, L347
+add r6, r7
+L214: .string "qxseaemmrtbko"
+stop
+L215: bne *r0
+jsr *r6
+sub r3, *r1
+L216: red L252
+L217: dec r5
+not r0
+prn *r4
+prn L339
+jsr *r2
+stop
+add #132, L300
+red r5
+L218: stop
+L219: stop
+L220: clr L245
+L221: .string "dzgjaphcgf"
+bne *r4
+L222: not r2
+L223: clr L284
+L224: bne *r1
+L225: jmp *r1
+red r5
+cmp L348, r2
+L226: prn *r7
+lea L267, *r0
+inc L275
+stop
+cmp L302, r7
+bne *r2
+L227: lea L247, L298
+stop
+L228: mov L249, L343
+inc r2
+sub r4, r0
+L229: .string "vkbhqcwqvomdjimv"
+L230: prn r1
+clr r0
+L231: not *r6
+L232: bne *r2
+bne L296
+bne L320
+; comment
+; comment
+L233: dec L268
+bne *r0
+L234: prn *r1
+mov L238, L333
+L235: mov L341, *r1
+L236: red L345
+not L339
+stop
+L237: add r4, L259
+L238: .string "vhpgtwutrqvuirjqdlavkva"
+L239: jsr L296
+
+L240: .string "cwnaxfrwobzfaapcslnavvt"
+jmp *r7
+jmp *r4
+L241: dec r1
+L242: .string "tgqlisnwpxfsrxgfyvje"
+L243: lea L248, *r6
+inc L319
+not *r1
+L244: inc r0
+L245: .data 199, -864, 262, -91, 73, 81
+red r6
+mov #104, *r7
+red L354
+jsr L299
+L246: red *r1
+inc r4
+mov *r7, *r5
+L247: clr r0
+L248: add #229, r5
+L249: lea L353, L342
+lea L328, L258
+clr r7
+cmp L349, #36
+; comment
+lea L326, *r1
+cmp L262, r5
+inc r7
+add r4, r5
+add r1, *r2
+not r7
+lea L273, L306
+
+prn #-53
+dec *r5
+red r0
+add *r1, L269
+L250: lea L286, L327
+jmp *r0
+red *r5
+inc r1
+L251: prn r2
+lea L277, r5
+jmp L318
+dec r7
+clr L347
+rts
+L252: clr L353
+L253: inc r2
+sub #215, *r5
+mov #213, r4
+L254: .data -753, 643, 258, 10, -357, -972, -998
+L255: add r1, L329
+L256: .data -330, -25, -202, 415, -80, 685, 106
+prn *r1
+L257: inc *r0
+L258: .data 362, 68, 250, 310, -250
+L259: sub #53, r5
+rts
+L260: jsr L300
+clr *r6
+L261: .string "yvrebhfan"
+add r5, *r3
+L262: jsr L303
+stop
+L263: jsr L332
+mov r7, *r7
+red *r2
+add L348, r5
+clr r3
+L264: .string "dczoxfipmndoxxxcokqwuw"
+not r6
+not r5
+mov L298, L334
+L265: stop
+L266: lea L340, L295
+red *r4
+L267: stop
+lea L286, *r0
+L268: mov #10, r2
+L269: add L278, *r1
+L270: dec *r4
+rts
+red L287
+dec r3
+L271: lea L338, *r4
+L272: prn *r1
+L273: dec *r3
+red r1
+L274: .data -291
+L275: jsr *r7
+mov r6, r3
+L276: jmp *r4
+jmp L318
+jsr *r2
+stop
+not r2
+mov L347, L343
+L277: .string "jkhflmhg"
+clr *r7
+L278: .string "ojqvqqqxuuafppia"
+add r5, L334
+
+prn *r2
+rts
+add r6, r7
+lea L290, L329
+dec L332
+jmp *r6
+prn L287
+L279: dec *r6
+L280: inc L314
+cmp r5, *r7
+add #-175, *r4
+inc L302
+inc L341
+sub *r6, *r7
+sub #-54, r0
+bne L284
+lea L292, *r6
+L281: red L300
+L282: .data 980, -227, -613
+add #164, L347
+not *r7
+prn *r4
+stop
+L283: .data 568
+not *r3
+L284: cmp #204, #-234
+L285: jmp L340
+inc r1
+clr L327
+L286: .string "zehjsfbdjz"
+lea L350, L332
+dec L356
+jmp *r0
+bne L313
+clr *r6
+red r6
+bne L357
+L287: rts
+L288: add L308, L325
+L289: mov #26, L335
+clr L294
+rts
+L290: not L302
+dec L351
+L291: cmp L331, *r1
+sub #16, *r1
+red r7
+not r7
+rts
+clr r3
+; comment
+mov r2, r0
+sub *r3, L340
+sub L356, *r2
+L292: sub r4, r7
+add *r5, r3
+add #-84, L326
+add L350, r3
+clr *r6
+
+L293: .data 490, -628
+mov #80, r4
+stop
+lea L354, L317
+cmp L347, #-62
+inc L325
+cmp r0, *r5
+L294: .data -835, -958, -820, -959, 94, -905
+L295: sub L329, r7
+sub L302, r7
+L296: stop
+rts
+jmp L325
+L297: bne *r5
+add L303, L321
+red *r4
+inc L325
+jmp *r4
+L298: .data -198, -914, -404
+L299: .data 810, 893, -264, 748
+not L313
+stop
+L300: jsr *r5
+L301: .string "aoqajrpurgjiimq"
+jsr *r1
+add L354, L303
+L302: sub r1, *r7
+add *r5, L339
+stop
+bne L318
+L303: add L308, r0
+L304: .string "hli"
+inc L319
+sub #113, *r3
+L305: .string "qvfmwqqxckkyhb"
+inc r6
+cmp *r4, L337
+L306: clr *r3
+
+L307: bne L344
+cmp #-161, r2
+jmp L359
+L308: .string "wjcbdgm"
+L309: stop
+mov r0, r7
+red r3
+clr r3
+L310: add r1, L348
+lea L327, L350
+mov #-202, r3
+L311: bne *r2
+add *r2, *r3
+L312: rts
+clr r4
+jmp L340
+L313: red r0
+mov #-141, L353
+bne L320
+add r2, *r4
+L314: rts
+L315: lea L319, r7
+L316: lea L330, r3
+L317: .data -807, 980, -657, -323, 485, 290, -739
+L318: jmp L336
+sub #-158, r6
+L319: inc *r3
+clr L349
+not L335
+
+red *r2
+L320: mov L335, L337
+lea L331, L327
+prn r0
+L321: .string "fmaxabmpwhpvkebrn"
+L322: red r5
+L323: lea L330, L332
+L324: jmp L358
+prn *r3
+; comment
+L325: jsr *r1
+dec r3
+L326: add L355, *r7
+bne L358
+L327: add #26, r5
+lea L340, r6
+rts
+mov L333, r7
+L328: jsr L331
+mov #239, r0
+sub r7, r0
+rts
+L329: clr *r2
+cmp *r6, *r7
+L330: not L336
+add #31, r3
+L331: sub #-25, L356
+red r4
+bne L353
+L332: sub #-65, r1
+L333: .string "dtmdyxgfpsmcgamlswmef"
+mov L349, L357
+L334: .string "ezjlolwmonyfzdrhhgnkovzx"
+bne *r6
+L335: dec L351
+L336: rts
+L337: inc L349
+prn *r5
+mov L340, *r7
+L338: inc *r1
+inc *r2
+bne *r5
+bne L339
+L339: .data -810, 725, -221, -187, 816, 268, -501, 213
+L340: cmp *r3, L353
+dec *r4
+L341: stop
+dec *r2
+L342: sub *r4, *r2
+L343: clr L353
+not *r4
+L344: .string "msllkjxqpq"
+not L355
+L345: .data -790
+L346: .string "lubhetu"
+L347: clr r7
+bne L353
+L348: inc r7
+; comment
+prn #-80
+not *r4
+L349: red L354
+L350: lea L358, r7
+bne L355
+bne *r6
+mov r7, L354
+red *r3
+cmp L359, L359
+L351: .data -279, -563, 91, 147, -680, -211, 609
+not r6
+L352: add #-137, r6
+clr r1
+clr r6
+
+cmp *r1, r2
+add *r7, r4
+lea L357, L359
+L353: bne *r0
+bne *r6
+add *r3, r6
+L354: inc r7
+stop
+inc *r0
+jmp L356
+red *r7
+L355: dec L356
+stop
+
+dec L357
+add L358, r1
+L356: bne L359
+L357: lea L359, r2
+not L359
+
+lea L358, *r6
+L358: stop
+; comment
+L359: stop
+red r5
+jmp L228
+cmp r1, #-23
+rts
+stop
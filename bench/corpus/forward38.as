@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 39
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: bne *r6
+red r7
+mov *r1, r5
+not L275
+mov r7, L166
+add *r6, L307
+prn r2
+bne *r3
+lea L194, L281
+add *r6, *r0
+rts
+stop
+dec r6
+L1: add r7, r0
+L2: dec r3
+cmp *r0, L133
+stop
+jsr L79
+add r6, *r4
+L3: inc r3
+L4: prn #2
+add #-17, *r5
+L5: mov L70, *r2
+clr L281
+mov #-45, *r2
+stop
+bne L78
+bne L212
+bne L62
+clr *r3
+; comment
+cmp *r5, r1
+add *r7, *r1
+stop
+clr *r1
+stop
+dec r6
+lea L238, L137
+L6: .string "q"
+L7: mov #247, *r6
+jmp L205
+stop
+rts
+L8: stop
+not r3
+inc L164
+bne L56
+L9: lea L137, r4
+jsr *r7
+inc L111
+L10: .data 833, -14, -145, 251, 666
+L11: clr L226
+red *r0
+prn #77
+rts
+L12: lea L65, r6
+L13: add r1, r5
+red r7
+L14: .data -406, -466, 250, 561, -994
+mov r7, *r7
+L15: bne L203
+add #-20, r3
+L16: .string "acysaapgdekjpeelb"
+L17: add L170, L33
+cmp L31, *r3
+L18: not r7
+L19: rts
+inc r7
+L20: lea L179, *r0
+L21: not r3
+not *r5
+
+L22: sub *r4, r2
+sub *r3, r5
+L23: rts
+L24: mov r7, *r0
+bne *r4
+jsr L72
+lea L75, r3
+add #151, *r6
+clr L316
+rts
+lea L329, *r0
+L25: stop
+L26: mov #217, r2
+lea L241, r4
+cmp L127, r3
+mov *r3, *r2
+L27: add #-115, L308
+bne L300
+sub r5, r3
+stop
+mov #-91, L160
+L28: rts
+prn L172
+cmp r1, r7
+L29: .string "fozukjgbwrskh"
+rts
+rts
+inc r7
+add L281, r3
+sub #63, *r4
+L30: red L259
+mov L229, r5
+inc r5
+jsr *r5
+lea L314, *r2
+stop
+red r2
+L31: cmp r3, *r5
+dec r1
+L32: lea L287, L263
+L33: bne *r4
+prn r1
+inc L41
+jsr L68
+L34: .string "xwee"
+lea L201, r1
+L35: .data -775, 676, -123, -100, -742
+mov #217, r1
+L36: lea L235, *r7
+L37: lea L208, *r0
+dec L296
+jmp *r2
+L38: rts
+prn #86
+bne L155
+; comment
+add L137, *r3
+inc *r7
+prn L251
+bne L208
+lea L275, r6
+; comment
+rts
+L39: .string "ffbrdqhmq"
+jsr *r0
+L40: mov L310, *r5
+clr L126
+rts
+L41: add r1, *r7
+L42: cmp #-93, *r0
+L43: .string "ovbrdtmgczhsafaa"
+dec r6
+clr L142
+mov #-7, L141
+add L128, *r4
+prn *r4
+L44: .string "scqeufmqniizzinr"
+not r2
+not L153
+L45: inc r1
+red L164
+L46: inc r1
+L47: cmp L58, r2
+red L289
+cmp r7, #25
+L48: add r7, *r1
+mov L51, *r2
+L49: rts
+clr L317
+L50: sub L143, *r0
+cmp r6, r1
+; comment
+mov #70, r3
+stop
+L51: .string "kygbuvjqbkmzeuuknnabl"
+rts
+jsr *r4
+L52: .data -315, 453, -440, -121, -794, -392, 702, 298
+cmp r1, L218
+stop
+red *r3
+red r5
+lea L170, r5
+dec L113
+L53: .data 860, -393, 8, 341, -732, -77, 867, 525
+L54: prn *r7
+clr *r3
+jsr *r1
+mov *r1, L135
+L55: inc L258
+L56: mov #6, *r7
+dec *r4
+jmp *r2
+L57: dec r2
+jsr *r0
+L58: rts
+lea L321, r2
+mov L206, r7
+cmp #-184, #148
+rts
+prn #-188
+cmp r5, L177
+jsr L197
+prn L189
+prn #-26
+cmp L118, #-204
+lea L93, L153
+add r7, r6
+inc *r1
+L59: dec L150
+L60: not L295
+inc r3
+L61: sub r0, *r3
+inc L95
+rts
+jmp L161
+clr r2
+not *r2
+cmp r5, L95
+L62: dec r4
+stop
+L63: red r1
+red r3
+dec L228
+
+L64: jmp L304
+L65: sub #46, r4
+L66: .string "kfpcxly"
+stop
+jsr L259
+stop
+L67: .string "msppozhedixuisuruelbqkl"
+L68: jsr L295
+prn L111
+not *r7
+jsr L103
+rts
+L69: red L256
+jsr L87
+red *r5
+
+clr r6
+lea L177, r0
+L70: red L293
+prn r2
+inc r3
+L71: prn #30
+L72: sub r3, r2
+L73: .string "mlzqkuqdchrlqogtomvxpv"
+red r1
+lea L180, L114
+mov L137, *r2
+rts
+cmp #-215, L339
+sub #-78, r0
+L74: sub L186, L149
+L75: bne *r4
+cmp #43, #-22
+jsr *r5
+L76: mov L121, *r3
+L77: red r4
+prn #-159
+not *r5
+not r6
+L78: add #-123, *r2
+rts
+dec *r6
+jmp *r2
+lea L171, L179
+L79: sub #-238, L94
+mov r2, r3
+red *r0
+L80: rts
+dec *r5
+stop
+inc r7
+red r4
+L81: .string "ertamjdlmicptogktjmztxuz"
+L82: prn #-27
+L83: prn #-7
+L84: stop
+dec *r2
+not L100
+rts
+L85: .string "c"
+bne *r2
+L86: jmp *r6
+L87: .data -423
+bne L154
+not r5
+bne *r7
+stop
+L88: not *r7
+; comment
+L89: clr r5
+L90: mov r1, L151
+L91: prn #9
+L92: not *r0
+L93: lea L157, L155
+mov *r2, *r6
+stop
+L94: sub r7, *r3
+not *r6
+stop
+inc *r4
+clr r6
+cmp #97, #-166
+L95: .data -828, -467, 876, 179
+prn r1
+add L217, L128
+dec r4
+jsr L188
+sub L130, L183
+jmp *r7
+bne *r7
+bne L194
+cmp #179, *r6
+L96: not *r2
+inc r3
+not L113
+rts
+L97: bne L298
+L98: dec r0
+red r4
+L99: sub #4, L145
+add #-32, L184
+L100: red L338
+not L296
+lea L321, *r7
+mov L197, r7
+
+inc r0
+not *r1
+L101: mov *r4, L283
+L102: jsr L328
+L103: add #15, r7
+jmp *r6
+jsr L273
+stop
+lea L288, *r0
+prn #26
+prn L108
+L104: sub *r5, *r1
+L105: rts
+L106: .data 582, -354, 126
+stop
+L107: prn *r5
+not L203
+mov L240, *r1
+L108: clr L214
+L109: not L255
+inc L298
+L110: sub #79, r3
+L111: add r4, *r5
+; comment
+rts
+stop
+sub r4, *r5
+; comment
+mov *r4, *r3
+
+L112: jsr L155
+cmp #97, L315
+bne *r0
+L113: not *r7
+jsr L184
+mov r6, r2
+dec L287
+L114: bne L157
+sub L192, *r2
+red r3
+L115: dec r0
+lea L172, *r1
+jsr L217
+not *r6
+red r1
+clr r5
+jsr L288
+sub r1, r2
+jsr *r4
+red r3
+L116: jsr L168
+mov #165, L245
+prn L323
+jmp *r2
+rts
+inc *r3
+inc L313
+stop
+
+prn r2
+not *r1
+add r6, *r5
+red L338
+L117: jmp L319
+L118: lea L228, L258
+L119: dec r5
+L120: not L317
+jsr L241
+L121: sub r5, r3
+L122: add *r7, r0
+red L270
+mov #-104, L280
+; comment
+bne *r4
+add *r1, r5
+; comment
+rts
+clr r6
+inc r6
+cmp #-194, *r7
+L123: dec r6
+clr r0
+L124: dec *r7
+clr L153
+dec r6
+red L149
+L125: mov *r3, *r6
+lea L187, *r2
+lea L273, r4
+jmp *r3
+; comment
+cmp #68, #-170
+
+bne *r4
+jsr *r7
+L126: add r1, r4
+L127: .string "kjyjvfgzukyqmxejeddgv"
+cmp *r0, L222
+sub *r4, L303
+prn L311
+L128: .string "nirqbswclnnifevwxaacnyrp"
+L129: cmp L247, *r4
+prn L162
+mov #46, r1
+L130: dec L165
+add *r7, *r1
+L131: stop
+inc L260
+rts
+L132: clr *r4
+bne *r7
+sub *r0, r0
+stop
+L133: .data 385, -158, -387, -454, 347, -854, 323
+L134: jmp *r2
+L135: mov #-95, *r4
+L136: dec *r3
+L137: .string "rpyorybiewfjzthfnxy"
+L138: .data -237, -695, 420, 827, -721, -246
+add L181, L248
+add *r5, r5
+inc r3
+lea L242, L258
+jsr L161
+mov #-76, *r4
+L139: cmp *r5, *r5
+clr L239
+red *r7
+L140: clr L222
+L141: jmp *r6
+L142: cmp L156, #-225
+L143: not *r4
+jsr *r7
+prn r0
+L144: prn #-125
+lea L258, *r3
+L145: mov *r4, r1
+L146: sub #40, *r2
+L147: jsr L205
+L148: .data -35, -422, 115, 784, 139, -967, -824, 101
+prn L228
+jsr L182
+red L260
+cmp #-220, L225
+dec L272
+L149: clr *r6
+lea L163, L335
+add *r4, L198
+L150: red r5
+mov L214, *r4
+prn #244
+L151: .data -82, -695, -246, -657, 277
+L152: cmp #172, #-32
+cmp #-212, r3
+; comment
+L153: .string "cydlgiqvbwsmeeadwsrl"
+L154: .data -540, -891, 963, -226
+stop
+mov r5, *r2
+prn L247
+clr *r3
+cmp L203, #28
+cmp #-201, L170
+L155: prn L197
+jsr *r5
+red r4
+lea L298, *r6
+L156: prn *r2
+clr r5
+lea L335, L220
+red r4
+L157: .string "yxadgdpuvy"
+red r1
+jsr *r6
+; comment
+add *r2, r1
+L158: .string "pjuwiq"
+dec r6
+L159: cmp r5, r7
+L160: red *r5
+prn L263
+L161: dec r2
+sub *r5, r7
+red r2
+L162: lea L327, *r7
+; comment
+sub *r1, *r3
+L163: add r2, L285
+mov r7, r2
+L164: not *r3
+L165: lea L266, *r3
+L166: sub *r4, L223
+L167: .data 420, -234
+L168: .data -950, 883, -225, -209, 793, -499
+inc r0
+red r2
+; comment
+L169: .string "iyiyzx"
+cmp *r5, #22
+
+L170: clr L221
+; comment
+prn *r5
+lea L184, *r5
+red *r6
+rts
+L171: rts
+inc r0
+L172: .data -432
+not r2
+L173: lea L228, r7
+L174: cmp *r7, *r2
+L175: stop
+rts
+L176: .string "zijvhpbcrvox"
+L177: jsr L321
+L178: stop
+rts
+L179: stop
+L180: .string "imekuxj"
+add r1, L303
+L181: lea L217, *r1
+prn L270
+L182: cmp L258, r3
+clr r4
+rts
+L183: jmp *r0
+sub *r6, r1
+not L211
+L184: not *r4
+prn L260
+red L202
+jmp *r7
+dec *r6
+cmp L331, *r0
+L185: .string "nlqxknmqqzhkzqleejrmu"
+L186: .data 785
+L187: clr r7
+prn #249
+stop
+L188: mov L284, r4
+jmp L259
+jmp L337
+; comment
+bne L328
+prn L338
+bne L237
+not r3
+L189: not *r4
+L190: .data 969
+L191: dec L230
+L192: .string "rtrevvkoxsd"
+cmp *r2, *r0
+rts
+L193: .data -299, -339, -577, 185
+bne L321
+; comment
+L194: clr r1
+L195: .string "r"
+L196: .data -633, -383
+not L338
+add #148, *r1
+L197: rts
+clr *r0
+; comment
+lea L240, r3
+bne L317
+bne L333
+L198: clr L220
+jmp *r2
+L199: clr *r3
+red L261
+L200: .data 709, -122, 700, 64, -527
+L201: prn r7
+bne L252
+mov #110, r5
+inc r1
+L202: .string "waayxxtrisytcwehzfp"
+L203: red L274
+lea L317, *r1
+jsr L253
+red *r2
+cmp *r6, #-183
+cmp r2, *r0
+jmp L312
+prn #-55
+L204: inc L280
+L205: lea L303, r5
+L206: jsr *r5
+L207: .data -120, 888, 450
+bne *r3
+mov *r7, r6
+add L300, L313
+clr L216
+L208: sub L289, *r3
+clr *r4
+L209: rts
+prn L326
+; comment
+L210: rts
+L211: jmp L225
+prn r5
+clr *r4
+rts
+inc L295
+lea L328, r4
+; comment
+; comment
+not L336
+L212: jsr L341
+L213: red r2
+L214: bne *r0
+L215: dec L240
+L216: red L230
+L217: jmp *r3
+stop
+bne L302
+mov r2, *r1
+L218: jsr L323
+add *r7, *r1
+jmp *r4
+
+; comment
+L219: lea L308, L298
+L220: rts
+mov *r3, r0
+L221: stop
+dec L267
+L222: dec r1
+rts
+sub L319, L270
+inc L297
+L223: jmp *r0
+L224: cmp *r6, #161
+bne *r5
+mov L331, r0
+jmp L245
+clr L284
+sub L341, L293
+inc *r2
+
+jsr *r0
+dec r2
+L225: .string "htaykmvhchovvfrpylsqyyf"
+prn *r2
+stop
+add L317, L298
+L226: .data 260, -884, -784
+jmp *r5
+clr *r6
+L227: add *r5, L297
+; comment
+sub r1, L285
+dec *r2
+; comment
+add *r7, r4
+L228: .string "qavjxhllsukfylkkqylau"
+sub *r1, L302
+stop
+L229: jmp L305
+stop
+stop
+rts
+L230: lea L260, r2
+L231: inc r3
+clr r5
+rts
+jsr L232
+cmp #-180, L337
+L232: bne L333
+L233: clr *r3
+rts
+rts
+add *r3, L253
+L234: sub *r5, *r7
+L235: .data -984, 246, -950, -70
+inc *r2
+dec r1
+rts
+jmp *r0
+lea L308, L295
+L236: .data -414, -378, -778, -961, 958, 94, 103
+L237: clr r3
+not *r1
+L238: .string "lzuytwhsxziijv"
+L239: prn r7
+lea L254, L263
+L240: prn *r7
+stop
+lea L323, r6
+clr *r0
+lea L256, L300
+stop
+L241: .string "iroi"
+dec r6
+L242: bne L335
+L243: add L338, r5
+
+bne *r5
+L244: stop
+; comment
+
+L245: .string "rblhgnjmvzzuws"
+not L329
+L246: clr r2
+cmp *r1, r5
+inc L331
+L247: clr L332
+L248: .string "fsdbfghvxnivvvegilplkn"
+bne *r2
+stop
+L249: not r5
+not L333
+add L293, *r2
+L250: rts
+rts
+sub *r1, r2
+sub r6, *r3
+clr r7
+lea L282, *r0
+jsr L263
+bne *r2
+L251: bne *r2
+L252: add r7, L313
+rts
+bne *r0
+prn L287
+dec r7
+stop
+L253: .data -75, 488, -316, 633, 910, -913, 678, -682
+jmp *r6
+stop
+L254: lea L301, L318
+mov #102, *r5
+L255: jmp *r7
+clr r1
+not *r6
+jsr L256
+L256: not L319
+jsr *r0
+L257: red r3
+L258: jmp L273
+mov #-212, L267
+sub L292, *r3
+L259: red *r2
+; comment
+L260: .data 750
+L261: cmp L333, #3
+prn #-9
+L262: inc L288
+not L296
+clr L270
+inc L282
+L263: .string "cmypbclgvs"
+sub #209, L271
+L264: dec r4
+dec *r5
+add #-228, L294
+not r1
+L265: cmp r7, L290
+L266: rts
+mov #-246, *r7
+not r3
+L267: dec r0
+inc L308
+jsr *r7
+L268: .data 174, 469, 423, 57
+not *r4
+prn L274
+stop
+bne L336
+cmp #-247, r1
+prn #80
+red L322
+stop
+L269: red r3
+dec r6
+clr *r7
+L270: rts
+not r1
+not *r3
+clr r7
+cmp L326, #122
+dec r2
+dec *r2
+prn #144
+dec *r2
+L271: jmp L276
+dec L278
+L272: .data -626, 290, 365, -989, 880, -133
+L273: inc L311
+mov L292, L333
+jsr L287
+prn r1
+L274: .string "dendzxofeuodgozfnwiab"
+dec L326
+inc L287
+bne *r0
+add #251, *r2
+; comment
+L275: .data -4, -637, -141, 939
+jmp *r5
+prn L318
+not L282
+clr *r2
+red *r0
+jmp *r6
+; comment
+L276: not r3
+L277: red r2
+L278: not r2
+stop
+bne *r1
+clr *r1
+sub L279, r4
+add r5, r1
+inc r4
+L279: stop
+L280: .data 314, 254, -967, -689, 154, -163, 739, -581
+jsr *r1
+L281: mov L284, *r4
+L282: sub *r7, r3
+clr L329
+not *r7
+L283: lea L333, r3
+sub r1, *r3
+cmp r4, L320
+not *r3
+prn *r1
+stop
+prn *r7
+lea L337, r2
+L284: .string "hudseancsbimaoxmrp"
+stop
+
+L285: add *r0, L308
+clr L339
+
+
+not r3
+add #211, r3
+prn L318
+mov *r2, r4
+rts
+L286: .data 803, 889, 580, 940, -814
+sub r6, L334
+L287: lea L317, r5
+L288: .string "pnapzveicxxkbxeya"
+dec r6
+; comment
+L289: .data -227, 849, 611, -410, 499, 311, -740
+L290: not r0
+bne L321
+red L318
+not *r3
+L291: sub r2, r6
+dec r5
+L292: bne *r2
+red L315
+add #-189, r4
+mov #60, *r3
+L293: clr L297
+mov *r6, *r5
+; comment
+L294: prn #-18
+jmp *r2
+L295: bne *r5
+L296: cmp r7, r5
+L297: cmp r4, #245
+add r0, *r0
+sub L339, r6
+sub #-91, *r3
+L298: .data 959
+mov *r7, r2
+add *r7, r0
+sub r0, r5
+rts
+not *r3
+add #153, r2
+mov *r2, L303
+L299: not L332
+L300: inc *r3
+rts
+L301: .data 445, -923, 40, 830, -689, 799, -998
+L302: sub #-53, L304
+L303: .data 170, 401, -657, -899, 330, 279, -121, 910
+L304: sub r3, *r5
+prn #-175
+rts
+jmp *r7
+sub r6, *r4
+inc r6
+stop
+dec r7
+not *r6
+red r6
+not r6
+; comment
+bne L312
+L305: cmp *r0, *r5
+L306: bne L334
+stop
+clr L323
+L307: clr *r7
+not *r0
+L308: lea L329, *r3
+jsr L327
+L309: .data -773, -945, 447
+L310: prn r2
+prn r1
+L311: clr L336
+mov #-135, r5
+jmp L340
+L312: bne L335
+L313: sub *r1, r5
+L314: not r4
+rts
+prn r3
+not *r6
+add r1, r3
+clr L329
+jsr L323
+jsr L317
+L315: not r0
+L316: stop
+L317: .string "ssiignlmqpvooewpdmbmjddb"
+prn *r2
+bne L330
+red *r3
+L318: inc *r3
+L319: dec r3
+L320: inc r6
+stop
+L321: stop
+L322: mov #254, r5
+L323: stop
+L324: not L336
+L325: .data -184, -656, -200, -345, -832, -199, -453
+L326: stop
+L327: sub r5, r4
+L328: lea L339, r7
+; comment
+cmp #13, #-108
+jmp *r2
+rts
+lea L336, L333
+lea L331, r0
+L329: bne L335
+L330: add *r4, r3
+
+inc r1
+L331: stop
+L332: red *r6
+jsr L340
+sub L336, L339
+mov r6, r0
+stop
+L333: .string "envbqslhhal"
+L334: .data -6
+not r6
+L335: red L339
+L336: dec L337
+mov L337, r6
+add #93, *r4
+L337: lea L338, *r0
+L338: jmp L340
+red L340
+add L340, L341
+L339: .data 75, 720, 299, -952, 488, 323, -848
+L340: prn r6
+prn *r5
+L341: not r2
+mov r0, L58
+not *r1
+lea L65, *r6
+inc r1
+not *r6
+stop
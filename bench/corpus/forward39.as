@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 40
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: prn #86
+sub #-246, L244
+L1: rts
+cmp *r0, #160
+dec *r6
+jsr *r1
+dec *r5
+prn *r4
+L2: clr L287
+lea L293, r1
+prn #-241
+jmp L23
+inc *r6
+L3: dec *r4
+rts
+L4: .string "dxzbelbxxfwbbylaux"
+rts
+cmp L319, *r3
+clr *r5
+L5: clr L189
+prn L71
+L6: mov #74, r3
+not *r0
+L7: cmp r1, *r2
+jmp *r1
+L8: .data -801, -147, 797, 139
+prn #250
+jmp *r5
+L9: cmp L228, r2
+L10: stop
+lea L216, L257
+L11: clr L269
+bne *r3
+sub #-183, r0
+bne L37
+stop
+L12: inc r4
+L13: .data 271, -254, 440, -371, 762, 413
+clr *r0
+dec L141
+sub L205, *r6
+L14: prn *r0
+L15: prn *r6
+L16: sub r4, L316
+L17: .data -878, -733, -749, 459, -537
+not *r2
+; comment
+L18: red L136
+stop
+not *r6
+L19: add *r3, L217
+L20: cmp L98, #-42
+bne L74
+not r1
+L21: .data 245
+; comment
+clr *r4
+L22: .data -338, 760, -187, 919
+bne L311
+jmp L124
+L23: prn r6
+inc L190
+bne L139
+dec *r0
+L24: .data 918, -768, -845, 201, 798, 684
+jmp *r7
+clr *r1
+L25: not L298
+dec *r3
+stop
+L26: bne *r7
+L27: sub L329, *r6
+L28: not *r0
+L29: cmp #143, L245
+
+rts
+inc r7
+L30: .string "xawiylxvzrnurvtfoxob"
+not *r7
+add *r1, *r3
+L31: .string "nnlfycrku"
+mov L238, r1
+add #-9, r3
+L32: add L140, *r2
+add #206, r4
+cmp #-119, L257
+L33: .data 597, -864, -68, -940, -901, -759, -691
+red *r0
+mov r4, r4
+L34: .string "yruwwygsel"
+inc r6
+rts
+sub r3, *r1
+bne *r3
+inc *r2
+mov r6, L144
+jsr L139
+rts
+L35: red L37
+L36: .data -624
+jsr L230
+jsr *r5
+dec *r3
+inc *r4
+L37: rts
+stop
+L38: red L219
+not r1
+clr *r7
+clr r5
+L39: jsr *r4
+lea L89, r5
+L40: not r1
+L41: bne *r1
+stop
+; comment
+L42: rts
+L43: jmp L278
+stop
+L44: .string "xxyebhdveryawk"
+L45: mov L301, r0
+L46: prn #96
+rts
+jsr *r3
+L47: inc *r2
+red L61
+dec *r6
+rts
+mov *r2, r4
+clr *r2
+rts
+L48: .data 409, 194, 698, 186
+stop
+cmp *r7, r7
+L49: .string "jbdtsxpwnqve"
+L50: bne *r7
+L51: rts
+L52: add #15, r5
+clr r6
+L53: jmp *r5
+sub #-125, *r5
+dec *r5
+rts
+; comment
+jsr *r1
+jmp *r2
+clr r3
+red r2
+rts
+stop
+L54: inc L308
+L55: .data 122, 171, -756, -698, 836
+L56: .data -506
+add *r2, L114
+not *r0
+sub r5, L310
+jsr *r1
+L57: bne L60
+L58: sub #4, r5
+cmp r4, *r7
+stop
+not r1
+L59: jsr *r5
+L60: clr r5
+add *r6, *r3
+
+not *r5
+lea L189, r1
+L61: .data -733, -194, -646, -553, -945, 525, -631, 652
+L62: not *r6
+lea L261, r4
+L63: mov L195, *r4
+jsr *r1
+clr L251
+stop
+lea L322, L68
+bne L234
+
+rts
+red r3
+lea L122, *r7
+L64: .string "mlkdocdugvov"
+L65: dec r6
+L66: mov #-112, *r2
+sub #9, r2
+L67: .data 22
+mov L341, *r6
+not L72
+jmp *r1
+inc *r5
+lea L105, r6
+L68: bne L275
+
+sub r4, *r1
+add #185, *r6
+L69: .data -918, -314, 392, 227, 338
+not L248
+L70: sub #-226, r0
+rts
+inc *r7
+L71: mov r7, L77
+not *r1
+bne L155
+not r0
+dec L338
+dec L126
+red *r5
+L72: jmp *r7
+bne *r5
+clr L81
+lea L255, *r7
+mov *r1, *r1
+bne L270
+not L229
+add #-131, L144
+clr r2
+L73: red L289
+mov *r3, r3
+rts
+L74: lea L84, r3
+L75: dec r2
+clr L81
+red r6
+L76: prn L302
+sub *r4, r2
+L77: mov #57, L81
+L78: .string "tkfjdkhiqrwqzeefalqdqdpf"
+sub L220, L186
+stop
+L79: red r6
+L80: lea L96, *r3
+not *r3
+lea L243, L215
+L81: prn r0
+red *r6
+lea L171, r7
+jmp *r3
+red r1
+L82: .string "ugoeazkjix"
+L83: sub #-97, L124
+L84: bne L175
+L85: add r0, r5
+L86: dec r1
+bne *r0
+L87: jsr *r7
+L88: .string "pxakryzdplupl"
+jmp L102
+L89: inc *r7
+dec r0
+mov *r6, r5
+clr r4
+L90: rts
+sub L128, r7
+L91: .string "rld"
+L92: .string "dgnhdgmtjiuljzzdgmeiq"
+L93: .data 211, 778, -201, -990, 258, -592
+L94: mov #-251, r6
+prn r0
+sub r7, *r2
+add L180, L125
+stop
+bne *r3
+clr L103
+clr *r6
+L95: .string "zewkzatmhegsosqsxl"
+L96: .string "fboelapvgsescavzufinw"
+dec r1
+dec L171
+L97: .string "qlcpobefurekhamm"
+lea L216, L263
+L98: jsr *r4
+L99: sub L201, L338
+mov *r5, *r7
+jmp *r5
+dec L275
+prn *r2
+jsr L284
+L100: stop
+sub *r3, L249
+L101: .data 988, 795, 584, 638, 106, -785, -364, -45
+dec L110
+bne *r2
+L102: add L221, r7
+L103: stop
+L104: clr r5
+; comment
+L105: .string "l"
+L106: inc *r6
+stop
+L107: add *r3, *r2
+L108: lea L156, L110
+L109: jmp L246
+L110: bne *r2
+lea L126, *r7
+L111: bne *r2
+mov L282, *r4
+clr r7
+clr L339
+L112: cmp *r0, r3
+mov *r7, r1
+bne L334
+L113: jmp L323
+L114: red *r5
+not r0
+red r2
+cmp r1, #251
+clr L246
+mov #-148, *r6
+L115: .string "wqjbsaytqbsagyjwx"
+inc L201
+L116: bne L150
+jsr *r7
+L117: add #-179, L209
+red r7
+bne L264
+lea L292, L297
+not L216
+cmp *r5, r5
+red r4
+lea L131, L176
+L118: clr L145
+inc L250
+red r5
+bne L298
+L119: dec *r5
+L120: cmp r0, L271
+cmp L177, L155
+jmp L311
+
+L121: .string "engqzqx"
+lea L331, L222
+bne L171
+L122: stop
+L123: lea L159, *r4
+L124: add L224, *r2
+red *r5
+red L338
+L125: lea L213, r2
+rts
+lea L332, r6
+
+inc *r5
+inc r5
+clr r6
+; comment
+not r2
+red *r1
+L126: .string "kglgt"
+L127: cmp *r2, *r0
+L128: jmp L168
+L129: mov *r7, *r4
+L130: prn *r3
+L131: jmp L302
+rts
+rts
+sub r1, r3
+mov *r3, *r2
+L132: bne *r7
+L133: jmp L224
+L134: not r4
+rts
+L135: add *r0, r3
+mov L299, r5
+jmp L276
+L136: stop
+cmp L172, r5
+L137: jmp L290
+mov r0, r0
+L138: prn #-213
+L139: sub L242, *r2
+lea L239, L268
+L140: .string "gyvfijjujkv"
+mov L343, *r5
+L141: prn #-202
+dec r0
+jmp L220
+red L254
+add #128, L284
+L142: lea L317, *r7
+mov L191, *r3
+L143: jmp *r5
+sub L262, r4
+L144: jsr L311
+L145: dec L215
+L146: red L213
+clr r4
+red *r5
+rts
+clr L214
+L147: .data -431, 419, -638
+stop
+add L332, L220
+L148: not L167
+bne *r6
+bne *r5
+lea L268, L307
+jmp L330
+L149: mov L174, r3
+not L282
+rts
+L150: cmp #185, #42
+inc *r2
+cmp L270, L205
+jmp L285
+red r2
+lea L243, r5
+bne L249
+add L331, *r2
+clr r6
+sub *r4, r3
+L151: mov L164, *r7
+L152: .string "gamohrntugytfvga"
+L153: jsr *r4
+inc r7
+not *r1
+mov L172, *r1
+L154: bne L342
+dec r5
+L155: red *r4
+red r0
+bne L341
+clr *r6
+
+L156: clr r3
+clr *r4
+rts
+L157: jsr *r4
+jmp *r5
+prn r5
+inc r4
+L158: stop
+stop
+lea L245, L195
+L159: .string "xcdlflcuahhqrffnurj"
+rts
+bne L178
+L160: stop
+L161: rts
+bne *r1
+sub L212, L289
+bne L319
+L162: add #-189, L198
+add #-125, L213
+L163: rts
+L164: .string "lwsvemr"
+L165: rts
+L166: jsr *r2
+lea L311, r7
+jmp L267
+bne L239
+L167: mov L218, r3
+cmp r2, r3
+lea L171, r4
+lea L187, L205
+L168: .data -698, 495, 940, 303, -361, -691, -712, -835
+prn #-229
+lea L188, L207
+lea L200, r7
+sub #67, *r3
+lea L210, r4
+clr r1
+; comment
+L169: .string "vmbuwjmsihrkzdrnbzsmtvg"
+add L283, *r5
+prn #174
+jsr *r7
+bne *r0
+L170: .string "aos"
+L171: .data 860
+mov L197, L241
+jmp L340
+L172: bne *r5
+L173: sub *r6, L291
+L174: jmp *r1
+L175: rts
+L176: mov L237, *r4
+L177: stop
+clr L320
+L178: prn r3
+L179: mov L321, *r5
+red *r7
+prn L317
+L180: red *r4
+L181: inc *r0
+rts
+L182: add #-52, *r1
+red L255
+sub r5, r4
+L183: rts
+lea L276, r0
+L184: bne L323
+L185: .string "fibcuomgwa"
+red *r5
+L186: .string "kj"
+lea L206, r0
+jmp L204
+prn r2
+clr L242
+bne L258
+jsr *r3
+dec L250
+L187: .data -103, -817, -489, 786, 151
+clr *r0
+not *r7
+L188: .string "xm"
+dec r4
+L189: prn #-191
+L190: jsr *r3
+bne L348
+
+jsr *r3
+sub r2, r0
+jsr *r0
+add #-167, *r4
+L191: jmp *r2
+
+
+lea L348, L311
+L192: .data 661
+prn #59
+L193: lea L292, r4
+jsr L264
+inc r5
+jsr *r2
+lea L264, *r1
+rts
+L194: jsr L272
+L195: not r6
+jmp *r4
+L196: .string "a"
+; comment
+clr L228
+bne *r2
+jsr L275
+dec L246
+inc *r7
+L197: .string "mbpnsnsvxw"
+jsr *r7
+L198: prn L329
+clr r5
+not *r0
+lea L286, *r2
+jmp L261
+prn L303
+; comment
+not L260
+L199: not L269
+L200: jmp *r2
+L201: clr L243
+jsr *r7
+lea L253, *r6
+rts
+jmp *r6
+dec *r7
+prn r4
+jsr L224
+jsr *r6
+L202: cmp *r4, *r3
+stop
+dec L253
+lea L250, r5
+clr r5
+L203: add r3, r6
+lea L215, r7
+L204: jsr L220
+jmp *r4
+mov r1, r5
+red r3
+mov #131, *r1
+lea L304, *r5
+sub r2, *r3
+L205: mov *r5, L230
+clr *r3
+stop
+sub #-153, *r0
+
+L206: stop
+not *r2
+L207: rts
+L208: rts
+prn *r4
+L209: .data -861, 33, 592, 494, -145, -219
+clr L225
+prn #-5
+stop
+sub *r7, r6
+jmp *r4
+L210: .string "phnbmitngo"
+L211: cmp *r7, r0
+not *r2
+L212: jmp *r3
+jsr *r6
+L213: bne L273
+; comment
+; comment
+prn L342
+jsr L339
+L214: jsr *r0
+lea L215, *r1
+L215: bne L275
+jmp *r0
+dec r5
+red *r1
+L216: .string "cslukppxdlnxjko"
+bne L258
+lea L280, L297
+red L288
+L217: stop
+jsr *r2
+red L327
+L218: mov r0, r1
+L219: inc r1
+cmp L252, L338
+
+L220: add L289, L226
+L221: cmp r2, *r7
+
+clr *r2
+cmp r6, *r0
+; comment
+L222: red r1
+L223: bne *r5
+not L272
+inc r7
+L224: inc r7
+L225: dec r2
+L226: dec *r2
+jmp *r6
+
+sub L348, L283
+L227: .data -219, -925, -143, -860, -298, -778, -42, 522
+inc *r2
+L228: bne *r7
+stop
+L229: red r4
+not L243
+L230: prn #-109
+
+stop
+rts
+rts
+L231: .string "eevxdnzxicsmovdpapkclua"
+lea L282, r0
+
+not L263
+; comment
+jmp *r2
+stop
+mov r3, r0
+stop
+mov #183, *r7
+not *r1
+rts
+L232: bne L297
+not r5
+L233: add #192, *r3
+bne *r2
+L234: dec L299
+L235: jmp L340
+L236: rts
+mov r3, L331
+L237: mov r6, L323
+jsr L296
+prn L335
+L238: jsr L344
+rts
+sub r5, r2
+stop
+inc r1
+not *r3
+bne L348
+dec r0
+L239: jmp L315
+not L277
+bne *r5
+rts
+clr L283
+L240: mov L256, *r2
+L241: clr L257
+stop
+L242: not r2
+L243: .data -453, 356, -174, 665, 22, -366, 444
+L244: sub #240, *r3
+lea L259, *r7
+add #-19, L295
+prn r7
+L245: not r3
+bne *r0
+L246: .data -466, -436, -453, -287, 513, 276
+L247: .string "wftoxjltke"
+L248: .data -471
+prn L332
+bne *r3
+lea L342, r7
+L249: mov *r7, *r5
+stop
+lea L319, *r2
+rts
+add L327, *r1
+add #18, L345
+L250: prn L303
+cmp #-64, *r1
+L251: clr L286
+jmp L277
+sub #-114, *r5
+jmp *r2
+L252: jsr *r3
+cmp L295, *r0
+L253: dec L266
+L254: bne L326
+L255: stop
+L256: not r1
+rts
+add r3, *r0
+L257: rts
+dec r4
+dec r7
+jmp *r6
+jsr *r4
+stop
+L258: not r6
+prn L259
+sub *r3, L274
+prn L313
+red L319
+clr L287
+not r7
+jsr *r4
+mov #-49, r1
+prn r0
+jmp L308
+lea L259, L308
+L259: inc L344
+red r6
+red L349
+jsr L333
+L260: .string "buznvlnxqhkne"
+lea L332, *r5
+L261: stop
+jsr L321
+prn L267
+; comment
+L262: rts
+L263: .string "fyhjzldvmjzgfuxthquv"
+cmp #26, L303
+lea L300, *r6
+L264: jsr L291
+stop
+bne L303
+L265: rts
+L266: sub *r5, *r0
+dec *r3
+L267: .string "bukvscmppfltx"
+jsr *r7
+L268: stop
+L269: bne L324
+red L321
+clr *r5
+lea L325, L338
+dec L296
+lea L294, *r4
+not *r3
+inc r2
+L270: inc r7
+L271: .data -75, -738, -125
+stop
+sub r1, L345
+red r2
+lea L314, *r0
+prn L327
+dec r7
+; comment
+rts
+jmp L340
+stop
+L272: sub r7, L327
+red *r4
+L273: stop
+jsr *r3
+rts
+add L316, *r6
+dec r4
+L274: .data 990
+add #99, r1
+rts
+L275: lea L313, L333
+red *r0
+mov r7, *r2
+L276: inc L308
+sub *r1, L282
+stop
+jmp *r7
+L277: bne L283
+stop
+L278: sub #6, r0
+jmp *r0
+add L346, L294
+stop
+L279: bne L348
+L280: not *r3
+mov #-111, r4
+bne *r5
+stop
+lea L325, *r4
+sub *r1, L338
+rts
+dec L312
+L281: red *r0
+sub *r5, L348
+dec *r1
+inc *r0
+L282: bne L285
+lea L316, L324
+L283: .data 79, 966, 700, -363, -594
+L284: sub L336, r1
+L285: .string "xzzpw"
+jmp *r0
+clr L308
+L286: prn *r4
+L287: not r1
+cmp #43, #-91
+L288: .string "zglejbheutfolfim"
+add *r6, r5
+clr L295
+L289: .string "akbyjuz"
+bne L309
+cmp r1, L293
+L290: .string "jsvrnfjcearzcfuacspceyof"
+mov #-41, L291
+; comment
+; comment
+L291: jmp L297
+L292: stop
+dec *r3
+prn L317
+L293: .data -80, -493, 211, 795, -50, 963, 951
+L294: mov *r1, *r6
+rts
+jmp *r5
+L295: .data 925, 384, -769
+dec L330
+L296: sub L314, L299
+L297: add *r4, *r2
+clr L307
+mov #208, *r2
+red *r1
+sub #-113, L339
+clr L336
+L298: .string "hdsbibktkuhe"
+L299: inc *r1
+lea L308, *r1
+prn *r3
+red *r6
+bne L340
+mov #-238, *r0
+clr *r7
+L300: bne L331
+L301: sub L342, *r5
+sub L335, *r3
+jmp *r5
+cmp L323, #124
+L302: prn L306
+prn L342
+cmp L339, r3
+lea L321, r5
+jsr *r7
+not L305
+inc r2
+mov #-57, *r2
+inc L325
+cmp *r3, *r5
+prn r7
+L303: cmp *r2, #189
+red *r4
+mov #119, L321
+not L332
+prn L342
+L304: stop
+bne *r2
+red L324
+L305: .data -112
+L306: rts
+L307: cmp r4, r7
+sub L309, *r1
+L308: dec L328
+inc r1
+L309: sub *r5, r2
+red r6
+red L313
+bne *r7
+rts
+jsr *r5
+bne *r7
+L310: inc L326
+L311: .string "uciz"
+L312: .string "uelkjsze"
+L313: add *r1, L342
+jsr L320
+L314: sub L347, L349
+rts
+L315: .string "spvkfrtonpgkarwkjfzciq"
+inc L343
+add L326, L330
+lea L320, r6
+red *r7
+inc *r0
+L316: cmp L344, *r2
+add L326, *r5
+not L334
+L317: bne *r6
+L318: jmp L335
+red L330
+L319: inc r3
+dec r3
+add L343, *r5
+L320: dec *r4
+L321: add L333, *r4
+stop
+L322: .string "ywkrif"
+sub L327, *r0
+L323: bne *r7
+mov *r2, *r3
+L324: clr r1
+cmp L338, r4
+L325: red r3
+add *r4, *r5
+dec r4
+L326: .string "lry"
+dec r5
+cmp r1, #-68
+L327: red r2
+dec L337
+L328: .string "wsqwhhgveugt"
+
+jmp L337
+
+L329: .string "k"
+bne *r6
+jsr L335
+lea L338, *r0
+jmp *r2
+lea L330, *r6
+jmp L344
+L330: .string "clswullmphpysfxitscel"
+not r1
+stop
+L331: not *r0
+sub L344, r3
+L332: red *r3
+L333: clr L347
+mov r4, *r3
+rts
+L334: bne *r5
+prn r0
+clr *r1
+prn L348
+L335: .data 48, -730, -276, -265, 287, 463, 253
+L336: cmp *r4, #-199
+L337: red *r0
+stop
+L338: red r7
+jsr L342
+clr *r4
+
+L339: cmp *r2, L348
+L340: red *r6
+jmp L346
+
+bne L349
+jsr L345
+L341: dec *r5
+L342: mov r5, L347
+jmp *r4
+L343: mov r6, *r0
+dec *r2
+dec *r4
+L344: prn L349
+L345: red *r3
+sub r7, L347
+L346: jmp L347
+stop
+not r5
+add *r3, L347
+prn #-28
+L347: bne *r5
+cmp #240, r1
+jsr L349
+rts
+not L349
+L348: add L349, r5
+mov r2, r2
+stop
+L349: .data -872, 854, 864, -848, -654, -155
+
+bne L118
+rts
+rts
+; comment
+dec L237
+stop
+stop
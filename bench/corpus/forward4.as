@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 5
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+prn L56
+inc r1
+; comment
+stop
+L0: add #17, r7
+jsr L115
+rts
+inc L284
+sub L40, L46
+L1: sub *r2, *r2
+jmp *r1
+inc L236
+dec r1
+L2: bne *r5
+clr *r0
+stop
+clr r5
+bne L148
+jmp L306
+not L292
+lea L58, L336
+stop
+prn *r3
+dec r5
+cmp *r5, #-150
+L3: .string "fey"
+inc L101
+prn r2
+lea L6, r0
+bne L245
+L4: .string "iucdgksfjhmuqmmipsdm"
+stop
+red L275
+stop
+cmp *r7, #-19
+sub *r1, *r4
+rts
+lea L19, *r3
+dec *r3
+add #10, *r3
+lea L163, L44
+stop
+L5: .data 761, 972, 142, -109, 855, 561, -247, -353
+L6: .data -484, 980, 438, 957, 678, 487, -420
+inc *r3
+; comment
+L7: lea L273, r5
+mov #-107, r1
+L8: mov r5, *r7
+prn r1
+clr L233
+L9: stop
+jmp L231
+red L245
+L10: mov L83, *r0
+L11: .data 72, 582, -663, -959
+L12: stop
+red *r7
+L13: jmp L16
+bne L261
+stop
+clr L53
+L14: .string "glrtkgppdolemejhhatfve"
+cmp #-116, L259
+; comment
+stop
+rts
+L15: stop
+lea L338, *r2
+add *r3, r7
+inc r5
+jsr L17
+not L303
+stop
+sub r3, r5
+red r4
+inc *r4
+L16: lea L298, r3
+prn r3
+L17: bne *r6
+lea L51, *r3
+bne *r3
+prn r1
+jsr L247
+sub r7, r7
+not *r1
+jmp *r5
+mov *r1, r1
+jmp *r6
+stop
+L18: stop
+mov r5, r1
+add r2, *r1
+bne *r6
+rts
+mov r4, *r2
+L19: add *r7, L282
+; comment
+L20: clr *r3
+L21: prn *r5
+L22: jsr *r1
+stop
+jsr *r0
+L23: clr r1
+not *r4
+add #-219, *r6
+red *r4
+L24: bne *r2
+add r0, L100
+rts
+jsr *r5
+inc *r5
+L25: clr L99
+prn r3
+inc r7
+prn #141
+L26: cmp L189, L256
+L27: add L244, *r7
+L28: .string "wyajxrmtlbtxn"
+L29: .string "hlvnrumcfrctisdsmauarz"
+inc *r5
+not *r5
+prn #-246
+dec L81
+sub L128, *r6
+sub #252, *r2
+L30: .string "lnnibylet"
+mov *r4, *r2
+jsr *r1
+red *r3
+rts
+lea L182, *r6
+red L259
+rts
+sub r5, L171
+L31: jmp *r5
+dec *r7
+L32: lea L333, *r1
+sub *r6, L301
+lea L93, *r6
+
+dec r6
+lea L332, L124
+L33: .data -818, -358
+add #-59, r3
+inc r2
+L34: inc *r5
+stop
+clr L251
+lea L247, r3
+rts
+jmp *r6
+rts
+not r4
+cmp r0, L101
+L35: jsr *r4
+not r6
+sub r6, *r0
+L36: clr r7
+L37: dec L334
+L38: sub L88, r7
+L39: red r2
+rts
+L40: .data -296, -392, 905, 487, -373, 86
+prn L237
+rts
+L41: .data -272, 931, -961
+not L111
+prn #-87
+stop
+dec r4
+sub r5, r7
+not *r3
+prn L46
+L42: .string "fmozygmzxdxbjhlxoflqdzna"
+sub r5, *r0
+red *r7
+L43: .data 178, -939, -689, 263, 990, 604, -544, 344
+L44: jsr L167
+L45: prn *r0
+L46: .data 992, 551, -24, 965, 268, 113
+L47: .string "dq"
+dec *r0
+not L68
+L48: cmp L309, L179
+L49: bne *r7
+not L112
+sub L95, r3
+lea L303, *r6
+L50: .string "kqwaqkglrphkzsg"
+rts
+L51: inc r7
+clr *r4
+; comment
+L52: .string "gmtgtpjmjgsjugkdcto"
+L53: clr *r5
+L54: bne L304
+prn r5
+red r2
+stop
+jsr L121
+L55: dec L313
+L56: bne L176
+not r0
+L57: .string "czu"
+L58: bne L129
+add *r6, L154
+L59: dec r1
+L60: sub L188, *r6
+not L70
+L61: .data 190, -1000, 338, -148, 394, 668
+stop
+prn r6
+not *r1
+; comment
+inc *r0
+L62: lea L208, L249
+L63: jmp *r5
+L64: rts
+add L313, r0
+inc r4
+inc L273
+add L177, *r3
+bne L159
+jmp L89
+red r0
+add r5, r7
+L65: inc *r2
+L66: .string "uyt"
+stop
+cmp r2, r2
+L67: .data 992, 624, -753
+not L290
+mov L211, L130
+dec r6
+dec r0
+clr L205
+dec L327
+L68: .string "jmjyhbkxmdkwxgkbl"
+; comment
+L69: stop
+sub #227, *r6
+L70: bne L138
+add r5, *r0
+
+L71: sub L113, L189
+L72: rts
+jmp L173
+prn *r6
+prn r1
+bne L153
+cmp r7, L278
+L73: lea L189, L229
+
+L74: bne L166
+rts
+L75: stop
+L76: sub *r2, *r0
+add #-243, *r7
+jmp *r6
+L77: .data -860
+prn L87
+L78: .data 49, -441, -480
+cmp *r1, *r5
+clr r7
+cmp r7, L299
+L79: cmp #-110, r5
+L80: inc *r1
+L81: jsr *r1
+jsr L261
+stop
+L82: lea L136, L98
+cmp r7, #-60
+add r4, L230
+bne *r4
+L83: bne *r6
+L84: red r2
+L85: prn #-88
+L86: mov L236, *r7
+jsr L207
+L87: cmp r6, *r0
+red r1
+L88: lea L202, *r5
+lea L203, *r2
+L89: red *r6
+not L143
+inc L122
+mov #27, *r4
+L90: not L190
+dec *r4
+cmp L217, r4
+dec L303
+bne *r3
+L91: rts
+jmp L318
+prn #88
+L92: add #-106, L126
+L93: inc *r6
+clr L275
+red *r7
+bne L221
+mov L312, *r7
+
+not *r2
+bne *r4
+L94: not L160
+L95: dec *r0
+L96: .data 820, -993, -92, 808, 657, -708
+L97: stop
+dec *r3
+add r0, *r1
+mov L241, *r0
+not r1
+stop
+add *r6, *r4
+L98: red L208
+jsr L300
+cmp #-44, r7
+; comment
+L99: .string "wctmhjskafxiwpro"
+lea L282, L296
+dec L173
+bne *r7
+clr r7
+L100: inc *r3
+cmp r6, #192
+jmp L302
+rts
+sub L153, r0
+L101: add L114, r7
+bne *r2
+
+clr L234
+
+L102: cmp r1, L222
+
+dec L127
+clr r4
+sub #-101, r5
+L103: lea L276, *r3
+bne *r5
+L104: .string "vogclndtwqmwmqker"
+prn *r4
+L105: dec *r5
+L106: jmp *r5
+L107: lea L305, *r4
+lea L147, L326
+bne *r0
+clr r4
+add #184, *r5
+jmp *r5
+dec r2
+L108: .string "rlixscumzv"
+
+sub #156, *r2
+stop
+L109: lea L216, L203
+rts
+jmp *r2
+L110: .string "bksco"
+inc *r0
+L111: bne *r0
+add L221, L221
+L112: red *r4
+add r1, r7
+L113: lea L115, L152
+not r5
+not *r1
+L114: not *r0
+dec *r3
+add *r3, r4
+mov *r7, *r2
+prn r0
+prn *r2
+L115: clr *r5
+clr *r0
+not L329
+rts
+jmp *r6
+L116: jsr *r3
+red *r6
+L117: dec r6
+L118: sub *r5, *r5
+bne *r4
+L119: jmp L236
+L120: not *r5
+stop
+L121: not L279
+rts
+L122: prn #88
+L123: inc *r6
+sub *r7, r0
+L124: rts
+not L147
+L125: jmp L159
+cmp L291, L156
+mov #-9, r5
+L126: cmp #-241, L186
+sub r6, L209
+add r4, r3
+stop
+L127: add #-120, L281
+rts
+not *r4
+L128: .data 255, -701, -434, 94, -488, 559, 285, -69
+prn r6
+bne *r6
+L129: mov #187, r6
+L130: add *r0, *r4
+prn #-61
+L131: add *r7, *r3
+L132: stop
+L133: cmp L252, #197
+L134: inc *r7
+L135: clr L326
+L136: sub #206, L325
+mov #130, L318
+L137: .data -30, -344, -948, 605, -537, -565, 661
+; comment
+L138: rts
+not L223
+jmp L235
+prn #-96
+add r2, *r1
+L139: bne *r4
+L140: .data 777, -679
+lea L213, r4
+dec *r3
+L141: .data 526, 29, -717, 529, -644
+L142: red L338
+dec *r6
+lea L336, *r3
+L143: cmp r0, #-221
+L144: red *r6
+mov r7, L263
+lea L326, r5
+dec *r4
+stop
+rts
+L145: .data 509, 767, 86, -244, -234, -980
+mov r6, r6
+L146: dec r4
+L147: red L242
+L148: inc L194
+L149: jmp *r0
+lea L335, *r7
+rts
+cmp #-91, #238
+lea L198, r1
+jsr L283
+L150: .data 252, 224
+stop
+prn r0
+L151: add *r3, r2
+lea L295, L321
+L152: add #-210, *r2
+L153: .data 967, -733, 109, 188, -766, 723, 947, -381
+L154: bne *r5
+rts
+bne *r0
+mov #20, r2
+sub L309, *r7
+L155: jmp L179
+bne L307
+sub #43, *r0
+sub #-189, L273
+L156: .data 491, 417, -825, -416, -829, -559, -719
+L157: not *r5
+lea L228, L236
+jmp L280
+bne L295
+L158: dec r7
+L159: mov #-91, *r3
+L160: .string "exuuguxs"
+bne *r2
+; comment
+L161: add r4, r5
+L162: not L203
+L163: red *r5
+rts
+prn r0
+L164: rts
+prn r4
+red r5
+bne *r6
+clr r7
+jmp *r5
+L165: not r1
+not *r2
+L166: prn *r0
+bne *r3
+L167: .string "odbiq"
+jsr L264
+jmp L275
+jsr L297
+cmp *r4, L328
+not *r3
+jmp *r0
+L168: bne L221
+L169: add r7, *r4
+bne L289
+L170: bne *r3
+L171: mov #254, L173
+stop
+L172: red *r2
+; comment
+L173: sub L262, r0
+L174: .data 117, 732, 332, -878, -305
+stop
+stop
+rts
+clr L276
+jsr L287
+L175: .string "socgqzq"
+mov r0, *r5
+L176: red *r0
+L177: .data 605
+cmp r0, L280
+clr L282
+stop
+lea L178, r3
+L178: jmp L228
+mov #86, L249
+L179: jmp L336
+L180: jsr L297
+not r7
+inc L252
+L181: jmp L276
+L182: lea L246, L220
+jmp *r0
+dec *r7
+L183: .data -986, 423, 168
+L184: clr r4
+L185: dec r6
+L186: red L256
+cmp r3, *r2
+inc L289
+jsr L210
+stop
+jmp L251
+not r4
+stop
+L187: .string "icvb"
+inc r3
+L188: mov L254, *r1
+red *r6
+add #-237, r1
+not *r3
+; comment
+mov *r5, L293
+rts
+L189: dec r2
+L190: mov L203, L210
+sub L271, *r5
+inc L225
+not r4
+L191: clr L217
+cmp r3, r7
+lea L264, r3
+
+inc *r1
+rts
+inc *r4
+L192: lea L205, L330
+L193: red r0
+jsr *r0
+L194: prn L338
+lea L274, r5
+; comment
+stop
+cmp #192, r4
+dec r1
+L195: jsr L233
+prn L314
+stop
+L196: prn r0
+; comment
+L197: .string "eacueyclynpvwswsfoganst"
+; comment
+add *r2, *r7
+add #32, L304
+; comment
+; comment
+jsr *r4
+add #99, *r7
+jsr L267
+jmp L228
+L198: sub L323, r6
+L199: inc L274
+L200: dec L228
+lea L235, L215
+prn #59
+L201: lea L328, L263
+jsr L218
+prn *r2
+jmp L335
+red *r7
+jmp L291
+L202: .string "eqcjlgheyffohwu"
+rts
+L203: .string "aerlyyntaqolfmxjzzrv"
+; comment
+stop
+clr L232
+bne L299
+sub *r7, L279
+L204: jsr *r5
+cmp *r3, L234
+not L300
+red L214
+add r4, r1
+sub L222, *r3
+clr L209
+jsr L333
+L205: clr L228
+clr *r4
+L206: .data 234
+L207: .data 30, 351, -691, 740, 119, -806, -764
+L208: stop
+L209: dec *r0
+L210: mov L335, r5
+L211: lea L258, L214
+L212: rts
+red r1
+L213: bne L269
+red r0
+prn *r7
+not *r7
+mov *r2, r2
+sub r1, r4
+L214: lea L337, *r6
+; comment
+clr *r7
+red *r0
+dec r6
+red L252
+L215: lea L340, L301
+L216: sub r3, *r7
+lea L319, r2
+not *r4
+L217: sub #32, *r0
+jmp L335
+L218: not r2
+not r3
+clr *r6
+bne L284
+L219: mov #-146, r0
+bne *r1
+not r1
+L220: lea L261, r6
+jmp *r7
+dec r6
+prn #126
+L221: stop
+cmp L229, r4
+L222: cmp *r0, *r1
+stop
+L223: red *r3
+cmp *r0, L338
+; comment
+sub #-204, *r2
+L224: .string "pnmawkqvqx"
+L225: add #-227, r4
+L226: .string "fqz"
+L227: .string "mjbn"
+dec r2
+L228: lea L316, *r2
+; comment
+mov *r3, r5
+L229: lea L330, *r0
+L230: prn *r2
+L231: rts
+L232: stop
+jsr *r6
+not r7
+L233: .string "etzptomudtsznenkrck"
+sub r2, r6
+stop
+L234: dec L292
+lea L330, r4
+sub r3, *r0
+lea L301, L313
+L235: cmp r1, r4
+L236: .data 32, -955
+; comment
+rts
+L237: sub L299, r7
+
+lea L299, r3
+add *r5, *r2
+L238: rts
+mov #-178, L274
+sub #207, *r5
+jmp *r5
+dec r0
+cmp L269, L332
+lea L326, r3
+red r6
+L239: cmp L326, #-210
+L240: stop
+L241: .data -600, 196, -502, 655
+lea L331, L263
+inc *r0
+jsr *r5
+jmp *r7
+dec r5
+; comment
+sub *r4, *r2
+L242: not L307
+prn r7
+jsr L270
+dec L315
+rts
+L243: .string "zsz"
+stop
+L244: bne *r0
+clr *r7
+add r5, *r7
+; comment
+sub #30, *r3
+add *r6, r7
+mov *r7, *r6
+prn #21
+clr L261
+cmp r7, r0
+L245: sub L326, r5
+sub #238, *r2
+dec r4
+not *r1
+L246: inc *r1
+L247: mov *r0, L301
+L248: .data -981
+inc r3
+lea L276, L297
+stop
+L249: lea L321, L306
+L250: sub L331, L313
+stop
+L251: lea L335, L258
+L252: bne L310
+L253: red r6
+L254: rts
+clr L330
+L255: .string "puiztsmplagkfnz"
+L256: dec L296
+lea L259, *r6
+red L288
+L257: clr L260
+L258: clr L329
+; comment
+red r0
+L259: .string "ezydstq"
+sub L341, L322
+
+L260: lea L299, *r5
+L261: .string "rzuoskhleljxk"
+L262: .data -605, 953, -463, 378, 239, -15, -454, -186
+dec r6
+; comment
+red r7
+L263: add #-174, r3
+add #7, L279
+prn r7
+stop
+add #-37, r4
+L264: sub r2, *r3
+L265: sub *r3, L292
+mov #68, L298
+L266: .data 878, -924, -339, -155, -986, -642, -412
+L267: jsr *r1
+inc r3
+cmp *r4, r5
+L268: sub r4, L284
+stop
+rts
+L269: .string "xhngtd"
+stop
+add L325, L308
+L270: mov *r1, L271
+rts
+
+prn *r6
+clr r1
+L271: sub #-238, r6
+L272: .data 919, 454, -562, -217
+L273: cmp *r6, r7
+bne *r5
+mov *r5, r7
+cmp L321, r3
+red *r1
+L274: dec L314
+
+L275: .string "sslzcymivgnm"
+rts
+red r2
+L276: .data 480, -244
+L277: stop
+stop
+L278: .string "kte"
+prn L288
+stop
+jsr L330
+L279: sub r1, r3
+dec L326
+; comment
+L280: .string "rxcjqwbidfyrupfrkeeksv"
+inc r7
+jsr *r0
+prn L289
+dec L284
+L281: .data 326, -176, 382
+L282: mov #-227, r7
+L283: stop
+jmp *r7
+jsr L316
+red r0
+; comment
+lea L330, L315
+L284: jsr *r3
+dec *r3
+L285: .string "kljhfawwtiryj"
+jsr *r3
+L286: .string "bvtvxzlvxsnyyszzbbuiam"
+L287: bne L324
+L288: not L290
+prn #131
+stop
+L289: mov #-160, L295
+sub L329, r7
+rts
+mov *r1, r6
+jmp *r6
+lea L315, *r1
+red L313
+jsr *r3
+L290: jmp *r6
+clr *r5
+cmp #201, *r0
+L291: sub #-228, r5
+L292: cmp L328, r6
+L293: red L299
+; comment
+lea L340, r5
+L294: add L300, r7
+cmp #-5, r6
+L295: jsr *r6
+dec r4
+L296: not r4
+bne L299
+L297: .data 903, 648
+L298: jsr *r0
+lea L320, *r2
+not r2
+red *r7
+prn *r7
+L299: lea L303, r6
+L300: .string "kesbcpjdyq"
+sub #137, r6
+L301: .data 99, -54, -215, 941, 250, 272, -85, -570
+cmp L337, r1
+L302: stop
+L303: .data 475, -333
+; comment
+L304: .string "fbspuhuksccgrksoskbw"
+L305: .data -834, -289, 491, -894, -552, -631, -696, 98
+prn *r0
+bne *r1
+; comment
+bne L322
+L306: .string "bswksoztikucodjyvpo"
+L307: inc r0
+; comment
+L308: .string "zxrlcptdzuumbnb"
+jmp *r5
+red r2
+prn L330
+L309: .string "snaanamjaic"
+L310: add #-159, *r6
+L311: clr r5
+L312: dec L333
+prn L315
+L313: .string "imzhamrjgeihxfsjez"
+rts
+clr *r2
+clr L333
+cmp *r7, r5
+L314: lea L326, L341
+rts
+mov r6, *r5
+lea L322, *r5
+mov L321, *r1
+prn r6
+L315: stop
+L316: cmp *r3, r4
+L317: jmp *r0
+clr r7
+L318: add *r5, *r4
+jmp L321
+cmp #-180, r3
+dec *r0
+cmp r3, L341
+jmp *r3
+mov #-140, *r4
+clr r4
+stop
+cmp #164, L331
+lea L337, *r4
+add #53, *r5
+L319: jsr *r3
+inc r4
+clr r4
+cmp #-145, r7
+inc *r4
+L320: .data -773, 175, -989, -356, -939, -174, -574
+dec *r5
+red r1
+not *r0
+bne L329
+L321: add *r5, *r7
+not *r6
+
+
+L322: red L331
+L323: .data 357, 10
+bne *r6
+clr *r0
+
+cmp *r3, L334
+cmp L325, #231
+
+mov L326, r1
+L324: .data -196, -6, 791, -503, -106, 512, -114, -537
+add L326, r7
+jmp L340
+cmp r5, r3
+sub *r2, *r1
+dec r2
+L325: mov #-3, r6
+cmp r3, r5
+jsr L336
+; comment
+L326: red L334
+L327: inc r3
+; comment
+not L330
+dec L332
+red L334
+L328: .string "udutltnrfscniyat"
+not L332
+jsr L330
+L329: red *r1
+prn L339
+mov r0, L334
+L330: .data 861, 150
+mov r2, *r1
+
+add #210, *r7
+stop
+L331: .string "jmevbhio"
+red *r0
+stop
+sub *r7, r1
+prn *r3
+L332: .data -203, -263, -311, -77, -112
+not *r4
+inc *r7
+
+prn r6
+rts
+L333: rts
+jsr L338
+cmp *r0, #45
+not L339
+not L339
+inc L334
+rts
+; comment
+lea L334, r4
+L334: rts
+jmp *r6
+
+cmp L336, r0
+L335: .string "uwrtibdmysycghphrwc"
+red L336
+L336: prn *r4
+L337: .string "xrlzclhla"
+lea L338, r2
+L338: sub L341, r6
+L339: inc r3
+bne L341
+inc r3
+L340: jsr L341
+bne L341
+red r2
+mov *r7, L341
+sub L341, L341
+cmp *r5, #-87
+L341: .data 480, -788
+mov r5, r0
+red *r6
+stop
@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 41
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+stop
+L0: lea L306, L298
+not r7
+inc *r0
+mov #-107, *r0
+L1: clr L257
+L2: jsr *r0
+jsr *r1
+L3: .string "svxdauxibqfmmkiizwhmqwln"
+L4: .data 422, -790, 86, -869, 421, -916, 968, 381
+sub r4, L194
+jsr *r6
+L5: stop
+L6: lea L154, r5
+rts
+prn r6
+not *r7
+L7: clr *r0
+
+L8: bne *r7
+L9: .data -943, 58
+L10: jsr *r5
+jmp *r4
+bne L108
+clr r4
+L11: add #1, *r5
+not L155
+
+; comment
+dec r6
+jmp L267
+bne *r6
+stop
+not L145
+L12: inc r1
+L13: .string "sjldlnmvhuyhzmxlmk"
+L14: sub L302, L78
+jsr *r4
+add r1, r4
+inc L179
+L15: dec L78
+clr L270
+dec r7
+L16: jsr L23
+inc L303
+dec L52
+cmp r5, #-203
+L17: rts
+prn r7
+jmp *r3
+prn #134
+cmp r3, #-10
+L18: dec L95
+sub #2, r0
+bne L320
+L19: inc *r4
+add *r7, L141
+L20: dec r6
+L21: bne *r5
+L22: sub *r7, *r5
+jmp L77
+L23: clr *r2
+rts
+dec *r6
+L24: red L329
+L25: jmp L288
+L26: clr r2
+rts
+L27: prn L241
+L28: clr r2
+inc r6
+L29: mov #85, *r4
+L30: lea L201, L331
+clr L355
+cmp *r5, *r2
+L31: red r4
+inc *r4
+prn r2
+L32: cmp #-164, L85
+jsr L94
+jmp *r3
+mov L182, *r5
+red *r2
+inc r1
+L33: .string "aj"
+bne *r7
+stop
+mov r2, r1
+mov #154, L101
+L34: not r7
+L35: lea L285, r2
+jsr *r4
+stop
+bne L216
+jsr L339
+
+add L101, L207
+
+sub *r0, r0
+bne *r2
+mov r0, r1
+jmp L58
+L36: .string "vpkmvjlbmnnenvobetsxfbu"
+add r5, *r5
+jmp L118
+L37: .data 28, 20, 259, -893
+add L314, L102
+jsr L254
+bne L297
+jmp *r7
+L38: clr r5
+dec r4
+clr r1
+dec L216
+L39: sub L284, r1
+mov L309, L153
+L40: .data -578, -318, 258, 439, -17, 776, -209, -257
+L41: rts
+add L178, r7
+L42: inc L196
+jmp *r6
+red *r2
+inc r3
+cmp L60, #193
+L43: not r4
+L44: .string "qbk"
+red r0
+L45: .data 345, -351, -381, 612, -742
+jsr *r1
+inc r7
+dec r3
+sub L160, *r2
+dec r1
+jmp *r0
+L46: jmp L83
+clr L188
+mov #0, *r4
+L47: lea L318, L117
+L48: inc *r3
+cmp *r4, *r1
+L49: .string "vxka"
+prn L282
+L50: lea L208, *r5
+L51: rts
+inc *r0
+L52: dec r0
+jmp L153
+jmp *r4
+mov #-61, r3
+L53: .string "ut"
+L54: prn L88
+clr *r6
+stop
+; comment
+jsr L348
+
+L55: .data -209
+L56: jsr L326
+L57: add L264, L193
+L58: jsr L127
+red *r1
+stop
+rts
+not *r6
+sub L173, L150
+jsr L115
+L59: clr L159
+add L134, r0
+dec r1
+stop
+sub *r1, L67
+red *r6
+dec r3
+prn *r1
+jsr *r6
+not L151
+inc r7
+lea L80, *r3
+inc r3
+mov #183, L223
+stop
+L60: add L286, *r4
+dec *r6
+L61: jmp L85
+L62: bne *r7
+dec *r4
+L63: mov #192, r1
+not r2
+clr r6
+jsr *r4
+L64: .string "wnsqwhlrurnqybkpz"
+L65: prn #220
+sub #-33, *r6
+clr r1
+lea L322, L195
+jsr L268
+; comment
+stop
+L66: dec r3
+jmp L154
+lea L310, L81
+clr *r7
+L67: .string "iqakhtcre"
+L68: sub r3, *r3
+L69: lea L177, r3
+L70: red r6
+L71: .data 380, 380, -670
+lea L269, r2
+L72: rts
+add *r0, L235
+L73: .string "ntv"
+add r5, L95
+stop
+stop
+jsr *r3
+L74: .string "bhgdyvaaqaulrvvmibtyz"
+L75: red r5
+L76: red r3
+L77: .string "ticgihi"
+add #-18, L188
+L78: .string "uxrscuvbljrferendfjonpz"
+jsr *r4
+L79: stop
+lea L180, L267
+jsr L162
+L80: stop
+L81: jsr *r6
+sub r1, *r1
+L82: red L119
+L83: mov #-24, r1
+add *r0, L264
+lea L172, *r0
+jsr *r6
+L84: cmp #193, *r6
+prn L194
+jsr L128
+clr r2
+jmp *r6
+add #63, *r3
+sub #-135, L169
+L85: stop
+lea L344, r1
+clr L325
+red L342
+L86: mov r4, L217
+L87: mov #-143, r0
+not *r1
+L88: .data 476, 423, -402, 444, -532
+L89: jsr L165
+red *r7
+clr *r6
+L90: stop
+dec L259
+L91: inc L242
+L92: inc r6
+L93: sub r1, *r5
+not L256
+L94: clr *r0
+bne L110
+clr *r3
+L95: cmp *r6, #35
+bne L148
+mov L254, L349
+jsr L99
+jsr *r6
+L96: lea L330, r7
+L97: cmp *r0, *r0
+jsr L162
+stop
+add r4, L245
+L98: .string "qp"
+cmp L286, r2
+rts
+rts
+L99: jsr L289
+jmp L351
+clr *r0
+L100: inc *r1
+
+L101: .data 338
+not *r2
+L102: .string "auxir"
+not L346
+; comment
+jsr L148
+L103: cmp L295, #26
+rts
+red *r7
+sub r4, L162
+mov *r5, r2
+L104: .data 498, -139, -836
+red r6
+jsr *r5
+rts
+jmp *r3
+not L149
+sub L234, L251
+L105: .string "frl"
+L106: .data 184, -679
+L107: inc L190
+clr *r7
+mov r6, *r3
+L108: .string "putaop"
+jsr L330
+lea L225, *r2
+jmp L264
+red L333
+red L179
+mov L257, r5
+bne *r0
+L109: .string "q"
+L110: dec *r4
+rts
+sub r3, r3
+sub *r3, r6
+add r0, r7
+sub L348, *r3
+L111: mov #184, r5
+L112: add *r0, *r7
+
+dec r6
+L113: clr r6
+L114: sub *r7, r7
+lea L323, r5
+dec L228
+inc *r3
+clr r3
+jsr *r4
+L115: sub r5, *r7
+L116: red L270
+L117: stop
+not *r1
+jmp *r6
+L118: .string "quwautst"
+L119: jmp *r6
+add *r4, L212
+jsr L134
+L120: cmp r0, r5
+L121: rts
+red r0
+stop
+jmp L356
+stop
+L122: .string "wmimvupfgz"
+L123: cmp *r5, r4
+jsr L194
+clr L249
+clr *r4
+dec r2
+
+red *r6
+prn r1
+lea L164, L228
+inc L306
+L124: clr *r7
+L125: lea L143, *r3
+L126: rts
+dec r4
+lea L169, r6
+lea L144, L210
+L127: lea L324, *r3
+dec L143
+lea L140, r4
+dec L255
+not *r0
+stop
+prn #49
+L128: .data -467
+L129: .data -436, -328, -747, 353, 739, 492
+inc r1
+L130: .string "weuuevispyk"
+L131: stop
+L132: rts
+not L349
+prn *r2
+not *r1
+L133: .data 28, 364, 89, 276, 46
+L134: .string "eosqqnfefqlbvidk"
+prn #-21
+sub L256, *r7
+bne L227
+L135: jmp L286
+L136: red *r0
+rts
+jmp L179
+L137: rts
+L138: .data 582, -297, 872, 990, 73, 233, 800
+stop
+jmp L207
+rts
+L139: red L227
+L140: stop
+not L235
+L141: cmp L144, L300
+red r2
+rts
+sub r5, r4
+rts
+not L350
+L142: .data -270, 195, -225
+sub *r0, *r3
+red L290
+dec L309
+L143: .data 225, 618, 521, -333, 523, 978, 264, -644
+mov *r3, r6
+clr *r0
+L144: sub r5, *r2
+L145: .string "ejuegisytcjxdjtui"
+L146: rts
+prn L197
+jsr *r4
+red r0
+L147: stop
+L148: jsr L301
+prn r7
+dec *r5
+L149: prn L187
+L150: .data -139, -260, -997
+lea L161, *r3
+red r6
+cmp L320, *r4
+L151: .data -940
+prn #-155
+jsr *r0
+red *r3
+; comment
+dec *r1
+L152: .data 340, 405, 800
+L153: .data 321, -101, -380, -266, -846, 219
+L154: cmp r6, r1
+red r6
+L155: sub r3, L226
+red r1
+add *r5, L308
+lea L261, *r4
+stop
+L156: stop
+bne *r4
+L157: cmp #-25, *r7
+red *r6
+L158: inc *r5
+stop
+L159: rts
+jsr *r7
+stop
+not *r7
+L160: cmp L161, r3
+L161: mov L239, r6
+red r3
+L162: mov *r5, r3
+L163: add r1, L238
+; comment
+L164: .string "thvckcnqtnshaanojnnfhyi"
+not r7
+bne *r5
+L165: jsr L190
+L166: .data 743, 680, 724, -315, 509, -49, 944, 36
+; comment
+clr r0
+sub *r1, r6
+sub r7, *r2
+sub r0, *r0
+inc r4
+L167: sub *r0, *r0
+rts
+L168: mov r6, L345
+jmp *r1
+not *r3
+jsr *r6
+jmp *r4
+lea L320, *r2
+prn #-84
+L169: .string "kdwjfbrefgdkufdpu"
+add L316, L202
+stop
+sub L337, *r7
+rts
+L170: prn #213
+L171: .string "wayez"
+jmp *r3
+L172: stop
+lea L290, L253
+mov *r5, L326
+jmp L334
+prn L216
+add *r2, r5
+inc r6
+red r7
+not L234
+L173: stop
+cmp r3, #-30
+lea L322, r4
+inc L320
+L174: add *r6, L196
+L175: prn *r0
+L176: inc r3
+sub L300, r5
+rts
+L177: dec L257
+add L348, *r0
+L178: red L299
+inc r6
+lea L289, r6
+L179: .string "moszuzpqua"
+rts
+bne *r4
+L180: .string "efjbnafjsgmahnpdjp"
+L181: .string "qyzkwqhlrywhgbdxpexzap"
+jmp L270
+L182: bne *r3
+inc r5
+; comment
+sub L357, L330
+add #-219, r5
+L183: clr L206
+not r0
+dec L334
+L184: stop
+lea L319, L238
+L185: prn L331
+L186: prn r1
+red *r3
+dec L235
+L187: jmp L291
+L188: sub L284, *r0
+L189: sub r4, L341
+jmp *r2
+red r2
+L190: cmp r7, *r0
+inc r0
+jmp L247
+bne L194
+L191: jsr L321
+mov r5, L312
+add r5, r7
+L192: cmp L252, L344
+L193: clr *r7
+L194: .string "ysg"
+L195: not *r2
+L196: mov *r3, r6
+inc r0
+stop
+rts
+L197: .data 460, -55
+bne L266
+jmp L229
+rts
+jsr L301
+L198: add L221, r4
+jsr *r5
+L199: lea L223, *r0
+stop
+add *r4, *r0
+sub r1, L249
+; comment
+mov r2, *r0
+jsr *r7
+red *r4
+L200: sub #-218, r4
+bne L314
+add *r3, L264
+L201: inc r4
+L202: rts
+clr L240
+
+inc *r3
+L203: lea L246, L282
+mov *r7, *r5
+bne *r5
+L204: jsr L351
+L205: .string "hghvrvruvuwxnkoywcuvxrfy"
+clr r6
+mov #-6, *r1
+jmp L290
+sub *r5, r4
+inc r6
+add r2, r2
+L206: jsr *r7
+jmp L246
+L207: .string "shbwnc"
+lea L320, L289
+jsr L298
+inc *r1
+mov #-231, *r7
+mov #154, L290
+L208: jmp *r4
+not L331
+red *r5
+L209: jmp *r0
+L210: add L271, r1
+L211: inc L292
+add r6, *r6
+mov #15, *r2
+prn r6
+jsr *r2
+lea L255, *r3
+
+prn #171
+; comment
+L212: rts
+L213: .data -41, -496, -316, 874
+dec L330
+cmp #-89, *r0
+L214: .string "ojiglnehhdhwrcejisdq"
+add L303, r4
+L215: not r7
+stop
+L216: rts
+L217: not *r6
+cmp r3, *r1
+add r1, *r6
+clr L218
+jmp *r5
+L218: red r7
+mov #64, L294
+mov #-253, r7
+
+add *r4, L325
+L219: jsr L267
+L220: sub #-143, r5
+jmp L243
+rts
+sub *r3, *r0
+red r1
+
+rts
+cmp #-63, #207
+bne L246
+lea L281, L357
+L221: jmp L258
+jsr L347
+L222: clr *r3
+rts
+mov L251, *r2
+jsr L322
+sub r0, L316
+sub L286, *r0
+L223: .string "pgodbtvsrzvery"
+lea L258, *r6
+rts
+; comment
+; comment
+L224: .data 831, 694, -222, -215
+not *r6
+L225: lea L352, L288
+stop
+not L293
+not L226
+L226: prn r3
+dec L277
+jsr *r3
+L227: .string "totgu"
+sub r1, r1
+L228: jmp *r1
+rts
+
+cmp L341, *r5
+
+not *r2
+add *r6, L284
+L229: .string "uyknuulmxtxinpoqbz"
+not L352
+L230: rts
+not *r7
+L231: stop
+L232: .string "cdthgn"
+not *r4
+clr *r0
+clr L352
+jsr L353
+jsr L344
+not L257
+lea L268, *r3
+mov L271, L288
+bne *r5
+bne *r6
+L233: .data 13, 820, -124, 995, -975
+stop
+lea L296, *r0
+rts
+L234: jmp L235
+L235: jsr L255
+red *r2
+inc L315
+inc *r5
+not L282
+dec *r2
+L236: jmp *r4
+L237: .string "zhjosxaeuxp"
+rts
+lea L321, L353
+L238: add L299, r2
+add *r2, *r1
+L239: red L346
+inc r3
+L240: cmp L299, L317
+clr *r5
+L241: .string "hyrxjdxneqxdiistpvaydil"
+not L262
+stop
+L242: not L277
+L243: clr L334
+add r3, r7
+clr *r2
+L244: sub r5, *r0
+rts
+sub r3, *r2
+L245: rts
+L246: .data 459, 63, -205, 354
+L247: not L324
+jsr L262
+jsr L266
+bne *r3
+dec L318
+L248: .data 210, -322, -31
+add r5, L331
+L249: lea L311, L341
+cmp *r5, #10
+sub L353, r2
+not r4
+lea L278, L341
+L250: mov r4, *r0
+cmp *r7, *r3
+sub #69, *r5
+L251: mov L286, L265
+jsr L324
+L252: prn *r4
+stop
+inc r3
+L253: inc r5
+add *r1, *r4
+inc r0
+clr r6
+jmp *r6
+L254: stop
+bne *r5
+jmp L255
+L255: rts
+stop
+
+sub r5, L267
+L256: stop
+L257: sub #-212, *r6
+jmp *r6
+inc L273
+mov r3, L356
+cmp r7, #86
+L258: .string "o"
+inc L309
+jsr L320
+not L301
+inc *r1
+L259: clr r5
+stop
+dec r2
+L260: prn L328
+L261: .data -7, -560
+L262: .data 590, -415, -901, 573
+L263: .string "iwbdskyguiitmuydf"
+; comment
+jsr L296
+clr *r0
+L264: cmp L353, L278
+L265: jsr L328
+sub *r2, L332
+L266: lea L324, r2
+cmp *r3, #-116
+L267: add #51, L305
+bne L328
+jmp L327
+L268: not L311
+inc *r0
+dec L351
+lea L288, *r7
+L269: cmp *r7, L350
+clr r5
+red r3
+sub L325, L354
+L270: .data -490, 594, 998
+L271: jmp *r7
+L272: stop
+L273: red r5
+jsr L320
+L274: stop
+inc r5
+add *r2, L286
+L275: clr *r4
+L276: .data 810, -485, -305, 523
+L277: lea L280, r2
+jmp *r1
+
+L278: .string "dnvjytrcpgzr"
+red L286
+L279: .string "dpn"
+L280: lea L319, L335
+stop
+L281: .data 945, -33, -803, 988, -516
+bne L322
+sub r0, L354
+L282: stop
+L283: rts
+L284: .string "obgvd"
+jsr *r7
+red L349
+clr r2
+clr r2
+dec L291
+L285: red *r5
+L286: sub L349, *r3
+rts
+L287: .string "qqc"
+L288: inc r2
+L289: red *r7
+red L290
+L290: stop
+L291: .string "hgsbatv"
+L292: cmp r7, L336
+stop
+L293: jsr *r3
+L294: .string "qbivbzwlup"
+sub L313, *r4
+lea L315, L331
+red L313
+L295: add #189, L311
+L296: jsr L302
+rts
+cmp L312, *r4
+L297: sub #237, r5
+lea L310, *r3
+L298: .data 548
+dec *r1
+jsr L345
+L299: red *r3
+red L333
+L300: clr *r3
+mov *r6, *r2
+jsr *r2
+stop
+rts
+L301: cmp *r1, #60
+red L309
+jsr L336
+lea L316, r6
+L302: stop
+not *r2
+L303: rts
+sub *r3, L316
+jmp L324
+prn #-121
+jsr L332
+L304: .data -983
+red *r3
+add r3, *r2
+; comment
+jmp L333
+L305: .data -385, 395, 649, 88, 19, -975, -570, -993
+clr *r4
+prn r2
+L306: .data -548, 593, 441
+
+red *r7
+mov #229, *r3
+bne *r7
+sub L356, L326
+inc r1
+L307: red *r3
+L308: mov r0, r5
+cmp #178, #-108
+L309: cmp *r5, r4
+lea L356, *r2
+prn r3
+L310: mov L313, r6
+L311: not *r6
+jmp L330
+jmp L324
+mov r3, *r4
+; comment
+L312: rts
+rts
+jsr *r3
+clr r7
+L313: not r6
+L314: jsr L332
+clr *r0
+L315: add r6, *r5
+L316: stop
+jmp *r6
+bne *r5
+mov #-154, r2
+L317: .string "fhwp"
+bne *r0
+inc r4
+rts
+L318: sub #53, r0
+sub *r1, r2
+L319: .string "ur"
+L320: prn *r3
+clr L326
+inc L325
+clr *r0
+L321: .string "hiyajwebhtqwqvozfgtz"
+jmp *r4
+not *r6
+cmp *r0, r6
+L322: .data 417, -699, 734, 97, 551, 226, -787, -213
+jsr L341
+L323: mov *r5, L336
+L324: stop
+bne *r3
+L325: cmp r0, r7
+L326: bne L349
+stop
+not *r4
+rts
+jmp *r4
+L327: .string "uaykzqkspfyqcegx"
+L328: cmp r5, L353
+bne L348
+L329: red L334
+jmp *r5
+L330: add #242, r4
+L331: mov r0, r6
+L332: .data -637, 461, -88, -792, 587, -268, 903, -144
+add #-229, *r3
+lea L335, r3
+clr L357
+L333: .data -653, 98, -82, 531, -2, -583, -583
+stop
+stop
+L334: .data 303, -71
+L335: mov *r2, r5
+L336: rts
+clr r5
+not *r4
+rts
+L337: sub #74, r4
+mov r2, *r3
+L338: add #-140, r6
+jsr *r7
+L339: prn *r6
+jmp L352
+stop
+not *r1
+; comment
+; comment
+L340: not *r1
+bne L354
+jsr L348
+L341: jsr *r6
+inc *r6
+red L352
+L342: clr *r7
+mov #-79, r5
+L343: jsr *r7
+L344: clr L346
+sub #-55, *r1
+L345: jsr L347
+L346: cmp #-65, r6
+inc r3
+stop
+L347: prn L349
+dec *r2
+inc r1
+mov #170, L355
+bne L349
+L348: inc *r2
+not r1
+L349: inc L353
+dec L352
+; comment
+L350: not L355
+add *r2, r2
+red L354
+jmp L352
+not L357
+clr *r7
+inc *r7
+rts
+red *r7
+dec L352
+L351: .string "jxhlbgs"
+not L352
+L352: clr L354
+sub *r7, r2
+cmp L357, *r3
+mov L357, r2
+dec *r3
+mov r3, r7
+add L356, L356
+L353: clr *r2
+L354: prn *r1
+jmp *r6
+bne L355
+L355: .string "hjtbaviaetoez"
+inc r6
+L356: red *r4
+
+jsr L357
+L357: sub *r0, r3
+red *r6
+stop
@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 42
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+not L118
+stop
+dec L303
+L0: sub #-8, L85
+rts
+; comment
+dec *r0
+L1: jsr *r6
+not L55
+lea L121, r0
+inc r5
+stop
+L2: dec r1
+not L313
+L3: .string "exlqvjv"
+L4: .data -927
+rts
+L5: sub *r4, r6
+prn #186
+stop
+L6: jmp L163
+L7: .data 216
+inc r6
+mov r4, *r3
+dec *r2
+L8: mov *r4, *r4
+L9: inc r4
+L10: add r4, r5
+L11: .data -460, 912, -525, -557, -456, -50, 25, 315
+bne L279
+L12: .string "umzalvzcetwgftih"
+L13: jmp L81
+dec r0
+; comment
+prn L88
+cmp r5, L209
+jsr L57
+mov L37, *r2
+lea L25, L176
+stop
+cmp #-80, *r6
+L14: lea L104, *r1
+L15: jsr *r5
+prn r5
+L16: .string "tutjz"
+stop
+dec L153
+lea L279, r1
+L17: red L102
+cmp *r2, *r0
+cmp r7, L277
+red L201
+L18: .string "jk"
+sub L276, *r1
+L19: bne L227
+sub *r3, L249
+L20: .data -575, -273, 524, 382, 888
+L21: mov *r2, L71
+L22: not L144
+L23: .string "anwp"
+L24: stop
+sub L143, *r7
+L25: red L199
+jmp *r2
+jmp *r0
+L26: lea L86, L160
+L27: bne L302
+dec r2
+red L160
+sub #-12, L132
+prn r2
+jmp L168
+clr *r5
+clr L95
+; comment
+stop
+jmp *r2
+
+stop
+inc r5
+jsr *r2
+L28: bne *r1
+red L32
+not *r5
+sub r2, r1
+L29: .string "vmmnrjhnlyvskb"
+clr L312
+lea L265, *r7
+prn r3
+L30: .string "xqeiugkzbhgumnqwtdlhuvl"
+L31: .string "gjlsseikymsqwaovbu"
+dec *r2
+lea L267, r6
+jmp L136
+bne *r1
+L32: .data 647, 495, 513, 177, -635, -139, 402
+inc L126
+sub L192, L143
+lea L213, *r0
+L33: prn L309
+L34: clr L218
+red r0
+L35: .data -77, 125, -484, 726, 854, -385
+inc r7
+L36: dec L305
+L37: jmp L215
+L38: jmp *r1
+stop
+mov *r3, L216
+sub L329, L307
+not r3
+mov r6, L284
+L39: .data 932, -361, -156, 812, -744, 531, -895
+lea L90, *r3
+L40: prn #196
+L41: bne *r3
+red L73
+mov L270, *r1
+stop
+L42: clr *r3
+prn #-188
+prn r4
+clr *r6
+
+L43: stop
+
+L44: dec *r2
+red r7
+L45: sub L161, L79
+jmp *r2
+clr *r0
+dec r4
+rts
+rts
+mov #-81, *r3
+mov *r5, L90
+L46: .string "thluciovksvqngkwmr"
+L47: jmp L249
+lea L335, r7
+bne *r5
+bne L178
+L48: cmp *r6, #179
+L49: .data 902, 340, 441
+add L299, r0
+cmp r5, #-105
+L50: jmp L216
+jmp *r1
+stop
+prn *r5
+dec r2
+L51: jmp *r7
+jmp L309
+lea L60, r4
+add *r3, r6
+L52: lea L216, L112
+L53: dec *r4
+stop
+; comment
+L54: .string "tvolrhmzqraki"
+bne *r0
+not *r5
+L55: cmp r5, *r0
+L56: .data -990
+L57: dec L166
+cmp r0, r1
+not r4
+jsr L262
+L58: not r3
+inc r7
+L59: .string "atrjvmylhmbrx"
+L60: inc *r2
+L61: rts
+sub r5, L139
+bne L279
+L62: rts
+jsr L103
+rts
+L63: bne L173
+mov L210, *r1
+add L103, *r5
+cmp L85, r7
+L64: not *r0
+L65: prn L157
+stop
+L66: mov #-53, L310
+clr L67
+stop
+L67: cmp #61, r4
+not *r4
+jsr *r2
+inc r4
+dec L145
+bne L303
+L68: .string "ka"
+stop
+rts
+prn r1
+rts
+L69: mov L311, L330
+jsr L114
+L70: .data 750
+L71: inc r0
+prn #-68
+
+jmp L314
+L72: red L83
+
+L73: rts
+L74: .string "gghwczov"
+stop
+jmp *r1
+L75: red *r2
+jmp *r4
+inc L301
+stop
+L76: lea L83, L150
+cmp r4, r0
+L77: jmp *r1
+stop
+L78: not *r2
+add r2, L183
+inc r2
+L79: .data 44, -468, 46, 920, 458, 489, -321, 320
+L80: lea L105, L218
+L81: inc L127
+clr L172
+clr L164
+bne *r2
+sub #-58, *r6
+inc L164
+not *r6
+lea L200, r3
+dec *r3
+prn r0
+sub #192, *r1
+not L182
+L82: add *r5, L323
+mov L324, *r1
+red *r6
+rts
+add *r4, *r4
+L83: cmp *r2, L260
+; comment
+jsr *r6
+L84: jmp *r3
+not r6
+rts
+L85: bne L234
+clr *r5
+prn *r0
+stop
+L86: .string "srzbirqaprqga"
+dec r5
+jsr L188
+prn *r6
+L87: red r5
+L88: lea L188, r7
+rts
+stop
+sub *r6, L119
+rts
+L89: jsr *r3
+add #197, *r5
+L90: .string "lu"
+cmp *r6, r4
+jmp *r5
+L91: prn r3
+prn *r1
+L92: bne *r3
+L93: red r6
+jsr L139
+add #-139, r0
+L94: bne L249
+L95: rts
+bne *r7
+lea L114, *r1
+lea L302, L243
+; comment
+L96: red L196
+L97: jsr L255
+jmp L179
+mov #-19, L280
+red r6
+cmp *r2, *r4
+jmp *r7
+cmp L251, r1
+L98: prn L326
+clr L232
+L99: .string "bfzp"
+inc L311
+L100: mov r1, L111
+jsr *r3
+L101: mov *r5, L292
+L102: dec L232
+L103: .data 461
+L104: add L221, L147
+sub r6, *r3
+rts
+
+stop
+; comment
+L105: stop
+prn #-8
+L106: .string "wiulahaynggrebb"
+L107: bne *r7
+bne L146
+; comment
+add #-80, L160
+sub #-43, r5
+lea L267, *r6
+L108: prn #94
+L109: .string "uetbkg"
+bne *r1
+L110: .data 864
+dec L192
+mov L199, L137
+lea L181, L295
+L111: prn r0
+L112: .data -579, -883, 737, 645
+L113: .string "nezzqtgdn"
+L114: jsr L232
+sub r3, *r1
+sub L305, *r6
+inc L331
+L115: clr L159
+jsr L142
+clr r5
+not *r3
+L116: .string "edvzzcdexwakrsgesrpnbi"
+L117: .string "weg"
+cmp L325, #-85
+dec *r1
+clr r4
+prn #238
+bne *r7
+mov r7, L191
+L118: lea L184, L199
+L119: not r4
+L120: inc L297
+; comment
+add #-3, r0
+jsr L320
+L121: prn *r6
+dec r2
+jsr *r0
+inc r0
+jsr *r0
+prn L162
+L122: not r5
+L123: lea L234, *r6
+jmp L200
+L124: clr r2
+L125: sub #81, *r6
+dec L217
+L126: add #-237, *r1
+dec r4
+sub #-77, L291
+L127: not L159
+not *r6
+
+jsr L313
+L128: sub #86, L247
+inc *r4
+L129: .data -960
+L130: .string "cojohjshylwz"
+sub r5, r7
+cmp *r0, *r0
+add #-256, L223
+dec L277
+add L304, L234
+L131: prn r5
+L132: jsr L284
+L133: jsr *r0
+dec *r1
+not *r6
+L134: cmp L310, #214
+L135: jsr L284
+; comment
+lea L193, *r6
+L136: clr r2
+L137: not *r5
+dec *r7
+; comment
+; comment
+dec *r6
+L138: jsr L176
+add r4, *r0
+; comment
+not L273
+L139: rts
+cmp #-66, r3
+jmp L182
+not r3
+rts
+jsr *r3
+L140: dec *r1
+jsr L270
+jsr L184
+clr *r2
+add r7, r4
+prn *r0
+clr r3
+lea L282, L209
+red *r1
+not r6
+L141: .data 246, -445
+dec *r5
+L142: add *r3, r6
+inc L205
+jsr *r6
+
+L143: cmp r5, L185
+red L155
+
+
+stop
+mov #-165, *r1
+
+inc *r5
+L144: mov r0, *r2
+dec L269
+rts
+inc L249
+L145: inc *r1
+inc *r6
+add L239, r0
+rts
+L146: .string "hbodnrbnd"
+red *r5
+prn L221
+cmp r6, r4
+L147: red L169
+inc r6
+L148: .string "rrfhsuxvrjkgh"
+add r0, *r3
+jmp L154
+L149: clr L273
+prn L289
+L150: .string "fbronmchxzyuiotsnkftkkg"
+L151: clr L226
+mov #207, *r7
+jmp *r7
+L152: cmp r6, *r5
+; comment
+stop
+L153: dec L176
+prn r0
+L154: rts
+mov r4, *r0
+L155: dec L316
+lea L327, L220
+bne *r3
+L156: .string "huf"
+L157: .data 494, -316, -591, -369, 225, 672, -877
+L158: jmp L168
+L159: .data -698, 318, 300, -550
+stop
+jsr L235
+L160: prn *r1
+lea L239, *r4
+jsr *r3
+jmp *r7
+L161: prn *r0
+cmp *r0, r0
+bne *r6
+sub r2, L198
+prn *r3
+clr r0
+
+L162: bne *r3
+; comment
+lea L254, r6
+L163: not L308
+sub L325, L175
+rts
+L164: .data -977, 790, 707, 300, -371
+jmp *r7
+L165: add #55, r3
+L166: inc *r0
+L167: stop
+add r4, r4
+clr *r7
+L168: lea L263, L265
+jsr L334
+L169: rts
+L170: red *r4
+lea L239, *r1
+jsr *r1
+not L307
+clr L174
+L171: not r2
+sub r5, r5
+L172: .data -421, -536, -167
+L173: sub *r1, L335
+L174: red L241
+L175: clr L328
+inc L277
+red L322
+inc *r4
+L176: mov *r4, r0
+add #50, *r4
+L177: mov #-253, *r5
+clr L256
+L178: .data 140, -63
+L179: add *r5, r6
+L180: red *r4
+jsr *r2
+sub L259, L258
+L181: cmp L311, L326
+bne L240
+mov #-172, *r3
+L182: rts
+lea L258, *r5
+; comment
+L183: dec L269
+L184: lea L327, L207
+clr *r2
+L185: sub *r1, L291
+inc *r2
+not r4
+L186: rts
+prn r1
+red L308
+sub L329, r2
+sub #-153, r7
+L187: jsr L271
+L188: mov r7, *r5
+not L223
+inc r1
+mov *r5, *r6
+red *r4
+clr L198
+mov r2, *r3
+not L259
+inc *r1
+stop
+mov r5, L216
+L189: .string "svtfinaj"
+bne *r2
+jsr *r2
+stop
+L190: mov L258, r0
+jsr *r6
+red L259
+jsr L329
+cmp *r2, *r3
+; comment
+L191: rts
+stop
+L192: cmp L259, L278
+jmp *r1
+inc L326
+L193: sub r6, *r4
+L194: sub #54, L212
+inc *r6
+stop
+L195: .string "lgkmfsvew"
+L196: jmp L204
+L197: .data -676, -886, 81, 546
+L198: inc L242
+L199: jmp *r1
+L200: clr r4
+dec L232
+clr L264
+jmp L268
+jmp *r3
+rts
+cmp r3, r6
+red *r4
+L201: rts
+rts
+sub *r1, L315
+L202: rts
+L203: sub r3, L322
+; comment
+mov L331, r1
+L204: sub r7, L238
+inc L256
+L205: jmp *r7
+
+cmp #-84, #-144
+inc L328
+red L304
+L206: red L261
+add *r5, *r0
+not r7
+lea L298, r6
+L207: dec L226
+dec r0
+L208: prn #-22
+jmp L267
+bne L241
+cmp r0, L336
+; comment
+rts
+L209: dec *r3
+lea L280, r6
+L210: not L304
+L211: lea L237, r0
+L212: .string "iyoafbpm"
+lea L216, r5
+clr r6
+L213: bne *r5
+L214: stop
+dec L323
+prn *r2
+add #123, r5
+inc L322
+L215: .string "kmghbobqqcavzyorp"
+L216: clr *r0
+L217: add r7, r6
+L218: red r4
+clr r5
+L219: rts
+not r4
+lea L272, *r4
+sub *r4, L306
+mov #-216, r7
+add L316, L320
+L220: .data 86, 951, -920, -687, -296, -409, -532, -522
+bne L261
+bne L235
+dec r0
+jsr *r3
+cmp *r7, *r1
+L221: jsr L262
+L222: cmp *r7, r6
+L223: rts
+add L232, L256
+
+L224: red r4
+stop
+jsr *r6
+dec r1
+L225: cmp *r7, *r3
+clr *r7
+inc *r6
+L226: .data -328, -96
+mov *r5, *r1
+lea L332, L262
+L227: .data -151
+L228: clr r6
+L229: .string "leckharuicdmcnysmzqdjql"
+bne *r2
+jsr L331
+inc *r1
+bne L330
+; comment
+lea L230, L258
+prn L231
+add *r2, *r5
+jsr L257
+stop
+; comment
+L230: .data -957, -531, 628
+prn L295
+sub #85, r5
+L231: add L306, L291
+rts
+bne *r7
+red r7
+L232: dec r2
+clr L238
+L233: bne L289
+L234: rts
+add *r7, r6
+not *r0
+L235: red *r7
+L236: cmp *r2, r3
+jmp L267
+sub L323, L253
+jsr L309
+dec L335
+rts
+jmp L277
+add L327, *r7
+jmp *r7
+jsr L247
+not L244
+L237: .string "iebxrjcqfkmkwmvpnvg"
+L238: inc r5
+L239: bne *r1
+inc r3
+L240: prn *r7
+rts
+clr L302
+mov *r2, r2
+L241: jsr L249
+cmp L328, L299
+not *r6
+jsr *r3
+bne L275
+L242: .data -758, 706, -280, -318
+stop
+L243: prn #233
+not L288
+inc L304
+L244: .data -312, -997, 43
+
+not L260
+L245: .string "q"
+L246: .data 652, -969
+cmp *r7, #240
+stop
+stop
+L247: .data -420
+L248: lea L298, L270
+jmp L258
+not *r1
+L249: .data -689, 745, 304, 893, 611, -446
+clr r1
+bne L302
+L250: .string "vprwjckkzdpppxs"
+; comment
+L251: .string "gctfegqjzcgoijsspxhkorsx"
+bne L308
+not *r4
+prn L278
+stop
+prn L279
+jsr L310
+inc L279
+L252: sub *r7, r4
+sub L331, *r2
+stop
+L253: .data -423, -377
+lea L302, L329
+stop
+L254: .data 863, 879, 819
+add *r5, r5
+L255: .string "josigddknm"
+prn *r1
+L256: red *r1
+L257: clr L333
+L258: .string "sfsybdxedkhxfkdbjgsecd"
+clr L326
+add #168, L272
+L259: lea L263, r5
+L260: stop
+jsr *r5
+clr r3
+add #-31, *r6
+dec r2
+not L288
+jsr L288
+bne *r0
+
+stop
+not r7
+L261: .data -930, 62, 583, 644
+L262: .data -265, -550, 641, -686, 871, -359, -84
+not r2
+jsr *r5
+prn L329
+; comment
+L263: lea L330, *r5
+cmp L276, *r7
+rts
+L264: bne *r3
+dec L294
+inc r7
+lea L316, r1
+clr r0
+L265: .data -733, 820
+dec L305
+red *r6
+jsr *r6
+add *r4, r2
+cmp r5, *r2
+rts
+L266: inc L294
+prn #-59
+L267: .data -629, 49, 599, -870, 496, -923, -970
+
+L268: red L329
+L269: bne *r1
+jmp *r4
+red L326
+prn r0
+jmp L293
+stop
+L270: red r1
+cmp r7, #133
+L271: clr r4
+L272: rts
+dec *r1
+clr L331
+sub L305, *r6
+mov L291, *r4
+; comment
+jmp *r1
+not r1
+L273: .string "cyeoaadujyibcwuclyjom"
+L274: bne *r4
+clr r7
+sub L317, L290
+L275: mov L329, *r1
+L276: .data 853
+not r3
+clr r7
+inc *r7
+jsr L314
+not *r1
+lea L330, *r1
+L277: sub r1, *r4
+clr *r2
+not L301
+clr *r1
+prn #-25
+stop
+bne *r1
+sub L306, L320
+L278: sub r1, *r5
+jsr L314
+L279: .data -742
+jsr L316
+
+jmp *r7
+jsr *r0
+stop
+
+
+L280: dec L296
+dec L313
+sub r5, L317
+stop
+lea L287, r1
+L281: .string "vcg"
+L282: rts
+red *r7
+lea L301, L290
+L283: cmp *r7, L290
+; comment
+lea L320, *r7
+jmp *r4
+dec L298
+red r0
+not r0
+
+
+jsr *r6
+L284: .data 644, 840, 168
+dec *r6
+not *r0
+L285: clr r5
+prn *r2
+rts
+add *r3, L318
+L286: inc L314
+L287: .string "rixtciaghisszkrt"
+L288: clr r7
+L289: lea L297, L302
+L290: cmp #-242, r3
+L291: add *r4, L314
+stop
+; comment
+dec L307
+clr *r7
+inc L332
+clr L317
+not L336
+L292: .string "ucvel"
+L293: .string "lkokncgtzivpmfjegnj"
+jsr L304
+L294: clr *r6
+sub L298, *r0
+prn r6
+dec L301
+mov #-106, *r1
+dec L327
+clr r7
+; comment
+clr L302
+not r6
+jmp L309
+L295: bne *r1
+inc *r7
+L296: jmp *r6
+L297: .string "wwohzjtaytpafmacxkctpf"
+L298: stop
+not *r0
+mov #-154, *r1
+L299: stop
+red *r1
+prn L325
+L300: clr r6
+jsr L325
+L301: not L324
+L302: jmp *r2
+L303: .data 714, 96, 734, -256, 356
+clr *r1
+L304: bne L318
+rts
+bne *r2
+L305: rts
+sub r1, *r1
+L306: inc r5
+bne L323
+
+L307: not L319
+L308: add *r6, L324
+; comment
+L309: .data 329, 638
+L310: .string "xtuieekshfssnb"
+lea L325, *r4
+L311: prn *r1
+inc *r7
+clr *r3
+stop
+inc L335
+L312: .string "lgigzrwvbsmlpoqa"
+L313: jsr *r3
+sub *r3, r3
+add #-179, *r5
+inc *r7
+L314: .data -181, 141, -53, -815, -810, 143
+mov *r2, L322
+not r2
+red *r3
+mov r1, L326
+cmp *r1, L327
+L315: jsr L333
+jsr *r4
+add r0, *r0
+lea L319, L317
+dec r2
+bne L330
+sub *r5, r2
+L316: lea L322, L322
+inc L335
+dec L334
+L317: cmp r4, *r7
+
+
+add L333, L335
+prn #61
+jmp L324
+L318: mov *r4, L328
+jmp *r3
+jsr *r3
+rts
+dec *r2
+red *r3
+L319: .string "vmwestb"
+L320: .data 984, -73, -433, -972, 673, 163, 313
+add *r0, *r5
+not r6
+rts
+L321: .string "pifw"
+L322: .data -501, 177, 652, -886, 977, 360, -266, 98
+L323: rts
+mov *r1, L329
+jsr L332
+clr L332
+dec L334
+L324: mov #-129, *r4
+clr r7
+lea L327, *r1
+L325: sub *r0, L327
+; comment
+cmp *r3, #-28
+L326: not L330
+L327: jsr L334
+sub r2, *r6
+bne L335
+L328: add r0, L329
+L329: .data -255, 796, 961, 100, 268
+red L336
+dec r4
+not L335
+mov #-82, r0
+jmp L331
+not r6
+cmp r7, #-152
+not L334
+cmp L331, *r1
+bne L330
+not *r6
+L330: .string "ndnjhthvnmuzmaeiqqwu"
+L331: clr *r4
+jsr L332
+L332: add #209, r0
+dec *r6
+prn #193
+; comment
+jmp L335
+prn #-30
+inc r6
+sub L334, *r2
+L333: not L336
+jmp *r3
+; comment
+red r6
+jmp L336
+L334: .data -241, 52, -52
+
+L335: jmp *r6
+sub #54, L336
+L336: jmp *r0
+inc *r1
+stop
@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 43
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: rts
+clr *r1
+mov r2, *r7
+prn r5
+L1: red r1
+not L12
+L2: .string "xywpkjjdimwhphtjmqyfaq"
+L3: cmp *r3, L205
+jmp L235
+sub #3, r7
+not *r7
+L4: clr L116
+; comment
+lea L337, r6
+jsr *r1
+bne *r6
+bne *r2
+jmp L107
+jsr L65
+rts
+mov r0, *r2
+mov *r6, L333
+bne *r2
+stop
+stop
+bne *r7
+prn #-226
+L5: mov *r5, L29
+L6: stop
+stop
+L7: .string "hjkzrqvmtlaustcrqgpeu"
+L8: cmp *r3, L274
+stop
+L9: .data 654, 463, 498, -434, -619, -318, -243, 510
+L10: bne *r5
+
+prn L30
+stop
+L11: .string "b"
+jmp L39
+
+L12: .data 118, 996
+cmp #-155, r0
+bne *r0
+L13: .data -569, 851, 191
+jmp *r2
+L14: dec *r7
+L15: lea L262, *r7
+prn *r7
+inc L255
+jsr L106
+L16: clr r5
+not L31
+add #-26, L234
+stop
+rts
+lea L205, L224
+dec L339
+L17: not *r7
+rts
+mov #-75, r0
+L18: jmp *r1
+L19: lea L72, r3
+jmp L200
+dec *r2
+red L186
+jmp *r1
+L20: bne L307
+L21: .data 454, 533, -825, 161, -603
+clr r0
+L22: .string "scshipfokpboaqtyofowuak"
+jsr *r3
+not *r5
+bne L193
+cmp *r1, *r5
+mov r7, r3
+L23: not *r3
+prn r1
+L24: jmp *r4
+L25: .string "yyvoclhbcrrgnqgudyt"
+
+L26: jsr *r5
+rts
+stop
+jsr *r3
+L27: cmp #26, *r5
+clr r3
+add #94, *r3
+L28: lea L256, r4
+mov #-94, r6
+bne *r3
+prn r2
+L29: .string "zgvszzjikxsqylgivnqm"
+sub L94, L250
+bne L37
+L30: dec *r1
+red r4
+cmp *r6, #191
+clr L166
+jsr L269
+add r4, *r4
+mov r2, L136
+L31: .data 341
+inc *r0
+L32: .string "hlhxeboukis"
+clr L35
+add r0, r6
+not L145
+L33: .data 804, -219, -338
+L34: bne L237
+
+mov L342, L65
+L35: .string "kz"
+L36: stop
+add L285, L89
+L37: .string "sxbuiddgdspivlxciiomeheh"
+L38: stop
+add #-183, *r1
+stop
+sub L39, L73
+L39: .string "vbkwius"
+red L157
+clr r4
+L40: .data -584, -934
+prn L226
+stop
+L41: .data 297, -44, -342, -428, 193, 190, 652
+L42: sub #240, L71
+bne L108
+not r6
+; comment
+L43: red *r5
+inc L256
+cmp r7, r2
+
+L44: red *r3
+bne L301
+mov L341, L184
+red r2
+L45: mov L157, *r1
+inc *r2
+L46: red r4
+L47: mov r1, L88
+L48: prn L208
+jsr L169
+jsr L274
+L49: stop
+cmp *r5, *r3
+L50: bne *r1
+jsr *r6
+cmp #120, L97
+rts
+red *r5
+L51: add L139, L287
+L52: .data -387
+sub r7, L247
+jsr *r7
+L53: .data -605, -942, -264, -40, -86, -779, -552, -75
+dec L227
+L54: dec *r5
+L55: .string "rmrz"
+clr L281
+add r3, L83
+cmp r3, #-44
+L56: sub L92, r2
+prn L265
+cmp r6, r6
+sub *r6, r5
+stop
+stop
+prn r7
+L57: sub L322, r6
+lea L242, r7
+L58: inc *r6
+L59: not *r1
+clr L249
+stop
+jmp *r7
+; comment
+cmp #-178, #30
+L60: lea L76, r0
+stop
+jsr L218
+not r0
+jmp L237
+mov *r0, L212
+lea L82, *r0
+mov L316, L230
+sub *r3, r5
+L61: lea L233, *r5
+L62: .data -218, -217, -995, -103, -624, 657, -695, 421
+not *r4
+L63: cmp *r4, r6
+not L227
+L64: sub #241, *r1
+
+L65: dec r2
+stop
+red r0
+L66: sub L326, *r5
+clr *r1
+clr *r4
+L67: .data -961, -762, -905
+cmp L261, *r5
+rts
+prn *r1
+L68: stop
+jmp *r0
+bne L232
+lea L191, r6
+lea L248, *r0
+L69: .data 63
+L70: lea L219, r7
+rts
+bne L168
+L71: inc *r1
+not *r6
+not *r4
+prn #-114
+; comment
+L72: jmp *r5
+L73: .string "clhxnlnhothuimgrvaodeoe"
+L74: sub #203, r7
+prn L152
+not L346
+jsr L195
+not r5
+L75: inc *r5
+bne L193
+lea L82, L191
+mov L250, r5
+L76: bne *r7
+L77: jsr L87
+L78: .string "zfwddws"
+not L212
+add *r2, L163
+rts
+rts
+cmp #128, L252
+lea L129, L212
+inc L226
+mov #104, *r5
+sub #-192, L255
+L79: not r3
+L80: jmp *r3
+rts
+lea L206, L200
+jmp *r5
+mov *r7, *r5
+sub #-220, r1
+bne *r4
+clr L285
+L81: cmp r4, #34
+L82: .data -95, -392, 665, -778, -581, -936, 367, -624
+L83: dec r4
+prn r6
+cmp #-243, L161
+L84: lea L239, L234
+stop
+rts
+dec L200
+L85: jsr L343
+L86: stop
+L87: lea L89, L185
+add *r7, *r4
+L88: .data -280, -203, 738, -231, -703, 866
+bne L106
+red r4
+stop
+L89: mov #235, *r4
+not L274
+jsr *r6
+bne *r3
+add #198, *r1
+jmp L175
+sub r6, *r1
+rts
+L90: clr *r1
+sub *r5, L245
+dec L134
+cmp r2, #-252
+prn L111
+jmp L270
+L91: .data -859, -917, -632, 973, 153, -156
+L92: lea L259, *r5
+L93: dec L120
+red *r6
+clr r4
+stop
+L94: prn L336
+L95: rts
+L96: rts
+bne *r3
+L97: .data -726, -540, -1000, 436, 888, 379, 565, 349
+; comment
+clr *r0
+clr *r1
+stop
+L98: red L143
+L99: dec r0
+L100: cmp #-221, L249
+dec r7
+stop
+lea L137, r1
+lea L301, *r2
+L101: sub L142, L103
+inc *r2
+bne *r0
+jmp L348
+red *r2
+L102: cmp *r5, r6
+clr L112
+; comment
+L103: jsr *r7
+rts
+bne *r6
+bne L307
+L104: inc L257
+bne L204
+L105: inc L144
+L106: jsr L230
+prn *r0
+clr L342
+jmp L141
+L107: not r5
+L108: .data 350, 737, 230, 648, -326, 378, 161
+stop
+jmp L226
+rts
+bne L227
+not r4
+cmp *r0, r3
+rts
+L109: lea L330, r1
+clr *r4
+rts
+red L235
+not L211
+stop
+L110: jmp *r4
+inc r4
+L111: cmp *r5, *r5
+rts
+L112: jsr L283
+L113: sub L152, L312
+stop
+lea L161, L306
+L114: .string "ofpstbhade"
+red L252
+red L254
+L115: mov #189, *r1
+L116: .data -118, 59, 504, -533, 988
+jmp L320
+L117: .string "kyxenvkbtdnmqmcsj"
+jsr *r0
+sub r7, r2
+not L194
+lea L124, *r4
+L118: cmp *r7, #-78
+rts
+L119: mov #-154, *r1
+lea L335, L138
+L120: inc L300
+L121: cmp L324, r5
+rts
+jmp L233
+; comment
+L122: .string "rayihlgngghtnfpslq"
+L123: .data -209, -240, 197, 414, -388, 408
+sub *r4, L169
+L124: sub L141, r5
+; comment
+red r1
+; comment
+jmp L259
+L125: .data -237, 730, -352, -354, -937, 305, 28, 307
+clr L289
+L126: jsr *r5
+L127: clr *r4
+L128: inc r7
+L129: clr L201
+lea L337, *r7
+L130: not r5
+inc r1
+L131: lea L339, r5
+L132: .string "wtmnnpzyterpx"
+dec *r6
+red *r7
+L133: stop
+L134: rts
+L135: rts
+L136: .data -719, -270, -485, -76, 360
+L137: .data 116, -708, -701, 250
+L138: add L297, r1
+bne *r3
+jsr *r2
+rts
+L139: add *r1, r3
+L140: .data -6, -588
+rts
+jmp *r7
+jmp *r5
+L141: not L342
+L142: red *r1
+L143: .data -858, 851, -611, -376, -765
+stop
+L144: red r6
+clr *r5
+L145: dec L262
+dec *r2
+jmp *r4
+L146: .data -763, -855
+
+stop
+cmp *r3, #249
+jsr *r0
+cmp *r4, #71
+L147: lea L273, L337
+stop
+add r1, *r2
+sub r4, *r0
+L148: .string "tm"
+L149: red r6
+sub #-101, *r5
+inc L193
+mov #219, L349
+bne *r2
+lea L295, r0
+jsr L214
+L150: .string "nqhznrchjefmmkeialpuf"
+L151: red r6
+jmp L350
+L152: inc r0
+; comment
+jmp *r5
+L153: mov L194, r7
+red L198
+L154: inc r0
+L155: stop
+inc L322
+stop
+inc *r1
+add *r0, L277
+; comment
+jsr L326
+L156: lea L265, L324
+jsr *r1
+prn r4
+red r5
+jmp *r5
+red L283
+not L305
+sub L184, r5
+not L201
+L157: red r3
+L158: inc L241
+L159: inc *r0
+L160: rts
+clr L176
+L161: .string "qvzkfoqiilhxsnqgbcb"
+L162: jsr L279
+L163: bne L235
+lea L236, *r5
+cmp *r6, r6
+L164: dec r6
+mov L250, L226
+sub *r0, *r6
+L165: .string "tng"
+L166: red L204
+L167: jmp L253
+clr r3
+L168: lea L255, r3
+jsr L304
+L169: jmp L185
+L170: .data -182, -87, -865, 365, 918, -401, -346
+stop
+L171: .data 660, 216, -576, -887, -602, 163, 418
+inc *r7
+; comment
+L172: prn L226
+clr L217
+jsr *r6
+L173: lea L341, *r3
+add L186, *r2
+L174: mov L279, r1
+not *r5
+L175: bne *r7
+mov r1, *r6
+bne *r6
+L176: jmp *r7
+L177: .string "lotpxsywmzqciireqspang"
+add L184, L264
+L178: lea L320, *r3
+L179: sub r7, *r3
+jsr *r6
+bne *r2
+L180: stop
+L181: clr *r0
+L182: not *r5
+prn *r4
+L183: not L318
+L184: .string "irhu"
+L185: .string "cdbqjisedqpxwzfqeenuejm"
+jmp L272
+L186: add #-175, *r4
+L187: .data -597
+L188: jsr *r4
+red L293
+L189: .string "vqmlxwcwcbsl"
+inc r2
+
+mov L310, L243
+cmp *r5, *r6
+jsr L217
+L190: cmp #19, r1
+stop
+stop
+add #-16, L220
+L191: prn L249
+L192: add L283, r2
+L193: mov #-111, r7
+rts
+bne *r1
+add #180, L216
+clr *r0
+jsr *r6
+L194: .data -66, 900, 76, -656, 960, 593, -941, -151
+L195: .data -462, 211, 652, -908, -146
+dec *r2
+sub #215, *r6
+jmp *r5
+jmp L251
+L196: bne *r1
+rts
+mov *r0, L230
+L197: jsr L300
+dec r0
+
+L198: .string "vujgwcsqxsiene"
+lea L306, *r5
+bne L348
+cmp #-72, L298
+L199: not *r5
+cmp L246, *r7
+prn *r0
+; comment
+red *r6
+stop
+
+L200: red r5
+L201: .string "eygpsghebdtvvhhz"
+L202: .string "rpyy"
+L203: rts
+clr L322
+; comment
+clr *r2
+L204: .string "bobgeidavrjdpcltrukqatyg"
+L205: jmp L228
+add *r7, r0
+lea L219, r1
+L206: cmp *r6, L282
+jmp L349
+lea L315, L217
+L207: .string "gtcqymhif"
+L208: .data 411, -150, -508, -773, 866, 222
+not r4
+L209: jsr *r2
+cmp #114, *r3
+red *r5
+L210: .string "hthqqzf"
+L211: .string "sirdzbwwgikxleewcwfxd"
+L212: .string "z"
+L213: dec *r7
+L214: dec *r7
+inc L329
+L215: dec L229
+red L305
+clr r0
+add r6, L225
+not r7
+L216: red r3
+L217: mov r2, r7
+clr *r5
+; comment
+red L335
+jmp *r7
+add #-239, r6
+L218: red L282
+prn #-226
+L219: prn r1
+add r5, r7
+add L229, L254
+prn #-161
+inc r2
+L220: add #80, *r6
+lea L337, *r3
+red *r4
+
+L221: mov *r2, *r4
+bne *r1
+lea L257, r3
+dec r2
+sub #-141, r3
+cmp r3, L277
+jmp *r5
+inc L289
+L222: stop
+L223: red r6
+stop
+prn #-240
+jmp L338
+cmp *r0, #-185
+jsr L280
+mov *r3, *r6
+cmp #164, L332
+bne *r4
+add *r7, r0
+L224: inc r3
+not *r7
+inc r0
+
+bne L306
+jsr *r5
+L225: .string "ohwveagdnalqvifyl"
+jsr *r1
+red L272
+L226: .data 515, -746, 35, -515, 950, 787
+L227: not *r7
+L228: cmp #-132, r7
+lea L324, L229
+L229: .data 364, 373, -151, 999
+L230: jmp L349
+jmp *r7
+L231: .data -644
+inc L338
+rts
+L232: prn #123
+dec L343
+clr *r1
+L233: clr r1
+jsr L304
+L234: add r5, r7
+prn r4
+rts
+clr *r4
+L235: .data 582
+stop
+red *r7
+rts
+not *r0
+clr *r5
+clr r5
+sub #-25, L295
+L236: .data 114, 173, -127, -193, -678, -617, 767
+lea L279, r0
+L237: add r5, r2
+mov #-146, L270
+L238: .data 797
+clr r6
+jmp *r1
+jmp *r2
+L239: dec r5
+mov L304, L337
+; comment
+clr *r2
+jmp L249
+red r0
+dec L304
+mov r3, *r5
+not L289
+
+jmp *r7
+mov r7, *r0
+lea L272, r6
+sub *r6, L277
+lea L274, r3
+inc *r2
+prn r7
+inc L345
+red *r5
+L240: .string "sciarwbjoqtwvozbirr"
+L241: .string "boxqyyesdqobymbyhfkeo"
+stop
+
+cmp *r5, L319
+L242: clr *r6
+lea L269, *r6
+add r6, r0
+L243: .data 525, -112, 368, -193, 21, -114
+cmp r7, *r7
+jsr L347
+cmp *r3, L306
+prn *r7
+L244: cmp *r7, *r3
+L245: dec r1
+L246: clr L298
+L247: .string "fzjcqig"
+add r2, *r7
+rts
+L248: bne *r2
+not *r3
+not L318
+lea L304, *r3
+L249: .string "shpiosiqvkgnbuln"
+L250: rts
+bne L309
+clr *r3
+L251: .data 640, 499, -224
+; comment
+not r5
+L252: .data 328, 461, 138, -646, 969, 675, 55, 920
+rts
+L253: .data 341, -410, -334, 243, 446, 63
+jmp L295
+mov L310, r4
+mov L280, *r5
+L254: .string "atqiowao"
+stop
+L255: clr L258
+mov #-104, L349
+not r2
+L256: red *r5
+L257: stop
+jmp *r4
+L258: .string "jvfdsdxoaxezgytaefqk"
+L259: bne *r1
+L260: dec r1
+bne L286
+L261: sub #-156, *r1
+dec *r0
+rts
+dec r0
+L262: mov L329, L284
+L263: dec L311
+jmp *r1
+L264: not *r4
+L265: .data -915, -436, 735, -396, 677, -544
+mov L281, r3
+L266: red *r7
+mov *r0, *r1
+add L276, r7
+rts
+prn L273
+red r4
+lea L308, r4
+L267: .data 846, -92, -415, -499
+L268: dec L299
+L269: red *r4
+mov #17, L315
+; comment
+L270: stop
+rts
+L271: .data 987, -293, -966, -867, -671, -374, -4, 201
+jsr *r0
+dec r7
+prn *r1
+not L307
+L272: stop
+bne L347
+add L326, *r5
+prn L341
+prn r6
+; comment
+L273: .data 349
+L274: .string "pwzzziqhchzntiuuizilt"
+L275: .data -778, -632, -73, 244, -154, -848, -597, -681
+L276: stop
+clr *r4
+dec *r5
+jmp *r4
+L277: .string "sgqnjjomxqzinvccwybov"
+L278: sub *r4, r3
+L279: stop
+L280: .data -87, 963, 221
+L281: jsr L294
+not L308
+jmp *r2
+clr *r0
+bne L285
+L282: jsr L334
+stop
+not r7
+clr L326
+prn L338
+clr r3
+stop
+sub r4, *r1
+red *r3
+L283: jsr *r6
+bne L308
+L284: .data 665, 482, 176, 647, -11, -265, -807
+jmp L325
+stop
+cmp L305, r0
+; comment
+mov L336, L296
+sub #2, r7
+red *r5
+L285: .data -514, 240, 603, 124, -299, -65, 392, 95
+L286: jmp L336
+rts
+L287: sub #-121, r0
+sub #141, r2
+inc *r0
+stop
+sub #40, L324
+rts
+dec r5
+lea L288, r7
+L288: sub *r4, r3
+L289: .data 122, -532, 214, 356, -465, -850, 872, 45
+cmp L336, L337
+jmp *r7
+L290: .string "lddrhcawvj"
+L291: .string "gomijtayidljmwecn"
+; comment
+jsr L345
+L292: red *r5
+add #-66, r4
+L293: bne *r7
+L294: red r5
+mov *r0, *r4
+L295: not r0
+red L343
+red *r2
+inc r2
+L296: .string "gw"
+L297: mov r1, *r3
+mov L315, *r1
+lea L338, r4
+L298: lea L302, L303
+L299: sub L338, r0
+sub *r3, *r6
+L300: add #-184, L320
+L301: .string "nxefeuwqdxcvzhknzsfmelr"
+mov *r0, r4
+inc L302
+sub *r5, L322
+inc L326
+L302: .data 33, -191, 788, -837, 849
+sub #50, *r1
+cmp #-166, r3
+prn L337
+not r7
+L303: prn *r7
+L304: bne *r2
+inc L323
+sub L316, L341
+bne L309
+rts
+prn #72
+dec r3
+not *r6
+inc L343
+rts
+L305: clr r0
+red L336
+lea L334, r5
+L306: sub r6, r0
+inc *r7
+clr L325
+L307: jmp L342
+stop
+mov L341, L339
+cmp *r1, L309
+L308: clr r6
+prn #219
+L309: add L312, r5
+mov L324, r1
+L310: inc L341
+L311: lea L346, *r4
+not L334
+sub L324, *r5
+red r1
+rts
+cmp #-153, r4
+cmp *r4, r2
+L312: .data -366, 429, 317, -758
+L313: jsr *r3
+mov L329, L330
+bne L342
+L314: clr r6
+clr r1
+L315: jmp L343
+sub L330, L344
+L316: mov L322, r0
+; comment
+add #-223, r0
+L317: .string "okrpndnlzxlwxzgwsopw"
+sub #37, L322
+L318: stop
+L319: .data 738, -286, -994, -638, 309, -520, 596, 622
+red r6
+cmp *r5, #-164
+bne *r5
+L320: .data -826, 222, -837, 951, -979, 40
+sub *r2, *r0
+mov #-153, *r2
+stop
+red L346
+jsr L326
+jsr L336
+clr r0
+L321: jsr L346
+dec *r0
+clr r3
+prn r3
+lea L322, r5
+
+L322: dec r7
+L323: add *r4, L340
+jmp L339
+L324: jmp L325
+inc r6
+rts
+add r6, *r1
+rts
+L325: cmp L337, #239
+bne L347
+inc L337
+dec r0
+stop
+cmp #-220, #145
+jmp *r7
+bne L348
+L326: bne L333
+L327: dec r6
+lea L350, r4
+L328: cmp L336, #148
+jsr *r4
+L329: .data -347, 742, -166, -351, 185, 795, -197
+cmp *r4, #162
+sub #212, *r4
+mov #-201, r2
+L330: red L337
+L331: .data -815
+L332: bne *r0
+add #-119, *r0
+L333: dec *r1
+sub *r5, *r4
+L334: cmp r3, L346
+clr r0
+stop
+stop
+L335: .data 418, 575, 653, -556, 655, 139, -867
+not *r0
+add L337, r4
+stop
+cmp L342, #-102
+clr L347
+red *r4
+clr r3
+jmp L347
+not *r1
+clr *r5
+stop
+sub *r5, *r2
+
+prn L347
+not L344
+lea L341, *r0
+
+dec *r3
+bne L347
+L336: inc L348
+L337: mov #254, r1
+L338: dec *r5
+prn #-33
+jmp *r3
+clr r0
+L339: cmp #-126, #142
+dec *r2
+L340: .string "sjbosidksmwnxwescgvsbm"
+jmp *r7
+L341: .data -716, 778, -798, 933, 305, -713, 666
+cmp *r6, r1
+; comment
+bne L347
+L342: stop
+inc L348
+lea L345, L350
+L343: jmp *r5
+jmp *r4
+lea L347, r6
+jmp *r4
+jmp *r4
+L344: .string "elfgbqsy"
+jmp *r6
+prn #22
+jmp *r3
+L345: .string "rnykull"
+rts
+L346: stop
+mov #195, L348
+L347: mov *r6, r3
+lea L350, r0
+L348: .data 708, 260, 752
+jmp L349
+L349: rts
+L350: mov #50, L282
+stop
@@ -0,0 +1,1023 @@
+; Generated by genCorpus --seed 44
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+
+rts
+add #120, *r6
+L0: not L67
+L1: bne *r7
+L2: rts
+prn r4
+dec r2
+mov #19, L33
+L3: stop
+rts
+sub r4, L286
+inc r0
+add *r4, r2
+dec *r7
+jsr *r4
+not *r7
+sub r0, r2
+stop
+jsr L89
+jmp L93
+cmp *r4, r0
+sub L91, L62
+add *r7, r3
+L4: rts
+not *r2
+red r1
+L5: jsr L60
+L6: stop
+cmp r3, L36
+red *r7
+L7: stop
+not *r2
+add r6, *r1
+jmp L128
+L8: cmp L107, #-198
+jmp L59
+jmp *r1
+stop
+L9: sub #34, *r1
+rts
+L10: jsr *r5
+cmp #9, r0
+L11: sub #158, r2
+L12: not r7
+L13: clr L164
+lea L157, L160
+L14: prn *r3
+jsr L290
+prn L91
+red r4
+jsr *r3
+L15: not L204
+L16: mov r1, r2
+not *r6
+L17: .data -703, -16, -3
+L18: inc r3
+rts
+cmp #200, r4
+cmp L139, *r2
+stop
+add r4, *r7
+mov *r2, L169
+cmp #53, *r3
+sub *r3, r6
+prn #91
+red L295
+L19: sub *r1, L301
+not *r0
+L20: .string "jccjjcnrrjepusainls"
+jsr *r2
+L21: .data -46, -656, 158, -437, -341
+jsr L62
+sub r3, r2
+stop
+cmp *r2, #-204
+rts
+stop
+jmp *r7
+rts
+L22: .data 254, -753
+L23: red r6
+L24: clr r3
+L25: .string "ktzhvhwkxbc"
+lea L319, *r2
+bne *r5
+lea L44, r7
+L26: .data -660, 261, -489, -974, 696, -919, -675, -459
+L27: .string "gkfqmvyu"
+jmp L139
+dec *r5
+dec r4
+bne *r2
+jmp *r1
+rts
+clr *r5
+L28: .data 630, -380, 501, 68, -974
+L29: cmp L179, #-177
+jmp L48
+dec L139
+dec r3
+clr L95
+L30: bne L247
+cmp #-96, L279
+lea L319, L274
+jmp L134
+L31: stop
+L32: lea L106, r3
+L33: .string "dhhxdabfwetcgpsphyovp"
+lea L81, L64
+dec *r2
+lea L39, r4
+add r0, r6
+L34: cmp L277, #-148
+cmp #240, #78
+L35: prn *r7
+sub L275, r5
+sub #-194, r4
+stop
+clr *r6
+L36: rts
+inc L103
+jmp *r7
+L37: .string "pfptxmtumeqnzpzmfdpih"
+not L141
+red *r7
+sub L122, *r1
+bne *r6
+L38: sub L326, L316
+L39: lea L78, L237
+stop
+L40: lea L304, *r7
+prn r5
+mov *r3, L315
+; comment
+add L258, *r2
+L41: dec *r1
+L42: mov *r4, *r0
+clr r7
+mov L155, r7
+lea L78, *r7
+mov L92, *r4
+add L293, *r6
+L43: .string "vjefirmae"
+L44: .string "iglrnmafaxzs"
+prn *r2
+not L45
+red r5
+L45: bne L236
+jsr L65
+L46: rts
+red r0
+prn *r1
+L47: lea L199, *r4
+L48: .data -3, -398, -557, 997, -251, -300
+mov L110, r2
+sub #-121, r5
+L49: inc *r0
+mov *r7, r2
+jmp *r3
+mov r1, r7
+cmp L64, r1
+L50: .data -367, 681, 440, 871, -756, 493, -660
+prn #-248
+clr *r2
+L51: .data 718, 901, -448
+L52: add *r1, *r4
+L53: add *r5, L151
+dec L229
+cmp #93, r4
+L54: prn r7
+L55: clr L118
+; comment
+add #213, *r2
+mov r1, r1
+add *r3, *r6
+jmp L202
+dec *r3
+dec r0
+
+L56: bne L95
+clr L236
+rts
+clr L297
+L57: jmp *r2
+not L183
+red *r2
+bne L311
+rts
+not *r2
+; comment
+bne L294
+cmp L68, #-121
+L58: bne L75
+L59: bne *r6
+jsr *r6
+L60: jmp *r3
+prn L111
+add r3, *r1
+L61: jmp *r1
+stop
+inc L112
+red r4
+add r2, L181
+L62: .data 851, -821, 378, 401, 456, -195
+jmp *r5
+L63: red L160
+dec r5
+bne L124
+L64: clr r3
+L65: stop
+prn L217
+L66: inc *r6
+L67: sub L136, r5
+add r4, *r0
+not L262
+L68: jmp L285
+L69: .data -207, -285, 304, -551
+bne *r3
+L70: not r2
+L71: sub L309, *r5
+lea L107, *r2
+bne L327
+jsr *r3
+sub r0, r2
+L72: .data -715, 228, 571, -968, -85, -967, -786, -746
+jsr *r7
+lea L131, r0
+L73: .string "ncpxolerqzkhswwezaa"
+stop
+jsr L219
+rts
+sub *r3, *r1
+not r0
+jsr *r1
+mov r6, L244
+jsr L241
+add #-149, r3
+L74: jmp *r7
+sub #81, L146
+clr *r2
+red *r3
+L75: .data 618, -620
+red L292
+bne *r4
+red r6
+sub *r3, r0
+lea L189, *r5
+add #143, r1
+; comment
+cmp #154, *r5
+prn *r6
+rts
+bne *r5
+stop
+L76: add r4, *r4
+; comment
+L77: stop
+L78: add #200, L121
+rts
+inc *r4
+L79: .string "xfgvoahlbrtcwd"
+jsr *r4
+clr *r7
+jsr L290
+add L255, L285
+prn L118
+L80: inc L167
+L81: jmp L211
+prn *r4
+sub #250, *r4
+L82: prn L251
+stop
+; comment
+dec L154
+rts
+L83: sub L112, L121
+L84: lea L144, r1
+L85: red *r1
+cmp #-86, *r0
+not r3
+L86: .string "mmlhromrkxbvju"
+L87: red r1
+add #-190, r0
+jsr *r1
+jsr *r2
+clr r0
+mov L158, r6
+bne L88
+jmp *r0
+L88: lea L231, *r0
+clr L297
+L89: jmp L200
+jsr *r4
+L90: bne *r0
+L91: jmp *r5
+L92: mov #-205, L95
+rts
+jsr L313
+inc *r6
+rts
+bne *r2
+L93: clr L144
+stop
+; comment
+sub r0, r7
+sub #-153, r6
+mov r3, L247
+inc *r0
+inc r2
+add L221, L255
+cmp *r6, r5
+not *r4
+dec L124
+L94: clr *r4
+L95: clr L280
+L96: inc r1
+prn *r4
+L97: .string "wckmvhvlgzcqj"
+red *r7
+jsr *r7
+add #-88, L263
+jsr *r0
+cmp *r3, r1
+add #-249, *r4
+L98: mov r4, *r2
+; comment
+L99: .string "isyeqsitapgtmj"
+L100: jmp L313
+red *r5
+; comment
+L101: .data -448, 466
+mov *r3, *r7
+cmp #160, *r1
+L102: not *r0
+mov *r7, *r5
+jsr *r0
+L103: .string "ejwigtaibxng"
+L104: .string "pcstdnve"
+lea L307, r1
+L105: .data -901, -153, -204, -389, -61
+L106: add #46, *r3
+not *r4
+clr L233
+L107: .string "vjqz"
+
+L108: prn *r1
+L109: not r2
+L110: .string "tyfvekkjjznlvht"
+add r6, r0
+clr L209
+L111: add *r7, L149
+rts
+L112: stop
+L113: cmp r1, #130
+jmp *r5
+clr *r6
+L114: .string "tevhvxmmgc"
+L115: .string "eankfpxtlpnuxwvrvkvoxb"
+lea L288, r5
+lea L195, *r7
+L116: rts
+sub *r0, r0
+L117: clr r4
+inc r3
+sub r3, L319
+clr L142
+L118: .string "lrh"
+mov L177, r0
+L119: .data -451, -659
+L120: jsr L179
+L121: .string "orwodrvkailb"
+L122: jmp *r6
+L123: .string "hhpyfcslkgmjazbxcjtjiely"
+mov L146, r5
+inc r0
+rts
+jmp *r2
+jmp L324
+L124: jmp *r2
+inc *r5
+red L146
+L125: dec *r3
+not *r5
+L126: dec r5
+L127: .string "uqycfwgvhdxfkujoqf"
+bne *r3
+L128: stop
+L129: .data -828, -929, 151
+mov r4, *r4
+rts
+stop
+L130: rts
+L131: prn r0
+not L139
+prn *r5
+L132: inc *r5
+sub r1, L314
+mov *r3, *r1
+clr L218
+L133: lea L288, r4
+prn r7
+inc r5
+add *r6, L229
+add r5, r4
+bne L277
+L134: dec *r4
+not r0
+L135: .string "llzftphvtmojbv"
+L136: not *r7
+L137: red *r5
+not *r0
+jsr L243
+L138: mov #-150, r4
+stop
+jsr L312
+red r3
+rts
+L139: sub r3, L187
+L140: cmp *r7, L167
+cmp r5, #-160
+add r5, L158
+L141: sub r1, *r4
+stop
+cmp #152, L278
+L142: add r4, *r5
+mov L143, *r4
+prn *r4
+stop
+stop
+red *r2
+jmp L189
+L143: .data 150, 188, 364, -724
+sub r3, *r2
+L144: prn #133
+jsr L329
+rts
+mov #135, L207
+L145: dec r3
+jsr L198
+bne *r0
+L146: mov r5, r5
+sub *r3, L148
+inc r1
+L147: mov r7, r3
+rts
+add L233, L306
+L148: clr *r4
+L149: mov r6, *r0
+stop
+prn #-65
+clr r7
+jsr *r4
+add #247, L311
+clr r0
+inc r3
+L150: rts
+; comment
+L151: rts
+inc L266
+stop
+red *r1
+L152: sub *r7, L276
+stop
+red *r4
+clr *r3
+L153: .string "bhy"
+L154: mov r5, r1
+
+mov L161, r7
+lea L252, *r2
+L155: inc L215
+L156: red r1
+sub #243, L250
+L157: dec *r4
+L158: jsr *r3
+bne *r5
+mov L280, *r4
+dec *r3
+not r6
+bne *r0
+jmp L237
+prn #-201
+L159: .data -718, -80, 379, -271, 544, 131
+cmp #-9, r1
+; comment
+L160: .string "fpcxjqevksetkvqmpn"
+clr L253
+red L179
+cmp r3, *r2
+not L239
+jmp L266
+cmp r5, #-170
+L161: rts
+lea L265, *r5
+add *r1, r1
+jmp *r7
+prn L170
+L162: inc *r2
+prn #-61
+prn L275
+sub r3, L222
+L163: sub #-144, r5
+L164: dec r1
+jmp L281
+L165: red *r3
+mov #142, r4
+mov #167, *r4
+cmp L328, *r1
+add L207, r3
+jmp L264
+L166: not *r0
+lea L311, r6
+L167: clr r7
+prn r3
+cmp *r7, *r4
+add L286, L221
+jmp L173
+mov *r5, L264
+rts
+bne *r2
+red *r5
+not L237
+not r3
+rts
+L168: sub r1, r6
+L169: lea L295, *r4
+rts
+L170: dec *r5
+sub r7, r1
+sub #-150, r6
+add *r1, *r4
+lea L294, *r5
+L171: .data -959, 485, 73, -654
+sub r2, L179
+L172: .data -41, -802, 224, 748, 863, 524, -651
+dec L207
+inc L174
+sub r6, r2
+inc *r5
+L173: .data 605, -866, -159, -888, -310, 657, -384
+
+L174: inc *r3
+clr r1
+L175: jmp *r0
+add L284, L277
+rts
+L176: mov *r3, L267
+L177: .string "hfqhbnuezkzi"
+L178: not *r5
+; comment
+dec *r5
+cmp r1, r1
+jmp *r1
+L179: red L322
+red *r0
+L180: .data -924, -647, -56, 224, 195, 819, -845
+L181: .data 125, 306, -958, -491, 954, 632
+lea L277, *r5
+sub r2, L271
+jsr L229
+sub #-239, *r1
+; comment
+
+rts
+prn r3
+L182: cmp L186, L274
+clr *r1
+mov L206, r0
+L183: red L325
+L184: .data 906, 623, 232, 655, -706, 995
+L185: .string "zdfpjtjg"
+not r3
+red *r0
+sub L262, r6
+; comment
+stop
+bne *r4
+inc *r2
+
+jsr *r1
+L186: add *r0, *r3
+; comment
+sub L250, L243
+L187: lea L267, *r0
+clr *r6
+L188: cmp L278, #30
+L189: sub r3, *r1
+stop
+clr *r7
+not L238
+bne *r1
+inc *r1
+jmp L250
+cmp r6, #220
+L190: jsr L205
+mov #-45, r1
+jsr L327
+sub #51, r5
+not *r2
+L191: bne L271
+mov L319, *r4
+not *r6
+L192: .data 579
+L193: clr r0
+L194: .string "witgdonolx"
+stop
+cmp *r7, L218
+bne L212
+prn L206
+inc r5
+L195: lea L206, r6
+L196: jsr *r7
+
+mov #-98, r2
+lea L199, *r2
+L197: .string "szpklsehcmhuudidvh"
+sub L329, *r5
+clr *r5
+L198: jmp *r2
+L199: clr *r0
+L200: .data -864, -649, -718, -4, 363, -232, 546, 509
+jmp *r0
+not r5
+L201: .string "juwgmthkjmuflcqqa"
+jmp L255
+lea L274, *r0
+L202: clr *r1
+clr r5
+lea L263, *r6
+L203: inc L227
+L204: jmp L214
+L205: prn r2
+L206: clr *r2
+red r1
+stop
+sub #-147, r5
+clr L290
+L207: sub *r5, L318
+lea L263, *r1
+stop
+jsr *r5
+not *r6
+not *r6
+dec r2
+L208: cmp L238, #206
+L209: lea L278, *r1
+red r6
+inc r0
+L210: inc r5
+dec r4
+jsr *r6
+lea L261, L224
+L211: .string "gkvnnuzcraeqxenzxymoe"
+bne L274
+add L296, *r5
+; comment
+stop
+rts
+L212: .string "pyfbjrfltbrapcpndebci"
+L213: cmp *r4, *r5
+bne L305
+L214: clr r3
+mov #-23, r3
+cmp L252, L324
+mov *r7, L269
+jmp L285
+L215: .string "wvnrzashjhmfmntd"
+lea L299, L225
+L216: .string "q"
+prn #-2
+
+inc r2
+L217: .string "ovu"
+cmp r7, *r7
+L218: cmp #-161, *r7
+L219: .data 273, -635, -506, -198
+L220: cmp r6, #-2
+prn r1
+dec *r3
+dec r2
+inc L265
+L221: prn L281
+stop
+L222: cmp *r2, #155
+rts
+L223: lea L319, *r5
+inc L322
+L224: sub #-175, *r1
+lea L288, L241
+jsr L316
+L225: mov L262, r0
+L226: prn L241
+jsr L305
+L227: .data 742, 384, -284, 169, -568, -432, -600
+stop
+L228: not *r5
+mov L252, *r4
+mov *r3, r0
+rts
+lea L289, *r2
+cmp L306, L286
+clr L232
+dec L245
+not *r6
+prn L308
+rts
+L229: .string "scrdqlexjuhtg"
+sub r1, r2
+L230: stop
+sub L291, *r5
+jmp *r4
+L231: .data -66, -741, -359, 339, 463, -162, 596, -816
+add L323, L326
+dec L233
+clr *r6
+L232: .string "yhlagh"
+L233: prn L319
+L234: mov #147, L326
+; comment
+cmp L318, L249
+inc L250
+mov L309, r4
+sub *r0, r5
+dec r4
+jsr L279
+stop
+L235: prn *r5
+mov L293, r3
+jsr *r4
+L236: clr r5
+dec L269
+jsr L265
+sub *r7, L315
+L237: cmp *r2, *r7
+red *r4
+mov r0, *r0
+rts
+jmp L256
+L238: .data 319
+inc L300
+L239: .string "widppvxpuwbwktygcyp"
+jsr *r5
+add #187, L261
+L240: dec *r0
+L241: sub L250, *r0
+L242: .string "ldkypexuabrrvw"
+prn *r2
+; comment
+L243: .string "hiykphgfqgppltv"
+jmp L300
+L244: jmp *r6
+L245: .string "eisukzqbztkrjq"
+dec r3
+L246: sub #129, *r5
+prn *r6
+red r0
+cmp #-207, L287
+sub L271, r5
+L247: rts
+stop
+dec *r4
+L248: clr r1
+stop
+
+prn *r6
+not r7
+jmp L269
+L249: lea L308, r6
+prn L302
+bne *r5
+
+stop
+lea L319, r5
+dec *r6
+jmp *r4
+rts
+jmp L257
+red *r6
+L250: sub *r2, *r6
+mov *r1, r2
+jmp *r1
+lea L302, *r3
+cmp r6, *r0
+clr r4
+L251: .string "flywtzsrg"
+red L301
+L252: cmp L307, r7
+bne *r3
+prn L308
+L253: .data -174, 999, -425, 650, 710
+rts
+rts
+mov *r3, L302
+L254: .string "mpswny"
+jsr *r7
+L255: prn #-255
+L256: not *r4
+; comment
+L257: prn #-101
+L258: .string "lhrgbdypkos"
+dec r7
+L259: lea L312, r2
+red *r4
+red L328
+jmp *r0
+not *r4
+L260: .string "j"
+clr *r3
+add *r1, *r2
+L261: .data -463, 907, -725, -627, 917, 252, -732
+L262: mov r3, *r7
+clr *r6
+dec *r1
+L263: .data -878, -59, -38, 781, 182, 178
+prn r0
+lea L323, r1
+mov #-67, r4
+add *r4, *r5
+L264: jsr *r1
+stop
+not L288
+L265: red r3
+cmp *r4, L295
+L266: stop
+jsr L316
+
+L267: sub *r4, *r2
+stop
+jmp *r3
+clr r6
+stop
+L268: .string "gimiazdujceyguaimxcmyxd"
+sub #228, *r1
+prn L297
+L269: .data 991, 566, 63, 235, 220
+L270: .data -322, 334, 49, 174, 990
+red *r6
+L271: jmp *r0
+L272: lea L328, L311
+sub L328, *r3
+L273: inc r7
+dec L311
+L274: lea L275, L329
+add r0, *r0
+add #86, r4
+stop
+stop
+clr L289
+L275: red r0
+lea L296, r4
+jsr L319
+L276: cmp #46, *r3
+L277: red r5
+
+L278: jsr *r1
+add L294, L295
+L279: prn r3
+lea L280, L309
+mov #-105, r4
+mov r3, r5
+L280: clr L305
+L281: prn #188
+L282: .data -950, 991, 987, -520, -387
+inc *r3
+L283: stop
+sub #213, *r2
+L284: mov #125, r5
+L285: rts
+add r5, L297
+L286: red r6
+jsr *r2
+prn *r7
+dec *r6
+L287: .string "xn"
+stop
+cmp L301, #221
+lea L299, *r4
+mov L326, *r5
+rts
+jmp *r5
+inc r2
+
+L288: inc r2
+L289: .data -439, 48, -643, -428, 184
+inc L309
+add L318, r5
+lea L322, L311
+dec *r1
+clr *r2
+dec r6
+sub *r6, *r3
+L290: .data -610, 351, 526, 403, 709
+jmp *r4
+L291: dec *r7
+sub *r3, r4
+L292: .string "shkyeujeensxxi"
+prn r1
+; comment
+inc *r3
+inc L322
+lea L296, *r0
+L293: dec r3
+rts
+L294: .string "uyshlwbgx"
+jmp L319
+L295: sub L312, *r4
+not r4
+L296: .string "w"
+jsr *r0
+not L305
+
+L297: prn *r3
+jmp *r1
+jmp *r0
+L298: inc *r1
+inc r2
+; comment
+bne *r0
+prn #248
+mov #-253, *r4
+; comment
+L299: jmp *r4
+lea L319, *r3
+L300: red r7
+L301: .data 726, -579, 27
+jmp *r0
+mov L317, L308
+red r5
+; comment
+bne *r2
+stop
+rts
+add r0, r7
+prn L307
+L302: clr *r1
+not r4
+sub L314, *r4
+L303: red L316
+not *r0
+L304: stop
+not r5
+L305: not *r1
+rts
+jsr *r7
+dec r7
+L306: .data -414, -378, -237, 114, 358, 843, 813, -842
+L307: .data 579, -13, 972, -112, 255, 773
+jsr *r2
+prn #-13
+L308: red L312
+cmp L319, *r1
+add L310, L320
+rts
+cmp #-144, *r4
+jsr *r5
+dec r5
+L309: prn L314
+L310: .data 550, 757
+L311: .data -721, 932
+clr r3
+clr *r3
+L312: jsr L320
+L313: dec r3
+L314: not *r1
+jmp *r5
+L315: rts
+L316: cmp r6, L320
+sub *r2, L325
+jmp *r5
+L317: bne L324
+L318: bne *r0
+bne *r0
+L319: not r4
+sub *r3, *r1
+add r3, *r1
+L320: bne L325
+L321: mov r7, *r5
+L322: .string "dnaltke"
+add #205, L329
+
+sub *r3, L329
+cmp r5, *r7
+bne *r6
+prn L328
+L323: prn L324
+L324: clr L329
+not r2
+L325: red r1
+L326: stop
+inc r2
+L327: mov *r0, r5
+lea L328, L329
+L328: rts
+mov #245, r3
+
+add *r5, L329
+mov r4, *r4
+L329: red r5
+lea L35, *r6
+stop
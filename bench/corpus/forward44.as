@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 45
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: stop
+not r5
+; comment
+red L13
+L1: mov L35, r4
+cmp *r5, r4
+clr r7
+L2: .data -651, -331, 488, -80, -189, -886, -114
+cmp L241, L231
+add L90, L138
+L3: cmp r1, L260
+sub #193, L308
+inc L251
+L4: prn r4
+inc *r4
+L5: red r6
+L6: dec r6
+mov *r2, *r2
+lea L126, *r7
+dec r1
+not *r4
+L7: stop
+L8: .string "fytuqukunbybp"
+not *r7
+lea L28, *r4
+dec *r1
+inc r5
+stop
+cmp r6, *r2
+clr L90
+L9: dec r7
+add r6, *r5
+inc *r1
+stop
+L10: stop
+L11: .data -923, 210, -145, -923, -509
+sub #-194, *r4
+L12: .string "kibbcksjv"
+L13: lea L316, r7
+jmp L56
+jsr *r5
+clr *r7
+jmp *r2
+bne L237
+mov #-37, *r3
+L14: .string "hszihtmhqncamrqhpguy"
+L15: inc r6
+dec *r6
+L16: mov #40, L168
+L17: rts
+lea L90, L244
+red L29
+L18: stop
+L19: mov r7, *r0
+L20: .string "szav"
+rts
+lea L269, *r3
+L21: clr *r2
+L22: rts
+not L271
+L23: clr *r6
+L24: .string "dzkaxdmk"
+L25: jsr L238
+L26: stop
+L27: stop
+rts
+mov *r0, L270
+L28: .string "ls"
+stop
+dec *r3
+L29: sub *r2, r7
+; comment
+add L295, r6
+red *r3
+bne *r5
+L30: .data -324, 903, -92, 384
+L31: clr r4
+L32: clr L77
+bne L287
+L33: mov *r4, r6
+L34: .data 500, 751, -157, 232, 276, 553, -218, 403
+L35: dec *r2
+L36: rts
+jmp L280
+; comment
+clr L113
+clr *r2
+jmp *r0
+not r6
+L37: red *r2
+lea L194, L181
+sub L72, L291
+L38: lea L227, *r6
+mov *r2, *r0
+sub #202, r6
+rts
+L39: inc *r7
+lea L66, L301
+L40: rts
+jmp L342
+red *r4
+L41: lea L71, L251
+L42: not *r4
+cmp *r3, L101
+rts
+rts
+mov L278, r1
+jmp *r3
+L43: cmp L172, r0
+bne L329
+dec *r5
+L44: inc L188
+jsr L285
+jsr *r5
+L45: mov r3, r1
+jmp L100
+; comment
+dec r7
+mov *r7, *r2
+L46: not L211
+; comment
+L47: .string "jkmpxvxskkqoxxjxulumrbv"
+mov r5, L309
+L48: sub r7, r2
+not r4
+stop
+jsr L288
+L49: .data -190, -797, -765, 661, 118, -529
+bne L322
+inc r3
+L50: mov *r2, L113
+prn #-33
+lea L90, *r6
+jsr *r7
+mov r5, *r7
+L51: cmp L201, L245
+clr *r3
+L52: add #-25, *r3
+jsr *r2
+L53: jsr *r1
+L54: inc *r3
+prn r6
+mov #12, L188
+inc L69
+prn L291
+clr L94
+add L262, L182
+not *r5
+L55: .data 193, 43, 992, -264, -258, 675, -689, 511
+not L155
+lea L339, L332
+dec L247
+clr L184
+lea L123, r2
+inc r1
+not L283
+not r5
+L56: .data -76
+prn r6
+rts
+jsr *r5
+stop
+L57: jmp *r6
+L58: jmp *r6
+L59: rts
+not *r7
+L60: jmp L326
+jmp *r5
+mov *r6, L311
+mov #201, L105
+lea L180, *r5
+mov *r7, *r6
+L61: not *r6
+red r1
+red L182
+clr L115
+; comment
+cmp r1, r0
+bne *r2
+inc L322
+inc r6
+clr *r2
+L62: mov *r0, *r7
+jmp *r6
+clr L87
+L63: .data 879, -367, -685, 355, -790, 614, 134, -879
+jmp *r3
+mov r2, r2
+L64: rts
+lea L77, L319
+bne *r7
+clr r6
+L65: lea L249, *r4
+lea L215, r0
+L66: inc L79
+lea L332, L199
+; comment
+sub L193, r3
+add #128, L188
+clr L220
+mov r4, r5
+L67: prn #114
+L68: jmp *r7
+cmp L149, r6
+add L258, *r3
+L69: jsr *r6
+; comment
+L70: .string "tgtygbmtginc"
+lea L298, L150
+not *r4
+
+cmp L173, r6
+L71: .string "kusiclcp"
+sub #158, L333
+jsr L277
+jsr L251
+rts
+L72: clr r3
+prn #-22
+L73: add #-66, *r0
+dec L263
+L74: lea L103, r7
+sub #221, *r3
+L75: .data 979, 955, 543
+L76: add *r3, L312
+jmp L141
+not r3
+L77: .string "dlzteb"
+L78: cmp L174, *r6
+clr *r5
+lea L291, r3
+add #103, *r1
+rts
+cmp #104, #-12
+L79: bne *r4
+dec L182
+rts
+L80: .string "irnryu"
+mov #-82, L239
+L81: jsr L338
+L82: clr L271
+L83: dec r0
+cmp #-242, #-25
+L84: .string "zowapva"
+lea L290, r3
+L85: jsr L245
+prn #-249
+jmp L143
+jsr L284
+mov r1, r6
+jsr L261
+prn *r2
+add *r6, r1
+rts
+jsr *r5
+L86: .data 609, 931, 970, -103
+
+red L216
+inc *r6
+bne L331
+L87: red r2
+inc L111
+stop
+cmp *r1, *r5
+sub *r5, r5
+L88: bne L177
+jmp L141
+L89: .data 426, -299
+stop
+L90: lea L189, *r3
+lea L127, L283
+L91: .data 340, -719, 856, -261, 6
+jsr L186
+L92: inc *r0
+L93: .string "ndqakqlxebzhzmufnuvno"
+L94: lea L168, *r0
+L95: stop
+add *r0, *r6
+L96: .string "dejfdfupfracqqj"
+L97: prn r5
+prn #195
+clr *r0
+dec L318
+rts
+dec *r2
+; comment
+stop
+jsr L274
+jmp *r5
+jsr L211
+L98: .string "lhyhhshwufxkxqu"
+L99: inc *r2
+cmp r6, *r6
+L100: bne L325
+jsr *r6
+L101: dec L122
+rts
+lea L300, r3
+stop
+stop
+L102: clr r2
+L103: not L203
+add #57, L282
+prn L250
+L104: lea L339, *r5
+dec L325
+cmp r7, #21
+L105: lea L193, *r7
+bne *r4
+L106: sub *r5, L133
+jsr L222
+clr r0
+jsr L310
+cmp L213, *r1
+rts
+stop
+L107: stop
+add r5, L174
+L108: jmp L276
+L109: sub #64, *r5
+L110: lea L310, *r5
+L111: clr r7
+sub L248, *r3
+rts
+sub L160, r7
+rts
+L112: .string "lbdlp"
+sub r5, *r1
+inc L268
+inc L174
+; comment
+rts
+inc r6
+L113: .string "ojpbkksswi"
+mov r6, L316
+L114: lea L214, *r7
+add L168, r2
+clr *r7
+L115: bne *r1
+prn L191
+
+dec r6
+L116: .string "rmrlcrweuhzjfvvyoniojgu"
+stop
+jsr L136
+L117: sub L278, *r2
+L118: cmp L268, *r3
+inc *r3
+cmp r3, L238
+L119: mov *r7, *r6
+L120: stop
+L121: .string "byeckynjriqirfcwve"
+not r6
+dec *r6
+mov L141, L299
+L122: add #25, L146
+clr *r1
+sub *r5, *r2
+inc r7
+jmp *r2
+bne L131
+lea L259, *r3
+bne L144
+jmp L255
+; comment
+rts
+lea L127, *r4
+L123: bne L249
+L124: jsr L177
+cmp *r7, #177
+L125: .data 935, 162, 616, 179
+jmp *r0
+L126: clr *r5
+L127: clr *r2
+bne *r2
+dec *r0
+L128: stop
+jsr *r1
+L129: .string "mrdsyldliamfeyboaliaias"
+
+L130: inc r3
+stop
+dec *r4
+L131: inc L267
+L132: rts
+stop
+cmp #-92, L337
+lea L182, *r4
+L133: .data 146, -509, -589, 740
+sub *r1, L264
+L134: add L150, *r2
+mov r1, L304
+L135: dec L178
+clr *r7
+L136: .string "cqsvvqkxsfeejytzuesiuudt"
+red r2
+L137: rts
+not L246
+L138: jsr *r0
+lea L286, *r7
+L139: .string "cho"
+inc L169
+rts
+L140: prn #176
+mov L277, L261
+L141: prn L318
+L142: dec L318
+
+L143: .string "yqbwjecsgirtdqkucc"
+L144: jmp L300
+L145: dec r7
+L146: .data 921, -604
+rts
+not r7
+bne L241
+L147: stop
+inc *r5
+not L333
+clr *r6
+prn #-168
+jmp *r5
+jsr L167
+L148: .data -383, -635, 380
+dec *r0
+stop
+inc L316
+prn L262
+red r0
+
+L149: .data -927, 342
+L150: jmp *r3
+prn L204
+L151: sub L308, L282
+L152: prn r4
+L153: lea L168, r4
+jsr *r1
+L154: bne *r4
+L155: .string "erefb"
+L156: add r7, L274
+mov r0, r5
+stop
+mov *r4, L199
+mov #141, r4
+L157: jsr L232
+sub *r4, r6
+lea L262, *r4
+L158: jsr *r2
+jsr *r0
+prn r3
+lea L177, r2
+L159: .data -604, 796, 575, -632, 500
+; comment
+jmp L314
+bne *r0
+lea L235, *r0
+; comment
+dec *r2
+L160: .string "xbhsjzzyjjcpjvsyepadthkw"
+L161: not *r0
+clr L231
+L162: sub r2, *r5
+add #-107, L180
+L163: add *r4, L170
+L164: .data 353, 589, -105, 500, 128
+mov L284, *r4
+cmp *r1, #-1
+lea L308, *r3
+stop
+clr r6
+mov L222, L192
+L165: cmp *r6, *r1
+bne *r6
+L166: not *r2
+L167: stop
+L168: .string "irsygdpvx"
+L169: dec L316
+mov L309, r4
+cmp L269, *r2
+L170: sub L192, L338
+jsr *r0
+L171: jsr *r6
+L172: not r2
+; comment
+bne L317
+jsr *r1
+prn *r7
+stop
+L173: prn L261
+jmp *r3
+
+add L228, r3
+L174: .data 827, -912, -205, -500
+jmp L228
+clr L229
+red r2
+add L304, *r4
+L175: mov *r5, r2
+L176: .data 14
+bne *r0
+cmp L286, *r7
+red r3
+prn #195
+not L236
+add r6, *r0
+dec L299
+lea L299, r5
+L177: lea L249, r7
+L178: clr L327
+L179: bne L278
+add r7, r1
+L180: red *r1
+L181: .string "spvv"
+jsr *r6
+L182: .string "ypoofzqphbiwqvzc"
+lea L219, r3
+L183: prn r0
+add L243, r0
+cmp r2, #161
+sub #-237, r7
+L184: .string "qgebtp"
+dec L273
+L185: sub #-198, L334
+jmp *r2
+jsr *r2
+prn #-19
+L186: .string "cnhvrag"
+L187: inc *r5
+red L200
+L188: dec r2
+stop
+not r3
+L189: mov L330, *r5
+clr r3
+L190: mov r1, *r1
+dec r3
+L191: jmp L338
+L192: jmp *r6
+jmp *r2
+mov *r7, r0
+L193: .data -255, -418, -988, 369, 720, -832, 215, 272
+dec *r3
+; comment
+inc *r2
+rts
+not L206
+L194: .data -921, -427, 540, 497
+L195: sub L265, L302
+L196: red *r1
+bne *r0
+rts
+L197: rts
+lea L288, L284
+L198: clr L239
+bne L336
+jmp L238
+inc *r1
+L199: .string "ksdcatytiqxfxclpptxpfhia"
+L200: cmp L331, *r4
+not r5
+L201: .string "ouevegavmjvw"
+L202: cmp L255, *r4
+sub L264, L238
+dec *r7
+jmp *r5
+cmp r6, #252
+bne L205
+red r6
+add r0, L266
+not L221
+L203: jmp *r6
+rts
+jmp L306
+L204: .data -214, -709, 845, -461, -602, 656, 539, -679
+; comment
+inc *r2
+L205: mov #-108, L272
+add L276, L262
+L206: .string "fwafnhtpgfgmlm"
+not L240
+stop
+L207: .data -551, 287, -770, -569
+jsr *r4
+dec r1
+L208: clr *r1
+L209: dec r5
+stop
+L210: .string "rahpahbfnbyq"
+lea L257, r6
+stop
+cmp *r6, L277
+cmp #2, L279
+red L236
+L211: jsr *r7
+jsr L249
+L212: lea L231, L258
+L213: bne L305
+L214: bne L303
+jsr L319
+bne *r5
+stop
+rts
+bne *r2
+L215: .string "zxezxdmurapahmdmfexq"
+not *r0
+add r6, L258
+jmp *r4
+prn L225
+L216: red L298
+L217: .data 246, 200, 189, 942, -708, -528, 628
+bne L225
+rts
+prn r1
+mov *r3, *r1
+L218: .string "scho"
+cmp *r0, r0
+mov #200, r7
+not r1
+prn #-71
+L219: .data 393, 64
+sub #-1, *r7
+L220: bne *r1
+L221: cmp *r4, #204
+L222: jmp L334
+not *r4
+L223: .string "smhkjmcppmemnvep"
+stop
+L224: .data 156, 262, 98, 786, 615, -196
+L225: .string "rwwotucslysvxebnurtjyt"
+L226: .string "af"
+dec r7
+rts
+; comment
+L227: .string "hp"
+rts
+cmp #-91, *r1
+L228: prn L334
+not r0
+inc *r7
+prn L293
+; comment
+inc L318
+jsr *r6
+dec r6
+sub #32, r1
+L229: inc L291
+L230: .string "g"
+lea L331, L247
+; comment
+not L307
+L231: .data -216, 102, -845, 26, -449
+mov r3, L289
+; comment
+jmp L303
+jmp L235
+sub #-23, r6
+; comment
+not r4
+jsr L310
+jsr L267
+cmp #55, *r0
+L232: .string "e"
+mov #-256, *r1
+not *r4
+L233: .string "qudeij"
+L234: .data -937, 313, -766, 559, -687, 509
+L235: rts
+L236: mov *r7, r1
+jmp *r5
+add r6, L259
+inc *r2
+L237: jmp L251
+L238: .string "w"
+rts
+stop
+not r6
+inc r7
+L239: .data 836, -828, -950
+sub L286, *r2
+jsr *r7
+not L269
+jmp *r1
+dec r1
+
+L240: jsr L313
+
+L241: bne *r7
+L242: .string "ddkituhmaolsebyoxattxxo"
+lea L295, L245
+dec r6
+clr L255
+L243: bne L308
+rts
+inc r3
+
+not L245
+add r3, L306
+; comment
+stop
+sub #-169, r0
+red r3
+lea L274, r4
+L244: jmp *r6
+L245: bne L322
+red L325
+L246: .data 577, -96, -15
+sub L338, r2
+L247: dec r7
+rts
+L248: .data 87, -816, 181, -249, -257, 234, 285
+stop
+lea L302, *r5
+jsr L332
+L249: inc L256
+L250: .string "ysjqdspjqanmgwnaznqybug"
+lea L275, r3
+not L267
+dec *r5
+mov #62, L316
+prn r7
+lea L337, *r7
+L251: jmp L332
+cmp #72, r3
+red *r2
+mov #-2, *r7
+cmp *r7, *r5
+L252: dec r4
+sub *r7, L333
+sub #-222, *r3
+sub #98, L292
+rts
+stop
+L253: not r3
+dec r7
+sub r6, r7
+clr L287
+red r2
+jmp L322
+L254: .string "yppuy"
+L255: jmp L326
+L256: prn L311
+L257: .string "qbpx"
+sub L267, r7
+lea L341, L280
+prn L265
+L258: jmp L275
+dec *r5
+bne *r6
+L259: jmp *r4
+L260: red r6
+bne *r2
+L261: prn L309
+prn r4
+L262: bne *r3
+inc r2
+jsr *r5
+add #-37, L292
+sub *r7, *r6
+L263: red *r1
+add *r2, r3
+L264: sub L315, *r4
+mov L310, *r2
+L265: bne *r0
+sub r1, L284
+L266: cmp r1, r7
+red *r0
+L267: prn L311
+; comment
+L268: lea L308, L322
+jmp L280
+not *r7
+L269: clr *r4
+L270: cmp L309, #-131
+L271: .data -131, 949, -806, 891, 59
+rts
+jmp L305
+L272: lea L311, L328
+L273: prn #169
+rts
+red L298
+bne L317
+bne *r4
+prn L278
+
+clr *r7
+jsr *r2
+L274: jmp L321
+dec *r3
+L275: inc L324
+add L294, *r1
+red *r5
+rts
+stop
+L276: .data 343, 381, 976, 107, 638, 775
+cmp r5, #-170
+cmp *r3, L308
+clr L312
+L277: .string "eyvjonmjegqginnh"
+L278: jmp *r0
+mov L323, *r5
+add r4, r6
+L279: sub r0, *r1
+clr L285
+L280: rts
+clr L289
+L281: red r5
+L282: mov *r6, r7
+
+lea L289, *r2
+clr L338
+jsr *r1
+stop
+add r3, *r7
+L283: jsr L342
+L284: dec *r1
+jsr L332
+lea L310, r6
+
+L285: jmp L338
+L286: add L305, r6
+L287: .data -416, 610
+rts
+L288: .string "ruymkjb"
+mov L316, *r3
+cmp #-32, r4
+cmp r0, *r0
+jsr *r0
+prn L341
+L289: sub *r5, r2
+red L307
+not L302
+add r7, L329
+mov *r7, *r3
+clr L301
+L290: rts
+cmp L308, #-244
+jsr *r7
+L291: not *r7
+cmp r6, L305
+dec L317
+not L320
+L292: prn r1
+L293: .data 237, 110, -308, -958, 664, -311, -766
+L294: sub *r0, *r3
+L295: red L335
+L296: .string "ts"
+L297: add #48, r4
+jsr L325
+L298: jmp *r1
+lea L341, L319
+clr *r6
+L299: rts
+red L329
+red L342
+prn L337
+jsr L327
+mov *r7, L302
+red L312
+L300: bne *r5
+red L336
+sub *r7, r1
+L301: .data 370, -954, -840
+red *r4
+lea L327, *r5
+rts
+mov r6, L308
+bne L314
+not r4
+clr *r0
+sub L311, *r2
+clr r4
+L302: .data 113, -920, 992, -592, 125
+L303: .data -330, -996, -949, -905, -78, -107, 834, 900
+lea L322, *r7
+L304: cmp r4, L342
+clr *r2
+L305: .data 797, 624, -745, -746, -507, -685, -451
+stop
+; comment
+cmp *r4, *r3
+L306: jmp L315
+sub #-74, L326
+L307: add r0, r1
+not *r2
+L308: .string "gnxmznhk"
+jmp *r7
+L309: .data 488, 841, 529
+L310: sub r2, r6
+clr r4
+sub r3, r1
+cmp L325, L329
+L311: jsr *r3
+jsr L315
+lea L315, *r3
+mov r0, r4
+prn L320
+L312: jsr L338
+L313: prn L316
+red L329
+lea L319, *r3
+red L321
+dec L322
+L314: .data 628, 375, 695, 841, -449, 208
+L315: mov r5, L333
+L316: prn #38
+L317: lea L322, L323
+not L324
+rts
+L318: prn #-171
+L319: sub *r4, L336
+L320: add *r2, r1
+L321: prn r4
+; comment
+rts
+L322: mov *r1, r1
+add L332, *r4
+; comment
+mov L330, r5
+L323: mov r2, *r7
+clr r5
+not L327
+L324: sub #-14, *r3
+inc *r3
+L325: lea L341, *r6
+jmp *r7
+; comment
+L326: .data -399, -617, 192, -985
+jsr L342
+inc L340
+jmp *r6
+sub #-83, L340
+L327: .string "aqxfesn"
+dec *r1
+L328: bne *r3
+L329: clr *r2
+mov L333, L335
+clr L339
+L330: dec r7
+clr r3
+clr L336
+L331: .string "hqrreydhenkwnopoxokzt"
+jmp *r6
+L332: dec L338
+inc L333
+sub #-208, L340
+dec r5
+clr *r2
+L333: rts
+cmp #238, #164
+add *r7, L335
+prn r6
+prn #104
+prn #49
+bne L338
+jsr *r6
+prn *r4
+cmp r5, r0
+add L337, L340
+L334: .string "nngdveztnrltevcaxijqo"
+L335: jmp L342
+inc r1
+L336: not *r1
+L337: .string "uayiqqeuxkpaougdhxvw"
+lea L341, L338
+jmp *r3
+lea L339, L339
+stop
+jsr *r0
+
+clr *r4
+rts
+lea L341, L338
+dec L339
+L338: jmp *r2
+stop
+L339: .string "wajjgooztkjatpfqh"
+cmp r3, L342
+red *r6
+add #-16, r3
+mov r1, L342
+L340: jmp *r0
+L341: prn *r5
+red *r2
+stop
+L342: .string "yyabmcjlpbyvyafnihs"
+not r5
+rts
+clr *r5
+red *r2
+inc r7
+add L256, r4
+dec L36
+cmp *r2, #70
+dec *r5
+stop
+clr r2
+stop
+add *r0, L48
+jmp *r0
+add L243, *r2
+prn #94
+stop
@@ -0,0 +1,1026 @@
+; Generated by genCorpus --seed 46
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+jmp *r1
+L0: .data 677, -935, -148, -410, -150, -130, 836
+cmp #-151, L84
+mov *r7, *r1
+add *r4, r2
+dec L187
+lea L173, r4
+mov r3, r7
+jmp L41
+inc *r0
+bne *r7
+L1: .data -885
+mov *r7, L351
+bne L264
+jmp *r3
+jmp *r4
+L2: dec L115
+dec L38
+rts
+L3: .string "ufuwuxim"
+dec L265
+clr r2
+inc *r2
+L4: clr r3
+L5: prn r4
+L6: .data -818
+dec L21
+L7: not L142
+L8: red r0
+stop
+red *r6
+not L15
+clr L370
+L9: inc r5
+add *r6, *r2
+L10: .data 699, -708, 334, 275, 272, 226, 486, -5
+clr L68
+bne *r6
+L11: .string "ehibubk"
+prn L303
+
+bne L13
+L12: cmp #-50, #-44
+inc r2
+sub L330, *r0
+add #-20, L213
+add r3, *r7
+mov L264, L38
+jsr L147
+
+red *r7
+L13: not L56
+L14: jsr *r7
+jsr *r6
+jmp *r4
+rts
+L15: cmp r1, *r4
+inc *r6
+L16: jmp *r0
+sub #107, r4
+; comment
+cmp r1, *r7
+; comment
+lea L277, *r0
+clr r0
+jmp L105
+inc L223
+clr L272
+clr L213
+prn r4
+add *r2, *r5
+L17: lea L145, L246
+mov *r7, r2
+sub L179, r3
+mov r2, *r7
+L18: rts
+L19: .data 421, 236, 733, -656, -496, 972, 578
+jmp *r4
+cmp *r0, #-205
+red L39
+rts
+not r7
+L20: mov *r0, r2
+L21: rts
+L22: sub r5, L87
+prn *r4
+jmp L174
+lea L38, *r5
+sub L235, r4
+L23: add r5, L70
+L24: red L30
+prn L361
+jmp L260
+bne *r6
+L25: sub r1, r7
+bne L229
+bne L65
+L26: bne *r2
+sub L247, *r7
+inc r7
+jsr L188
+L27: .data -780, 8, -413, 831, -303
+L28: mov L216, *r6
+L29: clr *r2
+bne *r6
+jmp L312
+inc r7
+cmp L269, *r7
+inc r2
+bne L295
+L30: jsr *r1
+inc L249
+prn L233
+L31: .data 231, -833, 745, 700, 231, -393, 871, -515
+rts
+L32: lea L183, *r5
+dec *r4
+not L369
+inc r0
+dec *r2
+L33: rts
+not L153
+L34: .string "trcimcrzwwxcuanpcohtv"
+L35: .data -880, -705
+L36: .string "bsijcqzi"
+L37: clr L116
+L38: red L365
+L39: prn #-213
+prn r3
+rts
+L40: mov L366, L162
+rts
+cmp #120, L230
+L41: .data -223, -618, -674, 65, 32, -161, 242, 591
+L42: add r7, L195
+sub r3, *r0
+L43: add #-144, *r6
+L44: .data -428, -155
+sub L366, r3
+sub r7, *r4
+add L208, *r6
+L45: sub *r7, *r0
+inc r3
+L46: not r3
+L47: add *r6, r5
+add *r3, r6
+L48: .data 596, -991, 902
+add L65, r4
+jsr L139
+jmp L263
+L49: add L102, L126
+bne L286
+inc r2
+sub L87, L130
+add #-166, L190
+; comment
+L50: .data 181, -161, 171, -788
+clr *r0
+L51: sub r1, *r3
+L52: .data -596, -49, 139, -492, 231
+L53: stop
+sub L209, L260
+L54: lea L85, *r1
+inc L259
+jmp *r3
+dec *r7
+L55: dec *r2
+inc *r6
+rts
+add *r2, r0
+L56: stop
+add *r1, r0
+rts
+L57: red L331
+L58: prn #-167
+L59: .string "cotsygfvucmjjt"
+bne *r6
+red r5
+lea L155, *r7
+clr L172
+jsr *r3
+stop
+L60: lea L279, *r3
+
+add L308, L227
+L61: dec r1
+L62: bne *r2
+L63: mov r4, *r7
+L64: bne L249
+lea L359, *r0
+L65: jmp *r5
+; comment
+clr *r4
+dec r2
+
+not L104
+prn #-228
+jmp *r2
+jsr L81
+not L81
+L66: lea L231, r3
+stop
+L67: .string "ilpz"
+L68: .data 151, -757, 452, -911, 577, -148
+add r3, *r1
+L69: not L373
+L70: .string "jfmkepdnikrccsx"
+stop
+L71: stop
+not *r5
+red L179
+prn *r1
+clr L373
+inc L176
+bne *r3
+clr L80
+L72: stop
+not *r0
+not *r6
+L73: jmp L329
+L74: not *r2
+
+stop
+L75: lea L95, r3
+stop
+L76: .data 293, 770, 278, 374, 483, -855
+sub r3, r5
+lea L142, *r6
+jmp *r2
+jmp L145
+red r2
+L77: .data 613, -459, 354, 926, 168, 520, 449, 589
+L78: mov *r2, L143
+add #-94, L118
+L79: jsr L142
+clr L109
+L80: jmp L229
+
+mov r7, *r7
+mov *r0, r1
+L81: cmp #25, #254
+rts
+cmp r5, #-234
+clr r5
+jmp L192
+L82: mov #-53, r6
+L83: .string "niw"
+inc r4
+lea L192, *r6
+L84: .data 505, 406, -828, 924, 715, -812, 192, -960
+; comment
+mov L262, *r1
+; comment
+L85: .data -630, -990, -952
+add *r6, *r2
+bne L159
+lea L223, *r5
+sub L109, L262
+L86: stop
+not *r7
+L87: prn L201
+stop
+L88: not *r4
+L89: sub #42, *r1
+clr *r3
+clr r3
+rts
+lea L361, *r4
+prn r4
+L90: cmp r7, #5
+inc L241
+L91: jmp *r6
+sub *r1, *r2
+L92: .data 354
+add r0, r3
+L93: not L207
+lea L233, L272
+add #36, *r7
+; comment
+stop
+L94: mov *r5, r5
+L95: rts
+L96: jsr *r1
+not r4
+jmp L213
+mov #170, r6
+L97: bne *r2
+; comment
+L98: .string "vfdmgzbvmhtdizjgnvk"
+L99: stop
+sub r7, L147
+cmp L224, L149
+L100: add #-86, L221
+; comment
+lea L268, L367
+L101: lea L364, *r5
+jsr *r4
+L102: stop
+rts
+lea L314, r4
+dec r2
+cmp #105, *r0
+rts
+; comment
+stop
+clr *r2
+stop
+red L219
+L103: rts
+dec r2
+mov #149, *r0
+mov *r7, L242
+L104: clr r7
+add r2, r2
+not r4
+not r1
+jsr L371
+
+; comment
+
+jmp L278
+; comment
+L105: sub #2, L160
+L106: inc r4
+bne *r2
+add L137, L123
+prn L343
+add #202, r3
+stop
+L107: clr *r4
+lea L242, L218
+L108: jsr L135
+red L232
+stop
+L109: inc L199
+L110: clr r7
+L111: .data 158, -345, 685, -792, 156, 296, 93
+dec *r2
+red r6
+L112: jmp *r5
+lea L150, r1
+jsr L176
+not r3
+L113: .string "zazqjjbexpn"
+jmp L156
+clr L338
+add *r7, *r1
+bne L311
+L114: cmp *r2, *r0
+L115: sub #-111, L353
+L116: jmp L369
+sub r4, *r1
+clr L282
+not L238
+rts
+L117: cmp L138, r1
+clr r0
+L118: prn *r5
+L119: jsr L328
+not L217
+L120: inc *r3
+prn #62
+L121: .data -400, -476, -279, 916, -974, -733, 545, 874
+clr *r0
+L122: cmp #-14, L198
+rts
+bne *r0
+L123: bne *r6
+L124: red *r5
+L125: sub r6, *r6
+L126: mov r4, r0
+not r5
+cmp *r1, r2
+L127: dec r2
+L128: .data -502, -969, -809, 241, 68, 366
+L129: stop
+inc *r1
+bne L134
+jsr L303
+L130: stop
+L131: clr *r3
+prn *r7
+L132: red *r7
+red *r2
+stop
+L133: sub L158, *r7
+not *r1
+L134: jsr *r1
+prn *r0
+L135: .data 88, 614, 488, 422, -43, 553
+L136: cmp *r0, L206
+L137: jmp *r2
+jmp L321
+cmp r5, *r2
+prn r6
+L138: inc r0
+jsr *r2
+L139: .data -462, 867, 9, -741, 366, 702, -694
+L140: red *r1
+jsr L158
+bne L340
+L141: .data 697, -920, 826, -855
+L142: mov r6, r2
+stop
+L143: jsr L350
+L144: stop
+jmp *r2
+inc *r5
+L145: add *r5, *r0
+red L228
+stop
+L146: bne L358
+L147: cmp L352, L217
+L148: bne *r5
+L149: .data 20, -801, 899
+lea L167, *r2
+L150: jsr L225
+inc *r0
+jmp L313
+jmp L306
+
+mov #-170, *r1
+L151: not r4
+L152: prn *r4
+jmp *r2
+not r0
+add *r4, L300
+dec *r2
+jmp *r1
+; comment
+L153: jmp L248
+L154: stop
+stop
+clr r7
+jmp L327
+
+cmp *r5, #82
+jmp L227
+jmp L273
+L155: prn *r1
+stop
+; comment
+jmp *r2
+dec r2
+; comment
+L156: red L241
+L157: mov r1, L306
+bne L265
+dec *r6
+prn *r2
+L158: not *r6
+L159: sub #52, *r7
+bne L230
+lea L261, r0
+dec r2
+inc r5
+L160: add r0, L190
+L161: clr r7
+sub *r7, *r2
+stop
+L162: red *r4
+L163: rts
+; comment
+prn *r2
+inc *r6
+not r7
+sub r5, L243
+L164: mov L324, L232
+L165: .string "orrvbjkbrbnb"
+
+sub #48, *r3
+red *r2
+bne *r4
+L166: red r2
+L167: inc r5
+L168: .data -394, -160, -712, -850, -751, 371, -806, -926
+L169: add #165, r2
+L170: .data 141, -854, -366, 725
+; comment
+rts
+L171: cmp L353, *r5
+stop
+add r1, r0
+L172: jsr *r0
+add #-85, L192
+L173: .string "dlapavg"
+L174: .data 328, 59, -572, -13
+not r1
+L175: .string "jxyfaslcemwrygcobqtdamxw"
+jmp L179
+; comment
+dec *r6
+L176: bne *r4
+bne L335
+sub L258, *r6
+cmp L186, #-48
+dec *r7
+red *r4
+L177: lea L180, *r5
+L178: .data -872, 930, 377, -841, -738
+jmp *r3
+inc *r0
+bne *r3
+red L332
+L179: .data -617
+not r5
+L180: mov *r5, L193
+L181: lea L188, r7
+L182: dec L277
+dec L348
+bne L354
+add *r1, *r2
+add r4, r0
+stop
+L183: clr *r4
+jsr L218
+clr L272
+L184: lea L347, r7
+L185: clr r3
+red r1
+L186: stop
+stop
+red r0
+dec L288
+; comment
+mov #-208, *r0
+red r7
+inc r4
+L187: .data -887, 313, -144
+L188: sub r1, r2
+L189: jsr *r5
+L190: .data -105, 905, 925, 385
+lea L328, *r7
+clr *r6
+rts
+L191: rts
+sub *r4, L316
+sub r4, L249
+L192: clr L304
+stop
+L193: sub r5, L221
+not r2
+bne L199
+; comment
+cmp *r3, r4
+L194: .string "cxboiixmstvplmpm"
+L195: .data -428, 259, 453, -139, -232, 705
+rts
+sub #-192, L218
+L196: cmp L312, *r7
+mov #114, *r3
+stop
+L197: .string "jmunmfyvvibrlvqrmaq"
+red L358
+bne L354
+stop
+add L243, r5
+dec L347
+jsr *r0
+not *r5
+prn *r3
+L198: stop
+dec *r1
+L199: lea L247, *r2
+L200: .string "aoamclcdoysbcvgbui"
+add r0, L302
+L201: add r2, r3
+mov r0, L306
+jsr L226
+rts
+L202: inc *r0
+L203: .string "mzfodwafydybw"
+rts
+L204: jsr L346
+L205: jmp *r6
+L206: .string "otzbaxlatubzebpqebwlxo"
+not r2
+bne L233
+sub #-246, r2
+not L342
+jsr L319
+mov r5, *r7
+mov r0, r3
+L207: rts
+jsr L313
+prn #141
+L208: prn r4
+jsr *r5
+L209: add L216, L256
+lea L343, *r1
+stop
+L210: cmp L279, r5
+L211: cmp r0, r5
+prn L265
+L212: .string "g"
+stop
+sub #44, *r5
+inc L276
+sub L294, *r5
+sub #-75, *r6
+rts
+clr L244
+L213: jsr L217
+jmp L352
+L214: rts
+lea L222, L251
+L215: .data -251
+L216: .data -406, -331, -620, -543, 895, -544, -580, 730
+bne L259
+prn #-133
+clr L217
+L217: stop
+L218: prn *r0
+clr r4
+sub *r1, r7
+L219: .string "gaccavwsdlbqtzxa"
+L220: stop
+L221: add L224, r4
+bne *r5
+cmp L331, #-126
+L222: .data 954, 77, 817, -54, 538, -994
+L223: red r0
+
+mov #130, r5
+not *r6
+
+L224: bne *r1
+add r7, L283
+dec r3
+; comment
+bne L273
+jsr L276
+lea L371, r1
+L225: dec L346
+sub *r5, r4
+sub *r1, *r0
+rts
+L226: not L251
+dec r4
+L227: jmp *r1
+L228: mov *r7, *r0
+L229: .data -567, -850, -171, -581, -374, 78
+prn r6
+L230: jsr *r7
+mov *r5, L265
+L231: clr *r4
+L232: add #81, L347
+stop
+jsr *r2
+inc r4
+inc *r3
+L233: red *r5
+jsr *r5
+inc *r7
+stop
+L234: sub *r5, r1
+L235: clr r3
+bne *r5
+lea L370, *r1
+prn *r4
+rts
+cmp *r3, r4
+L236: .string "ayt"
+add *r4, r1
+L237: .string "n"
+dec L362
+dec *r6
+L238: prn #-39
+prn r5
+lea L261, r1
+prn r1
+jmp *r7
+stop
+clr L279
+prn #109
+L239: clr r7
+prn r4
+not L334
+clr L280
+L240: cmp #155, #168
+L241: jsr *r3
+L242: cmp #70, #191
+mov *r5, r0
+L243: mov #-69, *r1
+red r7
+L244: .data -137
+bne *r6
+red L302
+
+L245: dec *r3
+prn r0
+not r7
+L246: .data -76, -147, 411
+L247: dec L289
+L248: lea L351, L257
+mov r1, L284
+L249: .string "nslaqejgfhm"
+L250: cmp *r2, *r6
+stop
+
+
+mov *r4, L357
+L251: .string "hu"
+mov #38, L261
+red *r0
+jsr *r5
+sub *r1, *r3
+inc L322
+L252: dec L321
+not r4
+jsr *r1
+; comment
+add #-8, *r4
+prn r3
+
+rts
+inc L317
+red *r4
+clr *r3
+L253: .string "yvruwvaptzrsdcwxrps"
+not L271
+L254: prn *r4
+L255: .data -576, 815, -755, -75, -402, -27
+L256: not *r2
+inc *r4
+cmp r2, r4
+sub r7, r4
+L257: dec L346
+L258: not r3
+sub r5, *r4
+sub r5, r2
+sub #182, *r1
+not *r5
+L259: lea L339, r4
+L260: .string "hliuqdsdlh"
+cmp r5, r5
+L261: lea L269, L321
+jsr L334
+L262: add #-219, *r5
+jmp *r7
+L263: stop
+stop
+bne *r5
+L264: add *r2, *r7
+jmp *r1
+prn #37
+bne *r2
+L265: not L337
+bne L353
+; comment
+inc L374
+dec L327
+L266: sub #63, r2
+add L281, *r6
+L267: clr *r7
+L268: inc r0
+L269: prn *r4
+stop
+L270: jsr L313
+L271: .string "ucqahycpmje"
+rts
+L272: bne L332
+inc L342
+L273: .string "kpyytsljeqmlpnxaphkzsq"
+stop
+rts
+L274: clr *r5
+prn *r7
+L275: .data -120, 115, 127, -666, -480, 297, -249
+jsr L331
+L276: red L329
+mov #-37, L348
+L277: prn *r2
+L278: .data -986, -294, -760, -307, -761
+L279: not r2
+L280: .string "mkw"
+prn *r6
+L281: bne *r5
+not L334
+L282: mov r0, L342
+L283: jsr *r6
+bne *r2
+L284: lea L336, r4
+red L294
+L285: add *r3, L356
+inc L304
+add #-181, *r1
+clr r3
+inc *r0
+red r4
+sub r1, L328
+L286: not *r6
+jmp *r3
+stop
+L287: not *r3
+L288: clr L367
+dec r1
+L289: red *r1
+jsr L332
+L290: cmp L373, #-221
+prn #7
+rts
+dec L364
+L291: prn r5
+L292: cmp #-247, r1
+L293: cmp r4, r6
+prn *r3
+
+L294: not *r1
+mov #-220, *r6
+red L350
+L295: rts
+L296: red L324
+rts
+inc L363
+L297: .string "fozjfvjupcwdkqncy"
+L298: .string "xsmmhdyetqogkaegjn"
+L299: prn #240
+clr L316
+L300: lea L370, *r4
+jmp *r2
+jmp *r7
+add L346, *r6
+dec r3
+L301: add r3, *r5
+L302: inc L350
+jmp *r4
+L303: .string "tnepsrwysng"
+prn L334
+add L305, *r5
+jsr L345
+sub #94, r5
+add r1, *r5
+jsr L363
+red r2
+mov L346, r1
+L304: .data 881, 798, 388, -654
+L305: not L316
+clr L359
+L306: mov #-210, r7
+L307: .data 917, -299, 356, -520, -74, -410, 27
+L308: .string "yquubbwraadrddkbdainitei"
+bne L353
+dec L336
+clr *r6
+mov L332, r7
+stop
+L309: rts
+red r1
+inc r3
+L310: jmp L330
+L311: dec *r5
+cmp L365, #16
+prn L319
+L312: jsr *r4
+L313: lea L321, *r0
+prn *r5
+bne *r6
+mov #-147, *r3
+L314: mov #126, L329
+red r4
+L315: .string "z"
+clr *r2
+L316: .data 513, -806
+L317: dec *r7
+stop
+add #120, *r7
+stop
+inc L335
+L318: jmp *r4
+L319: prn *r0
+L320: jmp *r3
+L321: lea L347, *r5
+add L332, L328
+dec L329
+
+L322: lea L343, L366
+sub *r4, L328
+not r4
+L323: bne *r7
+add L364, *r3
+L324: red *r4
+L325: .data 225, 633, -862, 232, -77, 82, -140
+L326: lea L347, r2
+dec L353
+bne *r7
+red L351
+L327: .data 158, 681, -51, 608, -157
+jmp L346
+L328: mov L366, L360
+L329: .string "nyfuidptjqmvdv"
+lea L351, *r6
+clr *r5
+red L372
+; comment
+L330: lea L349, r0
+lea L369, L332
+dec r5
+dec *r7
+not *r6
+jsr *r6
+L331: lea L349, r2
+lea L359, L358
+add #233, L337
+L332: add #102, L357
+L333: prn #-92
+L334: dec r1
+L335: jmp *r0
+stop
+add L372, r0
+cmp *r4, L360
+L336: jsr L352
+jsr *r0
+L337: bne L348
+prn #137
+L338: prn #37
+L339: inc *r6
+stop
+L340: jsr L373
+L341: lea L345, L374
+L342: stop
+L343: bne L373
+inc L359
+lea L359, L350
+not L368
+inc L371
+dec *r1
+L344: add r2, L372
+; comment
+jmp *r6
+add r6, *r6
+add *r3, *r3
+add r3, L362
+lea L365, *r4
+L345: prn *r1
+L346: jsr L373
+L347: mov *r0, *r0
+not r4
+not r3
+dec r3
+not *r6
+sub *r5, r5
+jsr *r5
+L348: sub #-34, r1
+L349: mov #-4, *r4
+L350: add *r4, L367
+rts
+mov L351, L367
+clr r0
+L351: jsr L360
+L352: .string "afvrgq"
+jsr L372
+cmp r4, *r7
+add #-151, L372
+L353: .data -679, 105, -200, -520, -530
+L354: dec r4
+rts
+inc L374
+red L357
+L355: .string "fyhduczaog"
+add *r3, *r1
+clr r7
+clr *r4
+dec L363
+jmp L370
+L356: .string "zooejtjwjcryoenvuo"
+jsr *r0
+lea L357, *r5
+L357: mov #-152, r4
+L358: not r1
+L359: .data 217, -695, 524, 300
+jmp L360
+bne *r2
+L360: stop
+L361: cmp L371, L374
+L362: jmp L363
+L363: bne *r3
+L364: .string "sovgstbsju"
+inc r7
+; comment
+L365: .data 798, -396, -22
+L366: .string "abowprgvaskktnssoyshayi"
+jsr *r1
+bne L372
+not r1
+inc *r3
+L367: .string "ssdntitxyjzrjvfyfkwk"
+L368: jmp *r4
+jsr *r3
+clr L374
+L369: cmp L370, #165
+L370: .string "oznstaijyeon"
+jsr L372
+
+mov *r4, L371
+L371: lea L374, r4
+clr *r3
+L372: .data -995, -830, 356
+L373: .data -137, 688, 528, 192
+L374: rts
+stop
@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 47
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+add r3, L51
+sub r2, r1
+L0: dec r7
+L1: lea L127, r7
+mov L9, L226
+L2: bne *r6
+L3: add *r7, r2
+L4: lea L78, r2
+L5: dec L344
+prn #-103
+inc L207
+L6: add L292, L119
+dec L308
+cmp L64, L276
+inc r5
+L7: mov *r4, r3
+L8: stop
+sub #215, r7
+L9: clr r1
+jmp L295
+clr L212
+inc L310
+clr *r3
+L10: .data 907, -414
+L11: lea L251, r7
+bne L170
+add L222, *r6
+L12: mov *r7, r3
+add L93, L132
+sub *r3, L112
+bne L195
+mov #-232, *r6
+L13: .data 36, 555, 206, -759, -589, 379
+not *r7
+L14: inc L304
+L15: .string "hurywauyn"
+inc r7
+L16: .data 223, -285, 495, -167, -369
+dec *r0
+cmp L140, L142
+inc r1
+not r3
+sub #184, *r7
+inc r0
+L17: rts
+L18: red L298
+L19: sub #227, r2
+not L292
+bne *r1
+L20: add r6, r2
+L21: rts
+jmp L297
+mov #-60, L196
+L22: bne L126
+bne *r6
+bne L254
+not r4
+prn *r3
+L23: prn #-20
+
+dec *r7
+not *r3
+L24: dec r0
+jsr *r5
+sub L71, *r6
+red L217
+mov *r3, r1
+jmp *r1
+L25: stop
+jmp *r7
+jmp *r7
+L26: .string "muuklpbhesaxqhyemoprevi"
+red L226
+L27: .string "kfqcmsarcewtkyrtwpmahen"
+rts
+stop
+L28: sub *r4, *r1
+L29: prn L39
+L30: add #185, *r6
+prn r7
+not *r5
+L31: .data 789, 547
+red r6
+mov r5, *r7
+L32: not r6
+L33: cmp L306, #-236
+jmp *r0
+jmp L177
+clr L295
+L34: not L180
+sub #103, r0
+; comment
+L35: .string "jclruxcvimwwxygyz"
+L36: bne *r1
+L37: cmp r3, #15
+clr *r7
+L38: jmp L312
+L39: inc r6
+cmp #132, *r6
+L40: dec L315
+lea L195, L67
+mov r1, L103
+L41: dec r2
+L42: red r1
+L43: .string "eyxlyjmwnyvpbbysek"
+jsr L339
+L44: .string "sglaivhdlyxhzjq"
+bne *r4
+lea L84, r2
+L45: dec L320
+mov #-172, r1
+mov L242, L92
+rts
+L46: .data 926, 31, 853, -150, -710, -198, -869
+cmp #-135, *r7
+cmp #120, L164
+
+mov L281, *r7
+L47: jmp L55
+not *r7
+clr *r6
+L48: lea L203, L151
+add r3, r3
+jsr L181
+stop
+inc r6
+jsr *r1
+bne *r2
+; comment
+dec L168
+red r1
+not r4
+bne L344
+prn L304
+sub #197, r3
+prn #-58
+dec r4
+add L215, *r4
+L49: dec L203
+stop
+lea L245, L322
+clr *r6
+L50: stop
+L51: rts
+not r2
+L52: clr L278
+cmp #106, r1
+clr *r4
+L53: .data 171, 587, -12, -559, 219, -932, -553
+red L237
+not *r7
+L54: red r1
+stop
+mov *r1, L228
+dec r4
+stop
+L55: inc *r5
+jsr L163
+L56: .string "orbyuygohfrvyfty"
+add #-162, L204
+L57: jmp L197
+add r4, *r6
+L58: jsr L157
+L59: .data 331
+L60: cmp r3, *r2
+L61: red r2
+
+L62: rts
+dec L259
+cmp L305, *r1
+L63: .string "rxnhoibgkvzmzb"
+L64: .string "fvbazgjcuqatouvgvpht"
+L65: rts
+not r4
+sub r0, r0
+L66: jsr *r4
+L67: .data 80, 942, -200, -564, 203, 978
+sub *r2, *r4
+dec *r4
+cmp #148, r1
+L68: red r0
+red L322
+sub L342, *r6
+clr *r6
+cmp #85, L173
+dec L296
+L69: bne L78
+prn L278
+inc r4
+L70: .data -619, -89, -867, -63, 8, 276, 708, -782
+red *r2
+stop
+add L286, r0
+lea L149, r6
+rts
+L71: cmp *r4, L297
+mov #-45, L277
+prn #-76
+clr L165
+dec L212
+rts
+add r1, *r3
+jmp L244
+prn r2
+inc *r2
+prn r4
+add r6, *r2
+L72: prn *r6
+jmp *r1
+dec L303
+L73: stop
+rts
+prn #107
+L74: add L213, *r0
+inc *r1
+sub L239, L207
+L75: .data -743
+L76: bne *r7
+L77: sub r0, L228
+cmp r6, *r5
+L78: dec r2
+rts
+stop
+L79: not *r7
+
+add *r4, L132
+L80: .string "hxshksvkncseml"
+bne *r6
+L81: .string "elmfuujdivbz"
+prn *r3
+L82: lea L273, r3
+jmp L120
+
+clr L198
+dec *r0
+red r5
+sub L209, r2
+jmp *r0
+add #77, *r3
+sub #51, *r4
+L83: stop
+L84: stop
+cmp *r5, L95
+jsr *r3
+L85: cmp *r0, #29
+not *r5
+jsr L243
+prn *r2
+L86: mov *r5, r0
+rts
+L87: dec *r2
+add *r3, r3
+red r0
+jsr *r1
+inc L145
+bne L121
+prn *r6
+prn L97
+rts
+sub #52, L202
+lea L333, L218
+prn r1
+L88: mov #-189, r3
+L89: cmp L163, r5
+L90: stop
+L91: mov r5, *r5
+L92: clr r2
+; comment
+cmp #119, #-189
+inc L187
+clr r0
+jsr *r4
+add #18, L99
+mov L241, r1
+mov L211, L232
+rts
+; comment
+L93: red *r1
+L94: cmp #31, r6
+add r0, r5
+L95: dec L194
+add L231, r7
+stop
+add L236, *r0
+not r2
+L96: .data 701, -330, 790, -88, -454
+L97: jsr *r5
+L98: .string "f"
+red *r0
+L99: bne *r0
+prn #-71
+clr *r1
+bne L227
+clr r2
+dec r3
+L100: rts
+L101: inc *r7
+dec *r3
+L102: red *r4
+L103: jsr L151
+jmp L139
+L104: lea L145, r4
+stop
+L105: jmp L150
+cmp #-8, *r0
+L106: cmp L170, *r6
+L107: jsr L112
+inc r7
+stop
+sub r2, L174
+L108: clr L144
+
+jmp L208
+L109: cmp *r1, L184
+L110: dec L243
+; comment
+mov L199, *r7
+L111: sub L147, r5
+rts
+jsr L218
+cmp *r2, r1
+clr r1
+clr *r5
+bne *r5
+L112: lea L141, r4
+mov #-60, r7
+L113: lea L225, L205
+L114: bne *r6
+L115: .string "ewsg"
+L116: prn *r0
+
+inc L234
+sub #37, r3
+L117: prn #-130
+jsr L163
+jsr L197
+L118: bne L322
+dec L161
+add r6, *r0
+prn *r1
+mov L268, L313
+
+L119: jsr *r4
+mov #47, *r3
+L120: jmp L226
+L121: add r4, L246
+L122: .string "rlxq"
+add #-28, L185
+L123: inc *r0
+lea L260, *r7
+prn *r1
+inc r0
+L124: .data -324, 63, -550, 610, 826
+L125: add #178, r7
+inc r3
+L126: mov *r4, L151
+inc *r7
+cmp #-49, *r3
+L127: .string "zxdhbz"
+cmp L149, #-183
+sub #64, r3
+red *r1
+L128: .data -881, -797, -174, -616
+; comment
+inc L134
+sub r3, L319
+L129: .string "tndujjauszxjec"
+L130: dec *r6
+clr *r6
+jmp L339
+L131: .data 912, 357, -154, 634
+rts
+bne L159
+prn *r7
+dec r5
+clr r4
+prn *r2
+not L256
+cmp L132, r6
+jsr L307
+prn *r6
+L132: lea L223, L274
+jsr *r5
+cmp #-89, #-69
+L133: stop
+prn *r6
+; comment
+jsr *r5
+cmp r1, L233
+lea L316, r1
+stop
+sub L250, r3
+L134: .data -919, 532, -539, 640, -228, 660, 357
+inc L342
+L135: dec r6
+L136: not r5
+
+L137: rts
+red *r1
+inc *r6
+L138: stop
+jsr L202
+add r0, L341
+cmp r5, *r0
+; comment
+L139: bne *r5
+L140: stop
+L141: cmp #110, r5
+stop
+add #-178, r7
+add #71, *r1
+dec *r6
+rts
+L142: jsr *r3
+jsr L286
+add *r1, L287
+L143: inc *r6
+lea L304, L288
+clr *r5
+not *r2
+jmp L301
+L144: red *r7
+L145: .string "hdnrjjnuezsfnunvuf"
+L146: dec r6
+L147: .data 860, -125, -772, -85, 887, 182
+add L307, L310
+L148: .string "dxjcbbzoshxpgbqt"
+mov #-50, L186
+lea L153, L153
+L149: .string "bdawdhkairxxcdkgrdi"
+dec L315
+L150: jmp L291
+sub r3, L166
+L151: dec r6
+not *r1
+add r7, r6
+red r3
+red L341
+dec *r2
+L152: red L202
+; comment
+add #-8, *r4
+L153: clr L155
+jsr *r7
+prn *r6
+prn r0
+L154: .string "yvwufixoijfbua"
+lea L308, *r4
+dec L336
+L155: stop
+L156: sub #46, *r5
+not *r6
+lea L222, L297
+L157: inc L195
+L158: .data 797, -713, 979, 544, 340, -772, -397
+lea L261, r1
+lea L232, L238
+L159: clr r6
+jsr *r7
+L160: lea L255, *r1
+add L293, *r4
+L161: inc *r5
+
+red *r2
+inc *r6
+L162: clr r1
+dec *r4
+L163: .data -662, 661, 920, -692, -688
+L164: .data 680, -465, -827
+red r2
+bne *r5
+inc r0
+add #-86, r6
+rts
+jsr *r0
+rts
+cmp #28, r5
+clr L174
+inc L315
+not L233
+clr L231
+L165: inc *r1
+prn r2
+add L197, L332
+cmp r5, #-235
+rts
+rts
+mov *r7, L222
+inc *r1
+stop
+stop
+L166: mov *r1, *r2
+clr *r6
+bne *r3
+L167: add L295, *r5
+rts
+dec L305
+jsr L284
+mov L253, L239
+sub *r1, L217
+jmp L252
+stop
+L168: .string "uhufkdblguhghyl"
+lea L170, r5
+inc L260
+L169: jsr *r3
+not *r2
+L170: .string "llidooxz"
+L171: stop
+L172: clr *r1
+stop
+cmp L336, r2
+cmp L213, L253
+L173: cmp #-76, L340
+L174: jsr *r5
+cmp #171, *r3
+mov *r3, r2
+L175: mov #133, L336
+L176: jmp *r6
+not r2
+dec r1
+lea L285, r6
+red L222
+bne *r4
+sub L218, *r5
+lea L344, *r6
+lea L328, *r6
+
+L177: not r3
+rts
+lea L217, r7
+L178: .data 678, 537
+not *r1
+jsr *r4
+not L317
+not r0
+stop
+L179: stop
+bne L296
+L180: rts
+cmp r3, #207
+
+; comment
+L181: .data 593, 491, 811, -334
+add *r4, *r4
+cmp L273, *r0
+not *r5
+stop
+L182: lea L268, r1
+not *r6
+L183: rts
+bne L195
+cmp #-33, r7
+L184: mov L295, r0
+not r1
+L185: stop
+red r3
+cmp *r1, r2
+clr L280
+sub *r7, *r2
+L186: lea L204, L342
+L187: .data 318, 474
+mov #117, r3
+L188: red *r2
+L189: add #-195, L194
+L190: dec L197
+not *r6
+not r7
+L191: bne *r1
+jmp *r6
+L192: bne L342
+add r0, L258
+not *r3
+L193: bne L321
+sub #-86, r3
+; comment
+dec *r7
+L194: inc L204
+L195: bne L331
+bne *r1
+stop
+L196: .data -420, -148, 816
+dec *r2
+mov *r6, L284
+L197: .string "ubf"
+stop
+L198: .data 686, 951, 578, 252, -206, 245
+bne *r5
+; comment
+sub r6, r3
+rts
+red *r6
+stop
+clr *r0
+; comment
+sub #-146, *r1
+sub #234, *r3
+prn #85
+sub *r7, r7
+; comment
+jmp *r3
+L199: .string "kixsbwmmhqfwlvyiqbwhqp"
+red r7
+L200: .data 897, -987
+red r5
+stop
+mov L258, *r5
+L201: rts
+clr *r7
+L202: mov #-147, r5
+mov *r3, L311
+L203: jsr *r6
+not r0
+jsr L322
+prn r7
+bne *r7
+jmp *r2
+sub *r6, L308
+bne L300
+L204: lea L228, *r2
+L205: bne L221
+jsr L255
+L206: .data -899, -748, -117
+not L301
+red *r3
+prn r4
+L207: .string "cjjfccytglk"
+bne L320
+bne L289
+clr L244
+L208: inc *r0
+L209: .data 850, -605, -876, -782, -68, -475, -673
+inc r4
+dec r7
+prn #33
+prn L242
+mov L342, r5
+not *r4
+; comment
+jmp *r6
+L210: dec L274
+bne L255
+add L318, *r2
+prn *r1
+mov #-93, L260
+L211: .string "tpwdgzgdkjemt"
+red L281
+L212: clr r6
+lea L299, r1
+L213: bne L336
+add r6, r4
+; comment
+rts
+sub *r3, *r4
+jsr *r4
+jmp L282
+L214: sub #54, r1
+L215: sub r0, L279
+rts
+jmp L294
+add r2, r1
+L216: .string "tawpeecgqbidwowc"
+L217: rts
+L218: bne L273
+sub *r6, r4
+L219: .data 232, -671
+L220: sub *r4, L221
+stop
+prn *r0
+L221: .string "hsxasarbf"
+L222: rts
+L223: lea L344, *r2
+cmp L322, *r6
+L224: .data -751, 580, -906, 168, 261, -242, 120
+dec r1
+L225: .string "mo"
+L226: stop
+rts
+; comment
+mov *r6, r0
+L227: bne L241
+mov *r6, r6
+L228: not *r6
+prn L297
+not L259
+stop
+sub *r1, *r5
+L229: mov *r5, r5
+L230: red r6
+L231: dec r3
+L232: stop
+add L311, r4
+jsr *r4
+jmp *r6
+mov #-109, *r0
+add *r2, *r5
+jsr L271
+bne *r4
+; comment
+L233: jsr *r0
+L234: .data 893, -90, -624
+dec L283
+L235: rts
+dec L330
+L236: stop
+red *r5
+L237: lea L285, L334
+L238: cmp r5, L249
+
+L239: stop
+add #-101, r1
+bne *r4
+L240: .data -39, 482, 125, -213, -246, -426
+L241: dec L254
+add *r7, L320
+inc r4
+jmp *r7
+cmp *r1, *r6
+; comment
+stop
+rts
+L242: jmp *r0
+dec *r3
+jsr *r1
+bne *r7
+jmp L327
+dec *r0
+not *r3
+L243: jsr *r0
+prn #215
+L244: .string "kdsxtclnbskbwjqnaf"
+dec r7
+red L331
+mov L329, r7
+L245: stop
+L246: .data 571
+prn r1
+add r1, L282
+L247: .string "t"
+L248: dec r6
+
+jmp L284
+bne L297
+L249: jmp L324
+sub #136, *r3
+red r6
+L250: clr r3
+L251: prn L320
+L252: mov r6, *r2
+L253: mov #-117, *r7
+L254: stop
+cmp r1, #-221
+rts
+L255: inc r7
+not *r0
+L256: stop
+jsr *r2
+jmp *r2
+add *r2, L333
+add r4, L299
+mov *r3, r5
+red r1
+L257: .string "mivwivbzfjr"
+dec r4
+L258: not r1
+cmp L264, *r6
+jmp L320
+dec L296
+L259: jsr *r1
+L260: clr *r4
+L261: jsr L308
+prn L292
+L262: .data 708, 400, 765, 38, -693
+cmp *r4, L325
+jmp *r6
+dec L317
+rts
+L263: stop
+L264: inc r1
+rts
+stop
+add L330, r4
+rts
+rts
+inc *r6
+not *r5
+sub L269, L304
+L265: stop
+L266: rts
+red L290
+; comment
+dec r5
+L267: sub #88, L333
+L268: jsr *r0
+L269: jmp L344
+add #172, L315
+L270: cmp *r3, *r2
+L271: not *r0
+cmp #-69, #66
+L272: sub r0, L314
+bne *r0
+jmp *r0
+not *r3
+bne L322
+L273: dec L342
+jsr L344
+jmp *r1
+L274: .data 977, -545, -24, 120, 79, 713
+stop
+L275: .data 571, 360, 154, -518
+cmp r3, r7
+stop
+stop
+L276: .string "ufoxjotbv"
+inc L292
+mov *r0, L279
+bne *r7
+L277: .data 67, -425, -282, 56, -744, -801, -239, 292
+jmp *r1
+rts
+cmp r5, r7
+L278: jsr *r5
+L279: .string "iqttjao"
+rts
+
+L280: .data -478, -172, 797, -334, -768, 856, -871
+L281: .data 99, -445, -125, 72, -93
+lea L334, *r6
+clr *r2
+prn *r6
+not *r7
+L282: .data -478, 613, -371
+mov L289, r0
+L283: jsr *r6
+
+
+mov r4, r7
+rts
+not L300
+add L313, r4
+jsr L337
+L284: inc r2
+mov L333, L327
+rts
+L285: .data -12, -629, -470, -167, -218, 64, -704
+stop
+jmp L302
+jmp L293
+inc r1
+L286: mov *r1, r6
+L287: inc *r2
+sub #57, *r7
+L288: rts
+add *r5, *r1
+jsr *r1
+lea L333, *r4
+L289: .data -72, 104, 544, 498
+sub L295, r7
+inc *r2
+L290: red L300
+L291: add L327, L341
+
+lea L310, r1
+L292: rts
+not *r2
+L293: cmp L329, r7
+dec L306
+L294: inc *r1
+jmp L319
+inc r0
+L295: .string "scxqdizcqzgyupd"
+jmp *r3
+stop
+bne L338
+stop
+add *r2, *r3
+lea L313, r4
+L296: rts
+L297: lea L325, r3
+red *r1
+not L326
+L298: red r7
+L299: .data 839, -301, -279, -145, -179, -901
+L300: cmp L337, L317
+prn #-113
+bne *r2
+L301: sub L310, r4
+bne L335
+add L329, L304
+red *r2
+inc r4
+rts
+add L310, L318
+add *r1, L322
+L302: jsr L313
+mov *r5, r6
+L303: .string "wvvpljqvwcvlxkzusgu"
+L304: .string "bfjwcawvu"
+add *r6, r3
+L305: .string "dfwowugtcoxqofsqiu"
+dec L333
+L306: .data -957, -510, 194, -829, 759
+L307: inc r1
+red L338
+clr *r1
+L308: .data -432, 33
+add #89, L316
+lea L334, L312
+L309: jmp *r2
+L310: .data -94, 931, -474, -726, -673, -133
+add r0, *r1
+sub L311, L331
+L311: red *r7
+L312: clr r7
+stop
+L313: .string "wjjpddid"
+jsr L319
+; comment
+L314: bne L332
+mov *r0, r0
+cmp *r0, r3
+L315: .string "vkkloozgorsuqhqbvjcqium"
+rts
+L316: .string "hunorlxma"
+jmp *r5
+cmp *r3, r2
+prn #65
+dec *r6
+L317: dec *r7
+L318: not *r6
+L319: inc L324
+not *r2
+mov *r4, r7
+prn #-11
+stop
+stop
+not L343
+red L339
+mov r7, r6
+
+jsr *r3
+L320: jmp *r3
+L321: inc r2
+L322: red L343
+add L330, L337
+mov r5, L340
+L323: cmp *r2, #170
+L324: rts
+clr *r3
+L325: stop
+jmp *r5
+L326: lea L332, r7
+L327: cmp #-202, r3
+prn r6
+L328: prn L335
+jmp L343
+L329: .string "zxshvqofcygmtkmdaecpe"
+rts
+L330: .data -170, 212, -393, -882, -335, -737
+L331: not r3
+lea L342, L340
+L332: mov L342, L343
+L333: sub *r3, L336
+L334: not L335
+mov L342, r5
+inc L336
+jmp *r6
+L335: mov #82, r1
+jmp *r5
+clr r3
+red r3
+add #-174, *r0
+sub r4, r2
+not L339
+; comment
+; comment
+mov #157, L343
+jmp *r5
+add *r2, *r4
+L336: red L338
+dec *r2
+stop
+cmp #-64, r4
+stop
+not L342
+jmp *r1
+L337: inc L339
+not *r3
+
+L338: mov #-220, r7
+L339: mov #-191, *r0
+L340: .data -196, -881, -102, -662, 998, -138, 152, 403
+dec L342
+L341: red r5
+L342: clr L344
+clr r1
+prn #-54
+not L344
+L343: .string "y"
+L344: jmp L136
+stop
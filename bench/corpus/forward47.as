@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 48
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+L0: clr r0
+red *r2
+jsr *r5
+clr *r7
+bne L148
+not *r1
+inc L203
+L1: mov #-46, *r4
+L2: jmp L122
+dec *r3
+L3: jsr L37
+cmp #-32, *r2
+L4: .data -878, 177, 535, -753
+stop
+L5: lea L277, r7
+add L275, L266
+cmp #101, *r3
+mov *r7, r2
+
+L6: .data 658, 659, 74, -86, 91, -450
+inc r5
+
+clr L231
+not r3
+jsr L205
+L7: jsr L141
+L8: bne L13
+jsr L15
+jmp *r2
+sub #-63, L30
+dec r7
+; comment
+prn L87
+bne L306
+dec *r1
+inc r3
+prn r4
+L9: stop
+lea L163, L174
+lea L17, L62
+inc r3
+L10: .string "p"
+inc r1
+clr r6
+L11: cmp L13, *r5
+L12: stop
+lea L341, L310
+L13: .string "mnnacjlfq"
+L14: bne *r7
+L15: not r6
+L16: rts
+L17: add r5, *r2
+rts
+stop
+L18: sub #-68, *r3
+L19: .data 349, 471, -30, 436, 970, -360
+L20: not *r6
+red r4
+L21: mov *r2, r5
+; comment
+L22: clr L61
+stop
+inc *r4
+prn r0
+L23: jsr L66
+L24: inc *r0
+L25: prn *r6
+L26: .data -938
+rts
+add #79, r1
+jmp *r4
+jsr L227
+mov L51, r4
+; comment
+L27: .string "kihkcannwumfbcvzxba"
+clr L197
+jmp L118
+L28: clr r3
+clr *r7
+sub r0, r2
+L29: .data -990, -959, 250, -437
+L30: prn *r4
+L31: inc r0
+jsr *r2
+prn L276
+rts
+L32: .string "tbnvuasptfqbdufbupk"
+cmp #-38, r2
+jmp L115
+inc L106
+bne *r0
+dec *r6
+inc *r5
+L33: jsr *r3
+L34: cmp #-105, r2
+rts
+L35: stop
+lea L273, L117
+L36: jsr L274
+jsr *r0
+prn #167
+L37: rts
+sub *r1, L215
+prn #232
+L38: bne L248
+not r6
+clr r0
+cmp *r2, r5
+L39: jmp L49
+red r7
+clr *r1
+cmp L87, r3
+L40: red r4
+dec r4
+cmp *r4, #185
+lea L75, L199
+; comment
+not *r4
+L41: add *r2, L224
+stop
+jmp *r5
+not *r2
+L42: jmp L184
+L43: rts
+red *r5
+L44: .data -816
+jmp L195
+L45: .data -714, -105
+L46: not L226
+L47: inc r1
+stop
+; comment
+; comment
+cmp r4, #-161
+clr r0
+cmp #172, #-76
+jmp L322
+cmp #224, L125
+L48: cmp #232, *r5
+not r1
+dec L107
+not *r0
+mov L54, r0
+dec L283
+L49: mov r3, *r4
+bne *r1
+L50: add #-69, *r0
+bne *r6
+dec L150
+clr L222
+jsr L261
+L51: .data 631, -73, 525
+add *r2, r5
+jmp L239
+L52: mov *r7, r2
+stop
+add L129, *r3
+L53: prn r2
+; comment
+L54: .string "lnupkifksymiabefwznwmzf"
+stop
+not *r0
+bne *r1
+red *r4
+L55: jsr L349
+L56: add #88, L174
+L57: .string "ajujypecygoxshkmlax"
+L58: not L279
+L59: sub *r4, r6
+L60: bne L352
+red r1
+L61: .string "rakijmjsdzhkzlhin"
+L62: lea L249, r5
+inc *r3
+cmp #57, #68
+bne L242
+mov r2, r2
+inc r0
+lea L89, L295
+L63: .string "tzxtbeh"
+L64: jmp L184
+L65: .data -592, -610
+L66: jsr *r3
+L67: cmp #233, L153
+L68: inc L232
+prn r0
+
+; comment
+L69: .string "wtfrqzp"
+L70: jmp L272
+red *r0
+rts
+cmp r2, *r3
+prn L245
+mov #-225, *r1
+sub #-11, *r7
+L71: red *r2
+L72: lea L229, L81
+rts
+L73: not L310
+L74: sub #21, r7
+L75: sub *r0, r0
+prn #-11
+L76: rts
+sub L201, *r2
+mov r2, L159
+inc L309
+dec r2
+rts
+; comment
+L77: red *r4
+lea L178, L79
+L78: jmp L244
+mov r3, *r1
+sub L332, r4
+L79: clr *r3
+rts
+L80: bne *r7
+L81: .data -880
+; comment
+clr r3
+L82: .string "v"
+cmp r4, *r4
+not r1
+dec *r4
+inc L289
+L83: dec *r7
+inc r5
+cmp r2, L283
+L84: .string "nkizxynmkmsun"
+mov r0, *r2
+L85: .string "mbrrjzmucbydamncgxs"
+dec L212
+cmp *r1, L325
+rts
+L86: dec L200
+rts
+not r1
+L87: jsr L276
+bne *r6
+L88: inc L323
+dec *r5
+prn *r1
+red r1
+sub *r4, *r6
+lea L127, *r1
+L89: jmp *r3
+add L141, r1
+cmp *r3, #211
+L90: mov #95, r4
+jsr *r5
+red *r1
+; comment
+stop
+L91: .data 375, 947, 486, 149, 590, 324, 93, 796
+cmp *r5, L332
+L92: inc r1
+not L295
+prn *r1
+not L295
+jmp L237
+L93: jsr *r2
+add #-199, r3
+cmp L301, L259
+lea L284, *r3
+cmp #-38, #93
+L94: add #-231, r5
+jmp L169
+prn *r3
+jsr *r1
+rts
+prn r6
+cmp L331, *r6
+lea L282, *r2
+L95: mov r3, *r2
+jmp *r3
+lea L129, r7
+not r3
+L96: .string "aqzrwkhwfmcjlqn"
+L97: cmp L252, L111
+L98: not *r6
+jmp *r2
+L99: clr r3
+L100: dec r7
+prn L289
+stop
+inc *r1
+mov r5, L252
+lea L170, r6
+dec L338
+inc L214
+red L141
+L101: stop
+L102: lea L118, L330
+jmp *r2
+L103: dec L163
+bne L245
+rts
+red r2
+prn r4
+L104: clr *r5
+mov r5, r4
+L105: jmp L150
+jsr L245
+L106: .string "sc"
+prn L197
+bne L232
+rts
+jsr L294
+cmp #84, #-17
+L107: lea L108, L172
+rts
+L108: add r1, *r6
+L109: rts
+red r6
+L110: lea L310, *r7
+mov *r5, r4
+lea L263, r3
+lea L126, *r6
+bne L222
+not r4
+L111: bne L331
+jsr L167
+prn #-108
+cmp #-255, L118
+L112: lea L311, *r2
+bne *r1
+dec *r2
+add L189, L295
+mov L322, L348
+bne L203
+add #-104, L210
+L113: sub #-75, r5
+L114: prn L217
+L115: bne *r5
+red r6
+rts
+L116: clr r0
+cmp *r5, #233
+prn #239
+lea L140, *r6
+cmp #-15, L119
+L117: bne L273
+; comment
+not L316
+lea L302, *r1
+L118: bne *r7
+L119: .data -330, 345, -252, 106, 245, -941, 636, 806
+L120: rts
+jsr *r6
+L121: bne *r4
+bne L163
+bne L213
+L122: rts
+not r3
+clr L180
+L123: .string "hkombplddpznkq"
+L124: dec *r2
+L125: sub L326, L202
+L126: jsr L197
+lea L168, r2
+L127: not L252
+inc *r3
+
+inc L342
+inc L298
+red *r4
+L128: not *r1
+L129: jmp L340
+L130: .string "tlojqohoqkssqqs"
+not L250
+L131: inc r1
+L132: not r3
+sub L330, r5
+lea L314, L284
+red *r2
+sub #-181, r5
+inc r0
+sub L332, L265
+lea L261, L168
+L133: dec r1
+jsr *r1
+L134: .string "ypehrgkkwwzkjbbblznzfjwu"
+lea L161, L158
+add L217, *r0
+; comment
+stop
+clr r0
+inc L177
+jmp L307
+bne L177
+mov L165, r5
+red r2
+cmp *r3, #-83
+L135: not *r0
+L136: .data 831, 903, 173
+
+not L202
+L137: cmp #-200, *r2
+lea L246, *r2
+L138: jsr L275
+prn *r7
+rts
+inc *r2
+prn r1
+rts
+jsr *r5
+L139: .data 62, 407, 387
+bne L340
+not r5
+L140: clr *r4
+jsr *r2
+L141: jmp L315
+jmp L319
+jmp L243
+L142: rts
+cmp r1, L165
+L143: .string "okfnvkynvojlljacquszmqqp"
+L144: bne *r2
+red *r2
+stop
+dec *r5
+L145: .data 654, -598
+prn L318
+L146: .string "ncifnknhubarboknlyxirljs"
+L147: red *r6
+lea L276, L211
+sub #21, L193
+mov L180, L151
+rts
+inc L278
+stop
+red L217
+L148: prn L207
+mov #-48, *r3
+L149: lea L201, L203
+mov *r0, *r5
+
+
+cmp *r3, #165
+L150: prn *r3
+red L336
+dec L353
+L151: lea L349, L253
+sub *r1, r0
+clr *r5
+L152: .string "s"
+mov *r6, r1
+cmp L341, #31
+lea L205, r6
+not L226
+L153: stop
+L154: .string "zqu"
+prn r2
+sub L300, *r7
+
+L155: stop
+L156: .data -833, 368, -289, -776, -735, -355, -272, -885
+L157: stop
+inc *r6
+dec r7
+cmp r2, r6
+L158: jmp *r3
+sub *r4, L340
+cmp #-55, r0
+L159: red r2
+prn #133
+L160: bne L239
+L161: clr *r0
+L162: .string "zcbpnewuewngqfgszha"
+L163: dec r7
+; comment
+dec L279
+L164: cmp L168, L307
+cmp r1, *r5
+red r0
+L165: .data 739, -726, -762, 648, -524, -406, -331
+
+red *r5
+mov *r7, L297
+jmp L298
+red *r0
+L166: stop
+jsr L188
+not r6
+L167: sub r3, *r0
+mov #220, L251
+clr r5
+lea L201, r6
+stop
+bne L336
+L168: not r5
+L169: rts
+L170: jmp *r2
+sub L175, L259
+L171: red *r4
+lea L267, *r4
+prn *r2
+L172: clr *r5
+L173: not L335
+mov *r7, r5
+L174: sub *r4, *r6
+bne *r6
+clr *r6
+dec L221
+L175: rts
+L176: clr L252
+L177: inc r1
+mov L260, r4
+sub L218, L211
+L178: .string "vfvszmbykithmoymqk"
+inc *r5
+L179: inc *r6
+mov #80, *r0
+L180: lea L194, *r7
+prn L296
+lea L267, L348
+L181: prn r4
+L182: .data 931, -387, 974, 389, 249, 82
+L183: inc r3
+mov r3, *r0
+L184: mov r7, r7
+L185: .data -198, -708, 519, -808, 946
+L186: sub #-165, *r6
+L187: .string "up"
+L188: prn L299
+inc r0
+L189: .string "ipofsptjaohztlpxdztoo"
+L190: stop
+add r2, *r5
+lea L333, r0
+cmp r6, L307
+rts
+bne *r1
+rts
+L191: .data -744, -357, -332, -76, -186, 57
+stop
+jsr *r4
+dec L277
+L192: bne *r6
+bne *r1
+L193: clr L231
+prn L199
+L194: .data -351
+stop
+prn r7
+jsr L247
+red L270
+L195: .string "pkathsmmrl"
+L196: jsr *r1
+prn r4
+dec L333
+mov *r6, *r7
+L197: not L200
+L198: .data 397, 831, 567
+not L227
+L199: bne L287
+clr r4
+inc r3
+inc L329
+prn r7
+dec r3
+add *r1, L210
+L200: bne *r7
+red r0
+L201: stop
+rts
+bne *r7
+cmp *r6, r1
+not r5
+prn #205
+L202: .string "prjhxtv"
+jmp *r0
+L203: cmp r2, *r3
+
+L204: bne *r4
+inc r7
+jmp L294
+L205: .data -459, 753, -222, 307
+jsr *r3
+add *r7, r5
+L206: sub L273, r2
+L207: cmp *r6, *r7
+L208: mov r0, L325
+L209: lea L217, r7
+lea L212, *r0
+jmp L350
+mov *r6, L246
+not L250
+bne *r2
+L210: red r3
+not *r5
+not r3
+add L295, r4
+L211: add #55, L219
+clr r1
+L212: .string "nnicwjwkf"
+
+L213: sub #28, L276
+L214: rts
+clr L343
+L215: stop
+bne *r0
+jmp *r7
+dec r4
+red *r6
+cmp r0, *r0
+L216: mov *r7, r2
+L217: .string "dumuuokfvhgxugicujjn"
+L218: bne L296
+add *r0, *r3
+clr r3
+L219: stop
+cmp #169, *r6
+L220: .string "cfnngecxkeynjsj"
+inc *r5
+L221: .string "uivxvonugieqymsvc"
+
+stop
+inc *r1
+
+L222: .data 91, 707
+jmp *r7
+L223: stop
+L224: jsr L283
+mov r2, L252
+cmp *r3, #-59
+stop
+L225: .data -422, 866, 653
+prn *r7
+cmp r2, L333
+; comment
+L226: rts
+L227: rts
+L228: lea L234, r5
+L229: lea L343, r5
+prn *r1
+L230: clr L299
+L231: sub #46, *r0
+mov #-88, r3
+L232: inc r6
+rts
+jmp L300
+L233: add #-121, *r2
+lea L289, *r7
+L234: stop
+cmp *r7, #107
+cmp #-82, #231
+dec L264
+mov L306, r2
+rts
+stop
+not L308
+L235: .data -158, -81
+red L291
+lea L344, r4
+lea L305, L295
+bne L255
+; comment
+L236: not r6
+L237: inc r4
+L238: lea L286, *r3
+L239: .data 815, 173, -602
+jsr *r2
+red L270
+L240: rts
+dec *r4
+L241: lea L275, L254
+dec *r2
+stop
+red *r0
+cmp #-195, L285
+prn *r0
+L242: not r1
+bne *r2
+not r5
+L243: .data 436, -780, -118, 337, -828, 242, 169
+L244: .string "bwipcemogcdtzlomxkga"
+prn L281
+L245: mov L268, L323
+L246: .string "yvfokgd"
+L247: rts
+clr *r3
+red *r1
+clr *r6
+bne *r7
+L248: jmp *r7
+mov *r5, r0
+inc L293
+L249: .data -55, 387, 737, 38, -986, 965, 310
+
+inc L316
+sub r5, r5
+dec r3
+stop
+L250: not *r0
+jmp L331
+bne L320
+inc r4
+jmp L348
+L251: clr L303
+add L351, r6
+L252: add L331, r0
+L253: .data 700, -623, 366
+rts
+not *r3
+prn *r2
+red L267
+stop
+not r7
+dec r2
+clr L313
+jsr L314
+
+red *r1
+L254: stop
+L255: .data 651, 775, 958, 917
+clr L300
+L256: jsr *r0
+L257: .data -284, -811, 918, 774, -974, 337, -626, 58
+clr r6
+jsr L320
+jmp L290
+stop
+sub r4, L267
+stop
+L258: cmp #186, r7
+L259: .data -995, -421, -790, 297, -239, 697, 266, -197
+bne L352
+red r3
+add L262, L329
+rts
+; comment
+L260: clr *r7
+L261: bne L315
+jmp *r7
+L262: jmp L321
+red *r6
+L263: .data 301, -443, -575, 212, -746, 171
+L264: .data -864, 539, -624, -661, -836
+mov #-93, r6
+stop
+L265: sub L271, r4
+jmp L305
+jmp L331
+sub #-120, r6
+L266: .data 429, 120
+prn #151
+L267: .string "iiiwlfasvmtyoiyrobasxjvz"
+not L337
+not L319
+L268: not L274
+stop
+not r3
+add L303, r5
+not r4
+rts
+add *r2, L310
+mov r1, r6
+inc r6
+L269: .string "tysymzhyldffg"
+inc *r0
+dec r3
+dec *r3
+L270: bne L283
+cmp #-27, L336
+bne L279
+inc *r5
+clr r7
+L271: inc L283
+lea L285, *r5
+add L328, L279
+prn L304
+jsr *r5
+not *r4
+L272: add #143, r7
+rts
+L273: jmp L316
+jsr L302
+L274: not r4
+mov *r4, L328
+L275: inc L280
+L276: .data 139, 466, 149, -621, 871, -278, -482
+L277: .string "rhefnzjazpf"
+cmp r0, *r7
+
+dec r6
+
+; comment
+L278: mov r1, L338
+dec *r4
+mov r0, L314
+clr r0
+clr r1
+L279: lea L335, r4
+red L287
+L280: bne *r3
+L281: .data -601, -713, -433, 651, 632, -816
+L282: dec *r0
+add *r1, r4
+L283: prn L328
+sub L336, r4
+mov r7, *r7
+L284: add #116, r6
+bne L337
+L285: dec L323
+inc *r1
+red r2
+sub #-111, *r2
+L286: .string "b"
+dec *r7
+L287: prn L341
+not *r5
+not r4
+add *r1, r0
+L288: .string "wrvxwzkzdk"
+red *r4
+L289: .data 445, -21
+L290: add *r2, *r3
+; comment
+bne L295
+stop
+L291: inc r3
+prn L338
+clr L333
+L292: red *r5
+bne *r2
+L293: jmp L311
+L294: red L314
+L295: clr r3
+clr L340
+mov L328, L337
+mov #-194, *r7
+
+; comment
+lea L341, *r3
+L296: .data -311, 186, 543, -79
+L297: lea L317, *r7
+L298: sub #-204, r6
+cmp #-89, *r5
+L299: jmp L346
+bne *r7
+lea L325, *r6
+L300: jmp *r2
+jsr L345
+L301: .data 727, -108, -152
+red L328
+jsr *r6
+L302: bne L313
+clr r5
+red *r7
+L303: inc r3
+L304: .data -504, 996, -745, 503, 210, 722, -389, -152
+L305: dec r5
+rts
+clr *r3
+cmp L312, L323
+L306: jsr L332
+L307: .data -975, 161, -91, 643, 825, -983, 598, 560
+rts
+not L309
+L308: .string "ucupcriipgl"
+jsr *r1
+lea L344, r4
+sub #-248, r0
+clr r2
+sub r5, *r6
+L309: rts
+; comment
+L310: .data -700, 450, 499
+inc L343
+prn L326
+sub #-195, r6
+L311: lea L348, *r3
+L312: bne *r1
+jsr L331
+mov *r0, *r0
+L313: cmp r5, L316
+red *r4
+jsr *r7
+L314: prn *r7
+sub r0, L330
+bne L335
+sub *r1, r6
+L315: sub r2, L322
+L316: mov L348, r3
+red L331
+clr *r5
+L317: .string "opatamdnazt"
+mov r2, *r7
+L318: mov *r3, L330
+stop
+lea L336, r3
+not L328
+red *r4
+dec *r3
+
+stop
+stop
+L319: .string "ulnajlmamrijc"
+L320: not L347
+lea L334, *r3
+dec L343
+prn r1
+stop
+dec *r3
+L321: .data 430, -74, -430, -471, -52, -360, -352
+L322: jsr L328
+stop
+stop
+jmp *r4
+L323: red *r4
+L324: bne *r2
+L325: .data -776, -582, -894, -926
+red L343
+L326: .data 97, -891, 450, 228, -507, 502, 775, -897
+mov L348, *r3
+clr L349
+jsr L350
+cmp r7, r2
+L327: add L333, L341
+L328: rts
+L329: clr *r6
+L330: .data 818, -823, 665, 861, -899
+L331: .data 667, 437, -377
+lea L334, *r5
+lea L333, *r0
+L332: jsr *r5
+inc L349
+L333: dec L334
+mov *r0, r2
+not *r0
+add *r5, *r5
+L334: clr *r2
+clr r4
+; comment
+L335: jsr L342
+red *r6
+rts
+add r3, L338
+rts
+prn r3
+L336: .string "zvvz"
+L337: inc *r4
+stop
+jsr L351
+L338: not *r7
+not *r6
+clr L340
+stop
+cmp r3, L347
+L339: inc r2
+add #-208, *r2
+cmp #-237, L353
+not r4
+lea L340, *r1
+L340: jsr *r4
+L341: .data 829, 696, -108, 497, 385, 889, -487, -814
+stop
+red *r5
+lea L345, L352
+L342: clr *r7
+add *r1, r3
+lea L345, r7
+; comment
+prn *r3
+L343: add r6, L348
+clr L346
+dec *r6
+red L352
+L344: not r0
+L345: bne L353
+L346: cmp L350, *r5
+lea L351, *r0
+L347: mov *r5, L350
+prn #-180
+stop
+dec *r7
+bne *r2
+not *r4
+L348: stop
+add r7, *r5
+L349: .data 210
+L350: rts
+jmp *r6
+L351: rts
+stop
+add #62, *r7
+inc *r2
+lea L352, L353
+cmp *r5, *r3
+jsr L352
+lea L353, *r5
+prn r4
+add r3, L352
+lea L353, r6
+bne *r1
+L352: .string "oolcfjhbbxmmycj"
+L353: prn *r3
+rts
+stop
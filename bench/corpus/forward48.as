@@ -0,0 +1,1026 @@
+; Generated by genCorpus --seed 49
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+L0: red L292
+bne L307
+dec L165
+L1: add r2, *r3
+clr r3
+sub r1, L69
+L2: jsr L6
+L3: prn *r7
+rts
+L4: clr *r7
+L5: inc r1
+bne *r4
+red *r6
+rts
+not *r1
+L6: not r6
+cmp L235, r6
+; comment
+; comment
+add *r2, L354
+L7: not r3
+L8: jsr *r3
+L9: .data 914, -60, -365, -467, 237, 793
+prn #169
+L10: not L267
+L11: rts
+clr L237
+bne L232
+prn *r5
+
+; comment
+L12: not r1
+jsr *r7
+bne *r6
+L13: stop
+lea L254, L273
+L14: add r2, L321
+lea L290, *r4
+L15: sub *r7, L106
+L16: rts
+L17: dec L171
+inc *r7
+not *r5
+cmp *r5, r4
+L18: not L142
+lea L205, *r7
+not r7
+L19: inc L168
+inc r4
+L20: prn r5
+L21: bne *r7
+L22: add #-241, L334
+rts
+L23: jsr *r0
+rts
+sub *r4, L230
+L24: sub L37, *r4
+bne L279
+inc L170
+mov L258, L150
+inc r4
+L25: lea L215, r2
+L26: .string "e"
+; comment
+rts
+stop
+L27: jmp L263
+L28: bne L322
+L29: not L157
+inc L308
+L30: red r1
+bne *r5
+L31: .string "wysihjuhhehbfvhixlhio"
+bne *r7
+stop
+jsr L293
+clr r7
+L32: .data -186, -388, 920, 977, -690, -524, -355, 386
+bne L166
+not *r6
+jsr *r2
+L33: clr L238
+stop
+bne *r0
+clr L237
+L34: .string "ncbxhjofjmt"
+prn r7
+L35: clr L180
+L36: add r3, L181
+
+L37: sub #-132, *r0
+not r5
+stop
+; comment
+dec r6
+prn L84
+sub *r6, r1
+L38: sub L326, L210
+; comment
+jsr L233
+L39: dec L172
+L40: inc r3
+jmp L330
+jsr *r2
+not L60
+red r7
+L41: .data 874, 646, 435, 689, -330
+inc r7
+cmp #116, r5
+rts
+L42: mov #119, *r1
+inc L274
+prn r3
+
+inc *r2
+inc L98
+jmp L167
+rts
+L43: not *r3
+L44: inc L318
+lea L139, r4
+L45: add r5, r1
+
+L46: inc *r6
+cmp *r1, r0
+prn r2
+cmp *r1, r1
+add r0, L167
+L47: cmp *r0, L307
+sub L165, *r1
+L48: red L257
+red *r7
+L49: prn r0
+dec r1
+bne L239
+lea L169, L189
+jsr L159
+mov *r5, r2
+L50: sub #-174, r7
+L51: red *r3
+clr *r1
+prn r1
+L52: jsr L127
+jsr *r3
+L53: lea L169, r2
+L54: add #27, r1
+L55: mov *r6, r1
+L56: prn r4
+add #-127, L317
+clr *r4
+L57: lea L268, *r1
+not L170
+L58: jmp *r6
+cmp *r6, *r3
+cmp L348, *r5
+jsr *r2
+L59: rts
+L60: .data 874, 746, 804, -114, -295, 675, 322
+L61: .string "mraccgxseeixkoikijinrpnu"
+dec r5
+L62: .data 737, 517
+lea L157, *r5
+L63: .data -970, -245, 824
+bne L70
+L64: .string "hdaixyrqggeqzcg"
+dec L198
+sub #156, *r1
+jsr *r4
+clr *r7
+L65: inc *r0
+not r3
+L66: cmp L83, r0
+L67: not r5
+inc r6
+L68: .data 480, 716
+L69: .string "vapapfeyoizk"
+L70: lea L293, *r7
+jmp *r5
+L71: sub L205, *r0
+L72: .data 275, 534, -670
+inc *r2
+L73: dec r5
+L74: sub #-204, L258
+red *r6
+jsr L256
+L75: stop
+L76: mov *r6, r1
+bne *r3
+cmp r1, r2
+jsr *r0
+clr L196
+; comment
+not L153
+rts
+sub r2, L303
+rts
+; comment
+rts
+L77: jsr L100
+not *r1
+
+stop
+L78: .data -890, 480
+L79: sub #-176, *r7
+jmp L275
+jsr *r4
+
+sub #233, L293
+L80: lea L206, L230
+jmp *r3
+rts
+stop
+stop
+jmp *r4
+L81: .data 781, -746, -407, 295, 549, -27, 419
+add *r7, L240
+L82: bne L98
+L83: .string "ftnyco"
+clr *r1
+L84: .data -901, 912, 667, -852
+L85: sub #165, L336
+L86: cmp L225, *r4
+sub L348, *r2
+red r3
+L87: .data 766
+jmp L340
+L88: .string "ofjyjnrwqryime"
+not *r1
+L89: .string "qoictayfhag"
+clr L95
+L90: lea L156, r5
+
+L91: mov r7, *r5
+inc r7
+mov #120, *r2
+L92: bne *r7
+L93: red L110
+L94: jmp L214
+stop
+L95: .string "bqcgf"
+L96: .string "htexrpbwwwgquwctijrvhez"
+lea L150, r3
+dec L314
+not r1
+L97: .data 680, 87, -180
+prn *r6
+add r1, r6
+prn *r5
+lea L343, L122
+red *r3
+prn *r1
+
+lea L211, L196
+L98: clr r7
+L99: sub #248, *r4
+stop
+; comment
+L100: dec L194
+clr L133
+L101: mov *r4, r1
+lea L110, r5
+L102: .data 700, 992, -924
+lea L287, L354
+L103: prn r7
+L104: .data 726, -811, 942, -634, 728
+sub #-145, r4
+L105: bne *r4
+stop
+bne L187
+L106: not *r7
+L107: bne L212
+L108: red *r7
+inc *r2
+jsr *r2
+rts
+L109: inc L306
+add r7, r5
+L110: mov r2, *r0
+mov *r0, *r1
+cmp #-40, L215
+L111: not r2
+L112: clr *r1
+bne L219
+jmp *r1
+L113: rts
+jmp L212
+rts
+jsr L169
+inc r3
+clr r5
+L114: prn L256
+L115: jsr L253
+lea L306, *r3
+clr *r0
+dec r4
+clr L220
+bne *r3
+lea L157, r6
+add *r3, *r1
+L116: dec r6
+clr r6
+L117: cmp r7, *r5
+L118: clr L344
+L119: stop
+inc r7
+L120: .data -866, 70, 31, -303, -743
+clr *r2
+cmp r3, #154
+L121: prn r4
+cmp #73, r5
+L122: .data 533, -13
+L123: inc *r0
+
+inc L171
+L124: .data -451, 646, 819, -189, 347, 593, 517, -886
+clr r4
+L125: bne L196
+inc *r0
+bne *r6
+not L335
+jsr *r6
+L126: jsr *r2
+clr L333
+lea L142, L208
+jsr *r4
+lea L364, r7
+lea L353, r3
+dec r0
+jsr *r1
+L127: mov L291, *r7
+L128: inc *r3
+L129: .data -390, 28, 72, -382, 112, 651, -95, 247
+bne L271
+L130: .data -456, -417, 447
+jsr *r5
+L131: dec *r3
+stop
+jmp *r7
+L132: dec L274
+bne L295
+cmp r3, *r2
+stop
+L133: add L193, r3
+L134: prn *r4
+L135: .data 903, -942, 722, -84, 330, 408
+L136: rts
+L137: .data 782, 981
+lea L234, L218
+L138: .data 945, -840, -780, 752, -841
+prn *r6
+L139: stop
+jsr L259
+cmp #5, #113
+rts
+mov #116, *r7
+L140: red r0
+sub L239, *r4
+jsr *r0
+L141: not L251
+sub #-12, L154
+L142: sub #109, r7
+mov #50, *r4
+bne L234
+clr L360
+L143: prn L309
+L144: .string "ohrvslftpazad"
+L145: cmp *r6, r5
+sub r4, r1
+lea L161, r6
+not r7
+L146: .data 762, -45, -700, 16, 139, -143
+L147: lea L289, r3
+L148: .data 680, -546, -973, 357, -868
+jsr L314
+inc *r3
+L149: not L327
+L150: .string "pzpgw"
+sub L192, r0
+jmp *r4
+L151: cmp L214, #247
+prn #-21
+L152: jmp L330
+mov r2, *r2
+L153: prn *r0
+not L224
+jmp L233
+bne *r0
+L154: inc *r4
+stop
+L155: add *r2, L280
+
+prn #-229
+L156: .data 154, -183
+clr *r7
+L157: .data 512, -79, 670, 435
+jmp *r4
+; comment
+L158: .data -380, 318, 90, -902, 942, -570, -658, -303
+L159: inc *r1
+L160: red r7
+L161: mov r1, L232
+L162: not r7
+red L305
+L163: prn r6
+L164: cmp *r6, #196
+jmp L250
+
+L165: lea L339, *r2
+cmp r4, r0
+L166: jsr L279
+L167: bne L353
+L168: .string "jeptx"
+add L329, L268
+lea L218, L243
+rts
+rts
+lea L369, r4
+red r7
+L169: .data 17, 818, -774, 722, 102, 698
+bne *r6
+sub r5, *r2
+cmp r2, r3
+prn L306
+bne L357
+L170: .string "yqf"
+L171: stop
+L172: clr *r6
+L173: cmp L192, L212
+; comment
+bne *r6
+L174: jmp L222
+L175: sub r3, r6
+cmp *r1, #131
+lea L341, r6
+clr r0
+L176: add L210, *r0
+L177: stop
+jmp L295
+L178: .string "mupaepevcenzl"
+L179: dec *r4
+L180: mov #-74, *r2
+L181: bne L182
+red r7
+L182: not r2
+; comment
+L183: .data 277, -614, -624, -526, -764, -12, 705, -70
+L184: dec r2
+stop
+L185: not L248
+cmp L314, L219
+bne L235
+cmp #-135, L305
+L186: lea L332, r7
+clr *r0
+jmp *r7
+L187: cmp r5, L246
+dec *r4
+bne *r1
+mov #224, *r0
+cmp r0, #238
+not *r2
+cmp #153, #-155
+clr L242
+dec *r0
+L188: red *r2
+sub L252, L336
+rts
+stop
+lea L286, r5
+clr r1
+jmp *r1
+L189: .data -662, 475
+lea L337, L282
+L190: dec L246
+L191: prn r6
+L192: .data -212, -555, -928
+add r3, *r6
+clr r3
+lea L293, L326
+clr L207
+bne *r4
+prn *r6
+L193: .data -625, -10, 557, 553, 96, -270, 716
+L194: dec *r5
+L195: .string "phqu"
+
+
+jmp L222
+mov r7, *r7
+; comment
+; comment
+L196: .string "pxqhkbravqhxvy"
+clr *r1
+add r2, *r1
+dec r1
+cmp #-46, r7
+mov #-245, *r7
+not L205
+L197: .string "rszugzkgjtfypibjjszvf"
+L198: not r3
+sub *r2, L302
+bne *r5
+prn *r2
+L199: .string "raqqqyhfqfbddbzuqzktkje"
+stop
+mov r5, L269
+L200: bne L307
+L201: jsr *r4
+L202: mov L219, *r2
+stop
+dec *r1
+L203: jsr *r7
+jmp L327
+stop
+L204: stop
+jsr *r6
+add L280, *r7
+mov r5, L277
+clr L259
+jmp *r3
+L205: inc r2
+stop
+stop
+L206: red *r2
+L207: lea L366, L212
+L208: .data 860, -236, 659, 734
+jmp *r1
+L209: jsr *r1
+L210: lea L232, L349
+
+L211: bne L337
+L212: not *r4
+add #-252, *r3
+dec *r7
+cmp #-229, *r6
+inc L233
+L213: rts
+jmp *r4
+dec *r2
+L214: bne *r0
+L215: cmp r7, L282
+red *r5
+L216: .string "o"
+add L281, L259
+lea L336, r5
+L217: inc *r0
+cmp #-133, *r2
+rts
+jmp L231
+lea L359, L273
+stop
+L218: .string "thmikmqoprjis"
+L219: .data -107, 159, 133, -92, -139
+lea L363, r4
+dec L253
+dec r7
+L220: inc *r4
+L221: rts
+cmp r7, #-213
+cmp r0, L254
+prn *r2
+cmp L354, L335
+mov *r6, L229
+L222: .string "dzoasekrpcctp"
+not *r1
+; comment
+bne L300
+prn L338
+cmp *r4, r7
+inc r3
+L223: lea L300, *r2
+stop
+sub #-90, r2
+cmp r3, r2
+
+mov r5, *r7
+L224: jsr L354
+L225: .string "fcys"
+
+
+add *r7, L319
+clr r4
+inc *r1
+lea L244, *r0
+L226: inc r5
+bne L286
+
+not r7
+dec *r4
+L227: add L256, *r1
+
+stop
+L228: .data 177, -166, -589, 428
+; comment
+jsr L286
+L229: .string "qdli"
+rts
+mov L354, r0
+lea L367, *r7
+L230: .string "lvtpinwjtnbkxuupstetttq"
+red r3
+red L270
+stop
+jsr *r5
+red L258
+prn r6
+jmp *r4
+mov #211, *r4
+sub L358, r5
+L231: bne L366
+dec L359
+rts
+jsr *r5
+L232: .data -728, -490, 450, 410, -617, 860, -898
+add r0, r5
+jsr *r3
+cmp #135, #107
+L233: mov L237, r1
+L234: dec *r6
+L235: .string "xrnyvdqwohv"
+L236: .data 993, 679, 370, 471, -797, 688
+stop
+jsr *r7
+cmp #-156, #112
+clr r4
+inc r1
+lea L267, L350
+L237: .string "ffvizckzelfxphxi"
+red L303
+sub *r0, *r1
+L238: .data -864
+mov L240, r2
+L239: inc *r2
+sub #163, *r2
+rts
+rts
+lea L369, r0
+mov #129, r1
+L240: bne *r0
+jsr L353
+L241: add #-208, L258
+lea L275, r1
+dec *r4
+cmp L315, L254
+jmp *r0
+sub r3, r0
+jmp *r3
+clr r1
+sub L299, r4
+dec r1
+red *r3
+dec r5
+add #29, *r1
+L242: bne L287
+clr r2
+L243: .data 752, 682, 973, -737, 847, 119, 908
+not r2
+sub L263, *r4
+
+L244: red *r7
+L245: .data -8, 59, 294, -930, 954
+L246: stop
+L247: mov L334, r4
+prn r4
+L248: .data 468
+stop
+L249: .data 99, -492, 141, 299, 917, -713, -73, 292
+L250: jmp L256
+rts
+not *r2
+inc L254
+cmp L362, r6
+prn #100
+sub r4, L365
+L251: .string "xvnijiffrdgqdbviox"
+L252: prn #-23
+bne *r5
+L253: sub *r4, L289
+clr L347
+L254: rts
+L255: .string "vyfupztzoqqnbohd"
+jsr *r6
+sub #24, r7
+cmp L366, r7
+mov *r2, L349
+jmp L293
+prn L324
+L256: .string "gcvmanwpnglg"
+jsr L335
+L257: inc L292
+add *r1, L267
+L258: bne L291
+stop
+L259: bne L261
+jmp *r0
+L260: .data -306, -895, 595, -663
+not *r1
+add #-167, L338
+L261: jsr L281
+L262: rts
+dec *r1
+L263: rts
+stop
+bne *r4
+clr L266
+L264: not r4
+L265: cmp *r6, r7
+L266: clr L313
+bne *r6
+add r4, *r0
+clr r6
+jmp *r3
+add L348, L349
+; comment
+mov #-191, *r6
+mov r3, *r5
+lea L333, r1
+sub r2, r1
+cmp *r0, L328
+stop
+L267: rts
+rts
+clr L321
+dec r7
+L268: stop
+jsr L301
+bne *r1
+L269: lea L306, L316
+jsr L292
+jsr *r0
+cmp L276, #-229
+L270: .string "xhdu"
+add r6, L316
+L271: cmp L311, #-7
+jmp L277
+cmp #194, #122
+rts
+L272: .string "qackbfzsmyklwkwudlyev"
+clr r3
+
+
+L273: clr *r0
+add #-238, L285
+dec *r4
+lea L323, r3
+stop
+jmp *r2
+L274: red *r3
+prn *r7
+L275: .string "irrjvsplavwsocow"
+add *r0, r6
+sub L331, *r3
+L276: stop
+sub r0, r2
+L277: cmp r1, L283
+add #116, L289
+
+rts
+L278: add r0, L338
+red *r3
+rts
+L279: sub *r7, L328
+inc L344
+lea L304, L327
+inc L312
+L280: .data 119, -900, 751, 712, 31
+L281: stop
+L282: .string "sbswvhzgt"
+lea L287, *r5
+L283: stop
+lea L294, r4
+clr *r5
+L284: rts
+L285: dec *r6
+L286: add r2, L358
+L287: bne L299
+L288: not r7
+jsr *r5
+; comment
+L289: prn #-78
+L290: jsr *r5
+jmp *r0
+clr *r7
+
+L291: red *r1
+jsr L329
+not r3
+inc L347
+not L314
+bne L306
+L292: .data 830
+L293: cmp #49, r4
+red *r1
+red *r6
+clr r6
+L294: bne L359
+add L328, L318
+L295: mov *r3, L334
+sub *r4, r6
+prn L331
+cmp #248, #205
+dec L335
+mov #138, r0
+cmp r7, L351
+jsr *r7
+rts
+L296: .data 225, -647, -662
+bne L307
+L297: dec L316
+L298: dec L331
+L299: mov L361, r7
+L300: mov L327, *r0
+sub #50, *r1
+clr *r6
+L301: cmp r2, L327
+L302: clr L330
+L303: stop
+jsr L307
+L304: dec r6
+inc r3
+L305: .string "fxgq"
+L306: lea L354, L347
+add L368, r2
+add L338, r3
+L307: dec r5
+L308: .data 564, -398, 882, 804, 188, -340
+; comment
+cmp *r6, L327
+L309: rts
+L310: .string "ip"
+L311: .data -857, -11, -51, -436, -941, 659
+not r1
+L312: .string "wfmuqzbsnydiayfmbeqjiaz"
+; comment
+stop
+lea L320, L366
+cmp r0, *r6
+; comment
+red *r7
+clr L329
+lea L315, *r3
+prn L321
+L313: not r4
+L314: .data 657, -426, -563, 547, 397, 407, 718
+L315: .data -679, -454, -275, 831, -486
+L316: rts
+L317: red L347
+jmp L330
+L318: .data -243
+add L347, r0
+mov #-81, r3
+L319: .data -653, 197, 405, -647, -644, 547, -722
+cmp #221, r4
+prn L358
+not r5
+L320: add r7, *r5
+rts
+L321: jsr L325
+L322: inc L350
+L323: red r6
+not L343
+L324: jsr *r2
+dec *r4
+L325: clr *r3
+mov #183, L348
+add #247, *r3
+sub L364, *r5
+L326: bne L338
+mov *r5, *r6
+L327: .data 469, -524, -741, -712, 860, -382
+L328: clr L367
+red *r7
+; comment
+L329: .string "antcnuiijtpznlhaarwrhs"
+bne *r1
+dec r3
+clr L341
+cmp *r7, #-126
+L330: jmp L335
+mov *r3, L349
+stop
+prn r1
+jmp L336
+prn L354
+L331: inc *r4
+L332: clr L339
+L333: .string "unhrnqmmf"
+cmp L341, r0
+rts
+inc r5
+rts
+rts
+inc *r1
+cmp r0, *r6
+add r6, r4
+L334: .string "rglsmtxhfikjrsrdkoxfd"
+rts
+sub #80, L344
+L335: rts
+L336: mov L346, *r4
+lea L345, *r7
+L337: .data 993, -796, 635, -743, -692, -850, -830, 591
+mov L366, *r1
+L338: inc L344
+L339: .string "c"
+stop
+bne L355
+L340: rts
+add *r1, L348
+; comment
+not *r5
+not r7
+L341: dec *r0
+L342: rts
+stop
+clr r4
+L343: .data -547, 585, -279, -12, -230
+L344: add r3, *r5
+L345: lea L352, *r5
+L346: red *r4
+prn r0
+mov r0, L354
+L347: .string "myjtfvhxegnpd"
+mov #85, L368
+
+; comment
+add *r0, r2
+not *r5
+L348: .string "yti"
+L349: inc *r1
+jsr *r2
+clr L358
+not r5
+L350: .data -709, -870, -19, -568
+rts
+lea L364, *r4
+bne *r4
+
+jmp *r6
+mov L358, *r1
+L351: prn #-67
+red *r4
+cmp *r6, *r5
+L352: .data 72, -94, 663
+add #213, L353
+L353: .data 518
+inc *r4
+jsr *r1
+
+L354: cmp #250, *r2
+mov *r5, L369
+L355: mov *r3, *r2
+sub L363, r1
+L356: prn r0
+jmp *r7
+L357: bne L362
+L358: clr r2
+clr L366
+L359: .data 697, -615, -184, 971, 779, -171, -80, 879
+dec L361
+cmp *r2, *r1
+bne L369
+red *r0
+L360: sub *r7, L364
+dec L363
+red *r0
+add #244, *r2
+prn r2
+mov L369, r5
+clr *r6
+L361: stop
+L362: red r5
+
+inc r2
+sub L365, L364
+L363: .string "tydrualnnjbocmeitbgaiyy"
+cmp r6, #-183
+lea L364, *r3
+L364: sub L365, L366
+L365: mov L370, *r2
+stop
+clr L369
+mov *r2, r4
+L366: add L370, *r3
+stop
+add r0, L367
+L367: not r4
+dec r0
+dec r2
+lea L368, *r7
+jmp L369
+stop
+rts
+L368: jmp L369
+L369: not *r7
+add L370, *r3
+rts
+L370: mov r0, r6
+cmp *r4, L316
+bne L222
+stop
@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 50
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+jmp L218
+mov *r7, *r3
+L0: .data -364, -355, -719
+jsr L136
+L1: .string "qgbelyffoigtvtprpeppc"
+L2: rts
+L3: add #132, L16
+L4: stop
+not *r1
+stop
+L5: sub *r2, *r0
+bne *r3
+red *r3
+L6: cmp *r7, *r5
+cmp r1, L236
+L7: lea L44, r0
+add L194, *r7
+L8: prn r6
+bne L201
+inc r1
+L9: bne *r4
+bne *r5
+sub #149, L145
+L10: .string "vqs"
+bne L54
+L11: lea L281, L355
+
+add *r5, *r3
+add *r4, L231
+L12: dec *r3
+L13: cmp r5, L338
+L14: not L139
+inc L294
+clr *r7
+L15: .string "lww"
+L16: .string "ssepbntvevsmmzbqu"
+lea L251, r1
+L17: not *r2
+prn r1
+sub L22, L79
+stop
+add #-11, *r4
+prn #-204
+red L96
+L18: red r1
+L19: not r0
+L20: .string "ckzyyphqjkupyqlzuvnf"
+dec *r4
+not r5
+L21: .string "nwqxchnfadpcezzgo"
+L22: red *r5
+L23: .string "yduyhcqnnlbyyzzjaopjfoox"
+L24: rts
+L25: rts
+stop
+not r4
+bne *r2
+cmp *r6, *r5
+
+stop
+L26: bne *r7
+L27: red *r2
+sub #-101, L66
+jsr *r0
+L28: sub L280, L227
+mov r0, *r3
+jsr *r7
+L29: mov r0, L292
+bne L236
+inc r4
+L30: .data -177
+L31: sub L164, *r5
+bne *r1
+clr r0
+jsr L52
+bne L63
+L32: .data 935, 744, -935, 825, -601, 821
+prn #-79
+L33: lea L279, *r0
+L34: jmp *r7
+red *r2
+rts
+lea L228, L285
+L35: clr L288
+cmp L68, *r0
+rts
+L36: red L181
+add *r6, L175
+L37: not r2
+L38: .data -242, 373, 392, -802, 578
+L39: dec r5
+add r5, L59
+jsr L245
+prn L139
+red *r5
+L40: .data 45, -810, -793, 886, -245, 890, 887
+L41: cmp L219, L178
+sub #-141, r3
+rts
+L42: sub L202, L55
+rts
+clr r3
+mov #126, L325
+jmp *r5
+sub *r0, L56
+clr L157
+L43: rts
+L44: lea L260, *r0
+clr r4
+jmp *r3
+; comment
+mov #-194, *r3
+L45: jmp L296
+rts
+L46: .data -822, -128, 940, 293, 668
+clr *r7
+red *r7
+jmp *r6
+L47: jmp *r1
+bne *r2
+mov *r2, *r0
+L48: clr r1
+L49: lea L93, *r5
+L50: rts
+cmp #-14, r3
+lea L143, L126
+prn L345
+L51: .string "rkeygrn"
+
+L52: .string "rmk"
+L53: clr r5
+prn L299
+dec r6
+L54: prn #5
+L55: stop
+dec r6
+L56: .string "apbsbshqacvpmon"
+rts
+cmp L283, r5
+add L266, L353
+lea L175, L322
+rts
+dec *r1
+L57: .data 269, 985, -108
+red *r2
+jmp L88
+add r7, L166
+L58: jmp *r7
+mov L186, L291
+red r2
+L59: .string "pifjiuy"
+L60: dec *r5
+prn r4
+L61: .data 794, 815, 509, 340, -521
+L62: .data 684, -352, -738, -355, 384, 609, -294, 332
+L63: sub r6, r6
+L64: jsr *r6
+rts
+L65: .data -263, 452, -926
+rts
+not r0
+not *r1
+jsr *r6
+clr *r2
+stop
+L66: clr r3
+red r5
+L67: cmp *r2, *r6
+L68: stop
+rts
+prn r4
+clr *r7
+inc L161
+red r1
+cmp #239, #-2
+lea L277, *r3
+L69: .data 845, -66, -937, -71, 867
+jsr L88
+; comment
+jmp L154
+L70: dec r7
+bne L116
+L71: inc L192
+L72: .string "rnxy"
+add *r2, r5
+
+add #-117, *r2
+lea L102, r7
+sub L349, r0
+; comment
+
+L73: .string "pxqsq"
+add *r0, L305
+L74: prn #230
+L75: .string "iokeurhslgg"
+L76: dec L203
+L77: sub #-36, L196
+prn #-78
+inc r6
+bne L204
+
+not *r6
+stop
+L78: jmp *r4
+L79: jsr *r3
+add #-9, *r4
+clr *r5
+jsr L265
+L80: .data -859
+L81: inc L325
+sub *r1, L301
+L82: jsr L316
+L83: rts
+L84: bne L222
+prn *r3
+clr L231
+L85: mov r3, *r4
+L86: jmp *r7
+prn *r5
+L87: sub r0, *r7
+L88: .string "koe"
+L89: cmp *r5, #-79
+bne L245
+bne *r2
+clr r5
+L90: prn L331
+L91: .data -607, -323, -707, 773, 903, -357, 917
+lea L190, r4
+stop
+L92: red L160
+add #-102, *r4
+prn L356
+L93: stop
+lea L106, L132
+lea L214, r0
+L94: .data 619
+bne L199
+red *r0
+L95: .string "qhsfsguzsb"
+L96: stop
+L97: .string "mqejmnpmxnwii"
+dec *r4
+sub #6, *r6
+L98: add L156, r7
+L99: jmp L331
+L100: .data 760, 924, 18, 976, 145, 76
+L101: .data 934, -418, -500, 823, -246, -132
+; comment
+; comment
+lea L218, *r7
+add #92, r3
+L102: prn *r6
+jmp L204
+rts
+L103: .string "tyce"
+not *r6
+not r0
+red *r5
+L104: add *r0, r6
+jmp L174
+
+cmp L292, *r6
+not L285
+L105: sub #177, *r6
+L106: .string "uqopugzfnkmxmvkjyaog"
+L107: prn #183
+mov r4, L145
+bne L134
+clr *r5
+red r3
+L108: stop
+red *r2
+not *r5
+inc L259
+cmp L344, r5
+L109: dec r6
+dec r6
+L110: .string "xnzztzcikavsmiyruh"
+prn L344
+sub *r1, *r5
+L111: lea L173, *r5
+prn r7
+jmp L164
+L112: prn *r1
+jsr *r0
+L113: clr *r0
+red r6
+; comment
+bne *r0
+rts
+L114: mov L293, *r2
+; comment
+L115: sub L220, L120
+L116: rts
+
+rts
+mov r5, r5
+clr r5
+jsr *r4
+rts
+L117: sub #185, r1
+red *r1
+jsr L343
+not r7
+L118: prn *r2
+L119: clr r7
+L120: jmp *r2
+L121: .data 400, -994, 894, -154, -718, -508
+L122: rts
+cmp #-54, L314
+add *r0, *r1
+L123: .string "tgzp"
+L124: rts
+sub L182, L314
+dec *r4
+L125: not r5
+dec L296
+inc L142
+sub #146, r6
+bne L139
+dec r0
+L126: jsr L307
+jmp L259
+L127: stop
+; comment
+dec L143
+jsr L193
+L128: add #1, L332
+L129: jmp L163
+L130: .string "ijdbox"
+inc r4
+jsr L324
+rts
+L131: sub L169, r2
+jsr L208
+add #-104, *r4
+dec r6
+L132: clr L244
+L133: bne L338
+prn r2
+L134: add *r1, r5
+L135: lea L164, L316
+jsr *r6
+L136: add *r5, r1
+mov *r7, r3
+L137: lea L308, L267
+add r0, r4
+rts
+L138: prn L339
+lea L157, r4
+; comment
+rts
+L139: inc L278
+add #-5, r1
+L140: rts
+L141: bne *r0
+L142: mov *r2, L194
+rts
+bne L222
+cmp *r5, *r2
+L143: .data -716, 29, -794, -949, -410, 0, 961
+clr *r5
+L144: rts
+; comment
+prn #178
+jsr L203
+prn L335
+clr L282
+not *r0
+bne *r0
+L145: jsr *r4
+L146: .data 703, -598
+inc r4
+dec L149
+inc L313
+cmp r5, r0
+mov r5, *r2
+mov L315, r5
+jmp L235
+L147: bne L270
+L148: add L271, r4
+L149: lea L350, *r0
+add L243, L215
+L150: mov *r4, *r4
+prn *r0
+
+clr r0
+; comment
+L151: stop
+dec r6
+
+jmp L213
+dec r1
+clr r3
+; comment
+red r6
+L152: mov r2, L339
+inc L345
+jsr *r7
+mov *r5, L305
+L153: dec r6
+dec *r3
+L154: cmp #171, L341
+add *r3, r2
+L155: lea L346, *r2
+L156: rts
+
+inc r3
+stop
+stop
+dec r5
+L157: .data 166, 359, 425, -47, 180
+stop
+inc r5
+; comment
+jmp L185
+not r3
+bne L237
+L158: cmp r6, L333
+
+sub *r4, *r7
+L159: add #-29, *r0
+cmp #204, #211
+L160: add *r0, r3
+stop
+red L247
+stop
+L161: lea L306, r7
+L162: bne *r1
+L163: bne L331
+not L245
+L164: red L189
+mov *r2, L261
+L165: prn #65
+L166: .string "ddltfehmfgwiyno"
+jmp *r6
+L167: jmp *r6
+rts
+lea L285, L322
+L168: bne L244
+L169: .string "ziggektueosgvdeejphou"
+L170: jsr L177
+bne *r7
+dec L309
+L171: clr *r6
+prn r5
+stop
+L172: dec *r3
+inc r7
+not *r3
+add r6, *r0
+lea L298, r1
+mov #230, L328
+; comment
+
+inc r6
+red *r0
+not r0
+cmp L323, *r2
+prn L321
+rts
+L173: clr *r6
+lea L305, L237
+L174: lea L287, *r1
+bne L263
+lea L252, *r7
+
+mov *r0, r5
+rts
+sub r7, *r2
+not *r6
+dec r7
+jsr L290
+add r1, L197
+; comment
+L175: jmp L263
+inc L180
+L176: .data 508
+prn *r4
+stop
+mov r1, r3
+L177: not L259
+add #-214, L293
+inc L357
+bne L259
+L178: not r5
+jsr *r5
+red *r6
+L179: mov #197, L210
+L180: not L223
+cmp L332, L310
+L181: .data -191, 4, -909
+L182: add #137, r7
+L183: mov *r1, *r4
+L184: cmp r2, L242
+mov *r1, L320
+L185: .data -841
+prn #216
+stop
+red r2
+jsr L262
+red *r4
+dec L278
+jmp *r1
+jsr L240
+prn #-130
+cmp r6, *r4
+sub L347, r7
+cmp L243, #110
+L186: rts
+jsr L324
+rts
+L187: .string "hnbcfpklvdcfwvcg"
+L188: add *r6, L210
+not L206
+clr *r1
+sub #154, L233
+jsr *r0
+not r6
+add r5, *r4
+prn #123
+L189: rts
+L190: .data 772, 595, -857, 724
+L191: .data 817
+jmp *r5
+sub *r3, *r2
+bne *r2
+rts
+jmp *r7
+jmp L345
+L192: prn *r1
+cmp L274, *r1
+inc *r6
+stop
+red *r2
+red r7
+cmp #40, #-184
+rts
+sub r5, L343
+inc r3
+not L313
+L193: sub #18, r0
+jmp *r5
+sub L211, *r0
+clr L359
+add *r4, r7
+stop
+prn *r5
+red L250
+L194: cmp *r7, L306
+L195: mov L335, L290
+L196: sub L227, *r0
+sub #102, *r3
+
+dec L357
+stop
+L197: prn r2
+L198: lea L205, r4
+prn r1
+cmp #-198, L229
+L199: clr L322
+L200: jmp L217
+sub r1, L301
+L201: red *r0
+L202: lea L318, L217
+L203: cmp L324, r7
+dec r7
+red r5
+L204: red r0
+L205: .data 122, 330, -66, 85
+clr L234
+clr L251
+cmp L252, L304
+sub *r7, *r7
+L206: clr r5
+L207: stop
+L208: bne L304
+L209: not *r5
+mov #-143, *r3
+L210: sub *r5, L258
+L211: rts
+L212: clr r1
+
+L213: red r2
+add r7, r6
+prn *r5
+add *r1, r1
+L214: cmp r0, *r5
+jmp *r4
+cmp *r6, L218
+rts
+bne L284
+red *r6
+L215: rts
+sub L264, r7
+red L358
+L216: jmp L344
+L217: not *r6
+jsr L275
+jmp *r6
+jsr L253
+L218: .string "gaurtfxvvosiltzcyesf"
+L219: jmp L266
+add *r2, *r6
+inc *r7
+L220: not r0
+dec L339
+red *r1
+cmp r5, *r4
+jsr *r7
+sub #-34, *r1
+stop
+L221: .string "adaqwpzutofzul"
+L222: stop
+L223: .string "rtpecpzk"
+mov r4, r0
+mov r6, *r3
+dec L262
+sub L357, r4
+jsr L234
+L224: .data 447, 94, -232, -839, -414, -416, -217
+not *r7
+add *r5, *r4
+L225: .string "htzatkabtaeuy"
+dec *r6
+prn *r5
+prn L254
+jsr L289
+not *r6
+prn *r2
+add *r7, *r0
+sub L320, *r7
+; comment
+stop
+jmp L331
+L226: sub L340, *r5
+stop
+L227: rts
+add #-136, r6
+dec r6
+red r1
+L228: stop
+L229: clr L241
+jmp *r4
+rts
+stop
+; comment
+L230: rts
+L231: rts
+not *r4
+; comment
+not r2
+L232: .data -799, -84, -829, 521, 838
+clr *r1
+stop
+add L307, r6
+L233: inc *r1
+sub r1, r4
+jsr *r5
+L234: inc L265
+inc *r5
+stop
+add r3, r5
+mov L306, r3
+sub *r1, r7
+rts
+jsr *r0
+red L272
+L235: .string "yltfmbkkjhqncjggaujna"
+L236: .data 503, 592, -998, 942, -720, 920, 237
+L237: .data -993, -539, -427, 728
+add *r5, L344
+L238: sub *r7, L329
+jsr *r5
+L239: mov r4, *r1
+cmp #125, #-46
+dec r2
+inc L280
+rts
+bne L274
+L240: jmp L292
+L241: mov L342, *r1
+L242: mov L350, r7
+inc *r0
+jsr *r0
+inc *r3
+L243: inc *r6
+L244: jmp *r0
+rts
+L245: add r5, *r6
+dec r1
+L246: .string "ks"
+
+L247: .data 579, 865, -685, -486, -277, 386, -413
+; comment
+clr r2
+L248: sub L321, *r2
+prn #132
+L249: dec *r3
+dec *r3
+mov *r7, *r3
+L250: rts
+L251: stop
+not L283
+L252: .string "vzqz"
+cmp r6, r3
+not L278
+L253: red *r7
+L254: not *r1
+not r4
+bne L328
+L255: red *r0
+bne *r4
+add #-32, L323
+not *r3
+L256: .string "ryxwtztkyesvjfyt"
+add L319, L278
+
+L257: .string "iscr"
+not *r2
+L258: sub *r1, r3
+add r7, L296
+mov #-39, *r1
+L259: .data -702, -225, -465, 643, 538, 705
+L260: clr r3
+L261: mov #-218, r2
+L262: dec L336
+; comment
+L263: jmp L316
+red r3
+L264: prn L304
+L265: red *r3
+prn *r5
+lea L324, r5
+L266: rts
+red *r3
+rts
+L267: .data -971, 940
+jsr *r5
+mov L321, *r6
+L268: mov *r7, *r2
+bne L316
+L269: jsr L288
+red *r0
+cmp *r7, r6
+red r6
+
+jmp *r3
+bne *r4
+L270: mov r0, *r7
+; comment
+sub L337, L283
+bne *r1
+rts
+L271: .string "ggzxwug"
+red L351
+clr *r5
+red r6
+L272: .string "pfxtssky"
+clr r2
+jmp *r2
+cmp *r1, *r7
+not L341
+L273: mov #-3, L292
+; comment
+mov L335, *r4
+L274: rts
+sub *r2, r4
+stop
+inc r2
+L275: jmp *r7
+bne *r4
+L276: add #219, *r1
+not *r5
+L277: rts
+L278: clr *r4
+L279: sub #192, r0
+L280: inc r2
+stop
+add *r4, *r2
+bne L350
+sub L339, *r6
+L281: mov #-114, L320
+stop
+lea L332, L284
+cmp *r7, L340
+inc r7
+rts
+clr L297
+rts
+lea L330, r4
+stop
+red *r4
+lea L355, r6
+lea L349, r1
+jmp *r7
+L282: dec *r5
+red r0
+dec *r6
+prn r0
+cmp r1, L310
+mov *r2, r6
+jmp *r0
+mov #145, L318
+
+jmp L359
+cmp r0, r0
+L283: rts
+lea L322, L350
+L284: inc *r0
+jmp L319
+L285: jsr L342
+jmp L309
+L286: .string "vkemsufiz"
+L287: clr L329
+L288: lea L305, L344
+bne *r6
+jsr *r6
+L289: .data 400, -986, -387
+rts
+not L297
+L290: mov #-88, *r2
+prn *r5
+clr L327
+L291: bne L304
+lea L319, r5
+L292: mov L316, L350
+dec L293
+sub #-160, L352
+L293: red L307
+clr *r2
+red r4
+L294: not L325
+add #-72, L345
+lea L297, r6
+L295: stop
+jsr L339
+not L341
+mov L321, *r1
+mov #86, r5
+L296: .data -462, 444, 353, -574, 741, -240, -502
+L297: clr *r1
+bne L330
+L298: sub *r3, *r0
+red L302
+L299: sub *r6, *r2
+L300: stop
+L301: .string "nojczdmqigyucte"
+L302: .data -291, -102, -207, 92, -194, 614
+jsr L346
+L303: lea L351, r3
+mov L306, *r7
+L304: cmp *r4, *r0
+
+cmp *r0, r1
+mov #95, *r0
+stop
+bne L359
+bne L341
+; comment
+L305: mov *r2, L352
+L306: .data 720, 306, -104, 253, -433, 599, -156
+
+L307: jmp *r4
+bne *r4
+rts
+
+sub #238, *r0
+lea L318, *r3
+
+L308: .data -914, -869, 924
+sub *r5, L356
+L309: stop
+not r2
+L310: .data -145, 382, 608, 350, 375
+add r3, L318
+L311: stop
+L312: clr *r3
+lea L345, L343
+L313: .data -608, -127, -299, 959
+
+L314: dec *r0
+inc *r6
+bne *r2
+L315: bne *r0
+L316: clr *r3
+L317: sub L358, r5
+
+L318: jsr L325
+
+L319: lea L325, r4
+L320: .data -321
+mov r0, *r1
+L321: sub *r6, L330
+
+mov *r1, *r7
+L322: stop
+L323: sub *r2, r6
+dec r4
+not L348
+L324: cmp r5, L333
+rts
+prn L354
+add #-115, L332
+prn #148
+red L359
+L325: not L352
+red *r7
+dec *r6
+jsr *r7
+mov #-1, r1
+cmp L358, r7
+red *r0
+add #225, r2
+L326: .string "hqwqspwuiwuc"
+cmp r3, #5
+L327: stop
+jmp L337
+L328: bne L350
+bne *r2
+L329: cmp *r5, L331
+L330: stop
+L331: dec *r4
+stop
+not r3
+L332: mov #158, *r3
+
+L333: .string "ojhosudev"
+inc *r4
+L334: prn r0
+L335: .data 151, 280
+cmp r6, L348
+cmp #30, *r0
+clr *r2
+lea L354, r0
+prn #-203
+rts
+rts
+jmp *r0
+L336: .string "oidnycceoa"
+L337: .string "rowwmazkiopyosqvlbtqn"
+sub #34, *r7
+L338: mov r0, r1
+bne *r4
+not r5
+inc r5
+add #133, *r2
+; comment
+L339: prn *r0
+prn r5
+L340: rts
+dec *r1
+bne L358
+stop
+L341: .string "gokmrqclmjojy"
+lea L345, r4
+red r6
+lea L353, r0
+L342: jmp L345
+stop
+L343: lea L350, L354
+stop
+L344: prn *r1
+cmp #236, #225
+jsr L352
+L345: cmp *r5, r1
+L346: stop
+prn #144
+mov *r2, r1
+clr *r4
+mov L359, r1
+clr L349
+L347: jsr L348
+jsr L349
+jsr L355
+L348: prn r5
+L349: sub r3, r5
+rts
+L350: dec r4
+L351: .data 370, 753, 852, 433, 386, 646, 43
+L352: cmp *r1, #130
+inc r4
+L353: prn L357
+L354: .string "tkazgidjpzkpknbsai"
+L355: clr r7
+dec L356
+not r2
+L356: red L359
+jmp *r0
+L357: bne *r7
+mov L359, *r2
+L358: clr L361
+jmp L359
+L359: .data 730
+add #180, L361
+L360: lea L361, r4
+cmp L361, *r6
+cmp #-226, #-104
+L361: .data -17, 149, -709
+red *r3
+stop
@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 6
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+bne L329
+bne L247
+; comment
+L0: red L204
+L1: dec L116
+stop
+cmp *r1, L192
+L2: red *r4
+L3: mov #-152, L49
+L4: not *r7
+L5: bne *r6
+sub L122, *r3
+L6: .string "wd"
+red L327
+lea L290, r6
+clr L53
+L7: clr r6
+L8: not L68
+L9: .string "nmdaqhuotkzyzuhx"
+L10: mov r7, r7
+L11: .string "yucfqvruyu"
+inc L103
+not L213
+L12: cmp #-23, #103
+not r6
+clr L176
+stop
+bne *r7
+L13: lea L289, *r0
+L14: red r2
+add *r6, *r4
+jmp *r5
+L15: rts
+rts
+red L334
+L16: clr *r2
+mov L330, *r2
+L17: .data 57
+rts
+lea L222, *r2
+L18: prn r0
+clr L349
+L19: .data 945, 621, 545, -142, 988, -230, -865
+stop
+not L281
+lea L317, r0
+L20: dec L33
+L21: jmp L248
+red L222
+L22: lea L146, *r4
+rts
+mov *r0, r7
+red *r6
+clr L312
+mov L81, L241
+L23: .string "bqrolpgvaxctnztwxgxo"
+L24: bne L353
+L25: jsr L70
+prn L138
+lea L71, *r1
+stop
+; comment
+inc r2
+stop
+stop
+stop
+L26: inc L305
+red *r7
+red r1
+
+L27: .string "vhs"
+L28: clr r1
+cmp L38, #154
+prn L173
+stop
+stop
+L29: .string "wcsxclepttwtqwmlusmm"
+rts
+L30: .string "rztrsmgs"
+stop
+L31: .data -206, -909, -238, 275, 977, 131
+jmp *r7
+prn L234
+L32: .string "eam"
+red L207
+L33: not L309
+jsr *r3
+L34: .string "dsmvveujkjdrkp"
+sub r1, *r2
+L35: lea L262, *r1
+L36: add #-158, L86
+L37: prn #83
+L38: .string "tfckkaxlhwy"
+L39: jmp L258
+not *r1
+bne L306
+jsr *r6
+clr r4
+
+L40: .data -367
+inc L237
+prn L249
+clr r7
+L41: cmp *r3, r6
+cmp #-206, *r2
+L42: lea L91, r0
+; comment
+L43: .data -820
+add r5, *r2
+bne *r0
+jmp *r1
+inc L306
+clr *r4
+prn L203
+mov L269, r2
+rts
+L44: lea L309, *r7
+
+inc r7
+L45: clr L314
+clr *r1
+L46: sub r1, L69
+bne *r2
+dec *r4
+; comment
+dec *r2
+L47: .data 121, -324, -921, 283, -506, -384, -594, 669
+prn L255
+L48: lea L221, L276
+stop
+red *r2
+not *r1
+L49: rts
+mov *r0, L127
+L50: mov L304, L307
+cmp r7, L58
+L51: rts
+mov #127, *r3
+L52: inc *r2
+L53: lea L343, r6
+
+not *r1
+L54: .string "jaegjdpvdpx"
+L55: .data -163, -895, -674
+not r0
+L56: rts
+sub r1, L83
+bne *r4
+rts
+stop
+L57: lea L149, *r3
+L58: .data 583, 420, 4, 845, -539, 113, 993
+L59: .string "mqkp"
+jmp L290
+L60: mov #98, L74
+L61: .string "xpplvhzjecvmkbkvnqptcgj"
+lea L164, r4
+L62: jmp L93
+lea L82, r0
+prn *r7
+stop
+jmp L164
+L63: lea L154, *r4
+jmp L332
+prn L213
+L64: .string "gjxhdfvevohjykfbs"
+L65: dec L270
+L66: bne L329
+stop
+L67: .data -456, 228, 808
+L68: .string "xpdbfcmakplmckqtbdbw"
+L69: .data 536, -857, 903, -852, -778, 216
+L70: cmp L313, r3
+prn *r0
+L71: .string "ea"
+stop
+rts
+rts
+L72: dec L111
+rts
+add *r2, r7
+dec r6
+mov r7, *r7
+bne L271
+mov L324, r0
+stop
+sub r6, r7
+rts
+inc *r0
+L73: .string "fgnyaarnzjdwmmxemg"
+prn *r2
+L74: mov L328, r6
+not r4
+bne *r4
+; comment
+rts
+L75: clr *r4
+red *r1
+dec L300
+; comment
+red *r5
+L76: .string "vcfbkxhmpwm"
+L77: lea L311, L269
+L78: sub L244, L331
+stop
+L79: prn L323
+add *r4, *r5
+L80: .string "rcztgmcqexbr"
+L81: sub r0, *r0
+jmp *r2
+L82: cmp #163, r3
+add #130, *r0
+cmp r3, #14
+red L202
+lea L155, *r5
+not L279
+prn r6
+L83: .string "qqdugdndcjoxka"
+dec r7
+stop
+L84: jsr *r1
+inc r0
+red *r7
+; comment
+not *r4
+sub L156, *r1
+cmp L275, r1
+L85: jsr *r1
+lea L224, r5
+L86: red r5
+L87: not *r3
+add *r4, L110
+; comment
+L88: .string "tuuzyxddmdnlngztoh"
+cmp *r6, #179
+inc r4
+mov L276, L117
+jmp L289
+L89: lea L345, *r4
+L90: prn *r1
+clr L209
+dec r5
+inc r5
+L91: jmp L346
+bne *r7
+L92: cmp r5, #215
+L93: dec L294
+mov *r3, *r5
+L94: rts
+prn *r0
+L95: lea L316, L270
+bne L127
+prn *r4
+L96: stop
+jmp *r4
+clr L122
+L97: sub r0, L156
+clr r3
+L98: cmp #-237, r0
+; comment
+L99: lea L303, L235
+L100: cmp *r1, L172
+prn r3
+L101: jsr L162
+mov L260, L304
+lea L134, L186
+jmp *r6
+stop
+cmp L292, #193
+L102: clr L191
+mov L172, *r3
+
+L103: inc L177
+bne L116
+mov L319, *r7
+L104: .string "pcsoaqhsoygatuukuoyyw"
+inc *r2
+clr L171
+L105: sub L310, *r5
+L106: inc r0
+L107: clr r7
+L108: mov L112, r0
+mov r2, r6
+stop
+L109: prn L167
+L110: red L350
+rts
+clr L163
+
+red *r4
+add r1, *r6
+L111: mov *r1, L208
+rts
+lea L222, L241
+lea L292, L186
+bne L176
+L112: prn *r1
+jsr *r7
+L113: red *r5
+mov r6, *r0
+inc L325
+L114: not r0
+red L331
+L115: clr L339
+
+jmp *r3
+; comment
+red *r5
+jsr *r7
+L116: red L343
+L117: .string "xnexgqxzcpzhyhevi"
+prn r6
+cmp r0, r1
+L118: cmp L141, *r7
+L119: red *r7
+L120: .data 891, -598, 493, -296, -611, -251, -979, 452
+mov r1, r0
+jsr L255
+stop
+prn #-137
+dec L244
+mov #-91, *r1
+stop
+sub L226, r6
+cmp r6, r4
+L121: .data -176, -838, 375, 612, -822, -327, -506
+sub *r4, r2
+lea L217, r2
+inc *r7
+dec r3
+jmp L302
+inc *r5
+L122: not L125
+L123: rts
+sub *r3, r7
+bne L336
+sub #-228, *r7
+L124: lea L345, *r3
+L125: red *r2
+jsr L160
+stop
+
+mov L303, *r0
+L126: .string "qqxksmohnvwkywbs"
+rts
+mov r6, L309
+jsr L307
+clr *r4
+lea L131, L178
+jmp L307
+not *r3
+L127: lea L209, L181
+sub L321, *r6
+bne L286
+L128: sub r3, L353
+add #9, L303
+red *r5
+L129: cmp #-76, r5
+bne L260
+rts
+L130: jmp *r3
+clr L252
+L131: inc *r0
+L132: clr *r3
+
+
+L133: red r4
+mov #-68, *r1
+L134: rts
+not r3
+sub L245, r0
+L135: clr r2
+jsr *r2
+clr r4
+L136: red r1
+prn #-182
+sub L235, r4
+rts
+L137: dec L162
+lea L163, *r4
+L138: .string "wyiskfjkqtp"
+stop
+L139: rts
+L140: red *r1
+L141: clr r7
+L142: jsr L356
+sub *r3, r1
+L143: lea L329, *r3
+L144: sub #18, *r1
+L145: lea L252, L214
+sub #-10, L149
+
+bne *r1
+mov *r1, L214
+lea L270, L304
+rts
+clr L150
+L146: jsr *r2
+L147: inc *r4
+red *r6
+add #180, r6
+not r5
+jsr L351
+L148: dec r0
+mov #-119, *r2
+
+cmp L341, *r2
+L149: prn L356
+mov *r4, *r1
+L150: add #70, L290
+inc *r3
+L151: rts
+L152: clr L302
+prn #113
+stop
+stop
+not L294
+; comment
+lea L249, L315
+L153: rts
+lea L341, L243
+L154: sub #-73, r7
+add L304, L195
+rts
+mov *r3, r0
+jmp L339
+jmp *r1
+; comment
+L155: .data 563, 261, -620
+prn *r6
+L156: rts
+rts
+add r1, r2
+red *r2
+; comment
+L157: .string "cibujiqzfhlpahnn"
+dec L178
+not r0
+not L265
+cmp r0, *r6
+jmp L266
+jmp L280
+L158: prn r6
+L159: red *r0
+red r1
+prn r0
+prn r0
+clr *r4
+inc r2
+L160: prn L266
+L161: cmp #37, L249
+clr r3
+sub r0, r0
+L162: jsr *r4
+L163: .data -222, -997
+red L307
+; comment
+L164: .data 141
+clr *r4
+L165: .string "cpqlodfoknzjc"
+rts
+L166: stop
+sub L228, *r2
+dec L289
+red L349
+
+; comment
+red L210
+L167: .data 714, 557, 384, 689, 181, 830, -821
+L168: .string "keuzgrycynvwfpgowmuqfkr"
+jsr *r7
+L169: .string "jxkb"
+dec r7
+L170: clr *r7
+stop
+red *r3
+clr L324
+bne *r3
+inc r4
+L171: rts
+jsr L209
+jmp L214
+L172: cmp *r5, *r7
+bne *r5
+L173: .data 685, -362, 787, -131, -580, 310, 580, 231
+cmp #194, #-39
+clr r1
+cmp #-15, *r5
+inc r6
+prn #137
+dec r6
+bne L323
+L174: add *r2, r5
+cmp *r4, *r0
+mov L335, r0
+lea L212, L322
+prn r0
+jsr *r7
+dec r7
+L175: not L307
+sub r2, r4
+L176: not *r2
+clr r2
+L177: rts
+L178: add *r6, L328
+L179: .data -519
+red *r4
+dec *r6
+; comment
+not r7
+prn #65
+rts
+stop
+L180: red L333
+cmp L246, L262
+L181: not *r4
+lea L318, *r7
+add #-210, r7
+jmp L317
+L182: red *r0
+jmp *r1
+not L291
+L183: mov L184, L241
+sub #-124, *r3
+L184: dec r7
+prn *r5
+L185: jsr L243
+rts
+L186: .string "ntyegalhyugbqbq"
+L187: clr *r2
+rts
+clr r6
+L188: clr L202
+add #25, L212
+not r3
+L189: red *r3
+rts
+add L193, *r1
+L190: not r5
+inc L292
+L191: prn *r4
+add #217, r2
+bne L229
+dec r2
+not r6
+L192: cmp #-139, L236
+inc r7
+red *r5
+inc *r5
+L193: not r1
+L194: .data 580, -257, 517, -794, -137, -598, 286
+L195: inc *r4
+L196: rts
+jsr *r1
+inc r0
+stop
+stop
+L197: dec L299
+L198: mov L250, L238
+red r2
+stop
+L199: red r0
+L200: stop
+mov r6, *r7
+L201: jmp *r5
+cmp #161, r0
+jsr L257
+L202: sub L262, L303
+red L336
+L203: rts
+inc r4
+L204: stop
+L205: red L300
+L206: red r5
+inc L350
+
+clr *r6
+L207: red *r1
+stop
+prn r3
+L208: rts
+cmp *r1, L297
+prn *r2
+mov *r3, *r4
+sub #-81, *r4
+L209: sub L275, L223
+rts
+L210: rts
+
+dec L220
+L211: mov L302, r0
+add r2, L318
+; comment
+jmp L258
+cmp L213, #150
+jsr L273
+lea L274, *r4
+red L337
+mov r6, r3
+sub L258, *r5
+sub r4, r2
+sub r4, r1
+add L321, *r4
+mov L241, *r2
+L212: add *r1, r5
+L213: .string "qn"
+L214: lea L312, r7
+dec L260
+stop
+add #-236, *r3
+stop
+cmp #29, r0
+L215: jsr L345
+inc L354
+mov r4, r2
+cmp *r3, *r0
+inc r1
+L216: inc *r5
+rts
+L217: .data -883, 8, 508, 900, -350
+L218: jmp *r4
+L219: mov #245, r7
+mov L348, *r5
+bne L282
+jsr *r7
+clr r2
+L220: dec *r0
+L221: .data 539
+jsr *r5
+red r2
+not L336
+L222: lea L303, r4
+L223: cmp r6, r1
+L224: mov *r6, r7
+dec r1
+add *r0, L335
+
+L225: .string "kccxcuuuajrs"
+bne *r4
+; comment
+inc L227
+dec L279
+cmp L341, *r6
+L226: bne *r1
+L227: clr r7
+L228: dec *r0
+inc r6
+red r2
+not *r4
+L229: jsr *r4
+; comment
+bne L275
+prn r5
+L230: .data -450
+inc *r7
+jsr L311
+sub #64, *r4
+L231: stop
+jsr *r3
+L232: add L235, r6
+red *r1
+red *r2
+clr r4
+L233: mov r3, r3
+L234: prn L325
+red L278
+jmp L238
+clr *r3
+mov *r4, r2
+inc L349
+lea L285, r1
+prn r4
+red *r5
+L235: .string "uyrgbpehavdyegi"
+lea L286, *r7
+L236: .data -573, -632, -154, -993, -539
+clr L282
+L237: sub *r7, r5
+L238: red r4
+mov *r5, *r0
+L239: rts
+; comment
+rts
+rts
+lea L279, r2
+L240: jmp *r6
+dec r5
+L241: .string "ldikeojdxhrmuqrbtplova"
+add #130, *r7
+add #43, L312
+; comment
+mov #56, L337
+cmp *r7, #-38
+inc r6
+L242: .data 544
+rts
+L243: dec *r1
+dec r0
+L244: bne *r5
+L245: sub *r4, r3
+L246: inc r0
+L247: prn *r5
+L248: .data -480
+L249: red L264
+L250: inc *r0
+L251: jsr L346
+bne *r7
+dec *r0
+red *r0
+L252: inc r5
+prn #-170
+L253: .data -326
+bne *r1
+L254: .data 464, 583
+L255: .data 232, -193, -318, -654, 286, 442, -862
+clr L272
+L256: mov *r1, L295
+L257: .string "nwpxvlemk"
+bne L263
+L258: clr L334
+rts
+
+jmp *r5
+L259: mov L284, L350
+dec L280
+add L274, r5
+L260: stop
+L261: .data 329
+L262: lea L314, *r3
+not L320
+inc L281
+bne L353
+L263: clr r3
+L264: .string "ahcnywqslvujx"
+L265: .data -767, 375
+clr r2
+mov *r6, *r3
+L266: jmp L283
+clr L353
+add L357, L289
+L267: sub r7, *r2
+add r7, *r0
+dec r2
+jmp *r6
+jsr L301
+lea L343, L346
+jmp *r4
+inc r3
+prn *r7
+L268: prn r1
+L269: mov #38, *r1
+clr L312
+L270: jmp L275
+jsr L345
+stop
+L271: .string "ilqfkzlpqspyaln"
+cmp #181, #-176
+inc *r0
+L272: inc *r5
+L273: lea L330, r3
+sub L339, *r0
+inc r0
+add r3, *r2
+; comment
+not L343
+
+rts
+not L329
+clr r5
+not L316
+L274: .string "cvkkoakmztdiwtuujita"
+L275: sub *r4, L355
+L276: inc r0
+L277: prn r6
+L278: jmp *r1
+prn r0
+bne *r5
+L279: stop
+clr L349
+rts
+dec *r2
+L280: .data 550, -132, -236, 194, -809
+L281: mov L340, *r1
+not L295
+clr r1
+cmp *r0, #133
+L282: jsr L287
+L283: stop
+L284: clr L330
+L285: sub *r5, r4
+L286: not L313
+L287: rts
+L288: stop
+L289: dec r7
+lea L302, *r0
+jmp *r4
+red *r6
+add r4, L338
+prn r1
+jmp L349
+add L295, *r1
+; comment
+mov r7, r7
+stop
+L290: stop
+L291: not r3
+L292: red L339
+
+not *r7
+L293: add #184, *r4
+bne L338
+L294: not r5
+clr L332
+jsr *r7
+bne L308
+prn *r1
+L295: lea L318, r2
+L296: clr L298
+jsr L309
+L297: jmp L326
+
+inc *r7
+
+L298: mov *r3, r0
+L299: .data 500, -425, -726
+L300: rts
+L301: rts
+jsr L345
+stop
+bne L306
+L302: bne L314
+L303: clr L338
+jmp *r6
+L304: red *r1
+lea L336, r6
+L305: jsr L334
+L306: mov *r7, L309
+L307: bne L316
+not r7
+jsr L323
+L308: .data 449, 647
+lea L333, L338
+add L326, *r5
+bne *r3
+cmp L344, r0
+jsr L339
+dec L350
+clr L354
+clr *r5
+L309: lea L353, r1
+dec r5
+dec r4
+mov r1, L354
+dec *r2
+not *r5
+lea L348, L340
+L310: not *r1
+jmp L357
+L311: jmp *r6
+stop
+L312: stop
+mov r7, *r7
+not r4
+stop
+bne *r7
+red L329
+prn L344
+sub #-167, *r3
+not L315
+L313: .string "huxpbrcxoldrnnihxipvpot"
+L314: .data -445, -279, -834, 928, -511, 771
+L315: bne L320
+sub *r6, *r1
+prn r7
+L316: mov r0, L356
+add #-229, r5
+dec r0
+L317: jmp L352
+rts
+L318: bne *r1
+dec *r2
+L319: prn r2
+prn *r4
+jsr *r4
+
+L320: not r1
+L321: prn #48
+L322: .data 650, 530, 490, 109, 556, -710, -385
+dec *r5
+inc r7
+rts
+add r3, *r4
+mov *r4, r5
+dec L355
+not L325
+bne L325
+add r0, L355
+L323: stop
+L324: .string "cfigbspe"
+L325: not *r3
+sub L342, L343
+cmp r3, *r3
+not r7
+add *r6, L344
+mov *r5, *r6
+lea L357, r7
+red L357
+dec r6
+L326: .data 249, -793, 814, 59, 953, 514, -850, 169
+L327: lea L340, *r3
+L328: .data -136, -666, 475, 735, -270
+not L341
+not L350
+red r4
+red r7
+sub r6, r1
+prn L331
+jsr *r0
+dec L334
+red *r1
+clr *r1
+jsr L331
+not L337
+inc r1
+bne *r1
+jsr *r4
+L329: cmp *r2, #-177
+add #-183, *r0
+stop
+L330: prn #206
+L331: prn r3
+lea L350, r7
+inc L335
+L332: clr L345
+L333: .string "qcipgripwtfktyxuvdqhrd"
+L334: dec *r4
+lea L342, *r7
+inc L340
+L335: .string "mei"
+rts
+L336: mov r2, r3
+L337: .string "sv"
+rts
+L338: .data -473, 249
+bne *r5
+L339: prn #115
+L340: cmp #-158, #-117
+L341: dec L356
+L342: .string "rmtpdwazh"
+lea L352, r1
+mov *r5, r5
+stop
+stop
+L343: jmp L351
+L344: clr *r3
+L345: .data -523, -12
+L346: .string "jubzpeyrmzahxmu"
+stop
+bne L356
+rts
+sub #171, L350
+jsr L351
+red *r2
+not r2
+not L353
+mov #-82, L347
+red *r5
+cmp r2, *r2
+prn #56
+L347: lea L351, r7
+L348: jmp L356
+L349: .data -831, -429, 587
+L350: red L357
+L351: jsr L354
+jsr L352
+sub L353, L353
+sub #185, *r2
+sub #213, L357
+red r4
+; comment
+L352: .string "iyyhcdyfotcrwrhh"
+bne L355
+; comment
+red *r2
+L353: red r5
+
+sub L356, *r7
+L354: sub L355, L357
+; comment
+jmp L355
+; comment
+L355: .string "jcibw"
+L356: .string "luvswohzthndoouogbkqz"
+dec *r6
+bne L357
+L357: .data -985, -303, 481, 217
+; comment
+inc L136
+mov *r4, r4
+inc L299
+stop
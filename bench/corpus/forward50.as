@@ -0,0 +1,1026 @@
+; Generated by genCorpus --seed 51
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+L0: dec r2
+L1: mov *r0, r3
+L2: .data 823, -342, 547, 418, 338, -69
+clr *r0
+add *r5, r4
+L3: .string "ufjvjgqjmfqolxh"
+L4: rts
+lea L51, L57
+lea L214, *r2
+bne *r5
+jmp L142
+L5: add *r5, *r1
+clr *r2
+bne *r4
+L6: not L54
+stop
+
+
+L7: rts
+
+add L150, r7
+bne L292
+L8: clr r7
+L9: add L285, *r2
+mov r3, L307
+L10: red L58
+add *r7, L104
+not r2
+dec *r3
+rts
+L11: sub r0, r5
+L12: .data -788, 562, 602, 87, 895, 826, 830, -37
+L13: .string "uytmvqpwdlnygaayhqi"
+L14: mov *r7, *r7
+lea L329, L172
+L15: .data 5, 281
+cmp #-84, #160
+; comment
+prn r7
+prn r7
+sub r5, L337
+clr r4
+red r2
+dec L365
+sub r7, *r6
+L16: cmp #24, r2
+lea L70, L370
+cmp L108, r0
+L17: stop
+sub r6, L360
+L18: jsr *r2
+L19: mov #-151, L139
+not r1
+inc L313
+L20: prn *r1
+lea L177, L218
+stop
+lea L348, r0
+L21: cmp L130, r5
+red *r5
+L22: .string "qtpcrxytwsewvcowixluzygb"
+mov L325, r4
+
+L23: .string "aetgkiernrwfjhtcdl"
+rts
+L24: .string "iqfheq"
+inc *r6
+L25: .data -672, -819, 859, 288
+red *r5
+jmp *r0
+L26: mov *r2, L181
+mov r3, L256
+L27: sub #-185, L357
+rts
+red r7
+red *r4
+L28: cmp *r7, #-216
+L29: clr L135
+inc r4
+L30: inc r3
+inc L252
+stop
+lea L55, L203
+L31: not *r1
+L32: jmp *r0
+dec *r1
+dec *r0
+prn *r5
+add L277, r5
+stop
+jsr *r4
+L33: sub L157, L268
+L34: .data 795, -108, -231, 377, -158, 362, -607, -734
+L35: bne L247
+L36: .data 539, -967, -907, -946, 925, -242
+L37: stop
+stop
+sub *r5, r4
+L38: add L295, L156
+L39: prn r4
+inc r0
+L40: .string "mqtjmadbuwqngkwdj"
+prn r0
+L41: bne *r3
+L42: stop
+dec L174
+L43: add #185, r4
+rts
+lea L244, L102
+prn r3
+jsr *r0
+L44: dec r3
+clr L146
+jmp L329
+L45: stop
+L46: .data 63, 989, -955, 447, -352, -114, 911
+mov *r4, *r0
+L47: sub r1, r1
+not *r0
+L48: jsr *r5
+L49: jsr L223
+sub r0, L370
+
+L50: rts
+L51: rts
+sub L110, r7
+inc *r6
+L52: mov L150, r2
+L53: .string "asjsqvwecnchcymgint"
+inc *r0
+L54: .data 415, -671, 876, 320, -680, -363, -6, 202
+bne L298
+inc L359
+dec L305
+rts
+L55: not L273
+mov r7, *r2
+mov *r5, L342
+not L289
+lea L75, L295
+sub r5, r2
+L56: .string "lbdsvsouzbhpxfj"
+
+L57: jsr *r0
+L58: rts
+L59: stop
+stop
+L60: bne L105
+L61: red L308
+jsr L76
+inc *r3
+stop
+lea L344, L361
+cmp L228, *r2
+stop
+L62: clr r0
+L63: not r3
+rts
+red *r7
+L64: .string "kabtwmqeglfnqrrg"
+L65: mov L182, *r6
+inc *r7
+stop
+
+cmp L312, L294
+L66: .string "znnxgpafkqbyyjlcmgk"
+red L347
+jsr L114
+L67: inc r3
+L68: bne *r0
+sub *r1, *r0
+
+jsr L89
+jsr *r6
+L69: dec r3
+L70: lea L141, *r7
+L71: inc L165
+; comment
+L72: .data 236, 192, -202
+sub #-248, L133
+dec r2
+L73: prn L109
+lea L349, r2
+
+red L334
+L74: red r0
+cmp #96, r4
+L75: mov L85, *r2
+mov *r2, r5
+add #197, *r3
+L76: add r4, *r7
+red *r6
+L77: jsr L228
+stop
+inc r1
+L78: not *r4
+not *r7
+add *r0, r5
+L79: add r7, L291
+mov L339, r0
+L80: bne L93
+; comment
+L81: cmp *r2, *r6
+L82: mov *r3, r6
+bne *r0
+L83: .data 616, -806, 710, -447
+L84: dec r7
+mov *r3, *r6
+prn L250
+lea L141, *r2
+red r7
+rts
+rts
+sub r2, *r6
+jmp L291
+L85: .string "pflgdxxvjhqlznndtl"
+jmp *r5
+bne L356
+bne *r0
+L86: dec *r3
+prn L117
+L87: .string "yvp"
+L88: .data 564, 806, -96, 545, 542, 164
+; comment
+not r5
+L89: sub #155, *r7
+L90: inc r5
+cmp L304, #-28
+L91: red r1
+add #-215, *r2
+
+dec L161
+add L363, *r4
+lea L350, r4
+L92: sub L356, *r7
+cmp r3, L102
+sub #237, L122
+stop
+add #-30, r0
+L93: clr r3
+lea L319, L362
+sub L321, r7
+stop
+rts
+L94: stop
+L95: .string "shdmwo"
+L96: sub L176, *r3
+; comment
+jmp L286
+L97: .data 288
+add #77, L362
+mov L325, *r1
+L98: clr *r5
+not L170
+bne L115
+dec r2
+lea L250, r0
+L99: bne L229
+L100: .string "olenrcfbrlmozjkhxv"
+add r3, L260
+L101: rts
+L102: .data -817, -682, 226, -316, 601
+cmp L270, #-118
+L103: bne L339
+inc *r2
+red *r0
+prn #-198
+L104: cmp #-91, *r1
+; comment
+prn #223
+sub L266, L201
+L105: stop
+clr *r3
+rts
+prn #254
+L106: bne L131
+bne *r3
+not r3
+L107: stop
+L108: clr r4
+prn #102
+bne *r2
+L109: sub #254, r4
+L110: inc L163
+dec r1
+mov L279, *r1
+L111: jsr L199
+clr *r1
+L112: stop
+L113: add r4, *r3
+lea L271, r3
+L114: .data 861, 124, -145
+L115: jmp L171
+L116: bne L339
+; comment
+mov r1, *r2
+sub r3, L367
+red r3
+L117: bne L268
+L118: .data -567, -74
+bne L215
+dec L167
+jmp L236
+sub *r2, r7
+L119: bne L204
+add *r7, r3
+dec *r4
+L120: rts
+mov #202, r1
+jmp L182
+prn *r0
+L121: jsr L344
+prn L168
+L122: jsr L293
+stop
+L123: add *r7, *r3
+clr L362
+add r2, r7
+red L291
+sub *r4, r0
+add L248, r3
+L124: dec L348
+L125: .string "awkgwdhbrpf"
+L126: not L268
+stop
+
+L127: .string "wivajedqfi"
+lea L209, L231
+inc r4
+dec L362
+; comment
+L128: dec *r4
+mov r6, L141
+L129: jsr *r5
+L130: bne L316
+red L188
+rts
+L131: .data 949, 517, -90, -116, 722, -101, -232, 482
+; comment
+lea L324, *r6
+bne L259
+clr L325
+L132: cmp r2, r4
+dec *r0
+L133: cmp *r5, L257
+L134: prn r7
+L135: .data -931, 966, 801, 93, 169, -418, -833, 306
+L136: inc *r3
+dec *r2
+
+prn r3
+cmp *r7, r3
+add #-253, *r3
+sub *r5, *r0
+lea L327, r6
+stop
+L137: .data -188, 70, 75, 829
+stop
+cmp L185, L316
+inc L244
+cmp r5, #23
+red r6
+sub r7, *r1
+stop
+clr r4
+L138: mov #-34, *r4
+jmp *r2
+L139: stop
+dec L306
+L140: .data -914, 328, -329, -492, 970, -534, -562, -713
+add L366, *r5
+jsr L156
+inc L245
+mov r0, L368
+inc r7
+stop
+inc *r4
+prn L337
+L141: .string "cjosqgirziqgaigm"
+L142: .string "bimbwaqlhygzn"
+L143: .string "i"
+L144: mov #145, *r1
+L145: dec *r6
+not L331
+lea L304, r3
+L146: cmp #-107, L174
+L147: add L352, *r4
+L148: mov *r1, *r3
+clr L278
+jsr *r4
+mov r7, L306
+stop
+L149: .data -201, -640
+L150: sub L226, r7
+L151: not L221
+inc L286
+stop
+rts
+red *r5
+mov r0, r4
+dec *r3
+sub *r0, L349
+cmp *r7, *r0
+L152: .string "jgijduuilrj"
+sub *r4, r4
+L153: rts
+L154: sub *r2, L365
+L155: rts
+bne L326
+L156: .data 776, 53, 604, 866, -784, -10
+L157: not L358
+red r4
+sub r4, r7
+dec r7
+jsr *r3
+L158: jmp *r2
+not L185
+inc *r4
+jmp L307
+L159: clr r4
+cmp r5, *r5
+L160: bne L253
+dec *r3
+add #-187, r1
+L161: red L274
+lea L243, L330
+bne *r7
+L162: .string "awcelolxnxhukxxnereyrfh"
+L163: inc *r7
+L164: cmp *r2, L232
+inc *r4
+clr L361
+L165: jmp L312
+inc *r6
+L166: jmp L312
+sub L363, r1
+inc r0
+L167: add #106, L249
+jsr *r6
+bne *r6
+rts
+L168: .string "onbzocigjvtpusgqho"
+; comment
+L169: .data -584, 564, -251, 393, -159, 460, -353
+bne *r2
+lea L349, *r3
+inc L247
+jmp *r5
+mov #240, *r2
+L170: jmp L287
+red r3
+L171: mov #-206, r1
+L172: prn *r6
+stop
+L173: not *r6
+jsr L300
+clr L354
+cmp #165, *r7
+dec L298
+not *r7
+jsr L260
+clr *r3
+L174: sub L317, *r1
+cmp r2, L236
+stop
+sub r4, *r5
+red *r3
+sub *r7, L239
+stop
+jsr *r2
+inc L201
+L175: jsr L289
+lea L354, r4
+rts
+L176: inc *r1
+red L234
+jmp L233
+L177: inc *r0
+add *r5, L196
+jsr *r7
+lea L237, *r5
+L178: .data 360, 345
+L179: mov #119, *r0
+cmp *r2, *r4
+L180: .string "ksoxcpjldabinpgndbgol"
+L181: mov L285, *r7
+cmp #74, L293
+L182: bne *r3
+L183: jmp L229
+L184: clr L215
+prn r1
+inc L302
+L185: .data -513, -487, 599, -58, -734, -872, -931, 433
+red L254
+L186: prn *r7
+red *r7
+jmp L187
+stop
+cmp *r2, L249
+L187: rts
+bne *r6
+dec *r0
+dec *r5
+rts
+rts
+jsr *r1
+jsr L333
+jsr *r6
+stop
+; comment
+jmp *r0
+L188: sub #-179, r7
+dec *r4
+not r2
+rts
+inc *r3
+inc r5
+
+L189: jmp *r1
+L190: stop
+L191: .string "zudufllf"
+cmp #73, L273
+clr L342
+L192: stop
+L193: .data -126, -445, -57, -922, -770
+L194: lea L313, *r0
+L195: mov L370, L196
+
+jmp *r1
+L196: .string "vjjgtuzaeatfhwzie"
+L197: stop
+jsr *r1
+dec r1
+bne *r5
+L198: lea L333, L316
+; comment
+jsr L229
+L199: .string "a"
+jsr L304
+
+L200: not *r7
+jsr L319
+clr L217
+L201: lea L322, r2
+L202: prn #56
+inc r4
+L203: .data -394, 790, 737, 934, 886, 237
+L204: prn #-17
+red r4
+add *r1, *r3
+L205: inc *r1
+L206: dec r5
+prn r5
+jmp *r6
+L207: .string "fddbranhviruglhnt"
+L208: .data 328, -641, 308, -286, 685
+L209: add L227, L256
+L210: stop
+
+not *r3
+sub r6, r3
+jsr L219
+stop
+L211: sub *r7, r2
+L212: bne L292
+stop
+L213: .string "arhlpsfcudaj"
+L214: lea L280, r4
+
+L215: prn #-219
+L216: prn #130
+bne *r0
+bne L224
+add *r4, L299
+L217: dec L335
+L218: jmp L362
+bne *r5
+bne L268
+rts
+add #133, *r5
+cmp #-123, L287
+L219: .string "pwrhpecjxpvjak"
+L220: prn #-218
+mov #-197, L221
+not *r0
+prn *r2
+bne *r3
+inc *r6
+inc *r7
+; comment
+dec L296
+L221: add #165, L370
+L222: clr r7
+L223: inc L293
+L224: jsr L245
+not L339
+cmp r0, #195
+red *r0
+L225: rts
+L226: dec r6
+clr L293
+sub *r1, *r5
+add *r3, r7
+jmp L275
+sub r1, *r3
+inc r6
+L227: prn r1
+L228: cmp *r0, r2
+L229: red r2
+L230: jsr *r0
+cmp #189, L308
+; comment
+L231: .data 390, 481, 166, -463, -470
+lea L281, r3
+L232: .string "kx"
+not *r6
+lea L265, L280
+lea L321, L323
+inc L367
+
+jmp *r6
+L233: mov r0, r6
+rts
+L234: prn #-217
+lea L323, r3
+not r4
+L235: .string "sqyaelukbfgflu"
+L236: cmp #93, *r1
+L237: stop
+jmp *r0
+L238: .data 774, -126, -384
+L239: mov L267, r3
+L240: add L244, r4
+cmp #122, *r4
+jsr *r0
+rts
+prn *r4
+add *r3, r6
+clr *r2
+jmp L367
+add *r6, L291
+bne L363
+jmp *r7
+bne L330
+dec *r1
+inc *r7
+; comment
+bne *r4
+L241: bne *r4
+inc *r2
+clr r0
+stop
+jmp *r7
+rts
+cmp #-125, #0
+bne L313
+; comment
+cmp *r6, r0
+L242: not r0
+L243: .string "ldzolahwisndhrsmauwng"
+jmp L295
+L244: .string "jcrrmoululu"
+L245: add #-55, r4
+red *r1
+sub #239, *r3
+dec L352
+lea L354, *r6
+stop
+L246: clr *r4
+not *r0
+inc L350
+stop
+L247: .data -226, -499, -192, 433, -948, 674, -93
+dec r3
+L248: lea L259, L302
+clr r3
+L249: lea L335, *r2
+jmp L268
+L250: .string "nvdzbhgqbyerhgtlm"
+L251: inc *r4
+L252: jsr *r4
+L253: .string "xwvmbbatzvgspeehvvrgzh"
+lea L339, L285
+L254: inc *r7
+cmp #169, *r1
+sub L364, r2
+lea L283, *r3
+clr L270
+lea L369, r5
+bne L353
+rts
+inc L326
+
+L255: jsr *r6
+L256: add L344, L329
+L257: .data -572, -959, 873, 570, -644, 946, -170
+dec *r4
+L258: .string "eejoglllzwwejoaejbcbf"
+not L328
+rts
+add #198, L303
+L259: mov #106, *r6
+prn *r1
+L260: .string "cjeyzekxawgqehejcpjzn"
+L261: rts
+lea L294, r6
+L262: clr r3
+jsr *r4
+L263: .string "igiensfygyufnjsnzg"
+bne L349
+L264: .string "fsxevpbosalfzzwmslbyna"
+L265: bne L269
+dec *r1
+L266: lea L286, r0
+not L368
+L267: mov *r7, *r6
+L268: cmp r4, r3
+L269: .data 248, 116, -388, 694, -18, 815, -319, 627
+L270: .string "jomrdpkrkjqmlgefnurjtlf"
+jmp L302
+L271: bne L310
+L272: jsr *r4
+L273: lea L290, r3
+cmp L356, *r0
+lea L369, *r7
+
+stop
+prn r3
+L274: mov r2, r3
+cmp #107, *r2
+not L361
+L275: add L324, L349
+stop
+not L278
+mov #-149, L295
+sub r6, *r1
+not *r6
+
+sub *r3, *r0
+prn *r1
+red *r7
+jmp *r6
+L276: inc *r3
+bne L366
+cmp *r4, L311
+jsr *r4
+jmp L352
+mov #148, r0
+L277: .data -378, -649
+L278: inc *r2
+not *r3
+jsr *r6
+L279: .data 504, 249, -953
+add r1, *r5
+L280: add L300, *r5
+L281: lea L332, r0
+add L324, *r1
+not L363
+L282: inc L341
+L283: dec L347
+bne L295
+L284: .string "upkucrwawa"
+L285: cmp *r7, r7
+L286: .string "qqctrzmnrhqbhtov"
+rts
+L287: .data 152, 451, -136, 118, 226, -85, -247, 603
+L288: .data 344, -564
+add *r0, L328
+prn *r6
+L289: rts
+L290: dec L336
+L291: jmp *r0
+jsr *r1
+L292: add r0, r7
+jsr *r7
+
+not *r4
+bne L331
+dec r1
+not L327
+; comment
+jmp *r5
+L293: red *r0
+L294: stop
+sub L364, L326
+jsr L338
+stop
+red r4
+bne L350
+L295: .data 201, 820, 892
+L296: add r5, L318
+clr *r5
+L297: bne L331
+L298: inc L362
+L299: lea L316, *r7
+not r1
+L300: .string "of"
+sub *r0, *r6
+jmp L324
+red *r1
+cmp r5, L328
+dec r7
+L301: lea L359, r5
+L302: .data -804, -802, -240, 789, -162, 871, 343, -810
+
+L303: sub L339, r6
+bne *r3
+jsr L365
+lea L355, L352
+sub *r7, *r4
+L304: .data 404
+L305: stop
+L306: jsr L343
+L307: cmp r6, *r6
+jmp *r7
+not L368
+L308: .data -469, -555, -39, 111, 3, 842, 924
+dec *r7
+L309: red r0
+lea L352, *r5
+L310: stop
+L311: inc r6
+jsr L319
+clr r5
+
+jsr *r0
+add L369, *r7
+; comment
+rts
+L312: bne L367
+L313: jmp L330
+mov L322, r7
+L314: rts
+L315: not *r4
+dec r4
+L316: bne *r0
+inc *r5
+dec L339
+prn L323
+cmp *r0, L353
+L317: jmp *r4
+L318: .string "ivs"
+rts
+L319: cmp r7, r0
+bne *r4
+stop
+
+rts
+L320: .data -971, -738, 605
+L321: sub #29, L366
+lea L346, L327
+add *r1, L359
+lea L330, r1
+inc L332
+inc r6
+prn #181
+L322: prn #89
+L323: rts
+cmp #169, r0
+L324: add L358, *r7
+not *r7
+; comment
+L325: mov *r3, L329
+L326: .data 430, -534, 183, 814, -551, -216, 657
+clr L368
+add #-234, r1
+clr r5
+mov #231, L344
+prn r7
+cmp #206, *r7
+L327: cmp #-173, #-11
+L328: not L329
+inc L350
+L329: add #11, *r5
+jmp *r2
+L330: prn r6
+dec *r7
+; comment
+L331: prn L344
+L332: .string "zvwfvh"
+lea L362, *r6
+L333: .data -22, 899, 814, -446, 249, -711, -252
+L334: not L368
+dec r5
+L335: rts
+L336: cmp r5, L353
+L337: clr *r7
+stop
+jmp *r2
+L338: inc r5
+L339: rts
+sub L366, r4
+add #31, r2
+not r2
+jsr L355
+
+
+jsr *r0
+jsr *r1
+stop
+add r3, r1
+jmp *r4
+red *r7
+dec *r7
+; comment
+jmp *r0
+clr *r4
+add #163, *r5
+L340: .string "mgnu"
+L341: cmp *r1, #17
+bne L366
+add *r2, L369
+sub r1, r3
+L342: .data -206, 81, 713, 672, 692
+jmp L368
+L343: jmp L365
+add L364, L355
+sub L368, r3
+prn #20
+L344: .data -889, -159, 389, 811, 901, -11, 253, 321
+clr *r6
+
+L345: inc L349
+red L346
+L346: jsr *r3
+L347: not r6
+L348: prn L361
+L349: bne L357
+L350: sub r0, r6
+inc L359
+L351: mov r1, L366
+L352: not *r5
+red L361
+jsr *r6
+not *r6
+L353: sub #177, *r1
+L354: red r3
+rts
+add *r5, *r0
+jsr *r1
+L355: .data -924, 405, -954, -839, -991
+jsr *r6
+prn L368
+L356: inc r1
+L357: jmp L368
+L358: prn *r4
+L359: not r3
+L360: prn #-226
+prn L363
+stop
+L361: .string "msgfcqtahzagmqybhpuiz"
+sub #106, *r5
+sub r5, r5
+lea L367, *r2
+stop
+inc *r4
+prn r2
+lea L366, *r0
+L362: lea L369, *r7
+L363: red *r3
+L364: red L370
+; comment
+L365: sub *r6, r4
+jsr *r2
+cmp *r6, #231
+bne L368
+clr r2
+jsr L369
+not *r5
+L366: jsr L368
+L367: .data 373, -148, -87, 385, -539
+not L368
+not r7
+dec r1
+inc L368
+cmp L370, *r5
+red *r3
+jmp *r2
+jmp L368
+mov r6, L370
+jsr L370
+inc r1
+not L369
+L368: mov *r5, r1
+red *r4
+rts
+L369: .string "ngvwbiku"
+L370: jmp L18
+sub L220, L98
+jmp *r7
+sub *r3, L171
+red *r6
+jsr L249
+dec *r0
+add L277, *r4
+cmp #-49, #-155
+dec *r4
+not *r7
+cmp r0, L218
+sub #-77, L114
+stop
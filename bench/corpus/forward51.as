@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 52
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+bne *r2
+L0: stop
+cmp *r4, *r3
+lea L69, r4
+L1: .data 563, 919, -306, 906, -230, 133, -719
+cmp *r6, #106
+cmp L129, *r2
+lea L6, *r3
+add L327, r3
+L2: sub L297, L346
+clr L223
+L3: rts
+L4: lea L312, r3
+jmp *r6
+inc L208
+jsr L317
+mov r4, r0
+L5: cmp L215, L355
+sub #-97, L56
+clr r3
+inc L13
+L6: mov r7, r1
+prn #182
+
+add r1, L191
+L7: .string "tmasvqthqoubbzz"
+L8: jsr L193
+add L269, L199
+L9: cmp r2, *r3
+dec r1
+cmp L164, #228
+; comment
+dec *r3
+jsr *r7
+L10: stop
+L11: add *r5, L184
+clr r5
+clr *r2
+clr *r3
+sub *r1, L168
+L12: not L340
+not r6
+; comment
+lea L308, *r0
+L13: .data 779, 458
+L14: .string "sspkjivyekaet"
+L15: .data -974, -492, -178, 621, -205, -163, -400
+L16: stop
+jmp *r2
+L17: bne *r6
+jmp *r7
+L18: .data -899, 478, 682, 373, -338, -507, 352
+L19: .data 180, -860, -246, -981, 792, -159, -876
+red r1
+L20: clr L346
+L21: bne *r7
+dec L337
+L22: mov r7, L181
+mov *r2, r3
+bne *r7
+rts
+jmp L252
+bne *r1
+L23: bne L118
+L24: .string "sqklhcfmujjv"
+jmp L308
+dec r0
+L25: not r1
+rts
+L26: .data -812, 652, 238
+inc r0
+L27: lea L43, r6
+rts
+L28: prn #187
+stop
+stop
+L29: .string "dakalqlcpqufsbtttfyfnpv"
+
+L30: red L241
+stop
+sub *r3, *r4
+L31: jmp L353
+L32: prn #77
+clr L112
+L33: .data 772, -878, 150, 409, 732, 860, 210, -747
+add L210, L174
+; comment
+cmp L191, L119
+inc *r2
+dec L205
+L34: jsr *r0
+L35: .data -722, 46
+inc r3
+add #233, *r2
+stop
+L36: jmp L337
+lea L256, r4
+red L202
+L37: bne L116
+L38: lea L103, r1
+dec r6
+red L95
+add *r6, r7
+lea L191, *r4
+L39: jmp *r6
+inc *r0
+jmp L305
+L40: add r4, r7
+bne L303
+bne L125
+inc *r0
+
+L41: add *r5, *r7
+L42: sub *r0, L266
+stop
+lea L127, *r2
+L43: lea L350, L248
+sub r6, r1
+L44: clr *r2
+stop
+red r6
+red r2
+lea L358, r0
+L45: .data 795, -825, 923, -738, -720, 947, -362
+clr *r1
+add r0, r0
+rts
+dec r6
+rts
+inc L111
+prn r3
+L46: add #149, L100
+add #-52, *r7
+lea L66, *r3
+bne L56
+dec L136
+L47: not r6
+red L245
+cmp #-180, L311
+inc r0
+jmp L93
+
+dec *r1
+stop
+L48: .string "nrlnwqtaenryarkunlbg"
+cmp #6, *r0
+jmp L271
+prn L203
+L49: inc *r1
+; comment
+lea L283, r3
+L50: add *r4, *r5
+L51: inc r0
+L52: cmp L137, #137
+L53: .string "cciurdrtoqcerektd"
+L54: .string "gconysfpuvmslh"
+inc L307
+dec L67
+; comment
+
+inc r1
+inc L286
+L55: inc L283
+add r2, *r6
+jmp *r2
+L56: inc *r6
+L57: cmp #19, #103
+jmp L203
+L58: add *r4, L210
+jmp *r6
+clr r1
+L59: jsr L313
+lea L186, L237
+L60: red *r5
+L61: inc *r5
+cmp r4, #4
+lea L167, r4
+prn L286
+L62: jsr *r1
+L63: lea L341, L169
+sub L144, *r4
+jmp L225
+L64: jmp L176
+L65: prn r4
+bne *r5
+L66: red r1
+jsr L215
+jsr *r3
+L67: clr *r5
+bne L278
+add r1, L198
+L68: cmp L177, L292
+L69: stop
+L70: .data -103, -5, -364, -531
+clr L132
+
+prn r0
+prn *r7
+clr *r3
+clr *r3
+L71: rts
+L72: dec *r0
+L73: rts
+red L223
+L74: clr *r1
+lea L349, *r5
+L75: cmp *r3, #-109
+L76: dec L109
+stop
+inc r3
+bne L148
+L77: inc r5
+sub *r6, r7
+dec L352
+cmp *r1, L312
+
+red *r2
+clr *r0
+inc *r1
+cmp *r7, L152
+L78: not L103
+stop
+add *r4, L131
+bne *r3
+jsr *r7
+rts
+L79: mov #-200, *r7
+cmp r4, L185
+L80: clr r6
+jsr L138
+L81: .data 700, 14
+red L174
+jmp L290
+cmp #-24, r3
+jsr L119
+red L181
+bne L257
+bne L266
+L82: cmp #87, *r3
+red L262
+not r1
+L83: .data 238, 247, -816, -719
+add r3, r3
+rts
+jsr L129
+bne *r4
+bne L258
+clr *r2
+red *r7
+L84: lea L329, *r2
+rts
+cmp r0, L171
+L85: inc L210
+cmp #107, r5
+L86: clr r3
+
+jsr L92
+bne L261
+L87: .string "qxqpvtlmdvecn"
+lea L332, r0
+L88: .string "jhhsujokqls"
+L89: add r5, r3
+mov L282, r3
+jmp *r5
+red *r7
+sub #47, L294
+L90: jmp *r4
+L91: .string "dbtvqgcjitdbiatmxu"
+L92: rts
+rts
+sub *r2, L227
+clr r4
+L93: .string "gcvzv"
+L94: stop
+mov #-88, r6
+jsr *r2
+; comment
+mov r3, L203
+jmp L213
+mov *r3, *r2
+L95: sub #110, L219
+L96: stop
+prn L334
+jmp L167
+L97: .data 345, 825, 320, -801, 72, 622, 807, -366
+stop
+stop
+lea L262, *r2
+L98: cmp *r7, L167
+add *r5, L327
+; comment
+L99: not *r1
+L100: clr r1
+jsr L322
+red L173
+jmp *r0
+L101: add L237, r1
+L102: .string "ddpdmdbladuuejmg"
+sub #-72, L120
+L103: red r6
+
+jsr *r0
+bne *r5
+jsr L229
+prn #-50
+L104: prn L279
+inc r1
+add *r2, *r1
+cmp #148, r7
+not r7
+L105: red r0
+L106: .string "xvmygccsgznxqsc"
+clr L127
+lea L274, *r5
+L107: .string "jwokorylmryevv"
+rts
+prn #123
+L108: .data 721, -240, 547, -993, 837, 152
+not *r4
+stop
+; comment
+add r6, L130
+L109: mov #158, L129
+add L312, r6
+mov *r7, *r3
+jmp *r6
+mov *r2, *r5
+prn #123
+add r7, L172
+mov *r3, r1
+dec *r0
+dec *r3
+
+L110: rts
+L111: mov r4, *r3
+L112: mov #89, *r5
+lea L218, L300
+L113: rts
+cmp *r0, #-152
+red *r2
+L114: lea L188, *r1
+clr r4
+jsr *r4
+cmp *r2, r7
+L115: dec *r1
+L116: add *r4, L120
+bne L293
+jmp *r4
+stop
+; comment
+dec r2
+stop
+lea L250, *r6
+rts
+L117: .string "ungikvlioz"
+L118: cmp #-120, #198
+L119: .data -75, -73, -423
+stop
+L120: .data 152, -709, 904, 659, 377, -696, 702, 200
+L121: not *r3
+L122: prn #47
+add #-208, L263
+dec L302
+L123: inc r0
+bne *r2
+; comment
+rts
+L124: add *r1, r6
+prn #248
+add *r4, r5
+L125: add r3, L325
+stop
+L126: cmp L259, #6
+L127: cmp *r1, r3
+L128: red *r2
+L129: red r1
+L130: lea L269, *r0
+prn L171
+dec *r5
+red *r1
+L131: prn L265
+rts
+red *r5
+prn *r3
+inc r7
+L132: .data 223, -265, -269, -451, 792, 564, -334
+
+L133: .data -363, 924, 512, -108
+L134: dec *r5
+not r1
+L135: jsr *r7
+L136: jsr *r6
+clr *r5
+L137: .data -654, -395, 773, -557, 310, 949, 222
+L138: dec r1
+mov *r3, *r4
+L139: .string "p"
+
+L140: inc *r3
+jsr *r1
+red *r5
+lea L221, *r6
+bne *r7
+L141: bne *r5
+stop
+L142: add *r4, r1
+lea L212, *r2
+rts
+clr L155
+L143: prn *r6
+inc *r4
+
+
+
+dec L355
+L144: mov #-159, r6
+lea L222, L179
+cmp *r1, r7
+L145: .data -133, 952, -441, -519, 757
+prn r2
+red L325
+jsr L315
+stop
+dec r2
+inc L278
+inc r5
+L146: .string "qd"
+L147: sub *r3, L188
+not r3
+L148: inc L245
+bne *r4
+inc *r7
+; comment
+L149: .string "pkcvynrggeofjcwwykjo"
+L150: prn L241
+L151: jmp *r5
+; comment
+L152: .data -777, 431, -234
+add #-135, *r3
+dec L320
+jsr L208
+cmp *r3, #-243
+red L164
+L153: .data 45
+L154: mov r6, L229
+L155: jsr *r7
+inc r3
+stop
+stop
+red L248
+jmp *r5
+; comment
+lea L316, L318
+red L254
+mov r3, *r5
+L156: prn #-69
+L157: sub L204, *r7
+L158: inc L275
+
+L159: not r3
+inc *r5
+L160: .string "skdnph"
+L161: red L273
+
+jsr L221
+add r6, r0
+L162: jsr *r7
+L163: jmp *r7
+sub *r7, r7
+L164: .string "sswuzhf"
+inc L169
+clr *r6
+inc r4
+L165: rts
+dec *r5
+sub r6, r0
+dec L293
+jsr *r5
+L166: bne L209
+lea L244, *r1
+L167: jsr *r3
+red *r0
+dec r4
+prn *r1
+L168: .data -896, -311, 168, -953, 798, 997, 620
+L169: clr L311
+
+L170: jmp *r3
+
+L171: rts
+L172: sub L334, L323
+L173: .string "ytxywqxcnorinixhgb"
+L174: cmp r3, *r7
+L175: .data 256, -331, 246, 847, 844, 515
+inc *r3
+jsr *r4
+cmp L224, L201
+inc *r1
+clr L229
+L176: .string "dpmvavauvdgnl"
+add #-77, r2
+L177: stop
+L178: bne *r5
+L179: bne L259
+L180: not *r1
+inc r5
+not r3
+jsr *r2
+
+L181: .data -35, 36
+L182: dec r4
+bne L284
+red r5
+jsr *r2
+rts
+L183: .string "kf"
+sub L278, *r3
+jmp L259
+L184: .data -602, 203, -230, 293
+jmp *r7
+sub r3, r5
+L185: sub *r7, r2
+L186: rts
+jsr *r7
+L187: jmp *r3
+; comment
+
+dec r4
+L188: lea L353, r5
+L189: .data 768, 302, -869, 807, -745, 734, 502
+jsr *r7
+L190: cmp #-96, #-69
+L191: .data -397, 430, 969, 23
+clr L338
+not *r1
+add L278, *r1
+L192: rts
+L193: lea L264, *r1
+dec r2
+jmp L313
+stop
+dec r1
+clr L206
+L194: jmp *r1
+lea L347, L242
+cmp *r6, #-137
+jmp *r5
+L195: not r7
+jmp L240
+rts
+L196: .data 976, -171, 209, 422, 96
+dec *r0
+rts
+sub *r6, L274
+jmp L257
+L197: jsr L298
+L198: .data -791, -477, 394, -489, -875, -510, -56, -188
+lea L294, r4
+mov r4, L254
+rts
+L199: .string "aidzuywvepweuslfviamiuuj"
+L200: jsr L342
+L201: jsr L223
+jmp *r3
+rts
+
+mov r6, r4
+rts
+L202: .string "frylafl"
+add #-238, r0
+lea L263, *r7
+L203: .data -992, -634
+prn *r0
+L204: sub r1, r0
+L205: .data -420, 231, 979
+L206: stop
+bne *r0
+L207: cmp #-249, L241
+add r0, r5
+rts
+inc *r2
+not r7
+jsr L316
+L208: add #197, r3
+L209: .string "fzffvsngawslasb"
+prn #-132
+dec L265
+add r3, r0
+rts
+L210: .string "qfogebcxcu"
+; comment
+L211: bne L331
+sub r0, L323
+sub r3, *r5
+L212: red r1
+inc *r7
+L213: .string "fmlfcnjjg"
+prn *r6
+sub r3, r5
+inc r5
+bne *r4
+add L265, *r0
+L214: jsr L239
+
+L215: clr L266
+not r3
+jmp L218
+L216: .data 606
+rts
+cmp *r1, r1
+L217: not r2
+jmp L284
+add *r5, *r4
+L218: not L299
+red r1
+jsr L357
+bne L282
+mov *r5, L267
+stop
+prn r2
+red r1
+prn #1
+jsr L253
+jmp *r1
+red *r5
+L219: .data -400, -232, -148
+not r4
+L220: jmp L251
+cmp #-25, *r4
+L221: stop
+red L357
+add #198, L353
+sub r4, L224
+red r3
+jmp L353
+L222: inc *r0
+lea L301, L235
+L223: prn *r2
+red *r5
+L224: rts
+add L327, L257
+bne L303
+inc *r0
+lea L276, *r1
+L225: stop
+inc r7
+L226: .data 135, 647, -101
+clr *r4
+inc r2
+L227: add r2, *r5
+add L230, *r4
+mov r2, r6
+jsr *r4
+L228: bne L248
+rts
+L229: .data -787, 262, -659, 882, -7, 893, 535, 965
+L230: jsr L334
+L231: stop
+L232: .string "iodwrudunzisefscbfbpnjr"
+red *r6
+; comment
+lea L301, L297
+inc *r5
+red L288
+L233: .string "pgzwqnuyxkwsqsieszpmgd"
+stop
+jmp *r0
+clr *r7
+
+L234: add L340, r4
+L235: inc L308
+not r5
+stop
+sub L242, L341
+jsr *r4
+L236: bne L269
+sub *r3, r6
+L237: inc r5
+L238: red L261
+inc *r7
+; comment
+lea L261, *r0
+bne *r3
+L239: .string "czydwmmesyervr"
+not L280
+prn L347
+rts
+L240: clr L348
+red L356
+L241: jsr *r2
+sub r4, L266
+L242: sub r1, r7
+; comment
+L243: bne *r4
+mov *r3, L263
+L244: jmp L286
+rts
+rts
+clr r7
+; comment
+
+stop
+bne L298
+L245: .string "pqbiexzxgnphtmdq"
+L246: prn L294
+L247: clr *r5
+red *r2
+inc *r2
+rts
+jmp L319
+lea L312, *r5
+inc *r6
+L248: .data 719, 733, 869, -65, -877
+; comment
+cmp L331, #53
+jsr *r5
+jsr L351
+jmp *r6
+L249: lea L268, *r7
+clr r0
+L250: clr L284
+bne L339
+
+bne L257
+dec L334
+L251: jmp *r5
+stop
+L252: stop
+lea L311, *r4
+bne L335
+stop
+lea L307, r6
+inc *r1
+add #-52, *r3
+; comment
+; comment
+mov L276, L348
+L253: bne *r6
+; comment
+rts
+jsr L349
+L254: red r3
+L255: not r5
+L256: rts
+mov *r1, L334
+mov #-130, L288
+L257: add *r1, r7
+bne *r0
+
+not *r6
+not r1
+lea L291, L343
+L258: stop
+L259: cmp r5, L286
+red r0
+lea L317, *r4
+L260: jsr L303
+L261: .data -108, 716
+L262: inc r5
+jmp L344
+stop
+L263: not *r7
+clr *r4
+bne L281
+L264: .string "lwpqkxuo"
+jsr L340
+red L284
+jsr *r0
+lea L356, r0
+L265: rts
+L266: rts
+not r6
+stop
+L267: inc *r2
+jsr L346
+L268: stop
+L269: jsr *r3
+not L328
+lea L315, r1
+inc r7
+not L342
+mov r4, *r2
+L270: not *r4
+prn *r2
+L271: mov r6, *r7
+lea L337, L277
+L272: dec r7
+lea L334, *r6
+inc r3
+L273: lea L282, *r3
+prn L286
+L274: .string "bwi"
+cmp L345, L342
+add L302, *r5
+L275: .data 333, -960, -375
+dec *r6
+jsr L321
+L276: red *r1
+L277: sub *r3, r6
+not *r4
+sub L356, L313
+
+add L302, r2
+L278: add L332, L315
+rts
+red L356
+; comment
+L279: mov #-155, r6
+L280: mov L297, *r3
+sub #213, r2
+jsr L316
+jmp L287
+rts
+L281: .string "gipodgsfqbgavsca"
+L282: dec *r4
+jmp *r1
+not L296
+add L318, r3
+mov *r1, *r6
+L283: stop
+L284: red r1
+clr r6
+L285: lea L311, *r5
+dec r7
+L286: prn L355
+L287: .data -584, -126, 149, -587
+jsr L330
+dec r7
+L288: not r5
+L289: sub L322, r3
+L290: sub r3, L305
+clr *r2
+dec *r0
+clr r1
+red *r0
+L291: dec r0
+clr r3
+L292: stop
+L293: not *r4
+bne *r5
+dec *r2
+mov r5, r3
+L294: .string "qtmojtqwkfakccxlb"
+L295: red r1
+red r3
+not r3
+L296: .string "drjesc"
+L297: red *r6
+bne L314
+L298: .string "ghqbgnkgyztfmiprhdiognam"
+L299: .data -147
+L300: add #-79, *r1
+L301: stop
+jmp L310
+L302: rts
+clr r2
+red *r3
+sub #167, *r0
+L303: inc L304
+dec *r3
+L304: .data 774
+jsr L354
+L305: jsr *r4
+add #-190, r7
+L306: .data -692, -815, -466, 1
+L307: mov L324, *r2
+not r4
+clr L321
+L308: not L316
+L309: sub r0, L337
+L310: red *r2
+; comment
+lea L351, r4
+L311: .data -514, -30, -259
+L312: sub r1, r6
+L313: jsr *r0
+L314: jmp *r6
+prn #-205
+L315: not r7
+L316: .data -686, 732, -172, 218, 474, 90, 437
+inc L335
+bne L348
+bne L328
+rts
+add *r1, *r2
+L317: .data 732, 841, 170, -832
+inc r5
+clr L355
+red r5
+L318: .string "jzzixp"
+L319: cmp #202, L338
+sub L335, *r0
+L320: rts
+L321: sub *r4, r0
+inc r1
+L322: clr L343
+
+L323: .data -628, 949, -667, 784, 886, 1
+jsr L329
+
+L324: prn r1
+mov *r6, L354
+L325: jsr L326
+sub L336, r7
+L326: cmp L354, #-35
+jsr L350
+dec L351
+mov r5, r1
+L327: .string "mapgcsdeygaguvrckokqneh"
+add *r7, r7
+rts
+inc *r1
+; comment
+not L328
+; comment
+jmp *r6
+L328: bne *r7
+L329: dec *r4
+red *r1
+not L356
+clr r2
+clr *r0
+lea L332, *r4
+rts
+; comment
+clr L333
+bne *r4
+L330: jsr *r0
+red L341
+mov L356, *r7
+L331: .data 38, 311, 861
+L332: not L353
+prn r3
+L333: red L353
+L334: lea L354, r0
+inc L340
+prn #176
+dec L340
+cmp #-115, r7
+
+lea L350, L352
+L335: stop
+add r2, *r1
+
+inc L358
+L336: dec L350
+cmp r5, r6
+inc r5
+bne L348
+L337: stop
+L338: rts
+L339: not r3
+L340: lea L348, r4
+cmp *r5, *r7
+bne L355
+sub r1, L353
+lea L342, *r5
+L341: .data 665, 12, -239, 593, -905
+L342: .data 206, -326, -928, 284, 505, 840, 580, 495
+dec L357
+clr r3
+mov *r5, *r7
+L343: jmp *r5
+clr r1
+L344: .data 971, 290, -495
+clr L351
+prn *r2
+jmp *r4
+L345: jmp *r5
+L346: lea L357, L351
+L347: rts
+L348: lea L355, L358
+bne *r5
+jsr *r5
+stop
+L349: .data -294, 17, -833, 415
+jsr *r3
+clr *r5
+jmp *r0
+stop
+L350: .data -58, 683
+stop
+not *r0
+sub *r6, *r2
+L351: stop
+mov L356, r2
+lea L353, r7
+L352: .data -261, 540, 399, -643
+L353: dec L356
+L354: jmp *r5
+L355: mov *r0, L356
+L356: jsr L358
+add L358, r2
+not L358
+L357: clr L358
+
+lea L358, *r7
+L358: mov *r7, r7
+sub L72, r1
+red r4
+stop
@@ -0,0 +1,1026 @@
+; Generated by genCorpus --seed 53
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+; comment
+dec r3
+L0: red L216
+mov #-150, *r3
+L1: stop
+L2: stop
+lea L17, *r4
+jmp *r4
+L3: add L83, L19
+not r3
+bne L8
+cmp L320, *r5
+L4: .string "wdkovxaspis"
+not L28
+jmp *r6
+L5: red r7
+L6: jmp L41
+dec L168
+L7: inc *r3
+stop
+L8: .data -388, -487
+rts
+L9: lea L291, r5
+L10: clr r4
+L11: dec L239
+dec r2
+dec L356
+L12: .string "hbdunqg"
+L13: lea L231, *r7
+L14: mov r5, *r0
+jsr *r2
+jsr L42
+L15: .string "pxtc"
+L16: bne *r1
+L17: bne *r0
+L18: dec *r6
+L19: .data 699, 470, 560, 859, -484, -131, 805
+L20: .string "achpqcveo"
+prn L53
+L21: lea L324, L303
+inc L158
+L22: .data -35, -630, 23, -147, -282
+L23: .string "ztd"
+bne L44
+add L304, L303
+sub *r7, L42
+jmp *r3
+L24: sub r7, *r0
+red *r3
+dec L309
+inc *r7
+prn r2
+clr L61
+jsr *r0
+L25: .data -700, 606, -245, 887, 275
+clr r7
+L26: .data -837, 491, -579
+rts
+L27: clr L198
+stop
+sub r1, L354
+red *r5
+rts
+clr r5
+
+L28: cmp *r2, r1
+add *r6, r4
+mov *r4, r0
+add r3, r4
+sub L120, r2
+jsr *r4
+L29: .data -202
+L30: jmp *r7
+L31: .data 277, 444, 917, -689, 988, 562, -151, -365
+L32: bne L163
+jmp L146
+L33: cmp #-77, r1
+L34: mov L136, L204
+clr r2
+cmp *r6, *r7
+stop
+L35: bne L234
+inc r1
+stop
+stop
+L36: .data -960, -228, -256, -991
+jmp L67
+cmp L44, L224
+dec *r1
+red L328
+L37: .data -880, 220, 173, 269, -530, 848, -636
+add r7, r6
+L38: clr L78
+mov *r2, r5
+L39: rts
+L40: inc r6
+L41: rts
+L42: .data -425, 719, -94, -183, -366, 475, -85, 870
+bne *r0
+L43: .data 995, -809, -32, 993, -781, 439, 763
+cmp #-53, *r5
+stop
+lea L322, L126
+not L96
+stop
+add #223, L370
+clr *r2
+not *r3
+rts
+bne L359
+sub *r3, L80
+
+L44: .string "vvmtwrrh"
+L45: .data -858
+L46: add L48, L320
+L47: lea L277, r1
+stop
+L48: prn L245
+jsr L261
+bne *r7
+stop
+L49: .string "xquyakswwjprioqbtil"
+
+bne L67
+lea L247, L132
+L50: jsr *r0
+clr r2
+jmp L96
+; comment
+bne L165
+prn #148
+L51: stop
+L52: jsr L356
+L53: mov #-186, L142
+
+bne *r0
+bne L262
+red r1
+rts
+L54: rts
+L55: rts
+L56: bne L306
+L57: prn L267
+L58: sub r2, r2
+inc *r7
+L59: mov L214, r0
+
+L60: .data 136, 999, -550, -312, -480, -398
+L61: dec *r6
+clr *r4
+jmp *r3
+L62: .string "bmwuchyqayspzmlhbxqjsz"
+red *r1
+cmp L103, L67
+lea L167, *r1
+dec *r7
+L63: lea L257, L319
+jmp *r0
+cmp L345, *r6
+L64: bne L227
+rts
+jmp *r2
+dec r6
+clr r3
+L65: clr r6
+mov r5, L81
+L66: .data 364, 234, 41, -201, -589, -321, -304, 930
+sub *r1, r1
+rts
+cmp r3, #-69
+L67: lea L289, r7
+add r1, L327
+inc *r2
+L68: not r3
+L69: stop
+L70: mov #250, L88
+L71: .data 728, -108, -636, 482
+jmp *r4
+L72: .string "lphhfkdlpkxskerolomonqru"
+clr r2
+prn L94
+red r0
+red *r0
+dec L195
+L73: add L219, r3
+L74: prn #-67
+L75: jsr L91
+L76: rts
+mov *r5, L101
+L77: mov #-4, L122
+lea L328, *r3
+cmp L266, *r2
+L78: not *r3
+L79: .data -372, 898
+L80: .string "gpxcgxcgqzzinclr"
+sub *r7, *r1
+bne L188
+L81: .string "i"
+L82: .data 794, -639, -544, 323, -376, -236, -83, 794
+L83: inc r4
+lea L369, r3
+L84: .data -917, 193, -949, -502, -638
+L85: .string "fpesllzsvyngnfty"
+L86: stop
+prn r7
+clr r0
+dec L207
+not L147
+L87: .string "tngxdzldmere"
+L88: prn #-213
+mov #-63, *r5
+
+L89: stop
+add L114, r1
+L90: cmp r5, L371
+L91: not *r3
+L92: jmp *r7
+inc L146
+stop
+dec r1
+stop
+jsr L189
+dec r1
+add L146, *r4
+jmp *r1
+lea L300, r4
+L93: .data -80, -930, -13, 651, 856, -156, 317
+inc r0
+mov *r4, r0
+rts
+mov *r5, r6
+dec L334
+lea L114, *r6
+lea L263, r0
+not *r2
+L94: clr r7
+L95: inc *r4
+add *r7, *r2
+sub #-235, r5
+L96: red L139
+add *r6, r3
+L97: cmp *r6, *r3
+not L136
+L98: clr *r4
+sub #152, *r4
+L99: add #-82, L286
+L100: stop
+L101: red r6
+jmp L235
+bne L190
+jmp L208
+sub #96, L333
+L102: .data 578, -237, 555, 943, 456, 360
+prn #-141
+L103: dec L150
+mov #16, L143
+L104: inc *r7
+jsr L218
+inc *r7
+not r7
+jsr L257
+prn *r7
+clr r4
+jsr L205
+inc r7
+L105: .string "foeysq"
+
+bne L265
+dec *r6
+L106: lea L332, r0
+not *r6
+L107: dec r5
+add L251, *r4
+L108: .string "fnreezqlndltwvztt"
+L109: .string "awlfnicgubsmtzicoqnnckho"
+L110: stop
+add r1, *r2
+L111: prn *r3
+jsr *r2
+lea L194, r6
+not r0
+L112: bne L174
+inc r2
+add L355, L270
+
+jsr L113
+L113: add L357, L228
+stop
+cmp *r4, *r3
+L114: .string "xmkmauqdqtirechky"
+jsr L290
+add L358, *r2
+not L190
+bne L299
+L115: .string "vglgsjrwjkbpdktwafvezqxd"
+L116: jsr *r7
+clr L118
+sub *r4, L117
+; comment
+L117: prn L134
+lea L190, *r4
+dec r2
+clr L286
+clr *r7
+red r3
+inc r6
+L118: cmp #-140, *r2
+L119: prn #-207
+prn *r6
+dec *r6
+L120: sub *r6, r3
+L121: add L228, L251
+stop
+L122: jmp L284
+cmp *r5, *r4
+add *r0, L198
+add *r7, r4
+dec L295
+inc *r6
+L123: cmp #-52, #-57
+L124: not *r2
+; comment
+L125: jsr *r4
+L126: bne L354
+stop
+L127: not L161
+prn r7
+bne L138
+L128: prn #183
+L129: sub r0, *r2
+bne *r0
+jsr L288
+; comment
+bne L320
+sub L366, r2
+L130: .data 313, -778, 870, 858, 281
+L131: sub L186, r4
+L132: lea L209, L263
+cmp r7, L349
+L133: inc L140
+prn L358
+; comment
+L134: jsr L364
+mov #-229, *r5
+L135: stop
+L136: stop
+L137: clr L179
+rts
+prn r6
+red *r2
+not L312
+prn r4
+not *r2
+sub r0, *r0
+lea L228, r5
+dec r4
+L138: lea L226, r4
+inc L288
+sub r2, L342
+L139: jmp L330
+stop
+sub *r7, *r6
+L140: clr r0
+L141: inc L244
+add #115, r7
+bne L351
+dec r3
+lea L326, r7
+L142: red *r3
+L143: add *r5, L338
+cmp #8, L347
+not L366
+L144: .string "wnnllhxupxgzthzypomktbhj"
+mov *r3, L245
+L145: .string "jdkdhboaixyntxusgtzupbhc"
+add *r1, *r1
+L146: jsr L367
+sub r2, *r3
+jmp L225
+cmp #209, #73
+L147: .data -950, -678
+L148: bne L269
+jmp L232
+add L282, r2
+not L230
+not r6
+bne *r6
+L149: mov L341, L211
+L150: not L195
+L151: inc L352
+L152: clr r5
+L153: .string "rzdhkxpugbckhxrws"
+stop
+jmp L286
+L154: stop
+inc r3
+bne L236
+stop
+jmp L359
+inc L213
+red *r3
+add r0, L310
+L155: prn #-182
+L156: sub r3, *r3
+L157: bne *r5
+red r4
+dec L295
+L158: lea L357, r3
+red *r0
+rts
+L159: prn r1
+inc L210
+L160: inc *r3
+; comment
+L161: .data -158, 409, 866, 72
+mov *r4, *r6
+red *r0
+L162: stop
+
+mov #-201, r0
+inc L343
+jsr *r1
+sub *r7, r6
+rts
+L163: inc L246
+cmp *r7, r7
+prn #160
+L164: stop
+L165: dec L346
+L166: sub *r5, r6
+; comment
+lea L330, L254
+L167: .string "syho"
+L168: red *r5
+rts
+bne L231
+rts
+clr *r2
+dec *r2
+bne L372
+L169: jsr L225
+L170: clr L193
+not *r6
+L171: .string "kvcwjomddsnjistt"
+red r0
+clr L323
+dec r0
+L172: add *r3, L360
+inc *r3
+L173: sub #174, L324
+lea L183, r3
+L174: jmp L303
+jmp *r5
+L175: prn #107
+L176: mov #-250, r4
+red r2
+rts
+L177: .string "tayqv"
+L178: .string "crfoct"
+cmp *r3, r3
+L179: dec r1
+jsr *r3
+; comment
+inc L346
+red L284
+prn #255
+L180: inc L207
+L181: clr r4
+jmp L246
+L182: .data 375, -516, -704, -2
+cmp r7, L206
+L183: stop
+cmp #61, #76
+L184: not *r1
+dec r4
+L185: .data -94, 979, 939, 484, 612, 116, 916, -476
+prn *r2
+stop
+prn #73
+mov *r6, *r1
+lea L363, r7
+stop
+L186: prn #-2
+jsr *r7
+L187: lea L271, L372
+sub L266, *r1
+cmp L243, *r1
+L188: .string "iys"
+dec L312
+bne L193
+; comment
+L189: jmp *r5
+stop
+L190: stop
+L191: lea L308, *r1
+not r7
+mov r2, *r1
+sub L349, r3
+bne *r0
+lea L322, L369
+jmp L196
+rts
+rts
+clr r4
+L192: .string "jlafdxokeduzpluzb"
+not L264
+
+
+cmp *r1, r4
+clr *r1
+not *r0
+red r3
+
+L193: jsr *r4
+; comment
+L194: .string "muollvsthoobpipe"
+cmp *r1, L266
+clr *r6
+
+L195: .data -270, 185, 228, 567, 38, 602, -288, -919
+L196: add *r4, L299
+bne L224
+add r3, *r3
+add r6, *r6
+stop
+dec r2
+add L227, r1
+L197: sub #-233, *r4
+dec L358
+not L198
+L198: clr L273
+bne L253
+add L209, *r7
+L199: not L327
+not *r6
+L200: .data -410, -687, 764, 679, 951, -602
+stop
+L201: red r0
+L202: stop
+not r6
+L203: cmp #126, r5
+L204: inc L345
+L205: .data 589, -802, 394, -586, 249
+lea L210, r5
+sub r3, L233
+dec *r1
+dec L248
+L206: not *r0
+
+add *r4, *r5
+
+L207: add L251, *r1
+L208: cmp #-200, r2
+L209: rts
+cmp r1, #-11
+L210: mov L364, r1
+clr *r5
+inc L308
+L211: dec *r0
+L212: not *r0
+L213: inc L323
+add L351, L256
+clr *r7
+clr *r6
+L214: bne *r2
+L215: .string "xqitncjwfiesemg"
+L216: jsr *r2
+rts
+sub L358, L320
+rts
+L217: .data -998, 971, -782, 435
+clr *r6
+add #-127, *r4
+sub #-40, L239
+prn r1
+L218: lea L256, r3
+bne *r7
+cmp r4, #66
+red *r6
+L219: clr r7
+L220: jmp *r1
+sub *r0, L366
+L221: .string "uoswiknrnipax"
+add r5, r4
+clr *r5
+inc *r4
+lea L240, *r7
+L222: mov L341, *r0
+mov L363, L335
+lea L371, *r1
+L223: add L316, *r6
+L224: .data 394, -706, -403, 144, -452, 947, 928, -223
+L225: bne *r0
+L226: jmp L276
+L227: lea L256, *r3
+L228: red *r4
+mov *r4, L312
+L229: .string "kzmfreprdujwxaxgcpiaxua"
+L230: .string "rgqpfgkogz"
+L231: clr r4
+L232: red r2
+L233: cmp L290, #-230
+mov L313, r2
+mov *r3, *r0
+L234: jsr *r7
+lea L253, r0
+sub #-122, *r3
+L235: dec *r5
+add r6, *r6
+L236: jsr *r0
+L237: lea L322, *r1
+L238: dec r1
+L239: sub *r4, *r4
+cmp L274, L281
+prn #129
+red r0
+L240: jsr *r0
+L241: .data 530
+sub *r5, r5
+lea L249, *r7
+cmp #-180, r5
+
+L242: .data -634, -1, -646, 598, -650
+L243: .data -432, -442, 248, 499, 195, -46
+not r5
+prn r2
+L244: .string "pi"
+not *r7
+sub r0, *r2
+L245: prn L321
+clr *r4
+L246: jmp L330
+
+L247: .data -376, 462
+L248: not L301
+rts
+L249: prn L342
+; comment
+L250: clr L342
+not *r5
+stop
+L251: .string "jhjfcqfmlgrgtlfyvzl"
+L252: .data 643, 694
+red *r6
+add #79, *r1
+L253: .data 619, 748, 667, 310, -322, -435, 576
+L254: jmp L329
+L255: .data 752, 368
+rts
+L256: .data -235, -22, 704
+L257: cmp r2, *r0
+rts
+L258: .string "yrwosqnjzljxplzjwycjcd"
+L259: prn *r0
+sub r1, L334
+L260: red L337
+jsr *r5
+
+stop
+jsr L330
+mov L352, L261
+rts
+; comment
+dec r7
+prn r2
+clr *r2
+jsr *r4
+rts
+clr L344
+L261: not r7
+inc r3
+L262: red *r0
+jmp L294
+cmp r0, #26
+L263: jsr *r6
+dec *r0
+jmp L361
+dec r3
+cmp r5, *r1
+L264: add L359, r1
+lea L290, L275
+L265: .string "ewpr"
+cmp #160, L322
+add L351, *r3
+L266: jmp L300
+L267: .data 16, -101, 359, -123, 778, 833, 959
+L268: .string "gvnfcnge"
+L269: jsr L281
+prn *r1
+L270: prn *r6
+mov *r6, r2
+L271: .data -867, 739, -599, 146
+L272: .string "kzsopipnmcffre"
+red L312
+prn *r7
+jmp L336
+red L298
+mov L353, *r5
+
+inc r6
+prn #46
+L273: jmp *r5
+dec r2
+jmp L291
+sub *r3, r4
+cmp L326, *r5
+rts
+L274: .data -754, 923, -831, -608, -180
+not *r2
+red *r4
+dec L275
+lea L329, L303
+bne L303
+inc *r6
+clr r7
+L275: .string "jcqnptokemlpzegteob"
+lea L285, r3
+L276: inc L318
+dec r3
+inc r6
+; comment
+jmp *r0
+mov *r4, *r5
+mov r0, r7
+add L319, r5
+stop
+L277: mov #-66, *r3
+cmp r6, r0
+dec *r7
+L278: cmp *r0, r1
+not r0
+stop
+L279: jmp *r6
+cmp #-143, r5
+clr r6
+L280: .data -500
+L281: stop
+L282: mov #-21, r3
+L283: prn r2
+cmp #-150, *r4
+jsr *r3
+rts
+jmp L369
+L284: clr L360
+add r6, L289
+inc *r6
+stop
+
+dec L302
+add *r5, r3
+L285: jsr L372
+L286: prn r7
+L287: add #-193, L339
+jsr L356
+sub *r7, *r4
+rts
+bne *r1
+stop
+sub *r6, L331
+sub L344, L365
+bne *r0
+mov r2, L330
+L288: rts
+L289: not *r1
+L290: rts
+dec *r4
+L291: clr r1
+L292: clr L361
+mov *r6, *r1
+L293: add #11, *r5
+bne *r6
+red L360
+L294: .data 912
+L295: .data -108, -904, -232, 311, -160, -879, -222, 9
+L296: .string "cqhyedljliujgeqeassanp"
+jsr *r1
+L297: dec L361
+cmp L349, *r3
+L298: stop
+L299: .string "oukyrwrohnewecy"
+L300: inc L368
+L301: rts
+sub L353, L364
+bne L362
+rts
+prn L335
+L302: not r3
+red *r3
+lea L305, *r7
+cmp #186, #20
+sub *r4, *r1
+L303: jmp L348
+sub L335, *r3
+L304: .string "lepmixmsj"
+L305: clr L322
+not r7
+bne *r3
+dec L321
+inc *r2
+not L338
+L306: inc L364
+not r0
+clr *r0
+L307: .string "aiequrxut"
+rts
+L308: .data -555, -477, 478
+stop
+bne *r5
+inc *r5
+rts
+L309: red *r5
+L310: lea L333, L340
+cmp r3, r6
+inc r2
+stop
+jmp *r0
+jmp *r1
+; comment
+lea L352, L346
+add *r0, L337
+L311: add *r2, *r1
+rts
+L312: lea L352, L331
+L313: not *r6
+inc r3
+sub *r1, *r6
+L314: inc *r7
+sub r2, L371
+mov *r6, *r2
+L315: stop
+add #-79, L359
+add L321, L329
+clr *r2
+jsr L364
+jsr *r5
+add #207, *r5
+L316: sub L353, L344
+L317: prn r1
+rts
+jsr *r4
+jmp L339
+jsr *r5
+L318: .data -501, 42, 136, 718
+bne *r2
+L319: .string "uldtwbosunzsyfejiwafntya"
+stop
+not *r5
+bne L347
+L320: jsr L364
+sub #203, r7
+; comment
+jmp *r4
+stop
+add #107, *r4
+L321: not *r1
+L322: jsr *r5
+; comment
+inc *r3
+sub *r5, r6
+L323: cmp *r4, #-105
+L324: .string "kwjhmfmpseekje"
+mov L339, *r7
+L325: dec *r0
+red *r1
+L326: cmp *r6, r2
+L327: rts
+mov #145, r7
+dec r3
+sub r6, L336
+red r5
+prn *r5
+jsr L333
+prn L346
+stop
+add *r5, L370
+L328: .string "nikld"
+jmp *r4
+dec L350
+red *r3
+jsr L343
+L329: jmp L348
+; comment
+dec *r3
+clr r6
+rts
+add #71, L335
+rts
+not r3
+prn *r5
+L330: sub #95, *r2
+rts
+; comment
+stop
+inc r6
+add *r5, L336
+jsr L339
+rts
+not L334
+L331: mov r7, *r5
+L332: jmp *r4
+L333: jmp L346
+clr *r6
+bne *r5
+L334: prn *r6
+jmp *r4
+L335: .string "zgafafvkmdrpggmt"
+clr *r2
+clr L349
+sub r3, r5
+; comment
+clr r0
+clr *r5
+L336: inc L369
+L337: bne L355
+inc L368
+L338: jmp L368
+L339: clr L362
+bne *r5
+sub *r6, *r3
+L340: sub #133, r1
+L341: .data -557, 944, 698, 553, 376, 623, 492, -980
+stop
+L342: cmp L353, #247
+L343: dec *r2
+L344: mov #-28, L348
+prn L347
+L345: bne L359
+stop
+L346: stop
+jmp *r5
+jmp *r7
+L347: rts
+L348: .string "urokntakhxzvkcowyvzytr"
+clr r0
+L349: clr r7
+L350: .string "yghggqqvyhvdldfusrddllue"
+mov #-27, r2
+L351: prn r7
+jmp L368
+inc r4
+; comment
+jsr L369
+jmp *r2
+L352: dec L371
+L353: add *r4, L366
+
+bne *r1
+L354: add #26, *r3
+L355: not L357
+; comment
+red r1
+sub *r0, *r5
+L356: .string "lrwkerjgygixmsm"
+L357: inc L370
+L358: stop
+add L360, *r6
+L359: stop
+jsr *r4
+
+L360: .string "whywceesjiklldttc"
+cmp r5, r5
+jsr *r6
+L361: not *r2
+inc *r4
+stop
+inc *r6
+clr L362
+clr *r3
+L362: sub r1, L365
+red r4
+lea L363, *r1
+cmp r3, *r0
+add r1, *r0
+L363: stop
+sub r1, *r2
+red L370
+lea L364, L367
+L364: .data 462, -993, -267, 668, 646, -549
+cmp *r4, *r2
+L365: .data 263, -57, -450
+
+L366: .string "d"
+L367: prn *r7
+L368: bne *r1
+stop
+L369: .string "npohatupkqils"
+rts
+add *r4, L372
+L370: .string "vedtxilrndagzg"
+L371: mov #-134, r1
+jsr L373
+; comment
+prn L373
+bne *r2
+; comment
+cmp r1, *r7
+L372: jsr *r2
+bne L373
+jmp *r0
+L373: .string "vlvzvnltaajuufclukmbeb"
+stop
@@ -0,0 +1,1027 @@
+; Generated by genCorpus --seed 54
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+jsr L211
+clr L166
+prn L180
+L0: mov r4, *r5
+lea L295, *r7
+add #141, L350
+L1: .data -225, -698, -730, -771, 932, 219
+L2: .string "cbsrvrcrakzxsxfnxiuhsmf"
+L3: .string "rlkxavjjbxagzlkyqijxbx"
+L4: prn *r7
+L5: sub L280, *r4
+L6: jsr *r2
+L7: bne *r4
+L8: prn r0
+L9: add r5, L354
+sub L299, r3
+mov r3, *r7
+
+L10: .data 905
+stop
+L11: lea L29, L19
+L12: prn L341
+L13: inc *r6
+stop
+L14: .string "cmelrlbhtnippvyzy"
+cmp #-203, *r0
+bne L73
+L15: .data -137, 183, 209, -43, -969, -491, 42
+sub #-96, L106
+L16: dec r7
+add r0, L336
+bne *r4
+L17: .string "nlrnrecuzbeqiezsqbdxjour"
+sub #-205, *r6
+bne L381
+L18: prn #-1
+
+mov *r4, r5
+L19: .data -352, 495, -218, 872, -351, -473
+L20: .string "rpuuffzhzhko"
+stop
+dec r1
+prn *r4
+prn r1
+rts
+L21: lea L62, *r2
+red L189
+L22: jmp *r6
+not r5
+L23: prn L319
+L24: .data -789, 47, -899, -599, -19, -460
+stop
+not *r1
+dec r2
+stop
+jsr *r2
+jmp L173
+not L153
+inc r3
+L25: prn L309
+add r1, r0
+L26: .string "jbjcsijsdyobhlowkrsibwf"
+red L229
+rts
+not r6
+L27: add *r3, *r6
+
+bne L195
+L28: bne L232
+not r2
+sub #-133, *r5
+lea L341, *r1
+stop
+mov *r6, r3
+L29: lea L31, L355
+clr *r5
+clr *r5
+bne *r7
+bne *r0
+stop
+L30: cmp L267, #11
+L31: add *r2, r1
+lea L330, L290
+L32: prn #166
+rts
+jsr L357
+L33: red r7
+bne L253
+
+L34: .data -876, 114, -331, -365, -641, -91
+L35: rts
+L36: prn r5
+L37: add #111, *r3
+L38: .data 707, 582, -377, -616, -75, 139, -250
+L39: rts
+prn #-58
+dec L373
+L40: sub L301, *r2
+rts
+stop
+mov #-11, r6
+L41: .string "tviqgvzrkfyfgiuooos"
+L42: .data 482, 744, 97, -579, -966, -967, 613
+L43: prn *r2
+jmp *r2
+L44: .string "atjuzptg"
+not r6
+L45: clr L274
+jsr L115
+jsr *r0
+cmp *r2, L77
+L46: mov L232, L143
+L47: cmp *r3, L151
+lea L125, r0
+not L132
+L48: jmp *r5
+inc *r3
+inc r0
+not r6
+L49: red r6
+L50: stop
+red r1
+dec *r3
+add #-133, *r4
+L51: prn #233
+rts
+stop
+L52: .data 532, -92
+prn #25
+jmp L363
+add *r5, *r3
+L53: add #-27, *r6
+
+rts
+rts
+L54: .data -12, 719, -474
+bne L196
+inc r3
+bne *r3
+jmp *r4
+L55: jmp *r3
+L56: red r4
+jmp *r2
+mov *r1, *r2
+rts
+prn r6
+; comment
+L57: add L293, *r6
+add L196, r4
+inc L236
+L58: .string "bnzyyruwzoswdjgaqyuiqd"
+L59: .data -342, 87, 515, -785, 985
+L60: .string "eqklkp"
+L61: clr r6
+not L109
+L62: .string "tlfdqaoxuyawgkubqbmylzqh"
+L63: red *r1
+L64: cmp *r6, r3
+jsr *r1
+dec L67
+bne *r2
+L65: .string "psghqzpbbfljmnybeb"
+not r7
+mov L149, L158
+stop
+inc r1
+jsr L331
+L66: clr *r7
+L67: .data 911, -725, 31, -630, -707
+mov L106, L261
+L68: prn L239
+cmp L238, r4
+not r7
+inc *r3
+L69: .data -225
+bne L219
+L70: mov #238, *r1
+L71: lea L332, r4
+lea L166, *r5
+red L183
+L72: .data 382, -789, -674, 327, -618
+jmp L205
+L73: jmp L359
+L74: clr *r3
+bne *r0
+; comment
+bne L218
+L75: mov L91, L190
+bne L201
+bne L377
+bne L323
+L76: dec *r5
+L77: .data 661, 198, -747, 381, -956, -444
+; comment
+jsr *r4
+L78: prn r0
+L79: bne *r4
+L80: clr L186
+clr *r7
+stop
+clr L189
+inc r7
+dec *r4
+L81: red r4
+L82: dec *r6
+sub r6, *r3
+; comment
+L83: clr r4
+add r0, *r5
+L84: .data -96, 748, 700, 520, 347, 663, 870, -377
+inc L105
+add #111, *r4
+L85: add r5, r6
+L86: .data 569, 441, 11, -819, -868, 265, -824, 672
+add L197, r7
+L87: .data -562, -525, -349
+L88: mov r5, *r2
+lea L192, L167
+L89: dec r0
+clr L384
+prn r2
+dec r5
+L90: .data -627, 913, 264, -642, -132, -840, -277, -201
+not L161
+L91: lea L277, L300
+not *r5
+sub #119, *r0
+L92: lea L388, L104
+dec L323
+L93: stop
+mov r4, L388
+; comment
+L94: sub *r6, L161
+rts
+
+L95: prn *r0
+prn L289
+L96: dec r5
+rts
+L97: cmp *r7, r7
+L98: mov *r7, r5
+stop
+L99: cmp #-191, #-247
+stop
+L100: .data -335, -159
+L101: .data -413, 876, -967, 164, -631, -981, -688
+L102: inc r1
+L103: cmp *r0, r5
+L104: red r6
+sub #32, L206
+L105: cmp r1, r5
+bne *r1
+; comment
+L106: .data 991, -372, -299, 17, 767
+bne L163
+L107: .data 535, -391, 597, -270, 780, -225, 853
+prn L273
+inc r5
+bne *r3
+L108: .string "loslojzayqd"
+jsr *r0
+lea L204, *r1
+sub #-94, *r1
+rts
+sub r7, *r7
+L109: .string "eacriillbhhsyoznaebhz"
+inc L150
+L110: cmp #-143, r2
+; comment
+; comment
+L111: dec *r6
+jmp *r0
+L112: lea L154, L311
+jmp L158
+red L276
+L113: red L281
+lea L175, L375
+L114: lea L306, r0
+prn #157
+L115: .data -235, 379, -948, 597, 506
+bne L323
+L116: prn #4
+jsr L214
+cmp #-78, #-192
+not L309
+L117: bne L305
+dec L257
+L118: dec L258
+L119: .string "zmljytutyrpteytinp"
+L120: .data -345, 635, 823, 368, 727, 625
+inc L172
+prn *r0
+rts
+L121: mov *r7, *r6
+L122: rts
+; comment
+L123: .data 344, 609
+L124: cmp r6, r4
+jmp *r1
+L125: sub r1, *r2
+L126: jsr *r1
+L127: .string "gzjzqsdozwkkroo"
+lea L217, L142
+L128: .data 729, 659, -77, -116
+L129: not r3
+rts
+cmp *r2, L215
+bne *r7
+mov L268, L264
+inc L177
+L130: prn #-80
+dec *r3
+jmp L175
+lea L377, r2
+L131: inc *r3
+L132: .data -991, -342, -8
+L133: .string "ogoqde"
+L134: add #-34, r1
+red r3
+jmp L214
+jsr *r5
+L135: sub #-92, r0
+rts
+sub L358, L382
+L136: jmp L183
+red r5
+L137: dec r6
+L138: .data -783
+bne *r1
+add *r5, r2
+L139: dec *r7
+rts
+stop
+sub #-7, L342
+bne *r2
+sub L166, L214
+L140: lea L160, L374
+prn L284
+stop
+add L193, *r2
+rts
+mov *r5, *r5
+L141: jsr *r0
+prn r2
+L142: bne *r0
+clr r1
+sub #166, *r3
+jsr L223
+sub L264, *r0
+L143: jmp *r5
+bne L352
+prn #-65
+sub *r2, *r4
+lea L208, *r6
+L144: bne L160
+mov #-167, L274
+L145: red r2
+L146: lea L228, L373
+mov r3, *r5
+L147: add *r2, *r3
+rts
+add *r0, L387
+jmp *r2
+cmp #145, #209
+L148: prn r3
+jmp *r6
+L149: red L214
+lea L207, r5
+L150: lea L332, L304
+stop
+sub r3, r5
+jmp *r2
+L151: stop
+rts
+rts
+; comment
+L152: clr r5
+add *r5, *r3
+L153: jmp *r7
+sub #-180, L168
+mov r2, L294
+L154: red r7
+L155: .string "dytznfqp"
+; comment
+jsr *r6
+L156: red r0
+L157: add #84, r1
+sub #84, r4
+L158: inc L178
+sub r5, L389
+red *r4
+L159: mov r3, L311
+dec L371
+L160: not L355
+L161: bne *r1
+inc r3
+jmp *r3
+stop
+L162: sub *r7, L388
+L163: .string "uphgifxakcjmcm"
+clr *r0
+stop
+red r4
+L164: .string "hagcsojmrkewammi"
+L165: .string "lrrzcedwzw"
+prn *r6
+clr *r1
+L166: not r4
+L167: dec r2
+sub L203, r4
+inc *r2
+L168: dec L203
+red *r7
+sub #-114, L313
+L169: sub L345, r3
+; comment
+prn L295
+L170: cmp r3, L275
+mov L304, r0
+red L356
+L171: inc *r3
+bne L297
+jsr *r7
+bne *r2
+L172: lea L244, L264
+cmp r2, *r7
+L173: red *r7
+inc *r6
+sub r0, *r3
+L174: not *r2
+add #224, L188
+mov #-4, *r5
+dec r1
+L175: mov #91, L272
+prn r3
+not *r6
+L176: bne *r2
+dec *r0
+L177: inc *r2
+add *r4, L207
+L178: inc *r3
+clr L266
+L179: .string "enwtlenqajqxcssufg"
+inc L241
+L180: rts
+; comment
+L181: jsr *r4
+L182: jmp *r0
+cmp *r3, r7
+L183: lea L296, L217
+clr r0
+; comment
+red r3
+sub L369, r0
+lea L234, *r0
+
+lea L197, r7
+L184: rts
+L185: dec r0
+inc *r5
+L186: inc L373
+; comment
+L187: stop
+
+stop
+L188: jmp L213
+jmp L292
+L189: rts
+inc r6
+L190: lea L278, L271
+not *r1
+not r4
+jsr L239
+L191: .data 520, -548, -449, -824
+L192: prn L311
+clr *r3
+clr L234
+jmp L219
+L193: .string "bwiezfxaiwuiuebmk"
+; comment
+L194: .data -251, 937, -613, 884, -151, -711, 105
+mov r0, L276
+L195: jsr L355
+L196: red r2
+L197: .data 883, 559
+L198: .data 277, -463
+L199: .string "xprnrbjkogkbjxcybmnueyrr"
+lea L262, L299
+jmp *r6
+L200: red L371
+stop
+L201: clr *r4
+dec *r0
+not r6
+jsr *r0
+L202: .string "quuujoacumbetcsnfgxxeyk"
+mov L323, *r2
+L203: not L329
+jsr L339
+bne *r2
+; comment
+L204: not r1
+bne *r2
+jmp L370
+add *r0, L345
+inc L313
+prn *r6
+L205: stop
+L206: .string "pevjkbmbnrjvhspvg"
+L207: cmp #117, *r3
+L208: clr r7
+L209: jsr L367
+sub L229, *r4
+L210: dec r4
+L211: red *r3
+bne *r0
+L212: .string "ivtemtwmlvrh"
+clr *r3
+clr L303
+L213: lea L312, L283
+add r1, L335
+stop
+L214: rts
+L215: jsr L387
+jsr L216
+L216: .string "mfdqsrhhmmfppenlseqmak"
+L217: red *r0
+L218: prn L231
+clr r5
+inc r2
+clr r4
+L219: rts
+jmp *r6
+sub *r7, L362
+L220: jsr L338
+
+L221: bne *r6
+L222: .string "dobo"
+
+clr r7
+; comment
+dec L260
+L223: add L389, *r4
+
+rts
+L224: stop
+stop
+L225: .data 736
+bne *r7
+rts
+red L266
+inc L374
+mov #74, L304
+L226: clr *r0
+L227: red *r7
+lea L351, r4
+mov *r0, L285
+L228: prn r7
+L229: .string "fclzhu"
+stop
+clr r0
+inc *r7
+cmp r4, *r1
+rts
+L230: .data -531, -359, -509, -651, -192, 510
+cmp r3, #162
+dec r6
+dec L365
+sub #-25, r5
+inc r0
+L231: clr L304
+L232: .string "bhln"
+jsr *r3
+not *r3
+L233: bne L353
+cmp r2, *r5
+jsr *r7
+clr *r1
+jsr L343
+mov L239, *r5
+not *r3
+inc *r0
+mov #62, L275
+inc r1
+not L345
+dec L354
+L234: .string "ieljphv"
+cmp L354, #65
+stop
+L235: .string "dj"
+lea L256, L282
+red *r4
+cmp *r0, #-32
+mov *r3, L374
+L236: .string "bunybdhuvkvamtbkrnhjp"
+L237: bne *r1
+L238: mov L351, r3
+jsr *r1
+dec r3
+L239: not L265
+L240: .data 581, 164
+L241: bne L256
+L242: add L292, *r2
+; comment
+dec L248
+
+stop
+add *r5, *r3
+inc r7
+prn *r1
+sub *r6, L347
+L243: not *r3
+
+prn L329
+L244: jsr *r3
+clr L370
+prn #-110
+L245: add *r7, r2
+add r6, L299
+L246: jmp L332
+sub #172, r4
+inc L342
+L247: prn L293
+L248: inc r5
+L249: jmp L387
+L250: sub *r2, L271
+L251: cmp #-10, #167
+L252: .string "mpgmeverecqbtyoofxc"
+cmp L363, r1
+mov #79, r5
+L253: rts
+inc r5
+rts
+jsr *r0
+L254: inc r4
+L255: mov #-114, L375
+prn L355
+lea L376, L371
+add #246, *r5
+dec L350
+L256: red r6
+prn L257
+add r3, r1
+stop
+L257: stop
+L258: jmp *r7
+prn #89
+L259: .data -869
+clr r5
+inc L269
+stop
+lea L327, *r6
+L260: .string "oufs"
+L261: not *r2
+L262: .string "tauqlyvberuxlcplotfh"
+jmp *r0
+L263: sub *r2, L308
+L264: red L318
+dec L321
+L265: .data -903, -255, 14, -647, -712, 453
+not r3
+red r3
+L266: not r2
+L267: cmp L371, r1
+; comment
+lea L303, L346
+L268: bne *r0
+L269: clr L271
+jmp L323
+add *r5, L363
+L270: inc L316
+; comment
+add *r3, *r2
+L271: prn L296
+add r3, *r7
+clr *r5
+not r1
+red r5
+L272: mov #-45, L344
+
+prn L335
+; comment
+sub #207, r5
+bne L354
+red *r0
+L273: add L318, L321
+lea L277, *r7
+L274: red r7
+inc r0
+clr L374
+L275: stop
+inc *r0
+L276: jsr *r5
+L277: bne *r3
+add *r0, *r6
+cmp #15, *r3
+L278: mov *r7, *r1
+not r2
+jmp L330
+L279: .string "pycobtgvxymwzugazfknqrk"
+jsr L372
+jsr L326
+jmp L296
+L280: not r4
+L281: .data 673, -200, -903, 21, -626, 991
+add #-252, r0
+add L384, L335
+L282: .data 110, 271, -924, -481, 888, -710, -130
+L283: .string "wruactdusnfstgnfdctirl"
+prn L372
+L284: sub r5, L329
+red r0
+red L351
+L285: .data 17, -130, -373, -762
+L286: jmp *r6
+jsr L319
+L287: lea L386, *r6
+not r5
+L288: clr *r7
+clr L384
+jmp *r5
+lea L314, *r1
+inc L372
+mov *r0, L368
+L289: stop
+stop
+add r5, r6
+jmp L306
+L290: mov #-93, L355
+jmp L322
+prn r2
+; comment
+jsr L350
+mov *r4, r0
+clr r0
+L291: sub *r0, r3
+bne *r6
+jmp L372
+cmp r3, r3
+clr r4
+prn r7
+prn #-182
+dec *r1
+clr *r1
+L292: .string "z"
+not r2
+L293: cmp #123, r4
+red *r3
+L294: inc L312
+dec r5
+add #111, r2
+prn *r3
+L295: lea L315, r0
+add L375, L309
+sub *r4, *r2
+
+L296: bne *r0
+L297: clr r4
+clr *r5
+stop
+L298: jmp *r3
+L299: red r5
+L300: .string "bigymsnree"
+L301: stop
+; comment
+jsr *r5
+lea L357, *r7
+rts
+L302: inc *r7
+add #32, r3
+add r6, r2
+prn L322
+; comment
+L303: clr *r7
+L304: jmp *r2
+sub #-248, L329
+L305: mov r1, *r1
+L306: bne *r0
+rts
+L307: rts
+L308: rts
+lea L388, r7
+L309: .data -46, -142, 504
+L310: .data 358, 126
+inc L376
+L311: mov *r3, *r6
+L312: clr L324
+inc L324
+; comment
+L313: add *r7, *r1
+L314: .data 21, -274, -325, 5, 96, 984
+L315: mov r7, *r2
+L316: cmp L377, #6
+dec *r2
+stop
+L317: mov #-96, r3
+
+L318: .string "udxrlugzengmf"
+dec r5
+rts
+L319: cmp r7, L372
+not r0
+inc r7
+L320: cmp L362, *r4
+; comment
+clr L340
+L321: .string "iyemqfdkvacedxwpn"
+bne *r3
+L322: sub r2, *r3
+jsr *r4
+L323: jmp *r6
+jsr L363
+sub *r4, r5
+inc r3
+L324: add *r7, *r0
+jsr L341
+stop
+L325: red L352
+red L373
+clr r7
+lea L335, L385
+dec r5
+add *r5, r7
+jmp *r1
+jmp *r7
+L326: jsr *r6
+L327: inc r7
+L328: inc *r7
+mov r5, *r2
+stop
+inc *r5
+sub L331, L345
+L329: not L340
+prn r0
+sub L343, *r1
+L330: prn *r6
+L331: prn #-20
+sub *r7, r0
+L332: dec *r4
+L333: rts
+inc *r2
+L334: jsr L349
+rts
+cmp r6, L360
+mov r1, r6
+L335: not *r1
+L336: cmp L350, L358
+jmp L361
+jmp L381
+dec *r7
+cmp L360, r7
+add *r7, *r4
+sub #86, L338
+jsr L381
+L337: red r4
+inc *r7
+L338: cmp r3, *r4
+L339: .string "zilxfccbxekfoqnthbeosowh"
+L340: .string "hdguqrovcffnxxlkohuhrs"
+L341: jmp L355
+lea L375, r1
+mov #201, r4
+not *r3
+sub #-5, *r2
+L342: .string "yxlwrbwiwxcx"
+sub #23, L382
+jsr *r7
+sub *r0, L375
+rts
+sub *r0, L381
+; comment
+L343: prn r7
+L344: rts
+jmp *r0
+L345: stop
+; comment
+sub r2, *r3
+stop
+L346: jsr *r5
+red *r1
+L347: add *r5, r6
+mov *r3, L376
+L348: red r6
+clr *r1
+clr L355
+inc L383
+L349: lea L382, L382
+L350: .data 513
+L351: .string "njdfk"
+L352: cmp L366, #36
+L353: .data -904, 449
+rts
+L354: cmp #107, r1
+not L387
+cmp #66, *r7
+mov #-184, L363
+red *r1
+jsr *r5
+not *r7
+lea L367, r7
+L355: cmp L379, #17
+clr *r0
+red r6
+add *r7, *r7
+L356: sub L381, r2
+sub #134, r5
+dec L370
+lea L367, r7
+lea L370, *r0
+L357: jsr L381
+jsr L389
+L358: lea L387, *r2
+L359: .string "rsgatemutkzekaiwjqdrbmq"
+L360: prn r6
+L361: .data 264
+not L364
+sub *r1, r6
+jsr *r6
+L362: jmp *r5
+bne *r2
+rts
+L363: sub L369, r6
+mov #158, r5
+L364: dec L380
+L365: not L380
+lea L373, *r0
+L366: sub #-83, L370
+prn r0
+sub *r5, *r5
+L367: add L381, r4
+prn *r2
+not r5
+add *r4, *r6
+add L374, r5
+red *r1
+L368: sub r0, r6
+not r0
+L369: cmp L389, #103
+; comment
+bne L380
+bne *r7
+rts
+L370: stop
+L371: red L377
+inc L379
+L372: dec r4
+clr L389
+not r4
+cmp r6, *r2
+add #80, *r7
+lea L388, L388
+L373: rts
+bne *r2
+clr L376
+cmp r0, #42
+stop
+prn L388
+L374: prn #-169
+sub *r1, r2
+mov *r5, r2
+jsr *r1
+stop
+sub L384, *r5
+L375: inc L378
+L376: .string "s"
+inc r5
+stop
+L377: sub *r6, L388
+L378: lea L380, L388
+bne L380
+jsr *r2
+mov L385, r7
+red L386
+sub *r4, *r7
+L379: rts
+L380: stop
+dec L385
+lea L383, L386
+lea L382, L389
+L381: add #82, L383
+inc r2
+lea L384, *r0
+L382: add L388, L387
+bne L389
+L383: red r5
+L384: add *r0, L385
+rts
+L385: .data -671, 241, 109, -545, -887, -207, -721, 979
+prn L387
+not L386
+L386: .string "bnjgwcganqxnwoybkjuqhy"
+sub L388, L388
+
+L387: .data 790, 169, -139
+L388: .string "fxzqezz"
+L389: dec r4
+jsr L349
+jmp *r6
+stop
+rts
+stop
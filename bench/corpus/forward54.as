@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 55
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+L0: cmp #-166, #104
+L1: jmp *r6
+cmp L179, r2
+L2: cmp r0, *r3
+; comment
+L3: lea L7, *r3
+bne L141
+sub #62, *r3
+L4: dec *r5
+L5: inc r7
+not *r6
+L6: inc L246
+stop
+L7: .data 259, -110, -64, -413
+mov #145, L288
+L8: cmp *r5, r1
+L9: .string "vuxucynnbjbpch"
+L10: prn #-63
+L11: bne *r2
+L12: dec *r2
+inc r6
+inc L173
+L13: .data -160, 372
+L14: jmp L177
+cmp #181, *r5
+inc L195
+L15: cmp L51, #-59
+bne *r0
+L16: add *r1, L107
+lea L128, L181
+mov *r6, L17
+L17: jmp L48
+sub #221, r0
+jmp L103
+L18: .data -88, -893, -93, -103, 820, -622, -215
+rts
+
+inc r4
+L19: .data -509, 967, 149, -610, -816, -970
+add *r0, L275
+L20: bne L319
+L21: cmp r6, r0
+stop
+cmp L280, *r2
+L22: .string "xiaqqqdc"
+dec L179
+L23: prn r5
+bne *r2
+lea L136, r4
+jsr *r5
+L24: bne L191
+add L31, L152
+L25: stop
+L26: cmp *r1, *r5
+L27: .string "thujnavwmqaglvr"
+lea L108, L291
+L28: prn *r2
+add r2, r7
+rts
+L29: bne L73
+L30: sub r0, r5
+sub #185, L181
+mov r1, *r1
+mov *r2, L239
+L31: bne L52
+L32: .string "vchunolaqznp"
+L33: sub r3, *r1
+L34: bne L199
+jsr *r2
+L35: rts
+L36: inc *r2
+sub *r6, r5
+dec L171
+mov r5, *r4
+stop
+inc *r1
+L37: prn *r1
+L38: .string "hmeraqqdgewukit"
+L39: add *r6, L45
+mov r5, L110
+L40: red r3
+L41: .string "wkmjvzhidg"
+L42: prn *r4
+add r7, L246
+jmp L119
+jsr *r4
+L43: not *r7
+rts
+jmp L271
+lea L135, L307
+L44: mov *r0, r1
+jsr *r7
+L45: .data -24, -12, -463, -127, -569, -832, 810
+rts
+L46: sub #-4, L206
+sub L85, *r4
+L47: .data -952, 902
+mov *r3, r6
+clr r2
+add #-102, L346
+stop
+clr L252
+; comment
+
+dec *r5
+L48: inc r6
+prn *r6
+rts
+cmp L277, *r3
+; comment
+L49: cmp #-38, r4
+red *r7
+add *r2, *r5
+red L76
+L50: .data -569, 600, -351, 48, 126, -597, 957, 274
+rts
+L51: jsr L56
+mov r1, r4
+add r6, L345
+; comment
+L52: cmp *r1, r7
+L53: sub r5, L250
+L54: stop
+jsr L126
+; comment
+bne *r7
+L55: cmp *r2, L235
+L56: .data 866, 932, -300, 128, -265, 520
+jsr L267
+red *r2
+L57: cmp #114, *r0
+L58: not r2
+jsr *r7
+prn *r4
+L59: .data -74, 520, -935
+L60: .data 728, 735, -262, 574, -805, 685
+inc *r2
+red *r0
+prn r6
+L61: lea L79, L210
+not *r6
+dec r1
+inc *r0
+prn L223
+L62: .string "mnagcoxuburdamka"
+dec *r5
+; comment
+L63: .string "rqiyatxdoawrxdtsigampf"
+inc L330
+red *r3
+red r7
+jsr L296
+inc L264
+L64: cmp r1, r0
+L65: jsr L351
+jsr *r2
+L66: rts
+lea L143, *r4
+jsr L266
+L67: lea L219, L160
+L68: .string "xcovjsdtllpz"
+jmp *r6
+L69: .data 69, -257, -767, -634
+L70: red r3
+
+L71: .data -481, -422, 127, 401, -81, -277, -3
+prn r7
+cmp #117, *r5
+L72: .string "riauavddhxiag"
+red *r1
+lea L155, L339
+stop
+stop
+rts
+jmp L95
+L73: stop
+L74: lea L274, L195
+L75: add *r5, *r1
+L76: dec L225
+L77: .string "jigtj"
+sub r1, L278
+L78: jmp L153
+L79: .string "ojytwdhv"
+cmp *r6, L151
+L80: rts
+L81: .string "l"
+mov r4, *r1
+not L102
+
+L82: clr r4
+
+cmp *r1, L110
+mov #-199, L271
+L83: clr L322
+dec L219
+
+L84: dec r5
+dec r2
+L85: lea L257, L252
+clr r3
+jmp *r3
+red *r0
+cmp *r5, L226
+L86: .data 416, 951, -176, 317, -44, -370, -981, 814
+stop
+L87: .data 677
+dec *r3
+L88: dec r5
+dec L275
+red r6
+red *r7
+L89: rts
+not L349
+L90: jmp L280
+clr *r7
+red *r1
+lea L124, r0
+stop
+add *r5, *r5
+stop
+clr r4
+clr L292
+jmp *r5
+L91: .string "ims"
+mov L160, L163
+L92: rts
+L93: inc L144
+L94: prn #205
+L95: bne L313
+cmp L258, r5
+L96: cmp L111, L274
+L97: bne *r1
+L98: .string "gnoyraclrbailnxdw"
+L99: sub L137, L348
+red L319
+L100: sub *r2, r2
+prn *r3
+add r4, *r1
+L101: add *r0, r2
+L102: dec L308
+L103: dec L114
+L104: .data 463, -176, -446, -149, 932, -766, -111, -613
+lea L231, r6
+rts
+dec L146
+prn L297
+sub r2, *r7
+lea L262, *r7
+add #16, L183
+
+rts
+jmp *r7
+jmp L223
+L105: red L146
+clr *r4
+jsr L346
+bne L153
+jmp L265
+clr *r5
+L106: dec r4
+
+L107: stop
+L108: dec r4
+dec L323
+cmp L165, r5
+clr *r2
+L109: lea L295, *r6
+jsr L159
+L110: dec *r1
+L111: jsr *r5
+L112: clr L175
+dec L233
+cmp L132, #-144
+mov r6, L204
+add r7, *r0
+L113: lea L225, L170
+jsr L225
+inc r6
+sub #-175, L223
+rts
+L114: .string "wpulclazpa"
+red L252
+L115: prn L300
+prn L195
+mov *r1, L351
+L116: bne L241
+add L280, r4
+red r6
+L117: .string "hgxnelofdo"
+L118: red *r4
+not r5
+L119: not r3
+L120: bne L265
+red L204
+L121: cmp *r7, L302
+clr L229
+rts
+inc *r2
+stop
+L122: dec *r5
+jmp *r0
+L123: cmp r5, L239
+lea L207, L173
+sub r7, r0
+; comment
+rts
+bne *r7
+L124: red r2
+L125: jsr *r0
+L126: cmp *r3, *r7
+clr *r2
+L127: stop
+L128: .data 446
+inc r3
+bne L288
+sub #-179, *r2
+inc r2
+rts
+L129: jsr *r4
+add *r5, r3
+bne *r0
+L130: jmp L252
+clr *r1
+inc *r6
+L131: red r3
+cmp #154, #-12
+L132: .data -615
+inc r4
+L133: inc *r6
+mov r5, *r7
+bne *r0
+jmp *r1
+dec r5
+rts
+stop
+cmp *r6, *r5
+L134: .data -892, -467, 196
+inc r1
+add #-88, r7
+rts
+inc L321
+mov *r0, *r1
+L135: bne L164
+rts
+L136: lea L232, *r2
+L137: not *r4
+L138: jsr *r4
+L139: red r4
+add r0, *r0
+inc *r1
+jsr L174
+L140: mov #-216, r3
+L141: .data 825, -696
+clr r0
+
+L142: .data 127, -50, -997, 286, -771, 852
+red L346
+L143: dec *r2
+L144: jmp L266
+cmp #138, #-53
+
+jmp L208
+clr L190
+L145: not L184
+dec r0
+L146: sub r5, L175
+add #-82, r2
+jmp L215
+L147: clr r4
+red L301
+clr r0
+jsr L174
+stop
+sub *r4, L270
+clr L331
+sub *r3, r7
+L148: prn r2
+cmp L213, r3
+prn L181
+cmp #-234, *r7
+jmp *r2
+clr *r2
+add *r7, L262
+cmp L262, #-93
+add r3, *r0
+prn L331
+add r2, *r0
+prn L291
+L149: dec r1
+inc r1
+bne L331
+L150: red *r2
+jmp *r0
+rts
+jmp L175
+inc *r7
+jmp L345
+dec *r6
+; comment
+jmp L163
+stop
+jsr L345
+jsr L239
+; comment
+; comment
+L151: clr r0
+L152: stop
+; comment
+L153: .string "xpopbcdp"
+stop
+L154: .data -955, 931, 434, -128
+add #24, L179
+L155: prn L325
+L156: cmp L329, L160
+L157: add L355, L187
+red r4
+red L171
+L158: lea L335, L225
+rts
+prn L270
+sub L274, L161
+jmp L354
+mov #-159, r7
+L159: prn *r6
+L160: .data -750, -615
+not r1
+prn *r0
+L161: rts
+jmp *r3
+mov *r1, *r3
+L162: stop
+L163: jmp L255
+inc r7
+mov L211, L239
+cmp *r6, *r1
+; comment
+L164: dec *r0
+L165: lea L289, r5
+add #-176, L173
+cmp r6, L232
+mov r4, *r3
+add *r5, L200
+L166: add #-221, *r6
+sub L209, L284
+L167: jsr L272
+dec L203
+jsr L300
+L168: .data 162
+L169: inc L279
+L170: red r1
+L171: sub r5, L306
+clr L250
+L172: cmp *r3, L232
+L173: .data -958, -699, -931, 614, -770
+inc *r1
+dec r3
+jmp L239
+L174: add *r4, L216
+L175: jsr *r1
+; comment
+clr *r5
+L176: jmp *r7
+L177: clr *r6
+bne *r7
+L178: inc *r2
+inc L321
+clr r3
+; comment
+sub #-163, r2
+not *r4
+rts
+prn L216
+L179: .string "zkitpiksfethbwgvhjybuklz"
+rts
+L180: clr L277
+L181: .string "hytrvwpckyydaazy"
+jsr *r2
+inc r5
+stop
+L182: clr r0
+jmp *r3
+stop
+L183: dec L338
+add *r4, r2
+inc r2
+stop
+L184: .data -613, -197, 691, -308
+L185: .data 210
+dec *r6
+
+clr r5
+dec *r3
+jmp *r5
+L186: cmp #106, *r3
+jmp *r6
+; comment
+L187: .data 869, -6, 359, 980
+add L283, L204
+rts
+rts
+L188: .data -874
+red *r3
+cmp *r1, L353
+cmp r5, #-237
+red *r0
+lea L350, L217
+L189: .data -348
+rts
+L190: bne *r2
+add r0, *r2
+clr *r6
+
+clr L225
+lea L321, *r7
+rts
+prn L331
+dec *r7
+add *r1, r2
+prn r6
+L191: .data 623, 238, -14, -151, -265, -950, 743
+stop
+bne L326
+L192: not *r3
+L193: jsr *r1
+clr r3
+prn *r3
+L194: inc *r1
+add r1, L220
+prn #60
+not *r2
+L195: .data 386, 368, -847, -611, 182, -140, 153
+sub L334, r3
+; comment
+L196: not *r2
+sub r0, L340
+prn *r1
+
+L197: rts
+lea L220, *r6
+L198: jmp L339
+dec *r1
+jmp *r0
+L199: jsr L307
+sub r1, L249
+not r1
+not L335
+L200: bne *r6
+clr r0
+bne *r0
+add r2, *r4
+; comment
+L201: jsr L318
+red *r3
+L202: .string "txpm"
+L203: clr *r2
+
+dec L253
+lea L212, *r1
+not L228
+rts
+cmp *r0, L256
+; comment
+L204: add *r3, *r1
+prn r6
+rts
+stop
+L205: jmp *r3
+jmp *r6
+cmp *r5, *r5
+bne L294
+L206: .data -79, 27, 570, 343, 48, -285
+L207: bne *r1
+L208: red L258
+sub r3, L352
+stop
+cmp *r3, L223
+L209: .data -916, 294, 855, -679, 412, 201, -857, -472
+L210: inc r5
+not L338
+inc *r0
+L211: .data 640, -883
+prn #103
+L212: cmp L268, *r1
+stop
+red *r1
+
+lea L233, r6
+L213: jmp L305
+prn r0
+L214: lea L349, L286
+; comment
+L215: jsr L233
+sub *r3, r7
+stop
+add #-220, L217
+L216: clr r3
+L217: sub L252, L318
+L218: bne L307
+mov #-121, *r4
+L219: rts
+L220: sub #-127, L312
+dec *r6
+stop
+L221: .data 464, 90, 723
+clr r7
+mov r2, *r4
+L222: rts
+cmp r6, r0
+rts
+L223: lea L235, r0
+L224: .string "jsqctlgjennryuyjv"
+dec *r3
+rts
+jsr *r3
+clr r1
+add *r3, L237
+jmp L301
+dec *r1
+sub *r5, L272
+prn r2
+stop
+L225: inc L249
+stop
+inc L324
+L226: .string "fcbrd"
+clr r4
+stop
+jmp *r5
+L227: sub r7, L307
+sub L257, L228
+L228: not L244
+L229: clr *r7
+mov r5, r7
+jsr L280
+L230: cmp #23, *r3
+L231: mov #234, L250
+L232: jsr *r1
+rts
+L233: lea L236, *r3
+L234: inc L312
+stop
+jsr L287
+clr L327
+prn r5
+sub r3, L306
+L235: .data -405, 249, 281, -908, 490, 735, -177
+clr *r6
+stop
+clr *r1
+L236: .data -230, -623, 482, -859, -703, 158
+L237: mov #-119, *r0
+not L257
+lea L249, *r1
+stop
+clr r1
+sub r2, L265
+not *r5
+L238: .string "bmbilfkvir"
+stop
+L239: cmp #-150, *r0
+cmp L297, L346
+L240: .data 815, 504, -24
+not L279
+L241: clr *r6
+stop
+; comment
+sub *r1, r1
+lea L299, L259
+L242: .data 977, 423, -673, 484, 876, 749
+L243: .string "jxrcydmlqvzxrblql"
+stop
+L244: add r5, r5
+dec L345
+clr r0
+L245: dec L345
+red *r6
+sub *r4, L331
+L246: .string "paxzqypvnfykhm"
+L247: .string "dnfbgsyu"
+rts
+L248: red r3
+L249: stop
+add #130, L271
+sub L323, L349
+inc L290
+cmp *r4, *r4
+inc r6
+rts
+rts
+mov L317, r4
+not *r5
+L250: mov r5, r1
+dec L348
+jmp *r2
+jsr *r5
+L251: .string "fbqkrqyq"
+L252: add #-143, L268
+; comment
+L253: .string "ebpzntr"
+L254: not r6
+dec r7
+not r4
+L255: lea L304, r2
+sub #156, *r2
+dec r5
+L256: red *r7
+prn r7
+prn *r0
+L257: sub L318, *r0
+L258: dec r3
+prn r5
+L259: sub L328, r5
+L260: .data 737, -254, 544, -642, -119, -460
+L261: cmp *r5, L353
+bne L308
+L262: .string "go"
+jmp *r7
+prn r6
+clr r1
+rts
+sub #161, *r5
+add r6, L312
+prn *r3
+prn L333
+lea L277, *r4
+rts
+L263: jmp L328
+; comment
+dec r4
+mov #-180, *r1
+lea L312, r2
+cmp r0, *r0
+L264: red L348
+L265: not L266
+L266: jmp *r3
+L267: .string "bkun"
+clr L326
+jsr *r1
+inc r1
+rts
+L268: dec r7
+; comment
+cmp L313, *r4
+L269: mov L300, *r1
+; comment
+jsr L338
+; comment
+L270: rts
+L271: .string "yqzgckjzm"
+jmp *r5
+L272: sub #-195, L307
+L273: bne L330
+dec L298
+; comment
+prn *r3
+L274: cmp r1, L279
+; comment
+L275: dec r5
+jsr L322
+L276: red L337
+L277: cmp r7, r4
+clr *r6
+L278: cmp r0, L308
+dec r4
+clr r4
+cmp #-56, #233
+lea L351, r1
+rts
+sub *r3, r6
+L279: red r5
+stop
+not r5
+L280: mov #114, L354
+L281: bne L354
+lea L334, *r6
+sub #24, L349
+red *r3
+mov *r3, r4
+L282: cmp #183, r4
+L283: jmp L309
+stop
+lea L292, L295
+L284: not *r1
+bne *r5
+L285: .string "grmajeprnloiagvegai"
+red *r1
+L286: .data -513, -639
+rts
+
+rts
+jmp L325
+
+red r3
+dec r1
+mov #205, r5
+; comment
+rts
+dec *r1
+L287: inc *r7
+rts
+sub #-110, L335
+not *r7
+
+rts
+L288: not r6
+jmp L297
+cmp r4, r4
+prn *r7
+lea L354, L339
+L289: .string "bjsivekzqw"
+L290: add L334, r3
+stop
+L291: lea L342, *r2
+L292: cmp L299, r3
+; comment
+L293: stop
+prn *r5
+add L309, r5
+clr L346
+L294: cmp r0, *r5
+bne *r1
+cmp #-246, #-79
+jmp *r1
+red r5
+
+jmp *r4
+bne L331
+prn r3
+stop
+jmp L316
+L295: .string "kwobkairsacfighpsuni"
+L296: not *r3
+inc r3
+jmp L307
+cmp r4, r4
+L297: rts
+L298: bne *r6
+L299: jmp L339
+rts
+bne *r1
+clr *r0
+inc *r6
+L300: sub r2, L345
+not *r1
+rts
+rts
+L301: dec L345
+jmp L328
+dec r0
+L302: lea L306, L323
+prn L315
+add r3, *r3
+L303: .string "llzjnaeureecqwgnzdf"
+jsr *r2
+rts
+L304: sub *r0, r1
+L305: jsr L340
+mov *r7, L322
+L306: clr r0
+L307: rts
+bne L324
+cmp L330, #206
+L308: red L312
+rts
+sub r1, L333
+
+L309: inc L318
+L310: lea L314, *r2
+prn r4
+jsr *r1
+not r3
+L311: mov L328, L323
+stop
+clr r6
+dec r5
+L312: jsr *r2
+L313: mov #209, L347
+sub L340, r6
+
+sub #98, r6
+mov L326, L339
+rts
+
+sub *r6, r4
+not L325
+L314: .string "sbyfjkrdwoeeeef"
+L315: .string "wqgurskdwbrjqakyxofvrktw"
+L316: jsr L330
+cmp *r2, r6
+stop
+stop
+L317: .data 647, -620, -861, 942, -254
+mov *r5, *r2
+L318: not r0
+prn #-225
+dec L352
+dec *r7
+L319: mov r5, r7
+L320: .string "ovh"
+L321: .string "nhmuchm"
+L322: .string "uqdyoxgfwjmllpyjidzbf"
+L323: .data -831, 655, -33, 969
+add L350, *r0
+add L329, *r1
+clr r2
+L324: .string "cvftvrspkpqvyugeivrz"
+prn *r4
+stop
+; comment
+sub *r2, L353
+inc r4
+L325: red *r7
+L326: red *r3
+prn *r6
+L327: .string "yfzybfdqz"
+mov r0, *r2
+clr L342
+L328: rts
+mov L338, *r1
+add *r1, *r1
+jmp L340
+stop
+
+L329: inc *r4
+dec *r3
+L330: .data 960, -132, 705, 547, -547
+jsr L345
+jsr *r4
+L331: add L335, *r5
+dec L349
+L332: prn L339
+; comment
+cmp r4, r5
+L333: red L351
+L334: clr *r4
+L335: prn L343
+L336: mov r1, L343
+clr *r5
+L337: .data -497, 333
+mov r5, r7
+L338: lea L347, r6
+lea L342, L351
+L339: sub L341, r7
+inc L350
+L340: jmp *r2
+red r5
+stop
+inc L346
+clr *r3
+prn *r0
+L341: stop
+L342: mov L350, r3
+mov #161, r1
+inc *r6
+red L347
+cmp r4, *r6
+L343: jsr L350
+lea L351, L346
+rts
+; comment
+bne L355
+lea L353, r3
+L344: .string "hpfzbfrhfbusbcrumgauccqu"
+L345: .data 830, 116, -196, -607, -172, -824, -822, -406
+rts
+; comment
+not L350
+rts
+L346: lea L348, L352
+L347: red r7
+inc L355
+jmp *r4
+add #212, L354
+clr r3
+bne *r0
+cmp r5, *r0
+jsr *r6
+L348: jmp *r6
+rts
+L349: rts
+L350: lea L354, L353
+L351: mov #6, r2
+clr r0
+rts
+L352: .data -742, 636, 853
+; comment
+red r4
+cmp L354, L354
+inc *r1
+not r1
+add L353, L354
+prn #27
+jmp L353
+add #235, r5
+clr *r1
+L353: dec L355
+L354: red L355
+L355: rts
+mov L267, L33
+red L169
+stop
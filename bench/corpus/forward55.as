@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 56
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+stop
+sub #221, *r6
+dec L137
+
+L0: prn L41
+L1: mov L180, r7
+lea L25, *r0
+L2: .string "mlh"
+; comment
+rts
+jsr L133
+dec r5
+; comment
+L3: .string "ajwldlqsnuarywkqjwuadpdg"
+L4: jsr *r5
+lea L112, *r0
+L5: .string "rvdnauttwzikshy"
+add L153, *r5
+L6: .data -764, -828, 927, 362, -279
+L7: .string "vcmkg"
+L8: jsr L260
+
+
+L9: add *r5, L174
+L10: clr L175
+rts
+jmp *r7
+dec L339
+L11: jmp *r4
+L12: stop
+add *r6, L303
+rts
+bne L249
+bne *r3
+red *r1
+sub #-137, L106
+L13: .data 950, 526, 482, 403, 189
+jsr L126
+add L166, L255
+
+sub #72, r5
+stop
+cmp L324, #99
+jsr L196
+rts
+L14: add r5, r1
+bne *r5
+L15: jmp *r4
+bne *r5
+L16: not r0
+L17: add L289, *r1
+clr r5
+dec r5
+clr r0
+prn r0
+L18: cmp r1, #-2
+L19: jsr *r5
+bne *r5
+jsr L52
+L20: .data -7, 40, 713, 367, 703, -838, 410, 407
+prn *r5
+prn L99
+L21: mov *r1, r5
+red r0
+clr L155
+not L113
+L22: dec *r3
+jmp L204
+inc r7
+add *r2, *r2
+; comment
+prn r4
+cmp *r5, #-247
+prn #167
+L23: bne L319
+; comment
+jsr L65
+bne L191
+; comment
+clr L75
+L24: lea L219, L58
+stop
+jsr L256
+cmp L184, #-254
+clr *r2
+L25: .string "h"
+not r7
+lea L54, r5
+mov #177, r0
+dec *r1
+lea L216, L263
+jmp L333
+rts
+; comment
+sub L65, r5
+not *r1
+clr r5
+L26: .data 961, -5, 204, 182
+stop
+L27: dec r5
+L28: .data -872, -932
+L29: prn r5
+jmp *r1
+stop
+L30: .data -352, 254, 406, -474, -263
+L31: .data -965, 361, 414, 173, -41, -629, 459
+inc L256
+prn L47
+jsr L163
+L32: dec r7
+L33: clr L298
+bne L81
+clr r1
+rts
+L34: clr r4
+cmp #-33, #-180
+prn *r3
+L35: rts
+add L49, *r5
+add L120, L296
+not L193
+L36: dec *r6
+red *r3
+red *r2
+L37: .string "akcas"
+L38: jmp *r7
+L39: not L107
+rts
+rts
+L40: bne *r4
+inc *r7
+clr r7
+cmp L112, L161
+not L204
+rts
+L41: .string "cpdyrjjodgbfuz"
+L42: rts
+stop
+jsr *r5
+dec r7
+L43: .data 727, -108, -225, -482
+L44: .string "cjjirldlyyx"
+not L240
+
+not *r6
+L45: red L143
+clr r4
+not L113
+L46: clr L62
+add r6, r3
+L47: .string "xty"
+sub r6, *r1
+sub #69, L165
+L48: clr L203
+not L219
+L49: mov L96, L216
+rts
+L50: jsr L80
+lea L276, *r3
+inc L259
+L51: not L85
+L52: .data -592, -450, 875, -377, -840
+clr r0
+L53: .data -544, -660, -950, -850, -212, 963
+dec r3
+dec *r7
+L54: bne *r6
+; comment
+jsr L174
+; comment
+stop
+L55: red *r6
+L56: bne L285
+jsr L266
+bne L234
+lea L325, L176
+lea L156, *r3
+jmp L294
+add #-102, r3
+inc *r7
+; comment
+dec L295
+bne *r4
+L57: red *r2
+L58: .data -732, 965, -776, 886
+lea L116, *r0
+jsr *r2
+sub *r6, r7
+mov #145, L267
+sub #-172, r3
+L59: jmp L205
+L60: cmp *r6, *r3
+L61: stop
+L62: inc *r1
+jsr *r6
+dec r2
+mov r6, *r0
+prn *r1
+jmp L178
+jsr L105
+; comment
+L63: not r2
+mov *r7, L296
+not L177
+jmp *r3
+inc r1
+stop
+L64: dec L195
+L65: dec *r6
+; comment
+mov #142, r4
+dec L281
+L66: jmp L238
+add *r5, *r3
+jmp *r3
+L67: clr *r5
+mov r7, L101
+prn *r2
+not *r6
+L68: .string "oseeyejlnax"
+mov *r3, L170
+red L77
+clr r0
+L69: .string "nkjm"
+; comment
+stop
+prn r5
+dec *r3
+jmp *r5
+L70: add r4, *r7
+inc L161
+sub *r0, L132
+bne *r2
+L71: mov L164, *r0
+L72: bne L115
+L73: jmp *r3
+jmp *r6
+jsr *r7
+rts
+mov L244, L81
+jmp L324
+sub #-224, *r5
+red r5
+jsr L177
+sub L86, L299
+L74: jmp L103
+dec L126
+stop
+clr r1
+stop
+L75: .string "lrzppmcpckxjwrzrlqmsjwn"
+L76: .data 557, 475, 63, 866, 544
+; comment
+rts
+add L162, L154
+L77: .string "ahvsinqarydlsyuwjdtxvhfb"
+L78: .data 845, -196, -814, -289, -165, 652, 511
+add *r5, *r2
+red *r2
+L79: .data -11, 530, 2, -163, -77, -947, -775
+inc *r0
+rts
+L80: rts
+sub r3, L340
+red *r0
+bne L92
+L81: jsr *r7
+cmp *r3, *r4
+L82: .string "zcsovyyuhqkgistot"
+L83: clr *r5
+red *r7
+inc r7
+red r3
+clr r2
+mov r6, *r0
+L84: inc L260
+sub #-133, r3
+L85: jmp *r3
+L86: .data 413, -802, 646, 860, 356
+jmp L150
+inc L173
+stop
+rts
+rts
+not L93
+add L106, L104
+clr L326
+L87: add *r6, *r2
+red r6
+; comment
+jsr *r6
+inc *r1
+cmp L277, *r6
+L88: cmp r6, r3
+inc L118
+jmp *r1
+prn L237
+bne L336
+clr *r4
+jsr *r1
+prn r2
+clr r2
+stop
+
+dec r2
+lea L305, r6
+
+rts
+prn r0
+L89: .string "aloyqocloisafiea"
+rts
+rts
+not *r2
+prn L335
+dec *r6
+stop
+L90: .data 361, -232, 185, -979, 588, 225
+rts
+L91: lea L140, r7
+dec L152
+L92: mov #130, r5
+L93: rts
+sub #-19, r6
+dec r4
+cmp r1, #194
+L94: jmp *r5
+red *r7
+L95: .string "ybzsykyxaau"
+clr r4
+jsr *r7
+clr *r6
+cmp r7, L171
+L96: jsr L246
+clr L220
+L97: lea L160, L248
+L98: .data 250, -31, -867, 700, -580, -944
+L99: inc L204
+not *r1
+jsr *r1
+jmp *r0
+L100: mov *r4, *r7
+; comment
+cmp r4, #-10
+L101: clr L189
+inc r0
+L102: .data 744, -979
+dec r7
+cmp r0, #38
+prn *r6
+inc *r4
+sub r2, r3
+rts
+L103: .string "iidksppalmneeu"
+rts
+L104: jmp *r4
+bne L334
+L105: bne L265
+L106: add *r6, r2
+not L281
+mov #143, L108
+sub L248, L180
+L107: red *r6
+
+clr L263
+jsr L316
+jsr *r5
+
+sub #114, r4
+L108: jsr L286
+prn #-200
+L109: .string "lmuneycufpuybyxfmpry"
+L110: .data -291, -851, 8, -183, -144, 582, -259, 126
+not r7
+L111: lea L260, L232
+sub r3, r7
+L112: sub #-179, L215
+bne L321
+rts
+dec L290
+prn #192
+stop
+jsr *r5
+cmp L334, *r6
+L113: .string "rispgaokm"
+L114: .string "xff"
+L115: mov r4, L329
+lea L120, *r6
+L116: bne L310
+L117: .string "hdecxg"
+jsr L174
+rts
+L118: dec *r4
+L119: add L240, r2
+clr L296
+jmp L249
+L120: rts
+L121: .string "hpxnolmc"
+not *r3
+red *r4
+jmp *r7
+
+rts
+inc r1
+L122: .data 610
+add #142, L291
+L123: .data -577, 300, -720, -362, -675, 800, -27
+red *r3
+sub *r6, *r6
+L124: stop
+L125: .data 463, 845, -305, -616, -282, 643
+cmp r2, *r2
+mov L269, *r7
+bne *r7
+not L158
+add L173, *r1
+bne L158
+bne *r3
+L126: mov r2, L281
+
+dec r5
+; comment
+L127: .data 269, 973, 278, 8, 67, 625
+jmp L322
+L128: prn L325
+prn #-11
+jsr *r3
+stop
+not *r5
+lea L226, *r4
+inc *r3
+prn L198
+sub L231, L281
+L129: prn #102
+L130: not L152
+L131: sub L133, *r0
+red r2
+L132: .data 869
+red L256
+bne L288
+L133: rts
+mov *r4, *r5
+L134: red *r1
+L135: inc r4
+bne *r0
+L136: .data -844, 205, 437, -158, -62, -280
+jmp *r2
+L137: jmp L217
+jmp *r2
+clr *r2
+red *r0
+
+L138: red *r3
+L139: jmp L275
+jsr L330
+jsr *r1
+L140: mov #-128, *r7
+clr L217
+red *r1
+L141: .data 558, 378, -761, 901
+L142: jmp *r0
+L143: cmp *r1, L144
+clr *r4
+L144: .data -90, -279, -148, 936, -74, 335, 301, -113
+rts
+
+sub *r0, L154
+; comment
+L145: rts
+L146: jsr *r5
+L147: bne L284
+not *r0
+L148: jmp L253
+dec *r4
+L149: bne L219
+L150: bne *r7
+clr r3
+sub r4, r2
+L151: inc L261
+jsr *r4
+jsr L247
+sub *r1, *r0
+mov *r0, L202
+add #234, r5
+bne L269
+L152: jmp *r4
+L153: .data 898, -789, -862, 721
+L154: not L309
+mov *r1, L311
+dec *r7
+L155: rts
+L156: prn L304
+L157: jsr *r4
+jsr L251
+L158: .string "ucqhhablpjfikyo"
+rts
+rts
+L159: mov r5, r6
+jsr *r6
+L160: .data 785, -796, -547, 383, 394
+stop
+rts
+L161: clr r1
+L162: .data -636, 324, 800, 856, -537, 817, -192, -145
+L163: jsr L175
+bne *r2
+add L286, r3
+L164: .string "mvfcypdrwgmjs"
+cmp r4, L242
+jmp *r6
+sub #-44, L210
+L165: red *r2
+L166: cmp r1, #-117
+bne *r2
+cmp L328, #-40
+L167: rts
+stop
+L168: red L336
+L169: bne L254
+L170: bne *r5
+L171: prn L192
+L172: bne L190
+add #142, *r5
+dec *r5
+L173: stop
+inc r7
+jsr *r4
+L174: cmp #203, L193
+lea L194, r5
+L175: .string "zx"
+red *r0
+rts
+sub *r2, *r2
+
+lea L218, L297
+L176: jsr *r2
+L177: clr L311
+L178: .data -747
+dec *r2
+red r6
+inc L196
+stop
+jmp L294
+dec L250
+rts
+inc L219
+L179: rts
+L180: red L336
+add r5, *r7
+inc r5
+clr L342
+rts
+lea L235, r6
+sub L242, r3
+mov #183, *r5
+L181: red *r0
+jmp L280
+L182: .string "whtay"
+red r0
+L183: jmp *r6
+L184: add #-188, *r7
+stop
+cmp L254, #-100
+red r3
+red *r0
+rts
+; comment
+jmp L295
+bne L258
+L185: stop
+jsr *r5
+sub L282, *r1
+mov L306, *r3
+mov L319, L284
+L186: rts
+L187: .data 964
+stop
+not *r3
+L188: jsr L242
+clr *r0
+; comment
+red *r7
+red *r2
+L189: clr r5
+L190: stop
+bne *r5
+dec r1
+L191: lea L341, L288
+dec *r1
+inc L304
+L192: jmp *r6
+lea L340, *r5
+lea L225, L231
+jsr *r2
+; comment
+L193: .data 432, -71, 437
+mov r2, L329
+L194: not r5
+L195: .string "qdklismzyccqmefmoz"
+L196: dec *r3
+jsr *r7
+mov *r1, *r2
+L197: prn r0
+L198: .string "dclhcu"
+L199: .data 31, 946
+not r3
+sub #124, *r3
+bne L333
+rts
+prn L271
+cmp L292, L337
+stop
+cmp r2, *r2
+dec L318
+; comment
+L200: .data 482, 523, -92, 475, -22, -108, -258
+not L233
+inc r5
+not L238
+add #231, *r4
+not *r2
+L201: sub L305, *r5
+jmp L335
+red L249
+inc *r1
+mov L285, L283
+L202: sub L270, L320
+lea L309, *r7
+; comment
+inc r6
+dec r6
+L203: lea L282, r5
+bne L297
+L204: .string "hvscbzxgyqfqv"
+inc L322
+red r0
+not *r3
+; comment
+lea L218, r6
+mov *r5, r7
+bne L307
+not L274
+L205: add L251, L230
+prn *r6
+cmp *r2, r4
+rts
+jmp L291
+prn #105
+L206: .string "cstlowybumknynozmyqt"
+mov #187, L339
+sub *r4, L302
+dec L271
+L207: clr *r6
+jmp *r2
+red r2
+jmp *r2
+bne *r1
+L208: inc *r2
+jmp L287
+inc L259
+L209: lea L296, *r4
+L210: sub #124, *r3
+cmp *r0, *r1
+L211: cmp L241, L321
+add #-42, r3
+not *r7
+cmp *r4, r7
+lea L236, L272
+mov L270, L311
+sub L225, L292
+stop
+L212: add L225, r6
+L213: rts
+cmp L293, *r5
+L214: rts
+L215: .data -633, -447, 884, -706, 358, 150, 176
+L216: bne *r1
+L217: .string "tnrteuvxmhsupjbs"
+jmp *r4
+stop
+
+inc L272
+L218: lea L299, *r4
+inc r4
+red r0
+L219: .data -544, -748, -643, 898
+prn #122
+jmp L296
+; comment
+inc r4
+prn *r0
+L220: .data 344, 614
+not r5
+rts
+L221: .data -916, 824, 892, -349, -796
+L222: jmp *r4
+L223: lea L324, r2
+jmp L265
+rts
+stop
+stop
+L224: mov *r0, L236
+L225: clr L258
+L226: jmp L319
+jsr L258
+sub L229, r4
+; comment
+L227: red r2
+L228: stop
+jmp *r2
+L229: mov *r1, L245
+not r2
+L230: prn L340
+stop
+L231: .string "ceo"
+red *r5
+prn r0
+L232: .string "aqebbhsfkjvggbhtgygnbmfx"
+L233: dec r6
+not r1
+; comment
+L234: mov r4, *r5
+L235: mov #-79, *r6
+L236: bne *r5
+mov #-192, L299
+L237: .string "ty"
+L238: dec *r2
+L239: jmp *r1
+prn *r2
+add *r2, r0
+stop
+jsr *r2
+L240: stop
+rts
+add *r0, r2
+bne L333
+stop
+lea L252, *r4
+jsr *r6
+L241: .string "vhoahtvgkyrnsmmypzm"
+L242: .string "ul"
+
+jsr L320
+mov #-34, *r5
+prn #-88
+jmp L319
+cmp #-130, r7
+L243: .data 767, 412, 18, -672
+L244: .data -307, -663, -364, -690, -148, 209, -78
+prn *r3
+L245: stop
+clr *r7
+L246: cmp r1, *r6
+L247: prn r1
+L248: cmp #-79, L320
+sub #-130, r0
+jmp *r1
+not L306
+rts
+L249: rts
+clr r3
+L250: stop
+inc L308
+bne L293
+inc L279
+sub r1, *r5
+L251: jmp *r7
+inc L270
+dec L291
+L252: .string "ldzickgailj"
+; comment
+prn L340
+not *r2
+L253: jsr *r6
+
+jsr L271
+inc L316
+sub L269, *r2
+L254: jmp L317
+add #231, *r7
+rts
+L255: clr r5
+dec *r3
+L256: stop
+L257: red L265
+mov r2, L264
+dec r4
+jmp L302
+cmp #-161, #-140
+L258: lea L308, *r4
+clr *r0
+L259: add *r7, L316
+L260: jsr *r2
+inc r1
+L261: jmp L268
+L262: dec L342
+add r7, *r7
+not L269
+add r7, r2
+stop
+L263: inc L271
+L264: rts
+clr L324
+L265: .data -28
+L266: mov #-101, *r4
+lea L324, *r4
+cmp *r2, r0
+L267: .string "y"
+L268: clr r7
+add *r5, r4
+L269: clr r6
+L270: clr r3
+mov L275, *r4
+rts
+L271: mov L288, L337
+L272: inc *r2
+not r3
+rts
+L273: .data -169, 607, -573, -53
+stop
+mov *r2, *r5
+cmp L314, #200
+jsr *r3
+inc *r2
+mov *r1, L342
+cmp *r7, *r7
+sub L329, *r5
+L274: jmp *r6
+L275: .string "gworfbaidskk"
+inc r6
+L276: jsr L314
+inc L325
+red r3
+
+L277: jmp *r3
+L278: .data 633, -618, 711, -79, -561, 240, 175
+inc *r5
+dec r3
+L279: .data 49, -998, 971, 508, -558, -972, 587, -773
+L280: .string "shsdnpxtscultxosapzpnw"
+jmp *r2
+sub *r2, *r7
+L281: bne *r3
+add *r3, *r5
+L282: cmp r4, *r1
+L283: lea L317, L324
+stop
+clr *r1
+L284: red L335
+L285: rts
+L286: bne L336
+cmp #166, *r4
+cmp L320, r1
+lea L331, *r7
+L287: clr L289
+; comment
+dec r1
+
+inc r0
+add #109, r0
+cmp L290, L288
+L288: mov r2, L312
+dec *r2
+L289: mov r0, r5
+L290: .data -563, 933, -427, -407
+inc *r6
+red *r7
+lea L293, r0
+L291: clr L341
+; comment
+L292: add *r3, L334
+L293: .data 240, 745, -285, -94, 869, 282
+stop
+; comment
+jmp L320
+L294: bne L340
+; comment
+mov #-220, r0
+mov L297, *r7
+bne *r6
+lea L315, *r6
+clr L329
+lea L332, r2
+jsr L331
+L295: .string "vwdzinuviuvwbok"
+L296: dec *r3
+; comment
+L297: sub L311, r5
+dec L316
+cmp #136, #191
+bne *r3
+not *r3
+rts
+clr L338
+; comment
+L298: .data -206, -52, -159, -154
+inc *r3
+L299: .data -673, 631
+clr *r5
+prn *r7
+L300: add #-208, *r0
+L301: prn L337
+add *r2, L342
+L302: jsr L317
+cmp #-244, *r4
+bne *r5
+cmp #62, #92
+L303: mov L325, L341
+L304: red L312
+not r3
+; comment
+jmp *r3
+not *r6
+sub *r2, *r6
+lea L329, L335
+L305: jmp *r2
+add #-198, *r4
+L306: prn L317
+clr r5
+L307: .data -391, -565, 749
+cmp #-208, L319
+prn #160
+stop
+L308: stop
+L309: clr *r0
+L310: add *r5, r1
+L311: cmp L328, *r5
+jmp *r0
+sub *r5, r6
+L312: .string "sn"
+jmp L321
+L313: add *r6, *r4
+L314: jmp *r0
+; comment
+rts
+lea L332, *r7
+L315: .data -477
+jsr *r5
+not r6
+L316: rts
+L317: cmp #-33, #150
+red *r5
+lea L318, *r6
+add *r1, r0
+L318: .data 486, -506, 248, 738
+not *r5
+jsr *r4
+L319: clr *r4
+lea L342, L329
+L320: lea L337, L329
+rts
+L321: clr r7
+L322: inc L338
+not L334
+prn *r0
+L323: clr L332
+L324: .data 455, 279, -162, 916, 54, -606, -590
+cmp #0, #149
+L325: cmp *r3, *r0
+L326: .string "nlnkpjqted"
+lea L331, *r5
+L327: add L340, r4
+add #-239, *r0
+; comment
+jsr L331
+rts
+red L339
+jsr *r1
+
+clr *r7
+stop
+jmp *r3
+L328: .data -480, -772
+L329: add #-4, r7
+inc *r5
+L330: stop
+L331: stop
+not *r7
+L332: .data -986, 148, -675, -986, 453, -762
+lea L342, L335
+L333: .data -986, 354
+L334: cmp *r6, r3
+lea L335, r1
+prn r2
+L335: stop
+jsr *r6
+stop
+L336: .data 488, 58
+bne L342
+L337: .data -991, 153, -845, 908
+inc *r0
+L338: stop
+cmp r7, L339
+L339: .data -10, -421
+lea L342, *r0
+stop
+; comment
+L340: dec r0
+L341: sub #121, L342
+L342: inc *r1
+stop
+stop
@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 57
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+bne *r0
+add r1, r4
+lea L253, r1
+L0: rts
+L1: cmp *r5, L53
+mov *r5, *r2
+sub L59, r2
+L2: add *r6, L283
+sub r2, r4
+rts
+L3: bne *r4
+L4: not *r7
+lea L245, *r6
+clr L47
+dec r7
+red L39
+L5: mov #-226, r1
+L6: stop
+L7: jsr *r6
+lea L323, L133
+cmp #232, L161
+add r7, L327
+jmp *r0
+mov r7, L306
+add r3, *r6
+L8: .string "wjyampbnmwzzdgs"
+L9: red r1
+jsr *r5
+L10: clr L325
+bne L329
+prn *r5
+L11: red r7
+stop
+L12: mov #204, L45
+bne *r2
+red L142
+clr r5
+L13: stop
+L14: cmp *r7, #-34
+L15: cmp #-185, L262
+jsr *r4
+
+L16: clr *r3
+L17: mov #2, r6
+jsr L308
+cmp r0, r7
+L18: lea L33, L67
+L19: not *r0
+not L183
+prn r4
+L20: cmp *r3, #103
+stop
+jmp *r1
+L21: rts
+rts
+L22: sub r5, r3
+red L183
+bne L295
+dec L291
+stop
+L23: .string "dcixndmhadhclbavn"
+clr *r2
+L24: .string "qccw"
+L25: lea L72, L213
+L26: .string "tmxdnsnrbkbz"
+L27: prn L232
+rts
+L28: .string "gojqqcedp"
+mov #204, r3
+jmp L237
+L29: rts
+L30: .data -489, 138, 635, -876, -82, -189, -613, -239
+L31: bne *r2
+L32: stop
+jmp *r2
+L33: clr r0
+L34: add #-101, r1
+L35: jsr *r1
+mov #245, r4
+dec *r1
+lea L273, r1
+L36: .data 481, -850, -15, 532
+cmp r5, L43
+L37: stop
+L38: jmp L256
+L39: cmp r7, L55
+inc *r3
+L40: bne L187
+dec *r0
+inc r4
+sub *r3, L49
+L41: clr L272
+L42: add #-218, L315
+prn *r4
+L43: clr r5
+sub *r0, r2
+L44: jsr L149
+add L50, r2
+lea L243, r3
+L45: .data -879, 156, -421, -1, -354, 323, -413
+L46: .string "cbfyrimdclhfdw"
+red r7
+stop
+not r2
+L47: jmp *r4
+not *r4
+L48: not r3
+L49: .data -97
+L50: stop
+L51: prn L321
+jsr L227
+clr L341
+L52: stop
+; comment
+clr *r3
+jmp *r7
+L53: mov r2, *r0
+red r0
+L54: .string "njymuvcuqky"
+inc *r5
+; comment
+jmp *r2
+jmp *r6
+L55: .data -174, -877, 775, 885, 504, -404, -189
+L56: sub #211, *r7
+L57: .data -475, 636, 93, 984
+add #186, r0
+L58: cmp #-95, r5
+stop
+jsr *r1
+L59: stop
+add *r7, L99
+cmp L164, *r0
+L60: not *r6
+not r2
+mov #-157, L335
+L61: sub #-225, r7
+clr L64
+add L138, *r6
+jmp *r3
+L62: red r7
+cmp L282, *r2
+stop
+cmp #-222, L95
+jsr L268
+bne L262
+
+inc r5
+jsr *r2
+mov *r0, *r0
+L63: lea L300, *r7
+prn r6
+not r5
+L64: red r2
+L65: jsr *r3
+L66: dec L158
+L67: mov L280, *r2
+L68: .data 854, 111, -819, 729, 842, -920, -521, -479
+red r5
+; comment
+L69: sub *r5, L77
+cmp *r4, r6
+L70: .string "swcrmfsevygmkpy"
+jmp *r2
+L71: .data 77, -812, -944, 505, 87, 763
+; comment
+jsr *r2
+dec *r2
+sub L234, *r4
+rts
+L72: .string "zcqlndiqhaagm"
+L73: red L107
+rts
+prn #243
+red r0
+jmp *r7
+dec L283
+; comment
+L74: .data 397, 901, -308, 178, -148, -617, 365, 765
+L75: add #58, L316
+add #152, *r2
+add r7, L202
+mov r4, *r1
+bne L109
+clr L147
+clr *r6
+L76: mov *r0, L236
+L77: .string "xplurni"
+L78: red r0
+L79: cmp #-197, #125
+; comment
+clr *r5
+red L108
+L80: .string "raaaex"
+L81: .string "bosgpecnouxot"
+rts
+L82: mov L98, L239
+L83: .data 691, -794, -59, 565, 260, -302
+lea L250, *r7
+jmp *r4
+add L235, *r0
+L84: bne L244
+jmp L288
+red r5
+L85: prn L277
+clr L220
+sub #-208, L341
+L86: not L164
+
+mov L258, L284
+prn *r6
+not r3
+L87: .data -788, 378, 415, 773, 912, 691, 495
+prn L118
+L88: .data 926
+cmp *r3, L162
+dec r2
+L89: mov r5, L179
+rts
+bne L328
+inc *r3
+cmp #-131, *r2
+L90: prn *r0
+cmp *r6, L156
+L91: clr *r5
+prn *r5
+L92: dec *r4
+not *r2
+L93: not L324
+prn L123
+jsr *r7
+clr L132
+L94: jmp *r1
+L95: prn #-18
+jsr *r0
+jsr L105
+L96: .string "slszbkrazdvlcuccqzqz"
+lea L273, r2
+jsr L304
+jmp L137
+L97: sub #202, L284
+dec L282
+not *r7
+L98: dec r7
+lea L281, r0
+clr L102
+red L270
+jmp *r7
+clr *r0
+L99: inc r0
+bne *r7
+L100: .data 92, -629, 309, -602, -234, -903
+
+L101: .string "lgqqb"
+
+lea L246, *r5
+add L238, *r7
+L102: inc *r1
+not r5
+L103: rts
+L104: clr r2
+cmp L261, r2
+stop
+L105: .data -338, 963, 197, -572, 514, -889
+L106: .string "rouhnlongzhogcqqxswhe"
+bne *r4
+inc L292
+L107: .data 426, 983
+cmp r3, *r2
+stop
+dec *r4
+
+rts
+; comment
+add r0, r3
+; comment
+L108: .data -95, -866, 491
+not L187
+mov L314, *r1
+L109: red L145
+cmp r5, L191
+sub #88, L203
+lea L301, L229
+red L247
+L110: prn r3
+dec L311
+L111: jmp *r5
+L112: stop
+L113: bne *r2
+L114: .data -835, -948, -995, -5, 331, -421, -151, -997
+mov r0, r4
+red L267
+L115: dec r7
+L116: inc L280
+dec L337
+rts
+not *r5
+add r1, r2
+not L194
+L117: dec r7
+mov L212, r7
+jsr *r5
+L118: .data 512
+L119: stop
+cmp r6, *r4
+dec L304
+rts
+L120: mov #226, L285
+L121: red r0
+red *r4
+L122: cmp L222, #-159
+L123: stop
+add L148, r7
+rts
+inc L304
+L124: bne L254
+L125: clr *r6
+L126: inc *r2
+
+stop
+L127: dec *r2
+
+add #82, L303
+stop
+L128: stop
+L129: add L193, L267
+not r6
+L130: inc *r5
+lea L164, *r2
+stop
+dec L306
+red *r4
+red *r1
+lea L180, L238
+rts
+mov r0, *r5
+rts
+lea L311, *r6
+
+clr r2
+jsr L301
+sub L248, r0
+L131: red L224
+L132: sub r1, L168
+L133: .data 946
+L134: bne L247
+add L138, r2
+red *r0
+dec *r6
+rts
+clr L193
+dec *r5
+stop
+
+clr L253
+inc r6
+prn r3
+jsr L275
+L135: .string "vflzqerqmpg"
+L136: clr r0
+bne L265
+jmp L335
+L137: jsr *r5
+jmp *r5
+L138: .data 630, -909, -477
+inc r3
+stop
+L139: clr L227
+L140: mov r6, r7
+add L230, *r0
+mov #226, r1
+cmp *r2, *r0
+rts
+jmp L153
+; comment
+prn L174
+not L264
+L141: not L310
+L142: stop
+L143: not L205
+red r0
+L144: bne L298
+L145: cmp #-214, L207
+
+L146: stop
+red L253
+mov r7, L293
+sub L290, *r3
+cmp #-217, L249
+; comment
+; comment
+red *r4
+L147: lea L239, *r7
+L148: red r7
+L149: bne L312
+L150: .string "zzkbbpeqoxtmbqsmey"
+not L330
+
+prn #-188
+rts
+L151: .data 664, -916, 345, 242
+; comment
+L152: cmp L212, r4
+clr L240
+stop
+red L250
+dec *r4
+prn #-234
+add *r3, L285
+add r2, *r0
+L153: jmp *r6
+
+L154: jsr L207
+rts
+L155: inc *r5
+cmp *r3, #-134
+L156: stop
+L157: not L283
+inc r2
+L158: dec L188
+add *r4, r0
+L159: add #-51, *r6
+lea L187, L324
+rts
+cmp *r4, #-60
+dec r4
+mov #-46, L165
+inc *r1
+L160: mov r6, *r3
+L161: inc r1
+add r0, L313
+dec *r0
+clr L338
+L162: .data 781, 680, 454, -183, -804
+stop
+L163: add r7, L333
+L164: lea L181, *r0
+cmp r1, L188
+prn *r7
+clr r7
+L165: bne L189
+stop
+red r5
+L166: .string "yvdawlzrpogzswh"
+prn r4
+not L212
+L167: mov L198, L199
+stop
+stop
+L168: .data -126, -606, 599, -928, 98, 510
+L169: rts
+L170: jmp *r6
+sub *r6, L277
+lea L308, *r1
+L171: .string "toghl"
+
+dec r2
+; comment
+L172: sub L175, r3
+mov #199, L269
+lea L272, *r4
+lea L185, *r1
+L173: inc L204
+L174: cmp L318, #197
+red *r1
+lea L327, r3
+L175: .string "xnerjrycxbhhdymnrbazupp"
+stop
+jmp *r3
+rts
+not r0
+inc *r5
+
+
+mov *r1, L326
+L176: red r0
+prn *r3
+L177: .data 223, 781, -956, -944, -670, 819, -852, -640
+L178: .data 126, -128, 91, 854, -127
+L179: mov r3, *r1
+L180: add *r2, L289
+
+L181: .string "x"
+clr *r0
+L182: inc L296
+bne L256
+stop
+inc r3
+jmp *r1
+lea L327, r6
+L183: .string "fcp"
+L184: clr *r5
+mov r0, L249
+add r5, *r7
+jsr L295
+L185: jmp L306
+sub r6, L339
+L186: .string "tuzysyujahpbx"
+sub r5, *r2
+jmp *r3
+L187: jsr *r6
+clr *r1
+clr L313
+add *r7, L241
+jsr *r2
+inc L219
+L188: prn L288
+L189: lea L339, L342
+
+cmp L292, *r1
+L190: stop
+lea L271, *r2
+clr L325
+prn #143
+sub *r0, L297
+lea L271, r0
+clr L278
+not r0
+bne L232
+L191: clr L301
+sub r3, r0
+
+add *r1, r4
+mov L293, r4
+red L279
+L192: cmp L244, r1
+L193: mov L234, *r4
+prn r3
+L194: clr r5
+mov L304, L210
+jmp L283
+jsr L212
+L195: inc L280
+red L301
+L196: prn r5
+
+L197: inc L330
+prn r2
+stop
+jmp L218
+add r2, L244
+L198: dec L211
+bne L216
+L199: stop
+; comment
+clr L325
+; comment
+prn r4
+jmp *r4
+L200: jmp L227
+jsr L281
+red L330
+prn #188
+not *r5
+dec r6
+inc r2
+cmp r1, r5
+; comment
+L201: sub *r7, *r7
+red *r4
+L202: stop
+inc r0
+inc L234
+rts
+mov #70, L248
+L203: inc L219
+L204: red L294
+L205: not L306
+L206: rts
+L207: add #-97, r0
+L208: .data -635, 878, -238, -945, 723, -303, 530
+L209: .data -48, 21, -959, 899
+L210: lea L248, L239
+stop
+add L283, *r6
+stop
+L211: rts
+prn L339
+rts
+rts
+jsr L239
+; comment
+stop
+dec *r1
+inc *r0
+stop
+stop
+sub L282, r3
+stop
+add r1, r5
+bne L306
+inc *r5
+clr *r1
+L212: .data -929, -883, -374, 214, 72, -912, 688, 270
+dec r3
+
+jmp *r7
+
+jmp L225
+L213: .string "gjsaqameouae"
+L214: stop
+jsr *r2
+dec L272
+red *r4
+L215: inc *r4
+lea L340, r7
+bne *r0
+L216: add #62, r4
+mov r1, *r6
+; comment
+lea L337, L322
+not *r0
+red L237
+inc L301
+lea L290, L218
+prn #119
+dec *r1
+clr r6
+bne *r1
+L217: jmp L307
+L218: lea L333, *r7
+L219: jsr L229
+inc L332
+L220: .data -851, -388, 729, 979, -23, -479
+red L265
+add *r3, r0
+prn L246
+mov #-32, L235
+not L298
+
+
+L221: .string "titiefs"
+L222: rts
+L223: jmp *r7
+jmp L261
+cmp L247, r1
+L224: .string "zriubkxqsdq"
+stop
+jsr L236
+L225: bne *r5
+not *r2
+L226: .data 864, -566, 626, -725, -353, -302
+; comment
+jsr *r0
+lea L274, r3
+lea L335, L244
+jmp *r5
+L227: .string "ljxsqpuvvslrew"
+add #-161, L249
+L228: not *r3
+L229: dec r6
+L230: prn #-45
+not r4
+cmp *r7, L289
+clr L251
+add r2, r4
+L231: clr r0
+add #-102, *r0
+L232: .data -871, 767, 822
+sub #-95, r1
+L233: clr *r4
+red r6
+clr r6
+lea L337, L342
+L234: mov L238, r0
+add r4, *r2
+L235: cmp r7, #-202
+not r1
+rts
+mov r5, r4
+L236: mov #-50, r7
+lea L328, L243
+lea L299, L258
+L237: .string "rtzgg"
+jmp L292
+L238: cmp #-206, *r2
+inc r0
+not r2
+not r1
+jsr *r6
+bne *r7
+bne L314
+not r5
+mov L310, L267
+not *r5
+not r1
+prn L256
+; comment
+L239: prn L270
+L240: .string "wuiyclnqdcatscppkyvawiku"
+clr *r4
+stop
+red *r3
+red *r2
+not r3
+L241: red L266
+inc L289
+add #95, r0
+lea L278, r2
+mov #73, r5
+L242: jsr L341
+prn #150
+L243: clr *r7
+rts
+L244: .string "anwvubjcirw"
+L245: red r0
+inc r0
+red r3
+red *r6
+bne L301
+not L332
+cmp *r7, *r2
+jmp L254
+L246: .data 470, -33, 544
+; comment
+dec *r5
+L247: jsr *r0
+jmp *r3
+L248: .string "veqxxpimndywdiskgott"
+L249: inc *r3
+clr *r6
+red L290
+dec *r6
+stop
+dec r3
+stop
+L250: .string "u"
+jsr L325
+inc r3
+inc r0
+L251: not r6
+mov *r3, *r0
+L252: .data -279, -166
+L253: .string "yfs"
+red *r1
+L254: .data 612
+lea L323, *r1
+sub *r4, *r2
+rts
+lea L278, r2
+L255: .data 953, -385, -317, 905, -159, -865, 59
+lea L265, r2
+bne L320
+bne *r6
+L256: .data 13, 838, -616, -438, -315, -985
+L257: .string "wzchpup"
+lea L284, L303
+not *r5
+lea L316, r7
+L258: sub #-79, *r6
+jsr L300
+L259: rts
+dec r4
+jsr *r7
+inc L330
+clr *r3
+dec r3
+cmp L297, *r7
+L260: .data -70, 592, 995
+cmp #-211, #-189
+L261: clr *r7
+clr r5
+L262: .data -944, 984, 828, -786, 883
+not *r7
+L263: jsr L276
+stop
+prn #138
+L264: cmp *r2, #243
+inc r2
+clr r7
+red *r2
+L265: mov L342, r5
+jmp L278
+; comment
+dec r1
+dec L342
+lea L319, L314
+bne *r2
+inc *r0
+bne *r0
+L266: not r3
+L267: cmp r4, r0
+jsr *r3
+not L319
+lea L301, *r4
+L268: .string "dhvsr"
+L269: mov #217, *r3
+red r5
+L270: jsr L323
+red L282
+L271: .string "aetqfrbeua"
+bne *r6
+lea L302, L318
+rts
+lea L310, r2
+jsr *r0
+sub r0, L342
+sub r2, L278
+add #-154, L317
+not L320
+mov r1, *r2
+sub L331, r7
+jsr L326
+jsr *r5
+rts
+L272: rts
+inc r1
+dec r7
+
+jsr L312
+L273: add r2, *r3
+stop
+dec *r6
+L274: .data 683, 243, 804, -656, 865, -582, -441
+L275: clr *r1
+L276: prn r2
+bne L340
+L277: .string "jexizkwwgnuhp"
+L278: cmp L323, #-175
+dec *r4
+cmp *r6, L299
+jsr L291
+L279: clr r6
+stop
+L280: inc L330
+L281: stop
+red r4
+dec L311
+; comment
+mov *r7, L289
+L282: rts
+L283: .string "gftdtzrlxjagcgl"
+red r7
+inc r7
+sub r6, r7
+L284: jsr L323
+dec *r6
+stop
+add #82, L320
+L285: .data 566, -930, -970, 380
+jsr L320
+sub #171, L305
+not *r5
+L286: .string "treqncogcgeibjk"
+jsr L317
+jmp L329
+L287: add r5, *r7
+L288: cmp *r3, r7
+sub *r1, r7
+stop
+L289: .data -460, -377, 777, -150, -377
+inc *r0
+L290: dec L342
+jsr *r7
+jsr L291
+mov *r0, *r7
+clr *r7
+mov r2, r7
+bne L292
+cmp L308, *r7
+L291: .data -257, -795, 421
+rts
+prn #179
+cmp *r5, L315
+red r4
+not *r5
+mov r3, r3
+dec L322
+L292: rts
+; comment
+L293: not *r0
+L294: inc r0
+dec r3
+lea L321, *r6
+clr *r0
+stop
+dec *r5
+lea L323, r5
+L295: lea L311, L341
+L296: bne L314
+sub r2, *r2
+mov r7, *r6
+L297: prn r5
+clr *r2
+not *r2
+bne L328
+bne *r0
+L298: jsr L337
+; comment
+sub *r7, L324
+cmp L327, #-254
+not *r4
+
+L299: .data -353, -572
+mov #-97, L321
+cmp #-182, r0
+
+L300: lea L312, *r5
+jsr L332
+L301: sub r6, *r2
+L302: .string "k"
+sub *r1, r2
+add r6, *r6
+jsr *r2
+L303: not r3
+L304: .string "uvmlndakb"
+clr *r2
+lea L325, L338
+
+dec L341
+; comment
+L305: mov L321, r2
+prn L326
+not L310
+L306: dec *r2
+L307: .string "coufc"
+L308: sub #-214, r2
+cmp L332, *r0
+jsr L335
+bne *r5
+L309: .string "peldm"
+L310: red *r1
+L311: dec *r5
+jmp *r5
+L312: dec r2
+cmp *r6, #-131
+L313: jsr L332
+red r5
+mov r5, *r0
+inc *r5
+inc *r4
+red *r2
+L314: add *r7, *r1
+rts
+lea L343, L321
+not L320
+lea L333, *r2
+rts
+rts
+prn L337
+clr *r6
+L315: stop
+jsr L337
+L316: inc *r7
+L317: .string "bwcyj"
+L318: bne L336
+cmp r0, *r5
+inc r1
+bne *r6
+L319: lea L327, r5
+L320: cmp L340, *r2
+add r1, r6
+rts
+L321: .string "mwbou"
+inc r4
+L322: .data 322, 288, 86, 780
+L323: .string "rbaddwetvyvoxibjeyyl"
+L324: inc *r4
+L325: rts
+L326: lea L330, *r0
+L327: jmp *r5
+prn L334
+prn *r1
+L328: .data -98, 930
+L329: prn #9
+L330: red r6
+L331: .string "hyoonbdaxpaubgercafuxjkk"
+L332: not *r6
+
+sub *r3, L336
+inc L334
+inc L340
+L333: jmp L342
+L334: bne L343
+not *r3
+mov *r3, *r7
+L335: stop
+red L341
+L336: .data -747, 412, -616, 364, 366
+L337: .string "xpavskyx"
+jmp *r4
+add L342, r0
+not *r1
+add *r5, L339
+jsr *r2
+jmp *r0
+not *r5
+dec L341
+dec r5
+bne L340
+L338: jsr L340
+L339: stop
+L340: cmp #131, #203
+dec *r2
+L341: sub L343, r1
+stop
+L342: prn #207
+dec r6
+L343: add L79, r2
+add *r6, r2
+stop
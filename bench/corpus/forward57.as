@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 58
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+red r3
+L0: clr *r7
+rts
+rts
+mov #63, L69
+add #-151, L274
+L1: red r5
+red *r0
+L2: lea L163, *r4
+L3: rts
+bne *r5
+inc *r2
+L4: .data 651, -687, -72, 219, 797, -125
+L5: mov #-198, L253
+; comment
+bne *r0
+L6: dec *r0
+stop
+L7: jmp L106
+sub L193, r4
+L8: .data 652, -777, 729, 398, -888, -169
+clr r4
+lea L237, r4
+add #240, L303
+not L128
+mov *r1, *r1
+L9: jmp *r5
+prn #-149
+L10: .string "iujusrjhzopfxhcroc"
+jmp L277
+
+dec r1
+L11: bne L200
+dec *r6
+dec r4
+L12: .data -877, 954
+L13: red L293
+L14: .string "qpbuqyndpqrhiaqssr"
+not *r1
+add *r2, L261
+not r4
+stop
+cmp #209, *r4
+prn #-153
+L15: prn L172
+L16: rts
+dec *r3
+L17: bne *r4
+L18: mov *r4, r4
+rts
+red *r1
+inc r7
+L19: .string "bhxivoisoixyg"
+L20: dec L244
+; comment
+red L282
+lea L263, L34
+sub *r2, *r0
+dec L347
+L21: stop
+L22: mov L86, *r0
+sub #-109, L35
+L23: dec r1
+L24: dec *r6
+L25: .string "ljztxmfjdjkczxdx"
+L26: .string "xhacvlqijxdpwpyueb"
+L27: mov L238, *r6
+L28: stop
+jmp L249
+inc L230
+L29: not r4
+inc L196
+inc L204
+jsr L92
+add r2, r4
+not *r7
+L30: .data 455, -534, 931, 45, 54, 19, 973, 107
+bne *r6
+L31: red *r4
+not L341
+L32: bne L188
+not r2
+jsr *r2
+lea L97, L243
+red L317
+L33: sub #-105, r0
+cmp r7, L199
+L34: jsr L315
+lea L155, r7
+; comment
+jsr L62
+L35: inc *r4
+stop
+cmp r1, #9
+L36: .data 466, -57, -198, 81, 627, -166
+L37: .data -298, 187, 698, 423, -440, -446, -174, 707
+sub r4, r0
+L38: dec r1
+stop
+L39: bne *r4
+; comment
+L40: bne L332
+add *r4, *r2
+bne *r2
+L41: jmp *r3
+L42: jmp L207
+stop
+lea L280, L287
+add r2, *r3
+rts
+sub L340, r1
+bne L307
+L43: .data 800, -4, -988, -613
+not L182
+stop
+L44: stop
+L45: bne L49
+L46: jsr L47
+red r1
+bne L165
+rts
+lea L93, r0
+red *r6
+prn L128
+sub r6, *r0
+jmp *r2
+L47: red L159
+
+red L66
+L48: not *r1
+; comment
+prn L64
+L49: .data -442, 458, 215, 810, 577, -634
+bne L264
+lea L222, *r4
+L50: not *r6
+L51: .data 779, -50, 503
+mov #-196, r2
+mov *r7, L198
+L52: prn *r3
+lea L296, r0
+dec r2
+L53: jsr L62
+stop
+inc L91
+rts
+
+L54: .string "hamtmnvhfmarvgpwlbxil"
+bne L265
+add #188, *r0
+jsr *r0
+not r7
+jmp L175
+L55: red r1
+rts
+lea L284, r4
+L56: .string "xdszkmydssxynrnaiehovdw"
+red r0
+stop
+clr *r4
+L57: .string "nwxclwepgtdczrnpjvddbzc"
+stop
+L58: .data -125
+cmp L190, L234
+sub r5, *r7
+stop
+L59: .string "oulfokgcgpovys"
+L60: stop
+L61: sub *r3, L285
+not r3
+jsr *r6
+L62: rts
+bne L291
+rts
+not *r1
+jmp L231
+L63: inc *r1
+bne L74
+lea L81, *r3
+add r7, L288
+L64: .string "xmkargcfiggyry"
+jmp L146
+rts
+stop
+L65: jmp *r5
+red r7
+L66: lea L205, L221
+L67: clr L101
+L68: .data 582, 603, -990
+rts
+L69: lea L300, L150
+jsr *r7
+L70: not *r1
+rts
+; comment
+L71: .string "gtsklljxin"
+jmp L166
+sub #216, *r7
+L72: .data 468, -649, -283
+cmp L290, L177
+cmp r0, r6
+; comment
+L73: add L186, *r3
+L74: .data -792, 457, 391, -789, -694, 834, 134
+lea L282, L195
+L75: dec L318
+L76: sub L308, *r3
+mov r2, L210
+clr L253
+bne *r2
+L77: clr L210
+jsr *r4
+clr *r0
+jsr L240
+
+L78: jmp *r1
+dec r2
+L79: bne L285
+dec L306
+add L251, L234
+prn L197
+lea L332, r7
+clr r4
+L80: .data -112, -859, 597, -564, -761, 341, -39, -12
+L81: .data -535, 207, -332, -479, 138, 448, -114, -593
+not r3
+lea L178, r3
+mov #-241, L231
+sub #-147, r4
+cmp *r1, *r7
+; comment
+inc L257
+lea L192, *r1
+cmp L254, L233
+L82: clr r2
+L83: .data -148, -944, 940, 440, -250
+
+L84: inc r5
+L85: .data 484, 776
+inc r4
+sub #189, r5
+prn L139
+L86: .data -508, 890
+bne L311
+dec r5
+L87: bne L329
+L88: dec r1
+L89: stop
+red L339
+L90: red r6
+L91: .string "rnhsabercsujucimvgtnug"
+sub #-81, r1
+inc r5
+jmp *r1
+L92: .data -389, -805, 113, -766, -941, -871, -700, 226
+sub r3, L213
+sub #-5, *r0
+jmp L153
+cmp L257, L140
+L93: add *r5, r6
+L94: bne *r7
+L95: lea L227, L162
+L96: inc *r0
+jmp *r0
+mov L286, *r4
+sub r5, *r7
+mov r5, r7
+bne L151
+clr *r1
+cmp r2, #120
+L97: rts
+jmp *r3
+sub L243, r6
+L98: lea L247, *r3
+; comment
+L99: not r1
+L100: cmp #157, L171
+not r3
+cmp r4, r7
+L101: .data -145
+dec *r5
+add *r5, r4
+jmp L123
+red r0
+jmp L182
+L102: .string "kxrsjbqtylkfnfqtx"
+L103: stop
+inc *r3
+lea L314, r2
+L104: sub *r6, *r5
+rts
+L105: .data -727, 519, -315
+L106: .string "bhdbqdeljwxzhecwyaafc"
+jsr L342
+L107: mov r0, *r6
+red L323
+sub *r4, L297
+jsr L346
+inc L306
+red r5
+jsr *r4
+stop
+dec L266
+L108: sub r3, *r2
+L109: mov r7, *r5
+L110: .string "bssgtvfzdbiudjgvb"
+red r6
+not *r7
+jmp *r6
+
+jsr L114
+prn L320
+add L250, *r1
+not r4
+L111: jmp L212
+rts
+L112: prn *r7
+L113: .data 26, -674, 800
+L114: clr *r0
+L115: not L344
+cmp L331, r7
+L116: jmp L318
+L117: lea L272, L226
+mov #175, L159
+inc *r4
+clr *r3
+cmp r7, #62
+prn *r1
+clr r2
+jsr *r2
+stop
+add L278, L196
+L118: lea L308, r6
+add r0, *r2
+L119: add *r2, L284
+L120: rts
+L121: jsr *r1
+L122: prn #58
+lea L227, r3
+add *r1, r1
+clr L311
+inc r6
+L123: clr *r5
+
+stop
+L124: jmp *r6
+sub r0, *r0
+L125: .string "hlujbqjcbdi"
+stop
+clr L282
+L126: not *r2
+L127: .data -239, 493, -573, -950
+jsr L311
+mov *r2, *r4
+inc *r7
+dec r3
+rts
+add L142, r6
+dec L261
+L128: prn *r6
+jsr L141
+L129: not r4
+; comment
+L130: .string "dqmqkagoinoswbn"
+jmp L148
+sub L143, L138
+inc L303
+L131: mov L166, *r4
+L132: lea L326, r4
+not r0
+inc *r5
+cmp L228, *r3
+L133: cmp #-126, *r0
+inc r7
+red *r7
+clr r1
+L134: prn L262
+lea L295, r1
+dec L327
+
+L135: bne L292
+L136: .data -754, 992, -168
+jsr *r7
+L137: rts
+L138: sub L200, r3
+add L186, L190
+jmp *r1
+add L187, L233
+bne L205
+L139: .data 795, 947, -437
+lea L279, *r4
+jmp L313
+prn r4
+bne *r7
+stop
+sub L157, *r5
+L140: bne *r6
+add #186, L204
+not *r1
+not L286
+L141: bne L159
+add #-247, L204
+L142: clr L319
+stop
+red r4
+bne L198
+jsr *r1
+L143: .string "u"
+red *r7
+jsr *r1
+red *r6
+rts
+L144: .string "ri"
+dec L187
+L145: .string "svrqmz"
+add *r7, r3
+rts
+L146: lea L308, r7
+jmp L304
+L147: .string "ow"
+rts
+L148: clr *r2
+jmp L269
+L149: red L196
+not r7
+L150: .data 794, -638, 382, -511, 339, 564
+L151: clr *r4
+jmp L294
+jsr L237
+add L295, L324
+; comment
+cmp #103, L152
+L152: red *r4
+sub #130, L347
+rts
+L153: prn *r1
+lea L220, *r5
+not r0
+L154: stop
+dec L199
+prn #53
+; comment
+L155: .data 987, 585, -86
+jmp L172
+sub r6, L329
+L156: .data 541, 393, -517, -57
+stop
+red r5
+clr *r3
+jmp L341
+add #-99, L264
+inc r1
+jmp L172
+add L264, r1
+clr r6
+add *r2, *r2
+L157: dec r1
+jsr *r6
+jsr *r1
+L158: .string "nmjnqjklabwlfqsqxxmtuzj"
+L159: inc L291
+bne L170
+rts
+clr *r6
+cmp r7, L267
+jmp *r5
+L160: .string "qlvsgfgtdlsvc"
+L161: stop
+jsr L308
+lea L308, r0
+sub *r6, *r7
+rts
+L162: .string "oezcwxskqgkpoxzrqfca"
+jmp *r1
+rts
+lea L284, r4
+L163: rts
+prn r4
+L164: .data -342, -950, 703, -957, -213
+
+L165: add L222, L234
+clr *r0
+dec r0
+L166: clr L245
+L167: not *r0
+mov L333, r4
+dec r7
+mov #-174, L186
+jmp *r4
+L168: lea L185, r1
+not r1
+lea L246, L184
+; comment
+jsr *r5
+L169: not *r2
+not r0
+rts
+L170: prn L174
+not r0
+rts
+bne L298
+L171: jsr *r0
+L172: bne *r5
+stop
+stop
+L173: red *r6
+L174: rts
+cmp L333, *r0
+L175: rts
+rts
+L176: .string "lrzwgabh"
+add *r6, L266
+not L318
+jsr L255
+clr L266
+bne *r6
+L177: cmp r7, #-170
+L178: .data -206, 14, 780, -958, -821, -249, -265, -910
+clr L245
+bne *r7
+
+L179: lea L303, r2
+L180: sub L265, *r3
+clr r2
+L181: add r2, *r4
+stop
+L182: jsr *r0
+L183: jsr L233
+jmp *r1
+jsr L316
+red r4
+rts
+clr *r2
+jsr L190
+L184: prn *r4
+bne L320
+add L258, L261
+
+L185: lea L187, r2
+clr L294
+L186: rts
+mov *r0, L291
+jsr L191
+jsr *r3
+prn r5
+not *r7
+dec *r0
+clr r6
+lea L196, *r5
+L187: mov *r2, r0
+clr L206
+L188: add *r1, *r6
+
+cmp #-140, L312
+lea L249, r0
+mov *r7, r4
+L189: clr L269
+dec *r3
+L190: bne L305
+lea L242, *r4
+lea L211, L270
+clr *r2
+mov #-1, r6
+L191: jsr *r7
+dec L338
+L192: stop
+L193: red r0
+add *r2, r6
+L194: red L222
+jmp L248
+jsr L306
+bne *r4
+prn #251
+L195: add *r6, L303
+rts
+bne L239
+not r7
+jsr L205
+stop
+lea L239, r1
+mov L269, r4
+L196: jsr *r2
+inc r5
+; comment
+bne *r0
+add r3, r4
+L197: cmp r0, *r7
+
+clr L280
+prn #-213
+rts
+rts
+sub #-144, *r3
+clr r3
+L198: clr *r4
+rts
+L199: lea L299, *r5
+bne *r0
+prn #-243
+L200: not L285
+L201: add *r0, r4
+mov L256, L221
+mov *r5, L318
+L202: jmp L206
+add #113, L240
+L203: dec *r7
+L204: red *r5
+dec L316
+L205: .data 773, -190, -147
+stop
+jsr L295
+L206: rts
+L207: add L330, L302
+cmp #83, *r2
+clr L293
+jsr *r7
+L208: dec *r7
+prn #176
+dec L225
+L209: jmp L269
+red L281
+add *r2, *r6
+L210: .data -620, 146, -282, -957, -558
+dec L235
+stop
+L211: dec L326
+sub r2, r4
+jmp *r1
+
+L212: .data 995, 108, -120, 188, -649
+red L219
+L213: stop
+L214: .data -696, 934, -272, 82, -789
+L215: sub #-159, *r4
+L216: cmp *r5, *r7
+add #-87, L312
+cmp *r4, *r3
+stop
+rts
+prn r5
+jmp *r3
+L217: .string "prxslabmdxwy"
+L218: not L311
+L219: prn L283
+rts
+sub *r5, L229
+sub #-256, L261
+jsr L251
+inc L296
+dec r7
+dec r5
+; comment
+cmp #-243, #216
+sub #-132, L278
+L220: dec L334
+mov #29, r2
+jmp *r1
+L221: cmp #-14, #129
+L222: .string "mqwsktifjjwiiphgdv"
+L223: inc r4
+red *r3
+L224: bne L282
+red *r0
+L225: cmp *r7, *r7
+stop
+mov #99, L319
+not r1
+inc r7
+L226: .string "lmkmjkymvtmbnwdqwgpi"
+L227: .data 765, 659
+L228: .data 703, 657, -949
+L229: jsr L254
+not r7
+L230: .data 234, 657, -36, -439, 710
+L231: rts
+L232: .string "xoonprayiejubhbsejzlm"
+L233: prn *r6
+lea L256, *r3
+inc L267
+bne L287
+L234: clr L294
+bne *r5
+L235: bne *r2
+rts
+inc L247
+red L282
+prn *r0
+L236: stop
+jsr L314
+lea L307, L307
+L237: jsr *r7
+L238: prn r3
+L239: prn L294
+L240: .data -538, 789, -177
+L241: .data -318, -504
+clr r5
+add #223, L267
+sub r4, L299
+L242: mov L308, L322
+
+prn #-107
+jmp L297
+jsr L314
+jmp *r5
+prn L328
+L243: stop
+L244: stop
+inc r3
+jsr L249
+stop
+dec r5
+L245: .string "vgwzdkjayegbg"
+jsr *r2
+inc *r4
+add r2, L250
+rts
+bne L334
+L246: red *r6
+jsr L317
+dec L322
+red *r7
+mov *r0, L320
+dec *r4
+stop
+L247: cmp *r1, *r3
+L248: sub L345, r5
+jsr L275
+L249: jmp L316
+L250: cmp L294, L301
+prn *r4
+L251: .string "rfpbwbfmzj"
+stop
+sub #-191, L346
+L252: .data -32, 75, 14, 633, -271, 967
+L253: .data 260
+sub #-193, r7
+add *r1, *r3
+red *r5
+red *r4
+not L301
+stop
+dec *r4
+bne L277
+jmp L309
+dec r5
+cmp r2, #117
+bne *r1
+mov #-141, r6
+inc *r2
+add *r0, *r2
+L254: jsr L332
+cmp #231, L320
+L255: red *r6
+clr L304
+jsr L316
+lea L319, L317
+dec *r0
+L256: .string "fijh"
+inc L334
+L257: jsr L267
+L258: prn *r5
+dec *r5
+dec L281
+; comment
+L259: add L296, L265
+L260: mov r1, L324
+L261: clr r2
+L262: red *r2
+mov #-243, *r0
+rts
+lea L282, *r2
+add #233, r4
+L263: stop
+inc r7
+; comment
+L264: sub *r4, r7
+L265: .data -688, 348, -735, -260, -33, -216, 111, -455
+L266: jsr *r7
+L267: not *r3
+L268: jsr L334
+jsr L347
+cmp #-91, #-138
+L269: cmp *r2, r0
+jsr *r0
+inc L338
+
+prn r6
+jmp *r6
+L270: red L294
+red r4
+L271: .data 906
+
+L272: .data 402, 449, -24, -259
+rts
+not r4
+L273: bne *r0
+inc *r3
+stop
+red L331
+L274: jsr L281
+add *r7, *r4
+mov *r1, *r7
+lea L279, r3
+L275: not L328
+clr *r2
+L276: cmp #145, *r4
+; comment
+L277: .string "bpzzgawutjl"
+add L301, L346
+jsr *r6
+prn L294
+L278: jmp L316
+L279: jsr L280
+L280: inc L316
+lea L346, L333
+bne *r7
+L281: not *r4
+prn *r1
+red r4
+inc *r0
+L282: jmp L328
+red r2
+
+bne *r4
+sub #153, *r4
+L283: .data 345, -99, -690
+rts
+L284: lea L285, L297
+add L286, L331
+jmp L298
+mov L288, *r6
+jmp L294
+L285: jmp L343
+L286: clr L303
+L287: sub #90, r2
+L288: .data -807, -229, -532, -148
+jsr *r4
+L289: .data 434, 852, -348, -879, -665, 515, 562
+L290: .string "wzjaldwu"
+not r5
+
+L291: clr r5
+L292: red L301
+not *r1
+L293: jmp *r2
+L294: jsr *r2
+mov r1, r0
+stop
+inc r2
+cmp *r0, L331
+red L340
+L295: .string "jm"
+L296: red *r5
+rts
+; comment
+L297: lea L317, *r1
+L298: .string "xwenc"
+prn L319
+sub *r6, r7
+L299: add *r1, r3
+red r4
+rts
+jmp *r7
+bne L332
+L300: inc r2
+
+sub #60, *r4
+; comment
+prn L334
+mov #-158, *r2
+sub L346, L307
+not r1
+jmp *r0
+jsr *r7
+
+L301: lea L332, r1
+stop
+L302: jsr L325
+not L328
+not L331
+L303: .data -184, 41, 857, 174, 844, 823
+jsr L340
+L304: add *r6, r4
+not L314
+L305: bne L317
+clr L337
+lea L325, L311
+L306: bne *r4
+stop
+; comment
+dec *r5
+add #-42, L344
+dec L337
+mov r0, r6
+inc *r2
+L307: sub L337, L337
+jsr L341
+; comment
+stop
+L308: mov *r6, L326
+sub *r1, *r6
+lea L337, *r6
+prn L341
+red *r3
+not L345
+L309: .data 465, -717, 389, 549, 556, -594, 609
+L310: prn #-54
+add #111, r2
+L311: .string "ljs"
+prn r5
+mov *r1, *r0
+L312: lea L341, *r6
+add *r0, L318
+cmp *r3, #-227
+
+bne L339
+L313: add *r1, *r6
+
+clr *r7
+cmp *r0, *r1
+L314: .data -985, -350, 494, -668, 495, 26, -312, 796
+jsr L339
+lea L317, r0
+rts
+rts
+prn r1
+red r7
+L315: .data -948, 585
+L316: .data -341, 339, -683, -873, -267
+L317: cmp r6, *r3
+L318: add *r4, *r0
+L319: clr *r7
+L320: .string "ebkcbzrnkbzpp"
+L321: .data 682
+L322: dec r1
+red L327
+jmp *r0
+L323: rts
+clr L337
+red r7
+clr L347
+L324: .data 47
+add *r1, L325
+jsr *r4
+L325: jsr L340
+L326: .data -56, 657, 682
+L327: red L342
+L328: .data 774, -490, -714, 254, 380, -203, 484
+prn L340
+inc L338
+add r3, L332
+cmp r4, #231
+jsr L343
+L329: .string "tdvrwqdwle"
+L330: clr L335
+jmp L345
+L331: inc *r3
+not L346
+add L337, r4
+dec L342
+lea L340, L340
+red *r5
+cmp r3, #10
+L332: clr r4
+
+L333: .string "puotsbatnydbdbhpggnfaw"
+red *r0
+L334: rts
+inc r6
+bne *r1
+clr L345
+L335: add r5, *r6
+mov L343, *r6
+L336: stop
+mov *r7, L342
+L337: prn r0
+L338: rts
+L339: .data 161, -414, 446, 386, -381
+red *r2
+rts
+not r4
+dec r1
+sub #38, *r3
+clr L345
+dec r7
+L340: add L344, L347
+lea L344, r0
+L341: .data -526, 56, -579, 21
+lea L346, L345
+L342: cmp #137, L344
+add *r3, *r4
+L343: jsr *r3
+L344: clr *r0
+jmp L345
+dec *r5
+L345: mov r6, r5
+; comment
+dec L346
+L346: mov *r2, r2
+L347: lea L318, r5
+stop
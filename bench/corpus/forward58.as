@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 59
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: lea L329, r6
+L1: dec *r3
+rts
+not *r6
+jmp *r1
+not L340
+jsr *r0
+L2: cmp #-23, r5
+inc *r3
+stop
+clr L303
+L3: cmp r1, *r0
+lea L30, *r0
+jmp *r2
+prn *r2
+jmp *r7
+bne *r7
+not *r6
+clr L201
+stop
+bne *r7
+L4: not r3
+
+L5: jsr L192
+rts
+mov *r3, r2
+rts
+jsr L11
+L6: .data 74, -305, -455, 240
+red r4
+inc L157
+L7: red *r7
+L8: mov *r3, r2
+cmp *r7, L204
+stop
+lea L183, r1
+L9: sub r5, *r6
+L10: .string "bijrasjbnvherrepscjlmzu"
+clr r7
+L11: not r2
+red *r2
+L12: red L326
+rts
+L13: prn r3
+add *r5, L282
+clr L55
+rts
+L14: jsr *r3
+red L91
+rts
+clr r3
+L15: rts
+L16: .string "szvul"
+not *r2
+
+mov r1, L187
+jmp L304
+inc L209
+L17: .string "lxkakmgokocjyszoa"
+jsr L179
+L18: .data -988, 150, 418, -262, -199, 472
+L19: stop
+jsr *r4
+red L311
+bne L307
+jsr L185
+L20: jsr L315
+L21: dec L317
+L22: dec *r4
+cmp *r4, L221
+lea L92, L139
+mov L81, r6
+not *r4
+L23: inc r6
+L24: sub r5, *r0
+add #-157, *r4
+rts
+add *r0, r2
+not L124
+L25: .string "gkcwyoolo"
+L26: .string "kmyhtfdtjqyflbeib"
+L27: .string "zzhmxplzovdccit"
+stop
+L28: add r4, r2
+L29: bne *r4
+L30: lea L146, *r3
+; comment
+L31: cmp *r7, r7
+L32: add L335, r0
+prn r0
+L33: .data 407, -823, 288
+sub #143, r4
+inc *r6
+mov r1, *r1
+L34: sub #162, L90
+lea L106, *r5
+jsr *r4
+L35: .string "tndscwkurssfrthgzywvqvti"
+lea L344, L81
+not *r5
+stop
+L36: stop
+L37: jsr L236
+jsr L146
+L38: clr r0
+bne L143
+dec r1
+cmp #-155, *r4
+L39: red L182
+mov #28, *r0
+jmp L259
+jsr *r4
+L40: .data 639, 12, 106, 680
+clr r0
+L41: .data -828, 94, -143
+not r5
+L42: .string "ucrqkvwdvvwhpdaeldq"
+jsr L118
+lea L191, *r0
+stop
+L43: red r3
+lea L315, L232
+not *r6
+
+; comment
+L44: .data -201, -19, -427, -493, 86, 468
+rts
+L45: not L341
+clr *r6
+dec r2
+jsr *r5
+dec *r1
+L46: not L309
+L47: .string "dk"
+L48: red *r5
+mov r2, r0
+clr L132
+cmp *r0, L247
+bne L111
+clr r5
+L49: clr L175
+not r6
+red L217
+rts
+L50: prn *r7
+L51: .string "wzghsquliypckqtrgiadre"
+add #-142, *r7
+add L336, r4
+L52: bne L97
+L53: jmp L330
+stop
+bne L346
+L54: stop
+mov L188, r0
+not r5
+add L75, L124
+red r2
+not r6
+L55: .string "qspljwzkxfokc"
+rts
+L56: dec *r5
+inc r4
+rts
+L57: jsr *r2
+mov *r7, r7
+clr L67
+L58: not *r4
+L59: .data -196
+L60: mov r1, *r4
+L61: jsr *r3
+prn L109
+dec L269
+mov r1, L192
+dec *r2
+L62: jsr L193
+L63: .string "xxzlnajeaeavjx"
+lea L275, r1
+L64: jmp L198
+red r6
+not L226
+L65: .string "wiiqsjeqzcwjoywcahdi"
+L66: inc r5
+clr r1
+dec r0
+; comment
+inc L300
+inc r0
+L67: .data 556, -877, -186, -625, 575, -979, -59, 10
+stop
+not *r7
+sub #-82, r3
+clr *r0
+L68: .data -924, 170, 361
+dec r0
+add *r7, *r6
+mov #53, r0
+L69: sub r5, *r7
+not *r1
+clr L199
+
+not *r2
+sub #-113, L76
+L70: .string "uinghvydhr"
+; comment
+bne *r4
+red *r2
+L71: rts
+jsr *r2
+L72: not r2
+L73: .data 464, 708, -809
+L74: .data -732, 825, -355, 970, -227, 231
+jmp *r0
+bne L246
+
+mov r5, r7
+not *r7
+L75: bne *r7
+mov r4, *r0
+jsr *r6
+prn *r3
+mov #233, L343
+L76: jmp L89
+not L89
+stop
+L77: prn *r6
+L78: lea L117, r7
+dec L309
+cmp #-1, L298
+L79: .data 556, -250, 440, -415, 144, 568
+sub r2, r1
+; comment
+add #-173, *r0
+not r0
+add L138, r2
+lea L136, L236
+jsr L316
+L80: jsr L297
+L81: jmp *r5
+L82: inc r6
+stop
+L83: .data 343, -826, 608, 396
+L84: .data -666, -298
+red r6
+L85: .data -640, 178, -367
+L86: .string "fraftmwqzhjayrb"
+L87: .data -549, -11
+red r1
+cmp r0, L248
+; comment
+L88: cmp L277, *r7
+L89: clr *r4
+L90: .data 416, 13, -11, 534, -182, 618, 236
+L91: cmp #-20, *r7
+bne *r7
+red L314
+dec *r0
+L92: prn *r1
+L93: red L230
+jsr L197
+rts
+cmp #213, #-26
+prn r7
+jmp *r1
+L94: .data -426, 806, 575, -520, 274
+mov r4, *r4
+mov L134, *r6
+dec L101
+clr L266
+L95: add r0, L195
+not *r7
+stop
+lea L246, *r0
+; comment
+inc L207
+L96: stop
+bne *r3
+jmp *r0
+L97: rts
+L98: prn #51
+inc r0
+sub r1, L168
+stop
+cmp L108, *r6
+L99: mov *r2, r3
+L100: jmp L277
+L101: .string "vmwfvsrzizbr"
+L102: sub L168, r4
+L103: lea L283, L334
+L104: inc *r3
+mov L149, r5
+L105: inc *r0
+L106: lea L157, r4
+L107: prn #-238
+bne *r7
+lea L212, *r4
+stop
+not *r4
+jsr *r3
+
+L108: stop
+L109: add *r2, *r5
+; comment
+L110: inc r0
+cmp r7, L347
+prn #-201
+L111: bne *r1
+jsr L229
+add #162, r1
+mov #202, L230
+bne *r1
+rts
+not *r0
+L112: lea L287, *r5
+add #-9, r5
+; comment
+not L242
+not r2
+L113: stop
+L114: .string "daixfcpnttszhlydarjwhj"
+L115: bne *r6
+bne L132
+L116: not r2
+L117: mov L178, L305
+dec r5
+clr *r5
+L118: cmp r0, r5
+add *r0, r5
+jmp *r1
+red r7
+dec r7
+lea L164, r2
+clr L164
+mov r3, r5
+L119: rts
+stop
+jsr L266
+jsr L245
+
+bne *r1
+L120: not *r2
+L121: add r1, L272
+jsr *r2
+bne *r7
+cmp r3, #-236
+clr *r6
+L122: .string "rhvuczljowdopn"
+L123: jsr L181
+jmp *r5
+L124: .string "ayrmzvoa"
+sub L312, *r4
+add r5, r3
+L125: .data -835, -565, -926, 672, 155, 673, 654
+sub r4, L152
+rts
+cmp #149, L202
+L126: .string "hccotxnljrwhsjttnvkbwbvs"
+not r6
+jmp *r6
+clr *r2
+L127: bne *r4
+L128: .data -624, -287, 796, -899, 685, -638
+stop
+stop
+sub r0, L299
+L129: .data 539, 504, 778, -814, 411, -780, -691, -137
+not L255
+jsr L322
+prn #-223
+L130: .data 482, -482, -926
+
+lea L339, L325
+L131: lea L185, *r4
+red r5
+red r0
+L132: lea L247, L157
+; comment
+dec *r4
+L133: red L320
+not L152
+L134: .data -170, 814, -343, -80, -83
+sub *r7, *r5
+L135: jsr *r7
+L136: prn *r3
+prn #200
+L137: red *r3
+add r4, L236
+L138: mov L233, r4
+not *r2
+lea L296, L317
+lea L191, r0
+jmp L334
+L139: red L315
+L140: .string "to"
+L141: .string "rnxexmjuoe"
+L142: red r5
+lea L312, r0
+rts
+L143: stop
+L144: red r7
+L145: .string "wsdkdwmeqwrnjmwyvb"
+sub *r6, L316
+L146: jmp *r3
+jsr *r0
+inc r2
+bne *r5
+L147: rts
+red L162
+L148: .data 646, -773, 763, 299
+lea L335, *r0
+L149: dec *r0
+cmp L236, L322
+clr *r5
+inc *r6
+add r4, r4
+L150: .string "mpptjkkklbxatjirbw"
+inc L259
+L151: red r7
+L152: rts
+stop
+prn *r5
+; comment
+clr r0
+clr L321
+L153: jmp *r1
+jmp *r2
+L154: .string "ahcqvx"
+L155: .data 611, 795
+L156: .data 407, -765, 384, -559, 922
+L157: jmp *r3
+prn #-228
+L158: not L307
+L159: .data 292, 928, -911, 13, 63, -543
+bne L269
+dec L264
+add *r2, *r6
+inc L211
+red L317
+inc *r5
+clr L286
+jmp *r5
+mov #-233, L300
+clr r6
+rts
+L160: bne *r4
+dec *r6
+prn #-36
+L161: lea L165, *r6
+L162: dec *r5
+rts
+L163: clr *r4
+add #80, *r7
+L164: inc r6
+jsr *r7
+dec *r7
+bne *r4
+stop
+L165: dec L221
+L166: not r0
+rts
+inc r7
+L167: inc r2
+L168: inc L322
+L169: jsr *r7
+cmp L252, L205
+rts
+red r4
+L170: dec L305
+red L276
+clr r3
+dec L259
+cmp r4, L273
+L171: .string "pjrrmrilvpnclvvexhkpykgp"
+; comment
+L172: .string "obryszteqivnpget"
+add r7, L237
+L173: .data -347, -783, -367, 738, -415
+L174: .data 328, -408
+
+jmp L243
+rts
+L175: mov r3, L289
+L176: sub L295, *r1
+jmp L260
+dec *r7
+L177: bne *r7
+prn #-180
+add r0, *r4
+L178: rts
+; comment
+bne L225
+stop
+L179: stop
+L180: prn #74
+mov #115, r7
+inc L216
+cmp #-2, *r5
+L181: .string "exwvnxqbapsqxynnnwzmku"
+red r4
+sub L198, L231
+mov *r4, L253
+inc r0
+jmp L243
+; comment
+L182: add #17, r7
+clr L336
+
+cmp *r3, *r6
+L183: .string "qebucxkdldmdffhxwscgsys"
+; comment
+red *r7
+L184: .string "auarcbjmduironr"
+red L256
+sub r2, L324
+L185: .string "nssrqkstymykrralb"
+L186: jmp L226
+L187: .string "sisjzvwof"
+red r2
+L188: stop
+clr r6
+
+mov *r2, L203
+L189: stop
+stop
+lea L250, r3
+inc r6
+L190: jmp L241
+L191: .string "nslqivro"
+L192: .string "zzxgvcsfti"
+sub L277, r6
+L193: .string "nmiiqryshixccmngyvu"
+L194: .string "nxcyacwvwrjhubcjugdlsg"
+L195: lea L296, L273
+sub L291, r4
+L196: dec *r7
+red *r0
+bne L214
+dec r2
+L197: rts
+L198: not r7
+stop
+L199: lea L263, L210
+L200: stop
+jsr *r0
+stop
+bne *r1
+sub r0, L209
+L201: red L210
+L202: inc L337
+add L219, r6
+L203: jmp *r7
+clr r6
+L204: .string "xuvdgjlelcjkkcansrwg"
+cmp L309, *r3
+jmp *r7
+prn r5
+dec L297
+L205: add L235, L254
+stop
+jmp L250
+jsr L253
+prn #-110
+red *r7
+dec L305
+jmp L281
+stop
+L206: red L329
+; comment
+L207: not *r4
+L208: jmp L277
+dec r7
+rts
+L209: .string "cnurzwpbnahwkoocu"
+lea L346, r2
+sub #-114, r6
+rts
+L210: stop
+L211: jmp *r7
+jmp *r7
+jmp L345
+stop
+mov L218, *r1
+red *r0
+lea L236, L276
+L212: mov L219, L227
+lea L236, L295
+not *r6
+L213: add *r6, *r4
+L214: not r3
+jsr *r7
+L215: rts
+bne *r6
+L216: rts
+prn L268
+clr *r1
+L217: dec *r0
+mov #-112, r2
+cmp *r2, L287
+lea L225, *r6
+red r2
+not L266
+lea L239, *r2
+sub L331, *r1
+L218: clr L292
+red *r1
+inc L226
+L219: .string "bcuhrdbbrpcsxfuv"
+L220: red L315
+jmp *r3
+clr *r4
+rts
+L221: inc L340
+clr r4
+jmp L326
+jsr L316
+L222: cmp *r5, *r1
+L223: red r1
+lea L230, L275
+L224: .string "jiohxr"
+rts
+stop
+L225: dec L282
+stop
+mov r2, L246
+L226: .data 39, 757, 650, -768, -464, -336, -977, 273
+clr r7
+prn L238
+; comment
+
+L227: .data -857, -905, -495, 448, 644, 233, 619
+jsr L316
+lea L289, r4
+L228: .string "mgreiygnemc"
+dec r0
+red L343
+stop
+L229: dec r7
+prn #-160
+L230: lea L247, *r6
+bne L264
+mov *r2, *r7
+jmp L326
+jsr L310
+bne *r3
+L231: stop
+L232: mov L246, r4
+dec L292
+L233: dec *r6
+jsr *r4
+dec L270
+clr r5
+lea L290, r1
+add r4, L316
+L234: bne *r7
+not *r7
+L235: lea L246, r1
+not r3
+lea L280, L329
+L236: inc r2
+dec *r0
+bne *r3
+prn #211
+lea L278, L310
+stop
+jsr *r3
+not *r2
+inc *r1
+
+L237: add #221, *r7
+cmp r3, *r1
+dec *r1
+stop
+sub L259, L282
+rts
+dec L315
+L238: mov *r5, r7
+add L257, L277
+sub r6, r6
+stop
+sub *r1, r6
+stop
+; comment
+L239: add r0, *r5
+sub r1, L347
+
+red *r4
+L240: bne L248
+L241: add r5, L301
+jmp L331
+L242: .data 291, 413, -618, -955, -913, -905, 343
+dec L281
+add *r0, L315
+rts
+mov L295, L290
+cmp r1, L274
+L243: .string "hhdtgoqabhpdyh"
+inc L273
+dec L270
+jmp L284
+L244: red L247
+
+not L288
+red L282
+prn *r1
+sub L270, *r7
+dec r5
+jmp *r2
+mov #-220, L280
+L245: dec r3
+L246: rts
+mov #12, L335
+prn r6
+dec r2
+rts
+bne *r2
+L247: .string "zshkkyuzicnbofqzua"
+L248: add #184, *r5
+L249: stop
+L250: bne L255
+L251: lea L300, L255
+inc *r5
+lea L334, L345
+stop
+clr L272
+L252: jsr L296
+jsr *r5
+L253: bne *r4
+cmp *r3, L301
+clr L288
+red L298
+dec *r6
+inc r4
+L254: prn r5
+L255: prn #-21
+
+mov #-200, *r1
+L256: dec r6
+rts
+prn r0
+red L265
+L257: dec r5
+L258: jmp L268
+bne L274
+L259: .string "tukhmkwobfhyt"
+not r4
+lea L295, L322
+L260: jmp *r3
+inc L306
+lea L302, r7
+mov #-47, L300
+stop
+L261: not L286
+bne L327
+L262: not r4
+L263: lea L346, *r0
+jsr *r7
+dec *r4
+jmp L323
+lea L314, *r0
+prn *r1
+bne *r2
+sub L345, r1
+L264: .data -26, -790, 639, -542, -330
+cmp L315, *r7
+inc L347
+; comment
+cmp L288, *r3
+L265: sub L281, r3
+cmp L282, r3
+inc *r4
+L266: cmp #208, L327
+stop
+red L327
+dec *r7
+cmp *r0, *r4
+inc r5
+L267: jsr *r6
+L268: .data 353, -92, -970, 999, -618
+lea L325, L269
+L269: rts
+
+sub L337, *r5
+bne *r7
+not *r3
+L270: .string "grxkmq"
+add #69, r1
+mov #23, r3
+sub r0, L332
+
+clr *r2
+
+not *r4
+lea L341, r1
+prn *r1
+L271: .string "x"
+L272: .string "xkuqlvvmwdposiahedtd"
+L273: dec L309
+L274: .string "sbytpdebygfasxcuverfw"
+clr L283
+dec L286
+
+
+stop
+L275: clr r5
+L276: sub *r6, r0
+L277: bne L339
+add r1, L315
+L278: inc *r7
+jmp *r2
+mov #167, *r2
+L279: rts
+
+bne *r2
+add #169, L282
+L280: bne L309
+add L293, r5
+mov #-209, r5
+add L283, *r6
+jsr *r0
+prn *r4
+red *r0
+dec L321
+clr L285
+mov #-162, r5
+jsr L328
+mov r7, r3
+L281: cmp r2, L323
+L282: .data 623, 412, -45, 823
+not *r0
+L283: dec r4
+red *r0
+dec L302
+inc L291
+jsr L287
+jsr *r5
+prn r5
+add *r4, L308
+clr r3
+red L292
+lea L338, r7
+L284: sub #128, r0
+lea L319, r5
+bne L338
+sub *r0, *r1
+clr L295
+cmp *r5, r0
+not *r7
+cmp L320, r5
+L285: cmp L330, #163
+jmp *r4
+bne L293
+lea L302, r6
+; comment
+inc L320
+mov r5, r2
+clr L310
+clr L342
+L286: cmp *r0, r6
+L287: not L301
+bne L293
+L288: .string "hqowpxvpf"
+L289: .string "hcutyhulikgnzpfgn"
+dec r2
+stop
+lea L294, r7
+L290: sub #48, *r1
+L291: sub r0, r6
+dec *r5
+L292: mov r5, r6
+L293: inc *r4
+L294: .data 713, 99
+L295: .string "xkxrhm"
+inc r6
+inc L335
+L296: .data -717, 524, 351, -192, 600, 152, -180
+bne *r5
+prn *r4
+L297: bne *r7
+L298: jmp *r2
+rts
+; comment
+prn L342
+stop
+L299: .string "yhacpzipaxaerhysz"
+jsr L328
+stop
+inc r3
+sub #61, r4
+L300: .data -615, 801, 372
+L301: bne L337
+L302: .string "ihsbedqgrwabwnligctgafsf"
+jsr *r5
+L303: stop
+prn L346
+jsr *r6
+L304: cmp #-71, #156
+cmp r5, #-236
+jmp L337
+stop
+L305: .string "cfilsaldakqgskbgzzphval"
+lea L326, L317
+add *r0, L325
+dec L324
+L306: inc L341
+jsr L324
+jsr *r3
+; comment
+L307: jmp *r3
+clr r6
+jmp *r0
+jsr *r5
+rts
+L308: .string "delgglbbopfn"
+jsr L344
+L309: .string "felftqifoqbcj"
+lea L340, r7
+L310: .data -850, -450, -854, -543, -110, -24, 995, -893
+L311: sub #-189, *r3
+add r6, r3
+add *r0, r3
+red *r6
+mov #55, r6
+L312: inc L336
+L313: bne L346
+sub *r3, L323
+L314: bne *r4
+L315: bne *r0
+clr *r1
+L316: add L323, *r0
+L317: prn *r6
+rts
+cmp L340, #-79
+inc r2
+clr L327
+clr *r5
+mov #-53, r4
+dec r1
+L318: jmp *r4
+L319: prn r0
+dec *r5
+L320: stop
+L321: .string "mvaviizpth"
+L322: rts
+mov *r6, r5
+mov r4, r5
+not r6
+lea L335, L325
+red L343
+L323: .data -298, 325
+L324: add #-48, *r4
+L325: lea L332, *r0
+sub r2, r1
+L326: .data 14, -127, 77, 614, -269, -348, 227
+L327: lea L340, *r1
+prn #236
+stop
+jsr *r4
+L328: stop
+L329: .data -502, -843, -859, -312
+L330: mov #175, *r7
+L331: jsr L339
+rts
+jsr L333
+L332: cmp r1, *r1
+inc *r2
+red L338
+rts
+rts
+jmp L334
+jsr *r2
+L333: mov L342, L335
+L334: jmp L340
+jmp L336
+inc L344
+L335: .string "etuiwtnbq"
+L336: .string "ep"
+mov *r3, L339
+L337: mov r3, r7
+stop
+cmp r6, #-74
+L338: lea L345, r2
+rts
+L339: dec r0
+L340: clr r6
+L341: rts
+L342: red r5
+lea L345, L346
+prn #55
+cmp r4, *r7
+sub L344, r4
+L343: lea L346, *r3
+mov *r7, r3
+L344: .data 223
+sub *r2, L345
+L345: .string "mowr"
+L346: jsr L347
+
+L347: sub #194, L140
+jsr L339
+dec *r4
+mov *r4, L23
+stop
@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 60
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+L0: lea L230, L355
+add #129, L185
+sub r3, *r2
+L1: clr L91
+add L232, r2
+L2: cmp #-10, *r5
+lea L22, L300
+cmp *r3, L296
+; comment
+bne L23
+L3: jsr L335
+
+L4: stop
+mov L293, r2
+jsr *r4
+L5: .data -978
+sub #-11, L130
+prn r5
+L6: sub #-81, L72
+L7: .string "obqpnqybfrfvdcvj"
+rts
+dec L313
+sub #-223, L54
+L8: cmp #-43, *r4
+L9: red L294
+prn *r4
+L10: lea L359, *r2
+not L166
+L11: .string "pxiibsblgx"
+L12: .string "mqqknudo"
+lea L315, r6
+clr r3
+clr L254
+lea L69, *r4
+L13: not *r6
+; comment
+L14: .data 799, 160
+jsr L121
+mov #-83, r1
+L15: bne L292
+; comment
+jsr L286
+not *r5
+jsr *r2
+inc r4
+L16: cmp #120, L290
+lea L289, r3
+L17: .string "hlkxk"
+dec r2
+
+L18: .string "hgkrmdxqsrakkbkvub"
+prn #143
+L19: .string "bge"
+inc L182
+L20: .string "gsptckathbqatjypys"
+inc L73
+L21: bne *r1
+dec *r3
+jmp *r5
+; comment
+dec *r6
+L22: .string "wgekwtftmefnskjuaznz"
+L23: dec L364
+red r3
+rts
+L24: jmp *r6
+L25: dec r2
+prn *r3
+jsr L108
+L26: not *r2
+mov L227, r0
+jsr L333
+rts
+L27: .string "tqkfxdzadu"
+L28: not L137
+rts
+cmp *r1, #-167
+inc L310
+inc L342
+not *r3
+L29: not *r1
+L30: rts
+L31: clr *r4
+; comment
+jsr *r1
+jmp *r1
+lea L146, *r2
+L32: mov r6, r4
+prn L356
+red L140
+L33: bne L360
+not *r1
+L34: .string "dguzbtejfkhsepbhjtopzk"
+L35: jsr *r0
+dec L341
+add *r3, *r5
+L36: cmp r0, r6
+L37: prn L232
+stop
+L38: .string "kifffusxdodb"
+not *r6
+mov r5, L294
+L39: cmp L157, L268
+cmp *r7, r0
+L40: stop
+cmp #219, L170
+stop
+lea L277, *r0
+L41: .string "ticeyyukdfpvqigluibybhfu"
+; comment
+L42: sub r3, *r7
+bne L349
+cmp *r4, #-69
+rts
+lea L142, L202
+sub L65, L124
+add #-37, *r3
+rts
+mov #54, L70
+lea L149, r6
+dec r6
+L43: .string "jnkxahe"
+cmp r1, #24
+add L356, r3
+L44: mov *r6, *r5
+L45: lea L230, *r7
+add r5, L141
+add *r4, L135
+L46: cmp r6, #-185
+L47: red *r7
+L48: dec L243
+jsr L170
+L49: inc *r2
+
+clr *r6
+jsr L107
+clr *r6
+lea L226, L196
+clr L83
+red *r2
+L50: jsr L278
+inc r3
+L51: clr r5
+clr *r4
+L52: .data 708, 488, -61, 930
+L53: not r7
+not r3
+L54: add r5, r7
+L55: .string "dgzcgxqbuasvjtqkoqlf"
+L56: lea L274, r4
+jsr *r0
+
+; comment
+L57: inc *r5
+add L333, r4
+sub *r3, L232
+cmp r6, #-194
+mov #-30, *r2
+clr r3
+prn #-96
+L58: add *r3, *r1
+red L292
+stop
+mov L86, *r3
+red *r0
+stop
+L59: add r3, *r6
+rts
+add L65, L311
+L60: .data -144, -799, -360
+clr *r3
+prn *r1
+dec r3
+not *r3
+L61: stop
+rts
+stop
+cmp *r2, *r3
+red r4
+stop
+L62: rts
+L63: prn #114
+L64: dec L358
+L65: .string "ipx"
+L66: mov *r6, r2
+inc r1
+L67: .string "wfdzvjm"
+prn L236
+L68: red L80
+inc *r1
+stop
+not *r0
+bne *r0
+; comment
+inc *r7
+L69: bne L268
+L70: .string "bjpwlzkpeaycuduudqdoypy"
+L71: sub *r6, r2
+rts
+L72: .data 614, -941, 443, -940, -649, 289, -374
+dec r5
+L73: .string "jg"
+clr r1
+prn #233
+
+L74: .string "stoeihaa"
+clr *r1
+bne *r6
+L75: cmp r0, r7
+inc r3
+
+bne *r2
+L76: prn L199
+L77: stop
+L78: inc r1
+stop
+prn *r1
+inc *r1
+L79: clr *r5
+L80: inc *r0
+L81: mov *r5, *r0
+; comment
+prn #-210
+L82: .string "pzdkeskkdyjwpojiwrnihcs"
+L83: .data 555, 937
+mov #222, *r3
+L84: inc L317
+jmp L330
+add L222, L119
+jsr *r3
+L85: jmp L124
+add r6, L182
+bne *r1
+L86: sub L174, *r5
+L87: .data 941, -263, 576, 528, 270, 247, -958
+jsr L101
+lea L337, r5
+rts
+not L300
+L88: bne L305
+red *r5
+jmp L341
+L89: jsr L319
+stop
+mov r0, *r5
+L90: bne L95
+not L230
+sub #-115, L220
+L91: .data -125
+not L223
+L92: prn #-182
+stop
+add #249, L300
+add L232, r2
+inc L280
+red *r2
+jsr *r5
+inc *r5
+not *r4
+sub *r6, r2
+L93: red r6
+red r3
+lea L246, r3
+L94: bne L209
+
+lea L323, L363
+
+L95: sub #158, *r3
+add L325, L346
+rts
+red *r5
+L96: rts
+red r4
+jsr *r5
+L97: rts
+red r4
+L98: lea L230, *r3
+L99: sub #113, L139
+L100: red L319
+; comment
+not *r2
+add r5, *r3
+jmp *r3
+
+L101: .data 171
+L102: mov *r2, *r5
+sub #182, *r5
+prn r1
+L103: add L215, r7
+rts
+jmp *r5
+jmp L152
+L104: clr L119
+L105: .string "idshyntewmadixfmubsshoj"
+L106: red L142
+jsr *r5
+jmp *r4
+red *r6
+stop
+jmp *r7
+inc r3
+jmp L167
+add #-242, L150
+not r0
+L107: dec r0
+sub r4, r4
+L108: .string "rxvfsqifquqar"
+L109: .string "peivjazyn"
+stop
+jsr L333
+L110: bne *r3
+L111: stop
+rts
+mov #-193, *r0
+clr L324
+lea L255, *r0
+L112: rts
+L113: cmp *r6, #139
+rts
+L114: not L286
+L115: inc L347
+L116: .data 759, 307, -655, 254, -551, 957, 970
+stop
+prn #71
+L117: rts
+prn *r1
+L118: bne L198
+L119: .string "tjbxbbyw"
+stop
+sub *r5, L219
+jsr *r2
+add L263, *r2
+L120: clr *r4
+L121: clr *r6
+L122: not r7
+L123: stop
+L124: .data 910
+cmp #-176, L207
+bne L339
+lea L250, L269
+L125: dec *r5
+
+L126: sub r7, *r4
+jsr L267
+add L191, *r0
+not *r4
+
+bne L183
+add L284, r4
+L127: rts
+stop
+prn L358
+inc L143
+add r6, *r6
+L128: cmp r6, *r4
+clr L147
+bne L224
+jmp L177
+prn *r0
+rts
+L129: clr L189
+red r6
+not *r0
+; comment
+; comment
+sub *r0, L263
+L130: clr *r7
+dec *r1
+mov #94, *r0
+L131: not L274
+L132: .data 872, -323, -430, 903, -191
+jsr L359
+L133: add #-65, L332
+sub #70, *r1
+L134: add r0, L246
+sub L201, *r7
+jsr *r2
+
+rts
+add L240, r5
+cmp L331, *r4
+L135: prn r1
+lea L173, *r0
+rts
+add *r5, L187
+add #-70, L233
+lea L303, L209
+lea L301, *r4
+prn L210
+red L221
+inc *r1
+prn *r7
+jmp *r4
+L136: dec L232
+red r1
+L137: sub r1, r3
+lea L284, *r3
+dec r0
+L138: mov r1, r1
+L139: lea L207, *r2
+dec *r3
+add L203, r6
+bne L183
+lea L196, r3
+L140: mov *r3, *r2
+L141: prn r4
+L142: bne *r4
+L143: rts
+sub L343, r1
+L144: jmp *r2
+L145: .string "eiihxojns"
+L146: .data 105, -511, -163, 611, 124
+L147: stop
+L148: .string "ogerabhic"
+dec r6
+bne *r3
+dec L212
+dec r7
+lea L185, r7
+L149: not L164
+L150: .string "j"
+jsr *r7
+dec r4
+L151: stop
+rts
+prn *r1
+L152: jsr L335
+not r6
+L153: .string "yxidlgxah"
+dec *r0
+add #-132, L232
+clr r7
+red r7
+L154: .string "aogzfpctjnjv"
+L155: bne L229
+jmp *r4
+L156: red *r4
+L157: .data 636, 284, 871
+L158: cmp *r3, L203
+sub r5, r1
+L159: .string "dmcuriwertvkgl"
+L160: .string "gwgggworzzvry"
+L161: stop
+prn L235
+not r6
+not *r1
+lea L204, *r4
+sub *r4, r0
+prn r6
+L162: mov *r1, r2
+rts
+L163: .string "zespibykb"
+jsr *r0
+clr r5
+L164: .string "oqblhjqhwfhhlcxobtbfvkk"
+red r7
+L165: sub L192, r3
+L166: prn *r5
+red *r0
+L167: lea L298, L181
+L168: lea L265, *r3
+L169: inc *r3
+L170: bne *r0
+red *r6
+L171: prn *r6
+red *r2
+cmp L253, *r4
+L172: .string "lolhvfrffuushlbzj"
+stop
+jsr *r1
+bne L344
+red r6
+cmp *r1, r0
+lea L334, r5
+L173: .string "sdeqqbo"
+prn *r4
+jmp *r3
+L174: clr r4
+L175: jsr L331
+cmp r3, r3
+L176: red *r2
+not *r3
+not r0
+L177: sub L363, L209
+inc r1
+clr r1
+sub r0, L334
+; comment
+sub *r5, L195
+L178: stop
+red r2
+rts
+sub r4, L351
+L179: red *r6
+rts
+not L293
+L180: .data 373, 932, -978, 454, 661
+rts
+dec r2
+
+L181: cmp *r1, *r1
+L182: .data 689, -556, 964, 662, 440, -219, 286
+prn L245
+L183: inc *r5
+rts
+jsr *r4
+prn #-192
+rts
+rts
+rts
+stop
+add *r5, r4
+L184: .string "nsfgmlb"
+red r5
+L185: .string "sxdqve"
+bne L250
+L186: .data -306, 492, 592
+L187: .string "cvntznki"
+L188: .data 772, -892, 286, 79, -23, 998
+bne L341
+inc r3
+stop
+jmp *r7
+L189: inc r3
+L190: .data -583, -17, 982, -108, -850, -306, -909, -69
+dec *r3
+L191: add *r0, *r1
+L192: not r5
+L193: mov #242, L201
+jmp *r0
+L194: lea L207, L241
+add #-26, *r6
+L195: stop
+rts
+dec L212
+rts
+L196: .data 9, -1000, 974
+rts
+inc r7
+red L306
+cmp #80, #-99
+red L325
+L197: jsr L281
+L198: dec r2
+stop
+bne *r3
+bne *r3
+red r6
+red L221
+clr *r5
+L199: add *r2, L277
+L200: .data 742, 297, -99, -384, -457, -639, 717, 94
+L201: .data 886, -615, -733, -59, -590, -717
+not L347
+
+L202: .data 826, 444, 529, 923, 921, 275, -746, 82
+stop
+L203: .data 89, 886, 868, -565, 575, 629, -10, 408
+add #-245, *r6
+prn *r2
+L204: .data -383, 228
+jmp *r3
+bne *r6
+mov *r4, *r7
+L205: stop
+clr r1
+cmp *r3, L251
+not *r7
+clr L231
+stop
+cmp #-242, *r1
+inc r2
+add *r1, L226
+L206: lea L240, r5
+prn #-158
+rts
+L207: inc *r7
+jmp L342
+prn r2
+L208: sub L347, *r7
+sub #-68, r7
+cmp #-223, #-41
+lea L229, r1
+red L268
+L209: prn *r5
+clr *r7
+clr r6
+rts
+rts
+not r6
+L210: clr *r2
+L211: mov #120, r4
+
+clr L264
+inc r6
+sub r5, *r4
+L212: lea L295, *r4
+stop
+not r6
+L213: .data -138, 252, -469, -993, -518, 515, -267, -400
+
+L214: lea L344, r7
+L215: .data -807, 812
+jsr *r2
+jmp *r5
+L216: red *r4
+add *r2, *r5
+add r7, r3
+jmp L300
+dec *r7
+L217: jmp L288
+L218: bne *r7
+L219: inc *r4
+
+dec r1
+L220: .string "bqvpaixonabrk"
+clr r4
+jmp L231
+mov *r3, r4
+dec L264
+
+L221: clr *r1
+cmp #7, *r7
+red L296
+not *r6
+L222: rts
+not r4
+add #23, r6
+sub r7, r0
+inc *r5
+L223: .data 852, -259, 275, 541, 804, -969, -113, 441
+jmp L285
+L224: clr *r2
+not *r0
+jsr L352
+cmp L227, L322
+L225: .data 273, -307, 621, -236
+L226: jmp L362
+lea L334, L328
+L227: .data -887
+L228: red *r6
+cmp r3, *r5
+L229: jmp *r5
+L230: .string "xqsim"
+rts
+lea L234, r6
+inc r5
+jmp L278
+L231: stop
+rts
+not r5
+L232: .string "hibgkjnax"
+L233: .data 322
+L234: not L357
+L235: .string "vwdyztjcqjxaft"
+cmp #-177, L285
+jsr *r5
+L236: stop
+lea L302, r7
+L237: dec L294
+jsr *r2
+L238: .string "mxxjky"
+sub L239, L283
+L239: .string "nzhyfeypclov"
+L240: stop
+stop
+L241: stop
+cmp L324, #-202
+jsr L274
+; comment
+inc L337
+L242: .string "admammtpxyvciuulzzgzmm"
+; comment
+L243: .data -353
+L244: inc r6
+dec r7
+L245: .string "g"
+red *r7
+not *r0
+L246: bne *r0
+add *r6, r4
+dec r2
+L247: .data 868, 262
+L248: jsr *r5
+sub r7, *r2
+L249: lea L261, *r7
+L250: jmp L341
+L251: clr r5
+L252: not *r1
+stop
+L253: rts
+L254: jsr L266
+add *r6, *r0
+L255: jsr L334
+prn *r7
+L256: .string "gmdiwyrlmjanfardryapigoo"
+jsr L356
+stop
+jmp *r4
+jmp L270
+rts
+L257: lea L272, L352
+L258: sub r3, *r5
+jmp L288
+L259: inc r5
+jmp L354
+sub #168, r5
+mov r5, *r3
+not *r1
+lea L295, r4
+L260: .data 840, -640, -125
+stop
+L261: inc *r7
+bne L308
+L262: dec r6
+L263: .string "amxzfciyzvrnbtkgwrjeiewj"
+; comment
+rts
+L264: red L270
+L265: clr *r3
+rts
+clr *r2
+L266: mov L349, *r2
+red r4
+dec r0
+L267: prn #-116
+stop
+add *r5, L344
+L268: .data -604, 663, 396, 843, -401, -978, 337
+bne L271
+L269: clr L270
+dec L304
+lea L270, L291
+sub *r1, *r1
+stop
+red *r6
+red r1
+L270: .data -649, 126, 888, -883
+bne *r0
+L271: .data -922, 468
+L272: clr r2
+L273: jsr *r7
+cmp #245, L338
+jmp *r1
+cmp L337, L288
+L274: sub *r1, r3
+clr r6
+L275: jsr *r2
+L276: jsr L299
+jmp L319
+
+jmp L345
+sub *r0, L285
+red *r1
+rts
+stop
+L277: .data 606, -379, 220, 434
+sub L281, L349
+L278: red L327
+not L341
+inc *r4
+L279: jmp *r7
+lea L291, *r4
+L280: mov L281, r2
+L281: not r6
+inc L296
+stop
+prn r2
+L282: bne *r3
+L283: .string "ltufisrbuz"
+L284: sub #201, r2
+L285: inc L286
+prn L339
+clr L292
+L286: bne *r3
+rts
+jsr *r3
+lea L307, *r1
+inc L363
+L287: bne L302
+mov r6, r4
+red r4
+L288: clr L328
+L289: jmp *r2
+L290: clr *r7
+mov *r4, r7
+lea L309, *r1
+L291: .data -82
+L292: .string "mzligiqhjkstxqpess"
+L293: cmp *r1, #4
+bne *r1
+stop
+L294: .string "amfzwmatgzlpsq"
+L295: jsr *r1
+L296: stop
+stop
+L297: red r6
+not L352
+L298: .data 740, -512, -904, -901, -261
+sub r4, L307
+cmp *r7, #-210
+jmp *r5
+L299: .data 448, 886, 690, 319, -296
+red r5
+L300: not *r7
+red r3
+mov #198, L302
+L301: .data 862, 910, -261
+dec L328
+L302: inc r5
+L303: jmp L342
+L304: .data 957, 333, -712, -308, -491, 525, 633, 505
+lea L349, L333
+L305: prn *r7
+L306: dec L363
+L307: add L359, r1
+rts
+rts
+clr L328
+dec L347
+mov *r7, *r5
+L308: jsr *r6
+mov *r2, L350
+dec *r5
+jsr L315
+jsr *r6
+dec *r6
+L309: mov #4, *r5
+L310: mov *r1, r7
+prn *r0
+mov L313, *r2
+add *r6, L320
+not *r6
+L311: lea L338, r5
+L312: dec L364
+L313: rts
+L314: mov *r7, L349
+; comment
+prn L325
+L315: .string "udeeiwrdzowutevlnr"
+bne L347
+stop
+clr *r4
+bne L326
+
+add #159, *r2
+L316: jmp L362
+rts
+dec L321
+inc *r0
+L317: bne L349
+jsr *r1
+not *r4
+sub #-84, *r0
+bne L321
+L318: sub #-45, L356
+L319: not r3
+L320: not *r6
+L321: sub *r4, r2
+L322: inc r2
+L323: bne L351
+sub #-140, *r5
+jsr *r5
+inc *r5
+bne L344
+L324: mov L355, L334
+L325: add L335, *r7
+L326: bne L331
+jmp *r2
+L327: .string "uupbrxvdihgghqjxngjbxblo"
+L328: jmp L350
+prn L348
+dec *r4
+add *r5, r7
+jmp *r2
+not r0
+not r4
+clr *r0
+L329: inc L340
+add *r2, L345
+add #-31, L337
+L330: jsr *r1
+L331: stop
+not r1
+L332: clr L334
+L333: .string "aqfapjhahhl"
+sub *r2, *r2
+mov #-237, *r0
+rts
+L334: rts
+inc L353
+bne *r2
+cmp L361, #-256
+bne *r6
+red r6
+L335: not *r2
+L336: rts
+not r4
+not L337
+rts
+bne *r1
+jsr L360
+L337: .data 541, 431, 593
+jsr *r2
+L338: not r7
+
+prn r4
+sub #103, *r5
+prn *r4
+L339: .string "arcvmcdbbnijgo"
+bne *r7
+inc L350
+jsr L356
+L340: .string "silnebjua"
+L341: prn #108
+L342: .data 157, -11
+L343: lea L347, L347
+dec *r5
+rts
+lea L349, L360
+dec L354
+lea L345, r7
+; comment
+dec L353
+L344: inc r4
+cmp #-44, r6
+jsr *r4
+L345: not *r2
+stop
+lea L360, r6
+L346: not *r1
+L347: jsr L349
+dec r0
+not r7
+clr *r4
+L348: .string "abvhwihlqwnkuplss"
+jsr *r0
+not *r3
+L349: lea L351, r4
+clr *r6
+inc *r4
+bne *r6
+L350: jmp *r4
+L351: prn L352
+L352: rts
+sub L359, r0
+cmp #234, L354
+dec r0
+stop
+dec L355
+L353: cmp r2, r0
+stop
+clr r0
+cmp #-122, #-125
+jsr L359
+red r0
+jsr *r7
+rts
+sub r3, r5
+L354: jmp *r7
+bne L363
+L355: lea L363, L356
+not *r0
+inc *r0
+bne *r4
+bne *r4
+rts
+rts
+lea L362, L364
+stop
+L356: mov L362, L358
+prn *r7
+lea L358, r2
+dec L358
+L357: .data -790, -67, 727
+not *r1
+L358: inc r3
+jmp L364
+bne *r4
+mov L361, L360
+jmp L361
+stop
+jmp L364
+L359: cmp L360, *r0
+L360: rts
+red r4
+L361: not *r1
+prn L364
+jmp *r1
+L362: stop
+mov *r5, *r3
+jsr *r6
+L363: dec L364
+mov #-224, r6
+red L364
+add #19, L364
+lea L364, r3
+mov #249, *r0
+rts
+L364: .data 646, -778, -881
+stop
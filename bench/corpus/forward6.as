@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 7
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: jmp *r6
+add *r3, *r5
+jsr L288
+L1: cmp #-66, r1
+L2: jsr L310
+cmp #126, r2
+sub r1, *r0
+L3: prn #232
+L4: jsr *r2
+dec *r5
+L5: red r0
+; comment
+prn *r4
+jsr *r3
+L6: red r2
+inc *r6
+L7: red *r0
+dec r3
+L8: red L269
+jmp *r6
+jsr L25
+dec *r2
+not L288
+not L108
+L9: .data -513
+not *r6
+not L340
+prn *r1
+L10: .data 298, -364, -9
+L11: jsr *r5
+sub *r6, L136
+L12: sub *r7, r0
+L13: inc L315
+L14: .data -955, 410, 759, -233
+L15: sub L128, *r1
+stop
+mov L102, r4
+rts
+L16: clr L66
+red *r2
+L17: .data 49, -339, -805, 836
+inc r0
+L18: .data -731
+add *r4, *r5
+L19: cmp *r0, *r7
+sub #102, *r1
+add *r1, L225
+L20: .string "yhbkrosjsdv"
+L21: mov #-93, r0
+inc r3
+stop
+cmp r0, #-147
+L22: red r6
+cmp *r2, *r4
+bne *r1
+dec r2
+jmp *r2
+bne *r2
+dec *r0
+L23: inc r1
+cmp *r0, L42
+bne L150
+lea L214, L206
+L24: sub r4, r6
+stop
+L25: .string "weze"
+sub r4, r1
+prn *r4
+rts
+L26: .string "vccdqa"
+L27: not *r7
+cmp r7, *r4
+L28: .string "fzsjvdgbptem"
+L29: red r0
+L30: lea L265, L195
+bne *r6
+L31: prn L85
+L32: jsr L152
+not L33
+dec r2
+dec *r1
+; comment
+inc *r0
+prn L331
+prn #206
+L33: add L122, r5
+L34: .data -224, -425, -926, 628, 163, 264, -985
+L35: stop
+sub #147, *r5
+mov r3, L229
+L36: .data -957, 200
+inc r6
+
+L37: .string "eznbzcxzbksahbgsm"
+; comment
+L38: jsr L211
+L39: mov L140, *r2
+L40: inc r3
+L41: not L293
+add *r2, *r2
+mov *r6, L139
+
+L42: prn L239
+jmp *r5
+cmp #106, #141
+
+L43: stop
+
+mov #78, r3
+stop
+bne L68
+L44: cmp *r7, *r0
+L45: mov L132, L64
+L46: clr L158
+bne *r4
+jsr *r5
+not L339
+red *r6
+not L322
+L47: .data -526, 110, -962, -555, 371
+L48: cmp *r4, *r4
+prn L93
+cmp r7, L166
+jmp L304
+L49: clr L324
+L50: .data 227, 900, 311
+rts
+rts
+prn r1
+mov *r5, *r5
+lea L88, r5
+bne *r4
+sub *r4, *r2
+bne L346
+cmp r1, *r7
+add r3, *r1
+
+prn *r7
+L51: inc *r2
+L52: .string "sbqsa"
+L53: .string "kw"
+dec L87
+L54: lea L303, L243
+L55: inc *r6
+inc L68
+L56: cmp #-170, *r7
+red L294
+rts
+jmp *r4
+jmp *r3
+L57: inc r3
+jsr *r1
+not *r1
+; comment
+inc r4
+L58: .data -168, 254, 238, 991, -129, -113
+clr r1
+jsr L102
+lea L66, L165
+sub L228, r6
+; comment
+bne L320
+; comment
+L59: add #88, L110
+dec *r1
+rts
+bne *r7
+L60: .string "fpbdvuvyfutnibutegbt"
+L61: .data -575, 348, 688, -301
+mov L311, L111
+clr *r0
+bne L214
+prn r7
+L62: .data -176, -282, 987, 176
+rts
+red r3
+L63: lea L277, r6
+L64: dec r7
+inc *r2
+L65: jsr L227
+cmp #-81, r6
+L66: not L177
+L67: clr L71
+rts
+; comment
+L68: jmp L75
+mov r6, L276
+lea L143, L84
+lea L153, r0
+lea L197, L90
+add L329, r6
+red *r2
+L69: mov #-210, r1
+jmp *r6
+L70: lea L93, L253
+bne L238
+jmp *r2
+clr *r4
+sub *r2, L278
+not *r3
+rts
+L71: add L83, L172
+; comment
+L72: not r5
+L73: bne L304
+bne *r2
+red r7
+L74: inc r5
+rts
+sub #170, L230
+jsr *r6
+L75: dec r4
+L76: .data -584, 969, -272, 143, 132
+stop
+L77: inc L291
+clr r7
+lea L295, L118
+L78: jsr *r5
+lea L201, *r6
+clr L153
+clr *r3
+jmp *r2
+stop
+L79: jsr L197
+L80: .data -974, 320, -547, 342, -283, -409, -33
+prn #-128
+L81: clr *r1
+; comment
+L82: dec r5
+dec L207
+not *r1
+L83: lea L179, L166
+cmp L267, #-178
+jsr L110
+L84: prn r4
+L85: .data 100, 788, 730, -35, -213, 581, 786, 96
+jsr L157
+L86: stop
+L87: lea L246, r4
+L88: red r5
+L89: inc r5
+L90: lea L347, *r2
+mov *r4, r7
+L91: .data -468, -857, 99
+jsr L250
+L92: .string "ynmrjghlp"
+; comment
+L93: .string "zqkas"
+mov #-77, *r4
+cmp #247, *r2
+cmp #144, #-137
+clr r6
+red L330
+L94: prn L139
+inc r0
+L95: .data 132
+
+mov *r6, *r0
+jsr *r3
+L96: .string "kbnpttnanfpmbet"
+not r5
+L97: jsr *r3
+L98: stop
+rts
+cmp L104, r0
+L99: .data 59, -232
+L100: .data 541, 942, 556, -269
+stop
+bne L194
+rts
+red *r0
+clr r6
+jmp *r2
+jmp L246
+stop
+L101: bne L308
+clr r3
+sub #202, L196
+bne L290
+clr L120
+jsr L143
+clr *r4
+L102: inc L272
+prn *r5
+jsr L224
+rts
+red r3
+L103: dec L349
+add r7, L339
+cmp L154, #-251
+L104: dec *r2
+sub *r1, *r0
+red r4
+cmp L198, r1
+L105: red *r4
+L106: bne *r0
+mov *r7, r7
+prn L218
+add L317, r4
+L107: clr L192
+rts
+not r7
+inc *r3
+L108: cmp r1, r5
+prn *r2
+sub r3, L255
+L109: rts
+L110: dec r4
+L111: .data 531
+L112: sub #-70, *r3
+L113: .data -116, -186, 868, -820, -466
+
+stop
+rts
+clr *r6
+L114: stop
+L115: .string "clsmdrvzuwidtvhgmiot"
+L116: .data -307, -38, 488, 632, 923
+
+bne *r2
+rts
+bne *r0
+jsr L232
+jsr *r1
+L117: red L298
+L118: cmp L321, #-158
+sub r6, L287
+L119: prn #-87
+L120: lea L321, L144
+clr *r1
+L121: clr *r1
+L122: .data -663, 161, 638, 191, 222, -204, 204, 405
+add *r3, L292
+prn r7
+inc r0
+prn *r5
+red *r0
+L123: .data -215, 600, 810, 342, -149, -34, 410, 139
+L124: dec r4
+add r4, L226
+L125: cmp #5, L349
+L126: mov *r1, L188
+dec *r5
+jsr L145
+prn *r5
+
+inc *r1
+clr r2
+cmp #116, r7
+L127: bne L276
+L128: prn r2
+jmp L271
+not L186
+sub L241, r5
+add L335, *r5
+inc r4
+mov *r6, L131
+L129: cmp r6, #36
+jmp L145
+not r2
+add *r5, *r4
+L130: jsr L158
+L131: .string "ezxvmrsduhucnxxcb"
+rts
+L132: rts
+clr *r1
+prn r3
+jmp L193
+jsr *r0
+L133: jmp L253
+mov L305, L327
+L134: inc r6
+add #-97, *r6
+red r0
+sub L172, *r7
+L135: .data 532, -380
+lea L185, r5
+L136: inc r3
+sub L159, L141
+bne L251
+jmp L200
+sub r3, L284
+L137: stop
+cmp L316, *r4
+
+sub L279, r1
+sub L323, r7
+L138: stop
+mov #-194, r1
+L139: mov #140, L157
+L140: not *r2
+L141: jsr L316
+; comment
+stop
+cmp r4, L247
+bne *r5
+L142: .data -675, 475, -644, -977
+not *r5
+L143: sub *r0, *r5
+lea L216, *r5
+not r2
+L144: red L216
+add L236, L345
+L145: mov L329, *r7
+L146: red L200
+sub L197, r5
+dec *r6
+stop
+not L262
+not *r7
+clr r5
+dec *r6
+not r4
+rts
+L147: not *r5
+jsr L328
+L148: stop
+L149: prn *r1
+L150: sub r0, *r2
+jmp L209
+mov r1, L340
+inc L176
+clr L216
+add L281, *r0
+red L269
+clr r5
+add L222, *r5
+lea L175, L263
+
+
+jsr *r1
+L151: mov r0, r1
+jmp *r4
+L152: prn #-53
+L153: .string "vyhfgtlmsnv"
+add #72, r2
+L154: sub L313, *r7
+
+cmp L330, L268
+L155: sub #132, L258
+jmp L244
+L156: cmp #22, L234
+jmp L262
+jsr *r6
+L157: inc L316
+stop
+L158: .string "eyzxbsyjurzlxohpzutgj"
+; comment
+dec *r4
+L159: .string "soodklacfubhwjpsabawmh"
+L160: sub L286, r7
+L161: not *r7
+not r3
+lea L269, r2
+mov *r2, L325
+cmp L224, #110
+rts
+inc r0
+
+; comment
+L162: .data 330, -839, 725, -47, 572
+L163: clr L240
+dec *r3
+not *r0
+L164: .data -621, 614, -120, 691, 440
+dec *r5
+L165: clr L253
+not L248
+
+red L294
+L166: jmp *r5
+L167: cmp L190, r5
+dec *r7
+L168: rts
+L169: not L189
+L170: .data 225, -470, -264, 426, -536, 743, 395
+stop
+L171: .data -900, 35, -560, 731, -922, -712, 280
+dec r1
+mov #-86, *r5
+inc r0
+bne *r4
+; comment
+L172: .string "achwej"
+red L225
+L173: not L191
+L174: stop
+rts
+clr *r0
+jmp *r6
+bne L307
+dec L287
+dec r6
+L175: .string "awisinxtlm"
+jsr *r3
+cmp L184, *r6
+L176: sub *r2, *r4
+dec r0
+bne *r2
+stop
+L177: jsr L256
+red *r1
+mov L305, *r5
+mov #13, L321
+not *r4
+clr L188
+L178: prn *r7
+clr *r0
+L179: stop
+L180: lea L188, r0
+L181: mov #238, r6
+jmp L315
+sub *r5, L223
+L182: .data 816, -300, 156, -726, 670, -760
+L183: .string "avtcvtgcsgwnidtmhoedxkd"
+jsr *r2
+stop
+inc L241
+bne *r1
+L184: red L278
+clr r6
+jmp *r3
+sub r3, *r1
+dec L328
+L185: prn r7
+L186: .string "qdkdvixjpdlpygrwins"
+lea L309, r6
+not *r1
+sub #-223, L310
+cmp r2, *r4
+L187: sub L221, L196
+rts
+dec L330
+L188: jsr L241
+L189: clr r2
+stop
+L190: prn L307
+L191: not L245
+inc L332
+cmp L278, r0
+L192: bne L325
+mov L323, *r2
+L193: not *r1
+red r2
+L194: mov #148, L291
+L195: dec L348
+L196: .data 471, -491, -140, -871, -561, 593, 801
+L197: bne *r5
+not L264
+L198: clr *r2
+; comment
+L199: .string "hubjzlpordooydx"
+inc L328
+L200: .string "ygwhcgulrnivxoco"
+cmp *r7, #46
+L201: jmp *r2
+rts
+
+dec r2
+jsr *r2
+red r1
+L202: lea L250, r4
+L203: stop
+bne L205
+L204: .data 184, 268
+clr *r3
+L205: sub #184, *r0
+L206: red *r0
+L207: .string "hixiljmdtskapauoysdmhrc"
+prn #-63
+red L229
+L208: dec L241
+lea L227, r2
+L209: jmp L234
+jsr L287
+L210: inc r6
+
+stop
+L211: prn L214
+L212: rts
+mov r1, *r5
+jmp L318
+L213: jsr L305
+dec L255
+red L260
+add #-116, r4
+L214: .data 28
+L215: stop
+L216: bne *r0
+mov L246, *r0
+stop
+bne *r3
+rts
+bne *r7
+stop
+L217: .data 809, -572, -423, 338
+L218: sub L327, r2
+L219: not *r4
+bne L223
+clr *r4
+jmp *r2
+cmp L337, L234
+lea L234, *r0
+L220: cmp #213, L226
+add L265, r7
+jmp L243
+bne *r6
+add *r4, L237
+add L236, r4
+clr L311
+stop
+dec *r1
+L221: .string "n"
+red L286
+cmp *r1, L301
+clr L340
+jsr L333
+stop
+L222: .data -926, 517, -913
+L223: red L254
+stop
+rts
+dec *r7
+mov #92, r7
+lea L332, r1
+L224: bne *r3
+lea L309, L258
+jsr *r2
+L225: .string "xdckrlzpv"
+L226: dec r5
+mov #141, *r2
+L227: .data -24, 335, -918, 29, -988, 861, 759
+bne L344
+add r6, *r5
+lea L333, *r3
+L228: not *r7
+not L248
+L229: rts
+mov r2, r4
+bne *r2
+add r0, *r5
+prn r4
+not r5
+red r1
+
+L230: jmp L245
+L231: bne *r3
+jsr *r2
+lea L330, r2
+L232: rts
+L233: stop
+rts
+rts
+bne L278
+jmp *r6
+sub *r4, r1
+prn r6
+red *r1
+L234: .string "jyswexadplmtgonlyqibl"
+cmp r3, #-11
+dec L337
+rts
+inc *r6
+L235: .data 423, 244, -45, 452, -493, -271, 249, -959
+sub L350, L317
+prn #-75
+jsr L334
+L236: lea L263, L253
+
+add *r0, L241
+L237: cmp L280, *r0
+clr r6
+not *r5
+dec *r7
+jsr *r5
+red r6
+L238: prn *r1
+not *r6
+red L347
+dec L300
+L239: cmp #-208, L263
+
+L240: dec r2
+not *r3
+jmp *r3
+bne *r2
+clr L306
+L241: jsr *r7
+
+; comment
+L242: .data -206, 34, 851, 291, 262
+mov r2, r2
+L243: red L322
+inc *r3
+L244: .string "jevreovny"
+dec *r2
+red *r6
+jsr L304
+lea L297, *r6
+L245: sub L248, L298
+not L255
+L246: dec r7
+cmp *r4, r0
+prn *r6
+L247: not *r6
+L248: inc L350
+clr *r1
+red L336
+not *r1
+dec *r2
+stop
+L249: add r6, L262
+L250: .string "w"
+red r1
+mov #-89, r3
+L251: sub #-241, r1
+; comment
+; comment
+mov #28, L321
+L252: stop
+lea L258, L301
+rts
+prn #-170
+bne *r1
+bne L315
+not r4
+mov #196, r4
+stop
+L253: .data -30, 14, -540, -315, -405, 688, 982, 59
+sub r2, L260
+jmp *r6
+L254: sub r3, r6
+L255: inc r2
+L256: cmp *r4, L334
+L257: mov r4, L335
+inc L318
+prn #253
+bne *r4
+L258: jsr L329
+cmp *r5, L306
+L259: lea L325, r1
+clr L344
+rts
+L260: lea L263, *r4
+; comment
+L261: rts
+bne *r2
+not r4
+cmp #-54, r5
+prn *r7
+L262: dec L265
+L263: bne L328
+dec *r3
+mov #17, r5
+mov r7, L332
+bne L329
+stop
+jsr *r3
+bne *r1
+L264: stop
+add #215, *r6
+lea L332, L310
+L265: clr r0
+not *r0
+; comment
+L266: .string "gnaovvoga"
+L267: .data 601, -893, -463, 89, -837, -338
+not L285
+sub #-84, L339
+sub #80, *r5
+L268: .data 498, -759, -543
+add r6, L293
+jmp L278
+L269: add *r6, *r0
+dec L324
+add #-242, *r1
+L270: rts
+L271: add #-172, L272
+L272: dec L282
+clr r6
+L273: dec r2
+; comment
+stop
+L274: .data 212, 915, 649
+L275: .string "azknfvanwjgvdopmpen"
+jmp *r0
+rts
+L276: .data -306, 605, 986, -117, 143, -756, 194
+jmp L341
+L277: rts
+cmp *r0, L334
+not r6
+clr r3
+cmp r3, #19
+L278: .data 999, 518, 344, -180, 695
+jsr L304
+L279: mov L288, *r4
+L280: .string "bihgmslyuogfkunuu"
+; comment
+jmp *r7
+L281: red r0
+inc *r5
+lea L325, *r7
+cmp *r7, L316
+not *r2
+sub L314, *r7
+rts
+L282: add *r6, r3
+L283: add *r5, r0
+rts
+L284: not r4
+L285: add r4, *r1
+dec r7
+mov *r3, *r2
+sub L301, r7
+jmp L332
+not *r3
+L286: jmp *r1
+prn *r3
+sub r2, r4
+prn r1
+L287: .data -721, 353, -316, -163, 827, -175
+rts
+lea L300, *r7
+L288: .data -344, -294, 49, -764
+L289: mov #134, *r3
+L290: red r5
+L291: not r5
+L292: not *r2
+red L296
+lea L348, *r6
+L293: mov #148, *r6
+jmp L333
+L294: stop
+; comment
+L295: prn L298
+bne L332
+red r2
+L296: stop
+jsr L316
+L297: dec L325
+L298: cmp #186, L316
+dec L332
+prn L334
+sub #68, r2
+mov r7, L317
+clr L310
+L299: prn #-195
+lea L327, r4
+dec *r4
+lea L300, L323
+cmp r5, *r1
+
+not L317
+not *r0
+L300: jmp L313
+inc L331
+
+stop
+L301: lea L303, r4
+L302: jsr *r4
+jmp *r2
+dec r5
+L303: inc L349
+L304: lea L336, r3
+L305: sub *r2, *r1
+
+L306: .string "tq"
+; comment
+add *r1, *r1
+L307: .string "sjw"
+red *r3
+rts
+jsr L325
+L308: mov L330, *r2
+L309: inc L347
+not r5
+L310: add #-46, *r6
+L311: lea L319, *r7
+mov L321, r0
+L312: .data 326, -319, 325, 808, -389, -49, -205, 76
+L313: jmp *r6
+bne L344
+L314: .data 546, -365, 182, 702, 727, 958, -35, 799
+add L343, *r6
+L315: cmp *r5, r1
+L316: .string "yrfjmvew"
+jsr *r6
+L317: .string "r"
+L318: add r6, r3
+L319: .string "elzdxjxjgfcifjrcxflntz"
+cmp L324, *r5
+mov *r6, r6
+prn *r6
+dec r7
+cmp r3, L337
+clr r6
+L320: .string "ifiteqahnhjq"
+; comment
+lea L324, *r1
+L321: stop
+lea L328, L323
+red *r1
+L322: sub #-81, *r5
+rts
+L323: dec L347
+red r0
+stop
+bne *r7
+not *r0
+cmp r3, #-214
+L324: red *r4
+dec L335
+L325: .string "lrjc"
+L326: add L331, r0
+rts
+cmp L342, *r4
+not r2
+jmp *r0
+sub #-49, r4
+L327: clr *r4
+L328: .data 240, 748, 353
+inc *r2
+mov #-90, r2
+cmp r7, *r4
+L329: .string "dx"
+clr *r1
+rts
+red L340
+inc L347
+jsr *r3
+L330: bne L350
+dec r3
+rts
+clr *r1
+L331: .data 377, 472, -781, 571, -519
+red r1
+L332: .data -266, -966, 561
+
+
+L333: .string "r"
+clr r6
+cmp #-163, r4
+L334: add #-94, *r3
+L335: red *r2
+bne *r5
+clr *r3
+red *r6
+not L349
+jsr *r4
+rts
+mov r4, *r0
+L336: clr *r5
+L337: inc L350
+L338: inc *r1
+rts
+rts
+; comment
+L339: .data -698, -128, -272, 85, 130, -771, 220
+lea L340, *r1
+L340: dec r4
+L341: .string "kcuqckflpokdgnqoyu"
+L342: dec L346
+inc r2
+bne L348
+dec *r7
+L343: .string "ffsfcsnjzdajakapcxrsas"
+clr L347
+L344: clr r3
+sub *r4, *r5
+not *r6
+L345: .data 47, 612, 192, -483, 240, -593, 936
+jmp L348
+L346: prn r2
+sub r4, r3
+inc L347
+prn *r0
+lea L347, r2
+mov L347, *r4
+lea L349, r6
+jsr L349
+add L350, L348
+rts
+prn r6
+rts
+lea L350, r2
+L347: .data 360, -52, 809, 535, -285, -676
+bne *r4
+bne *r1
+stop
+inc L349
+mov L350, *r5
+; comment
+add *r2, *r1
+L348: jsr *r7
+L349: .string "rb"
+cmp *r4, *r2
+L350: cmp #209, #-118
+jsr L277
+jsr L157
+stop
@@ -0,0 +1,1025 @@
+; Generated by genCorpus --seed 8
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+stop
+L0: dec *r4
+red *r2
+L1: add *r5, r7
+stop
+L2: dec L61
+clr *r5
+L3: lea L293, L324
+bne L116
+clr *r1
+; comment
+clr L116
+add *r0, r4
+L4: cmp *r1, r1
+sub #190, *r4
+lea L229, r7
+L5: .data -164, 389, -899, 657, -56, -581
+L6: rts
+add r5, L64
+lea L136, r6
+mov L325, L138
+bne *r3
+sub #-83, *r2
+prn *r0
+add *r5, *r2
+rts
+mov #243, *r4
+stop
+lea L332, L181
+jmp *r2
+bne L14
+L7: .data 216, 818, -272, -546, 70, 969, -822
+L8: sub r2, *r3
+
+L9: .string "jsfqaomukerzrvxqaoe"
+; comment
+L10: .string "abq"
+L11: jsr *r2
+prn *r2
+; comment
+L12: jsr L293
+jsr L108
+add *r6, *r0
+L13: .data -624
+L14: .string "ziagovqurmnwpy"
+L15: red L120
+sub L39, L203
+add r2, L281
+stop
+L16: bne L320
+jsr L270
+inc r2
+
+inc L240
+L17: inc L339
+red *r3
+inc L308
+L18: .data 906, -835, 618, 447, 13
+jmp L320
+prn L80
+L19: clr r4
+L20: rts
+clr r3
+L21: not r7
+L22: cmp r5, #-115
+clr *r3
+jmp L34
+L23: sub r5, L75
+L24: .string "owijqaycjarx"
+; comment
+L25: bne *r6
+jsr *r6
+not r7
+stop
+prn r5
+L26: bne *r4
+; comment
+L27: .string "idnzrgcgd"
+stop
+bne *r1
+lea L241, r5
+L28: .string "axtthktelwyka"
+clr L233
+dec r0
+L29: .string "ncagwgaqptfhuwe"
+jsr *r6
+cmp L309, r6
+jsr L162
+clr r7
+L30: mov r6, L72
+jmp *r7
+L31: not *r6
+cmp #-52, L237
+bne *r7
+not r1
+stop
+add #149, L269
+inc *r3
+L32: .string "lyfdcejohblqdhe"
+L33: cmp L291, r1
+inc L83
+not *r1
+dec L40
+L34: lea L169, L175
+jmp L116
+L35: stop
+jmp L80
+sub L204, r2
+bne L108
+L36: cmp L230, *r7
+dec r3
+bne *r1
+
+L37: clr L221
+prn r2
+sub #243, r6
+L38: .data 410, 767, 376, -348, -580
+not r2
+L39: not *r6
+bne L75
+bne *r2
+L40: add r2, L81
+inc L240
+red r7
+not *r3
+L41: rts
+clr r2
+L42: rts
+dec L307
+L43: jmp *r1
+mov *r5, r3
+jmp L206
+lea L138, L187
+add r5, r3
+L44: .data -751, -885, -376, -727, -156, -31, -883
+clr r6
+clr L297
+stop
+L45: clr *r5
+
+add r2, r7
+L46: prn r3
+L47: .string "xop"
+L48: .data 127
+stop
+not L199
+L49: stop
+L50: .string "zawwxywxsx"
+jsr L296
+; comment
+
+clr L307
+lea L337, r7
+not *r5
+L51: sub r5, r4
+L52: .data 997, -28, -383, -785, -353, 77
+L53: prn r3
+L54: not L340
+rts
+L55: stop
+L56: rts
+lea L297, r4
+clr L58
+lea L338, *r6
+add *r0, r5
+L57: .string "njr"
+sub *r7, *r3
+L58: .data -73, 26
+jmp *r5
+sub *r3, L175
+L59: .data -497, -59, -503, -538
+L60: inc L80
+clr L272
+clr *r3
+add L102, *r1
+inc L267
+prn #-116
+clr L300
+not *r6
+lea L204, L239
+L61: .string "mkfwr"
+L62: mov L266, r3
+dec r2
+inc r4
+L63: add L333, r3
+rts
+jmp *r5
+L64: rts
+dec *r6
+add #-112, *r3
+rts
+L65: prn r7
+prn r5
+red *r1
+rts
+L66: not r4
+stop
+red r2
+jmp L162
+; comment
+L67: .data -12, -267, 470
+L68: clr r1
+mov #203, r2
+add r4, *r2
+dec L308
+L69: .string "iwaaovqfwbwxxwzo"
+L70: rts
+not r5
+
+not L179
+clr *r2
+L71: .string "flausphhnh"
+stop
+red r5
+inc L168
+clr r6
+stop
+cmp *r3, L73
+prn *r7
+clr *r7
+L72: .string "lxmop"
+jmp L326
+dec r6
+jsr *r7
+L73: not *r7
+L74: jmp *r0
+L75: bne *r7
+cmp r0, r5
+prn L143
+prn *r2
+dec *r7
+L76: not r2
+L77: stop
+L78: jmp *r3
+
+L79: jsr *r3
+L80: .string "gazrtvrwcaxh"
+sub r4, *r5
+L81: prn r6
+
+sub L352, *r7
+L82: inc *r4
+L83: dec L284
+red L300
+red r1
+clr L344
+L84: not L256
+jsr L348
+red r0
+lea L340, *r4
+L85: inc r5
+not *r6
+rts
+cmp #-62, r5
+red L260
+L86: .string "fijobauobhyraftdibswfsvr"
+L87: clr L259
+prn r5
+add #-129, L88
+L88: red *r4
+sub *r4, L302
+L89: not L263
+L90: lea L124, *r2
+rts
+jmp *r3
+not *r0
+; comment
+inc *r7
+L91: .data -800, -882, -754, -998, -200
+L92: .string "wuhesorpoilldxtnyeo"
+jmp L179
+not *r3
+cmp L190, L295
+L93: rts
+L94: clr r0
+cmp *r3, L306
+prn *r2
+L95: jmp *r0
+stop
+L96: add *r4, L336
+L97: not L349
+mov r0, *r7
+prn L349
+L98: .string "ulbplb"
+add r6, L257
+prn #-241
+L99: cmp r5, *r1
+jmp *r5
+not r2
+cmp L260, *r3
+add r5, r7
+rts
+sub #-232, L130
+mov *r5, *r1
+inc L298
+L100: stop
+L101: prn r5
+dec r4
+L102: rts
+jsr L252
+mov r2, *r6
+rts
+dec r4
+dec r7
+sub L241, *r5
+L103: red L182
+mov *r0, L194
+mov r2, r2
+clr r3
+mov L218, L310
+L104: lea L188, r3
+; comment
+inc L208
+L105: clr *r5
+
+L106: lea L325, r6
+lea L163, L285
+jmp *r2
+not L176
+L107: prn *r7
+clr r0
+
+clr L128
+L108: clr L236
+L109: red L257
+L110: red r3
+red *r3
+L111: .string "pkgjhlba"
+L112: mov r2, *r6
+red *r5
+jmp L312
+L113: jsr L250
+clr L203
+; comment
+rts
+L114: dec r3
+L115: bne L219
+L116: inc *r6
+L117: jsr *r2
+L118: .data -6, 245, 905, -573, 470, 597, -528
+stop
+L119: .string "roso"
+mov #-53, *r3
+L120: red r6
+bne L277
+L121: lea L347, *r3
+lea L288, r5
+rts
+L122: lea L139, r4
+bne *r6
+bne *r3
+; comment
+L123: prn #-226
+L124: not L256
+L125: prn r3
+add *r1, *r7
+cmp L268, L260
+L126: jmp L170
+L127: add *r2, *r7
+cmp L350, L170
+red r4
+mov #-222, L345
+not *r4
+jsr *r3
+L128: jsr *r2
+L129: add r1, L274
+stop
+L130: lea L251, r0
+L131: jsr *r5
+jsr *r1
+cmp r6, #-67
+L132: rts
+jsr *r4
+L133: .string "zyzuwzbxkkpxkwiwvhq"
+inc *r1
+L134: .string "iliflegfsskszogarblyxs"
+rts
+
+lea L164, L221
+jmp *r1
+sub L310, *r4
+cmp L308, *r2
+jsr L248
+L135: jmp L230
+bne L164
+add #64, L220
+L136: lea L153, *r5
+L137: mov *r4, *r6
+cmp L188, #166
+; comment
+L138: .string "agwvtesakkjklwdwuwpmoyhn"
+L139: dec *r0
+not *r2
+lea L270, *r3
+L140: lea L273, L162
+L141: prn *r5
+clr r3
+L142: bne L323
+jsr *r7
+mov r5, L253
+L143: jsr *r6
+lea L208, r0
+sub *r6, *r0
+jmp *r6
+dec *r1
+L144: clr L165
+stop
+jsr *r5
+L145: sub #251, L282
+mov r7, *r7
+L146: jmp L303
+prn *r5
+mov #243, L193
+L147: prn L216
+bne *r6
+jmp L176
+L148: jsr *r7
+prn *r0
+not L264
+prn #161
+stop
+sub L173, r1
+L149: .data 664
+sub L179, r6
+mov r3, r4
+mov r1, r3
+L150: add L182, L262
+L151: inc *r0
+
+L152: .string "gh"
+rts
+L153: mov L289, r5
+L154: lea L186, L302
+cmp *r1, L185
+bne L264
+mov *r5, r4
+L155: inc *r5
+red *r7
+L156: cmp #1, #3
+L157: .data 826, -989, 749, -73, -349, 253
+L158: red *r6
+jsr *r1
+bne *r6
+; comment
+jsr *r3
+L159: cmp L309, *r5
+rts
+L160: sub #206, r1
+mov #-105, r2
+dec *r2
+L161: mov r4, r1
+cmp L255, L189
+L162: prn #106
+red *r3
+inc L260
+L163: inc *r3
+lea L233, *r6
+clr *r3
+cmp L298, r2
+jsr L231
+L164: .data -631, -806, 590, 100, -467, 797, 367, -425
+; comment
+rts
+L165: lea L327, *r5
+add L296, r6
+inc *r6
+mov r0, *r5
+sub r4, L254
+jmp *r4
+jmp L326
+L166: sub #-80, *r5
+rts
+L167: cmp #107, L336
+cmp #192, #-7
+dec r6
+jmp *r4
+mov L321, *r1
+L168: add #105, L301
+mov *r0, *r5
+red r1
+L169: stop
+inc L170
+mov #-181, *r4
+; comment
+dec r4
+L170: inc L201
+dec L179
+clr r1
+L171: .data -804, 399, -582, 713, -913
+L172: bne *r6
+rts
+L173: prn r3
+lea L202, L329
+L174: prn *r1
+clr *r5
+jmp *r7
+add r6, *r5
+L175: dec *r1
+L176: cmp L298, *r0
+L177: cmp #-133, *r5
+L178: bne *r2
+sub #-135, r5
+L179: .data -939
+L180: stop
+rts
+mov *r3, L303
+mov *r4, *r3
+jmp *r0
+
+inc L229
+sub #-235, r5
+; comment
+jmp *r1
+L181: cmp *r4, *r6
+stop
+L182: inc *r5
+L183: .data 676, -335, 344, 4, 631, 53, 87, 773
+red *r0
+not *r4
+L184: inc r1
+clr *r3
+dec L330
+dec *r2
+L185: dec L331
+L186: prn r0
+lea L339, L249
+L187: inc r2
+jmp L197
+cmp *r2, *r0
+rts
+cmp r4, #162
+L188: prn L255
+cmp L310, r7
+dec r2
+L189: sub L295, r0
+sub r3, r5
+L190: prn L309
+L191: .data -356, 679, -765, 766, -538, 925, 173, 976
+bne *r3
+L192: inc *r5
+bne L265
+prn r4
+not r2
+mov #27, L333
+L193: cmp *r5, r3
+clr r2
+; comment
+not L337
+red r0
+; comment
+mov L282, r4
+L194: not *r7
+L195: red *r0
+mov *r6, L208
+; comment
+prn L235
+L196: .data -867, 598, 145, -301, 617, -213, 604
+stop
+inc r5
+mov r1, L317
+jmp *r4
+jsr *r0
+jsr L345
+L197: add *r7, *r5
+; comment
+not *r6
+clr *r4
+L198: .data -642, 857, -146
+prn r7
+jmp *r3
+sub r3, r2
+L199: .string "pp"
+L200: mov r6, *r7
+bne L241
+
+jmp *r0
+jsr *r5
+bne *r6
+add L315, L293
+L201: .string "kt"
+L202: red *r2
+jmp *r4
+lea L234, *r6
+L203: rts
+inc r2
+L204: jsr *r0
+bne *r2
+L205: .data -367, -109, 821, -674, 523, -743, 682, 185
+cmp r3, #63
+mov r4, r2
+dec L218
+L206: red L329
+; comment
+prn r2
+L207: stop
+red r7
+lea L211, *r0
+L208: cmp #50, L338
+red r4
+L209: red L234
+mov L229, *r1
+L210: add L313, r1
+not L241
+cmp *r0, r2
+L211: lea L221, L255
+
+stop
+sub L333, L331
+bne *r5
+mov r3, r0
+prn L319
+stop
+L212: .string "wacrfvzaedxzkzwiaj"
+L213: prn r4
+stop
+L214: lea L307, r5
+mov L352, L284
+mov r4, r3
+jmp L319
+cmp L216, #43
+L215: .string "lvefxuwiicmdttukprecv"
+L216: .data -266, 719, 292, -883, -194, 520, 460
+L217: stop
+not L311
+prn #142
+clr r6
+L218: .data -575, -374, 663, -774, 638, -321, -382, 877
+L219: inc L277
+L220: .data -517
+L221: bne L309
+not *r2
+inc *r2
+red L347
+
+clr L321
+not *r4
+inc r7
+red r6
+sub *r3, *r6
+
+stop
+L222: red *r5
+not r3
+; comment
+bne L333
+L223: .string "lozvqjiebssqxfjhzulqljce"
+sub L344, L344
+lea L323, *r7
+not r0
+L224: .data 398, -213
+inc L240
+lea L338, L305
+inc L277
+L225: cmp *r6, r4
+L226: cmp r2, #-200
+jmp L248
+L227: .data 603, -347, -397, -348, -387
+add #52, *r1
+L228: .data -136, 472, 944
+prn r2
+cmp r6, #-209
+add r2, r5
+dec L270
+dec L239
+rts
+L229: .string "zamtbbmgmxhtrkqj"
+L230: .string "jtywbovuayx"
+add *r5, r6
+add *r0, r1
+L231: .string "xgwcfnnswxkdkzc"
+L232: .string "bmte"
+L233: clr L245
+not L296
+sub L290, L329
+red L317
+L234: clr L332
+red L288
+red L239
+L235: lea L249, L278
+stop
+L236: .data 430, 547
+not r6
+; comment
+L237: rts
+prn #189
+L238: .data -124, -90, 388, 519, -367, 29
+inc L276
+sub L243, r2
+L239: rts
+dec L305
+inc *r6
+jsr L275
+not L300
+jsr *r7
+L240: inc r1
+L241: .data 774
+L242: .data 846, -676, -255, 645, 9, 828
+prn L295
+L243: dec *r3
+red r6
+L244: rts
+rts
+cmp #73, #250
+dec r3
+; comment
+L245: red L252
+L246: cmp #-45, #232
+L247: rts
+jsr L352
+L248: stop
+L249: rts
+cmp r7, #-53
+dec *r5
+L250: jmp L281
+prn *r6
+L251: cmp #203, *r0
+L252: jsr *r4
+L253: cmp *r4, #-202
+cmp #-41, r7
+add #-246, r6
+L254: rts
+L255: clr *r2
+mov *r6, *r3
+L256: not L315
+L257: add *r1, r6
+
+inc *r7
+L258: not r2
+L259: .data 727, 684, -52, -787, -587, -143, -811, -537
+mov L294, r0
+sub r2, r3
+L260: jsr *r7
+lea L270, r7
+stop
+L261: cmp *r5, *r3
+L262: .data -228, 299, -813, -640, 637, 489, 285
+rts
+L263: .string "prtsrck"
+rts
+rts
+clr L343
+bne *r1
+L264: .string "ftmxxzuqa"
+red *r0
+cmp L344, #33
+L265: .data -952, -283, 548, 544, -713, 110, 551, 823
+rts
+L266: jsr *r0
+; comment
+cmp r1, #209
+dec r3
+rts
+L267: jmp L336
+L268: .data -709, -397, 719, 194, 25, 921, -676
+dec *r3
+bne *r2
+mov L300, *r0
+L269: .string "plax"
+L270: .string "mhtnetyqkkdlcjhtuhylqqji"
+
+cmp *r6, #172
+L271: .string "mdnxnigjutfblxmdqig"
+not r3
+L272: .data -295, 693, 22
+cmp L320, L312
+L273: inc *r6
+L274: sub *r3, r6
+clr r3
+lea L286, r3
+cmp r3, *r5
+dec *r4
+L275: .data -249, 961, -642, 814, 330
+not r2
+L276: .string "nqnpjgtgglaza"
+L277: add L306, r3
+add L343, *r6
+jsr L309
+lea L337, *r2
+inc *r4
+L278: lea L304, r7
+dec r5
+rts
+L279: .data -281, 702, 590, 153
+jsr *r0
+L280: not *r5
+L281: dec *r5
+L282: lea L316, L322
+bne *r7
+mov #-149, r3
+L283: cmp *r1, *r3
+L284: .string "zozaetlufbtprfgeusqwc"
+not L325
+L285: .string "ztchffpcdyavyfxco"
+L286: .string "swpxrxssktxintwzcfym"
+stop
+bne *r2
+cmp L326, *r4
+L287: inc r6
+not L352
+L288: jmp L349
+clr L295
+inc r6
+lea L292, *r7
+L289: mov L290, L292
+L290: .data 545, 920, 127, 941
+rts
+
+red *r4
+cmp r5, L329
+prn L321
+L291: mov #-64, L311
+jsr *r1
+inc L311
+inc r2
+L292: mov r1, L299
+L293: bne *r5
+rts
+lea L307, L298
+mov *r3, r1
+L294: dec L332
+L295: .data -488, -101, -109, -456, -787, 580, 163
+clr r0
+L296: inc r0
+L297: lea L306, L332
+jmp *r0
+red L351
+red *r6
+sub *r6, *r2
+mov r1, *r1
+add *r3, L347
+cmp #-199, r7
+L298: bne L310
+jsr L338
+jsr *r6
+L299: inc *r7
+L300: bne L335
+L301: stop
+jmp *r3
+L302: mov r3, *r0
+bne L325
+bne *r3
+bne *r4
+L303: rts
+L304: .string "fopcgmnntozajcflhtnfyc"
+dec L341
+L305: .string "wjsftyyywwphctz"
+sub *r7, r1
+L306: bne L344
+L307: sub #119, *r0
+L308: add r7, *r3
+L309: mov r5, L343
+jsr *r2
+lea L346, r5
+L310: lea L342, L351
+L311: .data 950, 350, -565, -575, 541
+mov L352, *r3
+clr L352
+mov *r5, *r2
+cmp *r1, #247
+clr r3
+add *r3, L349
+dec r5
+mov L329, *r3
+L312: .data -107, -387, -316, -596, 832, 815, -740
+jsr L314
+lea L318, r5
+L313: jmp L329
+not L351
+L314: mov #229, *r2
+L315: .data -399, 689, -296
+lea L325, r1
+sub r4, r6
+lea L330, *r5
+not r2
+L316: dec r6
+add *r7, r4
+L317: mov L348, r0
+
+jsr L326
+L318: rts
+prn *r4
+L319: prn r5
+inc L346
+L320: red *r5
+L321: lea L334, *r1
+mov #-242, *r4
+dec r5
+L322: dec L331
+lea L344, r5
+L323: .data 559
+
+dec *r6
+red L335
+rts
+bne *r7
+sub *r3, *r5
+sub r6, *r2
+dec r6
+clr *r0
+L324: cmp #107, #69
+mov *r4, L338
+cmp r5, L342
+jmp L333
+jmp *r6
+L325: jmp L336
+cmp *r7, r0
+jmp *r4
+stop
+; comment
+mov r1, *r4
+L326: jmp L334
+L327: .data 79
+L328: prn #-15
+L329: sub L352, L330
+red *r5
+inc L334
+L330: .data 516, 537, 814
+lea L347, *r6
+dec r0
+L331: .string "v"
+jmp *r5
+lea L344, *r5
+rts
+mov L351, L350
+rts
+inc *r3
+lea L344, *r1
+stop
+rts
+add r2, L335
+
+jsr *r5
+L332: .data -240
+jsr L343
+red *r2
+add *r2, r7
+bne *r1
+L333: rts
+lea L340, r7
+jmp *r6
+L334: jmp *r3
+lea L336, L339
+L335: .data -867
+jsr L341
+lea L338, L349
+; comment
+L336: .string "pjcbsrpfz"
+L337: clr r7
+lea L339, L350
+L338: .string "vvt"
+add #183, L341
+add #42, *r0
+inc *r7
+L339: cmp *r1, L341
+sub *r0, L345
+L340: cmp *r4, r1
+; comment
+L341: rts
+jsr *r7
+L342: prn #192
+L343: .data -58, -775, 911, -242, -530, -606, -175, -896
+bne *r7
+L344: jmp *r1
+L345: red *r6
+clr L350
+inc r3
+L346: jsr L350
+sub L351, r3
+clr L348
+clr L350
+cmp *r1, *r6
+dec r4
+L347: .string "hcrlrcuqsnluftbi"
+stop
+dec *r5
+; comment
+dec r2
+dec r6
+clr L350
+sub *r6, L350
+dec *r1
+stop
+L348: rts
+prn r4
+not L350
+L349: stop
+L350: .data -276, 191, 162
+dec *r3
+L351: clr *r6
+dec L352
+dec *r2
+not L352
+jsr L352
+bne L352
+prn L352
+L352: clr *r7
+jmp L36
+rts
+
+jsr L29
+stop
@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 9
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+lea L269, L109
+L0: red *r6
+L1: .string "hnqoktsvim"
+L2: inc *r2
+prn L11
+
+inc *r5
+sub r1, *r3
+add r0, r4
+; comment
+bne *r4
+bne *r3
+L3: add r4, L161
+L4: sub L211, L157
+add r3, L90
+L5: cmp r3, L48
+add #-55, *r1
+dec r5
+L6: mov L282, *r7
+L7: .data -339, 479
+jmp *r6
+L8: .data -400, -750
+L9: red L260
+prn #44
+prn L36
+L10: cmp L246, *r2
+jsr *r6
+L11: stop
+bne L212
+L12: stop
+L13: mov L144, r5
+; comment
+L14: add r6, r6
+rts
+dec *r5
+L15: mov L55, L202
+bne *r3
+bne L65
+sub r3, *r2
+cmp L220, L71
+bne *r3
+sub *r2, r0
+red L112
+L16: clr L348
+add *r3, L60
+clr L21
+stop
+L17: .string "fdobuvura"
+not *r3
+L18: inc r3
+bne L276
+bne *r6
+dec r2
+inc r3
+L19: dec r1
+sub L303, *r7
+bne *r7
+L20: mov r3, *r3
+mov #-82, L63
+not L22
+L21: jsr L74
+clr L68
+prn L200
+lea L50, L108
+L22: clr L90
+bne L207
+L23: .data -568, 35, 324
+jsr *r6
+stop
+L24: stop
+; comment
+stop
+lea L74, *r1
+L25: lea L47, *r2
+bne *r2
+inc L332
+L26: cmp #229, r6
+rts
+red r2
+stop
+jmp L142
+L27: .data 449, -458
+lea L64, *r5
+sub #-144, *r0
+rts
+jsr *r5
+L28: .string "cairp"
+lea L61, r6
+mov L241, L312
+rts
+L29: .string "gufvtvndysdpvjnq"
+L30: bne L319
+L31: .string "jgegugnlpj"
+L32: rts
+L33: jmp *r7
+L34: .data -628, -961
+add L97, *r3
+bne *r6
+L35: jsr *r0
+L36: jsr *r6
+L37: .string "xcqntzg"
+prn L223
+L38: add r6, *r6
+rts
+inc *r5
+L39: not r7
+L40: not *r4
+jmp L157
+L41: .string "occgtfowdpmn"
+sub L299, r5
+L42: .data -500, 461, -683
+L43: clr L317
+jmp *r6
+cmp r4, L343
+bne L228
+; comment
+L44: .string "jjnqcnnkhmfzqdrldi"
+red r3
+L45: .data 600, 218, -691, 892
+sub L190, L151
+L46: mov #73, r0
+L47: jmp L341
+cmp L96, *r7
+red *r5
+stop
+stop
+add #38, L257
+prn L279
+L48: jmp *r0
+bne *r3
+sub #149, *r1
+L49: mov *r7, L52
+clr L313
+L50: add *r6, *r6
+rts
+bne L83
+add #-179, L200
+L51: .data 999, 85, 510, 477, -978, 522, 778, -795
+L52: jsr *r1
+not *r2
+inc r3
+clr L275
+jsr *r2
+sub *r7, r0
+prn L347
+; comment
+L53: not L155
+L54: add *r1, r5
+inc r0
+jmp L98
+L55: jsr *r6
+mov #119, r5
+L56: not *r0
+clr L121
+sub #-115, r4
+L57: jmp L213
+L58: sub *r6, L215
+L59: add r4, *r7
+mov *r2, r3
+clr r4
+rts
+L60: prn L246
+add r2, r6
+bne *r5
+cmp #-46, r3
+; comment
+L61: clr L181
+L62: prn #11
+red L161
+cmp #-88, r2
+L63: dec L252
+L64: not *r3
+L65: rts
+L66: stop
+cmp *r1, L126
+red *r2
+inc r3
+jmp L86
+stop
+L67: clr *r4
+L68: prn #-238
+L69: add #-217, L202
+red L108
+L70: rts
+rts
+jmp L223
+L71: inc r7
+L72: add *r2, *r6
+red L311
+prn L164
+red *r5
+L73: jsr *r2
+rts
+stop
+lea L272, L267
+jsr *r1
+lea L224, *r5
+bne *r4
+sub r6, r7
+red L149
+red *r4
+cmp L265, *r0
+L74: bne *r2
+prn #147
+dec *r6
+clr *r3
+stop
+bne *r5
+cmp L339, #-145
+L75: .data -427, 475, -612, -154, 791, 957
+inc r7
+bne *r0
+jmp L252
+add r7, *r5
+dec *r4
+
+red L274
+L76: stop
+L77: jsr *r4
+L78: sub #7, L165
+add #-178, r6
+L79: sub r2, L152
+add #-128, L229
+jsr L306
+mov L241, r3
+L80: .data 410, 266, -253, 223
+stop
+lea L227, r4
+mov #-226, r1
+jsr L160
+L81: jsr L338
+stop
+red *r4
+L82: .data -686, 901, 919, 409, 593, -497, -579, 425
+L83: .data -712
+jsr *r1
+
+prn *r0
+L84: dec *r6
+clr r4
+L85: sub #158, r4
+inc r6
+L86: clr *r4
+L87: .string "dkxrjdkleyvxeoyusxbw"
+dec r2
+L88: rts
+jmp L144
+L89: jmp L218
+L90: .data 775, -366, 960, 182, -655, 151, 110, -916
+jmp L111
+not r5
+L91: sub L180, r7
+; comment
+L92: .data 549, 23, -224, -637
+L93: jmp L254
+L94: stop
+L95: sub L167, *r3
+L96: clr *r0
+rts
+sub *r7, *r5
+L97: red *r1
+lea L206, L265
+L98: stop
+stop
+inc r6
+cmp L260, *r5
+cmp *r0, L116
+stop
+L99: dec r7
+L100: prn L108
+dec L231
+jsr L274
+mov *r1, *r2
+L101: stop
+stop
+L102: inc L145
+L103: cmp #36, *r3
+not r5
+L104: .data -401
+L105: lea L199, *r1
+L106: dec L166
+L107: .data -999, 418, 547, -995
+lea L151, L187
+mov #172, L162
+L108: .string "ifayknmrlsuhv"
+jsr L177
+; comment
+stop
+L109: .data 149, 997, -510, -450, -439, -569, -41
+L110: red L150
+L111: .string "biys"
+bne L203
+sub L218, L259
+cmp r0, r6
+L112: red *r5
+
+
+
+jsr L244
+L113: sub r2, L245
+L114: rts
+stop
+add r1, *r2
+prn r1
+L115: stop
+dec L248
+L116: prn #243
+L117: stop
+L118: add L300, L270
+stop
+mov *r4, *r3
+L119: .data 92, -611, -989
+L120: jsr L135
+L121: red *r2
+cmp *r1, r2
+lea L279, L251
+jsr L124
+stop
+lea L350, *r4
+cmp L296, L234
+stop
+L122: dec r5
+L123: mov *r4, *r6
+L124: jmp L150
+; comment
+add #248, L349
+not r4
+jmp *r6
+rts
+not *r2
+inc r3
+L125: not *r0
+lea L254, L245
+bne L165
+mov r5, L185
+add L270, L302
+bne *r3
+L126: jsr L200
+clr r1
+bne L314
+L127: .string "sskct"
+cmp #168, *r1
+stop
+rts
+red r6
+cmp L262, #75
+L128: jmp *r0
+rts
+L129: jsr *r2
+prn r2
+prn L313
+L130: prn #17
+L131: lea L211, *r1
+inc L296
+inc r7
+L132: dec *r5
+L133: jsr L201
+clr L281
+L134: sub L334, *r6
+clr r5
+L135: jmp *r4
+cmp L323, *r1
+stop
+clr *r2
+L136: red r6
+L137: .data 419, -812, -623
+jmp L259
+L138: cmp r3, L287
+bne L270
+L139: inc r0
+clr r6
+sub *r2, L322
+L140: lea L276, *r6
+clr L338
+dec *r5
+stop
+prn #-221
+clr *r2
+L141: sub *r0, r2
+mov L255, r0
+sub #-130, r2
+L142: .string "kkwtgwz"
+; comment
+dec L304
+not L280
+L143: sub #135, L167
+L144: sub *r4, r6
+L145: bne *r2
+clr *r4
+L146: cmp *r5, *r0
+cmp #101, *r2
+L147: .data -60, -185
+dec L255
+not *r6
+red L177
+rts
+sub #-14, *r5
+jmp *r6
+L148: inc r0
+sub *r1, L226
+L149: jmp *r3
+cmp #115, L205
+bne L254
+prn *r4
+L150: stop
+prn *r1
+sub *r4, *r2
+L151: prn #29
+L152: add *r2, r2
+sub L259, L234
+mov #-148, r4
+L153: stop
+red r0
+L154: .data -991
+add r2, r2
+clr *r6
+jmp L161
+add *r1, r6
+
+L155: cmp L288, *r3
+dec r6
+L156: lea L277, *r2
+lea L348, L245
+L157: prn #40
+add r7, r5
+L158: red r6
+sub #-231, *r2
+bne *r0
+mov #2, r6
+rts
+bne L344
+L159: jmp L264
+L160: cmp L291, #-151
+jmp L263
+L161: not L313
+lea L274, *r3
+L162: .data 728, -529, -77, 770, -375
+L163: mov L174, *r6
+; comment
+dec L268
+dec L299
+cmp L239, #-81
+jsr L292
+L164: prn r0
+not L203
+L165: lea L330, L309
+jsr L277
+L166: red r6
+clr L258
+rts
+L167: .data -649
+red *r4
+bne L205
+prn r0
+rts
+rts
+; comment
+stop
+inc L198
+jmp L309
+rts
+L168: jsr *r1
+L169: .data 668, -757
+jsr *r1
+L170: not *r5
+red L209
+L171: rts
+rts
+stop
+L172: bne *r2
+not L200
+L173: stop
+L174: add *r3, L257
+L175: jsr L192
+clr *r0
+mov L232, *r0
+red *r7
+L176: red L227
+L177: sub *r3, r7
+sub *r0, L229
+L178: jsr L272
+prn #-182
+dec L232
+
+mov L285, *r0
+L179: lea L327, r2
+L180: cmp r2, #107
+bne *r5
+L181: dec L213
+L182: rts
+stop
+prn r7
+L183: .string "kaaaqhemswfz"
+L184: .data -193, 775, 55, -830
+L185: jsr *r2
+cmp *r3, #170
+mov #148, L348
+L186: .data -275, 788, 518, -85, -682
+L187: sub L263, L318
+lea L295, L231
+not r2
+L188: stop
+bne L311
+clr *r7
+jsr L189
+L189: .data 240, -601, 707, 793, 921, 966
+L190: jsr *r6
+L191: dec r7
+lea L296, *r7
+L192: stop
+L193: bne *r1
+jsr L324
+stop
+jsr L345
+jsr L220
+bne *r1
+clr *r5
+jmp *r1
+dec *r4
+L194: prn #-174
+mov #-225, r7
+rts
+L195: red r5
+; comment
+L196: mov #-2, *r2
+jmp *r7
+clr *r1
+mov r4, L216
+add r4, L330
+; comment
+sub r5, r0
+L197: lea L291, L310
+inc r4
+L198: inc *r2
+prn #-205
+inc L212
+cmp *r6, #-203
+L199: dec *r3
+L200: .data -577, 139, 505, 258, 744, 716
+prn L251
+inc *r1
+jsr L308
+cmp *r1, r7
+jmp L335
+mov L254, r5
+sub #247, *r4
+jsr *r0
+add L317, *r3
+L201: .string "ygd"
+L202: cmp #230, *r1
+clr r4
+cmp L230, r7
+clr *r1
+L203: sub L225, r1
+dec *r1
+
+jmp *r0
+L204: jmp *r2
+red *r5
+mov #228, *r6
+lea L328, *r6
+inc *r6
+inc L333
+not r2
+L205: .data 783, 989, 441, -585, 974, 20
+L206: cmp r0, L317
+bne *r1
+L207: prn #-17
+cmp L317, r6
+jsr L325
+add r4, *r5
+cmp #-122, L218
+inc *r1
+stop
+L208: .string "nazgcunrwdostl"
+sub *r0, *r1
+L209: .data -316, -678, 406, -236, 587, 2
+L210: sub #251, L265
+cmp #-256, r7
+sub *r0, r4
+mov #34, L300
+L211: .data 453, 598, 343, 543, -997
+L212: .string "qekbcdzchfamxghppawbzoao"
+L213: inc *r6
+L214: prn r5
+L215: bne *r0
+rts
+lea L239, *r6
+cmp L260, L293
+red r3
+L216: .data -489, -547, -177, -452
+L217: .string "frvmqevqskcubunyizompbfk"
+mov r4, L249
+bne L323
+L218: sub r3, *r5
+L219: .string "wrfgisuffenxafrgtqjdd"
+cmp *r0, *r0
+; comment
+lea L239, r5
+bne *r7
+L220: .string "pxspvqghhcgcfaxjok"
+sub #212, L232
+L221: not *r3
+L222: red r6
+L223: add *r7, L318
+L224: stop
+add *r6, L325
+inc L247
+bne L257
+jsr L338
+prn L321
+prn #-109
+L225: dec *r4
+add *r0, *r4
+stop
+L226: prn L316
+not L272
+L227: lea L248, L277
+L228: jmp *r6
+rts
+L229: jmp L293
+L230: not *r2
+mov *r4, r4
+L231: lea L316, r7
+red *r5
+dec L241
+dec *r7
+not r3
+L232: dec L275
+L233: jsr L254
+add r4, *r3
+L234: not *r5
+add #74, *r4
+inc r7
+sub #-18, r6
+prn r0
+cmp #231, L331
+lea L330, r7
+not *r0
+lea L310, r3
+L235: mov #216, *r7
+L236: clr *r2
+bne L271
+jmp L244
+clr *r4
+L237: .string "tgtgyvysymr"
+
+jmp L349
+L238: jsr L246
+stop
+L239: prn r4
+L240: mov *r0, r5
+not *r6
+add L243, L298
+jsr *r1
+L241: add L272, L258
+sub #-18, *r0
+L242: dec r6
+
+rts
+L243: .string "tqcicqppbaeqpiogmoxwt"
+L244: jmp L246
+clr *r3
+L245: .string "hfrkgwpcqdpwwasmfk"
+L246: dec L303
+rts
+mov #114, *r3
+inc L255
+clr r0
+L247: sub L273, L319
+bne *r0
+clr L281
+mov L306, L267
+
+L248: .string "ldihilfhewuvm"
+jsr L347
+L249: .string "taeywtczascehpbwqbtbo"
+L250: clr r7
+mov #127, r0
+L251: .data 636, 652, 998, 510, 127
+inc *r5
+clr r2
+L252: rts
+prn L330
+sub L296, *r0
+L253: jsr L322
+cmp L333, #-172
+L254: .data -629, 733, -328
+not r6
+L255: sub r3, L317
+L256: red r2
+prn *r5
+add #-55, L332
+dec L321
+L257: inc *r2
+prn r7
+jmp L343
+; comment
+clr *r2
+clr r4
+L258: dec L269
+L259: prn r3
+; comment
+mov L292, r0
+rts
+L260: .string "xsesgcxovhmjilq"
+rts
+L261: bne L283
+clr *r4
+cmp #-33, #-29
+prn *r0
+
+dec *r0
+L262: .string "yv"
+L263: .string "nzs"
+sub #-23, L311
+dec *r3
+clr L310
+L264: bne *r7
+; comment
+jmp *r2
+not L335
+rts
+L265: not r1
+rts
+L266: prn L322
+jmp *r2
+L267: jsr L334
+L268: .string "oemiatsbrofclqdr"
+prn r1
+mov *r4, L322
+L269: add r2, *r4
+L270: add *r6, r7
+L271: clr L336
+dec *r0
+L272: .data -822, 931, 578, -837, -413
+stop
+sub *r5, *r5
+L273: mov L297, L329
+clr *r4
+rts
+dec *r7
+mov r2, L275
+red *r2
+stop
+L274: stop
+prn r2
+L275: jmp L347
+bne *r5
+L276: .string "ghawabcmnkrmvsq"
+sub L330, *r1
+; comment
+prn *r2
+L277: .string "nzdjvpixvgzj"
+not *r5
+L278: jsr *r4
+add r6, r1
+dec L306
+clr *r3
+add L280, *r3
+L279: cmp #-167, *r1
+red *r5
+L280: .string "buttyiysymycn"
+red *r0
+rts
+red L315
+rts
+L281: cmp r2, r1
+cmp L302, #-210
+inc r5
+L282: not *r3
+mov L298, *r0
+sub #-210, r1
+rts
+jsr L317
+
+mov #-150, *r6
+L283: stop
+inc r6
+L284: .string "zabmmdwatrdqkxjmf"
+add #-213, r4
+L285: .string "pl"
+lea L329, r5
+cmp #214, *r6
+stop
+mov #-210, *r1
+jsr *r5
+stop
+L286: jmp *r2
+inc L329
+add *r4, L327
+L287: jsr L302
+L288: sub r5, L348
+inc r5
+add r0, r6
+rts
+L289: bne L323
+L290: .string "lgb"
+not *r4
+
+lea L313, *r2
+L291: .string "euxvj"
+dec *r7
+add *r1, L334
+jsr L319
+L292: .string "cohrdrrgthidxkxkfp"
+clr *r5
+rts
+L293: not r2
+inc r3
+L294: .string "cuotyexsklvpo"
+mov r1, r4
+L295: add r3, r1
+L296: .data -37, -61, -529, 841, -20, 951, -811, -934
+L297: .string "kefoebssdtidjv"
+stop
+lea L337, L315
+cmp #160, #-248
+rts
+
+mov *r1, *r1
+
+inc r1
+stop
+prn #-56
+L298: mov *r5, L302
+lea L344, r7
+L299: clr *r3
+jmp L348
+stop
+stop
+add r2, r2
+jmp *r7
+
+dec L301
+not *r5
+mov *r1, r2
+L300: dec *r3
+stop
+lea L313, r7
+L301: rts
+add L337, *r6
+L302: jsr *r2
+lea L312, r5
+bne L340
+L303: bne L309
+rts
+dec *r1
+not L340
+L304: jsr L320
+L305: .string "b"
+stop
+
+
+cmp L336, *r4
+mov L343, r7
+jsr L345
+mov r5, *r7
+L306: .string "wgmnypmmhavezqiinuqpeo"
+L307: jsr L337
+; comment
+bne L321
+inc L343
+prn #148
+lea L321, r4
+inc r2
+; comment
+L308: .string "bywzp"
+L309: not L342
+L310: add #-161, *r3
+add #151, L312
+dec L324
+jsr *r6
+L311: inc *r7
+mov L329, r5
+L312: mov #7, r3
+rts
+L313: .data 528, -250, -475, -865, 439, -180, 774, 252
+L314: red *r4
+L315: sub *r6, *r4
+jmp *r1
+red *r7
+not *r0
+clr r3
+mov #-137, *r1
+clr L347
+L316: .data 50
+clr *r5
+prn #81
+lea L327, L342
+not *r2
+prn #150
+L317: .string "lamtmstteufqgaz"
+rts
+bne L320
+cmp *r4, #103
+inc *r0
+prn *r2
+L318: .string "wdcivdsrhyho"
+L319: inc L334
+L320: add r1, r5
+cmp #97, L327
+not L345
+jsr L339
+jsr L350
+stop
+L321: .data 9, 658, -691, 105, 827
+L322: not *r3
+prn *r1
+dec r3
+stop
+jmp *r4
+rts
+L323: lea L345, r4
+L324: clr *r1
+
+L325: .data -684, -598, 516, -742, 168, 297
+L326: inc L332
+stop
+cmp L331, *r1
+jsr *r1
+L327: cmp L343, #109
+bne *r5
+L328: clr r3
+L329: .string "qnlesaxbgmfhspendfbii"
+clr r7
+L330: jsr L333
+L331: sub L345, *r6
+cmp *r7, #215
+clr *r1
+not L344
+red *r3
+bne L336
+L332: cmp #109, #189
+L333: .string "qxxbpthqgmzofeeqpm"
+sub *r0, r2
+cmp r7, #-172
+prn #167
+prn *r6
+L334: red *r0
+add r3, *r0
+L335: .data -561, 258, -545
+mov L349, r0
+L336: clr r2
+L337: mov *r3, *r6
+L338: bne *r3
+rts
+jmp *r2
+red *r2
+not r3
+bne *r1
+add *r1, L346
+inc L343
+jmp *r6
+sub L345, *r0
+sub L347, L344
+prn *r2
+prn r4
+L339: .data 384, 439, 398
+red r0
+L340: .data -320, -696, -560, -651, 70, -88, -488, 97
+L341: not r1
+L342: jmp *r6
+sub r2, L343
+L343: .data -856, 13, -921, -589
+sub L350, r0
+jsr L350
+L344: mov r5, r1
+L345: red *r2
+inc r5
+L346: not L350
+dec *r6
+bne L349
+not L350
+bne L348
+rts
+not *r6
+L347: .data -545
+L348: lea L349, r4
+clr L350
+lea L349, r5
+not r6
+red L349
+clr r6
+rts
+lea L350, *r6
+L349: cmp #-177, r2
+bne *r1
+red L350
+L350: inc L149
+add #-242, r3
+add L92, r1
+red r7
+; comment
+bne L64
+clr r0
+inc *r0
+stop
+lea L171, *r0
+jmp *r3
+stop
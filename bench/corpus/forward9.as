@@ -0,0 +1,1024 @@
+; Generated by genCorpus --seed 10
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+L0: rts
+cmp L206, L107
+inc L288
+L1: jmp *r7
+L2: stop
+L3: .string "aooopas"
+dec L277
+inc r6
+stop
+L4: not L143
+L5: .string "civynodb"
+prn L233
+not r6
+add #-157, r0
+L6: jmp *r1
+inc r1
+rts
+jmp *r5
+prn r2
+stop
+bne L68
+stop
+add r7, L231
+not r2
+jsr *r0
+not r5
+rts
+dec L35
+L7: lea L278, L35
+not L24
+clr *r5
+clr L175
+
+L8: red r7
+L9: rts
+mov r7, r0
+L10: dec r4
+cmp L302, r6
+jmp L169
+mov #-54, *r2
+add *r3, L244
+not r2
+L11: add L336, L176
+L12: cmp #18, *r4
+L13: jsr *r1
+jsr *r2
+L14: not r6
+dec r5
+prn r3
+L15: prn r6
+L16: .string "xucbusjzy"
+L17: sub r5, r2
+cmp #-143, L150
+L18: jsr L61
+L19: mov L199, r6
+jmp *r7
+jsr *r6
+L20: red *r1
+; comment
+clr r0
+L21: clr *r2
+L22: rts
+jmp L261
+L23: .data 123
+prn L203
+lea L324, *r3
+L24: rts
+inc L28
+stop
+mov r7, r7
+L25: add #14, L38
+bne L242
+L26: inc *r1
+red r5
+stop
+bne L285
+lea L258, r4
+add *r3, *r3
+sub *r6, L203
+lea L333, *r6
+L27: .string "ljsvhhjmnpy"
+L28: mov r2, L54
+L29: add L84, *r4
+L30: prn *r4
+add #106, L160
+L31: cmp #-50, *r1
+lea L132, L227
+rts
+clr *r1
+L32: .string "kzrqkkg"
+L33: sub L111, r3
+mov *r0, *r1
+stop
+L34: jmp L181
+jsr L231
+inc *r4
+L35: .string "azhlukgfel"
+L36: .data 555, -308, -110, 675
+L37: mov L316, *r2
+L38: sub *r7, *r5
+L39: sub L167, r2
+clr r3
+jsr L336
+; comment
+L40: lea L324, r6
+prn *r4
+cmp L86, *r4
+L41: not r0
+sub *r4, *r2
+mov L65, r1
+L42: bne L314
+L43: .string "anyfdtbfnxqztdgxbfkf"
+inc L151
+L44: bne *r1
+cmp #-212, *r2
+L45: .string "anehdranwkmdrzvlvo"
+clr r5
+L46: inc *r2
+sub L132, *r7
+L47: not r3
+prn r3
+L48: cmp r3, #77
+L49: clr r4
+stop
+L50: .string "agvywanipquexkqh"
+L51: .string "ztmxjpenuzrsbdzepdmqdew"
+lea L318, *r0
+dec *r6
+clr L128
+jmp L334
+L52: prn *r3
+L53: .string "drwumf"
+L54: stop
+; comment
+add #-110, *r0
+L55: jsr L161
+lea L321, r3
+dec *r6
+L56: sub *r3, L207
+
+cmp r5, L137
+add *r5, *r7
+lea L221, *r2
+L57: cmp *r0, #155
+prn r6
+L58: prn L269
+L59: stop
+jsr *r6
+red r0
+L60: .string "oyrtothgbjipzbdmk"
+add L182, *r3
+L61: jmp L321
+L62: red r4
+clr *r2
+add r6, L305
+L63: .data 384, 277, 615, 146, 413, -694, 413, -644
+; comment
+mov r0, L104
+rts
+lea L340, *r1
+dec r0
+add #60, r1
+L64: clr L287
+cmp #23, r6
+; comment
+L65: lea L155, *r1
+L66: dec r0
+not r4
+jsr L181
+L67: rts
+jmp L124
+L68: stop
+add r3, L286
+not *r1
+
+red *r3
+add *r7, r7
+L69: mov r6, L273
+jsr *r6
+L70: .string "dlp"
+lea L346, L187
+inc *r7
+inc *r5
+L71: jmp *r3
+clr r3
+lea L175, r2
+
+dec *r2
+bne L100
+bne L163
+L72: prn *r7
+L73: .string "tkejpqlnmrrvciv"
+L74: red *r6
+cmp L154, r4
+red L348
+rts
+L75: stop
+L76: red *r5
+add r1, r6
+bne *r2
+sub #-5, r6
+L77: .data -427, -636, -731, 412, -40, -533, -923, -724
+stop
+clr r1
+dec L344
+jsr L331
+add L288, r6
+L78: .data -965
+mov *r7, *r6
+
+L79: red r2
+prn L283
+dec L349
+clr r5
+L80: stop
+L81: clr r0
+sub r0, r2
+L82: .data 428, 906
+L83: .data 53, -28, 957, 144
+bne *r6
+add L314, r2
+sub #-136, *r2
+lea L231, L210
+sub r7, *r3
+clr L88
+sub r5, r1
+L84: prn L299
+L85: mov *r1, L113
+jmp L88
+clr r6
+L86: .data 957, -673, -674
+inc L112
+add r5, L303
+L87: sub L130, *r6
+sub L188, L348
+bne L217
+L88: .data -563
+dec *r7
+prn #54
+jsr *r4
+L89: .data -942
+red *r0
+jmp L309
+lea L99, *r7
+sub *r6, r1
+L90: red r1
+prn r6
+
+bne *r3
+prn *r5
+L91: prn r7
+dec r2
+cmp #30, r1
+lea L274, L301
+cmp L220, r6
+
+L92: .string "vhjnaxdplglrnpdzg"
+; comment
+L93: inc *r1
+dec L179
+L94: jsr L218
+not r1
+inc r1
+cmp #-39, #-59
+L95: .string "knmniqzwhdlc"
+mov *r2, r0
+add #-216, L212
+sub #-186, *r3
+add *r2, L135
+L96: .string "zsmkemizaexcpitqrazhfpb"
+bne L298
+bne L241
+jmp L270
+L97: inc L214
+inc L319
+sub L257, *r1
+not r2
+clr L229
+red L155
+cmp *r3, r4
+lea L157, *r1
+sub L340, r3
+clr L249
+L98: stop
+bne *r7
+bne L189
+jsr *r3
+rts
+cmp L108, #199
+L99: lea L104, L213
+not L243
+L100: jsr L329
+add r4, L309
+add r4, r2
+rts
+L101: mov r1, L195
+cmp r3, #147
+sub L252, *r6
+clr *r5
+mov *r2, L141
+mov L268, r1
+L102: dec L178
+
+L103: not r7
+sub #-167, L154
+inc L175
+prn L150
+add *r4, *r0
+red *r7
+dec L189
+jmp *r5
+L104: red *r0
+L105: .string "svfisgbekw"
+sub L285, L110
+jmp *r7
+L106: inc L230
+L107: .string "hdgarnarktfnfacly"
+rts
+; comment
+L108: prn *r6
+rts
+add r5, *r4
+L109: clr L252
+L110: jsr L186
+rts
+prn #134
+L111: bne L248
+red r1
+L112: clr r0
+stop
+L113: clr r4
+add #20, r6
+L114: not *r4
+mov *r3, L192
+L115: rts
+add r7, r0
+stop
+stop
+L116: red *r6
+mov r6, *r1
+mov #-45, *r0
+L117: .string "orkukq"
+L118: not *r5
+
+L119: add L193, *r5
+rts
+clr L210
+cmp L303, r2
+L120: prn L121
+clr L304
+red r0
+L121: .data 794, -331, 465
+lea L251, L163
+L122: red *r3
+red r5
+jsr L306
+L123: prn #67
+L124: lea L331, *r4
+L125: jsr *r3
+L126: sub r7, *r3
+cmp r1, *r5
+L127: mov #-208, *r6
+red L237
+sub r7, *r3
+cmp #-149, r4
+L128: dec *r3
+bne *r5
+inc *r6
+add r4, L177
+inc r2
+not *r4
+jsr L344
+L129: .data 785, 887, 845, -517
+L130: stop
+not *r0
+red *r0
+L131: .data 668, 934, -267, 386, -554, 314
+inc L173
+L132: .data 594, -236, 476
+sub #105, *r3
+L133: clr *r0
+prn r2
+jmp L174
+L134: prn r3
+L135: sub L331, *r6
+rts
+sub L156, *r4
+L136: .data 266, 746, 501, -947, -700, 756, -650, -855
+red L307
+L137: bne L312
+L138: prn *r4
+
+not r2
+
+lea L302, r1
+not r2
+; comment
+add #200, r2
+L139: lea L332, *r6
+jsr *r4
+L140: jmp *r1
+
+not L264
+mov r6, r2
+jsr *r0
+L141: prn *r4
+L142: stop
+clr *r0
+clr r6
+jmp L157
+add r0, r2
+not r6
+; comment
+rts
+lea L330, *r3
+prn #-181
+jsr L149
+L143: .string "ystmnzibfkkzdrapmz"
+L144: bne *r4
+jsr L347
+bne L284
+dec L321
+lea L297, *r5
+add L214, r7
+rts
+L145: lea L229, *r7
+inc L184
+
+red *r6
+L146: add r3, *r2
+L147: .string "cdoipefzc"
+add *r3, L253
+sub r6, L150
+L148: dec L338
+L149: red r0
+mov r2, *r1
+L150: bne L325
+mov L208, r1
+L151: jsr L323
+L152: .string "ajkvgcptywcuudnttuxkqkb"
+L153: .data 830, -31, 323, 794
+prn r2
+L154: not L297
+rts
+L155: .string "race"
+L156: .string "mxbhqzqbaatyabufblwfr"
+jmp *r2
+lea L306, r2
+L157: .string "pzbxgflsrbcbmoc"
+bne *r6
+mov #247, L314
+L158: dec L229
+cmp #-223, #28
+cmp L211, *r7
+L159: clr r4
+cmp L167, r0
+
+L160: .string "kfcrtztmzoeoozyhczfdu"
+not r1
+prn L238
+L161: not *r4
+L162: .string "nbffbdsuixxc"
+
+sub #-7, L222
+not L269
+L163: sub #-107, *r5
+L164: inc r5
+red r0
+L165: rts
+L166: cmp r3, #84
+L167: inc *r0
+not L279
+clr *r6
+red L201
+inc L185
+jmp L342
+jsr L278
+; comment
+rts
+add L205, r7
+jmp L270
+lea L253, L245
+L168: red r5
+L169: clr L291
+L170: bne L221
+add *r7, r2
+L171: inc *r2
+cmp L318, *r0
+L172: dec L228
+inc *r7
+not *r3
+prn r4
+L173: .string "fpgy"
+L174: not r4
+L175: .data 765
+stop
+jsr L227
+lea L183, *r2
+; comment
+L176: .data 799
+rts
+sub r5, r4
+L177: rts
+sub L301, r3
+stop
+lea L252, *r4
+L178: sub L188, L311
+jmp *r5
+jmp L281
+mov L249, r2
+jmp *r1
+dec *r6
+L179: clr *r3
+clr r1
+add #-136, *r2
+L180: inc L338
+L181: .data -759, -239, -937, -360, -831
+L182: red *r3
+dec L254
+sub *r6, r4
+jsr *r1
+red *r2
+jmp L261
+add *r4, L259
+L183: .data 77
+not *r1
+L184: .data -528, 196
+L185: jmp *r6
+not *r3
+L186: sub L275, r7
+inc L276
+L187: clr *r0
+cmp L291, r0
+mov #-53, *r3
+L188: cmp #-39, r1
+stop
+L189: .string "bfgiry"
+jsr *r1
+red *r7
+L190: lea L219, L348
+dec *r2
+L191: dec L276
+L192: .data 62, 274
+jsr *r4
+red L242
+L193: red L267
+prn L264
+add r1, L202
+inc L196
+not L277
+lea L285, *r4
+sub #140, L249
+jsr *r7
+inc *r5
+L194: lea L265, L293
+L195: inc r5
+L196: red *r3
+inc *r7
+L197: .string "wqibvnlzmidnuwbw"
+jsr *r7
+jmp L213
+bne *r5
+dec r3
+lea L337, *r0
+L198: .data -183, -957, -382, 306, 498, 66, 329
+red L322
+lea L341, *r3
+L199: .data -825, -216, 719, 180, -970
+mov *r6, L343
+L200: .data 65, -904, 536, 812
+red *r7
+rts
+sub *r2, r7
+dec r2
+L201: mov *r5, r0
+jsr L302
+lea L345, r2
+not r3
+inc r0
+L202: stop
+L203: jsr *r1
+dec r5
+L204: jsr *r7
+; comment
+L205: dec *r0
+L206: cmp r1, *r2
+prn L340
+not r1
+lea L221, L324
+prn #242
+L207: stop
+jmp L323
+sub *r5, r0
+cmp r1, L224
+clr r1
+add r5, r5
+prn r1
+L208: dec *r4
+L209: cmp #-72, r5
+; comment
+L210: .string "nnrhqouxvjjy"
+clr *r7
+rts
+not r6
+not r3
+add *r1, L283
+jsr *r4
+L211: .string "rldgodryagilkckbpncco"
+L212: .data -529, 731, 782, -869
+lea L253, L334
+cmp L219, *r0
+add #191, r2
+L213: lea L290, L214
+L214: .data 515, -433, -48, -260
+prn *r5
+rts
+rts
+L215: sub *r1, r1
+stop
+lea L307, L225
+clr L245
+add #-40, L318
+jmp L240
+L216: .string "pdwaarlvlirfybdckuc"
+L217: .data -609, -822
+add #-160, L313
+sub *r4, r4
+clr *r6
+sub r3, *r1
+sub L264, *r7
+L218: rts
+L219: jsr *r6
+dec r6
+jmp L291
+not L281
+jsr *r2
+stop
+lea L304, *r5
+L220: red *r3
+L221: .data 613, 780, 697, 874, 620
+L222: stop
+; comment
+inc *r4
+lea L295, r2
+L223: rts
+red r0
+L224: .data 789
+L225: jmp *r1
+red *r4
+; comment
+jsr L292
+not L246
+L226: cmp *r7, r5
+red r6
+L227: lea L288, L338
+dec r3
+clr L316
+L228: not L310
+add #24, r6
+
+jmp L246
+L229: jsr L327
+cmp r5, r3
+L230: inc *r6
+rts
+L231: jsr *r0
+rts
+add *r0, L333
+prn *r6
+L232: not r3
+L233: jsr L316
+L234: .string "jsq"
+sub r5, L259
+rts
+L235: lea L251, r6
+red *r5
+L236: .data -826, 163, 933, 820, -79, 740
+rts
+rts
+jmp *r3
+clr r7
+sub L301, *r7
+L237: .string "owjvwbawpdfkxdx"
+jmp L310
+dec L320
+L238: jsr *r1
+rts
+dec L295
+inc *r2
+prn #-233
+L239: rts
+L240: mov L291, L263
+rts
+L241: add L341, L260
+stop
+L242: .string "cxqkgytkqtq"
+L243: .data 251, 838, -969, 212, -682, -585, 328
+clr *r3
+inc L312
+L244: cmp *r3, L297
+L245: prn L344
+L246: dec L316
+L247: .string "waegohltqjactemaf"
+L248: jsr *r5
+prn r3
+dec r1
+L249: lea L293, r7
+L250: mov *r7, L300
+add *r7, r5
+dec r4
+dec r5
+red L298
+mov L307, L322
+L251: .string "mhujfqiqopcjtoolelxesxxw"
+L252: cmp #-47, r1
+stop
+; comment
+inc r3
+add *r5, L339
+L253: bne *r0
+lea L302, r7
+L254: clr *r5
+jsr *r3
+jmp *r5
+L255: red L259
+L256: .string "dedvymfjscrb"
+clr r6
+L257: .string "wygekoi"
+bne *r2
+dec r3
+L258: .data 291, 209, 902, -968
+L259: .data 126, 771, 487
+bne L342
+cmp L312, #-239
+clr r7
+sub *r1, L293
+cmp L332, L327
+L260: stop
+L261: .data 593, -431, -92, -155, -704, 997
+red L281
+dec *r4
+stop
+stop
+not r5
+bne L309
+L262: inc r1
+L263: cmp r6, #-141
+clr L347
+L264: prn #144
+bne *r0
+prn *r7
+dec r3
+not L317
+inc r6
+
+clr *r1
+mov #237, L307
+red r0
+L265: .data -694, 623, 149
+jmp L318
+mov r3, L329
+not L316
+dec r7
+dec *r7
+L266: dec L309
+L267: dec r2
+L268: clr *r7
+L269: sub r0, *r4
+bne *r7
+jmp L339
+rts
+stop
+jsr *r6
+lea L304, r4
+jmp L294
+jmp L272
+not r2
+inc r4
+stop
+L270: cmp r2, r1
+dec *r3
+inc L330
+jsr L337
+bne L279
+bne *r1
+lea L277, *r7
+L271: stop
+; comment
+prn *r1
+L272: prn L345
+red *r4
+L273: prn #-119
+
+L274: mov r0, r7
+clr *r3
+L275: jmp L317
+L276: .data -1000, -344, -179, 427, 582, -804
+mov L299, L293
+L277: sub L334, *r2
+red L341
+L278: jmp L320
+stop
+L279: stop
+dec *r5
+L280: rts
+dec L330
+cmp #170, #90
+L281: jsr *r0
+L282: inc r0
+red r1
+not *r0
+dec r1
+
+clr *r0
+clr *r7
+L283: sub L311, r0
+sub r3, *r0
+L284: sub L311, r0
+L285: red L335
+L286: rts
+dec r0
+
+L287: .data 902, 78, 331, -325
+
+lea L332, L311
+L288: add r0, *r0
+rts
+stop
+L289: red L342
+stop
+jsr *r6
+L290: lea L328, *r0
+L291: .data -795
+jsr *r0
+sub #-161, *r3
+L292: clr r3
+jsr L304
+L293: not L307
+not r4
+dec L332
+rts
+red r5
+L294: cmp #-199, L298
+sub L344, r1
+L295: .string "flfousa"
+; comment
+red r0
+lea L316, *r1
+; comment
+red r4
+not r4
+L296: bne *r4
+cmp r0, L301
+clr *r0
+cmp *r2, #-98
+L297: lea L344, *r4
+L298: .data -322, 216
+mov r7, L316
+stop
+L299: .string "wizkuaqiviwlvygppnweslp"
+L300: prn #43
+L301: bne L318
+stop
+red L303
+dec r7
+bne L327
+rts
+mov r7, L341
+not r4
+
+L302: jsr L342
+bne L317
+L303: cmp L323, #-37
+jsr L329
+inc *r5
+L304: .string "cgsu"
+L305: mov *r0, *r6
+bne *r5
+L306: .string "chmnjzcrifjc"
+
+L307: sub #242, r3
+jsr L332
+jmp L325
+cmp #-144, L312
+L308: rts
+L309: jmp L336
+red r6
+red *r2
+sub #-251, L316
+jmp L346
+rts
+not *r0
+L310: .string "jgqcsobsbfpnyoroysa"
+clr L334
+L311: rts
+lea L325, r1
+lea L338, r6
+rts
+L312: .data 237
+L313: .string "tvmzexwteb"
+mov #49, r2
+L314: dec *r6
+prn #11
+rts
+L315: cmp *r3, *r5
+L316: .string "zdc"
+red r2
+L317: mov L340, r1
+clr L335
+rts
+red r0
+L318: bne *r6
+L319: .data 128, 56, 671
+not *r4
+jsr L338
+prn L327
+L320: prn L336
+jmp *r0
+mov #-158, r1
+stop
+L321: dec *r2
+
+L322: add #-177, *r3
+L323: .string "mgdmkt"
+L324: .data 356, -748, 890, -755, 874, 400, -220
+L325: rts
+dec *r3
+L326: .string "ndumddjzmsqemnakwkybix"
+cmp #42, L344
+bne L333
+rts
+L327: jsr *r0
+not r4
+add r5, r5
+red r6
+L328: inc L339
+L329: stop
+inc L342
+L330: sub *r5, L349
+L331: .data 412, 439, -965, 788, 992, -335, 623
+red *r6
+dec r2
+stop
+sub r0, *r7
+clr L341
+L332: .string "vnwht"
+L333: cmp r4, r1
+L334: .data -801, 925, 481, -792, -128, -372, 679
+sub *r5, *r4
+not L348
+L335: sub *r7, r1
+prn *r0
+jmp L339
+jsr *r5
+L336: clr *r5
+cmp #47, #227
+jmp *r6
+; comment
+clr *r2
+prn L337
+L337: stop
+jsr L338
+L338: prn *r7
+cmp #30, L347
+not r6
+jsr L347
+inc r6
+inc r2
+L339: .data 140, 351, -214, 782, -500, 478
+L340: cmp *r2, r4
+L341: jmp L348
+lea L349, L342
+L342: jmp *r0
+jsr *r4
+L343: .data -524, 752, -725, -281
+jmp L347
+bne *r7
+L344: jmp L347
+jmp L349
+L345: .data -811, -215, 900, -202, -713
+prn r4
+bne *r0
+lea L349, *r1
+lea L350, *r4
+
+dec r2
+jsr *r0
+dec *r7
+clr L349
+L346: rts
+lea L348, r1
+L347: rts
+L348: lea L349, L350
+L349: inc *r5
+rts
+L350: inc r1
+rts
+lea L185, *r7
+cmp r5, #128
+prn L256
+stop
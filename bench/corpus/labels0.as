@@ -0,0 +1,1041 @@
+; Generated by genCorpus --seed 1
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+inc L530
+L0: rts
+L1: sub r7, *r3
+L2: bne L601
+jsr L0
+L3: stop
+L4: prn r1
+cmp r1, #-87
+L5: mov L2, *r1
+L6: mov *r1, r5
+
+dec *r2
+L7: .string "ycouglxdfqblmmgtmnfwzbe"
+L8: lea L1, *r6
+L9: stop
+L10: red r0
+rts
+L11: cmp r1, *r3
+jsr *r2
+L12: mov *r4, L3
+dec L76
+L13: .string "sbdnnhsxxvecpjapfzgm"
+L14: add #-32, *r4
+L15: not *r6
+dec L14
+L16: sub #187, r1
+L17: add L84, *r7
+L18: mov #8, L13
+L19: .data 842, -776, -697, -230
+L20: prn r2
+L21: red *r2
+mov r0, *r2
+L22: .data -21
+L23: stop
+sub r3, r2
+L24: sub #-185, L4
+L25: jmp L9
+L26: lea L509, L5
+L27: not *r7
+L28: jmp L377
+L29: red L8
+L30: bne L14
+jmp L525
+L31: lea L194, *r5
+cmp L183, #-189
+L32: not r6
+rts
+clr r2
+L33: inc L186
+L34: red L51
+L35: prn #122
+L36: .data 121, -730
+L37: add *r4, L21
+clr L391
+rts
+mov L187, L548
+L38: not *r3
+dec L22
+L39: bne *r1
+L40: add *r1, L558
+L41: mov r4, *r5
+L42: bne *r0
+
+inc L321
+L43: clr r6
+cmp r7, r0
+L44: mov *r4, *r6
+L45: add r2, *r4
+L46: rts
+L47: inc L27
+L48: add L498, *r5
+dec L248
+L49: .data -1000, 190, -995, 638, 139, -510, 225, 809
+L50: dec r0
+clr *r6
+L51: cmp L503, #12
+L52: prn #-230
+L53: .data 659, -374
+L54: jmp L6
+L55: prn *r5
+lea L348, r7
+L56: bne *r0
+sub r4, *r7
+L57: .data -526, 822
+clr L333
+prn r0
+prn r3
+bne L2
+L58: lea L8, r7
+L59: lea L552, r3
+L60: add *r4, *r5
+L61: rts
+L62: prn #70
+stop
+L63: rts
+L64: bne L304
+L65: .string "hsydhrulmbnniozjrqozxjz"
+L66: bne *r6
+not *r5
+; comment
+L67: sub r1, L278
+L68: .string "ginrlgsq"
+red L302
+inc L19
+jsr *r6
+L69: not *r1
+jsr *r5
+inc L78
+L70: prn r1
+L71: clr *r5
+jmp *r3
+L72: prn #242
+L73: bne L128
+L74: inc r2
+sub L2, L515
+sub L70, L129
+L75: not L53
+red *r3
+bne L60
+L76: red L65
+L77: bne L527
+L78: .string "xatyfdgnmjunyiy"
+prn L516
+mov *r6, r6
+dec L51
+bne *r2
+L79: mov *r0, L26
+L80: not r7
+not *r6
+L81: add r6, L568
+not *r0
+mov *r1, *r5
+L82: jsr *r4
+
+prn L189
+L83: sub r7, r4
+L84: jmp L70
+jmp L61
+L85: add L71, L74
+add #-192, r7
+L86: inc L308
+L87: .string "ekkvrrdensh"
+clr *r7
+L88: prn *r4
+L89: mov #245, L594
+L90: clr *r3
+red r3
+L91: jmp L36
+L92: add #-127, L36
+L93: .string "dvhweaqnbpaqv"
+L94: stop
+bne *r0
+L95: dec r5
+inc L479
+L96: jsr *r3
+L97: stop
+; comment
+L98: lea L321, L583
+L99: inc L58
+L100: prn *r0
+not r1
+L101: .string "vnqqmjlhqcmtoc"
+jsr *r0
+L102: red L145
+cmp L154, *r2
+jsr *r1
+rts
+; comment
+L103: jsr L589
+L104: .string "lon"
+L105: stop
+lea L29, L112
+L106: clr *r1
+cmp #-240, r1
+L107: prn *r5
+L108: jmp *r6
+L109: red *r3
+L110: jmp L375
+L111: .string "z"
+L112: jmp L6
+L113: clr L513
+L114: not *r1
+L115: jsr *r6
+
+L116: add *r0, r1
+L117: add r1, L60
+L118: mov *r2, L172
+L119: red r2
+inc r6
+L120: rts
+L121: mov #149, r7
+jmp L572
+L122: .data 660, -812, 205, 885, -263
+inc *r0
+L123: sub #166, r4
+lea L468, *r6
+L124: add *r5, *r7
+L125: cmp #25, *r4
+L126: lea L370, L45
+L127: .string "spfp"
+lea L303, *r0
+L128: red L41
+bne *r0
+L129: jmp *r7
+L130: add #-82, r3
+mov r1, *r7
+; comment
+L131: inc *r0
+L132: add L485, *r2
+L133: bne L360
+L134: not r6
+lea L451, *r7
+L135: prn #67
+L136: .string "yovroznct"
+L137: .string "rralazdgspt"
+L138: .string "i"
+jmp L45
+; comment
+L139: red L121
+sub L51, L111
+
+lea L175, L431
+; comment
+cmp L13, *r3
+red r2
+L140: rts
+L141: stop
+L142: mov #-184, L231
+L143: cmp *r1, #129
+L144: bne L610
+add L466, L293
+L145: prn #29
+L146: lea L113, L286
+; comment
+L147: jsr L47
+lea L130, L566
+add r1, L64
+L148: inc r0
+L149: lea L64, L197
+; comment
+stop
+not r4
+L150: rts
+L151: mov r1, L69
+L152: .string "rpfzbqzgvz"
+L153: red r7
+L154: red L88
+L155: bne L87
+
+L156: stop
+sub *r7, r5
+L157: prn r3
+L158: rts
+L159: .string "wdsm"
+rts
+jsr *r4
+sub L38, r5
+rts
+L160: .data -9, -494, -633, -177, -770
+prn L106
+stop
+cmp #-76, L119
+L161: clr *r4
+L162: jsr L160
+L163: jmp *r4
+L164: red *r3
+L165: cmp *r3, #-134
+jsr *r3
+jsr L480
+L166: dec r1
+L167: jsr *r3
+L168: .string "ayrlncgbndiugnepp"
+jsr *r7
+L169: bne *r3
+L170: clr *r7
+L171: dec r4
+L172: rts
+L173: sub *r2, L551
+prn *r0
+dec L48
+jmp L101
+L174: red L300
+add L243, *r1
+L175: cmp L47, #-195
+L176: not L56
+L177: jmp *r0
+L178: inc r7
+L179: rts
+L180: inc r7
+stop
+sub L148, *r6
+L181: clr L101
+prn *r6
+mov r1, *r4
+bne L446
+L182: clr r2
+L183: stop
+L184: inc L117
+L185: lea L291, r0
+clr L78
+jmp *r5
+L186: rts
+L187: inc r1
+L188: bne L63
+L189: clr r7
+
+jmp *r3
+L190: bne L205
+bne *r0
+; comment
+L191: .data -455, -663, 185, -179, -313, 905, 477
+L192: mov #217, L73
+L193: clr L11
+L194: jmp L400
+L195: dec L6
+L196: not r4
+jmp *r6
+red *r4
+L197: prn #174
+L198: dec L481
+L199: dec *r6
+L200: jmp *r4
+L201: rts
+L202: cmp L458, #232
+L203: add *r5, L171
+L204: add r5, *r2
+prn *r3
+L205: jsr L562
+mov #86, r2
+add *r3, *r5
+L206: add #-52, r0
+; comment
+L207: .string "pntzopuhwffinnawklfw"
+stop
+lea L565, r5
+L208: stop
+jmp L7
+L209: sub *r2, r7
+L210: red L467
+L211: dec L91
+L212: jmp *r3
+L213: sub *r2, *r4
+stop
+L214: cmp #52, *r4
+L215: red r4
+L216: rts
+L217: .data 455, -965, 247, 292
+L218: .string "pv"
+jmp L514
+L219: add r6, *r5
+dec *r0
+L220: clr L178
+clr r0
+L221: bne L40
+bne *r2
+L222: dec L54
+not L360
+L223: jmp *r7
+lea L579, *r6
+; comment
+L224: clr *r1
+L225: .data -637, 667, 856, 724, -134, -524, 693
+inc *r4
+L226: .string "lelkyjadpugna"
+L227: red r3
+cmp r5, r4
+L228: jmp *r4
+L229: dec *r1
+jmp *r6
+L230: .data 795
+L231: stop
+L232: .string "dskevryfyfadgodxphasc"
+clr *r2
+L233: lea L337, *r0
+L234: .string "shdikincrmjkzkmbyqxuc"
+lea L70, *r4
+L235: .data -30, 992, -236
+L236: jsr L164
+dec *r2
+L237: jmp *r2
+L238: prn *r2
+L239: rts
+L240: .string "geg"
+L241: sub r4, *r0
+prn r5
+L242: stop
+L243: rts
+jmp L207
+jmp *r0
+mov #-80, *r1
+stop
+L244: clr L137
+L245: add #-34, L165
+L246: bne L457
+L247: sub r4, r6
+not *r0
+L248: not *r4
+L249: lea L433, *r5
+L250: .data -439, -663, 697, -247, 471, 613, -972
+jsr L33
+L251: not *r5
+L252: rts
+bne *r1
+L253: sub L396, *r0
+L254: mov #132, r3
+L255: bne L343
+L256: sub #-156, r0
+L257: lea L194, *r7
+L258: jsr *r3
+L259: .data -980, -249, 492, -197
+L260: .string "mnljrskjrecicvtuhiue"
+dec r5
+red L562
+lea L270, r0
+L261: sub #-221, L164
+L262: stop
+L263: clr *r3
+L264: inc L578
+L265: mov L488, L162
+L266: .data -292, -204, -872
+L267: stop
+sub L128, r6
+L268: mov r4, r2
+bne *r2
+L269: jmp *r2
+L270: prn r2
+rts
+L271: cmp L619, *r0
+L272: clr *r0
+rts
+L273: stop
+L274: not r3
+L275: stop
+red *r4
+L276: cmp #-194, L258
+L277: prn r0
+jmp *r4
+L278: clr r4
+rts
+L279: prn L572
+rts
+L280: bne L235
+L281: prn L501
+clr r4
+L282: .data 981, 853, 146, -564, -524, -346
+L283: prn L36
+L284: stop
+L285: mov r0, L267
+L286: red *r5
+L287: cmp #-168, *r7
+lea L372, L558
+L288: mov r7, L194
+bne L299
+
+L289: add r7, *r5
+jsr *r3
+L290: jmp *r7
+L291: .string "xbmalzdkibnbrz"
+L292: .data 251, 131, 892, 102
+L293: rts
+L294: sub r3, r3
+add *r3, L334
+L295: .string "ipydrzmyyewnloakwzcly"
+L296: not *r6
+L297: add *r6, *r0
+L298: .data 277, 342
+
+L299: not L412
+L300: mov #-131, r4
+; comment
+L301: jsr L495
+L302: red *r3
+mov L50, r5
+jmp *r6
+L303: inc r5
+bne L90
+L304: clr L474
+L305: jsr L220
+L306: sub *r3, r4
+L307: clr L60
+lea L329, L452
+L308: sub *r3, r7
+lea L579, *r1
+L309: add *r4, r2
+cmp *r7, #-125
+; comment
+L310: .string "zcuootgbxwudpqqebdxozz"
+
+L311: not r3
+L312: stop
+L313: rts
+jmp L87
+red r4
+L314: mov #-214, *r3
+L315: inc *r7
+L316: rts
+L317: jmp L134
+L318: .string "vlselgbhjcptsdkcboceu"
+L319: bne *r5
+L320: jmp *r1
+
+red r0
+L321: jmp L401
+jsr *r0
+dec L334
+mov *r5, L580
+rts
+L322: lea L606, r3
+L323: jsr *r7
+L324: clr *r4
+L325: not r4
+add #-128, r2
+L326: .string "oftezeilbbfqzlypdfqwu"
+L327: rts
+jsr L552
+L328: red *r6
+L329: rts
+L330: dec *r5
+not *r3
+cmp L302, *r6
+L331: clr r5
+prn r6
+L332: add L343, *r3
+cmp r2, L563
+rts
+L333: rts
+L334: inc *r2
+L335: jmp *r7
+mov L119, r7
+clr L436
+L336: add r6, *r3
+L337: .string "vukqtzybebprhdgnranae"
+L338: rts
+
+sub r5, *r1
+L339: .data 684, 776, -570
+L340: prn *r0
+add L581, L536
+L341: inc r1
+clr r6
+L342: lea L61, *r2
+L343: .data -204, 888, 741, 643, 760
+not L42
+L344: red *r5
+L345: jmp *r0
+L346: .string "bthc"
+dec L20
+mov #-211, L257
+L347: jsr *r3
+L348: cmp r4, #-103
+L349: cmp L446, r5
+
+L350: prn *r7
+L351: .string "cnsljrjbqilp"
+L352: not r4
+red L484
+L353: cmp L121, r7
+bne *r3
+L354: inc r4
+L355: not *r4
+L356: clr *r4
+L357: dec L121
+L358: .data 361, -322
+L359: cmp r6, *r3
+L360: dec r1
+prn L193
+L361: red L303
+L362: dec r7
+L363: mov #-71, *r2
+L364: .data 232, -301, -751, 171, -668, 680
+L365: red *r1
+L366: jsr L393
+rts
+rts
+L367: not L378
+clr r6
+L368: .data -76
+L369: cmp L23, r7
+L370: .data 247, 831, 681, -908, -692, -237
+stop
+L371: lea L429, *r3
+add #96, L379
+L372: prn #-92
+L373: rts
+L374: lea L454, r2
+L375: lea L284, L90
+L376: clr *r2
+L377: stop
+inc r2
+L378: jmp L229
+L379: not L534
+dec L471
+L380: cmp r1, L100
+L381: red *r0
+cmp #-176, L352
+L382: red r5
+L383: bne L37
+clr *r3
+; comment
+L384: mov #174, *r6
+bne *r4
+prn *r7
+; comment
+
+red L424
+
+L385: prn *r3
+lea L483, *r0
+L386: not L584
+; comment
+cmp #20, L451
+L387: .data -567, 337, -578
+jmp L435
+L388: dec r0
+L389: .string "uoy"
+L390: add L62, *r0
+L391: jsr *r6
+L392: inc *r0
+L393: red r0
+stop
+L394: inc r1
+L395: cmp L401, #132
+L396: mov *r7, r0
+L397: sub *r3, r6
+L398: prn L605
+L399: .data 238, 465, 585
+L400: .data 83, 396, -637, -705
+prn L98
+
+L401: dec L471
+; comment
+L402: lea L146, *r1
+L403: lea L423, r4
+cmp L18, #125
+cmp *r4, *r1
+L404: lea L172, L534
+L405: rts
+L406: dec L583
+L407: add #43, r0
+L408: jmp *r0
+sub *r6, r4
+jmp *r0
+L409: lea L479, L609
+cmp #-236, L453
+L410: jsr L123
+prn r5
+L411: sub *r6, r3
+cmp L30, *r6
+L412: clr L504
+sub r7, *r2
+dec L111
+L413: add L471, r1
+L414: sub #117, r4
+lea L251, *r5
+L415: inc r1
+clr r3
+L416: red *r6
+stop
+stop
+L417: cmp #30, r7
+
+L418: dec *r5
+L419: sub *r6, r4
+bne L449
+L420: .data -307, 996, 798
+mov r6, L609
+L421: jsr *r3
+L422: red L10
+L423: jmp *r4
+L424: add #178, *r4
+L425: .string "biaodeigdqtrwgcbyunwr"
+L426: red r5
+clr r6
+L427: sub L224, r5
+L428: dec *r4
+L429: not r5
+mov r3, L264
+L430: red L443
+L431: add r6, L585
+
+mov #-204, *r6
+L432: .data -442, 154, 436, 875, -802
+L433: .data 627, 935
+L434: .string "sexhewwbkwaz"
+L435: prn #1
+mov L430, r2
+jsr L503
+L436: sub r3, L289
+L437: inc *r0
+L438: bne L522
+L439: clr *r1
+red *r7
+L440: bne *r0
+L441: prn r4
+mov L388, L468
+L442: .data -542, -191, 589, -328, 884, 340
+L443: inc L207
+L444: red r4
+
+lea L444, *r3
+L445: not *r1
+stop
+L446: red *r2
+L447: add *r1, *r3
+L448: cmp #-100, #-4
+rts
+L449: lea L472, *r5
+red *r0
+L450: .data 990, 832, -297, -54, -164, 78
+L451: .data 291, -287, -390, 686
+L452: add L509, *r0
+red r6
+L453: red L464
+L454: not *r3
+bne L77
+red L263
+
+bne *r7
+L455: not *r4
+L456: add *r1, r5
+jsr L619
+L457: clr *r6
+L458: rts
+clr L522
+prn L619
+L459: stop
+not L377
+L460: .data 879, -834
+mov L444, r2
+jsr *r7
+L461: red L295
+L462: mov *r4, r7
+red *r4
+prn *r6
+L463: rts
+L464: rts
+cmp L151, *r0
+L465: .string "hvzje"
+L466: inc *r2
+lea L194, r4
+stop
+L467: mov *r1, *r4
+bne *r3
+prn #-3
+L468: sub *r2, *r1
+L469: .string "adskmpqnciu"
+mov *r5, L69
+L470: jsr L356
+L471: clr L287
+L472: not r1
+L473: bne *r2
+L474: jsr L610
+L475: clr r4
+L476: .string "ht"
+L477: stop
+dec *r1
+L478: lea L287, *r6
+; comment
+L479: stop
+prn L598
+
+rts
+dec *r5
+L480: stop
+L481: inc r7
+L482: red *r5
+L483: clr *r5
+L484: jmp *r4
+L485: rts
+rts
+L486: jmp *r5
+rts
+L487: clr r5
+L488: cmp L514, #133
+L489: clr r1
+L490: clr r3
+mov r3, *r7
+L491: .string "cgdnnmwhlfjqsgyp"
+jmp *r4
+L492: .data 769, -844, -282, 781, 131, -877
+L493: add *r3, *r1
+L494: sub #-48, r3
+L495: mov *r6, r1
+lea L612, *r2
+L496: prn r3
+
+L497: jsr L48
+L498: lea L98, L272
+bne L232
+rts
+L499: clr *r4
+stop
+mov L42, L232
+L500: inc L579
+L501: cmp L580, L590
+red L528
+L502: inc *r2
+L503: stop
+stop
+stop
+mov *r1, r1
+L504: jsr *r1
+
+L505: .string "wzoyerztupqbpfeghgkje"
+L506: bne *r2
+L507: sub r1, *r3
+L508: .string "wnvgsfljgk"
+red r6
+sub L526, *r7
+L509: add r6, *r3
+L510: stop
+L511: clr L512
+jsr L526
+red *r5
+mov *r1, *r6
+bne L552
+dec L311
+inc *r4
+L512: cmp L571, r7
+prn *r0
+not *r0
+cmp *r4, #-18
+jmp L545
+L513: bne *r0
+L514: dec *r6
+jsr *r0
+inc r2
+; comment
+L515: mov #185, *r7
+L516: add r7, r6
+jsr L462
+L517: .string "ugsgk"
+L518: inc L306
+prn *r0
+not L564
+L519: stop
+jsr L503
+L520: clr r2
+jmp *r5
+sub *r6, L22
+L521: prn *r5
+L522: clr L268
+add r0, L223
+L523: .string "ijityqb"
+L524: jmp L612
+add r3, L440
+L525: .string "pyovglcdkimvugmc"
+L526: lea L568, L404
+jmp *r0
+L527: .data 507, -978, -108, -498, 393, -396, 4, -287
+L528: cmp *r3, r6
+L529: inc *r3
+jmp *r2
+L530: mov L568, *r4
+L531: .string "inkekjqvmvjqj"
+L532: .string "npck"
+L533: inc r2
+L534: bne L57
+clr r2
+bne *r3
+clr *r7
+prn #-3
+L535: stop
+L536: prn *r2
+L537: .data 965, 281, -928, 930, 405, 962, 330
+dec *r1
+L538: lea L27, L550
+L539: clr r7
+mov #-196, *r3
+jsr L561
+L540: lea L608, *r4
+L541: .data -738, 117, 371, 692, 607
+L542: bne *r0
+L543: sub #179, L580
+not *r3
+rts
+stop
+L544: mov #-97, L602
+L545: jmp *r2
+
+L546: jmp L420
+L547: prn #249
+L548: not r6
+L549: add L605, L237
+L550: .data 890, 100, -760, -278, 31
+L551: jmp *r1
+sub L466, L102
+L552: .string "gamntjbofcwciu"
+L553: not L236
+L554: prn *r5
+not L328
+inc L341
+L555: dec L4
+L556: lea L617, L590
+L557: bne L616
+L558: jsr L596
+prn *r0
+L559: .string "ohdpbqvv"
+inc *r3
+rts
+L560: lea L174, L589
+L561: mov L607, L545
+L562: mov *r2, r6
+L563: jmp L439
+stop
+L564: clr r4
+sub #-222, L20
+L565: dec L575
+bne *r4
+clr L570
+cmp *r0, *r1
+L566: dec L611
+L567: inc *r4
+prn L363
+red *r5
+bne *r5
+
+L568: red r3
+L569: jsr *r4
+L570: sub #-198, *r5
+L571: bne *r4
+L572: prn L616
+L573: stop
+L574: rts
+rts
+L575: add L601, r6
+L576: inc *r7
+prn #151
+L577: add #-249, *r3
+L578: add L213, L476
+L579: red L401
+red L177
+L580: bne *r5
+L581: jsr *r1
+L582: stop
+L583: mov #106, r2
+inc r2
+sub r4, L618
+stop
+L584: jmp *r1
+; comment
+; comment
+L585: rts
+L586: sub *r4, L594
+L587: mov #241, L350
+L588: lea L599, *r1
+L589: mov *r0, L611
+L590: jmp L292
+rts
+L591: stop
+L592: jsr *r6
+L593: stop
+L594: .data 995, -490, -656, 522, -927, 277
+L595: not L504
+jmp L596
+stop
+L596: prn L353
+mov #-196, r4
+L597: clr L306
+
+L598: rts
+L599: add *r0, r2
+L600: lea L508, *r0
+L601: cmp r5, L199
+stop
+not r3
+L602: inc r6
+L603: cmp r3, r7
+; comment
+not r6
+L604: dec r4
+L605: stop
+jmp L608
+L606: jmp L616
+L607: prn *r5
+L608: not L9
+L609: add *r7, L617
+L610: stop
+rts
+mov *r4, r2
+L611: not r7
+not r2
+L612: stop
+lea L127, L618
+inc *r7
+L613: jsr L95
+not *r5
+bne *r1
+inc L616
+lea L617, r1
+
+L614: jmp L230
+jmp *r6
+red r3
+L615: dec *r6
+L616: jmp L619
+inc r3
+L617: jmp *r2
+L618: rts
+L619: dec *r4
+stop
@@ -0,0 +1,1041 @@
+; Generated by genCorpus --seed 2
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+L0: rts
+L1: dec r6
+lea L238, r4
+lea L566, *r6
+mov *r0, *r4
+rts
+lea L0, L185
+L2: jmp L589
+sub L2, L80
+L3: dec *r1
+L4: sub #14, r6
+add L536, r1
+prn r1
+jsr L252
+bne L0
+dec *r5
+L5: jsr *r3
+
+L6: .string "zfskpgplnkl"
+not r1
+bne *r1
+L7: .string "todxwvttdilmofvgldzh"
+clr r2
+L8: .string "pkmmbhqgpopalewwtnnnysss"
+bne *r6
+L9: inc *r6
+L10: jsr *r2
+L11: rts
+L12: dec L9
+stop
+L13: bne *r4
+L14: prn r1
+L15: stop
+sub r7, *r0
+L16: jmp L579
+
+L17: jmp *r1
+L18: red *r3
+L19: red *r6
+L20: cmp r2, #138
+lea L13, r1
+L21: cmp #67, *r2
+L22: rts
+L23: .string "aylnfssnzkjidgewmzozl"
+jmp *r0
+L24: dec L480
+sub L8, r6
+cmp #198, #-201
+L25: prn r6
+L26: inc L309
+L27: .string "yzscjmchsxw"
+L28: cmp #44, L22
+; comment
+L29: clr L464
+prn #-101
+L30: sub L12, *r7
+L31: rts
+add r4, r7
+L32: add #-207, L25
+L33: cmp #215, *r6
+bne *r4
+L34: rts
+L35: add *r7, r2
+L36: sub L28, *r1
+L37: jsr *r7
+L38: red L9
+L39: lea L318, *r1
+L40: not r7
+L41: cmp *r2, L0
+L42: dec *r3
+L43: red r6
+stop
+L44: sub #-182, *r4
+L45: red *r1
+L46: mov L28, r6
+L47: not r2
+L48: add *r0, r0
+clr *r0
+; comment
+L49: lea L507, *r2
+L50: jmp *r3
+L51: stop
+; comment
+not r2
+L52: mov *r7, r4
+L53: jsr *r0
+L54: sub r6, *r5
+L55: lea L12, L49
+cmp *r3, *r0
+bne L6
+prn #-195
+rts
+L56: jsr *r1
+stop
+L57: rts
+L58: sub *r1, r1
+L59: rts
+L60: sub *r2, r2
+
+lea L43, *r4
+L61: rts
+L62: .data -632, 661, -548
+inc L420
+L63: prn #36
+L64: .data 263, -216
+red L24
+add r2, r2
+stop
+L65: prn L338
+L66: .data 908, 632, -453, -330, -570, 72, 795, 381
+clr *r5
+L67: .data 772, 719, -43, -162, 860, 447, -821, -506
+L68: cmp L28, r2
+dec r3
+L69: stop
+jmp *r5
+L70: inc L62
+L71: .data 742, 116, 616, 492, 548
+clr r6
+red L429
+L72: not *r5
+L73: clr r7
+cmp L52, #-182
+L74: jsr *r3
+L75: cmp #-35, #249
+L76: .data 686, 57, -729, 130, -301, 168
+L77: stop
+jsr *r5
+L78: lea L295, L15
+L79: dec L233
+L80: lea L143, L27
+L81: stop
+L82: cmp r1, *r6
+L83: bne *r4
+mov r2, L493
+add #-44, r1
+jmp L400
+L84: red r3
+L85: dec L105
+sub *r7, *r0
+inc *r2
+L86: .data 915, -816, 931, 497
+; comment
+L87: jmp *r3
+L88: prn r0
+bne *r5
+L89: red r7
+stop
+cmp *r4, L13
+L90: lea L47, r0
+L91: jmp *r2
+L92: add *r6, L534
+rts
+L93: stop
+not L69
+L94: mov #124, r7
+L95: cmp r6, L23
+L96: jsr *r6
+L97: add r3, *r6
+L98: sub #-122, *r6
+L99: not *r2
+L100: rts
+clr r6
+inc *r4
+L101: not r3
+L102: jmp *r4
+L103: mov #73, *r7
+rts
+not r1
+lea L471, L353
+L104: .data -177, -220, 960, 193
+cmp #219, #-225
+stop
+L105: .string "bhhczaidoccqcyu"
+prn #50
+L106: lea L391, r7
+L107: jmp L56
+L108: dec r4
+L109: red L44
+L110: lea L38, *r1
+red r3
+L111: lea L504, *r3
+sub r6, r7
+jmp L93
+L112: add r1, r5
+L113: lea L391, L214
+L114: mov *r0, *r7
+L115: cmp L248, r7
+inc L456
+jmp *r4
+L116: jmp *r7
+L117: cmp *r2, *r3
+L118: .string "knoricng"
+lea L51, r5
+red *r1
+add r2, L12
+L119: bne *r7
+L120: red L15
+L121: add L435, *r2
+red L12
+not *r2
+red *r1
+L122: red L367
+inc r4
+L123: dec *r2
+L124: .string "aodazocodulc"
+L125: add #240, *r6
+mov L13, L120
+red L31
+L126: rts
+prn *r2
+L127: .data -488, -346, 282, -825, -674, 434
+inc r4
+L128: rts
+; comment
+lea L300, L70
+L129: jsr *r0
+add *r6, L600
+stop
+L130: .string "adrcqxglg"
+L131: prn L184
+L132: inc *r5
+L133: red *r3
+jmp L210
+L134: lea L103, L40
+add *r7, L75
+L135: .data -878, -915, 874
+L136: cmp L374, r5
+L137: cmp r6, L268
+mov #-212, L20
+not r0
+bne *r4
+not *r5
+L138: red L121
+L139: inc r7
+stop
+L140: cmp #220, *r5
+jsr L510
+jsr *r1
+L141: cmp *r5, L45
+sub #-147, *r7
+inc L9
+L142: inc r6
+L143: not L3
+L144: red L444
+L145: prn r0
+cmp r6, *r7
+add #5, r4
+dec r7
+lea L466, r5
+L146: mov #101, *r0
+jsr *r4
+L147: add r4, *r2
+L148: dec L137
+clr r6
+L149: .string "zqmwdexgnnerryiunbr"
+L150: .string "jvilwnnculzzztitlhojmblx"
+jsr *r1
+L151: lea L502, *r7
+L152: .data -916, -142, -456, 832
+L153: stop
+cmp r7, r5
+L154: lea L146, *r6
+add L171, *r3
+L155: stop
+add L360, L9
+L156: lea L128, r3
+; comment
+L157: add L169, *r7
+L158: cmp r3, L347
+L159: add r3, L553
+L160: add L457, *r7
+L161: inc *r5
+clr r3
+L162: add #-158, L489
+L163: cmp *r0, L318
+L164: lea L78, r1
+not L315
+L165: clr r6
+L166: red r6
+not L579
+L167: lea L44, L456
+sub r5, r4
+not r2
+dec *r2
+jsr L475
+dec L76
+L168: mov L327, L260
+L169: .data 110, -556
+L170: .data 655, 245, 115, 817, 992, -669, 791
+L171: stop
+L172: add #201, *r7
+L173: .string "iz"
+L174: sub #22, r2
+L175: .string "lizfkvaitjv"
+L176: .string "uguhyhioxttfka"
+L177: bne L549
+prn #205
+L178: sub #52, *r2
+mov #218, *r7
+L179: dec r0
+add #-195, L517
+L180: sub *r3, r5
+L181: .data 615
+jsr *r6
+bne *r5
+inc L460
+L182: inc *r6
+L183: cmp #-193, L109
+inc *r6
+add #151, *r0
+L184: cmp r4, r4
+stop
+inc *r0
+L185: .data 996, -896, -590, 418
+not *r7
+L186: stop
+bne L219
+cmp #238, r1
+L187: .string "tbldszlhczmiwnaufgaiypvt"
+dec r4
+L188: prn L89
+; comment
+L189: bne *r7
+L190: .data 32, -472, 31, 874, 979, -893, 522, 800
+L191: jmp *r1
+L192: jmp L9
+L193: rts
+L194: .string "zfepavgblnndk"
+L195: jsr L52
+L196: not r6
+L197: inc L267
+L198: jsr L321
+lea L121, L154
+rts
+L199: inc r2
+L200: sub #190, r6
+L201: stop
+mov *r7, *r4
+; comment
+L202: cmp r5, r7
+rts
+L203: rts
+L204: sub *r7, *r5
+L205: bne *r5
+
+jsr L259
+L206: dec L520
+L207: clr r4
+L208: add #56, *r4
+L209: mov L409, L510
+L210: jsr *r1
+L211: red *r7
+L212: inc r4
+L213: add r3, *r1
+inc r0
+not *r6
+jmp *r7
+red r2
+cmp #-234, r7
+L214: rts
+L215: stop
+L216: red L519
+L217: mov L247, r0
+dec *r1
+jsr *r6
+cmp *r0, #-135
+L218: lea L201, L101
+L219: sub *r4, L247
+dec *r0
+L220: red r1
+L221: inc *r7
+L222: inc r0
+mov r3, r0
+L223: rts
+L224: sub *r4, L273
+jmp *r5
+L225: jmp L208
+
+L226: lea L387, *r6
+L227: red L118
+L228: .string "jxxxxjcpkrlhymuprzqccc"
+mov r6, L354
+L229: stop
+L230: cmp L413, r5
+not r2
+rts
+
+not L102
+rts
+L231: .string "vb"
+L232: jmp *r7
+L233: dec L291
+prn *r6
+add *r4, L15
+dec r2
+L234: stop
+L235: .string "icrpcdgbjbqtnem"
+L236: stop
+prn r2
+L237: .string "njeges"
+add L139, *r2
+
+lea L529, *r0
+L238: rts
+L239: .string "ocfenibjqzcdlkiptlgge"
+L240: not *r0
+L241: dec r7
+L242: .data -608, -68, -414, -912, -9, 314
+L243: .string "lcg"
+L244: stop
+jsr L571
+cmp r1, r0
+L245: bne *r7
+L246: lea L67, *r4
+L247: red r7
+L248: prn r5
+not L569
+sub *r4, L564
+L249: sub #-189, L219
+L250: stop
+L251: stop
+stop
+inc L260
+lea L102, r6
+lea L112, *r7
+L252: jmp *r1
+L253: dec *r6
+rts
+L254: jmp *r5
+L255: bne *r6
+jmp L18
+prn L160
+L256: dec L29
+L257: rts
+L258: clr L287
+L259: add L161, L173
+L260: .string "dsgjlpz"
+L261: mov *r6, L107
+L262: bne *r6
+sub #-163, L227
+not L420
+clr L316
+L263: stop
+L264: jsr L270
+L265: lea L165, L407
+L266: .data 786, 590, 992, -437, -279
+L267: .data -797, 462, -668, 916, 633, -613, -489, -114
+L268: add *r4, r3
+bne L324
+L269: red *r5
+bne L78
+mov L584, r5
+L270: clr r1
+red r7
+L271: mov r7, L24
+L272: cmp #-228, #199
+jmp L515
+clr L359
+L273: sub r6, r3
+L274: clr *r2
+red *r3
+L275: .data -878, 366, -216, -809, -976, -861, -553, -159
+lea L454, *r7
+L276: bne L372
+L277: not *r4
+add L334, L430
+L278: jmp L330
+L279: not L288
+L280: sub #-48, L117
+L281: .data -19, -408, -468, 894, 189
+L282: sub L163, L120
+L283: jsr *r3
+L284: clr L234
+L285: prn #-253
+jmp L115
+L286: jmp L208
+red r6
+L287: inc L195
+L288: jsr *r6
+not L13
+bne *r7
+L289: prn *r1
+L290: not r6
+L291: sub *r5, *r2
+inc L347
+L292: bne L139
+L293: clr L401
+red L372
+stop
+L294: add L579, *r3
+L295: clr *r1
+L296: inc *r2
+L297: cmp *r6, L105
+prn L256
+red r7
+L298: .string "ffghbsws"
+L299: rts
+L300: red *r2
+L301: .data 495, -571, -447, 599
+L302: mov r4, r7
+L303: prn #73
+L304: not L471
+
+not r5
+L305: clr r1
+L306: .string "ktiuufmpm"
+bne *r1
+not *r4
+L307: .string "dnlhfnnnxeiaov"
+L308: jmp L389
+stop
+sub #-244, r0
+L309: stop
+jmp L419
+L310: add *r7, *r5
+prn #255
+bne *r6
+L311: clr *r3
+L312: dec L282
+mov L397, *r5
+clr *r1
+prn #-67
+L313: stop
+L314: cmp L146, L172
+sub L549, r6
+L315: add r4, *r7
+L316: lea L380, *r6
+; comment
+L317: bne L145
+L318: .data -534, 69, 82, -55, -532
+L319: cmp r6, r1
+L320: not *r1
+L321: inc r7
+L322: mov *r7, *r7
+jsr *r0
+L323: .string "lctxhvmjhqutnecuewcuz"
+stop
+prn L174
+L324: not r6
+jsr L354
+L325: clr *r6
+rts
+L326: stop
+bne L553
+L327: prn r7
+L328: not r5
+L329: .string "rcvgpyqrcbigu"
+L330: stop
+L331: .string "yqbjtyx"
+jsr L609
+L332: inc r2
+lea L610, *r5
+add #-181, *r3
+prn *r4
+L333: .data 702, 364
+L334: rts
+cmp #99, r4
+L335: bne L482
+L336: dec L128
+jmp *r1
+L337: .data 292, -202, -522, 645, 835, -322, -117, 424
+L338: bne L384
+mov r1, L300
+inc L31
+not r6
+L339: add L200, *r1
+L340: cmp #86, L19
+L341: .data -100, 923, -276, 205, -879, -944
+L342: .data 570, -459, -795, 625, 849, -641, -287, 162
+L343: mov #30, *r6
+jsr L416
+red L15
+inc L238
+L344: red *r3
+jsr *r2
+lea L519, r6
+L345: red L369
+; comment
+L346: cmp L482, r4
+L347: inc L6
+red r1
+; comment
+rts
+lea L6, *r7
+L348: cmp *r4, L332
+clr r5
+L349: mov r5, L234
+; comment
+add *r4, L189
+L350: .string "sb"
+L351: jmp L154
+L352: sub r2, L381
+L353: sub #179, r0
+L354: .data -903, 433, 472, 112, 317, 333
+
+L355: inc L258
+jmp *r4
+L356: bne L47
+jsr *r7
+L357: stop
+jsr L378
+L358: rts
+sub *r5, *r5
+L359: dec L170
+L360: .string "wcaumymnq"
+L361: add *r6, r0
+clr *r6
+inc L261
+add *r4, r0
+L362: mov #-171, L411
+L363: prn r7
+L364: stop
+L365: jsr *r6
+lea L11, L84
+L366: red r7
+; comment
+dec L516
+mov #107, L123
+lea L50, r0
+L367: red r4
+L368: dec r6
+L369: dec L210
+L370: cmp L404, #-206
+L371: jsr *r6
+jsr *r7
+L372: not r3
+bne L449
+L373: .string "uniexsjarls"
+L374: dec r6
+jsr L390
+
+L375: jsr L474
+clr *r5
+clr r2
+L376: mov #-189, *r0
+red L120
+L377: sub r2, *r3
+L378: inc r0
+L379: mov *r3, L336
+L380: lea L296, r7
+stop
+red r0
+L381: mov #-22, *r7
+red r3
+L382: not *r4
+L383: bne *r2
+L384: stop
+L385: bne L498
+prn r2
+L386: bne L164
+L387: rts
+L388: lea L436, L101
+L389: lea L417, r2
+bne *r5
+L390: rts
+L391: clr *r6
+L392: mov #-38, L504
+jsr L44
+L393: not *r4
+not L488
+bne L440
+L394: not L257
+; comment
+L395: lea L348, *r7
+L396: add #184, *r1
+L397: rts
+L398: lea L543, L536
+L399: red r3
+L400: inc r4
+L401: bne L562
+L402: bne *r5
+jmp L469
+bne *r2
+L403: jsr *r3
+L404: add L332, L426
+stop
+L405: bne *r0
+L406: stop
+L407: jsr L451
+L408: red L538
+L409: clr *r4
+cmp *r5, #-254
+L410: not L390
+L411: add *r5, r7
+L412: sub L440, L511
+L413: .data 502, -727, -128
+L414: stop
+L415: add #4, L336
+L416: mov L91, *r4
+L417: rts
+inc L612
+L418: lea L114, *r4
+; comment
+lea L34, *r7
+L419: not L532
+L420: jsr L541
+L421: prn #-59
+L422: sub *r6, *r6
+cmp L470, *r6
+L423: red L334
+L424: .data -267, -674, -214, -670, -26, 624, -405
+L425: add #103, r1
+L426: sub r6, r7
+L427: rts
+lea L41, *r3
+; comment
+L428: prn L128
+L429: red r7
+dec r1
+L430: .string "ix"
+not *r6
+not *r4
+L431: prn #175
+L432: .data 954, 577, 499, -792, -960, 844, -3
+L433: .data 208, 105
+L434: stop
+L435: mov #-50, *r2
+rts
+L436: .data 944, -870, -425, 389, 605, -259
+L437: lea L123, *r4
+add L215, L418
+L438: .string "s"
+L439: add #-60, r3
+L440: not r2
+rts
+L441: jmp *r2
+L442: jmp L225
+L443: rts
+; comment
+L444: mov r2, L399
+L445: .string "u"
+L446: dec r6
+bne L360
+rts
+L447: .data -305, 981, -518, 140
+clr L200
+L448: cmp r4, #-1
+lea L248, *r3
+L449: clr *r0
+L450: sub L580, L560
+L451: dec r7
+prn L141
+L452: .data 230, 433, -373, -449, -349
+jsr *r2
+L453: not L459
+dec L495
+L454: sub *r1, *r6
+L455: rts
+add r7, r0
+L456: cmp *r2, *r3
+L457: rts
+L458: rts
+prn #-127
+L459: prn *r1
+lea L595, r4
+L460: .string "bhlcxselkshxlcqfftu"
+L461: red *r5
+L462: cmp r3, L141
+L463: stop
+L464: cmp r1, r4
+L465: .string "ktb"
+L466: rts
+L467: jsr *r3
+L468: clr L584
+L469: rts
+L470: .data -204, -880, -690, 208, -550, 648, -685, -441
+stop
+L471: lea L241, r1
+L472: inc r6
+jmp L518
+stop
+L473: not *r3
+L474: lea L541, L96
+red r2
+lea L564, L517
+not *r7
+L475: mov r3, L172
+L476: clr L513
+L477: cmp L430, r3
+L478: inc L564
+L479: dec L229
+L480: cmp L435, *r3
+mov #-142, *r4
+L481: clr *r4
+bne L94
+sub *r4, L274
+L482: prn r3
+L483: jmp L5
+add L348, *r3
+L484: add #1, L400
+clr *r5
+lea L549, *r4
+L485: bne *r2
+inc *r5
+jmp *r4
+not r5
+jmp L563
+jsr L479
+jmp L195
+cmp r7, *r4
+L486: .string "ntcnjwxelrgrqwtcdtxl"
+; comment
+L487: bne *r3
+L488: rts
+L489: .data -776, 686, 435, 568, -351, -235
+L490: red r0
+L491: lea L98, *r3
+L492: cmp r6, #-95
+rts
+L493: inc L522
+L494: clr L64
+L495: prn *r7
+L496: .data 233, -299, 75, -872
+sub r0, L529
+lea L352, *r2
+clr *r5
+jmp *r2
+
+; comment
+red r3
+dec L576
+L497: inc r5
+lea L546, L521
+L498: add *r4, r1
+
+add r0, *r7
+L499: .string "unbkntxez"
+L500: cmp #-87, *r2
+L501: .data 630, 181, -668, 381, 907, 320, -297, 149
+inc L389
+L502: .string "uilvcsjaosfiwrp"
+not r3
+L503: red r5
+red L548
+clr *r3
+L504: cmp #-68, r4
+L505: .string "dptrew"
+inc *r3
+mov L565, L381
+L506: rts
+L507: not r6
+L508: clr *r2
+dec r7
+L509: add *r1, L317
+L510: clr r7
+prn r7
+L511: dec *r4
+red L194
+L512: cmp r5, *r1
+L513: .string "uxesegsh"
+red r5
+L514: .string "ljookrjsoibycbzyk"
+stop
+dec L535
+L515: .data -137, -921, 922, -727, 617, -484
+L516: lea L338, L519
+inc *r7
+L517: mov *r4, r3
+L518: .data -651, -438, 479, -786, -143, 197, 314
+L519: .data 389, -369, 14, 829, 730, 769
+inc *r4
+L520: jsr *r6
+L521: inc L491
+bne L467
+L522: stop
+L523: prn L589
+L524: mov r6, L266
+L525: rts
+
+L526: mov *r1, r0
+red r1
+sub L497, *r4
+L527: dec *r5
+L528: prn L508
+stop
+L529: .data -449, -722, -343, 973, -379, -688, -536
+mov L523, *r0
+L530: not L13
+L531: sub *r0, r4
+L532: jsr *r3
+L533: .string "eukohmvotcgdsvojlcz"
+add L560, L447
+L534: add r7, r0
+L535: .data 987, 945, 677, -473, 906
+L536: cmp *r5, #-155
+L537: red r7
+rts
+jmp L54
+L538: sub L592, L564
+L539: jsr L541
+sub *r1, r7
+
+L540: clr *r0
+bne *r2
+L541: .string "svca"
+L542: cmp L492, L474
+L543: rts
+inc L557
+L544: lea L567, L608
+clr L606
+L545: red L569
+L546: lea L460, r6
+L547: rts
+L548: .data 923
+L549: mov L605, L329
+L550: prn #-228
+prn r1
+dec L465
+L551: inc L561
+L552: cmp r4, #-144
+L553: .data 959, 854, 478
+L554: inc *r5
+L555: rts
+add L598, *r7
+not L609
+bne L571
+bne *r0
+L556: prn #-193
+add L564, r6
+lea L267, *r4
+L557: cmp L572, #159
+jmp L577
+L558: rts
+L559: .string "rvgkdnidarspjodjhptho"
+L560: not r3
+L561: rts
+L562: red *r6
+L563: .string "oiprwcaj"
+dec r3
+L564: dec L394
+L565: red r2
+L566: red r7
+L567: sub *r5, r1
+L568: .string "apr"
+add *r4, r1
+L569: stop
+L570: jmp *r6
+L571: cmp L612, #-85
+L572: cmp *r3, #-177
+cmp *r3, r1
+red *r1
+L573: red r5
+bne *r2
+L574: stop
+L575: .data -239, -457, 611, 909, 983, 908, 680, -834
+L576: red *r6
+L577: cmp L584, #-144
+L578: cmp L351, *r3
+add L591, r2
+inc L117
+mov #75, r2
+L579: .string "jvzvailazbrgckstqxqcfcz"
+L580: red L364
+L581: stop
+L582: cmp *r3, L584
+L583: rts
+dec *r5
+L584: cmp r4, r6
+L585: .data 984, 89, 977, 102, 110, 127
+L586: not r7
+L587: sub #133, *r6
+
+L588: inc r5
+L589: not L605
+L590: dec *r5
+jsr *r5
+L591: bne *r3
+dec r3
+; comment
+L592: prn L217
+L593: red L415
+L594: rts
+L595: rts
+rts
+L596: sub #26, *r6
+lea L325, r4
+L597: sub r2, *r5
+L598: mov r4, *r4
+L599: dec *r1
+L600: .string "fkzehkdeiqkfdvbaomenm"
+L601: .data -708, -141, -728, -43, 58, -703, -183, -21
+jmp L605
+L602: sub L300, *r5
+jsr L192
+L603: lea L607, *r0
+L604: inc *r4
+jmp L477
+L605: clr L194
+L606: red L218
+L607: not *r7
+mov r2, L609
+L608: add L611, *r4
+L609: clr *r0
+L610: cmp *r7, #-255
+stop
+add r6, r2
+L611: dec *r4
+L612: mov *r6, r2
+cmp #-41, *r3
+stop
@@ -0,0 +1,1041 @@
+; Generated by genCorpus --seed 11
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+clr L426
+add L234, *r6
+not *r7
+clr r4
+L0: jmp L0
+mov *r1, L0
+L1: not L433
+L2: clr L133
+sub #-173, L223
+stop
+L3: prn r4
+; comment
+not *r7
+jsr *r4
+L4: jmp *r7
+prn #-221
+L5: not L4
+rts
+L6: clr r4
+L7: cmp r1, L1
+L8: .string "owxuxrmawixrideakq"
+L9: lea L8, *r4
+L10: .string "rcgsjqhfcdljxvmwzys"
+mov L1, *r3
+L11: bne *r0
+L12: inc *r7
+L13: jmp *r7
+L14: prn L7
+L15: .string "svwztmqj"
+L16: .data -666, 216
+L17: cmp #-244, #151
+mov r5, L38
+L18: red L10
+; comment
+add *r6, *r4
+L19: .data 925, -80, -534
+L20: jsr *r2
+L21: .data 839, -172
+L22: sub #-151, L18
+clr L445
+L23: jmp *r2
+L24: add *r4, r3
+L25: rts
+L26: not *r2
+bne L332
+L27: stop
+prn r7
+L28: prn L323
+lea L4, r2
+inc r3
+L29: lea L11, r4
+L30: add L3, r0
+L31: rts
+prn *r4
+not *r3
+L32: dec *r3
+L33: sub *r5, *r6
+jsr L172
+not *r5
+L34: bne *r0
+red *r7
+
+L35: jmp *r2
+L36: .data -777, -868
+L37: bne *r7
+L38: prn *r7
+
+lea L600, L333
+L39: not r1
+red L5
+L40: dec *r0
+L41: lea L453, r5
+L42: mov *r1, *r2
+L43: .string "rqxgcuilebfccgnvyic"
+L44: red r5
+L45: .data -426, 948, 574
+jsr *r4
+jsr *r3
+jsr *r2
+add #212, *r2
+jmp L598
+; comment
+L46: .string "d"
+L47: jmp L192
+L48: inc *r1
+
+L49: lea L289, L38
+L50: lea L333, L49
+L51: lea L129, r5
+L52: .data -539, 382, 664, 293
+L53: inc L590
+L54: mov L10, L573
+stop
+L55: red L18
+L56: rts
+L57: clr r5
+L58: inc L27
+jsr *r7
+L59: .data -470, 388, 526, -302, 91, -873, 699, -512
+
+L60: stop
+L61: jsr L58
+L62: bne *r3
+L63: not L26
+sub r1, *r3
+rts
+inc *r3
+L64: red r2
+clr *r0
+clr L505
+L65: not L267
+L66: jsr L62
+L67: .string "aobokejhudstpytlo"
+L68: inc r6
+L69: bne L29
+prn #220
+L70: dec *r1
+bne L58
+bne L60
+L71: rts
+cmp *r0, L253
+L72: .data -502, -174, -471, 44, -683, -971, 573
+L73: lea L418, r6
+bne *r4
+clr L394
+L74: dec r2
+L75: rts
+L76: .string "goyplvjvdpcwxtkzfbrnnd"
+jsr L459
+L77: .string "bzhpuwrwlxvwfjgdvypoqsba"
+L78: cmp r4, r5
+
+L79: clr *r3
+L80: .data 782
+dec *r0
+stop
+mov *r3, *r5
+L81: sub #83, L328
+not r2
+; comment
+stop
+L82: dec L358
+L83: mov *r6, *r2
+L84: rts
+L85: jsr L395
+L86: stop
+L87: inc r5
+stop
+L88: jsr *r0
+L89: lea L279, L513
+L90: cmp *r6, *r7
+sub #-170, r6
+not *r0
+L91: rts
+L92: rts
+L93: jsr *r7
+L94: rts
+lea L37, r7
+L95: .data -891, -156, -427, -646, -58, -363, -322
+L96: .string "rycvet"
+bne L462
+L97: rts
+not r7
+L98: prn *r2
+L99: cmp r3, *r0
+L100: lea L532, r6
+L101: .data 77
+L102: .string "c"
+L103: mov L613, L19
+prn #125
+sub *r1, *r4
+red L51
+L104: .string "hipbarvvh"
+add r4, *r3
+L105: jmp *r3
+mov L79, r0
+mov r5, L267
+L106: rts
+L107: bne L467
+L108: jsr *r0
+bne *r5
+cmp r1, *r7
+L109: .data 798, 65, 576, 628
+L110: mov r7, L74
+L111: bne *r6
+L112: prn r6
+stop
+rts
+L113: jmp L60
+L114: lea L397, *r2
+mov #152, L300
+L115: stop
+L116: rts
+L117: sub *r2, L21
+; comment
+L118: jmp L545
+L119: clr *r6
+L120: sub r1, L347
+L121: not r3
+stop
+L122: inc *r4
+inc r4
+L123: dec r7
+rts
+
+L124: not r4
+L125: lea L590, *r2
+L126: inc L25
+L127: rts
+L128: add L424, r2
+; comment
+L129: rts
+L130: stop
+L131: lea L69, *r2
+L132: not *r5
+bne *r0
+L133: stop
+red *r0
+rts
+L134: .string "iiiqweyublekwv"
+bne L120
+prn #-45
+inc r5
+bne L245
+L135: .string "olnuydalon"
+L136: inc r4
+L137: not L548
+L138: .data -909, -161
+L139: sub *r7, r0
+L140: jsr *r5
+L141: dec r0
+inc L78
+L142: prn r5
+bne *r0
+L143: jsr L359
+mov r2, *r4
+
+L144: prn L27
+inc r0
+L145: jmp L83
+L146: sub #117, L184
+L147: .data 921
+L148: cmp *r5, *r1
+cmp #-132, *r0
+L149: .data -631, 800, 564, -443, 527, 991, 987
+jmp L588
+L150: .data 458, 973, 24, -95, 577, -245, 316, 645
+not *r4
+L151: lea L354, *r1
+L152: .string "cqxlq"
+jmp *r2
+L153: red *r4
+L154: clr r7
+L155: .string "obqc"
+L156: stop
+cmp r0, #2
+red r3
+L157: lea L116, *r3
+mov r4, r5
+L158: not L509
+L159: .string "qqj"
+prn #-220
+L160: .string "zirzupdtcwtygewtycbx"
+L161: jsr L126
+mov *r2, r2
+L162: rts
+L163: .string "alkikorkxhkjijdpwwvume"
+inc *r6
+L164: clr L109
+L165: jmp L55
+prn r7
+L166: rts
+rts
+L167: mov *r2, *r4
+L168: jsr *r2
+prn r5
+L169: dec L20
+L170: cmp *r5, r5
+L171: lea L12, r4
+L172: mov r5, L158
+stop
+L173: clr L457
+stop
+L174: cmp *r3, #255
+stop
+clr r0
+L175: jmp L148
+mov #-20, L504
+L176: red L515
+L177: lea L181, L72
+dec r4
+L178: not L168
+cmp L500, *r6
+L179: mov L24, r7
+L180: bne L156
+L181: sub L583, *r0
+jmp *r1
+L182: stop
+clr L432
+prn *r4
+mov L384, *r3
+L183: not L88
+jmp *r5
+jmp *r3
+L184: not *r3
+stop
+L185: .data -467
+L186: lea L595, r5
+jmp L219
+L187: .string "ukatvkxhbtrvzndcwcg"
+dec r0
+L188: .string "sk"
+add #-210, *r7
+L189: inc L102
+cmp r0, L93
+L190: not L35
+L191: mov r4, r6
+L192: rts
+L193: inc L56
+L194: not r3
+red *r0
+sub *r5, L402
+L195: inc *r7
+L196: not r6
+L197: lea L147, L108
+L198: rts
+L199: .data -306, -792, -715, 790, 793, -832, 547
+inc *r1
+L200: jmp *r3
+stop
+L201: dec r5
+L202: stop
+cmp L380, L336
+jsr L88
+L203: lea L98, r0
+L204: lea L548, *r0
+L205: inc L302
+L206: inc *r0
+L207: jmp L517
+; comment
+L208: inc r0
+; comment
+L209: bne L535
+L210: bne L80
+clr L348
+L211: rts
+
+L212: jmp *r5
+L213: .string "gywvz"
+bne L247
+cmp #-96, r7
+L214: not *r1
+inc L55
+red L40
+L215: .data 744, -324, -363, -911, 982, 335, -852, -636
+L216: dec L548
+not *r1
+L217: rts
+L218: bne L206
+L219: .data -840, -197, 547
+L220: add *r1, *r4
+L221: red *r2
+L222: mov r6, *r1
+
+L223: lea L446, L303
+red *r3
+lea L33, L348
+L224: .string "klugcv"
+L225: .string "q"
+prn L613
+
+jsr L508
+dec L206
+L226: .string "iduvvmqm"
+L227: sub r7, r4
+add r3, L343
+L228: dec *r0
+L229: add L446, L235
+L230: mov L184, r0
+L231: mov L32, L406
+red *r7
+L232: mov L67, *r7
+L233: .data 347, 834
+red r2
+L234: red r3
+inc r5
+L235: red L112
+L236: prn *r4
+rts
+L237: clr L104
+L238: add r1, L10
+red L215
+L239: clr *r7
+L240: prn #-255
+L241: not L142
+L242: inc L353
+L243: dec r4
+L244: lea L365, *r6
+cmp L229, L317
+; comment
+L245: prn *r0
+L246: prn r2
+L247: inc L235
+
+jmp *r1
+jmp *r0
+L248: inc *r4
+L249: clr L413
+jsr L161
+L250: lea L277, r0
+L251: bne *r1
+L252: jsr *r7
+lea L412, L265
+L253: not r2
+L254: lea L321, L546
+L255: sub r7, r6
+L256: inc r1
+clr *r4
+L257: sub r0, L226
+dec *r1
+L258: sub *r7, r4
+L259: jmp *r0
+L260: .data -1000, -575, 504, 870
+lea L457, *r6
+L261: .string "yklleqfi"
+inc r7
+jmp *r3
+L262: stop
+red L232
+L263: clr *r7
+L264: rts
+L265: jmp L265
+add *r5, r2
+L266: mov L168, r2
+L267: stop
+rts
+add L452, r7
+L268: clr r4
+L269: clr r3
+L270: cmp r0, *r2
+clr L101
+L271: dec L330
+L272: .data -548, -582, 517, 152, 416, 968, -52
+inc *r4
+L273: prn *r1
+L274: prn r4
+L275: cmp r2, r2
+L276: .string "yorackgcmqglf"
+L277: .data -467, -456, 79, -898, 459, -326
+L278: mov *r1, r2
+add #-99, L222
+bne L10
+jsr L597
+L279: .string "dmiugtnkdglpubixrczqm"
+lea L278, r2
+mov L75, r4
+L280: cmp *r0, r4
+sub r7, r3
+L281: .data -64, 146, 263, -937, 149, 81
+L282: inc L69
+L283: lea L170, r3
+L284: jmp *r7
+L285: lea L25, r5
+clr r7
+L286: .string "iykwhkljsshxnxzfezqktron"
+cmp L37, #149
+L287: dec L145
+L288: clr L383
+L289: clr r4
+L290: jsr L548
+L291: red *r1
+L292: inc r7
+L293: cmp L205, *r3
+red r0
+L294: inc L484
+L295: mov #108, r6
+not L352
+L296: .data -328, 273, -743
+bne *r4
+jmp *r4
+jsr *r5
+not L244
+L297: lea L318, *r2
+
+L298: bne L116
+; comment
+L299: dec r0
+red *r2
+L300: sub *r5, *r6
+L301: prn *r6
+L302: inc r4
+clr r5
+prn *r0
+L303: inc r2
+L304: dec L71
+L305: jsr *r6
+L306: sub #-63, r7
+L307: inc r2
+L308: .string "emnalyluwp"
+jmp *r5
+dec L226
+L309: sub L27, L543
+prn *r5
+L310: prn #184
+cmp #-217, #85
+L311: bne L129
+L312: cmp *r6, *r2
+bne L124
+L313: bne *r3
+L314: lea L410, L74
+L315: red r6
+add r5, *r0
+L316: cmp #129, *r7
+L317: red *r4
+mov r2, r7
+add L393, *r2
+jmp *r7
+inc *r2
+L318: .string "omzqrtedcvzg"
+L319: bne *r5
+L320: prn r2
+L321: sub L24, L607
+stop
+L322: rts
+L323: red r3
+L324: prn L515
+L325: .data -195, -159, -118, -382
+inc *r7
+
+prn r5
+L326: cmp #-184, *r3
+prn #-56
+prn #137
+L327: mov r5, r0
+L328: lea L127, *r5
+rts
+L329: jmp L384
+L330: inc *r0
+; comment
+L331: dec *r0
+L332: jmp L501
+sub *r7, r4
+; comment
+prn #214
+rts
+L333: jsr L336
+L334: .data 322, -392, -679, 366, -483, -325, 792, 573
+clr *r4
+L335: red *r4
+bne *r6
+; comment
+L336: .string "nverbpw"
+bne *r1
+L337: stop
+L338: clr r2
+L339: red *r1
+L340: add *r3, r2
+dec *r4
+L341: dec *r6
+prn *r4
+L342: sub L475, r5
+L343: .string "onboqiseadzqnyfjsmqcyfm"
+L344: mov #-197, r4
+L345: lea L199, *r0
+lea L477, r5
+L346: .string "icncbhqwtimxlqymc"
+L347: not *r2
+not *r5
+L348: cmp L278, L329
+L349: prn r0
+L350: clr L586
+L351: prn *r7
+inc *r2
+L352: stop
+add *r3, L417
+mov r4, L171
+L353: not *r3
+L354: cmp #-112, r2
+bne *r5
+
+not r4
+L355: inc *r2
+L356: .string "zbbncchtpbsnt"
+clr r4
+stop
+L357: sub L520, L407
+inc r7
+L358: lea L294, L154
+L359: bne *r5
+bne *r3
+L360: .data 72, 643, 12, 168
+L361: sub r6, *r6
+inc *r6
+L362: red L602
+dec r5
+L363: red L240
+L364: add r2, *r5
+L365: red *r5
+red L458
+L366: cmp L529, L364
+L367: sub L132, r2
+L368: jmp *r0
+L369: dec L503
+sub *r4, *r0
+dec *r3
+L370: rts
+L371: cmp L201, L437
+L372: add r4, L263
+L373: dec L408
+L374: add r6, L312
+L375: jsr L249
+L376: red r3
+L377: inc r1
+L378: cmp #-77, r1
+L379: not r0
+L380: .string "t"
+L381: stop
+L382: rts
+L383: add L345, r0
+L384: not *r2
+L385: stop
+; comment
+clr r0
+L386: inc L165
+red r3
+stop
+L387: jmp L426
+L388: bne L155
+L389: bne L590
+jmp *r0
+L390: jsr L526
+L391: not L361
+L392: add #58, *r4
+
+mov #-210, r4
+L393: not r2
+mov L601, L523
+L394: add *r5, L108
+red r4
+L395: mov r4, *r3
+L396: mov #166, L167
+L397: not L495
+L398: red L459
+L399: bne *r7
+L400: .string "fulhdmmj"
+inc L361
+L401: rts
+jmp L225
+prn r4
+inc L587
+dec r3
+L402: dec L419
+L403: not *r6
+L404: .string "akmqenyabbjhphbnhugy"
+not r0
+L405: lea L212, *r0
+jmp *r4
+L406: inc *r1
+L407: mov L608, L493
+L408: not *r4
+L409: dec *r3
+L410: add L441, r7
+L411: prn r6
+L412: jmp L499
+L413: jsr *r0
+L414: .data 963, 270, 873, -877, 48
+inc L247
+red *r7
+L415: add L454, *r4
+L416: .data 913, 493, -581
+L417: inc r5
+lea L459, L35
+L418: lea L512, r0
+L419: stop
+L420: .data -80, -242, 755
+
+L421: not L484
+; comment
+L422: .data 940
+jmp L148
+L423: not *r0
+L424: .string "btbtoixzfctiulj"
+red r7
+jmp L436
+L425: .string "wzxbvoovmxcoteei"
+L426: bne L445
+L427: cmp L67, #249
+L428: lea L309, L493
+L429: clr r4
+L430: sub L454, L566
+L431: bne *r6
+L432: not *r4
+L433: inc *r1
+L434: .string "tkkjds"
+L435: dec r5
+L436: inc r3
+L437: jmp *r1
+L438: jmp *r7
+L439: .string "wiawhjfijelotpwna"
+
+cmp L300, r5
+stop
+inc *r2
+not r5
+L440: dec *r3
+
+L441: rts
+L442: jsr *r7
+stop
+L443: lea L527, L182
+L444: inc *r2
+; comment
+not *r3
+dec L612
+L445: cmp *r3, #138
+L446: mov r1, L506
+L447: mov r6, *r1
+cmp L579, r3
+L448: sub *r1, *r7
+L449: prn *r3
+rts
+
+L450: sub r0, r0
+L451: clr L611
+add r2, L351
+L452: .string "anfqmdxksqwnejivudiintiz"
+lea L305, r5
+L453: .data -599, -508, -838, -184, -28, -586, 793, 753
+L454: not r7
+L455: rts
+; comment
+L456: .string "lhktwnjqdfvgetzaxojkr"
+sub #201, *r6
+
+L457: inc r7
+; comment
+L458: stop
+L459: inc *r3
+L460: inc *r7
+not L135
+L461: jmp *r2
+dec L311
+L462: add *r7, L414
+L463: red *r5
+L464: jsr *r3
+red L347
+L465: not r4
+L466: inc *r5
+
+L467: red r0
+L468: cmp #29, *r2
+red L218
+stop
+L469: jmp L561
+L470: clr *r2
+L471: add #248, *r3
+L472: sub #-124, L453
+L473: not *r0
+L474: jmp *r2
+L475: stop
+L476: stop
+; comment
+L477: rts
+mov L132, L488
+L478: not r0
+
+L479: dec *r7
+L480: prn r0
+L481: inc *r1
+L482: .string "cfuoe"
+jsr *r2
+clr *r6
+L483: .string "ricdfrmjcmdhcc"
+lea L371, L40
+L484: jsr *r0
+dec L463
+add r4, r4
+jmp *r3
+sub r3, L515
+L485: clr r7
+L486: clr r1
+
+jsr L608
+prn r1
+L487: clr L158
+lea L594, r5
+L488: mov r5, L590
+L489: jmp *r1
+sub r4, L476
+jsr L546
+
+prn #-74
+L490: .data -658, -462, -861, -970, 812, 752, -194, -418
+cmp r4, #-62
+L491: dec r2
+L492: prn *r2
+; comment
+clr L584
+jsr *r3
+sub L572, L543
+L493: stop
+inc L509
+L494: stop
+L495: .data 687, -221, 796, -31
+add *r7, *r4
+L496: red *r7
+jmp *r0
+
+L497: rts
+not *r1
+L498: cmp #-237, r7
+lea L569, L600
+L499: prn #-125
+add *r2, L259
+stop
+L500: rts
+L501: add L247, *r1
+L502: prn *r4
+L503: prn #-106
+stop
+L504: stop
+rts
+L505: .string "e"
+add L429, *r2
+L506: .data -291, 64, -75, 943, 588
+L507: jsr L432
+L508: cmp r3, r6
+
+; comment
+L509: bne L323
+L510: cmp L603, L477
+L511: add #21, *r0
+L512: inc *r2
+cmp #171, r2
+inc L267
+L513: mov *r6, r5
+L514: .data 942, -624, -452, -963, 269
+stop
+jsr L582
+L515: bne *r2
+
+L516: clr r0
+cmp L124, r1
+L517: stop
+L518: clr r1
+jmp *r0
+add *r3, r4
+L519: prn L511
+L520: sub *r2, *r1
+cmp r6, r3
+L521: jmp L604
+L522: dec *r3
+jsr *r4
+L523: cmp #0, #23
+inc L531
+L524: dec *r3
+L525: .string "qz"
+
+L526: dec r6
+L527: mov #-221, *r2
+L528: .string "jvl"
+L529: not L464
+L530: .string "ehfy"
+stop
+stop
+L531: mov *r5, r7
+mov #-63, *r4
+L532: sub L595, *r0
+L533: .data -860, -242, 263, -810, 798, -141
+sub *r4, *r4
+L534: .string "e"
+add r1, r3
+L535: dec L561
+L536: sub r5, r6
+not *r1
+L537: .data -683, -459, 134, 533
+L538: stop
+L539: red L595
+L540: sub *r0, L605
+L541: stop
+L542: dec r1
+L543: jmp L574
+L544: inc *r2
+L545: dec L552
+L546: clr r2
+L547: stop
+rts
+rts
+L548: rts
+L549: jmp L335
+L550: bne *r2
+L551: stop
+L552: jsr L65
+L553: prn r5
+L554: lea L486, *r0
+L555: mov L538, L590
+L556: clr L563
+L557: .data 954, -699, -105, -949, -579, -162
+lea L599, *r1
+dec *r1
+L558: stop
+L559: .string "r"
+L560: jmp *r3
+L561: mov *r2, L524
+dec L390
+L562: .string "ffy"
+L563: cmp *r1, L613
+not L591
+cmp L603, *r7
+L564: add r2, r7
+clr r6
+; comment
+L565: jmp L11
+stop
+L566: not *r0
+
+L567: red L358
+add r6, *r0
+dec r4
+not *r3
+; comment
+prn #63
+L568: .string "ivsvlyvfgeiknnsoowqf"
+not *r7
+L569: clr r7
+jsr L592
+L570: jsr *r7
+L571: jmp L603
+L572: inc L576
+add L481, r4
+add *r3, L528
+clr r2
+
+L573: not r2
+prn L599
+L574: prn r2
+L575: bne L393
+L576: .string "etszxyb"
+L577: jmp L582
+not L578
+L578: inc *r2
+L579: prn #-178
+
+lea L293, L611
+L580: rts
+inc r1
+L581: inc L368
+L582: add *r3, r7
+L583: .string "izbcsacjgvigfcuszgezxyof"
+L584: prn #-184
+jmp L606
+L585: prn r7
+L586: inc L598
+
+L587: clr *r2
+L588: bne *r5
+jmp L593
+L589: .string "aunm"
+L590: red *r0
+stop
+L591: not L284
+L592: dec *r2
+stop
+L593: inc L605
+L594: cmp L472, L415
+L595: bne L520
+L596: prn *r5
+stop
+L597: .string "zfvixmugsilzier"
+L598: jsr L609
+stop
+stop
+stop
+L599: mov *r5, r0
+jmp *r7
+not *r7
+L600: lea L445, L606
+L601: cmp r0, *r4
+
+L602: jmp L609
+dec L103
+L603: stop
+L604: bne *r4
+bne L606
+L605: lea L369, r4
+L606: .string "iuccrwqqyjkamtx"
+mov L84, L608
+stop
+stop
+jsr L473
+L607: lea L608, L565
+L608: cmp #-18, *r6
+bne L456
+L609: stop
+L610: prn L612
+L611: rts
+jsr L386
+L612: rts
+; comment
+L613: red L348
+stop
@@ -0,0 +1,1041 @@
+; Generated by genCorpus --seed 12
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+L0: jmp *r6
+L1: bne L0
+L2: prn #132
+L3: add *r0, L2
+L4: clr *r7
+L5: mov #117, *r1
+red L2
+clr *r3
+L6: .data -764, -500, 679, 918, -126, -367, 711, 704
+rts
+
+L7: mov r4, L515
+prn #248
+L8: mov #85, *r2
+L9: red *r0
+L10: rts
+cmp *r1, *r4
+add #106, r5
+cmp L141, r5
+mov #-254, *r3
+L11: mov *r5, L11
+L12: .string "ehnycdsncueqerbhldcyv"
+L13: lea L0, L544
+L14: jmp *r4
+add *r4, r6
+L15: cmp r2, #161
+stop
+; comment
+dec *r2
+clr *r6
+prn L139
+L16: .string "flwohuwbx"
+; comment
+L17: sub L14, L6
+L18: lea L18, r6
+prn r6
+L19: stop
+L20: prn #-16
+L21: jsr *r3
+L22: .string "agyifdkmfxcwbnzfn"
+L23: stop
+clr *r4
+L24: .data 250, -170, -454, 438, 910, 797
+L25: cmp *r3, r2
+mov L11, r4
+mov r2, r5
+sub *r6, r1
+L26: bne L8
+not r6
+; comment
+L27: bne L0
+
+jmp *r7
+L28: jsr L22
+L29: jsr L23
+L30: add #-24, *r4
+L31: add r2, *r5
+L32: not r6
+L33: .string "yqnfkadgfkhfxswdbzsnu"
+L34: not L10
+L35: jsr L370
+L36: sub L15, L34
+L37: mov #-242, r3
+L38: jmp L43
+stop
+stop
+jsr L457
+L39: prn r4
+red r2
+L40: cmp #249, r4
+add #38, L18
+L41: cmp L8, *r6
+; comment
+rts
+L42: dec L38
+L43: cmp *r1, *r0
+L44: prn r0
+L45: lea L290, *r2
+L46: rts
+L47: stop
+not *r7
+L48: red L4
+stop
+L49: prn *r4
+bne L101
+L50: lea L10, r0
+L51: clr r1
+prn *r1
+jsr *r6
+prn L39
+rts
+not L28
+L52: .string "rylfgqacscekekqzps"
+L53: red L3
+L54: mov *r4, *r1
+stop
+L55: cmp *r6, r4
+L56: add r5, L555
+L57: jsr *r3
+L58: rts
+L59: jmp *r4
+L60: mov #-117, r1
+L61: clr r6
+L62: clr r4
+add *r4, r2
+L63: lea L225, r2
+mov *r5, *r4
+L64: cmp #-156, L61
+L65: rts
+L66: jsr *r4
+
+jsr *r7
+L67: stop
+L68: .data -979, 509
+L69: jmp L369
+; comment
+clr r1
+L70: .data -964, -850, 63, 215, 309, -664
+bne L111
+rts
+L71: sub #114, L317
+jsr *r6
+L72: jmp *r6
+L73: jmp *r4
+mov #-20, r2
+; comment
+L74: cmp #-228, r3
+L75: sub #163, r6
+not r7
+L76: not L80
+clr r6
+L77: .data -991, 344
+L78: .string "paedsjpjrnagxhngnwstjv"
+L79: inc r1
+prn r2
+L80: stop
+jmp L426
+L81: bne *r0
+L82: bne L62
+L83: jmp L27
+L84: sub #-11, *r5
+L85: cmp r1, #236
+L86: inc L22
+stop
+L87: red r1
+lea L10, *r5
+cmp #-88, L446
+L88: dec *r2
+L89: jsr *r7
+L90: sub #-13, L368
+inc L84
+L91: bne L79
+; comment
+; comment
+rts
+
+L92: .data 568
+bne L375
+L93: add *r3, L28
+L94: bne *r3
+L95: cmp *r1, L612
+L96: jmp L116
+L97: add *r6, L221
+not *r3
+L98: sub #232, *r0
+L99: red L37
+cmp #-251, *r4
+L100: cmp *r0, L18
+L101: .string "ocmndgnbdxtfmiwskqv"
+L102: add r4, *r3
+
+L103: not L206
+L104: add *r1, *r1
+L105: jsr *r4
+L106: inc L69
+inc L24
+; comment
+L107: .data 392, 713, -187, -470, -687, -354, 519
+L108: .string "frlszyjfqwmldgaxolljtvsz"
+L109: lea L280, *r5
+L110: inc r4
+jsr *r6
+L111: jmp L465
+prn #-85
+bne L48
+L112: stop
+
+L113: not r0
+
+L114: clr r2
+L115: .data 23, 808, 972
+mov L424, *r0
+L116: .string "xgxnqlorfae"
+L117: prn *r1
+L118: lea L300, r1
+bne *r6
+L119: .data 979, 833
+L120: .string "ynlwjujcskwpkxsktlxplq"
+L121: stop
+L122: jsr L46
+L123: jmp L57
+L124: .string "ucdusrvzbjnebz"
+L125: .data -319, -790, 110, -733, -534, 69, 435, 327
+L126: sub r7, *r1
+L127: .data 759, 208, 239, -901
+L128: prn *r2
+sub *r6, *r5
+L129: red L16
+L130: mov L519, L100
+jsr *r2
+L131: .data -478, -975, -97, -575, -909, 482, 332
+rts
+L132: bne L361
+L133: prn #134
+L134: .data -575
+L135: stop
+jmp *r0
+L136: add L490, *r1
+L137: cmp *r0, #-149
+L138: bne *r6
+L139: sub #191, r6
+inc L539
+L140: sub L11, *r7
+L141: jmp L160
+L142: bne *r5
+not L17
+L143: add *r1, *r7
+inc L329
+L144: bne *r6
+L145: rts
+lea L77, L267
+not L43
+L146: jmp L565
+stop
+
+L147: dec *r2
+L148: cmp #-165, L471
+L149: inc L121
+L150: jmp *r1
+L151: rts
+
+bne L266
+L152: add *r3, *r7
+
+L153: prn #101
+L154: cmp *r5, #-214
+L155: not r1
+L156: jsr L116
+stop
+L157: lea L340, *r3
+stop
+L158: jmp *r5
+L159: cmp #21, r7
+inc *r3
+red L13
+
+cmp *r3, *r0
+jmp L389
+L160: dec r3
+stop
+mov #189, *r3
+L161: bne L391
+L162: rts
+L163: jsr L503
+bne L476
+L164: prn r7
+L165: .data -45, -881
+L166: .string "iz"
+inc L26
+
+L167: add L206, r3
+L168: inc r4
+not L194
+L169: .string "ddbwpunjkpiko"
+rts
+L170: jmp L352
+L171: sub L277, r7
+L172: lea L21, *r1
+L173: stop
+L174: clr L17
+L175: jsr *r7
+sub *r2, *r2
+L176: lea L554, r1
+L177: add *r1, L63
+L178: sub r7, *r3
+L179: lea L91, *r7
+not *r3
+red *r4
+L180: clr *r7
+; comment
+add #-67, *r7
+L181: lea L47, *r4
+L182: inc *r0
+clr *r7
+L183: not L202
+L184: .string "xnsfcg"
+dec r6
+jmp *r0
+L185: lea L128, L355
+cmp r5, *r7
+L186: bne *r0
+L187: clr r7
+L188: sub #58, r3
+stop
+L189: dec *r3
+L190: .string "nraiikcuwvjr"
+L191: sub *r3, r1
+L192: sub #160, *r0
+L193: .data -843
+L194: rts
+L195: .data 342, 610, 944, 504, -708, 122, 568
+L196: red *r0
+lea L123, r4
+; comment
+; comment
+bne *r4
+sub *r3, *r7
+L197: cmp L49, L586
+L198: .string "vjllmp"
+L199: clr *r4
+inc *r3
+stop
+L200: not r6
+L201: add #-213, L301
+
+inc L234
+sub r2, *r3
+bne *r7
+L202: inc *r3
+L203: cmp r7, L401
+L204: .data -583, -402
+clr L69
+lea L29, r6
+L205: jsr L38
+L206: .string "p"
+L207: dec r6
+L208: stop
+dec *r1
+add #-214, *r5
+L209: .data 544, 693, -321
+jmp L110
+L210: cmp *r0, L604
+L211: jsr L256
+L212: cmp L368, #-76
+clr L134
+L213: jsr *r0
+jsr L167
+sub #-114, r4
+L214: .string "am"
+mov *r6, L183
+L215: clr *r6
+inc *r4
+L216: .string "mzcqjnzmxfxfsi"
+L217: .data 145, -49, -610, 319, 422, 16, -658
+L218: .data 854, -433, 394
+L219: inc L56
+L220: not *r0
+L221: sub #57, r7
+L222: cmp #-14, #197
+L223: .data 83, -971, -64, -866
+add #-144, *r1
+clr *r6
+
+L224: clr r4
+bne *r5
+L225: inc r6
+rts
+L226: red L299
+L227: cmp *r7, *r4
+L228: cmp L315, *r4
+L229: add #-243, r7
+L230: jsr *r7
+not r7
+clr *r5
+L231: red r2
+L232: not L84
+L233: rts
+add #6, r0
+mov #180, r1
+L234: jsr L106
+L235: mov r0, r5
+
+L236: inc *r4
+L237: mov L19, *r1
+L238: clr r2
+L239: sub r2, L481
+lea L599, r6
+dec r3
+clr *r3
+L240: sub r6, *r7
+sub r4, *r7
+L241: jmp L615
+L242: clr *r1
+L243: prn r6
+L244: rts
+inc *r2
+dec L413
+L245: mov #-242, *r7
+L246: .data 291, 585
+rts
+dec L135
+clr *r1
+L247: lea L9, L131
+L248: jmp L615
+L249: jsr *r3
+rts
+L250: .string "lysnneejhwkpse"
+L251: .data -311, -665, -993, -81, -682
+jmp *r5
+not *r0
+L252: .data -996, -669, -875, 188, 20, -874, -476, 353
+not r4
+L253: stop
+L254: rts
+L255: dec r2
+L256: sub *r7, r5
+L257: sub *r0, L484
+L258: clr L560
+rts
+dec L378
+L259: .string "yxahciypgcgsoqgm"
+L260: .string "joannufq"
+
+bne *r3
+L261: add *r1, L54
+L262: .string "lnvzsffpbk"
+L263: clr r0
+cmp L464, #-61
+L264: .string "bbfiu"
+L265: dec r6
+L266: jmp *r5
+L267: rts
+L268: dec *r7
+L269: bne *r0
+L270: inc L173
+L271: add r3, L209
+clr r0
+jmp *r3
+
+prn r3
+L272: inc L599
+L273: jsr L410
+L274: prn *r4
+L275: jsr L3
+prn *r4
+prn #-166
+L276: add L215, r4
+L277: sub *r6, r2
+L278: dec r1
+
+sub *r0, L468
+rts
+lea L519, *r0
+L279: .string "lsbojzlogo"
+L280: .string "lfhtvlsyecyu"
+L281: rts
+L282: sub *r3, *r7
+L283: clr L241
+lea L102, *r5
+L284: lea L286, r4
+red L164
+L285: clr r6
+bne *r0
+L286: inc *r1
+not L267
+L287: mov #-231, L124
+inc L389
+L288: .data -281, 298
+jmp L123
+red L395
+prn L275
+L289: cmp r5, L0
+L290: stop
+L291: rts
+L292: stop
+jmp L51
+L293: .data 107, 297, -723, 38, -657, -289, -383, 233
+bne L437
+L294: inc L402
+L295: mov L582, L72
+; comment
+L296: clr L535
+L297: dec *r1
+mov #214, *r4
+L298: not r5
+L299: not r6
+L300: red r0
+L301: jsr *r1
+; comment
+L302: add r6, L189
+L303: add #120, r7
+L304: lea L354, r6
+not L131
+L305: prn L189
+
+L306: jsr L455
+L307: rts
+L308: add L463, *r2
+L309: rts
+
+L310: red *r5
+jmp *r3
+clr *r2
+L311: lea L366, *r4
+L312: mov r1, L390
+L313: jmp L15
+L314: .string "lvjnetskdcinwtrgsrisuyed"
+L315: lea L446, L438
+L316: rts
+L317: sub L564, r0
+L318: rts
+L319: cmp r4, L325
+L320: jsr L201
+L321: clr r7
+L322: add r1, r5
+L323: .data 118, 156, 442, -337, 802
+; comment
+L324: jmp *r0
+L325: not L376
+L326: not *r4
+; comment
+L327: add r6, *r4
+L328: prn *r4
+L329: .data 777, 911, 846, -950, -750, -321, -920, 818
+L330: dec *r1
+; comment
+L331: clr *r2
+L332: cmp *r7, r5
+L333: dec *r1
+L334: clr r4
+dec L392
+L335: prn #147
+clr *r3
+L336: jmp *r4
+L337: .string "rtaynvhxmrfncwuzggcmorp"
+L338: sub #39, *r2
+clr r6
+jmp *r6
+L339: bne L460
+L340: not *r4
+L341: not L557
+
+L342: jsr L157
+L343: .string "oufolstqj"
+L344: dec L61
+
+L345: .string "azblozzlhxq"
+L346: not r1
+L347: prn r0
+clr r1
+jsr L411
+L348: mov r3, *r4
+L349: not r7
+L350: sub #-164, L555
+L351: mov r0, L342
+mov L220, L16
+L352: .data 362
+L353: sub #132, r5
+L354: mov r1, *r6
+L355: .data 402
+red *r2
+L356: lea L552, *r2
+L357: clr *r1
+inc L593
+L358: sub r4, *r0
+L359: clr L530
+L360: jmp L390
+L361: mov *r7, *r7
+prn r3
+L362: .data 27
+L363: dec r5
+sub #-102, L595
+jmp *r7
+L364: .string "azgr"
+L365: bne *r7
+
+jmp L85
+not r5
+mov L597, *r6
+L366: stop
+rts
+L367: rts
+L368: jsr *r2
+L369: sub L426, L82
+L370: rts
+L371: sub #-26, L352
+L372: .data -459, 572, 116, 207, 832
+L373: .data 595, -140
+L374: inc *r3
+
+L375: jmp *r4
+sub *r6, L587
+L376: clr *r2
+L377: red L485
+L378: mov *r4, L77
+sub r3, *r2
+sub r1, *r7
+L379: inc L325
+not *r5
+L380: red L213
+L381: red *r0
+L382: clr *r0
+bne L8
+L383: inc r5
+mov #117, r2
+L384: lea L23, r3
+jsr *r3
+bne *r3
+L385: sub L180, L430
+L386: .string "jrmsgo"
+L387: jmp L540
+
+bne L311
+L388: lea L277, r7
+L389: bne *r1
+L390: bne *r7
+L391: sub *r7, r2
+L392: lea L356, *r2
+L393: bne *r5
+dec L570
+L394: bne *r1
+L395: dec *r6
+L396: inc L426
+
+L397: lea L529, *r2
+L398: dec r0
+L399: .string "cxkdyzsljzyzld"
+L400: .string "eicqzbdzc"
+cmp r5, L577
+mov *r5, r5
+clr r3
+L401: bne L179
+cmp r1, #126
+clr r7
+stop
+L402: red L220
+L403: red *r2
+L404: add #59, *r2
+L405: stop
+clr *r2
+not L615
+; comment
+clr r3
+L406: stop
+stop
+lea L338, r0
+L407: not r4
+lea L382, r4
+sub *r1, *r2
+L408: mov #216, *r3
+clr *r5
+not *r4
+L409: sub r3, *r0
+dec *r4
+L410: jmp *r4
+L411: clr L275
+rts
+L412: .data 917, -573, 674, -894, 20, -16, 770, 553
+L413: jmp L604
+prn L350
+L414: lea L598, L184
+L415: .data -955, 925, 677, -511, -326, 303, -622, 347
+sub #207, r5
+cmp #241, L612
+L416: dec r7
+bne *r6
+clr L89
+; comment
+L417: lea L129, *r6
+L418: inc r3
+L419: not L241
+; comment
+L420: red *r7
+L421: jmp *r1
+L422: clr *r2
+L423: rts
+jmp L427
+jsr L217
+L424: jmp *r4
+rts
+L425: inc r5
+L426: sub *r5, *r2
+L427: lea L567, L616
+L428: lea L576, *r5
+L429: jsr *r1
+L430: rts
+dec r5
+L431: bne L247
+rts
+L432: stop
+L433: stop
+; comment
+
+; comment
+L434: prn r4
+lea L150, *r3
+L435: jmp *r1
+bne *r4
+jsr *r3
+L436: .string "ffzkmyrhknviwygdhctiqa"
+not *r7
+L437: .data 492, -639, -99, -998, -43, -571
+not L128
+L438: red r0
+L439: .string "pezrzpnqqwakttkikzfbkf"
+jsr L461
+bne L528
+L440: bne L63
+jsr *r0
+inc r6
+
+L441: not *r6
+L442: not L170
+L443: cmp L125, #-41
+jmp *r6
+cmp *r4, *r3
+L444: not L578
+L445: prn *r2
+L446: jmp *r3
+L447: prn *r0
+bne *r5
+L448: add #34, *r3
+mov #-229, r1
+sub L616, *r7
+L449: inc r0
+L450: add r4, r4
+inc L586
+jsr L48
+L451: inc L261
+L452: .string "thjsjtkgetnmxu"
+not *r3
+mov r1, r4
+add #96, *r4
+jsr L503
+L453: lea L527, L537
+cmp #-69, L463
+prn r0
+L454: cmp #225, L157
+
+L455: cmp r3, *r7
+L456: mov *r4, r0
+L457: .string "ldnokmpghud"
+dec *r6
+L458: dec r5
+L459: stop
+red r0
+stop
+L460: clr *r2
+lea L536, r2
+prn #41
+jmp L565
+L461: dec r2
+cmp #170, L464
+jsr *r6
+stop
+L462: sub r5, L474
+mov *r4, L481
+L463: .data -747, -235, -210, -734, 21, 746, -311
+L464: inc r5
+L465: cmp L390, L559
+L466: inc L121
+lea L597, L544
+L467: mov #-93, L561
+dec L102
+L468: add #4, r3
+mov L149, r6
+L469: sub L496, *r7
+prn L232
+mov *r3, *r1
+jmp *r3
+mov r3, r6
+
+L470: sub *r1, *r5
+L471: .data 281
+L472: jsr *r6
+L473: mov #99, L594
+L474: .data 416, -610, -395, -439, 491, 720
+L475: inc r1
+L476: cmp *r7, #252
+L477: not *r4
+L478: clr L313
+jmp *r2
+inc L429
+L479: jmp *r2
+sub #85, L610
+L480: rts
+L481: dec r2
+L482: cmp L550, r0
+L483: cmp r6, #58
+stop
+rts
+L484: .string "tj"
+L485: .data -399, -330, 599, -784
+L486: jsr L532
+L487: cmp L366, #156
+L488: inc r5
+prn L608
+L489: add #-64, L520
+L490: not r7
+L491: not *r2
+L492: jmp L414
+L493: red L586
+L494: sub *r2, r6
+L495: lea L94, r7
+L496: red L273
+
+L497: cmp r3, L64
+L498: bne L384
+L499: rts
+L500: inc r4
+L501: .string "cjbtxk"
+jmp L58
+L502: not L402
+L503: stop
+dec r2
+add r7, L126
+L504: not L577
+L505: not *r4
+L506: lea L66, L603
+L507: dec L57
+L508: jsr *r5
+L509: mov L554, r0
+L510: lea L219, r7
+L511: add *r1, *r4
+dec L569
+L512: prn r1
+inc r1
+rts
+L513: .data 338, 514, 350
+L514: clr L586
+lea L596, r3
+not *r5
+L515: inc r3
+
+L516: jsr *r5
+L517: clr r2
+L518: .data 371, 261, 892, 812
+mov #82, *r7
+add r3, *r3
+L519: lea L537, L452
+L520: stop
+
+L521: prn r2
+L522: prn *r0
+not r4
+L523: rts
+red L546
+L524: jsr *r5
+L525: clr *r2
+
+L526: .string "ukoji"
+red r4
+prn *r1
+mov #-201, *r1
+L527: stop
+L528: stop
+add *r6, *r4
+sub *r1, r6
+L529: dec r4
+L530: prn *r4
+L531: not *r7
+inc L173
+bne *r2
+red r7
+clr r3
+L532: sub L604, r6
+prn *r5
+L533: lea L592, r0
+L534: mov r5, L553
+L535: .string "oxctiglsvwqcbfr"
+mov #-232, *r5
+L536: bne *r6
+stop
+L537: clr r4
+L538: prn r7
+jmp *r3
+not *r4
+L539: sub L616, *r6
+L540: jsr L228
+L541: .string "npqkrhe"
+L542: rts
+L543: red L210
+L544: clr r2
+L545: red L476
+L546: stop
+
+L547: bne *r4
+L548: clr r4
+L549: jsr L610
+cmp *r7, r4
+L550: .string "zpnaqj"
+L551: mov L559, L364
+sub r1, *r7
+L552: inc L613
+L553: not r1
+L554: lea L509, L615
+add L551, L291
+mov #-70, *r3
+L555: not r4
+L556: stop
+L557: mov L560, *r0
+L558: .string "bpoyvrha"
+jmp *r1
+L559: .data 468
+L560: sub L590, L606
+L561: mov *r6, *r2
+cmp *r4, *r6
+L562: clr L507
+L563: lea L572, L588
+L564: add *r2, r4
+L565: .data -211, -248, -831, 713, -77, 903
+L566: add #219, L278
+red r1
+add L8, *r6
+
+stop
+L567: lea L573, *r4
+L568: not r4
+jsr *r2
+L569: sub *r6, r1
+inc r5
+rts
+L570: .data 838, 530, 564, 693
+L571: jmp *r2
+L572: inc *r4
+L573: cmp r7, L579
+rts
+L574: .string "lbmkthzmhovvdcogregj"
+L575: cmp r5, #-3
+L576: mov r2, *r2
+L577: .data -721
+red r3
+mov r4, L370
+prn #-128
+jmp L93
+L578: jsr *r7
+inc L20
+L579: bne L338
+jmp *r7
+; comment
+L580: jmp L338
+L581: inc L244
+L582: red *r2
+L583: bne *r0
+L584: mov r7, *r4
+L585: rts
+L586: mov *r6, r4
+L587: bne *r6
+L588: bne *r0
+sub r6, r5
+lea L495, L596
+sub L595, L603
+L589: jsr *r2
+L590: .string "ewbqtdpmztpp"
+cmp r5, r7
+prn r4
+L591: add #91, r4
+L592: sub L237, *r7
+L593: clr L607
+red *r5
+L594: red r7
+L595: red L603
+L596: .string "tzehommuu"
+dec r7
+L597: cmp *r7, r5
+inc r6
+L598: dec L211
+L599: .string "hyolxkwpxfge"
+L600: dec *r6
+L601: lea L610, *r7
+not r6
+L602: lea L547, L564
+L603: mov #-130, r1
+bne *r5
+inc *r6
+L604: inc *r6
+not L37
+L605: .string "vjqvfgsbp"
+L606: add *r7, *r3
+L607: rts
+not r0
+L608: .string "bpiuuh"
+rts
+prn #-229
+rts
+sub L85, r4
+L609: rts
+dec L132
+L610: bne L194
+L611: rts
+L612: clr r0
+cmp *r1, r6
+cmp L616, *r7
+lea L616, *r1
+; comment
+L613: dec L260
+jsr *r1
+L614: clr L615
+L615: dec L616
+L616: bne *r4
+stop
@@ -0,0 +1,1039 @@
+; Generated by genCorpus --seed 13
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+clr *r4
+add #135, L486
+L0: bne *r1
+L1: mov r1, *r3
+L2: prn L2
+L3: inc *r2
+L4: cmp r1, #205
+L5: dec r0
+add #-173, r5
+L6: prn r5
+L7: .string "twsdeujunpvgeoyte"
+L8: rts
+L9: inc r5
+L10: jmp L445
+dec *r3
+L11: sub L74, r4
+rts
+jsr L5
+clr L6
+L12: bne *r4
+rts
+red r4
+clr L335
+cmp #233, *r2
+L13: prn *r4
+L14: inc L2
+L15: lea L268, r2
+sub r5, *r5
+jmp L11
+L16: dec L2
+
+L17: .data -337, -808, -618, -863, -985, -824
+mov r0, *r0
+L18: mov *r0, L38
+rts
+stop
+L19: jsr L13
+inc r3
+L20: jsr *r1
+L21: lea L469, r2
+inc L403
+inc *r7
+L22: dec r6
+not r1
+inc *r4
+L23: dec r6
+L24: mov L1, r4
+L25: clr r0
+
+L26: .data 271, 315, 469, 408, 82
+; comment
+L27: bne L14
+L28: rts
+add *r4, *r6
+L29: rts
+L30: rts
+add r3, L522
+jmp *r6
+lea L21, r4
+L31: bne L3
+jsr L0
+add r4, r3
+L32: not r5
+; comment
+rts
+L33: clr *r2
+L34: clr L19
+L35: jmp L1
+L36: .data -832, -239, 820, 3, 720, 743, -954, -227
+L37: inc *r6
+add r5, L31
+L38: stop
+stop
+L39: bne *r5
+L40: .data 613, 138
+bne *r5
+add #-135, *r0
+L41: red L500
+L42: inc L213
+L43: clr r0
+L44: .data -841, 116, -548, -599, 182, 897, -86, -527
+jsr L134
+L45: rts
+cmp r5, *r1
+L46: sub *r3, r3
+L47: dec *r6
+L48: .string "ygqkcanuzuuh"
+inc L48
+L49: prn #159
+
+jmp *r1
+L50: not *r7
+; comment
+cmp *r6, r5
+L51: lea L577, *r7
+L52: .string "fkwxdywugfg"
+not L185
+L53: .string "oi"
+; comment
+add L452, L40
+L54: rts
+L55: red *r3
+stop
+L56: dec L548
+not L475
+L57: lea L388, L591
+L58: red r4
+bne L37
+sub *r0, r6
+L59: jmp L69
+lea L165, *r7
+stop
+L60: lea L450, r0
+L61: lea L530, *r5
+dec r6
+add *r3, L42
+L62: prn *r0
+L63: add r5, L44
+L64: mov r3, L44
+jsr L8
+L65: .string "ckri"
+red L435
+L66: stop
+L67: red *r2
+L68: stop
+add L66, L501
+add r4, r4
+L69: mov #-87, *r3
+bne L69
+clr r4
+L70: bne L24
+L71: inc r2
+stop
+bne L27
+L72: add r4, L40
+L73: jsr L558
+bne L63
+L74: .string "jxqvcnjhxewc"
+L75: .string "etr"
+add *r5, *r4
+L76: add L109, r1
+L77: rts
+L78: stop
+L79: lea L21, *r1
+L80: add r4, *r7
+L81: clr *r1
+L82: prn #-55
+red L41
+L83: lea L411, *r6
+L84: sub *r6, *r5
+prn #-135
+L85: .string "koqtgpfqptwea"
+inc *r1
+L86: clr r5
+inc *r1
+L87: add L314, r5
+L88: clr *r4
+L89: jmp *r3
+L90: inc *r5
+red *r2
+L91: stop
+L92: rts
+dec *r2
+L93: mov r2, r6
+red *r6
+L94: stop
+L95: mov *r6, L171
+L96: .data 842
+L97: clr r5
+add r7, L80
+bne L44
+L98: .data 13, -75, 707, -674, 864, 560
+L99: red r2
+L100: add #-141, L19
+stop
+L101: add #215, *r4
+dec L71
+L102: not *r7
+dec *r2
+L103: jmp *r4
+L104: dec r4
+dec r2
+L105: red r1
+L106: rts
+add #-46, *r3
+red r2
+L107: bne *r5
+; comment
+L108: .string "ydtteoryyotlko"
+L109: dec L37
+L110: prn *r2
+add r7, L20
+L111: sub L173, L31
+L112: sub *r1, r3
+L113: inc *r7
+L114: red r6
+L115: not *r1
+; comment
+L116: rts
+L117: bne *r2
+L118: inc r3
+L119: red L25
+L120: red r7
+jmp L315
+prn L98
+L121: lea L39, L28
+L122: mov L150, *r3
+L123: bne L92
+; comment
+L124: red r7
+L125: sub L508, r5
+L126: cmp #-29, r0
+L127: .data 890, -747, 635, 543
+lea L588, L547
+cmp L292, #-75
+cmp L441, *r4
+L128: sub L429, r0
+L129: add L566, *r1
+mov r2, *r0
+L130: sub #-131, *r3
+inc *r5
+L131: prn L89
+dec L118
+; comment
+L132: prn L419
+L133: jmp *r6
+L134: sub r3, *r3
+inc L7
+L135: red L310
+L136: lea L591, r0
+L137: .string "egqziqpp"
+not *r0
+jmp *r6
+L138: bne L141
+L139: add #-146, L399
+clr *r7
+lea L53, *r7
+
+L140: inc L98
+L141: .data 336, 785, 482, 116, 507, -524, -682, -818
+L142: jmp *r1
+L143: prn L243
+L144: not *r4
+cmp #-193, *r1
+L145: rts
+rts
+sub r5, *r2
+L146: .string "gffjrjlrzxjhecfy"
+L147: lea L57, *r4
+dec r4
+L148: add #44, *r5
+prn r0
+L149: cmp #144, L216
+L150: .string "bbkjkavmmpcbynosii"
+L151: .data -350, 460, -75, 782, 882
+L152: .string "wbhpqjuqdv"
+not *r5
+L153: red *r0
+inc *r3
+L154: add L313, *r0
+jmp *r3
+L155: prn *r7
+L156: lea L350, r2
+L157: prn r5
+
+L158: lea L82, *r2
+L159: red *r6
+L160: .data -81, 914, -703, -775, -231, 279, -14
+not *r2
+lea L334, L122
+L161: .string "lmyalecuggcj"
+L162: inc *r0
+rts
+L163: inc *r1
+rts
+red r1
+; comment
+clr L15
+L164: inc L401
+L165: rts
+lea L149, r1
+L166: inc r4
+rts
+lea L510, L148
+L167: rts
+L168: jsr L328
+L169: sub #23, *r3
+L170: .string "fmuvutpqwpgxcj"
+mov r5, *r7
+L171: bne *r4
+L172: rts
+stop
+jsr L86
+L173: .string "hqqmgyqzebqpcvemgaho"
+red L314
+L174: sub r7, L116
+prn #-107
+inc L366
+L175: add r5, *r3
+clr *r0
+add #-17, L94
+; comment
+prn r4
+; comment
+L176: lea L258, *r1
+lea L23, L64
+L177: add *r7, r3
+jsr *r5
+
+L178: mov r6, r0
+L179: cmp #-242, r7
+lea L402, r0
+red *r7
+jsr *r0
+mov L8, r4
+jmp *r7
+add L41, r3
+jsr L93
+L180: rts
+L181: sub L342, r1
+L182: jsr *r6
+L183: .data -835, 308, 792, -671, 417
+rts
+L184: add #-233, r1
+L185: red L59
+L186: .data -849, -770, 174, -270, 172, -389
+L187: bne *r3
+lea L145, *r5
+rts
+L188: red r5
+L189: mov L63, L589
+jmp *r6
+L190: .string "byz"
+sub *r2, r4
+L191: .data 856
+L192: mov r6, r4
+L193: bne *r1
+dec r3
+L194: lea L125, r2
+L195: jmp *r6
+
+L196: jsr L18
+L197: cmp L113, L15
+L198: add r3, L227
+L199: jmp L127
+L200: jsr L356
+L201: dec L151
+L202: bne L109
+L203: inc *r3
+L204: jmp *r1
+L205: inc L283
+cmp #-190, *r7
+sub r0, *r6
+rts
+L206: inc *r1
+L207: inc r5
+L208: sub #-235, r0
+L209: dec r6
+rts
+L210: .data 753, 770, 407
+L211: .data 431
+L212: prn *r4
+L213: .string "byfajthdydcss"
+red r6
+add r7, r6
+L214: jmp L80
+L215: not *r2
+L216: jsr L193
+L217: mov *r7, r4
+cmp *r1, r7
+mov r5, *r3
+stop
+red *r0
+L218: not L552
+L219: mov *r4, L205
+L220: bne L522
+
+L221: add L104, r3
+L222: rts
+L223: mov #255, r1
+L224: inc *r3
+inc L145
+L225: not *r7
+stop
+red L586
+L226: jsr *r3
+lea L13, L31
+L227: jmp *r2
+L228: .data -711, 215
+mov L318, L217
+red *r3
+L229: bne L183
+mov r2, r2
+L230: .string "ppubvjminupmoboksixjh"
+L231: .data 534, 559, -729, 897, -744, 194
+rts
+cmp #155, r3
+L232: dec *r1
+stop
+L233: dec L371
+L234: sub #83, r1
+L235: cmp *r7, r1
+cmp r7, L57
+lea L219, L251
+L236: bne L20
+lea L285, r4
+; comment
+L237: jsr L566
+; comment
+L238: clr r6
+dec L90
+L239: cmp L76, *r6
+dec r3
+L240: jsr *r5
+stop
+lea L217, *r0
+L241: bne *r2
+add L335, r4
+inc r6
+L242: mov L186, L5
+inc r1
+mov #137, *r0
+L243: rts
+cmp #67, #99
+L244: jsr L452
+L245: sub *r7, *r6
+L246: bne *r2
+L247: bne *r5
+L248: sub L310, L540
+L249: rts
+L250: stop
+L251: jmp *r4
+clr r5
+L252: prn r4
+L253: stop
+inc *r7
+L254: sub L243, L148
+not r3
+not *r4
+L255: stop
+; comment
+L256: prn *r2
+L257: .string "j"
+L258: dec *r7
+jmp *r6
+; comment
+L259: cmp r6, L290
+jmp L388
+L260: .data -421, 952
+L261: add *r0, L356
+L262: jmp *r7
+not *r2
+L263: bne *r5
+L264: dec *r5
+L265: stop
+lea L415, r1
+lea L541, *r1
+L266: add #-254, r7
+L267: prn L455
+inc L512
+L268: jmp *r1
+mov *r4, *r3
+L269: .string "byfewtjga"
+L270: prn L92
+L271: sub r3, L477
+L272: add #6, r6
+L273: bne L81
+L274: dec r0
+clr L322
+jmp *r2
+clr r4
+red *r6
+add *r6, L469
+
+stop
+L275: .string "ctzgfnnmlsmdbqf"
+L276: mov r7, *r6
+L277: jsr L286
+L278: mov L187, *r2
+
+L279: .data -417, 783, 637, -828, -214, 890
+L280: not r3
+L281: clr r6
+cmp *r1, #-225
+rts
+add #220, *r3
+L282: jmp *r7
+sub #1, r3
+L283: prn *r4
+L284: dec r1
+L285: not *r7
+red L474
+L286: rts
+L287: jsr *r2
+L288: sub L461, L305
+L289: jmp *r0
+add L260, r2
+L290: inc L458
+L291: jsr *r6
+inc r0
+L292: .data -667, -672, 815, 972, -884, 496
+dec L519
+L293: .string "fwgroyapmonfzbbdirhprcmw"
+jmp *r1
+L294: .data 157, -181, -545, 215
+L295: lea L234, L218
+bne *r6
+lea L310, L551
+L296: rts
+L297: not *r2
+rts
+L298: sub *r3, L362
+L299: .string "cfyzjuvlvnvmrmzryyagsbg"
+L300: cmp L530, #244
+stop
+L301: rts
+L302: .data 385, -589, -804, 948
+L303: sub #209, L150
+L304: .string "l"
+lea L257, r1
+stop
+dec r2
+L305: rts
+L306: .string "fdugyoiejzrpiti"
+stop
+L307: sub *r6, *r7
+inc *r2
+L308: .string "koflcpsifiynecfohqjuhy"
+L309: dec L512
+L310: cmp L1, *r5
+L311: stop
+red *r3
+L312: jsr *r7
+L313: not *r0
+inc r1
+add *r6, L401
+L314: add #25, L255
+L315: red L236
+L316: sub r1, r2
+lea L575, L225
+L317: bne *r4
+sub r7, r2
+bne *r1
+rts
+L318: bne *r3
+lea L89, L352
+L319: sub L287, *r3
+bne *r5
+L320: mov r3, L201
+rts
+lea L175, *r2
+clr r7
+L321: stop
+stop
+red r6
+L322: rts
+prn L87
+stop
+jmp *r4
+L323: dec *r7
+L324: not r3
+L325: stop
+L326: mov r6, *r3
+bne L319
+mov #-120, r1
+L327: stop
+cmp L574, r5
+L328: mov L90, r1
+L329: .data 427, 911, 729, 933, 876, -975
+add *r7, r4
+L330: .data -143, -845
+rts
+L331: jsr *r4
+L332: red *r2
+L333: cmp *r6, L108
+L334: jmp L142
+L335: mov #196, *r0
+L336: .data -555, -248, 653
+L337: add L414, L394
+rts
+lea L440, *r2
+L338: .data -939, 276, 375, 568, -639
+stop
+cmp L311, r3
+L339: inc L360
+prn L399
+L340: inc L519
+L341: inc L457
+L342: add *r4, *r4
+
+; comment
+L343: prn *r7
+rts
+lea L474, *r6
+mov r3, r6
+dec *r3
+L344: lea L426, *r2
+
+prn *r4
+L345: .data -783, -947, -70, -409, 722
+L346: stop
+mov #19, L581
+L347: .data -188, -574, -42, 735
+mov *r4, L224
+L348: sub *r6, *r2
+stop
+L349: bne L176
+L350: dec L362
+jsr *r4
+L351: not r7
+L352: dec r7
+L353: cmp #-51, L360
+inc *r0
+L354: red r4
+clr L293
+red r2
+L355: clr r7
+L356: cmp r1, L558
+L357: jsr *r4
+L358: not L66
+L359: cmp #193, r4
+clr L91
+L360: stop
+L361: .data -827
+L362: cmp #138, *r5
+L363: .data 611, 530, -200, -595, -487, -711
+clr L585
+L364: not L136
+mov r7, r1
+L365: red *r0
+jmp L538
+L366: cmp L558, #-189
+L367: bne *r5
+dec L195
+L368: not L11
+L369: bne L514
+inc L514
+red r6
+L370: add *r4, *r2
+sub L308, L431
+L371: prn *r6
+L372: prn #-235
+L373: stop
+L374: dec r0
+jmp *r2
+clr L334
+clr *r2
+clr *r6
+L375: red L396
+L376: not r7
+red L375
+dec *r5
+L377: sub *r6, *r1
+L378: not r0
+L379: sub r7, *r7
+L380: not r6
+L381: dec *r1
+L382: .string "ivpjmfxpvgsjqlkaybrtevkq"
+; comment
+L383: .string "ktulxhlchhovfbcjswpldvu"
+L384: not *r4
+mov *r0, *r0
+mov r2, L431
+cmp *r5, #-189
+inc L412
+L385: stop
+L386: jmp *r4
+not L543
+L387: rts
+
+jmp *r2
+L388: not *r4
+add #-6, *r0
+not *r3
+L389: add r4, L562
+L390: dec r0
+L391: cmp L375, r0
+inc r2
+L392: jsr L586
+L393: prn *r2
+L394: stop
+rts
+L395: clr *r2
+L396: clr L494
+L397: stop
+L398: jmp *r6
+; comment
+
+L399: red r6
+L400: .string "thagqnec"
+L401: stop
+L402: sub r6, *r5
+L403: clr r1
+L404: sub #-164, L511
+add #184, L546
+jmp *r6
+add r3, L543
+add L490, r7
+lea L472, r0
+L405: lea L447, *r6
+L406: inc *r5
+; comment
+rts
+lea L578, *r3
+L407: lea L203, r1
+L408: .string "nxeg"
+L409: cmp *r2, r3
+L410: .string "xlbjitlnelzwstf"
+L411: jsr *r6
+L412: stop
+stop
+dec r4
+bne L358
+L413: inc L30
+L414: bne *r5
+
+cmp *r5, L353
+L415: stop
+cmp *r5, *r0
+L416: .string "np"
+L417: bne *r2
+lea L548, L101
+L418: stop
+
+add *r1, r5
+L419: inc r1
+not L213
+L420: .data -745, -968, 484, -785, -748, 468
+bne *r3
+jsr L514
+L421: mov #-28, r0
+not r4
+red r6
+rts
+L422: clr r6
+red *r5
+red L142
+L423: inc *r2
+L424: stop
+jmp *r1
+not r4
+L425: inc r6
+L426: add L155, r0
+L427: .data -643, -643, 219, 491, 429, -431, -66, -279
+mov r4, r5
+mov L470, *r2
+L428: bne L570
+L429: .data 938, 770, 289, 466, 745, -726, 883, -619
+sub *r3, L579
+bne L268
+L430: red L563
+L431: mov r1, r3
+L432: inc *r2
+L433: not L534
+inc r3
+prn L479
+clr L379
+cmp r4, #213
+L434: mov L424, *r3
+L435: mov #35, *r5
+L436: rts
+stop
+add #-165, L589
+L437: .string "nwmnirvttxwmobed"
+L438: .data 683, -488
+L439: bne *r4
+L440: dec L303
+
+not r5
+jmp *r3
+L441: prn *r0
+clr L547
+L442: mov *r7, r1
+L443: stop
+L444: rts
+inc r0
+rts
+L445: rts
+rts
+dec *r7
+L446: lea L201, r0
+L447: prn L293
+L448: rts
+L449: not r3
+lea L419, L449
+stop
+L450: mov L500, *r6
+L451: .string "krilvbghequx"
+L452: lea L32, r6
+jsr L76
+L453: prn L513
+L454: red L523
+L455: not r4
+L456: red *r5
+lea L239, *r2
+L457: dec L160
+sub *r5, r4
+L458: lea L120, L569
+L459: clr r2
+L460: sub r6, *r7
+L461: jmp *r4
+sub *r3, *r4
+L462: lea L463, r0
+L463: jmp L495
+prn #216
+lea L42, *r7
+L464: stop
+L465: .string "cvugtztx"
+L466: add L335, L132
+L467: not L206
+L468: cmp L258, *r6
+stop
+inc *r4
+L469: not *r2
+not *r0
+L470: add L106, L505
+prn L523
+L471: clr L513
+L472: red *r6
+clr r0
+L473: .string "pkpyyhewafeuvpjv"
+L474: .string "lmiycnwsicueczpkymr"
+L475: inc *r1
+L476: dec L133
+L477: lea L559, L574
+prn r4
+; comment
+L478: red r6
+L479: .data 701, 877, -277, 543, -308, 68
+L480: add r3, L490
+L481: not L508
+stop
+L482: dec *r1
+
+L483: mov L445, *r2
+bne *r6
+L484: cmp L580, L491
+L485: inc L181
+L486: lea L271, L369
+clr *r7
+
+sub r7, *r3
+L487: clr r7
+L488: dec L201
+bne L567
+cmp r4, r5
+dec *r7
+L489: sub #-47, L560
+L490: stop
+L491: lea L128, *r1
+; comment
+L492: .string "bgvdaob"
+L493: mov L159, *r6
+stop
+L494: rts
+
+L495: bne L509
+L496: stop
+L497: jsr L533
+L498: clr r6
+add r6, r4
+L499: sub L275, r7
+L500: prn L139
+L501: dec L534
+sub #61, *r3
+L502: .data -994, -653, -940
+prn *r4
+add *r4, *r2
+mov #-16, r3
+L503: jmp *r7
+
+L504: jmp L168
+L505: mov r3, *r1
+cmp *r5, L289
+L506: mov #183, L581
+L507: cmp #56, #-115
+L508: stop
+L509: .string "ibhpmyqs"
+bne L589
+L510: .string "udvah"
+L511: sub #-20, *r3
+L512: clr r2
+L513: rts
+red L518
+L514: sub r7, *r0
+L515: not r7
+
+lea L589, L531
+L516: bne L568
+L517: jmp L574
+bne *r7
+; comment
+mov L36, r1
+L518: .data -163, -514, 683, -108, 563, 255, 633, -844
+rts
+L519: clr *r0
+jsr *r2
+L520: lea L17, *r7
+L521: clr L369
+L522: jsr L258
+L523: cmp r1, *r0
+L524: cmp *r7, #-60
+L525: mov *r1, *r2
+L526: clr *r7
+lea L581, r2
+L527: inc L248
+L528: stop
+add *r2, *r6
+cmp r3, *r6
+bne *r5
+L529: .data -295, -268, -830, 903, -507, -108, -821, -196
+L530: jsr *r3
+L531: jmp *r3
+bne L578
+L532: sub #-245, *r6
+stop
+L533: .string "ltyolfyoxtkoxyo"
+L534: dec r7
+clr *r1
+dec *r4
+bne L86
+L535: bne L66
+L536: rts
+L537: dec r5
+L538: sub #-6, L546
+L539: .string "hxozjasmkirxhxaoseigcav"
+L540: not *r4
+L541: clr r3
+L542: dec r3
+
+clr L0
+lea L549, r1
+L543: sub #-213, L86
+L544: lea L559, L486
+L545: red L587
+L546: not *r2
+clr L585
+L547: red *r3
+L548: sub #-90, L570
+cmp #94, L579
+stop
+lea L7, r4
+L549: .string "ybykfxsfzid"
+L550: cmp r5, r3
+L551: .data 203, 230, 509, -73
+L552: red *r4
+L553: .string "tibuyi"
+inc L572
+L554: dec r1
+L555: jsr *r2
+inc *r1
+L556: sub r2, *r4
+L557: not *r3
+L558: jmp *r4
+L559: inc r1
+add #-161, *r4
+L560: .data -495, -549, -876, -473, -300
+stop
+L561: sub *r6, L575
+jmp L0
+L562: dec r2
+L563: sub L578, *r1
+L564: clr r3
+cmp L591, L582
+L565: dec *r4
+L566: .data 85
+L567: .data -975, 282, -378, 836, -762
+L568: red L18
+jsr *r1
+L569: mov L574, *r0
+L570: mov #-93, L390
+L571: not *r3
+L572: not r1
+L573: stop
+L574: sub r6, *r5
+lea L40, r7
+L575: prn #33
+L576: dec *r4
+L577: not r3
+L578: stop
+L579: .data 623, -56, -93, 444, -125
+L580: jsr *r1
+not r4
+sub L436, L204
+L581: bne *r7
+L582: cmp *r2, *r4
+L583: prn *r7
+L584: jsr L591
+L585: sub L591, *r5
+cmp *r3, #-241
+L586: stop
+jsr *r7
+sub r1, *r7
+not r1
+cmp L591, #-208
+L587: red L165
+L588: red r7
+L589: .data 902, 433, 837, 779, 762, -871, 135
+L590: clr *r4
+L591: sub *r0, *r3
+stop
@@ -0,0 +1,1042 @@
+; Generated by genCorpus --seed 14
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+.entry L624
+L0: .string "ducuteouhubpwpnfehacyqca"
+L1: .data 197, -751, -784, -934, 484, 337, 466, -354
+L2: .data 705
+jsr *r1
+prn *r3
+L3: jsr *r6
+L4: red *r1
+cmp #-74, r7
+rts
+
+L5: mov #-38, r5
+dec *r0
+L6: stop
+cmp r3, *r7
+L7: stop
+L8: lea L158, *r7
+L9: cmp *r0, #135
+L10: inc *r0
+L11: jsr *r6
+L12: add r7, L354
+add r1, r5
+L13: inc L537
+bne L285
+jmp L27
+
+jmp L9
+L14: jmp *r5
+L15: sub r2, L13
+; comment
+L16: add #7, r6
+L17: stop
+dec r6
+L18: add r5, r6
+L19: rts
+L20: dec r3
+L21: not L476
+not *r2
+L22: mov r0, r5
+not L1
+L23: .data -799, -702, -797
+L24: .string "dnpge"
+L25: prn *r6
+L26: bne *r2
+prn #-131
+L27: jsr L8
+L28: jsr *r0
+L29: not *r2
+inc r4
+L30: jsr *r1
+cmp #-199, r6
+L31: .string "baquvmkybeuehrsqmxk"
+jmp *r4
+L32: rts
+bne L231
+L33: lea L26, L26
+lea L24, r6
+L34: clr L12
+; comment
+L35: prn *r2
+inc *r6
+
+L36: lea L186, *r3
+stop
+bne *r2
+L37: not r0
+inc *r0
+L38: red L19
+L39: stop
+L40: .data 624, -480, 747, 334, -107, 366, 65, 460
+stop
+
+stop
+
+L41: mov *r0, *r7
+L42: bne L542
+mov r7, r0
+stop
+cmp r6, #-87
+L43: .data -458, 493, 405, 769, 961, 76, 526, -853
+L44: add r1, r0
+L45: clr r0
+bne *r5
+sub L530, r7
+jsr *r6
+L46: cmp r3, L4
+L47: not *r7
+L48: .data -5, 751, 194, -140, -655, 370, -829
+L49: .string "ehfwknliqoos"
+rts
+jsr *r2
+clr L44
+L50: cmp r0, #-202
+L51: .string "xpbvthdwbvdwlqnsksdyx"
+jsr *r6
+L52: inc L399
+L53: bne *r1
+L54: clr r4
+inc *r4
+L55: lea L51, *r7
+L56: dec *r7
+L57: dec *r4
+L58: add r2, *r0
+rts
+L59: lea L204, *r5
+mov L41, L260
+L60: bne L39
+L61: clr *r3
+lea L42, *r3
+L62: sub *r0, r7
+L63: mov L4, r6
+L64: not L43
+red L501
+L65: jsr L488
+jmp *r0
+L66: .string "xklo"
+inc r1
+L67: stop
+L68: .data 617, 733, 751
+L69: cmp r5, #132
+cmp L66, #19
+jsr *r5
+jsr *r4
+L70: bne L185
+red r4
+
+lea L190, r6
+L71: sub *r5, L54
+
+L72: .string "glffgjpqmqxazstfahpevlu"
+L73: jmp L18
+L74: clr r5
+L75: dec *r7
+L76: prn L52
+L77: clr r1
+bne *r1
+rts
+L78: jmp L91
+mov #-189, *r3
+jmp L75
+lea L44, L4
+L79: cmp r5, L193
+mov r7, r6
+L80: cmp *r1, #67
+L81: sub r0, *r0
+L82: mov L343, r5
+not *r4
+stop
+add r3, L304
+L83: prn *r0
+L84: .string "dweqchhyzbfqavb"
+L85: prn r4
+lea L39, r3
+L86: inc *r3
+L87: jmp *r3
+inc *r0
+L88: inc L386
+dec *r5
+jmp L106
+L89: add *r0, *r6
+clr r0
+red *r7
+L90: stop
+
+jsr L494
+L91: inc L79
+L92: jmp *r1
+L93: clr r2
+L94: not r5
+L95: bne L58
+L96: jsr *r3
+L97: dec *r3
+L98: not L393
+L99: sub *r2, L81
+L100: jsr L28
+inc r2
+L101: prn *r7
+L102: inc *r4
+L103: .string "lnsvzsczl"
+L104: mov *r4, r2
+red r5
+clr r0
+bne *r0
+not r5
+L105: inc L574
+inc *r4
+L106: prn #40
+mov *r7, L46
+L107: inc L28
+L108: inc r5
+L109: .data -409, 415, 880, 12, 24
+red L53
+L110: sub L591, L74
+jsr *r7
+dec L175
+L111: .string "ymefbebmxpkaljfsyle"
+L112: inc *r5
+jsr *r7
+stop
+L113: bne *r5
+; comment
+L114: jsr *r6
+L115: clr r0
+
+L116: not L476
+L117: .string "opa"
+L118: dec *r7
+lea L44, r4
+L119: dec r1
+L120: .data 583
+L121: rts
+L122: red r5
+not r2
+L123: jmp L550
+L124: red r6
+jmp *r7
+mov L50, *r5
+not *r0
+sub #-250, r5
+lea L28, r5
+L125: cmp *r2, r2
+dec L142
+add *r0, L489
+add #55, r3
+L126: inc L98
+L127: inc L221
+L128: not L207
+L129: rts
+L130: jmp L378
+L131: add *r4, L607
+L132: .string "zsfbgnrtipoernfhopc"
+L133: lea L37, *r2
+L134: jsr *r6
+L135: add L180, L618
+not L430
+L136: red r7
+L137: dec *r0
+cmp *r1, r5
+L138: .string "xdacqox"
+cmp #176, L623
+prn L52
+L139: .data 218, -574, 25, -870, -496, -584, -232, 862
+L140: sub *r6, r6
+L141: cmp L125, L44
+red r1
+L142: inc L76
+add *r6, L93
+red L84
+; comment
+L143: add r0, *r7
+L144: .data -996
+L145: red *r5
+clr r5
+L146: stop
+prn #-234
+; comment
+L147: lea L166, r1
+L148: dec r3
+L149: sub #-57, *r5
+L150: not *r1
+L151: jmp L187
+L152: cmp *r0, r7
+L153: inc L139
+inc r4
+L154: clr *r2
+L155: cmp L318, *r5
+sub L228, r4
+L156: stop
+red *r0
+L157: add *r3, r3
+L158: jsr L237
+L159: mov *r6, L567
+L160: mov *r5, r7
+L161: dec L110
+L162: jmp *r1
+L163: dec L63
+L164: cmp L69, #-220
+L165: sub *r6, r3
+L166: stop
+; comment
+L167: mov r2, L203
+L168: lea L157, L351
+stop
+L169: clr L7
+dec L167
+L170: add L254, *r5
+; comment
+L171: rts
+L172: lea L253, *r2
+L173: clr L139
+mov *r7, L234
+L174: add r2, L168
+L175: inc *r3
+L176: rts
+; comment
+red *r0
+lea L24, L151
+L177: .string "dgdzlrwd"
+L178: dec L578
+cmp *r4, *r1
+red *r3
+; comment
+L179: inc L584
+L180: cmp *r7, #-197
+L181: lea L203, r0
+L182: mov L57, *r2
+L183: sub r7, *r7
+L184: .string "irmmkpbvfrekgaafdcnv"
+mov r1, L349
+L185: .string "wbyauufvzwpacqdz"
+prn #141
+red r0
+mov *r6, r0
+
+L186: prn #216
+L187: .string "vvwrfpxgosriteimeknvpwl"
+stop
+L188: bne L511
+L189: mov *r2, *r7
+L190: rts
+dec r4
+L191: .string "wflajwztvdgnvr"
+L192: cmp *r2, #-186
+L193: lea L102, r3
+L194: .data -346
+L195: mov *r6, L98
+L196: not L143
+sub L419, r1
+not L68
+L197: dec *r6
+inc r5
+L198: .data 565, -857, -832, 33, -619, -162, -108
+L199: mov L54, r7
+L200: bne L163
+sub *r4, r4
+L201: sub L144, *r1
+add L2, *r6
+L202: .data 694, 572, 747, 680, 732, 977, 109, 345
+L203: stop
+L204: rts
+L205: jmp *r4
+L206: .string "dtmysxczslxeft"
+inc L186
+L207: dec *r1
+L208: stop
+L209: .string "cbvaytt"
+lea L148, *r1
+L210: bne *r5
+L211: stop
+L212: rts
+red r5
+L213: cmp *r1, r3
+not L208
+inc *r5
+; comment
+L214: .data -711, -461, 222, 395, -563, -881, 185, -562
+clr L162
+L215: stop
+L216: not *r3
+L217: sub #-243, L261
+L218: not L613
+L219: jmp *r4
+L220: .string "xtraqw"
+L221: sub r3, r0
+mov #-66, r5
+add #-155, r2
+sub r1, L62
+L222: inc r3
+clr *r2
+L223: sub *r6, *r5
+inc r2
+jmp *r7
+L224: prn *r4
+L225: .string "ypxxsazrfaqnzwhznrxvlbbu"
+L226: not *r1
+L227: cmp *r7, L266
+L228: clr r5
+not r5
+L229: lea L11, *r6
+lea L266, r1
+L230: jsr *r5
+jmp L140
+L231: bne L622
+L232: clr *r7
+L233: bne *r2
+L234: .string "vvmvnqdacdttkbngp"
+L235: jmp L6
+L236: sub r5, *r5
+L237: red r1
+L238: .data 788
+lea L99, r1
+L239: stop
+L240: jsr L450
+L241: jsr L455
+L242: add #-256, L449
+jsr *r6
+lea L435, r7
+L243: sub r5, *r4
+L244: inc r7
+L245: jmp *r2
+L246: red r7
+red *r1
+L247: lea L109, L578
+jsr L541
+L248: jmp L599
+L249: sub #-48, r4
+L250: clr L252
+jsr *r1
+L251: jsr *r6
+L252: add r3, L9
+L253: cmp #-11, #-25
+L254: rts
+L255: lea L228, *r1
+sub *r6, L247
+
+jsr L169
+dec *r6
+prn L293
+L256: clr r6
+inc *r5
+L257: lea L525, r6
+L258: not *r6
+
+L259: inc L520
+L260: rts
+mov #153, r0
+L261: lea L225, r4
+L262: dec L299
+cmp L170, r0
+cmp L226, L325
+dec L166
+jsr *r0
+stop
+L263: red *r7
+L264: inc L98
+stop
+add L134, r2
+L265: mov L251, *r0
+bne *r6
+L266: prn r1
+L267: sub r0, L89
+sub *r4, *r4
+L268: dec *r3
+L269: .string "vvldzlilmszfk"
+L270: lea L163, L243
+sub L438, *r1
+jmp *r2
+jsr L489
+clr r2
+L271: clr *r2
+sub L146, L306
+L272: bne L82
+L273: jmp L349
+sub #170, r5
+stop
+not *r2
+L274: clr r3
+stop
+L275: mov #244, L138
+lea L479, L446
+L276: rts
+L277: clr r4
+L278: .data -982, 122, 684, -340, -817, 471, -4, 227
+L279: stop
+jmp *r6
+L280: prn L148
+; comment
+L281: clr *r1
+L282: cmp r7, r1
+L283: stop
+L284: jmp *r3
+L285: sub #-5, *r0
+L286: cmp L202, L134
+L287: stop
+prn #0
+L288: bne L580
+L289: .string "mdojemjymesx"
+red L537
+prn #-203
+L290: prn L202
+sub *r1, *r1
+L291: jsr *r3
+L292: .data 26, 167, 863, -772, -663, -797, 964, 558
+L293: clr L189
+L294: red r6
+L295: rts
+L296: sub *r1, *r5
+not *r7
+not *r7
+L297: mov *r7, r4
+L298: .data -16, -895, -82, 767, 818
+mov L411, L355
+L299: cmp *r7, L129
+cmp #-210, *r1
+L300: red r6
+L301: .string "ximhpncpck"
+L302: sub #11, r6
+L303: bne *r0
+L304: jsr *r0
+L305: cmp L177, L504
+jsr L46
+bne *r6
+mov r2, r5
+; comment
+L306: rts
+L307: dec *r3
+L308: cmp *r0, r7
+L309: mov L246, *r7
+L310: jmp *r2
+L311: jsr *r1
+L312: .string "ownuxvbypklgpucvkp"
+L313: red r0
+L314: prn r3
+L315: jsr L513
+add #-142, *r6
+L316: rts
+L317: jmp L287
+L318: cmp *r0, #102
+jmp *r0
+L319: inc *r2
+L320: jmp *r3
+L321: bne L235
+not r5
+L322: .data 237, -877, 622
+L323: prn L254
+prn L552
+
+add *r4, *r2
+L324: .string "vjlh"
+lea L315, r1
+L325: jsr L100
+bne L57
+L326: jsr *r2
+L327: clr L504
+mov L212, r7
+L328: .data -669, -2, -239, 416
+L329: cmp L107, #43
+jmp L513
+L330: stop
+L331: bne L336
+mov #247, r3
+L332: jsr L266
+L333: inc *r5
+
+jmp L346
+L334: clr r5
+L335: lea L540, *r6
+stop
+L336: not r4
+jsr *r6
+stop
+L337: jmp L366
+
+sub #40, r6
+L338: red *r2
+L339: mov L260, L253
+clr r0
+L340: jsr L4
+L341: bne *r6
+L342: .string "s"
+L343: dec *r2
+; comment
+L344: stop
+dec r3
+dec r0
+dec r7
+L345: dec *r4
+L346: jsr L20
+L347: rts
+jsr L264
+prn r7
+L348: prn #208
+L349: clr L143
+mov r0, *r6
+red *r0
+bne L247
+L350: .string "bcf"
+; comment
+lea L274, L90
+L351: mov *r6, *r3
+L352: red L72
+jsr L472
+L353: clr r0
+L354: add *r1, L67
+clr r4
+L355: clr *r0
+L356: lea L497, *r5
+L357: .data -25, -981, 7, 582, -389
+L358: add *r3, *r1
+red r4
+mov #-51, r7
+jsr *r5
+L359: stop
+L360: mov *r0, L512
+L361: cmp *r4, #-166
+L362: sub #-75, L403
+L363: sub *r3, L206
+; comment
+L364: dec L546
+clr L374
+L365: sub *r1, *r2
+red L410
+L366: rts
+L367: prn *r1
+jsr L246
+cmp r5, #69
+L368: cmp r1, L186
+jsr *r0
+L369: add L252, r6
+dec *r2
+L370: rts
+L371: sub L35, *r4
+L372: mov #-240, r6
+L373: jmp L92
+L374: sub L193, *r6
+L375: add #-166, L395
+inc *r4
+L376: .string "zlkrogvsqlspcuug"
+L377: prn #-62
+L378: stop
+mov r5, *r2
+stop
+; comment
+L379: sub r5, L217
+L380: .string "sqfhwsrzwxv"
+jsr *r1
+L381: .string "frvffhtnizwvwqvorsrfc"
+L382: bne *r7
+L383: inc L226
+L384: .data -323, -689, -140, 116, -854, 524, 953, -532
+L385: mov L428, r7
+L386: prn #48
+bne L443
+L387: red L547
+L388: stop
+L389: cmp *r4, *r1
+L390: cmp r3, #164
+L391: prn #201
+L392: rts
+L393: dec r4
+L394: .data -379, -438
+; comment
+L395: jsr *r0
+; comment
+L396: jmp L73
+not *r7
+L397: dec r2
+bne *r6
+L398: dec L301
+L399: prn *r1
+; comment
+L400: add *r3, *r3
+L401: .data 697, -975, 439, -931, 939, 429, 964, 480
+L402: mov L576, *r5
+dec *r7
+L403: .string "b"
+clr *r2
+cmp *r1, *r1
+red *r7
+L404: inc L36
+L405: stop
+L406: rts
+L407: .string "wbtrf"
+dec L532
+L408: prn #-147
+clr *r5
+L409: not r2
+L410: .string "jkhaxwnvzksq"
+L411: bne *r6
+; comment
+L412: rts
+cmp #-242, r2
+L413: stop
+L414: add #75, r5
+L415: jsr *r1
+L416: .string "evxewivg"
+L417: mov *r1, L493
+L418: mov *r4, *r2
+not L489
+L419: red *r3
+
+not r6
+L420: not *r4
+prn #-125
+dec L426
+L421: inc L547
+L422: red L496
+L423: bne *r4
+L424: inc r6
+red L432
+L425: red r1
+dec r0
+jmp L232
+L426: sub #211, r1
+L427: red *r2
+L428: not L462
+not L330
+red r1
+L429: not L120
+not L443
+L430: clr L616
+add *r2, L608
+L431: .data 204, 269, -647
+L432: rts
+L433: not L147
+L434: sub *r1, r7
+inc *r0
+jsr *r1
+L435: jmp L3
+rts
+L436: jmp *r2
+L437: jsr L441
+lea L235, r0
+L438: rts
+L439: red r0
+L440: .data 652, -180, -275, -719
+L441: clr *r6
+L442: clr r6
+red L354
+inc *r6
+L443: .data -523, 152
+L444: lea L151, *r0
+mov L453, L350
+L445: .string "rronymk"
+inc *r5
+jsr L330
+L446: bne L611
+L447: mov L518, r6
+L448: bne L473
+stop
+L449: jsr L197
+L450: jmp L461
+mov L6, *r5
+L451: .data 228, 964, 309, -756, -285
+L452: jmp *r0
+inc *r1
+cmp *r6, r4
+jmp L513
+sub #-22, *r4
+dec L570
+L453: cmp r2, L183
+jmp L245
+L454: cmp *r4, r7
+L455: jmp L105
+L456: mov r2, L44
+stop
+L457: sub #-128, L488
+L458: bne *r2
+L459: lea L430, *r0
+clr r4
+jmp L548
+L460: stop
+jmp L353
+red *r5
+L461: jmp L513
+L462: mov *r5, L198
+jmp L489
+L463: bne *r1
+L464: red L105
+L465: cmp #188, r5
+L466: sub #-107, r5
+L467: dec *r0
+jmp *r1
+; comment
+inc *r4
+L468: cmp #-30, *r0
+L469: add *r3, *r2
+L470: sub r3, *r2
+sub L347, L552
+L471: add *r6, *r2
+L472: add #-222, *r4
+L473: cmp L342, #-190
+bne L515
+L474: jmp L211
+inc r1
+L475: jmp *r3
+L476: dec L240
+not r2
+L477: lea L350, r5
+L478: bne L591
+cmp *r6, L561
+L479: sub *r0, r7
+sub L546, *r3
+clr L555
+L480: prn #232
+L481: .data -407, 458, -104, -269, 954
+L482: jmp L407
+; comment
+L483: sub #-31, *r7
+L484: jsr *r4
+L485: red *r7
+L486: cmp r4, #169
+L487: .string "cmlydhsqzovyqfpcqqmiihz"
+L488: sub r6, r0
+L489: inc L112
+L490: lea L139, r5
+L491: jmp *r7
+stop
+stop
+
+L492: not *r5
+L493: jmp *r3
+L494: prn #-38
+jmp *r1
+L495: not L592
+mov #-92, L607
+prn r3
+L496: dec r6
+rts
+L497: sub r5, L196
+L498: stop
+L499: add L548, *r6
+L500: jsr *r4
+L501: lea L247, *r6
+L502: jsr *r5
+L503: sub #231, L76
+lea L222, r5
+L504: prn *r0
+red L291
+mov r4, *r4
+L505: add *r1, L541
+L506: lea L185, L68
+stop
+L507: prn *r2
+L508: sub #-103, *r6
+L509: .string "nufobwdwfkbu"
+L510: not r0
+lea L340, r5
+stop
+jmp L601
+L511: stop
+L512: not *r4
+L513: not *r5
+L514: lea L52, L576
+L515: jsr L258
+lea L621, *r2
+prn L405
+L516: .string "vjnov"
+L517: cmp r0, r0
+L518: dec L566
+mov r7, r1
+L519: inc r7
+jmp L350
+jsr L593
+mov *r3, L491
+L520: jsr L107
+L521: dec *r3
+stop
+L522: not L231
+; comment
+L523: not *r0
+L524: not *r6
+L525: not L539
+L526: .data 107, -626, 675, 937
+L527: inc L595
+L528: rts
+L529: lea L419, L616
+L530: jsr L571
+L531: clr L595
+L532: sub L599, *r6
+L533: inc *r5
+jsr *r2
+jmp L613
+L534: prn #-49
+L535: stop
+L536: mov #-20, r3
+L537: jmp *r3
+cmp r0, #-222
+L538: add L502, r2
+L539: mov r5, *r4
+jmp L510
+L540: .string "sphumxecwparecuek"
+L541: jsr L508
+add r6, r2
+L542: jsr L583
+L543: cmp L619, L183
+lea L144, *r3
+L544: stop
+L545: cmp #-225, #14
+add *r5, r4
+inc r3
+L546: dec L325
+; comment
+mov *r5, r2
+lea L618, L136
+L547: .data -74, -197, 585, -264
+L548: sub L50, *r0
+L549: lea L184, r2
+L550: dec L21
+L551: inc L372
+L552: prn #-161
+L553: rts
+cmp *r3, r1
+inc L398
+L554: add r1, r2
+bne L569
+L555: .string "ledzusdwuhhdn"
+L556: lea L600, r1
+L557: .data -325, -1000, -175
+L558: add r7, L549
+L559: sub r7, *r1
+prn r1
+L560: jsr L606
+L561: jsr L425
+L562: .data -698, 146
+L563: rts
+add *r7, *r3
+inc r6
+L564: jmp *r0
+not r2
+L565: lea L181, *r3
+L566: add #67, r5
+cmp L574, r0
+L567: stop
+red L577
+L568: stop
+L569: lea L595, r5
+L570: add #-97, r4
+lea L592, *r6
+red *r0
+L571: red L361
+L572: .string "uhuozvillnvauwbztqjvtzc"
+L573: dec L37
+L574: dec *r5
+L575: rts
+L576: stop
+L577: clr r5
+jmp L269
+L578: bne *r5
+L579: .string "jax"
+L580: lea L625, *r6
+L581: .data 441, -104, 476, -359, -288, 221
+L582: prn *r0
+L583: not r3
+
+inc *r6
+L584: .data -434
+L585: stop
+L586: dec L93
+L587: stop
+L588: stop
+L589: stop
+L590: add L625, *r4
+L591: add *r1, r6
+L592: .string "yqsuazguqabwmvc"
+L593: inc L625
+sub *r4, r4
+cmp *r6, *r2
+bne *r6
+L594: cmp L92, *r4
+L595: rts
+L596: jmp *r0
+L597: prn #242
+mov r6, r4
+L598: rts
+lea L565, L627
+L599: add #-137, r6
+L600: clr r6
+inc *r0
+L601: mov #-36, r1
+L602: cmp L277, r1
+inc r0
+L603: rts
+stop
+L604: .string "rysesylxspndretdxr"
+L605: clr L464
+prn #-111
+L606: stop
+L607: rts
+; comment
+L608: not r6
+L609: mov *r4, r0
+L610: add r0, L337
+jsr *r3
+rts
+cmp r3, *r3
+L611: dec r6
+L612: mov *r1, L448
+dec r6
+L613: add #226, L626
+L614: .string "eicpgcmwfusnan"
+L615: add L627, L624
+prn *r0
+add *r1, r3
+
+lea L540, L627
+prn L84
+L616: stop
+inc L624
+jmp *r7
+L617: red *r6
+L618: jsr L624
+L619: mov #174, r6
+L620: not *r7
+L621: dec L627
+L622: .data 348, 873, -255
+L623: rts
+L624: jsr L102
+L625: rts
+L626: red L397
+L627: not r2
+stop
@@ -0,0 +1,1041 @@
+; Generated by genCorpus --seed 15
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+jmp *r4
+L0: add r0, *r7
+clr r0
+L1: bne L1
+L2: stop
+L3: clr L3
+prn r0
+clr L24
+L4: jsr L4
+L5: add #-151, *r3
+mov r6, r4
+L6: mov #76, *r6
+L7: red r2
+L8: .string "c"
+prn *r2
+L9: rts
+; comment
+L10: inc r3
+cmp L213, *r3
+L11: not *r4
+L12: not L573
+L13: .string "sxafcuiyqjsnkytsuippnre"
+L14: .string "gegvhyyynvkafxs"
+L15: add r1, r6
+L16: lea L1, *r0
+L17: bne L6
+L18: mov *r3, *r3
+L19: add *r5, r1
+red L10
+inc *r5
+stop
+jsr L595
+L20: .string "afhncajvknnrhtbvipcfusin"
+L21: lea L211, *r6
+clr L127
+L22: sub L468, L4
+mov L419, L20
+L23: not r0
+L24: .string "gum"
+L25: sub L402, r4
+jmp L157
+L26: .string "ajekiragmciluhzrxicmuhv"
+L27: jsr *r7
+L28: cmp L10, L7
+L29: stop
+L30: stop
+lea L275, *r5
+sub #-178, L107
+L31: bne L55
+L32: inc r0
+L33: clr *r1
+L34: jmp L32
+L35: red *r7
+; comment
+L36: mov *r5, L10
+L37: lea L309, L0
+L38: clr r6
+L39: prn *r7
+; comment
+L40: stop
+bne *r1
+; comment
+stop
+L41: mov L583, *r0
+L42: cmp #-242, *r5
+L43: cmp #235, L17
+L44: prn *r5
+stop
+red r6
+L45: not *r1
+cmp r2, r2
+L46: inc L579
+L47: dec r5
+L48: not r0
+L49: dec L32
+L50: sub *r4, r7
+mov r7, *r6
+L51: stop
+L52: add r3, *r0
+L53: bne *r1
+L54: jmp *r7
+L55: .string "pe"
+L56: dec *r7
+L57: clr r7
+L58: .string "oxnvyw"
+L59: red r0
+prn r7
+L60: rts
+L61: jmp L397
+not L43
+L62: clr r4
+L63: .string "vgeks"
+; comment
+L64: stop
+L65: inc r3
+not L399
+L66: lea L53, L391
+inc r1
+stop
+L67: rts
+L68: bne *r4
+red *r1
+lea L375, L395
+prn r5
+rts
+red *r2
+jsr L410
+L69: red L64
+lea L35, *r4
+L70: jsr L40
+red *r0
+clr *r3
+L71: prn L131
+clr *r1
+L72: inc L40
+L73: jsr *r4
+
+L74: stop
+L75: .data -858, 744
+
+L76: rts
+L77: .string "lfp"
+L78: dec L45
+dec r1
+cmp *r4, r6
+
+stop
+L79: bne *r0
+L80: stop
+L81: inc r4
+L82: dec *r7
+L83: cmp #-214, *r6
+jsr L564
+L84: .data -378
+L85: .data 820
+L86: stop
+jmp *r7
+lea L46, r1
+L87: sub #129, L19
+clr r4
+L88: .data -42, 839
+L89: lea L258, *r6
+bne *r5
+add r4, L45
+add *r4, *r1
+dec r4
+L90: jsr *r5
+L91: rts
+L92: red L459
+stop
+lea L36, *r3
+L93: not r0
+dec r6
+L94: add L584, L117
+mov *r2, r4
+clr r7
+
+L95: sub #196, L51
+L96: dec *r2
+L97: sub #-136, r0
+clr L74
+red *r0
+L98: .string "rqdyvwlnykaqxzg"
+L99: clr r5
+L100: .data -245, -470, -452, 324
+bne *r4
+bne *r3
+dec r0
+L101: stop
+cmp r6, r1
+L102: clr *r1
+L103: .data -546, 54, 555, -255, 89
+L104: rts
+jmp L143
+L105: inc r4
+L106: jmp L226
+L107: red r1
+L108: jmp L0
+L109: jsr L315
+L110: jmp *r5
+; comment
+L111: cmp L435, *r0
+L112: cmp r7, *r7
+L113: lea L281, *r7
+red L19
+L114: stop
+inc *r2
+cmp #-3, r0
+L115: mov *r4, r6
+L116: .string "bmkhzoovetip"
+rts
+L117: dec L602
+not r1
+prn L320
+L118: not L5
+mov #107, *r2
+L119: sub #180, r0
+L120: .string "sfjxofxakhshob"
+; comment
+red r4
+mov r1, r3
+L121: jsr *r3
+inc r2
+L122: jmp L143
+L123: .string "txdnsixwntrfdnsbkfw"
+L124: .data -635, -831, 302, 11, 244, -561, -92, 328
+prn #-167
+L125: rts
+L126: clr r6
+not r3
+stop
+dec r0
+L127: sub L89, L512
+L128: prn #128
+L129: inc r1
+L130: clr r7
+L131: red r3
+add *r3, L336
+L132: dec *r7
+L133: red *r5
+L134: not r0
+L135: jmp L596
+sub *r4, r4
+L136: lea L97, r7
+red *r7
+L137: .data -988, -930, -967, -288, 748, 161, -141, 582
+L138: .string "beutrizaaactgomc"
+L139: lea L116, *r3
+dec *r5
+L140: bne *r6
+prn #-10
+stop
+L141: cmp r2, *r1
+sub *r5, *r2
+L142: bne *r4
+L143: stop
+jsr *r2
+L144: prn r2
+L145: add r5, L257
+L146: rts
+L147: cmp r0, r7
+L148: jsr L69
+L149: clr r3
+L150: lea L138, r4
+rts
+cmp r0, L62
+; comment
+L151: not L41
+clr *r2
+L152: clr L99
+bne *r0
+stop
+sub #-54, *r3
+add *r5, L73
+jmp L225
+L153: red r3
+mov L431, r2
+inc L260
+L154: rts
+jmp *r0
+rts
+bne *r3
+rts
+L155: dec L28
+not r4
+L156: clr r2
+L157: cmp *r0, #139
+not L214
+L158: clr *r2
+L159: .data 309, -944, 254
+stop
+; comment
+L160: .data -775, -77, -992
+L161: prn *r3
+L162: prn *r6
+rts
+L163: prn L310
+L164: jmp *r6
+L165: add #-130, r5
+L166: jsr *r2
+rts
+L167: red r1
+L168: jmp *r7
+cmp r3, r1
+L169: jmp L354
+dec r2
+bne *r2
+cmp *r4, r7
+L170: prn *r7
+L171: mov r7, *r0
+cmp #50, L325
+L172: sub #201, r0
+L173: not r7
+red r4
+L174: .data 265
+L175: bne L120
+L176: red *r2
+L177: add L100, r7
+clr *r1
+; comment
+L178: stop
+L179: cmp *r4, r3
+L180: stop
+clr L579
+jmp L67
+not r5
+L181: mov r4, r2
+sub r5, r3
+L182: red L111
+L183: lea L92, r1
+; comment
+L184: inc r5
+L185: clr L21
+L186: red L417
+L187: red r2
+L188: lea L177, L29
+L189: rts
+L190: red L29
+L191: lea L47, *r3
+prn #-226
+lea L130, L611
+L192: stop
+L193: dec *r4
+clr L117
+bne *r0
+L194: mov L572, *r0
+L195: cmp *r2, r3
+L196: jsr L499
+L197: sub *r4, *r5
+L198: cmp *r2, r5
+L199: .string "pfesssxdojioewqzvsw"
+bne *r7
+; comment
+L200: rts
+L201: jsr L128
+L202: .data -949, 294, -106, -429, 400, 137, 425
+prn *r5
+L203: sub #-170, r4
+L204: lea L190, *r1
+; comment
+cmp *r1, L123
+L205: .string "hqznnvosxmaagcjmya"
+dec *r3
+stop
+L206: cmp #81, #99
+L207: jmp *r4
+L208: dec L88
+L209: .data -835, -931, 123, 578
+L210: not L122
+L211: mov L105, L215
+L212: stop
+L213: cmp L57, L290
+L214: red *r5
+L215: red r0
+sub #-122, r0
+L216: jsr *r7
+dec *r6
+L217: bne L19
+L218: red *r1
+L219: red r7
+L220: mov #-149, L6
+L221: rts
+L222: lea L43, L166
+jsr *r4
+L223: inc *r2
+
+L224: jmp L385
+L225: rts
+not r4
+L226: stop
+jsr L136
+L227: dec r4
+L228: rts
+L229: stop
+L230: bne *r5
+L231: jsr L168
+jmp *r4
+L232: .string "sfebdthohaexo"
+jsr L558
+stop
+add r2, r0
+L233: cmp L527, #97
+L234: .data 834, -771, -839, -907
+L235: red L489
+L236: cmp *r0, #55
+jsr *r4
+clr r1
+L237: .data 816, -382, -669, -260
+L238: rts
+add r7, *r4
+L239: rts
+L240: prn L530
+L241: dec *r7
+L242: .string "dupvdmgooklvx"
+dec r7
+L243: jmp *r7
+L244: rts
+L245: jmp L77
+L246: cmp r4, L226
+L247: stop
+mov r0, r0
+L248: clr L68
+L249: inc *r6
+L250: not L90
+L251: rts
+L252: rts
+L253: rts
+sub *r5, *r2
+L254: jmp L544
+L255: prn *r1
+L256: not *r4
+L257: inc L12
+dec r4
+L258: clr L606
+L259: prn #164
+L260: mov r7, r4
+L261: not r3
+L262: cmp L288, *r5
+L263: jsr L219
+red *r0
+L264: .data 831, 387, 476, 797
+dec r3
+jmp L510
+cmp L410, r0
+lea L141, r3
+L265: mov *r2, r1
+lea L21, *r3
+L266: clr L138
+L267: .string "kk"
+bne L322
+red L540
+L268: mov L219, L409
+L269: rts
+L270: .string "xpafwkwrbkw"
+L271: mov L138, r5
+dec *r0
+lea L6, r7
+; comment
+L272: jsr L350
+
+bne L592
+dec *r2
+L273: prn r4
+L274: cmp *r4, L291
+L275: cmp *r1, #-123
+L276: lea L119, *r4
+dec *r0
+L277: .data -864, 810, 161, -532, 753, -575
+
+L278: stop
+dec r6
+L279: red r4
+add *r3, L184
+sub L67, r2
+L280: sub *r4, *r7
+mov L136, L37
+L281: rts
+L282: .data -66, 602, -455
+L283: cmp #-224, #-11
+not L571
+lea L364, *r4
+L284: add r0, r0
+bne *r4
+L285: add L141, L379
+L286: red L9
+L287: add r1, L611
+L288: mov *r4, r4
+L289: cmp *r7, L464
+L290: jsr L496
+not r6
+L291: .string "d"
+L292: red L98
+L293: lea L56, L128
+clr L588
+L294: inc *r6
+L295: bne L581
+L296: jmp *r4
+L297: bne *r1
+dec r7
+mov *r7, *r6
+clr L418
+jsr L513
+dec r5
+clr *r7
+L298: lea L566, L311
+add *r1, *r7
+L299: rts
+mov #102, L419
+L300: jmp *r1
+L301: stop
+rts
+inc L438
+L302: clr *r5
+sub #-1, L327
+L303: .string "ukgcxgyxpqiglzpy"
+L304: inc L5
+L305: cmp #143, r0
+L306: not r5
+mov #129, *r4
+L307: inc r3
+L308: jmp L26
+red r6
+prn L51
+L309: stop
+L310: red L385
+L311: add #-247, L36
+add L373, *r3
+add r3, *r5
+lea L234, *r6
+L312: rts
+L313: rts
+L314: sub L172, *r0
+L315: inc r7
+L316: dec L121
+L317: mov L588, *r6
+lea L535, L400
+mov #186, L86
+L318: stop
+L319: clr L474
+inc L182
+L320: .string "ffvqtywptsus"
+L321: .data -385, 556
+L322: sub *r6, *r2
+L323: mov L12, L425
+L324: prn *r0
+stop
+L325: lea L608, L575
+L326: add #-177, L475
+L327: sub #119, r5
+add *r4, *r0
+inc *r5
+L328: stop
+not r0
+L329: rts
+L330: .string "afppidhdi"
+L331: jmp *r7
+L332: mov L145, r1
+L333: sub #-248, L250
+L334: sub L266, r5
+dec L458
+lea L136, L263
+L335: not *r2
+L336: prn *r6
+jsr *r6
+L337: stop
+L338: jmp *r7
+clr L34
+stop
+L339: sub L366, *r6
+L340: .string "zgfzugallae"
+L341: red r1
+L342: red *r0
+L343: clr L558
+L344: jsr *r3
+not L610
+L345: cmp r7, L593
+L346: .string "vmcxbmaynnqk"
+sub *r1, L357
+add *r3, r6
+L347: cmp *r3, L362
+inc r5
+L348: add *r2, r3
+L349: red *r1
+L350: lea L271, r7
+L351: mov L615, r7
+L352: jmp L430
+mov r7, r5
+sub r1, r0
+L353: not L394
+jmp *r2
+not *r7
+lea L470, *r6
+L354: red *r1
+L355: bne *r1
+L356: bne *r2
+L357: not *r2
+L358: add *r6, L433
+L359: sub #226, r0
+L360: add r5, L556
+L361: bne *r7
+red *r5
+red L371
+
+L362: clr r6
+L363: .string "vgvbze"
+L364: .string "zikcuzdcxyurppedndwxtx"
+mov L537, L375
+L365: prn #172
+cmp L362, *r0
+L366: lea L302, *r3
+add *r5, *r7
+rts
+L367: prn L369
+jmp L418
+L368: bne *r7
+L369: mov L192, *r1
+L370: add *r2, L497
+inc r3
+L371: clr *r0
+prn *r1
+dec r1
+L372: cmp r0, #-100
+add L435, *r2
+jsr *r1
+
+L373: .string "lmlckswxjoecshlqbsusul"
+jsr L314
+L374: .string "pua"
+L375: red r2
+L376: sub *r1, *r6
+L377: red L461
+; comment
+add #139, L436
+L378: not r3
+clr r4
+bne L113
+L379: stop
+sub *r1, L558
+bne *r1
+
+L380: not L79
+L381: dec L5
+L382: sub r2, L120
+L383: red L274
+L384: red *r2
+L385: sub r1, *r0
+L386: add L258, *r1
+L387: inc *r0
+not L529
+L388: mov L216, L76
+
+mov #77, *r2
+mov #19, *r4
+L389: .data -670, 357, -725, -583, 993
+L390: .data -885, 563
+L391: inc r7
+sub #-226, *r0
+L392: bne L58
+mov #-56, r4
+L393: jmp L290
+cmp L452, #-25
+L394: cmp r1, L303
+L395: dec L495
+L396: prn L592
+L397: red L607
+L398: rts
+L399: not *r2
+L400: .data 805, 823, -909, 114, -822, 735, 883, -307
+L401: add r1, r0
+L402: dec r6
+L403: red L471
+L404: lea L581, *r4
+L405: inc L548
+bne L95
+L406: .string "ou"
+L407: .string "lzubichs"
+L408: mov L300, L167
+L409: inc r7
+inc r7
+red L193
+lea L179, r2
+mov L599, *r1
+not r0
+L410: mov L578, L140
+L411: clr L447
+L412: jmp L452
+stop
+L413: .data 626
+L414: prn r1
+L415: bne *r7
+prn L407
+L416: sub #76, *r3
+; comment
+inc L512
+; comment
+L417: .string "fjipsqoczaffqyffnwmgb"
+L418: jmp *r1
+L419: sub L474, *r5
+L420: jmp L611
+clr r0
+L421: bne *r3
+L422: prn L319
+not r2
+
+dec *r1
+L423: lea L53, r1
+L424: .string "xeco"
+L425: clr L404
+L426: rts
+L427: prn *r1
+stop
+L428: not r4
+add #63, L350
+L429: mov r6, *r0
+L430: mov #-59, L481
+L431: rts
+L432: jsr L544
+L433: mov L456, *r1
+bne L75
+not L506
+cmp r0, L560
+red *r7
+L434: dec r5
+not r6
+cmp #36, *r7
+L435: rts
+stop
+
+red *r4
+L436: not *r1
+L437: jsr L71
+L438: stop
+L439: lea L278, L607
+L440: bne L494
+jsr *r4
+L441: clr r5
+stop
+L442: prn r4
+bne L285
+; comment
+L443: jmp *r4
+L444: jsr L535
+L445: clr L543
+mov r6, *r7
+L446: .data 279, 449, 215, -772
+L447: prn #128
+L448: bne L614
+L449: mov #89, *r1
+L450: cmp #55, #-252
+L451: dec r0
+L452: add L532, L339
+L453: jmp L517
+lea L209, L423
+bne *r6
+L454: .data 442, 92, 277, -535
+L455: cmp r7, #-254
+L456: mov *r7, *r6
+add r3, L255
+L457: stop
+L458: stop
+jmp L574
+rts
+clr L191
+L459: not r3
+add L508, r2
+L460: .data -429, -182, -670, -271, -78
+L461: stop
+L462: not *r2
+rts
+mov #-17, L608
+stop
+rts
+L463: dec *r4
+L464: not r0
+inc L544
+lea L524, *r1
+jsr L604
+L465: mov #-252, r3
+L466: lea L328, *r6
+L467: .string "ytaogjsaxskkxxmxtjcdtzqs"
+L468: prn #7
+L469: .string "mjihusilmrvqkqktnhftbeds"
+L470: .data 843, -693, 690, 166, 864, -874
+L471: dec L615
+; comment
+bne L473
+L472: .data 654, -234, -65, 614, 29
+L473: .string "oqwovfkznohwxapsy"
+stop
+L474: prn #90
+; comment
+add r5, r1
+L475: inc r6
+L476: mov *r4, *r3
+L477: not L282
+L478: sub L596, r1
+L479: rts
+L480: stop
+sub r7, r7
+bne L485
+L481: not L328
+lea L265, *r2
+mov #133, *r3
+cmp #-14, L567
+L482: .string "lvktxun"
+L483: .string "ftwkfiftzibjbbsyrzq"
+L484: mov *r6, L217
+L485: bne L15
+L486: add L547, r3
+L487: rts
+L488: inc r0
+L489: clr r0
+L490: add L599, r6
+
+red r1
+lea L557, r1
+rts
+L491: cmp #-49, *r2
+L492: red L201
+L493: jsr L276
+L494: jmp L513
+L495: jmp L286
+L496: dec *r2
+L497: clr L499
+not *r7
+stop
+L498: dec *r3
+L499: cmp r4, #-151
+inc L555
+L500: prn *r4
+red L400
+L501: jsr *r7
+; comment
+dec L516
+L502: prn r0
+L503: stop
+L504: add *r7, *r2
+lea L590, L530
+sub *r7, L449
+L505: rts
+L506: sub r2, r5
+bne *r3
+L507: mov L221, *r3
+L508: rts
+L509: jsr *r1
+L510: not *r0
+L511: jmp *r2
+clr L588
+L512: clr r1
+add L588, *r1
+not L344
+inc r4
+jsr *r1
+L513: sub L597, L212
+L514: bne L562
+L515: add r6, L525
+L516: clr r2
+L517: clr L533
+L518: clr r2
+L519: sub r5, L298
+L520: .string "nnykng"
+L521: red L44
+prn r5
+L522: red r6
+rts
+L523: rts
+jsr *r4
+sub L189, *r7
+L524: stop
+L525: clr L606
+L526: .string "glrjcmyziwgmvduvxus"
+L527: sub L608, L317
+L528: inc *r4
+L529: prn r6
+L530: dec *r6
+L531: jsr *r1
+; comment
+L532: stop
+not *r7
+prn *r1
+L533: rts
+lea L268, L604
+L534: inc *r4
+add #175, L560
+not *r7
+L535: clr L232
+L536: .data -663, 754, 429, 325, 433
+not r1
+L537: lea L559, L611
+mov r5, *r1
+L538: add L388, r2
+L539: rts
+L540: clr r7
+L541: lea L610, *r4
+L542: .data -713, 528
+L543: cmp *r2, L152
+L544: jsr L127
+L545: prn r7
+mov #126, L610
+L546: clr r7
+L547: not *r2
+L548: prn r2
+prn #-225
+L549: rts
+stop
+dec *r3
+mov #25, L581
+L550: mov r5, r6
+L551: jsr *r5
+red L378
+cmp r1, *r6
+L552: rts
+L553: stop
+prn #-226
+L554: lea L602, L309
+L555: .string "yvnw"
+sub L277, L614
+L556: .string "dntabp"
+L557: .data -308, 868, 386
+L558: cmp *r4, r1
+L559: lea L456, r5
+L560: jsr L585
+jsr L611
+; comment
+L561: not *r0
+jmp *r0
+L562: not *r3
+L563: mov r0, L416
+; comment
+L564: sub #-193, *r2
+stop
+L565: rts
+L566: lea L246, *r4
+L567: red L572
+red r0
+dec *r6
+L568: jmp *r2
+L569: not L611
+L570: .data 222, 912, 33, 555
+L571: add #-49, *r7
+inc L237
+
+L572: prn #-38
+L573: rts
+mov r7, *r7
+L574: mov r2, *r3
+L575: .data -213
+L576: jsr L603
+L577: dec L604
+L578: inc L505
+L579: jmp *r6
+L580: lea L38, L556
+bne *r4
+L581: red L604
+L582: mov #111, *r3
+bne *r3
+add L610, r6
+jsr L606
+L583: inc L595
+L584: sub #-174, *r5
+; comment
+L585: dec L46
+L586: cmp #86, L125
+cmp r3, r1
+mov L162, *r2
+L587: not L566
+jsr *r2
+inc *r7
+L588: stop
+L589: sub r2, L573
+sub r5, r2
+L590: mov #197, *r4
+lea L599, r3
+; comment
+L591: not *r4
+inc *r5
+L592: jmp *r3
+lea L293, L613
+sub L597, L597
+L593: mov *r7, r2
+inc L497
+L594: rts
+L595: inc r2
+not *r6
+L596: sub L599, r3
+; comment
+; comment
+L597: cmp *r7, *r6
+jsr *r1
+L598: jsr *r1
+L599: .string "gxvdsiwxtobxenyq"
+L600: cmp *r5, L398
+L601: .string "xsh"
+L602: .data 293
+L603: prn #57
+L604: .data -758, 190, -888, -474, 405
+L605: .data 572, 410, 971, -271, 79, 35
+L606: mov *r2, *r4
+not L612
+L607: add L485, r1
+
+red L2
+L608: rts
+cmp #-249, #222
+L609: stop
+stop
+L610: bne L250
+L611: prn r2
+L612: .string "iauuowhhd"
+add r6, L73
+
+L613: not L615
+clr r7
+mov L615, L615
+L614: add *r6, r1
+bne *r0
+lea L0, L552
+add #28, L615
+L615: stop
+cmp *r2, r3
+stop
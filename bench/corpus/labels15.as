@@ -0,0 +1,1040 @@
+; Generated by genCorpus --seed 16
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+L0: sub #29, *r0
+prn #-33
+red L11
+L1: add #-178, L380
+L2: sub #-204, L192
+L3: prn r3
+dec r3
+L4: prn L0
+L5: dec L2
+L6: not r5
+L7: mov L7, L209
+L8: not *r5
+L9: add *r1, *r4
+L10: add #136, r3
+L11: red r1
+L12: sub *r3, *r3
+L13: red L11
+L14: sub L7, L12
+L15: dec L502
+L16: .string "bvcxpfxnwxrgguylzei"
+L17: bne L17
+L18: .string "zcrvavaakxnidynfln"
+L19: cmp *r5, #21
+inc r3
+L20: .string "rksrnwsmdkxqujlmm"
+L21: not L7
+add #-30, r0
+rts
+clr r1
+L22: cmp L21, r5
+jsr L123
+L23: cmp r2, r1
+L24: rts
+rts
+stop
+add r6, L496
+L25: not L512
+; comment
+L26: .data -95, -782, -335, -319, -385, -743
+L27: red *r3
+L28: jsr L14
+L29: dec L16
+L30: not L1
+L31: stop
+cmp #160, *r2
+L32: rts
+not r1
+L33: clr r1
+L34: rts
+L35: dec r4
+L36: jsr *r5
+mov *r4, *r7
+L37: cmp L31, L44
+L38: prn r0
+L39: rts
+L40: not *r1
+red L40
+L41: jmp L0
+L42: mov L26, *r2
+red *r7
+L43: sub #-151, L40
+inc L25
+L44: lea L409, *r0
+; comment
+L45: stop
+clr L39
+L46: sub #116, *r4
+L47: add *r7, L4
+L48: prn #47
+L49: bne *r7
+red L27
+L50: add *r5, r3
+; comment
+stop
+cmp r0, r5
+L51: rts
+L52: inc *r3
+lea L29, r5
+L53: stop
+L54: clr *r2
+rts
+not L503
+mov #-252, *r4
+L55: jsr L43
+L56: jsr *r2
+jsr *r2
+L57: red *r2
+jsr *r1
+not r0
+L58: .string "lfyrpaxgcs"
+sub r3, r4
+L59: prn r2
+L60: inc L273
+L61: sub r3, r3
+stop
+L62: mov *r5, r2
+lea L452, r4
+L63: prn L314
+
+L64: clr r4
+L65: clr r6
+lea L1, L46
+L66: jsr L277
+rts
+; comment
+red r4
+L67: .data -180, -178, 579, 837, -840, 547
+L68: dec r3
+L69: bne *r0
+L70: mov #-124, *r1
+prn L277
+sub *r3, L32
+L71: add *r0, *r1
+L72: .data 271, -535, 794, 498, 245
+sub L72, *r1
+L73: prn L72
+L74: rts
+L75: bne *r4
+stop
+L76: rts
+mov *r3, *r0
+stop
+L77: clr *r4
+L78: inc *r6
+L79: lea L38, *r2
+L80: rts
+L81: jmp L221
+lea L205, r5
+cmp L67, r3
+L82: prn r0
+add L65, L22
+L83: not *r2
+add #13, *r1
+mov L159, L124
+prn L64
+L84: lea L526, r5
+bne *r7
+L85: jmp *r4
+L86: .string "kchejpp"
+dec r6
+L87: mov #-114, *r3
+L88: stop
+L89: inc L218
+add r7, r3
+L90: lea L64, L72
+L91: .data -489
+L92: bne L564
+L93: prn #-135
+mov #-124, L523
+stop
+L94: not r2
+L95: lea L233, L465
+L96: dec L312
+L97: rts
+L98: rts
+jmp L35
+clr r0
+L99: stop
+L100: .string "esjikygucsxcjfhscj"
+stop
+L101: clr L3
+L102: clr r1
+L103: mov #115, r7
+L104: jsr L76
+L105: sub #6, *r3
+L106: sub L66, *r3
+dec *r6
+L107: dec L22
+rts
+dec r5
+dec r6
+L108: add L167, r0
+L109: .string "beybzofvcuj"
+bne *r7
+L110: stop
+jmp L53
+
+L111: sub *r5, r2
+L112: lea L90, *r1
+L113: lea L312, r4
+L114: inc *r5
+add *r5, *r2
+not *r6
+
+rts
+L115: .string "eil"
+L116: lea L108, L50
+L117: red *r7
+stop
+L118: sub L24, r1
+prn #-94
+dec L473
+inc L84
+not *r1
+L119: sub #51, L16
+L120: jsr L4
+prn r2
+L121: inc r4
+L122: rts
+L123: rts
+L124: clr r6
+L125: add L22, *r6
+red *r1
+L126: clr r4
+clr L112
+L127: jmp *r5
+L128: .data -678, 657, -185, 722, -807
+sub L168, r6
+dec L603
+sub r7, L172
+jsr L576
+cmp #-226, *r5
+L129: .data 474, 848, -414, -142, 35
+mov r4, L111
+L130: sub L112, *r6
+L131: sub *r3, L530
+L132: mov *r7, r1
+L133: not L115
+L134: dec r3
+red r5
+bne *r6
+L135: inc r5
+L136: lea L12, L15
+L137: dec r3
+rts
+dec *r6
+mov *r4, L419
+inc *r3
+L138: mov *r2, r3
+L139: mov #40, L172
+L140: sub #-134, L21
+
+sub r6, L29
+L141: prn r2
+L142: red r3
+L143: not *r2
+L144: cmp L347, L265
+dec L372
+lea L543, *r5
+red *r0
+L145: mov r4, *r3
+rts
+L146: not *r2
+lea L241, r1
+L147: dec L201
+inc r5
+L148: bne L2
+jmp L47
+L149: clr *r1
+L150: sub L114, r3
+L151: .string "mmdvkgbdgy"
+L152: sub #-65, r2
+bne L407
+L153: mov #167, r1
+inc L292
+L154: bne *r3
+L155: prn L536
+rts
+lea L529, r1
+rts
+L156: jsr *r1
+L157: bne L388
+L158: dec *r4
+L159: jmp *r7
+cmp r4, r5
+red L48
+L160: lea L122, L149
+red r7
+L161: .data -413, 86, -321, -29
+L162: jmp *r5
+add r7, *r2
+L163: stop
+bne *r2
+L164: sub *r2, *r3
+L165: rts
+inc r7
+sub #-18, *r2
+L166: clr r5
+
+L167: not r5
+L168: red L87
+L169: inc r3
+lea L108, *r1
+; comment
+L170: dec r2
+L171: .data -58, -992, -226
+prn L471
+L172: prn #169
+inc *r2
+L173: prn r1
+rts
+L174: prn L532
+L175: .string "of"
+L176: not *r1
+L177: .string "q"
+L178: clr r4
+L179: bne *r6
+L180: .data -516, 70, 750, 471, 30, -334, 38, 502
+L181: cmp L63, *r4
+
+L182: red *r1
+L183: mov L55, L89
+L184: stop
+jmp L56
+red *r1
+L185: bne *r7
+L186: rts
+
+prn L132
+mov #-72, *r4
+; comment
+L187: lea L361, r2
+L188: red L54
+L189: clr *r1
+not *r2
+L190: dec L32
+L191: jmp L41
+
+; comment
+L192: sub r3, r7
+L193: jsr *r0
+L194: red r2
+L195: jsr *r1
+prn L107
+L196: clr L373
+L197: jsr L171
+L198: .string "xfcjhwpuqlmuksvj"
+L199: inc *r6
+L200: .data -358, 173, 970
+cmp *r4, #99
+L201: inc *r1
+jsr *r2
+inc L227
+L202: add r7, r1
+prn #85
+L203: .string "dhnhyyof"
+L204: dec *r4
+L205: jsr L14
+L206: bne *r4
+L207: dec *r5
+L208: .string "ekqyspqncshzcjcchy"
+L209: lea L209, L597
+prn #125
+prn L528
+jmp L188
+L210: rts
+L211: sub L44, *r7
+jsr L549
+L212: sub r4, *r1
+sub L398, L404
+L213: rts
+L214: red r4
+dec *r3
+L215: inc *r6
+L216: dec L430
+lea L473, *r4
+cmp L162, L279
+L217: .data -299, -818, -175, -502, -460, 941
+bne L183
+L218: bne *r5
+rts
+bne L510
+L219: mov *r5, r5
+L220: .string "tulpxbwuchkdulxeiyvyxu"
+L221: clr L539
+L222: lea L84, *r2
+stop
+L223: .string "iqleffrjhsqehwqyldqg"
+bne L217
+L224: red *r1
+L225: dec r5
+L226: bne *r4
+mov r6, r2
+stop
+dec *r6
+mov #152, L491
+L227: lea L118, r3
+L228: inc *r0
+L229: red L144
+L230: lea L124, r4
+; comment
+L231: jmp *r3
+L232: .data -867, 548, -574, 708, 177, -310, 453, 335
+L233: jmp *r3
+dec L253
+mov *r4, r5
+L234: lea L230, L274
+L235: jsr *r3
+
+L236: .data 365, -817
+L237: bne *r3
+L238: clr r2
+L239: cmp r2, #19
+L240: cmp #-202, r3
+jmp *r5
+L241: .string "tolpvzjfrj"
+L242: bne *r6
+clr r3
+L243: jmp *r2
+L244: not *r0
+L245: .string "velbzagalxuzncjcmh"
+L246: .data 866, -796, 471
+L247: prn L422
+prn L126
+L248: .string "jpwccmhcbswkcna"
+L249: dec *r5
+L250: cmp L277, *r2
+L251: add r7, *r2
+L252: lea L368, L391
+L253: .string "bgmlidaytoaluaodlhibzskm"
+L254: .data 144, 928, -209, 237
+L255: .data -799, -522, 276, 855, 466, -807
+sub r7, r2
+lea L371, *r3
+L256: add r3, r7
+mov L358, *r3
+L257: .string "hyaxvmjdrvibmgbqgntslzs"
+L258: cmp L441, *r6
+L259: stop
+cmp L593, #242
+L260: rts
+add #-126, L193
+L261: .string "elotdyhkrvbhkrypov"
+red L441
+prn #-91
+L262: .string "eznighexzfikjvgvr"
+
+; comment
+L263: add #-198, r2
+lea L36, L378
+dec *r3
+rts
+clr r6
+; comment
+cmp L46, r2
+prn L446
+L264: jsr *r4
+
+L265: rts
+L266: .string "uouizqkkdqevufuyrxtucq"
+L267: .data 314, 635, 312, -987, -860, -142
+red L245
+rts
+L268: prn #116
+L269: jsr *r4
+L270: .data 938, -820, -965, -770, -164, -197, -993
+jsr L471
+L271: add *r3, r7
+L272: rts
+L273: stop
+L274: not L420
+L275: .string "dmzwb"
+L276: dec L500
+L277: .data 217, 119, 56, 513, -788, 32
+bne L10
+clr *r2
+dec L409
+L278: lea L108, *r6
+L279: .string "afslqgbe"
+
+L280: jmp L558
+L281: add #89, *r7
+L282: .string "sz"
+L283: stop
+L284: .data -245, 873, -465
+L285: cmp r0, *r1
+L286: cmp r4, #239
+dec r3
+bne L83
+L287: .data -484, 652, -22, -916, 160, 276, 214
+L288: red r1
+red L187
+L289: stop
+L290: bne *r5
+inc L213
+L291: red *r2
+L292: rts
+L293: dec *r0
+L294: .string "kkzitktsfuyavozduhzunfo"
+L295: lea L166, r1
+rts
+L296: add r5, *r1
+L297: .data -933, 242, -213, 870, 258
+inc L34
+L298: add L516, L509
+inc L308
+L299: rts
+add *r4, L277
+sub *r6, *r1
+L300: lea L183, r2
+L301: rts
+sub #-35, r3
+L302: add L470, r4
+L303: lea L246, r3
+L304: dec r5
+L305: .string "ptzaaewwzwohgzalbjriaq"
+L306: stop
+cmp *r6, #56
+L307: cmp *r2, #-246
+L308: jmp *r0
+rts
+L309: .data -256
+L310: sub #78, L454
+L311: dec *r3
+bne *r1
+red L509
+L312: stop
+L313: prn *r4
+red L587
+L314: jmp L322
+L315: add *r0, *r3
+L316: stop
+L317: rts
+L318: bne *r5
+L319: jmp L592
+not *r4
+red *r6
+L320: jsr *r5
+inc L507
+L321: clr *r6
+L322: rts
+L323: jsr L373
+L324: jsr *r2
+L325: add #254, r3
+bne *r2
+not *r3
+L326: jsr *r6
+L327: add r2, *r7
+L328: dec r2
+L329: mov #-254, r6
+L330: sub *r1, L5
+L331: .string "jzevbxnyhlbrncce"
+L332: cmp *r1, #70
+prn #186
+jsr *r1
+L333: .data -528, 834, 423, -140
+rts
+L334: red r3
+L335: stop
+L336: sub L352, r7
+dec *r6
+L337: not r5
+L338: cmp L472, L585
+L339: dec *r4
+L340: jsr L365
+red r2
+L341: stop
+L342: add *r4, L572
+add r2, *r7
+L343: stop
+L344: jsr L521
+L345: cmp r5, L292
+bne L222
+rts
+L346: clr L302
+jsr *r7
+L347: .string "heycckmjkgyqph"
+L348: mov #75, *r4
+rts
+not r1
+add *r2, *r4
+not r7
+L349: .string "lhvoimhnseb"
+L350: add L489, *r2
+jmp L267
+L351: bne L578
+L352: .string "im"
+L353: add L418, *r0
+clr r7
+
+cmp r5, #250
+L354: .string "naqstaodhunij"
+L355: dec r1
+L356: red *r4
+L357: not L396
+clr *r7
+L358: .string "sokmevnjzxvrpmkudst"
+L359: lea L245, *r6
+jmp L329
+L360: dec *r3
+L361: rts
+L362: rts
+L363: jsr *r2
+L364: inc *r6
+L365: stop
+L366: .string "yxklvwdh"
+L367: dec *r1
+L368: cmp #141, r4
+L369: bne *r7
+inc *r4
+L370: dec L366
+L371: prn r3
+jmp *r1
+cmp *r0, #-228
+L372: clr r1
+jmp *r0
+mov *r1, L45
+dec *r5
+L373: bne *r0
+L374: clr r0
+L375: lea L501, L128
+prn L426
+L376: dec L327
+rts
+add L537, L489
+L377: dec r7
+red *r5
+L378: red *r3
+lea L15, r2
+L379: .data -441
+L380: jsr *r3
+L381: .string "zsg"
+L382: red r6
+jsr *r3
+L383: stop
+prn *r5
+mov *r1, *r5
+L384: not L359
+jmp L255
+L385: jmp L457
+L386: .data 989, -545, -399, -695, -4, -657, 189
+L387: cmp *r3, L171
+L388: mov L390, r0
+L389: clr *r2
+bne L130
+L390: bne L223
+not r3
+mov r4, *r7
+L391: lea L39, *r0
+dec r5
+bne L128
+L392: dec *r0
+rts
+L393: red r2
+L394: mov #-82, r2
+cmp r6, r5
+dec r1
+L395: jmp L83
+dec L484
+L396: mov *r4, L1
+L397: stop
+
+lea L551, r7
+sub #133, *r1
+L398: mov L286, L286
+L399: add *r7, *r3
+L400: cmp *r5, *r3
+dec L577
+L401: clr L397
+L402: red *r1
+L403: prn r3
+dec L282
+jsr *r1
+L404: add L470, *r7
+sub L501, r0
+L405: bne L183
+; comment
+lea L109, r5
+lea L475, L60
+mov *r6, *r0
+L406: jsr *r6
+jmp L600
+
+add #129, L249
+L407: add *r7, L28
+L408: rts
+L409: .string "vfjdzapt"
+prn L107
+clr *r6
+mov #-223, r1
+L410: cmp L299, L508
+L411: clr L419
+red *r6
+L412: rts
+; comment
+prn #-191
+prn r6
+mov #-245, r0
+L413: inc r7
+L414: inc L361
+L415: stop
+; comment
+inc r2
+L416: sub *r1, L569
+L417: .data 457, -820, 530
+rts
+L418: rts
+jmp *r5
+L419: rts
+sub #-248, r0
+not L120
+L420: rts
+L421: prn r2
+inc r1
+L422: prn *r1
+L423: mov L337, *r6
+rts
+L424: mov r3, *r5
+L425: add *r0, *r3
+
+L426: mov #-66, L504
+L427: rts
+L428: prn r2
+dec *r5
+jsr *r5
+mov #122, L562
+L429: jmp *r0
+L430: mov *r7, *r4
+L431: cmp *r7, L551
+inc r1
+L432: cmp #-139, L561
+prn *r3
+L433: prn #55
+L434: stop
+L435: cmp #91, *r6
+jsr *r2
+; comment
+L436: jmp L59
+L437: lea L604, L291
+; comment
+L438: .data 876, -70, 744, 246
+sub *r1, *r6
+bne L586
+; comment
+not r6
+L439: .data -933, 698, 512, 674, -742, 864, -382
+L440: sub *r7, L446
+dec r2
+L441: clr L431
+L442: stop
+L443: .data -483, 920, 326, 525, 436, 715, 619
+add #-115, L574
+L444: jmp *r0
+L445: lea L491, L595
+L446: lea L558, *r6
+L447: inc L248
+L448: dec r2
+jmp *r1
+; comment
+dec r7
+rts
+L449: sub r5, *r2
+cmp r6, *r7
+L450: clr L459
+; comment
+
+; comment
+bne L594
+prn #56
+L451: jmp L50
+L452: .data -732, 661, 214, 680
+L453: .data -328, -762
+inc *r6
+L454: prn #55
+L455: add *r5, r5
+L456: clr *r5
+inc *r0
+L457: sub #24, L603
+L458: lea L532, r3
+L459: red *r1
+L460: mov *r6, *r4
+L461: .string "hwlwjvkmjjejhxgaxqilw"
+clr r5
+L462: dec *r2
+L463: jmp *r7
+L464: bne *r0
+L465: cmp r6, #-129
+L466: .data 10
+L467: stop
+L468: stop
+L469: stop
+not r6
+L470: add *r3, L528
+L471: clr *r5
+L472: not r3
+L473: sub r2, r0
+dec L478
+L474: stop
+L475: .string "zzktsvlqojwjtogvowexbjg"
+L476: add L588, r4
+L477: mov L433, r2
+L478: .data 974, 410
+rts
+L479: mov *r3, *r4
+L480: .string "lyajfcbdwoufjawlbrb"
+cmp L457, *r4
+L481: jmp *r3
+bne L309
+L482: clr *r2
+not r4
+stop
+L483: dec r6
+inc r1
+L484: bne L597
+dec L605
+red *r6
+sub *r7, *r6
+L485: .string "kjdzv"
+not *r6
+bne L336
+L486: dec *r6
+L487: sub L281, *r7
+L488: .data -233, 26, -779, 587, 852, 201, 379, 42
+L489: .data 209, -580, -772, 247, -923, -899, -457, -796
+mov #-28, r7
+L490: add *r6, *r5
+L491: jmp L554
+; comment
+L492: add L179, r3
+sub *r6, r1
+L493: red L509
+sub r1, L529
+not *r0
+L494: jsr L204
+dec *r5
+L495: not r3
+L496: jsr *r6
+lea L581, L591
+L497: sub r2, r5
+L498: dec L470
+L499: clr *r3
+
+L500: stop
+L501: prn r7
+clr r4
+inc r6
+prn *r3
+L502: clr L220
+rts
+L503: not L553
+L504: prn r2
+inc r6
+add *r3, L579
+L505: sub *r1, *r5
+
+L506: bne *r6
+L507: red r4
+L508: dec L577
+L509: dec *r7
+jsr *r5
+L510: .data -472, -246
+L511: not *r1
+L512: inc r4
+clr r4
+L513: lea L511, L592
+
+rts
+bne *r2
+L514: not L423
+L515: prn *r7
+L516: inc r5
+L517: .string "cxpqrttakyjmu"
+L518: cmp #45, #18
+mov *r1, L560
+mov r5, L237
+L519: jsr *r5
+L520: dec *r6
+L521: .string "ytwltdhlccwjgznjtapuyn"
+L522: .string "tyosptxmvyzar"
+L523: bne L589
+rts
+red *r3
+L524: stop
+red *r4
+L525: cmp *r6, L451
+; comment
+L526: dec r6
+L527: cmp r7, r1
+L528: jsr L120
+L529: add L288, *r4
+L530: cmp r7, #142
+L531: mov L143, r6
+not L594
+lea L561, L518
+L532: jmp L485
+stop
+L533: clr *r7
+stop
+lea L571, r1
+L534: jsr *r1
+dec *r7
+; comment
+bne L591
+L535: prn L599
+L536: .data -365, 265, 520, -256, 320, -882, -653, 967
+L537: .data 675, 464, -403, 556, 316, -38
+L538: not L545
+bne *r3
+L539: .string "turdhheejwxtlkgra"
+add #56, *r1
+; comment
+stop
+L540: add r4, *r0
+jmp L559
+L541: prn *r3
+L542: jmp *r0
+L543: not *r7
+L544: bne *r4
+L545: sub r3, *r3
+L546: jsr *r3
+L547: rts
+L548: red *r1
+L549: jmp L585
+L550: prn L572
+L551: rts
+inc L233
+L552: clr *r4
+clr r0
+
+L553: prn r7
+L554: jsr *r5
+add r6, r0
+sub L282, L556
+L555: .string "jmbwrockgrjrurhvcojlmku"
+L556: add *r1, L563
+clr *r2
+L557: dec r7
+
+lea L565, r7
+L558: not *r7
+L559: .string "rbcsib"
+sub r1, *r6
+L560: mov *r2, L600
+L561: dec L329
+L562: .string "hapnmdgyrmotuvjhm"
+L563: clr L405
+
+L564: jsr *r6
+L565: mov L593, L389
+L566: cmp L175, L324
+L567: .string "qxrtmp"
+; comment
+inc r5
+L568: jmp L334
+bne *r6
+jmp *r6
+L569: .string "lrmbj"
+L570: add #-107, r7
+L571: sub L266, *r0
+prn *r6
+sub r2, r6
+jsr *r5
+jsr L584
+dec r5
+mov r5, *r4
+L572: jmp *r7
+prn #-208
+L573: sub r2, r3
+mov L459, r4
+L574: not *r3
+add #-181, L582
+lea L597, L595
+L575: clr L99
+L576: jmp *r3
+jsr L599
+L577: .data 775, 904, -603, 578, 903
+red L586
+L578: .data -962, 932, 925, -55, -698, -418, -909
+L579: clr r1
+L580: add *r2, L230
+L581: jmp L161
+L582: stop
+L583: .data 300, -412, -25, 339, 54, -887
+L584: inc r3
+stop
+L585: not L586
+L586: stop
+cmp *r4, *r2
+L587: clr L589
+add #146, *r7
+cmp #50, #-90
+inc r6
+lea L573, L591
+L588: add L371, L601
+cmp r3, r3
+L589: dec L260
+stop
+L590: prn L593
+L591: lea L592, *r4
+jmp L597
+L592: rts
+L593: red r7
+L594: .string "xothqfkatcpxoszftss"
+L595: jsr *r6
+L596: add #207, r2
+L597: jsr L469
+L598: mov L191, r3
+add *r5, r0
+bne L154
+
+L599: stop
+L600: clr L100
+add #251, L601
+L601: dec L174
+L602: sub L348, *r3
+L603: lea L253, L51
+L604: add L605, r5
+L605: sub r2, L606
+stop
+L606: not r3
+stop
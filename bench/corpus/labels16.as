@@ -0,0 +1,1041 @@
+; Generated by genCorpus --seed 17
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+L0: .string "zqsazbixdcfejuod"
+L1: add L1, r2
+jmp L160
+L2: jmp L0
+L3: mov *r1, *r5
+L4: not r1
+dec L4
+mov #-200, L583
+L5: inc L4
+L6: clr r5
+L7: red r5
+L8: .string "hedqwbcrlpdlbvkhrysr"
+L9: rts
+L10: bne L6
+bne L2
+L11: sub *r6, *r7
+L12: clr *r6
+dec *r1
+red r6
+L13: .data 423, -634, -44
+dec r7
+L14: sub #-145, r7
+L15: .data 534
+L16: dec *r3
+L17: prn #60
+L18: lea L500, L275
+L19: prn r3
+L20: .data -453, 511, -367, -617
+dec r6
+L21: .data 28, 161, 978, 286
+L22: cmp #130, #-50
+dec r4
+L23: inc *r3
+clr L177
+not L21
+not *r2
+L24: add *r0, *r7
+L25: inc r2
+L26: add L10, r7
+
+L27: jmp *r0
+L28: add #78, r3
+L29: stop
+L30: red L14
+; comment
+sub r0, L359
+dec L27
+L31: jmp L13
+stop
+not *r2
+sub *r5, *r4
+jmp L281
+L32: lea L30, L23
+dec *r0
+L33: .data 803, 858, 868, -10, 384
+L34: sub r2, *r1
+L35: jmp L5
+add L35, L12
+L36: red r7
+L37: sub r0, r6
+add #-185, *r1
+stop
+L38: dec L9
+L39: not r1
+dec L212
+L40: not L136
+L41: clr L27
+add *r2, *r0
+jmp *r3
+sub L429, *r4
+mov #-188, *r2
+dec *r4
+L42: jsr *r3
+L43: cmp #82, #251
+jsr L32
+L44: jmp *r5
+L45: inc *r2
+L46: red *r7
+L47: not r6
+L48: add r5, r0
+L49: .data 387, -266, 493, -68, -949
+L50: rts
+L51: mov #25, r2
+L52: mov #-102, L336
+L53: not r3
+; comment
+L54: add r7, L4
+L55: .data 93, -951, -800, -680, -305, 690, 257
+L56: jmp *r0
+
+bne *r6
+dec *r0
+not L165
+stop
+L57: prn #-28
+L58: .string "joqiskcrsrlstcjuc"
+L59: cmp r1, L515
+L60: add r2, *r2
+L61: jsr L509
+bne *r1
+L62: lea L0, *r7
+L63: not *r4
+L64: jsr *r0
+
+red r0
+lea L30, L51
+clr L336
+L65: dec L20
+not *r1
+add *r7, r1
+bne *r4
+L66: not *r7
+L67: cmp #205, #236
+L68: jsr *r7
+red r0
+L69: mov #-36, *r2
+L70: jsr L581
+L71: red *r7
+L72: dec L32
+mov #-127, L18
+add r6, r3
+jmp L245
+rts
+L73: not L1
+L74: cmp r6, *r1
+L75: stop
+L76: .data 115
+bne *r4
+bne *r0
+L77: .data 946, 48, -85, 281, 315, 496
+L78: add r6, r6
+red L445
+L79: cmp r5, r2
+add #37, L6
+L80: .data 688, -430, 753, -144, -124, -959, 408
+L81: jsr L74
+cmp *r3, L0
+prn *r1
+L82: prn #-84
+red *r1
+prn r1
+L83: cmp #14, #11
+not r4
+; comment
+L84: mov L39, *r2
+L85: stop
+stop
+L86: stop
+clr *r1
+L87: .data 936, 745, 977, -878, -959, 510, 294, -797
+L88: add #-89, L522
+prn *r7
+prn r0
+L89: bne *r2
+L90: clr L199
+L91: stop
+L92: lea L383, r4
+L93: jsr *r1
+rts
+L94: jsr L86
+cmp r5, #-22
+L95: sub *r4, L75
+L96: red *r5
+L97: sub L63, L372
+mov #-72, *r1
+L98: .string "rcbvzdwohcklzqdxeit"
+jsr *r0
+L99: add #158, L86
+L100: jmp *r3
+
+L101: mov #87, L71
+L102: red r2
+L103: rts
+L104: sub L500, L621
+L105: .data 985
+L106: .data 525, -38, -248, -137, -838, 407, -708
+L107: cmp *r6, #83
+L108: red r4
+clr *r6
+cmp *r7, *r0
+red *r4
+not L56
+clr r6
+jmp L244
+L109: dec r0
+jmp L80
+L110: not r5
+prn #-256
+L111: rts
+bne L75
+not *r1
+L112: prn r0
+sub L56, r5
+L113: .data 677, -93, -119
+mov r1, *r6
+L114: clr *r7
+L115: lea L127, L214
+add r4, r5
+rts
+
+
+L116: red r4
+L117: add r5, r0
+L118: jsr L40
+L119: .string "sva"
+L120: jsr L112
+L121: prn r6
+red *r4
+jsr *r3
+jsr L117
+L122: red L56
+L123: clr L90
+lea L328, *r2
+L124: red *r5
+cmp #7, L120
+L125: mov r2, r1
+L126: add *r0, *r4
+L127: mov *r1, r3
+L128: not L240
+L129: stop
+jmp *r3
+lea L81, *r1
+L130: jmp L320
+
+L131: inc r0
+bne *r5
+L132: prn L74
+lea L3, L601
+L133: rts
+L134: .data 475, 522
+L135: dec *r2
+L136: sub r7, r3
+prn #124
+L137: jsr L255
+L138: jsr L213
+L139: jmp L112
+L140: dec r4
+L141: dec r7
+L142: jsr *r5
+L143: mov *r4, *r2
+L144: not L122
+clr L111
+
+; comment
+L145: not *r2
+
+L146: clr *r1
+stop
+bne *r4
+L147: dec L124
+L148: lea L61, L513
+L149: add L418, *r5
+L150: not L77
+jmp *r3
+jmp L65
+mov L522, *r6
+L151: not L18
+L152: mov #-32, r1
+jmp L131
+L153: prn L475
+L154: rts
+L155: dec *r0
+L156: .string "ktitwjrb"
+dec r7
+inc L472
+L157: jsr *r6
+L158: red *r1
+bne L30
+red r4
+L159: clr *r6
+L160: not r7
+L161: sub *r6, *r6
+L162: .data 737
+L163: .string "xeb"
+L164: add r1, *r5
+L165: prn #-24
+L166: clr *r1
+L167: not *r5
+L168: not *r2
+jmp *r7
+L169: cmp L133, L583
+L170: add r7, L412
+L171: add #-166, *r5
+L172: clr L6
+L173: red L605
+; comment
+L174: rts
+L175: mov #135, *r5
+L176: jsr L472
+lea L166, *r2
+L177: .data 583, -145, -423, 510, 468, 455, -684
+L178: add L31, *r0
+clr r3
+sub r1, *r5
+L179: jsr *r2
+L180: red r6
+not r7
+L181: mov *r3, r1
+add *r4, *r4
+L182: inc L548
+prn *r1
+rts
+L183: sub L608, *r0
+jsr *r5
+L184: add *r2, L259
+L185: not r7
+L186: .data 419, -203, -513, 263, -636, 644
+L187: inc r4
+L188: bne *r1
+L189: rts
+L190: sub #-28, *r2
+L191: jsr *r2
+L192: mov r7, *r6
+L193: red *r7
+L194: mov L176, r4
+L195: dec r1
+inc L95
+L196: add L150, *r1
+
+L197: inc L561
+prn r5
+L198: .string "z"
+L199: prn L342
+L200: red r2
+L201: jsr L291
+L202: .data 900, 230, 215, -3, -619, 32, -333
+L203: .data 879, 47, -346, 766
+L204: red *r0
+add #-81, *r2
+; comment
+L205: prn *r5
+L206: lea L150, r5
+L207: .string "cmmnytczgzpdljwvtn"
+L208: add r5, L147
+L209: cmp L37, r7
+lea L510, r1
+L210: .data -739, -41
+L211: not r7
+
+L212: inc *r7
+L213: jsr *r7
+L214: cmp *r5, #246
+L215: lea L436, r3
+
+not r0
+L216: mov L566, *r1
+rts
+cmp *r4, L437
+L217: bne *r2
+L218: sub *r5, *r1
+L219: jsr L143
+rts
+L220: inc L379
+L221: sub L261, L430
+L222: red r1
+cmp r5, r2
+L223: dec r6
+red *r3
+prn r2
+L224: red *r4
+L225: jmp L225
+jmp *r2
+L226: add r0, L365
+L227: .data 669, -791, 939, -497, 623
+L228: stop
+L229: jsr *r2
+; comment
+stop
+L230: jsr *r0
+L231: dec r2
+L232: sub #-31, *r2
+L233: cmp r7, *r3
+not L83
+L234: not *r7
+L235: inc r0
+L236: lea L176, *r4
+L237: .string "wxbfuvaudtiyrnum"
+L238: red r7
+L239: not L450
+L240: lea L558, L92
+L241: cmp r4, r3
+cmp *r7, L493
+L242: add *r6, L586
+lea L498, L114
+L243: dec r6
+L244: cmp *r1, #-234
+
+L245: jmp *r1
+add *r1, r6
+
+L246: mov #-64, *r4
+L247: cmp r1, r6
+L248: jsr *r2
+L249: prn *r3
+prn #58
+L250: .string "wykbxredzfjtebd"
+L251: bne L421
+inc L56
+L252: jmp L252
+L253: red r5
+L254: jmp *r1
+rts
+jsr *r0
+L255: rts
+stop
+not L36
+L256: cmp L263, r0
+L257: prn L137
+L258: bne L161
+inc r2
+
+L259: prn L233
+L260: inc r5
+L261: red L545
+L262: .data 109, -956, 23, -261, -568, 286
+L263: jmp L88
+L264: jmp *r7
+L265: red *r7
+
+clr r7
+stop
+L266: add #62, r0
+L267: not r6
+L268: dec r7
+L269: not r7
+L270: jmp L309
+L271: mov L584, L348
+L272: stop
+red r6
+bne L335
+jmp L254
+L273: .string "csqrarrtilwccwdnbem"
+inc *r1
+L274: dec L326
+L275: jmp L163
+sub r1, *r7
+L276: bne L500
+lea L571, *r6
+; comment
+L277: .string "rjiodtaunxjrkwwe"
+L278: lea L121, *r0
+L279: .data -229, 32, -981, 433, -172
+L280: inc *r1
+dec r7
+L281: not L51
+sub L146, r1
+L282: red L162
+L283: red *r3
+L284: cmp #144, L147
+L285: bne L421
+L286: stop
+L287: bne L484
+L288: clr *r1
+L289: .data -22, -915, 633
+mov *r2, r6
+jmp L193
+L290: .string "gqdcbcoebbphg"
+L291: add L249, L35
+L292: lea L559, *r7
+rts
+mov *r2, *r5
+L293: inc L281
+L294: cmp L538, L473
+L295: dec r7
+L296: bne L194
+L297: sub r1, *r4
+L298: .data -18
+cmp L232, r2
+L299: cmp #-34, *r3
+L300: rts
+bne L608
+dec r2
+L301: clr *r1
+L302: prn #-182
+L303: clr *r2
+L304: cmp *r5, L37
+
+inc *r7
+L305: rts
+mov #-112, *r1
+inc *r7
+L306: stop
+cmp L437, r6
+L307: stop
+L308: rts
+; comment
+L309: lea L222, r2
+prn r2
+L310: lea L202, L404
+L311: clr *r0
+jsr *r6
+cmp *r7, *r7
+L312: add #47, *r3
+L313: sub #-70, r6
+L314: clr *r1
+L315: not r2
+L316: sub *r1, r4
+L317: jmp L491
+L318: cmp #49, #-41
+L319: cmp r5, L501
+L320: .data -141, -649, -93
+L321: stop
+L322: .data -687, 570, 135, -6, -611, -101, -227, -379
+L323: lea L192, r0
+jmp L45
+L324: add L267, L262
+not r0
+
+L325: add r7, *r6
+L326: inc r5
+L327: clr r6
+L328: lea L609, *r2
+L329: dec r3
+L330: jmp *r6
+mov *r7, r4
+L331: inc r6
+L332: cmp #54, L487
+L333: prn #152
+clr L58
+L334: inc r3
+L335: .string "kggrpnlgayszncbtzn"
+cmp #92, L166
+inc *r7
+add #-208, L360
+
+L336: prn *r4
+sub #-118, r7
+L337: jsr L203
+L338: jmp L501
+; comment
+L339: dec r5
+L340: not *r4
+L341: jsr L138
+L342: inc L304
+L343: rts
+red *r0
+L344: lea L445, *r7
+jmp L245
+L345: rts
+bne *r6
+mov #144, r1
+L346: mov L186, r5
+L347: cmp #-94, *r1
+stop
+L348: prn #253
+red L606
+clr *r0
+L349: not L333
+
+L350: .string "qwakwxsjjrvrif"
+bne *r5
+L351: bne L392
+L352: .data -594, 957
+L353: lea L155, *r0
+L354: .data -945, -520, -213, 382, 355
+inc L339
+not *r2
+L355: .string "lw"
+cmp #-34, r2
+jmp *r4
+L356: prn r4
+L357: .string "abzzghbtbf"
+rts
+jsr *r0
+L358: clr r5
+prn *r1
+L359: jsr L92
+L360: prn #-200
+L361: red L23
+L362: stop
+L363: sub r4, r7
+L364: red *r1
+L365: cmp r7, L414
+clr r2
+L366: .string "ijpmquebukorp"
+inc L22
+L367: sub L601, r3
+L368: .string "msy"
+L369: bne L19
+lea L199, L506
+L370: .data 767, -838, -199, -87, 516
+; comment
+rts
+L371: dec L223
+L372: jmp *r3
+L373: rts
+L374: sub r6, r1
+cmp *r3, *r4
+L375: sub r0, r7
+L376: lea L610, r7
+L377: .string "tnzucrvomunzbzwtocqti"
+L378: stop
+L379: mov #-107, L371
+L380: .string "vxzvahrwuhfcgmocixfk"
+L381: .data -906, 953, -249, -559, -236, -653, -818
+L382: stop
+inc L235
+L383: not *r1
+cmp #71, L343
+L384: mov L488, r0
+L385: lea L79, r1
+
+L386: jsr L425
+L387: stop
+; comment
+L388: .data -934, 771, -903, 606, -970
+L389: not *r0
+L390: bne *r4
+jsr L418
+lea L462, L406
+L391: .string "kkjprupriy"
+L392: dec L599
+lea L534, *r4
+
+add *r4, *r5
+L393: bne *r6
+L394: cmp *r1, #-94
+add #208, r7
+L395: clr *r0
+L396: stop
+jmp *r3
+L397: .data -841, 55, -712
+L398: inc L517
+L399: sub *r1, L617
+L400: bne L252
+jsr L186
+L401: bne *r5
+L402: dec L431
+
+L403: jsr L408
+stop
+L404: stop
+L405: inc r2
+L406: .string "kfcgnjoochpfirsbh"
+L407: jmp L421
+L408: bne *r6
+L409: lea L476, *r0
+
+L410: jmp L304
+L411: bne L265
+L412: cmp *r2, *r2
+L413: prn r0
+L414: add r0, r3
+L415: not *r7
+L416: add r2, r2
+L417: stop
+L418: .data 802, 113, -103, 660, 647, -543, -828, 140
+L419: bne *r3
+L420: .string "zxfbypctcptzmsypjgt"
+L421: .data 871, -202, -873, 104
+L422: dec r5
+jmp L605
+inc *r5
+L423: .data 974, -28, 838, -452
+L424: dec L366
+L425: .data 227, 312
+L426: .string "xjzfugnxkmch"
+L427: sub L594, L573
+L428: stop
+L429: add #-228, *r1
+rts
+clr r7
+L430: add *r5, *r4
+L431: stop
+L432: rts
+L433: sub L271, L294
+L434: .string "urkmxt"
+L435: sub *r2, *r0
+L436: red L107
+cmp L156, L149
+L437: jsr *r4
+L438: sub L121, L69
+L439: jsr *r5
+L440: .data -546, -916
+not *r2
+L441: rts
+bne L605
+L442: lea L617, L478
+L443: .string "lizktoejgtwrxoe"
+inc r3
+L444: not L511
+L445: jmp L562
+L446: inc L555
+L447: rts
+L448: rts
+rts
+bne *r1
+L449: .string "dcicvgoxvjadxelj"
+L450: .string "xyxiw"
+jsr *r0
+clr *r5
+cmp L434, r7
+L451: lea L122, r0
+sub r0, *r0
+sub #156, r6
+add *r0, *r0
+L452: prn *r5
+L453: .string "zhsxrkkjcnnrzmgzqbvh"
+L454: red r6
+L455: not *r3
+L456: not *r6
+L457: clr *r3
+L458: mov #-119, r2
+not L461
+red L316
+mov L592, r6
+L459: prn #63
+stop
+L460: stop
+L461: cmp L119, r3
+L462: bne *r5
+L463: add *r5, r7
+L464: red r6
+jmp *r2
+add r3, L28
+L465: mov #-137, L505
+rts
+not *r3
+jsr L309
+prn #-162
+L466: .string "ioppbmplbiuagxtha"
+L467: not L208
+
+L468: .data 260, 334, -540, -444, -376, 357
+L469: .data 318, -921, -859, 679, 134
+L470: add L579, L49
+red *r2
+L471: stop
+L472: red r6
+L473: .data -469, -654, -738, 544, -201
+L474: inc L32
+jsr *r4
+; comment
+L475: stop
+stop
+L476: jsr L265
+L477: jmp L498
+prn L325
+jmp *r5
+L478: rts
+dec r1
+stop
+not L172
+add #128, r0
+L479: clr L538
+L480: not L549
+; comment
+add r3, L133
+L481: .data -315, -624, -444
+lea L173, r7
+L482: clr *r3
+L483: not r3
+cmp r1, r6
+L484: .string "ymfvwzxjpjwejfwfyijcvpoo"
+L485: .data 813, 183
+clr L166
+bne *r4
+L486: lea L512, r0
+; comment
+L487: red r2
+red *r3
+clr *r6
+L488: dec *r7
+L489: red r7
+not *r6
+not L607
+stop
+jmp L525
+L490: .string "pfbyijbra"
+L491: dec r0
+L492: .data 323, -789, 413, -710, -950, 63, -758, -173
+L493: bne *r5
+rts
+dec L398
+L494: .data 496, 352, -813, 806, 835, 377
+L495: dec L586
+L496: sub *r2, L284
+L497: .data 448, -229, 839, 759, 369, 143, 917, 463
+sub r1, *r2
+L498: rts
+L499: prn #-137
+add r2, L528
+L500: .string "cgszxqwhtcyvaizbjnbjld"
+L501: rts
+L502: .data 404, 93, 625
+dec *r7
+L503: dec *r3
+L504: bne L474
+prn r1
+L505: clr *r5
+; comment
+L506: stop
+bne *r0
+inc *r1
+add *r2, L483
+L507: stop
+L508: sub r2, r0
+jmp *r5
+bne *r0
+L509: add L346, *r3
+L510: jmp L579
+L511: cmp *r4, #-92
+bne L165
+L512: bne *r2
+clr L522
+L513: red *r4
+L514: not L199
+clr r3
+not r2
+bne L597
+L515: lea L223, *r6
+not r5
+L516: dec L379
+L517: .string "dddvopxe"
+L518: dec *r3
+sub r3, r4
+bne L37
+L519: sub *r1, r4
+lea L399, *r0
+L520: clr r0
+L521: jsr *r3
+L522: mov r3, *r0
+L523: .data -373, 442, -542, -371, -751, 351, 621
+L524: red *r5
+L525: lea L601, *r4
+red L440
+add *r5, *r3
+
+L526: sub *r6, *r4
+lea L456, r1
+bne *r4
+lea L595, *r0
+L527: lea L599, r4
+L528: rts
+L529: clr L579
+L530: .string "cgbvut"
+; comment
+inc *r2
+clr *r7
+cmp *r6, L561
+L531: red r1
+cmp *r1, #36
+inc r1
+L532: stop
+L533: lea L214, *r7
+not L376
+L534: inc r5
+stop
+L535: .data -993, -521, 747, 575, 993
+clr r6
+L536: add r0, *r3
+L537: jmp L141
+inc r5
+L538: jmp *r6
+L539: .string "znwvbipszxhq"
+L540: red *r3
+L541: add #149, *r1
+L542: prn *r3
+; comment
+L543: jmp L259
+L544: not L327
+jsr *r7
+L545: not *r4
+L546: dec L116
+; comment
+L547: jsr L557
+L548: .string "aspbn"
+bne L326
+dec *r4
+jsr *r4
+L549: bne *r2
+L550: .data -119, 233, 205, -950, 17, -683, -332
+cmp *r5, L568
+L551: stop
+sub L574, r2
+L552: lea L391, *r1
+bne L91
+rts
+L553: clr r4
+L554: prn L53
+L555: jmp L603
+L556: jsr *r3
+L557: jsr *r2
+L558: lea L308, L577
+red r5
+L559: inc r5
+bne L252
+lea L471, L214
+mov L602, L300
+L560: stop
+L561: .data -279, 563, -757, 633, -357, 183, -432
+L562: cmp r0, r0
+L563: jmp *r6
+L564: bne L614
+L565: not *r7
+stop
+L566: jsr *r4
+rts
+; comment
+mov *r3, *r2
+L567: clr *r6
+L568: prn L448
+L569: mov r5, *r5
+rts
+L570: prn *r5
+; comment
+L571: jsr L619
+L572: .data -483, 70, -335
+rts
+jmp *r5
+mov r0, L594
+L573: stop
+jmp *r6
+L574: jsr L583
+L575: .data -181, -533, -715, -259, -257, -585, 994
+mov #64, r4
+L576: dec r6
+L577: lea L618, L621
+L578: .string "rapdry"
+not L621
+not *r6
+inc L356
+L579: .string "bqwbxpnmxbqatomccogxgi"
+L580: bne L596
+L581: .data 656, 789, 86, -500, -108
+clr *r7
+L582: sub r3, *r3
+L583: .string "wpqtmbuaiqexajuqae"
+L584: prn #-210
+not r5
+; comment
+L585: dec r1
+L586: .data 787, 265, 664, 676
+stop
+L587: jmp *r2
+add L610, L604
+add r5, *r1
+dec r4
+sub *r2, L137
+L588: lea L611, *r5
+lea L618, r7
+L589: jmp L312
+L590: mov *r0, L618
+cmp #15, L603
+
+L591: jmp *r0
+jsr *r5
+inc r0
+L592: rts
+sub *r1, *r4
+mov #-187, r7
+prn #254
+L593: stop
+L594: dec *r1
+inc L46
+L595: inc L615
+L596: .data -447, 746, -452
+L597: dec r0
+L598: rts
+L599: add #71, r2
+L600: prn *r3
+dec *r7
+L601: sub *r4, r3
+L602: dec *r2
+bne L617
+L603: red *r7
+L604: bne *r0
+bne L465
+L605: jmp *r5
+L606: cmp #-133, L413
+jsr *r4
+L607: stop
+L608: red *r2
+L609: not *r6
+not r5
+L610: red L572
+L611: cmp *r0, L422
+L612: inc L615
+L613: red *r6
+red *r1
+; comment
+bne *r6
+prn #217
+clr L621
+L614: dec r7
+rts
+L615: rts
+
+sub L30, *r0
+cmp *r3, r7
+jmp L621
+jmp *r0
+L616: inc L618
+L617: .data -602, 817, -34, -43, 253, -178, -51, 589
+L618: add *r4, *r1
+red L419
+L619: jsr *r1
+L620: add L621, L128
+inc L621
+L621: clr L505
+stop
@@ -0,0 +1,1042 @@
+; Generated by genCorpus --seed 18
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+.entry L624
+L0: inc *r1
+L1: .string "yjilexqsymnfbwynxw"
+sub #-152, r7
+inc *r6
+L2: jsr L576
+L3: jmp L221
+jmp L1
+L4: .string "gcqlibhodre"
+sub r0, r2
+L5: clr L463
+stop
+not r7
+L6: mov #-148, *r4
+L7: jsr *r0
+L8: stop
+L9: add *r2, *r3
+L10: inc *r2
+lea L8, L1
+L11: not L8
+L12: prn L338
+rts
+not L7
+L13: mov r6, *r2
+add r2, r2
+L14: bne *r5
+clr r7
+L15: dec r7
+
+add L2, r1
+L16: inc *r4
+prn #-191
+L17: prn L16
+L18: lea L11, L13
+L19: lea L17, L90
+L20: lea L597, *r2
+prn r4
+L21: .string "nzewzmusp"
+L22: not *r0
+L23: cmp L483, r6
+L24: lea L6, *r0
+L25: .string "rqunsxwu"
+L26: jmp *r1
+jmp *r5
+inc r5
+L27: inc r5
+L28: .string "sfnkkpppohsgokqfpmznocxp"
+L29: bne L7
+mov r6, r5
+jmp *r4
+dec L11
+L30: stop
+L31: sub L15, L29
+L32: lea L4, *r6
+inc *r3
+L33: clr r1
+dec L7
+L34: red r2
+L35: sub #75, *r5
+cmp #207, *r2
+add L31, *r6
+rts
+L36: jmp L27
+L37: .data -667
+L38: inc r2
+L39: bne *r4
+L40: stop
+red r7
+
+red *r5
+jmp L8
+L41: cmp *r7, *r6
+L42: prn #179
+L43: lea L518, r1
+L44: dec L11
+L45: mov *r3, L296
+L46: jsr L368
+L47: lea L31, r5
+L48: rts
+L49: jsr L6
+L50: jmp *r6
+L51: jmp *r1
+L52: red r7
+L53: clr *r2
+L54: stop
+L55: cmp *r5, *r1
+L56: clr r5
+L57: stop
+L58: lea L174, L385
+L59: not r7
+; comment
+L60: .string "lflrfzjo"
+L61: rts
+rts
+L62: sub *r1, *r6
+L63: inc L208
+sub L323, r4
+L64: inc r4
+cmp L64, *r5
+L65: jsr *r0
+clr L42
+L66: jmp *r0
+dec r2
+L67: rts
+
+L68: clr L14
+L69: bne *r0
+L70: bne L1
+L71: dec r1
+L72: rts
+L73: stop
+L74: add r1, L429
+L75: inc *r2
+L76: rts
+L77: bne L61
+L78: dec L555
+inc r7
+add #-30, r6
+jsr L615
+L79: prn r5
+sub *r2, *r3
+L80: add *r2, r1
+clr *r2
+L81: inc L335
+L82: prn L1
+L83: stop
+L84: jsr *r0
+L85: mov r4, L46
+jsr *r3
+L86: dec *r5
+L87: red *r6
+L88: red r1
+L89: prn L177
+L90: cmp r4, L344
+L91: jsr L81
+L92: inc *r0
+L93: mov *r5, L472
+L94: not r7
+cmp L625, *r1
+L95: sub L404, r0
+L96: prn L91
+
+bne *r4
+prn L95
+L97: dec L33
+L98: prn L355
+stop
+L99: lea L79, r2
+rts
+L100: lea L211, L398
+inc *r1
+L101: sub #198, L92
+L102: jmp *r3
+L103: bne *r2
+L104: not *r0
+L105: clr *r3
+L106: jmp L472
+L107: jsr *r7
+L108: red L369
+L109: red *r7
+L110: rts
+L111: inc r7
+cmp L48, #-255
+L112: .data -854, 812, -236
+L113: stop
+L114: bne L0
+L115: not r3
+L116: prn r7
+L117: lea L11, L168
+sub r7, *r4
+cmp #-254, L52
+
+mov L93, r2
+L118: lea L622, r2
+L119: red r3
+stop
+
+L120: stop
+L121: .string "jlfexzcitmvkohwr"
+L122: inc *r6
+not L9
+red L53
+L123: cmp *r3, *r6
+clr L33
+; comment
+bne L17
+inc r5
+L124: prn #-185
+lea L95, r4
+red *r1
+cmp L145, r5
+inc L10
+L125: .data -693, -7
+L126: clr *r6
+L127: .data 104, 431, 916, -382
+lea L169, *r4
+L128: prn *r1
+L129: jsr *r0
+L130: jmp *r4
+L131: .string "wkjkcaget"
+not *r4
+add #-237, *r5
+jsr *r4
+L132: not r0
+L133: dec L619
+L134: .data -837, 563, -325
+inc r3
+sub #14, r5
+L135: clr *r2
+L136: bne *r4
+not L91
+sub *r6, r2
+L137: mov L511, r6
+rts
+L138: .data -425, -959, -369, -431, 786, -993
+L139: jsr L212
+L140: sub #-150, r5
+L141: dec L435
+clr *r5
+L142: jsr L272
+stop
+bne *r4
+; comment
+L143: cmp L113, L6
+L144: lea L60, *r1
+L145: .data -820, -163, 641
+inc *r5
+add #-118, r6
+L146: dec r4
+L147: bne L427
+L148: prn #-222
+L149: .string "jeackbdwudzbscnkvp"
+L150: add *r2, r1
+dec L117
+L151: .string "v"
+jmp *r5
+L152: cmp *r4, L191
+L153: bne *r1
+L154: lea L154, r0
+not L149
+
+L155: stop
+add *r5, r3
+L156: sub L132, r1
+rts
+rts
+
+L157: lea L49, r7
+jmp *r4
+L158: prn #81
+L159: prn *r5
+L160: jmp L252
+L161: red L517
+L162: not L56
+L163: cmp *r3, *r4
+L164: .data 953, 467, 212, -159, -730, -192, 766, 17
+L165: inc r3
+L166: rts
+L167: prn L480
+; comment
+bne *r7
+L168: sub L194, L45
+L169: .data 400, 870, 726, 979, -413
+L170: add #-87, r2
+L171: jmp *r5
+stop
+sub r2, *r4
+L172: add r1, r3
+L173: sub #151, r6
+jsr L126
+L174: mov *r1, L443
+L175: lea L529, *r0
+; comment
+L176: cmp #188, #-215
+clr L622
+L177: dec L570
+L178: dec r5
+L179: .string "gfbtfjyoaxwzbhkeuzrimk"
+L180: cmp r4, r7
+L181: inc L588
+L182: .string "llnqkpnglfghvk"
+lea L473, r2
+L183: .string "mrvquhetgroxarsguf"
+
+L184: bne L343
+jmp *r7
+L185: sub #-162, r0
+L186: .string "ozwwbewaqudhldarnirouici"
+; comment
+prn *r7
+L187: lea L586, *r3
+rts
+red r6
+L188: bne L43
+L189: prn L538
+jsr *r1
+L190: lea L481, L535
+not L61
+L191: prn #214
+L192: lea L44, L499
+L193: clr *r3
+cmp r5, r5
+red r4
+jsr *r5
+L194: jmp *r6
+L195: add *r5, L5
+L196: .string "hwjcpbip"
+stop
+rts
+L197: red *r3
+L198: red L364
+L199: bne L33
+L200: sub *r6, *r4
+
+jmp *r4
+L201: red r4
+rts
+L202: jmp L598
+L203: .data 921, 408, -699, -647, -534, 387, 629, 99
+L204: cmp *r0, *r2
+stop
+not r7
+dec r4
+L205: .data 15, -979, 862, -633, 377, 242, 728, -59
+L206: prn L324
+L207: add #-251, L491
+L208: lea L605, *r6
+L209: dec L387
+; comment
+jsr L65
+not *r7
+L210: stop
+L211: jmp *r0
+dec L369
+L212: clr r5
+inc L281
+L213: .string "feeizqhfydjec"
+L214: .data 757, -762, 996, 108, 250
+jsr *r7
+L215: .string "dobmknfa"
+lea L167, *r4
+L216: .string "u"
+L217: add *r2, r5
+L218: red *r6
+L219: not *r0
+L220: dec r2
+L221: .data -40, -292, -941, 798, -832, -222
+L222: red L90
+stop
+L223: .string "q"
+L224: red L206
+L225: .string "yipbuiupzdxae"
+rts
+L226: rts
+L227: bne L627
+not *r4
+rts
+not *r0
+L228: mov #106, r4
+jmp *r3
+L229: cmp *r0, #-226
+L230: jsr L117
+L231: inc *r0
+L232: .string "tmmdcvfwtoxjclcxmv"
+L233: rts
+L234: clr *r3
+L235: inc *r2
+
+L236: .data -766, -535, 970, -58, 744, 963, -197
+L237: clr *r0
+stop
+L238: prn #-213
+dec L137
+L239: jmp *r2
+; comment
+bne L87
+L240: cmp r1, r6
+inc r4
+lea L513, r0
+L241: .data 269, -700, 303, -491, -608
+inc *r2
+L242: prn #-88
+cmp L108, *r6
+L243: bne L0
+jsr *r1
+L244: add r3, r3
+L245: jsr L312
+L246: add r1, *r5
+L247: sub *r4, *r6
+L248: jsr *r0
+prn *r5
+prn #-41
+L249: inc L411
+L250: rts
+L251: mov L237, r7
+L252: .data 811, 748
+L253: jsr L176
+clr L184
+L254: mov *r6, *r7
+L255: lea L237, L367
+L256: dec *r7
+L257: .data -346, -376, -116, -6, -525, 863
+L258: bne L47
+L259: sub *r5, r5
+L260: add *r1, L389
+L261: add L111, *r2
+lea L506, *r1
+L262: .string "hcopnzsnxup"
+L263: bne *r3
+L264: .string "ovpeeoooottkutpg"
+clr *r0
+L265: lea L342, *r0
+L266: clr r2
+L267: rts
+jsr *r5
+L268: clr r3
+L269: prn r7
+L270: lea L553, *r0
+; comment
+red r7
+L271: cmp r6, #253
+cmp #185, #-90
+clr *r0
+rts
+L272: sub r4, L396
+rts
+L273: bne L305
+L274: rts
+L275: lea L2, r4
+L276: not L535
+L277: cmp r3, L56
+rts
+L278: mov #-191, L342
+
+L279: dec L248
+prn r2
+cmp L115, *r5
+L280: sub #-137, L551
+L281: add *r6, r0
+L282: prn r7
+
+L283: stop
+L284: .string "iloyixsl"
+jsr L248
+L285: .data -528, -972, 0, -580, 436
+lea L407, r3
+mov #-58, *r7
+L286: bne L227
+L287: red *r0
+L288: mov *r3, r1
+inc r2
+L289: dec r4
+L290: dec *r1
+L291: jmp L322
+L292: jsr *r6
+L293: dec L372
+sub L157, *r1
+red *r6
+L294: clr L271
+L295: prn r7
+L296: bne *r6
+L297: lea L380, r5
+L298: dec L135
+inc L197
+
+stop
+L299: jsr *r1
+L300: .string "efh"
+L301: jmp *r2
+jsr L48
+stop
+L302: mov *r1, *r3
+mov L121, *r3
+L303: not *r2
+L304: .string "lvdayxapkeicqqxdalill"
+jsr *r5
+jsr *r2
+L305: cmp r7, *r5
+cmp r3, #-200
+L306: .data 821, 282, -682, 43, 615, -692, 682, 993
+red L521
+cmp r3, #148
+L307: not *r4
+L308: add L17, r5
+L309: mov *r2, *r7
+jmp *r3
+L310: mov #10, *r2
+jsr *r0
+lea L465, *r1
+clr r0
+L311: stop
+L312: .string "oegqndfsuqpohvu"
+L313: .data 114, 859
+L314: rts
+rts
+L315: red *r6
+jmp L66
+L316: bne *r0
+prn r6
+prn *r0
+L317: sub r3, *r4
+L318: .data 876, 736, 476, -138
+L319: lea L335, L589
+L320: red L126
+L321: prn #-31
+bne *r7
+L322: sub #-34, r7
+L323: sub #72, L356
+L324: add L152, *r4
+L325: .data -868
+not L581
+
+add #-239, r1
+jmp *r3
+L326: prn #-12
+L327: jsr L166
+L328: .string "hqrjego"
+sub r3, r5
+
+sub #-15, L620
+L329: jsr *r1
+L330: jsr L130
+L331: clr r1
+L332: dec L188
+L333: lea L192, L301
+L334: inc L52
+L335: inc r1
+L336: dec *r6
+L337: .string "hqiat"
+not r5
+mov L165, L374
+L338: jmp L629
+L339: inc r0
+L340: stop
+dec L567
+L341: jmp L113
+L342: add *r3, r1
+inc L135
+L343: mov #156, L284
+L344: lea L561, *r7
+L345: clr *r2
+L346: stop
+L347: stop
+sub #-166, r1
+bne L46
+inc L510
+L348: .string "hxsl"
+jsr L122
+L349: .data -59
+bne *r3
+rts
+not L171
+L350: stop
+L351: inc r6
+L352: jmp L16
+stop
+L353: sub L61, *r4
+not r7
+L354: lea L212, r4
+
+L355: prn #132
+L356: add *r5, L450
+L357: jmp *r2
+sub r7, L87
+L358: stop
+L359: add #-38, *r4
+inc r3
+mov #75, *r4
+L360: jsr *r4
+L361: red r2
+L362: .data -265, -434, -304, 825, 289, 824, 735
+L363: dec r6
+L364: .data 690
+inc *r5
+L365: clr *r3
+L366: not L525
+L367: bne L181
+L368: rts
+L369: .string "bbmgqmxero"
+stop
+L370: stop
+L371: .data 620, 215, -411, -551
+mov *r3, r4
+stop
+lea L190, r4
+L372: jmp L29
+L373: .data -980, -889, -960, 736
+L374: prn *r4
+cmp r2, r1
+jsr *r0
+jmp L221
+L375: bne *r6
+L376: jmp L468
+add r1, r3
+mov *r5, L160
+dec L628
+L377: .string "fkxidrtuj"
+L378: lea L165, *r5
+L379: clr r7
+L380: cmp r7, *r5
+inc *r2
+add r1, L415
+L381: lea L355, r5
+jsr L100
+add L374, r2
+L382: lea L12, L457
+sub L490, r5
+L383: rts
+L384: mov r2, r6
+add #-96, *r1
+L385: prn L590
+not *r1
+not L588
+L386: rts
+jmp L535
+L387: .string "rhhiljlzwhfphns"
+L388: .data -147, -820, 223, -91
+lea L459, r2
+L389: cmp #125, #-8
+rts
+L390: .string "dbbvvrismndno"
+rts
+jsr *r0
+L391: jsr L419
+red *r5
+L392: jmp L614
+inc r5
+L393: dec L471
+not L198
+sub L345, r5
+red r3
+L394: jmp *r3
+; comment
+L395: prn L396
+
+L396: .data 672, 178, -745, 384, 938, 384
+clr r5
+L397: not *r3
+L398: stop
+clr r2
+L399: lea L570, r7
+add r7, r1
+jsr *r6
+L400: prn L348
+mov *r1, r4
+L401: .data 260, 144, -373, -537, 23, -125
+L402: prn #241
+L403: rts
+cmp #174, *r3
+L404: inc r4
+not r4
+cmp r5, #249
+not r4
+L405: clr *r0
+L406: red *r1
+L407: not *r7
+L408: clr r1
+add *r1, *r4
+L409: clr *r4
+red *r7
+L410: .data -816, -487, -804, -19, 483
+L411: jsr L469
+dec *r5
+L412: red r3
+mov r1, L96
+L413: sub r6, L276
+L414: not L476
+L415: not r1
+L416: .string "bbibolglpbedaosqll"
+stop
+jmp *r4
+clr r4
+add L374, L219
+L417: dec r1
+L418: lea L605, r4
+; comment
+L419: not L368
+L420: lea L512, r6
+L421: jsr L293
+L422: add *r0, *r4
+L423: .string "wqaxkqgk"
+L424: lea L221, r0
+clr r1
+L425: not *r1
+L426: prn #-237
+jmp *r3
+
+stop
+L427: mov L241, L550
+mov r2, r3
+L428: bne *r2
+L429: not L205
+; comment
+jmp *r7
+cmp #123, L4
+L430: .data 102
+cmp #-97, L61
+L431: inc L285
+dec r2
+L432: stop
+L433: jsr *r3
+; comment
+L434: .string "tzuhhknalqlky"
+L435: rts
+L436: lea L83, *r4
+L437: red r0
+L438: red L505
+L439: mov #34, L454
+cmp L449, L529
+rts
+L440: inc *r3
+L441: .string "okgzeia"
+L442: bne *r2
+
+L443: lea L348, r1
+bne L494
+lea L115, r4
+L444: cmp L226, *r7
+L445: dec L291
+cmp r7, *r6
+L446: jmp *r5
+L447: jmp *r5
+L448: red *r4
+L449: not *r4
+jmp *r3
+dec r2
+L450: add #207, r0
+lea L544, *r5
+prn L266
+jmp *r2
+L451: cmp r7, #-151
+stop
+L452: jsr *r4
+L453: not *r7
+L454: add L486, L587
+L455: mov r6, L11
+inc *r3
+L456: inc L46
+prn L597
+sub #-185, *r4
+L457: stop
+mov r7, r2
+L458: bne L368
+L459: add *r0, *r1
+L460: stop
+L461: lea L239, *r5
+lea L580, L427
+add *r6, *r6
+L462: .data -330, -836
+inc L107
+L463: sub *r5, r2
+
+L464: add *r0, *r5
+clr L269
+L465: .data -101, -730, -987, -299, 320, 25, -476, -692
+L466: jmp *r4
+inc r2
+L467: inc r6
+
+L468: red r1
+dec L46
+not L510
+cmp r2, #-102
+L469: add L283, *r0
+L470: dec L318
+L471: mov #-193, L604
+L472: red L562
+L473: add r4, *r3
+clr *r0
+L474: inc r4
+L475: .data 370, -907, 940
+
+dec *r3
+clr L628
+L476: dec r4
+jmp L452
+L477: prn *r6
+L478: mov #100, *r5
+L479: not *r1
+L480: rts
+L481: .data -858, -158, 656, -158, 100
+L482: .data -369, -270, 76, -498, 629, 422
+mov *r1, L80
+L483: .string "hviybsbwyzpljyw"
+L484: cmp r3, #105
+cmp r3, *r2
+L485: jmp L47
+L486: not L444
+L487: add r0, r7
+dec L605
+inc r0
+L488: .data 265, 407, -203, 342, -784, -309, 758, 1
+prn *r6
+L489: .data -459, 603, 608, 155, 549, 238
+L490: prn *r4
+L491: stop
+L492: red L347
+L493: mov L297, r7
+L494: prn r7
+L495: .data 128, 71, -78
+clr *r1
+mov #44, L512
+mov r3, r7
+L496: rts
+L497: clr r6
+L498: sub r2, L601
+L499: prn #-157
+mov *r3, L596
+L500: bne *r2
+L501: stop
+L502: inc L270
+L503: add r6, L361
+mov #-182, *r7
+L504: cmp r6, *r1
+L505: red L581
+prn L287
+L506: rts
+not r5
+L507: not *r2
+L508: .string "wsutj"
+; comment
+L509: dec r7
+L510: sub #7, L628
+L511: rts
+rts
+jsr L56
+L512: clr L237
+sub *r3, r4
+sub L215, *r4
+L513: mov *r2, L605
+L514: inc r2
+L515: red L116
+L516: prn #38
+L517: add #187, *r2
+L518: rts
+
+L519: cmp r1, r1
+
+L520: cmp r2, L600
+L521: jsr *r5
+L522: prn L584
+cmp #-162, r2
+L523: clr r5
+add #31, L618
+L524: prn r4
+L525: add L582, L69
+L526: add r1, *r4
+sub L431, L412
+bne *r5
+L527: not *r3
+; comment
+L528: clr L615
+clr L548
+L529: .string "artxadssvztfmtczedqdpnoi"
+; comment
+L530: sub r2, r4
+L531: bne *r0
+L532: bne *r2
+L533: lea L565, L401
+L534: rts
+L535: .data -275, -798, 630
+clr L569
+L536: jsr L613
+L537: clr L191
+L538: .string "fu"
+; comment
+; comment
+L539: mov *r1, r4
+L540: jsr L580
+jsr *r3
+L541: dec L562
+
+cmp #-186, r0
+L542: dec *r1
+add #-69, L587
+L543: rts
+L544: jmp *r1
+red *r4
+L545: inc r6
+L546: prn *r5
+L547: .data -582, -244, 235
+L548: clr L566
+bne L57
+L549: clr *r7
+L550: mov r4, r4
+dec r2
+L551: inc *r5
+L552: not L248
+L553: lea L614, *r6
+sub r2, r5
+L554: lea L205, *r5
+L555: lea L629, *r2
+L556: cmp L608, #-139
+
+red *r0
+L557: prn r0
+L558: mov r0, r2
+not *r0
+L559: not *r6
+L560: add L593, r1
+prn r1
+L561: inc r4
+L562: add *r1, *r4
+L563: add r0, r3
+L564: bne L155
+L565: red L500
+L566: .data 135, -872, 288, -475
+L567: .data 99
+jmp L225
+add *r5, r6
+L568: red r5
+add *r6, L576
+; comment
+L569: bne L339
+rts
+L570: stop
+L571: inc L335
+L572: not *r6
+L573: red L169
+L574: jmp *r5
+L575: lea L584, L577
+L576: mov r5, L269
+L577: sub r0, L324
+L578: cmp r3, r6
+dec *r1
+not *r2
+L579: prn L581
+sub r0, r1
+L580: jsr L612
+add L622, r0
+sub *r7, *r4
+L581: cmp #156, #-219
+L582: bne L551
+L583: jsr *r2
+L584: bne L600
+sub r3, L343
+L585: lea L9, r6
+L586: rts
+L587: jsr L76
+L588: .string "xnvnzgzncwfmyjhfywordk"
+sub #224, L495
+L589: clr *r6
+L590: cmp #-119, #41
+red r7
+prn r4
+L591: mov r0, r0
+L592: mov L329, r6
+
+add L122, r3
+L593: red *r0
+L594: stop
+L595: red L163
+mov L120, L84
+L596: lea L628, L604
+L597: clr r2
+L598: clr r4
+L599: not L81
+inc L338
+L600: cmp L615, #-96
+L601: lea L570, L616
+L602: lea L624, *r1
+inc L451
+clr L610
+L603: dec L609
+L604: .string "rndiffyhlrfb"
+jsr L627
+L605: stop
+bne L206
+L606: cmp L619, #-159
+prn L212
+L607: stop
+L608: sub r2, r7
+L609: prn L623
+red L622
+clr L628
+L610: .string "ckefmsmoexznqlodyzuo"
+L611: add #-66, *r5
+L612: dec *r4
+mov *r3, L627
+L613: .data 161, -812, -44, -450, -973, -614, -468
+L614: jsr *r0
+L615: dec L76
+L616: red r3
+L617: red L70
+mov L619, r0
+L618: sub r1, r2
+L619: red r3
+dec r5
+L620: mov r0, L205
+add L518, r6
+L621: lea L375, L138
+L622: prn *r6
+L623: jmp *r0
+L624: .data -221, 2, 802
+L625: not r0
+L626: lea L321, r7
+add *r3, r2
+L627: jmp *r6
+jsr L115
+L628: rts
+L629: bne *r7
+stop
@@ -0,0 +1,1041 @@
+; Generated by genCorpus --seed 19
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+L0: dec r1
+L1: jsr *r5
+L2: cmp #4, #-227
+not *r1
+L3: red *r2
+L4: stop
+L5: .data 542, 981, 691
+L6: sub L6, r5
+; comment
+stop
+stop
+L7: prn L3
+L8: add #5, L2
+dec L7
+L9: stop
+jsr L185
+L10: prn *r3
+mov r7, L10
+L11: add #-64, L179
+L12: add r1, L438
+L13: .string "kblrp"
+add L461, r4
+L14: not *r3
+add L6, *r4
+red r1
+not L444
+L15: dec L138
+L16: dec *r3
+L17: prn *r5
+; comment
+rts
+cmp *r1, *r7
+L18: dec r2
+L19: jsr L223
+jmp L12
+; comment
+red *r0
+red r6
+red r0
+dec L19
+L20: stop
+jmp L1
+not r5
+L21: jsr L17
+cmp *r4, r5
+L22: jsr *r6
+L23: .data 195, 957, -735, -782, 814, -282, 650, 926
+L24: dec r5
+dec *r6
+L25: stop
+stop
+L26: jsr *r4
+L27: prn *r4
+L28: not *r1
+L29: inc *r4
+clr r4
+prn #-172
+clr r7
+L30: inc L35
+inc *r1
+L31: bne L132
+L32: red r4
+L33: dec r2
+L34: dec L16
+sub L72, r0
+L35: .data -149, 114, 277, -505, -766, 529, -751
+L36: stop
+L37: stop
+L38: bne L9
+L39: .data -438, -549, 388, 189, -587
+L40: mov *r4, L19
+
+red *r5
+stop
+L41: dec r2
+stop
+L42: .data 431, 390, -804, 864, -264, -678, 986
+jmp *r7
+clr r0
+L43: red r3
+inc *r5
+add #26, L27
+L44: cmp r6, r5
+L45: sub #-132, *r0
+add L34, *r1
+L46: bne *r3
+L47: .string "qaaoidrlhihcy"
+rts
+rts
+stop
+jmp L323
+L48: .data 874, -192, -484, 440, -769, -5
+jmp *r4
+L49: clr r3
+mov *r0, *r7
+L50: .data -490, 971, 879, 964, 134, 35
+L51: .data -733, -978, -366, -79, -173, 48, -623
+L52: lea L32, r4
+L53: prn #-251
+L54: sub *r6, L26
+L55: add L52, r4
+L56: bne L259
+L57: add *r5, L486
+L58: .string "oyovbxvix"
+L59: jmp *r7
+mov #143, *r3
+jmp *r0
+L60: add r0, r6
+
+L61: red r5
+L62: lea L33, *r7
+jmp L18
+L63: sub #-133, L9
+
+not r1
+dec r1
+L64: mov *r2, r1
+
+add r7, *r7
+L65: jmp L20
+L66: dec *r3
+L67: add r3, *r4
+red *r0
+L68: rts
+clr L390
+L69: jsr *r3
+L70: .string "j"
+L71: .data 372, 898
+L72: red L30
+L73: not L40
+L74: red L53
+L75: clr r7
+L76: clr *r4
+L77: .string "zlkcssiapnng"
+L78: prn #21
+L79: clr r1
+L80: red *r2
+L81: jsr L302
+L82: jmp L432
+L83: dec L31
+cmp L10, *r7
+clr L229
+dec L514
+L84: dec L1
+; comment
+cmp r4, L318
+L85: .data -235, 260, -128, 847, -514
+add #-206, r0
+L86: jmp *r1
+clr r7
+L87: rts
+L88: jmp L343
+L89: prn #-204
+L90: add r2, r6
+L91: rts
+L92: jmp *r1
+; comment
+mov #143, L32
+L93: mov *r2, r5
+L94: red *r5
+L95: inc *r7
+L96: .string "ajvpumnlygraloixfskd"
+L97: rts
+L98: .data 377, -809, -250, 772, 188
+L99: not L13
+L100: cmp *r4, #-192
+L101: jmp *r5
+L102: inc L65
+; comment
+L103: inc r7
+L104: inc L310
+; comment
+L105: jsr L429
+
+L106: jmp *r1
+L107: .string "oqmwhnznjaaiaqano"
+jsr L67
+L108: jmp L93
+L109: stop
+L110: jsr *r4
+L111: add L479, L410
+add r4, L73
+
+L112: .data 525, -64, 23, 463, 818, 304
+L113: cmp r3, L293
+not r6
+prn r4
+lea L157, L9
+clr r7
+prn *r3
+L114: mov *r3, *r1
+L115: prn *r1
+dec r4
+rts
+stop
+lea L37, L487
+L116: jsr L104
+L117: add *r7, r2
+jsr *r5
+L118: stop
+L119: jmp *r3
+L120: clr L61
+L121: add L278, r5
+L122: lea L62, L382
+bne L89
+L123: sub L46, r0
+prn #-236
+L124: jmp *r6
+stop
+L125: inc r3
+inc r2
+rts
+L126: dec *r2
+L127: cmp #-37, *r2
+L128: stop
+L129: rts
+L130: inc L131
+jsr L77
+cmp L39, r0
+L131: jsr L595
+jmp L470
+L132: stop
+L133: sub #57, *r3
+L134: add r2, L133
+mov L67, L65
+mov r5, L114
+add L389, r3
+dec r5
+sub L156, L97
+red *r2
+cmp L126, L61
+red r7
+lea L96, *r4
+prn #-162
+mov *r2, *r6
+rts
+L135: .string "qhwsybwdwtweuzghtjd"
+dec L549
+L136: rts
+L137: .data -429, 75, 117, -670, -968, 350, -405
+L138: sub #115, r6
+L139: .data -233, -874, -973, -871
+L140: jsr L236
+L141: jmp *r7
+; comment
+jmp L255
+L142: .data 90, 846, 163, 388, -526
+L143: stop
+inc L238
+red *r3
+sub #-239, *r0
+red L21
+lea L35, L447
+L144: not r2
+jsr L67
+L145: lea L250, r7
+L146: cmp *r1, *r6
+stop
+
+; comment
+L147: stop
+stop
+cmp #221, r7
+prn *r5
+dec r0
+L148: stop
+L149: jmp *r5
+L150: jmp L8
+rts
+not L183
+L151: lea L8, *r7
+L152: jmp L447
+clr L402
+L153: not r4
+L154: cmp #-55, *r2
+L155: .string "lrxdspb"
+L156: stop
+L157: dec r1
+rts
+L158: add r5, L42
+
+cmp r7, #-198
+L159: stop
+L160: prn *r5
+mov #-209, L75
+not *r1
+L161: .string "hqdmtpkdxeaflvnqapn"
+L162: .data 152, -866, -969, 432
+cmp L345, #-3
+inc *r5
+L163: bne *r3
+L164: red r7
+L165: clr r6
+L166: sub r0, L26
+L167: jsr L360
+L168: red *r2
+inc *r4
+L169: mov #-99, L426
+inc *r6
+red r7
+L170: dec *r1
+L171: cmp r0, #216
+L172: rts
+stop
+dec L331
+L173: clr *r7
+L174: .data -915, -799, 9, -815
+L175: add r6, r3
+L176: add #65, *r4
+lea L365, *r5
+jmp L200
+L177: jmp *r5
+L178: stop
+L179: not L607
+L180: cmp r1, *r3
+L181: .data -858, -482, -504
+L182: dec *r5
+stop
+L183: jsr L30
+L184: lea L414, r6
+L185: add L177, r4
+L186: clr r5
+L187: inc *r2
+prn *r2
+L188: jsr *r6
+jsr *r3
+add #-134, r0
+L189: .data -242, -642, 757
+inc *r3
+rts
+L190: inc r3
+L191: rts
+; comment
+L192: cmp L131, *r4
+L193: rts
+L194: not r4
+jsr L159
+L195: bne *r3
+; comment
+mov L88, r3
+L196: stop
+L197: dec L107
+L198: cmp r2, *r6
+L199: jsr *r0
+L200: inc L521
+L201: inc L247
+L202: rts
+
+L203: add #142, r3
+L204: inc L140
+prn *r3
+mov *r4, r6
+L205: dec r1
+cmp L186, r2
+stop
+L206: mov r0, r6
+not *r3
+sub r1, *r6
+L207: sub *r0, L400
+L208: clr L607
+L209: add *r3, r0
+L210: bne *r0
+L211: rts
+L212: cmp L53, L541
+L213: sub L1, r4
+L214: bne L147
+L215: .data 422, 26, -841, -225, -189, 414, -217
+add *r3, r7
+L216: sub r4, r5
+L217: add #-132, r4
+L218: stop
+L219: not r3
+L220: lea L463, *r7
+L221: dec L92
+L222: prn L86
+L223: rts
+lea L47, *r3
+cmp #120, *r7
+inc L365
+L224: mov *r3, L108
+; comment
+sub r6, *r2
+stop
+L225: sub r5, r6
+sub #-236, *r1
+sub *r4, L462
+not L82
+L226: sub *r3, L173
+L227: dec L212
+prn #-126
+L228: cmp *r6, r0
+L229: not r6
+L230: jsr *r2
+jmp L145
+L231: rts
+bne L337
+L232: cmp #133, *r2
+L233: jmp *r1
+L234: add r0, L504
+cmp r0, L448
+red r3
+L235: stop
+
+L236: dec *r4
+L237: .data 302, -296, 285, -798
+L238: sub #-96, *r3
+
+L239: mov *r1, *r4
+inc *r7
+L240: clr L281
+L241: rts
+L242: red r0
+; comment
+L243: stop
+
+rts
+L244: sub r3, r4
+L245: bne L373
+sub r5, r7
+jsr L570
+; comment
+rts
+jmp *r7
+L246: mov *r6, L53
+L247: prn L88
+L248: add *r7, L567
+L249: .data 152, -99, -319, 288, 622
+
+L250: add #99, L513
+L251: stop
+L252: add r5, r3
+L253: rts
+L254: add L348, L123
+; comment
+dec L2
+L255: sub r2, r3
+
+prn r0
+lea L66, L603
+L256: rts
+jmp *r1
+L257: not L300
+sub L533, *r1
+clr *r2
+dec r0
+L258: not r3
+L259: mov r6, r4
+L260: prn #-107
+L261: mov *r7, r2
+L262: jmp *r2
+
+L263: .string "mwaxxfctrpkp"
+sub L128, L190
+L264: not *r7
+inc *r3
+cmp *r5, L436
+L265: jmp L146
+; comment
+L266: mov L223, r5
+L267: jmp L28
+L268: jsr *r7
+L269: clr r2
+inc *r2
+stop
+L270: sub #-249, r1
+L271: not *r3
+; comment
+jmp L366
+not r5
+inc L253
+L272: jmp L38
+L273: rts
+add *r7, L242
+L274: mov L268, *r2
+L275: dec *r5
+jsr L40
+clr r0
+L276: red *r3
+
+L277: add #246, r0
+L278: dec r3
+jmp *r1
+L279: .string "uplyjhh"
+L280: stop
+L281: prn #-103
+L282: .data 272
+L283: rts
+sub #130, r2
+mov L547, L437
+L284: jsr L245
+prn #-169
+L285: stop
+L286: inc L414
+L287: clr *r1
+inc L504
+L288: cmp L46, L2
+bne *r1
+L289: inc *r1
+
+not *r1
+L290: mov r2, L421
+L291: jmp L536
+L292: jmp *r6
+lea L145, r4
+add L532, r3
+cmp L268, #178
+L293: dec r2
+L294: cmp L228, #77
+L295: lea L602, L146
+jsr *r6
+L296: red *r5
+rts
+red L523
+clr r3
+bne L602
+L297: sub L186, r4
+L298: lea L359, r6
+L299: dec r5
+L300: lea L563, r3
+red *r2
+mov L319, L138
+mov *r1, *r4
+L301: clr r7
+L302: mov *r5, *r2
+L303: bne L16
+L304: lea L593, L221
+L305: inc *r7
+L306: dec r1
+L307: .string "wvrzojvte"
+sub L508, *r3
+mov *r0, r0
+mov r0, r6
+L308: prn r5
+L309: jsr *r2
+L310: bne *r7
+L311: rts
+L312: mov #219, r0
+
+L313: rts
+L314: dec *r3
+L315: sub r4, L483
+
+L316: lea L409, *r6
+prn r3
+L317: jsr L183
+L318: rts
+L319: sub L383, *r4
+mov #-206, L222
+cmp #-80, r7
+L320: .string "ernaezkbiszizvgxsoxmoo"
+
+L321: bne *r1
+clr L266
+L322: jsr L215
+L323: prn *r2
+L324: stop
+L325: mov L532, *r3
+L326: jmp L149
+L327: mov *r7, L572
+L328: sub #-12, L389
+L329: lea L290, L300
+mov L186, L182
+clr *r1
+sub #241, *r7
+lea L443, L532
+; comment
+L330: rts
+L331: .string "qtrqxopluwbsodpvdvgote"
+L332: clr *r4
+L333: .data -739
+stop
+L334: .string "kxbzlbstxrkms"
+L335: prn L511
+cmp *r1, *r5
+L336: rts
+jmp L357
+
+L337: .data 262, 398, 871, 487, -127, 909
+L338: lea L108, L559
+L339: .data -185
+L340: jsr L490
+L341: lea L92, L384
+L342: inc *r2
+; comment
+L343: .data -976, -736, -733, -118, 953, 62, -964
+prn L515
+jmp L174
+prn L389
+L344: .string "nkxmvwrd"
+L345: .data 824, 308, 230
+L346: rts
+dec r7
+red r2
+L347: jsr *r5
+L348: dec L555
+L349: sub r0, *r5
+L350: inc r3
+L351: rts
+clr r0
+L352: dec r3
+L353: clr L604
+lea L577, *r5
+L354: not L468
+L355: prn *r3
+L356: mov r6, *r5
+clr L598
+sub r2, r1
+L357: lea L495, L539
+sub L285, r3
+L358: inc *r4
+L359: .string "rpmhqojunhovxfy"
+L360: jmp L538
+L361: add #88, L331
+L362: jmp *r2
+L363: prn L452
+L364: prn r5
+L365: bne L348
+L366: prn r7
+not r4
+L367: add r6, *r3
+L368: cmp *r5, L351
+add #72, L369
+L369: jsr *r4
+
+L370: prn #-31
+L371: inc r3
+not *r4
+L372: cmp r2, r7
+L373: prn r1
+L374: add L452, r4
+L375: cmp *r1, #110
+jsr L137
+L376: dec r2
+L377: inc r2
+dec r3
+L378: .data -643, -760, -937
+L379: jsr *r1
+stop
+cmp r1, L484
+lea L608, r5
+L380: .data 472, 430, -56, -869
+jmp L571
+L381: clr L127
+L382: cmp L533, r1
+L383: jmp L71
+L384: stop
+L385: cmp *r4, r6
+L386: cmp #-201, L498
+L387: .data -987, -787, 682
+prn *r0
+L388: inc L156
+dec L138
+; comment
+; comment
+L389: stop
+L390: not r4
+L391: prn r7
+L392: clr L436
+L393: jsr L105
+L394: stop
+cmp #246, L438
+; comment
+L395: add #-199, *r5
+L396: cmp #178, *r3
+cmp #-246, r6
+
+L397: dec r4
+L398: sub r5, r5
+L399: dec r7
+L400: cmp #-256, *r6
+sub L180, r1
+L401: dec *r1
+clr r5
+L402: stop
+not r3
+cmp L317, *r7
+L403: red r3
+bne L476
+; comment
+L404: stop
+L405: rts
+L406: .string "qynsiycwrwfvzjzrsr"
+L407: not r7
+red r2
+L408: stop
+L409: bne L32
+stop
+L410: clr *r7
+prn *r3
+L411: rts
+L412: lea L362, L101
+L413: not *r3
+inc L586
+L414: clr L12
+stop
+L415: bne *r0
+sub *r7, *r5
+L416: lea L60, L468
+L417: bne L42
+L418: red L413
+cmp L214, r3
+L419: not L111
+L420: prn #156
+L421: cmp r3, r2
+L422: .string "vln"
+L423: jsr L454
+L424: jmp *r1
+L425: jmp L22
+; comment
+L426: jsr *r5
+L427: .data 224, -289, 763, 676, 710
+L428: inc L252
+L429: cmp r0, #-224
+prn #-13
+L430: not r1
+L431: cmp r5, *r0
+bne *r1
+sub L583, L600
+cmp L310, *r5
+bne *r4
+L432: jmp L566
+rts
+rts
+L433: .data -68, -546, -835, -914
+L434: bne L526
+L435: lea L416, r4
+L436: stop
+L437: red *r7
+L438: stop
+L439: mov L37, L449
+L440: inc *r0
+L441: .string "ndrzzzzjbjfnkmer"
+red r2
+L442: .data -998, -404, -270, 718, -449, 915, -39
+L443: cmp *r3, *r0
+L444: .string "dgr"
+L445: red *r6
+L446: .data 144, 269, -552, -12, -373, -205
+L447: .data -579, -822, -671, 853, 132
+add r6, r6
+L448: dec r0
+L449: inc L471
+L450: stop
+dec L292
+not L388
+L451: .string "um"
+L452: .data -255, 87, -392, 913, -317, 602
+jsr *r3
+L453: mov L318, r0
+L454: jsr L553
+L455: red r4
+L456: inc r4
+add L371, r1
+L457: jmp L472
+L458: stop
+L459: sub *r7, r6
+L460: prn #-102
+L461: cmp r4, L532
+dec L57
+inc L411
+red L500
+sub #202, L534
+not L515
+L462: add #235, *r7
+L463: lea L469, L271
+L464: mov #138, *r5
+L465: mov #-112, r7
+L466: lea L572, r7
+L467: .string "yjgsyjyajmm"
+L468: .string "vcdeusjnpgiz"
+L469: inc *r3
+clr r1
+sub *r5, L133
+; comment
+L470: .string "xk"
+cmp r5, #135
+L471: .string "tkdwrwxbzocpcsnbnojdje"
+L472: dec L150
+L473: prn r1
+L474: inc r1
+L475: stop
+dec *r4
+lea L585, r4
+add #90, *r0
+L476: bne *r4
+L477: lea L138, r2
+L478: red *r3
+L479: rts
+L480: .string "zyxvsuknpiib"
+L481: dec r7
+L482: bne *r3
+L483: jsr L557
+L484: lea L589, *r2
+jmp L296
+L485: .string "yahejjxk"
+jmp L597
+inc r2
+L486: jsr *r1
+; comment
+L487: .data -678, -123, 438, 503, -892, 594, 729, -633
+L488: inc L572
+L489: jmp *r4
+clr L10
+rts
+jsr L527
+add *r4, L547
+L490: .string "cg"
+L491: mov #5, *r4
+mov #-119, r2
+L492: jmp L581
+L493: inc *r0
+L494: bne *r2
+L495: sub *r7, *r3
+L496: .data 975, -323, 177, -576, -43, 310, -538
+; comment
+mov r5, *r1
+L497: not L466
+L498: red r6
+L499: rts
+bne L302
+L500: clr r5
+; comment
+not r2
+L501: dec r6
+; comment
+L502: jmp L518
+cmp *r1, *r1
+L503: jmp *r1
+L504: lea L482, r6
+L505: inc L301
+lea L532, r2
+dec r2
+L506: not L592
+add *r5, L527
+L507: lea L53, r1
+L508: jsr *r1
+L509: prn #-67
+L510: clr L66
+
+rts
+L511: add *r6, L588
+mov #-156, r1
+L512: cmp #203, r1
+L513: stop
+L514: red *r0
+L515: stop
+
+L516: not L448
+sub r5, L566
+L517: clr L193
+L518: mov #4, L197
+L519: red L566
+clr *r3
+L520: jsr *r2
+prn #227
+L521: mov #-88, r6
+jsr L442
+L522: dec L144
+L523: .string "nxcycmmgvbgxiqws"
+L524: cmp #164, #-89
+prn L596
+L525: red *r0
+L526: rts
+L527: not L359
+dec r6
+cmp r1, *r1
+L528: rts
+L529: sub *r5, r5
+L530: rts
+; comment
+L531: .data 960, -795, 706, 969
+bne *r3
+L532: .string "ul"
+L533: sub r2, L74
+red L552
+L534: bne L354
+red L362
+inc L13
+L535: not *r4
+L536: lea L601, r6
+lea L395, L598
+sub #-165, L115
+L537: mov L472, *r4
+L538: bne *r0
+
+sub #244, L13
+red *r3
+red r5
+L539: jmp L375
+L540: jmp L564
+L541: lea L2, *r3
+L542: mov #247, L270
+jsr *r7
+L543: .string "sddtinz"
+rts
+lea L572, L586
+L544: rts
+prn L240
+not r5
+prn *r7
+prn #-168
+stop
+; comment
+jsr *r6
+L545: .data -478, -426, 22, -175, 950, -332, 842
+L546: red r5
+L547: mov *r2, *r6
+L548: prn r2
+rts
+L549: bne L564
+L550: mov r3, *r1
+L551: dec r7
+add *r7, *r4
+L552: red L568
+L553: .data 853, 177
+inc *r2
+add r7, *r3
+bne L574
+L554: cmp #-96, r2
+L555: .string "bbgpxjamuco"
+bne L561
+L556: mov r1, *r2
+L557: sub *r3, r0
+L558: stop
+L559: lea L246, L18
+L560: prn #46
+prn r1
+; comment
+L561: inc r3
+L562: red L39
+L563: not r7
+prn r4
+L564: dec L606
+L565: jmp *r7
+L566: .string "ltiaqqbabkyvcbfxbtdoshz"
+L567: sub #183, r6
+L568: inc *r0
+L569: not L585
+L570: jsr L392
+jmp L594
+L571: .data -273
+rts
+jsr *r2
+L572: not L220
+; comment
+L573: mov #11, L98
+L574: sub *r3, r1
+L575: stop
+jsr *r5
+sub r6, r2
+L576: sub #185, *r2
+L577: .data 464, -969, 533, -300, -900, 735
+jsr *r1
+L578: add L554, L595
+L579: jsr *r4
+jmp L493
+; comment
+not *r3
+jsr L590
+prn r2
+L580: inc r2
+L581: sub L356, r4
+L582: bne *r7
+L583: dec *r1
+clr r6
+L584: cmp L163, r7
+rts
+L585: prn *r1
+jsr L590
+L586: bne L587
+L587: add #218, r1
+jsr *r6
+L588: .data 310, -189
+L589: cmp *r2, #10
+jmp L595
+L590: cmp *r3, L609
+L591: jsr *r7
+mov #250, r7
+L592: bne *r7
+L593: add r1, L200
+L594: rts
+L595: stop
+L596: lea L602, *r4
+not *r7
+L597: prn *r3
+L598: not *r7
+L599: inc *r5
+prn r6
+L600: cmp *r5, *r6
+L601: sub #236, r3
+L602: rts
+stop
+L603: jsr *r3
+L604: stop
+L605: jmp L440
+L606: stop
+L607: mov #-144, *r3
+L608: cmp L609, r2
+red r5
+L609: .data -495, -883, -636, -472
+stop
@@ -0,0 +1,1040 @@
+; Generated by genCorpus --seed 20
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+L0: .string "ww"
+clr L0
+bne *r2
+L1: red r7
+prn r7
+prn r0
+L2: lea L2, *r4
+L3: not L0
+clr *r0
+L4: rts
+L5: .data -219, -700, 112, 534, -250, 624, 522, 267
+L6: cmp r3, #-100
+L7: jmp L2
+jmp L5
+; comment
+
+not L100
+L8: add *r0, L0
+lea L6, L3
+L9: bne *r0
+L10: red L493
+L11: bne L200
+stop
+prn *r3
+rts
+L12: not r1
+L13: mov #-29, L2
+jsr L21
+L14: bne *r1
+L15: not L299
+add #-166, L15
+bne L1
+jsr L388
+sub L468, *r0
+dec *r4
+L16: lea L533, r6
+L17: dec r5
+lea L14, r7
+
+L18: prn L7
+inc r4
+L19: inc r6
+L20: stop
+L21: inc L5
+L22: mov L9, *r7
+L23: not r3
+L24: .data -701, 844, -415, -265
+sub #-43, r1
+not *r0
+bne *r0
+L25: bne L177
+rts
+sub L17, r1
+jmp *r1
+L26: prn r3
+inc r2
+L27: dec L190
+inc L26
+clr r6
+rts
+L28: mov #-208, *r1
+lea L2, *r3
+L29: rts
+not L152
+red L4
+L30: jsr *r0
+L31: jsr *r1
+L32: add *r3, r3
+L33: jmp *r2
+dec L29
+L34: .data 62, -880, -159, 506, 495, 627
+inc L497
+L35: jmp *r5
+L36: dec r4
+L37: inc L65
+L38: add #231, r3
+L39: stop
+L40: stop
+L41: .data 507, -987, 808, 18, -789, -401, -275, -59
+cmp *r5, *r0
+L42: rts
+L43: inc L43
+L44: sub r1, r6
+L45: lea L39, L22
+mov #48, L349
+; comment
+jsr L26
+L46: cmp #191, r0
+not r5
+L47: mov *r1, r4
+L48: cmp *r4, *r2
+L49: stop
+L50: not r4
+dec r2
+; comment
+L51: jmp L341
+L52: clr *r2
+; comment
+L53: cmp L333, *r1
+L54: stop
+dec *r3
+L55: add L17, *r0
+red r4
+L56: stop
+bne *r5
+L57: .string "pkadrbrzrk"
+sub L186, r0
+L58: add #176, L54
+mov #60, r4
+jsr *r7
+L59: lea L443, *r7
+L60: clr *r2
+inc *r5
+bne L435
+L61: clr *r7
+rts
+L62: sub L167, r7
+L63: jsr *r1
+L64: .string "ouatcjbkcojresiabuvq"
+L65: red r2
+L66: sub *r1, L414
+L67: .string "ddcssusahjop"
+mov #-217, L305
+
+L68: mov #124, r3
+L69: lea L63, L29
+sub #-11, r3
+L70: rts
+L71: inc L355
+L72: dec *r6
+L73: inc *r1
+L74: dec L14
+L75: red r7
+L76: stop
+bne L144
+lea L70, r5
+L77: jmp L402
+; comment
+L78: jmp L18
+L79: rts
+L80: stop
+jsr L37
+L81: inc L476
+inc L49
+L82: mov L544, L195
+L83: .data -846, 279
+L84: sub *r6, *r6
+jsr *r6
+L85: rts
+inc r7
+clr *r3
+sub *r3, r1
+L86: inc r4
+rts
+L87: dec r4
+L88: inc L80
+L89: sub r7, r2
+L90: jsr *r1
+L91: sub *r0, *r1
+lea L261, r4
+L92: dec r3
+L93: jmp *r5
+L94: clr *r2
+L95: add L24, L535
+L96: .data -748, -301, -972, -411, -878, -761
+L97: not *r1
+L98: bne L15
+L99: jmp L83
+L100: .data -616, -12
+L101: red *r0
+L102: stop
+L103: cmp r6, #-239
+L104: .string "yqyxnrvgkaicj"
+L105: .data 891, 665, 949, -396, -378, -645, 320
+L106: .string "wjlhrzurkrl"
+L107: dec *r6
+L108: inc L103
+L109: mov L104, L513
+mov *r0, L376
+lea L160, *r2
+; comment
+L110: dec L176
+red L44
+L111: cmp #-38, L73
+mov #64, *r0
+L112: .data -253, -909, 215
+L113: rts
+add *r1, *r3
+lea L109, r6
+L114: jsr *r3
+clr r6
+L115: clr r5
+rts
+L116: inc L14
+clr L78
+lea L199, r3
+L117: add r0, r6
+sub #-171, L375
+L118: jsr *r2
+bne L23
+L119: sub *r5, r7
+L120: not r1
+red *r0
+L121: dec *r0
+L122: lea L543, *r4
+L123: lea L333, r2
+L124: sub #60, *r5
+L125: stop
+L126: jsr L275
+sub r2, *r0
+L127: cmp L249, L84
+cmp r4, *r5
+inc L590
+red L113
+L128: prn L13
+L129: sub L531, *r6
+sub r4, *r2
+cmp #210, #11
+prn L424
+prn #205
+L130: add r6, L175
+stop
+L131: add r5, L240
+; comment
+not L163
+L132: rts
+L133: sub r1, r4
+L134: lea L10, r3
+L135: bne *r3
+L136: prn #-213
+prn *r2
+L137: stop
+L138: .data 642, 137, 73, -827, 923, -228, 825
+L139: jmp *r3
+L140: red r5
+clr r1
+L141: clr r5
+L142: bne *r5
+L143: prn #-126
+L144: jsr L49
+L145: sub #-31, *r4
+L146: sub #80, L501
+L147: add r6, *r7
+add r6, r0
+red L378
+L148: lea L373, r3
+add r7, *r6
+lea L160, L21
+red r5
+L149: jmp *r6
+L150: sub r1, r1
+inc r0
+lea L213, r3
+jmp *r0
+lea L435, r6
+L151: add r0, r0
+add L114, r4
+L152: cmp #13, r7
+L153: rts
+L154: .data 687, -163, -911
+rts
+L155: add L2, r6
+lea L18, *r1
+L156: not *r2
+cmp r0, L92
+L157: inc L135
+mov r0, r5
+; comment
+L158: lea L168, L272
+L159: sub #78, L206
+L160: mov *r0, *r0
+L161: red L32
+L162: bne *r3
+L163: cmp r1, *r4
+L164: add *r2, *r1
+mov r6, L387
+L165: red r2
+lea L30, L288
+L166: red L431
+L167: inc r0
+L168: bne *r0
+L169: stop
+L170: rts
+L171: inc *r3
+rts
+clr *r1
+cmp *r4, *r3
+L172: lea L123, r0
+jmp *r4
+L173: mov L68, *r4
+L174: sub L525, *r1
+L175: rts
+sub r7, L126
+L176: .data 138, -716, -91
+stop
+dec L454
+; comment
+inc L552
+L177: clr r6
+bne *r5
+L178: jmp *r7
+red L78
+red L559
+L179: not L162
+sub #-92, *r1
+L180: .string "kyuuiawledzzwiwmzvuqln"
+L181: cmp L109, #115
+L182: dec L517
+L183: rts
+L184: .data -312, 33, -747, 913, 122, -237
+L185: mov r5, *r4
+L186: jsr L335
+L187: lea L149, L109
+L188: clr r2
+not L38
+prn *r7
+L189: .string "vlevdstweppoykpan"
+L190: stop
+L191: stop
+; comment
+bne L161
+L192: add *r5, *r6
+L193: cmp L527, r4
+L194: prn r0
+cmp L52, #-182
+cmp r6, #-151
+L195: .data 554, -284
+L196: prn r2
+not r3
+L197: jsr *r2
+L198: dec L410
+L199: red *r1
+sub r6, *r4
+L200: prn L110
+prn #51
+L201: cmp r5, #93
+L202: stop
+lea L67, L61
+dec r2
+bne *r0
+L203: lea L148, *r0
+L204: jmp L72
+L205: sub L199, *r5
+dec *r0
+L206: mov *r6, r3
+L207: stop
+jsr *r2
+stop
+L208: rts
+bne *r6
+clr r1
+inc L2
+inc r7
+L209: add #146, L245
+; comment
+add *r5, r6
+prn r4
+jsr *r6
+prn *r0
+L210: sub r4, *r3
+cmp r5, L242
+not *r7
+jsr *r6
+red *r2
+cmp r3, L294
+L211: .data 838, -826, 668, 99, -522, 228
+L212: .data 342, -275
+L213: lea L435, r1
+L214: cmp #-75, L187
+L215: jmp *r4
+L216: clr L150
+mov L147, L263
+prn *r1
+L217: mov #90, L93
+L218: .string "wjjfgmwpk"
+; comment
+L219: clr r6
+L220: .data 624, -556, 408, -189, -592
+; comment
+L221: bne L168
+L222: lea L561, L60
+L223: jmp *r6
+add r0, r6
+cmp r0, L363
+L224: .string "bpguqlzzsyeidvp"
+
+L225: rts
+mov r2, L237
+L226: stop
+L227: clr r0
+L228: jsr L500
+L229: cmp L170, L303
+L230: sub L507, *r6
+L231: red *r3
+not r4
+L232: mov r6, r6
+L233: not L235
+add L367, *r3
+L234: add #-193, L367
+L235: dec r4
+clr *r6
+sub #83, *r0
+L236: dec *r4
+inc r5
+L237: clr L243
+cmp #-69, r0
+rts
+L238: sub #-24, L482
+L239: cmp L465, r6
+L240: bne *r7
+L241: stop
+L242: mov *r0, *r1
+L243: red r3
+L244: .data 377, -215
+L245: .data 69, 240, 265, 933, 834, 405, 776, -46
+L246: rts
+L247: inc L152
+lea L203, L362
+L248: cmp *r3, r4
+add L516, *r2
+sub L571, *r3
+L249: not L232
+L250: .string "fbsvuuscvoezlu"
+prn #102
+L251: lea L262, *r3
+
+L252: rts
+sub L375, r7
+L253: jmp L398
+L254: dec *r3
+jsr L335
+red *r5
+inc *r7
+L255: prn #-166
+rts
+L256: jsr L46
+L257: sub #-71, r5
+L258: cmp #-110, L249
+bne L463
+
+L259: .string "ki"
+sub #-24, *r7
+L260: clr *r0
+rts
+L261: add *r0, *r1
+L262: not *r0
+L263: .string "ypptucypkyk"
+L264: red *r5
+jmp *r0
+L265: .string "emiosnj"
+clr r5
+L266: jmp L246
+L267: cmp *r5, L204
+L268: sub #212, L356
+L269: not r4
+L270: stop
+L271: rts
+jsr L65
+add r0, r7
+stop
+mov r3, *r4
+L272: sub r4, L505
+L273: clr r2
+dec r1
+L274: red r2
+rts
+L275: jsr *r5
+dec *r4
+L276: .data -957, 651, 0, -886, -257, 2, -585, -284
+L277: dec r2
+rts
+jmp L587
+add r3, L506
+mov r4, L443
+lea L446, r5
+L278: cmp #-97, *r3
+L279: cmp #-94, r4
+L280: mov #-58, L98
+red *r7
+L281: not r0
+L282: inc r0
+L283: jmp *r6
+L284: .data -262, 522, -658, 929, 398, 100, 453, -260
+L285: inc L414
+lea L79, *r4
+L286: stop
+; comment
+L287: jsr *r4
+rts
+mov L8, *r5
+L288: jsr L51
+L289: .string "vfwavjesftogowkf"
+jmp L506
+dec *r6
+L290: rts
+L291: inc r1
+clr r3
+L292: inc L45
+L293: red L201
+L294: stop
+L295: add *r1, L457
+L296: clr *r7
+L297: dec r1
+bne *r0
+L298: lea L589, L166
+; comment
+cmp L363, L238
+
+L299: .string "ggvjicujstieshvjvkjdx"
+prn L81
+L300: dec r0
+stop
+red L329
+L301: red *r2
+L302: red *r3
+L303: lea L341, r2
+L304: inc r7
+L305: cmp *r0, r2
+L306: bne *r2
+dec r3
+L307: bne L282
+lea L529, r4
+L308: .data 706, 302, -41, -416, -73, -958
+L309: .data -364, 257, 50, -902, 371, -53, 208, -5
+L310: inc *r2
+L311: prn *r1
+L312: lea L82, *r0
+L313: add L357, L185
+red L279
+; comment
+L314: jmp L564
+L315: .string "vqlsfecoploumqirujofggn"
+L316: .data 692, -311, -583, -669, 1
+L317: not *r3
+red r7
+jsr *r3
+prn r4
+L318: inc r2
+L319: bne *r5
+L320: jsr *r3
+lea L472, r1
+clr L306
+add L258, r4
+L321: .string "ochetezjpgfnoslrkog"
+L322: bne *r4
+jsr L316
+L323: mov L367, *r1
+dec r1
+lea L101, L17
+L324: clr L499
+L325: cmp #215, *r2
+L326: lea L289, r0
+L327: red L146
+L328: dec *r5
+L329: sub #3, *r3
+
+lea L580, r0
+L330: rts
+L331: dec *r3
+L332: cmp L321, #-93
+prn r0
+L333: add r4, r3
+rts
+L334: stop
+L335: not L481
+; comment
+lea L458, L135
+L336: clr L232
+L337: cmp *r2, L168
+bne L461
+L338: .string "znwnstqqkcrnbbfukbvtgb"
+inc *r2
+L339: mov *r3, r1
+L340: lea L477, *r5
+L341: red *r4
+L342: red r7
+L343: not r6
+L344: .string "agjzhnvqbroip"
+jsr *r5
+
+L345: mov L396, *r5
+; comment
+red r4
+mov *r4, L516
+not *r1
+L346: cmp *r5, r2
+L347: inc *r2
+dec L87
+mov L17, r7
+L348: rts
+L349: jsr L438
+L350: red *r6
+L351: .string "hdmokujvbjtd"
+L352: red r0
+stop
+L353: red L493
+L354: dec r1
+L355: mov L386, L38
+L356: sub r3, *r6
+L357: sub #8, L562
+L358: sub *r5, L365
+add L369, r4
+L359: stop
+L360: inc *r6
+prn L207
+prn *r1
+not L572
+L361: inc L526
+L362: cmp *r5, L253
+L363: red *r7
+L364: prn r0
+L365: jsr L416
+L366: clr *r1
+L367: jmp L528
+stop
+L368: clr L304
+bne L291
+lea L108, r2
+stop
+L369: .string "mtay"
+L370: sub L344, L379
+L371: .data -780, 514, 86, -381, -169, -734, 709, -699
+L372: .string "edkeaayacqqzjbsncu"
+L373: bne *r1
+L374: add L4, r3
+prn *r4
+cmp #-199, r3
+stop
+L375: .data 455, 313, 148, -53, 968, 292, 191
+L376: jsr L209
+L377: mov #10, r1
+L378: inc r2
+L379: jmp *r7
+stop
+L380: add L49, r5
+L381: cmp L559, #10
+cmp *r7, r4
+L382: sub #191, r1
+L383: prn L16
+L384: bne *r7
+L385: not L514
+mov #-161, *r4
+L386: dec *r4
+bne *r6
+
+L387: rts
+L388: dec L549
+L389: rts
+L390: .data -125, 312, -320, 983, -783, 443, 940, 628
+; comment
+L391: prn r5
+L392: sub r4, L490
+L393: stop
+stop
+jsr L429
+cmp #1, *r7
+jsr *r7
+L394: prn #130
+L395: bne L548
+L396: clr r1
+add #218, r6
+
+L397: .string "qxxfzoaiubtjxud"
+L398: add *r4, L184
+L399: inc L186
+sub r7, r6
+L400: .data -166, -969, -346, -48, -381
+; comment
+lea L105, r1
+
+prn L35
+L401: add r4, *r0
+inc L289
+L402: sub L507, r1
+rts
+L403: .string "cyhopgzhgmbpoephvxwfjry"
+L404: not *r6
+L405: clr r0
+dec L187
+L406: cmp L519, L197
+; comment
+L407: add #-245, L207
+L408: cmp r1, *r1
+L409: not r0
+L410: not r7
+L411: dec L105
+L412: .data -958, -856, -426, -438, 348, 561, -305, 676
+inc L426
+L413: inc *r3
+stop
+L414: prn #-139
+L415: jsr *r3
+; comment
+red *r4
+L416: .data -22, -793, -98, -791, 800, -398
+L417: stop
+L418: inc r7
+jmp *r6
+L419: rts
+L420: bne L164
+L421: jsr L462
+L422: .string "ryv"
+add r5, r4
+
+L423: dec *r1
+L424: .data -526, 704, -288, 515, 713
+L425: jsr L429
+bne *r0
+L426: clr L220
+prn r4
+L427: jmp *r4
+
+mov *r0, L437
+stop
+L428: inc L344
+L429: cmp r7, L532
+L430: lea L460, L434
+L431: rts
+not r0
+add L537, *r1
+L432: dec L354
+L433: .string "rv"
+L434: add r6, r0
+L435: .data 285, -716, -245, 855, 58, 342, 815, -115
+dec r6
+L436: mov L411, r2
+L437: jsr *r3
+L438: inc r7
+stop
+L439: cmp *r1, #139
+L440: add r5, *r4
+sub #101, r7
+L441: jmp L483
+L442: clr r6
+cmp *r6, L550
+L443: cmp L398, *r7
+L444: bne *r5
+L445: mov L464, L532
+L446: jmp *r2
+L447: bne L514
+rts
+L448: not L262
+jsr *r3
+sub r7, r2
+L449: clr *r5
+add #-87, L338
+L450: inc *r0
+jmp *r2
+L451: stop
+cmp #142, L297
+L452: .data -797, 329, 306, -320, -737, -470, -378, 445
+L453: add L529, r4
+sub #127, L458
+L454: add r3, r3
+not *r7
+L455: not r6
+L456: clr *r6
+jsr L533
+L457: red L91
+L458: mov #199, r2
+red L553
+L459: jsr L332
+L460: .data 86, -406, 156, -271, -642, -164, 234
+L461: add L307, r0
+jsr L589
+L462: .data 307
+L463: .data -647, 595, 153
+L464: not r4
+prn *r3
+bne L551
+stop
+; comment
+inc r4
+L465: dec r4
+; comment
+L466: rts
+not r1
+bne L46
+prn *r6
+dec *r3
+L467: lea L515, *r1
+L468: cmp #-32, #-158
+red L81
+lea L3, L232
+bne *r5
+L469: .string "oxaqy"
+L470: prn L551
+L471: bne *r6
+
+L472: .data -956, 731, 798, -453, 593, -816, 123, 638
+; comment
+L473: cmp #-11, L525
+L474: .data 27, 667, -913, -838, 897, -860, 264
+lea L543, L72
+not L226
+mov L479, *r2
+L475: clr L490
+L476: lea L241, r4
+L477: stop
+L478: bne L524
+L479: red L63
+L480: cmp r6, r3
+red *r7
+dec L569
+sub #139, L544
+jsr *r0
+bne *r2
+L481: cmp *r4, r4
+L482: clr r4
+L483: rts
+inc r6
+L484: cmp r4, *r1
+cmp L517, #32
+L485: lea L547, *r5
+L486: rts
+; comment
+L487: bne L273
+L488: sub *r0, r7
+L489: rts
+L490: .string "jp"
+L491: clr *r1
+L492: add L27, r0
+rts
+cmp *r7, *r3
+add L564, r3
+L493: .string "l"
+clr *r0
+not r6
+L494: rts
+L495: not L590
+L496: stop
+jsr L237
+L497: red L510
+L498: .string "ggcxufucigzaivkyaw"
+L499: stop
+jmp *r0
+L500: dec r1
+L501: cmp r5, r1
+clr r1
+rts
+inc r5
+L502: jmp L581
+add #-139, r5
+jmp *r0
+clr *r6
+L503: bne L543
+not *r7
+L504: .data -975, 6, -581, -71, -82, -712, -704
+L505: sub *r1, r7
+L506: not L507
+dec r6
+jmp *r3
+L507: bne L498
+L508: bne L592
+L509: not L512
+lea L576, *r7
+add r1, L61
+L510: not *r1
+jmp *r5
+L511: inc *r4
+L512: cmp L546, L277
+clr r5
+L513: clr L359
+L514: inc *r0
+L515: red L547
+not *r0
+L516: red r0
+L517: sub L548, *r0
+L518: lea L577, r2
+bne *r5
+L519: mov r3, L558
+L520: not *r1
+L521: red r3
+jsr *r3
+L522: .string "f"
+L523: mov *r3, r7
+L524: clr r7
+jmp L101
+L525: bne *r2
+inc r0
+L526: jsr *r6
+sub *r3, *r1
+jsr *r5
+inc L568
+rts
+sub L545, *r6
+L527: sub *r6, r4
+mov r0, *r2
+L528: .data -48, 635, 706, -701
+L529: prn L571
+L530: bne *r4
+L531: .data -17, 586, 963, 615, 767, -11, 348, -162
+L532: cmp L533, #23
+L533: dec r4
+rts
+L534: add *r0, L513
+L535: jmp L389
+
+L536: dec L420
+L537: not *r4
+L538: clr *r2
+L539: cmp r1, r3
+
+lea L582, r0
+stop
+L540: .data 381, -315, -487, 142, -248
+L541: inc L164
+red *r3
+L542: inc r6
+; comment
+L543: cmp r3, #193
+L544: add r5, L574
+L545: prn *r6
+L546: prn L526
+sub L555, r2
+add #187, *r6
+L547: sub r2, r5
+not L202
+L548: clr L558
+L549: jsr L331
+L550: .data 499
+L551: inc L382
+bne L468
+sub r4, r7
+L552: cmp L391, #1
+L553: bne *r4
+L554: inc L43
+rts
+
+L555: inc L425
+L556: red L195
+red *r2
+clr r2
+L557: prn L157
+mov *r2, *r1
+red r4
+L558: red *r5
+L559: jsr *r0
+red *r4
+L560: sub r1, L296
+L561: bne L468
+jmp L534
+L562: dec r3
+L563: .string "fplg"
+L564: jsr L578
+bne *r4
+inc *r4
+L565: clr L69
+L566: add #127, r7
+L567: inc L187
+add L579, r6
+jmp *r3
+L568: red *r3
+; comment
+L569: mov *r6, L315
+jmp L572
+L570: add L8, L579
+red L577
+L571: jsr *r5
+; comment
+L572: red *r4
+red *r6
+prn *r6
+L573: .data 795
+cmp L584, r5
+L574: dec r3
+L575: cmp *r4, r6
+dec r5
+L576: add #175, r6
+L577: dec L590
+clr *r5
+L578: red *r6
+L579: jmp L333
+lea L356, r1
+
+jmp L581
+L580: not L581
+mov r6, L592
+; comment
+L581: cmp L59, *r4
+jmp L588
+L582: bne *r7
+L583: jmp L590
+L584: lea L358, *r3
+red L288
+L585: .data -217, -817, 377, -637, -78, -672
+lea L412, r1
+L586: rts
+red *r2
+
+rts
+
+L587: jsr *r1
+L588: not *r0
+clr r5
+L589: clr *r5
+L590: cmp *r5, r2
+L591: cmp *r0, L592
+not L376
+L592: jsr L359
+stop
@@ -0,0 +1,1040 @@
+; Generated by genCorpus --seed 3
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+L0: sub r5, L5
+L1: .string "twvghbb"
+L2: jsr L280
+L3: bne *r7
+L4: red r4
+L5: .string "nzlliklnncvwexutiurivwoh"
+L6: .data 554, 145
+L7: jmp L1
+jmp L3
+L8: rts
+L9: bne *r0
+jsr L7
+L10: rts
+L11: cmp #-246, r7
+; comment
+L12: .string "gapezzlnlnjlnjjxizg"
+
+L13: rts
+stop
+inc *r4
+add L572, r2
+jmp L5
+L14: rts
+L15: mov *r2, r3
+L16: .data 167, 59, 874, 934
+prn #59
+L17: jmp L14
+L18: inc *r5
+L19: not r6
+L20: clr r5
+L21: prn r4
+L22: stop
+add #-64, *r4
+inc *r2
+L23: rts
+stop
+L24: cmp r2, L283
+L25: rts
+
+cmp L259, r6
+L26: rts
+L27: mov L23, L361
+L28: sub L470, L50
+; comment
+
+stop
+not r0
+L29: bne L24
+L30: bne L334
+L31: .data 208, -816
+
+lea L241, *r3
+bne *r0
+L32: .string "azvmzlphwd"
+L33: bne *r3
+L34: .string "tbgigwuokianuikafq"
+L35: not L30
+; comment
+L36: lea L35, L484
+L37: .data 348, -561, -173, 904
+
+L38: clr L92
+add *r6, *r6
+red L8
+cmp L460, #201
+
+L39: dec r0
+add r6, L164
+L40: jsr L146
+
+stop
+L41: stop
+L42: prn *r2
+L43: bne *r0
+dec L9
+L44: .string "zjrlwqwvucmmnfrbwu"
+L45: red r4
+L46: bne *r7
+L47: .string "oupwhdlgqtfgjokfw"
+L48: bne *r7
+mov r3, *r1
+rts
+inc L45
+cmp r6, #170
+L49: add r7, *r4
+L50: .string "kteyjqbvqewbianudt"
+; comment
+
+bne L243
+L51: jmp L19
+L52: jsr *r7
+bne *r2
+bne *r5
+L53: stop
+L54: lea L225, r7
+L55: .data -277, 322, -668, -740, 353, 33
+L56: not L563
+L57: dec r2
+L58: inc *r2
+L59: jsr L132
+; comment
+lea L28, *r5
+L60: dec L48
+prn #42
+
+L61: bne *r4
+inc *r5
+inc L6
+L62: not r6
+
+L63: add r7, L43
+L64: cmp L44, #181
+stop
+mov #-251, *r3
+sub r1, r1
+clr *r7
+sub r0, L389
+
+L65: bne L584
+L66: sub r5, r6
+prn L424
+stop
+L67: .string "wtlrggbu"
+L68: red *r6
+inc L43
+L69: .string "jnnchumj"
+L70: not r1
+dec L4
+L71: sub L110, L579
+L72: red L3
+L73: red *r5
+L74: clr r1
+jsr L476
+L75: .string "asvphgwuoxvhnzxzjhdvg"
+sub #40, L417
+mov L15, r5
+L76: mov *r6, L247
+jmp *r0
+L77: jmp *r0
+jsr L48
+L78: sub *r4, L197
+
+L79: jmp L238
+L80: stop
+cmp r0, r3
+L81: .string "xgyls"
+L82: add *r5, *r5
+L83: .string "kbqxgmgv"
+L84: sub *r2, L16
+L85: rts
+prn L579
+L86: prn r7
+inc L292
+L87: .string "nwr"
+L88: jmp *r5
+L89: jsr L443
+L90: .string "ldejfzhmzshsvl"
+sub *r6, *r7
+L91: not r7
+L92: prn L37
+L93: stop
+L94: lea L146, r6
+prn *r4
+L95: clr *r4
+L96: clr *r1
+jmp L50
+add r3, *r4
+L97: rts
+stop
+L98: stop
+L99: .string "edoj"
+sub *r7, r2
+L100: not r0
+sub *r6, L373
+L101: red r2
+L102: jsr *r5
+L103: bne L487
+L104: .data 688, -260, -386
+
+jsr L474
+L105: cmp *r0, #5
+L106: sub #63, *r5
+cmp r5, #-181
+cmp #33, #153
+L107: bne *r6
+L108: sub *r3, r0
+L109: inc *r3
+L110: add L54, L272
+dec r2
+L111: sub #-254, *r7
+L112: stop
+L113: jsr *r6
+clr r0
+L114: jmp L417
+L115: red r3
+L116: add L23, *r4
+L117: not L382
+jsr L20
+L118: prn #193
+L119: lea L44, L392
+L120: .string "aeztbdyadc"
+jsr L162
+inc *r6
+L121: inc r0
+L122: jsr L523
+mov r1, r4
+L123: lea L412, *r7
+L124: stop
+L125: lea L533, *r3
+L126: .data 968, 465, -258
+L127: lea L136, L45
+L128: rts
+L129: bne L543
+dec L244
+L130: inc L55
+lea L422, r1
+L131: stop
+jmp L536
+L132: .data 744, -369, -794, 615, 782, -511, 779
+dec r0
+prn r0
+lea L565, r2
+red L70
+clr *r3
+
+L133: inc L10
+cmp r6, *r3
+L134: rts
+L135: inc *r7
+inc L81
+mov L61, *r5
+bne *r5
+lea L202, L472
+inc L349
+L136: cmp *r4, #94
+L137: stop
+cmp #167, r5
+rts
+L138: jmp *r2
+L139: dec *r1
+L140: jsr L124
+L141: inc r2
+L142: clr *r7
+L143: not *r0
+L144: add *r5, L534
+L145: cmp L45, L301
+prn #-95
+L146: add L431, L323
+L147: sub *r5, L559
+L148: red *r5
+L149: red L97
+L150: bne *r2
+L151: bne L431
+; comment
+L152: jsr L12
+L153: dec L86
+L154: stop
+L155: .data 156, 174, -400, -318, -730, 912
+L156: rts
+L157: cmp #66, L277
+cmp *r3, r4
+L158: .string "wzbzltij"
+L159: .data 610, -700, 53
+red r1
+L160: rts
+L161: .data 690, 662, 918, 188, 70, 157, -43, -261
+L162: jsr *r6
+cmp *r4, *r2
+sub L89, L127
+inc L5
+L163: clr *r1
+sub r7, L410
+L164: clr L128
+rts
+L165: .string "phqryysxf"
+L166: bne *r7
+L167: prn *r5
+L168: jsr *r1
+bne L498
+L169: .data 175, -522, -873, 121, -583, -398
+add L367, L96
+dec *r3
+L170: sub #134, *r1
+jsr *r3
+L171: lea L443, *r1
+L172: rts
+L173: not *r3
+L174: lea L171, r1
+L175: inc r5
+inc L555
+L176: jmp *r1
+L177: jsr L319
+L178: mov *r0, L394
+L179: cmp #-28, #171
+jsr *r4
+clr *r3
+rts
+L180: lea L78, L276
+not r7
+dec L269
+L181: sub #-13, *r0
+stop
+not r5
+L182: jsr L22
+rts
+dec r4
+L183: mov L53, *r3
+L184: rts
+L185: lea L505, *r5
+L186: not r2
+cmp L258, r6
+sub r4, *r3
+
+L187: dec L121
+lea L352, r0
+not r7
+L188: .string "j"
+add r0, L184
+cmp L500, L104
+prn L521
+stop
+prn *r3
+stop
+rts
+mov L383, *r2
+L189: bne L70
+jmp *r1
+stop
+L190: .data 807, 696, -909, -22, 621, -58, -819, 171
+dec r1
+L191: stop
+L192: dec L529
+stop
+cmp *r1, L200
+L193: .string "ydir"
+dec r6
+L194: .string "rfddmozzm"
+L195: .data 180, 186
+bne *r1
+jsr L517
+red *r5
+not r0
+
+not L496
+L196: red L20
+add L27, r6
+L197: rts
+L198: stop
+L199: not r7
+L200: jmp *r1
+L201: rts
+L202: jsr *r1
+L203: dec L203
+dec *r2
+L204: .string "zgloqywnnthnzrtactwsceti"
+L205: lea L501, L376
+L206: jmp L570
+L207: rts
+jsr *r0
+L208: prn L451
+not r1
+dec L486
+lea L27, L108
+L209: clr L77
+L210: .data -17, -38
+L211: .data -871, 914, -952, -115, -879, 764, -968
+L212: .data -974, 458, 478, 207, -609, -258, -239
+L213: sub #121, L63
+L214: mov #88, r0
+L215: rts
+L216: dec *r7
+add L51, r0
+stop
+prn #-233
+L217: lea L391, L97
+L218: clr L136
+L219: lea L276, L281
+rts
+L220: bne *r2
+inc *r2
+jsr L118
+L221: rts
+dec r2
+stop
+L222: prn r3
+L223: rts
+lea L386, r1
+jsr L442
+L224: cmp #-77, #195
+L225: red L379
+not *r4
+L226: sub r4, *r5
+jsr *r7
+add #148, *r5
+lea L33, L46
+L227: jsr L63
+L228: red L213
+L229: not L85
+L230: jsr L88
+prn #244
+L231: bne L422
+L232: stop
+L233: jsr L14
+cmp L60, #-183
+L234: stop
+L235: .data 321
+L236: not L587
+L237: red *r2
+L238: dec *r6
+L239: clr *r3
+stop
+L240: not *r5
+L241: prn *r6
+inc L333
+red r5
+add *r7, *r5
+not *r7
+not *r5
+stop
+L242: sub *r3, L352
+L243: jmp L229
+L244: lea L101, L21
+red *r4
+L245: sub *r5, L447
+sub r2, L271
+L246: .data -938
+rts
+jmp *r6
+L247: jmp L187
+L248: add L177, r1
+L249: prn #-2
+L250: jsr L243
+L251: dec r2
+L252: add L352, *r6
+L253: .string "ltwsfasqnoxkxsuzvyywhiu"
+L254: .data -124, 239, 79, -414, -945, 884
+sub r1, r7
+L255: inc *r2
+L256: dec *r7
+L257: .string "ddvcxxbs"
+sub *r7, *r4
+L258: dec r0
+L259: .data -96, -506, -28, -149, -902, 95, -496
+L260: red L371
+L261: cmp *r2, r4
+L262: .data 617
+L263: jsr L290
+L264: add *r5, r2
+L265: .string "vxwtefemph"
+L266: not L49
+jsr L39
+bne L100
+L267: cmp r0, L267
+L268: stop
+L269: bne L214
+L270: clr r7
+rts
+L271: cmp *r7, L375
+L272: rts
+L273: jmp L319
+L274: lea L410, *r3
+L275: .data 607, 423, 191, -117, -709
+add L265, L147
+L276: not *r4
+stop
+L277: prn r5
+L278: not *r6
+L279: add *r1, L210
+
+L280: cmp r3, *r3
+L281: clr r7
+L282: .string "dyixpgpmikvpnzkb"
+add #-10, *r4
+inc r5
+dec *r5
+L283: not L272
+L284: rts
+lea L8, r4
+sub L147, *r2
+L285: not r6
+L286: lea L484, *r0
+bne *r3
+L287: prn *r3
+jmp L11
+L288: mov #40, L499
+L289: red r7
+L290: stop
+L291: lea L281, r7
+red *r4
+stop
+red *r4
+L292: lea L159, *r7
+sub #238, r0
+L293: not L543
+L294: add r4, *r7
+L295: inc *r4
+L296: dec L561
+mov r1, *r0
+L297: lea L199, *r2
+lea L151, *r6
+jsr L231
+L298: rts
+L299: bne *r2
+prn #-215
+stop
+L300: cmp *r3, *r0
+L301: mov r4, L129
+inc L361
+L302: prn *r1
+prn *r6
+clr r7
+L303: inc *r1
+cmp #72, L364
+L304: prn r6
+L305: jmp *r2
+L306: cmp r1, *r5
+L307: red r6
+L308: mov #-215, L395
+jmp L80
+L309: dec L21
+L310: .string "nthjsaukznezqd"
+L311: clr *r3
+dec L90
+inc *r3
+L312: .data 414, 893
+L313: jmp L583
+add r1, L402
+L314: jmp L487
+L315: .data -566
+
+stop
+mov r5, L460
+L316: red *r1
+L317: .string "mijlgzuwd"
+L318: .data 971
+L319: .string "ckupmpjrznnwdccghcus"
+L320: stop
+jmp L300
+L321: red *r0
+jsr *r1
+L322: red L137
+mov #107, L249
+add *r5, L51
+L323: jmp L543
+L324: jmp *r3
+prn *r3
+L325: clr L577
+sub *r1, r7
+L326: inc *r3
+L327: cmp L361, r4
+L328: red r6
+L329: .string "bhvebzqcfsipiuxq"
+
+L330: jmp *r4
+L331: prn r3
+cmp #-254, #-65
+red L513
+L332: red L504
+L333: jmp *r1
+jmp L398
+red L8
+L334: .data 880, -277, 382, -957, -723, 439, -942
+L335: prn *r5
+stop
+L336: cmp *r6, L35
+L337: lea L442, *r1
+L338: mov r3, r4
+rts
+L339: .string "axrrcxninpells"
+L340: rts
+L341: not *r4
+L342: jsr *r6
+L343: red *r3
+L344: .string "wfoetmjckdhvpcq"
+L345: jsr L146
+L346: inc *r7
+L347: not *r1
+prn *r7
+L348: .string "rntypixqvsx"
+not *r7
+
+red *r1
+L349: .string "fgmvyzkjeel"
+inc r7
+L350: lea L470, *r2
+L351: jsr L585
+L352: add *r3, *r1
+clr r2
+L353: bne *r6
+L354: jmp *r0
+
+add L560, r2
+L355: rts
+inc r6
+L356: add L63, *r7
+dec r1
+L357: inc L475
+mov L477, r1
+L358: not *r1
+L359: jmp L247
+L360: stop
+L361: .data 743, -863, 543, 516, 227, 855, -688
+L362: clr L525
+L363: lea L75, L336
+
+inc L330
+L364: jmp *r6
+L365: inc L291
+L366: .data -336, -831, 618, -599, -807, -294
+sub #95, r7
+L367: jsr L171
+L368: .string "udcwffzzxvqnh"
+L369: mov *r0, *r1
+jmp L343
+L370: dec r0
+L371: stop
+L372: .string "tcsxgnbywdirbmhvs"
+L373: bne *r1
+L374: .string "czkkxsmqjhlftlwx"
+L375: stop
+L376: lea L178, *r6
+L377: bne L30
+L378: mov #-28, r6
+L379: lea L78, r5
+L380: prn L591
+not r1
+L381: not *r3
+L382: stop
+L383: dec L478
+L384: .data -402, 919, -76, -725
+inc r0
+bne L324
+dec L497
+; comment
+L385: stop
+L386: bne L583
+L387: bne L290
+L388: .string "rgjctcujhesgqvfc"
+L389: bne *r0
+cmp #203, L468
+bne L537
+add *r2, L531
+L390: sub r1, r2
+lea L198, L549
+L391: rts
+rts
+
+L392: jmp L560
+mov r5, L549
+clr *r4
+red r5
+L393: mov L434, *r4
+L394: inc *r2
+L395: lea L483, r2
+L396: inc *r1
+bne L417
+L397: jsr L150
+L398: .data 989, -355
+
+L399: red *r7
+cmp L527, r7
+inc *r4
+L400: clr r6
+inc *r1
+L401: rts
+mov #229, r5
+bne L79
+not L436
+L402: jsr *r1
+L403: .data -706, 157, 849, -927, 663, 658, -103, -324
+L404: dec *r0
+L405: inc *r3
+lea L174, r2
+sub #168, L478
+red L508
+L406: clr *r5
+L407: jmp *r2
+dec r5
+L408: rts
+L409: .string "zymxqrly"
+prn L319
+prn *r5
+L410: inc *r7
+L411: .data 845, -452, -578, 562, 710, 209
+L412: lea L231, r4
+L413: jsr *r5
+stop
+L414: cmp *r7, #45
+L415: add *r3, r5
+jmp *r3
+add L517, L532
+prn r0
+not r2
+L416: clr *r4
+L417: sub #53, *r7
+; comment
+L418: mov L202, L55
+L419: mov r3, L96
+L420: clr r0
+L421: jsr L345
+; comment
+L422: .string "jjzkcyrsfqzdhxoj"
+prn #155
+mov r3, r4
+L423: sub *r4, *r4
+lea L248, *r5
+
+L424: jmp *r6
+stop
+L425: jmp L429
+jmp L361
+L426: add r6, L231
+L427: jmp *r4
+L428: red L307
+L429: not *r7
+L430: stop
+prn #149
+L431: cmp L570, *r2
+L432: clr *r1
+L433: rts
+prn L500
+rts
+inc L572
+L434: jmp *r5
+inc L214
+L435: not *r1
+L436: sub r5, r6
+L437: prn r2
+L438: .string "hbcaiiizem"
+L439: rts
+mov *r1, L527
+prn #189
+L440: lea L501, r4
+L441: red r5
+inc L316
+L442: dec *r2
+mov *r0, *r5
+L443: clr r7
+bne L51
+prn L88
+sub *r2, L353
+prn r2
+prn *r7
+L444: rts
+L445: cmp L512, #114
+rts
+L446: lea L294, *r4
+L447: bne *r3
+L448: clr *r2
+L449: dec r2
+L450: stop
+L451: mov L236, r7
+cmp #-96, *r0
+L452: mov *r3, *r5
+L453: .data -33, 685, 840, 951
+L454: dec *r2
+L455: .data -567, -924, -509, -155, -994, 94
+sub L570, r4
+
+L456: clr r3
+L457: stop
+L458: sub #90, r2
+jmp L27
+L459: lea L164, *r1
+L460: jmp L547
+red L502
+L461: red r2
+sub L424, r4
+L462: mov *r0, *r0
+L463: jsr *r4
+not *r1
+
+clr r2
+L464: .data -107, 543, -855
+jmp L309
+L465: .string "lnydczliaaoiad"
+L466: red L553
+red r4
+L467: bne L206
+bne *r1
+cmp #-104, r0
+L468: mov *r6, r7
+L469: stop
+L470: bne L387
+L471: stop
+L472: prn *r1
+add #-172, *r7
+L473: cmp r1, *r1
+L474: .data -851, -557, 919, 537, 897, 661, -613, 217
+add r0, *r4
+L475: dec r4
+L476: bne L344
+lea L520, *r4
+
+L477: lea L558, L10
+L478: stop
+L479: add L49, L55
+L480: clr r1
+L481: .data -538, -773
+L482: sub L561, L484
+; comment
+dec r2
+L483: clr r3
+L484: .string "sk"
+L485: prn r4
+jsr *r1
+red *r0
+L486: mov *r3, *r2
+L487: jmp L389
+L488: lea L188, L586
+L489: cmp r3, #-157
+
+stop
+inc *r4
+L490: not L491
+L491: dec *r4
+L492: .string "nmuovouvgwbhbmdt"
+L493: inc *r7
+L494: prn #174
+L495: mov *r4, L344
+mov *r1, L520
+mov *r1, *r3
+L496: inc L158
+L497: .string "acsneenyjbnpezds"
+L498: .string "rxbkxxtbtcgssjc"
+L499: .string "fsr"
+L500: dec L181
+stop
+L501: stop
+L502: .data -234, -899
+lea L138, L45
+L503: jmp *r6
+bne *r6
+L504: lea L440, L559
+L505: .string "szeqsorxngmwtpypr"
+L506: not *r0
+jmp L2
+lea L351, r3
+L507: bne *r4
+jsr *r7
+L508: .data -783, -404, -436, -735, 907
+L509: lea L383, L160
+prn L54
+L510: clr r0
+L511: red r0
+L512: clr *r2
+; comment
+L513: mov *r6, L557
+L514: prn *r2
+not *r4
+prn *r4
+L515: not *r3
+L516: .data 469, 29, 748, 796, -51, -25
+L517: jsr L551
+cmp L455, L544
+inc r3
+jsr *r5
+mov L581, r2
+sub *r3, r6
+L518: red *r1
+not L443
+L519: stop
+L520: .string "kndtgtaqaogtnvxeexejb"
+L521: .string "yobiwpmvekx"
+L522: jsr L305
+L523: cmp r6, *r4
+L524: lea L534, *r1
+mov #238, r6
+cmp #-171, r6
+L525: sub #90, *r4
+L526: mov *r5, L549
+clr *r0
+stop
+L527: stop
+; comment
+stop
+L528: lea L551, L548
+L529: lea L254, *r7
+dec L555
+L530: dec *r5
+red L533
+L531: .data -351, 118, -685, -866, -871
+lea L450, r0
+L532: jmp L533
+jsr L575
+not *r6
+L533: sub L557, r7
+prn #208
+prn r6
+mov *r5, *r6
+L534: jmp *r6
+L535: inc r3
+L536: inc *r6
+L537: cmp #211, #-57
+L538: cmp L554, #-73
+prn r1
+L539: mov r2, *r2
+clr L404
+L540: lea L549, *r1
+L541: .data -425, 484, 375, -565, 883, -41, 110, 955
+L542: cmp r3, L550
+L543: rts
+dec r4
+L544: bne L580
+L545: dec r1
+L546: mov L422, L549
+L547: sub r6, *r5
+L548: prn L346
+jmp L590
+L549: jsr *r7
+L550: mov r3, L238
+L551: stop
+L552: .string "ylimjvgyxxbgsfuzshnu"
+L553: cmp L587, #161
+; comment
+L554: sub r6, L577
+red r3
+L555: rts
+L556: .data -86, 131, 752
+L557: inc L581
+L558: not *r6
+L559: sub L270, *r7
+L560: rts
+L561: add #-34, *r3
+stop
+bne L584
+mov #-95, r4
+
+L562: sub r2, r6
+sub #91, *r4
+cmp L321, #223
+L563: red r0
+mov L298, *r5
+clr *r5
+L564: prn *r5
+rts
+jsr *r5
+L565: not L581
+
+L566: cmp *r6, *r1
+L567: bne L261
+L568: jmp *r1
+L569: sub *r4, *r7
+; comment
+stop
+L570: .data 812
+lea L597, L244
+mov *r0, r6
+add #-202, r6
+
+L571: inc L188
+bne L286
+stop
+L572: .data 551, -305, -834, -786, -469
+L573: sub *r5, r0
+L574: jsr *r4
+cmp L572, r0
+cmp #65, #-58
+rts
+L575: prn L254
+L576: rts
+L577: prn #41
+L578: clr L594
+L579: red r0
+dec L186
+bne *r0
+L580: stop
+L581: .data 298, -831, -64
+red *r3
+L582: red r1
+cmp #-13, #-55
+red r1
+L583: sub L354, r3
+L584: jmp *r4
+L585: clr *r3
+L586: inc *r7
+L587: not L594
+L588: prn r1
+rts
+L589: not L596
+sub L590, r1
+L590: dec *r7
+stop
+jsr L594
+not *r5
+L591: clr r2
+L592: .data -980, 492, -557
+L593: inc L382
+stop
+bne *r7
+stop
+L594: add *r0, r5
+L595: jmp *r0
+clr L598
+L596: not *r3
+L597: stop
+cmp *r3, r2
+add #114, r6
+L598: bne *r6
+not r1
+stop
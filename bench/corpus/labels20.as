@@ -0,0 +1,1040 @@
+; Generated by genCorpus --seed 21
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+L0: bne L538
+stop
+L1: jsr *r3
+L2: mov r3, r4
+L3: mov *r6, L0
+L4: jsr L270
+
+jmp L1
+L5: bne *r5
+
+L6: mov *r2, *r2
+L7: .data 481, 14, -229, -318
+dec r6
+L8: lea L395, *r1
+stop
+jsr *r6
+L9: cmp L5, L2
+L10: rts
+L11: bne L33
+L12: jmp L545
+lea L476, *r6
+L13: add #56, r4
+; comment
+L14: red *r7
+L15: .string "kytjgw"
+mov #-117, L13
+L16: jmp *r1
+L17: sub r7, *r7
+mov #22, L250
+L18: inc r6
+L19: dec r1
+L20: add r4, L6
+sub L327, *r4
+L21: sub r3, *r5
+lea L2, r1
+jsr *r3
+L22: jmp *r3
+L23: lea L189, *r6
+L24: rts
+L25: jmp L25
+L26: .string "fvdaqjurflvezrfsebtusnu"
+L27: .string "rlalptecrjemtrwmt"
+L28: .data 37, -379, 284
+L29: stop
+red L232
+prn L501
+L30: stop
+L31: cmp L31, r7
+L32: .data 641, 174, 911
+dec *r3
+L33: dec r7
+L34: red r2
+L35: mov #-229, *r0
+bne *r4
+L36: clr L16
+L37: jsr L23
+L38: jsr L13
+L39: sub *r2, *r4
+L40: lea L163, *r2
+L41: dec L0
+L42: inc L211
+prn r2
+L43: dec r3
+L44: dec L109
+L45: lea L104, *r4
+L46: inc *r5
+inc L543
+L47: .data -744, 257, 135, -443, 700, -656
+L48: .data -114, 895, 504, 980, -826
+inc *r6
+L49: jsr L28
+L50: sub r2, r2
+L51: jmp *r5
+L52: prn L363
+add L341, *r7
+L53: sub #-210, r5
+L54: cmp L89, *r5
+L55: rts
+dec r7
+L56: red r6
+mov *r7, L4
+L57: inc L585
+not L29
+L58: stop
+stop
+red r6
+sub r5, *r5
+L59: rts
+sub r5, L2
+L60: prn #90
+L61: add L21, L347
+L62: jsr *r1
+L63: stop
+mov r6, *r3
+stop
+L64: .string "wxjulbiqzhpywxed"
+L65: bne L2
+rts
+L66: bne L481
+bne L43
+
+L67: dec L6
+lea L178, *r0
+L68: .string "mtxcjrsh"
+
+L69: bne L41
+L70: jsr *r5
+L71: stop
+clr L107
+L72: red r5
+dec L48
+L73: mov L56, r7
+L74: sub #-114, *r3
+L75: .string "uwhbaswysor"
+L76: prn r6
+L77: lea L288, L542
+clr L105
+rts
+sub r5, L42
+mov *r7, r3
+prn L32
+L78: cmp #100, L167
+not r6
+red L36
+L79: not L253
+cmp #-134, *r2
+L80: inc r6
+L81: rts
+sub r4, L67
+jsr *r4
+
+L82: .string "ouevlkrhgyneg"
+L83: jmp *r2
+L84: rts
+L85: red L464
+red L242
+L86: red r5
+not r1
+L87: lea L14, *r6
+L88: .data 432, -730
+; comment
+L89: add #-178, r4
+L90: .data -680, 225, 9, 407, 284
+L91: .data 775, 419, -949, -730, -486, -266
+L92: red r3
+sub *r3, *r3
+rts
+; comment
+mov L569, *r6
+L93: prn L375
+L94: prn *r5
+L95: rts
+cmp L582, L80
+L96: sub L4, r6
+add L82, r2
+bne *r5
+mov r3, r4
+clr L542
+L97: .string "es"
+L98: cmp L496, L93
+L99: jmp L268
+L100: clr L507
+L101: jmp *r2
+L102: .string "hrrctpeqnqmjoh"
+mov r3, *r2
+clr r2
+jsr *r0
+L103: red r0
+cmp r7, L528
+L104: not r0
+L105: .data -172, -459
+L106: mov L545, *r0
+rts
+L107: bne *r0
+L108: red r5
+L109: red *r5
+L110: rts
+jmp *r3
+not r0
+L111: .string "mistcidsc"
+L112: .string "jutxalyhqsnlqwuhnhiva"
+L113: not *r2
+L114: rts
+L115: bne L69
+jmp *r4
+L116: mov r5, *r0
+jmp *r1
+L117: .string "epvxidbwc"
+L118: rts
+L119: not L575
+L120: cmp *r3, r3
+L121: .string "mqtlhjduuhvchsmac"
+L122: jsr *r6
+mov *r3, r2
+L123: .string "ltcuhmngjh"
+rts
+L124: .data 854, 528, -638, 460, -796, -189, 333
+L125: jsr *r3
+L126: lea L199, *r6
+L127: stop
+L128: cmp r5, *r4
+L129: red *r5
+L130: prn r4
+L131: mov L110, *r3
+L132: jmp L560
+rts
+L133: red L3
+L134: jsr *r0
+L135: dec *r4
+L136: .string "ayoufrqbhdi"
+bne *r6
+jmp *r4
+L137: stop
+cmp L531, L93
+cmp L10, L435
+inc *r2
+L138: bne *r7
+rts
+L139: rts
+jmp L95
+L140: sub L436, *r7
+L141: mov L13, L591
+add r6, r4
+L142: clr L228
+L143: lea L66, *r4
+L144: mov *r1, *r3
+add *r6, r7
+jmp *r3
+L145: cmp L594, L538
+add *r5, L537
+L146: sub *r2, *r6
+L147: .string "wwnpvav"
+lea L93, r3
+jsr *r7
+L148: not *r4
+
+L149: jmp *r1
+L150: add #-14, *r0
+add *r3, *r0
+L151: .data 988, 885, -778, 654, 26, -158, 95, -460
+L152: prn r1
+L153: rts
+L154: not r2
+L155: rts
+L156: cmp #176, r6
+L157: sub L370, L40
+L158: clr r2
+
+L159: bne L157
+L160: dec *r5
+L161: .data 274, -809, 114, -673
+prn #128
+L162: cmp r3, #-224
+red r3
+sub *r3, *r3
+L163: lea L185, r4
+L164: rts
+L165: mov L33, L150
+not L459
+sub r2, r0
+stop
+L166: red r7
+lea L89, r7
+L167: bne *r5
+red *r1
+L168: .data 168, 457
+lea L250, L143
+L169: bne L19
+L170: jmp *r3
+jsr L163
+stop
+prn *r1
+L171: not r6
+not *r5
+jmp L211
+L172: jsr *r6
+stop
+L173: mov #-126, r2
+sub #183, L354
+L174: not L324
+prn *r6
+add #-6, r3
+L175: jsr *r1
+L176: sub r3, *r0
+; comment
+L177: dec L328
+L178: jmp *r7
+L179: prn r6
+sub #94, *r6
+L180: prn *r6
+L181: cmp r0, r0
+L182: not r7
+sub #107, *r3
+
+L183: mov r5, *r4
+L184: .string "iwglillaphrvv"
+cmp #-230, #125
+L185: clr L5
+not *r6
+sub L160, r7
+L186: rts
+bne L46
+mov r4, r1
+L187: .data 163, -116, 407, 359, -259, 780, 562, -448
+prn #3
+L188: dec L40
+L189: inc *r5
+; comment
+L190: not r0
+add L129, *r0
+sub *r6, r4
+L191: jsr *r4
+L192: cmp L454, *r0
+mov #1, L46
+; comment
+L193: mov r5, L35
+L194: not *r5
+bne L82
+L195: .data 597, -183, 552, -960, 771, -687, 895, -356
+inc *r0
+L196: red r2
+L197: clr *r6
+red *r7
+; comment
+L198: cmp *r4, *r6
+
+L199: clr r7
+jsr *r2
+L200: .string "ekezzwiicghgowgr"
+mov *r1, *r6
+L201: clr r5
+red *r5
+L202: prn L402
+L203: jmp L23
+L204: .data 87
+mov L69, r0
+L205: clr r7
+lea L322, L43
+inc L1
+jmp L385
+
+L206: rts
+L207: jmp L363
+
+mov L534, *r1
+L208: mov L139, r6
+inc *r3
+
+L209: not *r3
+L210: stop
+L211: dec L15
+L212: .data -430, -214, -582
+; comment
+L213: jmp *r3
+L214: red L8
+lea L567, r3
+lea L193, L401
+L215: dec *r3
+L216: stop
+L217: prn *r4
+dec *r6
+L218: lea L156, L457
+L219: clr L144
+jsr L200
+L220: jsr L127
+not *r4
+stop
+mov r7, r6
+inc r4
+
+L221: .data 676, -343, 109, 958, -740, -179, 636
+L222: stop
+bne L149
+L223: .data -408, -389, -788, -830
+L224: sub *r3, r0
+L225: cmp #254, L290
+rts
+L226: mov *r2, r4
+not *r0
+not r4
+L227: lea L553, r6
+mov #-199, r1
+prn #14
+lea L347, r4
+L228: jsr L441
+clr r2
+not r2
+L229: stop
+jsr *r7
+L230: jmp *r0
+L231: red L524
+jmp L473
+L232: red *r4
+mov r6, *r6
+L233: prn L380
+L234: cmp *r6, *r4
+L235: prn *r7
+rts
+L236: cmp r6, *r7
+L237: dec *r5
+L238: rts
+L239: red r7
+L240: red *r6
+stop
+L241: red *r2
+sub L311, r7
+lea L329, r0
+L242: add r2, L127
+L243: .string "xwpqllvneje"
+red L408
+L244: red r4
+L245: not r1
+L246: lea L57, *r0
+L247: .string "kuo"
+sub #241, *r1
+L248: prn L246
+L249: jsr *r1
+L250: bne *r3
+add #241, L358
+L251: cmp r6, #-192
+jsr *r0
+not *r7
+not L339
+dec r5
+bne *r0
+L252: stop
+L253: mov L159, L299
+L254: .string "mtcezrkcpsr"
+dec *r0
+prn r6
+L255: stop
+inc r2
+L256: dec r3
+L257: mov L76, *r5
+jsr L22
+L258: stop
+L259: .string "mclbdjvxaefzblqprbcutusz"
+bne L340
+L260: add *r2, *r6
+L261: sub *r3, r1
+jmp *r0
+lea L446, r4
+jmp L0
+prn #-181
+inc r3
+L262: inc *r5
+add r1, r7
+L263: rts
+L264: not *r6
+
+prn L384
+L265: dec L378
+L266: lea L72, r0
+L267: clr L186
+L268: prn *r2
+L269: .data -576, -154, 54, -899, -105, 173, -216, 609
+; comment
+prn L395
+jsr L27
+L270: cmp r5, *r5
+stop
+rts
+L271: prn #-8
+L272: lea L0, *r7
+L273: bne *r4
+L274: jmp *r5
+sub #18, *r1
+sub #121, r4
+cmp *r6, #10
+L275: not L315
+L276: .string "sutgtmifipzksmrde"
+L277: mov #204, *r7
+L278: prn #-222
+L279: .string "geccaf"
+clr L181
+L280: stop
+L281: not r2
+L282: .string "vg"
+L283: sub *r7, *r6
+L284: dec r5
+add #143, r3
+L285: sub L377, r3
+L286: cmp r4, *r0
+
+L287: mov L325, r7
+L288: cmp r6, L34
+inc *r1
+add L589, *r1
+L289: jmp L524
+stop
+L290: .string "cish"
+L291: add *r0, r7
+stop
+dec r4
+L292: .data 137, 22
+L293: red *r3
+L294: not L98
+L295: inc *r5
+L296: .string "rixoghwjsrvjezqr"
+L297: red L545
+L298: red r4
+mov L331, L467
+L299: inc L507
+L300: red *r6
+dec r7
+L301: .data 555, 271, -188, -619, 922
+L302: .data -455, -739, -714
+cmp *r2, L331
+L303: .string "p"
+L304: stop
+L305: inc r4
+L306: .data -286, -136, -830, 205, 162, 493, -50, 375
+prn r5
+L307: lea L447, *r6
+lea L491, *r2
+L308: cmp r0, r5
+L309: lea L354, r1
+L310: bne L66
+L311: bne L304
+L312: red r5
+sub r5, r0
+L313: mov L160, *r3
+
+L314: jmp *r2
+L315: sub *r2, *r7
+L316: clr *r2
+
+L317: dec r6
+L318: inc L443
+L319: cmp #107, r5
+clr r6
+L320: .string "jfswlscwrcalacjmcvaeyxn"
+L321: inc L125
+bne L482
+stop
+L322: rts
+L323: red r5
+inc r4
+L324: mov r2, L528
+L325: inc r6
+; comment
+mov #-35, r3
+rts
+L326: .data 802, -434, 944, 376, -609, 207, 31
+
+L327: cmp L441, #-48
+L328: inc r2
+bne L531
+L329: jmp *r5
+L330: dec L41
+; comment
+jsr *r3
+L331: prn r7
+L332: dec r4
+
+L333: add L442, L521
+L334: clr r4
+sub #-189, r1
+L335: dec *r3
+; comment
+L336: .string "bnqxyunvkdklfklwosqjbmk"
+L337: .string "jmydemrkogmcrq"
+lea L517, r4
+red r1
+L338: cmp L539, *r5
+L339: red L465
+L340: .string "fnmkyt"
+L341: clr L244
+L342: .data -850, 360, 695, -718, 754
+bne L287
+mov *r2, *r3
+L343: jsr *r1
+L344: mov r6, r6
+; comment
+L345: red L145
+stop
+L346: .data -221, 169, 387, 582, 117
+L347: clr L119
+sub *r3, r6
+L348: mov *r1, L190
+L349: dec r1
+L350: sub L363, r7
+L351: cmp *r3, *r1
+L352: add #4, *r0
+L353: not *r7
+L354: rts
+L355: red *r6
+L356: stop
+lea L584, r6
+L357: not *r2
+L358: prn L571
+L359: jsr *r2
+mov *r7, r0
+L360: sub r3, r5
+dec *r7
+stop
+L361: red L183
+L362: add *r4, L4
+jmp *r7
+L363: clr *r1
+L364: prn #-15
+prn L15
+L365: clr *r2
+L366: red L71
+L367: dec L584
+L368: lea L65, L585
+L369: lea L585, L472
+L370: cmp L19, *r5
+L371: jmp *r0
+; comment
+inc r1
+jmp L516
+add *r6, *r0
+L372: .string "igqspevdju"
+L373: sub *r6, *r5
+dec *r6
+rts
+L374: jmp L211
+L375: red L154
+L376: mov L424, r2
+L377: mov *r3, *r5
+dec *r7
+not *r7
+L378: prn r4
+L379: cmp *r5, r4
+L380: mov L588, L298
+L381: .string "uuuysqdkbpxpkfmqbeweohh"
+mov r3, *r1
+cmp *r3, L122
+L382: jmp L381
+L383: add L461, L192
+mov *r7, r1
+L384: red r2
+L385: bne L4
+L386: .string "dfppyhbstaz"
+
+clr r3
+L387: stop
+L388: clr r2
+L389: bne L489
+L390: sub *r3, *r6
+L391: clr *r4
+; comment
+L392: add L190, L434
+L393: .data 359, 370, 86
+L394: not L112
+L395: dec *r3
+mov #-44, *r2
+L396: red *r1
+L397: .string "wqbjbzrztvaasodjznvpou"
+L398: sub L410, r4
+cmp *r3, #151
+L399: prn r1
+sub *r0, r0
+L400: rts
+L401: not L288
+bne *r3
+sub #-178, *r0
+add *r7, L365
+L402: clr *r4
+L403: rts
+clr *r5
+L404: red *r0
+L405: .data 694, -132, 157, 940, -841
+L406: red L37
+L407: jmp L328
+L408: .data 393, -915
+add #98, r7
+L409: lea L207, *r4
+L410: inc *r4
+L411: not *r1
+; comment
+L412: rts
+L413: prn L297
+jsr L52
+L414: dec r0
+lea L422, *r6
+L415: .string "zwkbceaghpns"
+rts
+rts
+L416: prn *r2
+mov L552, L531
+L417: stop
+L418: bne L440
+L419: prn L436
+L420: red *r6
+stop
+L421: prn r2
+L422: mov #-45, L449
+L423: clr r1
+L424: mov L87, r0
+prn *r2
+L425: not r0
+L426: .string "jjfoarpqvkb"
+red *r6
+L427: sub *r3, *r2
+red L597
+L428: jmp *r0
+jsr *r6
+L429: prn *r3
+L430: jmp L102
+red L524
+L431: lea L528, r3
+L432: .string "wxpeakrabouagtiiqods"
+L433: jmp L114
+L434: red *r6
+L435: rts
+add r6, r1
+L436: .string "rnshkq"
+
+sub #-173, r1
+L437: .data -26, 977, -340, 538, -267, 146, 762, 913
+L438: not L561
+mov #81, *r2
+cmp #26, r5
+L439: prn L223
+L440: jmp *r3
+rts
+L441: jmp L306
+L442: rts
+L443: stop
+L444: red r7
+L445: dec L275
+L446: add *r7, *r1
+inc *r1
+
+jmp *r2
+prn r3
+cmp #136, r5
+mov *r0, L596
+L447: lea L246, *r0
+L448: bne *r1
+inc r0
+L449: mov L73, *r0
+L450: mov #-3, L534
+dec r2
+L451: stop
+L452: not r1
+L453: rts
+jmp *r0
+bne *r4
+L454: inc L564
+; comment
+L455: prn #-184
+L456: .string "dkemdugk"
+prn *r6
+L457: stop
+L458: clr r1
+red *r4
+red L340
+mov #10, *r3
+L459: rts
+L460: stop
+L461: add #-193, *r2
+L462: jsr *r6
+stop
+prn r1
+L463: lea L581, r0
+L464: inc L492
+; comment
+L465: not *r5
+L466: sub #183, *r0
+dec L580
+L467: red L580
+L468: not *r5
+L469: inc L502
+dec r3
+L470: sub r4, *r4
+L471: stop
+cmp L66, #11
+L472: inc *r1
+L473: lea L486, *r7
+L474: bne *r3
+L475: mov r4, L493
+inc L184
+L476: jsr *r6
+L477: .data -114, -720, 943, 261, -646, 708, 879
+L478: not r3
+L479: cmp *r6, r5
+L480: red *r4
+L481: not *r0
+rts
+lea L23, r4
+L482: .data 439, -679, 426, -312, 361, 26, -137
+L483: add r1, r5
+L484: .data -738, -602, 476, -963
+jsr *r6
+L485: sub #-254, L301
+L486: lea L90, L597
+L487: red r0
+add r3, *r7
+L488: sub #43, L124
+L489: dec *r1
+add L552, *r5
+L490: dec r0
+L491: inc r3
+L492: bne *r4
+L493: mov *r6, r7
+lea L562, *r1
+rts
+L494: dec r7
+L495: add L433, r1
+L496: inc L114
+L497: .string "sydnflwjfamgocuasnjjmkyz"
+lea L518, r3
+dec r7
+L498: .string "mvpshmwnuyguzplnux"
+L499: prn r1
+L500: inc L369
+L501: inc r4
+L502: red L583
+rts
+L503: prn #-129
+L504: .string "pclhsmeng"
+L505: .string "byxjnhhfxtanexfiersnr"
+L506: red L209
+rts
+L507: stop
+L508: mov L564, L544
+sub r4, L571
+L509: bne L553
+L510: bne L551
+L511: .string "bfiduekepzvusl"
+not r4
+not L76
+L512: dec r4
+jmp L238
+prn *r7
+L513: add *r1, r2
+L514: sub L535, r5
+clr L584
+L515: add #-224, *r0
+sub L525, *r5
+L516: rts
+L517: jmp *r3
+jmp *r1
+L518: red r4
+L519: sub *r4, L443
+; comment
+L520: lea L431, L456
+cmp r2, *r0
+L521: jsr L18
+L522: jmp L588
+L523: dec L541
+L524: jsr *r5
+L525: .data 31
+L526: sub L594, r3
+red r6
+L527: bne L449
+L528: sub *r3, L597
+mov L539, *r4
+L529: lea L549, r1
+L530: clr r3
+bne *r2
+jmp *r3
+L531: dec r4
+add #-35, r1
+L532: lea L568, L305
+L533: inc *r7
+
+prn #185
+L534: prn L149
+L535: dec *r6
+cmp r4, r3
+L536: jsr L104
+clr r4
+jsr L132
+not *r3
+inc *r3
+L537: stop
+L538: dec L564
+L539: clr L245
+L540: add #167, r2
+L541: prn L545
+L542: stop
+add #122, *r0
+L543: bne *r0
+jsr L548
+L544: prn #209
+L545: .string "llqrwxqo"
+stop
+cmp L422, r3
+inc L20
+L546: .data 585, -305, 327, -710, 904, 330, 855
+L547: .data -325, -126, -753, -666
+inc *r5
+L548: bne L432
+L549: dec L533
+prn #-26
+L550: prn L572
+L551: mov L572, L212
+rts
+prn *r1
+red *r0
+mov r2, *r6
+sub r7, r0
+; comment
+clr r5
+L552: rts
+sub #-63, r6
+L553: add #181, r5
+L554: add L561, L571
+rts
+L555: jsr *r6
+mov r5, *r7
+cmp #68, r1
+L556: .string "rpucnphvkbmewxfuqvqvpx"
+clr *r0
+stop
+L557: prn r7
+bne *r1
+L558: add *r7, L252
+L559: inc *r2
+bne L430
+L560: bne L567
+L561: red *r2
+sub *r4, *r1
+mov r5, L109
+inc *r0
+mov L590, L598
+clr r6
+L562: mov L472, r6
+inc *r4
+L563: red r0
+clr *r3
+L564: bne *r0
+L565: prn L97
+L566: add r4, *r0
+L567: jsr *r0
+mov r5, r1
+L568: inc *r6
+prn L587
+L569: mov *r7, *r7
+jsr L577
+L570: jmp L520
+; comment
+dec r2
+jsr L589
+L571: sub L590, *r7
+L572: lea L459, L583
+L573: stop
+L574: rts
+red *r5
+clr L359
+jsr L298
+L575: jmp L105
+L576: sub #-66, L589
+add #32, *r5
+inc L484
+L577: rts
+inc r4
+cmp #-111, L584
+lea L92, *r6
+L578: .data 593, 860, 125, 760
+lea L580, *r1
+; comment
+L579: prn *r5
+L580: .data 746, 6
+L581: jmp L391
+red *r3
+red r4
+prn *r1
+L582: add *r7, L25
+bne *r1
+L583: not L591
+sub L584, L593
+red r0
+inc *r6
+rts
+clr *r5
+mov L593, L587
+L584: cmp r7, r7
+L585: jsr L227
+prn #19
+L586: lea L595, *r6
+L587: .string "wcnynriifkxdsrbiidqtvm"
+L588: add r0, r5
+L589: add r1, L430
+
+L590: cmp L110, #146
+
+inc *r6
+L591: lea L361, *r7
+not *r4
+
+prn r3
+prn #68
+inc *r7
+L592: .data 87, 356, 990, -864, 999, 296, -592, -114
+jsr *r0
+L593: bne L61
+L594: stop
+cmp #-52, r4
+L595: stop
+L596: prn r6
+cmp L597, #-107
+L597: jsr L598
+L598: jmp *r7
+jmp L288
+inc r2
+stop
@@ -0,0 +1,1039 @@
+; Generated by genCorpus --seed 22
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+L0: clr *r5
+bne *r4
+jmp *r6
+L1: .string "jjkxe"
+prn L213
+L2: red L2
+L3: jsr *r2
+L4: jmp L438
+
+L5: clr r6
+; comment
+red L2
+L6: red *r6
+L7: prn L2
+L8: dec r5
+mov L4, *r5
+L9: sub r6, r7
+L10: inc r6
+L11: .data -850, 752, 798
+L12: jsr *r5
+stop
+L13: .data -411
+L14: mov r0, L412
+L15: bne *r6
+L16: red *r6
+not r2
+L17: bne L9
+L18: inc *r2
+L19: inc *r6
+L20: not L213
+bne *r7
+; comment
+add r7, L187
+red r6
+L21: sub r2, *r4
+stop
+L22: jmp L17
+L23: prn *r0
+L24: prn r5
+L25: bne *r5
+L26: not L0
+lea L11, L5
+L27: bne L491
+L28: mov *r0, L18
+L29: dec *r1
+L30: bne *r3
+L31: .data 685, -802, -303, 145, 583
+not r3
+
+L32: lea L214, L530
+L33: jsr *r2
+L34: jsr L14
+L35: add #-94, L21
+prn L28
+L36: .string "it"
+; comment
+L37: red *r0
+L38: red *r3
+jmp L226
+add L2, *r3
+L39: jmp L19
+lea L36, L5
+sub #-84, r5
+L40: add *r0, L1
+
+prn r4
+jsr L404
+L41: mov r5, *r6
+bne *r6
+L42: jsr L20
+L43: .data -373
+cmp r6, #-109
+stop
+L44: not r7
+cmp L5, L314
+L45: not L482
+bne *r5
+L46: lea L121, L523
+L47: clr L401
+L48: .data -817, 920
+jmp *r2
+L49: inc r6
+L50: jmp L508
+cmp L163, r4
+L51: clr L438
+mov L8, *r5
+L52: clr r6
+stop
+L53: cmp r0, L10
+jsr L42
+L54: prn L10
+L55: bne *r1
+L56: stop
+L57: dec r6
+L58: stop
+L59: inc L33
+L60: rts
+L61: cmp *r3, *r7
+L62: jsr *r4
+L63: inc L510
+L64: prn #69
+L65: stop
+L66: rts
+; comment
+; comment
+jmp *r0
+L67: lea L127, *r4
+L68: rts
+L69: rts
+sub #58, L45
+jsr L310
+jmp *r3
+cmp L322, r4
+L70: clr r3
+L71: dec r5
+L72: prn L510
+L73: mov #189, *r1
+clr *r5
+L74: rts
+L75: bne *r6
+red r6
+red L569
+L76: prn #-196
+L77: .data 915, -416, -204, -226, 286, 586, -850, 562
+L78: mov L387, *r3
+L79: prn r4
+L80: inc r5
+L81: mov r3, *r2
+L82: clr *r3
+prn r7
+L83: not *r7
+L84: inc *r1
+jsr *r2
+L85: .data -374, 851, -875, -833
+L86: prn r3
+L87: clr *r4
+cmp r6, *r5
+L88: add L298, L32
+jmp L388
+L89: stop
+L90: jmp *r2
+mov #-52, L254
+L91: bne *r6
+L92: jmp *r3
+L93: add #97, L88
+L94: lea L62, r4
+L95: lea L58, *r0
+jmp L20
+L96: stop
+cmp *r0, *r3
+L97: .string "uxgqbrblydmoigtdotz"
+L98: prn *r1
+L99: lea L53, *r1
+L100: lea L38, r7
+L101: mov *r2, r6
+L102: inc *r7
+
+L103: prn #-185
+stop
+L104: .string "vnkef"
+L105: stop
+clr L335
+jsr *r7
+L106: not L55
+L107: sub #-82, *r0
+L108: clr r0
+L109: inc L43
+L110: stop
+; comment
+L111: jmp L58
+L112: bne *r3
+cmp L4, *r5
+L113: prn L46
+L114: mov r4, *r6
+L115: dec L36
+jsr *r7
+L116: .string "br"
+prn #158
+sub *r4, r1
+jsr L384
+L117: sub r0, r6
+L118: .data -802, -151, -47, 384
+L119: mov L321, L66
+rts
+; comment
+L120: prn L85
+L121: cmp L53, *r3
+L122: mov #150, r0
+L123: clr r3
+L124: clr *r2
+clr L85
+sub r1, r3
+L125: red L400
+L126: .string "vwgmfga"
+cmp *r7, *r1
+L127: not L575
+L128: .data 840, -905
+L129: sub r2, *r3
+inc *r3
+; comment
+not r7
+L130: clr L83
+bne *r0
+not *r6
+jmp *r6
+L131: sub r1, r4
+L132: inc L439
+jmp L230
+inc *r2
+add #-147, L525
+L133: inc *r4
+L134: lea L239, *r1
+lea L518, *r7
+bne *r4
+inc r4
+
+L135: inc L108
+L136: .string "urhr"
+L137: red L136
+cmp r4, #171
+L138: sub #133, *r7
+L139: clr r2
+bne L140
+L140: rts
+sub #-2, r2
+
+L141: add #-74, L205
+L142: .data -671, -891, 728
+not r3
+L143: rts
+add L0, L74
+L144: rts
+L145: inc L49
+prn *r4
+rts
+cmp r3, L291
+L146: cmp r2, #-89
+rts
+L147: red L296
+sub #-27, r4
+L148: mov #218, *r7
+inc *r0
+L149: inc r1
+red L62
+jsr *r5
+not r5
+L150: jsr L85
+L151: .string "nstce"
+add #163, *r1
+L152: red L391
+stop
+L153: rts
+L154: bne L61
+cmp r3, r6
+; comment
+L155: sub L236, r4
+dec r0
+L156: prn L574
+prn *r1
+mov #101, *r1
+L157: .string "dtcqhr"
+rts
+rts
+sub #-216, *r4
+L158: cmp #-205, L381
+dec L573
+L159: stop
+L160: .data 621
+L161: dec r4
+L162: clr L303
+inc r5
+L163: sub r5, *r5
+L164: add r3, L22
+L165: clr *r7
+mov *r4, *r0
+mov *r7, L314
+bne L234
+prn #-42
+cmp L283, *r4
+rts
+L166: cmp L117, r6
+L167: stop
+L168: cmp r5, r7
+clr L31
+L169: lea L449, L410
+L170: clr r3
+L171: mov L445, L129
+L172: dec *r4
+
+L173: prn #94
+L174: jsr *r1
+sub r5, *r0
+L175: .string "w"
+L176: add L10, *r3
+add *r1, *r6
+L177: .data -204, -279
+L178: red L21
+L179: lea L156, *r7
+mov r2, *r7
+; comment
+red *r7
+L180: jmp *r4
+; comment
+L181: clr L45
+inc *r0
+L182: prn #119
+L183: not r3
+L184: rts
+dec r1
+sub #69, r6
+sub r3, *r5
+bne *r1
+; comment
+L185: stop
+not *r6
+dec L266
+L186: stop
+prn L123
+L187: stop
+jmp L478
+L188: red L58
+inc L162
+L189: jmp L351
+L190: not r4
+L191: prn #182
+L192: lea L463, r5
+stop
+L193: inc L429
+L194: prn r0
+L195: jmp *r6
+L196: mov r7, *r4
+L197: lea L329, L486
+cmp L227, *r0
+L198: dec r0
+L199: mov #-220, L118
+add *r4, L542
+L200: cmp #-91, *r7
+L201: jmp L369
+rts
+not r1
+L202: inc L411
+L203: jsr L538
+L204: not *r5
+L205: bne *r6
+L206: red L419
+L207: sub *r4, *r5
+rts
+red r7
+L208: .string "uuyfyssvstvyganu"
+sub r7, L57
+L209: rts
+sub L31, L54
+L210: sub *r3, *r4
+L211: add *r2, *r0
+L212: mov L161, L56
+prn #-81
+L213: .data 95
+red *r0
+bne L175
+add r7, r2
+L214: clr r3
+rts
+dec r7
+L215: jsr *r3
+L216: red L449
+L217: mov #-184, L43
+L218: .data 13, -591, -758, -723
+prn *r4
+; comment
+dec r2
+L219: bne *r2
+L220: .data 730, 166
+L221: jmp *r1
+lea L371, *r7
+L222: .string "ijjccg"
+sub #104, L47
+L223: prn L247
+L224: .string "ivumo"
+L225: add L546, L281
+
+stop
+L226: mov #211, r6
+L227: cmp r1, *r7
+clr L72
+rts
+
+dec *r6
+mov #65, r0
+cmp #179, L189
+bne L213
+L228: clr *r6
+L229: .string "owycygmtsf"
+cmp #-137, *r3
+jmp L581
+L230: lea L110, *r4
+L231: clr *r0
+lea L183, r6
+L232: red *r6
+L233: stop
+L234: .string "m"
+L235: not *r0
+
+L236: jmp *r3
+prn #231
+L237: dec r1
+L238: prn L576
+L239: not r0
+dec *r6
+L240: prn L176
+L241: .data 304, -50, 872, -78, -131, 164
+L242: red r4
+L243: .string "cmverkoswnvdfbiz"
+not L378
+inc *r0
+L244: add *r5, *r5
+L245: inc r0
+add L239, *r5
+mov r2, *r7
+L246: not r1
+L247: stop
+
+mov *r3, r4
+L248: jmp *r1
+mov L294, r4
+L249: jmp *r6
+L250: not L574
+inc r5
+lea L367, *r0
+rts
+cmp L562, #-118
+L251: add *r7, *r4
+cmp *r0, L293
+L252: .data 75
+jmp L413
+L253: rts
+bne *r2
+L254: jmp L519
+prn #197
+L255: lea L458, *r5
+L256: dec L275
+add *r3, r1
+cmp L387, r2
+L257: mov L365, r0
+rts
+mov *r2, *r7
+cmp r2, *r2
+bne L87
+L258: jsr *r1
+L259: lea L52, L319
+L260: cmp r7, L559
+stop
+
+
+L261: add *r1, *r7
+L262: lea L201, L483
+jmp L507
+clr r0
+bne *r2
+sub *r4, *r5
+L263: stop
+inc L220
+L264: cmp r5, *r5
+L265: bne L83
+cmp *r3, r3
+L266: cmp *r2, L550
+L267: add L270, r4
+L268: lea L572, L445
+L269: clr *r0
+L270: .string "jphraaejwvxspcikpvzikcmr"
+cmp *r0, *r2
+L271: stop
+jmp L538
+L272: .data 230, -950, 803, -131, -427, -358, 75, -625
+
+L273: not r5
+L274: rts
+; comment
+L275: prn *r5
+L276: add #159, r7
+L277: .data -145, 366, -996
+bne *r5
+L278: .string "b"
+jmp *r6
+L279: red L180
+L280: not L177
+L281: mov *r3, *r7
+L282: .string "imrdjzdsdwwkvldlosdhslcy"
+sub *r6, L322
+; comment
+L283: stop
+L284: prn *r2
+L285: inc L375
+L286: jmp *r2
+L287: not r1
+L288: .string "hqpvydx"
+red L95
+jmp *r1
+L289: inc L419
+L290: .data 602, -654
+sub r5, *r1
+L291: clr *r2
+L292: clr r1
+prn L369
+L293: mov #72, r0
+inc r5
+; comment
+L294: lea L25, L127
+L295: rts
+L296: stop
+L297: .data 729, 495, -965, 856, -923, 140
+dec L205
+L298: add #127, r3
+L299: jsr L346
+L300: .data 464, -537, 809, -133, -686, -571, -962, 973
+sub L522, *r0
+L301: sub *r1, r3
+jmp L31
+rts
+L302: sub *r1, L525
+L303: bne *r7
+L304: cmp r3, L32
+cmp L458, #-58
+jsr L77
+L305: rts
+L306: rts
+add #-89, L289
+L307: bne *r1
+stop
+L308: stop
+L309: rts
+mov L239, r5
+; comment
+L310: .data 209, -53, 797, 16, 424, -82
+cmp #-188, L239
+L311: jsr *r3
+
+jsr *r5
+L312: prn *r0
+L313: clr *r6
+L314: lea L1, r3
+L315: not *r7
+L316: prn #-95
+cmp L232, *r0
+L317: rts
+L318: lea L410, r0
+sub r2, r6
+jsr *r3
+L319: prn #-96
+mov L334, r3
+L320: bne L577
+red r7
+L321: jmp *r4
+L322: stop
+L323: prn L499
+inc r2
+L324: .string "xdgnuyydevlabifymevgztl"
+dec *r0
+not *r7
+L325: mov r7, *r7
+L326: clr L185
+L327: jsr L46
+L328: not r6
+dec r3
+L329: inc r7
+L330: prn *r3
+L331: jmp *r7
+L332: prn #-110
+sub L470, r6
+
+L333: cmp L406, r1
+cmp *r7, r5
+L334: cmp *r2, #-153
+clr *r4
+cmp *r0, *r7
+cmp #171, r3
+sub *r3, *r5
+bne L128
+prn L248
+bne L483
+L335: prn #236
+L336: sub *r1, L85
+L337: cmp L394, r0
+dec *r0
+red L145
+L338: cmp #69, #7
+L339: inc r3
+L340: rts
+L341: stop
+L342: mov r6, *r7
+L343: bne L303
+cmp r3, L388
+L344: not *r6
+L345: dec *r2
+jsr L446
+bne *r4
+L346: clr *r7
+L347: inc *r5
+L348: red L431
+L349: bne L264
+L350: add r2, L231
+prn L329
+L351: not r7
+stop
+L352: lea L377, L381
+stop
+L353: bne *r2
+
+L354: sub L220, *r2
+L355: sub #211, *r5
+L356: clr L384
+lea L162, *r4
+L357: jsr L227
+L358: .data -715, -776, 79, -803, 845, -396, 557
+L359: stop
+L360: inc L304
+L361: bne *r7
+L362: .data 731, 164, -716, -154, 52, 548
+
+L363: mov L364, *r3
+L364: rts
+L365: cmp L509, r0
+L366: .data 885, 578, -635, 356, 629
+L367: prn #44
+sub L53, *r0
+jmp L459
+L368: sub r0, *r0
+L369: bne L204
+stop
+L370: jmp L446
+L371: jsr *r5
+L372: .data 954, -524, -432
+L373: clr r1
+prn #-10
+add *r4, r0
+L374: rts
+L375: jsr *r1
+mov #107, L474
+inc L141
+cmp *r3, #42
+L376: .string "sfbwzvhvuivqpsxrzhm"
+; comment
+prn #214
+L377: rts
+mov *r7, L418
+L378: .data -773, -942
+not r5
+dec L541
+prn *r2
+L379: stop
+
+L380: prn *r4
+clr r1
+red r5
+bne *r5
+L381: bne *r5
+mov *r5, *r3
+L382: add r4, r5
+L383: .string "jsnwvbbknwho"
+L384: .data -397, 900, -318, 181, 284, 527
+L385: add *r3, r3
+L386: .string "zdfxjbpeb"
+L387: lea L344, r0
+L388: jmp *r1
+L389: jsr L193
+dec L130
+L390: clr *r4
+jmp *r6
+L391: rts
+dec *r0
+L392: cmp *r3, r7
+rts
+L393: red r4
+L394: prn *r4
+
+L395: stop
+L396: cmp L515, #128
+; comment
+prn #41
+; comment
+; comment
+add *r4, L110
+prn L383
+rts
+jsr L559
+L397: .data 298, -143
+L398: .data -556, -651, -359
+dec *r1
+L399: clr r5
+L400: sub *r1, r2
+L401: rts
+cmp *r2, *r0
+red L495
+lea L137, *r1
+sub r7, r4
+L402: inc r1
+bne L455
+L403: jsr *r4
+L404: red L220
+L405: .data -269
+inc r2
+jsr *r3
+add L349, L397
+mov L427, *r6
+L406: not *r1
+L407: prn #-191
+L408: lea L228, *r6
+L409: jsr *r5
+L410: .data 12, -624, -550, -704
+mov #245, L107
+jmp *r4
+L411: .data -1, -141, -564, -33, -573, -154
+cmp #-30, #-20
+L412: cmp #91, r0
+red L572
+L413: not *r6
+rts
+L414: inc *r7
+L415: add L565, L180
+L416: .string "oghndpgmqmyizxzgtv"
+L417: red r7
+L418: .data -292, -897
+dec L442
+L419: not *r5
+L420: jmp *r4
+L421: sub *r3, L438
+L422: red r5
+L423: sub #171, L498
+L424: rts
+sub *r6, L247
+L425: .data 572, 846
+add L498, L441
+; comment
+cmp #58, r0
+dec r5
+L426: mov #-86, r3
+L427: add L287, *r3
+L428: lea L482, r5
+L429: jmp L441
+L430: .string "qputexjyoc"
+L431: cmp *r3, L468
+L432: add L165, L302
+L433: sub L250, L461
+stop
+L434: lea L45, L300
+L435: stop
+L436: stop
+L437: .data -204, 126, -382, 720, -911, -711, 403, 848
+lea L502, r5
+L438: sub #-109, *r3
+L439: jsr L262
+L440: .string "uzuprykk"
+jsr *r3
+L441: dec L99
+L442: mov L462, r1
+; comment
+inc r4
+L443: .data 769, 122, -376, -790, -901, -860, 971
+; comment
+L444: .data 286, 41, -652, 922, -124, 432, 131
+not L521
+bne L516
+L445: add #-129, *r2
+jmp L398
+inc r3
+lea L481, r6
+L446: sub r1, r3
+; comment
+L447: lea L293, r2
+red *r7
+L448: clr r6
+L449: inc r0
+L450: rts
+L451: dec r5
+; comment
+L452: bne *r4
+prn #-18
+jmp L149
+cmp *r5, #226
+L453: rts
+L454: .string "whdstmtdln"
+L455: .data -987, 825
+L456: inc *r6
+not r0
+cmp L118, #105
+L457: red L347
+L458: not *r0
+L459: bne L462
+add #155, *r3
+inc *r6
+L460: clr L577
+L461: .data -812, -453, -506, 19, -506
+L462: not r5
+L463: .data -454
+sub #173, L122
+L464: jsr *r5
+lea L405, r1
+L465: stop
+red r1
+jmp L555
+L466: .data -305
+L467: .data -596, -346, 458, 547, 34, 617
+L468: rts
+L469: jsr *r5
+L470: sub *r3, *r3
+L471: stop
+prn *r7
+bne *r2
+L472: jsr *r2
+dec L567
+bne L474
+add *r3, r3
+
+L473: prn *r6
+jmp L570
+L474: jmp *r5
+L475: dec r3
+L476: inc L574
+L477: .string "hhbtmhnybpbmvsmcarwd"
+L478: red *r7
+not r4
+
+L479: prn L519
+L480: rts
+L481: prn r0
+L482: jmp L149
+
+jsr *r0
+L483: .string "rlfdvxeffnhvd"
+sub *r6, L456
+L484: jmp L44
+L485: stop
+L486: red r0
+L487: inc L512
+sub *r7, r3
+L488: .data -833, -523, -73, 682
+prn *r3
+red L142
+L489: inc r3
+L490: rts
+add *r1, *r5
+L491: .data 484, 216, 210, 639
+red L576
+L492: .string "yaecbbvzftoiheimn"
+L493: stop
+L494: not L582
+bne *r6
+L495: rts
+L496: rts
+L497: red L547
+L498: cmp r4, *r2
+L499: red *r6
+L500: bne L545
+cmp #190, *r0
+; comment
+mov #-256, L565
+dec *r0
+not L517
+
+sub L549, L313
+sub L540, *r5
+L501: .data -898
+L502: add L533, *r7
+L503: .string "gyhyjgaogy"
+not *r1
+L504: rts
+L505: stop
+L506: mov #95, L302
+L507: inc *r2
+L508: mov L250, r6
+inc L549
+L509: not *r3
+L510: inc *r0
+
+mov L581, L538
+L511: cmp L563, r4
+rts
+L512: jmp *r3
+red *r0
+L513: lea L545, r1
+L514: stop
+L515: inc r5
+L516: rts
+bne *r0
+
+L517: clr *r0
+L518: dec L582
+L519: inc L504
+red L544
+L520: add #-25, *r5
+L521: red r4
+L522: not *r2
+inc L100
+red L530
+inc r2
+cmp *r7, L569
+L523: add *r4, r1
+L524: jmp *r6
+inc r0
+; comment
+L525: dec *r1
+dec r4
+L526: dec *r6
+L527: mov *r0, L562
+rts
+L528: add #-48, r7
+L529: inc *r4
+
+jsr L568
+L530: lea L573, L199
+L531: .string "emlscblguovkawemmjemc"
+jmp *r4
+L532: cmp r6, L524
+L533: add #-147, r4
+mov L577, L569
+not *r5
+jsr L286
+L534: lea L557, r2
+L535: sub *r0, L541
+L536: .data -412
+inc r1
+L537: prn *r7
+L538: lea L574, L560
+L539: rts
+lea L204, r0
+jmp *r7
+L540: add L574, L447
+mov r0, r0
+mov *r2, r4
+L541: mov #-252, L112
+L542: prn L331
+L543: jmp *r7
+not r7
+L544: inc *r2
+L545: prn r7
+mov *r0, L154
+L546: jsr L157
+L547: sub *r6, r3
+L548: .string "ybyiaejtndjiv"
+L549: dec *r1
+L550: prn #-63
+inc L396
+L551: cmp #-117, *r7
+dec L168
+L552: add L558, r6
+L553: clr *r3
+L554: jmp L81
+L555: mov r6, r6
+L556: clr *r1
+prn *r1
+sub *r2, L515
+not r6
+dec r0
+L557: sub L579, L225
+L558: inc *r2
+not L573
+sub *r3, *r0
+L559: lea L580, L250
+L560: red *r5
+cmp *r6, *r6
+L561: .data -980, -495
+add L578, L356
+L562: inc r7
+inc *r6
+L563: dec *r5
+L564: stop
+lea L463, *r0
+L565: sub L537, *r5
+jsr L582
+L566: clr *r6
+sub r0, L107
+L567: .string "nsnzzxdgzbohawfzptu"
+L568: dec *r2
+L569: cmp L57, r3
+lea L573, *r1
+L570: sub L530, L76
+L571: jmp L581
+red r6
+L572: not L23
+L573: prn #116
+prn r4
+L574: clr L201
+L575: .string "k"
+L576: rts
+L577: dec L293
+L578: mov L579, r3
+L579: jmp L581
+stop
+
+L580: red L581
+L581: stop
+
+L582: cmp #-234, r7
+; comment
+L583: red *r4
+sub *r0, *r0
+red *r4
+dec *r4
+L584: cmp *r1, #246
+inc *r4
+mov r0, r1
+stop
@@ -0,0 +1,1041 @@
+; Generated by genCorpus --seed 23
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+L0: dec L577
+add L189, *r0
+L1: cmp r6, r4
+L2: jsr L318
+L3: inc L487
+sub #9, L1
+L4: .string "adkcwbwfpxguwysiajd"
+L5: add L433, r7
+L6: bne *r2
+L7: jmp *r2
+cmp #29, r1
+mov #102, r5
+L8: .data 928
+cmp r4, L78
+L9: jmp *r2
+; comment
+L10: lea L31, L3
+L11: dec r6
+prn #161
+; comment
+L12: .string "sdunyzulcyxzud"
+rts
+L13: not *r4
+L14: clr r7
+L15: sub L12, L50
+lea L4, L9
+L16: red L15
+L17: jmp L568
+dec r4
+red r3
+not *r7
+L18: sub #249, L256
+L19: red L610
+sub #80, r3
+mov #129, *r7
+L20: cmp #78, *r2
+cmp L13, *r5
+cmp r1, #161
+L21: jmp L23
+
+L22: cmp L128, L157
+add #-14, L275
+L23: .data 807
+L24: lea L3, r6
+L25: rts
+L26: inc *r5
+rts
+sub L95, r7
+L27: lea L20, r6
+sub L64, *r4
+L28: add *r4, L44
+L29: red r6
+inc L16
+sub #38, *r4
+clr *r1
+L30: lea L110, L17
+L31: lea L88, r1
+L32: cmp *r6, L334
+L33: dec *r4
+L34: jmp *r2
+L35: bne L304
+mov *r5, *r5
+L36: not r5
+L37: bne L601
+clr r6
+L38: clr r5
+sub L4, *r3
+stop
+lea L564, *r1
+L39: inc r4
+L40: cmp *r1, *r1
+L41: red r2
+sub L8, r0
+L42: stop
+red L8
+L43: .data 306, -385
+L44: .string "oqxqvylalxefwmjf"
+L45: sub *r1, r4
+L46: .string "vpxuchnodhr"
+inc *r5
+jsr *r4
+; comment
+L47: .string "obpobldlzdrhtgnxnjj"
+L48: add *r7, L418
+L49: lea L4, r0
+L50: mov L435, r0
+mov #247, L33
+L51: rts
+L52: cmp L23, r0
+L53: bne *r7
+L54: clr r5
+; comment
+L55: red r0
+not L57
+rts
+L56: dec *r4
+mov #-108, L126
+L57: red *r1
+L58: cmp L33, #213
+L59: .string "vuw"
+L60: rts
+L61: jsr L389
+L62: jsr *r4
+; comment
+cmp *r6, L46
+not L11
+L63: .data 954
+L64: mov L333, r3
+L65: .string "auxfyadqkuxzjdbefbutq"
+L66: rts
+jmp *r2
+L67: .string "iiaunuwpdgjf"
+L68: clr *r2
+sub L448, L412
+L69: add #-148, *r2
+L70: bne L192
+L71: .string "vaqp"
+prn L168
+L72: .data -738, -286, 232, 574, 794, 508, 194
+L73: mov r7, *r3
+L74: red *r1
+add r4, *r6
+L75: bne *r1
+L76: add L26, *r5
+sub r1, L23
+L77: add L31, r7
+L78: bne L76
+L79: .data -958, -632, 252, 630, 115, 922
+cmp *r0, *r7
+L80: .string "ycpkamnrghspkmz"
+L81: dec r1
+L82: stop
+L83: prn r4
+clr *r1
+jmp *r1
+sub r5, *r2
+L84: sub r1, L322
+bne *r7
+lea L45, *r7
+L85: red r5
+red *r3
+jmp *r4
+dec r3
+L86: inc *r2
+L87: jmp *r7
+L88: rts
+inc *r2
+L89: sub L36, L3
+L90: mov #59, r3
+L91: bne L4
+clr r4
+L92: clr L152
+not r3
+L93: clr *r4
+L94: mov *r1, *r0
+sub *r5, *r3
+jmp L3
+L95: rts
+L96: add r0, L16
+clr r3
+jsr L314
+L97: sub *r7, *r6
+L98: prn *r2
+L99: bne L44
+L100: sub #-83, L89
+mov r0, L59
+L101: not r4
+L102: inc r4
+L103: red *r6
+L104: lea L83, r5
+rts
+L105: add #-182, *r0
+bne *r6
+sub L100, r1
+L106: jmp *r5
+red L131
+lea L353, r4
+L107: .data -733
+L108: dec r4
+L109: mov #-178, *r5
+cmp r6, *r7
+L110: rts
+jsr L31
+L111: lea L354, L445
+; comment
+sub L103, r7
+L112: .string "kjoucjsakrvbhbdfmpgbb"
+bne *r1
+L113: jmp L102
+L114: red r3
+mov #168, L21
+mov L152, r5
+jsr L356
+L115: dec r4
+sub *r2, L581
+L116: bne *r5
+L117: lea L214, r0
+L118: .string "hdwpqyrmqfepmfelqapomqk"
+L119: clr r4
+L120: .data 492, 327, 54, -456, 477
+L121: inc L17
+rts
+L122: cmp L92, r3
+L123: rts
+cmp *r3, *r4
+not L593
+stop
+L124: cmp L251, #72
+prn *r3
+sub *r4, *r7
+L125: jsr L423
+inc *r6
+L126: .data -302
+prn r5
+L127: stop
+L128: clr L123
+add L505, r0
+not *r2
+bne L69
+L129: stop
+L130: jsr L416
+L131: stop
+L132: dec r3
+L133: jmp L461
+L134: cmp *r0, L196
+L135: .string "ibtvdxalojgdvyeiqqomryyy"
+L136: stop
+L137: jsr L71
+bne L554
+; comment
+L138: red *r7
+; comment
+cmp r7, *r3
+L139: red L472
+L140: red L3
+L141: .string "zynbmdnelihpietnvyntsvsu"
+stop
+not r3
+L142: stop
+cmp L16, *r2
+mov r6, *r4
+L143: dec r7
+L144: .string "wrluozlsxraeoppjdnmak"
+L145: bne *r0
+jsr L510
+L146: cmp #25, #137
+dec L126
+L147: clr *r4
+add *r2, L38
+not r6
+bne L323
+L148: add L207, L108
+L149: mov *r5, r0
+L150: rts
+L151: .data -271, -667
+stop
+L152: bne L77
+not *r4
+L153: dec L98
+L154: .string "pbmbttthe"
+cmp L45, r3
+; comment
+L155: inc r3
+L156: jmp *r6
+cmp *r5, r6
+
+inc L41
+L157: sub *r2, r0
+sub #-186, *r0
+L158: jsr L118
+L159: add *r3, r4
+L160: .data -181, 168, 116
+L161: stop
+mov r5, *r6
+L162: jmp *r5
+L163: add *r1, *r2
+L164: dec L601
+L165: cmp #-128, r3
+inc *r6
+; comment
+red L572
+
+L166: .data -395, 25, -202
+dec *r0
+lea L7, *r3
+L167: rts
+bne *r0
+mov r6, *r3
+L168: jmp *r3
+L169: dec L537
+rts
+L170: rts
+L171: jsr L132
+; comment
+L172: .data 822, 34, 191, -585, -782, -616
+L173: cmp *r2, L578
+jmp L282
+L174: dec L418
+L175: clr r2
+L176: jsr L377
+L177: red r0
+jmp *r5
+L178: dec r1
+L179: not r4
+L180: dec *r4
+; comment
+jsr L495
+L181: prn r3
+; comment
+jsr L109
+L182: not r2
+rts
+bne *r5
+lea L147, *r1
+L183: prn L69
+L184: bne *r5
+L185: cmp *r3, *r2
+L186: prn r2
+L187: inc L439
+stop
+L188: add #-55, L141
+dec *r7
+L189: dec L131
+dec *r7
+L190: not *r0
+L191: .data -368, 393, 297
+L192: lea L202, L142
+L193: inc L207
+inc r5
+
+L194: .string "biseoixyasof"
+L195: jmp *r1
+L196: mov L154, *r6
+L197: mov #-42, r2
+rts
+L198: jsr *r3
+L199: lea L51, r7
+L200: .string "alyvieyhx"
+L201: dec L285
+L202: inc L323
+jsr *r2
+cmp L23, L414
+prn #-228
+L203: bne *r7
+L204: red *r7
+L205: rts
+; comment
+L206: mov r2, *r1
+L207: dec L103
+inc L11
+L208: .data -528, -855, -347, 64, -990, -163
+L209: dec *r0
+cmp #-249, *r1
+clr L63
+L210: prn r3
+jmp *r1
+L211: rts
+add r7, r5
+jsr L116
+
+dec r0
+clr r5
+L212: bne *r6
+sub #-129, r1
+L213: dec L198
+L214: sub #6, *r1
+; comment
+L215: inc *r5
+cmp L588, L382
+not r4
+clr L114
+L216: dec L99
+rts
+jsr L139
+mov L314, L303
+add #-210, r2
+inc r6
+rts
+L217: rts
+L218: .string "ydvxidjzdhcewppd"
+jsr L206
+jsr L498
+L219: dec r4
+rts
+L220: dec *r2
+L221: prn #-165
+clr *r0
+L222: clr L185
+L223: red L274
+dec L113
+L224: .data 43, 546, 655, -940
+L225: add r0, r6
+L226: sub r7, L41
+L227: stop
+L228: prn *r5
+L229: inc L383
+L230: rts
+L231: clr *r0
+L232: bne *r4
+L233: jsr L383
+L234: clr L149
+add #107, *r0
+add *r6, L226
+red *r3
+L235: stop
+jmp L187
+cmp #-127, #-244
+L236: not r1
+L237: .data -189
+cmp r6, r1
+L238: not *r0
+L239: bne *r0
+sub r0, *r6
+L240: jsr *r3
+L241: inc r1
+L242: stop
+L243: bne *r3
+L244: red r4
+red L433
+L245: lea L395, L33
+L246: mov *r1, r4
+L247: stop
+jmp *r5
+lea L180, L247
+L248: lea L537, *r3
+L249: clr r6
+mov #200, L171
+L250: clr *r0
+L251: jsr L290
+L252: jmp L308
+L253: bne *r5
+L254: .string "omlmrkunqnjizssbof"
+dec L341
+L255: .data -397, 464, -803, -895, -693, -296, -28, 704
+L256: mov #214, *r5
+sub L72, r2
+L257: red *r0
+L258: add #24, r1
+L259: red L276
+L260: dec r2
+L261: not L181
+stop
+L262: .data -511, 922, 721, 99
+add L574, L391
+L263: jmp *r7
+L264: prn r3
+L265: red L33
+L266: prn L294
+prn r2
+
+L267: .data 11, -381, -668, -194, -903, 131, 12, -909
+L268: prn #-170
+mov *r0, *r3
+not L52
+L269: cmp *r2, *r4
+L270: inc *r6
+L271: rts
+L272: clr r0
+L273: prn L242
+jmp *r7
+lea L500, r7
+prn *r5
+L274: stop
+L275: dec L164
+stop
+L276: .string "p"
+L277: .data -26, -305, 671, -899, -227
+L278: .string "oxixbw"
+L279: mov L524, *r5
+L280: .string "wjpubrclueulm"
+L281: cmp *r4, L450
+sub #217, L556
+L282: jsr L456
+jmp *r2
+L283: dec r5
+L284: cmp r4, L92
+add #39, L384
+L285: lea L494, r0
+L286: cmp #248, r5
+L287: clr L554
+L288: rts
+L289: add #5, *r5
+L290: prn r4
+L291: add r4, r2
+L292: rts
+jmp *r2
+jsr L222
+L293: dec r7
+sub *r5, L595
+L294: stop
+rts
+L295: stop
+L296: inc r0
+L297: cmp r0, *r7
+L298: .data -407, 420, 997, 594, -981, -798
+L299: bne L1
+L300: .data -270, 333, 596, 333, -205, 136
+L301: clr r5
+
+dec r2
+L302: not r3
+L303: sub r3, *r5
+L304: bne L491
+L305: .data 592, 438, -485, 297, -820, 174, -635
+L306: .string "vsnjyihmw"
+add *r2, L398
+L307: .string "lhwzecvbqckckggbcj"
+dec r4
+inc r5
+L308: prn *r1
+mov L308, r1
+jsr L491
+L309: jmp *r7
+; comment
+L310: inc r1
+L311: clr L311
+L312: stop
+L313: rts
+red L6
+L314: cmp *r2, L226
+inc L340
+L315: add r2, *r0
+L316: dec L516
+inc *r3
+L317: lea L382, *r1
+L318: rts
+L319: clr r2
+L320: sub L546, L56
+stop
+L321: jmp *r7
+L322: stop
+lea L490, r6
+L323: prn L109
+clr r1
+bne *r5
+L324: bne *r7
+L325: rts
+L326: rts
+clr r7
+L327: bne *r3
+add #31, r2
+L328: .string "ibjsusuwxqgl"
+L329: jmp L571
+L330: .data -511, -98, -160, -591, 227, -290, 268, -931
+L331: .data -952, -183, 884
+prn #149
+L332: rts
+L333: red L590
+L334: sub L604, *r5
+rts
+L335: .string "thfncddlkhgsvobxdivm"
+L336: rts
+mov r2, L459
+dec r5
+L337: add r2, r5
+lea L258, *r1
+L338: red *r2
+L339: not r4
+L340: .data -791, 695, -939, -104, 637, 405, 803, 877
+prn #183
+L341: sub L279, *r4
+L342: .string "wmvjtfulwhxqtpglwq"
+inc *r3
+L343: prn #-139
+L344: prn r2
+sub r4, L546
+L345: sub r6, r6
+L346: rts
+L347: clr *r6
+L348: inc r3
+L349: dec *r1
+L350: .data -788, 103, 525, 695
+mov L400, r3
+L351: stop
+clr L179
+L352: .data 227, -878, 151
+L353: not r7
+L354: dec L178
+L355: prn r7
+L356: rts
+sub L368, r7
+L357: lea L524, r7
+L358: stop
+L359: rts
+L360: red L382
+L361: bne L57
+prn *r4
+L362: jsr L461
+L363: prn r5
+rts
+bne L258
+L364: red r7
+L365: lea L291, r3
+jmp L477
+L366: not *r0
+L367: inc r0
+rts
+L368: jsr L50
+lea L543, r0
+red *r6
+L369: red r4
+L370: jmp *r7
+mov L156, L482
+L371: mov L96, L469
+L372: inc r1
+L373: dec *r5
+lea L187, r1
+jmp L530
+cmp *r0, L32
+L374: stop
+L375: sub *r2, L14
+inc *r7
+L376: rts
+L377: rts
+; comment
+L378: stop
+cmp L449, #-83
+L379: inc L19
+prn L393
+prn r4
+L380: not r0
+mov #-16, L167
+L381: bne *r6
+L382: .data -267, -415, -885
+L383: add r7, L47
+rts
+cmp #-35, *r5
+L384: red L520
+L385: add L241, r5
+L386: red L467
+L387: clr L21
+L388: .data -982, 43, -118, -861, -144, -533, 681, 174
+L389: add *r4, *r7
+
+sub *r6, *r6
+jsr *r5
+L390: clr L428
+L391: .data -595, 826, 346, -402
+
+L392: inc *r2
+lea L320, *r3
+rts
+L393: jmp *r3
+rts
+L394: sub r7, *r5
+L395: clr L610
+L396: add #244, r2
+bne L292
+L397: inc r4
+bne *r1
+L398: red *r3
+L399: add L565, *r0
+L400: sub #-70, *r0
+L401: .data -36, -721, 495, -150
+L402: cmp #233, *r1
+L403: add #-154, *r0
+L404: rts
+L405: red *r3
+L406: bne L485
+L407: add L460, L482
+L408: add #166, *r5
+inc *r2
+L409: inc r1
+L410: clr r3
+not r3
+prn #-96
+L411: dec L205
+L412: mov #184, r1
+clr *r0
+L413: dec r1
+dec *r3
+L414: stop
+; comment
+cmp #-78, *r3
+L415: mov r0, L524
+bne L43
+L416: add L435, r5
+L417: jsr *r4
+L418: not r1
+L419: sub L591, *r3
+mov *r6, r7
+red r4
+L420: dec L121
+L421: jmp L530
+L422: stop
+L423: dec r1
+L424: lea L593, L285
+L425: mov r4, L528
+L426: not L552
+L427: stop
+
+mov r6, r6
+L428: .data -859, 209, -947, 627, -978, -313, -777, -585
+L429: lea L320, r1
+L430: not L443
+L431: cmp #-227, L34
+; comment
+inc r1
+L432: prn #-62
+cmp r7, L75
+prn r6
+; comment
+L433: jsr *r0
+L434: rts
+dec *r6
+L435: dec r6
+not *r5
+L436: .string "ttjnpmuypyxgntslarz"
+
+L437: lea L485, *r1
+; comment
+rts
+cmp *r1, *r7
+L438: inc r7
+L439: add L275, r4
+L440: stop
+clr r6
+L441: .string "uupnvkoqimaej"
+cmp #191, *r4
+L442: .data -723, 448, -451, -608, -617, 607
+L443: .data 237, -832, -242, -36
+mov L528, L493
+L444: jmp *r0
+L445: .string "vybwi"
+jmp *r2
+
+lea L532, r0
+lea L109, *r5
+L446: red L137
+; comment
+L447: cmp L251, #-10
+clr r7
+L448: bne *r6
+add L418, *r3
+clr *r1
+L449: red *r7
+L450: .data -686, -555, -757, 881
+bne *r1
+L451: .string "zdgyhrpjxb"
+jmp *r7
+lea L105, r4
+L452: mov *r6, *r7
+cmp #-229, r1
+L453: stop
+add *r7, *r7
+red r2
+L454: mov *r2, *r4
+L455: not L457
+L456: jmp *r2
+dec *r3
+; comment
+L457: add L593, r4
+L458: .data -137
+L459: .data -390, 855, 645, -768, 54
+L460: rts
+not L209
+L461: not r0
+L462: sub *r6, L134
+L463: dec *r4
+L464: bne L611
+; comment
+not r5
+not L590
+L465: inc r7
+inc L611
+L466: rts
+L467: .data -517, -861, -267, 729, 373, -652, -412, 306
+jsr *r4
+L468: dec L359
+rts
+L469: sub r1, r1
+L470: mov #195, *r6
+add #223, r3
+; comment
+; comment
+L471: lea L379, L524
+L472: .string "mbadobmrhtmcjuxmqs"
+L473: not *r1
+L474: .string "g"
+L475: cmp #-244, L289
+; comment
+L476: red L555
+L477: mov *r6, r1
+L478: clr r6
+L479: stop
+L480: .string "qnjlqnaaxmogakby"
+inc r0
+jmp *r2
+L481: stop
+L482: cmp #-153, *r5
+L483: lea L571, *r7
+L484: stop
+not *r3
+L485: add *r4, *r1
+L486: lea L509, r5
+stop
+L487: .string "do"
+L488: mov *r3, r4
+L489: inc L93
+L490: prn #66
+L491: clr *r0
+clr r2
+inc L595
+L492: mov r0, L24
+mov #177, r5
+; comment
+dec r1
+L493: not *r4
+L494: rts
+L495: inc r6
+L496: jmp L568
+rts
+mov *r7, L581
+L497: rts
+L498: .data 547, -61, 597, 458
+dec r4
+L499: rts
+L500: red r3
+L501: not *r4
+; comment
+L502: prn #-229
+L503: inc *r3
+L504: bne *r5
+dec *r5
+L505: inc L162
+L506: not r5
+L507: not *r6
+L508: jsr L533
+L509: sub r5, *r4
+L510: clr r4
+L511: .string "jtngxlsmzyrldlft"
+stop
+L512: not r1
+L513: prn #-159
+L514: .data -328, -547, -39, -528, -76
+L515: .data 595, -769, 29
+mov r7, *r1
+L516: .data 763
+L517: rts
+jmp L552
+inc L439
+L518: .string "vmm"
+cmp *r3, #85
+jsr L527
+L519: add #-65, r5
+L520: red r7
+inc L278
+L521: lea L425, r6
+L522: cmp r0, *r3
+L523: lea L588, *r1
+L524: rts
+lea L77, L458
+L525: jmp L478
+lea L316, r1
+sub #-94, r0
+L526: red L595
+L527: dec L544
+; comment
+stop
+L528: clr L362
+L529: rts
+L530: inc *r6
+stop
+jmp L576
+L531: bne L239
+L532: lea L584, L318
+L533: stop
+L534: jmp L217
+L535: not *r7
+L536: bne L369
+L537: .data -123, -525, 772, 314
+L538: dec L550
+L539: stop
+L540: dec *r1
+
+L541: not r2
+red *r4
+red *r6
+inc r1
+L542: stop
+L543: rts
+add #-252, L594
+; comment
+L544: lea L205, r1
+mov *r5, r3
+clr *r3
+bne *r0
+L545: dec r0
+add r7, *r7
+L546: .string "a"
+jmp *r3
+cmp r2, #204
+L547: jmp L607
+rts
+dec *r2
+L548: clr L227
+L549: rts
+L550: stop
+L551: inc r4
+L552: dec r5
+; comment
+L553: stop
+L554: clr r3
+red *r0
+L555: sub r2, L599
+L556: mov *r2, r7
+add r0, *r7
+L557: red L571
+jmp L501
+dec L585
+L558: .data 498, 274
+; comment
+clr r4
+jmp L341
+L559: add #-37, L385
+L560: cmp *r2, #41
+L561: jsr L588
+L562: rts
+L563: add #239, L591
+L564: bne L584
+L565: jsr L542
+L566: stop
+bne L567
+jsr L609
+L567: prn r2
+L568: inc r0
+stop
+L569: add r2, L575
+not L254
+
+L570: inc r7
+jmp *r6
+; comment
+L571: sub #-48, L415
+prn *r5
+L572: .string "cfywwlnaotyecctvbujgp"
+L573: mov *r6, L578
+L574: jsr L578
+L575: sub #-63, *r2
+
+add r1, L426
+L576: lea L582, L582
+L577: add L278, r0
+bne *r3
+L578: mov L129, r6
+L579: .string "csaqppaivjut"
+add L605, *r7
+L580: clr *r6
+L581: rts
+L582: stop
+clr L470
+inc *r2
+L583: mov L594, r4
+L584: dec L565
+L585: red *r4
+add *r3, L610
+rts
+L586: not r0
+L587: mov *r0, *r2
+L588: jsr L589
+not L609
+sub r7, L143
+L589: rts
+L590: jmp L571
+jsr *r5
+L591: dec r2
+L592: rts
+L593: sub #-199, *r1
+mov r4, r0
+mov *r0, *r6
+L594: .data -925, 834, 958, 153, -467, -575, 796, 909
+L595: prn *r0
+L596: mov *r6, r2
+jmp L605
+L597: jsr *r2
+dec r7
+L598: sub L610, r5
+L599: .string "lzhvhhy"
+
+L600: add #167, L604
+inc L419
+L601: lea L218, r6
+L602: clr r3
+not L610
+inc *r1
+
+L603: .string "axjn"
+L604: red L9
+cmp *r6, L297
+L605: dec L607
+L606: mov L609, L33
+L607: jsr L162
+L608: stop
+mov *r7, *r7
+rts
+L609: .string "sdxbxlhcderzvnv"
+L610: sub *r2, *r0
+lea L611, r5
+L611: bne L403
+; comment
+stop
@@ -0,0 +1,1040 @@
+; Generated by genCorpus --seed 24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+L0: bne *r5
+bne L0
+L1: not r0
+jsr *r0
+mov *r5, *r0
+L2: dec *r2
+L3: red r7
+L4: bne L2
+; comment
+L5: inc r4
+stop
+L6: .string "icpodsscfi"
+L7: red L114
+bne *r2
+L8: rts
+L9: not *r7
+L10: .string "aimwhpv"
+prn L4
+rts
+inc r3
+L11: red L4
+L12: sub L542, *r4
+add #-213, L11
+L13: .string "oobpehquhmgoctchy"
+
+L14: rts
+L15: rts
+L16: not *r0
+L17: cmp #21, L16
+red r7
+; comment
+L18: .string "oz"
+L19: lea L48, *r7
+mov L584, r0
+jmp *r3
+dec *r5
+not r4
+L20: red L463
+L21: bne *r1
+L22: inc *r3
+L23: red *r6
+L24: not *r5
+L25: stop
+cmp *r5, #-115
+L26: red *r7
+L27: sub *r1, *r2
+cmp *r0, *r2
+inc r1
+L28: mov *r7, *r0
+L29: jsr *r3
+; comment
+L30: jsr L149
+L31: clr *r3
+jmp L20
+L32: red r3
+L33: rts
+L34: dec r4
+clr *r3
+L35: .string "jdjpnwkmvxatl"
+L36: add *r5, r6
+L37: rts
+lea L460, L33
+L38: stop
+add #-119, r7
+rts
+red *r1
+; comment
+L39: lea L408, r0
+red *r0
+L40: lea L34, L449
+clr *r7
+L41: mov r4, *r6
+stop
+prn L32
+L42: inc r1
+L43: bne *r1
+inc L35
+L44: bne *r7
+L45: red L175
+dec *r1
+L46: cmp *r3, r4
+L47: inc *r0
+L48: .data 818, -48, -684
+L49: .data 77
+L50: mov *r3, *r3
+L51: lea L34, L0
+prn #13
+jsr L338
+lea L213, *r7
+prn *r7
+L52: stop
+L53: cmp r7, r1
+L54: lea L35, *r2
+jmp L431
+bne *r1
+L55: red *r0
+rts
+jmp *r6
+rts
+mov *r7, L42
+L56: jsr L234
+dec L111
+L57: jsr *r4
+jmp *r4
+jmp *r5
+L58: .string "yoogwfubvfyxyqffe"
+jsr L549
+prn r7
+jsr *r7
+rts
+L59: not L308
+lea L123, *r0
+L60: jmp *r6
+L61: prn L57
+L62: jmp L353
+L63: prn L16
+L64: mov #24, r3
+stop
+stop
+L65: cmp L16, L10
+L66: clr L577
+stop
+L67: .string "fyibmmmnbz"
+L68: sub *r4, *r3
+inc *r1
+bne *r6
+L69: dec L4
+L70: add L42, r5
+jsr L48
+L71: cmp *r3, r0
+L72: lea L311, L65
+mov r0, *r4
+L73: stop
+not r6
+L74: bne L239
+L75: .string "en"
+L76: cmp #-248, L63
+red L21
+L77: red r4
+L78: rts
+L79: prn r2
+cmp #145, L20
+not r3
+rts
+L80: bne L58
+red L8
+L81: stop
+add *r7, L441
+
+L82: jsr L276
+rts
+add L22, L53
+rts
+L83: prn r3
+clr L167
+L84: inc r2
+clr L114
+not *r5
+L85: add #-211, r3
+stop
+L86: not L55
+add L111, L176
+L87: red r2
+L88: lea L108, r3
+L89: jmp L6
+L90: not r0
+lea L583, L1
+L91: not *r6
+L92: red L12
+cmp r7, r1
+L93: red *r1
+add L69, L22
+L94: sub r4, L196
+L95: cmp L64, r0
+jmp L72
+L96: .data 276
+L97: rts
+L98: stop
+red r3
+L99: inc L20
+
+L100: not r4
+jsr L3
+; comment
+L101: stop
+inc *r5
+L102: lea L100, L471
+L103: .data 25, 569, -291, -67
+L104: red *r3
+L105: dec r6
+L106: dec r3
+L107: clr L74
+bne L393
+L108: .string "djotvmziqwrtxq"
+lea L375, r3
+L109: clr r1
+L110: jmp *r2
+L111: sub L20, r1
+L112: clr r3
+L113: add #-235, L75
+L114: .string "hy"
+dec L97
+
+L115: inc L20
+jmp *r6
+not r5
+red r7
+lea L529, L51
+L116: lea L308, *r7
+L117: sub r5, L263
+cmp #-133, L70
+L118: add *r6, L504
+L119: inc *r3
+L120: jsr *r7
+rts
+L121: add L483, *r1
+L122: clr r4
+L123: rts
+L124: jmp *r7
+L125: .string "o"
+L126: .string "kcw"
+L127: stop
+add L578, *r7
+L128: .data 228, 847, 368, -240, -974, 212, -634, -462
+dec L590
+clr r6
+L129: jsr L257
+L130: .data -511, -593, 668
+L131: inc *r5
+; comment
+L132: cmp r4, *r7
+L133: clr r0
+stop
+L134: clr r0
+L135: prn L35
+L136: red *r2
+L137: .string "nnuztlcxjueozpaadfopgfq"
+L138: rts
+prn r6
+L139: prn *r4
+L140: mov #-214, L129
+L141: .string "dhhwborigkkv"
+L142: .string "hydrfaqgaw"
+add #-203, r7
+L143: clr L403
+cmp #89, L436
+L144: inc L0
+L145: .data -208, -812, -722, -288, 356, 856, 873
+jmp L81
+clr r0
+L146: lea L114, *r1
+L147: jsr L396
+L148: stop
+
+stop
+sub L77, *r2
+L149: bne L4
+L150: jsr L61
+L151: clr L94
+jsr L126
+dec *r2
+L152: jmp *r0
+L153: red L479
+L154: add *r7, L79
+L155: stop
+rts
+jsr L24
+
+L156: add *r4, L292
+; comment
+L157: dec L552
+L158: lea L198, r1
+rts
+rts
+inc *r1
+jmp L480
+L159: cmp L55, L99
+bne *r0
+L160: dec r0
+red *r5
+L161: not r2
+prn L326
+L162: lea L34, *r5
+L163: inc L225
+L164: add L92, r5
+dec *r0
+L165: rts
+L166: not *r3
+
+L167: jmp *r2
+; comment
+L168: prn *r4
+L169: stop
+dec r0
+sub r7, *r5
+L170: .string "ngftpp"
+; comment
+rts
+red r1
+L171: .data -719, 276, -273, -392
+L172: cmp *r1, L475
+L173: add #-19, L35
+add *r5, L4
+L174: cmp *r5, r1
+stop
+L175: clr r7
+L176: lea L577, L209
+lea L527, *r4
+L177: add r3, r0
+rts
+; comment
+rts
+L178: rts
+mov r5, *r0
+L179: bne L419
+L180: .string "dyouefgydpnfacwajfd"
+prn *r0
+prn #150
+L181: .string "hrnaduxshtdkwsz"
+L182: .string "j"
+L183: dec L3
+L184: sub *r7, r7
+L185: not L111
+bne L56
+L186: sub *r7, L19
+L187: rts
+L188: sub *r7, *r3
+L189: .data 681
+L190: jmp *r5
+
+stop
+L191: not r4
+L192: jmp L51
+L193: jsr L255
+L194: .data -760
+L195: mov r5, L534
+mov r7, r5
+L196: .data -919, -207, -237, -655, -546
+L197: dec L290
+L198: inc *r1
+L199: mov L90, L570
+L200: jsr L437
+L201: bne *r5
+inc *r0
+L202: bne *r0
+L203: rts
+add #79, r5
+jsr L58
+L204: jmp L585
+rts
+L205: lea L30, *r4
+L206: jmp *r0
+L207: jmp *r1
+add *r1, L346
+L208: jmp L42
+L209: clr L48
+L210: jmp *r6
+L211: mov r2, L471
+prn r4
+L212: add L77, r0
+L213: prn r4
+L214: bne L86
+bne L144
+L215: sub #-190, r5
+L216: mov L434, r1
+; comment
+L217: bne L208
+L218: stop
+L219: .string "k"
+L220: bne *r6
+L221: stop
+
+not *r7
+L222: lea L329, r0
+
+add r5, L69
+L223: bne *r6
+inc L293
+L224: lea L78, *r7
+L225: .data -515, 834, -576, -7, 26, 627, 217, 635
+L226: not L221
+; comment
+clr *r7
+L227: .data -674, -476
+rts
+L228: dec *r7
+mov L301, r0
+sub #-99, L395
+stop
+L229: clr r0
+L230: lea L296, L45
+clr L582
+L231: sub #178, r7
+jsr *r3
+L232: jmp *r6
+L233: .string "borvmauxjtcgpolfd"
+L234: not *r6
+L235: prn L291
+; comment
+L236: lea L482, r5
+bne L447
+red *r7
+L237: rts
+L238: cmp r4, r4
+L239: .string "mojruocuqkqinnulnz"
+L240: stop
+jmp *r0
+bne L576
+L241: jsr L52
+red r1
+L242: jmp *r5
+L243: rts
+add r0, r0
+L244: red r1
+L245: stop
+L246: lea L530, *r4
+add r4, L205
+L247: inc r4
+stop
+rts
+prn L242
+dec *r3
+L248: .data 321, -37, 637, 739, -720
+mov r2, r7
+L249: cmp #75, #166
+L250: jmp *r6
+L251: rts
+add r7, L68
+L252: not L480
+mov r6, *r7
+L253: inc L115
+L254: rts
+L255: jsr *r1
+L256: add #-85, L65
+L257: clr *r0
+L258: stop
+L259: inc *r1
+L260: prn #-23
+; comment
+L261: prn L235
+L262: prn r0
+L263: prn #247
+L264: rts
+L265: prn r3
+L266: mov L580, L322
+L267: sub r5, r0
+L268: stop
+lea L505, *r1
+L269: add r1, L350
+L270: red r7
+inc r7
+L271: bne L384
+jsr L548
+L272: not r2
+rts
+L273: red *r6
+L274: cmp L430, L542
+L275: inc L389
+L276: .data 839, 22
+sub r5, L293
+L277: jmp *r5
+L278: .data 471
+jsr L345
+L279: not r5
+prn *r1
+L280: .string "pgdpt"
+L281: .string "dbhngrvzspdhvzgvg"
+L282: jsr L300
+L283: red r4
+jsr *r1
+stop
+L284: prn r0
+L285: bne *r5
+L286: rts
+L287: lea L373, *r6
+L288: prn r3
+L289: jsr *r4
+rts
+L290: prn r0
+L291: bne *r4
+add L149, *r1
+L292: stop
+L293: cmp r2, #189
+L294: not r3
+jsr L484
+sub L1, r0
+L295: rts
+L296: .data 874, 916, 945, -833, 292, -924, -24
+prn L189
+L297: dec L337
+L298: bne *r6
+L299: add r1, r6
+cmp *r4, *r0
+L300: jmp L293
+L301: rts
+
+L302: red r3
+L303: not r1
+L304: prn r1
+not r3
+L305: stop
+L306: inc L241
+L307: .string "vgtnapuj"
+L308: jsr L530
+sub *r0, L46
+L309: rts
+L310: not r2
+L311: prn #7
+jmp *r6
+
+L312: .string "jjwazpmgmi"
+L313: dec r0
+L314: .data 886, -156, -277, -321, -544, -890
+L315: cmp L472, L328
+L316: inc *r6
+; comment
+L317: stop
+dec r2
+clr *r7
+L318: jsr *r6
+lea L8, L386
+L319: not *r6
+L320: .data 574, 508
+L321: bne *r2
+L322: .data -468, -80, 671, 935, 170
+clr *r0
+prn *r1
+jsr L51
+L323: bne *r4
+L324: dec L53
+L325: lea L375, r4
+L326: rts
+lea L48, *r4
+; comment
+L327: not r6
+L328: red L347
+cmp #-67, L340
+L329: jmp L54
+L330: .data -806, -809, -910, -447, 12, -529, 344, 503
+L331: jmp *r6
+L332: bne L18
+L333: stop
+; comment
+L334: red L228
+dec L535
+L335: clr *r3
+; comment
+bne L289
+inc *r0
+L336: dec r2
+L337: .string "fuur"
+L338: .data 712, -291
+L339: jsr L12
+prn *r1
+sub #-182, *r2
+lea L373, r7
+L340: cmp L558, r2
+; comment
+L341: .data -370, 187, 190
+L342: .data -557, -529, 790, -361
+L343: lea L402, L576
+L344: prn L61
+red L416
+L345: cmp #195, #36
+L346: jmp L107
+cmp r2, *r7
+add L384, L364
+bne *r4
+L347: sub *r5, L76
+L348: .string "yhalbnlstdvawvjlejwzosx"
+L349: clr r2
+L350: clr r3
+inc L321
+L351: stop
+
+red L55
+L352: stop
+L353: cmp #-158, r1
+L354: prn r2
+cmp #-35, r5
+L355: bne *r0
+dec L177
+L356: stop
+prn *r6
+; comment
+L357: stop
+L358: stop
+L359: red *r5
+L360: prn r1
+jsr L172
+sub L569, L131
+clr r7
+L361: sub r6, *r7
+
+prn L212
+L362: dec r0
+L363: red *r4
+not *r0
+L364: .data 636, 110, 107
+L365: inc *r5
+inc r2
+L366: not L385
+L367: not *r3
+; comment
+L368: not L553
+inc L487
+L369: prn L276
+not r7
+L370: add *r4, r3
+; comment
+jsr L69
+L371: mov r1, r1
+inc L504
+L372: bne *r3
+jmp L4
+lea L226, r1
+L373: mov #80, L588
+rts
+L374: .data 153, 629
+L375: cmp #121, r6
+L376: .string "hofkpnlqmpghxiemtjhsacw"
+L377: sub r4, L62
+L378: mov r2, r6
+
+L379: not r6
+L380: red *r5
+; comment
+add *r5, *r7
+not r3
+lea L191, *r1
+jmp *r4
+rts
+L381: bne *r5
+bne *r7
+L382: prn r0
+mov *r5, L490
+L383: cmp *r5, *r3
+L384: inc L174
+L385: red r7
+L386: jmp *r3
+L387: red *r3
+bne *r7
+L388: add #117, L242
+L389: lea L474, *r5
+L390: add *r4, r2
+L391: not *r1
+mov #158, r6
+red *r2
+L392: inc L275
+L393: clr L133
+
+L394: prn r4
+L395: cmp L126, *r5
+L396: inc r0
+L397: clr *r7
+L398: dec L448
+rts
+L399: stop
+; comment
+L400: .data 368, 296, -48, -503, 484, -645, 803
+L401: sub #-163, r6
+L402: inc L28
+L403: cmp r5, #129
+sub L17, r1
+bne *r0
+prn r2
+L404: .string "hzafwfgk"
+stop
+L405: .data 739, -55, 3, 31, 330, 672, 48
+sub *r5, r3
+L406: dec L254
+L407: bne *r3
+L408: rts
+clr r6
+L409: prn *r7
+bne *r2
+L410: jsr *r1
+; comment
+L411: cmp #-151, r6
+; comment
+L412: prn L176
+prn r0
+L413: sub r6, *r4
+not r4
+L414: add L579, L463
+rts
+jsr L338
+L415: .string "xokpzgvggwchcmidl"
+L416: lea L143, r2
+jsr *r1
+cmp L533, L299
+cmp *r5, r0
+L417: inc *r3
+L418: jmp *r3
+L419: mov L482, L434
+stop
+L420: stop
+L421: prn *r4
+
+clr L497
+L422: .string "hvmd"
+rts
+L423: sub #199, *r2
+L424: .string "cfxrclmub"
+L425: clr *r3
+L426: rts
+L427: lea L58, L473
+L428: mov L249, *r0
+L429: .string "klonylezgpfqqijeefngsdb"
+rts
+L430: .data 229, 370, 165, -900, 645
+mov L528, *r6
+L431: dec *r3
+L432: sub L472, L120
+L433: lea L105, *r1
+L434: dec L257
+L435: stop
+jsr *r2
+prn #3
+L436: rts
+L437: rts
+L438: not r2
+mov *r6, L47
+inc r4
+L439: bne *r2
+L440: prn L364
+L441: cmp r0, #49
+L442: add *r4, *r1
+L443: jsr L402
+L444: inc r5
+; comment
+L445: inc L513
+not *r1
+L446: bne L4
+L447: bne L134
+rts
+lea L502, *r0
+cmp r5, r2
+L448: lea L492, r5
+jsr L489
+mov L134, r0
+L449: .data 484, -579, 93
+clr L584
+L450: dec r7
+add *r6, L521
+L451: bne L68
+prn *r0
+L452: prn *r7
+L453: inc L260
+rts
+not r2
+cmp #135, L366
+cmp *r6, #-160
+
+
+cmp #-170, L492
+red r0
+L454: sub r7, *r1
+stop
+L455: cmp *r3, L158
+prn r6
+lea L169, r0
+stop
+L456: add #-154, L117
+mov *r4, L457
+L457: sub *r1, r0
+rts
+L458: red r1
+jsr *r3
+; comment
+prn r0
+
+L459: lea L327, r0
+L460: prn L451
+L461: red r7
+L462: bne L523
+mov r4, r1
+L463: sub r5, r2
+L464: prn *r7
+L465: .data 97
+L466: rts
+L467: dec *r7
+L468: inc *r0
+L469: red L528
+inc r6
+sub r2, r6
+L470: rts
+L471: dec r7
+jsr L521
+L472: prn r7
+lea L340, r6
+not L576
+L473: .string "jpxnbjotbza"
+L474: lea L532, *r6
+L475: red *r5
+L476: .string "arnusebkrxomqdvqanfddjv"
+not r5
+L477: not *r5
+red r7
+L478: mov *r5, r6
+L479: clr L530
+dec r3
+L480: lea L497, *r3
+not r1
+L481: stop
+L482: add r6, r7
+not L426
+bne L545
+L483: bne L226
+L484: inc L326
+L485: cmp r1, L528
+inc L571
+not r3
+sub *r5, r4
+
+L486: jmp *r6
+L487: mov r1, *r5
+L488: sub #112, *r2
+L489: mov #-153, *r0
+clr r6
+L490: .string "jutglpmydxgmy"
+lea L532, L296
+L491: add #216, *r0
+stop
+lea L493, r5
+jsr *r5
+L492: jsr *r7
+L493: jmp *r3
+L494: mov *r4, *r1
+L495: jmp *r0
+not r0
+L496: clr L17
+inc r2
+L497: inc L503
+L498: .data -201, 153, 451, 86, -375, -187, -75, 540
+L499: red r2
+L500: sub #-205, *r7
+L501: mov #-181, r0
+sub r1, r1
+L502: .data 840, -649
+add L284, r5
+add #-159, *r2
+L503: not L369
+rts
+; comment
+sub r7, *r1
+sub r2, r2
+L504: cmp L167, r4
+L505: rts
+; comment
+L506: prn r7
+L507: not *r2
+L508: .string "iajhpormpfdknxs"
+not *r4
+L509: cmp #-61, L563
+L510: lea L583, L68
+L511: not *r6
+L512: red *r4
+prn #22
+not r4
+L513: .data -86, 516, -83
+red L488
+L514: sub #-79, r5
+L515: cmp L62, L556
+red *r4
+L516: prn L522
+dec L171
+L517: prn L519
+
+L518: dec r3
+L519: rts
+L520: inc L119
+L521: jmp L554
+L522: lea L25, *r0
+stop
+L523: cmp *r4, r4
+mov *r4, *r4
+lea L299, r4
+add r4, *r3
+
+L524: .string "q"
+; comment
+L525: jsr L549
+L526: red r0
+jmp *r4
+L527: .data -772, 241, 66, -982, 656, 801
+L528: clr r2
+L529: not L226
+L530: bne L367
+rts
+not r2
+cmp *r6, #210
+L531: prn #60
+L532: add r1, r3
+L533: dec *r2
+L534: inc *r5
+L535: add L430, *r5
+
+L536: dec r7
+add r2, *r4
+; comment
+cmp #170, #54
+L537: jmp *r6
+L538: red *r7
+L539: stop
+L540: bne L593
+cmp *r6, *r4
+cmp r1, r6
+sub r6, *r7
+jmp *r6
+lea L571, L93
+L541: inc *r3
+L542: rts
+cmp L553, r2
+L543: prn L376
+sub L26, r0
+L544: cmp *r5, #-45
+L545: not *r1
+L546: mov *r7, r2
+L547: rts
+L548: mov #130, *r4
+prn r4
+
+clr *r0
+inc *r1
+L549: red L592
+add *r1, L588
+L550: prn r0
+L551: red r5
+L552: clr L557
+sub #59, r1
+sub r2, *r4
+clr L578
+L553: inc L300
+L554: jsr L557
+L555: prn L586
+red r0
+prn r1
+stop
+clr r7
+L556: mov #99, r3
+; comment
+L557: .data -497, 112, 977, -876, -787
+clr *r6
+L558: inc *r6
+inc *r3
+L559: dec *r2
+bne L590
+rts
+red L54
+L560: stop
+lea L63, *r1
+rts
+L561: prn L577
+jmp L549
+L562: clr L392
+L563: inc L580
+L564: jsr *r2
+L565: not r1
+jmp L2
+L566: jmp *r4
+L567: rts
+L568: jmp L30
+jmp L570
+L569: cmp *r4, L449
+L570: cmp r1, r3
+red *r1
+jmp L37
+cmp r1, #17
+L571: .data 488, -861, 650, 914, -435, 71, 699
+sub *r4, *r6
+
+L572: bne L573
+L573: .string "mu"
+L574: .string "paefjycjfzwvuscewrxr"
+L575: jmp L264
+L576: red r2
+L577: red L593
+L578: rts
+L579: lea L580, *r4
+L580: jsr *r3
+L581: inc *r4
+L582: clr r0
+L583: inc r1
+sub r2, L504
+L584: prn #8
+rts
+L585: cmp L306, #107
+L586: red L550
+L587: jmp *r1
+mov *r6, r2
+jmp *r0
+L588: sub *r4, r2
+L589: .string "dprrvhuxqggnknjdliiij"
+L590: prn L284
+lea L28, r6
+L591: stop
+L592: mov *r1, *r6
+add L351, r1
+L593: inc r7
+stop
@@ -0,0 +1,1039 @@
+; Generated by genCorpus --seed 25
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+sub L228, L476
+L0: mov r4, r4
+prn r0
+L1: bne L277
+L2: bne *r5
+rts
+prn *r1
+L3: inc L574
+L4: clr L3
+L5: .string "rilypssumdplrcybtuwmkc"
+; comment
+L6: rts
+dec *r0
+mov r3, L414
+jmp *r0
+stop
+L7: add L1, r5
+L8: red *r2
+L9: clr *r1
+L10: dec r0
+L11: red *r4
+L12: bne *r7
+add r4, r4
+L13: cmp #-185, #-106
+L14: dec *r0
+rts
+add L305, L11
+cmp r2, r5
+L15: jmp *r1
+L16: stop
+L17: .data 256, -327, -452, 414, -982, 125, -254
+L18: not r2
+clr *r3
+bne *r6
+L19: jmp L7
+L20: stop
+add *r2, *r0
+stop
+rts
+; comment
+L21: stop
+jsr L18
+sub #98, L2
+not *r1
+jsr *r4
+
+L22: add L15, L11
+L23: red r5
+L24: jmp L9
+jmp L445
+L25: lea L21, *r5
+mov *r2, *r4
+L26: .data 491, 405, -725
+red r3
+lea L95, *r6
+L27: mov *r2, r2
+L28: jmp *r0
+L29: lea L578, L483
+L30: .string "dbnggwonowfpfcpeukb"
+jsr *r5
+L31: rts
+prn r7
+not r5
+L32: not L21
+cmp r7, *r0
+L33: dec L29
+L34: sub r2, r4
+L35: bne *r2
+L36: stop
+jsr L34
+red L200
+inc L35
+L37: jmp *r5
+L38: clr *r4
+L39: mov r2, r0
+L40: .data -562, 775
+rts
+L41: jsr L480
+sub r6, L512
+; comment
+clr *r5
+
+L42: rts
+stop
+lea L22, r7
+bne L41
+red L39
+L43: inc L3
+L44: inc r6
+L45: jmp *r3
+L46: sub r1, *r1
+rts
+L47: lea L19, L20
+L48: clr *r6
+L49: jmp *r1
+L50: .data 926, 805, 595, -578, 207, -639, 319
+; comment
+jmp *r4
+jsr L24
+lea L15, L229
+inc L15
+L51: clr r1
+cmp r2, L225
+L52: mov #253, *r3
+L53: add #-18, *r3
+L54: .string "goqthdxgyivz"
+L55: jsr *r2
+L56: prn *r0
+L57: add *r4, L427
+L58: inc L293
+lea L100, *r2
+L59: not r2
+L60: not L40
+L61: .string "wsecdksiwc"
+sub *r3, *r5
+L62: cmp #-228, r5
+L63: clr L357
+L64: stop
+clr L139
+L65: add *r0, r7
+add *r7, L12
+dec *r1
+L66: dec *r7
+cmp r4, *r6
+cmp #-249, r7
+L67: .data 600, 620, -610, 224, 663, -169, 831, -698
+add #192, *r4
+L68: .data -447, -141, -384
+L69: red r0
+add L22, r0
+L70: dec L87
+; comment
+L71: cmp #111, *r2
+L72: dec *r6
+L73: .data -13, 992, 332, 850
+L74: cmp L47, L24
+L75: not L15
+L76: .string "uyvg"
+sub #17, *r0
+L77: .string "eekhkt"
+jmp L298
+add #7, *r4
+L78: rts
+rts
+rts
+L79: sub r4, r4
+; comment
+cmp r1, *r2
+L80: rts
+L81: jmp L24
+L82: mov L186, *r0
+sub L82, L378
+mov r7, *r4
+L83: bne L341
+mov r1, r6
+L84: add r6, r0
+rts
+clr *r1
+jmp L428
+L85: lea L52, L184
+L86: red L506
+L87: not r4
+L88: stop
+L89: dec L88
+L90: clr L19
+L91: sub L34, L59
+lea L3, L482
+L92: sub #238, *r3
+jmp *r7
+L93: lea L113, L34
+L94: bne *r0
+L95: bne L75
+; comment
+inc *r4
+clr *r2
+L96: add *r1, L77
+L97: lea L269, L169
+L98: .string "pnotpfdjnuzokaqmxdh"
+dec L568
+add r3, *r5
+L99: jsr L399
+L100: prn #-172
+L101: jmp L553
+L102: add L11, *r7
+L103: sub r1, L28
+L104: jmp *r5
+jmp L72
+L105: .string "qgkyyakifbriybxahleqoce"
+L106: rts
+L107: jmp *r1
+L108: .data -91, -288, 283, -89, -526
+L109: cmp r2, *r4
+L110: prn r7
+clr L105
+bne *r1
+L111: mov *r1, r5
+prn #195
+inc r1
+L112: .string "tvhbtf"
+
+
+L113: .string "pt"
+L114: prn *r4
+L115: stop
+L116: jmp *r6
+L117: jmp *r4
+L118: jsr *r2
+L119: sub *r1, r4
+L120: jsr L201
+not *r4
+jmp *r0
+rts
+L121: mov r6, r7
+cmp #-43, *r7
+L122: stop
+L123: sub #-170, L102
+prn r6
+L124: dec r5
+L125: sub r1, *r4
+bne *r1
+L126: not *r6
+add #-96, *r2
+L127: jsr L109
+cmp r1, L57
+add #-228, L100
+rts
+L128: red r2
+L129: prn #-220
+not r7
+rts
+L130: rts
+L131: lea L90, r0
+L132: prn L84
+L133: cmp r1, r4
+L134: jmp L407
+L135: red L45
+inc r1
+L136: sub #234, L537
+bne *r1
+jmp L131
+L137: prn #4
+L138: .string "uiuhrxwcfzuylosk"
+; comment
+jmp L124
+L139: dec L321
+L140: bne *r6
+L141: stop
+L142: bne *r2
+clr *r1
+jmp *r1
+L143: .data -95, 548, -288, 752, -800, 864, -872
+; comment
+L144: mov L509, *r7
+L145: prn r5
+not r5
+L146: lea L60, *r2
+L147: rts
+bne L251
+L148: jsr *r5
+L149: lea L45, *r1
+L150: clr L397
+clr L550
+clr r5
+add L17, L104
+lea L167, r5
+L151: prn L250
+sub L70, L401
+not L268
+mov #135, r2
+not L288
+jsr *r3
+
+L152: red *r1
+cmp #140, L203
+L153: stop
+L154: jmp L246
+L155: .string "p"
+not *r4
+L156: .data -449, 920, 285, -350
+prn #70
+L157: red *r2
+L158: bne L514
+
+L159: cmp *r6, r6
+L160: .string "kafocism"
+L161: dec *r0
+not *r3
+L162: rts
+red L359
+inc L184
+prn *r2
+L163: stop
+L164: bne *r4
+lea L188, r5
+; comment
+L165: jmp *r6
+L166: jsr L131
+L167: inc L67
+add L37, *r7
+L168: red L160
+L169: .data -856, 493, -326, 710, 365, -364, -773
+L170: add L132, r2
+L171: prn r0
+L172: clr r4
+rts
+L173: rts
+L174: .data -443, 427, -922
+sub #165, r7
+sub *r5, r4
+L175: mov L67, r4
+L176: cmp r1, r6
+cmp #204, r3
+L177: .string "fbzokbtpjsajcpfus"
+L178: not L240
+add *r3, *r5
+clr r6
+L179: add *r5, r7
+L180: red *r4
+; comment
+L181: stop
+L182: bne L357
+L183: jmp L191
+L184: prn r4
+L185: red *r5
+L186: clr *r1
+L187: inc L97
+L188: red *r1
+add r3, L510
+L189: .data 629, 281, 445, 493, 746, -347, -670, 324
+lea L36, *r6
+L190: .data 945, -582, -148, 359, -126, 99, -1
+L191: inc L510
+L192: lea L529, L85
+L193: mov #-50, r1
+L194: .data -518, 706, -645, 412, -360, 686
+L195: jsr L154
+L196: mov L184, *r5
+inc L153
+L197: add r6, *r5
+L198: lea L346, r7
+L199: .data -670, 744, -800, -555, 23, 553
+clr L360
+not L194
+clr r1
+cmp #-199, L260
+L200: rts
+dec r1
+L201: .data -508, 869
+dec *r1
+L202: not L140
+prn r3
+L203: jmp *r1
+L204: prn r4
+L205: prn *r3
+not L405
+L206: rts
+rts
+L207: stop
+cmp L100, L177
+prn #22
+cmp #208, L140
+stop
+prn L581
+rts
+
+inc L180
+not *r1
+; comment
+jmp L25
+inc L124
+L208: add r4, r5
+L209: sub *r2, L376
+dec r5
+L210: mov *r2, L576
+L211: bne *r2
+inc r4
+; comment
+L212: rts
+L213: add L327, *r0
+
+L214: sub L34, L2
+L215: prn L156
+stop
+L216: .data 569, -472, 784, -719, 46, 25, 732
+stop
+L217: jmp *r3
+L218: dec r3
+L219: add r0, L560
+cmp L126, L562
+L220: prn L17
+L221: dec L355
+mov #-96, L524
+L222: not r4
+L223: jmp L505
+L224: rts
+prn L356
+L225: stop
+prn L471
+not r2
+L226: add #-211, *r1
+L227: jsr *r4
+L228: clr L23
+L229: jsr L197
+jmp *r3
+jsr L338
+L230: stop
+L231: inc *r1
+L232: lea L246, *r4
+dec *r1
+L233: .string "mojlrzmmhuqck"
+L234: rts
+L235: stop
+L236: .string "hptksivurlw"
+L237: .string "te"
+L238: lea L551, r0
+cmp L175, L73
+not *r4
+L239: prn #-226
+L240: cmp L421, #138
+L241: sub *r5, *r3
+L242: .data 813, -587
+add #-183, L493
+L243: dec L575
+mov L284, *r0
+jmp *r1
+L244: rts
+jmp L299
+L245: rts
+L246: sub r3, r1
+L247: rts
+L248: .data -403, 317, 460, 212, -336
+mov *r0, L444
+clr L336
+L249: .data 619, -748, 336, 516, -315, 196, 137, -613
+L250: rts
+L251: .string "dhm"
+bne *r6
+L252: jsr L338
+jsr L577
+L253: clr L244
+L254: lea L183, r1
+sub *r2, *r6
+L255: cmp L254, #-34
+L256: not L541
+L257: .data 88
+jsr *r6
+L258: add #130, L390
+L259: jsr *r2
+L260: jmp L448
+L261: .string "qluqsme"
+lea L576, L410
+cmp #179, *r6
+; comment
+L262: inc r2
+lea L369, L15
+L263: jmp *r6
+L264: prn #-67
+L265: prn r7
+L266: stop
+inc r7
+L267: inc r4
+L268: add r7, r6
+cmp r4, r2
+; comment
+L269: jsr *r0
+L270: cmp r1, #189
+L271: stop
+L272: .data -668, 347, -363, -720, -862, -312, -893
+not r2
+red *r0
+
+L273: prn #171
+L274: sub *r2, *r6
+L275: jmp *r3
+cmp r3, #217
+L276: bne L386
+L277: add L334, L379
+L278: jsr L267
+L279: mov #-230, *r0
+bne *r1
+L280: cmp L311, r6
+L281: add L288, r0
+
+rts
+dec L360
+L282: red L453
+not L34
+L283: rts
+prn #71
+cmp #-25, L322
+L284: add #22, r6
+L285: inc *r0
+; comment
+mov #125, *r5
+red *r1
+L286: jmp *r6
+L287: clr L428
+cmp L336, r5
+L288: .data 395, 245
+L289: mov *r3, r0
+; comment
+L290: dec L546
+L291: prn L241
+L292: stop
+red *r1
+L293: red r5
+L294: stop
+L295: stop
+lea L391, *r6
+L296: mov #223, r2
+mov *r7, L117
+; comment
+L297: stop
+L298: .data -291, 963
+L299: .string "yswzwvimhvpsqjwv"
+L300: lea L275, *r5
+L301: .string "klg"
+clr L131
+L302: clr L210
+L303: inc *r6
+inc *r6
+add #-102, *r0
+red r2
+L304: jmp *r2
+
+L305: not L445
+inc L67
+L306: .data 870, 788, -165, 967, -611, 956, 758
+red L265
+L307: jmp *r0
+L308: add r0, r6
+not L575
+L309: clr *r1
+L310: cmp r5, #87
+jmp L158
+L311: sub r4, L199
+lea L253, *r5
+L312: stop
+L313: stop
+prn #100
+not *r5
+L314: add *r6, r3
+jmp *r1
+L315: .data 124, 635, -435, 751, -252, 657, -304
+L316: not L121
+mov L287, L295
+L317: .string "gzihkbfl"
+L318: .data -769, 78, 464, 432, 27, -48, 798, 869
+mov *r3, r7
+L319: inc *r4
+L320: .string "wqkonvjajrxazazpaqqmpxf"
+L321: mov r0, L480
+L322: not *r4
+add L381, *r1
+cmp #148, r0
+bne *r4
+jsr L87
+; comment
+rts
+L323: not L144
+rts
+lea L162, r5
+add #248, *r1
+L324: jmp *r2
+L325: red *r1
+bne L260
+; comment
+L326: bne *r7
+L327: cmp *r7, L410
+L328: not *r4
+prn *r1
+L329: red r2
+L330: bne *r7
+stop
+jmp L288
+L331: .string "dkafewrolqleb"
+inc *r6
+inc r7
+L332: dec *r3
+L333: not *r6
+L334: sub #140, L285
+L335: .data 665, 149, 84, 151, -514, 609, -212
+; comment
+stop
+L336: clr *r4
+
+sub #-201, L441
+L337: stop
+L338: mov r7, r1
+L339: inc r0
+mov L274, r7
+L340: .data 279, 818, -896, 253, 505
+L341: mov #-153, r4
+red L159
+L342: stop
+bne L48
+inc L173
+L343: .data 979, -543, 689, 835, 370, 665, 602
+sub *r6, *r1
+L344: red r4
+L345: dec *r6
+L346: dec r4
+L347: stop
+mov r4, *r4
+L348: lea L110, r2
+L349: mov #184, r4
+L350: not L229
+dec r3
+L351: dec *r7
+
+L352: not r0
+L353: jsr L244
+L354: stop
+L355: mov #-61, L266
+L356: dec r3
+L357: inc r6
+sub L105, *r7
+L358: add r2, *r4
+L359: .data 205, -340
+L360: .string "lkongpjoeigu"
+mov *r1, r7
+L361: dec *r4
+L362: red L556
+L363: dec L438
+lea L68, *r0
+L364: not r3
+L365: .data 953, 86
+L366: mov L405, r3
+dec L190
+clr *r1
+L367: cmp #-232, #107
+L368: lea L400, L165
+L369: cmp *r0, L387
+L370: .data -562, 880, -197, -766, -367, 438, -253, -339
+L371: .data -990, 615, -420
+red L449
+L372: .data -972, 471, -642, 552, 790, -951
+dec r0
+L373: jmp *r4
+L374: .string "uaicoaupflrqluq"
+L375: lea L168, *r3
+L376: lea L526, L400
+L377: stop
+L378: rts
+L379: stop
+L380: not L78
+L381: lea L422, *r5
+sub *r4, L442
+L382: inc *r5
+L383: .string "gnjrd"
+L384: stop
+L385: not r3
+L386: add #-93, r1
+prn #56
+L387: stop
+L388: lea L426, L367
+mov L475, L19
+L389: .data -474, 815, 230, -531, -723, -920, 8, -912
+sub *r5, r7
+; comment
+L390: lea L91, *r4
+L391: bne L544
+L392: sub #124, L182
+L393: dec r4
+sub r6, *r3
+L394: jsr L279
+L395: stop
+sub *r1, *r0
+not L436
+jmp L2
+
+cmp L500, r7
+L396: mov *r4, *r5
+; comment
+; comment
+not *r2
+L397: sub r0, L43
+L398: prn r1
+L399: red L519
+rts
+L400: bne *r4
+L401: add *r7, *r2
+add L532, *r5
+rts
+L402: add r7, r2
+L403: .string "gezelpufnycsuja"
+L404: clr *r7
+lea L421, L445
+L405: dec *r7
+L406: .string "cs"
+red *r0
+L407: .string "zq"
+L408: lea L234, *r1
+L409: red *r5
+L410: rts
+
+jmp *r1
+; comment
+not r1
+L411: stop
+red L529
+L412: dec *r1
+mov L40, L329
+stop
+L413: .data 482, -123
+stop
+L414: prn r3
+L415: dec r4
+L416: .string "dlhiwkctaa"
+; comment
+L417: lea L277, *r4
+bne L42
+L418: lea L287, L442
+L419: .data 598, 822, 938, 275, -683
+red *r3
+L420: inc r4
+L421: red *r1
+red L515
+L422: .data -636, 478, 362, 568
+L423: lea L341, L257
+bne L138
+L424: red L139
+add #-41, L4
+L425: .string "lcpdtszcraezdellzldx"
+L426: rts
+jmp L480
+L427: prn *r6
+L428: cmp r1, L508
+L429: .string "mdqgghxclbdpeddg"
+L430: mov L513, r1
+L431: rts
+L432: inc L55
+L433: rts
+add *r7, L29
+L434: bne *r7
+inc L369
+L435: stop
+L436: mov *r5, *r2
+L437: .data -932, -37, -395, -399, 614, 532, 346
+L438: cmp L274, *r2
+rts
+L439: stop
+add L475, r1
+not L67
+
+L440: cmp r5, #227
+lea L453, *r6
+L441: bne L169
+dec r2
+add #41, *r1
+L442: sub L572, L56
+L443: jmp *r4
+jsr *r3
+mov r3, *r7
+L444: bne L142
+; comment
+rts
+L445: not r7
+not L144
+red L550
+L446: .string "lhyrccsxlsvw"
+stop
+L447: bne *r6
+L448: stop
+add r2, r7
+jsr L310
+rts
+inc L453
+; comment
+L449: red r3
+L450: sub r0, L203
+; comment
+L451: not L356
+L452: sub *r7, L534
+red *r3
+add #-145, *r0
+L453: .string "cocfunlwleyoih"
+L454: jmp *r3
+dec *r3
+L455: cmp L21, L57
+L456: .string "besuuzuokizjq"
+L457: .data -604, 345, -167, 611, -991, -223
+L458: clr *r0
+jsr *r7
+L459: clr *r0
+; comment
+dec *r6
+prn L555
+lea L564, *r3
+L460: .data -789, -967, 222, -743, -732, -942
+prn #245
+L461: sub *r0, r2
+L462: sub #-143, L564
+L463: not *r5
+jmp L170
+prn #-7
+
+jmp L192
+L464: red L569
+L465: dec r2
+L466: .string "facfxqjkunbmzzsg"
+clr L570
+inc *r6
+mov r2, r2
+L467: dec *r2
+L468: lea L8, r3
+rts
+L469: cmp #175, *r7
+L470: rts
+jsr L510
+L471: bne L542
+L472: cmp *r3, L572
+dec r0
+L473: .string "tozojyc"
+L474: add *r1, r0
+L475: bne *r7
+bne L123
+L476: sub L199, L512
+L477: red *r2
+jsr L544
+stop
+L478: cmp L557, #-55
+L479: lea L222, L166
+L480: clr L243
+L481: jsr *r2
+
+L482: prn *r4
+clr *r2
+jsr L513
+prn #138
+L483: .data 4, -702, -269, -905, 909
+stop
+add L541, r6
+L484: .string "hyahmc"
+L485: mov r6, *r2
+prn *r2
+L486: jmp *r5
+L487: dec L240
+sub #241, L581
+L488: .data -18, -509, 605, 617
+L489: prn r2
+L490: .data -15, 180, -421, 351, 731, 293
+L491: prn #-140
+L492: .string "butwrzevboluvb"
+L493: .data -800, -918
+L494: jsr L229
+L495: lea L126, L209
+L496: .string "jnuyqcxlygkmtfquonwdbntq"
+rts
+L497: add r7, *r4
+L498: dec *r0
+mov r5, *r0
+L499: not r7
+stop
+add r1, r7
+L500: cmp *r1, L297
+L501: not L529
+mov L187, *r5
+L502: rts
+inc *r5
+L503: lea L175, *r1
+L504: lea L543, r4
+L505: sub L428, L543
+not L30
+jmp *r2
+red L289
+lea L550, L510
+L506: clr L272
+; comment
+L507: clr r3
+clr L383
+jsr *r0
+cmp *r7, *r0
+L508: .data 808, 710, 577, 190, -581, -610
+L509: mov r1, *r0
+L510: prn #-76
+L511: red r0
+stop
+L512: mov *r4, r1
+L513: bne *r4
+L514: bne *r5
+rts
+L515: .string "znxwopdeg"
+L516: add #-46, *r3
+inc L273
+rts
+L517: red L537
+L518: dec *r0
+not *r1
+L519: jsr L240
+L520: stop
+lea L434, *r2
+cmp *r3, L571
+L521: .string "klev"
+jmp L162
+L522: prn *r5
+lea L35, *r3
+red *r2
+jmp *r2
+L523: red *r5
+inc L108
+L524: sub #48, *r1
+L525: lea L540, r2
+L526: prn #-129
+L527: not L571
+; comment
+L528: not r1
+L529: .string "npxqymzygjbsuzbfvlwl"
+jsr *r3
+L530: dec *r1
+lea L433, *r5
+jsr L541
+clr L567
+L531: prn r0
+lea L358, *r4
+L532: mov r0, *r7
+L533: inc r7
+sub *r1, *r2
+L534: prn *r7
+jsr L251
+mov #-185, r5
+stop
+L535: bne *r4
+L536: .data 334, -955, 815, -120, -692, -946, -367, -495
+mov r3, *r4
+L537: stop
+L538: rts
+clr *r0
+L539: sub #82, *r5
+bne *r2
+L540: rts
+L541: .data -619, -771, -979, -103, 17, -723, 75, 456
+prn L276
+L542: prn L174
+L543: red L80
+red L523
+L544: .string "bmbwacjcoubtbwuiclhmhts"
+L545: jsr L148
+not *r2
+lea L569, *r6
+not *r7
+L546: bne *r7
+L547: red *r6
+L548: mov #-21, L495
+rts
+L549: cmp L558, #-244
+L550: bne *r4
+L551: .string "afcrznjobkxuim"
+
+prn #186
+red L201
+L552: sub L263, *r0
+L553: not *r2
+rts
+L554: cmp *r7, *r2
+clr r6
+inc *r1
+L555: rts
+dec r2
+L556: add r4, r3
+L557: stop
+; comment
+; comment
+not L157
+L558: dec r1
+L559: red L577
+L560: red L524
+L561: jsr L565
+jsr L555
+prn *r5
+L562: bne *r0
+jmp L324
+L563: .data 831, -4, 484, -249, -83, 160, -105
+lea L564, r1
+inc *r3
+L564: red r3
+L565: stop
+mov L567, L575
+L566: sub r7, L133
+L567: cmp L268, L466
+L568: .data 740
+stop
+L569: dec *r1
+L570: stop
+L571: rts
+L572: not *r1
+; comment
+L573: jsr L574
+L574: add r0, *r2
+L575: jmp *r5
+L576: mov #98, r1
+L577: mov *r6, L429
+L578: jmp L581
+L579: red r4
+L580: dec *r6
+L581: clr *r5
+L582: inc L21
+L583: not *r1
+not L584
+L584: lea L108, r5
+stop
@@ -0,0 +1,1040 @@
+; Generated by genCorpus --seed 26
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+red r4
+stop
+clr *r1
+L0: clr L0
+
+L1: jsr *r2
+L2: lea L0, r3
+L3: sub L1, L0
+stop
+L4: rts
+L5: dec L1
+add L446, *r4
+L6: bne L469
+L7: add r2, r0
+L8: .data 118, -301, 373, 525, -118, 444, 639
+L9: rts
+mov r5, L205
+not L6
+L10: .string "hnslzovcjsvfxidbb"
+L11: lea L425, r4
+rts
+lea L3, L35
+cmp L4, *r3
+dec *r3
+L12: mov #-15, L1
+L13: dec *r7
+L14: bne *r3
+not r3
+dec r6
+L15: dec r2
+mov *r5, *r4
+L16: clr L13
+L17: not *r3
+rts
+; comment
+L18: mov r3, *r5
+mov #60, L7
+add r6, *r0
+add #-212, r0
+L19: stop
+L20: not r5
+L21: sub #64, L552
+L22: prn r7
+L23: rts
+L24: bne L240
+L25: jmp *r6
+red *r2
+lea L380, r6
+L26: dec L411
+
+L27: clr L16
+; comment
+L28: jsr L331
+L29: jsr *r2
+L30: .data -167, -782, 3, -423
+L31: sub r2, r0
+jsr *r6
+
+L32: rts
+L33: clr r7
+L34: .string "rbrwxcuptqjzhkg"
+L35: inc L20
+L36: not L80
+L37: inc *r2
+L38: .string "avkwb"
+L39: red r4
+L40: add #-50, L487
+mov L6, L11
+prn r0
+L41: red r1
+; comment
+L42: stop
+prn r7
+prn #226
+L43: clr L133
+L44: clr r4
+L45: .string "qtpomvhuesmprpzqccxb"
+L46: bne *r5
+L47: jmp L39
+L48: cmp r3, L332
+L49: clr r7
+L50: bne *r6
+L51: rts
+clr L12
+red *r1
+L52: bne *r5
+L53: prn r6
+L54: sub *r2, L32
+L55: inc L347
+L56: dec r3
+L57: stop
+L58: bne L342
+jmp *r1
+bne *r2
+L59: jsr *r7
+L60: stop
+L61: clr r7
+L62: cmp r5, r4
+dec L0
+L63: mov r4, L352
+L64: .string "uvdtcynipdmq"
+L65: sub *r7, L539
+rts
+clr L64
+lea L32, r5
+L66: clr *r1
+add *r3, L482
+L67: cmp L146, #10
+stop
+clr L11
+L68: red L421
+dec *r0
+L69: dec r3
+L70: jsr *r5
+cmp #-208, L357
+L71: cmp L70, *r6
+L72: .string "pdqiuuqfliilsamlvkjwnr"
+sub L402, r5
+inc r4
+L73: red r2
+inc *r3
+add L335, L177
+L74: .data -427
+L75: lea L535, r6
+L76: jsr *r2
+jmp *r2
+cmp *r1, #-224
+L77: mov #236, r0
+L78: jsr *r2
+lea L8, r4
+L79: rts
+L80: jsr L39
+L81: sub *r4, r0
+L82: jmp *r6
+L83: lea L344, r2
+L84: .string "nnnjjtcutfbbodmyicu"
+L85: not L255
+L86: add L194, *r5
+rts
+L87: .data 339, 644, 961, 113
+L88: add r3, L84
+L89: lea L560, r5
+L90: .data -75, -188, 931, -889
+L91: stop
+L92: add L477, r6
+L93: not L18
+L94: .data -853, 304
+L95: bne L8
+add #116, L25
+
+L96: clr *r5
+L97: mov #88, r0
+L98: not r5
+mov #153, r4
+L99: stop
+L100: jsr *r1
+add r4, r0
+mov *r1, r6
+L101: bne L120
+L102: .string "blfjtfriaiup"
+L103: dec r2
+L104: cmp L454, r7
+L105: dec L257
+; comment
+L106: not r2
+L107: lea L75, L45
+cmp *r3, L50
+not *r0
+rts
+L108: rts
+lea L4, *r0
+L109: red r1
+jsr L409
+red *r7
+red r4
+L110: dec r6
+L111: red *r4
+; comment
+jmp L47
+rts
+L112: jsr *r0
+L113: prn #-101
+mov r6, r4
+inc *r1
+L114: bne L14
+L115: dec L69
+mov #-115, *r5
+L116: clr *r0
+L117: inc *r7
+sub *r7, L175
+L118: jmp *r0
+L119: jmp L477
+L120: red r5
+
+L121: not *r7
+jsr L75
+not L124
+L122: stop
+L123: sub L362, L5
+L124: .string "xuvsswulkqlwjqqptbzffzz"
+inc *r6
+L125: bne L253
+add r5, r4
+L126: lea L116, *r0
+clr r3
+lea L343, r6
+L127: dec L467
+L128: inc r6
+L129: not L346
+L130: stop
+lea L580, L40
+jmp *r3
+
+mov #-58, L83
+mov r3, *r7
+stop
+dec r5
+L131: jmp L115
+L132: jmp L2
+L133: mov *r6, *r5
+L134: .string "qcxakqniffhphy"
+L135: stop
+L136: jsr L24
+jsr L208
+L137: .data -629
+add L433, r6
+L138: sub r4, *r1
+L139: clr *r3
+L140: bne L85
+L141: .data -200, -145, 14, -442
+red *r2
+L142: red L346
+L143: .string "etjxkqyidcaaalrj"
+L144: dec *r0
+L145: cmp *r4, #-181
+red *r4
+L146: dec L32
+inc L37
+jsr *r5
+L147: not *r0
+L148: rts
+; comment
+L149: bne L50
+L150: inc r6
+stop
+L151: bne *r1
+L152: cmp *r7, #53
+cmp *r0, *r5
+L153: inc *r0
+L154: mov #-23, r7
+stop
+L155: sub r2, r1
+prn r7
+mov L116, L44
+
+
+jmp L138
+bne L43
+L156: red L461
+L157: bne *r0
+lea L48, *r2
+L158: prn #110
+L159: .string "qpmkgfnppzioao"
+L160: clr r7
+L161: .data 821, -19, 414, -913, -736
+L162: dec L74
+add *r4, *r0
+L163: .data 736, -187, -119, 934, -719
+L164: mov #59, r3
+L165: mov *r5, L341
+stop
+
+L166: jmp *r3
+inc r5
+L167: jmp L266
+L168: bne L198
+L169: .string "yftmhicwtcz"
+rts
+L170: rts
+
+mov r0, L325
+L171: stop
+prn *r7
+L172: cmp r3, r7
+L173: not L38
+sub r5, L109
+not L535
+clr L418
+L174: jsr L32
+dec L398
+L175: mov L493, L24
+L176: red *r4
+L177: prn r6
+L178: bne *r3
+L179: .string "umtlnzxzkd"
+L180: dec r4
+L181: .string "tipggdnmryleji"
+cmp #-70, r2
+L182: .data -391, -264, -845, -621, 772
+L183: sub r4, L345
+L184: clr L318
+L185: .string "vqwvdjvxeqlfsr"
+mov L198, r4
+
+mov L38, *r0
+stop
+L186: .string "rbiqqnuuy"
+L187: dec *r2
+L188: mov r3, *r6
+inc L122
+L189: dec L153
+jmp *r4
+L190: stop
+mov #43, *r6
+bne L56
+L191: red r6
+not *r3
+stop
+L192: bne *r3
+L193: jmp L263
+L194: lea L315, *r4
+L195: stop
+L196: jsr L61
+L197: jsr *r4
+L198: lea L309, r1
+red L333
+L199: prn *r4
+L200: not r6
+L201: not r1
+L202: lea L44, L421
+L203: red *r4
+L204: not L444
+L205: add #-214, L423
+mov r0, r6
+jmp *r2
+L206: bne L216
+mov L188, r2
+lea L175, *r3
+L207: add *r1, L62
+cmp *r5, *r2
+L208: jsr L467
+bne L230
+rts
+L209: dec *r4
+L210: .string "uvnmodtz"
+add L108, *r0
+bne L88
+L211: .string "ftimitbfow"
+lea L513, L201
+L212: stop
+L213: not *r5
+L214: mov r4, L92
+L215: jmp *r6
+L216: mov L389, L210
+add #-67, r7
+cmp L502, L101
+L217: not r5
+prn L121
+L218: inc L133
+L219: jmp L430
+L220: cmp #-73, r2
+L221: mov #75, L593
+L222: .string "olpfmxm"
+L223: jsr *r4
+L224: bne L106
+L225: .string "iviyyokhzysdvwj"
+jmp L102
+clr L36
+stop
+dec L36
+L226: mov L255, r3
+L227: jmp *r1
+cmp #107, *r5
+L228: lea L237, r3
+inc *r3
+L229: stop
+L230: .string "etzhmjhrcnyplnnqhdqqou"
+L231: jsr L16
+cmp *r6, *r1
+L232: add *r2, r5
+rts
+L233: sub L138, r2
+L234: bne *r6
+clr r4
+bne L116
+L235: red *r4
+stop
+L236: mov #60, L116
+jsr L167
+lea L467, L220
+L237: .data -512, 704, 385, 45
+
+L238: rts
+L239: bne L121
+L240: dec L197
+L241: clr L285
+L242: lea L4, r2
+L243: sub *r3, L179
+jmp L271
+L244: not L408
+L245: red r5
+L246: prn *r0
+inc L589
+L247: .string "zzvmtpsmsgyojpllcplimza"
+L248: .string "gkehlptkimbbf"
+L249: .data 717, 280, 614, 349, 32, -410
+L250: dec *r5
+L251: lea L43, L306
+inc L58
+not L514
+L252: sub *r5, *r2
+L253: prn *r5
+L254: clr L525
+L255: clr L529
+L256: rts
+L257: inc r6
+L258: inc *r2
+L259: jsr L102
+L260: .data 381, 282, -545, -842, -155
+L261: red r4
+jsr L233
+L262: stop
+lea L31, L319
+L263: .string "uigcqcvxfkaraymjg"
+jmp *r7
+L264: rts
+L265: .data 655, 646, 425
+L266: cmp *r1, r3
+bne L13
+L267: add r1, L109
+L268: clr *r3
+; comment
+L269: not *r4
+clr r5
+L270: .data 639, -672, -443, 206, -341
+L271: dec r0
+L272: red *r1
+L273: prn #-254
+L274: jmp L195
+inc *r7
+L275: add L464, r3
+L276: lea L447, L167
+inc L105
+L277: dec L541
+L278: jsr *r5
+clr *r1
+mov #50, *r2
+prn L16
+L279: cmp r7, L162
+L280: add #245, L325
+L281: red r3
+L282: stop
+lea L249, r1
+L283: red r6
+jmp L44
+L284: prn L268
+L285: inc L31
+rts
+L286: inc r5
+dec r1
+stop
+L287: not *r3
+L288: .string "ugqvxfhhcft"
+L289: add L183, *r7
+L290: .data -59, 794, -547, 784, -976, -56, 99, 667
+rts
+L291: sub #173, L58
+L292: add #176, r7
+L293: rts
+L294: .string "syysztoxew"
+cmp L478, L347
+inc *r6
+jmp *r2
+L295: jsr *r2
+L296: not *r2
+L297: red r7
+L298: add #135, *r7
+L299: lea L298, *r1
+mov r4, r3
+bne L343
+L300: rts
+L301: red r7
+jsr L264
+L302: clr r5
+L303: prn *r3
+L304: jmp *r7
+mov #-174, *r5
+L305: red r4
+prn r0
+L306: prn #238
+bne L31
+L307: rts
+L308: sub *r6, r4
+not r4
+L309: jsr *r7
+L310: bne L158
+clr r3
+inc r0
+L311: add #-111, *r3
+L312: lea L340, L352
+L313: .data 707, -281, 552, 676, 606, -702
+L314: not *r4
+prn L161
+sub *r6, r7
+L315: .string "x"
+red *r5
+L316: .string "vwhmlwopnok"
+L317: inc *r2
+L318: jmp *r2
+jsr L180
+jsr *r0
+prn #235
+L319: clr r6
+L320: mov #236, r1
+L321: stop
+L322: sub L223, *r3
+stop
+prn L556
+L323: mov #34, r1
+jmp *r4
+L324: dec r7
+L325: clr *r6
+L326: .data -194
+; comment
+L327: .string "a"
+L328: prn r7
+add L353, L436
+L329: not L280
+L330: sub r1, L332
+cmp *r6, L367
+clr r7
+L331: lea L54, L563
+L332: mov L184, *r4
+L333: mov #43, L388
+L334: sub #15, L167
+add L59, *r0
+jsr *r7
+rts
+L335: inc L403
+L336: add *r7, L435
+not L353
+bne L429
+L337: add L590, L211
+L338: inc L192
+prn L114
+mov #7, r6
+jsr *r3
+L339: inc L233
+L340: jmp *r0
+L341: .string "dvlpfqdypftvnvpmx"
+L342: bne *r7
+cmp r3, *r3
+lea L348, L474
+not *r6
+rts
+L343: mov L505, r6
+sub r0, L132
+L344: inc r3
+stop
+L345: rts
+L346: lea L153, L121
+clr *r3
+L347: not L249
+L348: mov r6, *r6
+L349: dec r0
+L350: rts
+cmp #84, *r4
+L351: mov r2, r1
+L352: mov L151, L264
+stop
+L353: mov r0, r3
+bne *r5
+; comment
+; comment
+L354: prn L17
+lea L435, r5
+clr r2
+cmp L327, *r2
+L355: not r3
+L356: jsr *r7
+L357: prn L489
+
+L358: inc L284
+L359: .string "wuxqv"
+L360: .data -703, 88, 132, -691, 44, 724, -495
+L361: stop
+stop
+bne *r4
+L362: inc *r5
+clr r1
+L363: stop
+L364: rts
+jmp *r4
+bne *r7
+L365: prn *r5
+L366: stop
+L367: red *r6
+L368: jsr *r3
+jmp L513
+L369: rts
+add r0, *r6
+jmp *r5
+L370: .string "qhibnvspurbpsxuiszcwx"
+inc *r6
+cmp *r0, #136
+rts
+sub *r6, r7
+clr *r3
+L371: jmp *r0
+cmp L256, *r5
+; comment
+L372: sub r7, r5
+L373: stop
+L374: sub #-70, r0
+L375: cmp r5, *r2
+L376: not L358
+not L367
+rts
+L377: prn L396
+L378: inc L528
+sub *r4, *r3
+L379: .data 435, 27
+L380: jmp *r4
+L381: bne *r6
+prn #29
+L382: .string "cvextm"
+rts
+L383: dec *r5
+L384: inc *r4
+mov r3, *r0
+L385: dec L393
+not r3
+L386: .string "fsnycnqyiregxiehvklc"
+L387: .data -841, -937, -758, -558
+L388: .data 540, -455, 933, -777, -534
+L389: add *r1, r4
+L390: cmp r1, *r4
+L391: prn #159
+
+L392: jsr *r0
+not r2
+L393: add #-186, L9
+L394: dec *r4
+not L381
+cmp L417, *r1
+; comment
+L395: .string "al"
+L396: inc L31
+L397: prn L442
+L398: bne *r6
+L399: not L196
+L400: cmp L504, L42
+rts
+L401: inc L271
+rts
+L402: stop
+mov L125, r6
+L403: cmp #-126, L227
+add r5, r1
+L404: prn #200
+L405: .data -776
+L406: add r7, r6
+L407: red *r6
+L408: inc *r2
+L409: mov #60, L506
+L410: cmp *r4, *r0
+dec L221
+L411: inc *r7
+bne *r3
+red L460
+L412: clr r1
+; comment
+L413: inc *r4
+L414: sub L36, L15
+jsr *r7
+L415: mov L451, L231
+; comment
+L416: prn L410
+L417: not L273
+rts
+L418: jmp *r6
+lea L592, L482
+bne *r7
+sub *r7, L55
+red r7
+not L49
+L419: bne *r6
+L420: stop
+L421: cmp *r1, r4
+L422: jmp *r3
+
+L423: not *r0
+add *r1, r6
+L424: inc L527
+L425: rts
+not r6
+L426: inc *r6
+bne *r6
+L427: red L430
+rts
+L428: sub *r5, L555
+L429: jmp *r6
+jmp *r2
+L430: jmp L223
+clr *r5
+L431: not L386
+L432: add #-87, r5
+L433: jmp L226
+L434: lea L549, *r3
+L435: rts
+L436: cmp L483, L456
+sub *r5, r7
+add *r6, r6
+L437: clr *r1
+L438: add *r4, r4
+L439: red *r0
+rts
+cmp *r4, *r6
+add #9, r1
+L440: dec L576
+prn L580
+L441: jsr *r2
+L442: red r1
+stop
+L443: jsr *r1
+L444: rts
+L445: .data 880, -899, -434
+jmp *r1
+L446: bne L148
+clr r5
+L447: add L493, *r3
+not L0
+add r3, *r1
+L448: jsr *r3
+L449: red *r0
+L450: sub L563, *r6
+L451: red L511
+prn *r7
+red *r0
+; comment
+lea L467, L452
+L452: .data -417, -516, 579, -764, -543, 788, -899, -442
+; comment
+dec *r5
+L453: .string "eacmkirtunvzdkbq"
+L454: .string "wglhck"
+L455: dec r6
+L456: .string "nr"
+L457: sub #-213, L482
+clr r7
+sub r5, *r3
+rts
+L458: bne L189
+L459: lea L488, *r0
+L460: .data 21, 566
+; comment
+lea L552, r1
+red *r6
+L461: lea L15, *r2
+; comment
+L462: .data -394, 908, -770, 170, 578, -633
+jmp L583
+L463: cmp r1, #-168
+L464: sub #-51, r4
+L465: prn #134
+L466: clr *r5
+rts
+dec r2
+L467: inc r2
+L468: .data -142, -606, 960, -327
+L469: not L498
+L470: cmp #140, #-156
+L471: prn *r5
+L472: stop
+L473: red r3
+not r3
+L474: add *r5, *r3
+L475: stop
+L476: not L581
+L477: .string "fniqn"
+L478: jmp *r1
+rts
+
+add *r0, *r4
+sub #-51, L213
+L479: jmp L501
+L480: inc r2
+bne *r2
+; comment
+L481: cmp #128, #106
+L482: prn r4
+L483: prn #-143
+clr L573
+L484: sub #-239, r5
+mov L531, *r1
+L485: .data 228, 631, 227, 978
+jsr L4
+jsr L545
+L486: bne *r7
+cmp *r4, L532
+L487: clr r6
+L488: rts
+L489: mov r5, r5
+L490: .data 92, -854, 95
+bne *r0
+L491: .string "znk"
+; comment
+mov *r3, r2
+clr L590
+L492: add #32, r0
+sub *r5, *r2
+L493: lea L537, L511
+; comment
+cmp #-198, r1
+
+L494: prn #126
+bne *r7
+add L530, *r3
+L495: jmp L246
+L496: mov *r1, *r3
+L497: prn L514
+dec r3
+L498: rts
+cmp L575, r4
+L499: clr r3
+L500: .data 371, -953, 703, -667
+L501: cmp L545, *r4
+
+L502: sub *r0, r0
+cmp r2, *r0
+
+dec L592
+L503: sub r0, r4
+; comment
+L504: lea L565, *r2
+
+add r7, r1
+L505: not r2
+L506: cmp #-256, #225
+L507: red L8
+sub *r7, *r7
+L508: prn r5
+inc *r7
+bne *r4
+stop
+prn *r6
+
+cmp *r5, L369
+lea L48, r7
+L509: jsr *r7
+L510: sub #-222, *r1
+clr L538
+prn *r0
+prn r3
+; comment
+mov #-165, L257
+L511: .string "jxiqywbatuntmhocsycc"
+L512: dec *r4
+L513: bne *r7
+L514: sub *r4, r7
+inc L478
+L515: not L103
+L516: cmp #-202, *r5
+L517: jsr L334
+; comment
+rts
+not r7
+L518: cmp *r1, L317
+not L352
+clr L534
+L519: jsr *r1
+lea L111, *r4
+; comment
+; comment
+L520: stop
+L521: jmp L67
+
+L522: stop
+L523: jmp L568
+cmp *r3, *r3
+L524: mov *r4, L559
+L525: inc L314
+L526: .data -260, 207, -174, 600, 879
+cmp *r3, *r3
+bne *r6
+L527: mov #181, *r4
+L528: not L542
+red *r0
+L529: dec L340
+inc *r5
+L530: lea L585, L71
+inc *r4
+L531: add #-222, r0
+L532: rts
+red r5
+L533: inc *r1
+L534: jmp *r7
+L535: lea L124, *r2
+L536: lea L168, *r1
+add *r5, *r4
+mov #27, L182
+L537: jsr L577
+L538: dec L535
+L539: red *r5
+mov #-188, L205
+L540: bne L274
+
+L541: jmp L454
+L542: jsr *r6
+L543: rts
+L544: stop
+L545: add L556, r6
+stop
+inc *r4
+L546: cmp L561, L550
+L547: rts
+L548: jsr *r5
+L549: sub r7, *r6
+L550: prn *r7
+L551: jmp *r4
+red *r2
+L552: rts
+sub #4, L372
+L553: lea L580, *r2
+L554: bne *r2
+L555: jsr L485
+L556: add L27, r3
+lea L381, r5
+L557: .data -413, -122, 302, 564
+L558: jmp L579
+stop
+mov #-235, L123
+lea L583, r7
+L559: clr r6
+stop
+jmp *r4
+L560: .string "ihpcvhqaygvloa"
+prn r0
+L561: mov L117, r1
+L562: mov L572, *r6
+L563: jsr *r0
+stop
+lea L570, *r5
+lea L361, *r6
+prn r2
+L564: cmp *r0, #133
+L565: lea L231, L58
+jsr L115
+clr *r3
+add *r6, r7
+L566: clr L592
+
+L567: lea L365, L587
+sub *r6, L251
+sub *r1, *r7
+L568: stop
+cmp *r7, L54
+L569: jsr *r2
+L570: clr L594
+L571: add #185, L590
+stop
+dec r3
+mov L586, r6
+L572: rts
+L573: dec L454
+L574: .string "uunvpphwjrgjmc"
+L575: mov L139, r4
+L576: jmp L594
+sub *r3, L509
+L577: lea L399, r3
+L578: dec *r3
+red *r7
+L579: lea L585, L136
+cmp L287, *r5
+bne *r4
+L580: bne *r5
+L581: rts
+L582: .data 627, -275, 338, -201, 403, -381, 586
+; comment
+cmp *r2, L162
+sub *r6, r1
+L583: mov L415, *r6
+stop
+L584: not r1
+not *r0
+jsr *r2
+jsr *r3
+L585: inc L534
+sub *r1, r5
+L586: .string "zzftgiq"
+L587: rts
+L588: dec L589
+L589: add L592, r5
+L590: jsr *r5
+L591: .string "cqrqrpy"
+L592: inc L443
+
+L593: add #-46, *r7
+jmp L570
+L594: dec r6
+stop
@@ -0,0 +1,1041 @@
+; Generated by genCorpus --seed 27
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+not r0
+L0: .string "b"
+L1: bne *r5
+red *r2
+L2: clr *r1
+add *r2, *r0
+L3: jsr L254
+add L3, L3
+add *r3, r4
+L4: add r5, *r7
+L5: .string "isxnqs"
+sub L263, *r4
+cmp #-85, L5
+L6: .data 305, -158
+dec L0
+L7: prn *r6
+L8: red r2
+L9: bne L66
+L10: jmp *r2
+L11: jmp L8
+jmp L0
+L12: add r6, L318
+L13: bne L377
+L14: .string "kgqpnrpuzbxgeb"
+lea L2, r4
+inc *r3
+prn #-249
+
+L15: bne L12
+L16: .string "mudqttxz"
+sub r2, *r6
+L17: red L364
+L18: rts
+L19: red r0
+jsr L19
+clr r5
+; comment
+cmp #-252, L580
+L20: jmp L341
+stop
+L21: rts
+sub *r3, r3
+L22: jmp *r4
+L23: inc r2
+rts
+red L22
+bne L144
+L24: .data 963, -948
+L25: clr r7
+L26: mov #7, L559
+L27: clr r2
+stop
+rts
+L28: jsr *r5
+bne *r2
+L29: .data -123, 421
+jsr *r5
+L30: sub L161, *r6
+red *r6
+L31: .data -324, 721, -712, -11, 782, -78, -270
+L32: sub L21, r0
+inc r1
+L33: lea L197, L51
+L34: dec *r1
+L35: jmp *r2
+L36: clr L13
+L37: .data 758, 263, 511, -656, 230, -604, 542
+L38: stop
+L39: lea L1, r5
+sub L7, *r0
+lea L38, r6
+dec L38
+L40: sub L277, L333
+L41: .string "xdmwdsducdxubau"
+L42: lea L2, r2
+L43: inc *r2
+jmp *r5
+clr *r7
+L44: jmp L144
+L45: mov r1, r1
+jmp L232
+L46: rts
+bne L30
+stop
+L47: lea L165, *r4
+L48: mov L19, r6
+bne *r6
+
+L49: .string "ygzrngxupusqjlsxttnihsq"
+stop
+cmp *r5, #-59
+L50: .data -378, -667, 342, 938, -119, -467
+L51: rts
+L52: sub L502, L0
+L53: dec *r4
+dec L45
+L54: clr L277
+L55: bne L264
+L56: .data 345, 286, 729, -422, -696, -538, 299
+L57: stop
+L58: cmp r4, r5
+L59: bne L193
+L60: prn #216
+dec L58
+
+L61: jmp L40
+L62: not r1
+L63: lea L517, *r4
+L64: red *r4
+L65: clr L21
+prn #-177
+L66: .data -876, -605, 682, 188, -244
+sub r0, *r4
+L67: jmp *r1
+L68: jsr L40
+dec r6
+jsr *r1
+L69: cmp r7, L41
+L70: inc *r5
+L71: bne L232
+L72: cmp *r6, *r5
+red r1
+mov #216, L170
+L73: inc *r6
+
+not L58
+L74: lea L292, r6
+L75: prn #190
+L76: .data -644, -325, -78, -314, 641, 352, 166
+L77: lea L31, r1
+L78: .string "ktddcri"
+L79: sub #-136, r7
+sub #-209, L17
+L80: add #37, *r7
+cmp L289, #-42
+jmp L72
+red L163
+not L423
+L81: jsr L174
+L82: .data -730, 883, 677, 570, 244
+L83: red *r5
+L84: .data -916, 9, 791, 711, -318, 412
+L85: jsr *r4
+L86: not L305
+L87: clr *r1
+L88: jmp *r0
+sub #-208, *r4
+add #-9, *r5
+L89: bne L609
+L90: bne L212
+jsr *r2
+L91: jmp *r3
+stop
+L92: mov L13, L250
+L93: lea L64, r5
+L94: dec L3
+add r6, *r1
+L95: .string "exdsoyiqs"
+L96: stop
+jmp *r7
+
+L97: jsr *r6
+L98: inc r0
+cmp L389, *r2
+L99: red *r2
+L100: dec L551
+L101: mov #174, r1
+L102: add L376, *r1
+stop
+L103: bne L331
+L104: jsr *r1
+L105: .data -305, -318
+L106: .string "kucwgoyqlo"
+L107: mov r0, r2
+L108: jsr L546
+L109: stop
+cmp r5, r5
+L110: jsr L73
+L111: bne *r7
+L112: rts
+L113: rts
+dec L418
+L114: .string "fdpvrhdxeebjjpny"
+L115: clr *r6
+inc *r7
+clr L72
+rts
+L116: rts
+L117: mov #-48, L22
+L118: prn #-232
+lea L164, *r7
+L119: bne *r2
+clr L30
+dec L32
+not *r7
+L120: red r7
+L121: lea L32, r0
+jmp *r0
+L122: cmp L221, r6
+red r0
+L123: not *r7
+bne *r1
+L124: add L66, *r2
+mov #-84, L72
+L125: sub L430, L458
+L126: sub *r6, *r7
+L127: dec r5
+L128: sub *r2, *r2
+L129: bne L93
+inc L554
+L130: mov L260, L59
+L131: .data -947
+L132: prn r6
+L133: add L103, r6
+L134: lea L89, L81
+lea L484, r3
+cmp L539, r5
+stop
+L135: .data -311
+L136: red L4
+red L502
+bne L117
+add L231, *r0
+sub L79, r5
+lea L120, *r1
+jmp L25
+jsr L378
+L137: rts
+L138: dec *r2
+L139: lea L607, L255
+L140: prn #152
+jmp L15
+; comment
+; comment
+jmp *r1
+; comment
+L141: .data 606, -6, 932, -187, -786, 865, -727
+L142: jsr *r4
+L143: dec L65
+; comment
+L144: jsr L116
+; comment
+L145: bne L601
+L146: clr *r3
+L147: rts
+L148: cmp #132, *r5
+L149: clr r4
+red r2
+L150: clr L128
+L151: jsr L41
+dec *r2
+L152: jsr *r4
+mov L167, L472
+L153: dec *r3
+lea L20, L166
+L154: jmp *r1
+stop
+L155: rts
+L156: sub r7, r2
+L157: .string "xm"
+L158: jmp L86
+
+L159: prn *r4
+inc *r0
+L160: red r2
+jmp L562
+L161: dec *r6
+red L67
+L162: jsr L19
+L163: cmp r5, #20
+L164: rts
+L165: rts
+dec *r5
+L166: clr *r1
+L167: cmp #141, #-150
+L168: rts
+L169: lea L579, r3
+red r3
+prn r5
+L170: jsr L349
+L171: prn #134
+L172: add *r2, r5
+L173: add L151, r7
+L174: .data -833, 380, -657, 20, 379
+L175: add L105, *r3
+inc L312
+stop
+L176: mov r4, r4
+L177: .data 488, 175, -242, 19, -399, 175, -426
+L178: .data -973, -627
+jmp *r6
+lea L32, r0
+
+bne *r2
+L179: mov #190, *r1
+L180: sub *r6, L423
+L181: mov *r7, r5
+L182: .data -834, -695, 939, -152, -35, 384
+; comment
+sub r7, r5
+bne L341
+red r7
+L183: lea L421, *r6
+L184: .data -659, 783, 78, 190, -285, 362, 897, -591
+L185: sub L453, r0
+L186: red *r4
+; comment
+L187: rts
+L188: bne *r5
+L189: red r5
+L190: .string "hqsysxngovwvxpaubninya"
+L191: stop
+L192: .string "dkxgesc"
+L193: clr L559
+jmp L5
+L194: stop
+L195: jsr L572
+L196: lea L172, *r7
+L197: stop
+L198: sub L266, *r3
+L199: bne L87
+lea L119, *r1
+L200: clr r7
+L201: add L107, *r7
+L202: dec r2
+L203: add *r5, L260
+L204: red *r0
+rts
+L205: rts
+L206: dec r1
+rts
+L207: bne L45
+L208: not *r5
+bne *r5
+L209: prn L204
+L210: .data -968, 701, -397, -109, -763, 587, 706, -211
+
+L211: lea L169, *r0
+L212: bne L245
+inc *r6
+L213: add *r0, *r3
+cmp #222, #195
+clr L501
+jsr *r2
+add #-204, *r6
+L214: jmp *r7
+L215: rts
+jsr L490
+sub L72, r3
+clr L3
+L216: jsr *r5
+stop
+add *r7, r7
+L217: .data 356, -616, -534, -355, 954, 841, -527
+jmp L117
+L218: .string "sjhshvfbxx"
+L219: add r7, r6
+L220: stop
+red r2
+stop
+L221: rts
+L222: prn L381
+L223: jsr L274
+lea L70, *r7
+L224: prn r2
+L225: .data 754, -648, -791, -666, 507
+L226: jmp *r2
+L227: jsr *r0
+stop
+L228: lea L481, r1
+L229: .string "yjhwipqnctr"
+; comment
+L230: cmp *r5, L287
+L231: lea L223, L278
+prn r3
+L232: prn #18
+bne *r7
+not L532
+inc r4
+L233: bne *r7
+L234: lea L26, r7
+L235: prn L305
+rts
+L236: add L539, r5
+L237: cmp r1, *r1
+L238: prn L461
+L239: cmp L66, #-145
+L240: cmp #196, r3
+L241: jsr *r3
+prn *r1
+dec L48
+bne *r7
+L242: stop
+clr L606
+L243: rts
+lea L176, *r0
+L244: lea L303, L44
+L245: .string "qhnnmjtwzmedq"
+jmp *r1
+L246: stop
+L247: mov r0, r0
+L248: .data -200
+L249: lea L64, r4
+L250: .string "tbheqihssgpskgujca"
+L251: clr r1
+L252: .data -649, 184, 733, 319, -887, -134, -901, -58
+L253: rts
+L254: stop
+prn *r5
+jmp L90
+L255: prn *r7
+L256: red *r4
+L257: .data 884, 405, 664
+L258: add r4, r1
+L259: clr L476
+add r1, *r0
+L260: prn L45
+L261: mov r1, *r1
+L262: prn #86
+not r4
+L263: clr L89
+L264: add L40, *r5
+inc L188
+clr r5
+L265: lea L177, r2
+L266: clr r4
+mov r2, *r0
+L267: lea L520, r4
+L268: .string "qqoey"
+cmp L533, L28
+
+L269: .string "tovakxdamgfvpijdpj"
+lea L301, *r5
+L270: not r0
+L271: .string "dhdscuevme"
+prn #250
+L272: jsr L407
+jsr *r0
+prn #130
+sub L398, L41
+; comment
+L273: bne *r3
+L274: .string "cnrxcqzbbaxjwplynmfrm"
+prn #-109
+lea L44, L90
+L275: dec *r2
+L276: .string "slyebrvgdcro"
+rts
+sub *r7, L322
+L277: inc L378
+L278: jsr *r1
+L279: inc r4
+
+L280: cmp r3, r0
+inc r4
+not *r5
+L281: clr *r0
+L282: dec *r7
+L283: bne *r4
+rts
+L284: clr *r6
+L285: clr r4
+
+L286: clr r1
+add L324, L604
+L287: .data -982, -311, -943
+L288: dec r0
+sub *r3, *r1
+L289: sub *r6, r7
+jsr L65
+L290: cmp r5, *r4
+bne L387
+L291: stop
+dec L606
+L292: .data -323, -241
+L293: dec r2
+L294: prn #-189
+bne *r5
+; comment
+mov r4, *r5
+L295: lea L30, *r0
+add L343, r0
+cmp #-99, r5
+dec L12
+L296: mov *r5, r5
+
+L297: bne *r2
+L298: stop
+L299: rts
+L300: inc r2
+L301: sub #76, *r5
+lea L471, r3
+L302: clr r2
+L303: stop
+rts
+L304: lea L170, *r1
+jsr L580
+L305: stop
+rts
+L306: jmp L436
+L307: bne L473
+L308: mov *r5, *r2
+lea L420, r3
+L309: stop
+; comment
+jsr *r0
+L310: sub r0, r2
+clr r0
+L311: jsr *r7
+jsr *r7
+L312: lea L221, L22
+; comment
+L313: inc *r1
+L314: mov L177, r5
+L315: clr r4
+L316: add *r4, r7
+L317: jsr *r4
+jmp *r7
+L318: jsr *r7
+L319: add #-11, L531
+clr *r6
+L320: dec r2
+
+L321: jsr *r5
+; comment
+L322: red r4
+L323: inc *r3
+L324: bne *r5
+L325: sub *r1, r2
+
+L326: bne *r6
+L327: rts
+L328: jmp L149
+L329: red *r5
+L330: mov *r4, L445
+L331: clr L335
+L332: sub L446, L256
+L333: jsr L60
+sub #-248, r7
+L334: red *r1
+red r7
+L335: stop
+L336: .data -537, -98
+prn L82
+dec *r1
+L337: cmp *r1, *r5
+L338: sub #208, L39
+L339: .string "qdotmupvjklxyaivudechh"
+dec *r3
+L340: cmp *r1, r6
+L341: rts
+L342: bne *r6
+L343: clr *r2
+bne *r2
+L344: sub #-253, L507
+L345: .string "vblljarncatlmtb"
+L346: stop
+L347: .data 176
+L348: jmp *r4
+
+L349: lea L163, r2
+L350: .data -241, 676
+inc *r4
+
+jmp *r5
+L351: red r0
+L352: .string "bvmkvzlzlvjncupgov"
+
+stop
+L353: red L561
+L354: mov L465, r5
+L355: bne L488
+L356: stop
+bne *r1
+L357: jsr L187
+inc *r1
+jmp L358
+clr L610
+L358: prn L134
+L359: cmp #-237, #18
+add L2, *r6
+L360: jmp *r2
+L361: add L59, L355
+L362: lea L535, *r5
+bne *r0
+L363: dec *r1
+L364: .string "u"
+L365: not *r7
+jsr *r2
+cmp *r3, #126
+L366: inc r0
+L367: .string "jcybvydgzainxyrha"
+add r4, *r4
+dec *r1
+lea L299, L103
+L368: red r3
+L369: jmp L566
+prn L545
+L370: inc *r4
+L371: add L166, *r1
+L372: not r4
+L373: rts
+L374: clr r5
+L375: rts
+lea L270, *r2
+L376: jmp L129
+L377: dec L137
+L378: sub #136, r4
+rts
+cmp #-123, #165
+L379: not r5
+L380: bne *r4
+L381: cmp r7, *r0
+L382: .data 83, 818, 948, 920
+mov #74, r4
+L383: red r0
+cmp *r2, r4
+not *r7
+prn L47
+L384: bne L500
+dec L265
+L385: mov #-22, *r2
+L386: .data -598, -31, -268, 314, 520
+mov r7, *r1
+L387: .data 768, -121, 528
+clr r2
+L388: mov #-68, r2
+dec *r5
+L389: sub #152, r0
+add r1, *r0
+L390: not *r3
+add r3, L292
+L391: .string "mrtzqjscrhwwgxjxwsdkmus"
+add L271, r1
+L392: not L168
+L393: inc L566
+jmp L398
+jsr *r3
+L394: jsr *r2
+L395: bne *r7
+jmp L448
+dec L14
+not *r3
+L396: inc r2
+L397: jmp *r4
+
+sub #-128, r6
+L398: .data -625, -347, 97, 372, -828, -347, 478
+L399: .string "lodkclxzspiwrrbi"
+L400: cmp #141, #189
+
+
+not L63
+jmp L558
+L401: inc *r4
+cmp *r5, *r3
+L402: bne L194
+stop
+L403: jmp *r4
+add r4, r2
+sub L255, *r6
+L404: cmp r4, *r2
+L405: stop
+jmp L602
+L406: rts
+L407: stop
+
+L408: prn r7
+L409: dec L525
+mov L596, *r6
+L410: .string "bpgervzgxtgllpvawpbyhhf"
+cmp L339, L587
+L411: add r0, *r7
+L412: cmp L162, L146
+L413: sub *r0, r7
+L414: rts
+sub *r7, *r7
+not r3
+L415: bne *r3
+L416: .string "xsozhtiaxspkrwqeawyersot"
+L417: red r7
+L418: stop
+clr r3
+prn *r2
+stop
+inc r6
+L419: red *r7
+L420: stop
+L421: jsr L116
+L422: .string "hyofztkdzabwspgyvcppinn"
+cmp #-253, L456
+L423: sub *r0, L494
+L424: red r6
+L425: .string "bjwihxzveccupzxxc"
+L426: cmp #81, #57
+L427: prn #-207
+L428: .data -243, 984, 555, -153, 347, 329, -651, -669
+L429: prn *r6
+; comment
+jmp L95
+L430: clr L205
+dec L444
+cmp #121, *r7
+L431: cmp r2, L22
+L432: red r5
+L433: .string "cpnsjzultkom"
+L434: jsr L23
+L435: cmp *r3, #-182
+rts
+
+
+clr L294
+L436: sub r0, L42
+L437: prn #17
+mov #185, r7
+L438: clr *r7
+inc *r0
+stop
+L439: lea L405, r1
+L440: stop
+L441: red *r3
+cmp #164, *r7
+bne L210
+L442: .data 495, -698
+sub *r1, r0
+L443: add L610, L233
+L444: red r4
+L445: not L596
+L446: .string "blatzsevwdypfj"
+L447: .data -148, -272, 442, 460
+; comment
+L448: add r1, *r3
+L449: .data 6, -66, -722, 252, -661
+bne *r7
+L450: jsr *r5
+red r4
+L451: cmp #-135, #242
+stop
+L452: bne L128
+L453: mov L505, r3
+sub #138, *r4
+jmp L562
+add L160, L520
+inc L610
+; comment
+L454: clr *r4
+L455: jmp L209
+L456: cmp *r3, r4
+rts
+jsr *r7
+L457: not L139
+jsr *r3
+L458: inc L563
+mov L307, r7
+L459: bne *r7
+L460: .data 843, -515, -662, -488, 892, 694, -940, 775
+clr L546
+L461: jmp *r4
+L462: rts
+L463: cmp #224, *r3
+L464: bne *r2
+rts
+L465: bne *r3
+bne L484
+L466: sub r7, L527
+; comment
+rts
+dec r4
+L467: not *r0
+L468: jsr L473
+cmp #-253, #96
+L469: lea L176, r0
+L470: sub L539, L153
+L471: mov r5, r0
+
+jmp *r5
+L472: .string "g"
+
+L473: add *r6, *r6
+L474: dec L63
+L475: mov #160, L1
+L476: not r1
+L477: mov L547, L439
+L478: prn #154
+L479: inc r6
+L480: prn r0
+mov r2, r5
+L481: rts
+L482: .string "zvwpntzyfpidb"
+L483: rts
+L484: sub r1, r6
+prn r1
+L485: .data -286, -399
+L486: mov #113, r4
+L487: mov *r0, L496
+L488: red r1
+clr L544
+L489: mov #-74, L610
+rts
+L490: inc r2
+L491: .string "qbbujfughky"
+L492: mov *r2, r1
+L493: add #182, L539
+bne *r2
+L494: dec L156
+L495: mov *r0, r6
+L496: stop
+; comment
+L497: inc *r4
+
+add r6, *r7
+L498: .string "hsuacifrbwupcam"
+L499: rts
+not r5
+L500: .data 477, 733, -293, 310, -155, -658, -736
+red *r5
+L501: .data -319
+inc L585
+L502: dec L166
+L503: stop
+L504: bne *r4
+lea L260, *r2
+L505: jsr *r5
+
+prn *r2
+jmp L513
+L506: rts
+inc *r2
+L507: red r6
+L508: red r3
+L509: bne *r7
+L510: inc L471
+L511: mov #183, r1
+L512: rts
+
+L513: jsr L539
+L514: jsr *r7
+inc L136
+L515: mov r7, L530
+jmp L546
+inc r5
+L516: lea L517, *r6
+L517: sub #22, *r1
+L518: jmp *r4
+clr r5
+L519: sub r5, *r6
+L520: cmp L72, r6
+L521: prn L249
+L522: mov r2, r4
+L523: jmp L599
+prn #-50
+
+jsr L589
+L524: stop
+L525: clr L109
+L526: clr *r0
+L527: add L379, r2
+L528: stop
+L529: not *r2
+not L130
+L530: lea L551, r5
+prn *r0
+L531: clr L68
+
+L532: rts
+inc r6
+L533: cmp r5, r5
+L534: dec r5
+L535: clr *r6
+L536: rts
+mov L217, *r1
+lea L603, L569
+L537: bne L423
+L538: inc *r6
+L539: dec r3
+rts
+L540: inc L281
+red *r2
+L541: .string "ogvrnsvcxievyixyamjygcx"
+L542: prn L301
+L543: red r3
+L544: bne *r3
+L545: .string "aqcbmgzjtdltxujbkta"
+L546: .data -443, -738, -345, -761, 463, 990, 163, 896
+dec *r4
+
+; comment
+L547: add *r1, r3
+inc L551
+L548: red r7
+L549: stop
+rts
+inc L503
+L550: lea L595, L499
+rts
+red L565
+; comment
+clr r0
+L551: rts
+sub #184, *r4
+L552: rts
+L553: .string "bttproaesttqaueorrbc"
+L554: .string "cfffnp"
+L555: add #225, L589
+L556: sub r1, *r0
+L557: lea L130, r7
+clr L387
+red r1
+L558: stop
+L559: clr r2
+L560: sub L595, r5
+L561: rts
+L562: bne L575
+L563: lea L565, L195
+
+L564: .string "wjiugwip"
+L565: lea L571, *r2
+cmp L298, r7
+not *r4
+L566: jsr L243
+cmp r1, L571
+; comment
+L567: stop
+L568: mov *r1, *r4
+inc r2
+mov *r5, r1
+mov L228, L590
+L569: lea L579, *r5
+L570: .string "akwqi"
+jsr *r6
+; comment
+red r4
+L571: mov r0, r0
+L572: dec *r3
+inc r2
+bne *r7
+L573: .string "cukhsabxynnmbpjnmreb"
+clr r7
+mov L577, r2
+L574: stop
+L575: add *r6, r5
+L576: dec *r1
+; comment
+L577: jmp L606
+L578: jmp L598
+L579: add #-149, L349
+prn #159
+sub L561, *r6
+L580: prn #-58
+mov #172, L587
+L581: .data -172, 52, 125, 350, 405, 867, 840
+
+sub *r4, r0
+L582: stop
+L583: .string "wkfmywkfhkhx"
+jmp L575
+L584: clr r2
+
+L585: .data -171, -388, -178
+mov L373, *r3
+stop
+red *r4
+rts
+jsr L93
+
+L586: clr *r5
+L587: stop
+L588: stop
+L589: sub *r6, r0
+L590: dec r2
+L591: .data -802, 246, 920, -35
+L592: lea L419, r4
+L593: jsr *r5
+mov r6, r2
+L594: not L598
+L595: lea L207, r2
+L596: .string "mqcubowzic"
+L597: rts
+sub *r2, r6
+mov *r4, *r4
+L598: .string "gfcjhuexcbnpjegncfajovl"
+sub #-242, L242
+L599: sub *r4, *r5
+L600: not L30
+clr r3
+jmp *r1
+L601: .string "jimlfxlkotpihsjhvngti"
+sub r2, r7
+L602: jsr L605
+L603: dec r0
+L604: lea L534, *r3
+
+mov r7, r2
+jmp *r2
+L605: not r2
+L606: dec r3
+L607: jmp *r1
+L608: rts
+L609: dec r3
+L610: mov L141, *r0
+stop
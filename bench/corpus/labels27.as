@@ -0,0 +1,1042 @@
+; Generated by genCorpus --seed 28
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+.entry L624
+L0: jsr *r2
+bne *r0
+; comment
+L1: lea L49, L0
+clr *r4
+L2: stop
+L3: sub L1, r4
+L4: inc r5
+jmp *r7
+red L18
+add *r2, r7
+jmp L193
+L5: not L572
+L6: cmp *r5, *r0
+L7: .data -52, 204, -83, -224, 921
+
+mov *r7, L200
+jmp L35
+L8: clr L6
+dec *r3
+
+L9: dec *r3
+inc r7
+L10: clr *r5
+L11: dec L380
+dec L311
+L12: jmp L7
+L13: inc L7
+L14: sub *r0, L3
+L15: add r2, r3
+L16: red L16
+L17: .data -463, -323, -835, -800
+L18: .data 668, -998, -232, -595, -109, -555, -890
+L19: sub #40, *r4
+L20: sub *r0, L4
+
+L21: dec r7
+L22: rts
+L23: sub L9, r4
+L24: mov L3, r1
+L25: sub L471, r2
+mov *r2, L186
+; comment
+L26: mov *r3, L162
+stop
+L27: not L1
+clr L575
+L28: add r7, *r5
+L29: sub #-157, *r3
+L30: inc L9
+L31: red L516
+L32: .data -44, -157, -325, -992
+lea L15, r0
+lea L11, *r3
+L33: inc r6
+L34: jsr L21
+L35: .data -664, 74, -854, 35, 139
+red r2
+
+rts
+L36: add r1, r7
+bne L32
+L37: not *r6
+sub #184, r3
+stop
+L38: .string "iyvqrra"
+L39: lea L382, *r3
+lea L23, r6
+L40: jmp *r7
+red L6
+L41: .string "sovcnhiafts"
+L42: mov *r1, r4
+L43: jmp *r5
+jsr L237
+L44: .data -179, 959, 620, -799
+; comment
+dec *r0
+L45: inc r0
+L46: dec *r0
+L47: dec *r1
+cmp *r0, #30
+L48: prn *r0
+not *r5
+
+L49: mov #-162, L537
+mov #-161, *r1
+L50: not *r6
+L51: prn *r3
+prn r4
+; comment
+L52: .data -528
+bne L364
+L53: red L24
+cmp L19, L147
+L54: add L424, L279
+L55: stop
+L56: .data 738, -234, 738, -727, 432
+L57: .string "vhpxqqqt"
+
+L58: .data 956, -408, -587
+L59: red *r3
+L60: add r3, r1
+L61: rts
+L62: .data -958, -249, -974, -130, 267, -705, 586, -736
+L63: bne L59
+L64: .data -168, 702, 117, 317
+L65: lea L128, L30
+L66: inc L163
+bne L65
+L67: clr L283
+L68: jmp L295
+L69: add #163, *r6
+stop
+cmp #134, L417
+not L177
+lea L32, *r0
+
+L70: mov *r4, L310
+L71: add L509, r1
+L72: cmp #-87, r4
+red r4
+L73: stop
+add *r2, r1
+L74: jsr *r7
+L75: inc L593
+L76: bne *r2
+sub *r4, *r5
+L77: red *r5
+L78: inc *r7
+prn r4
+L79: add #35, r6
+L80: .data -114, 863, -479, -428, 541, 577, -157, -608
+L81: mov r6, *r2
+L82: inc *r0
+clr L47
+L83: cmp *r4, L94
+L84: .data 561, 846
+red *r7
+bne L146
+sub r1, L26
+L85: .data -327
+L86: jsr L464
+L87: cmp *r5, r5
+prn r6
+cmp r4, L256
+add L24, L18
+L88: prn r7
+L89: sub r6, *r4
+L90: .data 34
+lea L24, L22
+L91: .data -67
+mov r3, L78
+bne L496
+L92: stop
+L93: add r4, r1
+L94: jmp *r5
+L95: .string "vfoxtjb"
+L96: lea L583, r5
+L97: jsr *r3
+add L22, *r2
+L98: red L6
+sub L520, L31
+stop
+L99: .string "okqldbcpqmtn"
+bne L237
+L100: add r7, *r3
+L101: jsr L587
+L102: bne *r4
+lea L51, L97
+jsr *r0
+cmp *r0, *r2
+jsr L82
+L103: dec *r7
+L104: .data -464, 862, -529, 737, 325, -633, 262, 395
+L105: lea L601, r4
+L106: rts
+prn r7
+L107: red r3
+L108: prn r6
+L109: inc *r6
+L110: jmp L345
+L111: stop
+jsr *r6
+prn L27
+add *r4, r7
+add *r6, L438
+L112: cmp L203, r0
+; comment
+rts
+L113: rts
+
+red r0
+prn L22
+L114: prn *r0
+L115: lea L289, *r2
+L116: red L430
+L117: .string "xhhdduwfjyyqgioszkisisl"
+L118: add #175, r4
+L119: clr *r1
+L120: prn r0
+bne L102
+L121: jmp *r3
+L122: red L550
+L123: .string "srxwuzveathwuulszttg"
+L124: dec L283
+jsr *r1
+L125: prn L468
+L126: .data -22, -641, -598
+L127: prn #-77
+L128: stop
+L129: mov *r0, *r4
+mov r0, L529
+L130: clr *r4
+bne L1
+clr L383
+not r7
+stop
+L131: prn r7
+L132: rts
+L133: mov #12, L110
+L134: .string "oxyhplplkqkzilcmqyakwm"
+L135: .data 847, -562, -933, 898
+L136: red L112
+L137: .string "abcjmngurtzlcvecdpvomhx"
+L138: mov r4, *r4
+L139: red r3
+L140: mov #84, L1
+L141: dec *r2
+L142: bne *r1
+mov r0, r4
+add #-61, r2
+L143: jsr L111
+mov L504, L80
+L144: bne L7
+L145: mov #-148, L9
+L146: inc *r2
+stop
+lea L22, r4
+
+L147: jsr L302
+red *r1
+L148: .string "kwoeliwzmhargioj"
+cmp *r1, L605
+
+L149: prn r5
+clr L227
+lea L380, r5
+dec *r4
+L150: red *r3
+clr r3
+L151: clr L32
+mov *r1, L613
+rts
+L152: prn #106
+lea L111, r4
+L153: dec r4
+L154: .string "tt"
+cmp *r5, r1
+L155: mov L590, *r6
+L156: rts
+L157: .data 480, -282, -730
+L158: rts
+mov L154, L488
+red L543
+clr r1
+L159: prn r7
+sub #150, r7
+prn r6
+clr L1
+bne L426
+; comment
+not L158
+not *r3
+jmp L125
+rts
+clr L246
+L160: add *r3, L155
+L161: bne *r5
+L162: jsr L130
+L163: red r4
+L164: rts
+L165: .data 174, -497, -936, 253, 499, 120, -559
+L166: .string "ihuhitapevzyzfcavj"
+L167: red L470
+
+cmp #95, r7
+L168: jmp L68
+L169: sub *r2, *r4
+prn *r7
+L170: inc r3
+L171: lea L10, r2
+jsr L324
+stop
+not *r2
+L172: cmp L111, *r5
+not r5
+prn L153
+L173: dec r7
+; comment
+prn #-228
+L174: jsr *r7
+L175: inc L146
+jmp L363
+L176: clr *r2
+L177: .data -831, -568, 671, 836
+L178: not *r4
+cmp #221, *r6
+L179: stop
+L180: .string "pxuumqkeontcopwcry"
+L181: jsr L428
+L182: sub #77, r2
+red *r5
+L183: inc *r6
+prn L341
+L184: rts
+L185: mov L165, L185
+L186: cmp *r1, L598
+L187: stop
+L188: jmp *r1
+L189: clr L287
+sub r5, *r4
+jsr *r7
+lea L199, r1
+L190: inc r2
+not r3
+L191: .data 614
+L192: sub r5, *r7
+L193: jsr L383
+L194: .string "uctflqrjpvhzmcvgwkyy"
+L195: add L437, L269
+L196: prn *r1
+
+L197: cmp #-131, r0
+; comment
+L198: jsr *r6
+L199: .string "eupuolltz"
+dec *r3
+
+L200: cmp *r5, *r6
+inc L254
+L201: clr *r3
+L202: inc r3
+bne L100
+L203: cmp *r7, r6
+
+sub r1, *r0
+jsr L113
+
+cmp L161, *r7
+L204: bne L169
+not *r3
+L205: .data 79, 345, -165, 13, 148, -900, 554
+L206: inc r0
+not *r5
+L207: red *r3
+jmp *r1
+L208: rts
+lea L73, *r6
+L209: .data -14, 456
+dec r3
+L210: cmp #138, #115
+cmp L177, *r6
+L211: jmp *r0
+L212: .data -715, -603, 450
+rts
+L213: lea L137, L46
+L214: inc *r1
+rts
+L215: mov #232, r7
+L216: add *r6, *r2
+L217: rts
+add r4, r4
+; comment
+sub *r7, r3
+sub r5, r6
+cmp L122, #244
+L218: sub L561, L19
+jmp L472
+L219: .data 939, 182, -167, 262, -418, 356, 414
+L220: .string "bwhbhntpo"
+L221: red r3
+L222: jmp *r4
+rts
+L223: .data 958
+clr r0
+L224: not *r5
+L225: .string "mylax"
+L226: clr L196
+L227: prn *r7
+stop
+L228: .data 167, -418, 817, -992
+jmp L272
+L229: .data 447, 231, -984, -678, -781, 151, -913
+inc L23
+prn r3
+L230: lea L578, L153
+jmp *r0
+L231: cmp *r7, *r3
+sub *r2, r3
+prn *r6
+jmp *r7
+L232: sub L218, *r2
+add r7, L88
+L233: mov L555, *r4
+L234: not *r3
+L235: jsr *r0
+cmp r0, r7
+
+inc *r6
+jmp L180
+mov *r7, L602
+
+L236: bne L568
+cmp *r1, #151
+lea L62, L492
+prn *r1
+L237: mov *r5, L265
+L238: not r3
+L239: red L369
+L240: .data 673, 746, -956, 639, -283
+L241: stop
+L242: jmp *r1
+prn *r7
+; comment
+dec L11
+L243: .data -423, -149, -791, 930, 315
+bne L237
+clr L113
+L244: prn #-148
+clr *r5
+stop
+L245: sub #-224, L135
+rts
+mov *r3, r5
+L246: cmp #-215, L197
+L247: prn *r3
+L248: mov *r3, *r4
+L249: lea L405, *r5
+L250: clr L516
+L251: stop
+; comment
+L252: stop
+L253: mov r0, L541
+mov #48, r6
+L254: dec L549
+L255: rts
+L256: lea L194, *r3
+cmp *r7, L355
+sub *r4, *r1
+add r7, *r6
+L257: clr L84
+rts
+L258: not r2
+L259: sub *r7, *r5
+L260: lea L520, r7
+L261: stop
+clr *r1
+add r4, *r1
+L262: sub r2, *r3
+L263: lea L244, *r1
+lea L299, L31
+mov #95, r2
+L264: .data 812, 314, 531, 556, -428, -953, 169, 293
+mov *r4, *r7
+L265: stop
+L266: inc L186
+L267: .data 491, 106, 569, 435, -91, -791
+L268: jmp L218
+L269: lea L358, *r4
+L270: .string "aglhkapidwa"
+L271: prn #59
+L272: bne *r3
+L273: inc r7
+L274: jmp *r7
+L275: clr r1
+L276: .string "wzq"
+L277: mov #-122, r1
+L278: sub #-157, r6
+L279: bne *r0
+L280: add *r1, *r4
+L281: rts
+bne *r5
+; comment
+L282: clr r3
+L283: dec L152
+L284: jmp *r1
+L285: rts
+L286: add L71, r0
+L287: rts
+L288: lea L544, *r7
+L289: add L114, *r2
+L290: prn #30
+L291: not r3
+L292: inc *r7
+L293: lea L454, L101
+L294: mov r7, r4
+L295: dec r2
+clr r2
+L296: mov L64, *r7
+L297: .data -579, 995, 340, 851, -479, -100, -768, 68
+L298: cmp r6, *r0
+L299: prn r1
+L300: inc *r0
+L301: clr L431
+L302: not L599
+L303: rts
+L304: lea L510, L40
+dec *r5
+L305: not r4
+L306: clr *r6
+red L176
+L307: stop
+sub *r4, *r5
+jmp L604
+L308: rts
+clr r0
+prn r6
+L309: clr r3
+sub *r3, L478
+L310: add r7, r4
+red L79
+not r7
+L311: prn r0
+L312: .string "armawugghvvgquybikjae"
+L313: .string "ddls"
+L314: not L525
+bne L573
+L315: not r0
+L316: red r5
+L317: add #96, *r6
+dec *r3
+clr L33
+L318: red L231
+L319: jmp *r4
+jsr L463
+
+; comment
+L320: inc r1
+L321: add L367, *r6
+L322: lea L103, *r2
+inc L129
+mov r6, L288
+L323: stop
+L324: red L583
+L325: red r6
+L326: not L404
+L327: red L596
+L328: cmp r2, #-254
+L329: mov r5, *r4
+L330: clr L462
+L331: inc L562
+L332: .data -78, 594, 316, -528, 565
+lea L222, r6
+jsr *r7
+L333: dec L352
+red L318
+dec r5
+rts
+inc L254
+prn *r7
+L334: sub *r1, r1
+cmp #-62, r7
+L335: prn *r2
+inc L62
+L336: rts
+L337: cmp r3, #216
+
+mov L56, L534
+L338: jsr *r1
+sub *r6, r2
+L339: add #250, r7
+L340: rts
+L341: cmp *r2, *r5
+L342: inc L1
+L343: mov r6, r2
+red L226
+L344: .data 509, -428, 34, -456, 787, 375
+red L255
+lea L455, r7
+L345: not *r0
+sub *r7, *r6
+L346: red L90
+L347: add #-4, r3
+bne L363
+L348: red *r5
+L349: inc *r1
+stop
+lea L21, r5
+L350: dec *r5
+L351: .string "xlkqfnpuwxbuennfgwev"
+L352: .data -290, 975, -936
+L353: lea L309, r0
+sub #-224, r2
+red L327
+L354: dec *r1
+lea L619, r6
+jmp *r4
+L355: rts
+L356: .string "nqcmx"
+L357: add #197, L452
+jmp *r0
+L358: inc *r2
+L359: jmp *r1
+L360: add *r0, L585
+prn L258
+rts
+bne L273
+L361: add *r2, *r6
+L362: rts
+dec r2
+L363: sub *r2, r4
+dec r7
+L364: lea L481, L300
+L365: red L403
+L366: inc *r7
+L367: bne *r2
+L368: sub *r1, r1
+jmp *r3
+L369: jsr *r1
+L370: mov #205, *r7
+L371: rts
+L372: mov L250, L580
+add L299, r1
+L373: red *r5
+L374: red *r2
+dec *r1
+L375: not *r0
+rts
+L376: .string "oaauonuixcycsncuy"
+L377: mov L453, r0
+L378: bne L78
+L379: rts
+prn r7
+L380: clr r3
+red L341
+L381: .data 19, 689, 98, -710, 545, 376, -821, -885
+L382: jsr L147
+; comment
+L383: jsr *r1
+lea L368, *r0
+L384: jmp L127
+L385: bne L521
+L386: rts
+stop
+L387: jmp *r5
+lea L134, *r3
+cmp *r4, r6
+; comment
+; comment
+L388: .string "eovu"
+prn #201
+L389: not L492
+bne L250
+jsr L298
+L390: not L1
+L391: mov L184, *r1
+inc r3
+L392: add #-153, L429
+L393: clr L391
+L394: sub L58, r2
+add #82, *r3
+jsr *r4
+L395: red r0
+cmp *r1, #147
+L396: stop
+L397: not r1
+L398: not L115
+L399: sub *r6, r6
+L400: jsr *r7
+L401: lea L380, r1
+not L552
+L402: jsr L482
+
+L403: cmp #219, *r5
+L404: cmp r4, r6
+L405: lea L522, L436
+L406: dec *r5
+L407: jmp *r7
+L408: sub L40, L61
+L409: cmp r1, #-142
+jsr L195
+L410: lea L603, r2
+L411: .data -721, -192, -676, 356, 993, 415, -485
+L412: dec L181
+prn #102
+L413: bne L426
+L414: not *r2
+L415: lea L499, L608
+L416: cmp *r0, *r1
+L417: not L117
+L418: .string "dkcrwsswrllrzmdsvwnll"
+L419: .data -961, 214, -864, 469, -543, -635
+sub #-52, *r3
+L420: prn #-124
+jmp L79
+L421: .string "mkudmounabvmpcnokdbho"
+L422: not *r5
+L423: jsr L539
+L424: .data 830, 110, 211, 464
+L425: inc *r3
+inc *r0
+bne *r3
+L426: .string "snmguynkeeojhdtchbdcsf"
+rts
+inc L623
+L427: .data 252
+L428: mov #-191, *r3
+L429: dec r3
+sub *r7, *r2
+L430: not *r0
+L431: .data -88, 658, -744, 917, -240, -110, 774
+L432: dec L25
+L433: prn #-92
+L434: lea L226, L463
+L435: dec *r0
+L436: lea L345, r7
+L437: rts
+L438: bne *r0
+; comment
+L439: inc r7
+L440: red *r6
+L441: .data -223, 81
+L442: .string "venuyoaoteljrg"
+bne *r1
+L443: red L621
+red *r7
+L444: red r5
+L445: jmp *r4
+bne L568
+jmp *r2
+L446: add r4, r2
+jsr L270
+L447: rts
+; comment
+L448: jmp L335
+lea L548, *r3
+L449: .string "mcchib"
+L450: inc r6
+cmp #-97, r5
+L451: not *r6
+L452: .string "lbvxxaohkfepoeyqmafa"
+L453: lea L495, r7
+L454: jsr *r2
+L455: jsr *r4
+L456: clr r3
+L457: sub r1, *r1
+jsr L438
+L458: stop
+L459: sub *r4, L550
+L460: bne L95
+L461: lea L538, L545
+L462: add #-2, r6
+stop
+L463: clr r0
+cmp *r7, *r3
+L464: lea L184, r7
+L465: not *r7
+L466: cmp r2, r0
+L467: dec *r6
+stop
+L468: clr r4
+lea L177, *r3
+mov r4, r2
+L469: rts
+lea L572, L346
+mov r2, r6
+L470: cmp *r1, r1
+rts
+L471: sub L250, *r2
+L472: jmp *r7
+L473: .data 771, 107, 494, -394, 113, -419, 918, 101
+L474: add r3, *r7
+L475: add L484, *r5
+prn #-58
+L476: bne L352
+L477: prn *r4
+L478: bne L174
+L479: .string "npypaxj"
+not *r4
+; comment
+L480: bne *r7
+L481: jsr *r3
+L482: dec r4
+L483: red *r3
+L484: bne *r4
+sub #55, r0
+cmp r7, r7
+L485: clr L590
+sub r4, r3
+L486: .data 358, -753, -465, -924, -933, 826, 719
+L487: prn #50
+L488: jmp L499
+bne *r4
+L489: mov r1, L133
+L490: lea L551, L591
+L491: stop
+L492: cmp *r4, L513
+L493: cmp #30, *r2
+bne L608
+L494: lea L416, L386
+; comment
+L495: red L549
+mov #-104, r1
+L496: prn r5
+L497: red r5
+L498: .string "vyhruawf"
+L499: dec *r0
+jmp *r7
+L500: add L478, L553
+L501: add r6, *r3
+rts
+L502: add r1, L434
+L503: .data -46, 136, -788, 202, -93, -367
+L504: stop
+red *r0
+L505: rts
+L506: cmp #-92, *r6
+clr L358
+sub L527, r3
+red L342
+L507: jmp *r1
+L508: .string "zoswxttkytziliz"
+L509: mov *r6, L529
+L510: add #252, L396
+L511: dec L567
+L512: .data -904, 603, 770, 328, -772, -605
+jmp L546
+L513: dec r1
+prn L10
+L514: jmp *r1
+L515: prn L43
+L516: .data -57, 460, 549, -552, 457, -678
+L517: red L369
+prn r2
+L518: jsr *r2
+L519: prn #-223
+L520: jmp *r2
+; comment
+cmp #-78, #73
+L521: cmp r3, r1
+cmp r3, *r0
+not r7
+red L65
+prn #78
+not L580
+L522: jmp L128
+L523: bne L18
+add r0, *r6
+L524: add r7, r2
+clr *r3
+red *r6
+L525: not r5
+L526: sub L282, *r7
+; comment
+bne L575
+L527: sub L117, L571
+bne *r4
+mov r7, r0
+L528: not L537
+L529: inc *r7
+L530: cmp r5, L593
+L531: add r4, L581
+dec L253
+L532: lea L583, L486
+L533: stop
+L534: lea L444, *r0
+
+L535: stop
+L536: inc *r7
+L537: prn #187
+L538: red *r0
+L539: cmp #166, L624
+L540: jmp L337
+L541: .string "wymbjtuoyv"
+L542: .data 197, 923, -654
+L543: add #229, L624
+L544: not L155
+red *r7
+clr L335
+stop
+L545: prn L570
+L546: .string "iuamyqpnbeqh"
+L547: add #-169, L362
+sub L579, *r4
+not *r1
+L548: .data -443, 124, -444, -319, 924, -894, -781, 972
+L549: jmp L169
+red L620
+L550: .data 812, 964, 670, 902
+L551: .data -87, 104
+L552: jsr *r2
+L553: not *r2
+L554: prn L51
+L555: jmp L186
+inc L196
+L556: clr *r7
+rts
+clr L288
+L557: cmp #177, L612
+L558: mov L146, L623
+L559: dec *r2
+L560: not L563
+L561: .data -463, 369, 449, -862, 380, -642
+L562: bne L567
+sub *r2, *r1
+L563: .data 940, 933, 320, -942, 822, 451, 813
+
+jsr L342
+L564: red r6
+L565: bne *r4
+lea L606, *r3
+L566: clr L169
+rts
+L567: add r1, L165
+L568: red L25
+L569: stop
+L570: add r4, r3
+L571: mov *r3, r4
+cmp *r1, r6
+L572: bne L624
+L573: lea L614, r2
+L574: not *r4
+lea L209, L306
+L575: cmp *r2, #-140
+bne L596
+L576: red *r4
+L577: not r4
+jmp *r1
+L578: clr *r1
+dec *r5
+L579: .string "oectblahcmfammuavmlptd"
+jmp L411
+L580: bne *r2
+add L619, *r1
+rts
+L581: rts
+L582: lea L554, *r1
+L583: stop
+bne *r0
+dec *r4
+cmp #39, L619
+L584: jmp *r5
+L585: dec L503
+L586: sub *r3, r7
+L587: .string "e"
+cmp L453, r2
+stop
+L588: mov L571, r5
+L589: clr *r3
+L590: rts
+bne L614
+L591: rts
+L592: clr r5
+L593: stop
+L594: prn *r5
+L595: red *r2
+L596: .string "tatfstfgtjhsu"
+bne L58
+L597: bne L388
+L598: dec L606
+sub *r2, *r7
+bne *r1
+inc r2
+L599: .string "dhzg"
+L600: red r6
+L601: red r4
+L602: stop
+mov L23, r0
+lea L613, *r0
+stop
+L603: mov *r4, *r2
+L604: dec L468
+L605: jmp L619
+L606: add #223, r7
+bne L539
+jmp L613
+L607: not *r6
+L608: prn L152
+L609: sub L412, *r3
+L610: bne L320
+L611: add #-170, *r6
+; comment
+L612: cmp *r0, L623
+L613: bne *r7
+L614: jsr L65
+L615: rts
+L616: not *r5
+L617: clr *r5
+L618: not r0
+L619: .data -912
+dec r4
+L620: .data -495, -513, 808, -685, 338
+prn r4
+L621: dec *r0
+jsr *r0
+L622: cmp r7, *r4
+L623: lea L624, *r7
+clr r6
+L624: .data -128, 198, 177, 783, -951, 753, 463, 962
+inc *r0
+stop
@@ -0,0 +1,1040 @@
+; Generated by genCorpus --seed 29
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+L0: red r4
+L1: mov L1, L0
+L2: sub L508, *r7
+L3: sub L3, *r3
+L4: .data -4, 778
+
+inc L4
+L5: rts
+lea L314, *r1
+L6: .string "sblocnx"
+L7: .data -371, 692, -274, 614, 829, 239
+L8: red *r3
+L9: not *r6
+red L416
+bne *r4
+clr r5
+not r4
+L10: .data -417
+L11: bne L5
+red r4
+red *r4
+mov r1, *r2
+rts
+L12: stop
+L13: .string "fuhrzno"
+L14: add L213, L260
+L15: .string "nyxvvmmut"
+L16: not r0
+L17: clr *r3
+add #132, L15
+bne L8
+L18: bne *r2
+L19: mov L290, *r1
+lea L411, r7
+L20: .string "knb"
+L21: clr r1
+L22: .data 236, -187
+L23: rts
+L24: inc r3
+
+clr *r4
+L25: dec r4
+L26: dec L80
+L27: jsr *r7
+L28: stop
+L29: sub *r2, *r4
+cmp *r1, #96
+lea L0, *r3
+L30: jmp *r6
+prn *r0
+L31: mov *r3, *r2
+L32: add L27, *r5
+jsr L14
+stop
+L33: .string "zpqabxfwoztasj"
+L34: red r0
+L35: bne L77
+L36: .data 308, -452
+L37: jmp *r1
+clr L150
+jsr L175
+L38: .string "yigbbhxngc"
+L39: jmp *r2
+sub #16, *r6
+L40: jsr L7
+lea L22, *r5
+L41: jmp *r4
+L42: cmp r0, L0
+bne L386
+L43: mov r1, *r6
+L44: dec L133
+L45: lea L45, L561
+L46: cmp L5, L24
+L47: lea L265, L288
+L48: dec L18
+
+red L211
+L49: inc *r6
+L50: .data -520, -187
+L51: cmp #105, #-133
+mov *r4, L10
+L52: red *r2
+lea L43, r4
+L53: prn #98
+L54: sub r2, L39
+L55: rts
+red *r0
+L56: mov *r4, L556
+dec *r3
+L57: not L320
+L58: lea L436, *r3
+L59: rts
+L60: not L151
+bne L279
+add L16, L562
+; comment
+L61: jmp *r7
+rts
+L62: prn #39
+not r0
+L63: cmp L44, r2
+
+L64: .string "ueordnohgkaanjiyduyiq"
+inc r6
+add r3, r7
+L65: .data -597, -555
+L66: lea L198, *r3
+jsr *r4
+not L2
+L67: .string "navlzpmqemtbmrsw"
+; comment
+clr L28
+red *r5
+L68: not L231
+not r6
+jmp *r0
+cmp L11, L481
+L69: clr r7
+L70: clr *r7
+
+L71: prn L36
+; comment
+L72: .string "pswmgdfcvo"
+inc *r0
+rts
+L73: sub *r0, r3
+red r0
+L74: add L31, L97
+L75: mov #241, r4
+L76: jmp *r5
+rts
+jsr L26
+L77: add L220, *r7
+L78: jsr *r2
+bne *r3
+L79: clr *r7
+L80: sub *r4, r5
+L81: lea L23, L437
+L82: inc *r2
+red L18
+L83: mov L7, L10
+
+jmp *r0
+clr r7
+L84: clr L28
+jmp L4
+L85: dec *r6
+L86: inc r4
+L87: inc r0
+L88: red L506
+L89: .string "bawxwmjqktmvgsso"
+; comment
+add *r5, r5
+jmp L60
+L90: clr L30
+L91: jmp *r7
+add r6, L132
+rts
+L92: inc r3
+
+rts
+bne L189
+L93: prn L492
+dec *r1
+L94: inc r1
+dec *r7
+; comment
+L95: .data -113, -778
+sub L71, r7
+L96: red r5
+; comment
+L97: inc *r4
+L98: sub r0, r6
+stop
+L99: rts
+L100: dec r5
+bne *r6
+L101: .string "eidhmbjsagqslj"
+clr L27
+not *r7
+L102: jmp L89
+clr L461
+L103: clr r4
+L104: clr *r7
+add #106, r7
+red L395
+L105: mov *r2, r2
+L106: .data 792, 730, -845, 893
+L107: sub *r5, r4
+L108: inc L33
+L109: bne *r2
+L110: stop
+add #-248, r6
+; comment
+L111: not L161
+L112: not L374
+inc r5
+jsr L252
+L113: sub *r2, L358
+L114: mov #238, r1
+add r4, *r0
+rts
+dec *r5
+jsr *r1
+L115: cmp #-227, #78
+L116: mov #-132, r3
+L117: lea L92, *r3
+inc *r5
+stop
+L118: .data -996, -771, -943, 732, -653
+
+rts
+L119: mov L127, *r6
+L120: inc *r1
+L121: prn *r6
+dec r1
+dec L466
+L122: red *r1
+L123: stop
+L124: lea L120, *r7
+stop
+L125: clr r5
+L126: .data -238, 434, -630, -233, 875, -275, -364
+rts
+stop
+L127: clr L12
+L128: not *r7
+L129: .data -743, 861, 870
+L130: red *r6
+; comment
+not L325
+prn #9
+rts
+L131: not r4
+L132: not *r4
+L133: .string "xhrhbciynmn"
+mov r0, *r2
+L134: mov L212, *r7
+jsr L226
+inc r3
+L135: inc *r2
+
+L136: jsr *r7
+red L56
+L137: jsr *r4
+
+L138: prn r4
+L139: sub *r2, r3
+L140: .data 152
+cmp *r5, #28
+jmp L499
+L141: clr *r0
+L142: dec *r5
+L143: rts
+L144: .data -818, 661, -811
+L145: jsr L109
+inc L90
+L146: clr r4
+add *r7, L581
+L147: mov r7, r6
+add L122, L303
+red r3
+stop
+L148: inc r4
+red L38
+L149: lea L377, r3
+dec r4
+; comment
+L150: not *r1
+L151: .data -569, 522, 464, 873, -600, -213
+
+L152: stop
+L153: not L113
+L154: lea L376, L131
+
+L155: inc r2
+clr r2
+
+L156: .string "gycdgpajbdouarqjptui"
+L157: rts
+L158: stop
+L159: .string "zkgyrjxmslmvnu"
+dec r2
+; comment
+L160: inc L534
+stop
+L161: bne L73
+L162: mov #189, r4
+
+L163: mov *r2, *r6
+L164: inc r0
+L165: clr r1
+L166: mov *r0, r5
+L167: .string "ytrpuhbgd"
+L168: sub #-24, L93
+L169: sub r1, *r4
+prn #168
+L170: not L2
+
+L171: not r7
+dec r2
+
+L172: clr r4
+L173: bne L8
+not *r0
+L174: dec *r0
+L175: .string "bzxvwouekknkx"
+L176: dec *r0
+L177: cmp #-19, L132
+L178: not *r1
+L179: clr r6
+mov #-186, L464
+L180: lea L59, r6
+jmp L54
+L181: mov #203, L428
+L182: red L300
+L183: inc r7
+L184: not L556
+
+prn L160
+L185: mov *r7, r4
+L186: inc r0
+L187: rts
+sub L42, *r5
+inc r5
+L188: clr *r7
+L189: not r7
+jsr *r2
+L190: lea L139, L291
+L191: red *r4
+L192: add r7, *r1
+L193: cmp L408, #-81
+L194: prn *r6
+L195: clr *r3
+L196: add *r7, L23
+L197: .string "mecbqqlpejxgqmcwmnlej"
+jmp *r6
+L198: stop
+rts
+L199: inc *r0
+L200: add #-71, L11
+add r0, *r5
+sub #37, L585
+prn L346
+clr r1
+L201: rts
+mov L358, r2
+L202: add L535, r6
+sub *r6, L420
+L203: inc *r5
+L204: sub #-222, *r2
+L205: inc r5
+L206: red L291
+L207: sub r4, r0
+L208: .string "nkljlnmjnlmrpxaqzaqb"
+L209: dec r6
+red L32
+; comment
+L210: cmp #13, *r2
+mov L176, *r6
+dec r3
+L211: inc L172
+L212: lea L395, *r2
+L213: inc *r3
+rts
+L214: .data -502, -766
+add r1, r1
+L215: inc L296
+L216: dec r0
+L217: red *r2
+jsr *r5
+L218: red *r6
+L219: bne *r3
+L220: rts
+L221: bne *r6
+dec *r1
+L222: inc r5
+L223: .string "zgksnuece"
+inc *r5
+L224: .data -78, -716, -248, 97, -230, 432
+
+add L472, L173
+; comment
+rts
+L225: clr *r4
+L226: lea L532, r5
+L227: lea L152, L188
+jmp *r7
+L228: bne L493
+L229: .string "dpazuaymgyumm"
+jmp L111
+L230: red r2
+not *r6
+L231: prn L66
+not r3
+L232: sub *r3, r7
+red *r5
+cmp *r6, r6
+dec r1
+L233: clr r0
+bne *r0
+prn r2
+L234: jsr L33
+L235: cmp r2, #-80
+; comment
+L236: mov r7, *r6
+
+cmp r4, r5
+L237: rts
+clr L220
+jsr L503
+sub #-43, r7
+L238: inc r4
+L239: cmp *r7, L441
+L240: bne L12
+L241: red *r5
+bne *r2
+L242: .string "ypvplwladq"
+L243: .data -70, -126
+prn L454
+L244: not r3
+red L52
+L245: jsr *r2
+L246: .string "xgxhytxx"
+L247: clr r5
+L248: inc L367
+L249: stop
+L250: .data 682, 481, 359, 502, 76, 56, 617, 637
+L251: cmp L61, #197
+
+L252: .data -219, 304
+L253: clr *r4
+lea L324, *r0
+stop
+sub *r2, *r6
+jsr *r2
+stop
+L254: prn #111
+
+L255: red L70
+clr *r1
+L256: bne L556
+add L277, L274
+jsr *r2
+L257: inc L270
+add L512, r5
+sub L16, r3
+L258: jmp L127
+L259: add r0, *r0
+cmp *r3, r3
+L260: cmp #-148, r4
+
+L261: add *r4, r1
+L262: add *r3, L350
+L263: stop
+add *r7, *r3
+sub #61, *r2
+L264: sub L201, r3
+
+L265: prn L444
+L266: rts
+L267: .string "traqcjvxpi"
+mov #-19, *r0
+L268: mov #-144, L507
+L269: dec L565
+
+inc *r1
+prn L334
+clr *r0
+lea L467, r0
+add #154, L244
+stop
+cmp L326, *r1
+L270: stop
+stop
+L271: inc r1
+L272: sub #209, L552
+L273: stop
+lea L552, *r3
+L274: inc *r0
+stop
+L275: clr r5
+L276: .string "xlvqpkiyqwzhc"
+L277: not *r7
+L278: .data -965, -337
+L279: not r7
+L280: cmp #219, #36
+cmp *r6, *r6
+add #-223, r7
+L281: dec *r5
+dec L92
+stop
+cmp L178, *r2
+L282: dec *r6
+bne *r0
+L283: .string "ziaprxhdcm"
+L284: stop
+prn L545
+L285: bne L535
+
+jsr L591
+L286: prn *r4
+L287: mov L66, *r2
+L288: cmp #12, #226
+L289: mov L104, r1
+L290: cmp L213, #-135
+L291: clr *r7
+L292: rts
+L293: red L10
+L294: red L546
+L295: .string "vw"
+L296: stop
+; comment
+L297: cmp L207, #-174
+
+jsr *r7
+clr r4
+L298: rts
+inc r2
+add *r1, *r6
+L299: stop
+
+mov *r4, *r7
+L300: red r1
+bne L492
+
+dec r1
+inc L37
+bne L563
+L301: not L519
+L302: prn L414
+L303: prn L191
+add L124, L26
+L304: .data 118, -121, -152
+cmp #12, #163
+L305: inc r2
+L306: .data -108, -606
+L307: .data -656, 606, -478, 270
+L308: jmp L262
+L309: cmp #-232, #166
+L310: cmp *r3, *r3
+clr *r0
+L311: red r7
+L312: jmp L235
+stop
+rts
+L313: rts
+L314: stop
+L315: red r5
+not L547
+L316: .data -785, 869
+mov r7, r3
+add #77, r5
+L317: prn #-106
+jsr L77
+L318: not *r6
+L319: jmp *r6
+dec L478
+prn r4
+L320: inc L348
+sub *r2, *r3
+L321: mov #-56, *r7
+L322: stop
+L323: red *r6
+inc L581
+jsr L405
+L324: .data -740, 655, -312, -874, 824, 870, 973
+L325: dec L424
+L326: inc r1
+rts
+dec r7
+red r7
+L327: .string "xdjcalfhmnirox"
+L328: rts
+
+L329: mov L562, L154
+lea L175, r3
+
+L330: inc r7
+L331: cmp r2, #244
+L332: stop
+
+L333: rts
+L334: prn #-1
+L335: cmp L22, r7
+L336: jmp L411
+
+L337: .string "yufbwzucsxlvasluctnkqmde"
+L338: cmp #58, *r2
+not r3
+
+L339: inc L457
+L340: inc r2
+L341: jmp L176
+not L404
+L342: clr r5
+prn r5
+lea L120, r6
+L343: lea L83, L345
+L344: bne L45
+L345: not r1
+L346: add L581, L261
+L347: clr r5
+rts
+L348: clr *r4
+L349: prn r2
+prn L123
+
+L350: sub r4, L587
+L351: prn *r3
+L352: dec r0
+cmp r6, *r4
+L353: mov L119, r0
+; comment
+not L143
+L354: not L443
+L355: rts
+L356: .data 216, -962, -114, 729, -328, 52, 768, 754
+L357: add r5, L403
+L358: cmp L483, r4
+dec *r0
+L359: red r4
+jsr L44
+cmp #-150, r3
+L360: bne L357
+not L204
+mov #30, L381
+L361: .string "f"
+L362: red L271
+inc L580
+L363: red L435
+L364: .string "gchudusammbqmnnbtoellty"
+lea L463, L551
+L365: lea L236, *r3
+L366: jmp *r1
+L367: mov L556, *r3
+L368: mov L406, L441
+L369: jsr *r0
+bne L342
+L370: .string "mrrmfp"
+L371: .string "ocsblwac"
+L372: add *r0, *r2
+cmp L429, L570
+cmp #10, #-1
+bne L441
+L373: .string "uoghewahztqpevklyxxcfnl"
+L374: cmp *r3, #131
+L375: red L494
+L376: bne L363
+dec L196
+L377: mov *r0, r0
+red *r3
+L378: add r0, *r1
+L379: lea L480, *r4
+L380: stop
+bne *r2
+L381: bne L426
+L382: red r5
+L383: dec r2
+sub r0, r7
+L384: clr *r3
+L385: mov L440, L488
+L386: mov L584, r1
+jsr L561
+mov L529, *r2
+bne L542
+L387: prn *r1
+L388: jsr L514
+L389: prn #170
+L390: .data -737, -593, 193
+L391: inc r4
+L392: not *r2
+L393: cmp L549, *r6
+sub #155, L418
+L394: stop
+L395: jsr *r0
+L396: .data -896
+L397: clr r7
+L398: .string "iurimtrr"
+jsr L529
+dec r7
+L399: .string "esidspoonlfqgzfgesigs"
+add L370, r3
+dec *r7
+L400: bne L435
+L401: not *r3
+L402: .string "dlfgkeovbl"
+prn *r6
+L403: cmp #9, #-67
+jsr L215
+rts
+not r3
+red r5
+L404: .data 930, 491
+dec *r3
+add L328, L342
+clr r3
+L405: sub *r7, r1
+L406: dec L490
+jsr L499
+L407: clr *r2
+L408: add *r0, *r6
+L409: .data -834, -413, -565, -495
+L410: .data 408
+L411: not r2
+cmp r5, r4
+inc L299
+L412: .string "qyxqngbzwasoriujumye"
+L413: inc *r1
+L414: rts
+L415: bne L567
+L416: stop
+not r2
+L417: clr r5
+inc L462
+
+rts
+not *r0
+prn L441
+lea L578, *r7
+L418: .string "ecbjcqebxtzilnb"
+clr L471
+L419: bne *r4
+L420: sub r1, *r0
+L421: rts
+dec r3
+; comment
+
+L422: inc r4
+red L224
+L423: cmp L576, L542
+lea L440, *r1
+L424: red *r2
+L425: red r5
+rts
+stop
+L426: lea L558, r1
+L427: jsr *r1
+; comment
+; comment
+L428: red *r0
+L429: clr L164
+lea L556, *r4
+jsr L375
+stop
+; comment
+stop
+
+red L345
+L430: clr r3
+red r2
+jmp L446
+L431: not r1
+L432: red L259
+L433: prn *r4
+L434: prn r3
+jsr L297
+L435: bne L372
+inc L555
+L436: lea L101, r7
+L437: jsr L492
+lea L73, L516
+rts
+L438: clr L252
+L439: not L278
+L440: stop
+L441: jmp *r3
+L442: mov L17, L296
+L443: dec *r5
+sub #-88, r7
+not r5
+L444: stop
+jsr L160
+inc L20
+L445: jsr *r0
+L446: stop
+L447: .data 434, 872, -382, -68
+jsr L146
+L448: clr L44
+L449: .data 880, 352, -764, -90
+rts
+L450: clr L143
+L451: prn L342
+L452: jmp L498
+
+L453: .data 908
+rts
+L454: not *r6
+L455: lea L258, r2
+L456: bne L168
+L457: cmp *r4, L560
+L458: inc r7
+L459: red r7
+L460: inc r1
+L461: .string "nllyhsbfpsrirfxpqnek"
+L462: stop
+L463: .string "vgrlsjgbmwxhyhxht"
+L464: inc L487
+L465: lea L459, *r1
+L466: .string "asudmrnrmigycbnu"
+L467: dec *r2
+L468: red L580
+L469: sub *r5, r1
+L470: bne *r5
+L471: rts
+prn r0
+
+L472: stop
+L473: red *r2
+L474: .data -969, -643, -969, -956, 200, 642
+mov #-233, *r7
+L475: bne L537
+L476: .string "qvloz"
+dec r0
+jmp L299
+L477: bne L21
+L478: inc L574
+L479: cmp #88, r5
+L480: prn L205
+L481: dec L548
+L482: inc L509
+L483: prn #14
+
+stop
+L484: clr L525
+L485: .data 274, -498, 422, -421, 17, 559, 425
+jmp *r0
+sub #-116, L570
+
+L486: add L402, L585
+L487: rts
+sub *r4, L104
+L488: .string "go"
+L489: add r3, r3
+stop
+L490: .data -10, 38
+L491: cmp *r1, r7
+prn #18
+L492: mov #27, L537
+clr *r6
+rts
+L493: not L584
+lea L554, *r3
+L494: add *r0, *r1
+L495: .string "rayhkjzjlkspkjsmzcgtiw"
+prn L37
+clr *r3
+L496: inc r0
+L497: .string "vftbrvuhsueerbtggduthk"
+L498: stop
+add *r4, r6
+L499: .data 777
+L500: clr *r5
+L501: stop
+L502: inc *r3
+L503: .data -138, 604, 866
+bne *r3
+
+stop
+L504: clr *r2
+L505: stop
+L506: mov *r2, *r6
+L507: mov L559, L556
+stop
+L508: add #167, *r4
+L509: inc L62
+L510: add L393, L575
+jsr *r6
+L511: bne *r4
+L512: bne L536
+L513: .string "krjnmyhxvtlfqcaztu"
+L514: jsr L586
+L515: jmp L545
+L516: jmp *r2
+L517: stop
+dec *r7
+L518: prn #70
+L519: jmp L553
+L520: .data 579, 390
+not L579
+L521: red r4
+L522: jsr *r1
+add r5, r7
+; comment
+L523: mov r2, L344
+clr r5
+L524: clr *r4
+L525: inc *r5
+L526: .data -715, -580, -171, 654, -519, -330
+dec r6
+L527: sub #-74, *r2
+L528: prn #37
+L529: inc *r4
+L530: .data -350, 929, 889, 506, -577, 735, 850
+; comment
+L531: add #-34, r7
+L532: add L223, L562
+L533: stop
+L534: cmp L386, L51
+stop
+L535: .data 304, -786, 985, 673, -483
+L536: add #-211, L183
+L537: jmp L448
+L538: not *r3
+
+bne *r0
+L539: add *r7, r3
+prn *r1
+L540: stop
+inc r7
+L541: lea L570, L576
+L542: bne *r3
+sub *r6, L546
+L543: red r5
+L544: .string "rcloitskzixvpjnjsfkz"
+L545: .data -819, -621, 446, 423, 754, -240
+L546: add #168, *r0
+clr r5
+L547: jmp *r3
+bne L583
+prn *r5
+red L550
+L548: clr L551
+L549: dec r1
+L550: .data 472, -506, 155, -126, -176, -316, 361
+L551: mov #-123, *r5
+L552: .string "ltlnmbfythr"
+not L462
+rts
+stop
+stop
+L553: red L556
+clr r7
+rts
+clr *r2
+L554: .data -891, 942, -156, -184, -958, 719
+L555: rts
+L556: inc L583
+lea L558, r7
+L557: sub L574, r0
+lea L569, *r5
+stop
+L558: dec *r3
+L559: jsr *r2
+L560: rts
+L561: inc *r3
+L562: prn r1
+L563: lea L569, r0
+L564: sub #-211, r0
+L565: bne L578
+L566: clr L416
+L567: .string "srqvuimzersqtsgsqmeehkwy"
+L568: lea L11, r4
+sub *r6, *r5
+L569: mov r6, *r6
+L570: clr *r6
+L571: .string "hekhmpidcdvdgclksjt"
+rts
+inc *r5
+L572: not L304
+L573: not *r1
+L574: jsr *r0
+inc r6
+L575: red L582
+mov *r3, *r0
+L576: red *r2
+L577: sub #225, *r7
+L578: inc r4
+not *r6
+stop
+L579: bne *r2
+L580: rts
+L581: prn *r5
+L582: not *r0
+; comment
+L583: bne L585
+inc *r3
+sub r2, r6
+
+prn r1
+stop
+L584: clr *r5
+L585: jsr L24
+L586: .data 24, -653, 228, 753, -652
+L587: .string "yhnnedgmem"
+stop
+rts
+L588: lea L589, r0
+lea L151, r6
+L589: mov *r7, L474
+; comment
+sub r4, L101
+L590: jmp *r5
+L591: .data -70, 211
+stop
+L592: sub *r2, *r0
+lea L85, *r1
+prn r0
+add #-246, L100
+; comment
+stop
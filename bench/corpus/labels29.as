@@ -0,0 +1,1040 @@
+; Generated by genCorpus --seed 30
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+
+cmp r3, #-227
+jsr L435
+L0: .string "fiqmxozyxlwwpjxyslfpjhea"
+add #-105, L0
+L1: mov #-121, *r3
+L2: lea L363, r2
+L3: inc *r7
+red *r1
+L4: jsr L213
+jsr *r3
+L5: add *r3, r0
+prn L515
+red *r1
+; comment
+L6: mov #-19, *r2
+clr *r1
+L7: clr r5
+L8: jsr L7
+dec *r0
+dec *r3
+bne L374
+L9: red *r4
+rts
+lea L9, *r6
+stop
+L10: rts
+stop
+L11: jsr L0
+add r5, L7
+jsr L574
+lea L1, *r5
+L12: red *r2
+dec *r2
+L13: rts
+L14: not L96
+inc L192
+L15: inc r7
+L16: sub #217, L16
+L17: jmp *r7
+red *r3
+L18: .data 965, -787, -983, -621
+dec r7
+lea L4, r5
+L19: add *r2, L108
+bne *r7
+L20: jmp L157
+L21: cmp *r0, #68
+prn r5
+L22: .string "tvpnlzznfpxmu"
+L23: bne L3
+L24: cmp #-230, *r3
+L25: bne *r1
+L26: add #135, L57
+prn L453
+L27: prn r5
+inc *r3
+L28: jmp *r1
+clr r6
+L29: not L486
+L30: add #-130, r4
+L31: sub #-128, *r0
+L32: mov #-25, L14
+prn L21
+L33: jsr *r5
+not r6
+L34: rts
+clr r0
+L35: .string "ymrzaiav"
+
+stop
+red r2
+jsr L114
+mov #54, r4
+not L4
+L36: clr *r1
+; comment
+L37: jsr *r5
+bne L25
+mov r3, *r2
+add #-158, *r2
+L38: jsr *r0
+L39: sub L510, r5
+L40: .string "oahtbtfshoxdxskzgkpx"
+L41: lea L358, r1
+inc L27
+dec *r3
+L42: .string "j"
+L43: jmp L571
+L44: jsr *r3
+L45: rts
+L46: bne L210
+jsr *r5
+L47: clr L8
+jsr *r1
+not *r0
+L48: cmp r7, *r4
+L49: lea L27, L132
+jsr L0
+red L133
+L50: mov r1, *r7
+L51: red *r6
+inc r3
+L52: lea L267, *r1
+prn *r0
+clr r3
+L53: not L22
+L54: jsr L21
+L55: inc *r7
+L56: dec *r3
+L57: rts
+cmp r3, *r4
+L58: inc L10
+cmp r1, r2
+L59: not L46
+L60: .string "hnfjumcindzf"
+cmp #75, *r1
+L61: lea L12, *r2
+L62: stop
+L63: rts
+L64: stop
+L65: cmp r3, L470
+L66: stop
+L67: jmp *r4
+cmp r7, r6
+L68: not L54
+L69: jsr *r7
+add L26, r2
+L70: mov L568, L474
+L71: lea L571, *r5
+red *r1
+L72: .data -120, -697, -57, -481
+L73: red r2
+L74: mov #-7, *r3
+L75: .string "qjutfgszhlxkk"
+L76: .data -425, 166, -133, -979
+clr r7
+L77: rts
+L78: prn r0
+L79: inc *r4
+not *r5
+L80: red L63
+rts
+not r1
+cmp r0, r4
+; comment
+L81: .string "fndvzzvldyxodlgrkmr"
+L82: mov #33, *r7
+L83: jsr *r4
+jsr *r3
+mov #237, L74
+mov #206, *r0
+jsr L36
+add #-205, r6
+L84: sub L84, *r2
+L85: red *r7
+L86: dec L76
+L87: mov #47, L326
+
+L88: bne L65
+L89: clr *r6
+L90: .data -409
+L91: mov L331, r1
+bne L15
+lea L8, *r6
+L92: lea L65, L425
+L93: not *r2
+L94: add #71, r1
+cmp r3, #-7
+L95: rts
+L96: jmp *r6
+L97: bne L149
+L98: prn #210
+mov L162, *r6
+jsr L26
+L99: not *r1
+L100: .string "xqimfpnnamixspqvczsgd"
+L101: red L272
+L102: prn *r5
+L103: sub r0, *r6
+rts
+L104: add #250, *r2
+L105: rts
+L106: lea L124, *r5
+; comment
+rts
+L107: prn r0
+L108: cmp L84, #-61
+add r7, r3
+; comment
+jsr L35
+L109: jsr *r1
+L110: rts
+L111: inc r6
+L112: not *r6
+
+rts
+cmp L14, #-129
+L113: rts
+L114: rts
+bne *r2
+L115: cmp *r3, L115
+prn #130
+L116: .string "zqtuz"
+red *r7
+L117: rts
+L118: cmp #110, #252
+L119: stop
+inc r6
+L120: stop
+clr r5
+L121: lea L559, L414
+L122: clr L273
+L123: dec L335
+L124: rts
+L125: .data -742, -311, -330
+L126: .string "kkgzkbkxsgjseamcik"
+add #-45, L142
+sub #-35, r1
+stop
+L127: rts
+L128: jsr *r6
+L129: .data 552, -894, 413, 216, -592, -364
+rts
+L130: not r6
+L131: lea L35, L441
+L132: cmp r5, r5
+L133: .string "udfarlcmvgrsrigqho"
+L134: not *r1
+L135: rts
+L136: stop
+mov #114, L43
+L137: cmp #-199, r1
+L138: cmp L72, r2
+L139: red *r7
+L140: bne L543
+add r5, L379
+not *r2
+
+L141: add L9, r4
+inc L292
+L142: inc r2
+cmp L13, L79
+red L59
+L143: clr *r3
+L144: rts
+not r3
+jsr L284
+L145: .string "pbmqqxjrwz"
+L146: inc r3
+jsr *r4
+L147: prn r0
+L148: not L557
+L149: not L47
+L150: mov #44, *r2
+inc *r2
+mov #114, r5
+stop
+jsr L132
+L151: stop
+L152: prn *r5
+L153: jsr L307
+not L358
+stop
+L154: clr *r6
+L155: prn *r0
+jsr *r7
+dec L63
+jmp L230
+L156: bne *r0
+L157: jsr *r4
+L158: dec r6
+jmp L123
+L159: inc r6
+L160: dec *r6
+L161: lea L368, r2
+L162: clr L463
+L163: bne *r0
+L164: stop
+L165: .data 327, 707, 411, -843, -248, 22
+dec *r4
+L166: cmp #-134, r4
+L167: stop
+L168: cmp L541, #-244
+L169: .data -458, -771, 750, 446
+L170: sub r5, *r4
+L171: .data -675, -131, 279, -909, 385, 418, -696, -340
+clr L105
+rts
+rts
+jsr L8
+
+L172: add #-164, *r1
+L173: rts
+L174: stop
+sub L45, *r5
+not r6
+red r6
+lea L177, L132
+L175: mov r4, L94
+mov #-174, *r1
+not r6
+L176: sub #-238, r2
+stop
+L177: inc *r4
+L178: add #247, L17
+L179: cmp L120, r4
+L180: clr *r1
+L181: red L316
+add *r7, r3
+L182: cmp *r6, #192
+L183: dec r7
+L184: inc L41
+
+prn #28
+bne L343
+lea L19, r7
+not L82
+L185: inc L532
+L186: .string "patscfipzjydhrb"
+red *r2
+jsr *r2
+L187: .data -865, -638, 587, 53, 543, 225
+L188: inc r1
+add #-219, r4
+L189: rts
+L190: prn *r7
+L191: not L64
+L192: jmp *r2
+L193: dec L155
+stop
+not L493
+L194: stop
+L195: sub *r6, r0
+bne *r7
+add L88, r6
+; comment
+clr *r2
+cmp r4, #84
+cmp L408, #-235
+L196: rts
+L197: cmp #-219, *r0
+dec r0
+L198: jsr *r3
+dec *r5
+L199: jmp L272
+L200: red L478
+bne L532
+L201: inc L133
+L202: rts
+prn #-168
+L203: stop
+L204: jmp L510
+L205: .data 912, 134, 876
+sub L202, r5
+L206: .data 21, -941, -704, 993, -137, -740, -320
+L207: red r3
+L208: jsr *r5
+L209: prn #168
+L210: stop
+jmp *r3
+L211: .string "eosjfibdkslwsbnsz"
+L212: stop
+cmp L438, L128
+L213: bne L0
+L214: sub r6, L397
+L215: bne L35
+inc L5
+L216: sub L46, L159
+rts
+stop
+add *r3, r0
+L217: lea L411, r4
+L218: lea L367, *r3
+L219: add L384, *r3
+L220: prn #-243
+L221: prn *r1
+inc r2
+not L422
+inc L287
+L222: prn L454
+L223: stop
+L224: .data -411, 689, -723, -761, 150, 486, 883, 730
+jmp L15
+L225: not r3
+inc L12
+L226: lea L241, *r5
+jsr L252
+stop
+L227: lea L479, L295
+L228: jsr *r1
+jmp *r2
+L229: add *r4, L118
+jmp L439
+stop
+cmp *r0, *r0
+L230: sub L469, r1
+L231: jsr L344
+L232: bne L524
+L233: red r2
+L234: add #-14, r0
+dec *r3
+rts
+not L323
+L235: stop
+mov r3, r3
+L236: add *r1, r7
+L237: sub #57, L303
+L238: red L472
+L239: add #63, L105
+L240: prn L349
+L241: jmp L413
+L242: stop
+add L186, *r3
+red L63
+add #135, r1
+inc *r4
+L243: .string "bgjbjhtbvhu"
+prn r6
+bne *r1
+add L260, r5
+L244: mov #-76, r0
+rts
+L245: prn *r4
+L246: .string "qukdxgjcovrqfd"
+L247: prn #51
+red r2
+L248: .string "oqj"
+rts
+
+lea L356, *r0
+stop
+; comment
+L249: mov r3, *r7
+L250: clr *r7
+L251: stop
+inc L560
+bne *r3
+L252: dec *r4
+L253: inc r2
+L254: not L241
+L255: .data -949
+cmp r2, *r0
+
+cmp r1, L294
+L256: jsr L167
+sub r7, *r6
+stop
+L257: dec L414
+lea L255, L237
+L258: .data -968, 347, -254, 624, 232, -247
+red *r3
+L259: jsr L259
+L260: rts
+; comment
+; comment
+L261: stop
+; comment
+sub #146, r7
+L262: lea L515, r7
+red *r5
+L263: not *r4
+clr r0
+jmp *r6
+inc *r0
+L264: mov *r2, L547
+L265: .data 739, 546, -107
+rts
+L266: jsr *r1
+L267: .data -89, 843, 263, -687, 614, -324
+L268: add #-99, L422
+
+L269: jsr L59
+sub L26, r4
+red r6
+L270: .string "ycndmezxlvn"
+lea L526, *r4
+L271: sub *r1, L478
+L272: stop
+L273: add #222, r7
+L274: cmp *r4, *r6
+clr r7
+L275: bne *r0
+L276: dec r2
+rts
+lea L488, *r3
+L277: mov L142, L24
+L278: jsr L589
+L279: add *r3, r0
+L280: stop
+L281: rts
+prn #-35
+L282: sub #165, L10
+inc r2
+L283: bne L325
+jmp L36
+L284: lea L551, L125
+L285: lea L45, r3
+L286: lea L42, L557
+L287: .data 918, -206, -973, 643, -440
+L288: red r5
+bne *r4
+red L46
+L289: .data -104, -62, -713, 251, -383, 518
+not L314
+L290: jsr *r5
+L291: sub *r4, L131
+stop
+L292: prn L155
+L293: .string "vgsetqwvrrodwrdxn"
+L294: stop
+dec r5
+
+L295: red r0
+L296: rts
+red L285
+; comment
+L297: dec r7
+L298: .string "drcpevtndiplysvzqsi"
+L299: add r5, *r0
+
+bne *r2
+inc *r6
+L300: lea L227, L416
+L301: stop
+L302: .string "vkeejgjaerxqofnbtbn"
+L303: .string "kkdgpqfvdarjadsyhdhhp"
+L304: .string "tsbkvbejbmr"
+L305: inc r6
+jsr L146
+L306: jmp L129
+add r1, *r4
+L307: bne *r4
+rts
+L308: not L561
+L309: stop
+
+add #-174, *r6
+L310: not *r1
+lea L263, r3
+L311: cmp #98, L218
+L312: rts
+L313: sub r5, *r3
+L314: jmp *r2
+inc *r1
+cmp #214, L3
+not r4
+L315: not L202
+L316: .string "axlqgbpgufwulwietigob"
+L317: .data -586, 899, -182
+L318: rts
+stop
+L319: jmp *r1
+
+L320: .string "whkfe"
+inc r2
+cmp r2, #-195
+jmp *r5
+jsr L28
+L321: jsr *r5
+L322: dec L203
+prn *r5
+L323: sub r5, L57
+lea L582, *r1
+red r5
+L324: stop
+L325: inc r6
+L326: red L251
+stop
+L327: not *r6
+jmp *r6
+L328: .data 0
+L329: .string "kikkhcraponnkhwdbjejpo"
+L330: .string "ieoqajnlv"
+L331: not *r5
+L332: sub *r5, L137
+L333: add L181, L319
+L334: cmp L478, *r6
+inc L559
+L335: sub #-72, r5
+rts
+add r2, *r5
+L336: add r6, L363
+bne L594
+add r4, L324
+L337: sub *r6, *r7
+L338: .string "wnusptd"
+sub #45, *r7
+L339: sub *r7, r1
+L340: jmp *r0
+L341: lea L590, r1
+L342: add *r1, *r6
+
+L343: stop
+L344: mov L585, r0
+L345: clr L63
+prn *r4
+mov #206, L49
+prn L436
+sub r0, *r2
+stop
+L346: not r1
+cmp L272, #-71
+L347: not L141
+L348: mov *r7, *r0
+L349: .string "vdrjvgjrpdutevwqixhtre"
+L350: bne *r2
+L351: .string "nxhxvld"
+sub #111, r4
+L352: rts
+not r0
+rts
+jmp *r0
+lea L217, r0
+L353: lea L345, r0
+inc *r2
+L354: sub L225, L178
+L355: red *r6
+rts
+L356: mov #128, r3
+L357: jsr *r5
+
+L358: .string "uhmluun"
+L359: not r0
+L360: not r6
+L361: add L421, L87
+; comment
+L362: jsr L201
+L363: .data -342, -993, -563, 160, 718, -50, -509, -507
+jsr L347
+mov #165, r2
+L364: red *r4
+L365: lea L148, *r0
+L366: rts
+add #-134, *r6
+L367: jsr L392
+prn *r3
+L368: .string "zpswedjyywhtti"
+L369: cmp r4, #-40
+L370: red *r0
+L371: .data -604, 385, -660, -471, 149
+L372: lea L450, L404
+L373: clr L151
+L374: add r1, *r7
+rts
+L375: add *r2, *r3
+L376: jsr *r7
+L377: dec r5
+; comment
+L378: prn L341
+bne *r2
+prn #-12
+rts
+L379: .data 66, -827, 463, -966, -804, 594, 723
+L380: jsr *r3
+not r2
+L381: rts
+not r3
+L382: inc r7
+L383: add #-69, *r0
+L384: .string "kttfqlstvgrqgbfno"
+jmp L84
+L385: .string "bvyd"
+bne *r0
+L386: jsr L197
+; comment
+L387: inc *r7
+L388: bne L495
+L389: jsr L359
+L390: prn *r2
+clr *r4
+L391: add *r7, *r2
+cmp #208, L136
+
+L392: dec L433
+L393: clr L22
+not L313
+dec r5
+lea L135, *r7
+L394: prn #-170
+L395: jmp L236
+inc L408
+L396: add #-11, r3
+cmp *r6, L407
+L397: clr L369
+jsr *r3
+rts
+L398: not L359
+L399: jmp L95
+L400: .string "cfsnm"
+L401: not r4
+L402: prn r0
+dec r4
+L403: cmp L229, #95
+L404: stop
+not *r1
+L405: bne *r6
+L406: add *r3, L495
+L407: mov #-163, r4
+
+jmp L336
+bne L360
+
+L408: bne *r1
+L409: mov *r7, L507
+L410: .string "vdp"
+L411: .string "zvgxhberptngfnckeqkf"
+L412: prn #108
+L413: .string "zetepfvhytumi"
+L414: add *r3, L371
+L415: bne *r7
+L416: .data 256
+dec L584
+L417: stop
+sub r2, *r3
+L418: cmp L447, *r5
+L419: lea L1, r6
+L420: red *r3
+red L515
+L421: cmp *r3, L276
+L422: inc L550
+L423: prn L511
+mov *r5, *r3
+L424: not r7
+L425: prn L448
+add r3, *r3
+L426: bne L581
+L427: sub L429, *r0
+L428: dec r7
+stop
+L429: prn *r6
+L430: inc L489
+L431: jmp *r0
+L432: .string "shhigdfwjvjuxujfec"
+L433: red L76
+add r0, L43
+mov L62, L412
+L434: stop
+L435: dec r6
+L436: .string "foyeckctjhcxbfghtcomncbn"
+L437: sub *r2, L352
+prn L399
+bne L223
+L438: rts
+add #23, r1
+mov r6, *r3
+L439: stop
+L440: dec L89
+L441: sub *r7, *r2
+rts
+L442: bne L465
+L443: mov L463, L204
+L444: sub L456, L362
+bne *r2
+jsr L559
+L445: stop
+L446: jsr L71
+sub L447, L162
+L447: inc *r6
+L448: not L480
+red L187
+L449: bne *r5
+L450: .data -722, 368, -140, -900
+
+L451: .data -650, 403, -394, 890
+L452: .string "hijl"
+L453: prn *r4
+L454: red r1
+dec *r2
+L455: prn #-221
+L456: not L556
+L457: bne *r7
+L458: bne *r4
+prn r1
+add *r2, r0
+L459: jmp *r1
+L460: clr L376
+; comment
+bne *r6
+dec L17
+add r7, r6
+L461: sub r6, r0
+L462: add *r3, L313
+L463: add r1, *r2
+; comment
+L464: rts
+L465: red *r1
+prn L476
+L466: jsr *r3
+jmp *r7
+L467: .data 640
+L468: clr L484
+L469: lea L284, *r7
+L470: cmp *r6, L594
+prn L573
+clr L483
+L471: add *r4, *r5
+L472: rts
+sub #23, *r6
+L473: jmp *r3
+; comment
+L474: mov *r5, L375
+L475: bne L589
+L476: .data -396, -21, -102, 22, -280, -105, -884
+dec L479
+jmp *r3
+L477: stop
+jmp *r2
+; comment
+L478: sub L510, *r6
+L479: jmp L399
+L480: lea L60, r3
+L481: dec r0
+L482: clr L105
+L483: prn r5
+mov #185, r1
+L484: mov r0, r2
+L485: lea L85, L157
+not r5
+L486: jsr *r5
+stop
+L487: dec *r5
+L488: inc r2
+L489: .data 423, -578, -682, -681, -420, -889, 520
+L490: prn L585
+L491: dec r6
+L492: add r5, *r0
+stop
+L493: dec *r4
+L494: sub *r5, L233
+add L540, L104
+cmp #239, #-122
+not r7
+L495: .data -39
+not r5
+L496: mov *r6, r2
+L497: jsr *r2
+; comment
+jsr L148
+L498: .string "fzrkvzgep"
+L499: inc L433
+prn L525
+dec r7
+cmp r2, #-89
+L500: .data 681, -456, 522, 715, 656, -429
+rts
+not L586
+not r5
+L501: lea L158, L419
+L502: lea L510, r4
+; comment
+L503: rts
+L504: inc L59
+L505: bne L594
+L506: stop
+L507: cmp r4, #178
+cmp r4, #-206
+L508: jmp *r1
+L509: jsr L465
+lea L436, *r6
+L510: add *r7, r4
+L511: rts
+rts
+L512: stop
+L513: add #-89, L544
+inc *r2
+L514: .data -252, -953, -244
+lea L461, *r7
+L515: mov #-114, L438
+L516: mov r2, *r3
+L517: .string "gmzficvncvazdxswzjuwn"
+not *r7
+L518: lea L301, L190
+L519: mov *r4, r1
+not *r5
+L520: jmp *r4
+L521: add #-253, *r5
+L522: dec L549
+L523: not L32
+rts
+L524: dec *r2
+L525: .string "iogntcftosohnwljd"
+lea L578, L594
+L526: add *r1, L557
+L527: red *r4
+L528: cmp *r5, r2
+L529: .data -379, -922, -785
+L530: .string "ijue"
+L531: add r5, *r1
+L532: bne L553
+L533: .string "wyx"
+not L571
+not L536
+L534: dec r3
+L535: stop
+L536: rts
+L537: bne L359
+cmp r7, L565
+L538: clr r5
+L539: add L591, *r3
+inc L570
+; comment
+mov L574, *r3
+mov r2, L339
+mov L15, L185
+L540: clr r2
+rts
+L541: add #-193, r0
+L542: .string "ujpgypfxaxjwq"
+stop
+L543: cmp #-92, #15
+
+rts
+add *r4, L549
+
+; comment
+L544: sub L543, r5
+L545: .string "cllbknjquqrrvvcmp"
+L546: red r7
+L547: dec *r1
+L548: cmp L82, r7
+prn *r4
+L549: add #255, *r1
+L550: .string "aljsjj"
+L551: bne L567
+dec L341
+L552: dec *r4
+L553: sub *r7, r0
+red r1
+L554: inc L588
+L555: bne L510
+L556: add #-130, *r3
+cmp #-90, L456
+cmp L470, *r3
+L557: red *r0
+L558: stop
+L559: dec *r0
+L560: cmp #-89, #-221
+L561: red *r6
+red *r3
+not r5
+not r1
+L562: rts
+L563: inc L127
+L564: jmp L593
+L565: jsr L571
+bne L451
+; comment
+L566: add r1, r7
+stop
+add r0, *r0
+L567: not L308
+L568: cmp L583, r5
+stop
+clr r2
+L569: rts
+rts
+L570: sub *r2, *r0
+L571: clr *r1
+L572: .data 730, 880, 710, 465, -930, 187, 665, 825
+rts
+L573: dec *r3
+
+not r2
+rts
+L574: clr *r3
+L575: .string "xntkzqtnowei"
+jmp *r2
+
+L576: .string "yqughgshlywmwbuqlggtscl"
+L577: cmp L583, #100
+; comment
+L578: rts
+L579: rts
+L580: inc L460
+jmp L590
+L581: dec r3
+L582: lea L556, r0
+L583: prn L586
+; comment
+L584: .string "dzylmnwtdpmewu"
+bne *r3
+stop
+L585: jmp *r5
+L586: prn L293
+jmp L594
+stop
+L587: dec *r5
+L588: mov #21, L88
+stop
+L589: jmp *r7
+; comment
+add r7, L371
+L590: add r1, r1
+add *r4, L558
+L591: .string "zzqsnzmlnpcdmvchrniun"
+L592: clr L594
+L593: bne L527
+rts
+L594: bne L369
+stop
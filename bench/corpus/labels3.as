@@ -0,0 +1,1043 @@
+; Generated by genCorpus --seed 4
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+.entry L624
+.entry L640
+L0: add *r7, L478
+L1: bne L1
+L2: .string "prb"
+L3: jsr *r7
+red r1
+L4: .data -936, -569, -790
+not r1
+L5: cmp *r1, r6
+not *r2
+L6: mov #108, L2
+L7: dec r3
+L8: not r4
+L9: clr L515
+mov #-163, *r4
+L10: jsr L57
+L11: jsr *r2
+mov *r6, *r1
+L12: mov #-100, L12
+L13: .data -46, -706, -608, -510, 613, 322
+prn L3
+prn *r7
+L14: inc *r7
+L15: prn #-171
+cmp L132, *r2
+L16: lea L8, *r7
+L17: .string "oqjphtpugz"
+stop
+red r4
+L18: lea L123, *r3
+L19: prn L159
+L20: bne *r2
+add L15, *r7
+L21: prn L340
+L22: .data 645
+L23: jmp *r2
+L24: .data 308, 330, -568, 346, -252, -946, -831, 878
+; comment
+L25: .string "kubgxiuwzsjvrrmrrrktt"
+rts
+L26: lea L123, r5
+cmp L473, #89
+L27: stop
+; comment
+add #207, *r6
+L28: mov L461, r4
+add r5, *r4
+clr r2
+L29: mov r7, r1
+L30: jsr *r0
+jsr L142
+clr L9
+L31: jmp *r1
+L32: prn r4
+L33: jsr L486
+L34: lea L16, r3
+L35: jsr L4
+jmp *r0
+L36: mov r2, L447
+L37: rts
+sub *r3, r0
+L38: jmp L246
+bne *r7
+L39: .string "y"
+L40: jsr L304
+L41: jsr L423
+L42: .data 490, 509, -842
+L43: inc *r5
+L44: dec *r5
+L45: .string "lqbl"
+jmp L38
+prn r6
+stop
+stop
+stop
+L46: add L395, *r1
+L47: jsr *r7
+L48: clr *r5
+L49: add *r3, L302
+L50: sub L476, L538
+L51: .data 834, 31
+L52: cmp r1, r7
+L53: add *r1, r7
+; comment
+L54: .data -47, 244
+add r5, r2
+
+L55: inc *r3
+L56: prn r7
+inc *r3
+add *r3, *r0
+mov *r5, *r3
+L57: jsr L17
+L58: prn L40
+L59: .data 769
+
+L60: red *r1
+not *r5
+L61: .data 401, -654, 616, -894, 752, -554, -390, 488
+lea L56, *r4
+L62: stop
+
+L63: cmp #-121, *r4
+prn *r4
+L64: not r5
+L65: .data -162, 165, -906, 606, -288, -69
+bne L175
+L66: not *r4
+sub r1, L61
+; comment
+L67: bne L251
+L68: red *r5
+prn r5
+L69: dec r1
+dec L453
+rts
+L70: mov r6, *r6
+jmp *r3
+L71: not L70
+L72: prn L544
+jmp L129
+L73: mov r5, L57
+; comment
+add #181, *r6
+L74: .string "ryehqccpcprgpe"
+L75: mov r4, L289
+L76: bne *r1
+L77: jsr *r0
+L78: cmp r4, *r4
+L79: lea L303, L359
+L80: stop
+L81: bne L27
+lea L47, L49
+L82: sub *r6, r7
+L83: inc r5
+L84: red r5
+jmp *r5
+L85: lea L550, r1
+; comment
+L86: prn r3
+L87: sub L17, r6
+sub L315, L22
+L88: not r2
+mov r5, r0
+L89: .string "dmwaipyksjvjnzs"
+L90: prn #255
+L91: not r4
+L92: red r5
+cmp *r0, L320
+L93: lea L327, r1
+L94: sub #-135, L5
+cmp *r7, L70
+inc L360
+L95: lea L76, r5
+L96: bne *r3
+L97: lea L60, *r6
+L98: prn #159
+mov #174, r5
+L99: add *r0, L374
+L100: mov #-198, L511
+L101: dec r3
+stop
+L102: prn r2
+L103: .data 480
+L104: add *r4, *r7
+L105: inc L59
+L106: add L261, L97
+L107: bne *r3
+L108: cmp *r1, L93
+
+L109: .string "oqsvqrpnaaweepnxdhgbx"
+L110: clr r3
+L111: .string "vsgsnfzrd"
+L112: bne *r1
+L113: bne L332
+L114: dec *r2
+add L175, r6
+L115: .data 294, 333, -670, 674, -812, -975
+rts
+L116: prn *r1
+L117: stop
+L118: bne L5
+L119: lea L590, *r5
+rts
+L120: prn r3
+inc L89
+L121: .data -499, -283, -266
+L122: .string "gzkhxhdtmodzfe"
+L123: .data -72, -413, -195, -329, -513, -421, 977
+sub #46, r2
+L124: dec *r4
+sub L36, *r1
+cmp L9, L107
+L125: mov L507, *r2
+L126: prn r4
+L127: prn r1
+not r6
+L128: dec r1
+L129: .data -570, 937, 228, 235, 817, -375, -429, 848
+jmp L392
+jmp *r6
+cmp L607, #-225
+lea L68, *r3
+prn #-231
+
+inc L341
+L130: jsr L75
+L131: .string "clcnzyfuqnlfl"
+sub #-62, *r5
+L132: mov r4, r7
+L133: rts
+inc L497
+L134: not L87
+jmp *r3
+L135: cmp r0, #64
+; comment
+jmp *r7
+lea L149, L53
+L136: mov r6, r2
+L137: .string "xktpydlxugovbc"
+stop
+L138: .data 324, 382, 370, -67, 723
+L139: inc *r7
+bne *r5
+jmp L532
+L140: bne *r6
+L141: sub #152, *r1
+mov r2, L129
+L142: dec *r4
+L143: not r6
+L144: not L64
+L145: not r7
+L146: bne *r1
+stop
+L147: .string "mdmkyqfljpokvznlmsrc"
+L148: bne *r3
+L149: jmp L434
+L150: cmp *r0, #251
+prn *r0
+
+dec L409
+L151: bne *r3
+L152: not r4
+L153: stop
+L154: rts
+jmp *r1
+L155: dec L294
+L156: .string "htgkuyxwkyivsyyfguujjxw"
+L157: prn L65
+L158: lea L506, L99
+L159: add L262, r2
+L160: stop
+L161: .data 138, 779
+L162: add L9, *r5
+L163: prn #-190
+L164: red *r3
+rts
+L165: inc *r7
+L166: .string "hybkacsqfqcayetfnfdgzmii"
+L167: jsr *r0
+not r4
+bne *r4
+L168: not *r6
+L169: red r2
+; comment
+cmp #209, L222
+L170: stop
+rts
+L171: jsr L89
+L172: cmp r0, L613
+rts
+L173: red *r0
+clr r1
+L174: prn *r0
+L175: cmp r2, L67
+L176: rts
+L177: inc L131
+L178: not *r0
+L179: not L25
+L180: sub r3, L85
+; comment
+L181: sub *r2, *r0
+L182: rts
+L183: cmp #-108, r2
+red *r0
+L184: jmp *r1
+L185: bne *r3
+L186: .data -227, 132, -536, 12, -786, -310, 497, -108
+L187: rts
+L188: bne L256
+L189: .string "cgadyzidchtjh"
+L190: inc *r0
+jmp L84
+L191: cmp #197, L23
+cmp r7, #-231
+L192: sub L192, L125
+L193: lea L117, *r0
+L194: clr L381
+L195: .string "hskvcgeykbwhojottqhorwuc"
+L196: rts
+stop
+L197: cmp *r3, L177
+L198: stop
+L199: add L505, L204
+rts
+bne *r0
+; comment
+L200: jmp L302
+sub *r7, r5
+L201: stop
+not r7
+L202: .data -131
+L203: stop
+L204: .string "kgrphzukuooektlynorom"
+L205: cmp *r2, L589
+L206: lea L275, *r5
+L207: inc *r6
+red L132
+L208: rts
+jmp L583
+L209: stop
+lea L622, L114
+red *r3
+L210: jsr L414
+L211: prn #58
+L212: not L47
+add *r4, *r0
+L213: jmp L200
+L214: dec L475
+L215: jsr L211
+bne *r6
+L216: jmp *r5
+red *r1
+L217: dec L44
+L218: .string "mgllktqe"
+L219: .data -116, 551, 566, -193, 567
+L220: .data 157, 360, 887, 590, 539, -666, -209, -632
+L221: lea L331, *r2
+L222: inc L568
+add *r3, *r6
+L223: red *r5
+L224: clr r4
+L225: inc r5
+L226: stop
+L227: .data -217, 566, 191, -381, -416
+lea L285, *r2
+; comment
+mov L135, *r2
+cmp r7, #155
+L228: cmp #-174, L42
+not L457
+sub L189, *r6
+L229: clr *r7
+clr r2
+not L90
+jsr L243
+L230: inc L34
+bne L194
+L231: .data -430, 480
+L232: jmp *r6
+lea L94, r5
+jsr L374
+inc *r2
+L233: rts
+L234: prn L319
+L235: prn r1
+L236: red L4
+L237: jsr *r5
+prn *r5
+rts
+L238: prn *r0
+L239: red *r7
+cmp L3, #252
+L240: rts
+cmp *r7, *r5
+L241: prn L578
+clr L347
+lea L533, r1
+L242: lea L503, r2
+L243: sub *r0, L444
+L244: jsr L231
+L245: clr L555
+L246: .string "bpcmg"
+stop
+L247: stop
+L248: red L305
+; comment
+lea L350, L105
+L249: bne L341
+cmp r5, L444
+L250: sub r1, L210
+L251: bne L481
+L252: sub #-29, *r3
+L253: .data 707
+L254: add L499, r2
+prn *r7
+inc *r4
+lea L619, *r5
+L255: inc L362
+cmp *r2, #-54
+L256: .data 503, -576, -79, 215
+L257: lea L451, L161
+mov #-150, r4
+prn *r5
+L258: cmp r2, r2
+L259: jsr L572
+L260: rts
+L261: jsr L47
+; comment
+jmp *r7
+L262: lea L20, L245
+clr r6
+L263: stop
+L264: dec r4
+
+L265: red L221
+cmp *r3, *r4
+inc *r5
+clr *r1
+lea L392, L162
+L266: mov #-12, *r1
+L267: red L178
+L268: .data -89, 304
+jsr L527
+L269: cmp r1, *r6
+L270: stop
+red r3
+L271: rts
+L272: dec *r5
+L273: prn L58
+sub *r5, *r7
+L274: jsr L420
+L275: cmp *r1, *r7
+lea L557, L119
+L276: .data -425, 951, 909, -17, -123, -281
+L277: rts
+L278: mov #-194, *r6
+prn L295
+L279: jsr *r2
+L280: .data -147, 534, 74, -379
+; comment
+L281: mov *r0, r0
+inc L247
+L282: sub L55, L499
+L283: inc L554
+add #70, *r6
+jmp L527
+L284: cmp L299, r5
+L285: lea L64, *r3
+L286: rts
+lea L222, L603
+not L539
+jsr *r6
+L287: prn L489
+jsr *r3
+lea L36, L523
+L288: rts
+L289: inc r3
+L290: rts
+L291: add L118, r0
+jsr *r5
+
+L292: jsr L237
+L293: bne L92
+L294: .data -527, -213, -271, 370
+
+L295: stop
+L296: rts
+prn L253
+L297: jmp *r3
+L298: .data -862, 181
+jsr *r2
+L299: red r1
+L300: inc r0
+L301: .data 127, 412, -227, 744
+L302: lea L118, *r6
+L303: add L472, *r0
+prn L49
+L304: bne L83
+inc *r7
+L305: red r2
+red r0
+L306: cmp L361, #-55
+L307: dec L308
+cmp r7, L427
+L308: prn #111
+; comment
+clr L376
+prn L38
+not r5
+L309: bne *r1
+clr r7
+L310: add #-201, L239
+L311: mov #-251, r7
+; comment
+stop
+dec *r7
+rts
+L312: rts
+jsr *r1
+L313: add L410, L399
+L314: .string "ohma"
+L315: inc *r3
+cmp #-250, *r6
+sub r5, L340
+L316: add r5, r1
+L317: mov #135, *r1
+L318: .data -564, 264, 188, -149, 283, -964, -557, -268
+L319: bne L627
+cmp #-94, *r5
+L320: jmp L488
+L321: stop
+L322: dec *r6
+sub L488, L530
+L323: cmp #178, L265
+L324: lea L499, L229
+L325: .string "dkwsqfaaavvpgzidjxaqmgd"
+L326: not L556
+L327: rts
+L328: .string "pyiayzvacbdsbmroddds"
+stop
+L329: rts
+; comment
+L330: lea L284, *r4
+dec *r5
+L331: jmp *r6
+L332: lea L332, r6
+L333: rts
+sub L242, r6
+L334: bne L636
+; comment
+L335: clr *r2
+L336: dec *r2
+prn r7
+stop
+L337: red r1
+L338: red *r4
+L339: clr *r1
+L340: clr r2
+jsr L597
+L341: jmp *r7
+stop
+L342: sub #-239, *r5
+L343: red *r4
+mov L499, r2
+bne *r1
+L344: .string "fhurnemgbnpuvkywstko"
+; comment
+L345: .data 500, -44, 519, -9, 115, -861, -560, -920
+L346: jmp *r7
+L347: jmp *r2
+L348: cmp #53, L194
+L349: bne L94
+mov r5, L571
+L350: red L579
+L351: clr L99
+L352: red L77
+red L511
+stop
+bne *r0
+L353: inc r3
+sub r5, L65
+lea L346, L562
+L354: stop
+L355: red L42
+L356: inc L442
+L357: not r4
+L358: dec r1
+L359: clr r3
+L360: sub L474, *r6
+bne L434
+L361: prn #-236
+L362: cmp L43, r5
+L363: bne *r1
+cmp L207, #-20
+L364: .data 378, -512, 486
+mov L342, r6
+L365: dec *r4
+L366: .data 186, -220, 972, 927, -536
+L367: add L514, r7
+L368: .string "fweil"
+L369: .data 643, -583, 495, -743, -936, 888, 974, 897
+L370: inc *r2
+L371: dec *r5
+cmp #-121, *r7
+L372: lea L234, *r1
+L373: .string "dyaeuszoduswojvbgjvrszx"
+jmp L270
+L374: clr L238
+L375: mov #-121, *r3
+; comment
+L376: jmp L193
+inc L406
+not *r0
+L377: .string "vpradu"
+L378: dec r3
+dec *r0
+prn L19
+jsr *r5
+L379: red *r7
+L380: clr r4
+L381: jsr L537
+L382: jsr *r0
+stop
+L383: mov #-245, L186
+add r3, L575
+L384: stop
+cmp *r6, L425
+red L564
+L385: prn r6
+L386: sub *r2, L558
+rts
+jsr L633
+L387: cmp r4, r7
+cmp r0, L442
+L388: .data -822, 323, 947
+L389: .string "grrvdxpjreymgsaqyjtoildg"
+L390: .string "omwh"
+L391: prn r6
+L392: red L62
+dec r1
+L393: jmp *r2
+L394: add L479, r7
+L395: jmp L485
+L396: dec L231
+mov #-61, r7
+mov *r1, r1
+add L420, L92
+L397: inc L553
+jmp *r3
+L398: inc r1
+
+L399: sub #-135, L210
+; comment
+
+L400: mov #-73, *r7
+L401: prn #-111
+jmp L37
+L402: mov *r1, *r2
+L403: stop
+L404: cmp r7, r6
+dec L52
+L405: bne *r0
+L406: lea L205, r1
+L407: .data 543, 356
+mov L554, L517
+rts
+jsr *r5
+L408: inc *r0
+L409: inc *r2
+L410: jmp L40
+L411: add r7, L374
+L412: prn #-66
+red L600
+L413: rts
+cmp L595, L573
+L414: red L629
+L415: rts
+L416: stop
+; comment
+L417: cmp *r4, #-100
+inc r4
+L418: not L625
+stop
+L419: rts
+jsr L221
+L420: jsr L331
+L421: .data -529, 486, -405, 102
+L422: clr *r3
+L423: inc r4
+
+; comment
+L424: .string "udxtuclyykccvvyldwxkkzsh"
+not r5
+L425: clr L426
+L426: add #25, L536
+jmp L281
+L427: prn #65
+L428: cmp L515, #245
+L429: .string "rviospexihvqawwblbdcvr"
+jsr L254
+L430: clr L202
+L431: sub #185, r1
+L432: clr L439
+L433: not *r7
+red L353
+cmp *r2, L471
+
+L434: clr L396
+L435: inc L469
+L436: jmp *r2
+; comment
+L437: mov r1, L76
+L438: .string "svietknesi"
+L439: lea L476, r7
+L440: .data 480
+clr r0
+jsr *r1
+L441: cmp r0, #60
+L442: dec r1
+sub #-45, L633
+jmp *r0
+L443: lea L426, L635
+bne L119
+L444: bne L550
+L445: .string "kqmb"
+L446: prn L125
+L447: clr L579
+L448: dec r6
+L449: clr *r5
+L450: jmp L286
+L451: jsr *r6
+L452: sub #-191, r4
+L453: red *r4
+L454: not r7
+red L215
+L455: lea L538, L531
+L456: stop
+sub L284, r3
+
+; comment
+L457: bne *r0
+mov r0, *r7
+L458: cmp L327, #-211
+not r2
+cmp #68, *r0
+L459: lea L531, L55
+L460: inc *r4
+L461: rts
+bne L341
+L462: sub r3, L546
+L463: sub L196, L419
+L464: dec r7
+L465: red r2
+L466: .string "dbg"
+add r6, *r1
+
+L467: bne *r1
+; comment
+L468: .string "qoodhaztfhzlxrfw"
+L469: stop
+L470: lea L243, L326
+cmp L579, #-234
+
+L471: dec r0
+L472: jmp *r6
+L473: cmp r2, #-167
+L474: jmp L540
+L475: cmp #56, L535
+L476: dec L335
+prn r3
+bne L350
+jmp L164
+L477: not r7
+L478: .data 950, 214, -854, 791, -129, -187
+L479: .string "aotdi"
+L480: prn r4
+L481: rts
+L482: .data 145, 60, 155, 71, 12, -933, -178, -875
+sub r3, *r2
+L483: mov L635, r7
+L484: jmp L155
+L485: lea L228, *r4
+jmp L576
+L486: .string "svwcqzic"
+L487: stop
+L488: stop
+
+L489: .string "rueslciwnhpklkzox"
+L490: add L498, r7
+L491: .data -628, 149, 369, 246, -266, 803, 942
+L492: jmp *r7
+L493: jmp *r4
+L494: dec L23
+jmp L41
+L495: sub L322, L107
+L496: .data -211, 199, 969, 294, 324, 566, -581
+L497: .data 93, 969, 864
+dec L166
+L498: prn *r3
+L499: rts
+L500: not *r6
+L501: not L609
+; comment
+L502: add r7, r1
+L503: prn *r0
+L504: clr L74
+L505: sub L633, *r0
+L506: not r2
+L507: prn r2
+L508: lea L393, L544
+L509: inc r2
+jsr L317
+L510: prn r1
+mov r1, L124
+L511: bne L503
+L512: jmp *r4
+L513: clr *r6
+L514: prn L209
+L515: stop
+clr *r7
+rts
+L516: stop
+not L96
+L517: cmp *r3, L444
+L518: rts
+L519: jsr L585
+L520: bne L640
+dec L521
+jsr *r4
+mov *r5, L608
+rts
+L521: .data 730, -616, -930, -762, 939, 956
+add r7, *r0
+L522: bne *r3
+L523: .data -900, -237, 282
+jmp L613
+jsr *r0
+L524: mov #239, r7
+jsr *r6
+L525: prn r7
+L526: jmp *r2
+L527: prn L261
+L528: rts
+L529: .string "xtmibosndiwqsrinzw"
+L530: .string "clevryjmcpdu"
+jmp *r1
+add r4, L429
+L531: jsr *r4
+L532: stop
+bne *r7
+L533: jmp L559
+L534: stop
+L535: .data -817, 551, 924, -536, -590, 449
+mov #124, r3
+L536: mov *r6, *r4
+L537: prn #231
+L538: sub r3, *r4
+mov r2, L561
+L539: dec L361
+L540: add L261, L333
+L541: lea L550, r7
+L542: stop
+rts
+L543: inc L44
+L544: bne *r4
+L545: jmp *r6
+clr *r3
+L546: .string "xqennxhwbzffoozsr"
+L547: not *r2
+mov r6, *r5
+L548: stop
+add #-4, L610
+L549: .data -442, -327, -206
+L550: sub #124, *r1
+L551: inc L190
+L552: dec *r6
+L553: cmp *r2, #-75
+L554: jsr L628
+; comment
+L555: dec r0
+L556: lea L613, *r0
+prn L640
+red *r4
+L557: prn *r7
+L558: dec L566
+cmp #45, #-134
+L559: inc r1
+L560: jsr *r2
+clr *r5
+L561: mov L11, *r2
+L562: jmp L567
+
+L563: lea L376, *r7
+L564: stop
+stop
+L565: jmp L616
+L566: .string "gwgqzqqxczwdizd"
+bne L634
+stop
+L567: .string "tboznottovbfpntic"
+L568: dec r0
+clr L171
+L569: bne L419
+L570: clr r2
+add *r5, r1
+rts
+L571: .data 499, -837, 176, -88
+stop
+not *r0
+L572: inc L635
+L573: clr *r5
+bne L311
+stop
+L574: jmp L587
+L575: add *r2, *r6
+clr *r5
+L576: sub r7, L612
+bne *r7
+cmp L382, L600
+jmp L606
+; comment
+jmp L619
+L577: bne L590
+L578: stop
+L579: sub L582, r5
+L580: lea L626, L46
+L581: sub #-165, L621
+L582: not *r6
+dec L99
+dec r7
+L583: mov r3, *r2
+L584: not L548
+L585: jsr L503
+L586: red L637
+red *r4
+L587: prn L596
+add *r5, r0
+jmp *r3
+add r6, r2
+L588: clr r3
+jmp *r5
+L589: inc r7
+dec *r1
+L590: .string "maogu"
+
+L591: .string "lpnijp"
+L592: mov L148, L395
+L593: jsr L619
+L594: jmp L219
+not L623
+L595: bne L572
+L596: stop
+L597: jmp L477
+L598: red r3
+not *r4
+not r3
+jsr L607
+L599: rts
+bne L617
+; comment
+L600: prn r2
+L601: lea L286, L638
+red L94
+not L613
+L602: lea L28, L253
+jmp *r1
+L603: lea L608, r4
+L604: jsr *r1
+L605: not L206
+jmp *r4
+L606: .string "klzke"
+L607: jmp L615
+L608: mov #-22, r3
+L609: .data -507, -753
+L610: jmp *r1
+inc *r4
+L611: add r7, L630
+L612: rts
+L613: mov #-89, *r3
+L614: lea L622, L527
+; comment
+cmp #-74, *r1
+L615: .data -286, 410, 369, 227, 23, -514, -952, 368
+L616: .data -552, -105, 960, 430
+L617: red *r6
+sub r3, *r5
+L618: .string "svnqnriskinrgjbhhwobs"
+dec r1
+L619: inc L638
+L620: jmp *r4
+L621: .data 807, -553, -460, 332, 945, 752, -185, 855
+L622: not L507
+L623: cmp *r2, r2
+red r6
+L624: jmp L627
+inc L635
+L625: rts
+L626: mov L588, r2
+sub r2, *r7
+L627: lea L635, L633
+not r0
+sub #185, L445
+; comment
+L628: sub r4, r7
+cmp r1, #251
+L629: mov L48, *r1
+L630: add r5, r7
+L631: mov r6, *r3
+clr L632
+L632: prn #237
+L633: sub L638, *r2
+clr L290
+dec *r7
+L634: cmp *r5, r7
+L635: inc r2
+L636: not r7
+L637: lea L191, r7
+L638: inc r7
+L639: lea L640, r2
+L640: dec L620
+stop
@@ -0,0 +1,1040 @@
+; Generated by genCorpus --seed 31
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+L0: .data -336, 949, 35, -418
+L1: .string "ixftvgovnmxdjvvefyohuity"
+not r6
+bne *r3
+L2: sub *r4, L0
+L3: sub *r5, r1
+jsr L525
+L4: jsr L1
+jsr L270
+L5: jsr L0
+L6: lea L1, *r5
+L7: prn #-203
+; comment
+L8: rts
+
+L9: add *r4, L347
+L10: inc L4
+L11: not L8
+L12: cmp #-218, *r5
+rts
+L13: dec L89
+not r6
+L14: stop
+cmp L430, #-129
+L15: .data -68
+mov #89, r6
+not *r2
+clr *r6
+L16: prn L0
+L17: jsr *r0
+L18: rts
+L19: prn #6
+not *r6
+L20: prn *r7
+red *r1
+cmp *r2, *r2
+jsr L285
+L21: red L21
+L22: rts
+bne L20
+L23: bne L595
+inc r5
+L24: .string "fcirxclvrxegyiuqulai"
+sub L19, *r6
+L25: stop
+red r4
+L26: dec *r0
+L27: stop
+L28: .data -841, -747, 640, -788, -543, 810, -233
+stop
+L29: .string "ikemalxjzfsfatpz"
+red *r3
+L30: add *r0, r5
+stop
+L31: .string "fouo"
+L32: bne L16
+red L11
+L33: .data -721, 465, 495, -337, 331, -452, 696
+red L3
+L34: not *r1
+jsr L432
+L35: lea L395, r1
+prn r6
+L36: add L26, L21
+L37: prn *r2
+bne L28
+L38: stop
+L39: prn r1
+L40: red r0
+L41: jmp L38
+sub #152, r2
+L42: stop
+L43: rts
+L44: add #-30, r4
+L45: dec r0
+L46: mov r2, L41
+L47: inc L504
+L48: add *r4, r0
+L49: dec r7
+inc L564
+L50: clr L316
+L51: dec L84
+L52: .string "iizogpz"
+L53: .string "sqewvhlevrvxrdrdjblsn"
+L54: .data -390, -71
+L55: jmp *r2
+sub L4, r1
+L56: cmp #72, #-44
+not L193
+L57: jmp L16
+L58: bne *r5
+L59: sub #165, *r2
+L60: clr r2
+lea L281, L22
+L61: not *r6
+bne L553
+; comment
+L62: red r1
+L63: clr r2
+L64: bne L496
+; comment
+L65: lea L33, L42
+mov r0, L69
+stop
+L66: red r0
+red *r4
+inc *r5
+L67: add r6, *r6
+; comment
+red L381
+red L572
+L68: prn r6
+lea L30, r7
+L69: red r6
+L70: mov #161, *r0
+L71: stop
+clr *r7
+
+
+rts
+L72: add #187, *r3
+
+bne L246
+L73: dec *r3
+L74: .string "wtzzlt"
+jsr L238
+jsr L73
+jsr L140
+L75: jmp L61
+L76: not L37
+L77: mov #-124, *r7
+L78: prn *r6
+L79: mov L210, L44
+L80: cmp *r5, r0
+L81: sub *r3, r4
+L82: mov *r6, r6
+L83: bne L276
+L84: mov #-77, r6
+L85: sub #195, L53
+L86: .string "hphremyvicbeucv"
+red *r1
+L87: lea L251, L2
+L88: not r7
+L89: cmp L50, L587
+L90: add r2, *r6
+mov *r7, *r1
+L91: bne *r6
+L92: red r1
+L93: dec *r2
+L94: not L28
+L95: rts
+rts
+
+L96: stop
+rts
+clr *r5
+L97: stop
+L98: jmp L59
+L99: dec L405
+L100: add #-75, r1
+L101: inc L91
+inc *r5
+L102: bne *r3
+cmp *r2, *r1
+L103: clr r5
+L104: mov L469, r4
+jmp L51
+L105: bne L401
+L106: mov *r5, r2
+L107: clr r4
+L108: jmp *r7
+L109: mov #-245, *r5
+L110: stop
+L111: mov L128, *r2
+L112: inc *r6
+L113: .string "rhsmg"
+L114: stop
+L115: jsr *r3
+L116: not L279
+rts
+L117: .data -533, -883, 337
+; comment
+L118: jmp *r4
+lea L394, *r2
+inc L103
+L119: inc L29
+L120: sub L78, *r3
+L121: .data -830, 511
+jmp *r0
+sub r7, r1
+L122: clr L393
+
+L123: sub *r7, *r2
+jmp *r6
+clr L350
+bne L93
+jsr *r6
+L124: jmp L556
+L125: inc r6
+L126: jmp L537
+
+add L104, L33
+L127: jsr *r1
+L128: .string "fls"
+dec L87
+
+bne L25
+cmp L374, r6
+L129: dec *r2
+L130: not L221
+L131: rts
+L132: mov L402, *r1
+L133: cmp *r2, *r5
+L134: bne L463
+L135: cmp #-97, L183
+L136: jsr *r6
+mov *r3, r3
+L137: lea L432, *r2
+prn r4
+L138: clr L595
+inc L174
+L139: rts
+L140: rts
+L141: add r1, r0
+L142: jmp *r0
+jmp L38
+L143: sub r7, *r5
+L144: inc L99
+L145: add r1, r0
+L146: mov r3, *r0
+red r7
+L147: .data -307, -328, 780, -294, -383, 464, 753, -591
+mov *r6, r7
+L148: .string "phrhlcvlwbwehhvghwjgqp"
+L149: jsr L94
+; comment
+L150: red L68
+; comment
+mov *r2, L134
+L151: prn L312
+prn #17
+L152: prn *r4
+sub *r6, L21
+lea L34, r6
+L153: lea L604, *r1
+bne L157
+not L78
+lea L55, L3
+L154: not r5
+jmp L420
+L155: .string "fieepbyzkacuwfakpthxckxy"
+rts
+dec r5
+L156: prn r5
+jsr L545
+jsr *r0
+L157: dec r7
+L158: .data -459, 169, -327, -374, 189
+L159: clr L488
+L160: jmp L317
+; comment
+L161: jmp L235
+dec L109
+L162: clr *r1
+jsr L54
+L163: red *r0
+; comment
+L164: .string "rj"
+bne *r0
+L165: not L150
+L166: clr *r5
+stop
+red *r5
+L167: jmp L70
+L168: mov r7, *r5
+L169: cmp #11, *r1
+add L512, L325
+
+; comment
+L170: mov *r1, L585
+stop
+jsr L532
+clr *r1
+L171: clr r7
+L172: clr r7
+L173: not L333
+L174: jsr L508
+L175: jmp *r1
+; comment
+L176: clr r2
+L177: mov *r1, r6
+L178: dec *r6
+clr *r0
+L179: stop
+L180: mov r1, L14
+red L75
+L181: inc *r7
+L182: lea L354, L450
+lea L394, *r6
+L183: jsr L275
+L184: not *r7
+L185: bne *r1
+L186: lea L85, r6
+add r3, r6
+L187: red *r7
+L188: prn L172
+; comment
+L189: mov r4, r7
+L190: dec r4
+red L504
+inc L590
+L191: stop
+sub *r1, r3
+L192: not r1
+L193: dec *r1
+
+L194: .string "zmyqkoalzjfqkswkx"
+; comment
+L195: jmp L213
+L196: .data 223, -808
+L197: jmp *r5
+clr r4
+sub #49, *r3
+L198: dec L584
+L199: .data -4, -585, 329, 578
+red r1
+L200: not r2
+jsr *r6
+red L548
+L201: prn *r1
+rts
+jmp *r6
+L202: add L528, r2
+L203: sub r2, *r6
+L204: bne *r0
+add r1, r3
+L205: lea L35, *r2
+cmp *r2, *r5
+L206: bne *r4
+; comment
+
+sub r3, *r6
+jmp L201
+prn r7
+stop
+lea L54, *r4
+L207: jmp *r6
+lea L33, L34
+mov L136, r1
+L208: bne L161
+red *r7
+L209: dec *r7
+L210: prn #34
+rts
+L211: sub L125, r4
+L212: rts
+dec *r2
+L213: stop
+lea L285, L467
+L214: stop
+L215: inc *r0
+L216: bne L351
+jmp L573
+stop
+L217: not r4
+jmp L229
+L218: dec r0
+add #-70, *r2
+L219: bne L250
+lea L594, r6
+L220: .data 995, 169, -76, 409, -698, 457
+L221: .data -572, -265, 953, 887
+inc *r1
+L222: .data 75, -830, 780, 991, 542, -520
+L223: bne *r5
+
+
+L224: red r2
+jsr L501
+L225: lea L44, r2
+L226: mov L304, *r3
+L227: .string "wdqfwdpyaywwqai"
+not *r3
+L228: prn L601
+L229: .string "fhdjjodivxsn"
+L230: mov #160, L172
+L231: .string "epwkxnuuvcjagrgg"
+stop
+L232: not L459
+clr *r2
+L233: jmp L94
+L234: inc *r3
+L235: rts
+dec L124
+L236: inc L101
+bne L76
+L237: prn *r4
+prn L392
+L238: cmp *r3, #-256
+L239: rts
+L240: jsr *r5
+stop
+not *r3
+L241: lea L54, L153
+sub L184, L343
+sub #-200, r0
+L242: sub L368, r0
+L243: red L583
+L244: red *r2
+L245: stop
+stop
+L246: mov *r0, *r0
+L247: jsr L528
+L248: stop
+mov #-190, L160
+bne L135
+prn r2
+red r3
+not *r6
+mov #-2, r5
+prn L14
+
+L249: cmp L276, #-105
+L250: lea L108, r2
+L251: not r4
+L252: dec r1
+L253: lea L274, L398
+inc r0
+L254: stop
+L255: .data 807, 340, 357, 127, -301
+
+L256: bne *r0
+L257: lea L217, r6
+L258: dec r3
+L259: .data -458, -995
+bne L518
+L260: dec r7
+not *r4
+L261: cmp r1, r6
+prn #-208
+lea L74, L403
+L262: jsr *r0
+not *r4
+L263: sub #249, r0
+clr L179
+L264: stop
+L265: prn #83
+L266: add r2, L211
+L267: rts
+not r7
+L268: .data -361, 171, 160
+L269: jsr *r3
+L270: clr L350
+L271: jmp *r1
+L272: add L50, r4
+L273: lea L19, L592
+L274: add r2, L150
+L275: prn #190
+L276: sub *r0, L182
+L277: not r2
+L278: jsr *r4
+lea L90, L145
+
+L279: rts
+L280: add L356, r5
+L281: inc *r0
+mov #-127, *r4
+cmp *r1, *r5
+L282: jsr L360
+prn #114
+L283: red L161
+L284: cmp L74, L361
+L285: rts
+rts
+L286: clr L326
+L287: lea L52, L291
+dec *r0
+rts
+
+L288: prn #80
+jmp *r6
+prn *r5
+add r4, L463
+bne L604
+L289: rts
+L290: jsr L346
+L291: dec L452
+L292: rts
+prn #-89
+L293: lea L207, r3
+L294: stop
+mov r5, *r4
+jmp *r4
+L295: bne L253
+L296: inc r4
+L297: cmp #-124, r6
+L298: .string "refnvtmzyhai"
+L299: rts
+L300: not r0
+L301: rts
+rts
+L302: red *r0
+L303: jsr *r5
+L304: not *r5
+mov L308, *r4
+L305: rts
+L306: .string "dkrlgadqrkfhijkqpog"
+L307: prn r1
+L308: lea L158, L89
+not r2
+L309: rts
+mov r7, r7
+add #-194, L288
+cmp L494, L297
+L310: add r0, r5
+; comment
+L311: not r2
+jmp *r6
+L312: lea L340, r5
+prn L280
+L313: cmp r0, *r4
+dec L515
+
+red *r7
+dec *r7
+L314: red L186
+L315: clr *r2
+L316: sub L492, *r3
+L317: lea L516, L251
+L318: red *r0
+jmp *r2
+L319: add r5, *r0
+rts
+L320: .data 186, 116, 847, -826, -462
+clr *r6
+jmp *r4
+L321: jmp L563
+stop
+; comment
+L322: bne L222
+L323: jsr *r2
+jmp L193
+inc *r2
+jmp L36
+jsr *r6
+L324: dec r2
+L325: prn *r3
+rts
+L326: dec r5
+cmp *r6, r1
+mov L134, L354
+L327: stop
+L328: red L473
+sub *r4, L430
+L329: prn *r4
+L330: clr *r1
+L331: .string "qkextxfoxucsmwho"
+cmp r0, L380
+L332: jsr L125
+L333: inc *r7
+L334: .data -836, 795, 834
+not *r3
+lea L117, *r5
+; comment
+L335: prn #217
+L336: prn L138
+L337: .data -120, 570, 519, -84, 626, -958, -561
+L338: prn r3
+lea L301, r6
+L339: lea L41, *r7
+L340: jmp L233
+sub *r2, L3
+L341: clr L106
+L342: sub r3, r7
+L343: rts
+jmp *r6
+L344: add #-141, L368
+prn L65
+cmp #-135, L108
+L345: sub *r0, L488
+L346: inc L58
+cmp r5, #-99
+L347: rts
+L348: sub L177, *r4
+dec *r6
+inc r7
+L349: .data 250, 831, 845, 72, -892
+sub L396, L389
+L350: rts
+bne L168
+L351: cmp L549, #-244
+L352: inc *r0
+cmp #-17, #164
+L353: add L391, *r0
+add #-131, r4
+L354: bne L333
+L355: cmp #142, L444
+L356: .data 104, 1, 360, -494
+L357: lea L254, *r1
+stop
+L358: cmp *r5, L567
+L359: not L383
+stop
+L360: rts
+L361: inc r1
+L362: dec r2
+L363: rts
+L364: jmp L339
+L365: .string "wrfnshxbnnodkshbvancwhdw"
+L366: lea L262, r7
+L367: red r4
+jsr L181
+L368: .data 183, 149, -72, 743, 113, -35
+L369: jmp *r5
+L370: cmp r0, r7
+L371: jmp L570
+
+L372: lea L552, *r2
+sub *r0, r1
+L373: red L444
+L374: dec r0
+L375: not r0
+mov r1, L430
+L376: clr r2
+L377: lea L143, *r2
+L378: mov *r0, r5
+stop
+sub *r5, r5
+stop
+L379: rts
+; comment
+L380: lea L535, *r2
+L381: mov r7, *r0
+clr *r1
+rts
+L382: inc r6
+L383: cmp r0, r7
+jmp *r7
+not r5
+L384: lea L239, L370
+L385: dec r3
+clr *r5
+L386: rts
+red r5
+L387: .string "jcoxiqmdbczjyvwpk"
+rts
+inc r4
+L388: .data -806, 145, 448, -948, -944, -681, 537
+inc L587
+L389: add L606, r0
+L390: clr *r0
+not *r3
+L391: stop
+; comment
+cmp L314, r5
+sub *r6, r4
+prn r0
+inc r5
+L392: .data 952
+L393: .data -966, -712, 392, -312, 605, 81, -63
+L394: mov r1, r5
+L395: red r7
+
+cmp *r0, *r7
+L396: .data 109, -868, 790, -365, 755, 540
+dec L472
+L397: mov L319, *r4
+L398: .string "tmatmnquq"
+not r6
+clr *r2
+L399: sub L477, r0
+L400: clr r7
+L401: not L420
+; comment
+L402: .data 716, -921, -98, -399, 172, -653, 304
+; comment
+L403: jsr *r6
+L404: jsr L19
+add #-4, L583
+L405: mov r3, r5
+L406: cmp L387, #-112
+L407: dec r7
+stop
+mov r1, r3
+L408: .string "dfyy"
+sub *r0, L13
+add L294, r1
+L409: add *r0, r6
+L410: clr r3
+inc L137
+L411: .string "kwlqqxwmncursyibyapv"
+lea L48, L502
+cmp L547, L527
+bne L486
+L412: red L457
+L413: lea L569, r0
+L414: jsr L58
+L415: clr L490
+L416: .data 505, 372, -87, 821, 812
+L417: add *r0, L539
+not r2
+L418: .string "psrxfgkchigkwcs"
+L419: stop
+sub L6, L434
+L420: prn r2
+L421: clr *r4
+add r1, r4
+L422: add r6, L346
+
+L423: cmp L363, *r7
+jsr L144
+L424: .data -585, 962, -545, -968
+sub #-86, r0
+
+
+L425: jsr L265
+rts
+L426: sub #251, r2
+stop
+lea L523, r0
+L427: mov #240, *r5
+L428: clr *r2
+L429: lea L231, *r2
+L430: prn *r1
+prn #190
+L431: add L476, *r5
+L432: dec L293
+L433: stop
+not *r6
+L434: mov L508, *r4
+clr r7
+stop
+lea L493, L117
+clr L507
+L435: not L190
+L436: rts
+L437: not *r3
+L438: stop
+L439: not *r1
+inc *r3
+L440: bne L456
+L441: red r4
+L442: jsr L498
+bne L572
+L443: mov r5, L364
+L444: rts
+L445: clr *r0
+mov *r1, *r2
+rts
+L446: jsr *r7
+add *r4, r4
+L447: .data 959, 458, 316, 942
+L448: red *r0
+L449: cmp r2, *r1
+L450: red L602
+L451: .data -294, 750, -277, 895, 120, 142
+L452: .data 242, -632, 430
+L453: stop
+
+L454: not *r6
+; comment
+prn *r2
+dec *r2
+sub #215, L520
+L455: jmp L58
+jmp L498
+L456: jmp *r0
+sub *r5, r7
+L457: red L547
+L458: add *r7, L518
+L459: rts
+dec *r0
+L460: dec L310
+L461: mov *r6, r5
+jsr L466
+L462: not r1
+L463: prn r4
+mov *r1, L143
+stop
+L464: inc r2
+L465: .data 741, -597, -162, 615, -222, 702
+sub *r3, r0
+inc L220
+L466: .string "w"
+prn r1
+L467: red r2
+L468: dec L452
+L469: rts
+inc L272
+mov r2, r5
+not r7
+L470: .string "mos"
+L471: inc L56
+L472: not L504
+; comment
+L473: inc L542
+L474: clr L328
+L475: stop
+add #93, r5
+L476: prn L491
+lea L505, *r5
+L477: .data -560, -601, -226
+jmp L160
+L478: bne L535
+L479: not *r7
+sub r3, r4
+L480: .data -125, 294, -661, -571, 935, -838, -520, -591
+prn #-31
+; comment
+prn L598
+L481: .string "kmdmqzzfzh"
+L482: jsr *r7
+L483: cmp *r5, *r3
+L484: not L301
+L485: .string "wquaej"
+L486: stop
+L487: clr *r6
+L488: bne *r6
+cmp L578, r4
+L489: .string "utaglnhsoieqlswnevizh"
+not L164
+L490: lea L499, r3
+L491: add r4, L573
+L492: jmp L530
+L493: mov #41, *r7
+; comment
+rts
+inc L481
+L494: cmp *r7, r2
+clr r4
+L495: cmp r0, L445
+L496: jsr *r0
+L497: not *r2
+L498: jsr *r6
+add r7, r6
+L499: inc L155
+L500: red L580
+L501: inc r4
+L502: add *r6, *r1
+L503: clr *r5
+L504: rts
+L505: prn *r3
+cmp L285, r6
+rts
+L506: .string "vnbkmddcqkqfzbvmenhxaj"
+L507: dec L545
+L508: mov L309, r5
+L509: sub #-121, L114
+L510: lea L207, r3
+L511: dec *r1
+stop
+not L176
+L512: .string "fyhvalgldlfkwjyhsxuetjf"
+L513: sub L148, *r0
+jsr L542
+; comment
+; comment
+bne L564
+L514: not r0
+cmp #-200, L222
+L515: dec L364
+mov r0, *r3
+L516: .string "njhmsfyjuajmllxwwwthkr"
+cmp #192, L231
+L517: clr r4
+L518: lea L41, r1
+L519: add r4, *r0
+inc L497
+L520: add #-120, *r2
+dec r3
+lea L570, *r4
+L521: jmp L119
+
+
+L522: sub r5, *r6
+L523: rts
+L524: cmp L496, #71
+L525: .string "dwkexdlfudlccyeiiqpcj"
+L526: rts
+L527: jmp L587
+L528: inc *r4
+clr *r7
+L529: jsr *r2
+L530: .string "mawdlbxwg"
+L531: lea L548, r5
+L532: .data 598, -976, 328, -183, -824
+rts
+bne *r2
+L533: cmp L347, #-37
+red r1
+clr L605
+L534: not *r7
+L535: .string "caluddlghketfxiurxpetnm"
+clr r6
+L536: cmp #169, L536
+L537: inc r0
+L538: inc *r0
+jsr L605
+L539: mov L553, r4
+L540: .data 739, 778, 922, -423
+dec L269
+L541: stop
+L542: inc r5
+L543: add L566, r1
+inc r2
+L544: clr L407
+
+L545: sub #61, L118
+inc *r0
+L546: .string "dnkcxavwapt"
+L547: not r4
+L548: add L553, L508
+cmp *r1, r2
+clr L567
+L549: bne L304
+L550: jmp L588
+L551: .data 917, -391, -303, -934, 644, 323, 979, 967
+mov r6, *r7
+L552: cmp *r5, r4
+L553: dec *r1
+L554: jsr *r0
+bne *r4
+L555: rts
+
+L556: inc r2
+L557: clr L373
+clr r6
+L558: not L572
+
+L559: prn *r6
+L560: prn #38
+L561: .string "whjrzgeqzigh"
+mov L582, *r5
+L562: red *r2
+L563: dec r0
+L564: clr L578
+L565: stop
+inc r4
+L566: cmp *r2, #184
+L567: lea L448, *r3
+not *r5
+not *r2
+L568: inc *r7
+L569: .string "dcwczkvcj"
+L570: clr r0
+L571: add L214, r6
+L572: mov #-21, r5
+clr L457
+L573: jmp *r0
+L574: dec *r6
+; comment
+prn #184
+stop
+L575: not L598
+L576: clr r1
+dec r7
+L577: bne L151
+L578: prn #167
+L579: .string "iypvgbyhf"
+L580: bne L432
+L581: prn *r0
+
+sub #12, *r0
+L582: .string "ukrhankqsrru"
+lea L331, r6
+not r5
+L583: .data -661, -73, 635, -725, 2, 592
+L584: inc L602
+L585: jmp L282
+L586: jmp *r3
+L587: prn #-187
+L588: inc r4
+L589: clr *r0
+; comment
+jmp L546
+L590: clr *r7
+L591: clr r1
+bne *r7
+L592: jmp *r7
+
+L593: red r5
+L594: sub #240, L253
+L595: rts
+L596: not r3
+not r5
+red *r6
+dec r2
+L597: lea L543, L234
+L598: .string "amybtlnithtwcdt"
+L599: .data -182, -321, -783, -500, -862, 649, -995
+L600: mov L476, *r3
+L601: bne L151
+L602: lea L267, r2
+L603: inc r4
+L604: lea L133, *r1
+L605: rts
+inc L607
+L606: bne *r6
+L607: stop
+bne L461
+stop
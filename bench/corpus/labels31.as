@@ -0,0 +1,1041 @@
+; Generated by genCorpus --seed 32
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+L0: mov #101, r0
+L1: stop
+L2: mov L91, *r1
+L3: not r0
+L4: sub *r3, *r7
+bne *r5
+L5: .string "sskfrypix"
+L6: .string "rgguclqzmjfsdidgdscj"
+L7: prn *r7
+; comment
+L8: stop
+L9: bne L8
+L10: dec r3
+L11: rts
+L12: jmp *r6
+add r2, L299
+jmp *r1
+L13: .data -315, -692, -783, -541, 880
+rts
+jsr *r0
+L14: .data -652
+L15: jsr *r7
+L16: .data 280, 472
+L17: sub L221, r5
+L18: cmp *r0, #243
+L19: sub L5, *r2
+bne L581
+L20: rts
+L21: mov r4, r7
+bne *r0
+L22: .data 543, 928, 293, -448
+L23: cmp #18, #101
+L24: .string "oxnnyfqkeqn"
+L25: dec *r5
+L26: inc L9
+L27: sub L458, r6
+L28: clr r5
+inc r4
+jmp L78
+L29: .data 521, -463, 818
+rts
+add #162, r0
+L30: rts
+prn L13
+mov *r7, *r7
+L31: sub L349, *r3
+L32: clr *r2
+prn *r7
+L33: .data -386, -921, 470, -123
+add r5, L297
+bne *r2
+L34: sub *r5, *r4
+L35: bne *r6
+L36: cmp #210, *r4
+L37: clr L0
+L38: bne *r1
+L39: sub *r7, *r0
+; comment
+lea L294, L33
+inc r1
+L40: add #-68, L280
+L41: .data 624, 858, -258, 660, 239, -493, 368
+L42: sub r1, L42
+add L32, r3
+L43: mov *r2, L6
+L44: clr *r5
+
+mov #55, r2
+L45: prn *r3
+L46: .string "hiitbfz"
+clr L296
+L47: cmp #-26, #155
+L48: sub L30, L523
+L49: .string "mflcntkbcymypfl"
+L50: sub r3, r6
+jsr L32
+mov r2, r4
+L51: rts
+jsr *r1
+jmp L46
+L52: mov L456, L385
+
+mov #146, L18
+L53: jsr L18
+L54: lea L18, *r7
+
+L55: jmp *r1
+L56: rts
+
+L57: mov #-235, L331
+L58: inc L111
+; comment
+inc r4
+red r6
+L59: rts
+jmp L143
+L60: bne *r2
+mov *r5, L300
+L61: inc L100
+L62: .string "xzcuuzifrtueaihih"
+dec L246
+L63: sub L239, L255
+jmp L150
+L64: not L584
+L65: lea L3, L564
+stop
+L66: .string "vam"
+L67: not r4
+
+L68: .string "ojnyevef"
+L69: .string "basyjjwbeiuirfxrbhqg"
+L70: lea L160, *r7
+L71: red L376
+L72: stop
+not *r7
+L73: cmp r4, L4
+L74: not L71
+L75: stop
+inc *r5
+L76: stop
+L77: dec r0
+L78: jsr L54
+L79: clr r5
+L80: add #237, L37
+L81: dec *r3
+L82: inc r0
+L83: cmp #-196, *r6
+stop
+rts
+L84: .string "hlmgemvcqdymyyntmssoreni"
+L85: clr *r2
+L86: add r7, *r5
+L87: mov *r6, r0
+L88: lea L503, r1
+L89: red r0
+inc r7
+sub *r4, L78
+prn *r2
+L90: clr *r2
+L91: lea L542, L283
+L92: bne L37
+stop
+L93: not L4
+add r6, r6
+L94: inc *r6
+jmp L6
+L95: not r5
+L96: clr *r0
+add #125, L84
+bne L188
+not r5
+L97: dec L616
+L98: red L74
+red L328
+L99: rts
+L100: bne L460
+L101: .data 484, 682, -672, 744
+L102: .data 839, 854, -384, -1, -96, -333
+L103: sub *r4, *r4
+L104: .data 721, -681, 479, -252, -791, -269, 649
+lea L20, L19
+L105: lea L232, r5
+L106: bne L568
+add L16, r7
+lea L584, *r1
+red r3
+L107: cmp r2, #127
+jmp L458
+red r1
+jmp *r6
+stop
+L108: .string "ykgsbplx"
+L109: .string "tpv"
+L110: add *r5, r6
+L111: jmp *r0
+L112: jsr *r0
+L113: lea L454, L24
+L114: sub L396, r3
+L115: rts
+L116: inc *r7
+
+L117: sub r0, L40
+L118: not r6
+sub *r6, *r7
+L119: inc *r1
+; comment
+L120: rts
+L121: .data 828, -101, 237, 959, -854, 507
+lea L63, r0
+L122: .string "zmebfglpkp"
+bne L258
+L123: jmp *r6
+; comment
+L124: rts
+L125: stop
+L126: add *r7, r4
+L127: jmp L70
+
+L128: clr L43
+L129: red L325
+L130: lea L26, *r3
+not r1
+L131: sub *r6, *r1
+L132: clr *r3
+L133: jsr L94
+rts
+L134: .string "sc"
+
+L135: jmp *r5
+L136: sub r6, L542
+jmp L50
+add *r0, L126
+jmp L9
+stop
+L137: not r1
+L138: rts
+L139: prn L550
+L140: add #-252, *r7
+jmp L433
+clr *r4
+L141: sub r1, r0
+clr *r4
+L142: sub #-189, L68
+L143: bne L98
+L144: rts
+L145: red r3
+L146: lea L270, *r2
+prn #148
+L147: .data 671, -940, 528, -172, -5, 247, -761
+lea L1, *r0
+bne *r3
+L148: inc r0
+L149: lea L222, *r0
+inc L98
+sub r7, *r2
+L150: mov #-244, L33
+L151: .data -905, -885, 783, -557, -465
+prn r4
+inc *r7
+L152: .string "yghmqopoywuzqgctyxw"
+L153: stop
+L154: add #-117, L26
+bne L554
+L155: bne L41
+L156: inc *r6
+L157: inc L520
+; comment
+sub r4, L64
+L158: prn *r0
+L159: jsr *r5
+bne *r7
+jmp *r4
+L160: sub *r6, *r2
+L161: red *r5
+inc *r2
+not r6
+stop
+stop
+red r7
+bne L520
+red r0
+stop
+L162: sub *r7, L320
+L163: .string "qmaockac"
+L164: lea L13, r0
+L165: red L202
+red *r5
+jsr L477
+L166: stop
+L167: cmp r2, r5
+bne *r4
+clr L109
+not r7
+L168: bne *r7
+L169: clr r0
+not r1
+L170: clr *r7
+L171: stop
+L172: dec r1
+L173: rts
+prn #75
+; comment
+L174: inc r6
+jsr L62
+clr *r6
+L175: inc r0
+L176: inc r3
+jmp *r3
+stop
+cmp *r5, #251
+L177: .data -581, -158, -551
+L178: mov r0, r5
+L179: lea L139, r5
+L180: red *r2
+rts
+rts
+L181: jmp L13
+; comment
+; comment
+L182: inc *r2
+L183: .data -883, 711, 291, 82, 944
+prn L52
+L184: cmp L41, #-159
+lea L64, r6
+stop
+L185: bne L456
+cmp r1, *r2
+stop
+L186: red L544
+L187: jmp *r5
+L188: jmp *r7
+lea L225, *r5
+L189: rts
+L190: cmp r1, L13
+mov L252, r0
+L191: mov r7, *r5
+inc r6
+L192: cmp r1, L520
+L193: lea L260, *r7
+lea L583, r2
+bne L153
+L194: mov r5, r7
+L195: bne *r5
+L196: not L44
+L197: stop
+prn #165
+L198: jsr *r0
+L199: mov L149, *r6
+stop
+L200: bne L167
+L201: mov #69, r1
+L202: inc r4
+dec L195
+jsr *r7
+L203: clr r2
+prn L481
+bne *r3
+L204: dec r0
+L205: clr r5
+L206: mov #246, L132
+L207: add #-122, L360
+L208: dec r5
+L209: .string "qat"
+L210: dec r7
+sub r4, *r3
+red r7
+; comment
+L211: mov r1, *r0
+not *r0
+L212: dec *r1
+L213: cmp *r1, *r7
+mov L549, r0
+L214: lea L217, L161
+red r4
+L215: jmp *r0
+L216: lea L40, *r4
+L217: rts
+
+L218: rts
+lea L93, L396
+L219: not L565
+inc r7
+bne *r3
+clr r0
+sub r1, L72
+L220: jsr *r7
+dec L231
+clr L545
+inc r0
+L221: dec *r2
+
+L222: rts
+; comment
+L223: mov r1, L18
+L224: lea L497, r2
+L225: stop
+L226: dec L488
+L227: inc *r4
+L228: red L121
+L229: red *r7
+jmp L372
+sub #-160, *r6
+L230: dec *r2
+jsr L499
+L231: stop
+not L605
+L232: jsr *r3
+L233: dec *r5
+not *r0
+L234: not r2
+L235: add L261, L20
+L236: rts
+lea L8, L72
+L237: clr *r3
+L238: jmp L75
+L239: jmp *r6
+L240: sub r4, L410
+L241: .data 73, -622, -448, -147, 879
+red *r0
+L242: .string "qxuicbrtsanwkveanh"
+L243: not *r1
+L244: add L396, *r4
+L245: .data -923, -896, 618, 883
+L246: .string "buom"
+bne *r1
+L247: .data 935
+L248: .data 295, 707, -619, -222, -58, 870
+L249: .data -605, -844, -900, -675
+clr r1
+L250: lea L600, *r1
+; comment
+L251: mov *r6, *r5
+jmp L67
+L252: inc L150
+L253: sub #-130, L570
+L254: mov L610, *r0
+prn #-154
+sub #-60, *r2
+L255: sub *r0, L17
+L256: .string "kj"
+mov L333, L398
+; comment
+L257: sub L379, L376
+L258: not r4
+jsr *r1
+
+L259: clr r6
+L260: dec L224
+L261: .data 704, -346, -957, -358, -631, 294, 203, 453
+L262: cmp *r5, #-4
+L263: lea L114, *r2
+clr *r7
+cmp #217, L208
+L264: inc r1
+L265: .data 75
+jsr *r1
+clr *r4
+add L33, r5
+red *r7
+L266: mov r7, *r3
+stop
+L267: clr *r3
+clr *r6
+L268: prn #63
+L269: rts
+L270: inc *r0
+sub r3, *r3
+L271: .data -34, 378, 876, -917, 182, -374, -73, -673
+sub *r6, *r1
+L272: sub L237, L185
+L273: sub L592, r0
+add r6, r6
+L274: inc L515
+L275: prn #-139
+inc L442
+L276: .string "uwbjtfvdpjxdimnsyh"
+L277: prn *r4
+cmp *r3, L439
+L278: red L216
+; comment
+red *r2
+mov r5, *r4
+L279: .data 65, 295, -348, 375, -317, -236
+L280: inc *r5
+sub #196, L146
+L281: lea L33, r7
+L282: .string "eiao"
+L283: jmp *r6
+L284: stop
+L285: not *r4
+L286: mov L100, *r5
+L287: .data -919, -991, -431, 596, 869, 41
+L288: .string "bdtqqfhjatuohtjrd"
+L289: cmp *r1, #-169
+L290: add r2, r7
+jmp L575
+L291: lea L278, r2
+red L290
+L292: .data -593
+jsr *r4
+L293: .string "mkrpweggpzaucklj"
+L294: sub #141, r4
+L295: cmp #224, L593
+L296: clr r7
+not *r4
+L297: jmp *r5
+; comment
+L298: clr L328
+clr *r4
+L299: sub L257, *r3
+L300: red r7
+L301: dec r1
+L302: rts
+L303: jmp L185
+jmp L427
+L304: rts
+L305: not r0
+L306: rts
+L307: bne *r4
+L308: clr *r3
+L309: add r2, *r5
+add r0, L237
+L310: rts
+L311: mov *r5, *r0
+L312: bne L177
+L313: .data 342, -144, -571
+mov *r6, r6
+L314: dec L494
+stop
+red *r2
+L315: mov L473, L187
+L316: lea L69, r6
+red *r7
+L317: mov #-66, r3
+L318: jmp *r4
+L319: dec L612
+add #134, *r6
+sub r2, r1
+inc *r4
+L320: dec r0
+L321: not L71
+L322: dec *r3
+
+L323: inc L190
+L324: add L490, r1
+L325: red L620
+L326: clr r7
+L327: jmp L530
+; comment
+L328: .string "mbc"
+prn #-244
+add r3, r0
+L329: not *r0
+prn *r2
+inc *r4
+; comment
+L330: add #139, L129
+jmp *r1
+; comment
+L331: prn #250
+L332: add L154, *r4
+inc L177
+L333: dec L454
+L334: jsr *r3
+L335: stop
+L336: prn r6
+prn #205
+L337: jsr *r3
+prn r6
+L338: not L56
+jmp *r6
+L339: jmp *r6
+L340: clr r4
+stop
+L341: cmp *r4, #111
+L342: red L468
+L343: .string "qsoluoudgdvyreoowzp"
+L344: dec *r7
+inc *r4
+L345: lea L474, *r2
+dec *r5
+L346: .string "yhpamyrkaa"
+L347: dec r1
+L348: sub *r0, *r7
+sub #5, L24
+L349: add *r3, *r1
+L350: cmp *r6, *r2
+L351: mov L174, *r4
+
+L352: jsr *r6
+; comment
+L353: not *r1
+inc L242
+L354: sub #169, *r3
+sub #-216, r0
+L355: jmp L183
+dec *r7
+inc r5
+inc L277
+L356: red *r2
+L357: cmp #-9, #54
+L358: jsr *r4
+L359: clr *r4
+rts
+L360: not *r0
+L361: inc L568
+L362: mov #59, L409
+L363: sub L200, L123
+inc *r7
+L364: prn L462
+prn L34
+L365: add #185, *r7
+L366: clr r1
+; comment
+not *r7
+
+mov r5, L252
+bne *r4
+L367: inc L486
+stop
+rts
+; comment
+L368: .data 264, -44, 959
+inc L375
+L369: cmp L424, *r5
+L370: inc r7
+L371: rts
+L372: rts
+rts
+dec L222
+
+red r3
+rts
+L373: dec *r0
+L374: bne L238
+dec r6
+L375: bne L212
+L376: add r2, *r4
+dec r1
+stop
+L377: not r1
+L378: clr L510
+L379: .string "grkqmsgjszu"
+L380: .data -331, 660, -742, 494, 91
+L381: jmp *r0
+L382: add L278, L9
+L383: add L354, r5
+L384: red r1
+L385: not r4
+L386: .string "gqforwhf"
+inc L415
+L387: sub *r2, *r0
+L388: inc r7
+L389: .string "ilpapv"
+prn r1
+L390: jsr *r3
+L391: stop
+L392: lea L515, L310
+L393: .string "hnpr"
+L394: clr r6
+L395: jsr L536
+
+L396: mov *r5, L2
+rts
+jmp L581
+cmp *r3, r5
+L397: jsr *r0
+dec *r3
+lea L464, r6
+L398: mov *r3, r1
+clr r2
+inc r5
+; comment
+L399: red *r3
+L400: .data -793, 805
+L401: stop
+L402: dec r7
+jsr L364
+L403: cmp r6, *r0
+L404: dec r4
+L405: jsr *r6
+L406: rts
+L407: stop
+L408: dec L246
+L409: inc L431
+L410: mov *r4, r1
+L411: prn #180
+L412: sub L237, *r5
+mov #140, *r6
+L413: inc r7
+L414: .data 878
+L415: inc r6
+L416: jmp *r2
+jmp L450
+stop
+L417: cmp #-75, #-70
+jmp *r2
+L418: not L178
+L419: rts
+L420: red r7
+L421: bne L296
+L422: not L18
+L423: jsr *r5
+dec *r0
+L424: .string "ldqfyupllkw"
+L425: prn L473
+L426: .string "jhozpehconsaslgtx"
+jmp *r2
+L427: mov *r2, r2
+L428: red L590
+sub *r2, r4
+L429: jmp *r1
+L430: jsr L504
+L431: add r5, *r2
+cmp L611, L242
+L432: clr L342
+rts
+add r0, L562
+jsr L255
+L433: add r7, L465
+mov L529, L299
+not L502
+L434: lea L503, *r3
+L435: prn *r3
+inc *r4
+L436: prn L38
+add r1, r5
+L437: .string "zpfi"
+
+dec *r5
+L438: prn *r6
+clr L572
+L439: dec r7
+L440: inc L249
+L441: lea L561, r2
+stop
+bne L529
+mov *r5, L462
+L442: jmp L134
+L443: .string "cqxybjtpvqjtdyocyzawa"
+L444: not r6
+L445: prn r4
+L446: .string "evt"
+L447: add #236, L544
+rts
+red r2
+L448: stop
+L449: clr L538
+mov r2, L595
+sub #-47, r7
+L450: .string "ytzvcwqlljljplr"
+; comment
+L451: clr L490
+cmp r0, *r6
+L452: red L240
+L453: prn L138
+L454: red *r5
+L455: sub r1, r7
+L456: rts
+L457: jmp *r3
+L458: .data -970, 169, 804
+L459: add r1, L386
+L460: stop
+L461: .string "ewduv"
+L462: bne L192
+; comment
+jsr *r0
+L463: add #130, L598
+L464: stop
+L465: inc r7
+mov #-76, r2
+L466: jmp L548
+L467: red *r1
+red r3
+L468: .string "ibpt"
+inc L41
+inc *r6
+L469: clr *r0
+L470: sub r4, *r3
+L471: prn r7
+red L614
+L472: prn r7
+L473: .string "dyserijkdb"
+L474: jsr L105
+L475: red *r3
+; comment
+
+stop
+L476: jsr *r7
+L477: jmp *r2
+rts
+L478: bne *r0
+L479: prn r3
+prn r3
+L480: add #4, *r3
+
+L481: dec L495
+lea L459, L421
+L482: prn L521
+L483: rts
+stop
+L484: .data -880, 53, 737
+inc r4
+rts
+L485: lea L465, *r1
+
+L486: add *r2, L160
+L487: prn r1
+L488: inc L496
+L489: dec L512
+L490: cmp *r1, #68
+L491: jsr *r3
+L492: not *r1
+L493: mov #88, L393
+red L132
+L494: cmp *r2, r2
+L495: dec *r2
+L496: inc r2
+L497: prn #-97
+L498: stop
+lea L128, *r5
+jmp L579
+sub #34, L137
+L499: jsr L110
+L500: clr *r5
+L501: cmp *r0, #-11
+; comment
+L502: .string "goybdrvcbkcbneavi"
+L503: not *r4
+
+L504: bne L206
+sub r5, *r1
+L505: jsr L599
+L506: .data 577, 5, -793, -870, -964, 414, 983
+prn L555
+L507: not *r1
+
+L508: .data -931, -319, 980, 461
+rts
+L509: .string "liwhgskhoibqzx"
+jsr *r2
+bne L148
+L510: red *r4
+L511: bne *r7
+L512: inc L385
+add L357, *r0
+L513: inc *r0
+L514: dec *r3
+L515: not *r3
+
+L516: add *r2, r1
+L517: cmp r0, *r3
+red r0
+L518: cmp #66, r1
+L519: sub *r3, *r1
+sub L133, *r1
+dec L619
+L520: not r1
+L521: dec *r4
+L522: red r2
+add *r7, r4
+red r0
+L523: mov L587, r1
+L524: add #114, *r6
+L525: prn *r5
+L526: red r5
+L527: prn r1
+L528: mov L424, r7
+mov #176, r0
+L529: bne *r6
+prn L560
+L530: mov r3, r7
+L531: jmp L615
+L532: .string "x"
+L533: rts
+L534: cmp L584, *r3
+lea L604, *r4
+L535: dec L61
+L536: .data 663, 764, 89, 473, -869
+rts
+add L569, *r7
+jsr L17
+L537: dec L548
+not L253
+L538: .data 261, 318, -557
+mov r5, *r3
+L539: cmp r4, r4
+L540: .string "nezrogltojsvkav"
+L541: lea L435, r2
+L542: .data -938, -123, -185, 822, -280, 520
+inc r2
+mov #-180, *r7
+L543: stop
+L544: bne *r4
+lea L552, L328
+L545: lea L552, *r4
+L546: add L571, L607
+add r2, *r2
+sub *r3, L199
+L547: lea L298, L576
+cmp *r1, *r6
+L548: sub r1, *r3
+bne L273
+L549: jsr L570
+L550: jmp *r5
+jmp *r6
+L551: jmp L612
+L552: .data -444, 800
+L553: red L556
+L554: sub L380, *r7
+not *r7
+L555: sub #-100, L576
+stop
+L556: rts
+lea L160, *r5
+L557: red L618
+L558: bne L154
+L559: jmp L38
+clr L573
+
+L560: sub r0, L621
+jmp *r1
+add L589, *r2
+L561: cmp r2, #7
+clr r6
+; comment
+prn r3
+L562: bne *r5
+L563: bne L595
+bne L565
+L564: jsr L581
+mov #-10, r1
+L565: .data -379, -595, -1000, -939
+L566: rts
+L567: bne L598
+L568: red r3
+L569: bne L605
+not *r4
+L570: stop
+rts
+dec r5
+dec *r5
+L571: red r4
+L572: .data -344, 892, -320, 30, -395, 518
+stop
+jsr L621
+add r3, *r7
+L573: red L616
+; comment
+L574: stop
+L575: bne L436
+L576: .string "jfqvozitpfnc"
+L577: stop
+L578: .data 87, -823
+L579: not L562
+L580: red *r3
+stop
+; comment
+L581: not L620
+L582: not r5
+L583: jsr L248
+L584: bne *r7
+L585: sub *r3, *r5
+L586: rts
+L587: cmp r3, L612
+L588: inc r5
+L589: .string "pbcysdn"
+L590: stop
+not *r5
+L591: prn r3
+L592: .data 643, 141, 485
+L593: lea L600, r3
+bne *r4
+rts
+L594: rts
+L595: prn r3
+L596: inc L604
+clr r7
+L597: mov #-224, L615
+; comment
+L598: stop
+lea L622, *r2
+stop
+prn *r6
+jmp L509
+prn L26
+inc *r5
+L599: inc *r1
+L600: sub *r4, L262
+red *r2
+L601: dec *r6
+L602: stop
+; comment
+L603: inc *r7
+L604: stop
+lea L616, *r5
+L605: red r5
+jmp L612
+L606: cmp L618, r2
+L607: sub *r2, L463
+L608: lea L395, *r6
+
+L609: dec L399
+L610: clr L358
+L611: inc *r2
+L612: jmp *r0
+L613: rts
+L614: jmp *r2
+
+inc r6
+L615: .string "mva"
+
+L616: sub L477, L617
+dec L617
+L617: add L514, *r6
+L618: cmp #-12, r1
+L619: jmp *r3
+L620: prn r7
+L621: stop
+L622: sub *r1, *r0
+stop
@@ -0,0 +1,1041 @@
+; Generated by genCorpus --seed 33
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+prn L527
+L0: rts
+jmp *r3
+prn L315
+lea L177, L0
+L1: .string "iltwinaqx"
+L2: mov *r2, r1
+bne L0
+L3: red r7
+cmp r6, r6
+L4: cmp r5, L337
+L5: mov #230, L80
+clr L63
+prn L502
+dec r5
+clr *r6
+inc L78
+L6: prn #-133
+L7: dec L5
+L8: inc *r2
+; comment
+prn #-154
+L9: jsr L202
+L10: cmp #99, *r4
+L11: mov #240, r1
+L12: cmp r1, r4
+prn L294
+mov #161, L125
+L13: dec *r1
+prn L3
+red *r6
+add #-248, r1
+bne *r3
+L14: mov *r1, *r1
+L15: stop
+L16: sub *r6, *r6
+L17: jsr *r7
+L18: jsr *r3
+; comment
+L19: mov r5, r3
+L20: not *r6
+L21: .data 128, 941, 181, 103, -595, -323
+rts
+L22: sub L20, r4
+sub L10, *r1
+
+L23: bne *r4
+L24: inc L299
+bne *r3
+L25: jsr *r2
+L26: stop
+rts
+
+L27: lea L15, L248
+jmp *r5
+L28: stop
+L29: stop
+dec L19
+prn #30
+lea L385, r3
+L30: prn *r1
+L31: lea L290, *r7
+L32: dec *r0
+L33: stop
+L34: not *r5
+jmp L15
+; comment
+; comment
+L35: rts
+sub L513, L62
+dec *r2
+L36: red *r6
+L37: .string "nofu"
+L38: dec L6
+add r0, r6
+jmp L485
+sub L100, L566
+add *r0, r6
+L39: .string "pxlcczpqtyahjiqzhutm"
+L40: .string "u"
+add L429, L291
+
+rts
+clr L334
+L41: sub *r7, L14
+L42: jmp *r4
+L43: jsr *r3
+mov L75, r7
+L44: jmp L183
+L45: not L198
+dec L527
+inc L20
+L46: sub r0, r3
+stop
+L47: prn *r2
+L48: dec *r5
+L49: bne L521
+L50: rts
+add L337, L47
+L51: .string "psgdoptqeixyndmwafcu"
+not *r4
+bne L359
+L52: prn r3
+lea L269, L36
+clr r6
+jmp *r6
+not L9
+L53: .data -923
+L54: jmp *r7
+mov r0, L21
+clr r1
+
+stop
+add r2, L25
+L55: jmp L126
+L56: prn L36
+lea L54, *r5
+L57: stop
+red r6
+L58: jsr *r6
+not *r5
+L59: .string "vtibyzhxxd"
+jsr L148
+prn *r3
+L60: .data -707, 66, -986
+add L411, L415
+dec r1
+L61: lea L48, L48
+L62: .string "svziqaveefrwrzmzfyopx"
+L63: jsr L28
+prn #-182
+L64: prn #30
+L65: rts
+L66: prn r5
+rts
+L67: .string "hnkwjpjwvixgzdicnis"
+lea L35, *r1
+L68: not *r5
+inc r6
+stop
+L69: mov *r3, L542
+not L26
+sub #37, r2
+L70: inc r5
+L71: add #-122, r4
+prn #-154
+dec L102
+L72: jsr L12
+; comment
+inc *r6
+red r7
+L73: sub *r2, *r4
+L74: inc L72
+jmp L27
+add *r7, r7
+L75: .string "txkjzqybcyvigr"
+L76: .string "p"
+L77: dec r1
+L78: red L509
+stop
+; comment
+L79: jmp L57
+L80: mov r0, *r2
+bne L284
+L81: .data 960, -879, -139, 413, 557, -161, -46, -509
+mov L267, L65
+L82: red L17
+lea L94, r5
+L83: dec *r6
+L84: mov #180, r3
+L85: not *r7
+inc *r3
+L86: red r4
+L87: .data -231
+L88: lea L76, r3
+L89: add r7, L3
+L90: rts
+
+mov #-226, *r5
+L91: .string "zxzusnuvnnrjho"
+L92: not *r1
+L93: rts
+
+L94: rts
+L95: stop
+L96: lea L232, L612
+stop
+L97: rts
+L98: lea L165, L54
+clr r0
+L99: stop
+L100: mov #173, r0
+L101: stop
+L102: rts
+red r2
+L103: .string "ktzvuwevcj"
+L104: not r3
+L105: .data -966, -842, -636, 742, -334
+L106: not L252
+lea L62, L454
+bne L197
+L107: sub r1, r6
+L108: inc L611
+L109: jmp *r7
+L110: lea L36, *r0
+L111: inc r4
+L112: jmp L324
+rts
+prn #-107
+dec L74
+
+L113: .string "d"
+add r2, r0
+jmp *r3
+L114: lea L18, L308
+jmp L377
+red r2
+L115: red r1
+dec *r0
+L116: jsr L16
+L117: .string "svfrwwg"
+mov r5, L443
+bne L74
+L118: rts
+L119: dec *r5
+jmp L70
+; comment
+L120: mov #-75, L18
+L121: add *r4, *r4
+L122: dec L8
+prn L210
+lea L583, L40
+jsr *r4
+lea L598, *r6
+prn #-108
+L123: add L422, L105
+add #-56, L600
+L124: stop
+rts
+L125: sub *r7, *r3
+L126: jsr *r4
+L127: bne *r1
+L128: red r5
+L129: jmp L19
+mov #71, *r6
+clr L18
+L130: .data 170, -483
+bne *r2
+L131: .data 12, 372, -769, 195, 481, -670, -897
+L132: sub r1, *r0
+L133: .data 243, -178, -11, -930, 337, -523
+jsr L137
+L134: dec r6
+L135: cmp r7, r3
+L136: bne L332
+L137: .string "jjenkcran"
+L138: bne *r1
+L139: clr r4
+L140: rts
+L141: rts
+L142: inc L477
+mov L525, *r0
+L143: mov L121, L177
+bne *r3
+rts
+L144: not r3
+L145: .data 221
+L146: .data 225, 123, 458, 374, -600, 391
+L147: not r7
+L148: not *r4
+jsr *r7
+L149: add *r7, r6
+stop
+mov #28, r0
+L150: lea L510, L166
+; comment
+cmp r2, *r0
+jsr L287
+L151: add r3, L236
+L152: dec L42
+L153: .data 37, 746, -206, 897, 483, 94, 733
+L154: mov L7, *r7
+L155: .string "gogmrondbwizgc"
+L156: rts
+dec r5
+add #133, L134
+L157: bne *r4
+L158: bne *r6
+L159: bne L395
+prn *r0
+dec L65
+L160: rts
+L161: lea L74, *r0
+L162: add r4, *r5
+L163: clr L535
+L164: clr r7
+clr *r0
+not *r1
+clr r3
+bne L335
+L165: mov #-37, L133
+L166: lea L39, *r3
+L167: clr *r1
+sub r7, r2
+L168: mov L537, L202
+L169: mov r1, L472
+L170: dec r5
+L171: dec L46
+bne L160
+L172: not r7
+L173: cmp L148, #-240
+dec *r0
+L174: not r0
+sub #245, r6
+mov r0, L513
+L175: .string "vrpvzrxsxxwfcpenofgrzys"
+L176: inc r3
+L177: .data -433, -400, 43, -744, 345, -514
+L178: clr r2
+rts
+
+L179: not *r0
+L180: add #58, r1
+jsr *r7
+sub L136, L230
+cmp *r3, r5
+sub L139, r7
+L181: clr *r4
+L182: red L140
+L183: inc L247
+mov r4, L523
+L184: inc L499
+L185: rts
+jmp *r6
+L186: dec L578
+L187: mov #-108, r5
+L188: clr L423
+jsr *r4
+L189: stop
+L190: rts
+not r2
+
+L191: cmp #-111, #-39
+L192: stop
+L193: lea L209, L196
+L194: jsr *r5
+add *r1, *r0
+L195: stop
+L196: add L424, L37
+L197: sub r5, r0
+mov #-90, L525
+; comment
+jmp *r1
+L198: cmp *r3, r1
+L199: not *r0
+L200: jmp *r3
+L201: red r7
+L202: jsr *r6
+L203: jsr L13
+dec *r5
+dec r0
+L204: clr L200
+L205: clr *r3
+add *r2, *r3
+L206: .string "npxecmrpuuvqoj"
+L207: jsr L42
+bne L152
+L208: .data 101, 228, 169, 639, -999
+L209: mov *r1, r3
+clr r3
+L210: lea L147, r4
+L211: rts
+L212: rts
+L213: dec r6
+clr L172
+L214: sub #-82, r6
+L215: .data 206, 820, -853, 168, 756, -177
+L216: not *r3
+L217: clr L60
+L218: .data 489, 204, -841, -46, -134, 307, -669, 914
+not *r0
+L219: .data 464
+L220: bne *r5
+L221: lea L217, r7
+not r1
+L222: mov r3, L106
+L223: not r5
+lea L142, L68
+not r3
+not *r3
+L224: red L16
+L225: mov r7, r2
+L226: .string "nwvgqumwiood"
+L227: cmp *r5, r7
+mov *r2, r4
+bne L563
+L228: add L69, L591
+jmp L580
+L229: mov r6, *r3
+bne L172
+L230: clr L356
+L231: lea L192, L127
+add r2, *r2
+L232: jmp L258
+L233: lea L431, L60
+L234: not L34
+L235: prn L329
+L236: .data -128, 576
+; comment
+not r3
+clr *r2
+L237: jsr L589
+L238: .string "znmpeffeopd"
+L239: not *r2
+L240: prn L314
+L241: stop
+L242: red r2
+L243: dec L402
+lea L488, *r1
+L244: .string "nyzeowoiubmpaztd"
+L245: prn r3
+L246: jsr L234
+bne *r0
+sub #-191, L271
+L247: prn #47
+L248: stop
+L249: jmp *r4
+L250: red L211
+L251: cmp #-197, *r3
+L252: inc *r0
+L253: bne L390
+inc *r4
+mov r5, L585
+L254: rts
+inc *r1
+L255: cmp L439, r1
+L256: dec *r7
+stop
+cmp *r0, #-191
+; comment
+L257: not r6
+jsr *r1
+L258: .string "jmatatpjeiskttmphdrb"
+L259: jsr *r5
+L260: mov r1, r5
+L261: prn *r5
+L262: not L490
+mov r3, r1
+red L63
+L263: .string "lbyn"
+L264: jsr *r6
+L265: .data -478
+L266: dec *r2
+L267: inc r2
+L268: not r7
+L269: inc r7
+L270: stop
+L271: bne L290
+L272: red r6
+rts
+L273: clr r5
+clr L106
+clr *r6
+L274: clr *r2
+L275: .string "zheyglagoru"
+mov #-74, L405
+L276: clr r5
+jmp *r4
+L277: jmp L318
+L278: rts
+L279: sub L320, *r2
+L280: not r4
+L281: add r5, *r0
+L282: red L166
+L283: red *r2
+L284: mov *r4, *r1
+L285: sub *r5, r3
+L286: jmp *r6
+jsr *r6
+dec L280
+L287: lea L387, *r0
+L288: rts
+L289: rts
+L290: .string "px"
+L291: bne *r7
+mov *r0, L9
+L292: .string "nevpfjlvbojicejfpghog"
+L293: mov L319, r1
+jsr *r3
+inc *r5
+; comment
+L294: jmp *r3
+L295: sub r6, L381
+; comment
+L296: jsr *r4
+L297: prn r1
+; comment
+L298: sub *r4, r0
+L299: rts
+L300: lea L155, L10
+L301: inc r7
+L302: red L165
+L303: bne *r0
+; comment
+L304: rts
+L305: not L240
+L306: red L392
+jmp *r5
+L307: jmp *r1
+rts
+L308: jsr *r5
+add *r2, r3
+L309: rts
+clr r1
+red r4
+L310: mov L390, L87
+not r0
+L311: .data 63, 759, -108
+stop
+L312: rts
+L313: mov #14, r3
+L314: cmp L451, *r5
+L315: jsr L373
+L316: .data 452, -19, -137, -153
+L317: clr r0
+L318: dec L39
+L319: .string "q"
+
+L320: .data 243, -325, 44
+cmp r5, #237
+L321: jmp L342
+L322: .string "xuhrtt"
+L323: cmp *r3, L80
+sub #76, L571
+bne L515
+
+L324: add #-42, *r0
+L325: jsr L599
+L326: prn r5
+L327: mov L20, r7
+clr r1
+clr *r3
+L328: cmp L501, r4
+L329: jmp L494
+L330: clr *r2
+L331: red r1
+L332: bne *r3
+L333: rts
+L334: jsr *r3
+jmp L345
+L335: add L200, r2
+L336: inc *r2
+L337: inc *r5
+add *r1, *r3
+L338: rts
+L339: not r3
+not L135
+L340: stop
+jmp *r5
+jsr L152
+L341: add *r7, r4
+mov r0, *r2
+not r5
+L342: rts
+L343: rts
+L344: bne L40
+L345: clr *r1
+L346: bne L5
+bne L237
+L347: sub #235, *r0
+L348: .string "ihmyndt"
+L349: .data 58
+L350: mov *r4, *r2
+L351: .string "itylboptybvrrcvcnyjitj"
+L352: sub r1, r3
+L353: jmp *r5
+L354: inc L516
+not *r1
+stop
+L355: bne L239
+add L215, r4
+L356: red r6
+prn L502
+not r7
+L357: inc *r6
+L358: .string "xurxtpbpqfq"
+L359: clr L600
+L360: sub L356, *r3
+L361: prn *r5
+L362: mov r7, L377
+L363: jmp *r4
+clr r1
+red L111
+L364: cmp *r2, #21
+L365: cmp #216, *r4
+L366: stop
+L367: prn *r3
+rts
+stop
+inc r1
+rts
+L368: rts
+L369: jmp L458
+L370: rts
+L371: rts
+L372: add r2, r2
+L373: cmp L195, r5
+rts
+L374: mov #143, *r7
+dec r3
+L375: .data -508
+L376: mov r0, *r4
+L377: clr r3
+L378: cmp L259, #114
+L379: lea L593, *r6
+L380: inc L275
+L381: jmp *r0
+jsr *r4
+L382: lea L22, r2
+L383: jmp *r0
+L384: jmp L561
+L385: mov L475, r7
+rts
+L386: mov #93, r1
+L387: dec L467
+L388: sub #88, *r7
+cmp r4, #34
+L389: jsr *r7
+L390: rts
+L391: cmp #93, r4
+clr L519
+
+L392: add *r7, L407
+inc L417
+L393: jsr L38
+L394: jmp *r1
+L395: sub r6, *r1
+bne L575
+clr r1
+; comment
+sub r5, L494
+rts
+jmp *r4
+L396: .data -105
+bne *r5
+L397: clr L166
+inc r5
+L398: add r6, L394
+; comment
+L399: lea L85, r0
+L400: stop
+L401: clr L519
+stop
+L402: jmp *r7
+mov #-135, *r5
+; comment
+L403: lea L585, L282
+L404: .data -355, 587, 691, 665, 329, 880
+L405: mov #8, *r2
+add r7, r0
+bne L514
+dec r1
+L406: sub r6, *r6
+L407: lea L338, L574
+L408: red L553
+rts
+L409: .string "sopdimzshialqqfcqglotqd"
+mov #-217, L155
+L410: jmp *r2
+
+jmp *r0
+L411: inc *r3
+red L462
+prn *r1
+L412: prn L500
+bne L0
+clr r1
+bne L530
+add #-55, r7
+L413: .data -101, 982, -789, 130, -877, -918, 376, -51
+L414: clr L262
+L415: prn L602
+L416: jsr *r7
+L417: clr r5
+lea L48, L443
+L418: cmp L436, r3
+dec L347
+L419: jmp L77
+sub #214, *r6
+stop
+L420: sub r4, r2
+mov *r3, L132
+L421: mov r6, r0
+L422: prn L582
+sub #86, r5
+L423: not L473
+L424: add *r5, L499
+rts
+L425: stop
+L426: lea L376, r2
+L427: not r0
+L428: not *r7
+stop
+L429: .string "sdvrazgbffjvbw"
+bne *r7
+add #-174, r6
+L430: not L561
+mov #-153, L603
+sub #-48, *r4
+lea L414, r5
+L431: clr *r0
+jsr L95
+L432: inc *r2
+L433: jmp *r2
+cmp #-235, #139
+L434: bne *r3
+L435: .data -621
+cmp #72, r0
+L436: cmp L435, r6
+L437: .string "viuhiungffnvtcrzfwjf"
+dec L337
+L438: clr r2
+L439: prn *r6
+L440: rts
+not *r6
+L441: not L97
+L442: dec L120
+L443: stop
+L444: .data 905, -188, -169, -604
+L445: sub #7, L501
+dec *r4
+prn #250
+L446: sub *r7, r7
+L447: dec *r0
+add r7, *r3
+L448: lea L390, L53
+L449: sub r6, *r2
+mov *r2, L242
+not *r4
+L450: .string "ecgxqlgujziyifpzuufz"
+L451: add r7, r1
+not *r6
+clr r2
+L452: red *r5
+L453: jsr *r3
+L454: .data -261, 869, -102, 348, 100, 742, -317
+L455: inc L81
+L456: rts
+L457: red *r7
+add *r4, *r7
+L458: clr L355
+L459: bne *r7
+cmp L513, *r3
+L460: jsr *r6
+L461: cmp L143, *r0
+rts
+L462: add #-153, *r7
+L463: lea L472, *r4
+not r2
+L464: bne L245
+L465: dec L568
+L466: mov r2, L474
+L467: jmp L47
+L468: add r5, *r0
+L469: inc r1
+L470: cmp #-154, *r5
+L471: inc *r4
+L472: inc r5
+L473: red r6
+L474: jmp *r1
+cmp *r2, L554
+mov #-37, L94
+rts
+L475: not L569
+dec r0
+L476: .string "hdqwtjmxaoaljmcwamhmcdf"
+prn L77
+L477: jmp *r7
+L478: bne L565
+L479: clr *r3
+L480: not *r6
+bne *r6
+rts
+L481: cmp #180, *r1
+L482: rts
+stop
+L483: dec L282
+L484: dec *r6
+dec L396
+L485: dec L400
+L486: cmp r5, *r2
+L487: stop
+bne L606
+prn *r2
+L488: inc L557
+L489: add #169, L602
+inc r7
+L490: sub *r0, L147
+sub L589, L609
+jmp *r5
+rts
+L491: jsr *r7
+inc *r5
+stop
+L492: jmp L617
+L493: inc L571
+inc L586
+L494: jmp L52
+jsr *r2
+dec r6
+L495: .string "mrdiwh"
+cmp r3, L226
+
+L496: add #170, r3
+L497: jmp *r7
+
+cmp r5, r3
+L498: cmp r5, *r4
+L499: cmp L53, *r4
+stop
+cmp L578, r4
+L500: jsr L567
+L501: .data -202, -214, 114, -825, -802
+L502: bne L448
+L503: add *r4, *r2
+L504: prn L495
+L505: red *r4
+rts
+L506: .data 334, -522, 138, -779
+stop
+L507: stop
+clr r7
+L508: .data 616, -511
+L509: add #-10, L347
+clr L529
+L510: stop
+L511: not L479
+
+L512: jmp L393
+L513: sub L597, r4
+dec r1
+L514: mov #59, L542
+L515: not *r0
+L516: inc r7
+L517: sub *r2, *r4
+jmp *r1
+L518: red *r0
+L519: mov #160, L401
+; comment
+L520: inc *r4
+L521: stop
+L522: mov r6, r3
+sub r3, *r4
+sub #-18, r4
+L523: .string "i"
+L524: .data -173, -919, 910, -996, -2, -379, 733
+rts
+L525: stop
+jsr L318
+prn *r0
+L526: jmp L329
+; comment
+L527: add *r7, L333
+L528: prn *r6
+L529: .string "hkzfkiijxjkq"
+not r1
+L530: jsr *r0
+L531: mov L565, *r4
+mov r5, *r0
+L532: prn r7
+L533: bne *r3
+cmp r6, *r7
+bne L556
+L534: jsr *r7
+jsr L548
+L535: rts
+L536: add *r2, L559
+L537: rts
+L538: .string "ddwvoifvbtn"
+L539: add #-60, L280
+rts
+L540: rts
+L541: prn *r1
+L542: bne *r4
+inc *r0
+L543: dec r1
+L544: jsr *r1
+cmp *r4, r6
+add L603, r7
+sub *r7, r0
+red L586
+rts
+L545: sub L574, *r5
+L546: add *r3, r0
+L547: jsr *r5
+dec L495
+L548: rts
+L549: .data -203, -939, -315, -246
+inc r4
+L550: .string "nbtjcfrcjia"
+sub r6, L604
+L551: jsr L573
+red r3
+L552: inc r1
+inc *r3
+L553: inc r1
+L554: sub *r6, L28
+L555: dec L604
+; comment
+L556: jsr *r0
+L557: clr *r4
+L558: inc r5
+L559: stop
+L560: red L421
+cmp r2, #-221
+L561: cmp *r2, *r7
+L562: jmp *r0
+L563: cmp *r7, r4
+L564: cmp r6, *r3
+L565: .string "skefpved"
+L566: cmp #198, L547
+L567: cmp r5, r3
+L568: jsr *r4
+
+L569: rts
+L570: cmp L534, *r3
+L571: not *r0
+clr L604
+
+L572: clr *r4
+L573: prn r5
+L574: stop
+L575: not r6
+prn L425
+dec L342
+clr r1
+L576: .data -875, 50, -669, 815, 63, -809, 47
+L577: not r4
+L578: cmp r0, #-10
+L579: .string "ltccezc"
+L580: jsr *r1
+jsr *r0
+L581: rts
+L582: .string "pkluyrcsxostpkb"
+L583: clr *r0
+L584: dec *r0
+L585: lea L532, L605
+L586: .string "aofntyflyiycxeypbmofzssx"
+L587: bne L274
+lea L18, L285
+L588: add r6, *r7
+L589: rts
+L590: inc *r4
+L591: stop
+L592: clr *r0
+add *r7, L599
+L593: inc *r3
+L594: dec *r5
+prn *r6
+not L612
+rts
+prn L391
+jsr *r1
+L595: not r0
+L596: mov *r3, r6
+rts
+L597: dec r7
+L598: prn #216
+L599: stop
+clr r2
+L600: not r6
+L601: jmp *r2
+L602: red L607
+L603: clr *r3
+L604: dec L615
+L605: lea L136, r1
+add L611, L613
+sub r3, r0
+rts
+add r6, r0
+L606: lea L130, r0
+inc L505
+L607: dec *r2
+L608: prn r4
+L609: lea L610, L614
+L610: dec *r0
+not L617
+L611: red *r6
+L612: sub L283, r0
+L613: .string "bbfsshhc"
+L614: stop
+rts
+rts
+inc L617
+rts
+jsr L617
+L615: .data 436, -66, -780, -926, 487, 253, -573
+mov L414, r0
+L616: jmp L617
+L617: rts
+stop
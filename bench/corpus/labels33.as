@@ -0,0 +1,1040 @@
+; Generated by genCorpus --seed 34
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+L0: sub *r0, L0
+
+L1: inc r6
+L2: add #212, *r5
+clr *r6
+L3: add r0, r2
+L4: .string "yvukptojsgncch"
+not r6
+L5: add #149, *r7
+L6: jsr L190
+L7: .string "rx"
+; comment
+jsr L4
+L8: .string "aoqvst"
+L9: .data 836, 684
+L10: jsr *r1
+L11: .string "grrhkbb"
+bne L10
+L12: jmp L6
+L13: rts
+sub r2, *r5
+L14: sub r2, *r3
+L15: rts
+jmp *r1
+L16: not *r1
+L17: .data -614, -26, 319, 235, -706
+L18: .string "idaprxegoirqfyrnqecvgpf"
+L19: red L480
+sub L203, *r6
+lea L363, *r6
+L20: inc L439
+rts
+red *r7
+L21: sub #-246, L149
+mov L19, L383
+L22: not r2
+L23: mov r0, L27
+lea L410, *r2
+L24: jsr L9
+; comment
+jsr L3
+L25: jmp L207
+L26: inc *r0
+rts
+L27: jsr L486
+L28: .string "emargmhypswoytb"
+stop
+L29: bne *r3
+L30: mov L18, *r5
+L31: .data 959, -358, -94
+L32: inc *r1
+add #-60, r4
+cmp r7, r4
+L33: stop
+L34: clr L593
+L35: sub #-5, *r7
+L36: prn r6
+L37: jsr L0
+L38: jmp L375
+L39: .string "kudmqjcrxvaduayuf"
+L40: add L393, L537
+not L257
+sub L33, L485
+dec r5
+L41: inc L3
+L42: red r5
+L43: clr *r6
+L44: lea L440, L33
+L45: clr L430
+jmp L34
+L46: dec L6
+L47: not L569
+lea L24, r5
+mov *r3, r0
+L48: stop
+L49: prn *r5
+dec *r7
+mov *r2, *r1
+
+L50: inc r6
+prn r4
+L51: red *r1
+L52: .string "pgdcsjepuikfxqez"
+L53: not r3
+L54: clr r2
+cmp r0, #-42
+L55: stop
+L56: add L21, L333
+L57: jmp L433
+red r5
+rts
+L58: clr L49
+not *r3
+L59: .string "sxrupkho"
+L60: rts
+L61: .data -707, 934, -53, 818, -714, -277, 587, -788
+L62: inc r2
+L63: sub r7, r6
+L64: cmp L53, *r0
+prn *r1
+L65: inc *r3
+not *r0
+L66: bne L371
+clr r7
+L67: .string "umjlkowycvlbykluwmgesbbm"
+L68: .data -938, -622, 603, -164, 103
+L69: .data 103, 186, -332, -935, -909, 15, 873, -917
+L70: jsr *r6
+not L32
+sub #16, L498
+L71: .data -943, 62, -197
+L72: .string "lbg"
+dec *r2
+L73: inc *r3
+L74: bne L66
+L75: cmp *r3, L133
+L76: rts
+dec *r6
+L77: not L23
+cmp L28, *r0
+L78: jmp L25
+L79: clr *r0
+L80: not L43
+L81: jsr L525
+L82: rts
+rts
+L83: rts
+L84: red *r5
+L85: stop
+L86: inc L77
+red *r1
+lea L81, r6
+L87: cmp r1, #-100
+dec r2
+cmp *r5, *r7
+L88: jsr L50
+red L599
+L89: jmp *r2
+L90: clr *r6
+jmp L457
+L91: cmp r0, L158
+inc L244
+L92: sub L68, *r0
+add r1, r6
+stop
+cmp L73, L50
+L93: jmp L389
+add r3, r2
+; comment
+red r4
+not r5
+L94: .data -570, -327, -268, -911, 229
+L95: red r1
+L96: .string "mzwkrgtbmcixazlheak"
+
+L97: red r1
+
+L98: rts
+L99: clr r2
+L100: rts
+L101: stop
+L102: .data -685, -546, 446, 585, 663, -588, -350, -46
+L103: .data 712, -262, 594
+jmp L212
+L104: clr L165
+L105: cmp #203, #-238
+bne *r7
+L106: jsr *r3
+L107: sub r2, r0
+L108: stop
+L109: .data -766
+L110: sub *r7, L196
+L111: prn #-156
+prn L27
+stop
+L112: inc r5
+L113: .string "mgcjl"
+L114: .string "yibeqef"
+L115: .data -970, -671, 110, -268, 485, 702
+bne L120
+L116: .string "taciseuhxwdl"
+L117: add #223, L25
+L118: cmp *r6, r2
+bne *r0
+L119: .data -843, 532, -990
+L120: red *r4
+L121: mov #154, *r0
+rts
+L122: not L101
+L123: .string "idoogmoebo"
+bne *r1
+L124: jsr *r0
+dec *r7
+L125: .data 518, 349, -629, -6, -372, -991, -245
+L126: not r2
+L127: dec L97
+L128: cmp *r3, *r2
+L129: jsr L542
+L130: lea L334, r7
+not r7
+L131: not *r3
+L132: lea L48, *r3
+L133: .data -243, 862, -676, 630
+sub #115, r4
+stop
+L134: rts
+L135: jmp *r7
+L136: rts
+inc *r0
+L137: dec *r1
+L138: add *r5, L89
+jmp L83
+dec r2
+L139: rts
+mov #-218, *r7
+L140: jmp *r7
+jmp *r5
+clr r2
+L141: jmp L37
+L142: stop
+L143: red *r6
+sub #62, L115
+lea L186, *r7
+L144: .string "qkvufunyfu"
+mov #-224, *r4
+L145: add #33, L238
+L146: inc L12
+L147: stop
+red r3
+L148: add L424, r4
+dec L565
+L149: not *r5
+lea L111, r1
+L150: .string "ajymcamftkokcclgwjdr"
+red r5
+
+L151: add r5, L86
+L152: bne *r4
+clr *r2
+add r0, *r5
+red L237
+L153: .string "zcwr"
+L154: mov L419, *r7
+prn *r7
+L155: stop
+L156: jsr L512
+L157: .string "zxr"
+L158: stop
+L159: cmp #234, *r5
+L160: inc L52
+L161: dec L1
+L162: dec r2
+L163: red *r1
+inc *r7
+jsr *r2
+dec r1
+L164: .data 870, 198, -76, -676, -546, -675
+stop
+rts
+L165: cmp #69, *r1
+L166: dec r7
+L167: bne L134
+L168: inc L491
+rts
+
+lea L88, L144
+L169: jsr *r5
+L170: not *r7
+L171: bne L121
+red r3
+L172: mov L29, *r5
+L173: bne L542
+L174: not *r7
+sub #153, L129
+jmp L495
+L175: add r6, L89
+L176: jsr *r2
+sub r5, L19
+L177: cmp r6, L179
+L178: inc *r4
+L179: jsr *r7
+L180: .data -693, 672, 361, 909, -452, 826
+L181: mov L398, *r1
+jsr L139
+L182: dec *r6
+L183: inc *r1
+L184: rts
+L185: mov L35, L262
+L186: .data 741, -177, -721, 3, 283, 449, -770, 961
+L187: inc r6
+jsr *r4
+L188: sub L25, L429
+L189: lea L580, *r6
+cmp L20, r6
+L190: bne L361
+dec L582
+L191: .data 837, -276, -353, -576, -898, -508, 309, -498
+; comment
+L192: sub #42, L546
+L193: add L20, L73
+jmp *r3
+L194: red r4
+L195: clr r3
+L196: sub #150, *r6
+L197: .string "drauhhjuwdvwigefzt"
+jsr *r3
+L198: rts
+jsr L35
+cmp *r6, L83
+; comment
+L199: .data 450, 55, 635, -750
+cmp L237, #-160
+bne L57
+rts
+L200: jsr *r7
+dec *r0
+jsr L152
+inc L73
+L201: mov #-44, L472
+L202: prn #188
+L203: .string "abwbshg"
+L204: not L356
+L205: mov *r7, *r0
+not L286
+lea L95, *r7
+bne *r1
+L206: mov #173, L184
+stop
+L207: clr r6
+L208: prn r6
+L209: dec r5
+dec L564
+L210: prn L552
+L211: .string "zwbrpsdonbcm"
+L212: prn *r6
+bne L297
+L213: clr *r5
+jsr *r2
+inc *r5
+L214: inc r0
+L215: stop
+
+L216: bne *r1
+L217: .string "ddooeyuhtayqjrn"
+L218: .string "cpyqwunlywpqts"
+L219: sub L553, L157
+; comment
+L220: jmp *r7
+L221: jsr *r2
+L222: cmp #-130, #-29
+L223: lea L359, *r4
+L224: not r3
+L225: bne L133
+sub *r6, r2
+clr r5
+rts
+
+mov r5, L122
+not L135
+prn #-69
+rts
+L226: add L493, r5
+L227: jsr L537
+L228: .string "ykhbqfsnzdvzboptapree"
+L229: .data -774, 215, 670, 572, 47, -714, -766
+L230: prn r4
+red r7
+mov #149, *r0
+L231: .data 101, -258, -298
+inc L105
+L232: lea L217, r5
+inc r4
+L233: mov #201, *r6
+rts
+L234: dec r5
+L235: jsr L1
+
+L236: dec r5
+dec r5
+L237: not L134
+L238: stop
+L239: .data 218
+L240: jmp *r1
+L241: jsr L211
+jmp L166
+sub r1, L547
+jmp *r2
+cmp L536, *r5
+L242: clr r3
+clr r7
+stop
+jsr L349
+L243: not L502
+L244: sub L161, *r4
+mov L595, *r6
+L245: cmp *r2, L286
+
+L246: mov *r0, L251
+L247: red L556
+L248: mov *r6, r4
+add #24, *r6
+L249: stop
+inc r6
+L250: .string "biwagqcuvzviduro"
+L251: jsr *r1
+L252: .string "oudupwsuvxelzmmtju"
+L253: add *r5, r2
+lea L601, *r5
+sub r6, L193
+L254: sub r3, L343
+L255: .string "pmppuxa"
+L256: not r3
+L257: dec r6
+inc r0
+L258: stop
+clr L134
+L259: red L192
+L260: cmp L66, *r7
+L261: rts
+prn #-107
+L262: .data 17, -485, 238, 228
+L263: stop
+L264: mov #160, L586
+L265: .string "oowxaaurnghprkogezuxwgnn"
+inc L27
+inc r1
+bne L402
+bne *r1
+lea L29, *r2
+red r6
+jmp L167
+jsr *r7
+L266: dec L102
+L267: prn *r0
+cmp *r3, #166
+L268: inc L44
+stop
+L269: prn #-196
+rts
+lea L413, r6
+
+
+L270: mov L349, *r2
+L271: sub #87, *r7
+L272: cmp #-236, r5
+L273: stop
+L274: jmp *r6
+L275: clr *r1
+sub r5, L588
+bne *r1
+dec L299
+lea L577, r2
+L276: not r4
+L277: rts
+L278: lea L452, *r5
+L279: .string "anamhuzpogurrkhimipohs"
+
+mov r7, *r7
+rts
+L280: not r4
+not *r4
+L281: prn *r4
+L282: clr *r2
+L283: .data 588, 834, 289, 722
+L284: cmp r6, r5
+dec r6
+L285: add r4, L118
+lea L258, r2
+lea L573, r4
+red *r1
+stop
+jmp L483
+add *r6, r5
+L286: sub #7, *r0
+L287: add *r1, *r5
+L288: bne *r0
+cmp #-126, L61
+L289: inc *r6
+rts
+L290: jsr L234
+stop
+stop
+L291: inc L248
+stop
+L292: clr r4
+L293: .data 418, 503, -426, 983, 84, -866, 451, 136
+cmp #-93, #-103
+sub #9, L259
+add L213, r5
+jmp L140
+L294: inc L244
+jsr L308
+sub *r6, L154
+
+clr L252
+jsr L367
+L295: bne L347
+L296: lea L384, *r4
+L297: inc *r3
+L298: jmp L577
+L299: sub #78, L564
+L300: jmp L310
+L301: mov #-89, r6
+red r5
+L302: prn L339
+L303: dec *r5
+prn r6
+lea L393, *r3
+L304: mov #6, r4
+jsr L130
+clr r6
+L305: .data -837, 728, -678, -41, 284
+L306: cmp *r1, L347
+sub #-11, *r0
+L307: prn *r1
+L308: prn L433
+lea L220, r6
+L309: mov *r0, *r4
+clr L202
+L310: jsr L255
+add L404, r6
+L311: red L301
+mov L410, r2
+L312: inc *r5
+L313: lea L199, r4
+L314: clr r7
+L315: not r3
+clr r1
+L316: .string "nmrjmjnlglxjbjajdfhtm"
+L317: clr *r7
+L318: inc L394
+dec *r0
+; comment
+rts
+bne L556
+not *r5
+sub L409, *r6
+L319: jsr *r1
+dec *r0
+L320: prn L557
+prn L538
+add *r0, L257
+L321: prn #-200
+L322: prn r6
+not L329
+L323: not L402
+L324: red *r7
+L325: sub #-61, r3
+L326: add L526, *r4
+L327: dec *r5
+dec L548
+L328: sub *r6, L534
+L329: jmp *r7
+L330: not *r3
+L331: .data 985, -53, 584, -114, -640, 755
+L332: not L486
+add r1, r7
+; comment
+L333: jsr *r5
+L334: prn *r2
+inc *r7
+L335: clr *r4
+L336: clr *r6
+L337: bne *r5
+L338: dec r4
+L339: .string "ybxapspjybfemufw"
+L340: jsr L218
+L341: jsr *r3
+jmp L573
+L342: rts
+L343: .data 143, 207, 194, -408, -488
+L344: lea L114, r2
+clr *r6
+sub r0, r7
+cmp #199, #-143
+L345: jmp *r6
+L346: add *r0, *r2
+
+L347: lea L532, r3
+L348: mov #125, L458
+L349: jsr *r6
+L350: inc *r3
+L351: dec r5
+inc L117
+cmp #223, *r7
+L352: inc r5
+L353: sub r6, *r1
+add L495, *r6
+L354: rts
+not r1
+L355: inc L219
+red r3
+lea L585, L374
+L356: lea L550, L383
+clr *r7
+L357: dec *r7
+red *r0
+L358: prn *r0
+L359: .data -434
+L360: .data 180, -289
+rts
+inc r2
+L361: jmp *r6
+sub r1, *r5
+L362: mov *r4, L578
+L363: stop
+bne *r2
+L364: mov L32, *r5
+bne *r5
+mov *r0, r4
+L365: not r3
+L366: dec *r7
+jsr *r6
+L367: bne *r5
+mov r6, *r4
+L368: mov L15, L181
+rts
+not *r2
+L369: jsr *r2
+L370: prn #-121
+L371: not r1
+add L335, *r1
+L372: cmp r0, #113
+L373: rts
+inc r5
+cmp L566, #-238
+L374: jsr L97
+not L69
+L375: red r0
+stop
+L376: not L533
+L377: mov *r3, L445
+L378: not r6
+L379: clr L396
+; comment
+L380: .string "ucilfytpbfhynyaxjlmkdy"
+bne L166
+L381: cmp r2, #-79
+cmp r1, #-9
+L382: add #-196, L51
+sub *r1, *r7
+stop
+sub r2, *r2
+L383: .string "aahgjkcjanjfoqankliesqqm"
+L384: rts
+L385: .string "mcbjkrvxyybhjgktd"
+add *r4, L461
+L386: .data 779, -514, -414, -208, 286, 590, 974, 256
+L387: sub r5, L530
+cmp r7, *r6
+L388: not L502
+; comment
+L389: lea L93, r1
+sub r3, L137
+L390: red *r1
+L391: rts
+L392: jmp *r0
+lea L60, L543
+rts
+cmp #57, *r6
+L393: bne L368
+stop
+L394: dec L541
+L395: red L567
+mov L324, r2
+L396: red L470
+L397: lea L299, r6
+rts
+L398: not *r1
+jmp L404
+dec L101
+jmp *r0
+L399: .string "uqzfjlixaghj"
+prn #-24
+L400: inc *r0
+mov *r2, *r3
+jsr L338
+dec r3
+L401: mov #-250, *r7
+L402: bne L558
+L403: jmp *r6
+L404: clr r6
+L405: inc *r5
+not *r5
+L406: prn #29
+L407: .string "tisckawrcewmccfwaghjpi"
+L408: bne *r7
+L409: cmp r1, r5
+L410: jmp *r1
+L411: .data -880, -847, 553, 964, 430, -275, -712, 460
+L412: dec L485
+L413: lea L500, *r6
+L414: bne *r2
+not L231
+jmp *r4
+rts
+L415: red *r1
+jsr L106
+; comment
+L416: lea L277, L115
+L417: lea L598, *r1
+jmp *r1
+L418: inc r2
+L419: rts
+L420: stop
+L421: mov L69, r1
+lea L290, r7
+; comment
+jmp *r4
+inc r3
+L422: rts
+L423: bne L562
+L424: .data 573, -243, 806, 905, 627, -34
+cmp #-67, #8
+jsr L572
+L425: red *r1
+cmp L436, r3
+L426: clr r1
+clr L533
+L427: .string "zsii"
+L428: prn L213
+not L540
+lea L579, r7
+bne L133
+add *r2, r2
+L429: not *r0
+L430: cmp L354, L114
+L431: not *r5
+L432: inc *r1
+L433: jmp L501
+L434: lea L594, L443
+L435: add #37, *r5
+L436: add #94, L567
+L437: jsr L599
+jmp *r0
+L438: not r0
+L439: mov L96, *r4
+jmp *r6
+
+L440: inc L495
+; comment
+L441: .string "otxcumuybljxhqilzrhb"
+dec L236
+L442: prn L477
+L443: lea L256, L437
+L444: .data -136, -327, 122, 875
+L445: bne L13
+L446: prn *r0
+L447: sub *r1, *r2
+not r2
+L448: add *r4, L508
+L449: add #127, L447
+L450: clr r4
+jsr *r5
+dec *r1
+L451: .string "zkyqxzpauoobqlsfeejpb"
+L452: red *r7
+dec *r5
+L453: .data 655, -401, 775, 855, -70, 622, -645, 432
+L454: mov *r1, *r2
+jsr *r0
+L455: dec *r0
+stop
+jsr *r5
+L456: add L496, r7
+mov #32, r0
+red L501
+stop
+L457: .string "qvcewfftknytvmljxavl"
+L458: sub #-44, L412
+L459: stop
+red r4
+L460: prn r7
+L461: jsr *r7
+L462: .data 443, 164
+L463: rts
+L464: not r5
+red L581
+jsr *r4
+L465: not r2
+L466: lea L111, L424
+mov #-34, *r4
+L467: bne *r7
+L468: jsr L481
+sub L550, *r3
+L469: stop
+L470: mov *r5, L522
+lea L564, L537
+L471: clr L569
+L472: .string "b"
+L473: stop
+L474: stop
+L475: lea L220, *r0
+mov #-170, r4
+lea L120, L490
+clr r7
+L476: not r7
+L477: jsr L504
+not L384
+L478: rts
+L479: red *r4
+L480: prn #-132
+L481: jsr *r1
+L482: bne L211
+L483: lea L601, L524
+L484: .string "byjbfrqimcdtsacnd"
+L485: .data -565, 604, -66, 541
+L486: mov L600, r0
+L487: bne *r5
+; comment
+L488: add #115, *r2
+L489: jsr L579
+mov *r7, r1
+clr L253
+L490: sub r7, *r1
+L491: bne *r1
+L492: .data -361
+jmp L603
+lea L389, *r7
+L493: dec *r3
+L494: add L600, r0
+L495: mov #-183, *r2
+L496: jmp L220
+; comment
+; comment
+L497: jmp *r0
+L498: clr L284
+stop
+L499: bne L158
+L500: .data 523, 45, 912
+L501: add L193, L113
+L502: dec *r4
+
+L503: red *r2
+prn r7
+L504: dec L149
+stop
+L505: red L535
+L506: mov #-46, r2
+dec *r3
+L507: sub L556, *r6
+inc L591
+L508: .data 309, -118, 423, 959, -519, 89, -836
+L509: .data 601, 922, 451, 757
+L510: inc *r7
+L511: cmp *r0, L524
+L512: .string "jiaexfkefhyhjsgepwjumt"
+L513: .data 786, -852
+jmp *r3
+lea L518, r6
+L514: dec r7
+L515: jmp L38
+L516: bne L602
+red L556
+L517: jsr L194
+L518: stop
+L519: red L576
+L520: rts
+L521: not r7
+L522: mov *r0, *r3
+L523: stop
+L524: rts
+L525: not *r7
+prn r6
+L526: bne L551
+sub L345, r2
+L527: cmp r6, L161
+L528: inc L581
+L529: red L593
+inc L156
+stop
+cmp #-84, r1
+clr r5
+stop
+L530: not *r4
+sub #140, L524
+L531: clr r6
+add #-228, r0
+
+L532: add r2, r0
+L533: stop
+L534: mov L385, r4
+
+jmp L158
+dec L77
+L535: inc r3
+L536: clr L5
+L537: jmp *r5
+jmp L304
+L538: jsr L568
+L539: jmp *r4
+L540: .string "yqnhxdljjwmown"
+L541: inc *r5
+clr r1
+L542: .data -824, 98, 865, -239, -411, -271
+L543: .data -833
+L544: rts
+L545: jmp L568
+L546: red r5
+L547: cmp L527, r0
+L548: .string "ogzkfbmfwxsmvigczcdhoovk"
+clr L574
+dec *r5
+L549: clr L598
+L550: .data -327
+prn #-98
+L551: add *r7, r3
+stop
+L552: not *r2
+L553: red *r1
+L554: jsr L604
+L555: red r0
+L556: .data -485, -696
+stop
+prn L602
+jmp *r7
+L557: mov L605, *r4
+not r2
+L558: jsr L359
+clr r4
+L559: bne L236
+L560: .data -652, -269, -90, -374, -750, -104, 555, 353
+; comment
+add #89, *r2
+L561: .string "b"
+L562: inc *r3
+bne L570
+L563: clr *r7
+rts
+L564: .data -818, 342, -349
+L565: cmp *r4, r7
+inc r1
+L566: .string "lrejg"
+; comment
+L567: clr r3
+L568: red *r0
+bne L585
+sub #-15, L148
+L569: clr *r4
+L570: sub r6, L585
+dec *r0
+L571: jsr L307
+L572: bne L432
+lea L159, L541
+lea L185, L587
+L573: clr L255
+mov r5, *r5
+L574: red L301
+L575: .data 900, -206, -277, 36
+
+L576: cmp *r2, L581
+L577: stop
+L578: cmp *r0, L579
+L579: .string "bvmqobitgemiwfw"
+dec r2
+not L582
+stop
+L580: mov r0, r2
+jsr L69
+L581: lea L594, r4
+L582: clr L419
+L583: jsr L591
+inc L308
+stop
+clr *r0
+L584: prn r1
+L585: add r4, r6
+L586: red L605
+red *r6
+L587: not L605
+L588: .data -557, -137, -272, 451, -400, 270, -445, 262
+L589: not L595
+bne L598
+L590: jsr *r4
+; comment
+L591: jmp L592
+L592: red r3
+rts
+L593: mov #-233, *r7
+L594: bne L74
+clr r1
+not r7
+L595: lea L282, r0
+
+jmp L241
+jsr *r5
+
+L596: mov L603, *r5
+L597: inc r6
+dec L602
+L598: cmp #36, r6
+L599: lea L604, *r0
+L600: stop
+L601: .data -63, -463, -621, 888, -495
+L602: bne L603
+; comment
+L603: rts
+L604: bne *r2
+dec r2
+L605: cmp *r2, #41
+stop
@@ -0,0 +1,1040 @@
+; Generated by genCorpus --seed 35
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+L0: mov r0, L0
+L1: .string "dygbmx"
+L2: red L506
+not L0
+L3: .data -399, -58, 80
+L4: cmp #129, *r5
+inc L4
+jmp *r7
+L5: jsr L5
+L6: clr *r1
+L7: red *r7
+L8: prn *r5
+jmp *r1
+inc *r1
+dec *r2
+L9: add #-137, r3
+dec *r4
+L10: lea L3, L9
+L11: bne L10
+L12: add #-45, L64
+lea L6, r0
+L13: rts
+L14: sub *r4, L587
+L15: clr r3
+mov *r3, r0
+L16: clr r2
+L17: mov *r2, *r4
+L18: dec *r3
+rts
+cmp L590, *r7
+add *r4, L1
+sub *r5, *r6
+L19: not L15
+prn r7
+L20: clr *r6
+sub r7, r3
+rts
+L21: .data -862
+L22: prn r0
+lea L63, L8
+inc r7
+; comment
+L23: prn L20
+
+L24: sub L12, r3
+L25: jmp *r6
+L26: red *r0
+bne *r3
+L27: lea L223, r7
+L28: mov #200, L8
+lea L546, L14
+jmp *r4
+L29: jmp *r7
+L30: red L375
+L31: red *r7
+
+L32: bne *r7
+; comment
+; comment
+
+prn *r5
+L33: sub #104, L475
+; comment
+add r4, L274
+inc r5
+L34: stop
+L35: red *r4
+L36: red L125
+inc L396
+L37: bne *r1
+L38: add #-116, r4
+L39: jmp *r1
+L40: red *r0
+L41: lea L570, *r1
+stop
+L42: .string "nmigpvlt"
+L43: bne L1
+L44: jsr L21
+L45: stop
+bne *r2
+L46: cmp *r2, #69
+L47: .string "tyguianjucdcyavwqddi"
+; comment
+L48: sub r5, *r3
+not L10
+prn #-146
+L49: clr L120
+L50: dec *r3
+L51: jmp L10
+add r2, r4
+sub *r3, L30
+L52: clr r4
+L53: jmp L447
+add *r4, r2
+L54: prn *r0
+jmp *r0
+L55: red L449
+add *r3, r0
+prn L37
+sub r4, *r0
+L56: red L200
+; comment
+L57: lea L30, r6
+L58: sub *r7, *r1
+L59: inc r6
+cmp *r0, L262
+L60: stop
+L61: sub L47, r0
+bne *r5
+L62: rts
+; comment
+rts
+L63: mov L292, r2
+clr L46
+L64: .string "qgxaogbzitidcbtdja"
+mov #-217, *r4
+L65: clr r4
+L66: .data 27, 27, 797, -571, -12, -577, -618, -701
+L67: rts
+L68: clr L604
+add r2, *r4
+L69: .data -150, -797
+L70: red r1
+L71: dec *r4
+L72: lea L182, L25
+L73: add L63, r2
+L74: stop
+L75: rts
+L76: jmp L271
+mov #-206, L60
+jmp L480
+dec r4
+not r7
+L77: inc r2
+L78: bne *r3
+bne L443
+L79: add r6, L417
+L80: stop
+L81: rts
+L82: bne *r3
+prn L23
+L83: .data 205, -708, 256, -36, -858, -134, 235, -767
+L84: bne L76
+L85: dec *r5
+prn *r1
+L86: lea L260, r1
+L87: rts
+L88: rts
+L89: jsr L445
+L90: red r0
+L91: rts
+bne *r0
+jsr L22
+stop
+L92: inc r3
+bne L50
+L93: inc L188
+L94: .string "cwgpfaswkqazk"
+L95: .string "ifbomq"
+L96: .string "dizsfvzvpbbmhfdqkm"
+L97: jmp *r2
+L98: jmp *r0
+sub L37, *r2
+L99: jsr *r3
+L100: lea L181, L289
+mov #67, L89
+L101: red r7
+
+sub *r1, r4
+rts
+dec L131
+L102: add *r1, *r6
+L103: lea L441, L116
+L104: prn L159
+lea L5, L32
+prn #224
+L105: sub r4, r3
+L106: not r5
+dec r5
+stop
+L107: dec *r6
+bne *r5
+L108: red *r2
+jsr *r5
+L109: rts
+L110: .data -217, -565, -200
+rts
+L111: .data 709, 732, -42, 363
+L112: red r7
+L113: red *r6
+L114: lea L95, L515
+L115: .string "fzjdlvoi"
+L116: .data 653, 847
+rts
+L117: inc r7
+L118: jmp *r1
+inc r4
+L119: rts
+L120: rts
+L121: lea L28, r1
+stop
+L122: jmp *r2
+L123: add *r0, L589
+stop
+red r5
+jmp *r6
+dec r2
+L124: bne *r5
+; comment
+L125: jmp L28
+lea L564, *r1
+L126: jsr *r1
+L127: rts
+L128: dec *r5
+L129: not L29
+L130: .data -583
+L131: not *r1
+L132: bne *r7
+inc r1
+
+L133: rts
+inc *r0
+L134: red L44
+L135: rts
+L136: dec *r7
+L137: mov r6, r4
+red L77
+inc L454
+L138: prn #87
+dec *r6
+clr r7
+
+rts
+L139: not r7
+sub L39, *r0
+L140: bne L563
+lea L303, *r4
+L141: rts
+L142: clr L0
+L143: lea L43, L4
+clr *r5
+L144: sub *r6, r1
+L145: rts
+inc r3
+L146: .data 84, 429
+L147: stop
+L148: clr r5
+prn #29
+red *r0
+L149: add L49, r0
+clr L120
+L150: clr r6
+inc r2
+L151: red L309
+L152: lea L212, r1
+L153: not *r2
+L154: bne *r3
+L155: .data -780, -478, 486, -93, -90, 293
+prn *r0
+L156: red L211
+L157: rts
+; comment
+inc L170
+sub r1, L151
+mov L508, L19
+
+lea L123, r4
+not *r5
+L158: not r7
+L159: .data 816, 946, 668, -27, -356, -223, 886
+L160: cmp *r5, #110
+lea L447, L103
+L161: lea L143, r7
+L162: cmp L353, *r2
+L163: rts
+not r5
+L164: cmp #175, r6
+L165: lea L310, r0
+add r4, L8
+L166: add r5, L221
+stop
+sub #-140, r4
+L167: mov r4, r1
+L168: sub r3, *r6
+L169: not r3
+L170: jsr L567
+L171: .data -215, 62, -289, -637, 375, -911, 234
+L172: stop
+L173: .string "rrwt"
+rts
+L174: .data 357, 673, 745
+L175: .string "hbzosohgbqoyhuefr"
+clr r6
+jmp *r6
+L176: add #67, r5
+clr r5
+rts
+prn L38
+L177: .data 821, -177, 625, 316, -413, 369, 799
+not L46
+dec *r6
+L178: .data 549, 501, -215, -903
+L179: .data 364, 120, 979, 164
+L180: inc *r3
+L181: cmp #180, r2
+add *r3, *r0
+dec L528
+inc L165
+L182: lea L321, L191
+L183: prn #29
+prn r0
+
+mov r2, r1
+L184: jmp L34
+L185: sub r5, r0
+L186: jsr L344
+L187: rts
+L188: sub L466, r4
+add L167, r6
+L189: .string "xrpvtiheqic"
+L190: .string "racxswbtr"
+L191: dec *r0
+L192: cmp #-162, *r1
+L193: jmp L147
+red r5
+L194: clr *r4
+L195: .string "lxjymsqbbyffksf"
+sub #188, r2
+L196: sub #-85, r1
+L197: .data -737, -683, -778, -583, -472
+L198: red r4
+L199: jsr L138
+bne *r7
+L200: not r5
+; comment
+L201: clr *r4
+L202: not *r7
+sub L562, r2
+mov r1, L66
+L203: red r1
+L204: prn r0
+L205: stop
+stop
+L206: cmp r0, r1
+L207: lea L61, L51
+rts
+
+red L328
+L208: sub r2, *r5
+jmp L382
+L209: clr r5
+not r4
+jmp L333
+
+L210: add *r5, r4
+L211: cmp #-128, #11
+L212: lea L178, L30
+
+L213: add r5, *r5
+L214: .string "bzdpvbjaunnnxmsdu"
+inc r1
+L215: .data 580, 900, 270
+L216: add L117, r1
+add r1, L118
+rts
+L217: cmp *r7, #-214
+jmp *r1
+red *r5
+jmp L112
+L218: cmp *r5, *r1
+sub L147, *r5
+L219: bne L275
+L220: not r4
+L221: add r2, L243
+L222: cmp #5, L128
+stop
+L223: bne L443
+inc L153
+cmp *r6, L90
+red *r3
+mov *r0, *r3
+L224: lea L84, *r6
+L225: jsr *r6
+jsr *r1
+L226: not *r0
+L227: stop
+jmp *r4
+not *r1
+L228: lea L159, L120
+add #33, r5
+clr L554
+L229: .data -963, -537, 32, 484, 19, -188, -756, 11
+L230: stop
+inc L133
+L231: jmp *r7
+bne *r0
+cmp r2, *r3
+L232: .data -582, -654, 977
+L233: .data -283, 905, -390, 709, -342
+L234: lea L132, r6
+L235: .data -870
+L236: .string "hhhwnhtdlukiq"
+L237: rts
+clr L9
+L238: lea L101, *r7
+L239: inc r3
+clr *r5
+red r5
+L240: mov *r1, *r3
+not L469
+inc L321
+L241: jsr *r5
+L242: clr r2
+L243: prn L64
+dec *r3
+add *r1, *r4
+inc L101
+
+L244: lea L50, *r1
+sub L12, r0
+not L513
+cmp r1, #-32
+; comment
+L245: rts
+L246: cmp r1, *r2
+lea L319, L228
+not r6
+L247: red r4
+L248: add #-217, *r5
+L249: add *r1, *r0
+L250: prn #-76
+jmp *r0
+L251: inc r6
+L252: bne *r0
+jsr *r5
+L253: .string "lkaplgwsd"
+L254: dec *r3
+L255: clr r2
+bne L151
+sub L116, L74
+L256: cmp r7, #-36
+L257: jmp *r5
+lea L466, r0
+L258: .string "vxfidnefbwxadrl"
+L259: red L252
+L260: sub r5, *r6
+L261: sub *r7, L443
+dec L284
+L262: clr r4
+L263: not L205
+L264: .string "jjocblhjdsetsspduyierf"
+L265: not *r3
+L266: red r2
+L267: lea L337, r5
+stop
+L268: not r6
+L269: lea L104, r3
+; comment
+L270: lea L280, r4
+L271: .data -505, -663
+add #-153, L267
+L272: .data -799, -461, -159, -345, -288, -168
+L273: clr *r4
+bne *r0
+L274: inc L379
+L275: red L481
+not r3
+bne L117
+L276: lea L285, r0
+L277: cmp #-211, *r7
+red *r7
+L278: sub *r7, r1
+L279: bne L67
+L280: cmp r0, r5
+L281: .data 884, 240, 219, -179, -626, 64, 6, 414
+lea L232, r0
+L282: stop
+
+red r3
+L283: .string "ijlvkvjgld"
+add L154, L481
+L284: .string "citbiqfpmslnpabfjq"
+add r7, L446
+L285: sub #-249, L266
+L286: not r0
+mov *r1, *r0
+prn *r2
+L287: .data 910, -914
+L288: jsr *r0
+L289: rts
+L290: .string "bfpzepiur"
+L291: inc L601
+not r2
+L292: clr L113
+mov *r1, r3
+L293: rts
+L294: jsr L195
+L295: red L242
+mov *r7, *r3
+L296: lea L404, *r0
+L297: jmp *r4
+L298: mov L456, L445
+red *r1
+L299: bne L247
+L300: sub *r2, r3
+add *r6, *r5
+L301: sub #-16, r0
+L302: add *r3, r1
+; comment
+L303: jmp *r2
+L304: sub r7, *r2
+L305: bne *r1
+L306: jsr L10
+mov #143, L268
+add r2, L345
+dec r6
+L307: cmp r4, r6
+L308: .string "ecq"
+L309: .data 987, -953, -928
+dec *r2
+L310: stop
+L311: not r2
+L312: rts
+red *r7
+L313: add #245, *r1
+L314: sub *r6, L449
+L315: not r4
+L316: clr L108
+L317: dec r3
+L318: add r0, r3
+L319: not L411
+lea L137, r0
+stop
+lea L68, L113
+L320: stop
+L321: jmp *r3
+L322: inc r0
+L323: clr L164
+L324: inc r1
+L325: sub L346, r0
+L326: cmp r1, *r7
+L327: prn #124
+L328: jsr *r1
+L329: cmp *r1, L454
+L330: stop
+L331: add #148, *r5
+L332: lea L423, r4
+clr r6
+L333: add r1, r3
+L334: .data 11, 374, -954, -668
+clr r5
+L335: clr *r7
+L336: .data -865, -171, -885, 437
+L337: add L310, *r2
+L338: red r6
+L339: bne *r0
+L340: cmp r3, #223
+jmp *r1
+rts
+L341: jsr *r3
+L342: clr r4
+L343: .data 267, -492, -63, -438, -809, 698, -327
+jsr *r3
+clr *r0
+bne *r6
+jmp L575
+L344: red L489
+L345: dec r2
+L346: .data -944, 12, 49, 6, -812, 207, -309, 171
+L347: dec L171
+bne L365
+clr *r3
+L348: jmp *r6
+L349: bne L151
+mov r4, L113
+inc r7
+rts
+L350: cmp L258, r2
+mov *r6, L187
+L351: lea L402, L441
+clr *r6
+L352: bne *r1
+L353: dec *r4
+cmp *r7, #-216
+jsr L366
+red L405
+add L175, *r7
+mov r3, r6
+L354: jmp *r3
+
+L355: prn *r4
+L356: prn #-249
+L357: red L116
+L358: lea L509, *r0
+mov r3, L152
+L359: stop
+L360: .string "lamvtshax"
+mov L241, r1
+L361: jmp *r3
+not L106
+L362: cmp *r0, r5
+L363: jsr *r2
+L364: not r0
+jsr L82
+L365: prn *r2
+add *r4, r6
+L366: sub r0, L314
+L367: clr *r3
+L368: bne *r3
+inc L538
+prn #12
+L369: rts
+dec L492
+L370: .string "inhblyxckszxufqkga"
+cmp *r0, #160
+L371: stop
+L372: cmp r3, *r2
+L373: dec r5
+prn L546
+L374: jmp *r5
+L375: .string "dfhjxmtfvk"
+stop
+; comment
+L376: .string "ojonokocjnqznsylxqetbc"
+mov #115, *r3
+stop
+L377: .string "cnkhrh"
+; comment
+L378: not *r5
+L379: clr r7
+L380: mov #45, *r1
+L381: sub #79, r6
+stop
+L382: jmp L596
+inc L424
+dec r6
+L383: lea L595, *r6
+L384: inc *r7
+L385: rts
+L386: rts
+L387: .data -687
+L388: prn L451
+L389: prn r1
+clr *r3
+prn #-250
+L390: .data -188, -719, 106, -90, -543, -801
+L391: add #31, r5
+jmp L573
+jsr *r7
+L392: red L366
+not r7
+L393: rts
+L394: prn L194
+L395: clr *r2
+L396: .string "vwvayvdivtonjzyjocnt"
+jsr *r1
+L397: inc *r5
+L398: .data -957, 831
+L399: cmp L452, #-237
+L400: cmp #59, L564
+L401: .data -354, -793, 672
+L402: bne L503
+L403: dec *r5
+L404: red L154
+L405: lea L25, r3
+L406: bne *r4
+L407: mov r6, *r7
+L408: prn L173
+L409: sub #-120, L501
+prn L407
+L410: inc *r1
+jsr *r6
+
+L411: inc r6
+L412: lea L477, L70
+L413: inc *r7
+L414: sub r6, r0
+mov L576, *r3
+L415: mov L328, *r7
+L416: inc L262
+L417: prn *r6
+L418: not L339
+
+L419: clr r3
+not *r1
+L420: lea L554, *r0
+L421: prn r4
+L422: not L492
+L423: dec L485
+L424: .data 429
+L425: jsr L306
+not *r4
+L426: jsr *r1
+red *r5
+L427: add L137, r3
+L428: stop
+add L456, L11
+red r3
+L429: stop
+L430: cmp #61, L462
+L431: red *r3
+L432: inc r5
+cmp r7, r6
+L433: .data -938, -421, 730, -704, -918, 849, 487, -922
+inc r5
+L434: jmp *r2
+clr *r5
+L435: stop
+red r3
+mov r7, *r3
+L436: lea L581, r5
+L437: stop
+L438: .string "lblarpwyrwoawmvkc"
+L439: jmp L479
+L440: mov L374, r3
+L441: bne *r5
+L442: jmp L481
+L443: .data 314, -81, -237, 400
+not *r7
+L444: prn #-223
+prn *r7
+L445: dec *r5
+L446: lea L124, *r3
+L447: add r7, r0
+mov L121, *r1
+L448: rts
+mov L436, r1
+sub L111, *r2
+jsr *r1
+L449: dec *r3
+L450: .data -932, -216
+rts
+L451: .data 906, 578
+; comment
+L452: inc *r1
+L453: .data -945, 9, -815, -617, -669
+L454: red r4
+L455: inc r6
+L456: .data 91, 966, 368, -6, -145, -377, -15
+L457: rts
+cmp L554, #-46
+rts
+stop
+L458: sub *r0, *r5
+jmp *r0
+mov r6, r5
+L459: jmp *r5
+jsr L294
+L460: clr *r0
+L461: bne L488
+inc *r3
+L462: clr *r3
+L463: add *r7, L204
+L464: rts
+L465: sub r4, r2
+L466: prn r1
+L467: .string "gghxkpvdxvkmewfzqdnrqhda"
+red *r1
+cmp #-141, L550
+
+mov r7, L446
+L468: jmp L174
+red L500
+cmp L74, #234
+red *r1
+L469: inc *r0
+sub #-153, r2
+red L575
+not L528
+L470: .data -291, -736, -489, 767, 107, 33, -615, 502
+stop
+jsr *r7
+; comment
+lea L434, r6
+rts
+L471: stop
+L472: jmp *r4
+red r2
+L473: rts
+add r0, r5
+L474: .string "jfsumweu"
+L475: add *r1, *r4
+L476: clr L164
+lea L347, L19
+red r5
+L477: clr r0
+not *r2
+L478: .data -217, -260
+L479: rts
+clr *r6
+red L27
+sub r0, *r6
+
+L480: red r0
+inc *r1
+cmp r0, #-229
+L481: lea L489, r6
+red *r1
+L482: clr L140
+jsr L344
+L483: bne *r2
+L484: .data 368, -747
+L485: .data -574, 144, -626, 17, 671, 843, -492, 829
+L486: rts
+rts
+mov #37, *r0
+L487: add r7, *r2
+prn r1
+L488: red L489
+L489: dec *r7
+L490: lea L470, r4
+L491: cmp *r2, *r6
+L492: .data -942, -627, -885, -596, -236
+red L606
+L493: stop
+L494: sub #-198, *r2
+L495: jsr *r6
+L496: lea L251, r2
+L497: bne *r7
+; comment
+mov #-84, *r1
+L498: lea L168, r1
+jsr L532
+inc *r4
+jsr L83
+L499: mov L598, r6
+prn L258
+not r7
+sub #175, *r2
+stop
+; comment
+mov r3, *r7
+
+L500: rts
+rts
+L501: cmp r4, L90
+L502: prn *r4
+jsr *r5
+L503: dec L530
+cmp L518, #62
+L504: red L586
+inc L590
+L505: .string "b"
+L506: prn r3
+L507: .data 106, -256, 909, -903, -507, -550, -661, -83
+stop
+L508: stop
+mov L244, *r7
+add L601, r5
+rts
+inc L528
+L509: lea L148, r5
+L510: stop
+prn L43
+L511: red r2
+clr *r5
+mov #-189, r0
+mov #-84, L571
+L512: clr r5
+L513: rts
+L514: .string "ynrtm"
+L515: not L371
+stop
+L516: sub L594, r1
+red r6
+L517: rts
+L518: bne L524
+L519: red L552
+L520: rts
+jsr L572
+L521: cmp L592, #111
+rts
+L522: jmp L538
+L523: bne L88
+L524: mov *r2, L541
+cmp *r4, L367
+L525: rts
+; comment
+L526: bne L592
+L527: inc *r6
+L528: rts
+dec L590
+L529: .data -660, 411
+L530: jsr L589
+add r5, L531
+
+L531: dec L101
+L532: .string "zkcvskydjkpw"
+inc r2
+L533: red L605
+L534: not *r7
+red *r4
+L535: red L160
+jmp L161
+jsr L302
+cmp *r6, L555
+sub *r2, L33
+L536: jmp *r6
+mov #-86, L410
+L537: jsr L551
+not L109
+L538: .string "brxsmqapay"
+; comment
+L539: cmp *r2, *r5
+L540: sub L558, *r5
+L541: rts
+not r2
+jmp *r5
+lea L542, L190
+L542: .data 333, 183, 810, -562, 397, -141, -687
+L543: .data -348
+L544: cmp r2, r7
+mov #-60, *r7
+inc L80
+L545: mov L299, r3
+L546: .data 392, -256
+rts
+L547: .data 870, -162, 824, -939, 620, -281, 72
+L548: .string "sirmj"
+L549: .string "irwn"
+L550: lea L90, r2
+jmp L496
+bne L605
+L551: rts
+L552: add #139, L353
+L553: jsr *r4
+L554: add #-234, *r6
+jmp *r7
+L555: .data 68, 16, 928, 726, 608, -413
+cmp *r6, #170
+rts
+jmp *r0
+; comment
+L556: cmp r4, L281
+jmp L224
+L557: .string "gcty"
+L558: inc r3
+L559: dec r6
+prn #130
+L560: bne L558
+L561: bne *r4
+L562: stop
+L563: not r7
+L564: rts
+stop
+L565: jsr L565
+L566: mov r1, L422
+L567: sub *r1, L605
+L568: cmp L603, L263
+
+L569: .string "vbeszpxodteqi"
+L570: jmp *r1
+L571: jmp L607
+L572: bne L545
+mov *r7, r5
+L573: not *r5
+L574: .string "h"
+
+L575: .string "bifgirwna"
+L576: dec *r6
+dec *r4
+L577: not *r1
+; comment
+L578: jmp *r7
+L579: cmp L597, L247
+L580: add L595, *r4
+L581: jmp *r3
+L582: prn r5
+L583: stop
+L584: .data 280, -368, -684, -318, 70, 625
+L585: jmp L493
+sub r4, r6
+L586: inc *r2
+L587: .data -910, -51
+L588: sub *r7, r5
+L589: lea L596, *r2
+L590: cmp #-197, L591
+L591: stop
+dec L298
+L592: stop
+L593: not L498
+L594: red L603
+L595: clr *r0
+red L461
+rts
+L596: .data -699, -250, -275, 685, -875, 106
+L597: prn r5
+L598: .string "eypubtn"
+L599: bne *r1
+mov *r3, r2
+L600: .data 0, 622, 62, 481, 27, -551, 481, -713
+L601: jmp L603
+L602: .data -217, 402, 818, -727, -835, -653, 866
+L603: prn #60
+stop
+prn #214
+L604: dec r7
+L605: jmp *r0
+L606: dec *r1
+L607: .string "ehztdsgdcoltcvh"
+stop
@@ -0,0 +1,1041 @@
+; Generated by genCorpus --seed 36
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+L0: clr L32
+L1: cmp L1, *r3
+red r4
+L2: inc r4
+L3: mov *r5, *r3
+L4: jsr L525
+lea L13, L98
+lea L336, L2
+not *r6
+L5: .string "pqxbjtfwstitzotqvgazep"
+L6: prn *r4
+lea L3, r3
+sub #1, *r2
+L7: jsr *r1
+rts
+jmp L140
+L8: inc L5
+L9: stop
+add r1, *r5
+sub L273, L309
+L10: .string "nuxsfthpbpciqk"
+cmp r6, L278
+stop
+L11: .string "fpmsqyxwzxrtopgufxtqhlv"
+lea L442, r0
+; comment
+L12: sub #197, L206
+L13: jsr *r2
+L14: clr L13
+red *r3
+add *r5, r5
+L15: sub #71, L15
+L16: prn r1
+; comment
+rts
+mov *r7, r6
+L17: rts
+L18: prn L15
+L19: sub L126, L7
+add #232, *r1
+L20: inc *r6
+L21: prn *r0
+jsr L1
+L22: rts
+L23: mov #-245, *r4
+inc L338
+dec L567
+L24: inc r2
+
+L25: inc *r0
+L26: rts
+L27: .data -733
+L28: lea L379, L26
+L29: .data 817, -237, 220, 978
+L30: inc *r7
+; comment
+L31: .string "mqicad"
+L32: not *r2
+; comment
+L33: cmp r1, r6
+; comment
+rts
+not *r6
+L34: red L31
+L35: inc *r3
+L36: stop
+
+; comment
+L37: sub L26, L62
+sub L36, r3
+L38: dec r6
+L39: prn #74
+L40: rts
+L41: dec r3
+L42: jsr *r7
+L43: rts
+L44: .data -54, -732, -894, 596, -871
+stop
+lea L18, L15
+L45: .string "rwe"
+L46: jmp L585
+L47: .data -693, -834, -719
+jmp *r5
+L48: add *r1, *r3
+L49: jmp *r3
+red r1
+L50: lea L485, *r4
+L51: add r1, r5
+red r4
+L52: .string "gkffyhpmwhpao"
+L53: lea L386, *r0
+L54: red r1
+red *r0
+L55: jsr *r3
+dec r6
+L56: .data -964, -980, 144, 174, 600, 450, 459, 935
+L57: .string "oox"
+mov L37, *r6
+jsr *r7
+jmp *r1
+L58: mov r6, L223
+L59: inc r3
+L60: lea L214, *r7
+L61: jmp L579
+L62: .data 878, -538, -416, -916, -383, -3
+
+rts
+prn *r3
+mov r2, L461
+L63: bne *r4
+L64: stop
+L65: .data 867, -769, 354, -766, -506, 995, -640, 111
+L66: .string "zqmmjkkbjignhxt"
+
+L67: red r6
+L68: .string "etidegwcxqnbszus"
+clr L38
+add #255, r5
+bne L34
+L69: sub *r6, *r7
+jsr *r1
+L70: .data -672, 878, -583
+L71: mov #152, L204
+jsr *r3
+jsr *r0
+L72: clr *r5
+L73: rts
+stop
+bne L111
+stop
+; comment
+L74: .string "iyqeerazngvtpbhm"
+jmp L536
+mov r3, *r3
+not *r2
+clr L469
+rts
+L75: .data -915
+L76: inc r4
+L77: not L370
+mov #213, L68
+L78: dec *r7
+jmp L293
+L79: add *r3, *r2
+clr r7
+L80: .string "g"
+L81: sub L116, r6
+L82: not L206
+L83: bne L212
+L84: prn *r7
+L85: .string "gqsskkneysbscceevwbpno"
+L86: stop
+
+stop
+L87: lea L498, *r0
+stop
+bne L543
+bne *r0
+red L183
+L88: mov #-12, *r3
+L89: lea L270, r0
+add *r2, L330
+not *r6
+L90: .data 134, 482, 948, 409, 5, 164
+L91: add *r2, r1
+L92: add *r0, r2
+jmp L458
+L93: jmp L209
+L94: cmp #91, L134
+L95: .data 576, -952, -653
+L96: .string "wfhllq"
+L97: bne L470
+L98: .string "ivavl"
+L99: clr L50
+
+cmp *r3, r0
+L100: prn #-200
+prn r0
+stop
+L101: mov L514, L216
+L102: inc *r3
+clr *r5
+L103: mov #184, L88
+L104: lea L101, *r4
+L105: stop
+L106: .data 796, 898, 386, 126, 373, 862
+L107: lea L76, L71
+L108: rts
+stop
+L109: bne L584
+L110: not L34
+dec *r4
+L111: not L403
+add #-54, r0
+jsr *r4
+L112: prn #26
+
+L113: mov #-106, *r5
+L114: .data -236, 703, -919, -948, 971
+L115: jmp *r2
+mov #163, *r7
+L116: inc r3
+L117: prn #15
+jsr L44
+cmp #250, L44
+L118: jmp *r6
+L119: prn r7
+L120: cmp #30, L603
+L121: mov *r3, L39
+not L104
+L122: .data -778
+L123: bne *r5
+L124: .string "pfa"
+add r2, r4
+; comment
+L125: jsr L243
+L126: clr L340
+L127: not *r0
+lea L1, r3
+stop
+rts
+mov r4, r0
+L128: sub r5, *r0
+L129: add r3, r3
+L130: clr L414
+L131: bne *r1
+L132: jsr *r0
+jmp L21
+L133: stop
+L134: .string "kf"
+inc L356
+L135: stop
+rts
+L136: cmp *r7, L46
+L137: sub *r2, *r4
+inc L109
+L138: lea L204, *r2
+jmp L118
+L139: bne L30
+L140: sub *r1, r6
+L141: clr *r2
+L142: rts
+L143: inc *r3
+prn r5
+jsr *r2
+red *r4
+cmp #-153, r6
+L144: sub L72, *r4
+dec L320
+rts
+L145: inc *r1
+L146: rts
+L147: lea L145, *r3
+L148: bne L122
+L149: prn L609
+L150: inc *r1
+L151: bne *r3
+bne L102
+dec *r5
+L152: .string "yxesgqtdvevuybwylbff"
+dec r5
+L153: .string "nkqoxlvcphh"
+L154: rts
+L155: inc *r7
+sub r1, *r1
+L156: .data -497, -655, 471, -229, 455, -109
+L157: rts
+not r4
+lea L277, *r3
+L158: rts
+L159: inc *r4
+sub r2, L16
+L160: .string "jpnzwmputgkgsnajtzqocxj"
+jsr *r4
+red L3
+stop
+L161: mov L223, r3
+L162: prn #-183
+L163: clr *r1
+dec L538
+L164: .data 852
+L165: red r0
+jsr *r4
+jsr *r6
+dec r5
+L166: dec *r7
+L167: jsr L328
+inc *r7
+cmp *r6, L102
+L168: lea L337, *r6
+L169: stop
+L170: mov L55, r5
+L171: add *r5, L394
+L172: .data 717, 878, 87, -339, 750, -658
+bne L76
+L173: rts
+lea L327, r0
+inc L578
+L174: not *r1
+jmp L3
+L175: .string "ichcbg"
+cmp *r4, L135
+add #-251, r2
+L176: stop
+red *r2
+L177: prn #102
+; comment
+L178: jmp L445
+lea L515, L107
+red r0
+L179: inc *r7
+L180: lea L486, *r7
+clr *r2
+L181: clr L494
+clr L109
+L182: clr L564
+sub r0, r1
+L183: inc r3
+L184: .data -379, 82, 610, 528, 158, -12, -463
+L185: cmp *r7, #-75
+not *r2
+L186: jsr *r3
+L187: inc r6
+not r6
+not *r7
+mov L2, r1
+bne *r0
+sub #63, L28
+L188: prn *r4
+L189: .data -531, 524, -308
+stop
+L190: inc *r4
+jsr L52
+L191: sub r2, *r4
+L192: not *r3
+L193: prn r2
+L194: .data -232, -514, 25, 679, -12, 679, -274, 189
+L195: .data -892, 455, -767, 852, -751, -517
+L196: stop
+L197: lea L68, r1
+jmp L60
+inc r3
+L198: .data -489, -40, 825, 46, -586, 358, 416, 385
+L199: stop
+L200: .data -913, 880, 239, 911, -200
+bne L233
+L201: inc *r3
+L202: lea L27, r7
+jmp *r2
+jmp L104
+L203: dec *r4
+L204: stop
+L205: add *r7, L508
+add *r2, L344
+rts
+L206: bne *r3
+L207: inc L102
+L208: inc *r6
+L209: clr *r4
+L210: jmp L199
+L211: bne *r5
+L212: inc L20
+add L62, r6
+L213: bne L520
+L214: add #55, *r0
+L215: sub r1, r2
+mov r2, L142
+L216: not r4
+L217: .data -457, 594, 73, 309
+L218: dec L40
+not L132
+L219: sub *r5, L138
+add *r1, r4
+L220: .data 39
+L221: .string "xbehtypw"
+L222: .string "smdk"
+L223: .data -324, -139, -510, 510
+; comment
+L224: .data 369, 716
+L225: clr L355
+L226: stop
+L227: clr *r4
+L228: inc r6
+L229: add #-94, L375
+dec L319
+L230: sub r6, r0
+L231: prn r1
+L232: dec *r0
+L233: inc *r6
+cmp L296, L144
+L234: bne L160
+rts
+stop
+L235: lea L474, *r2
+L236: sub *r3, r0
+L237: not r6
+L238: cmp *r4, L275
+add r0, L513
+not *r0
+L239: cmp r2, *r1
+L240: add *r1, L409
+L241: bne *r4
+mov *r2, r0
+L242: .string "obrw"
+
+clr r6
+rts
+L243: .string "ckmyjwt"
+L244: rts
+L245: sub r4, *r4
+inc r2
+jsr *r1
+sub r2, *r6
+L246: dec r6
+cmp L222, r4
+L247: lea L388, *r5
+L248: lea L225, L512
+L249: prn #236
+rts
+cmp *r2, *r0
+L250: .string "qxngbpjvjtqkezwayday"
+; comment
+L251: not r4
+not r5
+prn #-122
+L252: stop
+L253: add *r5, r5
+L254: bne *r5
+L255: .data 345, 489, -916, -623, -229, 73, -299, 174
+L256: clr *r5
+L257: rts
+L258: jmp *r0
+L259: rts
+L260: bne L456
+L261: inc L268
+L262: rts
+L263: cmp r2, *r3
+L264: .string "zrtosfzulhoyxmx"
+L265: clr *r1
+L266: sub *r2, L189
+jmp *r1
+L267: .string "zvlvhquqwcxxytoruruszybu"
+jsr *r0
+L268: prn r7
+stop
+L269: add *r3, L102
+inc r5
+L270: jmp *r6
+L271: inc L468
+jmp *r2
+jsr *r4
+inc L165
+L272: dec *r7
+bne *r3
+cmp L53, r1
+L273: sub L582, *r1
+L274: sub #165, r7
+
+L275: .string "rosddxcptwzeghc"
+L276: prn #169
+L277: rts
+L278: dec L279
+L279: jmp *r6
+L280: inc L243
+L281: red r2
+L282: .string "p"
+inc L116
+L283: add L440, *r0
+rts
+L284: lea L117, *r6
+L285: lea L16, r6
+L286: jmp *r0
+not *r0
+red *r4
+jmp *r2
+L287: prn r4
+L288: jmp *r2
+L289: bne L225
+L290: jmp L239
+L291: .string "n"
+sub *r6, L145
+
+L292: clr *r1
+L293: jmp *r4
+not *r3
+L294: sub r3, L500
+L295: stop
+L296: stop
+not L6
+L297: red *r7
+L298: clr r2
+L299: prn #-3
+red *r3
+cmp *r3, *r2
+L300: lea L10, L148
+prn *r6
+L301: jmp *r4
+L302: .data -476, -5, -601, -628, 843, 247
+not *r6
+rts
+L303: jsr L297
+bne L120
+L304: .string "ebw"
+rts
+add r3, L227
+L305: not *r5
+L306: jsr *r1
+L307: .string "dkhcyutifptvkzxhxyvlzmgs"
+prn L273
+L308: not r6
+L309: bne L422
+L310: jsr *r5
+
+L311: .data -145, 964, 574, 739
+L312: inc *r6
+L313: jsr L420
+jsr L82
+; comment
+rts
+L314: stop
+L315: add r5, L541
+L316: add r0, L536
+L317: not L558
+bne *r1
+L318: mov r6, r6
+inc r0
+L319: jsr L588
+clr *r2
+L320: add r2, *r0
+jsr L463
+L321: inc L294
+stop
+L322: stop
+inc *r3
+L323: red L367
+jmp *r5
+L324: jsr L159
+inc L241
+L325: stop
+bne *r6
+L326: prn #-7
+L327: .string "chjzniy"
+L328: prn L512
+not r1
+L329: add #162, *r1
+L330: prn L472
+L331: prn #-252
+L332: sub #-159, *r3
+L333: rts
+L334: add r2, r7
+L335: add *r0, L97
+L336: dec L497
+mov L560, r4
+L337: prn L484
+L338: sub *r6, *r3
+dec L158
+L339: bne L362
+L340: mov r2, L206
+; comment
+L341: sub r5, *r6
+L342: prn L569
+L343: sub #-22, L470
+L344: add *r0, *r1
+L345: dec L75
+
+L346: prn *r4
+L347: bne *r5
+bne *r7
+not L438
+inc r5
+jmp *r1
+L348: dec L185
+mov r7, L7
+jmp L185
+L349: jmp L109
+L350: lea L22, L516
+L351: rts
+L352: bne *r4
+L353: mov *r1, *r1
+L354: jmp L550
+L355: sub #53, *r5
+L356: rts
+L357: cmp #55, *r5
+; comment
+add #-70, *r5
+L358: .string "ycyyukmgtlbdclz"
+L359: sub #126, r7
+L360: stop
+; comment
+jsr L343
+L361: bne *r0
+
+L362: sub r5, L419
+jmp L504
+L363: .data -252
+dec *r5
+red *r0
+L364: inc L354
+L365: .data 95, 976, -853
+L366: red L608
+jsr L398
+L367: stop
+L368: mov #-28, L584
+
+L369: .string "ivoinxnm"
+L370: mov L51, L175
+L371: rts
+rts
+jmp *r0
+sub #236, r7
+clr *r5
+L372: .string "ijjqmiffpleffi"
+L373: inc *r3
+lea L384, *r3
+L374: dec *r3
+L375: bne L386
+jmp *r0
+jmp L290
+L376: mov #-256, L537
+
+rts
+rts
+L377: rts
+
+L378: dec L27
+sub L212, *r5
+L379: stop
+jsr *r7
+L380: bne *r7
+lea L77, *r2
+add #-245, r3
+L381: bne L483
+L382: cmp #-117, L378
+L383: inc r1
+prn #-174
+mov #182, L250
+L384: add *r4, r1
+L385: inc L503
+dec r0
+L386: cmp #-6, L21
+L387: .data 46, -544, 743, 993, -855, -913, -365
+L388: prn L460
+L389: dec L199
+L390: prn *r6
+clr r1
+jmp L189
+L391: jmp *r4
+L392: jmp L589
+sub r0, *r7
+L393: rts
+stop
+L394: bne L358
+L395: rts
+L396: not L155
+L397: inc r5
+L398: prn #-224
+; comment
+cmp L96, L115
+not L458
+L399: lea L156, r2
+L400: red L562
+L401: dec *r1
+L402: jsr *r7
+clr r3
+L403: add *r6, L52
+
+L404: cmp L408, L263
+sub r5, r2
+L405: inc r6
+
+L406: .data 678, -247, 722, -462
+stop
+L407: stop
+L408: sub r5, *r2
+prn *r7
+not r6
+L409: inc r3
+L410: rts
+
+L411: jsr *r0
+dec r1
+L412: mov r1, r0
+L413: prn *r7
+L414: prn L158
+sub L223, r3
+L415: jmp *r2
+stop
+cmp L558, #-210
+L416: mov #216, *r5
+L417: clr r3
+
+L418: stop
+L419: clr L595
+prn *r3
+L420: rts
+L421: .string "gdxp"
+red r1
+L422: sub L306, r3
+L423: sub *r3, L457
+L424: jmp L434
+L425: sub #-51, *r4
+add #-124, L359
+L426: inc L59
+red *r4
+L427: jsr *r6
+sub r7, L264
+dec L492
+bne L152
+bne L18
+L428: mov *r6, r4
+L429: dec r0
+L430: bne *r0
+clr r2
+L431: cmp L528, *r5
+L432: red r1
+dec L279
+; comment
+add *r3, L164
+L433: stop
+L434: jmp L90
+L435: cmp #179, #198
+L436: lea L476, *r0
+L437: sub r3, L585
+L438: mov #27, *r1
+L439: mov #-97, r3
+L440: prn r7
+L441: prn *r3
+prn L140
+mov *r5, r6
+L442: .string "zt"
+
+L443: lea L492, L123
+
+lea L552, *r5
+L444: prn r7
+mov *r3, L61
+L445: cmp L513, L315
+prn #-226
+lea L459, r1
+L446: bne *r4
+; comment
+cmp r3, *r7
+lea L608, L586
+L447: inc L374
+L448: .data 127, -248, -770, -580, -4, -450
+L449: sub r0, *r2
+red L454
+L450: jsr *r3
+L451: lea L102, r2
+rts
+L452: clr r6
+not r6
+L453: mov L508, L270
+prn *r4
+L454: inc L208
+L455: dec *r1
+L456: prn *r0
+L457: mov *r5, L585
+L458: mov r7, r4
+dec *r7
+L459: bne L590
+lea L599, *r1
+lea L288, r4
+L460: stop
+L461: inc r0
+L462: .string "vtyyvwcphbfufqxb"
+L463: .string "rzmihvbmvicxdovjrznk"
+L464: clr *r1
+dec L184
+L465: not *r1
+L466: prn #-89
+L467: .string "yzanoowdinzztqj"
+cmp #-124, r6
+inc L16
+L468: add #-209, r0
+inc r5
+rts
+bne L527
+L469: cmp L548, r3
+L470: cmp #-182, r2
+bne *r6
+L471: add r3, *r2
+L472: .data 755, 705, 775, 918, -89
+sub #-69, L571
+L473: red *r6
+L474: .data 773, -711, -650, -191
+L475: not L534
+jsr *r3
+L476: prn r0
+L477: jmp *r4
+L478: lea L506, L489
+L479: not *r1
+L480: red *r5
+L481: not *r3
+L482: rts
+L483: cmp #-170, *r7
+L484: red r6
+L485: jmp *r4
+L486: rts
+L487: cmp *r1, #-20
+L488: sub r3, L354
+L489: stop
+L490: stop
+dec L124
+
+L491: rts
+prn #13
+jsr *r2
+L492: not *r7
+jsr *r6
+L493: .string "rqj"
+L494: clr r3
+clr r7
+jmp *r1
+jsr *r0
+L495: bne L0
+cmp r3, #-206
+dec L329
+mov #183, L481
+add L504, r0
+L496: .data -753, 426, 750, 24
+L497: .string "i"
+stop
+L498: not L404
+L499: jsr *r1
+L500: dec r4
+L501: .string "ndblpl"
+L502: prn *r0
+L503: clr r1
+rts
+stop
+L504: mov L602, L32
+L505: .string "xxlxcmicpspsai"
+bne L12
+clr L563
+L506: prn #71
+
+L507: jmp L599
+clr L235
+L508: prn r7
+prn L549
+stop
+L509: clr *r0
+L510: dec L259
+L511: dec r2
+L512: mov r6, *r1
+L513: stop
+L514: inc L376
+lea L282, *r3
+L515: dec *r5
+clr L581
+L516: lea L398, L274
+add *r3, *r4
+lea L608, *r3
+L517: .data 938, 375, -320
+L518: .string "vcovrbauwlh"
+L519: add r2, L85
+L520: cmp r0, r4
+prn L273
+L521: inc L488
+L522: rts
+L523: prn *r0
+rts
+L524: dec *r2
+L525: inc r6
+L526: cmp r3, r4
+stop
+prn *r7
+L527: jmp *r7
+red r4
+L528: jsr *r5
+inc r6
+
+L529: stop
+rts
+clr L574
+dec r1
+mov r6, r7
+L530: stop
+L531: not L517
+L532: jmp L571
+bne L253
+L533: inc r3
+L534: prn #160
+L535: prn #81
+
+L536: jmp L51
+dec r6
+L537: .string "hodn"
+L538: .data -893, 770
+cmp *r2, #221
+sub *r5, L275
+stop
+bne L485
+L539: red *r7
+L540: inc L598
+L541: cmp #-78, L290
+L542: cmp r6, r3
+L543: dec L202
+L544: mov #-65, *r1
+L545: cmp L553, #-247
+mov *r5, L605
+L546: cmp *r0, L589
+clr r3
+L547: sub L549, *r4
+L548: lea L602, L570
+sub #-234, L608
+L549: prn L37
+L550: .string "xxhcjxrnraodvusjt"
+lea L562, *r7
+L551: prn r2
+L552: red L59
+inc *r7
+L553: .string "dgctlmnscquecypa"
+L554: .string "ygjwucihfkdwotbsttsseadi"
+prn r3
+L555: not r1
+L556: red r4
+L557: bne *r6
+L558: add #-80, r4
+L559: dec L441
+L560: cmp *r1, L561
+bne L62
+dec *r3
+L561: rts
+; comment
+L562: rts
+L563: bne L495
+L564: red *r2
+rts
+L565: not r7
+sub *r4, r4
+L566: dec *r1
+mov r1, r7
+jmp L189
+mov *r2, *r7
+L567: inc *r6
+red r6
+L568: clr *r0
+inc *r7
+L569: red *r0
+L570: stop
+inc L595
+L571: clr r3
+L572: rts
+L573: rts
+inc *r2
+not L41
+L574: mov r2, *r0
+L575: stop
+L576: not L59
+cmp L432, #134
+jsr *r5
+L577: clr *r0
+L578: stop
+L579: clr L150
+jsr L569
+L580: jsr *r4
+L581: not r0
+L582: clr r0
+L583: rts
+add #-105, *r5
+L584: add L595, *r5
+L585: stop
+dec L586
+L586: .data -801, 259, 645, 911, -730, 992, 87, 337
+L587: prn #233
+stop
+L588: sub r7, *r4
+L589: cmp r2, L140
+jmp *r1
+L590: lea L595, r2
+L591: clr r4
+L592: prn r2
+add L231, r1
+L593: not r4
+L594: sub #152, L315
+jmp *r5
+L595: jsr L45
+L596: stop
+L597: jsr L206
+L598: jmp L601
+inc *r0
+L599: prn #-83
+L600: inc r5
+L601: lea L605, r5
+inc *r7
+L602: rts
+L603: lea L8, *r7
+L604: .string "acaqwhjprcyxyqhmnrumdn"
+dec L608
+L605: lea L606, r5
+L606: .string "x"
+clr r6
+L607: red r7
+add r3, r3
+L608: dec r4
+L609: lea L298, *r3
+mov r1, L496
+bne *r7
+stop
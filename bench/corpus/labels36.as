@@ -0,0 +1,1040 @@
+; Generated by genCorpus --seed 37
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+L0: lea L533, *r7
+red r3
+red L0
+L1: jsr L397
+mov #-42, r5
+L2: sub L0, *r4
+L3: cmp *r5, r5
+lea L602, r6
+L4: add #-34, *r4
+add #81, L422
+L5: rts
+L6: clr L1
+L7: .data -62, 193, -788, -369, 772
+L8: cmp *r6, L374
+prn #-255
+L9: dec *r5
+L10: bne *r0
+bne *r4
+L11: add *r2, L505
+L12: inc L459
+L13: inc *r4
+L14: clr *r6
+L15: add r7, L601
+cmp L10, *r6
+L16: lea L6, *r1
+L17: .string "o"
+L18: not r7
+dec r3
+L19: inc L599
+L20: .string "ctlduqytqxmnnjifemz"
+L21: jsr L205
+L22: add r6, L18
+L23: dec *r3
+dec L14
+L24: jsr *r0
+L25: rts
+L26: jmp L125
+L27: prn L1
+L28: .data -862, -799, -329, 342, 256, -326, -458
+L29: red *r3
+prn L542
+L30: sub L6, *r0
+L31: lea L417, r0
+L32: lea L266, r1
+jsr *r0
+L33: not r7
+L34: clr r1
+
+L35: bne L543
+L36: clr *r4
+rts
+L37: sub r5, L468
+L38: stop
+L39: jsr *r4
+L40: cmp L22, *r5
+L41: inc r1
+L42: lea L495, *r3
+L43: red r0
+L44: dec *r5
+L45: cmp #37, L360
+clr r0
+L46: prn r4
+red *r3
+L47: jsr *r6
+L48: clr r5
+L49: cmp r1, r6
+
+L50: red L16
+cmp *r3, L321
+L51: jsr *r6
+L52: prn #226
+L53: sub L23, r3
+; comment
+dec r6
+L54: rts
+lea L495, r2
+prn L35
+lea L200, *r4
+L55: jsr *r2
+dec r6
+L56: red L177
+L57: jmp L30
+L58: clr r2
+L59: sub L490, L464
+dec r5
+dec L59
+L60: bne *r4
+L61: inc *r3
+bne *r7
+jmp L40
+lea L5, *r6
+red L31
+L62: jsr L24
+L63: sub #43, L226
+rts
+L64: jmp *r1
+L65: sub *r4, *r5
+L66: .data 996, 541, 393
+prn *r1
+; comment
+L67: rts
+L68: bne *r7
+L69: stop
+L70: inc *r1
+stop
+L71: red *r6
+L72: sub #62, r3
+L73: red L144
+; comment
+L74: .string "xaddkstfhymqxmpavpfhgahb"
+L75: .string "yfcoyjkzhgvnxhfz"
+L76: inc *r5
+L77: dec *r1
+rts
+L78: stop
+inc r2
+L79: red *r0
+L80: sub L595, *r7
+sub r0, L206
+L81: lea L368, r5
+L82: rts
+; comment
+L83: rts
+L84: bne L172
+L85: inc L334
+stop
+L86: clr L202
+stop
+L87: .data -2, -128
+L88: clr *r2
+add #118, L2
+bne L321
+L89: dec *r3
+L90: prn *r0
+L91: prn r0
+lea L402, *r6
+; comment
+L92: jsr *r0
+L93: red r0
+L94: prn r6
+L95: .data -33
+L96: prn r7
+
+L97: jmp *r1
+L98: dec L19
+dec *r5
+L99: not r3
+L100: jsr *r6
+L101: mov L442, L427
+bne L33
+L102: lea L127, r1
+mov r6, *r7
+L103: cmp r1, L93
+L104: sub L80, *r7
+add r6, r3
+L105: not L11
+inc r5
+L106: .string "zcamrcpu"
+prn #-73
+; comment
+L107: not r7
+add r2, L479
+L108: prn #-67
+; comment
+L109: sub r6, *r3
+jmp *r4
+inc *r4
+L110: inc *r7
+not L130
+L111: sub L568, L345
+L112: jsr *r5
+L113: not r2
+L114: sub r6, r2
+bne L335
+L115: not L33
+sub #-107, r7
+L116: dec *r0
+rts
+add L53, L260
+sub L199, *r1
+sub r4, r2
+L117: mov r3, r5
+rts
+prn r6
+inc L424
+L118: cmp r3, r5
+L119: rts
+L120: jmp L550
+L121: .data -452
+L122: bne *r1
+L123: red r1
+red L282
+L124: not *r5
+L125: bne *r5
+mov L104, r0
+inc *r1
+L126: red r1
+cmp *r5, #-230
+L127: rts
+L128: .data 51, 63, -221
+L129: .data -718, -929, 445, -75, -400, -319, 646
+jmp *r1
+cmp *r5, #250
+prn r1
+bne *r1
+L130: cmp *r2, L83
+L131: dec r5
+sub *r7, *r3
+sub r1, r3
+L132: .string "nkmdohaviivdmzt"
+L133: inc L446
+L134: jmp L30
+rts
+inc r1
+L135: inc L31
+; comment
+L136: stop
+L137: .string "nkierulq"
+prn r3
+L138: .data 232, -104, -459
+inc *r7
+jsr *r0
+L139: dec r3
+L140: inc r4
+L141: prn L28
+dec r6
+mov r2, r7
+L142: bne L15
+add r5, L3
+; comment
+L143: .data 856, 815, 187, -376
+jsr *r2
+L144: .string "vdhoakplmhqrkqdczwxnuzac"
+L145: red r6
+L146: red L573
+L147: red *r0
+L148: clr L8
+L149: mov *r2, L336
+inc L82
+mov L249, r0
+L150: red *r1
+prn #248
+prn L143
+cmp r5, #-202
+L151: lea L63, L142
+L152: mov #50, r3
+red r4
+lea L47, *r1
+L153: not *r4
+clr *r3
+jsr *r1
+stop
+L154: add r7, r1
+clr *r4
+lea L520, r0
+jsr L9
+L155: mov #-90, L278
+L156: cmp L551, r4
+L157: prn #-136
+L158: jsr *r1
+L159: lea L29, L455
+L160: .string "inlfcflgdchgidtffns"
+red r0
+prn L150
+L161: lea L105, r3
+cmp L116, #-136
+L162: rts
+L163: cmp L451, #-58
+stop
+rts
+bne *r2
+L164: sub r3, r4
+red L93
+L165: .data 753, -896, 973, -181, -30, 618
+L166: bne L299
+L167: inc r2
+cmp *r1, *r6
+red L321
+L168: not *r5
+L169: .data -50, 66, -434, 812, -792, 302, -783
+L170: prn r4
+L171: jmp *r3
+L172: sub L146, *r0
+add r5, L17
+stop
+L173: bne *r7
+L174: jsr L128
+L175: rts
+L176: sub *r4, L285
+L177: .string "lvrbxhbmmehrxntwdeuo"
+L178: .data -894, 703, -95, -251, -862, 929, 695
+jsr L575
+L179: mov L98, *r7
+add #-93, r7
+L180: .string "neztdhzhn"
+L181: .data 606
+jmp L599
+L182: red *r0
+L183: red L147
+clr L141
+L184: .data 839, -502, -337, 871, -495, -417, -622
+L185: inc L514
+L186: jsr L71
+jsr *r6
+L187: inc *r0
+L188: rts
+L189: lea L135, *r6
+dec r4
+bne *r0
+lea L598, r0
+L190: clr *r7
+L191: .string "hqdezwadytkxnepbknayg"
+stop
+add r1, L96
+jmp L10
+L192: lea L280, r1
+prn r1
+L193: .data -498, -937, 257, -205, 168, 809
+cmp L189, #81
+L194: prn r4
+L195: stop
+
+L196: mov r3, r7
+jsr L476
+L197: dec *r0
+mov *r1, r5
+L198: clr r6
+clr r7
+jmp L477
+L199: dec L363
+L200: sub r7, L103
+add L115, L324
+jsr *r7
+lea L197, L21
+L201: stop
+L202: .data 441
+L203: dec *r3
+L204: jsr L74
+red r5
+dec r7
+bne L312
+lea L35, r3
+L205: inc *r2
+L206: .data -110, 792, -276, 351
+jmp L305
+L207: .string "eengrb"
+L208: .string "qnaanovehvcfwymwlwwzytde"
+L209: clr r2
+; comment
+red *r0
+L210: add #-157, r2
+rts
+L211: inc *r6
+not *r5
+L212: cmp *r6, #219
+red r7
+jsr L200
+L213: lea L115, r7
+L214: cmp r7, #53
+L215: .data -98, -234
+L216: not r4
+L217: inc r4
+prn r4
+bne *r7
+
+mov #224, L26
+stop
+L218: rts
+L219: stop
+cmp #-81, *r0
+jmp *r5
+L220: mov r2, L234
+L221: cmp *r5, *r4
+L222: add L160, *r3
+L223: dec *r5
+L224: not *r2
+jmp *r1
+L225: .string "syybezsavsynlulckxhsrht"
+L226: mov *r6, *r3
+jmp *r5
+L227: mov L526, L42
+L228: clr L190
+rts
+L229: add *r3, r4
+L230: add *r1, *r6
+L231: jmp L416
+L232: lea L467, *r7
+L233: prn *r7
+L234: dec *r3
+L235: jmp L388
+L236: prn *r1
+L237: stop
+L238: add *r2, r1
+jmp *r7
+; comment
+L239: clr L518
+L240: not L351
+prn r2
+inc *r5
+L241: not r0
+
+L242: .data 101, 53, -558
+lea L186, L7
+L243: stop
+
+L244: sub #-143, L158
+jsr L209
+L245: bne L442
+
+L246: add *r6, r6
+not r5
+sub #207, *r2
+inc L170
+L247: dec *r3
+L248: clr *r6
+L249: .data 304, 654, -523, 364, -520, 411, -3
+mov L566, r2
+L250: prn L134
+L251: bne L573
+; comment
+lea L490, L439
+L252: stop
+rts
+add *r1, *r1
+L253: cmp #-219, #182
+L254: red *r4
+L255: prn L46
+L256: bne L295
+red r6
+L257: inc *r5
+dec L504
+dec *r5
+red *r7
+L258: .string "x"
+stop
+L259: sub *r0, r6
+
+L260: cmp #-88, L293
+L261: jmp L165
+clr *r0
+stop
+L262: add r5, *r6
+add #-87, r4
+L263: .data 642, 867, 539
+L264: jsr *r4
+L265: inc r5
+inc L305
+L266: cmp *r1, r2
+L267: bne L0
+L268: mov #-11, L70
+L269: red r3
+clr L88
+not *r6
+L270: red L529
+L271: mov L231, *r2
+L272: rts
+L273: inc *r6
+L274: .string "ociklikyfsshrbogz"
+not r3
+L275: sub #-112, L510
+add L156, r2
+L276: red L24
+L277: .string "qphghoisyklriqobbdzom"
+bne *r2
+lea L417, *r3
+L278: mov r1, *r7
+inc L123
+L279: lea L129, *r2
+L280: .data 416, -671, 139, 487, 901, -855, 263
+lea L174, L296
+L281: red L388
+L282: add r6, r4
+L283: mov L237, L213
+inc L442
+L284: .string "lanwaqqaqgqmdwkrdnxwh"
+not L351
+L285: cmp #-212, #-113
+L286: stop
+add r5, L44
+L287: add r7, r5
+L288: dec r6
+L289: dec *r1
+L290: cmp *r1, L287
+L291: prn #-93
+L292: prn L23
+add #-77, L318
+prn *r0
+L293: add L155, r5
+L294: mov r2, *r5
+; comment
+L295: .string "wlmtwf"
+; comment
+L296: jmp L44
+add #-40, *r0
+dec L230
+L297: add r6, *r4
+rts
+bne *r0
+L298: add L371, *r4
+L299: .data -975, 350
+L300: jsr *r3
+stop
+L301: sub L552, *r6
+L302: .string "paqwncefurzo"
+L303: dec *r7
+inc L409
+L304: bne *r2
+cmp #74, *r1
+jsr *r3
+L305: dec L29
+
+L306: stop
+L307: clr *r6
+L308: jmp *r1
+add L186, r2
+lea L27, *r4
+not L209
+L309: mov #-141, *r6
+L310: prn L366
+L311: .data 27
+L312: add r7, r5
+L313: sub L86, *r5
+L314: red L199
+mov #-9, L186
+L315: jsr *r2
+L316: cmp r0, *r3
+L317: not L235
+L318: jmp *r4
+L319: bne *r0
+L320: rts
+L321: rts
+L322: .string "vnrrmhtmjhfcz"
+L323: inc L394
+L324: not r2
+not *r5
+bne *r4
+L325: prn *r3
+
+dec *r6
+L326: inc L377
+L327: .string "xxhvdcpkf"
+L328: add #-165, r5
+lea L344, r6
+L329: red *r5
+L330: lea L146, r6
+sub *r1, L577
+rts
+L331: jmp L321
+bne L344
+L332: inc L75
+L333: stop
+lea L513, L93
+L334: .data 452, 894, 57, -549, 227, -901
+L335: .data 105, 78, -938, -930, 18, 795
+; comment
+lea L3, L474
+not *r6
+L336: jmp *r0
+L337: bne L347
+jsr *r4
+L338: red L35
+L339: .data -677, 379, -650, 803, -215, 238
+L340: clr L130
+L341: sub L544, r2
+L342: prn *r0
+clr *r7
+L343: .data -905
+L344: inc L83
+; comment
+L345: stop
+L346: rts
+L347: cmp r2, #-248
+red r5
+L348: rts
+L349: clr L196
+L350: sub r7, r2
+rts
+jsr L535
+L351: jsr L599
+stop
+L352: not L425
+L353: .string "negkhveoczrbi"
+L354: jsr L26
+sub #-105, L569
+
+L355: bne L265
+sub L287, r5
+red r7
+L356: stop
+L357: clr *r3
+L358: lea L304, L461
+L359: stop
+L360: add r1, r2
+L361: dec L100
+add L483, *r7
+mov *r6, r1
+red *r1
+L362: .data 468, -793, 874, -410, 17, 992, 51, 23
+L363: sub #-190, L398
+L364: dec L320
+L365: clr r2
+L366: rts
+L367: inc L324
+L368: jsr L553
+L369: stop
+L370: red *r5
+jsr *r5
+L371: red L519
+L372: .string "zgrasfwzjktgwfkyskkrrao"
+L373: bne L448
+L374: .data 819, 491
+
+L375: stop
+L376: not *r1
+inc *r5
+L377: inc *r1
+L378: dec r0
+L379: mov #253, *r2
+; comment
+clr *r3
+L380: jmp L361
+; comment
+L381: .string "lapkadobttexchiyw"
+L382: inc *r1
+lea L354, r0
+L383: red *r4
+bne *r6
+dec r5
+L384: add *r2, r6
+rts
+clr *r0
+L385: stop
+L386: bne L500
+; comment
+L387: not L475
+L388: stop
+L389: rts
+L390: jsr *r4
+L391: inc *r5
+L392: red L567
+red *r5
+clr *r6
+L393: jmp *r7
+bne L375
+
+L394: not r1
+L395: mov r5, *r2
+L396: .data 691, 249
+L397: clr *r1
+bne L8
+L398: inc *r4
+L399: .string "f"
+L400: bne L412
+L401: .string "ihonbswmlyzcnujobfs"
+L402: .string "t"
+add r0, L185
+L403: .string "wxcpklaiwwcyaoyouvp"
+L404: lea L575, r0
+
+cmp #240, r7
+jsr L99
+L405: bne *r6
+dec r7
+L406: bne L502
+dec *r6
+add *r2, r4
+prn L174
+L407: jsr *r1
+L408: red r2
+L409: .string "ijojikvfifhcxnxmjqt"
+not *r7
+; comment
+L410: sub *r6, r2
+mov #45, r6
+rts
+L411: jmp L182
+sub r5, r0
+clr r1
+jsr *r5
+mov r0, *r3
+cmp L242, #173
+not *r7
+stop
+L412: dec r0
+L413: not *r3
+red *r2
+L414: rts
+L415: inc L372
+L416: dec *r7
+red r6
+L417: bne L464
+jsr *r1
+L418: jsr *r1
+L419: .data -90, 785, 663
+L420: not L38
+mov #251, r4
+add #222, *r5
+L421: sub r2, *r6
+mov r7, L427
+L422: not *r3
+L423: dec L400
+L424: .data 252, -923
+mov L116, r0
+L425: dec r3
+; comment
+L426: .string "edkgwhqzltvnrscov"
+L427: stop
+L428: add #-253, *r0
+add r1, L206
+L429: clr r3
+lea L58, *r5
+L430: .data -452, 406, -689, 17, -483, 474, 205, -876
+; comment
+L431: not *r6
+L432: .data -181, 134, -591, 713, 395, 322, 119, -856
+L433: bne *r4
+L434: mov r5, r0
+jmp L439
+L435: add #252, L549
+L436: jmp L502
+stop
+dec r5
+L437: cmp *r7, *r4
+
+L438: sub #2, L537
+L439: red L565
+L440: sub *r1, *r1
+stop
+L441: inc L603
+jmp *r0
+not r3
+; comment
+dec *r3
+L442: stop
+jsr *r0
+L443: .data 595, -350, -111, 523, -396, -647, -10, -279
+L444: not r7
+inc L414
+L445: lea L253, L440
+L446: prn r0
+lea L482, *r0
+L447: inc L482
+red L457
+L448: bne *r1
+L449: jmp *r1
+sub #-123, L132
+L450: .string "fsbxubbjealdsouhfwn"
+L451: jsr *r3
+L452: jmp L524
+cmp *r4, *r6
+jmp *r3
+jmp *r1
+lea L485, L537
+L453: not L597
+L454: .data -457, 876, -385, 890, 746, 984
+L455: stop
+L456: lea L475, r0
+jsr *r2
+L457: cmp #-197, r3
+L458: jmp L549
+L459: jmp *r1
+L460: not L119
+L461: bne L153
+L462: sub r7, L38
+L463: jsr L154
+L464: dec *r0
+L465: lea L545, *r1
+L466: sub r3, r4
+L467: dec r2
+L468: sub *r5, r5
+cmp r6, L349
+L469: .string "bya"
+L470: rts
+L471: jsr *r6
+sub *r2, L126
+L472: red L567
+L473: .string "w"
+bne L478
+L474: dec L419
+red r5
+L475: stop
+; comment
+L476: red L592
+L477: cmp #-181, #113
+L478: .string "hidxfcxbhifp"
+L479: lea L11, r0
+jsr *r5
+
+L480: bne L518
+stop
+dec r4
+L481: .string "uorpnhfxxive"
+mov *r6, r7
+L482: .data 492, -314, -271, 504, -528
+L483: not *r6
+L484: dec r1
+dec *r2
+L485: inc *r3
+L486: inc r3
+L487: jmp *r6
+L488: add r4, *r3
+cmp L528, L523
+L489: not *r7
+; comment
+add #-146, r1
+sub *r0, L180
+L490: lea L23, r4
+L491: rts
+L492: mov #-243, *r5
+L493: not *r2
+rts
+L494: rts
+L495: red r1
+L496: clr L591
+lea L499, L560
+mov L1, r1
+L497: .data -335, -115, -901, -656
+L498: prn L602
+L499: mov r6, r6
+L500: mov L134, *r6
+L501: cmp #-108, #-130
+L502: inc *r2
+L503: stop
+L504: jmp *r3
+L505: .string "djdpdlpuwwrmmmqwytfsoqnu"
+L506: red L354
+red *r4
+prn *r2
+L507: jsr *r6
+L508: inc L80
+L509: .string "xtxkuzdxfj"
+L510: mov L600, r2
+L511: sub #1, L257
+L512: .data 778, 749, 667, 393, -157, -935
+L513: mov L310, *r6
+clr *r7
+L514: clr r7
+jmp *r4
+L515: inc r6
+L516: jsr *r2
+L517: jmp *r6
+mov *r2, r2
+L518: jsr *r6
+L519: mov L585, *r7
+red r0
+L520: lea L7, *r1
+sub r0, *r3
+L521: prn *r0
+L522: jmp *r1
+L523: jsr *r1
+L524: clr *r7
+L525: .data -764, 205
+mov #134, L139
+L526: .string "jxwtajcdtohrz"
+L527: lea L99, *r2
+L528: .string "cqq"
+mov L86, *r5
+mov *r3, *r6
+cmp *r7, #131
+rts
+L529: dec r4
+inc r1
+L530: jsr *r0
+lea L598, r4
+L531: jsr L272
+L532: stop
+mov r0, r5
+L533: prn L102
+sub r2, *r7
+prn #166
+L534: .string "rmqbdhdq"
+L535: stop
+L536: stop
+L537: rts
+rts
+stop
+L538: sub r2, r7
+L539: jsr L540
+prn r7
+L540: lea L546, *r6
+L541: stop
+L542: rts
+
+cmp L560, L101
+L543: .data -726, -241, 799, 678, 207, 123, 87, 396
+L544: bne L581
+not r3
+L545: not L590
+L546: red r2
+L547: stop
+L548: .string "kbprogqml"
+L549: cmp *r7, *r0
+L550: red L157
+L551: .string "onjtxitizrefabivojja"
+L552: .data -786, 889, 658
+cmp L594, #98
+L553: rts
+L554: mov #-188, *r3
+inc L142
+L555: red *r5
+L556: lea L389, r7
+L557: mov L17, L425
+L558: bne *r5
+add r6, *r0
+; comment
+inc L572
+prn *r2
+L559: jmp L204
+L560: jmp *r6
+L561: inc r2
+stop
+stop
+sub r0, *r7
+L562: .data 245, 479, -201
+L563: prn #35
+L564: clr *r1
+jsr *r6
+L565: cmp #-125, r5
+L566: stop
+L567: stop
+dec r3
+L568: bne *r6
+inc r3
+L569: .data -65, 953, 445, 92, 329
+L570: .data -78, -159, -184, 261
+L571: jsr L588
+clr *r3
+stop
+L572: red r1
+clr *r7
+dec *r3
+clr *r3
+L573: stop
+L574: cmp *r6, L209
+add *r1, r1
+bne L592
+
+jsr *r3
+jsr L314
+L575: rts
+red *r4
+jmp L90
+L576: stop
+L577: mov *r1, r7
+L578: bne *r2
+
+; comment
+L579: jmp *r2
+L580: cmp L591, #222
+L581: bne *r6
+L582: not r2
+L583: mov r2, r3
+L584: add #-198, L6
+add r2, r7
+stop
+inc L562
+L585: red L63
+L586: mov *r7, L593
+not r2
+sub #154, L101
+lea L603, r1
+jsr *r6
+L587: dec *r4
+L588: .string "asdmqxjxsdngdaioqhcfkwg"
+L589: dec *r1
+rts
+L590: jmp *r5
+L591: dec *r4
+sub L41, L186
+stop
+L592: add L325, r0
+L593: stop
+L594: .string "dwthrmkxbhnlxagazccsfbb"
+cmp r7, L242
+L595: .data -607, -928, 12, 824, -140, -667
+L596: red L89
+jmp L599
+L597: not *r5
+
+sub #76, L601
+cmp L600, #33
+L598: .data -143, -55, -637, 312, -798
+L599: red L603
+mov L450, r1
+cmp r4, #228
+rts
+L600: .string "xbxafvdjoqzr"
+bne L362
+not *r3
+not L603
+dec r1
+L601: jmp L602
+dec L602
+rts
+prn *r7
+L602: prn *r6
+dec L603
+L603: lea L227, *r1
+clr *r6
+add *r4, r1
+stop
@@ -0,0 +1,1042 @@
+; Generated by genCorpus --seed 38
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+.entry L624
+L0: .string "ecpklftkwsooqz"
+mov L624, L0
+L1: .string "xmecmpuoygzjzwvrea"
+L2: inc *r1
+lea L502, L565
+L3: dec *r4
+L4: .data 772, -858, -880, -258, 76, 697, -168, -360
+inc r7
+L5: not *r4
+L6: cmp #-167, #20
+L7: .string "pwclmizmszq"
+L8: stop
+bne L5
+L9: dec r2
+red r6
+L10: bne L1
+L11: rts
+bne L362
+red r0
+L12: dec *r5
+L13: .string "ybkvbozqiuoeozq"
+not r0
+clr r1
+L14: dec r5
+L15: .data -548, 231, 47, 940, -513, -532, 578, 947
+L16: add *r4, *r6
+L17: not r2
+L18: .string "o"
+jsr L153
+L19: jmp L376
+L20: jmp *r6
+L21: mov r1, L112
+inc L3
+red L18
+L22: lea L316, r4
+add #191, r3
+L23: clr r7
+L24: add #248, *r3
+add *r7, L264
+
+stop
+bne L278
+; comment
+L25: bne L15
+bne *r7
+L26: jsr L588
+L27: add r0, L26
+prn *r2
+L28: inc r0
+L29: red r3
+prn r2
+L30: prn #57
+L31: .string "vdvajtkrlbhqhl"
+mov #115, *r2
+; comment
+add *r2, *r0
+not *r3
+L32: jmp *r7
+jmp L9
+L33: dec L17
+prn L33
+L34: stop
+mov #-112, L5
+jmp *r5
+L35: lea L182, *r3
+; comment
+L36: add #56, L33
+rts
+L37: rts
+L38: not r7
+L39: jsr *r7
+jsr *r1
+add L2, r1
+bne L333
+dec L11
+stop
+L40: sub L34, r5
+red r4
+L41: rts
+add #168, L1
+L42: add r2, *r2
+cmp r1, *r4
+L43: not *r3
+L44: clr r0
+dec L469
+L45: rts
+L46: not L29
+sub #14, *r6
+L47: stop
+rts
+L48: dec *r2
+L49: clr L306
+
+L50: sub r2, r6
+L51: jsr *r4
+L52: add #154, L23
+L53: .data -694, 894, -734, -422, 424, 49, 857, -42
+L54: jmp L238
+lea L36, *r4
+L55: inc L518
+L56: red *r6
+lea L33, L21
+mov r0, *r0
+L57: bne *r5
+L58: red L34
+rts
+L59: .string "fglttspz"
+L60: inc *r6
+L61: rts
+L62: clr *r3
+L63: rts
+
+L64: .string "lnamiievgopkdkxouegemd"
+L65: prn #-123
+not r3
+L66: prn L3
+L67: jmp L577
+L68: inc *r0
+L69: bne *r4
+jsr *r4
+lea L308, *r7
+L70: inc L50
+L71: cmp *r5, L52
+L72: jsr L108
+L73: prn *r4
+jsr L3
+lea L23, L52
+rts
+L74: add #-176, r3
+L75: inc *r3
+L76: .data -94, 954, 203
+L77: cmp L31, #-235
+L78: mov L144, *r0
+clr r1
+mov *r7, *r6
+L79: stop
+mov *r7, L303
+L80: sub *r1, r2
+L81: bne *r5
+L82: .string "e"
+not *r3
+L83: sub #63, L250
+stop
+L84: add r3, L266
+L85: rts
+cmp L483, r5
+L86: inc L575
+dec r2
+L87: prn L25
+L88: clr L21
+jmp *r3
+L89: not r6
+L90: stop
+L91: dec r6
+clr r7
+L92: cmp #-29, r3
+jsr L267
+; comment
+L93: stop
+L94: red r3
+stop
+L95: mov L7, r6
+L96: bne L501
+prn r1
+L97: not *r6
+L98: not *r6
+bne L39
+L99: dec r5
+L100: jsr L96
+L101: inc r4
+jsr *r4
+L102: .string "lhajlhay"
+jmp *r5
+mov *r1, r7
+L103: rts
+inc *r2
+L104: sub #-32, r1
+mov *r3, L352
+L105: jmp L30
+L106: inc *r4
+L107: red r2
+L108: stop
+; comment
+prn r5
+L109: clr *r6
+L110: clr *r5
+L111: red r2
+L112: sub L80, r1
+L113: clr L55
+; comment
+L114: inc *r3
+jmp *r7
+L115: clr *r6
+dec L475
+not r5
+L116: rts
+L117: dec r7
+jsr *r0
+L118: jsr *r2
+dec L248
+L119: jsr *r2
+L120: cmp L215, #-121
+L121: sub r4, r0
+inc *r0
+L122: lea L74, L47
+L123: add #180, *r0
+L124: .data 688, 920, 846, 516
+L125: .data -71, -44, -14
+L126: lea L291, L170
+L127: stop
+cmp *r5, #131
+L128: .data 144, -186, -779
+add L66, r3
+L129: .data 730, -738, 501, 802
+L130: red *r2
+; comment
+red r7
+L131: dec r7
+dec *r4
+L132: inc *r7
+L133: not r1
+prn L229
+cmp r0, r7
+L134: not L138
+L135: prn *r1
+L136: .data 141, 339, -915, -327, 245, -981, 405
+L137: prn *r5
+red L72
+L138: .string "hoondaux"
+L139: rts
+stop
+L140: .string "jbut"
+L141: inc L596
+L142: inc r7
+clr L134
+L143: mov L79, r0
+lea L374, L107
+clr L588
+L144: clr *r4
+L145: inc L459
+L146: add r3, L592
+red *r7
+L147: prn L138
+bne *r0
+inc L97
+L148: lea L22, r4
+L149: clr *r2
+inc r6
+inc *r6
+L150: .data 958, 238, 587
+; comment
+lea L293, L36
+
+L151: prn r1
+L152: stop
+prn #-156
+L153: not r6
+L154: inc L295
+L155: red L270
+L156: bne L541
+not *r4
+
+bne L21
+L157: jmp L50
+clr *r6
+rts
+L158: add L12, *r0
+red L359
+L159: add L480, r4
+L160: dec r7
+jsr *r5
+L161: rts
+bne L0
+L162: mov L86, *r3
+stop
+L163: dec r6
+clr r7
+L164: mov r5, L137
+dec r3
+L165: add L84, L208
+L166: cmp *r2, *r2
+add #134, L167
+L167: prn #190
+; comment
+L168: mov *r5, r4
+L169: lea L442, L534
+L170: .data 975, 302, 330, -91, -327, 853
+L171: .string "bjg"
+L172: stop
+L173: prn r4
+L174: .string "agkitooyasctpwkirdvroyf"
+L175: cmp r4, r1
+L176: dec L211
+inc L64
+L177: add #-151, r6
+L178: lea L154, r3
+L179: cmp *r3, #243
+L180: bne L92
+cmp #63, *r3
+L181: .data 515, 178, 958, -249, -624, -75, 907
+L182: add *r6, *r7
+inc r2
+L183: add *r6, *r5
+clr L292
+L184: cmp r4, *r2
+L185: inc r7
+jmp *r2
+L186: cmp *r2, *r7
+bne L10
+L187: mov #-238, r0
+L188: jmp *r0
+not r7
+inc L166
+dec r0
+sub L326, *r1
+L189: rts
+L190: bne *r4
+red L491
+jsr L159
+
+red L79
+L191: .string "fqhsvksnhrumof"
+L192: .data -719, 354, -890, -321, -644, 154
+L193: jsr L19
+mov *r0, r2
+L194: .string "dlsfvmtazprpuizskypfewu"
+L195: not *r0
+L196: .data -614, -267, 134, 554, 868, 716
+jmp L543
+clr *r4
+jsr *r2
+red r5
+L197: rts
+L198: lea L129, r1
+L199: jmp *r2
+stop
+lea L182, *r2
+dec r5
+L200: jmp L112
+L201: .data 346, -825, 394, -389
+mov L173, L495
+clr L420
+jsr L77
+jmp *r6
+; comment
+L202: inc L374
+L203: sub L511, r3
+L204: .data 422, 916, 249, -115, 331, 975
+L205: jsr L190
+L206: dec r4
+L207: jsr *r7
+
+L208: add r7, r0
+L209: jmp *r1
+L210: mov L450, *r4
+bne *r6
+sub r3, L474
+L211: bne *r0
+L212: .data 214, -807, -433
+; comment
+sub r2, L485
+
+red L575
+L213: lea L620, r7
+cmp r0, L72
+L214: sub #192, *r6
+prn #-80
+clr L225
+bne L484
+jsr L133
+sub *r0, *r7
+bne L146
+jsr L226
+L215: sub #-103, *r3
+clr *r6
+inc *r4
+cmp *r7, *r1
+L216: lea L514, *r3
+L217: bne *r1
+L218: cmp r0, *r3
+L219: .data -260, 427
+L220: lea L556, *r1
+L221: stop
+L222: red *r2
+L223: prn r4
+cmp #206, #44
+sub r2, r1
+L224: jsr *r5
+L225: cmp r7, r5
+L226: .data -134, 217
+sub *r4, L165
+L227: .data 718, -741, 511, -291, -808
+L228: mov #-17, L75
+L229: .string "uhnu"
+not *r3
+L230: sub L278, *r1
+L231: rts
+L232: stop
+L233: clr L215
+L234: clr *r1
+stop
+L235: jsr *r0
+red L73
+prn r6
+L236: bne L151
+L237: rts
+L238: rts
+L239: bne L535
+red L64
+L240: clr L189
+; comment
+rts
+L241: jmp L509
+L242: red *r5
+add *r3, r5
+L243: cmp #98, *r1
+prn L228
+L244: add #45, r3
+L245: mov *r4, *r7
+L246: .data -196, 778, -692, 331, 19, -707, 829, -376
+L247: .string "bngxmuulioyzyohzlmbx"
+L248: bne *r0
+L249: bne L344
+L250: stop
+L251: .data 362, -453, 882
+cmp #53, #180
+add *r0, r0
+L252: .data 223, -661
+L253: mov r2, r0
+L254: jmp *r6
+L255: inc r5
+L256: dec *r2
+L257: .data 659, 629, 34, -998, -366, 707, 817, -256
+stop
+L258: sub r1, r3
+bne *r7
+L259: dec L241
+L260: sub L237, L254
+L261: add #-126, r2
+L262: jmp *r6
+L263: cmp #99, #-180
+L264: add L15, *r1
+L265: cmp #-21, L458
+
+L266: .data -163, 82, 966, -213, 880, -717, -689
+add r6, *r0
+L267: clr *r7
+clr *r0
+cmp #-231, *r3
+L268: mov L480, r1
+L269: .string "ze"
+L270: inc L404
+L271: clr *r3
+cmp L249, L423
+L272: cmp *r2, r7
+red L195
+stop
+L273: stop
+L274: clr *r7
+L275: stop
+stop
+L276: sub *r0, L336
+L277: bne *r1
+L278: jsr *r3
+L279: lea L500, *r6
+not r3
+red *r3
+L280: cmp L145, *r2
+L281: red r2
+L282: bne L156
+L283: cmp #-93, r7
+L284: rts
+L285: rts
+stop
+add *r2, r4
+L286: .data -132, 454, 16, 885, -367, 21, 664
+L287: .data 778
+lea L337, r0
+sub *r0, L495
+L288: stop
+L289: add #-172, L108
+L290: not *r4
+jsr L322
+; comment
+L291: .string "encoqffoxsv"
+L292: .data -493, 169, -78, 12, -659, 759, 249, 764
+rts
+L293: bne *r2
+L294: rts
+
+
+L295: lea L484, L505
+L296: prn L36
+L297: prn r7
+L298: prn L161
+lea L476, *r7
+L299: dec *r5
+prn *r5
+L300: rts
+L301: sub L277, *r2
+L302: rts
+clr L219
+clr *r7
+cmp r5, r0
+L303: add #200, *r6
+L304: not L206
+stop
+L305: cmp #172, L471
+jmp *r3
+L306: red L24
+not r5
+L307: sub r3, r3
+L308: inc r0
+L309: jsr L250
+L310: stop
+L311: prn L446
+L312: .data -840, 927, 578, -487, 210, -889, 117
+bne L612
+L313: .string "hbvcvchwztmhzmjcolt"
+L314: inc r1
+L315: rts
+stop
+L316: inc r0
+red L389
+jsr L60
+L317: .data 223, 968, 904, -31, -991, -36, 271
+rts
+L318: .data -129, 852, 366, 307, 465, 988, -603, 248
+prn *r0
+L319: .string "biivmktysjajxwewfowt"
+cmp #-234, *r7
+L320: prn r5
+L321: mov L24, *r7
+dec *r2
+L322: sub *r6, r1
+L323: sub r4, L209
+L324: mov *r0, *r3
+L325: jmp *r1
+red *r4
+mov r5, L198
+L326: mov #-93, *r7
+L327: stop
+L328: bne L77
+L329: jsr *r7
+L330: dec *r7
+L331: red *r6
+L332: rts
+L333: .data 582, -586, 294, 714, 643, 530, 907, -210
+
+lea L454, L365
+jmp L569
+add *r3, *r1
+L334: not *r2
+L335: .string "dubbnkrfanwhzeeytm"
+L336: stop
+L337: prn r6
+
+L338: cmp *r7, #-124
+L339: inc r7
+L340: not L265
+stop
+stop
+jmp *r1
+L341: dec r0
+L342: add r7, r5
+L343: rts
+L344: dec L199
+not L172
+L345: dec r2
+L346: bne L498
+L347: jsr L108
+L348: rts
+inc *r5
+L349: dec r0
+L350: clr r2
+L351: stop
+L352: sub *r0, *r4
+L353: stop
+L354: not *r1
+L355: prn L352
+L356: stop
+L357: stop
+L358: red *r2
+inc *r2
+prn #168
+L359: sub L54, *r5
+L360: cmp #-74, r5
+L361: bne *r3
+L362: bne L169
+L363: .string "bkqxqgt"
+L364: mov L513, r7
+L365: sub *r1, *r4
+jmp L177
+L366: rts
+jmp L237
+L367: sub #154, *r0
+L368: dec L415
+
+L369: stop
+
+L370: .string "erlgqfxjaqhjyuinhvmbnimv"
+rts
+L371: dec *r5
+L372: lea L373, r1
+L373: .data -897, -923, -767, 263, -17, -405
+dec *r1
+jmp L617
+L374: .data -170, -286, 279, 483, 783
+L375: mov r6, L522
+L376: add r6, r7
+L377: .string "qxseaemmrtbko"
+stop
+L378: bne *r0
+L379: jsr *r6
+sub r3, *r1
+L380: red L473
+L381: dec r5
+not r0
+prn *r4
+L382: prn L438
+jsr *r2
+L383: stop
+L384: add #132, L437
+red r5
+L385: stop
+L386: stop
+L387: clr L63
+L388: .string "dzgjaphcgf"
+bne *r4
+L389: not r2
+L390: clr L332
+L391: bne *r1
+L392: jmp *r1
+red r5
+L393: cmp L358, r2
+L394: prn *r7
+lea L20, *r0
+inc L600
+stop
+L395: cmp L247, r7
+L396: bne *r2
+L397: lea L441, L374
+stop
+L398: mov L402, L623
+inc r2
+L399: sub r4, r0
+L400: .string "vkbhqcwqvomdjimv"
+L401: prn r1
+L402: clr r0
+L403: not *r6
+L404: bne *r2
+bne L531
+L405: bne L309
+; comment
+; comment
+L406: dec L541
+L407: bne *r0
+L408: prn *r1
+L409: mov L243, L23
+L410: mov L23, *r1
+L411: red L305
+L412: not L484
+L413: stop
+L414: add r4, L409
+L415: .string "vhpgtwutrqvuirjqdlavkva"
+L416: jsr L323
+
+L417: .string "cwnaxfrwobzfaapcslnavvt"
+jmp *r7
+L418: jmp *r4
+L419: dec r1
+L420: .string "tgqlisnwpxfsrxgfyvje"
+L421: lea L194, *r6
+L422: inc L261
+not *r1
+L423: inc r0
+L424: .data 199, -864, 262, -91, 73, 81
+red r6
+mov #104, *r7
+red L356
+L425: jsr L227
+L426: red *r1
+L427: inc r4
+L428: mov *r7, *r5
+L429: clr r0
+L430: add #229, r5
+L431: lea L275, L126
+lea L194, L592
+clr r7
+cmp L527, #36
+; comment
+lea L622, *r1
+cmp L358, r5
+inc r7
+add r4, r5
+L432: add r1, *r2
+not r7
+lea L207, L409
+
+L433: prn #-53
+dec *r5
+red r0
+L434: add *r1, L464
+L435: lea L486, L403
+L436: jmp *r0
+L437: red *r5
+L438: inc r1
+L439: prn r2
+lea L621, r5
+jmp L162
+dec r7
+L440: clr L544
+rts
+L441: clr L598
+L442: inc r2
+sub #215, *r5
+mov #213, r4
+L443: .data -753, 643, 258, 10, -357, -972, -998
+L444: add r1, L368
+L445: .data -330, -25, -202, 415, -80, 685, 106
+L446: prn *r1
+L447: inc *r0
+L448: .data 362, 68, 250, 310, -250
+L449: sub #53, r5
+rts
+L450: jsr L50
+L451: clr *r6
+L452: .string "yvrebhfan"
+add r5, *r3
+L453: jsr L482
+stop
+L454: jsr L319
+mov r7, *r7
+red *r2
+add L131, r5
+clr r3
+L455: .string "dczoxfipmndoxxxcokqwuw"
+not r6
+L456: not r5
+mov L547, L525
+L457: stop
+L458: lea L470, L52
+L459: red *r4
+L460: stop
+lea L303, *r0
+L461: mov #10, r2
+L462: add L543, *r1
+L463: dec *r4
+L464: rts
+L465: red L567
+L466: dec r3
+L467: lea L370, *r4
+L468: prn *r1
+L469: dec *r3
+L470: red r1
+L471: .data -291
+L472: jsr *r7
+mov r6, r3
+L473: jmp *r4
+jmp L519
+L474: jsr *r2
+L475: stop
+L476: not r2
+mov L329, L577
+L477: .string "jkhflmhg"
+clr *r7
+L478: .string "ojqvqqqxuuafppia"
+L479: add r5, L427
+
+prn *r2
+rts
+L480: add r6, r7
+lea L114, L382
+dec L216
+L481: jmp *r6
+L482: prn L567
+L483: dec *r6
+L484: inc L447
+L485: cmp r5, *r7
+L486: add #-175, *r4
+inc L579
+L487: inc L618
+sub *r6, *r7
+L488: sub #-54, r0
+bne L121
+L489: lea L335, *r6
+L490: red L98
+L491: .data 980, -227, -613
+L492: add #164, L612
+L493: not *r7
+prn *r4
+L494: stop
+L495: .data 568
+not *r3
+L496: cmp #204, #-234
+L497: jmp L587
+inc r1
+L498: clr L214
+L499: .string "zehjsfbdjz"
+lea L513, L292
+L500: dec L177
+L501: jmp *r0
+bne L216
+L502: clr *r6
+red r6
+bne L421
+L503: rts
+L504: add L233, L544
+L505: mov #26, L57
+L506: clr L539
+rts
+L507: not L552
+dec L508
+L508: cmp L524, *r1
+sub #16, *r1
+red r7
+not r7
+rts
+clr r3
+; comment
+mov r2, r0
+sub *r3, L29
+L509: sub L614, *r2
+L510: sub r4, r7
+L511: add *r5, r3
+add #-84, L624
+add L192, r3
+L512: clr *r6
+
+L513: .data 490, -628
+L514: mov #80, r4
+L515: stop
+lea L562, L437
+L516: cmp L528, #-62
+inc L566
+cmp r0, *r5
+L517: .data -835, -958, -820, -959, 94, -905
+L518: sub L451, r7
+L519: sub L6, r7
+L520: stop
+L521: rts
+jmp L235
+L522: bne *r5
+add L526, L328
+L523: red *r4
+L524: inc L572
+L525: jmp *r4
+L526: .data -198, -914, -404
+L527: .data 810, 893, -264, 748
+not L193
+L528: stop
+L529: jsr *r5
+L530: .string "aoqajrpurgjiimq"
+jsr *r1
+add L294, L452
+L531: sub r1, *r7
+add *r5, L571
+stop
+L532: bne L593
+L533: add L512, r0
+L534: .string "hli"
+inc L129
+sub #113, *r3
+L535: .string "qvfmwqqxckkyhb"
+inc r6
+L536: cmp *r4, L602
+L537: clr *r3
+
+L538: bne L173
+L539: cmp #-161, r2
+jmp L43
+L540: .string "wjcbdgm"
+L541: stop
+L542: mov r0, r7
+L543: red r3
+clr r3
+L544: add r1, L186
+lea L615, L349
+L545: mov #-202, r3
+L546: bne *r2
+add *r2, *r3
+L547: rts
+clr r4
+L548: jmp L394
+L549: red r0
+mov #-141, L607
+bne L565
+L550: add r2, *r4
+L551: rts
+L552: lea L580, r7
+L553: lea L588, r3
+L554: .data -807, 980, -657, -323, 485, 290, -739
+L555: jmp L607
+sub #-158, r6
+L556: inc *r3
+clr L102
+L557: not L590
+
+L558: red *r2
+L559: mov L574, L495
+lea L609, L592
+L560: prn r0
+L561: .string "fmaxabmpwhpvkebrn"
+L562: red r5
+L563: lea L614, L611
+L564: jmp L498
+L565: prn *r3
+; comment
+L566: jsr *r1
+dec r3
+L567: add L605, *r7
+L568: bne L612
+L569: add #26, r5
+lea L624, r6
+rts
+mov L103, r7
+L570: jsr L365
+mov #239, r0
+L571: sub r7, r0
+L572: rts
+L573: clr *r2
+cmp *r6, *r7
+L574: not L612
+L575: add #31, r3
+L576: sub #-25, L435
+red r4
+L577: bne L602
+L578: sub #-65, r1
+L579: .string "dtmdyxgfpsmcgamlswmef"
+mov L614, L596
+L580: .string "ezjlolwmonyfzdrhhgnkovzx"
+bne *r6
+L581: dec L489
+L582: rts
+L583: inc L385
+L584: prn *r5
+L585: mov L618, *r7
+L586: inc *r1
+inc *r2
+L587: bne *r5
+bne L622
+L588: .data -810, 725, -221, -187, 816, 268, -501, 213
+L589: cmp *r3, L623
+L590: dec *r4
+L591: stop
+L592: dec *r2
+L593: sub *r4, *r2
+L594: clr L600
+not *r4
+L595: .string "msllkjxqpq"
+L596: not L592
+L597: .data -790
+L598: .string "lubhetu"
+L599: clr r7
+bne L377
+L600: inc r7
+; comment
+L601: prn #-80
+not *r4
+L602: red L312
+L603: lea L617, r7
+L604: bne L29
+L605: bne *r6
+mov r7, L621
+L606: red *r3
+L607: cmp L615, L619
+L608: .data -279, -563, 91, 147, -680, -211, 609
+not r6
+L609: add #-137, r6
+clr r1
+clr r6
+
+cmp *r1, r2
+add *r7, r4
+lea L620, L618
+L610: bne *r0
+L611: bne *r6
+add *r3, r6
+L612: inc r7
+stop
+L613: inc *r0
+L614: jmp L566
+red *r7
+L615: dec L620
+L616: stop
+
+dec L140
+L617: add L619, r1
+L618: bne L420
+L619: lea L361, r2
+L620: not L537
+
+lea L606, *r6
+L621: stop
+; comment
+L622: stop
+L623: red r5
+jmp L276
+L624: cmp r1, #-23
+rts
+stop
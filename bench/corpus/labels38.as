@@ -0,0 +1,1040 @@
+; Generated by genCorpus --seed 39
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+L0: bne *r6
+red r7
+L1: mov *r1, r5
+L2: not L491
+L3: mov r7, L0
+add *r6, L0
+L4: prn r2
+L5: bne *r3
+lea L549, L5
+add *r6, *r0
+rts
+stop
+dec r6
+L6: add r7, r0
+L7: dec r3
+L8: cmp *r0, L272
+stop
+jsr L419
+add r6, *r4
+L9: inc r3
+L10: prn #2
+add #-17, *r5
+L11: mov L412, *r2
+L12: clr L10
+L13: mov #-45, *r2
+stop
+L14: bne L544
+bne L22
+bne L11
+clr *r3
+; comment
+cmp *r5, r1
+add *r7, *r1
+L15: stop
+L16: clr *r1
+L17: stop
+dec r6
+L18: lea L524, L303
+L19: .string "q"
+L20: mov #247, *r6
+jmp L198
+stop
+L21: rts
+L22: stop
+L23: not r3
+inc L8
+bne L23
+L24: lea L253, r4
+L25: jsr *r7
+inc L19
+L26: .data 833, -14, -145, 251, 666
+L27: clr L8
+L28: red *r0
+prn #77
+rts
+L29: lea L579, r6
+L30: add r1, r5
+red r7
+L31: .data -406, -466, 250, 561, -994
+mov r7, *r7
+L32: bne L148
+L33: add #-20, r3
+L34: .string "acysaapgdekjpeelb"
+L35: add L8, L451
+L36: cmp L374, *r3
+L37: not r7
+L38: rts
+L39: inc r7
+L40: lea L12, *r0
+L41: not r3
+not *r5
+
+L42: sub *r4, r2
+L43: sub *r3, r5
+L44: rts
+L45: mov r7, *r0
+bne *r4
+jsr L492
+L46: lea L41, r3
+L47: add #151, *r6
+clr L299
+rts
+L48: lea L289, *r0
+L49: stop
+L50: mov #217, r2
+lea L13, r4
+cmp L256, r3
+mov *r3, *r2
+L51: add #-115, L2
+bne L30
+L52: sub r5, r3
+L53: stop
+mov #-91, L584
+L54: rts
+prn L342
+L55: cmp r1, r7
+L56: .string "fozukjgbwrskh"
+L57: rts
+L58: rts
+inc r7
+L59: add L79, r3
+sub #63, *r4
+L60: red L45
+L61: mov L29, r5
+L62: inc r5
+L63: jsr *r5
+L64: lea L22, *r2
+L65: stop
+red r2
+L66: cmp r3, *r5
+L67: dec r1
+L68: lea L47, L289
+L69: bne *r4
+prn r1
+L70: inc L352
+jsr L28
+L71: .string "xwee"
+lea L39, r1
+L72: .data -775, 676, -123, -100, -742
+L73: mov #217, r1
+L74: lea L33, *r7
+L75: lea L18, *r0
+L76: dec L535
+L77: jmp *r2
+L78: rts
+prn #86
+bne L96
+; comment
+add L9, *r3
+L79: inc *r7
+prn L20
+L80: bne L70
+lea L463, r6
+; comment
+rts
+L81: .string "ffbrdqhmq"
+jsr *r0
+L82: mov L52, *r5
+clr L19
+L83: rts
+L84: add r1, *r7
+L85: cmp #-93, *r0
+L86: .string "ovbrdtmgczhsafaa"
+dec r6
+clr L476
+mov #-7, L69
+add L587, *r4
+prn *r4
+L87: .string "scqeufmqniizzinr"
+L88: not r2
+L89: not L45
+L90: inc r1
+red L27
+L91: inc r1
+L92: cmp L264, r2
+red L28
+cmp r7, #25
+L93: add r7, *r1
+mov L156, *r2
+L94: rts
+L95: clr L431
+L96: sub L444, *r0
+L97: cmp r6, r1
+; comment
+mov #70, r3
+L98: stop
+L99: .string "kygbuvjqbkmzeuuknnabl"
+rts
+L100: jsr *r4
+L101: .data -315, 453, -440, -121, -794, -392, 702, 298
+L102: cmp r1, L192
+L103: stop
+red *r3
+red r5
+L104: lea L96, r5
+dec L85
+L105: .data 860, -393, 8, 341, -732, -77, 867, 525
+L106: prn *r7
+clr *r3
+jsr *r1
+L107: mov *r1, L44
+L108: inc L157
+L109: mov #6, *r7
+dec *r4
+jmp *r2
+L110: dec r2
+jsr *r0
+L111: rts
+L112: lea L73, r2
+L113: mov L170, r7
+L114: cmp #-184, #148
+rts
+prn #-188
+cmp r5, L354
+jsr L47
+prn L62
+prn #-26
+L115: cmp L76, #-204
+lea L53, L74
+L116: add r7, r6
+inc *r1
+L117: dec L70
+L118: not L89
+inc r3
+L119: sub r0, *r3
+inc L177
+rts
+L120: jmp L53
+clr r2
+not *r2
+cmp r5, L329
+L121: dec r4
+stop
+L122: red r1
+red r3
+dec L31
+
+L123: jmp L416
+L124: sub #46, r4
+L125: .string "kfpcxly"
+stop
+L126: jsr L124
+L127: stop
+L128: .string "msppozhedixuisuruelbqkl"
+L129: jsr L5
+prn L142
+L130: not *r7
+jsr L81
+L131: rts
+L132: red L512
+L133: jsr L79
+red *r5
+
+clr r6
+L134: lea L119, r0
+L135: red L338
+L136: prn r2
+inc r3
+L137: prn #30
+L138: sub r3, r2
+L139: .string "mlzqkuqdchrlqogtomvxpv"
+red r1
+lea L34, L32
+mov L483, *r2
+L140: rts
+cmp #-215, L532
+sub #-78, r0
+L141: sub L123, L372
+L142: bne *r4
+cmp #43, #-22
+L143: jsr *r5
+L144: mov L29, *r3
+L145: red r4
+L146: prn #-159
+not *r5
+not r6
+L147: add #-123, *r2
+rts
+L148: dec *r6
+jmp *r2
+lea L163, L45
+L149: sub #-238, L208
+mov r2, r3
+L150: red *r0
+L151: rts
+L152: dec *r5
+stop
+inc r7
+red r4
+L153: .string "ertamjdlmicptogktjmztxuz"
+L154: prn #-27
+L155: prn #-7
+L156: stop
+dec *r2
+not L420
+L157: rts
+L158: .string "c"
+L159: bne *r2
+L160: jmp *r6
+L161: .data -423
+L162: bne L456
+L163: not r5
+L164: bne *r7
+L165: stop
+L166: not *r7
+; comment
+L167: clr r5
+L168: mov r1, L311
+L169: prn #9
+L170: not *r0
+L171: lea L299, L101
+mov *r2, *r6
+stop
+L172: sub r7, *r3
+not *r6
+L173: stop
+L174: inc *r4
+clr r6
+L175: cmp #97, #-166
+L176: .data -828, -467, 876, 179
+L177: prn r1
+add L545, L432
+dec r4
+jsr L444
+L178: sub L543, L87
+jmp *r7
+L179: bne *r7
+L180: bne L10
+cmp #179, *r6
+L181: not *r2
+inc r3
+L182: not L402
+rts
+L183: bne L264
+L184: dec r0
+red r4
+L185: sub #4, L187
+add #-32, L20
+L186: red L457
+L187: not L83
+L188: lea L314, *r7
+mov L6, r7
+
+L189: inc r0
+not *r1
+L190: mov *r4, L26
+L191: jsr L163
+L192: add #15, r7
+jmp *r6
+L193: jsr L151
+L194: stop
+L195: lea L16, *r0
+L196: prn #26
+prn L228
+L197: sub *r5, *r1
+L198: rts
+L199: .data 582, -354, 126
+stop
+L200: prn *r5
+L201: not L375
+mov L268, *r1
+L202: clr L584
+L203: not L589
+inc L8
+L204: sub #79, r3
+L205: add r4, *r5
+; comment
+L206: rts
+stop
+L207: sub r4, *r5
+; comment
+L208: mov *r4, *r3
+
+L209: jsr L24
+cmp #97, L71
+bne *r0
+L210: not *r7
+jsr L455
+mov r6, r2
+dec L297
+L211: bne L329
+L212: sub L87, *r2
+red r3
+L213: dec r0
+lea L500, *r1
+jsr L309
+not *r6
+red r1
+clr r5
+L214: jsr L442
+sub r1, r2
+jsr *r4
+red r3
+L215: jsr L69
+L216: mov #165, L111
+prn L19
+jmp *r2
+L217: rts
+L218: inc *r3
+L219: inc L211
+stop
+
+prn r2
+L220: not *r1
+add r6, *r5
+red L408
+L221: jmp L73
+L222: lea L109, L223
+L223: dec r5
+L224: not L359
+jsr L479
+L225: sub r5, r3
+L226: add *r7, r0
+red L94
+L227: mov #-104, L160
+; comment
+L228: bne *r4
+L229: add *r1, r5
+; comment
+L230: rts
+L231: clr r6
+inc r6
+cmp #-194, *r7
+L232: dec r6
+L233: clr r0
+L234: dec *r7
+clr L118
+L235: dec r6
+L236: red L308
+L237: mov *r3, *r6
+L238: lea L58, *r2
+L239: lea L311, r4
+L240: jmp *r3
+; comment
+cmp #68, #-170
+
+bne *r4
+L241: jsr *r7
+L242: add r1, r4
+L243: .string "kjyjvfgzukyqmxejeddgv"
+L244: cmp *r0, L502
+sub *r4, L561
+L245: prn L51
+L246: .string "nirqbswclnnifevwxaacnyrp"
+L247: cmp L77, *r4
+L248: prn L102
+mov #46, r1
+L249: dec L30
+add *r7, *r1
+L250: stop
+inc L329
+L251: rts
+L252: clr *r4
+L253: bne *r7
+sub *r0, r0
+stop
+L254: .data 385, -158, -387, -454, 347, -854, 323
+L255: jmp *r2
+L256: mov #-95, *r4
+L257: dec *r3
+L258: .string "rpyorybiewfjzthfnxy"
+L259: .data -237, -695, 420, 827, -721, -246
+add L476, L59
+add *r5, r5
+inc r3
+L260: lea L266, L235
+L261: jsr L543
+mov #-76, *r4
+L262: cmp *r5, *r5
+L263: clr L187
+red *r7
+L264: clr L67
+L265: jmp *r6
+L266: cmp L376, #-225
+L267: not *r4
+L268: jsr *r7
+L269: prn r0
+L270: prn #-125
+L271: lea L103, *r3
+L272: mov *r4, r1
+L273: sub #40, *r2
+L274: jsr L59
+L275: .data -35, -422, 115, 784, 139, -967, -824, 101
+L276: prn L602
+jsr L507
+red L328
+cmp #-220, L29
+dec L164
+L277: clr *r6
+L278: lea L347, L500
+add *r4, L48
+L279: red r5
+mov L239, *r4
+prn #244
+L280: .data -82, -695, -246, -657, 277
+L281: cmp #172, #-32
+L282: cmp #-212, r3
+; comment
+L283: .string "cydlgiqvbwsmeeadwsrl"
+L284: .data -540, -891, 963, -226
+stop
+mov r5, *r2
+prn L388
+clr *r3
+L285: cmp L495, #28
+cmp #-201, L443
+L286: prn L381
+jsr *r5
+L287: red r4
+L288: lea L527, *r6
+L289: prn *r2
+L290: clr r5
+L291: lea L442, L443
+L292: red r4
+L293: .string "yxadgdpuvy"
+L294: red r1
+jsr *r6
+; comment
+add *r2, r1
+L295: .string "pjuwiq"
+L296: dec r6
+L297: cmp r5, r7
+L298: red *r5
+prn L282
+L299: dec r2
+sub *r5, r7
+red r2
+L300: lea L363, *r7
+; comment
+L301: sub *r1, *r3
+L302: add r2, L376
+L303: mov r7, r2
+L304: not *r3
+L305: lea L54, *r3
+L306: sub *r4, L419
+L307: .data 420, -234
+L308: .data -950, 883, -225, -209, 793, -499
+L309: inc r0
+L310: red r2
+; comment
+L311: .string "iyiyzx"
+L312: cmp *r5, #22
+
+L313: clr L298
+; comment
+prn *r5
+lea L430, *r5
+L314: red *r6
+rts
+L315: rts
+inc r0
+L316: .data -432
+not r2
+L317: lea L192, r7
+L318: cmp *r7, *r2
+L319: stop
+L320: rts
+L321: .string "zijvhpbcrvox"
+L322: jsr L35
+L323: stop
+rts
+L324: stop
+L325: .string "imekuxj"
+add r1, L171
+L326: lea L114, *r1
+prn L524
+L327: cmp L277, r3
+clr r4
+L328: rts
+L329: jmp *r0
+L330: sub *r6, r1
+not L420
+L331: not *r4
+L332: prn L121
+red L78
+L333: jmp *r7
+L334: dec *r6
+cmp L22, *r0
+L335: .string "nlqxknmqqzhkzqleejrmu"
+L336: .data 785
+L337: clr r7
+prn #249
+stop
+L338: mov L511, r4
+jmp L600
+jmp L400
+; comment
+L339: bne L190
+prn L98
+L340: bne L397
+L341: not r3
+L342: not *r4
+L343: .data 969
+L344: dec L597
+L345: .string "rtrevvkoxsd"
+cmp *r2, *r0
+rts
+L346: .data -299, -339, -577, 185
+L347: bne L439
+; comment
+L348: clr r1
+L349: .string "r"
+L350: .data -633, -383
+not L238
+add #148, *r1
+L351: rts
+L352: clr *r0
+; comment
+lea L401, r3
+bne L477
+L353: bne L135
+L354: clr L211
+L355: jmp *r2
+L356: clr *r3
+red L450
+L357: .data 709, -122, 700, 64, -527
+L358: prn r7
+bne L280
+mov #110, r5
+L359: inc r1
+L360: .string "waayxxtrisytcwehzfp"
+L361: red L308
+lea L327, *r1
+L362: jsr L310
+red *r2
+L363: cmp *r6, #-183
+L364: cmp r2, *r0
+jmp L520
+L365: prn #-55
+L366: inc L496
+L367: lea L377, r5
+L368: jsr *r5
+L369: .data -120, 888, 450
+bne *r3
+mov *r7, r6
+add L518, L601
+clr L484
+L370: sub L311, *r3
+L371: clr *r4
+L372: rts
+L373: prn L116
+; comment
+L374: rts
+L375: jmp L195
+L376: prn r5
+clr *r4
+L377: rts
+L378: inc L150
+lea L390, r4
+; comment
+; comment
+not L433
+L379: jsr L184
+L380: red r2
+L381: bne *r0
+L382: dec L482
+L383: red L47
+L384: jmp *r3
+stop
+L385: bne L102
+L386: mov r2, *r1
+L387: jsr L582
+add *r7, *r1
+L388: jmp *r4
+
+; comment
+L389: lea L132, L164
+L390: rts
+mov *r3, r0
+L391: stop
+L392: dec L543
+L393: dec r1
+rts
+L394: sub L465, L581
+L395: inc L573
+L396: jmp *r0
+L397: cmp *r6, #161
+bne *r5
+mov L240, r0
+L398: jmp L353
+L399: clr L501
+L400: sub L409, L103
+inc *r2
+
+L401: jsr *r0
+dec r2
+L402: .string "htaykmvhchovvfrpylsqyyf"
+prn *r2
+L403: stop
+add L583, L532
+L404: .data 260, -884, -784
+jmp *r5
+clr *r6
+L405: add *r5, L39
+; comment
+L406: sub r1, L408
+dec *r2
+; comment
+add *r7, r4
+L407: .string "qavjxhllsukfylkkqylau"
+L408: sub *r1, L482
+stop
+L409: jmp L461
+L410: stop
+stop
+rts
+L411: lea L501, r2
+L412: inc r3
+L413: clr r5
+rts
+L414: jsr L165
+L415: cmp #-180, L423
+L416: bne L76
+L417: clr *r3
+rts
+L418: rts
+add *r3, L41
+L419: sub *r5, *r7
+L420: .data -984, 246, -950, -70
+inc *r2
+dec r1
+rts
+jmp *r0
+L421: lea L238, L529
+L422: .data -414, -378, -778, -961, 958, 94, 103
+L423: clr r3
+L424: not *r1
+L425: .string "lzuytwhsxziijv"
+L426: prn r7
+L427: lea L226, L37
+L428: prn *r7
+L429: stop
+L430: lea L488, r6
+L431: clr *r0
+L432: lea L16, L429
+stop
+L433: .string "iroi"
+L434: dec r6
+L435: bne L421
+L436: add L506, r5
+
+bne *r5
+L437: stop
+; comment
+
+L438: .string "rblhgnjmvzzuws"
+L439: not L59
+L440: clr r2
+cmp *r1, r5
+L441: inc L594
+L442: clr L493
+L443: .string "fsdbfghvxnivvvegilplkn"
+L444: bne *r2
+L445: stop
+L446: not r5
+not L458
+add L387, *r2
+L447: rts
+rts
+L448: sub *r1, r2
+sub r6, *r3
+L449: clr r7
+lea L5, *r0
+jsr L546
+bne *r2
+L450: bne *r2
+L451: add r7, L578
+L452: rts
+L453: bne *r0
+prn L489
+dec r7
+stop
+L454: .data -75, 488, -316, 633, 910, -913, 678, -682
+jmp *r6
+L455: stop
+L456: lea L371, L363
+L457: mov #102, *r5
+L458: jmp *r7
+clr r1
+not *r6
+jsr L31
+L459: not L483
+jsr *r0
+L460: red r3
+L461: jmp L583
+L462: mov #-212, L427
+sub L369, *r3
+L463: red *r2
+; comment
+L464: .data 750
+L465: cmp L553, #3
+prn #-9
+L466: inc L536
+L467: not L175
+L468: clr L224
+inc L36
+L469: .string "cmypbclgvs"
+L470: sub #209, L528
+L471: dec r4
+L472: dec *r5
+L473: add #-228, L489
+not r1
+L474: cmp r7, L423
+L475: rts
+mov #-246, *r7
+L476: not r3
+L477: dec r0
+inc L154
+L478: jsr *r7
+L479: .data 174, 469, 423, 57
+not *r4
+prn L569
+L480: stop
+L481: bne L545
+cmp #-247, r1
+L482: prn #80
+L483: red L561
+L484: stop
+L485: red r3
+L486: dec r6
+clr *r7
+L487: rts
+not r1
+not *r3
+L488: clr r7
+L489: cmp L557, #122
+dec r2
+dec *r2
+prn #144
+dec *r2
+L490: jmp L505
+L491: dec L160
+L492: .data -626, 290, 365, -989, 880, -133
+L493: inc L543
+mov L588, L575
+jsr L81
+prn r1
+L494: .string "dendzxofeuodgozfnwiab"
+dec L536
+L495: inc L511
+bne *r0
+L496: add #251, *r2
+; comment
+L497: .data -4, -637, -141, 939
+jmp *r5
+L498: prn L432
+not L550
+clr *r2
+red *r0
+L499: jmp *r6
+; comment
+L500: not r3
+L501: red r2
+L502: not r2
+stop
+bne *r1
+clr *r1
+L503: sub L576, r4
+add r5, r1
+inc r4
+L504: stop
+L505: .data 314, 254, -967, -689, 154, -163, 739, -581
+jsr *r1
+L506: mov L535, *r4
+L507: sub *r7, r3
+clr L589
+not *r7
+L508: lea L534, r3
+sub r1, *r3
+cmp r4, L534
+not *r3
+prn *r1
+L509: stop
+prn *r7
+lea L525, r2
+L510: .string "hudseancsbimaoxmrp"
+L511: stop
+
+L512: add *r0, L157
+L513: clr L189
+
+
+L514: not r3
+L515: add #211, r3
+L516: prn L88
+L517: mov *r2, r4
+rts
+L518: .data 803, 889, 580, 940, -814
+sub r6, L586
+L519: lea L555, r5
+L520: .string "pnapzveicxxkbxeya"
+dec r6
+; comment
+L521: .data -227, 849, 611, -410, 499, 311, -740
+L522: not r0
+bne L357
+red L39
+L523: not *r3
+L524: sub r2, r6
+dec r5
+L525: bne *r2
+L526: red L591
+L527: add #-189, r4
+L528: mov #60, *r3
+L529: clr L343
+mov *r6, *r5
+; comment
+L530: prn #-18
+L531: jmp *r2
+L532: bne *r5
+L533: cmp r7, r5
+L534: cmp r4, #245
+L535: add r0, *r0
+L536: sub L293, r6
+L537: sub #-91, *r3
+L538: .data 959
+mov *r7, r2
+L539: add *r7, r0
+sub r0, r5
+rts
+not *r3
+add #153, r2
+mov *r2, L242
+L540: not L552
+L541: inc *r3
+rts
+L542: .data 445, -923, 40, 830, -689, 799, -998
+L543: sub #-53, L462
+L544: .data 170, 401, -657, -899, 330, 279, -121, 910
+L545: sub r3, *r5
+L546: prn #-175
+rts
+jmp *r7
+sub r6, *r4
+L547: inc r6
+stop
+dec r7
+L548: not *r6
+red r6
+L549: not r6
+; comment
+bne L583
+L550: cmp *r0, *r5
+L551: bne L343
+L552: stop
+L553: clr L3
+L554: clr *r7
+L555: not *r0
+L556: lea L132, *r3
+L557: jsr L559
+L558: .data -773, -945, 447
+L559: prn r2
+prn r1
+L560: clr L360
+L561: mov #-135, r5
+jmp L584
+L562: bne L600
+L563: sub *r1, r5
+L564: not r4
+rts
+L565: prn r3
+not *r6
+add r1, r3
+L566: clr L149
+L567: jsr L603
+L568: jsr L521
+L569: not r0
+L570: stop
+L571: .string "ssiignlmqpvooewpdmbmjddb"
+prn *r2
+bne L592
+red *r3
+L572: inc *r3
+L573: dec r3
+L574: inc r6
+stop
+L575: stop
+L576: mov #254, r5
+L577: stop
+L578: not L284
+L579: .data -184, -656, -200, -345, -832, -199, -453
+L580: stop
+L581: sub r5, r4
+L582: lea L381, r7
+; comment
+cmp #13, #-108
+jmp *r2
+rts
+lea L27, L603
+lea L593, r0
+L583: bne L97
+L584: add *r4, r3
+
+L585: inc r1
+L586: stop
+L587: red *r6
+L588: jsr L593
+L589: sub L3, L603
+mov r6, r0
+L590: stop
+L591: .string "envbqslhhal"
+L592: .data -6
+not r6
+L593: red L603
+L594: dec L560
+mov L595, r6
+L595: add #93, *r4
+L596: lea L427, *r0
+L597: jmp L602
+red L387
+L598: add L601, L167
+L599: .data 75, 720, 299, -952, 488, 323, -848
+L600: prn r6
+L601: prn *r5
+L602: not r2
+mov r0, L603
+not *r1
+L603: lea L21, *r6
+inc r1
+not *r6
+stop
@@ -0,0 +1,1041 @@
+; Generated by genCorpus --seed 40
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+L0: prn #86
+L1: sub #-246, L373
+L2: rts
+cmp *r0, #160
+L3: dec *r6
+L4: jsr *r1
+L5: dec *r5
+prn *r4
+L6: clr L572
+L7: lea L445, r1
+prn #-241
+L8: jmp L224
+L9: inc *r6
+L10: dec *r4
+rts
+L11: .string "dxzbelbxxfwbbylaux"
+rts
+cmp L506, *r3
+clr *r5
+L12: clr L4
+prn L6
+L13: mov #74, r3
+not *r0
+L14: cmp r1, *r2
+L15: jmp *r1
+L16: .data -801, -147, 797, 139
+prn #250
+jmp *r5
+L17: cmp L12, r2
+L18: stop
+L19: lea L561, L332
+L20: clr L11
+bne *r3
+sub #-183, r0
+bne L214
+L21: stop
+L22: inc r4
+L23: .data 271, -254, 440, -371, 762, 413
+clr *r0
+L24: dec L379
+sub L23, *r6
+L25: prn *r0
+L26: prn *r6
+L27: sub r4, L98
+L28: .data -878, -733, -749, 459, -537
+not *r2
+; comment
+L29: red L23
+stop
+L30: not *r6
+L31: add *r3, L1
+L32: cmp L166, #-42
+bne L10
+not r1
+L33: .data 245
+; comment
+clr *r4
+L34: .data -338, 760, -187, 919
+bne L18
+jmp L8
+L35: prn r6
+inc L98
+bne L35
+L36: dec *r0
+L37: .data 918, -768, -845, 201, 798, 684
+jmp *r7
+L38: clr *r1
+L39: not L108
+dec *r3
+L40: stop
+L41: bne *r7
+L42: sub L14, *r6
+L43: not *r0
+L44: cmp #143, L285
+
+rts
+inc r7
+L45: .string "xawiylxvzrnurvtfoxob"
+not *r7
+L46: add *r1, *r3
+L47: .string "nnlfycrku"
+mov L38, r1
+L48: add #-9, r3
+L49: add L559, *r2
+add #206, r4
+cmp #-119, L598
+L50: .data 597, -864, -68, -940, -901, -759, -691
+L51: red *r0
+mov r4, r4
+L52: .string "yruwwygsel"
+inc r6
+L53: rts
+L54: sub r3, *r1
+bne *r3
+inc *r2
+mov r6, L568
+L55: jsr L6
+L56: rts
+L57: red L13
+L58: .data -624
+L59: jsr L532
+jsr *r5
+dec *r3
+inc *r4
+L60: rts
+stop
+L61: red L560
+not r1
+clr *r7
+L62: clr r5
+L63: jsr *r4
+L64: lea L89, r5
+L65: not r1
+L66: bne *r1
+L67: stop
+; comment
+L68: rts
+L69: jmp L64
+L70: stop
+L71: .string "xxyebhdveryawk"
+L72: mov L370, r0
+L73: prn #96
+rts
+L74: jsr *r3
+L75: inc *r2
+red L55
+L76: dec *r6
+rts
+mov *r2, r4
+clr *r2
+rts
+L77: .data 409, 194, 698, 186
+stop
+cmp *r7, r7
+L78: .string "jbdtsxpwnqve"
+L79: bne *r7
+L80: rts
+L81: add #15, r5
+clr r6
+L82: jmp *r5
+sub #-125, *r5
+dec *r5
+rts
+; comment
+L83: jsr *r1
+jmp *r2
+clr r3
+red r2
+rts
+L84: stop
+L85: inc L24
+L86: .data 122, 171, -756, -698, 836
+L87: .data -506
+L88: add *r2, L17
+not *r0
+L89: sub r5, L11
+jsr *r1
+L90: bne L300
+L91: sub #4, r5
+L92: cmp r4, *r7
+L93: stop
+not r1
+L94: jsr *r5
+L95: clr r5
+add *r6, *r3
+
+not *r5
+L96: lea L43, r1
+L97: .data -733, -194, -646, -553, -945, 525, -631, 652
+L98: not *r6
+lea L370, r4
+L99: mov L49, *r4
+jsr *r1
+clr L587
+L100: stop
+lea L546, L31
+L101: bne L262
+
+L102: rts
+L103: red r3
+lea L572, *r7
+L104: .string "mlkdocdugvov"
+L105: dec r6
+L106: mov #-112, *r2
+L107: sub #9, r2
+L108: .data 22
+mov L14, *r6
+not L358
+jmp *r1
+inc *r5
+lea L242, r6
+L109: bne L267
+
+sub r4, *r1
+add #185, *r6
+L110: .data -918, -314, 392, 227, 338
+L111: not L464
+L112: sub #-226, r0
+L113: rts
+inc *r7
+L114: mov r7, L529
+not *r1
+bne L47
+L115: not r0
+dec L116
+dec L56
+red *r5
+L116: jmp *r7
+L117: bne *r5
+clr L103
+lea L29, *r7
+mov *r1, *r1
+L118: bne L312
+not L0
+add #-131, L458
+L119: clr r2
+L120: red L67
+L121: mov *r3, r3
+L122: rts
+L123: lea L278, r3
+L124: dec r2
+clr L149
+red r6
+L125: prn L243
+sub *r4, r2
+L126: mov #57, L56
+L127: .string "tkfjdkhiqrwqzeefalqdqdpf"
+sub L113, L35
+L128: stop
+L129: red r6
+L130: lea L268, *r3
+not *r3
+L131: lea L560, L90
+L132: prn r0
+L133: red *r6
+lea L591, r7
+L134: jmp *r3
+L135: red r1
+L136: .string "ugoeazkjix"
+L137: sub #-97, L570
+L138: bne L72
+L139: add r0, r5
+L140: dec r1
+L141: bne *r0
+L142: jsr *r7
+L143: .string "pxakryzdplupl"
+jmp L76
+L144: inc *r7
+dec r0
+mov *r6, r5
+clr r4
+L145: rts
+sub L34, r7
+L146: .string "rld"
+L147: .string "dgnhdgmtjiuljzzdgmeiq"
+L148: .data 211, 778, -201, -990, 258, -592
+L149: mov #-251, r6
+prn r0
+sub r7, *r2
+L150: add L53, L471
+stop
+bne *r3
+L151: clr L147
+clr *r6
+L152: .string "zewkzatmhegsosqsxl"
+L153: .string "fboelapvgsescavzufinw"
+dec r1
+L154: dec L461
+L155: .string "qlcpobefurekhamm"
+L156: lea L72, L146
+L157: jsr *r4
+L158: sub L330, L487
+mov *r5, *r7
+jmp *r5
+dec L319
+prn *r2
+L159: jsr L432
+L160: stop
+L161: sub *r3, L100
+L162: .data 988, 795, 584, 638, 106, -785, -364, -45
+L163: dec L68
+L164: bne *r2
+L165: add L34, r7
+L166: stop
+L167: clr r5
+; comment
+L168: .string "l"
+L169: inc *r6
+stop
+L170: add *r3, *r2
+L171: lea L194, L105
+L172: jmp L276
+L173: bne *r2
+lea L582, *r7
+L174: bne *r2
+mov L334, *r4
+clr r7
+L175: clr L53
+L176: cmp *r0, r3
+mov *r7, r1
+L177: bne L214
+L178: jmp L41
+L179: red *r5
+not r0
+L180: red r2
+cmp r1, #251
+L181: clr L15
+mov #-148, *r6
+L182: .string "wqjbsaytqbsagyjwx"
+inc L313
+L183: bne L355
+jsr *r7
+L184: add #-179, L333
+red r7
+L185: bne L264
+lea L228, L39
+L186: not L216
+L187: cmp *r5, r5
+L188: red r4
+L189: lea L69, L96
+L190: clr L445
+L191: inc L152
+L192: red r5
+L193: bne L90
+L194: dec *r5
+L195: cmp r0, L175
+L196: cmp L74, L114
+jmp L469
+
+L197: .string "engqzqx"
+L198: lea L444, L449
+L199: bne L189
+L200: stop
+L201: lea L161, *r4
+L202: add L470, *r2
+red *r5
+L203: red L93
+L204: lea L273, r2
+rts
+L205: lea L106, r6
+
+L206: inc *r5
+L207: inc r5
+clr r6
+; comment
+not r2
+L208: red *r1
+L209: .string "kglgt"
+L210: cmp *r2, *r0
+L211: jmp L497
+L212: mov *r7, *r4
+L213: prn *r3
+L214: jmp L159
+L215: rts
+rts
+sub r1, r3
+mov *r3, *r2
+L216: bne *r7
+L217: jmp L416
+L218: not r4
+L219: rts
+L220: add *r0, r3
+L221: mov L143, r5
+L222: jmp L106
+L223: stop
+L224: cmp L349, r5
+L225: jmp L170
+L226: mov r0, r0
+L227: prn #-213
+L228: sub L471, *r2
+lea L84, L357
+L229: .string "gyvfijjujkv"
+mov L189, *r5
+L230: prn #-202
+dec r0
+L231: jmp L190
+L232: red L559
+add #128, L200
+L233: lea L12, *r7
+L234: mov L220, *r3
+L235: jmp *r5
+sub L284, r4
+L236: jsr L61
+L237: dec L35
+L238: red L603
+clr r4
+L239: red *r5
+rts
+L240: clr L227
+L241: .data -431, 419, -638
+stop
+add L366, L12
+L242: not L96
+L243: bne *r6
+bne *r5
+lea L449, L251
+jmp L531
+L244: mov L169, r3
+not L22
+rts
+L245: cmp #185, #42
+L246: inc *r2
+cmp L128, L202
+jmp L403
+L247: red r2
+L248: lea L295, r5
+bne L2
+add L134, *r2
+clr r6
+L249: sub *r4, r3
+L250: mov L395, *r7
+L251: .string "gamohrntugytfvga"
+L252: jsr *r4
+inc r7
+not *r1
+mov L124, *r1
+L253: bne L155
+dec r5
+L254: red *r4
+red r0
+bne L76
+clr *r6
+
+L255: clr r3
+L256: clr *r4
+L257: rts
+L258: jsr *r4
+L259: jmp *r5
+L260: prn r5
+L261: inc r4
+L262: stop
+stop
+lea L510, L523
+L263: .string "xcdlflcuahhqrffnurj"
+L264: rts
+bne L505
+L265: stop
+L266: rts
+L267: bne *r1
+sub L194, L585
+bne L499
+L268: add #-189, L359
+add #-125, L454
+L269: rts
+L270: .string "lwsvemr"
+L271: rts
+L272: jsr *r2
+lea L144, r7
+jmp L145
+bne L470
+L273: mov L44, r3
+L274: cmp r2, r3
+lea L211, r4
+lea L236, L206
+L275: .data -698, 495, 940, 303, -361, -691, -712, -835
+L276: prn #-229
+L277: lea L422, L209
+lea L297, r7
+L278: sub #67, *r3
+lea L378, r4
+clr r1
+; comment
+L279: .string "vmbuwjmsihrkzdrnbzsmtvg"
+add L273, *r5
+prn #174
+L280: jsr *r7
+L281: bne *r0
+L282: .string "aos"
+L283: .data 860
+mov L219, L485
+jmp L174
+L284: bne *r5
+L285: sub *r6, L183
+L286: jmp *r1
+L287: rts
+L288: mov L235, *r4
+L289: stop
+clr L68
+L290: prn r3
+L291: mov L37, *r5
+red *r7
+prn L597
+L292: red *r4
+L293: inc *r0
+L294: rts
+L295: add #-52, *r1
+red L479
+sub r5, r4
+L296: rts
+lea L94, r0
+L297: bne L131
+L298: .string "fibcuomgwa"
+red *r5
+L299: .string "kj"
+lea L176, r0
+L300: jmp L611
+L301: prn r2
+clr L43
+L302: bne L215
+jsr *r3
+dec L338
+L303: .data -103, -817, -489, 786, 151
+clr *r0
+L304: not *r7
+L305: .string "xm"
+L306: dec r4
+L307: prn #-191
+L308: jsr *r3
+L309: bne L239
+
+jsr *r3
+L310: sub r2, r0
+jsr *r0
+L311: add #-167, *r4
+L312: jmp *r2
+
+
+lea L333, L603
+L313: .data 661
+prn #59
+L314: lea L143, r4
+jsr L97
+inc r5
+jsr *r2
+L315: lea L10, *r1
+L316: rts
+L317: jsr L371
+L318: not r6
+jmp *r4
+L319: .string "a"
+; comment
+clr L453
+bne *r2
+jsr L87
+L320: dec L124
+inc *r7
+L321: .string "mbpnsnsvxw"
+L322: jsr *r7
+L323: prn L217
+clr r5
+not *r0
+lea L381, *r2
+L324: jmp L205
+L325: prn L322
+; comment
+L326: not L539
+L327: not L383
+L328: jmp *r2
+L329: clr L611
+L330: jsr *r7
+L331: lea L243, *r6
+L332: rts
+jmp *r6
+dec *r7
+L333: prn r4
+L334: jsr L286
+jsr *r6
+L335: cmp *r4, *r3
+L336: stop
+L337: dec L457
+L338: lea L579, r5
+L339: clr r5
+L340: add r3, r6
+L341: lea L241, r7
+L342: jsr L607
+jmp *r4
+mov r1, r5
+red r3
+mov #131, *r1
+lea L449, *r5
+L343: sub r2, *r3
+L344: mov *r5, L285
+L345: clr *r3
+stop
+sub #-153, *r0
+
+L346: stop
+not *r2
+L347: rts
+L348: rts
+prn *r4
+L349: .data -861, 33, 592, 494, -145, -219
+clr L485
+prn #-5
+L350: stop
+sub *r7, r6
+L351: jmp *r4
+L352: .string "phnbmitngo"
+L353: cmp *r7, r0
+not *r2
+L354: jmp *r3
+jsr *r6
+L355: bne L487
+; comment
+; comment
+prn L530
+jsr L337
+L356: jsr *r0
+lea L180, *r1
+L357: bne L309
+jmp *r0
+L358: dec r5
+L359: red *r1
+L360: .string "cslukppxdlnxjko"
+bne L345
+lea L505, L414
+red L418
+L361: stop
+L362: jsr *r2
+red L553
+L363: mov r0, r1
+L364: inc r1
+cmp L375, L440
+
+L365: add L547, L2
+L366: cmp r2, *r7
+
+clr *r2
+L367: cmp r6, *r0
+; comment
+L368: red r1
+L369: bne *r5
+not L26
+L370: inc r7
+L371: inc r7
+L372: dec r2
+L373: dec *r2
+L374: jmp *r6
+
+L375: sub L275, L442
+L376: .data -219, -925, -143, -860, -298, -778, -42, 522
+inc *r2
+L377: bne *r7
+L378: stop
+L379: red r4
+L380: not L94
+L381: prn #-109
+
+stop
+L382: rts
+L383: rts
+L384: .string "eevxdnzxicsmovdpapkclua"
+L385: lea L422, r0
+
+not L25
+; comment
+jmp *r2
+L386: stop
+L387: mov r3, r0
+stop
+L388: mov #183, *r7
+not *r1
+L389: rts
+L390: bne L435
+not r5
+L391: add #192, *r3
+L392: bne *r2
+L393: dec L174
+L394: jmp L457
+L395: rts
+L396: mov r3, L523
+L397: mov r6, L579
+jsr L112
+prn L225
+L398: jsr L228
+rts
+sub r5, r2
+stop
+L399: inc r1
+not *r3
+bne L281
+L400: dec r0
+L401: jmp L119
+L402: not L221
+bne *r5
+L403: rts
+clr L567
+L404: mov L204, *r2
+L405: clr L469
+stop
+L406: not r2
+L407: .data -453, 356, -174, 665, 22, -366, 444
+L408: sub #240, *r3
+lea L453, *r7
+add #-19, L360
+L409: prn r7
+L410: not r3
+bne *r0
+L411: .data -466, -436, -453, -287, 513, 276
+L412: .string "wftoxjltke"
+L413: .data -471
+prn L40
+bne *r3
+L414: lea L317, r7
+L415: mov *r7, *r5
+stop
+L416: lea L283, *r2
+L417: rts
+add L511, *r1
+L418: add #18, L489
+L419: prn L157
+L420: cmp #-64, *r1
+L421: clr L534
+L422: jmp L467
+L423: sub #-114, *r5
+L424: jmp *r2
+L425: jsr *r3
+L426: cmp L314, *r0
+L427: dec L602
+L428: bne L490
+L429: stop
+L430: not r1
+rts
+add r3, *r0
+L431: rts
+L432: dec r4
+dec r7
+L433: jmp *r6
+L434: jsr *r4
+stop
+L435: not r6
+L436: prn L483
+sub *r3, L86
+L437: prn L465
+red L171
+clr L9
+L438: not r7
+jsr *r4
+mov #-49, r1
+prn r0
+L439: jmp L377
+L440: lea L273, L612
+L441: inc L482
+L442: red r6
+L443: red L473
+L444: jsr L488
+L445: .string "buznvlnxqhkne"
+L446: lea L577, *r5
+L447: stop
+L448: jsr L497
+prn L346
+; comment
+L449: rts
+L450: .string "fyhjzldvmjzgfuxthquv"
+cmp #26, L538
+L451: lea L472, *r6
+L452: jsr L593
+L453: stop
+L454: bne L393
+L455: rts
+L456: sub *r5, *r0
+L457: dec *r3
+L458: .string "bukvscmppfltx"
+L459: jsr *r7
+L460: stop
+L461: bne L190
+red L313
+L462: clr *r5
+lea L563, L274
+L463: dec L202
+lea L608, *r4
+not *r3
+L464: inc r2
+L465: inc r7
+L466: .data -75, -738, -125
+stop
+sub r1, L7
+L467: red r2
+lea L556, *r0
+L468: prn L524
+L469: dec r7
+; comment
+L470: rts
+jmp L62
+stop
+L471: sub r7, L466
+red *r4
+L472: stop
+jsr *r3
+L473: rts
+L474: add L547, *r6
+L475: dec r4
+L476: .data 990
+L477: add #99, r1
+L478: rts
+L479: lea L105, L179
+L480: red *r0
+mov r7, *r2
+L481: inc L607
+sub *r1, L510
+stop
+jmp *r7
+L482: bne L511
+stop
+L483: sub #6, r0
+L484: jmp *r0
+L485: add L405, L555
+L486: stop
+L487: bne L542
+L488: not *r3
+mov #-111, r4
+bne *r5
+L489: stop
+lea L493, *r4
+sub *r1, L498
+rts
+L490: dec L338
+L491: red *r0
+L492: sub *r5, L578
+L493: dec *r1
+inc *r0
+L494: bne L583
+lea L524, L225
+L495: .data 79, 966, 700, -363, -594
+L496: sub L522, r1
+L497: .string "xzzpw"
+jmp *r0
+L498: clr L346
+L499: prn *r4
+L500: not r1
+cmp #43, #-91
+L501: .string "zglejbheutfolfim"
+L502: add *r6, r5
+clr L82
+L503: .string "akbyjuz"
+L504: bne L595
+cmp r1, L53
+L505: .string "jsvrnfjcearzcfuacspceyof"
+mov #-41, L545
+; comment
+; comment
+L506: jmp L335
+L507: stop
+dec *r3
+L508: prn L554
+L509: .data -80, -493, 211, 795, -50, 963, 951
+L510: mov *r1, *r6
+L511: rts
+jmp *r5
+L512: .data 925, 384, -769
+dec L250
+L513: sub L223, L569
+L514: add *r4, *r2
+clr L541
+L515: mov #208, *r2
+red *r1
+sub #-113, L73
+clr L576
+L516: .string "hdsbibktkuhe"
+L517: inc *r1
+L518: lea L486, *r1
+L519: prn *r3
+red *r6
+bne L608
+L520: mov #-238, *r0
+L521: clr *r7
+L522: bne L85
+L523: sub L64, *r5
+sub L557, *r3
+jmp *r5
+L524: cmp L402, #124
+L525: prn L590
+prn L591
+cmp L198, r3
+lea L250, r5
+L526: jsr *r7
+not L102
+L527: inc r2
+L528: mov #-57, *r2
+L529: inc L598
+L530: cmp *r3, *r5
+prn r7
+L531: cmp *r2, #189
+red *r4
+L532: mov #119, L609
+not L449
+L533: prn L462
+L534: stop
+L535: bne *r2
+red L447
+L536: .data -112
+L537: rts
+L538: cmp r4, r7
+L539: sub L271, *r1
+L540: dec L613
+inc r1
+L541: sub *r5, r2
+L542: red r6
+red L170
+L543: bne *r7
+rts
+L544: jsr *r5
+bne *r7
+L545: inc L558
+L546: .string "uciz"
+L547: .string "uelkjsze"
+L548: add *r1, L109
+jsr L501
+L549: sub L387, L89
+rts
+L550: .string "spvkfrtonpgkarwkjfzciq"
+L551: inc L365
+add L444, L86
+lea L446, r6
+L552: red *r7
+L553: inc *r0
+L554: cmp L608, *r2
+L555: add L445, *r5
+not L37
+L556: bne *r6
+L557: jmp L600
+red L600
+L558: inc r3
+L559: dec r3
+add L473, *r5
+L560: dec *r4
+L561: add L539, *r4
+stop
+L562: .string "ywkrif"
+L563: sub L573, *r0
+L564: bne *r7
+mov *r2, *r3
+L565: clr r1
+L566: cmp L266, r4
+L567: red r3
+add *r4, *r5
+dec r4
+L568: .string "lry"
+dec r5
+L569: cmp r1, #-68
+L570: red r2
+L571: dec L405
+L572: .string "wsqwhhgveugt"
+
+jmp L605
+
+L573: .string "k"
+L574: bne *r6
+jsr L395
+lea L613, *r0
+jmp *r2
+L575: lea L584, *r6
+jmp L610
+L576: .string "clswullmphpysfxitscel"
+L577: not r1
+L578: stop
+L579: not *r0
+L580: sub L599, r3
+L581: red *r3
+L582: clr L335
+mov r4, *r3
+rts
+L583: bne *r5
+L584: prn r0
+L585: clr *r1
+prn L608
+L586: .data 48, -730, -276, -265, 287, 463, 253
+L587: cmp *r4, #-199
+L588: red *r0
+L589: stop
+L590: red r7
+L591: jsr L381
+clr *r4
+
+L592: cmp *r2, L583
+L593: red *r6
+L594: jmp L334
+
+L595: bne L131
+jsr L609
+L596: dec *r5
+L597: mov r5, L330
+jmp *r4
+L598: mov r6, *r0
+L599: dec *r2
+dec *r4
+L600: prn L602
+L601: red *r3
+sub r7, L311
+L602: jmp L609
+L603: stop
+not r5
+add *r3, L376
+L604: prn #-28
+L605: bne *r5
+cmp #240, r1
+L606: jsr L611
+rts
+L607: not L207
+L608: add L613, r5
+mov r2, r2
+L609: stop
+L610: .data -872, 854, 864, -848, -654, -155
+
+L611: bne L612
+rts
+rts
+; comment
+L612: dec L613
+L613: stop
+stop
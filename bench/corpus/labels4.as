@@ -0,0 +1,1040 @@
+; Generated by genCorpus --seed 5
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+prn L80
+L0: inc r1
+; comment
+stop
+L1: add #17, r7
+jsr L292
+rts
+inc L263
+sub L1, L135
+L2: sub *r2, *r2
+L3: jmp *r1
+inc L2
+dec r1
+L4: bne *r5
+clr *r0
+L5: stop
+L6: clr r5
+L7: bne L384
+L8: jmp L3
+L9: not L233
+L10: lea L1, L359
+stop
+L11: prn *r3
+dec r5
+cmp *r5, #-150
+L12: .string "fey"
+inc L471
+L13: prn r2
+lea L338, r0
+bne L161
+L14: .string "iucdgksfjhmuqmmipsdm"
+L15: stop
+L16: red L3
+L17: stop
+L18: cmp *r7, #-19
+L19: sub *r1, *r4
+rts
+L20: lea L353, *r3
+L21: dec *r3
+add #10, *r3
+lea L18, L2
+stop
+L22: .data 761, 972, 142, -109, 855, 561, -247, -353
+L23: .data -484, 980, 438, 957, 678, 487, -420
+L24: inc *r3
+; comment
+L25: lea L15, r5
+mov #-107, r1
+L26: mov r5, *r7
+L27: prn r1
+L28: clr L235
+L29: stop
+jmp L457
+red L3
+L30: mov L453, *r0
+L31: .data 72, 582, -663, -959
+L32: stop
+red *r7
+L33: jmp L20
+L34: bne L105
+stop
+clr L300
+L35: .string "glrtkgppdolemejhhatfve"
+L36: cmp #-116, L21
+; comment
+stop
+L37: rts
+L38: stop
+lea L1, *r2
+L39: add *r3, r7
+inc r5
+jsr L11
+not L23
+L40: stop
+sub r3, r5
+L41: red r4
+inc *r4
+L42: lea L536, r3
+prn r3
+L43: bne *r6
+lea L497, *r3
+L44: bne *r3
+prn r1
+L45: jsr L49
+sub r7, r7
+L46: not *r1
+jmp *r5
+L47: mov *r1, r1
+L48: jmp *r6
+stop
+L49: stop
+L50: mov r5, r1
+add r2, *r1
+bne *r6
+rts
+mov r4, *r2
+L51: add *r7, L46
+; comment
+L52: clr *r3
+L53: prn *r5
+L54: jsr *r1
+L55: stop
+jsr *r0
+L56: clr r1
+not *r4
+add #-219, *r6
+L57: red *r4
+L58: bne *r2
+L59: add r0, L301
+rts
+jsr *r5
+L60: inc *r5
+L61: clr L539
+L62: prn r3
+inc r7
+prn #141
+L63: cmp L17, L370
+L64: add L62, *r7
+L65: .string "wyajxrmtlbtxn"
+L66: .string "hlvnrumcfrctisdsmauarz"
+inc *r5
+L67: not *r5
+L68: prn #-246
+L69: dec L229
+L70: sub L523, *r6
+sub #252, *r2
+L71: .string "lnnibylet"
+mov *r4, *r2
+L72: jsr *r1
+L73: red *r3
+L74: rts
+lea L53, *r6
+red L397
+rts
+sub r5, L36
+L75: jmp *r5
+dec *r7
+L76: lea L71, *r1
+sub *r6, L47
+lea L575, *r6
+
+dec r6
+lea L223, L6
+L77: .data -818, -358
+add #-59, r3
+inc r2
+L78: inc *r5
+stop
+clr L388
+lea L68, r3
+rts
+jmp *r6
+rts
+not r4
+cmp r0, L72
+L79: jsr *r4
+L80: not r6
+L81: sub r6, *r0
+L82: clr r7
+L83: dec L220
+L84: sub L269, r7
+L85: red r2
+rts
+L86: .data -296, -392, 905, 487, -373, 86
+L87: prn L206
+rts
+L88: .data -272, 931, -961
+L89: not L333
+prn #-87
+stop
+dec r4
+sub r5, r7
+not *r3
+prn L4
+L90: .string "fmozygmzxdxbjhlxoflqdzna"
+L91: sub r5, *r0
+red *r7
+L92: .data 178, -939, -689, 263, 990, 604, -544, 344
+L93: jsr L300
+L94: prn *r0
+L95: .data 992, 551, -24, 965, 268, 113
+L96: .string "dq"
+dec *r0
+not L59
+L97: cmp L202, L225
+L98: bne *r7
+L99: not L246
+sub L125, r3
+lea L17, *r6
+L100: .string "kqwaqkglrphkzsg"
+rts
+L101: inc r7
+L102: clr *r4
+; comment
+L103: .string "gmtgtpjmjgsjugkdcto"
+L104: clr *r5
+L105: bne L30
+prn r5
+red r2
+L106: stop
+jsr L50
+L107: dec L479
+L108: bne L517
+not r0
+L109: .string "czu"
+L110: bne L426
+add *r6, L28
+L111: dec r1
+L112: sub L2, *r6
+not L565
+L113: .data 190, -1000, 338, -148, 394, 668
+stop
+L114: prn r6
+not *r1
+; comment
+L115: inc *r0
+L116: lea L495, L405
+L117: jmp *r5
+L118: rts
+L119: add L62, r0
+inc r4
+L120: inc L532
+add L173, *r3
+bne L424
+jmp L104
+red r0
+add r5, r7
+L121: inc *r2
+L122: .string "uyt"
+stop
+cmp r2, r2
+L123: .data 992, 624, -753
+not L50
+mov L15, L48
+L124: dec r6
+dec r0
+clr L30
+dec L192
+L125: .string "jmjyhbkxmdkwxgkbl"
+; comment
+L126: stop
+sub #227, *r6
+L127: bne L425
+add r5, *r0
+
+L128: sub L143, L530
+L129: rts
+jmp L80
+prn *r6
+prn r1
+bne L27
+cmp r7, L22
+L130: lea L288, L114
+
+L131: bne L82
+L132: rts
+L133: stop
+L134: sub *r2, *r0
+L135: add #-243, *r7
+jmp *r6
+L136: .data -860
+prn L413
+L137: .data 49, -441, -480
+L138: cmp *r1, *r5
+clr r7
+L139: cmp r7, L591
+L140: cmp #-110, r5
+L141: inc *r1
+L142: jsr *r1
+jsr L88
+stop
+L143: lea L367, L134
+cmp r7, #-60
+L144: add r4, L383
+L145: bne *r4
+L146: bne *r6
+L147: red r2
+L148: prn #-88
+L149: mov L149, *r7
+jsr L353
+L150: cmp r6, *r0
+L151: red r1
+L152: lea L451, *r5
+lea L64, *r2
+L153: red *r6
+not L301
+L154: inc L502
+mov #27, *r4
+L155: not L308
+L156: dec *r4
+L157: cmp L591, r4
+dec L11
+bne *r3
+L158: rts
+jmp L12
+prn #88
+L159: add #-106, L108
+L160: inc *r6
+L161: clr L61
+L162: red *r7
+L163: bne L299
+L164: mov L449, *r7
+
+not *r2
+bne *r4
+L165: not L150
+L166: dec *r0
+L167: .data 820, -993, -92, 808, 657, -708
+L168: stop
+dec *r3
+add r0, *r1
+L169: mov L95, *r0
+L170: not r1
+L171: stop
+add *r6, *r4
+L172: red L462
+jsr L79
+L173: cmp #-44, r7
+; comment
+L174: .string "wctmhjskafxiwpro"
+lea L248, L96
+dec L92
+L175: bne *r7
+clr r7
+L176: inc *r3
+cmp r6, #192
+L177: jmp L9
+L178: rts
+sub L172, r0
+L179: add L72, r7
+bne *r2
+
+clr L72
+
+L180: cmp r1, L149
+
+dec L452
+clr r4
+sub #-101, r5
+L181: lea L102, *r3
+bne *r5
+L182: .string "vogclndtwqmwmqker"
+prn *r4
+L183: dec *r5
+L184: jmp *r5
+L185: lea L195, *r4
+lea L51, L20
+bne *r0
+L186: clr r4
+add #184, *r5
+L187: jmp *r5
+L188: dec r2
+L189: .string "rlixscumzv"
+
+L190: sub #156, *r2
+stop
+L191: lea L514, L101
+L192: rts
+jmp *r2
+L193: .string "bksco"
+L194: inc *r0
+L195: bne *r0
+add L205, L115
+L196: red *r4
+add r1, r7
+L197: lea L115, L134
+not r5
+L198: not *r1
+L199: not *r0
+L200: dec *r3
+L201: add *r3, r4
+mov *r7, *r2
+prn r0
+L202: prn *r2
+L203: clr *r5
+L204: clr *r0
+not L551
+rts
+jmp *r6
+L205: jsr *r3
+red *r6
+L206: dec r6
+L207: sub *r5, *r5
+bne *r4
+L208: jmp L178
+L209: not *r5
+L210: stop
+L211: not L493
+rts
+L212: prn #88
+L213: inc *r6
+L214: sub *r7, r0
+L215: rts
+L216: not L581
+L217: jmp L305
+cmp L61, L154
+mov #-9, r5
+L218: cmp #-241, L423
+L219: sub r6, L399
+L220: add r4, r3
+L221: stop
+L222: add #-120, L401
+rts
+not *r4
+L223: .data 255, -701, -434, 94, -488, 559, 285, -69
+L224: prn r6
+L225: bne *r6
+L226: mov #187, r6
+L227: add *r0, *r4
+L228: prn #-61
+L229: add *r7, *r3
+L230: stop
+L231: cmp L134, #197
+L232: inc *r7
+L233: clr L538
+L234: sub #206, L317
+L235: mov #130, L209
+L236: .data -30, -344, -948, 605, -537, -565, 661
+; comment
+L237: rts
+L238: not L172
+L239: jmp L135
+L240: prn #-96
+L241: add r2, *r1
+L242: bne *r4
+L243: .data 777, -679
+lea L55, r4
+dec *r3
+L244: .data 526, 29, -717, 529, -644
+L245: red L131
+L246: dec *r6
+lea L341, *r3
+L247: cmp r0, #-221
+L248: red *r6
+L249: mov r7, L115
+lea L344, r5
+L250: dec *r4
+stop
+rts
+L251: .data 509, 767, 86, -244, -234, -980
+L252: mov r6, r6
+L253: dec r4
+L254: red L66
+L255: inc L462
+L256: jmp *r0
+L257: lea L439, *r7
+rts
+L258: cmp #-91, #238
+lea L540, r1
+jsr L421
+L259: .data 252, 224
+stop
+L260: prn r0
+L261: add *r3, r2
+lea L213, L363
+L262: add #-210, *r2
+L263: .data 967, -733, 109, 188, -766, 723, 947, -381
+L264: bne *r5
+L265: rts
+L266: bne *r0
+mov #20, r2
+sub L337, *r7
+L267: jmp L421
+L268: bne L351
+L269: sub #43, *r0
+sub #-189, L415
+L270: .data 491, 417, -825, -416, -829, -559, -719
+L271: not *r5
+lea L62, L174
+jmp L518
+bne L121
+L272: dec r7
+L273: mov #-91, *r3
+L274: .string "exuuguxs"
+L275: bne *r2
+; comment
+L276: add r4, r5
+L277: not L530
+L278: red *r5
+rts
+prn r0
+L279: rts
+L280: prn r4
+L281: red r5
+L282: bne *r6
+L283: clr r7
+L284: jmp *r5
+L285: not r1
+not *r2
+L286: prn *r0
+L287: bne *r3
+L288: .string "odbiq"
+jsr L573
+jmp L370
+jsr L411
+cmp *r4, L51
+not *r3
+L289: jmp *r0
+L290: bne L335
+L291: add r7, *r4
+bne L135
+L292: bne *r3
+L293: mov #254, L207
+L294: stop
+L295: red *r2
+; comment
+L296: sub L448, r0
+L297: .data 117, 732, 332, -878, -305
+L298: stop
+L299: stop
+L300: rts
+clr L335
+L301: jsr L4
+L302: .string "socgqzq"
+mov r0, *r5
+L303: red *r0
+L304: .data 605
+L305: cmp r0, L348
+L306: clr L330
+stop
+lea L342, r3
+L307: jmp L434
+mov #86, L101
+L308: jmp L341
+L309: jsr L437
+not r7
+inc L20
+L310: jmp L435
+L311: lea L402, L133
+L312: jmp *r0
+dec *r7
+L313: .data -986, 423, 168
+L314: clr r4
+L315: dec r6
+L316: red L186
+L317: cmp r3, *r2
+inc L190
+L318: jsr L490
+L319: stop
+L320: jmp L312
+not r4
+stop
+L321: .string "icvb"
+L322: inc r3
+L323: mov L209, *r1
+red *r6
+add #-237, r1
+L324: not *r3
+; comment
+mov *r5, L323
+rts
+L325: dec r2
+L326: mov L580, L451
+sub L64, *r5
+inc L405
+L327: not r4
+L328: clr L330
+cmp r3, r7
+lea L512, r3
+
+inc *r1
+rts
+inc *r4
+L329: lea L54, L481
+L330: red r0
+jsr *r0
+L331: prn L84
+L332: lea L466, r5
+; comment
+L333: stop
+L334: cmp #192, r4
+L335: dec r1
+L336: jsr L318
+prn L168
+stop
+L337: prn r0
+; comment
+L338: .string "eacueyclynpvwswsfoganst"
+; comment
+L339: add *r2, *r7
+L340: add #32, L354
+; comment
+; comment
+jsr *r4
+add #99, *r7
+jsr L575
+L341: jmp L66
+L342: sub L177, r6
+L343: inc L284
+L344: dec L512
+L345: lea L421, L179
+prn #59
+L346: lea L444, L542
+L347: jsr L408
+L348: prn *r2
+L349: jmp L485
+L350: red *r7
+jmp L333
+L351: .string "eqcjlgheyffohwu"
+rts
+L352: .string "aerlyyntaqolfmxjzzrv"
+; comment
+stop
+L353: clr L124
+L354: bne L164
+sub *r7, L243
+L355: jsr *r5
+L356: cmp *r3, L244
+L357: not L220
+L358: red L258
+add r4, r1
+sub L459, *r3
+L359: clr L62
+jsr L357
+L360: clr L521
+clr *r4
+L361: .data 234
+L362: .data 30, 351, -691, 740, 119, -806, -764
+L363: stop
+L364: dec *r0
+L365: mov L195, r5
+L366: lea L294, L2
+L367: rts
+red r1
+L368: bne L380
+L369: red r0
+L370: prn *r7
+not *r7
+L371: mov *r2, r2
+sub r1, r4
+L372: lea L462, *r6
+; comment
+L373: clr *r7
+L374: red *r0
+L375: dec r6
+L376: red L390
+L377: lea L250, L457
+L378: sub r3, *r7
+lea L390, r2
+L379: not *r4
+L380: sub #32, *r0
+L381: jmp L457
+L382: not r2
+not r3
+L383: clr *r6
+L384: bne L235
+L385: mov #-146, r0
+L386: bne *r1
+not r1
+L387: lea L479, r6
+L388: jmp *r7
+dec r6
+L389: prn #126
+L390: stop
+cmp L393, r4
+L391: cmp *r0, *r1
+L392: stop
+L393: red *r3
+cmp *r0, L510
+; comment
+L394: sub #-204, *r2
+L395: .string "pnmawkqvqx"
+L396: add #-227, r4
+L397: .string "fqz"
+L398: .string "mjbn"
+L399: dec r2
+L400: lea L106, *r2
+; comment
+mov *r3, r5
+L401: lea L428, *r0
+L402: prn *r2
+L403: rts
+L404: stop
+jsr *r6
+not r7
+L405: .string "etzptomudtsznenkrck"
+L406: sub r2, r6
+stop
+L407: dec L416
+lea L590, r4
+L408: sub r3, *r0
+L409: lea L575, L264
+L410: cmp r1, r4
+L411: .data 32, -955
+; comment
+rts
+L412: sub L373, r7
+
+lea L58, r3
+add *r5, *r2
+L413: rts
+L414: mov #-178, L557
+L415: sub #207, *r5
+L416: jmp *r5
+dec r0
+cmp L533, L27
+lea L234, r3
+red r6
+L417: cmp L554, #-210
+L418: stop
+L419: .data -600, 196, -502, 655
+lea L149, L361
+L420: inc *r0
+L421: jsr *r5
+L422: jmp *r7
+L423: dec r5
+; comment
+L424: sub *r4, *r2
+L425: not L76
+prn r7
+L426: jsr L350
+L427: dec L545
+L428: rts
+L429: .string "zsz"
+stop
+L430: bne *r0
+clr *r7
+add r5, *r7
+; comment
+L431: sub #30, *r3
+add *r6, r7
+mov *r7, *r6
+L432: prn #21
+clr L217
+cmp r7, r0
+L433: sub L592, r5
+L434: sub #238, *r2
+dec r4
+not *r1
+L435: inc *r1
+L436: mov *r0, L388
+L437: .data -981
+L438: inc r3
+lea L562, L198
+stop
+L439: lea L499, L340
+L440: sub L234, L195
+L441: stop
+L442: lea L0, L521
+L443: bne L394
+L444: red r6
+L445: rts
+clr L367
+L446: .string "puiztsmplagkfnz"
+L447: dec L456
+lea L423, *r6
+red L472
+L448: clr L84
+L449: clr L16
+; comment
+red r0
+L450: .string "ezydstq"
+sub L530, L537
+
+L451: lea L10, *r5
+L452: .string "rzuoskhleljxk"
+L453: .data -605, 953, -463, 378, 239, -15, -454, -186
+dec r6
+; comment
+red r7
+L454: add #-174, r3
+L455: add #7, L505
+prn r7
+L456: stop
+add #-37, r4
+L457: sub r2, *r3
+L458: sub *r3, L578
+mov #68, L331
+L459: .data 878, -924, -339, -155, -986, -642, -412
+L460: jsr *r1
+L461: inc r3
+cmp *r4, r5
+L462: sub r4, L491
+L463: stop
+rts
+L464: .string "xhngtd"
+stop
+add L507, L449
+L465: mov *r1, L204
+L466: rts
+
+prn *r6
+L467: clr r1
+L468: sub #-238, r6
+L469: .data 919, 454, -562, -217
+L470: cmp *r6, r7
+bne *r5
+L471: mov *r5, r7
+L472: cmp L109, r3
+L473: red *r1
+L474: dec L484
+
+L475: .string "sslzcymivgnm"
+rts
+red r2
+L476: .data 480, -244
+L477: stop
+L478: stop
+L479: .string "kte"
+prn L491
+stop
+L480: jsr L521
+L481: sub r1, r3
+dec L580
+; comment
+L482: .string "rxcjqwbidfyrupfrkeeksv"
+L483: inc r7
+jsr *r0
+L484: prn L81
+dec L506
+L485: .data 326, -176, 382
+L486: mov #-227, r7
+L487: stop
+L488: jmp *r7
+L489: jsr L556
+L490: red r0
+; comment
+L491: lea L160, L427
+L492: jsr *r3
+L493: dec *r3
+L494: .string "kljhfawwtiryj"
+jsr *r3
+L495: .string "bvtvxzlvxsnyyszzbbuiam"
+L496: bne L551
+L497: not L165
+prn #131
+L498: stop
+L499: mov #-160, L561
+sub L591, r7
+L500: rts
+mov *r1, r6
+L501: jmp *r6
+lea L67, *r1
+L502: red L512
+jsr *r3
+L503: jmp *r6
+clr *r5
+cmp #201, *r0
+L504: sub #-228, r5
+L505: cmp L233, r6
+L506: red L594
+; comment
+lea L547, r5
+L507: add L173, r7
+cmp #-5, r6
+L508: jsr *r6
+dec r4
+L509: not r4
+L510: bne L491
+L511: .data 903, 648
+L512: jsr *r0
+L513: lea L571, *r2
+L514: not r2
+L515: red *r7
+L516: prn *r7
+L517: lea L533, r6
+L518: .string "kesbcpjdyq"
+sub #137, r6
+L519: .data 99, -54, -215, 941, 250, 272, -85, -570
+cmp L275, r1
+L520: stop
+L521: .data 475, -333
+; comment
+L522: .string "fbspuhuksccgrksoskbw"
+L523: .data -834, -289, 491, -894, -552, -631, -696, 98
+L524: prn *r0
+L525: bne *r1
+; comment
+L526: bne L253
+L527: .string "bswksoztikucodjyvpo"
+L528: inc r0
+; comment
+L529: .string "zxrlcptdzuumbnb"
+L530: jmp *r5
+red r2
+prn L567
+L531: .string "snaanamjaic"
+L532: add #-159, *r6
+L533: clr r5
+L534: dec L575
+L535: prn L547
+L536: .string "imzhamrjgeihxfsjez"
+L537: rts
+clr *r2
+L538: clr L236
+cmp *r7, r5
+L539: lea L586, L80
+rts
+mov r6, *r5
+lea L571, *r5
+mov L559, *r1
+prn r6
+L540: stop
+L541: cmp *r3, r4
+L542: jmp *r0
+clr r7
+L543: add *r5, *r4
+jmp L512
+L544: cmp #-180, r3
+L545: dec *r0
+cmp r3, L558
+L546: jmp *r3
+mov #-140, *r4
+L547: clr r4
+stop
+L548: cmp #164, L554
+lea L443, *r4
+add #53, *r5
+L549: jsr *r3
+L550: inc r4
+clr r4
+L551: cmp #-145, r7
+inc *r4
+L552: .data -773, 175, -989, -356, -939, -174, -574
+dec *r5
+red r1
+not *r0
+L553: bne L382
+L554: add *r5, *r7
+L555: not *r6
+
+
+L556: red L561
+L557: .data 357, 10
+bne *r6
+L558: clr *r0
+
+L559: cmp *r3, L570
+cmp L473, #231
+
+L560: mov L374, r1
+L561: .data -196, -6, 791, -503, -106, 512, -114, -537
+L562: add L92, r7
+L563: jmp L362
+cmp r5, r3
+L564: sub *r2, *r1
+dec r2
+L565: mov #-3, r6
+cmp r3, r5
+jsr L590
+; comment
+L566: red L79
+L567: inc r3
+; comment
+not L512
+L568: dec L572
+red L590
+L569: .string "udutltnrfscniyat"
+not L573
+L570: jsr L589
+L571: red *r1
+prn L369
+mov r0, L84
+L572: .data 861, 150
+mov r2, *r1
+
+add #210, *r7
+L573: stop
+L574: .string "jmevbhio"
+red *r0
+stop
+sub *r7, r1
+L575: prn *r3
+L576: .data -203, -263, -311, -77, -112
+not *r4
+inc *r7
+
+prn r6
+L577: rts
+L578: rts
+L579: jsr L396
+cmp *r0, #45
+not L145
+not L585
+L580: inc L65
+L581: rts
+; comment
+L582: lea L587, r4
+L583: rts
+jmp *r6
+
+L584: cmp L595, r0
+L585: .string "uwrtibdmysycghphrwc"
+L586: red L412
+L587: prn *r4
+L588: .string "xrlzclhla"
+lea L593, r2
+L589: sub L143, r6
+L590: inc r3
+bne L191
+L591: inc r3
+L592: jsr L594
+bne L335
+L593: red r2
+mov *r7, L417
+sub L353, L594
+L594: cmp *r5, #-87
+L595: .data 480, -788
+mov r5, r0
+red *r6
+stop
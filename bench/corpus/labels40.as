@@ -0,0 +1,1041 @@
+; Generated by genCorpus --seed 41
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+stop
+L0: lea L357, L247
+not r7
+inc *r0
+L1: mov #-107, *r0
+L2: clr L260
+L3: jsr *r0
+jsr *r1
+L4: .string "svxdauxibqfmmkiizwhmqwln"
+L5: .data 422, -790, 86, -869, 421, -916, 968, 381
+sub r4, L109
+jsr *r6
+L6: stop
+L7: lea L373, r5
+rts
+prn r6
+not *r7
+L8: clr *r0
+
+L9: bne *r7
+L10: .data -943, 58
+L11: jsr *r5
+L12: jmp *r4
+L13: bne L171
+clr r4
+L14: add #1, *r5
+not L552
+
+; comment
+dec r6
+L15: jmp L498
+bne *r6
+stop
+L16: not L1
+L17: inc r1
+L18: .string "sjldlnmvhuyhzmxlmk"
+L19: sub L424, L416
+jsr *r4
+add r1, r4
+L20: inc L371
+L21: dec L48
+L22: clr L22
+L23: dec r7
+L24: jsr L20
+inc L90
+L25: dec L511
+L26: cmp r5, #-203
+L27: rts
+L28: prn r7
+L29: jmp *r3
+L30: prn #134
+L31: cmp r3, #-10
+L32: dec L28
+L33: sub #2, r0
+L34: bne L430
+L35: inc *r4
+add *r7, L35
+L36: dec r6
+L37: bne *r5
+L38: sub *r7, *r5
+L39: jmp L198
+L40: clr *r2
+rts
+dec *r6
+L41: red L13
+L42: jmp L45
+L43: clr r2
+rts
+L44: prn L474
+L45: clr r2
+inc r6
+L46: mov #85, *r4
+L47: lea L556, L261
+clr L181
+cmp *r5, *r2
+L48: red r4
+L49: inc *r4
+L50: prn r2
+L51: cmp #-164, L405
+L52: jsr L524
+jmp *r3
+mov L3, *r5
+red *r2
+inc r1
+L53: .string "aj"
+L54: bne *r7
+L55: stop
+L56: mov r2, r1
+L57: mov #154, L49
+L58: not r7
+L59: lea L71, r2
+L60: jsr *r4
+stop
+bne L33
+jsr L11
+
+add L30, L31
+
+sub *r0, r0
+L61: bne *r2
+mov r0, r1
+jmp L307
+L62: .string "vpkmvjlbmnnenvobetsxfbu"
+add r5, *r5
+jmp L24
+L63: .data 28, 20, 259, -893
+add L20, L0
+jsr L24
+bne L543
+jmp *r7
+L64: clr r5
+L65: dec r4
+L66: clr r1
+L67: dec L344
+L68: sub L49, r1
+mov L53, L62
+L69: .data -578, -318, 258, 439, -17, 776, -209, -257
+L70: rts
+L71: add L323, r7
+L72: inc L136
+jmp *r6
+red *r2
+inc r3
+L73: cmp L65, #193
+L74: not r4
+L75: .string "qbk"
+red r0
+L76: .data 345, -351, -381, 612, -742
+L77: jsr *r1
+inc r7
+L78: dec r3
+sub L2, *r2
+L79: dec r1
+L80: jmp *r0
+L81: jmp L75
+clr L591
+mov #0, *r4
+L82: lea L543, L512
+L83: inc *r3
+cmp *r4, *r1
+L84: .string "vxka"
+L85: prn L80
+L86: lea L268, *r5
+L87: rts
+inc *r0
+L88: dec r0
+jmp L300
+L89: jmp *r4
+mov #-61, r3
+L90: .string "ut"
+L91: prn L89
+L92: clr *r6
+stop
+; comment
+jsr L388
+
+L93: .data -209
+L94: jsr L336
+L95: add L2, L15
+L96: jsr L2
+L97: red *r1
+stop
+rts
+not *r6
+L98: sub L210, L59
+L99: jsr L517
+L100: clr L120
+add L76, r0
+L101: dec r1
+L102: stop
+L103: sub *r1, L75
+L104: red *r6
+L105: dec r3
+prn *r1
+L106: jsr *r6
+not L89
+L107: inc r7
+lea L36, *r3
+L108: inc r3
+mov #183, L90
+L109: stop
+L110: add L24, *r4
+dec *r6
+L111: jmp L319
+L112: bne *r7
+L113: dec *r4
+L114: mov #192, r1
+L115: not r2
+L116: clr r6
+jsr *r4
+L117: .string "wnsqwhlrurnqybkpz"
+L118: prn #220
+sub #-33, *r6
+L119: clr r1
+lea L235, L53
+jsr L14
+; comment
+stop
+L120: dec r3
+jmp L114
+lea L295, L498
+L121: clr *r7
+L122: .string "iqakhtcre"
+L123: sub r3, *r3
+L124: lea L344, r3
+L125: red r6
+L126: .data 380, 380, -670
+lea L598, r2
+L127: rts
+L128: add *r0, L57
+L129: .string "ntv"
+L130: add r5, L526
+stop
+L131: stop
+L132: jsr *r3
+L133: .string "bhgdyvaaqaulrvvmibtyz"
+L134: red r5
+L135: red r3
+L136: .string "ticgihi"
+add #-18, L26
+L137: .string "uxrscuvbljrferendfjonpz"
+jsr *r4
+L138: stop
+L139: lea L54, L119
+L140: jsr L315
+L141: stop
+L142: jsr *r6
+sub r1, *r1
+L143: red L602
+L144: mov #-24, r1
+add *r0, L329
+lea L144, *r0
+L145: jsr *r6
+L146: cmp #193, *r6
+prn L46
+jsr L43
+clr r2
+jmp *r6
+add #63, *r3
+sub #-135, L605
+L147: stop
+L148: lea L83, r1
+clr L29
+red L549
+L149: mov r4, L402
+L150: mov #-143, r0
+L151: not *r1
+L152: .data 476, 423, -402, 444, -532
+L153: jsr L135
+red *r7
+L154: clr *r6
+L155: stop
+L156: dec L107
+L157: inc L68
+L158: inc r6
+L159: sub r1, *r5
+not L187
+L160: clr *r0
+bne L338
+clr *r3
+L161: cmp *r6, #35
+bne L223
+mov L241, L59
+jsr L424
+jsr *r6
+L162: lea L118, r7
+L163: cmp *r0, *r0
+L164: jsr L445
+stop
+L165: add r4, L69
+L166: .string "qp"
+cmp L559, r2
+rts
+rts
+L167: jsr L290
+jmp L578
+L168: clr *r0
+L169: inc *r1
+
+L170: .data 338
+not *r2
+L171: .string "auxir"
+not L568
+; comment
+jsr L211
+L172: cmp L390, #26
+L173: rts
+red *r7
+sub r4, L187
+L174: mov *r5, r2
+L175: .data 498, -139, -836
+L176: red r6
+jsr *r5
+L177: rts
+jmp *r3
+not L393
+L178: sub L242, L546
+L179: .string "frl"
+L180: .data 184, -679
+L181: inc L546
+L182: clr *r7
+L183: mov r6, *r3
+L184: .string "putaop"
+jsr L190
+lea L127, *r2
+jmp L28
+red L174
+red L240
+L185: mov L202, r5
+L186: bne *r0
+L187: .string "q"
+L188: dec *r4
+L189: rts
+sub r3, r3
+sub *r3, r6
+L190: add r0, r7
+L191: sub L243, *r3
+L192: mov #184, r5
+L193: add *r0, *r7
+
+L194: dec r6
+L195: clr r6
+L196: sub *r7, r7
+lea L509, r5
+L197: dec L591
+L198: inc *r3
+clr r3
+L199: jsr *r4
+L200: sub r5, *r7
+L201: red L99
+L202: stop
+not *r1
+jmp *r6
+L203: .string "quwautst"
+L204: jmp *r6
+add *r4, L297
+jsr L287
+L205: cmp r0, r5
+L206: rts
+red r0
+L207: stop
+L208: jmp L391
+stop
+L209: .string "wmimvupfgz"
+L210: cmp *r5, r4
+L211: jsr L418
+clr L325
+clr *r4
+L212: dec r2
+
+red *r6
+L213: prn r1
+lea L554, L519
+inc L2
+L214: clr *r7
+L215: lea L415, *r3
+L216: rts
+L217: dec r4
+lea L204, r6
+lea L136, L554
+L218: lea L323, *r3
+L219: dec L45
+L220: lea L50, r4
+L221: dec L23
+L222: not *r0
+stop
+prn #49
+L223: .data -467
+L224: .data -436, -328, -747, 353, 739, 492
+inc r1
+L225: .string "weuuevispyk"
+L226: stop
+L227: rts
+L228: not L529
+prn *r2
+L229: not *r1
+L230: .data 28, 364, 89, 276, 46
+L231: .string "eosqqnfefqlbvidk"
+L232: prn #-21
+sub L8, *r7
+bne L521
+L233: jmp L96
+L234: red *r0
+rts
+L235: jmp L46
+L236: rts
+L237: .data 582, -297, 872, 990, 73, 233, 800
+L238: stop
+L239: jmp L98
+L240: rts
+L241: red L1
+L242: stop
+not L405
+L243: cmp L194, L591
+red r2
+rts
+sub r5, r4
+rts
+L244: not L34
+L245: .data -270, 195, -225
+sub *r0, *r3
+red L231
+dec L197
+L246: .data 225, 618, 521, -333, 523, 978, 264, -644
+L247: mov *r3, r6
+clr *r0
+L248: sub r5, *r2
+L249: .string "ejuegisytcjxdjtui"
+L250: rts
+prn L463
+jsr *r4
+red r0
+L251: stop
+L252: jsr L31
+L253: prn r7
+dec *r5
+L254: prn L108
+L255: .data -139, -260, -997
+L256: lea L377, *r3
+L257: red r6
+L258: cmp L110, *r4
+L259: .data -940
+L260: prn #-155
+jsr *r0
+red *r3
+; comment
+dec *r1
+L261: .data 340, 405, 800
+L262: .data 321, -101, -380, -266, -846, 219
+L263: cmp r6, r1
+red r6
+L264: sub r3, L589
+red r1
+L265: add *r5, L224
+L266: lea L47, *r4
+L267: stop
+L268: stop
+L269: bne *r4
+L270: cmp #-25, *r7
+red *r6
+L271: inc *r5
+L272: stop
+L273: rts
+jsr *r7
+stop
+not *r7
+L274: cmp L83, r3
+L275: mov L97, r6
+red r3
+L276: mov *r5, r3
+L277: add r1, L78
+; comment
+L278: .string "thvckcnqtnshaanojnnfhyi"
+L279: not r7
+bne *r5
+L280: jsr L262
+L281: .data 743, 680, 724, -315, 509, -49, 944, 36
+; comment
+clr r0
+L282: sub *r1, r6
+sub r7, *r2
+L283: sub r0, *r0
+L284: inc r4
+L285: sub *r0, *r0
+rts
+L286: mov r6, L510
+jmp *r1
+not *r3
+L287: jsr *r6
+L288: jmp *r4
+L289: lea L425, *r2
+prn #-84
+L290: .string "kdwjfbrefgdkufdpu"
+L291: add L138, L418
+L292: stop
+sub L162, *r7
+rts
+L293: prn #213
+L294: .string "wayez"
+jmp *r3
+L295: stop
+lea L154, L80
+L296: mov *r5, L302
+jmp L221
+prn L493
+add *r2, r5
+inc r6
+L297: red r7
+not L80
+L298: stop
+cmp r3, #-30
+lea L102, r4
+inc L261
+L299: add *r6, L480
+L300: prn *r0
+L301: inc r3
+sub L223, r5
+rts
+L302: dec L612
+add L383, *r0
+L303: red L200
+L304: inc r6
+lea L137, r6
+L305: .string "moszuzpqua"
+L306: rts
+bne *r4
+L307: .string "efjbnafjsgmahnpdjp"
+L308: .string "qyzkwqhlrywhgbdxpexzap"
+jmp L285
+L309: bne *r3
+L310: inc r5
+; comment
+sub L52, L165
+L311: add #-219, r5
+L312: clr L335
+L313: not r0
+L314: dec L228
+L315: stop
+lea L170, L323
+L316: prn L250
+L317: prn r1
+red *r3
+L318: dec L241
+L319: jmp L520
+L320: sub L319, *r0
+L321: sub r4, L548
+jmp *r2
+L322: red r2
+L323: cmp r7, *r0
+L324: inc r0
+L325: jmp L378
+L326: bne L514
+L327: jsr L141
+mov r5, L302
+add r5, r7
+L328: cmp L220, L432
+L329: clr *r7
+L330: .string "ysg"
+L331: not *r2
+L332: mov *r3, r6
+L333: inc r0
+L334: stop
+L335: rts
+L336: .data 460, -55
+L337: bne L556
+jmp L299
+rts
+jsr L9
+L338: add L40, r4
+jsr *r5
+L339: lea L165, *r0
+stop
+L340: add *r4, *r0
+sub r1, L566
+; comment
+L341: mov r2, *r0
+L342: jsr *r7
+L343: red *r4
+L344: sub #-218, r4
+bne L377
+add *r3, L287
+L345: inc r4
+L346: rts
+L347: clr L304
+
+inc *r3
+L348: lea L326, L123
+L349: mov *r7, *r5
+bne *r5
+L350: jsr L465
+L351: .string "hghvrvruvuwxnkoywcuvxrfy"
+L352: clr r6
+mov #-6, *r1
+jmp L441
+sub *r5, r4
+inc r6
+add r2, r2
+L353: jsr *r7
+L354: jmp L513
+L355: .string "shbwnc"
+lea L421, L311
+L356: jsr L561
+L357: inc *r1
+L358: mov #-231, *r7
+mov #154, L599
+L359: jmp *r4
+not L75
+L360: red *r5
+L361: jmp *r0
+L362: add L484, r1
+L363: inc L282
+add r6, *r6
+mov #15, *r2
+L364: prn r6
+L365: jsr *r2
+L366: lea L394, *r3
+
+L367: prn #171
+; comment
+L368: rts
+L369: .data -41, -496, -316, 874
+dec L423
+cmp #-89, *r0
+L370: .string "ojiglnehhdhwrcejisdq"
+add L116, r4
+L371: not r7
+stop
+L372: rts
+L373: not *r6
+cmp r3, *r1
+L374: add r1, *r6
+clr L95
+jmp *r5
+L375: red r7
+mov #64, L596
+mov #-253, r7
+
+add *r4, L384
+L376: jsr L380
+L377: sub #-143, r5
+jmp L542
+rts
+L378: sub *r3, *r0
+L379: red r1
+
+rts
+cmp #-63, #207
+L380: bne L452
+lea L1, L407
+L381: jmp L226
+jsr L587
+L382: clr *r3
+L383: rts
+mov L259, *r2
+L384: jsr L369
+sub r0, L143
+L385: sub L27, *r0
+L386: .string "pgodbtvsrzvery"
+lea L73, *r6
+rts
+; comment
+; comment
+L387: .data 831, 694, -222, -215
+not *r6
+L388: lea L139, L222
+L389: stop
+not L469
+not L536
+L390: prn r3
+L391: dec L282
+jsr *r3
+L392: .string "totgu"
+sub r1, r1
+L393: jmp *r1
+L394: rts
+
+cmp L299, *r5
+
+not *r2
+add *r6, L544
+L395: .string "uyknuulmxtxinpoqbz"
+L396: not L607
+L397: rts
+not *r7
+L398: stop
+L399: .string "cdthgn"
+L400: not *r4
+clr *r0
+clr L179
+L401: jsr L502
+jsr L380
+L402: not L27
+lea L7, *r3
+mov L536, L363
+L403: bne *r5
+L404: bne *r6
+L405: .data 13, 820, -124, 995, -975
+L406: stop
+lea L529, *r0
+rts
+L407: jmp L408
+L408: jsr L578
+L409: red *r2
+inc L73
+L410: inc *r5
+not L521
+L411: dec *r2
+L412: jmp *r4
+L413: .string "zhjosxaeuxp"
+rts
+L414: lea L594, L542
+L415: add L382, r2
+add *r2, *r1
+L416: red L164
+inc r3
+L417: cmp L476, L248
+clr *r5
+L418: .string "hyrxjdxneqxdiistpvaydil"
+not L489
+stop
+L419: not L284
+L420: clr L595
+add r3, r7
+clr *r2
+L421: sub r5, *r0
+rts
+L422: sub r3, *r2
+L423: rts
+L424: .data 459, 63, -205, 354
+L425: not L601
+jsr L210
+jsr L38
+bne *r3
+dec L150
+L426: .data 210, -322, -31
+L427: add r5, L329
+L428: lea L391, L52
+L429: cmp *r5, #10
+sub L476, r2
+not r4
+L430: lea L11, L446
+L431: mov r4, *r0
+L432: cmp *r7, *r3
+sub #69, *r5
+L433: mov L556, L393
+jsr L596
+L434: prn *r4
+L435: stop
+inc r3
+L436: inc r5
+L437: add *r1, *r4
+L438: inc r0
+clr r6
+L439: jmp *r6
+L440: stop
+bne *r5
+L441: jmp L556
+L442: rts
+L443: stop
+
+L444: sub r5, L195
+L445: stop
+L446: sub #-212, *r6
+jmp *r6
+L447: inc L458
+L448: mov r3, L65
+L449: cmp r7, #86
+L450: .string "o"
+L451: inc L477
+L452: jsr L455
+not L60
+inc *r1
+L453: clr r5
+stop
+L454: dec r2
+L455: prn L529
+L456: .data -7, -560
+L457: .data 590, -415, -901, 573
+L458: .string "iwbdskyguiitmuydf"
+; comment
+L459: jsr L482
+clr *r0
+L460: cmp L591, L295
+L461: jsr L120
+sub *r2, L320
+L462: lea L551, r2
+cmp *r3, #-116
+L463: add #51, L470
+L464: bne L527
+L465: jmp L507
+L466: not L15
+inc *r0
+L467: dec L537
+L468: lea L565, *r7
+L469: cmp *r7, L202
+clr r5
+red r3
+L470: sub L99, L365
+L471: .data -490, 594, 998
+L472: jmp *r7
+L473: stop
+L474: red r5
+jsr L527
+L475: stop
+L476: inc r5
+L477: add *r2, L162
+L478: clr *r4
+L479: .data 810, -485, -305, 523
+L480: lea L351, r2
+jmp *r1
+
+L481: .string "dnvjytrcpgzr"
+red L111
+L482: .string "dpn"
+L483: lea L126, L528
+stop
+L484: .data 945, -33, -803, 988, -516
+bne L8
+L485: sub r0, L577
+L486: stop
+L487: rts
+L488: .string "obgvd"
+L489: jsr *r7
+red L176
+L490: clr r2
+L491: clr r2
+L492: dec L530
+L493: red *r5
+L494: sub L528, *r3
+L495: rts
+L496: .string "qqc"
+L497: inc r2
+L498: red *r7
+red L507
+L499: stop
+L500: .string "hgsbatv"
+L501: cmp r7, L157
+L502: stop
+L503: jsr *r3
+L504: .string "qbivbzwlup"
+sub L285, *r4
+lea L552, L100
+L505: red L602
+L506: add #189, L536
+L507: jsr L526
+rts
+cmp L69, *r4
+L508: sub #237, r5
+lea L597, *r3
+L509: .data 548
+dec *r1
+jsr L595
+L510: red *r3
+L511: red L509
+L512: clr *r3
+mov *r6, *r2
+jsr *r2
+stop
+L513: rts
+L514: cmp *r1, #60
+L515: red L367
+L516: jsr L551
+L517: lea L537, r6
+L518: stop
+L519: not *r2
+L520: rts
+L521: sub *r3, L462
+jmp L572
+prn #-121
+L522: jsr L90
+L523: .data -983
+L524: red *r3
+add r3, *r2
+; comment
+L525: jmp L593
+L526: .data -385, 395, 649, 88, 19, -975, -570, -993
+L527: clr *r4
+prn r2
+L528: .data -548, 593, 441
+
+red *r7
+L529: mov #229, *r3
+bne *r7
+sub L574, L564
+L530: inc r1
+L531: red *r3
+L532: mov r0, r5
+L533: cmp #178, #-108
+L534: cmp *r5, r4
+lea L605, *r2
+L535: prn r3
+L536: mov L64, r6
+L537: not *r6
+L538: jmp L201
+jmp L385
+mov r3, *r4
+; comment
+L539: rts
+L540: rts
+jsr *r3
+L541: clr r7
+L542: not r6
+L543: jsr L296
+L544: clr *r0
+L545: add r6, *r5
+L546: stop
+jmp *r6
+bne *r5
+L547: mov #-154, r2
+L548: .string "fhwp"
+bne *r0
+inc r4
+L549: rts
+L550: sub #53, r0
+sub *r1, r2
+L551: .string "ur"
+L552: prn *r3
+clr L465
+L553: inc L100
+clr *r0
+L554: .string "hiyajwebhtqwqvozfgtz"
+jmp *r4
+not *r6
+cmp *r0, r6
+L555: .data 417, -699, 734, 97, 551, 226, -787, -213
+jsr L281
+L556: mov *r5, L126
+L557: stop
+bne *r3
+L558: cmp r0, r7
+L559: bne L593
+L560: stop
+not *r4
+L561: rts
+L562: jmp *r4
+L563: .string "uaykzqkspfyqcegx"
+L564: cmp r5, L355
+bne L589
+L565: red L372
+jmp *r5
+L566: add #242, r4
+L567: mov r0, r6
+L568: .data -637, 461, -88, -792, 587, -268, 903, -144
+add #-229, *r3
+lea L590, r3
+L569: clr L4
+L570: .data -653, 98, -82, 531, -2, -583, -583
+stop
+stop
+L571: .data 303, -71
+L572: mov *r2, r5
+L573: rts
+L574: clr r5
+not *r4
+L575: rts
+L576: sub #74, r4
+mov r2, *r3
+L577: add #-140, r6
+jsr *r7
+L578: prn *r6
+L579: jmp L601
+stop
+not *r1
+; comment
+; comment
+L580: not *r1
+bne L591
+L581: jsr L593
+L582: jsr *r6
+L583: inc *r6
+red L194
+L584: clr *r7
+mov #-79, r5
+L585: jsr *r7
+L586: clr L588
+L587: sub #-55, *r1
+L588: jsr L369
+L589: cmp #-65, r6
+L590: inc r3
+stop
+L591: prn L592
+dec *r2
+L592: inc r1
+mov #170, L610
+L593: bne L612
+L594: inc *r2
+not r1
+L595: inc L535
+dec L601
+; comment
+L596: not L603
+add *r2, r2
+L597: red L54
+jmp L608
+L598: not L75
+clr *r7
+L599: inc *r7
+rts
+L600: red *r7
+L601: dec L323
+L602: .string "jxhlbgs"
+L603: not L604
+L604: clr L611
+L605: sub *r7, r2
+cmp L607, *r3
+mov L611, r2
+dec *r3
+mov r3, r7
+add L610, L510
+L606: clr *r2
+L607: prn *r1
+jmp *r6
+bne L481
+L608: .string "hjtbaviaetoez"
+L609: inc r6
+L610: red *r4
+
+L611: jsr L10
+L612: sub *r0, r3
+red *r6
+stop
@@ -0,0 +1,1040 @@
+; Generated by genCorpus --seed 42
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+L0: not L404
+L1: stop
+dec L0
+L2: sub #-8, L14
+L3: rts
+; comment
+L4: dec *r0
+L5: jsr *r6
+not L5
+lea L5, r0
+inc r5
+stop
+L6: dec r1
+not L403
+L7: .string "exlqvjv"
+L8: .data -927
+rts
+L9: sub *r4, r6
+prn #186
+stop
+L10: jmp L601
+L11: .data 216
+L12: inc r6
+mov r4, *r3
+dec *r2
+L13: mov *r4, *r4
+L14: inc r4
+L15: add r4, r5
+L16: .data -460, 912, -525, -557, -456, -50, 25, 315
+L17: bne L187
+L18: .string "umzalvzcetwgftih"
+L19: jmp L3
+L20: dec r0
+; comment
+L21: prn L310
+L22: cmp r5, L248
+L23: jsr L536
+L24: mov L329, *r2
+lea L248, L7
+L25: stop
+L26: cmp #-80, *r6
+L27: lea L97, *r1
+L28: jsr *r5
+prn r5
+L29: .string "tutjz"
+L30: stop
+dec L447
+lea L307, r1
+L31: red L226
+cmp *r2, *r0
+cmp r7, L12
+red L13
+L32: .string "jk"
+sub L439, *r1
+L33: bne L31
+L34: sub *r3, L445
+L35: .data -575, -273, 524, 382, 888
+L36: mov *r2, L212
+L37: not L15
+L38: .string "anwp"
+L39: stop
+L40: sub L227, *r7
+L41: red L6
+jmp *r2
+L42: jmp *r0
+L43: lea L25, L1
+L44: bne L19
+L45: dec r2
+red L64
+sub #-12, L19
+prn r2
+jmp L381
+L46: clr *r5
+L47: clr L10
+; comment
+L48: stop
+L49: jmp *r2
+
+stop
+inc r5
+L50: jsr *r2
+L51: bne *r1
+L52: red L107
+L53: not *r5
+sub r2, r1
+L54: .string "vmmnrjhnlyvskb"
+clr L11
+lea L7, *r7
+prn r3
+L55: .string "xqeiugkzbhgumnqwtdlhuvl"
+L56: .string "gjlsseikymsqwaovbu"
+dec *r2
+lea L20, r6
+jmp L17
+L57: bne *r1
+L58: .data 647, 495, 513, 177, -635, -139, 402
+inc L50
+L59: sub L91, L38
+L60: lea L15, *r0
+L61: prn L61
+L62: clr L262
+red r0
+L63: .data -77, 125, -484, 726, 854, -385
+L64: inc r7
+L65: dec L272
+L66: jmp L172
+L67: jmp *r1
+stop
+mov *r3, L479
+sub L12, L234
+L68: not r3
+mov r6, L421
+L69: .data 932, -361, -156, 812, -744, 531, -895
+lea L57, *r3
+L70: prn #196
+L71: bne *r3
+L72: red L28
+mov L537, *r1
+stop
+L73: clr *r3
+prn #-188
+prn r4
+clr *r6
+
+L74: stop
+
+L75: dec *r2
+red r7
+L76: sub L58, L53
+L77: jmp *r2
+clr *r0
+L78: dec r4
+rts
+rts
+mov #-81, *r3
+mov *r5, L33
+L79: .string "thluciovksvqngkwmr"
+L80: jmp L332
+L81: lea L235, r7
+L82: bne *r5
+L83: bne L155
+L84: cmp *r6, #179
+L85: .data 902, 340, 441
+add L31, r0
+cmp r5, #-105
+L86: jmp L14
+L87: jmp *r1
+stop
+L88: prn *r5
+L89: dec r2
+L90: jmp *r7
+L91: jmp L39
+lea L4, r4
+L92: add *r3, r6
+L93: lea L375, L33
+L94: dec *r4
+L95: stop
+; comment
+L96: .string "tvolrhmzqraki"
+L97: bne *r0
+not *r5
+L98: cmp r5, *r0
+L99: .data -990
+L100: dec L567
+cmp r0, r1
+L101: not r4
+jsr L215
+L102: not r3
+L103: inc r7
+L104: .string "atrjvmylhmbrx"
+L105: inc *r2
+L106: rts
+sub r5, L458
+bne L590
+L107: rts
+L108: jsr L58
+rts
+L109: bne L336
+mov L178, *r1
+add L565, *r5
+L110: cmp L15, r7
+L111: not *r0
+L112: prn L539
+stop
+L113: mov #-53, L75
+L114: clr L520
+stop
+L115: cmp #61, r4
+L116: not *r4
+jsr *r2
+L117: inc r4
+dec L11
+L118: bne L162
+L119: .string "ka"
+stop
+rts
+L120: prn r1
+L121: rts
+L122: mov L67, L329
+jsr L71
+L123: .data 750
+L124: inc r0
+L125: prn #-68
+
+L126: jmp L96
+L127: red L526
+
+L128: rts
+L129: .string "gghwczov"
+stop
+L130: jmp *r1
+L131: red *r2
+L132: jmp *r4
+L133: inc L117
+L134: stop
+L135: lea L558, L101
+L136: cmp r4, r0
+L137: jmp *r1
+L138: stop
+L139: not *r2
+add r2, L84
+inc r2
+L140: .data 44, -468, 46, 920, 458, 489, -321, 320
+L141: lea L276, L109
+L142: inc L22
+L143: clr L209
+L144: clr L584
+bne *r2
+sub #-58, *r6
+L145: inc L37
+L146: not *r6
+lea L109, r3
+dec *r3
+L147: prn r0
+sub #192, *r1
+not L37
+L148: add *r5, L17
+L149: mov L89, *r1
+red *r6
+L150: rts
+L151: add *r4, *r4
+L152: cmp *r2, L88
+; comment
+L153: jsr *r6
+L154: jmp *r3
+L155: not r6
+rts
+L156: bne L145
+clr *r5
+L157: prn *r0
+L158: stop
+L159: .string "srzbirqaprqga"
+dec r5
+L160: jsr L251
+prn *r6
+L161: red r5
+L162: lea L135, r7
+rts
+L163: stop
+L164: sub *r6, L250
+L165: rts
+L166: jsr *r3
+add #197, *r5
+L167: .string "lu"
+cmp *r6, r4
+L168: jmp *r5
+L169: prn r3
+prn *r1
+L170: bne *r3
+L171: red r6
+L172: jsr L413
+add #-139, r0
+L173: bne L94
+L174: rts
+bne *r7
+L175: lea L63, *r1
+lea L1, L163
+; comment
+L176: red L374
+L177: jsr L173
+L178: jmp L11
+mov #-19, L38
+L179: red r6
+L180: cmp *r2, *r4
+jmp *r7
+L181: cmp L133, r1
+L182: prn L246
+L183: clr L555
+L184: .string "bfzp"
+L185: inc L272
+L186: mov r1, L327
+jsr *r3
+L187: mov *r5, L49
+L188: dec L12
+L189: .data 461
+L190: add L287, L83
+sub r6, *r3
+L191: rts
+
+L192: stop
+; comment
+L193: stop
+L194: prn #-8
+L195: .string "wiulahaynggrebb"
+L196: bne *r7
+bne L25
+; comment
+add #-80, L63
+sub #-43, r5
+lea L139, *r6
+L197: prn #94
+L198: .string "uetbkg"
+bne *r1
+L199: .data 864
+L200: dec L500
+mov L205, L282
+L201: lea L338, L120
+L202: prn r0
+L203: .data -579, -883, 737, 645
+L204: .string "nezzqtgdn"
+L205: jsr L165
+L206: sub r3, *r1
+sub L127, *r6
+L207: inc L340
+L208: clr L170
+jsr L443
+clr r5
+not *r3
+L209: .string "edvzzcdexwakrsgesrpnbi"
+L210: .string "weg"
+cmp L250, #-85
+L211: dec *r1
+clr r4
+prn #238
+L212: bne *r7
+mov r7, L284
+L213: lea L599, L600
+L214: not r4
+L215: inc L176
+; comment
+add #-3, r0
+L216: jsr L209
+L217: prn *r6
+dec r2
+jsr *r0
+inc r0
+L218: jsr *r0
+prn L189
+L219: not r5
+L220: lea L175, *r6
+jmp L104
+L221: clr r2
+L222: sub #81, *r6
+dec L86
+L223: add #-237, *r1
+L224: dec r4
+sub #-77, L344
+L225: not L126
+L226: not *r6
+
+jsr L142
+L227: sub #86, L62
+L228: inc *r4
+L229: .data -960
+L230: .string "cojohjshylwz"
+L231: sub r5, r7
+L232: cmp *r0, *r0
+add #-256, L108
+dec L414
+add L442, L472
+L233: prn r5
+L234: jsr L485
+L235: jsr *r0
+L236: dec *r1
+not *r6
+L237: cmp L169, #214
+L238: jsr L556
+; comment
+L239: lea L267, *r6
+L240: clr r2
+L241: not *r5
+dec *r7
+; comment
+; comment
+dec *r6
+L242: jsr L127
+add r4, *r0
+; comment
+not L215
+L243: rts
+cmp #-66, r3
+jmp L0
+L244: not r3
+rts
+jsr *r3
+L245: dec *r1
+L246: jsr L147
+L247: jsr L503
+L248: clr *r2
+add r7, r4
+prn *r0
+clr r3
+lea L123, L262
+red *r1
+L249: not r6
+L250: .data 246, -445
+dec *r5
+L251: add *r3, r6
+L252: inc L73
+jsr *r6
+
+L253: cmp r5, L166
+L254: red L178
+
+
+L255: stop
+mov #-165, *r1
+
+inc *r5
+L256: mov r0, *r2
+L257: dec L214
+rts
+inc L278
+L258: inc *r1
+inc *r6
+add L341, r0
+L259: rts
+L260: .string "hbodnrbnd"
+L261: red *r5
+prn L106
+L262: cmp r6, r4
+L263: red L372
+inc r6
+L264: .string "rrfhsuxvrjkgh"
+add r0, *r3
+L265: jmp L145
+L266: clr L489
+prn L77
+L267: .string "fbronmchxzyuiotsnkftkkg"
+L268: clr L313
+L269: mov #207, *r7
+jmp *r7
+L270: cmp r6, *r5
+; comment
+stop
+L271: dec L398
+L272: prn r0
+L273: rts
+L274: mov r4, *r0
+L275: dec L144
+L276: lea L589, L481
+bne *r3
+L277: .string "huf"
+L278: .data 494, -316, -591, -369, 225, 672, -877
+L279: jmp L19
+L280: .data -698, 318, 300, -550
+stop
+jsr L200
+L281: prn *r1
+L282: lea L386, *r4
+L283: jsr *r3
+L284: jmp *r7
+L285: prn *r0
+cmp *r0, r0
+bne *r6
+L286: sub r2, L78
+L287: prn *r3
+L288: clr r0
+
+L289: bne *r3
+; comment
+lea L33, r6
+L290: not L169
+sub L559, L344
+L291: rts
+L292: .data -977, 790, 707, 300, -371
+L293: jmp *r7
+L294: add #55, r3
+L295: inc *r0
+L296: stop
+add r4, r4
+L297: clr *r7
+L298: lea L368, L16
+L299: jsr L585
+L300: rts
+L301: red *r4
+lea L10, *r1
+L302: jsr *r1
+L303: not L98
+clr L175
+L304: not r2
+L305: sub r5, r5
+L306: .data -421, -536, -167
+L307: sub *r1, L257
+L308: red L249
+L309: clr L15
+inc L212
+red L414
+L310: inc *r4
+L311: mov *r4, r0
+add #50, *r4
+L312: mov #-253, *r5
+L313: clr L154
+L314: .data 140, -63
+L315: add *r5, r6
+L316: red *r4
+L317: jsr *r2
+sub L174, L287
+L318: cmp L88, L528
+bne L417
+mov #-172, *r3
+L319: rts
+L320: lea L187, *r5
+; comment
+L321: dec L120
+L322: lea L142, L531
+L323: clr *r2
+L324: sub *r1, L42
+inc *r2
+L325: not r4
+L326: rts
+L327: prn r1
+red L455
+sub L566, r2
+sub #-153, r7
+L328: jsr L279
+L329: mov r7, *r5
+L330: not L529
+L331: inc r1
+mov *r5, *r6
+red *r4
+clr L597
+L332: mov r2, *r3
+L333: not L546
+L334: inc *r1
+L335: stop
+L336: mov r5, L500
+L337: .string "svtfinaj"
+bne *r2
+jsr *r2
+L338: stop
+L339: mov L453, r0
+jsr *r6
+L340: red L143
+jsr L532
+L341: cmp *r2, *r3
+; comment
+L342: rts
+stop
+L343: cmp L418, L229
+L344: jmp *r1
+L345: inc L377
+L346: sub r6, *r4
+L347: sub #54, L589
+inc *r6
+stop
+L348: .string "lgkmfsvew"
+L349: jmp L583
+L350: .data -676, -886, 81, 546
+L351: inc L443
+L352: jmp *r1
+L353: clr r4
+L354: dec L388
+clr L78
+L355: jmp L147
+jmp *r3
+L356: rts
+L357: cmp r3, r6
+L358: red *r4
+L359: rts
+rts
+sub *r1, L513
+L360: rts
+L361: sub r3, L388
+; comment
+mov L399, r1
+L362: sub r7, L264
+L363: inc L159
+L364: jmp *r7
+
+cmp #-84, #-144
+inc L295
+red L526
+L365: red L412
+add *r5, *r0
+not r7
+L366: lea L313, r6
+L367: dec L223
+dec r0
+L368: prn #-22
+jmp L350
+L369: bne L582
+cmp r0, L253
+; comment
+L370: rts
+L371: dec *r3
+L372: lea L146, r6
+L373: not L261
+L374: lea L423, r0
+L375: .string "iyoafbpm"
+lea L191, r5
+L376: clr r6
+L377: bne *r5
+L378: stop
+dec L335
+prn *r2
+L379: add #123, r5
+inc L149
+L380: .string "kmghbobqqcavzyorp"
+L381: clr *r0
+L382: add r7, r6
+L383: red r4
+L384: clr r5
+L385: rts
+not r4
+L386: lea L499, *r4
+sub *r4, L559
+mov #-216, r7
+add L150, L127
+L387: .data 86, 951, -920, -687, -296, -409, -532, -522
+bne L8
+bne L574
+L388: dec r0
+L389: jsr *r3
+L390: cmp *r7, *r1
+L391: jsr L51
+L392: cmp *r7, r6
+L393: rts
+L394: add L253, L271
+
+L395: red r4
+L396: stop
+jsr *r6
+dec r1
+L397: cmp *r7, *r3
+clr *r7
+L398: inc *r6
+L399: .data -328, -96
+mov *r5, *r1
+lea L523, L425
+L400: .data -151
+L401: clr r6
+L402: .string "leckharuicdmcnysmzqdjql"
+L403: bne *r2
+L404: jsr L568
+inc *r1
+bne L523
+; comment
+lea L323, L450
+prn L564
+add *r2, *r5
+jsr L584
+stop
+; comment
+L405: .data -957, -531, 628
+L406: prn L320
+sub #85, r5
+L407: add L299, L44
+L408: rts
+bne *r7
+red r7
+L409: dec r2
+L410: clr L59
+L411: bne L536
+L412: rts
+add *r7, r6
+not *r0
+L413: red *r7
+L414: cmp *r2, r3
+L415: jmp L530
+L416: sub L333, L434
+jsr L450
+dec L76
+rts
+L417: jmp L530
+add L504, *r7
+jmp *r7
+jsr L512
+not L551
+L418: .string "iebxrjcqfkmkwmvpnvg"
+L419: inc r5
+L420: bne *r1
+inc r3
+L421: prn *r7
+L422: rts
+clr L316
+mov *r2, r2
+L423: jsr L496
+cmp L177, L50
+not *r6
+jsr *r3
+bne L226
+L424: .data -758, 706, -280, -318
+L425: stop
+L426: prn #233
+L427: not L202
+L428: inc L138
+L429: .data -312, -997, 43
+
+not L597
+L430: .string "q"
+L431: .data 652, -969
+cmp *r7, #240
+L432: stop
+stop
+L433: .data -420
+L434: lea L336, L196
+jmp L541
+not *r1
+L435: .data -689, 745, 304, 893, 611, -446
+clr r1
+bne L13
+L436: .string "vprwjckkzdpppxs"
+; comment
+L437: .string "gctfegqjzcgoijsspxhkorsx"
+L438: bne L50
+not *r4
+prn L460
+L439: stop
+L440: prn L388
+L441: jsr L109
+inc L78
+L442: sub *r7, r4
+L443: sub L354, *r2
+stop
+L444: .data -423, -377
+lea L569, L513
+stop
+L445: .data 863, 879, 819
+add *r5, r5
+L446: .string "josigddknm"
+prn *r1
+L447: red *r1
+L448: clr L506
+L449: .string "sfsybdxedkhxfkdbjgsecd"
+clr L223
+L450: add #168, L575
+L451: lea L281, r5
+L452: stop
+L453: jsr *r5
+clr r3
+add #-31, *r6
+dec r2
+L454: not L31
+L455: jsr L331
+L456: bne *r0
+
+stop
+not r7
+L457: .data -930, 62, 583, 644
+L458: .data -265, -550, 641, -686, 871, -359, -84
+not r2
+jsr *r5
+prn L408
+; comment
+L459: lea L476, *r5
+L460: cmp L462, *r7
+L461: rts
+L462: bne *r3
+L463: dec L601
+inc r7
+lea L539, r1
+L464: clr r0
+L465: .data -733, 820
+dec L444
+red *r6
+jsr *r6
+L466: add *r4, r2
+cmp r5, *r2
+L467: rts
+L468: inc L454
+L469: prn #-59
+L470: .data -629, 49, 599, -870, 496, -923, -970
+
+L471: red L460
+L472: bne *r1
+jmp *r4
+red L432
+prn r0
+L473: jmp L478
+L474: stop
+L475: red r1
+cmp r7, #133
+L476: clr r4
+L477: rts
+L478: dec *r1
+clr L565
+sub L475, *r6
+mov L347, *r4
+; comment
+jmp *r1
+not r1
+L479: .string "cyeoaadujyibcwuclyjom"
+L480: bne *r4
+L481: clr r7
+L482: sub L534, L425
+L483: mov L457, *r1
+L484: .data 853
+not r3
+L485: clr r7
+inc *r7
+L486: jsr L180
+L487: not *r1
+lea L517, *r1
+L488: sub r1, *r4
+L489: clr *r2
+not L553
+L490: clr *r1
+prn #-25
+L491: stop
+bne *r1
+L492: sub L161, L454
+L493: sub r1, *r5
+jsr L505
+L494: .data -742
+jsr L525
+
+L495: jmp *r7
+jsr *r0
+L496: stop
+
+
+L497: dec L213
+dec L562
+sub r5, L586
+L498: stop
+L499: lea L594, r1
+L500: .string "vcg"
+L501: rts
+L502: red *r7
+lea L457, L47
+L503: cmp *r7, L556
+; comment
+lea L46, *r7
+jmp *r4
+dec L577
+L504: red r0
+L505: not r0
+
+
+L506: jsr *r6
+L507: .data 644, 840, 168
+dec *r6
+not *r0
+L508: clr r5
+L509: prn *r2
+L510: rts
+add *r3, L379
+L511: inc L115
+L512: .string "rixtciaghisszkrt"
+L513: clr r7
+L514: lea L585, L207
+L515: cmp #-242, r3
+L516: add *r4, L433
+stop
+; comment
+L517: dec L245
+L518: clr *r7
+L519: inc L150
+clr L527
+not L79
+L520: .string "ucvel"
+L521: .string "lkokncgtzivpmfjegnj"
+jsr L572
+L522: clr *r6
+L523: sub L151, *r0
+L524: prn r6
+dec L111
+L525: mov #-106, *r1
+dec L14
+clr r7
+; comment
+L526: clr L114
+L527: not r6
+L528: jmp L505
+L529: bne *r1
+L530: inc *r7
+L531: jmp *r6
+L532: .string "wwohzjtaytpafmacxkctpf"
+L533: stop
+L534: not *r0
+L535: mov #-154, *r1
+L536: stop
+red *r1
+prn L160
+L537: clr r6
+L538: jsr L602
+L539: not L412
+L540: jmp *r2
+L541: .data 714, 96, 734, -256, 356
+L542: clr *r1
+L543: bne L397
+L544: rts
+L545: bne *r2
+L546: rts
+L547: sub r1, *r1
+L548: inc r5
+bne L595
+
+L549: not L243
+L550: add *r6, L237
+; comment
+L551: .data 329, 638
+L552: .string "xtuieekshfssnb"
+L553: lea L594, *r4
+L554: prn *r1
+inc *r7
+L555: clr *r3
+stop
+L556: inc L150
+L557: .string "lgigzrwvbsmlpoqa"
+L558: jsr *r3
+L559: sub *r3, r3
+add #-179, *r5
+L560: inc *r7
+L561: .data -181, 141, -53, -815, -810, 143
+mov *r2, L597
+not r2
+red *r3
+mov r1, L105
+cmp *r1, L570
+L562: jsr L583
+L563: jsr *r4
+L564: add r0, *r0
+lea L140, L80
+L565: dec r2
+L566: bne L77
+sub *r5, r2
+L567: lea L585, L581
+inc L578
+dec L573
+L568: cmp r4, *r7
+
+
+L569: add L599, L600
+prn #61
+jmp L196
+L570: mov *r4, L19
+jmp *r3
+jsr *r3
+rts
+dec *r2
+red *r3
+L571: .string "vmwestb"
+L572: .data 984, -73, -433, -972, 673, 163, 313
+add *r0, *r5
+not r6
+L573: rts
+L574: .string "pifw"
+L575: .data -501, 177, 652, -886, 977, 360, -266, 98
+L576: rts
+mov *r1, L325
+jsr L216
+clr L589
+dec L551
+L577: mov #-129, *r4
+L578: clr r7
+L579: lea L522, *r1
+L580: sub *r0, L384
+; comment
+cmp *r3, #-28
+L581: not L599
+L582: jsr L376
+sub r2, *r6
+L583: bne L28
+L584: add r0, L588
+L585: .data -255, 796, 961, 100, 268
+L586: red L557
+L587: dec r4
+not L594
+mov #-82, r0
+L588: jmp L589
+not r6
+L589: cmp r7, #-152
+not L249
+cmp L591, *r1
+L590: bne L595
+not *r6
+L591: .string "ndnjhthvnmuzmaeiqqwu"
+L592: clr *r4
+L593: jsr L60
+L594: add #209, r0
+dec *r6
+L595: prn #193
+; comment
+jmp L438
+prn #-30
+L596: inc r6
+sub L245, *r2
+L597: not L603
+jmp *r3
+; comment
+L598: red r6
+L599: jmp L347
+L600: .data -241, 52, -52
+
+L601: jmp *r6
+L602: sub #54, L1
+L603: jmp *r0
+inc *r1
+stop
@@ -0,0 +1,1040 @@
+; Generated by genCorpus --seed 43
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+L0: rts
+clr *r1
+mov r2, *r7
+prn r5
+L1: red r1
+not L424
+L2: .string "xywpkjjdimwhphtjmqyfaq"
+L3: cmp *r3, L0
+L4: jmp L3
+sub #3, r7
+L5: not *r7
+L6: clr L4
+; comment
+L7: lea L0, r6
+jsr *r1
+L8: bne *r6
+L9: bne *r2
+jmp L8
+jsr L10
+rts
+L10: mov r0, *r2
+mov *r6, L586
+L11: bne *r2
+stop
+stop
+L12: bne *r7
+L13: prn #-226
+L14: mov *r5, L95
+L15: stop
+stop
+L16: .string "hjkzrqvmtlaustcrqgpeu"
+L17: cmp *r3, L55
+L18: stop
+L19: .data 654, 463, 498, -434, -619, -318, -243, 510
+L20: bne *r5
+
+L21: prn L19
+stop
+L22: .string "b"
+L23: jmp L6
+
+L24: .data 118, 996
+cmp #-155, r0
+L25: bne *r0
+L26: .data -569, 851, 191
+jmp *r2
+L27: dec *r7
+L28: lea L18, *r7
+prn *r7
+inc L9
+jsr L480
+L29: clr r5
+L30: not L518
+add #-26, L22
+stop
+rts
+lea L153, L551
+dec L576
+L31: not *r7
+L32: rts
+mov #-75, r0
+L33: jmp *r1
+L34: lea L191, r3
+L35: jmp L478
+dec *r2
+red L10
+jmp *r1
+L36: bne L586
+L37: .data 454, 533, -825, 161, -603
+clr r0
+L38: .string "scshipfokpboaqtyofowuak"
+L39: jsr *r3
+not *r5
+bne L2
+L40: cmp *r1, *r5
+mov r7, r3
+L41: not *r3
+prn r1
+L42: jmp *r4
+L43: .string "yyvoclhbcrrgnqgudyt"
+
+L44: jsr *r5
+rts
+L45: stop
+L46: jsr *r3
+L47: cmp #26, *r5
+clr r3
+add #94, *r3
+L48: lea L10, r4
+L49: mov #-94, r6
+bne *r3
+prn r2
+L50: .string "zgvszzjikxsqylgivnqm"
+sub L238, L10
+bne L460
+L51: dec *r1
+red r4
+cmp *r6, #191
+clr L91
+L52: jsr L124
+add r4, *r4
+mov r2, L15
+L53: .data 341
+inc *r0
+L54: .string "hlhxeboukis"
+clr L29
+L55: add r0, r6
+not L52
+L56: .data 804, -219, -338
+L57: bne L28
+
+L58: mov L296, L90
+L59: .string "kz"
+L60: stop
+L61: add L28, L46
+L62: .string "sxbuiddgdspivlxciiomeheh"
+L63: stop
+add #-183, *r1
+stop
+L64: sub L176, L21
+L65: .string "vbkwius"
+red L43
+L66: clr r4
+L67: .data -584, -934
+prn L3
+L68: stop
+L69: .data 297, -44, -342, -428, 193, 190, 652
+L70: sub #240, L381
+L71: bne L433
+L72: not r6
+; comment
+L73: red *r5
+L74: inc L589
+cmp r7, r2
+
+L75: red *r3
+L76: bne L263
+mov L67, L552
+red r2
+L77: mov L354, *r1
+inc *r2
+L78: red r4
+L79: mov r1, L188
+L80: prn L485
+jsr L63
+jsr L1
+L81: stop
+cmp *r5, *r3
+L82: bne *r1
+jsr *r6
+cmp #120, L44
+rts
+red *r5
+L83: add L469, L25
+L84: .data -387
+sub r7, L32
+L85: jsr *r7
+L86: .data -605, -942, -264, -40, -86, -779, -552, -75
+L87: dec L52
+L88: dec *r5
+L89: .string "rmrz"
+clr L55
+add r3, L212
+cmp r3, #-44
+L90: sub L101, r2
+L91: prn L80
+cmp r6, r6
+sub *r6, r5
+stop
+stop
+prn r7
+L92: sub L480, r6
+lea L76, r7
+L93: inc *r6
+L94: not *r1
+L95: clr L351
+L96: stop
+L97: jmp *r7
+; comment
+cmp #-178, #30
+L98: lea L87, r0
+stop
+jsr L41
+not r0
+L99: jmp L384
+mov *r0, L539
+lea L21, *r0
+L100: mov L0, L115
+L101: sub *r3, r5
+L102: lea L16, *r5
+L103: .data -218, -217, -995, -103, -624, 657, -695, 421
+L104: not *r4
+L105: cmp *r4, r6
+not L452
+L106: sub #241, *r1
+
+L107: dec r2
+stop
+red r0
+L108: sub L226, *r5
+L109: clr *r1
+L110: clr *r4
+L111: .data -961, -762, -905
+cmp L3, *r5
+L112: rts
+prn *r1
+L113: stop
+jmp *r0
+bne L73
+L114: lea L21, r6
+lea L365, *r0
+L115: .data 63
+L116: lea L347, r7
+rts
+bne L316
+L117: inc *r1
+not *r6
+not *r4
+L118: prn #-114
+; comment
+L119: jmp *r5
+L120: .string "clhxnlnhothuimgrvaodeoe"
+L121: sub #203, r7
+prn L91
+L122: not L34
+L123: jsr L460
+L124: not r5
+L125: inc *r5
+bne L583
+L126: lea L106, L4
+L127: mov L87, r5
+L128: bne *r7
+L129: jsr L100
+L130: .string "zfwddws"
+not L467
+L131: add *r2, L524
+L132: rts
+rts
+cmp #128, L286
+L133: lea L592, L115
+inc L385
+L134: mov #104, *r5
+L135: sub #-192, L40
+L136: not r3
+L137: jmp *r3
+rts
+L138: lea L500, L35
+jmp *r5
+mov *r7, *r5
+sub #-220, r1
+bne *r4
+L139: clr L302
+L140: cmp r4, #34
+L141: .data -95, -392, 665, -778, -581, -936, 367, -624
+L142: dec r4
+prn r6
+cmp #-243, L97
+L143: lea L72, L73
+stop
+rts
+L144: dec L308
+L145: jsr L97
+L146: stop
+L147: lea L249, L258
+add *r7, *r4
+L148: .data -280, -203, 738, -231, -703, 866
+bne L128
+L149: red r4
+stop
+L150: mov #235, *r4
+L151: not L114
+jsr *r6
+bne *r3
+add #198, *r1
+jmp L78
+L152: sub r6, *r1
+L153: rts
+L154: clr *r1
+L155: sub *r5, L102
+dec L499
+L156: cmp r2, #-252
+L157: prn L32
+jmp L115
+L158: .data -859, -917, -632, 973, 153, -156
+L159: lea L420, *r5
+L160: dec L139
+L161: red *r6
+clr r4
+stop
+L162: prn L583
+L163: rts
+L164: rts
+bne *r3
+L165: .data -726, -540, -1000, 436, 888, 379, 565, 349
+; comment
+L166: clr *r0
+clr *r1
+L167: stop
+L168: red L135
+L169: dec r0
+L170: cmp #-221, L269
+dec r7
+stop
+L171: lea L180, r1
+lea L534, *r2
+L172: sub L601, L327
+L173: inc *r2
+bne *r0
+jmp L96
+L174: red *r2
+L175: cmp *r5, r6
+clr L25
+; comment
+L176: jsr *r7
+rts
+L177: bne *r6
+bne L331
+L178: inc L79
+bne L464
+L179: inc L417
+L180: jsr L391
+L181: prn *r0
+clr L197
+L182: jmp L156
+L183: not r5
+L184: .data 350, 737, 230, 648, -326, 378, 161
+L185: stop
+L186: jmp L62
+L187: rts
+bne L46
+not r4
+cmp *r0, r3
+L188: rts
+L189: lea L98, r1
+clr *r4
+rts
+red L542
+not L474
+L190: stop
+L191: jmp *r4
+L192: inc r4
+L193: cmp *r5, *r5
+L194: rts
+L195: jsr L114
+L196: sub L116, L293
+L197: stop
+L198: lea L97, L68
+L199: .string "ofpstbhade"
+red L395
+L200: red L63
+L201: mov #189, *r1
+L202: .data -118, 59, 504, -533, 988
+jmp L484
+L203: .string "kyxenvkbtdnmqmcsj"
+jsr *r0
+L204: sub r7, r2
+not L1
+lea L1, *r4
+L205: cmp *r7, #-78
+L206: rts
+L207: mov #-154, *r1
+L208: lea L160, L250
+L209: inc L59
+L210: cmp L503, r5
+rts
+jmp L257
+; comment
+L211: .string "rayihlgngghtnfpslq"
+L212: .data -209, -240, 197, 414, -388, 408
+L213: sub *r4, L544
+L214: sub L166, r5
+; comment
+red r1
+; comment
+L215: jmp L418
+L216: .data -237, 730, -352, -354, -937, 305, 28, 307
+clr L605
+L217: jsr *r5
+L218: clr *r4
+L219: inc r7
+L220: clr L559
+lea L207, *r7
+L221: not r5
+L222: inc r1
+L223: lea L240, r5
+L224: .string "wtmnnpzyterpx"
+L225: dec *r6
+red *r7
+L226: stop
+L227: rts
+L228: rts
+L229: .data -719, -270, -485, -76, 360
+L230: .data 116, -708, -701, 250
+L231: add L222, r1
+L232: bne *r3
+L233: jsr *r2
+rts
+L234: add *r1, r3
+L235: .data -6, -588
+L236: rts
+jmp *r7
+jmp *r5
+L237: not L305
+L238: red *r1
+L239: .data -858, 851, -611, -376, -765
+stop
+L240: red r6
+clr *r5
+L241: dec L526
+dec *r2
+jmp *r4
+L242: .data -763, -855
+
+stop
+cmp *r3, #249
+jsr *r0
+L243: cmp *r4, #71
+L244: lea L537, L568
+stop
+add r1, *r2
+L245: sub r4, *r0
+L246: .string "tm"
+L247: red r6
+sub #-101, *r5
+inc L120
+L248: mov #219, L241
+L249: bne *r2
+L250: lea L240, r0
+jsr L488
+L251: .string "nqhznrchjefmmkeialpuf"
+L252: red r6
+jmp L170
+L253: inc r0
+; comment
+jmp *r5
+L254: mov L68, r7
+L255: red L413
+L256: inc r0
+L257: stop
+L258: inc L412
+L259: stop
+inc *r1
+L260: add *r0, L46
+; comment
+jsr L476
+L261: lea L562, L421
+jsr *r1
+prn r4
+L262: red r5
+jmp *r5
+red L417
+not L293
+sub L26, r5
+L263: not L534
+L264: red r3
+L265: inc L76
+L266: inc *r0
+L267: rts
+L268: clr L245
+L269: .string "qvzkfoqiilhxsnqgbcb"
+L270: jsr L517
+L271: bne L224
+L272: lea L524, *r5
+L273: cmp *r6, r6
+L274: dec r6
+mov L159, L345
+L275: sub *r0, *r6
+L276: .string "tng"
+L277: red L91
+L278: jmp L67
+clr r3
+L279: lea L198, r3
+L280: jsr L39
+L281: jmp L264
+L282: .data -182, -87, -865, 365, 918, -401, -346
+stop
+L283: .data 660, 216, -576, -887, -602, 163, 418
+inc *r7
+; comment
+L284: prn L218
+clr L92
+jsr *r6
+L285: lea L407, *r3
+L286: add L225, *r2
+L287: mov L592, r1
+L288: not *r5
+L289: bne *r7
+L290: mov r1, *r6
+L291: bne *r6
+L292: jmp *r7
+L293: .string "lotpxsywmzqciireqspang"
+add L204, L99
+L294: lea L121, *r3
+L295: sub r7, *r3
+jsr *r6
+bne *r2
+L296: stop
+L297: clr *r0
+L298: not *r5
+L299: prn *r4
+L300: not L86
+L301: .string "irhu"
+L302: .string "cdbqjisedqpxwzfqeenuejm"
+jmp L584
+L303: add #-175, *r4
+L304: .data -597
+L305: jsr *r4
+L306: red L493
+L307: .string "vqmlxwcwcbsl"
+inc r2
+
+mov L552, L564
+L308: cmp *r5, *r6
+L309: jsr L166
+L310: cmp #19, r1
+stop
+stop
+L311: add #-16, L355
+L312: prn L397
+L313: add L524, r2
+L314: mov #-111, r7
+L315: rts
+L316: bne *r1
+L317: add #180, L160
+clr *r0
+jsr *r6
+L318: .data -66, 900, 76, -656, 960, 593, -941, -151
+L319: .data -462, 211, 652, -908, -146
+dec *r2
+L320: sub #215, *r6
+L321: jmp *r5
+jmp L452
+L322: bne *r1
+L323: rts
+L324: mov *r0, L436
+L325: jsr L358
+L326: dec r0
+
+L327: .string "vujgwcsqxsiene"
+L328: lea L596, *r5
+L329: bne L303
+L330: cmp #-72, L38
+L331: not *r5
+L332: cmp L124, *r7
+prn *r0
+; comment
+L333: red *r6
+stop
+
+L334: red r5
+L335: .string "eygpsghebdtvvhhz"
+L336: .string "rpyy"
+L337: rts
+clr L183
+; comment
+clr *r2
+L338: .string "bobgeidavrjdpcltrukqatyg"
+L339: jmp L397
+L340: add *r7, r0
+lea L364, r1
+L341: cmp *r6, L75
+jmp L106
+lea L306, L244
+L342: .string "gtcqymhif"
+L343: .data 411, -150, -508, -773, 866, 222
+not r4
+L344: jsr *r2
+cmp #114, *r3
+red *r5
+L345: .string "hthqqzf"
+L346: .string "sirdzbwwgikxleewcwfxd"
+L347: .string "z"
+L348: dec *r7
+L349: dec *r7
+inc L134
+L350: dec L40
+red L116
+clr r0
+L351: add r6, L233
+L352: not r7
+L353: red r3
+L354: mov r2, r7
+L355: clr *r5
+; comment
+red L246
+L356: jmp *r7
+add #-239, r6
+L357: red L569
+prn #-226
+L358: prn r1
+L359: add r5, r7
+L360: add L138, L393
+prn #-161
+inc r2
+L361: add #80, *r6
+L362: lea L544, *r3
+L363: red *r4
+
+L364: mov *r2, *r4
+L365: bne *r1
+L366: lea L458, r3
+dec r2
+sub #-141, r3
+L367: cmp r3, L531
+jmp *r5
+L368: inc L271
+L369: stop
+L370: red r6
+L371: stop
+L372: prn #-240
+jmp L163
+cmp *r0, #-185
+jsr L196
+mov *r3, *r6
+cmp #164, L590
+L373: bne *r4
+L374: add *r7, r0
+L375: inc r3
+L376: not *r7
+L377: inc r0
+
+bne L597
+L378: jsr *r5
+L379: .string "ohwveagdnalqvifyl"
+L380: jsr *r1
+L381: red L358
+L382: .data 515, -746, 35, -515, 950, 787
+L383: not *r7
+L384: cmp #-132, r7
+lea L301, L474
+L385: .data 364, 373, -151, 999
+L386: jmp L172
+jmp *r7
+L387: .data -644
+inc L23
+rts
+L388: prn #123
+dec L519
+clr *r1
+L389: clr r1
+jsr L343
+L390: add r5, r7
+prn r4
+L391: rts
+clr *r4
+L392: .data 582
+stop
+red *r7
+L393: rts
+L394: not *r0
+L395: clr *r5
+L396: clr r5
+sub #-25, L554
+L397: .data 114, 173, -127, -193, -678, -617, 767
+lea L508, r0
+L398: add r5, r2
+mov #-146, L483
+L399: .data 797
+L400: clr r6
+jmp *r1
+jmp *r2
+L401: dec r5
+mov L61, L253
+; comment
+L402: clr *r2
+jmp L110
+L403: red r0
+dec L8
+L404: mov r3, *r5
+L405: not L224
+
+L406: jmp *r7
+L407: mov r7, *r0
+L408: lea L526, r6
+L409: sub *r6, L432
+L410: lea L541, r3
+L411: inc *r2
+L412: prn r7
+inc L508
+red *r5
+L413: .string "sciarwbjoqtwvozbirr"
+L414: .string "boxqyyesdqobymbyhfkeo"
+stop
+
+cmp *r5, L550
+L415: clr *r6
+L416: lea L443, *r6
+L417: add r6, r0
+L418: .data 525, -112, 368, -193, 21, -114
+L419: cmp r7, *r7
+L420: jsr L82
+L421: cmp *r3, L556
+prn *r7
+L422: cmp *r7, *r3
+L423: dec r1
+L424: clr L534
+L425: .string "fzjcqig"
+add r2, *r7
+rts
+L426: bne *r2
+L427: not *r3
+L428: not L534
+L429: lea L431, *r3
+L430: .string "shpiosiqvkgnbuln"
+L431: rts
+bne L500
+clr *r3
+L432: .data 640, 499, -224
+; comment
+not r5
+L433: .data 328, 461, 138, -646, 969, 675, 55, 920
+rts
+L434: .data 341, -410, -334, 243, 446, 63
+jmp L452
+L435: mov L429, r4
+L436: mov L18, *r5
+L437: .string "atqiowao"
+stop
+L438: clr L506
+L439: mov #-104, L348
+L440: not r2
+L441: red *r5
+L442: stop
+L443: jmp *r4
+L444: .string "jvfdsdxoaxezgytaefqk"
+L445: bne *r1
+L446: dec r1
+bne L448
+L447: sub #-156, *r1
+dec *r0
+rts
+dec r0
+L448: mov L212, L239
+L449: dec L119
+jmp *r1
+L450: not *r4
+L451: .data -915, -436, 735, -396, 677, -544
+L452: mov L570, r3
+L453: red *r7
+mov *r0, *r1
+L454: add L461, r7
+rts
+prn L237
+red r4
+lea L363, r4
+L455: .data 846, -92, -415, -499
+L456: dec L435
+L457: red *r4
+L458: mov #17, L477
+; comment
+L459: stop
+rts
+L460: .data 987, -293, -966, -867, -671, -374, -4, 201
+L461: jsr *r0
+L462: dec r7
+prn *r1
+L463: not L161
+L464: stop
+bne L503
+add L479, *r5
+L465: prn L478
+prn r6
+; comment
+L466: .data 349
+L467: .string "pwzzziqhchzntiuuizilt"
+L468: .data -778, -632, -73, 244, -154, -848, -597, -681
+L469: stop
+clr *r4
+dec *r5
+jmp *r4
+L470: .string "sgqnjjomxqzinvccwybov"
+L471: sub *r4, r3
+L472: stop
+L473: .data -87, 963, 221
+L474: jsr L544
+L475: not L477
+jmp *r2
+L476: clr *r0
+L477: bne L113
+L478: jsr L354
+L479: stop
+not r7
+clr L491
+prn L223
+L480: clr r3
+stop
+L481: sub r4, *r1
+L482: red *r3
+L483: jsr *r6
+bne L469
+L484: .data 665, 482, 176, 647, -11, -265, -807
+jmp L503
+stop
+L485: cmp L224, r0
+; comment
+L486: mov L243, L314
+sub #2, r7
+L487: red *r5
+L488: .data -514, 240, 603, 124, -299, -65, 392, 95
+L489: jmp L431
+rts
+L490: sub #-121, r0
+sub #141, r2
+L491: inc *r0
+stop
+L492: sub #40, L191
+L493: rts
+dec r5
+lea L494, r7
+L494: sub *r4, r3
+L495: .data 122, -532, 214, 356, -465, -850, 872, 45
+cmp L124, L470
+L496: jmp *r7
+L497: .string "lddrhcawvj"
+L498: .string "gomijtayidljmwecn"
+; comment
+L499: jsr L501
+L500: red *r5
+add #-66, r4
+L501: bne *r7
+L502: red r5
+L503: mov *r0, *r4
+L504: not r0
+red L584
+L505: red *r2
+L506: inc r2
+L507: .string "gw"
+L508: mov r1, *r3
+mov L292, *r1
+L509: lea L324, r4
+L510: lea L152, L572
+L511: sub L523, r0
+sub *r3, *r6
+L512: add #-184, L530
+L513: .string "nxefeuwqdxcvzhknzsfmelr"
+mov *r0, r4
+inc L556
+sub *r5, L590
+inc L595
+L514: .data 33, -191, 788, -837, 849
+sub #50, *r1
+cmp #-166, r3
+prn L212
+L515: not r7
+L516: prn *r7
+L517: bne *r2
+inc L360
+L518: sub L143, L207
+L519: bne L464
+rts
+L520: prn #72
+dec r3
+not *r6
+inc L550
+rts
+L521: clr r0
+L522: red L591
+lea L552, r5
+L523: sub r6, r0
+inc *r7
+clr L602
+L524: jmp L46
+stop
+L525: mov L531, L410
+L526: cmp *r1, L573
+L527: clr r6
+L528: prn #219
+L529: add L365, r5
+L530: mov L537, r1
+L531: inc L560
+L532: lea L593, *r4
+not L425
+sub L168, *r5
+red r1
+rts
+L533: cmp #-153, r4
+L534: cmp *r4, r2
+L535: .data -366, 429, 317, -758
+L536: jsr *r3
+L537: mov L341, L550
+L538: bne L398
+L539: clr r6
+clr r1
+L540: jmp L563
+sub L141, L235
+L541: mov L187, r0
+; comment
+L542: add #-223, r0
+L543: .string "okrpndnlzxlwxzgwsopw"
+L544: sub #37, L520
+L545: stop
+L546: .data 738, -286, -994, -638, 309, -520, 596, 622
+L547: red r6
+L548: cmp *r5, #-164
+bne *r5
+L549: .data -826, 222, -837, 951, -979, 40
+sub *r2, *r0
+L550: mov #-153, *r2
+stop
+red L556
+jsr L566
+L551: jsr L579
+L552: clr r0
+L553: jsr L591
+L554: dec *r0
+clr r3
+L555: prn r3
+lea L406, r5
+
+L556: dec r7
+L557: add *r4, L562
+jmp L15
+L558: jmp L104
+L559: inc r6
+rts
+add r6, *r1
+rts
+L560: cmp L209, #239
+L561: bne L568
+L562: inc L597
+dec r0
+stop
+cmp #-220, #145
+L563: jmp *r7
+bne L94
+L564: bne L405
+L565: dec r6
+lea L32, r4
+L566: cmp L569, #148
+jsr *r4
+L567: .data -347, 742, -166, -351, 185, 795, -197
+L568: cmp *r4, #162
+sub #212, *r4
+mov #-201, r2
+L569: red L596
+L570: .data -815
+L571: bne *r0
+L572: add #-119, *r0
+L573: dec *r1
+L574: sub *r5, *r4
+L575: cmp r3, L491
+clr r0
+stop
+stop
+L576: .data 418, 575, 653, -556, 655, 139, -867
+L577: not *r0
+add L600, r4
+stop
+cmp L593, #-102
+clr L589
+red *r4
+L578: clr r3
+L579: jmp L594
+not *r1
+clr *r5
+L580: stop
+sub *r5, *r2
+
+L581: prn L347
+L582: not L599
+lea L593, *r0
+
+dec *r3
+bne L419
+L583: inc L281
+L584: mov #254, r1
+L585: dec *r5
+prn #-33
+jmp *r3
+clr r0
+L586: cmp #-126, #142
+dec *r2
+L587: .string "sjbosidksmwnxwescgvsbm"
+L588: jmp *r7
+L589: .data -716, 778, -798, 933, 305, -713, 666
+L590: cmp *r6, r1
+; comment
+bne L506
+L591: stop
+L592: inc L40
+L593: lea L600, L253
+L594: jmp *r5
+L595: jmp *r4
+L596: lea L605, r6
+jmp *r4
+jmp *r4
+L597: .string "elfgbqsy"
+jmp *r6
+prn #22
+jmp *r3
+L598: .string "rnykull"
+rts
+L599: stop
+mov #195, L605
+L600: mov *r6, r3
+L601: lea L605, r0
+L602: .data 708, 260, 752
+L603: jmp L604
+L604: rts
+L605: mov #50, L216
+stop
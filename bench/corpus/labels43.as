@@ -0,0 +1,1039 @@
+; Generated by genCorpus --seed 44
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+
+rts
+add #120, *r6
+L0: not L251
+L1: bne *r7
+L2: rts
+L3: prn r4
+L4: dec r2
+L5: mov #19, L267
+L6: stop
+rts
+sub r4, L0
+L7: inc r0
+add *r4, r2
+dec *r7
+jsr *r4
+L8: not *r7
+sub r0, r2
+stop
+L9: jsr L333
+jmp L5
+cmp *r4, r0
+L10: sub L342, L440
+add *r7, r3
+L11: rts
+not *r2
+red r1
+L12: jsr L444
+L13: stop
+cmp r3, L3
+red *r7
+L14: stop
+L15: not *r2
+add r6, *r1
+jmp L12
+L16: cmp L7, #-198
+jmp L220
+jmp *r1
+L17: stop
+L18: sub #34, *r1
+L19: rts
+L20: jsr *r5
+cmp #9, r0
+L21: sub #158, r2
+L22: not r7
+L23: clr L148
+L24: lea L89, L13
+L25: prn *r3
+jsr L15
+L26: prn L181
+red r4
+jsr *r3
+L27: not L4
+L28: mov r1, r2
+L29: not *r6
+L30: .data -703, -16, -3
+L31: inc r3
+rts
+cmp #200, r4
+L32: cmp L6, *r2
+stop
+L33: add r4, *r7
+mov *r2, L457
+L34: cmp #53, *r3
+L35: sub *r3, r6
+L36: prn #91
+L37: red L537
+L38: sub *r1, L153
+not *r0
+L39: .string "jccjjcnrrjepusainls"
+jsr *r2
+L40: .data -46, -656, 158, -437, -341
+jsr L28
+L41: sub r3, r2
+stop
+cmp *r2, #-204
+rts
+L42: stop
+jmp *r7
+L43: rts
+L44: .data 254, -753
+L45: red r6
+L46: clr r3
+L47: .string "ktzhvhwkxbc"
+lea L37, *r2
+bne *r5
+lea L2, r7
+L48: .data -660, 261, -489, -974, 696, -919, -675, -459
+L49: .string "gkfqmvyu"
+L50: jmp L479
+L51: dec *r5
+L52: dec r4
+bne *r2
+L53: jmp *r1
+rts
+clr *r5
+L54: .data 630, -380, 501, 68, -974
+L55: cmp L139, #-177
+jmp L296
+dec L29
+L56: dec r3
+L57: clr L53
+L58: bne L30
+cmp #-96, L155
+L59: lea L80, L34
+L60: jmp L124
+L61: stop
+L62: lea L119, r3
+L63: .string "dhhxdabfwetcgpsphyovp"
+lea L7, L268
+dec *r2
+lea L371, r4
+L64: add r0, r6
+L65: cmp L405, #-148
+cmp #240, #78
+L66: prn *r7
+sub L58, r5
+L67: sub #-194, r4
+stop
+L68: clr *r6
+L69: rts
+L70: inc L20
+jmp *r7
+L71: .string "pfptxmtumeqnzpzmfdpih"
+not L27
+red *r7
+L72: sub L535, *r1
+bne *r6
+L73: sub L26, L441
+L74: lea L53, L241
+L75: stop
+L76: lea L203, *r7
+prn r5
+mov *r3, L52
+; comment
+L77: add L190, *r2
+L78: dec *r1
+L79: mov *r4, *r0
+L80: clr r7
+mov L30, r7
+lea L65, *r7
+L81: mov L49, *r4
+L82: add L2, *r6
+L83: .string "vjefirmae"
+L84: .string "iglrnmafaxzs"
+L85: prn *r2
+not L50
+red r5
+L86: bne L85
+jsr L1
+L87: rts
+red r0
+prn *r1
+L88: lea L372, *r4
+L89: .data -3, -398, -557, 997, -251, -300
+mov L276, r2
+L90: sub #-121, r5
+L91: inc *r0
+mov *r7, r2
+jmp *r3
+L92: mov r1, r7
+L93: cmp L368, r1
+L94: .data -367, 681, 440, 871, -756, 493, -660
+L95: prn #-248
+L96: clr *r2
+L97: .data 718, 901, -448
+L98: add *r1, *r4
+L99: add *r5, L93
+L100: dec L219
+L101: cmp #93, r4
+L102: prn r7
+L103: clr L28
+; comment
+add #213, *r2
+mov r1, r1
+add *r3, *r6
+L104: jmp L92
+dec *r3
+dec r0
+
+L105: bne L104
+L106: clr L28
+rts
+L107: clr L320
+L108: jmp *r2
+L109: not L11
+L110: red *r2
+L111: bne L61
+L112: rts
+not *r2
+; comment
+bne L39
+L113: cmp L52, #-121
+L114: bne L243
+L115: bne *r6
+jsr *r6
+L116: jmp *r3
+prn L408
+add r3, *r1
+L117: jmp *r1
+L118: stop
+inc L441
+red r4
+add r2, L196
+L119: .data 851, -821, 378, 401, 456, -195
+L120: jmp *r5
+L121: red L112
+L122: dec r5
+bne L162
+L123: clr r3
+L124: stop
+L125: prn L79
+L126: inc *r6
+L127: sub L158, r5
+add r4, *r0
+L128: not L2
+L129: jmp L80
+L130: .data -207, -285, 304, -551
+bne *r3
+L131: not r2
+L132: sub L123, *r5
+lea L189, *r2
+bne L54
+jsr *r3
+L133: sub r0, r2
+L134: .data -715, 228, 571, -968, -85, -967, -786, -746
+jsr *r7
+lea L270, r0
+L135: .string "ncpxolerqzkhswwezaa"
+stop
+L136: jsr L215
+rts
+L137: sub *r3, *r1
+not r0
+L138: jsr *r1
+L139: mov r6, L288
+L140: jsr L455
+add #-149, r3
+L141: jmp *r7
+sub #81, L354
+L142: clr *r2
+L143: red *r3
+L144: .data 618, -620
+red L215
+bne *r4
+red r6
+sub *r3, r0
+L145: lea L163, *r5
+L146: add #143, r1
+; comment
+cmp #154, *r5
+prn *r6
+L147: rts
+L148: bne *r5
+stop
+L149: add r4, *r4
+; comment
+L150: stop
+L151: add #200, L89
+rts
+inc *r4
+L152: .string "xfgvoahlbrtcwd"
+L153: jsr *r4
+clr *r7
+L154: jsr L484
+L155: add L245, L499
+prn L34
+L156: inc L310
+L157: jmp L203
+prn *r4
+sub #250, *r4
+L158: prn L24
+stop
+; comment
+dec L113
+rts
+L159: sub L280, L491
+L160: lea L24, r1
+L161: red *r1
+cmp #-86, *r0
+L162: not r3
+L163: .string "mmlhromrkxbvju"
+L164: red r1
+add #-190, r0
+jsr *r1
+L165: jsr *r2
+clr r0
+L166: mov L458, r6
+bne L342
+jmp *r0
+L167: lea L18, *r0
+clr L102
+L168: jmp L127
+jsr *r4
+L169: bne *r0
+L170: jmp *r5
+L171: mov #-205, L46
+L172: rts
+jsr L570
+L173: inc *r6
+rts
+bne *r2
+L174: clr L170
+stop
+; comment
+sub r0, r7
+sub #-153, r6
+mov r3, L171
+inc *r0
+inc r2
+add L302, L102
+L175: cmp *r6, r5
+not *r4
+dec L78
+L176: clr *r4
+L177: clr L194
+L178: inc r1
+L179: prn *r4
+L180: .string "wckmvhvlgzcqj"
+L181: red *r7
+L182: jsr *r7
+add #-88, L120
+jsr *r0
+L183: cmp *r3, r1
+L184: add #-249, *r4
+L185: mov r4, *r2
+; comment
+L186: .string "isyeqsitapgtmj"
+L187: jmp L382
+red *r5
+; comment
+L188: .data -448, 466
+L189: mov *r3, *r7
+cmp #160, *r1
+L190: not *r0
+L191: mov *r7, *r5
+jsr *r0
+L192: .string "ejwigtaibxng"
+L193: .string "pcstdnve"
+L194: lea L511, r1
+L195: .data -901, -153, -204, -389, -61
+L196: add #46, *r3
+not *r4
+clr L288
+L197: .string "vjqz"
+
+L198: prn *r1
+L199: not r2
+L200: .string "tyfvekkjjznlvht"
+L201: add r6, r0
+L202: clr L343
+L203: add *r7, L511
+rts
+L204: stop
+L205: cmp r1, #130
+L206: jmp *r5
+L207: clr *r6
+L208: .string "tevhvxmmgc"
+L209: .string "eankfpxtlpnuxwvrvkvoxb"
+lea L38, r5
+lea L77, *r7
+L210: rts
+sub *r0, r0
+L211: clr r4
+inc r3
+sub r3, L215
+L212: clr L84
+L213: .string "lrh"
+mov L167, r0
+L214: .data -451, -659
+L215: jsr L286
+L216: .string "orwodrvkailb"
+L217: jmp *r6
+L218: .string "hhpyfcslkgmjazbxcjtjiely"
+mov L188, r5
+inc r0
+rts
+L219: jmp *r2
+L220: jmp L72
+L221: jmp *r2
+L222: inc *r5
+red L289
+L223: dec *r3
+not *r5
+L224: dec r5
+L225: .string "uqycfwgvhdxfkujoqf"
+bne *r3
+L226: stop
+L227: .data -828, -929, 151
+L228: mov r4, *r4
+rts
+stop
+L229: rts
+L230: prn r0
+L231: not L509
+prn *r5
+L232: inc *r5
+sub r1, L483
+mov *r3, *r1
+L233: clr L44
+L234: lea L389, r4
+L235: prn r7
+L236: inc r5
+L237: add *r6, L333
+L238: add r5, r4
+bne L411
+L239: dec *r4
+not r0
+L240: .string "llzftphvtmojbv"
+L241: not *r7
+L242: red *r5
+L243: not *r0
+jsr L233
+L244: mov #-150, r4
+stop
+L245: jsr L424
+red r3
+rts
+L246: sub r3, L199
+L247: cmp *r7, L556
+cmp r5, #-160
+L248: add r5, L560
+L249: sub r1, *r4
+L250: stop
+cmp #152, L197
+L251: add r4, *r5
+L252: mov L467, *r4
+L253: prn *r4
+stop
+stop
+red *r2
+jmp L5
+L254: .data 150, 188, 364, -724
+L255: sub r3, *r2
+L256: prn #133
+jsr L553
+rts
+L257: mov #135, L189
+L258: dec r3
+L259: jsr L448
+L260: bne *r0
+L261: mov r5, r5
+L262: sub *r3, L432
+inc r1
+L263: mov r7, r3
+rts
+add L575, L112
+L264: clr *r4
+L265: mov r6, *r0
+stop
+prn #-65
+clr r7
+jsr *r4
+add #247, L367
+L266: clr r0
+L267: inc r3
+L268: rts
+; comment
+L269: rts
+L270: inc L311
+L271: stop
+L272: red *r1
+L273: sub *r7, L23
+stop
+L274: red *r4
+clr *r3
+L275: .string "bhy"
+L276: mov r5, r1
+
+mov L131, r7
+L277: lea L375, *r2
+L278: inc L8
+L279: red r1
+sub #243, L417
+L280: dec *r4
+L281: jsr *r3
+bne *r5
+mov L37, *r4
+L282: dec *r3
+not r6
+L283: bne *r0
+jmp L111
+prn #-201
+L284: .data -718, -80, 379, -271, 544, 131
+cmp #-9, r1
+; comment
+L285: .string "fpcxjqevksetkvqmpn"
+clr L415
+L286: red L56
+cmp r3, *r2
+L287: not L38
+jmp L163
+L288: cmp r5, #-170
+L289: rts
+lea L21, *r5
+add *r1, r1
+jmp *r7
+L290: prn L516
+L291: inc *r2
+prn #-61
+prn L458
+L292: sub r3, L44
+L293: sub #-144, r5
+L294: dec r1
+L295: jmp L520
+L296: red *r3
+mov #142, r4
+mov #167, *r4
+cmp L331, *r1
+add L167, r3
+jmp L388
+L297: not *r0
+lea L247, r6
+L298: clr r7
+L299: prn r3
+cmp *r7, *r4
+L300: add L192, L315
+jmp L577
+mov *r5, L275
+rts
+L301: bne *r2
+red *r5
+L302: not L527
+L303: not r3
+rts
+L304: sub r1, r6
+L305: lea L431, *r4
+rts
+L306: dec *r5
+sub r7, r1
+L307: sub #-150, r6
+add *r1, *r4
+L308: lea L405, *r5
+L309: .data -959, 485, 73, -654
+sub r2, L515
+L310: .data -41, -802, 224, 748, 863, 524, -651
+L311: dec L250
+inc L276
+sub r6, r2
+inc *r5
+L312: .data 605, -866, -159, -888, -310, 657, -384
+
+L313: inc *r3
+L314: clr r1
+L315: jmp *r0
+add L400, L241
+rts
+L316: mov *r3, L169
+L317: .string "hfqhbnuezkzi"
+L318: not *r5
+; comment
+L319: dec *r5
+L320: cmp r1, r1
+L321: jmp *r1
+L322: red L480
+red *r0
+L323: .data -924, -647, -56, 224, 195, 819, -845
+L324: .data 125, 306, -958, -491, 954, 632
+L325: lea L73, *r5
+sub r2, L495
+L326: jsr L29
+L327: sub #-239, *r1
+; comment
+
+rts
+prn r3
+L328: cmp L94, L7
+clr *r1
+mov L2, r0
+L329: red L423
+L330: .data 906, 623, 232, 655, -706, 995
+L331: .string "zdfpjtjg"
+not r3
+red *r0
+sub L64, r6
+; comment
+stop
+bne *r4
+inc *r2
+
+jsr *r1
+L332: add *r0, *r3
+; comment
+sub L264, L386
+L333: lea L251, *r0
+clr *r6
+L334: cmp L219, #30
+L335: sub r3, *r1
+stop
+clr *r7
+L336: not L93
+bne *r1
+inc *r1
+jmp L390
+cmp r6, #220
+L337: jsr L426
+L338: mov #-45, r1
+jsr L77
+L339: sub #51, r5
+not *r2
+L340: bne L220
+mov L351, *r4
+not *r6
+L341: .data 579
+L342: clr r0
+L343: .string "witgdonolx"
+stop
+cmp *r7, L163
+bne L125
+L344: prn L146
+L345: inc r5
+L346: lea L495, r6
+L347: jsr *r7
+
+L348: mov #-98, r2
+L349: lea L289, *r2
+L350: .string "szpklsehcmhuudidvh"
+sub L472, *r5
+L351: clr *r5
+L352: jmp *r2
+L353: clr *r0
+L354: .data -864, -649, -718, -4, 363, -232, 546, 509
+L355: jmp *r0
+not r5
+L356: .string "juwgmthkjmuflcqqa"
+L357: jmp L125
+L358: lea L34, *r0
+L359: clr *r1
+L360: clr r5
+L361: lea L467, *r6
+L362: inc L209
+L363: jmp L392
+L364: prn r2
+L365: clr *r2
+red r1
+stop
+L366: sub #-147, r5
+clr L247
+L367: sub *r5, L442
+lea L107, *r1
+stop
+L368: jsr *r5
+not *r6
+L369: not *r6
+dec r2
+L370: cmp L237, #206
+L371: lea L494, *r1
+L372: red r6
+L373: inc r0
+L374: inc r5
+dec r4
+L375: jsr *r6
+L376: lea L450, L259
+L377: .string "gkvnnuzcraeqxenzxymoe"
+bne L440
+L378: add L432, *r5
+; comment
+L379: stop
+rts
+L380: .string "pyfbjrfltbrapcpndebci"
+L381: cmp *r4, *r5
+bne L533
+L382: clr r3
+mov #-23, r3
+cmp L207, L407
+mov *r7, L537
+L383: jmp L563
+L384: .string "wvnrzashjhmfmntd"
+lea L352, L319
+L385: .string "q"
+L386: prn #-2
+
+inc r2
+L387: .string "ovu"
+L388: cmp r7, *r7
+L389: cmp #-161, *r7
+L390: .data 273, -635, -506, -198
+L391: cmp r6, #-2
+L392: prn r1
+dec *r3
+L393: dec r2
+inc L338
+L394: prn L424
+stop
+L395: cmp *r2, #155
+rts
+L396: lea L93, *r5
+L397: inc L170
+L398: sub #-175, *r1
+lea L84, L331
+jsr L322
+L399: mov L220, r0
+L400: prn L477
+L401: jsr L521
+L402: .data 742, 384, -284, 169, -568, -432, -600
+L403: stop
+L404: not *r5
+mov L442, *r4
+mov *r3, r0
+rts
+lea L454, *r2
+L405: cmp L391, L488
+clr L571
+dec L281
+L406: not *r6
+L407: prn L388
+rts
+L408: .string "scrdqlexjuhtg"
+L409: sub r1, r2
+L410: stop
+L411: sub L529, *r5
+jmp *r4
+L412: .data -66, -741, -359, 339, 463, -162, 596, -816
+add L350, L479
+L413: dec L533
+clr *r6
+L414: .string "yhlagh"
+L415: prn L543
+L416: mov #147, L420
+; comment
+cmp L568, L13
+L417: inc L498
+mov L457, r4
+L418: sub *r0, r5
+dec r4
+jsr L485
+L419: stop
+L420: prn *r5
+mov L507, r3
+jsr *r4
+L421: clr r5
+dec L16
+L422: jsr L31
+sub *r7, L501
+L423: cmp *r2, *r7
+red *r4
+mov r0, *r0
+rts
+L424: jmp L483
+L425: .data 319
+inc L297
+L426: .string "widppvxpuwbwktygcyp"
+jsr *r5
+L427: add #187, L509
+L428: dec *r0
+L429: sub L498, *r0
+L430: .string "ldkypexuabrrvw"
+prn *r2
+; comment
+L431: .string "hiykphgfqgppltv"
+L432: jmp L459
+L433: jmp *r6
+L434: .string "eisukzqbztkrjq"
+L435: dec r3
+L436: sub #129, *r5
+prn *r6
+red r0
+L437: cmp #-207, L117
+sub L21, r5
+L438: rts
+stop
+dec *r4
+L439: clr r1
+stop
+
+prn *r6
+not r7
+L440: jmp L389
+L441: lea L476, r6
+L442: prn L335
+bne *r5
+
+L443: stop
+lea L541, r5
+dec *r6
+L444: jmp *r4
+L445: rts
+L446: jmp L235
+red *r6
+L447: sub *r2, *r6
+mov *r1, r2
+L448: jmp *r1
+lea L449, *r3
+cmp r6, *r0
+clr r4
+L449: .string "flywtzsrg"
+red L491
+L450: cmp L439, r7
+bne *r3
+L451: prn L90
+L452: .data -174, 999, -425, 650, 710
+rts
+rts
+mov *r3, L276
+L453: .string "mpswny"
+L454: jsr *r7
+L455: prn #-255
+L456: not *r4
+; comment
+L457: prn #-101
+L458: .string "lhrgbdypkos"
+L459: dec r7
+L460: lea L129, r2
+red *r4
+red L436
+jmp *r0
+not *r4
+L461: .string "j"
+L462: clr *r3
+L463: add *r1, *r2
+L464: .data -463, 907, -725, -627, 917, 252, -732
+L465: mov r3, *r7
+L466: clr *r6
+L467: dec *r1
+L468: .data -878, -59, -38, 781, 182, 178
+prn r0
+L469: lea L529, r1
+L470: mov #-67, r4
+add *r4, *r5
+L471: jsr *r1
+stop
+L472: not L437
+L473: red r3
+L474: cmp *r4, L109
+L475: stop
+jsr L322
+
+L476: sub *r4, *r2
+stop
+jmp *r3
+clr r6
+L477: stop
+L478: .string "gimiazdujceyguaimxcmyxd"
+L479: sub #228, *r1
+prn L315
+L480: .data 991, 566, 63, 235, 220
+L481: .data -322, 334, 49, 174, 990
+red *r6
+L482: jmp *r0
+L483: lea L541, L155
+L484: sub L324, *r3
+L485: inc r7
+dec L47
+L486: lea L527, L577
+add r0, *r0
+add #86, r4
+L487: stop
+stop
+L488: clr L168
+L489: red r0
+L490: lea L505, r4
+jsr L537
+L491: cmp #46, *r3
+L492: red r5
+
+L493: jsr *r1
+add L201, L296
+L494: prn r3
+lea L558, L545
+L495: mov #-105, r4
+mov r3, r5
+L496: clr L227
+L497: prn #188
+L498: .data -950, 991, 987, -520, -387
+inc *r3
+L499: stop
+sub #213, *r2
+L500: mov #125, r5
+L501: rts
+add r5, L79
+L502: red r6
+jsr *r2
+prn *r7
+dec *r6
+L503: .string "xn"
+L504: stop
+cmp L541, #221
+L505: lea L55, *r4
+L506: mov L540, *r5
+L507: rts
+L508: jmp *r5
+L509: inc r2
+
+L510: inc r2
+L511: .data -439, 48, -643, -428, 184
+inc L163
+L512: add L442, r5
+L513: lea L562, L471
+dec *r1
+clr *r2
+dec r6
+sub *r6, *r3
+L514: .data -610, 351, 526, 403, 709
+jmp *r4
+L515: dec *r7
+L516: sub *r3, r4
+L517: .string "shkyeujeensxxi"
+L518: prn r1
+; comment
+inc *r3
+inc L67
+lea L551, *r0
+L519: dec r3
+rts
+L520: .string "uyshlwbgx"
+jmp L563
+L521: sub L524, *r4
+L522: not r4
+L523: .string "w"
+L524: jsr *r0
+L525: not L526
+
+L526: prn *r3
+L527: jmp *r1
+jmp *r0
+L528: inc *r1
+inc r2
+; comment
+L529: bne *r0
+prn #248
+L530: mov #-253, *r4
+; comment
+L531: jmp *r4
+L532: lea L526, *r3
+L533: red r7
+L534: .data 726, -579, 27
+L535: jmp *r0
+mov L551, L570
+L536: red r5
+; comment
+bne *r2
+L537: stop
+L538: rts
+add r0, r7
+prn L229
+L539: clr *r1
+not r4
+sub L575, *r4
+L540: red L179
+not *r0
+L541: stop
+not r5
+L542: not *r1
+L543: rts
+jsr *r7
+dec r7
+L544: .data -414, -378, -237, 114, 358, 843, 813, -842
+L545: .data 579, -13, 972, -112, 255, 773
+L546: jsr *r2
+prn #-13
+L547: red L548
+cmp L567, *r1
+add L558, L525
+L548: rts
+cmp #-144, *r4
+jsr *r5
+L549: dec r5
+L550: prn L355
+L551: .data 550, 757
+L552: .data -721, 932
+L553: clr r3
+clr *r3
+L554: jsr L574
+L555: dec r3
+L556: not *r1
+jmp *r5
+L557: rts
+L558: cmp r6, L42
+L559: sub *r2, L153
+jmp *r5
+L560: bne L566
+L561: bne *r0
+L562: bne *r0
+L563: not r4
+sub *r3, *r1
+add r3, *r1
+L564: bne L569
+L565: mov r7, *r5
+L566: .string "dnaltke"
+add #205, L27
+
+L567: sub *r3, L569
+cmp r5, *r7
+L568: bne *r6
+L569: prn L253
+L570: prn L573
+L571: clr L572
+not r2
+L572: red r1
+L573: stop
+inc r2
+L574: mov *r0, r5
+lea L575, L576
+L575: rts
+mov #245, r3
+
+add *r5, L136
+mov r4, *r4
+L576: red r5
+L577: lea L521, *r6
+stop
@@ -0,0 +1,1040 @@
+; Generated by genCorpus --seed 45
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+L0: stop
+L1: not r5
+; comment
+red L0
+L2: mov L2, r4
+L3: cmp *r5, r4
+L4: clr r7
+L5: .data -651, -331, 488, -80, -189, -886, -114
+cmp L2, L556
+L6: add L1, L0
+L7: cmp r1, L1
+sub #193, L359
+L8: inc L1
+L9: prn r4
+inc *r4
+L10: red r6
+L11: dec r6
+mov *r2, *r2
+L12: lea L7, *r7
+dec r1
+L13: not *r4
+L14: stop
+L15: .string "fytuqukunbybp"
+not *r7
+lea L1, *r4
+L16: dec *r1
+inc r5
+stop
+cmp r6, *r2
+L17: clr L213
+L18: dec r7
+L19: add r6, *r5
+inc *r1
+stop
+L20: stop
+L21: .data -923, 210, -145, -923, -509
+sub #-194, *r4
+L22: .string "kibbcksjv"
+L23: lea L0, r7
+jmp L441
+L24: jsr *r5
+clr *r7
+jmp *r2
+L25: bne L0
+mov #-37, *r3
+L26: .string "hszihtmhqncamrqhpguy"
+L27: inc r6
+dec *r6
+L28: mov #40, L1
+L29: rts
+lea L17, L6
+L30: red L25
+L31: stop
+L32: mov r7, *r0
+L33: .string "szav"
+rts
+lea L24, *r3
+L34: clr *r2
+L35: rts
+not L292
+L36: clr *r6
+L37: .string "dzkaxdmk"
+L38: jsr L138
+L39: stop
+L40: stop
+rts
+mov *r0, L40
+L41: .string "ls"
+stop
+L42: dec *r3
+L43: sub *r2, r7
+; comment
+add L18, r6
+red *r3
+bne *r5
+L44: .data -324, 903, -92, 384
+L45: clr r4
+L46: clr L377
+bne L365
+L47: mov *r4, r6
+L48: .data 500, 751, -157, 232, 276, 553, -218, 403
+L49: dec *r2
+L50: rts
+L51: jmp L51
+; comment
+L52: clr L547
+L53: clr *r2
+L54: jmp *r0
+not r6
+L55: red *r2
+L56: lea L26, L236
+L57: sub L55, L41
+L58: lea L24, *r6
+mov *r2, *r0
+L59: sub #202, r6
+L60: rts
+L61: inc *r7
+L62: lea L32, L36
+L63: rts
+L64: jmp L307
+L65: red *r4
+L66: lea L490, L424
+L67: not *r4
+cmp *r3, L106
+rts
+L68: rts
+L69: mov L275, r1
+jmp *r3
+L70: cmp L60, r0
+bne L333
+dec *r5
+L71: inc L85
+L72: jsr L54
+jsr *r5
+L73: mov r3, r1
+jmp L17
+; comment
+dec r7
+mov *r7, *r2
+L74: not L62
+; comment
+L75: .string "jkmpxvxskkqoxxjxulumrbv"
+L76: mov r5, L396
+L77: sub r7, r2
+L78: not r4
+stop
+L79: jsr L21
+L80: .data -190, -797, -765, 661, 118, -529
+bne L9
+inc r3
+L81: mov *r2, L44
+prn #-33
+lea L501, *r6
+jsr *r7
+mov r5, *r7
+L82: cmp L499, L163
+clr *r3
+L83: add #-25, *r3
+jsr *r2
+L84: jsr *r1
+L85: inc *r3
+prn r6
+L86: mov #12, L40
+L87: inc L294
+prn L36
+L88: clr L247
+add L5, L50
+L89: not *r5
+L90: .data 193, 43, 992, -264, -258, 675, -689, 511
+not L1
+L91: lea L138, L463
+L92: dec L192
+clr L451
+L93: lea L42, r2
+inc r1
+not L430
+not r5
+L94: .data -76
+L95: prn r6
+rts
+L96: jsr *r5
+stop
+L97: jmp *r6
+L98: jmp *r6
+L99: rts
+L100: not *r7
+L101: jmp L25
+L102: jmp *r5
+L103: mov *r6, L46
+mov #201, L84
+lea L473, *r5
+mov *r7, *r6
+L104: not *r6
+L105: red r1
+L106: red L3
+clr L58
+; comment
+cmp r1, r0
+bne *r2
+inc L358
+L107: inc r6
+clr *r2
+L108: mov *r0, *r7
+L109: jmp *r6
+clr L14
+L110: .data 879, -367, -685, 355, -790, 614, 134, -879
+jmp *r3
+mov r2, r2
+L111: rts
+lea L104, L22
+L112: bne *r7
+clr r6
+L113: lea L103, *r4
+L114: lea L100, r0
+L115: inc L348
+L116: lea L451, L3
+; comment
+sub L60, r3
+add #128, L445
+clr L270
+L117: mov r4, r5
+L118: prn #114
+L119: jmp *r7
+L120: cmp L386, r6
+add L48, *r3
+L121: jsr *r6
+; comment
+L122: .string "tgtygbmtginc"
+L123: lea L7, L407
+not *r4
+
+L124: cmp L31, r6
+L125: .string "kusiclcp"
+sub #158, L329
+jsr L435
+L126: jsr L445
+rts
+L127: clr r3
+prn #-22
+L128: add #-66, *r0
+L129: dec L516
+L130: lea L494, r7
+sub #221, *r3
+L131: .data 979, 955, 543
+L132: add *r3, L102
+jmp L386
+not r3
+L133: .string "dlzteb"
+L134: cmp L167, *r6
+L135: clr *r5
+L136: lea L40, r3
+add #103, *r1
+L137: rts
+cmp #104, #-12
+L138: bne *r4
+dec L556
+rts
+L139: .string "irnryu"
+mov #-82, L40
+L140: jsr L460
+L141: clr L98
+L142: dec r0
+cmp #-242, #-25
+L143: .string "zowapva"
+lea L373, r3
+L144: jsr L30
+prn #-249
+jmp L489
+jsr L114
+L145: mov r1, r6
+jsr L349
+L146: prn *r2
+add *r6, r1
+L147: rts
+jsr *r5
+L148: .data 609, 931, 970, -103
+
+red L294
+inc *r6
+L149: bne L108
+L150: red r2
+L151: inc L453
+L152: stop
+cmp *r1, *r5
+sub *r5, r5
+L153: bne L548
+L154: jmp L115
+L155: .data 426, -299
+stop
+L156: lea L541, *r3
+lea L79, L123
+L157: .data 340, -719, 856, -261, 6
+jsr L331
+L158: inc *r0
+L159: .string "ndqakqlxebzhzmufnuvno"
+L160: lea L329, *r0
+L161: stop
+L162: add *r0, *r6
+L163: .string "dejfdfupfracqqj"
+L164: prn r5
+L165: prn #195
+L166: clr *r0
+L167: dec L236
+rts
+L168: dec *r2
+; comment
+L169: stop
+jsr L61
+jmp *r5
+jsr L178
+L170: .string "lhyhhshwufxkxqu"
+L171: inc *r2
+L172: cmp r6, *r6
+L173: bne L308
+jsr *r6
+L174: dec L101
+rts
+lea L309, r3
+stop
+stop
+L175: clr r2
+L176: not L163
+add #57, L531
+prn L59
+L177: lea L112, *r5
+dec L38
+cmp r7, #21
+L178: lea L9, *r7
+bne *r4
+L179: sub *r5, L370
+jsr L143
+L180: clr r0
+L181: jsr L179
+L182: cmp L18, *r1
+L183: rts
+stop
+L184: stop
+L185: add r5, L297
+L186: jmp L573
+L187: sub #64, *r5
+L188: lea L185, *r5
+L189: clr r7
+L190: sub L525, *r3
+rts
+L191: sub L3, r7
+rts
+L192: .string "lbdlp"
+L193: sub r5, *r1
+inc L281
+inc L289
+; comment
+L194: rts
+inc r6
+L195: .string "ojpbkksswi"
+mov r6, L88
+L196: lea L75, *r7
+L197: add L575, r2
+clr *r7
+L198: bne *r1
+L199: prn L50
+
+L200: dec r6
+L201: .string "rmrlcrweuhzjfvvyoniojgu"
+L202: stop
+jsr L424
+L203: sub L301, *r2
+L204: cmp L95, *r3
+inc *r3
+cmp r3, L497
+L205: mov *r7, *r6
+L206: stop
+L207: .string "byeckynjriqirfcwve"
+L208: not r6
+L209: dec *r6
+L210: mov L106, L270
+L211: add #25, L591
+clr *r1
+L212: sub *r5, *r2
+L213: inc r7
+jmp *r2
+bne L272
+L214: lea L461, *r3
+L215: bne L49
+L216: jmp L405
+; comment
+L217: rts
+L218: lea L313, *r4
+L219: bne L1
+L220: jsr L470
+cmp *r7, #177
+L221: .data 935, 162, 616, 179
+L222: jmp *r0
+L223: clr *r5
+L224: clr *r2
+bne *r2
+dec *r0
+L225: stop
+jsr *r1
+L226: .string "mrdsyldliamfeyboaliaias"
+
+L227: inc r3
+stop
+L228: dec *r4
+L229: inc L93
+L230: rts
+stop
+cmp #-92, L57
+lea L49, *r4
+L231: .data 146, -509, -589, 740
+sub *r1, L409
+L232: add L296, *r2
+mov r1, L187
+L233: dec L87
+L234: clr *r7
+L235: .string "cqsvvqkxsfeejytzuesiuudt"
+L236: red r2
+L237: rts
+not L446
+L238: jsr *r0
+lea L336, *r7
+L239: .string "cho"
+inc L485
+L240: rts
+L241: prn #176
+mov L578, L340
+L242: prn L518
+L243: dec L7
+
+L244: .string "yqbwjecsgirtdqkucc"
+L245: jmp L515
+L246: dec r7
+L247: .data 921, -604
+rts
+L248: not r7
+L249: bne L162
+L250: stop
+inc *r5
+not L537
+clr *r6
+prn #-168
+jmp *r5
+jsr L52
+L251: .data -383, -635, 380
+L252: dec *r0
+stop
+inc L564
+prn L552
+L253: red r0
+
+L254: .data -927, 342
+L255: jmp *r3
+L256: prn L500
+L257: sub L363, L59
+L258: prn r4
+L259: lea L22, r4
+jsr *r1
+L260: bne *r4
+L261: .string "erefb"
+L262: add r7, L239
+L263: mov r0, r5
+L264: stop
+mov *r4, L91
+L265: mov #141, r4
+L266: jsr L526
+sub *r4, r6
+L267: lea L441, *r4
+L268: jsr *r2
+jsr *r0
+L269: prn r3
+lea L130, r2
+L270: .data -604, 796, 575, -632, 500
+; comment
+L271: jmp L454
+bne *r0
+lea L91, *r0
+; comment
+L272: dec *r2
+L273: .string "xbhsjzzyjjcpjvsyepadthkw"
+L274: not *r0
+L275: clr L297
+L276: sub r2, *r5
+L277: add #-107, L559
+L278: add *r4, L396
+L279: .data 353, 589, -105, 500, 128
+mov L445, *r4
+L280: cmp *r1, #-1
+lea L596, *r3
+stop
+L281: clr r6
+mov L427, L425
+L282: cmp *r6, *r1
+L283: bne *r6
+L284: not *r2
+L285: stop
+L286: .string "irsygdpvx"
+L287: dec L324
+L288: mov L304, r4
+cmp L593, *r2
+L289: sub L313, L41
+L290: jsr *r0
+L291: jsr *r6
+L292: not r2
+; comment
+L293: bne L202
+jsr *r1
+prn *r7
+stop
+L294: prn L578
+L295: jmp *r3
+
+add L335, r3
+L296: .data 827, -912, -205, -500
+L297: jmp L125
+clr L526
+L298: red r2
+L299: add L513, *r4
+L300: mov *r5, r2
+L301: .data 14
+L302: bne *r0
+cmp L201, *r7
+L303: red r3
+L304: prn #195
+not L56
+add r6, *r0
+dec L114
+L305: lea L122, r5
+L306: lea L335, r7
+L307: clr L20
+L308: bne L446
+add r7, r1
+L309: red *r1
+L310: .string "spvv"
+jsr *r6
+L311: .string "ypoofzqphbiwqvzc"
+lea L300, r3
+L312: prn r0
+L313: add L245, r0
+cmp r2, #161
+sub #-237, r7
+L314: .string "qgebtp"
+dec L313
+L315: sub #-198, L284
+jmp *r2
+jsr *r2
+prn #-19
+L316: .string "cnhvrag"
+L317: inc *r5
+red L529
+L318: dec r2
+stop
+L319: not r3
+L320: mov L188, *r5
+L321: clr r3
+L322: mov r1, *r1
+L323: dec r3
+L324: jmp L261
+L325: jmp *r6
+jmp *r2
+L326: mov *r7, r0
+L327: .data -255, -418, -988, 369, 720, -832, 215, 272
+dec *r3
+; comment
+L328: inc *r2
+rts
+not L445
+L329: .data -921, -427, 540, 497
+L330: sub L564, L271
+L331: red *r1
+L332: bne *r0
+rts
+L333: rts
+L334: lea L115, L321
+L335: clr L592
+bne L281
+jmp L327
+L336: inc *r1
+L337: .string "ksdcatytiqxfxclpptxpfhia"
+L338: cmp L302, *r4
+not r5
+L339: .string "ouevegavmjvw"
+L340: cmp L477, *r4
+L341: sub L25, L489
+L342: dec *r7
+jmp *r5
+L343: cmp r6, #252
+bne L30
+red r6
+L344: add r0, L518
+L345: not L226
+L346: jmp *r6
+rts
+L347: jmp L175
+L348: .data -214, -709, 845, -461, -602, 656, 539, -679
+; comment
+L349: inc *r2
+L350: mov #-108, L435
+L351: add L469, L387
+L352: .string "fwafnhtpgfgmlm"
+L353: not L73
+stop
+L354: .data -551, 287, -770, -569
+jsr *r4
+L355: dec r1
+L356: clr *r1
+L357: dec r5
+L358: stop
+L359: .string "rahpahbfnbyq"
+L360: lea L592, r6
+stop
+cmp *r6, L174
+L361: cmp #2, L544
+red L365
+L362: jsr *r7
+L363: jsr L408
+L364: lea L193, L405
+L365: bne L145
+L366: bne L216
+jsr L424
+bne *r5
+L367: stop
+rts
+bne *r2
+L368: .string "zxezxdmurapahmdmfexq"
+not *r0
+add r6, L397
+jmp *r4
+L369: prn L257
+L370: red L333
+L371: .data 246, 200, 189, 942, -708, -528, 628
+L372: bne L258
+L373: rts
+prn r1
+mov *r3, *r1
+L374: .string "scho"
+cmp *r0, r0
+L375: mov #200, r7
+not r1
+prn #-71
+L376: .data 393, 64
+sub #-1, *r7
+L377: bne *r1
+L378: cmp *r4, #204
+L379: jmp L571
+L380: not *r4
+L381: .string "smhkjmcppmemnvep"
+stop
+L382: .data 156, 262, 98, 786, 615, -196
+L383: .string "rwwotucslysvxebnurtjyt"
+L384: .string "af"
+dec r7
+rts
+; comment
+L385: .string "hp"
+rts
+cmp #-91, *r1
+L386: prn L588
+not r0
+L387: inc *r7
+L388: prn L518
+; comment
+L389: inc L209
+jsr *r6
+L390: dec r6
+sub #32, r1
+L391: inc L566
+L392: .string "g"
+lea L262, L536
+; comment
+L393: not L58
+L394: .data -216, 102, -845, 26, -449
+mov r3, L466
+; comment
+jmp L129
+L395: jmp L354
+sub #-23, r6
+; comment
+not r4
+jsr L426
+L396: jsr L306
+cmp #55, *r0
+L397: .string "e"
+L398: mov #-256, *r1
+L399: not *r4
+L400: .string "qudeij"
+L401: .data -937, 313, -766, 559, -687, 509
+L402: rts
+L403: mov *r7, r1
+L404: jmp *r5
+L405: add r6, L164
+inc *r2
+L406: jmp L204
+L407: .string "w"
+rts
+stop
+not r6
+inc r7
+L408: .data 836, -828, -950
+L409: sub L45, *r2
+L410: jsr *r7
+not L497
+L411: jmp *r1
+L412: dec r1
+
+L413: jsr L324
+
+L414: bne *r7
+L415: .string "ddkituhmaolsebyoxattxxo"
+lea L352, L470
+dec r6
+L416: clr L437
+L417: bne L443
+rts
+inc r3
+
+L418: not L532
+add r3, L465
+; comment
+stop
+sub #-169, r0
+red r3
+lea L24, r4
+L419: jmp *r6
+L420: bne L65
+L421: red L577
+L422: .data 577, -96, -15
+L423: sub L307, r2
+L424: dec r7
+rts
+L425: .data 87, -816, 181, -249, -257, 234, 285
+stop
+L426: lea L263, *r5
+L427: jsr L489
+L428: inc L477
+L429: .string "ysjqdspjqanmgwnaznqybug"
+lea L352, r3
+L430: not L548
+dec *r5
+L431: mov #62, L481
+prn r7
+L432: lea L569, *r7
+L433: jmp L234
+L434: cmp #72, r3
+red *r2
+mov #-2, *r7
+cmp *r7, *r5
+L435: dec r4
+sub *r7, L284
+L436: sub #-222, *r3
+sub #98, L326
+rts
+L437: stop
+L438: not r3
+dec r7
+sub r6, r7
+L439: clr L359
+L440: red r2
+jmp L248
+L441: .string "yppuy"
+L442: jmp L476
+L443: prn L496
+L444: .string "qbpx"
+sub L164, r7
+lea L598, L547
+prn L62
+L445: jmp L250
+L446: dec *r5
+L447: bne *r6
+L448: jmp *r4
+L449: red r6
+L450: bne *r2
+L451: prn L281
+prn r4
+L452: bne *r3
+L453: inc r2
+jsr *r5
+add #-37, L361
+sub *r7, *r6
+L454: red *r1
+L455: add *r2, r3
+L456: sub L411, *r4
+L457: mov L533, *r2
+L458: bne *r0
+L459: sub r1, L300
+L460: cmp r1, r7
+red *r0
+L461: prn L298
+; comment
+L462: lea L471, L446
+jmp L577
+not *r7
+L463: clr *r4
+L464: cmp L530, #-131
+L465: .data -131, 949, -806, 891, 59
+rts
+jmp L479
+L466: lea L101, L543
+L467: prn #169
+rts
+red L525
+bne L592
+bne *r4
+prn L88
+
+clr *r7
+L468: jsr *r2
+L469: jmp L288
+L470: dec *r3
+L471: inc L520
+L472: add L415, *r1
+red *r5
+L473: rts
+stop
+L474: .data 343, 381, 976, 107, 638, 775
+cmp r5, #-170
+L475: cmp *r3, L279
+L476: clr L509
+L477: .string "eyvjonmjegqginnh"
+L478: jmp *r0
+L479: mov L532, *r5
+add r4, r6
+L480: sub r0, *r1
+L481: clr L493
+L482: rts
+L483: clr L590
+L484: red r5
+L485: mov *r6, r7
+
+lea L576, *r2
+clr L37
+jsr *r1
+stop
+add r3, *r7
+L486: jsr L572
+L487: dec *r1
+L488: jsr L88
+lea L571, r6
+
+L489: jmp L74
+L490: add L386, r6
+L491: .data -416, 610
+L492: rts
+L493: .string "ruymkjb"
+mov L57, *r3
+L494: cmp #-32, r4
+cmp r0, *r0
+jsr *r0
+L495: prn L136
+L496: sub *r5, r2
+red L576
+L497: not L114
+add r7, L99
+mov *r7, *r3
+L498: clr L586
+L499: rts
+L500: cmp L594, #-244
+jsr *r7
+L501: not *r7
+cmp r6, L546
+dec L40
+not L41
+L502: prn r1
+L503: .data 237, 110, -308, -958, 664, -311, -766
+L504: sub *r0, *r3
+L505: red L545
+L506: .string "ts"
+L507: add #48, r4
+L508: jsr L441
+L509: jmp *r1
+lea L544, L356
+clr *r6
+L510: rts
+red L564
+L511: red L114
+prn L531
+L512: jsr L575
+L513: mov *r7, L516
+L514: red L481
+L515: bne *r5
+red L551
+L516: sub *r7, r1
+L517: .data 370, -954, -840
+L518: red *r4
+L519: lea L592, *r5
+L520: rts
+L521: mov r6, L18
+L522: bne L150
+L523: not r4
+clr *r0
+sub L2, *r2
+L524: clr r4
+L525: .data 113, -920, 992, -592, 125
+L526: .data -330, -996, -949, -905, -78, -107, 834, 900
+L527: lea L216, *r7
+L528: cmp r4, L592
+L529: clr *r2
+L530: .data 797, 624, -745, -746, -507, -685, -451
+stop
+; comment
+cmp *r4, *r3
+L531: jmp L532
+sub #-74, L243
+L532: add r0, r1
+L533: not *r2
+L534: .string "gnxmznhk"
+jmp *r7
+L535: .data 488, 841, 529
+L536: sub r2, r6
+clr r4
+sub r3, r1
+cmp L590, L593
+L537: jsr *r3
+jsr L572
+lea L541, *r3
+L538: mov r0, r4
+prn L568
+L539: jsr L355
+L540: prn L180
+L541: red L557
+lea L60, *r3
+L542: red L587
+L543: dec L586
+L544: .data 628, 375, 695, 841, -449, 208
+L545: mov r5, L407
+L546: prn #38
+L547: lea L576, L439
+L548: not L137
+rts
+L549: prn #-171
+L550: sub *r4, L576
+L551: add *r2, r1
+L552: prn r4
+; comment
+L553: rts
+L554: mov *r1, r1
+L555: add L581, *r4
+; comment
+mov L403, r5
+L556: mov r2, *r7
+clr r5
+not L570
+L557: sub #-14, *r3
+inc *r3
+L558: lea L28, *r6
+L559: jmp *r7
+; comment
+L560: .data -399, -617, 192, -985
+jsr L392
+L561: inc L93
+jmp *r6
+L562: sub #-83, L216
+L563: .string "aqxfesn"
+L564: dec *r1
+L565: bne *r3
+L566: clr *r2
+L567: mov L572, L574
+L568: clr L529
+L569: dec r7
+clr r3
+clr L599
+L570: .string "hqrreydhenkwnopoxokzt"
+jmp *r6
+L571: dec L213
+inc L592
+sub #-208, L591
+dec r5
+clr *r2
+L572: rts
+L573: cmp #238, #164
+L574: add *r7, L23
+prn r6
+prn #104
+L575: prn #49
+L576: bne L329
+L577: jsr *r6
+L578: prn *r4
+cmp r5, r0
+add L177, L222
+L579: .string "nngdveztnrltevcaxijqo"
+L580: jmp L587
+inc r1
+L581: not *r1
+L582: .string "uayiqqeuxkpaougdhxvw"
+lea L584, L586
+L583: jmp *r3
+lea L138, L520
+L584: stop
+jsr *r0
+
+clr *r4
+rts
+lea L223, L535
+dec L66
+L585: jmp *r2
+stop
+L586: .string "wajjgooztkjatpfqh"
+L587: cmp r3, L599
+L588: red *r6
+add #-16, r3
+L589: mov r1, L592
+L590: jmp *r0
+L591: prn *r5
+red *r2
+L592: stop
+L593: .string "yyabmcjlpbyvyafnihs"
+not r5
+L594: rts
+L595: clr *r5
+red *r2
+L596: inc r7
+add L598, r4
+L597: dec L101
+L598: cmp *r2, #70
+dec *r5
+stop
+clr r2
+stop
+add *r0, L599
+jmp *r0
+L599: add L14, *r2
+prn #94
+stop
@@ -0,0 +1,1042 @@
+; Generated by genCorpus --seed 46
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+.entry L624
+L0: jmp *r1
+L1: .data 677, -935, -148, -410, -150, -130, 836
+cmp #-151, L363
+L2: mov *r7, *r1
+L3: add *r4, r2
+L4: dec L444
+lea L2, r4
+mov r3, r7
+jmp L3
+L5: inc *r0
+bne *r7
+L6: .data -885
+mov *r7, L128
+L7: bne L621
+jmp *r3
+jmp *r4
+L8: dec L1
+dec L58
+L9: rts
+L10: .string "ufuwuxim"
+dec L464
+L11: clr r2
+inc *r2
+L12: clr r3
+L13: prn r4
+L14: .data -818
+dec L262
+L15: not L508
+L16: red r0
+stop
+L17: red *r6
+not L214
+L18: clr L13
+L19: inc r5
+L20: add *r6, *r2
+L21: .data 699, -708, 334, 275, 272, 226, 486, -5
+clr L7
+bne *r6
+L22: .string "ehibubk"
+L23: prn L580
+
+bne L314
+L24: cmp #-50, #-44
+L25: inc r2
+L26: sub L254, *r0
+L27: add #-20, L306
+L28: add r3, *r7
+L29: mov L419, L29
+L30: jsr L8
+
+L31: red *r7
+L32: not L12
+L33: jsr *r7
+L34: jsr *r6
+jmp *r4
+L35: rts
+L36: cmp r1, *r4
+L37: inc *r6
+L38: jmp *r0
+sub #107, r4
+; comment
+cmp r1, *r7
+; comment
+lea L217, *r0
+clr r0
+L39: jmp L14
+L40: inc L382
+clr L35
+L41: clr L28
+prn r4
+add *r2, *r5
+L42: lea L517, L39
+L43: mov *r7, r2
+sub L4, r3
+mov r2, *r7
+L44: rts
+L45: .data 421, 236, 733, -656, -496, 972, 578
+jmp *r4
+cmp *r0, #-205
+L46: red L121
+rts
+not r7
+L47: mov *r0, r2
+L48: rts
+L49: sub r5, L392
+L50: prn *r4
+L51: jmp L527
+lea L11, *r5
+L52: sub L10, r4
+L53: add r5, L46
+L54: red L35
+L55: prn L262
+L56: jmp L6
+L57: bne *r6
+L58: sub r1, r7
+L59: bne L255
+L60: bne L49
+L61: bne *r2
+L62: sub L628, *r7
+inc r7
+jsr L67
+L63: .data -780, 8, -413, 831, -303
+L64: mov L628, *r6
+L65: clr *r2
+bne *r6
+L66: jmp L514
+inc r7
+cmp L1, *r7
+inc r2
+bne L317
+L67: jsr *r1
+inc L46
+L68: prn L68
+L69: .data 231, -833, 745, 700, 231, -393, 871, -515
+L70: rts
+L71: lea L604, *r5
+dec *r4
+not L30
+inc r0
+dec *r2
+L72: rts
+not L19
+L73: .string "trcimcrzwwxcuanpcohtv"
+L74: .data -880, -705
+L75: .string "bsijcqzi"
+L76: clr L459
+L77: red L38
+L78: prn #-213
+prn r3
+L79: rts
+L80: mov L204, L512
+L81: rts
+L82: cmp #120, L36
+L83: .data -223, -618, -674, 65, 32, -161, 242, 591
+L84: add r7, L27
+L85: sub r3, *r0
+L86: add #-144, *r6
+L87: .data -428, -155
+L88: sub L434, r3
+L89: sub r7, *r4
+add L517, *r6
+L90: sub *r7, *r0
+inc r3
+L91: not r3
+L92: add *r6, r5
+add *r3, r6
+L93: .data 596, -991, 902
+add L134, r4
+jsr L72
+L94: jmp L533
+L95: add L35, L61
+L96: bne L83
+inc r2
+L97: sub L337, L278
+L98: add #-166, L47
+; comment
+L99: .data 181, -161, 171, -788
+clr *r0
+L100: sub r1, *r3
+L101: .data -596, -49, 139, -492, 231
+L102: stop
+L103: sub L139, L88
+L104: lea L249, *r1
+inc L4
+L105: jmp *r3
+dec *r7
+L106: dec *r2
+inc *r6
+L107: rts
+L108: add *r2, r0
+L109: stop
+L110: add *r1, r0
+rts
+L111: red L233
+L112: prn #-167
+L113: .string "cotsygfvucmjjt"
+bne *r6
+L114: red r5
+lea L387, *r7
+L115: clr L107
+jsr *r3
+stop
+L116: lea L607, *r3
+
+add L89, L437
+L117: dec r1
+L118: bne *r2
+L119: mov r4, *r7
+L120: bne L473
+L121: lea L256, *r0
+L122: jmp *r5
+; comment
+L123: clr *r4
+dec r2
+
+not L504
+L124: prn #-228
+L125: jmp *r2
+L126: jsr L383
+not L240
+L127: lea L628, r3
+stop
+L128: .string "ilpz"
+L129: .data 151, -757, 452, -911, 577, -148
+add r3, *r1
+L130: not L337
+L131: .string "jfmkepdnikrccsx"
+L132: stop
+L133: stop
+not *r5
+L134: red L497
+prn *r1
+L135: clr L320
+inc L426
+bne *r3
+L136: clr L604
+L137: stop
+not *r0
+not *r6
+L138: jmp L568
+L139: not *r2
+
+stop
+L140: lea L512, r3
+stop
+L141: .data 293, 770, 278, 374, 483, -855
+sub r3, r5
+L142: lea L90, *r6
+jmp *r2
+jmp L145
+red r2
+L143: .data 613, -459, 354, 926, 168, 520, 449, 589
+L144: mov *r2, L396
+add #-94, L58
+L145: jsr L47
+clr L447
+L146: jmp L1
+
+L147: mov r7, *r7
+L148: mov *r0, r1
+L149: cmp #25, #254
+rts
+cmp r5, #-234
+clr r5
+jmp L597
+L150: mov #-53, r6
+L151: .string "niw"
+L152: inc r4
+L153: lea L59, *r6
+L154: .data 505, 406, -828, 924, 715, -812, 192, -960
+; comment
+mov L127, *r1
+; comment
+L155: .data -630, -990, -952
+L156: add *r6, *r2
+L157: bne L84
+L158: lea L206, *r5
+sub L95, L154
+L159: stop
+not *r7
+L160: prn L610
+L161: stop
+L162: not *r4
+L163: sub #42, *r1
+L164: clr *r3
+clr r3
+rts
+lea L31, *r4
+L165: prn r4
+L166: cmp r7, #5
+L167: inc L6
+L168: jmp *r6
+L169: sub *r1, *r2
+L170: .data 354
+L171: add r0, r3
+L172: not L166
+lea L418, L18
+L173: add #36, *r7
+; comment
+stop
+L174: mov *r5, r5
+L175: rts
+L176: jsr *r1
+not r4
+L177: jmp L156
+mov #170, r6
+L178: bne *r2
+; comment
+L179: .string "vfdmgzbvmhtdizjgnvk"
+L180: stop
+L181: sub r7, L14
+cmp L581, L172
+L182: add #-86, L489
+; comment
+L183: lea L329, L136
+L184: lea L429, *r5
+jsr *r4
+L185: stop
+L186: rts
+lea L177, r4
+L187: dec r2
+cmp #105, *r0
+L188: rts
+; comment
+L189: stop
+clr *r2
+L190: stop
+L191: red L180
+L192: rts
+L193: dec r2
+mov #149, *r0
+mov *r7, L85
+L194: clr r7
+L195: add r2, r2
+L196: not r4
+not r1
+L197: jsr L14
+
+; comment
+
+L198: jmp L422
+; comment
+L199: sub #2, L147
+L200: inc r4
+L201: bne *r2
+add L22, L14
+prn L118
+L202: add #202, r3
+L203: stop
+L204: clr *r4
+L205: lea L57, L337
+L206: jsr L374
+L207: red L201
+L208: stop
+L209: inc L19
+L210: clr r7
+L211: .data 158, -345, 685, -792, 156, 296, 93
+dec *r2
+red r6
+L212: jmp *r5
+L213: lea L545, r1
+jsr L9
+L214: not r3
+L215: .string "zazqjjbexpn"
+jmp L628
+clr L542
+add *r7, *r1
+L216: bne L460
+L217: cmp *r2, *r0
+L218: sub #-111, L104
+L219: jmp L48
+sub r4, *r1
+L220: clr L17
+not L243
+L221: rts
+L222: cmp L73, r1
+clr r0
+L223: prn *r5
+L224: jsr L43
+not L37
+L225: inc *r3
+prn #62
+L226: .data -400, -476, -279, 916, -974, -733, 545, 874
+clr *r0
+L227: cmp #-14, L235
+L228: rts
+bne *r0
+L229: bne *r6
+L230: red *r5
+L231: sub r6, *r6
+L232: mov r4, r0
+L233: not r5
+cmp *r1, r2
+L234: dec r2
+L235: .data -502, -969, -809, 241, 68, 366
+L236: stop
+inc *r1
+L237: bne L144
+jsr L627
+L238: stop
+L239: clr *r3
+prn *r7
+L240: red *r7
+red *r2
+L241: stop
+L242: sub L486, *r7
+L243: not *r1
+L244: jsr *r1
+L245: prn *r0
+L246: .data 88, 614, 488, 422, -43, 553
+L247: cmp *r0, L17
+L248: jmp *r2
+L249: jmp L292
+L250: cmp r5, *r2
+prn r6
+L251: inc r0
+L252: jsr *r2
+L253: .data -462, 867, 9, -741, 366, 702, -694
+L254: red *r1
+L255: jsr L7
+bne L105
+L256: .data 697, -920, 826, -855
+L257: mov r6, r2
+stop
+L258: jsr L122
+L259: stop
+L260: jmp *r2
+L261: inc *r5
+L262: add *r5, *r0
+L263: red L0
+stop
+L264: bne L502
+L265: cmp L293, L551
+L266: bne *r5
+L267: .data 20, -801, 899
+lea L175, *r2
+L268: jsr L603
+L269: inc *r0
+L270: jmp L274
+L271: jmp L283
+
+mov #-170, *r1
+L272: not r4
+L273: prn *r4
+L274: jmp *r2
+L275: not r0
+add *r4, L159
+dec *r2
+jmp *r1
+; comment
+L276: jmp L532
+L277: stop
+stop
+L278: clr r7
+L279: jmp L52
+
+cmp *r5, #82
+jmp L92
+jmp L58
+L280: prn *r1
+stop
+; comment
+jmp *r2
+dec r2
+; comment
+L281: red L250
+L282: mov r1, L81
+L283: bne L254
+L284: dec *r6
+prn *r2
+L285: not *r6
+L286: sub #52, *r7
+bne L517
+lea L438, r0
+dec r2
+inc r5
+L287: add r0, L79
+L288: clr r7
+L289: sub *r7, *r2
+L290: stop
+L291: red *r4
+L292: rts
+; comment
+prn *r2
+inc *r6
+L293: not r7
+sub r5, L438
+L294: mov L229, L616
+L295: .string "orrvbjkbrbnb"
+
+L296: sub #48, *r3
+red *r2
+L297: bne *r4
+L298: red r2
+L299: inc r5
+L300: .data -394, -160, -712, -850, -751, 371, -806, -926
+L301: add #165, r2
+L302: .data 141, -854, -366, 725
+; comment
+L303: rts
+L304: cmp L557, *r5
+L305: stop
+add r1, r0
+L306: jsr *r0
+L307: add #-85, L343
+L308: .string "dlapavg"
+L309: .data 328, 59, -572, -13
+not r1
+L310: .string "jxyfaslcemwrygcobqtdamxw"
+jmp L621
+; comment
+L311: dec *r6
+L312: bne *r4
+L313: bne L250
+L314: sub L99, *r6
+cmp L234, #-48
+dec *r7
+red *r4
+L315: lea L411, *r5
+L316: .data -872, 930, 377, -841, -738
+L317: jmp *r3
+L318: inc *r0
+L319: bne *r3
+red L565
+L320: .data -617
+not r5
+L321: mov *r5, L348
+L322: lea L214, r7
+L323: dec L274
+L324: dec L155
+L325: bne L185
+L326: add *r1, *r2
+add r4, r0
+stop
+L327: clr *r4
+L328: jsr L446
+clr L243
+L329: lea L538, r7
+L330: clr r3
+red r1
+L331: stop
+stop
+L332: red r0
+dec L52
+; comment
+L333: mov #-208, *r0
+red r7
+inc r4
+L334: .data -887, 313, -144
+L335: sub r1, r2
+L336: jsr *r5
+L337: .data -105, 905, 925, 385
+L338: lea L553, *r7
+clr *r6
+rts
+L339: rts
+sub *r4, L315
+sub r4, L247
+L340: clr L89
+L341: stop
+L342: sub r5, L370
+not r2
+L343: bne L196
+; comment
+cmp *r3, r4
+L344: .string "cxboiixmstvplmpm"
+L345: .data -428, 259, 453, -139, -232, 705
+rts
+L346: sub #-192, L249
+L347: cmp L285, *r7
+L348: mov #114, *r3
+stop
+L349: .string "jmunmfyvvibrlvqrmaq"
+red L498
+bne L605
+stop
+L350: add L99, r5
+dec L544
+jsr *r0
+L351: not *r5
+L352: prn *r3
+L353: stop
+L354: dec *r1
+L355: lea L500, *r2
+L356: .string "aoamclcdoysbcvgbui"
+L357: add r0, L55
+L358: add r2, r3
+mov r0, L561
+L359: jsr L289
+rts
+L360: inc *r0
+L361: .string "mzfodwafydybw"
+rts
+L362: jsr L133
+L363: jmp *r6
+L364: .string "otzbaxlatubzebpqebwlxo"
+not r2
+bne L436
+L365: sub #-246, r2
+L366: not L601
+jsr L154
+mov r5, *r7
+mov r0, r3
+L367: rts
+jsr L69
+prn #141
+L368: prn r4
+L369: jsr *r5
+L370: add L377, L495
+lea L129, *r1
+stop
+L371: cmp L208, r5
+L372: cmp r0, r5
+L373: prn L422
+L374: .string "g"
+stop
+L375: sub #44, *r5
+L376: inc L93
+L377: sub L411, *r5
+sub #-75, *r6
+L378: rts
+clr L152
+L379: jsr L96
+L380: jmp L506
+L381: rts
+L382: lea L279, L12
+L383: .data -251
+L384: .data -406, -331, -620, -543, 895, -544, -580, 730
+bne L408
+L385: prn #-133
+clr L78
+L386: stop
+L387: prn *r0
+clr r4
+L388: sub *r1, r7
+L389: .string "gaccavwsdlbqtzxa"
+L390: stop
+L391: add L532, r4
+bne *r5
+L392: cmp L292, #-126
+L393: .data 954, 77, 817, -54, 538, -994
+L394: red r0
+
+mov #130, r5
+L395: not *r6
+
+L396: bne *r1
+add r7, L435
+L397: dec r3
+; comment
+L398: bne L545
+jsr L496
+L399: lea L46, r1
+L400: dec L6
+sub *r5, r4
+sub *r1, *r0
+L401: rts
+L402: not L499
+dec r4
+L403: jmp *r1
+L404: mov *r7, *r0
+L405: .data -567, -850, -171, -581, -374, 78
+prn r6
+L406: jsr *r7
+mov *r5, L91
+L407: clr *r4
+L408: add #81, L608
+stop
+jsr *r2
+L409: inc r4
+inc *r3
+L410: red *r5
+jsr *r5
+L411: inc *r7
+L412: stop
+L413: sub *r5, r1
+L414: clr r3
+bne *r5
+L415: lea L512, *r1
+prn *r4
+rts
+cmp *r3, r4
+L416: .string "ayt"
+add *r4, r1
+L417: .string "n"
+dec L128
+L418: dec *r6
+L419: prn #-39
+prn r5
+lea L166, r1
+prn r1
+jmp *r7
+L420: stop
+clr L301
+L421: prn #109
+L422: clr r7
+L423: prn r4
+not L335
+L424: clr L510
+L425: cmp #155, #168
+L426: jsr *r3
+L427: cmp #70, #191
+L428: mov *r5, r0
+L429: mov #-69, *r1
+red r7
+L430: .data -137
+L431: bne *r6
+L432: red L475
+
+L433: dec *r3
+prn r0
+not r7
+L434: .data -76, -147, 411
+L435: dec L94
+L436: lea L596, L442
+mov r1, L193
+L437: .string "nslaqejgfhm"
+L438: cmp *r2, *r6
+L439: stop
+
+
+mov *r4, L602
+L440: .string "hu"
+L441: mov #38, L160
+red *r0
+L442: jsr *r5
+L443: sub *r1, *r3
+inc L572
+L444: dec L446
+not r4
+jsr *r1
+; comment
+add #-8, *r4
+L445: prn r3
+
+L446: rts
+L447: inc L474
+L448: red *r4
+clr *r3
+L449: .string "yvruwvaptzrsdcwxrps"
+not L445
+L450: prn *r4
+L451: .data -576, 815, -755, -75, -402, -27
+L452: not *r2
+L453: inc *r4
+cmp r2, r4
+L454: sub r7, r4
+L455: dec L265
+L456: not r3
+L457: sub r5, *r4
+sub r5, r2
+sub #182, *r1
+not *r5
+L458: lea L219, r4
+L459: .string "hliuqdsdlh"
+cmp r5, r5
+L460: lea L62, L475
+L461: jsr L631
+L462: add #-219, *r5
+L463: jmp *r7
+L464: stop
+stop
+L465: bne *r5
+L466: add *r2, *r7
+jmp *r1
+prn #37
+L467: bne *r2
+L468: not L278
+bne L236
+; comment
+inc L550
+L469: dec L602
+L470: sub #63, r2
+add L625, *r6
+L471: clr *r7
+L472: inc r0
+L473: prn *r4
+L474: stop
+L475: jsr L294
+L476: .string "ucqahycpmje"
+L477: rts
+L478: bne L180
+inc L548
+L479: .string "kpyytsljeqmlpnxaphkzsq"
+L480: stop
+L481: rts
+L482: clr *r5
+prn *r7
+L483: .data -120, 115, 127, -666, -480, 297, -249
+jsr L587
+L484: red L80
+L485: mov #-37, L487
+L486: prn *r2
+L487: .data -986, -294, -760, -307, -761
+L488: not r2
+L489: .string "mkw"
+L490: prn *r6
+L491: bne *r5
+not L460
+L492: mov r0, L477
+L493: jsr *r6
+bne *r2
+L494: lea L366, r4
+red L234
+L495: add *r3, L537
+inc L589
+add #-181, *r1
+L496: clr r3
+inc *r0
+red r4
+L497: sub r1, L206
+L498: not *r6
+L499: jmp *r3
+stop
+L500: not *r3
+L501: clr L296
+dec r1
+L502: red *r1
+jsr L590
+L503: cmp L418, #-221
+L504: prn #7
+L505: rts
+dec L473
+L506: prn r5
+L507: cmp #-247, r1
+L508: cmp r4, r6
+prn *r3
+
+L509: not *r1
+mov #-220, *r6
+red L579
+L510: rts
+L511: red L445
+L512: rts
+inc L267
+L513: .string "fozjfvjupcwdkqncy"
+L514: .string "xsmmhdyetqogkaegjn"
+L515: prn #240
+clr L328
+L516: lea L107, *r4
+L517: jmp *r2
+L518: jmp *r7
+add L591, *r6
+dec r3
+L519: add r3, *r5
+L520: inc L598
+jmp *r4
+L521: .string "tnepsrwysng"
+L522: prn L258
+L523: add L358, *r5
+jsr L621
+sub #94, r5
+add r1, *r5
+L524: jsr L211
+red r2
+L525: mov L566, r1
+L526: .data 881, 798, 388, -654
+L527: not L608
+clr L380
+L528: mov #-210, r7
+L529: .data 917, -299, 356, -520, -74, -410, 27
+L530: .string "yquubbwraadrddkbdainitei"
+bne L179
+dec L414
+clr *r6
+L531: mov L603, r7
+stop
+L532: rts
+L533: red r1
+inc r3
+L534: jmp L586
+L535: dec *r5
+cmp L595, #16
+prn L139
+L536: jsr *r4
+L537: lea L526, *r0
+prn *r5
+bne *r6
+L538: mov #-147, *r3
+L539: mov #126, L602
+L540: red r4
+L541: .string "z"
+clr *r2
+L542: .data 513, -806
+L543: dec *r7
+L544: stop
+add #120, *r7
+L545: stop
+inc L518
+L546: jmp *r4
+L547: prn *r0
+L548: jmp *r3
+L549: lea L273, *r5
+add L165, L622
+L550: dec L554
+
+L551: lea L560, L359
+L552: sub *r4, L599
+not r4
+L553: bne *r7
+add L573, *r3
+L554: red *r4
+L555: .data 225, 633, -862, 232, -77, 82, -140
+L556: lea L622, r2
+L557: dec L606
+L558: bne *r7
+L559: red L312
+L560: .data 158, 681, -51, 608, -157
+jmp L577
+L561: mov L229, L279
+L562: .string "nyfuidptjqmvdv"
+L563: lea L252, *r6
+L564: clr *r5
+red L172
+; comment
+L565: lea L526, r0
+lea L604, L611
+dec r5
+dec *r7
+L566: not *r6
+L567: jsr *r6
+L568: lea L569, r2
+lea L421, L602
+L569: add #233, L630
+L570: add #102, L593
+L571: prn #-92
+L572: dec r1
+L573: jmp *r0
+stop
+add L138, r0
+cmp *r4, L594
+L574: jsr L628
+L575: jsr *r0
+L576: bne L609
+prn #137
+L577: prn #37
+L578: inc *r6
+stop
+L579: jsr L604
+L580: lea L617, L610
+L581: stop
+L582: bne L603
+inc L52
+L583: lea L426, L153
+L584: not L304
+L585: inc L596
+L586: dec *r1
+L587: add r2, L597
+; comment
+jmp *r6
+add r6, *r6
+add *r3, *r3
+add r3, L425
+lea L476, *r4
+L588: prn *r1
+L589: jsr L298
+L590: mov *r0, *r0
+not r4
+not r3
+dec r3
+not *r6
+sub *r5, r5
+L591: jsr *r5
+L592: sub #-34, r1
+L593: mov #-4, *r4
+L594: add *r4, L0
+L595: rts
+mov L620, L68
+clr r0
+L596: jsr L618
+L597: .string "afvrgq"
+L598: jsr L489
+cmp r4, *r7
+L599: add #-151, L201
+L600: .data -679, 105, -200, -520, -530
+L601: dec r4
+rts
+inc L621
+red L14
+L602: .string "fyhduczaog"
+L603: add *r3, *r1
+L604: clr r7
+clr *r4
+L605: dec L612
+jmp L386
+L606: .string "zooejtjwjcryoenvuo"
+L607: jsr *r0
+lea L378, *r5
+L608: mov #-152, r4
+L609: not r1
+L610: .data 217, -695, 524, 300
+L611: jmp L135
+L612: bne *r2
+L613: stop
+L614: cmp L208, L630
+L615: jmp L620
+L616: bne *r3
+L617: .string "sovgstbsju"
+inc r7
+; comment
+L618: .data 798, -396, -22
+L619: .string "abowprgvaskktnssoyshayi"
+jsr *r1
+L620: bne L161
+L621: not r1
+L622: inc *r3
+L623: .string "ssdntitxyjzrjvfyfkwk"
+L624: jmp *r4
+jsr *r3
+L625: clr L631
+L626: cmp L627, #165
+L627: .string "oznstaijyeon"
+jsr L325
+
+mov *r4, L268
+L628: lea L93, r4
+clr *r3
+L629: .data -995, -830, 356
+L630: .data -137, 688, 528, 192
+L631: rts
+stop
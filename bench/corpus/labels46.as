@@ -0,0 +1,1041 @@
+; Generated by genCorpus --seed 47
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+add r3, L456
+sub r2, r1
+L0: dec r7
+L1: lea L1, r7
+L2: mov L0, L0
+L3: bne *r6
+L4: add *r7, r2
+L5: lea L544, r2
+L6: dec L0
+prn #-103
+inc L2
+L7: add L5, L0
+L8: dec L1
+cmp L4, L94
+L9: inc r5
+L10: mov *r4, r3
+L11: stop
+sub #215, r7
+L12: clr r1
+L13: jmp L6
+clr L498
+L14: inc L283
+clr *r3
+L15: .data 907, -414
+L16: lea L8, r7
+bne L9
+add L38, *r6
+L17: mov *r7, r3
+L18: add L587, L0
+sub *r3, L342
+L19: bne L2
+L20: mov #-232, *r6
+L21: .data 36, 555, 206, -759, -589, 379
+not *r7
+L22: inc L594
+L23: .string "hurywauyn"
+inc r7
+L24: .data 223, -285, 495, -167, -369
+L25: dec *r0
+L26: cmp L23, L8
+inc r1
+not r3
+L27: sub #184, *r7
+inc r0
+L28: rts
+L29: red L29
+L30: sub #227, r2
+L31: not L2
+L32: bne *r1
+L33: add r6, r2
+L34: rts
+L35: jmp L315
+mov #-60, L553
+L36: bne L35
+bne *r6
+bne L34
+L37: not r4
+prn *r3
+L38: prn #-20
+
+dec *r7
+not *r3
+L39: dec r0
+jsr *r5
+sub L6, *r6
+L40: red L243
+L41: mov *r3, r1
+L42: jmp *r1
+L43: stop
+L44: jmp *r7
+jmp *r7
+L45: .string "muuklpbhesaxqhyemoprevi"
+red L5
+L46: .string "kfqcmsarcewtkyrtwpmahen"
+L47: rts
+stop
+L48: sub *r4, *r1
+L49: prn L29
+L50: add #185, *r6
+prn r7
+L51: not *r5
+L52: .data 789, 547
+red r6
+mov r5, *r7
+L53: not r6
+L54: cmp L572, #-236
+jmp *r0
+jmp L227
+clr L24
+L55: not L346
+sub #103, r0
+; comment
+L56: .string "jclruxcvimwwxygyz"
+L57: bne *r1
+L58: cmp r3, #15
+clr *r7
+L59: jmp L27
+L60: inc r6
+cmp #132, *r6
+L61: dec L180
+lea L431, L310
+mov r1, L46
+L62: dec r2
+L63: red r1
+L64: .string "eyxlyjmwnyvpbbysek"
+jsr L49
+L65: .string "sglaivhdlyxhzjq"
+L66: bne *r4
+lea L60, r2
+L67: dec L64
+mov #-172, r1
+mov L596, L220
+L68: rts
+L69: .data 926, 31, 853, -150, -710, -198, -869
+L70: cmp #-135, *r7
+cmp #120, L20
+
+L71: mov L32, *r7
+L72: jmp L48
+not *r7
+clr *r6
+L73: lea L488, L28
+L74: add r3, r3
+L75: jsr L401
+L76: stop
+inc r6
+jsr *r1
+L77: bne *r2
+; comment
+L78: dec L50
+red r1
+not r4
+L79: bne L594
+L80: prn L144
+sub #197, r3
+L81: prn #-58
+L82: dec r4
+add L66, *r4
+L83: dec L419
+stop
+lea L24, L599
+L84: clr *r6
+L85: stop
+L86: rts
+not r2
+L87: clr L236
+L88: cmp #106, r1
+clr *r4
+L89: .data 171, 587, -12, -559, 219, -932, -553
+red L36
+L90: not *r7
+L91: red r1
+stop
+mov *r1, L447
+dec r4
+L92: stop
+L93: inc *r5
+jsr L244
+L94: .string "orbyuygohfrvyfty"
+L95: add #-162, L169
+L96: jmp L99
+L97: add r4, *r6
+L98: jsr L205
+L99: .data 331
+L100: cmp r3, *r2
+L101: red r2
+
+L102: rts
+dec L283
+cmp L431, *r1
+L103: .string "rxnhoibgkvzmzb"
+L104: .string "fvbazgjcuqatouvgvpht"
+L105: rts
+L106: not r4
+sub r0, r0
+L107: jsr *r4
+L108: .data 80, 942, -200, -564, 203, 978
+L109: sub *r2, *r4
+dec *r4
+cmp #148, r1
+L110: red r0
+L111: red L73
+sub L1, *r6
+clr *r6
+L112: cmp #85, L2
+dec L316
+L113: bne L69
+prn L52
+L114: inc r4
+L115: .data -619, -89, -867, -63, 8, 276, 708, -782
+L116: red *r2
+stop
+L117: add L483, r0
+lea L14, r6
+rts
+L118: cmp *r4, L92
+mov #-45, L23
+prn #-76
+L119: clr L468
+dec L145
+L120: rts
+L121: add r1, *r3
+L122: jmp L367
+L123: prn r2
+inc *r2
+prn r4
+add r6, *r2
+L124: prn *r6
+L125: jmp *r1
+dec L46
+L126: stop
+rts
+prn #107
+L127: add L64, *r0
+inc *r1
+L128: sub L59, L12
+L129: .data -743
+L130: bne *r7
+L131: sub r0, L27
+L132: cmp r6, *r5
+L133: dec r2
+rts
+stop
+L134: not *r7
+
+add *r4, L112
+L135: .string "hxshksvkncseml"
+L136: bne *r6
+L137: .string "elmfuujdivbz"
+prn *r3
+L138: lea L63, r3
+L139: jmp L89
+
+clr L95
+L140: dec *r0
+red r5
+sub L215, r2
+L141: jmp *r0
+L142: add #77, *r3
+sub #51, *r4
+L143: stop
+L144: stop
+cmp *r5, L245
+L145: jsr *r3
+L146: cmp *r0, #29
+L147: not *r5
+L148: jsr L115
+prn *r2
+L149: mov *r5, r0
+L150: rts
+L151: dec *r2
+add *r3, r3
+red r0
+jsr *r1
+L152: inc L460
+bne L140
+prn *r6
+prn L316
+L153: rts
+sub #52, L1
+lea L166, L411
+prn r1
+L154: mov #-189, r3
+L155: cmp L49, r5
+L156: stop
+L157: mov r5, *r5
+L158: clr r2
+; comment
+cmp #119, #-189
+inc L169
+L159: clr r0
+L160: jsr *r4
+add #18, L118
+L161: mov L272, r1
+mov L423, L103
+L162: rts
+; comment
+L163: red *r1
+L164: cmp #31, r6
+L165: add r0, r5
+L166: dec L271
+add L120, r7
+stop
+add L18, *r0
+not r2
+L167: .data 701, -330, 790, -88, -454
+L168: jsr *r5
+L169: .string "f"
+red *r0
+L170: bne *r0
+L171: prn #-71
+clr *r1
+bne L488
+clr r2
+dec r3
+L172: rts
+L173: inc *r7
+dec *r3
+L174: red *r4
+L175: jsr L103
+L176: jmp L296
+L177: lea L576, r4
+L178: stop
+L179: jmp L90
+L180: cmp #-8, *r0
+L181: cmp L484, *r6
+L182: jsr L85
+inc r7
+L183: stop
+sub r2, L98
+L184: clr L452
+
+jmp L512
+L185: cmp *r1, L65
+L186: dec L585
+; comment
+mov L383, *r7
+L187: sub L382, r5
+L188: rts
+L189: jsr L557
+cmp *r2, r1
+clr r1
+clr *r5
+bne *r5
+L190: lea L367, r4
+mov #-60, r7
+L191: lea L261, L172
+L192: bne *r6
+L193: .string "ewsg"
+L194: prn *r0
+
+inc L171
+sub #37, r3
+L195: prn #-130
+jsr L443
+L196: jsr L40
+L197: bne L141
+dec L70
+add r6, *r0
+prn *r1
+mov L107, L445
+
+L198: jsr *r4
+mov #47, *r3
+L199: jmp L213
+L200: add r4, L441
+L201: .string "rlxq"
+L202: add #-28, L271
+L203: inc *r0
+lea L17, *r7
+L204: prn *r1
+L205: inc r0
+L206: .data -324, 63, -550, 610, 826
+L207: add #178, r7
+inc r3
+L208: mov *r4, L447
+L209: inc *r7
+cmp #-49, *r3
+L210: .string "zxdhbz"
+L211: cmp L485, #-183
+L212: sub #64, r3
+red *r1
+L213: .data -881, -797, -174, -616
+; comment
+inc L139
+sub r3, L230
+L214: .string "tndujjauszxjec"
+L215: dec *r6
+clr *r6
+jmp L104
+L216: .data 912, 357, -154, 634
+rts
+L217: bne L116
+prn *r7
+dec r5
+L218: clr r4
+prn *r2
+not L109
+L219: cmp L160, r6
+jsr L68
+prn *r6
+L220: lea L389, L244
+L221: jsr *r5
+L222: cmp #-89, #-69
+L223: stop
+prn *r6
+; comment
+L224: jsr *r5
+L225: cmp r1, L117
+L226: lea L2, r1
+L227: stop
+L228: sub L104, r3
+L229: .data -919, 532, -539, 640, -228, 660, 357
+L230: inc L238
+L231: dec r6
+L232: not r5
+
+L233: rts
+L234: red *r1
+L235: inc *r6
+L236: stop
+jsr L168
+L237: add r0, L232
+cmp r5, *r0
+; comment
+L238: bne *r5
+L239: stop
+L240: cmp #110, r5
+stop
+L241: add #-178, r7
+add #71, *r1
+dec *r6
+rts
+L242: jsr *r3
+jsr L574
+L243: add *r1, L236
+L244: inc *r6
+L245: lea L488, L286
+clr *r5
+not *r2
+L246: jmp L129
+L247: red *r7
+L248: .string "hdnrjjnuezsfnunvuf"
+L249: dec r6
+L250: .data 860, -125, -772, -85, 887, 182
+add L401, L201
+L251: .string "dxjcbbzoshxpgbqt"
+L252: mov #-50, L280
+lea L142, L337
+L253: .string "bdawdhkairxxcdkgrdi"
+L254: dec L180
+L255: jmp L104
+sub r3, L598
+L256: dec r6
+L257: not *r1
+add r7, r6
+L258: red r3
+L259: red L142
+L260: dec *r2
+L261: red L296
+; comment
+L262: add #-8, *r4
+L263: clr L2
+jsr *r7
+prn *r6
+L264: prn r0
+L265: .string "yvwufixoijfbua"
+L266: lea L227, *r4
+L267: dec L165
+L268: stop
+L269: sub #46, *r5
+not *r6
+L270: lea L472, L215
+L271: inc L465
+L272: .data 797, -713, 979, 544, 340, -772, -397
+lea L132, r1
+lea L130, L55
+L273: clr r6
+L274: jsr *r7
+L275: lea L186, *r1
+L276: add L122, *r4
+L277: inc *r5
+
+L278: red *r2
+L279: inc *r6
+L280: clr r1
+dec *r4
+L281: .data -662, 661, 920, -692, -688
+L282: .data 680, -465, -827
+L283: red r2
+bne *r5
+L284: inc r0
+L285: add #-86, r6
+L286: rts
+jsr *r0
+L287: rts
+L288: cmp #28, r5
+L289: clr L9
+inc L0
+not L248
+clr L86
+L290: inc *r1
+L291: prn r2
+L292: add L553, L410
+L293: cmp r5, #-235
+L294: rts
+rts
+L295: mov *r7, L327
+inc *r1
+stop
+stop
+L296: mov *r1, *r2
+L297: clr *r6
+L298: bne *r3
+L299: add L79, *r5
+L300: rts
+L301: dec L346
+jsr L168
+L302: mov L61, L503
+sub *r1, L34
+L303: jmp L168
+L304: stop
+L305: .string "uhufkdblguhghyl"
+lea L521, r5
+L306: inc L204
+L307: jsr *r3
+not *r2
+L308: .string "llidooxz"
+L309: stop
+L310: clr *r1
+stop
+L311: cmp L523, r2
+L312: cmp L120, L503
+L313: cmp #-76, L222
+L314: jsr *r5
+L315: cmp #171, *r3
+mov *r3, r2
+L316: mov #133, L53
+L317: jmp *r6
+not r2
+dec r1
+lea L373, r6
+red L303
+L318: bne *r4
+sub L392, *r5
+L319: lea L127, *r6
+L320: lea L322, *r6
+
+L321: not r3
+rts
+L322: lea L336, r7
+L323: .data 678, 537
+not *r1
+jsr *r4
+not L254
+not r0
+stop
+L324: stop
+L325: bne L160
+L326: rts
+L327: cmp r3, #207
+
+; comment
+L328: .data 593, 491, 811, -334
+add *r4, *r4
+L329: cmp L527, *r0
+not *r5
+stop
+L330: lea L256, r1
+not *r6
+L331: rts
+L332: bne L237
+L333: cmp #-33, r7
+L334: mov L489, r0
+not r1
+L335: stop
+L336: red r3
+cmp *r1, r2
+clr L364
+L337: sub *r7, *r2
+L338: lea L568, L184
+L339: .data 318, 474
+L340: mov #117, r3
+L341: red *r2
+L342: add #-195, L487
+L343: dec L2
+not *r6
+L344: not r7
+L345: bne *r1
+jmp *r6
+L346: bne L488
+L347: add r0, L245
+L348: not *r3
+L349: bne L521
+L350: sub #-86, r3
+; comment
+L351: dec *r7
+L352: inc L220
+L353: bne L158
+bne *r1
+stop
+L354: .data -420, -148, 816
+L355: dec *r2
+L356: mov *r6, L118
+L357: .string "ubf"
+L358: stop
+L359: .data 686, 951, 578, 252, -206, 245
+L360: bne *r5
+; comment
+sub r6, r3
+rts
+L361: red *r6
+L362: stop
+L363: clr *r0
+; comment
+sub #-146, *r1
+sub #234, *r3
+L364: prn #85
+L365: sub *r7, r7
+; comment
+L366: jmp *r3
+L367: .string "kixsbwmmhqfwlvyiqbwhqp"
+red r7
+L368: .data 897, -987
+L369: red r5
+stop
+L370: mov L175, *r5
+L371: rts
+clr *r7
+L372: mov #-147, r5
+L373: mov *r3, L354
+L374: jsr *r6
+L375: not r0
+jsr L400
+prn r7
+bne *r7
+jmp *r2
+sub *r6, L245
+bne L284
+L376: lea L164, *r2
+L377: bne L407
+jsr L488
+L378: .data -899, -748, -117
+not L107
+L379: red *r3
+L380: prn r4
+L381: .string "cjjfccytglk"
+bne L174
+L382: bne L559
+clr L473
+L383: inc *r0
+L384: .data 850, -605, -876, -782, -68, -475, -673
+inc r4
+L385: dec r7
+prn #33
+L386: prn L266
+L387: mov L320, r5
+not *r4
+; comment
+jmp *r6
+L388: dec L326
+L389: bne L144
+L390: add L86, *r2
+prn *r1
+mov #-93, L238
+L391: .string "tpwdgzgdkjemt"
+L392: red L481
+L393: clr r6
+L394: lea L1, r1
+L395: bne L122
+L396: add r6, r4
+; comment
+L397: rts
+L398: sub *r3, *r4
+L399: jsr *r4
+L400: jmp L338
+L401: sub #54, r1
+L402: sub r0, L489
+rts
+jmp L610
+add r2, r1
+L403: .string "tawpeecgqbidwowc"
+L404: rts
+L405: bne L390
+sub *r6, r4
+L406: .data 232, -671
+L407: sub *r4, L16
+stop
+prn *r0
+L408: .string "hsxasarbf"
+L409: rts
+L410: lea L411, *r2
+cmp L508, *r6
+L411: .data -751, 580, -906, 168, 261, -242, 120
+L412: dec r1
+L413: .string "mo"
+L414: stop
+rts
+; comment
+L415: mov *r6, r0
+L416: bne L184
+mov *r6, r6
+L417: not *r6
+prn L531
+not L286
+stop
+sub *r1, *r5
+L418: mov *r5, r5
+L419: red r6
+L420: dec r3
+L421: stop
+L422: add L485, r4
+L423: jsr *r4
+L424: jmp *r6
+mov #-109, *r0
+add *r2, *r5
+jsr L571
+L425: bne *r4
+; comment
+L426: jsr *r0
+L427: .data 893, -90, -624
+L428: dec L453
+L429: rts
+dec L204
+L430: stop
+red *r5
+L431: lea L600, L345
+L432: cmp r5, L475
+
+L433: stop
+add #-101, r1
+L434: bne *r4
+L435: .data -39, 482, 125, -213, -246, -426
+L436: dec L219
+add *r7, L527
+inc r4
+L437: jmp *r7
+L438: cmp *r1, *r6
+; comment
+L439: stop
+L440: rts
+L441: jmp *r0
+dec *r3
+jsr *r1
+bne *r7
+jmp L390
+L442: dec *r0
+not *r3
+L443: jsr *r0
+prn #215
+L444: .string "kdsxtclnbskbwjqnaf"
+L445: dec r7
+red L222
+L446: mov L459, r7
+L447: stop
+L448: .data 571
+prn r1
+L449: add r1, L520
+L450: .string "t"
+L451: dec r6
+
+jmp L51
+bne L509
+L452: jmp L480
+L453: sub #136, *r3
+red r6
+L454: clr r3
+L455: prn L555
+L456: mov r6, *r2
+L457: mov #-117, *r7
+L458: stop
+cmp r1, #-221
+L459: rts
+L460: inc r7
+L461: not *r0
+L462: stop
+jsr *r2
+L463: jmp *r2
+add *r2, L485
+add r4, L138
+L464: mov *r3, r5
+red r1
+L465: .string "mivwivbzfjr"
+dec r4
+L466: not r1
+cmp L540, *r6
+L467: jmp L31
+dec L43
+L468: jsr *r1
+L469: clr *r4
+L470: jsr L563
+L471: prn L518
+L472: .data 708, 400, 765, 38, -693
+cmp *r4, L233
+L473: jmp *r6
+L474: dec L208
+rts
+L475: stop
+L476: inc r1
+L477: rts
+L478: stop
+add L71, r4
+rts
+L479: rts
+inc *r6
+not *r5
+L480: sub L545, L580
+L481: stop
+L482: rts
+L483: red L203
+; comment
+dec r5
+L484: sub #88, L76
+L485: jsr *r0
+L486: jmp L103
+add #172, L601
+L487: cmp *r3, *r2
+L488: not *r0
+cmp #-69, #66
+L489: sub r0, L339
+L490: bne *r0
+jmp *r0
+L491: not *r3
+bne L1
+L492: dec L314
+jsr L143
+jmp *r1
+L493: .data 977, -545, -24, 120, 79, 713
+L494: stop
+L495: .data 571, 360, 154, -518
+cmp r3, r7
+stop
+stop
+L496: .string "ufoxjotbv"
+inc L256
+mov *r0, L579
+bne *r7
+L497: .data 67, -425, -282, 56, -744, -801, -239, 292
+jmp *r1
+L498: rts
+cmp r5, r7
+L499: jsr *r5
+L500: .string "iqttjao"
+rts
+
+L501: .data -478, -172, 797, -334, -768, 856, -871
+L502: .data 99, -445, -125, 72, -93
+lea L400, *r6
+clr *r2
+L503: prn *r6
+L504: not *r7
+L505: .data -478, 613, -371
+mov L604, r0
+L506: jsr *r6
+
+
+mov r4, r7
+L507: rts
+not L548
+add L538, r4
+jsr L489
+L508: inc r2
+mov L177, L233
+L509: rts
+L510: .data -12, -629, -470, -167, -218, 64, -704
+stop
+L511: jmp L97
+jmp L506
+L512: inc r1
+L513: mov *r1, r6
+L514: inc *r2
+sub #57, *r7
+L515: rts
+add *r5, *r1
+L516: jsr *r1
+lea L539, *r4
+L517: .data -72, 104, 544, 498
+sub L585, r7
+L518: inc *r2
+L519: red L471
+L520: add L127, L557
+
+L521: lea L402, r1
+L522: rts
+L523: not *r2
+L524: cmp L113, r7
+dec L592
+L525: inc *r1
+jmp L540
+inc r0
+L526: .string "scxqdizcqzgyupd"
+L527: jmp *r3
+L528: stop
+L529: bne L520
+stop
+add *r2, *r3
+lea L152, r4
+L530: rts
+L531: lea L567, r3
+red *r1
+not L282
+L532: red r7
+L533: .data 839, -301, -279, -145, -179, -901
+L534: cmp L571, L420
+prn #-113
+L535: bne *r2
+L536: sub L88, r4
+bne L584
+L537: add L562, L574
+L538: red *r2
+L539: inc r4
+L540: rts
+add L574, L580
+L541: add *r1, L580
+L542: jsr L555
+mov *r5, r6
+L543: .string "wvvpljqvwcvlxkzusgu"
+L544: .string "bfjwcawvu"
+add *r6, r3
+L545: .string "dfwowugtcoxqofsqiu"
+L546: dec L578
+L547: .data -957, -510, 194, -829, 759
+L548: inc r1
+L549: red L164
+clr *r1
+L550: .data -432, 33
+add #89, L225
+L551: lea L169, L592
+L552: jmp *r2
+L553: .data -94, 931, -474, -726, -673, -133
+add r0, *r1
+sub L322, L585
+L554: red *r7
+L555: clr r7
+L556: stop
+L557: .string "wjjpddid"
+jsr L222
+; comment
+L558: bne L246
+L559: mov *r0, r0
+cmp *r0, r3
+L560: .string "vkkloozgorsuqhqbvjcqium"
+L561: rts
+L562: .string "hunorlxma"
+jmp *r5
+L563: cmp *r3, r2
+prn #65
+L564: dec *r6
+L565: dec *r7
+L566: not *r6
+L567: inc L605
+not *r2
+mov *r4, r7
+L568: prn #-11
+stop
+stop
+not L589
+red L45
+L569: mov r7, r6
+
+L570: jsr *r3
+L571: jmp *r3
+L572: inc r2
+L573: red L380
+add L593, L604
+L574: mov r5, L582
+L575: cmp *r2, #170
+L576: rts
+clr *r3
+L577: stop
+L578: jmp *r5
+L579: lea L587, r7
+L580: cmp #-202, r3
+prn r6
+L581: prn L610
+L582: jmp L593
+L583: .string "zxshvqofcygmtkmdaecpe"
+L584: rts
+L585: .data -170, 212, -393, -882, -335, -737
+L586: not r3
+L587: lea L465, L609
+L588: mov L392, L597
+L589: sub *r3, L597
+L590: not L591
+L591: mov L604, r5
+inc L604
+L592: jmp *r6
+L593: mov #82, r1
+jmp *r5
+clr r3
+red r3
+L594: add #-174, *r0
+sub r4, r2
+L595: not L602
+; comment
+; comment
+mov #157, L597
+jmp *r5
+L596: add *r2, *r4
+L597: red L608
+dec *r2
+L598: stop
+L599: cmp #-64, r4
+L600: stop
+not L608
+L601: jmp *r1
+L602: inc L72
+L603: not *r3
+
+L604: mov #-220, r7
+L605: mov #-191, *r0
+L606: .data -196, -881, -102, -662, 998, -138, 152, 403
+dec L608
+L607: red r5
+L608: clr L425
+clr r1
+prn #-54
+not L107
+L609: .string "y"
+L610: jmp L219
+stop
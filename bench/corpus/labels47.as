@@ -0,0 +1,1040 @@
+; Generated by genCorpus --seed 48
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+L0: clr r0
+red *r2
+jsr *r5
+L1: clr *r7
+L2: bne L2
+not *r1
+inc L550
+L3: mov #-46, *r4
+L4: jmp L0
+dec *r3
+L5: jsr L95
+cmp #-32, *r2
+L6: .data -878, 177, 535, -753
+stop
+L7: lea L7, r7
+L8: add L5, L2
+cmp #101, *r3
+mov *r7, r2
+
+L9: .data 658, 659, 74, -86, 91, -450
+inc r5
+
+clr L1
+L10: not r3
+jsr L1
+L11: jsr L3
+L12: bne L6
+L13: jsr L101
+jmp *r2
+L14: sub #-63, L81
+L15: dec r7
+; comment
+prn L518
+bne L2
+dec *r1
+L16: inc r3
+prn r4
+L17: stop
+L18: lea L479, L16
+lea L152, L5
+L19: inc r3
+L20: .string "p"
+inc r1
+clr r6
+L21: cmp L21, *r5
+L22: stop
+L23: lea L581, L241
+L24: .string "mnnacjlfq"
+L25: bne *r7
+L26: not r6
+L27: rts
+L28: add r5, *r2
+rts
+L29: stop
+L30: sub #-68, *r3
+L31: .data 349, 471, -30, 436, 970, -360
+L32: not *r6
+L33: red r4
+L34: mov *r2, r5
+; comment
+L35: clr L212
+stop
+inc *r4
+prn r0
+L36: jsr L323
+L37: inc *r0
+L38: prn *r6
+L39: .data -938
+rts
+add #79, r1
+jmp *r4
+jsr L587
+mov L34, r4
+; comment
+L40: .string "kihkcannwumfbcvzxba"
+clr L11
+jmp L193
+L41: clr r3
+clr *r7
+sub r0, r2
+L42: .data -990, -959, 250, -437
+L43: prn *r4
+L44: inc r0
+L45: jsr *r2
+L46: prn L242
+rts
+L47: .string "tbnvuasptfqbdufbupk"
+L48: cmp #-38, r2
+L49: jmp L11
+L50: inc L523
+bne *r0
+L51: dec *r6
+L52: inc *r5
+L53: jsr *r3
+L54: cmp #-105, r2
+rts
+L55: stop
+lea L141, L313
+L56: jsr L29
+jsr *r0
+prn #167
+L57: rts
+L58: sub *r1, L24
+L59: prn #232
+L60: bne L40
+not r6
+clr r0
+cmp *r2, r5
+L61: jmp L125
+L62: red r7
+L63: clr *r1
+L64: cmp L267, r3
+L65: red r4
+L66: dec r4
+cmp *r4, #185
+lea L335, L57
+; comment
+L67: not *r4
+L68: add *r2, L239
+L69: stop
+L70: jmp *r5
+L71: not *r2
+L72: jmp L3
+L73: rts
+red *r5
+L74: .data -816
+L75: jmp L573
+L76: .data -714, -105
+L77: not L439
+L78: inc r1
+L79: stop
+; comment
+; comment
+cmp r4, #-161
+clr r0
+cmp #172, #-76
+jmp L6
+cmp #224, L527
+L80: cmp #232, *r5
+not r1
+L81: dec L1
+L82: not *r0
+mov L227, r0
+dec L76
+L83: mov r3, *r4
+bne *r1
+L84: add #-69, *r0
+bne *r6
+L85: dec L394
+clr L39
+jsr L253
+L86: .data 631, -73, 525
+L87: add *r2, r5
+jmp L195
+L88: mov *r7, r2
+stop
+L89: add L9, *r3
+L90: prn r2
+; comment
+L91: .string "lnupkifksymiabefwznwmzf"
+L92: stop
+L93: not *r0
+bne *r1
+red *r4
+L94: jsr L342
+L95: add #88, L36
+L96: .string "ajujypecygoxshkmlax"
+L97: not L62
+L98: sub *r4, r6
+L99: bne L193
+red r1
+L100: .string "rakijmjsdzhkzlhin"
+L101: lea L237, r5
+inc *r3
+cmp #57, #68
+L102: bne L197
+L103: mov r2, r2
+L104: inc r0
+L105: lea L226, L338
+L106: .string "tzxtbeh"
+L107: jmp L596
+L108: .data -592, -610
+L109: jsr *r3
+L110: cmp #233, L510
+L111: inc L32
+L112: prn r0
+
+; comment
+L113: .string "wtfrqzp"
+L114: jmp L37
+L115: red *r0
+rts
+cmp r2, *r3
+L116: prn L214
+L117: mov #-225, *r1
+sub #-11, *r7
+L118: red *r2
+L119: lea L7, L409
+rts
+L120: not L31
+L121: sub #21, r7
+L122: sub *r0, r0
+L123: prn #-11
+L124: rts
+sub L41, *r2
+mov r2, L33
+L125: inc L157
+dec r2
+L126: rts
+; comment
+L127: red *r4
+lea L96, L557
+L128: jmp L552
+mov r3, *r1
+L129: sub L98, r4
+L130: clr *r3
+L131: rts
+L132: bne *r7
+L133: .data -880
+; comment
+L134: clr r3
+L135: .string "v"
+L136: cmp r4, *r4
+not r1
+L137: dec *r4
+L138: inc L137
+L139: dec *r7
+inc r5
+L140: cmp r2, L22
+L141: .string "nkizxynmkmsun"
+mov r0, *r2
+L142: .string "mbrrjzmucbydamncgxs"
+dec L30
+cmp *r1, L363
+L143: rts
+L144: dec L362
+rts
+L145: not r1
+L146: jsr L34
+L147: bne *r6
+L148: inc L133
+dec *r5
+prn *r1
+red r1
+L149: sub *r4, *r6
+lea L43, *r1
+L150: jmp *r3
+add L60, r1
+cmp *r3, #211
+L151: mov #95, r4
+L152: jsr *r5
+L153: red *r1
+; comment
+L154: stop
+L155: .data 375, 947, 486, 149, 590, 324, 93, 796
+L156: cmp *r5, L367
+L157: inc r1
+L158: not L94
+L159: prn *r1
+L160: not L228
+jmp L514
+L161: jsr *r2
+add #-199, r3
+cmp L47, L109
+lea L30, *r3
+L162: cmp #-38, #93
+L163: add #-231, r5
+jmp L63
+prn *r3
+L164: jsr *r1
+rts
+L165: prn r6
+L166: cmp L496, *r6
+L167: lea L310, *r2
+L168: mov r3, *r2
+jmp *r3
+L169: lea L461, r7
+not r3
+L170: .string "aqzrwkhwfmcjlqn"
+L171: cmp L566, L573
+L172: not *r6
+L173: jmp *r2
+L174: clr r3
+L175: dec r7
+L176: prn L1
+L177: stop
+inc *r1
+mov r5, L586
+L178: lea L599, r6
+dec L33
+inc L277
+L179: red L86
+L180: stop
+L181: lea L91, L162
+jmp *r2
+L182: dec L548
+L183: bne L75
+rts
+L184: red r2
+prn r4
+L185: clr *r5
+mov r5, r4
+L186: jmp L376
+L187: jsr L335
+L188: .string "sc"
+prn L427
+bne L265
+rts
+L189: jsr L229
+cmp #84, #-17
+L190: lea L138, L229
+L191: rts
+L192: add r1, *r6
+L193: rts
+red r6
+L194: lea L313, *r7
+L195: mov *r5, r4
+L196: lea L441, r3
+lea L106, *r6
+bne L187
+not r4
+L197: bne L43
+L198: jsr L12
+prn #-108
+L199: cmp #-255, L156
+L200: lea L175, *r2
+L201: bne *r1
+dec *r2
+add L29, L21
+L202: mov L78, L71
+bne L145
+add #-104, L92
+L203: sub #-75, r5
+L204: prn L52
+L205: bne *r5
+red r6
+L206: rts
+L207: clr r0
+cmp *r5, #233
+L208: prn #239
+L209: lea L56, *r6
+L210: cmp #-15, L549
+L211: bne L503
+; comment
+not L506
+lea L132, *r1
+L212: bne *r7
+L213: .data -330, 345, -252, 106, 245, -941, 636, 806
+L214: rts
+jsr *r6
+L215: bne *r4
+L216: bne L111
+L217: bne L183
+L218: rts
+not r3
+L219: clr L401
+L220: .string "hkombplddpznkq"
+L221: dec *r2
+L222: sub L408, L236
+L223: jsr L159
+L224: lea L371, r2
+L225: not L124
+inc *r3
+
+L226: inc L458
+L227: inc L14
+red *r4
+L228: not *r1
+L229: jmp L186
+L230: .string "tlojqohoqkssqqs"
+not L73
+L231: inc r1
+L232: not r3
+L233: sub L2, r5
+lea L284, L386
+red *r2
+sub #-181, r5
+L234: inc r0
+L235: sub L318, L28
+L236: lea L502, L96
+L237: dec r1
+jsr *r1
+L238: .string "ypehrgkkwwzkjbbblznzfjwu"
+lea L240, L597
+L239: add L163, *r0
+; comment
+stop
+clr r0
+L240: inc L179
+L241: jmp L445
+bne L279
+mov L9, r5
+red r2
+L242: cmp *r3, #-83
+L243: not *r0
+L244: .data 831, 903, 173
+
+not L396
+L245: cmp #-200, *r2
+L246: lea L114, *r2
+L247: jsr L371
+prn *r7
+L248: rts
+L249: inc *r2
+prn r1
+rts
+jsr *r5
+L250: .data 62, 407, 387
+L251: bne L196
+not r5
+L252: clr *r4
+L253: jsr *r2
+L254: jmp L266
+L255: jmp L349
+jmp L209
+L256: rts
+L257: cmp r1, L179
+L258: .string "okfnvkynvojlljacquszmqqp"
+L259: bne *r2
+red *r2
+L260: stop
+L261: dec *r5
+L262: .data 654, -598
+prn L347
+L263: .string "ncifnknhubarboknlyxirljs"
+L264: red *r6
+L265: lea L44, L253
+L266: sub #21, L412
+L267: mov L390, L397
+L268: rts
+inc L376
+stop
+L269: red L475
+L270: prn L492
+mov #-48, *r3
+L271: lea L187, L365
+mov *r0, *r5
+
+
+cmp *r3, #165
+L272: prn *r3
+L273: red L317
+dec L494
+L274: lea L10, L6
+sub *r1, r0
+clr *r5
+L275: .string "s"
+mov *r6, r1
+L276: cmp L424, #31
+L277: lea L178, r6
+not L525
+L278: stop
+L279: .string "zqu"
+prn r2
+sub L122, *r7
+
+L280: stop
+L281: .data -833, 368, -289, -776, -735, -355, -272, -885
+L282: stop
+L283: inc *r6
+L284: dec r7
+cmp r2, r6
+L285: jmp *r3
+L286: sub *r4, L125
+L287: cmp #-55, r0
+L288: red r2
+L289: prn #133
+L290: bne L223
+L291: clr *r0
+L292: .string "zcbpnewuewngqfgszha"
+L293: dec r7
+; comment
+L294: dec L0
+L295: cmp L19, L162
+cmp r1, *r5
+red r0
+L296: .data 739, -726, -762, 648, -524, -406, -331
+
+red *r5
+mov *r7, L243
+L297: jmp L558
+red *r0
+L298: stop
+jsr L289
+L299: not r6
+L300: sub r3, *r0
+mov #220, L417
+L301: clr r5
+lea L47, r6
+stop
+bne L350
+L302: not r5
+L303: rts
+L304: jmp *r2
+sub L65, L149
+L305: red *r4
+lea L541, *r4
+prn *r2
+L306: clr *r5
+L307: not L33
+mov *r7, r5
+L308: sub *r4, *r6
+L309: bne *r6
+clr *r6
+dec L291
+L310: rts
+L311: clr L504
+L312: inc r1
+mov L490, r4
+L313: sub L508, L177
+L314: .string "vfvszmbykithmoymqk"
+inc *r5
+L315: inc *r6
+mov #80, *r0
+L316: lea L501, *r7
+prn L70
+lea L527, L551
+L317: prn r4
+L318: .data 931, -387, 974, 389, 249, 82
+L319: inc r3
+mov r3, *r0
+L320: mov r7, r7
+L321: .data -198, -708, 519, -808, 946
+L322: sub #-165, *r6
+L323: .string "up"
+L324: prn L435
+L325: inc r0
+L326: .string "ipofsptjaohztlpxdztoo"
+L327: stop
+add r2, *r5
+L328: lea L403, r0
+cmp r6, L277
+L329: rts
+bne *r1
+rts
+L330: .data -744, -357, -332, -76, -186, 57
+L331: stop
+L332: jsr *r4
+dec L238
+L333: bne *r6
+bne *r1
+L334: clr L382
+prn L385
+L335: .data -351
+L336: stop
+prn r7
+jsr L375
+red L300
+L337: .string "pkathsmmrl"
+L338: jsr *r1
+prn r4
+L339: dec L63
+mov *r6, *r7
+L340: not L242
+L341: .data 397, 831, 567
+not L199
+L342: bne L499
+clr r4
+inc r3
+L343: inc L189
+prn r7
+dec r3
+add *r1, L368
+L344: bne *r7
+L345: red r0
+L346: stop
+L347: rts
+L348: bne *r7
+cmp *r6, r1
+L349: not r5
+prn #205
+L350: .string "prjhxtv"
+jmp *r0
+L351: cmp r2, *r3
+
+L352: bne *r4
+inc r7
+jmp L325
+L353: .data -459, 753, -222, 307
+L354: jsr *r3
+add *r7, r5
+L355: sub L504, r2
+L356: cmp *r6, *r7
+L357: mov r0, L383
+L358: lea L137, r7
+L359: lea L410, *r0
+jmp L596
+L360: mov *r6, L582
+not L345
+L361: bne *r2
+L362: red r3
+not *r5
+L363: not r3
+add L110, r4
+L364: add #55, L520
+L365: clr r1
+L366: .string "nnicwjwkf"
+
+L367: sub #28, L222
+L368: rts
+L369: clr L109
+L370: stop
+L371: bne *r0
+L372: jmp *r7
+L373: dec r4
+red *r6
+L374: cmp r0, *r0
+L375: mov *r7, r2
+L376: .string "dumuuokfvhgxugicujjn"
+L377: bne L158
+L378: add *r0, *r3
+clr r3
+L379: stop
+cmp #169, *r6
+L380: .string "cfnngecxkeynjsj"
+L381: inc *r5
+L382: .string "uivxvonugieqymsvc"
+
+stop
+inc *r1
+
+L383: .data 91, 707
+L384: jmp *r7
+L385: stop
+L386: jsr L316
+mov r2, L156
+L387: cmp *r3, #-59
+L388: stop
+L389: .data -422, 866, 653
+prn *r7
+cmp r2, L215
+; comment
+L390: rts
+L391: rts
+L392: lea L287, r5
+L393: lea L591, r5
+L394: prn *r1
+L395: clr L380
+L396: sub #46, *r0
+mov #-88, r3
+L397: inc r6
+rts
+jmp L440
+L398: add #-121, *r2
+L399: lea L575, *r7
+L400: stop
+cmp *r7, #107
+cmp #-82, #231
+dec L588
+L401: mov L102, r2
+rts
+L402: stop
+not L545
+L403: .data -158, -81
+red L233
+lea L444, r4
+L404: lea L359, L262
+bne L281
+; comment
+L405: not r6
+L406: inc r4
+L407: lea L198, *r3
+L408: .data 815, 173, -602
+jsr *r2
+red L509
+L409: rts
+dec *r4
+L410: lea L507, L297
+L411: dec *r2
+L412: stop
+red *r0
+cmp #-195, L155
+prn *r0
+L413: not r1
+bne *r2
+not r5
+L414: .data 436, -780, -118, 337, -828, 242, 169
+L415: .string "bwipcemogcdtzlomxkga"
+L416: prn L456
+L417: mov L588, L599
+L418: .string "yvfokgd"
+L419: rts
+L420: clr *r3
+L421: red *r1
+clr *r6
+bne *r7
+L422: jmp *r7
+mov *r5, r0
+inc L188
+L423: .data -55, 387, 737, 38, -986, 965, 310
+
+L424: inc L390
+L425: sub r5, r5
+L426: dec r3
+L427: stop
+L428: not *r0
+L429: jmp L529
+bne L76
+inc r4
+L430: jmp L446
+L431: clr L489
+add L507, r6
+L432: add L598, r0
+L433: .data 700, -623, 366
+rts
+L434: not *r3
+prn *r2
+L435: red L465
+L436: stop
+L437: not r7
+dec r2
+L438: clr L495
+jsr L452
+
+red *r1
+L439: stop
+L440: .data 651, 775, 958, 917
+L441: clr L576
+L442: jsr *r0
+L443: .data -284, -811, 918, 774, -974, 337, -626, 58
+L444: clr r6
+jsr L71
+jmp L407
+stop
+sub r4, L21
+stop
+L445: cmp #186, r7
+L446: .data -995, -421, -790, 297, -239, 697, 266, -197
+L447: bne L148
+red r3
+L448: add L243, L506
+rts
+; comment
+L449: clr *r7
+L450: bne L266
+L451: jmp *r7
+L452: jmp L355
+red *r6
+L453: .data 301, -443, -575, 212, -746, 171
+L454: .data -864, 539, -624, -661, -836
+mov #-93, r6
+stop
+L455: sub L117, r4
+jmp L559
+L456: jmp L489
+sub #-120, r6
+L457: .data 429, 120
+L458: prn #151
+L459: .string "iiiwlfasvmtyoiyrobasxjvz"
+not L369
+not L573
+L460: not L578
+L461: stop
+not r3
+L462: add L520, r5
+not r4
+L463: rts
+L464: add *r2, L561
+mov r1, r6
+inc r6
+L465: .string "tysymzhyldffg"
+inc *r0
+dec r3
+dec *r3
+L466: bne L169
+cmp #-27, L207
+bne L484
+inc *r5
+clr r7
+L467: inc L585
+L468: lea L538, *r5
+add L174, L53
+L469: prn L172
+L470: jsr *r5
+not *r4
+L471: add #143, r7
+rts
+L472: jmp L101
+L473: jsr L564
+L474: not r4
+mov *r4, L352
+L475: inc L486
+L476: .data 139, 466, 149, -621, 871, -278, -482
+L477: .string "rhefnzjazpf"
+cmp r0, *r7
+
+dec r6
+
+; comment
+L478: mov r1, L567
+L479: dec *r4
+L480: mov r0, L62
+clr r0
+L481: clr r1
+L482: lea L205, r4
+red L560
+L483: bne *r3
+L484: .data -601, -713, -433, 651, 632, -816
+L485: dec *r0
+add *r1, r4
+L486: prn L495
+sub L116, r4
+mov r7, *r7
+L487: add #116, r6
+L488: bne L100
+L489: dec L549
+inc *r1
+red r2
+L490: sub #-111, *r2
+L491: .string "b"
+dec *r7
+L492: prn L84
+L493: not *r5
+not r4
+add *r1, r0
+L494: .string "wrvxwzkzdk"
+red *r4
+L495: .data 445, -21
+L496: add *r2, *r3
+; comment
+bne L512
+stop
+L497: inc r3
+L498: prn L326
+L499: clr L469
+L500: red *r5
+bne *r2
+L501: jmp L517
+L502: red L580
+L503: clr r3
+L504: clr L190
+L505: mov L194, L435
+mov #-194, *r7
+
+; comment
+lea L167, *r3
+L506: .data -311, 186, 543, -79
+L507: lea L175, *r7
+L508: sub #-204, r6
+L509: cmp #-89, *r5
+L510: jmp L64
+bne *r7
+L511: lea L539, *r6
+L512: jmp *r2
+L513: jsr L435
+L514: .data 727, -108, -152
+red L539
+L515: jsr *r6
+L516: bne L588
+L517: clr r5
+L518: red *r7
+L519: inc r3
+L520: .data -504, 996, -745, 503, 210, 722, -389, -152
+L521: dec r5
+L522: rts
+clr *r3
+cmp L71, L536
+L523: jsr L552
+L524: .data -975, 161, -91, 643, 825, -983, 598, 560
+L525: rts
+not L261
+L526: .string "ucupcriipgl"
+jsr *r1
+lea L188, r4
+L527: sub #-248, r0
+L528: clr r2
+L529: sub r5, *r6
+L530: rts
+; comment
+L531: .data -700, 450, 499
+inc L491
+L532: prn L598
+L533: sub #-195, r6
+L534: lea L582, *r3
+L535: bne *r1
+jsr L574
+L536: mov *r0, *r0
+L537: cmp r5, L542
+L538: red *r4
+L539: jsr *r7
+L540: prn *r7
+sub r0, L592
+bne L379
+sub *r1, r6
+L541: sub r2, L242
+L542: mov L508, r3
+L543: red L553
+clr *r5
+L544: .string "opatamdnazt"
+mov r2, *r7
+L545: mov *r3, L551
+L546: stop
+L547: lea L553, r3
+not L425
+red *r4
+dec *r3
+
+L548: stop
+L549: stop
+L550: .string "ulnajlmamrijc"
+L551: not L590
+lea L76, *r3
+L552: dec L470
+L553: prn r1
+stop
+L554: dec *r3
+L555: .data 430, -74, -430, -471, -52, -360, -352
+L556: jsr L588
+L557: stop
+L558: stop
+jmp *r4
+L559: red *r4
+L560: bne *r2
+L561: .data -776, -582, -894, -926
+red L593
+L562: .data 97, -891, 450, 228, -507, 502, 775, -897
+mov L599, *r3
+clr L573
+jsr L589
+cmp r7, r2
+L563: add L585, L379
+L564: rts
+L565: clr *r6
+L566: .data 818, -823, 665, 861, -899
+L567: .data 667, 437, -377
+lea L506, *r5
+lea L457, *r0
+L568: jsr *r5
+inc L589
+L569: dec L570
+mov *r0, r2
+L570: not *r0
+add *r5, *r5
+L571: clr *r2
+clr r4
+; comment
+L572: jsr L597
+red *r6
+L573: rts
+add r3, L60
+rts
+prn r3
+L574: .string "zvvz"
+L575: inc *r4
+stop
+L576: jsr L596
+L577: not *r7
+not *r6
+clr L404
+stop
+cmp r3, L590
+L578: inc r2
+add #-208, *r2
+cmp #-237, L364
+not r4
+L579: lea L286, *r1
+L580: jsr *r4
+L581: .data 829, 696, -108, 497, 385, 889, -487, -814
+L582: stop
+red *r5
+lea L451, L546
+L583: clr *r7
+add *r1, r3
+lea L591, r7
+; comment
+prn *r3
+L584: add r6, L69
+clr L592
+L585: dec *r6
+L586: red L592
+L587: not r0
+L588: bne L465
+L589: cmp L594, *r5
+lea L204, *r0
+L590: mov *r5, L215
+prn #-180
+L591: stop
+dec *r7
+bne *r2
+not *r4
+L592: stop
+L593: add r7, *r5
+L594: .data 210
+L595: rts
+jmp *r6
+L596: rts
+stop
+add #62, *r7
+inc *r2
+lea L599, L598
+L597: cmp *r5, *r3
+jsr L598
+lea L599, *r5
+prn r4
+add r3, L598
+lea L599, r6
+bne *r1
+L598: .string "oolcfjhbbxmmycj"
+L599: prn *r3
+rts
+stop
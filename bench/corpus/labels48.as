@@ -0,0 +1,1041 @@
+; Generated by genCorpus --seed 49
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+L0: red L10
+bne L545
+dec L0
+L1: add r2, *r3
+clr r3
+sub r1, L401
+L2: jsr L2
+L3: prn *r7
+rts
+L4: clr *r7
+L5: inc r1
+bne *r4
+L6: red *r6
+rts
+L7: not *r1
+L8: not r6
+cmp L1, r6
+; comment
+; comment
+L9: add *r2, L5
+L10: not r3
+L11: jsr *r3
+L12: .data 914, -60, -365, -467, 237, 793
+prn #169
+L13: not L10
+L14: rts
+clr L14
+bne L74
+prn *r5
+
+; comment
+L15: not r1
+jsr *r7
+bne *r6
+L16: stop
+lea L2, L194
+L17: add r2, L16
+lea L15, *r4
+L18: sub *r7, L5
+L19: rts
+L20: dec L12
+inc *r7
+not *r5
+cmp *r5, r4
+L21: not L57
+lea L10, *r7
+not r7
+L22: inc L324
+inc r4
+L23: prn r5
+L24: bne *r7
+L25: add #-241, L513
+rts
+L26: jsr *r0
+rts
+L27: sub *r4, L2
+L28: sub L2, *r4
+bne L599
+inc L338
+mov L25, L15
+inc r4
+L29: lea L354, r2
+L30: .string "e"
+; comment
+rts
+L31: stop
+L32: jmp L269
+L33: bne L31
+L34: not L63
+inc L412
+L35: red r1
+L36: bne *r5
+L37: .string "wysihjuhhehbfvhixlhio"
+bne *r7
+L38: stop
+L39: jsr L2
+clr r7
+L40: .data -186, -388, 920, 977, -690, -524, -355, 386
+L41: bne L25
+L42: not *r6
+L43: jsr *r2
+L44: clr L13
+stop
+bne *r0
+clr L20
+L45: .string "ncbxhjofjmt"
+L46: prn r7
+L47: clr L192
+L48: add r3, L27
+
+L49: sub #-132, *r0
+not r5
+stop
+; comment
+dec r6
+prn L35
+L50: sub *r6, r1
+L51: sub L69, L149
+; comment
+jsr L30
+L52: dec L27
+L53: inc r3
+L54: jmp L14
+jsr *r2
+not L19
+red r7
+L55: .data 874, 646, 435, 689, -330
+L56: inc r7
+cmp #116, r5
+rts
+L57: mov #119, *r1
+L58: inc L462
+prn r3
+
+inc *r2
+inc L43
+L59: jmp L114
+rts
+L60: not *r3
+L61: inc L103
+lea L92, r4
+L62: add r5, r1
+
+L63: inc *r6
+cmp *r1, r0
+L64: prn r2
+cmp *r1, r1
+add r0, L359
+L65: cmp *r0, L142
+L66: sub L127, *r1
+L67: red L590
+red *r7
+L68: prn r0
+dec r1
+bne L42
+lea L50, L541
+L69: jsr L59
+mov *r5, r2
+L70: sub #-174, r7
+L71: red *r3
+clr *r1
+prn r1
+L72: jsr L308
+L73: jsr *r3
+L74: lea L161, r2
+L75: add #27, r1
+L76: mov *r6, r1
+L77: prn r4
+add #-127, L566
+L78: clr *r4
+L79: lea L40, *r1
+L80: not L64
+L81: jmp *r6
+cmp *r6, *r3
+cmp L65, *r5
+jsr *r2
+L82: rts
+L83: .data 874, 746, 804, -114, -295, 675, 322
+L84: .string "mraccgxseeixkoikijinrpnu"
+L85: dec r5
+L86: .data 737, 517
+lea L26, *r5
+L87: .data -970, -245, 824
+L88: bne L75
+L89: .string "hdaixyrqggeqzcg"
+L90: dec L41
+L91: sub #156, *r1
+jsr *r4
+L92: clr *r7
+L93: inc *r0
+L94: not r3
+L95: cmp L16, r0
+L96: not r5
+inc r6
+L97: .data 480, 716
+L98: .string "vapapfeyoizk"
+L99: lea L516, *r7
+L100: jmp *r5
+L101: sub L59, *r0
+L102: .data 275, 534, -670
+L103: inc *r2
+L104: dec r5
+L105: sub #-204, L73
+L106: red *r6
+jsr L68
+L107: stop
+L108: mov *r6, r1
+bne *r3
+L109: cmp r1, r2
+L110: jsr *r0
+clr L185
+; comment
+L111: not L90
+L112: rts
+sub r2, L46
+rts
+; comment
+rts
+L113: jsr L227
+not *r1
+
+L114: stop
+L115: .data -890, 480
+L116: sub #-176, *r7
+L117: jmp L17
+L118: jsr *r4
+
+sub #233, L53
+L119: lea L85, L267
+jmp *r3
+rts
+stop
+L120: stop
+L121: jmp *r4
+L122: .data 781, -746, -407, 295, 549, -27, 419
+add *r7, L475
+L123: bne L401
+L124: .string "ftnyco"
+clr *r1
+L125: .data -901, 912, 667, -852
+L126: sub #165, L530
+L127: cmp L442, *r4
+sub L517, *r2
+red r3
+L128: .data 766
+L129: jmp L496
+L130: .string "ofjyjnrwqryime"
+L131: not *r1
+L132: .string "qoictayfhag"
+L133: clr L85
+L134: lea L424, r5
+
+L135: mov r7, *r5
+L136: inc r7
+L137: mov #120, *r2
+L138: bne *r7
+L139: red L6
+L140: jmp L470
+L141: stop
+L142: .string "bqcgf"
+L143: .string "htexrpbwwwgquwctijrvhez"
+lea L137, r3
+dec L303
+not r1
+L144: .data 680, 87, -180
+L145: prn *r6
+add r1, r6
+L146: prn *r5
+L147: lea L547, L336
+red *r3
+prn *r1
+
+L148: lea L140, L142
+L149: clr r7
+L150: sub #248, *r4
+L151: stop
+; comment
+L152: dec L138
+L153: clr L124
+L154: mov *r4, r1
+L155: lea L257, r5
+L156: .data 700, 992, -924
+lea L152, L46
+L157: prn r7
+L158: .data 726, -811, 942, -634, 728
+L159: sub #-145, r4
+L160: bne *r4
+stop
+L161: bne L596
+L162: not *r7
+L163: bne L138
+L164: red *r7
+L165: inc *r2
+L166: jsr *r2
+rts
+L167: inc L301
+add r7, r5
+L168: mov r2, *r0
+mov *r0, *r1
+cmp #-40, L403
+L169: not r2
+L170: clr *r1
+bne L412
+jmp *r1
+L171: rts
+jmp L27
+L172: rts
+jsr L598
+inc r3
+L173: clr r5
+L174: prn L51
+L175: jsr L108
+lea L315, *r3
+clr *r0
+L176: dec r4
+clr L209
+bne *r3
+lea L17, r6
+add *r3, *r1
+L177: dec r6
+L178: clr r6
+L179: cmp r7, *r5
+L180: clr L350
+L181: stop
+L182: inc r7
+L183: .data -866, 70, 31, -303, -743
+L184: clr *r2
+L185: cmp r3, #154
+L186: prn r4
+cmp #73, r5
+L187: .data 533, -13
+L188: inc *r0
+
+L189: inc L361
+L190: .data -451, 646, 819, -189, 347, 593, 517, -886
+L191: clr r4
+L192: bne L368
+inc *r0
+bne *r6
+not L552
+L193: jsr *r6
+L194: jsr *r2
+clr L576
+lea L461, L246
+L195: jsr *r4
+lea L405, r7
+lea L174, r3
+dec r0
+jsr *r1
+L196: mov L12, *r7
+L197: inc *r3
+L198: .data -390, 28, 72, -382, 112, 651, -95, 247
+L199: bne L32
+L200: .data -456, -417, 447
+L201: jsr *r5
+L202: dec *r3
+stop
+L203: jmp *r7
+L204: dec L89
+bne L97
+cmp r3, *r2
+stop
+L205: add L437, r3
+L206: prn *r4
+L207: .data 903, -942, 722, -84, 330, 408
+L208: rts
+L209: .data 782, 981
+lea L97, L152
+L210: .data 945, -840, -780, 752, -841
+L211: prn *r6
+L212: stop
+L213: jsr L330
+cmp #5, #113
+rts
+L214: mov #116, *r7
+L215: red r0
+sub L32, *r4
+L216: jsr *r0
+L217: not L110
+sub #-12, L12
+L218: sub #109, r7
+L219: mov #50, *r4
+bne L455
+L220: clr L158
+L221: prn L558
+L222: .string "ohrvslftpazad"
+L223: cmp *r6, r5
+L224: sub r4, r1
+L225: lea L356, r6
+L226: not r7
+L227: .data 762, -45, -700, 16, 139, -143
+L228: lea L55, r3
+L229: .data 680, -546, -973, 357, -868
+jsr L201
+L230: inc *r3
+L231: not L189
+L232: .string "pzpgw"
+L233: sub L595, r0
+jmp *r4
+L234: cmp L242, #247
+L235: prn #-21
+L236: jmp L377
+L237: mov r2, *r2
+L238: prn *r0
+not L482
+jmp L205
+L239: bne *r0
+L240: inc *r4
+L241: stop
+L242: add *r2, L312
+
+L243: prn #-229
+L244: .data 154, -183
+clr *r7
+L245: .data 512, -79, 670, 435
+jmp *r4
+; comment
+L246: .data -380, 318, 90, -902, 942, -570, -658, -303
+L247: inc *r1
+L248: red r7
+L249: mov r1, L510
+L250: not r7
+L251: red L162
+L252: prn r6
+L253: cmp *r6, #196
+jmp L385
+
+L254: lea L108, *r2
+L255: cmp r4, r0
+L256: jsr L456
+L257: bne L454
+L258: .string "jeptx"
+L259: add L400, L255
+L260: lea L31, L53
+rts
+rts
+lea L93, r4
+L261: red r7
+L262: .data 17, 818, -774, 722, 102, 698
+bne *r6
+L263: sub r5, *r2
+cmp r2, r3
+prn L526
+bne L31
+L264: .string "yqf"
+L265: stop
+L266: clr *r6
+L267: cmp L174, L398
+; comment
+L268: bne *r6
+L269: jmp L97
+L270: sub r3, r6
+L271: cmp *r1, #131
+L272: lea L603, r6
+clr r0
+L273: add L55, *r0
+L274: stop
+L275: jmp L609
+L276: .string "mupaepevcenzl"
+L277: dec *r4
+L278: mov #-74, *r2
+L279: bne L495
+L280: red r7
+L281: not r2
+; comment
+L282: .data 277, -614, -624, -526, -764, -12, 705, -70
+L283: dec r2
+stop
+L284: not L97
+cmp L376, L233
+bne L371
+cmp #-135, L69
+L285: lea L27, r7
+L286: clr *r0
+jmp *r7
+L287: cmp r5, L556
+dec *r4
+bne *r1
+mov #224, *r0
+cmp r0, #238
+not *r2
+L288: cmp #153, #-155
+L289: clr L325
+dec *r0
+L290: red *r2
+L291: sub L119, L155
+rts
+stop
+lea L143, r5
+clr r1
+jmp *r1
+L292: .data -662, 475
+lea L438, L326
+L293: dec L529
+L294: prn r6
+L295: .data -212, -555, -928
+add r3, *r6
+L296: clr r3
+lea L513, L478
+L297: clr L150
+L298: bne *r4
+L299: prn *r6
+L300: .data -625, -10, 557, 553, 96, -270, 716
+L301: dec *r5
+L302: .string "phqu"
+
+
+jmp L399
+mov r7, *r7
+; comment
+; comment
+L303: .string "pxqhkbravqhxvy"
+L304: clr *r1
+add r2, *r1
+dec r1
+cmp #-46, r7
+mov #-245, *r7
+not L449
+L305: .string "rszugzkgjtfypibjjszvf"
+L306: not r3
+sub *r2, L161
+bne *r5
+L307: prn *r2
+L308: .string "raqqqyhfqfbddbzuqzktkje"
+L309: stop
+mov r5, L169
+L310: bne L457
+L311: jsr *r4
+L312: mov L547, *r2
+L313: stop
+L314: dec *r1
+L315: jsr *r7
+L316: jmp L68
+L317: stop
+L318: stop
+L319: jsr *r6
+L320: add L408, *r7
+L321: mov r5, L276
+clr L448
+L322: jmp *r3
+L323: inc r2
+stop
+L324: stop
+L325: red *r2
+L326: lea L155, L616
+L327: .data 860, -236, 659, 734
+jmp *r1
+L328: jsr *r1
+L329: lea L241, L88
+
+L330: bne L75
+L331: not *r4
+add #-252, *r3
+L332: dec *r7
+cmp #-229, *r6
+inc L495
+L333: rts
+jmp *r4
+dec *r2
+L334: bne *r0
+L335: cmp r7, L525
+L336: red *r5
+L337: .string "o"
+L338: add L91, L209
+L339: lea L271, r5
+L340: inc *r0
+L341: cmp #-133, *r2
+rts
+jmp L130
+L342: lea L192, L533
+stop
+L343: .string "thmikmqoprjis"
+L344: .data -107, 159, 133, -92, -139
+lea L111, r4
+L345: dec L518
+dec r7
+L346: inc *r4
+L347: rts
+L348: cmp r7, #-213
+cmp r0, L464
+L349: prn *r2
+cmp L492, L608
+L350: mov *r6, L440
+L351: .string "dzoasekrpcctp"
+L352: not *r1
+; comment
+L353: bne L391
+prn L369
+L354: cmp *r4, r7
+inc r3
+L355: lea L579, *r2
+L356: stop
+sub #-90, r2
+cmp r3, r2
+
+L357: mov r5, *r7
+L358: jsr L166
+L359: .string "fcys"
+
+
+L360: add *r7, L424
+L361: clr r4
+L362: inc *r1
+lea L386, *r0
+L363: inc r5
+bne L577
+
+L364: not r7
+dec *r4
+L365: add L485, *r1
+
+stop
+L366: .data 177, -166, -589, 428
+; comment
+jsr L412
+L367: .string "qdli"
+L368: rts
+mov L442, r0
+L369: lea L315, *r7
+L370: .string "lvtpinwjtnbkxuupstetttq"
+red r3
+red L109
+stop
+jsr *r5
+red L181
+prn r6
+jmp *r4
+L371: mov #211, *r4
+sub L535, r5
+L372: bne L613
+dec L45
+rts
+jsr *r5
+L373: .data -728, -490, 450, 410, -617, 860, -898
+L374: add r0, r5
+jsr *r3
+L375: cmp #135, #107
+L376: mov L423, r1
+L377: dec *r6
+L378: .string "xrnyvdqwohv"
+L379: .data 993, 679, 370, 471, -797, 688
+L380: stop
+L381: jsr *r7
+cmp #-156, #112
+clr r4
+L382: inc r1
+L383: lea L358, L233
+L384: .string "ffvizckzelfxphxi"
+L385: red L296
+L386: sub *r0, *r1
+L387: .data -864
+mov L77, r2
+L388: inc *r2
+sub #163, *r2
+rts
+L389: rts
+L390: lea L528, r0
+L391: mov #129, r1
+L392: bne *r0
+L393: jsr L478
+L394: add #-208, L329
+L395: lea L351, r1
+L396: dec *r4
+cmp L558, L495
+jmp *r0
+sub r3, r0
+jmp *r3
+L397: clr r1
+L398: sub L510, r4
+L399: dec r1
+red *r3
+dec r5
+add #29, *r1
+L400: bne L54
+clr r2
+L401: .data 752, 682, 973, -737, 847, 119, 908
+not r2
+sub L254, *r4
+
+L402: red *r7
+L403: .data -8, 59, 294, -930, 954
+L404: stop
+L405: mov L616, r4
+L406: prn r4
+L407: .data 468
+stop
+L408: .data 99, -492, 141, 299, 917, -713, -73, 292
+L409: jmp L125
+L410: rts
+not *r2
+inc L477
+cmp L531, r6
+prn #100
+sub r4, L507
+L411: .string "xvnijiffrdgqdbviox"
+L412: prn #-23
+L413: bne *r5
+L414: sub *r4, L486
+L415: clr L158
+L416: rts
+L417: .string "vyfupztzoqqnbohd"
+L418: jsr *r6
+L419: sub #24, r7
+L420: cmp L604, r7
+L421: mov *r2, L600
+L422: jmp L89
+L423: prn L514
+L424: .string "gcvmanwpnglg"
+jsr L410
+L425: inc L566
+add *r1, L163
+L426: bne L532
+L427: stop
+L428: bne L265
+L429: jmp *r0
+L430: .data -306, -895, 595, -663
+L431: not *r1
+add #-167, L471
+L432: jsr L38
+L433: rts
+dec *r1
+L434: rts
+L435: stop
+L436: bne *r4
+L437: clr L181
+L438: not r4
+L439: cmp *r6, r7
+L440: clr L443
+L441: bne *r6
+L442: add r4, *r0
+L443: clr r6
+L444: jmp *r3
+add L357, L211
+; comment
+mov #-191, *r6
+mov r3, *r5
+lea L84, r1
+L445: sub r2, r1
+cmp *r0, L451
+stop
+L446: rts
+rts
+clr L452
+dec r7
+L447: stop
+jsr L616
+bne *r1
+L448: lea L505, L291
+L449: jsr L616
+L450: jsr *r0
+L451: cmp L140, #-229
+L452: .string "xhdu"
+add r6, L518
+L453: cmp L430, #-7
+L454: jmp L334
+cmp #194, #122
+rts
+L455: .string "qackbfzsmyklwkwudlyev"
+L456: clr r3
+
+
+L457: clr *r0
+L458: add #-238, L495
+dec *r4
+L459: lea L484, r3
+stop
+L460: jmp *r2
+L461: red *r3
+prn *r7
+L462: .string "irrjvsplavwsocow"
+L463: add *r0, r6
+sub L494, *r3
+L464: stop
+L465: sub r0, r2
+L466: cmp r1, L539
+L467: add #116, L323
+
+L468: rts
+L469: add r0, L473
+L470: red *r3
+L471: rts
+L472: sub *r7, L424
+L473: inc L524
+lea L519, L526
+inc L427
+L474: .data 119, -900, 751, 712, 31
+L475: stop
+L476: .string "sbswvhzgt"
+L477: lea L318, *r5
+L478: stop
+L479: lea L349, r4
+clr *r5
+L480: rts
+L481: dec *r6
+L482: add r2, L491
+L483: bne L567
+L484: not r7
+L485: jsr *r5
+; comment
+L486: prn #-78
+L487: jsr *r5
+L488: jmp *r0
+clr *r7
+
+L489: red *r1
+L490: jsr L527
+not r3
+inc L110
+L491: not L364
+L492: bne L604
+L493: .data 830
+L494: cmp #49, r4
+L495: red *r1
+L496: red *r6
+L497: clr r6
+L498: bne L346
+add L382, L390
+L499: mov *r3, L438
+sub *r4, r6
+prn L485
+cmp #248, #205
+dec L139
+mov #138, r0
+cmp r7, L130
+L500: jsr *r7
+L501: rts
+L502: .data 225, -647, -662
+bne L554
+L503: dec L598
+L504: dec L583
+L505: mov L520, r7
+L506: mov L298, *r0
+sub #50, *r1
+clr *r6
+L507: cmp r2, L610
+L508: clr L480
+L509: stop
+jsr L375
+L510: dec r6
+inc r3
+L511: .string "fxgq"
+L512: lea L600, L281
+L513: add L7, r2
+add L609, r3
+L514: dec r5
+L515: .data 564, -398, 882, 804, 188, -340
+; comment
+L516: cmp *r6, L578
+L517: rts
+L518: .string "ip"
+L519: .data -857, -11, -51, -436, -941, 659
+not r1
+L520: .string "wfmuqzbsnydiayfmbeqjiaz"
+; comment
+L521: stop
+lea L297, L547
+L522: cmp r0, *r6
+; comment
+red *r7
+clr L607
+L523: lea L600, *r3
+prn L610
+L524: not r4
+L525: .data 657, -426, -563, 547, 397, 407, 718
+L526: .data -679, -454, -275, 831, -486
+L527: rts
+L528: red L564
+jmp L42
+L529: .data -243
+add L606, r0
+mov #-81, r3
+L530: .data -653, 197, 405, -647, -644, 547, -722
+cmp #221, r4
+L531: prn L399
+L532: not r5
+L533: add r7, *r5
+L534: rts
+L535: jsr L568
+L536: inc L339
+L537: red r6
+not L617
+L538: jsr *r2
+dec *r4
+L539: clr *r3
+L540: mov #183, L559
+L541: add #247, *r3
+sub L430, *r5
+L542: bne L73
+L543: mov *r5, *r6
+L544: .data 469, -524, -741, -712, 860, -382
+L545: clr L458
+L546: red *r7
+; comment
+L547: .string "antcnuiijtpznlhaarwrhs"
+bne *r1
+dec r3
+clr L561
+cmp *r7, #-126
+L548: jmp L590
+L549: mov *r3, L338
+L550: stop
+prn r1
+jmp L585
+prn L527
+L551: inc *r4
+L552: clr L24
+L553: .string "unhrnqmmf"
+cmp L587, r0
+L554: rts
+inc r5
+rts
+rts
+inc *r1
+cmp r0, *r6
+L555: add r6, r4
+L556: .string "rglsmtxhfikjrsrdkoxfd"
+rts
+L557: sub #80, L603
+L558: rts
+L559: mov L157, *r4
+L560: lea L382, *r7
+L561: .data 993, -796, 635, -743, -692, -850, -830, 591
+mov L99, *r1
+L562: inc L71
+L563: .string "c"
+stop
+bne L539
+L564: rts
+add *r1, L127
+; comment
+L565: not *r5
+not r7
+L566: dec *r0
+L567: rts
+stop
+L568: clr r4
+L569: .data -547, 585, -279, -12, -230
+L570: add r3, *r5
+L571: lea L596, *r5
+L572: red *r4
+L573: prn r0
+L574: mov r0, L585
+L575: .string "myjtfvhxegnpd"
+mov #85, L596
+
+; comment
+L576: add *r0, r2
+not *r5
+L577: .string "yti"
+L578: inc *r1
+jsr *r2
+L579: clr L587
+not r5
+L580: .data -709, -870, -19, -568
+L581: rts
+L582: lea L606, *r4
+L583: bne *r4
+
+jmp *r6
+L584: mov L614, *r1
+L585: prn #-67
+red *r4
+cmp *r6, *r5
+L586: .data 72, -94, 663
+add #213, L294
+L587: .data 518
+L588: inc *r4
+jsr *r1
+
+L589: cmp #250, *r2
+mov *r5, L514
+L590: mov *r3, *r2
+sub L523, r1
+L591: prn r0
+jmp *r7
+L592: bne L177
+L593: clr r2
+L594: clr L227
+L595: .data 697, -615, -184, 971, 779, -171, -80, 879
+dec L597
+cmp *r2, *r1
+bne L605
+L596: red *r0
+L597: sub *r7, L31
+dec L600
+red *r0
+add #244, *r2
+prn r2
+mov L258, r5
+clr *r6
+L598: stop
+L599: red r5
+
+inc r2
+sub L610, L161
+L600: .string "tydrualnnjbocmeitbgaiyy"
+L601: cmp r6, #-183
+L602: lea L613, *r3
+L603: sub L180, L607
+L604: mov L606, *r2
+L605: stop
+clr L608
+mov *r2, r4
+L606: add L615, *r3
+L607: stop
+L608: add r0, L617
+L609: not r4
+dec r0
+dec r2
+L610: lea L237, *r7
+L611: jmp L70
+stop
+rts
+L612: jmp L103
+L613: not *r7
+L614: add L617, *r3
+L615: rts
+L616: mov r0, r6
+cmp *r4, L382
+L617: bne L90
+stop
@@ -0,0 +1,1040 @@
+; Generated by genCorpus --seed 50
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+L0: jmp L242
+L1: mov *r7, *r3
+L2: .data -364, -355, -719
+jsr L0
+L3: .string "qgbelyffoigtvtprpeppc"
+L4: rts
+L5: add #132, L506
+L6: stop
+L7: not *r1
+L8: stop
+L9: sub *r2, *r0
+bne *r3
+L10: red *r3
+L11: cmp *r7, *r5
+L12: cmp r1, L11
+L13: lea L264, r0
+L14: add L126, *r7
+L15: prn r6
+bne L244
+L16: inc r1
+L17: bne *r4
+L18: bne *r5
+sub #149, L4
+L19: .string "vqs"
+L20: bne L16
+L21: lea L3, L7
+
+add *r5, *r3
+add *r4, L333
+L22: dec *r3
+L23: cmp r5, L364
+L24: not L123
+L25: inc L511
+L26: clr *r7
+L27: .string "lww"
+L28: .string "ssepbntvevsmmzbqu"
+lea L145, r1
+L29: not *r2
+prn r1
+sub L178, L3
+L30: stop
+L31: add #-11, *r4
+prn #-204
+L32: red L526
+L33: red r1
+L34: not r0
+L35: .string "ckzyyphqjkupyqlzuvnf"
+L36: dec *r4
+not r5
+L37: .string "nwqxchnfadpcezzgo"
+L38: red *r5
+L39: .string "yduyhcqnnlbyyzzjaopjfoox"
+L40: rts
+L41: rts
+L42: stop
+L43: not r4
+bne *r2
+cmp *r6, *r5
+
+stop
+L44: bne *r7
+L45: red *r2
+sub #-101, L436
+L46: jsr *r0
+L47: sub L418, L297
+L48: mov r0, *r3
+jsr *r7
+L49: mov r0, L508
+bne L60
+inc r4
+L50: .data -177
+L51: sub L10, *r5
+bne *r1
+clr r0
+jsr L162
+bne L27
+L52: .data 935, 744, -935, 825, -601, 821
+L53: prn #-79
+L54: lea L161, *r0
+L55: jmp *r7
+red *r2
+rts
+L56: lea L64, L209
+L57: clr L236
+cmp L88, *r0
+L58: rts
+L59: red L29
+L60: add *r6, L0
+L61: not r2
+L62: .data -242, 373, 392, -802, 578
+L63: dec r5
+L64: add r5, L56
+jsr L221
+prn L59
+red *r5
+L65: .data 45, -810, -793, 886, -245, 890, 887
+L66: cmp L9, L29
+sub #-141, r3
+L67: rts
+L68: sub L156, L535
+rts
+clr r3
+mov #126, L5
+L69: jmp *r5
+L70: sub *r0, L325
+L71: clr L380
+L72: rts
+L73: lea L5, *r0
+L74: clr r4
+jmp *r3
+; comment
+mov #-194, *r3
+L75: jmp L50
+L76: rts
+L77: .data -822, -128, 940, 293, 668
+L78: clr *r7
+red *r7
+L79: jmp *r6
+L80: jmp *r1
+bne *r2
+mov *r2, *r0
+L81: clr r1
+L82: lea L36, *r5
+L83: rts
+L84: cmp #-14, r3
+lea L8, L22
+L85: prn L57
+L86: .string "rkeygrn"
+
+L87: .string "rmk"
+L88: clr r5
+prn L42
+dec r6
+L89: prn #5
+L90: stop
+dec r6
+L91: .string "apbsbshqacvpmon"
+L92: rts
+cmp L189, r5
+L93: add L203, L77
+L94: lea L323, L452
+rts
+L95: dec *r1
+L96: .data 269, 985, -108
+red *r2
+jmp L483
+add r7, L96
+L97: jmp *r7
+mov L54, L25
+red r2
+L98: .string "pifjiuy"
+L99: dec *r5
+L100: prn r4
+L101: .data 794, 815, 509, 340, -521
+L102: .data 684, -352, -738, -355, 384, 609, -294, 332
+L103: sub r6, r6
+L104: jsr *r6
+rts
+L105: .data -263, 452, -926
+L106: rts
+not r0
+not *r1
+jsr *r6
+L107: clr *r2
+stop
+L108: clr r3
+red r5
+L109: cmp *r2, *r6
+L110: stop
+L111: rts
+prn r4
+L112: clr *r7
+inc L40
+red r1
+cmp #239, #-2
+L113: lea L487, *r3
+L114: .data 845, -66, -937, -71, 867
+L115: jsr L78
+; comment
+L116: jmp L3
+L117: dec r7
+bne L19
+L118: inc L96
+L119: .string "rnxy"
+add *r2, r5
+
+add #-117, *r2
+L120: lea L34, r7
+sub L46, r0
+; comment
+
+L121: .string "pxqsq"
+add *r0, L585
+L122: prn #230
+L123: .string "iokeurhslgg"
+L124: dec L56
+L125: sub #-36, L58
+L126: prn #-78
+inc r6
+bne L43
+
+not *r6
+L127: stop
+L128: jmp *r4
+L129: jsr *r3
+add #-9, *r4
+L130: clr *r5
+L131: jsr L11
+L132: .data -859
+L133: inc L545
+sub *r1, L329
+L134: jsr L569
+L135: rts
+L136: bne L25
+L137: prn *r3
+clr L123
+L138: mov r3, *r4
+L139: jmp *r7
+prn *r5
+L140: sub r0, *r7
+L141: .string "koe"
+L142: cmp *r5, #-79
+bne L20
+bne *r2
+clr r5
+L143: prn L92
+L144: .data -607, -323, -707, 773, 903, -357, 917
+lea L546, r4
+L145: stop
+L146: red L101
+add #-102, *r4
+prn L114
+L147: stop
+L148: lea L131, L297
+L149: lea L170, r0
+L150: .data 619
+L151: bne L226
+L152: red *r0
+L153: .string "qhsfsguzsb"
+L154: stop
+L155: .string "mqejmnpmxnwii"
+L156: dec *r4
+L157: sub #6, *r6
+L158: add L180, r7
+L159: jmp L399
+L160: .data 760, 924, 18, 976, 145, 76
+L161: .data 934, -418, -500, 823, -246, -132
+; comment
+; comment
+lea L154, *r7
+add #92, r3
+L162: prn *r6
+jmp L569
+rts
+L163: .string "tyce"
+not *r6
+L164: not r0
+red *r5
+L165: add *r0, r6
+L166: jmp L513
+
+cmp L108, *r6
+not L434
+L167: sub #177, *r6
+L168: .string "uqopugzfnkmxmvkjyaog"
+L169: prn #183
+L170: mov r4, L119
+bne L15
+L171: clr *r5
+L172: red r3
+L173: stop
+red *r2
+not *r5
+inc L212
+L174: cmp L278, r5
+L175: dec r6
+dec r6
+L176: .string "xnzztzcikavsmiyruh"
+prn L156
+sub *r1, *r5
+L177: lea L55, *r5
+prn r7
+jmp L14
+L178: prn *r1
+jsr *r0
+L179: clr *r0
+L180: red r6
+; comment
+bne *r0
+rts
+L181: mov L243, *r2
+; comment
+L182: sub L86, L476
+L183: rts
+
+rts
+L184: mov r5, r5
+L185: clr r5
+jsr *r4
+rts
+L186: sub #185, r1
+L187: red *r1
+L188: jsr L420
+not r7
+L189: prn *r2
+L190: clr r7
+L191: jmp *r2
+L192: .data 400, -994, 894, -154, -718, -508
+L193: rts
+cmp #-54, L561
+L194: add *r0, *r1
+L195: .string "tgzp"
+L196: rts
+sub L154, L61
+dec *r4
+L197: not r5
+dec L98
+inc L226
+sub #146, r6
+bne L181
+dec r0
+L198: jsr L147
+jmp L284
+L199: stop
+; comment
+dec L149
+jsr L79
+L200: add #1, L266
+L201: jmp L117
+L202: .string "ijdbox"
+inc r4
+jsr L123
+rts
+L203: sub L453, r2
+L204: jsr L61
+add #-104, *r4
+L205: dec r6
+L206: clr L542
+L207: bne L352
+prn r2
+L208: add *r1, r5
+L209: lea L20, L180
+jsr *r6
+L210: add *r5, r1
+L211: mov *r7, r3
+L212: lea L204, L307
+add r0, r4
+L213: rts
+L214: prn L388
+lea L54, r4
+; comment
+L215: rts
+L216: inc L81
+add #-5, r1
+L217: rts
+L218: bne *r0
+L219: mov *r2, L439
+rts
+bne L166
+cmp *r5, *r2
+L220: .data -716, 29, -794, -949, -410, 0, 961
+clr *r5
+L221: rts
+; comment
+L222: prn #178
+jsr L188
+L223: prn L307
+L224: clr L193
+not *r0
+L225: bne *r0
+L226: jsr *r4
+L227: .data 703, -598
+inc r4
+dec L112
+L228: inc L472
+L229: cmp r5, r0
+mov r5, *r2
+mov L213, r5
+L230: jmp L181
+L231: bne L362
+L232: add L592, r4
+L233: lea L538, *r0
+add L507, L61
+L234: mov *r4, *r4
+prn *r0
+
+clr r0
+; comment
+L235: stop
+L236: dec r6
+
+jmp L190
+L237: dec r1
+clr r3
+; comment
+L238: red r6
+L239: mov r2, L532
+L240: inc L97
+L241: jsr *r7
+mov *r5, L141
+L242: dec r6
+dec *r3
+L243: cmp #171, L589
+add *r3, r2
+L244: lea L521, *r2
+L245: rts
+
+inc r3
+stop
+stop
+dec r5
+L246: .data 166, 359, 425, -47, 180
+L247: stop
+L248: inc r5
+; comment
+jmp L150
+L249: not r3
+bne L75
+L250: cmp r6, L163
+
+sub *r4, *r7
+L251: add #-29, *r0
+L252: cmp #204, #211
+L253: add *r0, r3
+stop
+red L542
+stop
+L254: lea L89, r7
+L255: bne *r1
+L256: bne L237
+not L161
+L257: red L355
+mov *r2, L302
+L258: prn #65
+L259: .string "ddltfehmfgwiyno"
+L260: jmp *r6
+L261: jmp *r6
+rts
+lea L243, L372
+L262: bne L176
+L263: .string "ziggektueosgvdeejphou"
+L264: jsr L201
+bne *r7
+L265: dec L302
+L266: clr *r6
+prn r5
+stop
+L267: dec *r3
+inc r7
+not *r3
+add r6, *r0
+lea L227, r1
+mov #230, L486
+; comment
+
+inc r6
+red *r0
+L268: not r0
+L269: cmp L204, *r2
+prn L274
+rts
+L270: clr *r6
+lea L274, L50
+L271: lea L78, *r1
+L272: bne L25
+lea L34, *r7
+
+L273: mov *r0, r5
+L274: rts
+sub r7, *r2
+L275: not *r6
+dec r7
+jsr L146
+add r1, L163
+; comment
+L276: jmp L84
+inc L147
+L277: .data 508
+prn *r4
+L278: stop
+L279: mov r1, r3
+L280: not L362
+add #-214, L484
+L281: inc L409
+bne L311
+L282: not r5
+jsr *r5
+red *r6
+L283: mov #197, L454
+L284: not L255
+cmp L242, L508
+L285: .data -191, 4, -909
+L286: add #137, r7
+L287: mov *r1, *r4
+L288: cmp r2, L204
+mov *r1, L15
+L289: .data -841
+prn #216
+stop
+red r2
+jsr L178
+L290: red *r4
+dec L390
+jmp *r1
+jsr L51
+prn #-130
+cmp r6, *r4
+sub L151, r7
+L291: cmp L295, #110
+L292: rts
+jsr L390
+L293: rts
+L294: .string "hnbcfpklvdcfwvcg"
+L295: add *r6, L127
+L296: not L475
+L297: clr *r1
+sub #154, L441
+L298: jsr *r0
+L299: not r6
+add r5, *r4
+prn #123
+L300: rts
+L301: .data 772, 595, -857, 724
+L302: .data 817
+jmp *r5
+sub *r3, *r2
+bne *r2
+rts
+L303: jmp *r7
+jmp L181
+L304: prn *r1
+L305: cmp L163, *r1
+inc *r6
+L306: stop
+red *r2
+red r7
+L307: cmp #40, #-184
+rts
+sub r5, L2
+inc r3
+L308: not L268
+L309: sub #18, r0
+L310: jmp *r5
+L311: sub L593, *r0
+L312: clr L87
+L313: add *r4, r7
+stop
+L314: prn *r5
+L315: red L456
+L316: cmp *r7, L502
+L317: mov L485, L50
+L318: sub L162, *r0
+sub #102, *r3
+
+dec L536
+stop
+L319: prn r2
+L320: lea L184, r4
+prn r1
+cmp #-198, L166
+L321: clr L82
+L322: jmp L529
+L323: sub r1, L400
+L324: red *r0
+L325: lea L452, L547
+L326: cmp L576, r7
+dec r7
+L327: red r5
+L328: red r0
+L329: .data 122, 330, -66, 85
+clr L112
+clr L519
+cmp L432, L348
+L330: sub *r7, *r7
+L331: clr r5
+L332: stop
+L333: bne L275
+L334: not *r5
+L335: mov #-143, *r3
+L336: sub *r5, L69
+L337: rts
+L338: clr r1
+
+L339: red r2
+add r7, r6
+L340: prn *r5
+add *r1, r1
+L341: cmp r0, *r5
+L342: jmp *r4
+cmp *r6, L199
+L343: rts
+L344: bne L177
+red *r6
+L345: rts
+L346: sub L51, r7
+red L88
+L347: jmp L69
+L348: not *r6
+L349: jsr L399
+jmp *r6
+jsr L481
+L350: .string "gaurtfxvvosiltzcyesf"
+L351: jmp L580
+L352: add *r2, *r6
+L353: inc *r7
+L354: not r0
+dec L147
+red *r1
+cmp r5, *r4
+jsr *r7
+sub #-34, *r1
+stop
+L355: .string "adaqwpzutofzul"
+L356: stop
+L357: .string "rtpecpzk"
+mov r4, r0
+L358: mov r6, *r3
+L359: dec L38
+sub L163, r4
+jsr L554
+L360: .data 447, 94, -232, -839, -414, -416, -217
+not *r7
+L361: add *r5, *r4
+L362: .string "htzatkabtaeuy"
+dec *r6
+prn *r5
+L363: prn L276
+L364: jsr L554
+L365: not *r6
+prn *r2
+L366: add *r7, *r0
+sub L274, *r7
+; comment
+L367: stop
+jmp L361
+L368: sub L476, *r5
+stop
+L369: rts
+L370: add #-136, r6
+dec r6
+L371: red r1
+L372: stop
+L373: clr L449
+L374: jmp *r4
+L375: rts
+stop
+; comment
+L376: rts
+L377: rts
+not *r4
+; comment
+not r2
+L378: .data -799, -84, -829, 521, 838
+L379: clr *r1
+L380: stop
+add L447, r6
+L381: inc *r1
+sub r1, r4
+jsr *r5
+L382: inc L301
+L383: inc *r5
+stop
+add r3, r5
+L384: mov L178, r3
+sub *r1, r7
+rts
+L385: jsr *r0
+L386: red L433
+L387: .string "yltfmbkkjhqncjggaujna"
+L388: .data 503, 592, -998, 942, -720, 920, 237
+L389: .data -993, -539, -427, 728
+add *r5, L408
+L390: sub *r7, L535
+jsr *r5
+L391: mov r4, *r1
+L392: cmp #125, #-46
+dec r2
+inc L329
+rts
+bne L376
+L393: jmp L19
+L394: mov L475, *r1
+L395: mov L426, r7
+inc *r0
+jsr *r0
+inc *r3
+L396: inc *r6
+L397: jmp *r0
+L398: rts
+L399: add r5, *r6
+dec r1
+L400: .string "ks"
+
+L401: .data 579, 865, -685, -486, -277, 386, -413
+; comment
+L402: clr r2
+L403: sub L125, *r2
+prn #132
+L404: dec *r3
+L405: dec *r3
+L406: mov *r7, *r3
+L407: rts
+L408: stop
+L409: not L549
+L410: .string "vzqz"
+cmp r6, r3
+not L361
+L411: red *r7
+L412: not *r1
+not r4
+bne L571
+L413: red *r0
+bne *r4
+add #-32, L137
+not *r3
+L414: .string "ryxwtztkyesvjfyt"
+add L237, L36
+
+L415: .string "iscr"
+L416: not *r2
+L417: sub *r1, r3
+L418: add r7, L121
+mov #-39, *r1
+L419: .data -702, -225, -465, 643, 538, 705
+L420: clr r3
+L421: mov #-218, r2
+L422: dec L522
+; comment
+L423: jmp L382
+red r3
+L424: prn L333
+L425: red *r3
+prn *r5
+L426: lea L581, r5
+L427: rts
+L428: red *r3
+L429: rts
+L430: .data -971, 940
+jsr *r5
+mov L23, *r6
+L431: mov *r7, *r2
+bne L445
+L432: jsr L131
+red *r0
+L433: cmp *r7, r6
+red r6
+
+L434: jmp *r3
+L435: bne *r4
+L436: mov r0, *r7
+; comment
+L437: sub L360, L486
+bne *r1
+rts
+L438: .string "ggzxwug"
+L439: red L349
+clr *r5
+red r6
+L440: .string "pfxtssky"
+L441: clr r2
+L442: jmp *r2
+cmp *r1, *r7
+not L269
+L443: mov #-3, L350
+; comment
+mov L505, *r4
+L444: rts
+sub *r2, r4
+stop
+L445: inc r2
+L446: jmp *r7
+L447: bne *r4
+L448: add #219, *r1
+L449: not *r5
+L450: rts
+L451: clr *r4
+L452: sub #192, r0
+L453: inc r2
+stop
+L454: add *r4, *r2
+bne L578
+L455: sub L259, *r6
+L456: mov #-114, L108
+stop
+L457: lea L50, L560
+cmp *r7, L496
+inc r7
+rts
+clr L239
+rts
+L458: lea L544, r4
+L459: stop
+L460: red *r4
+L461: lea L575, r6
+lea L415, r1
+L462: jmp *r7
+L463: dec *r5
+L464: red r0
+dec *r6
+L465: prn r0
+L466: cmp r1, L506
+mov *r2, r6
+jmp *r0
+L467: mov #145, L546
+
+jmp L497
+cmp r0, r0
+L468: rts
+lea L232, L481
+L469: inc *r0
+L470: jmp L477
+L471: jsr L348
+L472: jmp L523
+L473: .string "vkemsufiz"
+L474: clr L310
+L475: lea L554, L546
+bne *r6
+jsr *r6
+L476: .data 400, -986, -387
+L477: rts
+not L485
+L478: mov #-88, *r2
+prn *r5
+L479: clr L319
+L480: bne L367
+L481: lea L19, r5
+L482: mov L483, L540
+dec L483
+L483: sub #-160, L486
+L484: red L86
+clr *r2
+red r4
+L485: not L361
+add #-72, L490
+lea L470, r6
+L486: stop
+L487: jsr L575
+not L169
+L488: mov L325, *r1
+mov #86, r5
+L489: .data -462, 444, 353, -574, 741, -240, -502
+L490: clr *r1
+bne L336
+L491: sub *r3, *r0
+L492: red L517
+L493: sub *r6, *r2
+L494: stop
+L495: .string "nojczdmqigyucte"
+L496: .data -291, -102, -207, 92, -194, 614
+jsr L323
+L497: lea L491, r3
+L498: mov L538, *r7
+L499: cmp *r4, *r0
+
+L500: cmp *r0, r1
+mov #95, *r0
+L501: stop
+bne L76
+bne L586
+; comment
+L502: mov *r2, L316
+L503: .data 720, 306, -104, 253, -433, 599, -156
+
+L504: jmp *r4
+bne *r4
+L505: rts
+
+L506: sub #238, *r0
+L507: lea L500, *r3
+
+L508: .data -914, -869, 924
+sub *r5, L529
+L509: stop
+L510: not r2
+L511: .data -145, 382, 608, 350, 375
+L512: add r3, L554
+L513: stop
+L514: clr *r3
+L515: lea L543, L551
+L516: .data -608, -127, -299, 959
+
+L517: dec *r0
+inc *r6
+bne *r2
+L518: bne *r0
+L519: clr *r3
+L520: sub L343, r5
+
+L521: jsr L501
+
+L522: lea L579, r4
+L523: .data -321
+L524: mov r0, *r1
+L525: sub *r6, L102
+
+L526: mov *r1, *r7
+L527: stop
+L528: sub *r2, r6
+L529: dec r4
+L530: not L575
+L531: cmp r5, L217
+rts
+L532: prn L583
+add #-115, L572
+L533: prn #148
+red L432
+L534: not L220
+red *r7
+dec *r6
+jsr *r7
+mov #-1, r1
+L535: cmp L352, r7
+L536: red *r0
+L537: add #225, r2
+L538: .string "hqwqspwuiwuc"
+cmp r3, #5
+L539: stop
+jmp L429
+L540: bne L592
+L541: bne *r2
+L542: cmp *r5, L446
+L543: stop
+L544: dec *r4
+L545: stop
+not r3
+L546: mov #158, *r3
+
+L547: .string "ojhosudev"
+L548: inc *r4
+L549: prn r0
+L550: .data 151, 280
+cmp r6, L338
+cmp #30, *r0
+L551: clr *r2
+lea L584, r0
+L552: prn #-203
+L553: rts
+L554: rts
+L555: jmp *r0
+L556: .string "oidnycceoa"
+L557: .string "rowwmazkiopyosqvlbtqn"
+sub #34, *r7
+L558: mov r0, r1
+bne *r4
+L559: not r5
+L560: inc r5
+L561: add #133, *r2
+; comment
+L562: prn *r0
+prn r5
+L563: rts
+L564: dec *r1
+L565: bne L578
+L566: stop
+L567: .string "gokmrqclmjojy"
+L568: lea L591, r4
+red r6
+lea L403, r0
+L569: jmp L578
+stop
+L570: lea L239, L335
+stop
+L571: prn *r1
+L572: cmp #236, #225
+jsr L76
+L573: cmp *r5, r1
+L574: stop
+prn #144
+mov *r2, r1
+clr *r4
+mov L502, r1
+L575: clr L185
+L576: jsr L584
+L577: jsr L81
+L578: jsr L557
+L579: prn r5
+L580: sub r3, r5
+rts
+L581: dec r4
+L582: .data 370, 753, 852, 433, 386, 646, 43
+L583: cmp *r1, #130
+L584: inc r4
+L585: prn L255
+L586: .string "tkazgidjpzkpknbsai"
+L587: clr r7
+dec L592
+L588: not r2
+L589: red L593
+L590: jmp *r0
+L591: bne *r7
+mov L597, *r2
+L592: clr L597
+L593: jmp L0
+L594: .data 730
+add #180, L595
+L595: lea L597, r4
+cmp L277, *r6
+L596: cmp #-226, #-104
+L597: .data -17, 149, -709
+red *r3
+stop
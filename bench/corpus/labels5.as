@@ -0,0 +1,1042 @@
+; Generated by genCorpus --seed 6
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+.entry L624
+L0: bne L0
+bne L498
+; comment
+L1: red L424
+L2: dec L206
+stop
+cmp *r1, L2
+L3: red *r4
+L4: mov #-152, L0
+L5: not *r7
+L6: bne *r6
+sub L334, *r3
+L7: .string "wd"
+red L4
+lea L2, r6
+clr L4
+L8: clr r6
+L9: not L2
+L10: .string "nmdaqhuotkzyzuhx"
+L11: mov r7, r7
+L12: .string "yucfqvruyu"
+L13: inc L607
+L14: not L229
+L15: cmp #-23, #103
+not r6
+clr L13
+L16: stop
+bne *r7
+L17: lea L9, *r0
+L18: red r2
+add *r6, *r4
+L19: jmp *r5
+L20: rts
+rts
+red L9
+L21: clr *r2
+mov L35, *r2
+L22: .data 57
+rts
+L23: lea L8, *r2
+L24: prn r0
+clr L20
+L25: .data 945, 621, 545, -142, 988, -230, -865
+L26: stop
+not L538
+lea L254, r0
+L27: dec L577
+L28: jmp L18
+red L4
+L29: lea L8, *r4
+rts
+mov *r0, r7
+L30: red *r6
+clr L340
+L31: mov L440, L10
+L32: .string "bqrolpgvaxctnztwxgxo"
+L33: bne L399
+L34: jsr L33
+L35: prn L370
+L36: lea L492, *r1
+stop
+; comment
+inc r2
+L37: stop
+stop
+stop
+L38: inc L625
+L39: red *r7
+red r1
+
+L40: .string "vhs"
+L41: clr r1
+cmp L16, #154
+prn L4
+stop
+stop
+L42: .string "wcsxclepttwtqwmlusmm"
+rts
+L43: .string "rztrsmgs"
+stop
+L44: .data -206, -909, -238, 275, 977, 131
+jmp *r7
+L45: prn L6
+L46: .string "eam"
+L47: red L63
+L48: not L542
+L49: jsr *r3
+L50: .string "dsmvveujkjdrkp"
+sub r1, *r2
+L51: lea L42, *r1
+L52: add #-158, L579
+L53: prn #83
+L54: .string "tfckkaxlhwy"
+L55: jmp L40
+L56: not *r1
+L57: bne L56
+jsr *r6
+clr r4
+
+L58: .data -367
+L59: inc L3
+L60: prn L457
+clr r7
+L61: cmp *r3, r6
+L62: cmp #-206, *r2
+L63: lea L95, r0
+; comment
+L64: .data -820
+add r5, *r2
+bne *r0
+L65: jmp *r1
+inc L46
+L66: clr *r4
+prn L57
+L67: mov L43, r2
+rts
+L68: lea L61, *r7
+
+L69: inc r7
+L70: clr L60
+L71: clr *r1
+L72: sub r1, L187
+L73: bne *r2
+dec *r4
+; comment
+dec *r2
+L74: .data 121, -324, -921, 283, -506, -384, -594, 669
+L75: prn L15
+L76: lea L43, L42
+L77: stop
+L78: red *r2
+L79: not *r1
+L80: rts
+mov *r0, L501
+L81: mov L365, L9
+cmp r7, L78
+L82: rts
+L83: mov #127, *r3
+L84: inc *r2
+L85: lea L49, r6
+
+L86: not *r1
+L87: .string "jaegjdpvdpx"
+L88: .data -163, -895, -674
+not r0
+L89: rts
+L90: sub r1, L121
+L91: bne *r4
+L92: rts
+L93: stop
+L94: lea L51, *r3
+L95: .data 583, 420, 4, 845, -539, 113, 993
+L96: .string "mqkp"
+L97: jmp L296
+L98: mov #98, L103
+L99: .string "xpplvhzjecvmkbkvnqptcgj"
+L100: lea L38, r4
+L101: jmp L31
+lea L12, r0
+prn *r7
+stop
+L102: jmp L401
+L103: lea L60, *r4
+L104: jmp L504
+prn L411
+L105: .string "gjxhdfvevohjykfbs"
+L106: dec L344
+L107: bne L284
+L108: stop
+L109: .data -456, 228, 808
+L110: .string "xpdbfcmakplmckqtbdbw"
+L111: .data 536, -857, 903, -852, -778, 216
+L112: cmp L556, r3
+L113: prn *r0
+L114: .string "ea"
+L115: stop
+rts
+rts
+L116: dec L68
+rts
+L117: add *r2, r7
+dec r6
+mov r7, *r7
+bne L5
+mov L12, r0
+stop
+L118: sub r6, r7
+L119: rts
+L120: inc *r0
+L121: .string "fgnyaarnzjdwmmxemg"
+L122: prn *r2
+L123: mov L26, r6
+L124: not r4
+bne *r4
+; comment
+L125: rts
+L126: clr *r4
+L127: red *r1
+L128: dec L44
+; comment
+L129: red *r5
+L130: .string "vcfbkxhmpwm"
+L131: lea L13, L111
+L132: sub L68, L52
+L133: stop
+L134: prn L557
+L135: add *r4, *r5
+L136: .string "rcztgmcqexbr"
+L137: sub r0, *r0
+jmp *r2
+L138: cmp #163, r3
+add #130, *r0
+cmp r3, #14
+L139: red L124
+lea L67, *r5
+not L121
+prn r6
+L140: .string "qqdugdndcjoxka"
+dec r7
+L141: stop
+L142: jsr *r1
+L143: inc r0
+L144: red *r7
+; comment
+not *r4
+L145: sub L148, *r1
+L146: cmp L474, r1
+L147: jsr *r1
+lea L110, r5
+L148: red r5
+L149: not *r3
+add *r4, L196
+; comment
+L150: .string "tuuzyxddmdnlngztoh"
+cmp *r6, #179
+inc r4
+mov L276, L482
+jmp L74
+L151: lea L565, *r4
+L152: prn *r1
+clr L61
+dec r5
+L153: inc r5
+L154: jmp L451
+bne *r7
+L155: cmp r5, #215
+L156: dec L22
+L157: mov *r3, *r5
+L158: rts
+L159: prn *r0
+L160: lea L537, L373
+bne L136
+prn *r4
+L161: stop
+L162: jmp *r4
+clr L408
+L163: sub r0, L452
+L164: clr r3
+L165: cmp #-237, r0
+; comment
+L166: lea L46, L341
+L167: cmp *r1, L52
+prn r3
+L168: jsr L483
+mov L59, L386
+L169: lea L266, L168
+jmp *r6
+L170: stop
+cmp L87, #193
+L171: clr L72
+mov L452, *r3
+
+L172: inc L138
+bne L136
+mov L580, *r7
+L173: .string "pcsoaqhsoygatuukuoyyw"
+L174: inc *r2
+clr L147
+L175: sub L68, *r5
+L176: inc r0
+L177: clr r7
+L178: mov L395, r0
+mov r2, r6
+stop
+L179: prn L247
+L180: red L299
+rts
+L181: clr L117
+
+L182: red *r4
+add r1, *r6
+L183: mov *r1, L564
+rts
+L184: lea L601, L326
+lea L69, L592
+bne L59
+L185: prn *r1
+L186: jsr *r7
+L187: red *r5
+mov r6, *r0
+inc L91
+L188: not r0
+red L162
+L189: clr L615
+
+L190: jmp *r3
+; comment
+red *r5
+jsr *r7
+L191: red L391
+L192: .string "xnexgqxzcpzhyhevi"
+prn r6
+L193: cmp r0, r1
+L194: cmp L66, *r7
+L195: red *r7
+L196: .data 891, -598, 493, -296, -611, -251, -979, 452
+L197: mov r1, r0
+L198: jsr L42
+L199: stop
+prn #-137
+dec L109
+mov #-91, *r1
+stop
+L200: sub L33, r6
+L201: cmp r6, r4
+L202: .data -176, -838, 375, 612, -822, -327, -506
+sub *r4, r2
+L203: lea L79, r2
+inc *r7
+dec r3
+jmp L612
+L204: inc *r5
+L205: not L167
+L206: rts
+sub *r3, r7
+bne L131
+L207: sub #-228, *r7
+L208: lea L243, *r3
+L209: red *r2
+L210: jsr L17
+L211: stop
+
+mov L567, *r0
+L212: .string "qqxksmohnvwkywbs"
+rts
+mov r6, L276
+jsr L610
+L213: clr *r4
+L214: lea L42, L45
+L215: jmp L189
+not *r3
+L216: lea L29, L116
+L217: sub L259, *r6
+bne L332
+L218: sub r3, L301
+L219: add #9, L614
+L220: red *r5
+L221: cmp #-76, r5
+bne L300
+rts
+L222: jmp *r3
+clr L55
+L223: inc *r0
+L224: clr *r3
+
+
+L225: red r4
+mov #-68, *r1
+L226: rts
+L227: not r3
+L228: sub L372, r0
+L229: clr r2
+L230: jsr *r2
+clr r4
+L231: red r1
+prn #-182
+sub L206, r4
+rts
+L232: dec L184
+lea L63, *r4
+L233: .string "wyiskfjkqtp"
+stop
+L234: rts
+L235: red *r1
+L236: clr r7
+L237: jsr L434
+sub *r3, r1
+L238: lea L291, *r3
+L239: sub #18, *r1
+L240: lea L314, L173
+sub #-10, L114
+
+bne *r1
+mov *r1, L167
+lea L476, L495
+rts
+L241: clr L606
+L242: jsr *r2
+L243: inc *r4
+L244: red *r6
+L245: add #180, r6
+L246: not r5
+jsr L623
+L247: dec r0
+mov #-119, *r2
+
+cmp L256, *r2
+L248: prn L107
+mov *r4, *r1
+L249: add #70, L572
+inc *r3
+L250: rts
+L251: clr L8
+L252: prn #113
+stop
+L253: stop
+L254: not L246
+; comment
+lea L499, L417
+L255: rts
+L256: lea L108, L47
+L257: sub #-73, r7
+add L286, L614
+L258: rts
+mov *r3, r0
+L259: jmp L147
+jmp *r1
+; comment
+L260: .data 563, 261, -620
+L261: prn *r6
+L262: rts
+rts
+add r1, r2
+red *r2
+; comment
+L263: .string "cibujiqzfhlpahnn"
+L264: dec L304
+L265: not r0
+L266: not L351
+L267: cmp r0, *r6
+L268: jmp L373
+L269: jmp L182
+L270: prn r6
+L271: red *r0
+L272: red r1
+prn r0
+prn r0
+clr *r4
+L273: inc r2
+L274: prn L46
+L275: cmp #37, L55
+clr r3
+L276: sub r0, r0
+L277: jsr *r4
+L278: .data -222, -997
+L279: red L111
+; comment
+L280: .data 141
+clr *r4
+L281: .string "cpqlodfoknzjc"
+rts
+L282: stop
+sub L27, *r2
+L283: dec L185
+L284: red L44
+
+; comment
+red L537
+L285: .data 714, 557, 384, 689, 181, 830, -821
+L286: .string "keuzgrycynvwfpgowmuqfkr"
+L287: jsr *r7
+L288: .string "jxkb"
+dec r7
+L289: clr *r7
+stop
+L290: red *r3
+clr L251
+L291: bne *r3
+L292: inc r4
+L293: rts
+L294: jsr L4
+L295: jmp L2
+L296: cmp *r5, *r7
+bne *r5
+L297: .data 685, -362, 787, -131, -580, 310, 580, 231
+L298: cmp #194, #-39
+L299: clr r1
+L300: cmp #-15, *r5
+inc r6
+L301: prn #137
+dec r6
+bne L547
+L302: add *r2, r5
+cmp *r4, *r0
+mov L450, r0
+L303: lea L525, L582
+prn r0
+jsr *r7
+L304: dec r7
+L305: not L181
+sub r2, r4
+L306: not *r2
+clr r2
+L307: rts
+L308: add *r6, L372
+L309: .data -519
+red *r4
+L310: dec *r6
+; comment
+L311: not r7
+prn #65
+rts
+L312: stop
+L313: red L210
+cmp L553, L38
+L314: not *r4
+L315: lea L330, *r7
+L316: add #-210, r7
+jmp L207
+L317: red *r0
+L318: jmp *r1
+not L114
+L319: mov L152, L149
+sub #-124, *r3
+L320: dec r7
+L321: prn *r5
+L322: jsr L494
+L323: rts
+L324: .string "ntyegalhyugbqbq"
+L325: clr *r2
+L326: rts
+clr r6
+L327: clr L360
+L328: add #25, L116
+L329: not r3
+L330: red *r3
+L331: rts
+L332: add L300, *r1
+L333: not r5
+inc L398
+L334: prn *r4
+L335: add #217, r2
+L336: bne L468
+dec r2
+L337: not r6
+L338: cmp #-139, L157
+L339: inc r7
+L340: red *r5
+inc *r5
+L341: not r1
+L342: .data 580, -257, 517, -794, -137, -598, 286
+L343: inc *r4
+L344: rts
+L345: jsr *r1
+inc r0
+stop
+L346: stop
+L347: dec L561
+L348: mov L60, L444
+red r2
+L349: stop
+L350: red r0
+L351: stop
+L352: mov r6, *r7
+L353: jmp *r5
+L354: cmp #161, r0
+L355: jsr L115
+L356: sub L180, L345
+L357: red L239
+L358: rts
+L359: inc r4
+L360: stop
+L361: red L560
+L362: red r5
+L363: inc L252
+
+L364: clr *r6
+L365: red *r1
+stop
+L366: prn r3
+L367: rts
+cmp *r1, L457
+prn *r2
+L368: mov *r3, *r4
+sub #-81, *r4
+L369: sub L427, L235
+rts
+L370: rts
+
+dec L184
+L371: mov L204, r0
+add r2, L560
+; comment
+jmp L524
+L372: cmp L245, #150
+jsr L211
+L373: lea L104, *r4
+L374: red L160
+mov r6, r3
+sub L39, *r5
+L375: sub r4, r2
+sub r4, r1
+L376: add L205, *r4
+mov L162, *r2
+L377: add *r1, r5
+L378: .string "qn"
+L379: lea L357, r7
+L380: dec L502
+stop
+add #-236, *r3
+stop
+cmp #29, r0
+L381: jsr L83
+inc L384
+L382: mov r4, r2
+L383: cmp *r3, *r0
+L384: inc r1
+L385: inc *r5
+rts
+L386: .data -883, 8, 508, 900, -350
+L387: jmp *r4
+L388: mov #245, r7
+L389: mov L86, *r5
+bne L552
+L390: jsr *r7
+L391: clr r2
+L392: dec *r0
+L393: .data 539
+jsr *r5
+L394: red r2
+L395: not L604
+L396: lea L47, r4
+L397: cmp r6, r1
+L398: mov *r6, r7
+dec r1
+L399: add *r0, L488
+
+L400: .string "kccxcuuuajrs"
+bne *r4
+; comment
+inc L348
+dec L105
+L401: cmp L425, *r6
+L402: bne *r1
+L403: clr r7
+L404: dec *r0
+L405: inc r6
+L406: red r2
+not *r4
+L407: jsr *r4
+; comment
+bne L189
+L408: prn r5
+L409: .data -450
+inc *r7
+jsr L184
+sub #64, *r4
+L410: stop
+jsr *r3
+L411: add L249, r6
+red *r1
+red *r2
+clr r4
+L412: mov r3, r3
+L413: prn L540
+red L552
+L414: jmp L441
+clr *r3
+mov *r4, r2
+inc L72
+lea L147, r1
+prn r4
+red *r5
+L415: .string "uyrgbpehavdyegi"
+lea L352, *r7
+L416: .data -573, -632, -154, -993, -539
+clr L517
+L417: sub *r7, r5
+L418: red r4
+L419: mov *r5, *r0
+L420: rts
+; comment
+rts
+L421: rts
+L422: lea L144, r2
+L423: jmp *r6
+dec r5
+L424: .string "ldikeojdxhrmuqrbtplova"
+L425: add #130, *r7
+L426: add #43, L455
+; comment
+L427: mov #56, L295
+cmp *r7, #-38
+inc r6
+L428: .data 544
+rts
+L429: dec *r1
+L430: dec r0
+L431: bne *r5
+L432: sub *r4, r3
+L433: inc r0
+L434: prn *r5
+L435: .data -480
+L436: red L532
+L437: inc *r0
+L438: jsr L483
+L439: bne *r7
+dec *r0
+red *r0
+L440: inc r5
+L441: prn #-170
+L442: .data -326
+L443: bne *r1
+L444: .data 464, 583
+L445: .data 232, -193, -318, -654, 286, 442, -862
+L446: clr L553
+L447: mov *r1, L518
+L448: .string "nwpxvlemk"
+L449: bne L523
+L450: clr L520
+rts
+
+L451: jmp *r5
+L452: mov L540, L3
+dec L553
+add L514, r5
+L453: stop
+L454: .data 329
+L455: lea L592, *r3
+not L304
+inc L170
+bne L466
+L456: clr r3
+L457: .string "ahcnywqslvujx"
+L458: .data -767, 375
+L459: clr r2
+mov *r6, *r3
+L460: jmp L236
+clr L570
+add L303, L135
+L461: sub r7, *r2
+add r7, *r0
+dec r2
+jmp *r6
+L462: jsr L483
+L463: lea L51, L128
+jmp *r4
+inc r3
+prn *r7
+L464: prn r1
+L465: mov #38, *r1
+L466: clr L493
+L467: jmp L487
+L468: jsr L80
+L469: stop
+L470: .string "ilqfkzlpqspyaln"
+L471: cmp #181, #-176
+L472: inc *r0
+L473: inc *r5
+L474: lea L194, r3
+L475: sub L345, *r0
+L476: inc r0
+L477: add r3, *r2
+; comment
+not L531
+
+rts
+L478: not L618
+clr r5
+L479: not L30
+L480: .string "cvkkoakmztdiwtuujita"
+L481: sub *r4, L307
+L482: inc r0
+L483: prn r6
+L484: jmp *r1
+prn r0
+bne *r5
+L485: stop
+clr L15
+rts
+L486: dec *r2
+L487: .data 550, -132, -236, 194, -809
+L488: mov L543, *r1
+L489: not L587
+clr r1
+L490: cmp *r0, #133
+L491: jsr L607
+L492: stop
+L493: clr L610
+L494: sub *r5, r4
+L495: not L512
+L496: rts
+L497: stop
+L498: dec r7
+L499: lea L600, *r0
+jmp *r4
+L500: red *r6
+add r4, L362
+L501: prn r1
+jmp L581
+add L369, *r1
+; comment
+L502: mov r7, r7
+stop
+L503: stop
+L504: not r3
+L505: red L376
+
+L506: not *r7
+L507: add #184, *r4
+L508: bne L303
+L509: not r5
+clr L160
+jsr *r7
+L510: bne L384
+prn *r1
+L511: lea L212, r2
+L512: clr L566
+L513: jsr L360
+L514: jmp L522
+
+inc *r7
+
+L515: mov *r3, r0
+L516: .data 500, -425, -726
+L517: rts
+L518: rts
+L519: jsr L427
+stop
+L520: bne L151
+L521: bne L556
+L522: clr L251
+jmp *r6
+L523: red *r1
+lea L569, r6
+L524: jsr L409
+L525: mov *r7, L619
+L526: bne L609
+not r7
+L527: jsr L611
+L528: .data 449, 647
+L529: lea L546, L605
+add L358, *r5
+L530: bne *r3
+L531: cmp L607, r0
+L532: jsr L602
+L533: dec L556
+L534: clr L423
+L535: clr *r5
+L536: lea L596, r1
+L537: dec r5
+dec r4
+mov r1, L310
+dec *r2
+not *r5
+lea L476, L576
+L538: not *r1
+jmp L570
+L539: jmp *r6
+stop
+L540: stop
+L541: mov r7, *r7
+L542: not r4
+L543: stop
+bne *r7
+L544: red L56
+L545: prn L103
+L546: sub #-167, *r3
+L547: not L21
+L548: .string "huxpbrcxoldrnnihxipvpot"
+L549: .data -445, -279, -834, 928, -511, 771
+L550: bne L493
+sub *r6, *r1
+prn r7
+L551: mov r0, L579
+add #-229, r5
+L552: dec r0
+L553: jmp L572
+rts
+L554: bne *r1
+L555: dec *r2
+L556: prn r2
+prn *r4
+jsr *r4
+
+L557: not r1
+L558: prn #48
+L559: .data 650, 530, 490, 109, 556, -710, -385
+dec *r5
+L560: inc r7
+L561: rts
+L562: add r3, *r4
+mov *r4, r5
+dec L581
+not L579
+bne L143
+L563: add r0, L598
+L564: stop
+L565: .string "cfigbspe"
+L566: not *r3
+L567: sub L432, L611
+cmp r3, *r3
+L568: not r7
+add *r6, L578
+L569: mov *r5, *r6
+L570: lea L614, r7
+red L608
+dec r6
+L571: .data 249, -793, 814, 59, 953, 514, -850, 169
+L572: lea L450, *r3
+L573: .data -136, -666, 475, 735, -270
+L574: not L33
+L575: not L587
+red r4
+red r7
+L576: sub r6, r1
+prn L610
+L577: jsr *r0
+L578: dec L59
+red *r1
+clr *r1
+jsr L234
+L579: not L472
+inc r1
+bne *r1
+L580: jsr *r4
+L581: cmp *r2, #-177
+L582: add #-183, *r0
+stop
+L583: prn #206
+L584: prn r3
+lea L605, r7
+inc L607
+L585: clr L3
+L586: .string "qcipgripwtfktyxuvdqhrd"
+L587: dec *r4
+L588: lea L592, *r7
+inc L618
+L589: .string "mei"
+L590: rts
+L591: mov r2, r3
+L592: .string "sv"
+L593: rts
+L594: .data -473, 249
+bne *r5
+L595: prn #115
+L596: cmp #-158, #-117
+L597: dec L600
+L598: .string "rmtpdwazh"
+lea L50, r1
+L599: mov *r5, r5
+stop
+L600: stop
+L601: jmp L617
+L602: clr *r3
+L603: .data -523, -12
+L604: .string "jubzpeyrmzahxmu"
+L605: stop
+bne L230
+rts
+L606: sub #171, L611
+L607: jsr L623
+red *r2
+L608: not r2
+L609: not L532
+L610: mov #-82, L612
+L611: red *r5
+cmp r2, *r2
+prn #56
+L612: lea L622, r7
+L613: jmp L621
+L614: .data -831, -429, 587
+L615: red L625
+L616: jsr L622
+L617: jsr L342
+sub L625, L73
+sub #185, *r2
+sub #213, L455
+red r4
+; comment
+L618: .string "iyyhcdyfotcrwrhh"
+L619: bne L217
+; comment
+red *r2
+L620: red r5
+
+sub L23, *r7
+L621: sub L622, L195
+; comment
+jmp L624
+; comment
+L622: .string "jcibw"
+L623: .string "luvswohzthndoouogbkqz"
+dec *r6
+bne L624
+L624: .data -985, -303, 481, 217
+; comment
+L625: inc L348
+mov *r4, r4
+inc L235
+stop
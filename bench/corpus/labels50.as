@@ -0,0 +1,1042 @@
+; Generated by genCorpus --seed 51
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+.entry L624
+L0: dec r2
+L1: mov *r0, r3
+L2: .data 823, -342, 547, 418, 338, -69
+clr *r0
+add *r5, r4
+L3: .string "ufjvjgqjmfqolxh"
+L4: rts
+L5: lea L4, L388
+lea L5, *r2
+L6: bne *r5
+L7: jmp L577
+L8: add *r5, *r1
+L9: clr *r2
+bne *r4
+L10: not L360
+L11: stop
+
+
+L12: rts
+
+add L593, r7
+L13: bne L11
+L14: clr r7
+L15: add L6, *r2
+mov r3, L94
+L16: red L10
+add *r7, L8
+L17: not r2
+dec *r3
+L18: rts
+L19: sub r0, r5
+L20: .data -788, 562, 602, 87, 895, 826, 830, -37
+L21: .string "uytmvqpwdlnygaayhqi"
+L22: mov *r7, *r7
+lea L121, L22
+L23: .data 5, 281
+cmp #-84, #160
+; comment
+prn r7
+L24: prn r7
+sub r5, L426
+clr r4
+red r2
+dec L4
+sub r7, *r6
+L25: cmp #24, r2
+L26: lea L282, L212
+L27: cmp L461, r0
+L28: stop
+L29: sub r6, L3
+L30: jsr *r2
+L31: mov #-151, L8
+L32: not r1
+inc L29
+L33: prn *r1
+lea L2, L181
+L34: stop
+L35: lea L27, r0
+L36: cmp L22, r5
+red *r5
+L37: .string "qtpcrxytwsewvcowixluzygb"
+mov L350, r4
+
+L38: .string "aetgkiernrwfjhtcdl"
+rts
+L39: .string "iqfheq"
+L40: inc *r6
+L41: .data -672, -819, 859, 288
+L42: red *r5
+jmp *r0
+L43: mov *r2, L38
+mov r3, L41
+L44: sub #-185, L617
+rts
+L45: red r7
+L46: red *r4
+L47: cmp *r7, #-216
+L48: clr L10
+L49: inc r4
+L50: inc r3
+L51: inc L9
+L52: stop
+L53: lea L611, L2
+L54: not *r1
+L55: jmp *r0
+dec *r1
+dec *r0
+prn *r5
+L56: add L13, r5
+L57: stop
+jsr *r4
+L58: sub L360, L393
+L59: .data 795, -108, -231, 377, -158, 362, -607, -734
+L60: bne L584
+L61: .data 539, -967, -907, -946, 925, -242
+L62: stop
+L63: stop
+sub *r5, r4
+L64: add L385, L4
+L65: prn r4
+inc r0
+L66: .string "mqtjmadbuwqngkwdj"
+L67: prn r0
+L68: bne *r3
+L69: stop
+L70: dec L570
+L71: add #185, r4
+L72: rts
+lea L47, L227
+L73: prn r3
+jsr *r0
+L74: dec r3
+clr L324
+jmp L125
+L75: stop
+L76: .data 63, 989, -955, 447, -352, -114, 911
+L77: mov *r4, *r0
+L78: sub r1, r1
+not *r0
+L79: jsr *r5
+L80: jsr L14
+sub r0, L80
+
+L81: rts
+L82: rts
+L83: sub L75, r7
+L84: inc *r6
+L85: mov L51, r2
+L86: .string "asjsqvwecnchcymgint"
+L87: inc *r0
+L88: .data 415, -671, 876, 320, -680, -363, -6, 202
+bne L64
+inc L357
+L89: dec L4
+L90: rts
+L91: not L78
+L92: mov r7, *r2
+L93: mov *r5, L71
+L94: not L408
+L95: lea L91, L20
+L96: sub r5, r2
+L97: .string "lbdsvsouzbhpxfj"
+
+L98: jsr *r0
+L99: rts
+L100: stop
+L101: stop
+L102: bne L187
+L103: red L454
+jsr L80
+L104: inc *r3
+stop
+lea L72, L98
+L105: cmp L33, *r2
+L106: stop
+L107: clr r0
+L108: not r3
+rts
+L109: red *r7
+L110: .string "kabtwmqeglfnqrrg"
+L111: mov L441, *r6
+L112: inc *r7
+stop
+
+cmp L168, L44
+L113: .string "znnxgpafkqbyyjlcmgk"
+red L52
+L114: jsr L77
+L115: inc r3
+L116: bne *r0
+sub *r1, *r0
+
+jsr L3
+L117: jsr *r6
+L118: dec r3
+L119: lea L10, *r7
+L120: inc L54
+; comment
+L121: .data 236, 192, -202
+sub #-248, L102
+L122: dec r2
+L123: prn L396
+lea L138, r2
+
+red L69
+L124: red r0
+L125: cmp #96, r4
+L126: mov L531, *r2
+L127: mov *r2, r5
+add #197, *r3
+L128: add r4, *r7
+red *r6
+L129: jsr L67
+L130: stop
+L131: inc r1
+L132: not *r4
+not *r7
+L133: add *r0, r5
+L134: add r7, L1
+mov L479, r0
+L135: bne L214
+; comment
+L136: cmp *r2, *r6
+L137: mov *r3, r6
+L138: bne *r0
+L139: .data 616, -806, 710, -447
+L140: dec r7
+mov *r3, *r6
+L141: prn L392
+lea L284, *r2
+red r7
+rts
+rts
+L142: sub r2, *r6
+jmp L393
+L143: .string "pflgdxxvjhqlznndtl"
+jmp *r5
+bne L549
+L144: bne *r0
+L145: dec *r3
+L146: prn L96
+L147: .string "yvp"
+L148: .data 564, 806, -96, 545, 542, 164
+; comment
+L149: not r5
+L150: sub #155, *r7
+L151: inc r5
+L152: cmp L446, #-28
+L153: red r1
+add #-215, *r2
+
+L154: dec L166
+add L85, *r4
+L155: lea L78, r4
+L156: sub L113, *r7
+L157: cmp r3, L235
+L158: sub #237, L151
+stop
+L159: add #-30, r0
+L160: clr r3
+L161: lea L591, L591
+L162: sub L95, r7
+L163: stop
+L164: rts
+L165: stop
+L166: .string "shdmwo"
+L167: sub L262, *r3
+; comment
+jmp L69
+L168: .data 288
+L169: add #77, L616
+L170: mov L59, *r1
+L171: clr *r5
+not L99
+bne L20
+dec r2
+lea L151, r0
+L172: bne L51
+L173: .string "olenrcfbrlmozjkhxv"
+add r3, L200
+L174: rts
+L175: .data -817, -682, 226, -316, 601
+L176: cmp L113, #-118
+L177: bne L146
+inc *r2
+red *r0
+L178: prn #-198
+L179: cmp #-91, *r1
+; comment
+L180: prn #223
+sub L18, L66
+L181: stop
+L182: clr *r3
+rts
+prn #254
+L183: bne L168
+L184: bne *r3
+not r3
+L185: stop
+L186: clr r4
+prn #102
+L187: bne *r2
+L188: sub #254, r4
+L189: inc L12
+dec r1
+L190: mov L108, *r1
+L191: jsr L107
+L192: clr *r1
+L193: stop
+L194: add r4, *r3
+L195: lea L90, r3
+L196: .data 861, 124, -145
+L197: jmp L585
+L198: bne L225
+; comment
+mov r1, *r2
+sub r3, L385
+L199: red r3
+L200: bne L154
+L201: .data -567, -74
+bne L106
+dec L72
+jmp L247
+L202: sub *r2, r7
+L203: bne L231
+L204: add *r7, r3
+dec *r4
+L205: rts
+mov #202, r1
+L206: jmp L99
+prn *r0
+L207: jsr L117
+L208: prn L185
+L209: jsr L446
+stop
+L210: add *r7, *r3
+clr L23
+add r2, r7
+L211: red L42
+L212: sub *r4, r0
+add L138, r3
+L213: dec L536
+L214: .string "awkgwdhbrpf"
+L215: not L438
+L216: stop
+
+L217: .string "wivajedqfi"
+lea L619, L63
+inc r4
+dec L594
+; comment
+L218: dec *r4
+mov r6, L168
+L219: jsr *r5
+L220: bne L49
+red L211
+rts
+L221: .data 949, 517, -90, -116, 722, -101, -232, 482
+; comment
+L222: lea L41, *r6
+bne L17
+clr L83
+L223: cmp r2, r4
+dec *r0
+L224: cmp *r5, L293
+L225: prn r7
+L226: .data -931, 966, 801, 93, 169, -418, -833, 306
+L227: inc *r3
+dec *r2
+
+prn r3
+cmp *r7, r3
+add #-253, *r3
+sub *r5, *r0
+lea L58, r6
+stop
+L228: .data -188, 70, 75, 829
+L229: stop
+cmp L159, L166
+L230: inc L138
+L231: cmp r5, #23
+L232: red r6
+L233: sub r7, *r1
+stop
+L234: clr r4
+L235: mov #-34, *r4
+jmp *r2
+L236: stop
+L237: dec L281
+L238: .data -914, 328, -329, -492, 970, -534, -562, -713
+add L468, *r5
+L239: jsr L235
+inc L464
+L240: mov r0, L206
+L241: inc r7
+stop
+inc *r4
+L242: prn L203
+L243: .string "cjosqgirziqgaigm"
+L244: .string "bimbwaqlhygzn"
+L245: .string "i"
+L246: mov #145, *r1
+L247: dec *r6
+not L592
+L248: lea L563, r3
+L249: cmp #-107, L577
+L250: add L475, *r4
+L251: mov *r1, *r3
+clr L93
+jsr *r4
+L252: mov r7, L181
+L253: stop
+L254: .data -201, -640
+L255: sub L361, r7
+L256: not L57
+L257: inc L354
+stop
+rts
+red *r5
+L258: mov r0, r4
+L259: dec *r3
+L260: sub *r0, L50
+cmp *r7, *r0
+L261: .string "jgijduuilrj"
+L262: sub *r4, r4
+L263: rts
+L264: sub *r2, L619
+L265: rts
+L266: bne L517
+L267: .data 776, 53, 604, 866, -784, -10
+L268: not L117
+red r4
+sub r4, r7
+dec r7
+jsr *r3
+L269: jmp *r2
+L270: not L437
+inc *r4
+L271: jmp L511
+L272: clr r4
+cmp r5, *r5
+L273: bne L438
+L274: dec *r3
+add #-187, r1
+L275: red L590
+L276: lea L345, L142
+L277: bne *r7
+L278: .string "awcelolxnxhukxxnereyrfh"
+L279: inc *r7
+L280: cmp *r2, L23
+L281: inc *r4
+L282: clr L415
+L283: jmp L362
+inc *r6
+L284: jmp L217
+sub L49, r1
+L285: inc r0
+L286: add #106, L608
+L287: jsr *r6
+bne *r6
+L288: rts
+L289: .string "onbzocigjvtpusgqho"
+; comment
+L290: .data -584, 564, -251, 393, -159, 460, -353
+bne *r2
+L291: lea L72, *r3
+inc L348
+jmp *r5
+mov #240, *r2
+L292: jmp L141
+red r3
+L293: mov #-206, r1
+L294: prn *r6
+stop
+L295: not *r6
+L296: jsr L262
+L297: clr L100
+cmp #165, *r7
+dec L213
+not *r7
+jsr L170
+clr *r3
+L298: sub L250, *r1
+L299: cmp r2, L165
+stop
+L300: sub r4, *r5
+L301: red *r3
+L302: sub *r7, L259
+stop
+L303: jsr *r2
+L304: inc L467
+L305: jsr L350
+L306: lea L533, r4
+L307: rts
+L308: inc *r1
+red L276
+jmp L112
+L309: inc *r0
+L310: add *r5, L521
+jsr *r7
+lea L563, *r5
+L311: .data 360, 345
+L312: mov #119, *r0
+L313: cmp *r2, *r4
+L314: .string "ksoxcpjldabinpgndbgol"
+L315: mov L68, *r7
+L316: cmp #74, L561
+L317: bne *r3
+L318: jmp L111
+L319: clr L170
+L320: prn r1
+inc L596
+L321: .data -513, -487, 599, -58, -734, -872, -931, 433
+L322: red L438
+L323: prn *r7
+L324: red *r7
+L325: jmp L286
+L326: stop
+L327: cmp *r2, L432
+L328: rts
+L329: bne *r6
+dec *r0
+dec *r5
+L330: rts
+rts
+jsr *r1
+L331: jsr L592
+jsr *r6
+stop
+; comment
+jmp *r0
+L332: sub #-179, r7
+L333: dec *r4
+not r2
+rts
+L334: inc *r3
+L335: inc r5
+
+L336: jmp *r1
+L337: stop
+L338: .string "zudufllf"
+cmp #73, L296
+clr L349
+L339: stop
+L340: .data -126, -445, -57, -922, -770
+L341: lea L389, *r0
+L342: mov L97, L315
+
+L343: jmp *r1
+L344: .string "vjjgtuzaeatfhwzie"
+L345: stop
+L346: jsr *r1
+dec r1
+bne *r5
+L347: lea L542, L9
+; comment
+jsr L126
+L348: .string "a"
+L349: jsr L118
+
+L350: not *r7
+jsr L385
+clr L485
+L351: lea L394, r2
+L352: prn #56
+L353: inc r4
+L354: .data -394, 790, 737, 934, 886, 237
+L355: prn #-17
+red r4
+add *r1, *r3
+L356: inc *r1
+L357: dec r5
+prn r5
+jmp *r6
+L358: .string "fddbranhviruglhnt"
+L359: .data 328, -641, 308, -286, 685
+L360: add L377, L294
+L361: stop
+
+not *r3
+L362: sub r6, r3
+L363: jsr L473
+stop
+L364: sub *r7, r2
+L365: bne L436
+stop
+L366: .string "arhlpsfcudaj"
+L367: lea L233, r4
+
+L368: prn #-219
+L369: prn #130
+bne *r0
+L370: bne L380
+L371: add *r4, L132
+L372: dec L282
+L373: jmp L541
+bne *r5
+L374: bne L458
+L375: rts
+L376: add #133, *r5
+cmp #-123, L613
+L377: .string "pwrhpecjxpvjak"
+L378: prn #-218
+mov #-197, L137
+L379: not *r0
+prn *r2
+bne *r3
+L380: inc *r6
+L381: inc *r7
+; comment
+dec L394
+L382: add #165, L604
+L383: clr r7
+L384: inc L377
+L385: jsr L530
+L386: not L471
+cmp r0, #195
+L387: red *r0
+L388: rts
+L389: dec r6
+L390: clr L601
+sub *r1, *r5
+add *r3, r7
+jmp L281
+sub r1, *r3
+inc r6
+L391: prn r1
+L392: cmp *r0, r2
+L393: red r2
+L394: jsr *r0
+cmp #189, L72
+; comment
+L395: .data 390, 481, 166, -463, -470
+L396: lea L92, r3
+L397: .string "kx"
+not *r6
+lea L314, L420
+lea L278, L571
+L398: inc L557
+
+L399: jmp *r6
+L400: mov r0, r6
+rts
+L401: prn #-217
+lea L585, r3
+not r4
+L402: .string "sqyaelukbfgflu"
+L403: cmp #93, *r1
+L404: stop
+L405: jmp *r0
+L406: .data 774, -126, -384
+L407: mov L505, r3
+L408: add L440, r4
+L409: cmp #122, *r4
+jsr *r0
+L410: rts
+prn *r4
+add *r3, r6
+clr *r2
+L411: jmp L188
+add *r6, L126
+bne L16
+jmp *r7
+bne L545
+L412: dec *r1
+inc *r7
+; comment
+L413: bne *r4
+L414: bne *r4
+inc *r2
+clr r0
+stop
+jmp *r7
+rts
+L415: cmp #-125, #0
+bne L68
+; comment
+cmp *r6, r0
+L416: not r0
+L417: .string "ldzolahwisndhrsmauwng"
+L418: jmp L306
+L419: .string "jcrrmoululu"
+L420: add #-55, r4
+red *r1
+sub #239, *r3
+dec L345
+L421: lea L602, *r6
+stop
+L422: clr *r4
+L423: not *r0
+inc L573
+L424: stop
+L425: .data -226, -499, -192, 433, -948, 674, -93
+L426: dec r3
+L427: lea L308, L526
+L428: clr r3
+L429: lea L605, *r2
+jmp L608
+L430: .string "nvdzbhgqbyerhgtlm"
+L431: inc *r4
+L432: jsr *r4
+L433: .string "xwvmbbatzvgspeehvvrgzh"
+lea L148, L314
+L434: inc *r7
+cmp #169, *r1
+L435: sub L413, r2
+L436: lea L461, *r3
+clr L572
+lea L144, r5
+L437: bne L358
+rts
+inc L353
+
+L438: jsr *r6
+L439: add L35, L24
+L440: .data -572, -959, 873, 570, -644, 946, -170
+L441: dec *r4
+L442: .string "eejoglllzwwejoaejbcbf"
+L443: not L285
+rts
+add #198, L446
+L444: mov #106, *r6
+prn *r1
+L445: .string "cjeyzekxawgqehejcpjzn"
+L446: rts
+lea L387, r6
+L447: clr r3
+L448: jsr *r4
+L449: .string "igiensfygyufnjsnzg"
+L450: bne L540
+L451: .string "fsxevpbosalfzzwmslbyna"
+L452: bne L501
+dec *r1
+L453: lea L155, r0
+not L511
+L454: mov *r7, *r6
+L455: cmp r4, r3
+L456: .data 248, 116, -388, 694, -18, 815, -319, 627
+L457: .string "jomrdpkrkjqmlgefnurjtlf"
+jmp L608
+L458: bne L146
+L459: jsr *r4
+L460: lea L110, r3
+cmp L263, *r0
+lea L597, *r7
+
+L461: stop
+prn r3
+L462: mov r2, r3
+cmp #107, *r2
+L463: not L358
+L464: add L323, L483
+stop
+not L237
+mov #-149, L489
+L465: sub r6, *r1
+L466: not *r6
+
+L467: sub *r3, *r0
+prn *r1
+L468: red *r7
+jmp *r6
+L469: inc *r3
+L470: bne L88
+L471: cmp *r4, L570
+L472: jsr *r4
+L473: jmp L507
+mov #148, r0
+L474: .data -378, -649
+L475: inc *r2
+not *r3
+jsr *r6
+L476: .data 504, 249, -953
+L477: add r1, *r5
+L478: add L578, *r5
+L479: lea L365, r0
+add L537, *r1
+L480: not L592
+L481: inc L466
+L482: dec L509
+bne L389
+L483: .string "upkucrwawa"
+L484: cmp *r7, r7
+L485: .string "qqctrzmnrhqbhtov"
+rts
+L486: .data 152, 451, -136, 118, 226, -85, -247, 603
+L487: .data 344, -564
+L488: add *r0, L301
+L489: prn *r6
+L490: rts
+L491: dec L532
+L492: jmp *r0
+jsr *r1
+L493: add r0, r7
+L494: jsr *r7
+
+not *r4
+bne L611
+dec r1
+L495: not L557
+; comment
+L496: jmp *r5
+L497: red *r0
+L498: stop
+sub L303, L548
+jsr L435
+stop
+red r4
+L499: bne L603
+L500: .data 201, 820, 892
+L501: add r5, L235
+L502: clr *r5
+L503: bne L608
+L504: inc L616
+L505: lea L595, *r7
+not r1
+L506: .string "of"
+sub *r0, *r6
+jmp L596
+red *r1
+cmp r5, L230
+L507: dec r7
+L508: lea L146, r5
+L509: .data -804, -802, -240, 789, -162, 871, 343, -810
+
+L510: sub L401, r6
+bne *r3
+L511: jsr L133
+lea L490, L540
+sub *r7, *r4
+L512: .data 404
+L513: stop
+L514: jsr L58
+L515: cmp r6, *r6
+jmp *r7
+not L603
+L516: .data -469, -555, -39, 111, 3, 842, 924
+dec *r7
+L517: red r0
+lea L543, *r5
+L518: stop
+L519: inc r6
+jsr L532
+clr r5
+
+jsr *r0
+add L140, *r7
+; comment
+rts
+L520: bne L595
+L521: jmp L569
+L522: mov L462, r7
+L523: rts
+L524: not *r4
+dec r4
+L525: bne *r0
+L526: inc *r5
+dec L573
+prn L565
+cmp *r0, L545
+L527: jmp *r4
+L528: .string "ivs"
+L529: rts
+L530: cmp r7, r0
+L531: bne *r4
+L532: stop
+
+rts
+L533: .data -971, -738, 605
+L534: sub #29, L476
+lea L407, L617
+L535: add *r1, L497
+lea L13, r1
+L536: inc L441
+inc r6
+prn #181
+L537: prn #89
+L538: rts
+L539: cmp #169, r0
+L540: add L624, *r7
+not *r7
+; comment
+L541: mov *r3, L601
+L542: .data 430, -534, 183, 814, -551, -216, 657
+clr L572
+L543: add #-234, r1
+L544: clr r5
+mov #231, L554
+prn r7
+L545: cmp #206, *r7
+L546: cmp #-173, #-11
+L547: not L604
+inc L583
+L548: add #11, *r5
+L549: jmp *r2
+L550: prn r6
+dec *r7
+; comment
+L551: prn L555
+L552: .string "zvwfvh"
+lea L616, *r6
+L553: .data -22, 899, 814, -446, 249, -711, -252
+L554: not L534
+L555: dec r5
+L556: rts
+L557: cmp r5, L611
+L558: clr *r7
+stop
+L559: jmp *r2
+L560: inc r5
+L561: rts
+L562: sub L468, r4
+add #31, r2
+not r2
+jsr L179
+
+
+L563: jsr *r0
+L564: jsr *r1
+stop
+add r3, r1
+jmp *r4
+L565: red *r7
+L566: dec *r7
+; comment
+jmp *r0
+clr *r4
+add #163, *r5
+L567: .string "mgnu"
+L568: cmp *r1, #17
+bne L241
+add *r2, L567
+sub r1, r3
+L569: .data -206, 81, 713, 672, 692
+jmp L213
+L570: jmp L619
+L571: add L583, L365
+sub L578, r3
+L572: prn #20
+L573: .data -889, -159, 389, 811, 901, -11, 253, 321
+clr *r6
+
+L574: inc L578
+L575: red L71
+L576: jsr *r3
+L577: not r6
+L578: prn L587
+L579: bne L605
+L580: sub r0, r6
+inc L148
+L581: mov r1, L582
+L582: not *r5
+red L585
+L583: jsr *r6
+not *r6
+L584: sub #177, *r1
+L585: red r3
+rts
+add *r5, *r0
+jsr *r1
+L586: .data -924, 405, -954, -839, -991
+jsr *r6
+L587: prn L603
+L588: inc r1
+L589: jmp L2
+L590: prn *r4
+L591: not r3
+L592: prn #-226
+L593: prn L90
+L594: stop
+L595: .string "msgfcqtahzagmqybhpuiz"
+sub #106, *r5
+L596: sub r5, r5
+lea L608, *r2
+L597: stop
+L598: inc *r4
+L599: prn r2
+L600: lea L284, *r0
+L601: lea L614, *r7
+L602: red *r3
+L603: red L606
+; comment
+L604: sub *r6, r4
+jsr *r2
+cmp *r6, #231
+L605: bne L306
+L606: clr r2
+jsr L73
+not *r5
+L607: jsr L615
+L608: .data 373, -148, -87, 385, -539
+not L619
+L609: not r7
+L610: dec r1
+L611: inc L57
+cmp L616, *r5
+L612: red *r3
+jmp *r2
+jmp L616
+mov r6, L621
+jsr L611
+inc r1
+not L2
+L613: mov *r5, r1
+L614: red *r4
+rts
+L615: .string "ngvwbiku"
+L616: jmp L185
+sub L149, L618
+L617: jmp *r7
+L618: sub *r3, L619
+L619: red *r6
+L620: jsr L142
+dec *r0
+L621: add L340, *r4
+cmp #-49, #-155
+L622: dec *r4
+L623: not *r7
+L624: cmp r0, L367
+sub #-77, L143
+stop
@@ -0,0 +1,1040 @@
+; Generated by genCorpus --seed 52
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+L0: bne *r2
+L1: stop
+cmp *r4, *r3
+lea L371, r4
+L2: .data 563, 919, -306, 906, -230, 133, -719
+L3: cmp *r6, #106
+cmp L170, *r2
+L4: lea L268, *r3
+L5: add L434, r3
+L6: sub L185, L58
+clr L575
+L7: rts
+L8: lea L7, r3
+jmp *r6
+inc L128
+L9: jsr L8
+mov r4, r0
+L10: cmp L605, L478
+L11: sub #-97, L10
+clr r3
+L12: inc L378
+L13: mov r7, r1
+L14: prn #182
+
+add r1, L14
+L15: .string "tmasvqthqoubbzz"
+L16: jsr L0
+add L1, L2
+L17: cmp r2, *r3
+dec r1
+cmp L569, #228
+; comment
+L18: dec *r3
+jsr *r7
+L19: stop
+L20: add *r5, L592
+clr r5
+clr *r2
+clr *r3
+sub *r1, L18
+L21: not L227
+L22: not r6
+; comment
+lea L282, *r0
+L23: .data 779, 458
+L24: .string "sspkjivyekaet"
+L25: .data -974, -492, -178, 621, -205, -163, -400
+L26: stop
+jmp *r2
+L27: bne *r6
+L28: jmp *r7
+L29: .data -899, 478, 682, 373, -338, -507, 352
+L30: .data 180, -860, -246, -981, 792, -159, -876
+red r1
+L31: clr L3
+L32: bne *r7
+L33: dec L68
+L34: mov r7, L445
+L35: mov *r2, r3
+L36: bne *r7
+rts
+jmp L434
+L37: bne *r1
+L38: bne L29
+L39: .string "sqklhcfmujjv"
+L40: jmp L116
+dec r0
+L41: not r1
+L42: rts
+L43: .data -812, 652, 238
+inc r0
+L44: lea L444, r6
+rts
+L45: prn #187
+L46: stop
+stop
+L47: .string "dakalqlcpqufsbtttfyfnpv"
+
+L48: red L7
+L49: stop
+sub *r3, *r4
+L50: jmp L200
+L51: prn #77
+L52: clr L14
+L53: .data 772, -878, 150, 409, 732, 860, 210, -747
+add L36, L135
+; comment
+cmp L545, L420
+inc *r2
+L54: dec L46
+L55: jsr *r0
+L56: .data -722, 46
+L57: inc r3
+add #233, *r2
+stop
+L58: jmp L5
+L59: lea L395, r4
+red L29
+L60: bne L568
+L61: lea L40, r1
+L62: dec r6
+L63: red L206
+add *r6, r7
+lea L24, *r4
+L64: jmp *r6
+inc *r0
+jmp L11
+L65: add r4, r7
+L66: bne L45
+bne L59
+L67: inc *r0
+
+L68: add *r5, *r7
+L69: sub *r0, L81
+L70: stop
+L71: lea L24, *r2
+L72: lea L69, L349
+L73: sub r6, r1
+L74: clr *r2
+L75: stop
+L76: red r6
+L77: red r2
+L78: lea L346, r0
+L79: .data 795, -825, 923, -738, -720, 947, -362
+clr *r1
+L80: add r0, r0
+L81: rts
+L82: dec r6
+L83: rts
+inc L573
+prn r3
+L84: add #149, L534
+L85: add #-52, *r7
+lea L25, *r3
+bne L521
+L86: dec L53
+L87: not r6
+red L329
+L88: cmp #-180, L5
+L89: inc r0
+L90: jmp L49
+
+L91: dec *r1
+L92: stop
+L93: .string "nrlnwqtaenryarkunlbg"
+L94: cmp #6, *r0
+jmp L27
+prn L69
+L95: inc *r1
+; comment
+lea L287, r3
+L96: add *r4, *r5
+L97: inc r0
+L98: cmp L93, #137
+L99: .string "cciurdrtoqcerektd"
+L100: .string "gconysfpuvmslh"
+L101: inc L516
+dec L398
+; comment
+
+inc r1
+inc L365
+L102: inc L54
+L103: add r2, *r6
+jmp *r2
+L104: inc *r6
+L105: cmp #19, #103
+jmp L69
+L106: add *r4, L358
+jmp *r6
+clr r1
+L107: jsr L14
+L108: lea L52, L498
+L109: red *r5
+L110: inc *r5
+L111: cmp r4, #4
+L112: lea L26, r4
+prn L525
+L113: jsr *r1
+L114: lea L268, L431
+L115: sub L280, *r4
+jmp L24
+L116: jmp L424
+L117: prn r4
+L118: bne *r5
+L119: red r1
+jsr L224
+L120: jsr *r3
+L121: clr *r5
+bne L81
+add r1, L64
+L122: cmp L127, L60
+L123: stop
+L124: .data -103, -5, -364, -531
+clr L354
+
+prn r0
+L125: prn *r7
+L126: clr *r3
+clr *r3
+L127: rts
+L128: dec *r0
+L129: rts
+red L564
+L130: clr *r1
+lea L118, *r5
+L131: cmp *r3, #-109
+L132: dec L113
+stop
+L133: inc r3
+bne L260
+L134: inc r5
+sub *r6, r7
+L135: dec L6
+L136: cmp *r1, L347
+
+red *r2
+L137: clr *r0
+inc *r1
+cmp *r7, L77
+L138: not L215
+stop
+add *r4, L407
+L139: bne *r3
+L140: jsr *r7
+rts
+L141: mov #-200, *r7
+cmp r4, L136
+L142: clr r6
+jsr L57
+L143: .data 700, 14
+red L31
+jmp L214
+cmp #-24, r3
+L144: jsr L21
+L145: red L128
+bne L172
+bne L30
+L146: cmp #87, *r3
+red L131
+L147: not r1
+L148: .data 238, 247, -816, -719
+add r3, r3
+rts
+L149: jsr L145
+bne *r4
+bne L384
+clr *r2
+L150: red *r7
+L151: lea L32, *r2
+L152: rts
+L153: cmp r0, L134
+L154: inc L184
+cmp #107, r5
+L155: clr r3
+
+L156: jsr L552
+bne L207
+L157: .string "qxqpvtlmdvecn"
+L158: lea L266, r0
+L159: .string "jhhsujokqls"
+L160: add r5, r3
+mov L525, r3
+L161: jmp *r5
+L162: red *r7
+L163: sub #47, L38
+L164: jmp *r4
+L165: .string "dbtvqgcjitdbiatmxu"
+L166: rts
+L167: rts
+sub *r2, L471
+clr r4
+L168: .string "gcvzv"
+L169: stop
+mov #-88, r6
+jsr *r2
+; comment
+L170: mov r3, L515
+jmp L601
+mov *r3, *r2
+L171: sub #110, L30
+L172: stop
+L173: prn L7
+jmp L16
+L174: .data 345, 825, 320, -801, 72, 622, 807, -366
+L175: stop
+L176: stop
+L177: lea L180, *r2
+L178: cmp *r7, L177
+L179: add *r5, L68
+; comment
+L180: not *r1
+L181: clr r1
+jsr L93
+L182: red L66
+L183: jmp *r0
+L184: add L83, r1
+L185: .string "ddpdmdbladuuejmg"
+sub #-72, L29
+L186: red r6
+
+L187: jsr *r0
+bne *r5
+jsr L251
+L188: prn #-50
+L189: prn L104
+inc r1
+add *r2, *r1
+cmp #148, r7
+not r7
+L190: red r0
+L191: .string "xvmygccsgznxqsc"
+clr L44
+L192: lea L134, *r5
+L193: .string "jwokorylmryevv"
+L194: rts
+prn #123
+L195: .data 721, -240, 547, -993, 837, 152
+L196: not *r4
+stop
+; comment
+add r6, L157
+L197: mov #158, L175
+add L82, r6
+L198: mov *r7, *r3
+jmp *r6
+mov *r2, *r5
+prn #123
+L199: add r7, L25
+L200: mov *r3, r1
+L201: dec *r0
+L202: dec *r3
+
+L203: rts
+L204: mov r4, *r3
+L205: mov #89, *r5
+lea L149, L195
+L206: rts
+cmp *r0, #-152
+red *r2
+L207: lea L389, *r1
+clr r4
+L208: jsr *r4
+L209: cmp *r2, r7
+L210: dec *r1
+L211: add *r4, L578
+bne L56
+jmp *r4
+L212: stop
+; comment
+L213: dec r2
+stop
+L214: lea L66, *r6
+rts
+L215: .string "ungikvlioz"
+L216: cmp #-120, #198
+L217: .data -75, -73, -423
+L218: stop
+L219: .data 152, -709, 904, 659, 377, -696, 702, 200
+L220: not *r3
+L221: prn #47
+add #-208, L122
+dec L119
+L222: inc r0
+L223: bne *r2
+; comment
+rts
+L224: add *r1, r6
+prn #248
+add *r4, r5
+L225: add r3, L17
+stop
+L226: cmp L347, #6
+L227: cmp *r1, r3
+L228: red *r2
+L229: red r1
+L230: lea L521, *r0
+prn L112
+L231: dec *r5
+red *r1
+L232: prn L451
+rts
+red *r5
+L233: prn *r3
+inc r7
+L234: .data 223, -265, -269, -451, 792, 564, -334
+
+L235: .data -363, 924, 512, -108
+L236: dec *r5
+not r1
+L237: jsr *r7
+L238: jsr *r6
+clr *r5
+L239: .data -654, -395, 773, -557, 310, 949, 222
+L240: dec r1
+L241: mov *r3, *r4
+L242: .string "p"
+
+L243: inc *r3
+L244: jsr *r1
+L245: red *r5
+lea L182, *r6
+L246: bne *r7
+L247: bne *r5
+L248: stop
+L249: add *r4, r1
+lea L466, *r2
+rts
+L250: clr L194
+L251: prn *r6
+inc *r4
+
+
+
+L252: dec L8
+L253: mov #-159, r6
+lea L213, L318
+L254: cmp *r1, r7
+L255: .data -133, 952, -441, -519, 757
+prn r2
+L256: red L201
+L257: jsr L561
+L258: stop
+dec r2
+L259: inc L351
+inc r5
+L260: .string "qd"
+L261: sub *r3, L210
+L262: not r3
+L263: inc L430
+bne *r4
+L264: inc *r7
+; comment
+L265: .string "pkcvynrggeofjcwwykjo"
+L266: prn L597
+L267: jmp *r5
+; comment
+L268: .data -777, 431, -234
+add #-135, *r3
+dec L237
+jsr L131
+cmp *r3, #-243
+L269: red L81
+L270: .data 45
+L271: mov r6, L572
+L272: jsr *r7
+L273: inc r3
+stop
+stop
+L274: red L479
+jmp *r5
+; comment
+lea L240, L342
+red L147
+L275: mov r3, *r5
+L276: prn #-69
+L277: sub L181, *r7
+L278: inc L403
+
+L279: not r3
+inc *r5
+L280: .string "skdnph"
+L281: red L236
+
+L282: jsr L384
+L283: add r6, r0
+L284: jsr *r7
+L285: jmp *r7
+sub *r7, r7
+L286: .string "sswuzhf"
+inc L429
+clr *r6
+inc r4
+L287: rts
+L288: dec *r5
+sub r6, r0
+dec L565
+jsr *r5
+L289: bne L436
+lea L49, *r1
+L290: jsr *r3
+L291: red *r0
+dec r4
+L292: prn *r1
+L293: .data -896, -311, 168, -953, 798, 997, 620
+L294: clr L340
+
+L295: jmp *r3
+
+L296: rts
+L297: sub L543, L244
+L298: .string "ytxywqxcnorinixhgb"
+L299: cmp r3, *r7
+L300: .data 256, -331, 246, 847, 844, 515
+inc *r3
+L301: jsr *r4
+L302: cmp L117, L121
+L303: inc *r1
+L304: clr L297
+L305: .string "dpmvavauvdgnl"
+L306: add #-77, r2
+L307: stop
+L308: bne *r5
+L309: bne L403
+L310: not *r1
+inc r5
+not r3
+L311: jsr *r2
+
+L312: .data -35, 36
+L313: dec r4
+bne L155
+red r5
+L314: jsr *r2
+rts
+L315: .string "kf"
+L316: sub L177, *r3
+jmp L54
+L317: .data -602, 203, -230, 293
+L318: jmp *r7
+L319: sub r3, r5
+L320: sub *r7, r2
+L321: rts
+jsr *r7
+L322: jmp *r3
+; comment
+
+dec r4
+L323: lea L290, r5
+L324: .data 768, 302, -869, 807, -745, 734, 502
+jsr *r7
+L325: cmp #-96, #-69
+L326: .data -397, 430, 969, 23
+clr L375
+not *r1
+add L341, *r1
+L327: rts
+L328: lea L503, *r1
+L329: dec r2
+jmp L371
+stop
+dec r1
+L330: clr L116
+L331: jmp *r1
+L332: lea L170, L372
+cmp *r6, #-137
+L333: jmp *r5
+L334: not r7
+jmp L577
+rts
+L335: .data 976, -171, 209, 422, 96
+L336: dec *r0
+L337: rts
+L338: sub *r6, L227
+jmp L595
+L339: jsr L492
+L340: .data -791, -477, 394, -489, -875, -510, -56, -188
+lea L5, r4
+mov r4, L247
+L341: rts
+L342: .string "aidzuywvepweuslfviamiuuj"
+L343: jsr L393
+L344: jsr L540
+L345: jmp *r3
+rts
+
+mov r6, r4
+rts
+L346: .string "frylafl"
+add #-238, r0
+lea L511, *r7
+L347: .data -992, -634
+prn *r0
+L348: sub r1, r0
+L349: .data -420, 231, 979
+L350: stop
+bne *r0
+L351: cmp #-249, L93
+L352: add r0, r5
+L353: rts
+L354: inc *r2
+not r7
+L355: jsr L136
+L356: add #197, r3
+L357: .string "fzffvsngawslasb"
+L358: prn #-132
+dec L257
+add r3, r0
+rts
+L359: .string "qfogebcxcu"
+; comment
+L360: bne L438
+L361: sub r0, L201
+L362: sub r3, *r5
+L363: red r1
+L364: inc *r7
+L365: .string "fmlfcnjjg"
+L366: prn *r6
+sub r3, r5
+inc r5
+bne *r4
+add L413, *r0
+L367: jsr L409
+
+L368: clr L168
+not r3
+jmp L28
+L369: .data 606
+rts
+cmp *r1, r1
+L370: not r2
+L371: jmp L258
+add *r5, *r4
+L372: not L323
+L373: red r1
+jsr L523
+bne L423
+mov *r5, L443
+L374: stop
+L375: prn r2
+L376: red r1
+L377: prn #1
+jsr L557
+jmp *r1
+red *r5
+L378: .data -400, -232, -148
+not r4
+L379: jmp L445
+L380: cmp #-25, *r4
+L381: stop
+L382: red L14
+L383: add #198, L456
+sub r4, L328
+L384: red r3
+L385: jmp L361
+L386: inc *r0
+lea L157, L555
+L387: prn *r2
+L388: red *r5
+L389: rts
+L390: add L0, L3
+bne L457
+L391: inc *r0
+L392: lea L416, *r1
+L393: stop
+inc r7
+L394: .data 135, 647, -101
+clr *r4
+inc r2
+L395: add r2, *r5
+add L409, *r4
+mov r2, r6
+jsr *r4
+L396: bne L486
+L397: rts
+L398: .data -787, 262, -659, 882, -7, 893, 535, 965
+L399: jsr L327
+L400: stop
+L401: .string "iodwrudunzisefscbfbpnjr"
+red *r6
+; comment
+lea L332, L496
+L402: inc *r5
+L403: red L599
+L404: .string "pgzwqnuyxkwsqsieszpmgd"
+stop
+L405: jmp *r0
+clr *r7
+
+L406: add L104, r4
+L407: inc L561
+not r5
+stop
+sub L556, L528
+L408: jsr *r4
+L409: bne L2
+L410: sub *r3, r6
+L411: inc r5
+L412: red L529
+inc *r7
+; comment
+lea L531, *r0
+L413: bne *r3
+L414: .string "czydwmmesyervr"
+not L270
+L415: prn L453
+rts
+L416: clr L582
+red L468
+L417: jsr *r2
+L418: sub r4, L226
+L419: sub r1, r7
+; comment
+L420: bne *r4
+mov *r3, L312
+L421: jmp L441
+L422: rts
+rts
+clr r7
+; comment
+
+stop
+bne L520
+L423: .string "pqbiexzxgnphtmdq"
+L424: prn L542
+L425: clr *r5
+red *r2
+inc *r2
+rts
+jmp L508
+L426: lea L518, *r5
+inc *r6
+L427: .data 719, 733, 869, -65, -877
+; comment
+L428: cmp L236, #53
+jsr *r5
+jsr L14
+L429: jmp *r6
+L430: lea L550, *r7
+L431: clr r0
+L432: clr L556
+bne L272
+
+L433: bne L156
+L434: dec L161
+L435: jmp *r5
+L436: stop
+L437: stop
+lea L416, *r4
+L438: bne L40
+L439: stop
+lea L524, r6
+inc *r1
+add #-52, *r3
+; comment
+; comment
+mov L135, L341
+L440: bne *r6
+; comment
+rts
+L441: jsr L462
+L442: red r3
+L443: not r5
+L444: rts
+mov *r1, L492
+mov #-130, L602
+L445: add *r1, r7
+bne *r0
+
+not *r6
+not r1
+lea L346, L548
+L446: stop
+L447: cmp r5, L128
+L448: red r0
+L449: lea L496, *r4
+L450: jsr L457
+L451: .data -108, 716
+L452: inc r5
+L453: jmp L475
+stop
+L454: not *r7
+L455: clr *r4
+bne L517
+L456: .string "lwpqkxuo"
+jsr L208
+red L358
+jsr *r0
+lea L538, r0
+L457: rts
+L458: rts
+L459: not r6
+L460: stop
+L461: inc *r2
+jsr L562
+L462: stop
+L463: jsr *r3
+not L152
+lea L201, r1
+L464: inc r7
+L465: not L575
+L466: mov r4, *r2
+L467: not *r4
+prn *r2
+L468: mov r6, *r7
+lea L600, L57
+L469: dec r7
+L470: lea L502, *r6
+inc r3
+L471: lea L480, *r3
+prn L46
+L472: .string "bwi"
+cmp L491, L62
+L473: add L405, *r5
+L474: .data 333, -960, -375
+L475: dec *r6
+L476: jsr L224
+L477: red *r1
+L478: sub *r3, r6
+not *r4
+sub L236, L489
+
+L479: add L553, r2
+L480: add L562, L9
+rts
+red L548
+; comment
+L481: mov #-155, r6
+L482: mov L557, *r3
+sub #213, r2
+jsr L335
+jmp L33
+L483: rts
+L484: .string "gipodgsfqbgavsca"
+L485: dec *r4
+jmp *r1
+L486: not L496
+add L23, r3
+mov *r1, *r6
+L487: stop
+L488: red r1
+L489: clr r6
+L490: lea L338, *r5
+L491: dec r7
+L492: prn L156
+L493: .data -584, -126, 149, -587
+jsr L546
+dec r7
+L494: not r5
+L495: sub L552, r3
+L496: sub r3, L537
+clr *r2
+dec *r0
+L497: clr r1
+red *r0
+L498: dec r0
+L499: clr r3
+L500: stop
+L501: not *r4
+bne *r5
+dec *r2
+mov r5, r3
+L502: .string "qtmojtqwkfakccxlb"
+L503: red r1
+red r3
+L504: not r3
+L505: .string "drjesc"
+L506: red *r6
+L507: bne L579
+L508: .string "ghqbgnkgyztfmiprhdiognam"
+L509: .data -147
+L510: add #-79, *r1
+L511: stop
+jmp L328
+L512: rts
+clr r2
+red *r3
+L513: sub #167, *r0
+L514: inc L582
+dec *r3
+L515: .data 774
+L516: jsr L376
+L517: jsr *r4
+L518: add #-190, r7
+L519: .data -692, -815, -466, 1
+L520: mov L546, *r2
+L521: not r4
+clr L552
+L522: not L564
+L523: sub r0, L559
+L524: red *r2
+; comment
+lea L599, r4
+L525: .data -514, -30, -259
+L526: sub r1, r6
+L527: jsr *r0
+L528: jmp *r6
+prn #-205
+L529: not r7
+L530: .data -686, 732, -172, 218, 474, 90, 437
+L531: inc L88
+bne L493
+bne L543
+L532: rts
+L533: add *r1, *r2
+L534: .data 732, 841, 170, -832
+inc r5
+L535: clr L545
+L536: red r5
+L537: .string "jzzixp"
+L538: cmp #202, L602
+L539: sub L426, *r0
+L540: rts
+L541: sub *r4, r0
+inc r1
+L542: clr L11
+
+L543: .data -628, 949, -667, 784, 886, 1
+jsr L392
+
+L544: prn r1
+L545: mov *r6, L143
+L546: jsr L574
+sub L587, r7
+L547: cmp L491, #-35
+L548: jsr L604
+L549: dec L587
+mov r5, r1
+L550: .string "mapgcsdeygaguvrckokqneh"
+add *r7, r7
+rts
+L551: inc *r1
+; comment
+not L29
+; comment
+jmp *r6
+L552: bne *r7
+L553: dec *r4
+red *r1
+L554: not L456
+L555: clr r2
+clr *r0
+L556: lea L571, *r4
+L557: rts
+; comment
+clr L108
+L558: bne *r4
+L559: jsr *r0
+red L583
+mov L561, *r7
+L560: .data 38, 311, 861
+L561: not L569
+L562: prn r3
+L563: red L156
+L564: lea L566, r0
+inc L408
+prn #176
+dec L337
+L565: cmp #-115, r7
+
+L566: lea L598, L512
+L567: stop
+L568: add r2, *r1
+
+L569: inc L598
+L570: dec L139
+cmp r5, r6
+inc r5
+bne L308
+L571: stop
+L572: rts
+L573: not r3
+L574: lea L576, r4
+L575: cmp *r5, *r7
+bne L591
+L576: sub r1, L407
+L577: lea L579, *r5
+L578: .data 665, 12, -239, 593, -905
+L579: .data 206, -326, -928, 284, 505, 840, 580, 495
+L580: dec L601
+L581: clr r3
+mov *r5, *r7
+L582: jmp *r5
+L583: clr r1
+L584: .data 971, 290, -495
+clr L96
+prn *r2
+L585: jmp *r4
+L586: jmp *r5
+L587: lea L370, L595
+L588: rts
+L589: lea L598, L409
+bne *r5
+jsr *r5
+L590: stop
+L591: .data -294, 17, -833, 415
+jsr *r3
+L592: clr *r5
+L593: jmp *r0
+stop
+L594: .data -58, 683
+stop
+not *r0
+L595: sub *r6, *r2
+L596: stop
+mov L582, r2
+lea L603, r7
+L597: .data -261, 540, 399, -643
+L598: dec L173
+L599: jmp *r5
+L600: mov *r0, L601
+L601: jsr L605
+L602: add L606, r2
+not L71
+L603: clr L605
+
+L604: lea L606, *r7
+L605: mov *r7, r7
+L606: sub L181, r1
+red r4
+stop
@@ -0,0 +1,1042 @@
+; Generated by genCorpus --seed 53
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+.entry L624
+; comment
+dec r3
+L0: red L0
+L1: mov #-150, *r3
+L2: stop
+L3: stop
+lea L49, *r4
+L4: jmp *r4
+L5: add L5, L592
+not r3
+bne L2
+cmp L156, *r5
+L6: .string "wdkovxaspis"
+not L132
+jmp *r6
+L7: red r7
+L8: jmp L6
+dec L6
+L9: inc *r3
+stop
+L10: .data -388, -487
+rts
+L11: lea L350, r5
+L12: clr r4
+L13: dec L9
+dec r2
+dec L10
+L14: .string "hbdunqg"
+L15: lea L1, *r7
+L16: mov r5, *r0
+jsr *r2
+L17: jsr L298
+L18: .string "pxtc"
+L19: bne *r1
+L20: bne *r0
+L21: dec *r6
+L22: .data 699, 470, 560, 859, -484, -131, 805
+L23: .string "achpqcveo"
+prn L12
+L24: lea L20, L3
+L25: inc L0
+L26: .data -35, -630, 23, -147, -282
+L27: .string "ztd"
+bne L6
+L28: add L147, L19
+sub *r7, L395
+jmp *r3
+L29: sub r7, *r0
+red *r3
+L30: dec L1
+inc *r7
+prn r2
+clr L14
+jsr *r0
+L31: .data -700, 606, -245, 887, 275
+L32: clr r7
+L33: .data -837, 491, -579
+rts
+L34: clr L423
+stop
+L35: sub r1, L24
+L36: red *r5
+L37: rts
+clr r5
+
+L38: cmp *r2, r1
+add *r6, r4
+L39: mov *r4, r0
+L40: add r3, r4
+L41: sub L25, r2
+jsr *r4
+L42: .data -202
+L43: jmp *r7
+L44: .data 277, 444, 917, -689, 988, 562, -151, -365
+L45: bne L6
+L46: jmp L334
+L47: cmp #-77, r1
+L48: mov L234, L266
+L49: clr r2
+cmp *r6, *r7
+L50: stop
+L51: bne L42
+inc r1
+L52: stop
+L53: stop
+L54: .data -960, -228, -256, -991
+jmp L35
+L55: cmp L168, L426
+L56: dec *r1
+red L546
+L57: .data -880, 220, 173, 269, -530, 848, -636
+L58: add r7, r6
+L59: clr L24
+L60: mov *r2, r5
+L61: rts
+L62: inc r6
+L63: rts
+L64: .data -425, 719, -94, -183, -366, 475, -85, 870
+bne *r0
+L65: .data 995, -809, -32, 993, -781, 439, 763
+cmp #-53, *r5
+L66: stop
+lea L7, L1
+not L48
+stop
+add #223, L171
+clr *r2
+not *r3
+rts
+bne L46
+L67: sub *r3, L550
+
+L68: .string "vvmtwrrh"
+L69: .data -858
+L70: add L46, L5
+L71: lea L335, r1
+L72: stop
+L73: prn L29
+jsr L35
+bne *r7
+L74: stop
+L75: .string "xquyakswwjprioqbtil"
+
+bne L318
+L76: lea L38, L56
+L77: jsr *r0
+clr r2
+jmp L180
+; comment
+L78: bne L260
+L79: prn #148
+L80: stop
+L81: jsr L25
+L82: mov #-186, L24
+
+bne *r0
+bne L16
+L83: red r1
+L84: rts
+L85: rts
+L86: rts
+L87: bne L459
+L88: prn L77
+L89: sub r2, r2
+L90: inc *r7
+L91: mov L70, r0
+
+L92: .data 136, 999, -550, -312, -480, -398
+L93: dec *r6
+L94: clr *r4
+L95: jmp *r3
+L96: .string "bmwuchyqayspzmlhbxqjsz"
+red *r1
+cmp L42, L0
+L97: lea L269, *r1
+L98: dec *r7
+L99: lea L3, L45
+L100: jmp *r0
+cmp L222, *r6
+L101: bne L120
+L102: rts
+jmp *r2
+dec r6
+L103: clr r3
+L104: clr r6
+L105: mov r5, L25
+L106: .data 364, 234, 41, -201, -589, -321, -304, 930
+L107: sub *r1, r1
+L108: rts
+L109: cmp r3, #-69
+L110: lea L470, r7
+L111: add r1, L75
+inc *r2
+L112: not r3
+L113: stop
+L114: mov #250, L615
+L115: .data 728, -108, -636, 482
+jmp *r4
+L116: .string "lphhfkdlpkxskerolomonqru"
+L117: clr r2
+L118: prn L193
+red r0
+L119: red *r0
+L120: dec L243
+L121: add L3, r3
+L122: prn #-67
+L123: jsr L47
+L124: rts
+L125: mov *r5, L137
+L126: mov #-4, L118
+L127: lea L410, *r3
+cmp L12, *r2
+L128: not *r3
+L129: .data -372, 898
+L130: .string "gpxcgxcgqzzinclr"
+L131: sub *r7, *r1
+L132: bne L20
+L133: .string "i"
+L134: .data 794, -639, -544, 323, -376, -236, -83, 794
+L135: inc r4
+lea L101, r3
+L136: .data -917, 193, -949, -502, -638
+L137: .string "fpesllzsvyngnfty"
+L138: stop
+prn r7
+clr r0
+dec L19
+L139: not L207
+L140: .string "tngxdzldmere"
+L141: prn #-213
+L142: mov #-63, *r5
+
+L143: stop
+add L44, r1
+L144: cmp r5, L282
+L145: not *r3
+L146: jmp *r7
+inc L231
+L147: stop
+dec r1
+stop
+jsr L66
+dec r1
+add L5, *r4
+L148: jmp *r1
+L149: lea L51, r4
+L150: .data -80, -930, -13, 651, 856, -156, 317
+inc r0
+L151: mov *r4, r0
+rts
+mov *r5, r6
+dec L603
+L152: lea L205, *r6
+lea L83, r0
+not *r2
+L153: clr r7
+L154: inc *r4
+L155: add *r7, *r2
+L156: sub #-235, r5
+L157: red L102
+add *r6, r3
+L158: cmp *r6, *r3
+not L597
+L159: clr *r4
+sub #152, *r4
+L160: add #-82, L511
+L161: stop
+L162: red r6
+L163: jmp L465
+bne L170
+jmp L74
+sub #96, L420
+L164: .data 578, -237, 555, 943, 456, 360
+L165: prn #-141
+L166: dec L78
+mov #16, L27
+L167: inc *r7
+jsr L454
+L168: inc *r7
+L169: not r7
+L170: jsr L161
+L171: prn *r7
+clr r4
+L172: jsr L105
+L173: inc r7
+L174: .string "foeysq"
+
+bne L572
+L175: dec *r6
+L176: lea L401, r0
+not *r6
+L177: dec r5
+L178: add L324, *r4
+L179: .string "fnreezqlndltwvztt"
+L180: .string "awlfnicgubsmtzicoqnnckho"
+L181: stop
+add r1, *r2
+L182: prn *r3
+jsr *r2
+lea L409, r6
+not r0
+L183: bne L218
+L184: inc r2
+L185: add L624, L103
+
+jsr L331
+L186: add L216, L47
+L187: stop
+cmp *r4, *r3
+L188: .string "xmkmauqdqtirechky"
+jsr L253
+L189: add L260, *r2
+L190: not L126
+L191: bne L542
+L192: .string "vglgsjrwjkbpdktwafvezqxd"
+L193: jsr *r7
+L194: clr L251
+sub *r4, L131
+; comment
+L195: prn L88
+lea L136, *r4
+dec r2
+L196: clr L176
+L197: clr *r7
+red r3
+L198: inc r6
+L199: cmp #-140, *r2
+L200: prn #-207
+prn *r6
+L201: dec *r6
+L202: sub *r6, r3
+L203: add L361, L165
+L204: stop
+L205: jmp L145
+cmp *r5, *r4
+add *r0, L137
+add *r7, r4
+dec L41
+L206: inc *r6
+L207: cmp #-52, #-57
+L208: not *r2
+; comment
+L209: jsr *r4
+L210: bne L114
+stop
+L211: not L187
+prn r7
+bne L447
+L212: prn #183
+L213: sub r0, *r2
+L214: bne *r0
+L215: jsr L251
+; comment
+bne L278
+sub L233, r2
+L216: .data 313, -778, 870, 858, 281
+L217: sub L38, r4
+L218: lea L374, L119
+cmp r7, L9
+L219: inc L421
+L220: prn L485
+; comment
+L221: jsr L77
+mov #-229, *r5
+L222: stop
+L223: stop
+L224: clr L10
+rts
+L225: prn r6
+L226: red *r2
+L227: not L350
+prn r4
+L228: not *r2
+L229: sub r0, *r0
+L230: lea L607, r5
+dec r4
+L231: lea L181, r4
+L232: inc L32
+sub r2, L212
+L233: jmp L530
+stop
+L234: sub *r7, *r6
+L235: clr r0
+L236: inc L32
+L237: add #115, r7
+L238: bne L428
+dec r3
+L239: lea L120, r7
+L240: red *r3
+L241: add *r5, L24
+L242: cmp #8, L144
+not L230
+L243: .string "wnnllhxupxgzthzypomktbhj"
+L244: mov *r3, L237
+L245: .string "jdkdhboaixyntxusgtzupbhc"
+add *r1, *r1
+L246: jsr L202
+L247: sub r2, *r3
+jmp L483
+cmp #209, #73
+L248: .data -950, -678
+L249: bne L445
+L250: jmp L116
+add L531, r2
+L251: not L207
+not r6
+L252: bne *r6
+L253: mov L599, L159
+L254: not L114
+L255: inc L360
+L256: clr r5
+L257: .string "rzdhkxpugbckhxrws"
+stop
+jmp L198
+L258: stop
+L259: inc r3
+bne L560
+L260: stop
+L261: jmp L598
+inc L353
+L262: red *r3
+L263: add r0, L374
+L264: prn #-182
+L265: sub r3, *r3
+L266: bne *r5
+red r4
+dec L600
+L267: lea L600, r3
+L268: red *r0
+rts
+L269: prn r1
+inc L38
+L270: inc *r3
+; comment
+L271: .data -158, 409, 866, 72
+L272: mov *r4, *r6
+L273: red *r0
+L274: stop
+
+L275: mov #-201, r0
+L276: inc L201
+jsr *r1
+L277: sub *r7, r6
+rts
+L278: inc L232
+cmp *r7, r7
+L279: prn #160
+L280: stop
+L281: dec L90
+L282: sub *r5, r6
+; comment
+lea L220, L361
+L283: .string "syho"
+L284: red *r5
+rts
+L285: bne L335
+L286: rts
+clr *r2
+dec *r2
+bne L409
+L287: jsr L115
+L288: clr L409
+not *r6
+L289: .string "kvcwjomddsnjistt"
+red r0
+clr L277
+dec r0
+L290: add *r3, L310
+inc *r3
+L291: sub #174, L78
+L292: lea L362, r3
+L293: jmp L124
+jmp *r5
+L294: prn #107
+L295: mov #-250, r4
+L296: red r2
+L297: rts
+L298: .string "tayqv"
+L299: .string "crfoct"
+cmp *r3, r3
+L300: dec r1
+L301: jsr *r3
+; comment
+L302: inc L335
+L303: red L126
+prn #255
+L304: inc L45
+L305: clr r4
+jmp L286
+L306: .data 375, -516, -704, -2
+cmp r7, L96
+L307: stop
+cmp #61, #76
+L308: not *r1
+dec r4
+L309: .data -94, 979, 939, 484, 612, 116, 916, -476
+prn *r2
+stop
+prn #73
+mov *r6, *r1
+L310: lea L596, r7
+stop
+L311: prn #-2
+L312: jsr *r7
+L313: lea L329, L533
+sub L553, *r1
+cmp L255, *r1
+L314: .string "iys"
+dec L373
+L315: bne L305
+; comment
+L316: jmp *r5
+L317: stop
+L318: stop
+L319: lea L475, *r1
+L320: not r7
+mov r2, *r1
+L321: sub L59, r3
+bne *r0
+L322: lea L88, L348
+jmp L463
+rts
+rts
+clr r4
+L323: .string "jlafdxokeduzpluzb"
+L324: not L379
+
+
+cmp *r1, r4
+clr *r1
+not *r0
+red r3
+
+L325: jsr *r4
+; comment
+L326: .string "muollvsthoobpipe"
+cmp *r1, L238
+clr *r6
+
+L327: .data -270, 185, 228, 567, 38, 602, -288, -919
+L328: add *r4, L532
+L329: bne L270
+add r3, *r3
+L330: add r6, *r6
+stop
+dec r2
+add L171, r1
+L331: sub #-233, *r4
+L332: dec L405
+L333: not L405
+L334: clr L94
+L335: bne L68
+L336: add L222, *r7
+L337: not L269
+L338: not *r6
+L339: .data -410, -687, 764, 679, 951, -602
+L340: stop
+L341: red r0
+L342: stop
+L343: not r6
+L344: cmp #126, r5
+L345: inc L87
+L346: .data 589, -802, 394, -586, 249
+lea L81, r5
+sub r3, L310
+dec *r1
+dec L3
+L347: not *r0
+
+L348: add *r4, *r5
+
+L349: add L515, *r1
+L350: cmp #-200, r2
+L351: rts
+cmp r1, #-11
+L352: mov L267, r1
+L353: clr *r5
+inc L330
+L354: dec *r0
+L355: not *r0
+L356: inc L338
+L357: add L563, L576
+L358: clr *r7
+L359: clr *r6
+L360: bne *r2
+L361: .string "xqitncjwfiesemg"
+L362: jsr *r2
+rts
+L363: sub L479, L148
+L364: rts
+L365: .data -998, 971, -782, 435
+L366: clr *r6
+add #-127, *r4
+sub #-40, L149
+L367: prn r1
+L368: lea L434, r3
+bne *r7
+cmp r4, #66
+red *r6
+L369: clr r7
+L370: jmp *r1
+sub *r0, L374
+L371: .string "uoswiknrnipax"
+add r5, r4
+clr *r5
+inc *r4
+L372: lea L8, *r7
+L373: mov L249, *r0
+L374: mov L17, L618
+lea L388, *r1
+L375: add L546, *r6
+L376: .data 394, -706, -403, 144, -452, 947, 928, -223
+L377: bne *r0
+L378: jmp L128
+L379: lea L461, *r3
+L380: red *r4
+mov *r4, L141
+L381: .string "kzmfreprdujwxaxgcpiaxua"
+L382: .string "rgqpfgkogz"
+L383: clr r4
+L384: red r2
+L385: cmp L588, #-230
+L386: mov L159, r2
+mov *r3, *r0
+L387: jsr *r7
+lea L474, r0
+sub #-122, *r3
+L388: dec *r5
+add r6, *r6
+L389: jsr *r0
+L390: lea L169, *r1
+L391: dec r1
+L392: sub *r4, *r4
+L393: cmp L508, L115
+L394: prn #129
+red r0
+L395: jsr *r0
+L396: .data 530
+sub *r5, r5
+lea L73, *r7
+L397: cmp #-180, r5
+
+L398: .data -634, -1, -646, 598, -650
+L399: .data -432, -442, 248, 499, 195, -46
+L400: not r5
+prn r2
+L401: .string "pi"
+not *r7
+L402: sub r0, *r2
+L403: prn L479
+clr *r4
+L404: jmp L13
+
+L405: .data -376, 462
+L406: not L623
+L407: rts
+L408: prn L145
+; comment
+L409: clr L50
+L410: not *r5
+stop
+L411: .string "jhjfcqfmlgrgtlfyvzl"
+L412: .data 643, 694
+L413: red *r6
+L414: add #79, *r1
+L415: .data 619, 748, 667, 310, -322, -435, 576
+L416: jmp L88
+L417: .data 752, 368
+rts
+L418: .data -235, -22, 704
+L419: cmp r2, *r0
+rts
+L420: .string "yrwosqnjzljxplzjwycjcd"
+L421: prn *r0
+sub r1, L425
+L422: red L102
+jsr *r5
+
+stop
+L423: jsr L142
+mov L325, L102
+rts
+; comment
+L424: dec r7
+prn r2
+clr *r2
+L425: jsr *r4
+L426: rts
+clr L561
+L427: not r7
+L428: inc r3
+L429: red *r0
+jmp L434
+cmp r0, #26
+L430: jsr *r6
+dec *r0
+jmp L576
+dec r3
+L431: cmp r5, *r1
+L432: add L525, r1
+L433: lea L280, L606
+L434: .string "ewpr"
+cmp #160, L392
+L435: add L494, *r3
+L436: jmp L425
+L437: .data 16, -101, 359, -123, 778, 833, 959
+L438: .string "gvnfcnge"
+L439: jsr L107
+prn *r1
+L440: prn *r6
+mov *r6, r2
+L441: .data -867, 739, -599, 146
+L442: .string "kzsopipnmcffre"
+L443: red L455
+L444: prn *r7
+L445: jmp L557
+L446: red L364
+mov L268, *r5
+
+L447: inc r6
+L448: prn #46
+L449: jmp *r5
+dec r2
+jmp L17
+sub *r3, r4
+L450: cmp L491, *r5
+rts
+L451: .data -754, 923, -831, -608, -180
+not *r2
+red *r4
+L452: dec L509
+lea L411, L593
+bne L541
+inc *r6
+L453: clr r7
+L454: .string "jcqnptokemlpzegteob"
+lea L460, r3
+L455: inc L342
+dec r3
+L456: inc r6
+; comment
+L457: jmp *r0
+mov *r4, *r5
+L458: mov r0, r7
+add L292, r5
+L459: stop
+L460: mov #-66, *r3
+L461: cmp r6, r0
+L462: dec *r7
+L463: cmp *r0, r1
+L464: not r0
+L465: stop
+L466: jmp *r6
+L467: cmp #-143, r5
+clr r6
+L468: .data -500
+L469: stop
+L470: mov #-21, r3
+L471: prn r2
+cmp #-150, *r4
+jsr *r3
+L472: rts
+L473: jmp L593
+L474: clr L496
+add r6, L608
+inc *r6
+stop
+
+dec L345
+add *r5, r3
+L475: jsr L506
+L476: prn r7
+L477: add #-193, L373
+jsr L342
+L478: sub *r7, *r4
+L479: rts
+L480: bne *r1
+stop
+sub *r6, L556
+sub L55, L140
+L481: bne *r0
+L482: mov r2, L156
+L483: rts
+L484: not *r1
+L485: rts
+dec *r4
+L486: clr r1
+L487: clr L53
+L488: mov *r6, *r1
+L489: add #11, *r5
+bne *r6
+L490: red L150
+L491: .data 912
+L492: .data -108, -904, -232, 311, -160, -879, -222, 9
+L493: .string "cqhyedljliujgeqeassanp"
+L494: jsr *r1
+L495: dec L295
+cmp L347, *r3
+L496: stop
+L497: .string "oukyrwrohnewecy"
+L498: inc L196
+L499: rts
+L500: sub L66, L535
+bne L605
+rts
+L501: prn L479
+L502: not r3
+red *r3
+lea L119, *r7
+cmp #186, #20
+sub *r4, *r1
+L503: jmp L352
+sub L532, *r3
+L504: .string "lepmixmsj"
+L505: clr L12
+not r7
+bne *r3
+dec L407
+inc *r2
+L506: not L433
+L507: inc L528
+not r0
+L508: clr *r0
+L509: .string "aiequrxut"
+L510: rts
+L511: .data -555, -477, 478
+stop
+bne *r5
+L512: inc *r5
+rts
+L513: red *r5
+L514: lea L364, L306
+cmp r3, r6
+inc r2
+stop
+L515: jmp *r0
+L516: jmp *r1
+; comment
+lea L558, L393
+add *r0, L552
+L517: add *r2, *r1
+rts
+L518: lea L544, L522
+L519: not *r6
+L520: inc r3
+sub *r1, *r6
+L521: inc *r7
+L522: sub r2, L276
+L523: mov *r6, *r2
+L524: stop
+add #-79, L445
+L525: add L261, L353
+clr *r2
+L526: jsr L94
+L527: jsr *r5
+L528: add #207, *r5
+L529: sub L547, L402
+L530: prn r1
+rts
+jsr *r4
+L531: jmp L591
+L532: jsr *r5
+L533: .data -501, 42, 136, 718
+L534: bne *r2
+L535: .string "uldtwbosunzsyfejiwafntya"
+L536: stop
+L537: not *r5
+bne L531
+L538: jsr L36
+L539: sub #203, r7
+; comment
+L540: jmp *r4
+stop
+add #107, *r4
+L541: not *r1
+L542: jsr *r5
+; comment
+inc *r3
+sub *r5, r6
+L543: cmp *r4, #-105
+L544: .string "kwjhmfmpseekje"
+L545: mov L561, *r7
+L546: dec *r0
+L547: red *r1
+L548: cmp *r6, r2
+L549: rts
+L550: mov #145, r7
+L551: dec r3
+sub r6, L553
+red r5
+L552: prn *r5
+jsr L620
+L553: prn L569
+stop
+add *r5, L376
+L554: .string "nikld"
+jmp *r4
+L555: dec L616
+L556: red *r3
+jsr L558
+L557: jmp L522
+; comment
+dec *r3
+L558: clr r6
+L559: rts
+L560: add #71, L586
+L561: rts
+not r3
+L562: prn *r5
+L563: sub #95, *r2
+rts
+; comment
+L564: stop
+inc r6
+add *r5, L610
+jsr L618
+rts
+not L620
+L565: mov r7, *r5
+L566: jmp *r4
+L567: jmp L556
+clr *r6
+bne *r5
+L568: prn *r6
+L569: jmp *r4
+L570: .string "zgafafvkmdrpggmt"
+clr *r2
+clr L584
+L571: sub r3, r5
+; comment
+clr r0
+L572: clr *r5
+L573: inc L610
+L574: bne L432
+inc L579
+L575: jmp L34
+L576: clr L609
+L577: bne *r5
+L578: sub *r6, *r3
+L579: sub #133, r1
+L580: .data -557, 944, 698, 553, 376, 623, 492, -980
+stop
+L581: cmp L422, #247
+L582: dec *r2
+L583: mov #-28, L608
+prn L593
+L584: bne L390
+stop
+L585: stop
+jmp *r5
+L586: jmp *r7
+L587: rts
+L588: .string "urokntakhxzvkcowyvzytr"
+L589: clr r0
+L590: clr r7
+L591: .string "yghggqqvyhvdldfusrddllue"
+mov #-27, r2
+L592: prn r7
+jmp L617
+L593: inc r4
+; comment
+jsr L614
+jmp *r2
+L594: dec L613
+L595: add *r4, L152
+
+L596: bne *r1
+L597: add #26, *r3
+L598: not L468
+; comment
+red r1
+sub *r0, *r5
+L599: .string "lrwkerjgygixmsm"
+L600: inc L298
+L601: stop
+add L491, *r6
+L602: stop
+L603: jsr *r4
+
+L604: .string "whywceesjiklldttc"
+cmp r5, r5
+jsr *r6
+L605: not *r2
+L606: inc *r4
+stop
+inc *r6
+L607: clr L204
+clr *r3
+L608: sub r1, L614
+L609: red r4
+lea L369, *r1
+cmp r3, *r0
+add r1, *r0
+L610: stop
+sub r1, *r2
+L611: red L617
+L612: lea L150, L45
+L613: .data 462, -993, -267, 668, 646, -549
+cmp *r4, *r2
+L614: .data 263, -57, -450
+
+L615: .string "d"
+L616: prn *r7
+L617: bne *r1
+stop
+L618: .string "npohatupkqils"
+rts
+L619: add *r4, L482
+L620: .string "vedtxilrndagzg"
+L621: mov #-134, r1
+jsr L547
+; comment
+prn L509
+bne *r2
+; comment
+cmp r1, *r7
+L622: jsr *r2
+L623: bne L624
+jmp *r0
+L624: .string "vlvzvnltaajuufclukmbeb"
+stop
@@ -0,0 +1,1043 @@
+; Generated by genCorpus --seed 54
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+.entry L624
+.entry L640
+L0: jsr L188
+L1: clr L0
+L2: prn L7
+L3: mov r4, *r5
+L4: lea L342, *r7
+add #141, L4
+L5: .data -225, -698, -730, -771, 932, 219
+L6: .string "cbsrvrcrakzxsxfnxiuhsmf"
+L7: .string "rlkxavjjbxagzlkyqijxbx"
+L8: prn *r7
+L9: sub L2, *r4
+L10: jsr *r2
+L11: bne *r4
+L12: prn r0
+L13: add r5, L516
+L14: sub L224, r3
+mov r3, *r7
+
+L15: .data 905
+L16: stop
+L17: lea L17, L131
+L18: prn L17
+L19: inc *r6
+L20: stop
+L21: .string "cmelrlbhtnippvyzy"
+L22: cmp #-203, *r0
+L23: bne L433
+L24: .data -137, 183, 209, -43, -969, -491, 42
+sub #-96, L14
+L25: dec r7
+L26: add r0, L159
+bne *r4
+L27: .string "nlrnrecuzbeqiezsqbdxjour"
+sub #-205, *r6
+bne L232
+L28: prn #-1
+
+mov *r4, r5
+L29: .data -352, 495, -218, 872, -351, -473
+L30: .string "rpuuffzhzhko"
+L31: stop
+dec r1
+L32: prn *r4
+prn r1
+L33: rts
+L34: lea L483, *r2
+red L338
+L35: jmp *r6
+L36: not r5
+L37: prn L21
+L38: .data -789, 47, -899, -599, -19, -460
+L39: stop
+not *r1
+dec r2
+L40: stop
+L41: jsr *r2
+jmp L39
+not L450
+inc r3
+L42: prn L318
+L43: add r1, r0
+L44: .string "jbjcsijsdyobhlowkrsibwf"
+L45: red L415
+L46: rts
+L47: not r6
+L48: add *r3, *r6
+
+bne L0
+L49: bne L4
+L50: not r2
+sub #-133, *r5
+lea L385, *r1
+stop
+L51: mov *r6, r3
+L52: lea L504, L6
+clr *r5
+L53: clr *r5
+L54: bne *r7
+L55: bne *r0
+stop
+L56: cmp L109, #11
+L57: add *r2, r1
+lea L54, L6
+L58: prn #166
+rts
+L59: jsr L192
+L60: red r7
+bne L606
+
+L61: .data -876, 114, -331, -365, -641, -91
+L62: rts
+L63: prn r5
+L64: add #111, *r3
+L65: .data 707, 582, -377, -616, -75, 139, -250
+L66: rts
+prn #-58
+dec L36
+L67: sub L585, *r2
+L68: rts
+stop
+L69: mov #-11, r6
+L70: .string "tviqgvzrkfyfgiuooos"
+L71: .data 482, 744, 97, -579, -966, -967, 613
+L72: prn *r2
+jmp *r2
+L73: .string "atjuzptg"
+L74: not r6
+L75: clr L68
+jsr L17
+L76: jsr *r0
+cmp *r2, L334
+L77: mov L4, L553
+L78: cmp *r3, L416
+L79: lea L463, r0
+not L605
+L80: jmp *r5
+L81: inc *r3
+inc r0
+L82: not r6
+L83: red r6
+L84: stop
+L85: red r1
+dec *r3
+L86: add #-133, *r4
+L87: prn #233
+rts
+L88: stop
+L89: .data 532, -92
+prn #25
+L90: jmp L29
+L91: add *r5, *r3
+L92: add #-27, *r6
+
+rts
+L93: rts
+L94: .data -12, 719, -474
+L95: bne L223
+inc r3
+bne *r3
+L96: jmp *r4
+L97: jmp *r3
+L98: red r4
+jmp *r2
+L99: mov *r1, *r2
+rts
+L100: prn r6
+; comment
+L101: add L91, *r6
+add L46, r4
+L102: inc L109
+L103: .string "bnzyyruwzoswdjgaqyuiqd"
+L104: .data -342, 87, 515, -785, 985
+L105: .string "eqklkp"
+L106: clr r6
+not L594
+L107: .string "tlfdqaoxuyawgkubqbmylzqh"
+L108: red *r1
+L109: cmp *r6, r3
+jsr *r1
+dec L42
+L110: bne *r2
+L111: .string "psghqzpbbfljmnybeb"
+L112: not r7
+L113: mov L59, L26
+L114: stop
+L115: inc r1
+jsr L381
+L116: clr *r7
+L117: .data 911, -725, 31, -630, -707
+mov L68, L9
+L118: prn L304
+cmp L183, r4
+L119: not r7
+inc *r3
+L120: .data -225
+bne L120
+L121: mov #238, *r1
+L122: lea L221, r4
+lea L355, *r5
+red L596
+L123: .data 382, -789, -674, 327, -618
+L124: jmp L159
+L125: jmp L594
+L126: clr *r3
+L127: bne *r0
+; comment
+L128: bne L503
+L129: mov L33, L8
+bne L244
+L130: bne L178
+bne L121
+L131: dec *r5
+L132: .data 661, 198, -747, 381, -956, -444
+; comment
+L133: jsr *r4
+L134: prn r0
+L135: bne *r4
+L136: clr L41
+clr *r7
+L137: stop
+clr L159
+L138: inc r7
+L139: dec *r4
+L140: red r4
+L141: dec *r6
+sub r6, *r3
+; comment
+L142: clr r4
+L143: add r0, *r5
+L144: .data -96, 748, 700, 520, 347, 663, 870, -377
+inc L358
+add #111, *r4
+L145: add r5, r6
+L146: .data 569, 441, 11, -819, -868, 265, -824, 672
+add L437, r7
+L147: .data -562, -525, -349
+L148: mov r5, *r2
+lea L307, L632
+L149: dec r0
+L150: clr L25
+prn r2
+dec r5
+L151: .data -627, 913, 264, -642, -132, -840, -277, -201
+not L535
+L152: lea L86, L197
+not *r5
+L153: sub #119, *r0
+L154: lea L285, L149
+L155: dec L618
+L156: stop
+mov r4, L341
+; comment
+L157: sub *r6, L192
+L158: rts
+
+L159: prn *r0
+prn L267
+L160: dec r5
+L161: rts
+L162: cmp *r7, r7
+L163: mov *r7, r5
+stop
+L164: cmp #-191, #-247
+stop
+L165: .data -335, -159
+L166: .data -413, 876, -967, 164, -631, -981, -688
+L167: inc r1
+L168: cmp *r0, r5
+L169: red r6
+sub #32, L325
+L170: cmp r1, r5
+bne *r1
+; comment
+L171: .data 991, -372, -299, 17, 767
+L172: bne L365
+L173: .data 535, -391, 597, -270, 780, -225, 853
+L174: prn L342
+L175: inc r5
+L176: bne *r3
+L177: .string "loslojzayqd"
+jsr *r0
+L178: lea L178, *r1
+L179: sub #-94, *r1
+rts
+sub r7, *r7
+L180: .string "eacriillbhhsyoznaebhz"
+inc L73
+L181: cmp #-143, r2
+; comment
+; comment
+L182: dec *r6
+jmp *r0
+L183: lea L79, L545
+L184: jmp L184
+L185: red L123
+L186: red L262
+L187: lea L564, L347
+L188: lea L317, r0
+prn #157
+L189: .data -235, 379, -948, 597, 506
+L190: bne L13
+L191: prn #4
+jsr L289
+cmp #-78, #-192
+L192: not L267
+L193: bne L111
+dec L363
+L194: dec L184
+L195: .string "zmljytutyrpteytinp"
+L196: .data -345, 635, 823, 368, 727, 625
+L197: inc L342
+prn *r0
+L198: rts
+L199: mov *r7, *r6
+L200: rts
+; comment
+L201: .data 344, 609
+L202: cmp r6, r4
+jmp *r1
+L203: sub r1, *r2
+L204: jsr *r1
+L205: .string "gzjzqsdozwkkroo"
+lea L87, L38
+L206: .data 729, 659, -77, -116
+L207: not r3
+rts
+cmp *r2, L33
+bne *r7
+L208: mov L33, L555
+inc L396
+L209: prn #-80
+dec *r3
+L210: jmp L20
+L211: lea L145, r2
+L212: inc *r3
+L213: .data -991, -342, -8
+L214: .string "ogoqde"
+L215: add #-34, r1
+red r3
+L216: jmp L351
+L217: jsr *r5
+L218: sub #-92, r0
+rts
+L219: sub L304, L104
+L220: jmp L91
+L221: red r5
+L222: dec r6
+L223: .data -783
+bne *r1
+add *r5, r2
+L224: dec *r7
+rts
+L225: stop
+L226: sub #-7, L162
+bne *r2
+L227: sub L360, L206
+L228: lea L503, L102
+prn L285
+stop
+add L83, *r2
+rts
+mov *r5, *r5
+L229: jsr *r0
+prn r2
+L230: bne *r0
+L231: clr r1
+sub #166, *r3
+jsr L109
+sub L634, *r0
+L232: jmp *r5
+bne L261
+prn #-65
+L233: sub *r2, *r4
+lea L353, *r6
+L234: bne L80
+mov #-167, L599
+L235: red r2
+L236: lea L18, L265
+mov r3, *r5
+L237: add *r2, *r3
+rts
+add *r0, L529
+L238: jmp *r2
+cmp #145, #209
+L239: prn r3
+jmp *r6
+L240: red L347
+L241: lea L61, r5
+L242: lea L599, L185
+L243: stop
+sub r3, r5
+L244: jmp *r2
+L245: stop
+rts
+rts
+; comment
+L246: clr r5
+add *r5, *r3
+L247: jmp *r7
+sub #-180, L324
+L248: mov r2, L361
+L249: red r7
+L250: .string "dytznfqp"
+; comment
+jsr *r6
+L251: red r0
+L252: add #84, r1
+L253: sub #84, r4
+L254: inc L344
+sub r5, L422
+red *r4
+L255: mov r3, L37
+dec L490
+L256: not L90
+L257: bne *r1
+L258: inc r3
+jmp *r3
+L259: stop
+L260: sub *r7, L586
+L261: .string "uphgifxakcjmcm"
+L262: clr *r0
+L263: stop
+red r4
+L264: .string "hagcsojmrkewammi"
+L265: .string "lrrzcedwzw"
+prn *r6
+clr *r1
+L266: not r4
+L267: dec r2
+sub L540, r4
+inc *r2
+L268: dec L639
+red *r7
+L269: sub #-114, L440
+L270: sub L233, r3
+; comment
+L271: prn L372
+L272: cmp r3, L17
+mov L511, r0
+red L386
+L273: inc *r3
+bne L471
+jsr *r7
+bne *r2
+L274: lea L216, L124
+cmp r2, *r7
+L275: red *r7
+inc *r6
+L276: sub r0, *r3
+L277: not *r2
+L278: add #224, L290
+mov #-4, *r5
+dec r1
+L279: mov #91, L545
+prn r3
+not *r6
+L280: bne *r2
+dec *r0
+L281: inc *r2
+add *r4, L81
+L282: inc *r3
+L283: clr L257
+L284: .string "enwtlenqajqxcssufg"
+inc L526
+L285: rts
+; comment
+L286: jsr *r4
+L287: jmp *r0
+cmp *r3, r7
+L288: lea L12, L460
+clr r0
+; comment
+L289: red r3
+L290: sub L59, r0
+L291: lea L244, *r0
+
+lea L99, r7
+L292: rts
+L293: dec r0
+L294: inc *r5
+L295: inc L184
+; comment
+L296: stop
+
+stop
+L297: jmp L190
+L298: jmp L642
+L299: rts
+inc r6
+L300: lea L591, L625
+L301: not *r1
+not r4
+jsr L638
+L302: .data 520, -548, -449, -824
+L303: prn L504
+clr *r3
+clr L266
+jmp L223
+L304: .string "bwiezfxaiwuiuebmk"
+; comment
+L305: .data -251, 937, -613, 884, -151, -711, 105
+L306: mov r0, L403
+L307: jsr L47
+L308: red r2
+L309: .data 883, 559
+L310: .data 277, -463
+L311: .string "xprnrbjkogkbjxcybmnueyrr"
+lea L260, L531
+jmp *r6
+L312: red L88
+L313: stop
+L314: clr *r4
+L315: dec *r0
+L316: not r6
+L317: jsr *r0
+L318: .string "quuujoacumbetcsnfgxxeyk"
+mov L197, *r2
+L319: not L595
+jsr L111
+L320: bne *r2
+; comment
+L321: not r1
+bne *r2
+jmp L462
+add *r0, L527
+inc L156
+prn *r6
+L322: stop
+L323: .string "pevjkbmbnrjvhspvg"
+L324: cmp #117, *r3
+L325: clr r7
+L326: jsr L118
+sub L55, *r4
+L327: dec r4
+L328: red *r3
+L329: bne *r0
+L330: .string "ivtemtwmlvrh"
+clr *r3
+L331: clr L458
+L332: lea L529, L244
+add r1, L416
+L333: stop
+L334: rts
+L335: jsr L51
+L336: jsr L493
+L337: .string "mfdqsrhhmmfppenlseqmak"
+L338: red *r0
+L339: prn L379
+clr r5
+inc r2
+clr r4
+L340: rts
+L341: jmp *r6
+L342: sub *r7, L151
+L343: jsr L548
+
+L344: bne *r6
+L345: .string "dobo"
+
+clr r7
+; comment
+L346: dec L233
+L347: add L221, *r4
+
+rts
+L348: stop
+L349: stop
+L350: .data 736
+bne *r7
+rts
+red L341
+L351: inc L128
+mov #74, L362
+L352: clr *r0
+L353: red *r7
+L354: lea L166, r4
+mov *r0, L466
+L355: prn r7
+L356: .string "fclzhu"
+L357: stop
+L358: clr r0
+L359: inc *r7
+L360: cmp r4, *r1
+rts
+L361: .data -531, -359, -509, -651, -192, 510
+L362: cmp r3, #162
+dec r6
+L363: dec L505
+sub #-25, r5
+L364: inc r0
+L365: clr L164
+L366: .string "bhln"
+jsr *r3
+L367: not *r3
+L368: bne L492
+cmp r2, *r5
+jsr *r7
+clr *r1
+jsr L40
+L369: mov L169, *r5
+not *r3
+inc *r0
+mov #62, L97
+L370: inc r1
+not L446
+dec L419
+L371: .string "ieljphv"
+L372: cmp L578, #65
+stop
+L373: .string "dj"
+L374: lea L637, L362
+red *r4
+cmp *r0, #-32
+mov *r3, L56
+L375: .string "bunybdhuvkvamtbkrnhjp"
+L376: bne *r1
+L377: mov L429, r3
+L378: jsr *r1
+L379: dec r3
+L380: not L458
+L381: .data 581, 164
+L382: bne L473
+L383: add L498, *r2
+; comment
+L384: dec L578
+
+L385: stop
+add *r5, *r3
+L386: inc r7
+prn *r1
+sub *r6, L35
+L387: not *r3
+
+L388: prn L199
+L389: jsr *r3
+clr L150
+L390: prn #-110
+L391: add *r7, r2
+add r6, L173
+L392: jmp L391
+sub #172, r4
+inc L244
+L393: prn L101
+L394: inc r5
+L395: jmp L624
+L396: sub *r2, L129
+L397: cmp #-10, #167
+L398: .string "mpgmeverecqbtyoofxc"
+L399: cmp L268, r1
+mov #79, r5
+L400: rts
+L401: inc r5
+L402: rts
+jsr *r0
+L403: inc r4
+L404: mov #-114, L552
+L405: prn L446
+lea L54, L55
+add #246, *r5
+dec L517
+L406: red r6
+prn L280
+L407: add r3, r1
+L408: stop
+L409: stop
+L410: jmp *r7
+prn #89
+L411: .data -869
+L412: clr r5
+inc L123
+L413: stop
+L414: lea L428, *r6
+L415: .string "oufs"
+L416: not *r2
+L417: .string "tauqlyvberuxlcplotfh"
+jmp *r0
+L418: sub *r2, L439
+L419: red L482
+L420: dec L116
+L421: .data -903, -255, 14, -647, -712, 453
+not r3
+L422: red r3
+L423: not r2
+L424: cmp L618, r1
+; comment
+lea L202, L31
+L425: bne *r0
+L426: clr L338
+L427: jmp L25
+L428: add *r5, L3
+L429: inc L98
+; comment
+add *r3, *r2
+L430: prn L90
+add r3, *r7
+L431: clr *r5
+not r1
+red r5
+L432: mov #-45, L496
+
+L433: prn L577
+; comment
+sub #207, r5
+bne L150
+L434: red *r0
+L435: add L192, L633
+lea L496, *r7
+L436: red r7
+L437: inc r0
+clr L189
+L438: stop
+L439: inc *r0
+L440: jsr *r5
+L441: bne *r3
+add *r0, *r6
+L442: cmp #15, *r3
+L443: mov *r7, *r1
+L444: not r2
+jmp L417
+L445: .string "pycobtgvxymwzugazfknqrk"
+jsr L602
+L446: jsr L260
+jmp L483
+L447: not r4
+L448: .data 673, -200, -903, 21, -626, 991
+add #-252, r0
+add L55, L224
+L449: .data 110, 271, -924, -481, 888, -710, -130
+L450: .string "wruactdusnfstgnfdctirl"
+L451: prn L176
+L452: sub r5, L437
+L453: red r0
+red L583
+L454: .data 17, -130, -373, -762
+L455: jmp *r6
+jsr L145
+L456: lea L503, *r6
+not r5
+L457: clr *r7
+clr L362
+L458: jmp *r5
+lea L479, *r1
+inc L616
+mov *r0, L600
+L459: stop
+L460: stop
+L461: add r5, r6
+L462: jmp L627
+L463: mov #-93, L235
+L464: jmp L256
+prn r2
+; comment
+L465: jsr L251
+mov *r4, r0
+L466: clr r0
+L467: sub *r0, r3
+L468: bne *r6
+jmp L471
+L469: cmp r3, r3
+L470: clr r4
+prn r7
+L471: prn #-182
+dec *r1
+L472: clr *r1
+L473: .string "z"
+L474: not r2
+L475: cmp #123, r4
+L476: red *r3
+L477: inc L505
+dec r5
+add #111, r2
+L478: prn *r3
+L479: lea L620, r0
+add L361, L552
+sub *r4, *r2
+
+L480: bne *r0
+L481: clr r4
+L482: clr *r5
+stop
+L483: jmp *r3
+L484: red r5
+L485: .string "bigymsnree"
+L486: stop
+; comment
+L487: jsr *r5
+lea L15, *r7
+rts
+L488: inc *r7
+add #32, r3
+L489: add r6, r2
+L490: prn L247
+; comment
+L491: clr *r7
+L492: jmp *r2
+L493: sub #-248, L467
+L494: mov r1, *r1
+L495: bne *r0
+L496: rts
+L497: rts
+L498: rts
+L499: lea L513, r7
+L500: .data -46, -142, 504
+L501: .data 358, 126
+inc L320
+L502: mov *r3, *r6
+L503: clr L614
+L504: inc L495
+; comment
+L505: add *r7, *r1
+L506: .data 21, -274, -325, 5, 96, 984
+L507: mov r7, *r2
+L508: cmp L602, #6
+L509: dec *r2
+L510: stop
+L511: mov #-96, r3
+
+L512: .string "udxrlugzengmf"
+dec r5
+L513: rts
+L514: cmp r7, L37
+L515: not r0
+L516: inc r7
+L517: cmp L520, *r4
+; comment
+clr L290
+L518: .string "iyemqfdkvacedxwpn"
+bne *r3
+L519: sub r2, *r3
+L520: jsr *r4
+L521: jmp *r6
+jsr L547
+sub *r4, r5
+L522: inc r3
+L523: add *r7, *r0
+L524: jsr L71
+stop
+L525: red L545
+L526: red L452
+L527: clr r7
+lea L425, L315
+dec r5
+L528: add *r5, r7
+jmp *r1
+jmp *r7
+L529: jsr *r6
+L530: inc r7
+L531: inc *r7
+mov r5, *r2
+stop
+inc *r5
+sub L630, L428
+L532: not L239
+prn r0
+sub L588, *r1
+L533: prn *r6
+L534: prn #-20
+L535: sub *r7, r0
+L536: dec *r4
+L537: rts
+L538: inc *r2
+L539: jsr L324
+rts
+L540: cmp r6, L444
+L541: mov r1, r6
+L542: not *r1
+L543: cmp L588, L636
+jmp L464
+L544: jmp L608
+L545: dec *r7
+L546: cmp L640, r7
+L547: add *r7, *r4
+L548: sub #86, L16
+jsr L337
+L549: red r4
+L550: inc *r7
+L551: cmp r3, *r4
+L552: .string "zilxfccbxekfoqnthbeosowh"
+L553: .string "hdguqrovcffnxxlkohuhrs"
+L554: jmp L454
+lea L492, r1
+L555: mov #201, r4
+L556: not *r3
+L557: sub #-5, *r2
+L558: .string "yxlwrbwiwxcx"
+L559: sub #23, L342
+jsr *r7
+sub *r0, L641
+L560: rts
+sub *r0, L580
+; comment
+L561: prn r7
+L562: rts
+L563: jmp *r0
+L564: stop
+; comment
+sub r2, *r3
+stop
+L565: jsr *r5
+L566: red *r1
+L567: add *r5, r6
+mov *r3, L621
+L568: red r6
+L569: clr *r1
+L570: clr L587
+L571: inc L153
+L572: lea L591, L633
+L573: .data 513
+L574: .string "njdfk"
+L575: cmp L492, #36
+L576: .data -904, 449
+rts
+L577: cmp #107, r1
+not L390
+L578: cmp #66, *r7
+mov #-184, L569
+L579: red *r1
+jsr *r5
+not *r7
+lea L37, r7
+L580: cmp L584, #17
+clr *r0
+red r6
+L581: add *r7, *r7
+L582: sub L574, r2
+sub #134, r5
+dec L588
+L583: lea L374, r7
+L584: lea L490, *r0
+L585: jsr L333
+L586: jsr L598
+L587: lea L643, *r2
+L588: .string "rsgatemutkzekaiwjqdrbmq"
+L589: prn r6
+L590: .data 264
+not L159
+sub *r1, r6
+L591: jsr *r6
+L592: jmp *r5
+bne *r2
+L593: rts
+L594: sub L312, r6
+mov #158, r5
+L595: dec L587
+L596: not L609
+lea L175, *r0
+L597: sub #-83, L604
+L598: prn r0
+L599: sub *r5, *r5
+L600: add L276, r4
+prn *r2
+not r5
+add *r4, *r6
+L601: add L366, r5
+L602: red *r1
+L603: sub r0, r6
+L604: not r0
+L605: cmp L363, #103
+; comment
+bne L188
+L606: bne *r7
+rts
+L607: stop
+L608: red L630
+inc L151
+L609: dec r4
+L610: clr L310
+L611: not r4
+L612: cmp r6, *r2
+L613: add #80, *r7
+lea L638, L41
+L614: rts
+L615: bne *r2
+L616: clr L259
+cmp r0, #42
+stop
+L617: prn L636
+L618: prn #-169
+sub *r1, r2
+L619: mov *r5, r2
+L620: jsr *r1
+L621: stop
+L622: sub L345, *r5
+L623: inc L627
+L624: .string "s"
+inc r5
+stop
+L625: sub *r6, L164
+L626: lea L56, L526
+L627: bne L597
+L628: jsr *r2
+L629: mov L636, r7
+L630: red L633
+L631: sub *r4, *r7
+L632: rts
+L633: stop
+dec L634
+lea L511, L641
+L634: lea L645, L27
+L635: add #82, L638
+inc r2
+lea L637, *r0
+L636: add L621, L638
+bne L328
+L637: red r5
+L638: add *r0, L645
+rts
+L639: .data -671, 241, 109, -545, -887, -207, -721, 979
+prn L645
+not L643
+L640: .string "bnjgwcganqxnwoybkjuqhy"
+L641: sub L160, L645
+
+L642: .data 790, 169, -139
+L643: .string "fxzqezz"
+L644: dec r4
+jsr L646
+L645: jmp *r6
+stop
+L646: rts
+stop
@@ -0,0 +1,1040 @@
+; Generated by genCorpus --seed 55
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+L0: cmp #-166, #104
+L1: jmp *r6
+L2: cmp L0, r2
+L3: cmp r0, *r3
+; comment
+L4: lea L3, *r3
+L5: bne L459
+L6: sub #62, *r3
+L7: dec *r5
+L8: inc r7
+not *r6
+L9: inc L5
+L10: stop
+L11: .data 259, -110, -64, -413
+L12: mov #145, L5
+L13: cmp *r5, r1
+L14: .string "vuxucynnbjbpch"
+L15: prn #-63
+L16: bne *r2
+L17: dec *r2
+inc r6
+L18: inc L3
+L19: .data -160, 372
+L20: jmp L17
+cmp #181, *r5
+L21: inc L467
+L22: cmp L22, #-59
+bne *r0
+L23: add *r1, L406
+L24: lea L227, L7
+L25: mov *r6, L6
+L26: jmp L351
+sub #221, r0
+jmp L23
+L27: .data -88, -893, -93, -103, 820, -622, -215
+L28: rts
+
+L29: inc r4
+L30: .data -509, 967, 149, -610, -816, -970
+L31: add *r0, L15
+L32: bne L1
+L33: cmp r6, r0
+L34: stop
+cmp L11, *r2
+L35: .string "xiaqqqdc"
+L36: dec L153
+L37: prn r5
+bne *r2
+L38: lea L411, r4
+jsr *r5
+L39: bne L12
+L40: add L126, L391
+L41: stop
+L42: cmp *r1, *r5
+L43: .string "thujnavwmqaglvr"
+lea L125, L385
+L44: prn *r2
+L45: add r2, r7
+L46: rts
+L47: bne L33
+L48: sub r0, r5
+L49: sub #185, L266
+mov r1, *r1
+mov *r2, L8
+L50: bne L101
+L51: .string "vchunolaqznp"
+L52: sub r3, *r1
+L53: bne L29
+jsr *r2
+L54: rts
+L55: inc *r2
+L56: sub *r6, r5
+L57: dec L18
+L58: mov r5, *r4
+stop
+inc *r1
+L59: prn *r1
+L60: .string "hmeraqqdgewukit"
+L61: add *r6, L57
+mov r5, L10
+L62: red r3
+L63: .string "wkmjvzhidg"
+L64: prn *r4
+add r7, L9
+jmp L373
+L65: jsr *r4
+L66: not *r7
+rts
+jmp L33
+lea L392, L242
+L67: mov *r0, r1
+L68: jsr *r7
+L69: .data -24, -12, -463, -127, -569, -832, 810
+rts
+L70: sub #-4, L49
+L71: sub L366, *r4
+L72: .data -952, 902
+L73: mov *r3, r6
+clr r2
+add #-102, L147
+stop
+L74: clr L59
+; comment
+
+L75: dec *r5
+L76: inc r6
+prn *r6
+rts
+cmp L221, *r3
+; comment
+L77: cmp #-38, r4
+L78: red *r7
+add *r2, *r5
+L79: red L28
+L80: .data -569, 600, -351, 48, 126, -597, 957, 274
+L81: rts
+L82: jsr L375
+mov r1, r4
+add r6, L90
+; comment
+L83: cmp *r1, r7
+L84: sub r5, L24
+L85: stop
+jsr L479
+; comment
+bne *r7
+L86: cmp *r2, L112
+L87: .data 866, 932, -300, 128, -265, 520
+L88: jsr L28
+L89: red *r2
+L90: cmp #114, *r0
+L91: not r2
+L92: jsr *r7
+prn *r4
+L93: .data -74, 520, -935
+L94: .data 728, 735, -262, 574, -805, 685
+L95: inc *r2
+L96: red *r0
+L97: prn r6
+L98: lea L372, L257
+not *r6
+L99: dec r1
+inc *r0
+prn L391
+L100: .string "mnagcoxuburdamka"
+dec *r5
+; comment
+L101: .string "rqiyatxdoawrxdtsigampf"
+inc L155
+red *r3
+L102: red r7
+L103: jsr L387
+inc L56
+L104: cmp r1, r0
+L105: jsr L421
+jsr *r2
+L106: rts
+L107: lea L415, *r4
+L108: jsr L52
+L109: lea L55, L214
+L110: .string "xcovjsdtllpz"
+L111: jmp *r6
+L112: .data 69, -257, -767, -634
+L113: red r3
+
+L114: .data -481, -422, 127, 401, -81, -277, -3
+prn r7
+L115: cmp #117, *r5
+L116: .string "riauavddhxiag"
+red *r1
+L117: lea L396, L62
+stop
+stop
+L118: rts
+L119: jmp L35
+L120: stop
+L121: lea L90, L33
+L122: add *r5, *r1
+L123: dec L86
+L124: .string "jigtj"
+sub r1, L423
+L125: jmp L13
+L126: .string "ojytwdhv"
+L127: cmp *r6, L59
+L128: rts
+L129: .string "l"
+mov r4, *r1
+not L172
+
+L130: clr r4
+
+cmp *r1, L578
+mov #-199, L66
+L131: clr L522
+dec L59
+
+L132: dec r5
+L133: dec r2
+L134: lea L164, L31
+L135: clr r3
+L136: jmp *r3
+L137: red *r0
+cmp *r5, L273
+L138: .data 416, 951, -176, 317, -44, -370, -981, 814
+stop
+L139: .data 677
+dec *r3
+L140: dec r5
+dec L51
+red r6
+red *r7
+L141: rts
+L142: not L254
+L143: jmp L113
+clr *r7
+red *r1
+L144: lea L118, r0
+stop
+L145: add *r5, *r5
+L146: stop
+L147: clr r4
+clr L46
+L148: jmp *r5
+L149: .string "ims"
+mov L26, L77
+L150: rts
+L151: inc L172
+L152: prn #205
+L153: bne L67
+cmp L88, r5
+L154: cmp L140, L441
+L155: bne *r1
+L156: .string "gnoyraclrbailnxdw"
+L157: sub L135, L461
+red L7
+L158: sub *r2, r2
+L159: prn *r3
+add r4, *r1
+L160: add *r0, r2
+L161: dec L374
+L162: dec L9
+L163: .data 463, -176, -446, -149, 932, -766, -111, -613
+L164: lea L312, r6
+L165: rts
+dec L169
+L166: prn L358
+sub r2, *r7
+L167: lea L571, *r7
+add #16, L335
+
+L168: rts
+L169: jmp *r7
+jmp L238
+L170: red L23
+L171: clr *r4
+jsr L406
+bne L359
+L172: jmp L222
+clr *r5
+L173: dec r4
+
+L174: stop
+L175: dec r4
+dec L396
+cmp L5, r5
+L176: clr *r2
+L177: lea L153, *r6
+jsr L75
+L178: dec *r1
+L179: jsr *r5
+L180: clr L35
+dec L84
+cmp L38, #-144
+L181: mov r6, L312
+L182: add r7, *r0
+L183: lea L259, L574
+jsr L445
+inc r6
+sub #-175, L115
+rts
+L184: .string "wpulclazpa"
+red L331
+L185: prn L40
+prn L201
+L186: mov *r1, L140
+L187: bne L343
+add L424, r4
+red r6
+L188: .string "hgxnelofdo"
+L189: red *r4
+L190: not r5
+L191: not r3
+L192: bne L11
+red L34
+L193: cmp *r7, L124
+clr L541
+rts
+L194: inc *r2
+L195: stop
+L196: dec *r5
+jmp *r0
+L197: cmp r5, L539
+lea L149, L357
+L198: sub r7, r0
+; comment
+rts
+bne *r7
+L199: red r2
+L200: jsr *r0
+L201: cmp *r3, *r7
+L202: clr *r2
+L203: stop
+L204: .data 446
+inc r3
+bne L171
+L205: sub #-179, *r2
+inc r2
+L206: rts
+L207: jsr *r4
+add *r5, r3
+L208: bne *r0
+L209: jmp L136
+clr *r1
+inc *r6
+L210: red r3
+cmp #154, #-12
+L211: .data -615
+inc r4
+L212: inc *r6
+L213: mov r5, *r7
+bne *r0
+jmp *r1
+dec r5
+L214: rts
+stop
+cmp *r6, *r5
+L215: .data -892, -467, 196
+inc r1
+add #-88, r7
+rts
+inc L545
+L216: mov *r0, *r1
+L217: bne L496
+rts
+L218: lea L95, *r2
+L219: not *r4
+L220: jsr *r4
+L221: red r4
+L222: add r0, *r0
+inc *r1
+jsr L289
+L223: mov #-216, r3
+L224: .data 825, -696
+clr r0
+
+L225: .data 127, -50, -997, 286, -771, 852
+L226: red L123
+L227: dec *r2
+L228: jmp L191
+L229: cmp #138, #-53
+
+jmp L467
+L230: clr L47
+L231: not L233
+dec r0
+L232: sub r5, L296
+L233: add #-82, r2
+jmp L175
+L234: clr r4
+red L126
+clr r0
+jsr L325
+stop
+L235: sub *r4, L452
+clr L533
+sub *r3, r7
+L236: prn r2
+L237: cmp L592, r3
+prn L288
+cmp #-234, *r7
+jmp *r2
+L238: clr *r2
+add *r7, L236
+cmp L236, #-93
+L239: add r3, *r0
+prn L65
+add r2, *r0
+L240: prn L506
+L241: dec r1
+inc r1
+L242: bne L148
+L243: red *r2
+jmp *r0
+L244: rts
+jmp L302
+L245: inc *r7
+jmp L235
+dec *r6
+; comment
+jmp L303
+stop
+jsr L71
+L246: jsr L52
+; comment
+; comment
+L247: clr r0
+L248: stop
+; comment
+L249: .string "xpopbcdp"
+stop
+L250: .data -955, 931, 434, -128
+add #24, L239
+L251: prn L266
+L252: cmp L189, L422
+L253: add L460, L107
+red r4
+red L187
+L254: lea L449, L524
+rts
+prn L495
+sub L482, L444
+jmp L186
+L255: mov #-159, r7
+L256: prn *r6
+L257: .data -750, -615
+L258: not r1
+L259: prn *r0
+L260: rts
+jmp *r3
+L261: mov *r1, *r3
+L262: stop
+L263: jmp L405
+inc r7
+L264: mov L69, L35
+L265: cmp *r6, *r1
+; comment
+L266: dec *r0
+L267: lea L139, r5
+add #-176, L53
+L268: cmp r6, L467
+mov r4, *r3
+add *r5, L11
+L269: add #-221, *r6
+L270: sub L97, L353
+L271: jsr L100
+dec L195
+L272: jsr L545
+L273: .data 162
+L274: inc L180
+L275: red r1
+L276: sub r5, L451
+clr L415
+L277: cmp *r3, L163
+L278: .data -958, -699, -931, 614, -770
+L279: inc *r1
+L280: dec r3
+L281: jmp L445
+L282: add *r4, L166
+L283: jsr *r1
+; comment
+clr *r5
+L284: jmp *r7
+L285: clr *r6
+L286: bne *r7
+L287: inc *r2
+inc L73
+L288: clr r3
+; comment
+sub #-163, r2
+not *r4
+rts
+prn L272
+L289: .string "zkitpiksfethbwgvhjybuklz"
+L290: rts
+L291: clr L318
+L292: .string "hytrvwpckyydaazy"
+jsr *r2
+inc r5
+L293: stop
+L294: clr r0
+jmp *r3
+stop
+L295: dec L66
+L296: add *r4, r2
+L297: inc r2
+L298: stop
+L299: .data -613, -197, 691, -308
+L300: .data 210
+dec *r6
+
+L301: clr r5
+dec *r3
+L302: jmp *r5
+L303: cmp #106, *r3
+L304: jmp *r6
+; comment
+L305: .data 869, -6, 359, 980
+add L499, L274
+rts
+rts
+L306: .data -874
+red *r3
+L307: cmp *r1, L337
+cmp r5, #-237
+red *r0
+lea L113, L557
+L308: .data -348
+L309: rts
+L310: bne *r2
+L311: add r0, *r2
+L312: clr *r6
+
+clr L507
+lea L538, *r7
+L313: rts
+prn L117
+dec *r7
+L314: add *r1, r2
+prn r6
+L315: .data 623, 238, -14, -151, -265, -950, 743
+L316: stop
+bne L327
+L317: not *r3
+L318: jsr *r1
+L319: clr r3
+prn *r3
+L320: inc *r1
+L321: add r1, L25
+prn #60
+L322: not *r2
+L323: .data 386, 368, -847, -611, 182, -140, 153
+sub L482, r3
+; comment
+L324: not *r2
+sub r0, L3
+L325: prn *r1
+
+L326: rts
+lea L343, *r6
+L327: jmp L76
+L328: dec *r1
+jmp *r0
+L329: jsr L305
+L330: sub r1, L508
+not r1
+L331: not L377
+L332: bne *r6
+clr r0
+bne *r0
+add r2, *r4
+; comment
+L333: jsr L28
+red *r3
+L334: .string "txpm"
+L335: clr *r2
+
+dec L529
+lea L576, *r1
+not L264
+rts
+L336: cmp *r0, L389
+; comment
+L337: add *r3, *r1
+L338: prn r6
+rts
+stop
+L339: jmp *r3
+jmp *r6
+L340: cmp *r5, *r5
+L341: bne L366
+L342: .data -79, 27, 570, 343, 48, -285
+L343: bne *r1
+L344: red L578
+sub r3, L263
+L345: stop
+cmp *r3, L458
+L346: .data -916, 294, 855, -679, 412, 201, -857, -472
+L347: inc r5
+not L127
+inc *r0
+L348: .data 640, -883
+prn #103
+L349: cmp L163, *r1
+stop
+red *r1
+
+L350: lea L569, r6
+L351: jmp L1
+prn r0
+L352: lea L116, L487
+; comment
+L353: jsr L492
+L354: sub *r3, r7
+L355: stop
+add #-220, L566
+L356: clr r3
+L357: sub L182, L126
+L358: bne L351
+L359: mov #-121, *r4
+L360: rts
+L361: sub #-127, L570
+dec *r6
+L362: stop
+L363: .data 464, 90, 723
+clr r7
+mov r2, *r4
+L364: rts
+L365: cmp r6, r0
+rts
+L366: lea L283, r0
+L367: .string "jsqctlgjennryuyjv"
+dec *r3
+L368: rts
+L369: jsr *r3
+L370: clr r1
+add *r3, L378
+jmp L248
+L371: dec *r1
+L372: sub *r5, L184
+L373: prn r2
+L374: stop
+L375: inc L533
+stop
+inc L428
+L376: .string "fcbrd"
+clr r4
+stop
+jmp *r5
+L377: sub r7, L549
+sub L436, L392
+L378: not L385
+L379: clr *r7
+L380: mov r5, r7
+jsr L269
+L381: cmp #23, *r3
+L382: mov #234, L587
+L383: jsr *r1
+L384: rts
+L385: lea L84, *r3
+L386: inc L5
+stop
+L387: jsr L515
+clr L568
+prn r5
+L388: sub r3, L585
+L389: .data -405, 249, 281, -908, 490, 735, -177
+L390: clr *r6
+stop
+clr *r1
+L391: .data -230, -623, 482, -859, -703, 158
+L392: mov #-119, *r0
+L393: not L486
+lea L550, *r1
+L394: stop
+L395: clr r1
+sub r2, L466
+L396: not *r5
+L397: .string "bmbilfkvir"
+L398: stop
+L399: cmp #-150, *r0
+L400: cmp L326, L439
+L401: .data 815, 504, -24
+L402: not L521
+L403: clr *r6
+stop
+; comment
+L404: sub *r1, r1
+L405: lea L283, L131
+L406: .data 977, 423, -673, 484, 876, 749
+L407: .string "jxrcydmlqvzxrblql"
+stop
+L408: add r5, r5
+dec L590
+clr r0
+L409: dec L319
+red *r6
+L410: sub *r4, L518
+L411: .string "paxzqypvnfykhm"
+L412: .string "dnfbgsyu"
+rts
+L413: red r3
+L414: stop
+add #130, L243
+L415: sub L37, L283
+inc L86
+L416: cmp *r4, *r4
+inc r6
+rts
+rts
+mov L482, r4
+not *r5
+L417: mov r5, r1
+dec L372
+L418: jmp *r2
+jsr *r5
+L419: .string "fbqkrqyq"
+L420: add #-143, L220
+; comment
+L421: .string "ebpzntr"
+L422: not r6
+dec r7
+not r4
+L423: lea L467, r2
+L424: sub #156, *r2
+dec r5
+L425: red *r7
+prn r7
+prn *r0
+L426: sub L263, *r0
+L427: dec r3
+L428: prn r5
+L429: sub L507, r5
+L430: .data 737, -254, 544, -642, -119, -460
+L431: cmp *r5, L466
+bne L530
+L432: .string "go"
+jmp *r7
+prn r6
+L433: clr r1
+L434: rts
+sub #161, *r5
+add r6, L504
+L435: prn *r3
+L436: prn L528
+lea L565, *r4
+rts
+L437: jmp L234
+; comment
+dec r4
+mov #-180, *r1
+L438: lea L449, r2
+cmp r0, *r0
+L439: red L79
+L440: not L529
+L441: jmp *r3
+L442: .string "bkun"
+L443: clr L450
+L444: jsr *r1
+inc r1
+L445: rts
+L446: dec r7
+; comment
+L447: cmp L235, *r4
+L448: mov L121, *r1
+; comment
+jsr L441
+; comment
+L449: rts
+L450: .string "yqzgckjzm"
+jmp *r5
+L451: sub #-195, L103
+L452: bne L511
+L453: dec L156
+; comment
+L454: prn *r3
+L455: cmp r1, L581
+; comment
+L456: dec r5
+L457: jsr L474
+L458: red L510
+L459: cmp r7, r4
+clr *r6
+L460: cmp r0, L567
+dec r4
+clr r4
+L461: cmp #-56, #233
+L462: lea L577, r1
+L463: rts
+L464: sub *r3, r6
+L465: red r5
+L466: stop
+not r5
+L467: mov #114, L277
+L468: bne L46
+lea L449, *r6
+sub #24, L534
+red *r3
+L469: mov *r3, r4
+L470: cmp #183, r4
+L471: jmp L555
+L472: stop
+lea L481, L80
+L473: not *r1
+bne *r5
+L474: .string "grmajeprnloiagvegai"
+red *r1
+L475: .data -513, -639
+rts
+
+L476: rts
+jmp L530
+
+L477: red r3
+dec r1
+mov #205, r5
+; comment
+rts
+dec *r1
+L478: inc *r7
+rts
+sub #-110, L552
+not *r7
+
+rts
+L479: not r6
+jmp L579
+L480: cmp r4, r4
+L481: prn *r7
+lea L191, L483
+L482: .string "bjsivekzqw"
+L483: add L470, r3
+L484: stop
+L485: lea L510, *r2
+L486: cmp L511, r3
+; comment
+L487: stop
+L488: prn *r5
+L489: add L526, r5
+clr L132
+L490: cmp r0, *r5
+L491: bne *r1
+cmp #-246, #-79
+jmp *r1
+red r5
+
+jmp *r4
+bne L173
+prn r3
+stop
+L492: jmp L280
+L493: .string "kwobkairsacfighpsuni"
+L494: not *r3
+L495: inc r3
+jmp L342
+cmp r4, r4
+L496: rts
+L497: bne *r6
+L498: jmp L582
+rts
+L499: bne *r1
+clr *r0
+inc *r6
+L500: sub r2, L522
+L501: not *r1
+L502: rts
+rts
+L503: dec L7
+L504: jmp L547
+dec r0
+L505: lea L583, L508
+prn L313
+L506: add r3, *r3
+L507: .string "llzjnaeureecqwgnzdf"
+L508: jsr *r2
+rts
+L509: sub *r0, r1
+L510: jsr L407
+mov *r7, L508
+L511: clr r0
+L512: rts
+L513: bne L46
+cmp L578, #206
+L514: red L354
+rts
+sub r1, L538
+
+L515: inc L446
+L516: lea L560, *r2
+prn r4
+L517: jsr *r1
+not r3
+L518: mov L519, L534
+L519: stop
+L520: clr r6
+dec r5
+L521: jsr *r2
+L522: mov #209, L151
+sub L577, r6
+
+sub #98, r6
+mov L563, L562
+rts
+
+L523: sub *r6, r4
+not L157
+L524: .string "sbyfjkrdwoeeeef"
+L525: .string "wqgurskdwbrjqakyxofvrktw"
+L526: jsr L197
+L527: cmp *r2, r6
+L528: stop
+stop
+L529: .data 647, -620, -861, 942, -254
+mov *r5, *r2
+L530: not r0
+L531: prn #-225
+dec L561
+dec *r7
+L532: mov r5, r7
+L533: .string "ovh"
+L534: .string "nhmuchm"
+L535: .string "uqdyoxgfwjmllpyjidzbf"
+L536: .data -831, 655, -33, 969
+add L406, *r0
+L537: add L554, *r1
+L538: clr r2
+L539: .string "cvftvrspkpqvyugeivrz"
+prn *r4
+stop
+; comment
+sub *r2, L418
+inc r4
+L540: red *r7
+L541: red *r3
+prn *r6
+L542: .string "yfzybfdqz"
+mov r0, *r2
+clr L577
+L543: rts
+mov L429, *r1
+add *r1, *r1
+jmp L15
+L544: stop
+
+L545: inc *r4
+L546: dec *r3
+L547: .data 960, -132, 705, 547, -547
+jsr L259
+L548: jsr *r4
+L549: add L83, *r5
+dec L591
+L550: prn L578
+; comment
+L551: cmp r4, r5
+L552: red L592
+L553: clr *r4
+L554: prn L372
+L555: mov r1, L354
+clr *r5
+L556: .data -497, 333
+mov r5, r7
+L557: lea L572, r6
+L558: lea L397, L571
+L559: sub L225, r7
+L560: inc L443
+L561: jmp *r2
+red r5
+L562: stop
+inc L248
+L563: clr *r3
+prn *r0
+L564: stop
+L565: mov L571, r3
+mov #161, r1
+L566: inc *r6
+L567: red L580
+cmp r4, *r6
+L568: jsr L587
+L569: lea L313, L590
+rts
+; comment
+L570: bne L588
+lea L574, r3
+L571: .string "hpfzbfrhfbusbcrumgauccqu"
+L572: .data 830, 116, -196, -607, -172, -824, -822, -406
+rts
+; comment
+not L47
+rts
+L573: lea L346, L584
+L574: red r7
+L575: inc L327
+jmp *r4
+add #212, L366
+clr r3
+L576: bne *r0
+cmp r5, *r0
+L577: jsr *r6
+L578: jmp *r6
+rts
+L579: rts
+L580: lea L119, L179
+L581: mov #6, r2
+L582: clr r0
+rts
+L583: .data -742, 636, 853
+; comment
+red r4
+L584: cmp L585, L591
+inc *r1
+L585: not r1
+add L586, L586
+L586: prn #27
+L587: jmp L372
+add #235, r5
+L588: clr *r1
+L589: dec L590
+L590: red L591
+L591: rts
+L592: mov L267, L300
+red L343
+stop
@@ -0,0 +1,1040 @@
+; Generated by genCorpus --seed 56
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+stop
+L0: sub #221, *r6
+dec L310
+
+L1: prn L0
+L2: mov L0, r7
+L3: lea L236, *r0
+L4: .string "mlh"
+; comment
+rts
+jsr L0
+L5: dec r5
+; comment
+L6: .string "ajwldlqsnuarywkqjwuadpdg"
+L7: jsr *r5
+L8: lea L4, *r0
+L9: .string "rvdnauttwzikshy"
+add L79, *r5
+L10: .data -764, -828, 927, 362, -279
+L11: .string "vcmkg"
+L12: jsr L12
+
+
+L13: add *r5, L2
+L14: clr L4
+rts
+L15: jmp *r7
+L16: dec L594
+L17: jmp *r4
+L18: stop
+add *r6, L153
+rts
+bne L69
+L19: bne *r3
+red *r1
+sub #-137, L3
+L20: .data 950, 526, 482, 403, 189
+jsr L14
+add L19, L351
+
+sub #72, r5
+stop
+cmp L589, #99
+jsr L260
+L21: rts
+L22: add r5, r1
+bne *r5
+L23: jmp *r4
+L24: bne *r5
+L25: not r0
+L26: add L27, *r1
+L27: clr r5
+L28: dec r5
+L29: clr r0
+prn r0
+L30: cmp r1, #-2
+L31: jsr *r5
+bne *r5
+jsr L432
+L32: .data -7, 40, 713, 367, 703, -838, 410, 407
+prn *r5
+L33: prn L42
+L34: mov *r1, r5
+L35: red r0
+clr L25
+not L152
+L36: dec *r3
+L37: jmp L1
+inc r7
+add *r2, *r2
+; comment
+prn r4
+cmp *r5, #-247
+prn #167
+L38: bne L426
+; comment
+jsr L546
+L39: bne L16
+; comment
+clr L4
+L40: lea L21, L20
+L41: stop
+L42: jsr L235
+cmp L2, #-254
+clr *r2
+L43: .string "h"
+not r7
+L44: lea L210, r5
+mov #177, r0
+L45: dec *r1
+lea L11, L44
+jmp L1
+rts
+; comment
+sub L389, r5
+L46: not *r1
+L47: clr r5
+L48: .data 961, -5, 204, 182
+L49: stop
+L50: dec r5
+L51: .data -872, -932
+L52: prn r5
+L53: jmp *r1
+stop
+L54: .data -352, 254, 406, -474, -263
+L55: .data -965, 361, 414, 173, -41, -629, 459
+inc L424
+L56: prn L495
+L57: jsr L102
+L58: dec r7
+L59: clr L65
+bne L96
+clr r1
+rts
+L60: clr r4
+L61: cmp #-33, #-180
+prn *r3
+L62: rts
+L63: add L62, *r5
+add L1, L49
+not L184
+L64: dec *r6
+L65: red *r3
+L66: red *r2
+L67: .string "akcas"
+L68: jmp *r7
+L69: not L110
+L70: rts
+rts
+L71: bne *r4
+inc *r7
+clr r7
+L72: cmp L242, L523
+not L59
+rts
+L73: .string "cpdyrjjodgbfuz"
+L74: rts
+L75: stop
+jsr *r5
+L76: dec r7
+L77: .data 727, -108, -225, -482
+L78: .string "cjjirldlyyx"
+not L74
+
+not *r6
+L79: red L61
+clr r4
+not L39
+L80: clr L39
+add r6, r3
+L81: .string "xty"
+L82: sub r6, *r1
+sub #69, L54
+L83: clr L28
+not L146
+L84: mov L66, L380
+L85: rts
+L86: jsr L116
+lea L239, *r3
+inc L441
+L87: not L82
+L88: .data -592, -450, 875, -377, -840
+clr r0
+L89: .data -544, -660, -950, -850, -212, 963
+L90: dec r3
+L91: dec *r7
+L92: bne *r6
+; comment
+jsr L346
+; comment
+stop
+L93: red *r6
+L94: bne L82
+jsr L235
+L95: bne L307
+lea L62, L11
+L96: lea L397, *r3
+jmp L108
+add #-102, r3
+inc *r7
+; comment
+dec L196
+L97: bne *r4
+L98: red *r2
+L99: .data -732, 965, -776, 886
+L100: lea L584, *r0
+L101: jsr *r2
+sub *r6, r7
+L102: mov #145, L214
+L103: sub #-172, r3
+L104: jmp L6
+L105: cmp *r6, *r3
+L106: stop
+L107: inc *r1
+L108: jsr *r6
+L109: dec r2
+mov r6, *r0
+L110: prn *r1
+L111: jmp L447
+jsr L288
+; comment
+L112: not r2
+mov *r7, L71
+not L228
+jmp *r3
+L113: inc r1
+stop
+L114: dec L244
+L115: dec *r6
+; comment
+mov #142, r4
+L116: dec L374
+L117: jmp L397
+L118: add *r5, *r3
+jmp *r3
+L119: clr *r5
+L120: mov r7, L99
+prn *r2
+not *r6
+L121: .string "oseeyejlnax"
+mov *r3, L337
+red L108
+clr r0
+L122: .string "nkjm"
+; comment
+stop
+prn r5
+L123: dec *r3
+jmp *r5
+L124: add r4, *r7
+L125: inc L104
+sub *r0, L117
+bne *r2
+L126: mov L539, *r0
+L127: bne L350
+L128: jmp *r3
+jmp *r6
+L129: jsr *r7
+rts
+L130: mov L105, L487
+L131: jmp L548
+L132: sub #-224, *r5
+L133: red r5
+L134: jsr L549
+sub L470, L270
+L135: jmp L40
+dec L587
+L136: stop
+L137: clr r1
+stop
+L138: .string "lrzppmcpckxjwrzrlqmsjwn"
+L139: .data 557, 475, 63, 866, 544
+; comment
+rts
+add L467, L171
+L140: .string "ahvsinqarydlsyuwjdtxvhfb"
+L141: .data 845, -196, -814, -289, -165, 652, 511
+add *r5, *r2
+L142: red *r2
+L143: .data -11, 530, 2, -163, -77, -947, -775
+inc *r0
+L144: rts
+L145: rts
+L146: sub r3, L180
+red *r0
+L147: bne L61
+L148: jsr *r7
+cmp *r3, *r4
+L149: .string "zcsovyyuhqkgistot"
+L150: clr *r5
+L151: red *r7
+L152: inc r7
+L153: red r3
+clr r2
+L154: mov r6, *r0
+L155: inc L239
+sub #-133, r3
+L156: jmp *r3
+L157: .data 413, -802, 646, 860, 356
+L158: jmp L235
+L159: inc L240
+L160: stop
+rts
+L161: rts
+not L0
+add L281, L117
+L162: clr L70
+L163: add *r6, *r2
+L164: red r6
+; comment
+jsr *r6
+L165: inc *r1
+L166: cmp L166, *r6
+L167: cmp r6, r3
+inc L203
+jmp *r1
+L168: prn L47
+bne L72
+L169: clr *r4
+L170: jsr *r1
+prn r2
+L171: clr r2
+L172: stop
+
+dec r2
+lea L246, r6
+
+L173: rts
+L174: prn r0
+L175: .string "aloyqocloisafiea"
+L176: rts
+rts
+L177: not *r2
+prn L164
+L178: dec *r6
+L179: stop
+L180: .data 361, -232, 185, -979, 588, 225
+L181: rts
+L182: lea L525, r7
+L183: dec L177
+L184: mov #130, r5
+L185: rts
+sub #-19, r6
+dec r4
+L186: cmp r1, #194
+L187: jmp *r5
+L188: red *r7
+L189: .string "ybzsykyxaau"
+L190: clr r4
+jsr *r7
+L191: clr *r6
+cmp r7, L20
+L192: jsr L210
+L193: clr L85
+L194: lea L142, L334
+L195: .data 250, -31, -867, 700, -580, -944
+L196: inc L296
+not *r1
+jsr *r1
+jmp *r0
+L197: mov *r4, *r7
+; comment
+cmp r4, #-10
+L198: clr L123
+L199: inc r0
+L200: .data 744, -979
+dec r7
+cmp r0, #38
+prn *r6
+L201: inc *r4
+L202: sub r2, r3
+L203: rts
+L204: .string "iidksppalmneeu"
+L205: rts
+L206: jmp *r4
+bne L504
+L207: bne L451
+L208: add *r6, r2
+L209: not L206
+L210: mov #143, L132
+L211: sub L41, L325
+L212: red *r6
+
+clr L543
+L213: jsr L52
+jsr *r5
+
+L214: sub #114, r4
+L215: jsr L213
+L216: prn #-200
+L217: .string "lmuneycufpuybyxfmpry"
+L218: .data -291, -851, 8, -183, -144, 582, -259, 126
+not r7
+L219: lea L347, L382
+sub r3, r7
+L220: sub #-179, L185
+L221: bne L282
+rts
+dec L509
+L222: prn #192
+stop
+L223: jsr *r5
+cmp L87, *r6
+L224: .string "rispgaokm"
+L225: .string "xff"
+L226: mov r4, L469
+L227: lea L532, *r6
+L228: bne L264
+L229: .string "hdecxg"
+jsr L545
+rts
+L230: dec *r4
+L231: add L125, r2
+L232: clr L526
+jmp L312
+L233: rts
+L234: .string "hpxnolmc"
+L235: not *r3
+L236: red *r4
+L237: jmp *r7
+
+L238: rts
+inc r1
+L239: .data 610
+L240: add #142, L406
+L241: .data -577, 300, -720, -362, -675, 800, -27
+L242: red *r3
+sub *r6, *r6
+L243: stop
+L244: .data 463, 845, -305, -616, -282, 643
+L245: cmp r2, *r2
+mov L494, *r7
+L246: bne *r7
+not L116
+add L198, *r1
+L247: bne L156
+bne *r3
+L248: mov r2, L214
+
+dec r5
+; comment
+L249: .data 269, 973, 278, 8, 67, 625
+jmp L557
+L250: prn L330
+L251: prn #-11
+jsr *r3
+stop
+not *r5
+L252: lea L537, *r4
+L253: inc *r3
+L254: prn L17
+L255: sub L82, L236
+L256: prn #102
+L257: not L241
+L258: sub L586, *r0
+red r2
+L259: .data 869
+red L253
+bne L355
+L260: rts
+L261: mov *r4, *r5
+L262: red *r1
+L263: inc r4
+bne *r0
+L264: .data -844, 205, 437, -158, -62, -280
+L265: jmp *r2
+L266: jmp L492
+jmp *r2
+L267: clr *r2
+L268: red *r0
+
+L269: red *r3
+L270: jmp L368
+L271: jsr L12
+jsr *r1
+L272: mov #-128, *r7
+clr L57
+L273: red *r1
+L274: .data 558, 378, -761, 901
+L275: jmp *r0
+L276: cmp *r1, L416
+L277: clr *r4
+L278: .data -90, -279, -148, 936, -74, 335, 301, -113
+L279: rts
+
+sub *r0, L529
+; comment
+L280: rts
+L281: jsr *r5
+L282: bne L124
+not *r0
+L283: jmp L176
+dec *r4
+L284: bne L172
+L285: bne *r7
+clr r3
+sub r4, r2
+L286: inc L544
+jsr *r4
+jsr L393
+sub *r1, *r0
+L287: mov *r0, L99
+add #234, r5
+bne L98
+L288: jmp *r4
+L289: .data 898, -789, -862, 721
+L290: not L274
+mov *r1, L419
+L291: dec *r7
+L292: rts
+L293: prn L255
+L294: jsr *r4
+L295: jsr L204
+L296: .string "ucqhhablpjfikyo"
+rts
+L297: rts
+L298: mov r5, r6
+jsr *r6
+L299: .data 785, -796, -547, 383, 394
+stop
+L300: rts
+L301: clr r1
+L302: .data -636, 324, 800, 856, -537, 817, -192, -145
+L303: jsr L208
+bne *r2
+L304: add L176, r3
+L305: .string "mvfcypdrwgmjs"
+L306: cmp r4, L404
+jmp *r6
+sub #-44, L12
+L307: red *r2
+L308: cmp r1, #-117
+bne *r2
+L309: cmp L535, #-40
+L310: rts
+L311: stop
+L312: red L504
+L313: bne L571
+L314: bne *r5
+L315: prn L233
+L316: bne L343
+add #142, *r5
+dec *r5
+L317: stop
+inc r7
+L318: jsr *r4
+L319: cmp #203, L320
+lea L541, r5
+L320: .string "zx"
+L321: red *r0
+rts
+L322: sub *r2, *r2
+
+L323: lea L10, L358
+L324: jsr *r2
+L325: clr L528
+L326: .data -747
+dec *r2
+L327: red r6
+inc L365
+L328: stop
+jmp L302
+dec L310
+rts
+inc L21
+L329: rts
+L330: red L507
+L331: add r5, *r7
+L332: inc r5
+L333: clr L483
+L334: rts
+L335: lea L386, r6
+sub L357, r3
+L336: mov #183, *r5
+L337: red *r0
+L338: jmp L402
+L339: .string "whtay"
+red r0
+L340: jmp *r6
+L341: add #-188, *r7
+L342: stop
+cmp L49, #-100
+red r3
+red *r0
+rts
+; comment
+L343: jmp L358
+L344: bne L416
+L345: stop
+L346: jsr *r5
+L347: sub L477, *r1
+L348: mov L330, *r3
+mov L447, L415
+L349: rts
+L350: .data 964
+stop
+L351: not *r3
+L352: jsr L24
+clr *r0
+; comment
+L353: red *r7
+L354: red *r2
+L355: clr r5
+L356: stop
+bne *r5
+L357: dec r1
+L358: lea L572, L396
+dec *r1
+L359: inc L306
+L360: jmp *r6
+L361: lea L357, *r5
+lea L72, L80
+jsr *r2
+; comment
+L362: .data 432, -71, 437
+mov r2, L67
+L363: not r5
+L364: .string "qdklismzyccqmefmoz"
+L365: dec *r3
+jsr *r7
+L366: mov *r1, *r2
+L367: prn r0
+L368: .string "dclhcu"
+L369: .data 31, 946
+L370: not r3
+sub #124, *r3
+bne L167
+rts
+L371: prn L299
+L372: cmp L207, L132
+stop
+L373: cmp r2, *r2
+L374: dec L472
+; comment
+L375: .data 482, 523, -92, 475, -22, -108, -258
+L376: not L573
+inc r5
+L377: not L141
+add #231, *r4
+not *r2
+L378: sub L395, *r5
+jmp L342
+red L507
+inc *r1
+L379: mov L297, L475
+L380: sub L331, L239
+L381: lea L580, *r7
+; comment
+inc r6
+dec r6
+L382: lea L351, r5
+bne L572
+L383: .string "hvscbzxgyqfqv"
+inc L135
+red r0
+not *r3
+; comment
+L384: lea L437, r6
+mov *r5, r7
+bne L316
+L385: not L497
+L386: add L561, L340
+L387: prn *r6
+cmp *r2, r4
+rts
+jmp L125
+L388: prn #105
+L389: .string "cstlowybumknynozmyqt"
+mov #187, L6
+L390: sub *r4, L593
+L391: dec L518
+L392: clr *r6
+jmp *r2
+red r2
+L393: jmp *r2
+bne *r1
+L394: inc *r2
+jmp L95
+L395: inc L108
+L396: lea L277, *r4
+L397: sub #124, *r3
+cmp *r0, *r1
+L398: cmp L564, L399
+L399: add #-42, r3
+not *r7
+cmp *r4, r7
+lea L28, L53
+mov L444, L536
+sub L451, L218
+L400: stop
+L401: add L464, r6
+L402: rts
+cmp L572, *r5
+L403: rts
+L404: .data -633, -447, 884, -706, 358, 150, 176
+L405: bne *r1
+L406: .string "tnrteuvxmhsupjbs"
+jmp *r4
+stop
+
+L407: inc L562
+L408: lea L444, *r4
+inc r4
+red r0
+L409: .data -544, -748, -643, 898
+L410: prn #122
+jmp L548
+; comment
+inc r4
+prn *r0
+L411: .data 344, 614
+not r5
+rts
+L412: .data -916, 824, 892, -349, -796
+L413: jmp *r4
+L414: lea L301, r2
+L415: jmp L140
+L416: rts
+L417: stop
+stop
+L418: mov *r0, L226
+L419: clr L119
+L420: jmp L176
+L421: jsr L1
+L422: sub L355, r4
+; comment
+L423: red r2
+L424: stop
+jmp *r2
+L425: mov *r1, L480
+L426: not r2
+L427: prn L445
+stop
+L428: .string "ceo"
+L429: red *r5
+L430: prn r0
+L431: .string "aqebbhsfkjvggbhtgygnbmfx"
+L432: dec r6
+not r1
+; comment
+L433: mov r4, *r5
+L434: mov #-79, *r6
+L435: bne *r5
+mov #-192, L456
+L436: .string "ty"
+L437: dec *r2
+L438: jmp *r1
+prn *r2
+L439: add *r2, r0
+L440: stop
+jsr *r2
+L441: stop
+L442: rts
+L443: add *r0, r2
+bne L580
+stop
+L444: lea L507, *r4
+jsr *r6
+L445: .string "vhoahtvgkyrnsmmypzm"
+L446: .string "ul"
+
+jsr L384
+mov #-34, *r5
+L447: prn #-88
+jmp L574
+cmp #-130, r7
+L448: .data 767, 412, 18, -672
+L449: .data -307, -663, -364, -690, -148, 209, -78
+prn *r3
+L450: stop
+L451: clr *r7
+L452: cmp r1, *r6
+L453: prn r1
+L454: cmp #-79, L509
+L455: sub #-130, r0
+jmp *r1
+L456: not L514
+rts
+L457: rts
+L458: clr r3
+L459: stop
+L460: inc L547
+bne L316
+L461: inc L562
+L462: sub r1, *r5
+L463: jmp *r7
+L464: inc L490
+dec L407
+L465: .string "ldzickgailj"
+; comment
+prn L589
+not *r2
+L466: jsr *r6
+
+L467: jsr L594
+inc L80
+sub L336, *r2
+L468: jmp L41
+add #231, *r7
+L469: rts
+L470: clr r5
+dec *r3
+L471: stop
+L472: red L560
+mov r2, L104
+dec r4
+jmp L577
+cmp #-161, #-140
+L473: lea L367, *r4
+clr *r0
+L474: add *r7, L488
+L475: jsr *r2
+inc r1
+L476: jmp L204
+L477: dec L303
+L478: add r7, *r7
+L479: not L406
+add r7, r2
+L480: stop
+L481: inc L496
+L482: rts
+L483: clr L427
+L484: .data -28
+L485: mov #-101, *r4
+lea L575, *r4
+L486: cmp *r2, r0
+L487: .string "y"
+L488: clr r7
+add *r5, r4
+L489: clr r6
+L490: clr r3
+L491: mov L510, *r4
+L492: rts
+L493: mov L435, L190
+L494: inc *r2
+not r3
+rts
+L495: .data -169, 607, -573, -53
+stop
+mov *r2, *r5
+cmp L545, #200
+L496: jsr *r3
+L497: inc *r2
+L498: mov *r1, L591
+L499: cmp *r7, *r7
+L500: sub L400, *r5
+L501: jmp *r6
+L502: .string "gworfbaidskk"
+inc r6
+L503: jsr L509
+inc L288
+L504: red r3
+
+L505: jmp *r3
+L506: .data 633, -618, 711, -79, -561, 240, 175
+inc *r5
+dec r3
+L507: .data 49, -998, 971, 508, -558, -972, 587, -773
+L508: .string "shsdnpxtscultxosapzpnw"
+L509: jmp *r2
+sub *r2, *r7
+L510: bne *r3
+add *r3, *r5
+L511: cmp r4, *r1
+L512: lea L573, L138
+stop
+clr *r1
+L513: red L444
+L514: rts
+L515: bne L583
+cmp #166, *r4
+cmp L527, r1
+lea L100, *r7
+L516: clr L111
+; comment
+L517: dec r1
+
+inc r0
+add #109, r0
+L518: cmp L586, L210
+L519: mov r2, L385
+dec *r2
+L520: mov r0, r5
+L521: .data -563, 933, -427, -407
+L522: inc *r6
+red *r7
+L523: lea L544, r0
+L524: clr L259
+; comment
+L525: add *r3, L83
+L526: .data 240, 745, -285, -94, 869, 282
+stop
+; comment
+L527: jmp L173
+L528: bne L147
+; comment
+mov #-220, r0
+mov L555, *r7
+bne *r6
+lea L570, *r6
+clr L560
+L529: lea L457, r2
+L530: jsr L273
+L531: .string "vwdzinuviuvwbok"
+L532: dec *r3
+; comment
+L533: sub L271, r5
+dec L554
+cmp #136, #191
+bne *r3
+L534: not *r3
+rts
+L535: clr L75
+; comment
+L536: .data -206, -52, -159, -154
+L537: inc *r3
+L538: .data -673, 631
+clr *r5
+prn *r7
+L539: add #-208, *r0
+L540: prn L159
+L541: add *r2, L547
+L542: jsr L76
+cmp #-244, *r4
+bne *r5
+cmp #62, #92
+L543: mov L341, L557
+L544: red L370
+L545: not r3
+; comment
+L546: jmp *r3
+not *r6
+sub *r2, *r6
+lea L360, L39
+L547: jmp *r2
+add #-198, *r4
+L548: prn L551
+L549: clr r5
+L550: .data -391, -565, 749
+L551: cmp #-208, L557
+prn #160
+L552: stop
+L553: stop
+L554: clr *r0
+L555: add *r5, r1
+L556: cmp L305, *r5
+jmp *r0
+sub *r5, r6
+L557: .string "sn"
+jmp L576
+L558: add *r6, *r4
+L559: jmp *r0
+; comment
+L560: rts
+lea L222, *r7
+L561: .data -477
+jsr *r5
+not r6
+L562: rts
+L563: cmp #-33, #150
+red *r5
+L564: lea L355, *r6
+add *r1, r0
+L565: .data 486, -506, 248, 738
+L566: not *r5
+jsr *r4
+L567: clr *r4
+lea L568, L18
+L568: lea L438, L581
+rts
+L569: clr r7
+L570: inc L580
+not L1
+prn *r0
+L571: clr L362
+L572: .data 455, 279, -162, 916, 54, -606, -590
+cmp #0, #149
+L573: cmp *r3, *r0
+L574: .string "nlnkpjqted"
+lea L580, *r5
+L575: add L60, r4
+L576: add #-239, *r0
+; comment
+jsr L240
+rts
+L577: red L482
+jsr *r1
+
+clr *r7
+L578: stop
+jmp *r3
+L579: .data -480, -772
+L580: add #-4, r7
+inc *r5
+L581: stop
+L582: stop
+not *r7
+L583: .data -986, 148, -675, -986, 453, -762
+lea L591, L198
+L584: .data -986, 354
+L585: cmp *r6, r3
+L586: lea L594, r1
+prn r2
+L587: stop
+jsr *r6
+stop
+L588: .data 488, 58
+L589: bne L71
+L590: .data -991, 153, -845, 908
+L591: inc *r0
+L592: stop
+cmp r7, L187
+L593: .data -10, -421
+lea L302, *r0
+stop
+; comment
+L594: dec r0
+L595: sub #121, L596
+L596: inc *r1
+L597: stop
+stop
@@ -0,0 +1,1040 @@
+; Generated by genCorpus --seed 57
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+bne *r0
+L0: add r1, r4
+L1: lea L1, r1
+L2: rts
+L3: cmp *r5, L454
+mov *r5, *r2
+L4: sub L490, r2
+L5: add *r6, L472
+L6: sub r2, r4
+rts
+L7: bne *r4
+L8: not *r7
+L9: lea L7, *r6
+clr L3
+dec r7
+red L3
+L10: mov #-226, r1
+L11: stop
+L12: jsr *r6
+lea L0, L2
+L13: cmp #232, L13
+add r7, L11
+L14: jmp *r0
+mov r7, L13
+add r3, *r6
+L15: .string "wjyampbnmwzzdgs"
+L16: red r1
+L17: jsr *r5
+L18: clr L513
+bne L517
+prn *r5
+L19: red r7
+L20: stop
+L21: mov #204, L359
+bne *r2
+red L91
+L22: clr r5
+L23: stop
+L24: cmp *r7, #-34
+L25: cmp #-185, L367
+jsr *r4
+
+L26: clr *r3
+L27: mov #2, r6
+jsr L0
+cmp r0, r7
+L28: lea L546, L19
+L29: not *r0
+not L223
+L30: prn r4
+L31: cmp *r3, #103
+L32: stop
+L33: jmp *r1
+L34: rts
+L35: rts
+L36: sub r5, r3
+L37: red L25
+bne L67
+dec L193
+L38: stop
+L39: .string "dcixndmhadhclbavn"
+clr *r2
+L40: .string "qccw"
+L41: lea L4, L31
+L42: .string "tmxdnsnrbkbz"
+L43: prn L227
+rts
+L44: .string "gojqqcedp"
+mov #204, r3
+jmp L28
+L45: rts
+L46: .data -489, 138, 635, -876, -82, -189, -613, -239
+L47: bne *r2
+L48: stop
+L49: jmp *r2
+L50: clr r0
+L51: add #-101, r1
+L52: jsr *r1
+mov #245, r4
+dec *r1
+lea L15, r1
+L53: .data 481, -850, -15, 532
+L54: cmp r5, L17
+L55: stop
+L56: jmp L361
+L57: cmp r7, L45
+inc *r3
+L58: bne L386
+dec *r0
+L59: inc r4
+sub *r3, L17
+L60: clr L25
+L61: add #-218, L21
+prn *r4
+L62: clr r5
+L63: sub *r0, r2
+L64: jsr L548
+L65: add L554, r2
+lea L35, r3
+L66: .data -879, 156, -421, -1, -354, 323, -413
+L67: .string "cbfyrimdclhfdw"
+red r7
+L68: stop
+not r2
+L69: jmp *r4
+L70: not *r4
+L71: not r3
+L72: .data -97
+L73: stop
+L74: prn L22
+jsr L518
+clr L48
+L75: stop
+; comment
+clr *r3
+jmp *r7
+L76: mov r2, *r0
+L77: red r0
+L78: .string "njymuvcuqky"
+L79: inc *r5
+; comment
+jmp *r2
+jmp *r6
+L80: .data -174, -877, 775, 885, 504, -404, -189
+L81: sub #211, *r7
+L82: .data -475, 636, 93, 984
+add #186, r0
+L83: cmp #-95, r5
+stop
+jsr *r1
+L84: stop
+L85: add *r7, L498
+L86: cmp L463, *r0
+L87: not *r6
+not r2
+L88: mov #-157, L459
+L89: sub #-225, r7
+clr L86
+add L64, *r6
+L90: jmp *r3
+L91: red r7
+L92: cmp L24, *r2
+stop
+cmp #-222, L38
+L93: jsr L257
+L94: bne L88
+
+inc r5
+jsr *r2
+mov *r0, *r0
+L95: lea L554, *r7
+L96: prn r6
+not r5
+L97: red r2
+L98: jsr *r3
+L99: dec L7
+L100: mov L89, *r2
+L101: .data 854, 111, -819, 729, 842, -920, -521, -479
+L102: red r5
+; comment
+L103: sub *r5, L185
+L104: cmp *r4, r6
+L105: .string "swcrmfsevygmkpy"
+L106: jmp *r2
+L107: .data 77, -812, -944, 505, 87, 763
+; comment
+L108: jsr *r2
+L109: dec *r2
+L110: sub L485, *r4
+L111: rts
+L112: .string "zcqlndiqhaagm"
+L113: red L9
+rts
+prn #243
+L114: red r0
+jmp *r7
+dec L29
+; comment
+L115: .data 397, 901, -308, 178, -148, -617, 365, 765
+L116: add #58, L72
+add #152, *r2
+add r7, L39
+mov r4, *r1
+bne L336
+clr L320
+clr *r6
+L117: mov *r0, L14
+L118: .string "xplurni"
+L119: red r0
+L120: cmp #-197, #125
+; comment
+L121: clr *r5
+red L524
+L122: .string "raaaex"
+L123: .string "bosgpecnouxot"
+L124: rts
+L125: mov L131, L102
+L126: .data 691, -794, -59, 565, 260, -302
+lea L20, *r7
+L127: jmp *r4
+add L27, *r0
+L128: bne L121
+jmp L125
+red r5
+L129: prn L168
+L130: clr L109
+sub #-208, L111
+L131: not L278
+
+mov L123, L321
+prn *r6
+not r3
+L132: .data -788, 378, 415, 773, 912, 691, 495
+prn L115
+L133: .data 926
+L134: cmp *r3, L528
+L135: dec r2
+L136: mov r5, L117
+L137: rts
+L138: bne L134
+inc *r3
+cmp #-131, *r2
+L139: prn *r0
+L140: cmp *r6, L543
+L141: clr *r5
+prn *r5
+L142: dec *r4
+not *r2
+L143: not L14
+prn L356
+jsr *r7
+L144: clr L48
+L145: jmp *r1
+L146: prn #-18
+jsr *r0
+jsr L139
+L147: .string "slszbkrazdvlcuccqzqz"
+L148: lea L370, r2
+L149: jsr L244
+jmp L588
+L150: sub #202, L373
+L151: dec L148
+not *r7
+L152: dec r7
+L153: lea L532, r0
+clr L549
+L154: red L566
+L155: jmp *r7
+L156: clr *r0
+L157: inc r0
+bne *r7
+L158: .data 92, -629, 309, -602, -234, -903
+
+L159: .string "lgqqb"
+
+L160: lea L126, *r5
+L161: add L432, *r7
+L162: inc *r1
+not r5
+L163: rts
+L164: clr r2
+cmp L163, r2
+L165: stop
+L166: .data -338, 963, 197, -572, 514, -889
+L167: .string "rouhnlongzhogcqqxswhe"
+L168: bne *r4
+inc L11
+L169: .data 426, 983
+cmp r3, *r2
+L170: stop
+dec *r4
+
+rts
+; comment
+add r0, r3
+; comment
+L171: .data -95, -866, 491
+not L579
+mov L189, *r1
+L172: red L28
+cmp r5, L3
+L173: sub #88, L117
+lea L186, L558
+red L289
+L174: prn r3
+L175: dec L295
+L176: jmp *r5
+L177: stop
+L178: bne *r2
+L179: .data -835, -948, -995, -5, 331, -421, -151, -997
+mov r0, r4
+L180: red L271
+L181: dec r7
+L182: inc L515
+L183: dec L336
+L184: rts
+not *r5
+add r1, r2
+not L97
+L185: dec r7
+L186: mov L173, r7
+jsr *r5
+L187: .data 512
+L188: stop
+cmp r6, *r4
+L189: dec L193
+L190: rts
+L191: mov #226, L366
+L192: red r0
+red *r4
+L193: cmp L167, #-159
+L194: stop
+L195: add L144, r7
+rts
+inc L481
+L196: bne L136
+L197: clr *r6
+L198: inc *r2
+
+L199: stop
+L200: dec *r2
+
+L201: add #82, L157
+L202: stop
+L203: stop
+L204: add L570, L392
+L205: not r6
+L206: inc *r5
+lea L138, *r2
+L207: stop
+dec L590
+L208: red *r4
+red *r1
+lea L480, L313
+rts
+mov r0, *r5
+rts
+lea L120, *r6
+
+L209: clr r2
+jsr L352
+sub L367, r0
+L210: red L515
+L211: sub r1, L74
+L212: .data 946
+L213: bne L81
+add L275, r2
+red *r0
+dec *r6
+rts
+clr L104
+L214: dec *r5
+L215: stop
+
+clr L444
+inc r6
+L216: prn r3
+jsr L1
+L217: .string "vflzqerqmpg"
+L218: clr r0
+bne L107
+jmp L541
+L219: jsr *r5
+jmp *r5
+L220: .data 630, -909, -477
+L221: inc r3
+stop
+L222: clr L103
+L223: mov r6, r7
+add L138, *r0
+L224: mov #226, r1
+L225: cmp *r2, *r0
+rts
+jmp L39
+; comment
+prn L419
+not L128
+L226: not L136
+L227: stop
+L228: not L430
+L229: red r0
+L230: bne L493
+L231: cmp #-214, L225
+
+L232: stop
+red L61
+mov r7, L474
+sub L318, *r3
+cmp #-217, L100
+; comment
+; comment
+L233: red *r4
+L234: lea L142, *r7
+L235: red r7
+L236: bne L513
+L237: .string "zzkbbpeqoxtmbqsmey"
+not L93
+
+L238: prn #-188
+L239: rts
+L240: .data 664, -916, 345, 242
+; comment
+L241: cmp L421, r4
+clr L522
+stop
+L242: red L526
+L243: dec *r4
+L244: prn #-234
+L245: add *r3, L419
+L246: add r2, *r0
+L247: jmp *r6
+
+L248: jsr L64
+L249: rts
+L250: inc *r5
+cmp *r3, #-134
+L251: stop
+L252: not L35
+inc r2
+L253: dec L67
+add *r4, r0
+L254: add #-51, *r6
+L255: lea L147, L156
+rts
+L256: cmp *r4, #-60
+dec r4
+mov #-46, L47
+L257: inc *r1
+L258: mov r6, *r3
+L259: inc r1
+add r0, L450
+L260: dec *r0
+L261: clr L476
+L262: .data 781, 680, 454, -183, -804
+stop
+L263: add r7, L133
+L264: lea L385, *r0
+L265: cmp r1, L350
+prn *r7
+L266: clr r7
+L267: bne L402
+L268: stop
+L269: red r5
+L270: .string "yvdawlzrpogzswh"
+L271: prn r4
+not L399
+L272: mov L425, L184
+L273: stop
+stop
+L274: .data -126, -606, 599, -928, 98, 510
+L275: rts
+L276: jmp *r6
+sub *r6, L34
+lea L500, *r1
+L277: .string "toghl"
+
+L278: dec r2
+; comment
+L279: sub L363, r3
+L280: mov #199, L566
+lea L321, *r4
+L281: lea L379, *r1
+L282: inc L297
+L283: cmp L524, #197
+red *r1
+lea L83, r3
+L284: .string "xnerjrycxbhhdymnrbazupp"
+stop
+L285: jmp *r3
+L286: rts
+L287: not r0
+inc *r5
+
+
+L288: mov *r1, L214
+L289: red r0
+prn *r3
+L290: .data 223, 781, -956, -944, -670, 819, -852, -640
+L291: .data 126, -128, 91, 854, -127
+L292: mov r3, *r1
+L293: add *r2, L360
+
+L294: .string "x"
+clr *r0
+L295: inc L524
+L296: bne L446
+stop
+inc r3
+jmp *r1
+lea L187, r6
+L297: .string "fcp"
+L298: clr *r5
+mov r0, L173
+add r5, *r7
+L299: jsr L424
+L300: jmp L194
+L301: sub r6, L7
+L302: .string "tuzysyujahpbx"
+sub r5, *r2
+L303: jmp *r3
+L304: jsr *r6
+L305: clr *r1
+L306: clr L324
+add *r7, L456
+jsr *r2
+L307: inc L199
+L308: prn L420
+L309: lea L57, L531
+
+L310: cmp L185, *r1
+L311: stop
+lea L56, *r2
+L312: clr L231
+prn #143
+L313: sub *r0, L82
+L314: lea L386, r0
+clr L346
+L315: not r0
+bne L285
+L316: clr L498
+sub r3, r0
+
+L317: add *r1, r4
+mov L452, r4
+L318: red L326
+L319: cmp L175, r1
+L320: mov L193, *r4
+L321: prn r3
+L322: clr r5
+mov L547, L473
+jmp L50
+jsr L243
+L323: inc L160
+red L57
+L324: prn r5
+
+L325: inc L84
+prn r2
+L326: stop
+jmp L172
+add r2, L247
+L327: dec L298
+bne L227
+L328: stop
+; comment
+L329: clr L441
+; comment
+L330: prn r4
+L331: jmp *r4
+L332: jmp L296
+jsr L157
+L333: red L593
+L334: prn #188
+L335: not *r5
+L336: dec r6
+L337: inc r2
+cmp r1, r5
+; comment
+L338: sub *r7, *r7
+red *r4
+L339: stop
+inc r0
+inc L470
+rts
+mov #70, L108
+L340: inc L91
+L341: red L475
+L342: not L575
+L343: rts
+L344: add #-97, r0
+L345: .data -635, 878, -238, -945, 723, -303, 530
+L346: .data -48, 21, -959, 899
+L347: lea L594, L208
+stop
+add L99, *r6
+stop
+L348: rts
+L349: prn L482
+rts
+rts
+jsr L347
+; comment
+stop
+dec *r1
+inc *r0
+L350: stop
+L351: stop
+sub L26, r3
+stop
+add r1, r5
+bne L270
+L352: inc *r5
+L353: clr *r1
+L354: .data -929, -883, -374, 214, 72, -912, 688, 270
+dec r3
+
+jmp *r7
+
+L355: jmp L447
+L356: .string "gjsaqameouae"
+L357: stop
+L358: jsr *r2
+dec L297
+red *r4
+L359: inc *r4
+lea L534, r7
+bne *r0
+L360: add #62, r4
+mov r1, *r6
+; comment
+lea L65, L470
+not *r0
+L361: red L248
+inc L441
+L362: lea L401, L509
+prn #119
+dec *r1
+L363: clr r6
+bne *r1
+L364: jmp L468
+L365: lea L481, *r7
+L366: jsr L182
+inc L535
+L367: .data -851, -388, 729, 979, -23, -479
+L368: red L581
+L369: add *r3, r0
+prn L19
+L370: mov #-32, L372
+L371: not L305
+
+
+L372: .string "titiefs"
+L373: rts
+L374: jmp *r7
+jmp L472
+L375: cmp L501, r1
+L376: .string "zriubkxqsdq"
+stop
+L377: jsr L221
+L378: bne *r5
+not *r2
+L379: .data 864, -566, 626, -725, -353, -302
+; comment
+L380: jsr *r0
+L381: lea L411, r3
+L382: lea L48, L508
+jmp *r5
+L383: .string "ljxsqpuvvslrew"
+add #-161, L543
+L384: not *r3
+L385: dec r6
+L386: prn #-45
+L387: not r4
+cmp *r7, L389
+clr L89
+L388: add r2, r4
+L389: clr r0
+add #-102, *r0
+L390: .data -871, 767, 822
+L391: sub #-95, r1
+L392: clr *r4
+red r6
+L393: clr r6
+L394: lea L73, L523
+L395: mov L517, r0
+L396: add r4, *r2
+L397: cmp r7, #-202
+not r1
+rts
+mov r5, r4
+L398: mov #-50, r7
+L399: lea L409, L406
+lea L291, L550
+L400: .string "rtzgg"
+jmp L553
+L401: cmp #-206, *r2
+L402: inc r0
+not r2
+L403: not r1
+jsr *r6
+bne *r7
+L404: bne L485
+not r5
+L405: mov L498, L476
+L406: not *r5
+L407: not r1
+prn L567
+; comment
+L408: prn L591
+L409: .string "wuiyclnqdcatscppkyvawiku"
+clr *r4
+stop
+red *r3
+red *r2
+not r3
+L410: red L126
+L411: inc L83
+add #95, r0
+L412: lea L265, r2
+mov #73, r5
+L413: jsr L306
+prn #150
+L414: clr *r7
+rts
+L415: .string "anwvubjcirw"
+L416: red r0
+L417: inc r0
+red r3
+L418: red *r6
+L419: bne L475
+not L422
+L420: cmp *r7, *r2
+jmp L569
+L421: .data 470, -33, 544
+; comment
+dec *r5
+L422: jsr *r0
+jmp *r3
+L423: .string "veqxxpimndywdiskgott"
+L424: inc *r3
+clr *r6
+red L453
+L425: dec *r6
+stop
+L426: dec r3
+stop
+L427: .string "u"
+L428: jsr L56
+L429: inc r3
+L430: inc r0
+L431: not r6
+mov *r3, *r0
+L432: .data -279, -166
+L433: .string "yfs"
+red *r1
+L434: .data 612
+lea L562, *r1
+sub *r4, *r2
+L435: rts
+L436: lea L111, r2
+L437: .data 953, -385, -317, 905, -159, -865, 59
+L438: lea L304, r2
+bne L65
+bne *r6
+L439: .data 13, 838, -616, -438, -315, -985
+L440: .string "wzchpup"
+lea L491, L594
+L441: not *r5
+lea L352, r7
+L442: sub #-79, *r6
+jsr L32
+L443: rts
+L444: dec r4
+jsr *r7
+inc L187
+L445: clr *r3
+dec r3
+L446: cmp L500, *r7
+L447: .data -70, 592, 995
+cmp #-211, #-189
+L448: clr *r7
+clr r5
+L449: .data -944, 984, 828, -786, 883
+L450: not *r7
+L451: jsr L581
+L452: stop
+L453: prn #138
+L454: cmp *r2, #243
+L455: inc r2
+clr r7
+L456: red *r2
+L457: mov L280, r5
+jmp L484
+; comment
+dec r1
+dec L38
+L458: lea L350, L491
+L459: bne *r2
+L460: inc *r0
+L461: bne *r0
+L462: not r3
+L463: cmp r4, r0
+jsr *r3
+not L299
+L464: lea L550, *r4
+L465: .string "dhvsr"
+L466: mov #217, *r3
+L467: red r5
+L468: jsr L370
+red L183
+L469: .string "aetqfrbeua"
+L470: bne *r6
+lea L417, L289
+rts
+lea L497, r2
+L471: jsr *r0
+sub r0, L479
+L472: sub r2, L477
+add #-154, L566
+L473: not L541
+mov r1, *r2
+sub L516, r7
+L474: jsr L436
+L475: jsr *r5
+L476: rts
+L477: rts
+L478: inc r1
+dec r7
+
+jsr L340
+L479: add r2, *r3
+L480: stop
+dec *r6
+L481: .data 683, 243, 804, -656, 865, -582, -441
+L482: clr *r1
+L483: prn r2
+L484: bne L327
+L485: .string "jexizkwwgnuhp"
+L486: cmp L252, #-175
+L487: dec *r4
+cmp *r6, L502
+jsr L284
+L488: clr r6
+L489: stop
+L490: inc L526
+L491: stop
+red r4
+dec L493
+; comment
+L492: mov *r7, L592
+L493: rts
+L494: .string "gftdtzrlxjagcgl"
+L495: red r7
+inc r7
+sub r6, r7
+L496: jsr L104
+L497: dec *r6
+stop
+add #82, L533
+L498: .data 566, -930, -970, 380
+L499: jsr L44
+sub #171, L257
+L500: not *r5
+L501: .string "treqncogcgeibjk"
+jsr L364
+jmp L285
+L502: add r5, *r7
+L503: cmp *r3, r7
+sub *r1, r7
+stop
+L504: .data -460, -377, 777, -150, -377
+L505: inc *r0
+L506: dec L258
+jsr *r7
+L507: jsr L517
+L508: mov *r0, *r7
+clr *r7
+mov r2, r7
+L509: bne L513
+cmp L550, *r7
+L510: .data -257, -795, 421
+rts
+prn #179
+L511: cmp *r5, L581
+red r4
+L512: not *r5
+L513: mov r3, r3
+dec L110
+L514: rts
+; comment
+L515: not *r0
+L516: inc r0
+dec r3
+lea L395, *r6
+clr *r0
+stop
+dec *r5
+L517: lea L539, r5
+L518: lea L566, L584
+L519: bne L34
+L520: sub r2, *r2
+mov r7, *r6
+L521: prn r5
+L522: clr *r2
+not *r2
+L523: bne L573
+bne *r0
+L524: jsr L528
+; comment
+sub *r7, L560
+cmp L463, #-254
+L525: not *r4
+
+L526: .data -353, -572
+L527: mov #-97, L109
+L528: cmp #-182, r0
+
+L529: lea L169, *r5
+jsr L556
+L530: sub r6, *r2
+L531: .string "k"
+sub *r1, r2
+L532: add r6, *r6
+jsr *r2
+L533: not r3
+L534: .string "uvmlndakb"
+L535: clr *r2
+L536: lea L590, L75
+
+dec L560
+; comment
+L537: mov L133, r2
+prn L539
+not L238
+L538: dec *r2
+L539: .string "coufc"
+L540: sub #-214, r2
+L541: cmp L138, *r0
+jsr L561
+L542: bne *r5
+L543: .string "peldm"
+L544: red *r1
+L545: dec *r5
+jmp *r5
+L546: dec r2
+cmp *r6, #-131
+L547: jsr L578
+red r5
+L548: mov r5, *r0
+inc *r5
+inc *r4
+L549: red *r2
+L550: add *r7, *r1
+rts
+lea L584, L592
+L551: not L400
+lea L221, *r2
+L552: rts
+rts
+prn L48
+L553: clr *r6
+L554: stop
+jsr L576
+L555: inc *r7
+L556: .string "bwcyj"
+L557: bne L94
+cmp r0, *r5
+L558: inc r1
+bne *r6
+L559: lea L573, r5
+L560: cmp L575, *r2
+add r1, r6
+rts
+L561: .string "mwbou"
+L562: inc r4
+L563: .data 322, 288, 86, 780
+L564: .string "rbaddwetvyvoxibjeyyl"
+L565: inc *r4
+L566: rts
+L567: lea L410, *r0
+L568: jmp *r5
+L569: prn L580
+prn *r1
+L570: .data -98, 930
+L571: prn #9
+L572: red r6
+L573: .string "hyoonbdaxpaubgercafuxjkk"
+L574: not *r6
+
+sub *r3, L535
+inc L592
+L575: inc L593
+L576: jmp L585
+L577: bne L587
+not *r3
+L578: mov *r3, *r7
+L579: stop
+red L509
+L580: .data -747, 412, -616, 364, 366
+L581: .string "xpavskyx"
+jmp *r4
+L582: add L593, r0
+L583: not *r1
+add *r5, L594
+jsr *r2
+jmp *r0
+not *r5
+L584: dec L588
+L585: dec r5
+L586: bne L593
+L587: jsr L167
+L588: stop
+L589: cmp #131, #203
+L590: dec *r2
+L591: sub L433, r1
+stop
+L592: prn #207
+L593: dec r6
+L594: add L187, r2
+add *r6, r2
+stop
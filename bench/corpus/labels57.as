@@ -0,0 +1,1039 @@
+; Generated by genCorpus --seed 58
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+L0: red r3
+L1: clr *r7
+L2: rts
+rts
+mov #63, L222
+add #-151, L0
+L3: red r5
+red *r0
+L4: lea L317, *r4
+L5: rts
+bne *r5
+L6: inc *r2
+L7: .data 651, -687, -72, 219, 797, -125
+L8: mov #-198, L4
+; comment
+bne *r0
+L9: dec *r0
+stop
+L10: jmp L209
+sub L1, r4
+L11: .data 652, -777, 729, 398, -888, -169
+L12: clr r4
+lea L272, r4
+add #240, L169
+L13: not L3
+mov *r1, *r1
+L14: jmp *r5
+prn #-149
+L15: .string "iujusrjhzopfxhcroc"
+jmp L10
+
+dec r1
+L16: bne L191
+dec *r6
+dec r4
+L17: .data -877, 954
+L18: red L15
+L19: .string "qpbuqyndpqrhiaqssr"
+not *r1
+L20: add *r2, L3
+not r4
+L21: stop
+cmp #209, *r4
+prn #-153
+L22: prn L3
+L23: rts
+dec *r3
+L24: bne *r4
+L25: mov *r4, r4
+L26: rts
+red *r1
+inc r7
+L27: .string "bhxivoisoixyg"
+L28: dec L1
+; comment
+red L10
+L29: lea L410, L217
+sub *r2, *r0
+dec L14
+L30: stop
+L31: mov L30, *r0
+sub #-109, L512
+L32: dec r1
+L33: dec *r6
+L34: .string "ljztxmfjdjkczxdx"
+L35: .string "xhacvlqijxdpwpyueb"
+L36: mov L277, *r6
+L37: stop
+jmp L32
+L38: inc L509
+L39: not r4
+inc L283
+inc L193
+jsr L502
+add r2, r4
+L40: not *r7
+L41: .data 455, -534, 931, 45, 54, 19, 973, 107
+L42: bne *r6
+L43: red *r4
+not L41
+L44: bne L137
+not r2
+jsr *r2
+L45: lea L28, L466
+red L210
+L46: sub #-105, r0
+L47: cmp r7, L324
+L48: jsr L41
+lea L49, r7
+; comment
+L49: jsr L43
+L50: inc *r4
+L51: stop
+L52: cmp r1, #9
+L53: .data 466, -57, -198, 81, 627, -166
+L54: .data -298, 187, 698, 423, -440, -446, -174, 707
+L55: sub r4, r0
+L56: dec r1
+L57: stop
+L58: bne *r4
+; comment
+L59: bne L121
+L60: add *r4, *r2
+bne *r2
+L61: jmp *r3
+L62: jmp L582
+stop
+lea L21, L43
+L63: add r2, *r3
+L64: rts
+L65: sub L63, r1
+bne L29
+L66: .data 800, -4, -988, -613
+not L525
+L67: stop
+L68: stop
+L69: bne L335
+L70: jsr L89
+red r1
+bne L69
+L71: rts
+lea L39, r0
+red *r6
+prn L53
+sub r6, *r0
+L72: jmp *r2
+L73: red L51
+
+L74: red L18
+L75: not *r1
+; comment
+L76: prn L63
+L77: .data -442, 458, 215, 810, 577, -634
+L78: bne L45
+lea L16, *r4
+L79: not *r6
+L80: .data 779, -50, 503
+L81: mov #-196, r2
+mov *r7, L426
+L82: prn *r3
+lea L208, r0
+dec r2
+L83: jsr L230
+L84: stop
+L85: inc L200
+rts
+
+L86: .string "hamtmnvhfmarvgpwlbxil"
+L87: bne L61
+add #188, *r0
+L88: jsr *r0
+not r7
+jmp L55
+L89: red r1
+rts
+lea L18, r4
+L90: .string "xdszkmydssxynrnaiehovdw"
+L91: red r0
+stop
+clr *r4
+L92: .string "nwxclwepgtdczrnpjvddbzc"
+L93: stop
+L94: .data -125
+cmp L159, L187
+L95: sub r5, *r7
+stop
+L96: .string "oulfokgcgpovys"
+L97: stop
+L98: sub *r3, L58
+not r3
+jsr *r6
+L99: rts
+L100: bne L92
+rts
+L101: not *r1
+jmp L87
+L102: inc *r1
+bne L34
+lea L32, *r3
+add r7, L15
+L103: .string "xmkargcfiggyry"
+L104: jmp L142
+rts
+stop
+L105: jmp *r5
+red r7
+L106: lea L388, L507
+L107: clr L246
+L108: .data 582, 603, -990
+L109: rts
+L110: lea L36, L467
+L111: jsr *r7
+L112: not *r1
+rts
+; comment
+L113: .string "gtsklljxin"
+L114: jmp L25
+sub #216, *r7
+L115: .data 468, -649, -283
+L116: cmp L44, L46
+cmp r0, r6
+; comment
+L117: add L88, *r3
+L118: .data -792, 457, 391, -789, -694, 834, 134
+lea L384, L71
+L119: dec L468
+L120: sub L96, *r3
+mov r2, L555
+L121: clr L3
+bne *r2
+L122: clr L525
+L123: jsr *r4
+clr *r0
+L124: jsr L569
+
+L125: jmp *r1
+dec r2
+L126: bne L30
+L127: dec L106
+add L558, L2
+L128: prn L548
+lea L421, r7
+L129: clr r4
+L130: .data -112, -859, 597, -564, -761, 341, -39, -12
+L131: .data -535, 207, -332, -479, 138, 448, -114, -593
+L132: not r3
+lea L475, r3
+mov #-241, L16
+sub #-147, r4
+L133: cmp *r1, *r7
+; comment
+L134: inc L462
+L135: lea L20, *r1
+cmp L357, L511
+L136: clr r2
+L137: .data -148, -944, 940, 440, -250
+
+L138: inc r5
+L139: .data 484, 776
+L140: inc r4
+sub #189, r5
+L141: prn L105
+L142: .data -508, 890
+L143: bne L98
+dec r5
+L144: bne L588
+L145: dec r1
+L146: stop
+red L117
+L147: red r6
+L148: .string "rnhsabercsujucimvgtnug"
+L149: sub #-81, r1
+inc r5
+jmp *r1
+L150: .data -389, -805, 113, -766, -941, -871, -700, 226
+sub r3, L5
+sub #-5, *r0
+jmp L266
+cmp L395, L313
+L151: add *r5, r6
+L152: bne *r7
+L153: lea L89, L322
+L154: inc *r0
+L155: jmp *r0
+mov L46, *r4
+sub r5, *r7
+L156: mov r5, r7
+L157: bne L29
+clr *r1
+cmp r2, #120
+L158: rts
+jmp *r3
+L159: sub L35, r6
+L160: lea L70, *r3
+; comment
+L161: not r1
+L162: cmp #157, L81
+L163: not r3
+cmp r4, r7
+L164: .data -145
+dec *r5
+add *r5, r4
+jmp L408
+L165: red r0
+L166: jmp L433
+L167: .string "kxrsjbqtylkfnfqtx"
+L168: stop
+inc *r3
+L169: lea L327, r2
+L170: sub *r6, *r5
+L171: rts
+L172: .data -727, 519, -315
+L173: .string "bhdbqdeljwxzhecwyaafc"
+L174: jsr L148
+L175: mov r0, *r6
+red L23
+L176: sub *r4, L30
+jsr L160
+inc L6
+red r5
+jsr *r4
+L177: stop
+L178: dec L38
+L179: sub r3, *r2
+L180: mov r7, *r5
+L181: .string "bssgtvfzdbiudjgvb"
+red r6
+not *r7
+jmp *r6
+
+jsr L112
+prn L116
+L182: add L379, *r1
+not r4
+L183: jmp L4
+rts
+L184: prn *r7
+L185: .data 26, -674, 800
+L186: clr *r0
+L187: not L350
+L188: cmp L298, r7
+L189: jmp L410
+L190: lea L315, L85
+L191: mov #175, L483
+inc *r4
+L192: clr *r3
+cmp r7, #62
+L193: prn *r1
+clr r2
+L194: jsr *r2
+stop
+add L381, L407
+L195: lea L303, r6
+L196: add r0, *r2
+L197: add *r2, L503
+L198: rts
+L199: jsr *r1
+L200: prn #58
+lea L305, r3
+L201: add *r1, r1
+L202: clr L238
+inc r6
+L203: clr *r5
+
+L204: stop
+L205: jmp *r6
+sub r0, *r0
+L206: .string "hlujbqjcbdi"
+stop
+L207: clr L546
+L208: not *r2
+L209: .data -239, 493, -573, -950
+L210: jsr L254
+mov *r2, *r4
+inc *r7
+L211: dec r3
+L212: rts
+add L164, r6
+dec L330
+L213: prn *r6
+jsr L399
+L214: not r4
+; comment
+L215: .string "dqmqkagoinoswbn"
+jmp L343
+sub L516, L517
+L216: inc L172
+L217: mov L152, *r4
+L218: lea L74, r4
+not r0
+inc *r5
+cmp L240, *r3
+L219: cmp #-126, *r0
+inc r7
+L220: red *r7
+clr r1
+L221: prn L379
+L222: lea L201, r1
+dec L204
+
+L223: bne L216
+L224: .data -754, 992, -168
+L225: jsr *r7
+L226: rts
+L227: sub L137, r3
+add L231, L222
+jmp *r1
+add L86, L75
+bne L239
+L228: .data 795, 947, -437
+L229: lea L292, *r4
+jmp L295
+prn r4
+bne *r7
+stop
+L230: sub L424, *r5
+L231: bne *r6
+L232: add #186, L245
+not *r1
+not L116
+L233: bne L109
+L234: add #-247, L154
+L235: clr L287
+stop
+red r4
+bne L466
+jsr *r1
+L236: .string "u"
+L237: red *r7
+jsr *r1
+L238: red *r6
+rts
+L239: .string "ri"
+L240: dec L542
+L241: .string "svrqmz"
+add *r7, r3
+L242: rts
+L243: lea L328, r7
+jmp L302
+L244: .string "ow"
+rts
+L245: clr *r2
+L246: jmp L142
+L247: red L138
+not r7
+L248: .data 794, -638, 382, -511, 339, 564
+L249: clr *r4
+jmp L368
+jsr L385
+L250: add L181, L275
+; comment
+L251: cmp #103, L476
+L252: red *r4
+sub #130, L525
+L253: rts
+L254: prn *r1
+lea L315, *r5
+not r0
+L255: stop
+L256: dec L89
+L257: prn #53
+; comment
+L258: .data 987, 585, -86
+jmp L587
+sub r6, L496
+L259: .data 541, 393, -517, -57
+stop
+red r5
+clr *r3
+jmp L51
+L260: add #-99, L38
+inc r1
+jmp L544
+add L457, r1
+L261: clr r6
+L262: add *r2, *r2
+L263: dec r1
+jsr *r6
+jsr *r1
+L264: .string "nmjnqjklabwlfqsqxxmtuzj"
+L265: inc L13
+bne L122
+L266: rts
+clr *r6
+cmp r7, L68
+jmp *r5
+L267: .string "qlvsgfgtdlsvc"
+L268: stop
+L269: jsr L548
+lea L281, r0
+sub *r6, *r7
+L270: rts
+L271: .string "oezcwxskqgkpoxzrqfca"
+jmp *r1
+rts
+lea L510, r4
+L272: rts
+prn r4
+L273: .data -342, -950, 703, -957, -213
+
+L274: add L579, L369
+L275: clr *r0
+L276: dec r0
+L277: clr L256
+L278: not *r0
+mov L255, r4
+L279: dec r7
+L280: mov #-174, L549
+jmp *r4
+L281: lea L575, r1
+not r1
+lea L186, L340
+; comment
+jsr *r5
+L282: not *r2
+L283: not r0
+rts
+L284: prn L42
+not r0
+L285: rts
+bne L88
+L286: jsr *r0
+L287: bne *r5
+L288: stop
+L289: stop
+L290: red *r6
+L291: rts
+cmp L199, *r0
+L292: rts
+L293: rts
+L294: .string "lrzwgabh"
+L295: add *r6, L482
+L296: not L69
+jsr L123
+clr L17
+bne *r6
+L297: cmp r7, #-170
+L298: .data -206, 14, 780, -958, -821, -249, -265, -910
+L299: clr L170
+L300: bne *r7
+
+L301: lea L223, r2
+L302: sub L383, *r3
+clr r2
+L303: add r2, *r4
+stop
+L304: jsr *r0
+L305: jsr L285
+jmp *r1
+jsr L220
+L306: red r4
+L307: rts
+clr *r2
+L308: jsr L103
+L309: prn *r4
+L310: bne L319
+add L255, L155
+
+L311: lea L235, r2
+clr L18
+L312: rts
+mov *r0, L189
+jsr L470
+L313: jsr *r3
+prn r5
+not *r7
+L314: dec *r0
+clr r6
+lea L393, *r5
+L315: mov *r2, r0
+L316: clr L61
+L317: add *r1, *r6
+
+cmp #-140, L549
+L318: lea L5, r0
+mov *r7, r4
+L319: clr L575
+L320: dec *r3
+L321: bne L322
+lea L128, *r4
+L322: lea L0, L367
+L323: clr *r2
+mov #-1, r6
+L324: jsr *r7
+L325: dec L424
+L326: stop
+L327: red r0
+L328: add *r2, r6
+L329: red L429
+L330: jmp L367
+L331: jsr L450
+L332: bne *r4
+prn #251
+L333: add *r6, L63
+L334: rts
+L335: bne L393
+L336: not r7
+jsr L578
+stop
+lea L376, r1
+L337: mov L448, r4
+L338: jsr *r2
+inc r5
+; comment
+L339: bne *r0
+L340: add r3, r4
+L341: cmp r0, *r7
+
+clr L178
+L342: prn #-213
+L343: rts
+L344: rts
+L345: sub #-144, *r3
+L346: clr r3
+L347: clr *r4
+L348: rts
+L349: lea L269, *r5
+L350: bne *r0
+prn #-243
+L351: not L311
+L352: add *r0, r4
+L353: mov L168, L411
+L354: mov *r5, L350
+L355: jmp L539
+add #113, L353
+L356: dec *r7
+L357: red *r5
+dec L246
+L358: .data 773, -190, -147
+L359: stop
+jsr L89
+L360: rts
+L361: add L210, L444
+cmp #83, *r2
+clr L447
+jsr *r7
+L362: dec *r7
+L363: prn #176
+L364: dec L475
+L365: jmp L11
+L366: red L404
+add *r2, *r6
+L367: .data -620, 146, -282, -957, -558
+L368: dec L272
+stop
+L369: dec L18
+sub r2, r4
+jmp *r1
+
+L370: .data 995, 108, -120, 188, -649
+red L228
+L371: stop
+L372: .data -696, 934, -272, 82, -789
+L373: sub #-159, *r4
+L374: cmp *r5, *r7
+L375: add #-87, L105
+cmp *r4, *r3
+stop
+rts
+prn r5
+L376: jmp *r3
+L377: .string "prxslabmdxwy"
+L378: not L233
+L379: prn L315
+L380: rts
+L381: sub *r5, L468
+L382: sub #-256, L440
+jsr L121
+inc L324
+L383: dec r7
+dec r5
+; comment
+cmp #-243, #216
+sub #-132, L314
+L384: dec L201
+mov #29, r2
+jmp *r1
+L385: cmp #-14, #129
+L386: .string "mqwsktifjjwiiphgdv"
+L387: inc r4
+red *r3
+L388: bne L53
+red *r0
+L389: cmp *r7, *r7
+L390: stop
+mov #99, L322
+L391: not r1
+inc r7
+L392: .string "lmkmjkymvtmbnwdqwgpi"
+L393: .data 765, 659
+L394: .data 703, 657, -949
+L395: jsr L538
+not r7
+L396: .data 234, 657, -36, -439, 710
+L397: rts
+L398: .string "xoonprayiejubhbsejzlm"
+L399: prn *r6
+lea L528, *r3
+inc L559
+bne L487
+L400: clr L512
+L401: bne *r5
+L402: bne *r2
+L403: rts
+inc L502
+red L198
+prn *r0
+L404: stop
+jsr L563
+lea L538, L409
+L405: jsr *r7
+L406: prn r3
+L407: prn L567
+L408: .data -538, 789, -177
+L409: .data -318, -504
+clr r5
+L410: add #223, L114
+sub r4, L420
+L411: mov L396, L394
+
+L412: prn #-107
+L413: jmp L453
+jsr L470
+jmp *r5
+prn L403
+L414: stop
+L415: stop
+inc r3
+jsr L385
+stop
+dec r5
+L416: .string "vgwzdkjayegbg"
+jsr *r2
+inc *r4
+add r2, L505
+rts
+L417: bne L495
+L418: red *r6
+jsr L570
+L419: dec L500
+red *r7
+mov *r0, L304
+L420: dec *r4
+stop
+L421: cmp *r1, *r3
+L422: sub L537, r5
+jsr L464
+L423: jmp L558
+L424: cmp L435, L529
+L425: prn *r4
+L426: .string "rfpbwbfmzj"
+stop
+L427: sub #-191, L580
+L428: .data -32, 75, 14, 633, -271, 967
+L429: .data 260
+sub #-193, r7
+add *r1, *r3
+red *r5
+L430: red *r4
+L431: not L297
+stop
+dec *r4
+L432: bne L235
+jmp L588
+dec r5
+L433: cmp r2, #117
+bne *r1
+L434: mov #-141, r6
+inc *r2
+add *r0, *r2
+L435: jsr L392
+L436: cmp #231, L13
+L437: red *r6
+clr L527
+jsr L492
+L438: lea L526, L349
+dec *r0
+L439: .string "fijh"
+L440: inc L540
+L441: jsr L11
+L442: prn *r5
+L443: dec *r5
+dec L468
+; comment
+L444: add L561, L173
+L445: mov r1, L201
+L446: clr r2
+L447: red *r2
+mov #-243, *r0
+L448: rts
+L449: lea L458, *r2
+L450: add #233, r4
+L451: stop
+inc r7
+; comment
+L452: sub *r4, r7
+L453: .data -688, 348, -735, -260, -33, -216, 111, -455
+L454: jsr *r7
+L455: not *r3
+L456: jsr L555
+jsr L499
+L457: cmp #-91, #-138
+L458: cmp *r2, r0
+L459: jsr *r0
+inc L556
+
+prn r6
+jmp *r6
+L460: red L358
+L461: red r4
+L462: .data 906
+
+L463: .data 402, 449, -24, -259
+rts
+not r4
+L464: bne *r0
+L465: inc *r3
+L466: stop
+L467: red L483
+L468: jsr L586
+L469: add *r7, *r4
+mov *r1, *r7
+lea L547, r3
+L470: not L547
+clr *r2
+L471: cmp #145, *r4
+; comment
+L472: .string "bpzzgawutjl"
+add L584, L513
+jsr *r6
+prn L216
+L473: jmp L475
+L474: jsr L308
+L475: inc L205
+lea L542, L162
+bne *r7
+L476: not *r4
+prn *r1
+red r4
+L477: inc *r0
+L478: jmp L488
+red r2
+
+L479: bne *r4
+sub #153, *r4
+L480: .data 345, -99, -690
+L481: rts
+L482: lea L399, L348
+L483: add L492, L529
+jmp L292
+mov L334, *r6
+L484: jmp L529
+L485: jmp L489
+L486: clr L492
+L487: sub #90, r2
+L488: .data -807, -229, -532, -148
+jsr *r4
+L489: .data 434, 852, -348, -879, -665, 515, 562
+L490: .string "wzjaldwu"
+L491: not r5
+
+L492: clr r5
+L493: red L369
+L494: not *r1
+L495: jmp *r2
+L496: jsr *r2
+L497: mov r1, r0
+stop
+inc r2
+cmp *r0, L166
+red L503
+L498: .string "jm"
+L499: red *r5
+rts
+; comment
+L500: lea L530, *r1
+L501: .string "xwenc"
+L502: prn L391
+L503: sub *r6, r7
+L504: add *r1, r3
+L505: red r4
+rts
+jmp *r7
+L506: bne L383
+L507: inc r2
+
+L508: sub #60, *r4
+; comment
+L509: prn L509
+mov #-158, *r2
+L510: sub L186, L423
+not r1
+jmp *r0
+jsr *r7
+
+L511: lea L537, r1
+stop
+L512: jsr L562
+not L259
+not L280
+L513: .data -184, 41, 857, 174, 844, 823
+jsr L168
+L514: add *r6, r4
+not L396
+L515: bne L557
+L516: clr L141
+lea L421, L534
+L517: bne *r4
+stop
+; comment
+L518: dec *r5
+L519: add #-42, L133
+dec L527
+L520: mov r0, r6
+inc *r2
+L521: sub L557, L568
+jsr L447
+; comment
+L522: stop
+L523: mov *r6, L544
+L524: sub *r1, *r6
+L525: lea L383, *r6
+prn L571
+red *r3
+L526: not L585
+L527: .data 465, -717, 389, 549, 556, -594, 609
+L528: prn #-54
+L529: add #111, r2
+L530: .string "ljs"
+prn r5
+L531: mov *r1, *r0
+L532: lea L408, *r6
+L533: add *r0, L100
+cmp *r3, #-227
+
+bne L588
+L534: add *r1, *r6
+
+clr *r7
+cmp *r0, *r1
+L535: .data -985, -350, 494, -668, 495, 26, -312, 796
+jsr L478
+lea L571, r0
+rts
+rts
+prn r1
+red r7
+L536: .data -948, 585
+L537: .data -341, 339, -683, -873, -267
+L538: cmp r6, *r3
+L539: add *r4, *r0
+L540: clr *r7
+L541: .string "ebkcbzrnkbzpp"
+L542: .data 682
+L543: dec r1
+red L433
+L544: jmp *r0
+L545: rts
+L546: clr L564
+red r7
+L547: clr L583
+L548: .data 47
+add *r1, L564
+L549: jsr *r4
+L550: jsr L559
+L551: .data -56, 657, 682
+L552: red L318
+L553: .data 774, -490, -714, 254, 380, -203, 484
+prn L567
+L554: inc L583
+add r3, L139
+cmp r4, #231
+L555: jsr L587
+L556: .string "tdvrwqdwle"
+L557: clr L324
+jmp L580
+L558: inc *r3
+L559: not L190
+L560: add L584, r4
+L561: dec L42
+lea L588, L78
+L562: red *r5
+L563: cmp r3, #10
+L564: clr r4
+
+L565: .string "puotsbatnydbdbhpggnfaw"
+L566: red *r0
+L567: rts
+inc r6
+L568: bne *r1
+L569: clr L589
+L570: add r5, *r6
+L571: mov L547, *r6
+L572: stop
+L573: mov *r7, L578
+L574: prn r0
+L575: rts
+L576: .data 161, -414, 446, 386, -381
+red *r2
+L577: rts
+L578: not r4
+dec r1
+sub #38, *r3
+clr L508
+dec r7
+L579: add L583, L585
+L580: lea L150, r0
+L581: .data -526, 56, -579, 21
+lea L586, L585
+L582: cmp #137, L272
+L583: add *r3, *r4
+L584: jsr *r3
+L585: clr *r0
+L586: jmp L588
+L587: dec *r5
+L588: mov r6, r5
+; comment
+dec L32
+L589: mov *r2, r2
+L590: lea L393, r5
+stop
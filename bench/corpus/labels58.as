@@ -0,0 +1,1040 @@
+; Generated by genCorpus --seed 59
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+L0: lea L270, r6
+L1: dec *r3
+rts
+not *r6
+L2: jmp *r1
+not L579
+L3: jsr *r0
+L4: cmp #-23, r5
+L5: inc *r3
+stop
+clr L3
+L6: cmp r1, *r0
+lea L281, *r0
+jmp *r2
+prn *r2
+L7: jmp *r7
+bne *r7
+L8: not *r6
+clr L6
+L9: stop
+L10: bne *r7
+L11: not r3
+
+L12: jsr L9
+L13: rts
+L14: mov *r3, r2
+L15: rts
+L16: jsr L16
+L17: .data 74, -305, -455, 240
+L18: red r4
+inc L13
+L19: red *r7
+L20: mov *r3, r2
+cmp *r7, L9
+L21: stop
+lea L397, r1
+L22: sub r5, *r6
+L23: .string "bijrasjbnvherrepscjlmzu"
+clr r7
+L24: not r2
+L25: red *r2
+L26: red L21
+L27: rts
+L28: prn r3
+add *r5, L10
+L29: clr L107
+rts
+L30: jsr *r3
+red L512
+rts
+clr r3
+L31: rts
+L32: .string "szvul"
+L33: not *r2
+
+mov r1, L535
+jmp L10
+L34: inc L365
+L35: .string "lxkakmgokocjyszoa"
+jsr L217
+L36: .data -988, 150, 418, -262, -199, 472
+L37: stop
+L38: jsr *r4
+L39: red L575
+bne L39
+jsr L593
+L40: jsr L12
+L41: dec L376
+L42: dec *r4
+cmp *r4, L13
+lea L16, L27
+L43: mov L326, r6
+not *r4
+L44: inc r6
+L45: sub r5, *r0
+add #-157, *r4
+L46: rts
+add *r0, r2
+L47: not L3
+L48: .string "gkcwyoolo"
+L49: .string "kmyhtfdtjqyflbeib"
+L50: .string "zzhmxplzovdccit"
+L51: stop
+L52: add r4, r2
+L53: bne *r4
+L54: lea L445, *r3
+; comment
+L55: cmp *r7, r7
+L56: add L379, r0
+prn r0
+L57: .data 407, -823, 288
+L58: sub #143, r4
+inc *r6
+mov r1, *r1
+L59: sub #162, L64
+lea L531, *r5
+jsr *r4
+L60: .string "tndscwkurssfrthgzywvqvti"
+lea L30, L496
+L61: not *r5
+L62: stop
+L63: stop
+L64: jsr L53
+L65: jsr L62
+L66: clr r0
+bne L378
+dec r1
+L67: cmp #-155, *r4
+L68: red L37
+mov #28, *r0
+jmp L126
+jsr *r4
+L69: .data 639, 12, 106, 680
+L70: clr r0
+L71: .data -828, 94, -143
+not r5
+L72: .string "ucrqkvwdvvwhpdaeldq"
+jsr L182
+L73: lea L552, *r0
+stop
+L74: red r3
+lea L194, L20
+not *r6
+
+; comment
+L75: .data -201, -19, -427, -493, 86, 468
+rts
+L76: not L32
+L77: clr *r6
+L78: dec r2
+jsr *r5
+L79: dec *r1
+L80: not L117
+L81: .string "dk"
+L82: red *r5
+L83: mov r2, r0
+L84: clr L27
+L85: cmp *r0, L37
+L86: bne L227
+L87: clr r5
+L88: clr L40
+L89: not r6
+red L83
+rts
+L90: prn *r7
+L91: .string "wzghsquliypckqtrgiadre"
+L92: add #-142, *r7
+add L405, r4
+L93: bne L27
+L94: jmp L75
+L95: stop
+L96: bne L515
+L97: stop
+mov L66, r0
+L98: not r5
+add L71, L150
+red r2
+not r6
+L99: .string "qspljwzkxfokc"
+L100: rts
+L101: dec *r5
+L102: inc r4
+L103: rts
+L104: jsr *r2
+mov *r7, r7
+L105: clr L67
+L106: not *r4
+L107: .data -196
+L108: mov r1, *r4
+L109: jsr *r3
+prn L3
+L110: dec L542
+mov r1, L303
+dec *r2
+L111: jsr L38
+L112: .string "xxzlnajeaeavjx"
+L113: lea L49, r1
+L114: jmp L34
+L115: red r6
+L116: not L75
+L117: .string "wiiqsjeqzcwjoywcahdi"
+L118: inc r5
+clr r1
+L119: dec r0
+; comment
+L120: inc L72
+inc r0
+L121: .data 556, -877, -186, -625, 575, -979, -59, 10
+stop
+not *r7
+L122: sub #-82, r3
+L123: clr *r0
+L124: .data -924, 170, 361
+L125: dec r0
+add *r7, *r6
+L126: mov #53, r0
+L127: sub r5, *r7
+not *r1
+L128: clr L270
+
+L129: not *r2
+sub #-113, L38
+L130: .string "uinghvydhr"
+; comment
+bne *r4
+L131: red *r2
+L132: rts
+jsr *r2
+L133: not r2
+L134: .data 464, 708, -809
+L135: .data -732, 825, -355, 970, -227, 231
+jmp *r0
+L136: bne L506
+
+mov r5, r7
+not *r7
+L137: bne *r7
+mov r4, *r0
+jsr *r6
+prn *r3
+mov #233, L37
+L138: jmp L153
+not L564
+L139: stop
+L140: prn *r6
+L141: lea L304, r7
+L142: dec L13
+cmp #-1, L2
+L143: .data 556, -250, 440, -415, 144, 568
+L144: sub r2, r1
+; comment
+L145: add #-173, *r0
+L146: not r0
+L147: add L455, r2
+L148: lea L229, L20
+L149: jsr L110
+L150: jsr L157
+L151: jmp *r5
+L152: inc r6
+stop
+L153: .data 343, -826, 608, 396
+L154: .data -666, -298
+L155: red r6
+L156: .data -640, 178, -367
+L157: .string "fraftmwqzhjayrb"
+L158: .data -549, -11
+L159: red r1
+cmp r0, L0
+; comment
+L160: cmp L223, *r7
+L161: clr *r4
+L162: .data 416, 13, -11, 534, -182, 618, 236
+L163: cmp #-20, *r7
+L164: bne *r7
+L165: red L568
+L166: dec *r0
+L167: prn *r1
+L168: red L463
+L169: jsr L216
+rts
+L170: cmp #213, #-26
+prn r7
+L171: jmp *r1
+L172: .data -426, 806, 575, -520, 274
+mov r4, *r4
+mov L11, *r6
+L173: dec L301
+L174: clr L97
+L175: add r0, L91
+L176: not *r7
+stop
+L177: lea L162, *r0
+; comment
+inc L121
+L178: stop
+L179: bne *r3
+jmp *r0
+L180: rts
+L181: prn #51
+inc r0
+L182: sub r1, L18
+stop
+cmp L492, *r6
+L183: mov *r2, r3
+L184: jmp L228
+L185: .string "vmwfvsrzizbr"
+L186: sub L567, r4
+L187: lea L528, L94
+L188: inc *r3
+mov L125, r5
+L189: inc *r0
+L190: lea L108, r4
+L191: prn #-238
+bne *r7
+lea L416, *r4
+stop
+L192: not *r4
+L193: jsr *r3
+
+L194: stop
+L195: add *r2, *r5
+; comment
+L196: inc r0
+cmp r7, L48
+prn #-201
+L197: bne *r1
+L198: jsr L8
+L199: add #162, r1
+mov #202, L138
+bne *r1
+L200: rts
+not *r0
+L201: lea L506, *r5
+add #-9, r5
+; comment
+not L94
+not r2
+L202: stop
+L203: .string "daixfcpnttszhlydarjwhj"
+L204: bne *r6
+L205: bne L560
+L206: not r2
+L207: mov L522, L372
+L208: dec r5
+clr *r5
+L209: cmp r0, r5
+add *r0, r5
+jmp *r1
+red r7
+dec r7
+L210: lea L125, r2
+clr L506
+mov r3, r5
+L211: rts
+stop
+jsr L430
+L212: jsr L14
+
+bne *r1
+L213: not *r2
+L214: add r1, L233
+L215: jsr *r2
+L216: bne *r7
+cmp r3, #-236
+clr *r6
+L217: .string "rhvuczljowdopn"
+L218: jsr L568
+L219: jmp *r5
+L220: .string "ayrmzvoa"
+sub L221, *r4
+L221: add r5, r3
+L222: .data -835, -565, -926, 672, 155, 673, 654
+sub r4, L183
+L223: rts
+cmp #149, L385
+L224: .string "hccotxnljrwhsjttnvkbwbvs"
+not r6
+jmp *r6
+L225: clr *r2
+L226: bne *r4
+L227: .data -624, -287, 796, -899, 685, -638
+stop
+stop
+sub r0, L493
+L228: .data 539, 504, 778, -814, 411, -780, -691, -137
+not L174
+jsr L207
+prn #-223
+L229: .data 482, -482, -926
+
+lea L98, L140
+L230: lea L572, *r4
+red r5
+red r0
+L231: lea L591, L581
+; comment
+L232: dec *r4
+L233: red L128
+L234: not L9
+L235: .data -170, 814, -343, -80, -83
+L236: sub *r7, *r5
+L237: jsr *r7
+L238: prn *r3
+prn #200
+L239: red *r3
+add r4, L278
+L240: mov L107, r4
+L241: not *r2
+lea L47, L123
+lea L447, r0
+L242: jmp L172
+L243: red L343
+L244: .string "to"
+L245: .string "rnxexmjuoe"
+L246: red r5
+lea L286, r0
+L247: rts
+L248: stop
+L249: red r7
+L250: .string "wsdkdwmeqwrnjmwyvb"
+sub *r6, L213
+L251: jmp *r3
+L252: jsr *r0
+L253: inc r2
+bne *r5
+L254: rts
+red L244
+L255: .data 646, -773, 763, 299
+lea L249, *r0
+L256: dec *r0
+L257: cmp L128, L422
+clr *r5
+L258: inc *r6
+add r4, r4
+L259: .string "mpptjkkklbxatjirbw"
+inc L312
+L260: red r7
+L261: rts
+stop
+prn *r5
+; comment
+L262: clr r0
+clr L261
+L263: jmp *r1
+jmp *r2
+L264: .string "ahcqvx"
+L265: .data 611, 795
+L266: .data 407, -765, 384, -559, 922
+L267: jmp *r3
+L268: prn #-228
+L269: not L537
+L270: .data 292, 928, -911, 13, 63, -543
+bne L524
+dec L467
+L271: add *r2, *r6
+inc L604
+red L173
+inc *r5
+clr L577
+jmp *r5
+L272: mov #-233, L157
+L273: clr r6
+rts
+L274: bne *r4
+dec *r6
+prn #-36
+L275: lea L147, *r6
+L276: dec *r5
+L277: rts
+L278: clr *r4
+add #80, *r7
+L279: inc r6
+jsr *r7
+L280: dec *r7
+L281: bne *r4
+stop
+L282: dec L346
+L283: not r0
+rts
+L284: inc r7
+L285: inc r2
+L286: inc L101
+L287: jsr *r7
+cmp L144, L37
+rts
+L288: red r4
+L289: dec L389
+L290: red L536
+L291: clr r3
+dec L249
+cmp r4, L132
+L292: .string "pjrrmrilvpnclvvexhkpykgp"
+; comment
+L293: .string "obryszteqivnpget"
+add r7, L218
+L294: .data -347, -783, -367, 738, -415
+L295: .data 328, -408
+
+L296: jmp L291
+L297: rts
+L298: mov r3, L28
+L299: sub L466, *r1
+L300: jmp L402
+L301: dec *r7
+L302: bne *r7
+prn #-180
+add r0, *r4
+L303: rts
+; comment
+L304: bne L229
+stop
+L305: stop
+L306: prn #74
+mov #115, r7
+inc L322
+cmp #-2, *r5
+L307: .string "exwvnxqbapsqxynnnwzmku"
+L308: red r4
+sub L563, L430
+L309: mov *r4, L137
+L310: inc r0
+jmp L494
+; comment
+L311: add #17, r7
+L312: clr L185
+
+cmp *r3, *r6
+L313: .string "qebucxkdldmdffhxwscgsys"
+; comment
+red *r7
+L314: .string "auarcbjmduironr"
+L315: red L524
+sub r2, L55
+L316: .string "nssrqkstymykrralb"
+L317: jmp L10
+L318: .string "sisjzvwof"
+red r2
+L319: stop
+clr r6
+
+mov *r2, L42
+L320: stop
+stop
+L321: lea L515, r3
+inc r6
+L322: jmp L393
+L323: .string "nslqivro"
+L324: .string "zzxgvcsfti"
+L325: sub L555, r6
+L326: .string "nmiiqryshixccmngyvu"
+L327: .string "nxcyacwvwrjhubcjugdlsg"
+L328: lea L423, L404
+sub L284, r4
+L329: dec *r7
+red *r0
+bne L488
+L330: dec r2
+L331: rts
+L332: not r7
+stop
+L333: lea L73, L42
+L334: stop
+L335: jsr *r0
+stop
+L336: bne *r1
+sub r0, L257
+L337: red L550
+L338: inc L251
+add L492, r6
+L339: jmp *r7
+clr r6
+L340: .string "xuvdgjlelcjkkcansrwg"
+L341: cmp L81, *r3
+jmp *r7
+L342: prn r5
+L343: dec L67
+L344: add L321, L579
+stop
+L345: jmp L525
+jsr L477
+L346: prn #-110
+red *r7
+dec L600
+L347: jmp L593
+stop
+L348: red L366
+; comment
+L349: not *r4
+L350: jmp L476
+dec r7
+rts
+L351: .string "cnurzwpbnahwkoocu"
+lea L12, r2
+sub #-114, r6
+rts
+L352: stop
+L353: jmp *r7
+jmp *r7
+jmp L372
+stop
+L354: mov L246, *r1
+L355: red *r0
+L356: lea L447, L30
+L357: mov L110, L549
+lea L228, L171
+not *r6
+L358: add *r6, *r4
+L359: not r3
+jsr *r7
+L360: rts
+bne *r6
+L361: rts
+L362: prn L439
+clr *r1
+L363: dec *r0
+L364: mov #-112, r2
+cmp *r2, L380
+lea L147, *r6
+L365: red r2
+not L395
+lea L273, *r2
+L366: sub L8, *r1
+L367: clr L178
+L368: red *r1
+L369: inc L503
+L370: .string "bcuhrdbbrpcsxfuv"
+L371: red L306
+jmp *r3
+L372: clr *r4
+rts
+L373: inc L334
+clr r4
+jmp L593
+jsr L379
+L374: cmp *r5, *r1
+L375: red r1
+lea L502, L267
+L376: .string "jiohxr"
+rts
+L377: stop
+L378: dec L22
+L379: stop
+L380: mov r2, L218
+L381: .data 39, 757, 650, -768, -464, -336, -977, 273
+L382: clr r7
+prn L38
+; comment
+
+L383: .data -857, -905, -495, 448, 644, 233, 619
+jsr L160
+L384: lea L410, r4
+L385: .string "mgreiygnemc"
+dec r0
+red L256
+stop
+L386: dec r7
+prn #-160
+L387: lea L545, *r6
+L388: bne L247
+L389: mov *r2, *r7
+L390: jmp L222
+jsr L250
+bne *r3
+L391: stop
+L392: mov L526, r4
+L393: dec L19
+L394: dec *r6
+jsr *r4
+dec L372
+L395: clr r5
+lea L557, r1
+add r4, L202
+L396: bne *r7
+not *r7
+L397: lea L567, r1
+L398: not r3
+L399: lea L490, L538
+L400: inc r2
+L401: dec *r0
+bne *r3
+prn #211
+lea L335, L313
+stop
+L402: jsr *r3
+L403: not *r2
+L404: inc *r1
+
+L405: add #221, *r7
+L406: cmp r3, *r1
+L407: dec *r1
+stop
+sub L335, L503
+rts
+dec L379
+L408: mov *r5, r7
+add L282, L443
+sub r6, r6
+L409: stop
+L410: sub *r1, r6
+L411: stop
+; comment
+L412: add r0, *r5
+sub r1, L217
+
+red *r4
+L413: bne L189
+L414: add r5, L312
+jmp L420
+L415: .data 291, 413, -618, -955, -913, -905, 343
+L416: dec L540
+add *r0, L129
+L417: rts
+mov L428, L302
+cmp r1, L203
+L418: .string "hhdtgoqabhpdyh"
+inc L399
+L419: dec L402
+jmp L431
+L420: red L292
+
+not L473
+L421: red L573
+L422: prn *r1
+L423: sub L307, *r7
+L424: dec r5
+jmp *r2
+L425: mov #-220, L401
+L426: dec r3
+L427: rts
+L428: mov #12, L174
+prn r6
+L429: dec r2
+rts
+L430: bne *r2
+L431: .string "zshkkyuzicnbofqzua"
+L432: add #184, *r5
+L433: stop
+L434: bne L196
+L435: lea L484, L427
+L436: inc *r5
+lea L449, L510
+L437: stop
+clr L499
+L438: jsr L589
+jsr *r5
+L439: bne *r4
+cmp *r3, L536
+L440: clr L585
+red L455
+dec *r6
+inc r4
+L441: prn r5
+L442: prn #-21
+
+mov #-200, *r1
+L443: dec r6
+L444: rts
+L445: prn r0
+red L524
+L446: dec r5
+L447: jmp L506
+L448: bne L137
+L449: .string "tukhmkwobfhyt"
+L450: not r4
+lea L526, L481
+L451: jmp *r3
+L452: inc L592
+lea L489, r7
+mov #-47, L423
+stop
+L453: not L487
+bne L307
+L454: not r4
+L455: lea L589, *r0
+jsr *r7
+L456: dec *r4
+L457: jmp L490
+L458: lea L561, *r0
+prn *r1
+L459: bne *r2
+sub L213, r1
+L460: .data -26, -790, 639, -542, -330
+cmp L518, *r7
+inc L476
+; comment
+L461: cmp L437, *r3
+L462: sub L564, r3
+L463: cmp L360, r3
+inc *r4
+L464: cmp #208, L435
+L465: stop
+L466: red L387
+L467: dec *r7
+L468: cmp *r0, *r4
+L469: inc r5
+L470: jsr *r6
+L471: .data 353, -92, -970, 999, -618
+L472: lea L186, L493
+L473: rts
+
+sub L307, *r5
+bne *r7
+L474: not *r3
+L475: .string "grxkmq"
+add #69, r1
+mov #23, r3
+L476: sub r0, L202
+
+clr *r2
+
+L477: not *r4
+lea L58, r1
+L478: prn *r1
+L479: .string "x"
+L480: .string "xkuqlvvmwdposiahedtd"
+L481: dec L283
+L482: .string "sbytpdebygfasxcuverfw"
+L483: clr L579
+L484: dec L593
+
+
+stop
+L485: clr r5
+L486: sub *r6, r0
+L487: bne L514
+add r1, L33
+L488: inc *r7
+L489: jmp *r2
+L490: mov #167, *r2
+L491: rts
+
+L492: bne *r2
+add #169, L505
+L493: bne L569
+L494: add L198, r5
+mov #-209, r5
+add L169, *r6
+L495: jsr *r0
+prn *r4
+red *r0
+L496: dec L349
+clr L590
+L497: mov #-162, r5
+L498: jsr L29
+mov r7, r3
+L499: cmp r2, L540
+L500: .data 623, 412, -45, 823
+not *r0
+L501: dec r4
+red *r0
+dec L484
+inc L43
+jsr L584
+jsr *r5
+prn r5
+add *r4, L571
+clr r3
+red L322
+L502: lea L541, r7
+L503: sub #128, r0
+lea L581, r5
+bne L579
+sub *r0, *r1
+L504: clr L587
+cmp *r5, r0
+not *r7
+cmp L573, r5
+L505: cmp L366, #163
+jmp *r4
+bne L568
+L506: lea L595, r6
+; comment
+L507: inc L20
+L508: mov r5, r2
+L509: clr L472
+clr L524
+L510: cmp *r0, r6
+L511: not L413
+bne L587
+L512: .string "hqowpxvpf"
+L513: .string "hcutyhulikgnzpfgn"
+L514: dec r2
+L515: stop
+lea L560, r7
+L516: sub #48, *r1
+L517: sub r0, r6
+dec *r5
+L518: mov r5, r6
+L519: inc *r4
+L520: .data 713, 99
+L521: .string "xkxrhm"
+L522: inc r6
+inc L586
+L523: .data -717, 524, 351, -192, 600, 152, -180
+bne *r5
+L524: prn *r4
+L525: bne *r7
+L526: jmp *r2
+rts
+; comment
+prn L590
+stop
+L527: .string "yhacpzipaxaerhysz"
+jsr L28
+L528: stop
+inc r3
+sub #61, r4
+L529: .data -615, 801, 372
+L530: bne L606
+L531: .string "ihsbedqgrwabwnligctgafsf"
+jsr *r5
+L532: stop
+prn L569
+L533: jsr *r6
+L534: cmp #-71, #156
+L535: cmp r5, #-236
+L536: jmp L439
+stop
+L537: .string "cfilsaldakqgskbgzzphval"
+L538: lea L6, L550
+add *r0, L544
+L539: dec L599
+L540: inc L557
+L541: jsr L562
+jsr *r3
+; comment
+L542: jmp *r3
+clr r6
+jmp *r0
+jsr *r5
+L543: rts
+L544: .string "delgglbbopfn"
+jsr L79
+L545: .string "felftqifoqbcj"
+L546: lea L86, r7
+L547: .data -850, -450, -854, -543, -110, -24, 995, -893
+L548: sub #-189, *r3
+L549: add r6, r3
+L550: add *r0, r3
+L551: red *r6
+mov #55, r6
+L552: inc L583
+L553: bne L216
+sub *r3, L561
+L554: bne *r4
+L555: bne *r0
+clr *r1
+L556: add L557, *r0
+L557: prn *r6
+rts
+L558: cmp L593, #-79
+L559: inc r2
+L560: clr L243
+clr *r5
+L561: mov #-53, r4
+dec r1
+L562: jmp *r4
+L563: prn r0
+L564: dec *r5
+L565: stop
+L566: .string "mvaviizpth"
+L567: rts
+L568: mov *r6, r5
+mov r4, r5
+not r6
+L569: lea L589, L584
+L570: red L410
+L571: .data -298, 325
+L572: add #-48, *r4
+L573: lea L602, *r0
+sub r2, r1
+L574: .data 14, -127, 77, 614, -269, -348, 227
+L575: lea L420, *r1
+L576: prn #236
+stop
+jsr *r4
+L577: stop
+L578: .data -502, -843, -859, -312
+L579: mov #175, *r7
+L580: jsr L598
+L581: rts
+L582: jsr L592
+L583: cmp r1, *r1
+L584: inc *r2
+L585: red L603
+rts
+L586: rts
+L587: jmp L298
+jsr *r2
+L588: mov L322, L592
+L589: jmp L596
+jmp L602
+inc L293
+L590: .string "etuiwtnbq"
+L591: .string "ep"
+mov *r3, L593
+L592: mov r3, r7
+L593: stop
+cmp r6, #-74
+L594: lea L601, r2
+L595: rts
+L596: dec r0
+L597: clr r6
+L598: rts
+L599: red r5
+lea L604, L601
+prn #55
+L600: cmp r4, *r7
+L601: sub L6, r4
+L602: lea L605, *r3
+mov *r7, r3
+L603: .data 223
+sub *r2, L160
+L604: .string "mowr"
+L605: jsr L606
+
+L606: sub #194, L538
+jsr L50
+dec *r4
+mov *r4, L159
+stop
@@ -0,0 +1,1041 @@
+; Generated by genCorpus --seed 60
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+L0: lea L0, L0
+add #129, L101
+L1: sub r3, *r2
+L2: clr L2
+L3: add L135, r2
+L4: cmp #-10, *r5
+lea L4, L456
+cmp *r3, L0
+; comment
+L5: bne L2
+L6: jsr L100
+
+L7: stop
+mov L152, r2
+jsr *r4
+L8: .data -978
+sub #-11, L5
+prn r5
+L9: sub #-81, L145
+L10: .string "obqpnqybfrfvdcvj"
+rts
+L11: dec L8
+L12: sub #-223, L463
+L13: cmp #-43, *r4
+L14: red L9
+prn *r4
+L15: lea L6, *r2
+L16: not L6
+L17: .string "pxiibsblgx"
+L18: .string "mqqknudo"
+lea L0, r6
+L19: clr r3
+clr L378
+lea L125, *r4
+L20: not *r6
+; comment
+L21: .data 799, 160
+jsr L233
+L22: mov #-83, r1
+L23: bne L68
+; comment
+jsr L16
+not *r5
+jsr *r2
+inc r4
+L24: cmp #120, L58
+L25: lea L16, r3
+L26: .string "hlkxk"
+L27: dec r2
+
+L28: .string "hgkrmdxqsrakkbkvub"
+prn #143
+L29: .string "bge"
+inc L27
+L30: .string "gsptckathbqatjypys"
+L31: inc L406
+L32: bne *r1
+dec *r3
+L33: jmp *r5
+; comment
+L34: dec *r6
+L35: .string "wgekwtftmefnskjuaznz"
+L36: dec L550
+L37: red r3
+L38: rts
+L39: jmp *r6
+L40: dec r2
+prn *r3
+L41: jsr L16
+L42: not *r2
+mov L9, r0
+jsr L429
+rts
+L43: .string "tqkfxdzadu"
+L44: not L18
+L45: rts
+cmp *r1, #-167
+L46: inc L8
+L47: inc L524
+not *r3
+L48: not *r1
+L49: rts
+L50: clr *r4
+; comment
+L51: jsr *r1
+L52: jmp *r1
+lea L347, *r2
+L53: mov r6, r4
+prn L37
+L54: red L31
+L55: bne L27
+L56: not *r1
+L57: .string "dguzbtejfkhsepbhjtopzk"
+L58: jsr *r0
+dec L30
+add *r3, *r5
+L59: cmp r0, r6
+L60: prn L5
+stop
+L61: .string "kifffusxdodb"
+L62: not *r6
+L63: mov r5, L5
+L64: cmp L52, L345
+cmp *r7, r0
+L65: stop
+cmp #219, L244
+stop
+lea L530, *r0
+L66: .string "ticeyyukdfpvqigluibybhfu"
+; comment
+L67: sub r3, *r7
+bne L452
+cmp *r4, #-69
+rts
+lea L63, L403
+L68: sub L85, L72
+L69: add #-37, *r3
+L70: rts
+L71: mov #54, L224
+L72: lea L413, r6
+dec r6
+L73: .string "jnkxahe"
+L74: cmp r1, #24
+add L33, r3
+L75: mov *r6, *r5
+L76: lea L19, *r7
+add r5, L73
+add *r4, L34
+L77: cmp r6, #-185
+L78: red *r7
+L79: dec L185
+jsr L53
+L80: inc *r2
+
+clr *r6
+L81: jsr L569
+clr *r6
+lea L49, L33
+L82: clr L20
+L83: red *r2
+L84: jsr L56
+L85: inc r3
+L86: clr r5
+clr *r4
+L87: .data 708, 488, -61, 930
+L88: not r7
+not r3
+L89: add r5, r7
+L90: .string "dgzcgxqbuasvjtqkoqlf"
+L91: lea L57, r4
+L92: jsr *r0
+
+; comment
+L93: inc *r5
+L94: add L30, r4
+L95: sub *r3, L376
+L96: cmp r6, #-194
+L97: mov #-30, *r2
+L98: clr r3
+prn #-96
+L99: add *r3, *r1
+L100: red L12
+L101: stop
+L102: mov L23, *r3
+red *r0
+L103: stop
+L104: add r3, *r6
+rts
+add L350, L309
+L105: .data -144, -799, -360
+L106: clr *r3
+L107: prn *r1
+dec r3
+L108: not *r3
+L109: stop
+rts
+L110: stop
+L111: cmp *r2, *r3
+L112: red r4
+stop
+L113: rts
+L114: prn #114
+L115: dec L13
+L116: .string "ipx"
+L117: mov *r6, r2
+L118: inc r1
+L119: .string "wfdzvjm"
+prn L75
+L120: red L44
+inc *r1
+L121: stop
+not *r0
+L122: bne *r0
+; comment
+inc *r7
+L123: bne L315
+L124: .string "bjpwlzkpeaycuduudqdoypy"
+L125: sub *r6, r2
+rts
+L126: .data 614, -941, 443, -940, -649, 289, -374
+L127: dec r5
+L128: .string "jg"
+L129: clr r1
+L130: prn #233
+
+L131: .string "stoeihaa"
+L132: clr *r1
+bne *r6
+L133: cmp r0, r7
+inc r3
+
+L134: bne *r2
+L135: prn L593
+L136: stop
+L137: inc r1
+L138: stop
+L139: prn *r1
+inc *r1
+L140: clr *r5
+L141: inc *r0
+L142: mov *r5, *r0
+; comment
+L143: prn #-210
+L144: .string "pzdkeskkdyjwpojiwrnihcs"
+L145: .data 555, 937
+L146: mov #222, *r3
+L147: inc L597
+jmp L69
+add L45, L560
+L148: jsr *r3
+L149: jmp L113
+add r6, L405
+L150: bne *r1
+L151: sub L29, *r5
+L152: .data 941, -263, 576, 528, 270, 247, -958
+jsr L498
+L153: lea L88, r5
+L154: rts
+L155: not L213
+L156: bne L156
+L157: red *r5
+jmp L116
+L158: jsr L267
+L159: stop
+mov r0, *r5
+L160: bne L347
+not L40
+L161: sub #-115, L483
+L162: .data -125
+not L271
+L163: prn #-182
+stop
+L164: add #249, L65
+add L68, r2
+L165: inc L274
+red *r2
+L166: jsr *r5
+inc *r5
+L167: not *r4
+sub *r6, r2
+L168: red r6
+red r3
+lea L78, r3
+L169: bne L144
+
+lea L18, L118
+
+L170: sub #158, *r3
+add L84, L160
+L171: rts
+L172: red *r5
+L173: rts
+L174: red r4
+jsr *r5
+L175: rts
+red r4
+L176: lea L131, *r3
+L177: sub #113, L83
+L178: red L199
+; comment
+not *r2
+L179: add r5, *r3
+L180: jmp *r3
+
+L181: .data 171
+L182: mov *r2, *r5
+L183: sub #182, *r5
+L184: prn r1
+L185: add L138, r7
+rts
+jmp *r5
+jmp L168
+L186: clr L90
+L187: .string "idshyntewmadixfmubsshoj"
+L188: red L234
+jsr *r5
+L189: jmp *r4
+red *r6
+L190: stop
+jmp *r7
+L191: inc r3
+jmp L120
+add #-242, L37
+not r0
+L192: dec r0
+sub r4, r4
+L193: .string "rxvfsqifquqar"
+L194: .string "peivjazyn"
+stop
+jsr L28
+L195: bne *r3
+L196: stop
+rts
+L197: mov #-193, *r0
+L198: clr L488
+lea L106, *r0
+L199: rts
+L200: cmp *r6, #139
+rts
+L201: not L39
+L202: inc L110
+L203: .data 759, 307, -655, 254, -551, 957, 970
+stop
+prn #71
+L204: rts
+prn *r1
+L205: bne L480
+L206: .string "tjbxbbyw"
+L207: stop
+L208: sub *r5, L112
+L209: jsr *r2
+add L292, *r2
+L210: clr *r4
+L211: clr *r6
+L212: not r7
+L213: stop
+L214: .data 910
+L215: cmp #-176, L311
+L216: bne L591
+L217: lea L271, L88
+L218: dec *r5
+
+L219: sub r7, *r4
+jsr L601
+add L561, *r0
+not *r4
+
+bne L180
+L220: add L4, r4
+L221: rts
+stop
+L222: prn L445
+L223: inc L455
+L224: add r6, *r6
+L225: cmp r6, *r4
+clr L116
+bne L113
+L226: jmp L359
+prn *r0
+L227: rts
+L228: clr L524
+red r6
+not *r0
+; comment
+; comment
+L229: sub *r0, L264
+L230: clr *r7
+L231: dec *r1
+L232: mov #94, *r0
+L233: not L119
+L234: .data 872, -323, -430, 903, -191
+jsr L485
+L235: add #-65, L45
+L236: sub #70, *r1
+L237: add r0, L273
+sub L455, *r7
+L238: jsr *r2
+
+rts
+L239: add L542, r5
+cmp L552, *r4
+L240: prn r1
+lea L157, *r0
+L241: rts
+add *r5, L106
+add #-70, L195
+L242: lea L353, L161
+lea L0, *r4
+prn L236
+L243: red L501
+inc *r1
+prn *r7
+jmp *r4
+L244: dec L80
+L245: red r1
+L246: sub r1, r3
+lea L163, *r3
+L247: dec r0
+L248: mov r1, r1
+L249: lea L268, *r2
+dec *r3
+add L238, r6
+L250: bne L9
+L251: lea L209, r3
+L252: mov *r3, *r2
+L253: prn r4
+L254: bne *r4
+L255: rts
+sub L38, r1
+L256: jmp *r2
+L257: .string "eiihxojns"
+L258: .data 105, -511, -163, 611, 124
+L259: stop
+L260: .string "ogerabhic"
+dec r6
+L261: bne *r3
+L262: dec L440
+dec r7
+L263: lea L108, r7
+L264: not L254
+L265: .string "j"
+jsr *r7
+dec r4
+L266: stop
+rts
+prn *r1
+L267: jsr L10
+L268: not r6
+L269: .string "yxidlgxah"
+L270: dec *r0
+add #-132, L421
+clr r7
+L271: red r7
+L272: .string "aogzfpctjnjv"
+L273: bne L149
+L274: jmp *r4
+L275: red *r4
+L276: .data 636, 284, 871
+L277: cmp *r3, L559
+L278: sub r5, r1
+L279: .string "dmcuriwertvkgl"
+L280: .string "gwgggworzzvry"
+L281: stop
+prn L205
+L282: not r6
+not *r1
+lea L385, *r4
+sub *r4, r0
+L283: prn r6
+L284: mov *r1, r2
+rts
+L285: .string "zespibykb"
+L286: jsr *r0
+clr r5
+L287: .string "oqblhjqhwfhhlcxobtbfvkk"
+L288: red r7
+L289: sub L132, r3
+L290: prn *r5
+red *r0
+L291: lea L613, L367
+L292: lea L549, *r3
+L293: inc *r3
+L294: bne *r0
+L295: red *r6
+L296: prn *r6
+red *r2
+cmp L517, *r4
+L297: .string "lolhvfrffuushlbzj"
+stop
+jsr *r1
+bne L500
+L298: red r6
+L299: cmp *r1, r0
+lea L89, r5
+L300: .string "sdeqqbo"
+prn *r4
+jmp *r3
+L301: clr r4
+L302: jsr L206
+cmp r3, r3
+L303: red *r2
+not *r3
+L304: not r0
+L305: sub L379, L365
+inc r1
+clr r1
+L306: sub r0, L17
+; comment
+L307: sub *r5, L270
+L308: stop
+red r2
+rts
+sub r4, L603
+L309: red *r6
+L310: rts
+not L227
+L311: .data 373, 932, -978, 454, 661
+rts
+dec r2
+
+L312: cmp *r1, *r1
+L313: .data 689, -556, 964, 662, 440, -219, 286
+prn L182
+L314: inc *r5
+rts
+jsr *r4
+prn #-192
+L315: rts
+L316: rts
+L317: rts
+stop
+L318: add *r5, r4
+L319: .string "nsfgmlb"
+red r5
+L320: .string "sxdqve"
+L321: bne L169
+L322: .data -306, 492, 592
+L323: .string "cvntznki"
+L324: .data 772, -892, 286, 79, -23, 998
+bne L217
+L325: inc r3
+stop
+L326: jmp *r7
+L327: inc r3
+L328: .data -583, -17, 982, -108, -850, -306, -909, -69
+L329: dec *r3
+L330: add *r0, *r1
+L331: not r5
+L332: mov #242, L441
+L333: jmp *r0
+L334: lea L7, L211
+add #-26, *r6
+L335: stop
+L336: rts
+dec L151
+rts
+L337: .data 9, -1000, 974
+rts
+inc r7
+red L243
+L338: cmp #80, #-99
+L339: red L184
+L340: jsr L519
+L341: dec r2
+L342: stop
+bne *r3
+bne *r3
+red r6
+red L605
+clr *r5
+L343: add *r2, L112
+L344: .data 742, 297, -99, -384, -457, -639, 717, 94
+L345: .data 886, -615, -733, -59, -590, -717
+L346: not L223
+
+L347: .data 826, 444, 529, 923, 921, 275, -746, 82
+stop
+L348: .data 89, 886, 868, -565, 575, 629, -10, 408
+add #-245, *r6
+L349: prn *r2
+L350: .data -383, 228
+L351: jmp *r3
+L352: bne *r6
+mov *r4, *r7
+L353: stop
+clr r1
+cmp *r3, L129
+not *r7
+L354: clr L467
+L355: stop
+cmp #-242, *r1
+inc r2
+L356: add *r1, L434
+L357: lea L275, r5
+L358: prn #-158
+L359: rts
+L360: inc *r7
+L361: jmp L346
+L362: prn r2
+L363: sub L529, *r7
+sub #-68, r7
+cmp #-223, #-41
+L364: lea L280, r1
+red L162
+L365: prn *r5
+L366: clr *r7
+clr r6
+rts
+L367: rts
+not r6
+L368: clr *r2
+L369: mov #120, r4
+
+L370: clr L393
+L371: inc r6
+sub r5, *r4
+L372: lea L176, *r4
+stop
+not r6
+L373: .data -138, 252, -469, -993, -518, 515, -267, -400
+
+L374: lea L514, r7
+L375: .data -807, 812
+jsr *r2
+jmp *r5
+L376: red *r4
+L377: add *r2, *r5
+add r7, r3
+jmp L287
+dec *r7
+L378: jmp L393
+L379: bne *r7
+L380: inc *r4
+
+dec r1
+L381: .string "bqvpaixonabrk"
+L382: clr r4
+jmp L411
+mov *r3, r4
+dec L277
+
+L383: clr *r1
+L384: cmp #7, *r7
+red L489
+not *r6
+L385: rts
+not r4
+L386: add #23, r6
+L387: sub r7, r0
+inc *r5
+L388: .data 852, -259, 275, 541, 804, -969, -113, 441
+jmp L16
+L389: clr *r2
+not *r0
+jsr L429
+cmp L302, L367
+L390: .data 273, -307, 621, -236
+L391: jmp L425
+lea L529, L277
+L392: .data -887
+L393: red *r6
+L394: cmp r3, *r5
+L395: jmp *r5
+L396: .string "xqsim"
+rts
+lea L101, r6
+L397: inc r5
+jmp L398
+L398: stop
+rts
+not r5
+L399: .string "hibgkjnax"
+L400: .data 322
+L401: not L614
+L402: .string "vwdyztjcqjxaft"
+cmp #-177, L357
+L403: jsr *r5
+L404: stop
+L405: lea L428, r7
+L406: dec L59
+jsr *r2
+L407: .string "mxxjky"
+L408: sub L507, L431
+L409: .string "nzhyfeypclov"
+L410: stop
+L411: stop
+L412: stop
+cmp L423, #-202
+jsr L194
+; comment
+inc L529
+L413: .string "admammtpxyvciuulzzgzmm"
+; comment
+L414: .data -353
+L415: inc r6
+L416: dec r7
+L417: .string "g"
+red *r7
+L418: not *r0
+L419: bne *r0
+L420: add *r6, r4
+dec r2
+L421: .data 868, 262
+L422: jsr *r5
+sub r7, *r2
+L423: lea L600, *r7
+L424: jmp L485
+L425: clr r5
+L426: not *r1
+stop
+L427: rts
+L428: jsr L44
+L429: add *r6, *r0
+L430: jsr L466
+prn *r7
+L431: .string "gmdiwyrlmjanfardryapigoo"
+L432: jsr L181
+stop
+jmp *r4
+jmp L470
+rts
+L433: lea L168, L61
+L434: sub r3, *r5
+L435: jmp L581
+L436: inc r5
+jmp L486
+sub #168, r5
+L437: mov r5, *r3
+not *r1
+L438: lea L306, r4
+L439: .data 840, -640, -125
+L440: stop
+L441: inc *r7
+bne L285
+L442: dec r6
+L443: .string "amxzfciyzvrnbtkgwrjeiewj"
+; comment
+rts
+L444: red L25
+L445: clr *r3
+rts
+clr *r2
+L446: mov L333, *r2
+red r4
+L447: dec r0
+L448: prn #-116
+L449: stop
+add *r5, L578
+L450: .data -604, 663, 396, 843, -401, -978, 337
+bne L68
+L451: clr L281
+dec L576
+L452: lea L509, L78
+L453: sub *r1, *r1
+L454: stop
+L455: red *r6
+red r1
+L456: .data -649, 126, 888, -883
+bne *r0
+L457: .data -922, 468
+L458: clr r2
+L459: jsr *r7
+L460: cmp #245, L551
+jmp *r1
+cmp L563, L540
+L461: sub *r1, r3
+L462: clr r6
+L463: jsr *r2
+L464: jsr L349
+L465: jmp L567
+
+jmp L232
+sub *r0, L30
+red *r1
+rts
+L466: stop
+L467: .data 606, -379, 220, 434
+L468: sub L305, L334
+L469: red L605
+not L616
+inc *r4
+L470: jmp *r7
+lea L189, *r4
+L471: mov L312, r2
+L472: not r6
+inc L513
+stop
+L473: prn r2
+L474: bne *r3
+L475: .string "ltufisrbuz"
+L476: sub #201, r2
+L477: inc L510
+L478: prn L582
+clr L571
+L479: bne *r3
+rts
+jsr *r3
+lea L491, *r1
+L480: inc L545
+L481: bne L571
+mov r6, r4
+red r4
+L482: clr L484
+L483: jmp *r2
+L484: clr *r7
+L485: mov *r4, r7
+lea L595, *r1
+L486: .data -82
+L487: .string "mzligiqhjkstxqpess"
+L488: cmp *r1, #4
+bne *r1
+L489: stop
+L490: .string "amfzwmatgzlpsq"
+L491: jsr *r1
+L492: stop
+L493: stop
+L494: red r6
+not L258
+L495: .data 740, -512, -904, -901, -261
+L496: sub r4, L535
+L497: cmp *r7, #-210
+jmp *r5
+L498: .data 448, 886, 690, 319, -296
+red r5
+L499: not *r7
+L500: red r3
+mov #198, L554
+L501: .data 862, 910, -261
+dec L574
+L502: inc r5
+L503: jmp L476
+L504: .data 957, 333, -712, -308, -491, 525, 633, 505
+L505: lea L523, L546
+L506: prn *r7
+L507: dec L589
+L508: add L515, r1
+L509: rts
+rts
+L510: clr L596
+L511: dec L602
+L512: mov *r7, *r5
+L513: jsr *r6
+mov *r2, L21
+L514: dec *r5
+L515: jsr L70
+jsr *r6
+dec *r6
+L516: mov #4, *r5
+L517: mov *r1, r7
+L518: prn *r0
+L519: mov L590, *r2
+L520: add *r6, L190
+L521: not *r6
+L522: lea L609, r5
+L523: dec L601
+L524: rts
+L525: mov *r7, L324
+; comment
+prn L502
+L526: .string "udeeiwrdzowutevlnr"
+L527: bne L600
+stop
+clr *r4
+L528: bne L455
+
+add #159, *r2
+L529: jmp L293
+rts
+dec L108
+L530: inc *r0
+L531: bne L604
+jsr *r1
+not *r4
+L532: sub #-84, *r0
+L533: bne L473
+L534: sub #-45, L272
+L535: not r3
+L536: not *r6
+L537: sub *r4, r2
+L538: inc r2
+L539: bne L323
+sub #-140, *r5
+L540: jsr *r5
+inc *r5
+L541: bne L570
+L542: mov L557, L356
+L543: add L551, *r7
+L544: bne L589
+jmp *r2
+L545: .string "uupbrxvdihgghqjxngjbxblo"
+L546: jmp L564
+prn L584
+dec *r4
+add *r5, r7
+L547: jmp *r2
+L548: not r0
+L549: not r4
+L550: clr *r0
+L551: inc L572
+add *r2, L562
+L552: add #-31, L399
+L553: jsr *r1
+L554: stop
+L555: not r1
+L556: clr L13
+L557: .string "aqfapjhahhl"
+sub *r2, *r2
+mov #-237, *r0
+L558: rts
+L559: rts
+inc L388
+bne *r2
+cmp L396, #-256
+L560: bne *r6
+red r6
+L561: not *r2
+L562: rts
+not r4
+not L323
+rts
+bne *r1
+jsr L594
+L563: .data 541, 431, 593
+L564: jsr *r2
+L565: not r7
+
+prn r4
+L566: sub #103, *r5
+prn *r4
+L567: .string "arcvmcdbbnijgo"
+bne *r7
+inc L443
+jsr L168
+L568: .string "silnebjua"
+L569: prn #108
+L570: .data 157, -11
+L571: lea L362, L514
+dec *r5
+rts
+L572: lea L593, L382
+dec L583
+L573: lea L470, r7
+; comment
+dec L478
+L574: inc r4
+L575: cmp #-44, r6
+jsr *r4
+L576: not *r2
+L577: stop
+L578: lea L593, r6
+L579: not *r1
+L580: jsr L334
+dec r0
+not r7
+L581: clr *r4
+L582: .string "abvhwihlqwnkuplss"
+jsr *r0
+L583: not *r3
+L584: lea L613, r4
+L585: clr *r6
+inc *r4
+bne *r6
+L586: jmp *r4
+L587: prn L594
+L588: rts
+sub L283, r0
+L589: cmp #234, L615
+dec r0
+L590: stop
+dec L317
+L591: cmp r2, r0
+L592: stop
+clr r0
+cmp #-122, #-125
+L593: jsr L357
+red r0
+jsr *r7
+rts
+sub r3, r5
+L594: jmp *r7
+bne L611
+L595: lea L597, L611
+not *r0
+inc *r0
+bne *r4
+bne *r4
+rts
+rts
+lea L81, L14
+L596: stop
+L597: mov L207, L553
+L598: prn *r7
+L599: lea L614, r2
+L600: dec L602
+L601: .data -790, -67, 727
+not *r1
+L602: inc r3
+jmp L407
+bne *r4
+L603: mov L78, L255
+L604: jmp L200
+stop
+jmp L610
+L605: cmp L607, *r0
+L606: rts
+red r4
+L607: not *r1
+L608: prn L368
+jmp *r1
+L609: stop
+L610: mov *r5, *r3
+L611: jsr *r6
+L612: dec L613
+mov #-224, r6
+red L24
+L613: add #19, L616
+L614: lea L616, r3
+mov #249, *r0
+L615: rts
+L616: .data 646, -778, -881
+stop
@@ -0,0 +1,1041 @@
+; Generated by genCorpus --seed 7
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+L0: jmp *r6
+L1: add *r3, *r5
+L2: jsr L404
+L3: cmp #-66, r1
+L4: jsr L596
+L5: cmp #126, r2
+sub r1, *r0
+L6: prn #232
+L7: jsr *r2
+L8: dec *r5
+L9: red r0
+; comment
+prn *r4
+L10: jsr *r3
+L11: red r2
+inc *r6
+L12: red *r0
+dec r3
+L13: red L8
+jmp *r6
+jsr L336
+L14: dec *r2
+not L480
+L15: not L3
+L16: .data -513
+L17: not *r6
+L18: not L2
+L19: prn *r1
+L20: .data 298, -364, -9
+L21: jsr *r5
+sub *r6, L19
+L22: sub *r7, r0
+L23: inc L6
+L24: .data -955, 410, 759, -233
+L25: sub L18, *r1
+stop
+L26: mov L211, r4
+rts
+L27: clr L21
+L28: red *r2
+L29: .data 49, -339, -805, 836
+inc r0
+L30: .data -731
+L31: add *r4, *r5
+L32: cmp *r0, *r7
+sub #102, *r1
+L33: add *r1, L131
+L34: .string "yhbkrosjsdv"
+L35: mov #-93, r0
+inc r3
+stop
+cmp r0, #-147
+L36: red r6
+cmp *r2, *r4
+bne *r1
+dec r2
+jmp *r2
+bne *r2
+L37: dec *r0
+L38: inc r1
+cmp *r0, L6
+L39: bne L253
+L40: lea L20, L8
+L41: sub r4, r6
+stop
+L42: .string "weze"
+sub r4, r1
+prn *r4
+L43: rts
+L44: .string "vccdqa"
+L45: not *r7
+L46: cmp r7, *r4
+L47: .string "fzsjvdgbptem"
+L48: red r0
+L49: lea L4, L14
+L50: bne *r6
+L51: prn L5
+L52: jsr L13
+not L609
+dec r2
+dec *r1
+; comment
+inc *r0
+L53: prn L52
+L54: prn #206
+L55: add L137, r5
+L56: .data -224, -425, -926, 628, 163, 264, -985
+L57: stop
+sub #147, *r5
+mov r3, L34
+L58: .data -957, 200
+inc r6
+
+L59: .string "eznbzcxzbksahbgsm"
+; comment
+L60: jsr L8
+L61: mov L269, *r2
+L62: inc r3
+L63: not L168
+add *r2, *r2
+L64: mov *r6, L3
+
+L65: prn L42
+L66: jmp *r5
+cmp #106, #141
+
+L67: stop
+
+L68: mov #78, r3
+stop
+bne L102
+L69: cmp *r7, *r0
+L70: mov L67, L1
+L71: clr L327
+bne *r4
+jsr *r5
+not L492
+red *r6
+not L27
+L72: .data -526, 110, -962, -555, 371
+L73: cmp *r4, *r4
+prn L50
+L74: cmp r7, L14
+jmp L275
+L75: clr L43
+L76: .data 227, 900, 311
+rts
+L77: rts
+L78: prn r1
+mov *r5, *r5
+L79: lea L17, r5
+bne *r4
+L80: sub *r4, *r2
+bne L10
+L81: cmp r1, *r7
+L82: add r3, *r1
+
+prn *r7
+L83: inc *r2
+L84: .string "sbqsa"
+L85: .string "kw"
+dec L108
+L86: lea L46, L37
+L87: inc *r6
+L88: inc L97
+L89: cmp #-170, *r7
+L90: red L580
+rts
+jmp *r4
+L91: jmp *r3
+L92: inc r3
+jsr *r1
+L93: not *r1
+; comment
+L94: inc r4
+L95: .data -168, 254, 238, 991, -129, -113
+L96: clr r1
+L97: jsr L313
+L98: lea L579, L27
+sub L357, r6
+; comment
+L99: bne L93
+; comment
+L100: add #88, L115
+L101: dec *r1
+rts
+L102: bne *r7
+L103: .string "fpbdvuvyfutnibutegbt"
+L104: .data -575, 348, 688, -301
+mov L11, L15
+L105: clr *r0
+bne L241
+L106: prn r7
+L107: .data -176, -282, 987, 176
+rts
+red r3
+L108: lea L53, r6
+L109: dec r7
+inc *r2
+L110: jsr L59
+cmp #-81, r6
+L111: not L110
+L112: clr L66
+rts
+; comment
+L113: jmp L36
+L114: mov r6, L385
+L115: lea L14, L397
+L116: lea L396, r0
+L117: lea L42, L37
+add L336, r6
+red *r2
+L118: mov #-210, r1
+jmp *r6
+L119: lea L102, L462
+bne L47
+L120: jmp *r2
+clr *r4
+sub *r2, L40
+not *r3
+L121: rts
+L122: add L379, L106
+; comment
+L123: not r5
+L124: bne L250
+L125: bne *r2
+red r7
+L126: inc r5
+L127: rts
+sub #170, L127
+jsr *r6
+L128: dec r4
+L129: .data -584, 969, -272, 143, 132
+L130: stop
+L131: inc L123
+clr r7
+lea L564, L214
+L132: jsr *r5
+L133: lea L128, *r6
+L134: clr L119
+L135: clr *r3
+L136: jmp *r2
+L137: stop
+L138: jsr L355
+L139: .data -974, 320, -547, 342, -283, -409, -33
+L140: prn #-128
+L141: clr *r1
+; comment
+L142: dec r5
+dec L47
+L143: not *r1
+L144: lea L136, L269
+L145: cmp L51, #-178
+jsr L527
+L146: prn r4
+L147: .data 100, 788, 730, -35, -213, 581, 786, 96
+jsr L452
+L148: stop
+L149: lea L109, r4
+L150: red r5
+L151: inc r5
+L152: lea L15, *r2
+mov *r4, r7
+L153: .data -468, -857, 99
+L154: jsr L150
+L155: .string "ynmrjghlp"
+; comment
+L156: .string "zqkas"
+L157: mov #-77, *r4
+cmp #247, *r2
+L158: cmp #144, #-137
+L159: clr r6
+red L555
+L160: prn L474
+inc r0
+L161: .data 132
+
+L162: mov *r6, *r0
+L163: jsr *r3
+L164: .string "kbnpttnanfpmbet"
+not r5
+L165: jsr *r3
+L166: stop
+rts
+cmp L290, r0
+L167: .data 59, -232
+L168: .data 541, 942, 556, -269
+L169: stop
+bne L183
+rts
+red *r0
+clr r6
+jmp *r2
+L170: jmp L466
+L171: stop
+L172: bne L5
+clr r3
+sub #202, L487
+bne L359
+L173: clr L150
+jsr L47
+L174: clr *r4
+L175: inc L73
+L176: prn *r5
+jsr L570
+rts
+L177: red r3
+L178: dec L348
+L179: add r7, L602
+cmp L157, #-251
+L180: dec *r2
+L181: sub *r1, *r0
+red r4
+L182: cmp L135, r1
+L183: red *r4
+L184: bne *r0
+mov *r7, r7
+prn L153
+add L479, r4
+L185: clr L24
+rts
+L186: not r7
+inc *r3
+L187: cmp r1, r5
+prn *r2
+sub r3, L332
+L188: rts
+L189: dec r4
+L190: .data 531
+L191: sub #-70, *r3
+L192: .data -116, -186, 868, -820, -466
+
+L193: stop
+rts
+L194: clr *r6
+L195: stop
+L196: .string "clsmdrvzuwidtvhgmiot"
+L197: .data -307, -38, 488, 632, 923
+
+L198: bne *r2
+L199: rts
+bne *r0
+jsr L11
+jsr *r1
+L200: red L172
+L201: cmp L432, #-158
+L202: sub r6, L197
+L203: prn #-87
+L204: lea L200, L402
+L205: clr *r1
+L206: clr *r1
+L207: .data -663, 161, 638, 191, 222, -204, 204, 405
+L208: add *r3, L243
+L209: prn r7
+L210: inc r0
+prn *r5
+L211: red *r0
+L212: .data -215, 600, 810, 342, -149, -34, 410, 139
+L213: dec r4
+add r4, L321
+L214: cmp #5, L564
+L215: mov *r1, L93
+L216: dec *r5
+L217: jsr L570
+L218: prn *r5
+
+L219: inc *r1
+clr r2
+cmp #116, r7
+L220: bne L86
+L221: prn r2
+jmp L142
+L222: not L520
+L223: sub L6, r5
+add L144, *r5
+L224: inc r4
+L225: mov *r6, L40
+L226: cmp r6, #36
+jmp L593
+not r2
+L227: add *r5, *r4
+L228: jsr L42
+L229: .string "ezxvmrsduhucnxxcb"
+L230: rts
+L231: rts
+clr *r1
+L232: prn r3
+jmp L306
+jsr *r0
+L233: jmp L57
+L234: mov L34, L374
+L235: inc r6
+add #-97, *r6
+red r0
+sub L161, *r7
+L236: .data 532, -380
+lea L423, r5
+L237: inc r3
+sub L520, L166
+bne L450
+jmp L129
+sub r3, L139
+L238: stop
+cmp L172, *r4
+
+L239: sub L48, r1
+L240: sub L462, r7
+L241: stop
+L242: mov #-194, r1
+L243: mov #140, L523
+L244: not *r2
+L245: jsr L602
+; comment
+stop
+cmp r4, L195
+bne *r5
+L246: .data -675, 475, -644, -977
+not *r5
+L247: sub *r0, *r5
+L248: lea L435, *r5
+not r2
+L249: red L401
+add L501, L206
+L250: mov L64, *r7
+L251: red L353
+sub L170, r5
+dec *r6
+stop
+L252: not L278
+L253: not *r7
+L254: clr r5
+L255: dec *r6
+not r4
+L256: rts
+L257: not *r5
+jsr L105
+L258: stop
+L259: prn *r1
+L260: sub r0, *r2
+L261: jmp L242
+L262: mov r1, L401
+inc L395
+clr L81
+L263: add L522, *r0
+red L86
+clr r5
+L264: add L206, *r5
+lea L601, L512
+
+
+jsr *r1
+L265: mov r0, r1
+L266: jmp *r4
+L267: prn #-53
+L268: .string "vyhfgtlmsnv"
+add #72, r2
+L269: sub L6, *r7
+
+cmp L373, L55
+L270: sub #132, L17
+jmp L464
+L271: cmp #22, L177
+L272: jmp L338
+jsr *r6
+L273: inc L326
+stop
+L274: .string "eyzxbsyjurzlxohpzutgj"
+; comment
+L275: dec *r4
+L276: .string "soodklacfubhwjpsabawmh"
+L277: sub L387, r7
+L278: not *r7
+L279: not r3
+L280: lea L341, r2
+mov *r2, L428
+cmp L258, #110
+rts
+inc r0
+
+; comment
+L281: .data 330, -839, 725, -47, 572
+L282: clr L69
+L283: dec *r3
+L284: not *r0
+L285: .data -621, 614, -120, 691, 440
+L286: dec *r5
+L287: clr L522
+not L607
+
+L288: red L101
+L289: jmp *r5
+L290: cmp L49, r5
+dec *r7
+L291: rts
+L292: not L81
+L293: .data 225, -470, -264, 426, -536, 743, 395
+stop
+L294: .data -900, 35, -560, 731, -922, -712, 280
+L295: dec r1
+mov #-86, *r5
+L296: inc r0
+L297: bne *r4
+; comment
+L298: .string "achwej"
+L299: red L322
+L300: not L277
+L301: stop
+L302: rts
+L303: clr *r0
+jmp *r6
+L304: bne L484
+dec L2
+dec r6
+L305: .string "awisinxtlm"
+jsr *r3
+L306: cmp L370, *r6
+L307: sub *r2, *r4
+dec r0
+bne *r2
+stop
+L308: jsr L487
+red *r1
+L309: mov L613, *r5
+mov #13, L303
+not *r4
+clr L600
+L310: prn *r7
+clr *r0
+L311: stop
+L312: lea L380, r0
+L313: mov #238, r6
+jmp L304
+L314: sub *r5, L143
+L315: .data 816, -300, 156, -726, 670, -760
+L316: .string "avtcvtgcsgwnidtmhoedxkd"
+L317: jsr *r2
+L318: stop
+inc L285
+bne *r1
+L319: red L391
+clr r6
+L320: jmp *r3
+L321: sub r3, *r1
+dec L499
+L322: prn r7
+L323: .string "qdkdvixjpdlpygrwins"
+lea L130, r6
+not *r1
+sub #-223, L367
+cmp r2, *r4
+L324: sub L487, L567
+rts
+L325: dec L142
+L326: jsr L235
+L327: clr r2
+stop
+L328: prn L107
+L329: not L242
+inc L589
+L330: cmp L45, r0
+L331: bne L474
+mov L102, *r2
+L332: not *r1
+red r2
+L333: mov #148, L532
+L334: dec L282
+L335: .data 471, -491, -140, -871, -561, 593, 801
+L336: bne *r5
+not L173
+L337: clr *r2
+; comment
+L338: .string "hubjzlpordooydx"
+inc L55
+L339: .string "ygwhcgulrnivxoco"
+L340: cmp *r7, #46
+L341: jmp *r2
+rts
+
+L342: dec r2
+jsr *r2
+red r1
+L343: lea L275, r4
+L344: stop
+bne L103
+L345: .data 184, 268
+L346: clr *r3
+L347: sub #184, *r0
+L348: red *r0
+L349: .string "hixiljmdtskapauoysdmhrc"
+prn #-63
+L350: red L512
+L351: dec L490
+lea L496, r2
+L352: jmp L87
+jsr L310
+L353: inc r6
+
+stop
+L354: prn L255
+L355: rts
+L356: mov r1, *r5
+jmp L147
+L357: jsr L299
+dec L261
+red L590
+L358: add #-116, r4
+L359: .data 28
+L360: stop
+L361: bne *r0
+mov L563, *r0
+L362: stop
+bne *r3
+rts
+L363: bne *r7
+stop
+L364: .data 809, -572, -423, 338
+L365: sub L430, r2
+L366: not *r4
+bne L609
+L367: clr *r4
+L368: jmp *r2
+cmp L98, L245
+lea L423, *r0
+L369: cmp #213, L553
+L370: add L134, r7
+L371: jmp L482
+bne *r6
+add *r4, L180
+L372: add L279, r4
+clr L269
+L373: stop
+L374: dec *r1
+L375: .string "n"
+red L464
+cmp *r1, L482
+L376: clr L390
+jsr L145
+stop
+L377: .data -926, 517, -913
+L378: red L465
+stop
+L379: rts
+L380: dec *r7
+L381: mov #92, r7
+lea L540, r1
+L382: bne *r3
+lea L406, L467
+jsr *r2
+L383: .string "xdckrlzpv"
+L384: dec r5
+mov #141, *r2
+L385: .data -24, 335, -918, 29, -988, 861, 759
+bne L215
+add r6, *r5
+lea L117, *r3
+L386: not *r7
+L387: not L127
+L388: rts
+L389: mov r2, r4
+L390: bne *r2
+L391: add r0, *r5
+L392: prn r4
+L393: not r5
+L394: red r1
+
+L395: jmp L430
+L396: bne *r3
+jsr *r2
+lea L611, r2
+L397: rts
+L398: stop
+rts
+rts
+L399: bne L28
+L400: jmp *r6
+sub *r4, r1
+prn r6
+L401: red *r1
+L402: .string "jyswexadplmtgonlyqibl"
+L403: cmp r3, #-11
+L404: dec L576
+L405: rts
+inc *r6
+L406: .data 423, 244, -45, 452, -493, -271, 249, -959
+sub L36, L109
+L407: prn #-75
+jsr L585
+L408: lea L582, L280
+
+L409: add *r0, L478
+L410: cmp L286, *r0
+L411: clr r6
+L412: not *r5
+dec *r7
+jsr *r5
+L413: red r6
+L414: prn *r1
+L415: not *r6
+red L580
+dec L397
+L416: cmp #-208, L275
+
+L417: dec r2
+not *r3
+jmp *r3
+L418: bne *r2
+L419: clr L285
+L420: jsr *r7
+
+; comment
+L421: .data -206, 34, 851, 291, 262
+mov r2, r2
+L422: red L547
+inc *r3
+L423: .string "jevreovny"
+L424: dec *r2
+L425: red *r6
+jsr L467
+lea L546, *r6
+L426: sub L289, L374
+L427: not L604
+L428: dec r7
+L429: cmp *r4, r0
+prn *r6
+L430: not *r6
+L431: inc L89
+clr *r1
+L432: red L589
+L433: not *r1
+dec *r2
+L434: stop
+L435: add r6, L339
+L436: .string "w"
+red r1
+L437: mov #-89, r3
+L438: sub #-241, r1
+; comment
+; comment
+mov #28, L88
+L439: stop
+L440: lea L509, L594
+rts
+prn #-170
+L441: bne *r1
+L442: bne L566
+not r4
+L443: mov #196, r4
+L444: stop
+L445: .data -30, 14, -540, -315, -405, 688, 982, 59
+sub r2, L53
+jmp *r6
+L446: sub r3, r6
+L447: inc r2
+L448: cmp *r4, L328
+L449: mov r4, L599
+inc L569
+prn #253
+bne *r4
+L450: jsr L570
+cmp *r5, L167
+L451: lea L541, r1
+clr L273
+rts
+L452: lea L485, *r4
+; comment
+L453: rts
+bne *r2
+not r4
+cmp #-54, r5
+L454: prn *r7
+L455: dec L210
+L456: bne L479
+dec *r3
+L457: mov #17, r5
+mov r7, L220
+L458: bne L311
+stop
+L459: jsr *r3
+L460: bne *r1
+L461: stop
+add #215, *r6
+lea L67, L191
+L462: clr r0
+L463: not *r0
+; comment
+L464: .string "gnaovvoga"
+L465: .data 601, -893, -463, 89, -837, -338
+L466: not L520
+sub #-84, L126
+L467: sub #80, *r5
+L468: .data 498, -759, -543
+add r6, L507
+jmp L95
+L469: add *r6, *r0
+dec L232
+L470: add #-242, *r1
+L471: rts
+L472: add #-172, L490
+L473: dec L573
+clr r6
+L474: dec r2
+; comment
+stop
+L475: .data 212, 915, 649
+L476: .string "azknfvanwjgvdopmpen"
+jmp *r0
+rts
+L477: .data -306, 605, 986, -117, 143, -756, 194
+L478: jmp L96
+L479: rts
+cmp *r0, L36
+not r6
+clr r3
+cmp r3, #19
+L480: .data 999, 518, 344, -180, 695
+L481: jsr L205
+L482: mov L606, *r4
+L483: .string "bihgmslyuogfkunuu"
+; comment
+jmp *r7
+L484: red r0
+L485: inc *r5
+L486: lea L593, *r7
+L487: cmp *r7, L529
+not *r2
+sub L533, *r7
+L488: rts
+L489: add *r6, r3
+L490: add *r5, r0
+L491: rts
+L492: not r4
+L493: add r4, *r1
+L494: dec r7
+mov *r3, *r2
+L495: sub L561, r7
+jmp L552
+L496: not *r3
+L497: jmp *r1
+L498: prn *r3
+sub r2, r4
+L499: prn r1
+L500: .data -721, 353, -316, -163, 827, -175
+L501: rts
+lea L367, *r7
+L502: .data -344, -294, 49, -764
+L503: mov #134, *r3
+L504: red r5
+L505: not r5
+L506: not *r2
+red L92
+L507: lea L201, *r6
+L508: mov #148, *r6
+jmp L573
+L509: stop
+; comment
+L510: prn L538
+L511: bne L528
+L512: red r2
+L513: stop
+L514: jsr L374
+L515: dec L8
+L516: cmp #186, L162
+dec L541
+prn L429
+L517: sub #68, r2
+L518: mov r7, L149
+clr L522
+L519: prn #-195
+lea L69, r4
+dec *r4
+L520: lea L554, L610
+cmp r5, *r1
+
+not L594
+not *r0
+L521: jmp L380
+L522: inc L608
+
+stop
+L523: lea L251, r4
+L524: jsr *r4
+L525: jmp *r2
+L526: dec r5
+L527: inc L81
+L528: lea L192, r3
+L529: sub *r2, *r1
+
+L530: .string "tq"
+; comment
+L531: add *r1, *r1
+L532: .string "sjw"
+red *r3
+L533: rts
+jsr L369
+L534: mov L613, *r2
+L535: inc L584
+not r5
+L536: add #-46, *r6
+L537: lea L545, *r7
+mov L547, r0
+L538: .data 326, -319, 325, 808, -389, -49, -205, 76
+L539: jmp *r6
+L540: bne L507
+L541: .data 546, -365, 182, 702, 727, 958, -35, 799
+add L606, *r6
+L542: cmp *r5, r1
+L543: .string "yrfjmvew"
+L544: jsr *r6
+L545: .string "r"
+L546: add r6, r3
+L547: .string "elzdxjxjgfcifjrcxflntz"
+L548: cmp L550, *r5
+mov *r6, r6
+L549: prn *r6
+dec r7
+cmp r3, L555
+clr r6
+L550: .string "ifiteqahnhjq"
+; comment
+L551: lea L609, *r1
+L552: stop
+L553: lea L23, L556
+L554: red *r1
+L555: sub #-81, *r5
+rts
+L556: dec L222
+L557: red r0
+L558: stop
+L559: bne *r7
+not *r0
+L560: cmp r3, #-214
+L561: red *r4
+L562: dec L13
+L563: .string "lrjc"
+L564: add L299, r0
+rts
+L565: cmp L321, *r4
+not r2
+jmp *r0
+sub #-49, r4
+L566: clr *r4
+L567: .data 240, 748, 353
+inc *r2
+L568: mov #-90, r2
+cmp r7, *r4
+L569: .string "dx"
+L570: clr *r1
+rts
+red L178
+inc L609
+L571: jsr *r3
+L572: bne L594
+dec r3
+rts
+clr *r1
+L573: .data 377, 472, -781, 571, -519
+L574: red r1
+L575: .data -266, -966, 561
+
+
+L576: .string "r"
+L577: clr r6
+cmp #-163, r4
+L578: add #-94, *r3
+L579: red *r2
+bne *r5
+L580: clr *r3
+red *r6
+L581: not L106
+L582: jsr *r4
+rts
+L583: mov r4, *r0
+L584: clr *r5
+L585: inc L469
+L586: inc *r1
+rts
+L587: rts
+; comment
+L588: .data -698, -128, -272, 85, 130, -771, 220
+lea L353, *r1
+L589: dec r4
+L590: .string "kcuqckflpokdgnqoyu"
+L591: dec L363
+inc r2
+L592: bne L601
+L593: dec *r7
+L594: .string "ffsfcsnjzdajakapcxrsas"
+L595: clr L557
+L596: clr r3
+L597: sub *r4, *r5
+L598: not *r6
+L599: .data 47, 612, 192, -483, 240, -593, 936
+jmp L601
+L600: prn r2
+L601: sub r4, r3
+L602: inc L608
+L603: prn *r0
+lea L40, r2
+L604: mov L611, *r4
+lea L606, r6
+L605: jsr L608
+L606: add L295, L184
+rts
+prn r6
+rts
+L607: lea L611, r2
+L608: .data 360, -52, 809, 535, -285, -676
+L609: bne *r4
+bne *r1
+stop
+inc L611
+L610: mov L612, *r5
+; comment
+L611: add *r2, *r1
+L612: jsr *r7
+L613: .string "rb"
+cmp *r4, *r2
+L614: cmp #209, #-118
+jsr L337
+L615: jsr L235
+stop
@@ -0,0 +1,1041 @@
+; Generated by genCorpus --seed 8
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+L0: stop
+L1: dec *r4
+L2: red *r2
+L3: add *r5, r7
+stop
+L4: dec L3
+clr *r5
+L5: lea L2, L2
+L6: bne L198
+clr *r1
+; comment
+L7: clr L252
+add *r0, r4
+L8: cmp *r1, r1
+sub #190, *r4
+lea L5, r7
+L9: .data -164, 389, -899, 657, -56, -581
+L10: rts
+add r5, L2
+L11: lea L571, r6
+L12: mov L4, L3
+bne *r3
+L13: sub #-83, *r2
+prn *r0
+add *r5, *r2
+rts
+mov #243, *r4
+stop
+lea L37, L522
+jmp *r2
+bne L425
+L14: .data 216, 818, -272, -546, 70, 969, -822
+L15: sub r2, *r3
+
+L16: .string "jsfqaomukerzrvxqaoe"
+; comment
+L17: .string "abq"
+L18: jsr *r2
+prn *r2
+; comment
+L19: jsr L70
+jsr L415
+L20: add *r6, *r0
+L21: .data -624
+L22: .string "ziagovqurmnwpy"
+L23: red L491
+L24: sub L0, L22
+add r2, L74
+stop
+L25: bne L17
+jsr L503
+inc r2
+
+L26: inc L161
+L27: inc L24
+L28: red *r3
+L29: inc L330
+L30: .data 906, -835, 618, 447, 13
+jmp L253
+prn L20
+L31: clr r4
+L32: rts
+clr r3
+L33: not r7
+L34: cmp r5, #-115
+clr *r3
+jmp L16
+L35: sub r5, L17
+L36: .string "owijqaycjarx"
+; comment
+L37: bne *r6
+L38: jsr *r6
+not r7
+stop
+prn r5
+L39: bne *r4
+; comment
+L40: .string "idnzrgcgd"
+stop
+bne *r1
+lea L5, r5
+L41: .string "axtthktelwyka"
+L42: clr L30
+dec r0
+L43: .string "ncagwgaqptfhuwe"
+L44: jsr *r6
+cmp L504, r6
+jsr L55
+L45: clr r7
+L46: mov r6, L279
+jmp *r7
+L47: not *r6
+cmp #-52, L22
+bne *r7
+not r1
+L48: stop
+add #149, L256
+inc *r3
+L49: .string "lyfdcejohblqdhe"
+L50: cmp L305, r1
+inc L15
+not *r1
+L51: dec L472
+L52: lea L28, L383
+jmp L507
+L53: stop
+jmp L4
+L54: sub L15, r2
+L55: bne L7
+L56: cmp L11, *r7
+dec r3
+L57: bne *r1
+
+L58: clr L1
+prn r2
+L59: sub #243, r6
+L60: .data 410, 767, 376, -348, -580
+not r2
+L61: not *r6
+bne L233
+bne *r2
+L62: add r2, L49
+inc L55
+L63: red r7
+not *r3
+L64: rts
+clr r2
+L65: rts
+dec L32
+L66: jmp *r1
+mov *r5, r3
+jmp L208
+lea L557, L62
+add r5, r3
+L67: .data -751, -885, -376, -727, -156, -31, -883
+L68: clr r6
+L69: clr L14
+L70: stop
+L71: clr *r5
+
+add r2, r7
+L72: prn r3
+L73: .string "xop"
+L74: .data 127
+stop
+not L236
+L75: stop
+L76: .string "zawwxywxsx"
+jsr L5
+; comment
+
+L77: clr L590
+lea L458, r7
+L78: not *r5
+L79: sub r5, r4
+L80: .data 997, -28, -383, -785, -353, 77
+L81: prn r3
+L82: not L71
+L83: rts
+L84: stop
+L85: rts
+L86: lea L38, r4
+L87: clr L121
+L88: lea L76, *r6
+add *r0, r5
+L89: .string "njr"
+sub *r7, *r3
+L90: .data -73, 26
+L91: jmp *r5
+L92: sub *r3, L17
+L93: .data -497, -59, -503, -538
+L94: inc L66
+clr L577
+L95: clr *r3
+add L439, *r1
+L96: inc L383
+L97: prn #-116
+clr L33
+L98: not *r6
+L99: lea L549, L46
+L100: .string "mkfwr"
+L101: mov L523, r3
+dec r2
+L102: inc r4
+L103: add L276, r3
+rts
+L104: jmp *r5
+L105: rts
+L106: dec *r6
+add #-112, *r3
+L107: rts
+L108: prn r7
+prn r5
+red *r1
+rts
+L109: not r4
+L110: stop
+red r2
+L111: jmp L23
+; comment
+L112: .data -12, -267, 470
+L113: clr r1
+mov #203, r2
+add r4, *r2
+dec L525
+L114: .string "iwaaovqfwbwxxwzo"
+L115: rts
+not r5
+
+L116: not L409
+clr *r2
+L117: .string "flausphhnh"
+L118: stop
+L119: red r5
+L120: inc L74
+clr r6
+L121: stop
+cmp *r3, L402
+prn *r7
+clr *r7
+L122: .string "lxmop"
+L123: jmp L57
+L124: dec r6
+L125: jsr *r7
+L126: not *r7
+L127: jmp *r0
+L128: bne *r7
+cmp r0, r5
+prn L25
+prn *r2
+L129: dec *r7
+L130: not r2
+L131: stop
+L132: jmp *r3
+
+L133: jsr *r3
+L134: .string "gazrtvrwcaxh"
+sub r4, *r5
+L135: prn r6
+
+sub L556, *r7
+L136: inc *r4
+L137: dec L281
+red L99
+red r1
+L138: clr L335
+L139: not L587
+jsr L379
+L140: red r0
+L141: lea L569, *r4
+L142: inc r5
+L143: not *r6
+L144: rts
+L145: cmp #-62, r5
+L146: red L476
+L147: .string "fijobauobhyraftdibswfsvr"
+L148: clr L485
+prn r5
+add #-129, L545
+L149: red *r4
+sub *r4, L211
+L150: not L107
+L151: lea L605, *r2
+L152: rts
+jmp *r3
+L153: not *r0
+; comment
+L154: inc *r7
+L155: .data -800, -882, -754, -998, -200
+L156: .string "wuhesorpoilldxtnyeo"
+L157: jmp L2
+not *r3
+cmp L563, L356
+L158: rts
+L159: clr r0
+L160: cmp *r3, L418
+prn *r2
+L161: jmp *r0
+L162: stop
+L163: add *r4, L299
+L164: not L241
+L165: mov r0, *r7
+L166: prn L120
+L167: .string "ulbplb"
+add r6, L308
+prn #-241
+L168: cmp r5, *r1
+L169: jmp *r5
+L170: not r2
+cmp L418, *r3
+L171: add r5, r7
+L172: rts
+L173: sub #-232, L49
+mov *r5, *r1
+L174: inc L331
+L175: stop
+L176: prn r5
+L177: dec r4
+L178: rts
+jsr L220
+mov r2, *r6
+L179: rts
+dec r4
+L180: dec r7
+sub L562, *r5
+L181: red L16
+L182: mov *r0, L268
+mov r2, r2
+clr r3
+mov L502, L349
+L183: lea L307, r3
+; comment
+L184: inc L2
+L185: clr *r5
+
+L186: lea L61, r6
+lea L66, L302
+L187: jmp *r2
+not L385
+L188: prn *r7
+clr r0
+
+clr L324
+L189: clr L229
+L190: red L277
+L191: red r3
+L192: red *r3
+L193: .string "pkgjhlba"
+L194: mov r2, *r6
+L195: red *r5
+jmp L71
+L196: jsr L393
+clr L65
+; comment
+L197: rts
+L198: dec r3
+L199: bne L527
+L200: inc *r6
+L201: jsr *r2
+L202: .data -6, 245, 905, -573, 470, 597, -528
+stop
+L203: .string "roso"
+mov #-53, *r3
+L204: red r6
+L205: bne L190
+L206: lea L505, *r3
+L207: lea L242, r5
+L208: rts
+L209: lea L486, r4
+L210: bne *r6
+L211: bne *r3
+; comment
+L212: prn #-226
+L213: not L393
+L214: prn r3
+L215: add *r1, *r7
+L216: cmp L434, L304
+L217: jmp L277
+L218: add *r2, *r7
+cmp L492, L135
+L219: red r4
+L220: mov #-222, L388
+L221: not *r4
+jsr *r3
+L222: jsr *r2
+L223: add r1, L161
+L224: stop
+L225: lea L14, r0
+L226: jsr *r5
+L227: jsr *r1
+cmp r6, #-67
+L228: rts
+L229: jsr *r4
+L230: .string "zyzuwzbxkkpxkwiwvhq"
+inc *r1
+L231: .string "iliflegfsskszogarblyxs"
+L232: rts
+
+L233: lea L85, L114
+jmp *r1
+sub L229, *r4
+L234: cmp L608, *r2
+L235: jsr L483
+L236: jmp L119
+L237: bne L483
+add #64, L601
+L238: lea L573, *r5
+L239: mov *r4, *r6
+cmp L65, #166
+; comment
+L240: .string "agwvtesakkjklwdwuwpmoyhn"
+L241: dec *r0
+not *r2
+lea L207, *r3
+L242: lea L231, L325
+L243: prn *r5
+L244: clr r3
+L245: bne L210
+jsr *r7
+L246: mov r5, L465
+L247: jsr *r6
+L248: lea L49, r0
+sub *r6, *r0
+jmp *r6
+dec *r1
+L249: clr L382
+L250: stop
+jsr *r5
+L251: sub #251, L575
+L252: mov r7, *r7
+L253: jmp L118
+prn *r5
+mov #243, L84
+L254: prn L208
+bne *r6
+jmp L53
+L255: jsr *r7
+prn *r0
+not L455
+L256: prn #161
+L257: stop
+sub L266, r1
+L258: .data 664
+L259: sub L230, r6
+mov r3, r4
+mov r1, r3
+L260: add L508, L253
+L261: inc *r0
+
+L262: .string "gh"
+rts
+L263: mov L143, r5
+L264: lea L425, L188
+cmp *r1, L592
+bne L241
+L265: mov *r5, r4
+L266: inc *r5
+L267: red *r7
+L268: cmp #1, #3
+L269: .data 826, -989, 749, -73, -349, 253
+L270: red *r6
+jsr *r1
+bne *r6
+; comment
+L271: jsr *r3
+L272: cmp L70, *r5
+rts
+L273: sub #206, r1
+mov #-105, r2
+dec *r2
+L274: mov r4, r1
+L275: cmp L177, L300
+L276: prn #106
+L277: red *r3
+inc L131
+L278: inc *r3
+lea L346, *r6
+L279: clr *r3
+cmp L558, r2
+L280: jsr L179
+L281: .data -631, -806, 590, 100, -467, 797, 367, -425
+; comment
+rts
+L282: lea L478, *r5
+L283: add L577, r6
+L284: inc *r6
+mov r0, *r5
+sub r4, L576
+L285: jmp *r4
+L286: jmp L464
+L287: sub #-80, *r5
+L288: rts
+L289: cmp #107, L388
+cmp #192, #-7
+dec r6
+jmp *r4
+L290: mov L353, *r1
+L291: add #105, L592
+L292: mov *r0, *r5
+L293: red r1
+L294: stop
+L295: inc L325
+L296: mov #-181, *r4
+; comment
+dec r4
+L297: inc L70
+L298: dec L561
+clr r1
+L299: .data -804, 399, -582, 713, -913
+L300: bne *r6
+rts
+L301: prn r3
+L302: lea L21, L386
+L303: prn *r1
+clr *r5
+L304: jmp *r7
+add r6, *r5
+L305: dec *r1
+L306: cmp L502, *r0
+L307: cmp #-133, *r5
+L308: bne *r2
+sub #-135, r5
+L309: .data -939
+L310: stop
+rts
+mov *r3, L392
+L311: mov *r4, *r3
+L312: jmp *r0
+
+inc L324
+sub #-235, r5
+; comment
+jmp *r1
+L313: cmp *r4, *r6
+stop
+L314: inc *r5
+L315: .data 676, -335, 344, 4, 631, 53, 87, 773
+L316: red *r0
+not *r4
+L317: inc r1
+clr *r3
+dec L359
+dec *r2
+L318: dec L393
+L319: prn r0
+L320: lea L313, L9
+L321: inc r2
+jmp L532
+cmp *r2, *r0
+L322: rts
+cmp r4, #162
+L323: prn L290
+cmp L331, r7
+dec r2
+L324: sub L184, r0
+sub r3, r5
+L325: prn L176
+L326: .data -356, 679, -765, 766, -538, 925, 173, 976
+L327: bne *r3
+L328: inc *r5
+bne L202
+L329: prn r4
+L330: not r2
+L331: mov #27, L216
+L332: cmp *r5, r3
+L333: clr r2
+; comment
+L334: not L448
+L335: red r0
+; comment
+mov L398, r4
+L336: not *r7
+L337: red *r0
+L338: mov *r6, L16
+; comment
+prn L587
+L339: .data -867, 598, 145, -301, 617, -213, 604
+stop
+inc r5
+mov r1, L454
+L340: jmp *r4
+jsr *r0
+jsr L344
+L341: add *r7, *r5
+; comment
+L342: not *r6
+clr *r4
+L343: .data -642, 857, -146
+L344: prn r7
+L345: jmp *r3
+sub r3, r2
+L346: .string "pp"
+L347: mov r6, *r7
+bne L336
+
+L348: jmp *r0
+L349: jsr *r5
+bne *r6
+L350: add L496, L567
+L351: .string "kt"
+L352: red *r2
+L353: jmp *r4
+L354: lea L26, *r6
+L355: rts
+L356: inc r2
+L357: jsr *r0
+L358: bne *r2
+L359: .data -367, -109, 821, -674, 523, -743, 682, 185
+cmp r3, #63
+mov r4, r2
+dec L540
+L360: red L122
+; comment
+prn r2
+L361: stop
+L362: red r7
+lea L95, *r0
+L363: cmp #50, L571
+L364: red r4
+L365: red L29
+mov L536, *r1
+L366: add L451, r1
+not L533
+L367: cmp *r0, r2
+L368: lea L460, L600
+
+stop
+L369: sub L584, L567
+bne *r5
+mov r3, r0
+L370: prn L345
+stop
+L371: .string "wacrfvzaedxzkzwiaj"
+L372: prn r4
+stop
+L373: lea L578, r5
+mov L117, L545
+mov r4, r3
+L374: jmp L218
+cmp L462, #43
+L375: .string "lvefxuwiicmdttukprecv"
+L376: .data -266, 719, 292, -883, -194, 520, 460
+L377: stop
+L378: not L206
+prn #142
+clr r6
+L379: .data -575, -374, 663, -774, 638, -321, -382, 877
+L380: inc L347
+L381: .data -517
+L382: bne L441
+not *r2
+L383: inc *r2
+red L595
+
+clr L18
+not *r4
+inc r7
+L384: red r6
+sub *r3, *r6
+
+L385: stop
+L386: red *r5
+L387: not r3
+; comment
+bne L72
+L388: .string "lozvqjiebssqxfjhzulqljce"
+L389: sub L493, L297
+lea L407, *r7
+not r0
+L390: .data 398, -213
+L391: inc L319
+lea L193, L490
+inc L84
+L392: cmp *r6, r4
+L393: cmp r2, #-200
+L394: jmp L583
+L395: .data 603, -347, -397, -348, -387
+add #52, *r1
+L396: .data -136, 472, 944
+prn r2
+L397: cmp r6, #-209
+add r2, r5
+L398: dec L456
+L399: dec L528
+rts
+L400: .string "zamtbbmgmxhtrkqj"
+L401: .string "jtywbovuayx"
+add *r5, r6
+add *r0, r1
+L402: .string "xgwcfnnswxkdkzc"
+L403: .string "bmte"
+L404: clr L295
+not L60
+sub L581, L485
+L405: red L321
+L406: clr L592
+red L343
+L407: red L514
+L408: lea L388, L270
+stop
+L409: .data 430, 547
+L410: not r6
+; comment
+L411: rts
+prn #189
+L412: .data -124, -90, 388, 519, -367, 29
+L413: inc L271
+L414: sub L530, r2
+L415: rts
+dec L49
+inc *r6
+L416: jsr L543
+L417: not L240
+jsr *r7
+L418: inc r1
+L419: .data 774
+L420: .data 846, -676, -255, 645, 9, 828
+prn L125
+L421: dec *r3
+L422: red r6
+L423: rts
+L424: rts
+cmp #73, #250
+dec r3
+; comment
+L425: red L488
+L426: cmp #-45, #232
+L427: rts
+L428: jsr L477
+L429: stop
+L430: rts
+L431: cmp r7, #-53
+L432: dec *r5
+L433: jmp L548
+L434: prn *r6
+L435: cmp #203, *r0
+L436: jsr *r4
+L437: cmp *r4, #-202
+cmp #-41, r7
+L438: add #-246, r6
+L439: rts
+L440: clr *r2
+mov *r6, *r3
+L441: not L402
+L442: add *r1, r6
+
+inc *r7
+L443: not r2
+L444: .data 727, 684, -52, -787, -587, -143, -811, -537
+L445: mov L5, r0
+sub r2, r3
+L446: jsr *r7
+lea L359, r7
+L447: stop
+L448: cmp *r5, *r3
+L449: .data -228, 299, -813, -640, 637, 489, 285
+L450: rts
+L451: .string "prtsrck"
+L452: rts
+rts
+clr L598
+L453: bne *r1
+L454: .string "ftmxxzuqa"
+L455: red *r0
+cmp L601, #33
+L456: .data -952, -283, 548, 544, -713, 110, 551, 823
+rts
+L457: jsr *r0
+; comment
+cmp r1, #209
+L458: dec r3
+rts
+L459: jmp L188
+L460: .data -709, -397, 719, 194, 25, 921, -676
+dec *r3
+L461: bne *r2
+L462: mov L536, *r0
+L463: .string "plax"
+L464: .string "mhtnetyqkkdlcjhtuhylqqji"
+
+cmp *r6, #172
+L465: .string "mdnxnigjutfblxmdqig"
+L466: not r3
+L467: .data -295, 693, 22
+L468: cmp L318, L575
+L469: inc *r6
+L470: sub *r3, r6
+clr r3
+lea L263, r3
+L471: cmp r3, *r5
+L472: dec *r4
+L473: .data -249, 961, -642, 814, 330
+L474: not r2
+L475: .string "nqnpjgtgglaza"
+L476: add L517, r3
+L477: add L401, *r6
+L478: jsr L592
+L479: lea L564, *r2
+L480: inc *r4
+L481: lea L539, r7
+dec r5
+L482: rts
+L483: .data -281, 702, 590, 153
+jsr *r0
+L484: not *r5
+L485: dec *r5
+L486: lea L572, L557
+bne *r7
+L487: mov #-149, r3
+L488: cmp *r1, *r3
+L489: .string "zozaetlufbtprfgeusqwc"
+L490: not L548
+L491: .string "ztchffpcdyavyfxco"
+L492: .string "swpxrxssktxintwzcfym"
+L493: stop
+L494: bne *r2
+cmp L336, *r4
+L495: inc r6
+L496: not L459
+L497: jmp L558
+clr L504
+inc r6
+L498: lea L594, *r7
+L499: mov L164, L448
+L500: .data 545, 920, 127, 941
+L501: rts
+
+L502: red *r4
+cmp r5, L265
+prn L50
+L503: mov #-64, L342
+L504: jsr *r1
+L505: inc L583
+L506: inc r2
+L507: mov r1, L246
+L508: bne *r5
+rts
+L509: lea L607, L329
+mov *r3, r1
+L510: dec L423
+L511: .data -488, -101, -109, -456, -787, 580, 163
+clr r0
+L512: inc r0
+L513: lea L527, L181
+jmp *r0
+L514: red L173
+L515: red *r6
+sub *r6, *r2
+mov r1, *r1
+L516: add *r3, L568
+L517: cmp #-199, r7
+L518: bne L550
+L519: jsr L319
+L520: jsr *r6
+L521: inc *r7
+L522: bne L554
+L523: stop
+jmp *r3
+L524: mov r3, *r0
+bne L72
+bne *r3
+bne *r4
+L525: rts
+L526: .string "fopcgmnntozajcflhtnfyc"
+dec L491
+L527: .string "wjsftyyywwphctz"
+L528: sub *r7, r1
+L529: bne L513
+L530: sub #119, *r0
+L531: add r7, *r3
+L532: mov r5, L31
+jsr *r2
+lea L306, r5
+L533: lea L391, L28
+L534: .data 950, 350, -565, -575, 541
+mov L608, *r3
+clr L256
+L535: mov *r5, *r2
+L536: cmp *r1, #247
+clr r3
+L537: add *r3, L216
+dec r5
+mov L104, *r3
+L538: .data -107, -387, -316, -596, 832, 815, -740
+L539: jsr L541
+lea L105, r5
+L540: jmp L437
+not L563
+L541: mov #229, *r2
+L542: .data -399, 689, -296
+lea L578, r1
+sub r4, r6
+lea L440, *r5
+L543: not r2
+L544: dec r6
+add *r7, r4
+L545: mov L93, r0
+
+jsr L548
+L546: rts
+prn *r4
+L547: prn r5
+inc L570
+L548: red *r5
+L549: lea L510, *r1
+L550: mov #-242, *r4
+dec r5
+L551: dec L588
+lea L273, r5
+L552: .data 559
+
+dec *r6
+L553: red L531
+L554: rts
+bne *r7
+sub *r3, *r5
+L555: sub r6, *r2
+dec r6
+clr *r0
+L556: cmp #107, #69
+mov *r4, L579
+cmp r5, L582
+jmp L568
+L557: jmp *r6
+L558: jmp L244
+cmp *r7, r0
+jmp *r4
+stop
+; comment
+mov r1, *r4
+L559: jmp L597
+L560: .data 79
+L561: prn #-15
+L562: sub L499, L594
+L563: red *r5
+L564: inc L600
+L565: .data 516, 537, 814
+lea L10, *r6
+dec r0
+L566: .string "v"
+L567: jmp *r5
+lea L318, *r5
+rts
+L568: mov L551, L604
+L569: rts
+inc *r3
+L570: lea L580, *r1
+stop
+L571: rts
+add r2, L223
+
+jsr *r5
+L572: .data -240
+L573: jsr L4
+L574: red *r2
+L575: add *r2, r7
+L576: bne *r1
+L577: rts
+lea L28, r7
+jmp *r6
+L578: jmp *r3
+lea L442, L606
+L579: .data -867
+jsr L0
+lea L595, L283
+; comment
+L580: .string "pjcbsrpfz"
+L581: clr r7
+lea L532, L504
+L582: .string "vvt"
+L583: add #183, L478
+L584: add #42, *r0
+inc *r7
+L585: cmp *r1, L275
+L586: sub *r0, L109
+L587: cmp *r4, r1
+; comment
+L588: rts
+jsr *r7
+L589: prn #192
+L590: .data -58, -775, 911, -242, -530, -606, -175, -896
+L591: bne *r7
+L592: jmp *r1
+L593: red *r6
+clr L607
+L594: inc r3
+L595: jsr L603
+L596: sub L603, r3
+L597: clr L599
+clr L345
+cmp *r1, *r6
+dec r4
+L598: .string "hcrlrcuqsnluftbi"
+stop
+dec *r5
+; comment
+L599: dec r2
+L600: dec r6
+clr L604
+sub *r6, L447
+L601: dec *r1
+stop
+L602: rts
+L603: prn r4
+not L521
+L604: stop
+L605: .data -276, 191, 162
+dec *r3
+L606: clr *r6
+L607: dec L448
+dec *r2
+not L608
+jsr L351
+bne L609
+prn L609
+L608: clr *r7
+jmp L609
+rts
+
+L609: jsr L320
+stop
@@ -0,0 +1,1040 @@
+; Generated by genCorpus --seed 9
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+lea L438, L45
+L0: red *r6
+L1: .string "hnqoktsvim"
+L2: inc *r2
+L3: prn L0
+
+inc *r5
+sub r1, *r3
+L4: add r0, r4
+; comment
+L5: bne *r4
+L6: bne *r3
+L7: add r4, L2
+L8: sub L5, L45
+L9: add r3, L7
+L10: cmp r3, L6
+L11: add #-55, *r1
+L12: dec r5
+L13: mov L559, *r7
+L14: .data -339, 479
+L15: jmp *r6
+L16: .data -400, -750
+L17: red L7
+prn #44
+prn L5
+L18: cmp L154, *r2
+jsr *r6
+L19: stop
+bne L112
+L20: stop
+L21: mov L238, r5
+; comment
+L22: add r6, r6
+rts
+L23: dec *r5
+L24: mov L9, L132
+L25: bne *r3
+L26: bne L5
+sub r3, *r2
+L27: cmp L442, L26
+bne *r3
+L28: sub *r2, r0
+L29: red L21
+L30: clr L3
+add *r3, L4
+clr L441
+stop
+L31: .string "fdobuvura"
+L32: not *r3
+L33: inc r3
+L34: bne L33
+bne *r6
+dec r2
+L35: inc r3
+L36: dec r1
+sub L463, *r7
+L37: bne *r7
+L38: mov r3, *r3
+mov #-82, L211
+not L170
+L39: jsr L470
+L40: clr L6
+prn L165
+lea L26, L8
+L41: clr L435
+bne L26
+L42: .data -568, 35, 324
+jsr *r6
+L43: stop
+L44: stop
+; comment
+stop
+lea L6, *r1
+L45: lea L68, *r2
+bne *r2
+inc L31
+L46: cmp #229, r6
+L47: rts
+red r2
+stop
+jmp L116
+L48: .data 449, -458
+L49: lea L29, *r5
+sub #-144, *r0
+rts
+jsr *r5
+L50: .string "cairp"
+L51: lea L18, r6
+mov L38, L25
+L52: rts
+L53: .string "gufvtvndysdpvjnq"
+L54: bne L183
+L55: .string "jgegugnlpj"
+L56: rts
+L57: jmp *r7
+L58: .data -628, -961
+add L329, *r3
+bne *r6
+L59: jsr *r0
+L60: jsr *r6
+L61: .string "xcqntzg"
+prn L160
+L62: add r6, *r6
+rts
+L63: inc *r5
+L64: not r7
+L65: not *r4
+jmp L475
+L66: .string "occgtfowdpmn"
+L67: sub L367, r5
+L68: .data -500, 461, -683
+L69: clr L162
+L70: jmp *r6
+L71: cmp r4, L64
+bne L459
+; comment
+L72: .string "jjnqcnnkhmfzqdrldi"
+red r3
+L73: .data 600, 218, -691, 892
+L74: sub L211, L35
+L75: mov #73, r0
+L76: jmp L514
+L77: cmp L181, *r7
+red *r5
+L78: stop
+L79: stop
+add #38, L38
+prn L596
+L80: jmp *r0
+bne *r3
+L81: sub #149, *r1
+L82: mov *r7, L128
+clr L35
+L83: add *r6, *r6
+L84: rts
+L85: bne L136
+L86: add #-179, L368
+L87: .data 999, 85, 510, 477, -978, 522, 778, -795
+L88: jsr *r1
+not *r2
+inc r3
+L89: clr L363
+L90: jsr *r2
+L91: sub *r7, r0
+L92: prn L295
+; comment
+L93: not L89
+L94: add *r1, r5
+inc r0
+L95: jmp L35
+L96: jsr *r6
+mov #119, r5
+L97: not *r0
+clr L64
+L98: sub #-115, r4
+L99: jmp L66
+L100: sub *r6, L433
+L101: add r4, *r7
+L102: mov *r2, r3
+clr r4
+L103: rts
+L104: prn L35
+add r2, r6
+bne *r5
+cmp #-46, r3
+; comment
+L105: clr L174
+L106: prn #11
+red L205
+L107: cmp #-88, r2
+L108: dec L353
+L109: not *r3
+L110: rts
+L111: stop
+L112: cmp *r1, L96
+L113: red *r2
+inc r3
+jmp L504
+L114: stop
+L115: clr *r4
+L116: prn #-238
+L117: add #-217, L301
+L118: red L293
+L119: rts
+rts
+jmp L485
+L120: inc r7
+L121: add *r2, *r6
+L122: red L34
+prn L188
+red *r5
+L123: jsr *r2
+rts
+stop
+L124: lea L408, L401
+L125: jsr *r1
+L126: lea L88, *r5
+L127: bne *r4
+sub r6, r7
+red L398
+L128: red *r4
+L129: cmp L325, *r0
+L130: bne *r2
+L131: prn #147
+dec *r6
+L132: clr *r3
+stop
+L133: bne *r5
+cmp L461, #-145
+L134: .data -427, 475, -612, -154, 791, 957
+inc r7
+bne *r0
+jmp L121
+add r7, *r5
+dec *r4
+
+red L318
+L135: stop
+L136: jsr *r4
+L137: sub #7, L36
+L138: add #-178, r6
+L139: sub r2, L481
+L140: add #-128, L78
+jsr L37
+L141: mov L376, r3
+L142: .data 410, 266, -253, 223
+stop
+lea L397, r4
+mov #-226, r1
+L143: jsr L133
+L144: jsr L98
+stop
+red *r4
+L145: .data -686, 901, 919, 409, 593, -497, -579, 425
+L146: .data -712
+jsr *r1
+
+L147: prn *r0
+L148: dec *r6
+clr r4
+L149: sub #158, r4
+inc r6
+L150: clr *r4
+L151: .string "dkxrjdkleyvxeoyusxbw"
+dec r2
+L152: rts
+L153: jmp L51
+L154: jmp L91
+L155: .data 775, -366, 960, 182, -655, 151, 110, -916
+jmp L72
+not r5
+L156: sub L25, r7
+; comment
+L157: .data 549, 23, -224, -637
+L158: jmp L188
+L159: stop
+L160: sub L382, *r3
+L161: clr *r0
+L162: rts
+L163: sub *r7, *r5
+L164: red *r1
+lea L141, L24
+L165: stop
+L166: stop
+L167: inc r6
+cmp L77, *r5
+L168: cmp *r0, L106
+stop
+L169: dec r7
+L170: prn L96
+dec L38
+jsr L153
+L171: mov *r1, *r2
+L172: stop
+L173: stop
+L174: inc L76
+L175: cmp #36, *r3
+not r5
+L176: .data -401
+L177: lea L584, *r1
+L178: dec L48
+L179: .data -999, 418, 547, -995
+lea L267, L460
+mov #172, L171
+L180: .string "ifayknmrlsuhv"
+L181: jsr L544
+; comment
+stop
+L182: .data 149, 997, -510, -450, -439, -569, -41
+L183: red L103
+L184: .string "biys"
+bne L148
+sub L108, L167
+cmp r0, r6
+L185: red *r5
+
+
+
+L186: jsr L131
+L187: sub r2, L29
+L188: rts
+stop
+L189: add r1, *r2
+prn r1
+L190: stop
+L191: dec L545
+L192: prn #243
+L193: stop
+L194: add L103, L470
+stop
+L195: mov *r4, *r3
+L196: .data 92, -611, -989
+L197: jsr L371
+L198: red *r2
+cmp *r1, r2
+lea L548, L598
+L199: jsr L145
+L200: stop
+lea L33, *r4
+L201: cmp L204, L9
+stop
+L202: dec r5
+L203: mov *r4, *r6
+L204: jmp L77
+; comment
+add #248, L62
+not r4
+jmp *r6
+rts
+not *r2
+inc r3
+L205: not *r0
+L206: lea L386, L146
+bne L423
+L207: mov r5, L167
+add L289, L250
+bne *r3
+L208: jsr L510
+clr r1
+bne L238
+L209: .string "sskct"
+L210: cmp #168, *r1
+stop
+rts
+L211: red r6
+cmp L39, #75
+L212: jmp *r0
+L213: rts
+L214: jsr *r2
+prn r2
+prn L67
+L215: prn #17
+L216: lea L165, *r1
+inc L77
+inc r7
+L217: dec *r5
+L218: jsr L258
+clr L272
+L219: sub L479, *r6
+L220: clr r5
+L221: jmp *r4
+cmp L514, *r1
+stop
+L222: clr *r2
+L223: red r6
+L224: .data 419, -812, -623
+jmp L467
+L225: cmp r3, L551
+L226: bne L31
+L227: inc r0
+L228: clr r6
+sub *r2, L495
+L229: lea L145, *r6
+clr L57
+dec *r5
+stop
+prn #-221
+clr *r2
+L230: sub *r0, r2
+mov L212, r0
+sub #-130, r2
+L231: .string "kkwtgwz"
+; comment
+dec L217
+not L587
+L232: sub #135, L140
+L233: sub *r4, r6
+L234: bne *r2
+L235: clr *r4
+L236: cmp *r5, *r0
+L237: cmp #101, *r2
+L238: .data -60, -185
+L239: dec L473
+not *r6
+L240: red L397
+rts
+sub #-14, *r5
+jmp *r6
+L241: inc r0
+L242: sub *r1, L434
+L243: jmp *r3
+cmp #115, L242
+bne L487
+prn *r4
+L244: stop
+prn *r1
+L245: sub *r4, *r2
+L246: prn #29
+L247: add *r2, r2
+L248: sub L403, L538
+mov #-148, r4
+L249: stop
+red r0
+L250: .data -991
+add r2, r2
+L251: clr *r6
+jmp L174
+add *r1, r6
+
+L252: cmp L471, *r3
+dec r6
+L253: lea L386, *r2
+L254: lea L48, L7
+L255: prn #40
+add r7, r5
+L256: red r6
+L257: sub #-231, *r2
+L258: bne *r0
+mov #2, r6
+rts
+L259: bne L21
+L260: jmp L283
+L261: cmp L562, #-151
+L262: jmp L95
+L263: not L273
+L264: lea L407, *r3
+L265: .data 728, -529, -77, 770, -375
+L266: mov L321, *r6
+; comment
+L267: dec L417
+dec L235
+cmp L469, #-81
+jsr L324
+L268: prn r0
+not L85
+L269: lea L536, L263
+jsr L412
+L270: red r6
+clr L570
+L271: rts
+L272: .data -649
+red *r4
+L273: bne L267
+L274: prn r0
+L275: rts
+L276: rts
+; comment
+stop
+inc L105
+jmp L139
+rts
+L277: jsr *r1
+L278: .data 668, -757
+jsr *r1
+L279: not *r5
+red L18
+L280: rts
+L281: rts
+stop
+L282: bne *r2
+not L152
+L283: stop
+L284: add *r3, L285
+L285: jsr L140
+L286: clr *r0
+mov L182, *r0
+red *r7
+L287: red L525
+L288: sub *r3, r7
+L289: sub *r0, L355
+L290: jsr L176
+L291: prn #-182
+L292: dec L149
+
+mov L587, *r0
+L293: lea L87, r2
+L294: cmp r2, #107
+bne *r5
+L295: dec L406
+L296: rts
+L297: stop
+prn r7
+L298: .string "kaaaqhemswfz"
+L299: .data -193, 775, 55, -830
+L300: jsr *r2
+cmp *r3, #170
+mov #148, L398
+L301: .data -275, 788, 518, -85, -682
+L302: sub L298, L368
+L303: lea L67, L71
+L304: not r2
+L305: stop
+bne L158
+clr *r7
+jsr L72
+L306: .data 240, -601, 707, 793, 921, 966
+L307: jsr *r6
+L308: dec r7
+lea L68, *r7
+L309: stop
+L310: bne *r1
+L311: jsr L309
+L312: stop
+jsr L474
+L313: jsr L26
+bne *r1
+L314: clr *r5
+jmp *r1
+L315: dec *r4
+L316: prn #-174
+mov #-225, r7
+L317: rts
+L318: red r5
+; comment
+L319: mov #-2, *r2
+L320: jmp *r7
+clr *r1
+mov r4, L506
+add r4, L528
+; comment
+sub r5, r0
+L321: lea L110, L202
+inc r4
+L322: inc *r2
+L323: prn #-205
+inc L25
+cmp *r6, #-203
+L324: dec *r3
+L325: .data -577, 139, 505, 258, 744, 716
+prn L511
+L326: inc *r1
+L327: jsr L79
+cmp *r1, r7
+jmp L574
+L328: mov L442, r5
+sub #247, *r4
+L329: jsr *r0
+add L386, *r3
+L330: .string "ygd"
+L331: cmp #230, *r1
+L332: clr r4
+cmp L592, r7
+clr *r1
+L333: sub L503, r1
+dec *r1
+
+jmp *r0
+L334: jmp *r2
+L335: red *r5
+L336: mov #228, *r6
+L337: lea L561, *r6
+L338: inc *r6
+L339: inc L548
+not r2
+L340: .data 783, 989, 441, -585, 974, 20
+L341: cmp r0, L182
+bne *r1
+L342: prn #-17
+cmp L198, r6
+L343: jsr L345
+add r4, *r5
+cmp #-122, L570
+inc *r1
+stop
+L344: .string "nazgcunrwdostl"
+sub *r0, *r1
+L345: .data -316, -678, 406, -236, 587, 2
+L346: sub #251, L541
+cmp #-256, r7
+L347: sub *r0, r4
+L348: mov #34, L398
+L349: .data 453, 598, 343, 543, -997
+L350: .string "qekbcdzchfamxghppawbzoao"
+L351: inc *r6
+L352: prn r5
+L353: bne *r0
+L354: rts
+L355: lea L514, *r6
+cmp L133, L212
+L356: red r3
+L357: .data -489, -547, -177, -452
+L358: .string "frvmqevqskcubunyizompbfk"
+mov r4, L128
+bne L433
+L359: sub r3, *r5
+L360: .string "wrfgisuffenxafrgtqjdd"
+L361: cmp *r0, *r0
+; comment
+lea L130, r5
+bne *r7
+L362: .string "pxspvqghhcgcfaxjok"
+sub #212, L63
+L363: not *r3
+L364: red r6
+L365: add *r7, L300
+L366: stop
+add *r6, L491
+L367: inc L128
+L368: bne L167
+jsr L212
+L369: prn L596
+L370: prn #-109
+L371: dec *r4
+add *r0, *r4
+stop
+L372: prn L352
+L373: not L384
+L374: lea L263, L578
+L375: jmp *r6
+rts
+L376: jmp L571
+L377: not *r2
+mov *r4, r4
+L378: lea L300, r7
+L379: red *r5
+L380: dec L347
+L381: dec *r7
+not r3
+L382: dec L154
+L383: jsr L131
+add r4, *r3
+L384: not *r5
+add #74, *r4
+inc r7
+L385: sub #-18, r6
+prn r0
+cmp #231, L358
+lea L303, r7
+L386: not *r0
+lea L390, r3
+L387: mov #216, *r7
+L388: clr *r2
+bne L477
+jmp L480
+clr *r4
+L389: .string "tgtgyvysymr"
+
+jmp L498
+L390: jsr L430
+stop
+L391: prn r4
+L392: mov *r0, r5
+L393: not *r6
+add L481, L197
+jsr *r1
+L394: add L569, L410
+L395: sub #-18, *r0
+L396: dec r6
+
+L397: rts
+L398: .string "tqcicqppbaeqpiogmoxwt"
+L399: jmp L525
+L400: clr *r3
+L401: .string "hfrkgwpcqdpwwasmfk"
+L402: dec L251
+L403: rts
+L404: mov #114, *r3
+inc L481
+clr r0
+L405: sub L594, L455
+bne *r0
+L406: clr L144
+L407: mov L171, L119
+
+L408: .string "ldihilfhewuvm"
+jsr L45
+L409: .string "taeywtczascehpbwqbtbo"
+L410: clr r7
+L411: mov #127, r0
+L412: .data 636, 652, 998, 510, 127
+inc *r5
+clr r2
+L413: rts
+L414: prn L566
+L415: sub L516, *r0
+L416: jsr L457
+cmp L3, #-172
+L417: .data -629, 733, -328
+L418: not r6
+L419: sub r3, L521
+L420: red r2
+prn *r5
+L421: add #-55, L409
+L422: dec L205
+L423: inc *r2
+L424: prn r7
+L425: jmp L471
+; comment
+clr *r2
+clr r4
+L426: dec L226
+L427: prn r3
+; comment
+mov L339, r0
+rts
+L428: .string "xsesgcxovhmjilq"
+L429: rts
+L430: bne L553
+clr *r4
+L431: cmp #-33, #-29
+prn *r0
+
+dec *r0
+L432: .string "yv"
+L433: .string "nzs"
+sub #-23, L586
+L434: dec *r3
+clr L307
+L435: bne *r7
+; comment
+jmp *r2
+not L575
+L436: rts
+L437: not r1
+rts
+L438: prn L152
+L439: jmp *r2
+L440: jsr L470
+L441: .string "oemiatsbrofclqdr"
+prn r1
+L442: mov *r4, L564
+L443: add r2, *r4
+L444: add *r6, r7
+L445: clr L585
+dec *r0
+L446: .data -822, 931, 578, -837, -413
+L447: stop
+L448: sub *r5, *r5
+L449: mov L588, L462
+L450: clr *r4
+rts
+L451: dec *r7
+mov r2, L320
+L452: red *r2
+stop
+L453: stop
+L454: prn r2
+L455: jmp L92
+bne *r5
+L456: .string "ghawabcmnkrmvsq"
+L457: sub L544, *r1
+; comment
+L458: prn *r2
+L459: .string "nzdjvpixvgzj"
+L460: not *r5
+L461: jsr *r4
+L462: add r6, r1
+L463: dec L355
+clr *r3
+add L465, *r3
+L464: cmp #-167, *r1
+L465: red *r5
+L466: .string "buttyiysymycn"
+L467: red *r0
+rts
+L468: red L69
+rts
+L469: cmp r2, r1
+cmp L192, #-210
+L470: inc r5
+L471: not *r3
+mov L479, *r0
+sub #-210, r1
+rts
+jsr L198
+
+mov #-150, *r6
+L472: stop
+L473: inc r6
+L474: .string "zabmmdwatrdqkxjmf"
+L475: add #-213, r4
+L476: .string "pl"
+lea L5, r5
+cmp #214, *r6
+stop
+mov #-210, *r1
+jsr *r5
+stop
+L477: jmp *r2
+inc L589
+L478: add *r4, L394
+L479: jsr L571
+L480: sub r5, L588
+L481: inc r5
+L482: add r0, r6
+rts
+L483: bne L577
+L484: .string "lgb"
+not *r4
+
+lea L457, *r2
+L485: .string "euxvj"
+L486: dec *r7
+add *r1, L582
+jsr L519
+L487: .string "cohrdrrgthidxkxkfp"
+L488: clr *r5
+L489: rts
+L490: not r2
+inc r3
+L491: .string "cuotyexsklvpo"
+L492: mov r1, r4
+L493: add r3, r1
+L494: .data -37, -61, -529, 841, -20, 951, -811, -934
+L495: .string "kefoebssdtidjv"
+stop
+lea L563, L563
+L496: cmp #160, #-248
+rts
+
+L497: mov *r1, *r1
+
+inc r1
+L498: stop
+prn #-56
+L499: mov *r5, L207
+L500: lea L538, r7
+L501: clr *r3
+L502: jmp L587
+stop
+stop
+add r2, r2
+jmp *r7
+
+dec L94
+not *r5
+L503: mov *r1, r2
+L504: dec *r3
+L505: stop
+L506: lea L553, r7
+L507: rts
+add L508, *r6
+L508: jsr *r2
+lea L572, r5
+bne L473
+L509: bne L588
+L510: rts
+dec *r1
+not L496
+L511: jsr L524
+L512: .string "b"
+stop
+
+
+L513: cmp L418, *r4
+L514: mov L437, r7
+L515: jsr L108
+mov r5, *r7
+L516: .string "wgmnypmmhavezqiinuqpeo"
+L517: jsr L595
+; comment
+bne L188
+L518: inc L567
+L519: prn #148
+lea L574, r4
+inc r2
+; comment
+L520: .string "bywzp"
+L521: not L563
+L522: add #-161, *r3
+add #151, L352
+dec L564
+L523: jsr *r6
+L524: inc *r7
+mov L547, r5
+L525: mov #7, r3
+rts
+L526: .data 528, -250, -475, -865, 439, -180, 774, 252
+L527: red *r4
+L528: sub *r6, *r4
+L529: jmp *r1
+L530: red *r7
+not *r0
+L531: clr r3
+L532: mov #-137, *r1
+clr L225
+L533: .data 50
+L534: clr *r5
+L535: prn #81
+lea L587, L503
+L536: not *r2
+L537: prn #150
+L538: .string "lamtmstteufqgaz"
+rts
+bne L112
+L539: cmp *r4, #103
+inc *r0
+L540: prn *r2
+L541: .string "wdcivdsrhyho"
+L542: inc L593
+L543: add r1, r5
+cmp #97, L565
+not L573
+jsr L250
+L544: jsr L580
+stop
+L545: .data 9, 658, -691, 105, 827
+L546: not *r3
+prn *r1
+dec r3
+stop
+L547: jmp *r4
+rts
+L548: lea L21, r4
+L549: clr *r1
+
+L550: .data -684, -598, 516, -742, 168, 297
+L551: inc L588
+L552: stop
+cmp L587, *r1
+L553: jsr *r1
+L554: cmp L595, #109
+L555: bne *r5
+L556: clr r3
+L557: .string "qnlesaxbgmfhspendfbii"
+L558: clr r7
+L559: jsr L222
+L560: sub L467, *r6
+L561: cmp *r7, #215
+clr *r1
+not L212
+L562: red *r3
+L563: bne L290
+L564: cmp #109, #189
+L565: .string "qxxbpthqgmzofeeqpm"
+L566: sub *r0, r2
+L567: cmp r7, #-172
+L568: prn #167
+prn *r6
+L569: red *r0
+L570: add r3, *r0
+L571: .data -561, 258, -545
+mov L597, r0
+L572: clr r2
+L573: mov *r3, *r6
+L574: bne *r3
+rts
+jmp *r2
+red *r2
+not r3
+bne *r1
+add *r1, L155
+inc L591
+jmp *r6
+sub L581, *r0
+sub L149, L580
+prn *r2
+prn r4
+L575: .data 384, 439, 398
+red r0
+L576: .data -320, -696, -560, -651, 70, -88, -488, 97
+L577: not r1
+L578: jmp *r6
+L579: sub r2, L504
+L580: .data -856, 13, -921, -589
+L581: sub L598, r0
+jsr L321
+L582: mov r5, r1
+L583: red *r2
+L584: inc r5
+L585: not L597
+dec *r6
+L586: bne L593
+not L590
+bne L204
+L587: rts
+L588: not *r6
+L589: .data -545
+L590: lea L129, r4
+L591: clr L581
+L592: lea L593, r5
+L593: not r6
+red L344
+clr r6
+L594: rts
+lea L80, *r6
+L595: cmp #-177, r2
+bne *r1
+red L530
+L596: inc L167
+add #-242, r3
+add L597, r1
+L597: red r7
+; comment
+bne L337
+clr r0
+L598: inc *r0
+stop
+lea L306, *r0
+jmp *r3
+stop
@@ -0,0 +1,1041 @@
+; Generated by genCorpus --seed 10
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+.entry L144
+.entry L160
+.entry L176
+.entry L192
+.entry L208
+.entry L224
+.entry L240
+.entry L256
+.entry L272
+.entry L288
+.entry L304
+.entry L320
+.entry L336
+.entry L352
+.entry L368
+.entry L384
+.entry L400
+.entry L416
+.entry L432
+.entry L448
+.entry L464
+.entry L480
+.entry L496
+.entry L512
+.entry L528
+.entry L544
+.entry L560
+.entry L576
+.entry L592
+.entry L608
+L0: rts
+cmp L0, L0
+inc L0
+L1: jmp *r7
+L2: stop
+L3: .string "aooopas"
+dec L558
+L4: inc r6
+L5: stop
+L6: not L0
+L7: .string "civynodb"
+prn L0
+L8: not r6
+L9: add #-157, r0
+L10: jmp *r1
+L11: inc r1
+L12: rts
+jmp *r5
+prn r2
+stop
+bne L83
+stop
+add r7, L7
+not r2
+jsr *r0
+not r5
+rts
+L13: dec L128
+L14: lea L2, L294
+not L260
+L15: clr *r5
+L16: clr L110
+
+L17: red r7
+L18: rts
+mov r7, r0
+L19: dec r4
+L20: cmp L567, r6
+jmp L349
+mov #-54, *r2
+add *r3, L594
+not r2
+L21: add L106, L108
+L22: cmp #18, *r4
+L23: jsr *r1
+jsr *r2
+L24: not r6
+L25: dec r5
+L26: prn r3
+L27: prn r6
+L28: .string "xucbusjzy"
+L29: sub r5, r2
+L30: cmp #-143, L28
+L31: jsr L434
+L32: mov L1, r6
+jmp *r7
+jsr *r6
+L33: red *r1
+; comment
+L34: clr r0
+L35: clr *r2
+L36: rts
+L37: jmp L546
+L38: .data 123
+L39: prn L38
+L40: lea L249, *r3
+L41: rts
+inc L37
+stop
+L42: mov r7, r7
+L43: add #14, L329
+L44: bne L21
+L45: inc *r1
+red r5
+L46: stop
+bne L402
+L47: lea L3, r4
+L48: add *r3, *r3
+sub *r6, L41
+L49: lea L132, *r6
+L50: .string "ljsvhhjmnpy"
+L51: mov r2, L295
+L52: add L33, *r4
+L53: prn *r4
+add #106, L563
+L54: cmp #-50, *r1
+lea L144, L360
+rts
+L55: clr *r1
+L56: .string "kzrqkkg"
+L57: sub L20, r3
+mov *r0, *r1
+L58: stop
+L59: jmp L10
+L60: jsr L429
+L61: inc *r4
+L62: .string "azhlukgfel"
+L63: .data 555, -308, -110, 675
+L64: mov L306, *r2
+L65: sub *r7, *r5
+L66: sub L411, r2
+L67: clr r3
+L68: jsr L3
+; comment
+L69: lea L575, r6
+L70: prn *r4
+L71: cmp L25, *r4
+L72: not r0
+sub *r4, *r2
+mov L50, r1
+L73: bne L209
+L74: .string "anyfdtbfnxqztdgxbfkf"
+L75: inc L473
+L76: bne *r1
+L77: cmp #-212, *r2
+L78: .string "anehdranwkmdrzvlvo"
+clr r5
+L79: inc *r2
+L80: sub L6, *r7
+L81: not r3
+prn r3
+L82: cmp r3, #77
+L83: clr r4
+L84: stop
+L85: .string "agvywanipquexkqh"
+L86: .string "ztmxjpenuzrsbdzepdmqdew"
+lea L3, *r0
+L87: dec *r6
+clr L594
+jmp L154
+L88: prn *r3
+L89: .string "drwumf"
+L90: stop
+; comment
+L91: add #-110, *r0
+L92: jsr L307
+lea L235, r3
+dec *r6
+L93: sub *r3, L50
+
+cmp r5, L40
+add *r5, *r7
+L94: lea L584, *r2
+L95: cmp *r0, #155
+prn r6
+L96: prn L56
+L97: stop
+jsr *r6
+red r0
+L98: .string "oyrtothgbjipzbdmk"
+add L65, *r3
+L99: jmp L25
+L100: red r4
+clr *r2
+add r6, L126
+L101: .data 384, 277, 615, 146, 413, -694, 413, -644
+; comment
+mov r0, L42
+L102: rts
+L103: lea L138, *r1
+L104: dec r0
+add #60, r1
+L105: clr L56
+cmp #23, r6
+; comment
+L106: lea L192, *r1
+L107: dec r0
+not r4
+L108: jsr L305
+L109: rts
+L110: jmp L604
+L111: stop
+L112: add r3, L62
+L113: not *r1
+
+red *r3
+L114: add *r7, r7
+L115: mov r6, L568
+L116: jsr *r6
+L117: .string "dlp"
+lea L9, L140
+L118: inc *r7
+L119: inc *r5
+L120: jmp *r3
+clr r3
+lea L90, r2
+
+L121: dec *r2
+L122: bne L582
+bne L64
+L123: prn *r7
+L124: .string "tkejpqlnmrrvciv"
+L125: red *r6
+cmp L25, r4
+red L111
+rts
+L126: stop
+L127: red *r5
+add r1, r6
+bne *r2
+L128: sub #-5, r6
+L129: .data -427, -636, -731, 412, -40, -533, -923, -724
+L130: stop
+clr r1
+dec L412
+L131: jsr L118
+add L520, r6
+L132: .data -965
+mov *r7, *r6
+
+L133: red r2
+prn L301
+L134: dec L32
+clr r5
+L135: stop
+L136: clr r0
+sub r0, r2
+L137: .data 428, 906
+L138: .data 53, -28, 957, 144
+L139: bne *r6
+add L279, r2
+L140: sub #-136, *r2
+L141: lea L451, L517
+sub r7, *r3
+clr L113
+L142: sub r5, r1
+L143: prn L76
+L144: mov *r1, L117
+jmp L224
+clr r6
+L145: .data 957, -673, -674
+L146: inc L447
+add r5, L474
+L147: sub L186, *r6
+sub L13, L90
+bne L120
+L148: .data -563
+L149: dec *r7
+L150: prn #54
+L151: jsr *r4
+L152: .data -942
+L153: red *r0
+L154: jmp L188
+lea L106, *r7
+L155: sub *r6, r1
+L156: red r1
+prn r6
+
+L157: bne *r3
+prn *r5
+L158: prn r7
+dec r2
+cmp #30, r1
+L159: lea L428, L42
+cmp L232, r6
+
+L160: .string "vhjnaxdplglrnpdzg"
+; comment
+L161: inc *r1
+dec L83
+L162: jsr L316
+not r1
+inc r1
+cmp #-39, #-59
+L163: .string "knmniqzwhdlc"
+mov *r2, r0
+add #-216, L135
+L164: sub #-186, *r3
+add *r2, L169
+L165: .string "zsmkemizaexcpitqrazhfpb"
+L166: bne L255
+bne L229
+jmp L427
+L167: inc L292
+L168: inc L323
+sub L514, *r1
+not r2
+clr L78
+red L35
+L169: cmp *r3, r4
+lea L94, *r1
+sub L228, r3
+clr L366
+L170: stop
+bne *r7
+bne L247
+L171: jsr *r3
+L172: rts
+cmp L67, #199
+L173: lea L543, L615
+L174: not L348
+L175: jsr L604
+L176: add r4, L220
+L177: add r4, r2
+L178: rts
+L179: mov r1, L221
+L180: cmp r3, #147
+sub L301, *r6
+clr *r5
+mov *r2, L104
+mov L278, r1
+L181: dec L17
+
+L182: not r7
+L183: sub #-167, L342
+L184: inc L490
+prn L71
+add *r4, *r0
+red *r7
+L185: dec L558
+jmp *r5
+L186: red *r0
+L187: .string "svfisgbekw"
+sub L82, L119
+jmp *r7
+L188: inc L79
+L189: .string "hdgarnarktfnfacly"
+rts
+; comment
+L190: prn *r6
+rts
+add r5, *r4
+L191: clr L203
+L192: jsr L147
+L193: rts
+prn #134
+L194: bne L555
+L195: red r1
+L196: clr r0
+stop
+L197: clr r4
+L198: add #20, r6
+L199: not *r4
+L200: mov *r3, L183
+L201: rts
+add r7, r0
+L202: stop
+stop
+L203: red *r6
+mov r6, *r1
+mov #-45, *r0
+L204: .string "orkukq"
+L205: not *r5
+
+L206: add L130, *r5
+L207: rts
+L208: clr L156
+cmp L469, r2
+L209: prn L582
+L210: clr L55
+red r0
+L211: .data 794, -331, 465
+lea L481, L113
+L212: red *r3
+L213: red r5
+jsr L193
+L214: prn #67
+L215: lea L200, *r4
+L216: jsr *r3
+L217: sub r7, *r3
+L218: cmp r1, *r5
+L219: mov #-208, *r6
+L220: red L89
+sub r7, *r3
+L221: cmp #-149, r4
+L222: dec *r3
+L223: bne *r5
+L224: inc *r6
+add r4, L123
+inc r2
+not *r4
+L225: jsr L453
+L226: .data 785, 887, 845, -517
+L227: stop
+not *r0
+red *r0
+L228: .data 668, 934, -267, 386, -554, 314
+L229: inc L124
+L230: .data 594, -236, 476
+sub #105, *r3
+L231: clr *r0
+prn r2
+jmp L430
+L232: prn r3
+L233: sub L456, *r6
+rts
+sub L544, *r4
+L234: .data 266, 746, 501, -947, -700, 756, -650, -855
+L235: red L530
+L236: bne L438
+L237: prn *r4
+
+L238: not r2
+
+lea L509, r1
+not r2
+; comment
+add #200, r2
+L239: lea L243, *r6
+L240: jsr *r4
+L241: jmp *r1
+
+L242: not L87
+mov r6, r2
+jsr *r0
+L243: prn *r4
+L244: stop
+L245: clr *r0
+clr r6
+jmp L238
+add r0, r2
+L246: not r6
+; comment
+L247: rts
+L248: lea L279, *r3
+prn #-181
+L249: jsr L64
+L250: .string "ystmnzibfkkzdrapmz"
+L251: bne *r4
+L252: jsr L134
+L253: bne L7
+L254: dec L415
+L255: lea L264, *r5
+add L117, r7
+L256: rts
+L257: lea L438, *r7
+L258: inc L531
+
+L259: red *r6
+L260: add r3, *r2
+L261: .string "cdoipefzc"
+add *r3, L163
+sub r6, L165
+L262: dec L185
+L263: red r0
+L264: mov r2, *r1
+L265: bne L22
+mov L273, r1
+L266: jsr L345
+L267: .string "ajkvgcptywcuudnttuxkqkb"
+L268: .data 830, -31, 323, 794
+L269: prn r2
+L270: not L158
+rts
+L271: .string "race"
+L272: .string "mxbhqzqbaatyabufblwfr"
+L273: jmp *r2
+L274: lea L70, r2
+L275: .string "pzbxgflsrbcbmoc"
+bne *r6
+mov #247, L298
+L276: dec L569
+L277: cmp #-223, #28
+L278: cmp L425, *r7
+L279: clr r4
+L280: cmp L497, r0
+
+L281: .string "kfcrtztmzoeoozyhczfdu"
+not r1
+prn L457
+L282: not *r4
+L283: .string "nbffbdsuixxc"
+
+sub #-7, L127
+not L70
+L284: sub #-107, *r5
+L285: inc r5
+L286: red r0
+L287: rts
+L288: cmp r3, #84
+L289: inc *r0
+L290: not L231
+clr *r6
+red L147
+inc L146
+jmp L451
+L291: jsr L211
+; comment
+rts
+L292: add L46, r7
+jmp L201
+L293: lea L10, L35
+L294: red r5
+L295: clr L187
+L296: bne L574
+add *r7, r2
+L297: inc *r2
+L298: cmp L33, *r0
+L299: dec L445
+L300: inc *r7
+not *r3
+prn r4
+L301: .string "fpgy"
+L302: not r4
+L303: .data 765
+stop
+jsr L27
+L304: lea L27, *r2
+; comment
+L305: .data 799
+L306: rts
+sub r5, r4
+L307: rts
+sub L498, r3
+L308: stop
+lea L164, *r4
+L309: sub L71, L94
+L310: jmp *r5
+jmp L85
+mov L577, r2
+L311: jmp *r1
+L312: dec *r6
+L313: clr *r3
+clr r1
+add #-136, *r2
+L314: inc L593
+L315: .data -759, -239, -937, -360, -831
+L316: red *r3
+L317: dec L311
+L318: sub *r6, r4
+jsr *r1
+L319: red *r2
+jmp L542
+add *r4, L276
+L320: .data 77
+L321: not *r1
+L322: .data -528, 196
+L323: jmp *r6
+not *r3
+L324: sub L218, r7
+L325: inc L115
+L326: clr *r0
+cmp L193, r0
+L327: mov #-53, *r3
+L328: cmp #-39, r1
+stop
+L329: .string "bfgiry"
+L330: jsr *r1
+L331: red *r7
+L332: lea L128, L469
+L333: dec *r2
+L334: dec L470
+L335: .data 62, 274
+jsr *r4
+red L433
+L336: red L436
+prn L365
+add r1, L457
+L337: inc L89
+not L117
+lea L295, *r4
+sub #140, L496
+L338: jsr *r7
+inc *r5
+L339: lea L94, L594
+L340: inc r5
+L341: red *r3
+inc *r7
+L342: .string "wqibvnlzmidnuwbw"
+L343: jsr *r7
+jmp L269
+L344: bne *r5
+L345: dec r3
+L346: lea L466, *r0
+L347: .data -183, -957, -382, 306, 498, 66, 329
+red L327
+lea L250, *r3
+L348: .data -825, -216, 719, 180, -970
+mov *r6, L420
+L349: .data 65, -904, 536, 812
+red *r7
+rts
+L350: sub *r2, r7
+dec r2
+L351: mov *r5, r0
+jsr L606
+lea L390, r2
+L352: not r3
+inc r0
+L353: stop
+L354: jsr *r1
+L355: dec r5
+L356: jsr *r7
+; comment
+L357: dec *r0
+L358: cmp r1, *r2
+L359: prn L477
+not r1
+L360: lea L570, L160
+L361: prn #242
+L362: stop
+L363: jmp L24
+L364: sub *r5, r0
+cmp r1, L486
+L365: clr r1
+add r5, r5
+prn r1
+L366: dec *r4
+L367: cmp #-72, r5
+; comment
+L368: .string "nnrhqouxvjjy"
+clr *r7
+rts
+L369: not r6
+L370: not r3
+add *r1, L548
+L371: jsr *r4
+L372: .string "rldgodryagilkckbpncco"
+L373: .data -529, 731, 782, -869
+L374: lea L346, L442
+cmp L407, *r0
+L375: add #191, r2
+L376: lea L497, L397
+L377: .data 515, -433, -48, -260
+prn *r5
+rts
+L378: rts
+L379: sub *r1, r1
+L380: stop
+lea L387, L48
+clr L495
+add #-40, L423
+L381: jmp L478
+L382: .string "pdwaarlvlirfybdckuc"
+L383: .data -609, -822
+add #-160, L208
+sub *r4, r4
+clr *r6
+sub r3, *r1
+sub L167, *r7
+L384: rts
+L385: jsr *r6
+dec r6
+L386: jmp L91
+L387: not L493
+jsr *r2
+stop
+L388: lea L38, *r5
+L389: red *r3
+L390: .data 613, 780, 697, 874, 620
+L391: stop
+; comment
+inc *r4
+lea L496, r2
+L392: rts
+L393: red r0
+L394: .data 789
+L395: jmp *r1
+L396: red *r4
+; comment
+L397: jsr L24
+L398: not L613
+L399: cmp *r7, r5
+L400: red r6
+L401: lea L111, L371
+L402: dec r3
+L403: clr L324
+L404: not L41
+add #24, r6
+
+L405: jmp L221
+L406: jsr L42
+L407: cmp r5, r3
+L408: inc *r6
+L409: rts
+L410: jsr *r0
+rts
+add *r0, L5
+L411: prn *r6
+L412: not r3
+L413: jsr L527
+L414: .string "jsq"
+sub r5, L339
+rts
+L415: lea L481, r6
+red *r5
+L416: .data -826, 163, 933, 820, -79, 740
+rts
+rts
+L417: jmp *r3
+clr r7
+sub L590, *r7
+L418: .string "owjvwbawpdfkxdx"
+jmp L477
+dec L540
+L419: jsr *r1
+rts
+L420: dec L562
+inc *r2
+prn #-233
+L421: rts
+L422: mov L325, L47
+L423: rts
+L424: add L483, L543
+stop
+L425: .string "cxqkgytkqtq"
+L426: .data 251, 838, -969, 212, -682, -585, 328
+L427: clr *r3
+L428: inc L238
+L429: cmp *r3, L234
+L430: prn L66
+L431: dec L525
+L432: .string "waegohltqjactemaf"
+L433: jsr *r5
+L434: prn r3
+L435: dec r1
+L436: lea L489, r7
+L437: mov *r7, L41
+add *r7, r5
+L438: dec r4
+dec r5
+red L472
+L439: mov L396, L291
+L440: .string "mhujfqiqopcjtoolelxesxxw"
+L441: cmp #-47, r1
+L442: stop
+; comment
+inc r3
+L443: add *r5, L292
+L444: bne *r0
+L445: lea L353, r7
+L446: clr *r5
+L447: jsr *r3
+jmp *r5
+L448: red L478
+L449: .string "dedvymfjscrb"
+clr r6
+L450: .string "wygekoi"
+bne *r2
+L451: dec r3
+L452: .data 291, 209, 902, -968
+L453: .data 126, 771, 487
+bne L506
+L454: cmp L52, #-239
+clr r7
+sub *r1, L124
+L455: cmp L565, L2
+L456: stop
+L457: .data 593, -431, -92, -155, -704, 997
+L458: red L196
+dec *r4
+stop
+L459: stop
+not r5
+bne L159
+L460: inc r1
+L461: cmp r6, #-141
+clr L474
+L462: prn #144
+bne *r0
+prn *r7
+dec r3
+not L531
+inc r6
+
+clr *r1
+mov #237, L592
+red r0
+L463: .data -694, 623, 149
+jmp L549
+L464: mov r3, L233
+not L509
+L465: dec r7
+L466: dec *r7
+L467: dec L594
+L468: dec r2
+L469: clr *r7
+L470: sub r0, *r4
+L471: bne *r7
+L472: jmp L530
+L473: rts
+stop
+jsr *r6
+lea L553, r4
+jmp L515
+L474: jmp L233
+not r2
+L475: inc r4
+stop
+L476: cmp r2, r1
+dec *r3
+inc L583
+jsr L79
+bne L547
+bne *r1
+lea L582, *r7
+L477: stop
+; comment
+L478: prn *r1
+L479: prn L444
+L480: red *r4
+L481: prn #-119
+
+L482: mov r0, r7
+clr *r3
+L483: jmp L94
+L484: .data -1000, -344, -179, 427, 582, -804
+mov L551, L547
+L485: sub L34, *r2
+red L510
+L486: jmp L492
+L487: stop
+L488: stop
+L489: dec *r5
+L490: rts
+L491: dec L457
+cmp #170, #90
+L492: jsr *r0
+L493: inc r0
+red r1
+L494: not *r0
+dec r1
+
+L495: clr *r0
+clr *r7
+L496: sub L614, r0
+L497: sub r3, *r0
+L498: sub L164, r0
+L499: red L104
+L500: rts
+L501: dec r0
+
+L502: .data 902, 78, 331, -325
+
+lea L60, L275
+L503: add r0, *r0
+L504: rts
+L505: stop
+L506: red L598
+stop
+jsr *r6
+L507: lea L309, *r0
+L508: .data -795
+jsr *r0
+L509: sub #-161, *r3
+L510: clr r3
+L511: jsr L517
+L512: not L544
+not r4
+dec L494
+rts
+L513: red r5
+L514: cmp #-199, L75
+sub L579, r1
+L515: .string "flfousa"
+; comment
+red r0
+lea L591, *r1
+; comment
+red r4
+L516: not r4
+L517: bne *r4
+cmp r0, L554
+L518: clr *r0
+L519: cmp *r2, #-98
+L520: lea L589, *r4
+L521: .data -322, 216
+mov r7, L601
+L522: stop
+L523: .string "wizkuaqiviwlvygppnweslp"
+L524: prn #43
+L525: bne L546
+L526: stop
+L527: red L371
+L528: dec r7
+bne L571
+L529: rts
+L530: mov r7, L65
+L531: not r4
+
+L532: jsr L564
+bne L601
+L533: cmp L586, #-37
+jsr L62
+inc *r5
+L534: .string "cgsu"
+L535: mov *r0, *r6
+bne *r5
+L536: .string "chmnjzcrifjc"
+
+L537: sub #242, r3
+jsr L548
+L538: jmp L80
+L539: cmp #-144, L487
+L540: rts
+L541: jmp L576
+red r6
+L542: red *r2
+sub #-251, L588
+L543: jmp L309
+L544: rts
+not *r0
+L545: .string "jgqcsobsbfpnyoroysa"
+clr L579
+L546: rts
+L547: lea L583, r1
+lea L553, r6
+rts
+L548: .data 237
+L549: .string "tvmzexwteb"
+L550: mov #49, r2
+L551: dec *r6
+L552: prn #11
+L553: rts
+L554: cmp *r3, *r5
+L555: .string "zdc"
+red r2
+L556: mov L38, r1
+L557: clr L593
+L558: rts
+L559: red r0
+L560: bne *r6
+L561: .data 128, 56, 671
+not *r4
+jsr L613
+prn L591
+L562: prn L142
+jmp *r0
+L563: mov #-158, r1
+stop
+L564: dec *r2
+
+L565: add #-177, *r3
+L566: .string "mgdmkt"
+L567: .data 356, -748, 890, -755, 874, 400, -220
+L568: rts
+dec *r3
+L569: .string "ndumddjzmsqemnakwkybix"
+L570: cmp #42, L338
+bne L318
+rts
+L571: jsr *r0
+not r4
+L572: add r5, r5
+red r6
+L573: inc L48
+L574: stop
+inc L474
+L575: sub *r5, L594
+L576: .data 412, 439, -965, 788, 992, -335, 623
+L577: red *r6
+dec r2
+stop
+sub r0, *r7
+clr L313
+L578: .string "vnwht"
+L579: cmp r4, r1
+L580: .data -801, 925, 481, -792, -128, -372, 679
+L581: sub *r5, *r4
+L582: not L219
+L583: sub *r7, r1
+prn *r0
+L584: jmp L607
+jsr *r5
+L585: clr *r5
+cmp #47, #227
+L586: jmp *r6
+; comment
+clr *r2
+L587: prn L238
+L588: stop
+jsr L260
+L589: prn *r7
+L590: cmp #30, L611
+L591: not r6
+L592: jsr L602
+inc r6
+inc r2
+L593: .data 140, 351, -214, 782, -500, 478
+L594: cmp *r2, r4
+L595: jmp L614
+L596: lea L478, L195
+L597: jmp *r0
+L598: jsr *r4
+L599: .data -524, 752, -725, -281
+jmp L118
+L600: bne *r7
+L601: jmp L610
+jmp L320
+L602: .data -811, -215, 900, -202, -713
+L603: prn r4
+bne *r0
+L604: lea L609, *r1
+lea L179, *r4
+
+L605: dec r2
+L606: jsr *r0
+L607: dec *r7
+L608: clr L612
+L609: rts
+lea L533, r1
+L610: rts
+L611: lea L96, L453
+L612: inc *r5
+rts
+L613: inc r1
+rts
+L614: lea L615, *r7
+L615: cmp r5, #128
+prn L384
+stop
@@ -0,0 +1,571 @@
+; Generated by genCorpus --seed 1
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+macr m0
+    jmp L100
+    red r7
+    not r7
+    mov r3, r3
+    add #82, *r2
+    jsr L87
+    inc r6
+    red L112
+    rts
+    inc *r7
+endmacr
+macr m1
+    jsr L25
+    mov r2, r4
+    jsr *r3
+    rts
+    red *r1
+    jsr *r7
+    mov #142, *r6
+    jmp *r5
+    sub #237, L17
+    dec *r2
+endmacr
+macr m2
+    not r3
+    prn *r2
+    sub r2, L14
+    clr *r5
+    cmp *r4, r5
+    cmp r0, #-158
+    red *r7
+    lea L45, r5
+    add #190, L100
+    jmp L31
+endmacr
+macr m3
+    mov r4, r1
+    not r1
+    sub L18, L9
+    inc *r0
+    jsr L4
+    jsr *r5
+    sub r4, *r2
+    clr r0
+    rts
+    cmp r5, r0
+endmacr
+macr m4
+    clr r0
+    dec L2
+    prn #80
+    lea L77, r7
+    dec L14
+    clr r4
+    add #109, *r5
+    prn L106
+    red r5
+    jsr L84
+endmacr
+dec L7
+L0: .data -912, -82, -897, 275, -434, -786, -623
+red *r0
+prn L0
+m3
+m0
+inc r2
+L1: prn *r5
+m2
+stop
+
+m3
+inc *r4
+L2: .string "vbzisrkxlgnrseuatv"
+L3: sub r7, *r5
+mov #136, r6
+rts
+prn *r0
+L4: .data 215, 589, -735, -777
+prn #77
+inc L1
+dec *r1
+stop
+m0
+m3
+bne L16
+L5: add L0, L83
+dec *r4
+dec L2
+
+stop
+prn L6
+not *r6
+L6: not *r0
+sub #249, L34
+L7: not L56
+sub L1, *r5
+rts
+lea L96, r5
+m3
+m4
+L8: dec L7
+clr *r3
+L9: add *r2, r3
+jsr *r4
+inc r6
+bne L5
+L10: .data -476, 927, -216
+m2
+red L0
+m0
+L11: cmp r3, L96
+L12: .string "mbdyjsgvsikitaq"
+jsr *r5
+red *r1
+
+m2
+m4
+jsr L7
+L13: dec *r0
+bne L6
+sub L28, r3
+L14: add r6, *r6
+L15: .string "g"
+dec r7
+inc r4
+rts
+clr r7
+sub r7, *r2
+jsr *r4
+bne *r5
+cmp L15, #15
+L16: jsr L4
+jmp *r1
+L17: red L1
+bne L71
+m4
+L18: mov *r3, *r7
+m1
+L19: lea L86, r4
+m2
+L20: .data -314, 671
+mov L17, L112
+bne *r7
+cmp #-40, L49
+jsr *r7
+bne *r1
+L21: mov L3, r5
+sub *r1, *r0
+m3
+not L15
+lea L3, r6
+sub *r5, r0
+prn #-221
+add L0, r6
+inc L65
+L22: .data -914, -926, 191, -623
+L23: .data 974, 394
+mov #-210, r5
+clr r7
+mov r1, *r7
+m1
+red r0
+jmp L57
+jmp L10
+L24: not r0
+m4
+inc *r4
+L25: .data 683, 392, 451
+mov *r5, L14
+m2
+inc r1
+L26: cmp #-179, L47
+L27: .string "lirjljtfolehtrm"
+L28: bne *r6
+jsr L6
+L29: lea L57, *r0
+lea L104, r2
+sub L118, *r3
+m2
+m0
+jmp L103
+lea L81, *r2
+sub *r3, r7
+L30: sub r6, r2
+clr *r4
+add r5, L6
+; comment
+cmp r0, *r4
+
+L31: inc r4
+mov #-23, r1
+add *r1, r2
+L32: inc L1
+L33: jsr L45
+red r7
+rts
+jmp *r1
+inc *r0
+m0
+clr L85
+L34: jsr L15
+lea L60, L55
+m1
+rts
+L35: .string "hptmclqoinywxpdxaspp"
+jsr *r1
+L36: .string "txfjcavkxfaahjz"
+m4
+mov r1, L1
+not r7
+; comment
+L37: rts
+L38: bne *r1
+stop
+prn r1
+not L2
+m2
+clr L80
+jmp L72
+m0
+jmp L56
+clr *r0
+L39: .string "lbvzlizgpfrt"
+m3
+m4
+add #198, L107
+bne *r6
+dec *r6
+lea L90, *r6
+m0
+L40: .data 64, 550, -988
+L41: bne *r7
+rts
+m0
+L42: not L24
+bne L63
+prn #-79
+m3
+red r7
+cmp r4, #172
+bne *r6
+jmp L0
+L43: mov L112, L70
+jmp *r7
+L44: inc r3
+clr L79
+L45: red *r7
+cmp L24, r5
+inc L65
+rts
+L46: .data 727, -197, -749, 753, 802, -180, -874, 264
+stop
+prn *r4
+L47: .data 942, 724, -225, -42, -177
+prn #-157
+L48: stop
+L49: jsr *r4
+L50: .data -301, 325, -927
+dec r1
+dec L86
+bne L37
+L51: .data -587, 403, -633, 31, -917, 412, 177, -563
+L52: jmp *r6
+inc *r5
+prn r7
+cmp #-108, #-130
+L53: .string "wgtiqbzxlqpnqgr"
+L54: bne L12
+clr *r7
+inc *r3
+m0
+jmp L92
+L55: .data 298, -116, -220
+m4
+L56: .data 788, 84, 160, 901, 767, 254, -583, 281
+cmp #115, #107
+L57: .data 617, 94, -358, 126
+clr L21
+cmp *r7, *r6
+not *r0
+inc L100
+rts
+sub r7, *r3
+bne L125
+jsr L46
+stop
+m1
+sub L113, r0
+m3
+L58: mov L5, *r1
+mov *r1, r5
+L59: bne L78
+cmp *r6, #64
+L60: mov #221, r3
+L61: stop
+bne *r1
+prn *r6
+m2
+m3
+L62: red r6
+cmp r4, #153
+L63: .data 766, 758, 343, 675
+L64: jmp L85
+L65: .data 126, 179
+L66: jsr *r2
+mov *r4, L11
+; comment
+red r0
+bne *r6
+L67: .string "nnhsxxvecpja"
+sub r3, L102
+L68: lea L126, r0
+L69: not *r5
+clr *r3
+L70: .data -17, 25, -198, -687
+L71: cmp #61, r0
+prn #55
+clr *r3
+m3
+add #175, r4
+L72: inc *r3
+
+L73: .string "j"
+mov #-190, *r0
+m4
+stop
+L74: sub r3, r2
+m3
+prn r1
+clr L97
+clr L55
+bne L82
+lea L128, L26
+m0
+L75: .string "zqgw"
+L76: jsr *r1
+L77: .data -556, 348, -580
+jsr L9
+cmp L85, #-189
+L78: not r6
+rts
+clr r2
+m1
+prn r6
+; comment
+m0
+L79: .string "weizzjyqgyy"
+L80: cmp r5, r0
+m4
+rts
+mov L95, L105
+not *r3
+m4
+jsr *r0
+bne *r1
+add *r1, L85
+mov r4, *r5
+L81: .string "gynxjxniqvdnxmke"
+m4
+jmp L53
+bne *r4
+L82: rts
+L83: .data -418, -269
+m0
+L84: cmp #94, r5
+m2
+m1
+mov r0, L99
+clr r3
+bne *r1
+dec r0
+L85: .string "gtntlmci"
+dec *r0
+cmp r2, L94
+m1
+m1
+L86: .data 924, -111, -783, 156, -394, -257
+bne *r0
+m2
+L87: stop
+lea L17, L86
+m3
+m1
+not *r4
+stop
+m4
+L88: .string "hwkkomtqhgpaxmol"
+sub *r2, r4
+clr *r4
+prn *r7
+m0
+m4
+prn r3
+L89: dec *r3
+bne L65
+jmp L86
+clr r3
+rts
+prn r1
+stop
+L90: lea L36, r3
+bne *r6
+L91: not *r5
+m2
+sub r1, L94
+m1
+m2
+mov *r7, L2
+; comment
+lea L39, r7
+L92: .data -399, 325, -103, 662, -274, 465, -383
+jsr *r5
+inc L111
+prn r1
+L93: .data -987
+jmp *r3
+m3
+m2
+add *r6, *r4
+inc r2
+sub L76, L110
+m0
+L94: cmp #228, L111
+not L72
+m0
+L95: .data 482, 716, -847, -652
+red L18
+bne L109
+m3
+m3
+jmp L20
+
+
+L96: lea L102, L101
+L97: .string "m"
+
+m1
+m0
+mov *r6, r6
+dec L79
+L98: .data 426, 72, -786, -488, 531, -701, 786, -626
+L99: clr r6
+L100: lea L118, L130
+dec r6
+dec r6
+L101: jmp *r5
+jsr *r4
+m2
+m3
+L102: .string "fpftcmpqug"
+
+mov *r5, *r1
+cmp r3, L105
+lea L125, L104
+add r2, *r6
+add r3, r1
+L103: add L111, r2
+m4
+L104: .string "kiulrfmnpxfgxrstwemvegx"
+bne L127
+m2
+lea L69, L129
+lea L112, r7
+m0
+m2
+clr *r7
+L105: sub #39, *r3
+L106: red *r7
+lea L107, L124
+inc L78
+; comment
+not r6
+not L115
+L107: stop
+L108: stop
+rts
+L109: .string "jlhqcmtoctjenbvrx"
+clr r3
+not L131
+jmp L39
+dec r5
+not r5
+m4
+sub r4, r0
+clr L128
+m4
+L110: not r1
+dec L50
+
+m4
+clr *r1
+L111: not *r2
+L112: sub L122, *r6
+L113: .string "tkeojsbtanhjfykasakv"
+add r1, L88
+L114: .data -798, -389, 622, -288, -493, -717, 610
+m3
+L115: .data 950, -408, 916, 477, -804, 215, 641
+not r0
+stop
+L116: prn #-244
+L117: clr *r1
+m2
+L118: .data 891
+prn *r5
+prn #-222
+cmp #36, *r2
+m4
+jsr L114
+prn L27
+m1
+stop
+dec *r0
+jsr L131
+rts
+L119: .string "pgsozhsftq"
+L120: .string "pwxvzsmafzg"
+stop
+cmp *r7, L43
+mov *r5, *r1
+m2
+add *r0, L128
+mov *r4, r0
+L121: .data 351, 308, 48
+L122: sub #-160, L54
+L123: cmp #187, r6
+sub *r2, L8
+clr *r1
+m1
+dec r7
+L124: red L98
+jmp L47
+lea L80, r3
+jmp L79
+not r2
+lea L127, L126
+L125: cmp L129, L129
+red r2
+m0
+stop
+mov #-184, L130
+L126: .string "fufkqix"
+
+L127: cmp *r7, L129
+prn #29
+lea L55, L128
+L128: .data 610, -349, 939, 668, 398, -3
+not L130
+
+sub L131, r7
+L129: .data 524
+L130: .string "ibn"
+m2
+sub r6, r4
+L131: rts
+mov r1, L121
+m0
+m3
+jmp *r7
+stop
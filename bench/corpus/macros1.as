@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 2
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    rts
+    not L1
+    inc r1
+    rts
+    inc *r5
+    not *r1
+    mov r4, r2
+    jsr L36
+    bne L22
+    inc L50
+endmacr
+macr m1
+    dec *r2
+    cmp L3, #82
+    add r0, *r0
+    cmp #-222, #135
+    not *r7
+    mov #233, L121
+    stop
+    clr L38
+    not *r7
+    inc r1
+endmacr
+macr m2
+    dec *r1
+    rts
+    cmp #-180, *r0
+    rts
+    red r2
+    sub *r3, *r6
+    jmp *r1
+    prn r4
+    jsr L24
+    sub r3, L13
+endmacr
+macr m3
+    dec L15
+    lea L52, r7
+    red L77
+    dec r3
+    dec L104
+    not r7
+    sub #-6, L14
+    prn r7
+    bne *r1
+    bne *r2
+endmacr
+macr m4
+    cmp r4, *r2
+    add *r6, r6
+    prn #224
+    jsr L8
+    not *r2
+    lea L41, L90
+    lea L51, L48
+    inc *r7
+    cmp *r4, *r2
+    bne *r0
+endmacr
+not L95
+clr r0
+m4
+L0: .string "mhdaanpjg"
+m2
+jmp *r2
+L1: sub #101, r7
+not *r2
+mov r7, *r1
+stop
+not *r3
+rts
+add L0, L0
+m2
+
+L2: .data 890, 757, 265, -563
+clr *r0
+L3: dec L2
+L4: stop
+
+inc *r7
+clr L0
+L5: inc *r3
+m3
+jsr *r5
+m0
+mov L7, L3
+m2
+L6: cmp *r6, #98
+; comment
+clr L29
+inc r1
+m0
+prn #49
+mov *r4, r2
+L7: prn *r1
+add *r6, *r2
+add *r1, L3
+red *r4
+lea L29, r3
+L8: rts
+L9: clr r3
+bne L59
+jmp *r7
+prn *r3
+lea L7, r5
+L10: .string "xzpbshwafwcmxkdjuwyqghwk"
+L11: dec L5
+jsr *r4
+L12: add #99, L95
+jmp *r0
+prn *r0
+jmp *r2
+bne L9
+jmp L117
+L13: cmp L66, r4
+clr *r7
+L14: .string "fyirixwjgkdhlgnhhrzjyn"
+clr *r6
+L15: .data 854, -588, 405, 399, -379
+inc L112
+rts
+L16: .string "tbsbbjlorrprcpr"
+mov *r0, *r6
+L17: .string "nedgpslqwpvom"
+m1
+; comment
+inc L58
+m0
+L18: .string "jvsonwqbuwfukfiyq"
+cmp *r6, #196
+bne *r5
+add #-85, *r7
+add #250, L11
+jmp L3
+not r4
+m3
+cmp L11, r1
+lea L11, L60
+L19: .data -97, -568, 445, -515, 185, 951, 160
+clr L55
+L20: rts
+red L14
+L21: not r6
+jsr *r4
+jmp *r6
+L22: .string "m"
+L23: prn L6
+rts
+
+L24: sub *r1, r5
+sub L109, r6
+inc r6
+red L24
+lea L6, *r7
+jmp *r7
+inc L58
+L25: .data -277, 929, 736, -890
+inc L97
+cmp L120, *r5
+L26: .data 330, 618
+mov r0, *r5
+stop
+
+m3
+rts
+m2
+L27: .string "kyaciveujwpsxur"
+m1
+sub *r5, *r3
+add r1, r7
+sub #-131, L28
+cmp r2, *r1
+jsr *r6
+m2
+
+sub #-240, L7
+L28: .data -921, -369, 319, 352, -506, 626, 88, 244
+L29: prn L31
+jsr *r3
+bne *r7
+jsr *r0
+mov r7, L103
+jmp L6
+L30: sub #67, *r0
+clr r7
+L31: mov #55, L14
+red r4
+m0
+jmp L36
+L32: .data -690, 67, 536, 894, -645
+L33: .data 602, 56, -457
+inc r3
+jmp *r5
+red r1
+m1
+L34: stop
+rts
+m3
+L35: clr L74
+L36: stop
+rts
+inc *r1
+inc *r7
+red L20
+add #201, *r5
+L37: stop
+add L72, r5
+jmp L56
+m2
+add *r4, *r0
+lea L7, *r4
+rts
+m3
+L38: not r2
+L39: .string "doozciuzgv"
+L40: lea L26, *r4
+bne *r1
+cmp *r3, *r4
+m1
+m1
+not L69
+not L5
+L41: sub r0, *r4
+jmp L9
+L42: sub #240, *r2
+mov *r1, L13
+bne *r5
+clr *r3
+sub *r6, L46
+; comment
+add *r0, L84
+m4
+not L7
+bne *r2
+add r5, *r6
+L43: .string "pumqzuvkvmltvioiy"
+m1
+m1
+m2
+sub r4, *r4
+add L99, r7
+L44: .string "sgypbiscipjnsjdishla"
+prn L85
+jsr L3
+lea L36, r4
+lea L108, *r2
+jsr L16
+L45: .data 36, -850, -540
+L46: clr r5
+rts
+jmp L83
+lea L24, *r0
+L47: .data -818, -275, -868, -996, 280, -956, -389, -45
+dec *r4
+L48: cmp #-214, r1
+m1
+m0
+L49: jmp L83
+L50: jmp *r5
+sub #-220, L102
+jsr L32
+mov L98, r7
+rts
+inc L66
+rts
+m1
+cmp *r4, #196
+L51: red r4
+lea L88, *r6
+mov *r0, *r4
+m0
+m3
+rts
+L52: lea L22, r1
+m0
+m3
+m1
+m0
+jmp *r6
+m3
+dec *r0
+L53: jmp *r3
+L54: prn *r3
+not L84
+sub #-183, r3
+m2
+L55: jsr L96
+m3
+prn L32
+prn L35
+m3
+L56: .string "izf"
+L57: .string "pgplnklcqtgznhh"
+L58: clr *r1
+L59: jsr L43
+jsr *r2
+; comment
+L60: .data 571, 519, 646
+cmp r1, r5
+jsr L64
+red r0
+rts
+sub r6, *r7
+m0
+jmp L10
+rts
+mov r3, r3
+m4
+not L61
+jsr L32
+L61: .string "lycidd"
+m3
+L62: stop
+bne *r4
+L63: .string "jrjnvkqbowof"
+jmp *r1
+L64: red *r3
+red *r6
+m3
+m2
+L65: .string "iqlykdndinmkiwiay"
+m3
+clr *r4
+L66: not *r3
+m4
+L67: jsr L69
+rts
+add #-215, L91
+jmp *r0
+L68: .string "wzpnpyaqhyqmvkba"
+inc L119
+rts
+L69: .data 187, -356, -332, 369, -276
+not *r0
+jsr L95
+prn L31
+L70: dec L78
+cmp #192, r3
+L71: clr *r1
+inc r6
+m1
+red r1
+L72: .string "ofngkrkbiywtoomwnds"
+m1
+L73: cmp L22, L78
+inc r0
+jsr *r4
+not *r6
+L74: bne *r6
+rts
+m1
+cmp *r2, L39
+dec *r3
+L75: .string "axr"
+mov *r1, r3
+not *r0
+jmp L49
+rts
+not r2
+add *r0, r0
+clr *r0
+rts
+L76: lea L99, *r2
+jmp *r3
+L77: stop
+L78: lea L12, *r6
+inc r4
+m2
+m4
+L79: .data 899, 158, -369, 461
+lea L60, L1
+L80: cmp *r3, *r0
+bne L75
+prn #-195
+rts
+jsr *r1
+m0
+rts
+sub *r1, r1
+rts
+
+L81: add *r5, *r6
+L82: lea L43, *r4
+m0
+stop
+L83: .data 661
+; comment
+inc L99
+prn #36
+inc r7
+m4
+m2
+stop
+not L31
+L84: add #-134, L98
+red *r4
+stop
+lea L111, *r0
+L85: sub L45, r5
+stop
+L86: prn r5
+not L118
+rts
+cmp L73, r2
+dec r3
+L87: stop
+jmp *r5
+m2
+L88: .data 622, -422
+lea L89, L112
+m4
+not L101
+clr L104
+L89: clr r7
+cmp L86, #-182
+m1
+L90: .data 489, 396, -283, -908
+L91: jmp L110
+cmp r2, r0
+stop
+jsr *r5
+m0
+stop
+rts
+dec L21
+dec L104
+
+stop
+L92: mov *r6, r7
+L93: stop
+cmp r1, *r6
+bne *r4
+mov r2, L111
+add #-44, r1
+m0
+L94: mov #-85, *r0
+L95: sub #66, L111
+not r6
+dec L103
+add r3, r3
+jmp L102
+m2
+L96: prn r0
+bne *r5
+L97: red r7
+stop
+cmp *r4, L65
+lea L89, r0
+jmp *r2
+m0
+bne L105
+jmp L122
+m1
+L98: clr L8
+L99: prn *r7
+cmp r6, L43
+L100: jsr *r6
+add r3, *r6
+m1
+m2
+not *r6
+L101: not *r2
+rts
+L102: clr r6
+inc *r4
+L103: not r3
+L104: jmp *r4
+L105: mov #73, *r7
+rts
+not r1
+L106: lea L108, L108
+stop
+sub r4, *r1
+cmp #219, #-225
+L107: .string "kbh"
+jmp L18
+rts
+L108: .string "ccqcyumygmmpazfpq"
+m1
+m3
+L109: .data -220, -557
+prn #26
+L110: lea L38, *r1
+red r3
+lea L113, *r3
+sub r6, r7
+jmp L22
+add r1, r5
+lea L111, L122
+mov *r0, *r7
+cmp L119, r7
+L111: inc L113
+m0
+L112: .data 369, -263, -313, 313, -170
+bne L113
+; comment
+bne *r2
+inc r6
+m0
+prn #90
+L113: .data 210, 925, 435, 861, -111, -214, 743, -582
+L114: dec *r3
+bne *r7
+red L58
+add L122, *r2
+
+L115: add #180, r2
+bne *r7
+cmp r3, L122
+m2
+m2
+L116: .data -878, 327, 179, -416, -664, -813, -914, 75
+L117: .string "odulcueohyerwlxmg"
+red L115
+rts
+m4
+bne L37
+mov *r2, L122
+inc r4
+L118: .data -420, -462, -172
+m3
+m4
+L119: jsr L83
+mov *r2, r1
+cmp L89, #-180
+m4
+jmp L89
+; comment
+sub #-52, L120
+
+red L100
+L120: .string "mxoqkwvcuu"
+m1
+L121: .string "kavpmyhg"
+
+jmp L122
+clr L122
+jsr *r6
+mov #-212, L4
+not r0
+bne *r4
+not *r5
+; comment
+m1
+mov #-201, r7
+stop
+cmp #220, *r5
+m0
+m0
+jmp *r5
+m2
+m3
+cmp *r5, L39
+m3
+lea L119, r7
+L122: jmp *r7
+prn *r6
+bne *r3
+
+stop
@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 11
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    mov L29, r2
+    red *r7
+    red *r6
+    sub *r4, *r1
+    jsr *r1
+    dec L24
+    jsr *r2
+    jsr *r5
+    sub L82, L29
+    jmp *r5
+endmacr
+macr m1
+    bne *r7
+    jmp *r5
+    jsr L97
+    add *r0, *r2
+    prn L22
+    dec L51
+    lea L75, r4
+    inc L37
+    jmp *r4
+    not L98
+endmacr
+macr m2
+    not *r3
+    jsr L0
+    prn *r4
+    rts
+    inc r2
+    red *r6
+    rts
+    not L15
+    dec *r6
+    dec r2
+endmacr
+macr m3
+    inc *r1
+    lea L0, r3
+    red *r4
+    red L96
+    jmp L11
+    clr r1
+    red r7
+    rts
+    inc *r0
+    clr *r2
+endmacr
+macr m4
+    clr r0
+    sub r7, r1
+    not L63
+    lea L84, r3
+    lea L34, L39
+    bne L10
+    lea L27, r7
+    red L63
+    add L39, r0
+    lea L72, L44
+endmacr
+sub #61, *r3
+jmp L70
+dec r6
+sub #156, *r5
+dec r3
+m3
+clr *r6
+cmp L45, L80
+m4
+dec *r6
+stop
+not r0
+L0: add #-131, L0
+cmp r6, r0
+dec L0
+L1: .string "rfqxxc"
+prn r2
+
+add #8, r4
+red L1
+lea L0, *r3
+jmp *r0
+
+L2: .data -315, 210, -796, 128, 685, -225
+not r0
+L3: clr *r4
+
+
+L4: add #-232, L62
+L5: rts
+L6: .data -994, -999, -557, -726, -696, 330
+inc r5
+cmp *r2, *r0
+lea L91, L1
+rts
+rts
+jmp L65
+rts
+lea L85, L4
+rts
+jsr *r3
+red r7
+red L27
+clr L4
+add #-125, L8
+m1
+m0
+L7: jsr *r7
+L8: add L68, L101
+not L66
+
+m1
+m2
+
+rts
+jmp L0
+lea L2, L0
+red r3
+m1
+
+m1
+L9: .string "j"
+prn *r4
+L10: stop
+jmp L23
+L11: jmp *r7
+L12: .string "azxt"
+stop
+m4
+cmp *r2, #-65
+stop
+m3
+m0
+inc L5
+mov L100, *r2
+jmp *r4
+prn r5
+bne L11
+m4
+
+prn r5
+m2
+lea L8, *r4
+inc r6
+dec *r4
+L13: clr L11
+add L12, L9
+stop
+lea L87, L24
+m3
+rts
+lea L58, r2
+L14: inc r1
+rts
+m4
+mov #59, L4
+m1
+m1
+sub *r7, *r2
+jmp *r1
+add #-46, L82
+L15: .string "olff"
+clr L14
+cmp #-73, r1
+; comment
+m2
+L16: .string "pllvqgrahnru"
+sub *r0, r6
+not r2
+jmp L10
+L17: red L106
+inc r6
+jmp *r6
+L18: cmp L5, #63
+bne L7
+jmp L38
+lea L13, *r1
+m1
+red r2
+m3
+m1
+clr *r7
+stop
+m0
+dec L14
+L19: prn *r6
+L20: .data -466, 547, 733, 589, -695, -633, -466, -521
+L21: jsr L27
+L22: .data -809, -617, 694, -771, -777, -844, 327, -507
+rts
+stop
+L23: rts
+L24: .string "hgngwwdnbuhumsnpk"
+L25: .data 373, 70, -174, -743, -661
+red r1
+sub L3, *r3
+sub r5, r4
+L26: .string "ywkwz"
+inc *r5
+L27: .data -292, 459
+L28: rts
+prn #126
+L29: jsr *r5
+not *r1
+m1
+L30: dec *r2
+L31: mov #-201, r3
+L32: .data 473, -294, -784, -470, -394, -234, -79
+m3
+not r0
+m4
+m4
+m4
+sub r7, r5
+jmp L19
+L33: inc *r5
+dec L10
+L34: .data -520, -888, 504, 392, 212
+lea L35, *r1
+L35: rts
+not L11
+mov L77, L87
+L36: .string "tbdjrtuveyhrblomgybm"
+L37: prn *r6
+m2
+prn r2
+red *r5
+add *r4, r4
+
+sub r1, r1
+inc r7
+prn #-70
+jmp L8
+cmp #180, r0
+m1
+m1
+red *r7
+stop
+m4
+m1
+lea L56, r1
+L38: jsr *r0
+m1
+cmp L71, *r6
+inc r0
+prn *r0
+sub r3, *r6
+add *r0, r0
+L39: .string "rqvvowbhzrjigfmqrvsqno"
+bne *r0
+rts
+sub #119, r7
+L40: .data 450, 144
+m1
+jsr *r0
+clr L107
+L41: .data 624, 39, -40, 35
+L42: stop
+L43: cmp r1, *r2
+not r2
+stop
+m4
+m4
+lea L11, L76
+red *r4
+jsr L98
+m2
+L44: .string "qwrgrbw"
+prn *r0
+
+m1
+not r1
+L45: clr *r2
+add L30, L102
+m3
+add #-69, r3
+cmp r1, #-194
+dec L70
+m3
+L46: .string "vhnupaldxuqlggoxdlwrgt"
+prn #-212
+cmp r0, r1
+mov r4, r7
+mov #-142, L82
+m3
+rts
+cmp *r0, *r0
+not r1
+jsr L0
+inc L93
+not *r7
+clr r4
+jmp L2
+L47: mov *r1, L1
+not L83
+clr L73
+sub #-173, L92
+stop
+prn r4
+L48: cmp *r4, r5
+L49: .string "dnpywxuvemerhopthjtfe"
+cmp *r4, r2
+jsr *r6
+lea L31, *r2
+L50: .data -728
+mov #212, *r0
+L51: not *r4
+prn *r1
+m1
+m0
+add L7, r6
+jsr *r5
+stop
+jsr L61
+m2
+bne L13
+m2
+L52: .string "uxerqjftdkhf"
+L53: dec r7
+dec r0
+m4
+inc *r4
+stop
+L54: prn L95
+m4
+prn #-128
+inc L13
+L55: rts
+jmp L49
+L56: lea L27, L37
+L57: .data 258, 925, -80
+L58: add L34, r1
+stop
+L59: prn r0
+jmp L19
+; comment
+m4
+L60: .string "zjkkuahvqeqiaubrtqrls"
+jmp *r3
+lea L43, r2
+inc r3
+lea L24, r4
+
+clr L69
+mov *r4, r4
+L61: not *r3
+L62: .string "vjurauzk"
+rts
+not L70
+L63: .string "wnepzjbiotlachvswzeccjvs"
+clr L18
+L64: jmp *r7
+m3
+L65: .string "bkcqzvhrm"
+L66: add L84, r2
+clr r3
+m0
+L67: not r0
+stop
+dec r7
+L68: dec *r0
+jsr *r0
+dec *r3
+m4
+clr r2
+rts
+prn *r5
+m3
+lea L74, *r3
+add *r4, r5
+bne *r0
+m1
+m3
+m1
+red L103
+lea L64, *r1
+
+L69: lea L91, L18
+lea L74, L61
+lea L85, r5
+L70: .data -539, 382, 664, 293
+inc L99
+m2
+jmp L61
+red *r7
+red L60
+rts
+clr r5
+inc L48
+jsr *r7
+inc r2
+prn *r2
+sub r3, r4
+stop
+L71: jsr L48
+; comment
+jsr *r6
+rts
+add *r3, r1
+m1
+red r7
+cmp r3, L69
+m0
+mov L86, r6
+L72: .string "jnyrtw"
+dec *r0
+m4
+rts
+lea L20, r1
+m1
+jmp *r6
+m4
+
+bne *r4
+not *r2
+add L18, r0
+L73: .string "sqrmcsrtmjgqvmjfic"
+L74: .string "ix"
+jsr *r4
+L75: add *r4, r6
+m0
+m3
+prn L55
+lea L86, *r4
+clr L84
+L76: .data -683, -761
+m0
+m2
+m1
+m1
+not *r1
+; comment
+inc r5
+m3
+cmp L78, #26
+stop
+dec r1
+inc *r7
+L77: .string "rwlxvwfjgdv"
+L78: lea L96, r7
+m3
+cmp r4, r5
+L79: .string "nfuccglgvesjkvruzynmwf"
+add *r7, *r6
+m4
+jsr L102
+jsr L45
+
+m4
+
+stop
+inc r5
+stop
+m3
+L80: cmp #52, r6
+m3
+cmp *r7, L22
+
+m0
+m4
+mov *r2, r6
+red L96
+jsr *r7
+m3
+L81: lea L16, r7
+lea L82, r2
+rts
+jsr L107
+red *r2
+m4
+m4
+jmp L85
+prn *r6
+clr r4
+bne L83
+red r0
+m0
+m3
+L82: bne *r3
+rts
+L83: prn #213
+sub #-66, L71
+L84: cmp *r3, r4
+L85: dec *r3
+bne *r1
+lea L84, *r3
+mov L53, *r2
+jsr *r1
+L86: .string "xgbhvtrgtrjauqhvgnr"
+L87: rts
+bne L93
+L88: .data -376, -958, -101, 629
+cmp r1, *r7
+clr L65
+L89: .data -56, -193, 447, 239, -406
+lea L16, L100
+stop
+m0
+jmp L0
+lea L101, *r2
+L90: .string "ijtapsrgmycxb"
+L91: .string "djtbejpxvxhqzzhrfkdkk"
+dec r7
+rts
+L92: .string "wianuqkazrudakpsapmludm"
+add r5, *r2
+not *r5
+m4
+jsr L56
+L93: mov #94, *r5
+prn *r4
+m4
+L94: mov #170, L35
+L95: add #48, r2
+dec L76
+L96: lea L21, L8
+rts
+stop
+rts
+jmp L99
+L97: bne L98
+stop
+L98: rts
+stop
+L99: inc r4
+not L106
+m1
+jmp *r7
+L100: .data -529, -963, 744, -891, 197, 741, -48
+add #215, L52
+m3
+m3
+jsr L104
+m0
+rts
+inc r0
+m4
+bne L107
+prn L54
+inc r0
+jmp L96
+sub #117, L105
+m1
+L101: .data -631, 486
+L102: .data 649, 345, -924
+prn *r0
+m4
+L103: .string "aubznldgga"
+not r2
+clr r1
+L104: jmp *r4
+jsr L105
+L105: .string "iykxqucqxlqhpgdamdj"
+L106: .data -101, -36
+m4
+lea L107, r0
+lea L107, r4
+L107: rts
+; comment
+mov *r3, *r7
+stop
@@ -0,0 +1,571 @@
+; Generated by genCorpus --seed 101
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+macr m0
+    add r1, *r1
+    add #-153, r2
+    sub *r2, *r5
+    inc r3
+    red r5
+    red *r4
+    mov *r2, r0
+    jmp *r0
+    inc *r3
+    not L107
+endmacr
+macr m1
+    clr r0
+    stop
+    inc L17
+    sub L71, r3
+    not r6
+    dec r7
+    dec r7
+    jmp L22
+    jsr *r5
+    prn L48
+endmacr
+macr m2
+    prn #-51
+    jsr *r2
+    lea L35, *r3
+    red *r6
+    prn L93
+    dec r4
+    inc *r7
+    stop
+    not *r7
+    stop
+endmacr
+macr m3
+    clr L55
+    inc r4
+    dec *r4
+    jsr L3
+    bne *r2
+    sub r5, r4
+    sub #146, *r2
+    sub #70, L65
+    clr L59
+    prn r4
+endmacr
+macr m4
+    cmp #126, r4
+    clr L81
+    add *r5, *r5
+    stop
+    lea L66, *r4
+    jmp *r6
+    inc *r0
+    mov #183, r0
+    prn *r2
+    stop
+endmacr
+inc r1
+cmp #-83, L54
+m0
+L0: clr r1
+; comment
+stop
+L1: add r6, r7
+L2: jsr L127
+L3: .data -632, 675, -722, 397, 923, 385, -941
+jmp *r1
+L4: inc r6
+m2
+rts
+jmp L115
+L5: lea L25, r5
+jsr L43
+add L72, L95
+red *r5
+m0
+stop
+not L3
+jmp L3
+m4
+m0
+inc r6
+cmp *r2, *r7
+L6: lea L5, L0
+; comment
+not L4
+L7: .string "mpb"
+lea L2, L46
+L8: .string "wbadvcxdmx"
+sub r2, *r7
+m1
+prn #-165
+L9: not L97
+add L1, *r6
+red L114
+sub #181, L5
+stop
+L10: prn #-236
+not r4
+dec L0
+red L2
+L11: red *r0
+not L3
+L12: .string "jhsaesgzkbuimtg"
+L13: .data -813, -809, -463, 721, 147, -680
+L14: .string "wtyhalmjblkbmcjvwpkwftxl"
+; comment
+L15: dec *r3
+lea L32, L9
+mov #-28, r6
+not *r6
+L16: .data -424, 821, -712, -485
+jmp *r6
+jsr L90
+m3
+clr *r0
+L17: prn r3
+L18: stop
+m0
+add L17, r5
+rts
+prn *r5
+mov L9, r7
+
+bne *r1
+m4
+m4
+mov L30, r5
+L19: jmp *r4
+cmp #-227, r4
+L20: .string "dkkqnlzhj"
+m1
+m0
+L21: .string "wgxhu"
+L22: .data 867, 223, -45, -6, -186, 653, -793, -992
+L23: mov r3, *r2
+jsr *r7
+L24: jsr *r2
+m4
+clr L9
+L25: .data 343, 242, -577, 87, 385, -905, -787, -21
+bne *r1
+cmp r1, #-16
+L26: .string "mmmpmgxjbgtmwrnovkabcgqo"
+lea L8, *r4
+jmp L10
+m1
+sub *r2, r0
+m4
+L27: .data -120
+
+L28: mov #168, *r4
+jmp L22
+dec *r2
+L29: .string "pspfwpyymcqcpo"
+sub L21, r4
+prn r5
+L30: mov #205, *r7
+add *r1, r4
+L31: bne L108
+bne *r2
+
+dec *r6
+m1
+lea L30, L31
+; comment
+
+L32: inc r4
+clr *r0
+L33: lea L119, r7
+m0
+bne *r3
+L34: .string "uzwijexekrpb"
+L35: mov r4, r3
+prn L30
+m2
+red L87
+inc r2
+L36: prn #-25
+jsr *r6
+L37: clr *r7
+L38: clr r4
+jsr L14
+L39: .string "zupmkprqzzwzwvlknjkxj"
+jsr L21
+sub r0, r1
+sub *r2, *r1
+L40: not r7
+m0
+mov L16, *r2
+not r3
+L41: .string "t"
+rts
+m3
+not *r2
+bne *r5
+sub #65, r0
+L42: .string "yxvnillnesgsiq"
+jmp *r0
+L43: add #84, L99
+; comment
+sub r1, L108
+clr *r2
+stop
+m4
+m2
+m3
+red L5
+cmp #-222, L7
+L44: jmp L106
+rts
+m1
+; comment
+L45: .string "enzeayhlefvbroi"
+jmp *r0
+clr r2
+L46: lea L68, r2
+L47: bne *r5
+not r5
+L48: bne L47
+cmp L33, L15
+jsr *r3
+m2
+dec r0
+stop
+sub #90, r6
+L49: .data 729
+m0
+
+L50: .data 949, 948, -465, -561, -715, 605
+dec r4
+sub L116, r6
+sub r2, r5
+L51: mov r3, L76
+
+L52: .string "ujubbvugn"
+; comment
+L53: .string "oqdxbl"
+m2
+m4
+mov #108, L15
+L54: .string "xsuawrtxmncmkvknsgov"
+mov #108, r3
+inc r6
+m4
+clr r6
+clr *r0
+clr r5
+jsr L22
+L55: stop
+L56: .data -701, 367, -114, 300, -988, -761, -397
+m2
+mov #-213, *r3
+L57: stop
+clr L39
+m1
+add r2, L47
+m3
+dec r2
+L58: jsr L55
+lea L120, r4
+L59: sub L42, r5
+inc *r7
+L60: .data -746, 450, -354, 777, -256, -524, 229, 610
+dec *r5
+stop
+L61: .data -541, -185, 879, 899, -242
+L62: .data 642, -382, 436, 856, 438, -230
+dec L28
+
+L63: .string "twcgdybdmjulmknu"
+jmp L51
+not L40
+sub #-167, L121
+L64: add L127, L87
+rts
+bne *r5
+L65: bne L56
+m3
+L66: red L63
+sub L128, r3
+dec *r7
+mov L111, L42
+L67: inc r7
+rts
+L68: inc r4
+sub #227, L130
+prn r3
+
+m2
+L69: .string "utlwvczhvlrfinpkgv"
+clr L79
+m1
+rts
+rts
+not r7
+
+add r0, r4
+m2
+m2
+L70: .string "ufvsqecrcx"
+prn r7
+inc L116
+prn L78
+m3
+L71: .string "yc"
+add r6, *r1
+bne L78
+jsr L24
+rts
+bne *r0
+L72: sub *r2, *r0
+L73: cmp #191, r5
+L74: prn #209
+cmp #96, *r7
+jsr L94
+L75: .data 52, 960
+; comment
+; comment
+clr L46
+bne L0
+bne *r1
+cmp L76, L84
+prn #168
+sub r6, L104
+m0
+lea L112, L107
+; comment
+L76: clr *r1
+L77: lea L101, r4
+jmp *r0
+add #4, r7
+L78: stop
+L79: add #218, L124
+; comment
+m4
+m2
+mov *r6, r1
+red L98
+lea L128, *r0
+stop
+m2
+cmp *r4, *r6
+rts
+L80: add L85, L8
+mov #121, L15
+cmp *r5, r0
+inc L12
+lea L57, *r2
+L81: .data -957, -418
+sub r2, *r1
+add r1, L76
+m4
+cmp *r5, *r6
+inc *r7
+m0
+m4
+L82: red r4
+L83: .string "anicaneqblllehkearsgq"
+mov L120, r7
+cmp #238, #-170
+L84: .string "bszkyj"
+m1
+L85: .string "ajxphhbicevf"
+bne *r4
+rts
+red r5
+m2
+jsr L90
+L86: inc r7
+stop
+add r2, *r5
+L87: .string "efhrofzyaixjwc"
+m2
+; comment
+m1
+L88: not r1
+bne *r2
+L89: .data -63
+rts
+mov #-253, r0
+red r1
+L90: .string "vnbfefqsppeuif"
+dec L41
+add *r7, *r0
+cmp L113, #108
+cmp r7, *r7
+clr L25
+sub #-84, L93
+clr L84
+L91: add *r4, r7
+clr r2
+L92: bne *r3
+stop
+m4
+add *r1, r6
+dec *r0
+cmp r3, #159
+; comment
+; comment
+lea L78, L124
+; comment
+stop
+lea L109, L96
+m4
+stop
+lea L97, *r4
+jmp L63
+add r4, *r6
+L93: .string "xzcjeplb"
+L94: .string "qpwyyxyr"
+cmp r3, L1
+dec L124
+jmp L108
+inc L125
+not *r2
+L95: .string "aodebefwgunmfosmggbpr"
+jmp *r0
+cmp #-162, L21
+L96: not L63
+jmp L15
+m2
+mov L14, L75
+sub *r0, r1
+m2
+dec r0
+not r5
+m1
+; comment
+not r7
+; comment
+jmp *r0
+dec *r6
+
+L97: stop
+m3
+L98: .string "xrjjgsyrbaemuiloxxq"
+cmp r2, #249
+m1
+jmp L129
+red r2
+stop
+L99: .data -696, 719, 389, -356
+L100: jmp L109
+m4
+mov #126, r0
+prn #-250
+L101: cmp r2, #122
+m0
+add *r6, L36
+L102: .string "hilrmppgwrhlducdanjp"
+m2
+lea L24, r2
+; comment
+red *r7
+m4
+L103: prn L63
+L104: jsr L37
+m4
+L105: .data -181, 603, -399, -220, -544, -760, 424, 158
+sub *r4, *r3
+L106: clr *r1
+L107: add r4, L112
+rts
+bne *r5
+L108: rts
+m0
+L109: rts
+rts
+sub r0, L59
+cmp r7, *r1
+m2
+m0
+mov *r3, r4
+L110: clr r4
+L111: lea L127, L130
+L112: .string "quxbipvigxsdvoqrwdyxhrzb"
+add L124, L120
+m4
+m0
+jsr L124
+L113: .string "chxjhthnyjmlaqfio"
+stop
+mov L32, L63
+L114: sub L51, L118
+bne *r6
+prn r1
+
+m3
+add L19, *r2
+jsr L55
+stop
+cmp L118, L97
+cmp r6, *r5
+sub #-153, r1
+; comment
+not r7
+sub L32, *r3
+m0
+mov *r3, L11
+L115: add *r0, L122
+jsr L131
+L116: not L55
+lea L119, r7
+m2
+m0
+cmp #-19, *r0
+not *r4
+L117: .data 966, -550, -791, -143, -593, 164, 314, 606
+clr *r5
+L118: cmp L1, r1
+m0
+mov *r1, *r2
+L119: add #-197, r2
+L120: jsr *r1
+mov #98, L22
+mov #-103, L71
+m3
+jsr L125
+L121: .string "mohjclcqk"
+L122: .string "huluzwstt"
+dec r6
+rts
+L123: rts
+; comment
+sub #-55, *r2
+L124: .data 495, 445
+not *r2
+lea L111, *r6
+L125: dec *r6
+sub L105, L130
+jsr *r4
+; comment
+clr r0
+stop
+jsr *r6
+cmp L38, *r6
+L126: .string "amjcrszisqyqzpt"
+L127: .string "whwjdeqkbfsxuyw"
+m0
+stop
+m2
+m3
+red r0
+L128: .data 789
+L129: not r0
+stop
+m4
+L130: .string "mbi"
+red r7
+stop
+m4
+L131: inc L69
+stop
+clr r3
+add L77, L109
+add L74, L105
+stop
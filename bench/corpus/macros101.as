@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 102
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    add r6, r2
+    inc L82
+    jsr L82
+    jsr L98
+    cmp r6, L11
+    jsr L8
+    sub r1, L40
+    add *r3, r3
+    red r4
+    prn r5
+endmacr
+macr m1
+    rts
+    add #-219, L18
+    stop
+    jsr L74
+    dec r5
+    not L66
+    jsr *r1
+    jmp L80
+    mov #141, *r4
+    jsr *r7
+endmacr
+macr m2
+    red r5
+    red r4
+    jsr *r1
+    inc *r5
+    jsr *r5
+    mov *r5, r6
+    jmp *r3
+    red r0
+    clr *r1
+    mov *r5, *r4
+endmacr
+macr m3
+    lea L84, r4
+    cmp L42, L1
+    inc *r4
+    jmp *r7
+    sub #104, r5
+    add *r4, r7
+    jsr L53
+    dec L80
+    prn *r6
+    prn #58
+endmacr
+macr m4
+    not *r1
+    bne L11
+    red r5
+    lea L99, L79
+    lea L4, L33
+    mov r6, *r4
+    bne *r0
+    jsr L56
+    not r3
+    bne L65
+endmacr
+L0: .string "qhfyfysdbli"
+clr r2
+; comment
+m4
+bne *r1
+L1: mov r4, *r5
+bne L0
+mov L99, L1
+m4
+mov *r3, *r1
+m2
+m1
+; comment
+prn r4
+mov #141, L0
+m0
+L2: clr r0
+dec L77
+m3
+L3: prn r0
+inc L2
+red L25
+m2
+clr r2
+lea L30, L3
+L4: .data -86, -993, -546, -424, 129, -205, -277, 45
+L5: sub r4, *r4
+m4
+m0
+L6: .string "xbquybjkcnlnyjaqj"
+L7: not *r4
+L8: jmp *r7
+m0
+m2
+m2
+m3
+stop
+jsr *r2
+stop
+; comment
+sub L43, r5
+m3
+sub r5, L96
+L9: .string "whhgpyuegmozqdbmnkiz"
+L10: jmp *r6
+L11: .data -224, 398, -833, 831, 198, 389, 444, -890
+m0
+L12: .string "csj"
+dec L29
+dec L1
+m0
+add r0, r4
+m4
+m0
+jmp L9
+L13: jsr *r3
+stop
+jsr L1
+m1
+m4
+red r7
+dec *r4
+not r5
+jmp *r0
+lea L1, *r2
+; comment
+L14: inc L33
+prn #-234
+L15: .string "hsky"
+L16: .string "ojymuuromqxigiclneupcx"
+L17: dec *r3
+inc L32
+L18: .string "rsk"
+m4
+rts
+L19: jsr *r3
+m4
+m2
+L20: rts
+m4
+add L41, r0
+L21: .string "tadqlkycsg"
+m3
+L22: rts
+lea L1, *r7
+m1
+not L18
+m3
+sub r0, L102
+not L4
+add *r3, *r4
+m0
+m0
+rts
+clr r0
+L23: jsr L12
+clr r3
+stop
+m4
+clr *r3
+cmp L21, L104
+mov *r3, *r2
+mov r6, r0
+m4
+L24: .data -881, -658, 714
+L25: .string "jov"
+lea L66, r5
+sub r4, L9
+L26: jsr L104
+rts
+jsr *r6
+L27: not *r5
+mov #-237, r6
+; comment
+clr L90
+red L27
+L28: .data -947, -91, 119, 865
+add L96, L12
+m0
+L29: sub r7, *r3
+jmp L101
+clr L8
+m3
+jmp L47
+clr r2
+clr *r7
+dec r1
+m1
+m2
+m3
+not *r0
+bne *r2
+L30: .data 595
+sub r1, *r3
+L31: .string "wvnzifwkoed"
+L32: jsr L95
+L33: .string "uhuacyaenulqlosvuhoa"
+sub *r4, *r5
+m0
+dec *r2
+L34: sub r0, *r4
+m3
+m4
+m3
+rts
+m4
+lea L20, L57
+m1
+not *r6
+L35: .string "ztdsgmjcpvftykboeehxm"
+add #52, L16
+L36: .string "mzyw"
+m4
+add #122, *r4
+lea L104, *r0
+stop
+dec *r4
+prn L49
+m3
+L37: .data 917, -99, 538, 289, -340, -844
+jsr *r5
+lea L85, r5
+L38: add r4, L44
+L39: .string "eduprtfagdj"
+m3
+
+prn L20
+lea L103, *r0
+inc *r2
+L40: .data -59, -589, 91, -413
+L41: stop
+L42: mov L85, r2
+; comment
+clr r6
+m1
+m1
+clr r4
+lea L52, L97
+L43: .string "fhftbtolbxtmxgaws"
+lea L58, L86
+m1
+L44: stop
+m0
+mov *r1, *r5
+inc r3
+red *r3
+mov r4, L37
+m4
+L45: red r6
+lea L32, r4
+lea L100, L23
+L46: .string "wnp"
+clr L99
+L47: cmp #-249, #13
+not *r7
+mov r6, r3
+prn r4
+stop
+inc r3
+m4
+L48: .string "fnuzwznshuhddf"
+L49: .string "ot"
+bne L41
+rts
+
+m3
+m0
+stop
+L50: rts
+bne L91
+prn *r5
+sub #75, *r5
+stop
+jmp *r7
+; comment
+dec r6
+stop
+dec *r4
+L51: clr *r2
+jsr *r6
+L52: add *r7, *r0
+cmp r5, #-227
+m1
+clr *r4
+L53: add *r6, *r2
+m4
+rts
+m4
+inc L45
+
+sub L6, L65
+m0
+jmp L25
+bne *r4
+prn r5
+m1
+sub r5, L37
+L54: .string "kxncyhzwgtmmpbznguqnur"
+L55: not *r7
+lea L31, *r5
+m3
+not r7
+dec r2
+L56: .data -58, 65
+L57: clr L102
+L58: cmp *r7, #215
+lea L8, *r2
+lea L61, r7
+clr r7
+L59: .data -213, -124, 52, -607, 486
+jsr L99
+m2
+; comment
+prn #135
+red *r7
+lea L56, L70
+; comment
+stop
+prn #-223
+prn r6
+not L73
+L60: prn *r3
+L61: .string "yoxzrobxnkjraqsyxoqtfewf"
+red L23
+lea L88, L11
+dec r0
+m3
+jsr *r3
+m3
+m3
+L62: rts
+L63: cmp L68, *r5
+L64: add *r4, L22
+L65: .data 506
+stop
+mov *r7, r2
+m2
+L66: inc *r0
+
+m1
+m4
+bne L83
+L67: .data 386, -252, 916, -867, 314, 442
+m2
+m4
+add L56, r1
+inc *r7
+cmp #136, *r0
+m0
+not *r2
+rts
+L68: .data -719, -402, 639
+clr *r1
+m2
+clr *r2
+dec L82
+lea L91, r4
+lea L81, *r3
+m2
+add r2, L70
+red L73
+bne *r3
+m3
+dec r7
+m2
+mov r0, *r5
+add #-167, r7
+cmp r7, #67
+m0
+sub *r2, *r0
+clr *r3
+clr *r3
+L69: .string "lp"
+bne *r6
+rts
+m1
+mov *r7, *r3
+m0
+mov r6, r0
+m4
+jmp *r4
+jmp *r7
+rts
+mov r6, r3
+L70: not *r6
+dec r5
+m1
+sub *r3, r4
+inc *r7
+prn #222
+m1
+
+m1
+L71: .string "anjohvzdltwlszajgu"
+dec r3
+m4
+dec L92
+cmp r5, #183
+jmp *r1
+L72: not L58
+L73: rts
+inc L73
+clr *r1
+jmp L83
+stop
+stop
+inc r7
+; comment
+; comment
+L74: add *r2, L22
+prn L77
+L75: jsr L97
+bne *r1
+jmp *r3
+add #-230, L82
+jsr *r6
+
+inc *r0
+m0
+jmp L93
+cmp L56, #35
+jsr L40
+prn L66
+not L77
+L76: dec L96
+m0
+m1
+m3
+L77: add *r6, r4
+L78: lea L102, *r7
+jmp *r7
+bne L58
+lea L102, r0
+L79: stop
+clr *r6
+jsr *r7
+clr *r1
+L80: .data 413, -864, 636, -854, -628
+m2
+prn L69
+L81: .data -287, -589, 570, -806, 549, 847, -747
+rts
+dec r1
+prn r6
+bne L29
+clr r7
+m3
+stop
+jsr L86
+sub L84, *r7
+sub *r5, *r0
+mov r2, r6
+add L78, r7
+jsr L11
+cmp #150, *r5
+m0
+prn #-22
+lea L89, r0
+L82: inc r2
+L83: .data 209
+dec *r6
+L84: .data 464, 260, 365, 668
+mov L96, L85
+not r3
+prn *r0
+sub #-201, r3
+m0
+mov L80, L87
+m0
+red r2
+m0
+m3
+mov *r3, *r0
+lea L88, r2
+m4
+cmp L90, L28
+bne *r4
+; comment
+L85: .data 898, 243, -150, -5, 444, -704
+prn r6
+lea L104, L11
+; comment
+; comment
+jsr *r7
+L86: lea L74, L62
+stop
+L87: .data 658, 283, -955, -133, -949, 872, -833, 506
+m1
+
+bne *r7
+L88: .string "xdlnkkohktkvugfktqvgucw"
+inc *r3
+L89: inc *r7
+L90: add r1, r6
+
+prn r7
+stop
+L91: stop
+clr r5
+not r1
+m4
+bne L98
+m1
+L92: .string "nxpgtlo"
+add *r1, *r2
+clr r6
+m2
+m1
+m3
+clr *r5
+sub #-250, r7
+cmp #123, *r1
+stop
+inc *r6
+prn r0
+jmp L10
+L93: not *r7
+
+lea L104, L98
+bne L82
+L94: clr r7
+m1
+clr r1
+not L102
+cmp r3, r4
+L95: dec L6
+dec L103
+L96: mov r4, L98
+red r4
+m1
+m0
+jmp *r6
+m1
+jmp *r4
+jsr *r5
+m2
+cmp #-226, #31
+L97: stop
+L98: .string "cdzvvcqoukzazx"
+; comment
+m0
+m1
+clr L101
+red L99
+m4
+L99: red r0
+L100: .data 951, 785
+L101: bne L104
+add L87, L104
+jsr *r6
+L102: .string "pcjoaoypkgdfirr"
+L103: mov #-153, *r2
+m2
+mov #228, L104
+not *r5
+L104: clr L29
+m2
+sub L17, L89
+lea L69, L59
+rts
+stop
@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 103
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    cmp L79, #73
+    add r6, r3
+    not *r5
+    rts
+    lea L74, *r1
+    dec r0
+    not L62
+    jmp L34
+    add L25, r2
+    not L62
+endmacr
+macr m1
+    rts
+    clr *r0
+    not L100
+    lea L85, r7
+    clr L14
+    red *r5
+    add r1, r0
+    jsr L94
+    not L109
+    clr *r3
+endmacr
+macr m2
+    red r7
+    sub *r5, r3
+    mov L41, *r2
+    bne *r7
+    bne L107
+    clr *r2
+    dec *r1
+    lea L62, r7
+    dec r5
+    clr r4
+endmacr
+macr m3
+    cmp *r1, L14
+    red *r3
+    inc L109
+    clr *r2
+    stop
+    bne *r3
+    clr r6
+    lea L37, L31
+    lea L25, *r1
+    prn L40
+endmacr
+macr m4
+    cmp r2, r5
+    cmp r3, *r3
+    jmp *r6
+    sub r6, L22
+    jsr L17
+    cmp #-169, #213
+    sub *r3, r5
+    jmp *r0
+    clr r3
+    stop
+endmacr
+dec r4
+cmp #-209, *r4
+stop
+L0: not *r1
+prn *r4
+L1: sub #-137, L81
+inc L1
+not L77
+prn r2
+L2: sub *r3, r4
+red L22
+cmp r2, *r2
+dec r2
+L3: sub #-207, L0
+L4: bne L53
+m4
+L5: not L2
+clr *r1
+bne *r0
+jsr L5
+red L1
+L6: jmp *r2
+m1
+prn L17
+m1
+jmp *r1
+m3
+m0
+cmp r0, L2
+rts
+sub r3, *r7
+inc r2
+m2
+rts
+mov #246, *r5
+bne *r4
+inc *r5
+mov L13, *r7
+L7: lea L6, *r1
+m1
+; comment
+add L14, r2
+dec L102
+m2
+L8: cmp L3, #-56
+m4
+L9: .data 519, -156, -488, 327, -325
+L10: dec L1
+clr r6
+L11: sub L1, r6
+add r0, L3
+cmp *r2, #-139
+rts
+add *r5, r1
+m1
+inc *r4
+L12: jmp L72
+; comment
+prn r4
+L13: lea L7, *r0
+L14: .data -870, 347, 72, 428, -859, 126, -988, 511
+L15: jmp L19
+clr r1
+L16: jmp *r3
+inc *r7
+
+L17: inc r3
+m0
+L18: .string "eodcqvxdq"
+rts
+L19: .string "tqapftigtmzouazzp"
+m1
+dec *r6
+lea L8, *r2
+mov L2, L104
+L20: stop
+L21: prn r1
+L22: .string "yyhoze"
+dec *r7
+; comment
+L23: .string "akgvkagmafo"
+L24: add *r4, L6
+bne *r6
+m1
+L25: sub r4, r4
+L26: .string "rpqequvzqpsdiqotgq"
+inc L62
+L27: dec *r2
+L28: .data -435, -909
+not L102
+prn r1
+clr r7
+stop
+L29: .data -166, 151, -278
+L30: .string "shykmvpvpzoussxt"
+prn r5
+m0
+bne *r7
+m2
+inc L77
+
+cmp #104, r4
+stop
+cmp *r0, *r2
+dec r4
+m4
+bne L100
+dec L21
+not L3
+L31: .string "o"
+red L101
+stop
+L32: .data 546, 706
+rts
+red L89
+L33: .string "lawtcsylft"
+bne *r2
+cmp r1, *r6
+L34: .string "ggruied"
+stop
+cmp #33, #-250
+stop
+jmp *r6
+L35: not r0
+m1
+L36: .string "aydjlnyakybn"
+dec *r6
+L37: cmp L13, *r1
+add #196, L70
+prn #242
+L38: prn L50
+; comment
+L39: add L68, L32
+m0
+sub L4, L29
+cmp #-114, L37
+L40: .data -64, 27, 395
+m0
+clr L8
+inc L38
+dec r7
+L41: .data 570, 159, -801, 245, -944
+jmp L84
+L42: add L12, *r5
+L43: sub L24, L5
+mov r0, r1
+clr *r6
+clr r3
+stop
+inc L16
+dec L41
+not *r5
+prn r1
+m4
+prn r1
+rts
+clr L1
+clr L66
+L44: not L1
+L45: .data -773, -752, -161, 395, 532, -479, -629
+L46: .string "xhpzyteo"
+sub L7, *r2
+stop
+cmp *r1, L1
+prn L77
+m1
+cmp #-26, *r7
+add *r0, r3
+L47: sub r1, L13
+prn #21
+m4
+mov #208, r4
+clr *r4
+m0
+not L18
+jsr *r3
+m1
+
+jmp *r2
+jmp *r3
+stop
+bne *r4
+inc *r2
+jsr *r5
+L48: jmp *r0
+L49: .data -1, -47, 423, 889, -198, 373
+m1
+jsr L76
+
+inc *r5
+L50: .data 803, -205, -967
+jmp *r7
+m4
+; comment
+L51: .data -166, 338, -457, -974
+jmp L108
+m1
+not *r4
+add #-165, *r6
+cmp #0, *r3
+mov #168, L93
+m1
+cmp *r3, *r5
+jmp L78
+m2
+L52: add *r4, L72
+dec *r2
+m3
+
+add #146, L71
+m1
+add L89, L2
+m1
+bne *r5
+mov r7, r0
+jsr *r4
+not *r0
+m2
+m2
+sub r0, *r4
+dec r6
+dec *r7
+m3
+L53: cmp r2, *r3
+m0
+mov #-118, L45
+L54: .string "fahz"
+prn *r3
+L55: .data 594, 537, 201, 737, 482, -383, -162, -250
+
+m0
+m2
+L56: lea L99, r6
+add #-43, r3
+red L108
+lea L48, r4
+rts
+L57: lea L80, *r6
+lea L17, r6
+L58: .string "znpkvzwftojjntd"
+m0
+prn L47
+m3
+m3
+stop
+lea L13, *r4
+bne L102
+m3
+cmp *r7, #133
+L59: rts
+; comment
+L60: cmp *r4, L51
+jsr L47
+cmp #68, *r1
+jsr *r3
+m0
+clr r2
+L61: bne L36
+inc r3
+stop
+m1
+jsr *r6
+jmp L4
+m2
+L62: jmp L26
+jmp L44
+m3
+add #215, L53
+m4
+m0
+jsr L42
+L63: inc L89
+rts
+L64: red L69
+L65: prn #23
+rts
+lea L58, *r2
+sub r7, L37
+L66: .string "jtqvkansbarugbywk"
+prn *r6
+L67: not L55
+m0
+L68: .string "mdnsusgq"
+prn L78
+m1
+m3
+bne *r1
+mov #-105, L15
+red *r1
+L69: inc r0
+L70: .string "kmngnmqtwdgb"
+bne *r6
+clr r5
+m1
+dec r2
+dec r1
+rts
+jmp *r7
+L71: .string "es"
+clr *r6
+clr r3
+L72: add r6, L96
+sub *r6, r4
+red L72
+m4
+add *r5, *r5
+stop
+rts
+m0
+add *r3, r2
+m3
+L73: .string "vedxeybbnyencoeuswltq"
+jsr *r6
+inc *r7
+dec *r7
+m1
+m3
+jmp *r0
+L74: .data -271, 562, -789, 792
+red r2
+L75: not r5
+m1
+sub *r6, L96
+L76: stop
+L77: .string "qfcgcvxhbjdcottkmlkqt"
+sub *r5, *r1
+L78: sub r6, r6
+L79: .string "bfuulshxbikmubu"
+bne *r7
+dec *r7
+rts
+m4
+m2
+cmp #-230, #-221
+m3
+m3
+lea L55, *r6
+m1
+jmp *r2
+sub r3, *r0
+stop
+not r6
+clr L53
+rts
+m3
+mov *r2, r5
+L80: .string "tbjpbwevysea"
+L81: inc r7
+m0
+bne L5
+m0
+m1
+prn r2
+add #-130, r0
+cmp *r7, L26
+prn #191
+L82: red *r2
+m2
+cmp #-248, #-238
+cmp *r3, L18
+L83: lea L114, *r2
+inc L91
+m3
+L84: cmp *r6, #-108
+m1
+inc r4
+sub L108, L94
+not L14
+rts
+sub r0, r0
+m0
+L85: sub #-146, *r6
+jmp L108
+L86: .string "elstqbrmfvughrdcn"
+rts
+m2
+L87: sub *r6, L7
+L88: .string "wxhf"
+lea L113, r6
+rts
+inc L80
+; comment
+rts
+m0
+L89: sub #251, *r6
+jsr *r4
+m2
+jmp *r4
+m2
+m3
+L90: .string "cvbohmfrsrlfjisjaf"
+rts
+stop
+L91: red L107
+stop
+jmp *r6
+mov L16, r3
+inc *r1
+jsr *r7
+jmp *r0
+rts
+inc r1
+prn L101
+inc L109
+m0
+rts
+stop
+lea L94, r5
+; comment
+jsr L53
+L92: .string "mzpcodujiszly"
+sub r0, *r1
+jmp *r4
+m3
+add *r1, r2
+inc L102
+sub r5, r0
+lea L112, r7
+not *r7
+add r3, r5
+not L103
+L93: .data -395, -358
+jmp *r0
+m1
+mov r4, L38
+inc *r3
+L94: .string "qoxly"
+dec L44
+stop
+stop
+L95: prn r0
+m2
+red L113
+L96: bne *r7
+add *r1, *r2
+L97: .string "jeuujdgempxdwvmr"
+stop
+clr *r5
+m2
+clr *r4
+clr r1
+cmp r0, *r7
+L98: .data 306
+L99: red L107
+; comment
+L100: not *r5
+L101: .string "untltfrsrrsf"
+L102: .string "kdkvwxwahuib"
+jsr *r2
+add *r0, L111
+L103: bne *r2
+sub r6, *r3
+clr r5
+L104: sub r7, r5
+stop
+jmp *r7
+jmp L106
+L105: .data 964, -747, -731, 389, -7, 0, -639, 849
+mov *r0, r2
+L106: clr r0
+prn #-225
+dec r3
+prn #-98
+red *r4
+jsr L0
+red *r2
+m2
+jmp *r7
+L107: add *r7, *r5
+L108: bne *r4
+add r4, r2
+L109: clr *r5
+L110: add *r7, L111
+jsr *r3
+jmp L83
+m0
+dec *r4
+add #198, r0
+m1
+clr r6
+
+; comment
+red *r1
+mov r4, r0
+add #99, *r5
+L111: lea L106, L89
+red *r5
+m0
+add r4, L112
+stop
+m3
+L112: bne *r4
+L113: .string "tjlzpovtobv"
+L114: .data 450, -733, -245, -275, -271, 867, -755
+m2
+jsr *r1
+m4
+; comment
+stop
+inc r0
+stop
@@ -0,0 +1,571 @@
+; Generated by genCorpus --seed 104
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+macr m0
+    dec L98
+    cmp r6, r5
+    jsr L65
+    inc L82
+    mov r7, *r5
+    rts
+    inc *r1
+    bne *r1
+    rts
+    dec L84
+endmacr
+macr m1
+    add #-5, *r0
+    add L85, r0
+    mov L3, L12
+    clr L105
+    mov L36, r3
+    dec L94
+    jsr *r1
+    bne L69
+    cmp L92, L84
+    lea L70, *r2
+endmacr
+macr m2
+    mov L40, r4
+    add r0, r3
+    mov #38, *r7
+    red r2
+    clr L89
+    rts
+    inc r2
+    sub r4, r3
+    stop
+    add L96, r2
+endmacr
+macr m3
+    cmp *r6, *r1
+    sub #-155, *r3
+    bne L15
+    stop
+    lea L114, L92
+    mov *r3, r5
+    clr *r5
+    inc *r4
+    red *r6
+    prn *r3
+endmacr
+macr m4
+    prn r2
+    lea L4, *r3
+    rts
+    bne L39
+    jsr *r6
+    inc r5
+    not r5
+    bne L11
+    inc r6
+    jmp *r4
+endmacr
+red L102
+jsr *r5
+stop
+
+jsr *r1
+m2
+prn #-194
+L0: .data -921, 999, 117, -745, 783, 704, -734, -907
+L1: .data -37, -805, 517, 711, -908, -689, 464, 959
+L2: inc L108
+clr r5
+dec *r1
+bne L66
+L3: .data -118, 495, 437, 651, -579, -597, 940
+m3
+L4: bne L22
+lea L117, r6
+prn *r3
+rts
+
+rts
+L5: .string "rzsrdmilhe"
+L6: stop
+bne *r4
+rts
+red r2
+L7: inc L6
+sub *r5, L6
+prn r0
+L8: bne *r5
+m4
+L9: dec *r7
+clr r0
+not L18
+L10: cmp L54, r6
+bne L47
+L11: .data -208, -819, 999, 31, -183
+inc r4
+m1
+red L116
+; comment
+jsr *r7
+m0
+L12: not r1
+red *r7
+L13: .data -484, -393, -307, 347, 973
+L14: not *r5
+prn r0
+L15: mov *r7, *r3
+L16: .data 517
+L17: .string "migi"
+m1
+jsr *r2
+cmp r3, L68
+m3
+m4
+; comment
+m1
+L18: .data -793
+m0
+L19: cmp #219, L40
+jsr L87
+L20: lea L19, L10
+L21: cmp r5, #-25
+inc r7
+; comment
+dec r3
+L22: mov *r5, *r1
+cmp *r3, r6
+mov r5, r1
+m3
+not *r0
+red *r6
+m3
+L23: prn r1
+L24: dec r0
+stop
+rts
+cmp #245, *r5
+bne L15
+sub r7, r2
+sub *r3, *r1
+L25: jmp L2
+L26: clr r6
+clr *r6
+m1
+m4
+m3
+stop
+lea L27, r6
+m3
+jmp L87
+m4
+L27: mov r4, *r5
+L28: .string "vlpe"
+rts
+lea L57, r0
+m2
+m4
+L29: mov *r6, L29
+L30: prn *r7
+L31: prn r1
+L32: stop
+lea L1, r7
+m0
+; comment
+L33: .string "vidloqhb"
+cmp #98, r2
+prn #-153
+m1
+bne L36
+stop
+dec r5
+; comment
+mov *r3, L110
+L34: red r7
+cmp #-102, L113
+m3
+add *r0, L31
+prn L34
+L35: jmp L23
+bne *r2
+rts
+m3
+dec L28
+sub r0, r0
+cmp L11, *r0
+; comment
+m2
+m1
+jmp *r6
+cmp #-106, *r5
+not L42
+mov L78, r6
+L36: mov *r1, L97
+m3
+cmp r2, L80
+stop
+clr r1
+L37: dec L119
+rts
+jsr L68
+red r2
+lea L130, *r5
+rts
+m0
+m1
+L38: prn r1
+L39: not L10
+add L21, *r4
+jmp L28
+rts
+L40: red *r0
+bne L43
+L41: .string "ytkam"
+L42: not r5
+not *r1
+add #-54, *r0
+L43: mov *r4, *r3
+L44: lea L46, L9
+
+bne L78
+not r6
+m1
+m1
+m1
+rts
+stop
+m1
+; comment
+L45: mov #-75, L95
+
+m0
+clr *r3
+L46: .data -489, -981, -990, -635, -255, 235, -967, 390
+lea L21, r7
+L47: add #170, L73
+L48: .data 562, -335
+bne L21
+lea L35, L40
+m2
+mov *r7, r3
+; comment
+sub #16, L112
+L49: not L35
+add r4, L1
+red L89
+inc *r1
+L50: rts
+L51: .data -616, 230, -311, 501, 474, -160, 797
+mov r3, *r5
+dec *r3
+prn *r1
+m1
+
+m3
+m1
+prn L30
+lea L128, r4
+L52: .data -854
+m3
+L53: .string "rdygk"
+bne *r5
+
+sub L60, L64
+L54: add L114, r4
+not r2
+m0
+L55: prn r4
+cmp L112, *r2
+; comment
+L56: .data -183, 165, 650, -733
+L57: jmp L124
+dec *r2
+clr L79
+bne *r3
+m2
+L58: clr *r2
+cmp *r5, L74
+m2
+mov r6, *r4
+m2
+not L120
+L59: .string "jjtgumuuwvbmoxxinp"
+jmp *r3
+cmp #85, #200
+L60: .data 635, -303, -359
+L61: .string "jja"
+L62: not L53
+inc L116
+jsr L58
+bne L47
+L63: stop
+mov L17, L73
+stop
+red *r0
+jmp *r1
+red *r7
+L64: inc r1
+mov #83, L60
+L65: .data 374, -806, 674
+stop
+m3
+lea L46, *r1
+bne *r5
+; comment
+rts
+m2
+L66: mov #237, L109
+m4
+sub L75, L119
+prn L117
+m1
+dec L95
+L67: red *r1
+lea L80, *r3
+prn r6
+m3
+m4
+jsr *r6
+jmp *r2
+jsr L124
+L68: cmp r7, #-81
+L69: .string "lqetnptlbz"
+m3
+m1
+
+m0
+rts
+L70: lea L115, r4
+dec L36
+L71: jmp L43
+m3
+; comment
+L72: lea L64, *r1
+stop
+stop
+L73: .string "kzcdgmsyslsjmafmdzrrmqet"
+L74: .data 459, -295, -119, 483
+L75: .data -437
+mov r1, *r6
+L76: add r0, *r3
+dec r4
+L77: inc r3
+L78: .data -211, 357, -671, 233, 850, 743, -451, 637
+m3
+rts
+mov #-9, *r3
+dec *r7
+clr L28
+L79: stop
+m2
+m4
+cmp *r1, *r5
+not *r3
+add r4, r3
+cmp r0, L82
+add #-77, *r4
+L80: lea L107, r7
+red r3
+lea L55, r3
+not *r1
+m3
+not L125
+clr r2
+L81: .data 985, -262, 687, 929, 44
+L82: inc L81
+lea L123, *r2
+m0
+L83: prn *r1
+mov L48, L22
+
+rts
+mov L52, *r6
+add *r7, L72
+lea L10, *r3
+m1
+clr L12
+sub *r6, r6
+L84: rts
+inc r6
+stop
+prn *r4
+m2
+L85: prn L64
+cmp L122, #6
+jmp L101
+m0
+m1
+L86: jmp *r3
+m1
+m4
+L87: .data 599, -203, -977, -338, 783, -17, -277
+mov r0, r2
+not L114
+jsr L121
+prn *r5
+L88: rts
+L89: .string "mabjyvatadgf"
+sub r0, L50
+mov *r0, *r5
+m3
+L90: inc *r7
+mov *r4, r6
+red r6
+inc *r3
+cmp *r4, *r1
+prn L106
+mov L102, r4
+stop
+
+cmp r6, *r5
+L91: .data -368, 725, -485
+jsr *r2
+sub *r0, r0
+sub *r1, r7
+jsr L7
+L92: add #140, r7
+; comment
+m3
+not *r2
+L93: .string "dnkvoleaqachnwravcma"
+L94: .data -301, -696, 371
+red r0
+L95: .data 475, 348, 122, -497
+red *r1
+stop
+not L130
+jmp *r1
+mov *r6, r0
+m1
+m2
+L96: .string "vgfzmgguoabjcvuemjxo"
+rts
+red L120
+L97: .data -240, 294, -165, -841, -718, 630, -650
+L98: jmp L57
+stop
+L99: inc r2
+L100: jmp *r4
+m3
+dec *r3
+m3
+clr L95
+jmp L116
+jmp *r4
+L101: clr r1
+L102: .string "beirgmrqdcs"
+L103: .string "vyrwtprftvd"
+not L122
+L104: .data 382, -644, -840, 328, 279
+jsr *r6
+m1
+; comment
+mov #94, *r4
+mov r7, r2
+sub *r7, L107
+; comment
+L105: inc L106
+lea L5, *r6
+L106: jsr *r6
+L107: add L110, L111
+clr *r1
+jmp L65
+not r5
+m1
+L108: lea L116, L20
+L109: prn #53
+add L44, *r4
+jmp L104
+L110: dec *r5
+m1
+prn r3
+m1
+clr *r5
+cmp #10, L94
+; comment
+cmp r6, *r6
+cmp L115, r7
+not *r5
+m2
+sub L117, L126
+jsr L128
+; comment
+L111: add L103, *r7
+bne L119
+bne L128
+L112: clr L97
+lea L127, r0
+lea L116, *r2
+not L38
+inc r3
+bne *r1
+inc *r4
+dec *r2
+L113: .string "jtcihhjtluxjbvyw"
+L114: .string "arx"
+m3
+m0
+m0
+lea L82, r6
+L115: .string "lyhafzejcxbwhkkazkcegbfr"
+L116: bne L120
+bne L130
+jmp *r7
+cmp L123, L130
+bne L125
+
+L117: .data 535
+L118: .string "wndfbmokdhwprtwuyevdoaq"
+m2
+m4
+L119: red L126
+m1
+mov #247, r7
+inc *r2
+L120: .data -696, 418, 847, 369, 590, 505, 769
+L121: cmp *r4, r5
+red L122
+rts
+L122: .string "kzaslbkpgboukiccpqzrf"
+rts
+m4
+L123: jsr L126
+cmp r2, r1
+L124: .string "dfjdfpywecnqpzxvyimsww"
+
+cmp *r7, r3
+L125: .string "yyrgnqis"
+L126: lea L129, r7
+m1
+add *r4, L22
+L127: jsr *r0
+prn #71
+inc L83
+lea L130, *r1
+sub #21, L129
+inc r1
+dec L129
+; comment
+inc *r5
+red L6
+rts
+m3
+red r1
+L128: clr *r2
+L129: red L130
+sub *r7, r0
+cmp #-54, *r2
+lea L5, *r4
+jmp L40
+cmp #195, r4
+sub L37, *r0
+prn *r1
+m4
+cmp *r4, #-214
+L130: prn *r6
+m0
+m3
+inc r4
+stop
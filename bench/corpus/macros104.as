@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 105
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    mov L9, r3
+    prn *r2
+    add r0, *r0
+    not L12
+    mov *r6, r6
+    jsr *r7
+    prn *r3
+    rts
+    add L9, L34
+    dec *r3
+endmacr
+macr m1
+    sub #-139, *r1
+    prn *r5
+    prn *r5
+    clr L5
+    clr L99
+    not L5
+    sub L99, r0
+    not r7
+    red L0
+    add L86, *r2
+endmacr
+macr m2
+    sub r1, L100
+    jmp L34
+    inc L92
+    red r4
+    dec r3
+    prn L67
+    mov #-110, L46
+    sub *r6, r5
+    mov r3, r7
+    stop
+endmacr
+macr m3
+    cmp r5, *r0
+    rts
+    cmp L48, #-240
+    prn L55
+    jsr L49
+    red *r2
+    lea L71, L61
+    not r0
+    add r7, L79
+    cmp r1, r7
+endmacr
+macr m4
+    jmp L65
+    cmp L72, #-253
+    rts
+    dec *r0
+    inc r1
+    clr *r6
+    bne L52
+    dec L69
+    clr *r1
+    add *r2, r6
+endmacr
+sub *r6, L87
+bne L67
+red r6
+jsr L97
+add r6, L99
+L0: .string "loyibtiz"
+m4
+add L0, L0
+; comment
+m2
+add #-20, *r0
+not r1
+
+m4
+mov r7, r0
+red *r5
+lea L0, *r7
+cmp L3, r5
+jsr L70
+L1: add #-100, L35
+m2
+m0
+m4
+; comment
+not r2
+L2: not L66
+jsr *r1
+add r7, L1
+lea L86, r5
+inc r6
+red *r1
+m3
+L3: .string "qqavpromrnnqidzkqjgttyh"
+L4: dec r4
+rts
+not L52
+L5: inc *r4
+m3
+m1
+L6: .string "a"
+sub #202, *r2
+L7: .string "jlxgnlbhfjgarvkijwh"
+L8: not r1
+clr r6
+add r0, L40
+add *r5, r0
+jsr L31
+red L2
+clr r4
+cmp #189, *r2
+L9: jmp L7
+mov *r0, L10
+L10: clr r3
+m1
+m3
+mov r5, r5
+jmp *r3
+L11: .string "vluiecikpnht"
+jsr L99
+m4
+red *r0
+red L2
+bne *r7
+not L59
+
+dec *r7
+clr L8
+dec *r2
+L12: jsr L76
+L13: lea L41, L9
+clr r4
+
+clr r7
+L14: prn *r1
+L15: add r7, L78
+jmp *r3
+m4
+mov #-87, r0
+rts
+rts
+m1
+
+clr L14
+m4
+not r3
+m3
+m2
+jsr *r4
+bne *r6
+cmp *r0, L100
+red r3
+L16: dec *r5
+m4
+jmp *r7
+m1
+m1
+rts
+dec *r3
+dec *r4
+m2
+cmp *r4, #-36
+L17: clr r7
+inc L24
+prn r5
+lea L5, r6
+L18: clr *r1
+jmp L15
+m4
+dec L2
+m1
+m0
+red L17
+bne *r7
+jmp *r6
+L19: dec *r1
+jmp *r0
+clr L102
+mov #122, L6
+sub L22, L14
+sub #230, L2
+stop
+not *r1
+add *r4, *r7
+m3
+jsr *r3
+dec L31
+prn #-158
+; comment
+clr *r7
+m3
+m0
+inc r7
+m3
+m0
+m1
+red L68
+clr r5
+L20: .data 938, -85, 776, -661, -658, 279
+jsr *r4
+prn r6
+clr r4
+bne *r0
+inc r2
+inc L79
+rts
+bne *r2
+m4
+clr r1
+; comment
+stop
+prn r1
+cmp #-40, #-243
+m0
+jsr L6
+sub L48, L67
+m3
+rts
+mov #54, r4
+L21: .string "xewwibhia"
+mov r5, r4
+jmp *r1
+m2
+jsr L5
+not r1
+prn L24
+m1
+add #-118, *r6
+clr L9
+L22: .data 886, -798, 630, -159, 669, 20
+m1
+
+sub *r5, r7
+mov L3, *r5
+L23: not r1
+L24: .data -903, 658, 945, -360, -547, -274, -385
+sub *r5, *r2
+clr L17
+L25: prn *r3
+L26: .string "wpwndixolzoe"
+m1
+stop
+m3
+mov r6, r3
+m4
+red *r3
+L27: sub #98, *r0
+L28: .string "fuabxsrxpryxbfxiuteaikh"
+
+cmp r2, L50
+
+L29: rts
+L30: stop
+L31: lea L41, L5
+stop
+m0
+sub *r0, *r1
+lea L29, r1
+not r0
+mov L22, r1
+m2
+L32: prn #-206
+jmp L45
+sub r5, *r4
+red L31
+bne L1
+m1
+sub r5, r6
+clr L4
+L33: lea L13, L48
+L34: dec *r4
+jsr L28
+L35: .string "orlkgsqgafqnwzlowgon"
+L36: bne *r5
+L37: not *r7
+red *r6
+L38: .data 50, -578
+m2
+L39: .string "hejr"
+m2
+jsr *r2
+L40: red L31
+L41: not r4
+L42: .data 218, 967, -182, -941, 293
+jsr *r6
+L43: .string "nlsbkmflzmyaoezqre"
+clr *r3
+sub *r4, *r5
+m2
+prn r5
+jmp L60
+not L19
+m3
+sub #-184, r6
+m2
+bne *r7
+m1
+jsr *r0
+not L13
+m3
+L44: rts
+cmp #-144, *r7
+clr *r1
+rts
+rts
+L45: inc *r6
+m0
+m4
+jsr *r2
+lea L58, r2
+not r4
+clr *r3
+m4
+red r1
+m1
+m3
+jsr L17
+L46: .string "ydthw"
+L47: sub L16, *r5
+cmp L77, L43
+L48: .data -919, 494, 693, -755, -719, 44
+red r3
+L49: .data -456, 31, -105, 410, -210, -683, -11, 170
+L50: rts
+stop
+dec r1
+m0
+add #-202, *r4
+red L30
+red *r2
+L51: dec L28
+m2
+rts
+jmp *r3
+sub L7, *r6
+m0
+stop
+m2
+stop
+sub *r5, r4
+dec *r6
+cmp L92, L31
+jsr L10
+sub L17, *r5
+not *r6
+add #-205, L32
+stop
+m2
+L52: mov L92, *r2
+m4
+clr r5
+m0
+clr r0
+L53: rts
+clr L41
+inc *r6
+prn #-204
+bne *r6
+stop
+lea L27, r7
+m1
+mov r1, *r3
+m4
+inc r5
+L54: .data 865, -216, 597
+mov #172, r4
+jmp *r6
+L55: rts
+
+red *r3
+L56: .string "xqpy"
+mov #110, *r6
+rts
+L57: stop
+sub L36, *r5
+bne *r3
+m1
+lea L62, r2
+cmp *r1, r7
+L58: .data 854, -76
+jsr *r3
+inc r6
+m3
+lea L55, r7
+stop
+not r3
+dec *r3
+jmp *r6
+rts
+clr *r7
+L59: inc r0
+lea L14, L23
+prn L102
+m4
+m1
+m4
+L60: prn r0
+lea L92, *r4
+lea L56, L25
+red *r7
+stop
+clr r3
+L61: dec *r6
+
+sub *r0, *r0
+m0
+L62: jmp *r2
+m2
+bne *r2
+not L79
+prn #214
+bne L76
+sub r2, L100
+lea L0, r6
+m0
+jmp L76
+L63: sub #205, r1
+rts
+L64: lea L70, *r0
+add #176, *r7
+prn r4
+stop
+red L3
+cmp L77, r3
+cmp r4, #38
+prn #-229
+m1
+m3
+L65: prn *r4
+L66: bne *r0
+L67: jsr L56
+L68: dec *r7
+stop
+L69: .data -722, -363, 631, -172
+m2
+; comment
+red r4
+rts
+add r1, r2
+m3
+
+stop
+add *r0, r4
+L70: rts
+L71: not *r6
+dec *r0
+L72: dec L4
+m2
+L73: sub L93, *r6
+m0
+L74: .string "flminsxdyhmdqzsplohocp"
+L75: lea L39, r1
+L76: rts
+m1
+cmp *r2, #245
+m2
+sub *r5, r0
+m2
+m4
+L77: .string "eiayqls"
+; comment
+jmp *r5
+m0
+jsr *r5
+m2
+bne *r7
+L78: prn r7
+bne L102
+m1
+sub #84, L35
+m0
+L79: dec r3
+clr r5
+clr L71
+sub #-244, *r3
+L80: not r2
+L81: not r7
+m3
+m3
+L82: .data -484, -735, 558, -301, 29, 934, 618
+red L99
+; comment
+L83: .string "xniaddfjuokaa"
+L84: .string "vnxxzhzqkpkhnogvq"
+m2
+add r1, *r7
+L85: red r5
+dec *r0
+m4
+L86: lea L52, *r7
+lea L82, L96
+L87: .data 422
+L88: stop
+m2
+prn #-186
+m3
+stop
+m1
+lea L95, L50
+m4
+m0
+prn L8
+bne *r2
+sub L99, *r1
+stop
+cmp L95, *r5
+clr *r2
+L89: jmp L13
+not L48
+cmp L99, L4
+red *r0
+L90: add r2, r3
+clr r3
+inc L31
+rts
+L91: red *r6
+L92: lea L102, r4
+sub *r4, L91
+jmp L59
+dec r6
+clr L0
+L93: prn *r2
+L94: .string "umitbwkjkxefutrsfmbrmge"
+jmp *r6
+mov r6, *r0
+L95: .data -142, -570, -649, -546, -157
+clr L24
+L96: .string "ecdxqzxabauvqogd"
+inc *r2
+dec L9
+m0
+L97: .string "zhzrcscmzaopkttozjnnenaw"
+jmp L2
+prn L64
+L98: bne *r1
+L99: jmp *r0
+add *r2, *r7
+lea L103, *r4
+dec L101
+clr L102
+inc *r6
+m2
+L100: red L2
+m0
+lea L59, L102
+L101: rts
+dec *r2
+clr r5
+m2
+L102: stop
+m0
+red *r3
+m2
+cmp L103, L51
+L103: add r1, r0
+clr r3
+jsr L18
+rts
+rts
+m1
+cmp r6, *r3
+stop
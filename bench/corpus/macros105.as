@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 106
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    jmp *r5
+    jsr *r2
+    not r3
+    clr L48
+    clr r2
+    sub r4, *r0
+    inc L0
+    prn *r1
+    rts
+    bne L3
+endmacr
+macr m1
+    dec L37
+    lea L50, L2
+    rts
+    sub #-119, r6
+    inc *r1
+    stop
+    not r1
+    add *r6, r1
+    bne *r6
+    inc r0
+endmacr
+macr m2
+    rts
+    mov #81, *r5
+    dec r7
+    stop
+    mov L94, *r1
+    inc L89
+    add r1, r5
+    stop
+    inc r6
+    add L47, r5
+endmacr
+macr m3
+    sub *r6, r1
+    prn *r7
+    dec *r3
+    cmp L25, L35
+    jmp L33
+    dec r7
+    cmp #-63, *r3
+    not *r4
+    jmp L76
+    lea L14, *r1
+endmacr
+macr m4
+    add r2, r2
+    jsr L29
+    stop
+    rts
+    dec L86
+    lea L15, r3
+    prn *r2
+    jmp *r0
+    prn #-75
+    sub L8, *r7
+endmacr
+; comment
+L0: dec *r7
+m2
+cmp #46, L83
+sub #-224, *r7
+L1: stop
+L2: stop
+m4
+inc *r6
+L3: .string "jdjacgmuqqeovulkjpo"
+jsr *r5
+bne *r1
+L4: prn L16
+m2
+m1
+L5: stop
+add L34, L85
+dec r5
+L6: not r4
+L7: add L46, L1
+red *r4
+mov L56, L71
+stop
+add L6, *r4
+m4
+L8: stop
+stop
+L9: bne L3
+L10: .data 260, 432, -676, 672, 885, 361, 516
+dec r5
+L11: .data 171, -153, 446
+cmp #5, #39
+dec L6
+rts
+m0
+clr L22
+L12: lea L9, L16
+cmp *r5, #-64
+clr *r0
+stop
+
+mov r3, r5
+jmp *r2
+inc r3
+sub *r2, L34
+m0
+m0
+add *r0, L11
+red *r0
+m2
+L13: .string "nzdljpympmhsujsnvocksqjl"
+not *r6
+rts
+add *r0, r2
+L14: inc L72
+not r0
+rts
+L15: bne L60
+stop
+L16: inc *r7
+jmp *r6
+clr L65
+; comment
+cmp L93, *r6
+red r0
+prn L46
+red L15
+sub r0, L55
+L17: .string "wzmowqqbmnfsso"
+inc r1
+add L10, L71
+m0
+; comment
+L18: .data 539, -20, 352, -946, 875, -772, -755, -60
+m4
+
+cmp *r6, r1
+jmp *r1
+m0
+m4
+m1
+L19: stop
+L20: .string "ppcjedvbpwyzidotenbv"
+L21: inc *r1
+stop
+clr *r5
+add *r1, L58
+m1
+add #-189, r5
+add #1, L61
+mov r0, r3
+lea L19, r5
+jmp L5
+m3
+
+m3
+inc r1
+; comment
+L22: dec *r0
+jmp L24
+m0
+jsr L34
+; comment
+m1
+mov r7, r6
+red r7
+jmp L9
+jmp L20
+
+rts
+jmp L96
+prn *r4
+jmp L5
+lea L33, L16
+m2
+m1
+prn r7
+L23: dec L13
+not r2
+mov L8, r5
+jmp L41
+cmp r5, *r7
+m4
+not *r3
+prn r0
+
+L24: .data -488
+L25: jmp L29
+cmp *r7, L95
+bne *r1
+red L11
+jmp *r2
+red *r1
+jmp *r4
+jmp L2
+m2
+L26: .string "wewpnnknbjzgzpeyzdryvrz"
+L27: red r2
+m2
+L28: .data -426, 476
+clr r7
+L29: red L87
+rts
+bne *r0
+red *r4
+rts
+not r0
+jsr *r4
+lea L75, L84
+L30: .data 259, -955, 237, -819, 244, 805
+jmp *r1
+stop
+add #207, *r0
+clr L8
+L31: .data 946, 785
+
+m4
+jmp L29
+m0
+add L22, L42
+m3
+mov *r5, L97
+sub L89, L29
+red r3
+sub r6, L56
+m0
+L32: rts
+stop
+rts
+m4
+prn r1
+stop
+L33: .string "cjjzw"
+L34: .data -217, -952, -694, -202
+clr L36
+stop
+prn #-42
+m2
+L35: stop
+m3
+jmp *r0
+L36: add *r2, r7
+sub *r5, *r2
+m1
+L37: .string "jpuintwzm"
+
+L38: cmp #16, L34
+L39: .data 570, 766, -387, -864, -143, 620, 778
+prn #145
+; comment
+
+L40: add #-193, L48
+; comment
+mov r7, r7
+L41: .string "hjacihdgryjiruuehatlw"
+; comment
+dec L39
+mov L27, L40
+inc L52
+cmp #3, *r7
+m0
+stop
+lea L99, *r1
+clr *r1
+L42: prn *r7
+L43: prn r0
+m1
+m0
+cmp L73, *r7
+clr r7
+m2
+L44: add r1, r4
+L45: .data -383, 15, 432, -177, -419, 404, -467, -840
+L46: not L43
+L47: inc *r6
+bne L23
+L48: mov r0, *r7
+m3
+m4
+jsr *r6
+cmp #-86, #162
+prn #10
+m4
+rts
+L49: .data -96, -104, 330
+cmp *r1, L99
+sub r6, *r6
+stop
+mov r2, L5
+L50: .data 357, 903, -106, 948, -834, -172
+m2
+L51: add #-236, r2
+not L3
+m4
+inc L18
+not r5
+L52: add L29, L52
+m1
+inc *r1
+stop
+m2
+dec *r1
+prn L21
+jsr *r5
+m1
+prn *r3
+jmp *r7
+red *r6
+red *r5
+dec r2
+m3
+prn *r5
+L53: .data -669, 18, 626, -477, -586, 568
+mov *r2, L9
+m2
+stop
+prn *r3
+sub L58, *r4
+clr *r5
+; comment
+L54: add r1, *r1
+dec r1
+L55: not r1
+prn r5
+m2
+m0
+add r2, r7
+sub r3, r7
+L56: stop
+jmp *r0
+jmp L27
+clr *r4
+m1
+jmp L70
+mov *r6, r7
+m2
+m1
+jsr *r3
+m2
+; comment
+not *r6
+m4
+L57: rts
+sub r7, L10
+mov L56, L5
+not r2
+L58: add *r3, L21
+m4
+m4
+rts
+dec r2
+cmp r4, r7
+sub *r2, L84
+m3
+L59: .string "immwjmuo"
+L60: mov #192, *r4
+rts
+mov r1, *r2
+jmp L73
+add #-83, *r3
+L61: jsr *r6
+jmp L74
+m1
+L62: stop
+L63: lea L96, *r3
+not L96
+m3
+m2
+; comment
+mov #110, *r2
+stop
+lea L70, *r4
+L64: lea L47, r0
+bne L16
+L65: .data -425, 723, -932, -674, 212, -76, -857, 591
+L66: dec *r0
+L67: .data -529, -365, -285, 763, 160
+L68: .string "egieejzxytkwacekuodmp"
+L69: .data 790, 483, -886
+
+bne L10
+inc r1
+L70: inc r2
+cmp r2, #191
+L71: add *r3, r0
+stop
+m1
+L72: .data 122, 399, 964, 251, 102, 48, -638, 450
+L73: .string "igvpvrpvjhz"
+; comment
+; comment
+m3
+L74: .string "zaght"
+; comment
+
+L75: .data 68, -346, 165, 589, 766, -357
+bne L40
+jsr *r1
+red r2
+clr *r7
+stop
+m1
+dec *r5
+mov #197, *r4
+rts
+L76: not r7
+jsr *r4
+bne L91
+stop
+L77: bne *r1
+m2
+not L85
+not r3
+prn *r4
+mov r0, L54
+not L85
+jmp *r5
+mov L87, *r7
+L78: jsr *r6
+sub r0, r0
+red L44
+inc r2
+m0
+jsr *r1
+not r0
+bne *r7
+jsr L83
+jsr *r5
+mov #104, r2
+jmp *r7
+jsr *r7
+jmp *r0
+; comment
+m3
+cmp r3, r4
+not r7
+m1
+not r2
+inc r6
+L79: .string "dhsfiqapkzlxajsxdu"
+rts
+cmp L25, *r6
+L80: .data -659, -570, -992
+clr r3
+not r4
+cmp r6, *r5
+lea L70, L88
+L81: lea L98, L100
+L82: prn *r5
+m2
+m0
+jmp L38
+add L94, r5
+L83: mov #153, *r3
+rts
+jmp L67
+m2
+clr *r7
+L84: add *r3, L59
+L85: cmp *r6, #-85
+L86: red L90
+red *r7
+prn r5
+; comment
+sub #-40, r1
+m0
+add #-69, *r0
+m3
+m2
+jmp L99
+add #-252, r1
+not r5
+cmp r5, r5
+m2
+m0
+inc L97
+not L44
+m4
+L87: .string "ejkdfufngup"
+add #-176, *r6
+prn *r6
+m3
+L88: inc L20
+prn *r0
+clr r1
+dec *r2
+mov r4, r1
+L89: cmp #212, #146
+red *r7
+dec L78
+jsr *r1
+not r3
+not *r1
+prn r4
+clr L97
+sub r6, *r6
+L90: .data 601, -892, 283, 494
+dec r6
+bne *r7
+L91: not *r4
+mov #128, L95
+jmp *r3
+m0
+; comment
+L92: .data -738, -607, 414
+m4
+rts
+m4
+prn L6
+mov *r7, L101
+jmp L98
+prn *r1
+m1
+L93: bne L48
+stop
+add r3, L100
+L94: .string "wyun"
+clr *r0
+mov #6, L57
+m0
+
+m0
+jsr L97
+; comment
+mov #222, r5
+clr L96
+prn L97
+sub L95, r0
+prn L95
+rts
+stop
+m1
+m4
+mov #-45, *r3
+inc r6
+L95: .string "fcplvpjiujur"
+; comment
+L96: cmp r6, L99
+cmp #243, #-233
+dec r5
+m1
+m1
+clr *r4
+lea L53, r4
+m0
+L97: .data -98, 44, 177, 277, -364, 850
+L98: .string "ivlchgzxuwgh"
+
+red *r3
+L99: .data 783, -449
+add *r4, *r2
+mov L101, *r0
+stop
+inc r0
+L100: .data 477, -458, 992
+clr *r3
+prn #-48
+L101: red L50
+sub L5, r0
+mov *r5, *r0
+stop
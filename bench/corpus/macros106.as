@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 107
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    jmp L116
+    jsr *r7
+    not r6
+    inc *r5
+    prn *r2
+    mov r0, r3
+    dec L93
+    red L41
+    clr r5
+    jmp *r3
+endmacr
+macr m1
+    inc r3
+    dec *r6
+    rts
+    jmp L50
+    dec *r0
+    cmp r6, *r7
+    rts
+    clr L76
+    mov r2, L57
+    sub #-156, L33
+endmacr
+macr m2
+    sub L35, r7
+    add L62, r3
+    stop
+    sub #-41, r0
+    rts
+    bne *r2
+    red *r3
+    cmp *r6, *r4
+    cmp r7, *r1
+    jmp *r7
+endmacr
+macr m3
+    mov r7, L58
+    mov #-254, r4
+    cmp *r4, *r4
+    jsr *r6
+    prn *r1
+    jsr *r7
+    mov r6, r0
+    add L41, L76
+    stop
+    mov #-217, L49
+endmacr
+macr m4
+    rts
+    jmp *r7
+    lea L10, r6
+    cmp r5, r5
+    stop
+    prn *r0
+    jsr L104
+    jmp *r7
+    jmp L103
+    red r1
+endmacr
+red r2
+m4
+sub *r6, *r2
+m3
+add r5, *r0
+stop
+clr r2
+; comment
+m2
+
+mov L12, L92
+m2
+cmp #-94, L55
+L0: .data -326, -68, 71, -891, -393, 627, 546
+m4
+m2
+L1: sub *r6, *r0
+m1
+L2: add *r4, r6
+jmp *r7
+m0
+stop
+mov *r4, L15
+jsr *r6
+m3
+L3: inc r2
+L4: .string "qeovdbjooeabbxvodjmpjr"
+add L74, L3
+jsr L0
+lea L4, *r3
+m1
+
+sub L30, r4
+L5: .data -762, -89
+m2
+dec L72
+m3
+mov #-28, L49
+m1
+dec L2
+clr r2
+mov r7, r3
+rts
+L6: .data -997, -888, -745, -701, 402, 688
+inc r7
+bne *r6
+inc r2
+L7: .string "cuhaapf"
+L8: .string "jtjhexdqrnac"
+L9: .string "kguekzvnftosoacogyyd"
+red *r3
+L10: clr L40
+rts
+jsr *r7
+inc *r1
+dec L61
+cmp r5, r1
+L11: rts
+stop
+m1
+L12: .data -669, -753, 909
+L13: .data -807, -399, 62, -309
+add r7, L10
+jsr *r7
+jsr L94
+jsr L57
+red r7
+
+cmp L3, L64
+L14: rts
+jmp L8
+; comment
+sub r7, L35
+L15: jsr L13
+clr r2
+red *r5
+clr r0
+add r7, *r6
+dec L13
+add #-17, *r6
+L16: .string "nufbyu"
+mov *r6, *r6
+not L8
+rts
+L17: .data 109, -483, 151, -517
+dec *r6
+red *r0
+red *r2
+m1
+; comment
+m1
+L18: .string "mxzpjsuyaxebbrffw"
+L19: .string "c"
+prn L34
+L20: sub L10, *r0
+L21: inc r6
+L22: .string "mqklcqdbl"
+m3
+jmp L24
+L23: lea L17, L36
+bne *r5
+L24: prn L119
+m0
+stop
+add *r4, r5
+bne L20
+jmp L18
+not *r6
+dec r3
+L25: add *r4, L7
+clr *r2
+rts
+cmp r1, L10
+dec *r0
+bne L23
+L26: jmp L77
+L27: jsr L88
+L28: clr L30
+add r6, *r0
+m1
+m2
+L29: sub L19, r4
+m4
+jmp L50
+dec *r2
+; comment
+rts
+prn *r3
+sub r2, L76
+L30: .data 931
+rts
+L31: add r0, L75
+bne *r1
+; comment
+m0
+clr *r3
+stop
+L32: .string "wa"
+m2
+lea L119, *r6
+m2
+bne L4
+m3
+L33: dec L99
+L34: .string "kcfufcc"
+m3
+prn *r0
+L35: .data 11, -864, -371
+dec r5
+add #202, r7
+stop
+jsr *r1
+L36: stop
+stop
+L37: mov r3, L7
+sub *r4, *r2
+m0
+rts
+m3
+mov L29, r0
+lea L15, *r1
+m2
+m0
+m1
+L38: .data 452, -601
+red L6
+jmp *r7
+jmp *r3
+inc L26
+rts
+L39: .data -229, 61, -850, -614, -647
+dec *r0
+inc L37
+prn *r7
+mov *r6, r5
+jsr L118
+rts
+m0
+cmp #-229, L54
+sub *r6, r1
+lea L4, r7
+m1
+bne L108
+L40: jsr *r7
+L41: add r3, L37
+red *r0
+not *r3
+lea L49, L116
+L42: red *r0
+not L105
+prn *r1
+clr r5
+
+lea L35, L1
+m3
+L43: .data 621, 406, 352, -69
+L44: mov r2, L86
+lea L19, r6
+L45: .data -11, 775, -259, 591, -116
+L46: clr L21
+m2
+jmp *r0
+L47: .data 446, 259, 732
+rts
+L48: dec L51
+m2
+bne L86
+not *r7
+L49: sub L2, r3
+dec *r1
+dec r2
+rts
+jmp *r7
+m1
+dec *r5
+m1
+red r6
+L50: .string "bxipiehak"
+jmp *r7
+sub r7, *r2
+m0
+L51: prn #55
+m3
+sub #-208, r1
+L52: rts
+clr *r1
+m4
+L53: lea L51, *r1
+cmp #-236, r2
+m3
+stop
+stop
+m4
+L54: .data -845
+; comment
+prn L67
+not L115
+lea L79, *r1
+rts
+m1
+m3
+inc *r1
+m0
+L55: .data -784
+clr L23
+m4
+L56: mov #102, r3
+bne *r7
+jmp L89
+L57: .string "nodyaw"
+add #-74, L68
+m2
+jsr *r0
+rts
+lea L76, *r0
+cmp L51, #167
+mov #30, r3
+m0
+mov r6, *r0
+jmp L115
+not r2
+mov r5, L82
+L58: not L87
+L59: bne *r6
+cmp #34, #-50
+stop
+clr r4
+inc L11
+L60: red r4
+stop
+mov #-139, r6
+jmp L66
+L61: not *r7
+L62: mov #193, *r1
+clr L5
+bne *r4
+sub L63, r4
+bne L83
+rts
+m2
+cmp #-165, r7
+prn L28
+m1
+jmp *r1
+m0
+add L75, *r7
+L63: cmp #-148, #107
+L64: cmp r7, *r6
+L65: .data -494, -103, 867
+inc *r0
+bne *r0
+jmp *r2
+m1
+jsr L71
+rts
+inc L107
+L66: .string "zqtawiet"
+prn L25
+dec *r6
+stop
+add r2, L52
+L67: .data 707, 409, -5, -346, 327, -406, 30, -932
+sub *r2, L23
+rts
+L68: prn L14
+dec L104
+inc *r1
+m4
+jsr *r5
+
+L69: .string "klqmdmsmznv"
+m2
+red L31
+L70: .data 604, 187, -950
+L71: .data 303, 168, -968, 745, -328, -849, -122, 974
+m4
+bne *r7
+m3
+clr r6
+clr r5
+L72: add *r6, r0
+m4
+clr L49
+lea L111, *r5
+not L98
+
+m0
+dec L45
+L73: .data -199, 9, 935, 233, 409
+m0
+cmp #183, r2
+L74: .string "qahzyacavjrmfchtkbqv"
+sub *r4, r5
+inc L75
+L75: .data 238, 206, 958, 420, 135, 517, 444
+not r0
+m0
+L76: cmp *r6, r7
+m4
+
+prn r7
+mov *r3, L63
+jsr *r7
+m3
+not *r3
+not L115
+L77: .data 596, 761, 444, -950, -524, -909
+m0
+clr *r4
+L78: red *r7
+prn r6
+L79: bne L16
+add L104, L7
+clr L106
+m4
+clr L11
+
+m0
+L80: prn #132
+red r3
+L81: sub L17, L116
+sub r3, *r7
+lea L50, L31
+clr r0
+lea L118, L94
+clr L108
+stop
+clr L70
+sub *r6, r2
+L82: .string "cbqh"
+
+m2
+L83: red r6
+lea L89, r2
+L84: lea L111, r7
+L85: .string "cflwisgqgw"
+rts
+m4
+L86: rts
+clr *r7
+m0
+jmp *r3
+lea L87, *r4
+lea L33, *r2
+red L1
+L87: mov *r4, L75
+sub *r0, L105
+L88: sub r4, r2
+; comment
+m0
+L89: bne L85
+L90: .string "qkqgiteih"
+bne *r6
+jsr L97
+add r3, L18
+jsr *r1
+m4
+jsr *r7
+m1
+L91: red *r7
+
+L92: not *r1
+L93: prn r1
+; comment
+L94: .string "rfpvabhkkbxiivwxgjnrlk"
+not L53
+L95: .string "naxjuwwgakipwnpbcpvzt"
+L96: clr r2
+L97: dec *r0
+sub L99, L78
+jsr L37
+dec L67
+prn L2
+L98: sub r0, r3
+L99: .data -127, -787, 570, -383, 950, 10, -913
+L100: prn L62
+L101: inc *r6
+m1
+stop
+stop
+prn r2
+prn #6
+L102: clr L91
+m1
+m4
+L103: stop
+
+prn L104
+m1
+mov *r5, r7
+m4
+m1
+L104: bne *r3
+sub #-117, *r1
+red L75
+L105: .string "wkujfkxzqyfz"
+jsr L117
+jmp *r3
+rts
+m3
+L106: .data -709, 854, 762, 233, -476, 80, 506
+prn r1
+rts
+m4
+L107: dec L112
+cmp L97, *r3
+jsr *r7
+stop
+add L109, L115
+add *r3, L63
+sub *r5, *r7
+m0
+mov L117, r6
+jsr *r7
+cmp r5, L120
+L108: stop
+L109: bne L110
+L110: .string "xqkospvdgab"
+m2
+inc L80
+mov *r6, *r6
+mov r7, r7
+bne L112
+L111: .data 499, -850, -824
+jmp *r0
+L112: .string "fcoslgrlkzrgnvfmlbog"
+mov *r2, r4
+lea L115, L116
+clr r5
+lea L55, L109
+jsr L119
+sub r6, r7
+prn *r6
+L113: .data 585
+lea L118, *r1
+rts
+L114: lea L16, L117
+m1
+L115: jmp L73
+m0
+jsr L116
+red L117
+L116: mov *r7, r6
+cmp *r3, #-200
+m1
+m0
+L117: .string "weulgnsvzqftwnn"
+not *r3
+inc L70
+rts
+m4
+lea L119, r6
+prn L120
+cmp L119, *r5
+L118: mov r7, *r4
+L119: .string "ppfakugldpkwouahhxnogjxn"
+L120: cmp #1, L51
+m1
+jsr L32
+inc *r6
+stop
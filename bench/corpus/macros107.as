@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 108
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    add *r0, r1
+    not r0
+    not L61
+    dec r4
+    mov L52, *r1
+    lea L19, L114
+    dec L19
+    bne *r4
+    jsr L105
+    mov r1, r7
+endmacr
+macr m1
+    bne L103
+    prn L18
+    bne *r6
+    inc r7
+    stop
+    jmp *r0
+    sub #-146, L0
+    stop
+    dec L11
+    bne *r4
+endmacr
+macr m2
+    bne *r5
+    jmp L101
+    add *r7, L47
+    bne L38
+    cmp *r3, r0
+    add *r4, L54
+    jsr *r5
+    jsr *r0
+    sub L95, r1
+    sub *r6, *r2
+endmacr
+macr m3
+    dec L100
+    dec *r6
+    cmp r7, L28
+    inc *r2
+    red r2
+    mov r4, *r3
+    clr L65
+    red L34
+    add #-25, L43
+    inc *r4
+endmacr
+macr m4
+    stop
+    jmp L107
+    dec r5
+    stop
+    jsr L72
+    stop
+    not r2
+    red r7
+    mov r6, r4
+    dec L83
+endmacr
+lea L102, r0
+L0: sub r7, r0
+L1: clr *r2
+bne *r4
+dec r1
+L2: .data 636, 67, 299, -717, -622, -49, -780, 712
+add r3, r4
+L3: .string "mupakzfbhoblfppvyxrd"
+cmp #158, #51
+L4: red L4
+stop
+m3
+m3
+m0
+m0
+L5: not *r0
+add r6, *r0
+cmp r2, r3
+m1
+L6: .data -181, -711, -44
+m2
+m4
+bne *r7
+; comment
+red L60
+L7: stop
+m2
+bne *r4
+cmp #-83, r2
+L8: .string "bykonlaylbinfyokte"
+dec L1
+jsr *r1
+inc *r1
+not r1
+m1
+add *r3, *r7
+jmp L5
+L9: .data -213, -897, -156, -30, -366
+L10: mov #197, r1
+lea L6, L31
+sub L26, *r3
+add L28, r1
+red r1
+L11: inc *r5
+L12: clr *r6
+m3
+L13: .data 922, -917, -100, 708, -629, 760, -443
+L14: add #38, L6
+L15: prn *r4
+L16: .data -509, 637, -906, -361
+cmp L58, L78
+jsr *r2
+red L4
+L17: .string "qokoewglshllkpjyfoxrhydz"
+lea L7, r3
+m0
+m4
+jmp *r6
+m3
+L18: rts
+L19: red L10
+clr L18
+add #-35, r6
+m1
+jsr L6
+stop
+cmp L10, r5
+prn *r7
+dec r3
+lea L15, L3
+sub r4, r3
+add r1, *r7
+cmp #213, #-164
+cmp L6, r3
+m1
+not L18
+L20: .data -164
+add #226, *r2
+dec L8
+add *r0, L19
+jsr L14
+lea L56, *r2
+red r1
+L21: bne *r6
+m4
+add *r4, L18
+not L17
+red *r2
+
+rts
+L22: .data 175, -694, 427, 26, -775
+m0
+rts
+L23: add #228, r2
+stop
+cmp #57, r2
+bne L1
+red L26
+clr r1
+jmp L111
+L24: .string "nmndksuwzuqpafbmugfosc"
+L25: dec L11
+L26: clr *r6
+red *r5
+L27: stop
+L28: sub *r6, *r0
+m0
+not L13
+m1
+red *r2
+L29: dec *r3
+L30: inc L14
+mov #255, r3
+m4
+L31: clr *r2
+rts
+cmp #-137, L61
+rts
+; comment
+jsr L21
+L32: .string "siiolternbjqrezuvgaxjx"
+stop
+dec r2
+m3
+rts
+inc r0
+L33: inc *r1
+not *r4
+jsr *r1
+m0
+m3
+lea L18, L80
+m2
+mov r4, r3
+clr r2
+m1
+dec r2
+L34: dec *r4
+sub L61, *r7
+L35: .data -167, 556, 645, -173
+
+add L4, r5
+L36: sub #-132, r6
+rts
+bne *r7
+L37: lea L72, L35
+m1
+; comment
+m2
+
+jsr *r2
+red L88
+dec L10
+L38: jsr *r0
+m4
+; comment
+rts
+L39: mov *r5, *r4
+sub *r0, L33
+
+mov r3, *r0
+; comment
+rts
+L40: not r1
+jmp *r4
+; comment
+L41: jmp L2
+sub *r2, *r4
+dec *r4
+
+cmp #-34, r0
+clr L94
+m3
+stop
+rts
+
+mov r3, L85
+m0
+m2
+; comment
+dec *r2
+bne L39
+m1
+jsr *r5
+m0
+m0
+L42: .data 255, 143, -846, -299, -367, 348, 5
+L43: mov r0, r4
+bne L24
+jsr L83
+m3
+stop
+sub L84, L9
+m1
+L44: red *r6
+prn #0
+L45: .data -309, 161, 474
+L46: .string "savvivicw"
+L47: .string "qoaf"
+jsr L54
+add #-141, r0
+L48: inc r7
+not r4
+lea L22, r7
+L49: mov *r1, *r2
+rts
+mov r7, L6
+m3
+m0
+bne *r5
+m3
+add r4, r3
+stop
+lea L68, L44
+jsr *r3
+inc *r6
+L50: .string "vfianbrsjszzleklklt"
+prn r3
+cmp r1, L69
+L51: sub *r2, r3
+m4
+sub *r0, *r2
+jmp L15
+
+rts
+add r2, r6
+not r5
+not L52
+red L36
+m3
+clr *r6
+rts
+L52: .string "qzeccilcnufyo"
+add r3, L27
+inc *r5
+mov r2, *r0
+L53: jmp L24
+m0
+; comment
+m1
+rts
+clr r7
+inc r3
+sub #123, *r2
+bne *r5
+L54: dec r3
+not L73
+mov #-13, L18
+L55: prn L107
+m0
+; comment
+m4
+mov #11, r4
+add r0, r0
+mov #-66, L22
+red *r0
+dec *r6
+cmp L54, #47
+red L100
+lea L91, L19
+
+L56: .string "hwnnm"
+bne L85
+m2
+rts
+dec r4
+cmp #-139, r4
+add #149, r4
+add #-164, *r7
+L57: .string "jnefksasxydsfxadopquxj"
+m4
+L58: not *r3
+add r4, r4
+clr r7
+mov L2, L21
+stop
+; comment
+dec *r7
+not L46
+m4
+inc L20
+m0
+clr L58
+lea L68, L90
+jsr L37
+; comment
+dec *r0
+L59: add #-17, r3
+L60: inc *r4
+m4
+dec L34
+L61: .data -274
+L62: bne *r7
+m0
+bne *r1
+L63: cmp *r5, L8
+; comment
+jsr L107
+lea L85, *r4
+add L108, r1
+L64: jmp L44
+prn L100
+L65: jsr *r5
+bne L25
+L66: .data 457, 100, -952, 258, -19, -509
+m1
+jsr L44
+m4
+clr *r4
+bne L92
+
+m0
+rts
+jsr L8
+mov *r2, r3
+prn *r3
+dec *r3
+sub *r1, *r0
+bne L23
+m2
+m4
+stop
+jmp L80
+lea L102, L111
+jmp L103
+m1
+add r3, r1
+m1
+sub L91, r4
+L67: .data -516, -719, 711, -251, -58, 10, 561, -810
+m4
+red L109
+mov L116, r2
+m1
+sub *r0, *r6
+L68: .data -274, -829, -109, 372, -78, -571, -883, -882
+dec L107
+L69: .string "gnqhosynmuzekkbrwppgz"
+prn r4
+prn r3
+L70: .string "noepzrbonz"
+prn #76
+L71: jmp *r6
+add #-252, r5
+sub #-65, L38
+mov *r2, r2
+
+rts
+add r3, r1
+inc L77
+m1
+prn *r6
+m4
+m3
+red L97
+sub r1, r1
+m1
+stop
+L72: not L100
+mov #-69, L70
+sub *r4, r7
+L73: mov #-232, *r6
+L74: bne L53
+L75: .data -648, -132, 305, 61, 733
+L76: .data -792, -979, -648, -699, -311, -457, -762, -295
+rts
+not L58
+L77: red L61
+stop
+L78: add L12, r5
+L79: prn L59
+lea L59, r3
+jsr *r0
+L80: rts
+L81: .string "ufmjovrtkcwebqmyl"
+m3
+cmp *r3, #243
+L82: rts
+L83: stop
+sub L107, *r2
+L84: dec r2
+jmp L40
+; comment
+L85: bne L92
+clr r1
+L86: rts
+not L98
+lea L46, L114
+cmp #-232, L45
+stop
+m0
+L87: .string "zljv"
+L88: not *r7
+m0
+L89: .data 904, 584, -323, -101
+lea L98, L92
+m4
+L90: .string "fhpeloulzjixeufxihox"
+L91: mov *r0, L84
+L92: clr L103
+m4
+L93: .string "keqgcvlzxnr"
+cmp #174, *r7
+jsr L83
+rts
+L94: .data -731, -478, -647, -331
+jmp *r5
+m2
+L95: .string "gvfphpsae"
+bne L16
+mov #126, L112
+L96: add L109, L37
+L97: .data -531, -434, 839, -503, -407, -308, -612, -806
+clr L113
+L98: stop
+prn r5
+not r3
+m0
+jmp *r6
+dec *r7
+mov #184, *r4
+L99: sub *r4, L116
+jsr L114
+jsr *r2
+add *r6, r5
+jsr L101
+dec L20
+lea L25, r4
+; comment
+m4
+
+cmp r6, L104
+jsr L104
+clr *r6
+lea L113, L109
+lea L57, r4
+rts
+L100: bne L94
+inc r2
+mov r0, *r1
+sub L111, r0
+prn L116
+stop
+prn r2
+sub L111, *r0
+L101: .string "cgmgkhxmqdfqxjtqaiiuzki"
+L102: .string "thpm"
+L103: inc L111
+add *r5, r3
+mov r2, r0
+; comment
+L104: .data 371, 131, -5, -773
+L105: .data 427, -420, -233
+prn r0
+rts
+m3
+cmp *r0, *r3
+clr L114
+m0
+lea L116, L57
+bne *r0
+
+L106: .string "dbymgtjjvoj"
+L107: cmp *r0, r7
+add #-159, r7
+jmp *r6
+L108: .string "zjdkblduvkw"
+L109: rts
+add *r2, r3
+m3
+m4
+L110: .string "feknczqpmjicnyi"
+L111: clr L116
+dec r1
+L112: .data -726, 288, 779, 282
+red r5
+red *r5
+stop
+
+stop
+L113: .data -548
+L114: add *r2, *r4
+m4
+bne L115
+not r1
+L115: .string "axlhnt"
+add L116, L116
+m2
+sub L49, *r6
+stop
+prn r2
+mov *r5, r5
+; comment
+cmp L98, L5
+not *r4
+m3
+m0
+L116: jsr *r4
+rts
+m3
+stop
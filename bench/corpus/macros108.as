@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 109
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    dec r1
+    rts
+    lea L51, r7
+    inc *r6
+    sub L87, r2
+    stop
+    jmp *r1
+    dec L48
+    cmp L6, L119
+    inc r2
+endmacr
+macr m1
+    add *r6, L58
+    jmp *r6
+    inc *r1
+    stop
+    jmp L73
+    clr *r1
+    sub L35, L13
+    bne L43
+    red L28
+    cmp *r5, L7
+endmacr
+macr m2
+    dec r1
+    lea L80, L95
+    jsr *r6
+    add r7, *r3
+    not *r4
+    cmp *r0, r2
+    dec r0
+    inc r1
+    jmp *r7
+    rts
+endmacr
+macr m3
+    red L110
+    add L52, L40
+    stop
+    inc r5
+    dec L6
+    red r2
+    rts
+    red r7
+    prn *r1
+    stop
+endmacr
+macr m4
+    inc L30
+    jsr *r0
+    bne L57
+    add *r6, L11
+    inc r1
+    inc r4
+    lea L28, r7
+    cmp L58, *r2
+    not L12
+    stop
+endmacr
+lea L50, r2
+m1
+stop
+add L86, L53
+add L12, r7
+mov #116, *r6
+m1
+mov *r5, *r3
+L0: .data 88, -346, -516, -541
+L1: .data -582, 508, 98
+; comment
+cmp *r7, #51
+L2: prn L36
+m1
+dec L1
+rts
+not *r5
+; comment
+m4
+L3: not L67
+L4: not *r5
+bne *r0
+bne L4
+jsr L1
+; comment
+L5: .string "e"
+jmp L22
+not L17
+stop
+L6: .data 22, 431
+L7: jsr *r4
+cmp r4, *r3
+lea L72, *r5
+L8: .string "svktagtcpzexzjzuegdx"
+L9: .string "jvgkmzkbahkjijn"
+m2
+red r6
+L10: .string "aycnoxvlheghy"
+L11: lea L44, L2
+m1
+prn *r0
+sub L5, L9
+jsr *r1
+sub *r3, L11
+red *r0
+L12: .data 214
+not *r4
+m0
+L13: cmp #138, #221
+L14: prn L12
+L15: add L84, L28
+m1
+prn L10
+clr *r6
+not r7
+jmp L80
+m2
+add #105, L15
+prn #-85
+cmp L5, r7
+m3
+
+add r6, L81
+m2
+not L2
+stop
+L16: red L15
+cmp #-33, r0
+L17: .string "bmafgdhl"
+clr r5
+L18: sub *r5, r0
+L19: bne *r5
+add *r6, r1
+jmp L54
+L20: .string "xdvzcnplhwxrn"
+m1
+m0
+L21: add L72, *r4
+mov L1, L49
+dec *r4
+dec L34
+sub #-201, r2
+not L5
+L22: red *r1
+lea L65, L125
+m2
+jsr L2
+clr r4
+m4
+
+lea L19, r7
+jsr *r3
+add *r5, *r7
+m4
+L23: .string "ejzhosrbrgrgxjlblswh"
+prn *r6
+L24: dec L24
+inc *r3
+rts
+rts
+m0
+m1
+rts
+L25: .data 451, 617
+not r5
+m0
+L26: jsr L5
+stop
+m3
+L27: .data 835, -605, -762, 319, -685, -759, -202
+jsr L78
+L28: dec *r2
+L29: jmp L31
+L30: .data -236, 64, -273
+mov #3, r6
+L31: jsr *r0
+L32: red *r5
+m4
+stop
+bne L77
+L33: mov L43, *r1
+L34: inc L64
+dec r3
+mov L31, L19
+inc *r1
+rts
+m0
+red *r5
+inc *r2
+add *r0, r7
+L35: bne L42
+L36: lea L10, *r2
+bne L20
+L37: sub #-160, r3
+m1
+clr L57
+mov #200, r0
+cmp #86, #9
+L38: .data -149, 171, 273, -673
+dec *r3
+
+L39: inc r7
+lea L120, *r3
+m2
+m2
+bne L26
+m0
+jsr *r3
+clr r5
+stop
+L40: .data 821
+red *r5
+mov L124, L50
+stop
+prn *r7
+m3
+m2
+L41: rts
+
+
+L42: .data 340, 7, 542, 576
+inc r3
+L43: not *r2
+L44: mov #245, r1
+m3
+m4
+jmp *r7
+L45: red r0
+add *r6, *r7
+dec *r5
+sub r5, r1
+jmp *r0
+m3
+dec r7
+sub #106, *r2
+stop
+add r3, L92
+prn L115
+rts
+
+red L74
+clr *r2
+L46: .string "klhldsamktt"
+inc *r5
+m0
+lea L69, *r4
+clr L2
+mov *r1, *r7
+rts
+L47: inc r2
+lea L63, r0
+dec *r3
+stop
+cmp r6, r4
+red L88
+L48: red *r0
+rts
+m1
+sub L48, r4
+L49: add L70, *r1
+m3
+dec *r7
+
+m4
+L50: .data 826, 61, 59, -927
+lea L84, r5
+inc r0
+red L52
+L51: stop
+m2
+clr r7
+mov L22, *r5
+dec L114
+L52: not L15
+L53: jmp L79
+m1
+mov r3, *r0
+stop
+
+cmp L28, L102
+red L52
+lea L11, r6
+bne *r1
+prn #54
+cmp *r6, L39
+rts
+stop
+; comment
+m2
+jmp *r1
+bne L83
+L54: lea L98, L64
+L55: .string "yxnavgioggyxzbvuklwyyyly"
+L56: .string "jewog"
+L57: .data 548, 862, 411, 377, 100
+m1
+cmp *r1, *r1
+lea L100, L125
+add #-66, *r0
+L58: .string "grq"
+m3
+L59: .data 756, -686, -19, -547, -292
+sub #-243, r0
+L60: .data -500, 33
+add r1, *r4
+inc L21
+jsr *r1
+mov L76, L18
+rts
+cmp r7, L111
+lea L2, r3
+not *r4
+jsr L5
+prn *r6
+L61: inc L117
+jmp *r0
+mov L12, r1
+m1
+L62: stop
+m0
+lea L34, L4
+m1
+jmp L57
+jmp L25
+
+m4
+sub *r5, L125
+bne *r5
+mov *r1, r3
+inc *r6
+L63: .string "pogymburnjyoc"
+mov L55, r0
+stop
+not *r7
+L64: .string "azimyxnt"
+inc *r6
+L65: rts
+m4
+L66: sub #-120, r3
+add *r5, L58
+m1
+prn *r7
+not L124
+L67: .data 752, -473, -131, -151, 683, -551, 28
+L68: .data 729
+L69: .data -236, -587, -978
+; comment
+L70: .data -529
+L71: .string "vd"
+red L43
+not *r4
+L72: sub *r6, *r7
+clr L75
+jmp *r6
+lea L121, L16
+
+m2
+L73: .data 592, -305, -955, 980, 670, 588
+; comment
+stop
+red L0
+jmp L94
+clr r2
+L74: red L48
+sub r5, L82
+L75: jmp *r2
+sub r5, *r4
+L76: .data -369, 482
+inc r7
+
+jsr L64
+L77: sub r5, r4
+L78: red *r2
+red *r7
+jmp *r2
+m2
+L79: .data -970
+L80: clr L68
+jsr *r0
+dec *r2
+stop
+not L49
+sub L7, r7
+rts
+m3
+L81: mov *r5, *r5
+L82: not *r2
+prn *r4
+m3
+red *r2
+inc L123
+sub #196, r0
+mov r6, L52
+cmp #65, *r6
+jsr *r5
+mov *r1, *r0
+jsr L102
+m2
+not L21
+L83: .string "fiofhxkaqaf"
+L84: inc *r0
+stop
+rts
+m4
+L85: .data -571, -545, -291, -196, -847, -733, 54
+inc r7
+dec L84
+prn #91
+m3
+L86: add #0, *r7
+lea L25, L117
+m0
+lea L92, r7
+L87: .string "ehg"
+m4
+jmp L99
+sub L56, *r5
+m0
+not *r6
+stop
+red *r5
+jmp L77
+m3
+bne *r6
+L88: dec *r4
+bne *r3
+inc L120
+sub L96, L101
+cmp #-3, #-134
+
+jmp *r7
+L89: jsr L122
+m1
+L90: clr *r2
+L91: .string "ldtm"
+clr L67
+cmp *r2, L108
+L92: .string "i"
+m2
+L93: .data -107, -781, 629, -801, -215
+bne L102
+cmp *r7, *r6
+L94: not *r4
+jmp L71
+L95: mov L119, L101
+L96: clr *r5
+prn #29
+bne *r4
+L97: .string "mrqsx"
+clr *r7
+rts
+L98: .string "vgimh"
+jmp L113
+m0
+lea L103, *r6
+L99: sub L108, r2
+L100: .data -981, -909, 843, -860
+mov *r7, r0
+clr *r5
+add r6, *r5
+stop
+red L107
+add L103, *r7
+jmp *r2
+m1
+L101: not *r2
+mov L47, L18
+m3
+m2
+not r2
+lea L113, r6
+m3
+clr *r0
+cmp L75, #-126
+stop
+m2
+L102: jmp L103
+lea L48, r0
+m1
+jmp L51
+red *r4
+sub *r3, r0
+L103: .data -197, 820, 192, 563, 573, 35, 658, -926
+jsr *r3
+lea L95, *r3
+dec r6
+L104: .data -31, -182, 257, -941, 992
+jmp *r2
+L105: lea L22, L83
+red r0
+L106: .string "vnsn"
+L107: prn *r7
+L108: rts
+L109: not *r5
+L110: mov #98, *r6
+m3
+m3
+L111: jsr L12
+m0
+prn L39
+m4
+jsr *r0
+m4
+L112: .data 176, -553, 861, 651
+mov #240, *r0
+L113: red *r2
+add #195, r5
+jsr L81
+jmp L29
+lea L114, r6
+inc r2
+lea L115, *r3
+rts
+jsr L109
+prn *r7
+add L11, L121
+m0
+L114: .string "sywfxyvqr"
+L115: .string "bmsubfdorcaz"
+add L32, L121
+jmp L11
+add *r7, *r3
+sub #122, r0
+L116: stop
+not L8
+inc *r5
+L117: inc r3
+L118: jsr L124
+L119: .string "aolbxyqzx"
+; comment
+rts
+dec r1
+L120: cmp *r7, L125
+L121: rts
+m1
+clr L125
+jmp L123
+cmp *r4, #-76
+m0
+
+jmp L87
+m2
+m2
+prn L125
+L122: clr *r3
+rts
+m2
+jmp L125
+cmp *r1, L65
+L123: .string "aowknovfzsa"
+jmp *r3
+stop
+red *r3
+m1
+L124: sub r7, r1
+not r3
+m0
+L125: .string "argpqlxfzuccetnw"
+lea L42, L94
+dec L118
+stop
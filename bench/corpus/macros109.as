@@ -0,0 +1,568 @@
+; Generated by genCorpus --seed 110
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+macr m0
+    dec *r4
+    red *r7
+    cmp *r3, *r2
+    jmp *r2
+    bne L47
+    jsr L55
+    add r7, *r5
+    red r7
+    prn r1
+    lea L9, r0
+endmacr
+macr m1
+    not r3
+    mov #16, r7
+    mov *r5, r4
+    dec r7
+    red r3
+    rts
+    clr L84
+    lea L33, r4
+    jsr *r5
+    add #250, r6
+endmacr
+macr m2
+    cmp r2, L72
+    not *r5
+    cmp *r0, r2
+    jmp *r4
+    rts
+    cmp *r5, L30
+    clr L36
+    prn L25
+    red L62
+    not L23
+endmacr
+macr m3
+    jmp L4
+    jmp L46
+    cmp L65, L54
+    jmp L30
+    prn r1
+    sub *r6, L16
+    add r6, r4
+    mov L36, r2
+    prn *r6
+    stop
+endmacr
+macr m4
+    mov #-237, r2
+    rts
+    add L42, *r4
+    add #31, r5
+    red L34
+    add L76, *r2
+    jsr L37
+    prn L34
+    mov *r6, L55
+    cmp #-193, L80
+endmacr
+dec L49
+L0: mov *r0, r4
+m4
+m2
+; comment
+clr L0
+sub L0, L0
+not *r3
+bne *r6
+rts
+L1: inc r4
+m2
+mov r6, r5
+m2
+prn L0
+jmp L1
+L2: .data 206, -598
+L3: .data 487, 807, 749
+m1
+
+; comment
+m4
+m1
+
+inc *r7
+jsr L80
+L4: lea L73, L0
+clr r1
+clr r2
+lea L0, r7
+m1
+m4
+m4
+clr *r5
+L5: sub r1, L13
+prn *r7
+; comment
+m4
+cmp *r1, L58
+prn r6
+stop
+rts
+m1
+jsr *r1
+mov r7, r1
+stop
+m4
+L6: dec *r0
+L7: .string "qvckikskwtumjk"
+L8: .data -630, 642, 961, 810, 874
+cmp #-27, L5
+L9: .string "hjdcrik"
+not L52
+m4
+m2
+rts
+jsr *r5
+stop
+; comment
+L10: .string "klfjcoksqviwesop"
+L11: not r5
+red L42
+prn *r7
+m3
+not r6
+L12: jsr L9
+m3
+jsr L5
+sub *r3, L6
+
+clr r6
+prn #139
+inc *r6
+jsr *r3
+L13: clr r0
+
+jmp *r7
+L14: lea L4, r3
+add L6, L56
+sub #162, r4
+mov *r3, L11
+jsr L60
+bne *r0
+bne L2
+m0
+m3
+; comment
+prn r2
+add #58, L46
+
+clr L14
+L15: mov L37, L1
+
+sub L63, r0
+L16: .string "nidgltssfwhbibutkxoxkpx"
+L17: .data -172, -74, 279, 398
+cmp #-127, r3
+m4
+L18: rts
+red *r4
+clr L12
+cmp *r6, r6
+mov *r1, *r3
+stop
+m2
+inc *r2
+add #208, *r0
+clr r1
+
+red r1
+jmp *r0
+; comment
+lea L5, r3
+stop
+cmp #129, L48
+L19: .data -95, 685, -455, -241, -732, -421, 458
+jmp *r6
+m3
+stop
+
+add L58, *r0
+jmp *r0
+cmp L16, r7
+red L8
+bne L12
+m0
+clr r3
+m0
+clr L9
+L20: .string "vjdgbslbujefimuunbxemxd"
+m0
+add *r2, *r0
+L21: .string "jcebqbzmtwzm"
+add r5, r0
+jmp L31
+add *r0, *r1
+m2
+dec *r7
+bne *r6
+cmp L6, *r3
+jsr L2
+stop
+L22: sub *r0, r4
+add L8, r7
+L23: cmp #38, r3
+L24: red *r0
+m0
+dec *r3
+m1
+sub #-111, L78
+dec *r7
+L25: .string "qdkoirkzafiwfvtnfmyb"
+; comment
+L26: red L50
+m2
+bne *r6
+jsr L12
+inc r4
+stop
+L27: .string "uocyzilusrejjiwssdgr"
+jmp *r5
+red L20
+add *r3, L22
+rts
+red *r4
+m0
+not L30
+prn r6
+lea L51, L57
+clr L67
+L28: cmp L3, L2
+not *r1
+not r3
+L29: .string "vufbynfrwcmoijh"
+m4
+clr *r0
+L30: .data 792
+sub #-241, *r6
+dec r1
+m3
+stop
+jmp L9
+rts
+inc L19
+inc r7
+add *r5, L21
+mov *r0, L16
+L31: .data 135
+m2
+
+m0
+m4
+m4
+m3
+inc L50
+prn #70
+lea L77, r2
+stop
+add *r7, r1
+L32: red *r3
+cmp r4, L75
+m0
+; comment
+L33: lea L10, *r7
+inc *r1
+jmp *r6
+m3
+bne L7
+clr L33
+sub *r3, *r7
+add *r3, r3
+m1
+; comment
+m2
+jmp *r5
+jsr *r4
+jsr L48
+not r5
+dec r5
+clr L32
+cmp L19, #-173
+cmp L6, #95
+jmp L79
+red L17
+L34: inc r1
+bne L70
+inc r7
+m4
+m0
+m3
+prn L63
+L35: stop
+L36: .string "mrhjzkomazxfonjbt"
+m2
+stop
+m0
+m0
+jsr L83
+inc L73
+m1
+L37: sub *r1, *r2
+bne L36
+bne *r0
+clr L80
+
+jsr *r2
+
+m0
+dec r4
+m1
+not r1
+clr L6
+m4
+mov *r4, r4
+m1
+m2
+inc r3
+clr L68
+inc L31
+L38: .data 737, 813, -481, -62, 666, 238
+bne L57
+jsr *r5
+rts
+m0
+stop
+
+red *r1
+L39: rts
+L40: .data 594, -899, 294, 545, 976, -833
+cmp L18, L8
+m2
+lea L70, *r5
+lea L35, r2
+sub r6, *r3
+stop
+mov *r6, r3
+inc r7
+not *r0
+; comment
+m4
+add *r5, *r7
+cmp #-233, L22
+m1
+L41: .data 885, 866, 748, -962, 63
+
+inc L76
+clr r5
+stop
+L42: .string "ueuim"
+m0
+inc *r4
+L43: rts
+inc L23
+bne L17
+rts
+prn L69
+
+m0
+L44: inc *r5
+bne *r7
+lea L54, L13
+stop
+mov r6, L41
+m1
+stop
+; comment
+dec *r5
+lea L57, r5
+m2
+L45: red r1
+sub *r0, L46
+m2
+not *r0
+m0
+sub r0, L68
+m3
+L46: rts
+
+L47: .string "jakjnqyormvic"
+m0
+stop
+L48: lea L9, *r4
+m0
+m1
+prn #-49
+add #-21, *r4
+jsr *r4
+clr L42
+not *r4
+lea L83, *r2
+inc *r6
+sub *r1, r3
+stop
+L49: stop
+m3
+jsr *r7
+clr r2
+m4
+inc *r2
+bne L71
+add r2, L49
+m3
+clr *r2
+m2
+cmp L83, #-215
+L50: .string "neyxuqohr"
+clr *r6
+L51: .string "yzjxmyucdvmqszkftkekhx"
+stop
+m4
+m0
+L52: .string "agtvbgeokvsrkanitwcxgeh"
+L53: .string "ennefyzxdsvfjalk"
+L54: prn *r1
+L55: .string "xwtneph"
+rts
+mov L6, r7
+jsr L76
+L56: cmp r4, #189
+inc r7
+bne *r2
+add #-83, *r0
+m4
+jsr L45
+cmp #90, L72
+prn L29
+rts
+L57: bne L11
+
+clr L71
+m1
+red r5
+; comment
+red *r6
+L58: sub r1, L15
+jmp L74
+L59: .string "vgbzebcjabf"
+mov L71, L24
+m0
+L60: cmp *r6, *r2
+L61: not r0
+rts
+cmp *r0, r6
+jmp L82
+jsr *r0
+mov *r2, L71
+jmp L46
+m3
+jmp *r6
+L62: inc L80
+jsr *r7
+; comment
+L63: .string "sgucjb"
+L64: bne L80
+not *r4
+jsr *r2
+m4
+L65: .data 218, -901, 140, -750, -593, 986, 668
+rts
+mov r2, r2
+rts
+add #-158, r7
+lea L41, *r0
+m2
+m4
+L66: .string "zk"
+L67: .string "zkaumszi"
+bne *r4
+not L75
+L68: stop
+jmp L84
+sub r7, L9
+lea L10, *r3
+bne *r5
+bne L29
+jsr L77
+not L24
+m0
+m3
+jmp *r6
+red *r3
+; comment
+lea L13, r3
+lea L70, L83
+; comment
+m4
+L69: cmp L82, *r0
+cmp #-44, *r7
+dec r6
+; comment
+dec *r0
+L70: inc r4
+sub L80, *r7
+m3
+m3
+not r1
+inc *r1
+bne *r3
+m2
+red r3
+prn r0
+L71: cmp *r7, *r5
+
+not *r7
+clr *r1
+m1
+cmp *r1, L84
+L72: stop
+jsr L74
+stop
+mov L77, r1
+L73: dec r2
+L74: mov *r1, L84
+L75: prn L34
+L76: cmp *r2, *r7
+
+L77: not L19
+jsr *r2
+L78: not L80
+add L84, *r4
+lea L84, *r5
+inc *r3
+add #-146, L80
+sub r5, *r1
+jsr *r6
+dec L80
+lea L11, r3
+dec r1
+L79: inc *r7
+L80: prn L41
+dec *r6
+dec r2
+not r4
+dec r7
+prn #-183
+m1
+bne *r7
+L81: prn #-55
+L82: lea L83, L84
+add r3, r1
+clr r5
+jmp L84
+prn r1
+dec *r5
+m4
+
+prn L84
+jmp *r7
+stop
+m3
+stop
+m0
+bne *r3
+rts
+L83: .data 998, -343, 565, 989
+sub #-140, r1
+L84: red *r6
+m1
+dec L1
+red L37
+stop
@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 12
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    bne *r7
+    clr *r0
+    not r2
+    add L13, r6
+    jmp *r3
+    sub *r3, *r4
+    sub L58, *r4
+    lea L58, *r1
+    inc L41
+    mov #-21, *r4
+endmacr
+macr m1
+    clr L46
+    inc r7
+    clr r3
+    red r4
+    cmp #219, *r6
+    inc L17
+    cmp #-169, #-24
+    add #-130, r6
+    not L116
+    add r1, r6
+endmacr
+macr m2
+    mov L97, *r5
+    clr r3
+    not r1
+    rts
+    red r4
+    cmp L84, *r3
+    red r2
+    bne *r7
+    mov L106, L82
+    cmp r6, L58
+endmacr
+macr m3
+    red *r7
+    sub #-214, *r3
+    prn *r0
+    inc r2
+    bne *r6
+    mov #37, r3
+    add L100, *r7
+    jmp L110
+    mov r6, L16
+    cmp *r1, #189
+endmacr
+macr m4
+    jsr L95
+    sub r2, r4
+    mov L105, *r4
+    jmp *r2
+    stop
+    prn *r5
+    stop
+    lea L75, *r7
+    jsr L34
+    jsr L18
+endmacr
+sub r5, r2
+jsr L39
+jsr *r4
+clr L13
+add L70, r0
+jsr *r7
+L0: .string "urmrcxo"
+L1: stop
+prn L1
+m3
+m2
+L2: add r7, *r5
+red r5
+add #102, *r5
+m4
+jsr *r0
+; comment
+L3: .data 221, 689
+red r4
+m2
+jsr L34
+jsr *r5
+; comment
+cmp *r4, L30
+bne *r7
+m4
+
+m1
+prn *r7
+clr r5
+L4: .string "ozyngjsghpadkthkmw"
+add #-67, L0
+L5: .data 173, 695, -144, 416, -737, 938, -747, -4
+L6: bne L40
+L7: stop
+bne L63
+bne L38
+stop
+L8: dec r3
+L9: bne *r2
+L10: mov #244, L101
+stop
+red *r7
+L11: lea L3, L118
+dec L9
+L12: dec L12
+L13: red *r4
+lea L15, L5
+m1
+sub #150, r2
+jsr *r5
+dec L79
+L14: lea L38, *r7
+bne L102
+mov r4, r2
+L15: jsr L2
+
+L16: sub *r7, L16
+stop
+cmp *r4, *r0
+m2
+m1
+cmp L60, #27
+m2
+rts
+m1
+jsr L85
+m1
+jsr L13
+red *r5
+cmp #160, *r3
+cmp r1, *r1
+L17: stop
+m3
+m4
+sub r0, *r7
+L18: .string "yqmdvpbbbtbgvvey"
+rts
+jsr *r2
+mov r5, L13
+not L56
+jsr L8
+cmp *r0, *r0
+L19: jsr *r6
+red *r3
+mov r5, *r2
+m0
+
+red L46
+m3
+; comment
+L20: bne *r5
+not *r3
+; comment
+red r7
+dec r2
+dec r6
+jmp *r4
+lea L48, *r0
+L21: .string "xzatooqfw"
+m2
+clr r3
+cmp L22, L3
+L22: .data -878, -951, -239, -725, -630
+L23: inc L19
+L24: .data -349, 644, -770, -620, 334, -196
+dec *r7
+L25: dec L34
+cmp *r2, #148
+add #59, r6
+m0
+L26: .string "idcbiqmkhwpab"
+add #-15, r6
+L27: bne *r4
+
+mov #-241, L59
+L28: .string "uhrsoadgfrkg"
+stop
+L29: mov L24, r2
+L30: inc *r4
+m3
+L31: not r3
+m3
+; comment
+L32: mov L72, L101
+L33: .string "ujeo"
+add #177, r0
+rts
+m1
+red r4
+m1
+mov L50, r3
+sub r0, L6
+m3
+red *r3
+L34: .data -153, -477, -718, -739
+L35: dec L102
+cmp *r2, L83
+L36: inc *r3
+clr L108
+L37: dec L97
+L38: .data -684, -897
+L39: .data 280, -539, -892, 42, -139
+cmp L20, *r2
+lea L18, r1
+cmp *r7, #217
+inc r0
+jmp *r7
+L40: .data 263
+L41: sub #-222, L0
+m1
+L42: .string "rxcnbdzuqlymjdkyqyu"
+cmp *r2, *r5
+m1
+dec L35
+lea L88, r6
+m3
+add r5, L16
+jsr L24
+m1
+L43: .string "wjhfaifovkho"
+jmp *r7
+
+m1
+L44: cmp L59, L105
+m3
+dec *r5
+m1
+red r1
+inc r4
+m0
+red r0
+m3
+L45: clr L59
+L46: add r7, *r5
+m4
+dec r1
+L47: .data -440, -940
+m4
+m4
+lea L11, r7
+red *r1
+dec r3
+clr L35
+sub *r5, L30
+red r7
+L48: bne L117
+add *r2, *r2
+L49: .string "ueywxdnuwowre"
+clr r4
+L50: jsr L61
+L51: .data 122, 916, 858
+not *r1
+m4
+m1
+lea L83, *r0
+m1
+L52: .data 800, 194, 933, -714
+jsr *r7
+add *r2, r3
+m1
+stop
+mov #228, L39
+m4
+L53: jsr L107
+cmp r5, *r2
+m1
+inc *r5
+m1
+L54: inc *r0
+lea L93, L10
+mov L19, *r2
+L55: .string "fhcsmtoykusmobnofxl"
+L56: .string "nqfnltwbyxsjsolcovxqo"
+L57: jmp L102
+m1
+m3
+not L114
+
+dec *r1
+add r6, L29
+L58: add L67, L55
+bne *r1
+jmp *r2
+inc r0
+L59: lea L119, L21
+mov #-209, L6
+L60: jsr *r6
+bne *r2
+sub *r4, r0
+L61: .string "bhldcyvsvtcqirvn"
+prn *r2
+prn *r6
+cmp r2, #161
+stop
+; comment
+dec *r2
+L62: clr *r6
+m2
+cmp *r5, #-136
+L63: inc L30
+jsr L23
+red *r3
+L64: .data 846, -451, -941, -612, 348, -669, -222, 924
+m2
+not *r3
+L65: rts
+L66: .data 80, 408, -747, 943, -717
+sub #-184, L114
+m3
+
+not r1
+m1
+L67: prn *r3
+m3
+inc r7
+stop
+clr *r4
+; comment
+jsr L76
+m3
+not *r1
+
+red r2
+mov L35, r4
+mov r2, r5
+L68: sub *r6, r1
+m4
+prn *r2
+not r6
+m0
+bne L46
+L69: .string "tjxmvkhghbsiazkmhu"
+dec *r6
+not L82
+m3
+lea L20, L76
+red *r3
+stop
+clr r0
+L70: clr r1
+L71: .string "uurwkfosgbpawffe"
+L72: .data 630, -947, 291, 113, -890
+sub *r7, L89
+dec r4
+red r3
+L73: .string "bej"
+sub #50, *r6
+m3
+L74: jsr *r1
+L75: cmp *r0, *r6
+jsr L96
+L76: not *r1
+L77: add L10, L102
+lea L78, *r2
+m1
+stop
+not *r7
+red L38
+stop
+m2
+not r2
+lea L98, r3
+; comment
+red r5
+L78: .string "ma"
+cmp L97, #-99
+L79: stop
+sub *r6, L52
+L80: jsr *r1
+m2
+cmp L29, #-60
+L81: rts
+rts
+lea L32, L85
+rts
+red L25
+mov *r4, *r1
+stop
+m3
+rts
+rts
+sub #18, L102
+m3
+add L75, L93
+m0
+mov #-117, r1
+m3
+cmp *r5, r4
+L82: add *r4, r2
+lea L106, r2
+mov *r5, *r4
+cmp #-156, L6
+m4
+L83: .data 924, 332, -107, 589, -153, 215, -412, 425
+
+clr r6
+L84: dec *r2
+clr r1
+L85: prn L88
+inc L86
+bne L114
+rts
+sub #114, L121
+jsr *r6
+jmp *r6
+L86: jmp *r4
+mov #-20, r2
+red *r4
+
+m2
+sub r0, *r3
+rts
+not r7
+not L90
+m3
+cmp *r0, L106
+L87: stop
+m4
+L88: .data 326, -741, -368, -655, -621, -417, -461
+m1
+m1
+L89: bne *r5
+clr r7
+bne L57
+inc L71
+L90: prn r2
+stop
+jmp L95
+L91: bne *r0
+bne L26
+jmp L19
+sub #-11, *r5
+cmp r1, #236
+inc L74
+stop
+L92: .string "dyenahpvmillcqt"
+bne *r3
+stop
+L93: .data 283, -909, 100, 677, 255
+m2
+bne L40
+dec r3
+lea L107, L90
+rts
+m4
+add *r2, r7
+rts
+dec r7
+m1
+
+rts
+L94: .data 317, -543
+jmp L96
+m2
+add *r0, L113
+bne *r3
+mov #-242, *r3
+sub L102, L49
+L95: prn L118
+cmp r6, L58
+L96: .string "ndgnbdxtf"
+m3
+L97: rts
+add #-126, *r1
+add r4, *r3
+red L98
+L98: .data 34, -39, 190
+L99: cmp L116, r4
+m3
+m3
+inc L11
+L100: inc *r6
+L101: mov L112, L121
+lea L121, *r6
+jmp L117
+lea L73, L120
+L102: jmp L111
+L103: .data 669, -888, 355, 156, 794, 214
+inc *r5
+L104: inc r4
+jsr *r6
+jmp L114
+prn #-85
+bne L48
+m3
+m4
+L105: .data -400, -579, 861
+L106: prn *r5
+L107: .data 808, 972, -552, 985, 139, 836, 841, 488
+m2
+m0
+sub *r5, *r0
+stop
+; comment
+L108: sub L18, r2
+m0
+lea L118, r1
+m0
+red *r5
+L109: jmp *r1
+jsr *r2
+inc r4
+red *r7
+rts
+lea L25, L78
+mov r5, L117
+lea L116, L115
+L110: mov *r5, L121
+rts
+L111: clr *r0
+m4
+; comment
+red r1
+jsr L27
+L112: .data -319, -790, 110, -733, -534, 69, 435, 327
+L113: .data -585, 903, -855, 880
+sub r0, *r3
+prn *r2
+sub *r6, *r5
+red L38
+L114: mov L115, L72
+L115: .data 194, 55, -842, -478, -975, -97
+m0
+; comment
+bne L116
+add r0, r4
+not *r0
+m0
+stop
+jmp *r0
+add L121, *r1
+cmp *r0, #-149
+bne *r6
+sub #191, r6
+inc L116
+L116: sub L65, *r7
+jmp L120
+bne *r5
+L117: not L96
+L118: add *r1, *r7
+inc L119
+bne *r6
+rts
+lea L112, L120
+L119: .string "d"
+cmp L121, #-33
+jmp L34
+cmp #-165, L120
+L120: inc L88
+m3
+jmp *r6
+
+L121: .data -298
+stop
+m3
+bne *r3
+stop
+add #-236, L74
+clr *r2
+stop
@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 111
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    not *r5
+    clr r1
+    lea L73, *r3
+    not r6
+    prn #226
+    inc r0
+    jsr L56
+    prn r1
+    mov r4, L79
+    dec L41
+endmacr
+macr m1
+    jmp L19
+    bne L104
+    stop
+    jmp *r1
+    red L19
+    cmp #-226, #-152
+    rts
+    jsr L24
+    cmp r7, r4
+    lea L8, r4
+endmacr
+macr m2
+    bne *r5
+    clr r5
+    cmp r4, *r7
+    dec *r6
+    prn r3
+    mov r1, r0
+    prn L46
+    clr L58
+    lea L54, r1
+    prn r2
+endmacr
+macr m3
+    add r3, L71
+    stop
+    jmp L41
+    prn r3
+    not r6
+    stop
+    dec r6
+    jmp L41
+    rts
+    inc r5
+endmacr
+macr m4
+    stop
+    add #36, r3
+    stop
+    cmp L34, L65
+    mov *r6, *r1
+    add #-49, r0
+    cmp *r5, #-240
+    add r0, r0
+    jsr *r5
+    stop
+endmacr
+L0: clr r6
+L1: .string "svkesidik"
+L2: .data -784, 214, -143, -314, -216, 863, 597
+bne L96
+m2
+not r0
+L3: .string "plqlhrlttpphvpnbr"
+add L53, r0
+not L99
+cmp #-150, L9
+clr L0
+cmp *r1, #-202
+cmp *r2, *r6
+jsr L3
+inc r7
+L4: lea L9, L0
+bne L4
+rts
+L5: .string "upb"
+inc *r5
+sub #-79, r6
+bne *r4
+stop
+m4
+stop
+m4
+L6: jsr L1
+L7: inc r1
+prn #203
+add L83, *r2
+
+prn *r7
+clr r4
+L8: clr r4
+m0
+m0
+rts
+not L21
+m0
+
+bne L17
+rts
+bne L8
+inc *r4
+m4
+L9: not *r5
+clr L31
+stop
+L10: jmp L104
+sub *r0, r3
+L11: .data -586, 208, -828, -741
+L12: rts
+add r6, r4
+add r2, L10
+bne *r0
+jmp *r2
+dec *r6
+m1
+rts
+L13: inc *r7
+lea L39, *r7
+m4
+L14: .data -796, 679, 979, -42, 269
+m3
+m2
+L15: jmp *r4
+bne *r0
+L16: .string "oqpxy"
+sub *r6, L8
+m4
+m0
+not *r6
+dec *r0
+sub r0, r3
+; comment
+stop
+dec r4
+inc r3
+add L8, L6
+L17: inc *r6
+not *r7
+add #253, L11
+L18: bne *r5
+m0
+dec *r0
+bne *r7
+mov L21, r7
+m4
+dec L23
+m1
+
+rts
+L19: not L94
+clr *r2
+m2
+not r4
+dec L15
+red r7
+m4
+L20: rts
+bne L8
+bne *r4
+jsr *r7
+lea L20, *r6
+jsr L19
+sub L12, r3
+dec L5
+L21: dec *r2
+L22: not r4
+inc r3
+m0
+m1
+rts
+clr L17
+L23: .data -310, -383, -589
+jmp *r6
+red *r7
+L24: inc r2
+L25: not L46
+m3
+L26: jsr L28
+L27: .data 988, -66, 163, 301, -326, 318, 780, 972
+cmp *r7, r7
+stop
+m4
+m2
+cmp L14, #62
+L28: .string "d"
+L29: bne *r1
+clr L84
+m2
+jmp L16
+inc L7
+L30: cmp #163, L24
+dec r0
+bne *r6
+m4
+L31: jsr *r1
+m4
+not r5
+stop
+rts
+inc *r4
+m1
+bne L21
+L32: .data 651, 389, -966, -41, -603, 121
+stop
+inc *r4
+stop
+L33: .string "ihkpcvtqbdkxs"
+m0
+m4
+red r5
+bne L31
+inc L4
+L34: cmp L11, *r5
+m4
+L35: red r4
+L36: sub #178, r7
+jmp *r4
+red L86
+L37: .data -128, -793, 83
+L38: jmp *r3
+dec L10
+jmp *r4
+L39: mov *r4, L99
+m0
+L40: .string "ihto"
+inc *r0
+cmp L12, *r7
+m0
+; comment
+dec *r6
+not L72
+L41: dec L48
+stop
+mov *r4, r3
+
+
+L42: .string "kvjsvsur"
+dec L89
+lea L77, r0
+not *r0
+jsr L34
+L43: prn *r3
+cmp L2, L82
+L44: rts
+mov r3, L86
+prn *r3
+mov r7, r1
+L45: prn *r5
+sub *r6, *r5
+L46: stop
+m1
+jsr L99
+m0
+stop
+jsr L76
+mov #-85, r5
+stop
+prn L75
+; comment
+prn r0
+L47: clr r6
+dec r7
+mov #-94, r5
+L48: .string "frsqgvdimbjdsdolmh"
+m4
+L49: jmp *r2
+lea L60, L31
+mov *r7, L89
+inc *r4
+mov #-45, L10
+mov *r2, *r6
+jsr L4
+dec L70
+prn #244
+add #243, r1
+m0
+L50: bne *r7
+red L105
+add r5, *r7
+; comment
+lea L73, r0
+
+not L107
+L51: bne *r7
+stop
+
+dec *r2
+inc *r5
+L52: .string "mjybbyd"
+L53: prn r4
+mov r4, *r5
+m3
+L54: .data -1000
+L55: .string "supkjkxhhbelnc"
+inc *r4
+not L26
+cmp r3, r6
+m1
+lea L65, r3
+bne *r1
+cmp L83, r3
+mov L94, L107
+L56: .data 407, 398, 590, -832, 88, 527, -308
+clr r3
+add L45, *r6
+L57: .data 239, 506, -483, 840, 19, 515, -862, -9
+jsr L76
+L58: .data 738, -275, 422, -100
+L59: .string "kyychckeduuztdsaaui"
+
+lea L31, L20
+m2
+add #60, r6
+jmp L103
+not L76
+m2
+red *r4
+
+L60: cmp L8, r1
+L61: mov *r1, *r0
+sub r6, L83
+jmp L81
+L62: lea L48, L20
+jmp *r0
+L63: stop
+m2
+L64: prn *r1
+m3
+m1
+clr r3
+not *r4
+mov L70, *r6
+cmp r3, L72
+prn L56
+inc *r3
+m0
+dec *r4
+clr L101
+L65: stop
+L66: bne *r6
+stop
+m0
+jsr L66
+not r6
+red r7
+m1
+
+stop
+L67: .string "kpnlumfhamigkfpxubnguaj"
+m1
+rts
+m0
+jsr L81
+L68: prn #-121
+jmp *r6
+stop
+L69: .data 770, 131, -460, -843, -542, 663, 187, 745
+mov r3, L12
+L70: mov r7, r2
+prn r3
+L71: .data 496, 858, -842, -216, 985, 82
+red L77
+sub #-91, r7
+rts
+L72: jmp *r5
+; comment
+m4
+sub *r4, r7
+dec *r0
+jsr L1
+L73: lea L104, L89
+clr r4
+red L16
+bne *r3
+L74: jsr L42
+L75: .string "irurqcuyrfowv"
+jsr L101
+jmp *r0
+dec r2
+
+prn *r5
+bne L1
+cmp L106, #-177
+m3
+mov #12, r4
+L76: lea L38, r4
+m4
+stop
+m2
+cmp r3, *r6
+red r7
+stop
+add L93, r2
+stop
+L77: jsr L107
+; comment
+bne *r1
+clr L24
+add #-29, L29
+sub r4, r0
+m2
+dec *r4
+red r6
+jsr L106
+red *r7
+jsr L84
+jsr *r6
+m1
+m4
+dec L101
+prn r3
+dec L87
+m2
+m0
+mov r5, *r3
+jmp *r7
+not r6
+jmp *r3
+L78: .string "kriwkcb"
+bne *r3
+L79: .string "ntw"
+not L20
+dec L64
+m1
+L80: .data -176, -469, -251, 2, 286, -30, 184
+L81: .data 348, -169, 519, 874, -695, -94
+L82: .data 759, -452, 696
+L83: stop
+L84: .string "qqjbqirlkbrshq"
+clr L2
+
+not r1
+L85: .data -106, -54
+clr *r1
+red L90
+L86: bne L71
+not L27
+m0
+stop
+red *r4
+dec r7
+jsr L103
+inc r6
+m4
+jsr *r5
+jmp *r6
+mov #-226, *r5
+inc r1
+bne L91
+L87: cmp #-131, *r3
+lea L21, r7
+L88: clr L95
+jsr L96
+m2
+red L103
+L89: .data -125, 729, -470
+jsr L73
+rts
+L90: .data -560, 614, -755, -113, 685, -256, -803
+m0
+L91: .data -701, -354, -688
+m2
+not r1
+m1
+cmp L97, L95
+sub #229, *r6
+sub L44, *r5
+m0
+L92: .string "lv"
+; comment
+stop
+m1
+m3
+L93: stop
+L94: stop
+dec *r4
+red L98
+prn L30
+jmp *r2
+jmp L104
+m4
+L95: .data -819, -786, -240, -79, 980, 3, -656, -238
+m0
+sub *r4, L107
+stop
+mov L9, *r1
+lea L65, *r7
+lea L104, r4
+red *r5
+L96: .string "cnvmajhqplsbzyrqowpsfh"
+rts
+prn *r4
+red L28
+L97: jsr L78
+m0
+m3
+m1
+L98: clr r3
+add L101, r7
+rts
+prn *r6
+jsr *r3
+prn r0
+m4
+red *r3
+L99: clr r7
+L100: clr L101
+clr r1
+; comment
+m1
+m3
+clr r3
+clr L103
+mov L107, *r4
+jsr *r0
+sub r6, *r7
+add r1, L68
+m2
+L101: clr r0
+m1
+mov L103, L9
+red *r6
+
+bne *r6
+stop
+m4
+
+clr L105
+rts
+m1
+L102: not r3
+sub L29, r7
+jsr L61
+m4
+L103: lea L40, L104
+prn *r6
+cmp *r2, #-91
+mov r1, r6
+L104: .string "pwbh"
+add L37, r3
+cmp *r3, *r0
+L105: clr *r0
+L106: prn L0
+jmp *r1
+inc *r5
+dec r2
+prn #59
+
+L107: .data 447, 36
+lea L50, L72
+lea L73, *r2
+m4
+m1
+m4
+add #-226, *r5
+mov #207, r2
+m1
+stop
@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 112
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    clr L86
+    inc *r4
+    rts
+    stop
+    jmp L1
+    rts
+    add *r2, r0
+    prn *r1
+    red *r3
+    mov *r1, r6
+endmacr
+macr m1
+    cmp L69, r1
+    prn r0
+    inc L57
+    cmp r6, #51
+    cmp L9, r5
+    not *r6
+    mov #-31, r7
+    dec r0
+    cmp L68, *r3
+    not L16
+endmacr
+macr m2
+    cmp r5, *r2
+    stop
+    jsr *r5
+    sub #-226, *r0
+    prn *r0
+    stop
+    prn #-250
+    mov r1, r1
+    jmp *r7
+    stop
+endmacr
+macr m3
+    jmp *r4
+    jmp *r4
+    jmp *r3
+    mov L18, *r2
+    sub #-175, *r2
+    inc *r3
+    prn #-127
+    dec *r0
+    not L1
+    add L25, *r2
+endmacr
+macr m4
+    rts
+    dec *r7
+    bne L36
+    dec r7
+    dec L33
+    inc *r7
+    jmp *r5
+    red r1
+    bne L56
+    inc *r1
+endmacr
+stop
+cmp L90, *r0
+bne L27
+cmp L66, r3
+L0: clr L0
+L1: stop
+cmp #23, r0
+mov *r0, L0
+inc L1
+L2: bne L65
+stop
+L3: rts
+red *r4
+m0
+m2
+L4: jsr *r6
+lea L4, L87
+stop
+red *r7
+; comment
+inc L35
+inc *r1
+stop
+L5: jsr *r6
+m2
+dec *r0
+m0
+jsr L33
+rts
+dec L62
+L6: lea L0, *r1
+clr *r7
+add *r2, *r6
+m4
+clr r1
+red r5
+bne L5
+clr L5
+L7: .data -494, 30, 9, -833, -435, 846, 450
+L8: .string "gmzembshezryzeuxhew"
+lea L82, *r2
+cmp *r4, r3
+m2
+bne *r5
+m1
+L9: .string "ecvxmfkd"
+mov *r6, *r2
+m0
+m2
+sub *r3, L44
+bne L4
+
+
+lea L92, r2
+L10: .string "keetkxianeql"
+L11: .data 606, 911, -928, -697, -682, -941, 666, -335
+jmp L2
+add r3, L34
+L12: .data 166, 339, -56, 60, -744, -947, -768
+rts
+L13: .string "wbd"
+rts
+rts
+not r3
+L14: clr *r3
+clr r7
+L15: cmp L12, #-39
+m4
+jmp L2
+red L9
+L16: jsr *r3
+stop
+m1
+L17: .data 484, 636, -541, -974, -912, 201, -191
+not L0
+L18: .data 726, 676, -460
+L19: .string "eqsxnwdndxvys"
+bne *r1
+jmp L106
+prn #-99
+m2
+m1
+m0
+clr *r2
+jmp *r1
+dec *r2
+L20: inc r2
+lea L41, *r7
+m1
+m2
+L21: add *r3, r1
+jsr *r7
+; comment
+m4
+jsr L83
+inc L22
+L22: .data -737, -202, -10, -905, 576, 297, -658, 55
+cmp r3, r4
+prn L0
+prn r6
+dec *r7
+bne *r7
+clr *r6
+jmp L122
+
+clr L83
+m2
+inc *r3
+sub r3, r6
+cmp r2, L11
+dec L103
+stop
+m3
+dec r4
+lea L107, *r3
+m2
+m4
+prn r0
+L23: red L4
+L24: sub #-64, *r5
+; comment
+L25: lea L48, r6
+add #66, *r7
+; comment
+cmp r0, #101
+L26: .data 535, -438, -659, -556, -329, -868
+rts
+jsr *r5
+jmp *r1
+L27: .string "iepvpkthkukiqgkj"
+L28: red L28
+L29: dec L14
+m1
+m1
+L30: .data -109
+L31: .string "ojvrfzachrqy"
+red *r4
+stop
+prn *r2
+m2
+sub r2, r2
+sub *r3, *r0
+clr *r3
+clr L6
+jsr *r6
+m1
+clr L20
+mov #-109, L41
+jmp L0
+stop
+m1
+jsr *r6
+rts
+stop
+; comment
+L32: jsr *r7
+L33: sub #105, L17
+rts
+mov #203, L30
+L34: .string "jqdxvvqpbgnavdsgdty"
+L35: .string "pljdkkaliw"
+L36: .data 609, 853, -712, 364
+lea L5, *r2
+inc L11
+cmp L62, L0
+L37: jsr *r1
+jsr *r0
+prn r2
+L38: mov *r6, L0
+lea L32, r7
+L39: add L4, L48
+stop
+sub *r1, L97
+m0
+cmp L27, *r0
+add #244, r3
+L40: prn *r5
+L41: cmp *r1, r4
+prn r4
+L42: cmp #223, r6
+add L21, *r2
+L43: .data 333, 157, 641, -911, 264, -721, -480
+L44: clr r3
+L45: rts
+cmp #193, r0
+m3
+m2
+m3
+add r3, L70
+dec *r7
+red r6
+m3
+L46: clr L24
+mov r3, *r3
+m2
+not *r4
+bne L39
+L47: .string "jhueqvucwkjpbwucgco"
+m4
+inc r2
+mov r7, *r7
+L48: .data -802, -150, 549, 452
+jmp L114
+L49: red r2
+m4
+inc *r2
+L50: red r3
+L51: .string "psupekfluqaukkxzonokxzf"
+inc r0
+L52: .data 557, 332
+cmp L81, r1
+add L22, r2
+red *r4
+bne *r4
+clr L94
+sub *r5, L14
+red *r4
+cmp *r7, #147
+add #114, L101
+L53: .string "jec"
+stop
+bne *r2
+jmp *r7
+bne *r4
+clr L93
+clr r4
+L54: .data -99, -209, 334, -285, -883, -636, 300, -156
+m2
+L55: mov L97, r1
+cmp #-183, r3
+prn r3
+m0
+rts
+mov #-121, *r0
+L56: .data -557, -253, -544, 86
+L57: .data 282, 383, -946, -697
+dec r7
+lea L98, *r4
+lea L58, L110
+add #186, L19
+clr L33
+m3
+
+m1
+rts
+L58: .data -522, 152, 134, -228
+m3
+cmp r0, L75
+inc L13
+add *r3, r5
+red *r6
+clr *r0
+bne L97
+mov L82, r5
+bne *r6
+clr *r7
+L59: .data 910, -789, 292, -968, -792, -89, -942
+m2
+L60: .string "axoap"
+
+m3
+L61: .string "plezcmoekfpfeuawr"
+mov #-173, r7
+clr r4
+rts
+not r7
+dec L8
+mov *r7, *r4
+clr *r6
+; comment
+lea L67, r2
+L62: cmp #207, r6
+mov *r1, r1
+not L0
+mov L13, r4
+m0
+m3
+
+L63: .string "vkmmcckgskx"
+clr r1
+add L98, r7
+L64: red L104
+rts
+red r7
+stop
+lea L21, *r4
+not *r1
+inc *r0
+L65: .string "beujdiqqleyoiqyfnwakqs"
+dec *r0
+
+cmp *r7, L109
+L66: not L96
+lea L0, *r7
+m1
+L67: .data -601, 290, -314, 385, 678, -724, 878
+m2
+inc r0
+m1
+m0
+jsr *r5
+m1
+
+m4
+L68: cmp *r5, L26
+not L86
+bne L71
+add r5, r4
+clr L26
+L69: add L122, r0
+L70: stop
+lea L108, r0
+not *r2
+jsr L102
+m2
+lea L61, *r1
+jsr L90
+add r4, L100
+add #146, *r3
+red r4
+inc *r0
+L71: jmp L44
+not r7
+; comment
+not L118
+m1
+rts
+
+mov L96, *r6
+L72: bne L10
+rts
+
+jmp *r7
+
+m4
+L73: jsr *r4
+L74: add *r7, r2
+
+; comment
+L75: bne *r3
+m0
+m0
+cmp L9, *r3
+lea L84, L86
+L76: jmp *r3
+cmp r3, r7
+L77: .string "uzs"
+dec *r0
+m2
+m3
+clr *r7
+m2
+L78: .string "npfzgbbjfsaloakh"
+dec L56
+L79: lea L122, L100
+not *r1
+jmp L34
+lea L99, *r7
+; comment
+m0
+bne L109
+L80: rts
+jmp L90
+m2
+add r0, *r3
+red L90
+inc r2
+m0
+L81: .data -808
+clr r6
+clr r4
+m4
+L82: jsr L65
+cmp r6, r3
+red *r5
+rts
+rts
+jmp L37
+inc L40
+L83: .data -515
+L84: rts
+mov *r3, r3
+sub L116, *r1
+rts
+clr L56
+red r4
+rts
+jsr *r3
+L85: sub L23, *r3
+m3
+rts
+lea L123, *r3
+L86: jsr *r4
+L87: .data -9, 798, -576, -800, 131, 942
+m3
+L88: .data -538, -413, 51, -285, -477, 714, 170, -177
+m4
+m1
+L89: .data 986, -323, 349, 265, -704, 238
+add L90, r4
+sub #-87, r1
+; comment
+m3
+cmp #-116, r2
+L90: .string "aogiur"
+L91: bne L42
+cmp L103, #135
+m3
+L92: prn *r6
+; comment
+jsr *r3
+; comment
+clr r0
+add r2, L95
+L93: .data -293, 694, 198
+L94: mov *r1, *r3
+L95: .data 748, 953
+L96: stop
+jmp L104
+rts
+prn L30
+jmp L65
+sub r3, r3
+L97: .data 595, -39, -552, -107, 808, 192, -32
+m2
+red L57
+jsr L102
+dec L43
+L98: .string "w"
+bne *r1
+; comment
+m0
+L99: lea L110, *r0
+L100: .string "nilu"
+L101: .data -311, -154
+jmp L102
+L102: prn #-193
+; comment
+L103: .data 422, 515
+add L79, r5
+m0
+rts
+bne L80
+red r7
+L104: lea L96, L113
+m4
+L105: rts
+rts
+L106: .data 12, 402, -731, -14, 603, 543
+m4
+lea L95, r2
+L107: .string "edflmerkwwlpbwsfjitufsj"
+L108: sub L114, L111
+bne *r0
+L109: red L117
+sub r7, L25
+m0
+L110: add L119, *r2
+L111: red r6
+lea L116, r2
+mov r3, *r2
+sub *r0, L121
+L112: .data -831, 698, -464, 143, -261, 314, -609, 419
+L113: prn r1
+L114: not *r1
+inc *r1
+not *r7
+lea L99, L33
+m2
+rts
+jmp *r4
+not *r1
+bne *r2
+red *r7
+L115: cmp *r4, *r1
+stop
+inc L23
+rts
+L116: lea L120, *r3
+cmp #-220, r6
+prn *r1
+L117: clr L118
+m1
+; comment
+L118: clr *r7
+L119: rts
+add *r2, L120
+cmp r5, #-85
+not L52
+
+m4
+L120: sub #-236, *r7
+clr L121
+not r3
+L121: clr *r2
+L122: inc r3
+cmp *r1, #-3
+L123: bne L59
+cmp r6, L118
+jsr *r4
+stop
@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 113
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    not L43
+    rts
+    rts
+    not *r7
+    jsr *r7
+    lea L34, *r3
+    dec *r4
+    dec r3
+    mov *r1, *r3
+    jsr *r0
+endmacr
+macr m1
+    clr *r7
+    prn L33
+    rts
+    not L14
+    inc L106
+    mov #-177, *r4
+    jmp L87
+    bne L10
+    not *r6
+    bne *r0
+endmacr
+macr m2
+    prn *r0
+    prn #-67
+    add r0, *r4
+    bne *r0
+    inc r6
+    jsr L102
+    clr L47
+    red *r5
+    prn #-187
+    stop
+endmacr
+macr m3
+    jsr L92
+    bne *r0
+    red L23
+    cmp *r7, #90
+    sub r6, r3
+    jmp L66
+    jsr L42
+    jsr L89
+    stop
+    jmp L88
+endmacr
+macr m4
+    stop
+    stop
+    clr L37
+    mov #-57, *r0
+    lea L106, *r4
+    not L2
+    cmp L31, #-60
+    add #129, L87
+    sub L104, *r5
+    jsr *r7
+endmacr
+m1
+L0: .data -589, -916, 755
+L1: .string "cnvec"
+not r2
+stop
+L2: not r3
+L3: .string "cgvmtufanswgobyisjvpoo"
+m4
+L4: .data 968, -823, -138
+jmp L0
+prn r2
+L5: mov *r0, r6
+bne L98
+clr L31
+lea L4, *r5
+m2
+L6: .string "gwxdmcpblvbdacaglqkzmpgi"
+jsr *r6
+clr r5
+L7: .data 370, -105, 520, -482, -781
+prn r3
+m4
+; comment
+m3
+clr r1
+red L44
+m3
+L8: .data 50, 986, -946, 253, -744, 943, 282
+add #134, r0
+mov L1, r2
+L9: stop
+m2
+add L0, r2
+add *r4, L69
+cmp r2, L24
+L10: .string "oioqltndpdjnukwdl"
+jmp L24
+lea L68, r6
+L11: dec *r1
+L12: not *r1
+red L4
+m2
+jsr L71
+L13: .data 374, 16, -108, -658, 376, 92
+m0
+m4
+; comment
+m3
+stop
+clr *r2
+L14: .string "tcuvqqdxpmnsweqwcw"
+L15: dec *r7
+add L54, L32
+inc L15
+clr L95
+bne L101
+L16: .string "nubx"
+jsr L7
+cmp r3, #238
+L17: .string "hgtlyygzsgswztpyxmnefyoe"
+; comment
+red *r1
+m3
+m1
+jsr L61
+; comment
+
+inc L72
+bne L8
+
+bne L38
+cmp r3, L6
+; comment
+add r1, *r6
+L18: add r1, *r6
+m3
+m2
+bne *r7
+prn L22
+L19: sub L3, r4
+rts
+L20: jsr L11
+L21: bne L1
+dec *r1
+sub L74, r0
+m3
+
+
+prn r7
+m3
+bne L12
+prn *r3
+prn L105
+m4
+m3
+L22: cmp #85, L100
+m2
+L23: .data -688, 249, -909
+add #-231, L11
+cmp #-202, *r2
+prn r7
+red L84
+L24: add #48, r4
+prn #212
+; comment
+L25: .data -435, 397, 168, 289, 801, 816
+L26: mov L94, L104
+red r7
+bne *r1
+L27: .data -660, 74, -479
+clr L29
+lea L90, r1
+clr L9
+L28: clr *r7
+L29: prn r7
+stop
+lea L48, r5
+red *r3
+prn #100
+dec *r5
+sub L59, *r3
+L30: .string "zcdwtvzsnbvdqnbcs"
+
+bne L15
+prn r2
+m2
+L31: .string "lfbnldbvffrpnfymd"
+m3
+m3
+m4
+L32: not L3
+L33: not *r1
+L34: .data 10, -506, 89, 263, 266, 201, -288, 373
+jmp L70
+m2
+mov L96, r2
+m1
+bne L31
+bne L110
+jmp *r3
+
+L35: .data -846, -607, -627, -304, -231, -547, -570
+L36: clr L63
+jmp *r3
+
+red r1
+L37: jsr L27
+L38: red L54
+L39: stop
+sub L95, L20
+not r3
+m2
+L40: jmp *r7
+clr *r3
+m1
+mov #140, r1
+L41: dec r6
+
+inc r7
+stop
+m0
+L42: lea L11, r7
+red *r6
+cmp *r3, *r5
+dec L93
+L43: .string "fhvvdsjdlvnmppnnuctzcs"
+sub L59, *r0
+bne L20
+L44: stop
+jmp *r7
+inc r6
+inc L9
+m0
+stop
+m0
+bne L36
+red *r2
+mov #210, L77
+m1
+not r1
+m2
+lea L14, L76
+; comment
+prn *r0
+m1
+inc r2
+add r1, r0
+add *r1, *r2
+mov r0, L42
+red r5
+jsr L99
+; comment
+m4
+stop
+add *r0, *r4
+sub #-200, L10
+stop
+m0
+dec *r1
+stop
+L45: .data 681, -365, -893, -865, -734, 268, 2
+L46: sub #-214, L93
+L47: dec *r0
+clr *r5
+L48: .string "fmqqp"
+L49: rts
+L50: clr L101
+rts
+L51: stop
+mov r4, r6
+L52: .string "mnlidkfyxyzltsrargcgecpn"
+m2
+stop
+red r1
+m1
+lea L91, L35
+cmp #176, #-53
+lea L61, *r6
+add r0, *r0
+jmp *r6
+prn L36
+m3
+add L33, r5
+cmp *r1, L31
+mov *r5, *r2
+prn L48
+red *r4
+m3
+mov L66, L77
+add r0, L46
+dec r5
+jsr L50
+jmp *r2
+L53: .data 58, 348, -620, -266, -359, -244, 482
+L54: clr *r5
+L55: stop
+red L88
+add #179, r1
+red L27
+sub L52, L42
+red *r3
+bne L39
+jsr L26
+m0
+prn #38
+add L57, L87
+m1
+L56: red r1
+prn L102
+stop
+add L95, *r3
+cmp *r6, r3
+m0
+m0
+rts
+clr r1
+not L28
+L57: add r6, r7
+m3
+L58: lea L14, L66
+L59: lea L81, *r7
+; comment
+L60: .data -693, -169, 984, 304, 705, -153
+not r1
+m3
+L61: red *r4
+sub L74, *r1
+L62: mov *r3, r5
+dec *r1
+add L84, L17
+L63: dec r3
+L64: .data 729, -798, -482, -710, -356, 987
+L65: sub L80, r5
+L66: mov L68, L76
+add L68, L87
+clr *r7
+lea L48, L22
+mov r0, *r4
+m1
+L67: inc r7
+L68: clr L86
+m4
+jmp *r5
+
+L69: rts
+; comment
+rts
+prn #226
+; comment
+mov #-109, r1
+jmp L95
+L70: rts
+prn r5
+mov #-119, *r5
+L71: jmp *r7
+inc r4
+
+m2
+m4
+L72: not L60
+L73: .data -928
+rts
+rts
+L74: red L102
+jmp *r4
+dec L96
+jsr *r0
+dec r2
+L75: bne *r3
+jmp *r1
+L76: red r4
+jmp L108
+m0
+L77: rts
+; comment
+stop
+m4
+bne L79
+clr L24
+dec L89
+m3
+not r3
+clr *r5
+dec *r0
+; comment
+bne *r3
+; comment
+add #-162, L5
+m1
+clr *r2
+L78: stop
+bne L87
+rts
+L79: lea L91, L100
+cmp *r4, r0
+dec *r1
+L80: lea L1, *r2
+m2
+add r2, r4
+jsr L65
+m3
+add L8, *r6
+m0
+m3
+mov #76, r4
+add *r1, *r2
+L81: jsr *r6
+m3
+L82: .string "drkanhyubi"
+bne *r5
+prn #-143
+stop
+m2
+m4
+L83: .string "odbfogmczoppveutawjya"
+L84: .string "vlzubuzcwhxjmqobohspozy"
+jmp *r7
+add *r5, *r5
+; comment
+inc *r2
+red *r5
+prn #-68
+add #188, L106
+rts
+mov *r2, r6
+
+jmp *r2
+sub #-232, *r6
+red L107
+m2
+stop
+m3
+red r1
+m2
+m0
+jsr *r0
+L85: .data 919
+m0
+L86: stop
+L87: prn *r1
+red *r6
+
+jmp *r6
+m2
+m4
+L88: .string "abgzbytkxrfttrpwliqdlvjh"
+red *r0
+lea L0, *r4
+stop
+; comment
+rts
+rts
+jmp L63
+m3
+; comment
+not *r3
+jmp *r0
+L89: stop
+stop
+rts
+stop
+rts
+L90: .string "wbnowlbbxebicy"
+jmp *r4
+L91: not r0
+dec r1
+jmp L46
+mov *r3, r2
+mov *r3, *r7
+m2
+stop
+add *r1, r4
+rts
+m0
+m1
+L92: .string "omlionsbkvo"
+lea L110, r5
+L93: cmp #29, #-63
+inc L84
+dec *r7
+rts
+m0
+inc L108
+L94: add r6, L91
+jmp L73
+mov r2, r4
+lea L112, r6
+L95: .string "sinubj"
+m0
+L96: bne *r7
+dec *r3
+clr r4
+jsr L100
+jmp L102
+red r6
+red *r5
+m0
+inc *r1
+jsr *r3
+jmp L8
+prn #-105
+stop
+cmp r3, L41
+m4
+prn L99
+m0
+m0
+sub *r4, *r0
+dec L91
+L97: clr r5
+m4
+L98: not L31
+rts
+dec r3
+L99: .data 349, -309, 502
+jmp *r2
+L100: dec r1
+sub *r2, r2
+rts
+stop
+add r2, L107
+L101: .data -974, -46, 513, -252, 228, 362, -59, -732
+rts
+inc *r6
+mov r4, r3
+L102: .string "mnofjomwqjjifyl"
+mov r7, L29
+clr L106
+stop
+cmp L108, L54
+bne L50
+L103: .data -148, -928, 649, 299, 66
+L104: prn #-152
+L105: .data 602, 268, -668, -913, -719, -439, -784, 664
+jsr *r3
+inc *r1
+L106: mov r1, L35
+red r1
+lea L112, *r6
+m0
+m1
+m3
+bne L89
+not *r3
+jmp *r6
+prn r6
+add r5, *r7
+L107: .data 822, -367
+clr *r6
+L108: .string "ubvksssmezxfperye"
+L109: .string "nsseoqzpaw"
+m1
+clr L111
+L110: .data -516, 605
+jsr L104
+cmp L82, *r7
+prn #-56
+dec r5
+L111: .string "vtwnndfxxkbbjnlqweojbde"
+L112: .data -285, 977, -158, -451, -990, -966, 170
+stop
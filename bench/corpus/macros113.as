@@ -0,0 +1,571 @@
+; Generated by genCorpus --seed 114
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+macr m0
+    clr *r0
+    add r3, r4
+    rts
+    inc L33
+    clr r5
+    lea L80, L107
+    jmp *r6
+    inc L93
+    lea L66, L90
+    dec r5
+endmacr
+macr m1
+    clr L101
+    bne L43
+    jmp *r4
+    stop
+    cmp L119, L104
+    jsr L5
+    lea L14, L50
+    not L5
+    stop
+    bne *r1
+endmacr
+macr m2
+    red L94
+    dec r6
+    prn r4
+    add #165, *r2
+    jmp *r5
+    stop
+    mov #-14, *r4
+    lea L44, *r3
+    clr r2
+    prn L62
+endmacr
+macr m3
+    bne *r3
+    add L39, r4
+    mov L82, *r7
+    stop
+    red L101
+    lea L12, L88
+    add #162, *r5
+    inc *r4
+    lea L62, *r3
+    not *r3
+endmacr
+macr m4
+    inc L73
+    cmp r7, L67
+    red L125
+    clr L74
+    jsr *r2
+    sub *r2, *r7
+    prn #133
+    lea L69, *r6
+    dec L3
+    rts
+endmacr
+L0: jsr *r4
+L1: .data 945
+L2: mov L2, r1
+L3: .data -349, -838, 452, -463
+L4: lea L3, L37
+L5: lea L103, *r7
+inc r2
+L6: lea L16, L2
+lea L68, *r6
+sub r2, r2
+add L5, r0
+red r6
+L7: mov L93, L38
+lea L4, L0
+m2
+mov L2, r5
+inc *r1
+red r3
+jmp L5
+lea L0, r6
+lea L78, L1
+m3
+L8: not L18
+clr r5
+mov r7, *r1
+cmp *r1, L88
+bne *r3
+L9: sub L46, L29
+red r0
+L10: .data 857, -327, 206, -705
+clr r7
+m1
+not *r4
+L11: inc L11
+inc L37
+L12: stop
+m0
+stop
+sub *r4, L6
+dec L3
+L13: .string "mprtykitxfhdm"
+m1
+L14: .string "nugjet"
+bne *r1
+lea L3, *r5
+red L103
+jmp L31
+L15: .data -874
+m1
+rts
+m1
+L16: bne L100
+bne L97
+m1
+rts
+sub *r3, *r1
+add r3, L2
+not L53
+dec L72
+not *r7
+jsr L47
+m2
+m2
+rts
+bne *r3
+jsr *r1
+clr L11
+m1
+; comment
+stop
+lea L8, *r3
+m1
+add L14, L7
+prn *r4
+prn *r3
+L17: mov L11, *r0
+jmp L19
+prn #-246
+m1
+m0
+L18: sub #-148, L12
+
+inc L5
+L19: clr *r3
+L20: add r7, L108
+L21: .string "xzhbdjqmqskydime"
+m4
+sub r4, L4
+m3
+jmp L111
+lea L89, L28
+cmp *r0, r0
+bne L83
+m0
+L22: not r1
+L23: lea L22, *r7
+L24: .string "vqwzersimti"
+mov *r5, L6
+not L5
+m4
+L25: .data 241, -248, -718, 126
+dec *r7
+L26: prn r5
+m1
+rts
+L27: .data 364, 781
+sub *r1, L7
+not r4
+m4
+L28: add *r2, L15
+jmp *r4
+lea L22, L16
+m4
+L29: clr r6
+add *r5, L123
+dec *r5
+rts
+m2
+not L19
+bne *r1
+mov #135, r4
+L30: bne *r2
+m2
+not L43
+dec *r2
+prn L55
+rts
+L31: jmp L1
+L32: not L37
+L33: stop
+jsr L27
+L34: jsr L112
+L35: dec L71
+m3
+jsr *r1
+inc r3
+prn r5
+jsr L9
+; comment
+
+m3
+dec L16
+L36: jmp L124
+dec L101
+L37: .string "nxty"
+dec r4
+add r2, *r0
+prn r7
+jsr *r5
+jmp *r5
+jsr L7
+bne *r5
+L38: cmp *r6, r0
+sub #164, L122
+cmp r1, *r1
+lea L4, *r1
+not r0
+L39: .string "hwqigiy"
+L40: clr *r7
+m1
+red r1
+L41: add *r4, r3
+prn *r7
+L42: .data 214, 222, 494, 466, 638, 216, -141, -373
+jsr L0
+L43: .data 15
+cmp #-22, r5
+dec r5
+L44: .string "itxo"
+not *r5
+
+L45: .string "ikzmrpqruswh"
+m1
+L46: bne *r5
+m2
+cmp r0, #-15
+not *r2
+m4
+
+add r0, *r5
+L47: .data -358
+L48: sub #93, *r1
+m1
+bne *r5
+L49: clr L90
+m4
+dec *r5
+L50: clr r1
+mov r1, L52
+m1
+L51: .data 176, -169, 212
+cmp *r6, L7
+dec L22
+stop
+L52: .data 449, 140, 579
+L53: cmp r7, r2
+add r3, r4
+
+L54: inc L33
+m0
+sub #211, L31
+L55: rts
+bne *r3
+sub r6, L73
+add r0, L54
+m3
+dec L114
+L56: .data 948, 738, -587, -51
+
+lea L54, L10
+inc *r6
+jsr L47
+lea L41, r7
+sub L18, L8
+inc r0
+add #-230, r3
+dec L17
+L57: .data -503, 624, -54, -399, -1, -799, 519, -501
+m1
+dec *r3
+; comment
+L58: red r7
+add *r6, r0
+cmp L90, r0
+cmp r1, r7
+prn *r3
+rts
+dec L88
+L59: jsr L4
+jsr L111
+L60: lea L19, r5
+rts
+m2
+L61: jsr L119
+mov *r4, r3
+
+prn #-143
+rts
+bne *r0
+bne *r1
+; comment
+jsr *r1
+cmp *r4, r3
+L62: .string "yprolgmqfatdnfakr"
+stop
+L63: .data -402, 954, 686, -930, -219, 67, -66, -290
+L64: red *r2
+dec L108
+bne *r0
+jsr *r0
+m0
+m2
+stop
+L65: rts
+cmp r6, *r4
+m3
+L66: .data 64, -413, 764, 25, -255, 485, 717, -992
+L67: .data -893, -405
+dec r1
+L68: sub *r6, *r7
+m1
+not *r2
+stop
+cmp r4, L50
+inc L113
+cmp L97, L67
+m1
+jmp *r4
+add r5, L118
+L69: .string "yycefi"
+jmp *r3
+sub #129, L95
+L70: .data 133, 393, 635, -464, -12, -363
+L71: .string "civulxwxosv"
+L72: stop
+m0
+L73: add r0, *r1
+L74: jsr L9
+bne *r4
+m3
+L75: stop
+sub *r1, L3
+m1
+; comment
+inc *r3
+clr *r0
+m1
+m3
+jsr L46
+L76: lea L22, L74
+m3
+add r0, *r6
+mov #176, *r1
+L77: add L74, *r1
+m1
+rts
+bne L0
+inc L51
+dec L121
+add L51, *r4
+L78: .data 787
+red *r1
+bne *r2
+L79: sub *r4, *r2
+m2
+not L40
+m0
+stop
+L80: .string "miamhjwu"
+red r1
+bne L101
+stop
+bne L72
+bne L76
+not L23
+sub #231, L13
+L81: jsr L44
+prn *r7
+L82: .data 13, 754
+L83: red *r3
+L84: .data -760, 303, -407, 595, 87, -251, 579
+m1
+add *r4, *r4
+m1
+L85: .data -683, 785, 558
+sub L28, *r3
+L86: .data -440, 989, 382, 336, 191, -406
+m0
+jmp L4
+L87: bne L72
+inc *r6
+mov r2, L53
+L88: .data 255, 794, -23, -262, 756, -162
+m4
+m1
+add #137, r4
+L89: sub *r0, *r5
+red r1
+
+; comment
+clr *r4
+lea L106, r4
+bne *r3
+L90: .string "txht"
+jmp *r6
+jsr *r2
+add r5, *r6
+mov *r7, L62
+sub L128, L101
+m3
+L91: mov r6, *r0
+rts
+rts
+m0
+m0
+red r4
+L92: red r3
+L93: cmp #-7, *r3
+jmp *r0
+inc L128
+L94: .data 168, -755, 997
+cmp L118, *r3
+mov *r1, L102
+bne L32
+stop
+L95: dec *r5
+cmp *r5, *r1
+L96: .string "risapgunwikrrdm"
+bne L73
+L97: lea L115, r0
+L98: .string "k"
+; comment
+m2
+lea L56, *r3
+bne L76
+L99: .data 918, -480, 971, -326
+L100: dec L59
+dec *r6
+prn #-92
+L101: .data -682, 527, 860
+L102: not L69
+cmp *r7, r7
+sub r3, *r3
+m4
+bne L74
+inc *r4
+red *r0
+L103: red r2
+jmp L28
+L104: .string "quvc"
+inc r2
+dec L118
+dec r5
+L105: .string "odobnhtbrdvwxtbeyh"
+L106: .data -784, 723, -307
+clr r3
+m4
+inc L122
+rts
+sub L115, r0
+cmp #118, L48
+L107: red L7
+rts
+; comment
+clr L123
+lea L39, r3
+bne *r6
+clr *r5
+m4
+L108: .string "hrepll"
+jmp *r7
+m3
+clr L43
+prn L91
+cmp #-245, *r2
+
+L109: .data -999, 124, -573, 950
+m4
+
+m0
+L110: prn L98
+m4
+cmp r2, *r2
+bne *r5
+clr L128
+m2
+L111: jsr L55
+L112: add #77, *r1
+L113: .string "hnopqrkmxynowusj"
+stop
+jmp L101
+L114: inc L117
+m3
+L115: .string "fputujstdpse"
+m1
+stop
+m0
+m0
+stop
+L116: .data -911, -329, -699, -78, -926
+m0
+not r7
+L117: prn L91
+L118: sub #236, *r0
+jmp L5
+cmp L103, *r1
+cmp *r4, *r1
+L119: .data 193
+not r0
+cmp L127, r2
+not r2
+cmp r0, *r3
+L120: prn #-243
+m3
+m2
+clr *r4
+m0
+L121: .data 670, 827, 568, -118, 991, -566, 401, 17
+m0
+L122: red L118
+mov #-206, *r0
+red r2
+L123: jsr *r7
+prn *r2
+red r7
+cmp r1, L127
+cmp L127, r5
+jmp *r6
+prn L57
+mov *r5, *r3
+lea L30, r6
+jsr L30
+bne *r3
+inc *r3
+clr *r4
+not L61
+m1
+jsr *r1
+m2
+m0
+jsr L62
+L124: mov r1, *r5
+m4
+m4
+L125: clr r6
+L126: add L5, r2
+L127: .string "itdhiaqlxzlruoji"
+clr *r0
+jmp *r5
+L128: .string "emanjegijxbarwr"
+stop
+bne *r5
+prn *r2
+dec L129
+L129: bne *r1
+stop
+m0
+prn r5
+jsr L8
+not L54
+stop
@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 115
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    lea L95, *r5
+    add *r2, r3
+    dec *r6
+    stop
+    inc L28
+    not *r2
+    bne *r1
+    bne *r2
+    rts
+    stop
+endmacr
+macr m1
+    cmp L119, #60
+    red L67
+    clr *r2
+    clr L17
+    add #-33, r2
+    cmp *r5, L60
+    bne *r3
+    stop
+    red *r3
+    add *r1, L72
+endmacr
+macr m2
+    jsr L31
+    dec r5
+    add #-46, L92
+    prn L81
+    sub r2, L88
+    jmp *r3
+    prn #-171
+    sub *r1, L53
+    red *r5
+    jmp L32
+endmacr
+macr m3
+    clr *r5
+    inc r6
+    clr L112
+    jsr L89
+    add #-51, *r6
+    jmp L25
+    cmp r2, #-118
+    inc *r4
+    jsr *r5
+    red *r7
+endmacr
+macr m4
+    lea L20, *r3
+    not L13
+    prn #-202
+    prn L118
+    rts
+    jsr *r7
+    add *r6, *r3
+    inc L39
+    add #-185, *r3
+    rts
+endmacr
+
+cmp #-247, *r1
+L0: .string "urncfezppqqzfcyyadnboj"
+mov r5, L40
+jmp L0
+jsr *r1
+not r6
+red L27
+; comment
+m4
+m0
+add #194, L0
+red *r5
+; comment
+sub r0, L41
+; comment
+lea L24, L36
+jsr L0
+m1
+add L33, *r3
+stop
+lea L0, L17
+add L0, r0
+mov L0, r2
+not *r2
+L1: .data -199, -368, -107
+m4
+red r1
+; comment
+L2: .data -151
+m4
+not *r3
+L3: stop
+jmp *r2
+red r0
+cmp *r0, r4
+add #91, r1
+add *r0, *r2
+L4: clr L1
+bne L95
+prn #165
+L5: mov L4, r4
+add L91, *r1
+lea L0, r0
+add #-163, r2
+mov L2, r7
+m0
+lea L5, L79
+L6: .string "jopzkthxujdhszxj"
+not *r0
+not r4
+clr L45
+add #199, L0
+prn L91
+m4
+m2
+red r5
+mov #233, L5
+L7: jmp L46
+cmp L0, L0
+L8: add L61, *r2
+lea L1, L46
+L9: jmp *r7
+L10: .string "qrgnzykcrrhwtskh"
+L11: cmp r5, L72
+not L93
+L12: .string "rzrazye"
+; comment
+stop
+stop
+L13: lea L49, L2
+prn #-110
+prn #-25
+; comment
+inc *r0
+mov #-205, L8
+; comment
+bne L115
+m1
+L14: .data -938, 279, 134
+stop
+L15: not L1
+m4
+jsr *r1
+stop
+m3
+L16: red *r1
+jsr *r2
+inc r7
+inc r3
+mov *r4, *r6
+inc *r7
+L17: add r1, L94
+add *r6, *r2
+cmp L9, #-31
+stop
+L18: prn r1
+m3
+add *r0, r3
+dec r4
+; comment
+lea L10, L49
+not r5
+m4
+jsr *r7
+m0
+m4
+L19: .data 663, 231, 372, 717, -381
+inc r2
+L20: prn r4
+m2
+L21: sub L75, L93
+L22: .string "jpltlddkzfvtdb"
+L23: rts
+rts
+L24: stop
+dec *r2
+L25: cmp L36, *r4
+mov #-13, *r2
+bne *r4
+L26: .string "xioblqtmptsiu"
+m0
+m2
+red r5
+m0
+dec r4
+m4
+L27: .string "lhvpjv"
+m0
+mov L16, L2
+L28: mov #226, *r4
+red r4
+stop
+L29: jsr L17
+L30: prn *r5
+add L23, r6
+inc *r0
+L31: .data 301, 506, -276
+L32: bne L35
+m0
+m1
+L33: mov r4, r2
+red *r4
+clr L58
+inc r2
+clr r1
+lea L37, L23
+L34: clr r7
+
+jsr L34
+stop
+m2
+stop
+L35: clr L66
+dec *r0
+jsr *r4
+L36: dec r4
+m0
+L37: clr *r2
+jsr L71
+L38: add L2, r5
+rts
+L39: red *r4
+rts
+jsr *r4
+jmp L96
+prn r7
+L40: red L34
+cmp *r0, L116
+L41: .string "ucaydryihfmas"
+
+L42: .data -279, -525, 681, -570, -359, 129
+L43: mov r5, *r2
+dec L56
+cmp L110, r3
+clr L105
+
+dec L18
+bne *r0
+not r0
+jsr *r6
+clr r6
+m1
+L44: rts
+prn L61
+clr L9
+m2
+red r4
+sub L57, r5
+clr r1
+clr r2
+sub *r1, L102
+m4
+sub L27, r7
+clr r3
+L45: add #78, r7
+prn #235
+L46: clr r0
+cmp L29, r2
+m0
+cmp #43, #-28
+jmp L22
+jsr *r0
+L47: dec r6
+dec *r5
+mov #110, L8
+m3
+L48: sub #-254, *r1
+L49: bne *r4
+L50: .data -741, -599, 16, 764, 264, -945
+stop
+
+L51: red *r4
+mov *r3, L62
+jmp *r0
+m2
+L52: .string "gmbiikrtjtjkkhgsyo"
+m2
+prn *r5
+L53: .string "vk"
+L54: add *r3, L34
+clr *r4
+L55: .data -968, -946, 943, -356, -806, 436, 205, 984
+L56: rts
+L57: .string "subgcwhepblpladetl"
+rts
+L58: .string "tjhrnrmkisldua"
+lea L108, *r5
+L59: .string "rnmtywpqfspocrw"
+bne *r6
+add *r6, L55
+rts
+L60: .data -76, 159
+bne L81
+not L18
+bne L85
+jmp L64
+mov L46, *r5
+m2
+not r0
+L61: .data -579, 886, 990, 895, -100, -221, -139
+L62: lea L118, L36
+L63: lea L95, *r7
+m3
+m1
+L64: red r6
+cmp L94, r3
+L65: .data 187, 14, 536, 472
+lea L2, L76
+L66: cmp *r6, r3
+rts
+jsr L91
+clr *r6
+m4
+jsr *r3
+inc L90
+lea L53, r1
+m4
+cmp *r3, #36
+m2
+jsr L44
+L67: .data 98, 577, 15, 868, 579
+mov L57, *r4
+cmp r3, #194
+jmp L104
+L68: .string "uvlilpsriveloyvarixtfkju"
+rts
+L69: stop
+L70: prn r7
+
+inc *r1
+red L62
+L71: .data 144, -633
+inc *r1
+m3
+m2
+
+m0
+m0
+jsr *r2
+cmp r7, L75
+bne *r7
+; comment
+m2
+L72: mov r0, L88
+m1
+not L41
+L73: add *r2, *r2
+clr *r4
+m0
+rts
+mov L86, L6
+mov L93, r6
+L74: mov *r2, *r4
+; comment
+inc *r0
+; comment
+; comment
+m2
+L75: .string "onipuerkhv"
+prn *r2
+jmp *r7
+m0
+L76: clr L22
+mov #-95, *r2
+L77: rts
+lea L114, *r0
+m1
+jmp L97
+m4
+L78: .string "ouewgtmfinaookfr"
+prn #103
+
+stop
+m0
+m4
+m1
+rts
+m1
+m1
+L79: .data -599, 485, -278
+
+red r5
+
+prn r7
+inc r0
+stop
+; comment
+m2
+m2
+red *r2
+m1
+L80: stop
+m3
+prn r6
+L81: dec L108
+prn *r5
+sub #-74, L24
+stop
+not *r0
+cmp #155, #-164
+m4
+L82: rts
+L83: stop
+jsr L1
+L84: rts
+
+inc *r2
+lea L106, r3
+; comment
+prn L116
+; comment
+L85: mov r0, *r0
+rts
+m3
+stop
+m0
+sub *r5, r4
+rts
+stop
+jmp L110
+add #160, r7
+prn #38
+; comment
+prn #233
+lea L58, r0
+L86: .data 961, 54, 611, -338
+jsr *r7
+L87: mov #-185, L38
+lea L93, r6
+m0
+m1
+jsr L91
+L88: jmp L113
+jsr L92
+inc L94
+stop
+lea L71, r6
+L89: dec *r0
+jsr L64
+prn L20
+L90: prn r3
+lea L31, r4
+lea L107, *r2
+lea L118, *r0
+m0
+m2
+L91: dec r5
+; comment
+lea L114, L13
+inc *r6
+L92: not L63
+L93: not r6
+L94: .string "xjpwin"
+bne L75
+not r2
+prn *r4
+inc *r1
+L95: red r3
+lea L110, L116
+L96: mov L113, L103
+L97: .string "fbaugvs"
+jmp L80
+cmp *r5, #165
+inc *r1
+L98: .data 604, 658, -924, -173, -363, -63
+add #-9, r7
+stop
+red r3
+clr L104
+
+L99: bne L102
+m1
+m2
+m1
+m2
+L100: jmp L117
+inc *r4
+cmp #106, r6
+m4
+L101: .string "bfacjwlipetjmct"
+m2
+lea L119, L111
+bne L113
+m3
+bne *r6
+
+lea L90, L106
+L102: .data -191, 672, -850, 898, -344, 562
+clr *r3
+L103: .string "ppnksqm"
+L104: bne *r3
+bne *r6
+L105: red r4
+not *r3
+sub L114, L97
+bne *r2
+
+stop
+red *r7
+L106: mov L117, L16
+L107: .data -537, 5, -642, -425, -913, 139, 700, 282
+stop
+jsr *r6
+lea L115, *r2
+m4
+L108: .string "ycyvwqqj"
+cmp *r7, *r5
+m4
+m1
+m0
+mov L88, r3
+L109: lea L118, *r7
+L110: .string "bgwcehaouvtndjyv"
+cmp r4, #-234
+; comment
+jsr L25
+L111: mov *r7, r1
+jsr *r5
+L112: .data -306, 313, 17
+jsr L2
+stop
+m2
+not L16
+add *r7, *r4
+prn *r2
+red *r7
+jsr L114
+m1
+prn #-216
+; comment
+jmp L115
+clr r3
+mov L117, r3
+clr r6
+sub #173, L114
+m3
+L113: cmp L114, *r7
+add r7, *r2
+L114: .data 497, -947, 882, 741
+L115: clr r7
+inc *r5
+red L116
+dec *r2
+rts
+not r2
+L116: .data 427
+lea L50, r0
+red r0
+not r4
+jsr *r0
+L117: stop
+L118: dec r0
+
+prn r2
+bne *r7
+jmp *r3
+L119: .string "ibtjywcknogiy"
+stop
+inc *r7
+stop
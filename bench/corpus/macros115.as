@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 116
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    jmp *r6
+    rts
+    rts
+    lea L111, L52
+    not L81
+    dec *r2
+    bne L11
+    red L60
+    dec *r2
+    jsr *r1
+endmacr
+macr m1
+    rts
+    lea L50, L111
+    add *r5, L101
+    add *r0, r6
+    jsr L21
+    lea L78, r5
+    lea L61, L117
+    stop
+    lea L29, *r5
+    inc r5
+endmacr
+macr m2
+    inc *r2
+    add r0, r7
+    cmp *r4, L75
+    dec *r2
+    cmp *r3, L83
+    stop
+    jsr *r3
+    jmp *r7
+    jmp L40
+    add L94, r1
+endmacr
+macr m3
+    jsr L28
+    add *r3, r2
+    jsr *r0
+    cmp *r7, r5
+    sub #-241, r6
+    prn L85
+    sub r6, L75
+    sub #-109, *r3
+    add #157, r2
+    jmp *r5
+endmacr
+macr m4
+    clr r2
+    prn #-110
+    red *r1
+    cmp L34, *r3
+    lea L109, L62
+    jsr *r0
+    lea L30, *r3
+    not r6
+    jsr L0
+    dec *r6
+endmacr
+red L81
+; comment
+mov L67, *r4
+L0: stop
+L1: .data 401
+m1
+inc *r1
+add r2, *r7
+sub r6, r5
+L2: bne L0
+m3
+stop
+lea L2, *r1
+m1
+red *r4
+jmp L1
+L3: mov *r2, r1
+L4: stop
+L5: .string "swjp"
+; comment
+rts
+clr L65
+lea L60, *r4
+m3
+L6: stop
+add *r3, r1
+L7: stop
+stop
+lea L41, L12
+m0
+m2
+prn #-105
+cmp L0, #191
+; comment
+L8: sub *r7, *r5
+red L19
+
+m1
+red *r5
+m3
+red L50
+jmp L0
+cmp *r5, L5
+L9: cmp *r6, r2
+L10: .data -94, -911, 878, -275, 721, 698
+prn r7
+jmp L58
+m2
+L11: not *r5
+m1
+m1
+L12: red r3
+m3
+L13: clr r3
+sub r5, L87
+L14: .string "o"
+cmp #211, r2
+m1
+L15: red *r0
+not L12
+red L4
+inc L15
+dec *r4
+m3
+bne *r0
+L16: clr L82
+sub #216, r7
+bne *r4
+L17: .string "cgxqzdsowteahsifpqrnyhz"
+L18: red L16
+jsr *r2
+mov #-211, r2
+mov *r4, *r5
+not *r2
+m3
+L19: .data 767, 175
+lea L44, L51
+m4
+m2
+add L53, L88
+L20: not L100
+jmp *r7
+m2
+mov L44, *r6
+not *r1
+; comment
+m3
+prn #-74
+lea L16, r2
+m0
+clr r0
+L21: .data 673, 736, -918
+red L83
+rts
+jmp L56
+inc L14
+lea L5, L26
+inc *r4
+m0
+L22: .string "vzlpatokdaiind"
+L23: .string "thqyfnk"
+stop
+m0
+L24: sub *r3, r6
+not *r6
+L25: mov L10, *r2
+bne L3
+sub #-135, L2
+mov r3, L21
+dec L66
+jsr L25
+lea L25, r4
+dec *r2
+; comment
+m1
+dec *r2
+L26: .string "tjthmqvhpitcjqkfubifk"
+m4
+L27: red *r1
+dec L4
+stop
+jmp *r6
+cmp *r6, r1
+L28: .data 326, 680, -478
+L29: bne L61
+cmp *r7, L35
+lea L61, r7
+L30: .data 374, -645, 714, -151
+sub #105, L32
+bne *r2
+prn L22
+jmp *r5
+L31: mov L28, L0
+cmp L45, *r4
+m3
+L32: clr r1
+dec *r0
+add L18, L4
+dec r0
+inc L14
+jmp *r2
+add r1, r1
+jmp L10
+jmp L102
+
+clr L24
+jsr L7
+red L110
+bne *r2
+lea L107, L2
+jmp *r0
+jmp *r4
+m3
+cmp L41, #48
+m0
+prn *r1
+jmp L33
+m2
+dec L45
+stop
+clr r0
+; comment
+mov #163, L23
+; comment
+mov *r7, *r3
+m2
+bne L27
+m2
+m0
+bne L98
+m3
+sub r3, *r2
+L33: not r7
+bne *r4
+jmp L10
+mov #91, *r0
+m4
+mov r5, r3
+L34: red L97
+rts
+m1
+prn L92
+lea L75, L27
+m0
+sub r1, r3
+prn #143
+lea L19, r7
+m2
+bne *r4
+L35: bne *r1
+red r1
+red L40
+m1
+; comment
+m1
+
+not *r5
+L36: jmp *r6
+m3
+L37: .string "oyjlnrmpsjtfipsrip"
+mov *r2, L35
+L38: bne *r4
+lea L7, L33
+; comment
+prn r3
+prn #-102
+m3
+cmp #-168, L1
+L39: lea L75, r4
+cmp *r4, r3
+; comment
+L40: add #-149, r4
+jmp L34
+L41: clr r0
+m4
+jmp L6
+L42: .string "zslseukoux"
+jsr *r4
+rts
+add r1, *r4
+L43: .data -684, -892, 982, 88, 607, 275, -936, -508
+cmp #-250, r5
+
+add L20, L64
+; comment
+L44: .data 764, 321, 394, 368, 849, 627, -186
+L45: clr L95
+stop
+add #218, r6
+dec r5
+dec r4
+L46: .string "fua"
+bne *r6
+m2
+m4
+stop
+prn r2
+bne L50
+m4
+lea L74, L13
+lea L104, L83
+mov L15, *r4
+L47: prn L43
+lea L104, L47
+m2
+clr *r0
+L48: .data 151, 774, 490
+L49: .string "nufu"
+m2
+jmp L39
+L50: sub #98, *r7
+L51: not L95
+add L38, *r1
+L52: inc L23
+L53: cmp L47, #-19
+L54: .data 496, 78, -498
+L55: mov *r0, *r2
+add r4, L27
+not L92
+L56: lea L43, *r5
+rts
+L57: .data -446, -479, 928, 308
+prn L50
+L58: mov r3, L35
+L59: add *r5, L65
+bne *r1
+L60: .string "yzucwajml"
+jmp *r4
+m3
+L61: sub L17, *r3
+inc L4
+add *r1, *r3
+L62: add #51, r2
+not *r2
+clr r4
+dec r1
+L63: prn *r3
+L64: .string "uyvujhwdhcsnnuemxwx"
+lea L102, L41
+lea L66, r6
+rts
+; comment
+m2
+m4
+m2
+dec r1
+red *r4
+cmp r1, #-105
+m2
+m2
+L65: .data 360, 420, 560, -646, -187, 916, -117, -910
+L66: jsr L13
+m1
+L67: .data -762, -843
+L68: add r0, L93
+m2
+mov r0, L29
+L69: bne L0
+sub L67, L8
+sub L70, *r3
+jmp L7
+add *r2, *r1
+red r2
+L70: .data -733, -904, 447, 455
+L71: .string "llwviq"
+m0
+clr *r0
+not r6
+dec r0
+lea L70, L27
+clr r3
+L72: .string "zlxsgjm"
+not L96
+L73: bne *r3
+L74: inc L74
+not r7
+add r2, L57
+rts
+L75: .data 306, 637, 581, -421
+
+L76: red r2
+L77: add #-23, L65
+dec *r1
+
+m1
+rts
+inc r6
+lea L102, L108
+cmp L40, *r0
+add L98, *r1
+clr *r4
+dec *r2
+L78: lea L15, *r1
+red r6
+jsr L26
+stop
+mov #-212, L83
+L79: .data -626, 132, -445, 662, -689, 739, 668
+
+
+not L36
+L80: .data 154, -342, 248, 877, -153, 315
+clr *r7
+L81: jsr *r1
+; comment
+clr r7
+L82: add r7, r3
+m3
+inc r2
+jsr L46
+rts
+jmp L109
+m0
+L83: .data -483, 775, -188, 655, -972, -348, -858, 980
+bne *r3
+not L94
+lea L15, L66
+red L62
+L84: .data 438
+stop
+m0
+lea L110, *r6
+L85: bne L89
+prn #51
+bne L110
+bne *r6
+; comment
+L86: jsr L91
+cmp *r7, L113
+
+m0
+L87: .string "pkpev"
+m0
+jsr *r6
+sub #1, r5
+cmp *r5, r0
+L88: sub #-10, *r2
+sub r7, r0
+L89: prn r4
+L90: add *r4, r2
+lea L105, r0
+inc r5
+not *r1
+sub r0, L52
+bne *r5
+; comment
+stop
+m3
+lea L85, r5
+jmp *r3
+red *r5
+L91: prn *r7
+clr L105
+stop
+L92: rts
+m0
+cmp L64, #-236
+m4
+L93: cmp L103, #-227
+L94: dec L110
+L95: add *r4, L59
+mov #161, r0
+inc L115
+cmp *r0, *r1
+L96: red L112
+L97: .data 869, 9
+stop
+red *r3
+sub r7, r2
+m3
+L98: .string "voou"
+L99: not L42
+not L116
+red *r0
+m4
+red r7
+not L67
+L100: cmp *r2, #64
+stop
+sub r0, r3
+rts
+m0
+jmp L85
+stop
+prn r2
+L101: .data -615, -270, -60, -263, -179, -380
+not r5
+add r5, *r4
+L102: jmp L112
+L103: lea L96, L17
+inc L113
+bne *r3
+mov r3, L114
+L104: .data 307, 504, 459, 487
+L105: dec *r3
+not r5
+
+red *r3
+m3
+cmp L45, *r7
+add #-213, *r4
+prn #-212
+m0
+L106: mov L77, L107
+; comment
+mov r4, L22
+rts
+stop
+rts
+L107: .data -521, 201, 774, 938
+jsr L110
+m2
+sub r3, r6
+L108: mov #86, *r2
+jsr L114
+not *r6
+rts
+sub L115, r2
+mov *r2, r5
+m3
+add L37, L78
+not L105
+
+m2
+L109: bne L57
+lea L72, *r6
+stop
+L110: rts
+jmp *r2
+m3
+L111: prn *r0
+red *r0
+L112: mov *r2, r7
+rts
+dec *r1
+clr *r1
+L113: rts
+sub r6, r0
+cmp #-144, L116
+L114: red *r1
+jsr L7
+L115: bne L91
+m0
+clr *r5
+
+m1
+red r3
+L116: .string "frlhxjosfkuab"
+bne *r6
+m4
+inc L117
+jsr L28
+mov #232, L117
+sub *r1, L59
+m3
+clr r5
+m4
+; comment
+m0
+L117: .string "cctdatvaysojajgnkeznav"
+stop
@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 117
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    stop
+    mov *r4, r7
+    bne L10
+    inc L19
+    jmp L14
+    clr r6
+    cmp *r5, *r5
+    add *r6, L86
+    cmp #59, L87
+    sub L49, r3
+endmacr
+macr m1
+    lea L79, r4
+    lea L27, *r5
+    prn *r1
+    prn *r5
+    not L38
+    jmp *r4
+    sub *r1, r7
+    jmp L85
+    red r3
+    stop
+endmacr
+macr m2
+    clr r1
+    dec L81
+    red *r5
+    add #-191, L17
+    red *r1
+    cmp r5, L68
+    not r6
+    bne *r3
+    cmp r2, *r2
+    dec *r7
+endmacr
+macr m3
+    stop
+    jsr *r1
+    sub #-43, *r3
+    prn #-240
+    dec L61
+    dec L34
+    cmp L18, L62
+    clr r0
+    lea L83, L55
+    stop
+endmacr
+macr m4
+    clr L13
+    cmp L22, #198
+    inc L41
+    rts
+    mov r5, r2
+    clr *r1
+    red r3
+    red *r0
+    not L44
+    bne *r5
+endmacr
+m1
+dec *r5
+lea L13, r5
+m0
+red *r5
+inc L2
+clr r2
+m3
+L0: inc r5
+L1: bne L1
+cmp r4, #164
+L2: mov *r7, r4
+L3: cmp *r3, r2
+cmp *r3, r2
+m3
+m0
+red *r5
+jsr *r6
+mov *r1, r6
+prn r1
+bne L0
+m0
+m3
+stop
+cmp r3, L0
+not *r4
+m0
+add *r4, *r1
+L4: .string "osssaijdtqb"
+stop
+m2
+L5: jsr L2
+mov r4, *r5
+L6: not r0
+jsr L5
+
+jmp *r2
+red r3
+prn r0
+L7: .data -288, 408
+m0
+L8: red r3
+lea L7, L3
+cmp *r4, *r4
+L9: inc r7
+clr r5
+sub L9, L6
+clr *r3
+m4
+m1
+red L42
+red L20
+L10: .string "zftmypacqrkbxuuqv"
+prn r2
+L11: rts
+L12: .data 34
+
+jmp *r1
+lea L1, r7
+L13: inc L1
+sub L27, *r7
+clr L81
+m0
+m0
+cmp *r1, L4
+inc L1
+lea L0, *r0
+m0
+sub r1, *r5
+jsr L3
+L14: red *r2
+clr *r3
+m4
+
+L15: stop
+L16: mov r1, L47
+L17: .data -683, -349, -904, -928, 355, 843, -72
+L18: jsr *r3
+not L26
+bne L42
+L19: clr r2
+L20: cmp L31, *r5
+L21: .data -672, 46, -712, 6
+m3
+inc r2
+stop
+red *r0
+m2
+L22: sub #-252, *r1
+stop
+jsr L16
+L23: .data -737, -228, -785, -161, -56
+red *r7
+clr *r3
+sub *r4, r6
+; comment
+L24: .data -196, 467, 393, 892, 662, -561, -1000, 447
+clr L41
+stop
+L25: jsr *r0
+
+dec *r7
+red r2
+m1
+add r0, r4
+L26: .string "ecbyfejpr"
+L27: add *r7, L61
+jsr *r0
+jsr L36
+prn #243
+prn *r7
+m4
+inc r2
+add #-62, r7
+inc *r7
+m2
+m3
+not r7
+m3
+L28: rts
+L29: .string "qaojoyyjavwmnm"
+m0
+clr L99
+m1
+dec *r3
+m4
+add #-7, L3
+L30: jsr L39
+dec *r1
+m4
+L31: .data -135, 684, 443, 978, -650
+not r5
+L32: .string "utheyfykwozyrtedphmgov"
+m1
+prn r7
+L33: .data -701, -23, 747
+stop
+jmp *r0
+L34: lea L52, L55
+m0
+lea L91, r0
+inc L0
+m3
+jmp *r0
+cmp #-159, L76
+
+L35: .string "rtcgyqcllodieidcnwbkzldt"
+L36: .string "ymyiskjuypxuhosmmapwhum"
+sub r0, L48
+lea L5, L39
+lea L58, r7
+bne L36
+stop
+mov L90, r3
+m0
+; comment
+dec *r6
+L37: not r5
+m1
+lea L81, r5
+L38: .data -621, -634, -839, -785, 595, 735, -801
+sub L94, *r2
+cmp L25, r1
+sub L51, *r0
+jsr *r7
+L39: .string "wrtjuovyth"
+not L72
+clr *r3
+prn r6
+cmp r4, *r4
+not r7
+; comment
+sub r6, L32
+rts
+mov #-209, *r1
+clr L62
+clr *r7
+
+m3
+m0
+L40: prn *r2
+m2
+red *r2
+prn *r1
+m1
+not L7
+m4
+L41: clr *r7
+clr L92
+rts
+dec *r4
+m4
+L42: clr L59
+jmp L79
+; comment
+cmp *r3, L31
+m4
+lea L34, r5
+m4
+m0
+jmp L5
+m0
+not r4
+lea L97, L74
+stop
+red r0
+cmp L17, L39
+not *r0
+mov r1, r2
+L43: stop
+
+L44: .string "hmmrtxxbkgkvmksnmvct"
+jmp L15
+m3
+L45: .data 420
+m3
+
+; comment
+
+L46: bne L40
+lea L50, L43
+m3
+L47: cmp #-202, *r7
+; comment
+L48: .string "oshnrwemcxrdrnglr"
+dec r4
+L49: .data 509, 45, -750
+sub *r3, *r3
+stop
+not *r0
+
+jsr L95
+m4
+L50: dec L33
+add *r1, *r0
+not *r0
+inc r3
+prn L36
+L51: clr L73
+jmp L78
+add L93, *r4
+m0
+jmp *r3
+inc *r2
+cmp L4, *r2
+m1
+not r0
+m0
+bne *r3
+jsr L17
+add *r5, *r4
+stop
+prn L67
+L52: .string "rilktuokm"
+rts
+m2
+stop
+sub L87, *r1
+mov #-76, *r3
+rts
+sub r5, L82
+L53: .data 589, -851
+stop
+m0
+m1
+jsr *r6
+L54: dec *r2
+rts
+; comment
+not *r0
+L55: .string "agnttxlcycqourvyxhfdmhg"
+clr L16
+L56: .string "mgrmooflpoiqyodvdwzocma"
+m3
+cmp #-12, L55
+mov #-204, *r3
+m1
+m0
+L57: .data -883, -867, -506
+sub #147, r4
+L58: mov *r5, *r6
+L59: mov *r4, r7
+bne *r4
+jsr *r0
+inc r2
+jmp *r1
+
+red r7
+L60: prn L43
+inc r6
+prn #-70
+bne *r6
+mov #180, *r2
+rts
+mov *r0, r7
+red L62
+m3
+rts
+m3
+lea L68, L92
+dec *r3
+not L89
+m1
+L61: cmp #136, r5
+; comment
+jsr *r2
+red *r0
+m1
+m0
+; comment
+m4
+m2
+prn L42
+; comment
+m0
+rts
+; comment
+rts
+jmp L84
+dec L9
+red L17
+mov r2, *r4
+; comment
+L62: .string "fuyfqsj"
+red r3
+
+L63: inc *r6
+L64: mov *r3, *r6
+m2
+m4
+sub #145, L39
+dec r0
+clr L12
+prn L56
+add r5, *r2
+m3
+L65: prn *r6
+not r3
+red r2
+red *r4
+jsr *r3
+stop
+L66: .data -628, 452, 942, -463, 91, -622, 935
+jsr *r6
+jsr *r2
+m0
+; comment
+m2
+clr r2
+L67: rts
+sub *r2, r5
+bne *r7
+not r5
+mov r7, r0
+dec *r6
+dec r1
+m3
+prn r6
+L68: .data -301
+jmp *r6
+rts
+L69: clr r4
+L70: bne *r2
+clr r7
+red *r2
+red *r7
+L71: .string "ccqt"
+not r5
+m0
+m2
+m2
+sub #1, L91
+not r0
+L72: .string "ckmophpwsqvpkdqmrelhx"
+rts
+rts
+stop
+add *r3, r1
+m4
+; comment
+prn #253
+red r0
+L73: .string "kfjjliwau"
+jmp L75
+prn L91
+jmp L64
+clr L52
+L74: rts
+L75: .data 199, 863, 718
+
+not L89
+m1
+mov *r6, r1
+prn L93
+L76: cmp *r4, #67
+jsr *r3
+jmp *r1
+m1
+lea L78, r6
+m4
+rts
+cmp L93, #99
+red r0
+m2
+
+jmp *r2
+L77: dec r1
+rts
+m4
+L78: .data 351, -767
+L79: .data -494, 513, 663, 361, -656, -870
+not *r1
+L80: .string "ipnkmgpfcrwcgafwux"
+clr r0
+; comment
+jsr L96
+mov r4, *r3
+L81: red r5
+L82: .data -315, 65, 680
+jmp *r3
+sub *r2, *r4
+L83: .data 204, 480, -810, -967, -395
+prn r7
+add #-5, *r7
+m1
+rts
+m0
+L84: cmp *r3, L99
+bne L86
+prn *r6
+add *r6, r3
+L85: .data 463, 950, 127, 171, 561, 422, 460
+L86: lea L65, r7
+
+L87: not *r6
+jmp *r2
+stop
+red r4
+L88: .string "lucpnsu"
+sub #-106, L99
+
+L89: inc L89
+L90: .string "nhrmzppdahsxer"
+red *r5
+dec *r3
+L91: red L99
+cmp r7, #-198
+red r0
+L92: prn r0
+sub r1, *r6
+inc *r1
+L93: jsr L0
+m2
+bne L97
+m2
+m3
+add *r1, r6
+m3
+mov r2, r6
+rts
+inc r3
+inc *r2
+add r1, r2
+jmp *r4
+jsr L55
+m4
+bne *r4
+m2
+add r3, r0
+L94: .string "uvovgj"
+rts
+L95: red L96
+m3
+m4
+m3
+; comment
+L96: jsr *r6
+L97: rts
+mov L54, r6
+lea L99, r7
+m1
+bne L99
+sub #-164, L99
+m2
+clr r5
+L98: bne L48
+m1
+add L20, *r4
+prn L62
+jmp *r7
+rts
+sub #52, L99
+m3
+m3
+mov *r2, *r3
+m2
+L99: .string "ynzhdiihcuwzgbgwgk"
+inc r1
+cmp r0, #-195
+
+stop
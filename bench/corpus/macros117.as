@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 118
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    stop
+    lea L80, *r2
+    jsr L96
+    not r6
+    stop
+    prn L27
+    lea L56, *r2
+    rts
+    jmp L34
+    clr *r2
+endmacr
+macr m1
+    rts
+    jsr L21
+    dec L42
+    add L87, L78
+    inc r0
+    stop
+    jsr L23
+    dec *r7
+    dec *r2
+    dec L52
+endmacr
+macr m2
+    bne L68
+    cmp L38, *r1
+    jmp *r6
+    clr r4
+    cmp *r5, L14
+    red *r5
+    cmp r6, r2
+    rts
+    inc L57
+    rts
+endmacr
+macr m3
+    red *r1
+    stop
+    sub L51, *r0
+    not L48
+    not L14
+    clr r4
+    jsr *r7
+    clr L69
+    not L57
+    red *r5
+endmacr
+macr m4
+    sub r6, *r4
+    jmp L100
+    mov L88, L18
+    mov r3, r4
+    jsr *r3
+    sub #-114, r2
+    red r0
+    sub L80, L77
+    stop
+    prn r6
+endmacr
+jsr L97
+
+L0: clr *r5
+
+inc r4
+L1: lea L0, r5
+lea L47, *r1
+lea L0, r5
+m1
+stop
+add *r0, *r5
+lea L73, r6
+m3
+add *r2, r7
+L2: rts
+lea L49, L71
+cmp L70, #-220
+dec *r5
+dec L20
+lea L0, r1
+m2
+L3: .data 735, -779
+cmp *r0, L3
+mov *r5, *r2
+bne L51
+m2
+jsr L1
+cmp *r5, L69
+L4: add r1, L0
+m2
+L5: prn #-215
+dec L95
+m2
+L6: .string "mfmtvmucnqjnwgcyc"
+sub *r3, L0
+rts
+lea L1, r2
+jsr *r1
+L7: .string "gqhilktuhjzzwit"
+L8: .data 416, 569, 394, -529
+m4
+L9: .string "khvprbxnfhuavpwtxvgnph"
+rts
+m1
+L10: add #-203, L3
+clr *r7
+jsr L10
+m2
+mov r1, *r0
+jmp L44
+L11: add *r3, L9
+stop
+L12: dec *r3
+red L8
+add L40, *r0
+lea L10, *r0
+cmp L35, L62
+inc *r6
+lea L2, *r3
+L13: .string "ggiiprakwyfexniqgeux"
+m1
+L14: prn *r0
+L15: jmp L89
+sub *r2, L32
+sub *r7, r6
+inc L1
+jmp L1
+add #-216, L6
+inc r4
+m4
+L16: rts
+stop
+m3
+sub r7, r6
+rts
+prn *r6
+cmp *r6, L98
+prn *r3
+not L8
+dec *r7
+cmp #35, *r4
+stop
+jsr *r0
+lea L16, *r1
+cmp r4, *r6
+mov r4, r5
+clr L3
+dec *r5
+stop
+not *r3
+red L1
+rts
+m0
+L17: .data -22, -366, 396, -839, 402, 54, -134
+m2
+m2
+rts
+L18: lea L27, r1
+
+mov *r5, r5
+m1
+L19: .string "qszzmxaxzfwgbx"
+L20: .string "ckaaprlxxhlftzqieccyc"
+dec L64
+jsr *r1
+m0
+dec *r7
+bne L17
+rts
+prn L6
+jmp *r0
+jmp L19
+m2
+inc *r5
+jsr L36
+stop
+mov #191, *r4
+not L1
+rts
+cmp L12, r3
+m4
+m4
+inc L49
+m3
+L21: dec r1
+m1
+not L2
+L22: stop
+bne *r3
+L23: mov *r0, L58
+mov *r2, *r3
+clr r6
+bne L1
+L24: .string "yzzsxd"
+L25: .data -956, 615, -804, 40, -235, 496, -530
+
+L26: .data 819, -242, 11, -69, -720, 366, 48, 771
+sub #-176, *r3
+bne *r4
+L27: .string "yshouaartreww"
+red r7
+L28: jsr *r3
+jsr *r3
+stop
+prn *r0
+lea L36, *r2
+not L28
+L29: red r6
+inc L27
+m3
+
+cmp #-4, L69
+L30: jmp L24
+m4
+clr *r4
+L31: .data 294, -399, 168
+clr L4
+lea L13, r4
+not *r3
+stop
+not L33
+dec *r2
+m0
+stop
+L32: .data -460, 43, -507, -44, 744
+L33: .string "pujfyqsd"
+prn *r3
+add r4, r0
+; comment
+inc *r5
+; comment
+rts
+not L54
+not r7
+cmp r5, L48
+mov *r5, *r2
+L34: bne *r0
+stop
+m4
+clr r2
+red L100
+stop
+red L39
+m2
+m3
+rts
+m3
+L35: .data 951
+prn #176
+clr *r0
+
+add *r4, r1
+m2
+add r7, *r5
+m3
+not L8
+L36: jsr *r4
+m1
+L37: stop
+L38: bne *r5
+red r1
+clr *r5
+lea L72, *r5
+prn r0
+m4
+mov L26, L1
+L39: .string "sxrfyyoovsbqwnezfdutxiyc"
+sub #-103, *r3
+lea L8, L18
+L40: not *r1
+L41: .string "tn"
+m1
+; comment
+L42: .string "aosvsjhkszlvmztl"
+bne L34
+L43: prn #178
+m3
+add #65, *r1
+L44: mov L6, r4
+cmp r1, #-27
+add #-169, *r0
+L45: cmp *r6, #135
+add *r2, r7
+L46: clr L48
+m0
+cmp #-73, r4
+; comment
+prn r5
+L47: cmp r4, L74
+m3
+sub *r6, r7
+dec r2
+mov *r7, *r4
+m1
+jmp *r1
+L48: .data -541, -435, 233, 363, 125, 563
+jmp L97
+jmp L50
+lea L29, *r2
+dec *r4
+red L94
+red L60
+L49: jmp L68
+lea L24, r1
+
+add *r1, r3
+L50: jsr *r3
+L51: .string "fpqvsortlpduqoa"
+L52: add L96, L55
+stop
+L53: prn r3
+sub r0, r7
+m2
+stop
+L54: not r2
+cmp #-207, r4
+lea L60, *r3
+add L50, L100
+L55: dec r4
+jsr *r7
+bne *r7
+m0
+clr r1
+sub *r5, r2
+m2
+red r5
+
+L56: .string "tmovhyqikxu"
+m2
+prn #80
+mov #236, *r5
+lea L92, L57
+L57: dec r3
+not *r0
+lea L47, L96
+jmp *r1
+cmp r2, *r6
+L58: sub L77, r2
+jsr *r1
+m3
+red r5
+m4
+cmp L99, r7
+m3
+L59: sub r6, *r6
+m2
+stop
+m3
+red L46
+L60: .data 70
+m3
+bne *r1
+red r4
+cmp *r5, *r5
+sub L92, L8
+jmp L61
+inc *r5
+stop
+prn #185
+L61: .string "owwlgjpytzpueifqbighhe"
+sub L93, r0
+L62: prn r3
+stop
+L63: .string "mlnsjqtpxnamsy"
+add r5, r3
+cmp L91, L52
+stop
+not *r3
+stop
+; comment
+L64: lea L75, *r2
+L65: jmp *r4
+jsr L37
+L66: jsr L11
+inc r4
+mov #-254, L61
+prn L70
+m1
+stop
+L67: cmp L85, #-203
+L68: .data -78, -906
+
+L69: .string "naixzxsfqltpihfbpvv"
+add r0, L78
+inc L82
+m1
+m1
+L70: .data 999, -161, 260, -364, 598, 410
+bne *r1
+mov r0, L39
+sub *r0, r0
+mov L43, *r1
+m1
+bne *r3
+cmp r6, L71
+mov #45, L28
+L71: sub #-6, r1
+rts
+lea L40, r0
+cmp L6, *r7
+m2
+stop
+jsr *r1
+L72: .string "sjlbtoqcczmdw"
+prn r3
+L73: inc *r3
+clr *r0
+mov r1, r0
+inc *r0
+jmp *r2
+L74: .data -188, -456, -996, -629, 679
+prn #-82
+rts
+m4
+m2
+clr r1
+add #138, r4
+sub r0, *r4
+L75: .data -260, -242, 419, 930, 192, 471, -933, -169
+dec L97
+red *r1
+m4
+sub #209, L10
+cmp *r2, r0
+m1
+stop
+add #213, *r4
+lea L61, r0
+dec L86
+jmp *r7
+bne L37
+m3
+stop
+rts
+jsr L37
+; comment
+L76: clr r7
+not *r5
+jmp *r5
+cmp r6, r3
+prn #-93
+L77: .data -742, -682, -477
+bne L69
+m4
+m1
+m0
+L78: .data -234, 118
+jmp L32
+m1
+sub L88, r1
+stop
+stop
+jsr L9
+prn #-171
+red *r7
+red r6
+; comment
+L79: .string "rtsmtguwie"
+L80: .string "rkzbejlobuzhnywqdgvvys"
+jmp *r0
+dec r3
+red *r1
+prn #203
+jsr *r5
+L81: mov L50, *r4
+m4
+prn r5
+stop
+L82: .data 985, -973, 267, -608, -620
+mov L62, *r2
+not *r6
+lea L97, L72
+bne *r7
+prn *r4
+dec L85
+m1
+
+
+L83: sub *r0, *r5
+rts
+lea L38, L98
+clr *r5
+lea L90, *r6
+inc L88
+L84: bne L56
+L85: mov r6, r6
+not *r7
+not L27
+L86: .data -424, -967, 193, -434, 16, -964, -755, 749
+clr *r7
+bne *r2
+prn #125
+dec *r1
+bne *r3
+L87: .data -313
+L88: sub r7, *r1
+lea L44, *r5
+dec r4
+L89: .data 21, -316, 740, 6, -744, 18
+dec r5
+sub *r4, r2
+m2
+prn #-109
+m3
+jsr L96
+red L71
+L90: .string "srsoulrifmmzjmbdlczm"
+L91: .string "cwkcutoig"
+bne L63
+L92: bne *r7
+bne L96
+dec *r1
+m2
+add L61, *r6
+
+add L12, L65
+
+bne L98
+lea L27, r4
+L93: clr r1
+dec *r5
+m2
+
+cmp *r7, *r3
+m1
+bne L69
+jsr *r1
+mov r4, L95
+mov L99, *r0
+sub r6, L36
+m3
+red r3
+m2
+jsr *r4
+clr *r7
+add r0, L96
+mov r3, r7
+m0
+L94: .string "ebuos"
+inc r6
+cmp r1, #-195
+L95: jsr *r5
+m2
+jsr L99
+prn L96
+L96: lea L37, r6
+dec *r7
+L97: .data -483
+L98: jmp *r5
+red L18
+jmp *r2
+inc *r6
+L99: cmp *r6, #-34
+jmp L17
+inc L72
+L100: .data -574, -215
+lea L10, L96
+lea L18, *r4
+sub *r2, *r1
+red r2
+stop
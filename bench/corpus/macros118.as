@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 119
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    inc L89
+    cmp #-236, L22
+    cmp r6, #2
+    jsr *r5
+    stop
+    lea L107, *r0
+    not *r4
+    red L43
+    red L44
+    red r7
+endmacr
+macr m1
+    inc *r2
+    mov L100, *r2
+    rts
+    clr r6
+    bne L8
+    clr r2
+    sub L55, *r3
+    stop
+    inc *r3
+    add L88, *r3
+endmacr
+macr m2
+    not r4
+    cmp *r3, L99
+    mov #-15, L73
+    add *r0, L32
+    cmp r5, #91
+    stop
+    add #198, L29
+    add #52, *r7
+    lea L36, *r1
+    prn r7
+endmacr
+macr m3
+    bne L35
+    stop
+    not r6
+    sub r3, *r2
+    bne *r0
+    dec *r0
+    bne L71
+    stop
+    jsr *r7
+    lea L7, L25
+endmacr
+macr m4
+    not L69
+    red *r5
+    clr r1
+    jsr *r2
+    stop
+    clr r3
+    mov *r4, r2
+    bne *r4
+    lea L86, *r5
+    red L73
+endmacr
+L0: .data 737, 632, 465, -438, 548
+inc r7
+m4
+red L0
+m3
+m0
+mov L60, L92
+; comment
+jmp L0
+
+L1: .string "llpdtqmvnuhvymolujojcca"
+L2: not r6
+jsr *r7
+red r3
+dec *r5
+inc r6
+lea L1, L49
+clr r5
+sub L2, *r5
+L3: jsr *r3
+L4: .string "gvxkwao"
+add *r6, *r7
+L5: .data 707
+bne *r7
+L6: bne *r6
+cmp r7, #-205
+cmp *r2, L57
+m3
+m2
+L7: not L5
+bne *r1
+m3
+add r2, r2
+
+mov L7, L8
+prn r3
+red r6
+clr r1
+L8: .data -980, 179, -605, -711, 228, 571, 188, -247
+rts
+jmp L0
+L9: .data -430
+m4
+mov *r2, *r0
+L10: prn *r7
+
+; comment
+dec *r2
+m4
+mov *r3, L6
+L11: dec r2
+; comment
+jsr *r0
+L12: add *r0, *r7
+not *r5
+L13: red L18
+m3
+L14: mov L13, *r5
+L15: .string "zpbrjauwal"
+m0
+m2
+L16: sub r4, r7
+jsr *r6
+lea L5, r2
+L17: inc *r3
+m4
+dec r2
+prn #83
+L18: .string "ldhgoxgv"
+L19: .string "utzwivasgwguisb"
+jsr *r1
+m0
+L20: prn *r7
+bne *r3
+bne L61
+stop
+prn #36
+L21: .string "cnolizfwotqimthi"
+not *r4
+sub *r6, L3
+clr r4
+dec *r7
+bne *r3
+rts
+bne L11
+m2
+L22: bne *r6
+red L15
+; comment
+m1
+clr L37
+add #61, r3
+bne L3
+m4
+jsr L39
+m3
+L23: jsr *r6
+jmp *r5
+jmp *r7
+stop
+
+bne L110
+
+m1
+jsr L14
+jsr *r4
+clr *r5
+rts
+lea L8, *r3
+L24: .string "mlkswyztccvwf"
+sub r1, *r1
+not *r3
+L25: jsr *r2
+lea L98, *r0
+L26: prn r1
+not *r5
+L27: add #119, L13
+stop
+m3
+red r7
+inc *r7
+lea L6, L51
+clr r3
+m4
+L28: .string "obi"
+rts
+jsr *r1
+L29: lea L20, L88
+m0
+jsr *r6
+L30: .data -50, 232, -113, -497, -12, 336
+L31: bne L28
+stop
+sub r7, r0
+mov L34, r5
+inc r7
+L32: bne *r5
+jsr *r4
+m2
+inc *r6
+red L23
+m1
+add L57, *r0
+L33: .string "hepzbixnhxezaeykdglxdvx"
+mov *r1, L111
+jsr *r7
+jmp *r4
+L34: .string "rxviweieckxdspfjb"
+L35: sub #-216, *r2
+prn *r7
+bne L46
+m1
+m2
+jmp *r7
+L36: .string "vgsp"
+jmp *r3
+inc *r1
+clr L10
+stop
+lea L107, *r2
+m2
+rts
+rts
+
+dec r0
+L37: prn *r2
+jsr *r7
+cmp *r4, #63
+m1
+; comment
+L38: .string "evhzckizknexhwvlqvu"
+cmp L65, *r3
+stop
+not r7
+prn L16
+bne L3
+L39: .data -625, 228, -537, -451, 473, -350, -478
+m2
+m3
+L40: .data 574, 400, 144, 536, -117, -910, 74, 457
+stop
+L41: add #11, L22
+
+L42: not L72
+L43: not L3
+m1
+L44: .data 100, 373, -444, -688, 963, -827, -836, 889
+lea L30, r4
+m2
+m3
+stop
+L45: sub #139, *r2
+L46: .string "rkdekunn"
+L47: inc L36
+L48: bne L108
+clr r2
+prn r6
+m3
+add r7, r4
+L49: .string "fruabmgjt"
+jsr L8
+dec L92
+m2
+L50: .data -268, 256, 710, -466, -555, 583, 161, -720
+clr r2
+add L92, *r4
+stop
+stop
+m4
+red r3
+not L56
+cmp #-253, *r5
+L51: .string "avvlfeupbioiyjzrhwxdeb"
+L52: .data -528, 853, -103, 579, 871, -666, 257, -29
+clr r0
+dec *r7
+bne L48
+m0
+lea L89, L107
+bne *r4
+red L107
+prn *r2
+m4
+L53: stop
+lea L46, *r3
+L54: inc r7
+clr *r6
+sub #251, *r4
+L55: .data -990, 609, -199, 385, 253, 851
+lea L100, r7
+L56: .data 527, 118, 983, -799, 234, -312, -8, -912
+mov r2, L32
+L57: .data -34, -962, -972
+L58: cmp r6, #247
+inc *r2
+not *r5
+red *r0
+prn *r2
+; comment
+clr L24
+jmp L17
+m2
+add L71, r3
+prn *r1
+sub *r3, L39
+m1
+jmp L87
+jmp L90
+L59: lea L77, L70
+L60: red *r3
+clr r7
+not r3
+stop
+L61: bne L27
+m4
+L62: jsr *r5
+bne *r3
+prn #253
+inc *r4
+sub r6, r2
+stop
+; comment
+m2
+dec *r6
+cmp r0, *r7
+m2
+bne L22
+sub #78, *r4
+sub #152, L73
+clr r7
+L63: not r4
+red r1
+m1
+L64: .data 326, 650, 708, -967, -176, -555
+; comment
+m4
+prn L9
+L65: .string "luvpepyndhlboyairnov"
+L66: clr r0
+dec *r6
+red L90
+L67: .data -74, -628, 962, 902, -466, -712, -748, -94
+m4
+clr L79
+; comment
+L68: .string "ujpdpworxrssul"
+L69: .data 506, -95
+prn *r3
+L70: mov r7, L38
+m4
+sub r5, L41
+rts
+L71: .string "xhwuxsusbep"
+
+clr *r7
+; comment
+stop
+m2
+prn #-110
+m4
+; comment
+red r6
+dec L113
+mov *r3, r0
+m4
+L72: jmp *r4
+not r7
+m4
+L73: cmp #-157, L36
+inc r0
+; comment
+bne *r1
+clr *r2
+prn L76
+jsr *r6
+sub *r3, L78
+dec r4
+m3
+m2
+bne *r2
+prn L80
+L74: prn #-101
+L75: .string "hmvycbjgvigqfxqbvkt"
+add L64, L97
+L76: .string "vshkurfieuj"
+L77: lea L89, L21
+rts
+stop
+L78: sub r1, r1
+rts
+jsr *r2
+dec L36
+not *r0
+clr L62
+jmp L83
+
+dec *r1
+dec r3
+stop
+inc r7
+not *r2
+stop
+m3
+add L110, r2
+mov #-185, *r4
+L79: .data -373, -786, -950, -173
+jmp *r6
+L80: rts
+L81: .string "ceqkbpozfiznazpqu"
+L82: .string "rpgnemtdrlasi"
+jmp *r7
+rts
+rts
+L83: .string "zjtlwocyzitsf"
+L84: bne *r0
+not L112
+L85: red L112
+jsr L5
+clr *r1
+m3
+mov #107, *r5
+add r6, *r1
+m3
+m0
+m4
+m0
+
+
+m1
+mov L68, r5
+m4
+jsr L110
+L86: .data 335, -954, -757, -496, -641, -334, 406
+not r7
+red r3
+L87: .string "ypipwezknzfdqpmlzxqyut"
+cmp #-112, r3
+L88: inc *r7
+L89: rts
+L90: jsr *r0
+L91: .data 145, 514, 626, -683, 673, -537
+; comment
+
+rts
+jsr L94
+prn r4
+m2
+jsr *r1
+mov *r5, L99
+add #224, r1
+m0
+m0
+rts
+inc *r6
+; comment
+lea L103, L78
+bne *r5
+mov r2, L93
+m3
+lea L99, *r2
+; comment
+
+not *r1
+L92: sub *r1, r0
+not r0
+m1
+lea L105, *r6
+not L99
+m3
+m2
+bne L105
+; comment
+mov *r4, *r6
+prn *r6
+inc L105
+inc r1
+rts
+L93: .data -164, 882, -65, 36, 556, -270, -703, 849
+L94: mov #-39, *r5
+dec r5
+m1
+L95: sub L90, *r4
+L96: .string "qsxj"
+L97: jmp L42
+L98: .data -241, 184, 289, 192, -945, -531
+L99: sub *r4, *r4
+bne L105
+L100: .data -385
+jmp *r0
+stop
+lea L35, r5
+L101: bne *r3
+L102: clr L103
+L103: sub r5, r3
+jmp *r3
+m3
+
+m3
+m4
+mov #168, L109
+m4
+L104: .data -952, 105
+not L107
+prn *r4
+lea L109, r0
+cmp #141, r0
+m4
+L105: prn L79
+L106: bne L114
+add *r2, L73
+m3
+m3
+L107: .string "qczezgtn"
+sub *r7, *r2
+jmp *r5
+m2
+inc r7
+m4
+m3
+add r7, r6
+lea L99, L112
+sub r4, *r4
+m3
+sub r7, r0
+bne L113
+inc L84
+L108: cmp #197, *r3
+bne *r3
+rts
+mov *r7, r0
+m1
+L109: stop
+dec *r1
+add r5, *r6
+jsr *r1
+L110: jmp L113
+bne L111
+not r3
+rts
+prn *r0
+m0
+L111: jmp L114
+L112: prn #-117
+rts
+not r5
+L113: jsr *r3
+cmp L114, *r2
+m0
+jmp *r3
+inc r0
+
+m2
+lea L114, L114
+prn #42
+rts
+jmp L114
+L114: .data -30, -227, -844
+m2
+mov #-128, r5
+stop
+stop
@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 120
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    sub *r0, r3
+    lea L76, *r1
+    red L88
+    clr L87
+    not r2
+    rts
+    not *r6
+    bne *r0
+    bne *r5
+    add r1, *r7
+endmacr
+macr m1
+    bne *r7
+    rts
+    not L26
+    prn L70
+    red *r1
+    inc L27
+    red L82
+    jmp L8
+    jmp *r1
+    cmp r3, #-22
+endmacr
+macr m2
+    rts
+    jsr *r1
+    inc L31
+    prn *r3
+    prn *r3
+    clr *r4
+    add L52, r2
+    bne *r6
+    stop
+    clr L101
+endmacr
+macr m3
+    cmp #22, *r4
+    not L82
+    bne *r4
+    not r6
+    stop
+    jmp *r6
+    stop
+    bne *r3
+    stop
+    red r5
+endmacr
+macr m4
+    jmp L83
+    red L34
+    red r2
+    not L36
+    prn r6
+    jsr L25
+    red r6
+    jsr *r4
+    prn #43
+    bne L3
+endmacr
+not L34
+L0: red r6
+L1: cmp r7, r2
+L2: .string "twoollrygcvdlhozaq"
+jsr *r5
+m4
+m0
+; comment
+add #162, L2
+sub *r3, L0
+add #-126, *r3
+jsr L2
+bne *r6
+m3
+rts
+m2
+bne *r7
+m3
+red *r7
+L3: .data 465, -975, 702, -114, -189, -432
+L4: jmp L4
+L5: add L17, r6
+red *r7
+prn *r1
+
+m2
+m0
+inc r2
+clr L40
+m2
+L6: cmp r1, L37
+add L3, r4
+rts
+add *r4, r4
+; comment
+m4
+m4
+clr L92
+dec *r3
+; comment
+L7: jmp L61
+jmp *r0
+mov #121, L4
+L8: .data -358, -676, 861, 987, -42
+add #-61, *r4
+sub *r0, L92
+lea L20, L8
+bne L6
+m1
+L9: .data 375, 431
+; comment
+mov *r4, L46
+clr L16
+inc *r4
+add r5, *r0
+dec *r5
+L10: rts
+L11: jmp L7
+; comment
+L12: cmp L58, L61
+m1
+jsr *r1
+L13: sub *r5, *r2
+not r4
+jmp *r0
+jmp L13
+m2
+L14: clr *r7
+m3
+cmp #-12, r0
+red *r7
+m4
+dec *r3
+clr r4
+jsr L43
+; comment
+bne *r0
+stop
+m0
+mov r2, *r7
+m4
+m2
+sub L2, *r2
+not L11
+add r4, *r4
+red L5
+rts
+rts
+add #-84, *r3
+L15: jsr *r2
+dec r3
+lea L75, *r0
+red L103
+rts
+cmp L75, #-192
+m0
+stop
+L16: inc L13
+L17: jmp L15
+dec r2
+prn *r2
+clr r7
+prn L60
+rts
+sub #78, r7
+jsr *r7
+
+m2
+dec r5
+not r6
+L18: stop
+not r7
+m4
+dec L81
+m2
+cmp #10, L98
+rts
+jmp L80
+jsr L36
+stop
+L19: .data 12, 458, 847, 205
+m0
+lea L17, L61
+L20: .data -61, 483, 30
+m3
+L21: lea L92, *r0
+m0
+lea L42, L15
+L22: .data 265, 994, 567
+mov #124, r2
+bne *r6
+cmp *r0, #52
+m4
+rts
+cmp *r0, L4
+stop
+sub L45, *r2
+m2
+cmp r7, r5
+inc L8
+L23: jmp *r7
+
+bne L93
+bne *r7
+lea L70, L19
+red *r3
+red r1
+L24: .data -917, 405, 81, -647
+stop
+L25: .string "nvhmpgqwsxs"
+add *r0, L75
+lea L25, *r0
+mov *r4, r5
+sub *r1, L10
+m1
+stop
+m4
+L26: not r3
+L27: jsr *r0
+dec *r3
+cmp L78, L8
+L28: cmp #-248, *r2
+
+; comment
+stop
+cmp r6, *r6
+mov #-162, r3
+L29: bne *r1
+stop
+m3
+cmp #109, *r5
+cmp r1, #-32
+inc r5
+not *r1
+mov r2, L13
+L30: .string "edmpklnuzhuoqgpkizmqttdy"
+cmp #-186, #91
+L31: .string "uiizzbzkaaxkhxiszglyog"
+m3
+m0
+jsr *r3
+cmp *r0, *r7
+L32: .data 242, -177, 601
+clr L5
+m0
+m3
+L33: jsr *r2
+not L23
+red *r4
+L34: mov #-217, L17
+m3
+stop
+inc r7
+stop
+m0
+L35: .string "sbcutudrazcj"
+m2
+m4
+m3
+m0
+red *r4
+sub *r2, L81
+bne *r7
+L36: dec r6
+prn r7
+inc L72
+mov L50, *r5
+sub L29, *r1
+L37: bne *r7
+jmp L28
+stop
+sub r3, L18
+stop
+stop
+L38: cmp L16, #-80
+add r7, *r5
+dec r4
+L39: .string "qtxslyxrykny"
+L40: mov *r0, L55
+m0
+not r0
+jsr *r3
+L41: .string "xspmqgzrpkvlnnkrg"
+rts
+mov r2, *r2
+mov #25, *r5
+m1
+jsr *r7
+bne L9
+L42: .string "nuuatfxx"
+jmp L21
+L43: dec *r6
+red r4
+dec *r5
+m0
+L44: lea L103, r7
+L45: inc L23
+stop
+L46: stop
+mov #-171, L68
+clr *r7
+inc *r2
+sub r2, r6
+bne L85
+
+red *r2
+L47: dec *r1
+L48: clr L51
+L49: .data 746, -750, -85, -219, -537, 292, 879, 126
+; comment
+L50: red *r0
+prn #167
+prn L12
+cmp r3, *r4
+add L71, L62
+stop
+L51: rts
+jmp *r4
+m1
+lea L75, L33
+cmp L100, r3
+jsr *r2
+L52: red L84
+L53: .data -775, 20, 662, 781
+red *r0
+rts
+lea L95, L51
+jsr *r0
+m1
+prn L20
+m0
+L54: .string "omkexevvkek"
+L55: inc L94
+m4
+inc L91
+clr L0
+L56: prn *r4
+m2
+sub r0, L30
+add *r5, *r7
+add *r6, L89
+m1
+m1
+red *r2
+not *r6
+dec r4
+stop
+dec L67
+L57: rts
+sub L43, r6
+clr *r6
+inc r2
+L58: add #-194, r0
+L59: mov #-49, *r7
+L60: clr L26
+lea L53, *r3
+clr r5
+stop
+jmp L94
+clr r1
+stop
+inc L11
+m0
+L61: .data 16
+rts
+m4
+prn L28
+sub *r5, r7
+stop
+L62: stop
+bne L38
+mov L76, *r3
+m0
+L63: prn *r0
+m0
+stop
+jsr *r1
+jsr L21
+L64: .data -928, -619, -674, 182
+bne *r4
+L65: jmp *r0
+sub *r1, L56
+m0
+L66: .string "vblwsvcrswfht"
+L67: .data -424, 593, -15, 284, -261, 542, -99, 752
+L68: .string "ka"
+m4
+L69: prn *r1
+prn r0
+cmp L58, r4
+m1
+L70: .string "slazowendxtkietgnunigru"
+not L12
+L71: bne *r4
+L72: red r4
+prn L90
+
+add r3, L82
+m4
+L73: clr L48
+L74: lea L96, L95
+red *r2
+red *r1
+inc r2
+prn L87
+inc *r5
+L75: .string "nrkvesddygcnawpttwwl"
+L76: .string "vqujmpyfhidukmp"
+red *r5
+m3
+L77: .string "dgzvpcbtuyp"
+rts
+cmp #122, *r3
+not r7
+lea L45, *r3
+m4
+mov #-217, L77
+not *r3
+jsr *r0
+cmp r3, #188
+m0
+L78: .string "rwnhugunugmgoshfn"
+L79: jmp L95
+add #211, r4
+m4
+jsr *r1
+; comment
+clr L58
+cmp r4, *r2
+red L92
+m4
+sub *r2, r0
+red L54
+; comment
+; comment
+not r0
+m4
+add r6, L85
+cmp *r2, #-54
+sub r5, r5
+cmp L14, *r6
+m0
+not L63
+m2
+L80: cmp *r4, L41
+stop
+m4
+jsr *r6
+rts
+m0
+m4
+stop
+m4
+m0
+not L17
+cmp *r4, #234
+L81: .string "eekfp"
+
+m4
+stop
+lea L22, *r4
+dec r3
+m0
+; comment
+m1
+L82: red L48
+prn L30
+lea L12, r2
+L83: mov #-147, *r1
+m1
+
+m0
+L84: jsr L100
+rts
+L85: prn #78
+lea L28, *r3
+rts
+dec r3
+L86: cmp *r4, L92
+bne *r4
+L87: jmp L89
+rts
+
+m1
+clr *r0
+not r2
+m2
+prn *r5
+jmp *r2
+cmp L54, L90
+L88: clr *r5
+L89: inc *r6
+sub L85, r3
+not r4
+L90: clr *r5
+m2
+add r0, *r0
+prn L93
+stop
+L91: rts
+L92: red r0
+L93: .data -933, -980, -311, 730
+L94: .string "w"
+sub *r1, r6
+inc *r2
+jmp L22
+
+jmp *r6
+lea L102, L86
+bne *r0
+m1
+m2
+m4
+
+L95: jmp *r0
+mov r6, *r1
+L96: stop
+; comment
+sub #245, r1
+rts
+L97: .string "q"
+jmp L103
+cmp L98, L99
+mov *r3, *r6
+cmp L103, r6
+clr r4
+dec L103
+bne *r4
+clr L51
+clr r6
+L98: bne *r7
+L99: mov #25, r5
+L100: dec L77
+bne L3
+lea L101, r1
+m3
+not L103
+m1
+L101: lea L59, r4
+stop
+not L102
+prn #-224
+m0
+stop
+L102: cmp L54, r5
+bne *r5
+cmp L103, L103
+cmp #221, *r0
+L103: sub *r7, *r0
+prn *r4
+m2
+lea L25, r5
+m1
+lea L1, *r2
+inc *r5
+inc *r1
+m4
+m2
+m2
+dec r6
+stop
@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 13
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    dec *r6
+    clr *r0
+    jmp L98
+    inc r2
+    jmp L94
+    jmp L55
+    inc *r7
+    jsr L113
+    red L44
+    add r2, *r5
+endmacr
+macr m1
+    rts
+    rts
+    inc L5
+    jmp L48
+    jmp *r7
+    jsr *r0
+    mov r1, r3
+    clr *r3
+    sub r0, r2
+    cmp L92, *r3
+endmacr
+macr m2
+    dec L60
+    cmp r2, #-220
+    rts
+    dec r5
+    not *r1
+    inc *r5
+    stop
+    bne *r5
+    cmp L24, L67
+    rts
+endmacr
+macr m3
+    stop
+    prn *r1
+    not *r4
+    rts
+    not r3
+    red r6
+    bne *r0
+    cmp *r2, r4
+    prn r7
+    cmp L38, L65
+endmacr
+macr m4
+    cmp L4, *r3
+    red L26
+    jmp *r3
+    red L17
+    jsr L105
+    rts
+    lea L66, L20
+    prn L92
+    add #-213, L12
+    sub *r2, L31
+endmacr
+dec L65
+m2
+rts
+red *r0
+jsr *r3
+m3
+dec *r4
+L0: inc L0
+L1: .string "ebpcjhuhoxtuiytem"
+bne *r5
+L2: .data -968, -829, 312, -738, 291, -947, -385
+bne *r6
+rts
+jmp *r1
+jsr *r7
+not L0
+red *r0
+prn L19
+sub #-209, r3
+mov r3, L1
+clr r1
+mov #-190, r2
+m4
+lea L2, L1
+
+L3: .string "ueuhcqjd"
+not L37
+mov *r6, *r2
+bne *r0
+stop
+cmp #-67, #185
+jsr L3
+red r0
+red *r4
+rts
+inc L2
+stop
+L4: not r3
+; comment
+L5: .string "tdaegaqrhanvdoac"
+; comment
+m2
+bne *r5
+dec *r2
+m3
+cmp #-29, r1
+add #50, *r1
+mov #239, *r0
+; comment
+inc r6
+not r3
+L6: .data -317, -111, -241, 428, -758, -632, -7
+red L0
+L7: cmp L46, *r1
+
+stop
+L8: prn #112
+L9: jmp *r5
+not L74
+L10: jsr L58
+L11: .string "yqqfziritzuakk"
+lea L15, L92
+cmp *r1, *r0
+rts
+m3
+L12: .data 709, -261, -828, 219, -528, -599, -921, -925
+cmp *r5, L0
+stop
+L13: bne L76
+red *r2
+mov r3, L12
+m4
+; comment
+L14: mov r7, L73
+L15: .string "goepfvvfipxs"
+; comment
+dec *r7
+L16: cmp r7, #-74
+not *r3
+L17: .data -153, 371, 848, -977, -126, 929
+inc L108
+cmp #-243, L3
+add *r4, *r2
+add *r6, r2
+add L17, L88
+inc r1
+mov L90, r3
+cmp L8, #156
+cmp *r6, r2
+sub #251, r0
+L18: .string "gxhhcvyrzxhiqkkqmvzjdi"
+red r0
+prn r0
+inc *r2
+L19: sub L53, L0
+red r3
+m3
+L20: clr r0
+clr L77
+cmp #205, r5
+stop
+m2
+cmp L5, L10
+clr r4
+clr r5
+red r6
+jmp *r1
+m1
+m1
+mov *r0, r3
+
+L21: .string "doxyuqcwwrdmzmxrqcybbzkd"
+not *r7
+not r3
+L22: add *r7, r1
+m4
+m4
+m2
+m2
+bne L17
+prn #119
+inc L21
+L23: .data 282, 575, -937, 629
+lea L20, *r5
+mov *r5, *r5
+prn L15
+m2
+m0
+red *r4
+L24: dec L66
+; comment
+inc *r4
+prn L5
+cmp r1, L23
+prn r6
+L25: bne *r2
+jsr L85
+L26: prn *r3
+m4
+rts
+prn r4
+L27: inc r7
+L28: mov *r0, L17
+cmp L111, *r1
+stop
+rts
+jmp *r4
+L29: add #-193, r1
+bne L40
+jmp *r4
+L30: .data 799, 282
+L31: .string "jxqzzhhudzwcfgrqpnb"
+L32: add *r3, L6
+jsr *r3
+red L110
+m3
+m1
+bne *r7
+m2
+not r0
+L33: .data -845, 883, -162, -383, 678, 540, -931, 932
+cmp L99, *r5
+clr r3
+prn #97
+clr r0
+L34: .data 771, -945, 955, -196, -250, 765, -435
+not *r6
+m3
+m4
+not r4
+L35: clr *r1
+L36: dec *r0
+m4
+stop
+m2
+not *r4
+inc r3
+L37: mov r4, L30
+dec L2
+; comment
+stop
+L38: .string "fkwuoothrup"
+m0
+L39: stop
+sub r3, r0
+m4
+dec r6
+L40: mov *r5, L94
+dec L63
+L41: add *r3, L87
+m4
+m3
+L42: .data -785, 792, -560, -36
+m3
+m2
+m1
+clr r2
+not *r7
+bne L15
+L43: .string "ophkgod"
+cmp #48, *r6
+jsr *r3
+m0
+rts
+L44: .string "eugd"
+L45: .string "qqvcbqdsbe"
+L46: .string "jhtkhwaivcoyl"
+jsr L80
+L47: sub #-110, *r0
+m3
+m1
+mov *r6, L93
+jsr L5
+m3
+dec *r2
+L48: .data -404, 48
+L49: .data -579, 546, -414, -718, -50, 79, 671, 60
+jmp *r0
+L50: jsr L107
+bne L110
+jmp *r5
+lea L14, L2
+L51: bne *r1
+mov r1, *r3
+L52: .data 563, 627
+inc *r2
+cmp r1, #205
+
+jmp L70
+sub #-235, L26
+L53: mov #223, r0
+stop
+
+L54: bne *r0
+clr *r7
+add *r6, r3
+dec r7
+stop
+jsr *r6
+add #-56, *r3
+L55: sub L60, r4
+rts
+m4
+L56: mov *r5, *r6
+m2
+not L21
+m2
+m4
+m3
+lea L53, *r1
+m4
+jmp L77
+rts
+prn r7
+stop
+inc r1
+m2
+m0
+L57: .data -693, -261, 853
+inc *r1
+L58: bne *r3
+; comment
+L59: .data 436, -765, -834, 189, -337, -808, -618, -863
+m0
+mov #199, r2
+dec *r2
+L60: dec L73
+rts
+stop
+L61: .data -605
+m3
+m2
+add r5, L38
+L62: mov *r5, r2
+L63: .string "irtdhkgwis"
+m4
+inc *r4
+dec r6
+m0
+m4
+not *r2
+L64: lea L0, L59
+L65: .data 469, 408, 82, 894
+L66: bne L11
+rts
+add *r4, *r6
+rts
+L67: rts
+add r3, L99
+L68: jmp *r6
+; comment
+L69: .data -27, -312, 212, 162
+add *r3, *r4
+m4
+mov *r7, L85
+not r5
+L70: sub *r5, *r2
+clr L46
+jmp L14
+clr r0
+jmp L89
+stop
+m1
+m3
+m3
+jsr L27
+L71: .data -223, 805, 327, 263
+bne *r5
+cmp L104, *r1
+clr *r4
+jmp *r0
+red L92
+inc L101
+L72: .data 368, 269
+L73: stop
+stop
+prn #-79
+L74: .data -86, -527
+L75: .data -269
+sub *r1, *r5
+m0
+L76: .string "apuh"
+L77: dec *r6
+not r4
+prn *r0
+add *r5, r7
+bne L105
+lea L82, L62
+
+m2
+
+not *r7
+mov L96, L98
+red *r5
+m2
+stop
+red *r3
+prn *r1
+L78: inc L11
+m1
+red *r6
+lea L90, *r2
+dec L58
+red L43
+bne L15
+sub r0, L110
+not L92
+L79: lea L90, L97
+red r4
+bne L77
+sub *r0, r6
+jmp L111
+lea L109, *r7
+stop
+m2
+
+add #63, r4
+bne L92
+L80: clr L66
+add *r3, L41
+L81: prn *r0
+add r5, L30
+L82: mov r3, L4
+m0
+add L6, L38
+stop
+m3
+m2
+jsr L103
+red *r2
+stop
+L83: add L30, L92
+add r4, r4
+mov #-87, *r3
+L84: bne L9
+clr r4
+bne L75
+inc r2
+stop
+m4
+not *r3
+; comment
+stop
+lea L48, L98
+L85: .string "upjahjxqvcnjhxewcgm"
+L86: .data 53, -534, 374, 277, -610, -340, -790, -151
+m3
+L87: inc r1
+m4
+stop
+lea L37, *r1
+add r4, *r7
+m0
+clr r4
+m0
+jmp *r6
+add #244, *r0
+L88: .data 718, -869, -466, -994, 657, 613, -796, 436
+jmp *r4
+dec *r0
+cmp #83, r0
+red L104
+mov r1, L102
+L89: .string "gxuvuodf"
+L90: clr *r4
+jmp *r3
+L91: inc *r5
+red *r2
+
+L92: rts
+m4
+L93: .string "exapshzuvme"
+L94: .data -486, 419, -928, 432, 842, -131, -381, -515
+add r7, L43
+bne L13
+m2
+m4
+L95: .string "loamnq"
+bne L107
+L96: jsr L30
+L97: add #215, *r4
+L98: .string "dnkydwzuttssk"
+prn #106
+add r2, r6
+m2
+m3
+m4
+m1
+L99: sub r6, r2
+m0
+L100: .string "kj"
+dec *r1
+cmp *r2, L30
+rts
+jmp *r0
+add #-188, r7
+prn *r2
+add r7, L51
+sub L110, L55
+sub *r1, r3
+m0
+lea L68, r6
+L101: .data 660, 646
+bne *r2
+inc r3
+L102: red L26
+red r7
+jmp L104
+prn L90
+lea L72, L43
+L103: mov L106, *r3
+m2
+dec r0
+inc L63
+sub L106, r5
+cmp #-29, r0
+sub r2, r3
+L104: inc r4
+dec r7
+
+L105: sub L112, L111
+m4
+L106: jsr L108
+prn r1
+m4
+L107: .string "wuzoyfzaz"
+L108: bne L111
+dec r6
+m2
+inc *r5
+m4
+L109: .string "hccdsmgrgpdpgph"
+red *r3
+inc L72
+red L112
+; comment
+
+m3
+L110: jmp L86
+inc L4
+sub #-236, r5
+m1
+; comment
+dec *r1
+; comment
+m4
+rts
+
+prn *r4
+m0
+lea L112, *r7
+lea L13, *r7
+not r3
+stop
+L111: jmp *r7
+L112: dec L37
+m2
+prn *r6
+jmp *r1
+L113: prn L65
+stop
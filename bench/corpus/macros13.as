@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 14
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    stop
+    stop
+    rts
+    prn L35
+    rts
+    not *r7
+    inc L78
+    dec *r4
+    clr L94
+    stop
+endmacr
+macr m1
+    jsr L72
+    clr *r3
+    mov r6, *r7
+    prn #-57
+    stop
+    jsr L61
+    rts
+    lea L56, L37
+    add L13, r3
+    add *r6, *r2
+endmacr
+macr m2
+    add #214, r5
+    cmp #-144, *r7
+    not r2
+    add *r5, *r6
+    jmp *r6
+    mov L29, r0
+    mov *r6, r4
+    rts
+    clr *r0
+    add #131, L79
+endmacr
+macr m3
+    stop
+    stop
+    inc *r1
+    lea L42, *r2
+    not L60
+    clr r6
+    red *r2
+    inc L56
+    rts
+    sub *r2, *r5
+endmacr
+macr m4
+    inc *r5
+    red r5
+    prn L47
+    rts
+    jsr *r4
+    not r5
+    mov #-112, L83
+    stop
+    clr r2
+    stop
+endmacr
+L0: .string "qwuqsdlxrxwdkpthbnirfqja"
+L1: .data 763, 796, 739, 99
+L2: .data 711, 420, -625, 383, 43, 605, -544, 414
+bne *r0
+mov r6, r6
+clr r7
+prn r4
+m1
+m1
+lea L2, *r1
+red r0
+m1
+lea L2, r6
+stop
+m2
+L3: .string "nbdiluzlylavjagoay"
+jmp *r0
+cmp #-61, L82
+prn L1
+L4: inc *r1
+jsr L0
+dec L2
+L5: .string "smhotvypebbartpgvgadeg"
+rts
+m2
+bne L34
+red *r6
+not L95
+dec L61
+mov r1, r7
+cmp r3, r1
+m0
+m3
+m2
+prn *r6
+sub *r3, L5
+L6: bne *r4
+add *r3, r1
+jmp L85
+m0
+lea L35, L74
+L7: not *r0
+not *r1
+stop
+m2
+lea L0, r5
+m2
+jsr L3
+m1
+stop
+m1
+lea L85, L7
+inc L27
+L8: .data 541, 848, -420, -95, -746, 25, -999
+m3
+L9: jmp L8
+m4
+lea L102, r1
+L10: cmp L62, *r4
+m0
+m4
+m4
+L11: jsr L2
+inc L82
+rts
+inc L2
+L12: .data 716, -215, 647, -640, -955, 629, -585
+L13: .string "ridgg"
+L14: .data -566, 462, -697
+L15: prn L8
+not L55
+mov r1, *r5
+L16: .data 58, 404, 779, -462, -990, -199, -249
+L17: red r5
+m2
+jmp *r6
+mov #222, r0
+dec *r0
+stop
+L18: jmp *r1
+inc L5
+clr r2
+L19: mov r7, L1
+stop
+jmp *r7
+
+m1
+red *r6
+add #-74, r6
+mov *r1, *r5
+L20: .string "a"
+red *r6
+L21: .data 105, -417, -941, 121, 859, 723, 776, -153
+L22: .string "fdoginfib"
+stop
+dec L96
+stop
+m3
+L23: bne L39
+clr r1
+L24: .string "doerrtqqksajzvdkdfcrx"
+; comment
+L25: .string "fifcfxmxvwlrgvbwrbmyxpzb"
+mov r3, L52
+L26: .string "nar"
+m3
+m1
+m1
+sub #-194, r0
+sub L0, r6
+bne L30
+cmp r0, L18
+mov #-214, L30
+bne *r4
+L27: prn *r6
+cmp L8, r4
+red *r4
+lea L14, L56
+dec L30
+m1
+L28: red L13
+jmp L61
+jmp L96
+dec L101
+L29: .string "dqha"
+cmp L55, L47
+clr *r7
+not *r5
+inc r4
+m2
+L30: clr *r1
+jmp L20
+L31: clr r7
+m0
+m2
+L32: mov #170, L13
+m2
+red *r6
+L33: not r0
+L34: mov *r5, *r2
+cmp L28, L74
+m2
+m3
+L35: cmp L68, *r2
+prn L27
+lea L1, r4
+m1
+L36: not L88
+prn r4
+lea L36, *r7
+inc *r2
+cmp r6, r1
+m0
+lea L99, *r5
+L37: lea L57, L73
+m2
+rts
+bne *r1
+L38: .string "cqtljvlhzxf"
+m3
+m4
+
+L39: sub L14, L13
+
+L40: stop
+dec *r0
+m4
+m1
+stop
+jsr *r6
+L41: .data -746, -88, 424, 506, -948, -971, 748
+L42: .string "utxcuuvliipzu"
+bne *r3
+m4
+jsr L27
+m1
+m4
+m0
+m0
+jmp *r6
+cmp L105, #254
+lea L6, r2
+red L49
+m1
+m1
+L43: .string "wr"
+mov r5, r2
+not *r0
+cmp r0, L86
+L44: red *r4
+m0
+L45: bne *r5
+jsr L16
+L46: inc r2
+L47: add *r4, r4
+L48: .data -347, -946, 708, -825, 862, -711, -237
+dec r7
+L49: .data 324, -777, -426, 259, -753, 731
+sub #-185, L89
+m1
+rts
+; comment
+rts
+lea L62, *r0
+jsr *r0
+; comment
+jsr *r1
+mov r5, L42
+
+rts
+L50: .data -427, -630, -149, -419, 213, 867
+jsr L50
+cmp *r0, *r6
+m1
+
+jsr *r3
+cmp L8, #-89
+not r6
+bne *r5
+L51: .data 65
+prn L14
+m1
+add #-129, *r3
+lea L27, r7
+prn *r5
+mov *r2, r3
+L52: .string "ynkggzdion"
+m0
+m4
+add L94, *r5
+stop
+add *r6, L83
+
+L53: dec L26
+L54: .string "hubpw"
+clr r1
+lea L48, *r0
+; comment
+lea L72, r0
+L55: .data 337, 466, -354, -629, 232
+
+jsr *r1
+L56: prn *r3
+jsr *r6
+red *r1
+L57: .data -242
+m0
+m4
+m2
+cmp #20, *r0
+L58: clr *r3
+dec L97
+; comment
+rts
+stop
+L59: .data 266, 619, 838, -464, 343
+cmp *r0, #135
+inc *r0
+m2
+cmp *r2, r7
+not L54
+m1
+jmp *r5
+L60: .data -287, 923, -798, -40, 949
+L61: .string "muvsfuyjvjhrnoobtw"
+add #7, r6
+m3
+dec r6
+L62: add r5, r6
+rts
+; comment
+clr *r6
+stop
+m0
+
+not *r2
+L63: mov r0, r5
+not L40
+L64: cmp *r1, *r3
+lea L13, r4
+not *r2
+m3
+bne *r2
+L65: prn #-131
+jsr L60
+jsr *r0
+not *r2
+inc r4
+; comment
+L66: .string "po"
+jmp *r6
+red L37
+mov #-99, *r6
+dec L100
+L67: .data -287, 400
+L68: .data -993, -812, -799
+m4
+lea L19, *r0
+lea L17, L48
+L69: lea L46, r6
+clr L12
+rts
+prn *r2
+inc *r6
+L70: .string "dczklhshqklapcqbvstto"
+inc *r0
+
+m4
+jsr L43
+stop
+not r1
+mov *r0, *r7
+L71: bne L72
+mov r7, r0
+L72: .data 551, -938
+L73: mov L11, r5
+jsr *r1
+m1
+not *r2
+L74: .data 774, -448
+m0
+clr *r2
+jsr *r3
+m2
+L75: jsr L27
+m4
+sub *r1, r3
+L76: .data 15, -770
+add r3, *r3
+inc L12
+bne *r6
+red r3
+m1
+dec r1
+L77: inc *r0
+m4
+m3
+m0
+L78: rts
+jsr *r2
+clr L57
+cmp r0, #-202
+not r5
+L79: sub L99, r1
+L80: .string "vdwlqnsksd"
+rts
+red r1
+m2
+inc L102
+bne *r1
+clr r4
+inc *r4
+lea L5, *r7
+L81: .data -553, 336, -318, 132, 106, 967, -606
+sub #-210, *r0
+cmp #34, L79
+m2
+jsr *r1
+L82: dec r6
+dec r5
+inc L93
+L83: .data -732, 267, -405
+m3
+L84: dec r7
+mov L82, r6
+not L43
+m1
+not L95
+rts
+dec *r1
+clr L91
+m2
+prn L21
+mov L26, *r1
+clr r1
+inc *r0
+m4
+cmp L31, #19
+jsr *r5
+L85: .data -28, -574, -42, -74, -151, -125, -156, 68
+m1
+lea L91, r6
+sub *r5, L58
+lea L62, L87
+not *r7
+add #-184, L89
+m3
+m4
+inc r1
+cmp *r7, r2
+jmp L66
+clr r5
+dec *r7
+m3
+cmp L87, *r1
+bne *r1
+rts
+jmp L87
+; comment
+lea L67, L81
+m0
+lea L16, L1
+m1
+inc r1
+add L93, L96
+cmp *r1, #67
+sub r0, *r0
+m3
+m2
+mov #12, r6
+inc *r7
+
+m0
+sub *r3, r4
+L86: bne L87
+cmp *r4, *r0
+L87: cmp L95, L92
+m1
+m2
+L88: .data 563, 548, 348, 144, -601
+red r3
+inc *r3
+jmp *r3
+L89: inc *r0
+inc L95
+L90: .data -875, -159, -464, -86, 0, 266, 638
+mov #-82, L99
+m3
+prn r7
+add L78, *r7
+stop
+prn r1
+inc r5
+not r6
+
+clr L99
+bne *r7
+; comment
+dec *r3
+not L102
+m3
+L91: .data 429, 670, -119
+L92: jsr L58
+L93: .string "iio"
+m0
+inc *r4
+sub #71, L105
+sub #-134, *r1
+L94: mov *r4, r2
+L95: red r5
+clr r0
+
+clr *r6
+L96: inc r7
+m2
+L97: dec L98
+lea L60, L77
+jsr L35
+rts
+mov #-73, r5
+L98: .data -409, 415, 880, 12, 24
+L99: red L43
+sub L105, L76
+L100: jsr *r7
+dec L105
+L101: bne L102
+not r5
+L102: .data 478, 161, 39, 626, 996, -369, -451, 327
+
+add L65, *r5
+L103: jsr *r7
+stop
+m1
+m0
+jsr *r5
+red *r5
+m4
+m0
+rts
+not L105
+inc r2
+m2
+m1
+dec *r7
+m4
+m2
+red r7
+lea L17, L105
+rts
+m4
+dec L105
+bne *r0
+jmp L104
+rts
+jmp *r7
+mov L26, *r5
+L104: not *r0
+m2
+L105: .data 388, 581, -84, -530, -704, 153, -802
+m2
+stop
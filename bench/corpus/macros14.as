@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 15
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    rts
+    clr *r7
+    not r6
+    jsr *r5
+    rts
+    lea L26, L113
+    mov *r2, r0
+    jsr L21
+    jmp L28
+    lea L119, r3
+endmacr
+macr m1
+    dec L91
+    red L14
+    lea L93, *r7
+    clr *r6
+    sub *r0, r7
+    clr L79
+    dec L77
+    stop
+    jsr *r0
+    add r2, L97
+endmacr
+macr m2
+    inc r5
+    add L91, r5
+    prn r0
+    cmp r6, #-86
+    red L117
+    inc L107
+    lea L64, L83
+    jsr *r2
+    add #-69, L48
+    cmp L11, *r3
+endmacr
+macr m3
+    rts
+    red L3
+    jmp *r1
+    red L102
+    add L80, r7
+    mov r1, *r5
+    prn L82
+    lea L77, L96
+    jmp *r6
+    not r0
+endmacr
+macr m4
+    bne *r5
+    rts
+    prn r7
+    sub *r4, L47
+    clr L15
+    bne L116
+    red L74
+    dec L72
+    add r4, L19
+    dec *r3
+endmacr
+L0: not L0
+lea L0, L45
+L1: .data 61
+clr *r6
+sub #87, r6
+cmp L0, L110
+add r1, r2
+m1
+stop
+m1
+m0
+L2: .data 491
+jsr *r0
+m2
+m1
+inc *r4
+red L53
+m1
+L3: .data -329, 828, 594, -641, 215, 523
+stop
+cmp r7, L65
+sub r2, r6
+m1
+L4: rts
+dec *r1
+jmp *r3
+L5: .data 136, -362, 401, -770, -115
+jmp L60
+stop
+not *r7
+prn L1
+
+clr L58
+L6: not L103
+m1
+rts
+inc r2
+lea L2, *r7
+add *r6, *r4
+inc r3
+add *r5, *r7
+inc r7
+L7: .string "gxzvo"
+
+m3
+jmp *r5
+dec L3
+L8: .data 416
+L9: rts
+m1
+not L89
+mov L6, r3
+
+red r3
+prn L2
+m4
+L10: lea L9, *r6
+cmp L48, #226
+L11: .data -185, 208, 575, -179, -379
+m0
+prn L9
+m0
+dec *r4
+not *r3
+L12: not *r4
+m0
+L13: dec L3
+add L4, L10
+m2
+
+bne *r0
+bne *r6
+L14: jmp *r3
+L15: bne L19
+L16: prn #-122
+
+sub L3, r6
+m2
+m0
+rts
+bne L112
+m2
+m4
+L17: prn #44
+L18: mov *r1, *r6
+L19: .data 89, -668, 448, 14, -275
+m4
+cmp r6, r0
+mov #57, L100
+red r2
+mov r2, L12
+jsr L31
+m1
+stop
+L20: .string "rionhazxidyhotitzcjmkd"
+L21: rts
+sub #-166, L12
+L22: .string "mmdyhpprt"
+L23: jmp L107
+; comment
+add *r4, *r4
+inc L60
+L24: .string "lqfq"
+red r5
+sub r2, L16
+jmp L27
+m4
+bne L17
+L25: red L25
+L26: .string "oqkezezkoopthohxqh"
+clr *r1
+not *r5
+jsr L93
+rts
+
+m3
+L27: jmp L61
+red r3
+bne L27
+m0
+m4
+cmp *r1, #7
+m1
+bne *r2
+clr r1
+add L19, r7
+jsr L12
+L28: .data -830, -693, 888, -348
+prn #213
+L29: .data 124, -182, 274, 507
+L30: cmp #-144, r7
+clr L1
+m4
+prn r7
+lea L16, r3
+L31: add #-184, *r4
+red L56
+jsr *r7
+lea L41, *r7
+sub r4, *r3
+bne *r4
+not *r0
+m0
+jsr L96
+L32: stop
+m4
+m4
+clr *r5
+m2
+sub L8, r1
+inc r1
+prn *r1
+m3
+
+L33: inc L8
+stop
+cmp r5, #-188
+clr *r6
+L34: dec L13
+m1
+; comment
+inc r0
+red *r1
+add L1, L76
+cmp r6, L49
+m3
+bne *r2
+lea L88, L10
+inc r1
+mov #-109, *r7
+dec *r0
+L35: stop
+lea L28, *r4
+mov *r6, r7
+clr *r1
+m4
+m1
+jsr L111
+L36: .string "fizswoormezxbhus"
+cmp L85, r7
+jsr L63
+m4
+L37: .data -665, 632, 752, -791, 755
+m2
+dec *r3
+L38: .string "drslehgwe"
+L39: red L32
+rts
+bne L112
+L40: mov *r0, r2
+L41: .data -626, -553, -626, 650, 213, 799, -146
+add r4, *r6
+jsr L95
+jmp L64
+rts
+m1
+add L41, L16
+m3
+mov *r2, r1
+; comment
+cmp #187, L32
+inc *r0
+; comment
+rts
+cmp *r6, *r6
+red *r5
+L42: stop
+L43: prn *r5
+bne *r5
+sub r4, L29
+m4
+m0
+bne *r1
+L44: bne *r4
+prn #-182
+m4
+L45: .data 842, -808, 937
+L46: sub r0, r7
+L47: .string "uhumcpm"
+L48: .string "ccelimqcgvof"
+L49: mov #-166, *r7
+L50: .string "ljbimfmdawydlviqadtaq"
+dec L48
+sub *r5, *r5
+L51: prn *r3
+cmp #-231, L79
+prn *r2
+clr r6
+clr *r0
+cmp L16, *r7
+L52: dec *r7
+clr r0
+bne L4
+L53: stop
+clr L45
+prn r0
+m0
+lea L83, L32
+L54: .data 273, -802, -205, -952, 371
+not r4
+m1
+mov #-187, r3
+L55: .string "oicsqkybzujlbvwmxwp"
+m0
+m2
+m3
+jsr *r6
+rts
+rts
+jmp L82
+prn #46
+L56: .data -316, -661
+m0
+m1
+inc L4
+stop
+; comment
+red L93
+L57: not *r4
+add L90, L5
+stop
+L58: .data -529, 387, 772
+add r1, r6
+lea L10, *r0
+bne L57
+mov *r3, *r3
+L59: .data -747, -135, 257, 435, -44, -915, -570
+m1
+L60: red L37
+; comment
+L61: prn r1
+stop
+L62: lea L61, L64
+L63: stop
+dec *r3
+L64: .string "tbvipcfusinmfozlihpcfjjv"
+L65: inc L18
+mov L117, L4
+not r0
+bne L108
+L66: rts
+L67: .string "hawcfyadkeajekirag"
+m3
+dec *r5
+dec L85
+stop
+m1
+lea L45, L101
+stop
+cmp L61, L25
+m0
+stop
+m4
+L68: .string "xar"
+sub #-178, L94
+L69: bne L99
+L70: .data -376, 397, 581, -655, 449, -532, 199
+red r6
+L71: .string "uwptlqoybtx"
+cmp #229, *r6
+prn *r7
+L72: mov r2, *r1
+m1
+stop
+mov L83, *r0
+cmp #-242, *r5
+L73: .data 163
+jsr L118
+not L71
+lea L34, r1
+L74: .string "hqdwqrcbxky"
+mov #238, r6
+sub *r4, r7
+mov r7, *r6
+L75: .string "pryywjnbrhf"
+m2
+L76: clr *r0
+L77: dec r5
+not r7
+L78: .data -591, -643, 837, -516, -882, -125, 447
+mov #7, r6
+m2
+lea L9, L77
+clr r4
+jmp L35
+m4
+L79: .string "d"
+stop
+inc r3
+not L113
+m3
+sub L81, L95
+dec *r7
+L80: rts
+bne *r4
+m2
+m1
+jmp L108
+L81: not L114
+prn r5
+rts
+m2
+cmp *r5, *r6
+stop
+red L46
+m2
+add *r5, *r4
+L82: jsr L58
+red *r0
+clr *r3
+prn L109
+L83: .data -263, -753, 207, 171, -646, 981, -3
+m1
+bne *r7
+m4
+m2
+
+prn *r1
+bne *r1
+L84: cmp #234, *r6
+dec r1
+cmp *r4, r6
+m2
+; comment
+bne *r0
+stop
+m0
+lea L54, r1
+lea L96, L74
+m0
+L85: bne L101
+dec L117
+jmp *r4
+L86: mov r2, r1
+sub #129, L17
+L87: .string "ufranejgkhywhpyjab"
+L88: prn L86
+lea L95, r4
+jsr *r5
+rts
+L89: red L99
+stop
+lea L81, *r3
+not r0
+dec r6
+add L100, L113
+mov *r2, r4
+clr r7
+prn r4
+lea L3, r4
+L90: bne *r4
+dec r0
+clr L39
+red *r0
+lea L100, r6
+sub *r5, *r4
+prn *r0
+stop
+m1
+m3
+m1
+inc r4
+red r2
+lea L99, r2
+inc *r0
+jsr L59
+inc *r7
+m4
+clr *r1
+mov #-234, *r3
+L91: jmp *r6
+jmp L116
+L92: inc r4
+jmp L106
+red r1
+L93: jmp L40
+jsr L95
+L94: jmp *r5
+L95: not *r1
+L96: .string "gibxhqxmxjta"
+m4
+L97: red L11
+stop
+L98: inc *r2
+L99: cmp #-3, r0
+mov *r4, r6
+L100: .string "bmkhzoovetip"
+L101: rts
+dec L106
+not r1
+prn L106
+m1
+m4
+rts
+L102: not L104
+L103: clr *r3
+m3
+lea L18, *r0
+red *r7
+lea L114, L108
+sub *r7, L45
+L104: lea L0, r3
+m1
+clr *r7
+red r1
+; comment
+mov *r1, L26
+L105: cmp r4, *r1
+dec *r7
+sub L81, L118
+cmp *r7, r5
+jmp L108
+L106: .string "quilm"
+clr r6
+not r3
+stop
+dec r0
+L107: .data -413, 993, -146, 647, 560, -828
+dec L50
+jmp *r0
+inc *r4
+sub *r2, *r2
+L108: not r0
+jmp *r3
+cmp L113, #-167
+rts
+rts
+L109: prn r2
+m3
+L110: .data -260, 901, 483, -361, -883
+L111: .data -619, -849, 67, -1
+prn *r1
+dec r1
+red r4
+inc *r6
+m4
+clr *r4
+clr L116
+bne *r2
+mov #26, L57
+m1
+L112: .data 864, 577, -707, -814
+jsr L114
+L113: not L119
+L114: add *r1, L119
+m2
+L115: .data 817, 372, -969
+L116: jsr *r2
+; comment
+inc L117
+jsr L117
+L117: .string "vy"
+inc r5
+m3
+red *r5
+L118: not r4
+red L69
+m1
+L119: rts
+cmp r0, L48
+stop
@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 16
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    dec L40
+    not r4
+    cmp #227, #-21
+    jmp L59
+    lea L54, L49
+    mov #43, L73
+    bne *r3
+    rts
+    clr r1
+    rts
+endmacr
+macr m1
+    inc L55
+    clr L30
+    mov *r5, r4
+    inc L28
+    clr *r1
+    cmp *r4, *r6
+    stop
+    clr r2
+    not r6
+    sub L58, L21
+endmacr
+macr m2
+    jsr L9
+    add #-73, *r6
+    red L3
+    inc r1
+    clr *r2
+    mov *r5, r3
+    lea L38, *r7
+    bne L4
+    jmp *r7
+    stop
+endmacr
+macr m3
+    red r4
+    stop
+    mov *r0, L25
+    bne L34
+    stop
+    jsr *r1
+    dec *r4
+    bne *r6
+    jsr L79
+    not L21
+endmacr
+macr m4
+    mov r1, L30
+    bne L13
+    lea L28, *r3
+    stop
+    jmp *r5
+    stop
+    dec r2
+    mov *r4, L62
+    cmp #-69, #28
+    clr r0
+endmacr
+m3
+red *r7
+bne L60
+L0: inc *r2
+L1: jsr L18
+jmp *r2
+stop
+not r5
+L2: inc *r2
+L3: bne *r4
+m2
+bne *r2
+bne L40
+L4: .string "fpcsagcgnqhl"
+inc L16
+m2
+inc L2
+; comment
+dec L29
+m1
+dec L3
+clr L58
+prn r6
+stop
+lea L0, L13
+red r6
+mov #164, L3
+bne *r3
+m3
+L5: .string "bhvz"
+; comment
+L6: .string "pxcogppglmbgjlfd"
+bne L23
+m2
+L7: red r2
+lea L70, r3
+jsr *r1
+jmp *r5
+L8: jmp *r7
+L9: rts
+L10: .string "wetuhhhitjeckrxgueve"
+sub r1, L95
+m0
+clr *r5
+
+cmp #-78, #21
+cmp L24, *r4
+L11: jmp *r4
+sub r5, *r3
+not *r7
+cmp #-94, #-136
+L12: lea L10, *r6
+m4
+clr *r0
+stop
+m0
+m3
+
+L13: not L41
+m1
+sub L3, *r2
+add L13, r7
+L14: .data 651, 48, -343, -190, 646, 760, -265
+m1
+lea L10, r6
+L15: red *r2
+sub r5, L9
+m3
+m3
+not r2
+L16: .string "rrxjwakhtlpwjxjztsbmj"
+jsr *r2
+L17: .data -137, -422, -364, 554, 489, -218, -533
+sub #-99, L7
+m4
+mov r1, L13
+L18: .data 930, 955, 876, -749, 109, 901, -266, 701
+cmp #76, #117
+add L46, r5
+dec *r7
+inc r0
+m4
+prn #-133
+red L14
+L19: lea L75, *r2
+L20: clr L82
+add L106, *r1
+jsr *r0
+rts
+not r2
+sub r3, r0
+m1
+L21: .data -259, 579, 573, -972, 939, 87, -685
+jsr *r3
+clr r4
+jmp L7
+cmp L5, r3
+m2
+clr *r6
+L22: prn L82
+jmp L5
+L23: clr r6
+red r7
+inc L75
+stop
+jmp *r4
+bne *r7
+prn r0
+clr *r1
+m2
+L24: clr r0
+L25: cmp #217, L19
+rts
+add *r5, L23
+cmp #121, *r3
+jsr L16
+L26: rts
+m4
+L27: lea L49, L54
+prn r7
+m1
+prn #113
+m2
+cmp *r5, L17
+red L6
+prn L7
+sub r4, *r1
+
+not *r2
+L28: prn #230
+clr L13
+m0
+m0
+red L48
+L29: sub r5, L0
+lea L4, *r5
+clr L1
+clr *r2
+m0
+jsr L104
+clr r0
+L30: .data -285, 949
+clr L19
+cmp L86, r5
+bne L29
+jmp *r3
+m0
+L31: sub *r0, r5
+; comment
+m0
+rts
+m1
+m3
+bne L101
+add *r7, r6
+cmp #252, r2
+L32: red *r1
+red *r4
+bne *r0
+stop
+lea L91, r3
+L33: clr r0
+red r2
+prn #-179
+clr L97
+red *r3
+jmp L3
+inc L24
+add *r5, *r6
+L34: .data -77, -662, 600, 675, -238, -932, -908
+L35: bne L25
+m4
+mov L48, r4
+m1
+stop
+bne *r0
+lea L50, r3
+jsr *r7
+L36: inc L94
+cmp #-225, #201
+dec L56
+prn r1
+add *r3, L34
+L37: inc L56
+
+mov *r4, L11
+rts
+sub r4, L30
+L38: lea L21, r7
+lea L1, L105
+mov *r4, *r0
+m3
+L39: not L10
+stop
+L40: rts
+jsr *r1
+jmp *r4
+cmp *r3, L69
+m4
+L41: .data -92
+not L68
+jmp *r5
+add L87, *r4
+jsr L95
+stop
+sub r3, *r6
+clr *r1
+inc *r2
+not r2
+clr L9
+prn *r1
+L42: clr r1
+stop
+; comment
+m4
+bne *r7
+L43: .data -713
+L44: jsr L74
+sub #-52, L27
+not r0
+mov L4, *r6
+m0
+m3
+m1
+jsr L81
+m4
+m2
+L45: .data -277, 641, -913
+mov L96, r5
+dec L9
+L46: .string "iyspybpbsnabmnodhpsgskc"
+L47: .data -50, 859, -416, -571
+jmp L109
+L48: stop
+m2
+L49: .string "wqkkgipzykj"
+m1
+m1
+L50: .string "humhiniy"
+L51: dec L32
+m2
+L52: jsr *r0
+jsr *r7
+bne *r3
+m1
+L53: sub L80, r7
+lea L22, r3
+m3
+not r3
+not L37
+red L1
+sub L25, L39
+m0
+; comment
+clr L102
+sub r2, r1
+m1
+sub L3, r6
+dec r4
+L54: jsr *r4
+m1
+L55: .string "wprzzcrva"
+red *r2
+rts
+jmp *r0
+inc *r7
+m4
+
+m2
+cmp *r5, #21
+inc r3
+m4
+L56: dec L51
+stop
+stop
+m2
+m0
+mov r2, L77
+cmp L34, *r0
+stop
+jsr L27
+clr L37
+L57: jsr *r1
+jsr L39
+L58: clr r4
+L59: clr *r1
+m3
+bne *r1
+rts
+L60: .string "gjuvrpqatnwifbwr"
+m1
+inc L25
+L61: red *r4
+cmp L14, *r4
+not L32
+L62: stop
+cmp #160, *r2
+rts
+L63: .string "vpojgq"
+L64: inc L78
+m2
+L65: mov *r4, *r7
+m3
+; comment
+stop
+cmp L93, #-253
+dec L76
+cmp r4, L109
+L66: add *r6, L72
+
+L67: .data 819, 758, 479
+m3
+lea L2, r7
+inc L32
+mov *r4, *r0
+L68: .data 269, 601, -241, 543, -325, -684, -788, 536
+m4
+add *r7, L19
+prn #47
+m4
+L69: .string "lxnnwypk"
+m0
+rts
+
+L70: cmp r0, r5
+rts
+inc *r3
+L71: .string "sarrblfg"
+L72: .string "ggackywwvcilhtkhnivasnr"
+L73: .data 693, 304, -353, 761, 539, 245, -48
+jsr *r6
+cmp *r4, *r3
+red L44
+L74: .string "mbqpevjv"
+jsr *r7
+mov *r5, r2
+L75: lea L99, r4
+L76: prn L103
+
+L77: clr r4
+L78: clr r6
+; comment
+
+rts
+m1
+inc L108
+prn #46
+; comment
+inc *r7
+prn r5
+L79: .string "txylmvtadkiyozp"
+prn L97
+; comment
+L80: .string "tfaaqmrbropnsebppfuc"
+L81: jmp L51
+rts
+L82: rts
+L83: .data -644, -105
+rts
+mov *r3, *r0
+L84: stop
+m4
+L85: .string "jsiyvqmdeqnmc"
+mov #88, L100
+
+L86: cmp L16, r3
+prn r0
+m2
+m0
+; comment
+add L69, r1
+L87: .data 608, 149, -352
+L88: .string "teamabotwusqyjeny"
+jsr *r1
+jmp L93
+m1
+add r4, *r1
+L89: inc L34
+mov #-114, *r3
+stop
+inc L108
+add r7, r3
+m4
+not L48
+m4
+prn #-48
+m1
+L90: bne L108
+L91: prn #-135
+mov #-124, L103
+stop
+not r2
+lea L103, L92
+m2
+mov #175, *r6
+jmp L53
+clr r0
+m1
+dec r6
+m1
+red L104
+m1
+m0
+bne L70
+jsr *r5
+dec L3
+clr L91
+clr r1
+mov #115, r7
+jsr L41
+L92: .string "whzbr"
+inc L106
+m2
+cmp *r0, *r5
+rts
+rts
+m0
+m4
+L93: jsr L14
+L94: add L107, r0
+red *r3
+not L41
+m2
+m4
+L95: red r6
+sub *r1, L97
+L96: .data -627, -261, -549, -366
+L97: .string "qqt"
+m3
+red *r1
+L98: lea L109, r4
+inc *r5
+L99: add *r5, *r2
+not *r6
+prn *r1
+L100: .string "ilejhebwytjhbnh"
+jmp *r0
+cmp #-216, *r0
+bne *r2
+inc L84
+L101: .data -703, 443, 172, 779, -749
+add #141, *r7
+cmp #-137, *r7
+m4
+prn *r6
+clr r6
+add L100, *r6
+m4
+m1
+cmp L8, L10
+L102: clr *r5
+jsr *r4
+L103: .string "pk"
+cmp r5, *r3
+not L104
+m1
+dec *r7
+m4
+jsr L104
+L104: add *r1, *r0
+rts
+not *r5
+m1
+add #-182, L105
+stop
+prn #255
+stop
+m4
+L105: .string "cukvoveqqcej"
+bne *r6
+
+add L107, L3
+m2
+bne *r6
+inc r5
+lea L4, L57
+m3
+L106: prn r6
+L107: .data 694
+mov *r4, L109
+inc *r3
+mov *r2, r3
+mov #40, L108
+L108: .string "wrfwrrfur"
+sub #-132, r2
+red r3
+not *r2
+cmp L109, L109
+dec L110
+lea L109, *r5
+; comment
+m0
+L109: .string "l"
+m4
+cmp r6, *r6
+L110: .data 644, 135, -66, -602, 449
+dec L5
+inc r5
+bne L33
+jmp L13
+stop
@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 17
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    stop
+    mov L106, *r0
+    red r3
+    stop
+    dec *r2
+    rts
+    prn r6
+    cmp L108, #-178
+    inc L73
+    jsr L14
+endmacr
+macr m1
+    jmp L32
+    red r2
+    red r4
+    clr *r7
+    cmp *r6, *r0
+    not *r5
+    clr r7
+    bne L53
+    jmp L88
+    prn r7
+endmacr
+macr m2
+    lea L51, *r4
+    prn L15
+    red L1
+    inc r0
+    dec *r1
+    add r2, r1
+    stop
+    stop
+    mov #145, *r6
+    lea L89, r5
+endmacr
+macr m3
+    stop
+    dec *r6
+    not L79
+    bne *r4
+    jmp L94
+    red L71
+    prn *r2
+    stop
+    mov r7, *r2
+    not r5
+endmacr
+macr m4
+    jsr L106
+    bne *r4
+    bne *r0
+    cmp *r0, #221
+    stop
+    add L21, L28
+    clr *r2
+    red *r6
+    rts
+    clr L32
+endmacr
+L0: .string "ettrlj"
+L1: lea L4, r2
+inc r5
+add #-112, *r7
+m4
+jsr *r5
+add r0, *r6
+L2: not L1
+L3: rts
+; comment
+mov #-178, L0
+jmp *r7
+inc L3
+jmp *r2
+not L0
+m1
+stop
+L4: dec *r0
+L5: inc r7
+cmp L63, L1
+L6: sub L6, *r7
+L7: .data -196, 573, 947
+rts
+L8: jmp *r5
+lea L105, L1
+L9: inc r6
+jmp L47
+L10: bne *r4
+L11: .data -280, -503, 660, -128, -138, 552
+L12: add L8, *r0
+m2
+m2
+m2
+m3
+L13: red r1
+jmp *r3
+rts
+
+sub *r2, r2
+add r1, r5
+dec r4
+m2
+rts
+clr r6
+m3
+L14: cmp r7, *r1
+dec r4
+not L11
+sub r2, r0
+L15: .data 364, -33, 843, 596, 709
+clr L6
+bne L50
+not L112
+L16: dec *r7
+red *r7
+not r3
+sub *r3, L11
+inc L46
+clr L94
+m1
+lea L110, L0
+sub *r0, L33
+not L42
+L17: .string "mdpeyy"
+m4
+m3
+jmp L47
+m2
+sub #168, *r7
+
+L18: clr L0
+add r2, r6
+L19: lea L14, *r5
+inc r7
+clr L106
+not *r6
+inc L30
+m2
+sub r7, *r4
+L20: lea L99, *r6
+L21: mov #-94, *r0
+jsr *r1
+rts
+m1
+inc L102
+rts
+dec r7
+jsr *r6
+m0
+L22: clr L2
+red L15
+L23: .string "zra"
+m0
+m3
+rts
+prn r2
+lea L14, *r5
+jsr *r0
+cmp #-233, #161
+L24: .data 624
+dec *r0
+L25: jsr *r0
+clr *r2
+prn r6
+m2
+L26: .string "zvihwsqvmkizajrpxxg"
+
+L27: not *r2
+mov #146, *r2
+prn L2
+stop
+L28: stop
+dec *r6
+
+prn *r1
+L29: .data 826, -538, -729, -497, 718, 43, -745
+jmp L29
+L30: .data 234, -711, 177, -430, -636, 606, 564, 987
+dec r7
+
+m4
+L31: not *r6
+cmp r5, r6
+not L4
+stop
+jmp L28
+add *r6, *r0
+stop
+sub *r5, *r2
+lea L28, r4
+mov #160, *r0
+L32: prn r7
+not *r0
+inc r3
+L33: .data -729, -473
+L34: clr *r6
+L35: sub r7, *r5
+m0
+m2
+L36: .string "vrajbzqcupvmlqqpcq"
+m2
+jsr *r2
+cmp #-17, #72
+cmp L19, *r5
+L37: bne *r6
+red *r5
+m3
+add #216, L8
+jsr L99
+rts
+prn L4
+not *r2
+lea L56, r6
+m1
+add #-1, L90
+m0
+bne L17
+rts
+; comment
+; comment
+L38: rts
+L39: .string "ql"
+m0
+L40: .data 18, 852, 498, -998, 939, -768, -857
+cmp r0, *r1
+add L62, L90
+inc L79
+L41: sub *r7, r2
+add #-229, L14
+inc r3
+L42: sub r2, r0
+bne *r4
+stop
+m2
+m1
+m1
+jmp L5
+add L39, L41
+L43: .data -606, -638, -201, -242
+prn L1
+m2
+L44: add L12, *r6
+prn #-115
+L45: .string "hjzmhilbpfmrjrjuucrtzihp"
+mov #-231, L36
+jsr *r1
+prn r2
+L46: not r3
+m2
+L47: cmp r1, #-170
+L48: inc r7
+sub r6, r1
+jmp L106
+L49: .string "d"
+; comment
+L50: lea L107, r6
+m1
+stop
+bne L53
+prn r4
+L51: mov #-163, r1
+jmp L18
+stop
+bne L106
+red L55
+m2
+lea L80, r3
+rts
+L52: .data 36, 998
+L53: .string "qvxdfccjykogyoqx"
+bne L70
+sub L87, L96
+L54: add *r3, r3
+rts
+m1
+cmp L99, #217
+bne *r0
+L55: .string "uxaoypwjhmtjqyhrpkjlru"
+L56: .string "zynbnjtsbekmpegwjtij"
+m2
+m2
+prn #227
+m0
+m0
+L57: rts
+L58: jsr *r1
+lea L82, *r2
+prn L9
+L59: .data -246, 235, 145, 83, 979, 854, 651
+L60: rts
+dec L0
+rts
+L61: .string "bi"
+jsr *r0
+clr L48
+L62: .string "qtsblapcmuxojjmcvs"
+L63: .string "kxqseiu"
+prn #-183
+m0
+rts
+L64: inc L59
+clr r5
+red r5
+
+sub L105, *r4
+red L108
+L65: .data -171, 797
+; comment
+dec *r5
+L66: add #135, *r2
+add #255, L55
+mov r6, L13
+clr *r6
+L67: dec *r1
+red r6
+m2
+m2
+stop
+L68: rts
+prn #-192
+inc L110
+m0
+L69: .data -368, 534
+m0
+L70: dec r4
+m3
+prn #-136
+L71: clr *r0
+m1
+clr *r7
+; comment
+m1
+; comment
+sub r1, r0
+not *r7
+red L58
+; comment
+cmp #130, #-50
+dec r4
+inc *r3
+clr L103
+not L69
+not *r2
+m2
+m3
+mov *r7, r1
+add *r1, r4
+cmp r7, L104
+add #78, r3
+stop
+red L54
+rts
+sub r0, L110
+L72: dec L2
+jmp L28
+L73: .data -94, 874, 651, 382, 789, 113, 500
+jmp L77
+lea L48, L4
+dec *r0
+m1
+m0
+red *r4
+rts
+dec *r7
+add r1, L29
+m3
+m3
+
+sub r3, r0
+L74: .data 407, -469
+L75: red *r6
+not L51
+m2
+cmp r0, L41
+not r1
+m2
+sub L114, L92
+L76: .data -808, 707, 938, -326, 242, -548
+mov L64, *r1
+jmp *r0
+lea L20, *r2
+m2
+red r5
+jmp *r1
+dec r0
+red r4
+jmp L71
+m1
+inc *r2
+; comment
+clr *r6
+sub *r2, r5
+m2
+dec r4
+m2
+m4
+clr L68
+m2
+dec L110
+mov #-102, L89
+not r3
+rts
+add r7, L15
+lea L45, r0
+inc *r1
+m0
+cmp #8, *r7
+m1
+dec *r0
+not L104
+L77: stop
+L78: .string "m"
+add #183, *r4
+; comment
+m2
+add #59, L60
+rts
+L79: .data 751, 414, 966, 57, 875
+L80: .data -897, -677
+add r2, *r2
+jsr L108
+bne *r1
+lea L36, *r7
+L81: not *r4
+L82: jsr *r0
+m3
+
+cmp #244, r4
+L83: add r6, *r5
+cmp #-191, #198
+dec r6
+bne *r2
+add r5, *r2
+m1
+L84: .string "jbpofsovffxzieealodmyad"
+L85: rts
+L86: .string "d"
+prn *r0
+lea L113, *r2
+sub *r4, *r1
+m3
+lea L109, L24
+m1
+sub *r2, r7
+bne L92
+red L84
+dec *r5
+bne L108
+L87: sub #226, r6
+
+rts
+red L91
+m0
+; comment
+clr *r2
+m0
+lea L89, *r4
+L88: rts
+dec r1
+m1
+L89: .data 408, -683
+m2
+red L88
+; comment
+m4
+L90: .data 564, -514, -951
+m1
+lea L96, *r4
+sub L101, L89
+L91: .string "eio"
+m3
+bne L110
+stop
+stop
+stop
+clr *r1
+stop
+m4
+mov L34, L98
+L92: red L105
+inc *r0
+prn *r7
+L93: .data 120, -782, -257, -694
+clr L106
+stop
+L94: lea L96, r4
+; comment
+sub L101, L86
+m2
+red r4
+bne *r6
+L95: lea L75, L29
+sub L15, L102
+L96: .data -416, -470, 721, 448, 346
+jsr L40
+jmp *r2
+add L108, L80
+cmp r6, *r3
+L97: jsr *r0
+add #158, L30
+jmp *r3
+L98: .string "i"
+L99: .string "u"
+red L102
+L100: rts
+sub L107, L103
+m2
+mov L73, *r2
+L101: .data -838, 407, -708, 489, -266, 494, 428, -437
+red r4
+clr *r6
+m1
+add r2, L102
+prn *r2
+; comment
+cmp L102, L105
+cmp #184, #-215
+L102: .data -460, 894, 363, -347
+m0
+m0
+mov *r2, L25
+not *r1
+prn r0
+L103: .data -148, 516
+m1
+m3
+m0
+bne *r3
+L104: .data 959
+; comment
+clr L112
+stop
+lea L105, L115
+m1
+stop
+prn L15
+m4
+m2
+m4
+L105: .data 74, -445, -707, -682, -712
+L106: .data -420, 203, 418
+L107: bne L86
+jsr L3
+prn r6
+m1
+L108: clr r5
+L109: stop
+m2
+L110: .string "itnom"
+L111: prn L63
+bne L112
+not *r2
+L112: .string "zrqjxwgyzomnqwkzguud"
+L113: stop
+m4
+not L114
+m3
+jmp *r3
+L114: lea L91, *r1
+L115: jmp L29
+stop
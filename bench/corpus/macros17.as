@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 18
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    lea L17, r4
+    lea L48, L23
+    add *r6, r6
+    clr r3
+    prn *r5
+    not r5
+    bne *r3
+    add r7, L48
+    stop
+    dec *r6
+endmacr
+macr m1
+    prn r2
+    bne L96
+    cmp r4, L47
+    add *r5, *r2
+    mov r7, L65
+    mov *r6, L60
+    add L115, L81
+    sub *r6, r4
+    bne *r6
+    clr *r7
+endmacr
+macr m2
+    not *r0
+    mov *r3, *r0
+    not *r7
+    prn r3
+    mov *r7, *r5
+    stop
+    dec *r3
+    add #2, *r5
+    lea L28, r6
+    dec *r4
+endmacr
+macr m3
+    sub L28, *r3
+    add *r0, L85
+    red r2
+    rts
+    inc *r3
+    stop
+    clr *r1
+    cmp *r0, r5
+    stop
+    lea L117, L56
+endmacr
+macr m4
+    rts
+    add r3, r6
+    sub *r5, r6
+    jmp *r2
+    add #-170, L111
+    sub *r4, r3
+    stop
+    bne *r1
+    lea L94, *r5
+    jmp L73
+endmacr
+dec r4
+; comment
+jmp *r6
+mov #59, *r3
+m4
+not L0
+L0: .data -541, -689, 919
+stop
+cmp *r0, #-229
+jsr *r2
+stop
+inc L86
+jsr *r5
+L1: clr *r7
+mov #-4, r7
+prn r6
+cmp r2, r3
+m1
+bne *r3
+prn #-146
+rts
+m1
+sub #29, *r1
+lea L98, L0
+L2: cmp #15, r3
+bne *r7
+L3: red L101
+
+mov L2, L2
+L4: add *r5, r7
+sub r2, *r5
+L5: mov r7, L1
+m2
+L6: jsr L6
+m3
+L7: stop
+m4
+add *r7, *r3
+dec *r4
+L8: .string "bcbnvqpruhdxysdfjwnrxphb"
+clr L3
+L9: jsr *r5
+add L2, r6
+L10: .string "todpjlstnooevuim"
+mov r3, L5
+add L37, L52
+; comment
+dec r5
+not *r4
+L11: stop
+L12: .string "ipygghpnrdxjeejxmkazecs"
+stop
+not L11
+stop
+; comment
+L13: inc r1
+m0
+L14: dec *r7
+L15: bne *r4
+sub *r6, L8
+rts
+mov r7, *r2
+not *r3
+L16: .string "vvkpff"
+m1
+jmp *r2
+mov L69, r2
+L17: sub #-195, L47
+m0
+L18: inc *r3
+L19: .data 981, -247, 113, -44, -398, -780, 504, 865
+red *r0
+L20: .data -812, -801, -402, -352, -441, 52, 581
+; comment
+L21: .string "fapnlukvnvdwwxjdscqrnj"
+m4
+inc r1
+m0
+dec L2
+L22: .data -251, -853
+L23: .data 383, -284
+rts
+L24: add r1, *r2
+bne L110
+bne L4
+m2
+jmp L6
+lea L15, *r0
+not r2
+prn L82
+jsr *r2
+L25: inc r6
+m2
+jmp L28
+m0
+clr *r5
+bne *r0
+cmp *r0, L96
+not r6
+add L0, L4
+prn #-125
+L26: .data 335, -744, 833, 517, -690
+red L105
+cmp #-82, #-27
+jsr *r1
+not r5
+jmp *r3
+prn *r0
+L27: prn L13
+L28: dec r1
+rts
+bne *r0
+jsr L17
+mov #-53, L16
+; comment
+dec *r1
+m1
+jsr L95
+clr r2
+m1
+lea L14, r3
+bne *r2
+dec L15
+m3
+rts
+mov L32, L4
+inc r6
+mov L13, L72
+dec r5
+bne L91
+m0
+cmp *r6, r6
+rts
+add #42, r4
+not L101
+clr L25
+jmp *r0
+m4
+red r1
+L29: .string "hsxpgqjcqhifskipznttjgp"
+not r2
+m2
+m3
+L30: .string "zpegtsdwjphztcnue"
+m2
+mov r4, r2
+m0
+L31: lea L28, L38
+L32: .data -118, 989, 628, -198, 815, 143, -779
+stop
+cmp L1, *r3
+rts
+dec r7
+L33: rts
+m2
+add L109, L71
+lea L10, r6
+m1
+jmp *r1
+L34: prn r6
+jsr *r5
+dec r6
+L35: dec L3
+rts
+prn r1
+inc r5
+L36: .data -483, -796, 748, 565, 583, -724
+m0
+cmp #-232, r1
+stop
+not *r3
+L37: .string "keyaiqooefwfsqyl"
+m4
+clr r1
+bne L3
+L38: sub L43, *r0
+jsr *r0
+m3
+jsr *r5
+L39: rts
+mov #145, L55
+jmp *r0
+
+mov #-72, *r3
+L40: lea L64, L92
+m4
+red L23
+
+mov #-76, r3
+cmp *r4, L106
+cmp *r1, L71
+L41: mov L27, L28
+dec L7
+L42: dec L38
+m3
+jmp L77
+
+m4
+not L39
+add r7, L70
+stop
+m2
+cmp r3, r7
+L43: .data -879, 279, 220, -640, -866, -114, 254
+L44: .data -792, 15, 794, -29, -903, -457, -84
+m1
+m0
+L45: sub #211, L68
+L46: rts
+L47: inc *r4
+m0
+sub L1, L42
+rts
+prn r5
+m2
+mov *r3, *r3
+mov #57, *r1
+L48: .data 353, -271
+cmp *r7, #203
+add r0, L33
+red r5
+L49: .string "nxw"
+sub #-152, r7
+L50: inc *r6
+jsr L120
+; comment
+
+m3
+jsr *r6
+m3
+; comment
+
+add #156, r3
+L51: .data 513, 814, -543, -811, 554, 747
+stop
+L52: mov #-134, r0
+m0
+jmp *r6
+dec r0
+dec *r1
+L53: lea L111, *r2
+not *r3
+red L46
+lea L48, L50
+L54: not L31
+L55: prn L88
+rts
+not L20
+L56: mov r6, *r2
+add r2, r2
+m1
+stop
+clr *r7
+inc L33
+L57: .string "bsctrxlwoaj"
+m2
+L58: cmp *r4, #-128
+m3
+L59: prn L27
+m0
+inc L90
+clr r4
+L60: .data 965, 40, 266, -940, -249, -956, 634, -728
+inc L60
+clr *r6
+rts
+sub *r4, r1
+jsr L94
+m0
+L61: .string "halswnrqunsxwubvvnpdfxjz"
+prn L118
+add L93, *r3
+L62: .string "ohsgokqfpm"
+stop
+L63: cmp #-184, r1
+bne L21
+L64: .data -986, 435, 53, -703, -761, 908, 288, -113
+m0
+inc *r3
+
+m0
+L65: .data 356, -267, 732, -277, -621, 119
+rts
+L66: .data 351, -885, -787, 405, -311, 672, 600, -3
+inc L12
+sub #75, *r5
+cmp #207, *r2
+L67: add L63, *r6
+rts
+L68: jmp L42
+red r5
+
+clr *r2
+red *r7
+L69: .data -265, -178, -45, 400, 437, 369, -720, -741
+L70: .string "ohgewmhigp"
+rts
+jmp *r0
+red *r7
+m4
+; comment
+sub L117, *r0
+mov L104, *r7
+red L84
+L71: .data -694, -607, 355
+not L81
+L72: .data -553, 989, -454
+bne *r1
+not r6
+cmp L41, r4
+L73: rts
+L74: .string "qsvarpbkjlf"
+inc L106
+clr *r6
+rts
+m1
+m1
+jmp L69
+prn *r4
+sub L88, r4
+L75: .string "cjpgmgtzxkxaswt"
+jsr L31
+L76: add *r2, L73
+m4
+bne *r0
+bne L60
+dec r1
+L77: .string "etzilrnpikuoljuf"
+m0
+L78: .string "tduoobkfujawfntoyfbwoglz"
+clr *r2
+inc L84
+L79: .data 352, -81
+stop
+m1
+m2
+dec r7
+; comment
+inc r4
+jsr *r3
+dec *r5
+red *r6
+red r1
+prn L116
+m4
+inc L32
+rts
+jsr L9
+L80: inc *r0
+L81: mov *r5, L88
+not r7
+cmp L113, *r1
+sub L101, r0
+m4
+jmp L80
+bne *r4
+L82: .data -106, -584
+dec L68
+prn L85
+stop
+lea L64, r2
+rts
+lea L102, L92
+m0
+m4
+m3
+sub #198, L32
+jmp *r3
+L83: bne *r2
+not *r0
+clr *r3
+jmp L113
+
+clr r3
+L84: inc r1
+red *r7
+rts
+L85: .data -729, -327, 885, -705, 136
+L86: .data 891, 698
+add #-84, *r2
+L87: dec *r6
+not r3
+prn r7
+lea L75, L106
+L88: .data 727, -398, -220, 473, -552, 522, 917, 663
+mov *r0, r3
+cmp #-38, #-229
+m0
+prn *r2
+red r3
+stop
+rts
+stop
+L89: bne *r5
+L90: .data -566, -757, 471, 396, -518, 555, 396, 213
+bne L74
+m1
+L91: .string "kgnad"
+red L37
+cmp *r3, *r6
+m3
+mov #173, r2
+L92: .string "rtfnsuxycyngmzp"
+jmp *r5
+jmp L75
+inc L54
+inc L116
+L93: .data -514
+m1
+L94: .data 431
+L95: prn *r4
+dec r1
+lea L120, r5
+sub #25, r4
+L96: .string "wkjkcaget"
+L97: not *r4
+L98: add #-237, *r5
+L99: .data 572, 446, 171, 920, 848, 526
+m2
+clr r2
+L100: sub r3, r6
+L101: .data 544, 374, -459, 53
+clr *r2
+L102: bne *r4
+L103: .string "rtrsgdksdbfkgwdr"
+stop
+jmp *r1
+bne *r5
+L104: mov #-206, *r0
+bne *r5
+m0
+not *r5
+L105: clr *r5
+L106: .string "q"
+mov r2, r4
+add L89, r5
+L107: .data 12, -109, -606, -335, 688, -983, 454
+bne L109
+inc *r5
+L108: .data 194, 639, -458, 784, 248
+L109: lea L110, r4
+; comment
+L110: add L38, r6
+not r1
+inc r0
+m1
+red *r6
+rts
+; comment
+bne *r7
+m3
+m2
+add *r1, *r3
+lea L111, r1
+L111: red r1
+not L119
+jsr L116
+L112: lea L49, r0
+m3
+L113: .data 194, 517, 855, 954, -294, -643
+red *r3
+; comment
+L114: clr L76
+rts
+m3
+L115: stop
+L116: .string "nrrtt"
+sub #124, r1
+L117: prn *r5
+jmp L118
+red L118
+not L74
+L118: .data 531, 90, 948
+m3
+inc *r3
+prn L34
+not L122
+sub *r4, L121
+m0
+bne *r7
+m0
+m0
+m3
+L119: add *r5, *r3
+prn #-194
+rts
+red L121
+jmp *r2
+jmp *r5
+stop
+L120: sub r2, *r4
+add r1, r3
+sub #151, r6
+jsr L116
+mov *r1, L122
+L121: .string "tjowshggmdxtgdocaew"
+L122: .string "ltgfbtfjyoaxwz"
+stop
+jmp L101
+m0
+stop
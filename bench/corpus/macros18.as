@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 19
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    red *r4
+    add *r5, L85
+    inc r1
+    mov #8, *r1
+    not r0
+    jsr *r2
+    mov #173, *r4
+    inc L93
+    not L70
+    rts
+endmacr
+macr m1
+    add #240, r3
+    sub L49, *r4
+    bne L2
+    bne L41
+    jmp L58
+    cmp r5, *r0
+    add #55, *r4
+    lea L104, L93
+    red L47
+    not L52
+endmacr
+macr m2
+    sub r6, L119
+    dec r4
+    sub #81, r2
+    bne *r5
+    cmp #-190, L39
+    red *r7
+    inc *r1
+    rts
+    jsr L38
+    stop
+endmacr
+macr m3
+    clr L115
+    inc r3
+    jmp *r7
+    bne *r6
+    dec L27
+    sub r4, *r0
+    jmp L93
+    jsr L48
+    inc *r5
+    not r7
+endmacr
+macr m4
+    add *r7, r6
+    clr r6
+    cmp #-171, *r3
+    sub *r4, r7
+    clr *r7
+    add #213, *r0
+    lea L43, L31
+    stop
+    jsr *r1
+    lea L10, *r6
+endmacr
+jsr L61
+L0: sub r6, *r0
+cmp L50, r5
+m3
+m2
+L1: .string "qavoqodcihxsnbuqxbtdm"
+L2: sub L2, *r0
+mov L1, L1
+mov *r5, L2
+add #-51, L0
+bne *r3
+add r7, *r2
+L3: clr L1
+stop
+L4: .string "djy"
+rts
+jsr *r0
+m3
+L5: stop
+bne *r3
+prn r4
+m0
+m4
+
+L6: cmp r1, r7
+jmp *r5
+jmp *r6
+L7: dec *r4
+lea L108, L2
+L8: jsr L2
+m2
+not r3
+prn *r0
+jmp *r1
+rts
+add r2, r5
+L9: prn L94
+lea L6, L64
+red L4
+red *r7
+m0
+L10: mov r7, r3
+jmp L53
+sub L6, *r2
+rts
+L11: .data -763, 198, 419, 532, -621
+L12: prn L62
+L13: .data 146, -615, -580, -553, 690
+m2
+m4
+red L41
+L14: red *r6
+mov *r2, L8
+lea L106, *r3
+m3
+L15: lea L114, r5
+not L50
+cmp r7, r2
+add #-119, L11
+L16: .data -501, 153, 598
+rts
+red r7
+jsr *r6
+L17: stop
+add r1, *r7
+L18: .string "wtb"
+add *r5, r0
+m0
+jmp *r1
+prn *r2
+not L17
+L19: .data -813, 47
+dec r0
+L20: .data -992, -258, 440, 251, -479, -578, 697
+red r1
+m0
+stop
+jsr *r3
+inc r4
+m3
+L21: not *r0
+; comment
+m2
+L22: add #-89, *r6
+m2
+m3
+bne *r6
+bne L53
+L23: stop
+; comment
+L24: inc L24
+L25: mov r5, r7
+L26: .data 307, 997, 370, 947
+mov L113, L16
+cmp *r1, r5
+mov *r0, L15
+not L64
+sub L44, r6
+bne *r1
+L27: .data -948, 772, 83
+L28: .data -943, 735, 587, 266, 9, -82, -72
+clr *r0
+sub L8, *r7
+m3
+inc L19
+L29: .data 505, -580, 716, -479, -613, -542, -346
+bne *r6
+m0
+L30: .string "thxyczhracybxkrfcvmmu"
+not L82
+m2
+L31: red *r0
+rts
+jmp *r5
+m1
+jmp L75
+L32: .data 313, 218, 884, -541, -941, -258, -881
+add r1, r4
+prn #-209
+sub *r5, r4
+rts
+add *r7, L50
+cmp L76, L8
+m1
+L33: mov r1, *r3
+stop
+m1
+m1
+L34: stop
+
+m2
+jsr L51
+stop
+L35: .string "cxhhsw"
+stop
+m1
+m2
+; comment
+m3
+L36: .string "ssoajg"
+rts
+jmp L30
+L37: jsr L93
+m2
+L38: inc L67
+L39: .string "fpzrkagyrudlaaos"
+jsr L57
+m3
+cmp #228, *r6
+stop
+mov #24, L96
+L40: add *r3, r3
+not L29
+clr r3
+L41: red r1
+m0
+m4
+lea L98, L34
+m3
+m2
+dec *r2
+cmp *r0, L25
+L42: .data -940, 576, -19, -978
+add #159, *r6
+jsr L115
+m2
+mov *r7, *r3
+L43: jmp L6
+add *r4, L113
+m1
+not r3
+stop
+sub L7, *r2
+sub *r1, r6
+not r5
+m1
+m0
+
+m1
+m1
+not *r1
+L44: clr *r5
+inc L12
+add #-213, L1
+L45: jsr *r2
+add #246, L18
+inc L85
+bne L73
+cmp *r5, L84
+L46: .string "ozxdauwzupondpr"
+stop
+L47: dec L13
+red r3
+; comment
+m1
+L48: mov *r7, r3
+L49: prn #-194
+; comment
+lea L21, L110
+lea L19, *r6
+rts
+jmp L105
+sub r3, r7
+inc *r6
+clr L114
+jsr *r6
+L50: .data 256
+
+stop
+not *r4
+mov #210, r2
+rts
+jsr L44
+m0
+L51: .string "qqoncuurioxladrexneqf"
+m0
+jsr *r7
+L52: rts
+mov #194, *r1
+clr L100
+m4
+m2
+m1
+red *r4
+m4
+stop
+not *r0
+add r2, *r2
+add *r0, r1
+; comment
+L53: .data 361, 924, 652, 120, 757, 670
+prn L43
+L54: bne *r7
+L55: bne L35
+m2
+cmp #45, r5
+L56: bne *r7
+prn L4
+L57: add #5, L38
+dec L26
+stop
+jsr L105
+L58: .data 627, -856, -189, 599, -17, -929, -165
+add #-64, L93
+add r1, L115
+m1
+m1
+prn r3
+red L51
+L59: red *r1
+lea L23, L57
+m1
+L60: .string "lktokzmsiuwsa"
+L61: .data 526, -963, 187, 886, 345
+m3
+cmp *r7, #-233
+add L115, r1
+mov L19, *r2
+dec r5
+L62: .data 905, 984, 704, -737
+L63: rts
+m4
+stop
+m4
+add *r6, *r5
+L64: jsr *r0
+prn r1
+
+m1
+sub L121, L43
+red *r1
+bne L99
+
+L65: dec r5
+m2
+L66: .data 919, 647, 549, 379, 212, 612, -118
+L67: prn *r6
+cmp r6, #133
+prn #76
+L68: mov #-91, r7
+inc L114
+inc *r1
+bne L117
+red r4
+dec r2
+m1
+inc *r1
+sub L88, r0
+bne L25
+L69: jsr *r2
+m4
+m4
+stop
+stop
+m1
+dec *r6
+sub #194, r4
+L70: clr *r0
+L71: add #-24, L115
+red *r5
+stop
+m1
+L72: dec *r7
+inc L95
+L73: lea L108, L19
+; comment
+clr r0
+red r3
+
+clr *r2
+dec *r0
+L74: dec L64
+rts
+inc r3
+; comment
+L75: prn r0
+L76: add L62, *r1
+bne *r3
+red L85
+dec *r6
+L77: cmp L33, *r3
+prn #62
+m3
+m2
+jmp L117
+; comment
+L78: jsr L81
+m0
+inc *r1
+clr *r5
+jmp *r0
+
+L79: dec *r7
+dec r6
+sub r4, L95
+rts
+L80: red L103
+red r1
+lea L13, r4
+prn #-251
+sub *r6, L45
+L81: .data 78, 196, -400, -116, 98, -470
+mov *r2, L31
+add #190, r0
+add #253, L33
+L82: dec r1
+inc L112
+L83: .string "lnxuofmkuetdnovcrjfh"
+
+lea L94, L116
+L84: jmp L55
+m1
+dec r1
+mov *r2, r1
+lea L112, *r7
+jmp L72
+dec *r3
+add r3, *r4
+; comment
+L85: not *r6
+L86: .string "a"
+L87: red L43
+red L110
+cmp #138, r0
+L88: add L11, L65
+jsr *r6
+m4
+stop
+inc L103
+prn r7
+m0
+m2
+mov #156, L100
+cmp L93, #21
+clr r1
+red *r2
+jsr L111
+L89: jmp L109
+dec L85
+L90: cmp L73, *r7
+L91: .string "pdmgksgtld"
+stop
+cmp r4, L100
+m0
+prn L20
+L92: inc r2
+mov *r3, r1
+clr L120
+inc *r1
+rts
+add r4, r4
+add r2, r6
+rts
+L93: .data -791, 669
+mov #143, L20
+m0
+add *r7, r3
+red L114
+stop
+L94: sub r2, L16
+lea L111, *r0
+L95: cmp #167, *r0
+m0
+stop
+L96: mov #-79, r2
+prn L63
+prn #182
+mov #221, r2
+prn #-192
+m4
+m3
+m4
+inc L58
+sub r3, *r7
+cmp L68, L98
+red *r1
+L97: .data -565, 920
+L98: lea L71, r1
+sub L63, L94
+
+L99: .string "obeydrkqrj"
+jsr *r4
+add L111, L116
+add r4, L25
+L100: lea L47, *r7
+inc *r0
+cmp r3, L113
+; comment
+jmp L106
+L101: .string "mszpuvxslgobcetsvswrq"
+L102: mov #-210, L63
+add L59, *r5
+m4
+L103: cmp #-94, *r7
+m3
+add L21, L53
+red r7
+; comment
+; comment
+add L120, r5
+L104: lea L59, L115
+bne L71
+sub L78, r0
+prn #-236
+L105: jmp *r6
+m1
+inc r3
+inc r2
+rts
+L106: dec *r2
+cmp #-37, *r2
+L107: stop
+L108: .data 976, 423, -403, 117, -8, 393, 377, 793
+L109: jmp L121
+
+jsr L117
+jmp L112
+stop
+
+L110: .data 429, 443
+add r2, L46
+
+clr L116
+L111: .data -648, 23
+L112: jsr L52
+L113: .data 647, -746
+cmp r0, #253
+sub L121, L40
+m3
+L114: .string "vvpntwanznovqalmqea"
+m4
+not r2
+rts
+rts
+mov *r6, r2
+L115: .string "bwdwtwe"
+m3
+inc *r7
+L116: cmp r1, #241
+prn L117
+L117: rts
+red L120
+L118: .string "zjcxlkipfejtvuh"
+stop
+jmp *r7
+stop
+L119: jmp L121
+red r2
+not L114
+
+inc L120
+red *r3
+L120: sub #-239, *r0
+red L99
+lea L109, L121
+not r2
+L121: jsr L51
+lea L26, r7
+m0
+add L28, *r1
+stop
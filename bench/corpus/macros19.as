@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 20
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    prn r0
+    jmp L19
+    not *r7
+    lea L11, *r3
+    jmp *r5
+    prn #-126
+    sub L87, r7
+    cmp #-41, r3
+    red *r3
+    lea L90, r3
+endmacr
+macr m1
+    add *r5, r2
+    mov r7, r1
+    lea L28, L73
+    dec r3
+    clr r3
+    inc *r7
+    dec *r1
+    jsr L116
+    jsr *r3
+    mov *r1, *r7
+endmacr
+macr m2
+    not L17
+    dec L94
+    inc r7
+    bne *r0
+    clr *r3
+    jmp L15
+    jsr *r0
+    inc *r3
+    prn *r3
+    add #-164, L99
+endmacr
+macr m3
+    stop
+    jsr *r4
+    rts
+    red L12
+    mov L63, *r6
+    prn r2
+    dec r1
+    jmp L0
+    prn #-39
+    sub #-50, *r5
+endmacr
+macr m4
+    jmp *r1
+    dec *r7
+    red L34
+    dec r2
+    prn *r6
+    clr L45
+    add r1, r4
+    not r7
+    inc *r0
+    not *r5
+endmacr
+L0: .string "dohqcfewls"
+clr *r6
+jmp *r5
+add *r0, L0
+inc r3
+bne L41
+rts
+m1
+L1: .string "sakwgucegebrajanqla"
+L2: lea L2, r2
+m2
+m1
+
+red r0
+L3: lea L38, *r1
+dec r1
+m2
+mov #136, *r7
+stop
+red r0
+m1
+m2
+dec *r4
+m4
+L4: .data 126, 329, -86
+add L94, *r1
+prn #-225
+add #30, r1
+jmp *r4
+jsr L19
+
+L5: bne L0
+jmp L4
+m4
+bne *r6
+L6: cmp *r3, L1
+m3
+jmp L102
+
+stop
+mov L1, *r2
+cmp #-215, *r2
+mov L101, L5
+add L40, r2
+prn *r3
+jsr L4
+m2
+bne *r4
+bne *r0
+lea L2, L4
+mov L70, L37
+prn #72
+dec r1
+jsr L3
+stop
+not *r7
+L7: dec *r4
+clr *r1
+cmp #-76, *r2
+m4
+L8: prn r7
+prn #158
+L9: dec L1
+sub L1, *r4
+L10: .data -327, -855
+add L99, r4
+lea L9, L86
+rts
+
+rts
+L11: sub *r3, *r1
+L12: cmp L72, #-130
+lea L7, L50
+jmp *r5
+bne L8
+; comment
+m2
+m4
+; comment
+m2
+m0
+add #198, *r0
+L13: stop
+L14: stop
+jmp *r6
+
+red L18
+dec L112
+dec L10
+bne *r5
+add *r1, L3
+cmp L94, r7
+sub r5, *r2
+prn #90
+L15: add #222, L42
+L16: .string "vwoeeratoqwtrppwie"
+m2
+bne *r1
+red r5
+
+jsr L88
+L17: red *r1
+L18: .data -621, 628, -856, -426
+jmp L101
+stop
+lea L75, r7
+m0
+prn r7
+stop
+clr r5
+m1
+L19: red L17
+L20: .string "wkiqexqup"
+jsr L14
+m4
+L21: .string "tpjkynrczdnclhynqjukgxxy"
+bne *r2
+L22: jsr L18
+m0
+mov L21, *r5
+bne *r4
+jmp L8
+clr L2
+prn #-228
+L23: not L24
+inc L38
+add *r6, *r5
+cmp #-61, #-110
+lea L44, *r3
+red L116
+sub *r0, r5
+red *r3
+
+rts
+prn r5
+m1
+m3
+red *r6
+m2
+
+L24: .data 651, 48, -429
+L25: .string "oiljbsqoquqejxdvjlnjwf"
+L26: prn #-24
+L27: .string "hourxolppvnn"
+sub *r1, *r2
+bne *r1
+L28: .string "omjrrkqniekssmm"
+m2
+inc L103
+L29: jmp *r4
+m3
+cmp r0, L70
+not r0
+L30: lea L55, r3
+L31: mov *r6, L11
+m2
+jsr *r2
+add #63, r3
+red r4
+L32: .data -21, 518, -525, -84, -286, -753, -766
+add L94, *r2
+not *r7
+L33: bne *r3
+L34: rts
+cmp r4, r3
+
+mov *r1, L49
+jsr *r5
+rts
+dec *r4
+rts
+red *r6
+lea L45, L0
+m2
+L35: .data -10, 924, -718, 865, -464
+m3
+bne L29
+not *r1
+dec *r5
+add r1, L3
+rts
+L36: .data 293, -716, 62, -203, -650, -518, 846, 259
+inc r0
+L37: .string "ekcqhcfapjvqwcel"
+not L105
+m4
+L38: .data 364, 694, 763, 34
+clr L46
+lea L8, L26
+m1
+L39: rts
+m4
+jsr L9
+L40: bne *r4
+mov *r2, r1
+red *r5
+L41: red *r7
+jsr *r2
+L42: bne *r1
+L43: rts
+L44: cmp L13, #46
+mov *r0, *r2
+L45: rts
+not r3
+L46: inc r7
+red L63
+bne *r7
+sub r2, r1
+cmp L34, r5
+dec *r0
+; comment
+cmp r2, *r7
+not *r0
+L47: red *r4
+bne L73
+rts
+L48: .data 291, 7, 633, 241
+dec L111
+stop
+inc L103
+m1
+add L25, r5
+inc r2
+L49: inc L96
+stop
+L50: .data 95, 852, -621, -264, -356, 570, -823, -418
+inc *r6
+not L38
+mov #-242, L48
+m0
+L51: dec *r6
+dec *r3
+cmp r3, #-100
+jmp L22
+L52: jmp L9
+L53: red *r6
+mov r6, L87
+; comment
+stop
+m2
+lea L33, L3
+m1
+red L57
+red r2
+mov #242, L8
+L54: .data 894, 791, 817, 568, 40, -293, -670
+mov *r5, *r2
+; comment
+m3
+m3
+L55: cmp *r3, r2
+; comment
+dec *r5
+lea L26, L91
+add L35, L95
+bne L11
+L56: prn #-254
+m1
+L57: lea L95, r5
+lea L2, r7
+mov #-247, L78
+L58: mov #-185, r6
+stop
+L59: inc L35
+mov L51, *r7
+not r3
+L60: bne *r3
+lea L104, *r5
+lea L20, r2
+clr *r2
+m0
+L61: lea L51, r5
+m0
+not r1
+L62: jmp *r4
+red *r7
+m2
+bne L88
+sub r7, *r6
+clr r6
+rts
+mov #-208, *r1
+L63: lea L60, *r3
+rts
+L64: not L111
+; comment
+lea L58, L82
+red r2
+rts
+m2
+add r1, r2
+dec L33
+inc *r6
+dec r2
+m0
+red r7
+bne L86
+m3
+dec r4
+inc L100
+L65: add #231, r3
+; comment
+stop
+L66: .data 507, -987, 808, 18, -789, -401, -275, -59
+m4
+bne *r6
+L67: dec *r7
+sub *r3, *r7
+L68: .string "qcewdkskqqgbszi"
+
+L69: prn #-238
+cmp #191, r0
+
+L70: red r0
+not L73
+cmp *r4, *r2
+L71: stop
+m2
+L72: stop
+lea L20, r1
+m1
+m0
+not *r1
+add #-255, L77
+bne *r7
+m4
+L73: jsr *r2
+jsr *r1
+
+dec r5
+m2
+L74: .data -139, -523, 803
+jmp *r2
+L75: not r1
+L76: .data -227, 369, 890, 715
+clr r2
+L77: clr r2
+L78: .string "xkowmaqifpdahqtpz"
+L79: clr *r2
+inc *r5
+bne L83
+clr *r7
+L80: rts
+sub L113, r7
+jsr *r1
+stop
+L81: red r0
+bne *r0
+cmp L6, *r5
+red L82
+bne *r2
+jsr L66
+L82: bne *r6
+L83: .data -963, -323
+add r1, r0
+mov *r2, L3
+stop
+dec L56
+L84: inc L93
+dec *r4
+
+red L113
+jsr *r0
+add L47, r6
+sub *r7, L85
+L85: .string "uv"
+m3
+jmp L15
+clr L77
+stop
+L86: bne L106
+lea L68, r5
+jmp L111
+jsr *r0
+L87: .data 214, 167, 389, -242
+prn r7
+add L71, L79
+mov L112, L89
+add L71, *r2
+rts
+L88: jsr L16
+not L116
+inc L108
+sub *r3, r1
+inc r4
+L89: rts
+L90: .data -244
+L91: inc L31
+sub r7, r2
+L92: .string "dr"
+bne L90
+lea L109, r4
+L93: dec r3
+L94: .string "lxhckrgsoagunm"
+red *r5
+bne *r6
+m3
+cmp *r0, L104
+m3
+m0
+sub #73, *r4
+red *r0
+stop
+cmp r6, #-239
+m4
+L95: lea L106, r1
+L96: .string "gkaicjzarbpy"
+rts
+L97: .data 440
+bne L101
+sub r1, *r7
+
+jmp *r0
+jmp L54
+L98: add r0, *r6
+m4
+dec *r2
+m2
+L99: add #96, *r5
+L100: .string "ocdeemb"
+inc *r3
+L101: .string "m"
+m4
+prn *r5
+m4
+jmp L111
+; comment
+L102: .data -494, -253, -909, 215, 918, 26, -362
+m2
+L103: stop
+sub #-28, *r3
+lea L55, r5
+m1
+not r0
+m4
+rts
+m1
+cmp *r1, L2
+dec L104
+rts
+mov r2, *r0
+L104: .data -37, 52, 925, 227, 242, 882, 693
+red L33
+red L115
+jsr L115
+L105: lea L110, r0
+mov #132, r1
+not *r4
+L106: .data -766, 696, 290, 674, -261, -128, 180, -338
+m2
+stop
+jsr L107
+sub r2, *r0
+m2
+clr *r4
+jsr L82
+m4
+m1
+bne *r7
+L107: .data -808, -285, -276, -123, -423
+m2
+m3
+add r3, L116
+L108: bne L112
+L109: prn *r2
+L110: cmp #210, #11
+prn L112
+prn #205
+add r6, L113
+L111: stop
+m0
+stop
+L112: clr L114
+m0
+L113: .string "e"
+not r3
+inc r5
+lea L114, *r2
+m3
+m3
+red *r4
+mov r4, *r2
+stop
+m3
+rts
+m2
+L114: cmp L38, #-15
+; comment
+inc L35
+jsr *r6
+cmp L32, *r5
+jsr L115
+jsr L59
+sub #-31, *r4
+sub #80, L115
+L115: add r6, *r7
+m1
+stop
+
+L116: .string "pjgukgtae"
+stop
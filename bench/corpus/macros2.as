@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 3
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    lea L53, *r4
+    dec *r4
+    add #174, L71
+    bne *r6
+    prn L7
+    prn *r5
+    bne L32
+    lea L91, r1
+    rts
+    red r0
+endmacr
+macr m1
+    mov *r2, *r0
+    lea L30, r5
+    jmp *r5
+    add #65, r5
+    bne *r0
+    jsr L54
+    stop
+    mov r4, *r2
+    stop
+    rts
+endmacr
+macr m2
+    rts
+    add #188, *r4
+    bne L18
+    clr r3
+    sub #225, r2
+    not r4
+    lea L35, *r5
+    jmp L36
+    jmp L2
+    clr L106
+endmacr
+macr m3
+    dec r5
+    jmp *r0
+    stop
+    cmp *r2, #-64
+    dec *r3
+    add *r2, r6
+    rts
+    lea L2, r1
+    prn #-38
+    rts
+endmacr
+macr m4
+    add *r2, r1
+    add #-7, *r5
+    add L82, *r2
+    prn #-225
+    lea L101, L46
+    jsr *r6
+    red r4
+    not r6
+    mov L97, L104
+    lea L87, *r2
+endmacr
+dec L21
+; comment
+rts
+dec L40
+m4
+L0: .string "yznfugznfffwsorbocb"
+lea L72, L0
+jsr L63
+L1: .data -998
+jsr L8
+dec r6
+m1
+; comment
+L2: .data 186, -430, -32, -967
+; comment
+add #-20, *r6
+mov r2, r2
+L3: .string "fsmlfkja"
+m1
+bne *r2
+L4: clr L104
+L5: .data 121, 86, 705, 758, -684, -205, 790, 596
+L6: prn *r6
+red L105
+sub #-64, L3
+L7: bne *r3
+rts
+m2
+sub L28, L0
+prn r3
+jmp L1
+jsr L4
+
+jmp *r1
+L8: mov r3, L0
+not L85
+; comment
+
+L9: sub L34, *r5
+m0
+stop
+m4
+; comment
+rts
+L10: not L1
+not *r7
+; comment
+m2
+; comment
+m2
+L11: .data 122, 967, -713, 13, 990, 770, 665
+
+m3
+add #149, L100
+dec *r6
+L12: .data -496, 6, -323, 934, -345, -480, 530
+prn r7
+rts
+L13: .data -847, -440, 142
+jmp *r2
+clr r4
+red L29
+L14: inc L49
+
+stop
+L15: cmp r5, L2
+prn *r0
+m3
+sub L92, r0
+mov #117, *r7
+clr *r4
+
+
+
+L16: lea L51, r5
+L17: jsr L49
+lea L81, r1
+add L93, *r7
+L18: .data 458, -59
+m4
+L19: .data 679, -24, 336, -996, 355, -183
+dec L0
+prn r3
+m2
+L20: .string "bmibazln"
+lea L3, r1
+prn *r1
+L21: .data 668, -697, 494, 752, 602, 175, -827
+sub *r7, r3
+jsr L70
+stop
+; comment
+m4
+lea L10, L19
+rts
+clr *r4
+dec L84
+m4
+inc r7
+add L53, L40
+prn r1
+L22: .string "uozecoxtzo"
+rts
+L23: red r3
+bne *r5
+jsr *r5
+add r1, L16
+not *r5
+L24: .string "jibvdp"
+red r5
+jsr L2
+lea L89, r3
+L25: jmp L24
+m4
+not L101
+L26: sub *r7, L106
+m3
+dec r6
+L27: lea L2, r2
+lea L42, L102
+m1
+sub #52, *r3
+inc L0
+m3
+L28: inc *r2
+dec r1
+L29: lea L8, *r1
+L30: jmp L72
+m0
+L31: prn L21
+
+m1
+stop
+clr L62
+rts
+jmp *r2
+dec *r3
+red *r2
+L32: .string "cds"
+jmp L65
+stop
+cmp r6, *r5
+stop
+L33: clr *r4
+; comment
+L34: lea L32, L22
+red *r0
+; comment
+rts
+not L64
+add r0, r0
+dec r5
+L35: .data -204
+lea L0, *r7
+L36: .data 91, -740, 867, 499
+L37: rts
+L38: .string "gvduzppoqspgpbzdeahglvj"
+L39: lea L89, *r1
+L40: .string "ruvqbsetqy"
+jsr *r7
+jsr L75
+sub L102, L29
+not r5
+m3
+L41: .string "qpkwhfwehmwokgi"
+add #20, L2
+L42: jmp *r0
+sub L4, *r1
+cmp *r7, L44
+clr r1
+L43: bne L3
+
+L44: cmp *r7, L76
+rts
+dec r2
+m2
+L45: lea L42, *r7
+dec L15
+m0
+prn L30
+prn r7
+m3
+L46: .data 403, 479, 719, 428, -90
+m0
+stop
+jsr L42
+dec *r0
+not r7
+m4
+jmp L35
+m4
+L47: rts
+m1
+inc L1
+jmp L59
+clr r1
+jsr *r6
+jmp L83
+inc L54
+L48: red L84
+mov L93, r2
+bne L82
+m1
+jmp *r4
+bne L92
+add r0, *r1
+; comment
+red L68
+m2
+m3
+; comment
+mov #235, L57
+L49: .data -521, 328, 282, -924
+jmp *r3
+L50: .data -168, -606
+; comment
+cmp L85, L12
+L51: red r4
+m4
+mov #-141, r1
+prn *r2
+L52: mov L56, L73
+L53: sub r3, L78
+L54: red r7
+m2
+not *r0
+jmp *r7
+not L18
+L55: .data 12, 218, -921, 323, 330, 218, 253, -7
+jsr *r0
+dec L104
+jsr L78
+bne *r7
+stop
+sub *r6, r3
+m4
+lea L65, L104
+cmp #-161, L103
+add L26, r7
+red r4
+add r5, L93
+add #-27, L63
+m4
+rts
+not r2
+jmp L1
+prn L52
+clr *r1
+add L62, *r1
+jmp L3
+m1
+m4
+clr *r5
+mov *r1, r1
+; comment
+bne *r7
+add #-238, r6
+m3
+not *r5
+sub r5, r7
+jsr *r7
+clr *r6
+clr L89
+stop
+m1
+sub #178, *r4
+L56: stop
+rts
+add L18, L87
+not r2
+sub L74, L53
+prn #59
+L57: .string "sqzyvajinuxmpihumsdczee"
+L58: .string "blgtnqyilbytrieq"
+cmp L98, L78
+jsr L65
+add L37, *r6
+; comment
+dec r4
+add #10, *r4
+inc r1
+dec *r2
+L59: .string "pxnxmjyovazv"
+not L27
+clr r7
+L60: bne *r3
+L61: cmp L27, #118
+bne L34
+m0
+m2
+L62: dec L27
+m1
+m1
+clr L90
+prn *r0
+L63: .string "ozatjhrinxynhpr"
+L64: .string "ykv"
+L65: .string "hhidjpxqvjwd"
+dec r7
+rts
+add L96, *r6
+jsr L88
+prn *r2
+bne *r0
+L66: dec L17
+jsr *r7
+stop
+L67: clr *r2
+lea L2, r6
+prn r5
+sub r4, L15
+L68: lea L104, r0
+bne L1
+sub L99, *r7
+L69: .data -61, -806, -842, 781, -2, 418, -337
+m0
+mov r3, *r1
+rts
+m4
+sub L92, r6
+m3
+bne L83
+clr L81
+
+L70: sub #90, *r4
+L71: .data -136, -908, -532, 157, 854, 338, -117, -892
+m2
+red L96
+prn r4
+m4
+m0
+m1
+red L55
+bne *r2
+bne *r5
+stop
+lea L91, r7
+jmp *r3
+bne L57
+m3
+not L103
+dec r2
+inc *r2
+m1
+add #106, L65
+m4
+lea L97, L14
+prn #42
+m3
+bne *r4
+inc *r5
+inc L2
+m1
+L72: .data 906, -166, -657, -785, 892, -714, 195
+L73: cmp L49, #181
+stop
+m3
+prn L87
+L74: sub r1, r1
+clr *r7
+L75: sub r0, L100
+m2
+m1
+L76: .data -18, -357, -377
+jsr L97
+jmp L72
+not *r2
+m3
+L77: stop
+m0
+dec r7
+mov r3, r7
+m2
+m3
+L78: .string "pjnnchumj"
+L79: not r1
+L80: .data -411, -685, 651, -347, -91, -447
+prn L45
+L81: dec L92
+L82: dec r5
+; comment
+jmp *r2
+L83: stop
+clr L78
+mov r5, L103
+m2
+m0
+clr L65
+jmp *r7
+L84: .string "dvgfuyyxectvtula"
+m3
+not L97
+L85: jmp *r0
+jmp *r0
+m0
+m1
+prn *r3
+rts
+prn L98
+m2
+jmp L106
+stop
+cmp r0, r3
+m1
+lea L97, L16
+add L103, L86
+stop
+dec r2
+L86: .data -551, -21, -182, 858, 851
+red L28
+clr *r3
+prn r7
+inc L96
+add *r1, r1
+jmp *r5
+jsr L89
+not *r1
+cmp *r1, L96
+bne *r2
+jsr L56
+sub *r6, *r7
+m4
+L87: .data 452, 593, 496, -33, -73, -660, -605, -972
+red r6
+m0
+L88: rts
+prn L72
+clr *r1
+m4
+; comment
+mov #98, r3
+not L49
+m3
+L89: .string "edoj"
+L90: .data 703, 519, 482, -626, -849, -488, 731
+bne L87
+m4
+red r2
+jsr *r5
+bne L104
+clr L80
+L91: not L66
+jmp *r1
+add #-236, *r3
+L92: prn r3
+m0
+cmp r5, #-181
+L93: .data 233
+mov L7, L106
+m3
+cmp #-249, r3
+add L24, L104
+L94: dec r2
+sub #-254, *r7
+m1
+jsr *r6
+L95: clr r0
+jmp L101
+red r3
+L96: add L52, *r4
+not L102
+jsr L83
+prn #193
+L97: .data 979, -636, -638
+clr L104
+prn #255
+red r7
+L98: .data 69
+L99: lea L22, r7
+L100: jsr L20
+mov L30, *r0
+m2
+m0
+inc L0
+bne *r7
+stop
+
+lea L102, *r3
+not r0
+L101: jmp L106
+not r2
+add L104, r3
+bne L106
+rts
+L102: inc L71
+lea L106, r1
+m1
+jmp L105
+add *r0, *r6
+m0
+not r3
+L103: dec r0
+prn r0
+lea L104, r2
+L104: .string "nidqlntbxstns"
+m2
+L105: sub *r7, *r7
+L106: .data -916, -103, 504, 153, 597
+jsr L79
+inc *r4
+stop
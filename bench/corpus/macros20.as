@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 21
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    rts
+    stop
+    stop
+    prn *r4
+    clr r1
+    cmp r3, #-109
+    rts
+    clr *r7
+    rts
+    not L105
+endmacr
+macr m1
+    dec r7
+    lea L101, r3
+    cmp #-71, r6
+    lea L22, r5
+    inc *r4
+    lea L20, L50
+    mov r0, r6
+    clr L22
+    dec L54
+    dec r2
+endmacr
+macr m2
+    rts
+    prn r2
+    not r4
+    lea L7, L35
+    inc *r5
+    stop
+    clr r2
+    jsr L70
+    inc L69
+    mov r2, r7
+endmacr
+macr m3
+    rts
+    cmp *r4, *r1
+    jsr *r2
+    stop
+    jsr L35
+    cmp r1, *r0
+    not *r1
+    rts
+    add *r6, *r0
+    stop
+endmacr
+macr m4
+    sub *r2, L91
+    not r5
+    inc r1
+    lea L18, *r2
+    prn r4
+    jmp L41
+    add r2, r4
+    inc L60
+    red r6
+    cmp *r0, #-37
+endmacr
+m3
+inc r3
+L0: sub L0, *r1
+dec *r5
+L1: clr r3
+rts
+m1
+m3
+L2: .data 842, 768, 627, -913, 74, -382, 714
+cmp L1, #-208
+rts
+m3
+m0
+m3
+rts
+jsr *r5
+clr r4
+L3: .data 795, 734
+cmp #-213, r0
+lea L60, L41
+cmp #-171, #-243
+m3
+sub #132, *r6
+jsr *r6
+m0
+dec r0
+inc L2
+m3
+inc *r1
+dec r7
+L4: dec r0
+; comment
+L5: .string "tmcryqvodogahh"
+L6: .string "ci"
+L7: .data 940, 848, -671, -490, -649
+m1
+mov L2, r5
+jmp L2
+m1
+m4
+not *r4
+inc *r5
+prn L87
+L8: prn L7
+jsr *r4
+dec r7
+L9: stop
+L10: .data 168, -612
+L11: jsr L1
+add #139, *r5
+L12: .string "dbmvwms"
+m2
+L13: not *r7
+L14: red L36
+stop
+m0
+bne *r6
+clr r1
+not L2
+m4
+dec *r7
+stop
+L15: not r7
+L16: cmp *r3, L103
+L17: .string "efzzrrpbrlrhbwlhjervmn"
+bne *r3
+dec L38
+stop
+not *r5
+mov L17, *r5
+cmp L65, #153
+clr *r4
+L18: jsr *r2
+not r3
+m0
+L19: bne *r4
+L20: clr *r6
+m0
+bne *r3
+m0
+m4
+L21: jsr *r4
+L22: lea L107, L81
+
+m2
+m0
+m2
+L23: dec L61
+L24: .data 437, -396, 433, 519, -135
+mov r4, r3
+L25: .data 110, 307, -752, 794, 873
+sub *r5, L4
+; comment
+cmp *r7, r3
+m1
+prn r5
+prn L82
+L26: jsr L75
+bne *r6
+jmp *r7
+L27: lea L30, r0
+add *r1, L5
+L28: .data -575, -592, -256, -716, 427, -126, -852
+m2
+dec r1
+clr L26
+; comment
+L29: .data 589
+m0
+m1
+add #-220, L19
+L30: red r3
+stop
+prn #-166
+L31: .data -775, 666, 175, -291, 24, -674, -595, 576
+stop
+
+L32: .string "zdhxzdei"
+m2
+bne L48
+m1
+not *r6
+dec r1
+red *r6
+cmp L61, #235
+m0
+inc L31
+m0
+rts
+L33: .string "kfsqtwcpduwumspypw"
+clr L16
+m0
+mov #172, r6
+m2
+L34: red L24
+jmp *r3
+inc L3
+prn L6
+L35: .string "tipyyyvyncrrowezyeqh"
+L36: .string "ne"
+jmp L71
+bne L27
+m3
+rts
+m0
+L37: add L28, *r7
+m0
+
+L38: .string "ckvmhmhxpjtugxyyked"
+dec r0
+mov L5, L98
+bne L27
+prn *r6
+L39: mov *r6, L7
+m2
+clr *r0
+L40: bne L75
+m4
+jsr *r1
+
+bne *r0
+; comment
+jsr *r6
+jmp *r7
+m0
+jsr *r4
+prn *r2
+jsr *r6
+red L36
+mov *r5, *r2
+lea L14, *r2
+m0
+add #-16, L56
+m3
+m3
+rts
+red *r6
+m4
+not *r1
+stop
+jmp L109
+lea L27, r2
+L41: jmp *r4
+L42: lea L9, r0
+bne *r7
+L43: cmp r3, L27
+jmp L41
+not r1
+m0
+; comment
+sub *r6, *r0
+bne *r6
+L44: .data -189, 316
+stop
+L45: prn #-163
+m1
+L46: jsr *r5
+mov *r6, L0
+
+red r3
+cmp L64, #-59
+stop
+
+lea L15, L80
+L47: .string "cocectzcwh"
+L48: .string "qpruvjgxlhobbanqbz"
+dec *r3
+L49: red r0
+dec *r2
+m3
+L50: not *r0
+inc r4
+m3
+mov L45, L7
+m4
+L51: inc *r7
+mov r3, r2
+m4
+dec L1
+L52: not L13
+sub #-7, *r3
+stop
+prn #119
+m4
+prn #79
+stop
+jmp *r0
+; comment
+clr *r2
+jmp L22
+lea L48, L30
+dec L45
+m4
+m4
+sub r4, L60
+lea L95, r5
+L53: bne *r3
+L54: add L85, r4
+sub *r6, r4
+L55: .string "rbl"
+jmp *r2
+mov r5, r2
+L56: lea L73, r0
+inc r0
+L57: rts
+sub *r4, r5
+L58: jmp L58
+dec L72
+mov r2, L42
+; comment
+
+inc *r1
+m4
+bne L63
+; comment
+jsr *r3
+m3
+red L60
+mov *r6, L54
+m0
+rts
+prn L71
+lea L28, r5
+
+L59: mov *r2, *r2
+dec r1
+m4
+m1
+bne L80
+lea L86, *r1
+stop
+
+L60: .data -551, -687, 653, -355, 757, -901, -78
+rts
+L61: bne L109
+m3
+lea L66, *r4
+
+bne L98
+m4
+inc L55
+stop
+L62: .data 149, 316
+m2
+jmp *r4
+L63: mov #80, *r4
+; comment
+jsr *r5
+cmp r3, r0
+inc *r0
+not L95
+inc r6
+dec r1
+add r4, L20
+m3
+cmp L108, #-173
+sub r4, L76
+dec *r0
+cmp L43, L93
+L64: .string "pwwyydshze"
+L65: .data -339, 297, 932, 468, 449, -334, 529, -213
+m2
+stop
+
+sub L16, r3
+stop
+L66: .string "nujgrla"
+m4
+m4
+jmp L93
+red *r6
+L67: sub r6, *r3
+cmp *r5, L7
+m2
+rts
+bne L37
+mov L29, L31
+inc *r7
+bne *r6
+inc *r1
+sub #18, r3
+add *r0, L81
+dec *r7
+lea L32, *r5
+not r5
+jsr L1
+L68: sub *r2, *r4
+lea L105, *r2
+dec L33
+inc L71
+prn r2
+
+clr r0
+rts
+L69: red r4
+L70: .data 864, -660, 740, -593, -454, 101, -17
+lea L50, L61
+m0
+jsr L91
+prn *r7
+m4
+prn *r7
+jmp L31
+red r3
+red *r7
+m2
+L71: jmp *r5
+L72: prn L78
+add L94, *r7
+sub #-210, r5
+m3
+m2
+sub *r2, r6
+L73: dec r7
+red r6
+mov *r7, L41
+inc L78
+not L11
+stop
+stop
+m2
+L74: prn *r3
+L75: .data -537, -835, 550, -869, 999, 413
+L76: dec *r6
+prn #90
+m0
+jmp L40
+m3
+m4
+; comment
+sub L80, L32
+sub r4, L9
+stop
+dec r1
+L77: .string "zhpywxedombaywocoggzk"
+jmp L69
+L78: .string "gazak"
+m3
+stop
+lea L80, *r3
+L79: mov L98, *r5
+L80: .string "rlvzdmrvijorzs"
+m4
+jsr *r6
+
+inc r4
+rts
+m2
+sub *r2, *r4
+jmp *r4
+L81: prn #222
+m1
+; comment
+m2
+prn r6
+lea L101, L104
+clr L101
+rts
+; comment
+L82: red r1
+bne L15
+L83: .data -469, -412, -459
+jmp L108
+lea L94, L18
+L84: red L17
+L85: not L103
+cmp #-134, *r2
+inc r6
+m2
+sub r4, L81
+m2
+inc *r1
+prn #-228
+lea L1, L103
+not r5
+L86: bne L53
+L87: add *r3, L88
+m4
+jmp *r0
+red r5
+not r1
+m2
+L88: .data 86, 162, 966, -822, -359, 432
+rts
+add *r4, L93
+L89: .data -680, 225, 9, 407, 284
+jsr *r7
+red L24
+rts
+L90: .data -925, -981, 890, -301, 84, 539, 390, -50
+mov L95, *r6
+prn L108
+prn *r5
+m2
+cmp L102, L56
+sub L67, r6
+L91: .string "dlugabdmltnyzhiznfesxx"
+prn L100
+L92: dec r4
+
+inc r7
+dec *r1
+jsr L95
+L93: stop
+jsr *r4
+L94: .data 500, 558
+L95: inc r0
+jsr L64
+L96: .string "iaftwhjerrgtlhnaweto"
+rts
+m1
+L97: .string "eximku"
+L98: .data -601, 440, 467
+lea L43, *r6
+jmp *r3
+not r0
+L99: .string "mistcidsc"
+rts
+
+clr *r5
+clr *r7
+L100: dec r0
+; comment
+L101: sub L10, *r3
+m3
+
+m0
+jmp L34
+L102: .data 322, -158, -218, 961, 289, -125, 660
+m1
+m2
+m2
+m2
+m4
+jmp *r1
+cmp #-118, L6
+
+inc r6
+bne L33
+cmp #161, *r3
+L103: inc r2
+mov #-102, L59
+stop
+m2
+lea L73, L44
+L104: not L74
+stop
+rts
+mov *r3, r2
+L105: dec L87
+rts
+m2
+L106: .string "ngjhqjacgsykh"
+L107: clr L51
+L108: lea L109, *r6
+stop
+m4
+m3
+jsr L109
+L109: lea L47, *r0
+stop
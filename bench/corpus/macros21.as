@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 22
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    prn L70
+    cmp r3, L82
+    jsr L72
+    prn #-135
+    jmp *r4
+    jsr L83
+    jsr *r0
+    red r0
+    clr r0
+    mov L30, *r5
+endmacr
+macr m1
+    dec r2
+    inc *r4
+    dec *r5
+    jsr *r7
+    prn L79
+    prn r5
+    jmp L98
+    sub #-148, *r4
+    add #223, *r4
+    red L92
+endmacr
+macr m2
+    jmp *r6
+    stop
+    lea L61, r6
+    red L45
+    lea L102, L1
+    prn L108
+    not r7
+    sub r2, *r4
+    lea L58, r7
+    inc *r7
+endmacr
+macr m3
+    rts
+    prn L112
+    stop
+    clr *r3
+    rts
+    add r0, L79
+    sub *r3, *r5
+    prn *r7
+    clr L51
+    mov #223, *r3
+endmacr
+macr m4
+    clr r5
+    not *r0
+    jmp L98
+    bne *r1
+    lea L109, L19
+    mov r5, L50
+    lea L24, r6
+    jsr L51
+    prn #-124
+    mov *r5, r5
+endmacr
+m3
+add L18, L42
+L0: jsr L117
+jmp *r1
+L1: .string "ut"
+m2
+m4
+; comment
+L2: not r7
+red *r5
+dec *r1
+L3: cmp *r0, *r5
+add #-175, *r0
+cmp *r3, #-241
+m2
+clr r6
+m3
+L4: mov r0, r5
+m4
+m0
+not *r1
+jmp *r3
+stop
+add *r3, r7
+m2
+jmp L88
+jmp L97
+L5: .string "jppngdrvaoukjkliegkvdlc"
+L6: not r4
+L7: cmp r6, *r0
+bne L6
+add *r5, *r0
+m0
+rts
+add #243, L6
+prn #91
+
+L8: .data 990, 665, -95, -598, -455, 307, -293, 889
+L9: jsr *r3
+L10: jsr *r3
+cmp L4, r6
+mov #-90, r7
+L11: jmp *r0
+L12: .string "qehndqamq"
+m1
+prn r7
+not L6
+inc r7
+stop
+mov *r5, L8
+L13: .data 98, -461, -861, 766
+clr r2
+jsr L31
+jsr *r6
+m4
+L14: .data 110, -166, -642, 69, 505, -967, -805
+stop
+lea L11, r2
+bne *r2
+rts
+clr r3
+; comment
+L15: cmp r6, r2
+jmp *r3
+not L6
+m4
+L16: mov #242, r0
+m1
+mov L106, L65
+not r0
+m4
+dec *r3
+bne *r2
+mov #-57, *r2
+sub r3, r5
+jmp L3
+rts
+clr r3
+cmp L95, r0
+m3
+red L91
+m2
+
+sub #24, *r0
+inc *r4
+L17: clr L14
+red L37
+bne *r4
+lea L60, L83
+m2
+L18: prn #-165
+L19: .data -330, 562, 244, -373, -882, -609, 711
+L20: sub *r4, *r6
+cmp #196, r6
+L21: dec L29
+sub L12, r7
+L22: red L14
+m0
+m4
+jsr L2
+jmp L102
+jsr *r6
+cmp L99, r7
+L23: .data -78, 732, -960, -263
+m0
+lea L46, r7
+
+stop
+mov L8, r4
+L24: clr r1
+add *r3, r0
+L25: stop
+stop
+jsr L2
+stop
+bne L102
+stop
+rts
+jmp *r0
+L26: .data 808, -456, 138, -109, 972, 18
+jmp L69
+m3
+cmp *r3, r2
+
+m3
+; comment
+bne *r0
+L27: not r1
+cmp #-21, *r6
+L28: sub r2, r5
+inc r0
+bne L28
+not *r7
+L29: bne *r7
+
+sub L77, r1
+prn #-193
+L30: add L63, *r6
+m0
+stop
+L31: rts
+L32: stop
+jsr *r4
+L33: .data 235, -363
+L34: bne L115
+m2
+L35: mov r1, *r7
+L36: inc *r5
+L37: .data 798, -883, -545, 124
+m1
+jmp *r1
+red *r7
+jmp *r3
+jmp *r3
+
+add L74, L27
+L38: cmp *r7, *r1
+m4
+L39: add #240, L37
+cmp *r1, L29
+L40: not r6
+bne L41
+L41: jsr L19
+mov #164, r2
+red *r1
+bne L86
+m4
+L42: inc *r1
+m4
+cmp L92, *r5
+L43: rts
+m3
+L44: .data -818
+sub L48, r7
+red *r7
+mov #50, L44
+L45: red *r6
+red L92
+L46: .string "iuvolathn"
+not r7
+
+not L103
+jmp *r3
+m1
+jmp L41
+inc L71
+clr r7
+cmp r4, L114
+red r1
+L47: add L33, L71
+L48: red r4
+jsr L2
+bne *r5
+L49: .data 249, 271, -841, 662, -457
+dec *r6
+not L96
+L50: .data 712, -411, 752, 194
+not L61
+bne *r6
+L51: clr L57
+bne L96
+m1
+m1
+bne *r3
+dec r0
+jsr *r5
+L52: .data -359, -108
+red r1
+stop
+L53: lea L88, r3
+mov L3, r7
+L54: clr *r7
+m1
+clr r6
+rts
+rts
+m0
+dec r0
+inc r6
+inc L20
+prn r2
+lea L112, L39
+red *r1
+m3
+clr L87
+clr r4
+jmp L84
+L55: clr r6
+sub L93, r7
+sub L115, *r6
+m0
+prn *r7
+L56: lea L69, L8
+bne *r4
+jmp *r6
+L57: .string "jjkxe"
+prn L110
+m3
+add #250, r1
+bne *r6
+L58: .string "xfvigtjywbqqizhimu"
+clr r1
+lea L91, *r7
+rts
+jsr *r7
+L59: .data -943, 858, -850, 752, 798, 197, -647
+m0
+stop
+sub #-83, r3
+mov r4, *r2
+m4
+rts
+red *r6
+not r2
+L60: bne L7
+inc *r2
+inc *r6
+m0
+m0
+m1
+dec L103
+stop
+add r7, L89
+red r6
+sub r2, *r4
+stop
+jmp L28
+prn *r0
+L61: prn r5
+m3
+inc *r6
+prn L82
+rts
+L62: lea L26, r2
+not r6
+m2
+not r3
+bne L95
+jmp L87
+L63: red *r5
+not L81
+not r3
+red *r1
+inc *r1
+red r5
+L64: jmp L27
+cmp *r2, #-94
+L65: .data 789, -908, -15, 376, -100, -456
+L66: cmp *r7, *r3
+cmp #139, *r3
+m1
+; comment
+m2
+jmp L69
+; comment
+sub r1, r2
+L67: .data -824, 880, 236, -672, 669
+L68: .data -84, 756, 814, 829
+L69: add *r0, L48
+sub #-13, *r5
+prn L102
+inc L100
+L70: bne *r6
+jsr L41
+L71: inc L109
+inc L67
+stop
+not r7
+cmp L59, L73
+m3
+L72: .data 897, -862, 425, 629, 204
+L73: rts
+sub *r5, r0
+m1
+L74: dec *r7
+jsr *r7
+mov L88, L86
+jmp L89
+cmp L77, r4
+clr L106
+m4
+m0
+L75: .data -895, -571, 973, 124, 254
+stop
+cmp r0, L38
+jsr L34
+L76: prn L10
+L77: bne *r1
+L78: stop
+
+dec *r7
+m0
+bne L28
+cmp *r3, *r7
+L79: jsr *r4
+inc L112
+prn #69
+stop
+L80: rts
+L81: cmp #201, r0
+lea L100, *r4
+rts
+rts
+sub #58, L27
+jsr L90
+L82: jmp *r3
+cmp L85, r4
+clr r3
+dec r5
+prn L98
+L83: mov #189, *r1
+clr *r5
+m3
+; comment
+L84: cmp *r3, L96
+add r2, r4
+prn *r7
+red *r4
+not r2
+not *r0
+jmp *r0
+L85: .data 836, 507, 444, 207
+add L75, L38
+clr *r3
+
+red L114
+m1
+inc *r1
+jsr *r2
+L86: red L100
+
+inc r3
+L87: .string "fapfgidetshemv"
+
+m3
+sub r7, r3
+bne L106
+L88: .string "hwd"
+not *r5
+red r4
+cmp #-168, *r4
+L89: .data -508, 524, 324, 492, -504, -823
+L90: bne *r0
+jmp L44
+stop
+m1
+L91: rts
+L92: .data 99, 707, -326, 686, -735, -428, -296
+red L106
+mov r6, L105
+m2
+sub *r3, *r4
+L93: .string "wu"
+lea L111, *r2
+m3
+not r7
+L94: .data -974, 224, 238, -801, 357, 439, 506
+prn #-185
+L95: .string "ovnkeflvopefppipm"
+stop
+sub #-82, *r0
+clr r0
+L96: inc L58
+stop
+m0
+L97: jmp L30
+bne *r3
+m2
+jmp *r6
+add L111, r2
+L98: mov r4, *r6
+dec L32
+jsr *r7
+L99: .string "br"
+L100: prn #158
+sub *r4, r1
+L101: jsr L109
+L102: .string "gtmgxovvyujbxojugrat"
+bne L21
+m1
+inc *r3
+m1
+mov *r4, L52
+sub L58, r2
+clr *r3
+sub L26, r2
+clr *r1
+not *r2
+prn *r3
+not L102
+stop
+rts
+cmp *r0, #-213
+lea L113, *r7
+L103: bne *r3
+inc *r3
+rts
+L104: not r7
+clr L103
+L105: .string "cgzo"
+jmp *r6
+sub r1, r4
+; comment
+L106: sub *r2, L48
+m0
+m1
+bne L108
+m2
+L107: jsr L117
+jsr L45
+sub *r1, r4
+clr L79
+stop
+L108: bne *r4
+L109: .data 796, 247, 751, 607
+m4
+lea L116, r1
+jsr *r0
+m2
+L110: .string "nc"
+L111: prn r3
+lea L31, L90
+bne L115
+rts
+sub #-2, r2
+mov *r0, r4
+mov *r4, r1
+jsr L117
+red *r2
+jsr L13
+m2
+bne L112
+stop
+m1
+L112: .string "gyrtrzkqlbssrav"
+jmp L4
+m3
+m4
+m3
+prn #244
+bne *r7
+L113: .data 336, -257, 283, -447, -653, -173, -538
+lea L81, L113
+m4
+m0
+L114: .data 214, 156, 433, 702
+
+bne L63
+sub r1, L97
+m4
+stop
+m0
+bne L56
+cmp r3, r6
+L115: lea L117, r4
+m3
+L116: dec r0
+prn L117
+L117: prn *r1
+mov #101, *r1
+stop
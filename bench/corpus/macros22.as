@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 23
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    bne *r0
+    not r4
+    jmp L95
+    red *r6
+    bne *r5
+    rts
+    lea L30, L68
+    jmp L113
+    stop
+    rts
+endmacr
+macr m1
+    bne *r4
+    not L57
+    sub r1, L47
+    sub r5, r6
+    stop
+    jsr L56
+    jsr *r2
+    not L6
+    red L95
+    dec r0
+endmacr
+macr m2
+    rts
+    jsr *r0
+    prn r3
+    sub #122, L104
+    stop
+    add r7, L31
+    cmp #-199, #-212
+    cmp *r4, r0
+    red *r2
+    jmp *r3
+endmacr
+macr m3
+    mov L100, *r5
+    rts
+    jmp L31
+    cmp r3, #184
+    jsr *r5
+    jsr *r3
+    jsr L66
+    mov #-30, r5
+    not L34
+    inc *r4
+endmacr
+macr m4
+    not L100
+    rts
+    sub L10, *r1
+    add L72, L52
+    rts
+    bne *r6
+    add *r4, r6
+    not r6
+    lea L46, L61
+    bne *r4
+endmacr
+clr L53
+L0: jsr L81
+L1: add *r0, L0
+m3
+not *r4
+L2: jmp *r1
+mov *r6, r4
+clr L2
+add #223, L2
+L3: .data -296, -772, 839, 141
+cmp r5, #210
+m0
+sub L21, *r6
+stop
+L4: .string "u"
+L5: .data 703, -535, 141, 162, -457, -376, -207
+bne L100
+cmp L1, *r0
+sub *r6, r5
+mov *r4, L2
+red *r5
+cmp L55, r4
+lea L81, r2
+cmp #-145, *r4
+clr r2
+lea L5, *r3
+m0
+jmp L3
+not r1
+L6: lea L114, L2
+m2
+inc *r4
+; comment
+not L2
+lea L95, L0
+bne L6
+red r2
+bne *r6
+L7: red L7
+L8: clr r7
+m0
+prn *r0
+dec r2
+m4
+L9: mov *r1, L5
+rts
+; comment
+red r4
+sub *r7, r7
+L10: prn L13
+sub #182, r4
+add r0, r2
+jmp L30
+jmp L80
+sub *r1, r2
+L11: rts
+inc *r1
+prn #61
+m1
+L12: .string "ptcpxleevhmnmfqosaudluk"
+stop
+L13: .data -540, -722, 148, 927, 499
+L14: stop
+L15: .data -41, -469, 571, 90, -831, -34, 139, -127
+L16: .string "eirvoojqbnavhmiclr"
+dec r1
+L17: not r1
+bne *r6
+cmp r5, L45
+m0
+add #-35, *r0
+L18: .data 786, -549
+L19: not *r2
+m2
+clr *r7
+; comment
+red L20
+m2
+L20: cmp r3, L33
+L21: mov L9, r1
+lea L77, r0
+L22: .string "ufpiktqfritjuxextcgxemut"
+bne *r2
+L23: bne L102
+m4
+L24: .data 970, -317, -559, 133, -127, -698, 218
+jsr *r7
+L25: stop
+not *r6
+m0
+clr L19
+m3
+inc L43
+jmp L10
+cmp #137, #251
+rts
+m1
+sub L44, r6
+jsr *r7
+L26: mov *r3, L82
+add r5, *r6
+
+m3
+rts
+prn #128
+jsr L69
+inc *r2
+m2
+m4
+stop
+stop
+L27: sub L33, *r5
+m3
+not L64
+lea L5, r0
+L28: dec L71
+m2
+L29: not *r3
+rts
+mov *r3, *r4
+L30: add #-182, *r5
+mov #-26, *r6
+inc *r1
+red *r2
+L31: red *r6
+red *r4
+m3
+stop
+L32: mov L61, *r2
+inc L55
+m1
+dec r0
+red r0
+stop
+clr *r3
+rts
+mov *r2, r3
+lea L37, *r3
+m0
+m2
+m4
+L33: stop
+dec *r3
+bne L61
+L34: not *r3
+rts
+; comment
+L35: bne *r4
+jsr *r2
+cmp r2, *r2
+not r5
+stop
+m0
+dec L40
+jmp *r3
+bne L18
+L36: .string "mo"
+add r1, *r2
+sub r2, L53
+stop
+cmp *r1, *r5
+rts
+L37: .string "uoapxgytdyonlizqoifk"
+add *r0, *r3
+add *r3, *r3
+jsr L94
+L38: bne L92
+clr *r3
+bne *r0
+clr L7
+clr L110
+dec L105
+prn L76
+jmp L78
+m2
+m0
+L39: cmp r4, L16
+m3
+m3
+L40: add r2, *r1
+L41: inc *r1
+sub *r7, L28
+jmp L30
+m3
+prn #89
+stop
+; comment
+L42: sub *r2, L67
+cmp r3, *r3
+
+L43: .data 48, -150, 498, 398, -366
+dec L89
+m3
+sub L72, L75
+lea L21, L77
+L44: cmp *r3, *r2
+inc r5
+L45: rts
+stop
+L46: .data -637, -725, -443, 953
+L47: .data -52, -928, -160, -504, -491, -245
+lea L83, *r6
+dec L89
+jsr *r0
+L48: .data 399
+L49: rts
+m2
+m0
+L50: add #154, *r6
+rts
+m3
+bne L89
+L51: prn *r5
+L52: .string "hlsqrcaryj"
+m2
+L53: inc *r5
+rts
+mov #-225, L103
+rts
+m4
+L54: prn #-41
+L55: .data 821, 31, -279, 306, -956, 831, -901
+sub r7, *r2
+m1
+lea L83, L28
+clr r0
+dec *r1
+L56: mov #105, L74
+m3
+add *r5, L7
+; comment
+L57: .data -474, 667, 868, -939, 44, 505, -337, -401
+m2
+not *r3
+L58: .data -814, 151
+L59: jsr *r2
+mov L66, *r7
+; comment
+jsr *r3
+dec r4
+L60: bne L75
+; comment
+inc L81
+L61: .string "jcbgzhqbkhhpyqinbdiibraj"
+
+L62: bne *r5
+bne L76
+prn *r1
+dec *r0
+m3
+not r4
+L63: cmp r6, L77
+m1
+L64: clr L97
+jsr L62
+L65: jsr L83
+not *r4
+L66: clr r7
+m0
+m3
+L67: rts
+L68: .data -855, 642, -276, -447, 952, -564
+m2
+m3
+jmp *r2
+m4
+m0
+L69: jmp L71
+m3
+inc L53
+sub *r6, L96
+jmp L83
+m0
+inc r6
+m3
+lea L74, L101
+clr r1
+m3
+rts
+m4
+add L72, *r2
+clr *r7
+jmp L93
+dec *r5
+L70: .string "tronavwiob"
+jsr L66
+stop
+lea L61, r6
+rts
+L71: .data 901
+
+sub L113, r7
+lea L24, r6
+sub L98, *r4
+add *r4, L82
+m2
+stop
+not *r3
+L72: red *r3
+m0
+L73: .data 620, 861, -568, 841, -164, 824
+L74: .string "atwavzqsltcsnjw"
+dec *r4
+jmp *r2
+bne L87
+mov *r5, *r5
+not r5
+L75: bne L84
+L76: clr r6
+L77: clr r5
+sub L4, *r3
+m3
+L78: lea L106, *r1
+inc r4
+m0
+bne *r2
+jmp *r0
+L79: .data 193, 69, 506, 18
+mov r3, L2
+L80: .data 306, -385
+not L81
+jmp L31
+L81: jmp L81
+L82: lea L80, r5
+m3
+bne *r4
+m2
+not *r7
+sub r6, r7
+stop
+m2
+stop
+sub L87, r5
+m0
+prn *r3
+add *r7, L53
+jsr *r5
+m3
+inc *r3
+clr r7
+jmp *r1
+m1
+add *r7, L91
+; comment
+clr r4
+; comment
+mov #141, *r0
+L83: cmp #48, #247
+jmp *r5
+rts
+cmp L69, r0
+bne *r7
+L84: .string "bcduequgtamiwqwelvzbn"
+L85: cmp L12, L33
+not r1
+L86: rts
+prn *r5
+m1
+L87: .string "rjmezg"
+L88: rts
+cmp r3, *r1
+L89: jmp L16
+m4
+mov L91, r3
+m3
+lea L7, L84
+inc L104
+sub r1, L16
+clr L111
+lea L5, L105
+L90: .data 708
+L91: .data -890, -322, -803, 899
+L92: .string "ftgojtfxbcnqsugyay"
+lea L104, *r2
+; comment
+stop
+prn L93
+sub *r6, L95
+add #-230, L59
+mov r3, *r1
+add r4, *r6
+bne *r1
+m0
+jmp L107
+
+m4
+m2
+cmp #-194, r2
+m0
+mov L102, r2
+jmp L76
+m2
+mov #-210, r2
+L93: .data -656, 950, -473
+jsr L112
+L94: .string "a"
+L95: .string "rghspkmzwrflolmbntnb"
+cmp r3, L99
+L96: sub r1, L106
+; comment
+red L112
+red r5
+L97: inc r4
+L98: .data -646, -53, 225, -305
+L99: .string "z"
+red r3
+add L106, *r7
+sub *r3, r6
+not L3
+mov #59, r3
+L100: bne L98
+clr r4
+m4
+red *r7
+not r3
+clr *r4
+mov *r1, *r0
+sub *r5, *r3
+jmp L1
+rts
+add r0, L89
+m3
+lea L103, L108
+L101: .data -778, 254, -108, 34, -30, 658, -222, 794
+m4
+sub #-83, L44
+mov r0, L32
+not r4
+m0
+jsr L79
+rts
+lea L8, r5
+rts
+; comment
+dec *r7
+; comment
+L102: .string "ktldaidfzdfuvmykcloyao"
+red L83
+mov #-178, *r5
+
+L103: red *r6
+L104: stop
+m2
+jsr L19
+m0
+cmp #-186, #-9
+L105: clr r3
+cmp *r7, *r7
+
+L106: prn *r5
+L107: .string "cjsakrvbhbdfmpg"
+L108: .string "yp"
+jmp *r4
+L109: not L42
+red *r4
+m4
+lea L20, *r6
+sub #-131, *r6
+m2
+m3
+dec r4
+sub *r2, L110
+m3
+cmp L58, *r4
+red r1
+L110: rts
+jmp *r0
+inc L0
+prn *r1
+rts
+inc r1
+add r4, r7
+dec r2
+lea L111, *r4
+m2
+stop
+rts
+mov L87, *r3
+rts
+cmp L71, r3
+rts
+cmp *r3, *r4
+not L112
+stop
+cmp L114, #72
+prn *r3
+m2
+add #167, *r5
+not *r3
+L111: inc *r6
+bne L108
+L112: sub L87, L23
+
+L113: jsr *r5
+bne L114
+add *r2, *r3
+stop
+m4
+m0
+L114: .string "vmdlzq"
+stop
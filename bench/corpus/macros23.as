@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 24
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    prn r0
+    mov *r5, L17
+    mov *r5, L51
+    stop
+    inc L64
+    jsr *r1
+    mov L105, L51
+    inc *r1
+    rts
+    jsr *r5
+endmacr
+macr m1
+    stop
+    lea L51, L91
+    jsr *r7
+    bne L34
+    add L116, r6
+    cmp r7, #-210
+    rts
+    prn L22
+    clr r4
+    bne *r3
+endmacr
+macr m2
+    jsr L19
+    dec L111
+    red *r6
+    dec L35
+    add #83, *r5
+    prn #234
+    rts
+    clr *r2
+    add r7, r2
+    prn #19
+endmacr
+macr m3
+    cmp r3, L41
+    rts
+    bne *r4
+    lea L106, r5
+    sub *r6, L33
+    not *r1
+    dec r4
+    jmp *r4
+    not r6
+    rts
+endmacr
+macr m4
+    prn *r3
+    inc *r7
+    lea L31, *r5
+    red *r3
+    jsr L25
+    sub *r4, r5
+    clr *r5
+    prn r4
+    jmp *r0
+    clr *r7
+endmacr
+m3
+L0: prn *r7
+not *r7
+sub *r4, L16
+m4
+m2
+L1: cmp *r3, #-133
+add L0, r0
+L2: jmp *r3
+m0
+inc r6
+not *r3
+m2
+mov #-165, L1
+add *r3, L2
+L3: jsr L43
+m4
+lea L29, r3
+L4: .string "azev"
+rts
+cmp #-155, #160
+jsr *r1
+L5: cmp #-153, #-75
+L6: .data -153, 523, 908, 121
+m2
+inc L78
+not L73
+jmp L18
+bne L36
+prn L3
+bne L6
+jsr L65
+L7: sub r7, L69
+dec L25
+lea L108, r1
+red L12
+m1
+not *r2
+; comment
+m0
+prn L116
+mov L4, r6
+; comment
+bne *r0
+m1
+L8: jmp L28
+L9: red *r6
+sub r6, *r6
+L10: clr r4
+add #40, *r6
+lea L10, L47
+L11: .string "xcbefdfq"
+mov L0, r3
+clr *r2
+add #-34, r6
+stop
+sub *r1, r7
+m1
+cmp #63, r2
+dec L2
+clr *r7
+jmp *r0
+bne L101
+L12: not L12
+L13: .string "mrqabgrelt"
+m4
+stop
+bne *r5
+m1
+stop
+add *r7, r3
+L14: .data 958, 464, 20
+lea L0, *r4
+red *r2
+not *r5
+inc r0
+rts
+clr L4
+dec r3
+L15: not *r0
+m0
+lea L47, *r3
+L16: .data 162, -432, 610, -267, -960, -15
+jmp L91
+clr L16
+cmp *r2, r1
+m1
+inc L4
+red L111
+dec *r5
+m4
+jsr *r1
+clr L15
+dec r3
+jsr L6
+L17: not r4
+sub #-98, r7
+dec r7
+prn #-80
+m1
+add r6, *r5
+jsr L101
+; comment
+sub L9, r6
+dec r0
+m2
+m1
+dec L8
+add r1, *r6
+stop
+jsr *r0
+cmp *r7, #4
+jmp L3
+L18: bne L8
+m0
+L19: red r6
+L20: .string "vxefuymiwhlvprwjqgbqe"
+m4
+L21: lea L2, r5
+inc L4
+clr *r1
+L22: rts
+inc r4
+clr L117
+stop
+lea L18, L17
+inc r5
+prn #-187
+rts
+clr L84
+sub #-185, *r1
+L23: .data 479, 364
+jmp *r0
+m0
+L24: .string "vgghgftegi"
+jmp L48
+add *r5, r6
+inc r6
+L25: .string "dtomgdophpjjkxqq"
+cmp L108, #94
+L26: .data -755, -932, -333, 604, -248
+lea L49, r1
+m4
+m2
+L27: sub *r6, L57
+m3
+lea L1, *r7
+L28: red L15
+cmp #102, *r3
+mov #196, L38
+L29: red *r5
+jsr *r6
+; comment
+rts
+m3
+jsr *r7
+add L57, L59
+not L105
+rts
+; comment
+L30: clr r5
+inc r3
+inc *r7
+clr L20
+add *r2, L40
+mov #220, *r6
+stop
+prn #1
+cmp #-249, #-254
+prn *r0
+L31: not r6
+add *r4, *r7
+L32: .data 869, 400, -604, 336, -411
+L33: .data -538, 691, 47, 57, 446, 416, 980
+L34: stop
+L35: stop
+cmp r5, L10
+red L23
+m4
+m0
+; comment
+dec r1
+sub *r5, *r2
+add L20, L7
+dec L33
+L36: .string "jwd"
+L37: .string "ouipi"
+lea L29, *r3
+prn *r3
+jmp L30
+L38: .data 70, 594, 770, -855, 661
+L39: .data -668, 624, 19, 374, -40, -123
+bne *r6
+stop
+clr L34
+L40: .string "ulrdprngojxvonphkgxxko"
+jsr L18
+inc L104
+; comment
+m4
+L41: rts
+not L0
+L42: bne *r3
+L43: lea L35, *r1
+prn r5
+cmp r4, r0
+dec r6
+prn *r4
+inc r0
+clr *r5
+L44: jsr L103
+L45: add #-6, L40
+prn L63
+prn #-76
+clr r7
+add L28, r5
+add r0, L32
+add #221, r7
+lea L74, r3
+bne L23
+rts
+add r4, r0
+prn #-82
+L46: .data 653, 529, -462, 389, 373, 386
+lea L50, r0
+L47: .string "aqepwa"
+L48: .string "qzapgqmz"
+; comment
+m3
+
+lea L116, r2
+stop
+lea L6, L16
+L49: .string "rgefgayorlmaimwhpvg"
+
+red *r6
+m4
+; comment
+red L80
+lea L6, *r2
+lea L85, L47
+inc *r6
+L50: .data -271, -894
+m0
+add *r7, L32
+rts
+L51: .data 291, 24, -756
+rts
+rts
+L52: .data 736
+L53: cmp #21, L16
+red r7
+L54: jmp *r1
+L55: .data -980, -809, 114, 226, -662, 807
+m1
+L56: jmp *r2
+inc L94
+m3
+dec *r5
+m4
+L57: .string "jdnombtzphjfk"
+m2
+; comment
+L58: clr L112
+m4
+dec L48
+m2
+sub *r1, *r2
+L59: cmp *r0, *r2
+inc r1
+m4
+L60: bne *r6
+m3
+L61: .data -797, 961
+jsr L108
+L62: clr *r3
+jmp L4
+red r3
+rts
+m1
+inc *r5
+jsr *r3
+L63: .data -799, 145, -295, -675, -220, 980, 66, -931
+L64: stop
+L65: rts
+inc *r2
+bne *r2
+L66: not L8
+jsr L119
+cmp r2, #-119
+dec r6
+; comment
+lea L42, r4
+L67: add L15, *r0
+m0
+L68: mov #-63, L101
+clr *r7
+m3
+L69: sub #-40, r7
+prn L32
+m0
+m3
+L70: jmp L109
+inc L11
+bne *r7
+m3
+bne *r1
+L71: dec *r1
+cmp *r3, r4
+inc *r0
+m0
+bne L28
+L72: mov #-75, *r6
+L73: .data -205, 732
+m3
+L74: mov *r3, L30
+mov L17, L84
+mov *r3, *r7
+prn *r7
+m3
+L75: .string "llrgmdafsxubukxl"
+m3
+sub #110, *r7
+not L118
+inc L34
+L76: jsr L81
+m2
+add L58, *r4
+m1
+jsr L54
+clr L0
+rts
+L77: .string "wfubvfyxyqffepuaiihpz"
+L78: cmp r6, *r1
+m4
+m4
+lea L88, *r0
+jmp *r6
+prn L41
+jmp L118
+prn L32
+mov #24, r3
+stop
+stop
+cmp L39, L21
+clr L83
+L79: .data -327, 409, 748, 976, 119, -190
+m3
+; comment
+m1
+m2
+stop
+sub *r4, *r3
+L80: inc *r1
+m3
+jmp L69
+red *r2
+cmp *r5, r5
+jsr L7
+m4
+not r7
+mov #-53, L75
+jmp L72
+dec *r4
+m1
+not r6
+L81: bne L87
+sub L67, L60
+jmp L33
+m1
+L82: .data 803, 270, 732, -170, -876, -433, 346, 57
+mov L116, r6
+cmp r6, *r6
+jmp *r3
+cmp *r2, r2
+add r4, L111
+m3
+lea L18, *r1
+prn r1
+jsr L55
+; comment
+red *r6
+dec r7
+prn *r5
+sub #178, L117
+add #-211, r3
+stop
+L83: .string "fgyvdlpqyrteifxugvrmkw"
+L84: not r0
+m0
+prn *r6
+prn *r2
+L85: not *r6
+L86: .string "zwvfhpbttlqfrvqfulnklx"
+
+cmp L55, r0
+jmp L15
+rts
+L87: mov #-114, r3
+L88: inc L116
+rts
+mov *r6, r4
+L89: jsr L35
+L90: jsr *r7
+m1
+L91: .string "jznhkowxflpzpmlmcumqx"
+m3
+L92: .string "akek"
+m4
+L93: jsr *r1
+stop
+m0
+cmp r2, L110
+mov L117, r4
+m1
+L94: .string "ofnsxvnqvxrgpfjkpiolqtb"
+clr *r5
+
+dec L57
+L95: mov r2, *r4
+L96: jmp *r6
+L97: not r5
+L98: .string "fexrznejgrhtpbhfvefvz"
+L99: mov r5, r6
+m0
+bne L117
+L100: .data 916, -485, 693, 255, -473, -730, 858, 829
+cmp L113, L16
+L101: .string "zxqkoaikcw"
+L102: .string "tsynzthojuk"
+m1
+m2
+L103: rts
+bne L105
+m1
+m0
+cmp *r5, #128
+stop
+m0
+L104: .data -593, 668
+m2
+L105: mov L69, *r4
+not L68
+dec *r5
+; comment
+L106: .data 953, -729, 779, -365, -990
+L107: .data 462, 323, -453, -180, -627, -53
+red L37
+add *r4, r5
+L108: .data -205, -723, -582, -143, 744, -607, 214
+rts
+L109: .string "waquausdlcphdhhwborigkkv"
+m3
+L110: cmp r0, L116
+not *r6
+L111: .data 442, -780, -387, -753, 23, -419, -921
+m0
+jsr *r0
+jmp *r3
+L112: .string "mczvoukesmollcgt"
+clr r0
+lea L52, *r1
+m4
+add #22, r2
+stop
+m3
+m3
+m3
+add *r2, r2
+not *r5
+L113: prn #1
+L114: clr L111
+jsr L90
+dec *r2
+; comment
+sub #43, L115
+L115: .data -633, -908, 294
+m4
+L116: stop
+L117: rts
+jsr L62
+not L58
+L118: .data 12, 491, 768
+m2
+rts
+m4
+m3
+m4
+add #-108, L19
+m2
+m0
+jmp *r0
+lea L119, *r7
+cmp L95, r0
+m4
+
+mov r5, r6
+clr r4
+L119: cmp L36, r2
+add #117, *r4
+stop
@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 25
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    jmp L9
+    prn L34
+    cmp r4, *r5
+    inc *r4
+    add #238, L32
+    bne L50
+    lea L19, r4
+    prn L8
+    cmp #-192, *r3
+    mov r3, r2
+endmacr
+macr m1
+    stop
+    not r1
+    sub r7, L59
+    sub L55, L35
+    jsr L34
+    inc *r5
+    jmp L13
+    bne L20
+    prn #223
+    prn r0
+endmacr
+macr m2
+    not *r6
+    jmp *r6
+    rts
+    mov r5, *r6
+    inc r0
+    sub L105, *r1
+    stop
+    red *r5
+    bne L12
+    mov r5, r4
+endmacr
+macr m3
+    jmp *r2
+    add #-194, r6
+    clr r7
+    dec r5
+    mov L98, r7
+    bne L82
+    mov L69, *r5
+    clr L47
+    rts
+    prn *r3
+endmacr
+macr m4
+    rts
+    add #107, r6
+    rts
+    stop
+    clr L37
+    jmp *r3
+    add *r1, *r5
+    cmp #216, *r5
+    stop
+    bne *r7
+endmacr
+not r4
+m4
+m3
+cmp L6, r2
+m2
+lea L35, *r0
+m0
+L0: not r1
+
+; comment
+add L0, *r7
+dec r1
+jmp L108
+jmp *r7
+dec r6
+L1: cmp L20, #-193
+L2: lea L61, *r7
+add #108, r0
+stop
+mov r4, *r5
+L3: .string "wradbeuxtsmfgufpt"
+add *r5, L0
+inc *r0
+L4: add L83, r7
+m2
+L5: .string "rhgqofju"
+m2
+red *r1
+bne L4
+bne *r6
+add *r4, *r0
+cmp r0, L2
+L6: .data 6, -411, -614
+lea L61, r6
+L7: rts
+red r4
+L8: prn *r4
+rts
+L9: .data 929, -524
+stop
+jsr L3
+
+red r1
+jmp *r7
+stop
+red L36
+L10: stop
+L11: .string "jk"
+L12: mov #-111, *r7
+cmp r0, L79
+m0
+m3
+L13: .string "lhdvsvewezemjkv"
+mov L1, L85
+L14: add *r2, *r3
+m2
+add r3, *r6
+dec L91
+m2
+L15: .string "mnuztavzsxovypvyqh"
+prn #209
+L16: red r1
+L17: .data -861, 543, -924, -38
+cmp r6, #-143
+clr L4
+L18: .data 416
+L19: red *r1
+L20: clr r5
+add L59, r2
+red L26
+prn r7
+L21: .data 755, -149, 499, 817, -755, 934, -415, -141
+bne *r3
+lea L19, r1
+sub #-252, L94
+m0
+m0
+m3
+L22: .string "g"
+
+dec r0
+sub r6, *r1
+not L21
+m2
+lea L36, L69
+jsr L20
+m2
+cmp #-4, *r5
+stop
+prn *r6
+inc r6
+dec L7
+m4
+red *r5
+sub *r5, *r0
+L23: sub #156, *r3
+sub *r5, *r2
+bne *r4
+clr *r0
+sub L19, r7
+jsr L63
+m3
+L24: bne *r4
+stop
+rts
+m1
+mov #-125, L28
+L25: mov r2, L91
+m4
+jsr *r2
+prn r2
+L26: .data -284, -190
+jmp L84
+cmp L19, *r2
+sub L107, *r0
+sub L55, L65
+m4
+prn L54
+bne L20
+clr r4
+add L25, *r5
+lea L93, L11
+mov r6, *r1
+m3
+dec r4
+L27: lea L108, *r3
+clr r6
+m3
+m1
+inc r3
+L28: jsr *r6
+lea L26, r5
+rts
+inc L4
+dec *r7
+mov #-245, r3
+m1
+prn r1
+jsr *r3
+jsr *r5
+L29: .data 322, -882, -303, 105, -984, 450, -408, -87
+L30: rts
+bne *r2
+lea L2, L105
+jmp *r2
+L31: sub L107, r1
+rts
+L32: mov #202, *r4
+
+mov *r4, r0
+L33: jsr L17
+m0
+clr r3
+clr r4
+m3
+not *r0
+jsr *r5
+L34: .data 867, -637
+; comment
+L35: .data -539, -190, -947
+m4
+m3
+m4
+add r3, L53
+L36: clr r5
+L37: inc L33
+not L1
+sub *r5, *r5
+cmp L95, #248
+mov r3, *r0
+stop
+red *r3
+inc r5
+inc r0
+stop
+red r3
+rts
+clr L87
+L38: clr r3
+rts
+
+not *r1
+inc r4
+m3
+L39: lea L60, *r7
+L40: inc *r1
+bne L12
+m1
+L41: clr *r7
+dec r0
+rts
+m3
+
+jsr *r2
+not r6
+L42: red L71
+L43: mov *r1, L61
+cmp r2, r1
+m4
+; comment
+m4
+bne *r2
+red *r2
+; comment
+sub L37, r6
+bne *r4
+L44: .data -643, -291
+L45: .string "sftpuzzier"
+m0
+cmp L90, r1
+L46: bne *r5
+jmp *r6
+m3
+inc *r0
+lea L8, L9
+jmp L45
+L47: red L24
+bne *r2
+not L91
+mov L70, *r4
+L48: .string "brupmgqztlnmyanor"
+rts
+
+sub r7, r7
+inc *r6
+L49: .string "qjsxiqpvkuafqdmrwfq"
+m3
+L50: .data 524
+m1
+jmp *r5
+dec *r3
+mov r4, r4
+prn r0
+bne L58
+bne *r5
+; comment
+m3
+rts
+cmp r4, #152
+clr L12
+L51: .string "rilypssumdplrcybtuwmkc"
+m3
+m1
+m3
+stop
+L52: .data -169
+L53: .data -56, -43, -959, 241, -24, 743, -582
+jsr *r1
+bne *r3
+dec L98
+jmp L74
+m3
+red *r2
+jsr *r2
+stop
+L54: .string "clajkuqzcoqbsmh"
+sub *r1, L13
+jsr *r5
+cmp r3, *r0
+L55: cmp #6, *r5
+bne L10
+L56: clr *r3
+bne *r6
+; comment
+L57: dec r3
+
+m0
+not r5
+L58: mov r6, r7
+jsr L32
+sub #98, L38
+not *r1
+m3
+L59: .data 727, 58, 589, 370, -752
+inc r6
+red r5
+m4
+rts
+add *r1, L96
+
+L60: cmp r5, #85
+mov *r2, *r4
+clr L44
+sub r4, L18
+L61: mov #-86, L44
+bne L49
+jmp L81
+m4
+mov r5, L68
+jmp *r3
+lea L4, *r0
+prn r7
+L62: .data 795, 944, 610, -796, 359
+jsr *r5
+m1
+L63: prn r7
+not r5
+m4
+inc r6
+cmp r7, *r0
+m3
+m0
+m2
+L64: jmp *r7
+m0
+m1
+prn *r7
+bne *r5
+m0
+prn *r3
+not r7
+inc L51
+jmp *r5
+L65: clr *r4
+L66: mov r2, r0
+not r6
+stop
+rts
+jsr L76
+sub r6, L96
+L67: rts
+clr *r5
+dec *r7
+L68: lea L32, r7
+bne L60
+L69: .string "dqjbfdlvibxbpldr"
+jmp L98
+; comment
+sub L2, *r0
+m1
+m0
+red L42
+not *r3
+not r1
+inc *r1
+L70: .data 725, 622, 764, 544, -484
+L71: .data 663, -476, -590
+not r2
+m0
+bne *r3
+m4
+cmp r2, L99
+mov #253, *r3
+add #-18, *r3
+m2
+red r2
+m4
+L72: inc r3
+L73: .data 96, 926, -373, -387, -459
+cmp *r4, *r0
+L74: .data -340, -337, 434, -408, -657, -337, -654
+prn #53
+add L66, r0
+bne L56
+mov *r1, r6
+L75: not L96
+bne L106
+sub *r3, *r5
+cmp #-228, r5
+L76: .data -761, 972, 775, 365, 558, -65, -446, -502
+add #34, r2
+m4
+inc L23
+dec *r1
+L77: dec *r7
+cmp r4, *r6
+m1
+lea L93, r7
+mov #102, r7
+L78: stop
+inc *r2
+m2
+L79: mov L104, *r1
+L80: red r3
+m2
+dec *r5
+bne L88
+dec L104
+prn L98
+L81: .data -800, -299, 894
+L82: jmp *r3
+dec L5
+L83: jmp L53
+L84: red L61
+jsr *r3
+red r4
+cmp *r3, #17
+not r5
+jsr L54
+L85: clr L21
+m2
+
+jmp L91
+jsr L16
+rts
+sub r4, r4
+; comment
+L86: cmp r1, *r2
+rts
+jmp L44
+mov L104, *r0
+sub L17, L91
+L87: .data -553, 110, -628, -286
+bne *r1
+mov r1, r6
+m4
+L88: .data -256, 168, -314, 989, -895, 17, 81
+lea L101, L2
+m2
+m4
+L89: .data -339, -564, -689, -354
+L90: inc *r7
+dec L29
+
+stop
+add r3, *r6
+L91: bne *r5
+
+lea L3, L100
+m3
+
+rts
+mov r1, L0
+jmp L92
+m0
+prn *r1
+dec r2
+not L55
+clr r5
+sub *r2, r1
+m0
+sub r4, *r6
+mov r5, *r4
+bne *r1
+bne *r7
+m0
+inc L84
+L92: jmp L63
+m1
+m4
+L93: inc *r5
+m3
+mov *r1, *r7
+L94: .data 837, 357, 154, -579, 929, 884, -548, -980
+jmp L108
+add L75, *r7
+sub r1, L9
+jmp *r5
+m0
+not *r4
+L95: .string "qgkyyakifbriybxahleqoce"
+m4
+jmp *r1
+stop
+lea L99, L65
+stop
+L96: bne L101
+m1
+L97: inc *r4
+inc L105
+; comment
+L98: mov *r1, r5
+L99: prn #195
+
+prn L105
+m3
+stop
+jsr *r3
+red r5
+L100: bne *r7
+jmp L2
+stop
+jmp *r6
+jmp *r4
+L101: .data -646, 555, 210, 241, -899, 52
+jsr L108
+not *r4
+L102: jmp *r0
+rts
+m0
+red *r2
+inc r0
+L103: clr r7
+L104: .data 960, 622, 186, 850
+; comment
+m1
+stop
+L105: .data -285
+clr r3
+jmp L108
+m4
+L106: cmp *r1, *r2
+L107: .string "gkjysrhrpfxlowoka"
+L108: .data 35, -867, 210, -844, 756, 988, 590
+L109: cmp r6, *r4
+prn #130
+L110: jmp L111
+rts
+L111: stop
+cmp r1, r4
+stop
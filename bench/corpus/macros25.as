@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 26
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    jmp *r3
+    rts
+    inc r2
+    sub L101, *r2
+    stop
+    sub r2, L76
+    jsr *r7
+    red *r0
+    rts
+    jmp L84
+endmacr
+macr m1
+    sub L40, *r0
+    bne L102
+    prn L114
+    mov r1, L56
+    sub #1, *r6
+    bne L50
+    not r5
+    not L33
+    prn r3
+    clr L83
+endmacr
+macr m2
+    red *r1
+    jmp *r0
+    clr r4
+    inc *r1
+    jmp *r7
+    prn r6
+    mov *r2, r2
+    bne *r2
+    mov #112, r2
+    red *r2
+endmacr
+macr m3
+    prn r6
+    jmp L33
+    jsr L28
+    sub r3, *r4
+    cmp *r5, *r0
+    clr r3
+    cmp L32, r4
+    bne L50
+    sub L51, *r4
+    lea L100, *r3
+endmacr
+macr m4
+    sub L87, *r1
+    cmp *r0, *r6
+    not r3
+    clr *r0
+    stop
+    rts
+    add #165, *r3
+    inc r4
+    stop
+    red L93
+endmacr
+stop
+rts
+L0: red L69
+
+m2
+prn L18
+rts
+bne L0
+inc r4
+jsr *r7
+dec L80
+L1: .string "hyxsmcnyshdyyitbnqjcn"
+cmp L1, *r4
+rts
+m4
+lea L0, r5
+not L1
+not r0
+stop
+L2: .string "noorxjchwkitpr"
+lea L2, *r2
+cmp r5, *r7
+rts
+jsr *r5
+jsr L0
+
+bne *r6
+m3
+m0
+rts
+sub *r5, r4
+lea L45, L116
+sub r5, L1
+mov *r4, r4
+L3: mov #10, *r0
+bne L33
+L4: .data 73, 880, -205, -415, 404, 327, -115, 919
+lea L16, *r7
+sub r0, L12
+L5: .string "zexbotauttuqcjdruum"
+m2
+
+m1
+m0
+L6: .string "fbaxkdhhyj"
+inc r4
+m1
+sub L15, L94
+L7: .string "xtowliugqcjyx"
+L8: .string "sxxjpr"
+not L18
+L9: .string "jtc"
+jsr *r0
+; comment
+stop
+L10: .string "zl"
+stop
+jsr L104
+L11: .data 12, 458, 110, -775
+L12: stop
+L13: prn *r4
+clr *r5
+L14: jmp L109
+
+jsr L11
+m1
+red r7
+dec L39
+L15: lea L115, *r3
+sub r5, r6
+prn *r4
+m3
+m4
+cmp #-112, r2
+L16: .data 183, -720
+L17: inc L91
+add #200, L47
+lea L6, L17
+bne *r4
+lea L41, L38
+L18: sub *r0, *r0
+L19: dec L18
+L20: add r0, r5
+m4
+mov r5, *r2
+L21: stop
+not *r0
+jsr L9
+mov *r0, L18
+dec r0
+m4
+clr *r6
+dec *r4
+stop
+jsr L56
+; comment
+add *r5, r6
+mov r5, L68
+m4
+bne L20
+L22: .data 280, -672, 148
+lea L7, r6
+clr r4
+red r5
+prn *r1
+add L35, L20
+m4
+L23: bne *r1
+m1
+jmp *r2
+L24: stop
+sub #65, L0
+dec L4
+m4
+cmp r0, r3
+L25: jmp *r5
+m2
+mov r4, L13
+L26: stop
+m1
+L27: rts
+jsr *r4
+cmp *r1, #33
+not r7
+m1
+m0
+jmp *r0
+mov L51, r4
+m1
+jsr *r3
+add *r6, L91
+L28: .string "xrkqimjdqglmceojgcf"
+inc L94
+L29: .data -154, -150, 708, -158, -370
+lea L9, r5
+prn #117
+L30: clr r3
+clr *r5
+add r0, r2
+bne *r0
+lea L10, r0
+L31: .data -556, 704, 812, 675, 363, -535
+m0
+
+prn r5
+bne L20
+clr r1
+mov *r0, L79
+lea L91, *r5
+clr *r3
+clr r2
+mov *r2, r3
+L32: .string "hdmm"
+jmp *r1
+L33: dec r7
+L34: add r2, r0
+L35: jsr *r2
+L36: add r2, *r6
+clr *r5
+m3
+L37: .data -751, 753, 707, -735, 110, 132, 95, -8
+sub *r2, r2
+m1
+m0
+L38: .data 878, -506, 876, 618, 716
+jmp *r1
+prn #199
+m3
+
+m0
+not *r1
+clr *r5
+L39: .data 645, -95, 716, 598
+mov r4, r6
+jmp *r3
+not *r0
+lea L46, L83
+stop
+m1
+lea L7, *r5
+red r7
+m1
+sub #-109, *r3
+red *r1
+L40: rts
+L41: .data 887, 421, -882, 86, -169, -718, -277, -556
+jsr *r7
+L42: lea L39, *r6
+L43: jsr L13
+not L13
+rts
+L44: not r0
+lea L40, *r1
+L45: .string "tcyrbxugnzjaeddbod"
+m1
+red *r0
+jmp L65
+L46: jsr *r2
+cmp r6, L31
+rts
+L47: lea L87, r1
+dec r4
+L48: .data 849, 955, -942, -609, -401
+jsr L77
+m4
+
+cmp L18, #24
+red r6
+L49: .string "qogko"
+m1
+m0
+L50: .data -555, -135, -223, -706, 439
+L51: .data -336, -223
+m2
+L52: .data -350, -782, 685, 151, 206, 546
+m2
+add L47, r4
+jsr L101
+prn *r2
+m0
+m1
+stop
+bne *r3
+m3
+clr *r4
+m2
+lea L57, L109
+cmp L17, r1
+L53: jsr *r2
+lea L30, r3
+sub L31, L30
+stop
+rts
+m3
+L54: jmp L81
+clr *r4
+m0
+L55: .data 156, -852, -750
+add r2, r0
+cmp *r6, r5
+L56: .string "mla"
+m2
+m3
+L57: .string "gasknstghnslzovcjsv"
+L58: clr r4
+cmp L21, #143
+m0
+; comment
+prn *r4
+m4
+inc L22
+rts
+cmp L45, *r3
+dec *r3
+mov #-15, L21
+dec *r7
+bne *r3
+L59: not r3
+m2
+cmp *r0, *r2
+mov *r5, *r4
+L60: clr L11
+not *r3
+rts
+L61: cmp #-213, r6
+clr L86
+m0
+dec *r2
+inc r2
+dec r0
+L62: .string "kxizfjkcaugmzlu"
+bne L110
+m1
+stop
+L63: not L77
+lea L114, r6
+dec L105
+m0
+clr L36
+L64: dec r4
+mov #173, *r2
+mov r1, L98
+sub r2, r0
+m1
+m1
+rts
+mov *r5, r7
+jsr L53
+clr L2
+L65: .data -333, 786
+stop
+L66: .data 356, 28, -97, -970
+L67: .data 350, 508, -82, 781, 463
+bne L98
+L68: lea L11, r3
+mov #-110, r6
+inc L25
+jmp *r3
+dec *r2
+prn r0
+L69: red r1
+sub r4, r7
+L70: prn #226
+m1
+lea L51, r4
+jsr *r2
+clr L77
+sub L75, L106
+jmp *r3
+add *r4, *r3
+bne *r5
+jmp L36
+m2
+m3
+; comment
+m3
+m4
+m1
+m1
+bne *r2
+m2
+rts
+L71: rts
+clr L52
+m0
+
+L72: .data -493, -859, 20
+L73: .string "naszqvl"
+rts
+m4
+jmp L90
+stop
+bne L94
+L74: .string "vm"
+jsr L116
+inc *r5
+; comment
+m4
+m1
+L75: .data 227, -956, 896, 273, -727, -868
+mov r4, L95
+rts
+red *r7
+L76: .string "cynipdmqtqjbzvyjnlescmmg"
+jsr *r5
+L77: jmp L53
+L78: rts
+bne *r1
+cmp r7, #10
+; comment
+clr L40
+L79: red L98
+m2
+L80: mov #56, r3
+jsr *r5
+cmp #-208, L103
+m3
+m4
+red *r6
+not *r5
+sub L3, *r2
+mov r3, L29
+mov #-116, *r7
+mov L96, r3
+jsr L116
+L81: .string "gurjuvdn"
+add L95, L94
+dec *r5
+lea L95, r6
+jsr *r2
+jmp *r2
+cmp *r1, #-224
+mov #236, r0
+L82: .string "gilo"
+L83: .string "asbsosfskycvfcgzvdgkgsnn"
+m2
+L84: .data -417, 98, -306, 195
+red *r5
+L85: .string "myicuiezzm"
+m0
+dec L102
+rts
+prn r3
+m4
+m1
+jmp L51
+bne L91
+inc *r2
+jsr *r7
+L86: red r4
+m1
+stop
+L87: .data 561, 830, 618
+L88: cmp *r6, *r3
+L89: .string "hhqsmxukiwy"
+add L98, *r5
+L90: .string "gfegmbwqrginrrpqh"
+L91: lea L111, r1
+L92: jsr L99
+L93: bne *r3
+L94: red L24
+sub L53, L61
+m1
+L95: .string "w"
+m2
+cmp L116, r7
+L96: dec L104
+L97: .data 924, 498, -36, -783, 353, 447, -998
+bne *r1
+L98: not r5
+L99: .data 510, -339, -288
+rts
+L100: .string "uunvsneflidhp"
+rts
+stop
+red r4
+dec r6
+L101: .data 508, -626, 401
+m2
+m0
+stop
+rts
+jsr *r0
+prn #-101
+mov r6, r4
+m3
+; comment
+L102: .string "wuwylrpuujozdxadcpl"
+not *r4
+not L47
+dec *r2
+L103: jsr *r3
+rts
+jsr *r6
+jsr *r5
+m3
+rts
+L104: .data -665, -763, 76, -665, -677, -815, -566
+sub *r6, r3
+L105: not r4
+stop
+m2
+m1
+mov #-183, *r2
+jmp L44
+L106: add L73, *r5
+L107: inc *r1
+m3
+L108: inc *r2
+dec L79
+red *r7
+lea L114, *r2
+dec r4
+m0
+lea L109, r6
+dec L112
+inc r6
+L109: not L116
+stop
+lea L116, L31
+jmp *r3
+m1
+m1
+dec r2
+not L45
+L110: .data 351
+
+dec r5
+jmp L13
+L111: .string "biessodjjqcxa"
+m1
+lea L113, L116
+jsr L13
+; comment
+L112: jmp *r5
+m1
+not *r6
+m1
+sub *r1, *r4
+bne L116
+lea L20, *r3
+bne L78
+red r0
+m0
+not L116
+L113: add r4, L82
+stop
+bne *r1
+L114: red r6
+m0
+dec *r2
+lea L62, *r5
+dec *r0
+cmp *r4, #-181
+L115: .string "mk"
+L116: not L54
+m1
+m4
+m4
+m0
+stop
@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 27
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    add r5, L91
+    lea L16, r7
+    bne L5
+    jsr L70
+    lea L81, L40
+    stop
+    sub L99, r0
+    jmp *r0
+    mov L119, L50
+    jsr *r7
+endmacr
+macr m1
+    lea L38, r3
+    jsr L40
+    add #-246, *r3
+    inc *r1
+    prn *r2
+    prn #216
+    mov L89, r6
+    mov r2, r6
+    cmp r7, *r4
+    sub L24, *r3
+endmacr
+macr m2
+    not r2
+    stop
+    bne *r6
+    bne *r0
+    red r1
+    rts
+    add r7, L70
+    bne *r3
+    bne L32
+    bne L91
+endmacr
+macr m3
+    mov #-200, L76
+    mov #-80, r7
+    sub #88, *r0
+    cmp L74, #-25
+    rts
+    inc L66
+    stop
+    stop
+    prn #239
+    add *r1, r5
+endmacr
+macr m4
+    add *r5, *r5
+    lea L64, L74
+    clr L16
+    rts
+    lea L107, r4
+    prn L118
+    sub L41, L36
+    not r3
+    red r2
+    cmp L79, *r3
+endmacr
+jmp L119
+
+m1
+bne L78
+m3
+prn *r5
+L0: .data -755, 6, 609
+inc L0
+m4
+m2
+rts
+L1: red r6
+L2: lea L21, r3
+m1
+L3: .string "k"
+jsr *r2
+red *r6
+L4: .data 230, -169, 967, -886, 950, -679
+mov L4, r3
+L5: cmp L2, r7
+L6: .string "tnvrsodirnpuz"
+jmp *r4
+jsr L63
+L7: .data 206, 796, 796, -489, 365, 605, 120, -893
+not L39
+m0
+L8: .string "njkarzd"
+add L78, L6
+L9: jmp L9
+add #128, r2
+m1
+jmp *r3
+inc L8
+prn r3
+jmp L3
+L10: .string "gsg"
+m1
+cmp L5, r2
+L11: sub *r6, L101
+m0
+m4
+m0
+add L5, L58
+inc L8
+stop
+bne *r7
+; comment
+bne L7
+L12: .string "ywfzj"
+inc L9
+jsr *r7
+red r7
+jmp *r5
+m0
+; comment
+m4
+L13: .string "qoi"
+m1
+m3
+L14: add L110, L2
+L15: jmp L87
+m2
+m2
+jmp *r2
+mov #-39, r7
+bne L0
+bne *r6
+rts
+L16: rts
+mov *r2, r2
+inc r1
+L17: inc r4
+L18: dec L32
+L19: .data 647, 842, 825, 493, 577, 202, 141
+not *r5
+L20: cmp *r3, *r0
+jsr L105
+stop
+prn L20
+m3
+red L61
+add L30, *r0
+cmp *r7, #199
+L21: .string "uzjvnfr"
+m0
+L22: sub #-102, r0
+m0
+inc L26
+L23: .string "sgrhciudqoxusrurswtapza"
+clr L42
+clr r5
+m0
+stop
+not r6
+bne *r4
+L24: cmp *r2, #236
+m2
+L25: .string "axtmptdqcsgmdclqvqljntan"
+jsr L95
+L26: .data 344, -325
+prn *r2
+prn *r4
+L27: .data 250, 917, -846
+jsr L1
+L28: .string "tkuaijftyhf"
+m2
+L29: .string "khcidiawknki"
+m3
+L30: .data -941
+jmp *r3
+not *r3
+L31: .data 11, -988, -206, 526, 50, 143
+m3
+rts
+stop
+L32: clr *r4
+
+dec *r5
+L33: .data -836, 270, 174, -57
+rts
+not r4
+prn #96
+add *r3, *r3
+mov #-45, L14
+L34: add *r4, L119
+dec *r1
+
+jsr *r7
+rts
+inc L88
+bne *r4
+
+m1
+L35: mov r0, r3
+m4
+cmp L12, *r5
+red r5
+jmp *r1
+inc r3
+L36: rts
+add *r3, r4
+m3
+L37: .data 393, 11, 647, 917
+L38: .data -752
+m3
+inc r6
+mov *r0, *r1
+L39: .string "enbpmlmajpkbzszqyivemsd"
+not r7
+bne L52
+lea L7, L27
+L40: clr *r0
+L41: rts
+mov L62, *r4
+add #-22, *r4
+L42: not r3
+add *r4, L121
+lea L7, *r7
+red *r5
+red *r1
+bne *r7
+stop
+m3
+mov #-75, L24
+not r1
+bne L51
+jsr *r1
+jsr L41
+m3
+m1
+m2
+m1
+m2
+sub #-242, *r5
+L43: cmp *r3, L13
+m0
+m4
+m1
+not L79
+L44: stop
+m1
+m2
+sub #138, *r1
+m3
+red L114
+rts
+lea L8, L47
+not r4
+L45: lea L114, *r4
+L46: clr r5
+mov L34, r3
+L47: .data -237, 667, -429, -242, 870
+; comment
+L48: clr r3
+L49: .string "dbcdmvwho"
+rts
+m4
+L50: sub #73, L65
+L51: sub r2, L37
+dec *r4
+m0
+L52: sub #-122, L94
+mov #-135, *r2
+m3
+rts
+L53: prn L70
+add r1, r0
+m4
+L54: lea L7, L52
+clr r0
+cmp L96, L1
+m1
+L55: mov #-148, *r5
+
+L56: stop
+m1
+prn *r1
+m4
+jmp *r5
+m0
+stop
+m2
+dec r1
+L57: stop
+m2
+sub L71, L103
+L58: .data 686, -694
+dec L68
+bne *r5
+L59: red *r2
+m3
+rts
+
+add *r2, *r0
+jsr L92
+L60: add L15, L52
+L61: .data -85, -862, 196, -214, 591, 485, -362
+L62: .data -331, -802
+mov r3, *r4
+m0
+cmp r2, #84
+cmp #-85, L32
+rts
+L63: .data -158, -496
+; comment
+mov #-148, r6
+m2
+bne L34
+m0
+L64: rts
+L65: .string "czgm"
+
+m3
+dec *r4
+L66: add r6, L68
+L67: bne L68
+
+clr *r6
+L68: rts
+L69: stop
+cmp L116, L13
+prn *r5
+L70: lea L33, r4
+inc *r3
+prn #-249
+
+bne L9
+inc *r2
+prn L4
+clr r1
+sub r2, *r6
+red L97
+m4
+red r0
+L71: jsr L23
+
+dec r5
+m1
+mov #-239, *r0
+jmp L92
+stop
+L72: rts
+sub *r3, r3
+L73: jmp *r4
+L74: inc r2
+rts
+L75: red L34
+L76: bne L116
+m1
+cmp r4, L105
+; comment
+lea L95, *r5
+sub *r7, *r5
+inc L76
+add L76, r5
+cmp L27, L39
+rts
+red *r6
+L77: jmp L13
+m3
+jsr L88
+L78: sub L14, r0
+
+cmp L94, L88
+L79: .string "uebtjobr"
+add r6, r6
+stop
+inc *r6
+prn *r7
+L80: .string "adjxnxyluqqkj"
+m3
+m0
+not r2
+L81: add *r3, *r1
+rts
+lea L13, r1
+inc r2
+L82: .string "d"
+dec r7
+clr *r7
+L83: prn #-108
+lea L77, r7
+bne L103
+clr *r4
+inc L96
+jmp L89
+m1
+
+m2
+L84: .string "laycpbfwaowp"
+L85: lea L86, *r4
+L86: not *r3
+m1
+sub #102, L107
+L87: jsr *r0
+jsr L80
+L88: .string "jls"
+clr L1
+lea L6, *r1
+bne *r4
+clr L115
+jsr L104
+L89: clr *r3
+jmp *r5
+bne L98
+jsr L33
+cmp L109, L116
+not L113
+m2
+L90: cmp *r1, *r0
+L91: .data 167, -599, -869, -796
+inc r2
+L92: bne *r4
+L93: prn #216
+L94: dec L13
+m4
+jmp L10
+; comment
+m3
+L95: .data -238, -984, -28, 283, -668
+L96: red *r4
+clr L14
+m2
+prn r5
+prn #203
+L97: add #84, *r7
+L98: mov #68, L106
+jsr L61
+dec r6
+jsr *r1
+m4
+sub r5, L56
+add L57, *r4
+cmp *r6, *r5
+
+inc r0
+L99: prn #-228
+m0
+stop
+inc *r6
+not *r0
+L100: not r4
+m4
+L101: prn L104
+prn #190
+stop
+L102: .string "lmobo"
+rts
+lea L84, r1
+lea L108, L20
+inc r3
+m4
+m4
+jsr *r3
+L103: .string "inxmynfr"
+m3
+jmp *r6
+m1
+not r4
+jsr L110
+m0
+lea L118, *r5
+m0
+dec L12
+rts
+red r2
+prn r4
+
+; comment
+clr L121
+stop
+bne L109
+lea L31, *r5
+L104: .data 129, 915
+; comment
+m0
+prn #59
+L105: .data -104, 687, 394
+m3
+bne L115
+bne L107
+jsr *r2
+jmp *r3
+m4
+L106: mov L86, L114
+m3
+m3
+mov #-195, r0
+m4
+stop
+cmp *r7, *r7
+jmp *r0
+bne *r1
+prn *r0
+bne L80
+jmp *r7
+sub L111, r6
+mov L101, *r6
+L107: .string "nugh"
+L108: rts
+m0
+mov #174, r1
+m3
+jsr *r5
+inc r7
+bne L115
+m3
+inc r6
+L109: cmp r2, #-167
+m0
+L110: .string "wgoyqloqfqpopkpjxhvlv"
+L111: jsr *r2
+m3
+L112: .string "rjswmvmnrhfdpvrhdxe"
+L113: not *r5
+jmp *r5
+L114: .data -227, -578, 239, 863, 231, 589
+L115: .data -244
+; comment
+rts
+L116: .data 56
+m1
+stop
+add #216, *r4
+prn L121
+stop
+bne *r2
+clr L36
+dec L53
+m1
+rts
+inc L121
+lea L82, r0
+L117: jmp *r0
+cmp L120, r6
+red r0
+L118: not *r7
+L119: .data 849, -422, -111, 767, 441, -192, 882, 904
+prn #-100
+clr r3
+jsr *r7
+jsr *r2
+L120: sub *r6, *r7
+
+prn L107
+bne *r2
+bne L4
+inc L121
+mov L121, L64
+add #21, r3
+m4
+add L119, r6
+lea L93, L114
+m0
+inc L121
+L121: .data -811, -152
+prn r5
+stop
+clr r1
+red L44
+stop
@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 28
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    cmp #-124, r3
+    jmp L80
+    mov r1, *r0
+    clr r6
+    red L99
+    jmp L32
+    red r3
+    add #231, r1
+    not r5
+    jmp *r2
+endmacr
+macr m1
+    jsr *r6
+    mov *r6, L93
+    rts
+    dec L21
+    cmp r7, L65
+    jmp L79
+    inc *r6
+    jmp L69
+    sub L40, *r5
+    lea L78, *r3
+endmacr
+macr m2
+    mov L105, r4
+    jmp *r7
+    add #-19, *r3
+    jsr L60
+    not *r6
+    lea L15, L74
+    lea L10, r0
+    jmp *r6
+    rts
+    prn *r0
+endmacr
+macr m3
+    inc L37
+    mov r4, L8
+    sub L55, *r7
+    clr L74
+    not *r2
+    cmp r4, L75
+    add *r5, *r2
+    inc r3
+    rts
+    bne *r0
+endmacr
+macr m4
+    sub L35, r5
+    add *r4, r4
+    bne L65
+    bne *r1
+    inc L35
+    dec *r4
+    clr r0
+    stop
+    jsr L90
+    dec L87
+endmacr
+m1
+L0: dec *r0
+m4
+prn r2
+m2
+L1: .data -398, 282, 312, 384, -763, -993
+red *r2
+cmp #-163, #-141
+red r1
+stop
+rts
+m4
+; comment
+clr *r3
+rts
+red L1
+
+m4
+add *r2, L58
+L2: .string "ihwnavnugqrqlxrjq"
+m0
+add r0, r5
+L3: .data 630, 415, -885, -875
+dec L2
+prn #122
+; comment
+rts
+
+L4: .string "whlaztmziacrsarpauleakn"
+clr *r4
+m0
+lea L14, L12
+not *r4
+lea L69, *r4
+L5: inc L0
+m4
+m2
+add r7, L1
+m1
+bne *r2
+add L8, r2
+L6: bne L60
+L7: not r2
+stop
+bne *r3
+
+m4
+L8: .string "fnqupehtkhnzadeqfklys"
+L9: bne *r4
+lea L3, L97
+clr *r2
+jmp *r7
+L10: cmp r1, L38
+L11: mov #-207, L0
+jmp *r7
+inc *r7
+add #11, r3
+L12: .string "mfzu"
+clr r4
+red L0
+m4
+; comment
+L13: red *r5
+red r2
+L14: prn L8
+red r0
+clr L41
+L15: .data 346, -857
+inc r0
+not *r0
+; comment
+cmp r7, *r6
+m0
+L16: .string "pp"
+jsr L101
+L17: rts
+L18: stop
+L19: not r6
+; comment
+L20: .string "pavlttgipob"
+; comment
+L21: .data 196, -546, -696, -668, 639, 806
+sub r1, r7
+sub #-9, r4
+m0
+sub #-85, r4
+L22: bne *r5
+m0
+dec r5
+L23: sub r4, r4
+L24: .string "arzzkuduhfqpw"
+add L2, L6
+jmp L15
+cmp r5, L34
+m3
+jmp L0
+inc r0
+lea L23, L77
+m3
+jsr L6
+not *r7
+L25: jsr L5
+add L13, *r1
+m3
+jmp L13
+L26: clr r0
+L27: .data 267, -583, -903, 241, 189
+m4
+m3
+inc r7
+L28: add *r0, *r7
+L29: red L9
+stop
+m3
+jsr L57
+L30: .string "esfnmnvgr"
+L31: sub *r7, L21
+mov r6, r2
+add L51, r5
+not r4
+; comment
+dec r2
+
+lea L20, L62
+prn L24
+m2
+m1
+m1
+m1
+m0
+rts
+rts
+bne L29
+L32: .string "hiretuhnqvdtwifejwic"
+dec L17
+L33: not r4
+
+m4
+red r5
+stop
+cmp L80, r1
+m3
+L34: .string "hqkczkbejpplcgttsc"
+L35: red *r0
+stop
+L36: bne L65
+not r3
+L37: .string "adcn"
+dec r5
+mov r1, r2
+bne L8
+jsr L82
+m2
+m3
+clr *r5
+m3
+jsr *r0
+L38: mov r6, r3
+not L20
+bne L95
+; comment
+inc *r2
+red r4
+inc *r2
+dec L94
+L39: stop
+m0
+bne L24
+L40: mov *r6, r0
+stop
+not L17
+not *r6
+L41: prn L73
+stop
+add #-164, r6
+L42: red L48
+stop
+red *r4
+L43: .string "rgbin"
+L44: .data -726, -693, 617, 726, -219, -120, -107, 227
+m2
+L45: .string "hwdwonwocutkeuszyhoy"
+lea L76, r4
+rts
+cmp *r1, *r3
+cmp L18, #176
+L46: bne *r5
+jsr *r0
+jmp *r7
+cmp L36, r2
+cmp *r7, r5
+cmp L59, r5
+m4
+m4
+L47: cmp #2, #-36
+clr r5
+
+bne L94
+prn L35
+mov r7, r7
+jmp L30
+red L12
+; comment
+prn r7
+L48: inc r6
+jmp *r1
+mov r2, L62
+
+dec *r2
+bne *r7
+; comment
+L49: .data -236, -836
+lea L23, L3
+not r2
+cmp L1, r1
+m0
+prn L14
+m1
+not *r1
+L50: .string "egybshqmtalrxkynfrrxmje"
+stop
+m4
+not *r0
+prn #212
+mov r4, L87
+red r5
+m2
+add *r3, r3
+L51: .string "cjdia"
+L52: .data -508, -825, 443, -427, -317, 257, -271
+m1
+
+sub L6, L44
+rts
+jmp L69
+bne *r1
+bne *r4
+not L82
+cmp *r5, *r0
+mov #100, *r5
+dec r4
+L53: mov *r7, L69
+jmp L54
+clr L15
+dec *r3
+m3
+L54: .string "hljrxqrupemcde"
+clr *r0
+m3
+L55: red *r7
+m0
+jsr *r2
+mov #-121, L84
+L56: .string "jbzohtdhtjkykyscjrvkd"
+m0
+L57: .string "sdekwfnakdf"
+rts
+sub L29, r4
+m2
+cmp *r3, #-159
+sub L93, r2
+mov *r2, L87
+L58: red *r6
+L59: red L88
+; comment
+not L37
+L60: .string "uocnlavlkbrbrpmnndx"
+L61: .data 619, -44, -157, -325, -992, 620, -90, 565
+cmp *r0, #-86
+m0
+m3
+; comment
+m2
+L62: .data -354, -27, 122, -815, 346
+L63: bne L72
+add r3, *r4
+add #-162, L17
+lea L86, L54
+L64: dec r3
+m2
+L65: dec r3
+m1
+L66: stop
+not L15
+L67: .string "rawyfrulur"
+; comment
+m3
+stop
+rts
+jmp *r7
+red L4
+
+add #212, L41
+m4
+L68: add #-115, r0
+m0
+bne *r7
+L69: .data 469, 341
+jsr L77
+not r5
+L70: inc *r1
+m1
+L71: dec *r0
+inc r0
+dec *r0
+dec *r1
+cmp *r0, #30
+
+L72: .data 718
+sub L75, r6
+L73: .string "howpqhwowwovojkwiosuwx"
+inc *r5
+rts
+prn L50
+; comment
+jsr L78
+jsr *r7
+m4
+dec r7
+m4
+lea L34, r0
+m2
+stop
+stop
+inc *r1
+L74: prn #60
+inc *r7
+L75: add #-256, *r3
+m1
+sub *r3, r7
+m3
+rts
+add r2, r2
+L76: .data -705, 586, -736, 946
+lea L90, *r0
+not L81
+red *r5
+not *r2
+inc L89
+m2
+add L36, L82
+jmp L89
+L77: .data 123, -52, 454, -681, 953
+prn *r5
+
+lea L48, r4
+red r4
+dec *r3
+mov *r4, L104
+add L85, r1
+L78: .data 97, 959, -60, -141, 433
+prn r2
+not L88
+m1
+cmp r7, *r2
+L79: .string "fqtmmnhnuxt"
+m3
+
+prn r4
+add #35, r6
+L80: cmp r6, r1
+prn L14
+L81: .data -981
+rts
+red r7
+jsr L24
+dec *r1
+bne L100
+L82: .data -135, 561, 846, -573, -729, -129, -574
+L83: .string "hzjjzfvnmxbw"
+m3
+jmp *r6
+clr *r5
+prn r6
+cmp r4, L101
+L84: add L58, L39
+prn r7
+sub r6, *r4
+m4
+L85: dec r4
+L86: red r7
+mov #1, L100
+mov r3, L29
+L87: bne L96
+stop
+; comment
+inc L97
+jmp *r5
+add *r7, L101
+m2
+L88: cmp L85, #-234
+cmp L70, r2
+cmp L4, *r3
+
+jsr *r3
+clr *r3
+L89: rts
+L90: jmp *r7
+clr r6
+prn #123
+sub r0, L25
+clr r2
+
+inc r2
+L91: sub r7, *r5
+lea L54, *r4
+m2
+not r7
+bne L61
+stop
+dec r2
+dec r2
+jsr L11
+dec *r7
+L92: .data -464, 862, -529, 737, 325, -633, 262, 395
+m1
+L93: red r2
+sub #-50, *r7
+inc L51
+L94: .string "czzipwsobfnuybul"
+L95: add *r4, r7
+m1
+not *r2
+rts
+L96: .string "bmetavuyajokexnsmy"
+L97: .string "btvaqbrltiyxh"
+stop
+stop
+m4
+rts
+bne *r7
+rts
+m1
+mov #-42, r0
+
+; comment
+rts
+mov *r2, *r2
+dec L10
+clr *r1
+prn r0
+bne L10
+jmp *r3
+L98: .string "vvudsrxwuz"
+L99: stop
+dec *r5
+inc L2
+L100: .string "zttgsjh"
+bne *r3
+cmp #73, *r1
+lea L91, L103
+sub r0, L102
+m1
+m0
+stop
+mov r4, L105
+m1
+bne L46
+clr L101
+L101: .string "ltgjpswkwzik"
+rts
+jsr L103
+m2
+cmp L102, #130
+m3
+stop
+dec r0
+m0
+dec *r6
+m4
+dec L73
+inc *r3
+bne *r3
+sub L104, L52
+stop
+bne *r6
+not L7
+m3
+L102: .string "ecdpvomhxgtssmjg"
+m2
+mov #84, L94
+L103: dec *r2
+bne *r1
+mov r0, r4
+L104: add #-61, r2
+jsr L90
+mov L105, L98
+bne L7
+mov #-148, L23
+inc *r2
+L105: .string "fgamovhycsbnh"
+not L106
+dec L14
+bne *r0
+stop
+add r4, r2
+jsr *r6
+cmp L106, r4
+L106: sub L7, L52
+sub L37, L40
+stop
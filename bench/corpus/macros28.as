@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 29
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    cmp r0, *r4
+    rts
+    mov *r7, L28
+    cmp L21, #-162
+    not *r4
+    lea L117, r0
+    not L60
+    cmp r7, #-112
+    stop
+    not L71
+endmacr
+macr m1
+    rts
+    inc *r1
+    prn r6
+    jsr L31
+    prn L34
+    rts
+    lea L34, L101
+    cmp *r6, *r4
+    prn r3
+    clr L32
+endmacr
+macr m2
+    dec L4
+    clr *r7
+    prn #-201
+    cmp #-25, L89
+    rts
+    cmp L105, L103
+    sub L43, r1
+    clr r2
+    jmp L30
+    not r7
+endmacr
+macr m3
+    sub r7, *r4
+    mov r3, *r4
+    dec *r7
+    dec r5
+    prn r6
+    sub #-191, r3
+    sub #48, r5
+    bne *r7
+    stop
+    add *r2, L99
+endmacr
+macr m4
+    mov L118, L75
+    red r6
+    rts
+    stop
+    jsr L63
+    add #238, L35
+    jsr *r2
+    red L58
+    sub L127, r0
+    mov *r7, r4
+endmacr
+bne L5
+sub *r7, *r2
+stop
+L0: .string "vqppnqddzxearxms"
+; comment
+clr r5
+not L0
+m2
+L1: .data -951, 530, -832, 363, 60, -601, 705, 476
+m2
+not *r3
+clr *r5
+not r6
+prn #-180
+inc *r5
+not r3
+dec *r7
+lea L51, *r1
+add r0, L15
+
+clr *r5
+; comment
+cmp L0, #-120
+L2: .data 138, 239, 262, 820
+rts
+L3: sub #84, r2
+dec *r7
+lea L127, *r0
+L4: clr r1
+L5: .data 252, 706, 835, -219, 830, -784, 295, 479
+m4
+L6: mov L1, L76
+red *r3
+jsr L2
+prn r4
+m4
+dec *r1
+sub r5, r0
+lea L123, *r7
+add #154, r1
+L7: dec *r1
+mov *r4, L97
+jmp *r2
+L8: cmp *r0, L48
+cmp L1, r7
+L9: bne L6
+inc r6
+L10: rts
+m4
+rts
+jmp L3
+L11: cmp r2, *r4
+clr r0
+m2
+jsr L116
+L12: mov *r5, L122
+clr L3
+stop
+L13: .string "saulobacskmmhxrcnkcfcaij"
+add r5, *r5
+L14: red L16
+L15: dec r3
+prn #100
+
+add #175, L38
+prn L14
+not r5
+red r6
+L16: jmp *r4
+cmp #-142, #92
+bne *r3
+mov #-215, r0
+; comment
+sub r0, L3
+m2
+stop
+red L15
+prn r3
+L17: not L6
+L18: .data 482, 464, -545
+jsr *r5
+L19: prn *r4
+m2
+lea L101, r2
+L20: mov r3, L111
+
+cmp #21, *r1
+lea L48, L44
+dec r6
+sub #-229, *r4
+m4
+L21: .data 766, -91
+m4
+; comment
+m1
+; comment
+L22: .data 40, 109, 39, 69, -472
+rts
+sub *r0, r4
+m4
+dec L10
+clr *r5
+stop
+clr *r7
+rts
+L23: .string "aymqhjdrooyuvjxkyhoyup"
+mov #158, L111
+inc *r0
+L24: .string "oqljqmhemvzqsgnnqcxiu"
+bne L56
+inc *r7
+L25: add L36, L8
+L26: prn *r4
+L27: prn L120
+stop
+m1
+jsr L5
+L28: sub L27, *r4
+m2
+; comment
+L29: prn *r2
+m4
+L30: rts
+dec r4
+cmp r0, r0
+L31: .string "uqhmivpxaxcmbszjuuv"
+
+L32: inc L27
+clr *r7
+prn L16
+add *r6, r3
+m3
+L33: .string "vburuxcleu"
+bne L107
+m4
+m2
+m0
+bne L28
+inc *r0
+jmp L21
+L34: .data -539, -214, -441, 751, 434, 80
+L35: inc r7
+rts
+red r4
+m2
+m4
+L36: sub #180, r6
+add L20, L98
+m2
+jsr L17
+add *r1, *r3
+L37: stop
+L38: dec *r5
+clr L1
+m1
+stop
+m2
+not r4
+sub r5, r3
+L39: prn *r6
+not *r2
+m0
+m3
+jsr *r0
+L40: clr L14
+m0
+; comment
+L41: rts
+bne *r6
+jmp *r7
+L42: mov L0, r6
+inc r5
+; comment
+red L13
+clr r7
+L43: sub *r6, r2
+L44: .data -766, -735, 438, -479
+mov L98, L71
+m0
+jmp *r2
+m1
+L45: prn #-172
+L46: bne *r2
+sub #-153, L83
+sub L88, L44
+m2
+L47: .data -512, -42, 772, -876, 584
+jmp L14
+m2
+cmp r6, *r4
+L48: bne L45
+
+sub #-132, *r0
+m1
+m4
+prn #217
+m1
+
+rts
+dec r7
+L49: rts
+m2
+L50: .data -928, 357, 296, -690, -550, 312
+m3
+inc *r7
+L51: .string "nbvnclfo"
+not L64
+mov #195, L15
+rts
+red L78
+prn *r1
+L52: bne *r0
+L53: clr r7
+m0
+L54: .string "tarhxb"
+
+dec L5
+L55: .string "jrdabon"
+L56: inc L21
+inc r1
+m1
+L57: .data -496, -189, -947, -660, 200
+m0
+L58: rts
+jmp L27
+; comment
+jsr L114
+L59: inc r5
+; comment
+L60: sub L121, r4
+add *r7, L16
+rts
+m3
+m0
+m2
+add *r1, r6
+prn L107
+L61: .data -941, 269, 749, -371, 692, -274
+m4
+L62: clr r3
+inc r6
+L63: rts
+rts
+L64: .string "xdetkpmzwi"
+lea L58, L19
+m0
+red r4
+L65: .data -956, 968, -585, 65, -628, 122
+rts
+stop
+cmp *r5, *r5
+L66: sub r3, *r2
+m0
+L67: .string "czzjinyxvvmmutorqxitigi"
+cmp *r5, *r2
+L68: red r2
+L69: .data -200, -603, 714
+bne L84
+m0
+mov *r4, r1
+bne L91
+clr r1
+m1
+jmp L94
+inc r3
+cmp L2, #28
+lea L52, *r5
+L70: .string "hxsejyzc"
+cmp #96, #-70
+sub #-26, r1
+jmp L42
+mov #-118, L3
+add L42, *r5
+L71: .string "ompqb"
+m1
+m4
+L72: .string "bxfwoztasjjxqgwtluhky"
+jmp *r1
+m0
+prn #-250
+jsr L125
+prn L53
+L73: .string "bhxngcjlqzmg"
+rts
+rts
+L74: jsr L7
+lea L6, *r5
+jmp *r4
+L75: .data -368, 101, 499, 731, 610, -824, -994, 243
+m2
+sub L94, *r4
+inc L73
+L76: .data -742, -567, 58, -727, -935, 475
+cmp L13, #251
+dec r2
+L77: prn L123
+stop
+L78: .string "jvdcxrqqtonv"
+prn L14
+L79: .string "ajbkhxcwehdrmqy"
+add r7, L126
+not L105
+m1
+mov *r4, L99
+L80: .data 843, 110
+L81: not *r4
+lea L91, *r3
+rts
+not L86
+bne L116
+L82: add L0, L112
+dec r7
+stop
+rts
+prn #39
+m1
+stop
+mov L53, L112
+L83: cmp *r4, *r6
+not r1
+m1
+add L10, r2
+
+L84: sub *r2, r6
+L85: dec r2
+inc r6
+L86: .string "xjjylbboluvqlbzuwaliqfna"
+clr r5
+jsr L80
+add L19, L19
+clr r6
+add #187, *r5
+L87: .string "gwiymbxmdvhvftgn"
+L88: .string "ffhhglcu"
+lea L77, *r0
+add *r1, L97
+L89: not *r5
+L90: .string "biworvn"
+m2
+m0
+jmp L55
+
+m2
+; comment
+L91: .data 512, 532
+m2
+jsr *r6
+jsr L89
+m2
+jsr *r5
+L92: not *r5
+red r2
+clr *r5
+not r3
+add #210, *r4
+dec *r3
+add *r6, r5
+add r0, r1
+mov L91, L76
+L93: inc *r5
+; comment
+clr r7
+clr L93
+jmp L70
+dec *r6
+m1
+clr *r7
+L94: .string "veervnbawxwmjqktm"
+L95: .string "ssolokpmhjoairgqrvjzcvw"
+jmp L126
+L96: .data -549
+L97: rts
+rts
+bne L114
+m4
+jsr *r3
+dec *r1
+inc r1
+L98: .data -217, 386, -315, -791, -113
+rts
+sub L50, r7
+m4
+cmp L46, r4
+sub r0, r6
+stop
+L99: .string "e"
+m4
+L100: .data 590, 513, 909, -588
+m2
+sub r0, r5
+L101: bne L68
+rts
+jmp *r5
+rts
+L102: mov r6, *r7
+jmp L89
+L103: clr L104
+clr r4
+m3
+mov r2, r2
+add r3, L122
+mov *r2, r2
+m3
+sub #82, r5
+m1
+L104: .data -931, -12, -609, -541, -615, -285
+bne *r2
+L105: stop
+L106: add #-248, r6
+L107: add *r5, *r7
+not L109
+inc r5
+jsr L127
+sub *r2, L127
+m2
+mov *r1, r2
+red r1
+L108: .string "ibjdvhnepsyegkq"
+sub #15, r0
+jmp *r7
+mov L113, r4
+m4
+jmp L121
+L109: rts
+mov L125, *r6
+L110: .string "psmqqvpahssjbxrgq"
+L111: .data -914, -137
+L112: .string "sfamcu"
+add r3, L118
+L113: stop
+m3
+rts
+cmp #246, L114
+m1
+cmp L3, #254
+add *r5, *r6
+prn #9
+L114: rts
+not r4
+not *r4
+inc *r1
+stop
+L115: .data 935, -764, 90, -918, -605, 426, -241, 792
+stop
+L116: dec *r2
+mov L121, *r7
+jsr L126
+m4
+stop
+sub r4, *r3
+L117: .string "btwiytdshgfkvewophui"
+m1
+not L56
+jmp L120
+clr *r0
+L118: .data 541, 550, 999, -678, -818, 661
+m4
+
+mov #-177, L124
+m1
+clr r4
+add *r7, L124
+L119: .string "dkcujucgfejg"
+m0
+m4
+m1
+L120: jsr L13
+L121: .data -372, 930, -888, -909, 924
+red L26
+m2
+not *r1
+m2
+clr *r2
+L122: dec r0
+sub r7, L116
+sub #56, L15
+stop
+sub #23, r2
+clr r2
+
+L123: rts
+L124: .string "ycdgpajbdouarqjptuict"
+inc *r5
+m4
+mov #135, L8
+dec r0
+cmp L126, r2
+L125: red L126
+clr r2
+not *r3
+m1
+m2
+m4
+not r7
+L126: mov *r2, *r6
+inc r0
+m2
+clr *r0
+L127: bne L13
+prn #-4
+stop
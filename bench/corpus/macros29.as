@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 30
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    add *r0, r7
+    rts
+    mov *r1, *r6
+    sub #-207, L44
+    sub L29, r1
+    inc L94
+    dec L9
+    lea L48, L88
+    inc r3
+    add r3, r5
+endmacr
+macr m1
+    lea L57, L1
+    bne L24
+    not *r0
+    dec L68
+    jmp *r1
+    lea L31, r5
+    bne *r7
+    dec r2
+    not *r6
+    prn #-114
+endmacr
+macr m2
+    not L34
+    inc L56
+    jmp *r4
+    not *r1
+    add r3, *r5
+    mov L30, r0
+    sub r0, r0
+    jsr L25
+    stop
+    add r3, *r1
+endmacr
+macr m3
+    rts
+    inc r2
+    jsr *r4
+    red r7
+    jmp *r3
+    clr *r0
+    rts
+    prn #-56
+    jmp L47
+    red r5
+endmacr
+macr m4
+    red r0
+    jmp L38
+    inc *r7
+    red *r6
+    dec *r1
+    not *r2
+    clr *r7
+    jmp L26
+    add L47, L19
+    jmp *r3
+endmacr
+
+not L68
+L0: mov *r3, L48
+cmp #-199, L84
+L1: .data 399, -786, -929, 185, -600, 838, -638
+mov #71, *r4
+m4
+stop
+rts
+m1
+L2: dec *r4
+m3
+L3: jsr *r0
+not *r4
+mov L18, *r5
+inc *r6
+dec r1
+stop
+stop
+prn L99
+dec *r0
+stop
+add r5, r7
+add *r4, *r1
+stop
+rts
+inc *r5
+mov L1, L65
+jmp *r7
+m4
+jsr *r6
+lea L2, *r5
+stop
+jmp *r0
+not r0
+not r5
+rts
+L4: jsr L10
+cmp *r0, r4
+L5: sub #239, L1
+
+lea L84, L3
+m1
+not *r5
+jsr *r6
+L6: rts
+lea L5, r3
+; comment
+dec L3
+dec r5
+L7: .data 647, -385, -179, -658, 316, -386, -32
+dec r4
+inc *r4
+jmp *r6
+; comment
+
+not r5
+m3
+m4
+cmp #-122, r0
+m4
+L8: .string "hqbyuxn"
+lea L2, *r6
+sub L6, *r4
+red L35
+m0
+m2
+L9: .string "agzqvsimszdeaz"
+L10: red *r1
+clr *r5
+m4
+lea L7, r5
+sub r4, L4
+L11: rts
+add #-28, *r5
+L12: lea L0, *r1
+add r5, *r1
+sub r2, L10
+L13: .string "jwtymyezchtnlshyuaovnx"
+red *r7
+rts
+m4
+mov *r4, L34
+dec r3
+mov *r0, L22
+L14: clr r1
+m4
+m1
+m1
+red *r7
+cmp r2, #-110
+; comment
+sub #-99, L11
+L15: .data -516
+L16: .string "dturxyjttyhkfdnln"
+inc L73
+not *r2
+L17: .string "lighjggoeyjodpblc"
+add *r5, *r3
+jsr L7
+m0
+prn #-102
+rts
+red r3
+red *r3
+L18: .string "g"
+sub L100, L70
+L19: bne L51
+m3
+m4
+L20: .data 193, -895, 936, -805, -20, 732, 764
+L21: .string "j"
+jmp *r6
+jmp L37
+L22: dec *r3
+dec L56
+jmp *r2
+red L91
+L23: mov #177, r7
+L24: .data 497
+red L21
+lea L23, *r2
+inc L11
+red r6
+jmp *r4
+red *r6
+m2
+m4
+L25: cmp #251, *r1
+inc *r6
+L26: add #117, r4
+m1
+prn *r3
+clr L17
+L27: not r1
+prn L8
+m0
+m0
+dec r2
+bne *r2
+jmp *r6
+lea L26, L99
+m4
+jsr L79
+L28: .data -892
+not r3
+sub L20, *r2
+lea L97, *r5
+L29: clr *r3
+dec r1
+inc L25
+rts
+; comment
+stop
+jsr *r7
+; comment
+add *r7, r6
+m3
+jmp L88
+lea L37, r1
+jmp L98
+prn L94
+clr *r3
+m3
+mov *r5, L35
+jsr *r2
+inc L19
+add r7, *r1
+jsr L86
+L30: add #-74, L98
+m2
+not L21
+L31: clr r6
+L32: .data -2, -835, -755
+inc *r5
+clr *r7
+sub #-147, L94
+m1
+L33: .string "yue"
+jsr L76
+L34: not r5
+L35: mov *r4, r4
+L36: .string "ufiyeydflzkwoxnptulmvhax"
+m4
+m4
+sub *r4, r6
+inc L20
+L37: rts
+lea L91, *r3
+m2
+lea L74, r7
+L38: .string "eoaqmnxsxwcdzlcjln"
+mov r4, r0
+clr *r6
+prn *r1
+stop
+clr L38
+red *r1
+cmp #247, L11
+
+mov L99, *r4
+dec r4
+red *r5
+rts
+L39: .string "wfwhldyttkswujduif"
+sub L79, L58
+stop
+sub *r3, r2
+m0
+m0
+m3
+rts
+m4
+L40: .data 361, 46
+mov L66, *r3
+dec *r1
+stop
+sub *r2, *r7
+jsr *r7
+jmp *r6
+L41: sub #89, *r6
+cmp L61, #-227
+L42: jsr L23
+L43: rts
+L44: inc L50
+dec *r4
+clr *r5
+cmp #178, r7
+L45: .string "slfpjheaewrzirmejqx"
+lea L70, r2
+; comment
+jsr *r3
+m3
+jmp *r0
+L46: .string "tvrgure"
+mov #-211, *r4
+red *r1
+not *r4
+jsr *r2
+L47: clr *r1
+L48: clr r5
+jsr L11
+dec *r0
+dec *r3
+bne L72
+m0
+L49: not r6
+lea L39, *r6
+stop
+rts
+L50: stop
+; comment
+add #164, *r7
+clr L49
+jsr L66
+L51: lea L9, *r5
+
+dec r0
+L52: add *r6, r4
+lea L23, L11
+not L0
+jmp *r2
+jsr *r3
+stop
+red *r3
+not *r5
+clr r3
+dec r7
+L53: lea L49, r5
+add *r2, L56
+bne *r7
+L54: jmp L81
+cmp *r0, #68
+prn r5
+bne L68
+clr r3
+stop
+jmp *r5
+stop
+clr L93
+bne L70
+L55: .string "adifvygzslk"
+prn L64
+
+stop
+clr *r1
+red L49
+clr r6
+not L70
+add #-130, r4
+sub #-128, *r0
+mov #-25, L55
+L56: prn L42
+jsr *r5
+not r6
+rts
+clr r0
+prn r6
+lea L55, L59
+L57: .string "vbqxyjakoqdwsfqy"
+clr *r1
+L58: sub L30, *r2
+lea L19, L65
+m0
+L59: .string "golraprqydp"
+stop
+m0
+not L81
+sub L4, r2
+stop
+m0
+L60: .data -766, 225, -928, 196, -403
+jsr L92
+jmp L3
+lea L31, *r3
+inc L63
+dec *r1
+L61: jsr *r3
+rts
+bne L69
+jsr *r5
+clr L52
+jsr *r1
+L62: not *r0
+cmp r7, *r4
+lea L43, L81
+m4
+add *r6, *r5
+m3
+stop
+mov r1, *r7
+red *r6
+L63: .string "puhmujryqaffpimjivwnkvxt"
+dec *r3
+rts
+L64: cmp r3, *r4
+inc L28
+L65: cmp r1, r2
+not L34
+m2
+red *r1
+; comment
+sub #172, r6
+m1
+m4
+L66: clr r1
+L67: .data -478, -735, -884, 998
+dec *r2
+bne *r6
+; comment
+m0
+sub r5, L75
+
+L68: red L100
+inc *r6
+not L54
+m4
+m2
+inc L54
+L69: .data -878, -152, 685, 716, -807, 29, 34
+sub #220, L90
+clr *r5
+L70: .data -677, -120, -697, -57, -481, 963
+
+L71: bne L33
+not L90
+add r2, *r5
+m0
+dec *r1
+sub r2, L3
+L72: stop
+L73: .data -979, 77, -886, -913
+
+prn r0
+L74: inc *r4
+L75: not *r5
+red L18
+rts
+m3
+jsr *r1
+sub #-57, *r4
+prn *r7
+inc L31
+jsr *r3
+m1
+mov L79, L93
+dec r1
+mov #33, *r7
+
+cmp #-179, r3
+m3
+dec r6
+add *r0, L87
+dec *r0
+mov #-14, r3
+red L97
+m2
+L76: dec *r2
+red *r7
+dec L35
+L77: mov #47, L88
+jsr L85
+L78: .string "sytifwztdghmow"
+stop
+lea L43, *r6
+m0
+rts
+m1
+jmp L88
+not *r2
+L79: .string "hlbhxjmvudvwg"
+lea L60, L86
+; comment
+L80: cmp r7, *r5
+lea L101, *r1
+sub #173, *r4
+L81: mov r5, *r1
+L82: .string "ixspqvc"
+L83: .data -676
+L84: .data 292, -192, 455, 308
+bne *r3
+m4
+dec *r6
+rts
+add #250, *r2
+L85: .string "rahhvlmapahpblgpidjrr"
+L86: prn L85
+add L13, r7
+L87: .data 558, -203, 782, -476, 550, -903, -523
+rts
+L88: .string "jwwmd"
+m4
+cmp *r3, L30
+L89: .data -870, -699, -780, -465, -610
+jmp L93
+m2
+inc L98
+m4
+L90: .data -153, -785, 250, -602, -361
+clr r5
+lea L99, L97
+L91: .data -969, -594, 592, 160, 132
+L92: .data 567, 90, -742, -311, -330, 543, -807
+rts
+m1
+add L101, r3
+dec *r3
+add *r0, *r2
+mov *r2, r3
+add L101, *r5
+inc L96
+jsr *r6
+L93: clr *r0
+bne *r0
+dec L14
+m4
+L94: .data 97, -714, -893, -585, -295
+L95: .data 115, 901
+red L101
+mov L28, L82
+prn r0
+cmp *r7, *r6
+m3
+jsr L100
+jmp L16
+prn *r3
+bne *r1
+L96: .data -485, -959
+; comment
+jmp *r2
+L97: .data -493, 195, 671
+bne L100
+add r5, L98
+L98: .string "ge"
+add L24, r4
+inc L99
+inc r2
+cmp L46, L46
+red L81
+clr *r3
+rts
+not r3
+jsr L100
+L99: .string "pbmqqxjrwz"
+inc r3
+m3
+sub #12, r0
+not L100
+not L47
+mov #44, *r2
+inc *r2
+mov #114, r5
+stop
+jsr L45
+m2
+m0
+L100: .string "lalviqxvzvdaauunnbkvhl"
+L101: jmp L19
+bne *r0
+
+stop
@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 4
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    add *r5, L1
+    clr r3
+    jsr L16
+    red L115
+    inc L111
+    stop
+    red r6
+    add #173, r5
+    rts
+    rts
+endmacr
+macr m1
+    rts
+    cmp L78, *r3
+    lea L117, *r3
+    prn r0
+    inc L5
+    cmp #-136, r1
+    stop
+    red r2
+    dec *r2
+    bne L47
+endmacr
+macr m2
+    inc *r6
+    cmp r3, L25
+    jmp *r3
+    red r1
+    mov *r4, r0
+    sub *r4, r2
+    red L28
+    jsr L5
+    cmp *r5, r7
+    jmp *r6
+endmacr
+macr m3
+    rts
+    jmp *r2
+    stop
+    bne *r7
+    sub #233, r0
+    bne *r2
+    inc *r3
+    dec L68
+    lea L1, r2
+    lea L6, *r0
+endmacr
+macr m4
+    not r4
+    not L118
+    stop
+    cmp *r4, r6
+    cmp r5, #22
+    red *r4
+    not r4
+    add r5, r1
+    bne L62
+    red *r3
+endmacr
+m1
+m4
+L0: .data 368
+m2
+inc r0
+not r1
+m1
+jsr *r7
+add L48, L13
+bne *r6
+dec *r5
+red L0
+prn r0
+not r6
+L1: rts
+L2: dec *r4
+lea L105, r7
+L3: .string "y"
+m1
+dec *r3
+m3
+jmp *r7
+sub *r7, L1
+not r5
+sub *r4, r1
+dec *r2
+m4
+jsr L78
+L4: .data -74, 419, -136, 288, -893, -281
+L5: .string "ybxpnlkupdqwrmwsqt"
+stop
+m4
+cmp L57, r5
+L6: .data 778, 497, 715
+jmp L2
+m4
+jsr L61
+L7: red *r6
+L8: not L18
+cmp L74, *r1
+clr L96
+rts
+prn *r1
+L9: .data -99, -361, 480, 774, -199
+L10: .string "dalkbjdltsoqlfhjovcxzwt"
+stop
+m3
+stop
+L11: .string "qkntvrxfaqsoybrx"
+L12: cmp L4, L11
+m3
+stop
+L13: .data 128, -95
+L14: .string "xqtnnzqvmoqlwagc"
+inc *r7
+L15: jsr L14
+mov L37, L24
+m1
+L16: red *r2
+prn r3
+sub L0, r1
+L17: .data 212, -996
+jsr L90
+L18: jsr L2
+m4
+dec *r2
+m0
+L19: .string "chgnvxhrkfbmqobardml"
+L20: red *r6
+m4
+lea L0, L40
+m1
+not r0
+L21: prn L20
+m4
+L22: .data 363, 816, 560, -25, -14, -92, 295, -129
+
+rts
+L23: dec L83
+stop
+m3
+rts
+dec r2
+m2
+L24: prn r6
+dec L20
+L25: .string "zwclwad"
+inc *r2
+L26: .string "dlrlbqxhn"
+red L15
+L27: jsr *r3
+L28: .data 104, -955, -398
+red r0
+bne L19
+L29: rts
+sub r0, r3
+cmp L40, r5
+
+add *r3, r7
+; comment
+lea L12, *r7
+inc r6
+L30: jsr L53
+rts
+prn r6
+L31: .string "pbqlcyataika"
+m2
+cmp #148, r1
+bne L11
+bne L52
+m3
+L32: mov #-56, *r7
+rts
+jmp L23
+L33: red *r4
+sub #64, L58
+lea L17, *r4
+m3
+not *r0
+L34: add *r1, *r2
+not *r3
+rts
+dec r3
+sub *r2, *r7
+lea L53, r0
+L35: mov L23, L109
+m1
+dec *r4
+cmp L56, r1
+
+L36: .data 688, 787, 610, -385
+L37: jmp L120
+m2
+mov L37, L13
+m3
+L38: .data 567, -201, 226, -451, 223, -431, -78, -3
+L39: .data -954, -265, -108, 568, 0, 249, -984, 261
+jsr *r7
+L40: .string "hemtitbfirfydvxumummkken"
+red r7
+rts
+jsr *r7
+L41: .string "whjmrjhbjrcuu"
+dec r4
+mov L17, r4
+m1
+m4
+L42: lea L80, *r0
+rts
+m4
+L43: .data 342, -868
+L44: .string "xgckwpthyteqyykq"
+dec *r7
+m2
+red r3
+not *r6
+rts
+L45: .string "iq"
+L46: prn #149
+m0
+
+add *r4, L117
+add *r5, *r4
+mov L7, r5
+L47: bne *r3
+mov r3, L120
+m1
+sub *r1, L102
+jsr L80
+rts
+m1
+not L121
+L48: lea L66, r6
+sub *r5, L40
+not *r0
+
+L49: .string "fdhmotbxa"
+jmp *r0
+not L96
+not *r3
+L50: dec L10
+m2
+bne *r2
+m4
+L51: add *r3, *r3
+clr *r6
+jsr L116
+not L94
+stop
+m2
+m3
+L52: stop
+mov #-180, L48
+m1
+mov L105, L28
+L53: .string "rijfsde"
+bne L79
+stop
+L54: .string "byowom"
+m0
+jsr L23
+not *r1
+m3
+m3
+m1
+m1
+cmp r6, r0
+L55: stop
+m0
+rts
+rts
+stop
+; comment
+stop
+prn #-141
+stop
+clr r3
+jmp *r3
+
+rts
+L56: .data 228, -523, 422
+L57: lea L23, *r4
+red L28
+clr r0
+cmp L11, *r7
+m3
+L58: add *r7, L112
+bne L20
+
+add r3, *r5
+stop
+m4
+red r1
+m0
+; comment
+mov r2, L38
+m2
+L59: .data -833, -690
+not *r2
+m0
+L60: .string "krjkrrwpcpqfb"
+m0
+L61: .data 271, 836, -299, -114, -57, 806
+jsr *r2
+mov *r6, *r1
+; comment
+m4
+prn r4
+prn #-3
+L62: .data -608, -510, 613, 322, -828, 981, -215
+L63: red *r2
+stop
+inc *r7
+L64: .string "nznpkkuqodbmnrvoq"
+L65: inc *r3
+
+clr *r0
+clr L23
+lea L105, L23
+L66: prn L116
+bne *r2
+add L49, *r7
+prn L85
+L67: stop
+L68: .data -95, -691, -222, 652, 767, 308
+L69: .string "eoupaikskubgxiuwz"
+lea L84, *r6
+m4
+sub L71, r6
+lea L105, r5
+L70: cmp L91, #89
+L71: stop
+m2
+L72: .data 503
+L73: .string "gjvytgavrverkio"
+inc L109
+jsr *r0
+jsr L84
+clr L1
+jmp *r1
+m1
+L74: red *r5
+L75: not r6
+lea L4, r3
+jsr L16
+jmp *r0
+mov r2, L119
+rts
+L76: sub *r3, r0
+L77: .string "wtq"
+red r4
+dec *r5
+mov *r7, *r6
+rts
+cmp r2, *r5
+m3
+m1
+m2
+clr *r4
+clr L63
+L78: dec r5
+m1
+not L17
+sub *r7, r7
+add L109, *r1
+jsr *r7
+clr *r5
+add *r3, L121
+sub L122, L84
+m2
+; comment
+bne *r1
+sub L65, *r6
+L79: .string "besbnaglvssbdzbufdvxlued"
+not r0
+L80: .data 967, -653, -859, -674, -709, 819
+prn L42
+prn #-119
+prn r0
+L81: .data 175, 69, -427, -745, 401, -654, 616
+L82: bne L113
+mov #-2, r6
+jmp L88
+cmp #-121, *r4
+L83: prn *r4
+not r5
+clr r6
+L84: jsr L125
+m1
+L85: bne L100
+m1
+L86: prn #83
+L87: stop
+L88: jmp L87
+L89: red *r0
+m1
+L90: lea L124, r7
+m1
+dec r1
+L91: .string "v"
+jmp L106
+m3
+bne L55
+sub *r4, r6
+m0
+clr *r7
+L92: jmp L117
+mov r5, L22
+L93: jmp L23
+dec r4
+L94: jsr *r6
+lea L121, r5
+dec *r7
+rts
+L95: .string "ktcofaybzfbsjlcse"
+; comment
+red *r7
+add *r4, L76
+; comment
+jmp L125
+red L71
+sub *r6, r7
+inc r5
+L96: .string "nrfnuj"
+sub #246, *r7
+prn r3
+L97: sub L7, r6
+sub L122, L84
+m1
+L98: cmp *r0, r5
+jsr L101
+cmp #52, *r0
+m3
+prn *r2
+L99: inc L105
+
+m2
+prn #255
+not r4
+m4
+inc *r1
+add #-47, L118
+m1
+m4
+m1
+mov L104, r5
+L100: clr *r1
+not *r1
+lea L107, *r5
+lea L52, r5
+bne *r3
+L101: lea L98, *r6
+L102: prn #159
+m3
+lea L5, *r6
+m1
+rts
+m0
+
+mov #-198, L105
+dec r3
+L103: .string "rmvqicywbnjprzyrsqeyb"
+bne *r3
+cmp *r1, L76
+L104: .string "yoqsvqrpnaaweepnxdhgbxhv"
+m0
+add #77, L109
+L105: clr *r7
+cmp r2, r1
+L106: .string "xgogkqlje"
+prn *r4
+clr L117
+L107: bne L119
+prn *r1
+stop
+; comment
+prn *r4
+lea L116, *r5
+m0
+L108: .string "fvyo"
+lea L110, r6
+m2
+m2
+prn r6
+L109: .string "hdtmodzfetyejzbpnjzyusey"
+sub #35, *r2
+cmp #-135, L119
+jsr *r0
+
+m0
+jmp *r5
+inc *r4
+L110: red r4
+red L62
+not *r2
+jmp L45
+cmp #99, L122
+dec *r0
+not *r1
+cmp *r1, L116
+L111: dec r4
+; comment
+L112: .data -350, -301, -892
+prn L114
+prn *r6
+jsr L74
+lea L19, *r1
+inc L103
+not r3
+clr L123
+add #-235, L101
+L113: .string "wfigmccltbdnntmm"
+mov #185, r7
+m4
+dec L121
+bne *r0
+red L125
+L114: rts
+jsr *r2
+cmp r0, L124
+m1
+dec *r7
+m4
+lea L30, L75
+clr *r7
+jsr *r2
+; comment
+m3
+L115: .string "fouhsfecf"
+L116: .string "zijydyeig"
+lea L122, *r6
+L117: not r7
+L118: bne *r1
+L119: .string "vmdm"
+rts
+L120: .string "fljpokvznlm"
+L121: dec *r0
+bne *r3
+jmp L123
+m0
+m1
+L122: dec L10
+bne L123
+prn r6
+m3
+sub r6, r4
+stop
+L123: rts
+jmp *r1
+m0
+mov r0, r6
+L124: red r6
+dec L76
+lea L125, *r2
+not *r1
+prn *r4
+
+L125: .data -86, -636
+L126: .data 99, -36, 87, -487, 129, -900, -328
+m4
+stop
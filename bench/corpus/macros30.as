@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 31
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    red *r2
+    dec r4
+    jmp *r2
+    red r6
+    stop
+    add r4, L12
+    cmp *r5, r3
+    cmp L2, L46
+    dec r4
+    inc L74
+endmacr
+macr m1
+    not r6
+    jmp L66
+    jsr *r4
+    bne *r0
+    sub L6, L95
+    bne *r0
+    bne L20
+    mov #85, L115
+    mov r4, r6
+    cmp #83, r2
+endmacr
+macr m2
+    lea L94, r5
+    red r2
+    prn r1
+    dec *r0
+    inc r3
+    jmp *r1
+    cmp *r2, #-87
+    mov #-98, L117
+    jmp L21
+    lea L65, L77
+endmacr
+macr m3
+    not *r7
+    red L46
+    not L69
+    mov L66, *r6
+    lea L116, *r1
+    mov L0, L68
+    inc *r2
+    stop
+    sub L16, *r6
+    sub #69, r3
+endmacr
+macr m4
+    jmp *r7
+    rts
+    cmp #-101, #116
+    inc r3
+    add L51, *r0
+    prn *r5
+    not r7
+    add *r3, r2
+    lea L38, r7
+    prn #-111
+endmacr
+L0: .string "tybp"
+L1: .data 697, 871, -292, -839, -384, -141, 465, -732
+inc L22
+rts
+L2: clr r4
+L3: lea L103, r4
+red L24
+not L71
+cmp #210, #-237
+m1
+L4: jmp L1
+cmp *r7, r7
+bne *r7
+lea L36, *r4
+mov *r3, L1
+L5: .data -92
+clr r2
+prn r2
+m4
+prn *r0
+m4
+m4
+dec r5
+jsr L3
+rts
+bne *r0
+m3
+jsr L2
+stop
+m1
+m1
+not r0
+m1
+m0
+bne *r0
+rts
+sub *r3, r7
+bne *r7
+bne *r7
+L6: .string "pwloprsxeh"
+prn r3
+m4
+L7: clr L1
+not *r0
+m2
+jsr *r4
+sub L66, L1
+m2
+dec L17
+dec *r0
+not r1
+L8: not L52
+clr L72
+m0
+mov #-171, L4
+m4
+red r1
+jsr *r1
+L9: sub #89, r2
+not r4
+m2
+sub *r6, *r2
+bne *r6
+sub #-195, L9
+m3
+L10: .string "dxcuzhiizjnjluubqoc"
+L11: .string "axin"
+sub #-5, r5
+m1
+L12: .string "dmtfk"
+lea L8, L8
+add *r3, r5
+rts
+jmp *r2
+cmp L35, #54
+sub *r7, r7
+; comment
+L13: red r0
+inc *r0
+L14: .string "tvkuvvrx"
+L15: add *r3, *r7
+m1
+prn L31
+m2
+add #-102, *r6
+m3
+; comment
+prn #-224
+jmp *r1
+add r2, L0
+stop
+add L47, *r0
+; comment
+L16: red r5
+
+L17: clr L4
+m3
+cmp L12, L4
+L18: jsr L108
+cmp r7, *r0
+cmp #-151, r5
+L19: bne *r0
+dec r1
+clr r2
+L20: jmp L4
+L21: red r6
+L22: .data -460, 227, 328
+clr r7
+lea L21, L17
+add #81, *r5
+L23: .data 893, 590, -239, -401
+L24: rts
+L25: .data 705, 298, 953, -351, 921, 936
+m3
+mov *r6, r5
+clr r2
+m1
+jsr L6
+cmp #240, *r2
+red L84
+mov L86, *r2
+
+cmp L13, L25
+m2
+not L12
+L26: inc L6
+m1
+m3
+not r2
+red *r6
+bne *r3
+sub r1, r7
+stop
+L27: cmp r5, *r7
+dec r2
+stop
+; comment
+L28: red r6
+bne *r3
+mov *r1, *r5
+L29: .data -791, 517, 55, 777
+clr *r2
+cmp #-149, #-178
+jmp *r3
+L30: .data -847, -500, -92, 958, -338
+
+m0
+jmp L91
+lea L10, L18
+cmp L70, L14
+L31: .string "qwwgtsj"
+jmp L5
+jsr L2
+L32: .data -814, -88, 321
+m3
+sub r6, *r4
+rts
+sub r6, *r7
+m1
+clr L61
+L33: .data 184, -757, -494, -653, -877, -566, 768
+; comment
+rts
+L34: .string "riggwopp"
+L35: .data 828, -698, -708, 956
+L36: dec L51
+rts
+jsr L71
+mov L106, r7
+red *r1
+sub L35, *r3
+red *r5
+red r0
+L37: .data -859, -607, -909, -848, 910, 6, -468
+cmp r5, #-153
+stop
+L38: dec L32
+sub *r0, r3
+not L19
+jmp *r3
+m0
+L39: sub L39, L39
+jmp L8
+L40: jsr L55
+L41: sub *r6, r5
+L42: mov *r1, r7
+rts
+m4
+L43: .data 101, -770, 52, -527, 205, -114
+L44: prn L41
+lea L84, r0
+m0
+m0
+L45: .data 914, 521, -792, -693, -769, 124, 949, -664
+rts
+not *r2
+cmp #58, #242
+not *r2
+add r3, L33
+L46: .string "bhklalilbzasvm"
+L47: prn *r6
+red r0
+jsr L46
+bne *r6
+jmp *r7
+L48: .string "fqzokrymc"
+L49: .data -62
+red L43
+m2
+lea L39, *r5
+inc *r2
+stop
+L50: dec L78
+L51: .string "attiwrxtwftrazsxoaomwjua"
+clr L9
+red L60
+L52: .string "ftvgovnmxdjvvefy"
+prn L2
+inc *r6
+prn *r2
+jsr *r3
+L53: .string "sorpedxzfqshx"
+; comment
+lea L22, *r4
+jsr L30
+lea L20, *r5
+L54: prn #-203
+inc L57
+L55: not r5
+L56: sub L24, r5
+m4
+m0
+bne L77
+not *r5
+L57: rts
+dec L80
+L58: .data 782, -25, -903, 869, -1000, -526, 696, 263
+m4
+dec *r0
+lea L16, L101
+m3
+; comment
+rts
+prn L0
+L59: jsr *r0
+
+prn #6
+m2
+m3
+not *r2
+m4
+red *r1
+L60: cmp *r2, *r2
+L61: .data -767, 505, -205, -388, -105
+
+m3
+L62: .data 651, 384, 514, 508, -987
+m1
+inc r5
+stop
+m2
+L63: sub #-84, r1
+dec *r3
+stop
+cmp *r0, *r6
+bne L1
+L64: lea L11, r1
+lea L40, r4
+dec *r0
+L65: stop
+jsr L3
+m0
+
+jmp L43
+bne *r0
+add *r4, r1
+cmp r5, L41
+L66: .string "pzrbhiwegrhivfouoykmzbmk"
+dec L82
+jmp *r7
+
+lea L120, r7
+L67: .data -71, 245, 338
+m2
+dec r6
+L68: .string "sfkdusflwhcyywoeesyl"
+m4
+L69: inc *r3
+L70: .string "hcikbsurgfgycytys"
+dec L46
+add *r3, *r7
+sub *r0, *r2
+lea L115, r7
+inc L87
+clr L110
+dec L103
+stop
+m4
+m2
+L71: .string "ogpzhksqewvhlevrvxrd"
+sub r3, L6
+; comment
+L72: jsr *r2
+
+jmp *r2
+sub L1, r1
+cmp #72, #-44
+L73: .string "xgjafeyltvyxmyhzsoe"
+dec L13
+L74: rts
+m3
+L75: .data -158, -108, -787, -839, 865, -653, 858
+jmp *r6
+add *r6, r0
+L76: red L0
+red L75
+mov r0, L96
+stop
+red r0
+L77: .data 284, 911, 876, 125, -646
+stop
+m3
+L78: .data 677, -77, -305, -65, 13, -909, 836
+not L98
+rts
+L79: lea L0, r7
+red r6
+mov #161, *r0
+stop
+clr *r7
+not L107
+lea L19, r2
+m3
+jmp L106
+sub #-43, r5
+clr *r7
+red *r6
+sub r5, *r5
+red *r4
+
+m2
+jmp L25
+not L28
+mov #-124, *r7
+L80: prn *r6
+L81: mov L100, L62
+
+L82: rts
+L83: .string "evmjjowkitay"
+L84: add L77, r3
+sub *r3, *r3
+m3
+L85: bne *r6
+L86: .string "phremy"
+cmp #100, r6
+L87: rts
+rts
+L88: cmp r0, L116
+stop
+L89: .string "hsqv"
+stop
+L90: cmp L74, L112
+add r2, *r6
+; comment
+m2
+m3
+add L114, L62
+L91: cmp #254, *r6
+L92: stop
+m4
+m3
+m2
+m4
+L93: jsr *r6
+m0
+red r7
+m0
+m1
+dec r0
+m4
+prn L92
+clr r1
+m1
+jsr L23
+rts
+jsr L19
+m2
+not L83
+m0
+mov L118, r5
+cmp #-151, *r7
+L94: not *r2
+cmp r0, *r5
+bne L108
+lea L42, r0
+red *r5
+stop
+L95: mov L98, *r2
+inc *r6
+L96: rts
+L97: .string "hsmgfzrnmbnx"
+m0
+L98: inc r3
+clr r0
+jmp *r4
+lea L116, *r2
+L99: .data -249, -971, -977, -676, -639, 589
+sub L45, *r3
+L100: add L5, r3
+mov r3, *r7
+jmp *r1
+red L108
+add r4, r1
+sub *r5, L107
+L101: bne L13
+; comment
+m3
+rts
+jmp L113
+L102: inc r6
+L103: jmp L106
+cmp *r1, *r7
+L104: rts
+; comment
+m0
+L105: jsr *r1
+m3
+add r3, *r0
+stop
+prn L122
+dec L122
+cmp r6, r6
+L106: dec *r2
+L107: .string "hgeydst"
+lea L30, *r2
+jsr L7
+rts
+cmp #-97, L114
+jsr *r6
+L108: mov *r3, r3
+lea L111, *r2
+L109: prn r4
+clr L118
+m0
+jsr *r5
+rts
+rts
+L110: .data -519, 255, -816, 433
+clr *r1
+dec *r5
+m4
+inc r5
+m4
+m2
+inc *r2
+L111: .data -431, 21, 448, 968, -565, -997, 486, -656
+red r7
+L112: red L110
+lea L117, *r1
+L113: mov *r6, r7
+L114: inc L122
+m3
+cmp L122, L116
+m3
+bne *r7
+m2
+L115: add L120, *r4
+stop
+jsr L72
+dec L116
+stop
+sub #254, r4
+red *r4
+m0
+jmp L117
+cmp #30, #-237
+add *r2, r4
+lea L102, r6
+lea L120, *r1
+L116: .data -295, -91, -738, -501, 651
+m2
+L117: lea L81, L87
+not r5
+jmp L118
+dec r5
+dec *r0
+m2
+L118: sub #-27, *r4
+L119: .string "wfa"
+not r1
+L120: jsr *r0
+m0
+red *r6
+L121: .data -147, 980, -569, 317, -555, -952
+m1
+
+jsr *r0
+dec r7
+cmp #-163, L32
+L122: clr r1
+stop
@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 32
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    jmp *r5
+    red *r1
+    dec r4
+    jsr *r3
+    red r1
+    sub r7, *r4
+    mov *r4, L61
+    cmp r3, *r2
+    lea L79, L46
+    cmp #-2, *r4
+endmacr
+macr m1
+    jmp *r2
+    cmp r1, #-92
+    clr L77
+    not L14
+    not *r3
+    not *r5
+    cmp r7, L60
+    jsr *r2
+    jmp *r5
+    clr *r2
+endmacr
+macr m2
+    dec L97
+    prn *r7
+    jmp L64
+    not L22
+    dec L85
+    clr r6
+    inc r4
+    mov L45, *r2
+    inc *r3
+    inc r2
+endmacr
+macr m3
+    lea L98, L83
+    lea L83, L70
+    rts
+    add #-128, r1
+    red r0
+    jsr *r5
+    rts
+    inc r4
+    dec L41
+    not *r0
+endmacr
+macr m4
+    inc L87
+    lea L51, *r0
+    stop
+    red L19
+    add L37, r4
+    dec r7
+    cmp *r6, #-175
+    mov L26, r5
+    red r4
+    rts
+endmacr
+m3
+m1
+bne L0
+L0: .string "murqamaexrxew"
+m4
+add #-11, L73
+m4
+m1
+; comment
+m2
+prn #25
+add #75, r3
+sub r1, L33
+lea L82, L16
+L1: stop
+sub r7, L1
+L2: jsr *r5
+lea L109, *r1
+
+m3
+rts
+jsr L10
+jsr *r6
+rts
+L3: bne *r7
+inc r4
+jmp L92
+mov *r6, L3
+prn L0
+; comment
+mov #55, r5
+L4: bne L30
+sub #3, L88
+m0
+m3
+jsr *r3
+stop
+m1
+rts
+; comment
+rts
+L5: jsr *r2
+L6: clr *r2
+m1
+sub r2, r0
+stop
+; comment
+
+bne L9
+inc *r5
+m0
+clr L6
+m3
+L7: .data -995, 799, 874, -626, 300, 245
+L8: prn r0
+clr *r5
+L9: stop
+not L1
+jsr *r6
+m4
+add r5, r7
+cmp L8, L108
+L10: prn *r2
+jsr L4
+bne *r7
+
+
+L11: dec *r6
+sub #-9, *r5
+L12: .string "yjpbgspfmpmax"
+m3
+m1
+; comment
+m3
+m0
+
+L13: prn r4
+dec L8
+stop
+L14: mov L1, L106
+jsr *r1
+m0
+inc L42
+L15: sub #-146, r6
+L16: prn r3
+cmp *r3, *r0
+m0
+L17: bne *r7
+; comment
+L18: .string "kjoc"
+L19: .string "tjk"
+red *r2
+mov *r7, *r4
+bne *r2
+clr *r6
+add r5, L17
+prn #24
+lea L114, *r0
+not r0
+red r7
+m1
+bne L5
+not *r5
+clr L29
+red r4
+prn #-13
+L20: cmp *r4, *r7
+L21: clr *r5
+clr L101
+L22: not L7
+L23: add r6, r2
+jmp L99
+prn r2
+jsr L80
+L24: bne L113
+jmp L59
+L25: .string "gxtxlkzssbjgraiolwklymdi"
+L26: clr L97
+L27: .string "jhxjsxfvlxtzopzcgaumg"
+red r5
+m1
+L28: inc L83
+mov *r0, *r6
+m2
+add L19, r5
+jmp *r1
+m1
+L29: .data 766, 676, -404
+m0
+L30: .string "qrlsxvlmtkfwcwaofun"
+L31: cmp L19, L31
+clr *r6
+red r0
+dec r5
+add r3, L99
+jmp L13
+clr r1
+dec *r5
+m1
+L32: .data 215
+clr L13
+inc r3
+sub *r5, *r2
+jmp *r7
+m1
+m4
+m2
+jmp *r4
+jsr L104
+L33: .data -354
+dec L94
+cmp *r1, *r3
+L34: .data -702, 439, 323, 836, -546, 216, -535, -444
+L35: jmp *r6
+m3
+m4
+cmp *r1, L12
+L36: .data -348, -935, -188, 309, 678, 189
+L37: prn *r6
+stop
+jsr L105
+jsr L33
+jsr L23
+rts
+m3
+m3
+
+m1
+m0
+L38: inc *r3
+mov *r5, *r2
+dec r2
+sub *r5, r1
+inc r7
+mov r2, *r2
+L39: inc r6
+prn r5
+dec *r2
+stop
+jsr L30
+bne L27
+m4
+cmp L9, *r2
+prn #-135
+rts
+inc L3
+red L42
+bne L54
+m0
+
+cmp #-51, L37
+L40: red L22
+m4
+jmp L21
+L41: jsr L24
+; comment
+bne *r7
+m2
+L42: dec L9
+inc r5
+red L95
+prn L53
+L43: not *r1
+m2
+inc L21
+clr r2
+jmp *r1
+jmp L65
+mov *r1, r6
+not L36
+m1
+sub L35, r5
+sub L109, r1
+m2
+L44: sub #-9, r1
+m2
+clr L86
+bne *r1
+add *r0, L75
+m1
+dec *r4
+lea L58, L51
+prn L91
+m0
+L45: jmp L80
+m0
+cmp r6, r3
+m0
+L46: prn L74
+jmp *r3
+L47: cmp *r2, L72
+L48: not L93
+L49: stop
+bne *r2
+prn #-197
+L50: jsr L35
+m3
+
+m0
+L51: .string "hhvrcsadmjsmckosjq"
+dec *r0
+cmp *r0, *r1
+not r0
+sub *r3, *r7
+bne *r5
+prn #-100
+L52: rts
+rts
+L53: inc *r6
+m2
+bne *r6
+m1
+cmp #10, *r6
+L54: jsr L109
+clr *r2
+L55: stop
+add L85, r4
+m3
+prn *r7
+L56: add r2, L26
+L57: .string "pixfcgbmsoyhbrn"
+L58: .data -692, -783, -541, 880, -362, -395
+clr L35
+prn L114
+L59: sub L32, *r1
+inc r2
+jsr *r2
+mov #243, *r5
+stop
+clr *r2
+bne L91
+rts
+L60: mov r4, r7
+bne *r0
+red *r7
+L61: .string "uniqarcwoxnnyfqkeqnmsb"
+inc L3
+sub L100, r6
+L62: clr r5
+inc r4
+jmp L76
+add *r1, *r2
+rts
+m1
+prn *r4
+m3
+rts
+m0
+cmp *r2, #-214
+L63: inc *r7
+L64: .data 131, -700
+L65: prn r5
+sub *r4, L72
+red *r7
+; comment
+m2
+
+red *r0
+prn L35
+bne *r6
+clr *r4
+bne *r6
+cmp #210, *r4
+clr L60
+m3
+inc L52
+stop
+m4
+dec *r4
+sub r1, L57
+; comment
+L66: rts
+L67: cmp *r0, #229
+lea L10, L46
+prn r3
+dec L90
+m0
+prn #194
+jsr L64
+m1
+L68: .data -494, -941, -703
+L69: .data -277, 565, 117, 664, 252, 607
+jsr L12
+m1
+L70: .string "hiitbfz"
+clr L100
+m1
+m1
+not r3
+sub L31, L101
+cmp *r0, r5
+not *r3
+mov L32, r6
+m1
+L71: jsr *r3
+m2
+m0
+L72: red *r5
+m0
+m0
+L73: .data -973
+m0
+m0
+prn *r5
+jmp *r1
+m1
+L74: bne L67
+stop
+cmp *r6, *r6
+m2
+dec r6
+sub L36, L103
+add *r4, *r7
+m3
+jmp *r1
+m1
+jmp L60
+m2
+sub L113, L110
+L75: inc r4
+red r6
+rts
+
+m2
+inc r2
+m3
+L76: bne L82
+L77: jsr L7
+clr r0
+m0
+L78: dec *r1
+L79: bne L35
+L80: .string "rtueaihihw"
+add L90, r5
+m1
+; comment
+L81: .string "fakiszhfqzvrhpov"
+add *r3, L14
+dec L87
+L82: inc L15
+mov #15, *r7
+lea L55, r2
+L83: .data -366, 665, -268, -974, 972, 96, 341, 577
+L84: red *r1
+m1
+prn *r4
+rts
+
+jmp L108
+clr *r0
+stop
+not *r7
+cmp r4, L14
+not L36
+stop
+inc *r5
+m3
+L85: dec r0
+jsr L22
+clr r5
+add #237, L52
+L86: dec *r3
+inc r0
+cmp #-196, *r6
+stop
+rts
+m1
+inc r5
+bne L111
+L87: jsr L23
+add *r0, L83
+add *r2, L102
+red r5
+dec L109
+L88: .data -659, 744
+; comment
+rts
+not L111
+L89: clr L11
+L90: red r0
+L91: .data 783, 859, -718, 124, 867, 459, 38
+prn *r2
+clr *r2
+lea L93, L97
+L92: bne L37
+stop
+m2
+dec r4
+add r6, r6
+m0
+L93: jmp L64
+cmp #38, L104
+jsr L96
+jsr L18
+L94: bne L96
+L95: .data 797, -720, 376, -180, -332, 723, -457, 465
+L96: inc *r0
+jmp *r6
+bne L114
+m1
+m0
+L97: .data -672, 744, -714
+m1
+L98: stop
+rts
+m1
+inc r3
+L99: .data -132, -841, 524, 83, 478, 721, -681
+inc *r1
+red L93
+L100: .data -986, 771, 699, 700, -880
+m4
+L101: inc r5
+bne L106
+add L61, r7
+lea L107, *r1
+red r3
+cmp r2, #127
+m1
+L102: .string "ofzvtvcvwryk"
+L103: .data 49, -211, 935, -989, 635
+add r3, *r2
+rts
+jsr L107
+cmp #-243, r0
+lea L114, L20
+sub L107, r3
+L104: rts
+inc *r7
+dec L55
+L105: red r4
+L106: not r6
+sub *r6, *r7
+inc *r1
+; comment
+rts
+m1
+L107: .data -101, 237, 959, -854, 507
+lea L91, r0
+L108: .string "zmebfglpkp"
+m2
+not *r7
+L109: jmp *r6
+bne L113
+; comment
+L110: stop
+m3
+L111: lea L73, r3
+clr L92
+red L112
+lea L60, *r3
+not r1
+sub *r6, *r1
+L112: clr *r3
+L113: .string "aikwlsclzlhxryd"
+m3
+clr r2
+L114: .data -278, 26, 272, -546, 558, 652
+m3
+m3
+stop
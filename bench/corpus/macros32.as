@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 33
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    sub r7, r4
+    cmp #-98, L53
+    cmp *r2, L92
+    red L91
+    add #210, *r3
+    clr r2
+    add #-191, *r4
+    inc r3
+    bne *r1
+    mov r0, L82
+endmacr
+macr m1
+    red L48
+    not *r2
+    jsr *r0
+    add L45, r3
+    red L89
+    rts
+    not L49
+    not *r5
+    jsr L49
+    stop
+endmacr
+macr m2
+    rts
+    dec *r2
+    dec r7
+    not *r4
+    stop
+    jsr L74
+    add L21, r5
+    sub *r5, L23
+    not r6
+    rts
+endmacr
+macr m3
+    bne *r3
+    cmp *r5, *r3
+    cmp L98, r1
+    add #66, *r3
+    bne *r1
+    jsr L40
+    cmp #-243, L46
+    rts
+    prn L57
+    prn #-176
+endmacr
+macr m4
+    cmp r5, r0
+    red L83
+    bne L93
+    clr L50
+    rts
+    mov r7, L33
+    prn L29
+    dec r2
+    jmp L46
+    clr *r3
+endmacr
+prn r4
+L0: clr L74
+bne *r4
+L1: bne *r3
+m2
+prn r4
+bne *r0
+L2: red *r2
+L3: jsr *r7
+jmp L80
+prn L81
+stop
+inc r1
+stop
+sub #235, L2
+
+inc L1
+L4: jsr L64
+L5: sub L5, r4
+inc L0
+cmp r3, L2
+prn L28
+L6: bne *r0
+inc r1
+prn L4
+m1
+m3
+add *r2, *r7
+L7: lea L47, r7
+L8: .string "fexefemvosyowt"
+cmp #-15, #-245
+L9: prn *r1
+add r1, *r2
+not L8
+L10: .data 390
+m4
+prn r2
+mov L8, *r7
+L11: stop
+L12: stop
+m3
+inc r1
+add *r3, *r0
+mov #153, L27
+not r6
+sub #111, r6
+L13: .string "wfgdxduusqqvlabwhiojpy"
+L14: jsr *r6
+stop
+m2
+L15: bne *r3
+
+bne *r7
+mov L50, L0
+add #-105, *r6
+L16: .string "dgmpltyhklssnxfle"
+jsr L88
+sub r0, r2
+jsr *r6
+cmp r4, *r0
+m4
+L17: jmp *r0
+bne L0
+m1
+stop
+L18: add *r3, *r7
+L19: inc r7
+m3
+L20: .data 86, -528, 113, 331, 559, -128
+bne *r4
+sub L5, *r5
+bne L0
+jmp *r5
+L21: mov *r5, *r6
+L22: clr r2
+jmp *r2
+rts
+L23: rts
+L24: .data 32, -508, 980, 626, 771, -242, 211
+jsr L6
+bne *r3
+red *r2
+L25: .string "bidticqxkmzpbhkcencqblvh"
+L26: prn *r0
+m4
+m0
+rts
+jsr L36
+red *r7
+rts
+mov L19, r1
+bne L37
+add r6, r7
+
+clr L12
+m4
+not *r7
+red L40
+L27: cmp *r5, r5
+cmp r5, #-253
+cmp #-157, r5
+lea L72, L6
+inc r6
+L28: jmp *r3
+cmp L24, #-44
+add #-130, *r7
+red *r7
+prn *r1
+clr *r5
+add *r0, r7
+jsr *r0
+L29: inc L24
+not L53
+; comment
+jmp L2
+stop
+sub *r7, *r0
+L30: red *r7
+L31: lea L13, r0
+L32: .data 219, 689, 927, 708, 719
+m2
+not *r7
+m0
+cmp L3, #-247
+inc r0
+m2
+prn r4
+dec r4
+L33: sub *r1, *r7
+clr *r7
+m2
+add #40, L67
+m3
+m4
+m1
+m4
+; comment
+add *r3, *r7
+
+L34: not L35
+m3
+m4
+m2
+m4
+sub *r1, r1
+bne *r1
+rts
+m0
+prn *r5
+L35: .string "dkazoiwlxchqxqplm"
+m3
+L36: mov r0, *r3
+; comment
+L37: sub r5, *r2
+
+m1
+lea L8, *r7
+prn L94
+L38: inc *r6
+mov *r6, *r5
+bne *r4
+L39: red L15
+cmp #194, #-93
+dec L65
+L40: .data 321, 533, -349, -321, -603
+L41: .string "gdtwnwfyhnuu"
+inc L97
+jmp *r5
+L42: .string "klj"
+lea L38, *r3
+red L42
+sub *r2, *r5
+L43: not *r7
+cmp #20, *r4
+L44: dec *r2
+L45: lea L20, *r1
+L46: dec r5
+stop
+prn #-206
+bne L102
+inc L96
+L47: not L88
+not *r0
+inc L25
+add #-246, L9
+add *r6, *r6
+not *r2
+dec r2
+dec L25
+add r4, L22
+red r3
+m1
+L48: dec *r2
+
+not r7
+cmp r3, r3
+m1
+clr *r1
+L49: lea L43, r5
+m4
+prn L49
+red *r0
+rts
+cmp #-164, *r6
+rts
+stop
+prn r5
+; comment
+L50: .string "bsmjelneyukzlspzhob"
+jmp L86
+m1
+m0
+L51: dec r7
+lea L100, r3
+L52: dec r3
+stop
+prn L49
+inc L52
+L53: .string "ebg"
+jmp *r6
+; comment
+mov L108, L27
+cmp #-217, #247
+L54: .data 845, -370, 627, -490
+jsr L53
+
+jmp L4
+m4
+m0
+dec r2
+mov #120, *r2
+L55: sub r1, r4
+sub #-55, r0
+L56: .string "vrmjlsjckohrruftzqd"
+red r4
+stop
+stop
+jsr *r6
+dec L95
+stop
+sub *r2, r0
+L57: lea L84, *r2
+cmp *r0, *r4
+L58: .string "jbhata"
+m0
+red L23
+not L12
+red L18
+L59: .data 729
+L60: prn L73
+; comment
+m0
+L61: clr *r6
+rts
+inc L83
+prn #-133
+dec L7
+inc *r2
+L62: .data -164, -978, 357, 770, -51
+mov L80, *r4
+mov #240, r1
+cmp r1, r4
+L63: prn L82
+mov #161, L87
+m3
+L64: lea L20, L31
+add *r2, *r0
+L65: jsr *r2
+L66: jmp *r0
+m0
+cmp r1, r3
+L67: bne L107
+jsr *r7
+jsr *r3
+not L33
+
+L68: red L111
+bne *r0
+clr r7
+L69: clr *r6
+L70: sub L1, r4
+m1
+m0
+dec r2
+L71: cmp *r2, L85
+m2
+L72: cmp L0, r5
+; comment
+bne *r6
+m1
+L73: lea L9, L101
+jmp *r5
+stop
+stop
+dec L55
+m2
+L74: .string "srgdcxk"
+L75: .data 316, 324
+red L88
+L76: dec *r0
+stop
+L77: not *r5
+jmp L68
+red L94
+
+lea L41, r0
+m0
+add r5, r5
+sub L107, r0
+dec r5
+add r0, r6
+L78: jmp L84
+m1
+L79: cmp r7, #172
+mov *r6, r0
+rts
+jmp *r3
+jsr *r0
+prn r1
+rts
+m2
+m4
+
+red L24
+m1
+L80: cmp *r5, *r1
+mov #-254, r3
+jmp L89
+stop
+m2
+clr L109
+m1
+add r1, r4
+jmp *r4
+jsr *r3
+; comment
+m4
+clr L18
+jmp L82
+L81: .data -866, 48, 144
+L82: .string "nftksrngcbneaqajpkwpte"
+add L90, L3
+jmp *r3
+L83: rts
+add r6, L91
+L84: .data 475, 106, -615, 955, 694, -916, -380
+L85: clr L109
+dec *r2
+L86: .string "hodpoindpvvxwunb"
+m4
+not L13
+L87: rts
+m2
+jsr *r3
+stop
+mov r0, L21
+L88: .data -95, -662
+m2
+L89: .string "oluuneowwtnp"
+lea L39, *r5
+stop
+red r6
+jsr *r6
+not *r5
+jsr *r1
+red r5
+m2
+stop
+m4
+clr L104
+dec r2
+L90: .string "xyazeqgzjjmopcsrcjuuthw"
+inc r0
+jsr *r0
+m0
+rts
+clr L104
+red L38
+not L37
+m4
+m0
+jmp *r2
+L91: not *r4
+L92: lea L93, *r6
+prn r5
+rts
+prn *r7
+jmp L106
+m4
+m2
+m4
+
+m4
+m0
+; comment
+m3
+jmp L98
+lea L61, L13
+; comment
+not *r5
+m4
+m3
+m0
+m0
+mov *r3, L93
+not L47
+sub #37, r2
+inc r5
+m3
+prn *r0
+m4
+prn #-154
+L93: .data -156, -994, -907, -392, 56, 602, -544, -225
+jmp L91
+inc *r2
+m1
+L94: jmp L89
+L95: .data -815, 782, -241
+m2
+L96: add *r7, r7
+
+
+L97: .string "kjzqybcyvigrsapomxvz"
+rts
+L98: .data 986, -79, 806, 579, -223, -824, -817, 976
+L99: .data -190, 960, -798
+m4
+L100: cmp r0, L58
+m2
+inc *r3
+L101: .data 847, 73
+m4
+bne *r3
+add #-162, L10
+m1
+
+jsr L20
+mov #180, r3
+not *r7
+m4
+m3
+L102: red r0
+m1
+L103: .data -231
+lea L22, r3
+L104: add r7, L33
+rts
+red *r0
+rts
+not L110
+sub r7, L11
+L105: bne *r1
+jsr *r5
+m1
+rts
+not *r1
+rts
+not *r7
+
+L106: .data 838, -937, 41, -519, 103, 358, -180
+sub L6, L108
+stop
+dec *r0
+L107: .string "gkbcjpobhktzvuwevcjauf"
+stop
+L108: lea L92, *r2
+not L111
+m0
+add *r7, L111
+bne L110
+m4
+inc *r3
+m0
+L109: .string "yprlpynxloanxyvsbfyywl"
+dec L48
+L110: not r0
+red r7
+add *r0, *r3
+m1
+L111: lea L52, L112
+jmp L112
+red r2
+red r1
+m3
+m2
+L112: .data -134, 887, 515, -553, -546, -102
+stop
+
+m3
+not *r0
+mov r5, L109
+m0
+m2
+jmp L62
+prn L76
+; comment
+rts
+jsr L36
+dec L105
+bne L99
+stop
@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 34
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    cmp #159, *r7
+    jsr L5
+    add r7, L28
+    cmp #-239, L57
+    inc r1
+    rts
+    red r3
+    red r3
+    add L50, *r7
+    mov *r3, L100
+endmacr
+macr m1
+    dec *r1
+    inc r2
+    rts
+    cmp #234, L32
+    dec *r3
+    bne *r6
+    red L27
+    jmp L25
+    jsr *r2
+    clr r4
+endmacr
+macr m2
+    inc r6
+    not r7
+    lea L70, *r0
+    jmp *r3
+    stop
+    stop
+    jsr L38
+    mov r4, L11
+    dec L58
+    mov #-254, L8
+endmacr
+macr m3
+    not L20
+    mov r7, r6
+    cmp r7, L24
+    clr L70
+    inc r4
+    jmp *r6
+    clr *r5
+    stop
+    sub r5, r0
+    prn #-181
+endmacr
+macr m4
+    rts
+    lea L11, L34
+    dec r3
+    prn *r5
+    inc *r3
+    jsr L71
+    jmp L75
+    stop
+    rts
+    prn L84
+endmacr
+L0: rts
+m2
+add L35, *r7
+bne *r4
+m1
+not L0
+jsr *r0
+m1
+; comment
+red L0
+m4
+sub #14, r7
+jmp *r3
+red r3
+jsr *r6
+inc r7
+stop
+jmp L80
+m0
+L1: .string "osgpirmxfdtrlezfrum"
+m3
+lea L94, L68
+red r1
+dec *r6
+lea L0, L25
+L2: .data 704, 959, 145
+mov L0, r2
+sub *r3, *r3
+mov r2, *r7
+L3: lea L14, L13
+stop
+not L3
+sub *r4, L1
+m2
+L4: .string "ammubsmsv"
+L5: bne *r7
+m4
+L6: red r6
+L7: not r1
+m3
+clr *r4
+L8: cmp #196, L84
+lea L0, r1
+dec r2
+L9: .string "dpcfqrnisjqfsklmbq"
+L10: .string "whdn"
+L11: .data -810, 12, -128, 195, -564, 735
+m4
+stop
+bne *r5
+m0
+add #37, *r7
+m2
+m4
+prn #-3
+lea L4, *r0
+L12: clr L7
+rts
+L13: inc *r0
+clr *r4
+cmp #60, *r6
+m1
+red r5
+jsr L13
+m0
+lea L8, L66
+m4
+bne *r5
+m2
+prn r7
+stop
+lea L77, L0
+jsr L4
+L14: .data -380, -573, -788
+add r2, L1
+mov *r4, *r5
+cmp *r2, r2
+red r0
+prn *r3
+rts
+jsr L28
+m2
+L15: .string "gkckkruvgeqqfrsujuyio"
+L16: .string "jrmc"
+L17: mov #186, r7
+dec r3
+m1
+L18: .string "ndmsljl"
+cmp *r5, r6
+bne L60
+sub L10, L5
+inc r6
+m0
+not L0
+L19: cmp L29, *r5
+cmp *r4, L30
+jmp *r0
+m0
+red L14
+m3
+L20: sub L45, L50
+rts
+cmp *r2, r5
+prn *r4
+L21: bne *r0
+jmp *r5
+m3
+inc *r3
+add L40, *r6
+mov L9, r4
+L22: dec L18
+stop
+inc *r2
+cmp #98, #-133
+m2
+m1
+m4
+rts
+L23: add r3, *r1
+mov r7, *r1
+; comment
+
+L24: mov r3, r2
+m0
+inc *r4
+lea L74, L40
+m4
+L25: .data 410, 610, -3, -608, 314
+sub #-135, r0
+L26: jmp L26
+add *r5, *r3
+sub L26, r7
+add r4, r1
+
+L27: .string "prwchfukzdmndr"
+m4
+dec *r6
+m2
+stop
+m2
+L28: .string "o"
+L29: .string "geuholkduiveflunkpdwz"
+inc r1
+
+cmp *r1, r7
+stop
+m4
+m1
+m1
+stop
+m3
+; comment
+bne L29
+not r6
+m4
+cmp r5, L4
+sub r3, L35
+L30: .data 953, 690, 54, 462, -825, -874, -150, 849
+dec *r7
+cmp L100, #-154
+red L5
+L31: red *r1
+dec r7
+mov L104, L72
+m3
+
+cmp #-105, r6
+m0
+rts
+; comment
+jmp L8
+inc r4
+m1
+L32: .string "olfzkuhcnbusxw"
+stop
+jsr L59
+L33: sub #67, L31
+L34: cmp L4, L61
+add #-32, L14
+not *r3
+L35: .data -741, -518, -208, 306
+m4
+mov r6, *r5
+dec L49
+bne L31
+not r3
+inc r7
+inc r0
+
+L36: rts
+inc r1
+jmp *r3
+jmp L5
+add #-3, L54
+lea L99, *r5
+not r7
+cmp #187, r3
+m0
+red *r4
+L37: .data -925, 649, 366, 478, 312, -235
+L38: prn L65
+lea L41, L11
+m0
+not L89
+rts
+L39: cmp #-104, #-247
+not r3
+jsr L3
+L40: clr *r6
+m3
+red *r3
+m1
+L41: jsr L41
+sub L93, r4
+m1
+prn *r1
+not *r5
+m3
+m2
+rts
+not r5
+m4
+jsr L13
+L42: .string "suuoxcadawytlyedejyp"
+m1
+L43: clr L7
+L44: .data -747, 242, 227, -777, 466
+jmp L87
+m0
+mov L58, r6
+m1
+m3
+L45: .string "yrbeczemiuhmvb"
+m1
+add #212, *r5
+m0
+L46: rts
+not L97
+jmp L80
+
+; comment
+m1
+add L63, r2
+rts
+
+L47: mov *r1, *r1
+L48: rts
+add #149, *r7
+jsr L91
+inc *r5
+; comment
+L49: .data -212, -936, 124, 106, 181, 754
+not r3
+rts
+L50: jsr *r1
+L51: prn #-99
+jmp *r3
+L52: not *r1
+jsr *r0
+
+m0
+bne L1
+m4
+dec r5
+rts
+sub r2, *r5
+L53: sub r2, *r3
+L54: .data 297, 241
+not *r1
+not r2
+L55: .data 235, -706, 829, -642, -678, -521, 308, 511
+L56: jmp *r6
+dec L62
+
+L57: cmp #-243, L40
+m2
+m1
+m1
+m4
+L58: .string "yneznclpyiwp"
+L59: .data 78
+m1
+
+inc *r6
+red *r7
+m3
+mov *r0, r7
+m4
+L60: clr *r7
+m3
+m4
+cmp *r4, *r0
+sub #99, L23
+m4
+inc r1
+bne *r4
+; comment
+L61: .string "fwzkvwddjkusxaaolm"
+prn *r0
+m2
+L62: rts
+mov r6, L60
+m4
+add L70, *r1
+sub #-195, *r4
+m4
+m4
+; comment
+m2
+inc L78
+add L93, r7
+m0
+m3
+m4
+stop
+stop
+lea L99, *r6
+L63: sub #-5, *r7
+prn r6
+jsr L24
+L64: jmp L93
+cmp #-150, *r1
+add #255, L49
+; comment
+m1
+clr r6
+L65: .data 249, -486, -667, -67, 177, -314, -473
+add *r4, L41
+m3
+m2
+
+m3
+L66: .string "mlntmahzvx"
+m3
+L67: bne L40
+mov *r0, *r3
+m1
+jsr *r0
+L68: jmp L57
+m4
+inc r5
+not L104
+L69: lea L14, r5
+mov *r3, r0
+L70: .data 214, -411, 512, 495, 879
+m3
+m4
+L71: .data 793, 547, -897, 797, 414, -572
+sub #155, *r1
+red L16
+jmp L88
+L72: dec r6
+L73: prn *r7
+sub #-164, r6
+add r5, r2
+cmp r0, #-42
+stop
+add L27, L103
+m0
+L74: dec r7
+L75: .data -99
+
+m2
+prn L42
+L76: .string "ohsxrupkhomgpnifeibf"
+lea L79, r3
+stop
+add *r1, r3
+clr r0
+prn *r1
+L77: inc *r3
+not *r0
+L78: bne L89
+
+clr L96
+L79: add *r7, L96
+rts
+L80: bne L61
+L81: .data 578, -857, 50
+L82: .string "gesbbmmmeazkbwl"
+stop
+L83: add #-95, *r7
+cmp r5, L87
+red *r5
+sub #16, L102
+bne L42
+sub L59, L64
+m4
+L84: .string "lnoiotpynhkhgmmymycxffyc"
+bne L95
+mov r5, *r0
+not L42
+jsr L100
+rts
+rts
+rts
+L85: red *r5
+stop
+inc L6
+red *r1
+lea L76, r6
+cmp r1, #-100
+L86: .string "clmlizvoqvpgvutjshiinast"
+cmp r0, L89
+m3
+stop
+L87: dec L103
+L88: not r0
+m0
+L89: add r1, r6
+stop
+cmp L37, L80
+jmp L103
+add r3, r2
+jmp *r1
+prn *r5
+m0
+jmp L93
+prn L99
+; comment
+m0
+sub *r2, r2
+L90: .string "gtbmcixazlheakynlhakxn"
+add *r7, r7
+red r6
+cmp r4, *r2
+L91: clr r0
+add *r1, r3
+
+clr L98
+cmp #203, #-238
+m3
+stop
+stop
+L92: .data 323, -133, 939, 66, 118, 240, 759, -749
+dec r3
+not L93
+sub #172, r4
+cmp r3, r7
+m3
+L93: .string "i"
+prn *r0
+L94: sub L103, L34
+L95: lea L103, *r5
+L96: rts
+jmp L102
+not r0
+clr r1
+red r4
+add #-44, *r2
+m1
+inc L77
+L97: add #223, L91
+L98: cmp *r6, r2
+L99: bne *r0
+not r5
+L100: prn *r3
+m2
+prn #-48
+L101: bne *r0
+rts
+not L17
+m4
+m3
+m0
+red *r4
+m4
+dec r6
+L102: cmp *r2, L104
+; comment
+m1
+dec *r7
+bne L104
+m1
+add #-7, L103
+add #255, *r1
+cmp *r3, *r2
+jsr L103
+lea L103, r7
+not r7
+m0
+not r4
+m4
+prn #-149
+sub #139, L96
+rts
+L103: .data -533, 687, -580, 775, -458
+L104: .data -505, -314, 191, -84
+dec r7
+cmp *r2, L25
+dec r6
+cmp #168, #-22
+rts
+mov #-218, *r7
+jmp *r7
+jmp *r5
+clr r2
+jmp L26
+stop
+red *r6
+stop
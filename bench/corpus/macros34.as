@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 35
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    red r0
+    lea L10, L72
+    cmp *r3, L57
+    jmp L111
+    lea L102, *r7
+    red *r4
+    add *r6, L40
+    sub #191, *r6
+    bne *r7
+    red r3
+endmacr
+macr m1
+    dec r6
+    not r1
+    clr *r7
+    stop
+    not L37
+    clr *r2
+    sub #82, *r6
+    cmp L20, r6
+    inc *r2
+    stop
+endmacr
+macr m2
+    cmp r3, *r2
+    not r5
+    mov r3, *r2
+    cmp L103, r0
+    red r2
+    sub r7, L82
+    inc L83
+    jsr L3
+    red L31
+    bne L70
+endmacr
+macr m3
+    jmp *r1
+    clr L47
+    prn #48
+    lea L53, L80
+    inc *r4
+    jsr L71
+    mov #-135, *r4
+    jmp L77
+    inc *r2
+    inc r0
+endmacr
+macr m4
+    clr L59
+    stop
+    mov L85, *r7
+    dec r2
+    not r5
+    inc L34
+    clr r0
+    clr r2
+    rts
+    mov L77, r0
+endmacr
+m3
+L0: .string "kcuutmdtiexz"
+jsr L0
+L1: add *r5, r0
+L2: add L1, L0
+jsr *r0
+L3: prn L27
+dec L49
+dec L112
+stop
+add r6, r1
+jmp *r0
+bne L14
+add *r3, *r6
+mov L0, r4
+prn *r6
+red *r4
+m3
+L4: add r3, L0
+L5: jsr L1
+L6: jmp L2
+clr *r7
+sub L38, r0
+cmp r0, *r7
+not *r1
+inc *r7
+bne *r5
+add *r5, r2
+m1
+m3
+bne L40
+m4
+L7: inc r6
+rts
+L8: add *r2, L78
+prn *r0
+m2
+m3
+sub *r2, *r1
+m0
+m2
+L9: .data -825, 761, -830, 461, 275, -314, 436
+L10: cmp *r4, #-141
+L11: lea L8, r0
+; comment
+; comment
+L12: mov L45, r5
+m4
+inc r7
+m4
+sub *r4, *r5
+cmp #88, #-205
+red r1
+rts
+cmp *r2, *r3
+m1
+add #-53, r0
+L13: bne L93
+m2
+m2
+red *r0
+jsr L9
+L14: .string "qfzogksezlyszuccwgubztmh"
+; comment
+; comment
+lea L8, L4
+rts
+L15: mov L11, *r5
+m2
+lea L102, L87
+cmp r2, *r3
+stop
+L16: sub r5, L86
+m2
+lea L40, L21
+stop
+jmp L1
+mov r2, L14
+L17: red L4
+; comment
+jmp L86
+jsr L31
+clr *r2
+m3
+L18: not r1
+lea L10, r5
+L19: .string "lyszcsslhw"
+cmp r5, r6
+prn *r4
+m2
+dec L1
+L20: clr *r0
+jsr L28
+jsr *r7
+m4
+clr L102
+not L82
+mov L11, L70
+inc L19
+m3
+jmp *r3
+lea L104, r7
+rts
+red L108
+m2
+
+prn #119
+m4
+sub L34, r2
+jsr L9
+clr r6
+
+lea L12, L67
+L21: .data -729
+bne L76
+L22: .string "r"
+mov *r2, L17
+inc L10
+inc r7
+bne L17
+sub #-187, r6
+m3
+m1
+lea L5, L93
+bne L0
+
+L23: .string "huteiomepkdzzotxmlkqm"
+L24: .data 745, 27, 968
+lea L1, r5
+m2
+jmp L33
+not r0
+L25: dec L49
+L26: .string "vjufjudwizuxnpeqhpoih"
+; comment
+jmp *r3
+cmp #160, *r0
+L27: not *r3
+rts
+L28: .string "kcsbqbzlmnv"
+dec *r3
+m1
+L29: add L64, *r6
+m3
+clr *r2
+m2
+clr r1
+red L2
+prn r1
+L30: .data -739, 957, 470, -839, -16, 413
+mov L1, r5
+; comment
+prn #-126
+add #60, *r7
+m3
+L31: .data -169, -928, -711, 21, 610
+red L85
+dec r3
+lea L62, *r2
+m2
+m0
+clr L77
+L32: prn r5
+clr *r2
+bne *r3
+jsr L69
+inc L28
+L33: cmp L28, *r0
+m4
+jsr *r6
+m1
+mov r3, L31
+L34: stop
+L35: .data -202, 513, -189, -533, -126, 964, -907
+m0
+m1
+L36: stop
+L37: rts
+jmp L16
+L38: lea L102, *r5
+sub L42, L25
+inc L63
+inc L5
+clr r0
+rts
+L39: .string "wjltqbtbjfqkr"
+L40: prn #-249
+L41: .string "pdqolzxduemmgrpda"
+cmp *r2, #-255
+dec r1
+m2
+m3
+L42: stop
+inc *r0
+not r4
+m0
+L43: .data -780, 44, 26, -870, -941
+; comment
+m3
+m0
+mov r5, L83
+inc L22
+jsr L7
+sub #-68, L92
+clr r2
+; comment
+prn r1
+L44: .data 936, 359
+stop
+; comment
+sub #-196, r6
+mov L83, *r1
+L45: .string "cyzkfmclmuilgski"
+jmp *r5
+m3
+m4
+jsr *r4
+red L44
+m3
+jmp *r7
+m3
+m0
+inc r7
+stop
+m2
+bne L51
+dec L24
+m2
+clr r6
+lea L91, r6
+lea L106, *r7
+prn *r1
+L46: .string "v"
+dec r2
+
+inc L19
+; comment
+L47: .string "hqprruvhpdmyfxlx"
+inc *r1
+dec *r2
+add #-137, r3
+dec *r4
+L48: lea L14, L7
+bne L2
+L49: add #-45, L108
+L50: .data 675, -770, -294, 448
+m0
+L51: sub *r4, L85
+L52: clr r3
+mov *r3, r0
+clr r2
+L53: .string "qcgssvsdnqp"
+L54: not *r2
+add #-56, *r1
+sub *r5, *r6
+not L40
+prn r7
+clr *r6
+m0
+L55: .string "tzybgccd"
+dec *r0
+inc *r2
+not L51
+inc r4
+
+dec r4
+m2
+; comment
+red r5
+L56: sub L40, L57
+bne *r3
+; comment
+m2
+m1
+sub r7, *r4
+dec L8
+lea L110, L46
+jmp *r4
+jmp *r7
+L57: red L83
+L58: red *r7
+jmp L60
+L59: .data 311, 308, -626, -147
+sub #104, L66
+inc *r7
+prn r7
+
+inc r5
+L60: .string "jcdu"
+L61: red L86
+add r2, *r1
+
+dec L6
+jmp *r1
+red *r0
+m4
+cmp *r6, *r1
+stop
+mov r3, L4
+L62: cmp L11, *r2
+L63: rts
+jsr *r4
+stop
+clr L111
+m0
+cmp *r2, #69
+m2
+red r6
+L64: lea L52, L71
+dec *r2
+m1
+L65: prn L34
+red L109
+sub r5, *r3
+not L27
+prn #-146
+L66: .string "l"
+lea L98, r6
+m0
+L67: .data 39, -70, 766
+lea L112, L6
+L68: clr r4
+L69: .data 205, -619, -550, 522, -316, 389, -918
+prn *r0
+m1
+m0
+L70: dec *r4
+dec L52
+sub r0, L66
+L71: clr r3
+lea L43, L81
+stop
+lea L0, r6
+sub *r7, *r1
+inc r6
+cmp *r0, L84
+m3
+sub L71, r0
+bne *r5
+rts
+; comment
+rts
+mov L107, r2
+clr L54
+m2
+m0
+rts
+rts
+m0
+L72: not r6
+jsr *r6
+; comment
+not L90
+L73: .data 523, -534, 680, -816, -1, -265
+lea L64, r7
+sub r5, *r4
+L74: inc *r3
+L75: rts
+L76: clr L80
+m1
+sub *r6, r2
+jmp L100
+lea L76, r4
+L77: .data -316, 47, 552, -399
+m4
+m3
+dec L10
+stop
+L78: rts
+
+m2
+L79: .string "eueecnnygoqp"
+L80: prn *r1
+
+inc r2
+bne *r3
+L81: bne L112
+L82: add r6, L102
+stop
+rts
+bne *r3
+prn L23
+L83: inc r5
+L84: .data -36
+rts
+L85: .data -767, 754, -436, 651
+
+L86: dec *r5
+m2
+m0
+jmp L110
+lea L91, L87
+cmp r3, #-80
+rts
+bne *r0
+jsr L9
+
+inc r3
+bne L26
+
+L87: lea L100, L70
+L88: .data 975, 514, -992, -856, 638, 342
+prn r4
+m4
+clr *r3
+L89: jsr L102
+m0
+jmp *r4
+jsr L63
+sub L112, r6
+m2
+L90: jsr *r0
+lea L4, *r1
+m4
+dec L35
+lea L62, r3
+lea L92, L107
+mov #67, L84
+m2
+L91: .data -872, 875, 350, 185, -642, 76, -842, 528
+dec *r7
+add *r1, *r6
+lea L93, L104
+prn L109
+lea L10, L10
+prn #224
+sub r4, r3
+not r5
+L92: dec r5
+stop
+dec *r6
+bne *r5
+red *r2
+L93: .string "dguihxwsaljkujdl"
+stop
+red *r6
+L94: lea L65, L101
+prn r1
+L95: .data -633, 179, -569, -48
+bne *r1
+L96: .data -138, 655, 637, -585, 289, 531, 681, 47
+dec *r6
+L97: .string "dumklftzccqsdanpbfrnz"
+rts
+L98: .data 506, -462, -235, -771
+L99: .data -866, -133
+L100: mov #-85, L105
+L101: cmp L111, *r0
+lea L60, *r7
+L102: .data -583
+not *r1
+bne *r7
+inc r1
+L103: dec L111
+L104: mov r5, r4
+rts
+dec *r7
+mov r6, r4
+m4
+m2
+L105: .data -689, -746
+prn *r4
+lea L107, *r5
+lea L107, r3
+L106: stop
+L107: sub L55, *r0
+bne L110
+m0
+add r2, *r4
+rts
+L108: clr L69
+lea L91, L99
+clr *r5
+sub *r6, r1
+rts
+inc r3
+L109: .data 84, 429
+m0
+L110: clr r5
+m4
+lea L112, *r2
+clr r5
+L111: .string "rznubdyfu"
+bne *r6
+cmp L112, r4
+stop
+jmp L112
+bne *r3
+clr r4
+bne L112
+m3
+prn *r0
+red L112
+rts
+L112: .data -787, 645, 12, -997, 327, 865, 861, -7
+red r5
+
+add L111, r4
+cmp L86, #54
+jmp *r6
+stop
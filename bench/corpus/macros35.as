@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 36
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    jsr *r6
+    not L33
+    dec r3
+    mov r6, r7
+    not L33
+    clr r0
+    clr r5
+    red *r7
+    bne L59
+    dec r7
+endmacr
+macr m1
+    prn r7
+    stop
+    red r0
+    jmp L111
+    cmp L59, *r7
+    dec r6
+    clr *r7
+    add #-128, *r0
+    sub *r5, *r6
+    dec L10
+endmacr
+macr m2
+    add #-149, r0
+    jmp L44
+    bne L73
+    mov *r5, L109
+    lea L33, L98
+    inc *r6
+    jmp *r4
+    jmp L2
+    cmp *r3, r7
+    jsr L87
+endmacr
+macr m3
+    stop
+    add #232, *r3
+    red r4
+    not *r3
+    rts
+    lea L54, r4
+    jmp L7
+    clr L29
+    cmp L47, *r2
+    red r5
+endmacr
+macr m4
+    jsr *r4
+    stop
+    lea L104, L24
+    add *r3, *r2
+    sub #-123, L50
+    red r6
+    dec L63
+    bne *r1
+    stop
+    mov #-236, *r0
+endmacr
+add *r1, r0
+sub r1, r6
+jsr *r2
+m4
+L0: rts
+m1
+m2
+m0
+; comment
+m2
+rts
+jmp *r5
+jmp *r7
+rts
+inc *r0
+not r7
+dec r6
+; comment
+add *r2, *r4
+L1: sub r7, r0
+L2: mov #-163, L3
+m1
+L3: not r2
+m0
+add #199, L30
+L4: mov r3, *r6
+L5: prn *r0
+prn *r0
+prn *r0
+inc r7
+m0
+L6: lea L2, r7
+stop
+m4
+L7: clr L87
+inc r4
+sub #-138, *r2
+L8: inc *r5
+; comment
+inc *r1
+L9: jmp L7
+jsr L1
+; comment
+m2
+
+L10: .string "mcftnzh"
+L11: add r7, L20
+m4
+
+L12: jsr L12
+m4
+L13: .data -954, -751, 314, -793, 530
+L14: dec L12
+m3
+; comment
+dec r0
+inc *r3
+jsr *r3
+m4
+clr r7
+lea L7, *r4
+m4
+lea L78, L66
+L15: lea L13, L45
+m2
+L16: .string "fnfmswdegbvpj"
+stop
+not r7
+m2
+add L16, *r0
+add #-86, r6
+m2
+L17: jsr *r7
+stop
+m0
+rts
+m2
+L18: .data -229, 819, -853, 352, -106, -989
+bne L103
+stop
+L19: dec r1
+not r7
+L20: .data -25, 348, -302
+mov *r2, r2
+; comment
+; comment
+prn r6
+dec L21
+m2
+m2
+m0
+L21: .data -630, -831, 910
+; comment
+L22: prn L7
+m1
+prn #-163
+mov *r4, *r4
+bne *r3
+m4
+m0
+prn r2
+L23: red L16
+jmp L59
+add #197, L19
+m4
+m2
+L24: .string "glljakgcdifxqbbwgvrk"
+lea L43, L64
+m1
+m2
+not *r0
+m4
+rts
+m0
+sub #74, L7
+
+L25: rts
+L26: cmp r7, L38
+m1
+bne L117
+L27: bne *r6
+L28: cmp *r0, #143
+L29: .string "yntolyostckryezeyykzddp"
+L30: lea L74, r3
+stop
+red r6
+sub L27, *r6
+stop
+bne L29
+prn L39
+inc *r2
+L31: prn L109
+L32: cmp r6, L27
+sub #-35, r7
+sub r4, L16
+m3
+L33: .data -675, -340, -112
+L34: .data -102, 97, -194
+L35: jsr *r5
+
+L36: inc *r3
+not L1
+bne L62
+jmp *r7
+cmp #-77, L50
+clr *r0
+sub #33, *r7
+L37: mov #-55, L113
+m3
+m4
+m3
+bne *r1
+inc r0
+sub r2, *r1
+bne L109
+lea L25, L5
+stop
+L38: .data -636, -913, -459
+dec r1
+
+m3
+L39: mov #252, L21
+stop
+bne L92
+L40: cmp L53, L99
+m2
+m0
+mov #234, *r5
+sub *r7, r2
+L41: .data 753, -602, -761, -160, -509, -640, -113
+mov r7, L49
+mov r4, *r7
+
+m2
+L42: lea L75, L113
+inc *r0
+dec r3
+stop
+add L5, r6
+L43: jmp L58
+red L111
+mov L23, L65
+dec *r3
+jsr *r7
+prn L0
+clr *r7
+jmp L46
+
+cmp #-143, L80
+add L40, L45
+dec *r5
+m2
+dec *r1
+red *r3
+L44: sub *r3, *r2
+jsr *r5
+m1
+bne L25
+red r0
+L45: sub #-95, L40
+m1
+inc *r2
+dec *r1
+not *r5
+jsr *r1
+bne *r5
+mov r4, *r3
+L46: prn #95
+stop
+stop
+add *r5, r2
+L47: jsr L39
+L48: not L31
+jsr L29
+jsr *r3
+cmp #-77, L27
+L49: stop
+mov *r1, *r6
+bne L46
+jsr L117
+m0
+m4
+rts
+
+m3
+bne L91
+stop
+add #33, L80
+L50: prn r0
+bne *r5
+L51: inc L2
+m3
+lea L106, L41
+L52: jsr *r2
+rts
+m4
+prn *r4
+add L45, *r3
+not L12
+inc *r4
+inc *r7
+jsr L100
+L53: dec *r5
+
+jmp L18
+lea L114, r5
+m2
+clr L108
+sub r3, *r3
+red L26
+lea L4, L29
+L54: mov *r5, *r2
+L55: red *r7
+m3
+jmp *r6
+sub *r0, L110
+dec L48
+L56: mov r3, *r4
+clr *r7
+dec *r6
+jsr *r1
+
+L57: rts
+cmp L31, *r3
+red r4
+m1
+L58: rts
+; comment
+L59: .data 861, 994, 163, -523, -274, -363, -275
+m3
+m4
+not r6
+L60: lea L5, r2
+clr *r7
+not *r6
+m4
+jsr *r6
+sub r5, L31
+mov r0, r5
+prn r2
+clr r4
+cmp #-237, #-18
+lea L7, *r4
+red r4
+
+jmp L41
+cmp *r1, *r1
+; comment
+inc L2
+stop
+L61: .data 993, 161, 741, 731
+m0
+L62: .string "odbddnuxsfthpbpciqklnats"
+jsr *r3
+L63: rts
+stop
+inc *r2
+not L99
+L64: .string "rtopgufxtqhlvm"
+L65: .string "ojagreppjixxcleiixcvqwx"
+L66: .string "jsfvvhozzuccwb"
+L67: .data 870, -572, -127, 189, 400, 715, 581
+
+L68: .string "mpywcxbvbucis"
+jsr L48
+rts
+L69: mov #-245, *r4
+inc L78
+dec L87
+inc r2
+dec *r7
+dec L2
+red L119
+L70: stop
+add *r5, *r3
+L71: jmp *r4
+m3
+inc *r7
+L72: not r5
+m4
+L73: lea L20, r6
+sub *r6, L119
+L74: inc *r1
+
+not *r6
+L75: red L75
+m2
+m4
+sub r4, L45
+sub *r2, L35
+L76: cmp #-224, r3
+dec r6
+prn #74
+L77: rts
+dec r3
+L78: jsr *r7
+
+inc L115
+m1
+prn L111
+rts
+m1
+L79: .data 872, -215, 445, 42, 999, -310, -412, -959
+L80: not L8
+bne *r6
+jmp *r3
+jsr L72
+dec L90
+; comment
+m3
+L81: .data 988, -539
+stop
+cmp *r4, *r3
+m3
+inc r3
+m1
+prn #-12
+lea L81, *r3
+L82: jsr L65
+jsr L103
+add *r4, *r0
+L83: red r1
+red *r0
+jsr *r3
+m0
+L84: clr *r5
+L85: .string "aiioivtjyooxcnbpvwpjl"
+m3
+m2
+jmp L72
+L86: .data 855, -353, 959
+m2
+m4
+L87: .data -111, 360, 287, -431, -214, 510, -343, -527
+clr L40
+lea L46, r4
+L88: not r0
+L89: inc r4
+L90: .string "cngxyxtdwsabqd"
+sub *r7, L90
+m2
+prn *r3
+
+rts
+L91: .string "hxtkzmkmze"
+m3
+L92: .string "egwcxqnbszuszpvmcqtmfo"
+L93: prn r5
+sub *r6, *r7
+L94: jsr *r1
+stop
+bne L2
+m0
+m2
+L95: .data 23, 214, 37, -27, 147, -843, 199
+m1
+clr *r5
+L96: rts
+stop
+bne L100
+L97: stop
+dec L8
+lea L108, r4
+clr L27
+L98: .string "bhmfkfvwfzmnmr"
+L99: bne *r7
+dec r6
+sub #-11, L101
+L100: .string "nuiglpqqoydvw"
+clr *r2
+rts
+red *r2
+; comment
+L101: .data 532, 832, -868, 427, -511, -963, -854, -816
+L102: not *r5
+clr r2
+L103: .string "y"
+L104: prn *r7
+stop
+clr *r6
+m3
+L105: rts
+m0
+not L38
+L106: .string "scceevwbpnoplzksswyutm"
+not L117
+sub #-101, L110
+mov #-12, *r3
+lea L119, r0
+add *r2, L107
+not *r6
+cmp L117, #-159
+jsr L121
+m4
+dec L6
+L107: .string "kbidsrquvrmlzxlsqcaxv"
+L108: .data 757, 177, 807
+clr L16
+inc r3
+prn *r1
+m2
+m0
+sub L55, L118
+rts
+L109: red r0
+prn #-200
+L110: prn r0
+; comment
+L111: mov L118, L113
+inc *r3
+L112: .data -195, -504, -884, -800
+add r0, L37
+m1
+L113: .data -489, -127, 253, 796, 898
+m1
+L114: not L76
+m1
+rts
+L115: prn *r2
+L116: .string "visucosxlswksonjsoevibx"
+prn #-232
+bne L119
+not *r5
+inc r4
+m3
+cmp #-61, L65
+L117: mov #163, *r7
+inc r3
+prn #15
+jsr L44
+m4
+prn *r1
+not r1
+L118: red *r4
+red *r1
+m4
+rts
+L119: jsr L120
+bne *r6
+jsr *r6
+m0
+stop
+m2
+sub #94, r1
+L120: .string "ipfacrwisopifznyslcjoqlj"
+L121: .data 803, 791
+m0
+mov r4, r0
+sub r5, *r0
+add r3, r3
+clr L122
+bne *r1
+jsr *r0
+jmp L23
+stop
+not *r4
+m3
+inc L122
+stop
+L122: .data 266, -817
+stop
@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 37
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    add r5, r7
+    inc L26
+    jsr *r5
+    red r1
+    inc r5
+    cmp #113, *r4
+    dec r3
+    not r5
+    cmp #-76, *r7
+    sub r5, L56
+endmacr
+macr m1
+    bne L70
+    red r5
+    prn L107
+    cmp #-96, r4
+    prn r4
+    cmp *r3, #54
+    add r4, *r6
+    jsr L119
+    inc L109
+    sub r4, r5
+endmacr
+macr m2
+    cmp *r3, r2
+    rts
+    not r3
+    lea L22, *r6
+    sub r0, *r7
+    jmp L19
+    red *r1
+    cmp *r6, #-50
+    clr L22
+    stop
+endmacr
+macr m3
+    add *r6, r4
+    rts
+    jsr *r2
+    clr *r7
+    red *r5
+    add r4, L31
+    not L95
+    stop
+    stop
+    jmp L0
+endmacr
+macr m4
+    sub L24, *r2
+    cmp #-160, r0
+    cmp *r0, L59
+    jmp L119
+    jsr L63
+    clr *r2
+    cmp r3, *r7
+    prn L26
+    rts
+    add *r6, *r6
+endmacr
+stop
+sub *r3, L5
+L0: cmp L27, #108
+add L45, L0
+L1: rts
+prn *r1
+prn #-126
+lea L0, r0
+L2: prn #9
+L3: .string "vsp"
+m1
+cmp *r5, #-244
+sub *r5, L2
+bne *r0
+rts
+m3
+jsr *r0
+L4: .data 107, -339
+add #-11, r2
+bne L3
+L5: .string "vmsecqmu"
+add #36, *r6
+prn #-10
+m4
+lea L53, r2
+dec L3
+add L58, r6
+sub *r5, *r7
+lea L74, L80
+L6: clr r5
+L7: .data 487, 103, -731, 841, -428, 970
+mov L18, *r7
+rts
+cmp #-242, *r3
+m3
+prn #148
+prn #59
+L8: .string "cdevfexvrjshugljbngvywc"
+red L26
+bne *r4
+L9: add r2, r0
+stop
+add L0, L3
+L10: prn *r4
+m3
+add r5, *r5
+add *r6, r4
+cmp L75, L2
+clr *r3
+bne L7
+m4
+L11: jsr L11
+
+m2
+stop
+L12: not *r5
+cmp L6, L25
+; comment
+mov #193, r0
+dec *r7
+red r7
+jsr *r6
+m2
+rts
+cmp r3, #151
+cmp r1, #-93
+L13: .string "llaflvbmqtmppbalcun"
+L14: clr L7
+m2
+L15: .string "k"
+m0
+L16: mov r7, r2
+cmp *r2, r2
+jsr L3
+m0
+m3
+dec r7
+m4
+L17: clr *r3
+L18: prn *r1
+bne L1
+L19: .string "fqzvlphipuaavrnkyju"
+jsr *r2
+m3
+prn r0
+m1
+add *r4, *r7
+; comment
+L20: .string "alympauugao"
+L21: .data -895, -517, 944, 332, 536
+sub *r4, L10
+m3
+add #149, L6
+m0
+lea L2, *r2
+m2
+lea L68, L60
+inc *r3
+L22: .string "ajuziigopvetvzvdjq"
+m3
+m2
+rts
+lea L25, L0
+prn *r6
+L23: .data 535, -241, -782, -759, -803, -442, 634
+jsr L14
+clr *r4
+dec L44
+prn r0
+mov *r4, *r0
+L24: .string "ejuz"
+m0
+m2
+m0
+L25: .data -532
+L26: lea L25, *r2
+mov #210, L8
+L27: .data 577, 253
+L28: rts
+jsr *r5
+L29: jmp L16
+clr L78
+L30: cmp *r0, #-116
+L31: sub r3, r0
+dec r6
+clr r0
+; comment
+mov #87, L28
+cmp r0, r1
+; comment
+mov *r0, r3
+jmp *r0
+L32: .string "asjcrfscmfo"
+not r3
+sub r0, L35
+inc *r6
+rts
+L33: add r5, r1
+dec r5
+m0
+L34: bne L37
+prn *r4
+L35: inc r6
+sub #61, L59
+jsr *r5
+lea L104, *r2
+m3
+L36: dec *r2
+jmp L9
+add r2, *r5
+red L107
+L37: .data 39, -244, -902, -614, -901
+L38: .data -635, 886
+clr L14
+m3
+sub *r1, r0
+lea L7, L30
+dec r6
+inc *r7
+sub L96, L23
+m3
+L39: .data 465, 29, 901, -82, -40, -502
+L40: .data -211, 582, -473
+mov #242, L51
+stop
+jsr L35
+m1
+m2
+not r1
+L41: jmp L10
+mov L82, *r2
+rts
+red *r2
+L42: dec r3
+m2
+L43: .data -921, -606, -144, -810, 626, -336, -175, -765
+L44: bne *r7
+lea L107, *r1
+stop
+L45: .string "mktvvaahnykz"
+rts
+jmp *r1
+clr r2
+sub *r1, *r3
+m3
+L46: .string "aqjghdsvwhhdnfhd"
+dec *r2
+prn L26
+prn L102
+L47: .string "maydxbotlzun"
+m1
+m4
+rts
+bne L118
+sub r0, r1
+cmp r2, r1
+prn r2
+L48: sub #104, r5
+not *r1
+prn #128
+dec r1
+inc *r5
+lea L74, *r0
+L49: .data 366
+jsr L16
+inc *r4
+m4
+m2
+sub #-246, r6
+jsr L3
+
+L50: .string "qk"
+L51: inc *r1
+prn r1
+jmp L46
+sub #119, L107
+L52: sub r2, L9
+rts
+L53: clr L30
+L54: .string "zxtozh"
+lea L13, L54
+; comment
+dec *r5
+not L38
+m3
+L55: lea L1, L111
+L56: .string "zxlgya"
+L57: jmp L114
+cmp *r6, L76
+
+lea L57, r2
+L58: inc *r2
+red r2
+m0
+bne L116
+
+L59: .data -790, 303, -615, -484, 701, -429, 134, 826
+stop
+stop
+L60: .data -451, 569
+; comment
+L61: .data -534, -714, -148
+L62: clr r3
+not *r1
+; comment
+L63: bne L55
+
+sub r7, L67
+L64: add *r6, *r3
+sub #66, L83
+jmp L39
+sub *r7, *r2
+cmp L46, L42
+not L13
+L65: .data 667, -480, 346, -604, -258, 101, -661
+L66: .string "pyueezg"
+cmp #-122, *r1
+stop
+L67: rts
+dec *r6
+; comment
+L68: lea L57, *r4
+sub L56, *r0
+L69: .string "kveiyicsahvreaulxpzhoskn"
+clr *r4
+rts
+sub r5, L92
+stop
+jsr *r4
+L70: cmp L70, *r5
+L71: inc r1
+lea L77, *r3
+red r0
+dec *r5
+cmp #37, L92
+clr r0
+prn r4
+red *r3
+jsr *r6
+m1
+inc L31
+L72: .data -530, -893, 739, -120, 793, -705, 665, 350
+L73: .string "qaxhcoyufzyzjpegzmwqcy"
+L74: red r2
+prn L25
+m2
+bne L52
+L75: .data 817, -518, 464, -596, 798, 963
+jsr L73
+L76: .string "qrcanpryhiyo"
+jsr *r0
+m3
+L77: not r2
+L78: .string "deryldjerqkvcpuslqdhn"
+not *r2
+sub #43, L87
+rts
+; comment
+inc *r3
+add #-227, r4
+add #213, r4
+rts
+cmp #-98, *r5
+L79: inc r7
+m1
+cmp r3, *r6
+sub #62, r3
+m1
+jmp L109
+dec r7
+bne *r3
+prn #-87
+sub r6, r4
+sub *r7, r7
+sub L68, L99
+not L41
+rts
+m4
+prn L93
+m1
+m3
+cmp L91, L95
+sub L101, *r6
+stop
+L80: inc r2
+L81: .data -112, -885, -887, -162
+rts
+m3
+m1
+sub r0, L99
+m3
+cmp *r0, L12
+jsr L90
+red L82
+dec L97
+L82: cmp #185, r7
+cmp *r0, L114
+L83: add #118, L63
+L84: .string "bcqifykekdqmhsafufbdi"
+red r0
+m4
+m0
+rts
+rts
+m1
+m2
+prn r7
+L85: .string "zxcqajkmps"
+bne *r5
+sub *r0, L100
+m1
+mov r2, *r6
+L86: .data -492, 217, 590, -383, -79
+; comment
+m3
+m2
+dec r1
+stop
+m3
+m1
+L87: prn L61
+clr r0
+L88: stop
+add r6, r3
+L89: .string "yvdddylzcamrcpuuwjd"
+not r7
+add r2, L111
+m2
+m1
+m0
+L90: .data -81, -170, -778, -629
+L91: jmp *r4
+inc *r4
+L92: inc *r7
+not L100
+L93: .string "ckquhd"
+cmp L58, *r3
+m4
+L94: rts
+L95: cmp *r2, *r0
+L96: .string "pjrnuxq"
+inc L108
+rts
+add L73, L110
+sub L113, *r1
+sub r4, r2
+m0
+m1
+sub #-123, r4
+m4
+m1
+inc L105
+L97: cmp r3, r5
+rts
+jmp L117
+red L114
+m1
+; comment
+L98: .string "hfrvkcpbstbg"
+; comment
+dec r4
+dec *r5
+cmp r2, L37
+clr *r2
+rts
+L99: .data 51, 63, -221
+; comment
+rts
+bne *r5
+m0
+L100: dec L104
+clr L30
+jsr L23
+L101: sub L111, L104
+L102: .string "rcautlevhb"
+; comment
+sub L116, *r6
+stop
+; comment
+add r2, *r6
+sub *r6, r3
+L103: .data 471, 367, -670, -451
+bne *r2
+m4
+not L4
+jmp *r0
+not r3
+stop
+prn r5
+rts
+prn *r5
+dec r6
+m3
+red r7
+add #16, *r7
+clr *r5
+L104: cmp #-152, r3
+inc r4
+L105: prn L92
+L106: dec r6
+mov r2, r7
+bne L92
+add r5, L47
+not *r3
+m1
+inc *r0
+L107: jsr *r2
+L108: jmp *r3
+L109: .data -118, -278, -390, 849, 391, 272, -647, 890
+
+add #-223, L112
+inc *r4
+jsr L115
+not L111
+L110: stop
+L111: red r5
+mov L12, *r0
+rts
+L112: .data -696, -126
+L113: inc L40
+m3
+m0
+dec *r5
+dec L13
+; comment
+mov #-20, L85
+m4
+stop
+jsr L114
+stop
+m1
+
+bne *r6
+m4
+m0
+add *r3, r5
+L114: lea L117, r2
+
+not *r4
+L115: clr *r3
+jsr *r1
+stop
+L116: add r7, r1
+m0
+m4
+m3
+lea L117, r0
+L117: .string "xyawithqlrpeduk"
+mov #-115, L118
+clr r5
+; comment
+not *r6
+m2
+L118: rts
+m3
+m1
+L119: .string "flgdchg"
+
+red *r5
+m2
+stop
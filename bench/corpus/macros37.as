@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 38
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    mov *r3, *r2
+    jsr L60
+    prn r2
+    lea L107, r6
+    cmp #-130, L26
+    red L23
+    mov L75, *r6
+    prn r4
+    red r6
+    inc L102
+endmacr
+macr m1
+    mov #-196, L28
+    dec r1
+    lea L73, L68
+    dec L37
+    mov #-21, *r6
+    prn #65
+    prn r2
+    sub r0, L13
+    cmp r5, r1
+    not *r3
+endmacr
+macr m2
+    not r0
+    clr r7
+    prn r7
+    lea L30, L23
+    jmp L80
+    jsr *r1
+    cmp L40, r7
+    mov #-116, r4
+    sub *r2, *r1
+    sub *r1, L101
+endmacr
+macr m3
+    prn r1
+    red *r0
+    rts
+    mov L59, L58
+    mov *r5, L77
+    add #173, *r2
+    sub r0, r1
+    clr L93
+    prn r7
+    lea L79, r0
+endmacr
+macr m4
+    stop
+    sub #-183, *r4
+    red *r3
+    red *r1
+    bne *r7
+    inc L5
+    cmp *r6, L19
+    mov *r2, L61
+    inc *r7
+    jmp *r0
+endmacr
+L0: .data -572
+L1: rts
+stop
+jmp *r7
+L2: red L41
+cmp *r5, #82
+m1
+L3: mov #33, *r6
+rts
+m3
+red *r5
+L4: dec L2
+mov #-159, L67
+add #-191, *r3
+m1
+m1
+mov r2, *r3
+stop
+m3
+m1
+jmp *r5
+; comment
+cmp L3, r2
+mov L4, L99
+bne L83
+stop
+add L102, L4
+; comment
+dec L4
+rts
+L5: .data 848, -82, -640, -109, -803, 681, -518
+m2
+clr L3
+m3
+red r6
+inc r5
+clr L22
+jsr L64
+L6: .data -720, 936, 72, -206, 783, 4
+m2
+L7: jsr L7
+L8: .string "byshymsmtoygtmih"
+L9: .string "xvogbbxemdlgvjkbv"
+L10: not L0
+stop
+jsr *r3
+inc *r6
+m2
+rts
+cmp L6, L27
+not L13
+m2
+; comment
+dec L19
+cmp r3, L1
+rts
+m0
+L11: rts
+bne L58
+stop
+prn L10
+jmp *r6
+prn #-119
+clr L5
+stop
+L12: .data 165, -572, 777, 693, -320, -157
+cmp *r7, *r5
+prn *r3
+mov #187, L9
+L13: not r1
+rts
+clr L98
+L14: jsr *r3
+L15: .string "uco"
+m3
+m4
+stop
+
+mov r0, *r0
+L16: rts
+L17: inc r6
+lea L73, r2
+lea L57, r1
+cmp r3, L6
+add #-119, *r3
+; comment
+lea L8, r4
+sub r0, r5
+bne L91
+; comment
+L18: .data -543, -685, 448, -107, 293, 919
+m2
+L19: jmp L18
+m4
+m2
+m1
+L20: .data -320, 501, 849, -973, -330, -171, 787, 881
+mov r3, L84
+sub r4, L13
+lea L10, r2
+lea L103, r2
+L21: bne L18
+inc L34
+L22: bne L32
+L23: .string "zzbfofnpdlraxeauhoizw"
+L24: cmp r0, L10
+stop
+stop
+m1
+red L19
+mov *r4, r3
+cmp *r4, *r7
+L25: stop
+jsr *r1
+L26: stop
+jsr L53
+m3
+not L91
+inc r5
+L27: jsr *r7
+stop
+prn r0
+add #-27, *r6
+add #-45, L101
+mov #232, r4
+rts
+; comment
+m2
+mov L5, r5
+dec *r5
+
+L28: not *r0
+m4
+prn L50
+; comment
+sub L58, *r3
+bne *r3
+L29: red r0
+inc r6
+dec L80
+dec r1
+L30: inc L20
+rts
+mov #-95, *r3
+clr *r6
+mov L1, L13
+m3
+; comment
+jsr L46
+L31: .string "ukpfi"
+inc L2
+L32: sub #-148, L17
+mov #-66, *r2
+; comment
+prn #165
+m0
+jsr L19
+stop
+cmp *r4, L25
+prn #-250
+clr L68
+L33: dec r3
+lea L86, L9
+clr *r3
+dec L78
+mov #220, *r7
+m3
+L34: .data -840, 991, -408, -809
+m1
+m4
+red L24
+dec L19
+L35: .string "mkdtqbztlbufcaprprui"
+L36: lea L80, r5
+L37: prn *r4
+lea L27, r0
+L38: cmp L51, #-89
+m4
+rts
+cmp L6, r0
+L39: dec r7
+L40: .data -158, -967, 682
+rts
+L41: sub r4, *r6
+m2
+rts
+inc L26
+sub *r3, r3
+m4
+bne L63
+add #-245, r1
+jmp L102
+inc r6
+; comment
+clr *r3
+mov L20, r5
+rts
+red *r1
+lea L104, r6
+mov L56, r1
+L42: .data -490, 286, -637, 566, -167, 45, 938
+
+L43: sub #14, r0
+m0
+prn L104
+red *r5
+lea L58, L1
+mov *r3, r4
+not L100
+L44: .data -969, 395, 869
+lea L106, L11
+bne L6
+rts
+m1
+rts
+clr r7
+inc L50
+dec *r0
+jmp L71
+cmp *r7, L40
+add r7, r7
+lea L34, *r0
+red L81
+add r1, L11
+L45: .data -691, 312, 475, 515, -227
+rts
+m2
+m1
+dec *r1
+m0
+m2
+L46: lea L38, *r1
+mov L52, L30
+L47: cmp L56, *r0
+lea L94, L33
+m1
+sub #227, L98
+m4
+bne *r4
+
+dec L24
+m4
+dec *r4
+L48: stop
+inc L77
+m2
+lea L74, r0
+L49: inc r6
+L50: lea L43, r4
+jmp L41
+prn L22
+red *r2
+jmp L1
+not L63
+L51: stop
+L52: add r3, r2
+m1
+add *r6, L96
+L53: clr *r6
+dec *r4
+jsr *r6
+not r6
+jsr *r6
+L54: clr L69
+prn #-16
+L55: red L64
+dec *r3
+jmp L99
+L56: clr L28
+inc *r7
+L57: lea L84, *r4
+prn *r6
+
+m0
+L58: not L42
+L59: lea L75, r1
+lea L64, r3
+m1
+m2
+lea L66, r7
+red L18
+lea L71, r4
+add #191, r3
+
+; comment
+L60: inc r0
+dec *r3
+m2
+bne *r6
+cmp r1, r2
+L61: mov r5, r2
+m2
+not r2
+clr L102
+jmp *r2
+m0
+mov r3, L56
+add r1, L109
+red r7
+add #132, r6
+m4
+jmp *r5
+rts
+m3
+inc r1
+jmp *r5
+mov L50, L78
+m2
+L62: prn *r2
+L63: add #-168, *r7
+L64: .data 613, -321
+jmp L60
+m3
+cmp *r5, #193
+rts
+m2
+stop
+mov #-112, L5
+L65: .data -579, -212
+prn L37
+m0
+m0
+L66: add #56, L2
+rts
+m1
+not r7
+jsr *r7
+jsr *r1
+m3
+cmp *r2, *r1
+L67: .string "d"
+m3
+L68: .data 994, -469, 615, 107
+L69: .string "myjpfsaoso"
+prn #63
+L70: add r2, *r2
+m4
+sub L100, L57
+L71: clr r0
+dec L98
+rts
+not L1
+L72: .string "kvelacuyb"
+clr L1
+sub r2, r6
+L73: jsr *r4
+m4
+lea L64, r6
+inc r6
+m1
+add #201, *r6
+
+L74: .string "pyoroiorobareemjufufgir"
+mov r0, *r5
+m2
+red L35
+m1
+m2
+stop
+clr *r5
+clr L84
+cmp r5, *r6
+clr *r3
+L75: rts
+m0
+sub L83, r4
+lea L13, L103
+add L9, L108
+lea L49, L83
+not r3
+prn L6
+m3
+m1
+red L104
+mov *r5, L103
+L76: .string "fqyst"
+m4
+L77: lea L11, r5
+L78: .data 884, -523, -314
+prn r4
+rts
+L79: lea L92, *r4
+m0
+L80: not L19
+L81: .string "smugzrltvqcsvln"
+L82: .data 136, -691, 8, 73, 47, -215, -463, 120
+L83: clr r1
+mov *r7, *r6
+L84: .string "y"
+; comment
+inc L1
+add L73, r1
+clr r0
+dec *r3
+L85: .string "wxsl"
+add r2, r3
+jsr L26
+cmp L99, r5
+inc L102
+dec r2
+m3
+L86: jmp L53
+L87: not L103
+m0
+red r4
+not r0
+m0
+rts
+L88: .data -297, -999, 184, -917, 27, -373, -795, 854
+m0
+m4
+L89: .data 179, -943, 443, -601, 408, 777, -745, -65
+clr r2
+m3
+m2
+lea L107, L0
+L90: not *r6
+bne L80
+m0
+not L96
+; comment
+dec r0
+
+L91: jsr *r4
+L92: .string "lhajlhay"
+jmp *r5
+mov *r1, r7
+rts
+inc *r2
+L93: sub #-32, r1
+mov *r3, L101
+m0
+dec r4
+inc *r4
+red r2
+stop
+m2
+; comment
+; comment
+clr L2
+clr *r5
+red r2
+L94: .string "giexrgvrez"
+m1
+L95: red L15
+L96: clr *r6
+L97: dec L107
+not r5
+rts
+dec r7
+m0
+clr r5
+m2
+L98: bne L37
+jmp *r1
+
+m4
+m3
+cmp *r4, r3
+inc *r1
+mov r3, *r4
+red *r4
+prn r5
+add #180, *r0
+jsr *r0
+m0
+not L88
+cmp #250, #-147
+red r1
+rts
+clr L103
+L99: .string "fukwcpcfz"
+not r3
+jmp *r2
+not *r2
+red *r2
+m3
+m3
+L100: not r0
+L101: .string "eiolohymnebcvpdu"
+red *r6
+cmp L106, *r1
+; comment
+L102: .data 339, -915, -327, 245, -981, 405
+L103: prn *r5
+L104: red L48
+L105: clr *r7
+L106: dec r7
+L107: inc L109
+L108: .data -897, 795, 989, -15, 650, 677, 623, 818
+lea L109, L109
+m3
+bne L107
+stop
+mov #-124, *r5
+sub *r2, r5
+jmp *r0
+clr *r4
+inc L109
+L109: add r3, L67
+stop
@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 39
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    stop
+    prn r4
+    stop
+    add r4, L47
+    stop
+    mov L9, *r4
+    mov L44, r2
+    prn *r7
+    red L36
+    lea L14, L104
+endmacr
+macr m1
+    red *r5
+    clr *r4
+    mov *r0, L70
+    prn *r1
+    bne *r1
+    lea L97, *r2
+    jmp L35
+    not L40
+    lea L33, L15
+    not r2
+endmacr
+macr m2
+    cmp *r4, r0
+    clr *r6
+    stop
+    jsr *r6
+    mov *r2, L61
+    add L23, L55
+    inc *r5
+    rts
+    red *r3
+    jsr *r5
+endmacr
+macr m3
+    add L52, *r2
+    red r4
+    not r3
+    dec *r1
+    red r3
+    red L100
+    rts
+    add *r0, r4
+    clr r0
+    add r6, L104
+endmacr
+macr m4
+    stop
+    jsr L84
+    rts
+    clr r0
+    mov r5, *r0
+    dec r5
+    clr r5
+    inc r5
+    prn L108
+    bne L23
+endmacr
+stop
+m4
+m1
+cmp #129, #-175
+mov L99, L33
+cmp L32, *r3
+jsr *r5
+bne L39
+inc L83
+dec L109
+lea L104, r5
+jsr L93
+L0: clr L0
+m0
+m1
+L1: sub #-88, r5
+lea L50, r1
+sub *r4, L36
+sub r4, r1
+sub r4, *r5
+rts
+jmp *r7
+add r4, L1
+m1
+cmp L1, L76
+m4
+m4
+prn r5
+inc *r6
+jmp L18
+; comment
+not L1
+inc *r0
+inc r6
+prn r0
+not L20
+bne L0
+m3
+L2: sub *r4, L69
+m0
+; comment
+m0
+jsr *r4
+lea L35, L2
+bne L101
+dec r7
+L3: sub r5, r3
+red r3
+L4: .data 166, 513, -663, 989
+not *r5
+; comment
+m0
+bne L49
+stop
+; comment
+bne *r2
+L5: .string "qzyxeuhhvozzyohcyut"
+m3
+L6: mov #15, L88
+m1
+cmp *r5, L1
+L7: cmp L39, *r3
+mov *r1, L6
+L8: jmp *r5
+cmp L3, #-247
+sub r0, *r3
+red L73
+rts
+L9: add r0, *r4
+cmp L46, *r6
+clr L7
+L10: inc r0
+lea L4, *r0
+lea L61, L1
+dec L107
+L11: add L8, r4
+jsr L23
+L12: .data 767, -704
+clr r3
+cmp L11, *r0
+rts
+m1
+L13: red r1
+jsr *r0
+add *r4, *r4
+jmp *r2
+lea L5, r3
+add L1, *r7
+inc r6
+m4
+m4
+prn r6
+sub r0, L25
+m0
+dec L1
+; comment
+bne L6
+red *r7
+mov *r2, r7
+add L10, L7
+lea L80, r7
+m3
+L14: .string "jsvjj"
+mov #41, *r6
+dec L10
+add #208, L7
+L15: cmp #205, r5
+L16: dec *r5
+jsr L84
+m3
+jmp L12
+jsr L105
+L17: .data -226
+m1
+L18: .data -504, 21, -224
+add L8, r4
+m0
+m1
+clr L2
+L19: .data 366, 643, 207, 599
+bne L27
+cmp *r3, L6
+lea L4, L19
+m3
+m1
+lea L2, *r5
+rts
+mov *r0, L89
+jsr *r6
+m0
+L20: .string "bmumo"
+L21: rts
+prn #138
+L22: lea L49, r2
+dec r1
+L23: lea L9, r7
+red *r6
+jmp L50
+bne *r4
+prn r6
+L24: red L19
+m0
+lea L20, L88
+m3
+prn *r6
+mov r1, L15
+red L1
+lea L14, r6
+; comment
+jsr L31
+not L38
+cmp *r1, *r5
+sub L90, r3
+L25: rts
+m2
+cmp *r2, *r3
+jmp L41
+inc *r0
+bne *r5
+L26: clr *r0
+red *r5
+L27: jmp *r3
+jmp *r2
+bne L46
+m4
+inc r0
+stop
+m1
+m2
+m0
+m0
+L28: add *r1, *r6
+stop
+; comment
+m0
+m3
+L29: .data -46, -277, -333, 169
+clr *r0
+bne L89
+m2
+m3
+add r7, r7
+prn *r5
+jsr *r0
+m3
+sub #-172, *r2
+m1
+jsr L104
+mov *r1, L9
+dec r1
+L30: lea L43, *r5
+L31: red L18
+m3
+clr r5
+cmp *r1, *r5
+lea L86, L73
+clr r7
+bne *r4
+L32: bne L11
+jsr L1
+dec L66
+bne *r1
+L33: dec r7
+rts
+m2
+jmp L69
+L34: dec *r0
+sub *r5, r0
+inc L54
+rts
+inc r3
+bne L30
+inc L25
+m2
+L35: rts
+m2
+m4
+m4
+jsr *r3
+sub r3, r6
+m0
+mov #-4, L77
+L36: .string "tixcersykprjpmyrbbomh"
+L37: .string "igklywuq"
+dec r1
+m3
+red r7
+L38: add L66, *r1
+
+m4
+m1
+m0
+jsr *r3
+L39: .string "uw"
+red *r2
+m0
+L40: .data -973, -433
+L41: cmp r5, *r1
+rts
+not L74
+L42: bne L80
+m1
+rts
+prn L105
+not *r2
+clr r3
+jmp *r1
+m1
+L43: mov #83, L60
+rts
+jsr L61
+m4
+L44: lea L84, *r1
+rts
+m1
+prn r0
+add L54, L18
+jmp L47
+L45: rts
+L46: sub #18, *r6
+clr L49
+stop
+m1
+bne *r3
+lea L104, L41
+add *r6, *r0
+rts
+L47: stop
+L48: dec r6
+L49: .data 607, -846, 680, 352, 433, -381, -519, -98
+dec L78
+stop
+L50: .string "riw"
+stop
+
+L51: bne L100
+sub #8, r2
+L52: mov r0, r0
+
+L53: red *r7
+add L71, r0
+L54: .data -9, -390, 775, 178
+L55: dec L92
+dec r6
+bne L0
+m0
+add r3, *r2
+clr L106
+m2
+L56: .string "zlndbpkiusu"
+stop
+dec L59
+mov #228, *r4
+inc *r6
+jmp L75
+stop
+rts
+stop
+not r3
+m4
+clr L74
+lea L66, r0
+sub L89, L39
+not r5
+clr L106
+L57: .data 666, 301, -3, -450
+mov r1, *r4
+prn L58
+jsr L78
+rts
+L58: .data 177, -210, 877, 659, 916, -761, -229, -132
+add *r2, L90
+L59: .data -634, -753, -926, 128, 522, -873, 778, 20
+prn r3
+m0
+L60: .string "cysaapgdekj"
+sub #174, r3
+m0
+L61: jmp *r0
+m3
+sub r1, r4
+L62: jmp L91
+not *r6
+m2
+not L31
+mov #-68, L81
+m4
+not *r5
+m4
+sub *r4, r2
+sub *r3, r5
+L63: .data 843
+L64: stop
+rts
+m2
+L65: bne *r4
+jsr L66
+lea L38, r3
+m0
+m2
+inc *r6
+clr L101
+rts
+m1
+sub r4, *r0
+stop
+
+L66: mov L3, *r1
+lea L4, L107
+L67: .data -221, -584, -866, -445, -182, -470, 650, 120
+; comment
+m2
+m2
+m3
+L68: .string "sejlhaffkgnjooeov"
+L69: .string "xzdtpqcfo"
+inc L81
+not r6
+cmp #162, r6
+rts
+inc r7
+add L105, r3
+L70: sub #63, *r4
+L71: .string "uqkltvgdhadzznemnjz"
+m1
+m4
+red r2
+cmp r3, *r5
+L72: dec r1
+lea L48, L91
+L73: .string "csjbvayvrwwquzxweeov"
+jsr *r3
+m2
+; comment
+lea L19, *r2
+mov #217, r1
+lea L20, *r7
+lea L26, *r0
+L74: .string "eoffemimaugynuohaxl"
+red L100
+prn L35
+bne L16
+lea L107, r6
+; comment
+m2
+L75: bne L93
+L76: .data 715, 384, 983, -454, 776, 549, -641, 424
+L77: .data -828, 663
+clr *r5
+m2
+jmp L10
+red *r1
+inc r0
+sub *r0, *r7
+dec *r1
+L78: sub L96, L54
+L79: .string "afaainknytqgydx"
+rts
+clr *r1
+m4
+lea L100, L107
+m2
+rts
+; comment
+dec *r6
+inc r6
+sub #232, *r5
+rts
+clr *r6
+L80: dec *r6
+; comment
+rts
+L81: .string "fddnaontbbhdapezvulhlnax"
+add r7, *r1
+L82: .string "harectyhzlvnjimlfapdco"
+m2
+m1
+L83: .string "xeqk"
+L84: .string "buvjqbkmzeuuknnab"
+jmp L105
+m0
+L85: .data -315, 453, -440, -121, -794, -392, 702, 298
+L86: cmp r1, L99
+L87: stop
+red *r3
+red r5
+lea L81, r5
+m1
+sub r1, *r7
+lea L99, L99
+m0
+L88: prn *r7
+clr *r3
+m3
+jsr *r0
+add L95, r7
+m0
+m2
+rts
+L89: .data -354
+jmp *r0
+L90: .data -511, -733, -102, 272, 366
+add L109, r4
+m0
+L91: .data 482, 114, -152, -779, -666, -574, -157, -609
+cmp #-184, #148
+rts
+prn #-188
+L92: cmp r5, L104
+jsr L33
+prn L25
+L93: .string "krvhauikrenihyord"
+L94: .string "lbpckpk"
+not L88
+inc r3
+L95: sub r0, *r3
+inc L101
+m0
+L96: jmp L29
+clr r2
+not *r2
+cmp r5, L107
+dec r4
+L97: .data -480, 521, 371, 539
+red L41
+L98: rts
+L99: cmp L1, #147
+dec *r5
+; comment
+L100: .string "kfpcxly"
+L101: stop
+m0
+L102: .string "lfhimsppozhedix"
+L103: rts
+rts
+m4
+mov r0, *r3
+stop
+L104: prn *r1
+m3
+L105: lea L104, r3
+not L19
+m0
+m1
+; comment
+m4
+rts
+red L108
+L106: .string "tbthnbpjgwqwtzkrjgugjyh"
+red r4
+lea L98, *r2
+bne L86
+L107: .data -10, 14, 844, 188
+m1
+m4
+L108: .data -731, 976
+L109: dec r3
+mov *r5, L95
+red r1
+m3
+stop
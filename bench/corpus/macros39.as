@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 40
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    mov r2, L92
+    mov r1, *r5
+    dec L58
+    not *r2
+    stop
+    prn #-120
+    sub r4, r4
+    red L44
+    dec *r4
+    rts
+endmacr
+macr m1
+    sub r6, r3
+    stop
+    red *r2
+    rts
+    stop
+    add r4, *r5
+    not r0
+    rts
+    add r1, *r0
+    prn #73
+endmacr
+macr m2
+    prn *r4
+    add r2, r6
+    sub *r6, L96
+    rts
+    jsr L23
+    inc r2
+    sub *r0, *r4
+    rts
+    prn *r6
+    red r6
+endmacr
+macr m3
+    mov *r4, *r1
+    prn #39
+    not r3
+    dec L55
+    sub #103, *r0
+    mov #-69, L28
+    prn L29
+    clr *r1
+    not *r4
+    red L66
+endmacr
+macr m4
+    bne L66
+    sub L84, L63
+    dec L16
+    bne L61
+    jsr L11
+    not r4
+    red L50
+    prn r0
+    jmp L20
+    red r5
+endmacr
+prn *r5
+prn *r1
+mov #25, r0
+red r5
+rts
+prn r2
+sub r0, L74
+clr L7
+red r2
+L0: inc L56
+red L11
+m0
+jsr L76
+dec r7
+L1: stop
+jsr L0
+L2: .data 627, -116, -417, -405, -608, 638, 159
+mov #-57, L0
+L3: .data 632, -207, 536, 623, -16
+rts
+m0
+stop
+m4
+m2
+rts
+red *r0
+m0
+m3
+mov r3, r7
+jsr *r1
+m1
+m4
+prn L102
+rts
+L4: .data 127, -792, 369, 512, -473
+lea L1, L3
+
+L5: clr *r7
+m3
+rts
+sub r4, *r1
+add #20, *r4
+L6: rts
+L7: rts
+
+L8: bne *r1
+; comment
+inc r4
+mov #23, *r7
+bne L0
+stop
+L9: inc L68
+cmp *r5, r1
+m2
+m3
+jmp *r2
+stop
+m0
+m1
+m0
+
+bne *r0
+L10: rts
+jmp *r0
+m0
+
+mov L48, *r7
+lea L0, L8
+red r0
+rts
+
+cmp #-160, *r1
+L11: clr r4
+stop
+red L3
+mov L46, r7
+add r5, r6
+sub #53, r1
+inc L13
+m3
+L12: .string "igfdgkdndzsqqzdchcsulxd"
+sub r2, *r0
+clr r1
+jsr *r7
+stop
+L13: cmp r3, r5
+rts
+add *r2, L34
+sub r4, *r3
+
+dec r1
+L14: .data -379, 234
+m0
+L15: stop
+m2
+stop
+L16: jsr L11
+red r7
+L17: .string "ipdc"
+L18: jsr *r6
+m2
+L19: dec L19
+mov L5, *r2
+lea L13, *r5
+L20: lea L73, *r7
+rts
+L21: .data 864, 805, -703, -357, 891, -693, -16, -180
+prn *r6
+L22: add *r1, L81
+m1
+m3
+m4
+dec *r7
+jmp L5
+m3
+jmp L10
+; comment
+sub #-52, *r2
+m1
+not *r5
+lea L12, L22
+jsr L33
+L23: add r0, *r7
+L24: .string "toijrjukvuxpe"
+bne L71
+dec L102
+clr L6
+m3
+m0
+add L95, r4
+jmp *r7
+L25: jmp L29
+m0
+L26: bne *r6
+not r3
+L27: rts
+m1
+rts
+clr *r4
+red *r7
+cmp L11, L62
+inc L5
+L28: .data 360, -455
+mov #76, r5
+add *r0, r4
+m4
+red L60
+cmp #77, r0
+m2
+mov r5, r3
+jmp *r2
+jsr *r2
+red r3
+m3
+jsr L24
+L29: bne L10
+not r3
+L30: .data 568, -281, -462, -502, -692, 887, 289
+bne L71
+sub r1, *r6
+
+red r7
+jmp L16
+inc *r5
+add r6, *r2
+add #62, L60
+; comment
+sub *r7, r4
+m2
+rts
+mov L6, r0
+not r3
+inc L4
+L31: dec L1
+bne L75
+stop
+L32: .string "wqeywxbawideevrotmwfoe"
+L33: .string "fimtdwm"
+mov L20, *r2
+add r5, r3
+mov #175, r1
+m2
+L34: .string "valeodos"
+not *r4
+L35: inc *r4
+L36: clr *r5
+L37: inc r5
+lea L33, *r5
+dec *r0
+dec *r4
+jmp L86
+m4
+m2
+m3
+m4
+jsr *r2
+L38: rts
+m1
+mov L19, L2
+L39: cmp r6, L99
+jsr *r7
+jmp *r1
+not *r4
+L40: .data -629, -373, 375, 906, -881, 210, 193, -234
+m2
+L41: .data 609, -243, 346
+m1
+sub r5, L70
+cmp r7, #218
+inc *r0
+lea L69, *r5
+stop
+m3
+L42: .data 110, 701
+sub r5, *r1
+L43: prn *r5
+sub *r2, *r1
+m2
+bne L13
+rts
+L44: sub L87, *r4
+clr r0
+L45: lea L48, L8
+not L79
+mov *r3, *r5
+clr L90
+red r3
+L46: .string "yvgbrhkdlzrxzex"
+L47: .string "luephemrlhwivcnownt"
+
+L48: .string "londvjyungwqcfjzrbvepnac"
+m4
+clr L44
+jmp *r1
+red *r6
+m4
+lea L26, *r5
+L49: .string "tlgdqpzgnogazhvdbzzx"
+cmp L78, #24
+bne *r3
+L50: inc r0
+red *r6
+dec r4
+L51: rts
+clr *r6
+prn #86
+sub #-246, L101
+L52: rts
+; comment
+not *r4
+m0
+dec *r6
+jsr *r1
+dec *r5
+m1
+bne L34
+rts
+not *r4
+m2
+cmp r1, #116
+stop
+jmp L91
+L53: .data -946, 176, -85, 180, -298, -263, -975
+stop
+m4
+L54: .data 126, -287, -201, -353, 523, 97
+mov L33, L49
+stop
+L55: rts
+m3
+jmp *r0
+add r5, *r5
+L56: .string "trwpdtgkgnjch"
+mov L5, *r2
+L57: .data -79, -706, 339, -801, -147, 797, 139, 660
+lea L83, r1
+jsr *r2
+L58: .data 167, 508, 497
+clr *r2
+L59: dec L81
+m2
+m3
+m1
+m4
+m0
+sub #-183, r0
+bne L83
+stop
+m1
+m1
+m2
+dec *r7
+bne L67
+clr *r6
+mov #235, r7
+sub L23, *r6
+prn *r0
+m4
+m4
+not r3
+prn L98
+m0
+lea L31, r7
+m3
+L60: jmp L51
+L61: .data 413, 247, -930, 28, -266, 730, -966, 195
+m1
+lea L100, L4
+not r2
+m3
+lea L49, r0
+L62: .string "nz"
+lea L42, *r5
+m4
+bne L18
+m2
+add r3, L59
+L63: inc L68
+bne L35
+dec *r0
+add L85, *r1
+L64: not *r1
+clr r5
+stop
+jmp L46
+prn #-140
+red r2
+stop
+inc *r1
+cmp L14, *r5
+mov L0, *r0
+inc L50
+; comment
+m3
+sub r1, L34
+lea L47, *r5
+L65: .string "rvtfoxobmwhyu"
+L66: .data 939, 2, -448, 855
+red L79
+L67: .data 924, 436, -472, -851, -303, -354, -736, 545
+add #-9, r3
+add L98, *r2
+L68: .data 422, 984, 364, -615, -860
+m4
+clr L41
+m4
+jsr L93
+sub L76, *r0
+mov r4, r4
+prn L34
+m4
+m3
+prn #208
+m0
+L69: .string "tdawfdxytsdxnz"
+add #-253, *r3
+stop
+sub L32, r6
+m1
+L70: bne *r1
+L71: .data -624
+L72: .data -894, -780, 69, 481, -603
+m4
+mov r7, *r4
+rts
+stop
+L73: red L101
+not r1
+m3
+m3
+L74: inc L84
+m3
+red r4
+red L83
+L75: clr *r3
+L76: .data -383, 241, 823
+inc r1
+lea L100, *r5
+jsr *r4
+L77: .data 699, 547
+L78: .string "ryawkqpxnfwis"
+mov *r5, *r3
+inc *r2
+L79: red L63
+dec *r6
+rts
+L80: mov *r2, r4
+clr *r2
+rts
+dec r1
+L81: bne L57
+cmp *r7, r7
+L82: .string "jbdtsxpwnqve"
+bne *r7
+; comment
+add #15, r5
+m0
+L83: .string "hpfvglavispanhj"
+cmp L102, L43
+L84: .string "gwdnrzkisuliqigmgo"
+L85: .data -461, -702, -841
+not *r0
+
+inc r6
+prn L99
+L86: .string "yxktcoznvlo"
+L87: add r7, *r7
+cmp L69, L37
+L88: add *r6, *r3
+sub *r1, r4
+red r6
+; comment
+cmp *r7, r6
+m4
+stop
+L89: .data -631, 652, 14, 805, 438, -980
+stop
+mov #88, r0
+cmp #-59, *r4
+m4
+
+
+clr L92
+stop
+lea L97, L30
+m3
+prn L27
+rts
+red r3
+L90: lea L97, *r7
+L91: .string "mlkdocdugvov"
+L92: dec r6
+
+lea L103, *r4
+jmp *r2
+m1
+mov *r0, r3
+L93: .data 982
+not L102
+jmp *r1
+inc *r5
+L94: lea L98, r6
+bne L96
+L95: .string "refzyovfmcuqiwvewpta"
+sub #-226, r0
+L96: .data -633, -609, 392, -681, 295, 668, -953, -617
+not *r1
+bne L40
+not r0
+dec L103
+m3
+red r4
+m3
+dec r1
+m4
+inc L102
+clr L36
+lea L46, *r7
+m4
+L97: rts
+L98: jmp L103
+rts
+stop
+m3
+m0
+prn *r6
+; comment
+prn L87
+clr *r5
+L99: .string "cdveazmryopi"
+m4
+not r0
+dec *r5
+; comment
+L100: bne *r3
+; comment
+L101: not L104
+m3
+sub *r4, r2
+mov #57, L37
+L102: .string "tkfjdkhiqrwqzeefalqdqdpf"
+sub L50, L10
+L103: stop
+red r6
+m4
+; comment
+
+bne *r3
+not *r3
+lea L104, L62
+prn r0
+m4
+jsr L70
+m1
+jmp L73
+sub r3, r1
+L104: bne *r4
+dec *r4
+dec r6
+
+stop
@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 5
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    prn r2
+    cmp L63, r0
+    bne L57
+    dec *r5
+    sub *r3, r3
+    lea L114, r7
+    jmp *r5
+    inc r6
+    sub #-173, L27
+    clr L107
+endmacr
+macr m1
+    dec *r6
+    lea L19, L80
+    rts
+    dec L45
+    inc r1
+    bne L114
+    rts
+    red *r6
+    rts
+    rts
+endmacr
+macr m2
+    stop
+    sub L20, *r2
+    sub #-82, L72
+    mov #61, L68
+    sub *r0, L48
+    not L34
+    jmp L5
+    cmp *r4, #77
+    clr *r5
+    not L36
+endmacr
+macr m3
+    inc L63
+    inc L22
+    not r2
+    mov L12, r2
+    sub #-240, *r1
+    stop
+    cmp L64, L104
+    inc L42
+    prn *r7
+    stop
+endmacr
+macr m4
+    rts
+    inc r0
+    dec r3
+    mov L48, r5
+    jmp L25
+    prn r0
+    inc L19
+    jsr L61
+    sub *r0, r2
+    add *r2, *r7
+endmacr
+lea L11, r3
+m3
+cmp *r7, L74
+L0: .data 199, -675, -402, -217, -566, -392
+L1: lea L19, *r3
+L2: cmp *r7, *r7
+clr r1
+m1
+stop
+bne L0
+L3: lea L8, L1
+red *r3
+lea L1, *r3
+m0
+clr L4
+not *r4
+add *r1, *r6
+bne *r3
+dec *r1
+L4: add #-75, r3
+add L3, r3
+m4
+mov r1, *r6
+m2
+inc L82
+not *r0
+L5: .data 839, -534, 920, -123, 305, -879, 881
+dec *r1
+inc L11
+mov L3, r7
+L6: stop
+mov L73, r7
+prn *r2
+m3
+L7: bne *r4
+m4
+lea L90, r7
+cmp r7, L70
+inc *r2
+m2
+not r4
+m1
+L8: .data -441, 121, 829, 202, -758
+L9: .data -920, 809, 355, -523, 272, -299, -882
+m1
+not L29
+inc r2
+prn #-83
+dec L52
+jsr *r7
+
+L10: mov #-195, r0
+bne *r6
+jsr *r7
+jmp L96
+m2
+lea L5, *r5
+stop
+L11: cmp L5, r2
+jmp L44
+L12: stop
+mov *r3, L5
+rts
+cmp r0, #-227
+add *r4, *r1
+L13: red r3
+L14: .data -3, -10, -559, -520, -477, 204
+lea L2, r5
+L15: .data 128, 743, 41, -476, 121, -545
+L16: inc r2
+jmp *r2
+m0
+stop
+m4
+sub L12, L5
+L17: .string "prjcdcrzbbiftvlehv"
+L18: dec L18
+L19: .string "fsjimhtsv"
+clr *r2
+jmp L45
+
+inc r4
+add L41, L59
+m3
+dec L22
+add L11, L9
+m0
+lea L4, *r0
+jsr *r2
+lea L25, r3
+L20: .data -366, -763, 659, 223, -771, 847
+stop
+dec r6
+L21: clr *r0
+dec r4
+; comment
+L22: .string "fysqboofk"
+L23: jmp *r1
+prn L39
+cmp #237, r0
+stop
+L24: cmp L30, #63
+dec r6
+m1
+cmp *r6, *r6
+m3
+add *r0, L15
+L25: not L49
+sub *r7, r5
+L26: .string "yfarhxwyzopqehugfr"
+clr *r1
+not *r7
+L27: stop
+red *r4
+L28: lea L58, *r1
+inc r3
+lea L6, *r3
+lea L26, L67
+clr *r5
+inc r3
+m3
+clr *r2
+L29: lea L6, *r3
+rts
+rts
+red *r7
+stop
+L30: jmp L78
+m0
+prn #177
+lea L1, L24
+jsr *r6
+
+L31: prn *r7
+not r0
+add L8, L104
+clr L23
+stop
+m4
+stop
+L32: bne *r2
+m2
+m0
+L33: .data -433, 826, -476, 586, -607, 156, 477, -446
+L34: .data -960, -759
+jmp *r7
+m0
+sub #-211, L9
+jsr *r0
+L35: jsr *r2
+m0
+L36: .string "ztlgqdospilfflurgaf"
+cmp L26, r7
+lea L48, L74
+; comment
+L37: .data -478, -83, -361, -847, -98, 601
+m3
+m1
+stop
+jmp L86
+m0
+L38: lea L50, *r6
+m3
+jsr *r1
+L39: inc *r1
+stop
+bne L9
+lea L13, L32
+L40: .string "hqdfb"
+cmp L35, #-244
+dec *r6
+L41: .string "fagetuqbrodfosohfoprjqeh"
+red *r6
+L42: .data 960, 967, -880, 309
+inc *r0
+L43: .string "hjeyvogvdgdwjldjc"
+bne *r5
+L44: clr r7
+dec L44
+not *r0
+prn *r6
+m3
+L45: bne *r3
+L46: .data 551, -814, -902, -503, -530, -9
+jsr *r6
+L47: jmp L0
+cmp L67, #103
+jmp L51
+jsr L7
+prn L101
+L48: clr r1
+; comment
+m4
+L49: red *r3
+prn r4
+L50: .data 497, -685, 226
+m3
+m1
+lea L36, *r2
+L51: jmp L83
+prn #-59
+dec *r0
+m4
+inc *r0
+L52: jmp *r2
+jmp L91
+jsr *r6
+L53: dec *r4
+jsr *r4
+; comment
+lea L23, r4
+cmp L57, #129
+L54: not *r7
+bne *r7
+L55: .data 68, -339
+inc *r3
+sub *r2, *r2
+jmp *r1
+inc L42
+dec r1
+L56: bne *r5
+clr *r0
+stop
+L57: clr r5
+bne L88
+jmp L11
+L58: not L69
+lea L52, L86
+m1
+prn *r3
+
+L59: jmp *r1
+L60: rts
+clr r2
+m1
+L61: add L18, r1
+L62: jsr *r4
+inc r4
+sub #-206, r0
+bne L75
+prn r4
+
+lea L112, r7
+cmp r4, #42
+not *r2
+L63: .string "dmhlsbmpdebcbby"
+m1
+red r6
+lea L115, *r3
+dec *r3
+add #10, *r3
+lea L24, L48
+stop
+L64: sub r1, *r6
+L65: .data 561, -247, -353, -933, -826, -484, 980, 438
+clr *r7
+lea L105, *r4
+stop
+m1
+cmp #229, #240
+clr r1
+mov r5, *r7
+prn r1
+m2
+L66: inc r2
+m3
+; comment
+add #-39, r6
+L67: clr L105
+m2
+jmp *r0
+L68: .data 72, 582, -663, -959
+stop
+L69: .data 575, 433, 554, 758
+bne L82
+stop
+stop
+clr L85
+m2
+jsr L31
+m3
+
+prn L51
+dec L6
+m1
+m3
+m0
+red L13
+L70: .data -695, -412, 708, 253, 873
+jsr L3
+L71: .data 535, 276, -388, -45, 698
+add *r3, r7
+inc r5
+jsr L51
+m0
+red r7
+L72: stop
+sub r3, r5
+red r4
+inc *r4
+lea L91, r3
+prn r3
+L73: bne *r6
+lea L89, *r3
+bne *r3
+L74: .string "tbqkvhnd"
+jmp *r6
+add L82, r0
+bne *r5
+m1
+jmp *r6
+L75: stop
+; comment
+mov r5, r1
+add r2, *r1
+L76: bne *r6
+rts
+mov r4, *r2
+; comment
+L77: not L36
+bne *r5
+m1
+; comment
+prn *r5
+m4
+sub L63, r0
+clr r1
+not *r4
+add #-219, *r6
+m0
+jsr L93
+L78: .data 651, -16, -434
+bne *r6
+jsr *r5
+inc *r5
+L79: .data -896, 485, -956
+; comment
+m1
+inc r7
+L80: prn #141
+cmp L18, L100
+m3
+L81: .data 152, -366, -649, 35
+lea L72, *r3
+L82: jmp L82
+m2
+clr L60
+jsr *r7
+; comment
+m4
+jmp L17
+inc *r6
+jmp L31
+dec r0
+prn #137
+m0
+m2
+jmp *r6
+L83: .data -172, -332, -254, 144, 759, -770
+L84: sub r1, *r2
+sub *r3, L90
+add *r0, L100
+rts
+clr L28
+jmp L94
+dec r5
+L85: sub L57, r6
+L86: .data -926, 728, 996, 790, -285
+inc r4
+rts
+sub r5, L12
+jmp *r5
+dec *r7
+lea L63, *r1
+sub *r6, L70
+; comment
+m4
+sub r4, r7
+dec r6
+L87: lea L99, L83
+m3
+L88: .data -358, -454, -344, -451, -835, 627, -513
+L89: bne L58
+jsr *r5
+L90: .string "jiatetrezrosy"
+m3
+lea L42, r2
+jsr *r3
+lea L114, r3
+rts
+jsr L105
+inc *r7
+m1
+dec r1
+rts
+m1
+red L99
+add *r1, r0
+mov L50, *r4
+jsr *r2
+rts
+clr r0
+red r6
+L91: .string "tcktjehsdxhstmsvcjs"
+m4
+stop
+L92: .data -58, 176
+; comment
+m3
+L93: .data -919, -571, 523, -597, -99, -439, 89
+clr *r2
+L94: sub r4, r1
+jmp L108
+jsr *r0
+red *r7
+m0
+L95: .string "vxv"
+not *r0
+mov L99, r4
+bne L93
+m2
+stop
+L96: .data 268, 113, 622, -479, -665, 706
+dec *r0
+not L59
+L97: cmp L100, L105
+m0
+sub r6, L114
+L98: sub L107, r3
+m4
+m1
+m0
+jmp L68
+not L115
+rts
+lea L81, L69
+add L51, r7
+m1
+inc *r5
+prn L101
+L99: .string "tgtpj"
+not r6
+L100: .string "ugkdctodgjgo"
+L101: red L115
+clr L108
+stop
+L102: jsr L65
+dec L113
+L103: bne L112
+not r0
+m3
+add *r5, r2
+lea L114, r6
+L104: jmp *r1
+m1
+not r3
+L105: .data 542, 405, -202, 30
+L106: clr *r5
+jmp *r6
+mov *r4, *r4
+L107: stop
+prn r6
+not *r1
+L108: .data -619, 504, 364, -959, -888, -532, 755, 321
+L109: .data 369, 669
+; comment
+add L52, r0
+m1
+
+lea L113, *r2
+L110: clr L79
+red L67
+jmp *r0
+lea L29, *r2
+inc L115
+inc *r2
+dec r6
+add L45, *r2
+L111: inc r3
+bne L115
+m4
+jsr *r2
+L112: .string "fhftsyhsil"
+dec L114
+clr *r4
+bne *r6
+mov r2, *r2
+red L115
+not L57
+jmp L115
+jmp L113
+L113: .data -205, -818, 466, -600
+bne *r2
+red L114
+L114: .string "hlrk"
+L115: .string "ypsfcayyozhyeobdblfdwq"
+m2
+lea L95, *r2
+bne L78
+rts
+stop
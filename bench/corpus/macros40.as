@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 41
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    jsr *r2
+    cmp #86, L41
+    clr *r3
+    mov L105, L98
+    dec *r2
+    stop
+    inc *r2
+    dec r1
+    jsr L52
+    dec r0
+endmacr
+macr m1
+    inc L44
+    not L87
+    jmp *r6
+    dec r0
+    red r2
+    lea L79, L70
+    clr L107
+    stop
+    dec L20
+    stop
+endmacr
+macr m2
+    red r2
+    add *r4, r6
+    inc *r7
+    jsr *r0
+    inc L17
+    dec L19
+    cmp L113, *r7
+    prn r1
+    cmp *r2, *r1
+    dec *r2
+endmacr
+macr m3
+    lea L79, L46
+    red L77
+    inc L55
+    inc r2
+    bne L43
+    rts
+    sub L54, *r5
+    mov L112, *r7
+    stop
+    dec *r4
+endmacr
+macr m4
+    red *r2
+    rts
+    lea L88, r3
+    not r5
+    jsr *r5
+    cmp L1, L106
+    not *r6
+    dec *r4
+    sub L70, *r2
+    mov L40, L114
+endmacr
+prn L96
+L0: .string "nqnbzhxbp"
+L1: cmp *r3, L1
+add *r6, L7
+jmp L1
+m4
+prn *r0
+
+L2: .data 395, -894, -459, -449, 889
+jsr *r2
+L3: cmp #178, *r7
+L4: sub *r1, r4
+inc r3
+jsr *r0
+L5: add *r0, *r2
+; comment
+add *r1, *r6
+L6: rts
+bne L3
+bne L4
+L7: prn #226
+L8: jmp *r0
+
+jmp *r0
+cmp L4, #241
+cmp r6, L62
+inc r5
+L9: .string "ijq"
+L10: .string "ncaflembbrppcbru"
+m4
+L11: jmp *r4
+inc L97
+rts
+L12: mov L0, L48
+red L6
+inc r7
+bne L7
+L13: rts
+L14: .data 289, 362, 557, 512, -435, -849
+bne *r3
+dec r3
+sub r5, *r0
+L15: mov L83, *r3
+dec r3
+m2
+jsr L70
+inc L89
+; comment
+m0
+L16: red L106
+L17: cmp r4, *r1
+m2
+L18: lea L15, L13
+m3
+mov #44, r5
+add #185, *r5
+
+m1
+rts
+L19: .string "zetwybzonoa"
+m3
+inc *r1
+L20: not L68
+add #-73, *r7
+lea L2, r1
+lea L4, r2
+m1
+prn L55
+rts
+m0
+; comment
+L21: rts
+stop
+m1
+lea L93, *r7
+m4
+stop
+not r2
+rts
+
+L22: add #-55, L83
+L23: jmp L13
+sub *r3, r0
+jsr L21
+L24: .string "jtyvv"
+L25: stop
+L26: inc L32
+sub #140, L26
+sub *r3, L41
+clr L44
+red L11
+mov *r6, L59
+add *r1, L107
+m1
+stop
+L27: jsr *r7
+inc r6
+L28: .string "wozvrb"
+stop
+inc r2
+m4
+L29: dec L26
+L30: .data -716, -38
+stop
+jsr L30
+stop
+m1
+jsr *r7
+L31: .data 390, -733, -763, 318
+jsr *r1
+; comment
+jmp L8
+prn *r5
+lea L22, *r1
+cmp #-130, #24
+; comment
+jsr *r0
+L32: clr *r5
+not L1
+not *r1
+add L40, r6
+jmp L17
+L33: .string "fgw"
+lea L27, r2
+mov L49, *r7
+L34: .data -390, 944, 433, 215
+L35: red *r7
+L36: .string "jedos"
+clr *r3
+L37: .data -260, -737
+lea L82, *r5
+mov *r5, L45
+sub L45, r3
+mov *r3, L32
+rts
+dec L25
+red r5
+add #-102, L66
+sub *r3, *r5
+cmp #75, #-251
+rts
+m2
+sub r3, L85
+bne *r1
+lea L10, r0
+stop
+stop
+mov r2, *r5
+m2
+L38: add *r6, r0
+rts
+jmp L43
+sub L25, r5
+bne L92
+; comment
+add r6, *r0
+cmp *r6, *r6
+sub #-111, *r7
+L39: rts
+L40: jsr L100
+m3
+m2
+dec *r4
+m4
+m0
+m4
+m0
+L41: .string "tsqcipryhshcz"
+not r6
+m1
+L42: inc r6
+add L27, *r5
+L43: add *r5, r0
+stop
+L44: .string "equlnlvqqofqvbnxn"
+m3
+prn *r5
+; comment
+jmp L4
+lea L84, r7
+m0
+L45: add *r7, *r0
+L46: lea L10, L78
+L47: bne L49
+prn L26
+L48: .data -128, 452
+m0
+L49: jsr L48
+add *r5, *r2
+prn r7
+jmp *r6
+m2
+m2
+red *r0
+jmp *r1
+jmp L35
+rts
+mov L47, L34
+mov L7, *r7
+L50: .string "coujrfnm"
+clr r3
+; comment
+add r2, *r6
+dec L22
+lea L64, r6
+L51: mov r7, L104
+L52: .string "uto"
+m2
+m2
+stop
+clr L95
+rts
+add *r6, L15
+m3
+not L18
+clr r0
+m0
+m0
+mov *r0, *r5
+L53: sub r0, *r1
+m0
+red *r6
+m1
+clr *r6
+jmp L69
+bne *r6
+L54: .string "qsimhiwbcyji"
+; comment
+L55: .data 597, 785, 599, 428, -367, 972, -489, 7
+clr L52
+cmp L66, #-171
+
+L56: rts
+L57: bne *r4
+stop
+stop
+L58: lea L63, L69
+not r7
+inc *r0
+mov #-107, *r0
+clr L78
+L59: jsr *r0
+L60: .string "zhjsvxdaux"
+m1
+stop
+L61: bne *r2
+rts
+not r6
+red r5
+mov *r4, r7
+cmp r6, *r6
+m1
+m1
+lea L47, *r4
+mov *r0, L14
+m2
+m1
+add r4, r5
+m3
+; comment
+L62: inc L49
+m4
+clr *r0
+red r7
+stop
+lea L32, *r3
+L63: clr L4
+m0
+lea L69, r4
+add #1, *r5
+m2
+m0
+add L87, r7
+m3
+jmp L111
+bne *r6
+stop
+not L53
+m2
+m3
+cmp r1, *r1
+cmp r1, r2
+L64: .data 140, 796, 899, 329, 816, 997
+m3
+prn #51
+cmp #116, #-181
+red r1
+L65: prn *r7
+jmp L39
+; comment
+cmp *r0, #-130
+not *r3
+L66: inc r0
+L67: mov r5, L62
+m2
+dec L20
+rts
+clr L63
+
+L68: .string "wqbnnn"
+red L103
+cmp r3, #-10
+dec L67
+sub #2, r0
+bne L82
+L69: .string "mwmpijrefoshbdghhhhgwpd"
+L70: .string "kaayzpaxnoa"
+rts
+clr r2
+L71: rts
+prn L76
+clr r2
+inc r6
+L72: .data -707, 236, 276, -628, 983
+L73: inc r5
+dec L91
+L74: mov *r1, L8
+m3
+red r4
+inc *r4
+prn r2
+L75: cmp #-164, L102
+jsr L111
+m1
+clr r0
+L76: jsr *r7
+m1
+clr L111
+inc r1
+L77: .string "aj"
+bne *r7
+stop
+L78: mov r2, r1
+L79: .data -558, -251, 894, 127, -658
+clr *r4
+rts
+mov L10, L76
+L80: .string "wcifylhpwra"
+L81: .string "g"
+red *r3
+add #-99, L73
+m4
+mov r0, r1
+jmp L83
+L82: .string "vpkmvjlbmnnenvobetsxfbu"
+L83: add r5, *r5
+m1
+m2
+sub L7, *r4
+m4
+m2
+add L32, L44
+jsr L32
+m0
+add L84, *r7
+clr r5
+L84: dec r4
+clr r1
+dec L86
+sub L24, r1
+mov L65, L11
+m4
+m2
+not *r2
+stop
+; comment
+L85: .data -257, 502, 42, -603, 643, 236, -300, -705
+inc L99
+jmp *r6
+m1
+
+add r5, r1
+jsr L32
+cmp *r6, #-179
+bne L4
+L86: .string "wsazjhkcjhzttpwdhl"
+L87: jmp L63
+L88: .data -374
+cmp L36, L94
+clr *r7
+mov *r0, *r0
+prn #116
+L89: cmp r6, L109
+inc *r3
+cmp *r4, *r1
+rts
+sub r7, r4
+; comment
+jsr L82
+L90: .data 171, -93, 829, -122, -305
+prn #184
+dec r1
+mov r7, *r5
+L91: prn #228
+m4
+m0
+red *r1
+bne *r4
+cmp r1, L82
+stop
+L92: dec L113
+m0
+lea L83, L98
+sub *r1, *r2
+prn L106
+m2
+rts
+L93: mov r0, *r7
+rts
+L94: not *r6
+L95: .string "cxsunhytefbndc"
+jmp L99
+L96: mov #171, L30
+L97: .string "am"
+red r4
+not *r0
+red r6
+L98: jmp *r5
+not L52
+m4
+L99: inc r7
+L100: lea L94, *r3
+inc r3
+L101: mov #183, L29
+m1
+add L87, *r4
+m2
+bne L107
+red L25
+L102: stop
+dec *r4
+mov #192, r1
+not r2
+m1
+; comment
+L103: rts
+L104: .data -4, 613, 944, 64, 791, 200, 656, -628
+red L109
+m2
+L105: clr r4
+stop
+not r3
+prn #220
+m1
+prn r2
+rts
+clr r1
+L106: lea L107, L68
+jsr L63
+cmp r0, *r3
+jmp L99
+lea L109, L112
+m0
+red *r0
+dec *r2
+
+lea L113, *r6
+sub r3, *r3
+lea L110, r3
+red r6
+dec r4
+lea L60, L114
+add *r2, *r0
+add *r4, r2
+cmp r7, *r7
+L107: .data 714, -307
+stop
+stop
+L108: jsr *r3
+mov #77, L54
+dec L108
+m0
+lea L40, *r5
+m2
+bne *r3
+dec *r3
+rts
+clr L68
+red L111
+L109: mov *r0, L111
+L110: lea L38, L113
+m0
+L111: .string "scuvbljr"
+L112: cmp *r7, #-239
+L113: red r7
+prn r1
+m0
+jsr *r4
+m2
+lea L58, L55
+jsr L114
+stop
+jsr *r6
+sub r1, *r1
+m4
+clr r5
+mov #-24, r1
+add *r0, L114
+L114: lea L64, *r0
+jsr *r6
+stop
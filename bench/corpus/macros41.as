@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 42
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    mov *r2, r1
+    bne L47
+    dec L15
+    prn *r7
+    jsr *r0
+    mov r0, r0
+    not r1
+    clr r1
+    red r7
+    add r2, L45
+endmacr
+macr m1
+    jmp L40
+    sub L13, *r0
+    stop
+    stop
+    clr L112
+    mov L7, L87
+    red r2
+    not *r2
+    stop
+    lea L81, r7
+endmacr
+macr m2
+    jmp L100
+    inc L17
+    bne *r0
+    cmp *r2, #-234
+    mov r2, L47
+    dec r3
+    cmp *r2, #7
+    cmp r6, *r2
+    jsr *r6
+    jmp *r5
+endmacr
+macr m3
+    rts
+    clr *r7
+    mov *r7, L63
+    red L8
+    mov L87, r3
+    sub L107, r2
+    add r5, *r6
+    sub #97, *r4
+    sub L34, *r4
+    clr *r0
+endmacr
+macr m4
+    not *r6
+    prn *r3
+    red L44
+    red *r4
+    sub r3, *r7
+    clr *r4
+    cmp *r1, #-31
+    sub L47, r6
+    rts
+    jsr L70
+endmacr
+L0: bne *r5
+stop
+bne *r5
+L1: rts
+clr *r6
+stop
+add r6, L0
+L2: dec *r2
+m2
+L3: .data 66, 145, 212, 398
+red *r0
+; comment
+L4: .data 531
+cmp #162, #-92
+red r7
+m2
+L5: lea L39, L82
+L6: .data -545, -978, -469, -803
+rts
+clr *r7
+L7: rts
+bne *r4
+L8: .string "kmxinxjazoczkf"
+L9: .string "o"
+L10: cmp r7, L37
+L11: sub r0, r0
+L12: add *r6, L97
+L13: not *r3
+m1
+m4
+lea L49, r1
+dec r1
+L14: mov L28, L91
+L15: .data -911, 813, -509, 539, -613
+L16: red *r6
+L17: jsr L6
+prn r2
+jmp *r0
+inc r1
+cmp #-29, #31
+add *r3, L55
+m4
+bne L55
+dec r3
+m3
+m3
+m3
+L18: .data -889, 33, 136, 373, -542, 715
+m0
+L19: prn r5
+jsr *r4
+red r1
+m4
+stop
+m1
+inc L11
+jsr *r5
+L20: jmp L5
+not *r6
+L21: .data -516, 625, -445, -455, 454
+add #-84, r5
+m4
+L22: jsr L5
+jsr *r5
+L23: add L16, *r1
+add *r7, r5
+dec *r6
+m3
+rts
+m2
+m3
+
+L24: .data 160, 730, -275
+L25: inc *r0
+L26: stop
+rts
+L27: .string "bfjpawtuwlijob"
+cmp L42, r1
+L28: red r6
+L29: not L59
+m1
+clr *r4
+; comment
+jmp *r7
+lea L35, r0
+L30: .data 606, -453, 948
+not r3
+L31: .string "d"
+sub #-99, L102
+m0
+rts
+L32: .string "bdegztvdaicvcjktfgyqxwc"
+mov *r0, L59
+rts
+sub *r2, r1
+sub #81, r4
+red r1
+inc L103
+L33: sub #229, *r0
+m4
+m0
+; comment
+lea L57, L85
+m0
+dec *r2
+sub #-200, L49
+inc L118
+dec r6
+dec *r0
+jmp *r6
+
+m0
+mov L31, L4
+prn r6
+cmp r1, r4
+L34: .data -984, -74, -278, 552
+dec *r5
+stop
+mov *r1, L21
+sub L60, L11
+sub *r4, *r5
+L35: red r2
+dec r6
+add #-196, *r3
+clr *r5
+rts
+m4
+L36: .data 836, -881, -491, -102, 355, -226
+bne L119
+clr L17
+m1
+m4
+stop
+clr *r7
+not L118
+cmp r1, #240
+
+m1
+not L49
+m1
+jmp *r2
+jsr L22
+prn #-249
+dec r0
+rts
+lea L111, *r1
+L37: dec *r4
+sub #48, L78
+rts
+L38: red L30
+L39: jsr *r4
+not r7
+m4
+bne *r0
+sub #166, r6
+L40: .string "yfxtcjxuxtxrtdbkdqok"
+sub L30, r5
+jmp *r2
+bne *r3
+m0
+mov L22, L37
+
+m1
+L41: jmp *r7
+clr L71
+L42: .data -626, 519, -56, 159, -597
+; comment
+m0
+L43: .data 326, -727, -865, -955, 860
+prn L26
+inc L118
+dec *r6
+red L18
+red *r4
+m1
+inc L7
+clr L55
+prn #15
+clr L7
+L44: .data -607
+rts
+L45: .string "aupbjuoyjtxmnofmtkvzy"
+L46: jmp L8
+bne *r4
+red r6
+jsr *r3
+add #140, *r0
+mov #-146, L45
+jsr *r6
+inc *r5
+L47: jsr L5
+rts
+m4
+bne *r0
+L48: red *r0
+
+red L31
+L49: .string "lvtvhnlstxxmpkpkvwfpq"
+mov L85, *r7
+clr *r6
+red r2
+not r4
+L50: sub L73, *r2
+inc *r1
+cmp #-170, L41
+L51: cmp L99, #138
+not r2
+not L26
+jmp L121
+add r6, *r1
+L52: .string "e"
+L53: bne *r6
+prn #-54
+rts
+L54: .string "bahvvzbqq"
+inc r2
+L55: .data -679, -295, -799, -870, 265, -695, -421, -785
+L56: prn L81
+mov L37, L74
+stop
+dec L22
+sub #-8, L89
+rts
+; comment
+m4
+m4
+dec r3
+not L27
+inc *r3
+lea L33, L24
+stop
+dec r1
+L57: .string "x"
+dec *r6
+bne *r7
+L58: add r1, *r7
+m4
+L59: .data 891, -490, 52, -56, 198, -652, -444
+bne *r1
+prn L43
+L60: .string "pgimfynzy"
+L61: bne L4
+m1
+stop
+
+inc r4
+m1
+stop
+lea L53, r4
+L62: dec L73
+L63: .data 315, -350
+rts
+
+red *r7
+rts
+dec L49
+L64: .data 668, 64, 785, -632, 90, -917
+L65: .data 407, -527, 548, -150, 823
+m4
+jsr L26
+cmp *r6, L91
+L66: jmp *r2
+jsr L115
+mov L99, *r2
+m1
+L67: .string "kbysrlwok"
+rts
+lea L113, *r1
+jsr *r5
+prn r5
+mov #157, r5
+L68: .data -89, 656, -38, -951, -864, -356, -50, 111
+L69: not r1
+L70: .data 129, 258
+cmp *r2, *r0
+cmp r7, L18
+L71: .data 558, 437, -585, -863, -821, -238, 667
+cmp L75, L75
+not r3
+bne *r0
+cmp #71, #25
+L72: inc r6
+L73: mov #-198, L27
+dec r5
+clr L104
+m0
+clr r3
+m0
+L74: sub L117, *r7
+L75: .data -204, 364, 193, -881
+add L64, r2
+L76: .data 946, 362
+cmp *r6, L117
+; comment
+L77: .string "mvax"
+lea L118, r4
+inc r1
+mov *r1, L94
+clr L52
+sub r1, L121
+L78: .string "eftpwerf"
+L79: .data 729, -385, -834
+red *r3
+sub *r1, r1
+clr L50
+
+jmp *r7
+clr *r0
+inc L49
+
+
+stop
+clr L8
+L80: .string "dgtzuexq"
+L81: dec *r6
+mov #243, r7
+bne L112
+L82: mov #5, L110
+lea L70, r2
+jmp *r4
+prn *r4
+mov #2, r4
+L83: .data -986
+clr *r4
+L84: .data -206, -276, 458, -324, 210, -959, -434
+L85: jmp L68
+bne *r1
+L86: dec *r7
+inc r1
+m0
+jsr L12
+m4
+m0
+L87: sub L93, L22
+; comment
+jmp L81
+m1
+prn L87
+L88: clr L112
+red r0
+bne *r3
+L89: .string "kkftg"
+inc L80
+prn L15
+m4
+L90: jmp *r1
+stop
+mov *r3, L98
+sub L41, L105
+
+inc *r0
+red r3
+rts
+L91: .data 6, 932, -361, -156, 812, -744
+m1
+L92: jmp L99
+m2
+m0
+red *r0
+m3
+bne *r3
+red L67
+m1
+cmp r5, #-79
+L93: stop
+L94: .string "dmmywzkbusurzuhubzvf"
+jmp L40
+jmp L100
+L95: bne *r7
+dec L115
+rts
+rts
+L96: mov #-81, *r3
+m0
+m3
+jsr L44
+L97: stop
+m0
+; comment
+cmp r4, #142
+L98: .data 516, -676, 581, -504, 431, -804, 778, 306
+mov r1, L105
+L99: lea L113, r7
+bne *r5
+bne L121
+cmp *r6, #179
+sub *r6, *r1
+add L15, r0
+m0
+L100: inc r4
+m1
+jmp L10
+jmp *r1
+stop
+prn *r5
+L101: dec r2
+m4
+m1
+m4
+jmp L77
+m1
+m0
+L102: .data -607, -580, 314, -370, 11
+jmp L101
+m4
+L103: stop
+m3
+rts
+red L114
+L104: stop
+clr r4
+m3
+inc r5
+L105: .data -558, -351
+add r4, *r2
+bne *r0
+L106: not *r5
+cmp r5, *r0
+dec r2
+dec L107
+cmp r0, r1
+L107: not r4
+L108: jsr L118
+m1
+mov r7, r7
+dec L67
+jmp *r5
+dec L124
+bne *r3
+m3
+inc *r2
+rts
+sub r5, L117
+bne L113
+rts
+jsr L58
+rts
+bne L111
+L109: .data 226, -486, -465, -439, -806, -403
+m4
+clr *r5
+cmp L98, r7
+not *r0
+L110: prn L116
+stop
+mov #-53, L69
+L111: .string "aodlaltkykmphgbmksxznk"
+dec *r0
+L112: red *r6
+m1
+m1
+L113: rts
+prn r1
+rts
+mov L31, L122
+jsr L101
+L114: cmp #86, r0
+L115: dec L68
+add L41, r3
+mov L91, r7
+; comment
+mov #-225, r6
+L116: .data 351, -793, 689
+sub L28, *r1
+m4
+prn r1
+m4
+jmp *r4
+
+clr r1
+L117: jsr *r1
+m3
+lea L119, *r1
+m0
+not *r2
+add r2, L104
+L118: .data -350, 175, -817, 44
+L119: lea L123, *r7
+L120: .string "afcsh"
+jmp *r3
+prn #181
+m4
+add L124, *r1
+bne *r2
+sub #-58, *r6
+L121: inc L9
+not *r6
+lea L108, r3
+L122: .data -709, 900
+red L28
+mov *r1, *r0
+bne *r2
+m0
+jsr *r0
+L123: lea L90, r2
+jmp *r1
+L124: rts
+rts
+add *r4, *r4
+cmp *r2, L12
+stop
@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 43
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    prn L23
+    cmp L115, #115
+    clr L85
+    sub r3, L100
+    add L84, L43
+    not r5
+    add r3, r1
+    add #116, *r6
+    prn #-203
+    sub *r3, r7
+endmacr
+macr m1
+    sub r0, L66
+    mov #-236, r2
+    prn *r7
+    inc r7
+    lea L117, r7
+    clr r3
+    inc L114
+    sub L78, r5
+    mov L61, L63
+    jsr L14
+endmacr
+macr m2
+    clr r6
+    sub *r4, L102
+    rts
+    not *r1
+    jsr L53
+    mov r7, r2
+    bne *r0
+    rts
+    jmp L20
+    mov *r2, *r1
+endmacr
+macr m3
+    mov #124, r0
+    jmp *r4
+    bne L72
+    prn L90
+    prn #236
+    lea L110, *r2
+    dec *r4
+    not *r6
+    inc r2
+    jmp L13
+endmacr
+macr m4
+    clr L108
+    rts
+    rts
+    rts
+    inc *r3
+    stop
+    inc r3
+    lea L73, *r2
+    prn r1
+    dec r0
+endmacr
+m2
+L0: rts
+prn L25
+L1: stop
+cmp L0, L96
+clr r4
+mov #-155, r1
+m0
+rts
+L2: .string "wmpjqsogpwgsidfypxjfbg"
+L3: not L0
+m1
+m3
+red L1
+jmp L1
+prn L0
+sub L1, L63
+rts
+jsr *r7
+prn L3
+mov r7, r5
+m2
+m4
+L4: dec r4
+
+m3
+inc r5
+L5: red *r1
+
+not r5
+L6: bne L2
+L7: bne L1
+L8: .string "vt"
+lea L12, *r0
+L9: bne *r1
+mov L37, L9
+cmp L2, *r4
+m2
+rts
+L10: add L76, L16
+add #91, *r7
+m2
+prn #13
+L11: jsr *r6
+stop
+L12: not L2
+sub L114, L5
+not *r1
+; comment
+m0
+lea L7, L9
+jsr *r5
+sub L117, r1
+jsr *r6
+not r4
+L13: .data 870, -5, -446, 68, -10, 815, 99, -532
+sub L100, L13
+dec r7
+stop
+jmp L55
+L14: .string "whntzkgcessvar"
+rts
+m0
+; comment
+
+dec *r7
+jsr *r0
+mov L63, L12
+bne L81
+L15: red r5
+m3
+mov r7, r3
+red *r2
+L16: not *r6
+jsr L97
+L17: mov r2, r2
+red *r4
+L18: lea L41, L83
+cmp #1, *r2
+red L14
+jsr L16
+bne *r1
+L19: .string "ltumtmldixcsh"
+L20: lea L27, L114
+jsr *r5
+m1
+m4
+
+L21: clr L10
+mov *r5, L108
+L22: prn L11
+not r2
+mov *r6, *r1
+stop
+m4
+lea L35, r2
+L23: clr r5
+not r0
+L24: jsr *r3
+cmp #-126, r0
+red L93
+L25: .string "duostbb"
+sub #125, r7
+L26: stop
+L27: .string "oq"
+m4
+jsr *r0
+stop
+L28: inc r2
+add #34, r6
+rts
+red L7
+L29: rts
+inc L40
+stop
+m3
+L30: rts
+sub L33, L10
+rts
+L31: rts
+clr r3
+cmp #103, #78
+
+clr *r1
+L32: cmp r1, L2
+mov L103, L97
+rts
+L33: rts
+lea L24, *r4
+red *r7
+cmp *r3, #-155
+red L32
+rts
+jmp L19
+m4
+m0
+jmp L29
+mov r6, r2
+L34: .data -135, 693, 119, 21, 261
+add #83, L10
+stop
+mov L36, L13
+stop
+sub #-139, L60
+rts
+jmp L17
+sub #-80, r0
+
+L35: .string "jlcebdwhanrak"
+not *r1
+cmp r5, #-152
+L36: add #-251, L27
+
+m0
+prn #74
+stop
+add r1, r2
+mov L29, r2
+jsr *r7
+dec L8
+m2
+L37: .data 966, -256, 241, -477, -21, 203, -173
+L38: rts
+clr L19
+jmp L2
+L39: .data -448, 982, -143, -773, -651, -508, 7, 798
+m4
+red *r7
+cmp #-95, r0
+cmp L25, L18
+L40: not r1
+m1
+m0
+L41: .data 523, 146, 383, -213, 579, -720, -40, -86
+m0
+L42: not r2
+jsr L92
+m3
+m3
+jmp *r4
+jsr *r0
+mov L7, *r2
+L43: mov r2, L22
+L44: .string "lr"
+lea L64, *r6
+clr L0
+stop
+stop
+L45: prn #-237
+rts
+bne *r2
+mov L73, L38
+add *r1, r7
+jmp L18
+stop
+prn r1
+jsr *r1
+sub #-220, *r1
+m4
+m3
+jmp *r1
+cmp r6, L89
+
+L46: sub L80, L3
+L47: clr r4
+clr *r3
+m1
+m2
+L48: jmp *r6
+red *r3
+stop
+not L78
+mov *r2, r7
+clr r7
+prn #220
+bne L43
+bne *r5
+inc L61
+inc L99
+dec r4
+cmp #215, L67
+bne *r6
+L49: .data -68, 594, 245, -73, -701, 144, -654, -658
+m1
+m4
+sub r3, L27
+clr *r5
+L50: clr *r3
+rts
+L51: .data -628, -544, -140, 978
+cmp #-202, *r5
+; comment
+
+rts
+red L115
+L52: clr r2
+m2
+add L117, *r2
+rts
+clr *r1
+mov r2, *r7
+L53: .string "nfun"
+L54: not L73
+dec L115
+rts
+m1
+L55: mov L71, L78
+L56: red *r7
+cmp L91, #-55
+bne L46
+m2
+cmp r4, L72
+L57: .string "gxgh"
+m4
+mov r5, L9
+cmp #-139, #104
+L58: sub *r5, L89
+L59: .data -126, 87, -550, -671, -112, -902, 878
+jsr L65
+rts
+mov r0, *r2
+L60: mov *r6, L99
+bne *r2
+L61: stop
+stop
+bne *r7
+prn #-226
+mov *r5, L118
+L62: .data -382, -596, 381, -889, -826, -923, 867, -46
+red L68
+rts
+L63: bne L0
+m4
+not r1
+L64: not r1
+L65: bne *r1
+stop
+m0
+stop
+; comment
+inc L44
+not L59
+not r1
+m3
+red L36
+m4
+stop
+L66: prn #123
+jmp L48
+m1
+L67: .data 118, 996
+L68: .string "tbgybgmqjvfndcstd"
+lea L20, *r7
+m0
+L69: not r7
+dec L91
+rts
+m0
+lea L55, *r7
+L70: cmp #-254, #-26
+rts
+m4
+red L107
+L71: .data -778, -131, -79, 545
+L72: .string "umwudamozg"
+mov L59, L76
+not r3
+jmp L113
+m2
+L73: .data 707, -34, -135
+L74: .data 3, -959
+m3
+rts
+jmp L20
+L75: rts
+L76: .string "tfxzadascshipfok"
+cmp L27, *r1
+lea L47, L44
+L77: mov L33, r2
+clr r6
+; comment
+bne *r2
+L78: .string "rmrhoniylin"
+jmp *r7
+lea L57, L115
+bne *r7
+L79: .data 977
+; comment
+dec L112
+bne *r4
+cmp *r5, L78
+stop
+jsr *r3
+cmp #26, *r5
+L80: .string "jqyqnbwqzdso"
+m4
+lea L46, *r3
+red *r7
+m3
+m0
+sub r0, *r2
+L81: .string "jikxsqylgivnqmxxsedgec"
+rts
+jsr L48
+L82: .data -267, 540, -215, 866
+rts
+L83: .data 381, -793, 401, -545, -347, -190, 625, -282
+add r4, *r4
+mov r2, L9
+rts
+dec *r7
+prn #-52
+L84: .data 497, -927, 19, 26, 885, -934
+bne L99
+m2
+m2
+dec r2
+red L17
+not L28
+not *r4
+jsr L85
+m2
+m2
+m0
+mov L98, L113
+L85: prn L92
+stop
+L86: .data 893, 942
+mov L50, r4
+stop
+stop
+bne L80
+; comment
+jmp L86
+stop
+L87: jsr *r4
+mov #-66, L83
+L88: dec r7
+add #-183, *r1
+; comment
+L89: sub L93, L16
+L90: mov *r1, L113
+m1
+add *r3, L9
+clr r4
+m3
+cmp #82, #-211
+cmp r7, L26
+prn *r4
+L91: jmp L43
+
+mov r6, *r2
+L92: .string "lexojhlhpsispzdtyxtoz"
+bne L103
+mov L86, L106
+m0
+
+m3
+mov L99, *r1
+inc *r2
+m1
+L93: .string "yxdicaaftnjqz"
+mov L112, *r7
+m1
+L94: add L37, L96
+jsr *r6
+cmp #120, L21
+; comment
+red *r5
+add L114, L28
+L95: lea L107, r7
+rts
+add #45, r7
+L96: bne *r3
+m3
+m1
+L97: mov *r5, L102
+sub L106, *r5
+mov r1, *r7
+jmp *r5
+; comment
+L98: .string "hnwsolhpksdbxnfierk"
+dec *r3
+rts
+red L61
+m2
+red *r7
+stop
+prn r7
+
+L99: .string "spyksgcolnjowkpdmupxh"
+clr r5
+cmp #-178, #30
+L100: .data 489, -765, 242, 688, -425, -11, 170
+stop
+m2
+L101: .string "exuikgqebqbgwprzgmfwfrfr"
+sub *r3, r5
+m1
+m4
+L102: .data -873, -171
+L103: .data -218, -217, -995, -103, -624, 657, -695, 421
+L104: not *r4
+m3
+L105: add #-145, r6
+L106: stop
+jmp L115
+L107: cmp *r1, *r0
+rts
+add r3, r0
+
+L108: .string "raddwzftuk"
+bne *r6
+stop
+cmp L14, *r5
+L109: .data -634, 505, 439, 721, 843
+L110: .string "kxhwimclkqyrrmibszm"
+L111: .data 548, 232
+m4
+m0
+L112: bne L114
+L113: .string "rs"
+jmp L52
+prn #56
+rts
+m0
+jmp *r5
+m2
+not r5
+m4
+red L115
+inc r7
+jmp L116
+L114: not *r7
+not *r5
+L115: rts
+L116: .string "xebghmt"
+add L117, *r3
+m0
+m4
+jmp L56
+clr *r5
+jsr L118
+jmp L117
+dec L113
+mov L77, r5
+m3
+stop
+inc r0
+cmp #229, *r5
+cmp #229, r0
+lea L103, *r2
+add *r2, L117
+rts
+cmp #128, L118
+L117: .data 212, 506, 297, -741, -803, -209, 434
+m3
+sub #252, L109
+L118: sub #-192, L23
+not r3
+stop
@@ -0,0 +1,568 @@
+; Generated by genCorpus --seed 44
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+macr m0
+    add r4, L25
+    dec r6
+    dec L6
+    sub *r5, *r5
+    clr r4
+    stop
+    bne L51
+    jmp L67
+    stop
+    clr *r4
+endmacr
+macr m1
+    not L47
+    not L39
+    sub #-41, r5
+    bne L50
+    red L59
+    dec r6
+    add #-105, *r1
+    inc r7
+    jsr L89
+    stop
+endmacr
+macr m2
+    dec r7
+    cmp *r1, r5
+    clr r6
+    sub r7, *r7
+    inc r0
+    red r1
+    stop
+    jmp *r7
+    add #182, L84
+    red *r2
+endmacr
+macr m3
+    red L13
+    jsr L48
+    jmp *r2
+    red r6
+    not *r6
+    bne *r1
+    prn r7
+    stop
+    inc r2
+    bne *r3
+endmacr
+macr m4
+    rts
+    clr L52
+    clr *r2
+    red L81
+    mov r0, r6
+    lea L94, *r0
+    inc *r7
+    dec *r6
+    inc L82
+    clr r0
+endmacr
+
+prn #194
+not *r2
+L0: prn L58
+m1
+bne L0
+dec r6
+inc *r3
+stop
+cmp r5, L47
+bne *r2
+stop
+jmp L16
+add r0, *r5
+not *r6
+add L62, L0
+prn #-88
+jsr L0
+bne *r2
+; comment
+red r7
+prn #-204
+L1: add #102, L40
+not *r5
+m2
+lea L61, L0
+not L1
+prn L0
+m2
+prn #229
+add r7, *r1
+m4
+not L0
+L2: mov L93, *r0
+L3: add *r3, *r5
+jsr L87
+L4: .data -902, -316
+cmp #-89, *r5
+L5: .string "ukfukl"
+stop
+rts
+jsr L2
+prn *r2
+L6: .data 933, 381, -485, 199, 522, -374, 712
+jsr L5
+; comment
+m3
+mov r0, r1
+m1
+clr *r0
+sub L2, r5
+L7: stop
+not r1
+add *r7, L2
+L8: jsr L1
+red L24
+m1
+rts
+add r2, L6
+clr *r6
+bne L74
+m4
+jmp *r2
+mov *r5, r4
+m4
+
+inc *r4
+L9: mov L20, r2
+cmp L0, L30
+dec r6
+m0
+L10: .string "rvyoaxhhxi"
+bne L8
+L11: add L4, r3
+jmp *r6
+bne *r6
+m4
+L12: red L48
+m2
+not L73
+L13: bne *r0
+clr *r1
+m3
+dec L10
+not L11
+L14: mov r0, *r4
+m2
+L15: .data 727, 941, -826, -643, -800, -901
+clr r0
+prn L7
+sub L43, L70
+not L8
+m1
+jsr L3
+cmp r1, L81
+add *r0, *r3
+not L41
+
+inc L7
+m4
+mov *r2, r2
+not r4
+m3
+L16: jsr L48
+
+lea L18, *r7
+m0
+L17: .string "pglharmniirmabc"
+jsr *r5
+m3
+mov L3, L14
+clr r0
+m4
+jmp L28
+bne L62
+prn *r1
+L18: .data 494, 104, -777, -737, -174, 270
+m4
+prn *r5
+stop
+m2
+; comment
+sub *r6, *r2
+m1
+not *r4
+L19: sub #-74, *r5
+L20: .data -681, -619, 597, 611, 681, 707
+mov *r0, *r2
+m0
+L21: .data -596, 39
+L22: clr L3
+sub *r7, r2
+m0
+m4
+add r2, r5
+m1
+; comment
+prn L84
+mov r5, *r6
+add #-7, *r4
+m4
+m4
+
+stop
+L23: clr *r0
+bne L20
+jsr L82
+m3
+not L3
+clr *r5
+jmp L31
+bne L33
+jmp *r4
+dec r7
+rts
+m2
+not L31
+jmp L89
+m2
+m1
+L24: prn L82
+L25: cmp L12, #-19
+not *r1
+sub #111, *r2
+mov #-227, r4
+sub L15, *r3
+m1
+jmp *r6
+bne *r6
+lea L22, L35
+m0
+L26: bne L25
+mov *r2, r2
+; comment
+m2
+prn r1
+jsr L3
+m0
+clr L24
+clr L26
+jsr *r3
+prn r7
+sub r2, L16
+m4
+stop
+L27: lea L6, *r4
+lea L69, r6
+m3
+prn *r5
+L28: .data -460, -773, 402, 990, -753, 936, 161, 838
+cmp r6, L59
+inc L13
+stop
+m3
+not *r7
+jsr L40
+mov r6, r4
+sub #177, L88
+sub L6, L53
+add L82, r4
+cmp *r1, r0
+L29: inc L59
+L30: sub L28, r4
+inc *r0
+inc L11
+jsr L26
+m2
+m3
+m3
+L31: prn L5
+m4
+; comment
+prn #-169
+L32: mov r2, *r2
+m0
+lea L79, *r5
+m1
+cmp *r1, #-255
+cmp *r6, #181
+m2
+add L5, *r6
+; comment
+jmp *r5
+L33: cmp #-19, r0
+L34: bne *r5
+stop
+bne *r7
+m2
+sub L59, r1
+m1
+jsr *r3
+rts
+lea L87, L31
+cmp L58, *r6
+dec r4
+not r7
+L35: .string "ianirklnv"
+L36: red L22
+L37: .string "splmzh"
+mov r3, r6
+inc L87
+rts
+add #-134, *r4
+lea L80, L3
+sub r6, *r2
+L38: inc L8
+stop
+jmp L28
+m1
+not *r2
+sub *r2, L20
+prn r7
+inc L38
+m0
+m1
+m3
+L39: prn #-94
+; comment
+dec r2
+lea L50, r6
+bne L8
+dec *r6
+not L92
+L40: .string "zcmdyigy"
+L41: .data 427
+L42: mov #253, L27
+m2
+L43: .data 397, 294, -737, 724, 184, -518, 950, -52
+L44: rts
+L45: add #59, r5
+sub #-74, *r7
+L46: sub r0, r2
+; comment
+L47: .data -879, 443, -879, -18, -538
+sub L57, r0
+L48: sub L62, L87
+add *r7, r3
+L49: rts
+
+m1
+add r7, r5
+m1
+L50: .string "zrbvlld"
+red *r7
+; comment
+not *r2
+L51: add r6, *r1
+jmp L24
+cmp L5, #-198
+
+L52: .string "shzpllmicxypzbhyrjitwkc"
+bne L90
+L53: clr L80
+; comment
+mov L0, L67
+add r5, L23
+prn L94
+red r4
+
+clr *r6
+clr L2
+L54: .string "za"
+m1
+L55: .string "bkfixxgxspamfmf"
+cmp *r0, *r2
+stop
+m3
+stop
+m3
+L56: prn r0
+not *r5
+cmp r1, #53
+m4
+L57: .string "czio"
+prn #91
+L58: red L90
+sub *r1, L76
+not *r0
+L59: jsr L34
+m1
+clr L69
+clr r1
+rts
+red r6
+L60: lea L72, *r5
+cmp *r3, #-134
+dec r3
+sub L82, L84
+red r2
+m3
+cmp *r2, #-204
+L61: rts
+m4
+jmp *r7
+m4
+add L9, *r2
+L62: .data 994, 43, 506, -670, 434, -733
+stop
+sub L67, *r3
+m1
+m3
+lea L43, *r2
+bne *r5
+; comment
+not L68
+stop
+; comment
+inc r5
+m1
+bne L37
+jsr L67
+add L65, L61
+; comment
+prn *r3
+dec *r5
+dec r4
+bne *r2
+jmp *r1
+rts
+clr *r5
+prn #78
+L63: prn L42
+cmp L78, #-177
+jmp L80
+m0
+m4
+m3
+clr L74
+clr L45
+bne L20
+cmp #-96, L85
+L64: lea L91, L9
+m4
+bne *r0
+stop
+lea L81, r3
+not r3
+inc L88
+m0
+L65: jsr *r4
+not *r0
+rts
+L66: red r7
+red L42
+stop
+m2
+mov r7, L89
+L67: dec *r2
+lea L93, r4
+add r0, r6
+L68: cmp L92, #-148
+cmp #240, #78
+; comment
+L69: .data -949, -47, 782, 471, -31, 5, -309, 612
+rts
+m0
+m2
+stop
+clr *r6
+m1
+L70: inc L20
+m3
+jmp *r6
+L71: .string "fptxmtumeqnzpzmf"
+m0
+inc r5
+not L27
+red *r7
+sub L83, *r1
+m3
+
+not *r5
+lea L36, *r4
+red r0
+not L63
+lea L83, *r7
+L72: prn r5
+mov *r3, L16
+inc r1
+red r2
+L73: add #-58, r0
+m0
+prn *r0
+clr r7
+mov L17, r7
+lea L41, *r7
+L74: .data 496, -293, 789, -116, -278, 45
+dec L32
+L75: dec r1
+cmp *r5, *r5
+dec *r0
+cmp r4, #89
+L76: .data -536, -254, -877, -888
+sub L81, *r2
+
+inc r0
+red r5
+bne L1
+L77: .string "kzoxxuwcxycbdacixtwrp"
+
+m0
+mov L90, r2
+sub #-121, r5
+inc *r0
+m4
+L78: .string "pqtddolvapfhzsrz"
+m3
+
+jmp *r0
+stop
+L79: lea L84, *r0
+L80: clr *r2
+m1
+bne L85
+L81: add *r1, *r4
+m3
+L82: .string "ophypxtlclzwed"
+; comment
+clr L34
+add *r4, r4
+bne L7
+mov L89, *r0
+L83: .string "yw"
+L84: .string "g"
+L85: .string "g"
+dec *r2
+not *r4
+L86: .data 470, 259, 710, -867, -327
+lea L73, *r6
+prn #13
+L87: .data -734, -62, -330, 267, -795
+rts
+L88: .string "ewmkfmjjlicpicyxubun"
+; comment
+not L84
+L89: .data 507, -962
+add r3, *r1
+jmp *r1
+stop
+inc L91
+red r4
+add r2, L93
+cmp L89, *r1
+mov L94, *r3
+not *r4
+dec r5
+bne L94
+L90: .string "rvepar"
+inc *r6
+sub L93, r5
+L91: .data 44, -674, -936, -130
+m0
+L92: .data 177
+rts
+mov #117, L34
+dec L21
+sub *r6, *r3
+L93: .data -451, 380
+L94: clr r4
+dec r2
+stop
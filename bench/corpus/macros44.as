@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 45
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    prn L56
+    stop
+    cmp r0, L96
+    dec L13
+    jsr *r6
+    bne *r2
+    cmp L22, *r2
+    dec r0
+    bne L34
+    clr *r1
+endmacr
+macr m1
+    inc *r2
+    inc L35
+    add #33, *r6
+    lea L93, r7
+    mov r7, L95
+    stop
+    cmp L1, *r0
+    prn L79
+    sub #-134, L83
+    jmp L40
+endmacr
+macr m2
+    cmp r0, r1
+    stop
+    mov r4, L64
+    sub r3, *r4
+    mov L18, r3
+    stop
+    add *r6, r3
+    add *r1, L26
+    inc *r5
+    cmp r6, *r2
+endmacr
+macr m3
+    lea L34, *r1
+    inc r4
+    not *r3
+    not r5
+    jmp L66
+    jmp L29
+    sub *r4, L64
+    sub #168, L74
+    rts
+    stop
+endmacr
+macr m4
+    dec L104
+    rts
+    jsr *r2
+    rts
+    not L30
+    sub L74, L49
+    jmp L18
+    rts
+    dec L65
+    lea L89, r7
+endmacr
+m4
+L0: lea L16, L83
+lea L0, *r2
+sub #-251, L0
+rts
+L1: .string "xfdlouhncphtoraly"
+red *r3
+red r7
+rts
+prn *r2
+inc r6
+jmp *r3
+stop
+m0
+clr r6
+stop
+m4
+L2: .string "qtpqtvmcidcvqin"
+jmp L34
+add #-147, r2
+add #48, *r1
+red *r2
+mov #186, r7
+m4
+jsr *r7
+mov L1, L22
+rts
+; comment
+L3: .string "ldadbsy"
+bne L2
+m3
+bne L0
+jmp *r1
+stop
+bne *r5
+dec L2
+
+m2
+prn L74
+lea L15, r5
+cmp #-207, r4
+sub #241, *r7
+mov *r7, r7
+m4
+mov #-215, r0
+L4: lea L4, *r6
+m2
+m0
+L5: add L4, *r4
+L6: .string "lfutkqlpido"
+m3
+m4
+m3
+jmp L2
+L7: red *r0
+jsr L0
+L8: lea L83, r5
+L9: .data 858, 390, 472, 85, 445, -412, 340, 134
+L10: add #188, L3
+not r5
+m4
+m2
+m2
+cmp L87, L2
+L11: lea L8, L102
+m2
+L12: cmp *r6, *r2
+m3
+cmp r6, *r5
+jmp L12
+m0
+L13: add r6, L36
+sub r0, r1
+jmp L10
+; comment
+inc r2
+L14: lea L11, r7
+L15: .data 385, 14, 349, -19, -181, -296, -523, 285
+m0
+sub #-45, r3
+rts
+inc L14
+rts
+jsr *r2
+red L6
+clr r7
+m0
+L16: jmp L85
+prn L12
+prn *r1
+jmp *r0
+jmp L22
+L17: .data -386
+L18: stop
+bne L13
+stop
+; comment
+
+L19: .data -882, 497
+dec *r3
+L20: .data 674, 754, -287, -889, -524
+L21: not r2
+cmp r2, #247
+m1
+not *r1
+L22: dec *r1
+red L35
+stop
+rts
+L23: stop
+sub L30, *r1
+lea L82, r0
+L24: prn L0
+m4
+jmp *r0
+clr r6
+inc *r2
+rts
+cmp #-46, L71
+m1
+jsr L11
+mov #-197, *r5
+red L78
+L25: add L102, r3
+sub r5, *r4
+not *r0
+L26: .string "qqdeljaptcwcrpuujtnan"
+mov r2, r0
+jsr L38
+jmp *r5
+jmp L42
+mov L10, r6
+m4
+L27: clr r2
+mov *r4, r6
+red *r3
+sub #253, *r1
+red L53
+dec L82
+jsr L32
+L28: not L37
+mov *r4, *r5
+dec L48
+not L14
+L29: sub r1, *r1
+m3
+lea L16, *r6
+m4
+mov r3, *r3
+jsr L19
+; comment
+clr *r0
+m3
+m3
+m2
+jsr L57
+jsr *r5
+
+rts
+dec L72
+add L78, L0
+m4
+m2
+cmp #191, L99
+prn *r1
+L30: .string "jkt"
+L31: .string "ukwscxsaksuyinsmfamupusy"
+dec *r7
+m3
+red *r2
+
+stop
+not L45
+clr r5
+m2
+L32: inc L10
+inc L4
+sub r4, L28
+L33: bne *r0
+; comment
+m2
+add #-27, L33
+m2
+; comment
+m0
+inc L51
+red *r2
+dec r7
+sub *r3, *r6
+bne *r7
+clr r7
+L34: .data -752, -438, 757, -238, 52, 474, 892, 750
+jsr *r7
+L35: .string "ofpgieijzl"
+m1
+inc r4
+m0
+rts
+m3
+L36: bne L23
+L37: dec *r0
+prn L1
+mov L62, L2
+lea L76, *r7
+rts
+add *r7, r3
+L38: .data -326, -343, -734
+L39: bne *r3
+jmp *r1
+not *r4
+jmp *r1
+cmp *r2, #11
+add L97, L31
+m1
+not *r3
+
+stop
+bne L59
+m4
+sub L24, L15
+m3
+; comment
+m3
+m0
+prn L91
+L40: rts
+stop
+red *r3
+rts
+L41: dec L93
+mov L9, L38
+clr *r4
+add #-242, *r2
+L42: .data 590
+m4
+L43: add r6, r7
+L44: not r5
+red *r3
+red L42
+sub #25, L81
+clr *r4
+m0
+sub r6, *r5
+m4
+mov #59, *r6
+cmp L23, L92
+add L17, L30
+L45: .string "fhyf"
+sub #193, L77
+inc L26
+prn r4
+inc *r4
+red r6
+dec r6
+mov *r2, *r2
+lea L31, *r7
+L46: dec r1
+m2
+m2
+lea L56, L16
+m0
+dec r4
+L47: .data 437, 750
+sub L4, L4
+sub L36, r2
+m2
+inc r5
+L48: stop
+cmp r6, *r2
+clr L91
+dec r7
+m3
+L49: sub *r7, L54
+cmp r7, *r4
+jsr L27
+L50: red r4
+rts
+cmp #-27, #-14
+lea L14, *r4
+jmp *r4
+m0
+mov #31, r1
+dec *r1
+L51: jsr *r5
+clr *r7
+jmp *r2
+bne L26
+mov #-37, *r3
+add r3, r3
+bne *r3
+; comment
+L52: clr r1
+bne L101
+mov L99, r2
+inc r6
+dec *r6
+mov #40, L28
+L53: .data 39, 69, -653, 659, 467
+L54: prn r5
+L55: cmp #95, #-65
+stop
+L56: .data 723
+; comment
+prn r6
+jsr L9
+L57: jmp L61
+m4
+inc *r6
+not L98
+m4
+L58: lea L88, r1
+add #203, *r2
+add L30, L42
+rts
+mov *r0, L21
+m3
+cmp r2, r0
+mov r3, *r2
+m0
+stop
+jmp L40
+bne L14
+m2
+L59: red r5
+L60: .data -773, -324, 903, -92, 384, 557
+m0
+m4
+L61: .data -464
+not L87
+not *r6
+L62: prn *r6
+stop
+inc L19
+mov #-15, L95
+stop
+L63: add *r1, L3
+stop
+clr L86
+m0
+not *r1
+; comment
+L64: .data 552, 294, 163, -352, 498, 316, 162
+m3
+not L99
+L65: .data -634, 9, -488, -539, 923, -148
+m2
+m4
+prn #-58
+L66: .data -846, 515, 632, 219, -684, 770, 312
+L67: .data 863, -68, 807, -788, -30, 368, -491
+inc *r7
+m4
+jmp L95
+red *r4
+m2
+prn *r6
+not L78
+add #-223, r3
+clr L18
+L68: rts
+; comment
+cmp L95, L15
+red r5
+L69: .data -981, 368, -990, -798
+stop
+
+L70: dec *r5
+m4
+inc *r5
+L71: jsr L48
+L72: .data 221, -536, 839, -965, -928, -759, 833, -806
+inc L8
+L73: sub r0, L13
+add *r7, L81
+L74: bne L72
+prn L81
+L75: .data 122, -880, 546, 910, -525, -151, 571
+L76: jsr L56
+L77: rts
+L78: .string "vopndzpn"
+inc r5
+m2
+m1
+m4
+lea L17, r5
+L79: jsr *r2
+
+red r6
+inc *r2
+stop
+m2
+L80: inc r3
+mov *r2, L4
+prn #-33
+lea L100, *r6
+L81: jsr *r7
+L82: mov r5, *r7
+L83: .data -361, -647, -495, -670, -1, -531
+not *r2
+lea L39, L50
+jsr *r1
+L84: inc *r3
+L85: prn r6
+mov #12, L5
+m0
+m3
+m1
+rts
+L86: .string "qkxvzz"
+L87: .string "sfrglk"
+stop
+
+jsr *r1
+L88: .string "gedbnmcnb"
+lea L102, L98
+dec L101
+m4
+dec r2
+L89: .string "aybqnqfm"
+inc *r6
+not r5
+m1
+m4
+L90: prn #-25
+rts
+rts
+jsr *r5
+stop
+m2
+L91: .string "xneusnplebxzztmewveumwb"
+prn r4
+m2
+lea L105, r0
+L92: .data -957, -274, -530, -793, -66, -573, 4, 849
+L93: red L74
+clr L75
+sub L103, r0
+m0
+m1
+m1
+inc L100
+inc r6
+clr *r2
+mov *r0, *r7
+m0
+red *r5
+m0
+red *r4
+L94: stop
+m4
+jmp *r3
+L95: add *r6, *r1
+clr *r0
+L96: inc *r5
+add *r4, L58
+clr r6
+bne *r7
+clr r6
+m2
+; comment
+prn L65
+lea L96, r0
+m3
+clr *r0
+L97: lea L99, L34
+mov r1, L42
+red *r4
+
+m1
+mov L100, r1
+L98: .string "wtzw"
+L99: mov *r1, r7
+cmp L100, r6
+add L11, *r3
+jsr *r6
+; comment
+not r1
+L100: .data 612, -958, 525, -398, 619, -688, 828, 929
+m3
+lea L53, L105
+not *r4
+prn L105
+not r6
+L101: bne *r2
+add *r0, *r1
+prn r3
+m0
+m3
+m2
+lea L102, *r3
+jsr L103
+rts
+L102: .data 563, -620, 704, -318, -518
+mov *r7, r0
+red L105
+bne *r4
+L103: .data -757, 728, -507, -900, -221, 261, -518, 979
+L104: sub r2, *r3
+not *r7
+L105: jmp L2
+stop
@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 46
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    bne *r5
+    clr r5
+    mov r7, *r1
+    cmp L88, *r7
+    rts
+    stop
+    mov #-228, *r3
+    stop
+    rts
+    bne *r3
+endmacr
+macr m1
+    prn #-44
+    stop
+    lea L88, L118
+    cmp r5, r6
+    not r0
+    inc L91
+    red L115
+    not *r7
+    jsr *r7
+    prn *r1
+endmacr
+macr m2
+    add *r6, r6
+    lea L17, r1
+    stop
+    jmp L39
+    clr *r5
+    bne *r3
+    stop
+    cmp L27, *r5
+    red *r5
+    inc r0
+endmacr
+macr m3
+    stop
+    dec L97
+    dec *r4
+    add L116, *r3
+    cmp *r7, r0
+    add #210, L21
+    bne *r5
+    bne *r0
+    bne *r6
+    clr *r7
+endmacr
+macr m4
+    clr r0
+    inc r4
+    lea L88, r6
+    sub r5, L112
+    not L33
+    red *r5
+    red L106
+    bne L60
+    stop
+    rts
+endmacr
+mov #-79, r0
+lea L104, *r0
+mov #-224, L12
+sub *r3, r2
+add L0, r1
+L0: mov *r7, *r4
+dec r3
+mov L0, L32
+L1: .data -550, 935, 917, 568, -830, -561
+lea L1, L1
+lea L1, L0
+cmp L103, *r3
+prn #89
+lea L1, r2
+m4
+cmp r4, r2
+m0
+L2: red L101
+; comment
+m1
+L3: .string "bogijqx"
+jsr L71
+L4: .data -658, -977, 72, -292
+m0
+cmp *r6, #11
+jmp L0
+m4
+L5: add #90, L96
+dec L3
+
+sub r7, r0
+L6: jmp L6
+L7: add *r3, L4
+cmp #124, L14
+m4
+m3
+L8: inc *r1
+rts
+mov #-10, L6
+m0
+cmp #214, #-253
+L9: .string "oksawm"
+m3
+jsr *r6
+clr *r0
+L10: red r3
+dec L102
+jmp L30
+L11: .data 386, -280, 145, -983, 73, -520, 428, 696
+L12: stop
+add *r5, r0
+clr *r2
+prn r7
+prn #162
+dec *r0
+jsr L93
+jmp *r1
+rts
+dec r3
+not *r0
+stop
+L13: cmp L38, r5
+dec L8
+cmp r6, L20
+rts
+stop
+
+jmp L114
+clr *r4
+cmp *r3, *r1
+m4
+m1
+dec *r7
+mov r1, L9
+L14: not L10
+red L4
+L15: inc L51
+red L13
+cmp L35, *r1
+L16: bne L119
+bne L9
+L17: .string "etpcqehdbip"
+dec *r1
+dec *r0
+m3
+bne L5
+dec L39
+L18: .string "imbzcfkkzkjmeiac"
+L19: not L10
+L20: sub *r3, L72
+L21: prn r7
+m2
+L22: cmp L19, L69
+sub *r3, L7
+stop
+L23: .data -95, 874, -34, -265
+prn L96
+
+L24: .data 569, 675, -56, 473, 218
+L25: .data -600, -429, -583, -632
+m3
+m0
+m0
+L26: clr *r7
+lea L11, r7
+; comment
+dec *r2
+L27: jmp L56
+not *r4
+lea L54, L108
+m4
+jsr *r4
+dec L121
+L28: sub *r5, r3
+L29: dec r3
+L30: .data -554, -201, -194, -334, 41, -764, 752
+m3
+mov L47, r6
+m4
+m1
+cmp #126, *r2
+dec r3
+jmp L101
+sub *r0, L27
+L31: clr L14
+L32: .data 286, -378
+sub r5, L121
+m0
+
+m1
+lea L0, L95
+rts
+jmp *r2
+bne L27
+L33: rts
+sub *r0, r1
+rts
+stop
+jsr L17
+jmp L62
+L34: .string "e"
+L35: .string "ydiavhzubeguvqdazvrhpcrv"
+L36: red L45
+rts
+prn #-247
+dec L4
+m1
+m2
+L37: lea L17, *r7
+stop
+L38: inc L17
+m0
+L39: bne *r0
+m2
+lea L14, L66
+m2
+rts
+bne L52
+jsr *r1
+bne *r7
+m4
+L40: rts
+L41: .data 192, -646, 973
+bne L72
+L42: prn #159
+red *r2
+lea L13, L53
+red L81
+L43: jsr *r1
+dec *r2
+prn L110
+stop
+L44: .string "ojalpclgthmpnuzobhqxrwnd"
+sub L12, r0
+m0
+jsr L10
+; comment
+; comment
+inc L26
+L45: .string "zhfdlnybvtrpvnmqtyv"
+prn r2
+
+mov #65, *r6
+stop
+not r6
+mov L30, L1
+
+m1
+mov L58, r3
+prn *r0
+L46: not r7
+
+sub #-118, *r1
+m1
+m3
+clr r1
+jsr L59
+mov *r5, r3
+L47: clr L60
+clr *r2
+L48: lea L90, L19
+
+L49: jsr *r3
+L50: .string "ynbksupyhapepm"
+mov r6, L12
+red *r0
+mov *r6, r3
+m3
+L51: not r7
+lea L113, r1
+L52: lea L43, r5
+m0
+mov *r7, L18
+lea L60, L73
+lea L102, r0
+L53: rts
+L54: .data -867, -600, 845, -780, -482, -41, 372, -24
+mov L31, L102
+red L18
+m3
+stop
+L55: .data -118, 761, 301, -419, 331, 597
+inc r2
+m3
+sub *r6, L17
+prn *r5
+L56: cmp #254, *r6
+prn L51
+cmp *r7, #-146
+L57: inc *r1
+
+L58: .string "qmoyf"
+m3
+L59: lea L2, r4
+mov r3, r7
+L60: .data -342, 668, 319, -767, 752, -574, 441
+inc *r0
+sub #-94, r4
+bne *r2
+prn #213
+jmp *r3
+jmp *r4
+L61: dec L50
+dec L121
+rts
+cmp r0, r0
+prn *r7
+add #216, L95
+clr r2
+m3
+red L26
+red *r3
+lea L64, r4
+
+
+
+L62: mov #-220, r3
+mov r3, *r6
+not L73
+clr L28
+inc r5
+add *r6, *r2
+L63: dec *r3
+L64: lea L17, r6
+L65: .data -162, 554, -207, 194, -497, 950
+stop
+not *r5
+L66: lea L77, L85
+L67: .string "fwqdcfwuyynbq"
+sub L71, *r0
+L68: add #-20, L76
+add r3, *r7
+L69: mov L73, L9
+L70: jsr L5
+clr *r5
+m3
+not L65
+L71: jsr *r7
+m2
+m4
+not *r1
+lea L59, L74
+inc *r6
+jmp *r0
+m1
+mov r6, r4
+cmp r1, *r7
+m3
+lea L120, *r0
+; comment
+add #217, *r6
+L72: .string "aumhayhhkciypsam"
+add L102, r0
+jsr L50
+L73: mov *r7, r2
+m4
+m1
+clr r5
+L74: sub #-29, L89
+m3
+m3
+L75: rts
+jsr L86
+L76: dec *r2
+jmp *r4
+cmp *r0, #-205
+red L106
+L77: rts
+not r7
+mov *r0, r2
+rts
+; comment
+m4
+clr L98
+L78: prn *r4
+jmp L112
+m1
+prn r7
+
+m1
+sub L2, r4
+m4
+L79: sub L114, *r3
+L80: lea L2, r2
+rts
+
+mov #215, *r5
+not L106
+
+stop
+bne L100
+L81: .data -714, 38, 546
+stop
+m0
+sub L82, *r7
+L82: .string "lvgixxmokrttmjmxnoppu"
+bne *r6
+m0
+m3
+prn L109
+m1
+cmp L82, *r7
+inc r2
+bne L84
+jsr *r1
+L83: .data 161, -422, -380, -43, 359, 834, -414, -353
+m1
+m2
+cmp #79, r7
+clr *r4
+L84: .string "czlocwcwlmjfm"
+L85: dec *r2
+rts
+m3
+m1
+L86: .data 703, -140, 543, -565, -318
+not *r0
+m2
+m2
+m4
+rts
+sub #62, r7
+L87: stop
+m3
+prn r3
+jmp *r1
+dec r5
+m0
+m2
+not L18
+m3
+red r5
+L88: .data -398, -413, 927, 676, 766, 180
+mov r4, r3
+rts
+mov L107, L100
+L89: rts
+; comment
+; comment
+L90: dec L6
+m3
+m3
+jmp L107
+m2
+m4
+L91: .string "mfnybinf"
+
+stop
+mov *r4, L96
+add L33, L114
+inc r3
+L92: sub r7, *r4
+L93: .string "njusjutoklmlihzykw"
+inc r2
+; comment
+L94: sub r6, r2
+prn L110
+m3
+dec L112
+jsr L93
+jmp L95
+m3
+L95: .data -373
+L96: .data -299, 850, 778, -821, 761
+inc r2
+sub L109, L102
+add #-166, L36
+L97: .data -13, 181, -161, 171, -788, -947
+clr *r3
+sub L101, L22
+L98: inc *r4
+stop
+stop
+sub L117, L53
+lea L100, *r1
+L99: .string "pitflomfozkjd"
+rts
+rts
+
+m2
+bne *r0
+L100: .string "elbmarppriu"
+jmp L119
+lea L32, L12
+L101: .string "mjjtwncpnhcerxcxp"
+cmp L103, L61
+m0
+L102: inc L116
+sub #18, L38
+L103: clr L118
+clr *r2
+inc r0
+L104: stop
+prn #207
+bne L112
+m4
+L105: lea L108, *r1
+cmp L35, L68
+m1
+add r6, L118
+; comment
+L106: .string "zbkpcqymhhtuv"
+L107: mov #119, *r7
+rts
+red *r1
+jmp *r5
+m1
+stop
+L108: sub #-167, r4
+L109: add r3, *r1
+m0
+dec *r0
+L110: rts
+rts
+m1
+m1
+rts
+L111: .string "pdnikrccsxhxkurbb"
+jmp *r4
+rts
+L112: jmp *r0
+L113: .string "pdjeqzpnkfcxkggar"
+rts
+m1
+m2
+
+L114: jsr L116
+stop
+stop
+lea L115, r3
+stop
+L115: add L6, L11
+cmp r7, r3
+jsr L121
+jmp *r6
+jmp *r2
+jmp L118
+L116: red r2
+mov r5, L22
+L117: mov #41, L120
+bne *r5
+m2
+add #-94, L61
+jsr L3
+clr L121
+jmp L50
+m3
+L118: mov r7, *r7
+mov *r0, r1
+L119: .data -287
+dec *r6
+cmp r5, #-234
+m2
+L120: .data -159, 836, 628, -587, -152, -808
+m1
+jsr L121
+m3
+dec r7
+rts
+L121: lea L37, L36
+stop
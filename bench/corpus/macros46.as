@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 47
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    sub *r5, *r7
+    add r5, *r6
+    mov *r0, r2
+    stop
+    sub #255, *r3
+    inc r2
+    prn #-92
+    inc L51
+    red r3
+    sub #38, L51
+endmacr
+macr m1
+    not r4
+    jmp L12
+    jmp L17
+    prn #-253
+    rts
+    rts
+    stop
+    rts
+    mov r6, *r3
+    jsr *r5
+endmacr
+macr m2
+    mov #167, r3
+    dec L47
+    mov *r7, r4
+    dec r1
+    add L98, *r4
+    not L87
+    lea L102, r7
+    clr L78
+    inc r2
+    not L18
+endmacr
+macr m3
+    not r5
+    rts
+    not *r2
+    cmp #161, *r3
+    rts
+    lea L81, L60
+    prn L53
+    prn #226
+    clr *r7
+    not *r6
+endmacr
+macr m4
+    cmp #217, L25
+    sub r4, L47
+    inc *r5
+    sub *r2, L97
+    inc L5
+    rts
+    add *r3, r4
+    sub L9, r2
+    add r5, *r4
+    prn #-23
+endmacr
+dec L24
+L0: not L13
+prn r7
+inc *r5
+bne L0
+cmp #-243, *r0
+L1: jsr *r7
+not r3
+L2: dec *r6
+not *r0
+jsr L0
+L3: red L88
+m1
+lea L81, L3
+jmp *r1
+prn *r4
+L4: clr L2
+L5: mov r2, L2
+m2
+red *r4
+dec *r5
+dec r7
+jsr L3
+dec r4
+m4
+prn L2
+L6: .string "fueyhtvc"
+L7: .data -92, 836, 3, 197
+cmp L1, #50
+clr r3
+L8: prn #-92
+not L2
+mov r6, L6
+mov *r7, *r0
+cmp r6, #66
+L9: not *r3
+L10: mov r7, r7
+rts
+L11: jsr *r0
+jsr L103
+m1
+inc r2
+bne L5
+add r5, *r0
+add L2, r1
+L12: .data -474, -152, -161
+rts
+cmp r6, #-215
+red L31
+add #204, r7
+cmp #208, #11
+m0
+L13: inc L82
+L14: mov r7, r5
+L15: bne L19
+not L3
+; comment
+not L51
+red r1
+L16: lea L56, L40
+m3
+L17: mov L6, *r3
+L18: jmp L1
+lea L10, *r0
+prn L15
+not r1
+red L77
+prn r3
+m4
+m0
+L19: .data 987, -854, 305, 609
+L20: .string "tbppyntuajjs"
+m0
+m2
+clr *r0
+dec L99
+
+sub L8, *r3
+m4
+L21: dec L8
+clr r7
+stop
+add r0, L9
+L22: .string "ixwkumlusjdo"
+jsr L3
+cmp L0, *r3
+stop
+dec *r3
+L23: jsr *r7
+cmp L14, *r4
+m2
+stop
+rts
+add L69, L20
+m3
+dec *r2
+m3
+bne L38
+L24: .string "fdgcxkkadm"
+jsr L15
+L25: .data -960
+not r0
+red *r6
+red *r7
+add r1, L20
+stop
+jmp L101
+prn L6
+lea L21, *r0
+mov L25, r3
+red *r4
+L26: .data 225, 836, -597, -784, 24, -740, 613
+m1
+mov #168, L37
+red L16
+rts
+L27: .data 158, -885, -90, 348, 25
+sub L5, *r5
+lea L15, *r7
+rts
+lea L10, L74
+rts
+L28: stop
+cmp L7, L76
+clr *r2
+m3
+stop
+L29: dec *r6
+cmp #64, L6
+m3
+sub #59, r7
+m1
+L30: red *r4
+L31: .data -131
+m0
+add L85, L7
+add *r3, r4
+m2
+not r5
+add #131, r6
+L32: stop
+cmp *r7, #-123
+cmp *r4, L76
+m4
+bne L30
+bne *r5
+inc r7
+m0
+mov *r4, r5
+mov r4, L27
+inc L46
+clr L55
+add *r1, r2
+bne *r0
+mov L9, L81
+dec r7
+lea L11, *r5
+jmp *r3
+m0
+m0
+m1
+L33: prn *r2
+cmp #180, #-67
+red r2
+cmp L17, *r6
+rts
+m4
+sub *r5, *r2
+m4
+; comment
+m1
+m4
+lea L18, *r3
+L34: .data -659, -597, 821, -59
+clr r5
+prn L9
+L35: .string "kxkiioageqvc"
+bne *r3
+; comment
+dec r5
+
+not r7
+inc *r5
+L36: .data 316, -710, 873, 904
+rts
+cmp #-32, r3
+jmp L56
+jmp *r6
+rts
+L37: red *r6
+cmp *r4, #9
+sub r3, *r5
+rts
+add L29, r7
+clr L7
+m4
+mov *r3, L2
+m0
+rts
+not r0
+jsr *r0
+clr *r7
+m3
+L38: clr *r7
+stop
+sub r1, r6
+m3
+clr L89
+m3
+L39: prn *r7
+m2
+
+clr *r3
+m2
+sub #63, *r2
+jsr *r5
+jsr L22
+red L28
+L40: .string "wlilkezqkzqtfa"
+bne L14
+mov #-163, *r7
+L41: bne L53
+L42: dec r4
+jmp L41
+inc *r4
+L43: .data -712, 468, 425, 83
+m2
+L44: .string "gaszagieylmfau"
+stop
+red L36
+sub r2, r1
+dec r7
+lea L14, r7
+L45: mov L8, L21
+m1
+red r2
+m1
+L46: .data -326
+lea L79, r2
+dec L26
+prn #-103
+inc L34
+L47: .string "qzxeicoupxjwfrojrancgy"
+m2
+sub r3, L57
+m3
+clr r1
+L48: .string "twzcuijnaulldpr"
+L49: sub *r4, L30
+prn r2
+L50: .data 7
+L51: add L53, *r6
+mov *r7, r3
+add L96, L51
+sub *r3, L55
+bne L42
+mov #-232, *r6
+stop
+L52: clr r3
+not L78
+L53: .data -105, -625, -136, -679, -401, 813, -816, -155
+m1
+; comment
+dec *r4
+m2
+bne *r7
+mov r4, r7
+red *r1
+L54: inc *r0
+dec *r5
+L55: bne *r1
+m0
+jsr *r7
+L56: .data 388, 875, 75, 260, -528, 134, -225
+m1
+L57: .data 438
+red L53
+m4
+m1
+sub r2, r5
+m0
+add *r5, L59
+not r2
+rts
+jmp L84
+mov #-60, L69
+L58: bne L47
+m4
+L59: .data 706, 638, -837, -795, -706, 91, -604
+prn *r3
+L60: prn #-20
+mov #-89, L79
+sub #-25, *r5
+m2
+clr L38
+rts
+sub *r3, L87
+mov *r3, r1
+L61: jmp *r1
+stop
+jmp *r7
+jmp *r7
+L62: .string "muuklpbhesaxqhyemoprevi"
+red L34
+L63: red *r4
+L64: clr L12
+not r5
+add #-128, L89
+m4
+jsr L90
+L65: .data 738, 323, -666, -761
+sub *r4, *r1
+prn L15
+L66: .string "hmygzvecrrrvt"
+red r6
+mov r5, *r7
+m2
+not L15
+inc r4
+m2
+m2
+red r1
+L67: .string "yzudaaczb"
+sub #103, r0
+lea L85, r3
+clr r1
+dec r2
+mov *r2, r6
+lea L90, *r1
+m0
+sub r4, r5
+rts
+inc L71
+L68: stop
+inc r6
+L69: .data 124
+add *r0, L100
+lea L100, L84
+mov r1, L28
+dec r2
+m0
+jsr *r0
+jmp L21
+sub *r3, r0
+inc *r5
+L70: jsr *r3
+L71: mov #118, *r5
+; comment
+add *r0, r2
+L72: .string "aivhdlyxhz"
+jmp L2
+prn #228
+m4
+sub r2, *r7
+clr r0
+L73: lea L11, r5
+lea L26, r6
+red r6
+m1
+jsr L38
+sub L97, L13
+prn #185
+m4
+inc *r0
+L74: .string "wpbbomvawh"
+
+lea L79, r2
+inc L24
+sub r5, L8
+L75: .string "fjlulnhkfewsgufrztoui"
+L76: .data -466
+L77: inc *r1
+rts
+inc r4
+L78: clr r3
+prn #-58
+dec r4
+add L65, *r4
+L79: dec L88
+stop
+m4
+stop
+rts
+dec L89
+L80: clr *r6
+stop
+rts
+not r2
+clr L102
+cmp #106, r1
+m0
+L81: jmp L12
+L82: sub r4, r3
+lea L89, r0
+not *r7
+red r1
+m0
+mov *r1, L93
+L83: dec r4
+stop
+L84: .data -683, 325, 936
+inc r0
+stop
+rts
+cmp L0, *r6
+L85: .string "frvyftyw"
+m0
+L86: rts
+L87: inc r3
+L88: jmp L102
+add r4, *r6
+m1
+add L36, *r3
+cmp r3, *r2
+red r2
+bne L95
+L89: .string "xhamcttvrxnhoibgk"
+m4
+red *r5
+m0
+
+sub L99, r1
+rts
+red L58
+rts
+L90: .string "uvgvphtagbiblmoqnbogfaa"
+L91: mov #-253, r3
+add *r1, r0
+L92: .data -295, -68, 860, 87, -303
+
+L93: .data 259
+dec L103
+jsr *r1
+jsr L22
+not r0
+clr r0
+prn #243
+mov r2, *r7
+L94: .string "dhinoszjljtvq"
+prn #-118
+red *r2
+stop
+add L99, r0
+lea L20, r6
+m4
+cmp *r4, L13
+mov #-45, L66
+L95: prn #-76
+clr L100
+dec L99
+rts
+add r1, *r3
+m0
+lea L44, L87
+bne L103
+
+add r6, *r2
+prn *r6
+jmp *r1
+dec L22
+
+rts
+L96: prn #107
+add L49, *r0
+inc *r1
+; comment
+jsr *r6
+dec r6
+bne L84
+L97: jsr *r3
+stop
+dec L69
+cmp r6, *r5
+
+clr r6
+stop
+L98: .string "fhagkxuojvhxsh"
+not *r3
+lea L103, L35
+L99: bne *r6
+cmp r0, L101
+mov *r5, r4
+L100: .data 415, -44, -206, -533
+L101: .data 184, 174, 777, 731
+jmp L93
+m1
+m3
+jsr *r7
+dec *r0
+red r5
+L102: sub L103, r2
+
+jmp L103
+
+dec *r3
+prn r2
+m2
+stop
+stop
+L103: cmp *r5, L62
+stop
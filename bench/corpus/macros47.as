@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 48
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    clr r1
+    rts
+    clr L58
+    clr L59
+    dec L64
+    prn r5
+    dec r2
+    clr L64
+    jsr *r0
+    dec r5
+endmacr
+macr m1
+    inc *r6
+    bne *r6
+    sub #-72, r7
+    cmp r0, L42
+    rts
+    jsr *r2
+    lea L60, r6
+    not r6
+    lea L66, L62
+    lea L84, L88
+endmacr
+macr m2
+    lea L21, L82
+    mov r6, *r7
+    not *r1
+    jmp L16
+    dec L16
+    red *r3
+    jsr *r0
+    red *r6
+    prn r1
+    add #-41, r2
+endmacr
+macr m3
+    prn r7
+    dec L92
+    clr r3
+    jmp L19
+    jsr L17
+    sub L62, *r6
+    dec r7
+    mov #-247, L17
+    rts
+    prn r7
+endmacr
+macr m4
+    prn L41
+    mov L53, *r3
+    not r1
+    mov *r2, L21
+    add r7, L67
+    jmp *r4
+    prn r5
+    mov L60, *r1
+    jmp *r0
+    lea L31, r4
+endmacr
+cmp L9, *r2
+red L37
+lea L89, *r6
+jsr *r0
+dec *r4
+L0: cmp L16, #243
+m4
+not r6
+L1: .string "ccea"
+sub #172, r6
+; comment
+bne L1
+L2: .data -595, -85, -892, 254, 592
+bne L78
+clr *r4
+L3: .string "bmshgpygcdtmjqs"
+L4: .data 656, -111, -330, -324, -945, 327, -821, 700
+L5: dec r1
+red *r4
+red *r1
+L6: not *r5
+m1
+jsr L59
+L7: jsr *r3
+jmp *r4
+; comment
+add #109, r5
+inc *r2
+sub L16, *r0
+red L38
+mov L2, L0
+sub *r7, L3
+dec L68
+dec *r2
+red L13
+L8: .data -209
+m1
+add L8, *r1
+; comment
+clr r3
+jsr L55
+cmp *r1, #-155
+add *r4, *r7
+stop
+m0
+clr r6
+L9: lea L2, r7
+L10: .string "mywklkjda"
+not *r1
+stop
+mov L54, r2
+m2
+dec r3
+m4
+; comment
+cmp #-199, r1
+cmp *r1, *r5
+add L44, *r2
+L11: clr L3
+L12: .string "skyivgfqpwecrroiskisgc"
+red *r5
+mov #59, L9
+stop
+L13: sub L31, *r5
+; comment
+m3
+add *r0, L85
+red L77
+dec *r1
+L14: .string "ts"
+cmp #-84, r4
+inc *r6
+m2
+stop
+not L1
+clr *r2
+sub *r3, *r7
+m2
+bne *r5
+m3
+prn #-209
+L15: bne *r2
+clr L12
+m3
+add *r2, *r1
+m1
+inc *r7
+m1
+stop
+mov #226, *r4
+m3
+red *r0
+rts
+m0
+clr r7
+L16: .data 100, 763, -234, -407
+dec *r7
+clr *r7
+sub #-65, r4
+m1
+L17: dec L97
+L18: .string "vcv"
+L19: rts
+m2
+m0
+L20: cmp r4, r7
+
+inc *r1
+L21: bne *r2
+not L11
+bne *r2
+m1
+red r3
+add r3, L52
+rts
+not *r5
+
+dec *r6
+red L24
+bne L97
+bne *r0
+L22: clr *r3
+jsr *r5
+rts
+red *r6
+L23: add #181, r2
+L24: .data 537, 214, 341, -168
+
+L25: .data -93, -895, -989, -202, -295, 908
+stop
+lea L18, *r2
+red r7
+m1
+red *r6
+; comment
+m2
+m3
+sub L83, r7
+L26: dec L12
+m2
+bne *r4
+sub #-182, r4
+mov r0, r7
+stop
+L27: inc *r3
+m3
+L28: .data -314
+m1
+m1
+red r4
+m3
+
+L29: .string "aygwkuvbvqkimnopk"
+m1
+jsr L89
+L30: stop
+lea L14, *r1
+inc *r7
+m2
+clr r0
+red *r2
+prn #71
+L31: .data -669, -592
+m4
+L32: clr *r7
+L33: .data -381, -901, 460
+not *r7
+jsr *r1
+m3
+sub r6, *r6
+
+m1
+prn *r5
+red L31
+lea L60, r3
+prn r3
+jsr *r3
+m1
+
+bne L68
+rts
+jsr L3
+clr r1
+jmp L96
+dec *r1
+L34: cmp L79, #37
+bne L11
+rts
+L35: clr *r7
+lea L35, *r1
+clr *r6
+jmp *r3
+stop
+L36: stop
+clr *r5
+dec r0
+clr r6
+bne *r4
+prn r6
+jsr *r3
+m0
+not r7
+m4
+stop
+
+rts
+L37: .data 731, 126
+not *r7
+stop
+cmp L97, *r1
+m0
+sub L12, L51
+dec r4
+jmp *r0
+m0
+mov r0, *r7
+jsr *r7
+m0
+stop
+stop
+L38: lea L34, *r6
+mov r5, *r1
+lea L9, *r2
+L39: cmp #71, L49
+m3
+m1
+lea L51, L21
+L40: .data 534, -806, -821, 598, 583, -242, -523
+mov L68, r5
+clr r7
+lea L76, *r3
+dec r7
+rts
+stop
+jsr *r4
+stop
+; comment
+inc *r4
+L41: add #205, *r2
+m3
+clr L23
+L42: jsr *r7
+red *r1
+L43: add *r6, L10
+L44: dec r4
+red r7
+stop
+jsr L56
+add *r4, L53
+m1
+dec *r3
+L45: .string "sjkmamkizzity"
+m1
+clr *r6
+L46: .data 282, -774, 36, 472, -157, 684, -324, -229
+clr *r3
+inc *r2
+jmp *r3
+L47: red L32
+clr r0
+red *r2
+jsr *r5
+clr *r7
+bne L23
+not *r1
+L48: inc L98
+L49: .string "wmevwapyo"
+m0
+m1
+m3
+L50: .string "zgcqgwjqhphn"
+lea L7, r7
+L51: add L41, L40
+
+mov L55, *r6
+stop
+sub *r0, L59
+m4
+; comment
+add r6, *r6
+clr *r5
+m0
+m3
+stop
+L52: .data 139, -75, 288, -803, -584
+jsr L0
+bne L23
+; comment
+not r7
+L53: jmp *r2
+sub #-63, L68
+dec r7
+not *r5
+m2
+L54: not *r0
+not L17
+jmp *r0
+L55: red *r7
+m4
+L56: .string "ljxvvgeqrpmjc"
+L57: inc r3
+L58: .string "p"
+m3
+red r5
+stop
+not r5
+jsr *r6
+jsr *r4
+L59: rts
+L60: inc r0
+L61: .string "ew"
+not r5
+L62: .data -273, 751, 451
+add *r1, *r6
+cmp *r6, *r3
+jsr *r2
+L63: rts
+stop
+sub #-68, *r3
+m1
+L64: .data 471, -30, 436, 970, -360, -226
+
+not r0
+L65: .data -858
+L66: add #-139, r5
+L67: .data -728, 391
+inc *r4
+m1
+stop
+dec L99
+mov r6, L42
+
+mov #222, r2
+mov r4, L89
+lea L37, r0
+m3
+jmp L90
+add L50, r5
+
+L68: bne L94
+
+m4
+dec L85
+stop
+m1
+sub r0, *r7
+; comment
+m3
+jmp L77
+m3
+L69: lea L71, *r3
+sub #126, L43
+bne *r2
+sub #-158, r7
+lea L51, r4
+clr L60
+m2
+; comment
+jmp *r1
+m1
+mov *r2, *r3
+L70: cmp *r3, r4
+red *r2
+m2
+; comment
+cmp #-38, r2
+jmp L1
+inc L75
+m0
+L71: .data -512
+L72: jsr L99
+m1
+m3
+L73: .string "zcvxaoveovho"
+m0
+cmp L93, *r5
+red L2
+L74: inc L97
+cmp *r2, L85
+dec r6
+; comment
+rts
+not r6
+
+L75: .string "luwjdrkyjtvvjybvz"
+m1
+; comment
+stop
+L76: .string "eomzgluuetuxaiuocsew"
+prn *r2
+m4
+L77: .data 318, -729, 865, -93, -771, 910, 799, 650
+jmp L53
+rts
+red *r5
+m4
+mov #25, L79
+mov L7, L89
+L78: .data -134, -759, 87, 92, 683, -759, 799, 532
+m4
+stop
+clr r0
+L79: cmp #172, #-76
+L80: jmp L4
+cmp #224, L88
+cmp #232, *r5
+L81: .data 705, 64, -410, -937, 413, -98, -916, 64
+mov L90, r0
+dec L12
+L82: mov r3, *r4
+L83: bne *r1
+add #-69, *r0
+bne *r6
+dec L86
+m1
+inc *r7
+jsr L93
+red r7
+
+L84: clr r6
+add L94, L96
+mov *r7, r2
+stop
+add L34, *r3
+m1
+red r0
+inc *r3
+m2
+prn r2
+; comment
+sub #244, *r0
+L85: dec r5
+mov L77, L92
+cmp r7, *r2
+mov *r7, L9
+lea L91, r2
+prn #201
+m4
+L86: lea L51, L100
+prn r4
+L87: bne L89
+clr *r5
+L88: .string "laxytbgvusxkkagndlttcra"
+mov #-117, *r1
+; comment
+sub r7, r1
+sub L96, L75
+jsr L25
+L89: .string "robaukevlalq"
+m0
+bne *r1
+dec L97
+rts
+L90: .string "yjotzxtbehruqcm"
+cmp #-42, L92
+cmp #233, L98
+inc L46
+L91: prn r0
+m1
+clr r6
+L92: not *r7
+L93: jmp L97
+m2
+mov *r4, L16
+rts
+cmp r2, *r3
+m0
+cmp r7, #160
+m3
+; comment
+jmp *r0
+clr *r7
+m3
+stop
+add #-142, r7
+m2
+L94: jsr *r6
+not L81
+sub #21, r7
+m3
+m1
+m2
+mov #-68, r5
+rts
+sub L41, *r2
+mov r2, L23
+inc L96
+L95: .string "yopduquwugiunturie"
+m3
+m3
+L96: not r3
+L97: .data 528, -321, -692, -915, 23, 371, -122
+L98: bne *r7
+not L100
+clr r3
+rts
+L99: mov L100, r2
+lea L49, *r3
+lea L100, *r0
+L100: mov r7, r5
+stop
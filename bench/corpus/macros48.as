@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 49
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    sub L80, L86
+    bne L63
+    clr L42
+    not r4
+    bne *r7
+    bne *r6
+    cmp #-129, L101
+    lea L84, r6
+    stop
+    jmp *r0
+endmacr
+macr m1
+    sub L65, *r7
+    dec r0
+    jmp L6
+    clr r5
+    clr *r5
+    inc *r1
+    stop
+    prn r1
+    inc *r1
+    sub #119, L47
+endmacr
+macr m2
+    dec L97
+    add r2, L93
+    dec L63
+    mov #-8, r3
+    sub *r4, *r0
+    not *r1
+    dec r5
+    cmp L86, *r7
+    prn #142
+    rts
+endmacr
+macr m3
+    add *r5, *r1
+    cmp L38, *r7
+    dec L12
+    rts
+    dec r4
+    lea L36, L64
+    prn r5
+    cmp #133, r0
+    not L11
+    mov L61, r3
+endmacr
+macr m4
+    dec L59
+    red *r0
+    rts
+    add #-235, L93
+    inc L23
+    dec L98
+    jmp *r1
+    cmp *r2, r5
+    prn #229
+    lea L36, *r6
+endmacr
+m2
+stop
+jmp L75
+red r1
+sub #-252, L26
+L0: .string "qjzeghev"
+m4
+prn r4
+add #7, L15
+jmp L48
+bne L0
+red r2
+m0
+
+L1: jsr L93
+; comment
+L2: cmp #-21, #-157
+not L0
+m1
+sub L0, L52
+mov #225, *r3
+mov #-60, *r2
+bne L2
+m4
+; comment
+m0
+bne L0
+m2
+L3: .data -854, -934
+L4: mov L3, *r4
+jsr *r0
+L5: dec L3
+m4
+m3
+clr r3
+mov r1, r1
+inc *r0
+cmp *r1, *r7
+cmp *r3, L73
+stop
+m4
+m3
+cmp *r1, L44
+not r4
+jsr L43
+jmp L5
+jsr L5
+m4
+clr L2
+dec r1
+m1
+
+; comment
+bne L4
+L6: rts
+dec *r0
+m1
+bne *r3
+m1
+m2
+mov L1, L2
+lea L5, L6
+stop
+m3
+lea L93, r7
+m2
+lea L5, L15
+not L4
+lea L72, r0
+L7: rts
+lea L5, *r2
+L8: .string "dcrcknevqtypqzmlypj"
+L9: clr r7
+L10: clr *r4
+L11: not *r2
+L12: .data 502, 354, 442
+inc L7
+lea L8, *r4
+L13: cmp #198, #149
+; comment
+prn r3
+lea L4, L10
+lea L20, *r7
+rts
+jsr *r6
+m4
+clr *r4
+L14: sub L6, r0
+L15: jmp *r4
+add #130, r7
+m3
+rts
+m0
+clr *r3
+mov r7, L14
+red r7
+jmp *r3
+; comment
+; comment
+m0
+mov r0, r1
+jsr *r6
+inc *r7
+m1
+prn #-168
+cmp r2, #144
+L16: rts
+rts
+stop
+cmp r2, *r1
+L17: clr *r4
+L18: .string "tyipqfvjsnudhalcgf"
+prn r6
+add #-107, L44
+L19: .string "aefscmcgiwa"
+cmp *r6, r1
+bne *r3
+prn *r1
+sub *r1, L39
+not r7
+red *r0
+jsr *r7
+L20: stop
+stop
+m1
+m3
+L21: jmp *r4
+L22: .string "luekhvxqmkmpnhgwn"
+cmp r7, #120
+cmp #233, #253
+L23: .string "kbgtyfpiazogp"
+clr *r6
+stop
+L24: sub L91, L11
+rts
+L25: not r1
+L26: jsr L14
+add L12, *r4
+jmp L68
+L27: .data -305, -649, 451, -771, -78, 928, 824, -671
+L28: .string "hubjpesusrujoivdlariwq"
+m4
+L29: inc L10
+m4
+clr L66
+m3
+m0
+clr *r2
+rts
+L30: cmp #-135, #-230
+jsr L88
+sub *r6, r3
+m0
+L31: .data 396, -144, -331, 725, 807
+stop
+jsr L64
+mov r6, L20
+
+prn *r3
+clr L27
+L32: .data -983, 107, 319, -479
+mov #10, r7
+; comment
+m0
+cmp *r2, r2
+m4
+prn #-106
+L33: .string "oenuubwcvmlyu"
+jsr *r2
+stop
+rts
+stop
+; comment
+stop
+L34: lea L56, r3
+dec r5
+L35: cmp *r0, #11
+add L70, L11
+dec r4
+m0
+sub *r0, r3
+
+inc r0
+stop
+L36: sub r2, *r6
+m0
+jmp *r3
+lea L88, L11
+; comment
+red L37
+not L23
+m2
+L37: .string "ewqpmvlvrxafysiwpap"
+sub *r5, L19
+m1
+L38: red r1
+add *r1, *r4
+bne L33
+bne *r0
+dec r6
+m2
+dec r5
+clr r0
+stop
+
+m4
+dec *r5
+jmp L95
+m3
+L39: mov *r3, r0
+L40: clr *r1
+L41: rts
+m3
+jmp *r3
+dec r7
+m3
+m1
+sub L28, r5
+add #216, *r6
+L42: red L37
+sub *r2, L87
+m3
+dec L25
+m1
+L43: red r2
+sub L59, r5
+lea L84, *r6
+m4
+sub #-149, *r4
+red L79
+L44: bne L72
+L45: dec L10
+m1
+sub *r2, *r5
+red L1
+jmp L53
+jsr L3
+prn *r7
+rts
+clr *r7
+L46: .string "ncr"
+m3
+m1
+red *r6
+not *r1
+not r6
+m0
+L47: jmp L43
+m2
+; comment
+lea L10, L43
+not r3
+m1
+cmp r5, L58
+red *r5
+cmp #184, L99
+m4
+mov *r5, L5
+bne L89
+prn *r5
+cmp L59, L95
+stop
+m3
+L48: cmp *r7, #18
+L49: .data 887, 933, -345, -374, 683, 170
+clr L20
+not r3
+m4
+L50: lea L15, L28
+rts
+dec L21
+inc *r7
+not *r5
+L51: cmp *r5, r4
+L52: .data 642, -173, 380, -645, -415, 322, 999, 471
+m3
+L53: .data -385, 534, 713, -124, 655, -667, -228, -716
+sub L37, *r2
+mov r4, *r7
+rts
+m1
+inc *r6
+sub *r4, L36
+sub L6, *r4
+m2
+m4
+rts
+L54: mov r5, r3
+mov L36, L48
+inc r4
+lea L98, r2
+L55: .string "e"
+m4
+rts
+stop
+m0
+m2
+L56: .string "skfvgbnnztgbnevizr"
+red r6
+lea L57, *r4
+; comment
+L57: .string "hbf"
+clr *r2
+red L16
+mov *r5, L39
+not r2
+clr r7
+red r6
+lea L28, *r5
+bne L10
+jsr L8
+L58: jsr *r2
+clr L29
+; comment
+L59: bne *r0
+; comment
+L60: stop
+L61: .data -167, -454, 307, 778, 653, 489
+m0
+m3
+m1
+red r6
+clr *r3
+L62: inc L94
+L63: bne L19
+m1
+clr L67
+prn #-156
+
+L64: .data -667, 487, 872, -704
+dec L74
+mov r3, L56
+cmp r1, #-85
+prn r3
+L65: inc r6
+L66: cmp *r0, *r4
+m0
+inc r3
+jmp L28
+L67: .string "sokstbbzheakzn"
+rts
+inc r7
+L68: .data 636, 719, -619, 470, -984
+mov r3, r7
+inc L83
+; comment
+red L97
+bne *r1
+lea L86, L42
+not *r3
+L69: inc L71
+m0
+stop
+sub *r2, *r2
+L70: red r7
+
+L71: .string "zwjapluy"
+red L38
+jmp *r1
+add r0, L72
+cmp *r0, L100
+sub L82, *r1
+L72: .data 138, 572, 275, -997, 471, -332, 419, -720
+dec r1
+L73: bne L68
+lea L5, L99
+jsr L29
+mov *r5, r2
+L74: sub #-174, r7
+red *r3
+clr *r1
+m2
+stop
+cmp L72, *r5
+m0
+red r5
+dec r6
+add *r4, *r4
+m3
+mov *r6, r1
+m3
+sub #-30, r1
+stop
+add #-27, *r4
+lea L5, *r1
+L75: .data 358, -189, -127, 891, 566, 697, -378
+not L85
+L76: .string "dkxpvugygewcuzpq"
+
+inc *r3
+m4
+
+L77: .data 953, -330, -412, 644, -700, -739, 710
+lea L34, *r0
+sub r5, *r2
+dec r5
+mov L91, r7
+m0
+L78: add #-67, L62
+sub #-118, r4
+rts
+m2
+not *r1
+m4
+dec L84
+L79: mov *r4, *r2
+L80: stop
+lea L84, r3
+sub #156, *r1
+jsr *r4
+L81: .string "prwwktlrlgk"
+red r6
+L82: inc L8
+rts
+jmp *r0
+lea L88, L35
+jsr *r6
+m3
+m2
+L83: .string "kufdmyfpxfbtmdbclcjk"
+bne *r4
+add #243, *r3
+L84: .string "eotxzozmjzvwcyonmhptn"
+m0
+sub *r5, r0
+clr L101
+jsr L98
+bne L75
+L85: .string "tcsoersbfcvxhxjhqol"
+lea L13, L92
+red L24
+L86: jmp *r4
+L87: jmp L41
+
+jmp L101
+cmp r1, L62
+stop
+stop
+m3
+m2
+L88: lea L92, *r1
+L89: .data -27, 419, 74, 18, 295, -94
+jsr L62
+red L95
+L90: cmp r5, #-234
+m4
+clr *r1
+jmp *r3
+dec L99
+prn L38
+
+L91: cmp L96, *r4
+sub L101, *r2
+red r3
+lea L85, L92
+sub L19, L91
+inc *r2
+m2
+L92: .data -244, 808, -412, -242, 911, -127, -155
+bne L67
+m0
+; comment
+; comment
+
+clr r6
+prn L81
+jsr L93
+cmp L94, #59
+m4
+not *r7
+mov r0, L94
+L93: .string "pbpnseriddp"
+not *r3
+L94: .string "gfq"
+not r1
+rts
+stop
+L95: inc L0
+add *r2, r2
+prn *r5
+prn r3
+jsr *r0
+m4
+lea L89, r3
+dec L99
+m3
+mov L34, r7
+m0
+L96: prn *r6
+add r1, r6
+prn *r5
+L97: lea L99, L98
+m3
+L98: .string "ystr"
+L99: .data 80, -496, -146, -501
+dec r5
+stop
+sub #248, *r4
+L100: stop
+L101: mov #-16, r1
+stop
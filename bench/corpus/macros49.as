@@ -0,0 +1,571 @@
+; Generated by genCorpus --seed 50
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+macr m0
+    jsr *r5
+    bne *r1
+    stop
+    not r2
+    lea L1, *r7
+    stop
+    not L35
+    lea L112, r0
+    rts
+    jsr L66
+endmacr
+macr m1
+    jsr *r4
+    dec L73
+    lea L85, r6
+    dec L5
+    stop
+    jsr L110
+    sub r0, L98
+    cmp *r1, L119
+    mov *r7, L1
+    sub r1, r2
+endmacr
+macr m2
+    bne L31
+    bne L68
+    dec *r4
+    jsr L83
+    jsr *r3
+    inc L61
+    stop
+    dec L41
+    bne L108
+    dec L127
+endmacr
+macr m3
+    not *r2
+    mov L58, r0
+    not r4
+    cmp r4, L86
+    dec r0
+    jmp *r7
+    dec r1
+    prn L7
+    inc r7
+    prn L62
+endmacr
+macr m4
+    jmp L4
+    prn r0
+    cmp r2, r5
+    prn *r5
+    cmp r5, #205
+    red r2
+    not L89
+    jsr L60
+    jsr L22
+    prn #-55
+endmacr
+inc *r2
+m3
+rts
+L0: .data 734, 163, 680, 427
+m3
+m1
+add *r3, L0
+mov *r0, L90
+L1: dec *r7
+jsr *r5
+jsr *r7
+L2: .string "qbtarkwbgqdtl"
+inc r0
+rts
+m3
+lea L1, L0
+m0
+rts
+L3: .string "jkdviu"
+L4: dec L16
+red L1
+m4
+L5: clr r6
+not *r2
+L6: clr r2
+m0
+cmp *r0, #119
+L7: dec L6
+L8: .string "jgrsjmrfcrannmgjwrp"
+dec r6
+L9: .data 496, 777
+sub #-103, L3
+stop
+red L9
+L10: mov L4, L10
+inc r5
+L11: add r0, r4
+L12: .string "byzypewbcohtf"
+prn #29
+L13: bne *r0
+m3
+L14: .data 204, 974, -3, -247, -853, 232, 754
+m1
+rts
+red L6
+not *r6
+L15: lea L92, r1
+red *r7
+L16: .data -688, 868, -410, -113, 944, -8, 16, -293
+m3
+bne L0
+prn #196
+rts
+clr L60
+prn *r7
+add #-49, L76
+L17: .string "xrdiaogfcttvhvjhokaogdld"
+m3
+L18: lea L2, L13
+sub #197, L123
+dec *r4
+L19: .string "xgglu"
+mov #43, *r0
+L20: clr r3
+stop
+dec r7
+stop
+; comment
+cmp L5, L95
+mov r0, r1
+rts
+m1
+L21: .data -829, 660, -54, 377, 983
+clr *r7
+rts
+dec r6
+L22: rts
+L23: inc r4
+jmp *r5
+cmp r4, *r7
+rts
+not r0
+prn r4
+mov r0, r1
+add *r0, L78
+dec r4
+; comment
+stop
+m2
+stop
+rts
+m2
+stop
+lea L5, L12
+prn *r0
+red *r2
+jmp L8
+L24: jmp L50
+m2
+L25: inc r0
+mov #-143, r3
+m4
+; comment
+L26: .string "hnbircmaqzhulfpchzfk"
+lea L5, r3
+add r0, r2
+L27: prn #169
+prn #-123
+L28: red r6
+red r2
+jsr L25
+red L18
+lea L14, *r6
+L29: jsr L75
+jmp *r5
+bne L14
+L30: red L107
+jmp *r7
+L31: rts
+m4
+jmp *r1
+m3
+m4
+m0
+lea L78, *r6
+inc *r7
+inc *r4
+stop
+prn r2
+lea L30, r2
+L32: .string "luje"
+L33: red r0
+mov L132, r7
+jsr L27
+L34: mov *r0, *r3
+jsr *r5
+m2
+bne *r0
+dec L20
+not *r5
+
+cmp #-7, r3
+mov *r0, *r1
+red L96
+L35: .data 408, -64, -896, 439
+L36: jmp *r0
+stop
+rts
+L37: .string "hewzdadhfzcqy"
+
+L38: .string "yxn"
+not L28
+L39: .string "xxsozwyuzrrsl"
+L40: .string "feaxtymfksvcgykaghwxurb"
+m4
+m0
+jmp *r7
+not L19
+L41: .data -771, 500, -784, 304
+L42: not L38
+L43: cmp L14, *r0
+; comment
+m4
+lea L120, r7
+L44: lea L44, L25
+L45: .string "cxfttzyzwztbjfmghl"
+cmp #-46, r7
+rts
+dec L91
+; comment
+m2
+L46: not *r0
+red L44
+L47: mov #67, r1
+lea L30, r0
+L48: lea L12, L27
+L49: not *r6
+prn L24
+sub L0, r1
+m1
+L50: .string "g"
+dec L91
+not r3
+add #-203, L55
+L51: red L19
+m0
+sub #251, L31
+m3
+lea L132, L14
+L52: prn r3
+m1
+L53: .data -298, 57, -143, -383, 615
+stop
+jsr *r2
+L54: clr L62
+L55: .string "k"
+L56: .data -366, -183, -485, 972, 606, 98, 489
+
+; comment
+prn *r5
+cmp *r2, *r5
+m0
+add *r0, r1
+L57: .data 181, -211, 364, 422, -133, -455, -754
+cmp *r6, *r1
+L58: lea L132, *r4
+L59: jmp L73
+L60: jsr *r5
+prn L42
+m2
+L61: mov *r7, *r3
+m1
+L62: add #149, r5
+prn L5
+prn #98
+L63: clr r5
+bne *r7
+m1
+prn *r1
+sub L129, L53
+L64: jmp L43
+dec L21
+m2
+stop
+not *r1
+m4
+sub *r2, *r0
+L65: .data 779, -445, 173, 659, -743, 782
+L66: stop
+L67: not L132
+cmp L48, #62
+L68: .string "nuylcucdebkscuijijw"
+m3
+m1
+; comment
+L69: red L64
+m4
+m1
+not *r6
+L70: add r0, r2
+dec L127
+m3
+bne *r4
+jsr *r7
+m2
+L71: .data -593, -941, -950, -54, 716, 607
+m2
+inc L117
+L72: cmp r5, L73
+L73: not L127
+inc L77
+m1
+
+L74: stop
+stop
+bne *r2
+add #-48, *r2
+rts
+L75: clr L21
+
+not *r6
+rts
+L76: add r7, r2
+L77: .data 244
+rts
+jmp *r6
+stop
+add #95, r3
+clr r4
+m3
+L78: lea L85, r5
+jmp L31
+m4
+red L81
+L79: red r1
+not r0
+bne *r6
+m1
+L80: jsr L96
+L81: inc *r1
+lea L46, r3
+jsr L93
+L82: cmp #-2, #246
+m0
+m0
+sub #13, *r0
+inc L120
+m4
+rts
+m0
+cmp #234, L41
+lea L54, r7
+mov L60, r0
+add L65, *r6
+lea L54, L88
+m2
+L83: clr *r2
+inc L75
+L84: .data 532, -430, 59, 314, 953
+add *r6, L116
+bne *r7
+red *r2
+L85: .data -669, 180, 842, 886, 245
+m1
+m3
+sub L122, L92
+mov r0, *r3
+L86: .string "dmlwamwy"
+L87: dec r2
+inc r4
+m2
+L88: dec r3
+jmp L6
+L89: .string "bztribkkgim"
+L90: red *r3
+L91: .string "eblnjcmx"
+lea L132, *r0
+jmp *r7
+L92: red *r2
+L93: rts
+L94: .string "nxydlhotgtjekooazp"
+sub L95, *r7
+red *r6
+; comment
+
+bne L8
+mov *r2, *r2
+m0
+m4
+sub L99, r5
+m2
+L95: lea L127, r1
+red *r5
+L96: lea L99, *r6
+; comment
+add r1, L1
+L97: .data 176
+sub #-141, r3
+rts
+m3
+jmp L22
+clr r6
+clr r3
+mov #126, L0
+m4
+inc *r3
+L98: rts
+L99: dec L124
+clr L104
+rts
+lea L45, *r0
+clr r4
+jmp *r3
+m3
+L100: .data -74
+rts
+red L118
+; comment
+rts
+L101: sub #-94, r4
+jsr L125
+L102: inc *r1
+; comment
+jmp *r6
+jmp *r1
+bne *r2
+mov *r2, *r0
+m1
+inc r4
+prn #-61
+jmp *r6
+m1
+L103: prn *r3
+L104: sub #220, r7
+jmp L44
+jsr L46
+not r0
+L105: .string "grn"
+red L89
+L106: rts
+L107: dec L89
+L108: prn L43
+L109: dec r6
+prn #5
+stop
+L110: dec r6
+red r4
+jmp *r0
+inc *r3
+prn #-68
+; comment
+m3
+m1
+m4
+sub *r1, L124
+; comment
+jsr L27
+L111: clr L41
+lea L123, L118
+L112: rts
+L113: dec *r1
+red L31
+prn r0
+L114: bne *r4
+mov *r2, r7
+m3
+rts
+L115: prn L19
+mov L36, L1
+red r2
+lea L14, L60
+prn #8
+clr *r4
+stop
+m0
+L116: .data 794, 815, 509, 340, -521
+L117: .data 684, -352, -738, -355, 384, 609, -294, 332
+sub r6, r6
+m4
+stop
+rts
+rts
+L118: .data -263, 452, -926
+rts
+m0
+L119: stop
+dec L132
+jsr *r6
+clr *r2
+stop
+clr r3
+red r5
+m2
+L120: .string "ianyctordjh"
+clr L132
+clr *r1
+mov r4, *r4
+stop
+m3
+
+m0
+L121: sub L131, L95
+red r0
+prn *r1
+jmp L18
+dec r7
+m2
+dec L55
+m1
+L122: prn #-200
+sub L56, r2
+not r3
+clr r2
+m2
+L123: .data 146, -772, -170, -429, 848
+red L89
+cmp #118, #-174
+mov #-228, r5
+m2
+m2
+m1
+add *r0, L130
+L124: prn #230
+L125: mov *r4, *r2
+m4
+; comment
+m0
+L126: jsr L129
+L127: add #-73, *r2
+L128: sub #-36, L1
+prn #-78
+inc r6
+bne L94
+rts
+not *r6
+stop
+m2
+m2
+L129: lea L95, *r4
+inc *r4
+m3
+m2
+jsr *r6
+jmp *r1
+dec r7
+inc *r3
+sub *r1, L131
+jsr L132
+L130: rts
+L131: bne L23
+L132: .data -557, 205, -120
+jmp *r0
+sub r0, r1
+clr L43
+clr *r7
+dec *r7
+dec r6
+; comment
+rts
+cmp *r5, #-79
+stop
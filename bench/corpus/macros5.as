@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 6
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    sub *r0, *r0
+    clr L12
+    cmp L96, *r1
+    inc r0
+    dec L103
+    sub *r5, r5
+    dec r6
+    not r5
+    jsr *r4
+    jmp *r1
+endmacr
+macr m1
+    bne *r6
+    jmp L78
+    red *r7
+    jmp L65
+    inc *r4
+    jmp L117
+    jmp L48
+    mov L41, r1
+    sub r7, *r6
+    jmp L102
+endmacr
+macr m2
+    sub #-50, L3
+    jmp L36
+    red r3
+    dec *r5
+    clr *r2
+    prn r1
+    rts
+    jmp L26
+    cmp r4, #-158
+    rts
+endmacr
+macr m3
+    jmp L46
+    lea L74, r2
+    add *r5, L109
+    lea L3, *r3
+    dec *r6
+    clr r4
+    mov L16, L0
+    mov *r7, r4
+    lea L27, L111
+    clr *r2
+endmacr
+macr m4
+    sub L118, L91
+    mov #-104, r1
+    mov *r0, r6
+    lea L104, *r7
+    clr r0
+    not *r1
+    clr *r3
+    red L103
+    bne L119
+    jmp L52
+endmacr
+cmp r5, *r3
+m2
+m1
+dec r1
+bne L12
+lea L106, *r5
+jmp *r2
+L0: sub r4, r7
+rts
+L1: .data -261
+clr L41
+clr *r2
+L2: red *r2
+m1
+L3: .data 726, -930, 402, -718, 335, -95
+m3
+L4: .string "x"
+lea L21, *r5
+mov L75, *r6
+jsr L45
+add *r6, L84
+inc r6
+jmp L36
+m4
+red L2
+bne L22
+add #193, *r5
+stop
+bne *r4
+m1
+clr *r6
+mov #-252, L69
+dec *r6
+L5: .string "gbeoelttec"
+prn #-157
+m3
+bne L2
+L6: .string "fhjllrsyv"
+cmp r1, L40
+L7: bne L29
+not L5
+jmp L3
+dec r1
+clr r6
+; comment
+L8: jsr L21
+rts
+bne *r0
+L9: jsr *r3
+bne L92
+jsr L85
+clr L2
+stop
+sub #-219, L8
+L10: .string "aakemqodn"
+L11: .string "ivyesmaowlmkmamx"
+inc r5
+L12: bne L100
+lea L75, r3
+L13: lea L74, *r5
+; comment
+L14: not r3
+sub L19, r6
+L15: .data 32, 382, -725, 891, 836, -127, 311, -895
+L16: bne L7
+L17: rts
+not L25
+L18: .string "kirrpoijtvtbqobaxpiuhxr"
+sub L10, r5
+; comment
+inc r1
+not r4
+add r6, *r0
+L19: .string "qqfxzwlqzptu"
+L20: cmp L12, *r0
+jsr *r1
+lea L17, *r1
+L21: lea L4, *r4
+L22: .string "qdgxicofvosceqdogjdbau"
+red r5
+m1
+lea L15, L10
+red r7
+m2
+; comment
+L23: .string "fesdrje"
+not r7
+red r1
+prn #176
+sub #235, L16
+L24: bne L3
+sub #180, L17
+L25: not r3
+jsr *r1
+L26: .string "cxjpmefhzcrcaw"
+lea L5, L44
+lea L0, r1
+clr r6
+
+dec L96
+jsr L25
+lea L15, *r1
+m3
+L27: cmp #-191, #56
+L28: mov r0, L106
+jmp *r6
+sub *r5, r1
+stop
+add r6, L14
+cmp *r4, *r7
+L29: .string "fffoywyqv"
+bne L41
+
+L30: .data 513, -136, -97, -818, 712
+bne *r0
+bne *r0
+inc *r5
+rts
+L31: sub #-10, r7
+m1
+L32: .data -845, 128
+mov #227, r1
+m2
+L33: .string "utravvvdefp"
+mov r6, L27
+lea L0, L4
+dec r6
+not *r6
+L34: .data -715, -532, -812, -485, -105, 664, -576, 38
+cmp r3, #111
+stop
+L35: .data 857, -458, -544, -798
+m1
+mov *r7, *r4
+L36: bne L116
+L37: .string "b"
+L38: .data 165, 62, 283
+dec L100
+L39: jmp *r6
+add L38, *r4
+dec L84
+L40: clr L27
+stop
+bne *r3
+jsr L8
+stop
+rts
+stop
+clr *r2
+L41: sub *r5, L27
+stop
+L42: .string "gddayzcetrlhbing"
+L43: prn #241
+m0
+inc L10
+L44: .string "kau"
+inc L115
+m1
+sub #69, L39
+L45: .data 746, 158, -856, 885, 968, -459, 687, 682
+mov r1, r0
+clr *r5
+jmp L104
+L46: cmp r5, r3
+m3
+sub L93, L9
+prn r3
+red L3
+L47: cmp L54, #1
+prn #-225
+stop
+L48: .string "olvfmsowmpwdqztrpzjsrya"
+clr *r3
+bne L116
+mov *r6, *r6
+L49: red r4
+inc r0
+red r2
+rts
+mov L47, L112
+dec L80
+stop
+
+L50: .data 529, 768
+not L67
+mov #-152, L48
+not *r7
+m2
+L51: red r3
+jsr L59
+m0
+L52: add L0, r4
+bne L68
+L53: .data -542, 534, 461
+lea L5, r6
+not L0
+stop
+m4
+jmp L24
+mov L68, r2
+red r1
+lea L34, L23
+m4
+stop
+L54: .string "ucfqvruyunrsh"
+not L88
+cmp #-23, #103
+not r6
+L55: clr L5
+stop
+bne *r7
+lea L3, *r0
+L56: .string "qwi"
+L57: rts
+m1
+L58: lea L76, *r6
+L59: red L30
+clr *r2
+m2
+cmp #161, *r2
+; comment
+dec L74
+L60: .data -256, 640, 786
+L61: prn r0
+clr L29
+sub *r1, L120
+lea L77, L59
+m1
+lea L81, r0
+dec L65
+jmp L48
+red L8
+m1
+dec r6
+m2
+L62: lea L67, L94
+red *r6
+L63: clr L68
+mov L66, L42
+L64: clr *r5
+L65: not r2
+clr L29
+add r0, r5
+m4
+stop
+L66: prn r2
+stop
+L67: .string "ugzlogosnbg"
+lea L93, *r1
+stop
+m2
+inc r2
+L68: stop
+stop
+stop
+L69: .data -200, -729, 419
+L70: jsr *r3
+rts
+jmp *r5
+add L34, r4
+m2
+cmp L58, #154
+prn L56
+stop
+stop
+L71: lea L0, r1
+lea L25, L60
+m3
+rts
+; comment
+dec *r2
+not *r0
+rts
+prn r7
+sub L66, L76
+L72: .string "papinfrvbjq"
+L73: .data -382, 736
+add #-198, r3
+not *r5
+not L109
+jsr *r3
+red *r1
+prn #-95
+m2
+L74: dec L28
+jsr *r5
+L75: .data -965, 899, -847, -753
+; comment
+m4
+L76: sub *r6, *r1
+L77: .data 714
+L78: not r7
+prn #83
+jmp L75
+rts
+bne L115
+inc r4
+dec L115
+L79: .string "uziuigztibhmrcklpzjhqxi"
+add L111, *r2
+sub r6, *r4
+add *r2, *r0
+jmp *r2
+L80: mov #182, L10
+inc L118
+m3
+jsr L41
+jmp *r2
+; comment
+rts
+clr *r4
+prn L9
+mov L79, r2
+L81: rts
+lea L50, *r7
+jsr *r6
+stop
+L82: clr L46
+L83: clr *r1
+sub r1, L114
+bne *r2
+L84: dec *r4
+jsr L108
+stop
+inc r4
+stop
+sub *r0, *r5
+L85: .string "thiumhrasfpuymqzquwale"
+L86: cmp #233, L36
+sub L53, r1
+L87: add #-2, r4
+stop
+red r7
+bne L110
+L88: lea L45, *r6
+L89: .data 213, 378
+L90: stop
+L91: .string "gjd"
+jmp *r1
+inc *r6
+L92: .string "dgctgi"
+L93: .string "nuhjwvoslyvlzine"
+L94: rts
+stop
+prn #-251
+jsr *r1
+sub r0, *r4
+L95: stop
+L96: jmp L118
+mov #98, L99
+jmp L87
+sub r1, *r3
+L97: .string "cvmkbkvnqptcgjq"
+m4
+bne L118
+jmp L5
+m0
+L98: dec *r6
+L99: .data 212
+add r7, L9
+mov #-99, r4
+lea L102, r0
+prn L115
+L100: .string "gjxhdfvevohjykfbs"
+m0
+
+dec L74
+
+L101: .data 173, -918, -456, 228, 808, 925, 483, 879
+jmp *r5
+L102: .string "m"
+rts
+dec r1
+L103: mov *r6, r5
+m4
+L104: red *r4
+L105: .data 536, -857, 903, -852, -778, 216
+cmp L117, r3
+prn *r0
+m2
+jmp L121
+rts
+L106: rts
+dec L3
+rts
+add *r2, r7
+L107: dec r6
+mov r7, *r7
+bne L33
+mov L8, r0
+stop
+sub r6, r7
+rts
+L108: inc *r0
+cmp L115, r6
+L109: .string "rnzjdwmmxemgoimirjkxs"
+m3
+L110: .string "idklozwmdpvaxiklrqtya"
+stop
+m0
+red *r2
+clr *r0
+jsr L14
+m3
+lea L113, L119
+m4
+sub *r0, L113
+clr *r1
+m2
+bne L116
+stop
+red L114
+m4
+prn *r0
+rts
+m0
+m3
+cmp r3, r0
+bne L81
+add L52, *r3
+add #130, *r0
+L111: cmp r3, #14
+red L68
+m2
+bne L117
+jsr L114
+cmp #-213, *r1
+clr *r6
+sub *r0, r1
+jmp L116
+L112: red L71
+m1
+L113: inc *r5
+m2
+m0
+inc r0
+m2
+m1
+inc *r6
+L114: red r3
+jsr *r2
+sub L53, r0
+m1
+jmp *r7
+cmp #139, L103
+jsr *r0
+clr L117
+add *r4, L119
+L115: .data 625, -195, -768, 288
+inc r5
+m3
+red r7
+jsr *r5
+; comment
+sub L105, *r2
+rts
+m3
+L116: sub r1, r0
+jsr L119
+m2
+red *r4
+L117: not *r4
+not r7
+m4
+prn #-234
+jmp *r5
+L118: .data -160, -205
+jsr *r6
+m4
+jmp L121
+bne *r7
+cmp r5, #215
+dec L94
+mov *r3, *r5
+rts
+prn *r0
+m4
+add #-222, L121
+m3
+not L79
+bne L119
+clr L119
+cmp L23, #-189
+dec L107
+red L111
+inc L105
+red *r5
+L119: .string "xrcfbjg"
+prn r3
+jsr L120
+mov L70, L120
+lea L120, L28
+jmp *r6
+m2
+cmp L30, #193
+clr L88
+L120: mov L121, *r3
+m1
+m0
+L121: lea L110, *r3
+stop
@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 51
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    stop
+    inc L10
+    rts
+    bne L82
+    inc L102
+    red *r7
+    bne *r5
+    red r6
+    dec r1
+    add #78, L83
+endmacr
+macr m1
+    prn L82
+    add r7, L32
+    prn r3
+    sub #110, *r4
+    stop
+    rts
+    clr L59
+    sub *r7, L2
+    cmp *r0, *r1
+    stop
+endmacr
+macr m2
+    rts
+    red *r1
+    bne L37
+    stop
+    jmp *r1
+    add #-62, r7
+    cmp r3, r0
+    jsr L54
+    rts
+    sub *r4, L60
+endmacr
+macr m3
+    jmp L93
+    sub #-87, *r6
+    stop
+    sub r2, *r0
+    mov L29, L63
+    not *r7
+    jsr *r2
+    not L70
+    inc r5
+    add r3, L97
+endmacr
+macr m4
+    clr L100
+    bne *r5
+    red r2
+    not r3
+    jmp *r1
+    jmp L65
+    sub #-120, *r1
+    dec *r6
+    not L70
+    cmp *r6, L31
+endmacr
+m0
+m0
+L0: .data -303, -193
+lea L0, *r7
+L1: not *r0
+red r2
+jmp L0
+cmp *r7, L1
+clr L0
+inc L0
+jmp *r6
+prn #-195
+m3
+; comment
+L2: red *r6
+jmp L18
+L3: stop
+add *r0, L2
+prn #-73
+m4
+m1
+not *r5
+dec L1
+m3
+L4: .data -534, -872, 117, -357, 191, 585, -100, 466
+L5: .string "aysimvpkcvwptmwctibc"
+m1
+L6: not *r3
+
+L7: rts
+add #247, r7
+m0
+L8: sub *r1, r7
+dec *r5
+L9: cmp r3, r7
+prn *r3
+jmp *r0
+clr r7
+L10: .data 501, 768, 223, -146, -929
+clr *r4
+L11: .data 772, -905, -618, -665, 127, 257
+prn *r6
+cmp r6, #-142
+sub L4, *r6
+L12: red *r6
+sub *r5, r3
+L13: not *r0
+dec *r7
+; comment
+L14: jmp *r6
+L15: .string "uawdcoaujbyjo"
+sub #9, L82
+
+dec L11
+; comment
+prn r1
+rts
+
+sub #255, *r3
+jsr *r6
+inc *r4
+prn r4
+L16: .string "hmtcbqax"
+cmp *r3, #140
+sub L6, *r7
+prn #86
+sub r7, *r3
+rts
+jsr L17
+mov *r7, L6
+rts
+stop
+add L3, *r1
+lea L8, *r3
+m4
+m4
+L17: .string "kgagejfubrakosahw"
+m1
+prn *r5
+cmp *r4, *r2
+L18: add r0, r4
+L19: dec L2
+; comment
+sub #-239, L71
+jmp L108
+dec *r2
+m4
+dec *r6
+jmp L55
+clr r6
+m3
+L20: inc r4
+m2
+L21: inc *r6
+prn #-61
+add #236, *r1
+bne L15
+m1
+L22: prn L6
+L23: dec L12
+add *r7, L111
+sub *r7, *r7
+m2
+L24: .data -521, 347, -411, 758, -670, 0
+jmp *r2
+; comment
+prn r0
+jsr *r6
+m4
+L25: not L22
+bne L12
+m1
+rts
+m0
+m3
+; comment
+m3
+bne *r5
+m4
+prn r4
+L26: cmp #219, r2
+add *r6, r0
+add #-13, r2
+sub #42, *r1
+red r7
+m1
+m0
+L27: .data -573, 516, 114, -933
+inc r7
+L28: stop
+not L32
+red L67
+L29: .data 442, 456, 595, -508, 602
+bne *r5
+jsr *r4
+rts
+dec L10
+not L97
+; comment
+mov r5, r2
+m1
+L30: .data 348, 823, 414, 949, -670
+dec L18
+m1
+L31: .string "utrewtghjqkrg"
+L32: bne L39
+prn r5
+; comment
+L33: add #-196, L80
+lea L39, *r4
+L34: .string "cqmihggqlekwqb"
+L35: mov *r7, L15
+mov L5, *r7
+m1
+L36: not r5
+L37: dec r4
+L38: .data -699, -55
+cmp L20, r3
+jsr *r0
+; comment
+cmp #120, r5
+lea L87, L6
+cmp L52, L30
+m2
+
+m2
+sub #-25, *r6
+L39: clr *r4
+m3
+mov #67, *r6
+prn *r2
+L40: .data 736, -928, 294
+m2
+stop
+jmp *r5
+inc L86
+m1
+jmp *r3
+L41: add *r1, r4
+L42: .data 474, -440, -726, 827, 599, 519, -650
+L43: red r3
+m3
+
+L44: dec L51
+L45: .string "vdnvhloouyqbnc"
+m2
+not *r0
+prn r4
+L46: .string "ckvgynl"
+inc L20
+mov *r7, *r6
+m1
+
+clr *r1
+mov *r1, L38
+red r0
+m1
+prn *r5
+red L45
+rts
+m4
+L47: .data 24, -982, 819
+m2
+
+rts
+sub *r4, *r3
+rts
+m4
+red r3
+inc L103
+not r1
+L48: .data 291, 958
+L49: .data -805, -122
+bne L94
+m1
+
+L50: red r2
+L51: .data 958, 171, -587, 134, -720, 23, -51
+inc *r0
+inc *r2
+L52: .data -337, -987, 65, 276
+m2
+add #-129, L35
+clr r1
+mov L89, L68
+rts
+m1
+L53: .data 475, 146, -560, 486, 955, 916, -373, -54
+prn L38
+inc r0
+L54: .string "lblrshhmfgrzpalcjonwfv"
+L55: .string "vaegdjarko"
+jsr *r3
+dec r2
+stop
+red r7
+L56: jmp *r6
+m4
+L57: stop
+m4
+dec r6
+L58: cmp *r6, r0
+L59: bne *r0
+dec L31
+m4
+m4
+L60: .string "ysnzudhsj"
+L61: .string "lvi"
+dec r2
+jsr L44
+rts
+m1
+red L73
+bne L2
+jsr L95
+jmp *r6
+lea L24, L98
+lea L27, *r2
+m2
+L62: sub L46, *r1
+add *r5, *r1
+clr *r2
+bne *r4
+not L82
+stop
+L63: .string "qpkdmgkfcorz"
+clr r7
+m3
+L64: .data -258, 144, 474, 888, -761, 251, 386, 206
+rts
+L65: red L53
+L66: .string "fdxnyximwjmjtss"
+m4
+L67: lea L106, r7
+inc r6
+L68: .data -670, 992, 636, -229
+L69: dec *r2
+m4
+
+jmp *r3
+mov #-200, *r4
+L70: jsr L87
+rts
+stop
+m2
+inc L102
+m4
+inc r1
+prn L110
+cmp #-84, #160
+inc r3
+L71: inc L31
+sub r5, L73
+clr r4
+red r2
+dec L68
+sub r7, *r6
+cmp #24, r2
+m0
+sub *r5, L85
+L72: .string "wtfepptagrxplqquva"
+mov #118, r1
+inc L48
+prn *r1
+lea L2, L91
+stop
+lea L47, r0
+L73: cmp L59, r5
+m1
+L74: .string "qlqtpc"
+L75: .string "ytwsewvcowix"
+m1
+L76: prn r2
+L77: bne *r0
+L78: clr *r2
+rts
+prn L84
+dec L85
+bne L98
+L79: jsr *r0
+m2
+jmp *r7
+rts
+m2
+cmp *r2, L32
+L80: jsr *r6
+dec L92
+dec r0
+L81: .data 288, 99, 661, -371
+jmp *r0
+L82: mov *r2, L47
+
+m2
+red L58
+L83: sub #-185, L84
+rts
+red r7
+red *r4
+cmp *r7, #-216
+clr L3
+inc r4
+inc r3
+inc L81
+stop
+lea L92, L44
+L84: .data 401, -655, 897, 744, 688
+red r0
+m4
+L85: .data -118, -235, 762, 85, 387
+L86: rts
+clr r7
+jsr *r4
+sub L102, L104
+L87: sub r3, L9
+L88: bne L38
+bne L97
+stop
+clr r1
+L89: jsr L106
+
+L90: .data -130, -779, -540, 300
+add L96, L4
+prn r4
+inc r0
+inc *r2
+lea L96, *r1
+L91: sub *r4, *r1
+m3
+bne L11
+L92: prn r0
+bne *r3
+stop
+dec L109
+add #185, r4
+rts
+lea L41, L106
+prn r3
+jsr *r0
+L93: dec r3
+clr L103
+jmp L102
+stop
+bne L17
+jsr *r0
+not L86
+m1
+jmp L95
+jmp L108
+bne L107
+m4
+m4
+dec *r3
+; comment
+m1
+mov r4, r0
+rts
+
+sub L91, r7
+inc *r6
+m0
+clr r5
+L94: .data -759, 586, 312
+bne *r6
+lea L94, r5
+dec L108
+m2
+lea L8, r2
+mov *r7, L98
+dec *r5
+add *r2, L91
+m3
+not *r4
+dec L24
+; comment
+not L77
+mov r7, *r2
+mov *r5, L91
+not L105
+m0
+m1
+jsr *r2
+L95: .data 843, -413, -195, -173, 194
+L96: .string "lbdsvsouzbhpxfj"
+inc *r1
+dec *r7
+; comment
+L97: .data 339, -856, 995
+m4
+m2
+; comment
+jsr L94
+; comment
+mov r7, r6
+m4
+L98: mov L14, r5
+L99: sub L78, *r5
+
+mov *r0, *r6
+red *r7
+
+m4
+not *r1
+jmp L72
+; comment
+m2
+red r3
+m2
+; comment
+jmp L73
+bne L106
+L100: inc *r7
+L101: stop
+L102: inc r1
+L103: .string "dgrreznnxgpafkqbyyjlcmgk"
+m4
+m2
+; comment
+dec r6
+add r7, r3
+m4
+sub #-205, *r1
+m0
+mov *r5, r7
+m0
+L104: .string "mo"
+m2
+m3
+lea L25, *r7
+inc L15
+L105: mov *r2, *r0
+m3
+sub #-248, L26
+L106: dec r2
+m3
+clr L85
+L107: .data 162, -315, -678
+m3
+red L17
+red r0
+L108: .data -360
+inc L77
+prn *r3
+; comment
+mov *r2, r5
+L109: .data 941
+cmp r2, r4
+sub r3, *r6
+jsr L87
+stop
+m1
+add L110, L50
+
+L110: add *r0, r5
+add r7, L79
+mov L111, r0
+L111: bne L54
+red L58
+not r0
+m0
+m3
+stop
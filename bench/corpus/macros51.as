@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 52
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    lea L78, *r4
+    prn *r6
+    lea L102, *r3
+    jsr *r0
+    mov L22, *r2
+    prn *r0
+    cmp L7, *r5
+    not *r5
+    stop
+    inc L60
+endmacr
+macr m1
+    add r1, *r2
+    add r2, L30
+    prn L73
+    bne *r7
+    jmp *r7
+    red *r6
+    mov r7, r7
+    inc L34
+    lea L102, r2
+    stop
+endmacr
+macr m2
+    lea L5, L71
+    lea L48, *r6
+    not *r5
+    add r5, L67
+    cmp L17, #138
+    not *r4
+    bne L65
+    dec *r6
+    stop
+    clr *r0
+endmacr
+macr m3
+    stop
+    mov #148, L24
+    prn #142
+    bne L34
+    add *r5, L71
+    dec L41
+    mov L36, r7
+    cmp L55, #44
+    prn #-117
+    add #58, *r3
+endmacr
+macr m4
+    bne L101
+    sub #91, L12
+    bne L117
+    mov L58, L73
+    lea L16, *r0
+    rts
+    stop
+    add L38, *r6
+    jmp L74
+    jsr L3
+endmacr
+prn #199
+jmp *r3
+dec L10
+L0: .data 509, 148, 67, 266
+jsr *r7
+prn #-87
+bne *r2
+m3
+jsr L0
+L1: .data 704, -200, -404, -954, -856
+m1
+not L111
+red r3
+inc *r0
+m4
+lea L25, L73
+L2: rts
+jmp *r6
+L3: sub *r7, r6
+L4: red r3
+; comment
+cmp L3, *r2
+m1
+L5: .data -516, 745, 438, -482, -70
+sub #88, *r6
+m0
+mov #12, L64
+jsr *r5
+L6: jsr *r3
+clr r1
+m2
+not L99
+L7: not L113
+L8: cmp *r0, *r2
+dec L4
+; comment
+L9: .string "okghzeloudxkloe"
+L10: .string "drrorhrtujxqaqcjpmhsnq"
+m4
+L11: clr *r5
+m4
+m4
+m0
+bne L4
+L12: .data 499, -74, 272
+m0
+L13: jmp *r0
+cmp L10, #160
+red L53
+stop
+red L2
+red r7
+L14: .data -936, 827, 345
+L15: inc *r3
+sub #-53, L81
+bne L10
+L16: .string "d"
+L17: add #147, L0
+L18: dec r4
+stop
+L19: clr *r3
+L20: lea L1, L14
+
+m4
+stop
+add r7, *r1
+L21: sub r6, *r6
+rts
+inc r3
+
+L22: prn L21
+m3
+red *r1
+m0
+jmp *r3
+inc r4
+jsr *r5
+L23: jmp *r6
+clr *r0
+prn r1
+mov r1, *r0
+sub #252, *r1
+L24: .string "syiwrqzqgjqrlevewcj"
+cmp r3, r3
+inc r0
+add L12, *r7
+L25: .data -696, -929, -445, -948, -552, -472, 122
+L26: mov r6, r4
+m0
+m4
+prn *r3
+m2
+red *r2
+L27: not *r0
+L28: clr *r4
+add L99, *r4
+m2
+jsr *r7
+cmp L0, r1
+; comment
+sub *r0, r5
+bne L11
+inc L97
+L29: red *r3
+not *r2
+L30: add L26, *r0
+L31: stop
+m2
+jsr L94
+L32: cmp r7, #-187
+clr L76
+add #-246, L66
+m4
+L33: .string "rj"
+red L91
+L34: jsr *r2
+cmp #-145, L103
+red L20
+L35: .data 408, 163, 111
+m1
+clr L87
+inc L54
+L36: stop
+L37: .data -216
+L38: .string "biikl"
+add L35, r6
+m0
+
+prn #220
+inc r7
+not r3
+add r6, *r4
+red r7
+not L67
+m0
+red r5
+cmp #166, r1
+dec L9
+rts
+L39: .data -575, -692
+jmp L9
+bne *r6
+m3
+m4
+dec r5
+prn L78
+jmp L16
+prn *r1
+m0
+prn #242
+rts
+
+L40: stop
+m1
+stop
+m4
+L41: stop
+bne L64
+m3
+sub *r5, r1
+L42: dec *r0
+m0
+m0
+inc *r1
+rts
+add *r6, L4
+m2
+jsr L61
+m2
+m4
+L43: .string "eachrmunxmlczvmhjmr"
+jsr L52
+dec r7
+L44: .data 786, 831, 239, -447
+L45: lea L70, *r6
+clr *r6
+cmp *r4, #-146
+stop
+add *r3, r3
+cmp #1, L75
+rts
+cmp #-133, r6
+jsr *r5
+m4
+rts
+; comment
+jmp *r7
+mov L42, *r3
+L46: .string "dq"
+L47: cmp #112, #-96
+L48: .data 435, 779
+L49: jmp L74
+L50: not *r3
+red L74
+L51: jmp *r7
+red r5
+prn *r6
+clr *r2
+sub r4, *r2
+jsr *r6
+L52: stop
+lea L73, r5
+inc L10
+; comment
+stop
+m4
+inc *r0
+L53: inc *r3
+add #195, r6
+
+m0
+cmp L87, #112
+sub L33, *r7
+jsr L56
+add *r5, *r2
+not *r7
+sub r0, *r4
+m2
+L54: jsr *r1
+m1
+dec *r0
+m0
+L55: rts
+rts
+L56: inc *r4
+m3
+lea L34, L4
+m4
+; comment
+bne L110
+lea L83, r0
+L57: lea L63, L28
+L58: bne L60
+m0
+m2
+dec *r2
+clr *r5
+L59: clr L96
+L60: .string "unbmumllkiuzkxfycw"
+sub #174, *r6
+m0
+prn L73
+stop
+not r2
+m3
+jmp *r2
+not L4
+clr r1
+m4
+L61: .string "krdvt"
+add L114, r3
+L62: sub L96, L104
+clr L96
+L63: rts
+lea L37, r3
+m3
+jmp L44
+L64: .string "zkkiod"
+L65: prn *r0
+cmp L100, L77
+m0
+lea L1, *r5
+stop
+red r0
+stop
+; comment
+mov r7, r1
+L66: .string "acqlnyjqhotma"
+m3
+cmp #-7, L109
+prn L30
+clr *r2
+red *r2
+clr *r6
+m1
+L67: rts
+m0
+cmp r2, *r3
+dec r1
+L68: .data -296, -902, 868, 668, 156, 912
+dec r5
+inc L34
+add L24, *r5
+L69: .string "fvsvkhfqtecqkylxwrqfyu"
+m4
+L70: .data -232, 455, -663
+sub *r7, L111
+L71: red *r3
+m1
+inc r2
+m0
+L72: .string "tqqqowtpjkvblmoncftxcih"
+L73: not *r5
+not L28
+not r4
+add r0, *r4
+m2
+mov L110, r3
+bne *r7
+L74: dec L116
+m4
+inc *r7
+not r0
+add *r3, L1
+inc *r1
+not r5
+bne *r1
+bne L74
+L75: .string "sqklhcfmujjv"
+L76: .data 125, -801, 464
+m0
+mov *r1, r6
+m0
+bne L50
+m3
+stop
+L77: mov #-127, *r5
+; comment
+L78: rts
+m3
+prn #187
+stop
+m0
+mov *r5, L42
+L79: .string "l"
+not *r2
+rts
+stop
+L80: mov r1, L100
+
+; comment
+inc r7
+L81: .string "iogtlevkuvshnsknxcin"
+mov r4, *r6
+m4
+lea L87, *r1
+sub #-244, r6
+jmp *r5
+mov L33, L89
+bne L92
+L82: cmp L90, *r1
+not r7
+red r2
+dec *r7
+L83: add r1, L20
+L84: .string "cnykdnzvoq"
+m1
+m4
+
+L85: .data -856
+mov L105, L86
+not *r2
+not *r3
+stop
+L86: lea L72, *r4
+m0
+clr r7
+red L114
+dec *r2
+L87: red *r5
+stop
+m2
+add r4, *r2
+L88: cmp *r7, r0
+m3
+; comment
+m4
+L89: jsr *r7
+sub *r0, L93
+
+lea L24, *r2
+lea L81, L112
+L90: sub r6, r1
+clr *r2
+stop
+red r6
+red r2
+m0
+add *r3, r0
+red *r3
+m0
+sub *r0, r6
+L91: clr *r1
+add r0, r0
+rts
+m4
+m1
+
+m2
+; comment
+m1
+L92: cmp r4, r3
+
+m2
+L93: .data -988, -195
+add #-52, *r7
+lea L93, *r3
+bne L103
+dec L45
+
+L94: add *r3, L115
+m0
+dec *r1
+L95: cmp r7, L101
+add r0, *r0
+mov L105, *r1
+L96: .data -321, -680
+L97: .data -648, 950
+m0
+jsr L65
+lea L107, r2
+cmp #6, *r0
+L98: .string "riuruyxkbagkydqha"
+L99: bne L65
+m0
+L100: .data -823
+jsr *r0
+L101: lea L102, r0
+m2
+mov r3, r7
+L102: .string "cerektdgpgconysfpuvms"
+; comment
+
+inc L107
+L103: dec L110
+mov #71, r1
+L104: inc L108
+inc L29
+add r2, *r6
+L105: jmp *r2
+m0
+mov *r1, L114
+inc L74
+red r6
+lea L113, L4
+clr r1
+jsr L90
+lea L99, L117
+L106: .data -323
+inc *r5
+L107: cmp r4, #4
+lea L24, r4
+prn L112
+jsr *r1
+m3
+L108: .string "nmuwbhlrmevqccfqhvi"
+stop
+lea L15, r3
+m2
+m1
+m4
+L109: dec *r5
+m4
+L110: red r0
+m0
+bne L75
+add r1, L85
+cmp L116, L9
+m0
+L111: .data -103, -5, -364, -531
+clr L113
+bne L48
+
+rts
+stop
+clr *r3
+L112: clr *r3
+L113: rts
+dec *r0
+rts
+red L117
+L114: .data -335, -644
+
+L115: bne L113
+m0
+bne *r0
+sub #-78, *r0
+L116: .data 708, 315, -958, 632, -994, 871, -833, -88
+L117: clr *r2
+rts
+red L115
+jmp L82
+m0
+jmp *r6
+dec r1
+m4
+clr *r0
+inc *r1
+
+add r5, r1
+not L24
+stop
+add *r4, L68
+bne *r3
+jsr *r7
+rts
+m4
+prn #-173
+inc r7
+prn L100
+stop
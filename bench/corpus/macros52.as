@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 53
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    jsr *r7
+    red *r2
+    bne *r2
+    lea L11, *r0
+    prn L37
+    prn #-56
+    dec r3
+    bne L64
+    prn r4
+    prn r5
+endmacr
+macr m1
+    lea L23, *r7
+    lea L47, L102
+    prn *r2
+    inc r2
+    inc r4
+    prn r5
+    clr r1
+    stop
+    prn L12
+    lea L54, L34
+endmacr
+macr m2
+    not r4
+    red L85
+    clr L53
+    clr *r2
+    stop
+    sub *r7, r7
+    red *r7
+    sub r5, *r4
+    lea L12, *r6
+    jmp *r6
+endmacr
+macr m3
+    add r5, L73
+    inc r2
+    stop
+    prn *r5
+    inc r1
+    mov *r3, L88
+    red L21
+    inc L32
+    dec *r6
+    prn #-24
+endmacr
+macr m4
+    sub L81, L90
+    jsr *r7
+    red *r7
+    cmp L88, L102
+    jsr L3
+    red L34
+    inc r0
+    red L107
+    inc *r3
+    jmp L9
+endmacr
+; comment
+dec *r1
+m1
+m0
+mov L85, r1
+jmp *r6
+clr *r4
+clr r4
+sub *r5, *r7
+L0: bne *r4
+stop
+jmp L12
+mov *r5, r6
+sub #-171, r7
+sub *r1, *r5
+L1: sub r5, r6
+dec L1
+L2: .string "czkmb"
+sub r4, *r5
+L3: .data 793, -787, 687, -509
+rts
+L4: mov *r6, L2
+m3
+m3
+add L0, L102
+L5: cmp #-2, L74
+m4
+m0
+m0
+L6: .string "vtgriszrikf"
+L7: .data 79, -359, -156, 531, 302, -147, -607, -642
+L8: clr r4
+L9: jmp L101
+m2
+L10: .string "xwlwxmqnykadvxyqhpxezwkh"
+add L75, *r5
+inc r6
+m2
+L11: lea L4, r4
+lea L46, r2
+dec r1
+prn r4
+red L0
+L12: cmp L33, L2
+cmp r7, #212
+; comment
+cmp r1, *r0
+m1
+lea L53, L4
+cmp *r3, *r2
+mov #220, r6
+m4
+m0
+lea L4, L6
+m4
+mov #-168, L9
+jmp *r3
+L13: .string "bzpwrbwbjpytkaynpa"
+m2
+L14: .string "w"
+m4
+dec r7
+L15: .data 572, 310, 723
+m3
+red *r4
+clr L62
+jmp L85
+lea L104, *r1
+inc r7
+m4
+L16: clr *r4
+mov r7, r6
+sub L11, L8
+L17: .data 82, 720, -623, 775, -685
+not *r5
+inc L9
+cmp #-194, *r5
+m0
+m4
+L18: .string "shmcxebffmcivbolpgk"
+rts
+bne *r6
+prn r0
+not L53
+rts
+clr L12
+jsr L13
+jmp *r2
+L19: clr L99
+m4
+L20: .string "bdifwpfijinmtpfllfuio"
+L21: .string "lyowhgbmuumw"
+m1
+m0
+mov *r3, *r4
+L22: lea L2, r4
+clr r7
+jmp *r7
+L23: .string "yqhbellkaoxvexzmrq"
+sub r6, r2
+cmp r7, L90
+jsr L17
+L24: red *r1
+prn *r1
+m4
+L25: .string "qwe"
+m2
+L26: cmp *r3, *r0
+cmp L42, #194
+add #206, L76
+cmp #-84, *r7
+m0
+m3
+m3
+m4
+rts
+m2
+m0
+L27: .data 547
+m1
+not *r4
+L28: lea L0, L80
+sub r2, L4
+clr L18
+m0
+rts
+clr *r7
+jsr L25
+dec r4
+L29: lea L24, L29
+jmp *r4
+L30: prn *r7
+bne L70
+
+add L102, r7
+sub #31, L61
+stop
+mov #178, *r7
+m1
+L31: .data 797, 180, 57
+L32: dec L6
+L33: dec L30
+red r7
+
+jmp L30
+L34: stop
+mov #-26, r6
+lea L56, L77
+L35: .string "sjn"
+m3
+m4
+m4
+jmp *r3
+m0
+m4
+jmp *r2
+m1
+L36: .string "knispclkr"
+stop
+L37: not *r1
+L38: .data 988, 241, -477, -782, -276, -623
+m0
+not L12
+; comment
+L39: .string "efrgmjvf"
+m1
+stop
+dec L14
+cmp #-185, #-27
+L40: .data 426, -60, 133, 482, 326, 448, 3, 750
+m2
+L41: bne *r2
+m4
+bne *r5
+lea L30, L86
+red r4
+sub #-245, L40
+jmp *r4
+lea L35, r2
+mov r7, L0
+m2
+m2
+cmp L54, *r7
+m0
+jmp L106
+cmp #-53, *r7
+dec r6
+dec *r5
+lea L82, r7
+not L10
+L42: add r1, L48
+L43: .data -893
+rts
+cmp *r3, L95
+rts
+m4
+stop
+L44: .data 880, -83, -171, 679, 950, -411, 498
+rts
+L45: .string "xspzaxdnyyiemkczgbkmpa"
+sub #89, *r5
+L46: .string "k"
+jsr L1
+dec L88
+red *r7
+L47: .string "d"
+jmp *r7
+L48: .string "cxdcwwyif"
+jmp L27
+add #-60, r5
+jsr L11
+dec r5
+m1
+cmp r3, *r7
+lea L84, *r3
+stop
+
+
+L49: cmp r3, r4
+jmp *r4
+add L39, L55
+m1
+red r2
+L50: .string "wzvmms"
+L51: .data 226, -878, -165, 932, 460, -361
+L52: cmp *r4, r4
+L53: dec r0
+inc r1
+red L106
+L54: stop
+jmp L42
+m0
+L55: lea L55, *r3
+stop
+L56: .data -388, -487
+m4
+; comment
+lea L79, *r5
+m4
+lea L75, r0
+m4
+m4
+dec L47
+m3
+m4
+jmp *r5
+mov L105, *r4
+sub L64, *r7
+jsr *r0
+L57: jsr *r2
+
+m2
+mov r0, L15
+jsr L7
+L58: cmp *r3, #40
+bne L48
+sub *r0, r4
+clr L106
+dec L58
+mov #-143, *r6
+prn L13
+m0
+
+m3
+m0
+red L12
+L59: .data 720, 993, 460, -35, -630, 23, -147
+rts
+jmp L43
+clr *r4
+rts
+m0
+add L90, L9
+L60: sub *r7, L107
+L61: jmp *r3
+sub r7, *r0
+L62: red *r3
+L63: dec L33
+m0
+L64: prn r4
+sub *r5, L58
+m2
+clr r6
+prn #214
+sub r3, L92
+red L56
+clr r5
+jmp *r4
+stop
+m3
+inc *r3
+mov #-101, *r5
+rts
+L65: clr r5
+prn L10
+inc *r2
+rts
+rts
+m3
+L66: lea L109, r0
+L67: add r3, r4
+L68: sub L22, r2
+jsr *r4
+inc r6
+m1
+L69: red *r6
+inc L107
+L70: .string "wrdkuzknekxlwhttyfvzz"
+rts
+jmp *r5
+bne *r2
+m1
+not r7
+bne L5
+L71: .string "lzjcnegcdhiwyzzefvlasctx"
+m4
+m1
+L72: .string "ocu"
+clr L2
+prn *r3
+inc r6
+clr L57
+mov *r2, r5
+rts
+inc r6
+rts
+; comment
+inc L98
+L73: cmp *r3, r6
+L74: .string "qawpfgjl"
+stop
+sub L98, *r5
+L75: stop
+L76: .data 155, 498, -579, -115, -438, -610, -969
+jsr L83
+m1
+L77: .data 223, 96, -371, 69, -350, 254
+lea L72, L21
+m2
+m4
+L78: red L107
+clr L60
+red *r1
+mov r7, L25
+L79: .string "hfmxomagdvf"
+cmp r4, L41
+L80: jsr L60
+L81: bne *r7
+m4
+
+bne *r0
+
+m3
+bne L60
+m3
+jsr *r5
+bne L13
+jsr L97
+m2
+not *r5
+m4
+jmp L109
+clr *r5
+red *r5
+lea L98, *r2
+sub *r6, r5
+L82: prn #148
+stop
+jsr L64
+mov #-186, L24
+jmp L92
+m0
+not r0
+red r1
+L83: .string "ymqyngb"
+add L95, *r6
+m3
+inc *r7
+; comment
+m4
+lea L90, *r7
+; comment
+mov r2, *r0
+L84: .string "pkbpcvftmvbmwuchy"
+rts
+lea L95, *r4
+L85: .string "bxqjszxfpnnxrznigtrcsh"
+dec *r7
+lea L79, L33
+jmp *r0
+cmp L91, *r6
+bne L86
+L86: .data -527, 250
+L87: dec r6
+clr r3
+clr r6
+L88: .data 877, 929, 154, 939
+rts
+m0
+m4
+add L0, r0
+L89: .string "qdndeljrqjkdsfoxuvfn"
+bne *r7
+dec *r6
+not r7
+mov #250, L100
+dec L102
+m4
+bne *r7
+lea L105, L91
+
+L90: rts
+
+L91: sub L93, *r0
+m2
+inc L98
+L92: .string "nqruxgcwdqilsifuayr"
+m4
+; comment
+L93: .data -743, -155
+bne *r4
+m0
+L94: .data -114, -646, 123, 950, -168, -482
+m4
+L95: jsr *r6
+mov #-4, L52
+lea L98, *r3
+cmp L12, *r2
+not *r3
+rts
+cmp #42, r7
+add r5, r2
+jmp L98
+m0
+jsr L76
+jsr *r3
+m0
+m1
+L96: cmp L99, #-38
+m0
+L97: mov *r2, *r2
+jmp L106
+prn L15
+jsr L101
+m1
+
+L98: stop
+sub #172, L45
+m3
+L99: .data 351, -293, 975, -446
+bne *r3
+jmp L52
+inc L1
+m1
+m1
+m2
+prn r7
+clr r0
+L100: .string "dwolvnv"
+L101: .data -857, 906, 351, 399
+L102: .data 909, 954, 908, 253, -28, 900
+dec *r0
+prn L107
+rts
+L103: .data 433, 768, -428
+L104: inc r1
+inc r5
+dec r6
+dec *r1
+sub r7, L106
+stop
+m3
+dec r7
+L105: jsr L82
+dec r1
+add L65, *r4
+jmp *r1
+m0
+clr L4
+m2
+L106: sub *r0, r3
+m1
+m1
+m4
+m2
+inc r0
+m2
+L107: add #-107, r6
+mov *r5, r6
+dec L108
+L108: lea L109, *r6
+lea L34, r0
+not *r2
+m0
+add r7, *r4
+add *r7, *r2
+L109: sub #-235, r5
+m1
+dec r2
+add *r6, r3
+stop
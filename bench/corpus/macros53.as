@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 54
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    inc L37
+    clr r5
+    bne *r5
+    jsr *r2
+    stop
+    inc *r2
+    jmp *r3
+    jsr *r2
+    sub r0, L13
+    rts
+endmacr
+macr m1
+    prn #-105
+    rts
+    inc *r6
+    cmp L39, r6
+    jmp *r3
+    rts
+    mov *r6, L46
+    prn L102
+    jmp L107
+    dec L40
+endmacr
+macr m2
+    lea L82, r2
+    sub r7, L30
+    inc r3
+    jsr L90
+    clr r3
+    dec *r5
+    cmp *r5, #136
+    prn *r7
+    red *r3
+    sub r6, r3
+endmacr
+macr m3
+    jmp L25
+    lea L36, L45
+    mov #-32, L26
+    clr r0
+    clr r0
+    not *r6
+    clr L40
+    prn r2
+    stop
+    lea L28, L11
+endmacr
+macr m4
+    dec *r6
+    add *r0, *r5
+    jmp *r0
+    prn *r6
+    sub #65, L50
+    jsr *r7
+    not *r0
+    jsr *r3
+    rts
+    prn r1
+endmacr
+red L94
+m3
+mov #-173, r7
+
+L0: jmp L87
+L1: add *r5, r3
+L2: .data 239
+L3: .data -307, 664, 589, 325
+m1
+L4: prn *r4
+lea L88, L0
+L5: cmp r6, #150
+m2
+cmp L21, L33
+m0
+L6: .string "uvcfmer"
+red r1
+bne L101
+; comment
+jmp *r1
+L7: add *r1, *r1
+cmp #112, *r3
+L8: cmp L78, #-126
+not r0
+rts
+cmp L5, r1
+L9: .string "emf"
+lea L70, L0
+sub L92, L91
+; comment
+
+sub L9, *r4
+
+L10: .data 970, 54, 35, -257
+prn L2
+add *r4, r5
+add #11, *r1
+rts
+L11: .data 723, -358, 643, 753, 469, -371, 937
+bne *r3
+L12: .data -737, 440, -346
+not *r7
+L13: bne L8
+prn L41
+dec r6
+add L83, *r1
+stop
+rts
+inc r6
+prn *r7
+L14: stop
+mov *r0, *r2
+L15: add r4, L5
+stop
+; comment
+prn L10
+jmp L1
+inc r2
+L16: add #204, r4
+clr r2
+L17: prn *r7
+L18: prn r2
+rts
+add *r1, *r7
+mov L80, *r1
+red r6
+cmp L91, #182
+stop
+rts
+L19: .string "dbfjufpqn"
+L20: .data 619
+L21: stop
+L22: .string "lu"
+m4
+rts
+m3
+
+m3
+red *r4
+jmp L6
+dec r3
+clr r6
+L23: jmp L5
+L24: .data -472, 242
+m1
+not *r1
+clr r6
+mov #-12, *r6
+cmp *r7, L56
+stop
+inc *r7
+L25: .string "llxeifggpwarhrtirfzio"
+L26: bne *r7
+mov L92, *r1
+
+red r2
+L27: inc *r7
+L28: jmp L93
+m4
+jsr *r2
+cmp #27, r4
+L29: jmp *r5
+lea L14, L108
+L30: inc L30
+cmp L26, *r3
+inc L9
+L31: add *r4, L16
+; comment
+clr L11
+m0
+lea L35, *r4
+sub #-31, L11
+rts
+stop
+m3
+mov *r6, L28
+rts
+clr *r6
+; comment
+m0
+clr L41
+m2
+m3
+L32: .string "ykrvwkto"
+m4
+jsr L85
+L33: stop
+bne L112
+bne *r0
+rts
+L34: .data -195, 637, -76, -340, 693, -688
+add *r5, L6
+m0
+jmp *r4
+bne L42
+m2
+L35: .data -376, -100, 235
+jsr L3
+jmp *r6
+inc L90
+L36: clr r5
+sub #-177, *r2
+m1
+m4
+jmp *r5
+L37: prn *r2
+jsr L30
+L38: .data 216, -329
+m4
+L39: add r4, L20
+stop
+L40: .data 63, 336
+jsr L101
+not r5
+jmp *r7
+L41: .data 923, -234, -141
+
+stop
+L42: .string "ujgomzsbvbvmclf"
+mov *r1, r6
+L43: .data -422, 705, 461, 2, 50
+rts
+stop
+cmp r1, L39
+lea L68, *r4
+add #-146, *r3
+; comment
+L44: not r5
+m3
+inc r5
+; comment
+rts
+inc r3
+m3
+dec r4
+; comment
+m4
+mov *r5, L76
+m0
+jmp L23
+clr r1
+L45: .string "cxuoxtbxwcm"
+L46: add #28, L46
+L47: .string "xzijucxsivokvadkfzpd"
+cmp r4, L41
+sub L86, *r1
+jmp L102
+m1
+L48: bne L57
+m0
+L49: cmp #-192, *r0
+m1
+stop
+L50: .data -537, 956, 865, 894, 407
+sub #-246, r7
+sub *r4, L26
+not L71
+clr L6
+L51: prn r0
+L52: .data 837, -313, -994, 816, 643
+m3
+m0
+lea L0, r4
+rts
+not r7
+
+L53: .string "aiajiy"
+bne *r4
+
+jmp L89
+cmp r0, r0
+m0
+mov *r4, *r6
+stop
+lea L16, *r4
+cmp L41, #-233
+rts
+m3
+; comment
+
+lea L55, *r1
+clr *r3
+rts
+L54: sub *r0, r5
+lea L61, r6
+mov *r7, L41
+not r3
+
+inc *r6
+L55: .data 644
+jsr L49
+m4
+L56: rts
+lea L48, L76
+m2
+L57: .data -739, 391
+L58: .data -633, -83, -779, -326
+red *r3
+stop
+add r1, *r6
+m0
+; comment
+L59: .data 912, 39, 688, 631, 194
+dec L104
+jsr *r7
+red L44
+L60: .data -892
+inc r7
+L61: red L3
+lea L76, r5
+mov #-193, r0
+m2
+lea L22, L25
+m0
+not L73
+jsr *r3
+L62: inc L92
+L63: .string "sorlyknqxvkcb"
+L64: .string "vr"
+m4
+L65: jmp L107
+m4
+mov L107, r0
+mov r0, r5
+stop
+L66: jsr *r3
+L67: bne *r4
+L68: .string "jbxagzlk"
+prn #102
+stop
+m0
+jmp *r4
+L69: not r3
+m1
+not *r5
+prn L36
+L70: bne *r4
+prn r0
+add r5, L84
+sub L101, r3
+mov r3, *r7
+stop
+cmp #-239, r4
+bne *r1
+m2
+
+stop
+prn L56
+L71: .string "mtgycmelrlbhtn"
+prn L91
+rts
+sub #-191, *r5
+L72: not L38
+jmp L65
+stop
+m3
+L73: jmp *r7
+jsr L86
+mov #-232, L22
+inc *r7
+dec L86
+bne *r4
+mov r3, L111
+L74: jsr L108
+red *r0
+m4
+mov *r1, *r6
+cmp L110, #46
+cmp r4, r6
+rts
+m1
+L75: .string "joijpqykdthretamtdhjrp"
+L76: dec r1
+sub r7, r7
+prn *r7
+m0
+jsr *r4
+not r4
+inc *r6
+lea L93, *r2
+L77: .string "ldpnmcjdsvafdvfv"
+clr r5
+prn r6
+jsr *r0
+L78: .string "fdrkfuztizy"
+red *r4
+L79: sub #-7, L82
+m2
+L80: .data -64, -283, -218, -183, 233, 489, 546
+rts
+lea L36, r2
+inc r7
+prn #166
+clr r4
+sub *r3, *r7
+cmp #-50, *r6
+L81: .data 782, 779, 231
+
+L82: sub *r2, L15
+lea L65, r2
+sub #-133, *r5
+m4
+jmp L96
+jmp *r0
+m3
+not r3
+m1
+L83: lea L21, *r5
+clr *r5
+
+sub L85, *r2
+inc *r7
+L84: cmp L94, #11
+add *r2, r1
+lea L44, L12
+L85: .string "qilkvcnedqmfv"
+not r5
+prn *r5
+m0
+inc *r6
+; comment
+inc L26
+m2
+L86: stop
+L87: .string "kfapslnmqggaasvpr"
+L88: jsr L96
+L89: .data -441, 120, -184, -803, 850, -858, -595
+L90: bne *r3
+add #-192, r1
+stop
+L91: .data -602, 629, 602, -792
+lea L112, r4
+rts
+; comment
+mov L94, L106
+m0
+m3
+; comment
+cmp *r6, r6
+cmp r4, r1
+L92: sub *r6, r6
+clr L34
+jsr L13
+jsr *r0
+cmp *r2, L101
+; comment
+L93: clr r2
+L94: add *r7, r6
+sub L103, L52
+L95: .string "ugvherhnjexryywrwn"
+
+L96: .data -653, 636, -23, 528, -767, -589, -230, 400
+red *r4
+prn #233
+m3
+L97: .data 705, 532, -92, -812, -108, 721, -431
+L98: .string "qowls"
+red *r0
+clr *r6
+jmp L108
+m1
+prn r6
+bne L105
+m3
+jsr *r2
+red *r1
+jmp L81
+
+m3
+lea L112, r0
+L99: bne *r2
+m3
+rts
+m2
+L100: .string "bmvcnlk"
+m1
+jmp *r2
+L101: .data -673, -310, -460, -882, 923
+jsr *r1
+inc L71
+; comment
+rts
+sub #-82, L95
+mov *r6, r4
+add #95, L108
+stop
+m0
+m0
+cmp r5, #246
+
+m2
+lea L113, r6
+sub r7, L95
+sub L14, L109
+bne L104
+dec r2
+L102: red r7
+; comment
+rts
+L103: .data 866, -191
+L104: red *r1
+cmp *r6, r3
+m4
+jmp *r0
+dec *r0
+m0
+cmp *r7, L65
+prn L3
+cmp r7, L106
+rts
+L105: .data 293, 954, 457
+m4
+jsr *r0
+cmp L19, r0
+m3
+inc r1
+jsr L111
+m4
+sub r7, L109
+L106: .string "rutjqbcrqjavdzqolys"
+add r7, *r3
+clr L97
+prn L68
+prn *r4
+L107: .string "ymwrisrlomfntgvvksrkd"
+L108: .data -902, 225
+add L77, *r5
+m4
+red L49
+bne L111
+L109: rts
+mov L73, L8
+bne L111
+bne L113
+bne L17
+dec *r5
+bne *r5
+rts
+jsr *r4
+prn L101
+prn #67
+mov *r3, L37
+m4
+m1
+clr *r7
+stop
+L110: clr L111
+L111: .data 567, 256, -205, -180, 371, -7, 980
+dec *r6
+L112: .string "qjzsbbywjwgpnzcuiudd"
+; comment
+L113: stop
+inc L81
+add #111, *r4
+add r5, r6
+jmp *r1
+m1
+sub L87, r0
+add L86, r7
+rts
+stop
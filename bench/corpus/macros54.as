@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 55
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    red L24
+    bne *r5
+    lea L10, L57
+    add #12, *r2
+    not L65
+    bne L97
+    mov #229, *r2
+    prn *r4
+    not L75
+    clr *r6
+endmacr
+macr m1
+    prn r6
+    stop
+    add L81, *r6
+    rts
+    not L1
+    red L111
+    bne *r7
+    sub #229, L30
+    dec r5
+    not r4
+endmacr
+macr m2
+    jsr L14
+    lea L116, *r0
+    clr L105
+    add L33, L42
+    not *r5
+    mov #34, r2
+    dec r4
+    lea L75, r1
+    red L53
+    dec L62
+endmacr
+macr m3
+    cmp #114, #-239
+    stop
+    cmp L92, L24
+    jsr *r1
+    jmp L38
+    add *r7, L114
+    bne L51
+    stop
+    not L23
+    inc L13
+endmacr
+macr m4
+    sub *r7, *r3
+    rts
+    sub #-68, r1
+    jmp *r3
+    mov L34, L113
+    inc r5
+    dec L37
+    add r7, *r4
+    stop
+    stop
+endmacr
+m2
+lea L22, L56
+inc r1
+L0: .data -610, 327, 827
+m4
+prn *r2
+not r7
+L1: mov #231, r7
+rts
+cmp #-145, #-8
+m0
+inc L0
+L2: prn #-40
+m0
+m4
+sub L56, *r2
+mov L0, L10
+m3
+m0
+jsr L90
+prn #70
+inc r4
+m3
+red *r5
+bne L101
+L3: .string "tpeotrcsqmztadhdgtzvqk"
+m0
+m1
+m3
+L4: .string "exhepudeypbemefwan"
+jmp L4
+
+jsr *r4
+L5: .string "hptfgymihy"
+m3
+sub #-94, *r4
+L6: stop
+dec *r6
+cmp L5, #166
+jmp *r4
+dec r7
+rts
+m1
+L7: rts
+L8: .string "c"
+add #-22, *r1
+stop
+prn #191
+not L98
+jsr L101
+clr r0
+inc *r7
+L9: .string "qvttofinkbfsglqi"
+L10: .string "fkxfzoqwprdqqufprhrksh"
+m1
+m1
+jmp *r2
+m1
+L11: .string "bgxwbyovmmbfekljeyqdfqe"
+cmp #-188, L116
+add #-15, L1
+mov *r0, r4
+red *r5
+L12: .string "xuqpckkcvndioenfpdwwzo"
+L13: .string "exyuikzsezeuoniziyyu"
+add L9, r1
+inc L55
+; comment
+L14: .string "fmjmjexoufkwckvhokpaf"
+m2
+inc *r5
+cmp *r3, r7
+L15: clr L0
+inc *r7
+clr r1
+lea L9, *r3
+L16: not *r0
+; comment
+lea L9, r7
+mov r2, L14
+m0
+clr L13
+m0
+jmp L20
+sub #238, L115
+; comment
+; comment
+not L98
+L17: .string "fafkhxgcya"
+L18: add L17, *r2
+m4
+m1
+m3
+dec r3
+prn r5
+m4
+clr r5
+add r4, r5
+lea L13, r1
+; comment
+m1
+dec *r0
+L19: .data 582, 830, 66, -193, 180, 640, 918
+L20: dec L55
+stop
+L21: lea L111, *r1
+cmp L8, *r6
+lea L9, r7
+; comment
+m4
+clr r5
+L22: mov *r3, r3
+L23: .string "beorkanrjdpdp"
+clr L22
+m1
+mov r5, r3
+inc r2
+prn #-254
+cmp #93, *r7
+m2
+L24: dec L41
+L25: .string "qg"
+inc *r3
+stop
+m1
+bne L81
+lea L8, r0
+jmp L107
+L26: .string "nktqgnynglxgencwqfbfvbqa"
+lea L62, *r0
+inc r7
+m2
+L27: .data -970, 680, 356, -230, -182, 537, -109, 103
+bne L11
+
+L28: sub #238, *r6
+L29: .data 784, -593, -951
+inc *r3
+L30: lea L59, r2
+L31: stop
+m4
+not r1
+lea L22, r4
+add #-135, *r1
+add #-143, r7
+L32: red r4
+m1
+L33: .string "jolqvbtcazuel"
+cmp L33, L25
+L34: prn #245
+L35: mov r7, L56
+L36: .data 213, -321, -308, 455, 874
+L37: .data 572, 977, 862
+L38: inc r0
+m0
+L39: dec L0
+sub r1, r0
+m4
+jsr L61
+L40: .data -332, 641, -617, -856, 59, -45, 759, 438
+m1
+not r7
+m1
+L41: inc *r3
+cmp L2, L98
+dec *r6
+; comment
+L42: red L97
+; comment
+L43: dec L82
+L44: .data 913, -104, 277
+not L33
+jsr L21
+jmp *r0
+lea L2, *r3
+L45: .string "djiegclybiftehjnnycjvi"
+not *r0
+cmp #197, L84
+jsr L19
+L46: stop
+add r3, L44
+m4
+dec r5
+L47: .data -369, -523, 355
+mov L49, r3
+L48: .string "kiafcqncvbrngovogcu"
+m3
+cmp *r1, L5
+stop
+add L57, *r3
+bne L63
+L49: sub #51, r6
+rts
+jmp *r4
+rts
+jsr *r0
+L50: .data 335, 341, 479, -530, 358, 54
+inc L46
+
+not L21
+dec *r0
+mov L42, *r1
+not L70
+jmp *r3
+L51: .string "ucynnbjb"
+inc r1
+prn #-63
+L52: bne *r2
+dec *r2
+m4
+L53: jsr L81
+bne *r7
+m1
+
+m2
+jmp L50
+cmp #181, *r5
+inc L112
+m2
+jsr L46
+L54: .string "jaqmlqemqagagnnkqkz"
+m4
+m0
+L55: jmp L58
+m0
+m1
+jsr *r0
+jmp L39
+rts
+m3
+L56: mov r3, L115
+cmp *r2, r6
+prn *r5
+red *r5
+m0
+dec L4
+L57: mov #-107, L104
+m2
+L58: not r7
+rts
+sub #-161, r5
+rts
+rts
+m2
+bne *r7
+cmp *r2, #228
+lea L46, L99
+prn r5
+L59: bne *r2
+lea L105, r4
+L60: jsr *r5
+L61: bne L12
+m2
+jsr L46
+L62: jmp L86
+add L110, r6
+L63: red *r6
+inc *r2
+red r2
+L64: .string "glvrgecaaonaamojimricoy"
+cmp r7, #170
+m0
+sub #185, L85
+mov r1, *r1
+m3
+L65: not r2
+; comment
+L66: bne L1
+mov r3, L34
+m3
+jmp L115
+not r5
+m1
+sub r3, *r1
+m4
+dec *r5
+jsr *r2
+rts
+inc *r2
+sub *r6, r5
+L67: dec L10
+m4
+m0
+m1
+cmp #191, r5
+L68: jmp L94
+L69: sub *r1, L59
+L70: .string "qdg"
+L71: bne L2
+L72: .data -246, -222, 766, -390, 69, -619, 264, 999
+clr L61
+L73: .data 995, -981
+jmp L64
+m0
+sub L80, L76
+m2
+L74: .data -13, 359, -1
+prn #41
+L75: .data -996, 21, -209, 556, -418
+cmp r6, L102
+red r1
+
+red L103
+mov *r0, r1
+jsr *r7
+rts
+rts
+mov #-7, r7
+dec L15
+m0
+prn r1
+prn r1
+red r0
+lea L81, L101
+red r6
+clr r2
+add #-102, L89
+
+clr L28
+lea L33, *r7
+not L46
+rts
+rts
+cmp L114, *r3
+L76: sub L53, *r4
+L77: red *r7
+L78: add *r2, *r5
+red L48
+; comment
+; comment
+stop
+m0
+L79: .string "mxvektwrqirphqwrw"
+stop
+red *r6
+m1
+m0
+m4
+sub r3, L71
+jsr L61
+lea L13, *r3
+L80: inc L59
+cmp #-101, #-75
+bne L93
+m0
+L81: .string "anchowfeqyycom"
+jsr *r7
+prn *r4
+; comment
+L82: add *r0, L46
+mov r2, L48
+; comment
+clr *r3
+jsr L13
+not L89
+; comment
+bne L4
+jmp L33
+jmp *r7
+dec r1
+rts
+m4
+clr L29
+lea L113, r0
+L83: inc *r1
+m0
+add *r6, L91
+m4
+m4
+L84: clr L79
+prn #-68
+L85: red r5
+bne L101
+m1
+; comment
+cmp *r4, #82
+m1
+cmp r7, *r0
+add r6, *r3
+L86: rts
+m3
+jsr L97
+inc L86
+cmp r1, r0
+L87: .string "gvlxeocchtn"
+lea L116, *r4
+L88: .data 15, -577, -391, 980, -787, -597
+L89: .data -254, 803, 549
+L90: lea L102, *r7
+inc *r5
+rts
+dec r5
+inc r6
+red r3
+jsr L114
+L91: add r1, *r3
+L92: .data 199, 887, 793, 772, -739
+L93: add L112, r0
+lea L104, *r1
+red *r2
+L94: mov #27, *r1
+L95: lea L111, L64
+L96: .data 774, -447, -62, 286, -365, 551, -20, 333
+L97: bne L101
+clr L63
+m1
+cmp #99, r2
+red *r7
+prn *r3
+stop
+
+sub L113, *r1
+lea L95, *r2
+stop
+; comment
+clr *r1
+clr *r1
+L98: .string "pxdiayl"
+mov r4, *r1
+m3
+m4
+m4
+L99: dec *r5
+m3
+lea L46, L4
+jmp L73
+L100: clr *r2
+L101: .string "yicbhxngzteeuqvcvbeoxq"
+L102: sub L106, L29
+m2
+L103: rts
+L104: clr L107
+m0
+L105: stop
+m1
+m1
+L106: dec L81
+sub *r7, r0
+jsr L114
+m4
+jsr *r0
+jsr *r0
+L107: red r6
+red *r7
+rts
+L108: .string "ahfmfhxdxdvrcwhkvkdaah"
+m2
+clr *r5
+L109: stop
+
+clr L56
+m4
+sub L112, L111
+mov L46, L27
+; comment
+m2
+rts
+lea L115, *r2
+L110: prn *r1
+cmp L55, r5
+cmp L88, L115
+m2
+jmp *r7
+L111: .string "noyraclrbai"
+clr r3
+jmp L114
+m1
+L112: clr L113
+red L94
+m2
+add *r0, *r4
+L113: bne *r2
+inc r1
+; comment
+add *r0, r2
+dec L115
+m2
+; comment
+; comment
+m0
+red L80
+bne *r4
+L114: bne *r3
+m1
+m1
+not L25
+rts
+dec L116
+prn L116
+
+sub *r6, *r4
+prn r3
+m4
+stop
+m2
+L115: .data 535
+clr *r2
+rts
+jmp *r7
+L116: jmp L77
+stop
@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 56
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    lea L20, L87
+    lea L56, L94
+    clr r6
+    sub r3, *r7
+    add *r5, r6
+    sub r1, L17
+    prn *r0
+    clr r7
+    red *r0
+    cmp L105, r6
+endmacr
+macr m1
+    not r4
+    red r1
+    bne *r2
+    jsr *r2
+    cmp #-123, #-85
+    inc L17
+    bne *r6
+    not r1
+    mov #-154, r2
+    red *r3
+endmacr
+macr m2
+    add #-196, r4
+    mov L53, r4
+    sub #-215, L10
+    sub r3, *r2
+    bne L85
+    stop
+    jmp *r2
+    not r4
+    prn L111
+    jsr *r0
+endmacr
+macr m3
+    sub r1, *r3
+    sub *r4, L8
+    not *r6
+    mov *r4, *r1
+    add L35, L14
+    stop
+    sub r5, *r3
+    sub *r3, r0
+    clr L17
+    bne *r6
+endmacr
+macr m4
+    jmp L77
+    red *r0
+    dec L69
+    clr r1
+    jmp L64
+    stop
+    sub *r6, L35
+    lea L39, *r4
+    rts
+    bne L60
+endmacr
+bne *r5
+mov #161, r5
+L0: .data -954, 286, -976, -153, -986, 784, 238
+m2
+L1: dec L41
+L2: jmp *r5
+; comment
+not L0
+inc r7
+L3: .data -355, -224, 307
+L4: .data 709
+m0
+cmp #155, *r5
+red L2
+L5: .data 603, -867, 614, 386
+L6: .data -534, -759, -593, -343
+L7: bne L1
+; comment
+m3
+m1
+stop
+mov L8, *r5
+L8: clr L65
+m3
+jsr *r6
+inc L7
+mov r4, r7
+inc *r3
+L9: stop
+red *r7
+m2
+L10: clr *r0
+sub *r6, L22
+stop
+lea L6, L7
+mov L93, *r3
+m3
+inc r1
+inc L58
+L11: .string "ykbwbnremnbaqbsjwkksizix"
+not *r4
+m3
+L12: sub #-189, *r0
+m2
+
+m2
+not L9
+L13: lea L80, *r7
+add *r1, L12
+prn L5
+inc L37
+add L98, *r5
+jsr *r3
+rts
+lea L11, *r1
+m0
+mov *r3, r7
+rts
+red r3
+
+rts
+m4
+add *r3, *r2
+red r1
+m3
+jmp L11
+L14: jsr L84
+cmp #-178, r5
+not *r1
+m0
+lea L33, *r6
+dec L0
+L15: bne L11
+rts
+L16: dec *r2
+m3
+jmp L118
+L17: rts
+m4
+bne *r2
+L18: bne *r1
+L19: .string "zedhqjhgc"
+prn L40
+stop
+L20: .data -672, 623, -905, -731
+jsr *r3
+; comment
+cmp L92, *r1
+red L122
+jmp L10
+prn #-181
+stop
+cmp *r0, #-216
+red L13
+stop
+jsr L14
+red *r1
+stop
+mov #38, L5
+prn r1
+add r1, r2
+lea L6, r5
+stop
+stop
+jsr *r1
+L21: jsr *r4
+stop
+rts
+m2
+L22: .data -134, 50, -294, -235, -998, 369, 649
+L23: cmp r0, L16
+stop
+L24: .data 683, 13, 113, -784, 99, -515, 321
+L25: rts
+m4
+L26: prn #-189
+m0
+L27: clr *r0
+mov L101, *r1
+m1
+clr *r3
+dec L45
+clr L56
+dec *r3
+m1
+L28: .string "fzq"
+inc L19
+
+inc r0
+L29: jmp L10
+L30: .string "r"
+L31: jsr *r4
+clr L28
+m4
+L32: prn *r7
+clr r7
+jsr L58
+bne *r7
+cmp L45, r3
+L33: red r5
+jmp *r1
+L34: bne *r0
+; comment
+L35: .data -549, -389, 596, -557, -462, -33
+add r1, L30
+sub L78, *r6
+m2
+prn r2
+m0
+rts
+L36: .string "qfiigyjwoohxvxkxfpvm"
+dec r1
+mov r1, L2
+red r3
+inc *r5
+m4
+m1
+inc r0
+m2
+jsr L33
+dec L3
+L37: bne *r7
+lea L3, r7
+L38: .string "ctd"
+sub r5, L18
+m0
+m1
+cmp #-203, L9
+m1
+red r5
+stop
+L39: rts
+cmp L32, r2
+cmp *r3, *r7
+m1
+
+jsr L42
+bne L26
+not r3
+m2
+L40: jsr L5
+bne *r1
+L41: .data 537, 301, 722, -532, -476, 0, -883
+L42: .string "mipaylcbug"
+m1
+not r0
+m3
+not r0
+stop
+dec L110
+add #-102, L102
+mov L71, r1
+jsr *r0
+L43: .data -44
+dec *r4
+not *r4
+clr *r3
+L44: .data -814, 846
+L45: .data -235
+; comment
+sub L56, r2
+L46: lea L54, *r4
+L47: .string "hjd"
+jmp *r5
+L48: add L59, L3
+lea L120, *r7
+jmp *r4
+dec L9
+rts
+not L31
+m3
+m1
+m1
+dec L10
+bne *r0
+cmp r5, #-186
+bne L82
+red *r7
+L49: lea L2, *r6
+L50: .data -661, -619, 85, -626, 576, 920, 879
+L51: add r1, L34
+cmp r3, r7
+stop
+lea L77, *r5
+sub r4, L86
+clr r1
+m4
+L52: dec r3
+L53: bne *r5
+bne L120
+L54: cmp *r0, r7
+sub #221, *r6
+dec L112
+dec *r1
+rts
+m1
+L55: mov L39, r7
+L56: .string "qobkfomlhxgjq"
+m2
+not r3
+m0
+red L46
+L57: inc *r5
+jsr *r2
+add L28, r2
+m2
+not r7
+rts
+lea L79, L65
+cmp L2, #-145
+red L72
+
+m0
+cmp r6, *r1
+stop
+L58: mov r2, L16
+prn *r5
+m0
+cmp #125, r4
+L59: prn #71
+add L112, r6
+prn *r0
+m3
+L60: .string "zakqilmfi"
+m0
+lea L78, r5
+stop
+L61: dec L104
+
+cmp #-209, *r2
+not L84
+m2
+bne L80
+bne *r3
+red *r1
+sub #-137, L15
+L62: sub #126, *r2
+red *r5
+prn #-78
+add L19, L81
+m3
+sub #72, r5
+m4
+L63: cmp L77, #99
+L64: .data -67
+L65: rts
+L66: rts
+L67: .string "hajcvhnzoaxz"
+not r0
+add L96, *r1
+L68: .data -211, -400, 897, 541
+
+L69: .data -796
+L70: inc L93
+cmp #-2, L33
+L71: bne *r5
+jsr L88
+jsr *r1
+mov L71, L83
+L72: prn *r5
+prn L99
+m3
+L73: .data -915, 221
+m2
+prn #-59
+L74: dec *r5
+not L94
+m1
+inc r1
+bne *r5
+inc r7
+L75: add *r2, *r2
+prn #-193
+L76: prn L87
+L77: .data -220, -708
+inc *r0
+L78: bne L41
+dec L91
+; comment
+lea L69, L56
+lea L73, L0
+
+L79: .string "dfdnulmaxamysha"
+jsr *r4
+not r7
+sub L92, *r1
+dec L17
+lea L53, L38
+L80: jmp L54
+
+L81: sub r5, r7
+L82: .data -18, -250, 361, -323, 672, -347
+jmp *r1
+L83: .data 182, -473, -400, 329, 693
+L84: stop
+cmp #212, #231
+jsr *r1
+jmp *r0
+prn #-74
+rts
+m1
+L85: cmp r6, r1
+L86: .string "xhltsvicrsnjiw"
+mov #219, *r5
+rts
+L87: mov L98, r2
+clr r1
+L88: rts
+m4
+not r1
+lea L55, *r6
+red L93
+lea L89, r5
+clr r3
+; comment
+m1
+m1
+L89: lea L56, *r6
+red *r3
+red *r2
+jsr L24
+L90: .data -768, 81, -907
+m2
+not L98
+m2
+L91: rts
+L92: bne *r4
+m4
+m1
+inc L99
+cmp L108, L114
+not L70
+rts
+L93: .string "cpdyrjjodgbfuz"
+rts
+stop
+jsr *r5
+dec r7
+rts
+L94: .string "gtqxocjjirldlyyxobgvloju"
+m3
+add L5, r4
+m2
+m1
+cmp r5, *r0
+L95: stop
+
+m3
+rts
+L96: cmp r0, *r1
+clr r3
+sub *r4, r3
+mov L19, r5
+L97: .data 788, 718, -812, -60, 256, 24
+clr r6
+m4
+L98: cmp L112, *r1
+m2
+lea L108, *r3
+m2
+; comment
+jsr L60
+red L30
+L99: dec r3
+m3
+L100: mov L107, *r5
+dec r2
+not L17
+lea L40, *r2
+red r1
+jsr L115
+m1
+stop
+red *r6
+bne L40
+L101: jsr L113
+bne L103
+m2
+clr *r6
+cmp L64, r2
+L102: .string "zviydqycmzvabf"
+dec L115
+bne *r4
+L103: .data -158, -135, 835, -732, 965, -776, 886
+L104: .data 419, 929, -308, 400, 821, 787, 978, -373
+add *r4, *r0
+m0
+cmp #239, #-253
+dec L73
+jmp L6
+cmp *r6, *r3
+m3
+m3
+add L117, r0
+bne L113
+rts
+L105: stop
+mov #-214, r1
+L106: lea L111, *r7
+add L115, *r0
+
+inc L81
+not L110
+L107: .string "ptxxrsozkipaas"
+lea L4, *r7
+L108: .string "zuvneqhfblxjpevqfvgsti"
+bne L119
+not r2
+; comment
+rts
+rts
+add *r4, *r3
+jsr L118
+rts
+sub L119, *r2
+L109: .data -707, 359, -16
+L110: stop
+L111: sub L115, L63
+prn r5
+; comment
+L112: lea L117, *r2
+sub #-23, *r7
+L113: jsr L101
+bne L81
+jsr L56
+mov L120, *r0
+bne L116
+jmp *r3
+jmp *r6
+L114: jsr *r7
+L115: .string "rfcsycpgearcmynfp"
+clr r2
+m0
+
+m1
+jmp L119
+m3
+L116: not L121
+L117: .data -380
+prn r7
+clr r1
+stop
+prn *r3
+clr r3
+jmp L121
+L118: bne L119
+L119: .data -109, -869, 425, 22, 198, -590, 373, 448
+clr *r4
+clr r7
+bne L30
+add L123, L121
+jsr *r4
+m4
+L120: .string "inqarydlsyuwjdtxv"
+cmp L82, *r5
+L121: lea L123, L122
+L122: rts
+jsr *r2
+m1
+L123: .string "yuziajrvlbywuoljzci"
+stop
@@ -0,0 +1,571 @@
+; Generated by genCorpus --seed 57
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+macr m0
+    jmp L84
+    jmp L73
+    bne L32
+    clr L56
+    jsr *r6
+    sub #83, L3
+    jmp L70
+    add r5, *r6
+    jsr *r5
+    mov *r6, L127
+endmacr
+macr m1
+    not L79
+    rts
+    lea L115, L35
+    bne L72
+    dec L18
+    lea L64, *r5
+    jsr L70
+    add *r7, r4
+    add #174, L80
+    red L78
+endmacr
+macr m2
+    cmp r4, L132
+    sub L23, L86
+    add L52, *r7
+    inc r4
+    dec r1
+    lea L35, L75
+    sub *r3, L46
+    not *r3
+    dec r3
+    stop
+endmacr
+macr m3
+    inc L69
+    clr r4
+    rts
+    sub r2, r7
+    sub *r7, *r3
+    stop
+    prn L75
+    not *r2
+    jmp L102
+    add *r1, L20
+endmacr
+macr m4
+    inc *r1
+    rts
+    red *r0
+    dec *r1
+    add r3, L118
+    bne *r6
+    red L34
+    lea L84, L66
+    prn L74
+    lea L45, *r7
+endmacr
+jmp *r3
+m0
+L0: add L33, *r2
+
+clr r1
+not *r7
+L1: cmp r7, r4
+stop
+cmp *r5, #224
+L2: prn L33
+clr L55
+dec *r4
+clr *r7
+m2
+m2
+lea L16, L1
+bne *r0
+clr r0
+L3: sub #147, r3
+m4
+L4: jsr *r4
+not *r1
+not L2
+not L96
+rts
+L5: .string "mqihmohbbxgszoi"
+cmp L10, L5
+L6: .string "bzfeixltzbi"
+jmp L0
+rts
+L7: not r3
+m4
+m3
+L8: clr r6
+m4
+m3
+jsr L3
+rts
+
+lea L8, r4
+m2
+jsr L1
+prn L2
+rts
+m0
+not r0
+L9: .data -914, 140, 326
+L10: red r3
+add r2, r3
+jsr *r6
+jsr L7
+L11: .data -991, -330, 129, 947, 448, -885, 706
+m4
+L12: .data 240, 322
+m0
+lea L74, L6
+; comment
+prn L5
+m3
+L13: dec *r1
+m1
+add r1, r7
+L14: not *r0
+m1
+L15: jsr *r3
+bne *r4
+stop
+m3
+L16: mov #235, r0
+L17: .string "xjzbnhn"
+m4
+L18: not r6
+red r5
+lea L24, *r1
+not r4
+m0
+lea L87, r2
+inc L16
+m0
+dec r1
+L19: .data -472, 558, -537, -647, 871, -201, -741
+stop
+L20: prn *r1
+L21: .string "sdkrdvllxcdidrhzudvr"
+red *r3
+clr r4
+sub r0, *r6
+L22: stop
+L23: .string "xrjgtr"
+L24: .string "rsphnnq"
+not *r7
+stop
+add #-95, r2
+m2
+; comment
+stop
+jsr L22
+m2
+m0
+L25: cmp #-120, L36
+L26: lea L11, *r6
+L27: lea L39, L130
+m3
+L28: .string "dvcpdssfl"
+not *r1
+L29: .string "dowtxfbmjvnltsm"
+mov *r2, L43
+m1
+L30: .string "ml"
+jmp L115
+add *r7, r1
+red r7
+mov #189, r6
+not L14
+lea L22, *r7
+sub r6, r7
+lea L8, r7
+cmp #39, r0
+add #25, L27
+dec r6
+L31: .string "wfkvjn"
+bne L25
+prn r1
+inc *r7
+prn r6
+prn r1
+inc r2
+cmp r1, *r2
+L32: jmp L32
+L33: add *r6, r0
+dec r2
+m3
+; comment
+not L22
+L34: .data 374, -457, -769, 425
+red L14
+sub *r3, L104
+mov #-65, *r0
+L35: .string "lxejwwuzebllqaz"
+m3
+sub *r2, L121
+dec r1
+not L96
+L36: red *r5
+L37: .string "yzxaxhpncw"
+L38: cmp L20, r0
+red L21
+jmp *r1
+jsr L19
+red r7
+L39: dec L20
+L40: .data 429, 335, 768, 249, -739, 993, -318
+m0
+m3
+
+L41: bne *r2
+L42: jmp *r6
+L43: .string "hljdxar"
+dec L43
+L44: cmp *r6, r2
+sub L2, r4
+L45: bne L26
+jsr L19
+stop
+clr r6
+clr r2
+not r0
+m3
+bne *r4
+lea L129, *r4
+m2
+jsr L43
+; comment
+L46: cmp *r6, r1
+sub *r3, L10
+
+dec *r3
+L47: bne L67
+m0
+m3
+m3
+m2
+jmp *r3
+sub r3, *r2
+rts
+stop
+lea L70, *r7
+cmp #145, #-10
+
+not r4
+lea L83, *r4
+m2
+jmp L55
+rts
+bne L46
+dec r3
+m2
+L48: .data 842, -190
+L49: add r0, *r3
+jsr *r5
+bne *r7
+add r1, *r7
+L50: .string "terazeze"
+not *r3
+L51: .data 410, -696, 906
+L52: .data 132, 372, 737
+
+jsr *r6
+red L67
+prn *r2
+L53: red L109
+jsr L83
+bne L51
+L54: .string "tazzjjisrwokhnncvhe"
+L55: .string "nbzc"
+L56: lea L72, *r7
+L57: mov *r3, *r5
+prn #5
+L58: bne *r0
+L59: .string "zoprgzoqfxslldxmauigylu"
+L60: sub r2, r4
+L61: rts
+L62: .string "uipdgier"
+L63: mov *r5, L53
+m4
+L64: .data 147, 264, -405, -197, 200, 752, 646, 917
+cmp r5, L94
+not r3
+cmp L52, #232
+m2
+not L40
+L65: .data -342, -409, -95, -881, -616, -616, -257
+m1
+inc L88
+sub r3, r2
+not r7
+L66: .string "mpbnmwzzdgsvandfrvuyycy"
+red L40
+m2
+m0
+m3
+inc L5
+L67: .string "ifmvgnpjbf"
+L68: .string "xfongyhippfkbl"
+lea L67, r0
+m3
+; comment
+m2
+rts
+jsr L15
+m4
+L69: inc r7
+L70: inc r5
+rts
+jsr L13
+not *r0
+not L72
+L71: prn r4
+m2
+
+red L85
+m3
+clr L112
+sub r5, r3
+L72: red L65
+bne L104
+L73: .string "ffvdgdc"
+rts
+clr L68
+sub *r1, *r6
+inc *r0
+red L126
+bne L74
+rts
+m0
+mov #206, r4
+L74: prn *r1
+L75: red r5
+not L95
+L76: bne *r7
+L77: clr *r5
+jsr L90
+prn *r0
+dec L9
+bne L4
+L78: .string "kacdxdwm"
+rts
+m0
+mov r7, r3
+m4
+m3
+red *r1
+bne *r2
+stop
+L79: .data -326, -355
+L80: dec *r2
+m0
+red r1
+; comment
+L81: cmp L102, L86
+m2
+dec *r4
+inc L102
+; comment
+L82: not r1
+not r4
+L83: cmp r5, L29
+m3
+jmp L86
+cmp r7, L31
+L84: .string "deggn"
+m3
+cmp #-73, L95
+m2
+red L82
+L85: .data -604, 530, 250, 532, -82, 562, -315
+; comment
+prn *r4
+clr r5
+sub *r0, r2
+L86: .string "x"
+L87: sub *r5, L62
+bne L114
+L88: jsr L120
+; comment
+m1
+lea L44, L1
+jsr L121
+not *r0
+L89: dec *r0
+inc L95
+mov r1, L132
+; comment
+m4
+jmp *r4
+not *r4
+L90: not r3
+dec r7
+L91: stop
+prn L1
+m2
+L92: bne L49
+dec r1
+stop
+add L108, r3
+stop
+L93: mov r2, *r0
+L94: red r0
+m2
+m0
+jmp *r6
+m2
+m1
+sub #220, r2
+not L111
+jmp *r5
+add L111, *r6
+L95: bne *r7
+jsr L43
+sub #211, *r7
+lea L98, r0
+add #186, r0
+m4
+L96: lea L19, *r5
+cmp L51, *r7
+m1
+L97: .string "fvhyggavikfqikjwlaxm"
+L98: stop
+mov r5, L95
+add L73, *r6
+L99: .data -61, 179, -963, -9, -743, -327
+L100: stop
+lea L119, r4
+add L47, r0
+L101: not *r2
+lea L78, *r4
+clr L112
+mov *r0, *r0
+L102: lea L107, *r7
+; comment
+inc *r6
+m2
+L103: clr *r2
+L104: .data -19, 411, 640, -371, 797, -193
+m4
+m4
+; comment
+L105: .string "ip"
+stop
+L106: .data -819, 729, 842, -920, -521, -479, 515, -374
+clr *r3
+m3
+clr L123
+cmp *r4, r6
+L107: .string "swcrmfsevygmkpy"
+jmp *r2
+jmp *r5
+m3
+L108: .data 87, 763
+bne *r5
+m0
+L109: dec *r2
+sub L120, *r4
+L110: .data -524, -315, 496, 286, 111, 871, 231, -854
+bne *r4
+rts
+rts
+prn r6
+L111: cmp r6, #-60
+; comment
+L112: red r0
+L113: .string "xguljlqppduymfpfakykeu"
+L114: add #152, *r2
+L115: add r7, L54
+mov r4, *r1
+L116: bne L118
+m4
+stop
+stop
+L117: sub L132, r2
+mov r1, L132
+m4
+clr *r4
+
+m3
+add r6, *r1
+lea L131, L133
+jsr *r0
+dec *r4
+L118: .data -422, 300, 578, -478
+stop
+m1
+m2
+red r0
+not r6
+mov L71, r0
+m0
+rts
+m1
+L119: jsr L125
+not L93
+red L131
+prn *r4
+L120: red *r6
+L121: rts
+inc *r7
+prn *r1
+m2
+m1
+not r2
+L122: .data -346, -207, 880, 892, 660, 611, -512
+jsr L58
+m3
+L123: clr L78
+L124: sub #-208, L30
+m2
+m4
+lea L130, *r3
+L125: inc L129
+L126: .string "wkgtdkqophk"
+m1
+L127: inc *r5
+m3
+L128: rts
+not r6
+cmp *r3, L132
+dec r2
+L129: .string "jupvmwqpmbkljudimmkuxugr"
+jsr L15
+m1
+prn *r5
+m0
+not r6
+not L49
+clr r4
+jmp L131
+cmp r5, L48
+; comment
+L130: red r4
+L131: dec L25
+mov L88, *r4
+sub *r3, L57
+prn L65
+jmp *r5
+L132: rts
+mov *r6, *r1
+bne *r4
+prn #-147
+; comment
+add L91, L133
+not *r3
+dec r6
+sub *r0, L34
+not *r7
+dec r7
+lea L133, r0
+m2
+lea L85, L133
+jmp *r7
+L133: .string "crxsahjy"
+stop
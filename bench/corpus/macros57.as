@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 58
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    inc *r7
+    rts
+    add r0, L6
+    rts
+    stop
+    add L57, r3
+    not L1
+    bne *r4
+    add #-199, L0
+    prn L82
+endmacr
+macr m1
+    dec *r2
+    cmp *r4, #-122
+    stop
+    rts
+    stop
+    dec L29
+    lea L12, r7
+    clr L109
+    cmp #121, #189
+    jmp *r6
+endmacr
+macr m2
+    bne L47
+    prn #241
+    rts
+    mov L50, L107
+    rts
+    clr r3
+    jmp L34
+    lea L2, L84
+    dec L9
+    prn L115
+endmacr
+macr m3
+    sub *r4, L115
+    bne *r3
+    add *r1, L101
+    cmp L69, L24
+    sub r2, *r7
+    rts
+    sub L96, *r3
+    add L44, L26
+    inc r6
+    rts
+endmacr
+macr m4
+    jsr L31
+    clr L63
+    mov #-65, L27
+    red r2
+    inc *r5
+    sub r0, *r7
+    stop
+    mov r1, *r3
+    mov r1, r7
+    cmp L59, *r1
+endmacr
+L0: sub r4, *r7
+prn #-160
+sub r3, *r7
+L1: mov #152, *r1
+dec r4
+m0
+L2: not *r4
+m1
+dec *r6
+L3: not L1
+L4: bne *r1
+L5: mov *r7, L5
+add L0, r4
+L6: .data -92, -460, 535, 295, -132, 111
+jsr L71
+L7: .data 170
+jmp *r2
+L8: sub L3, *r1
+rts
+lea L4, *r2
+m0
+inc r5
+
+L9: bne *r2
+mov r1, r2
+L10: cmp r0, #-94
+lea L51, L39
+L11: .string "djglmtokujlegymbfbt"
+lea L110, *r5
+
+lea L10, r2
+L12: rts
+prn *r7
+not L39
+dec *r5
+L13: not r5
+add *r3, L86
+prn L11
+L14: .string "tdcdqqhp"
+dec r1
+m3
+m0
+m4
+
+rts
+lea L13, r1
+stop
+sub *r6, L11
+L15: .data 781, -202, 498, -291, 536
+rts
+L16: .string "shayovwtdurarbhmztniq"
+jsr *r4
+m0
+m4
+m1
+clr r5
+stop
+m0
+dec *r3
+prn *r0
+rts
+m2
+dec L63
+L17: .data -911, 102, -104, -575, 901, -813, 466, 902
+jmp *r1
+add L5, *r2
+not *r2
+sub *r5, L10
+not r6
+m0
+jsr L14
+L18: jsr *r3
+sub L6, L13
+L19: .data -913
+rts
+L20: lea L42, r4
+L21: .string "rzptvbsdxdelejv"
+sub L14, L34
+L22: .data 377, 168, 623, 102
+red L59
+L23: .data -924, -922, 390, -249, 195, -381
+
+jsr L80
+add r2, *r7
+cmp r2, *r1
+add L8, L30
+red r6
+bne *r3
+bne *r2
+m3
+L24: cmp L10, *r7
+bne L80
+clr L9
+L25: .string "jgpnwbcsulohptujnhad"
+inc r0
+
+dec *r4
+L26: stop
+cmp #46, L53
+prn r7
+rts
+inc *r1
+m3
+; comment
+clr r7
+m3
+L27: lea L54, *r1
+; comment
+L28: mov #181, r3
+m0
+L29: stop
+red *r1
+m2
+dec L43
+m1
+L30: red *r0
+jsr *r3
+add #235, r0
+L31: .data -519, 674, -588, 991, 569
+L32: .string "eexnccronemc"
+cmp *r7, *r3
+lea L20, r3
+L33: .data 788, 122, -139, -240, 792, -231, 771
+add *r7, *r4
+L34: mov L67, r1
+L35: add r4, L78
+m3
+jmp L12
+clr *r3
+m2
+; comment
+red L54
+add #102, *r4
+bne *r6
+L36: not L80
+m1
+add r3, *r3
+L37: add *r0, r5
+L38: red *r7
+L39: jmp *r2
+jmp *r4
+cmp *r5, #65
+L40: prn *r7
+add #43, r7
+inc r5
+L41: .data -926, -990, 814, -114, -447, -806, 244
+mov r6, r0
+jmp *r1
+sub #28, r0
+stop
+L42: .data -280, -889, -690, 72, 173, -57, 24
+red L43
+; comment
+jmp L40
+L43: not L59
+L44: add L42, L26
+L45: jmp L10
+L46: .string "fckplsbhdav"
+mov r1, L70
+L47: not *r7
+bne L93
+m3
+m0
+L48: .string "rlw"
+lea L46, r1
+L49: .string "vidjfq"
+m1
+jsr *r7
+mov #-101, r4
+L50: rts
+L51: prn r4
+add r3, L8
+L52: .data -351, 291, -926, 673, 386
+m3
+not *r2
+bne *r5
+jmp L17
+jsr *r6
+stop
+m0
+L53: .data 673
+jsr L93
+lea L3, L93
+cmp #177, #185
+L54: rts
+mov L64, L100
+m3
+mov #-172, r2
+m1
+
+m0
+L55: .data -35, 894, -854, 139, -41, 930, 739, 871
+prn r0
+red L32
+m2
+jsr *r6
+L56: sub #28, L91
+
+m0
+m2
+inc L71
+m4
+mov r0, r2
+rts
+L57: cmp r6, L24
+red *r1
+sub L73, r5
+sub L18, L20
+add *r0, *r0
+clr r1
+bne L41
+prn *r1
+mov #98, L20
+red *r3
+red *r4
+red *r2
+m2
+m2
+m1
+L58: .string "awyxrinaopmrsvf"
+L59: .string "jyge"
+
+m0
+stop
+prn *r2
+m3
+jsr *r0
+bne L51
+jmp L71
+red r4
+
+bne L37
+m1
+jmp L40
+m4
+m3
+L60: .string "cktrgtx"
+lea L88, r1
+L61: .data -169
+clr r4
+lea L107, r4
+add #240, L82
+not L29
+m4
+m4
+jmp *r1
+m3
+m0
+clr L7
+m4
+m2
+lea L44, L45
+L62: red r6
+stop
+sub L78, *r6
+dec r4
+m3
+bne *r0
+prn L28
+add #184, *r6
+dec r4
+L63: red L98
+m4
+not *r5
+not r0
+m1
+clr L116
+sub r5, L49
+m2
+not *r2
+bne *r6
+L64: jsr *r2
+m1
+bne L45
+L65: not r4
+stop
+L66: cmp #209, *r4
+prn #-153
+prn L12
+m4
+dec *r3
+L67: bne *r4
+m0
+bne L84
+m1
+red *r1
+inc r7
+not L7
+sub #55, r4
+m3
+L68: rts
+; comment
+L69: .string "gsrjxofafccvz"
+L70: mov *r5, *r3
+not *r3
+mov #106, *r4
+m2
+mov L65, *r0
+sub #-109, L113
+L71: .string "hgmikbljztxm"
+red r7
+jsr L53
+red L10
+cmp r5, #-212
+clr *r2
+; comment
+m3
+L72: .data -613, -436
+inc r6
+L73: .string "yncs"
+m1
+not *r1
+not r2
+inc L88
+L74: .data -828, -193, 710, 518, -882, -993
+inc *r4
+jsr L102
+m3
+stop
+bne *r4
+L75: .data -905, 756, -137, 455, -534, 931, 45, 54
+red *r3
+bne *r6
+L76: red *r4
+L77: not L31
+bne L88
+not r2
+jsr *r2
+L78: lea L43, L115
+L79: red L114
+sub #-105, r0
+cmp r7, L113
+L80: .string "mimjayjjgnmxh"
+inc *r4
+stop
+cmp r1, #9
+L81: .data 466, -57, -198, 81, 627, -166
+prn r6
+sub *r7, L30
+red *r7
+prn r0
+dec r1
+L82: .string "tik"
+bne L99
+add *r4, *r2
+bne *r2
+; comment
+red r1
+lea L95, r5
+L83: .data 76, 170
+cmp *r3, *r7
+red L97
+dec L21
+bne L5
+inc L112
+
+L84: .data 345, -251, 130, 327, -873, -446, 26
+L85: stop
+L86: inc r2
+sub *r3, r1
+bne L57
+m2
+lea L9, r0
+red *r6
+m1
+clr L116
+inc r4
+m4
+jmp *r2
+L87: red L39
+m0
+red L82
+not *r1
+prn #-63
+mov L37, *r2
+stop
+add L34, L48
+m3
+jsr L0
+m0
+not *r6
+sub *r3, *r7
+L88: mov #-196, r2
+L89: mov *r7, L100
+
+
+sub #-45, r1
+bne L106
+L90: add L71, r7
+L91: inc L93
+rts
+lea L99, *r4
+cmp #107, L85
+L92: .data -895, -273, 934, 349, 972
+cmp r1, #13
+m0
+dec *r5
+add #188, *r0
+m3
+L93: stop
+L94: mov *r6, r1
+rts
+cmp #-53, L35
+m1
+jsr L113
+prn r6
+jsr *r4
+clr *r4
+L95: .string "ssxynr"
+stop
+rts
+bne L66
+m2
+sub *r3, r0
+L96: stop
+L97: .data 948, 215, 910
+L98: inc *r7
+m3
+sub *r4, *r2
+L99: .string "czrnpjvddbzc"
+stop
+L100: .data -125
+cmp L113, L106
+L101: sub r5, *r7
+stop
+not *r4
+lea L20, r4
+dec r7
+L102: add L114, *r3
+bne *r6
+m3
+L103: .data -649, -493, 789, -251, -906, 902, 994
+m0
+L104: jmp *r6
+L105: .string "fnafzlnj"
+bne L44
+lea L41, *r3
+add r7, L50
+red *r1
+dec L117
+dec r7
+m0
+bne L109
+L106: .string "gopkhrbjfjtmepfado"
+; comment
+dec L7
+add *r3, *r6
+m4
+red *r0
+L107: rts
+red r5
+inc L112
+jmp L0
+L108: .data -925, 422, 286, -291, 319
+sub L114, L66
+rts
+sub #216, *r7
+m3
+bne L17
+cmp L108, L107
+m3
+L109: stop
+dec r6
+rts
+add L38, *r3
+jmp L111
+stop
+m1
+
+L110: bne L115
+sub L112, L3
+not L38
+; comment
+
+L111: bne *r0
+stop
+add r7, r5
+jmp L42
+clr *r5
+L112: .data 22, 917, 153, 740, -579
+m0
+L113: .string "wjqahdviomwkpx"
+L114: dec L108
+add L117, L99
+prn L117
+lea L116, r7
+m0
+prn #-94
+stop
+dec L46
+L115: stop
+jsr *r4
+stop
+; comment
+m0
+inc r1
+add #54, L117
+L116: red L117
+L117: not r3
+mov #-241, L21
+stop
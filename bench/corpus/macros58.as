@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 59
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    inc r7
+    jsr L0
+    inc L71
+    jmp L24
+    red L17
+    sub *r2, *r2
+    add *r2, *r3
+    clr *r7
+    lea L91, L40
+    mov r3, *r5
+endmacr
+macr m1
+    jsr *r0
+    sub #251, r5
+    lea L113, L116
+    prn r3
+    add L92, r7
+    jsr L37
+    cmp *r6, r1
+    red *r7
+    add r0, *r1
+    clr *r5
+endmacr
+macr m2
+    dec L44
+    inc L13
+    cmp *r2, L68
+    stop
+    mov r4, *r4
+    dec r1
+    jsr L60
+    dec *r4
+    add *r1, L21
+    jsr *r7
+endmacr
+macr m3
+    sub r6, r1
+    prn *r1
+    rts
+    lea L4, L60
+    stop
+    clr L59
+    lea L104, *r4
+    not r7
+    add L49, L32
+    clr *r4
+endmacr
+macr m4
+    add #-133, L41
+    lea L22, r7
+    bne L94
+    stop
+    cmp #-91, r2
+    cmp #-176, *r0
+    not *r0
+    clr L51
+    jmp L16
+    sub r3, L76
+endmacr
+m2
+m4
+add r7, *r3
+not *r4
+inc L94
+bne L86
+m2
+m2
+L0: jmp *r5
+L1: jmp L109
+not L1
+m4
+add r0, r7
+lea L5, r7
+L2: sub L2, r3
+m0
+lea L39, *r1
+L3: lea L64, r0
+; comment
+jmp *r1
+prn L41
+red r5
+sub r6, r4
+jmp *r5
+L4: bne L0
+lea L1, r0
+
+sub #-5, r1
+clr L3
+lea L3, r6
+L5: .data 320, -874, -994, -945, -874, -66
+not *r0
+L6: .string "swabstxjgvquaojwc"
+jsr *r6
+m0
+inc *r5
+inc r1
+bne L103
+add *r5, r3
+lea L1, L17
+cmp r0, #-184
+rts
+m3
+L7: dec L0
+sub L2, r0
+prn *r1
+m3
+not *r4
+cmp *r4, *r5
+L8: jmp L33
+add #-114, L0
+red L91
+m4
+L9: bne *r7
+dec *r6
+rts
+dec *r5
+m2
+rts
+red *r0
+cmp *r2, #178
+m0
+L10: lea L4, r6
+L11: .string "xxaahhziibvdawr"
+L12: .string "cnhnskycdhn"
+not r5
+L13: .string "spjfhubrzxdqtqidoid"
+m1
+L14: dec r0
+L15: lea L0, *r6
+m3
+L16: jsr *r3
+rts
+inc *r6
+L17: red r3
+inc *r2
+m4
+red L12
+rts
+L18: sub r0, r4
+L19: red *r6
+lea L0, *r6
+L20: .string "cgnhv"
+rts
+mov L8, r3
+L21: stop
+jmp L31
+sub L70, *r3
+m1
+L22: not *r2
+; comment
+inc r4
+; comment
+add r3, L8
+sub L12, *r3
+L23: jsr L41
+lea L43, r7
+m2
+; comment
+L24: .string "okracbdjguyhdacsrirecq"
+L25: add L59, L29
+prn #-224
+dec *r0
+jmp *r5
+m1
+L26: .data 290
+L27: .data 745, -82, -283, 179
+add r1, *r6
+inc *r1
+m1
+add #-47, L23
+jmp L57
+bne L108
+jmp L11
+sub L76, L63
+L28: jmp *r0
+dec r5
+bne L1
+m3
+inc r7
+add *r2, r6
+L29: lea L43, L14
+rts
+mov L62, r5
+m1
+L30: jsr L7
+mov #176, r2
+add r5, r2
+prn L57
+jmp *r7
+m4
+inc L102
+m0
+m3
+m1
+mov L70, *r2
+m0
+L31: dec *r3
+not *r5
+L32: .data 704, -771, 611
+not r6
+L33: .data 474, -449, 273, -253
+dec *r7
+L34: lea L60, L13
+m0
+add r0, r1
+m2
+add *r1, r7
+L35: sub #-253, L30
+not *r2
+not L33
+L36: .string "vcrjgrebu"
+L37: add L34, r1
+bne *r7
+stop
+L38: clr L7
+add r3, L71
+m1
+red L18
+L39: inc *r5
+
+red r3
+red *r4
+L40: .string "yi"
+lea L30, *r6
+m2
+L41: .data -838
+dec r5
+m2
+jmp L58
+jsr L53
+
+add L25, r0
+m2
+m2
+mov #-205, L27
+jsr L28
+not r0
+L42: .data -900, -691, -480
+m4
+inc L11
+L43: jsr *r5
+L44: lea L20, r0
+clr L14
+rts
+jmp L20
+red r3
+not r2
+L45: bne L111
+add r4, *r4
+
+L46: .string "ioqirwgramjydcmfleed"
+stop
+m0
+L47: .string "brscztcunjgwyhf"
+not *r4
+m4
+m2
+m0
+L48: .string "pnvvyyqhss"
+m2
+sub #-113, *r5
+not r6
+lea L109, r4
+mov L5, *r4
+jsr L107
+stop
+red r5
+m0
+stop
+rts
+bne *r3
+sub *r5, r6
+not r0
+inc r4
+L49: .string "pdwgodyiogpzj"
+not L115
+L50: .string "mzuvpnpotl"
+clr L12
+cmp r1, *r0
+L51: lea L96, *r0
+jmp *r2
+prn *r2
+jmp *r7
+m0
+m3
+L52: .string "dwvuorfmjbqnfzzwowekoza"
+bne L97
+m0
+L53: .data 67, 74, -305, -455, 240, 723, -335, -972
+inc L39
+red *r7
+mov *r3, r2
+cmp *r7, L30
+stop
+lea L96, r1
+L54: sub r5, *r6
+m1
+m0
+
+bne *r7
+dec *r7
+L55: jmp *r3
+sub *r1, L45
+rts
+lea L66, r6
+clr r7
+not r2
+; comment
+L56: add *r3, L24
+rts
+prn r3
+m0
+m2
+jsr *r1
+L57: .data -431, 427, -167, -314, -475, 599
+m3
+red L81
+rts
+clr r3
+rts
+m0
+prn #-111
+sub *r1, *r7
+add L77, r6
+L58: .string "nqaezxrsialxkakm"
+lea L6, r1
+rts
+L59: .data 508, 288, 133, -866
+add L17, r6
+bne L91
+stop
+jsr *r4
+m1
+L60: dec L111
+m0
+add r5, L82
+m3
+dec r2
+L61: .string "jzspojuylkqin"
+lea L2, r0
+jsr L16
+m4
+not *r4
+inc r6
+L62: sub r5, *r0
+L63: .string "jpgcegepkkged"
+stop
+dec *r4
+L64: .string "y"
+prn *r3
+rts
+L65: mov #186, r4
+
+inc L88
+jmp L66
+jmp *r4
+m3
+; comment
+dec r5
+L66: .data 140, 373, -957, 29, -383, -278
+inc *r6
+; comment
+prn r7
+add r4, r2
+bne *r4
+lea L79, *r3
+m0
+L67: .data 391, 187, 911
+add L104, r0
+m4
+sub #116, *r7
+cmp #-45, #143
+L68: .string "lyicvpilrueebnubuvqbj"
+L69: .data -959, 807, 669, 373, -209
+m4
+mov #48, L82
+L70: not *r5
+L71: cmp r0, L34
+L72: .string "vtichvwomtowt"
+stop
+stop
+jsr L46
+jsr L38
+clr r0
+m4
+rts
+L73: .string "kyxrynwyfpfw"
+mov #28, *r0
+jmp L91
+jsr *r4
+L74: .data 639, 12, 106, 680
+clr r0
+prn *r4
+not L65
+L75: jsr *r2
+dec r7
+m3
+L76: .string "wdvvwhpdaeldqxcilqeyky"
+dec *r3
+
+L77: .data -827, -962, -745, 484, -503
+L78: .string "vqzcmtzbdzceemnyvtnskcs"
+L79: jsr *r5
+dec *r1
+m0
+prn #130
+red *r3
+add r4, L7
+bne *r0
+clr L12
+cmp *r0, L63
+bne L88
+clr r5
+clr L47
+not r6
+red L13
+rts
+prn *r7
+m4
+clr *r3
+m0
+jsr L6
+L80: stop
+bne L113
+lea L114, L101
+sub r4, *r0
+add L99, r4
+L81: prn #228
+m2
+prn *r7
+L82: jmp L7
+L83: stop
+bne L115
+stop
+mov L66, r0
+L84: .data 541, -934, -323
+; comment
+L85: .string "wdrkquqefc"
+dec L99
+m3
+
+red L90
+L86: mov *r4, L4
+; comment
+L87: inc r4
+rts
+jsr *r2
+mov *r7, r7
+clr L57
+L88: .string "wikqglznkht"
+red L108
+cmp #-24, #-65
+L89: mov r1, L116
+dec *r2
+L90: jsr L52
+m2
+jsr *r5
+m3
+m4
+stop
+L91: .data -182, 26, -618, 812, 673, -185, -919, -884
+prn #-29
+m2
+cmp L19, *r3
+L92: .data -626, -620, -823, 885, -671, -501, -430
+dec L19
+m0
+not *r1
+L93: .string "joywcahdihdxfdvigqy"
+m4
+L94: .data 908, 351, 45
+L95: mov r7, *r3
+rts
+L96: .data -979, -59, 10, 855, 126, 548, -505, -965
+L97: mov *r7, *r5
+stop
+mov #-222, L9
+dec r0
+L98: .data -241, -374, 966, 568, 108, 333, 377
+L99: .data 127, -835, -123, 727
+L100: .data -63
+clr L112
+m0
+m0
+dec L75
+L101: .string "nmvhuinghv"
+L102: rts
+jmp *r5
+not L51
+m4
+jsr L2
+inc L10
+m2
+inc L43
+stop
+mov L53, *r2
+L103: clr r1
+L104: stop
+m3
+m3
+; comment
+prn r1
+mov r5, r7
+not *r7
+m4
+cmp r0, r4
+cmp #109, r6
+prn *r3
+mov #233, L55
+jmp L107
+not L110
+L105: stop
+m1
+m1
+not r5
+m3
+
+L106: jsr *r0
+clr *r0
+L107: cmp #-1, L66
+m2
+jsr L12
+L108: jmp L14
+red *r0
+jmp L113
+sub r0, L30
+L109: .string "dqzcwcyktuehasifuk"
+not *r3
+L110: clr *r7
+rts
+stop
+m2
+L111: sub r6, L103
+jmp L116
+L112: mov *r1, L61
+jmp L26
+clr L116
+mov *r4, r3
+stop
+rts
+bne *r3
+clr *r3
+jsr *r6
+jmp *r7
+dec r3
+mov *r1, *r3
+rts
+add r5, *r4
+sub *r0, *r5
+L113: .string "cqryigtajltosssrwqs"
+cmp r3, L29
+dec L116
+L114: .string "n"
+mov *r4, *r7
+L115: jmp *r1
+red *r6
+rts
+inc L44
+L116: sub #-41, L105
+stop
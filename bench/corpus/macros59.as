@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 60
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    dec r5
+    mov L87, r3
+    jsr L30
+    stop
+    not r5
+    not r6
+    bne *r1
+    clr *r7
+    lea L94, *r6
+    prn L56
+endmacr
+macr m1
+    bne L77
+    stop
+    lea L71, *r0
+    rts
+    red r7
+    mov #-218, L77
+    add L6, r3
+    stop
+    prn L74
+    add *r1, L76
+endmacr
+macr m2
+    inc r4
+    inc r6
+    inc *r7
+    jsr *r1
+    add L21, L30
+    sub r1, *r2
+    lea L4, L27
+    rts
+    clr L66
+    not L83
+endmacr
+macr m3
+    lea L85, r2
+    clr L60
+    bne L53
+    stop
+    cmp r4, *r7
+    prn #189
+    inc r5
+    prn *r5
+    lea L14, *r2
+    not r4
+endmacr
+macr m4
+    red r0
+    add r4, *r4
+    jmp *r0
+    sub *r4, r6
+    jsr *r4
+    dec r6
+    stop
+    not r2
+    prn *r3
+    cmp #-219, L117
+endmacr
+m3
+prn *r4
+clr *r3
+dec r0
+m3
+inc r4
+m4
+L0: mov r2, L0
+m2
+m0
+dec r5
+m3
+not *r4
+bne L82
+L1: .data -136, 886
+L2: .data -943, -610, -861, -922, -36, 455, 752
+jmp *r3
+sub L75, r5
+L3: add *r1, *r0
+m2
+bne L3
+L4: dec *r0
+m4
+L5: .string "lliy"
+stop
+dec *r2
+mov r0, L2
+L6: dec L17
+L7: .string "hqwfidstguphqgqlarsstphd"
+stop
+not L61
+; comment
+; comment
+prn L4
+L8: sub L107, r1
+lea L11, L85
+m3
+clr *r7
+inc *r1
+
+L9: .data 558
+mov *r1, r1
+
+jsr L93
+m2
+jsr *r7
+bne *r5
+m0
+L10: prn r0
+cmp *r5, *r3
+jsr *r7
+add #-101, L6
+L11: sub #87, r3
+cmp *r6, #-84
+lea L23, L76
+inc L4
+jsr *r5
+L12: red r2
+m4
+jmp *r6
+jmp L38
+m1
+m4
+L13: dec L10
+jmp L114
+L14: .data 376, -726, -745, 297, -459, 298, 188
+; comment
+sub r7, L119
+jsr *r2
+L15: sub #-104, r2
+add L78, r4
+m3
+clr r3
+m4
+m2
+dec *r1
+L16: cmp #162, #22
+L17: mov L15, L10
+sub #-87, *r5
+rts
+L18: dec *r5
+m3
+inc r6
+sub r1, r2
+L19: stop
+L20: clr *r1
+
+clr *r1
+dec r1
+prn #-210
+L21: not r4
+red L0
+inc r6
+L22: sub *r2, L13
+inc *r7
+m1
+L23: jmp *r0
+jmp *r1
+
+m3
+inc L78
+cmp #168, *r0
+L24: sub #85, *r5
+L25: not *r7
+mov #0, r3
+L26: .string "gz"
+rts
+clr *r1
+jsr *r2
+dec *r5
+not L76
+jsr *r2
+not r3
+L27: jmp L67
+bne L37
+sub r3, r4
+L28: .data 19, -409, 810, 506, -48, -853
+L29: clr r6
+L30: not r7
+
+sub L11, *r1
+rts
+inc L8
+dec r3
+stop
+L31: prn *r1
+lea L22, r4
+bne L107
+cmp L34, *r3
+bne *r7
+m0
+sub r5, L81
+m1
+dec L30
+add *r7, L28
+clr L118
+m2
+not r0
+jsr L30
+stop
+stop
+clr r1
+bne L118
+L32: .string "yt"
+m2
+add r3, L6
+
+L33: add r2, *r4
+L34: .data -121, -386, 266, 875, 905, 948
+red r6
+mov r6, L96
+inc r5
+
+lea L23, *r0
+L35: add L99, r5
+m3
+clr r3
+cmp r0, r6
+L36: .string "lsxww"
+lea L0, r7
+m2
+L37: .data -637, 497, 891, 392, 708, 799, 930
+add #142, L44
+cmp r0, r1
+m1
+L38: .data 375
+dec *r6
+cmp r6, L30
+
+clr L18
+L39: cmp L100, r0
+jmp *r6
+jsr L82
+L40: red *r0
+L41: .data -434, 927, 276, 946, 55, -509, 389, 709
+mov r6, *r7
+
+L42: .data -401, 829
+sub r5, r0
+L43: .string "ntguujsrmstqkisyktjefu"
+dec L40
+lea L60, r1
+L44: bne *r0
+cmp *r6, *r6
+bne *r4
+m1
+inc L35
+L45: rts
+jsr L15
+m4
+dec *r6
+prn *r1
+L46: .string "xizwzzpumhgkj"
+mov #-143, *r4
+L47: not L28
+bne L14
+m3
+
+red *r0
+m1
+bne *r3
+mov r6, *r0
+sub *r2, L61
+red r4
+not L38
+jmp *r6
+bne *r4
+L48: .data -149, 275, -503, 419, -549, -624, -459
+add L91, *r5
+L49: sub *r7, *r2
+
+L50: jmp *r3
+m4
+not *r6
+add L47, *r0
+L51: .string "rzuezjtjggxmdynhdgoyprlp"
+inc *r6
+prn *r1
+m1
+sub #0, L116
+lea L64, r4
+L52: lea L3, r5
+
+jmp *r2
+m2
+m0
+L53: .string "aul"
+m0
+jsr L53
+jsr *r7
+m2
+dec L27
+clr *r6
+L54: .data -340, 56, 766, -159, 242, 597, 390, -86
+L55: .string "nk"
+prn r3
+sub *r2, r2
+inc r2
+L56: cmp L47, *r1
+dec r6
+clr L119
+L57: jmp *r0
+m2
+cmp *r3, L7
+m0
+L58: .string "smdmoxitqbsguin"
+cmp #4, #-58
+sub #-11, L1
+m4
+
+L59: clr *r4
+stop
+L60: .data 339, -495, -425, 604, -131
+bne *r3
+
+add r7, L30
+m4
+bne *r5
+m0
+dec L33
+sub #-223, L104
+cmp #-43, *r4
+m1
+L61: .string "k"
+prn *r4
+lea L20, *r2
+not L9
+m2
+L62: jmp *r7
+mov *r3, *r7
+; comment
+L63: .string "rpmqqknudo"
+lea L14, r6
+clr r3
+L64: clr L97
+; comment
+m2
+red L1
+not *r6
+L65: .data 193, 799, 160
+L66: jsr L109
+mov #-83, r1
+m3
+bne L31
+L67: jsr L36
+not *r5
+
+sub *r7, r4
+m1
+lea L113, L118
+dec r2
+red r4
+L68: clr r0
+L69: .data 608, -148, 346, 809, -558, 281, 49
+; comment
+add r4, r7
+lea L80, r4
+clr r7
+m4
+L70: .data 640, 775, 644, 706, 523
+bne L57
+L71: .data -663, 177, -838, 520
+L72: jsr *r6
+m0
+m0
+m3
+jmp *r0
+not r7
+L73: not r4
+not r3
+add #-70, r1
+m3
+sub r1, *r5
+L74: jmp L78
+mov r4, L80
+bne *r7
+red r2
+cmp L96, r0
+add L79, *r2
+rts
+jmp *r6
+L75: sub *r1, *r6
+dec r2
+prn *r3
+jsr L44
+L76: not *r2
+L77: .data 751, 952
+m2
+m0
+m1
+prn r6
+L78: rts
+L79: .string "tqkfxdzadu"
+m1
+L80: .data -492
+L81: rts
+cmp *r1, #-167
+inc L37
+inc L95
+L82: not *r3
+not *r1
+L83: rts
+clr *r4
+L84: not L109
+L85: .string "zekiazgelgqmctvt"
+red L69
+bne L43
+not *r1
+jmp *r1
+m3
+m0
+jmp *r5
+L86: dec L39
+m2
+rts
+m4
+inc L111
+m3
+prn r1
+lea L109, *r1
+rts
+cmp *r6, r4
+m3
+m0
+stop
+L87: mov r6, *r5
+L88: mov r7, *r3
+lea L88, L112
+inc r6
+m0
+sub *r7, *r0
+L89: stop
+clr L67
+m4
+clr *r5
+L90: jsr *r0
+cmp *r7, r0
+stop
+cmp #219, L95
+stop
+L91: lea L100, *r0
+dec r3
+lea L42, L118
+sub r7, *r4
+rts
+L92: .data 182, 984, -969, 164, -69, -121
+inc r1
+sub r3, *r7
+bne L99
+cmp *r4, #-69
+m1
+L93: lea L7, L99
+L94: .data 329, -532
+sub #-141, L51
+stop
+red *r0
+lea L32, L107
+L95: mov #245, L86
+not r6
+m1
+m3
+L96: .data -26, -849, 948, 425, 791, 281
+L97: prn #194
+jmp L115
+sub #238, *r2
+L98: clr r2
+bne L48
+add r5, L40
+add *r4, L56
+L99: cmp r6, #-185
+red *r7
+
+not L101
+m0
+L100: .data -417, 623, 914, 608, 77, 555
+not r6
+jsr L40
+not *r2
+m1
+L101: .string "zfbexzbuozehhjfdlvhdus"
+not r4
+mov r2, *r5
+inc L111
+add r5, r7
+jsr *r1
+L102: mov L106, r2
+sub #-246, L102
+m1
+L103: lea L94, r5
+lea L29, r4
+jsr *r0
+bne L71
+clr L108
+L104: jmp L45
+
+sub *r3, *r1
+sub *r4, r0
+lea L119, L59
+L105: prn #-96
+add *r3, *r1
+m1
+L106: .string "txwzzb"
+L107: mov r3, *r0
+L108: .string "ndqqucnozsw"
+L109: prn *r2
+; comment
+jmp L110
+L110: red *r2
+L111: jmp L11
+not *r3
+L112: stop
+rts
+stop
+cmp *r2, *r3
+red r4
+L113: stop
+rts
+m1
+prn *r0
+mov #253, r2
+; comment
+red r0
+not r7
+add r2, *r5
+not *r5
+m3
+cmp L114, #-99
+inc L39
+dec L58
+cmp r6, L18
+cmp #181, r4
+m4
+m0
+
+bne L118
+stop
+L114: cmp r4, L116
+clr *r6
+m4
+L115: .data 113, -740, 572
+L116: sub #-155, r6
+sub *r3, r6
+not r6
+L117: .data 614, -941, 443, -940, -649, 289, -374
+dec r5
+add L72, r2
+jmp L119
+m4
+m4
+L118: inc *r1
+lea L119, L109
+; comment
+cmp *r1, *r1
+stop
+mov r7, *r4
+; comment
+m4
+bne *r2
+prn L119
+L119: stop
+stop
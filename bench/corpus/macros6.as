@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 7
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    clr r2
+    sub r6, *r5
+    sub L63, L70
+    sub *r7, L5
+    not *r4
+    red L3
+    jmp L41
+    not *r4
+    lea L99, *r3
+    sub L16, r1
+endmacr
+macr m1
+    clr r1
+    stop
+    rts
+    sub #222, *r4
+    mov r6, *r1
+    mov *r1, L96
+    red L82
+    dec L84
+    mov L61, L62
+    not *r0
+endmacr
+macr m2
+    mov #-196, r4
+    red L76
+    prn r0
+    sub r6, L37
+    mov #-58, r3
+    jsr L81
+    bne *r1
+    bne *r2
+    red L64
+    red r5
+endmacr
+macr m3
+    jsr *r3
+    not L37
+    rts
+    jsr L15
+    clr L105
+    prn r1
+    prn *r2
+    add *r1, *r1
+    jsr *r3
+    stop
+endmacr
+macr m4
+    cmp L66, #-244
+    prn *r2
+    bne L34
+    sub *r3, r3
+    dec L46
+    rts
+    lea L13, r5
+    clr *r6
+    add r7, L79
+    sub #-144, L53
+endmacr
+m3
+mov *r7, L93
+clr r4
+L0: stop
+jsr L19
+red *r6
+
+m1
+L1: stop
+m3
+L2: jsr L33
+m1
+add *r0, *r1
+L3: .string "kkefpaeogihtztil"
+L4: .string "omhoikqhtmamoewcdpmsz"
+add *r0, r2
+dec L53
+prn #46
+jmp *r7
+clr L80
+m3
+clr r0
+not L2
+m2
+m2
+bne L26
+L5: .string "yepdorvbp"
+m3
+L6: .data 272, -527, -630, 106, 534, -187
+m0
+rts
+m4
+add r7, r2
+jsr *r1
+L7: .data 575, -998
+prn #-70
+inc r2
+m3
+inc L4
+L8: jmp L59
+m1
+rts
+bne L1
+lea L67, *r7
+jmp *r2
+sub #-14, L6
+not *r7
+jsr *r7
+stop
+
+cmp #-252, #-97
+sub r5, *r0
+L9: lea L0, *r3
+jmp *r7
+sub L33, L6
+jmp L98
+L10: lea L0, L0
+L11: stop
+m1
+; comment
+m3
+m3
+clr *r2
+clr L105
+cmp r4, #79
+sub #-34, L14
+m2
+L12: bne L8
+L13: not L41
+L14: sub *r5, r6
+L15: .string "kmru"
+not L6
+prn r5
+m2
+L16: bne *r7
+L17: .string "diomupuutaujlliytlvonqrc"
+
+m2
+m3
+red r4
+stop
+lea L12, L14
+
+m1
+prn r3
+m1
+L18: lea L7, L15
+add *r5, *r1
+prn r5
+m2
+L19: stop
+inc L17
+stop
+sub r6, r6
+clr r2
+L20: not r5
+red r2
+m0
+m1
+m2
+m0
+; comment
+clr r6
+jmp *r1
+jmp L87
+stop
+sub #4, r3
+jsr *r0
+L21: bne L22
+m4
+sub #104, *r7
+L22: .string "ecokdb"
+L23: .string "eu"
+L24: .data 507, 427, -164, 471, -657
+sub *r1, *r0
+jmp L2
+stop
+m3
+red L4
+lea L6, r3
+L25: .string "gzaplhnvajhckjemm"
+jmp L61
+sub L4, *r1
+L26: bne *r4
+not L56
+stop
+cmp *r1, L82
+lea L60, *r0
+L27: .string "iqrdsptqzngvgbt"
+L28: bne *r1
+m1
+stop
+not L63
+L29: .data -639, 595, 980, 919
+; comment
+L30: .string "yxxrd"
+rts
+lea L86, L34
+m4
+m0
+prn #-99
+cmp L58, r0
+L31: jsr L43
+jsr L84
+cmp r6, #-216
+L32: inc L67
+m1
+L33: not L46
+m3
+not *r2
+lea L7, *r5
+sub r5, r7
+sub *r6, *r2
+dec L19
+jsr L79
+m0
+add #-189, r0
+red L44
+cmp L10, #87
+inc r3
+stop
+L34: .data -115
+mov #-122, L23
+lea L46, r4
+prn *r4
+m3
+rts
+m1
+cmp *r5, L0
+m3
+L35: not L17
+L36: not *r0
+jmp *r7
+m1
+add *r4, r1
+m4
+sub *r7, L22
+rts
+m2
+L37: .string "funbtqykckqgbu"
+inc r0
+m2
+m0
+inc L17
+red r0
+sub *r0, r7
+stop
+L38: jmp L27
+mov L42, L52
+L39: dec r4
+L40: rts
+m1
+m4
+mov r0, *r6
+dec *r4
+L41: .string "gdhknewlugzu"
+
+L42: .data 586
+jmp *r1
+inc L101
+red r6
+L43: stop
+sub #-246, r7
+m2
+
+lea L83, *r3
+L44: add r6, L99
+add #-168, *r1
+L45: jsr L60
+lea L42, r3
+not L56
+m4
+jmp *r7
+clr L37
+jmp *r1
+sub L87, r2
+jsr L34
+prn r4
+prn r7
+sub #-12, L6
+jmp L43
+inc L39
+add #228, L16
+mov #249, r6
+prn r6
+jmp L21
+clr r2
+jmp *r6
+add *r3, *r5
+jsr L81
+cmp #-66, r1
+L46: jsr L79
+cmp #126, r2
+m0
+red L26
+prn #232
+L47: jsr *r2
+dec *r5
+red r0
+cmp #-134, #253
+inc r3
+m2
+L48: .data 81, -682, 579, 438, 136, -240, 482, 387
+red L8
+m4
+; comment
+L49: .string "ofoqoc"
+
+clr *r7
+m3
+add r3, r0
+m2
+L50: .string "kaxdp"
+
+bne *r0
+m3
+L51: add #95, *r7
+jsr *r2
+not L13
+L52: .string "deodpsuzfda"
+stop
+L53: .data -47, 756, 402, 796
+m3
+stop
+L54: mov L63, r4
+rts
+clr L35
+m0
+not *r3
+L55: .data -339, -805
+m1
+inc r0
+lea L18, r4
+cmp L22, #170
+stop
+m2
+prn *r4
+L56: jmp L39
+clr r7
+mov *r0, *r3
+prn r6
+prn r6
+stop
+jmp L3
+L57: sub #55, r3
+stop
+cmp r0, #-147
+L58: red r6
+L59: .string "icgkrlyrgrdsqjacvqjnxpy"
+mov L51, *r6
+L60: .string "wvlslwslvmrobivwezehve"
+prn L63
+prn *r2
+clr r2
+rts
+m1
+mov *r6, *r7
+cmp r7, *r4
+L61: bne *r5
+L62: .data 789, -389, 215
+dec *r3
+inc L84
+jsr L46
+bne L88
+L63: lea L54, L91
+L64: jmp *r0
+rts
+clr r0
+lea L45, L39
+jmp L48
+L65: .data -487, 899, 684, 356, -288
+m2
+; comment
+jsr *r1
+prn L0
+m1
+L66: stop
+m4
+prn r0
+m0
+stop
+m2
+m4
+sub *r5, L31
+mov r2, *r1
+m3
+mov r4, *r1
+red *r4
+L67: clr r3
+stop
+rts
+jmp *r7
+L68: lea L6, r0
+m1
+bne *r5
+not L47
+L69: .data 521, 305, 242, 655, -728, 603, -146, -209
+clr r2
+rts
+add *r2, L50
+bne L12
+L70: .data -18, -908, 897, 403, 197, -951
+
+bne L80
+L71: stop
+L72: clr L3
+L73: .data -505, -846, 828, 26
+stop
+L74: .string "rekirgedvxz"
+; comment
+cmp r2, L48
+L75: .data 430, -478, -363, 508, -525, 746
+rts
+not L47
+sub #26, r6
+L76: jsr *r1
+L77: bne L96
+; comment
+cmp r2, L107
+
+m1
+m4
+jmp L107
+L78: clr L71
+jsr L103
+stop
+m0
+
+L79: .string "lscflbqh"
+m3
+L80: cmp L83, r4
+L81: sub *r4, *r2
+bne L75
+L82: .data -879, -298, 655, 698, 791, 539, -418, -31
+L83: dec *r2
+L84: inc L93
+rts
+lea L92, L104
+m1
+m4
+L85: .data -841
+cmp #212, #252
+; comment
+jsr *r4
+m1
+m3
+m4
+L86: .data -374
+not r4
+L87: .data -705, -45, 881, -165, -111, 694, -511
+red L85
+sub r4, r5
+jsr *r6
+inc L87
+rts
+m2
+rts
+jsr L14
+inc r7
+clr r1
+m0
+not L60
+m3
+m3
+L88: .string "mupxalisekkqdeiw"
+dec L103
+L89: dec *r1
+L90: rts
+m3
+cmp r5, r3
+m2
+stop
+L91: .string "uvyfutni"
+L92: .data 611, 142, -164, -855, -895, 578, -109
+jmp L19
+mov L77, L69
+clr *r0
+bne L93
+m3
+inc r1
+red *r6
+m2
+L93: .data 595, -465, -533, 604, 466, 481, -161
+lea L97, r7
+prn *r5
+not *r5
+m2
+prn r3
+rts
+L94: not L84
+clr L25
+rts
+jsr *r4
+not L40
+not L100
+lea L22, L97
+lea L95, r0
+L95: .data 81, 764, 750
+lea L21, *r2
+
+m4
+L96: red *r2
+m4
+L97: .string "dhfvkojvgsisymcvtdmllun"
+not *r0
+rts
+inc L105
+m1
+add L104, L14
+prn *r4
+clr r0
+m4
+L98: jsr L105
+red r7
+m0
+stop
+
+L99: rts
+m4
+lea L96, r5
+L100: jmp L1
+prn L102
+m4
+dec L107
+L101: inc L9
+; comment
+add r4, L106
+dec r2
+jsr *r5
+L102: lea L78, *r6
+m3
+
+bne L106
+red *r5
+add r5, r2
+red L57
+dec *r6
+L103: .string "nsgsfxzokhvkbqie"
+L104: stop
+cmp #187, *r1
+add L105, r3
+m1
+lea L107, r5
+prn r4
+not *r4
+prn *r5
+sub L21, r0
+m1
+L105: mov r4, r7
+clr r4
+red r5
+m3
+
+L106: jsr L107
+dec *r2
+mov *r4, r7
+sub *r4, L39
+L107: lea L12, r4
+sub *r7, *r6
+stop
+stop
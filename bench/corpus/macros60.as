@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 61
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    bne *r3
+    lea L66, *r3
+    inc L69
+    add L104, *r6
+    rts
+    add *r3, *r5
+    red r6
+    bne *r3
+    prn r1
+    sub #61, *r5
+endmacr
+macr m1
+    mov #-76, r7
+    bne *r3
+    lea L94, *r1
+    stop
+    add L99, *r7
+    add r0, r3
+    add *r5, r3
+    inc r6
+    not r7
+    prn *r7
+endmacr
+macr m2
+    red L108
+    lea L89, *r5
+    sub *r1, *r6
+    bne *r4
+    inc L72
+    cmp *r7, #-33
+    prn #223
+    add *r6, *r4
+    jmp L115
+    lea L33, r0
+endmacr
+macr m3
+    clr r1
+    cmp L106, L75
+    not r2
+    stop
+    clr *r0
+    lea L29, r4
+    prn *r4
+    cmp L1, L46
+    mov #-149, *r3
+    prn #6
+endmacr
+macr m4
+    bne L14
+    not L64
+    not r3
+    jsr L59
+    lea L111, r2
+    bne *r5
+    mov r0, *r1
+    stop
+    bne *r6
+    stop
+endmacr
+bne *r3
+m1
+prn *r1
+red L1
+m2
+
+dec r0
+cmp *r6, L42
+L0: .string "hw"
+stop
+sub r2, L0
+stop
+L1: cmp *r1, #-189
+stop
+m0
+not *r2
+not *r4
+red r3
+jmp *r1
+cmp *r6, r0
+sub L0, r7
+m3
+mov r7, L1
+L2: .data -258, -584, -693
+m4
+m2
+L3: red r7
+prn L91
+not *r1
+; comment
+m2
+clr r5
+mov L3, r2
+L4: clr *r7
+sub *r3, r6
+rts
+bne L47
+L5: .data 776, -922, 767, 744, -646, -576
+m1
+; comment
+sub *r4, *r7
+bne *r0
+dec L5
+m1
+L6: .data 861, -153, -691
+stop
+dec L2
+not L1
+prn r3
+not r7
+rts
+
+m2
+m0
+jsr L4
+add *r3, *r3
+; comment
+L7: lea L7, L2
+; comment
+jmp L4
+jsr *r7
+stop
+
+; comment
+jsr *r5
+m2
+m2
+clr *r2
+dec r4
+m3
+L8: sub *r7, r1
+dec r0
+lea L7, r7
+L9: .string "mmex"
+m0
+bne *r6
+cmp #43, r5
+L10: .data 930, 926, -487, -135, -801, -265
+bne *r4
+L11: .data 37, 519, -503, -616
+L12: mov L4, r0
+cmp r2, L112
+add r6, *r1
+bne L108
+sub *r5, *r6
+m3
+m4
+L13: red r1
+
+L14: .string "ghfegykdducnrygtlsvrndwu"
+jmp *r7
+mov r0, r2
+jsr L5
+jmp L83
+L15: not L78
+L16: .string "p"
+cmp L31, L9
+cmp L2, r1
+prn r1
+jmp *r5
+stop
+mov L4, r4
+L17: prn L2
+mov #178, r4
+m4
+dec r1
+
+; comment
+jsr *r6
+m0
+m3
+stop
+prn L29
+L18: stop
+jmp L67
+add #199, *r5
+sub *r7, *r2
+add *r6, L107
+jmp *r2
+L19: jmp L12
+mov *r0, r3
+L20: inc r3
+L21: inc *r2
+add #-207, *r2
+jmp L16
+red r0
+m0
+dec *r2
+
+mov #-218, L1
+L22: .data 995, -749
+cmp #-86, r3
+jmp *r1
+red r2
+lea L32, L59
+inc L7
+inc *r7
+L23: mov L99, *r1
+; comment
+m2
+L24: .string "bntjusrnfhdrukdewthjud"
+bne *r4
+L25: .string "tjexgcopuxwag"
+L26: .string "heclwkhqjcf"
+red L29
+jsr *r5
+; comment
+add r0, r4
+L27: inc L3
+prn r5
+L28: add r6, *r7
+L29: cmp #-239, r3
+L30: .string "hikdngbixwsiaswotzfs"
+dec L99
+rts
+inc *r3
+L31: inc *r0
+inc L41
+cmp L82, r0
+
+stop
+L32: .string "wcn"
+L33: lea L71, *r1
+rts
+L34: .data -198, -946, 800, 777, 926, -229
+jmp L0
+dec L18
+prn L65
+dec *r6
+L35: add #-103, r2
+L36: red r7
+L37: clr *r2
+
+m1
+add #237, L13
+not *r0
+L38: jmp *r2
+m0
+bne L43
+stop
+cmp #26, #-160
+L39: prn *r1
+m1
+L40: bne L12
+lea L10, L41
+inc L6
+m1
+not r0
+; comment
+cmp L33, L61
+m0
+stop
+L41: rts
+L42: add r5, r3
+L43: prn r2
+rts
+m2
+m4
+L44: .string "crvnaixpyvjwy"
+lea L44, r2
+m0
+bne *r1
+m1
+add #1, r5
+stop
+m3
+jmp L28
+L45: sub #-95, r7
+m2
+L46: not L97
+L47: inc L101
+L48: rts
+sub L56, r6
+not r5
+sub *r3, *r2
+red r0
+bne *r5
+rts
+bne L28
+m2
+L49: prn L111
+not *r7
+m0
+jsr *r4
+L50: mov *r4, L61
+red L10
+L51: .data 885, -642, -685, 716, -955, -654
+L52: .data -708, 214, 58
+jmp L56
+cmp *r7, *r4
+m3
+
+bne *r6
+add r2, r4
+L53: .data -600, 715, -890, 494, 794, -952, 976
+red *r1
+rts
+L54: lea L30, r3
+jsr L80
+L55: .data -254, -720, 736, -562, -898, 148
+sub #218, L66
+stop
+add *r3, r1
+inc L93
+cmp r0, #-157
+L56: prn r1
+dec *r7
+mov r3, L24
+jsr L87
+mov #59, *r6
+L57: inc *r0
+rts
+m1
+red r0
+; comment
+cmp L23, L110
+L58: rts
+clr *r1
+
+cmp *r2, #-90
+; comment
+cmp r5, r4
+L59: .data -288, -833, -582, -74, 241
+m2
+jmp *r0
+L60: clr *r5
+L61: .string "edtmoho"
+; comment
+mov L113, r6
+cmp L38, #14
+L62: .data 20, 942, 47, 834, 487
+red *r1
+m2
+m4
+jmp *r6
+sub #-203, r0
+m1
+L63: not *r0
+L64: cmp r2, r2
+L65: sub L70, L74
+L66: .data 65, 577
+inc r3
+not *r4
+L67: .data 710, 411, -413, 763, -204
+jmp L114
+mov #-228, *r2
+L68: rts
+; comment
+cmp *r0, #-15
+m2
+m4
+jsr *r6
+L69: rts
+; comment
+clr *r3
+jmp L18
+jmp L23
+prn #75
+jmp L40
+add L102, L90
+clr *r6
+L70: lea L16, *r4
+L71: .string "rudffajsoopjxp"
+L72: .data 447, 251, -671
+L73: mov *r0, *r3
+jsr L76
+m1
+jsr L30
+inc r4
+dec L79
+clr r5
+m1
+inc r1
+m3
+m0
+red r7
+m1
+jsr *r2
+m2
+red L64
+rts
+m3
+red *r7
+prn L42
+L74: jsr L106
+m0
+sub L86, L72
+jmp L72
+L75: .data -881, 606, -150, -545, -526, 758
+prn L65
+bne *r7
+L76: cmp #-159, *r1
+L77: cmp r2, #112
+lea L92, *r3
+stop
+cmp r6, *r1
+inc *r3
+m3
+m1
+add #-38, *r7
+m3
+inc *r4
+mov #92, r3
+L78: add r4, r5
+sub #121, *r4
+clr L9
+L79: .data -742, -53, -29, -16, -357, -16, 822
+red r6
+bne *r7
+L80: .string "rjbhfvuqghrbjf"
+not r6
+m1
+m4
+dec r5
+sub r3, *r6
+m3
+L81: .string "kptukbaaxc"
+m0
+m3
+not *r6
+rts
+L82: .string "bbzowptj"
+L83: not r6
+clr *r2
+L84: .data 731, -39, 289, -177, -729, 500
+prn L109
+rts
+L85: jmp L10
+L86: jmp L99
+m3
+add #76, L107
+m2
+m3
+dec *r6
+dec *r5
+mov *r2, L96
+m2
+rts
+lea L40, r5
+L87: .string "jyxyuwylazxny"
+not L63
+L88: cmp r5, L26
+L89: red L91
+m2
+mov *r7, r5
+L90: cmp *r2, r3
+bne *r2
+L91: not r6
+add #165, r2
+m4
+m2
+; comment
+lea L98, *r1
+m0
+L92: .data -996, 281, -566, 557, 907, 407
+red *r6
+m2
+; comment
+rts
+stop
+; comment
+m3
+cmp *r6, r7
+L93: .data -729, -763, -621, -400
+bne L9
+red *r1
+jsr *r6
+m2
+m2
+m0
+red r5
+m2
+m1
+m3
+L94: .string "kptraocrdjsgl"
+L95: .data 891, 646, 553, -227
+m0
+L96: .string "rjtxgamhevceyoktnu"
+L97: .string "phzyp"
+add #47, r1
+m2
+lea L105, *r6
+stop
+clr r1
+stop
+jmp *r7
+L98: bne L37
+lea L65, *r6
+m3
+cmp r4, r1
+dec r6
+m1
+L99: dec L111
+L100: mov #-240, *r4
+add L109, L30
+m2
+L101: .string "jlxiydwmmno"
+add L72, r7
+m3
+cmp #19, L110
+not *r3
+stop
+m1
+L102: .string "aizhcvhxwrjxaswpkocu"
+red *r0
+L103: not r7
+dec L53
+m3
+jsr L67
+m4
+L104: .string "skcmnwjpbtzbp"
+L105: not *r1
+L106: add L73, *r2
+jsr L86
+stop
+clr r0
+lea L109, *r2
+L107: .data -89, 902, 834, -402, -21
+m1
+L108: sub *r0, r0
+m1
+not L29
+sub *r3, r6
+L109: inc *r2
+jsr *r7
+lea L31, r5
+add r4, *r0
+cmp *r6, *r3
+lea L33, *r3
+m3
+m0
+cmp r6, L114
+jsr L1
+sub r0, L113
+L110: bne *r2
+stop
+m4
+inc *r3
+L111: .string "knmmkf"
+m0
+; comment
+not *r7
+L112: .data -4, -163
+inc r5
+add *r6, *r7
+jmp L114
+jmp L113
+L113: dec r4
+L114: inc r6
+m2
+dec *r4
+rts
+m3
+m3
+
+rts
+; comment
+L115: add r0, *r6
+prn *r7
+add *r7, L24
+stop
@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 62
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    jmp *r4
+    cmp r3, L48
+    prn *r7
+    stop
+    cmp L76, #-189
+    rts
+    jmp *r6
+    rts
+    add #-75, *r2
+    lea L8, r3
+endmacr
+macr m1
+    red r1
+    inc r4
+    add r6, *r5
+    inc r4
+    add r2, r3
+    not r1
+    red r7
+    prn #-247
+    bne L7
+    prn #-85
+endmacr
+macr m2
+    prn *r5
+    cmp r3, L19
+    red r4
+    lea L94, L56
+    stop
+    mov *r0, L8
+    dec L90
+    inc L0
+    lea L72, *r5
+    jmp L84
+endmacr
+macr m3
+    stop
+    clr r6
+    add #184, L26
+    stop
+    stop
+    add *r3, r4
+    jmp L81
+    red *r7
+    bne L53
+    sub #233, *r3
+endmacr
+macr m4
+    rts
+    jsr *r1
+    red *r2
+    add #-50, *r2
+    add #111, L57
+    sub r1, L69
+    not L16
+    inc *r3
+    cmp L32, r2
+    inc L50
+endmacr
+L0: .data 303, -544, -664, 42, 408
+prn #238
+L1: jmp L1
+m4
+prn #-77
+mov r5, L7
+cmp L0, *r1
+L2: .data -390, 500, -174, -28
+; comment
+jmp *r4
+lea L2, L32
+m0
+stop
+bne L10
+sub *r3, r5
+clr L0
+jsr L2
+L3: not L3
+m1
+bne L7
+m0
+clr L47
+red r7
+add L3, r7
+cmp *r3, #4
+inc L1
+cmp r5, r6
+L4: .string "ulkrc"
+prn #132
+not r5
+add r5, *r7
+sub r1, r6
+not r3
+cmp r2, #147
+red L2
+; comment
+L5: jsr *r4
+m2
+L6: stop
+lea L1, L48
+mov #-81, L62
+L7: .string "oytrezdelrnynqox"
+inc *r4
+stop
+m4
+m4
+L8: inc r4
+stop
+mov r1, L3
+L9: .data -559, 350, -394, -695, -9, -854, 574
+; comment
+sub #-201, r5
+m4
+mov *r0, *r4
+stop
+dec r7
+clr L4
+cmp #-204, r2
+cmp L88, L1
+L10: inc r4
+m3
+clr r0
+L11: .data 529
+clr r4
+jsr *r2
+mov r2, L10
+cmp L10, #-169
+L12: .string "mrx"
+rts
+L13: dec L13
+stop
+m4
+L14: stop
+dec *r1
+clr L74
+dec r1
+rts
+m1
+L15: .string "umcvpfqebdchnbpzandemqd"
+sub r7, *r5
+bne *r6
+prn L59
+rts
+cmp *r5, #167
+m0
+prn #5
+L16: rts
+bne *r3
+jmp *r0
+m3
+bne *r0
+rts
+L17: .string "gohk"
+cmp *r0, #127
+m2
+sub L47, *r7
+
+L18: .string "aecjyviwkbhedhyabpdfxhj"
+m3
+bne L5
+not L13
+
+L19: .data -674, -216, -581
+stop
+rts
+rts
+inc r3
+L20: .data 753, -717, -618, -729
+L21: .data 291, -815, 807, -202, -724, 62, -184
+lea L19, L66
+sub *r4, r2
+; comment
+red L21
+bne *r0
+m1
+L22: cmp #111, *r3
+bne L3
+L23: dec *r2
+jmp *r7
+sub #116, L67
+; comment
+m2
+clr *r6
+L24: jsr *r7
+L25: bne L38
+L26: jmp L19
+stop
+m4
+add #12, r7
+red r1
+add L69, L52
+sub r5, L20
+sub r3, r2
+L27: mov r7, r3
+sub r2, r1
+m2
+stop
+m2
+L28: dec r4
+not L93
+bne *r2
+L29: jmp *r0
+rts
+sub *r2, r7
+mov r1, L29
+prn L87
+m0
+inc L95
+not *r5
+not r2
+L30: jmp *r7
+
+red *r1
+L31: sub r0, r3
+m1
+L32: sub r4, *r2
+inc r3
+lea L41, r7
+L33: inc *r3
+m2
+dec *r5
+clr L30
+L34: mov r0, *r1
+dec L60
+jmp L75
+m4
+L35: .string "iqcqziwninfgswuenhe"
+L36: .data -336, -10, 144, -681, 95, 717, -649
+
+inc L97
+red *r1
+L37: .data -610, -585, -188, 933
+mov *r1, r4
+clr r2
+L38: lea L68, r4
+dec L1
+clr *r1
+mov #19, r6
+inc L35
+
+bne *r6
+mov L32, *r0
+; comment
+m3
+clr L24
+add r1, L7
+lea L22, *r1
+L39: .string "mtgmpoetribqdtldebfub"
+stop
+stop
+m2
+not L79
+m3
+m0
+add #-120, r7
+m3
+L40: .data -113, -597, 225, 397, 666, 898, -824, 226
+L41: .string "rabvbczgtumzrlfrfzyx"
+L42: .data -635, -706, -336
+L43: .data -978, 155, 168, 924, 167
+L44: .string "rkoml"
+prn L20
+bne L44
+lea L19, L13
+mov #-249, r5
+lea L71, *r4
+m3
+rts
+L45: clr L57
+stop
+inc L56
+mov L79, r1
+stop
+clr *r1
+m0
+L46: .string "nyrhuxovqamgctoyoml"
+jsr *r2
+lea L97, L29
+clr L94
+; comment
+stop
+dec r6
+jmp L89
+m2
+jsr L68
+
+bne *r2
+
+not r5
+dec *r5
+m0
+lea L4, *r7
+L47: stop
+rts
+L48: add r0, L62
+prn L18
+red L73
+mov *r5, *r0
+add L63, L96
+
+inc L5
+not *r6
+not L33
+m0
+rts
+stop
+m1
+L49: cmp #213, L55
+L50: prn *r2
+m3
+prn r7
+inc r1
+L51: jsr *r6
+jsr *r5
+red *r5
+L52: lea L16, *r2
+stop
+clr r3
+m1
+inc *r2
+mov #127, r1
+add #33, L54
+inc L82
+bne L48
+m3
+L53: .data -275, -701, 46, -913, 574, 630, 710, 824
+L54: .data -817, -491, 81, -413, -323
+cmp *r1, *r4
+red *r2
+L55: .string "ledynnahkhwhclozeeptlm"
+m0
+bne L61
+m1
+L56: clr *r7
+mov #-136, *r6
+dec *r1
+jsr L9
+L57: red r7
+L58: lea L84, *r3
+jsr L73
+m2
+m1
+prn *r4
+mov L8, L6
+L59: red r0
+m4
+bne *r3
+red L90
+not L65
+sub *r3, r5
+bne *r1
+clr *r6
+L60: not *r2
+inc *r1
+cmp #-192, *r7
+jsr *r2
+inc r6
+
+not *r3
+L61: .string "jqpwz"
+clr r0
+L62: .data -545, 375, 949, -15
+m1
+sub #245, r1
+stop
+m3
+m4
+mov *r6, r5
+jsr *r6
+clr r2
+dec r4
+add #221, r5
+bne L74
+add #175, r4
+jsr *r2
+m4
+L63: .string "invckzweoczao"
+not r1
+m1
+rts
+L64: jsr *r3
+clr *r5
+jsr L75
+L65: jmp *r5
+sub L44, r0
+L66: red r5
+bne L58
+m0
+add r7, *r5
+jmp L96
+inc r1
+sub r0, L50
+inc L45
+inc L26
+red L4
+inc r7
+L67: bne L34
+L68: .string "djahtqwhkykizvjol"
+clr L0
+not L84
+clr r6
+m1
+bne L92
+
+m3
+m1
+not L77
+bne *r5
+m1
+m0
+not L88
+stop
+sub *r4, L92
+not L95
+dec *r6
+mov r3, L74
+m1
+m2
+rts
+mov #9, L85
+m2
+
+lea L20, *r5
+inc L26
+jsr L94
+lea L95, L95
+add r0, r3
+red r2
+
+rts
+m1
+L69: rts
+m0
+L70: rts
+red r6
+L71: inc *r5
+L72: stop
+cmp *r5, L17
+cmp *r4, L73
+L73: sub *r5, L20
+rts
+prn r6
+add #104, *r3
+L74: sub L89, *r4
+prn *r6
+red r1
+sub r6, r4
+; comment
+sub r1, r6
+L75: .string "smhdovzo"
+rts
+jsr L15
+L76: mov r1, *r7
+sub #-51, L92
+stop
+not r0
+
+sub #253, r0
+L77: add #143, r4
+stop
+lea L48, r4
+inc r4
+sub #70, *r2
+inc L19
+prn #-9
+add #222, L74
+m3
+L78: .data -423
+m3
+add r1, *r1
+cmp r6, r3
+clr *r2
+jsr *r3
+m3
+jmp L12
+L79: .data 412, 916, -895, 759, 827
+L80: .data 766, 680, -2, 286, 617, 975, 844
+jsr *r0
+sub L65, L85
+bne L84
+jsr L88
+prn L51
+mov #214, L56
+L81: rts
+sub #-71, L68
+jmp L41
+m0
+m1
+bne L30
+L82: .data 766, 762, 36, -4, 268, 538, 607
+m4
+L83: .data 482, 903, 913, 349, -504, -386, -94
+m3
+bne *r4
+cmp *r5, L80
+dec r6
+stop
+rts
+not r4
+cmp L89, *r7
+jsr *r3
+prn *r7
+add *r3, r3
+bne L34
+m2
+rts
+clr L32
+m4
+jmp L91
+prn #18
+
+add #134, r7
+bne *r6
+dec L96
+L84: .string "gfbnkjkwq"
+L85: not r3
+m1
+add r3, *r1
+sub L93, *r4
+; comment
+clr r6
+mov *r3, *r1
+stop
+stop
+dec r7
+; comment
+m3
+prn L92
+m2
+rts
+red *r5
+m3
+L86: prn L1
+prn r0
+not L84
+inc *r4
+m4
+L87: jsr L90
+L88: lea L91, *r1
+L89: .string "cy"
+L90: .string "ikojdwigufvkwrchutcoqpyi"
+m4
+lea L0, r3
+L91: .data -97, -780, -446
+prn #120
+dec L92
+dec L21
+L92: jmp *r2
+sub L28, L93
+L93: red L1
+not *r2
+L94: .data 920, -271, 163, -761, -119, 405
+L95: dec r6
+cmp #-116, #-70
+L96: red L97
+prn L97
+jsr *r0
+L97: add #252, r4
+m3
+
+stop
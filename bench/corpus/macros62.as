@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 63
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    bne *r0
+    dec L80
+    rts
+    stop
+    red *r4
+    stop
+    jsr L100
+    sub *r2, *r6
+    stop
+    jmp L25
+endmacr
+macr m1
+    mov #-197, L47
+    prn #-200
+    rts
+    jsr *r5
+    red *r6
+    add r5, L81
+    jmp L70
+    not L37
+    prn r2
+    mov L78, r2
+endmacr
+macr m2
+    stop
+    not r5
+    stop
+    bne *r1
+    mov *r7, L97
+    dec r5
+    clr L2
+    inc L93
+    not L18
+    prn L39
+endmacr
+macr m3
+    sub r4, L67
+    inc r6
+    lea L112, r0
+    jmp *r0
+    dec *r0
+    add L81, r0
+    stop
+    jmp L13
+    inc *r7
+    bne L36
+endmacr
+macr m4
+    clr L27
+    mov *r5, *r6
+    stop
+    jsr *r4
+    rts
+    add #45, L54
+    cmp L38, #-197
+    rts
+    lea L48, L63
+    lea L51, r0
+endmacr
+L0: mov *r3, L73
+clr *r4
+m0
+L1: .data -450, 358
+L2: .data 741, -431, -582, -299, 98, 90, 130
+m0
+not *r6
+bne L0
+m0
+m0
+prn L87
+L3: jsr *r3
+L4: .string "xrxhjpzzofiojuwzbdzu"
+not *r0
+add #-173, r3
+mov #17, *r4
+jsr *r5
+red r4
+
+L5: prn #231
+jsr *r7
+add *r1, L4
+L6: .string "cshwbvv"
+add *r5, L1
+L7: prn L3
+red *r7
+mov L0, r0
+clr r0
+
+m2
+stop
+L8: inc *r3
+m1
+red L1
+m1
+inc *r3
+clr *r2
+inc *r0
+lea L19, L23
+m3
+L9: .data -870, -260
+dec *r7
+L10: .data 841, -764, 987, -296, 266, -847
+L11: jmp *r6
+m0
+prn #214
+jmp *r6
+L12: .string "jrbgfimrbc"
+m4
+sub L108, L8
+jsr *r2
+m1
+bne L94
+lea L29, *r6
+mov L7, *r4
+m0
+clr *r6
+L13: jmp *r6
+lea L65, L52
+red L31
+bne *r3
+jmp L11
+rts
+jmp *r4
+L14: .string "kyqcbuxwom"
+red r2
+rts
+L15: .data -311
+m4
+m0
+lea L8, r0
+m4
+L16: dec r0
+jmp L46
+
+; comment
+add *r2, r3
+m0
+
+L17: .data 447, 314
+m2
+m2
+L18: .string "jsdc"
+add r5, L6
+m2
+jmp L8
+lea L3, *r1
+L19: mov r2, *r4
+inc L110
+jsr L56
+mov *r3, r2
+m1
+L20: inc *r0
+lea L5, *r4
+jsr *r5
+m0
+dec L3
+jmp *r4
+clr *r2
+prn #-50
+inc *r4
+sub r7, L19
+m2
+rts
+jsr L29
+red L5
+sub *r4, L71
+L21: prn *r2
+bne L0
+jsr *r6
+m0
+mov #-233, r6
+
+mov L106, *r3
+inc r2
+L22: jsr L10
+L23: .string "rsnueqxxaepmnts"
+L24: rts
+m4
+clr *r7
+L25: not L93
+mov L91, L9
+mov *r6, L32
+m3
+sub *r1, L12
+jmp *r7
+rts
+inc r3
+m0
+L26: .string "xwaryktenehtzvbmda"
+red *r4
+L27: .string "z"
+red *r2
+m3
+
+m2
+mov L69, r2
+m0
+rts
+L28: stop
+add #-247, r4
+m4
+red r0
+mov r7, *r3
+mov #-237, *r7
+m3
+dec r4
+rts
+L29: .data 459, 407, -912, -892, -508
+jsr *r7
+bne L3
+m3
+bne L38
+add r5, *r1
+dec L18
+L30: inc r5
+lea L24, L67
+L31: rts
+lea L11, *r2
+stop
+rts
+clr *r5
+jmp *r6
+L32: stop
+dec L8
+sub L29, *r3
+; comment
+jmp *r3
+not r7
+L33: .string "eetcdserslfuubaqys"
+prn L15
+m0
+not r6
+clr L82
+m4
+stop
+jmp *r6
+jsr L2
+L34: .data 164, 937, 53, 277, -807, -573
+bne L4
+m2
+m1
+not r1
+jmp L30
+L35: dec L66
+inc *r0
+L36: jmp *r1
+lea L93, r7
+bne L103
+stop
+prn *r3
+L37: .string "useorionbwoabswmmvcnqln"
+m4
+dec L26
+L38: cmp r6, L30
+mov r2, r3
+m1
+dec *r5
+; comment
+mov L20, L2
+L39: .string "qspifxxctf"
+mov #-68, L82
+L40: .data 333, -931, -171, 43, 318
+lea L44, *r4
+L41: jmp *r1
+dec *r4
+m1
+L42: .string "svygcyjxbp"
+m3
+jsr *r7
+m0
+L43: .string "rfe"
+not L106
+not *r7
+red r6
+L44: add r7, *r2
+red L88
+cmp *r0, L91
+m0
+mov *r5, r5
+L45: clr L66
+lea L58, r4
+clr L38
+
+L46: .string "bykcujqykyfuqopcg"
+add r4, *r0
+cmp #-30, r7
+L47: red r2
+m2
+sub L19, *r2
+red r7
+dec L5
+lea L27, *r4
+sub L48, L65
+inc *r5
+stop
+add r4, r6
+m0
+L48: .data 48, 133, 679, -634, -403, 484, 980, -478
+not r5
+m2
+m0
+sub #199, *r7
+inc r5
+L49: prn r7
+L50: .string "rs"
+cmp r7, L25
+m1
+rts
+m2
+m1
+red L50
+m4
+cmp #155, L18
+jmp L57
+inc L70
+L51: prn #90
+L52: bne L17
+jsr *r5
+m2
+sub L76, *r4
+L53: clr L43
+m1
+dec r5
+not r1
+L54: lea L94, *r4
+dec L94
+m4
+mov #227, r7
+m4
+sub *r7, L33
+m0
+m0
+L55: not *r3
+mov L59, *r5
+add *r0, *r6
+L56: .string "ergwlogxyioimocrze"
+jmp *r2
+rts
+L57: rts
+L58: cmp #154, L34
+L59: cmp L35, *r5
+add #175, L109
+add #-68, *r2
+L60: .data -610, -94, -173, 360, 243, -276
+L61: inc *r0
+L62: .data 882, 579, 21, -239
+rts
+m3
+L63: inc L72
+L64: clr L20
+stop
+L65: .data -803, -490, -72
+prn r3
+mov L3, r5
+L66: stop
+stop
+cmp #-168, L68
+lea L75, L84
+sub r1, L46
+cmp L35, *r7
+add r3, r6
+m2
+L67: cmp r7, #-112
+dec L83
+jmp *r6
+L68: stop
+cmp *r0, *r7
+
+; comment
+inc *r5
+L69: red L104
+m2
+sub r5, r5
+sub L25, r3
+cmp L51, r4
+jsr L3
+m3
+sub *r3, *r4
+L70: .string "mpaniqhubmcye"
+bne *r6
+; comment
+L71: .string "qsomlljhhfxue"
+lea L47, r3
+prn L74
+L72: cmp *r6, r2
+; comment
+L73: .data 289, 454, 111, -235, 521, 676
+jmp L75
+m4
+L74: .string "ud"
+L75: .data -551, -129
+bne *r6
+mov #-162, L111
+prn L110
+L76: not L101
+L77: .data -835, 180, 578, -803
+m1
+m2
+m0
+m0
+prn #-157
+red *r6
+sub *r6, *r3
+L78: .string "rzwykoitqxczpl"
+not *r3
+L79: .string "grtwxymguo"
+L80: stop
+m1
+
+inc r0
+inc L14
+lea L51, *r5
+L81: lea L89, r4
+not L94
+dec *r3
+inc L64
+add r1, r3
+L82: rts
+mov L109, *r6
+prn *r6
+add #115, *r2
+add #-63, r4
+m2
+sub *r0, r0
+
+not r7
+jmp *r3
+add L90, *r5
+lea L95, *r0
+add *r7, r2
+stop
+mov *r0, r7
+dec r4
+dec L88
+cmp L98, L52
+m0
+L83: .string "pyzhczro"
+not *r1
+inc *r1
+L84: .data -817, 900, -199, -191, 542, 541, 343
+sub L100, L44
+sub r6, L94
+not *r4
+L85: .data 301, -98, 286, 67, -617
+m4
+bne L10
+m4
+mov L78, r2
+prn *r1
+L86: .string "wezq"
+bne *r4
+L87: .data 833, -96, -393, -456
+L88: .data -316, 831
+m2
+prn L112
+L89: prn #220
+L90: not *r6
+m4
+rts
+m4
+m4
+jmp L100
+m2
+mov r6, L33
+L91: bne *r6
+sub r0, *r0
+L92: .data -171, -562, -620, 58, 88
+cmp #95, r4
+sub *r7, *r5
+cmp L78, L65
+bne L95
+m3
+cmp #-150, *r1
+L93: rts
+lea L96, *r5
+jsr L99
+L94: mov #159, L108
+m2
+
+jmp *r1
+m2
+L95: lea L41, r0
+mov r4, r4
+bne L98
+cmp r1, *r4
+prn #-85
+not *r4
+jmp *r6
+add L11, r6
+jmp *r3
+L96: .string "pigjmqnwwkeq"
+; comment
+L97: .data -937, -301
+L98: .string "atinkiydtqbnkiqiyce"
+jmp *r2
+m3
+lea L27, *r3
+L99: jsr *r7
+dec *r5
+mov #-9, L87
+inc *r4
+not L44
+inc *r5
+L100: cmp #-34, r3
+m2
+prn *r3
+m1
+red *r4
+inc *r2
+m3
+m4
+m1
+stop
+m0
+m3
+stop
+; comment
+add L102, r1
+L101: cmp *r0, r5
+stop
+L102: .data -745, -258, -635, -764, -330, -979, -149, 671
+dec r4
+mov r2, r2
+L103: red L105
+L104: red *r0
+not *r7
+L105: inc L106
+L106: mov L111, L108
+rts
+
+m4
+L107: jsr L1
+prn L112
+m3
+L108: .string "okzcnjowzl"
+lea L109, L110
+rts
+; comment
+not L23
+add *r2, *r5
+stop
+prn *r3
+m1
+L109: prn #-156
+jsr L29
+
+
+L110: prn r6
+red *r7
+L111: .data -225, 108, 135, 571, -601, -632, -618
+lea L33, *r2
+clr r5
+stop
+not r7
+stop
+m0
+rts
+sub r2, r4
+L112: .data -671, -62
+stop
@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 64
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    dec *r2
+    red *r1
+    add *r5, *r2
+    red r6
+    cmp *r4, L64
+    stop
+    sub L60, *r7
+    prn r2
+    bne L89
+    jsr L23
+endmacr
+macr m1
+    not r1
+    jsr *r7
+    add #-104, r1
+    not r2
+    dec *r6
+    lea L104, *r2
+    rts
+    rts
+    cmp #234, r4
+    sub #-4, *r2
+endmacr
+macr m2
+    bne L111
+    inc r5
+    not r1
+    red L81
+    clr L35
+    cmp *r6, #-135
+    dec L2
+    lea L17, L61
+    bne L4
+    prn L82
+endmacr
+macr m3
+    lea L84, L72
+    lea L6, L101
+    mov r3, *r3
+    stop
+    add *r5, *r5
+    not L21
+    sub *r2, r7
+    clr r3
+    clr *r6
+    red L106
+endmacr
+macr m4
+    jsr *r5
+    rts
+    prn #-21
+    add *r7, r3
+    rts
+    sub L19, L69
+    stop
+    inc r3
+    lea L108, *r5
+    sub #-123, *r0
+endmacr
+m2
+clr *r3
+; comment
+lea L14, *r4
+bne *r2
+m0
+L0: bne L0
+dec r5
+prn r6
+m4
+clr *r6
+jsr *r1
+m0
+L1: cmp L1, *r5
+red r5
+m3
+L2: .string "vuawheyzkavbgt"
+sub r5, L2
+L3: .data 162, -237
+L4: .string "yuxfysmrivvplfrx"
+m2
+m2
+red *r0
+inc *r1
+cmp #-77, r0
+red L1
+m1
+L5: .string "zivo"
+cmp L5, *r0
+bne L5
+; comment
+sub r7, *r7
+lea L3, L103
+L6: not *r3
+inc L1
+jmp L2
+cmp L43, r4
+cmp L6, r2
+m4
+dec L23
+m4
+jmp *r2
+L7: .data -792
+L8: .data -932, -400, 183
+lea L6, *r5
+m3
+L9: .string "qtwyi"
+clr L109
+L10: .data -364, -376, -720, 540, 101, 193, -990, 73
+inc r1
+L11: .data -762, 865, -855, 970, -107, -701, -861, -699
+rts
+rts
+cmp L21, r4
+L12: dec r4
+L13: .string "posjnay"
+jsr *r0
+stop
+mov *r4, L1
+m1
+rts
+
+jsr L101
+clr *r0
+dec L76
+red L9
+not L104
+L14: .string "dpstqpezji"
+L15: .data -189, 972, 906, -787
+jsr L1
+stop
+rts
+L16: .string "olcxdhn"
+L17: rts
+L18: .data -902, -724, -250, -74, -27, -712, 64
+; comment
+mov #-174, *r7
+red r7
+
+dec *r2
+jsr *r2
+clr *r5
+stop
+jmp L35
+lea L8, r3
+m0
+add #233, r4
+m3
+L19: red r0
+L20: .data -625
+m2
+bne *r3
+L21: .data 37, -744, 373, -347
+clr L108
+add *r0, L26
+sub r6, L55
+lea L16, L14
+jsr *r4
+jmp *r0
+dec r0
+m1
+m1
+L22: prn L90
+red r4
+add r0, *r3
+L23: rts
+red r4
+mov #0, L60
+m4
+L24: .string "qszjazxmuaneowcyndx"
+m4
+red L19
+bne L46
+jsr L94
+jmp *r1
+L25: .string "nfzt"
+L26: jsr *r2
+prn *r1
+m4
+cmp #102, r3
+red *r4
+jmp *r0
+m2
+not L20
+L27: jsr L97
+m0
+jmp L16
+m0
+
+rts
+m2
+m3
+rts
+sub L9, r6
+m2
+clr r6
+inc *r4
+cmp #157, L82
+mov *r0, *r2
+dec *r4
+L28: .data -105, 843, 104, -598, -274, 469, -764, 229
+stop
+inc r7
+lea L29, *r1
+L29: .string "wuvkqoeynxl"
+L30: dec L18
+L31: dec r0
+mov r6, r5
+dec *r0
+red *r2
+L32: .data -25, -640, -412, 255, 542, 934
+rts
+L33: clr r3
+dec *r4
+m4
+jmp L0
+L34: .string "x"
+bne L32
+red L83
+jsr L59
+L35: .data -740, 348, -295, 882, -411, -546, -40
+jsr L33
+add r0, *r3
+inc r1
+red L20
+bne L83
+stop
+m3
+m1
+L36: .data -228, -317
+L37: .data -415, -352, 923, -495
+add L61, L15
+L38: .data -965
+L39: .data 967, -820, -355, 973, 767, 661, -934, -604
+bne L53
+m2
+; comment
+L40: .data 844, 106, -49, -165, -555
+red *r5
+rts
+lea L16, r7
+cmp L78, r7
+jsr L38
+lea L36, *r5
+; comment
+m2
+L41: lea L81, *r0
+; comment
+lea L3, r1
+L42: stop
+lea L43, r7
+prn r0
+prn L51
+prn r5
+; comment
+jmp L4
+prn #-8
+lea L93, *r6
+add *r5, r0
+bne L7
+cmp #106, #198
+m4
+L43: .string "kg"
+mov *r2, r4
+red r3
+cmp r4, *r4
+L44: cmp *r1, r3
+red r2
+L45: prn #75
+m1
+sub r3, *r1
+inc L57
+cmp L49, *r4
+sub *r1, *r3
+; comment
+L46: .data 799, 660, -834, -213, -392, 448
+inc L15
+L47: add *r6, L6
+prn *r3
+L48: prn L37
+L49: .string "mnjbruqht"
+dec *r0
+L50: prn #93
+stop
+L51: jsr *r3
+red L80
+cmp r1, *r4
+not r0
+inc L48
+
+L52: clr L14
+m1
+add r1, r7
+L53: .data -79, -800, -318
+jsr L60
+red L55
+L54: add #-231, *r3
+dec *r1
+red *r6
+bne L50
+rts
+mov *r5, L77
+m3
+L55: .data 380, -65
+L56: .data 804, -542, 272, 825, 918, 5, 280
+m0
+L57: .string "nkvamooklpk"
+mov r3, r6
+prn L76
+
+; comment
+; comment
+red r1
+m0
+rts
+L58: .string "ivnuskpjks"
+inc r6
+L59: .string "qdxyrf"
+red r3
+red L62
+rts
+stop
+L60: add L109, L50
+lea L24, *r6
+L61: bne L94
+jmp *r6
+L62: .data -649
+cmp *r6, L99
+m0
+L63: lea L55, r0
+rts
+m2
+L64: .data -397, 170, 619, 250, -445, 133, 482, -814
+add #-224, r3
+L65: .string "huds"
+rts
+L66: .data 268, 398, 979, -496, -609
+L67: rts
+add L51, r4
+L68: lea L110, L80
+cmp *r2, *r7
+L69: jmp *r6
+L70: .string "xjdkkz"
+inc r2
+dec *r2
+; comment
+L71: .data 966, -960
+m1
+sub *r6, r4
+m4
+add #56, L20
+m4
+m0
+jsr *r4
+red L29
+L72: .string "qzoqnoxnvigqxjyk"
+bne *r7
+inc L39
+stop
+clr *r2
+not *r1
+bne *r1
+
+sub *r3, *r0
+rts
+jsr L15
+prn *r5
+; comment
+m2
+m3
+not r1
+L73: .data 30, 287, 732, 97
+not L65
+cmp #-128, L50
+clr r3
+jsr *r1
+red L59
+m0
+m4
+dec r2
+m1
+clr L27
+L74: lea L65, *r3
+stop
+add L75, *r2
+dec r4
+lea L12, r3
+stop
+m4
+m1
+bne L10
+stop
+; comment
+L75: .data -135, 249, -38, -463, 429, -633, 889, -365
+m2
+
+m3
+m0
+m4
+bne *r0
+m0
+m4
+L76: sub *r5, L70
+cmp r3, #5
+L77: .string "nokpktbaingwfevuwy"
+m3
+mov #-22, *r7
+L78: .string "eqayrul"
+stop
+; comment
+cmp #115, L49
+m4
+L79: jmp L70
+bne *r1
+L80: not r4
+L81: rts
+mov #82, L94
+stop
+jmp *r4
+L82: mov L67, *r7
+jsr L72
+inc *r4
+rts
+sub *r6, r4
+jsr *r7
+dec r1
+jsr L77
+cmp *r2, *r3
+rts
+L83: add *r1, L103
+add L11, r2
+lea L91, *r4
+jsr *r1
+sub #39, L45
+bne L50
+bne *r1
+m0
+m1
+L84: .data -446, -264
+; comment
+prn *r1
+L85: add r1, L62
+clr r1
+L86: .string "rxjchshonjxnnbokti"
+not r0
+mov L100, *r0
+m3
+jmp *r3
+L87: red L99
+m3
+L88: cmp r4, r4
+clr r6
+inc r2
+red r1
+bne L52
+m1
+L89: inc r7
+L90: .string "crznswu"
+m3
+L91: .string "jicpmdntpumyrcjd"
+mov r5, *r3
+L92: jsr L108
+L93: prn #-61
+lea L103, r3
+red L111
+prn *r1
+L94: clr r1
+L95: dec L105
+; comment
+clr *r4
+m1
+jmp L107
+m0
+lea L88, *r4
+rts
+rts
+rts
+prn r5
+L96: .string "auhpusrpundnuxe"
+red L4
+inc *r3
+rts
+clr r7
+L97: .string "icxzyattdjaprovhnxi"
+bne *r7
+m2
+clr r3
+
+rts
+bne *r2
+L98: stop
+jmp L112
+L99: add r0, *r6
+jsr L54
+L100: add L113, L110
+m0
+L101: .string "nnc"
+L102: .data 815, 162, -337, 319
+L103: dec L106
+L104: .string "zkessjapkkdcwywokfdphwc"
+L105: .string "rdfvifxpxaqpivfmybunz"
+not L113
+stop
+L106: sub #240, L109
+m2
+bne *r7
+L107: cmp L113, L108
+prn #-27
+m1
+bne *r2
+L108: .string "fkstdjujppdrhzwkfvfrrc"
+clr r1
+mov #206, *r6
+red L44
+L109: .string "uzocjgls"
+clr L112
+inc r1
+jsr L110
+inc r5
+lea L111, r2
+cmp L113, #18
+not r6
+jsr *r7
+m3
+red L82
+sub r4, L85
+m3
+cmp *r0, #-17
+lea L113, L113
+jsr L113
+; comment
+add r4, *r1
+not *r4
+rts
+stop
+prn *r4
+rts
+m0
+inc L76
+m2
+; comment
+m3
+L110: .string "xagknpxmhnzxlthjbrfxbg"
+L111: .data 554
+m1
+lea L37, L113
+m3
+L112: cmp *r0, *r2
+jsr *r3
+cmp #-138, r4
+dec r3
+dec L47
+red *r6
+clr *r3
+stop
+red *r3
+jsr *r0
+clr L35
+L113: .string "lyeemlsfgjj"
+m3
+stop
@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 65
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    prn L61
+    not r7
+    rts
+    jsr L67
+    stop
+    bne L54
+    prn r6
+    stop
+    jsr *r7
+    bne *r6
+endmacr
+macr m1
+    jsr L57
+    inc *r6
+    prn *r1
+    prn #-192
+    jsr L8
+    prn *r6
+    add *r4, L41
+    cmp r6, L38
+    stop
+    jsr L40
+endmacr
+macr m2
+    sub *r6, *r2
+    clr L18
+    jmp L45
+    prn *r2
+    lea L80, L99
+    jsr *r5
+    bne L63
+    bne L101
+    bne L36
+    stop
+endmacr
+macr m3
+    mov L26, L94
+    jmp L3
+    jmp *r1
+    cmp L64, L60
+    bne *r5
+    bne L55
+    jsr *r5
+    rts
+    bne *r6
+    jsr L62
+endmacr
+macr m4
+    red r4
+    jmp *r6
+    cmp *r3, r4
+    inc r5
+    dec *r3
+    add #209, L9
+    add L15, *r4
+    not L5
+    mov *r7, L96
+    rts
+endmacr
+m4
+m3
+mov *r4, r7
+lea L39, r2
+not *r3
+m2
+add #-76, *r2
+bne L58
+cmp L5, L85
+L0: rts
+L1: stop
+jmp *r0
+prn r0
+sub *r4, *r0
+jmp L1
+m4
+L2: jmp *r0
+inc L1
+lea L0, L1
+add L1, L54
+L3: mov r7, r1
+red *r0
+bne L1
+stop
+m0
+not r4
+jmp L1
+bne *r1
+L4: sub #253, L0
+L5: add #-102, L36
+red *r5
+lea L82, r0
+m3
+red *r5
+mov #88, r7
+inc *r3
+L6: clr *r0
+cmp r7, *r0
+red L83
+L7: jmp L42
+mov #-104, *r7
+sub L6, *r4
+m3
+clr L34
+L8: .string "kdzsmzdzacpiucwj"
+prn *r7
+mov #-60, *r1
+L9: add #-254, r4
+clr r3
+L10: stop
+sub #36, r4
+add *r5, L0
+stop
+inc *r6
+bne L52
+mov r2, r1
+m4
+m4
+inc r2
+L11: dec *r1
+m3
+m2
+add r6, r2
+L12: .string "hxlldsddpdjzeb"
+not *r6
+L13: cmp *r7, L95
+cmp L75, #25
+L14: .data 984, -437
+sub #127, L2
+L15: lea L84, *r4
+red r7
+rts
+
+sub #-36, *r4
+m2
+L16: dec *r5
+m1
+stop
+m4
+jmp L52
+prn #-188
+clr *r7
+sub r2, r4
+L17: cmp L8, *r6
+clr r2
+sub #-172, r1
+L18: .string "vnrmtdcaqppqjliyxchomi"
+L19: sub #-4, L3
+bne L87
+stop
+jsr *r6
+jsr L94
+L20: bne *r6
+m2
+L21: add L0, r6
+L22: .string "ulkwddzxknwwlm"
+jsr L18
+; comment
+not *r0
+L23: red *r6
+L24: inc *r2
+m3
+m4
+L25: .string "qt"
+mov *r0, *r6
+bne L15
+clr *r2
+jsr L9
+
+rts
+rts
+rts
+L26: red *r6
+inc L95
+L27: .data 945
+dec L66
+cmp *r6, #246
+m2
+prn L90
+L28: jmp *r3
+red r4
+mov #-80, r2
+
+clr L26
+dec L68
+L29: cmp *r7, *r7
+m1
+
+add *r1, r1
+mov L24, *r4
+m1
+jsr L46
+; comment
+L30: .string "j"
+L31: sub r3, L81
+inc r6
+m4
+m3
+add L72, L7
+jmp L25
+m1
+L32: inc r1
+stop
+L33: .data 397, 449, 778, 114
+dec L44
+
+L34: lea L23, r0
+m0
+clr L9
+clr r2
+L35: .string "ucamciarh"
+L36: .data 437, 343, -707, -730, -263
+m2
+clr r2
+prn #126
+L37: inc *r5
+m2
+dec *r2
+inc L2
+
+L38: .data 888, 837, 781
+m1
+mov #-188, r6
+L39: .data -852, -895, 472, 377, -578
+L40: .string "kqwylgwrqckgzbco"
+prn #-120
+inc *r2
+L41: lea L96, r1
+lea L3, r6
+rts
+bne L8
+rts
+
+L42: .data 40, -808, -541, -638, 900, -932, 833
+inc *r7
+stop
+m2
+m3
+stop
+m0
+inc *r3
+sub r4, L64
+L43: cmp #80, #69
+bne L35
+; comment
+lea L44, L28
+m0
+L44: dec L89
+L45: stop
+dec *r1
+mov #204, r3
+m2
+m2
+L46: .data -681, -357, 42
+bne *r1
+L47: .data -558, -502, 141, -903
+m1
+cmp *r6, r0
+dec *r1
+red L26
+m3
+L48: sub L9, L79
+m3
+L49: .data -41, 399, 749, -112, 318
+inc L98
+dec r6
+L50: .data -853, 219, -104, 815, 564, 95, -791
+add *r3, L7
+not *r2
+prn #188
+L51: .data 784, -744, -271
+red r0
+m0
+m4
+L52: mov r5, *r5
+jmp L61
+m1
+red *r4
+clr r2
+m4
+L53: rts
+L54: jsr L45
+sub L3, *r6
+not L59
+lea L6, r3
+add #-57, L94
+jsr L16
+dec L2
+jmp *r3
+m4
+lea L65, *r2
+L55: stop
+not r1
+lea L78, *r0
+mov #240, *r4
+lea L85, *r2
+rts
+m2
+inc L58
+jmp L96
+L56: sub #210, *r0
+
+m3
+lea L57, L66
+rts
+stop
+inc L46
+
+; comment
+m0
+prn r0
+rts
+L57: add #198, *r0
+L58: jmp *r0
+jsr L86
+m4
+mov r2, r3
+L59: sub #50, r6
+bne *r2
+m0
+L60: .data 632, -963
+L61: inc *r7
+m3
+not *r3
+dec L98
+add L96, *r7
+m3
+cmp r6, L23
+rts
+add r4, *r2
+lea L38, r2
+clr L78
+L62: .string "nuwrgr"
+red r4
+; comment
+prn L2
+prn r4
+L63: lea L70, L74
+red *r4
+sub L67, *r4
+stop
+cmp L73, *r5
+red *r1
+m2
+prn r1
+prn #-244
+m1
+m2
+red *r1
+jsr *r6
+sub L88, *r5
+inc r6
+red *r4
+stop
+m1
+dec L95
+m0
+stop
+clr r2
+L64: .data 563, 80, -482, -85, -586, 589
+not L14
+bne *r1
+red r0
+rts
+m2
+; comment
+prn #-5
+mov r1, L14
+mov L95, L97
+inc *r3
+stop
+
+clr L76
+add *r2, r6
+m1
+jmp L94
+red L79
+add r4, r2
+stop
+L65: .string "adndfagivwnzdismke"
+add #-237, L92
+stop
+L66: jmp L50
+dec L74
+mov *r2, r0
+rts
+inc L98
+m0
+red r3
+
+m0
+L67: .string "d"
+sub L28, L8
+m3
+m0
+m2
+mov L33, L88
+L68: clr L41
+L69: dec r0
+m0
+; comment
+mov #44, r7
+bne L91
+
+L70: .string "rojqbs"
+L71: inc r0
+L72: .string "cfdrapdzcmhwgrqy"
+bne *r0
+rts
+L73: .string "usngoatltywzgpd"
+prn #178
+L74: .string "deteeqmxoudxamxprmrgafv"
+rts
+L75: add *r5, r4
+m4
+jsr *r3
+stop
+stop
+m2
+rts
+mov L98, *r7
+add *r2, L53
+m4
+dec r7
+red r3
+mov r1, *r2
+jsr *r6
+prn r4
+L76: bne *r2
+clr L93
+bne *r4
+not *r3
+lea L36, *r5
+cmp r7, r3
+L77: red L85
+L78: .string "exjjvkawwudznlukyr"
+sub *r3, L45
+sub L64, r4
+L79: rts
+clr r7
+dec *r4
+m3
+rts
+m2
+L80: .data 821, -118, -136, -680
+L81: mov r5, r1
+bne L66
+jsr L70
+cmp L79, #80
+L82: stop
+; comment
+; comment
+prn L12
+sub #-171, r5
+m3
+jsr *r6
+jsr *r7
+rts
+L83: sub #-142, *r7
+L84: jsr L86
+L85: .data 906, 554, 276, 527, -7
+jmp *r5
+; comment
+dec r0
+jmp *r1
+sub #122, r0
+m3
+sub L89, *r2
+sub #-50, r5
+m2
+L86: add #-196, r6
+prn *r4
+inc r5
+L87: .string "ecbiuifftfbrqy"
+jsr *r3
+not r4
+dec L18
+rts
+L88: red *r4
+L89: lea L92, L102
+L90: rts
+m0
+clr *r4
+L91: dec *r0
+add r6, *r4
+rts
+jmp *r5
+m0
+bne L96
+L92: .data 779
+bne *r4
+stop
+lea L98, *r7
+dec *r4
+inc *r2
+m3
+m2
+dec r3
+m3
+m0
+L93: .string "ccqtvxiurvobl"
+inc r0
+L94: bne L98
+
+m4
+stop
+dec *r2
+L95: clr L96
+rts
+sub r5, r7
+m3
+dec L101
+L96: prn *r4
+dec L30
+m4
+cmp r2, *r2
+inc r1
+rts
+L97: .data 240, 375, -425, -715
+lea L102, r5
+bne L41
+not L98
+m3
+m1
+lea L83, L28
+m2
+stop
+L98: .data 972, 648
+m1
+
+rts
+m4
+inc *r6
+L99: sub r5, r1
+L100: inc r5
+L101: cmp *r5, L102
+cmp #-82, #-75
+m2
+add #131, L102
+lea L17, L102
+cmp r5, *r5
+m0
+red r4
+cmp L92, #24
+jmp L13
+m2
+L102: .string "ytodfvbme"
+jmp L93
+cmp *r5, r0
+prn r4
+m1
+m2
+m0
+; comment
+m4
+stop
+
+m2
+; comment
+m3
+stop
@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 66
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    jmp *r2
+    inc r2
+    jsr L55
+    inc *r0
+    bne *r6
+    rts
+    jsr *r7
+    sub #-139, L12
+    jsr *r6
+    not *r6
+endmacr
+macr m1
+    mov #195, r3
+    dec *r2
+    red L86
+    inc L97
+    inc *r4
+    bne L115
+    red *r7
+    prn L10
+    stop
+    red *r6
+endmacr
+macr m2
+    clr r5
+    clr *r5
+    rts
+    add r3, L11
+    sub L22, r4
+    cmp r7, #-247
+    clr L111
+    rts
+    red r7
+    cmp *r3, #-101
+endmacr
+macr m3
+    sub L63, L97
+    dec L31
+    stop
+    jsr *r1
+    jmp L80
+    stop
+    jsr L88
+    mov r6, *r3
+    dec r7
+    rts
+endmacr
+macr m4
+    mov L12, *r4
+    clr *r6
+    prn #169
+    cmp r4, #27
+    prn #130
+    cmp L105, *r4
+    dec r5
+    lea L3, L112
+    stop
+    red L65
+endmacr
+dec r6
+m4
+
+m3
+bne *r6
+L0: .data -124, 820, -700, 38, -422, 658, 994
+stop
+mov #-253, L0
+m2
+not *r4
+add #53, r0
+L1: mov r2, L0
+m4
+lea L33, *r2
+L2: jsr L26
+m0
+L3: clr *r1
+red r7
+cmp r6, *r2
+dec r3
+; comment
+lea L66, L1
+dec L98
+add *r1, r0
+L4: .data 306, 867, 507, 949, 717, -283, -847
+jsr L2
+m2
+sub #-113, L2
+m2
+sub *r1, L22
+bne *r6
+m1
+
+L5: lea L99, r7
+cmp r4, r3
+m3
+cmp r3, *r4
+mov #-65, *r7
+not r0
+
+red r6
+mov r3, L4
+sub L16, L0
+stop
+L6: add #-37, r2
+inc L73
+bne L20
+L7: add r4, r7
+L8: bne L35
+inc r2
+cmp #135, *r6
+lea L90, r3
+L9: add r4, r5
+not L9
+L10: cmp *r1, #37
+inc *r2
+m4
+prn r1
+prn L4
+cmp L12, #209
+L11: cmp *r2, L0
+not *r5
+L12: rts
+stop
+L13: .string "apev"
+add #67, r6
+rts
+m2
+L14: bne L3
+stop
+m4
+not r5
+L15: stop
+m1
+L16: lea L2, L14
+add #22, *r6
+L17: add *r0, *r2
+m3
+L18: .string "qmyryurtmdlcuikobrakt"
+red r2
+rts
+mov *r3, *r7
+
+clr r1
+dec L18
+; comment
+sub *r3, L18
+bne *r6
+L19: lea L2, *r1
+; comment
+jsr *r4
+mov #-206, r4
+L20: add L14, L76
+lea L103, *r3
+not *r3
+rts
+add r0, *r0
+L21: .data 380, 176, 17, 266, -168, 564, -49
+L22: clr *r2
+L23: .data 983, 296
+mov *r0, r7
+
+prn L112
+L24: bne L99
+L25: rts
+L26: prn L28
+mov *r6, *r7
+sub L2, *r5
+sub #-203, *r1
+bne *r3
+L27: jsr *r4
+L28: .data 817, 934
+m2
+L29: .data -746, 199, -749, -477, 919, 749, -372, -741
+m0
+stop
+sub #-166, L13
+m3
+L30: dec *r3
+rts
+m4
+red L16
+L31: jsr L5
+bne L56
+jmp *r4
+bne L3
+lea L69, *r2
+mov r2, *r0
+clr *r4
+lea L61, L27
+m3
+m3
+prn *r2
+stop
+cmp *r0, r4
+mov *r7, *r6
+mov r4, r3
+L32: .string "teijxgzw"
+sub #-175, *r1
+L33: .data 253, -956, -806, 39, 125, -131, -799, 281
+rts
+m2
+not L42
+sub *r7, L95
+dec L41
+
+dec *r6
+L34: inc r2
+dec *r1
+add r4, L17
+dec *r4
+L35: .string "jlslsvawekzvwllertu"
+L36: prn L25
+m3
+L37: bne *r5
+red L57
+dec *r5
+L38: .string "ijocjqutlgngjgt"
+cmp #-101, *r3
+L39: prn *r1
+m1
+L40: inc r5
+lea L54, r4
+L41: .string "fgafovsvoeklcyynoqzd"
+L42: jsr L71
+; comment
+inc r0
+m3
+; comment
+; comment
+jmp *r3
+stop
+clr *r2
+mov *r3, *r6
+inc r0
+red *r0
+dec *r1
+jmp *r7
+L43: add L57, r4
+stop
+L44: add #86, L63
+L45: stop
+dec r5
+L46: add *r2, *r7
+stop
+L47: stop
+mov r0, *r5
+m2
+L48: .string "jldgj"
+m2
+red *r1
+stop
+mov L5, L28
+prn L31
+sub *r2, *r5
+
+m4
+sub #-194, L84
+m3
+prn L60
+lea L44, *r5
+stop
+not L118
+lea L6, *r6
+L49: cmp L34, #-51
+L50: jsr L68
+L51: not *r0
+jmp L65
+lea L30, L12
+red *r1
+jsr *r0
+jmp *r7
+m1
+prn #193
+bne *r1
+red L33
+jsr L45
+jsr *r1
+m2
+L52: cmp L64, r5
+sub *r0, *r7
+jsr *r4
+sub r5, *r1
+
+jmp L44
+lea L21, L95
+clr L90
+prn L49
+m1
+inc r1
+lea L1, L111
+jmp *r7
+jmp L75
+clr *r6
+not *r1
+L53: cmp #144, *r5
+red L104
+m0
+m0
+inc *r0
+m0
+L54: .string "loquinwxmiuwkfab"
+L55: red *r3
+L56: bne L103
+prn r4
+dec r2
+L57: .data -735, 143, -356, 645, -206, 139, 880
+cmp r4, r3
+stop
+L58: clr r0
+L59: .string "txitaqfkvvwruiniozwij"
+lea L103, *r5
+bne L43
+
+rts
+jmp L111
+m3
+stop
+L60: sub r2, *r4
+bne *r6
+L61: .string "hvkcjyerwaiqbej"
+
+; comment
+m2
+L62: cmp *r6, L61
+L63: inc r3
+m1
+bne *r0
+rts
+stop
+m0
+m4
+L64: .string "amiwwqqmhnonvemmtr"
+m0
+
+lea L2, r6
+bne L3
+red *r0
+clr *r2
+add #-69, L0
+m0
+not r4
+red r0
+L65: clr L21
+m2
+; comment
+m1
+m3
+jsr *r3
+jsr *r4
+not *r7
+
+; comment
+not L0
+not L118
+L66: .data 467, 105, 691, 814, -265, -737
+; comment
+; comment
+not L42
+rts
+stop
+L67: cmp L30, *r6
+dec r6
+m0
+bne L11
+L68: .string "uo"
+m2
+L69: red *r1
+rts
+clr r5
+sub r7, *r3
+m2
+jmp L80
+dec *r6
+L70: .string "eixsjtaelmtsqbffsa"
+L71: .string "rujycachpbitsxkpb"
+L72: dec r6
+L73: lea L32, *r2
+cmp r7, *r2
+L74: not *r2
+m4
+m3
+sub *r3, L99
+m2
+L75: bne *r7
+m3
+mov #-143, *r5
+prn #-212
+L76: cmp *r5, *r4
+L77: .string "evaisnbmspqbuo"
+L78: clr *r3
+L79: .string "f"
+L80: sub *r2, L117
+L81: .data 54, -422, -176, 853, 377
+; comment
+inc r3
+m4
+L82: .data -402, 628, -919, 183
+L83: clr L50
+inc L75
+L84: dec r4
+not r0
+rts
+jmp *r5
+clr r0
+red *r7
+L85: inc *r3
+L86: inc L87
+clr r6
+red *r6
+m4
+clr *r6
+m0
+L87: jsr *r3
+m4
+m3
+m2
+prn *r2
+prn r3
+m4
+L88: sub #189, L95
+L89: cmp r5, r2
+m3
+m3
+m0
+not r7
+
+L90: jmp *r5
+m3
+L91: add #32, *r2
+add #94, *r7
+dec *r3
+L92: inc r2
+sub *r2, L107
+add r4, r7
+; comment
+m1
+bne *r3
+not r6
+
+L93: inc r4
+m2
+m1
+bne L39
+inc r1
+m4
+m4
+L94: .string "fubgpeuuhyj"
+m3
+not *r4
+inc *r1
+rts
+sub r0, r3
+prn #-24
+stop
+m1
+bne *r7
+inc r1
+L95: cmp r6, *r6
+L96: lea L109, *r5
+L97: add #11, *r6
+L98: .string "lrjl"
+add L41, L103
+jmp L105
+L99: rts
+L100: lea L111, r3
+L101: .data -738, -208, 299, 883
+cmp #-131, r1
+prn #-7
+cmp #253, r2
+
+inc *r6
+add #123, r3
+L102: rts
+stop
+L103: .string "mlxd"
+L104: .string "ksoqeanvhyngfo"
+stop
+add r3, *r2
+L105: .string "bykzdl"
+L106: .string "tnstvusgweogzerbn"
+add L32, L92
+
+
+clr r6
+L107: .data 365, -742, -980, -865, -81
+; comment
+prn #-185
+mov r4, r0
+inc L114
+; comment
+m2
+L108: prn *r2
+m2
+jsr L116
+lea L110, L100
+m4
+jsr L18
+add #-216, r4
+L109: dec L91
+clr r6
+; comment
+lea L46, r5
+prn #-233
+m1
+not L118
+prn *r7
+m3
+stop
+m1
+m0
+jsr L119
+not r7
+cmp *r4, L119
+L110: .string "mbioqbzkmr"
+not *r7
+L111: cmp L93, r5
+L112: .string "lovztsamjmcueiaw"
+red L114
+mov #45, *r1
+mov *r1, L84
+stop
+m2
+L113: add L117, *r2
+cmp *r4, #185
+bne *r0
+add #-249, *r0
+
+m0
+L114: .string "advdczjwxbnytr"
+bne *r5
+dec *r4
+lea L106, L118
+cmp r2, L30
+clr r0
+dec *r1
+L115: .data 462
+bne *r5
+L116: red L119
+m2
+m3
+L117: .data 84
+lea L119, L119
+add r0, r1
+rts
+not L118
+m1
+stop
+dec r4
+L118: lea L69, r1
+rts
+m4
+clr *r7
+inc *r1
+rts
+m1
+cmp L119, r7
+jmp *r7
+red *r3
+L119: dec L83
+stop
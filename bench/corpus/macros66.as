@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 67
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    bne L82
+    prn #-23
+    clr L92
+    add *r0, r3
+    rts
+    jsr *r4
+    dec L86
+    rts
+    dec *r3
+    clr *r5
+endmacr
+macr m1
+    jmp *r1
+    sub *r1, *r0
+    dec r7
+    cmp r0, L75
+    cmp *r5, #-172
+    stop
+    rts
+    sub *r6, r1
+    dec *r0
+    red r6
+endmacr
+macr m2
+    jsr L22
+    red r6
+    dec L73
+    prn #111
+    stop
+    jsr L108
+    lea L2, *r2
+    not L112
+    add #221, r3
+    sub *r6, r6
+endmacr
+macr m3
+    add *r6, r2
+    red r4
+    clr *r0
+    mov L126, r7
+    prn r1
+    inc L37
+    inc L21
+    prn L80
+    lea L20, r2
+    jmp *r1
+endmacr
+macr m4
+    jsr L124
+    dec *r6
+    mov *r1, r3
+    not *r5
+    dec r7
+    prn #-99
+    dec r0
+    bne *r2
+    jsr *r4
+    not L96
+endmacr
+mov #30, L122
+prn L60
+bne L59
+red *r6
+lea L75, r1
+add r5, r3
+m3
+prn *r2
+jmp L29
+dec L50
+; comment
+m0
+m2
+prn *r0
+L0: lea L98, *r7
+m2
+sub r1, *r2
+bne L92
+L1: .string "rz"
+L2: .string "gghldgcwef"
+jsr *r2
+L3: not *r0
+cmp #171, r0
+jsr L10
+L4: .string "vzjmkiz"
+red r6
+clr r5
+m0
+m4
+L5: .string "tbmez"
+L6: red *r0
+not r7
+mov L4, r7
+L7: inc L1
+jmp L74
+bne *r4
+L8: .data 445, -770, -913, -215, -715, -496, -971, 947
+bne *r7
+L9: bne L0
+m0
+clr L43
+L10: .string "tlcnxswbi"
+L11: .data 523, 965, 68
+prn r2
+L12: .string "oiumxz"
+jsr *r3
+red r2
+L13: .string "qtdnzxovffrm"
+m0
+add L9, r7
+mov L123, L53
+dec L3
+m0
+m4
+L14: .data -21, -164, 472, -715, 538, -575, -859, 834
+L15: dec *r2
+lea L12, r3
+m3
+mov *r6, r6
+stop
+mov #82, r5
+L16: clr *r5
+jmp *r1
+clr *r6
+jmp L14
+m0
+prn *r6
+L17: mov *r4, r5
+sub #-248, L38
+cmp *r3, L90
+L18: .data 283, 242, -448, 461, 856
+L19: sub r4, L13
+L20: stop
+; comment
+rts
+L21: jsr L4
+red r3
+L22: .string "xarjivuxbbkxsreman"
+L23: jmp *r2
+mov #-125, r4
+rts
+jmp *r7
+jsr *r1
+red *r7
+add #-184, r0
+inc L19
+not *r1
+m1
+m3
+m3
+red L46
+L24: bne *r0
+cmp #-145, *r6
+rts
+; comment
+L25: .string "l"
+clr r1
+inc *r2
+jsr *r4
+red L15
+jmp *r0
+sub L105, L14
+jsr L19
+L26: mov L14, *r3
+clr L104
+L27: mov *r4, L8
+prn *r2
+L28: inc r3
+L29: dec *r1
+L30: .data -610, -208, 401, 751
+jsr *r0
+sub L8, r7
+dec *r3
+bne L11
+inc r5
+stop
+m2
+not *r7
+add *r7, r5
+L31: jsr L114
+stop
+not L65
+red L77
+L32: add *r3, *r4
+L33: stop
+L34: .string "aexrfhxqhyvu"
+m4
+m1
+m1
+m0
+jmp L107
+L35: dec r0
+add r4, r0
+m2
+L36: dec r3
+m3
+m4
+prn #191
+bne L62
+; comment
+prn r3
+; comment
+; comment
+m4
+jmp L33
+m0
+L37: mov r7, L102
+lea L15, *r6
+L38: .data -581, 816, 768, 369, 50, 723, -161
+m1
+not L33
+jmp L113
+m3
+red L19
+L39: jmp *r7
+add *r2, L76
+m0
+
+m4
+red r3
+L40: .data 493, -795, -674, 977
+lea L37, r6
+L41: .data 63, 214, 135, -315
+L42: stop
+add #22, r0
+dec *r5
+m1
+m3
+L43: stop
+; comment
+sub L101, L99
+rts
+dec r2
+dec r3
+add r0, *r6
+jmp *r4
+mov *r0, r4
+m4
+prn *r5
+m4
+sub *r5, L10
+L44: rts
+L45: .data -314, -546, 45, 600, 706, -348
+jsr L40
+red *r5
+jmp *r1
+clr r6
+L46: cmp r0, L98
+L47: not L112
+L48: jmp *r1
+L49: add *r0, L32
+red r3
+bne L126
+red L80
+prn *r1
+add #151, L54
+dec L46
+L50: .string "vybsoqlmt"
+mov *r1, r6
+bne *r2
+L51: .string "upvjootimovrcvjtpg"
+mov L107, *r5
+L52: red L67
+L53: lea L28, r3
+L54: jsr *r4
+stop
+red *r7
+stop
+L55: inc *r0
+L56: inc L53
+L57: .data 53, -769, -684, 225, 728
+L58: mov r6, L112
+inc L19
+L59: .data 655
+L60: inc r4
+m0
+dec *r5
+m2
+lea L4, r6
+rts
+inc L19
+lea L16, *r1
+L61: inc L79
+; comment
+L62: prn r4
+not *r1
+jmp L18
+bne L43
+jmp L12
+clr L59
+; comment
+L63: add r3, L24
+L64: .string "ydyamx"
+m2
+prn *r6
+jmp L2
+L65: prn #32
+L66: jsr L88
+inc r0
+stop
+L67: cmp L51, *r4
+prn #-253
+L68: .string "u"
+lea L55, r6
+mov #-91, *r5
+jsr L81
+m3
+jsr *r2
+L69: prn r7
+L70: jsr L119
+jsr *r3
+L71: dec L112
+stop
+m3
+L72: mov *r0, *r1
+bne *r2
+m1
+m4
+clr *r0
+jmp L75
+red L52
+L73: .data 762, 257
+sub r7, *r2
+m0
+jmp *r5
+L74: not L36
+L75: .data -270, 573, 640, -140, 401
+dec L1
+mov r1, r6
+m1
+add *r7, L69
+clr *r5
+clr L108
+sub r7, r5
+L76: mov r2, L12
+bne *r5
+jsr *r5
+add L112, r2
+prn *r1
+rts
+
+L77: clr r3
+L78: .string "tf"
+bne *r5
+lea L104, L75
+not r3
+red r6
+mov *r1, *r4
+red L124
+; comment
+mov L21, *r6
+rts
+L79: .string "vlaged"
+mov L104, r5
+L80: inc *r7
+jsr L122
+L81: clr r7
+L82: .string "ogfendotnidvj"
+sub L21, L31
+stop
+jmp L53
+not r1
+m4
+rts
+lea L112, r3
+; comment
+mov L90, *r7
+cmp *r2, L79
+rts
+add #-233, r0
+m3
+not r1
+red r3
+red L118
+m3
+; comment
+jmp L80
+L83: .string "qvzfxc"
+bne *r2
+
+rts
+m4
+L84: .string "fymruqrtxefpywcdhppttm"
+bne *r1
+mov r2, *r3
+; comment
+red r1
+
+not L92
+jsr L25
+clr *r5
+dec *r0
+jmp L111
+L85: jmp *r1
+L86: .string "dqtkeimrltcwyhricdatm"
+m4
+bne *r0
+cmp #146, L53
+clr *r5
+bne L107
+m3
+L87: clr r5
+m3
+m3
+jmp L97
+L88: stop
+red L105
+L89: red r0
+L90: rts
+sub #184, L121
+jsr L112
+jsr *r4
+mov #103, L110
+L91: rts
+m0
+L92: mov *r7, *r4
+bne *r4
+; comment
+; comment
+L93: mov #-97, L96
+m3
+L94: bne *r5
+lea L24, r3
+lea L111, L126
+; comment
+L95: .string "fvwddlz"
+
+rts
+lea L10, r0
+L96: .string "uzfvuqkar"
+L97: .data -785, -515, -372, -947
+m2
+L98: lea L119, r3
+dec r1
+L99: cmp r4, r5
+m4
+clr *r6
+L100: .data 893, 373, -259, 587
+L101: lea L48, *r6
+L102: bne *r6
+m1
+m2
+m2
+L103: .string "cllskfjdzh"
+inc r1
+L104: cmp r3, *r3
+jmp *r5
+m4
+m3
+not L112
+; comment
+jmp L113
+; comment
+inc r4
+lea L56, L113
+rts
+L105: sub r2, L127
+m4
+m2
+m3
+add r3, *r6
+L106: rts
+lea L16, *r1
+L107: .string "puaykb"
+
+L108: .data 847, -859, 532, 436, -751, -957
+lea L122, L125
+; comment
+lea L97, r0
+jsr *r5
+bne *r0
+L109: .string "mubbbrmzeuotphrrwrdfgue"
+cmp L75, L119
+rts
+lea L101, r5
+prn r6
+L110: .string "lc"
+m0
+inc *r6
+L111: .string "esccavhsgjmzcrly"
+m3
+rts
+cmp L18, #-193
+lea L123, r7
+jmp *r1
+inc L6
+red *r5
+rts
+L112: .string "dbnvvcgqxdlqr"
+stop
+L113: bne *r2
+sub L124, *r6
+m1
+L114: bne *r0
+prn *r7
+m1
+lea L124, r7
+prn L119
+m3
+L115: jsr *r1
+red *r7
+red L55
+jsr L38
+bne *r4
+
+inc *r3
+L116: mov #-125, L121
+inc L101
+jmp *r7
+m3
+m0
+m2
+L117: .string "m"
+L118: .string "iuxlninxcpfxoepm"
+prn r4
+m0
+dec L80
+m2
+bne L49
+L119: .string "xpqkru"
+m0
+m4
+inc L78
+jmp *r7
+L120: cmp *r3, *r5
+jmp L67
+bne L123
+dec *r3
+inc r0
+mov L124, r1
+clr *r5
+L121: sub #125, L123
+mov L123, r7
+L122: cmp L126, #141
+add #77, *r6
+L123: stop
+mov L62, r3
+add L115, L124
+L124: .string "tiinqqbifd"
+dec *r6
+L125: .data 59, -358, 231, -11, 948, 749, 470, 81
+inc L126
+inc L27
+m3
+bne L3
+m2
+cmp r6, r1
+red r0
+L126: red *r7
+cmp *r4, *r1
+not r6
+m2
+L127: clr r4
+clr *r3
+m0
+clr r5
+prn r7
+jsr L2
+m3
+not r5
+stop
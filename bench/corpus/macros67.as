@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 68
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    mov #-67, L40
+    bne *r5
+    dec *r7
+    clr *r5
+    clr *r6
+    red *r2
+    red *r2
+    dec L56
+    cmp r7, #-63
+    not *r2
+endmacr
+macr m1
+    jmp *r4
+    cmp #102, *r2
+    jmp *r5
+    jmp L89
+    rts
+    inc *r7
+    prn *r5
+    mov L36, r4
+    lea L5, L11
+    bne L79
+endmacr
+macr m2
+    prn *r1
+    clr *r4
+    sub r2, *r3
+    clr L26
+    stop
+    not r1
+    add r7, L4
+    red r4
+    lea L35, L65
+    prn r1
+endmacr
+macr m3
+    jsr *r3
+    cmp L43, L26
+    red r7
+    prn *r5
+    prn L27
+    jsr L44
+    sub *r1, L103
+    not L12
+    clr r4
+    dec r6
+endmacr
+macr m4
+    red L80
+    inc L62
+    inc r6
+    stop
+    cmp r7, r5
+    not L70
+    rts
+    rts
+    dec L103
+    inc r5
+endmacr
+lea L96, *r0
+m1
+L0: stop
+m0
+L1: .string "urmudlxosbkbox"
+m4
+jsr L70
+m0
+L2: .data 373, 139, -864, 425, 663, -343, 57, 960
+m1
+L3: clr L105
+not *r5
+not r6
+add L60, L72
+prn L33
+L4: .string "im"
+bne *r3
+mov L4, *r0
+stop
+L5: .string "wigkkphr"
+L6: lea L6, r5
+L7: mov *r2, *r6
+; comment
+m3
+m1
+red L101
+m3
+rts
+clr *r2
+jmp L5
+mov L94, L1
+L8: .string "cdvtcncbfroohgvmiou"
+lea L95, L32
+cmp r5, *r2
+not L3
+m4
+lea L7, r6
+mov L7, r4
+m3
+rts
+lea L8, r6
+inc r2
+red r0
+m1
+L9: .string "eds"
+sub *r1, *r5
+lea L33, r2
+mov #42, *r5
+m4
+L10: lea L109, *r1
+bne *r1
+stop
+L11: red *r6
+m2
+dec L10
+inc *r4
+sub *r7, L78
+not L10
+dec L55
+mov L84, *r6
+clr *r0
+red *r0
+m2
+add r1, *r4
+L12: add L50, r4
+prn *r4
+not *r3
+jsr *r5
+L13: lea L21, r6
+dec r7
+m1
+L14: .data 602, -814
+add L35, *r3
+cmp r1, #111
+jsr *r5
+L15: add *r3, *r3
+stop
+m0
+m1
+m0
+m4
+stop
+L16: .string "gdgi"
+m0
+not L44
+; comment
+prn r1
+m2
+m1
+jmp L34
+lea L73, r4
+stop
+L17: stop
+cmp *r4, L20
+stop
+m3
+L18: .string "vjah"
+clr r7
+L19: not *r2
+m2
+mov r7, r2
+bne L16
+L20: dec r6
+m2
+m3
+red r1
+prn *r7
+m3
+L21: sub L0, L13
+
+jmp L103
+; comment
+m3
+L22: .string "lvdznrkqthhpndettzk"
+red L7
+L23: mov r4, r7
+m1
+L24: .string "lvqb"
+lea L86, r2
+cmp r2, #206
+bne *r2
+red L105
+m2
+clr L64
+L25: cmp L20, L56
+
+L26: bne *r4
+lea L96, *r3
+L27: jmp L58
+prn r4
+L28: stop
+clr *r6
+m3
+jsr *r0
+prn r0
+bne *r7
+m3
+m0
+rts
+m1
+inc *r0
+clr *r3
+L29: clr r6
+not *r3
+L30: .data 783
+cmp #-103, *r6
+red L18
+mov *r0, L19
+m1
+L31: bne L108
+bne *r3
+m2
+clr r7
+not L4
+L32: .data -630, -863
+L33: red *r6
+clr r0
+bne *r6
+clr r5
+m1
+L34: .data -735
+mov #177, L45
+inc *r1
+inc L32
+
+inc r6
+m0
+jsr *r3
+jsr *r5
+L35: lea L48, r1
+clr L79
+lea L64, L72
+L36: stop
+m2
+L37: .string "zdwetvgnabkexzvivqv"
+m3
+red L89
+rts
+dec r1
+L38: .data -271, -490
+m4
+L39: lea L77, L15
+L40: .data -483, 272, 671, 712, -682
+add #129, *r3
+L41: .data 512, 827, -603, -154, -690, -422
+cmp *r6, r1
+L42: .string "hklpssrlsivkbmkbxblnmxqp"
+mov *r2, L42
+L43: .data 651, -285, 230, -526
+clr L35
+mov #137, *r3
+m0
+add #227, r0
+clr *r2
+L44: .string "rp"
+jsr L72
+inc L69
+cmp r5, r4
+cmp r0, *r2
+bne *r1
+
+prn L29
+cmp L106, r2
+L45: rts
+m1
+; comment
+L46: inc r4
+clr r2
+lea L23, r0
+clr L49
+add *r6, L93
+rts
+L47: .string "rckufmeoakpyrbflcpi"
+prn #-230
+L48: mov L74, r4
+stop
+L49: rts
+dec L60
+m3
+jmp L4
+L50: jsr *r2
+m4
+L51: .string "fbyrmnqf"
+L52: lea L94, L11
+m0
+red r4
+clr r6
+L53: .string "bfngnwzvzxengnojtz"
+L54: .string "cbalkpuxnxx"
+red r1
+m0
+L55: rts
+sub r6, *r7
+L56: cmp r5, #-27
+add L5, r4
+not *r7
+stop
+cmp *r5, L59
+prn L21
+stop
+clr L28
+L57: inc L51
+L58: stop
+cmp L28, r4
+lea L6, r4
+cmp L91, #-43
+m3
+jmp L37
+red L64
+rts
+L59: clr L63
+m2
+m4
+lea L28, L79
+sub #140, L64
+inc L43
+not *r0
+; comment
+L60: inc L21
+L61: .string "cqsxaoxudj"
+stop
+add L33, L12
+L62: not r4
+bne L66
+L63: sub L61, r4
+L64: .string "gfwfhzmkcjg"
+jsr *r7
+rts
+m3
+
+m0
+stop
+L65: add r7, *r6
+m4
+L66: lea L98, r2
+prn *r5
+mov r6, r1
+m3
+m1
+
+stop
+m3
+L67: .data -558, -608, -761, 582, 65, -203
+rts
+red *r5
+rts
+red *r6
+bne L46
+clr r7
+prn r7
+prn *r0
+m0
+L68: mov r6, L38
+prn #127
+L69: .data -200, 621, -388, -155, -268, 769
+
+inc *r6
+m2
+m1
+m2
+lea L70, r1
+mov *r1, L2
+dec r3
+not r0
+prn L55
+m1
+clr *r7
+clr r3
+not *r5
+prn *r7
+clr *r0
+L70: add L83, *r7
+red r2
+L71: .string "mnwlfhccyvczifl"
+mov L89, r0
+L72: rts
+L73: sub r1, L71
+dec *r1
+rts
+L74: .data -195, -737, 677, 149, 788, -786, 732
+rts
+m0
+prn r1
+add r0, r2
+m3
+jsr *r0
+rts
+jsr *r0
+L75: lea L95, *r5
+lea L92, r4
+m3
+stop
+L76: .data 5, -66, -814, -919
+L77: rts
+sub *r0, r5
+m0
+stop
+m0
+m2
+bne L4
+inc L102
+jsr L24
+L78: stop
+mov #62, *r2
+stop
+cmp L53, r6
+inc r2
+prn r6
+prn *r1
+L79: clr L25
+add r5, r4
+L80: mov #207, r2
+L81: bne L98
+L82: add r6, r1
+cmp #-69, L42
+L83: sub L83, *r5
+clr r5
+m2
+prn #-73
+L84: prn *r4
+L85: bne L36
+clr L74
+jmp *r1
+inc r6
+L86: dec L95
+L87: inc L9
+m2
+L88: stop
+
+dec L48
+rts
+mov *r6, L2
+cmp L87, *r3
+not L18
+clr L101
+m3
+L89: mov r3, *r7
+m1
+m2
+clr *r5
+m4
+not r2
+jmp L35
+not r1
+cmp #205, *r6
+inc r2
+dec L9
+inc r7
+cmp #186, L105
+inc *r7
+lea L71, L90
+bne *r0
+L90: .data 209, -29, -955, 795, 470, -69, 608, -511
+L91: jsr *r4
+mov r7, r2
+m4
+clr L92
+red *r0
+add *r2, *r6
+dec r7
+
+m1
+dec L22
+cmp r1, L96
+red *r4
+m3
+mov *r1, *r7
+m0
+rts
+mov *r0, r3
+mov *r6, r5
+inc L46
+m2
+bne *r2
+cmp r1, *r5
+jmp *r4
+mov L57, r4
+L92: .string "sxnqlhx"
+m1
+L93: not L104
+L94: .data -439, -11, -966
+prn *r7
+bne L98
+L95: jsr L103
+jmp L97
+m4
+m4
+sub *r2, L109
+L96: .string "qzqwfzaiezntpalylqlf"
+L97: .data 29, 882
+L98: .data -298, 647, 647, -576, -750, 476
+stop
+sub L46, L105
+jsr *r5
+bne L59
+clr r4
+lea L68, r4
+jmp *r4
+m0
+red r2
+m3
+sub L109, L51
+lea L75, *r2
+cmp L67, #-229
+; comment
+sub #-248, L75
+jsr *r3
+prn *r7
+sub #-65, r5
+dec *r3
+lea L103, r1
+L99: .string "ubbigogenkugjbrykqfo"
+L100: cmp #-105, *r5
+m2
+jsr *r4
+L101: add r6, L104
+L102: .data 787, 811, -469
+jmp *r1
+L103: .string "fqoataaaigcdkuasrsqaa"
+
+dec L62
+red L109
+; comment
+m4
+red L107
+m4
+cmp L107, L24
+not r6
+sub #198, r0
+mov *r2, *r6
+not *r1
+stop
+rts
+stop
+L104: .string "vewnn"
+stop
+add L107, L108
+stop
+L105: add L107, r2
+inc r2
+clr L108
+sub r7, r3
+jsr L70
+m1
+rts
+not *r7
+L106: jsr *r4
+mov #46, L108
+m1
+m4
+jsr *r7
+prn *r3
+
+L107: inc r1
+L108: .data -491, -571, 718, -51
+rts
+
+m4
+L109: clr r4
+m1
+stop
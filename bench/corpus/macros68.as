@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 69
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    sub #69, *r7
+    rts
+    stop
+    red *r0
+    lea L75, r1
+    sub L44, r6
+    lea L100, r1
+    dec r2
+    bne L27
+    add #159, r7
+endmacr
+macr m1
+    lea L53, L14
+    bne *r3
+    add *r1, r7
+    inc r7
+    jmp L45
+    clr *r0
+    jmp *r5
+    stop
+    bne *r6
+    red r7
+endmacr
+macr m2
+    jsr L110
+    lea L42, L37
+    not r0
+    cmp *r1, L59
+    lea L40, *r5
+    red L105
+    jsr L68
+    prn r6
+    clr *r7
+    sub #-41, *r3
+endmacr
+macr m3
+    not r4
+    bne L118
+    not r3
+    inc *r0
+    dec *r7
+    sub L36, L105
+    prn L78
+    dec L105
+    prn L85
+    lea L73, L62
+endmacr
+macr m4
+    dec L58
+    clr *r6
+    red *r2
+    not *r1
+    prn r1
+    mov *r7, L40
+    inc *r3
+    jmp *r3
+    clr *r2
+    dec r2
+endmacr
+m4
+add r2, L89
+L0: .string "oyleykqauqepjoalypjqetx"
+L1: mov L1, L0
+m4
+not L18
+not *r0
+L2: .data 466, -788, -83, 978
+mov *r1, r1
+stop
+L3: bne L51
+cmp L24, L2
+rts
+jmp L95
+clr L7
+L4: prn *r0
+sub #-31, *r6
+L5: red *r5
+clr *r5
+L6: not L6
+dec *r5
+dec L5
+lea L118, r7
+clr L42
+clr L25
+m1
+clr r1
+L7: jmp *r1
+prn r1
+jsr *r1
+m0
+L8: jmp *r1
+prn #-236
+L9: lea L4, *r7
+stop
+clr L4
+add r1, r7
+L10: .string "jwerbyvlfbudeweyjytuodtm"
+inc *r6
+L11: .data 766, -99, 720, -605, -123, 617, -554, -973
+L12: red *r4
+sub r2, r3
+not r3
+clr r7
+L13: clr r6
+prn #-118
+clr *r4
+mov *r6, r2
+add #191, *r3
+L14: bne *r2
+m2
+m4
+L15: sub *r2, r4
+stop
+jmp L9
+bne L6
+L16: .string "kdvjwptyf"
+jmp *r6
+not *r3
+jsr L1
+m3
+dec L1
+add #24, L10
+m4
+jmp L75
+stop
+L17: .string "enut"
+m2
+m3
+lea L17, L102
+clr L5
+L18: jsr L99
+jmp L71
+lea L6, *r4
+jsr L11
+L19: .string "mpyutuwbpe"
+red r3
+mov #99, L19
+bne L5
+; comment
+mov *r3, r5
+stop
+dec r4
+mov r3, *r7
+bne *r0
+not L29
+inc r0
+cmp L2, #-102
+; comment
+bne L24
+L20: jmp *r3
+L21: sub r3, *r3
+dec r6
+m2
+m4
+L22: .data 16
+m0
+bne *r3
+L23: add *r1, r4
+dec L86
+m3
+L24: .string "dyvikuwsjo"
+red r7
+rts
+
+L25: stop
+dec r1
+clr *r7
+mov L67, *r6
+add L92, r2
+m0
+add #4, r0
+m4
+; comment
+sub *r6, *r3
+lea L10, L11
+jmp L13
+prn *r2
+jmp L21
+clr r5
+sub r0, *r1
+sub L57, r4
+inc *r2
+jmp L23
+jsr L13
+L26: prn r1
+L27: jmp L14
+
+cmp #63, #-213
+dec r4
+L28: .data -145, 448, 871, 890, -592, -873, -337
+; comment
+bne L88
+m0
+L29: not r5
+rts
+rts
+not *r6
+L30: .string "kdehrhqpklsencz"
+cmp r5, #62
+m4
+add L67, r7
+inc *r2
+inc r5
+prn r3
+not *r7
+dec *r2
+
+red L50
+jmp L56
+m1
+m4
+L31: .string "lmhrqrbjwuhfxdq"
+mov r6, r6
+m3
+jmp *r0
+sub *r4, r3
+m4
+L32: .string "mwhgoyd"
+mov *r0, *r6
+L33: .string "nzymk"
+stop
+L34: jsr *r1
+cmp #-145, *r2
+; comment
+; comment
+L35: red *r2
+prn *r4
+m4
+L36: bne L94
+bne L11
+red *r3
+not r6
+prn #139
+
+L37: .string "zsg"
+sub *r4, L13
+add r0, L113
+L38: stop
+L39: mov #-172, r7
+sub L38, L29
+lea L104, *r2
+add #-153, *r7
+m4
+jmp *r1
+m1
+
+mov #20, *r7
+; comment
+not *r6
+inc L100
+clr *r5
+L40: red r3
+cmp r4, #-132
+not r1
+cmp *r3, L11
+m4
+
+L41: .string "msfantmvryhtvpzmblprofbb"
+inc r2
+stop
+cmp #-113, L39
+
+
+L42: .string "rs"
+; comment
+not L18
+dec L44
+jsr *r4
+sub r4, L46
+L43: .data -919
+L44: .string "bmfnirpydd"
+m1
+add *r5, r5
+prn #65
+clr *r5
+clr *r7
+L45: .data -509, -13, 810
+cmp r2, r5
+m1
+
+m0
+L46: dec *r2
+jmp *r2
+m3
+sub L100, *r2
+m0
+L47: stop
+L48: .data -380, 347
+cmp *r3, #-234
+lea L90, L29
+m2
+L49: add #41, r7
+sub r2, L2
+L50: .string "jdqfhntmutwqknxrzunla"
+jmp *r5
+sub r0, L53
+L51: bne L106
+sub r5, r3
+not L59
+L52: rts
+prn r6
+inc r2
+
+L53: mov r2, r6
+sub r2, L63
+L54: .data 70, 248, -329, -91, -401, 791
+; comment
+cmp *r2, #78
+m4
+prn #-71
+m2
+mov #87, L85
+L55: .data -71, 859
+red L58
+dec *r3
+not L22
+red *r6
+jsr *r1
+L56: cmp #111, *r4
+jsr *r3
+bne *r0
+inc r5
+sub L87, r6
+lea L83, r7
+dec L48
+m4
+m1
+stop
+m0
+mov L15, r2
+m0
+m1
+add r4, L110
+m3
+L57: .string "btalez"
+L58: rts
+prn *r7
+m3
+add #197, r1
+red L13
+bne *r4
+L59: sub #-42, r5
+L60: dec r2
+; comment
+L61: .string "vdhewckizrymk"
+L62: not r7
+mov L72, L6
+not *r0
+L63: .string "csquahojeyzmeso"
+L64: lea L16, *r6
+L65: rts
+L66: mov L30, r1
+L67: jsr *r5
+L68: add r5, L34
+clr L63
+jmp L67
+; comment
+jsr *r1
+L69: add #35, L67
+mov L25, *r6
+m1
+prn *r7
+prn L81
+dec *r5
+m4
+L70: .data 252, -703, 340, 368, -296, 692, -717, 831
+inc L26
+; comment
+red r3
+mov r5, L76
+m0
+m3
+bne L71
+
+red *r7
+L71: .data 549, 895, -351
+add #91, L109
+stop
+L72: .string "sanityrayzmrzhczssqrunqh"
+m4
+rts
+mov *r7, *r3
+inc *r5
+sub L91, r4
+m2
+m4
+not r3
+not *r5
+red *r4
+sub r5, *r0
+sub #194, *r1
+L73: add #-10, r0
+red r7
+sub *r7, L65
+rts
+; comment
+inc r7
+m2
+add r0, r5
+mov #-49, L88
+bne *r2
+L74: .string "uzfnmouvfopqrrhqs"
+not r1
+L75: jsr *r6
+
+jsr *r5
+
+m1
+m4
+jsr *r2
+; comment
+L76: .data -362, 940
+L77: stop
+L78: bne *r0
+jmp *r3
+L79: .data 102, -693
+stop
+m1
+mov r5, L110
+; comment
+L80: .string "sgbrtlqvglh"
+cmp *r1, *r6
+jsr L117
+L81: prn L27
+; comment
+rts
+L82: inc L15
+cmp L86, #-216
+stop
+L83: .data 381, -29
+L84: .string "fkzsno"
+sub #124, r7
+jmp L60
+L85: lea L89, L14
+inc *r0
+m4
+mov #-6, r4
+dec L11
+stop
+L86: lea L8, *r7
+add #98, *r5
+L87: add r7, L112
+add L71, L114
+mov r3, r3
+L88: sub r0, *r4
+L89: sub r2, r7
+m3
+bne L26
+m1
+L90: prn *r3
+m1
+L91: sub L98, L95
+mov #163, L111
+jmp *r7
+L92: .data 992, -146, 836, -914
+
+m1
+m2
+not L118
+prn #32
+jmp L83
+m1
+L93: .string "rmlsxffvg"
+clr r7
+rts
+m4
+m1
+L94: .data -408, -519, -3, 266, 349, 448, 461, 434
+prn *r5
+m0
+L95: .data 463, 761, 414, -114, -688
+L96: mov r2, L101
+m3
+inc r0
+L97: .string "vocpc"
+L98: .data -317, 535
+sub *r6, *r5
+m4
+L99: inc L112
+lea L106, *r7
+L100: not L31
+add r7, L64
+L101: rts
+m3
+lea L5, r2
+add L15, *r4
+m0
+L102: .data -792, -912
+m1
+L103: not L112
+inc *r0
+stop
+prn L4
+rts
+L104: not *r0
+L105: bne *r5
+not r3
+red L80
+stop
+m1
+; comment
+L106: .string "tfxnmjtepayrjzqgsekiu"
+lea L112, L111
+dec L114
+m0
+inc r5
+jsr L116
+L107: .data -323, 459, 57, 43
+m3
+inc *r6
+cmp #136, L28
+L108: cmp #76, r5
+rts
+dec L61
+lea L63, r2
+L109: jmp L33
+m2
+red L116
+prn L103
+jsr L62
+inc r3
+lea L84, L44
+stop
+not r4
+mov *r1, *r3
+mov r2, *r3
+clr *r4
+L110: .data 677, -45, 283, -329, 317
+bne *r0
+rts
+L111: dec *r0
+rts
+mov #-38, *r7
+add #-158, r3
+prn *r0
+red r1
+L112: lea L113, L83
+m4
+not L46
+stop
+L113: .data 198, -245, -575, 167, 192, 759, -32, -812
+; comment
+not L94
+L114: .string "ghcdqsneokgwnqalebli"
+L115: .string "xgk"
+bne *r4
+cmp *r1, *r7
+L116: jsr *r2
+bne *r7
+jmp L117
+lea L38, L117
+L117: prn #-71
+mov r2, *r7
+m2
+sub *r2, *r6
+mov *r0, *r7
+jmp *r5
+L118: .string "ilgsib"
+jsr L75
+stop
@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 70
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    dec r6
+    bne *r5
+    inc *r4
+    stop
+    not r7
+    inc L68
+    cmp r5, #1
+    rts
+    sub *r0, L20
+    sub r4, L71
+endmacr
+macr m1
+    add *r3, L0
+    prn *r0
+    lea L37, L93
+    sub #-120, r7
+    red r1
+    not r6
+    not L68
+    sub *r6, r4
+    inc *r2
+    mov L71, L3
+endmacr
+macr m2
+    clr L60
+    stop
+    cmp r5, *r2
+    sub *r6, r3
+    add *r0, r4
+    clr L40
+    lea L67, L26
+    mov L59, *r2
+    clr *r3
+    inc r7
+endmacr
+macr m3
+    inc r7
+    inc L93
+    inc L53
+    rts
+    cmp L27, #-109
+    add L35, r1
+    lea L70, L2
+    sub r6, r1
+    clr r5
+    red L95
+endmacr
+macr m4
+    clr *r4
+    stop
+    stop
+    sub r1, *r1
+    jmp *r2
+    cmp r4, #-15
+    inc L103
+    not r4
+    stop
+    bne *r1
+endmacr
+mov *r5, *r5
+jsr L76
+clr *r3
+dec r2
+L0: .data 26
+cmp L44, L93
+L1: inc *r2
+m3
+lea L1, L104
+rts
+sub r0, L1
+m3
+add #-36, *r4
+inc r0
+jmp *r3
+lea L0, L1
+sub r4, L1
+L2: stop
+L3: .data -265, 4, 515, 617, 797, 597, -491
+bne L1
+lea L11, r0
+jsr *r3
+not r7
+not *r7
+clr r1
+L4: .string "pzjguikwk"
+L5: jsr *r6
+m3
+m0
+L6: rts
+L7: not L32
+; comment
+m4
+bne L104
+jmp L86
+rts
+clr L6
+; comment
+rts
+prn *r1
+L8: sub *r6, *r3
+jmp L68
+red r6
+m0
+add #252, *r0
+sub r2, *r7
+L9: lea L57, *r4
+cmp r0, #244
+; comment
+m2
+L10: clr L6
+jsr *r2
+L11: .string "gzfjeyzgaxsj"
+inc L6
+L12: .data -918, -843, -68, -803, 360, 443, -166
+lea L50, *r0
+L13: .data -20, -238, 561, 915, 591, 659
+L14: lea L6, L11
+inc r2
+stop
+jsr *r4
+inc L94
+
+sub *r0, r5
+mov L37, *r5
+cmp #-113, *r0
+mov #52, L3
+m1
+prn #171
+m1
+lea L4, r6
+cmp r7, *r6
+L15: .data 858, 278, -268, 208
+lea L56, *r2
+m0
+inc L6
+m4
+L16: .data -264, 661, -100, -689, -928, 397, 444
+cmp r6, #186
+L17: red r4
+clr *r5
+add *r3, *r6
+L18: cmp L11, #9
+sub #142, *r1
+inc *r4
+red L31
+L19: stop
+
+not r5
+clr r3
+m2
+rts
+L20: inc L63
+L21: rts
+L22: .string "askaqjybtupwnadawc"
+dec *r1
+rts
+dec *r0
+stop
+L23: bne *r3
+
+dec L37
+L24: .data -40, -870, -413, -250, -830, 765, -291, -990
+stop
+prn #-6
+lea L69, L94
+bne L21
+dec r7
+inc L8
+rts
+L25: clr L10
+jsr *r7
+L26: .string "hlvljxhsjofbxzibqpcv"
+L27: .data -381, 205, -394, 923, 357, -717
+bne *r2
+m3
+lea L26, L12
+rts
+lea L95, L24
+m1
+jsr L47
+L28: rts
+L29: .string "haatczripl"
+L30: stop
+cmp *r0, #-256
+mov r0, L91
+; comment
+m2
+L31: red L85
+; comment
+L32: prn L13
+L33: lea L91, r7
+L34: .string "enycybkappwawz"
+L35: cmp r0, L34
+rts
+L36: jsr *r0
+m3
+L37: .string "cw"
+sub r3, r5
+dec *r7
+inc r1
+stop
+prn *r0
+jsr *r5
+red L60
+rts
+dec *r2
+L38: mov r7, L1
+stop
+m3
+m0
+prn L38
+m4
+red *r1
+m4
+rts
+L39: mov *r1, r6
+lea L66, L84
+rts
+cmp L104, #54
+m0
+m2
+L40: .data -399
+dec L83
+dec *r6
+jmp *r7
+m0
+m2
+mov #-111, L46
+L41: .data -302
+jsr L10
+m4
+m2
+rts
+m3
+L42: clr L84
+jmp L99
+clr r5
+m3
+dec r4
+L43: .data -927, -104, 596, -401
+L44: .data -877, 229, 522, 495
+sub *r6, *r4
+clr *r3
+stop
+jsr *r1
+inc *r2
+sub r7, r3
+bne *r5
+mov L95, L84
+; comment
+rts
+L45: mov r5, L99
+L46: jmp *r2
+inc L39
+inc L21
+mov L53, r2
+red r3
+L47: .string "ddvywemgilscvrcntmgvb"
+not r7
+; comment
+; comment
+jsr *r2
+rts
+jsr L11
+L48: .data 968
+inc r7
+not L5
+L49: dec *r1
+jsr L10
+L50: inc *r1
+; comment
+L51: rts
+inc *r2
+m4
+cmp #87, #178
+L52: lea L91, r5
+L53: .string "sqeg"
+bne L18
+cmp *r1, *r0
+L54: .string "h"
+rts
+sub #236, r3
+inc *r5
+m3
+lea L82, r5
+jsr L14
+rts
+bne *r1
+m4
+L55: sub *r2, L72
+
+m2
+sub L88, *r6
+lea L41, *r5
+L56: .data 430
+prn r7
+not r5
+red L30
+inc r2
+jmp *r2
+L57: jsr *r0
+L58: .string "xscxjgjnbswxey"
+m1
+dec r6
+clr L0
+sub *r7, L40
+dec r6
+m0
+
+prn #-213
+clr L12
+m1
+jmp L104
+sub *r3, *r3
+lea L69, L60
+prn *r5
+L59: .data -132, 296, 123, 886, 430
+m1
+not *r5
+not *r1
+not L63
+L60: .string "dl"
+jmp *r4
+m4
+L61: jmp *r5
+m4
+L62: .data 147
+L63: lea L43, r6
+jmp *r4
+rts
+L64: .data 461
+m4
+add *r2, *r3
+dec r2
+m1
+rts
+inc *r2
+sub L53, r6
+L65: lea L9, *r6
+rts
+red L59
+L66: .data 35, -438, 859, 7, 31, 201, -771
+m1
+bne *r2
+not *r5
+bne *r7
+L67: not *r4
+m4
+prn #17
+
+; comment
+lea L83, L89
+rts
+inc r6
+lea L28, L1
+m1
+not *r6
+sub r6, L2
+prn L79
+not L34
+L68: .data 359, 992, -945
+mov #-181, *r5
+inc L96
+m2
+inc r3
+L69: .string "nxuwvbsrfstfnykz"
+L70: .data -329, 666, -149, 171, -427, -237
+jsr *r0
+lea L8, *r2
+m2
+clr r2
+jmp *r5
+L71: .string "qv"
+dec L88
+jmp *r5
+dec *r2
+mov *r3, r4
+clr L86
+m4
+sub r0, L87
+mov #-164, r4
+clr r1
+add r7, *r6
+m1
+m4
+dec r0
+L72: not r4
+not r2
+L73: jmp *r6
+inc L64
+L74: lea L55, L83
+jmp L94
+m1
+add #121, r2
+L75: rts
+clr r3
+m2
+m1
+rts
+m2
+sub *r6, r2
+L76: add #194, *r3
+m1
+inc r1
+prn #-176
+m0
+cmp *r5, r3
+L77: sub r4, *r3
+add L82, r6
+rts
+add #-89, *r3
+L78: .data -69, 492
+m3
+m4
+add #232, L46
+L79: red r5
+red L100
+m4
+bne *r6
+L80: bne L4
+bne L95
+; comment
+sub r0, r4
+stop
+; comment
+; comment
+lea L46, *r0
+stop
+L81: .data 513, 394, 827
+mov *r7, r0
+clr L33
+; comment
+bne L90
+lea L4, L73
+dec *r3
+m3
+not L91
+L82: .data 541, -769, 586, 274, 707, -487, 7
+L83: cmp *r5, L40
+L84: red L1
+L85: mov #-207, r3
+cmp L94, *r5
+m0
+
+L86: inc L26
+; comment
+m0
+dec r0
+lea L2, r3
+L87: jsr L16
+L88: .data -16, 791, -103, -496, -682, 293, -684, -574
+add #-1, *r4
+m3
+dec *r4
+lea L98, r1
+L89: lea L103, *r7
+dec L65
+L90: rts
+L91: inc *r4
+add L98, L102
+stop
+m1
+; comment
+m3
+m3
+L92: clr L75
+mov *r2, *r1
+; comment
+L93: .string "nezfcocawsdqcllcikjdena"
+jmp *r6
+add L100, r4
+m0
+bne L97
+mov #-15, r5
+m1
+add *r7, r3
+not r5
+m1
+cmp r7, #125
+rts
+m4
+L94: jsr *r4
+jmp L102
+L95: .data 767, -458, 721, -129, 132, 635
+m0
+m0
+m3
+prn L101
+m1
+sub #-130, *r4
+m3
+stop
+rts
+jsr *r4
+bne L22
+add L97, *r2
+jsr L100
+stop
+inc r3
+jmp L103
+not L97
+jsr *r7
+dec *r6
+lea L101, r2
+add *r1, L64
+L96: add L43, r1
+m2
+jsr *r5
+m0
+m1
+bne *r0
+not r1
+jmp L61
+clr r2
+prn r6
+inc r1
+bne *r5
+red *r1
+sub r6, *r2
+prn #-35
+m1
+sub #-73, L35
+m4
+L97: inc r7
+L98: jmp L101
+L99: .data 974, 946
+
+m4
+jsr *r4
+inc L101
+dec r4
+L100: red L103
+sub #201, *r4
+m3
+L101: cmp #-153, #-51
+m2
+not r4
+rts
+lea L5, r3
+L102: stop
+cmp *r1, L6
+jmp *r4
+L103: rts
+jmp L94
+rts
+m4
+m1
+rts
+stop
+prn #80
+m0
+L104: jsr *r3
+stop
+clr r1
+m2
+jmp L39
+m3
+jmp *r2
+prn r7
+stop
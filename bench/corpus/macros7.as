@@ -0,0 +1,571 @@
+; Generated by genCorpus --seed 8
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+macr m0
+    sub L3, L25
+    sub L116, r1
+    prn r1
+    rts
+    jmp *r7
+    rts
+    sub #42, r3
+    add r5, r4
+    lea L105, r7
+    stop
+endmacr
+macr m1
+    dec *r5
+    dec L20
+    dec L89
+    clr *r0
+    mov r5, L37
+    sub *r0, r5
+    jsr L127
+    jsr L12
+    cmp #38, *r2
+    inc L17
+endmacr
+macr m2
+    prn #-213
+    dec r6
+    cmp *r2, *r7
+    stop
+    not *r3
+    mov *r5, L100
+    clr r5
+    sub r1, *r3
+    lea L101, r3
+    cmp #48, *r0
+endmacr
+macr m3
+    rts
+    dec r7
+    rts
+    inc *r7
+    mov *r1, r6
+    cmp #110, *r1
+    red r7
+    not *r1
+    sub #171, r2
+    jmp L81
+endmacr
+macr m4
+    jsr L76
+    bne *r2
+    not L112
+    clr *r5
+    jsr L118
+    mov L90, *r5
+    bne L65
+    lea L49, r1
+    clr L68
+    bne *r3
+endmacr
+stop
+rts
+L0: .string "knoapzmjbleyvnn"
+lea L2, r6
+L1: lea L120, L5
+L2: inc L0
+L3: .string "efonktghvthdiagfxmcou"
+bne L10
+m3
+L4: rts
+jsr *r2
+; comment
+L5: stop
+L6: prn r1
+L7: prn L35
+lea L33, L97
+lea L3, L6
+not *r0
+m4
+jsr L60
+inc r3
+cmp L6, L6
+dec r6
+lea L16, L81
+mov #-197, r5
+; comment
+m2
+; comment
+L8: .data -972, -976, 446, 167, -118
+
+L9: .string "gwmgsrq"
+m2
+L10: rts
+mov r4, L80
+sub *r6, *r2
+m4
+L11: .string "qbphlenidnmr"
+m2
+inc L27
+L12: lea L70, r5
+L13: sub *r7, r4
+rts
+m1
+clr *r6
+sub *r6, *r6
+L14: .data -799, 832, 908, -398, 977
+L15: stop
+not L21
+inc L127
+L16: jsr *r6
+L17: inc L68
+L18: .data 7, -242, 163, -309, -341, 569
+m0
+red L6
+L19: cmp L24, L6
+m2
+
+m4
+dec *r5
+dec r4
+inc *r0
+L20: cmp r4, L6
+L21: .string "qrvvpjpfingjwc"
+clr r5
+jmp L17
+m3
+dec L10
+L22: prn #-38
+clr L4
+cmp r0, #199
+L23: .string "aadzxylg"
+m2
+m0
+bne *r7
+dec L14
+sub r3, L63
+m4
+not *r1
+rts
+L24: .string "trviiuu"
+prn #-161
+stop
+red r0
+m0
+cmp r2, #-127
+jmp L5
+sub #46, r6
+stop
+jmp *r3
+inc L93
+; comment
+m2
+stop
+L25: lea L6, r0
+inc *r6
+dec *r3
+dec *r4
+m1
+mov r2, *r1
+dec r6
+L26: prn r3
+mov L93, *r5
+bne *r4
+L27: dec L2
+L28: jmp L19
+prn #-234
+mov #89, r5
+L29: .string "evfaylutdndf"
+not r4
+L30: prn *r1
+L31: jmp L15
+
+L32: lea L78, L61
+L33: .data 627, 970, 710
+L34: .string "qtbx"
+L35: .data -427, 876, 323, 901, -892, -398
+bne L31
+rts
+m4
+L36: not r4
+; comment
+sub #46, *r4
+inc r7
+L37: sub r5, r7
+L38: .data 903, -994, 326, 252
+m4
+m4
+bne L82
+dec *r4
+mov *r2, *r5
+cmp *r2, L33
+not *r0
+m0
+L39: stop
+L40: .data 945, 113, 891, 879
+mov L48, L12
+m3
+jmp L59
+not *r7
+cmp L3, L93
+lea L8, *r3
+red *r3
+inc r1
+not L20
+
+L41: lea L6, L25
+prn *r2
+L42: stop
+jmp L39
+m1
+L43: .data 543, 247, -792
+sub *r2, r3
+prn #144
+L44: add *r6, L50
+sub L36, L29
+m2
+jsr L74
+L45: .data 176, -57, 942
+L46: stop
+cmp #185, *r7
+; comment
+L47: .string "dfkmnvvnttk"
+m2
+stop
+dec *r1
+m2
+inc *r7
+m0
+bne L79
+L48: prn r2
+stop
+jsr L32
+prn #-14
+sub r3, r3
+rts
+m2
+L49: .string "quedevpoawzvkwzbhs"
+prn *r6
+bne L26
+red *r3
+not *r6
+m1
+stop
+jsr *r4
+jmp L74
+red *r4
+L50: add #172, L72
+L51: .string "hbtulpgvkhqrwdkylpw"
+m4
+L52: .string "yhweyoh"
+rts
+m1
+sub #244, r6
+L53: .string "c"
+L54: mov r1, *r7
+m2
+inc r1
+red L4
+stop
+dec *r4
+jmp L90
+add r3, L94
+prn #223
+m2
+m2
+m1
+lea L13, r6
+jmp *r3
+m1
+L55: .data -654
+L56: .string "hghebpnlkrdlmmchjxsgcyk"
+m1
+bne *r1
+L57: bne *r5
+L58: .data -33, -718, 453, -619
+dec L52
+; comment
+L59: .string "vdrpitzn"
+not L83
+sub #183, *r4
+L60: jsr *r1
+m4
+dec *r4
+red *r2
+add *r5, r7
+m1
+m1
+not L37
+L61: add L53, r4
+L62: jsr L35
+m2
+jsr L19
+cmp L93, r0
+add *r0, r4
+cmp *r1, r1
+sub #190, *r4
+lea L50, r7
+bne *r4
+; comment
+m1
+jmp L79
+L63: .data -35, -269, -929, 245
+lea L116, r6
+mov L2, L41
+m0
+jmp *r3
+L64: mov L36, L24
+L65: .string "pqswsedlmzcdzjqvaxnouao"
+inc r6
+mov *r0, r6
+m4
+L66: add r3, *r4
+; comment
+inc L11
+L67: .data -112, 82, -280, 530
+; comment
+m1
+bne *r3
+m0
+jsr *r4
+dec L88
+
+L68: bne L95
+jsr *r2
+prn *r2
+clr r0
+prn #61
+bne L54
+m2
+rts
+L69: .data 580
+L70: dec *r1
+clr L39
+
+m0
+m0
+L71: .string "r"
+not *r6
+jmp L90
+m0
+red r1
+bne L59
+cmp *r7, *r7
+m1
+L72: not L27
+m4
+m3
+jsr L102
+m1
+L73: cmp *r1, r1
+L74: .string "hpiwxahr"
+cmp #116, #-212
+
+clr L84
+jmp L102
+prn L27
+clr r4
+L75: .string "ndqifbtfqdflvd"
+m2
+L76: rts
+clr L6
+; comment
+L77: red r1
+sub *r4, r5
+rts
+L78: .string "cjarxvg"
+stop
+; comment
+L79: jsr *r6
+not r7
+stop
+L80: .string "twvmxiiidnzrgcgdtsxh"
+lea L19, r5
+L81: jsr L114
+L82: cmp L27, L88
+bne L83
+L83: clr L60
+L84: dec r0
+L85: .string "ncagwgaqptfhuwe"
+jsr *r6
+cmp L124, r6
+jsr L109
+m3
+prn r0
+L86: .string "dyzjxvktglgifwqolpcthzg"
+mov L75, L103
+red L81
+lea L91, L0
+red L58
+sub r0, *r5
+m1
+
+stop
+cmp r7, #-65
+; comment
+red L114
+m1
+lea L29, r2
+jsr L103
+inc L36
+not L100
+jmp *r0
+L87: lea L93, r7
+cmp L9, *r7
+L88: .data -981, -574
+m0
+
+not L104
+lea L99, r4
+m0
+L89: add *r6, *r2
+; comment
+L90: .data -580, -658, 255, 210, -482
+not L119
+L91: .string "sdeclomeohbqrnhxknno"
+m4
+bne L20
+clr r0
+jmp *r1
+mov *r5, r3
+L92: .data -597, 74, 460
+L93: .data -691, -300, -330, 480, -390, -537, 749, -871
+m3
+rts
+m4
+jmp *r0
+cmp #217, L30
+not r6
+mov #-1, L75
+L94: inc r7
+add #39, *r3
+sub L62, r3
+jsr L100
+L95: not L96
+stop
+m4
+jmp *r2
+m2
+; comment
+stop
+L96: .string "xsxjypvyu"
+clr L105
+lea L97, r7
+not *r5
+sub r5, r4
+mov L45, r7
+inc r4
+sub r6, L22
+m0
+stop
+rts
+lea L94, r4
+clr L106
+m2
+add r1, *r6
+L97: add *r0, r5
+bne L104
+jmp *r6
+stop
+L98: .string "vpxetfnbuhdr"
+rts
+m4
+m1
+m3
+m1
+cmp *r7, #52
+sub L125, L118
+m2
+m2
+m0
+m3
+jsr *r1
+
+m2
+dec *r4
+mov #-75, L91
+not *r6
+; comment
+L99: jmp L23
+m1
+add r4, *r2
+L100: red r7
+L101: mov L116, r3
+L102: .string "uflegpzyltgvtdkqxuyiazpg"
+prn r7
+prn r5
+red *r1
+L103: rts
+L104: not r4
+L105: stop
+red r2
+jmp L103
+bne L117
+jsr L127
+cmp #-224, r0
+add *r3, r5
+add #-155, r3
+inc L111
+L106: rts
+L107: .data -779
+not L110
+L108: .data 333, -182
+stop
+L109: prn *r6
+m0
+L110: clr *r6
+L111: stop
+L112: inc L121
+m0
+rts
+cmp L42, *r0
+; comment
+L113: jsr *r3
+red *r3
+
+jsr *r4
+L114: sub #-91, r6
+stop
+cmp *r3, L117
+L115: prn *r7
+L116: .string "tpalxmopvor"
+jsr L119
+m0
+; comment
+inc L35
+m1
+m3
+
+m2
+L117: jsr *r1
+red L121
+prn L45
+prn *r2
+L118: .string "vogyvpljgjhpmdgazrtv"
+m1
+L119: prn #-164
+L120: jmp *r3
+sub #-173, r4
+m3
+not L122
+L121: .string "zpliagq"
+jsr *r3
+stop
+L122: add L128, L123
+jsr *r6
+L123: bne L125
+m1
+L124: cmp r3, *r0
+lea L128, *r4
+inc r5
+L125: not *r6
+L126: rts
+cmp #-62, r5
+L127: .data -286, -503, -685, 567
+jsr L68
+jmp L44
+jmp *r2
+red *r5
+L128: cmp L99, #-106
+m1
+stop
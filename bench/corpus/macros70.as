@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 71
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    red r6
+    dec *r3
+    jmp *r5
+    mov *r6, L12
+    rts
+    add r7, L32
+    sub #-7, *r5
+    bne *r2
+    jmp L74
+    mov L33, L93
+endmacr
+macr m1
+    clr *r4
+    mov r6, *r4
+    jsr *r7
+    not r4
+    jmp *r1
+    dec L51
+    jmp L68
+    stop
+    jmp L37
+    bne *r6
+endmacr
+macr m2
+    dec r3
+    not r4
+    sub *r6, r0
+    lea L5, L26
+    lea L109, *r0
+    bne L25
+    inc r1
+    not r5
+    inc *r1
+    rts
+endmacr
+macr m3
+    prn r0
+    prn *r7
+    jsr *r5
+    rts
+    cmp L24, r6
+    stop
+    not *r4
+    jsr *r1
+    sub L110, r4
+    stop
+endmacr
+macr m4
+    clr *r0
+    red L58
+    add L85, L22
+    dec L33
+    lea L28, *r4
+    jmp *r2
+    stop
+    lea L107, L20
+    prn L25
+    inc r4
+endmacr
+jmp *r6
+L0: .string "ysxxtliooeo"
+L1: not L20
+red L94
+m3
+jmp *r2
+inc L0
+L2: dec L112
+clr *r2
+mov #41, r6
+stop
+jsr *r6
+cmp r4, r1
+sub *r4, r3
+m3
+red L105
+add #147, *r7
+mov r2, L72
+stop
+sub *r1, r4
+m3
+m3
+jsr *r0
+sub r6, *r4
+not r0
+mov L6, L0
+inc L34
+lea L115, *r3
+L3: .string "jy"
+L4: bne L13
+m2
+L5: .data 104, 852, -282, 829, 400, 545, 583
+dec r6
+dec *r7
+L6: rts
+rts
+stop
+m1
+sub #224, L88
+L7: .string "jzldgyesrhrygpzjybowdnc"
+m1
+cmp L5, #61
+; comment
+m2
+L8: clr r0
+inc r4
+m2
+mov #-192, r0
+L9: .string "kstuhyuvyuyhhiiqldbby"
+cmp #142, L8
+jsr *r5
+L10: sub #138, L10
+L11: stop
+sub *r2, r0
+red r1
+
+not r2
+m0
+L12: .string "dsxbpwtdsuznahfh"
+add #-93, *r4
+inc *r5
+
+lea L40, r1
+inc *r2
+L13: jsr *r2
+L14: inc L6
+m1
+inc *r7
+bne L95
+; comment
+lea L80, L11
+not r3
+dec L80
+not *r1
+rts
+L15: rts
+L16: .string "lamlnpmw"
+clr L11
+
+; comment
+jsr L110
+lea L4, *r4
+L17: prn #-167
+lea L12, *r2
+rts
+not *r7
+jmp L118
+L18: cmp L102, r0
+; comment
+stop
+L19: mov *r6, L5
+L20: clr r2
+add L20, r1
+cmp #248, L80
+lea L25, r3
+m1
+jsr *r7
+inc *r2
+not r1
+stop
+lea L20, *r2
+L21: inc L16
+dec r3
+L22: .data 744, 572, 747, 346
+jsr *r6
+mov *r3, r2
+m2
+L23: lea L66, r4
+L24: add *r3, L117
+; comment
+mov L54, *r0
+stop
+not L70
+prn #40
+add *r5, *r0
+mov L118, *r1
+red r6
+stop
+; comment
+L25: dec *r7
+L26: add *r6, *r0
+prn *r7
+sub #-224, *r4
+prn #15
+dec *r4
+cmp L64, #-69
+m2
+sub *r1, *r7
+inc L19
+m3
+m4
+m2
+L27: lea L26, r1
+; comment
+L28: .data -998, 306, -461, 728, -117, -895
+prn L11
+m2
+lea L17, L38
+cmp *r6, #136
+m4
+L29: red L5
+stop
+m2
+m3
+clr L33
+stop
+mov L80, *r0
+L30: .data 939, 689, 134, 467, 386, 435, -346
+jmp *r4
+lea L11, r6
+L31: sub *r7, r4
+inc L45
+m0
+m2
+lea L119, L30
+m4
+m2
+rts
+sub *r2, *r3
+L32: .string "vuemefxnvbnuesjzjlvc"
+m3
+L33: .string "dxunzjvmtfcpqjyenp"
+jmp *r6
+m4
+L34: .data -550, -725, 725, -270
+L35: stop
+bne L90
+mov #-17, r6
+mov r6, r6
+L36: jmp L79
+inc *r0
+sub #226, L49
+not *r7
+; comment
+add #-49, *r5
+stop
+lea L60, r3
+L37: .data -980, -673, -789, -545, 95, 249
+m0
+bne L8
+m1
+L38: .string "rruhkczxmgihrkocxe"
+L39: .string "aucbmgorybhgmhnlt"
+L40: prn #-11
+jmp L77
+
+bne *r4
+prn #223
+stop
+m3
+lea L37, r1
+L41: .data -70, 980
+jmp L116
+prn L34
+red *r2
+red r0
+jsr L0
+inc L12
+rts
+m3
+L42: bne L22
+not *r2
+not *r7
+L43: rts
+L44: cmp r2, #24
+inc r3
+prn *r3
+m1
+L45: inc r7
+red r2
+lea L15, r4
+L46: jsr L18
+mov #-211, L103
+not r3
+L47: .string "iwptvp"
+
+m1
+mov L108, L106
+L48: .string "fikjchnkywxldqw"
+inc *r7
+L49: mov #52, r6
+add r4, *r1
+m1
+mov L91, r1
+inc *r6
+inc r4
+m1
+cmp *r5, #71
+L50: .string "xwqrykgvrser"
+m2
+L51: red r2
+L52: mov *r5, L52
+L53: .data 923, 381, 44, 645
+L54: dec L91
+L55: rts
+clr L110
+jsr *r2
+L56: dec L12
+L57: prn L106
+inc *r6
+dec L57
+stop
+
+dec r6
+m4
+m0
+
+not L115
+lea L111, r1
+prn r5
+lea L75, L60
+; comment
+cmp *r0, r3
+; comment
+L58: .string "zayhqytmqdx"
+L59: add #-155, *r1
+bne *r3
+L60: .string "zbpoyfzhkczf"
+inc L106
+; comment
+L61: .data 148, 589, 863
+L62: mov r0, *r1
+inc L20
+; comment
+lea L92, *r7
+m2
+cmp L56, #227
+mov L54, r6
+m0
+jsr L79
+cmp r5, r0
+L63: mov L12, r0
+stop
+not r6
+inc *r5
+m4
+prn r4
+clr L97
+L64: .string "mokowjtejsgqhkizyvsyq"
+jsr L38
+lea L10, r4
+m4
+L65: .string "ymoqcjahkyrpahbhicf"
+lea L74, L66
+m3
+sub #125, r6
+inc *r3
+L66: .data -326, 271, -4, -836, -211, 455, 548, -353
+m4
+m3
+L67: .data -498, -848
+inc r2
+L68: red *r4
+L69: add #-107, r6
+L70: mov L18, r4
+dec *r3
+L71: jmp *r0
+L72: jsr L110
+L73: .data 556, 894
+inc *r0
+cmp #-225, #-70
+m1
+inc r6
+L74: .data 931, -164, -504, -991
+not L40
+prn r0
+inc *r1
+m1
+L75: cmp *r6, r5
+not *r5
+L76: dec L0
+L77: .string "rcfytcxgrjicjcgd"
+cmp L85, #253
+m1
+red L101
+L78: lea L119, *r3
+inc *r3
+L79: clr *r6
+m1
+L80: .string "vhyyktadrvdhppynnniikkcq"
+L81: .string "kphrdmcde"
+L82: sub *r0, *r3
+m4
+mov *r1, L68
+cmp *r7, r1
+jsr L83
+L83: .string "czdaiieiilyskwaetpbiad"
+L84: lea L69, r7
+jmp L14
+L85: rts
+L86: rts
+L87: red *r6
+L88: lea L118, *r2
+m4
+; comment
+m4
+L89: .string "ksoxlaxnbtlfrklwmdnlqkug"
+jmp L80
+clr r2
+m2
+bne L10
+L90: .data 927, 597, 956, -134, -600, 649, -582
+L91: .data -818, -921, 977
+m4
+m4
+lea L112, r4
+
+mov *r3, r0
+stop
+L92: .string "zghjkt"
+sub L17, *r5
+m4
+m0
+inc *r2
+dec r5
+prn L21
+inc *r3
+dec L112
+add r4, *r3
+jmp *r6
+m1
+dec L113
+L93: add #-51, r6
+cmp L78, L66
+red *r2
+m3
+; comment
+L94: mov *r0, L54
+prn L55
+rts
+mov *r4, *r0
+L95: prn *r4
+stop
+m3
+mov #-142, *r2
+stop
+m3
+L96: .string "fcvlpbqqnxbtnyyzygy"
+L97: .data -572
+L98: .data 904, 699, -140, -283
+mov #68, r0
+red *r4
+cmp r3, #246
+L99: .data -965, -456, -405, 756, 752, 678
+m0
+m2
+red *r2
+jsr *r3
+not r5
+L100: .data -740, 506
+not *r0
+L101: .string "lhvbicuvpxdhktwdrlmljsi"
+lea L43, L111
+L102: .string "shbuxgnxjcqbkaryx"
+L103: stop
+not r3
+red r4
+cmp L52, #188
+L104: red r7
+prn #-191
+stop
+L105: not r4
+m2
+rts
+L106: .data 354, 678
+m1
+m2
+sub #-99, r2
+m2
+m2
+clr r0
+inc *r2
+L107: .data 703, -291, -494, -593, 381, -724, -661
+red L110
+dec *r7
+L108: .string "xrw"
+m4
+m4
+sub L119, *r6
+prn *r7
+L109: sub r4, r3
+add r0, L90
+m0
+red r4
+jsr *r4
+add #34, L119
+L110: .data 628
+bne L114
+stop
+stop
+clr r6
+jsr L23
+L111: bne L115
+bne L117
+dec *r5
+stop
+dec r1
+add r7, L18
+jmp L19
+m4
+cmp *r4, *r1
+L112: red *r0
+L113: .data -538, 736, -398, -210, 644
+m2
+red L106
+red L116
+dec L110
+L114: stop
+L115: red L118
+L116: red *r3
+not *r6
+m0
+m1
+bne *r4
+jsr L118
+jmp *r5
+clr L112
+m3
+jmp *r7
+m1
+m3
+m3
+m1
+m0
+m0
+mov *r6, r3
+stop
+jsr L75
+cmp *r4, L117
+L117: .string "ilr"
+rts
+stop
+clr r0
+L118: jsr L119
+add #84, L31
+; comment
+cmp *r1, L119
+prn L119
+inc L119
+m1
+clr r0
+m3
+sub #-121, *r3
+add L119, r7
+bne *r7
+L119: mov r3, L61
+sub *r7, *r5
+jmp L64
+cmp *r1, r0
+bne *r7
+
+not *r2
+m4
+jsr *r6
+clr *r0
+m4
+stop
+dec r6
+jsr L36
+jmp L33
+stop
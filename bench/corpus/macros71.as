@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 72
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    dec r0
+    stop
+    stop
+    jsr *r5
+    stop
+    add r0, *r2
+    stop
+    prn r4
+    rts
+    prn r5
+endmacr
+macr m1
+    bne L23
+    sub r6, r4
+    stop
+    mov r0, *r7
+    mov *r5, r3
+    stop
+    mov r1, r6
+    lea L78, r5
+    prn L48
+    not r0
+endmacr
+macr m2
+    not L100
+    lea L1, L42
+    inc L51
+    mov r4, L41
+    rts
+    jsr L67
+    dec *r6
+    inc *r1
+    not L38
+    dec L102
+endmacr
+macr m3
+    add *r2, *r1
+    stop
+    jmp L58
+    bne L77
+    red r0
+    cmp #32, L51
+    clr *r2
+    prn r2
+    rts
+    add r1, r2
+endmacr
+macr m4
+    cmp *r5, #-105
+    jmp *r4
+    not L58
+    lea L24, *r6
+    red r6
+    add r2, r4
+    jmp *r0
+    red *r7
+    inc L85
+    dec *r2
+endmacr
+; comment
+L0: add #241, *r7
+lea L0, r2
+L1: jsr *r1
+mov r1, r2
+m0
+L2: .string "vtewkqvjumwczprczurcmxq"
+red r1
+jsr *r5
+L3: .string "ybznloxonctotgzhdtggss"
+L4: prn L0
+mov *r7, r1
+L5: cmp #-60, L92
+rts
+not r2
+cmp L3, #70
+rts
+cmp *r1, *r1
+sub #-93, *r4
+
+stop
+m0
+m0
+L6: clr *r0
+L7: clr r3
+m1
+red r2
+rts
+sub #89, L0
+not *r5
+m0
+sub *r7, r1
+m2
+rts
+L8: .data -780, -151
+rts
+L9: lea L24, r4
+L10: .data -369, 243, 911, 483
+stop
+not r7
+m3
+m3
+L11: bne L111
+jmp *r4
+L12: .data 287, 787, -864, -2
+jsr L10
+sub r6, L26
+rts
+clr L6
+add r7, r4
+L13: .data -769, -319, 487, 270, 774, 74, -221
+red r0
+stop
+add r7, *r0
+prn L88
+L14: prn *r4
+sub r7, *r7
+m4
+rts
+dec r6
+bne *r5
+m3
+m4
+lea L78, r4
+L15: .data -329, 537, 369, -406, 603, 847
+stop
+mov L5, r6
+m1
+inc L59
+L16: bne L27
+sub #47, r1
+stop
+clr *r2
+dec L4
+m3
+cmp #-248, L1
+L17: .data 123, -650, -587, -538, 403
+mov L6, r0
+stop
+jmp *r4
+m0
+L18: .string "s"
+L19: .data 54, -433, -381
+L20: .string "lyihmnunmmtfttvt"
+m3
+L21: .data -991, -556, 233, -201
+add #-58, *r5
+bne L13
+L22: clr *r7
+add *r4, *r2
+m3
+add #-223, *r2
+L23: sub L46, r3
+m1
+m1
+lea L23, r6
+m1
+red r1
+L24: .string "kmiliomxoxinvmigbpfmm"
+prn L99
+L25: stop
+L26: .string "glfrvejjswlmbbrxsjutdzc"
+not *r6
+
+prn *r3
+jmp *r3
+jmp *r5
+
+red r3
+; comment
+stop
+jsr L12
+bne *r5
+add L20, L23
+mov r1, *r4
+L27: stop
+L28: .string "rfatnbpttj"
+m3
+bne L15
+jsr L8
+red *r6
+lea L87, *r6
+inc r6
+L29: jmp *r4
+cmp L11, r2
+m2
+lea L16, *r0
+lea L80, r5
+L30: lea L58, *r4
+inc r4
+red r4
+L31: bne *r1
+cmp L68, #-225
+m4
+rts
+rts
+prn r5
+L32: red *r6
+m2
+L33: .data 299, -548
+cmp *r0, #-256
+mov L10, *r5
+
+stop
+mov L3, *r7
+dec *r6
+m0
+rts
+add #-164, L20
+m3
+stop
+m4
+L34: .string "taiazeg"
+L35: add *r7, *r4
+sub *r4, *r2
+lea L107, *r6
+L36: prn r0
+
+m1
+jmp *r7
+mov r2, L26
+rts
+; comment
+inc L22
+L37: clr r3
+not r7
+mov r7, L96
+m0
+dec r6
+prn *r7
+m1
+L38: .string "wfalrzyorvj"
+L39: cmp #128, r4
+inc *r4
+rts
+L40: red r4
+prn L80
+bne L55
+
+L41: .string "rfyqos"
+L42: .data -529, -223, -949, 251, -413, 674, 897
+lea L19, r1
+L43: .data -281, 36, 476
+rts
+cmp #-224, #-167
+m0
+m1
+m2
+clr r7
+rts
+not L17
+stop
+m0
+m1
+jmp *r6
+rts
+L44: dec r7
+clr *r6
+jmp *r3
+L45: .data -992, 90, -377, -518, -774
+L46: .data 931, 75, 935, 322, 320
+rts
+m0
+clr L21
+m2
+stop
+m0
+L47: .data 739, 595, -911, 632
+prn r7
+
+bne *r5
+m0
+lea L76, L108
+L48: mov r2, L83
+inc r2
+inc *r1
+L49: .string "tnreccapox"
+L50: .string "vvmsci"
+L51: sub *r6, L59
+cmp *r5, *r3
+rts
+inc *r1
+bne L98
+m1
+jmp *r0
+L52: .data -614, 242
+red r5
+m4
+m2
+lea L4, *r0
+rts
+L53: jmp *r7
+m0
+sub #-104, r3
+jmp L23
+stop
+L54: .data -108, -413, 173, -367, 944, 439, -141, 582
+L55: .data -641, 699, -65, 696, -500, 556, -126
+jsr L2
+mov r5, r6
+L56: cmp r6, *r1
+sub #103, *r4
+m1
+mov *r4, *r1
+jmp *r6
+
+dec r5
+L57: stop
+sub r6, *r4
+L58: clr r1
+lea L8, r6
+inc L31
+lea L76, r0
+m2
+L59: not *r1
+m3
+m3
+dec L94
+mov *r3, r3
+sub #-204, *r7
+L60: jsr L97
+sub L12, *r2
+m0
+sub #230, r1
+not *r0
+L61: .string "hmkk"
+m2
+L62: .string "wnxt"
+sub #-89, *r6
+; comment
+L63: inc L86
+m3
+dec *r7
+m0
+m2
+dec *r0
+m1
+m4
+stop
+m1
+L64: not r5
+m4
+; comment
+bne L66
+red r6
+cmp *r6, L40
+bne *r0
+L65: .string "xzelrepcs"
+L66: stop
+not r0
+cmp *r5, *r6
+jsr L10
+jmp *r0
+m4
+rts
+m0
+m1
+L67: add L29, L57
+bne *r1
+m4
+m3
+L68: .data 304
+dec *r4
+L69: .data 177, 637, -174, 546, -695, 416, -14, -626
+red L90
+jmp *r5
+bne L65
+
+L70: dec L26
+L71: .string "zqlzbamhshauw"
+L72: red L113
+L73: add *r6, r3
+bne *r3
+clr L75
+prn L15
+stop
+L74: stop
+m4
+add *r0, L104
+red L80
+jmp L101
+mov #53, r3
+m2
+m1
+; comment
+red L12
+m2
+clr r6
+jsr *r3
+bne *r7
+not *r0
+L75: dec L92
+bne *r2
+dec *r1
+mov L55, r1
+L76: sub #148, r7
+bne L88
+red r2
+L77: dec *r5
+rts
+L78: clr r1
+L79: .data -481, -314, 960, 5, -493, -568, 596
+m2
+inc L89
+jsr *r5
+L80: .string "bkzgozmujwhntjqx"
+rts
+prn L25
+L81: clr r4
+clr L71
+m1
+m3
+
+m1
+bne *r7
+m1
+mov #54, r3
+dec *r4
+L82: .data -860, 527
+bne *r2
+lea L88, r0
+red L95
+rts
+red r6
+lea L106, *r4
+L83: .string "xqsfmddajhaa"
+red r1
+bne L21
+m1
+lea L113, L81
+prn L63
+L84: jsr L17
+inc L45
+L85: .string "tgheitqscnyvkozfarspm"
+L86: .string "wgawbzonikbpdgrcfntqgnvz"
+L87: .data -22, 5, 547, 72, 680, -618, -664
+prn #-169
+cmp #-145, L17
+clr L71
+add #102, L110
+L88: add #-71, L113
+lea L37, r3
+m1
+L89: mov *r1, r0
+m2
+m4
+L90: .data 33
+rts
+jmp L61
+red r5
+mov #-73, L111
+rts
+dec *r6
+L91: rts
+cmp r3, *r6
+dec r4
+mov *r6, *r7
+m3
+L92: .data 679, -607, 997, 636
+m1
+stop
+prn L102
+L93: prn r7
+dec L65
+; comment
+L94: red r6
+red r5
+prn *r5
+L95: cmp r0, r7
+m1
+sub #-249, *r3
+m3
+
+L96: .string "cfxezm"
+dec L99
+inc r3
+m1
+jmp L107
+; comment
+clr L115
+add #-239, *r2
+L97: .string "itwoldctghyyaumyci"
+m4
+m0
+rts
+L98: .string "reixiurpanyytqiwsxude"
+L99: .string "uuykleqwwcgiep"
+
+dec L28
+mov r7, r0
+add *r0, r1
+stop
+; comment
+m2
+L100: .data -748, 16, -648, 868
+m4
+lea L103, L26
+sub #0, *r6
+L101: .string "lff"
+red L11
+bne *r1
+L102: .data 287, -606, -290, 480, 704, 387, -342, -866
+jmp *r3
+dec r3
+m1
+not r3
+L103: clr r0
+prn r1
+bne L0
+L104: .string "dqhbmxmdaehhs"
+L105: .data 764, -680
+m4
+mov #93, *r5
+dec r0
+lea L115, *r3
+sub #-244, L114
+stop
+prn r2
+prn *r6
+; comment
+add #-9, r0
+m3
+L106: not *r0
+m1
+add #-185, r3
+jsr L102
+m3
+red *r4
+L107: prn #-84
+cmp L114, r6
+L108: .string "hhesodswfnlzvnim"
+L109: .data -377, 834, 14, 484, 841
+cmp *r5, r0
+lea L115, L113
+stop
+not r6
+sub r7, L52
+L110: .data -615, 279, -229, -757, 739, -504
+clr *r3
+L111: .string "kxyvr"
+rts
+prn *r5
+L112: .string "w"
+sub *r1, L102
+stop
+cmp #-184, #108
+bne L114
+prn L110
+cmp r0, r1
+add *r7, r6
+m1
+sub r3, L115
+L113: jmp *r4
+L114: jmp *r1
+mov *r3, *r4
+L115: .data 209, -147, 592, 178, 399, -103
+L116: mov r0, *r3
+stop
+m1
+red L76
+stop
@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 73
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    lea L26, *r7
+    dec L107
+    dec L95
+    inc r1
+    add *r7, r6
+    inc *r0
+    clr *r2
+    sub r2, r2
+    not *r5
+    not L97
+endmacr
+macr m1
+    mov L22, *r7
+    mov *r4, *r1
+    mov r2, L49
+    sub #171, r7
+    jsr *r3
+    stop
+    jmp *r0
+    not r1
+    rts
+    jmp L45
+endmacr
+macr m2
+    dec r0
+    lea L35, r7
+    clr r5
+    dec L71
+    bne *r7
+    cmp r2, #-231
+    inc *r7
+    prn L55
+    dec *r7
+    bne L95
+endmacr
+macr m3
+    sub #-37, r7
+    mov #189, L27
+    mov #-51, r3
+    rts
+    jsr *r7
+    red L67
+    lea L54, *r3
+    clr L39
+    clr *r7
+    red *r0
+endmacr
+macr m4
+    lea L14, *r2
+    rts
+    red *r4
+    jmp L75
+    jsr *r7
+    bne *r5
+    dec r5
+    jsr *r2
+    mov #17, *r2
+    prn r6
+endmacr
+jsr L67
+jsr L29
+clr *r6
+jsr *r3
+L0: not r5
+inc *r6
+stop
+L1: .data -504, -71, -569, 98, 259, -157, -644, 762
+L2: .data -665, 264, -496
+L3: clr L0
+L4: bne L91
+bne L0
+jmp L3
+m0
+add L4, L1
+jsr L1
+m4
+inc r5
+m3
+L5: lea L5, r6
+dec *r5
+L6: sub r2, *r4
+L7: .data 764, 845
+stop
+bne L3
+jmp L1
+m4
+L8: dec L80
+bne *r2
+L9: dec *r1
+L10: red L32
+cmp L14, *r7
+jmp *r0
+m4
+add r3, L6
+L11: clr r1
+L12: .string "egnsxgpouc"
+red *r1
+cmp *r4, L0
+; comment
+stop
+clr r1
+stop
+mov r6, L97
+cmp #-20, #164
+rts
+L13: prn r0
+sub r4, *r5
+; comment
+m0
+inc *r7
+not L68
+not *r5
+sub L7, L31
+L14: dec L10
+not *r5
+prn L10
+L15: clr L107
+m0
+m1
+red r7
+bne *r1
+jmp *r3
+clr r6
+bne *r5
+lea L50, r5
+jsr L56
+L16: lea L9, r0
+dec L9
+red *r7
+m0
+not *r3
+m2
+m2
+; comment
+L17: stop
+L18: .data 241, 702, -398, 940, 56
+L19: not r4
+jmp L74
+m1
+inc L15
+jmp L5
+dec L80
+m2
+L20: .string "hrkjcrnrick"
+m4
+L21: .string "jvfnxhomwwnrhieiyh"
+jsr L5
+jsr *r2
+L22: mov #220, r6
+cmp #-18, L5
+m4
+L23: rts
+L24: jmp *r0
+prn L54
+prn #234
+L25: .data -949
+L26: .string "useonctikqgvdr"
+add r4, L7
+dec L22
+not r2
+prn *r5
+L27: rts
+L28: .data -168, 955
+not L2
+; comment
+m0
+bne *r0
+stop
+L29: bne L80
+L30: rts
+red r3
+mov #-63, L88
+mov r6, *r2
+jmp L4
+m0
+mov *r0, L33
+L31: jmp *r5
+L32: .data -813
+lea L36, r2
+m3
+add *r4, *r2
+L33: bne *r2
+m0
+sub r1, *r4
+rts
+m3
+prn r1
+prn *r4
+rts
+add r4, L19
+prn r4
+m4
+red L31
+cmp #-67, #75
+dec r1
+clr L19
+lea L23, r7
+prn r0
+bne *r0
+L34: .string "ppvaavojwetyjkywjruxn"
+cmp #-121, #239
+bne L17
+sub L34, r3
+L35: inc *r3
+add *r7, L37
+
+rts
+bne *r7
+prn L47
+L36: bne *r3
+m3
+stop
+not r3
+
+
+m0
+bne L9
+L37: .string "qqblgh"
+mov #-174, r2
+m3
+clr *r4
+m2
+dec *r2
+m3
+inc L8
+
+add L24, *r6
+not L107
+red L102
+bne *r0
+dec r2
+inc r3
+L38: .data -916, 337, 466, -871, 97, 866
+m1
+lea L5, L61
+L39: jsr *r7
+rts
+m1
+m0
+bne L54
+mov r1, r1
+mov L17, *r1
+L40: .data 947, 860, 855, -497
+stop
+jmp L104
+bne *r7
+sub r3, L69
+mov #95, r3
+bne *r0
+inc r4
+jmp L81
+L41: stop
+L42: dec r2
+L43: .string "uvhpsl"
+inc L47
+m2
+prn #-107
+clr L29
+rts
+stop
+dec r3
+; comment
+lea L9, *r4
+add L82, r5
+L44: bne *r3
+lea L57, r3
+jmp *r5
+L45: jmp L61
+L46: .string "hol"
+mov *r4, r6
+prn r6
+L47: sub #-86, L37
+sub *r4, r5
+sub r3, L16
+bne L88
+sub #-133, L52
+L48: inc r4
+m3
+m4
+lea L54, *r5
+clr r5
+jmp *r4
+bne L2
+cmp r4, r3
+L49: prn *r4
+mov *r5, r5
+red r6
+L50: prn L101
+stop
+stop
+add #143, *r2
+m2
+mov L11, L59
+L51: jmp *r6
+dec *r2
+
+L52: cmp *r5, *r7
+L53: .string "cmgictybpthrl"
+
+stop
+red L44
+inc L105
+red L97
+m2
+m4
+L54: sub r5, L40
+m2
+stop
+lea L15, L1
+rts
+cmp r5, L34
+lea L58, *r3
+L55: .string "by"
+inc *r2
+add *r4, L53
+jmp L58
+L56: jsr L12
+
+jmp *r2
+jsr L81
+m1
+lea L98, L56
+sub L37, *r1
+dec L52
+m3
+m0
+rts
+m3
+not r2
+prn #63
+not L52
+jsr *r7
+; comment
+L57: .string "xwzndufdiuiiaavdo"
+jmp *r7
+jsr *r1
+m2
+mov L104, r2
+red r7
+stop
+m0
+m1
+cmp r5, #253
+m2
+sub #-183, *r7
+bne *r2
+red r3
+
+L58: jsr *r5
+jmp L37
+m1
+L59: mov #171, r4
+mov r2, L57
+stop
+L60: .data -124, -715
+m2
+; comment
+m1
+m1
+dec *r7
+clr r7
+clr *r5
+
+L61: .string "ldnrg"
+mov r4, r5
+jsr L25
+bne *r6
+mov r3, L56
+L62: prn #-121
+sub #-207, L51
+prn r0
+L63: .string "epdsszhqkqyyoiivq"
+mov *r3, *r0
+
+L64: sub r5, r4
+rts
+L65: .string "wbppiwgibzwzblwulfyywcx"
+m3
+; comment
+L66: .data 76, 119, -961, -732, 384, 312
+L67: .string "jqzypqirbukixjgue"
+; comment
+jmp L99
+L68: .data -28, 214, -947, -617, 863, 147, 81
+lea L95, *r4
+L69: rts
+stop
+add r4, r0
+rts
+m3
+m0
+lea L15, *r0
+L70: dec *r0
+m1
+not L108
+L71: .data 554
+L72: .string "devrrmteoiujftnjziwjpwe"
+rts
+red r6
+not *r7
+L73: .string "cujcdyscnirkij"
+clr *r2
+m4
+mov L4, L42
+stop
+L74: .data -53, -301, 101
+L75: .data -454, 107, 758, -338
+clr r4
+bne *r6
+clr L100
+add *r3, r6
+; comment
+stop
+not *r2
+stop
+mov r5, r7
+red *r0
+inc *r4
+prn r4
+bne *r4
+L76: .string "hendsuohowdzfvl"
+m2
+dec *r0
+L77: not r5
+red r0
+add *r0, r6
+L78: not L64
+red L105
+L79: red *r2
+m4
+; comment
+inc r5
+dec L42
+L80: .string "sxxuucpjqfgvmkysdyys"
+L81: mov *r7, r0
+L82: .data -599, -500, -499, -155, 110
+dec *r6
+L83: lea L43, L84
+L84: .string "rpvkrkwqytwdc"
+m0
+red L106
+
+bne *r6
+jmp *r0
+add L86, *r1
+jsr L15
+m2
+rts
+L85: rts
+jsr L96
+L86: inc L71
+rts
+bne L70
+jmp *r5
+L87: add *r1, r5
+L88: clr *r7
+m4
+inc r2
+cmp L79, #-65
+L89: clr r2
+m1
+jsr L91
+m1
+m0
+bne L7
+m0
+stop
+L90: dec r7
+jsr *r0
+L91: .string "kwkpfj"
+not L46
+lea L49, r3
+mov L97, *r3
+L92: bne *r3
+L93: .string "hjbhjeymdaqouvlnhdbwc"
+bne L97
+rts
+red *r5
+cmp r0, L57
+L94: clr L90
+m0
+cmp #-139, *r5
+jmp *r2
+
+cmp *r7, #-92
+L95: jsr L3
+m0
+bne *r2
+lea L105, *r4
+mov r1, r1
+L96: .data -372, -357, -759, 553
+jsr *r4
+bne L99
+; comment
+L97: jsr L99
+jsr *r3
+clr *r2
+mov #157, r5
+jsr L64
+stop
+
+m0
+prn #-90
+red *r6
+m2
+m1
+dec L106
+m3
+red L98
+L98: red L6
+L99: dec r4
+mov #-75, *r4
+m4
+clr r7
+bne *r6
+clr L106
+L100: not *r5
+red r2
+m3
+m3
+m2
+L101: .string "ujdagnrs"
+m4
+add #127, r4
+m2
+add L81, r2
+; comment
+red r5
+add r6, r4
+m0
+mov L107, r4
+L102: .data 944, 131, -35
+lea L104, *r6
+inc L10
+L103: .string "mfaljlzwqndhjlzg"
+add L106, L107
+inc L104
+stop
+red *r7
+m4
+cmp L58, #-180
+L104: jmp *r3
+; comment
+m1
+sub *r2, L82
+m1
+m0
+dec *r6
+m1
+L105: .string "uvtdtnvr"
+add *r4, L106
+m1
+L106: add *r6, *r0
+L107: add #148, r5
+L108: rts
+mov *r3, r0
+lea L89, *r3
+jsr *r0
+lea L62, *r3
+stop
@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 74
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    prn *r7
+    clr *r0
+    bne *r1
+    rts
+    rts
+    red *r7
+    bne *r1
+    red r7
+    sub r4, L14
+    inc r5
+endmacr
+macr m1
+    cmp *r0, L45
+    jmp *r6
+    jmp *r6
+    rts
+    jmp *r3
+    inc L62
+    lea L31, r3
+    inc *r7
+    clr r4
+    prn *r3
+endmacr
+macr m2
+    rts
+    prn r2
+    red L23
+    rts
+    bne *r7
+    mov L93, *r5
+    bne L14
+    add L52, *r5
+    mov L55, r4
+    jmp *r7
+endmacr
+macr m3
+    jsr *r0
+    rts
+    add #250, r1
+    inc r0
+    not r6
+    not *r7
+    mov #-49, *r4
+    sub L33, *r3
+    add #-231, L107
+    not *r7
+endmacr
+macr m4
+    inc r1
+    mov #-145, r5
+    sub r7, *r4
+    sub #-208, L53
+    sub r2, L90
+    inc L4
+    prn L17
+    mov #124, L43
+    add r6, *r3
+    sub r7, *r7
+endmacr
+bne L46
+m3
+m1
+prn L85
+m4
+lea L52, *r1
+clr *r6
+L0: .string "xvmuim"
+inc L0
+m4
+m2
+
+L1: .string "satjq"
+m1
+sub L99, r3
+m0
+stop
+dec r6
+m3
+L2: stop
+red *r0
+jsr *r3
+m2
+
+m1
+L3: rts
+L4: red r2
+lea L3, L6
+
+L5: dec r4
+cmp *r1, r7
+clr r5
+add #0, r0
+inc *r4
+not L88
+m2
+mov #-126, L47
+sub *r7, L73
+L6: rts
+L7: lea L87, L111
+jsr L88
+m2
+m0
+bne L5
+L8: .string "hgqiuafuhgbvmfi"
+L9: .string "fh"
+dec *r4
+L10: sub #69, r5
+bne L8
+clr L10
+lea L5, r2
+m4
+m1
+m0
+add #65, *r5
+m3
+L11: .data -386, 878, -367, -522, 191, 741
+L12: cmp *r4, #-147
+bne L7
+L13: mov *r6, L5
+dec L72
+m1
+m1
+
+
+lea L1, L11
+lea L11, L11
+lea L39, r1
+inc *r4
+L14: cmp #104, r3
+jmp *r2
+L15: red L10
+sub #55, *r5
+m1
+inc r1
+bne *r2
+sub #71, L56
+L16: .data 77, 295, 633, -370, -699, 428
+mov r4, *r1
+jsr *r6
+mov L4, *r0
+L17: clr r7
+clr L78
+red r4
+L18: cmp L61, #-6
+
+red *r5
+sub L19, L0
+m2
+m3
+red *r5
+not *r0
+prn #177
+prn r6
+m3
+mov #-134, r7
+dec r4
+stop
+m3
+L19: red *r7
+rts
+dec *r3
+m4
+m4
+cmp r5, #42
+red *r0
+m2
+L20: .string "ouunhwmkh"
+bne L2
+L21: not *r5
+inc r6
+not *r5
+jsr *r5
+sub #-44, r3
+mov #-214, r2
+L22: .string "krivdjwebxqfxml"
+bne L91
+rts
+L23: stop
+m4
+dec L42
+m3
+stop
+sub r2, r7
+L24: .string "oyggrqscbdgcdbimwqde"
+dec L30
+stop
+; comment
+inc r6
+L25: .string "cicgdwmkfrmw"
+lea L6, L18
+L26: lea L91, L8
+cmp r0, L20
+not *r2
+L27: jmp L27
+L28: rts
+L29: jsr *r4
+bne L22
+cmp #159, *r5
+sub r1, L21
+L30: .data -238, 607, -854, 977, -427, 935, 363, 29
+L31: .data -884, 687, 412, -342, -103, -615, 565
+m1
+add #23, L104
+not L14
+L32: mov *r4, *r5
+L33: .data 983, -275
+L34: .string "srlifjkd"
+prn #213
+inc L108
+m3
+add L39, *r2
+stop
+jsr L29
+inc *r2
+L35: .data -499, 987, 243, -155, 385, 554, -998
+mov #-32, *r3
+jmp L30
+m4
+
+L36: jsr L49
+L37: not *r0
+L38: .string "zklbceoztfmazmv"
+not *r7
+inc r1
+not r1
+add r4, L0
+L39: .data 587, 184, 752, 612, 109, -908, -262, 581
+cmp L3, L112
+L40: stop
+prn L40
+m4
+cmp *r2, r0
+lea L65, *r1
+red r0
+L41: red r2
+prn L37
+mov *r3, L89
+L42: dec *r2
+L43: stop
+red *r4
+stop
+L44: dec r6
+rts
+jmp L59
+cmp *r3, L31
+L45: jsr L43
+rts
+add L9, L109
+clr L73
+bne *r7
+mov #-22, L86
+sub *r7, *r1
+stop
+add r6, *r7
+clr *r6
+not r6
+m4
+cmp #-10, #36
+L46: .string "wfiwjzpcyzybfzolj"
+lea L32, *r3
+m3
+jmp L56
+L47: .string "bolounwfnoirorfm"
+add r3, r6
+L48: .string "odkqwv"
+sub r7, *r2
+add r1, *r0
+dec r1
+m2
+
+bne L48
+not *r4
+L49: jmp L60
+m2
+m3
+inc *r4
+m0
+dec r5
+m3
+jsr L51
+L50: bne L45
+L51: .string "vtwgzbumooumkdn"
+sub #-196, *r6
+cmp *r3, r0
+
+L52: add L100, r1
+cmp L48, *r2
+stop
+bne *r7
+L53: mov L54, L14
+L54: clr L49
+jsr *r0
+red *r4
+clr *r6
+sub L6, r7
+m4
+prn *r3
+prn L13
+m0
+m0
+rts
+L55: stop
+add #-63, r6
+sub #83, L52
+m2
+cmp r5, *r7
+L56: add r1, *r1
+L57: .string "krfd"
+sub *r4, r0
+dec r7
+add r1, L6
+inc *r1
+prn L92
+cmp L21, L31
+jmp L44
+L58: .string "aknmkzf"
+jsr L17
+add *r0, r2
+m2
+cmp *r4, #-67
+rts
+rts
+L59: .string "fhiojqbbdjrbvhhikei"
+red r2
+bne L81
+L60: jsr L2
+m2
+m2
+inc *r3
+stop
+not L38
+rts
+cmp #-46, L97
+not L34
+L61: sub *r4, L99
+rts
+L62: .data -759, -770, -542, 972
+lea L81, *r5
+red r0
+dec r3
+dec *r1
+; comment
+m3
+m2
+L63: add r5, *r5
+
+jsr L10
+not L95
+L64: jmp *r6
+add *r5, *r4
+rts
+clr r7
+L65: cmp r0, L25
+m4
+not L98
+mov L70, L99
+m4
+bne *r7
+stop
+L66: .string "xcnhpyanebhp"
+L67: .string "llovkz"
+L68: not L46
+m2
+m1
+L69: not L65
+m4
+m3
+bne *r1
+L70: prn *r3
+jmp L111
+prn r5
+cmp r2, *r5
+L71: not *r1
+red *r0
+bne L43
+L72: .string "xddpxwu"
+red L99
+bne L31
+m3
+m2
+
+L73: bne L76
+rts
+L74: inc L55
+dec *r6
+L75: sub r3, r0
+stop
+add L83, r5
+m4
+m4
+cmp r6, L81
+L76: .string "tkgplkcrakqashpadeehumo"
+prn *r0
+mov L52, r0
+m4
+m3
+prn r1
+L77: .data -546, -648
+jmp *r1
+inc L106
+bne L80
+jsr L38
+stop
+m3
+L78: prn r3
+rts
+L79: stop
+lea L86, r2
+clr r6
+L80: .data -883, 752, -390, -361, -510, -252, 644, -601
+m2
+lea L112, L104
+stop
+L81: jmp *r5
+L82: .data 702, -305, 710, 19, 403
+L83: .string "zb"
+m4
+rts
+L84: .data 71, -803, 42, 820, -403, 133, -684, 178
+lea L113, r7
+inc r7
+sub r5, *r4
+m3
+L85: not *r6
+dec L111
+jmp L98
+m1
+lea L111, r2
+red *r0
+cmp *r5, #-221
+dec r5
+prn r1
+clr *r2
+L86: .data -622
+m3
+stop
+rts
+inc r7
+m2
+L87: .data -86, -463, -379, -678, -17, 28
+L88: rts
+clr r4
+sub L95, r3
+; comment
+mov L98, *r1
+L89: .data -701
+m4
+rts
+L90: jmp L110
+clr *r6
+m2
+dec r2
+L91: .data 258, 934, -936, -981, 104, 722, -73, -683
+mov L18, L98
+mov #182, r0
+m1
+add r7, r5
+; comment
+m2
+cmp #-241, *r6
+cmp r6, L113
+stop
+clr r7
+jmp *r0
+sub L65, r6
+jmp *r2
+stop
+L92: jsr L98
+clr *r4
+mov L108, L48
+; comment
+L93: lea L62, *r5
+m4
+L94: .string "jwgjplymwcuvxwntgbipnh"
+bne L7
+prn *r4
+L95: add #-32, L75
+L96: cmp #-192, L106
+jsr L108
+inc *r3
+clr L99
+lea L4, L60
+m4
+sub L111, r2
+bne L104
+cmp *r2, *r2
+m2
+L97: not *r5
+; comment
+m2
+jsr L80
+not r5
+m1
+m1
+L98: lea L79, L108
+add *r3, L46
+; comment
+; comment
+jsr *r1
+L99: clr *r5
+rts
+bne *r2
+clr r6
+red *r5
+L100: .string "jfwimhinne"
+lea L43, L102
+dec *r0
+add #-188, L110
+L101: .data -968, 710, -625, -354, -808
+clr L22
+mov L102, r4
+dec r7
+
+not r1
+not r1
+L102: sub #-178, r1
+prn r5
+L103: not L105
+rts
+clr L44
+stop
+L104: .string "cnxyjwjnrpiv"
+L105: .string "z"
+m3
+mov L110, *r1
+red r7
+rts
+L106: lea L70, r3
+stop
+bne *r2
+not L108
+rts
+jmp L103
+dec r2
+; comment
+L107: prn L110
+L108: prn #-240
+bne *r4
+L109: lea L110, *r7
+red L16
+m1
+clr r1
+L110: lea L111, *r2
+; comment
+L111: .data -541, 297, 705
+jsr L112
+mov L113, r1
+clr L113
+L112: prn r3
+bne L17
+lea L113, *r1
+inc L113
+
+cmp #-175, r5
+L113: .data -601, -108, 529, -136, -353
+dec r3
+sub L82, *r7
+clr L51
+m4
+stop
@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 75
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    sub #107, r0
+    red L26
+    red L78
+    stop
+    mov #-194, r5
+    jsr L103
+    jsr *r4
+    add L67, r3
+    cmp *r5, r1
+    rts
+endmacr
+macr m1
+    add L37, L57
+    not L1
+    dec r2
+    add L80, r0
+    cmp L73, r3
+    jmp L6
+    cmp #-50, *r6
+    add #36, r5
+    rts
+    cmp r0, #-105
+endmacr
+macr m2
+    prn #237
+    stop
+    inc L10
+    clr *r3
+    rts
+    jsr L22
+    stop
+    rts
+    prn r3
+    mov #-105, *r6
+endmacr
+macr m3
+    inc r7
+    bne L7
+    dec L16
+    cmp #-62, L19
+    not *r6
+    prn L22
+    jsr L29
+    dec r1
+    add #99, L80
+    clr *r4
+endmacr
+macr m4
+    stop
+    dec r3
+    jmp *r5
+    jmp L102
+    clr r5
+    not r3
+    bne L47
+    lea L74, r4
+    clr r2
+    rts
+endmacr
+; comment
+clr r2
+clr r5
+m2
+L0: jsr *r6
+m2
+L1: stop
+rts
+not r2
+m1
+rts
+m2
+m0
+L2: .string "rponiicvfjovcngnnbhjd"
+m2
+dec *r5
+mov r5, L0
+m3
+m2
+
+m0
+jsr *r3
+dec L77
+L3: inc *r0
+stop
+red L1
+add #58, L80
+stop
+m4
+m2
+; comment
+rts
+not r1
+prn r1
+
+m4
+inc *r6
+L4: jmp L1
+m3
+L5: prn r5
+stop
+inc r4
+cmp r0, #190
+L6: .data 775, 235, 321, 563, -199, 893, -197, -963
+sub L19, *r6
+lea L10, L105
+L7: bne L62
+m0
+L8: .data -935, -884, 35, -841, 300, -180, 930
+m4
+stop
+sub *r1, L5
+L9: .data 200
+L10: lea L10, L10
+add *r4, L27
+m3
+lea L63, *r7
+lea L6, r7
+add L3, *r1
+jsr L6
+inc L35
+L11: .string "wbu"
+
+L12: .string "zyyrxbeeltgeobykaplhp"
+prn r7
+add *r3, r7
+L13: inc *r1
+lea L13, r0
+L14: .data -809, 992, 118, -150, 658, 395, 650
+bne *r2
+L15: sub #36, L44
+L16: bne *r2
+L17: lea L99, *r3
+jsr *r5
+m4
+L18: red r5
+L19: not L44
+red *r5
+sub *r2, L6
+inc r7
+L20: lea L30, *r1
+L21: .data 745, 546, 236
+L22: .data -383, -745, -995, 377, 250
+sub #-219, L22
+mov r7, r4
+mov *r4, r3
+rts
+stop
+red r4
+L23: dec L42
+rts
+L24: .string "mnpstfatrjzfwasewq"
+sub r0, L6
+m0
+mov *r5, r0
+bne *r4
+m2
+mov r7, r5
+L25: inc L57
+dec L13
+jsr L11
+cmp L89, L45
+L26: dec L2
+add L75, r4
+m1
+m4
+red L100
+dec *r7
+m1
+m1
+inc *r2
+m4
+bne L40
+sub *r6, L98
+lea L4, *r1
+
+bne *r4
+bne *r1
+jsr *r5
+sub L10, *r6
+prn *r0
+L27: lea L104, r4
+add r3, *r0
+stop
+clr r1
+sub L1, r6
+lea L3, L95
+jsr L89
+sub r6, L64
+bne L11
+inc r6
+clr r5
+lea L66, *r2
+jsr L16
+L28: .string "fernguwthudkwww"
+m0
+bne *r3
+m3
+jmp *r2
+m1
+dec r7
+L29: not L41
+bne L16
+add *r3, r3
+add L96, L16
+
+mov L99, L45
+not L12
+jmp L16
+L30: prn #-225
+lea L59, L33
+m0
+lea L11, L17
+L31: .string "ueeldlcxxrv"
+clr *r2
+cmp #-53, r3
+bne L11
+L32: jsr L6
+L33: .string "etupqjzbepyhtp"
+lea L62, *r3
+jsr *r6
+inc r6
+bne *r5
+m2
+clr r3
+mov *r6, r5
+mov *r6, *r6
+rts
+add *r7, r3
+clr L45
+L34: cmp *r0, L75
+L35: cmp L43, L29
+m2
+clr L95
+dec *r0
+jmp L22
+m4
+cmp *r1, #199
+inc r6
+not *r3
+L36: mov *r0, *r1
+L37: .string "wnlcxqdtrepfodo"
+lea L70, *r2
+not L62
+lea L69, L108
+prn #78
+L38: .data -190, -495, -605, 715
+L39: jmp *r3
+prn r4
+L40: .data 358, 635, -424
+m4
+L41: mov #-39, L50
+m4
+mov #-166, L31
+sub *r4, L104
+rts
+bne L69
+dec *r1
+cmp L22, *r7
+m4
+L42: prn #89
+dec r6
+L43: .string "aunkcplcxdvjldugnovxsqrx"
+dec r0
+jmp L77
+inc r3
+inc r7
+lea L30, L7
+L44: stop
+rts
+m1
+not *r2
+clr r1
+L45: bne *r3
+lea L7, r7
+stop
+L46: red r5
+m4
+bne *r0
+prn *r6
+inc *r1
+add *r7, r3
+jmp L84
+L47: .data 219, -799
+L48: jmp *r0
+m0
+m3
+; comment
+m0
+L49: .data -473, 245, -960
+m3
+red *r2
+jsr *r0
+cmp #210, *r2
+not r3
+stop
+jsr L7
+dec r5
+m4
+prn r0
+clr *r5
+; comment
+lea L5, *r0
+rts
+stop
+prn r4
+add L28, L34
+inc L44
+m3
+m1
+sub *r3, r6
+inc r4
+lea L43, L35
+L50: add r3, L104
+m4
+cmp *r2, *r1
+bne L63
+mov r1, L95
+lea L85, L84
+clr L26
+prn #-211
+jmp *r3
+L51: .data -630, -846, 571, -63, -672, 908, 815
+jmp *r0
+clr L15
+red r5
+m0
+L52: bne L73
+not L28
+inc r1
+L53: dec L23
+cmp L76, #-35
+L54: bne *r2
+inc L9
+m2
+m4
+cmp #-25, *r7
+prn *r5
+bne L0
+m4
+m2
+rts
+L55: lea L105, r2
+stop
+lea L104, L75
+L56: .data 656, 380, -256, 653, 672, -892
+red L93
+L57: jsr L108
+rts
+lea L50, r2
+L58: red *r6
+L59: lea L15, r7
+L60: lea L16, L106
+prn #-243
+not L104
+prn *r7
+m3
+m4
+m0
+inc L30
+L61: .string "chgbyqapummlsq"
+lea L69, r4
+; comment
+not L60
+m0
+L62: sub *r7, L37
+sub r5, L99
+L63: sub #-157, r7
+dec *r7
+m2
+dec L22
+cmp #-234, *r4
+L64: .data -964, -175, -704, -368, 444
+L65: .data -100, 834, -94, 928
+add #251, r1
+jmp L109
+L66: .string "ampuwsqmbpvwhxpn"
+m0
+m4
+bne L30
+L67: cmp *r0, #171
+not *r2
+L68: .string "vjbjksjcwerdjznnygwfnb"
+L69: add r7, L84
+lea L75, L70
+L70: add r5, L82
+m1
+lea L32, r6
+m4
+clr *r7
+stop
+rts
+m4
+
+add #-81, L96
+L71: sub r5, r4
+mov #170, *r7
+m1
+L72: .string "bhmld"
+dec L82
+m2
+; comment
+prn r3
+dec r0
+L73: prn *r7
+L74: mov *r4, *r1
+stop
+dec *r6
+stop
+dec L36
+L75: .string "kcjzgcx"
+rts
+m2
+m3
+clr L90
+m4
+jsr *r2
+mov *r3, L39
+L76: sub r4, r4
+L77: cmp #-123, #86
+jmp L72
+rts
+L78: jmp L103
+L79: inc *r6
+add #158, *r6
+L80: .string "lbtrtfajl"
+clr L14
+clr *r0
+red *r3
+jsr L66
+add L26, *r5
+m1
+add #33, r6
+red *r2
+jsr L43
+; comment
+add L44, *r5
+add L90, L61
+rts
+jsr *r2
+L81: .string "e"
+add *r0, r4
+clr L105
+L82: dec L78
+stop
+lea L20, r7
+sub r1, *r7
+L83: not L88
+L84: rts
+L85: .data -852, 567, -350, -861, -103, 58, 878, -403
+m2
+red r2
+m2
+
+add #171, r3
+L86: not r2
+rts
+not L103
+m0
+L87: sub r4, *r7
+not L45
+mov r0, L49
+m1
+clr r0
+sub #131, r4
+L88: sub *r4, L105
+m1
+L89: .string "awqusbcbyyccipefkjrqnwe"
+cmp #32, r2
+
+mov L98, r1
+dec r4
+mov L89, r5
+m3
+add *r0, *r0
+
+rts
+dec L16
+not *r2
+dec r0
+add r1, L37
+L90: .data 904, 689, 846
+dec *r6
+m2
+clr *r6
+L91: rts
+m4
+sub r6, L100
+mov L67, r6
+bne *r7
+red L109
+rts
+L92: .data 75, -318, -410, 940
+m1
+L93: .string "ywqj"
+inc L106
+
+L94: rts
+rts
+mov #-77, r2
+mov #214, *r4
+clr *r0
+L95: .data -659, -94, -77, 624, -121, 447, -541
+rts
+cmp #89, r1
+dec L22
+L96: red L90
+dec r7
+m0
+jmp L56
+red r3
+stop
+jsr L101
+dec r4
+m3
+m0
+prn *r6
+add *r2, r7
+m1
+L97: lea L85, *r1
+m4
+cmp L104, #95
+L98: dec r5
+m0
+L99: lea L100, *r5
+inc *r4
+m1
+m3
+; comment
+add *r2, *r7
+rts
+m1
+L100: cmp L101, *r0
+L101: .data 969, 263, 704, 810, 286
+cmp L23, #-30
+m3
+m4
+inc r4
+L102: lea L28, *r1
+m4
+
+L103: mov #145, r5
+add #216, *r4
+
+red L109
+rts
+L104: jmp L6
+dec r6
+L105: cmp *r2, *r1
+
+add L44, *r4
+mov #-112, *r7
+L106: .data -652, -588, 60, -884
+L107: add #-233, L109
+add L108, r0
+L108: .string "ssdgyztccveyuwzi"
+m1
+L109: jmp L61
+
+sub #59, L46
+stop
@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 76
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    mov #-69, *r4
+    dec r1
+    mov *r6, r3
+    inc r1
+    prn L56
+    clr r6
+    mov *r5, L77
+    dec r1
+    lea L79, L62
+    inc r6
+endmacr
+macr m1
+    dec r6
+    inc r7
+    inc L7
+    bne *r2
+    sub #254, *r3
+    bne *r1
+    cmp r2, #-146
+    lea L98, L16
+    not *r4
+    stop
+endmacr
+macr m2
+    inc *r2
+    inc L81
+    dec L64
+    add r3, *r2
+    bne *r3
+    lea L67, L53
+    add #235, L5
+    rts
+    clr *r1
+    not *r6
+endmacr
+macr m3
+    jsr L44
+    bne L62
+    red r5
+    jsr L23
+    mov L75, L35
+    red *r4
+    stop
+    dec L54
+    red L39
+    rts
+endmacr
+macr m4
+    mov r3, *r7
+    stop
+    sub r2, r1
+    dec L55
+    lea L100, *r1
+    bne *r6
+    rts
+    rts
+    inc *r5
+    red r7
+endmacr
+m4
+m4
+clr *r1
+m0
+m1
+prn r4
+m4
+lea L78, L74
+stop
+L0: .string "khffhfolzxbohakn"
+bne *r4
+L1: cmp r0, r2
+m1
+L2: .data 702, -313, 817, 359, 274, 813, -695, 714
+m3
+red *r7
+stop
+m4
+sub #-43, *r0
+dec L2
+L3: cmp *r1, *r6
+jsr *r4
+inc L2
+m3
+L4: cmp L18, #-64
+jsr *r3
+m0
+jsr *r7
+m1
+sub *r6, *r2
+stop
+m2
+m0
+bne L50
+not *r1
+L5: bne L5
+jmp L94
+L6: dec *r0
+m0
+mov r6, *r3
+L7: .data 247, 207, -316, 337
+m3
+L8: clr L30
+m3
+L9: .string "xroolpkezu"
+L10: not *r7
+prn L58
+dec *r6
+L11: bne *r0
+lea L6, r0
+L12: jsr L2
+dec r3
+L13: lea L5, *r4
+clr *r4
+inc r1
+add *r0, r5
+bne *r0
+m2
+m3
+
+m2
+L14: rts
+dec r6
+L15: .data 151, -740, 349, -128, 608, -341
+L16: .data -607, 558, -245, -939
+rts
+red *r2
+m1
+cmp r4, r2
+bne L62
+m3
+L17: not L95
+cmp *r0, L7
+m1
+sub L62, L12
+L18: jsr L37
+L19: .data -254
+cmp #45, r6
+; comment
+L20: not *r2
+m0
+m3
+jsr L24
+stop
+
+clr r1
+clr *r4
+m1
+add *r7, *r6
+; comment
+L21: .data 893, 164, 962, -367, -980, -900, -625, -967
+mov r0, L69
+not r0
+mov *r5, r3
+L22: .string "kaayshulfxhrnis"
+
+inc *r3
+m0
+clr *r0
+L23: .string "tvghqvbuurmntfwrmltv"
+L24: prn r5
+sub r1, r4
+inc L8
+L25: prn #64
+cmp #202, *r1
+red r0
+jsr L18
+m1
+L26: rts
+; comment
+m1
+jmp L22
+inc L85
+m3
+clr r4
+L27: .string "imfwawqjcfdea"
+; comment
+rts
+cmp L12, r7
+L28: red r2
+L29: prn *r5
+; comment
+sub L41, L99
+L30: stop
+L31: sub *r0, *r1
+not *r1
+cmp L97, r6
+jmp L23
+rts
+sub *r6, *r4
+cmp L42, #-55
+
+prn *r6
+L32: not *r3
+not L82
+; comment
+m3
+stop
+stop
+L33: inc L15
+m0
+m0
+not r1
+rts
+
+L34: not *r7
+m4
+; comment
+stop
+jsr *r6
+rts
+L35: dec r0
+dec L85
+L36: .data 601, 843, -290, -688, -665
+prn #-239
+L37: .string "thmpwnonsm"
+L38: red r3
+m4
+mov L29, r2
+sub #251, L21
+jsr L43
+m1
+prn *r6
+L39: .string "vhvcgferahxihqmql"
+dec L48
+mov L76, r2
+m1
+not L52
+L40: add L32, L68
+jsr *r5
+add #-1, L76
+jsr L0
+jsr *r3
+
+L41: sub r0, r7
+cmp L47, r5
+L42: clr L50
+clr r0
+red r6
+L43: .data -320, -721, 431, 385
+m2
+jsr *r4
+prn *r2
+; comment
+m4
+bne *r7
+prn #39
+sub L87, L42
+stop
+stop
+mov L48, *r1
+L44: add r3, *r2
+L45: sub L98, r4
+cmp *r6, *r0
+rts
+clr *r4
+L46: stop
+m3
+; comment
+m0
+add #190, L57
+lea L95, *r2
+L47: jmp L96
+L48: dec r4
+rts
+stop
+dec L6
+m3
+mov #-143, L34
+
+L49: .string "jhvwvdjnoiyofcscheftash"
+dec *r4
+rts
+cmp L36, #-150
+L50: add *r3, L90
+L51: jmp *r3
+lea L84, L100
+L52: clr L75
+mov L30, r2
+lea L33, *r2
+L53: jmp L94
+not *r6
+
+L54: .string "wpwfdhuaokvwsykp"
+dec *r0
+inc r7
+; comment
+not L86
+not *r1
+lea L71, r1
+stop
+lea L104, r2
+inc L9
+m2
+rts
+; comment
+L55: jmp L87
+m1
+m2
+m2
+lea L68, *r6
+L56: jmp L2
+bne L98
+L57: mov *r5, *r7
+m0
+add *r5, r2
+inc L70
+m3
+cmp #-171, L53
+red L7
+stop
+; comment
+
+L58: .data -154, -636, 579
+mov L36, L66
+clr L78
+lea L5, *r4
+bne *r3
+L59: red L77
+m3
+mov L40, L53
+L60: dec L74
+mov L61, L95
+not r4
+red *r2
+; comment
+inc *r7
+sub *r5, L15
+L61: .string "dtpe"
+clr *r2
+lea L79, r4
+; comment
+red *r0
+mov L55, L21
+not r5
+add *r0, *r6
+L62: .data -823, -61
+not r6
+L63: jmp *r2
+m1
+red L72
+jmp L5
+; comment
+inc L38
+clr *r7
+not r3
+mov r4, r0
+prn #219
+jsr L92
+m3
+prn #49
+rts
+m3
+dec r2
+jmp L26
+jmp L36
+L64: cmp #-178, *r4
+clr L103
+m2
+L65: prn *r0
+
+sub #-73, r3
+not *r1
+L66: .string "mqhreisesihcvs"
+jsr *r7
+m2
+m4
+jmp L25
+sub #-150, L69
+
+sub *r5, r4
+jmp *r2
+L67: .string "ejdjpkstyowixkblxa"
+red *r5
+L68: .string "bt"
+m1
+rts
+sub r0, r3
+inc L90
+cmp #174, *r6
+L69: cmp L75, *r6
+m2
+L70: add #235, *r2
+m4
+rts
+inc L104
+; comment
+m4
+prn L89
+clr L11
+not r5
+L71: .string "avlfusotflqpvwlodzxyro"
+m0
+L72: prn *r6
+m0
+jmp L8
+sub r3, L82
+m2
+stop
+jmp L102
+jsr L42
+m1
+stop
+not r1
+inc *r7
+mov *r3, *r2
+m0
+m2
+cmp #95, *r3
+L73: sub L95, *r3
+stop
+m1
+L74: sub *r5, r7
+; comment
+L75: .string "vfnwaogezn"
+L76: sub *r0, *r5
+jmp *r1
+inc *r6
+L77: .data -891, -344, -439
+m3
+rts
+clr L47
+m2
+L78: add *r4, *r6
+m4
+L79: red L97
+m2
+m1
+cmp r4, L81
+prn #133
+L80: inc r3
+
+L81: jmp *r5
+not L11
+m0
+jsr L94
+jmp *r3
+m0
+dec r0
+L82: .string "zvetyqxpeh"
+m1
+cmp L104, #234
+L83: .data 909, 267, 800
+lea L76, *r6
+sub *r5, L86
+mov r7, L51
+L84: .string "gwznmgjdtflwxfcehodll"
+add r4, L102
+lea L104, L9
+m2
+m2
+add #126, L98
+rts
+clr L99
+L85: bne L60
+clr L98
+sub #200, *r1
+rts
+m0
+L86: .data 651, 126, 40
+jmp *r0
+bne L105
+clr *r6
+L87: .data -128, -908, 418, 808, -845
+L88: sub r5, r7
+prn *r1
+L89: .string "yfqzqgr"
+L90: clr r5
+jsr L98
+L91: .data -699, 68, -447, -885, 445, 92, 117
+dec *r1
+cmp r3, L102
+sub *r3, L105
+m0
+L92: lea L57, *r3
+L93: red *r6
+mov #-44, r4
+stop
+red r2
+dec r4
+clr L94
+m2
+bne L102
+prn *r6
+rts
+red r2
+m0
+clr *r7
+stop
+L94: .data 600, 634, -280, 445, -615, 530, -687, -78
+m0
+stop
+not L42
+rts
+L95: red r7
+m3
+lea L31, *r0
+prn #-132
+red L93
+bne L67
+prn r3
+L96: clr r0
+L97: dec L103
+L98: .data -810, 37, -700, 184, 354, 734, -496
+m0
+prn #186
+rts
+lea L10, *r5
+; comment
+m0
+; comment
+m1
+add #-179, r5
+inc r3
+not r5
+m4
+bne *r4
+jsr L104
+clr L103
+m0
+m4
+lea L91, L102
+L99: jmp L71
+m2
+m1
+clr r4
+sub *r0, r5
+add r7, r6
+add r7, L105
+clr L12
+L100: mov #123, *r5
+dec *r5
+lea L101, r4
+rts
+L101: sub #252, r5
+m4
+dec L69
+mov *r5, r4
+L102: .data 493, -822
+lea L105, r6
+m3
+m4
+dec *r5
+jsr L18
+add *r2, L103
+lea L103, r2
+L103: clr *r0
+cmp *r7, *r2
+add *r5, r7
+m1
+L104: dec r4
+rts
+not r6
+L105: jsr L19
+inc r6
+bne *r7
+not r0
+add L87, *r7
+dec *r5
+; comment
+stop
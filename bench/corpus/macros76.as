@@ -0,0 +1,571 @@
+; Generated by genCorpus --seed 77
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+macr m0
+    red r2
+    prn L0
+    not L58
+    prn r7
+    prn r7
+    bne *r5
+    rts
+    jsr L130
+    rts
+    rts
+endmacr
+macr m1
+    red r6
+    stop
+    lea L126, L71
+    dec r0
+    stop
+    red L28
+    bne L120
+    red L120
+    prn r0
+    add r3, *r6
+endmacr
+macr m2
+    not r6
+    rts
+    stop
+    bne *r0
+    red L42
+    sub L76, L125
+    jmp L57
+    add L22, r4
+    jmp L105
+    prn L55
+endmacr
+macr m3
+    inc r5
+    jmp *r0
+    stop
+    prn #101
+    add L28, L3
+    dec r2
+    rts
+    jsr L69
+    dec r4
+    cmp #-196, *r2
+endmacr
+macr m4
+    sub #-5, r7
+    dec r4
+    rts
+    prn *r0
+    jmp L54
+    add r0, *r3
+    jmp L110
+    cmp *r4, r0
+    jmp *r1
+    dec *r7
+endmacr
+clr r4
+add L51, *r3
+inc L3
+prn r2
+sub #23, r4
+prn L124
+L0: bne *r7
+not *r1
+L1: lea L1, *r2
+m1
+L2: add L62, *r7
+jmp *r0
+not r1
+dec r6
+cmp *r7, *r2
+bne *r0
+lea L1, L0
+L3: .string "qdw"
+; comment
+L4: not L2
+L5: .data -817, -759, -179, 864, 216, 89, 660, 534
+stop
+bne *r1
+rts
+; comment
+L6: prn r4
+m0
+L7: prn L3
+L8: .string "vvwkerdicnw"
+jsr L2
+m0
+clr *r0
+mov #0, r3
+L9: .data 685, -278, 360, 249, 57, 218, 764
+m2
+inc L99
+m0
+L10: sub #15, *r0
+jmp *r6
+m2
+m1
+L11: clr *r2
+stop
+L12: .string "rtnjnmabzbuxqpywfrmqdkk"
+L13: .string "pvghhatqenynelvdksirecsl"
+inc *r1
+L14: .string "ntaixvgvquaxgfgzmtrouip"
+L15: .data -9, 611, -305, -355, -393, -411, -532, -764
+red r2
+L16: not *r3
+L17: .string "gibmhs"
+rts
+L18: jmp L8
+m3
+not *r0
+L19: prn r0
+dec L0
+
+L20: jmp L111
+L21: jmp *r7
+m3
+L22: lea L118, L20
+lea L96, L59
+cmp L6, #224
+L23: add #-63, L5
+m0
+jmp *r3
+jmp *r0
+red r6
+L24: .string "vjypehrvemmixtjuh"
+stop
+dec r4
+; comment
+bne *r3
+sub r2, *r4
+jmp L3
+bne *r5
+jmp L9
+m4
+stop
+sub *r6, L7
+m3
+L25: stop
+; comment
+L26: .string "juacglbxqlaiyjyyzqknufrl"
+not *r3
+add *r5, L104
+clr *r6
+L27: inc *r6
+dec *r2
+L28: .string "ibaabzejmaykqtb"
+mov L102, r5
+L29: jsr L72
+L30: .string "vpwepxyxxzscobq"
+L31: prn L26
+
+L32: jmp *r7
+red *r6
+inc *r3
+add L14, L37
+sub r7, *r7
+L33: .data 356, 975, -147, 823, 83
+bne L0
+L34: .string "fyazbsqvm"
+clr r7
+cmp L18, r6
+add *r5, r3
+dec *r3
+mov *r1, L115
+L35: dec r3
+stop
+jmp L34
+mov *r3, L21
+L36: add r1, r4
+m2
+L37: cmp #104, *r7
+cmp *r3, r1
+inc *r2
+L38: rts
+cmp r6, #252
+L39: rts
+jsr L23
+clr *r6
+; comment
+m4
+add r5, r6
+bne L13
+jmp *r0
+stop
+red L41
+m2
+L40: .string "mqxrcoxyfooyrufxyiieku"
+prn *r0
+L41: prn r4
+L42: .data -943, -299, 89
+m4
+L43: .data 252, 394, 246, 799, -241
+jmp L16
+L44: .data -982, -967, 969
+cmp L27, *r5
+L45: bne *r2
+inc *r5
+not r5
+jsr *r2
+prn L12
+prn L88
+; comment
+clr L11
+add #-80, *r0
+sub *r4, r5
+prn #141
+m0
+red *r5
+m2
+m4
+jmp *r6
+m0
+mov #25, L8
+m3
+stop
+L46: red *r6
+L47: sub *r5, L38
+m2
+add #-227, r1
+stop
+L48: .string "mpxlzruvcfbz"
+
+
+inc r1
+L49: dec L24
+dec L39
+
+not r3
+
+m3
+clr *r7
+m4
+L50: stop
+L51: dec r0
+inc *r4
+m3
+m3
+add *r2, L32
+
+red *r5
+m0
+m4
+inc r0
+L52: not r4
+not L50
+m4
+rts
+m0
+jsr L73
+bne *r4
+L53: rts
+jmp *r1
+rts
+L54: red L73
+mov L56, r1
+dec *r0
+L55: lea L109, r1
+jmp L26
+; comment
+lea L75, L21
+sub L1, L77
+mov r0, r3
+not L46
+L56: .string "nzwcuhm"
+not *r7
+sub r6, *r4
+rts
+m3
+m3
+rts
+L57: prn *r3
+lea L47, L15
+m2
+L58: stop
+m2
+lea L23, L78
+inc L88
+L59: .string "vykzksrhk"
+; comment
+L60: not *r5
+add L106, L32
+stop
+red *r5
+red L55
+red *r5
+jmp L13
+L61: .data 516, -975, 424, -164, -870
+L62: bne *r3
+inc L57
+add *r6, *r0
+L63: jsr L36
+not *r3
+L64: cmp *r2, *r1
+stop
+jsr L86
+mov L102, L75
+clr r0
+clr L38
+inc L116
+L65: prn *r1
+bne L111
+lea L64, r7
+sub r4, r1
+L66: rts
+m1
+cmp L113, #54
+bne L124
+
+inc L120
+sub #181, *r4
+L67: .data -215, 184, 728, -931, -303, 528
+L68: jsr *r0
+inc L71
+m0
+L69: clr *r3
+stop
+L70: cmp #-251, *r7
+add L114, *r0
+jsr L2
+L71: cmp *r3, *r6
+L72: .string "rxavldrpvunnkshkellubfny"
+dec L92
+
+mov r5, *r5
+add #-52, r4
+clr r7
+add L16, *r4
+L73: lea L117, r1
+L74: red r0
+L75: .string "ghypmsairnlahbyefl"
+inc *r4
+add L86, L115
+L76: rts
+cmp L27, *r3
+L77: sub *r7, r5
+m4
+prn #14
+prn L96
+L78: .string "raxqnmjzagrue"
+jmp L39
+L79: jmp *r1
+jsr *r6
+prn L114
+sub L106, r1
+L80: clr L90
+jmp *r3
+m3
+cmp L8, #132
+sub L68, r1
+mov r7, L104
+L81: clr *r2
+m3
+L82: not L33
+prn L113
+cmp r3, r7
+red *r4
+add *r0, L36
+
+L83: .data -923, -680, -719, -993
+
+L84: .string "rvmcempq"
+rts
+; comment
+red r3
+
+m2
+m3
+
+L85: jsr *r3
+
+mov L90, L88
+prn r2
+L86: .string "ptuwzguhrwyglmbzty"
+mov L5, *r1
+red r7
+bne L114
+L87: .data -809, 432
+inc L83
+jsr L58
+L88: jsr *r4
+m1
+; comment
+inc *r0
+m3
+add L2, r5
+prn r5
+stop
+L89: .string "ruyyegmbizarxrkdnozgx"
+
+L90: .data 423
+L91: jsr L7
+not *r0
+red *r2
+L92: add r1, r1
+m1
+red *r5
+clr L78
+clr L79
+lea L116, *r6
+L93: dec L86
+dec *r3
+red L73
+red r5
+inc L3
+add r2, r5
+not *r6
+L94: .data -193, -281, 410, 840, -123, -349, -668
+L95: lea L130, r3
+inc *r3
+L96: .data 741, 758, -81, -430, -201, -770, -455
+jsr *r3
+m4
+L97: clr *r2
+L98: add r1, *r5
+sub L61, *r3
+L99: jmp L130
+m4
+stop
+red r0
+sub r7, *r1
+clr L122
+m1
+L100: rts
+lea L119, *r3
+stop
+L101: .string "njipmjmpu"
+rts
+not *r4
+bne *r6
+lea L122, *r1
+m2
+mov r2, *r6
+bne *r5
+m0
+stop
+L102: .data 135, 703, -895, -383
+L103: .data -868, -895, 839
+L104: dec L49
+m4
+m4
+cmp #-201, r5
+L105: bne *r3
+jsr *r2
+jsr *r2
+; comment
+L106: mov r6, *r0
+L107: .data 142, -883
+lea L113, *r4
+m3
+L108: prn #252
+add #225, *r1
+clr r1
+m1
+m1
+m2
+sub r5, r7
+add L78, *r3
+m4
+clr *r0
+cmp #-172, r7
+dec *r3
+L109: prn #69
+L110: lea L72, *r4
+bne *r2
+cmp #176, *r1
+stop
+L111: .data -960
+L112: red r1
+not L5
+jsr *r5
+m1
+mov r1, *r4
+; comment
+L113: clr *r1
+inc r6
+bne *r4
+dec *r3
+red L5
+
+red L118
+L114: .data -442, -234, -665, 168, 843, -545, 530, -188
+jsr L116
+L115: .data 3, -833, -463, 342, 560, -357, 520, 467
+bne L107
+L116: .data 876, 677
+m1
+m3
+; comment
+jsr L125
+L117: cmp *r5, r2
+L118: rts
+m1
+rts
+L119: not L75
+L120: .string "kn"
+mov L114, *r2
+L121: bne *r1
+jmp L130
+lea L122, r4
+bne L128
+m4
+L122: .data -471, -959, -938, 646
+L123: sub r1, *r6
+
+stop
+red r6
+stop
+lea L124, L25
+m0
+prn L30
+cmp #-183, L2
+jmp *r7
+dec r0
+L124: .data 188, 987, -181, -571, 137, 277, -547
+inc *r4
+sub *r0, *r3
+; comment
+m1
+L125: add #-20, *r7
+dec L63
+m4
+mov r7, r1
+bne *r6
+m4
+m4
+mov #239, r3
+not r6
+add L126, L129
+stop
+cmp #110, L126
+; comment
+clr L126
+sub *r1, *r4
+L126: red L78
+L127: inc *r5
+m0
+clr L52
+red L47
+sub L130, *r0
+bne *r1
+L128: dec L130
+jsr *r1
+lea L96, L115
+L129: .string "xajzezlberpankug"
+jmp *r5
+rts
+
+mov L19, L130
+rts
+stop
+inc L28
+mov r6, L130
+prn L92
+L130: inc r4
+not *r2
+stop
@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 78
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    sub r7, r3
+    rts
+    inc *r6
+    red r4
+    jmp L5
+    dec L97
+    clr *r3
+    mov *r3, r4
+    jmp L32
+    sub L10, r0
+endmacr
+macr m1
+    red *r1
+    inc L19
+    rts
+    mov r5, L37
+    rts
+    inc L64
+    mov #172, *r5
+    lea L86, L70
+    rts
+    bne *r4
+endmacr
+macr m2
+    clr r7
+    inc *r2
+    mov L59, *r6
+    stop
+    mov r0, L71
+    add r3, *r5
+    prn #-153
+    mov #-215, *r5
+    clr *r0
+    mov r4, r5
+endmacr
+macr m3
+    add L84, L10
+    prn *r5
+    inc L50
+    sub L84, *r4
+    dec L104
+    dec r6
+    clr L96
+    jsr L64
+    not r7
+    not L32
+endmacr
+macr m4
+    not r6
+    add #-13, L24
+    clr r5
+    lea L21, L56
+    add #34, L0
+    dec r7
+    cmp r1, r1
+    sub L110, r1
+    jmp L36
+    lea L110, L95
+endmacr
+prn *r5
+m0
+stop
+mov r4, r4
+not r7
+m3
+L0: .data 81, 354, 539, -858, 413, -35, -956, -148
+jsr *r6
+clr *r7
+L1: add *r7, L75
+red L0
+m2
+mov *r3, r4
+dec L110
+L2: .data -822, -416, -520, -265, 324, -797, -162, -436
+inc L1
+m3
+not L76
+L3: .string "qpvicuggfbtrnifqhb"
+L4: .string "nuewyxjjdyjll"
+red r1
+jsr *r5
+cmp L2, L13
+cmp L4, r4
+jsr L76
+L5: mov r7, L4
+inc L0
+red L34
+; comment
+L6: jsr L0
+sub L110, r2
+prn *r0
+dec r5
+L7: not r2
+mov *r5, r3
+L8: dec *r4
+m2
+L9: bne *r2
+stop
+bne L81
+jsr *r1
+L10: .data -31, -914, -756, 917, 593, 305
+jmp L52
+inc L16
+clr r0
+inc r4
+L11: clr *r6
+not *r1
+L12: .string "dofxwkemup"
+L13: .string "drsnl"
+L14: not r1
+m2
+L15: .string "tnkealthoe"
+jmp *r0
+lea L105, r5
+cmp L13, L99
+L16: prn r1
+bne L64
+not r2
+L17: .string "zipeujhjuzeqpuoxpvspogvd"
+mov #13, *r5
+jmp L2
+L18: clr *r3
+m4
+m1
+m3
+red r2
+m1
+L19: jmp *r1
+prn r1
+L20: .data -239, 758, -689, 288, -37, 185, -50
+dec *r3
+red L55
+m4
+m2
+m0
+jmp *r3
+red L99
+L21: stop
+jmp L5
+m2
+clr L3
+inc *r2
+red r6
+add *r4, r5
+m1
+L22: .data -211, 803, 596, 637, -570, -67
+stop
+lea L45, *r1
+cmp L12, #-88
+m3
+add #-187, *r5
+L23: .data -941, 7, 415
+L24: rts
+m4
+prn L53
+m1
+L25: inc *r3
+; comment
+stop
+add *r3, L1
+inc *r2
+mov *r2, *r4
+L26: .string "eicaqvmdxn"
+lea L57, *r7
+mov L23, r5
+L27: not *r1
+sub r1, *r2
+L28: .data -10, 249
+mov L33, L76
+jmp L22
+dec L3
+L29: add L40, r2
+m2
+bne L38
+not *r6
+clr L29
+m3
+red *r0
+m2
+L30: prn *r7
+mov #-223, r3
+
+stop
+L31: .string "qgtuojqufkbfocq"
+stop
+inc r0
+jmp *r3
+add L31, *r0
+L32: dec *r0
+dec r0
+L33: .data 141, 306, 477, -239, -643, 69, 533
+prn L5
+add #66, L27
+m2
+jsr L32
+L34: dec *r4
+m2
+sub L23, *r1
+
+prn *r2
+L35: clr r2
+L36: .string "ebow"
+stop
+dec r1
+rts
+; comment
+
+mov *r5, r6
+m3
+; comment
+m4
+mov *r1, *r4
+red r6
+L37: prn r2
+stop
+rts
+L38: .string "stcxutorkvswtlmn"
+L39: lea L91, L0
+L40: .data 922, -462, -21, 844
+inc r1
+red *r4
+L41: cmp L27, r1
+m0
+mov L20, *r2
+L42: .string "ucqlxfrpmnkp"
+m2
+stop
+m4
+L43: bne *r2
+bne L27
+jmp *r6
+mov #111, r3
+m3
+L44: prn L7
+lea L42, r2
+dec L36
+clr r4
+L45: inc r0
+inc r1
+stop
+jsr L85
+L46: .string "yuwzzthjrz"
+not *r4
+jsr *r7
+add L103, *r3
+sub L65, r5
+sub *r1, L104
+L47: .string "ougrudrkpvmdqzkkxeirr"
+cmp *r3, L46
+dec L41
+add L93, *r4
+L48: .string "efednaoguludihydjwjpg"
+dec r1
+
+jmp *r5
+lea L36, L18
+L49: jmp *r4
+L50: .string "pzf"
+L51: .data 503, 844, 617, 360, -884
+not r5
+jmp *r2
+m3
+sub L16, r3
+L52: rts
+inc *r6
+L53: .string "hbhjuqemrzipghbceqcgp"
+inc *r4
+dec L79
+sub r7, L74
+bne *r5
+clr *r6
+stop
+m0
+add L54, *r4
+m2
+m2
+sub #-130, *r0
+cmp *r0, r3
+inc L49
+m4
+m3
+m2
+L54: .string "ibcywhlg"
+bne *r6
+jmp L70
+L55: stop
+jmp *r1
+dec L57
+rts
+jsr L46
+m3
+L56: .data 809, 258
+m0
+m3
+m4
+mov *r7, r6
+L57: .data -523, 205
+L58: .data 47, 89, -357, 784, -879
+m3
+L59: .string "uvniilr"
+L60: .data 989
+red r0
+m3
+sub L109, r5
+L61: .string "iovdxm"
+m2
+m0
+inc r4
+not *r5
+add #-239, r6
+jsr *r2
+
+L62: bne L53
+red L77
+jsr *r3
+cmp #234, L104
+L63: red r0
+add r4, *r0
+clr L74
+stop
+L64: .data 951, 264, 546, 646, 653, -699, 859
+bne L13
+rts
+sub L104, L59
+rts
+; comment
+m3
+L65: .string "ijjqvqvrqqajidscd"
+m3
+prn L99
+
+prn r0
+sub *r2, *r2
+rts
+m3
+lea L29, r5
+prn *r7
+L66: .data 191, 882, 551, -727, 164
+m4
+cmp #-229, L14
+lea L5, *r6
+m3
+stop
+rts
+m0
+L67: .string "jxdljmjalynlsm"
+dec r1
+red *r0
+; comment
+red *r7
+inc L102
+m2
+mov #207, r1
+; comment
+stop
+mov L53, *r4
+L68: cmp *r4, r0
+inc *r1
+m4
+
+L69: rts
+stop
+prn #-197
+dec *r3
+L70: .data 930
+m1
+L71: prn L102
+jmp *r6
+m0
+L72: .string "ucukteyl"
+L73: clr L111
+m2
+jsr *r2
+m2
+L74: .string "bbotwmvccfxwcax"
+
+m1
+stop
+lea L18, L102
+m4
+m0
+L75: dec L20
+jsr L50
+jmp *r0
+m1
+L76: dec r1
+add L18, *r5
+stop
+; comment
+rts
+inc L100
+sub *r6, r2
+cmp L49, r0
+L77: prn *r1
+
+jmp *r5
+mov *r6, L96
+clr L56
+not r1
+bne L111
+L78: clr r1
+jsr *r0
+L79: .data -715, -278, 42, 567
+not *r7
+stop
+L80: mov r0, *r7
+m4
+; comment
+stop
+bne *r1
+mov #-188, *r6
+; comment
+stop
+L81: jmp *r1
+cmp #-155, r1
+stop
+L82: .string "qmnztzbeiwudwqazavilbwf"
+m2
+not *r2
+L83: inc L55
+mov r0, r7
+lea L94, *r4
+m2
+clr L51
+cmp #94, #-155
+L84: .data -759, 10, 457, -391, 888, 941
+sub #134, *r4
+inc L93
+rts
+L85: sub *r5, *r4
+stop
+not r3
+rts
+; comment
+L86: .string "pqxcnivssafioojutp"
+stop
+L87: .string "mhgmwuxj"
+prn r0
+L88: .string "ncqfnydyfi"
+dec L71
+mov *r1, L92
+clr r6
+m3
+L89: .string "qalvejfqafeqzx"
+m2
+m0
+clr r1
+sub *r4, *r0
+rts
+cmp L110, L106
+m3
+L90: cmp r4, #-116
+m2
+dec L4
+inc r2
+m1
+L91: sub #-148, L96
+jsr L69
+dec r0
+prn r1
+jmp L107
+red L110
+L92: prn r0
+L93: .data -253, 472, 529
+m3
+m1
+lea L20, *r4
+not *r0
+m2
+jsr L103
+L94: stop
+L95: mov L9, L52
+L96: mov r3, L97
+red L108
+L97: .data -845, -875, 525
+prn *r7
+L98: not L40
+not L108
+; comment
+L99: .data 14
+stop
+not r0
+mov *r2, *r6
+m2
+lea L111, *r4
+red r2
+jsr L9
+not r6
+jsr *r0
+mov *r0, r4
+red r3
+prn r3
+mov r0, r2
+; comment
+m3
+m1
+bne L103
+jsr L30
+cmp L108, #-192
+red L100
+stop
+lea L63, *r4
+m0
+L100: lea L94, r0
+m2
+sub #-16, L91
+inc r4
+rts
+L101: sub #180, r1
+m2
+L102: bne *r7
+L103: .data -321, 48, 352, -254, 101
+
+lea L108, r7
+clr L111
+stop
+m1
+L104: red *r7
+jsr *r6
+mov *r5, L6
+jsr L105
+inc L109
+m2
+dec *r6
+clr L15
+m3
+sub *r7, L65
+clr *r7
+jmp L110
+jmp *r4
+m3
+inc *r0
+L105: red *r0
+add L109, *r0
+m4
+clr r0
+L106: add *r5, r3
+m1
+prn *r7
+stop
+clr r0
+m2
+rts
+L107: jsr L108
+add L38, r3
+m0
+L108: sub L110, *r7
+m2
+L109: .data -384, 236, 966
+L110: jmp L111
+not L37
+bne L34
+L111: .data -261, -194, 860, -396, -379, 159
+stop
+jsr L10
+dec L92
+
+sub #-191, r0
+m1
+stop
@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 79
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    jsr *r7
+    stop
+    cmp #-127, L24
+    cmp #-16, r0
+    jmp *r2
+    prn *r6
+    dec r4
+    prn L105
+    not r2
+    inc *r1
+endmacr
+macr m1
+    not L76
+    bne *r5
+    mov L47, L35
+    mov *r2, r2
+    jsr L20
+    inc r5
+    not L90
+    inc L64
+    jmp L81
+    jsr L13
+endmacr
+macr m2
+    stop
+    not L55
+    red L111
+    not r5
+    clr L51
+    jsr *r6
+    bne *r4
+    jmp L46
+    dec *r4
+    red *r4
+endmacr
+macr m3
+    not *r1
+    cmp #27, *r3
+    red r4
+    stop
+    prn #203
+    add #-66, L11
+    clr L27
+    add *r3, L66
+    red r3
+    jmp *r6
+endmacr
+macr m4
+    jsr L78
+    add *r3, *r4
+    rts
+    inc *r0
+    prn L101
+    jmp L77
+    red L24
+    jsr L97
+    jmp *r2
+    bne L53
+endmacr
+L0: cmp #-194, L100
+m1
+lea L0, r6
+not L0
+add #-98, r3
+not *r7
+inc L0
+inc L98
+mov L110, *r7
+jsr *r7
+inc r6
+m3
+inc *r7
+add *r0, L0
+rts
+clr L0
+L1: .data -822, -330, 671, 693, 158, -771, 59
+m0
+m2
+mov L73, *r2
+inc L0
+mov r1, *r4
+not *r5
+cmp *r6, r0
+mov *r3, r7
+m1
+cmp #55, #-17
+rts
+sub *r6, *r5
+L2: .data 254, -19, 895, 479, 888, 534
+m2
+prn #-50
+; comment
+not r3
+m2
+
+L3: inc *r4
+m0
+L4: .string "lzrqnhlzotjjkjvh"
+; comment
+add *r0, *r3
+m3
+rts
+m0
+L5: .data -84, 317, -943, 755
+add #-138, r2
+L6: .string "sgchyuaghm"
+red r3
+L7: prn #64
+red *r3
+m0
+inc *r1
+L8: .string "dmfwybmr"
+L9: .string "eismnmjw"
+mov #-38, *r7
+bne L2
+m4
+lea L3, *r6
+L10: stop
+m4
+mov L3, *r5
+m0
+
+dec *r3
+L11: stop
+stop
+jmp *r7
+lea L3, L5
+m2
+
+m2
+m4
+inc L44
+stop
+L12: .string "bfnf"
+L13: clr r1
+bne L8
+rts
+m4
+clr r2
+sub #115, *r0
+m4
+add L4, L18
+m1
+L14: .data 146, 321, -403, 794
+L15: .data 657, -12, 380, 69
+inc L3
+L16: .data 756
+bne *r1
+cmp #45, L4
+jmp L95
+lea L0, L14
+inc *r5
+m4
+cmp *r3, r4
+red *r2
+cmp *r3, L4
+L17: add r1, L20
+red L45
+L18: stop
+inc L85
+not r7
+m0
+m3
+mov L6, *r1
+clr L9
+m1
+L19: jsr *r6
+add *r3, L13
+; comment
+L20: jsr *r2
+L21: .data 340, -950, -636, -364, -110
+clr *r5
+L22: .data -970
+stop
+m1
+dec r0
+m3
+red L3
+m2
+add L95, r7
+not L19
+L23: clr L1
+cmp r5, r2
+L24: rts
+lea L112, r5
+add r3, r0
+red r3
+clr r7
+bne *r6
+inc *r5
+add *r7, r5
+sub *r6, L88
+m3
+L25: sub L66, r7
+lea L45, *r6
+L26: .data 180, -86, 186, 283, -704
+prn r3
+add r0, *r0
+bne L50
+stop
+L27: red r5
+inc r3
+add *r5, r3
+add #120, *r7
+rts
+mov #112, L19
+L28: lea L40, L57
+jsr L104
+m2
+m0
+m3
+red r6
+add #-142, *r0
+lea L59, L101
+prn #16
+L29: .data -340
+jsr *r7
+red L108
+bne *r3
+mov *r4, r4
+bne *r2
+bne L10
+; comment
+L30: .string "frtgzbhstoblm"
+red *r3
+L31: inc *r6
+L32: dec L8
+m1
+sub *r2, L56
+L33: bne L17
+dec r5
+red *r1
+L34: jmp L10
+m0
+cmp *r3, #96
+rts
+L35: jmp L14
+L36: .string "paxcpmsjj"
+not r5
+rts
+L37: clr *r4
+red L80
+inc r7
+m1
+m3
+clr r1
+inc *r0
+m1
+clr L36
+red L79
+red r1
+m4
+
+L38: stop
+jsr L14
+L39: .data -721, 673, -770, 241, -624
+jmp *r3
+L40: dec *r5
+red *r7
+clr r1
+L41: .string "nnkybkezszuthbjmc"
+bne *r7
+jmp *r1
+add *r1, *r3
+m0
+cmp L17, r7
+rts
+L42: .string "qdimesqrtvggxj"
+L43: mov L79, r6
+m1
+L44: rts
+red L32
+mov L63, r6
+lea L83, L66
+inc *r4
+m1
+L45: mov r0, r3
+mov r0, r2
+inc L26
+m1
+mov *r5, *r3
+jsr L94
+L46: jsr L94
+m0
+L47: .string "wrpkhwsdfkxwvq"
+red r0
+m4
+mov #116, *r2
+cmp *r4, L19
+m3
+jmp L67
+m3
+not L46
+mov L69, r6
+lea L71, L4
+dec L4
+m4
+rts
+L48: .string "ttlpne"
+
+clr r6
+L49: sub *r3, *r6
+lea L0, r7
+m4
+m2
+m3
+L50: stop
+prn *r1
+jmp *r7
+red *r0
+add #-124, r3
+jsr *r1
+L51: .data 480, 280, -949
+lea L62, *r0
+jmp L28
+cmp *r2, #129
+dec L18
+L52: .data 666, 950, -669, -903, -229
+cmp #203, L14
+prn L65
+inc L82
+L53: red L31
+clr r1
+rts
+inc r7
+cmp #148, L16
+L54: .data 810, 395, 580, -530
+m3
+L55: .data 710, -241, 595, -863, -111, 686, -634, 768
+rts
+L56: red *r2
+L57: jsr L68
+jsr *r2
+red r1
+stop
+lea L23, L12
+inc L22
+L58: lea L96, L40
+; comment
+m1
+jmp *r6
+m0
+L59: add #49, L56
+L60: jmp *r2
+lea L62, *r6
+rts
+L61: sub r4, r2
+m4
+m1
+sub r1, r6
+L62: bne *r0
+clr *r7
+L63: jmp L8
+m2
+mov #-11, L11
+inc L91
+clr r0
+prn r2
+; comment
+m4
+not r3
+L64: .data 491, 68, 384, -683, -121, 791, -716
+not r3
+add r5, r5
+L65: cmp *r2, #-234
+stop
+m2
+L66: rts
+m0
+jmp *r1
+L67: .string "stmvwnzvfzxcrx"
+sub L74, r0
+stop
+rts
+; comment
+L68: .data -459
+cmp r3, *r5
+lea L45, L89
+L69: .string "rbivv"
+L70: .string "rhbujpuebwoayfhwtvgvbc"
+m1
+m2
+m4
+lea L86, *r0
+clr L73
+inc *r0
+L71: jmp *r4
+sub #40, L100
+lea L15, *r6
+clr r1
+not r5
+L72: red L50
+L73: clr L66
+bne L71
+m1
+m2
+prn #-66
+L74: .data 197, -997
+add L86, L30
+red r1
+L75: dec r2
+prn *r7
+m1
+not L91
+stop
+not *r3
+mov r3, *r2
+prn L99
+L76: rts
+L77: add *r4, *r1
+m3
+cmp r4, r4
+L78: .string "cfnlugswruzgbl"
+prn *r7
+L79: .data 861, -694, 121, 307, 442, 994, 871
+L80: cmp r7, r4
+stop
+m4
+
+not L109
+m2
+L81: prn L16
+inc r2
+stop
+L82: mov #-109, *r5
+bne L19
+m1
+L83: red *r4
+prn r4
+m4
+bne L111
+L84: .data 876, -890, 962, -5
+m0
+; comment
+add #-8, *r6
+jmp L4
+L85: .string "yggjtpqaiycuaiqbjilza"
+m4
+inc L30
+inc L102
+cmp *r1, r4
+L86: .string "qvbwnxrcquklj"
+add *r5, r5
+L87: .data 937, 667, -435
+add r2, r0
+jsr L104
+L88: .string "fyoavkcwjgmmotdlzpk"
+red *r7
+red *r1
+L89: jsr L21
+mov L110, *r1
+red r6
+prn *r1
+cmp #1, r5
+m3
+dec r0
+m3
+lea L101, r2
+L90: lea L112, *r5
+not *r0
+m2
+m4
+lea L111, r4
+red r1
+m0
+add *r6, r2
+m2
+L91: add L108, r1
+jmp *r1
+L92: not *r0
+m3
+; comment
+mov r3, L81
+m2
+m4
+m1
+cmp #-91, r0
+m4
+mov #229, *r3
+L93: inc *r0
+L94: inc *r6
+not L24
+jsr L100
+L95: rts
+L96: .string "fokknalgbgrzoxlpujhicne"
+jsr L103
+lea L112, L97
+jsr L22
+L97: .data 927, -97
+L98: not *r5
+dec *r5
+L99: .string "evbty"
+L100: rts
+m2
+m2
+stop
+; comment
+not r7
+L101: sub *r1, *r4
+sub L104, *r3
+sub L12, r6
+m0
+prn #240
+m4
+not r4
+L102: rts
+jmp L95
+add L108, r3
+L103: mov *r7, L111
+m4
+bne L78
+not *r4
+rts
+m0
+red L107
+m0
+m0
+dec *r2
+bne L105
+m1
+bne *r5
+lea L112, L106
+L104: .data -711, 462
+rts
+L105: not r4
+L106: .string "egmepxbgmpwfvysclved"
+prn L18
+red L87
+rts
+L107: .string "rhumyktkinfxexnddy"
+m2
+jmp L112
+lea L110, *r0
+not *r0
+L108: .string "dplmj"
+add L5, L52
+stop
+dec r3
+jmp *r0
+bne L4
+m0
+L109: lea L5, *r6
+lea L111, r2
+stop
+prn L110
+prn L61
+m4
+L110: sub L111, *r5
+; comment
+mov r4, L44
+m3
+L111: .data -140, 293, -168, -40, -757, -940, 624, -594
+lea L2, r7
+L112: inc r5
+add #-67, *r2
+sub L98, *r1
+not r4
+stop
+bne L83
+stop
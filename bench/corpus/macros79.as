@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 80
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    jsr L6
+    stop
+    red *r2
+    mov *r1, L103
+    jmp L57
+    not r1
+    mov r7, L66
+    not r2
+    clr L24
+    mov r1, L113
+endmacr
+macr m1
+    not L50
+    not r5
+    cmp L121, L10
+    inc r6
+    clr *r0
+    add r5, *r2
+    bne *r0
+    sub #0, L74
+    rts
+    red *r6
+endmacr
+macr m2
+    clr *r3
+    red *r3
+    stop
+    jsr *r1
+    clr L102
+    lea L43, *r6
+    cmp r3, *r6
+    lea L87, L95
+    prn *r0
+    mov r5, *r2
+endmacr
+macr m3
+    clr L11
+    jsr *r0
+    rts
+    add r2, r0
+    sub #29, r7
+    stop
+    not *r3
+    jsr L110
+    not *r1
+    stop
+endmacr
+macr m4
+    jsr L19
+    dec L127
+    lea L101, L94
+    bne *r1
+    jmp *r7
+    stop
+    not *r0
+    lea L3, r4
+    sub *r2, L32
+    cmp #214, r3
+endmacr
+L0: .string "vysggivpfp"
+
+not L0
+m4
+red *r3
+lea L72, r5
+L1: red *r7
+not *r7
+dec r4
+L2: .string "pfovrvlozklhtha"
+L3: dec *r3
+; comment
+not *r5
+not L82
+m4
+jsr *r4
+L4: rts
+L5: .string "symwasep"
+; comment
+jsr L41
+cmp L8, #-88
+L6: red r1
+inc r6
+not *r4
+prn *r0
+add #46, r2
+cmp *r1, #58
+clr *r0
+lea L77, L3
+L7: not r1
+L8: dec *r5
+m3
+sub #121, *r4
+red *r1
+m3
+cmp #-198, #93
+m4
+bne *r4
+m3
+jsr L66
+sub L51, L7
+L9: add #-95, *r4
+L10: .string "xxnorumerpbntmfaqowkvcq"
+mov r2, r5
+; comment
+L11: inc *r5
+rts
+L12: .data -480, 735, 134, 260, 459, 479, -678
+L13: red r4
+L14: stop
+dec r2
+L15: .data 503, 66, 272, 718
+red L21
+m3
+m1
+L16: .data -715, -983, 830, 187
+prn L65
+add L118, L12
+L17: .data -665
+mov r7, *r5
+clr r1
+inc L79
+L18: .string "yl"
+inc L51
+red L10
+jsr *r0
+L19: .string "iclzozltxgvojhqqdscwuaxw"
+inc L19
+m4
+L20: .string "vbiikcr"
+lea L53, L41
+jsr L3
+inc L90
+jsr *r4
+L21: red *r7
+m2
+L22: rts
+jsr L11
+clr r2
+L23: red r6
+L24: .string "qtxpugocnho"
+not *r3
+clr L20
+red *r1
+bne *r7
+L25: dec *r4
+dec r6
+m2
+mov *r2, r6
+m0
+clr r6
+add #-101, r5
+L26: .data 824, 19, 850, -792
+L27: .string "dh"
+rts
+jsr *r0
+not *r7
+L28: .string "oxfpdtqssesvxbntjv"
+m0
+m2
+m1
+jsr *r2
+L29: clr r6
+m1
+not r4
+m2
+L30: .string "kcsgnbu"
+jsr *r1
+m2
+m1
+cmp L11, #-82
+red L12
+jmp *r6
+not *r0
+; comment
+inc r0
+red r4
+m3
+jmp *r3
+m3
+L31: .data -775, 251, -356, 661, -505, 925, 362, -933
+clr r6
+red r3
+jsr L3
+bne *r5
+sub r6, L25
+mov r5, *r1
+jsr *r6
+L32: .string "tenmbjpb"
+jsr *r4
+m1
+lea L25, r5
+jsr L29
+bne *r7
+m2
+L33: not L30
+L34: stop
+jmp *r0
+sub #199, L42
+L35: bne *r4
+rts
+dec r6
+m3
+L36: .string "fdaqhxwgidhackrbyuj"
+m0
+m0
+m2
+L37: .string "lgymktvoxejemblwnx"
+dec L33
+m0
+sub L23, *r5
+m0
+stop
+lea L12, L61
+inc r0
+lea L80, r0
+jsr *r0
+stop
+; comment
+cmp #133, #-77
+L38: .string "sdvfstst"
+L39: .string "oaupduyvjiwfvlurnbrb"
+L40: sub L26, r7
+mov *r3, L11
+not r1
+dec *r0
+add L81, r3
+clr r6
+stop
+L41: prn r6
+m3
+cmp #-36, r2
+m0
+prn L98
+lea L52, r4
+jsr L41
+; comment
+m1
+
+stop
+lea L118, *r2
+lea L38, r5
+red *r0
+jmp *r7
+clr L25
+L42: .data 210, -766, 495, 881, -890, 741
+bne L95
+dec r5
+L43: red *r2
+clr L87
+add L90, *r0
+m3
+jmp L40
+m4
+L44: .string "jyzpkdhlksmlp"
+m3
+sub *r6, r4
+L45: .data -134, -172, -584, 373, 335, -860, 812
+red *r3
+inc r3
+mov r7, *r6
+sub L77, L58
+rts
+; comment
+m2
+stop
+m2
+m2
+jsr *r4
+m2
+L46: .data 389, 136, -161, -689, -430, 770, 657
+bne L100
+jmp *r0
+L47: .data 574, 676, -366
+stop
+mov #246, r1
+L48: sub #185, L38
+prn #-81
+L49: .data 640
+L50: .data 662, -850, 874, 581, -145
+L51: stop
+inc r4
+red r3
+L52: add r7, L63
+L53: add *r3, L16
+bne *r3
+L54: sub *r5, L39
+jmp L15
+m4
+L55: sub #-117, r3
+clr *r1
+jsr *r3
+jsr *r7
+inc *r4
+dec L22
+lea L84, *r5
+stop
+prn #-220
+jsr *r6
+L56: .data 372, -829
+prn r5
+inc *r3
+inc r3
+jsr *r6
+inc *r1
+L57: .data -192
+cmp L35, L113
+L58: red L62
+m2
+L59: lea L18, r4
+inc r2
+add *r2, L109
+red *r4
+L60: inc L69
+lea L13, L65
+
+add r0, *r6
+L61: .data 853, 749, -66, -196
+inc L55
+L62: not r1
+L63: .string "qulmkajhzsbsfmxqpjhebqo"
+L64: prn *r4
+add *r4, L5
+m4
+L65: clr *r0
+L66: .data 935, -976, -452, -453, 316
+inc L14
+jsr L31
+L67: .string "budfiyvbwj"
+L68: mov r7, r1
+L69: bne *r7
+m0
+red L59
+cmp #-156, L57
+stop
+rts
+not r6
+clr L123
+dec *r1
+m4
+L70: .string "cocdynzdpxjtdaokpiw"
+L71: add r6, L80
+bne *r4
+clr r5
+not L24
+L72: prn L80
+rts
+jsr L124
+L73: prn L113
+L74: cmp r0, r3
+jmp *r2
+not *r2
+clr r2
+red *r3
+
+
+m1
+bne *r3
+m2
+rts
+cmp #-124, L62
+L75: .data -902, 780, -51, 513, -353, 126, -319, -934
+cmp L99, r7
+rts
+prn L51
+prn L83
+prn r0
+L76: rts
+prn #215
+m4
+m4
+m4
+add #173, r4
+add *r1, *r7
+red r2
+m1
+L77: not r6
+L78: bne L8
+jsr *r0
+stop
+
+not r1
+not L27
+m4
+bne *r0
+m3
+L79: add *r6, r0
+not *r5
+m1
+L80: .string "cnmtztn"
+red L112
+m0
+clr L58
+cmp #28, r5
+L81: inc L19
+m1
+L82: .data 812, -469, -879, 776, 673, 101, 437, 690
+m1
+L83: .data 983, -587, 555, -236, -833, -995, -675, -325
+L84: .string "ouflfdkhgdgixln"
+L85: .data -335, -936, -803
+m1
+mov #223, r1
+inc L56
+cmp *r6, *r5
+clr *r4
+rts
+L86: jmp *r4
+L87: mov *r0, *r2
+jmp L108
+prn #79
+m1
+dec *r6
+m3
+prn *r3
+bne L104
+L88: jsr *r3
+add r6, L28
+L89: sub r5, *r2
+L90: not L116
+clr L23
+L91: .string "iudajofingpfmhjclpfue"
+L92: .string "enjhezodyziec"
+clr L60
+mov L94, L68
+jmp *r0
+L93: .string "hswqtxbmynrbplvnurpxkpw"
+lea L92, r0
+stop
+L94: dec r3
+m4
+L95: rts
+red *r1
+cmp L58, #41
+L96: bne L94
+jsr L19
+L97: jmp *r6
+cmp #114, r7
+m4
+
+L98: clr L89
+mov #246, r3
+prn #51
+jsr L127
+prn #195
+m1
+L99: jmp *r4
+L100: .string "fqzoezizujacovrnxo"
+clr L113
+L101: lea L106, r4
+L102: .string "h"
+add *r1, L80
+L103: jmp *r1
+not L95
+m1
+lea L108, *r4
+bne *r4
+m2
+inc *r6
+L104: bne *r3
+L105: .string "jgjqkslrflirlxeqgj"
+m1
+m3
+m1
+m2
+; comment
+m4
+inc r6
+inc r3
+rts
+L106: rts
+jsr L113
+; comment
+
+cmp #163, r4
+stop
+jmp *r5
+m1
+jmp L83
+lea L101, r6
+L107: sub *r7, *r2
+L108: cmp L127, #118
+bne L120
+L109: red *r5
+L110: prn r6
+not *r0
+L111: prn L114
+clr L113
+sub r1, L79
+sub r3, L89
+inc L101
+m0
+m2
+L112: lea L113, L119
+red L17
+dec *r7
+cmp #247, *r5
+sub *r6, r0
+
+m3
+L113: .data 89, -28, 70, 500, 175
+L114: .string "xfzjppqbfhvrcxaosyynfjl"
+L115: prn L118
+jmp *r7
+L116: .data -801, -961, -575, 364
+rts
+stop
+stop
+rts
+prn #-229
+m2
+; comment
+L117: dec r5
+; comment
+red *r1
+L118: .data 207, -158, -488, 522, 862, -889, 774, 657
+
+jsr L123
+sub #-29, r6
+m3
+clr *r4
+L119: jsr *r2
+; comment
+prn L50
+cmp r1, L121
+not *r7
+m0
+L120: .data 218, 13
+
+prn L69
+L121: red L124
+lea L62, *r5
+red L36
+m4
+L122: not L77
+jmp L124
+not *r7
+L123: stop
+bne L124
+jmp *r1
+jmp *r5
+red L12
+stop
+rts
+jsr L69
+clr *r5
+not L28
+m3
+jmp *r1
+rts
+L124: .string "gl"
+L125: prn L127
+L126: lea L127, r5
+m0
+m2
+L127: clr *r3
+dec L122
+m1
+cmp r0, *r1
+cmp *r6, r2
+stop
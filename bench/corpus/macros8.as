@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 9
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    stop
+    clr r0
+    jmp L44
+    jmp *r1
+    jsr *r4
+    bne L0
+    rts
+    red *r0
+    not *r4
+    add L44, L12
+endmacr
+macr m1
+    jsr L79
+    cmp *r0, L35
+    sub r2, r5
+    prn r2
+    not *r5
+    lea L70, *r3
+    prn r2
+    add L86, r4
+    dec r5
+    sub r5, *r7
+endmacr
+macr m2
+    cmp r6, #-178
+    lea L38, r4
+    clr *r2
+    inc *r1
+    cmp r2, L76
+    stop
+    not r5
+    sub *r5, L35
+    dec *r7
+    stop
+endmacr
+macr m3
+    jsr L96
+    lea L74, r0
+    prn *r3
+    lea L3, *r1
+    sub r3, r7
+    jsr L40
+    lea L89, L19
+    bne L47
+    jmp *r3
+    rts
+endmacr
+macr m4
+    inc r5
+    inc r3
+    not *r3
+    red *r1
+    red r6
+    lea L25, L37
+    inc r3
+    add *r1, *r5
+    mov *r0, *r1
+    prn #-176
+endmacr
+stop
+L0: .string "anssvxjrkkno"
+L1: .string "agashrzvzalbbejnusfywxld"
+m4
+L2: rts
+stop
+jmp L0
+L3: .string "wnjymv"
+red L20
+L4: jmp L3
+; comment
+jsr *r2
+inc r4
+not r0
+L5: rts
+L6: rts
+not *r1
+L7: cmp r5, *r6
+L8: inc *r7
+mov #-92, L8
+lea L7, r6
+m4
+cmp #-162, L27
+L9: .string "yntkcacuckwqiaklcw"
+L10: stop
+m2
+cmp L73, #-208
+stop
+clr L8
+clr L87
+rts
+clr r2
+dec r3
+not L37
+mov r4, L10
+dec r3
+L11: stop
+mov #172, *r1
+L12: .string "yam"
+stop
+m0
+rts
+L13: cmp *r1, L86
+red L86
+lea L38, r2
+; comment
+sub #-132, r5
+m4
+jsr L3
+m2
+cmp #226, L62
+not r0
+L14: mov *r1, r4
+inc r2
+lea L8, r7
+L15: .data -790, 493, 260, 499, 914, 520, -668, -650
+L16: inc *r5
+mov L41, *r6
+m1
+mov #202, r2
+m4
+jmp L16
+lea L12, L33
+dec L5
+L17: .string "xytsefiyaokumwyvaofkve"
+rts
+rts
+jmp *r4
+L18: .string "odcutalfqhlwpunmhfyjfed"
+cmp r2, L103
+L19: cmp L4, L9
+m3
+inc L103
+L20: stop
+m3
+L21: .data 718, 330, -107
+L22: clr L24
+sub #141, L22
+L23: bne L3
+L24: .data -256, 966, 48, -567, 558, -587, 792
+inc *r5
+add r7, L9
+stop
+L25: rts
+mov *r1, L80
+m0
+L26: bne L92
+m4
+bne *r4
+mov L24, r6
+m3
+L27: .string "mp"
+inc *r0
+
+L28: stop
+jsr L17
+inc r2
+clr L66
+jmp *r1
+sub r5, r4
+bne *r5
+m0
+dec *r0
+L29: clr r2
+jmp *r5
+inc *r6
+sub #-126, L14
+jmp L92
+
+m3
+rts
+dec L24
+not *r1
+bne L66
+m0
+m0
+m1
+clr r1
+m4
+m3
+inc r1
+L30: .string "ohi"
+cmp *r7, r4
+not L22
+m1
+m4
+prn r1
+cmp *r6, L89
+L31: rts
+jsr *r6
+dec L94
+L32: .data 298, -188, -278, 814, 672, -139
+m2
+m0
+red r1
+add r7, L39
+inc r1
+jsr L12
+L33: .data -281, 794, -227, -237, 259, -158
+prn r6
+not L80
+inc r6
+cmp L10, r7
+prn r0
+L34: .data -655, 686, 108, 305
+L35: .data 240, -809, 875, -964, -4, -349, 820
+not L34
+inc r5
+bne *r5
+m1
+m2
+jmp *r7
+jsr L41
+L36: clr L13
+inc L29
+m0
+m0
+dec r6
+jsr L33
+mov L24, r3
+stop
+cmp r5, r4
+stop
+not r5
+inc L108
+jmp L22
+prn L72
+m3
+lea L63, *r2
+sub r2, L46
+m3
+dec L91
+; comment
+bne L66
+L37: .data -75, -812, 258, 469, 255
+prn #126
+cmp r1, *r2
+add *r5, L40
+prn *r2
+stop
+m1
+rts
+inc r5
+L38: .data 944, -310, -833, 492, -792
+bne *r4
+inc L88
+sub #-69, L89
+m1
+L39: sub #93, L73
+prn r3
+add *r7, r3
+clr *r2
+mov *r7, r3
+L40: .string "zuvlnxox"
+L41: .data 995, -740, -369
+L42: prn #160
+dec r0
+L43: clr r5
+L44: .data -288, -289, 591, 614, -565, 21
+red L92
+prn #-80
+L45: .string "hl"
+L46: .string "dlthyascjt"
+m1
+m1
+m0
+prn L1
+prn L6
+red *r7
+add r6, *r7
+L47: .string "rhmsjfwubjbdizb"
+prn r2
+m1
+jmp L49
+rts
+sub L13, L26
+stop
+sub *r7, L74
+lea L32, r6
+rts
+L48: jmp *r4
+sub *r5, L62
+L49: add r5, *r5
+bne L47
+m4
+rts
+dec L39
+; comment
+L50: rts
+clr L49
+
+m4
+L51: .data 32, -271, 332, 102
+inc *r2
+m4
+jsr *r0
+L52: .string "nlbzzgrsduoevaxiktpujoiz"
+
+; comment
+jsr *r0
+dec *r6
+add r3, L31
+cmp r3, L52
+L53: add #-55, *r1
+dec r5
+m2
+clr r3
+m0
+inc r1
+m1
+m4
+jmp *r6
+L54: jsr *r0
+m0
+red L8
+L55: prn #44
+prn L5
+cmp L67, *r2
+m2
+m2
+
+L56: stop
+m0
+mov #150, L16
+lea L56, r2
+red *r3
+rts
+rts
+dec *r5
+mov L38, L85
+L57: bne *r3
+bne L37
+m4
+
+red *r2
+cmp L80, L16
+m2
+jmp *r3
+m1
+bne L35
+rts
+dec L108
+m3
+sub *r2, L94
+sub L34, r7
+m2
+L58: mov L47, *r0
+L59: cmp *r7, #-10
+L60: .data -449, 620, -61, 530
+not r1
+L61: bne *r6
+L62: .data -214, 383, -526, -805
+dec r1
+m2
+m0
+add #-222, *r2
+L63: .data -312, -81, -125, -258, -109, 728, 944, 438
+add *r4, *r7
+L64: .string "tuxbbvduaprsoavwjvsd"
+prn L71
+m2
+prn #-55
+bne L89
+jsr *r6
+stop
+L65: stop
+rts
+m2
+L66: .string "xprroisinamfwlwzhzkrt"
+not r3
+dec r7
+L67: jmp L99
+m3
+jmp *r6
+L68: .string "jx"
+not *r3
+
+mov L99, L108
+mov #-8, r6
+red r4
+bne *r2
+inc r0
+cmp L95, r5
+rts
+stop
+inc *r2
+m3
+sub r3, L48
+mov L67, L30
+; comment
+m0
+rts
+mov r1, r6
+not *r4
+L69: .string "lpjirjhr"
+jmp L72
+jsr *r2
+rts
+; comment
+m0
+cmp *r5, L67
+L70: cmp *r0, *r5
+m0
+lea L67, *r4
+m1
+lea L90, r5
+rts
+rts
+inc *r5
+L71: .data 39, -306, 662
+m1
+jmp L106
+L72: .string "occgtfowdpmn"
+L73: sub L85, r5
+; comment
+m2
+
+clr r5
+m2
+m4
+stop
+jmp *r6
+m3
+stop
+m4
+cmp #96, *r0
+m3
+sub *r7, r1
+sub L76, L22
+cmp *r5, r4
+L74: sub L107, r3
+L75: jsr *r3
+red *r2
+clr *r3
+m3
+L76: .string "zwfgsnbsxuozv"
+L77: jsr *r1
+L78: .data -157, 88, 797, -393, 951, 490, -200, -882
+bne L72
+cmp L85, L88
+inc r3
+mov L100, L47
+cmp *r1, L83
+L79: stop
+m4
+bne L14
+rts
+bne L82
+m0
+lea L16, r0
+m2
+stop
+L80: .data 477, -978, 522, 778, -795, 149, 103
+jmp L101
+L81: .data -853
+m3
+lea L87, L97
+rts
+inc r0
+prn L106
+; comment
+L82: .string "rpsw"
+m4
+bne *r7
+L83: inc r1
+m2
+red r5
+L84: clr *r0
+
+L85: inc r5
+not *r0
+m3
+stop
+L86: jsr L82
+jsr L18
+m1
+prn *r3
+bne L12
+prn *r3
+prn *r7
+mov *r2, r3
+clr r4
+m3
+prn L11
+add r2, r6
+L87: .data -19, 489
+prn *r3
+L88: sub L92, *r0
+prn #11
+L89: red L96
+L90: cmp #-88, r2
+L91: dec L94
+not *r3
+rts
+stop
+cmp *r1, L87
+L92: .string "itbfbcudhlx"
+prn #36
+add *r0, r4
+lea L33, r6
+rts
+rts
+L93: .string "lqzqtgmqcmhfuiofp"
+L94: cmp r0, L35
+m3
+m3
+stop
+lea L105, L98
+jsr *r1
+L95: lea L68, *r5
+bne *r4
+L96: .string "ugljjxrvxojzqjwaqvogazob"
+rts
+clr *r3
+m2
+L97: .data -947, -215, 85, -60
+L98: prn #-145
+m1
+m1
+L99: jsr *r4
+rts
+m1
+clr L23
+bne *r0
+L100: jmp L94
+m1
+red L104
+L101: .string "ovvti"
+L102: inc *r5
+inc L104
+inc L9
+; comment
+L103: .data 52, -250, -165, -405, 18, 229, -897
+m3
+m4
+prn #-104
+add #173, *r1
+jsr L25
+jsr *r3
+; comment
+L104: .data 266, -253, 223
+stop
+lea L106, r4
+m3
+L105: prn *r7
+cmp L108, L108
+L106: add r7, r7
+L107: prn L62
+jsr *r1
+; comment
+inc L108
+L108: .data -75
+clr r1
+prn *r0
+dec *r6
+clr r4
+sub #158, r4
+inc r6
+clr *r4
+L109: .string "dkxrjdkleyvxeoyusxbw"
+stop
@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 81
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    jsr L66
+    cmp #216, r5
+    stop
+    rts
+    lea L28, L22
+    jsr L94
+    clr r3
+    jsr L77
+    clr L110
+    inc *r1
+endmacr
+macr m1
+    red L16
+    red r2
+    rts
+    stop
+    bne L60
+    not r5
+    not L109
+    add r2, L105
+    rts
+    jsr L65
+endmacr
+macr m2
+    jmp L12
+    cmp r5, r1
+    red *r4
+    dec *r6
+    inc r6
+    sub #91, L118
+    sub r0, L95
+    prn *r7
+    sub *r6, L27
+    mov *r7, *r3
+endmacr
+macr m3
+    mov #59, *r4
+    stop
+    clr *r3
+    prn L73
+    red L17
+    rts
+    cmp *r4, L56
+    jsr L110
+    sub L30, L117
+    red *r7
+endmacr
+macr m4
+    not r4
+    red *r2
+    lea L1, L14
+    dec *r1
+    jsr L9
+    clr L30
+    clr r5
+    add L35, *r3
+    red L100
+    stop
+endmacr
+L0: red *r4
+bne L16
+m2
+L1: .data -950, -299, 341
+stop
+bne *r6
+inc *r3
+m1
+m3
+sub *r3, *r5
+m1
+m0
+L2: jsr *r6
+rts
+add #222, r2
+m0
+clr r2
+
+not *r4
+jmp L2
+lea L1, L0
+L3: .string "znxsvaebf"
+L4: stop
+not L110
+red r5
+m4
+
+m0
+jmp L1
+L5: sub L1, *r6
+L6: rts
+add *r6, *r7
+L7: sub *r5, *r2
+m3
+jsr *r1
+stop
+
+m2
+L8: dec r5
+rts
+cmp r1, *r4
+dec r0
+cmp L4, *r3
+L9: .data -34, -779
+red L45
+red L7
+prn #-63
+L10: .data -982, -795, -767, 683, 965, 141, -157
+mov L0, L0
+jmp *r4
+jsr L72
+
+m2
+; comment
+m2
+m4
+add L59, r3
+L11: add L11, *r7
+L12: .string "yfqhnssneplhuutpwmzi"
+prn L73
+m3
+rts
+jsr *r3
+add #-57, r7
+
+stop
+L13: .string "k"
+cmp #40, L1
+L14: .data -713, -301, 274, 710
+mov r4, L4
+mov L20, r7
+L15: .string "zffmc"
+red r6
+lea L4, *r0
+L16: .data -299
+m0
+m2
+jsr L87
+L17: bne L7
+rts
+stop
+L18: jsr L0
+jsr *r0
+lea L88, *r7
+sub r6, r1
+jmp *r1
+cmp L28, r7
+m1
+m2
+L19: .string "xvxbykutsyunrhar"
+m3
+m3
+add #27, r0
+prn *r0
+L20: .data 819, 205, -942, 32, 17, -865
+inc *r6
+L21: .string "mdlptxanbsavlyokcni"
+jmp *r5
+
+L22: mov L58, r3
+m3
+mov L2, *r1
+inc *r3
+not L32
+rts
+prn #-180
+L23: dec *r5
+clr *r5
+m3
+L24: cmp #-23, #-168
+jmp L9
+m3
+clr L20
+bne L75
+jmp *r1
+L25: red L22
+m4
+; comment
+L26: .string "mirarojelbqqagfhxs"
+; comment
+
+L27: .data 764, 197, -244
+stop
+cmp r3, #181
+cmp L50, L114
+dec *r5
+L28: bne L103
+L29: .data 811, -144, 393, 586
+jsr L20
+L30: dec L52
+stop
+add r0, r2
+clr *r4
+L31: .data -461, -774, 102, 474
+lea L120, r0
+L32: red r0
+prn #-51
+not r3
+add *r4, *r7
+jmp L12
+m1
+L33: rts
+rts
+m1
+L34: mov *r1, L34
+L35: bne *r1
+L36: jmp L53
+L37: .string "ocrysk"
+L38: sub *r4, L60
+L39: jmp L76
+L40: bne L32
+L41: .string "aimefyylkxzvkoivta"
+bne *r7
+L42: .string "wxolzqgkwnkifuawtxvjqqmp"
+L43: red r1
+red L79
+sub #-186, r3
+L44: .string "mqesmcctkrmizi"
+m2
+jmp *r6
+L45: jsr *r4
+stop
+
+m3
+m3
+L46: inc *r3
+stop
+not r3
+lea L48, r4
+mov #-79, L71
+red *r7
+prn r4
+m1
+L47: jsr L53
+m0
+add #-247, L1
+mov r7, r2
+prn #-147
+mov L29, L29
+clr r5
+rts
+not *r1
+L48: jmp *r3
+sub *r0, *r2
+L49: .data 643, -721, -270, 307, -400, -474, 890
+L50: .string "cgkxgin"
+inc *r1
+dec r2
+red L32
+dec r1
+cmp *r4, r6
+L51: .data 11, -312, -1, -824, -527, 598, -925
+lea L43, L5
+stop
+L52: dec r6
+L53: jsr L7
+; comment
+bne L112
+
+L54: .data 555, 460, -918
+L55: cmp #-11, *r3
+L56: jsr *r2
+dec r5
+rts
+m0
+jmp L41
+L57: jmp *r5
+m1
+inc *r3
+L58: red L101
+jmp L54
+jsr *r1
+L59: .data 630, -580, 487, 341, 638, -483, 967
+sub #-17, *r0
+dec *r7
+jmp *r4
+m2
+L60: .data 376, 437, -96, -969, -346
+red r6
+L61: .data 629, 69, -856, 744, -226, 281, 442, -359
+L62: inc L51
+bne *r3
+clr *r5
+
+m1
+lea L121, *r3
+L63: lea L86, r6
+prn #218
+add r7, *r3
+stop
+m3
+mov r6, r4
+L64: stop
+
+L65: rts
+mov r2, *r0
+red L101
+prn #230
+inc *r4
+bne *r7
+L66: add *r7, *r6
+sub r4, r0
+stop
+sub #123, *r3
+not L110
+dec *r6
+red r1
+jmp L23
+dec *r6
+dec L22
+L67: .string "i"
+m1
+L68: add r3, r2
+L69: .data 607, 739, -598, 188, 792, -696
+m0
+dec r1
+add L49, *r1
+L70: prn L64
+jmp L75
+add r4, r6
+
+L71: .data 253, 562, 10
+L72: .string "fhpvxjfvvmxs"
+inc *r7
+inc r5
+m2
+m3
+sub r1, r4
+L73: not *r7
+L74: add r2, *r0
+m2
+bne *r5
+; comment
+m2
+dec r6
+dec *r6
+sub L84, L45
+cmp #5, L7
+add r7, *r2
+L75: .data -64, 622, 775, -873, -623, -378, -6
+not L20
+m0
+dec r6
+L76: not *r7
+
+not r0
+; comment
+bne L52
+m1
+sub #-51, L22
+
+add L44, *r0
+stop
+m1
+; comment
+cmp #-93, *r4
+add L91, *r3
+add r2, r6
+jsr *r0
+clr L31
+prn *r0
+cmp r2, L12
+m4
+L77: jsr *r6
+m4
+m1
+L78: inc L93
+m3
+m2
+rts
+stop
+mov *r1, r0
+L79: sub r6, *r3
+prn r2
+L80: jsr L82
+L81: not r3
+lea L25, *r3
+L82: .data -130, 201, 981, 235
+lea L37, *r7
+stop
+jmp L0
+L83: jmp L26
+dec *r1
+L84: .string "fwdjbiummlizrqtbjpoe"
+
+add L76, r5
+m4
+m4
+m2
+L85: prn #-23
+m1
+clr *r5
+m4
+dec L94
+jmp L105
+not L13
+L86: prn L111
+L87: .data 176, -749, 720, 624
+
+bne *r1
+not *r3
+lea L97, L118
+sub r7, *r1
+clr L110
+mov #187, r3
+cmp L95, *r1
+add *r2, r5
+m0
+L88: sub r3, L53
+sub *r6, L121
+cmp #-26, L90
+rts
+L89: .string "ejwtpncijclfbizbotymdz"
+red L56
+jsr L38
+m0
+m2
+m4
+L90: .data 356, 192, 808, -603, 969, -35, 212
+; comment
+m4
+prn #105
+jsr *r2
+stop
+jsr *r3
+m3
+sub #221, *r2
+cmp *r3, *r0
+m1
+mov L52, r2
+m1
+stop
+add r0, *r4
+lea L92, r4
+L91: jsr L75
+stop
+m3
+L92: .data 987, 8, -375
+L93: stop
+inc *r1
+bne L98
+m4
+L94: .string "pyi"
+inc L3
+
+m4
+sub r2, *r0
+
+bne L116
+sub *r0, L56
+m4
+m1
+m1
+inc *r4
+L95: inc *r5
+mov *r6, L77
+stop
+stop
+rts
+bne L83
+not r5
+m4
+L96: .string "opujzs"
+L97: jmp L117
+m3
+mov *r5, *r2
+rts
+L98: .data 27, 432, 468
+m0
+not r0
+m4
+rts
+dec r2
+lea L25, r4
+m2
+stop
+mov r6, L117
+m2
+m4
+jsr L31
+stop
+jsr *r4
+L99: jmp *r2
+not *r7
+not *r6
+m1
+m1
+dec L109
+L100: inc r6
+clr *r0
+L101: .string "quhwqqtxikojwn"
+not L92
+cmp r5, *r7
+m3
+prn *r3
+L102: .string "tpmnbvgngvibdrtogzrgqv"
+sub r6, L117
+L103: jsr *r2
+L104: mov #191, r4
+L105: inc r4
+add L21, *r1
+cmp *r1, r6
+m2
+not L117
+inc r3
+not r7
+mov #-40, *r5
+m1
+L106: rts
+L107: mov #203, r1
+jmp L108
+m4
+prn #-237
+cmp r4, #-88
+L108: clr *r1
+L109: .data 430
+add r2, r0
+
+L110: .data -906, 365, 886
+L111: .data -13, -341, -467
+L112: jsr L114
+m0
+jsr L120
+inc *r7
+prn r4
+L113: .data 241, -788, -382, -939, -148
+L114: .string "xyqs"
+jsr L103
+mov L28, r2
+L115: sub #203, r6
+m1
+bne *r1
+m3
+jmp *r3
+jmp *r4
+m2
+stop
+m2
+L116: lea L65, r4
+add #-246, *r5
+lea L117, *r4
+clr r1
+L117: inc *r0
+lea L44, L119
+jsr L22
+bne *r1
+sub r2, L49
+L118: clr r5
+lea L121, r5
+sub #-131, L86
+
+L119: .data 925, 971, -908, 891, -365, 951, -663
+L120: inc *r3
+rts
+L121: .string "kifiwmumon"
+mov *r1, *r6
+lea L51, L1
+prn L69
+dec L117
+mov *r6, L104
+stop
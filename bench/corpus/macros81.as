@@ -0,0 +1,571 @@
+; Generated by genCorpus --seed 82
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+macr m0
+    clr *r5
+    prn L27
+    not *r7
+    rts
+    mov *r7, L84
+    dec L54
+    jsr *r7
+    jmp L91
+    inc *r5
+    lea L37, *r7
+endmacr
+macr m1
+    clr r0
+    add L100, L66
+    rts
+    not *r6
+    inc L128
+    jsr L46
+    sub *r6, L101
+    rts
+    clr L54
+    red L77
+endmacr
+macr m2
+    jsr *r1
+    red *r5
+    add L110, r0
+    bne L87
+    jmp *r2
+    jmp *r7
+    add r1, r5
+    jsr L116
+    prn r3
+    red L83
+endmacr
+macr m3
+    lea L68, *r6
+    cmp *r2, #141
+    prn r7
+    jmp L72
+    jsr L53
+    inc *r2
+    sub #-249, L28
+    lea L92, *r0
+    sub #-27, r3
+    stop
+endmacr
+macr m4
+    jmp *r5
+    inc L27
+    lea L27, r4
+    prn r0
+    mov #-103, r2
+    clr r6
+    clr r1
+    stop
+    dec *r2
+    rts
+endmacr
+jsr L43
+clr *r7
+add r4, L7
+L0: prn *r0
+m2
+L1: .data -77
+inc r4
+stop
+stop
+; comment
+m4
+
+L2: jsr L2
+bne *r0
+L3: .string "fxfoscvfuvahabnfmf"
+L4: jsr *r4
+prn L112
+
+rts
+m3
+cmp *r3, *r4
+dec L102
+m4
+L5: .string "xysrhmvanywbvbxr"
+red *r4
+jsr *r2
+L6: prn #-40
+not L2
+m4
+lea L107, *r3
+jmp L3
+dec *r5
+clr L52
+; comment
+L7: .string "ijkwzvz"
+m4
+prn L36
+clr r3
+mov *r1, *r7
+L8: .string "yssfjytljdcbesf"
+stop
+L9: rts
+; comment
+L10: prn *r3
+m2
+stop
+cmp r0, *r7
+m1
+rts
+L11: .data 866, 997, -782, 367, 41, 334, -3, -517
+L12: clr L35
+L13: .data 64, -431, 634, 865, -959, 997, 91, -540
+
+L14: mov r7, r6
+L15: .string "rrufptdafboqaxwwqvw"
+sub L32, L113
+
+red r3
+m1
+add *r7, L31
+add *r0, r3
+rts
+dec *r0
+lea L68, L4
+clr *r0
+m2
+dec r2
+not L100
+not L104
+L16: .string "vmvbwjfe"
+L17: prn r7
+m2
+dec r6
+L18: cmp r4, *r4
+mov r4, L2
+L19: .data -132, 570, -720, 606, 367, -142, -865, -991
+m0
+L20: .string "cnpdflcogt"
+L21: .string "rgdlneu"
+m0
+L22: .data 761, 637, 982, -455, -627, 696
+prn L68
+clr *r4
+L23: clr L3
+L24: jsr L128
+sub r6, r5
+rts
+rts
+lea L124, *r4
+lea L106, r1
+add L74, *r5
+L25: .data -624, -209, 689, 559, 289
+m0
+; comment
+; comment
+m1
+m0
+not *r3
+L26: .data 25, -973, -531, -836, 133, 959, -604
+m2
+m1
+inc r2
+add r3, *r4
+cmp r7, #240
+rts
+L27: mov *r4, *r2
+m2
+m0
+m1
+L28: prn r0
+stop
+inc *r3
+stop
+rts
+m3
+L29: .string "jqismcmxthztfjmdsqn"
+cmp #-130, r3
+L30: jsr L14
+L31: rts
+mov *r2, r0
+L32: .string "tdykr"
+L33: jsr *r6
+L34: clr *r3
+red r1
+inc r0
+; comment
+L35: mov r1, r7
+m0
+jsr *r5
+cmp r0, L109
+dec *r3
+L36: .data 924, -527, -256, -644, 23, 859, -18
+jsr L6
+bne *r0
+dec r5
+L37: lea L10, r3
+m2
+jmp L22
+m2
+prn *r5
+jsr L2
+L38: not L120
+rts
+L39: bne *r7
+L40: jsr L25
+L41: .string "s"
+clr *r7
+L42: mov L12, *r0
+L43: dec r1
+L44: inc r7
+m0
+dec L61
+m0
+cmp *r1, r6
+m2
+L45: add L19, r1
+L46: not r4
+L47: .data 256, -868, 210, 96, 670, 798, -756
+jmp L60
+m3
+m0
+L48: clr r1
+rts
+prn L11
+sub L46, *r7
+m4
+not L2
+L49: .string "kwiyjciwtuetkrklertisntr"
+mov #-246, r7
+L50: rts
+L51: .data -636, 392
+L52: .data -826, -831, -954, -379, 978, -729, -861, 770
+L53: bne *r4
+inc L21
+stop
+L54: dec r5
+mov *r2, *r7
+lea L25, L122
+jmp *r7
+lea L115, *r6
+m3
+m0
+clr r1
+; comment
+dec *r6
+m3
+sub r0, *r2
+cmp *r5, L37
+not *r5
+jmp L21
+m4
+L55: .data 73, -37, -537
+jsr L124
+stop
+add *r6, L79
+L56: red *r2
+m3
+L57: .string "p"
+lea L26, L111
+not L100
+L58: .string "n"
+jmp L57
+prn *r5
+jmp L24
+sub L58, L21
+not L0
+m3
+m3
+add L58, L75
+L59: .data 814, -205
+m4
+L60: stop
+L61: jmp *r4
+add #108, r2
+lea L111, r4
+L62: .data 705, -991, 809, -88, 422, -639, -515, 435
+L63: dec r2
+not r5
+L64: cmp L94, r5
+dec L72
+stop
+mov r5, L80
+L65: .data 907, 560, 681, -912, -895, -521, -348
+rts
+m1
+jsr *r1
+L66: red *r6
+mov *r3, *r5
+sub L62, L128
+stop
+not *r5
+jmp *r4
+m0
+
+m4
+jmp L91
+L67: .data -471, 501, 467, 694, 947, 82, -434, 991
+lea L55, *r6
+L68: dec *r2
+L69: prn *r5
+cmp L25, *r2
+jsr *r3
+L70: not *r7
+m0
+add r3, *r0
+L71: mov #111, L119
+m1
+m4
+L72: .data -520, 785, -922, -790, 419, 589, -538
+m1
+L73: bne *r6
+mov r1, r4
+sub r6, *r1
+stop
+
+sub L100, r7
+L74: prn r4
+cmp r2, *r1
+m0
+jsr L75
+
+jsr L97
+rts
+lea L87, r4
+mov #102, r0
+jmp *r1
+L75: jsr L86
+bne *r7
+m4
+add *r0, r1
+; comment
+m3
+jsr *r0
+L76: .data 403, 986, 576
+rts
+L77: mov #30, *r6
+lea L65, L50
+L78: lea L43, L91
+m1
+sub #-167, *r2
+add r1, *r1
+jsr L73
+m4
+m4
+mov L9, *r2
+L79: cmp #-66, *r4
+cmp #-241, r7
+m4
+add r1, r7
+cmp #-196, L124
+m4
+m1
+L80: inc *r2
+jmp L17
+m1
+bne L72
+L81: .data -86, 70, -86, -912
+sub r6, r3
+m2
+add #182, r5
+bne L99
+m2
+m2
+L82: .data 606, -763, 296, -470, -424, -732, -365
+L83: red L96
+m3
+add *r5, L40
+clr L84
+jsr L112
+L84: .data -709, -182, -825
+m0
+; comment
+L85: add *r6, r2
+m2
+L86: .string "uarjujrcsbrftoiuxac"
+dec r1
+inc r6
+not r1
+L87: stop
+L88: sub L113, r2
+not L20
+red *r1
+clr *r1
+L89: .string "pkzznlwrth"
+sub *r6, r3
+bne L90
+m4
+L90: mov *r1, L10
+L91: sub #-247, r4
+m2
+mov #-231, *r6
+m0
+m2
+clr *r6
+; comment
+prn *r3
+not L118
+stop
+L92: stop
+cmp #27, *r7
+m2
+m0
+cmp L107, *r1
+L93: cmp #145, r5
+not r1
+; comment
+L94: sub L56, L126
+
+m1
+jsr *r2
+L95: .data 558
+cmp *r2, r0
+cmp #-187, L116
+not r4
+sub *r1, L106
+L96: .data -603, -827, 23
+m4
+not *r1
+jmp L45
+rts
+rts
+L97: .string "geynhkrzgm"
+mov r2, L69
+m0
+jmp *r2
+
+
+L98: .data -744, 469
+L99: prn *r2
+jsr L38
+m0
+mov #119, r4
+add #-106, *r0
+prn r6
+L100: .data -606, 422, -996, -66, -162
+not r7
+sub r6, r5
+L101: not r4
+m3
+m4
+L102: jmp L3
+clr L55
+L103: rts
+
+dec r1
+red r5
+L104: clr *r1
+m0
+sub L125, r5
+m2
+L105: clr *r2
+inc *r4
+inc L125
+L106: clr *r1
+L107: .data 152, 121, 592, -149, 2, -661
+inc r1
+prn *r3
+lea L127, r4
+not L120
+inc *r4
+L108: .string "bvloifzwki"
+m4
+lea L120, r2
+L109: prn r2
+inc *r2
+rts
+not L122
+mov #185, r6
+m0
+sub *r5, r4
+L110: .data -884, 104, -701, -874
+bne *r6
+m3
+red L111
+L111: .string "esyaazvakx"
+inc r4
+cmp *r3, *r0
+L112: sub *r3, r1
+cmp r4, *r5
+cmp L124, #72
+L113: .string "tnjifkiapvoyrkppcsawwa"
+bne *r4
+L114: .string "l"
+cmp r7, L45
+red L37
+L115: bne L123
+stop
+bne *r1
+m4
+
+m0
+mov #48, *r5
+m0
+stop
+cmp *r2, L115
+dec *r0
+m4
+jmp L117
+not r0
+dec L24
+clr L7
+red L124
+bne L36
+m2
+not *r3
+cmp *r7, *r2
+m0
+L116: cmp #-144, L62
+L117: .string "lgozplmaebcwmxvjbjpwkrb"
+sub *r0, *r5
+dec L64
+L118: inc r5
+inc L123
+L119: red *r0
+stop
+sub *r3, *r5
+L120: .string "ukqxlp"
+add #26, *r6
+dec L109
+bne *r3
+red r2
+m4
+red r0
+m1
+bne L125
+; comment
+L121: .string "plfybsisvsyvyn"
+m1
+mov #93, *r0
+L122: .data -512, 966, -642
+cmp *r7, #3
+mov *r4, *r0
+
+clr L87
+L123: inc r3
+lea L11, L107
+clr L128
+add #61, r5
+jsr L87
+mov #-75, L128
+jmp *r0
+bne *r6
+add #30, *r6
+clr L127
+L124: .string "zntwzloadkmqiejctnrwv"
+clr r2
+L125: .data -904, -93, -781, -137, -192, 941
+L126: .data -851, -54, 762, -156, 171, -861, -342
+sub r0, r7
+bne L124
+jmp *r0
+m3
+bne *r1
+sub L128, r2
+L127: .data -193, -54, -917
+L128: jmp *r2
+inc *r7
+m0
+red *r7
+not *r5
+stop
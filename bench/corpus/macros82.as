@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 83
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    sub #-44, L28
+    add #221, L86
+    red L107
+    cmp *r7, r5
+    lea L108, *r0
+    clr L36
+    bne *r1
+    stop
+    bne *r6
+    jsr L35
+endmacr
+macr m1
+    stop
+    rts
+    mov r0, L71
+    prn #-125
+    stop
+    add #223, r7
+    mov r7, r3
+    lea L63, *r0
+    lea L102, *r2
+    jsr L51
+endmacr
+macr m2
+    bne L1
+    stop
+    cmp #198, *r2
+    mov *r0, *r6
+    jmp *r5
+    add *r3, *r0
+    jsr *r2
+    add *r6, L56
+    mov *r3, *r3
+    not r0
+endmacr
+macr m3
+    not r2
+    add L13, *r1
+    inc L66
+    lea L88, *r2
+    dec L99
+    cmp r6, #-106
+    not L101
+    sub #-125, *r4
+    jmp *r4
+    inc r2
+endmacr
+macr m4
+    not r6
+    red r3
+    mov r2, r0
+    dec L112
+    bne L48
+    add L13, L13
+    jsr L108
+    jsr L82
+    stop
+    mov *r6, *r1
+endmacr
+mov L112, *r3
+L0: not r0
+m1
+L1: bne *r6
+L2: jmp L9
+L3: .string "zs"
+bne *r0
+not *r0
+cmp *r7, *r3
+m0
+bne *r0
+m1
+m0
+m1
+
+jmp L66
+clr *r2
+add r1, *r1
+cmp *r5, #-238
+L4: jmp L2
+L5: .string "wddtv"
+jsr L0
+L6: .data -616, -301, -273, 216, -382
+m1
+L7: .data -876, -223, -120, -386, -992, 622, -268
+m2
+; comment
+rts
+stop
+; comment
+lea L53, L115
+; comment
+L8: rts
+m3
+; comment
+rts
+jsr L55
+L9: .data 428, -669, 969, 936, 898
+rts
+add L88, *r3
+cmp *r6, #252
+L10: clr *r1
+L11: .data -864, 513, 937, 959
+; comment
+dec r6
+m1
+jmp *r0
+m0
+L12: stop
+add *r4, *r2
+L13: clr *r2
+sub L12, L46
+; comment
+
+inc *r4
+L14: not r6
+; comment
+lea L34, r1
+L15: .data -15, 551, -951
+L16: jsr *r5
+m3
+dec L12
+not *r2
+dec L9
+clr *r4
+L17: .data 125, -51, 36, 766, 648, -79, 503
+; comment
+clr *r5
+L18: .data 201
+inc L63
+L19: jmp *r2
+lea L78, L114
+L20: .string "ox"
+L21: stop
+m3
+jmp L2
+bne *r7
+L22: mov r5, r4
+mov r7, L100
+mov #85, *r5
+m2
+L23: .data -633, 32, -178, -581, -962
+; comment
+jsr L56
+jmp L105
+
+prn *r3
+
+clr *r6
+bne L57
+cmp #183, #253
+mov r5, *r0
+L24: jsr L36
+; comment
+lea L61, r2
+clr L43
+add r3, L19
+prn r5
+dec *r5
+jsr L6
+m4
+sub #-188, L19
+cmp #113, *r6
+not *r6
+m0
+m0
+prn r0
+stop
+add r7, *r3
+L25: .string "mrzegjsnfzmwewwkklvammr"
+not r1
+; comment
+L26: cmp r5, r4
+m2
+add *r6, r0
+jsr L31
+m2
+m4
+lea L21, r3
+stop
+lea L87, r2
+inc *r2
+L27: mov #-27, r6
+m1
+L28: .string "ztcgrd"
+cmp #-116, #114
+m0
+; comment
+L29: .string "uiwdo"
+m1
+stop
+rts
+m3
+L30: .data 196, 703, 112, -644, -389, 422, 85, 418
+dec r1
+L31: jmp *r7
+L32: jmp L57
+not L24
+L33: .data -260
+m3
+mov r6, L54
+L34: .data -624, -599, -686
+mov *r7, r3
+; comment
+L35: clr L15
+sub r2, r1
+L36: .string "gzyrmwbhhcpcfyas"
+L37: red *r2
+L38: .string "fjrnsq"
+prn *r2
+L39: add *r7, r2
+lea L98, r6
+m2
+not r7
+jmp *r7
+jmp L9
+L40: .string "kpnnklutompddgpgjqjjo"
+sub r2, r1
+clr *r0
+red r7
+L41: bne L102
+cmp *r4, *r6
+; comment
+L42: add r1, *r5
+
+; comment
+jsr L114
+add r2, *r1
+cmp *r2, #-189
+m4
+red L104
+m0
+sub #104, r5
+m3
+jsr L57
+jsr L9
+m0
+m4
+add r3, L67
+lea L21, r1
+sub L35, L39
+sub r7, r7
+L43: add *r0, *r3
+bne *r4
+add *r1, L76
+not *r0
+jsr *r5
+m4
+m3
+L44: .data -742, 2, 11, 461, 736, -519, 926, -956
+; comment
+L45: jmp L10
+m2
+L46: lea L22, L109
+L47: .string "ksqxfvawsknwc"
+L48: .string "lcqjsrwzfgveddbbng"
+red *r7
+jsr L70
+L49: .string "biislz"
+L50: .string "foireyybrrrgruqih"
+L51: bne *r1
+dec r6
+sub L3, r5
+m2
+red *r4
+jmp L71
+prn #-41
+m3
+mov L28, r4
+L52: jsr L60
+bne L82
+add r7, r6
+m3
+L53: dec L74
+red L55
+bne *r2
+jmp L72
+cmp L10, #168
+L54: prn r2
+; comment
+m4
+sub r0, L65
+rts
+m4
+L55: red L82
+jmp L88
+prn #-181
+lea L105, L67
+L56: .data 58
+rts
+m3
+m4
+L57: .string "lyndqyvfjsznsbkidlw"
+m1
+stop
+not *r5
+L58: add *r5, r6
+lea L66, *r6
+L59: .data 615, 193, -603, -239, 214, -429, -774
+stop
+mov *r1, *r0
+not L92
+rts
+L60: cmp *r0, L76
+clr *r4
+L61: clr r0
+L62: .data -393, -128, -426, 520, -24
+bne L59
+m4
+; comment
+red L41
+L63: .string "mzuubntlbhthmrsq"
+m1
+bne *r0
+mov r4, L101
+sub #-200, L86
+prn #13
+add L7, *r0
+prn r5
+jsr L75
+stop
+lea L2, *r2
+lea L78, *r4
+sub L11, *r6
+cmp #238, r3
+sub *r6, r4
+m1
+prn L52
+jsr *r7
+; comment
+cmp #242, L72
+red L1
+bne *r1
+m0
+sub L35, *r3
+prn #-39
+L64: not *r1
+L65: red r0
+lea L98, L71
+add L111, r5
+rts
+L66: dec *r5
+; comment
+mov #158, r7
+inc r4
+mov L94, *r5
+m1
+m0
+; comment
+clr *r5
+clr *r4
+prn #169
+L67: .data 914, 960, -166, -42
+L68: .data -751, -164
+red *r6
+L69: .data -685
+L70: .data 277, 20, 982, -747, -525, -987, 242
+L71: .data 566, -985
+clr r6
+jmp *r6
+rts
+add L4, r0
+jsr L113
+m0
+sub L83, r0
+cmp #-244, *r1
+m1
+m3
+L72: .string "tobspxbwjt"
+m0
+jmp *r2
+lea L25, r5
+bne L65
+L73: .data -161, -980, 438, 860, 384, 819, 26
+clr *r0
+L74: sub *r7, r1
+L75: mov L104, r1
+jmp L71
+bne L72
+L76: .data -331, 844, -664, 854
+L77: bne L70
+m4
+L78: .string "ajunlsrrsygdyfrdvb"
+clr r2
+m0
+L79: .data -938, 191, -795
+add #120, L4
+add #255, L96
+jmp L15
+L80: bne L90
+m4
+stop
+mov L3, *r5
+prn L79
+m4
+m3
+; comment
+L81: .string "i"
+clr r5
+L82: bne *r2
+sub *r5, *r0
+L83: dec *r5
+not L112
+red *r5
+red *r0
+inc r1
+stop
+m2
+
+rts
+L84: .data -830, -789, -633, -980, -82, -840, -193, 176
+add *r7, r1
+sub r5, L107
+; comment
+rts
+lea L30, L5
+red L110
+red L90
+m1
+not r7
+L85: prn L19
+m0
+bne L5
+L86: .string "kkzszsvtwbkfyxksqyorw"
+m1
+clr r4
+inc r3
+m4
+
+m3
+prn L108
+
+m0
+m4
+L87: lea L89, r6
+L88: .data -854, 360, -549, -894, 730, -201
+; comment
+m0
+L89: stop
+
+m2
+L90: jmp *r2
+; comment
+m3
+m2
+L91: stop
+cmp #-15, r1
+L92: .data -458, -905, 428, -219, -383, -294, 249, 119
+bne *r7
+add L103, *r0
+L93: .data 697, 405, -690, -887, -933, 896, -40
+m3
+add #-57, L107
+stop
+rts
+L94: lea L95, *r6
+L95: jmp *r6
+red *r5
+rts
+jsr L113
+L96: sub #-218, r3
+rts
+m2
+jsr *r7
+inc *r2
+not *r0
+m2
+dec r5
+inc *r7
+cmp #-126, *r5
+sub L51, *r2
+L97: add *r0, L24
+prn r1
+L98: .string "zgrkxro"
+m2
+L99: .string "ousdvpivegwrcrxg"
+m4
+inc r6
+prn L35
+stop
+jsr *r2
+m3
+prn #180
+dec *r4
+bne *r5
+m1
+jsr L101
+m1
+L100: dec L106
+mov #-175, L113
+m3
+add #37, L86
+m2
+cmp r3, L110
+jsr L113
+; comment
+L101: rts
+prn #-79
+m3
+m0
+inc *r5
+cmp #19, #149
+
+; comment
+stop
+clr L113
+L102: clr *r1
+L103: sub *r7, L51
+bne L115
+inc *r1
+clr L110
+not L108
+stop
+L104: .string "ufudnlszohlhllmyfcylc"
+; comment
+stop
+dec *r7
+L105: .string "zjrarprp"
+L106: cmp #-59, r6
+m2
+not *r0
+jsr L111
+mov r4, r5
+m2
+mov #-187, r4
+bne *r1
+m3
+L107: .string "ikuwkecwrlig"
+L108: bne L110
+L109: .string "idrnoxyoptgvquzgx"
+
+jmp L115
+sub *r5, *r7
+
+L110: stop
+
+L111: not *r0
+m1
+prn #-120
+rts
+L112: .data 223
+cmp *r4, r6
+add r6, r2
+
+bne L100
+sub L115, r2
+clr r0
+red *r3
+sub *r4, L22
+sub *r1, L56
+L113: .string "dyo"
+clr r0
+rts
+L114: jmp *r4
+L115: jsr *r6
+red *r4
+m1
+bne *r3
+m4
+clr r7
+stop
@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 84
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    rts
+    not r0
+    red L94
+    cmp r1, r2
+    prn L102
+    jsr L80
+    clr L57
+    prn #-171
+    stop
+    cmp *r7, #10
+endmacr
+macr m1
+    cmp *r1, L37
+    mov #-241, r6
+    not L71
+    sub #41, *r0
+    rts
+    prn r1
+    lea L74, *r2
+    cmp #82, L10
+    prn L89
+    mov r0, *r1
+endmacr
+macr m2
+    red r6
+    lea L52, *r2
+    cmp #68, #-122
+    mov L100, L45
+    inc r1
+    prn r0
+    dec *r1
+    jsr L3
+    jmp *r4
+    cmp r6, L39
+endmacr
+macr m3
+    inc r1
+    red L78
+    add r7, r4
+    not L24
+    sub r6, r3
+    cmp L60, #44
+    prn r1
+    dec L16
+    jsr L82
+    prn *r0
+endmacr
+macr m4
+    red L113
+    dec r3
+    lea L34, r2
+    red L58
+    mov r1, *r3
+    lea L86, L113
+    add #-75, r7
+    bne *r3
+    bne L34
+    sub L60, *r5
+endmacr
+lea L49, r2
+sub #-97, *r2
+L0: .data 718, -38
+bne *r1
+add L47, L0
+L1: .string "rvbsmzbgphhxe"
+L2: .data 208, 894, -962, 694, -9
+prn r5
+m1
+L3: .data 717, 410, -997, -162, 816, 245, 107, 211
+m2
+L4: inc *r2
+rts
+L5: lea L112, r7
+L6: .string "xprtiswpipgsmzrfayhs"
+inc *r5
+inc *r5
+sub r0, L1
+m3
+inc *r2
+L7: .string "woltodno"
+m2
+L8: jmp L2
+m3
+clr *r5
+L9: not r0
+clr *r5
+bne L2
+; comment
+L10: not r1
+jsr L104
+L11: .data -961, -208, -861, -583, 153, 356
+L12: .string "as"
+inc r1
+rts
+mov L57, r5
+m1
+; comment
+; comment
+m2
+inc *r4
+L13: clr *r1
+; comment
+jsr L85
+lea L26, r3
+L14: mov r7, *r2
+lea L10, r4
+inc r5
+cmp #-233, #-140
+clr *r2
+mov *r1, *r0
+inc r3
+m1
+mov *r1, r7
+bne *r4
+L15: stop
+jsr *r1
+lea L73, r5
+red L21
+stop
+L16: .string "iqeuqnbdmu"
+m3
+L17: .string "apaigypevbyxxboh"
+m2
+m1
+prn *r3
+not *r6
+L18: bne L49
+m3
+rts
+m2
+jmp L11
+m1
+cmp L32, *r4
+cmp r6, L19
+dec L29
+m2
+L19: add #-54, *r6
+jmp L73
+; comment
+L20: .data 229, 491, 598, 880, -350, -732
+m3
+mov r3, r1
+jmp *r1
+m1
+lea L3, *r7
+prn L94
+jmp *r4
+m4
+inc r1
+red *r4
+m1
+not *r3
+dec L3
+m4
+L21: .string "fxmrvftrlznqdemxv"
+lea L6, r3
+m1
+m4
+mov L103, *r2
+
+jmp *r1
+add *r4, *r0
+L22: clr L9
+
+L23: dec *r5
+prn *r5
+red *r6
+L24: inc r6
+m1
+bne L111
+m2
+
+not r3
+lea L18, r3
+add L31, *r2
+m0
+L25: cmp #-167, #242
+L26: .string "zeeopptzhctaxulhw"
+clr r1
+L27: sub L62, r4
+L28: red L24
+inc L10
+L29: .data 154, 925, 65, -610, 483, 440, 324
+L30: mov *r3, r4
+L31: lea L88, L12
+
+cmp L93, *r3
+dec *r4
+clr r5
+sub *r6, *r7
+L32: .string "exanovjpfpzzeurrfijmr"
+clr L102
+bne L1
+mov L60, L74
+lea L2, *r2
+stop
+prn r6
+m0
+cmp L88, L67
+prn L10
+mov L28, L92
+m0
+stop
+inc L93
+L33: .string "dejxlwdnvaes"
+dec *r1
+prn *r5
+mov L113, L49
+mov r0, r4
+m2
+not *r2
+L34: .data -831, 976, 670, -28, -843, -664, -467
+cmp #-162, r0
+clr *r1
+L35: bne L4
+L36: jmp L17
+rts
+m2
+L37: mov *r4, r4
+m4
+jsr L72
+L38: .string "qacfzqcsigsstzvrk"
+add #193, L15
+jsr *r7
+m2
+cmp *r4, #-17
+L39: not *r3
+L40: sub r3, r7
+prn *r3
+not L5
+sub r3, *r0
+red r7
+L41: cmp *r6, L46
+rts
+L42: bne *r1
+mov L10, L68
+L43: .data 758, -489, 728, 189, -658, 174, -37
+m0
+clr L13
+L44: rts
+sub #105, r2
+m1
+jsr *r7
+
+stop
+L45: .string "iczkpwpkgpsmdkkdvevntg"
+inc *r2
+dec L31
+L46: rts
+L47: red L84
+; comment
+jmp L66
+inc *r5
+jmp L98
+sub #129, L31
+L48: .data 885, 157
+L49: dec *r1
+m0
+L50: not r2
+m1
+m3
+L51: .data 603, 24, -781, 840, 118
+mov #-40, *r6
+red r3
+mov r0, *r4
+L52: .string "rxqbttdkyydwdnlney"
+L53: .string "gssqchrxmouqibbj"
+bne *r6
+
+add *r6, L3
+prn *r5
+m2
+clr r0
+mov L15, L67
+L54: .string "vruradbmltwqo"
+mov *r7, L66
+dec *r7
+clr *r4
+
+rts
+bne L44
+jsr *r6
+red *r0
+stop
+bne L42
+add L48, L67
+sub L75, r7
+bne L53
+
+m2
+lea L4, *r7
+; comment
+prn *r3
+L55: sub L104, r7
+m0
+dec r6
+m2
+lea L97, r6
+m2
+jsr L14
+m4
+inc L101
+bne L33
+bne L31
+bne L97
+
+
+L56: add r6, r0
+mov #61, r7
+mov r7, *r4
+cmp r6, #217
+
+m1
+lea L38, *r6
+L57: .string "rwpzlacmrnbznfirry"
+red L110
+m4
+L58: sub #110, r0
+m2
+add L97, L67
+mov L28, *r0
+jsr *r7
+m2
+cmp r2, L111
+add *r4, L19
+mov L82, r2
+inc *r7
+cmp L62, *r6
+L59: red *r0
+clr r5
+dec *r0
+L60: .string "jupacpbsswukfdhkbl"
+sub #-154, *r5
+prn L100
+L61: bne *r2
+L62: not r0
+prn r2
+m2
+L63: .data 718, 12, 90, 67, -425
+clr r4
+jmp *r4
+L64: .string "cc"
+L65: clr L19
+clr r5
+add r0, L76
+dec *r7
+L66: .string "qzihtlxtrfqzcjoqubnxsne"
+prn L42
+L67: .data 732, 99, -440, -310, -893, 851, -704, -159
+not *r5
+clr r3
+dec L71
+L68: dec r5
+prn L23
+sub *r3, r0
+dec L14
+prn *r6
+L69: not *r1
+m3
+m1
+m2
+prn L85
+L70: .string "rbvugvtrje"
+bne *r1
+; comment
+
+cmp *r1, #-225
+L71: not L91
+L72: add L113, r0
+L73: bne L99
+sub *r3, L40
+L74: .data -540, 95, -374, 784, -333, 637, 639
+jsr L68
+m4
+stop
+m0
+mov r5, L26
+cmp r4, *r6
+L75: inc L20
+mov #-125, L41
+L76: jmp *r0
+red *r2
+m1
+m0
+add *r2, *r2
+m4
+inc r6
+mov L99, r5
+dec r7
+bne *r3
+m2
+stop
+L77: rts
+dec L17
+L78: jsr *r6
+bne L98
+m3
+mov *r3, *r5
+prn r6
+cmp r0, #-139
+L79: not r6
+m1
+cmp L62, L88
+L80: bne L9
+bne L89
+L81: .data 67, -683, -187, 54, 695, -627, 494, 460
+prn #42
+m2
+rts
+add L90, r3
+dec L64
+m1
+L82: add L94, *r4
+m3
+prn r0
+m3
+clr *r3
+L83: .data -160, 16, 547, -965
+m3
+inc *r6
+sub #50, L97
+L84: .data -471, 929, 575, 175, -224, 970, -427
+L85: mov *r1, *r0
+; comment
+jmp L51
+m4
+L86: .string "gsbksqhqzkgq"
+m4
+lea L89, r7
+m4
+L87: cmp L50, #-78
+
+sub r3, L106
+L88: jmp *r7
+add #-169, L95
+L89: mov r0, r6
+clr r5
+add L41, L55
+m0
+lea L20, *r6
+stop
+mov #-119, *r1
+m3
+m0
+bne *r1
+m2
+bne *r7
+sub *r7, *r1
+bne L8
+m2
+L90: dec r7
+not *r6
+sub *r0, r3
+cmp r2, r4
+L91: .string "tqbyxnuymnwox"
+m0
+L92: .data -685, 313, -301, -457, -843, -950, -584, -844
+stop
+m0
+clr r6
+L93: .data 346, 189, 877, -423
+add r4, *r7
+L94: .string "ldyylwuicezzrmr"
+jsr *r7
+m1
+mov r5, r6
+m0
+mov #-151, *r3
+L95: .string "oletyqxpqodvdkcfqxriv"
+L96: mov L28, r4
+L97: .data -826, -889, -903, -423, 363, -29, 715, -268
+prn #-26
+clr L87
+m4
+add #-244, L77
+not *r5
+L98: mov #215, L44
+
+m2
+L99: .string "nyezilulaowl"
+sub r3, *r0
+inc L64
+; comment
+; comment
+L100: add *r0, r6
+rts
+not L18
+m0
+rts
+clr L46
+dec L103
+jmp L109
+red *r7
+L101: jsr L108
+rts
+mov r2, *r1
+L102: mov *r2, r0
+m4
+jmp L112
+inc r2
+prn L73
+lea L109, L49
+L103: .data -190, 517, 629, 183, -748
+
+jmp L109
+m3
+red L26
+bne *r5
+lea L2, *r7
+L104: prn L63
+not *r6
+red *r2
+red *r6
+sub *r0, L103
+red r2
+m3
+
+m2
+dec r7
+cmp *r0, r2
+prn r2
+jsr L75
+L105: red *r3
+lea L89, L112
+inc L33
+m1
+lea L82, r1
+m4
+L106: bne L0
+bne L40
+L107: inc L64
+m3
+dec r2
+prn *r6
+L108: .data -349, 991, 895, -499
+L109: .string "rybxffuuj"
+stop
+cmp L5, L112
+prn *r3
+m0
+L110: sub r1, *r7
+prn #19
+not *r6
+mov L113, r2
+bne *r2
+m2
+add *r2, L56
+clr *r0
+L111: sub r5, r6
+m1
+mov L33, L112
+m2
+prn L39
+lea L74, *r6
+dec *r6
+inc L96
+L112: clr r5
+L113: .string "stik"
+sub *r3, *r6
+stop
@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 85
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    clr r4
+    lea L76, r2
+    clr r3
+    bne *r3
+    stop
+    dec *r5
+    bne *r7
+    prn *r2
+    prn r2
+    stop
+endmacr
+macr m1
+    lea L95, *r1
+    bne L102
+    not r7
+    stop
+    jmp L29
+    bne L81
+    add *r2, r4
+    clr *r2
+    jsr L57
+    not *r2
+endmacr
+macr m2
+    red r6
+    jmp *r1
+    stop
+    not L100
+    stop
+    dec L38
+    clr L78
+    jsr L3
+    mov *r7, r2
+    prn *r2
+endmacr
+macr m3
+    clr *r7
+    red L30
+    dec *r7
+    stop
+    dec r5
+    jmp *r1
+    cmp *r2, *r6
+    inc L62
+    cmp #-88, r1
+    jsr *r3
+endmacr
+macr m4
+    jmp *r5
+    jmp *r0
+    dec L94
+    prn r0
+    rts
+    jsr L1
+    lea L88, L32
+    jmp *r4
+    stop
+    jmp L89
+endmacr
+; comment
+jmp L13
+L0: inc L0
+prn *r7
+m2
+lea L0, L47
+dec L0
+bne L34
+clr r2
+L1: not L0
+L2: .string "wcezkrq"
+clr *r5
+red *r6
+lea L2, *r0
+L3: prn #-233
+jmp L1
+prn *r6
+L4: .string "wxukydzyc"
+L5: .data 133, -528, -727, 2, -277, -572, -335
+bne L109
+m3
+L6: .data 373, -643, 892
+L7: sub *r4, r7
+L8: .string "osz"
+prn L1
+inc r5
+m0
+red *r4
+prn *r2
+m2
+L9: stop
+rts
+L10: add r3, L51
+L11: .string "oh"
+m0
+lea L40, L102
+rts
+L12: .string "cqoufyd"
+red *r3
+L13: jsr L35
+add #222, *r4
+m3
+dec *r3
+m2
+cmp #-140, r5
+L14: add r7, L15
+rts
+inc r5
+red L47
+L15: .string "jopklqaaocrveue"
+m3
+inc r6
+clr L105
+dec *r6
+red L10
+m2
+L16: .string "ponmze"
+add L10, *r2
+L17: bne *r0
+dec r0
+prn *r1
+red r5
+L18: .string "hyafdrxobeudnubiulaeiteh"
+sub L69, *r1
+inc r7
+stop
+m3
+lea L31, r2
+m1
+L19: bne *r6
+bne L103
+
+inc r0
+m0
+m4
+L20: .data -173, -409, 821, 954, 378
+rts
+; comment
+L21: clr L15
+L22: .data 315, 210, 882
+jsr L30
+jsr *r5
+; comment
+cmp *r2, r5
+L23: dec *r7
+m4
+mov r3, L93
+bne L11
+jsr *r1
+; comment
+mov r6, r6
+lea L10, *r3
+L24: red *r7
+L25: not r6
+cmp #-209, *r1
+L26: .string "ppffizqwhfsvktucpyaeoahj"
+L27: .string "mlzcfzmnkloll"
+prn r0
+prn #-154
+inc *r4
+jmp *r6
+m1
+dec *r7
+bne *r2
+L28: dec L14
+stop
+add r7, *r7
+clr L95
+not *r2
+L29: mov #173, r2
+L30: stop
+sub L8, *r1
+m1
+m4
+L31: not *r0
+stop
+L32: dec r5
+m2
+m0
+prn L32
+cmp r7, r3
+dec *r0
+dec L91
+L33: .string "bhqjfpocorxvwzowpy"
+L34: inc *r2
+dec L20
+L35: not L48
+L36: dec L109
+inc *r1
+inc *r3
+m0
+m0
+m1
+not L2
+inc L40
+m3
+dec r6
+L37: not L77
+mov #57, r2
+L38: .string "ftqxgnfvjgn"
+add L18, *r3
+m2
+not *r3
+jmp *r6
+jmp L6
+inc L1
+L39: .data -171, -742, 940, 889, 801, -63, 423
+m4
+m3
+rts
+
+cmp r7, r3
+red *r0
+L40: .string "vfjqomxl"
+L41: jsr *r2
+L42: red r3
+not r7
+inc *r6
+bne L66
+; comment
+m1
+m4
+L43: jsr *r6
+m0
+red *r7
+m0
+lea L81, L50
+add #-150, *r6
+jmp L109
+L44: dec *r6
+clr *r0
+jmp *r0
+dec *r4
+clr *r1
+lea L57, *r2
+stop
+not r5
+m2
+L45: bne *r4
+stop
+prn *r2
+L46: bne L37
+L47: red L11
+rts
+red r2
+m2
+dec r6
+add L93, *r5
+m3
+red r2
+bne L14
+m3
+mov r0, r0
+dec r3
+L48: .data -177, 349, 603
+rts
+L49: prn L98
+L50: cmp L36, *r0
+m2
+clr *r3
+bne L7
+m4
+L51: .string "ncqjd"
+mov *r0, r7
+m0
+m1
+m4
+inc r7
+; comment
+not L20
+bne L47
+L52: prn L37
+L53: cmp *r1, L99
+m0
+L54: .string "efrefalwodvkcncyl"
+m0
+m0
+lea L14, *r2
+dec r2
+L55: lea L11, r1
+L56: .string "qexx"
+m0
+m2
+L57: add r5, L88
+L58: .string "dwdtoc"
+L59: clr L95
+stop
+m0
+L60: .data -641, -564, -416, -67, 333, -729, 361
+rts
+; comment
+sub #-149, L110
+rts
+lea L91, r1
+inc r6
+m4
+bne *r7
+lea L107, r4
+m3
+mov L57, L50
+jsr L32
+L61: .data -585, 803
+m3
+inc r5
+add #209, L86
+m0
+cmp *r0, *r1
+L62: jmp *r1
+L63: cmp r6, *r5
+prn r3
+m3
+
+m1
+lea L5, L97
+m0
+L64: bne *r7
+not r4
+not *r3
+rts
+add #101, r5
+red *r3
+rts
+m3
+L65: .data -889, 205, 894, -310
+L66: lea L52, r0
+dec *r5
+dec r5
+bne L63
+; comment
+m1
+m4
+m0
+inc L80
+jmp L103
+L67: bne *r5
+; comment
+L68: .string "ykobnesdjooktknldhhwyxx"
+mov r6, r4
+sub r0, r1
+; comment
+cmp r5, #73
+m4
+clr *r5
+not *r5
+sub #4, *r5
+rts
+jmp *r1
+rts
+not r1
+inc *r0
+jsr L105
+
+bne L58
+m4
+L69: .data 472, 420, 794, -800
+not *r5
+m4
+inc *r5
+inc *r3
+L70: .data -77, 398, -658
+cmp #-42, #47
+bne L73
+not r3
+jsr L82
+L71: lea L24, r6
+rts
+inc L69
+mov #107, r4
+jmp *r3
+jmp L77
+jsr *r7
+stop
+add L21, L115
+sub #-89, *r1
+; comment
+not L51
+L72: .string "slefuqwzwxtnnyogw"
+bne *r7
+red L51
+L73: mov r6, L79
+L74: red *r4
+; comment
+m3
+add L90, *r3
+L75: stop
+L76: dec *r4
+cmp L99, L32
+rts
+add L73, *r4
+; comment
+
+bne L92
+m1
+red r1
+inc *r3
+add *r3, *r1
+lea L57, *r7
+m3
+L77: .data -16, -58, 756, 629
+mov #-232, L39
+L78: .data 34, -419
+mov L80, r5
+red *r2
+L79: add #-104, r2
+L80: red L110
+L81: .data -518
+L82: jmp *r7
+jsr *r2
+jmp *r5
+mov #75, r4
+L83: sub *r0, L98
+m0
+m4
+L84: .data -695, -31, -9, 194
+cmp r3, #-68
+L85: .data -198, -513
+cmp L77, L49
+clr L111
+; comment
+inc r7
+
+L86: bne *r7
+mov *r7, r1
+mov *r5, r2
+dec r3
+lea L14, *r1
+L87: stop
+lea L74, *r2
+clr L63
+lea L109, r2
+; comment
+m4
+inc r6
+jsr L46
+cmp r6, L110
+m0
+bne L85
+L88: dec r0
+prn *r7
+m1
+lea L99, *r4
+L89: red *r3
+cmp L30, *r3
+L90: prn *r2
+sub L27, L54
+m4
+jmp *r7
+stop
+sub #-156, L112
+jmp L112
+m4
+jmp *r0
+inc L104
+lea L98, r0
+m0
+red L34
+L91: inc L93
+m0
+jmp *r4
+; comment
+L92: prn r7
+inc *r6
+clr L5
+m0
+m3
+m4
+m0
+not L74
+L93: cmp *r5, r7
+cmp L65, r0
+L94: jsr L92
+m2
+L95: jsr *r5
+m4
+m4
+prn r1
+cmp r6, *r2
+m2
+lea L31, r2
+add r2, r6
+mov r1, r6
+prn L103
+m0
+L96: .string "jvzjdger"
+m1
+L97: .data -491, 526, -847, 216, -624
+m2
+L98: .string "ncalnsrgybntzvbq"
+L99: not r5
+dec L106
+L100: .data 836
+m3
+m1
+red L114
+L101: clr r7
+rts
+
+m4
+sub #168, L106
+; comment
+L102: .data 548, 807, 203, 591
+sub r2, L83
+L103: sub #-126, L10
+L104: add L108, *r5
+L105: clr L53
+sub *r1, r7
+m4
+inc L36
+m1
+inc *r7
+m2
+L106: .data 50, 999, -700, -363
+lea L16, L78
+not L110
+dec L106
+cmp L60, L76
+L107: dec r1
+stop
+L108: .string "yukzfukugkgyg"
+m3
+bne L113
+; comment
+L109: .data -664, -981
+L110: dec L88
+mov *r7, L106
+m1
+sub *r4, L68
+red r1
+lea L111, L49
+L111: .data -683, -83, 342, 53, -106, 325
+cmp L115, L12
+dec *r1
+sub L68, r4
+not *r5
+lea L113, L87
+sub *r2, L112
+cmp L112, L112
+L112: .data -193
+add r2, *r5
+jsr *r6
+prn r5
+
+m2
+L113: .string "xgslrzcudmqbpegzevcr"
+inc *r2
+jmp L115
+m1
+L114: .data -903, 22, -432, -442, 481, 282, -824
+m1
+not *r0
+; comment
+mov L53, r2
+not r0
+m1
+stop
+dec r4
+m4
+L115: .data -284
+mov #220, L86
+dec L73
+stop
@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 86
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    rts
+    clr L76
+    add *r2, L82
+    sub *r3, r6
+    sub #-99, *r4
+    red L105
+    inc L37
+    jsr L69
+    rts
+    add *r6, r1
+endmacr
+macr m1
+    not L60
+    not *r1
+    jmp L50
+    dec *r4
+    clr *r2
+    cmp #-94, r2
+    jmp *r1
+    sub r1, r6
+    sub r4, *r3
+    rts
+endmacr
+macr m2
+    not *r2
+    stop
+    not L107
+    bne L48
+    jsr *r3
+    bne L27
+    lea L0, r3
+    dec r0
+    red r0
+    not *r5
+endmacr
+macr m3
+    lea L23, *r2
+    sub r3, *r0
+    cmp #-116, *r5
+    mov #163, L109
+    red *r6
+    dec L40
+    red r6
+    jsr L82
+    lea L8, *r4
+    mov *r2, *r4
+endmacr
+macr m4
+    jmp *r6
+    jmp L61
+    cmp L44, L104
+    prn r2
+    sub #-122, r3
+    inc r4
+    clr L56
+    dec L20
+    add *r0, L23
+    cmp L111, r0
+endmacr
+L0: cmp L40, #-191
+m3
+L1: bne *r4
+L2: dec *r3
+m3
+stop
+mov r6, *r5
+stop
+bne L106
+not L1
+
+red r6
+m3
+m0
+; comment
+L3: .string "nmxiicbyeyaig"
+bne *r6
+L4: stop
+add L90, *r2
+rts
+L5: red *r2
+lea L4, *r1
+inc L96
+L6: mov r4, r5
+sub r7, L104
+mov r5, *r0
+add r7, *r0
+stop
+bne *r6
+clr L2
+L7: .data -792
+add #24, r4
+L8: .data 474
+m0
+L9: .string "e"
+jmp *r1
+L10: stop
+L11: bne *r7
+L12: not r3
+jsr *r0
+; comment
+clr r3
+m4
+inc r1
+add #185, *r0
+prn *r6
+lea L67, *r2
+sub *r4, *r0
+L13: .data 7, 875, 893, -194, 498, 47
+m1
+rts
+dec r7
+m4
+mov L40, *r4
+jsr *r0
+m4
+L14: red r3
+rts
+sub r4, L5
+jsr *r4
+; comment
+prn *r7
+jmp *r6
+L15: .string "y"
+m4
+add #-188, r0
+L16: red *r0
+sub *r2, *r7
+rts
+jmp *r4
+rts
+clr L98
+sub L35, *r5
+red r7
+m0
+L17: sub #-253, r5
+jsr *r6
+lea L15, *r6
+L18: red L59
+mov L4, *r7
+m0
+dec L13
+; comment
+L19: .string "tblacfrxexkxpu"
+mov *r4, *r4
+
+stop
+m4
+m2
+m4
+prn r1
+add *r6, L11
+jmp *r4
+L20: .string "hk"
+L21: clr *r1
+m1
+red *r4
+stop
+jmp L18
+red r2
+clr *r7
+m2
+L22: .string "zuxuubxjejgadpzl"
+not r7
+dec *r5
+m0
+L23: rts
+bne L7
+jmp L20
+m4
+L24: .string "wgakrchtehgrg"
+cmp #-152, L89
+cmp L24, #201
+add r1, L21
+jmp *r4
+L25: jmp L99
+L26: .string "nruptfqupffzbnb"
+L27: .string "sbxgmt"
+sub *r4, L17
+add *r1, r1
+rts
+bne *r0
+lea L108, r1
+stop
+L28: .string "jflbzttkpjuxwvtrwzsbhdbv"
+L29: .string "ucwfaurgfuzmkgw"
+cmp r7, L18
+inc *r5
+m0
+jmp L7
+clr r7
+L30: .string "xtwlwenmuhjo"
+cmp r4, *r7
+clr L86
+bne L57
+m1
+bne *r4
+cmp *r6, #-37
+m0
+not *r4
+L31: .string "ahdafixbjf"
+L32: cmp #185, r2
+stop
+L33: .data 70, 201, 17, -343, -347, 651, -601
+L34: prn r6
+m3
+not r2
+mov r6, *r0
+m3
+; comment
+L35: jmp L5
+inc r1
+add *r1, r4
+; comment
+L36: dec L56
+L37: not *r7
+clr L77
+dec L3
+rts
+red r7
+lea L96, r5
+m1
+; comment
+lea L28, L0
+clr r5
+; comment
+m0
+bne L75
+m0
+prn r3
+mov r1, r5
+stop
+m3
+mov *r3, L91
+L38: mov *r1, r1
+red r7
+lea L98, L77
+m3
+dec r0
+m3
+red r1
+jsr L48
+clr r0
+L39: inc L19
+jsr *r1
+jmp *r6
+L40: .data -400, -985, -928, -336
+cmp r4, r1
+m3
+lea L11, r6
+L41: .string "eft"
+jsr L18
+m3
+m2
+prn #-246
+red *r6
+m3
+; comment
+prn L72
+not *r7
+m1
+L42: .string "gepxxnhwwkwxbu"
+mov #-30, *r7
+sub r5, *r1
+
+dec *r0
+
+jmp *r5
+clr *r7
+; comment
+L43: .data -173
+m3
+L44: .string "hfvzxosde"
+cmp r1, r3
+L45: lea L80, *r4
+bne L102
+m1
+prn *r3
+; comment
+L46: .data 923, 245, 253, -351, 26, -922
+add L97, *r4
+L47: not *r4
+lea L16, L104
+L48: .string "ydeuwrrqhvbembmwwoeuy"
+clr *r5
+inc L81
+; comment
+red *r1
+m1
+m1
+dec *r4
+cmp r7, r5
+L49: mov #97, r5
+cmp #131, #116
+L50: rts
+bne L29
+L51: .data 712, -488, 343, 916, -799, 876, -30
+L52: not L10
+L53: stop
+L54: .data 980, -810, 398, 213, -117, 48
+bne *r0
+
+lea L4, *r5
+
+add r4, r6
+L55: red *r6
+; comment
+m0
+sub r3, *r0
+stop
+jsr *r6
+m2
+not *r6
+m2
+
+L56: cmp #-144, L66
+stop
+cmp *r0, r1
+mov *r7, *r5
+dec r2
+m2
+L57: .data -668, -944, -968, -528
+L58: jsr *r2
+prn #237
+L59: mov #-64, *r4
+jmp L47
+bne *r6
+rts
+m1
+
+L60: .data 88, 910, -354, 540, 90
+lea L91, L30
+bne *r6
+prn L43
+inc L86
+inc L54
+L61: prn L24
+stop
+mov #-192, *r1
+m2
+L62: add *r7, *r2
+jmp L29
+sub L94, *r5
+red r3
+prn r6
+jmp L77
+m0
+not *r3
+red r7
+m3
+sub L78, *r0
+m4
+sub #159, *r7
+cmp #223, r1
+L63: .data -971, -243, 891, 557, -301
+mov r6, L60
+m3
+L64: .string "funifeemzvdlcrxkvxxkt"
+jsr L68
+L65: prn #-133
+clr r6
+sub L103, L47
+L66: .data 783, 864, -875, 982
+bne *r0
+mov r2, L70
+L67: prn r7
+m1
+L68: bne L59
+mov L28, L103
+inc *r4
+m0
+sub *r5, L87
+add #-153, r4
+m1
+; comment
+
+mov L58, r3
+L69: clr r6
+m4
+L70: prn *r4
+L71: red *r2
+clr *r7
+L72: sub *r3, *r6
+clr *r1
+m1
+m0
+stop
+red L56
+jsr L38
+L73: cmp *r0, L6
+L74: not r0
+m0
+add *r6, L38
+L75: clr r1
+sub L32, r7
+dec L18
+m0
+add #143, *r7
+stop
+bne *r4
+m0
+not L82
+m2
+prn *r3
+prn r0
+L76: .string "mxjqwanfwi"
+sub #-227, r0
+red *r5
+dec r0
+mov *r2, r0
+dec *r2
+m0
+lea L15, r2
+jsr *r4
+L77: .data 592, -925, 753, 661, 719
+rts
+L78: mov #244, L47
+
+L79: red *r4
+dec *r0
+sub L58, L112
+bne *r7
+m3
+red *r7
+rts
+L80: lea L73, *r0
+L81: rts
+sub r1, *r6
+m4
+cmp r1, r2
+not L108
+add *r1, r4
+L82: not *r1
+dec r3
+inc *r7
+L83: .string "jpsq"
+mov #232, r4
+not L97
+L84: rts
+not r4
+m3
+m0
+m4
+mov #226, r5
+jmp L95
+L85: .string "xyddhqngzwtclfm"
+lea L31, L72
+rts
+stop
+prn *r2
+L86: lea L9, L107
+m4
+stop
+sub #236, r2
+L87: .string "wkvuucjvpshbwxmro"
+rts
+jmp *r2
+L88: inc *r0
+L89: inc L109
+m4
+m1
+mov #-103, L17
+sub #128, *r7
+m0
+m4
+clr r7
+cmp L92, #55
+L90: sub *r2, L54
+m0
+prn *r0
+dec r7
+m4
+L91: cmp *r1, *r4
+red L96
+m0
+sub L6, L13
+jmp L97
+m3
+red *r7
+add #182, L79
+L92: rts
+not *r7
+prn *r0
+red r6
+L93: .string "bvxhbhobuwar"
+L94: lea L110, *r0
+jmp L101
+dec L66
+L95: .string "itlczujumixhaaojtqtmllr"
+rts
+dec L97
+m4
+not r5
+red *r2
+bne *r7
+L96: cmp #148, r4
+m4
+sub #-231, r1
+m1
+dec r6
+sub r1, *r3
+prn *r6
+jsr *r2
+clr *r6
+jsr *r7
+m0
+red *r5
+
+L97: jsr *r6
+red r3
+lea L75, r2
+L98: .data -923, -507, 926, 141, -397, 947, 941
+lea L41, *r6
+L99: .data -778, 383, 761, -516, -464, 398, -987, -564
+stop
+L100: .data -816, 993, 433, 159
+m1
+m2
+L101: .string "fgo"
+cmp #-226, #112
+mov r6, L54
+jmp *r5
+m0
+L102: .string "equaxcqzfin"
+L103: sub r1, *r6
+bne L56
+clr L110
+m2
+cmp #116, r4
+L104: prn L49
+m4
+add #148, *r5
+rts
+mov #-33, L58
+dec L106
+L105: prn *r4
+lea L110, L109
+L106: .string "hlyxxfzooicote"
+red *r5
+L107: .string "laotpjhgqiddgloxwmj"
+red L2
+bne *r2
+L108: red r1
+prn *r0
+L109: stop
+m2
+L110: dec *r2
+L111: inc *r1
+; comment
+prn L28
+stop
+L112: jmp L113
+m2
+lea L20, r3
+L113: red *r0
+prn *r5
+clr *r3
+lea L0, r1
+bne *r1
+bne *r3
+stop
@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 87
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    clr r2
+    prn #-220
+    not L41
+    add *r1, r0
+    bne *r4
+    jsr *r3
+    clr L48
+    jsr L20
+    rts
+    stop
+endmacr
+macr m1
+    bne *r7
+    mov L14, r4
+    lea L46, *r1
+    mov L61, *r4
+    not L95
+    clr L84
+    clr *r1
+    sub L110, L35
+    prn L30
+    lea L68, r0
+endmacr
+macr m2
+    dec *r1
+    dec r2
+    prn #-204
+    lea L54, *r0
+    not *r1
+    bne *r0
+    clr L116
+    clr r6
+    jmp *r0
+    clr r0
+endmacr
+macr m3
+    bne *r6
+    cmp *r6, r0
+    jmp L74
+    inc *r1
+    lea L82, L63
+    inc L2
+    bne L15
+    stop
+    prn L111
+    inc *r3
+endmacr
+macr m4
+    clr *r2
+    not r2
+    bne *r0
+    dec r1
+    sub *r7, L113
+    not *r1
+    cmp #-99, *r1
+    jmp *r4
+    prn #208
+    not L55
+endmacr
+red *r1
+m3
+add r2, *r5
+mov *r1, L59
+inc L53
+L0: .string "aszxafmxnrxdbkyycirj"
+sub #30, L20
+L1: rts
+
+L2: lea L87, L1
+L3: .string "ldtzgovhyevcqdrsccmcz"
+L4: sub L87, *r4
+L5: .data -989, 449, -413, 829, -354, 851, -921, 366
+jmp *r0
+lea L5, *r1
+
+m4
+m0
+inc L4
+dec *r1
+L6: inc *r6
+L7: not L19
+jsr *r5
+jsr L6
+stop
+stop
+clr r7
+stop
+prn r4
+bne L66
+jsr L4
+not *r2
+m3
+L8: red L6
+red L4
+add L6, *r7
+lea L8, r1
+m4
+L9: prn #111
+lea L45, r4
+; comment
+cmp *r0, *r6
+lea L7, *r6
+stop
+L10: stop
+L11: jsr L8
+L12: .string "hfuloz"
+L13: .string "dopishherao"
+L14: dec L62
+m3
+bne L60
+m0
+m2
+L15: .string "vmifamhjgelnlorhykz"
+red L38
+L16: .data 305, -476, -627, -927, -841
+dec r1
+clr L5
+lea L101, r0
+; comment
+not *r7
+prn r1
+cmp #241, r3
+cmp L69, #54
+m0
+; comment
+red L81
+jsr *r6
+inc L114
+m0
+L17: .data -727, -923, 425, -430, 287
+inc *r3
+mov *r6, L9
+m1
+jmp L12
+L18: stop
+bne L29
+L19: jmp L72
+L20: .data -798, -877, -326
+mov *r2, r6
+L21: mov #-17, *r5
+lea L70, L96
+cmp *r5, r4
+sub *r0, L0
+inc *r5
+m4
+L22: .string "yva"
+L23: .string "ukcfaaif"
+L24: mov #78, r2
+L25: dec r3
+m4
+m4
+stop
+jsr L15
+L26: inc r3
+L27: .string "zgucidoych"
+m2
+L28: dec L40
+jmp *r1
+clr r6
+dec *r0
+mov L19, *r4
+L29: .data 951, -861, -135, -819
+not L105
+stop
+lea L81, r3
+not *r4
+L30: .string "oxowicn"
+
+L31: stop
+not *r1
+bne *r4
+not *r6
+stop
+L32: prn *r6
+jsr L41
+not *r3
+L33: mov r2, r0
+add #-133, *r4
+L34: red L65
+L35: inc L7
+dec r7
+m3
+red L35
+bne *r7
+m2
+stop
+L36: clr r7
+m4
+L37: .data 815, 339, 446, 691, 729
+m2
+prn #81
+red L80
+m2
+m0
+bne L4
+L38: mov L35, *r4
+L39: inc r2
+L40: .data -560, -261, -365, 460, 799, -260, -378
+
+not L3
+L41: bne *r4
+stop
+red L10
+L42: dec *r6
+; comment
+L43: lea L15, L67
+; comment
+not L83
+L44: .string "wwlgwbcwaajxfpyabqvwf"
+L45: .data -561, -556, 416, 557, 995
+; comment
+L46: stop
+L47: .string "uq"
+cmp *r0, L112
+m0
+not L45
+m0
+m1
+stop
+jmp L87
+L48: bne *r2
+m3
+add r3, L17
+m1
+mov r0, *r3
+jsr L32
+; comment
+red r5
+L49: .string "fqbhtoe"
+L50: cmp L38, #208
+jmp L114
+L51: add r0, L66
+not L74
+L52: .string "ficwc"
+m1
+; comment
+; comment
+stop
+inc r1
+lea L99, r2
+red *r7
+dec *r5
+sub L101, L46
+clr *r0
+m0
+bne *r3
+mov r0, r6
+m4
+L53: clr *r5
+lea L98, *r3
+bne L118
+; comment
+inc r5
+L54: .string "kbci"
+rts
+red L40
+add #-113, *r1
+rts
+bne *r5
+mov *r5, r2
+; comment
+lea L2, L74
+lea L88, L77
+rts
+L55: not L98
+m2
+jsr *r0
+rts
+lea L2, L109
+jmp *r7
+rts
+sub #-47, r5
+rts
+prn r0
+L56: bne L84
+; comment
+m4
+m4
+dec r0
+m4
+prn r4
+L57: bne *r0
+m4
+bne L0
+L58: stop
+L59: .string "jidjm"
+dec *r5
+not L83
+rts
+cmp #158, *r4
+prn L46
+clr *r6
+stop
+L60: .data 692
+jsr L13
+m0
+prn L22
+lea L30, *r2
+L61: add L94, r3
+add #-197, L117
+prn *r5
+
+stop
+not L66
+sub #-98, *r0
+prn *r7
+m2
+mov L44, *r0
+m3
+clr L1
+mov #-85, L42
+not L60
+clr L78
+
+lea L33, r2
+jsr L18
+m4
+m1
+
+lea L96, L44
+m4
+m0
+m2
+red L111
+L62: add *r5, r0
+m0
+m0
+jmp L103
+L63: jmp *r5
+L64: dec L100
+L65: inc r2
+m0
+jsr L77
+prn #184
+L66: add *r4, L115
+L67: stop
+red *r3
+rts
+L68: not L56
+L69: .string "qigyjsijjstxfjzhmrllmfp"
+L70: not L107
+dec r6
+m2
+m3
+mov r0, r2
+clr *r4
+m0
+stop
+m1
+prn #-123
+not r1
+jsr L114
+L71: cmp *r2, L33
+m1
+m4
+
+add *r1, *r5
+; comment
+m3
+L72: jsr L31
+stop
+jsr L111
+m0
+
+add L86, L23
+dec *r5
+
+bne *r7
+inc L72
+; comment
+cmp L35, #40
+red *r1
+bne *r7
+m1
+L73: .string "cgvx"
+clr L63
+sub *r7, L80
+red r0
+L74: .string "rcsxolepjrpmtftiu"
+L75: .string "bomexnufqiwiivjcw"
+stop
+L76: rts
+L77: .string "bylfceoosnagwtklodm"
+L78: jsr *r0
+m1
+prn r3
+inc r7
+m2
+L79: .string "sferctm"
+lea L105, L61
+m2
+jsr L100
+m3
+lea L61, *r1
+mov *r7, r2
+L80: .string "aighmcxoo"
+cmp #134, L105
+lea L25, r2
+not *r3
+; comment
+m1
+rts
+m2
+m3
+m4
+bne L90
+; comment
+L81: .string "akgkqupyahucx"
+m1
+L82: jsr *r0
+L83: .data -210, -926, -991, 135, -465, -270, 678
+prn *r5
+prn r3
+inc r1
+clr *r7
+jmp *r2
+inc L70
+L84: .string "gusxvoaeuzpypxxwp"
+L85: stop
+cmp *r6, L74
+rts
+add #-4, L110
+L86: jmp *r2
+m0
+prn L91
+dec r2
+L87: .data 484, 826, 115, -935
+m4
+m1
+dec r1
+; comment
+stop
+L88: red r4
+L89: .data -41, -33, -718, 790, -290, 248, 510
+L90: .string "tqflydzn"
+m2
+bne L22
+L91: clr r3
+prn *r3
+L92: .string "kmmsmszkj"
+not L110
+; comment
+m0
+not r0
+
+inc L34
+lea L111, r3
+dec r3
+m3
+inc L64
+lea L7, *r5
+clr L117
+add *r0, r2
+add #-188, *r0
+m4
+jmp *r2
+red L115
+L93: .string "gvbsspuuibdtyras"
+L94: .string "rmfx"
+dec *r7
+L95: jsr L103
+L96: mov L66, *r5
+L97: .data -560, -948, 440, 266
+L98: .data -51, -878, -98, 504, -489, -939, 475, 300
+L99: clr *r0
+m4
+add #47, *r7
+m4
+red *r7
+stop
+cmp *r3, #-188
+prn r0
+L100: jsr *r5
+L101: cmp L71, L116
+m0
+L102: .string "berj"
+clr L67
+dec r6
+red L110
+lea L82, *r5
+clr L109
+L103: .string "nsyyhvjmewdjhywllmelfasx"
+bne *r5
+m1
+m4
+cmp #15, L113
+clr *r1
+red *r5
+sub L108, *r3
+red r1
+lea L104, r0
+dec r5
+mov r0, r5
+m0
+lea L84, L113
+dec L31
+bne L112
+sub *r2, r2
+lea L107, *r2
+L104: add #208, L43
+prn L94
+inc r7
+L105: .string "rifsmcfizhgjw"
+m4
+L106: .data 915, 22, -300, 271, 835, 523
+rts
+L107: bne *r7
+; comment
+L108: .data -254, -218, -263, 542, -649
+L109: .data 74
+jsr L116
+; comment
+mov L114, *r5
+L110: rts
+not *r2
+L111: rts
+L112: rts
+jsr *r4
+m3
+dec *r6
+lea L52, r3
+L113: lea L117, r1
+m1
+red L116
+dec *r1
+bne L93
+L114: jsr L47
+cmp r4, #53
+add L117, *r2
+L115: cmp r5, *r4
+dec *r5
+lea L33, r0
+m2
+inc r7
+L116: .string "lif"
+mov #-100, *r7
+bne *r6
+rts
+mov r3, r1
+add *r0, r6
+bne *r6
+m2
+jmp L118
+
+mov #-14, L66
+add L99, L97
+add *r6, *r6
+not *r2
+inc *r2
+L117: jmp *r5
+not *r7
+clr L67
+bne L118
+m3
+L118: jmp *r3
+jsr *r1
+rts
+rts
+
+stop
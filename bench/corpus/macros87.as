@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 88
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    jsr L40
+    mov *r2, r4
+    rts
+    lea L35, L43
+    inc L112
+    bne *r3
+    dec *r0
+    red r0
+    prn r7
+    prn #-85
+endmacr
+macr m1
+    red L48
+    cmp r7, #109
+    rts
+    rts
+    lea L65, r7
+    sub #56, L41
+    prn *r5
+    mov *r0, *r2
+    rts
+    stop
+endmacr
+macr m2
+    mov *r6, L0
+    bne L59
+    add #0, r5
+    clr L85
+    dec r5
+    prn #161
+    lea L79, L9
+    jsr L8
+    bne L93
+    sub #-195, L64
+endmacr
+macr m3
+    red *r3
+    cmp r6, L85
+    clr r4
+    clr r7
+    lea L81, *r3
+    not L35
+    clr r2
+    not *r6
+    red L100
+    red *r2
+endmacr
+macr m4
+    add r0, L48
+    jsr L105
+    not r0
+    jmp L10
+    bne *r2
+    dec r5
+    stop
+    not r0
+    rts
+    stop
+endmacr
+m0
+stop
+L0: cmp *r4, *r2
+m4
+red r7
+jmp *r2
+dec L0
+sub *r4, L0
+prn *r2
+dec L0
+sub *r7, L50
+sub L0, L1
+add #33, L26
+m3
+L1: .data 366, -562
+stop
+add *r0, L104
+cmp *r1, L1
+m0
+rts
+prn #-80
+prn r7
+; comment
+L2: .string "wnkkevxtyadxp"
+m3
+m0
+not L1
+m0
+add #-199, *r3
+add *r6, L67
+L3: add r2, *r1
+red *r2
+stop
+lea L81, L78
+jsr *r7
+; comment
+inc *r7
+jsr *r6
+clr L1
+lea L3, r2
+add L17, *r6
+red L72
+red L4
+L4: dec *r1
+L5: .string "mihqxrhisrlbtqznm"
+lea L100, L86
+L6: add L0, r2
+m3
+L7: sub L34, *r3
+L8: .string "veju"
+red *r4
+rts
+L9: .data -973, 702, 346
+L10: bne *r1
+jsr L21
+not *r6
+red r5
+L11: cmp L40, L99
+L12: .string "hbiz"
+m4
+inc L9
+L13: .data -100
+L14: sub r5, r7
+stop
+rts
+L15: .string "fwjofglm"
+jsr L3
+sub #86, *r2
+cmp #-92, #-65
+L16: .data 487, -770, 304
+lea L3, *r1
+m3
+bne *r4
+; comment
+L17: cmp #15, r1
+sub r0, r4
+L18: .data -578
+inc r5
+bne *r6
+jmp L11
+L19: jsr *r2
+stop
+L20: prn r3
+inc r5
+m0
+L21: .string "hhxinzu"
+; comment
+L22: .data 291
+not L11
+dec L107
+stop
+rts
+red r6
+bne L44
+rts
+L23: .string "cozcyksgumknpkhfmvztoryv"
+red r6
+m3
+L24: .string "kdmuyqeyjipldijbfbyua"
+lea L20, L23
+not *r6
+m2
+m3
+inc r5
+dec L112
+prn r4
+L25: prn L76
+not L23
+L26: clr r7
+prn *r4
+m3
+inc L85
+; comment
+stop
+cmp #148, #196
+m4
+dec r4
+L27: clr *r5
+m3
+m3
+stop
+m4
+rts
+; comment
+stop
+mov *r2, L29
+m2
+inc L0
+red L69
+red r3
+mov #228, L88
+lea L27, L113
+mov *r7, L59
+
+clr L14
+L28: prn r7
+m4
+mov L14, r4
+dec L5
+m0
+L29: dec r5
+L30: .string "fyevrrpvbghm"
+clr r4
+lea L19, L1
+L31: .data -257, -266, 96
+inc L16
+cmp L69, r7
+stop
+m1
+jsr *r0
+L32: .string "tqtrfmj"
+mov r3, r4
+add #-60, r3
+dec r1
+red *r5
+jmp *r7
+m0
+mov r3, r2
+clr L49
+not *r6
+lea L52, *r2
+rts
+lea L42, *r2
+sub #137, L109
+lea L31, L28
+L33: .data 746
+m2
+prn r5
+cmp L57, L39
+L34: inc L75
+sub #-171, L88
+m1
+jmp L25
+L35: add r5, *r5
+L36: .string "kitzlpcjy"
+lea L43, L11
+m1
+red L74
+m1
+mov r6, r2
+bne *r1
+; comment
+L37: .string "aajxmcmadkkmjiqji"
+m4
+cmp #212, L36
+prn r4
+clr L65
+bne *r4
+; comment
+jmp L79
+stop
+L38: .data 374, -40, -366, -959
+cmp L67, *r1
+L39: clr r5
+; comment
+inc L65
+L40: .data -862, -850, 708, -797
+; comment
+rts
+clr *r3
+not *r5
+bne L26
+prn *r4
+
+lea L10, r3
+m3
+add *r3, *r2
+L41: stop
+bne L105
+L42: add #8, *r0
+jmp *r6
+L43: inc *r0
+inc L41
+; comment
+stop
+bne L71
+dec L110
+L44: mov #113, L16
+dec L107
+L45: lea L109, r7
+lea L106, *r3
+
+bne *r0
+m1
+sub #-130, L101
+L46: inc *r1
+m2
+L47: .string "zujufgbnqnnywdvezgeeo"
+clr r6
+m1
+prn r2
+lea L57, r1
+L48: add *r6, r4
+stop
+mov *r7, *r2
+L49: sub L48, *r6
+add r1, L101
+L50: stop
+L51: .string "nympugibaeaonecceq"
+not L5
+L52: inc L94
+inc L46
+L53: clr *r7
+lea L47, r7
+m0
+L54: .data 547, 162
+add #135, r1
+jmp L90
+add r1, r2
+L55: .data -520, -668, 909, -468, 340, 511, -973
+dec *r0
+jsr L89
+sub r6, r5
+jmp *r0
+jsr *r1
+L56: jmp *r6
+lea L49, *r6
+add r4, r4
+
+dec r7
+dec *r7
+
+L57: bne *r7
+L58: .string "iua"
+rts
+rts
+dec r5
+red r5
+m2
+cmp L76, #169
+L59: bne *r3
+L60: .string "dclcnzivdhoyqdbrbcqxs"
+L61: jsr *r5
+clr *r5
+rts
+L62: cmp #134, *r4
+prn L25
+; comment
+m0
+L63: red *r6
+jmp *r4
+cmp L47, #235
+m1
+red *r6
+bne *r2
+L64: stop
+L65: .string "yzstf"
+m2
+L66: .data -585, -18, -153, -678, -608, -821, -403, 407
+jmp *r4
+prn r1
+not *r1
+sub r6, L82
+L67: .data -887, -452, -938, 195, 376, 152, -243
+jsr L94
+jmp *r5
+jsr *r4
+m3
+L68: jsr *r7
+clr L80
+rts
+clr *r7
+bne L30
+m4
+m2
+inc r7
+add r1, *r3
+clr L99
+clr r2
+m3
+jsr L52
+L69: jmp L33
+sub L51, *r4
+cmp r3, #112
+stop
+m2
+L70: add #-105, *r2
+stop
+L71: add #97, L34
+not r4
+dec r3
+
+L72: .data 183, -384, -999, -312, -311, -68, 420, 315
+m4
+red r5
+m1
+inc L27
+m1
+m3
+m2
+L73: .string "flhjjskash"
+jsr *r7
+cmp #175, *r6
+L74: .data 54, -19
+clr *r2
+mov *r7, *r3
+clr L89
+not L4
+cmp *r0, #148
+red *r5
+L75: .string "ubmdu"
+m2
+not *r5
+not L77
+L76: sub #24, L77
+add L66, L108
+m3
+L77: .data 720, -625, -433, 144, -606
+m2
+L78: jmp L112
+L79: mov r1, r4
+L80: stop
+L81: .data 332, 703, 468, 655
+add #108, L26
+m2
+jmp *r2
+L82: .string "npleosntv"
+add #205, L32
+L83: .data -942, 906
+clr r1
+lea L108, *r1
+sub r3, r4
+m3
+sub *r1, L36
+inc L106
+prn #72
+L84: lea L55, r4
+L85: .data -810, -15, -881
+rts
+inc *r5
+add r1, L110
+m4
+inc *r4
+cmp r4, r0
+prn #-18
+m0
+jsr L93
+m3
+; comment
+L86: stop
+; comment
+L87: dec L92
+rts
+L88: not *r2
+m0
+jmp L92
+L89: .data -167, -535, 308, 690, -78, -285, 311, 157
+red L110
+clr *r0
+inc r4
+L90: jsr *r0
+cmp L102, #153
+sub #180, *r4
+m4
+m3
+inc L101
+m1
+m4
+L91: dec *r3
+L92: .data -830, -810, -634, 614, -385, 834, -396, -205
+mov *r7, *r5
+red r7
+; comment
+L93: .string "xloszjmsp"
+sub #-122, r7
+cmp *r2, *r1
+m0
+L94: jmp *r1
+L95: .string "wixeaniinpcipkqnzui"
+red L102
+L96: inc L109
+jsr *r4
+L97: .data -686
+m0
+bne *r4
+m2
+L98: dec *r2
+sub #106, r4
+red *r1
+rts
+L99: .data 475, 376, -807, 584, 534, -732, -458, 151
+add #13, L84
+dec r0
+m1
+red r5
+L100: .data -351
+stop
+cmp L63, *r1
+red L112
+cmp L26, #-125
+inc r7
+stop
+m4
+cmp *r3, L57
+dec *r2
+m0
+L101: jmp L57
+L102: lea L113, r7
+m2
+not L18
+jmp L46
+lea L111, r1
+add #118, L19
+not L105
+jmp *r1
+m4
+lea L95, r4
+
+stop
+L103: mov #-149, r7
+lea L107, L113
+red r4
+L104: sub L32, r3
+m4
+m3
+L105: add L39, r1
+jsr *r5
+m0
+inc r6
+L106: .data -993, -612, 251, 218
+m0
+jsr L95
+clr L112
+lea L112, r2
+; comment
+m2
+L107: not L111
+jsr L108
+clr r3
+inc r7
+L108: not *r7
+cmp L98, #-256
+m1
+inc r0
+lea L50, *r5
+
+L109: prn #-52
+jsr L110
+cmp r1, L113
+add *r3, *r7
+m0
+L110: jsr L111
+mov r3, L94
+sub #27, L12
+rts
+stop
+L111: not L11
+m3
+jmp *r2
+m1
+inc L98
+bne *r7
+add #-124, L112
+rts
+mov r5, L94
+L112: sub *r2, r6
+lea L56, r7
+inc L23
+m3
+L113: .data -987, 437, 283, -562, -254, -210
+stop
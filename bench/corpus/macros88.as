@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 89
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    mov #-215, r0
+    cmp r4, L69
+    dec r7
+    red *r5
+    not r2
+    cmp *r2, *r0
+    cmp #-101, *r3
+    mov #-111, *r6
+    rts
+    stop
+endmacr
+macr m1
+    mov *r6, r2
+    sub *r0, L24
+    jmp L81
+    stop
+    bne *r6
+    add *r1, r5
+    jsr *r6
+    not r3
+    clr *r0
+    clr L92
+endmacr
+macr m2
+    jmp *r3
+    clr L59
+    rts
+    dec r6
+    cmp *r5, #70
+    lea L5, L57
+    jsr *r4
+    bne *r4
+    add #-11, *r5
+    bne L113
+endmacr
+macr m3
+    jsr *r7
+    dec L36
+    stop
+    rts
+    mov #-13, *r4
+    prn r4
+    prn *r7
+    lea L39, L10
+    jmp L99
+    inc *r5
+endmacr
+macr m4
+    sub r1, L47
+    jmp *r0
+    not L55
+    rts
+    jsr *r0
+    clr *r0
+    jsr L17
+    sub r4, r7
+    sub r4, *r2
+    add #-87, r6
+endmacr
+jmp *r6
+m4
+m0
+bne L104
+jsr L17
+; comment
+dec r2
+cmp L118, *r7
+sub L92, *r7
+clr *r1
+cmp *r2, #242
+prn L45
+m4
+L0: add #226, r5
+dec L0
+jsr *r7
+m4
+rts
+; comment
+add *r7, *r2
+dec L56
+m2
+m1
+dec L43
+rts
+; comment
+mov L24, *r7
+stop
+L1: clr r1
+jmp L1
+cmp #-199, L42
+dec L53
+m2
+mov *r5, r0
+clr *r6
+red L1
+L2: prn L0
+clr *r0
+L3: .data 278, 644, 709, 578, -153, 530
+red *r3
+red *r6
+L4: jsr L20
+clr *r0
+clr L2
+jsr *r6
+m1
+L5: stop
+m1
+jmp *r0
+rts
+m3
+m4
+not *r0
+
+L6: sub L99, r7
+red L87
+L7: inc L5
+lea L98, *r2
+m4
+cmp r7, *r1
+add L6, L31
+cmp #250, *r2
+jsr *r7
+inc L6
+
+jmp *r5
+not *r3
+red *r7
+; comment
+not *r6
+L8: stop
+clr r3
+clr *r2
+dec *r7
+
+red r7
+clr L3
+m3
+bne *r7
+L9: .data 838, 168, -834, 741
+clr *r0
+L10: .string "cnjetjvclij"
+
+; comment
+add L7, r5
+stop
+m2
+cmp L22, *r5
+L11: mov L10, L29
+L12: rts
+m1
+jsr L8
+L13: .data -435
+inc L110
+cmp *r5, L10
+L14: prn *r5
+mov r5, L96
+stop
+inc r5
+inc *r3
+stop
+m0
+stop
+lea L10, L62
+L15: inc L11
+add #-18, *r3
+L16: jmp *r0
+L17: .data 658, 586, 330, 267, -137
+prn #106
+not r4
+m4
+L18: .string "jeifahjvs"
+stop
+L19: .string "aclgnyd"
+L20: stop
+L21: .string "uusymjdtxqlzr"
+prn *r0
+stop
+L22: add *r4, L104
+red L75
+inc L8
+clr r0
+cmp *r7, r5
+L23: red r1
+L24: bne *r1
+mov r3, r4
+m1
+L25: sub *r4, L116
+L26: sub r4, r6
+red r7
+add r0, r0
+rts
+L27: add r1, *r3
+L28: .data 942, -353, 633, 905, -970, 165, 342, 5
+
+dec L5
+bne *r2
+L29: clr L75
+m1
+L30: .data 0, -738, 816, -486, -100, -441, -924
+red L33
+jsr L7
+L31: .data 179, 522, 484, -513, -687, 309, -743, 932
+m4
+inc *r5
+L32: .data -101, -893, -679, 712
+red *r0
+L33: cmp L25, L11
+inc r4
+sub *r7, *r5
+m2
+rts
+m1
+add r6, r5
+prn r1
+mov *r4, *r6
+mov *r2, *r2
+L34: .string "bvzr"
+L35: .data -524, -464, 49, 787, 272
+L36: prn r5
+clr L50
+add #86, *r5
+L37: bne *r2
+L38: .data -929, 881, -457, 228, -877, 168
+inc *r7
+rts
+lea L93, r5
+prn L112
+cmp L0, #65
+m4
+lea L75, *r0
+red r1
+add #33, r7
+L39: jsr L90
+; comment
+L40: stop
+not *r2
+stop
+L41: mov #-243, *r6
+stop
+stop
+stop
+sub *r3, *r2
+L42: .string "fhwkgbipzjetsohazewxyt"
+add #-102, *r7
+sub r1, L32
+; comment
+red L107
+jsr L65
+sub L14, r7
+L43: bne *r1
+prn *r3
+m2
+L44: .data -715, -223, -407, 931, -492, -799, -511, 247
+m1
+lea L90, L16
+m3
+jmp L67
+sub L40, r4
+m1
+L45: inc L16
+stop
+rts
+mov *r7, *r3
+m1
+L46: lea L5, L5
+lea L106, *r2
+m0
+L47: .string "kcd"
+cmp #-219, r4
+prn L114
+L48: .data 318, -703, -240, -543, 778
+mov #-103, r6
+L49: .data -553, -894
+jmp L10
+cmp L90, r7
+m3
+L50: rts
+L51: lea L36, *r5
+
+L52: .string "pljdtuxqowa"
+add r4, *r1
+m0
+prn r6
+m4
+prn *r7
+inc *r2
+m4
+inc r1
+inc L35
+jmp L102
+L53: .data 432, 980, -966, -997, -39, 656, -264
+prn L15
+jmp L3
+rts
+mov L25, *r2
+sub r7, *r2
+not r4
+L54: cmp L65, *r1
+
+L55: .data -217, 435, 200, 267, 243, -932
+dec L13
+m4
+m4
+rts
+stop
+L56: .data -925, -617, 987, -260, 995
+rts
+prn *r2
+inc r6
+add r5, r7
+L57: bne *r5
+jmp L59
+L58: .string "yh"
+m2
+L59: jmp L63
+lea L69, r2
+L60: add *r7, r6
+add L101, L99
+L61: rts
+L62: .data 805
+prn *r6
+cmp #-84, *r6
+m0
+m3
+mov *r2, L5
+; comment
+jmp *r6
+stop
+m2
+lea L118, *r0
+inc *r0
+lea L87, r4
+bne *r6
+jsr L110
+stop
+rts
+lea L118, *r0
+rts
+red *r5
+L63: .string "qytws"
+red r5
+jmp L50
+L64: clr r6
+dec r5
+
+L65: sub #95, L60
+dec L82
+clr r3
+add r1, r5
+cmp *r3, L72
+L66: .data -483, 606, -166, 138, -947, -177, 333, -104
+jsr *r7
+L67: .data 184, 748, -320, -106, -548, -895, 685
+mov L63, L12
+L68: .data -498, -91, -977, -928, -89, -891
+stop
+L69: .data 920, 270, -499, -419
+mov *r1, *r2
+m4
+L70: .string "sfbpmb"
+red r4
+L71: .data -908, -460, 455
+not *r3
+dec *r3
+jsr L39
+add L110, *r2
+L72: inc *r0
+rts
+m0
+clr L94
+jsr L94
+rts
+L73: lea L93, *r4
+add #138, *r7
+not r4
+bne L99
+L74: inc *r1
+jmp L106
+not *r7
+m0
+; comment
+bne *r1
+add *r0, r5
+L75: .data -385, 452, -14, -212, 488, -405
+jsr L81
+dec *r2
+L76: .string "rsrnnxixjcso"
+add *r0, L98
+L77: .data 318, -941, -690, -226, 104
+clr L115
+inc *r0
+L78: cmp r7, #50
+L79: .data -699, 111
+L80: .string "z"
+lea L71, *r0
+sub #-8, r2
+inc L53
+L81: .data -52
+add *r3, r7
+bne *r1
+add #233, L99
+dec *r1
+m4
+
+lea L110, *r7
+L82: bne *r7
+m2
+jsr *r0
+L83: mov #-202, r0
+L84: .data -826, -857
+red L52
+dec r5
+rts
+cmp L118, *r1
+
+L85: .data -193
+m2
+L86: .data 400
+m4
+L87: dec *r3
+mov L68, L121
+prn r2
+L88: jsr L108
+mov *r6, r0
+L89: bne *r5
+m4
+jsr L121
+
+L90: stop
+lea L44, L28
+m1
+m0
+not r2
+m3
+stop
+jsr *r2
+prn r4
+dec *r2
+L91: .data -530, 880, -12, 67, -913, -901, -825, -359
+jmp L76
+
+cmp L105, L108
+prn r2
+bne *r7
+mov #-122, r1
+L92: .string "pmwqs"
+m1
+not L12
+clr *r1
+not L53
+cmp *r4, #-129
+L93: lea L96, L95
+prn L0
+m2
+bne *r0
+prn *r7
+cmp #133, r7
+mov r6, L105
+not L38
+add #-25, r7
+dec L51
+mov #-57, L15
+L94: jsr *r3
+bne L23
+sub *r0, L118
+m1
+L95: .data -38, 845, 592
+cmp r0, L6
+L96: mov *r5, L101
+cmp r2, L100
+inc *r1
+L97: .data -835, 807, 288
+L98: lea L107, L111
+lea L60, *r6
+L99: .string "dnnxfhdegidyw"
+L100: cmp *r5, #-43
+L101: .data 686
+L102: clr r3
+L103: .string "ureczbzyk"
+red *r1
+mov *r3, L56
+red L112
+dec r5
+L104: rts
+
+; comment
+L105: clr r0
+cmp #-87, r1
+L106: bne *r0
+not *r5
+L107: .string "varacyejhadhjlusrwy"
+; comment
+bne *r3
+sub *r2, *r4
+L108: .string "geh"
+dec L73
+clr r7
+stop
+jmp L119
+cmp r4, L116
+inc *r2
+mov r5, r4
+dec *r1
+jmp L116
+cmp r5, #121
+jsr *r5
+L109: .string "msixsjzkadbvulkac"
+prn *r1
+lea L71, L113
+L110: rts
+L111: jsr L13
+cmp #79, r5
+bne L110
+L112: .string "kdgmmtttrxlqqupmodvywqya"
+m2
+mov L116, L115
+L113: stop
+bne L120
+cmp *r2, *r4
+L114: bne L116
+sub r5, r6
+m3
+inc r3
+prn r5
+m1
+L115: sub L27, r0
+L116: .string "jg"
+L117: dec *r5
+prn L121
+m3
+m0
+m2
+sub r2, L81
+jmp *r4
+m4
+m0
+L118: .data -607, -646, -161
+red L119
+L119: .data 911, 479, -535, -954, 49, 93, 992, 591
+sub r1, *r3
+add #224, L95
+m0
+stop
+not r3
+not L69
+red L120
+m2
+cmp *r2, L60
+L120: bne *r2
+clr L121
+L121: stop
+jsr *r7
+prn r0
+mov r4, L60
+jsr L23
+rts
+stop
+not L52
+m1
+stop
@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 90
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    lea L86, r0
+    bne *r3
+    not r0
+    inc L114
+    lea L59, L7
+    clr L71
+    jmp *r0
+    not *r7
+    mov r0, r0
+    not *r0
+endmacr
+macr m1
+    prn L96
+    dec *r6
+    mov *r4, r2
+    add L120, r5
+    cmp *r5, L98
+    not *r3
+    inc L63
+    stop
+    not r3
+    rts
+endmacr
+macr m2
+    bne L46
+    red L113
+    red r1
+    not *r4
+    lea L91, L24
+    red L35
+    add L40, *r2
+    jsr L4
+    stop
+    red *r2
+endmacr
+macr m3
+    cmp *r2, L54
+    dec L13
+    stop
+    dec *r0
+    add r0, r6
+    sub L21, *r3
+    red r0
+    add L93, r4
+    jmp L69
+    clr L111
+endmacr
+macr m4
+    cmp L113, L46
+    clr r6
+    add r1, L105
+    clr L101
+    bne *r4
+    jsr *r2
+    prn L97
+    rts
+    clr L42
+    inc L84
+endmacr
+dec *r6
+jsr *r6
+sub r3, L83
+m1
+cmp *r6, #-222
+
+L0: .data -735, -995, -847, -481, 798
+
+dec L103
+jmp *r6
+m0
+m2
+rts
+cmp #29, r6
+mov r5, r6
+m4
+mov L75, *r6
+L1: rts
+L2: .data -152, -952, 994, -42
+clr r2
+L3: jmp L117
+m4
+clr r5
+sub *r5, L2
+L4: not L40
+m1
+L5: sub *r0, r5
+L6: bne L5
+prn r6
+red r6
+m4
+L7: prn L120
+L8: jsr L93
+L9: .data -279, 985, -393, 563
+clr L67
+not L3
+mov #-210, *r7
+lea L8, *r5
+L10: .string "pvtvrfhxfhwnvudigloz"
+L11: .data -894
+cmp *r4, r1
+L12: rts
+L13: jsr *r2
+add L65, r2
+m2
+m1
+jsr L3
+mov *r3, L12
+L14: lea L111, *r1
+L15: .data 796, 845, 659, 308, 398
+prn #-148
+add *r6, L15
+m0
+red r0
+prn #-157
+m1
+lea L55, L39
+add #-140, r3
+jmp L52
+L16: .data 647, 299, 192, -12, -419, 664
+; comment
+L17: .string "jjutsbhafi"
+m4
+m4
+jmp L81
+m4
+red L116
+L18: rts
+; comment
+m1
+jmp *r4
+rts
+sub L17, r0
+sub r1, L1
+m0
+cmp #129, #-171
+add #32, *r0
+L19: mov r4, L113
+; comment
+L20: red r3
+jsr *r2
+stop
+not r7
+jmp *r5
+L21: jmp L12
+L22: rts
+L23: sub *r7, r0
+m0
+not *r0
+sub *r6, r2
+mov L11, L45
+dec *r0
+; comment
+m4
+prn *r0
+bne *r1
+jmp L118
+jmp L4
+m1
+stop
+m3
+clr *r5
+rts
+
+mov L104, *r4
+rts
+sub #26, L0
+rts
+L24: .string "jfltwfwzuhtgb"
+lea L22, L74
+dec L35
+clr r5
+L25: clr *r2
+lea L41, *r1
+stop
+L26: stop
+L27: clr L90
+jmp *r3
+L28: stop
+L29: .data -387, 614, -988, 349, -955
+clr *r3
+L30: sub *r2, *r3
+L31: .string "kzufyhxqxzmc"
+sub #-222, L73
+stop
+red *r3
+m3
+L32: add r6, L6
+rts
+L33: .data 205, -470, -930, 209, 989, 491
+add #-182, r4
+m3
+not L21
+cmp #-141, L32
+bne L70
+L34: dec L14
+m1
+L35: stop
+L36: stop
+stop
+m0
+
+L37: .data 675, -977
+L38: .string "qjpdsdqmmzoqid"
+jsr *r4
+L39: rts
+jsr *r3
+sub r0, L21
+lea L93, L101
+jmp *r5
+rts
+L40: not L66
+; comment
+red *r4
+L41: .data -380, -382, 74
+m3
+jsr L109
+jsr *r0
+m4
+; comment
+clr *r7
+L42: .data -709, -111, -738, 43, 929
+cmp r7, L33
+mov r1, *r7
+L43: .string "nlimrrg"
+L44: mov L23, L54
+m4
+sub r1, r4
+m0
+L45: .string "u"
+L46: .string "yuxvdokdikcxi"
+m2
+prn L18
+mov #-156, L97
+clr L95
+m3
+rts
+jmp *r1
+L47: red L28
+stop
+L48: prn *r0
+m0
+m2
+L49: .string "opsxwwjcxzkloqtzta"
+jsr *r5
+rts
+sub #-167, *r4
+sub L2, r1
+cmp #236, #-220
+L50: clr r4
+cmp L115, r7
+sub #-247, r5
+L51: .string "uf"
+L52: sub r3, *r4
+lea L57, *r5
+red r5
+stop
+cmp #-217, #-199
+clr *r6
+L53: .data 206, -661, 856, 94
+mov L95, *r7
+L54: mov *r3, L39
+stop
+m0
+prn r6
+lea L49, L46
+L55: dec L74
+L56: .string "sthujnse"
+m3
+jsr L121
+bne *r7
+L57: .string "fmtdvua"
+add #161, *r1
+red r4
+m1
+add #-254, *r7
+cmp r0, r0
+L58: add L60, *r6
+m3
+prn #215
+clr *r7
+L59: .string "vzzfkuixxmxjotuaxkeg"
+m4
+clr r6
+L60: rts
+L61: .data -3, -236, -452, 624, 216
+L62: mov L72, r6
+L63: red L39
+m3
+; comment
+cmp #-86, L28
+jmp *r0
+m3
+L64: .string "oeidcuybmbmgvldeaypzs"
+dec r2
+lea L3, L101
+bne L95
+not r4
+lea L35, r6
+add #170, L106
+; comment
+L65: .data 570, -876, 213, -866, -949, -563, -13, 448
+stop
+stop
+clr r7
+L66: .data -568
+L67: .data 24, -610, 802, -545, -662, 379, 16
+jsr L79
+inc L101
+prn #100
+m4
+stop
+jsr *r5
+L68: .data -733, 923, -105, -655
+bne L114
+jsr *r6
+mov r0, *r2
+L69: .data 154, -404, 900
+
+red r2
+L70: stop
+red L78
+inc *r5
+lea L118, L49
+m0
+inc L112
+L71: .data -176, -454, -659, 123, -286
+L72: .string "ruhkxroieqqhrzc"
+red L56
+L73: .data 993
+L74: clr L81
+cmp r7, L4
+dec *r2
+lea L89, r6
+
+clr L102
+L75: bne *r7
+dec L87
+L76: rts
+jsr L78
+L77: prn r1
+clr r2
+L78: sub #-57, L62
+L79: .data -197, 214
+L80: .string "bjtwhckojn"
+not *r7
+stop
+
+bne *r5
+m4
+m4
+L81: .data -96, -610
+L82: inc r3
+clr r0
+L83: dec r6
+m1
+m0
+rts
+L84: sub *r0, r6
+dec *r5
+cmp #-69, #-35
+; comment
+
+L85: inc L45
+m4
+jsr L97
+L86: .string "tiylcerrhnglazggcz"
+not r2
+L87: sub #146, L21
+m2
+clr r4
+mov r6, *r7
+m4
+m1
+lea L113, r0
+lea L104, r0
+jmp L114
+m4
+L88: .string "f"
+m3
+; comment
+red L18
+m4
+stop
+bne *r1
+L89: .data 831, 204, -606, 226, 200, 953, -674
+stop
+prn *r0
+cmp r4, #-146
+L90: .data -155, 666
+m3
+prn #-227
+rts
+; comment
+mov r4, r2
+prn #207
+lea L0, L48
+prn *r0
+; comment
+lea L103, r6
+; comment
+
+mov #103, r6
+m2
+cmp r6, #108
+inc r0
+; comment
+rts
+lea L95, L89
+cmp *r4, r1
+L91: jmp L34
+sub r0, r3
+; comment
+stop
+L92: .string "mdn"
+L93: .string "clukujdvwp"
+cmp L99, *r7
+dec L109
+m0
+m0
+m2
+rts
+lea L114, r3
+rts
+; comment
+red L119
+L94: .data -144, -328, -327, -810, -871, -231, 343
+cmp *r3, *r1
+dec r0
+stop
+not *r4
+bne L54
+; comment
+prn #170
+
+; comment
+
+stop
+L95: .data 224, -668
+L96: inc r6
+stop
+sub #113, L6
+inc L100
+jsr L105
+m0
+m0
+not *r4
+dec r1
+jsr L97
+clr r6
+jmp *r2
+clr L117
+stop
+cmp *r3, #-109
+m1
+clr *r3
+m0
+jmp *r3
+m3
+m3
+L97: cmp r1, #27
+m3
+stop
+m1
+inc r3
+lea L17, *r6
+inc *r4
+L98: red *r1
+m1
+m2
+m0
+add L104, *r2
+L99: .string "grqurntdlulrdmpybl"
+m1
+add r6, L100
+add #226, L121
+L100: clr *r6
+inc *r0
+L101: .data 168
+not L72
+red r5
+inc *r7
+jsr L110
+inc r3
+L102: .string "kluyd"
+sub #-195, r3
+L103: .string "cepcycycwuwthbsqujuzmvvt"
+sub *r5, r5
+dec r0
+m3
+; comment
+L104: clr *r2
+bne L106
+mov L57, r3
+m0
+; comment
+L105: jsr *r1
+L106: red *r4
+m4
+L107: cmp #-251, *r6
+L108: lea L9, r1
+m3
+L109: .data -397, 633
+jmp L5
+jmp L116
+bne L61
+m4
+L110: red L90
+; comment
+m4
+clr r1
+inc L74
+L111: not L46
+m1
+m3
+m1
+L112: cmp L120, #43
+L113: bne L117
+jmp L117
+m0
+m1
+L114: dec r7
+L115: red *r6
+inc L107
+stop
+bne L67
+m0
+m0
+jmp L121
+L116: .string "wk"
+sub #117, L118
+L117: .data -833, -605, -565
+dec r0
+mov #2, r7
+rts
+bne L119
+mov #-223, *r5
+sub L119, L9
+red L120
+jmp L120
+L118: .string "xmeqkogpdfatnejsos"
+red r4
+cmp *r7, L56
+red L96
+jmp L108
+rts
+jsr L1
+sub r5, r1
+red *r5
+add r1, *r1
+rts
+L119: rts
+; comment
+stop
+
+rts
+L120: .string "gblo"
+add #-193, *r3
+jmp L121
+L121: dec *r7
+stop
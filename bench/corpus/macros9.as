@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 10
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    stop
+    mov #34, *r4
+    red r7
+    inc r7
+    not L114
+    dec L15
+    dec L49
+    clr L114
+    sub L82, r4
+    cmp r4, r1
+endmacr
+macr m1
+    lea L63, L41
+    bne L6
+    cmp *r0, *r3
+    lea L87, r7
+    mov r5, r5
+    rts
+    add #99, *r5
+    rts
+    not r1
+    red L27
+endmacr
+macr m2
+    cmp L117, *r5
+    cmp *r5, r5
+    lea L64, r3
+    cmp *r0, L93
+    lea L57, r1
+    cmp *r5, #54
+    stop
+    sub #-52, L85
+    inc *r4
+    bne L56
+endmacr
+macr m3
+    stop
+    stop
+    sub *r2, L21
+    bne L59
+    prn L39
+    inc r1
+    stop
+    add L109, r1
+    rts
+    bne L9
+endmacr
+macr m4
+    sub #-99, *r5
+    red r3
+    lea L81, r0
+    prn *r5
+    sub #7, *r5
+    bne L81
+    not L9
+    not *r6
+    inc r3
+    jsr L4
+endmacr
+m4
+L0: inc L0
+dec r1
+L1: not L51
+L2: .data -883, -378, 497, -273
+dec r4
+m1
+dec r7
+m3
+inc r3
+prn L57
+prn *r7
+cmp *r6, r1
+not r5
+clr L1
+jmp *r5
+m1
+add r7, *r2
+not r4
+red r2
+dec *r3
+inc *r4
+m2
+L3: prn L54
+m0
+m4
+L4: red L12
+L5: inc L116
+L6: jmp L2
+inc *r6
+cmp #247, *r6
+sub r2, r6
+stop
+add L21, L4
+L7: red *r3
+inc L4
+L8: .string "kawqntvqytkcabja"
+L9: lea L5, r7
+m0
+L10: .data -770, 262
+L11: .data -922, 981, 196, -656, -668, -560, 558
+m0
+jmp L4
+not L5
+jsr L4
+add *r5, *r2
+L12: .data -139, 967, 892, -814, 475, -619, -562
+; comment
+jsr *r3
+m1
+L13: .string "xtbwuqaqn"
+add L7, L13
+
+L14: lea L22, *r3
+jsr L97
+red L63
+L15: prn *r7
+lea L6, L2
+dec r5
+inc *r4
+inc r5
+stop
+bne L11
+rts
+rts
+L16: .data 141, -875
+m1
+m0
+add *r1, L110
+inc L100
+not r7
+add L7, r5
+m1
+; comment
+prn L15
+m4
+L17: rts
+; comment
+jmp *r1
+L18: prn *r5
+L19: .string "nkymupzgbkccvhcxy"
+m2
+m0
+m3
+rts
+m0
+dec r5
+rts
+L20: not L25
+sub #-249, L20
+not r4
+m3
+not r1
+not L87
+m1
+prn L90
+L21: .string "uskutpizndiihtgnkroyaij"
+clr r3
+inc r6
+L22: add L39, r6
+m0
+rts
+
+L23: .string "awhvrjhlqgt"
+lea L99, *r5
+rts
+L24: .data 517
+red r2
+m1
+m0
+
+L25: dec *r5
+add r6, L9
+dec L13
+L26: jmp L3
+sub L46, r2
+jmp L57
+jmp L21
+inc r3
+red r4
+cmp #138, *r1
+sub L10, r0
+m1
+m0
+m2
+not L35
+clr L89
+L27: .string "vlrqzsivflkweieduns"
+sub #-216, r3
+bne L5
+not L21
+L28: jsr *r4
+not L3
+L29: .string "kyrwvguknzwzs"
+m0
+m4
+L30: add L68, *r7
+rts
+red L39
+stop
+clr *r6
+L31: .string "dvbamnslzafohwlmsxoq"
+mov L61, L31
+clr *r1
+
+jsr L24
+rts
+L32: jmp L47
+dec L99
+jsr L72
+L33: lea L38, r7
+L34: jmp *r7
+m4
+clr r0
+m2
+add #230, r3
+lea L19, L26
+inc L79
+m1
+clr L12
+not r5
+rts
+L35: .string "hptlnmduiu"
+prn *r7
+add #15, *r3
+jsr *r5
+red *r5
+
+L36: red r7
+m4
+lea L106, r2
+m0
+L37: not L27
+; comment
+mov *r4, *r3
+L38: not *r3
+L39: .data -515, -883, 228
+add #-231, L13
+jsr L55
+sub L26, r0
+rts
+L40: sub r0, L4
+L41: .data -385, -629, -477, 667, 695
+L42: .data 362, -621, 904
+lea L66, r7
+rts
+m1
+cmp L47, *r2
+m2
+m0
+bne *r0
+m4
+add r3, *r3
+jsr *r7
+m2
+inc r1
+dec L86
+mov L50, *r3
+m1
+L43: dec r3
+mov r7, r6
+add #189, L42
+L44: .data -208, -707, 891
+L45: stop
+m1
+jmp *r4
+
+L46: .string "aknqfpncb"
+
+m0
+stop
+cmp r0, r4
+sub L117, L12
+cmp L75, #-170
+jsr *r7
+L47: add L4, *r7
+L48: lea L51, *r2
+m4
+mov L18, L94
+lea L13, *r5
+L49: cmp r0, #-239
+rts
+add r1, L5
+m0
+L50: .data 577, -618, -241, 835
+jsr L31
+inc *r6
+L51: cmp L39, L28
+m0
+L52: .data -113, 817, 289, 327, -25, 714, -898, -998
+mov *r2, *r6
+prn #149
+jmp L52
+L53: rts
+L54: .data 496, 370, -740, -857, -185, 248, -650
+jmp L16
+L55: .data -476, 793, -126, 632, -34, -831, 654, -902
+prn r5
+m1
+L56: jmp *r1
+inc r1
+rts
+jmp *r5
+prn r2
+m3
+
+prn *r5
+stop
+add r7, L29
+L57: not r2
+m2
+m4
+mov *r4, *r6
+m1
+not r4
+L58: lea L49, L109
+m3
+L59: inc r4
+m1
+sub L81, *r3
+rts
+L60: red r7
+L61: rts
+mov r7, r0
+dec r4
+m1
+clr r3
+m0
+not *r0
+
+add #-56, r1
+add *r6, L39
+jmp L72
+add L70, L64
+L62: .data 906
+not *r5
+L63: stop
+m3
+; comment
+m4
+bne L78
+m0
+inc L7
+sub #-85, L84
+clr *r6
+
+lea L29, r3
+inc L78
+cmp #-143, L33
+L64: jsr L103
+L65: .data -232, -732
+lea L67, *r5
+L66: inc L113
+L67: cmp L68, #-11
+L68: lea L99, L84
+red *r3
+L69: prn L8
+lea L82, *r3
+m3
+inc L37
+stop
+mov r7, r7
+L70: add #14, L83
+bne L27
+L71: inc *r1
+L72: red r5
+; comment
+bne L79
+L73: .data -524, 667, 997, 380, 202, 138, -261
+not r3
+L74: not L51
+; comment
+m3
+mov #-158, *r6
+L75: not *r3
+cmp #-63, r5
+L76: .string "npyopiilbufczreaaec"
+m0
+
+L77: mov r1, *r4
+rts
+m4
+jmp L98
+L78: .data -89, 902, -346, -323, 727, -375, -496
+L79: not *r7
+L80: .string "kkgrpby"
+
+red r6
+m0
+cmp L89, #-62
+L81: add L103, r7
+clr L103
+not r3
+sub *r4, *r5
+L82: add r0, L35
+bne *r0
+jsr *r4
+dec *r3
+L83: .string "ujnlettofcrjupybmnylaoko"
+prn L116
+jmp L98
+dec L10
+L84: lea L30, L22
+stop
+jmp L95
+L85: inc L22
+red *r3
+m2
+cmp L107, L103
+cmp L59, r3
+not *r7
+jsr L12
+m0
+jmp *r4
+L86: .data 778, -681, -311
+L87: .data 798, 47
+L88: .data 344, -403
+bne L115
+L89: .data -189, -437
+cmp #-187, #13
+L90: .string "ir"
+clr r5
+L91: rts
+inc *r5
+sub #75, L105
+sub #77, r4
+prn r0
+m4
+L92: dec L107
+L93: .data 913, -872, -143, 480, 950
+bne *r2
+m4
+m2
+
+
+inc L103
+jsr *r6
+m2
+lea L114, L67
+m0
+stop
+L94: .data 322
+clr *r6
+lea L91, *r0
+L95: .string "gfzzybqfwcgvef"
+m3
+red r2
+L96: .string "jyqmgtkx"
+not *r6
+L97: lea L108, r3
+dec *r6
+m1
+m0
+m4
+jsr L5
+cmp r5, L80
+add *r5, *r7
+lea L114, *r2
+cmp *r0, #155
+m4
+stop
+
+prn L46
+stop
+L98: .data -754, -557
+L99: .data 508
+mov #-22, L66
+stop
+
+mov L106, *r3
+m0
+m2
+L100: rts
+dec *r1
+not r3
+sub L105, *r3
+L101: not r5
+prn *r2
+L102: inc L115
+m0
+m4
+inc L90
+bne *r2
+clr *r3
+mov r0, L15
+L103: rts
+lea L114, *r1
+dec r0
+add #60, r1
+clr L14
+cmp #23, r6
+dec *r5
+rts
+clr *r1
+L104: .string "ksewle"
+red *r6
+jmp L109
+stop
+add r3, L49
+
+inc r5
+red *r3
+add *r7, r7
+mov r6, L105
+jsr *r6
+dec r7
+stop
+L105: jsr L17
+L106: red L111
+m0
+m4
+inc *r0
+
+jmp *r3
+clr r3
+lea L25, r2
+bne L81
+bne L107
+L107: bne L28
+prn *r7
+L108: .string "tkejpqlnmrrvciv"
+red *r6
+cmp L79, r4
+red L80
+m2
+stop
+m1
+dec L66
+L109: cmp L34, L113
+m0
+red r6
+m2
+m0
+jsr L22
+mov r5, L1
+stop
+cmp #-92, *r2
+jsr L30
+add L114, r6
+L110: not r3
+m4
+rts
+stop
+m0
+
+L111: .string "himfmjumwqff"
+L112: jsr *r5
+rts
+L113: .data 343, 808, -410, -742
+sub L116, r3
+jsr L12
+L114: .data 30, 474
+L115: .string "lqmpqozq"
+L116: lea L117, L117
+m0
+red *r5
+m4
+clr L52
+sub r5, r1
+L117: prn L66
+stop
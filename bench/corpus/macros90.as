@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 91
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    stop
+    dec r6
+    not r0
+    rts
+    lea L28, *r2
+    stop
+    bne *r4
+    mov r0, *r5
+    clr *r0
+    jsr L33
+endmacr
+macr m1
+    add *r7, r4
+    cmp r7, #-250
+    stop
+    prn *r1
+    bne L110
+    mov #-27, L114
+    stop
+    rts
+    lea L93, *r4
+    jmp *r2
+endmacr
+macr m2
+    stop
+    jsr L81
+    bne L6
+    red r3
+    dec L86
+    stop
+    dec r1
+    add *r1, *r4
+    add *r4, r1
+    clr *r7
+endmacr
+macr m3
+    sub L100, L88
+    inc r2
+    stop
+    mov L9, *r4
+    lea L105, L49
+    not L53
+    rts
+    clr *r1
+    red *r1
+    add r5, r3
+endmacr
+macr m4
+    cmp #-67, r1
+    cmp #-68, *r4
+    rts
+    dec r5
+    clr L52
+    lea L28, L97
+    sub r2, *r4
+    not r6
+    jsr L69
+    bne L4
+endmacr
+inc r5
+
+stop
+prn r1
+mov #-177, L92
+jmp *r3
+L0: red r5
+L1: bne *r2
+L2: .data 610
+L3: .string "ytwvgfbebfktjtzblbwoi"
+m3
+red L42
+bne L0
+L4: bne L26
+cmp *r5, *r2
+L5: add #-249, *r1
+stop
+L6: .string "svenemkmxnabwlnh"
+prn L0
+sub *r3, *r7
+stop
+add *r2, r2
+bne *r4
+L7: .string "wsygrjopxawklfspegovsrz"
+
+L8: dec *r0
+prn #-244
+
+not r1
+
+; comment
+L9: .string "cihxgobtuwsdecpcnjz"
+lea L63, *r4
+dec *r1
+m0
+m0
+lea L7, *r7
+not L0
+red r2
+dec r7
+L10: .data 333, 491, 132
+cmp *r7, #-27
+mov *r0, L25
+m4
+inc r2
+rts
+jsr L68
+L11: cmp #-190, r1
+stop
+m0
+red r6
+cmp L8, L9
+m0
+m0
+not L4
+L12: .data 97, 658, -261, 852, 380, -960, 410, -76
+L13: prn L7
+m1
+sub r0, *r1
+m3
+stop
+add r4, r5
+inc *r5
+inc *r3
+rts
+L14: sub r7, *r4
+L15: .string "fifwvngkjdmexqroxepxmt"
+mov *r0, L8
+stop
+lea L98, L69
+dec L37
+L16: cmp #-179, L116
+dec *r3
+red L83
+m3
+stop
+m4
+prn *r5
+red r0
+L17: .data -20, -359
+mov #-122, r4
+mov r2, *r3
+; comment
+m4
+dec L15
+m4
+dec *r2
+red L84
+red *r1
+inc L35
+bne L5
+L18: not *r3
+jmp L111
+; comment
+jmp L55
+L19: cmp *r0, #-69
+
+red r1
+L20: .string "apstqxadiadn"
+rts
+m1
+L21: .string "vofisvzadrayk"
+prn *r0
+L22: .string "qrbg"
+L23: jsr *r3
+mov #243, r0
+bne L113
+L24: .data 736, 294, -825
+m2
+m2
+not r0
+m1
+stop
+rts
+L25: inc *r7
+L26: inc L26
+prn *r4
+red L44
+L27: red L19
+jsr *r3
+L28: sub L0, r2
+L29: .data 338, -962, 911
+lea L32, L113
+add #-93, r0
+m4
+dec L76
+lea L6, *r1
+L30: .data -858, 574, -661
+; comment
+L31: sub #-166, *r4
+
+mov #-48, *r0
+red r0
+mov *r5, *r0
+L32: prn r5
+L33: .string "jjzsvvnwnyzhtryhzdmf"
+m4
+m1
+stop
+dec *r4
+prn r1
+jsr L70
+add r5, *r7
+prn *r0
+add *r2, r7
+L34: prn #-147
+stop
+m0
+m4
+red r3
+L35: mov *r3, *r0
+mov L3, *r6
+mov *r2, L64
+m0
+m1
+m4
+inc L96
+bne L62
+m2
+L36: .string "nzismlpotaigmjxaxglafxol"
+L37: dec *r2
+lea L42, L98
+clr *r0
+rts
+bne L91
+stop
+clr r5
+; comment
+add *r2, r3
+not *r1
+cmp r0, *r5
+sub r1, r0
+m3
+rts
+m4
+cmp r0, #117
+mov r4, L55
+mov r3, r6
+inc L49
+add *r3, L19
+L38: cmp L64, *r2
+prn L32
+m1
+clr r5
+stop
+L39: add r4, *r1
+inc *r4
+rts
+jsr *r1
+m1
+m0
+L40: mov L32, L98
+red *r4
+sub r0, L115
+rts
+L41: .string "zrphsmcwzd"
+lea L17, *r0
+m2
+m2
+inc L91
+m2
+not *r4
+mov L41, *r1
+inc r2
+stop
+lea L75, r2
+prn *r5
+add L14, L67
+clr L30
+rts
+bne *r1
+red r5
+L42: add #-21, *r0
+bne *r3
+lea L54, *r1
+L43: dec r3
+m3
+not *r0
+red *r7
+L44: .data -431, 503, 659, 320, 786, -39
+add r7, *r2
+jsr *r4
+m4
+L45: rts
+stop
+bne L19
+m1
+m2
+jmp L2
+prn *r6
+bne L24
+m3
+L46: prn #168
+sub *r3, L104
+m0
+sub #-235, L98
+m0
+m4
+sub *r6, r7
+sub #-252, L32
+cmp #-185, *r2
+L47: .data 379, 707, -700, -305, 234
+
+cmp r0, *r4
+add #-242, r0
+L48: .string "cfpgznqzju"
+sub r6, L2
+L49: .data -510, 887, -311, 250, -918, -854, -38, -165
+
+rts
+inc L25
+cmp L24, L114
+red *r0
+L50: jsr L18
+jmp *r6
+m3
+m2
+rts
+L51: stop
+
+mov #-68, r5
+m0
+lea L81, *r5
+cmp r2, L52
+add #-149, *r1
+sub L13, r2
+jmp *r6
+L52: .data -322, -674, 80, 771, 780, -202, 516
+red L37
+rts
+prn L79
+m4
+clr L96
+bne L28
+L53: not r7
+; comment
+; comment
+; comment
+
+m4
+L54: cmp *r2, L70
+not L26
+mov r7, L51
+not r6
+inc *r1
+prn #-2
+L55: .string "ajwdufsqbmgduxybod"
+L56: .string "ksrlqkun"
+m3
+m3
+red r0
+jmp L29
+; comment
+inc L98
+mov *r0, L67
+jmp *r7
+jsr L112
+bne L112
+jsr L52
+red r4
+L57: .data 389, -274, -436
+sub L6, L32
+inc *r0
+L58: .data 90
+L59: .data 494, -907
+stop
+L60: .data 684, -96, -701, -579
+L61: .string "bvbaka"
+add r5, L101
+prn *r4
+add L106, L76
+m1
+m2
+L62: dec *r0
+L63: cmp *r4, #175
+stop
+stop
+clr *r6
+stop
+mov r3, L89
+dec *r4
+L64: rts
+L65: bne L58
+sub r3, r3
+; comment
+stop
+lea L109, r6
+m2
+red *r5
+L66: jmp *r0
+stop
+sub L52, r4
+m2
+m1
+inc r0
+dec L72
+lea L32, L98
+mov *r5, r7
+lea L6, L41
+L67: prn #2
+m3
+lea L76, L70
+red *r5
+m4
+L68: .string "fzcp"
+m2
+sub L92, *r5
+mov *r6, r4
+L69: .data -267
+L70: .string "mtmosmvqfcccofzkkftf"
+dec *r4
+m1
+
+L71: clr *r5
+jsr *r6
+L72: .data 196, -601, -331
+L73: clr L7
+m1
+cmp r0, #44
+m4
+L74: .string "czwmbfsnhzytmanbkj"
+dec r1
+L75: .data 802
+cmp #-243, L19
+cmp L66, #229
+L76: not *r6
+L77: .data 328, -473, 579, 313, 554, -519
+clr L43
+L78: .data -908, -108, 885
+L79: inc *r0
+m0
+bne *r0
+sub #-47, *r7
+L80: .data -975, 616
+inc *r5
+cmp *r4, L74
+L81: .data -891, -230
+jmp *r1
+cmp #110, L19
+red *r1
+
+bne L112
+inc *r6
+rts
+L82: .data 938, 565
+prn r3
+dec L52
+L83: dec *r2
+m2
+L84: .string "gfsdbejcs"
+L85: .string "pprl"
+stop
+add #-249, L97
+L86: .string "wjivniieupktmvawpqvrz"
+L87: .string "yhsvkhpyvgzcp"
+L88: jmp *r3
+L89: clr r2
+not L105
+L90: .data 788, 192, -504, -998, 312, 795, 80, 507
+L91: .string "kjyjlqfmnalzpdvloaefcpxe"
+m0
+cmp L102, L99
+cmp *r3, #17
+lea L99, L70
+red r4
+L92: .data -21, -152, 938
+stop
+m4
+L93: jsr L113
+bne *r7
+; comment
+L94: stop
+lea L100, *r3
+bne L39
+jsr L58
+dec r2
+m1
+red r1
+rts
+m4
+sub *r2, *r2
+red r2
+cmp *r7, *r6
+not r3
+cmp #46, *r5
+sub L62, *r7
+L95: .data 290, -136
+m3
+L96: .data -600, -203, 213
+not r2
+L97: lea L53, r5
+sub *r2, *r6
+inc L14
+L98: .data -11, 208, 131, 122, -553
+L99: red r2
+cmp #-62, L102
+jsr *r7
+rts
+rts
+inc *r6
+mov r5, L42
+L100: lea L109, L43
+L101: .data -727, 981, -344, 270
+m0
+add L44, L66
+L102: .string "uobxdvydpnrexmuo"
+inc L22
+prn r4
+sub *r7, *r1
+clr r5
+m4
+rts
+dec r1
+L103: jmp *r5
+rts
+not L14
+cmp #-161, #81
+add r4, *r3
+L104: prn #-130
+L105: inc *r2
+m3
+m4
+m4
+; comment
+clr r2
+inc r1
+rts
+
+m4
+L106: rts
+bne *r3
+lea L111, *r4
+m3
+sub *r0, *r2
+jsr *r3
+m2
+lea L32, *r1
+L107: prn L108
+m0
+
+L108: not L100
+stop
+clr *r7
+mov #28, L37
+lea L109, L13
+L109: .string "qnpepjr"
+jmp L75
+L110: cmp L96, L5
+cmp r4, r6
+rts
+L111: .data -479, 266, -187, 677, -13, 202
+clr *r3
+cmp *r7, #-186
+L112: .string "xdjbvvulovhmaojnw"
+L113: stop
+L114: jmp *r4
+dec r6
+jsr *r7
+L115: stop
+L116: .string "ijvevdcixdohloqvuykb"
+stop
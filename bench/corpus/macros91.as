@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 92
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    sub #-62, r6
+    inc r1
+    mov *r3, r6
+    sub #93, r7
+    jmp *r6
+    add #-92, *r0
+    prn *r3
+    dec *r3
+    lea L36, *r6
+    rts
+endmacr
+macr m1
+    jmp L6
+    cmp L67, #74
+    add L26, L33
+    bne L37
+    lea L100, L93
+    jsr L28
+    sub r1, *r3
+    jmp *r3
+    jmp L70
+    bne *r2
+endmacr
+macr m2
+    inc L80
+    not L65
+    bne *r1
+    jsr *r1
+    inc *r4
+    cmp *r5, L6
+    rts
+    jmp *r7
+    lea L111, *r4
+    red *r5
+endmacr
+macr m3
+    jmp L98
+    inc r4
+    red L31
+    lea L77, *r5
+    sub *r1, L66
+    stop
+    mov r1, L72
+    dec L86
+    mov r1, L51
+    rts
+endmacr
+macr m4
+    jmp *r7
+    add #37, L39
+    cmp #135, *r3
+    lea L75, L79
+    add *r7, L8
+    jmp *r2
+    jmp L80
+    sub r2, *r0
+    red r6
+    dec r3
+endmacr
+mov #19, r5
+clr r0
+L0: dec r0
+stop
+inc L0
+sub L101, *r3
+L1: not *r1
+m0
+m1
+sub *r2, L65
+prn #154
+bne *r6
+dec *r3
+
+clr L1
+m4
+inc *r3
+m2
+rts
+m0
+L2: jmp L36
+clr *r1
+jsr L96
+sub *r3, r3
+; comment
+cmp L110, L87
+m1
+mov *r3, *r5
+m2
+L3: lea L2, *r3
+jsr *r2
+L4: inc *r0
+m0
+m4
+sub L1, r1
+m3
+add L14, L1
+add L66, *r3
+m2
+add r3, *r3
+bne L5
+L5: prn r3
+m1
+L6: rts
+sub *r2, *r3
+sub L109, *r6
+inc *r6
+L7: .data 869, -464, -959, 550, 229, -89, 859, 758
+add *r0, L15
+L8: .string "tkzskbkuouihdhep"
+
+add *r6, *r4
+L9: lea L7, *r3
+L10: .string "myuygxoororifkkkzkniab"
+jmp *r2
+red L64
+m0
+jsr *r2
+jsr *r7
+L11: .data 681, 475, -385, -582, 129, -500
+jmp *r5
+stop
+clr *r0
+; comment
+L12: cmp L11, r7
+; comment
+stop
+bne *r4
+sub r6, *r6
+prn r1
+; comment
+jsr *r4
+L13: clr r6
+prn *r3
+sub r0, L7
+; comment
+jmp L0
+sub L108, r2
+m2
+L14: .data 408, -134, -569, 341, -789, 364, -750
+lea L42, L95
+m4
+lea L32, *r4
+jmp *r5
+rts
+add r0, *r4
+dec L5
+L15: cmp r4, r6
+L16: lea L2, r0
+L17: mov L2, r5
+lea L17, L30
+L18: .string "ikhbgovgjlwgerpivsfpurg"
+L19: inc r4
+mov *r3, L70
+add #62, r6
+rts
+prn r3
+add L101, L19
+L20: clr *r5
+m0
+clr L4
+sub L13, *r0
+jsr L3
+cmp #116, #145
+lea L12, *r4
+dec r2
+L21: bne L32
+L22: prn #-49
+inc r4
+mov *r4, r3
+m4
+dec L90
+sub *r7, r4
+L23: .data -465
+dec L19
+L24: sub #229, *r5
+sub #182, L10
+not *r0
+jmp *r3
+clr r0
+L25: not r4
+; comment
+L26: .string "rsb"
+sub r3, *r3
+L27: .data 626, -427, -259, -491, -903, 714, 179
+L28: lea L32, *r1
+prn #-126
+m2
+lea L86, L56
+L29: add #112, r5
+L30: lea L6, *r4
+red L14
+cmp r0, *r4
+jmp L16
+lea L106, r5
+m4
+L31: .string "rqvwsasiobsvh"
+; comment
+L32: .string "ecvxesdqrdo"
+jsr *r5
+
+m3
+mov L84, *r3
+prn r1
+prn *r6
+L33: jmp *r2
+clr *r1
+m4
+lea L12, *r1
+sub L95, L19
+m3
+L34: sub #-64, r1
+clr r0
+clr r5
+m4
+L35: lea L61, r6
+clr r4
+m1
+bne *r2
+prn *r6
+m3
+L36: bne L99
+prn r6
+; comment
+sub L84, *r4
+L37: .string "zmehthwlfjj"
+
+m1
+jsr *r4
+rts
+m2
+add *r7, r4
+dec r3
+; comment
+; comment
+L38: rts
+stop
+sub L82, r3
+L39: .data 875, 4, 317, -296, -701, 187, 505
+m1
+L40: stop
+stop
+L41: rts
+cmp L69, L2
+inc r2
+L42: not r3
+stop
+prn *r7
+red r5
+L43: rts
+clr *r4
+rts
+m1
+m3
+dec r3
+stop
+m2
+m0
+m0
+bne L11
+mov L14, r3
+mov #69, L25
+not L93
+dec r3
+L44: inc L101
+m0
+L45: .string "ahtqiobcspxjdufefusmc"
+m2
+sub r2, L67
+m3
+rts
+m0
+rts
+m4
+m0
+L46: clr *r7
+m0
+lea L39, r4
+m3
+m4
+jsr L107
+inc r3
+mov #121, L31
+m2
+L47: stop
+L48: cmp *r5, r2
+stop
+inc r2
+L49: cmp L6, *r3
+add #109, L97
+m1
+lea L0, *r2
+bne *r7
+bne L11
+jsr *r5
+m0
+jmp L67
+red *r4
+
+dec L75
+inc *r6
+L50: not r2
+
+mov L79, L10
+L51: .string "psmgnypc"
+red *r5
+stop
+m2
+L52: sub r5, r3
+mov *r1, L108
+jsr L64
+lea L93, L5
+m2
+L53: .data -763, -428, -38, 576, 739, -805, -281
+jsr *r4
+jmp *r6
+add L87, r4
+stop
+stop
+bne *r2
+rts
+lea L48, r4
+sub r3, L30
+bne L37
+bne *r1
+m1
+L54: stop
+L55: clr r0
+stop
+m3
+L56: .data -4, 47, -438
+m0
+inc L65
+stop
+jmp *r6
+m2
+L57: cmp L77, r1
+L58: add r4, *r0
+L59: not r7
+jsr *r0
+not r1
+not L38
+m0
+sub *r4, r6
+jsr L14
+cmp r6, *r4
+not L54
+red *r1
+mov #-156, L43
+L60: rts
+prn *r4
+; comment
+add #83, *r4
+L61: .data 385, -830, -914
+jsr L73
+stop
+dec L103
+sub L18, L4
+mov r4, r4
+m1
+m0
+m3
+; comment
+lea L80, *r1
+jmp L7
+prn *r2
+add #168, *r7
+m2
+inc *r1
+m0
+m0
+not L77
+add L108, r6
+L62: .string "vlaqxskfpc"
+L63: jsr L85
+jsr *r0
+bne L99
+L64: .data 728, -450, -25, 350, -696, -149, 794
+rts
+L65: stop
+inc r7
+not L70
+L66: .string "gubljuvpd"
+prn #152
+; comment
+m3
+mov #211, L49
+L67: .string "vkwlhgik"
+red r7
+L68: add L55, r4
+L69: mov L96, L45
+L70: .string "e"
+m1
+m0
+dec r6
+m3
+m2
+cmp #-3, L92
+L71: stop
+jmp L109
+add #-201, r5
+L72: .string "ubywsuyjrxg"
+lea L86, L63
+L73: .string "xpqmqpnk"
+
+red *r1
+L74: jsr L44
+clr L77
+dec L60
+clr *r4
+clr *r2
+rts
+clr L75
+L75: mov r7, r5
+prn #-117
+add L102, *r4
+stop
+jmp *r3
+m0
+L76: .string "ysmitv"
+bne L37
+jmp *r3
+lea L57, r0
+red *r5
+L77: dec L1
+L78: .string "xrxejormzygxtuufnpuowbn"
+red *r5
+; comment
+stop
+L79: red *r7
+m3
+L80: red r6
+lea L104, r7
+L81: .string "xpfgncajn"
+dec r5
+inc *r4
+jsr *r0
+L82: bne L2
+add #-84, L46
+m0
+red r2
+stop
+L83: dec r2
+prn r2
+prn r2
+L84: bne *r7
+L85: clr L38
+m1
+mov #-129, L0
+jsr L66
+red *r1
+sub #-197, r4
+L86: not L94
+stop
+prn *r1
+m3
+jsr *r5
+L87: .string "fvnw"
+clr L98
+L88: not *r4
+jmp *r7
+L89: .data 217, 609, -531, -66, -567, 652, -745, 730
+m3
+jmp *r1
+m0
+L90: .string "gtmcefnqrzgazjl"
+mov r1, r2
+m3
+sub #-47, L105
+cmp #-233, L44
+mov L23, r6
+L91: .string "vqodbotugcpnhccgt"
+inc r5
+m2
+m0
+prn L92
+
+stop
+add #38, L110
+
+rts
+lea L33, r0
+mov L40, *r3
+L92: red r4
+L93: rts
+bne L103
+rts
+bne *r0
+bne L95
+jmp *r0
+rts
+jsr *r0
+m2
+m0
+L94: .data 875, -554, -915, -645, 740
+L95: jsr *r1
+bne L78
+red L72
+L96: mov *r7, *r5
+lea L31, *r4
+rts
+L97: mov r3, L103
+dec *r2
+m1
+; comment
+L98: bne *r2
+L99: .string "nabyt"
+L100: bne L105
+rts
+mov L24, r7
+m1
+red *r2
+m2
+stop
+m2
+stop
+red *r5
+add *r0, L4
+not r2
+L101: jsr *r2
+lea L46, r7
+dec L104
+sub *r2, *r4
+; comment
+not L36
+clr L109
+L102: .string "tebppzgcsfomnlv"
+jmp L14
+lea L110, L106
+dec r3
+add *r4, L111
+m0
+bne *r3
+red L106
+add L109, L108
+m4
+; comment
+sub #-77, r0
+cmp r3, L67
+L103: inc *r6
+m1
+L104: .data 986, -271, 810, 119, -822, 196, -333
+sub #-150, *r2
+cmp L106, r1
+; comment
+L105: stop
+L106: dec L36
+m3
+not *r4
+L107: stop
+m2
+L108: .data -158, -217, -536, -257, 459, -812, 880, 651
+cmp r7, #-186
+L109: .data -627, 356
+L110: .data -28, 437
+jmp L58
+; comment
+prn #-198
+L111: .string "dmznb"
+red L17
+stop
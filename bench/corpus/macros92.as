@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 93
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    clr *r7
+    inc *r0
+    prn #1
+    stop
+    jmp *r1
+    lea L43, r2
+    inc *r5
+    clr *r2
+    inc L47
+    jsr *r1
+endmacr
+macr m1
+    lea L24, L28
+    prn *r6
+    mov L45, *r7
+    jsr *r5
+    add #198, *r2
+    stop
+    sub L92, r5
+    jsr L23
+    mov r2, *r7
+    stop
+endmacr
+macr m2
+    clr r0
+    dec L48
+    sub r3, *r3
+    stop
+    not *r3
+    cmp r6, r1
+    bne *r6
+    clr L35
+    mov #198, r0
+    not *r4
+endmacr
+macr m3
+    stop
+    not L20
+    red r2
+    rts
+    mov L103, r2
+    dec r2
+    rts
+    stop
+    stop
+    sub r1, r4
+endmacr
+macr m4
+    dec *r0
+    rts
+    rts
+    stop
+    cmp r7, L13
+    cmp #116, L67
+    sub *r1, r4
+    jmp *r5
+    not L51
+    bne L28
+endmacr
+m2
+prn L34
+mov L22, r5
+L0: .data 494, 34, 412, 878, 235, -734, 533
+cmp #-79, *r7
+
+m0
+red L91
+cmp #-2, *r1
+L1: .string "pgblcyuskwqyzgter"
+dec *r2
+lea L0, r4
+L2: .data -999, -808, 104, -177
+L3: rts
+cmp r6, #85
+m0
+m1
+m4
+inc *r6
+L4: .string "vfnifefvbo"
+prn r3
+
+jsr *r6
+bne *r3
+not L89
+sub *r2, L0
+m4
+mov r1, L1
+L5: red L97
+add L46, r7
+m2
+L6: .string "nfoelzmxtimychq"
+; comment
+lea L0, r0
+m1
+cmp *r5, *r1
+not L3
+L7: prn #188
+jmp L3
+; comment
+m3
+m2
+m3
+m0
+L8: dec *r2
+red r0
+L9: dec *r6
+L10: .string "bcmfprxayhvtmg"
+red *r1
+sub r4, *r7
+L11: red r1
+bne L26
+L12: rts
+L13: .string "gezbwhqjeqbcz"
+not *r0
+mov #223, r0
+sub L41, *r0
+L14: prn #-47
+rts
+not L4
+L15: .string "uycvojtlymdnq"
+L16: rts
+mov r4, r6
+L17: stop
+rts
+red L73
+m4
+m4
+rts
+jmp L6
+bne L13
+jmp L14
+L18: .string "uesriiooffsjsk"
+red r6
+clr *r5
+m4
+sub L1, r2
+m0
+rts
+L19: prn *r1
+clr L4
+L20: .string "hlwodheqalylpttvk"
+jmp *r6
+; comment
+not L20
+red r0
+; comment
+bne *r2
+L21: .data 333, 179, 178, 405, -599, 202, 120, -398
+m3
+; comment
+jmp *r4
+m4
+clr r0
+L22: prn r4
+L23: jmp *r5
+L24: .string "na"
+bne *r3
+dec L86
+cmp r3, *r3
+
+not r4
+red r6
+L25: clr r5
+L26: add #-85, r1
+L27: add #-255, L35
+prn r7
+L28: dec L16
+m3
+mov r0, L15
+add #-65, L15
+cmp *r4, L1
+L29: jsr *r3
+rts
+rts
+; comment
+prn L0
+L30: cmp r2, *r2
+rts
+red *r1
+sub L70, L5
+m4
+cmp r3, *r2
+cmp *r5, *r6
+mov #158, *r4
+jmp L12
+add #103, r4
+rts
+lea L6, r7
+L31: .data 862, 990, 201, -222
+lea L10, r2
+L32: .string "afhoaypgz"
+L33: .data -355, -8, -139, -104, 699, -270, -84
+L34: bne L26
+m1
+jmp L31
+L35: .string "jaocpdcev"
+m1
+red r3
+jsr L35
+
+not L65
+prn r5
+dec *r3
+L36: rts
+m4
+m4
+clr L70
+cmp #73, *r4
+inc *r4
+m3
+add *r1, r0
+jsr *r7
+sub #64, r5
+lea L32, r7
+m4
+bne L41
+stop
+inc L70
+L37: lea L24, L32
+L38: .string "bgvxyeaba"
+bne L32
+mov *r7, *r1
+not L30
+L39: add r4, L45
+not *r4
+rts
+m3
+L40: stop
+L41: .string "pw"
+mov *r0, *r3
+mov *r4, *r6
+m1
+cmp #-163, L102
+prn r5
+add *r5, r1
+L42: .string "fvciphkuqtdawgzhwnjspq"
+sub #219, r0
+sub r3, L54
+mov L107, *r1
+stop
+red L104
+stop
+prn #78
+rts
+lea L91, r4
+clr r3
+mov L5, r7
+L43: prn *r2
+jsr L22
+L44: prn #-140
+add *r2, r7
+L45: .string "rlbbpfvvwieqbevvc"
+m4
+lea L90, *r7
+cmp *r3, L24
+add r6, *r2
+clr r6
+
+mov r4, *r3
+add L88, L1
+sub L10, r3
+m0
+m3
+red *r4
+jsr *r2
+L46: cmp L33, #-63
+rts
+L47: bne L8
+dec *r4
+L48: .string "jrpfrdnmnoyypigcpe"
+inc L2
+m2
+inc L34
+prn r3
+stop
+clr L24
+inc r7
+mov #-146, L50
+rts
+jmp *r4
+lea L29, *r4
+clr L18
+rts
+cmp *r1, r6
+m3
+clr L39
+cmp #62, *r5
+stop
+m1
+red L19
+m1
+L49: .string "xkltxyg"
+clr r4
+; comment
+L50: lea L11, L51
+jmp *r1
+L51: .string "q"
+red *r2
+L52: prn *r1
+dec L86
+red L101
+lea L70, *r7
+not r1
+not r5
+m3
+m1
+sub r7, *r6
+m4
+m4
+stop
+jsr L54
+L53: .data -400, 649, 572
+cmp L78, r0
+rts
+jmp L71
+; comment
+m2
+add L35, L54
+prn r4
+add r5, r5
+jsr L39
+stop
+add L92, L73
+; comment
+lea L68, *r3
+prn L54
+inc r4
+sub L1, *r2
+m4
+rts
+inc L48
+inc L92
+jmp L20
+; comment
+L54: add r4, r0
+m3
+sub L76, L97
+add r5, r4
+L55: .string "otuzqmgmdbrpn"
+clr r1
+rts
+
+bne L96
+jmp L1
+m0
+L56: .data 396, 23, 114, 316, 46, -609, -814, 58
+inc r7
+L57: .data -181, -894, -401, 554
+L58: dec r5
+bne *r6
+stop
+mov r1, r4
+bne L57
+L59: add L62, *r5
+m1
+m1
+cmp #-97, r2
+m0
+m3
+clr *r7
+L60: .data 271, -361, 768
+jmp L72
+L61: not *r7
+; comment
+; comment
+
+L62: dec L59
+add L39, L66
+jsr L107
+jmp L39
+mov #-70, L2
+m3
+dec L14
+L63: .string "e"
+m1
+clr r3
+m3
+L64: .string "sezlfufez"
+stop
+cmp #248, *r5
+inc r4
+lea L27, L14
+lea L1, *r4
+inc *r4
+L65: jmp L20
+L66: .string "gftazol"
+L67: inc L107
+L68: .data -996, 316, 909, 282, -759, 495, -878
+cmp #67, *r1
+m4
+inc r4
+m4
+dec *r5
+L69: .string "tbltcgxefuldsdvkrw"
+not L84
+L70: .string "ih"
+clr L81
+sub L36, L94
+m0
+clr L82
+m2
+L71: clr r7
+bne L47
+m0
+L72: .data -644, -970, 493, -374, 339, 657, 423, -850
+mov #112, *r5
+L73: rts
+m2
+add #31, r1
+bne *r5
+m1
+rts
+L74: .data 863, -592, 187, 505, -438, 916
+jmp *r6
+jsr *r2
+L75: .string "wltxi"
+m1
+add r1, L17
+rts
+add r6, L77
+stop
+jsr L57
+stop
+L76: .string "exbv"
+cmp r2, *r3
+jmp L16
+L77: not L23
+dec r2
+m3
+m3
+m1
+jmp L95
+L78: stop
+m1
+add L96, L17
+m0
+bne *r2
+prn L82
+m1
+L79: add *r4, r6
+m0
+jmp *r4
+L80: .string "kxtvclrzvptajhzoqvs"
+not L56
+not L31
+inc L93
+rts
+not r3
+m1
+mov *r2, r5
+m0
+sub r5, L101
+m0
+mov *r1, *r0
+L81: .data -401, -121, -420, 552
+L82: add #-172, *r7
+prn #255
+L83: .data 812, 718, -421, -910, -379, 133, -452, 211
+L84: .data -216, 536, 216, -758, -889, 609, -732, -70
+L85: dec r3
+prn *r6
+prn L50
+m0
+cmp L82, r3
+L86: mov #-41, r3
+m2
+m2
+m1
+dec L63
+stop
+add #-131, r2
+dec L100
+L87: .string "kdmzsb"
+jmp L102
+L88: jmp *r3
+stop
+bne *r0
+L89: add L108, r7
+m0
+dec L92
+bne *r6
+sub *r4, *r2
+not L70
+jmp *r0
+L90: not L90
+mov *r5, r4
+sub L55, L108
+sub r1, *r5
+bne L103
+dec r0
+jsr *r5
+jmp *r3
+inc *r0
+L91: stop
+mov r0, r4
+L92: rts
+
+bne *r3
+m0
+; comment
+dec L96
+L93: lea L17, r1
+lea L7, r2
+; comment
+m4
+L94: .string "yiottcsakzos"
+stop
+dec *r0
+m2
+prn *r3
+red r7
+m1
+jmp *r2
+m0
+L95: .data -311, -914, 100, 189, -60
+L96: rts
+sub *r6, *r2
+stop
+L97: dec L9
+m2
+L98: .data 962, -9, -611, 872, -364, -730, 106
+red L93
+stop
+not L3
+add r7, *r3
+L99: mov r7, L103
+dec *r0
+m3
+L100: jsr L102
+sub L91, L47
+lea L101, L88
+cmp #-160, r7
+rts
+jsr *r3
+clr *r2
+sub *r2, *r5
+L101: .string "lufpbnttzwwmuuupvhcf"
+m0
+L102: .string "mdrcvwkjwuonxmdg"
+cmp L103, r5
+sub #220, *r4
+sub #15, L105
+rts
+L103: jsr *r6
+inc r4
+L104: .data 117
+rts
+L105: .data 100, 442, 59
+L106: prn *r0
+L107: add L55, L28
+not *r3
+prn L108
+L108: dec r3
+L109: .data 374, -305, 527, -840, -187
+inc r3
+add *r0, *r0
+mov r7, r3
+dec r1
+L110: lea L88, L22
+stop
@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 94
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    inc r0
+    lea L68, *r0
+    stop
+    jsr *r7
+    not r3
+    red L24
+    inc L45
+    prn #-61
+    cmp *r0, L94
+    jmp L65
+endmacr
+macr m1
+    mov r6, L64
+    add r4, L10
+    jmp L67
+    clr *r6
+    sub r0, *r5
+    not *r5
+    prn r3
+    lea L35, *r7
+    red *r0
+    lea L69, L49
+endmacr
+macr m2
+    rts
+    rts
+    red L68
+    prn #-89
+    bne L71
+    red r5
+    add r0, *r6
+    lea L70, L82
+    stop
+    red *r6
+endmacr
+macr m3
+    rts
+    bne L49
+    prn r0
+    bne L25
+    dec L28
+    clr *r2
+    inc *r4
+    bne *r0
+    red r7
+    jmp *r3
+endmacr
+macr m4
+    not *r6
+    rts
+    inc *r1
+    cmp #202, r2
+    sub L87, L62
+    clr L50
+    clr r7
+    not *r5
+    dec r0
+    cmp #240, L53
+endmacr
+clr L2
+red L22
+rts
+L0: not L39
+L1: mov L0, *r2
+lea L10, *r6
+prn #218
+L2: stop
+prn *r5
+cmp r5, #-180
+red r7
+stop
+L3: inc *r6
+L4: mov L7, *r4
+inc r6
+m4
+L5: .data 396, 6, 621, 837, -612, -769, -335
+prn r2
+m4
+L6: add *r2, r0
+cmp L7, L37
+m1
+L7: red L24
+dec *r0
+m1
+m4
+dec *r5
+m2
+L8: red *r2
+jsr *r5
+dec L2
+dec L0
+lea L18, L0
+m4
+L9: sub L30, r3
+m1
+add #-231, L84
+rts
+red L1
+clr *r1
+L10: jsr *r4
+m3
+
+L11: .data 348, 321, -471, 92, 572, 13, -713, 721
+m4
+m3
+clr r1
+m2
+L12: inc L3
+L13: dec r1
+cmp L18, #73
+jsr *r5
+L14: mov *r6, L1
+; comment
+add *r0, *r1
+L15: sub *r4, *r7
+m3
+L16: clr r6
+prn *r6
+L17: rts
+m4
+bne *r5
+L18: .string "yzrdiickkcaev"
+L19: jsr *r0
+mov *r3, *r6
+stop
+stop
+bne *r2
+inc r0
+jmp *r7
+m2
+m3
+; comment
+m3
+cmp #-112, r2
+sub *r7, r2
+L20: .data -37, -787, 743, 277
+L21: stop
+clr L5
+stop
+L22: mov L8, *r1
+jmp *r5
+L23: .string "uuw"
+L24: red L82
+L25: inc r1
+sub r6, L30
+L26: bne L5
+rts
+L27: mov L19, *r2
+sub #-27, L24
+dec L18
+red r6
+sub r7, r5
+L28: not L94
+L29: prn L11
+red r0
+jsr L88
+jsr *r5
+red r7
+sub L2, L53
+mov *r3, L84
+sub L89, r4
+m3
+m2
+m0
+sub r2, r7
+m4
+m4
+bne L4
+m3
+L30: inc *r0
+rts
+cmp r3, *r4
+red r4
+lea L2, *r2
+
+L31: not *r7
+add #-14, *r3
+; comment
+add #160, *r4
+L32: .data 390
+clr *r5
+jsr *r7
+jmp L8
+not L16
+rts
+m4
+jsr *r7
+clr *r7
+add r0, r0
+jsr *r0
+; comment
+L33: .data 870
+m0
+m0
+cmp *r3, *r2
+bne L68
+
+m2
+prn #-111
+m4
+lea L25, L94
+lea L31, r5
+prn #237
+stop
+m3
+m3
+jmp L39
+L34: sub r2, L1
+L35: dec *r4
+m0
+m3
+m1
+clr r5
+not L41
+; comment
+L36: .string "zlyesqhxsbsls"
+m0
+L37: cmp *r4, *r5
+m3
+jsr L37
+L38: .data 61, 890, -964, -471, -281
+lea L12, L9
+stop
+L39: stop
+inc *r3
+jsr *r6
+stop
+clr *r3
+L40: .string "s"
+jsr L32
+L41: dec *r0
+inc *r2
+lea L82, r0
+mov r4, r2
+sub *r7, *r1
+stop
+m0
+rts
+mov *r1, L37
+L42: prn L26
+m4
+jmp L34
+; comment
+prn *r4
+inc *r6
+jmp L77
+prn r2
+L43: .data -117
+red r2
+L44: inc L58
+
+lea L38, *r4
+
+red L39
+m1
+L45: .string "tdwjvpgmuwxwkxmbytvyppb"
+L46: add #-129, r2
+prn L63
+L47: .string "eqdrftptnzzdoufaiz"
+prn #-53
+add L76, L29
+inc *r7
+m1
+jmp L39
+
+stop
+jsr L17
+clr r6
+stop
+m2
+clr *r6
+jsr L12
+m0
+cmp L1, L88
+inc r6
+cmp L22, #-220
+m3
+dec *r3
+prn *r2
+L48: lea L8, r6
+add L20, *r4
+sub L1, r2
+L49: dec *r5
+bne L83
+prn L22
+L50: .string "uqdnyppuy"
+mov #-136, *r4
+L51: .string "vag"
+m3
+L52: not *r1
+L53: .data 24, 17, 582, -216
+m2
+red r1
+m4
+cmp #146, #10
+cmp L49, r4
+bne *r7
+add r0, L80
+m0
+L54: .string "jntunukjjixlhcoh"
+m3
+sub *r3, L89
+rts
+L55: cmp r3, *r2
+rts
+L56: not r6
+inc r2
+prn *r3
+L57: .data 635, -810
+jsr L15
+add *r3, *r0
+inc L76
+mov r4, L39
+clr *r7
+stop
+L58: inc L93
+mov L3, L12
+not L28
+m4
+dec r7
+L59: jsr L49
+not r0
+add #-233, L56
+jsr *r0
+not r3
+inc r7
+L60: prn #41
+rts
+jsr *r4
+red r0
+clr r2
+bne *r7
+L61: lea L44, r5
+inc *r4
+lea L82, L89
+m1
+not r3
+dec r5
+red L76
+; comment
+L62: red r5
+L63: jsr L76
+; comment
+L64: .data -389, -854, 861, 929, -205, -77, -618
+prn #244
+m0
+stop
+lea L87, r3
+prn #-227
+mov r5, *r5
+stop
+bne L73
+stop
+L65: .data 67, 393, 208, 233, -335, -757, 498, -463
+bne L64
+m1
+lea L85, *r7
+L66: .string "im"
+L67: dec *r3
+lea L72, L73
+L68: .string "bw"
+
+m1
+lea L92, L83
+not L10
+L69: .data 152, 147, -847
+red *r1
+jsr L70
+add *r0, L81
+L70: red r7
+lea L45, r2
+L71: .string "mlysxvykmlyw"
+not L90
+mov r4, *r6
+lea L80, *r3
+
+clr r2
+add #-153, L36
+rts
+jmp L89
+clr L69
+cmp L15, L85
+mov #-15, L68
+m0
+prn *r2
+m4
+cmp #-151, #229
+jmp L41
+cmp r0, r3
+stop
+m2
+m1
+m4
+mov r4, L57
+rts
+red r1
+not L11
+L72: mov L91, *r6
+
+bne *r0
+rts
+add L56, *r7
+m1
+not *r5
+stop
+L73: .data -769, -219
+red *r4
+bne L6
+not L23
+cmp L0, #-156
+
+m4
+m3
+jmp *r2
+not *r6
+cmp r5, *r2
+L74: .data 93, -265, 96, -628, 690, 477, -819
+L75: .string "wzzmx"
+m4
+inc r7
+m4
+m3
+inc r2
+stop
+jsr L82
+sub L93, L53
+sub L84, r3
+prn *r0
+L76: stop
+lea L4, r3
+m4
+not L27
+lea L5, r2
+cmp r2, *r3
+lea L4, *r2
+inc *r1
+L77: .string "gmmtfpslmdbnzvs"
+dec r0
+m3
+
+lea L46, L17
+m0
+L78: .data -516, -407, 851, -684, 176, 740
+L79: sub L97, r6
+dec L30
+dec L38
+m0
+L80: prn L89
+m3
+clr r7
+jmp L37
+rts
+clr *r2
+add #242, L86
+add *r0, L59
+m1
+add *r3, L64
+m0
+bne L97
+mov L89, L95
+m2
+cmp r3, #-21
+red *r4
+prn L62
+L81: dec *r0
+m0
+red r5
+red *r2
+
+clr *r0
+mov L82, r1
+L82: .data 45, 996, -140, -906, -833
+m4
+dec L96
+dec L28
+clr L91
+jmp L97
+cmp #231, #-52
+L83: .data -839, -131, 96, -708, 395
+m4
+L84: .data 437, 713, 145, 482, -542
+m0
+not r6
+add L90, L21
+mov #-120, r3
+cmp #97, #143
+not r7
+m0
+jmp *r5
+stop
+red L97
+m1
+inc L81
+L85: stop
+L86: .data -29, 201, -322, 500, -159
+L87: .string "inyhsqng"
+L88: jsr *r0
+lea L90, r3
+not L97
+inc L22
+L89: mov r4, *r1
+add L97, r6
+L90: jsr *r4
+m4
+add *r4, *r1
+inc *r0
+dec r2
+L91: .data -954, 913, -547, 400, 19
+m1
+dec L28
+not L91
+red *r3
+mov L94, *r5
+m0
+rts
+bne L97
+L92: prn r0
+; comment
+stop
+not L84
+stop
+stop
+lea L38, r3
+m4
+sub *r5, *r3
+m0
+rts
+m3
+lea L94, r4
+L93: mov #-145, L97
+L94: red *r3
+m3
+inc *r6
+m0
+L95: .string "fsxsccvadvabciiyslj"
+inc *r7
+not *r4
+clr r2
+cmp #-205, L20
+cmp r2, L96
+m1
+L96: .data -956, -405, -129, -909, -724, 836, 71, 496
+clr *r7
+add *r6, L93
+clr L97
+rts
+stop
+stop
+sub #184, *r7
+inc r7
+
+m4
+mov L97, r1
+inc r6
+L97: .data 161, 888, 60
+cmp L87, r3
+prn *r5
+m0
+jsr L15
+stop
@@ -0,0 +1,571 @@
+; Generated by genCorpus --seed 95
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+macr m0
+    sub *r3, L49
+    bne *r7
+    red r3
+    bne *r2
+    mov *r0, L53
+    inc L39
+    inc r3
+    prn r2
+    jsr *r7
+    prn r1
+endmacr
+macr m1
+    jsr *r3
+    jsr *r5
+    not *r3
+    sub #-252, r7
+    red *r1
+    stop
+    jmp *r4
+    red r3
+    sub L21, r0
+    sub L60, r0
+endmacr
+macr m2
+    rts
+    bne *r3
+    not L54
+    bne *r2
+    cmp r0, r0
+    jmp *r4
+    mov #106, L113
+    prn *r1
+    rts
+    jsr L4
+endmacr
+macr m3
+    not L53
+    inc r3
+    inc *r0
+    rts
+    lea L107, *r3
+    prn *r4
+    jmp *r7
+    sub r4, *r7
+    lea L106, *r3
+    inc L69
+endmacr
+macr m4
+    dec L63
+    not L33
+    inc r7
+    lea L18, r7
+    clr L33
+    red r2
+    inc *r4
+    inc r1
+    inc L118
+    stop
+endmacr
+L0: .data -896, -381, 793, -671, -626, -627
+L1: .data 860, -284, -306, -463
+m4
+rts
+L2: mov L2, r4
+rts
+add L80, *r3
+L3: .string "wxscrud"
+add r7, *r5
+jmp L68
+
+clr r5
+L4: .string "lk"
+m0
+clr r0
+L5: bne *r3
+m0
+prn L5
+L6: cmp r3, *r3
+L7: red *r0
+inc L84
+inc *r3
+m3
+rts
+L8: jsr *r6
+jsr L8
+L9: stop
+L10: jmp L9
+; comment
+prn *r6
+m1
+L11: cmp *r6, #223
+L12: stop
+
+clr r5
+jmp L71
+prn r3
+m4
+L13: .string "vnnexirlhgzratlxjm"
+prn #-74
+prn #-18
+clr r6
+lea L123, r4
+inc *r3
+m1
+stop
+stop
+add *r6, r0
+mov r4, L89
+m2
+jmp *r0
+dec *r2
+m4
+not *r7
+mov #-183, *r5
+L14: .string "vzfgctflml"
+prn #-153
+L15: rts
+L16: cmp r0, *r5
+jmp L11
+jsr *r5
+m0
+
+; comment
+mov *r1, *r0
+lea L12, L12
+add #119, L34
+cmp r2, #-70
+m1
+L17: add #86, L15
+L18: add L99, r5
+L19: .string "yqlsmuieztybgozqnxkupu"
+clr r0
+prn L6
+L20: jsr L69
+L21: red L104
+bne L76
+inc *r5
+add r6, *r4
+prn r3
+m3
+rts
+rts
+cmp L120, *r2
+L22: .string "kbcoadoldrutf"
+
+red r5
+mov *r2, *r5
+L23: jmp *r4
+m4
+m3
+m3
+inc *r5
+jmp *r5
+
+L24: red L30
+bne *r1
+jmp *r5
+stop
+inc L18
+bne *r0
+prn L19
+L25: mov L19, *r0
+m4
+m0
+L26: .string "xgnwdegbfblzfgkzf"
+prn r1
+L27: dec r5
+L28: .data -5, -296, 780, -90, -68, -526, -426
+red *r4
+bne L82
+dec L57
+L29: jmp L73
+sub *r0, r5
+m0
+L30: .data -783, -674, -739
+clr L20
+m3
+L31: .string "pqgoemqkqxpxbmrdkrxnvhoh"
+bne L40
+bne L18
+jsr L17
+inc *r7
+m1
+L32: .string "fxcdrfwbnhswdqluc"
+L33: .data -953, -815, -474, 111, -392, -585, -467
+L34: .string "novhfliufogbtyrxhauvumep"
+
+add #63, L91
+
+bne *r0
+L35: .string "bstyvvjmkaxlqs"
+m4
+jmp L47
+m1
+red r5
+add L123, r3
+rts
+
+stop
+L36: .data 582, 958, -685, -575, -456, 933, 905, 922
+clr r3
+m1
+add L82, r5
+clr L122
+dec r0
+; comment
+jmp L10
+add r7, L15
+
+lea L34, r0
+L37: add L14, *r5
+dec L114
+m3
+jsr *r6
+stop
+mov L25, L46
+dec L102
+inc L53
+bne *r2
+stop
+m3
+m0
+L38: .data -967, 505, -249, 553, 44
+dec L8
+m4
+L39: sub *r3, *r0
+L40: add *r5, L7
+m2
+L41: .string "vcsqspjuo"
+m0
+L42: clr r2
+L43: .string "ryowypkgrzbrmlglet"
+L44: .string "dlgv"
+jmp *r6
+clr r6
+not *r4
+L45: dec *r7
+not L101
+mov L73, L37
+m3
+dec L50
+m0
+clr L10
+add r6, L17
+L46: jsr *r4
+red *r0
+L47: .data 930, 173, -781, -287, -966, -92
+; comment
+cmp r7, r4
+bne *r6
+cmp r2, r6
+inc *r3
+L48: .string "fvjhutkpryiecefep"
+not L72
+m3
+sub r4, *r2
+mov L118, *r6
+L49: .string "qyvfbm"
+red L67
+inc L92
+dec *r7
+lea L79, r1
+L50: .string "macrcxnflxwmvumioolwvptp"
+prn r4
+m3
+L51: .string "pnjbripructzmqeu"
+L52: sub L25, *r6
+m4
+jsr L16
+jsr *r3
+; comment
+dec r3
+m1
+L53: mov L33, *r2
+stop
+cmp #-18, L56
+stop
+stop
+m1
+L54: red *r0
+stop
+m4
+dec *r5
+L55: .data -531, -868, -434, -473, -610, -527
+sub r1, *r7
+add #194, *r1
+jmp *r0
+not *r4
+m1
+m1
+red L55
+bne *r1
+inc L57
+m2
+L56: prn L127
+dec *r5
+inc *r1
+m0
+add #-238, *r0
+L57: add r7, r4
+jmp L83
+red *r2
+L58: mov r6, L91
+L59: lea L128, r6
+stop
+L60: .data -363, 673
+cmp *r2, r5
+L61: .string "miqcrgdsqeijvmcstotmd"
+
+lea L78, L90
+rts
+rts
+red L18
+add *r0, L4
+L62: bne *r2
+rts
+m2
+bne L68
+bne *r5
+bne *r5
+L63: .data -332, -652, 766, -657, -785
+jmp L124
+jmp L35
+inc *r0
+dec L57
+jsr L5
+prn #-177
+mov r7, L48
+m2
+L64: clr L59
+L65: .data -769, 532
+rts
+inc *r2
+dec L84
+L66: .data -874, 253
+red *r1
+L67: .string "yctoyyrsgytpxy"
+L68: .data 146, 838, -703, 855, 157, 433
+jsr *r5
+lea L119, r2
+jmp *r1
+L69: .string "vgvh"
+dec r4
+dec *r7
+L70: .string "eyzkovdgzyycatiktkxrinjj"
+jsr *r6
+add L4, L128
+L71: clr *r6
+
+L72: cmp L27, L116
+L73: lea L125, r2
+L74: prn *r6
+L75: jmp L13
+add *r2, *r2
+red r0
+dec r3
+not L68
+cmp L69, L115
+red r3
+; comment
+L76: .string "mtizzcjhfjo"
+jsr L23
+
+m0
+not *r6
+L77: .string "hvbhkazfhbf"
+prn r6
+prn #-213
+add *r6, r2
+dec L35
+clr *r3
+not L31
+m2
+m1
+jsr L113
+L78: red L85
+prn *r5
+add r3, r4
+add #-120, r3
+dec r5
+L79: dec r5
+stop
+jsr L104
+jmp *r7
+L80: .string "kecjpirlpnhniqbihwesw"
+; comment
+prn r2
+m2
+add *r7, L102
+inc *r2
+inc L72
+sub *r3, r2
+jmp L117
+add #-104, L109
+add r2, L11
+m4
+L81: clr *r2
+rts
+m2
+not r3
+L82: .string "giwqxbcxpbqcvrssvtbjr"
+prn *r1
+L83: jsr L17
+m3
+L84: sub r4, L85
+m3
+not *r6
+L85: .string "ygesccakv"
+bne L112
+bne *r3
+bne *r6
+inc r4
+clr r0
+L86: .string "drawtj"
+L87: dec L2
+m3
+clr r3
+m1
+m1
+L88: inc L92
+jsr *r4
+lea L57, L109
+dec *r1
+cmp L115, L106
+bne *r1
+L89: .string "qgpquq"
+red r3
+m1
+L90: sub #90, r6
+add L96, r1
+m3
+mov L91, r6
+inc r6
+m2
+m2
+mov r4, L42
+L91: inc r0
+red L99
+L92: not *r4
+m1
+
+L93: cmp L101, L48
+mov *r6, r1
+prn #236
+bne L107
+rts
+stop
+dec L22
+L94: dec *r5
+add r0, L102
+sub #-5, L125
+bne L112
+jsr L121
+L95: .string "kyp"
+prn #-191
+cmp *r1, L120
+m2
+m3
+jsr *r1
+not r6
+mov #-97, L125
+L96: bne *r5
+L97: .string "ppebzonc"
+sub r7, *r3
+; comment
+L98: .string "hqskgcmgofkidv"
+L99: rts
+m2
+L100: .data 890, -261, -621, 406, -32, 821, -903
+prn r0
+m4
+dec r5
+m3
+L101: jmp L86
+red *r5
+inc L106
+stop
+prn #68
+L102: lea L23, L85
+m3
+L103: sub r5, r1
+dec *r1
+L104: .data 653, 275, 940, 979, 401, 350
+add L127, *r5
+L105: bne *r4
+
+L106: .string "jpdpxs"
+L107: not r0
+sub r6, r0
+add L113, r4
+L108: cmp r1, *r4
+L109: inc r1
+L110: sub *r1, r6
+jsr L125
+prn L72
+L111: .string "sqarjashxunxlom"
+m3
+L112: red r7
+
+inc L110
+L113: .string "kxohtvoqnpkgctwb"
+m1
+; comment
+inc *r4
+red r7
+m3
+red *r5
+L114: red r4
+L115: stop
+L116: .data -499, -640
+mov L84, *r6
+jsr *r0
+jmp L125
+L117: .string "edsfkbicneiztxtxu"
+m3
+red *r6
+m2
+add r2, L105
+mov *r4, *r3
+m4
+L118: jsr *r2
+not L27
+bne *r1
+prn #22
+bne L103
+red L122
+L119: inc L42
+inc r1
+lea L128, *r3
+L120: .data -292, 146
+m2
+m3
+inc L123
+clr *r1
+L121: mov L63, r7
+bne *r2
+dec L123
+mov #-25, L122
+sub r6, L125
+m0
+; comment
+prn #-145
+cmp *r0, L124
+L122: lea L67, *r6
+bne *r0
+lea L127, *r3
+jsr L128
+L123: stop
+L124: sub #138, L125
+L125: .string "bvyeabhuxhjwyfpwykx"
+bne L106
+m1
+; comment
+L126: not *r4
+L127: red L89
+L128: .data -669, -825, -822, 351, -461
+m3
+prn #86
+jmp L86
+stop
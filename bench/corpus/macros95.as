@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 96
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    add #-91, *r0
+    stop
+    jsr *r7
+    cmp r4, r7
+    clr L75
+    add #114, *r6
+    not r3
+    dec L11
+    cmp L35, L19
+    clr *r1
+endmacr
+macr m1
+    clr L94
+    prn *r6
+    sub r4, L31
+    stop
+    lea L96, *r3
+    clr *r5
+    stop
+    lea L8, r1
+    lea L17, L3
+    stop
+endmacr
+macr m2
+    bne *r2
+    inc L44
+    dec r3
+    clr L109
+    rts
+    bne *r7
+    red L102
+    mov r7, r3
+    red *r3
+    add #-199, r1
+endmacr
+macr m3
+    jmp *r0
+    jmp *r0
+    jmp *r7
+    lea L122, r0
+    add #-255, r7
+    clr r1
+    lea L121, *r2
+    prn L102
+    not r6
+    sub #64, r0
+endmacr
+macr m4
+    mov L77, *r5
+    cmp r3, L34
+    jmp L108
+    red L49
+    clr L9
+    red L79
+    rts
+    mov *r3, L125
+    not r3
+    not *r1
+endmacr
+not r6
+L0: prn *r0
+m1
+rts
+bne *r6
+L1: not r6
+clr *r3
+rts
+L2: .string "xxkdpthjickxmbkunqcqp"
+stop
+cmp *r2, L73
+jsr L7
+rts
+L3: lea L1, L1
+stop
+L4: rts
+L5: jmp L58
+m4
+lea L3, r7
+jsr L5
+add L91, r7
+L6: inc *r1
+sub L61, r5
+m0
+; comment
+not L84
+clr r0
+sub r1, *r1
+dec r2
+bne *r6
+red *r5
+m4
+L7: stop
+rts
+mov *r6, r7
+L8: not L4
+; comment
+prn r0
+rts
+
+rts
+bne L5
+L9: not r6
+m2
+dec *r6
+; comment
+jmp L105
+jmp *r5
+stop
+L10: .string "hpjw"
+rts
+L11: prn #162
+cmp r5, *r4
+not r3
+cmp #-214, #153
+prn *r5
+lea L10, r5
+prn *r6
+inc *r3
+
+L12: bne *r0
+mov *r5, r3
+m1
+m3
+bne L95
+L13: .data 650, 626, -356, 352, -483
+; comment
+add *r6, r6
+dec *r0
+m3
+
+clr *r0
+bne *r1
+inc r2
+clr L12
+dec *r5
+dec *r7
+cmp *r2, L107
+mov L23, L2
+stop
+rts
+L14: .data 724
+L15: .string "qfbhp"
+L16: add r5, L4
+lea L107, *r7
+jmp L51
+m0
+clr r6
+L17: mov *r2, *r7
+jsr L6
+rts
+L18: lea L15, r4
+sub #-114, r7
+jmp *r0
+L19: prn #245
+inc *r3
+mov #233, r7
+add L12, L28
+L20: rts
+dec L75
+cmp *r2, L25
+
+red L18
+jmp *r6
+m3
+m2
+L21: red *r7
+jmp *r4
+m4
+stop
+m4
+L22: stop
+L23: clr r0
+add *r2, L50
+L24: .string "nehyzctm"
+L25: .string "trkkqyiwsxosqrivpcygj"
+m2
+m0
+not *r1
+red *r6
+m0
+prn r5
+m4
+mov L97, L122
+
+jsr *r5
+L26: inc *r2
+L27: red *r5
+prn *r3
+red L14
+sub r0, r4
+L28: add *r5, L6
+prn r3
+L29: .string "bybyozydltmxeu"
+m3
+L30: cmp L16, r0
+m4
+m3
+inc r5
+m2
+L31: bne *r0
+; comment
+red *r7
+lea L54, *r7
+L32: not r1
+dec r7
+L33: dec L27
+; comment
+clr L25
+cmp #191, *r7
+prn r1
+jsr *r2
+cmp L71, r7
+L34: .data -656, -267, 339, -674, -339, 280, -747, 33
+mov r2, L115
+prn L31
+L35: bne L30
+dec L17
+L36: lea L3, L91
+m4
+m4
+jsr L30
+m2
+m4
+inc r1
+stop
+stop
+L37: .data -706, 810, -173, -818, -639
+not L14
+L38: prn *r4
+L39: .string "sirls"
+red r1
+cmp #-187, #208
+jmp L11
+red L88
+m2
+jsr *r1
+m0
+bne L33
+m1
+L40: dec L39
+L41: dec r5
+dec L102
+prn L82
+rts
+stop
+sub r2, L119
+sub L103, r2
+L42: bne L40
+prn r7
+jsr *r6
+L43: .data -126, 205, 600, 928, -338
+L44: jsr L11
+add L109, r7
+not *r5
+bne *r7
+sub *r3, L71
+L45: .string "nfrfcteeqnw"
+stop
+red r3
+m1
+rts
+cmp L55, L17
+red r3
+add L20, L53
+add r6, *r0
+dec *r7
+L46: jsr L2
+rts
+cmp L82, r4
+
+clr *r0
+m4
+L47: prn L76
+inc *r5
+m3
+jsr L104
+L48: sub r1, *r3
+m0
+L49: .data -762, -834, -825, -142, 88, 42, -621, 363
+m1
+add r5, *r2
+jsr *r5
+m2
+red L74
+lea L35, L20
+not r6
+m2
+red L67
+inc L97
+L50: .string "xjjr"
+inc *r2
+m4
+jsr L25
+dec *r1
+inc r7
+cmp *r7, *r0
+lea L15, L102
+clr L1
+jmp L110
+jmp *r1
+m4
+m2
+rts
+add r0, L16
+
+L51: .data 152, -172, -909
+sub #-219, *r1
+cmp L24, r2
+L52: dec r3
+clr *r2
+m4
+L53: .data 551, 247, -995, -755
+L54: .data 369
+L55: .string "wfinoxyyqxzoxiuwlaxhqx"
+L56: .data 93, 290, 606
+L57: .string "lqdqpmlumr"
+m2
+clr L91
+
+L58: .string "djvagcbiamfnxiqnyaetmwuc"
+cmp #237, L101
+L59: rts
+prn #26
+m0
+rts
+L60: stop
+m2
+mov *r7, *r1
+sub r0, r0
+L61: .string "ttsnkbbhvfzufizepfiy"
+; comment
+add L33, r3
+lea L48, r2
+dec *r1
+L62: add r4, r7
+m2
+mov #-81, *r4
+m2
+L63: .data 118, 824, 539, -619, 454, -35, -479
+not L95
+not r7
+red r2
+; comment
+jsr *r4
+jsr *r6
+cmp r7, r0
+L64: bne *r6
+m2
+L65: .data 856, -944
+inc *r3
+L66: .string "quuplszllsoykaozhnyz"
+prn #136
+cmp r3, r2
+L67: .data -938
+m3
+add #189, L45
+bne *r1
+L68: mov L27, L74
+bne *r6
+jmp *r4
+prn #-12
+not r4
+m4
+lea L79, *r7
+L69: .data 354, -409, -514, -483, 393
+jsr *r3
+L70: mov L40, *r5
+L71: prn r1
+L72: lea L47, L111
+m1
+m1
+; comment
+red *r4
+not L64
+stop
+L73: cmp *r5, L117
+jmp *r2
+lea L19, L85
+cmp L113, #-37
+L74: .string "fpgntt"
+m4
+L75: red r3
+L76: .data 919, 289, -14, 319, -249, -997
+jmp L66
+prn *r6
+cmp #223, L121
+m2
+L77: bne *r6
+m3
+L78: jmp L125
+lea L90, *r1
+L79: .data 379, -144, 651, -401, 147, -714, -446, 271
+L80: clr *r0
+lea L33, r0
+L81: dec r0
+m0
+L82: rts
+L83: .data 280, -949, -643, -81, 354, -595
+cmp #24, L124
+prn *r6
+L84: jmp *r1
+add #-37, *r3
+lea L24, *r6
+m1
+m1
+L85: jsr L42
+lea L47, r2
+not L29
+m3
+rts
+clr L76
+L86: .string "lb"
+rts
+red r3
+L87: .string "nekxvkqbgkmuwgjtod"
+sub *r0, L91
+L88: .string "egrywmyvsrqumdttqqrvpdf"
+cmp L30, L93
+bne *r5
+jmp L107
+bne L100
+m3
+jmp L94
+L89: not r3
+clr L7
+prn *r1
+m4
+m3
+L90: .string "labhlsha"
+L91: prn #-124
+L92: mov #-60, *r7
+jsr L125
+lea L41, L35
+m2
+m2
+inc L79
+L93: .string "lpjtumu"
+L94: prn L39
+L95: cmp L9, r2
+; comment
+sub L36, r7
+cmp L66, r1
+stop
+add #42, *r5
+sub r7, r0
+bne L121
+lea L125, r6
+L96: sub L37, r5
+jsr L44
+clr L101
+L97: clr *r6
+inc L109
+add L120, r4
+sub r7, L79
+mov L109, r6
+m3
+L98: .string "mxjieiryckexux"
+jmp *r4
+m0
+rts
+clr r0
+m4
+L99: not *r0
+inc *r2
+m0
+L100: cmp #44, L118
+L101: .string "erxsvqontmpmmhqovjn"
+m0
+L102: stop
+rts
+mov #254, L64
+red *r6
+stop
+rts
+; comment
+lea L118, r7
+lea L124, r3
+L103: cmp #-50, #245
+L104: bne L5
+cmp L1, *r1
+jmp L112
+lea L121, L4
+L105: .data 503, -760, 689
+L106: cmp *r3, #7
+prn *r0
+; comment
+prn #-138
+bne *r2
+dec *r7
+L107: mov r7, *r6
+m2
+L108: jmp L110
+L109: prn r7
+lea L120, L112
+L110: .data 935, -144, -799, -630
+m1
+m4
+jsr L115
+dec L123
+not *r3
+m0
+L111: .string "pyhitgacha"
+jmp *r7
+mov r4, L121
+bne L120
+add r5, *r2
+m4
+bne *r7
+lea L34, *r5
+L112: clr L22
+not L83
+L113: .string "odvzjminyjwqqlgquiyurpw"
+m1
+jsr *r7
+m1
+lea L26, L122
+m4
+L114: .string "dxcptqwfrhcpsu"
+dec L122
+L115: not L98
+bne L120
+L116: bne *r7
+m1
+sub L125, r2
+m0
+L117: .string "vtapnvajoacvrskawdgnrplt"
+L118: .string "bk"
+jmp L92
+jsr L27
+stop
+jsr *r3
+prn L121
+lea L119, *r5
+not L125
+bne L125
+m1
+dec L95
+L119: .data -53, -349, 84, 721
+L120: .data 240, -629, -868, -277, 842
+jsr *r3
+m4
+m3
+rts
+L121: jmp L123
+jsr *r3
+mov r4, L122
+m2
+L122: .data 253
+m1
+add r5, L54
+jsr L125
+m0
+bne L125
+jmp *r6
+lea L42, L43
+L123: prn L124
+rts
+L124: inc *r5
+L125: inc L7
+stop
@@ -0,0 +1,571 @@
+; Generated by genCorpus --seed 97
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+macr m0
+    sub *r2, r7
+    inc r4
+    jsr L26
+    lea L83, L128
+    jmp *r1
+    stop
+    red L71
+    mov r2, *r2
+    not L95
+    prn #-152
+endmacr
+macr m1
+    jsr L39
+    prn r5
+    not *r4
+    dec *r2
+    cmp r7, #-110
+    cmp r0, *r3
+    add r4, L31
+    red L113
+    mov *r5, L29
+    red L15
+endmacr
+macr m2
+    add r2, L74
+    bne L75
+    clr *r5
+    sub *r6, r3
+    bne *r3
+    lea L81, *r0
+    jmp L63
+    rts
+    dec L10
+    lea L101, *r0
+endmacr
+macr m3
+    clr r7
+    sub *r1, r7
+    jsr *r4
+    jmp *r2
+    red L17
+    sub #-50, L97
+    lea L7, L63
+    dec L33
+    lea L57, r3
+    lea L105, *r2
+endmacr
+macr m4
+    sub r7, r6
+    not *r5
+    cmp *r1, r0
+    red L57
+    prn #-96
+    jmp L69
+    not r7
+    sub r1, *r4
+    stop
+    lea L101, r4
+endmacr
+L0: rts
+bne *r7
+m1
+m1
+add *r0, L0
+L1: .data -142, -357, -451
+L2: .data -353, 346, -596, 258
+prn *r2
+L3: jmp *r6
+bne *r1
+L4: mov r0, L4
+rts
+m0
+red L103
+cmp L16, r0
+inc *r5
+jsr *r0
+prn L60
+dec *r6
+; comment
+; comment
+sub #112, *r3
+lea L103, *r0
+m0
+jmp L6
+jmp *r3
+clr *r3
+not L2
+rts
+inc r0
+m1
+L5: .data -728, -454, 869, -663, 799, -461
+sub r7, r5
+not *r3
+L6: bne L119
+prn r1
+L7: stop
+add #156, *r5
+m1
+bne L4
+dec L0
+add r5, *r4
+jsr *r6
+m2
+m4
+jmp L6
+L8: .string "qknwbipilpenbkftx"
+L9: clr *r1
+red r4
+; comment
+bne *r7
+L10: dec L8
+m0
+L11: stop
+lea L0, *r4
+stop
+clr L53
+m3
+bne L1
+prn L4
+mov r7, r5
+cmp L11, *r2
+prn L3
+L12: .data 602, 250, -276, 0, 657
+red *r6
+rts
+jsr L5
+L13: red r1
+L14: mov #118, L6
+L15: .string "nmogklgciuehjactrl"
+add r4, r3
+m0
+m0
+clr r5
+inc *r2
+m4
+add #24, *r7
+jmp L97
+L16: .data -180
+prn r3
+L17: red *r0
+L18: red r6
+rts
+; comment
+L19: .data 551, 349, -948
+; comment
+L20: dec *r1
+inc *r6
+m2
+dec L123
+bne L17
+dec r0
+L21: add L0, *r0
+bne L92
+not L17
+cmp #110, L16
+m3
+mov #22, *r4
+m2
+rts
+mov #76, *r6
+L22: .data -107
+not L76
+mov *r2, *r2
+L23: .data 990, -575, 814, 498, -945, 1
+L24: stop
+m3
+inc L17
+add #83, r4
+L25: .data -488, -972, -29, 480, 540, 121, 823, 91
+not *r7
+mov #-6, r1
+mov L0, r3
+L26: .data 367, -732, 686, 496, -780, -378, 241
+L27: jmp *r0
+prn #-14
+m3
+jmp *r1
+sub *r1, *r7
+inc r5
+jmp L4
+mov #-203, L26
+m2
+L28: clr *r3
+L29: .data 655, -501, -14, 959, 477, 563, -907
+L30: red *r0
+
+inc r1
+dec L110
+
+L31: not *r7
+jsr L80
+L32: .string "tnxucyygiwjyskves"
+L33: dec *r3
+inc r0
+rts
+m0
+prn r1
+L34: .data -292, -502, 107, 961, -339
+stop
+rts
+m4
+m2
+not *r7
+red *r1
+L35: prn r1
+m2
+sub r7, L34
+inc r4
+L36: red *r1
+not *r7
+sub r0, r5
+rts
+add *r2, L47
+
+clr *r7
+inc r1
+L37: mov r2, L61
+not L94
+mov L61, *r6
+dec r4
+m2
+not *r5
+lea L100, *r7
+rts
+jsr *r1
+jsr L22
+inc r4
+rts
+m4
+jsr *r3
+clr *r2
+lea L9, L97
+bne L63
+red L66
+m3
+L38: jsr *r6
+mov *r0, r2
+mov #-208, L5
+L39: sub r7, L126
+red r3
+bne *r1
+L40: dec *r0
+m0
+L41: jsr *r6
+m2
+bne *r6
+prn #-151
+m0
+L42: clr L19
+L43: stop
+m1
+stop
+jmp L12
+L44: stop
+L45: rts
+L46: stop
+m2
+jmp *r0
+lea L83, L76
+rts
+m4
+rts
+cmp #-92, L3
+L47: jsr L84
+; comment
+L48: .string "gk"
+L49: add #36, r0
+L50: .data 563, 481
+m3
+m3
+L51: .data 213, 615, 52
+mov r7, L47
+m4
+prn #-152
+jsr L120
+inc *r5
+cmp #58, *r2
+lea L79, r7
+L52: .data -289, 316, -906, -969, 868
+jsr L98
+rts
+sub r3, r1
+cmp *r4, L23
+L53: bne L77
+m4
+red r7
+L54: clr L75
+; comment
+m2
+jsr *r6
+lea L62, L118
+dec L27
+mov L123, *r2
+rts
+L55: cmp #231, *r2
+L56: red *r3
+L57: jsr *r6
+bne *r3
+L58: .data 16, -926, 619, -486, 618, 311, 933
+m0
+m3
+dec r4
+add *r4, r5
+L59: bne *r1
+bne L36
+clr r2
+clr L128
+m0
+; comment
+m2
+
+L60: .string "xjs"
+L61: clr L107
+jmp L117
+L62: .data 235, 943
+sub r6, r0
+clr r1
+jmp L55
+mov L59, r7
+m1
+; comment
+sub L22, *r6
+m1
+clr L65
+; comment
+sub #140, r5
+cmp #-79, *r0
+not *r2
+clr r0
+bne *r6
+cmp #-15, #223
+L63: lea L113, *r7
+m1
+; comment
+L64: .string "baxfgolojdygwdwbulwx"
+L65: stop
+jmp L70
+L66: dec *r2
+L67: jmp *r7
+not L77
+dec L42
+L68: dec L21
+bne L74
+L69: red L62
+cmp L123, r3
+m4
+; comment
+add L78, r2
+m3
+L70: jsr *r6
+L71: cmp r6, #21
+L72: .data 601, 662, -261, 802
+L73: not r6
+m2
+bne *r3
+m2
+prn #-40
+lea L13, r4
+sub #-177, L57
+L74: rts
+mov *r2, r6
+L75: jmp *r1
+jsr *r2
+L76: inc r5
+rts
+L77: sub #66, *r2
+jmp L13
+mov r7, L105
+not r2
+lea L4, r0
+prn r6
+L78: .string "umzfksv"
+jmp L86
+clr L121
+L79: red r4
+L80: stop
+jsr L104
+rts
+L81: .string "dkge"
+inc r3
+m1
+m2
+L82: dec *r6
+m3
+jmp *r7
+add *r6, L106
+L83: rts
+inc *r7
+rts
+L84: not *r2
+rts
+L85: .data -353, 127, 907, -337, -878, 874
+m0
+jsr *r3
+bne *r6
+add r4, L35
+m4
+m0
+sub *r3, r2
+m0
+mov *r0, r1
+inc *r4
+prn r4
+cmp r0, r6
+dec *r0
+clr L104
+m4
+m3
+lea L87, *r6
+L86: .data 77, 5, 788, 473, -671, 963, 376
+clr r5
+stop
+L87: .string "gonikabhhdvotxfffapc"
+m2
+L88: stop
+m4
+jsr *r4
+jsr *r3
+sub #-160, *r1
+m3
+red *r5
+L89: add r4, L29
+jsr *r4
+m0
+
+clr L126
+mov L9, r7
+jsr L92
+L90: mov *r5, L110
+add L125, L12
+m1
+L91: lea L66, L2
+L92: mov *r4, *r1
+dec L48
+
+L93: red *r4
+inc L71
+m3
+mov L37, *r6
+m4
+not L111
+m4
+m3
+red L58
+prn r3
+L94: lea L20, L27
+L95: red *r2
+m1
+L96: jmp L1
+L97: jmp *r1
+m2
+m4
+L98: .string "kxgelvq"
+L99: dec L49
+jsr L115
+m2
+
+jmp L83
+inc r2
+mov *r5, L102
+L100: .string "ujycrcmyavvhi"
+jsr *r7
+L101: not L111
+jmp *r2
+sub r0, r2
+jsr *r3
+red L126
+stop
+stop
+clr r0
+jsr L121
+lea L121, *r1
+L102: .string "dqr"
+L103: dec L109
+L104: .data -669
+m1
+jsr *r4
+L105: .data 216, -482, -498, 552, 909
+; comment
+m3
+inc L126
+rts
+L106: mov L70, r1
+L107: .data -668, 332, 786, 280
+prn *r3
+jsr L14
+jsr *r2
+m4
+inc *r5
+stop
+rts
+dec L114
+add *r2, r3
+sub #73, *r1
+L108: lea L116, r4
+m0
+m1
+add *r0, r2
+L109: not L21
+stop
+L110: prn *r5
+m0
+; comment
+; comment
+cmp L114, r6
+m1
+
+lea L112, r4
+red *r0
+L111: .data 292, -356, -625, -272
+sub #-9, L10
+jmp *r4
+jmp *r7
+L112: .data 67, -580, -733, -949, -367, -881, 231
+lea L73, *r6
+dec L102
+L113: bne L116
+bne L55
+not L102
+dec r5
+L114: cmp #-222, r3
+m2
+L115: .data -314, -721
+mov r3, L121
+L116: .data 318, 166, -800, -741, -27, 47, 131
+stop
+dec *r3
+cmp L18, *r4
+; comment
+cmp r2, *r2
+m1
+mov *r0, *r7
+add #59, L128
+L117: jsr L52
+L118: not *r7
+m3
+L119: bne *r6
+L120: inc *r7
+L121: dec r0
+mov r2, L103
+red L122
+L122: dec r3
+prn r3
+L123: jmp L125
+jmp *r4
+m0
+L124: .data 887, 829, -521
+L125: jsr L127
+m2
+mov #187, r0
+L126: red *r1
+L127: .data 369, 631
+not r2
+cmp r2, *r2
+L128: lea L25, L77
+m0
+m0
+inc r7
+cmp L77, r5
+stop
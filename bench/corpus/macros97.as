@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 98
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    red *r5
+    rts
+    prn r3
+    cmp r7, r3
+    cmp #229, #119
+    inc L108
+    inc r1
+    cmp L56, #-208
+    cmp L101, *r1
+    inc L55
+endmacr
+macr m1
+    rts
+    bne *r6
+    prn r6
+    clr r5
+    jsr L50
+    cmp L58, *r4
+    not *r4
+    jmp *r3
+    lea L118, L19
+    inc r1
+endmacr
+macr m2
+    sub L69, L98
+    prn *r7
+    lea L40, r6
+    mov r5, L1
+    jsr L16
+    inc r2
+    jmp L27
+    lea L60, r6
+    dec r6
+    jmp *r3
+endmacr
+macr m3
+    prn L13
+    dec *r1
+    sub *r5, L2
+    mov L60, *r2
+    clr L106
+    prn r7
+    lea L53, L58
+    bne L116
+    clr *r6
+    bne *r3
+endmacr
+macr m4
+    jsr L30
+    inc L55
+    mov L116, r5
+    cmp #-52, *r1
+    jmp L62
+    jsr *r6
+    clr L111
+    stop
+    bne *r7
+    bne L47
+endmacr
+m4
+L0: cmp L0, #-11
+L1: .string "nhiyhnypnwjjcvgr"
+L2: add L2, L2
+cmp *r7, *r0
+lea L1, *r3
+red *r3
+red r3
+rts
+clr *r3
+lea L9, L74
+m4
+rts
+m3
+lea L45, L2
+cmp L0, L2
+rts
+
+L3: red *r1
+L4: .data -262, -543, 903, 425, -76
+jsr *r2
+m1
+L5: add #-82, r4
+dec L0
+lea L4, *r1
+add L3, *r6
+dec *r3
+bne L1
+m2
+lea L114, *r3
+m2
+inc r6
+lea L5, L1
+cmp L5, *r6
+; comment
+rts
+m2
+L6: .data 113, 971, 748
+cmp #-56, r6
+L7: .string "hxruwfvlu"
+L8: .string "ojnkp"
+L9: sub r3, *r1
+sub r0, L75
+not r0
+sub *r4, *r2
+jmp *r3
+m2
+m1
+cmp *r6, *r1
+m3
+L10: inc L10
+stop
+m4
+rts
+add r0, *r0
+add r5, r2
+red L4
+m2
+m2
+lea L1, r4
+sub r1, r3
+red *r2
+prn L24
+not r6
+; comment
+stop
+prn L4
+m2
+m0
+m1
+mov #90, *r2
+bne *r2
+L11: bne *r7
+jmp L3
+L12: .string "froutiijvgsahzn"
+sub *r1, r0
+L13: not r4
+m1
+mov #-73, L15
+L14: .string "unnaykoxbeokapbsda"
+red *r4
+L15: cmp *r1, r6
+dec r5
+inc r7
+m0
+dec L0
+bne *r4
+cmp #109, #-141
+jsr *r4
+clr L4
+L16: .data -882, -284, 776, 156
+lea L110, r2
+bne *r7
+clr r6
+red L11
+L17: bne *r0
+dec r7
+prn *r1
+m3
+stop
+L18: mov r5, *r5
+L19: .string "ngwnhdcoyqmyekvjtpu"
+L20: .string "idhwpfrjiwtzipe"
+m4
+sub L13, L113
+mov L4, *r3
+sub r7, *r4
+L21: .string "ocfusosdyosw"
+stop
+L22: .data 987, 975, -228
+L23: .string "spsyhqezomcxesucpsxmfypt"
+red r5
+m1
+cmp L73, #-178
+L24: red L18
+rts
+L25: rts
+L26: .data 709, 508, 394, 620, 818, 290
+L27: dec L6
+L28: .data -402, -385, 684, 827, -554, 619, -486
+inc *r1
+L29: .data -215, -251, -472, -235, 806
+bne L114
+L30: red r7
+inc L6
+mov r6, L17
+L31: .string "wg"
+red r0
+not L93
+L32: .data 745, -749
+add *r4, L109
+m4
+L33: .data -570, 370, -666, 145, 298, 353, -701, 828
+dec *r7
+m2
+sub r7, r7
+L34: .string "ocpjpavh"
+
+m3
+mov r7, L80
+prn r4
+sub r5, L70
+clr r2
+dec L10
+m1
+bne *r2
+jmp *r0
+L35: .string "fdusqbxefxzacukmlm"
+sub #-149, *r1
+L36: stop
+stop
+dec L51
+red L90
+m2
+L37: .string "dogdwes"
+sub *r3, *r0
+inc *r2
+jmp *r4
+not r3
+m4
+stop
+L38: .data 597, -647, 678, -207, 768
+rts
+jsr *r3
+jmp *r2
+L39: jmp *r2
+cmp L109, *r3
+L40: bne L113
+cmp L69, r5
+jsr L19
+L41: .string "torljkdnxyplqyfgwxgs"
+red *r2
+L42: stop
+L43: .string "ovxnydxheszsiblczvxpuap"
+jmp *r1
+mov r1, *r4
+L44: stop
+m3
+m2
+m0
+L45: prn #-115
+inc L87
+cmp #-240, #-95
+rts
+m4
+m1
+m0
+rts
+L46: cmp L47, #-206
+L47: .string "a"
+mov r1, L23
+not L114
+L48: rts
+not r1
+; comment
+
+m1
+dec L44
+dec r5
+bne L12
+L49: mov *r6, L75
+clr r3
+jsr *r4
+jmp L85
+L50: not r4
+m0
+m3
+stop
+L51: clr r4
+lea L30, r4
+red L17
+prn *r1
+clr *r0
+L52: .string "uvpgnunnc"
+rts
+sub *r4, L76
+dec L46
+L53: jsr *r7
+m2
+jsr *r4
+inc *r3
+not L96
+jmp L69
+mov *r2, *r1
+L54: .string "ffrsoebiejhdnpgcczams"
+m3
+m1
+cmp *r5, L111
+L55: .string "orljb"
+inc *r7
+stop
+dec r2
+lea L60, *r3
+L56: lea L90, r7
+m4
+L57: .string "becltq"
+clr L23
+mov *r1, L59
+L58: lea L8, L81
+red *r0
+stop
+sub #-190, r2
+stop
+L59: prn L78
+m0
+not L15
+L60: bne L1
+lea L17, L75
+m0
+m2
+jmp *r3
+not r0
+dec *r1
+lea L18, L59
+red r2
+L61: .string "mkjimtkmcepytxg"
+m2
+L62: add r6, L74
+L63: jmp L37
+m0
+lea L64, *r4
+L64: stop
+lea L81, r6
+dec r2
+stop
+L65: clr r6
+m0
+dec L75
+add #135, *r0
+mov L121, L97
+red r3
+clr *r3
+dec *r4
+red r6
+L66: .data 337, -189
+L67: clr L0
+
+L68: cmp *r2, r5
+m2
+prn #51
+L69: lea L111, r0
+rts
+m3
+; comment
+L70: .string "hstoauuccdtaljgdruijl"
+L71: .data -12, -328, -451, 313, -326, -618, 1
+L72: .string "gqf"
+bne *r2
+L73: lea L99, L56
+stop
+m1
+sub *r5, L78
+stop
+m1
+jsr *r7
+jmp *r0
+not r2
+bne L24
+red L71
+; comment
+add L14, r1
+mov L42, L82
+stop
+m0
+cmp *r3, r2
+L74: .string "m"
+prn L97
+L75: mov L94, r0
+L76: .data -859
+m4
+L77: dec L79
+L78: cmp #-181, *r0
+lea L108, r6
+m0
+inc r0
+m4
+L79: dec r0
+mov L113, *r4
+red L27
+not L79
+add L89, *r3
+L80: .string "rcxfm"
+jmp L47
+add r2, L122
+dec L91
+clr L107
+not L53
+add L91, *r5
+L81: .string "rll"
+m4
+clr r1
+L82: .data 286
+lea L78, r7
+
+L83: red *r6
+jsr L17
+add r7, *r4
+m2
+
+L84: .data -781, -968, -921, 591, -615, -128
+m1
+rts
+jmp L85
+jsr *r1
+
+sub r4, L51
+L85: .string "bpmgddmzdqw"
+L86: .data -155, 979
+m1
+inc L22
+lea L120, r6
+L87: sub #151, r5
+mov *r7, *r7
+inc L101
+L88: bne *r1
+m1
+L89: .data 509, 187, 867
+L90: .data 732
+prn #251
+L91: .string "xzntripfnwcfyngmfxsks"
+; comment
+m0
+L92: lea L72, *r5
+m0
+; comment
+L93: .data 175, -617, -570, -65, 704, 556, -898
+rts
+L94: .data -35, -227
+cmp L101, #114
+jmp L73
+clr *r1
+L95: .string "qpepdpknbyokkkuuxkd"
+jsr L7
+L96: .data 131, 173, 386, -493, -730, -622
+L97: .data -140, 422, -844, -370, 408
+m2
+m2
+cmp #154, *r1
+mov #-189, L122
+prn #-127
+; comment
+m2
+rts
+L98: sub #-114, L7
+L99: red L109
+m4
+dec r2
+m4
+not *r1
+
+L100: jsr L25
+bne L33
+jsr *r5
+jsr L74
+not L121
+m3
+mov r0, L122
+
+L101: sub L122, L113
+; comment
+red *r4
+L102: bne *r7
+m2
+L103: stop
+; comment
+L104: .data -70, 585, -614, -231, 79, 822, 274, 482
+bne L111
+; comment
+m3
+red *r2
+L105: .data -200
+m1
+m1
+m1
+lea L116, r4
+not *r5
+L106: inc r5
+jmp *r2
+L107: cmp r5, *r5
+rts
+L108: .string "rhckvfuypikrjldvwc"
+bne L16
+sub L58, r0
+bne L118
+
+bne *r3
+jsr *r4
+sub r5, r7
+m2
+lea L95, *r1
+lea L118, L118
+dec L115
+stop
+dec r4
+jmp *r3
+m4
+prn r5
+bne L117
+sub *r5, *r2
+m0
+L109: .data -228
+sub r0, r5
+
+sub *r5, *r0
+sub r5, *r7
+inc L115
+rts
+add L115, *r2
+L110: sub r6, L77
+mov #-163, r2
+lea L102, r7
+prn *r0
+L111: clr r5
+L112: .string "anjjwpolhqteourrnbduubgn"
+bne L69
+bne *r6
+L113: .string "psnavpdzagomhzmbjjhyhysk"
+; comment
+m0
+lea L68, *r1
+m1
+L114: jsr L18
+L115: rts
+stop
+m0
+prn *r1
+mov *r2, *r0
+inc *r6
+mov #69, L36
+L116: inc L122
+red *r0
+prn *r6
+m3
+cmp L119, #151
+L117: .data -657, 689, 483, -464, -572, 226, -659, 569
+rts
+sub #0, r7
+L118: .data 865, -32, -388, -809
+m1
+sub r6, *r4
+m3
+L119: .data 669, -295, -865, 555, -851, 285
+stop
+
+stop
+jmp L13
+; comment
+clr L120
+m1
+L120: .data 17, 502, 694
+m4
+add #-36, L122
+stop
+L121: clr r6
+inc *r7
+bne *r7
+dec *r6
+L122: .string "yovtpjdzkkmvgdgqcswky"
+not *r4
+jsr *r0
+stop
@@ -0,0 +1,570 @@
+; Generated by genCorpus --seed 99
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+macr m0
+    add r1, *r5
+    sub *r1, r2
+    jsr L56
+    inc r5
+    jmp L13
+    bne L21
+    mov L49, L86
+    not *r2
+    cmp L51, *r6
+    dec L37
+endmacr
+macr m1
+    prn r5
+    lea L86, L54
+    clr L24
+    stop
+    sub L120, L28
+    stop
+    sub L1, *r2
+    sub #-136, *r5
+    cmp #41, L24
+    lea L15, r1
+endmacr
+macr m2
+    red *r2
+    inc L108
+    jmp L117
+    lea L94, L94
+    mov #-41, *r7
+    cmp *r1, L107
+    add L55, r6
+    bne *r6
+    red L35
+    jsr L41
+endmacr
+macr m3
+    inc *r6
+    red L65
+    add *r2, L11
+    cmp *r4, L53
+    rts
+    jsr *r4
+    not r6
+    prn L35
+    cmp *r6, L62
+    red r7
+endmacr
+macr m4
+    inc *r3
+    cmp *r3, *r3
+    mov r4, L102
+    add L95, L108
+    clr r7
+    rts
+    jmp *r0
+    jmp L36
+    red *r3
+    inc r6
+endmacr
+L0: jmp *r4
+bne L0
+L1: prn #50
+bne *r6
+jmp *r4
+L2: prn r1
+jsr *r2
+; comment
+L3: .data 343, 971, -116, -178, 226
+L4: bne *r3
+L5: add r4, *r2
+stop
+m2
+L6: cmp r5, r4
+clr L102
+bne *r1
+m0
+L7: .string "xswrhdqk"
+mov r3, r7
+jsr L58
+
+sub #27, L5
+m4
+L8: .data 454
+L9: stop
+clr *r3
+; comment
+L10: .string "jjb"
+m0
+dec *r3
+clr L108
+red L1
+add L8, r2
+dec r4
+m4
+
+m2
+inc r5
+m4
+clr r5
+
+sub r0, L4
+inc r0
+bne *r7
+L11: stop
+L12: inc r0
+mov *r0, *r6
+L13: not *r2
+bne L34
+L14: cmp #20, *r2
+L15: red r7
+rts
+jmp L118
+
+not L10
+jsr L42
+L16: .string "wlhsh"
+add L32, r7
+; comment
+L17: cmp #62, L93
+m1
+L18: red *r4
+m2
+prn r3
+; comment
+m4
+m0
+jsr *r1
+m1
+sub *r4, r0
+mov L1, *r4
+m1
+dec *r5
+m1
+lea L4, r1
+L19: .string "tizpvob"
+m2
+not r1
+L20: clr *r7
+L21: .data -275, 603, 101, -474, -116, 707, 973, -779
+m2
+clr *r1
+dec r0
+sub #-176, L55
+clr L75
+L22: red L19
+jmp *r6
+
+stop
+L23: sub *r1, *r3
+prn r3
+inc L12
+lea L18, r4
+; comment
+L24: dec L2
+L25: .string "svhu"
+sub *r0, r0
+L26: jmp L115
+m4
+L27: cmp r1, *r4
+prn #100
+inc r7
+dec *r4
+prn *r2
+not r1
+m2
+L28: .string "glbpckfqkqdgekpjqv"
+m1
+jsr *r0
+inc r1
+m3
+inc r0
+dec r4
+stop
+; comment
+red L11
+prn #-85
+red *r2
+L29: sub *r7, L101
+bne *r1
+
+add #134, r2
+L30: rts
+clr *r6
+sub #-183, L54
+L31: .data 783, 613, -915, 382, -501
+rts
+red L76
+not *r1
+L32: cmp r7, r7
+jsr L14
+inc *r4
+jmp L47
+not L68
+m0
+L33: .string "hghhhj"
+cmp r3, *r1
+prn #-43
+clr r7
+m2
+jmp *r1
+L34: jmp L95
+stop
+red r6
+L35: jsr *r6
+sub *r0, r2
+L36: .string "jgtlbxh"
+m3
+cmp *r7, r4
+; comment
+not r6
+sub L10, r5
+cmp r6, r1
+L37: .string "mvznmmnly"
+bne L80
+rts
+red r1
+m0
+jmp *r1
+inc r1
+L38: .string "culprhz"
+inc r6
+L39: .data -395, 183, -917, 534, 534, -430, 875, 242
+jmp L57
+L40: inc r1
+
+stop
+sub r0, r6
+L41: sub *r3, *r5
+dec L116
+L42: .string "uwfcfyczndlcvccrarvqwspl"
+m1
+jmp L34
+mov r0, *r1
+L43: inc L44
+m1
+m4
+mov L20, r5
+inc *r1
+m4
+L44: .string "txcyimnsfgqmwvndaodulp"
+prn L38
+L45: .string "makijxeixqfmvsudlk"
+clr r5
+mov *r5, r5
+
+L46: .data 429
+dec r6
+add r5, *r3
+m1
+m1
+clr L103
+cmp r2, #-39
+prn #-65
+m1
+L47: .data 202, -90, 634, -336, -561
+m0
+rts
+jmp L110
+mov r5, L72
+L48: .data 627, -259, 585, 89, 304, 287, -541
+prn L52
+dec r1
+L49: red L45
+not L61
+prn L29
+L50: .data -917, 184
+m2
+cmp *r2, r1
+lea L40, r1
+L51: .data 654, 947, -1000, 13
+jsr *r5
+not L43
+m0
+m2
+m3
+dec L10
+m1
+cmp L18, L102
+L52: .string "wiqdu"
+L53: .string "jqusurrmbariegriyguu"
+rts
+
+cmp *r1, *r3
+bne L59
+m3
+prn L7
+add L108, L21
+m1
+m2
+L54: .string "qgewrtjiptyjnhpadgd"
+L55: .string "nqgdbnnrqajisnxvjbwomvb"
+L56: rts
+m4
+m0
+m0
+L57: .string "pxhigk"
+lea L6, L32
+m2
+red r4
+rts
+dec r6
+m2
+not *r0
+L58: dec *r3
+L59: .string "dtjhlrcuxnoxw"
+bne *r6
+bne L18
+m2
+dec L69
+rts
+L60: not r3
+m4
+not r4
+mov #71, L89
+not r2
+inc r0
+L61: .data -537, -52, -307, 238, 615, 564, 135, 187
+m3
+m2
+inc L50
+m0
+prn *r3
+sub #212, *r2
+L62: .data -427, -501, -345
+bne *r1
+clr r7
+L63: .data -149, 293, -543, -990, -862, -56
+L64: .data -237, 747, 330
+prn #-23
+sub *r2, *r7
+sub r7, *r3
+rts
+lea L113, r7
+; comment
+lea L14, L87
+inc *r5
+L65: cmp L108, L106
+mov r0, L90
+L66: bne *r7
+lea L27, L32
+mov *r3, L105
+prn L65
+mov #182, *r4
+not r3
+; comment
+dec L47
+m1
+inc L104
+L67: inc L95
+lea L75, r1
+m1
+not *r3
+lea L28, *r5
+dec r5
+rts
+sub *r0, *r0
+prn L102
+cmp L34, L53
+L68: sub *r0, L14
+rts
+L69: red r0
+clr r2
+jmp *r2
+L70: .data -913
+jsr *r4
+L71: .string "byhnppsafwxwusixh"
+mov L97, r4
+rts
+rts
+L72: .string "hqorcp"
+dec r5
+L73: .string "zietunpbegbtfmdkmosn"
+m0
+m2
+not L88
+; comment
+L74: .string "swdzqmzuzsqywqtsrd"
+clr L62
+clr L116
+L75: bne *r4
+not *r4
+inc r5
+L76: red *r3
+L77: .data -900, 928, -400, 378, -555
+dec L121
+m3
+L78: .string "lgvftmduvvmlxhypurulxosw"
+L79: red *r6
+; comment
+L80: lea L19, L5
+L81: rts
+mov *r4, L37
+m1
+sub L21, r4
+L82: .data 460, 134, 643, -396, -539, -595
+clr r6
+m4
+cmp L85, L17
+clr *r3
+dec L59
+stop
+rts
+not L116
+jmp *r0
+jmp L111
+add #-249, r1
+L83: inc L86
+cmp L26, L46
+mov r0, r7
+bne *r0
+L84: .string "tdfjfvkredzeuiyorkuvtz"
+clr r4
+mov *r5, *r6
+bne *r7
+add r0, *r1
+mov #0, *r2
+bne L95
+L85: jmp *r5
+jsr L102
+add r7, r1
+; comment
+L86: jsr L105
+red L104
+L87: clr L114
+L88: .data -482, 572, 447, 160, 655, -675, 727, 774
+jsr *r0
+clr *r5
+dec r0
+add r0, *r6
+stop
+dec r1
+L89: prn *r6
+m1
+inc r0
+L90: .string "cmkt"
+m2
+jsr L119
+prn L13
+m1
+rts
+not *r6
+lea L120, *r5
+L91: red r5
+m4
+m2
+sub r4, *r5
+m0
+L92: add #-222, *r5
+m1
+prn #53
+m2
+lea L115, *r4
+L93: not L102
+L94: jmp L30
+jsr *r3
+dec r7
+cmp *r0, *r0
+L95: prn L121
+mov L119, *r6
+; comment
+L96: .data -318
+L97: .data 113, 384
+rts
+m4
+rts
+m2
+sub r6, *r7
+m1
+add L36, *r4
+m3
+sub L78, *r7
+prn L85
+m1
+add L119, r1
+m1
+not *r6
+cmp #-75, L106
+clr r3
+L98: not *r5
+mov L110, L7
+jmp *r1
+
+not *r4
+m0
+lea L61, *r0
+L99: stop
+L100: lea L13, L118
+L101: bne L87
+add r7, r6
+L102: not r1
+m2
+m0
+lea L115, L114
+red *r5
+cmp r6, r6
+L103: clr r3
+inc *r5
+red *r6
+clr r4
+stop
+sub *r1, L108
+L104: .data 606, -232, -581
+L105: .string "rtoxhdgxxxqrkg"
+L106: red L111
+sub *r6, L115
+stop
+cmp #-111, r5
+m0
+; comment
+dec r5
+m2
+sub L111, r6
+L107: red r2
+; comment
+mov *r3, *r5
+L108: not L67
+L109: .data 991, -302, 996, -673, -900, 700
+mov L110, *r7
+clr *r3
+m2
+sub r3, *r5
+m0
+sub r4, L111
+L110: jmp *r4
+L111: inc r3
+jmp L121
+red r3
+lea L121, r2
+L112: jmp *r2
+L113: jsr L118
+L114: add L98, L121
+L115: .string "phebvahxigvkuikmtth"
+bne *r4
+add r6, r6
+not L120
+; comment
+L116: .string "ofwsv"
+m4
+L117: inc *r1
+dec r3
+jmp *r6
+sub #-138, L45
+L118: rts
+jsr *r6
+not r3
+add *r5, r6
+cmp *r6, #112
+sub r7, L86
+L119: cmp *r5, r5
+red *r3
+rts
+lea L14, *r6
+sub *r2, L120
+red *r6
+dec *r5
+L120: inc r5
+L121: red L2
+sub #-50, r1
+jmp L57
+stop
@@ -0,0 +1,569 @@
+; Generated by genCorpus --seed 100
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+macr m0
+    not *r6
+    add r6, r3
+    dec r0
+    mov #-39, *r3
+    prn L22
+    clr *r4
+    red L61
+    cmp *r1, L1
+    prn #109
+    red *r0
+endmacr
+macr m1
+    cmp *r7, L42
+    red r5
+    inc *r5
+    lea L12, L100
+    inc L85
+    jmp *r2
+    inc *r2
+    mov L72, r3
+    clr r5
+    sub #54, L39
+endmacr
+macr m2
+    red L80
+    clr *r5
+    bne L44
+    prn *r7
+    bne *r0
+    dec r1
+    cmp L64, r6
+    rts
+    jmp L102
+    jsr *r0
+endmacr
+macr m3
+    rts
+    prn *r0
+    prn L87
+    add r2, r2
+    mov L59, r4
+    cmp L22, r6
+    inc *r5
+    red L41
+    bne *r6
+    sub *r5, L38
+endmacr
+macr m4
+    sub L60, L22
+    clr r7
+    stop
+    not r1
+    clr L9
+    not *r7
+    mov r0, r3
+    inc *r3
+    add L15, *r0
+    lea L8, L78
+endmacr
+stop
+L0: inc r4
+add L0, L18
+L1: bne *r3
+stop
+L2: sub r6, L12
+not *r7
+rts
+clr L1
+bne L31
+L3: sub *r2, *r2
+m4
+m0
+L4: add r3, L87
+add L4, *r5
+bne L8
+stop
+L5: .string "jtcgtbtta"
+dec L4
+L6: dec L58
+red r0
+stop
+jmp *r5
+L7: jsr L64
+L8: .string "hvopbwmys"
+L9: .data -389, 986, 889
+L10: .data -739, 269, 572, -89, -989
+bne *r6
+L11: .string "rsifiukbwzuoyuz"
+jmp *r7
+m0
+bne *r7
+mov L31, L9
+bne *r3
+rts
+add L6, r7
+cmp L7, *r2
+rts
+L12: inc *r2
+not r4
+rts
+
+red *r2
+jsr L22
+mov r1, r7
+m1
+m4
+L13: .data -793, -224, 368, -356, -16, 716
+m0
+L14: .data -445, 709, 666, 895, 317, -363
+jmp L4
+bne L9
+m0
+bne *r5
+m0
+inc *r6
+jmp L9
+L15: .string "tbwnwjlzoqunomdd"
+m0
+m4
+sub L95, L9
+L16: dec *r3
+red L3
+cmp *r2, L0
+m1
+L17: .string "huxamilkbtslr"
+bne L17
+clr L26
+; comment
+lea L8, L33
+; comment
+jsr L67
+L18: .string "kpshqizojnnjbxrbxygsrqj"
+L19: .data -430, -971, -468, 54, -458, 837
+red r2
+m0
+prn #-18
+not r2
+stop
+red L16
+red r1
+mov L7, L93
+; comment
+L20: add *r2, *r5
+m1
+L21: .data -53, 486, 939, -541, 911, -515, 326
+L22: dec *r3
+bne *r4
+inc *r1
+L23: .string "vyxletihuxesubjnd"
+L24: bne L21
+jmp *r5
+L25: prn L84
+jsr *r5
+m0
+m4
+stop
+L26: sub L54, r3
+; comment
+bne *r5
+cmp r0, r3
+m1
+m3
+red *r6
+; comment
+red *r7
+dec L81
+prn L22
+red L31
+clr *r0
+dec r4
+jsr L50
+m3
+not L67
+L27: .data 852, -47, -682
+dec r4
+; comment
+L28: .data -921, -723, 945, 632, 163, 718, 947, 78
+m3
+L29: .data -81, 426, 259, 420
+L30: .data -635, -172, 696, -435, -534, -873, -165
+m2
+m2
+m4
+rts
+m0
+mov L9, *r1
+L31: jsr L12
+; comment
+L32: red r2
+L33: .string "rlhytobgexgzpoegggogis"
+L34: .string "umsrltrvjnxlyesomcdghbci"
+m3
+stop
+add L3, *r7
+jmp *r0
+lea L69, L8
+inc L79
+L35: clr L23
+mov *r2, L65
+m1
+lea L38, r3
+stop
+m2
+sub r2, *r4
+L36: .string "yjf"
+; comment
+
+not *r3
+stop
+red *r2
+m0
+dec r3
+m3
+m1
+red L45
+L37: .data 289, -856, -919
+m4
+m0
+inc r4
+lea L37, L53
+cmp #-110, *r1
+m1
+L38: .string "nxdafojof"
+sub #149, r5
+cmp #129, *r5
+L39: sub #-67, r1
+inc r1
+stop
+L40: .string "smximrafztxdbgbbtbqi"
+; comment
+sub *r4, r5
+red L56
+
+m4
+jmp *r0
+L41: .data -607, -163, 96, -91, 630, 886, 902, 443
+dec *r5
+add *r3, *r7
+jmp L68
+rts
+mov L32, r0
+m4
+mov *r4, L8
+L42: prn r7
+not L49
+mov *r2, *r0
+m2
+L43: .data 485
+m2
+dec *r1
+prn r7
+m0
+L44: mov *r6, L19
+stop
+red L5
+not L6
+jmp L84
+m0
+clr *r5
+m2
+not *r7
+m2
+lea L51, *r3
+jsr L34
+
+m0
+cmp r7, #247
+m4
+L45: .string "esvspaeyqsfawme"
+red L95
+dec *r5
+L46: lea L76, r3
+m1
+m4
+inc *r2
+rts
+m2
+m3
+clr r6
+red r5
+m1
+prn #29
+cmp #-165, r5
+mov r4, r6
+clr L59
+mov r1, L7
+dec *r7
+add *r6, r4
+m4
+inc r3
+m3
+stop
+not r2
+dec *r3
+jmp *r4
+inc L5
+mov r0, L80
+m1
+inc L40
+not L63
+sub #245, L95
+sub r0, L47
+jmp *r0
+; comment
+L47: mov *r1, L98
+; comment
+; comment
+m1
+red r0
+add #-170, *r4
+clr L11
+red r6
+L48: cmp L30, L35
+jmp L36
+add *r0, r5
+jmp *r4
+stop
+not r7
+; comment
+cmp #119, r4
+sub *r0, r2
+lea L95, r4
+L49: stop
+prn r5
+m3
+m2
+mov r4, *r2
+jsr L13
+add L33, L30
+L50: .string "yjakiuwrsoj"
+m2
+
+L51: stop
+lea L55, *r5
+m0
+cmp L42, L74
+red *r3
+prn r6
+cmp r5, L75
+cmp L37, *r3
+red L17
+dec *r2
+m2
+dec *r6
+L52: jmp *r2
+jmp *r1
+L53: .string "a"
+
+L54: cmp #-71, #140
+jsr L75
+add *r1, L26
+prn #159
+L55: .data -247
+jsr L65
+clr L67
+m4
+stop
+rts
+bne *r3
+not r6
+sub #14, L53
+add #-43, r0
+lea L94, *r3
+clr r4
+
+mov #-161, r1
+bne *r3
+L56: add r3, r1
+lea L79, *r3
+clr r4
+L57: .string "twuzaxjkoinmfjwtskylt"
+L58: dec *r5
+L59: .data 270, 909
+L60: .string "ekrwdizjhjdnivtle"
+add *r4, L78
+m0
+mov *r6, *r6
+L61: jmp L74
+L62: not r6
+add r1, L97
+rts
+L63: .string "qjezfnpifzixlmwpkxaw"
+L64: jsr *r4
+add L91, L23
+m3
+stop
+add #91, L94
+m4
+red *r6
+m4
+rts
+
+inc L95
+m2
+m2
+prn r6
+
+sub r4, r3
+L65: red L93
+jmp *r4
+m3
+L66: .string "iombkboznrhrvjel"
+add *r1, *r0
+m3
+not *r0
+jsr L35
+; comment
+L67: .string "lccpogibvqmck"
+
+cmp #96, #-6
+inc r2
+red L69
+prn r0
+m3
+bne L90
+
+m1
+stop
+m1
+L68: clr r6
+add r7, L97
+prn L76
+L69: add L90, r2
+dec r6
+
+m1
+m3
+prn #181
+m3
+m4
+rts
+L70: .string "umhoeavdlz"
+rts
+cmp #16, #-202
+L71: .data 482
+m4
+prn #-29
+L72: bne L16
+mov L3, L93
+dec L6
+mov r7, L65
+red *r5
+dec r4
+stop
+dec r6
+cmp #-104, #-147
+red r5
+m1
+L73: not *r3
+rts
+rts
+m4
+L74: mov *r0, *r3
+mov *r7, L90
+mov L98, L97
+inc L6
+rts
+jsr *r1
+L75: .string "hudisoltdhltffpnk"
+
+L76: .data -443
+not *r5
+m2
+; comment
+L77: .string "oeao"
+lea L98, r3
+bne L58
+L78: bne L52
+lea L40, L21
+clr r4
+lea L101, r0
+not r2
+prn *r2
+mov *r0, *r6
+stop
+L79: mov L96, r3
+m4
+jsr *r1
+jmp L92
+m4
+cmp r1, r6
+inc r4
+red *r6
+L80: .string "nuuckbmwqetrpwbkxtammyc"
+L81: jmp *r6
+m3
+clr *r1
+add #-29, r2
+bne *r7
+m1
+sub L77, L101
+mov #-157, L4
+add r1, *r7
+L82: sub *r0, r3
+prn #251
+red r0
+add #-203, L80
+stop
+
+not *r6
+L83: .data -82, -310, 711, -566, 898, 707
+jmp L0
+sub r1, r7
+m0
+L84: .data -352, 286, 783
+clr *r6
+L85: rts
+sub #-187, *r0
+red L101
+L86: sub L84, *r3
+m1
+not r7
+m2
+L87: stop
+add #35, L100
+bne L102
+L88: mov #51, *r4
+prn r5
+; comment
+L89: .data 168, 982, -440, -680, -980, 304, -775, 239
+prn L18
+m1
+not *r5
+L90: .string "maujeexd"
+sub *r2, *r2
+m1
+m4
+jmp L100
+L91: mov *r1, r7
+bne *r3
+prn #-178
+L92: add #220, r7
+m4
+prn L35
+m4
+L93: .string "jymozcnsnzmvrrrzpo"
+prn r7
+prn *r2
+prn #241
+cmp r1, *r3
+m1
+L94: .data -539, 467, -641, 798, 425, -660, 142, 856
+L95: stop
+L96: not *r4
+; comment
+L97: mov L62, L26
+not L25
+inc r0
+L98: rts
+jsr *r2
+L99: add *r2, *r7
+mov #-57, L46
+L100: .data 330, -630, -519, 192, -174, 398
+red r6
+m1
+L101: .string "bvmpzuamaegw"
+L102: .data -827
+rts
+rts
+stop
@@ -0,0 +1,511 @@
+; Generated by genCorpus --seed 1
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+rts
+L0: bne L0
+stop
+mov r7, r5
+jmp L0
+stop
+L1: jmp L0
+not L111
+dec L21
+bne L0
+
+bne *r0
+L2: .string "avwzecopxaoehphpfwjpl"
+L3: bne *r2
+add r4, *r5
+L4: lea L63, L4
+jmp *r4
+rts
+clr *r0
+add L3, L1
+jsr *r7
+L5: .string "mcybaffmwzmhmpj"
+jsr *r5
+bne L65
+rts
+bne L4
+not r0
+lea L66, *r3
+L6: .string "cjwexkkpxjlwp"
+L7: bne L4
+rts
+sub L25, *r5
+L8: .data 442, -179, -904, -831, -119, -76, -767
+red *r1
+stop
+L9: prn *r0
+add r2, L56
+red r3
+cmp r6, r2
+rts
+lea L1, r7
+L10: inc r5
+clr L9
+L11: rts
+stop
+bne L7
+jsr *r1
+sub *r1, *r0
+L12: rts
+L13: red L128
+inc *r1
+L14: .string "xezjk"
+inc L8
+sub *r0, *r1
+sub L81, *r2
+stop
+prn r3
+cmp r6, #61
+L15: inc *r5
+L16: cmp r7, r7
+jsr L125
+clr *r3
+; comment
+mov *r3, r5
+L17: cmp *r6, *r5
+jsr L86
+stop
+L18: jsr *r1
+L19: bne *r0
+L20: stop
+not r0
+sub L121, *r0
+L21: .data -633, 113, -198
+red *r7
+jmp L43
+L22: jsr L106
+L23: lea L74, L135
+L24: .data 475, 228, 665
+add *r0, L23
+stop
+sub *r0, *r5
+inc r0
+jmp L2
+L25: .string "vqfpst"
+sub *r3, L110
+prn *r5
+rts
+mov r7, r6
+red L78
+rts
+inc *r7
+jsr L45
+L26: mov r2, r4
+jsr *r3
+rts
+red *r1
+L27: .data 975, 248, 388, -106, 569, 38, -463, 325
+L28: jsr *r0
+jsr *r6
+; comment
+L29: dec *r2
+L30: .data 987, -172, 494, 386, -357, -845, -494
+add r2, *r3
+jsr *r6
+lea L13, *r0
+prn *r3
+inc L111
+stop
+jsr *r5
+L31: add #190, L0
+jmp L27
+mov r4, r1
+L32: not r1
+sub L112, L9
+inc *r0
+jsr L68
+jsr *r5
+sub r4, *r2
+clr r0
+rts
+L33: cmp r5, r0
+L34: .string "eixeigmsoepf"
+jmp *r0
+add r2, L10
+add #109, *r5
+prn L93
+L35: red r5
+jsr L56
+dec L31
+inc L14
+inc L30
+jmp *r5
+mov #-67, *r3
+
+red *r1
+L36: add #-86, *r1
+stop
+mov L25, L95
+sub L73, r1
+rts
+L37: clr r2
+L38: .string "seuatvzhdztoiaucygsagt"
+stop
+clr r7
+prn #77
+L39: inc L31
+dec *r1
+stop
+cmp L104, *r3
+L40: .string "virtty"
+L41: jsr L30
+sub #151, L39
+L42: cmp #198, r6
+not *r0
+sub #249, L64
+not L86
+
+jsr *r1
+jmp *r6
+L43: lea L68, r5
+inc r0
+L44: .data 666, 221, -929, -293, 762, -350
+add r3, *r3
+lea L37, L5
+sub *r2, r7
+mov *r3, L42
+bne *r7
+; comment
+jsr L58
+L45: .string "bdyjsgvsiki"
+inc L85
+clr L112
+cmp #-147, r5
+prn r0
+dec *r0
+L46: bne L10
+sub L123, r3
+add r6, *r6
+L47: .string "g"
+dec r7
+L48: inc r4
+rts
+clr r7
+; comment
+red *r3
+L49: bne *r1
+L50: prn *r5
+clr *r5
+inc r0
+L51: stop
+jsr L43
+jmp *r1
+L52: .data -706
+stop
+bne L109
+cmp #-178, r4
+inc *r4
+L53: cmp r2, *r4
+dec r1
+L54: .data 408, 413, 686, 841, 837, -182, -536, -638
+red L84
+L55: dec L126
+jsr *r7
+bne *r1
+mov L15, r5
+sub *r1, *r0
+
+L56: not L56
+lea L51, r6
+sub *r5, r0
+prn #-221
+add L19, r6
+inc L127
+L57: .data -914, -926, 191, -623
+L58: .data 974, 394
+L59: .string "clrpqfkthefmxqyvusble"
+mov *r6, r0
+
+inc *r4
+jsr L32
+; comment
+mov *r5, L46
+; comment
+inc r1
+cmp #-179, L100
+dec r5
+L60: add r5, r5
+stop
+cmp #143, #5
+L61: jmp *r0
+bne *r6
+jsr L55
+lea L89, *r0
+; comment
+bne L61
+add r1, L81
+red L129
+mov r3, *r6
+jsr *r1
+
+sub *r3, r7
+sub r6, r2
+L62: clr *r4
+add r5, L33
+L63: .data 919, -192
+bne L131
+dec L24
+jmp *r1
+; comment
+not L110
+inc L25
+L64: jsr L105
+L65: red r7
+L66: .string "trxnkrbompxqatcokt"
+mov L135, r1
+red *r5
+stop
+mov #129, *r6
+L67: .data 916, 890, 835, 65
+cmp r4, *r1
+jsr *r7
+jmp L119
+red r1
+bne L50
+L68: stop
+stop
+dec L88
+sub *r0, *r1
+jsr L128
+L69: lea L52, r7
+jmp *r4
+L70: .data 510, -858
+add r7, r3
+L71: bne *r1
+lea L1, L71
+L72: cmp L47, r3
+red r1
+cmp r0, L64
+red r5
+cmp L58, *r3
+jsr *r2
+stop
+rts
+dec *r6
+lea L134, *r6
+red L43
+L73: rts
+prn *r1
+L74: inc *r6
+not L42
+bne L77
+prn #-79
+not L87
+cmp r4, #172
+bne *r6
+jmp L21
+mov L102, L77
+L75: jmp *r7
+inc r3
+clr L128
+red *r7
+cmp L46, r5
+L76: inc L105
+L77: rts
+clr r7
+
+red L112
+L78: rts
+mov r4, r4
+; comment
+L79: .string "otapmatndzynsjxxgdnoypg"
+bne L31
+inc L123
+L80: stop
+inc r4
+jmp *r1
+clr r7
+not *r4
+sub r1, *r4
+L81: prn *r2
+not L83
+bne L53
+cmp L9, L78
+jsr L15
+L82: dec r3
+inc r6
+red L121
+rts
+mov L25, *r4
+stop
+L83: bne *r4
+; comment
+L84: .data 767, 254, -583, 281, 137, -236
+sub #107, r3
+cmp *r2, *r5
+bne L43
+not r6
+L85: rts
+L86: not *r0
+inc L115
+rts
+sub r7, *r3
+bne L108
+jsr L75
+L87: stop
+L88: prn r1
+L89: .string "lubwrmekraij"
+L90: .string "yktabwycouglxdfqblmmgt"
+prn r1
+L91: rts
+cmp r4, #153
+jmp *r6
+rts
+L92: stop
+red r0
+rts
+cmp r1, *r3
+jsr *r2
+mov *r4, L43
+; comment
+L93: red r0
+L94: .string "sbdnnhsxxvecpjapfzgm"
+add #-32, *r4
+L95: .string "cuhjifmdrtkhzytdm"
+L96: prn #55
+clr *r3
+sub *r0, r2
+prn r2
+red *r2
+L97: .string "eqqmkbhddjik"
+sub #-185, L20
+L98: .string "pjufi"
+mov r0, r6
+stop
+L99: .data -514, 801
+bne *r3
+L100: .data -798, -810, -443
+L101: clr L12
+prn #-92
+jsr L81
+cmp L129, #-189
+L102: not r6
+L103: .data -639, -406, 831, -300, 847, -82
+L104: red L116
+prn #122
+inc L125
+add *r4, L36
+clr L114
+rts
+mov L117, L127
+not *r3
+dec L100
+L105: bne *r1
+add *r1, L127
+L106: mov r4, *r5
+bne *r0
+L107: mov r7, L129
+L108: not *r1
+L109: .data -821, -528, -904, -422, 204, 65, 254, -614
+stop
+bne *r4
+rts
+inc L51
+add L120, *r5
+L110: dec L114
+L111: mov r0, r5
+not L73
+cmp #20, #37
+stop
+L112: .data -931, 141
+L113: .data -92
+prn #-230
+dec r3
+add L134, *r4
+add L129, L68
+L114: inc *r5
+L115: mov r7, r1
+inc *r1
+L116: bne L18
+L117: .string "elaihhwk"
+lea L39, r7
+mov r4, *r0
+prn L122
+bne L125
+rts
+prn #70
+stop
+rts
+bne L127
+dec *r3
+bne L19
+L118: jmp L33
+L119: clr r3
+rts
+prn r1
+stop
+lea L67, r3
+L120: bne *r6
+not *r5
+L121: bne *r3
+jmp L122
+add r0, r7
+clr L42
+lea L51, r7
+L122: .data -399, 325, -103, 662, -274, 465, -383
+jsr *r5
+inc L134
+prn r1
+L123: clr *r5
+jmp *r3
+prn #242
+bne L128
+inc r2
+; comment
+jsr *r4
+inc *r0
+sub L48, L138
+L124: .data 890, -123
+L125: .data 483, 482, 716, -847, -652, -477, 575
+bne L62
+prn L132
+jmp L56
+L126: .string "gn"
+L127: dec L95
+mov #128, r1
+L128: .string "e"
+
+rts
+L129: rts
+
+L130: dec L57
+L131: bne *r2
+mov *r0, L114
+not r7
+not *r6
+add r6, L132
+not *r0
+L132: mov *r1, *r5
+jsr *r4
+stop
+prn L136
+L133: sub r7, r4
+jmp L78
+jmp L121
+add L121, L30
+; comment
+L134: .data -490
+
+inc L138
+inc *r2
+L135: rts
+add r3, r1
+add L139, r2
+stop
+prn *r4
+L136: mov #245, L139
+L137: clr *r3
+L138: .string "xrstwemvegxccdv"
+clr L105
+L139: prn r1
+stop
@@ -0,0 +1,511 @@
+; Generated by genCorpus --seed 2
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+jmp *r4
+not r0
+bne *r7
+cmp L72, #-146
+bne L5
+jsr *r7
+stop
+L0: jsr L84
+mov *r7, *r7
+clr r6
+red r5
+jsr *r5
+red r6
+lea L0, r5
+jsr *r3
+mov #64, *r1
+L1: mov *r6, L111
+; comment
+L2: .data -797, -73, -770
+not *r5
+sub #84, *r2
+L3: .string "kmlmsm"
+lea L4, *r4
+L4: .data 235, -304, -28
+dec *r4
+L5: inc r7
+L6: mov L2, L3
+L7: add r6, *r3
+L8: inc r0
+jsr L4
+prn L51
+inc r4
+jsr L6
+jsr L6
+L9: clr r7
+; comment
+sub #-218, r6
+L10: stop
+lea L8, L8
+dec L124
+lea L52, *r1
+sub #-139, L98
+L11: stop
+L12: .data 303, 785, -418, -557, -992, -467, -617
+lea L2, r1
+bne L115
+rts
+stop
+rts
+stop
+L13: .data -216, -920
+red L33
+; comment
+inc r4
+stop
+L14: stop
+bne L14
+mov #-110, r1
+L15: clr *r1
+cmp #234, L4
+not *r4
+rts
+L16: dec L126
+jsr L2
+sub #33, r1
+L17: inc *r7
+red L15
+rts
+cmp r6, r7
+jmp *r0
+L18: jsr L40
+add r5, L9
+L19: cmp r1, #107
+rts
+L20: not *r0
+clr r0
+stop
+jsr *r1
+
+clr r7
+L21: jsr *r2
+L22: prn L66
+
+sub *r3, *r6
+rts
+L23: jmp L126
+not L6
+dec L72
+rts
+sub *r6, *r0
+red L128
+sub *r5, L12
+bne L14
+not L17
+L24: add *r2, *r6
+bne *r6
+L25: lea L4, r2
+inc r1
+; comment
+inc *r5
+not *r1
+L26: .string "kfcd"
+not L4
+L27: bne *r4
+L28: .data -593, -827, 560, -421, 682, 329, 609
+bne *r0
+add *r3, *r7
+mov L0, r7
+not *r7
+L29: .data 881
+add *r7, *r5
+L30: .string "uwjvvs"
+cmp #-130, L129
+mov #90, r6
+L31: red r2
+sub *r3, *r6
+jmp *r1
+L32: .string "ovwuhlnn"
+jsr L1
+not *r2
+lea L40, r7
+red L92
+dec r3
+L33: dec L113
+not r7
+L34: .string "mthfwnbiphozmnrwm"
+add *r2, r1
+not *r0
+L35: mov L28, r6
+L36: not r4
+bne *r4
+L37: bne *r7
+L38: lea L36, L69
+L39: inc *r7
+cmp *r4, *r2
+bne *r0
+not L50
+clr r0
+clr L84
+jsr *r6
+lea L19, r7
+L40: .data 978, 699
+
+clr r7
+L41: not *r2
+mov r7, *r1
+stop
+not *r3
+rts
+add L14, L6
+mov r7, r2
+jsr *r5
+clr *r0
+dec L40
+stop
+sub r6, r5
+L42: cmp *r6, r4
+sub #93, r5
+rts
+mov L113, L38
+lea L96, *r2
+L43: inc r6
+not r7
+dec L104
+lea L46, L70
+prn *r1
+L44: add *r6, *r2
+add *r1, L42
+red *r4
+lea L71, r3
+L45: .string "bzmcbg"
+jmp *r7
+prn *r3
+L46: .string "qpdnwzx"
+stop
+sub r6, L53
+inc *r4
+add r2, L63
+dec L3
+jsr L20
+inc r5
+L47: jsr *r4
+add #99, L52
+jmp *r0
+prn *r0
+jmp *r2
+bne L26
+jmp L50
+cmp L90, r4
+clr *r7
+L48: dec L118
+L49: mov r2, *r4
+L50: .data -28, -477, 431
+inc L26
+jsr *r7
+red *r3
+clr *r6
+L51: sub #190, *r5
+L52: inc r7
+bne L30
+mov *r7, L23
+jmp *r3
+L53: rts
+jmp *r7
+stop
+L54: .data -189, -824, 818, -904, 652, -890
+jmp L3
+red r1
+lea L28, r7
+dec L5
+inc L95
+L55: .string "ujvsonwqbuwfu"
+prn L126
+rts
+
+add *r4, r2
+clr L120
+red *r7
+add #250, L55
+L56: .data -501, -854, -98, -512, 924, -92, 505
+L57: jsr L21
+L58: cmp #11, L18
+L59: add L42, r0
+clr L11
+dec *r4
+red *r6
+L60: .data 75, -443, -498, 266, 734, -139, -487
+prn L107
+jmp L34
+clr *r6
+rts
+stop
+sub *r1, r5
+L61: sub L104, r6
+inc r6
+red L35
+lea L20, *r7
+jmp *r7
+inc L81
+L62: red *r3
+jmp L85
+clr L85
+jsr L130
+clr L130
+L63: add #-129, *r7
+L64: clr *r1
+inc L28
+not r0
+lea L47, *r2
+red L70
+stop
+lea L73, L33
+red L56
+stop
+inc L20
+L65: .data -695, 345, 427, -334, -786, -63, -811, 647
+L66: .data -478, 139, -356, -648, -601, -536, -377
+add r7, L119
+rts
+L67: .string "cmnwbxznitpnlkydz"
+not L77
+rts
+sub *r3, *r3
+inc r5
+L68: clr L65
+inc L25
+red r4
+
+L69: jmp L123
+L70: inc r6
+L71: red r6
+L72: sub #-246, L0
+inc r3
+jmp *r5
+L73: red r1
+not L25
+L74: clr L95
+stop
+rts
+inc *r1
+inc *r7
+L75: red L37
+add #201, *r5
+stop
+add L115, r5
+jmp L113
+red r2
+L76: prn r0
+L77: .string "l"
+L78: .string "wedmmwntdoozciuzg"
+clr r2
+rts
+L79: .string "gs"
+cmp L122, r2
+L80: .string "imfdkkihgzvmogj"
+L81: .string "phyqrmesfip"
+clr r1
+clr L75
+sub *r6, L125
+stop
+add *r0, L113
+clr r4
+L82: mov #-150, r2
+L83: .data 437, -8, 950, 328, 736, -821, 590, 166
+dec L113
+rts
+clr *r1
+stop
+L84: jsr L123
+add #220, L94
+prn L37
+clr r6
+jmp *r7
+sub #-80, L122
+L85: .string "c"
+bne *r7
+L86: inc *r7
+jsr L119
+clr *r4
+L87: .data -958, -171, -798, -145, -607, 28, -660, 155
+inc r4
+lea L131, *r2
+
+L88: bne *r6
+L89: .data 36, -850, -540
+L90: clr r5
+rts
+jmp L111
+L91: .data 990, 411, -144, 848, 966, -161, -818, -275
+L92: lea L63, L50
+jmp L0
+bne *r1
+stop
+sub L114, r1
+clr *r3
+L93: prn #181
+jmp *r5
+L94: not r3
+mov L98, r7
+
+inc L112
+rts
+dec r6
+lea L130, r4
+lea L125, *r6
+
+add #-164, *r6
+lea L11, L126
+jmp L99
+sub L89, L121
+L95: dec *r1
+sub #14, r6
+L96: add L107, r1
+L97: prn r1
+jsr L107
+bne L88
+dec *r5
+jsr *r3
+dec r2
+jsr *r0
+rts
+clr r5
+L98: jmp *r2
+cmp *r0, L104
+jmp *r3
+clr *r1
+jsr L13
+jsr *r2
+jsr L20
+stop
+L99: rts
+cmp r1, r5
+jsr L123
+red r0
+L100: rts
+sub r6, *r7
+add L118, *r6
+mov r3, r3
+; comment
+not L101
+jsr L64
+L101: .string "lycidd"
+cmp r2, r4
+prn r1
+stop
+sub r7, *r0
+jmp L104
+
+jmp *r1
+red *r3
+L102: .data 990, -7, 607, -182
+mov *r4, *r4
+L103: bne *r1
+cmp #67, *r2
+rts
+rts
+lea L109, r7
+L104: .string "nzkjidg"
+rts
+add #-215, L123
+L105: .string "cyxwzpnpyaqh"
+dec r4
+
+prn r6
+inc L116
+L106: .string "yzscjmchsxw"
+L107: cmp #44, L63
+dec L111
+L108: .data 120, -749, 123, -371, -334
+L109: .data 279, -810, -294, 387, 804, -207, -489, -262
+lea L126, *r1
+lea L110, r5
+prn *r2
+not L122
+L110: sub L102, *r1
+L111: jsr *r7
+red L69
+lea L118, *r1
+not r7
+L112: cmp *r2, L98
+dec *r3
+red r6
+stop
+sub #-182, *r4
+red *r1
+mov L94, r6
+not r2
+L113: add *r0, r0
+clr *r0
+rts
+lea L116, *r2
+jmp *r3
+stop
+lea L50, *r6
+L114: inc r4
+jsr *r0
+L115: sub r6, *r5
+L116: .string "jgxtdnan"
+bne L118
+L117: sub *r4, r5
+rts
+jsr *r1
+stop
+rts
+L118: sub *r1, r1
+rts
+L119: .string "mly"
+L120: .string "kvgzemtyepqrbnpwsgrdt"
+mov r7, L87
+inc *r4
+bne *r4
+jmp *r3
+prn r4
+mov r6, *r0
+sub L30, r5
+stop
+prn r5
+not L129
+rts
+L121: cmp L62, r2
+dec r3
+stop
+L122: .data -563, 527, -948, -327, 622, -422, 220, 742
+prn #100
+prn L125
+red L126
+not *r5
+clr r7
+L123: cmp L66, #-182
+jsr *r3
+L124: .data -283, -908, -175, -406, 301
+not L5
+red *r7
+jsr *r5
+lea L129, L113
+dec L126
+lea L131, L96
+stop
+cmp r1, *r6
+L125: bne *r4
+mov r2, L131
+add #-44, r1
+L126: jmp L128
+L127: red r3
+dec L128
+sub *r7, *r0
+inc *r2
+add r3, r3
+jmp L129
+sub #-13, L23
+jsr *r5
+L128: inc r1
+rts
+L129: lea L23, r2
+red *r5
+mov L130, r2
+L130: .data 907, 881
+rts
+stop
+L131: .data 477, 65, -840, -512, -716, -22, -281, -967
+stop
@@ -0,0 +1,510 @@
+; Generated by genCorpus --seed 3
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+stop
+L0: .string "nhfkbcwahwegxvbt"
+clr r0
+bne L76
+stop
+L1: .data -233, 52, -711, -308, -104
+L2: .string "manvd"
+sub #107, r7
+jsr L41
+add r5, r5
+rts
+not L2
+mov *r1, *r6
+L3: prn L0
+; comment
+L4: .data -400, -51, -602, 633, 999
+
+cmp *r0, r6
+cmp *r3, *r2
+red L0
+rts
+lea L17, r7
+bne L105
+L5: prn #-39
+L6: .string "xj"
+prn L62
+jmp L5
+L7: stop
+not r3
+stop
+L8: not *r2
+L9: not L27
+jsr L3
+jsr L0
+dec r4
+prn r0
+cmp r6, #50
+clr *r7
+; comment
+dec *r0
+not L1
+rts
+not L50
+
+
+stop
+red r4
+clr *r7
+bne L19
+L10: .data 148, -782, -886
+
+lea L100, r3
+clr *r1
+L11: .string "fplmgorhscbwpiy"
+inc r0
+L12: .string "loxpyoutaiqonvpyciklhvlk"
+L13: mov *r5, L82
+; comment
+L14: jmp *r7
+L15: .string "izqqbrwanw"
+; comment
+L16: rts
+bne L83
+add #-106, L86
+jsr L3
+; comment
+not L19
+add *r1, r1
+L17: add *r3, *r1
+; comment
+jsr L13
+jmp L76
+inc L112
+red L10
+add *r6, *r2
+L18: .data -336, 886, -958
+mov L18, *r1
+red r5
+L19: .string "yckxbmqz"
+lea L23, *r4
+dec *r4
+add #174, L0
+bne *r6
+prn L113
+prn *r5
+L20: .data -956
+; comment
+; comment
+clr *r5
+L21: cmp L9, L31
+rts
+add r0, L114
+stop
+L22: red *r1
+L23: red r2
+L24: .string "zpgjwtglfv"
+mov r4, *r2
+stop
+rts
+L25: rts
+; comment
+dec r6
+lea L86, r5
+sub r3, *r1
+
+bne L8
+lea L14, *r5
+jmp L44
+jmp L3
+; comment
+L26: clr *r6
+dec r5
+jmp *r0
+stop
+cmp *r2, #-64
+dec *r3
+add *r2, r6
+
+lea L14, r1
+prn #-38
+rts
+add *r2, r1
+L27: .data 737, 657, -43, -886, -771
+jmp *r4
+add #-128, *r4
+L28: .string "fhpszvajxushiurmvhukkh"
+lea L97, *r0
+cmp #-105, *r0
+dec r7
+clr L1
+sub L69, *r1
+L29: inc L19
+add *r4, *r5
+L30: .data 857, -196, 999
+lea L14, *r5
+rts
+jmp L4
+add L35, L14
+not *r3
+clr r2
+bne L42
+; comment
+L31: lea L6, L2
+clr *r2
+stop
+L32: .data -758, -529, -749, -32, 629
+dec *r2
+L33: .string "bhk"
+sub L21, *r1
+rts
+prn r6
+prn #-50
+rts
+L34: .string "gelikzqnmz"
+sub *r2, L13
+cmp *r0, #124
+L35: .string "vwmt"
+jsr L28
+stop
+jmp *r1
+L36: mov r3, L9
+L37: not L66
+cmp *r3, L116
+mov L92, L12
+L38: not L13
+not *r7
+inc L9
+clr *r2
+stop
+stop
+L39: .string "qlgpqwdwoscyursogjwraqg"
+stop
+inc L2
+jmp L102
+clr L28
+prn r3
+L40: jmp *r7
+L41: .data 534, -766, -937, -487, -953
+
+jsr *r2
+prn *r0
+L42: add r5, *r1
+lea L115, L1
+clr *r4
+jmp L95
+mov L39, r5
+rts
+L43: not r4
+dec r1
+L44: rts
+cmp *r5, *r5
+L45: inc r5
+cmp *r5, #-119
+L46: clr r0
+dec L37
+L47: dec L32
+prn r3
+stop
+jmp *r3
+prn #95
+L48: .string "lnidhonrmibkwsbiaohdfu"
+inc r3
+jsr L67
+L49: stop
+not r4
+jmp L74
+clr r6
+clr *r4
+dec L116
+L50: .data -524, 703, 218, -675, -678, -944, -385, -689
+stop
+prn r1
+sub L59, *r6
+not r5
+L51: sub L65, L52
+bne *r5
+jsr *r5
+add r1, L28
+L52: .data -67, -970, -955
+cmp *r7, L90
+red r5
+jsr L13
+lea L117, r3
+jmp L17
+
+not L104
+sub *r7, L80
+sub #237, *r4
+inc r6
+clr r4
+sub *r2, L73
+sub r4, L58
+inc L12
+lea L51, L70
+L53: lea L26, *r1
+L54: jmp L84
+bne L47
+clr *r5
+stop
+clr L82
+rts
+jmp *r2
+L55: dec *r3
+red *r2
+add *r6, *r0
+jmp L97
+stop
+cmp r6, *r5
+L56: stop
+clr *r4
+red L110
+mov #-33, L106
+mov r6, L79
+; comment
+add r0, r0
+dec r5
+mov #236, r7
+L57: .data 827, 719, -214, -613, 91
+lea L42, L52
+L58: stop
+jmp L2
+L59: .string "qspgpbzdeahglvj"
+L60: .data -752
+rts
+rts
+L61: .string "rruvqbsetqyhljfshsnx"
+L62: not *r3
+add #-154, r5
+jsr L113
+jsr L78
+L63: clr L109
+mov *r2, L18
+add #20, L8
+jmp *r0
+L64: .data 657, -209
+add L99, *r1
+sub L26, L85
+inc *r1
+cmp *r7, L82
+L65: .data -651
+bne L56
+not L65
+L66: dec L42
+prn #85
+bne L20
+stop
+prn r4
+red L111
+L67: rts
+stop
+stop
+L68: jsr L31
+dec *r0
+not r7
+red *r0
+bne *r2
+rts
+L69: mov r5, *r1
+jmp L72
+clr r1
+jsr *r6
+jmp L76
+inc L75
+red L114
+mov L79, r2
+bne L81
+sub L108, L103
+stop
+add r0, *r1
+L70: bne *r2
+clr *r6
+stop
+; comment
+mov #235, L107
+cmp r7, #-110
+prn L74
+L71: .data -168, -606
+bne *r5
+clr L93
+mov r5, r7
+mov #-141, r1
+prn *r2
+mov L79, L75
+sub r3, L93
+red r7
+L72: bne L85
+jmp *r7
+not L0
+L73: .data 12, 218, -921, 323, 330, 218, 253, -7
+jsr *r0
+dec L107
+jsr L90
+bne *r7
+stop
+L74: .string "qlvliqe"
+stop
+L75: .data -528, 537, 956, 759
+L76: .data -811, 810
+cmp L118, r3
+cmp #-238, r5
+inc L95
+lea L112, *r7
+; comment
+not r2
+L77: jmp L17
+prn L14
+clr *r1
+add L89, *r1
+L78: jmp L20
+rts
+bne *r0
+L79: jsr L57
+L80: rts
+cmp #-246, r7
+L81: .data 378, -740, 326, 803, 638
+jmp *r3
+L82: red r3
+L83: stop
+jsr *r7
+clr *r6
+clr L105
+stop
+inc *r4
+add L97, r2
+L84: .data 595, 367, -490, -920, -434
+L85: .string "znl"
+L86: .data 874, 934, -796, -804
+red *r6
+L87: prn *r7
+prn L77
+rts
+clr r5
+prn r4
+stop
+add #-64, *r4
+inc *r2
+rts
+stop
+cmp r2, L94
+rts
+bne *r5
+not r3
+not r0
+cmp L104, L110
+jsr L102
+add L50, *r6
+rts
+dec r4
+L88: add #10, *r4
+L89: inc r1
+dec *r2
+lea L90, *r3
+bne *r0
+rts
+jmp L118
+L90: not L28
+clr r7
+bne *r3
+L91: cmp L1, #118
+bne L52
+L92: dec L69
+L93: add *r4, L44
+not L0
+mov #-10, L94
+cmp L53, #119
+L94: .string "n"
+L95: clr L100
+L96: add *r6, *r6
+red L21
+cmp L114, #201
+stop
+dec r0
+add r6, L107
+jsr L112
+bne *r7
+prn *r2
+bne *r0
+dec L79
+jsr *r7
+stop
+clr *r2
+lea L63, r6
+prn r5
+sub r4, L72
+lea L110, r0
+L97: .data 79, -864, -245
+jmp *r2
+add r3, *r3
+add *r5, r2
+inc L13
+red *r1
+rts
+inc L45
+cmp r6, #170
+L98: .string "vhunlkte"
+L99: .data 484, 561, -97, -136
+prn #229
+rts
+bne *r4
+L100: .string "uuww"
+stop
+lea L106, L104
+L101: .data 761, 466, -158
+clr *r7
+lea L102, r7
+L102: .data -277, 322, -668, -740, 353, 33
+L103: not L105
+L104: dec r2
+L105: .string "ynsymkatfyvbcezwciog"
+bne *r4
+inc *r5
+inc L30
+not r6
+L106: add *r7, r4
+rts
+red L117
+red L118
+mov #-251, *r3
+sub r1, r1
+L107: clr *r7
+L108: sub r0, L115
+L109: .string "mey"
+sub r5, r6
+L110: prn L112
+stop
+not *r2
+stop
+L111: stop
+
+dec r7
+mov r3, r7
+L112: .string "bapjnnchumjstnwnbfdfv"
+jmp L115
+red L53
+red *r5
+clr r1
+jsr L118
+sub #242, *r7
+clr L117
+L113: lea L114, L116
+L114: jmp *r7
+inc *r7
+rts
+sub #40, L117
+mov L77, r5
+L115: mov *r6, L118
+L116: jmp *r0
+jmp *r0
+jsr L9
+sub *r4, L117
+cmp L117, r7
+L117: cmp r0, r3
+clr *r5
+rts
+add L58, L118
+clr L118
+L118: stop
+dec r2
+dec r1
+sub *r2, L16
+stop
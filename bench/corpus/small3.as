@@ -0,0 +1,511 @@
+; Generated by genCorpus --seed 4
+.entry L0
+.entry L16
+.entry L32
+.entry L48
+.entry L64
+.entry L80
+.entry L96
+.entry L112
+.entry L128
+L0: stop
+L1: cmp #197, #138
+L2: .data 951, 550
+L3: jmp L50
+mov L125, r7
+L4: .data -26, 421, -526, -636, 363, 805, 449
+rts
+L5: red L2
+bne *r5
+jsr L11
+red *r4
+jsr *r3
+lea L26, *r3
+inc L4
+red r3
+clr r4
+clr r7
+not L70
+L6: .string "urrohpilisatvllcbvdko"
+sub L117, *r2
+add #-88, *r6
+dec *r4
+clr L4
+add *r2, *r2
+add r2, *r6
+L7: .data 267
+cmp r3, r6
+stop
+clr L7
+mov *r3, *r5
+sub r3, r6
+bne *r5
+L8: jsr *r0
+L9: .string "olndrcwqultactqrdt"
+inc L81
+L10: .string "c"
+
+L11: .data -767
+jmp L5
+cmp L10, #90
+bne L113
+L12: jmp *r0
+
+sub L64, *r4
+L13: red L4
+red *r1
+not r2
+L14: add #20, *r0
+jsr L74
+bne *r4
+inc *r2
+dec L100
+jmp *r5
+lea L13, *r4
+mov r5, L11
+L15: mov #-233, *r4
+dec L8
+clr L2
+cmp r6, L12
+add L13, L7
+add L45, L46
+clr *r7
+L16: .string "cthdurhj"
+rts
+L17: red L75
+L18: .data -416, -414, 219, 849, -189
+lea L4, *r2
+not L15
+L19: .data 896, 258
+add *r4, L129
+prn *r1
+jmp L114
+not L17
+mov r5, r4
+prn r4
+L20: jmp *r7
+stop
+prn *r7
+red r6
+L21: .string "vjtmemldq"
+jmp L4
+cmp r4, r3
+
+L22: .data -913
+jmp *r4
+; comment
+L23: prn #-229
+jmp *r3
+jsr L13
+add *r4, L86
+jsr L54
+L24: sub L16, L92
+L25: red r1
+L26: .string "mgihoqxwplnnpqyvjuxhnjv"
+; comment
+rts
+jmp *r2
+L27: .string "lfzsxrgyhsnkvitjsyh"
+bne L111
+lea L13, *r0
+
+red r6
+add #-173, L82
+L28: lea L16, *r5
+L29: .data 387, -341, 652, -466, -692, 60, 858
+inc L15
+bne L106
+red *r3
+
+sub r0, *r7
+L30: inc r0
+not r1
+bne *r1
+stop
+add L40, L67
+bne *r6
+dec *r5
+red L2
+prn r0
+not r6
+rts
+
+jmp L13
+L31: .string "abx"
+dec L8
+L32: not *r5
+jmp *r7
+L33: sub *r7, L17
+not r5
+sub *r4, r1
+L34: dec *r2
+clr *r0
+cmp L29, *r3
+mov #-69, *r0
+jmp L28
+sub r5, *r2
+red *r4
+
+red L20
+dec r7
+sub L12, *r7
+clr L113
+jmp *r1
+L35: .data -789
+stop
+jsr L60
+red *r6
+not L83
+cmp L82, *r1
+L36: clr L112
+rts
+prn *r1
+L37: cmp #69, r0
+rts
+cmp #30, r6
+L38: jmp L22
+cmp r7, *r0
+L39: mov L13, L55
+L40: rts
+jmp *r6
+cmp r2, r5
+L41: inc *r4
+L42: .data -405, 981, -751, -7, 884, 846
+rts
+not r7
+L43: inc r1
+clr r2
+jmp *r6
+
+L44: .string "hsjhjxqt"
+inc r3
+L45: .string "moqlwagcxczlkiuuvlcdcz"
+bne *r5
+L46: bne L22
+sub L7, r1
+red r4
+L47: .string "qmhxsr"
+cmp #168, L78
+dec *r2
+cmp #-173, r3
+L48: red *r4
+L49: jsr *r6
+not r7
+L50: mov r3, L49
+lea L87, L48
+L51: .string "jlsiiwl"
+L52: .data 529, 169, 511, 363, 816
+L53: .data -14, -92, 295, -129, 826, -58, 928, -169
+mov #79, *r6
+dec r2
+add #175, L120
+lea L66, L24
+sub *r6, L49
+add *r0, *r7
+L54: jmp *r1
+bne *r7
+L55: inc *r6
+L56: .data -283, 899, -957, -426, -758
+mov L114, r0
+bne L54
+rts
+sub r0, r3
+cmp L73, r5
+
+add *r3, r7
+prn #198
+L57: .data -442, 719, -833
+clr *r5
+not L8
+prn r6
+jsr *r3
+jmp L100
+lea L131, r0
+dec r1
+
+lea L6, r5
+red r6
+L58: dec *r2
+L59: .data -128
+prn r6
+L60: .data -629, 816, 707, 881, -764
+sub #64, L100
+lea L49, *r4
+cmp *r2, #-14
+L61: bne *r4
+L62: bne L46
+rts
+L63: dec r3
+sub *r2, *r7
+lea L121, r0
+mov L7, L95
+sub #-255, *r1
+jsr L125
+L64: .string "mpetmljgbdpofldy"
+prn r2
+L65: inc L35
+L66: bne *r7
+jmp L36
+; comment
+rts
+stop
+prn #-168
+L67: cmp #-83, L7
+prn r3
+bne L12
+jmp *r1
+L68: .string "fy"
+L69: sub L103, r4
+add *r0, *r4
+sub r6, L33
+jmp *r6
+L70: .data 387, -67, -544, -655, 613
+L71: red L132
+L72: dec r2
+L73: dec r4
+mov L35, r4
+jmp L90
+L74: .string "zawaurksqzxgck"
+L75: not r1
+inc r7
+prn *r0
+mov *r6, L117
+lea L39, L105
+; comment
+rts
+cmp #-82, #-188
+clr L120
+add #-165, *r6
+add *r5, *r4
+mov L68, r5
+L76: bne *r3
+mov r3, L114
+L77: rts
+sub *r1, L102
+L78: jsr L124
+rts
+red r6
+mov #212, *r5
+clr r6
+
+not *r0
+prn r6
+L79: jsr L86
+dec r5
+L80: sub *r6, L134
+add L68, *r1
+L81: .string "gxnegtllozscuq"
+red *r3
+clr *r6
+L82: .data 509, -811, -98, 757, 343, 142, 215
+rts
+bne *r0
+L83: prn #-12
+not r5
+mov L92, L25
+L84: cmp *r7, #-67
+L85: clr *r5
+L86: .data -514, -878, 776
+stop
+sub L105, *r2
+L87: lea L100, r7
+L88: cmp *r4, L80
+jsr *r1
+sub *r3, r7
+stop
+; comment
+rts
+stop
+jmp *r4
+prn r7
+L89: .string "nhj"
+sub r6, *r2
+L90: .string "scrrjh"
+prn r4
+L91: clr *r5
+red *r1
+jmp *r5
+rts
+inc *r2
+L92: bne *r1
+jmp *r2
+add L36, r7
+L93: red *r5
+stop
+L94: inc *r0
+jmp *r2
+mov r2, L38
+cmp *r1, r6
+L95: not *r2
+mov #108, L67
+dec r3
+not r4
+clr L110
+L96: .data -555
+L97: .data -299, -114, -57, 806, -731
+L98: .string "wwc"
+red L60
+prn r4
+prn #-3
+bne L29
+jsr L23
+L99: cmp r4, *r7
+inc *r7
+L100: .string "nznpkkuqodbmnrvoq"
+inc *r3
+
+clr *r0
+clr L10
+L101: lea L104, L53
+prn L115
+bne *r2
+add L87, *r7
+prn L114
+stop
+mov L102, r4
+L102: inc *r2
+mov *r4, r1
+L103: .data -558, -612, -808, -518, -21, 460, 925
+bne L51
+lea L123, *r6
+inc r5
+rts
+jsr *r6
+L104: lea L113, r5
+L105: cmp L108, #89
+L106: stop
+stop
+add #207, *r6
+mov L131, r4
+L107: add r5, *r4
+L108: clr r2
+mov r7, r1
+jsr *r0
+jsr L134
+clr L56
+jmp *r1
+prn r4
+jsr L109
+lea L74, r3
+jsr L6
+jmp *r0
+L109: .string "awhamtcluupq"
+not L121
+inc L58
+L110: jsr L134
+
+not *r1
+L111: sub *r2, L87
+rts
+L112: clr *r4
+clr L3
+dec r5
+L113: .data -924, 588, 676, 283, 302, 263, 759
+stop
+add L129, *r1
+jsr *r7
+clr *r5
+add *r3, L123
+sub L124, L119
+L114: .data 834, 31
+cmp r1, r7
+add *r1, r7
+prn *r1
+L115: jmp L19
+L116: jsr L1
+inc *r3
+L117: prn r7
+
+clr r2
+not r6
+mov #190, L57
+L118: jsr L113
+prn L107
+; comment
+L119: mov L131, *r1
+not *r5
+jsr *r1
+bne L127
+rts
+add #244, *r5
+not *r4
+L120: .string "narkcoikcsdjtslase"
+sub *r2, *r2
+not *r4
+sub r1, L61
+red *r0
+rts
+lea L126, r7
+clr L110
+dec L130
+L121: rts
+mov r6, *r6
+jmp *r3
+L122: .data 772, -538, 180, -19, -584
+stop
+jmp L131
+mov r5, L76
+jmp L78
+L123: .string "yvryehqccpcprgp"
+; comment
+mov r4, L132
+bne *r1
+L124: jsr *r0
+cmp r4, *r4
+lea L126, L133
+stop
+bne L89
+lea L40, L101
+L125: sub *r6, r7
+inc r5
+red r5
+jmp *r5
+L126: lea L131, r1
+stop
+prn r3
+sub L35, r6
+sub L134, L5
+not r2
+mov r5, r0
+prn *r1
+
+lea L130, r2
+L127: bne *r5
+L128: .string "zsmgpybaltpjmezybu"
+; comment
+L129: clr L79
+sub #-135, L115
+cmp *r7, L30
+inc L134
+L130: .string "uuzzmzbk"
+sub L133, L90
+stop
+mov #174, r5
+L131: .data 656, 214, -755, -459, -952, 600, -110
+L132: jsr L133
+L133: clr r7
+prn r2
+sub #8, L14
+inc *r7
+cmp r1, *r1
+bne L60
+stop
+bne *r3
+cmp *r1, L78
+bne *r4
+
+bne L134
+jsr *r7
+bne L42
+lea L134, r5
+mov L119, r3
+add #77, L134
+L134: clr *r7
+; comment
+sub *r3, r2
+mov L63, *r2
+add L38, r6
+lea L18, r2
+prn L95
+not *r7
+stop
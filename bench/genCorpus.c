@@ -0,0 +1,383 @@
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Generates a synthetic assembly source for the benchmarks. The source is valid,
+ * so the assembler runs both passes and writes every output file.
+ *
+ * Usage: genCorpus [--lines N] [--labels PCT] [--forward PCT] [--macros N]
+ *                  [--macro-lines N] [--macro-calls PCT] [--data PCT]
+ *                  [--externs N] [--extern-refs PCT] [--seed N] [-o FILE]
+ */
+
+#define LINE_SIZE 96         /* Room for a generated line, they are kept under 80 characters */
+#define STRING_MAX_LENGTH 24 /* Longest .string generated */
+#define DATA_MAX_VALUES 8    /* Most values in a generated .data */
+#define ENTRY_EVERY 16       /* One label in ENTRY_EVERY is an entry */
+#define COMMENT_PERCENT 5    /* Share of comment and empty lines */
+#define LABEL_FLAG 0x10      /* Set in the kind of a line that has a label */
+#define KIND_MASK 0x0F       /* The kind of a line, without LABEL_FLAG */
+
+/**
+ * @brief The shape of the generated source.
+ */
+struct corpus_params
+{
+    long lines;       /* Number of lines after the declarations and macro definitions */
+    long labels;      /* Percentage of instruction lines with a label */
+    long forward;     /* Percentage of label operands referring to a label defined later */
+    long macros;      /* Number of macros defined */
+    long macro_lines; /* Number of lines in the body of every macro */
+    long macro_calls; /* Percentage of lines that are macro calls, when there are macros */
+    long data;        /* Percentage of lines that are .data or .string directives */
+    long externs;     /* Number of external symbols declared */
+    long extern_refs; /* Percentage of label operands referring to an external symbol */
+    long seed;        /* Seed of the generator, the same seed gives the same source */
+};
+
+/**
+ * @brief A command line option setting one of the parameters.
+ */
+struct corpus_option
+{
+    const char *name; /* The option */
+    size_t offset;    /* Offset of the parameter in struct corpus_params */
+    long max;         /* Largest value accepted */
+};
+
+static const struct corpus_option corpus_options[] = {
+    {"--lines", offsetof(struct corpus_params, lines), 100000000L},
+    {"--labels", offsetof(struct corpus_params, labels), 100},
+    {"--forward", offsetof(struct corpus_params, forward), 100},
+    {"--macros", offsetof(struct corpus_params, macros), 100000L},
+    {"--macro-lines", offsetof(struct corpus_params, macro_lines), 1000},
+    {"--macro-calls", offsetof(struct corpus_params, macro_calls), 100},
+    {"--data", offsetof(struct corpus_params, data), 100},
+    {"--externs", offsetof(struct corpus_params, externs), 100000L},
+    {"--extern-refs", offsetof(struct corpus_params, extern_refs), 100},
+    {"--seed", offsetof(struct corpus_params, seed), 0x7FFFFFFFL}};
+
+/* Kind of a generated line */
+enum line_kind
+{
+    KIND_INSTRUCTION,
+    KIND_DATA,
+    KIND_MACRO_CALL,
+    KIND_COMMENT
+};
+
+/* Instructions by number of operands, with their addressing modes (see src/lineParser.c) */
+struct opcode
+{
+    const char *name;
+    const char *source_modes; /* 0 immediate, 1 direct, 2 register address, 3 register */
+    const char *dest_modes;
+};
+
+static const struct opcode opcodes[] = {
+    {"mov", "0123", "123"}, {"cmp", "0123", "0123"}, {"add", "0123", "123"}, {"sub", "0123", "123"},
+    {"lea", "1", "123"}, {"clr", "", "123"}, {"not", "", "123"}, {"inc", "", "123"},
+    {"dec", "", "123"}, {"jmp", "", "12"}, {"bne", "", "12"}, {"red", "", "123"},
+    {"prn", "", "0123"}, {"jsr", "", "12"}, {"rts", "", ""}, {"stop", "", ""}};
+
+static unsigned long random_state;
+
+/**
+ * @brief Returns the next pseudo random number (xorshift), the same on every platform.
+ */
+static unsigned long next_random(void)
+{
+    random_state ^= (random_state << 13) & 0xFFFFFFFFUL;
+    random_state ^= random_state >> 17;
+    random_state ^= (random_state << 5) & 0xFFFFFFFFUL;
+    return random_state;
+}
+
+/**
+ * @brief Returns a pseudo random number in [0, limit).
+ */
+static long random_below(long limit)
+{
+    return (limit > 0) ? (long)(next_random() % (unsigned long)limit) : 0;
+}
+
+/**
+ * @brief Returns 1 with the given percentage of chance.
+ */
+static int random_percent(long percent)
+{
+    return random_below(100) < percent;
+}
+
+/**
+ * @brief Parses the command line.
+ *
+ * @param argc The number of arguments.
+ * @param argv The arguments.
+ * @param params The parameters set by the options.
+ * @param output Pointer to where the output file name is stored, if given.
+ * @return int Returns 1 if the arguments are valid, otherwise 0.
+ */
+static int parse_arguments(int argc, char **argv, struct corpus_params *params, const char **output)
+{
+    const struct corpus_option *option;
+    char *end = NULL;
+    long value;
+    int i, j;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+        {
+            *output = argv[++i];
+            continue;
+        }
+
+        option = NULL;
+        for (j = 0; j < (int)(sizeof(corpus_options) / sizeof(corpus_options[0])); j++)
+        {
+            if (strcmp(argv[i], corpus_options[j].name) == 0)
+            {
+                option = &corpus_options[j];
+            }
+        }
+        if (option == NULL)
+        {
+            fprintf(stderr, "Error: Unknown option %s\n", argv[i]);
+            return 0;
+        }
+
+        value = (i + 1 < argc) ? strtol(argv[i + 1], &end, 10) : -1;
+        if (i + 1 >= argc || end == argv[i + 1] || *end != '\0' || value < 0 || value > option->max)
+        {
+            fprintf(stderr, "Error: %s expects a number between 0 and %ld\n", option->name, option->max);
+            return 0;
+        }
+        *(long *)((char *)params + option->offset) = value;
+        i++;
+    }
+    return 1;
+}
+
+/**
+ * @brief Writes an operand with one of the given addressing modes.
+ *
+ * @param line The buffer the operand is appended to.
+ * @param modes The addressing modes allowed.
+ * @param params The shape of the source.
+ * @param defined Number of labels defined before the current line.
+ * @param labels_counter Total number of labels.
+ */
+static void append_operand(char *line, const char *modes, const struct corpus_params *params, long defined, long labels_counter)
+{
+    char operand[32];
+    char mode = modes[random_below((long)strlen(modes))];
+    long label;
+
+    if (mode == '1' && params->externs > 0 && (labels_counter == 0 || random_percent(params->extern_refs)))
+    {
+        sprintf(operand, "X%ld", random_below(params->externs));
+    }
+    else if (mode == '1' && labels_counter > 0)
+    {
+        /* A forward reference is resolved by the second pass, a backward one may be found at once */
+        if ((random_percent(params->forward) && defined < labels_counter) || defined == 0)
+        {
+            label = defined + random_below(labels_counter - defined);
+        }
+        else
+        {
+            label = random_below(defined);
+        }
+        sprintf(operand, "L%ld", label);
+    }
+    else if (mode == '0')
+    {
+        sprintf(operand, "#%ld", random_below(512) - 256);
+    }
+    else if (mode == '2' || mode == '1')
+    {
+        /* Without any label, a register address replaces a direct operand */
+        sprintf(operand, "*r%ld", random_below(8));
+    }
+    else
+    {
+        sprintf(operand, "r%ld", random_below(8));
+    }
+    strcat(line, operand);
+}
+
+/**
+ * @brief Writes an instruction, without a label.
+ */
+static void append_instruction(char *line, const struct corpus_params *params, long defined, long labels_counter)
+{
+    const struct opcode *op = &opcodes[random_below(sizeof(opcodes) / sizeof(opcodes[0]))];
+
+    /* The source of lea must be a label */
+    while (strcmp(op->source_modes, "1") == 0 && labels_counter == 0 && params->externs == 0)
+    {
+        op = &opcodes[random_below(sizeof(opcodes) / sizeof(opcodes[0]))];
+    }
+
+    strcat(line, op->name);
+    if (op->source_modes[0] != '\0')
+    {
+        strcat(line, " ");
+        append_operand(line, op->source_modes, params, defined, labels_counter);
+        strcat(line, ", ");
+        append_operand(line, op->dest_modes, params, defined, labels_counter);
+    }
+    else if (op->dest_modes[0] != '\0')
+    {
+        strcat(line, " ");
+        append_operand(line, op->dest_modes, params, defined, labels_counter);
+    }
+}
+
+/**
+ * @brief Writes a .data or .string directive, without a label.
+ */
+static void append_data(char *line)
+{
+    char value[16];
+    long i, count;
+
+    if (random_percent(50))
+    {
+        strcat(line, ".string \"");
+        count = 1 + random_below(STRING_MAX_LENGTH);
+        for (i = 0; i < count; i++)
+        {
+            value[0] = (char)('a' + random_below(26));
+            value[1] = '\0';
+            strcat(line, value);
+        }
+        strcat(line, "\"");
+    }
+    else
+    {
+        strcat(line, ".data ");
+        count = 1 + random_below(DATA_MAX_VALUES);
+        for (i = 0; i < count; i++)
+        {
+            sprintf(value, (i == 0) ? "%ld" : ", %ld", random_below(2000) - 1000);
+            strcat(line, value);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    struct corpus_params params = {20000, 20, 50, 0, 4, 5, 10, 0, 10, 1};
+    const char *output = NULL;
+    FILE *file = stdout;
+    char line[LINE_SIZE];
+    char *kinds;
+    long i, j, labels_counter = 0, defined = 0;
+
+    if (!parse_arguments(argc, argv, &params, &output))
+    {
+        return 1;
+    }
+    random_state = (params.seed != 0) ? (unsigned long)params.seed : 1;
+    if (output != NULL && (file = fopen(output, "w")) == NULL)
+    {
+        fprintf(stderr, "Error: Unable to create %s\n", output);
+        return 1;
+    }
+
+    /* Choose the kind of every line first, so the labels are known before they are used */
+    kinds = (char *)malloc(params.lines + 1);
+    if (kinds == NULL)
+    {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return 1;
+    }
+    for (i = 0; i < params.lines; i++)
+    {
+        if (random_percent(COMMENT_PERCENT))
+        {
+            kinds[i] = KIND_COMMENT;
+        }
+        else if (random_percent(params.data))
+        {
+            kinds[i] = KIND_DATA;
+        }
+        else if (params.macros > 0 && random_percent(params.macro_calls))
+        {
+            kinds[i] = KIND_MACRO_CALL;
+        }
+        else
+        {
+            kinds[i] = KIND_INSTRUCTION;
+        }
+
+        /* Data always has a label, a macro call never has one */
+        if (kinds[i] == KIND_DATA || (kinds[i] == KIND_INSTRUCTION && random_percent(params.labels)))
+        {
+            kinds[i] |= LABEL_FLAG;
+            labels_counter++;
+        }
+    }
+
+    fprintf(file, "; Generated by genCorpus --seed %ld\n", params.seed);
+    for (i = 0; i < params.externs; i++)
+    {
+        fprintf(file, ".extern X%ld\n", i);
+    }
+    for (i = 0; i < labels_counter; i += ENTRY_EVERY)
+    {
+        fprintf(file, ".entry L%ld\n", i);
+    }
+
+    /* Macro bodies only use registers, they may be expanded anywhere */
+    for (i = 0; i < params.macros; i++)
+    {
+        fprintf(file, "macr m%ld\n", i);
+        for (j = 0; j < params.macro_lines; j++)
+        {
+            line[0] = '\0';
+            append_instruction(line, &params, 0, labels_counter);
+            fprintf(file, "    %s\n", line);
+        }
+        fprintf(file, "endmacr\n");
+    }
+
+    for (i = 0; i < params.lines; i++)
+    {
+        line[0] = '\0';
+        if (kinds[i] & LABEL_FLAG)
+        {
+            sprintf(line, "L%ld: ", defined);
+        }
+        switch (kinds[i] & KIND_MASK)
+        {
+        case KIND_COMMENT:
+            strcpy(line, random_percent(50) ? "" : "; comment");
+            break;
+        case KIND_DATA:
+            append_data(line);
+            break;
+        case KIND_MACRO_CALL:
+            sprintf(line, "m%ld", random_below(params.macros));
+            break;
+        default:
+            append_instruction(line, &params, defined + ((kinds[i] & LABEL_FLAG) != 0), labels_counter);
+            break;
+        }
+        defined += (kinds[i] & LABEL_FLAG) != 0;
+        fprintf(file, "%s\n", line);
+    }
+    fprintf(file, "stop\n");
+
+    free(kinds);
+    if (file != stdout && fclose(file) != 0)
+    {
+        fprintf(stderr, "Error: Unable to write %s\n", output);
+        return 1;
+    }
+    return 0;
+}
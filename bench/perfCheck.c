@@ -0,0 +1,291 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Compares the results of runBench with a baseline and fails when a scenario got slower
+ * or uses more memory than the baseline allows.
+ *
+ * Usage: perfCheck [--tolerance PCT] [--memory-tolerance PCT] BASELINE RESULTS
+ *
+ * For every scenario the median and the median absolute deviation (MAD) of the timed
+ * runs are computed from the samples. A scenario regresses when its throughput drops
+ * by more than the tolerance and its median moved by more than NOISE_MADS times the
+ * larger MAD, or when its peak RSS rises by more than the memory tolerance.
+ */
+
+#define DEFAULT_TOLERANCE 10 /* Percentage of throughput a scenario may lose */
+#define MAX_SCENARIOS 64     /* Most scenarios read from a results file */
+#define MAX_SAMPLES 256      /* Most samples read for a scenario */
+#define NAME_SIZE 64         /* Size of the name of a scenario */
+#define NOISE_MADS 3         /* A slower median within this many MADs is noise */
+
+/**
+ * @brief The results of a scenario, read from runBench output.
+ */
+struct scenario_result
+{
+    char name[NAME_SIZE];
+    long lines;       /* Lines of its source */
+    long peak_rss_kb; /* Peak RSS of the assembler */
+    double median;    /* Median time of the timed runs, in seconds */
+    double mad;       /* Median absolute deviation of those times */
+};
+
+/**
+ * @brief Compares two doubles, for qsort.
+ */
+static int compare_doubles(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Sorts values and returns their median.
+ */
+static double median_of(double *values, int counter)
+{
+    qsort(values, counter, sizeof(double), compare_doubles);
+    return (counter % 2) ? values[counter / 2] : (values[counter / 2 - 1] + values[counter / 2]) / 2;
+}
+
+/**
+ * @brief Reads a whole file into a NUL terminated buffer.
+ *
+ * @return char* The content, to be freed by the caller, or NULL on failure.
+ */
+static char *read_file(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    char *content;
+    long size;
+
+    if (file == NULL)
+    {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    rewind(file);
+    content = (char *)malloc(size + 1);
+    if (content != NULL)
+    {
+        size = (long)fread(content, 1, size, file);
+        content[size] = '\0';
+    }
+    fclose(file);
+    return content;
+}
+
+/**
+ * @brief Finds the value of a key in the text of a JSON object.
+ *
+ * @param object The text of the object, up to its closing brace.
+ * @param key The key, without quotes.
+ * @return const char* The first character of the value, or NULL if the key is missing.
+ */
+static const char *find_value(const char *object, const char *key)
+{
+    size_t length = strlen(key);
+    const char *p;
+
+    for (p = strchr(object, '"'); p != NULL; p = strchr(p + 1, '"'))
+    {
+        if (strncmp(p + 1, key, length) == 0 && p[length + 1] == '"')
+        {
+            for (p += length + 2; *p == ' ' || *p == ':'; p++)
+                ;
+            return p;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Reads a scenario object written by runBench.
+ *
+ * @param object The text of the object, its closing brace replaced by a NUL.
+ * @param result The structure the results are stored in.
+ * @return int Returns 1 if the object holds a name and samples, otherwise 0.
+ */
+static int parse_scenario(const char *object, struct scenario_result *result)
+{
+    double samples[MAX_SAMPLES], deviations[MAX_SAMPLES];
+    const char *value;
+    char *end;
+    int counter = 0, i;
+
+    if ((value = find_value(object, "name")) == NULL || *value != '"')
+    {
+        return 0;
+    }
+    for (i = 0, value++; *value != '"' && *value != '\0' && i < NAME_SIZE - 1; i++, value++)
+    {
+        result->name[i] = *value;
+    }
+    result->name[i] = '\0';
+
+    value = find_value(object, "lines");
+    result->lines = (value != NULL) ? strtol(value, NULL, 10) : 0;
+    value = find_value(object, "peak_rss_kb");
+    result->peak_rss_kb = (value != NULL) ? strtol(value, NULL, 10) : 0;
+
+    if ((value = find_value(object, "samples")) == NULL || *value != '[')
+    {
+        return 0;
+    }
+    for (value++; counter < MAX_SAMPLES; value = end)
+    {
+        while (*value == ' ' || *value == ',')
+        {
+            value++;
+        }
+        samples[counter] = strtod(value, &end);
+        if (end == value)
+        {
+            break;
+        }
+        counter++;
+    }
+    if (counter == 0)
+    {
+        return 0;
+    }
+
+    result->median = median_of(samples, counter);
+    for (i = 0; i < counter; i++)
+    {
+        deviations[i] = samples[i] > result->median ? samples[i] - result->median : result->median - samples[i];
+    }
+    result->mad = median_of(deviations, counter);
+    return 1;
+}
+
+/**
+ * @brief Reads the scenarios of a runBench results file.
+ *
+ * @param path The results file.
+ * @param results The array the scenarios are stored in, MAX_SCENARIOS long.
+ * @return int The number of scenarios read, or -1 if the file cannot be read.
+ */
+static int read_results(const char *path, struct scenario_result *results)
+{
+    char *content = read_file(path), *object, *end;
+    int counter = 0;
+
+    if (content == NULL)
+    {
+        return -1;
+    }
+    object = strstr(content, "\"scenarios\"");
+    for (object = object ? strchr(object, '{') : NULL; object != NULL && counter < MAX_SCENARIOS; object = strchr(end + 1, '{'))
+    {
+        if ((end = strchr(object, '}')) == NULL)
+        {
+            break;
+        }
+        *end = '\0';
+        counter += parse_scenario(object, &results[counter]);
+    }
+    free(content);
+    return counter;
+}
+
+/**
+ * @brief Compares a scenario with its baseline and prints the comparison.
+ *
+ * @return int Returns 1 if the scenario regressed, otherwise 0.
+ */
+static int check_scenario(const struct scenario_result *base, const struct scenario_result *current,
+                          double tolerance, double memory_tolerance)
+{
+    double base_throughput = base->lines / base->median, throughput = current->lines / current->median;
+    double change = (throughput - base_throughput) * 100 / base_throughput;
+    double memory_change = base->peak_rss_kb ? (current->peak_rss_kb - base->peak_rss_kb) * 100.0 / base->peak_rss_kb : 0;
+    double noise = NOISE_MADS * (base->mad > current->mad ? base->mad : current->mad);
+    const char *verdict = "ok";
+    int regressed = 1;
+
+    if (base->lines != current->lines)
+    {
+        verdict = "source changed, update the baseline";
+    }
+    else if (change < -tolerance && current->median - base->median > noise)
+    {
+        verdict = "slower";
+    }
+    else if (memory_change > memory_tolerance)
+    {
+        verdict = "more memory";
+    }
+    else
+    {
+        regressed = 0;
+    }
+
+    printf("%-10s %10.4f %9.4f %10.4f %9.4f %12.0f %+8.1f%% %10ld %+8.1f%%  %s\n", current->name, base->median,
+           base->mad, current->median, current->mad, throughput, change, current->peak_rss_kb, memory_change, verdict);
+    return regressed;
+}
+
+int main(int argc, char **argv)
+{
+    static struct scenario_result baseline[MAX_SCENARIOS], results[MAX_SCENARIOS];
+    double tolerance = DEFAULT_TOLERANCE, memory_tolerance = DEFAULT_TOLERANCE;
+    int baseline_counter, results_counter, regressions = 0, i, j;
+
+    for (i = 1; i + 2 < argc; i += 2)
+    {
+        if (strcmp(argv[i], "--tolerance") == 0)
+        {
+            tolerance = atof(argv[i + 1]);
+        }
+        else if (strcmp(argv[i], "--memory-tolerance") == 0)
+        {
+            memory_tolerance = atof(argv[i + 1]);
+        }
+        else
+        {
+            break;
+        }
+    }
+    if (argc - i != 2 || tolerance < 0 || memory_tolerance < 0)
+    {
+        fprintf(stderr, "Usage: %s [--tolerance PCT] [--memory-tolerance PCT] BASELINE RESULTS\n", argv[0]);
+        return 2;
+    }
+
+    baseline_counter = read_results(argv[i], baseline);
+    results_counter = read_results(argv[i + 1], results);
+    if (baseline_counter <= 0 || results_counter <= 0)
+    {
+        fprintf(stderr, "Error: Unable to read the scenarios of %s\n", baseline_counter <= 0 ? argv[i] : argv[i + 1]);
+        return 2;
+    }
+
+    printf("%-10s %10s %9s %10s %9s %12s %9s %10s %9s\n", "scenario", "base s", "base MAD", "median s", "MAD",
+           "lines/s", "change", "peak kB", "change");
+    for (i = 0; i < baseline_counter; i++)
+    {
+        for (j = 0; j < results_counter && strcmp(baseline[i].name, results[j].name) != 0; j++)
+            ;
+        if (j == results_counter)
+        {
+            printf("%-10s missing from the results\n", baseline[i].name);
+            regressions++;
+            continue;
+        }
+        regressions += check_scenario(&baseline[i], &results[j], tolerance, memory_tolerance);
+    }
+
+    if (regressions > 0)
+    {
+        printf("%d of %d scenarios regressed (tolerance %.1f%% throughput, %.1f%% memory)\n", regressions,
+               baseline_counter, tolerance, memory_tolerance);
+        return 1;
+    }
+    printf("No regression (tolerance %.1f%% throughput, %.1f%% memory)\n", tolerance, memory_tolerance);
+    return 0;
+}
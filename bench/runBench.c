@@ -0,0 +1,319 @@
+#define _POSIX_C_SOURCE 200809L /* fork, exec, clock_gettime */
+#define _DEFAULT_SOURCE         /* wait4 */
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/*
+ * Runs the assembler over synthetic sources made by genCorpus and reports, for
+ * every scenario, the throughput and the peak memory of the assembler as JSON.
+ *
+ * Usage: runBench ASSEMBLER GENERATOR DIRECTORY [ITERATIONS]
+ *
+ * The sources and the outputs are written to DIRECTORY. A program must fit in the 4096
+ * words an operand addresses, so every scenario is a few thousand lines split into
+ * modules, generated with their own seeds and assembled together in one run.
+ */
+
+#define DEFAULT_ITERATIONS 3 /* Timed runs of every scenario, after a first checked run */
+#define MAX_MODULES 120      /* Most sources of a scenario */
+#define MAX_ARGUMENTS (MAX_MODULES + 8) /* Most arguments passed to a child */
+#define PATH_SIZE 512        /* Size of the buffers holding paths */
+#define NUMBER_SIZE 24       /* Size of a buffer holding a decimal long */
+
+/**
+ * @brief A benchmark scenario: a name, the genCorpus options making each module and the
+ * number of modules, sized so every module fits in the memory of the machine.
+ */
+struct scenario
+{
+    const char *name;
+    const char *generator_options;
+    int modules;
+};
+
+static const struct scenario scenarios[] = {
+    {"small", "--lines 500", 4},
+    {"baseline", "--lines 1000", 60},
+    {"labels", "--lines 1000 --labels 60", 60},
+    {"forward", "--lines 1000 --labels 30 --forward 100", 60},
+    {"backward", "--lines 1000 --labels 30 --forward 0", 60},
+    {"macros", "--lines 500 --macros 5 --macro-lines 10 --macro-calls 20", 120},
+    {"data", "--lines 500 --data 60", 120},
+    {"externs", "--lines 1000 --externs 25 --extern-refs 40", 60}};
+
+/**
+ * @brief The measures of a single run of a child process.
+ */
+struct run_result
+{
+    double seconds;   /* Wall clock time */
+    long peak_rss_kb; /* Peak resident set size */
+    int success;      /* Set if the child exited with status 0 */
+};
+
+/**
+ * @brief Returns the time of a monotonic clock in seconds.
+ */
+static double now_seconds(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Compares two doubles, for qsort.
+ */
+static int compare_doubles(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Runs a program and waits for it.
+ *
+ * @param argv The program and its arguments, NULL terminated.
+ * @param output The file its stdout and stderr go to.
+ * @param result The structure the measures are stored in.
+ */
+static void run_program(char **argv, const char *output, struct run_result *result)
+{
+    struct rusage usage;
+    double start = now_seconds();
+    pid_t pid;
+    int status = 0, fd;
+
+    result->success = 0;
+    pid = fork();
+    if (pid == 0)
+    {
+        fd = open(output, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd >= 0)
+        {
+            dup2(fd, STDOUT_FILENO);
+            dup2(fd, STDERR_FILENO);
+            close(fd);
+        }
+        execv(argv[0], argv);
+        _exit(127);
+    }
+    if (pid < 0 || wait4(pid, &status, 0, &usage) != pid)
+    {
+        return;
+    }
+
+    result->seconds = now_seconds() - start;
+    result->peak_rss_kb = usage.ru_maxrss;
+    result->success = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+/**
+ * @brief Returns the size of a file, or -1 if it does not exist.
+ */
+static long file_size(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    long size;
+
+    if (file == NULL)
+    {
+        return -1;
+    }
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fclose(file);
+    return size;
+}
+
+/**
+ * @brief Counts the lines of a file.
+ */
+static long count_lines(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    long lines = 0;
+    int c;
+
+    if (file == NULL)
+    {
+        return 0;
+    }
+    while ((c = getc(file)) != EOF)
+    {
+        lines += c == '\n';
+    }
+    fclose(file);
+    return lines;
+}
+
+/**
+ * @brief Removes the output files of a previous run.
+ *
+ * Every run starts without outputs: on some file systems, replacing a file by
+ * truncating it flushes it to the disk, which would be measured instead.
+ *
+ * @param base The path of the source, without the .as extension.
+ */
+static void remove_outputs(const char *base)
+{
+    static const char *extensions[] = {".am", ".ob", ".ent", ".ext"};
+    char path[PATH_SIZE];
+    int i;
+
+    for (i = 0; i < (int)(sizeof(extensions) / sizeof(extensions[0])); i++)
+    {
+        sprintf(path, "%.500s%s", base, extensions[i]);
+        remove(path);
+    }
+}
+
+/**
+ * @brief Generates the modules of a scenario, then assembles them and prints its results.
+ *
+ * @param item The scenario.
+ * @param assembler Path of the assembler.
+ * @param generator Path of genCorpus.
+ * @param directory The directory the sources and the outputs are written to.
+ * @param iterations Number of timed runs.
+ * @param separator Printed before the results, to separate them from the previous scenario.
+ * @return int Returns 1 if the scenario ran, otherwise 0.
+ */
+static int run_scenario(const struct scenario *item, const char *assembler, const char *generator,
+                        const char *directory, int iterations, const char *separator)
+{
+    static char bases[MAX_MODULES][PATH_SIZE];
+    char *argv[MAX_ARGUMENTS];
+    char options[PATH_SIZE], source[PATH_SIZE], log[PATH_SIZE], seed[NUMBER_SIZE];
+    struct run_result result;
+    double *samples = (double *)malloc(iterations * sizeof(double));
+    long lines = 0, bytes = 0, peak_rss_kb = 0;
+    int argc, module, i;
+    char *token;
+
+    sprintf(log, "%.400s/%s.log", directory, item->name);
+    for (module = 0; module < item->modules; module++)
+    {
+        sprintf(bases[module], "%.400s/%s%d", directory, item->name, module);
+        sprintf(source, "%.500s.as", bases[module]);
+        sprintf(seed, "%d", module + 1);
+
+        /* genCorpus OPTIONS --seed N -o DIRECTORY/NAMEN.as */
+        strcpy(options, item->generator_options);
+        argc = 0;
+        argv[argc++] = (char *)generator;
+        for (token = strtok(options, " "); token != NULL && argc < MAX_ARGUMENTS - 5; token = strtok(NULL, " "))
+        {
+            argv[argc++] = token;
+        }
+        argv[argc++] = "--seed";
+        argv[argc++] = seed;
+        argv[argc++] = "-o";
+        argv[argc++] = source;
+        argv[argc] = NULL;
+        run_program(argv, log, &result);
+        if (samples == NULL || !result.success)
+        {
+            fprintf(stderr, "Error: Unable to generate the source of %s, see %s\n", item->name, log);
+            free(samples);
+            return 0;
+        }
+        lines += count_lines(source);
+        bytes += file_size(source);
+    }
+
+    /* assembler DIRECTORY/NAME0 DIRECTORY/NAME1 ... */
+    argc = 0;
+    argv[argc++] = (char *)assembler;
+    for (module = 0; module < item->modules; module++)
+    {
+        argv[argc++] = bases[module];
+    }
+    argv[argc] = NULL;
+
+    /* A first run warms the caches and checks the sources assemble without errors */
+    for (module = 0; module < item->modules; module++)
+    {
+        remove_outputs(bases[module]);
+    }
+    run_program(argv, log, &result);
+    if (!result.success || file_size(log) != 0)
+    {
+        fprintf(stderr, "Error: The sources of %s did not assemble cleanly, see %s\n", item->name, log);
+        free(samples);
+        return 0;
+    }
+
+    for (i = 0; i < iterations; i++)
+    {
+        for (module = 0; module < item->modules; module++)
+        {
+            remove_outputs(bases[module]);
+        }
+        run_program(argv, log, &result);
+        samples[i] = result.seconds;
+        if (result.peak_rss_kb > peak_rss_kb)
+        {
+            peak_rss_kb = result.peak_rss_kb;
+        }
+    }
+
+    printf("%s    {\"name\": \"%s\", \"generator\": \"%s\", \"modules\": %d, \"lines\": %ld, \"bytes\": %ld, ",
+           separator, item->name, item->generator_options, item->modules, lines, bytes);
+    printf("\"samples\": [");
+    for (i = 0; i < iterations; i++)
+    {
+        printf(i == 0 ? "%.6f" : ", %.6f", samples[i]);
+    }
+    qsort(samples, iterations, sizeof(double), compare_doubles);
+    printf("], \"median_seconds\": %.6f, \"min_seconds\": %.6f, ", samples[iterations / 2], samples[0]);
+    printf("\"lines_per_second\": %.0f, \"mb_per_second\": %.3f, \"peak_rss_kb\": %ld}",
+           lines / samples[iterations / 2], bytes / 1e6 / samples[iterations / 2], peak_rss_kb);
+    fflush(stdout);
+
+    free(samples);
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    int iterations = DEFAULT_ITERATIONS;
+    int counter = (int)(sizeof(scenarios) / sizeof(scenarios[0]));
+    const char *separator = "";
+    int i, result = 0;
+
+    if (argc < 4)
+    {
+        fprintf(stderr, "Usage: %s ASSEMBLER GENERATOR DIRECTORY [ITERATIONS]\n", argv[0]);
+        return 1;
+    }
+    if (argc > 4 && (iterations = atoi(argv[4])) <= 0)
+    {
+        fprintf(stderr, "Error: ITERATIONS must be a positive number\n");
+        return 1;
+    }
+
+    printf("{\n  \"assembler\": \"%s\",\n  \"iterations\": %d,\n  \"scenarios\": [\n", argv[1], iterations);
+    for (i = 0; i < counter; i++)
+    {
+        if (run_scenario(&scenarios[i], argv[1], argv[2], argv[3], iterations, separator))
+        {
+            separator = ",\n";
+        }
+        else
+        {
+            result = 1;
+        }
+    }
+    printf("\n  ]\n}\n");
+    return result;
+}
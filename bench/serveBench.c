@@ -0,0 +1,265 @@
+#define _POSIX_C_SOURCE 200809L /* fork, exec, sockets, clock_gettime */
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "protocol.h"
+
+/*
+ * Compares the latency of assembling small files by starting the assembler for
+ * every file with the latency of sending them to a server started with --serve.
+ *
+ * Usage: serveBench ASSEMBLER ITERATIONS FILE...
+ */
+
+#define SOCKET_PATH_SIZE 108     /* Size of sun_path */
+#define CONNECT_RETRIES 200      /* Attempts to connect to the starting server */
+#define CONNECT_RETRY_NS 10000000L /* Delay between the attempts */
+
+/**
+ * @brief Returns the current time in microseconds.
+ */
+static double now_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+/**
+ * @brief Compares two doubles, for qsort.
+ */
+static int compare_doubles(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Prints the mean, median and 99th percentile of a series of latencies.
+ */
+static void print_latencies(const char *mode, double *latencies, int counter)
+{
+    double sum = 0;
+    int i;
+
+    qsort(latencies, counter, sizeof(double), compare_doubles);
+    for (i = 0; i < counter; i++)
+    {
+        sum += latencies[i];
+    }
+    printf("%-10s %8d %12.1f %12.1f %12.1f\n", mode, counter, sum / counter,
+           latencies[counter / 2], latencies[(counter * 99) / 100 < counter ? (counter * 99) / 100 : counter - 1]);
+}
+
+/**
+ * @brief Runs a program with its output discarded and waits for it.
+ *
+ * @param argv The program and its arguments.
+ * @return int The exit status of the program, or -1 if it could not run.
+ */
+static int run_program(char *const argv[])
+{
+    int status, null_fd;
+    pid_t pid = fork();
+
+    if (pid == 0)
+    {
+        null_fd = open("/dev/null", O_WRONLY);
+        dup2(null_fd, STDOUT_FILENO);
+        execv(argv[0], argv);
+        _exit(127);
+    }
+    if (pid < 0 || waitpid(pid, &status, 0) < 0)
+    {
+        return -1;
+    }
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+/**
+ * @brief Connects to the server, retrying while it starts.
+ *
+ * @return int The connected socket, or -1.
+ */
+static int connect_server(const char *path)
+{
+    struct sockaddr_un address;
+    struct timespec delay = {0, CONNECT_RETRY_NS};
+    int fd, i;
+
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, path);
+
+    for (i = 0; i < CONNECT_RETRIES; i++)
+    {
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd >= 0 && connect(fd, (struct sockaddr *)&address, sizeof(address)) == 0)
+        {
+            return fd;
+        }
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+        nanosleep(&delay, NULL);
+    }
+    return -1;
+}
+
+int main(int argc, char **argv)
+{
+    char socket_path[SOCKET_PATH_SIZE];
+    char cwd[4096], path[8192];
+    char *program[6];
+    double *latencies;
+    struct text_buffer request, response, source;
+    FILE *source_file;
+    int iterations, files_counter, requests, i, j, n, fd, status;
+    double start;
+    pid_t server;
+
+    if (argc < 4 || (iterations = atoi(argv[2])) <= 0)
+    {
+        fprintf(stderr, "Usage: %s ASSEMBLER ITERATIONS FILE...\n", argv[0]);
+        return 1;
+    }
+    files_counter = argc - 3;
+    requests = iterations * files_counter;
+    latencies = (double *)malloc(requests * sizeof(double));
+    if (latencies == NULL || getcwd(cwd, sizeof(cwd)) == NULL)
+    {
+        return 1;
+    }
+    sprintf(socket_path, "/tmp/asm-bench-%ld.sock", (long)getpid());
+    init_text_buffer(&request);
+    init_text_buffer(&response);
+    init_text_buffer(&source);
+
+    printf("%-10s %8s %12s %12s %12s\n", "mode", "requests", "mean_us", "p50_us", "p99_us");
+
+    /* 1. A new process for every file */
+    program[0] = argv[1];
+    program[2] = NULL;
+    for (n = 0, i = 0; i < iterations; i++)
+    {
+        for (j = 0; j < files_counter; j++, n++)
+        {
+            program[1] = argv[3 + j];
+            start = now_us();
+            if (run_program(program) != 0)
+            {
+                fprintf(stderr, "The assembler failed on %s\n", argv[3 + j]);
+                return 1;
+            }
+            latencies[n] = now_us() - start;
+        }
+    }
+    print_latencies("fork/exec", latencies, requests);
+
+    /* Start the server */
+    server = fork();
+    if (server == 0)
+    {
+        execl(argv[1], argv[1], "--serve", socket_path, (char *)NULL);
+        _exit(127);
+    }
+    fd = connect_server(socket_path);
+    if (server < 0 || fd < 0)
+    {
+        fprintf(stderr, "Unable to start the server\n");
+        return 1;
+    }
+    close(fd); /* The only worker of the server serves one connection at a time */
+
+    /* 2. A new client process for every file */
+    program[1] = "--client";
+    program[2] = socket_path;
+    program[4] = NULL;
+    for (n = 0, i = 0; i < iterations; i++)
+    {
+        for (j = 0; j < files_counter; j++, n++)
+        {
+            program[3] = argv[3 + j];
+            start = now_us();
+            if (run_program(program) != 0)
+            {
+                fprintf(stderr, "The client failed on %s\n", argv[3 + j]);
+                return 1;
+            }
+            latencies[n] = now_us() - start;
+        }
+    }
+    print_latencies("client", latencies, requests);
+
+    /* 3. Requests on a connection kept open, as a build system linking the protocol would */
+    fd = connect_server(socket_path);
+    for (n = 0, i = 0; i < iterations; i++)
+    {
+        for (j = 0; j < files_counter; j++, n++)
+        {
+            sprintf(path, "%s/%s", cwd, argv[3 + j]);
+            start = now_us();
+            clear_text_buffer(&request);
+            append_record(&request, RECORD_PATH, path, strlen(path));
+            if (!write_frame(fd, request.text, request.length) || read_frame(fd, &response) != 1)
+            {
+                fprintf(stderr, "The server did not answer\n");
+                return 1;
+            }
+            latencies[n] = now_us() - start;
+        }
+    }
+    print_latencies("socket", latencies, requests);
+
+    /* 4. Inline sources on the same connection: nothing is read or written on disk */
+    for (n = 0, i = 0; i < iterations; i++)
+    {
+        for (j = 0; j < files_counter; j++, n++)
+        {
+            sprintf(path, "%s.as", argv[3 + j]);
+            source_file = fopen(path, "r");
+            if (source_file == NULL)
+            {
+                fprintf(stderr, "Unable to read %s\n", path);
+                return 1;
+            }
+            clear_text_buffer(&source);
+            read_text_file(&source, source_file);
+            fclose(source_file);
+
+            start = now_us();
+            clear_text_buffer(&request);
+            append_record(&request, RECORD_SOURCE, source.text, source.length);
+            if (!write_frame(fd, request.text, request.length) || read_frame(fd, &response) != 1)
+            {
+                fprintf(stderr, "The server did not answer\n");
+                return 1;
+            }
+            latencies[n] = now_us() - start;
+        }
+    }
+    print_latencies("inline", latencies, requests);
+
+    /* Stop the server */
+    clear_text_buffer(&request);
+    append_record(&request, RECORD_SHUTDOWN, NULL, 0);
+    write_frame(fd, request.text, request.length);
+    read_frame(fd, &response);
+    close(fd);
+    waitpid(server, &status, 0);
+
+    release_text_buffer(&request);
+    release_text_buffer(&response);
+    release_text_buffer(&source);
+    free(latencies);
+    return 0;
+}
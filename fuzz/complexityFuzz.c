@@ -0,0 +1,583 @@
+#define _POSIX_C_SOURCE 200809L /* open_memstream, clock_gettime */
+#define _DEFAULT_SOURCE         /* syscall */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+#include "assemblerContext.h"
+#include "macroProcessing.h"
+#include "output.h"
+#include "protocol.h"
+#include "sha256.h"
+
+/*
+ * Looks for sources whose cost grows faster than their size.
+ *
+ * Every input goes through the whole pipeline in memory: macro expansion, both
+ * passes and the ob, ent and ext contents. Its cost is the number of instructions
+ * the thread executed, read from a perf event, or its CPU time in nanoseconds when
+ * perf events are not available. An input of at least MIN_MEASURED_SIZE bytes
+ * whose cost per byte stays above the limit is a slow unit: it is reported, with
+ * the cost of its first half, which is about half of its cost when the cost is linear.
+ *
+ * Built with -DFUZZ_LIBFUZZER and clang -fsanitize=fuzzer, this file is a libFuzzer
+ * target that aborts on a slow unit, so libFuzzer saves it and -minimize_crash=1
+ * minimizes it. Built without it, main is a small standalone fuzzer:
+ *
+ * Usage: complexityFuzz [-runs=N] [-max_len=N] [-seed=N] [-artifact_prefix=PATH] [FILE...]
+ *
+ * It mutates the given sources line by line, keeps the mutants that cost more
+ * per byte, and on a slow unit removes lines while it stays slow, writes it to
+ * PATHslow-unit-HASH and exits with status 1.
+ *
+ * The limit is FUZZ_MAX_COST_PER_BYTE from the environment, or a default of the unit in use.
+ */
+
+#define FUZZ_NAME "fuzz"                    /* Name of the inputs in the diagnostics */
+#define FUZZ_MEM_SIZE 1000000               /* Words a program may occupy, so that no input stops early */
+#define MIN_MEASURED_SIZE 1024              /* Smaller inputs are dominated by fixed costs */
+#define DEFAULT_INSTRUCTIONS_PER_BYTE 5000  /* Default limit when counting instructions, linear sources take about 700 */
+#define DEFAULT_NANOSECONDS_PER_BYTE 2000   /* Default limit when measuring CPU time */
+#define LIMIT_VARIABLE "FUZZ_MAX_COST_PER_BYTE"
+#define MEASURE_REPEATS 3                   /* A slow unit is timed again, its cost is the lowest */
+#define DEFAULT_RUNS 100000                 /* Inputs tried by the standalone fuzzer */
+#define DEFAULT_MAX_LEN 65536               /* Largest input the standalone fuzzer makes */
+#define CORPUS_LIMIT 256                    /* Most inputs the standalone fuzzer keeps */
+#define MAX_DUPLICATED_LINES 32             /* Most lines duplicated by a single mutation */
+#define TEMPLATE_SIZE 96                    /* Room for a line made from a template */
+#define REPORT_EVERY 1000                   /* Runs between two progress lines */
+
+/**
+ * @brief The state kept between inputs: a context and the streams its outputs go to.
+ */
+struct harness
+{
+    assembler_context ctx;     /* Reused for every input, as by the assembler */
+    struct text_buffer source; /* The input, null terminated */
+    struct text_buffer message;
+    FILE *diagnostics;
+    FILE *outputs;
+    char *diagnostics_buffer;
+    char *outputs_buffer;
+    size_t diagnostics_size;
+    size_t outputs_size;
+    int counter_fd; /* Perf event counting the instructions of the thread, or -1 */
+    double limit;   /* Cost per byte above which an input is a slow unit */
+};
+
+/**
+ * @brief Opens a perf event counting the instructions executed by the calling thread.
+ *
+ * @return int The event, or -1 if perf events are not available.
+ */
+static int open_instruction_counter(void)
+{
+#ifdef __linux__
+    struct perf_event_attr attr;
+    int fd;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    fd = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+    if (fd >= 0 && ioctl(fd, PERF_EVENT_IOC_ENABLE, 0) != 0)
+    {
+        close(fd);
+        fd = -1;
+    }
+    return fd;
+#else
+    return -1;
+#endif
+}
+
+/**
+ * @brief Reads the cost counter: instructions, or CPU nanoseconds of the thread.
+ */
+static double read_cost(const struct harness *h)
+{
+    struct timespec ts;
+    uint64_t instructions;
+
+    if (h->counter_fd >= 0 && read(h->counter_fd, &instructions, sizeof(instructions)) == sizeof(instructions))
+    {
+        return (double)instructions;
+    }
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/**
+ * @brief Creates the context and the streams, and selects the cost counter and its limit.
+ */
+static void init_harness(struct harness *h)
+{
+    struct assembler_options options;
+    const char *limit = getenv(LIMIT_VARIABLE);
+
+    memset(h, 0, sizeof(*h));
+    h->diagnostics = open_memstream(&h->diagnostics_buffer, &h->diagnostics_size);
+    h->outputs = open_memstream(&h->outputs_buffer, &h->outputs_size);
+    if (h->diagnostics == NULL || h->outputs == NULL)
+    {
+        failureExit("Memory allocation failed");
+    }
+
+    memset(&options, 0, sizeof(options));
+    options.mem_size = FUZZ_MEM_SIZE;
+    init_context(&h->ctx, &options, h->diagnostics);
+    init_text_buffer(&h->source);
+    init_text_buffer(&h->message);
+
+    h->counter_fd = open_instruction_counter();
+    h->limit = (h->counter_fd >= 0) ? DEFAULT_INSTRUCTIONS_PER_BYTE : DEFAULT_NANOSECONDS_PER_BYTE;
+    if (limit != NULL && atof(limit) > 0)
+    {
+        h->limit = atof(limit);
+    }
+}
+
+/**
+ * @brief Assembles an input as the stream mode does, and returns its cost.
+ */
+static double measure(struct harness *h, const char *data, size_t size)
+{
+    double start = read_cost(h);
+    int result;
+
+    rewind(h->diagnostics);
+    clear_text_buffer(&h->message);
+    clear_text_buffer(&h->source);
+    append_text(&h->source, data, size);
+
+    result = expand_macros(&h->ctx, h->source.text, h->source.length);
+    if (result != 0)
+    {
+        print_macro_error(result, h->ctx.diagnostics);
+    }
+    else if (assemble_text(&h->ctx, FUZZ_NAME))
+    {
+        append_output_records(&h->ctx, h->outputs, &h->outputs_buffer, &h->message);
+    }
+    reset_context(&h->ctx);
+
+    return read_cost(h) - start;
+}
+
+/**
+ * @brief Returns the lowest of a few measures of an input, so noise does not make it slow.
+ *
+ * Instruction counts barely change between runs, they are not measured again.
+ */
+static double measure_again(struct harness *h, const char *data, size_t size, double cost)
+{
+    double again;
+    int i;
+
+    for (i = 1; i < MEASURE_REPEATS && h->counter_fd < 0; i++)
+    {
+        if ((again = measure(h, data, size)) < cost)
+        {
+            cost = again;
+        }
+    }
+    return cost;
+}
+
+/**
+ * @brief Checks if an input is a slow unit.
+ *
+ * @param cost The cost of a first measure of the input.
+ */
+static int is_slow(struct harness *h, const char *data, size_t size, double cost)
+{
+    return size >= MIN_MEASURED_SIZE && cost > h->limit * size &&
+           measure_again(h, data, size, cost) > h->limit * size;
+}
+
+/**
+ * @brief Prints the cost of a slow unit and of its first half, on stderr.
+ */
+static void report_slow_unit(struct harness *h, const char *data, size_t size)
+{
+    size_t half = size / 2;
+    double cost, half_cost;
+
+    while (half < size && data[half] != '\n')
+    {
+        half++;
+    }
+    cost = measure_again(h, data, size, measure(h, data, size));
+    half_cost = measure_again(h, data, half, measure(h, data, half));
+
+    fprintf(stderr, "Slow unit: %lu bytes cost %.0f %s, %.1f per byte (limit %.1f)\n", (unsigned long)size, cost,
+            (h->counter_fd >= 0) ? "instructions" : "ns", cost / size, h->limit);
+    fprintf(stderr, "Its first %lu bytes cost %.0f: the cost grew %.2f times for %.2f times the size\n",
+            (unsigned long)half, half_cost, half_cost > 0 ? cost / half_cost : 0, half > 0 ? (double)size / half : 0);
+}
+
+#ifdef FUZZ_LIBFUZZER
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    static struct harness h;
+    static int ready = 0;
+
+    if (!ready)
+    {
+        init_harness(&h);
+        ready = 1;
+    }
+    if (is_slow(&h, (const char *)data, size, measure(&h, (const char *)data, size)))
+    {
+        report_slow_unit(&h, (const char *)data, size);
+        abort();
+    }
+    return 0;
+}
+
+#else
+
+/* Lines inserted by the mutations, %d is replaced by a random number */
+static const char *line_templates[] = {
+    "L%d: mov r1, r2\n", "mov L%d, r3\n", "jmp L%d\n", "L%d: .data 1, 2\n", ".entry L%d\n",
+    ".extern X%d\n", "lea X%d, r4\n", "macr M%d\nmov r1, r2\nendmacr\n", "M%d\n", "S%d: .string \"ab\"\n"};
+
+static unsigned long rng_state = 1; /* State of the xorshift generator */
+
+/**
+ * @brief Returns a random number below a bound.
+ */
+static unsigned long random_below(unsigned long bound)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return bound ? (rng_state & 0xFFFFFFFFUL) % bound : 0;
+}
+
+/**
+ * @brief Returns the offset of the start of a random line of a text.
+ */
+static size_t random_line_start(const struct text_buffer *text)
+{
+    size_t offset = random_below(text->length + 1);
+
+    while (offset > 0 && text->text[offset - 1] != '\n')
+    {
+        offset--;
+    }
+    return offset;
+}
+
+/**
+ * @brief Returns the offset just after the line starting at an offset.
+ */
+static size_t line_end(const struct text_buffer *text, size_t offset)
+{
+    while (offset < text->length && text->text[offset++] != '\n')
+        ;
+    return offset;
+}
+
+/**
+ * @brief Replaces the characters between two offsets of a text by other characters.
+ */
+static void splice_text(struct text_buffer *text, size_t start, size_t end, const char *insert, size_t length)
+{
+    struct text_buffer result;
+
+    init_text_buffer(&result);
+    append_text(&result, text->text, start);
+    append_text(&result, insert, length);
+    append_text(&result, text->text + end, text->length - end);
+    release_text_buffer(text);
+    *text = result;
+}
+
+/**
+ * @brief Copies lines, replacing the number ending every name but the registers by the same new number.
+ *
+ * The copy defines new labels instead of redefining them, so it makes the symbol table grow.
+ */
+static void rename_copy(struct text_buffer *copy, const char *text, size_t length)
+{
+    char number[TEMPLATE_SIZE];
+    size_t i = 0, name;
+
+    sprintf(number, "%d", (int)random_below(100000));
+    init_text_buffer(copy);
+    while (i < length)
+    {
+        if (!isalpha((unsigned char)text[i]) || (i > 0 && isalnum((unsigned char)text[i - 1])))
+        {
+            append_text(copy, text + i++, 1);
+            continue;
+        }
+        for (name = i; i < length && isalpha((unsigned char)text[i]); i++)
+            ;
+        append_text(copy, text + name, i - name);
+        if (i < length && isdigit((unsigned char)text[i]) && !(i - name == 1 && text[name] == 'r'))
+        {
+            append_text(copy, number, strlen(number));
+            while (i < length && isdigit((unsigned char)text[i]))
+            {
+                i++;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Applies a random mutation to a source.
+ */
+static void mutate(struct text_buffer *text)
+{
+    struct text_buffer copy;
+    char line[TEMPLATE_SIZE];
+    size_t start = random_line_start(text), end;
+    int i;
+
+    switch (random_below(4))
+    {
+    case 0: /* Insert a line made from a template */
+        sprintf(line, line_templates[random_below(sizeof(line_templates) / sizeof(line_templates[0]))],
+                (int)random_below(100000));
+        splice_text(text, start, start, line, strlen(line));
+        break;
+    case 1: /* Duplicate a run of lines, with new names */
+        end = start;
+        for (i = 1 + (int)random_below(MAX_DUPLICATED_LINES); i > 0; i--)
+        {
+            end = line_end(text, end);
+        }
+        rename_copy(&copy, text->text + start, end - start);
+        splice_text(text, end, end, copy.text, copy.length);
+        release_text_buffer(&copy);
+        break;
+    case 2: /* Remove a line */
+        splice_text(text, start, line_end(text, start), "", 0);
+        break;
+    default: /* Replace a character */
+        if (text->length > 0)
+        {
+            text->text[random_below(text->length)] = (char)(' ' + random_below(95));
+        }
+        break;
+    }
+}
+
+/**
+ * @brief Removes runs of lines from a slow unit while it stays slow.
+ */
+static void minimize(struct harness *h, struct text_buffer *text)
+{
+    struct text_buffer candidate;
+    size_t lines = 0, chunk, start, end, i;
+
+    for (i = 0; i < text->length; i++)
+    {
+        lines += text->text[i] == '\n';
+    }
+    init_text_buffer(&candidate);
+    for (chunk = lines / 2; chunk > 0; chunk /= 2)
+    {
+        for (start = 0; start < text->length; start = end)
+        {
+            for (end = start, i = 0; i < chunk; i++)
+            {
+                end = line_end(text, end);
+            }
+            clear_text_buffer(&candidate);
+            append_text(&candidate, text->text, start);
+            append_text(&candidate, text->text + end, text->length - end);
+            if (is_slow(h, candidate.text, candidate.length, measure(h, candidate.text, candidate.length)))
+            {
+                clear_text_buffer(text);
+                append_text(text, candidate.text, candidate.length);
+                end = start;
+            }
+        }
+    }
+    release_text_buffer(&candidate);
+}
+
+/**
+ * @brief Writes a slow unit to PREFIXslow-unit-HASH, like libFuzzer does.
+ */
+static void write_artifact(const char *prefix, const struct text_buffer *text)
+{
+    struct sha256_context sha;
+    unsigned char digest[SHA256_DIGEST_SIZE];
+    char *path = (char *)allocateMemory(strlen(prefix) + 2 * SHA256_DIGEST_SIZE + 16, sizeof(char), MALLOC_ID);
+    FILE *file;
+    int i;
+
+    sha256_init(&sha);
+    sha256_update(&sha, text->text, text->length);
+    sha256_final(&sha, digest);
+    sprintf(path, "%sslow-unit-", prefix);
+    for (i = 0; i < SHA256_DIGEST_SIZE; i++)
+    {
+        sprintf(path + strlen(path), "%02x", digest[i]);
+    }
+
+    file = fopen(path, "wb");
+    if (file == NULL || fwrite(text->text, 1, text->length, file) != text->length || fclose(file) != 0)
+    {
+        fprintf(stderr, "Error: Unable to write %s\n", path);
+    }
+    else
+    {
+        fprintf(stderr, "Slow unit written to %s\n", path);
+    }
+    free(path);
+}
+
+/**
+ * @brief Reads a seed file into a text buffer.
+ *
+ * @return int Returns 1 if the file was read, otherwise 0.
+ */
+static int read_seed(const char *path, struct text_buffer *text)
+{
+    FILE *file = fopen(path, "rb");
+
+    if (file == NULL)
+    {
+        fprintf(stderr, "Error: Unable to open %s\n", path);
+        return 0;
+    }
+    init_text_buffer(text);
+    read_text_file(text, file);
+    fclose(file);
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    static struct text_buffer corpus[CORPUS_LIMIT];
+    double corpus_cost[CORPUS_LIMIT];
+    struct harness h;
+    struct text_buffer mutant;
+    const char *prefix = "";
+    long runs = DEFAULT_RUNS, max_len = DEFAULT_MAX_LEN, run;
+    double cost, best = 0;
+    int corpus_counter = 0, i, parent, result = 0;
+
+    init_harness(&h);
+    for (i = 1; i < argc; i++)
+    {
+        if (strncmp(argv[i], "-runs=", 6) == 0)
+        {
+            runs = atol(argv[i] + 6);
+        }
+        else if (strncmp(argv[i], "-max_len=", 9) == 0)
+        {
+            max_len = atol(argv[i] + 9);
+        }
+        else if (strncmp(argv[i], "-seed=", 6) == 0)
+        {
+            rng_state = (unsigned long)atol(argv[i] + 6) | 1;
+        }
+        else if (strncmp(argv[i], "-artifact_prefix=", 17) == 0)
+        {
+            prefix = argv[i] + 17;
+        }
+        else if (argv[i][0] == '-')
+        {
+            fprintf(stderr, "Usage: %s [-runs=N] [-max_len=N] [-seed=N] [-artifact_prefix=PATH] [FILE...]\n", argv[0]);
+            return 2;
+        }
+        else if (corpus_counter < CORPUS_LIMIT && read_seed(argv[i], &corpus[corpus_counter]))
+        {
+            corpus_counter++;
+        }
+    }
+    if (corpus_counter == 0)
+    {
+        init_text_buffer(&corpus[corpus_counter++]);
+    }
+    /* A seed can already be a slow unit */
+    init_text_buffer(&mutant);
+    for (i = 0; i < corpus_counter && result == 0; i++)
+    {
+        cost = measure(&h, corpus[i].text, corpus[i].length);
+        corpus_cost[i] = cost / (corpus[i].length + MIN_MEASURED_SIZE);
+        if (is_slow(&h, corpus[i].text, corpus[i].length, cost))
+        {
+            append_text(&mutant, corpus[i].text, corpus[i].length);
+            minimize(&h, &mutant);
+            report_slow_unit(&h, mutant.text, mutant.length);
+            write_artifact(prefix, &mutant);
+            result = 1;
+        }
+    }
+
+    for (run = 1; run <= runs && result == 0; run++)
+    {
+        parent = (int)random_below(corpus_counter);
+        clear_text_buffer(&mutant);
+        append_text(&mutant, corpus[parent].text, corpus[parent].length);
+        mutate(&mutant);
+        if ((long)mutant.length > max_len)
+        {
+            continue;
+        }
+
+        cost = measure(&h, mutant.text, mutant.length);
+        if (is_slow(&h, mutant.text, mutant.length, cost))
+        {
+            minimize(&h, &mutant);
+            report_slow_unit(&h, mutant.text, mutant.length);
+            write_artifact(prefix, &mutant);
+            result = 1;
+        }
+        else if (cost / (mutant.length + MIN_MEASURED_SIZE) >= corpus_cost[parent])
+        {
+            /* Keep the mutant, in a new slot while there is room, otherwise instead of its parent */
+            i = (corpus_counter < CORPUS_LIMIT) ? corpus_counter++ : parent;
+            if (i == parent)
+            {
+                release_text_buffer(&corpus[i]);
+            }
+            init_text_buffer(&corpus[i]);
+            append_text(&corpus[i], mutant.text, mutant.length);
+            corpus_cost[i] = cost / (mutant.length + MIN_MEASURED_SIZE);
+            if (corpus_cost[i] > best)
+            {
+                best = corpus_cost[i];
+            }
+        }
+
+        if (run % REPORT_EVERY == 0)
+        {
+            fprintf(stderr, "#%ld corpus: %d, highest cost per byte: %.1f\n", run, corpus_counter, best);
+        }
+    }
+
+    for (i = 0; i < corpus_counter; i++)
+    {
+        release_text_buffer(&corpus[i]);
+    }
+    release_text_buffer(&mutant);
+    release_context(&h.ctx);
+    release_text_buffer(&h.source);
+    release_text_buffer(&h.message);
+    fclose(h.diagnostics);
+    fclose(h.outputs);
+    free(h.diagnostics_buffer);
+    free(h.outputs_buffer);
+    return result;
+}
+
+#endif
@@ -1,4 +1,6 @@
+#define ALLOC_CATEGORY ALLOC_SYMBOLS /* Allocations counted by TRACK_ALLOCATIONS builds */
 #include "symbolTable.h"
+#include "stats.h"
 
 /**
  * @brief a new symbol to the symbol table.
@@ -13,14 +15,26 @@
  * @param new_address  The address associated with the new symbol.
  * @param ptr          A pointer to the head of the symbol table. The function will
  *                     update this pointer if the table was empty.
+ * @param pool         A pointer to a list of unused symbols. A symbol is taken from it
+ *                     instead of being allocated when it is not empty.
  */
-void add_symbol_to_table(char new_name[MAX_SYMBOL_NAME], int new_type, int new_address, table_ptr *ptr)
+void add_symbol_to_table(char new_name[MAX_SYMBOL_NAME], int new_type, int new_address, table_ptr *ptr, table_ptr *pool)
 {
     table_ptr new_symbol;
     table_ptr current;
 
-    /* Allocate memory for the new symbol */
-    new_symbol = (table_ptr)allocateMemory(1, sizeof(symbol_table), MALLOC_ID);
+    COUNT_STAT(symbol_inserts, 1);
+
+    /* Reuse a symbol of a previous file, or allocate memory for the new symbol */
+    if (*pool != NULL)
+    {
+        new_symbol = *pool;
+        *pool = new_symbol->next;
+    }
+    else
+    {
+        new_symbol = (table_ptr)allocateMemory(1, sizeof(symbol_table), MALLOC_ID);
+    }
 
     strcpy(new_symbol->symbol_name, new_name);
     new_symbol->symbol_type = (enum type)new_type;
@@ -44,6 +58,10 @@ void add_symbol_to_table(char new_name[MAX_SYMBOL_NAME], int new_type, int new_a
     }
 }
 
+/* Extern usages are counted apart from the symbols */
+#undef ALLOC_CATEGORY
+#define ALLOC_CATEGORY ALLOC_EXTERNS
+
 /**
  * @brief a new extern symbol to the extern usage table.
  *
@@ -55,12 +73,25 @@ void add_symbol_to_table(char new_name[MAX_SYMBOL_NAME], int new_type, int new_a
  * @param new_address  The address where the extern symbol is used.
  * @param ptr          A pointer to the head of the extern addresses table. The function
  *                     will update this pointer if the table was empty.
+ * @param pool         A pointer to a list of unused extern entries. An entry is taken from
+ *                     it instead of being allocated when it is not empty.
  */
-void add_symbol_to_extern_usage(char new_name[MAX_SYMBOL_NAME], int new_address, extern_addresses_ptr *ptr)
+void add_symbol_to_extern_usage(char new_name[MAX_SYMBOL_NAME], int new_address, extern_addresses_ptr *ptr, extern_addresses_ptr *pool)
 {
+    extern_addresses_ptr new_extern;
 
-    /* Allocate memory for the new extern entry */
-    extern_addresses_ptr new_extern = (extern_addresses_ptr)allocateMemory(1, sizeof(extern_addresses), MALLOC_ID);
+    COUNT_STAT(symbol_inserts, 1);
+
+    /* Reuse an entry of a previous file, or allocate memory for the new extern entry */
+    if (*pool != NULL)
+    {
+        new_extern = *pool;
+        *pool = new_extern->next;
+    }
+    else
+    {
+        new_extern = (extern_addresses_ptr)allocateMemory(1, sizeof(extern_addresses), MALLOC_ID);
+    }
 
     /* Set the extern entry's attributes */
     strcpy(new_extern->name, new_name);
@@ -69,10 +100,7 @@ void add_symbol_to_extern_usage(char new_name[MAX_SYMBOL_NAME], int new_address,
     new_extern->next = NULL;
 
     /* The table is empty */
-    /*if(*ptr == NULL) {
-        *ptr = new_extern;
-    }*/
-    if (strcmp((*ptr)->name, "") == 0)
+    if (*ptr == NULL)
     {
         *ptr = new_extern;
     }
@@ -116,3 +144,54 @@ void free_symbol_table(table_ptr *head)
 
     *head = NULL;
 }
+
+/**
+ * @brief Moves all the symbols of the symbol table to a list of unused symbols.
+ *
+ * The symbols are reused by add_symbol_to_table, so a table that is filled again
+ * for the next file does not allocate memory.
+ *
+ * @param head  A pointer to the head of the symbol table. It is set to NULL.
+ * @param pool  A pointer to the head of the list of unused symbols.
+ */
+void recycle_symbol_table(table_ptr *head, table_ptr *pool)
+{
+    table_ptr last = *head;
+
+    if (last == NULL)
+    {
+        return;
+    }
+
+    while (last->next != NULL)
+    {
+        last = last->next;
+    }
+    last->next = *pool;
+    *pool = *head;
+    *head = NULL;
+}
+
+/**
+ * @brief Moves all the entries of the extern usage table to a list of unused entries.
+ *
+ * @param head  A pointer to the head of the extern usage table. It is set to NULL.
+ * @param pool  A pointer to the head of the list of unused entries.
+ */
+void recycle_extern_table(extern_addresses_ptr *head, extern_addresses_ptr *pool)
+{
+    extern_addresses_ptr last = *head;
+
+    if (last == NULL)
+    {
+        return;
+    }
+
+    while (last->next != NULL)
+    {
+        last = last->next;
+    }
+    last->next = *pool;
+    *pool = *head;
+    *head = NULL;
+}
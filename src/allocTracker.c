@@ -0,0 +1,270 @@
+#include <pthread.h>
+#include "helpingFunction.h"
+#include "allocTracker.h"
+
+/* The tracker calls the functions the macros of helpingFunction.h stand for */
+#undef allocateMemory
+#undef reallocateMemory
+#undef free
+
+/**
+ * @brief A live block in the table of the tracker.
+ */
+struct tracked_block
+{
+    void *ptr;    /* The block, or NULL for an empty slot */
+    size_t size;  /* Its size in bytes */
+    int category; /* The category it was allocated in */
+};
+
+/**
+ * @brief The counters of a category.
+ */
+struct category_usage
+{
+    long allocations; /* Blocks allocated or resized */
+    long bytes;       /* Bytes requested by those calls */
+    long live;        /* Bytes currently allocated */
+    long peak;        /* Highest value of live */
+    long blocks;      /* Blocks currently allocated */
+};
+
+static const char *category_names[ALLOC_CATEGORY_COUNT] = {"other", "symbols", "externs", "macros", "tokenizer",
+                                                           "parser", "code", "text", "output"};
+
+static pthread_mutex_t tracker_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct tracked_block *blocks = NULL;         /* Open addressing table of the live blocks */
+static size_t table_size = 0;                       /* Number of slots, a power of two */
+static size_t used_slots = 0;                       /* Number of live blocks */
+static struct category_usage usage[ALLOC_CATEGORY_COUNT];
+static long live_bytes = 0;                         /* Bytes currently allocated, in all categories */
+static long peak_live_bytes = 0;                    /* Highest value of live_bytes */
+
+/**
+ * @brief Returns the first slot a block is looked up at.
+ */
+static size_t slot_of(const void *ptr)
+{
+    size_t key = (size_t)ptr;
+
+    key ^= key >> 4; /* Blocks are aligned, the low bits carry little information */
+    key *= 2654435761UL;
+    return (key ^ (key >> 15)) & (table_size - 1);
+}
+
+/**
+ * @brief Returns the slot holding a block, or the empty slot it would go to.
+ */
+static size_t find_slot(const void *ptr)
+{
+    size_t i = slot_of(ptr);
+
+    while (blocks[i].ptr != NULL && blocks[i].ptr != ptr)
+    {
+        i = (i + 1) & (table_size - 1);
+    }
+    return i;
+}
+
+/**
+ * @brief Doubles the table once it is half full. Must be called with the lock held.
+ */
+static void grow_table(void)
+{
+    struct tracked_block *old_blocks = blocks;
+    size_t old_size = table_size, i;
+
+    table_size = (table_size == 0) ? TRACKER_INITIAL_SIZE : table_size * 2;
+    blocks = (struct tracked_block *)calloc(table_size, sizeof(struct tracked_block));
+    if (blocks == NULL)
+    {
+        failureExit("Memory allocation failed");
+    }
+    for (i = 0; i < old_size; i++)
+    {
+        if (old_blocks[i].ptr != NULL)
+        {
+            blocks[find_slot(old_blocks[i].ptr)] = old_blocks[i];
+        }
+    }
+    free(old_blocks);
+}
+
+/**
+ * @brief Records a new block. Must be called with the lock held.
+ */
+static void insert_block(void *ptr, size_t size, int category)
+{
+    struct category_usage *counters = &usage[category];
+    size_t i;
+
+    if ((used_slots + 1) * 2 > table_size)
+    {
+        grow_table();
+    }
+    i = find_slot(ptr);
+    blocks[i].ptr = ptr;
+    blocks[i].size = size;
+    blocks[i].category = category;
+    used_slots++;
+
+    counters->allocations++;
+    counters->bytes += (long)size;
+    counters->live += (long)size;
+    counters->blocks++;
+    if (counters->live > counters->peak)
+    {
+        counters->peak = counters->live;
+    }
+    live_bytes += (long)size;
+    if (live_bytes > peak_live_bytes)
+    {
+        peak_live_bytes = live_bytes;
+    }
+}
+
+/**
+ * @brief Forgets a block. Must be called with the lock held.
+ *
+ * The blocks following it in the same run of slots move back, so that lookups
+ * never stop at the emptied slot before reaching them.
+ *
+ * @return int Returns 1 if the block was tracked, otherwise 0.
+ */
+static int remove_block(const void *ptr)
+{
+    size_t i, j, home;
+
+    if (ptr == NULL || table_size == 0 || blocks[i = find_slot(ptr)].ptr == NULL)
+    {
+        return 0;
+    }
+    usage[blocks[i].category].live -= (long)blocks[i].size;
+    usage[blocks[i].category].blocks--;
+    live_bytes -= (long)blocks[i].size;
+    used_slots--;
+
+    blocks[i].ptr = NULL;
+    for (j = (i + 1) & (table_size - 1); blocks[j].ptr != NULL; j = (j + 1) & (table_size - 1))
+    {
+        home = slot_of(blocks[j].ptr);
+        /* The block stays if its home slot lies cyclically in (i, j] */
+        if ((i <= j) ? (i < home && home <= j) : (i < home || home <= j))
+        {
+            continue;
+        }
+        blocks[i] = blocks[j];
+        blocks[j].ptr = NULL;
+        i = j;
+    }
+    return 1;
+}
+
+/**
+ * @brief Allocates memory through allocateMemory and records it.
+ *
+ * @param numElements Number of elements to allocate.
+ * @param sizeOfElement Size of each element.
+ * @param functionID MALLOC_ID or CALLOC_ID.
+ * @param category The category of the caller, one of enum alloc_category.
+ * @return void* Pointer to the allocated memory.
+ */
+void *track_allocate(size_t numElements, size_t sizeOfElement, int functionID, int category)
+{
+    void *ptr = allocateMemory(numElements, sizeOfElement, functionID);
+
+    pthread_mutex_lock(&tracker_lock);
+    insert_block(ptr, numElements * sizeOfElement, category);
+    pthread_mutex_unlock(&tracker_lock);
+    return ptr;
+}
+
+/**
+ * @brief Resizes memory through reallocateMemory and records it.
+ *
+ * @param ptr The block to resize, or NULL.
+ * @param numElements Number of elements the block must hold.
+ * @param sizeOfElement Size of each element.
+ * @param category The category of the caller, one of enum alloc_category.
+ * @return void* Pointer to the resized memory.
+ */
+void *track_reallocate(void *ptr, size_t numElements, size_t sizeOfElement, int category)
+{
+    pthread_mutex_lock(&tracker_lock);
+    remove_block(ptr);
+    pthread_mutex_unlock(&tracker_lock);
+
+    ptr = reallocateMemory(ptr, numElements, sizeOfElement);
+
+    pthread_mutex_lock(&tracker_lock);
+    insert_block(ptr, numElements * sizeOfElement, category);
+    pthread_mutex_unlock(&tracker_lock);
+    return ptr;
+}
+
+/**
+ * @brief Forgets a block and frees it.
+ *
+ * Blocks the tracker never saw, such as the buffers of open_memstream, are freed as well.
+ *
+ * @param ptr The block to free, or NULL.
+ */
+void track_free(void *ptr)
+{
+    if (ptr != NULL)
+    {
+        pthread_mutex_lock(&tracker_lock);
+        remove_block(ptr);
+        pthread_mutex_unlock(&tracker_lock);
+    }
+    free(ptr);
+}
+
+/**
+ * @brief Returns the number of bytes currently allocated.
+ */
+long tracked_live_bytes(void)
+{
+    long bytes;
+
+    pthread_mutex_lock(&tracker_lock);
+    bytes = live_bytes;
+    pthread_mutex_unlock(&tracker_lock);
+    return bytes;
+}
+
+/**
+ * @brief Prints the counters of every category, and the blocks never freed.
+ *
+ * Ends the tracking: blocks freed afterwards are freed without being looked up.
+ *
+ * @param stream The stream to print to.
+ */
+void print_allocation_report(FILE *stream)
+{
+    struct category_usage total;
+    int i;
+
+    pthread_mutex_lock(&tracker_lock);
+    memset(&total, 0, sizeof(total));
+    fprintf(stream, "%-12s %12s %14s %14s %12s\n", "Allocations", "count", "bytes", "peak live", "leaked");
+    for (i = 0; i < ALLOC_CATEGORY_COUNT; i++)
+    {
+        fprintf(stream, "%-12s %12ld %14ld %14ld %12ld\n", category_names[i], usage[i].allocations, usage[i].bytes,
+                usage[i].peak, usage[i].live);
+        total.allocations += usage[i].allocations;
+        total.bytes += usage[i].bytes;
+        total.blocks += usage[i].blocks;
+    }
+    fprintf(stream, "%-12s %12ld %14ld %14ld %12ld\n", "total", total.allocations, total.bytes, peak_live_bytes,
+            live_bytes);
+    if (total.blocks > 0)
+    {
+        fprintf(stream, "Leaked: %ld bytes in %ld blocks\n", live_bytes, total.blocks);
+    }
+
+    free(blocks);
+    blocks = NULL;
+    table_size = used_slots = 0;
+    pthread_mutex_unlock(&tracker_lock);
+}
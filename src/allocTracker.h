@@ -0,0 +1,36 @@
+#ifndef ALLOCTRACKER_H
+#define ALLOCTRACKER_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+#define TRACKER_INITIAL_SIZE 1024 /* Initial number of slots of the table of live blocks, a power of two */
+
+/**
+ * @brief The categories allocations are counted in.
+ *
+ * A source file selects its category by defining ALLOC_CATEGORY before its includes.
+ * Files that do not define it count as ALLOC_OTHER.
+ */
+enum alloc_category
+{
+    ALLOC_OTHER,     /* Options, run state, threads, server */
+    ALLOC_SYMBOLS,   /* The symbol table */
+    ALLOC_EXTERNS,   /* The extern usage table */
+    ALLOC_MACROS,    /* The macro table */
+    ALLOC_TOKENIZER, /* Line indexes and mapped sources */
+    ALLOC_PARSER,    /* The passes and the line parser */
+    ALLOC_CODE,      /* The code and data images */
+    ALLOC_TEXT,      /* Text buffers: sources, macro bodies, .am text */
+    ALLOC_OUTPUT,    /* Output file names and pending outputs */
+    ALLOC_CATEGORY_COUNT
+};
+
+/* Prototypes */
+void *track_allocate(size_t numElements, size_t sizeOfElement, int functionID, int category);
+void *track_reallocate(void *ptr, size_t numElements, size_t sizeOfElement, int category);
+void track_free(void *ptr);
+long tracked_live_bytes(void);
+void print_allocation_report(FILE *stream);
+
+#endif
@@ -1,45 +1,339 @@
+#define _POSIX_C_SOURCE 200809L /* open_memstream, clock_gettime, stat */
+#include <time.h>
+#include <sys/stat.h>
 #include "assembler.h"
 
+/**
+ * @brief The source size and the time taken by a single input file.
+ */
+struct file_timing
+{
+    const char *name;  /* The name of the file */
+    long size;         /* The size of its source, in bytes */
+    double elapsed_ms; /* The time it took to assemble, in milliseconds */
+    int worker;        /* The index of the worker that assembled it */
+};
+
+/**
+ * @brief Structure holding the state of a run over all the input files.
+ */
+struct assembly_run
+{
+    struct assembler_options *options; /* The command line options */
+    assembler_context *contexts;       /* One context per worker, reused between files */
+    struct build_cache cache;          /* The build cache, when --cache is given */
+    struct io_pipeline pipeline;       /* The I/O threads, when --prefetch is given */
+    char **diagnostics;                /* Buffered diagnostics of each file, when files run in parallel */
+    size_t *diagnostics_size;          /* Size of each buffered diagnostics */
+    struct file_timing *timings;       /* The size and time of each file */
+    struct file_stats *stats;          /* The statistics of each file, when --stats is given */
+    int *words_saved;                  /* The words the optimizations saved in each file, when -O is given */
+#ifdef TRACK_ALLOCATIONS
+    long *live_bytes;                  /* Bytes allocated after each file, and the growth during it */
+#endif
+};
+
+/**
+ * @brief Returns the time of a monotonic clock in milliseconds.
+ */
+static double now_ms(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+/**
+ * @brief Assembles a single input file on a worker.
+ *
+ * When files run in parallel, the diagnostics of the file are buffered in memory
+ * until print_diagnostics prints them in argument order. They are also buffered
+ * with a build cache, which needs to know whether a file had diagnostics.
+ *
+ * @param job_index The index of the file in the options.
+ * @param worker_index The index of the worker, selecting its context.
+ * @param arg Pointer to the assembly_run structure.
+ */
+static void assemble_job(int job_index, int worker_index, void *arg)
+{
+    struct assembly_run *run = (struct assembly_run *)arg;
+    context_ptr ctx = &run->contexts[worker_index];
+    struct trace_thread thread;
+    double start = now_ms();
+#ifdef TRACK_ALLOCATIONS
+    long live_before = tracked_live_bytes();
+#endif
+
+    ctx->file_index = job_index;
+    if (run->stats != NULL)
+    {
+        bind_stats(&run->stats[job_index]);
+    }
+    if (trace_enabled)
+    {
+        thread.file = run->options->files[job_index];
+        thread.tid = worker_index + 1;
+        bind_trace(&thread);
+    }
+    if (run->options->jobs > 1 || run->options->cache_dir != NULL)
+    {
+        ctx->diagnostics = open_memstream(&run->diagnostics[job_index], &run->diagnostics_size[job_index]);
+        if (ctx->diagnostics == NULL)
+        {
+            ctx->diagnostics = stdout;
+        }
+    }
+
+    assemble_file(ctx, run->options->files[job_index], NULL);
+    if (run->words_saved != NULL)
+    {
+        run->words_saved[job_index] = ctx->words_saved;
+    }
+
+    if (ctx->diagnostics != stdout)
+    {
+        fclose(ctx->diagnostics);
+        ctx->diagnostics = stdout;
+    }
+
+    run->timings[job_index].elapsed_ms = now_ms() - start;
+    if (run->stats != NULL)
+    {
+        bind_stats(NULL);
+    }
+    if (trace_enabled)
+    {
+        trace_span("assemble", start, start + run->timings[job_index].elapsed_ms);
+        bind_trace(NULL);
+    }
+    run->timings[job_index].worker = worker_index;
+#ifdef TRACK_ALLOCATIONS
+    run->live_bytes[2 * job_index] = tracked_live_bytes();
+    run->live_bytes[2 * job_index + 1] = run->live_bytes[2 * job_index] - live_before;
+#endif
+}
+
+/**
+ * @brief Prints the buffered diagnostics of a file once it is done.
+ *
+ * @param job_index The index of the file in the options.
+ * @param worker_index Unused.
+ * @param arg Pointer to the assembly_run structure.
+ */
+static void print_diagnostics(int job_index, int worker_index, void *arg)
+{
+    struct assembly_run *run = (struct assembly_run *)arg;
+
+    if (run->diagnostics[job_index])
+    {
+        fwrite(run->diagnostics[job_index], 1, run->diagnostics_size[job_index], stdout);
+        free(run->diagnostics[job_index]);
+        run->diagnostics[job_index] = NULL;
+    }
+    /* Files restored from the cache or with errors were not optimized */
+    if (run->words_saved != NULL && run->words_saved[job_index] >= 0)
+    {
+        fprintf(stderr, "Optimized %s: %d words saved\n", run->options->files[job_index], run->words_saved[job_index]);
+    }
+#ifdef TRACK_ALLOCATIONS
+    /* With several workers, the growth includes the allocations of the files assembled meanwhile */
+    fprintf(stderr, "Memory: %s: %ld bytes live, %+ld bytes kept\n", run->options->files[job_index],
+            run->live_bytes[2 * job_index], run->live_bytes[2 * job_index + 1]);
+#endif
+}
+
+/**
+ * @brief Orders file timings from the slowest, then by name, for qsort.
+ */
+static int compare_timings(const void *a, const void *b)
+{
+    const struct file_timing *x = (const struct file_timing *)a;
+    const struct file_timing *y = (const struct file_timing *)b;
+
+    if (x->elapsed_ms != y->elapsed_ms)
+    {
+        return (x->elapsed_ms < y->elapsed_ms) - (x->elapsed_ms > y->elapsed_ms);
+    }
+    return strcmp(x->name, y->name);
+}
+
+/**
+ * @brief Prints the time taken by every file on stderr, the slowest first.
+ *
+ * @param run The finished run. Its timings are sorted.
+ * @param elapsed_ms The time taken by the whole run, in milliseconds.
+ */
+static void print_timings(struct assembly_run *run, double elapsed_ms)
+{
+    int i;
+
+    qsort(run->timings, run->options->files_counter, sizeof(struct file_timing), compare_timings);
+    fprintf(stderr, "Timings: %d files on %d workers in %.3f ms\n", run->options->files_counter, run->options->jobs, elapsed_ms);
+    fprintf(stderr, "%10s %10s %6s  %s\n", "ms", "bytes", "worker", "file");
+    for (i = 0; i < run->options->files_counter; i++)
+    {
+        fprintf(stderr, "%10.3f %10ld %6d  %s\n", run->timings[i].elapsed_ms, run->timings[i].size,
+                run->timings[i].worker, run->timings[i].name);
+    }
+}
+
 int main(int argc, char **argv)
 {
-    int i, err_flag = 0;
-    char *amFileName = NULL;
-    struct MacroContext macro_table;
-    extern_addresses extern_usage = {0};
-    FILE *am_file = NULL;
+    int i;
+    struct assembler_options options;
+    struct assembly_run run;
+    struct stat source_info;
+    char *source_name;
+    long *weights;
+    int *order = NULL;
+    int status = 0;
+    double start = now_ms();
+
+    if (!parse_options(argc, argv, &options))
+    {
+        free_options(&options);
+        return 1;
+    }
+
+    /* Server and client modes */
+    if (options.serve_path != NULL || options.client_path != NULL)
+    {
+        i = (options.serve_path != NULL) ? run_server(&options) : run_client(&options);
+        free_options(&options);
+        return i;
+    }
+    if (options.stream)
+    {
+        i = run_stream(&options);
+        free_options(&options);
+        return i;
+    }
+
+    if (options.jobs > options.files_counter)
+    {
+        options.jobs = options.files_counter > 0 ? options.files_counter : 1;
+    }
+
+    run.options = &options;
+    if (options.cache_dir != NULL && !init_build_cache(&run.cache, options.cache_dir, options.cache_size))
+    {
+        free_options(&options);
+        return 1;
+    }
+    run.contexts = (assembler_context *)allocateMemory(options.jobs, sizeof(assembler_context), MALLOC_ID);
+    run.diagnostics = (char **)allocateMemory(options.files_counter + 1, sizeof(char *), CALLOC_ID);
+    run.diagnostics_size = (size_t *)allocateMemory(options.files_counter + 1, sizeof(size_t), CALLOC_ID);
+    run.timings = (struct file_timing *)allocateMemory(options.files_counter + 1, sizeof(struct file_timing), CALLOC_ID);
+    run.stats = NULL;
+    if (options.stats)
+    {
+        enable_stats();
+        run.stats = (struct file_stats *)allocateMemory(options.files_counter + 1, sizeof(struct file_stats), CALLOC_ID);
+    }
+    run.words_saved = NULL;
+    if (options.optimizations)
+    {
+        run.words_saved = (int *)allocateMemory(options.files_counter + 1, sizeof(int), CALLOC_ID);
+    }
+#ifdef TRACK_ALLOCATIONS
+    run.live_bytes = (long *)allocateMemory(2 * options.files_counter + 2, sizeof(long), CALLOC_ID);
+#endif
+    if (options.trace_path != NULL)
+    {
+        enable_trace(start);
+    }
+    weights = (long *)allocateMemory(options.files_counter + 1, sizeof(long), CALLOC_ID);
+    for (i = 0; i < options.jobs; i++)
+    {
+        init_context(&run.contexts[i], &options, stdout);
+        if (options.cache_dir != NULL)
+        {
+            run.contexts[i].cache = &run.cache;
+        }
+        if (options.prefetch)
+        {
+            run.contexts[i].pipeline = &run.pipeline;
+        }
+    }
 
-    /* Iterate over input parameters */
-    for (i = 1; i < argc; i++)
+    /* The size of a source is the expected cost of assembling it */
+    for (i = 0; i < options.files_counter; i++)
     {
-        amFileName = macro_processing(argv[i], &macro_table); /* Create am file*/
-        if (amFileName)
-        {                                         /* If file created successfully without errors */
-            am_file = open_file(amFileName, "r"); /* Open am file for read mode */
-            if (am_file)
+        run.timings[i].name = options.files[i];
+        if (options.jobs > 1 || options.timings || options.manifest_path != NULL)
+        {
+            source_name = (char *)allocateMemory(strlen(options.files[i]) + 4, sizeof(char), MALLOC_ID);
+            strcpy(source_name, options.files[i]);
+            strcat(source_name, ".as");
+            if (stat(source_name, &source_info) == 0)
             {
-                if (firstPass(argv[i], am_file, &macro_table) != 1)
-                { /* Run first pass */
-                    /* Firstpass success */
-                    rewind(am_file); /* Rewind file pointer */
-                    extern_usage = *(secondPass(argv[i], am_file, &extern_usage, &err_flag));
-                    if (err_flag != 1)
-                    { /* Run second pass */
-                        /* Secondpass success */
-                        createEntFile(argv[i]);                /* Create ent file */
-                        createExtFile(argv[i], &extern_usage); /* Create ext file */
-                        createObFile(argv[i]);                 /* Create ob file */
-                    }
-                }
-                fclose(am_file); /* Close file */
+                run.timings[i].size = (long)source_info.st_size;
             }
-            /* Freeing variables */
-            free(amFileName);
-            free_macro_ctx_table(&macro_table);
-            free_symbol_table(&head_ptr);
-            free_extern_table(&extern_usage);
-            free_machine_code(machine_code_ptr);
+            weights[i] = run.timings[i].size;
+            free(source_name);
+        }
+    }
+
+    /* Assemble the input files, the largest first, printing their diagnostics in argument order */
+    if (options.prefetch)
+    {
+        /* The reader follows the order the workers take the files in */
+        if (options.jobs > 1)
+        {
+            order = (int *)allocateMemory(options.files_counter + 1, sizeof(int), MALLOC_ID);
+            sort_jobs_by_weight(options.files_counter, weights, order);
         }
+        start_io_pipeline(&run.pipeline, options.files, order, options.files_counter);
+    }
+    run_weighted_jobs(options.files_counter, options.jobs, weights, assemble_job, print_diagnostics, &run);
+    if (options.prefetch)
+    {
+        stop_io_pipeline(&run.pipeline);
     }
 
-    return 0;
+    /* A batch run from a manifest ends with the time taken by every file */
+    if (options.timings || options.manifest_path != NULL)
+    {
+        print_timings(&run, now_ms() - start);
+    }
+    if (run.stats != NULL)
+    {
+        print_stats(stderr, options.stats, options.files, run.stats, options.files_counter);
+    }
+    if (options.trace_path != NULL && !write_trace(options.trace_path))
+    {
+        status = 1;
+    }
+
+    if (options.cache_dir != NULL)
+    {
+        evict_build_cache(&run.cache);
+        if (options.cache_stats)
+        {
+            print_cache_stats(&run.cache, stderr);
+        }
+        release_build_cache(&run.cache);
+    }
+
+    for (i = 0; i < options.jobs; i++)
+    {
+        release_context(&run.contexts[i]);
+    }
+    free(run.contexts);
+    free(run.diagnostics);
+    free(run.diagnostics_size);
+    free(run.timings);
+    free(run.stats);
+    free(run.words_saved);
+    free(weights);
+    free(order);
+#ifdef TRACK_ALLOCATIONS
+    free(run.live_bytes);
+#endif
+    free_options(&options);
+#ifdef TRACK_ALLOCATIONS
+    print_allocation_report(stderr);
+#endif
+    return status;
 }
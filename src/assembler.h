@@ -5,5 +5,11 @@
 #include "firstPass.h"
 #include "secondPass.h"
 #include "output.h"
+#include "options.h"
+#include "assemblerContext.h"
+#include "threadPool.h"
+#include "server.h"
+#include "streamMode.h"
+#include "trace.h"
 
 #endif
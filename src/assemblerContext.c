@@ -0,0 +1,234 @@
+#include "assemblerContext.h"
+#include "macroProcessing.h"
+#include "firstPass.h"
+#include "secondPass.h"
+#include "output.h"
+#include "trace.h"
+
+/**
+ * @brief Initializes an empty assembler context.
+ *
+ * @param ctx Pointer to the context to initialize.
+ * @param options The command line options the files are assembled with.
+ * @param diagnostics The stream errors are written to.
+ */
+void init_context(context_ptr ctx, const struct assembler_options *options, FILE *diagnostics)
+{
+    ctx->symbol_table = NULL;
+    ctx->symbol_pool = NULL;
+    ctx->extern_usage = NULL;
+    ctx->extern_pool = NULL;
+    init_machine_code(&ctx->machine_code, options->mem_size);
+    init_macro_ctx_table(&ctx->macro_table);
+    init_mapped_text(&ctx->source);
+    init_text_buffer(&ctx->source_text);
+    init_line_index(&ctx->source_lines);
+    init_text_buffer(&ctx->am_text);
+    init_line_index(&ctx->am_lines);
+    init_text_buffer(&ctx->cache_entry);
+    ctx->cache = NULL;
+    ctx->pipeline = NULL;
+    ctx->file_index = -1;
+    ctx->diagnostics = diagnostics;
+    init_error_buffer(&ctx->errors, options->max_errors);
+    ctx->skip_unchanged = options->skip_unchanged;
+    ctx->optimizations = options->optimizations;
+    init_optimizer(&ctx->optimizer);
+    ctx->words_saved = -1;
+}
+
+/**
+ * @brief Empties the state of the last assembled file so the context can be reused.
+ *
+ * The memory is kept for the next file: the symbols are moved to the pools and
+ * the buffers, line indexes and images only have their lengths reset. A mapped
+ * source is unmapped.
+ *
+ * @param ctx Pointer to the context to reset.
+ */
+void reset_context(context_ptr ctx)
+{
+    free_macro_ctx_table(&ctx->macro_table);
+    recycle_symbol_table(&ctx->symbol_table, &ctx->symbol_pool);
+    recycle_extern_table(&ctx->extern_usage, &ctx->extern_pool);
+    free_machine_code(&ctx->machine_code);
+    unmap_text(&ctx->source);
+    clear_text_buffer(&ctx->source_text);
+    clear_line_index(&ctx->source_lines);
+    clear_text_buffer(&ctx->am_text);
+    clear_line_index(&ctx->am_lines);
+    clear_text_buffer(&ctx->cache_entry);
+    clear_optimizer(&ctx->optimizer);
+    ctx->errors.counter = 0;
+}
+
+/**
+ * @brief Frees all the memory held by a context.
+ *
+ * @param ctx Pointer to the context to release.
+ */
+void release_context(context_ptr ctx)
+{
+    reset_context(ctx);
+    free_symbol_table(&ctx->symbol_pool);
+    free_extern_table(&ctx->extern_pool);
+    release_macro_ctx_table(&ctx->macro_table);
+    release_machine_code(&ctx->machine_code);
+    release_text_buffer(&ctx->source_text);
+    release_line_index(&ctx->source_lines);
+    release_text_buffer(&ctx->am_text);
+    release_line_index(&ctx->am_lines);
+    release_text_buffer(&ctx->cache_entry);
+    release_error_buffer(&ctx->errors);
+    release_optimizer(&ctx->optimizer);
+}
+
+/**
+ * @brief Records the size of the symbol table and of the images in the trace.
+ *
+ * @param ctx Pointer to the context, after its second pass.
+ */
+static void trace_sizes(context_ptr ctx)
+{
+    table_ptr symbol;
+    long symbols = 0;
+
+    for (symbol = ctx->symbol_table; symbol != NULL; symbol = symbol->next)
+    {
+        symbols++;
+    }
+    trace_counter("symbols", "count", symbols);
+    trace_counter("image", "code words", ctx->machine_code.IC ? ctx->machine_code.IC - TARGET_LOAD_BASE : 0);
+    trace_counter("image", "data words", ctx->machine_code.DC);
+}
+
+/**
+ * @brief Runs both passes over the pre-processed text of the context.
+ *
+ * The optimizations of the context run between the passes and record the words they saved.
+ * The errors of the passes are printed to the diagnostics of the context when they are done.
+ * The assembler program and the library both assemble through this function.
+ *
+ * @param ctx Pointer to the context, holding the text produced by the pre-processor.
+ * @param file_name The name of the file, used in the errors.
+ * @return int PASSES_OK if both passes succeeded, otherwise the passes_status of the step that failed.
+ */
+int run_passes(context_ptr ctx, const char *file_name)
+{
+    struct phase_timer timer;
+    int result;
+
+    start_phase(&timer);
+    result = firstPass(ctx, file_name);
+    end_phase(&timer, PHASE_FIRST_PASS);
+    if (result == 1)
+    {
+        flush_errors(&ctx->errors, ctx->diagnostics);
+        return PASSES_FIRST_PASS;
+    }
+
+    if (ctx->optimizations)
+    {
+        start_phase(&timer);
+        ctx->words_saved = optimize_code(ctx, file_name);
+        end_phase(&timer, PHASE_OPTIMIZE);
+        if (ctx->words_saved < 0)
+        {
+            flush_errors(&ctx->errors, ctx->diagnostics);
+            return PASSES_OPTIMIZE;
+        }
+    }
+
+    start_phase(&timer);
+    result = secondPass(ctx, file_name);
+    end_phase(&timer, PHASE_SECOND_PASS);
+    if (trace_enabled && result != 1)
+    {
+        trace_sizes(ctx);
+    }
+    flush_errors(&ctx->errors, ctx->diagnostics);
+    return (result == 1) ? PASSES_SECOND_PASS : PASSES_OK;
+}
+
+/**
+ * @brief Runs both passes over the pre-processed text of the context, see run_passes.
+ *
+ * @return int Returns 1 if both passes succeeded, otherwise 0.
+ */
+int assemble_text(context_ptr ctx, const char *file_name)
+{
+    return run_passes(ctx, file_name) == PASSES_OK;
+}
+
+/**
+ * @brief Assembles a single file: pre-processing, both passes and the output files.
+ *
+ * With a build cache, the outputs of a source that was already assembled are
+ * restored from the cache instead, and the outputs of a source assembled without
+ * diagnostics are stored in it.
+ *
+ * @param ctx Pointer to the context the file is assembled with. It is reset when done.
+ * @param file_name The name of the file, without the .as extension.
+ * @param display_name The name used in the errors, or NULL to use file_name.
+ * @return int Returns 1 if the output files were created, otherwise 0.
+ */
+int assemble_file(context_ptr ctx, char *file_name, const char *display_name)
+{
+    char key[CACHE_KEY_SIZE];
+    struct phase_timer timer;
+    long diagnostics_start = -1;
+    int success = 0, preprocessed;
+
+    if (display_name == NULL)
+    {
+        display_name = file_name;
+    }
+    ctx->words_saved = -1;
+
+    start_phase(&timer);
+    read_source_file(ctx, file_name);
+    end_phase(&timer, PHASE_PREPROCESS);
+    if (ctx->cache != NULL)
+    {
+        start_phase(&timer);
+        build_cache_key(ctx, key);
+        success = restore_cache_entry(ctx->cache, ctx, key, file_name);
+        end_phase(&timer, PHASE_CACHE);
+        if (success)
+        {
+            reset_context(ctx);
+            return 1;
+        }
+        /* Only files without diagnostics are stored, a stream that cannot tell is never stored */
+        diagnostics_start = ftell(ctx->diagnostics);
+    }
+
+    /* Create am file, then run the passes on its text */
+    start_phase(&timer);
+    preprocessed = macro_processing(ctx, file_name);
+    end_phase(&timer, PHASE_PREPROCESS);
+    if (preprocessed && assemble_text(ctx, display_name))
+    {
+        start_phase(&timer);
+        createEntFile(ctx, file_name); /* Create ent file */
+        end_named_phase(&timer, PHASE_OUTPUT, "output .ent");
+        start_phase(&timer);
+        createExtFile(ctx, file_name); /* Create ext file */
+        end_named_phase(&timer, PHASE_OUTPUT, "output .ext");
+        start_phase(&timer);
+        createObFile(ctx, file_name);  /* Create ob file */
+        end_named_phase(&timer, PHASE_OUTPUT, "output .ob");
+        success = 1;
+
+        if (diagnostics_start >= 0 && ftell(ctx->diagnostics) == diagnostics_start)
+        {
+            start_phase(&timer);
+            store_cache_entry(ctx->cache, ctx, key);
+            end_phase(&timer, PHASE_CACHE);
+        }
+    }
+
+    /* Freeing variables */
+    reset_context(ctx);
+    return success;
+}
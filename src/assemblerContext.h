@@ -0,0 +1,67 @@
+#ifndef ASSEMBLERCONTEXT_H
+#define ASSEMBLERCONTEXT_H
+
+#include <stdio.h>
+#include "symbolTable.h"
+#include "translate.h"
+#include "macroContext.h"
+#include "textBuffer.h"
+#include "lineIndex.h"
+#include "options.h"
+#include "buildCache.h"
+#include "ioPipeline.h"
+#include "stats.h"
+#include "errorBuffer.h"
+#include "optimizer.h"
+
+/**
+ * @brief Structure holding all the state needed to assemble a single file.
+ *
+ * Every pass receives the context instead of using global variables, so several
+ * files can be assembled at the same time, each one with its own context.
+ * A context is reset after each file and can be reused for the next one. Resetting
+ * keeps the memory of the buffers and the symbols, so once a context has assembled
+ * a file, assembling a similar one does not allocate memory.
+ */
+typedef struct assembler_context {
+    table_ptr symbol_table;            /* Head of the symbol table */
+    table_ptr symbol_pool;             /* Unused symbols, reused by the next file */
+    extern_addresses_ptr extern_usage; /* Head of the list of external symbol usages */
+    extern_addresses_ptr extern_pool;  /* Unused extern usages, reused by the next file */
+    translation machine_code;          /* Code and data images */
+    struct MacroContext macro_table;   /* Macros defined in the file */
+    struct mapped_text source;         /* The source of the file, before pre-processing */
+    struct text_buffer source_text;    /* Holds the source when it is read rather than mapped */
+    struct line_index source_lines;    /* The lines of the source */
+    struct text_buffer am_text;        /* The source of the file after its macros are expanded */
+    struct line_index am_lines;        /* The lines of am_text, shared by both passes */
+    struct text_buffer cache_entry;    /* An entry of the build cache, being read or written */
+    struct build_cache *cache;         /* The build cache, or NULL */
+    struct io_pipeline *pipeline;      /* The pipeline reading the sources and writing the outputs, or NULL */
+    int file_index;                    /* The index of the file in the pipeline */
+    FILE *diagnostics;                 /* Stream the errors of the file are written to */
+    struct error_buffer errors;        /* Errors of the passes, printed to diagnostics once both are done */
+    int skip_unchanged;                /* Only replace output files whose content changed */
+    int optimizations;                 /* The optimizations run between the passes, a mask of the OPTIMIZE_ flags */
+    struct optimizer optimizer;        /* The state of the optimizations */
+    int words_saved;                   /* Code words the optimizations saved in the last file, or -1 if they did not run */
+} assembler_context, * context_ptr;
+
+/* The step run_passes stopped at, PASSES_OK if the file was assembled */
+enum passes_status
+{
+    PASSES_OK,
+    PASSES_FIRST_PASS, /* The first pass found errors */
+    PASSES_OPTIMIZE,   /* The optimized program does not fit in the memory */
+    PASSES_SECOND_PASS /* The second pass found errors */
+};
+
+/* Prototypes */
+void init_context(context_ptr ctx, const struct assembler_options *options, FILE *diagnostics);
+int run_passes(context_ptr ctx, const char *file_name);
+int assemble_text(context_ptr ctx, const char *file_name);
+void reset_context(context_ptr ctx);
+void release_context(context_ptr ctx);
+int assemble_file(context_ptr ctx, char *file_name, const char *display_name);
+
+#endif
@@ -0,0 +1,239 @@
+#define _POSIX_C_SOURCE 200809L /* open_memstream */
+#include "assemblerLib.h"
+#include "assemblerContext.h"
+#include "macroProcessing.h"
+
+#define SYMBOLS_INITIAL_SIZE 16 /* Initial capacity of the entries and externs arrays */
+
+/**
+ * @brief The library handle: an assembler context and the buffers the results are kept in.
+ *
+ * Every buffer keeps its memory between calls, so assembling a source that is not
+ * larger than the previous ones does not allocate memory.
+ */
+struct asm_handle
+{
+    assembler_context ctx;         /* The context the sources are assembled with */
+    FILE *diagnostics;             /* Memory stream the errors are written to */
+    char *diagnostics_buffer;      /* The buffer of the diagnostics stream */
+    size_t diagnostics_size;       /* The size of the diagnostics stream */
+    struct asm_symbol *entries;    /* Entries of the last source */
+    int entries_counter;           /* Number of entries of the last source */
+    int entries_capacity;          /* Number of entries allocated */
+    struct asm_symbol *externs;    /* External symbol uses of the last source */
+    int externs_counter;           /* Number of external symbol uses of the last source */
+    int externs_capacity;          /* Number of external symbol uses allocated */
+};
+
+/**
+ * @brief Appends a symbol to an array of symbols, growing it if needed.
+ *
+ * @param symbols Pointer to the array.
+ * @param counter Pointer to the number of symbols in the array.
+ * @param capacity Pointer to the number of symbols allocated for the array.
+ * @param name The name of the symbol.
+ * @param address The address of the symbol.
+ */
+static void append_symbol(struct asm_symbol **symbols, int *counter, int *capacity, const char *name, int address)
+{
+    if (*counter >= *capacity)
+    {
+        *capacity = (*capacity > 0) ? *capacity * 2 : SYMBOLS_INITIAL_SIZE;
+        *symbols = (struct asm_symbol *)reallocateMemory(*symbols, *capacity, sizeof(struct asm_symbol));
+    }
+
+    strncpy((*symbols)[*counter].name, name, ASM_SYMBOL_NAME_SIZE - 1);
+    (*symbols)[*counter].name[ASM_SYMBOL_NAME_SIZE - 1] = '\0';
+    (*symbols)[*counter].address = address;
+    (*counter)++;
+}
+
+/**
+ * @brief Collects the entries and the external symbol uses of the assembled source.
+ *
+ * @param handle The handle the source was assembled with.
+ */
+static void collect_symbols(asm_handle *handle)
+{
+    table_ptr symbol = handle->ctx.symbol_table;
+    extern_addresses_ptr usage = handle->ctx.extern_usage;
+    int i;
+
+    while ((symbol = find_entry(symbol)) != NULL)
+    {
+        append_symbol(&handle->entries, &handle->entries_counter, &handle->entries_capacity, symbol->symbol_name, symbol->symbol_address);
+        symbol = symbol->next;
+    }
+
+    for (; usage != NULL; usage = usage->next)
+    {
+        for (i = 0; i < usage->used_counter; i++)
+        {
+            append_symbol(&handle->externs, &handle->externs_counter, &handle->externs_capacity, usage->name, usage->used_addresses[i]);
+        }
+    }
+}
+
+/**
+ * @brief Creates a handle for assembling sources held in memory.
+ *
+ * A handle can assemble any number of sources, one at a time. Different handles
+ * can be used at the same time from different threads.
+ * Running out of memory while assembling is fatal, as it is for the assembler program.
+ *
+ * @param mem_size Maximum number of words a program may occupy, at most the MAX_MEM_SIZE words an
+ *                 operand of the target addresses, or 0 for that default.
+ * @return asm_handle* The new handle, or NULL if it could not be created.
+ */
+asm_handle *asm_create(int mem_size)
+{
+    struct assembler_options options = {0};
+    asm_handle *handle = (asm_handle *)calloc(1, sizeof(asm_handle));
+
+    if (handle == NULL || mem_size < 0 || mem_size > MAX_MEM_SIZE)
+    {
+        free(handle);
+        return NULL;
+    }
+
+    handle->diagnostics = open_memstream(&handle->diagnostics_buffer, &handle->diagnostics_size);
+    if (handle->diagnostics == NULL)
+    {
+        free(handle);
+        return NULL;
+    }
+
+    options.mem_size = (mem_size > 0) ? mem_size : MAX_MEM_SIZE;
+    init_context(&handle->ctx, &options, handle->diagnostics);
+    return handle;
+}
+
+/**
+ * @brief Sets the optimizations run on the sources a handle assembles next.
+ *
+ * The optimizations run between the passes, as with -O, --gc-sections and --pool-constants.
+ *
+ * @param handle The handle.
+ * @param optimizations A mask of the ASM_OPTIMIZE_ flags, or 0 for none.
+ * @return int ASM_OK, or ASM_ERROR_ARGUMENT if the handle is NULL or a flag is unknown.
+ */
+int asm_set_optimizations(asm_handle *handle, int optimizations)
+{
+    if (handle == NULL || (optimizations & ~(ASM_OPTIMIZE_PEEPHOLE | ASM_OPTIMIZE_GC_SECTIONS | ASM_OPTIMIZE_POOL_CONSTANTS)))
+    {
+        return ASM_ERROR_ARGUMENT;
+    }
+    handle->ctx.optimizations = optimizations;
+    return ASM_OK;
+}
+
+/**
+ * @brief Assembles a source held in memory.
+ *
+ * The source goes through the same steps as a file given to the assembler program,
+ * but no file is read or written. The images, symbols and diagnostics are returned
+ * in result. The images and symbols are only filled when the source was assembled.
+ *
+ * @param handle The handle to assemble with.
+ * @param name The name used in the diagnostics, or NULL for ASM_DEFAULT_NAME.
+ * @param source The source text. It does not have to be null terminated.
+ * @param length The number of characters in source.
+ * @param result The structure the output is returned in.
+ * @return int ASM_OK if the source was assembled, otherwise the asm_status of the failure.
+ */
+int asm_assemble(asm_handle *handle, const char *name, const char *source, size_t length, struct asm_result *result)
+{
+    context_ptr ctx;
+    translation_ptr machine_code_ptr;
+    int status = ASM_OK;
+    int macro_result;
+    long diagnostics_length;
+
+    if (handle == NULL || result == NULL || (source == NULL && length > 0))
+    {
+        return ASM_ERROR_ARGUMENT;
+    }
+
+    ctx = &handle->ctx;
+    machine_code_ptr = &ctx->machine_code;
+    if (name == NULL)
+    {
+        name = ASM_DEFAULT_NAME;
+    }
+
+    /* Empty the results of the previous source */
+    reset_context(ctx);
+    rewind(handle->diagnostics);
+    handle->entries_counter = 0;
+    handle->externs_counter = 0;
+
+    macro_result = expand_macros(ctx, source, length);
+    if (macro_result != 0)
+    {
+        print_macro_error(macro_result, ctx->diagnostics);
+        status = ASM_ERROR_PREPROCESS;
+    }
+    else
+    {
+        switch (run_passes(ctx, name))
+        {
+        case PASSES_FIRST_PASS:
+            status = ASM_ERROR_FIRST_PASS;
+            break;
+        case PASSES_OPTIMIZE:
+            status = ASM_ERROR_OPTIMIZE;
+            break;
+        case PASSES_SECOND_PASS:
+            status = ASM_ERROR_SECOND_PASS;
+            break;
+        default:
+            collect_symbols(handle);
+            break;
+        }
+    }
+
+    memset(result, 0, sizeof(struct asm_result));
+    if (status == ASM_OK)
+    {
+        if (machine_code_ptr->IC != 0)
+        {
+            result->code = machine_code_ptr->code_image + ASM_LOAD_ADDRESS;
+            result->code_length = machine_code_ptr->IC - ASM_LOAD_ADDRESS;
+        }
+        result->data = machine_code_ptr->data_image;
+        result->data_length = machine_code_ptr->DC;
+        result->entries = handle->entries;
+        result->entries_counter = handle->entries_counter;
+        result->externs = handle->externs;
+        result->externs_counter = handle->externs_counter;
+    }
+
+    /* Null terminate the diagnostics, the stream keeps its buffer for the next call */
+    fputc('\0', handle->diagnostics);
+    fflush(handle->diagnostics);
+    diagnostics_length = ftell(handle->diagnostics) - 1;
+    result->diagnostics = handle->diagnostics_buffer;
+    result->diagnostics_length = (diagnostics_length > 0) ? (size_t)diagnostics_length : 0;
+
+    return status;
+}
+
+/**
+ * @brief Frees a handle and everything it holds, including the last results.
+ *
+ * @param handle The handle to free. May be NULL.
+ */
+void asm_destroy(asm_handle *handle)
+{
+    if (handle == NULL)
+    {
+        return;
+    }
+
+    release_context(&handle->ctx);
+    fclose(handle->diagnostics);
+    free(handle->diagnostics_buffer);
+    free(handle->entries);
+    free(handle->externs);
+    free(handle);
+}
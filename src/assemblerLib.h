@@ -0,0 +1,69 @@
+#ifndef ASSEMBLERLIB_H
+#define ASSEMBLERLIB_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "targetDesc.h"
+
+#define ASM_LOAD_ADDRESS TARGET_LOAD_BASE /* Address the first code word is loaded at */
+#define ASM_SYMBOL_NAME_SIZE 31    /* Size of a symbol name, including the null terminator */
+#define ASM_DEFAULT_NAME "input"   /* Name used in the diagnostics when no name is given */
+
+/* Optimizations of asm_set_optimizations, the OPTIMIZE_ flags of optimizer.h */
+#define ASM_OPTIMIZE_PEEPHOLE 1       /* -O */
+#define ASM_OPTIMIZE_GC_SECTIONS 2    /* --gc-sections */
+#define ASM_OPTIMIZE_POOL_CONSTANTS 4 /* --pool-constants */
+
+/**
+ * @brief Result codes of the library functions.
+ */
+enum asm_status
+{
+    ASM_OK = 0,            /* The source was assembled */
+    ASM_ERROR_ARGUMENT,    /* An argument was invalid, nothing was assembled */
+    ASM_ERROR_PREPROCESS,  /* A macro definition is invalid */
+    ASM_ERROR_FIRST_PASS,  /* The first pass found errors */
+    ASM_ERROR_SECOND_PASS, /* The second pass found errors */
+    ASM_ERROR_OPTIMIZE     /* The optimized program does not fit in the memory */
+};
+
+/**
+ * @brief A symbol and an address: an entry and its address, or an external
+ * symbol and the address of the word that uses it.
+ */
+struct asm_symbol
+{
+    char name[ASM_SYMBOL_NAME_SIZE];
+    int address;
+};
+
+/**
+ * @brief The output of assembling a source.
+ *
+ * All the pointers belong to the handle. They stay valid until the next call
+ * to asm_assemble or asm_destroy with the same handle.
+ */
+struct asm_result
+{
+    const uint16_t *code;                /* Code words, code[i] is at address ASM_LOAD_ADDRESS + i */
+    int code_length;                     /* Number of code words */
+    const uint16_t *data;                /* Data words, placed right after the code */
+    int data_length;                     /* Number of data words */
+    const struct asm_symbol *entries;    /* Entry symbols, in the order of the .ent file */
+    int entries_counter;                 /* Number of entries */
+    const struct asm_symbol *externs;    /* Every use of an external symbol, in the order of the .ext file */
+    int externs_counter;                 /* Number of external symbol uses */
+    const char *diagnostics;             /* The errors, null terminated, as the assembler prints them */
+    size_t diagnostics_length;           /* Number of characters in diagnostics */
+};
+
+/* Opaque handle holding everything needed to assemble sources in memory */
+typedef struct asm_handle asm_handle;
+
+/* Prototypes */
+asm_handle *asm_create(int mem_size);
+int asm_set_optimizations(asm_handle *handle, int optimizations);
+int asm_assemble(asm_handle *handle, const char *name, const char *source, size_t length, struct asm_result *result);
+void asm_destroy(asm_handle *handle);
+
+#endif
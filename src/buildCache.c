@@ -0,0 +1,445 @@
+#define _POSIX_C_SOURCE 200809L /* mkdir, utimensat, opendir, open_memstream, getpid */
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "buildCache.h"
+#include "assemblerContext.h"
+#include "output.h"
+#include "protocol.h"
+#include "sha256.h"
+#include "stats.h"
+
+/**
+ * @brief Structure describing an entry of the cache directory, used by the eviction.
+ */
+struct cache_file
+{
+    char key[CACHE_KEY_SIZE]; /* The name of the entry */
+    struct timespec used;     /* The time of its last use */
+    long size;                /* Its size, in bytes */
+};
+
+/* Writes the content of an output file, see output.h */
+typedef void (*content_writer)(struct assembler_context *ctx, FILE *file);
+
+/**
+ * @brief Opens the cache directory, creating it if needed.
+ *
+ * @param cache Pointer to the cache to initialize.
+ * @param directory The cache directory.
+ * @param max_size Bound of the total size of the entries, in bytes.
+ * @return int Returns 1 on success, otherwise prints an error and returns 0.
+ */
+int init_build_cache(struct build_cache *cache, const char *directory, long max_size)
+{
+    struct stat info;
+
+    if (mkdir(directory, 0777) != 0 && errno != EEXIST)
+    {
+        printf("Error: Unable to create the cache directory %s\n", directory);
+        return 0;
+    }
+    if (stat(directory, &info) != 0 || !S_ISDIR(info.st_mode))
+    {
+        printf("Error: %s is not a directory\n", directory);
+        return 0;
+    }
+
+    cache->directory = directory;
+    cache->max_size = max_size;
+    cache->hits = 0;
+    cache->misses = 0;
+    cache->stores = 0;
+    cache->evictions = 0;
+    cache->temp_counter = 0;
+    pthread_mutex_init(&cache->lock, NULL);
+    return 1;
+}
+
+/**
+ * @brief Releases the resources held by a cache.
+ *
+ * @param cache Pointer to the cache to release.
+ */
+void release_build_cache(struct build_cache *cache)
+{
+    pthread_mutex_destroy(&cache->lock);
+}
+
+/**
+ * @brief Computes the cache key of the source held by a context.
+ *
+ * The key is the SHA-256 of everything the outputs depend on: the version of the
+ * assembler, the target it was built for, the options changing the outputs and the source. Macros are defined
+ * in the source itself, so it is the only input file.
+ *
+ * @param ctx The context, holding the source of the file.
+ * @param key The buffer of CACHE_KEY_SIZE characters the key is written to.
+ */
+void build_cache_key(struct assembler_context *ctx, char *key)
+{
+    static const char hex_digits[] = "0123456789abcdef";
+    struct sha256_context sha;
+    unsigned char digest[SHA256_DIGEST_SIZE];
+    char options[MAX_LINE];
+    int i;
+
+    sprintf(options, "%s\nmem-size %d\n", ASSEMBLER_VERSION, ctx->machine_code.mem_size);
+    if (ctx->optimizations)
+    {
+        /* Only added when set, so the keys of the files assembled without optimizations do not change */
+        sprintf(options + strlen(options), "optimizations %d\n", ctx->optimizations);
+    }
+    if (strcmp(TARGET_NAME, "default") != 0)
+    {
+        /* The variants of the machine encode differently, the default keeps its keys */
+        sprintf(options + strlen(options), "target %s\n", TARGET_NAME);
+    }
+
+    sha256_init(&sha);
+    sha256_update(&sha, options, strlen(options));
+    sha256_update(&sha, ctx->source.text, ctx->source.length);
+    sha256_final(&sha, digest);
+
+    for (i = 0; i < SHA256_DIGEST_SIZE; i++)
+    {
+        key[i * 2] = hex_digits[digest[i] >> 4];
+        key[i * 2 + 1] = hex_digits[digest[i] & 0xF];
+    }
+    key[CACHE_KEY_SIZE - 1] = '\0';
+}
+
+/**
+ * @brief Returns the path of a cache entry.
+ *
+ * @param cache The cache.
+ * @param key The key of the entry.
+ * @return char* The path, to be freed by the caller.
+ */
+static char *cache_entry_path(struct build_cache *cache, const char *key)
+{
+    char *path = (char *)allocateMemory(strlen(cache->directory) + CACHE_KEY_SIZE + 1, sizeof(char), MALLOC_ID);
+
+    sprintf(path, "%s/%s", cache->directory, key);
+    return path;
+}
+
+/**
+ * @brief Checks that an entry is made of valid records, with an .am file.
+ *
+ * @param entry The content of the entry.
+ * @return int Returns 1 if the entry is valid, otherwise 0.
+ */
+static int is_valid_entry(const struct text_buffer *entry)
+{
+    struct text_reader reader;
+    char tag[RECORD_TAG_SIZE];
+    const char *data;
+    size_t length;
+    int result, has_am = 0;
+
+    init_text_reader(&reader, entry->text, entry->length);
+    while ((result = read_record(&reader, tag, &data, &length)) == 1)
+    {
+        if (strcmp(tag, CACHE_RECORD_AM) == 0)
+        {
+            has_am = 1;
+        }
+        else if (strcmp(tag, RECORD_OB) != 0 && strcmp(tag, RECORD_ENT) != 0 && strcmp(tag, RECORD_EXT) != 0)
+        {
+            return 0;
+        }
+    }
+    return result == 0 && has_am;
+}
+
+/**
+ * @brief Writes an output file from a record of a cache entry.
+ *
+ * @param ctx The context, giving the output mode.
+ * @param file_name The name of the input file, without extension.
+ * @param extension The extension of the output file, the tag of the record.
+ * @param data The content of the output file.
+ * @param length The size of the content.
+ */
+static void write_cached_output(struct assembler_context *ctx, const char *file_name, const char *extension,
+                                const char *data, size_t length)
+{
+    struct output_file output;
+    char *output_name = (char *)allocateMemory(strlen(file_name) + strlen(extension) + 2, sizeof(char), MALLOC_ID);
+    FILE *file;
+
+    sprintf(output_name, "%s.%s", file_name, extension);
+    file = open_output_file(&output, output_name, ctx->skip_unchanged, ctx->pipeline);
+    if (!file)
+    {
+        fprintf(stderr, "Could not open the file %s for writing\n", output_name);
+        free(output_name);
+        return;
+    }
+
+    fwrite(data, 1, length, file);
+    COUNT_STAT(bytes_written[stats_output_kind(extension)], (long)length);
+    close_output_file(&output);
+    free(output_name);
+}
+
+/**
+ * @brief Writes the outputs of a file from the cache, if it holds them.
+ *
+ * @param cache The cache.
+ * @param ctx The context, holding the source of the file.
+ * @param key The key computed by build_cache_key.
+ * @param file_name The name of the input file, without the .as extension.
+ * @return int Returns 1 if the outputs were restored, 0 on a miss.
+ */
+int restore_cache_entry(struct build_cache *cache, struct assembler_context *ctx, const char *key, const char *file_name)
+{
+    struct text_reader reader;
+    char tag[RECORD_TAG_SIZE];
+    const char *data;
+    size_t length;
+    char *path = cache_entry_path(cache, key);
+    FILE *entry_file = fopen(path, "rb");
+    int hit = 0;
+
+    if (entry_file != NULL)
+    {
+        clear_text_buffer(&ctx->cache_entry);
+        read_text_file(&ctx->cache_entry, entry_file);
+        fclose(entry_file);
+
+        /* A damaged entry is a miss, and is replaced by the next store */
+        hit = is_valid_entry(&ctx->cache_entry);
+    }
+
+    if (hit)
+    {
+        init_text_reader(&reader, ctx->cache_entry.text, ctx->cache_entry.length);
+        while (read_record(&reader, tag, &data, &length) == 1)
+        {
+            write_cached_output(ctx, file_name, tag, data, length);
+        }
+
+        /* The modification time of an entry is the time of its last use */
+        utimensat(AT_FDCWD, path, NULL, 0);
+    }
+
+    pthread_mutex_lock(&cache->lock);
+    if (hit)
+    {
+        cache->hits++;
+    }
+    else
+    {
+        cache->misses++;
+    }
+    pthread_mutex_unlock(&cache->lock);
+
+    free(path);
+    return hit;
+}
+
+/**
+ * @brief Appends the content of an output file to a cache entry.
+ *
+ * @param entry The cache entry.
+ * @param tag The tag of the record, the extension of the output file.
+ * @param writer The function writing the content of the output file.
+ * @param ctx The context of the assembled file.
+ */
+static void append_output_record(struct text_buffer *entry, const char *tag, content_writer writer, struct assembler_context *ctx)
+{
+    char *content = NULL;
+    size_t size = 0;
+    FILE *file = open_memstream(&content, &size);
+
+    if (file == NULL)
+    {
+        failureExit("Memory allocation failed");
+    }
+    writer(ctx, file);
+    fclose(file);
+
+    append_record(entry, tag, content, size);
+    free(content);
+}
+
+/**
+ * @brief Stores the outputs of an assembled file in the cache.
+ *
+ * The entry is written to a temporary file which is then renamed, so a worker
+ * or another assembler never reads a partially written entry. The cache is only
+ * an optimization: an entry that cannot be written is skipped silently.
+ *
+ * @param cache The cache.
+ * @param ctx The context of the assembled file, before it is reset.
+ * @param key The key computed by build_cache_key.
+ */
+void store_cache_entry(struct build_cache *cache, struct assembler_context *ctx, const char *key)
+{
+    struct text_buffer *entry = &ctx->cache_entry;
+    char *path = cache_entry_path(cache, key);
+    char *temp_name = (char *)allocateMemory(strlen(path) + strlen(TEMP_SUFFIX) + CACHE_TEMP_ID_SIZE, sizeof(char), MALLOC_ID);
+    FILE *temp_file;
+    long temp_id;
+    int written;
+
+    clear_text_buffer(entry);
+    append_record(entry, CACHE_RECORD_AM, (ctx->am_text.text != NULL) ? ctx->am_text.text : "", ctx->am_text.length);
+    if (has_ob_file(ctx))
+    {
+        append_output_record(entry, RECORD_OB, write_ob_content, ctx);
+    }
+    if (has_ent_file(ctx))
+    {
+        append_output_record(entry, RECORD_ENT, write_ent_content, ctx);
+    }
+    if (has_ext_file(ctx))
+    {
+        append_output_record(entry, RECORD_EXT, write_ext_content, ctx);
+    }
+
+    pthread_mutex_lock(&cache->lock);
+    temp_id = cache->temp_counter++;
+    pthread_mutex_unlock(&cache->lock);
+    sprintf(temp_name, "%s%s.%ld.%ld", path, TEMP_SUFFIX, (long)getpid(), temp_id);
+
+    temp_file = fopen(temp_name, "wb");
+    written = temp_file != NULL && fwrite(entry->text, 1, entry->length, temp_file) == entry->length;
+    if (temp_file != NULL && fclose(temp_file) != 0)
+    {
+        written = 0;
+    }
+    if (written && rename(temp_name, path) == 0)
+    {
+        pthread_mutex_lock(&cache->lock);
+        cache->stores++;
+        pthread_mutex_unlock(&cache->lock);
+    }
+    else
+    {
+        remove(temp_name);
+    }
+
+    free(temp_name);
+    free(path);
+}
+
+/**
+ * @brief Checks if a name is the name of a cache entry.
+ *
+ * @param name The name of a file of the cache directory.
+ * @return int Returns 1 if the name is a key, otherwise 0.
+ */
+static int is_cache_key(const char *name)
+{
+    int i;
+
+    for (i = 0; i < CACHE_KEY_SIZE - 1; i++)
+    {
+        if (!((name[i] >= '0' && name[i] <= '9') || (name[i] >= 'a' && name[i] <= 'f')))
+        {
+            return 0;
+        }
+    }
+    return name[i] == '\0';
+}
+
+/**
+ * @brief Orders cache files from the least recently used, for qsort.
+ */
+static int compare_cache_files(const void *a, const void *b)
+{
+    const struct cache_file *x = (const struct cache_file *)a;
+    const struct cache_file *y = (const struct cache_file *)b;
+
+    if (x->used.tv_sec != y->used.tv_sec)
+    {
+        return (x->used.tv_sec > y->used.tv_sec) - (x->used.tv_sec < y->used.tv_sec);
+    }
+    if (x->used.tv_nsec != y->used.tv_nsec)
+    {
+        return (x->used.tv_nsec > y->used.tv_nsec) - (x->used.tv_nsec < y->used.tv_nsec);
+    }
+    return strcmp(x->key, y->key);
+}
+
+/**
+ * @brief Removes the least recently used entries until the cache fits in its bound.
+ *
+ * Called once the files are assembled, while no worker uses the cache.
+ *
+ * @param cache The cache.
+ */
+void evict_build_cache(struct build_cache *cache)
+{
+    struct cache_file *files = NULL;
+    struct stat info;
+    struct dirent *dir_entry;
+    DIR *dir = opendir(cache->directory);
+    int files_counter = 0, files_capacity = 0, i;
+    long total_size = 0;
+    char *path;
+
+    if (dir == NULL)
+    {
+        return;
+    }
+
+    while ((dir_entry = readdir(dir)) != NULL)
+    {
+        if (!is_cache_key(dir_entry->d_name))
+        {
+            continue;
+        }
+        path = cache_entry_path(cache, dir_entry->d_name);
+        if (stat(path, &info) == 0)
+        {
+            if (files_counter == files_capacity)
+            {
+                files_capacity = (files_capacity > 0) ? files_capacity * 2 : 64;
+                files = (struct cache_file *)reallocateMemory(files, files_capacity, sizeof(struct cache_file));
+            }
+            strcpy(files[files_counter].key, dir_entry->d_name);
+            files[files_counter].used = info.st_mtim;
+            files[files_counter].size = (long)info.st_size;
+            total_size += files[files_counter].size;
+            files_counter++;
+        }
+        free(path);
+    }
+    closedir(dir);
+
+    if (total_size > cache->max_size)
+    {
+        qsort(files, files_counter, sizeof(struct cache_file), compare_cache_files);
+        for (i = 0; i < files_counter && total_size > cache->max_size; i++)
+        {
+            path = cache_entry_path(cache, files[i].key);
+            if (remove(path) == 0)
+            {
+                total_size -= files[i].size;
+                cache->evictions++;
+            }
+            free(path);
+        }
+    }
+
+    free(files);
+}
+
+/**
+ * @brief Prints the counters of a cache.
+ *
+ * @param cache The cache.
+ * @param stream The stream to print to.
+ */
+void print_cache_stats(struct build_cache *cache, FILE *stream)
+{
+    fprintf(stream, "Cache: %ld hits, %ld misses, %ld stored, %ld evicted\n",
+            cache->hits, cache->misses, cache->stores, cache->evictions);
+}
@@ -0,0 +1,48 @@
+#ifndef BUILDCACHE_H
+#define BUILDCACHE_H
+
+#include <stdio.h>
+#include <pthread.h>
+
+#define ASSEMBLER_VERSION "1.1"                     /* Part of every cache key, change it whenever the outputs change */
+#define CACHE_KEY_SIZE 65                           /* A SHA-256 digest in hexadecimal, with the null terminator */
+#define CACHE_DEFAULT_SIZE (256L * 1024L * 1024L)   /* Default bound of the cache directory, in bytes */
+#define CACHE_RECORD_AM "am"                        /* Record holding the .am file in a cache entry */
+#define CACHE_TEMP_ID_SIZE 48                       /* Room for ".pid.counter" after the name of an entry being written */
+
+/**
+ * @brief A directory of assembled outputs, keyed by a hash of their inputs.
+ *
+ * Every entry is a file named after its key. It holds the .am, .ob, .ent and .ext
+ * outputs of a file in the record format of protocol.h. Only files that were
+ * assembled without any diagnostics are stored, so an entry never depends on
+ * the name of the file it came from.
+ *
+ * An entry is touched whenever it is used, so its modification time is the time
+ * of its last use. evict_build_cache removes the least recently used entries until
+ * the directory fits in max_size.
+ */
+struct build_cache
+{
+    const char *directory; /* The cache directory */
+    long max_size;         /* Bound of the total size of the entries, in bytes */
+    pthread_mutex_t lock;  /* Protects the counters, the cache is shared by the workers */
+    long hits;             /* Files restored from the cache */
+    long misses;           /* Files not found in the cache */
+    long stores;           /* Entries written */
+    long evictions;        /* Entries removed to bound the size */
+    long temp_counter;     /* Makes the temporary names of the entries being written unique */
+};
+
+struct assembler_context; /* Forward declaration of struct assembler_context */
+
+/* Prototypes */
+int init_build_cache(struct build_cache *cache, const char *directory, long max_size);
+void release_build_cache(struct build_cache *cache);
+void build_cache_key(struct assembler_context *ctx, char *key);
+int restore_cache_entry(struct build_cache *cache, struct assembler_context *ctx, const char *key, const char *file_name);
+void store_cache_entry(struct build_cache *cache, struct assembler_context *ctx, const char *key);
+void evict_build_cache(struct build_cache *cache);
+void print_cache_stats(struct build_cache *cache, FILE *stream);
+
+#endif
@@ -0,0 +1,142 @@
+#define ALLOC_CATEGORY ALLOC_PARSER /* Allocations counted by TRACK_ALLOCATIONS builds */
+#include "errorBuffer.h"
+#include "helpingFunction.h"
+
+/* The message of every error code: the file, the line and the argument follow, in that order */
+static const char *error_formats[ERROR_CODE_COUNT] = {
+    "Error: In file %s at line %d, the line exceeds 80 characters.\n",
+    "Error: In file %s at line %d there is an error: %s\n",
+    "Error: In file %s at line %d the symbol %s has been redefined.\n",
+    "Error: the program has reached maximum memmory size allowed.\n ",
+    "Error: In file %s at line %d symbol %s declared as entry but never defined.\n",
+    "Error: In file %s at line %d the symbol %s has been never defined.\n",
+    "Error: In file %s at line %d the address of the symbol %s does not fit in an operand.\n"};
+
+/**
+ * @brief Initializes an empty error buffer.
+ *
+ * @param buffer The buffer to initialize.
+ * @param max_errors The number of errors a file stops at, or 0 for no limit.
+ */
+void init_error_buffer(struct error_buffer *buffer, int max_errors)
+{
+    buffer->records = NULL;
+    buffer->counter = 0;
+    buffer->capacity = 0;
+    buffer->max_errors = max_errors;
+}
+
+/**
+ * @brief Adds a record for an error of the file being assembled.
+ *
+ * @param buffer The errors of the file.
+ * @param code One of enum error_code.
+ * @param file The name of the file.
+ * @param line The line of the error.
+ * @return struct error_record* The record, with an empty argument and no parse error.
+ */
+static struct error_record *add_record(struct error_buffer *buffer, int code, const char *file, int line)
+{
+    struct error_record *record;
+
+    if (buffer->counter == buffer->capacity)
+    {
+        buffer->capacity = (buffer->capacity > 0) ? buffer->capacity * 2 : ERROR_BUFFER_INITIAL_SIZE;
+        buffer->records = (struct error_record *)reallocateMemory(buffer->records, buffer->capacity, sizeof(struct error_record));
+    }
+
+    record = &buffer->records[buffer->counter++];
+    record->code = code;
+    record->file = file;
+    record->line = line;
+    record->parse_error = PARSE_OK;
+    record->inst = 0;
+    record->argument[0] = '\0';
+    return record;
+}
+
+/**
+ * @brief Records an error of the file being assembled.
+ *
+ * @param buffer The errors of the file.
+ * @param code One of enum error_code.
+ * @param file The name of the file. It must stay valid until flush_errors.
+ * @param line The line of the error.
+ * @param argument The symbol the error is about, or NULL.
+ * @return int Returns 1 if the file reached the limit of errors and must stop, otherwise 0.
+ */
+int report_error(struct error_buffer *buffer, int code, const char *file, int line, const char *argument)
+{
+    struct error_record *record = add_record(buffer, code, file, line);
+
+    if (argument != NULL)
+    {
+        strncat(record->argument, argument, MAX_LABEL_SIZE);
+    }
+    return buffer->max_errors > 0 && buffer->counter >= buffer->max_errors;
+}
+
+/**
+ * @brief Records the syntax error of a line the parser rejected.
+ *
+ * Only the code of the parse error and the instruction it is about are kept, the
+ * message is formatted by flush_errors.
+ *
+ * @param buffer The errors of the file.
+ * @param file The name of the file. It must stay valid until flush_errors.
+ * @param line The line of the error.
+ * @param ast The line, as the parser returned it.
+ * @return int Returns 1 if the file reached the limit of errors and must stop, otherwise 0.
+ */
+int report_syntax_error(struct error_buffer *buffer, const char *file, int line, const struct ast *ast)
+{
+    struct error_record *record = add_record(buffer, ERROR_SYNTAX, file, line);
+
+    record->parse_error = ast->error;
+    record->inst = ast->error_inst;
+    return buffer->max_errors > 0 && buffer->counter >= buffer->max_errors;
+}
+
+/**
+ * @brief Prints the errors of the file, in the order they were found, and empties the buffer.
+ *
+ * @param buffer The errors of the file.
+ * @param stream The stream the errors are printed to.
+ */
+void flush_errors(struct error_buffer *buffer, FILE *stream)
+{
+    struct error_record *record;
+    char message[ERROR_LINE];
+    int i;
+
+    for (i = 0; i < buffer->counter; i++)
+    {
+        record = &buffer->records[i];
+        if (record->code == ERROR_SYNTAX)
+        {
+            format_parse_error(record->parse_error, record->inst, message);
+            fprintf(stream, error_formats[record->code], record->file, record->line, message);
+        }
+        else
+        {
+            fprintf(stream, error_formats[record->code], record->file, record->line, record->argument);
+        }
+    }
+    if (buffer->max_errors > 0 && buffer->counter >= buffer->max_errors)
+    {
+        fprintf(stream, "Error: In file %s the assembly stopped after %d errors.\n",
+                buffer->records[buffer->counter - 1].file, buffer->counter);
+    }
+    buffer->counter = 0;
+}
+
+/**
+ * @brief Frees the memory of an error buffer.
+ *
+ * @param buffer The buffer to release.
+ */
+void release_error_buffer(struct error_buffer *buffer)
+{
+    free(buffer->records);
+    init_error_buffer(buffer, buffer->max_errors);
+}
@@ -0,0 +1,57 @@
+#ifndef ERRORBUFFER_H
+#define ERRORBUFFER_H
+
+#include <stdio.h>
+#include "lineParser.h"
+
+#define ERROR_BUFFER_INITIAL_SIZE 16 /* Initial capacity of an error buffer */
+
+/* The errors of the passes */
+enum error_code
+{
+    ERROR_LINE_TOO_LONG,   /* The line exceeds 80 characters */
+    ERROR_SYNTAX,          /* The parser rejected the line, the record holds its parse error */
+    ERROR_REDEFINED,       /* The argument is a symbol defined twice */
+    ERROR_MEMORY_FULL,     /* The program does not fit in the memory */
+    ERROR_ENTRY_UNDEFINED, /* The argument is an entry never defined, the line is that of its .entry */
+    ERROR_UNDEFINED,       /* The argument is a symbol used but never defined */
+    ERROR_ADDRESS_RANGE,   /* The argument is a symbol whose address does not fit in an operand */
+    ERROR_CODE_COUNT
+};
+
+/**
+ * @brief An error found in a file, kept until the errors of the file are printed.
+ */
+struct error_record
+{
+    int code;                  /* One of enum error_code */
+    const char *file;          /* The name of the file */
+    int line;                  /* The line of the error */
+    int parse_error;           /* For ERROR_SYNTAX, one of enum parse_error */
+    int inst;                  /* For ERROR_SYNTAX, the instruction the parse error is about */
+    char argument[MAX_LABEL_SIZE + 1]; /* The symbol the error is about, or empty */
+};
+
+/**
+ * @brief The errors of the file being assembled.
+ *
+ * The passes record their errors instead of printing them, and the errors are printed
+ * together once the file is done. Like the other buffers of a context, the records
+ * keep their memory for the next file.
+ */
+struct error_buffer
+{
+    struct error_record *records; /* The errors, in the order they were found */
+    int counter;                  /* Number of errors */
+    int capacity;                 /* Number of records allocated */
+    int max_errors;               /* The file stops at this many errors, 0 for no limit */
+};
+
+/* Prototypes */
+void init_error_buffer(struct error_buffer *buffer, int max_errors);
+int report_error(struct error_buffer *buffer, int code, const char *file, int line, const char *argument);
+int report_syntax_error(struct error_buffer *buffer, const char *file, int line, const struct ast *ast);
+void flush_errors(struct error_buffer *buffer, FILE *stream);
+void release_error_buffer(struct error_buffer *buffer);
+
+#endif
@@ -1,9 +1,6 @@
+#define ALLOC_CATEGORY ALLOC_PARSER /* Allocations counted by TRACK_ALLOCATIONS builds */
 #include "firstPass.h"
-
-table_ptr found = NULL;                           /* Recive the address of the symbol inside the table*/
-table_ptr head_ptr = NULL;                        /* The poiner to the head of the table*/
-translation machine_code = {0};                   /* Structure to hold machine code information, initialized to zero */
-translation_ptr machine_code_ptr = &machine_code; /* Pointer to the machine code structure */
+#include "assemblerContext.h"
 
 /**
  * Performs the first pass of the assembly process.
@@ -14,47 +11,57 @@ translation_ptr machine_code_ptr = &machine_code; /* Pointer to the machine code
  * memory size limitations. It calculates the number of words needed
  * for Directive, codes the data into the data image,
  *
+ * @param ctx             The context of the file: its symbol table, machine code,
+ *                        and the text and macros produced by the pre-processor.
  * @param file_name       The name of the assembly source file being processed.
- * @param file            The file pointer to the assembly source file.
- * @param macro_context   A pointer to the macro context structure used for macro
- *                        processing (may be NULL if not used).
  *
  * @return                An integer error flag: 0 if no errors occurred, 1 if
  *                        errors were detected.
  */
-int firstPass(char *file_name, FILE *file, struct MacroContext *macro_context)
+int firstPass(struct assembler_context *ctx, const char *file_name)
 {
     /* Declarations */
+    translation_ptr machine_code_ptr = &ctx->machine_code; /* Pointer to the machine code structure */
+    table_ptr found = NULL; /* Recive the address of the symbol inside the table*/
     int error_flag = 0;
     int L; /* Number of words that the current instruction takes */
     int i;
     int line_counter = 1; /* The line number of the source file after macro */
-    char read_line[MAX_LINE_LENGTH];
-    char buffer_line[MAX_BUFFER_LENGTH];
+    char read_line[MAX_BUFFER_LENGTH];
     char label[MAX_LABEL_SIZE]; /* Label name init */
     struct ast answer = {0};    /* After front returned answer*/
+    int line_index;
+
+    /* Find the lines of the am text, the second pass reads the same index */
+    build_line_index(&ctx->am_lines, ctx->am_text.text, ctx->am_text.length);
 
-    /* Read lines from the am file */
-    while (fgets(buffer_line, MAX_BUFFER_LENGTH, file))
+    /* Read lines from the am text */
+    for (line_index = 0; line_index < ctx->am_lines.lines_counter; line_index++)
     {
 
         /* Checks if the line from source code is longer than 80 */
-        if ((strlen(buffer_line) > MAX_LINE_LENGTH - 1) && (buffer_line[MAX_LINE_LENGTH - 1] != '\n'))
+        if (ctx->am_lines.lines[line_index].too_long)
         {
-            printf("Error: In file %s at line %d, the line exceeds 80 characters.\n", file_name, line_counter);
-            line_counter++;
             error_flag = 1;
+            if (report_error(&ctx->errors, ERROR_LINE_TOO_LONG, file_name, line_counter, NULL))
+            {
+                return error_flag;
+            }
+            line_counter++;
             continue;
         }
-        strcpy(read_line, buffer_line);
-        answer = get_ast_from_line(read_line, macro_context);
+        copy_line(&ctx->am_lines.lines[line_index], read_line, MAX_BUFFER_LENGTH);
+        answer = get_ast_from_line(read_line, &ctx->macro_table);
 
         /* If there is a syntax error*/
         if (answer.ast_type == ast_error)
         {
-            printf("Error: In file %s at line %d there is an error: %s\n", file_name, line_counter, answer.lineError);
-            line_counter++;
             error_flag = 1;
+            if (report_syntax_error(&ctx->errors, file_name, line_counter, &answer))
+            {
+                return error_flag;
+            }
+            line_counter++;
             continue;
         }
 
@@ -73,7 +80,7 @@ int firstPass(char *file_name, FILE *file, struct MacroContext *macro_context)
             }
 
             /* If the symbol is already exist in the table */
-            if ((found = symbol_search(head_ptr, answer.labelName)) || (found = symbol_search(head_ptr, label)))
+            if ((found = symbol_search(ctx->symbol_table, answer.labelName)) || (found = symbol_search(ctx->symbol_table, label)))
             {
 
                 /* If the symbol in the table is entry*/
@@ -86,7 +93,7 @@ int firstPass(char *file_name, FILE *file, struct MacroContext *macro_context)
                         found->symbol_type = entry_code;
                         if ((machine_code_ptr->IC) == 0)
                         {
-                            (machine_code_ptr->IC) = 100;
+                            (machine_code_ptr->IC) = TARGET_LOAD_BASE;
                         }
                         found->symbol_address = (machine_code_ptr->IC);
                     }
@@ -111,8 +118,11 @@ int firstPass(char *file_name, FILE *file, struct MacroContext *macro_context)
                         /* If its entry or extern */
                         else
                         {
-                            printf("Error: In file %s at line %d the symbol %s has been redefined.\n", file_name, line_counter, found->symbol_name);
                             error_flag = 1;
+                            if (report_error(&ctx->errors, ERROR_REDEFINED, file_name, line_counter, found->symbol_name))
+                            {
+                                return error_flag;
+                            }
                         }
                     }
                 }
@@ -126,8 +136,11 @@ int firstPass(char *file_name, FILE *file, struct MacroContext *macro_context)
                     }
                     else
                     {
-                        printf("Error: In file %s at line %d the symbol %s has been redefined.\n", file_name, line_counter, found->symbol_name);
                         error_flag = 1;
+                        if (report_error(&ctx->errors, ERROR_REDEFINED, file_name, line_counter, found->symbol_name))
+                        {
+                            return error_flag;
+                        }
                     }
                 }
 
@@ -147,8 +160,11 @@ int firstPass(char *file_name, FILE *file, struct MacroContext *macro_context)
                 /* If the symbol in the table is not entry*/
                 else
                 {
-                    printf("Error: In file %s at line %d the symbol %s has been redefined.\n", file_name, line_counter, answer.labelName);
                     error_flag = 1;
+                    if (report_error(&ctx->errors, ERROR_REDEFINED, file_name, line_counter, answer.labelName))
+                    {
+                        return error_flag;
+                    }
                     continue;
                 }
             }
@@ -162,12 +178,12 @@ int firstPass(char *file_name, FILE *file, struct MacroContext *macro_context)
                 {
                     if ((machine_code_ptr->IC) == 0)
                     {
-                        (machine_code_ptr->IC) = 100;
-                        add_symbol_to_table(answer.labelName, code_symbol, (machine_code_ptr->IC), &head_ptr);
+                        (machine_code_ptr->IC) = TARGET_LOAD_BASE;
+                        add_symbol_to_table(answer.labelName, code_symbol, (machine_code_ptr->IC), &ctx->symbol_table, &ctx->symbol_pool);
                     }
                     else
                     {
-                        add_symbol_to_table(answer.labelName, code_symbol, (machine_code_ptr->IC), &head_ptr);
+                        add_symbol_to_table(answer.labelName, code_symbol, (machine_code_ptr->IC), &ctx->symbol_table, &ctx->symbol_pool);
                     }
                 }
 
@@ -177,19 +193,19 @@ int firstPass(char *file_name, FILE *file, struct MacroContext *macro_context)
                     /* If its external variable */ /*need to check if its zero or NULL*/
                     if (answer.ast_options.dir.dir_type == ast_extern)
                     {
-                        add_symbol_to_table(answer.ast_options.dir.dir_options.label, extern_symbol, 0, &head_ptr);
+                        add_symbol_to_table(answer.ast_options.dir.dir_options.label, extern_symbol, 0, &ctx->symbol_table, &ctx->symbol_pool);
                     }
 
                     /* If its entry variable */
                     else if (answer.ast_options.dir.dir_type == ast_entry)
                     {
-                        add_symbol_to_table(answer.ast_options.dir.dir_options.label, entry_symbol, line_counter, &head_ptr);
+                        add_symbol_to_table(answer.ast_options.dir.dir_options.label, entry_symbol, line_counter, &ctx->symbol_table, &ctx->symbol_pool);
                     }
 
                     /* If its data or string */
                     else
                     {
-                        add_symbol_to_table(answer.labelName, data_symbol, (machine_code_ptr->DC), &head_ptr);
+                        add_symbol_to_table(answer.labelName, data_symbol, (machine_code_ptr->DC), &ctx->symbol_table, &ctx->symbol_pool);
                         if (answer.labelName[0] == NULL_BYTE)
                         {
                             (machine_code_ptr->DC)++;
@@ -204,13 +220,13 @@ int firstPass(char *file_name, FILE *file, struct MacroContext *macro_context)
         {
             L = answer.ast_options.dir.dir_options.data_size; /* Calculate how much words*/
 
-            /* Check that the progrem has not reached maximum memmory size */
+            /* Check that the progrem has not reached maximum memmory size, the optimizations check the smaller program */
             if ((machine_code_ptr->IC) != 0)
             {
-                if (((machine_code_ptr->DC) + (machine_code_ptr->IC) + L - 100) > MAX_MEM_SIZE)
+                if (!ctx->optimizations && ((machine_code_ptr->DC) + (machine_code_ptr->IC) + L - TARGET_LOAD_BASE) > machine_code_ptr->mem_size)
                 {
                     error_flag = 1;
-                    printf("Error: the program has reached maximum memmory size allowed.\n ");
+                    report_error(&ctx->errors, ERROR_MEMORY_FULL, file_name, line_counter, NULL);
                     return error_flag;
                 }
             }
@@ -218,10 +234,10 @@ int firstPass(char *file_name, FILE *file, struct MacroContext *macro_context)
             /* If IC is 0*/
             else
             {
-                if ((machine_code_ptr->DC) + L > MAX_MEM_SIZE)
+                if (!ctx->optimizations && (machine_code_ptr->DC) + L > machine_code_ptr->mem_size)
                 {
                     error_flag = 1;
-                    printf("Error: the program has reached maximum memmory size allowed.\n ");
+                    report_error(&ctx->errors, ERROR_MEMORY_FULL, file_name, line_counter, NULL);
                     return error_flag;
                 }
             }
@@ -230,7 +246,7 @@ int firstPass(char *file_name, FILE *file, struct MacroContext *macro_context)
             {
                 for (i = 0; i < L; i++)
                 {
-                    machine_code_ptr->data_image[machine_code_ptr->DC] = answer.ast_options.dir.dir_options.data[i];
+                    store_data_word(machine_code_ptr, machine_code_ptr->DC, answer.ast_options.dir.dir_options.data[i]);
                     /* Increment DC after each data entry to ensure proper placement in data image */
                     if ((i < L - 1) || answer.ast_options.dir.dir_type == ast_data)
                     {
@@ -249,29 +265,13 @@ int firstPass(char *file_name, FILE *file, struct MacroContext *macro_context)
         /* Calculate words if its inst variable*/
         else if (answer.ast_type == ast_inst)
         {
-            L = 1; /* Initialize the word counter for inst */
-            for (i = 0; i < 2; i++)
-            {
-                if (answer.ast_options.inst.operands[i].operand_type != ast_none)
-                {
-                    L++;
-                }
-            }
-
-            /* if there are 2 operands both registers */
-            if (L == 3)
-            {
-                if (((answer.ast_options.inst.operands[0].operand_type == ast_register_direct) || (answer.ast_options.inst.operands[0].operand_type == ast_register_address)) &&
-                    ((answer.ast_options.inst.operands[1].operand_type == ast_register_direct) || (answer.ast_options.inst.operands[1].operand_type == ast_register_address)))
-                {
-                    L--;
-                }
-            }
+            /* The target decides if two register operands share a word */
+            L = TARGET_INSTRUCTION_WORDS(answer.ast_options.inst.operands[0].operand_type, answer.ast_options.inst.operands[1].operand_type);
 
             /* Initialize IC if needed */
             if ((machine_code_ptr->IC) == 0)
             {
-                (machine_code_ptr->IC) = 100;
+                (machine_code_ptr->IC) = TARGET_LOAD_BASE;
             }
 
             /* Increase IC */
@@ -281,12 +281,12 @@ int firstPass(char *file_name, FILE *file, struct MacroContext *macro_context)
     }
 
     /* Check if there is entry without defeniton */
-    found = head_ptr;
+    found = ctx->symbol_table;
     while (found)
     {
         if (found->symbol_type == entry_symbol)
         {
-            printf("Error: In file %s at line %d symbol %s declared as entry but never defined.\n", file_name, found->symbol_address, found->symbol_name);
+            report_error(&ctx->errors, ERROR_ENTRY_UNDEFINED, file_name, found->symbol_address, found->symbol_name);
             error_flag = 1;
             return error_flag;
         }
@@ -300,7 +300,7 @@ int firstPass(char *file_name, FILE *file, struct MacroContext *macro_context)
             }
             else
             {
-                (found->symbol_address) += 100;
+                (found->symbol_address) += TARGET_LOAD_BASE;
             }
         }
         found = (found->next);
@@ -8,11 +8,9 @@
 #include "output.h"
 #include "macroProcessing.h"
 
-/* Prototypes */
-int firstPass(char *file_name, FILE *file, struct MacroContext *macro_table);
+struct assembler_context; /* Forward declaration of struct assembler_context */
 
-/* External variable declarations */
-extern table_ptr head_ptr; /* Pointer to the head of the symbol table */
-extern table_ptr found;    /* Pointer to the found symbol in the table */
+/* Prototypes */
+int firstPass(struct assembler_context *ctx, const char *file_name);
 
 #endif
@@ -1,4 +1,5 @@
 #include "helpingFunction.h"
+#include "stats.h"
 
 /* Saved words array for use in other files */
 char *saved_words[] = {"mov", "cmp", "add", "sub",
@@ -10,14 +11,20 @@ char *saved_words[] = {"mov", "cmp", "add", "sub",
 /**
  * @brief Allocates memory using a specified allocation function.
  *
+ * The name is parenthesized, like that of reallocateMemory, so that the TRACK_ALLOCATIONS
+ * macros of helpingFunction.h do not replace it.
+ *
  * @param numElements Number of elements to allocate.
  * @param sizeOfElement Size of each element.
  * @param functionID The ID specifying the allocation function (CALLOC, MALLOC, REALLOC).
  * @return void* Pointer to the allocated memory, or NULL if allocation fails.
  */
-void *allocateMemory(size_t numElements, size_t sizeOfElement, int functionID)
+void *(allocateMemory)(size_t numElements, size_t sizeOfElement, int functionID)
 {
     void *ptr;
+
+    COUNT_STAT(allocations, 1);
+    COUNT_STAT(allocated_bytes, (long)(numElements * sizeOfElement));
     switch (functionID)
     {
     case MALLOC_ID:
@@ -35,6 +42,27 @@ void *allocateMemory(size_t numElements, size_t sizeOfElement, int functionID)
     return ptr;
 }
 
+/**
+ * @brief Resizes a memory block previously returned by allocateMemory.
+ *
+ * @param ptr The memory block to resize, or NULL to allocate a new one.
+ * @param numElements Number of elements the block must hold.
+ * @param sizeOfElement Size of each element.
+ * @return void* Pointer to the resized memory. The program exits if the allocation fails.
+ */
+void *(reallocateMemory)(void *ptr, size_t numElements, size_t sizeOfElement)
+{
+    COUNT_STAT(allocations, 1);
+    COUNT_STAT(allocated_bytes, (long)(numElements * sizeOfElement));
+    ptr = realloc(ptr, numElements * sizeOfElement);
+
+    if (ptr == NULL)
+    {
+        failureExit("Memory allocation failed");
+    }
+    return ptr;
+}
+
 /**
  * @brief Checks if a string is a valid label and optionally updates the AST.
  *
@@ -57,13 +85,13 @@ int is_label(char const *str, struct ast *ast, int const definition)
 
     if (!isalpha(str[0]))
     {
-        strcpy(ast->lineError, "Label must start with a letter");
+        ast->error = PARSE_LABEL_START;
         return 0;
     }
 
     if (size > MAX_LABEL_SIZE)
     {
-        strcpy(ast->lineError, "Label is too long.. Not more than 31 chars.");
+        ast->error = PARSE_LABEL_TOO_LONG;
         return 0;
     }
 
@@ -75,7 +103,7 @@ int is_label(char const *str, struct ast *ast, int const definition)
         }
         if (!isalpha(str[i]) && !isdigit(str[i]))
         {
-            strcpy(ast->lineError, "Label must contain only letters and digits");
+            ast->error = PARSE_LABEL_CHARACTERS;
             return 0;
         }
     }
@@ -123,7 +151,7 @@ int is_instruction(char const *str, struct ast *ast)
         if (strcmp(str, inst_table[i].name) == 0)
         {
             ast->ast_type = ast_inst;
-            ast->ast_options.inst.inst_type = inst_table[i].opcode;
+            ast->ast_options.inst.inst_type = i; /* The operation, the target gives its opcode */
             ast->ast_options.inst.operands[0].operand_type = ast_none;
             ast->ast_options.inst.operands[1].operand_type = ast_none;
             return 1;
@@ -21,10 +21,27 @@ enum FunctionId
 
 /* Prototype Functions */
 void *allocateMemory(size_t numElements, size_t sizeOfElement, int functionID);
+void *reallocateMemory(void *ptr, size_t numElements, size_t sizeOfElement);
 int is_instruction(char const *str, struct ast *ast);
 int is_label(char const *str, struct ast *ast, int const definition);
 int is_register(char const *str);
 void failureExit(char *message);
 int is_saved_word(char const *str);
 
+/*
+ * Built with TRACK_ALLOCATIONS, every allocation and free goes through allocTracker.c,
+ * counted in the category the including file defines as ALLOC_CATEGORY.
+ */
+#ifdef TRACK_ALLOCATIONS
+#include "allocTracker.h"
+#ifndef ALLOC_CATEGORY
+#define ALLOC_CATEGORY ALLOC_OTHER
+#endif
+#define allocateMemory(numElements, sizeOfElement, functionID) \
+    track_allocate(numElements, sizeOfElement, functionID, ALLOC_CATEGORY)
+#define reallocateMemory(ptr, numElements, sizeOfElement) \
+    track_reallocate(ptr, numElements, sizeOfElement, ALLOC_CATEGORY)
+#define free(ptr) track_free(ptr)
+#endif
+
 #endif /* HELPINGFUNCTION_H */
@@ -0,0 +1,389 @@
+#define _POSIX_C_SOURCE 200809L /* posix_fadvise, open, fstat */
+#define ALLOC_CATEGORY ALLOC_OUTPUT /* Allocations counted by TRACK_ALLOCATIONS builds */
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "ioPipeline.h"
+#include "lineIndex.h"
+#include "output.h"
+#include "helpingFunction.h"
+
+/**
+ * @brief Reads a source ahead of its worker.
+ *
+ * Small files are read into the buffer. Large files are mapped by their worker,
+ * so the kernel is only asked to read them into its cache.
+ *
+ * @param file_name The name of the file, without the .as extension.
+ * @param text The buffer the file is read into.
+ * @return int The new state of the buffer.
+ */
+static int prefetch_source(const char *file_name, struct text_buffer *text)
+{
+    char chunk[TEXT_READ_CHUNK];
+    char *source_name = (char *)allocateMemory(strlen(file_name) + 4, sizeof(char), MALLOC_ID);
+    struct stat info;
+    ssize_t read_size;
+    int fd, state = PREFETCH_READY;
+
+    strcpy(source_name, file_name);
+    strcat(source_name, ".as");
+    fd = open(source_name, O_RDONLY);
+    free(source_name);
+    if (fd < 0)
+    {
+        return PREFETCH_FAILED;
+    }
+
+    if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size >= MAP_MIN_SIZE)
+    {
+        posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+        state = PREFETCH_ADVISED;
+    }
+    else
+    {
+        clear_text_buffer(text);
+        while ((read_size = read(fd, chunk, sizeof(chunk))) > 0)
+        {
+            append_text(text, chunk, (size_t)read_size);
+        }
+    }
+
+    close(fd);
+    return state;
+}
+
+/**
+ * @brief Reader thread: reads the sources in the order of the run, at most PREFETCH_DEPTH ahead.
+ *
+ * @param arg Pointer to the pipeline.
+ * @return void* Always NULL.
+ */
+static void *reader_main(void *arg)
+{
+    struct io_pipeline *pipeline = (struct io_pipeline *)arg;
+    struct prefetch_buffer *buffer;
+    int next, i, j, state;
+
+    for (next = 0; next < pipeline->files_counter; next++)
+    {
+        i = (pipeline->order != NULL) ? pipeline->order[next] : next;
+        pthread_mutex_lock(&pipeline->lock);
+        buffer = NULL;
+        while (!pipeline->stopping && !pipeline->taken[i] && buffer == NULL)
+        {
+            for (j = 0; j < PREFETCH_DEPTH && buffer == NULL; j++)
+            {
+                if (pipeline->buffers[j].state == PREFETCH_FREE)
+                {
+                    buffer = &pipeline->buffers[j];
+                }
+            }
+            if (buffer == NULL)
+            {
+                pthread_cond_wait(&pipeline->changed, &pipeline->lock);
+            }
+        }
+        if (pipeline->stopping)
+        {
+            pthread_mutex_unlock(&pipeline->lock);
+            break;
+        }
+        if (pipeline->taken[i])
+        {
+            /* Its worker was faster and read the file itself */
+            pthread_mutex_unlock(&pipeline->lock);
+            continue;
+        }
+        buffer->file_index = i;
+        buffer->state = PREFETCH_LOADING;
+        pthread_mutex_unlock(&pipeline->lock);
+
+        state = prefetch_source(pipeline->files[i], &buffer->text);
+
+        pthread_mutex_lock(&pipeline->lock);
+        buffer->state = state;
+        pthread_cond_broadcast(&pipeline->changed);
+        pthread_mutex_unlock(&pipeline->lock);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Writes or removes a single output, then frees it.
+ *
+ * @param output The output.
+ */
+static void flush_output(struct pending_output *output)
+{
+    if (output->removal)
+    {
+        remove(output->name);
+    }
+    else
+    {
+        write_output_content(output->name, output->content, output->size, output->skip_unchanged);
+    }
+    free(output->name);
+    free(output->content);
+    free(output);
+}
+
+/**
+ * @brief Writer thread: writes the outputs in the order they were queued.
+ *
+ * @param arg Pointer to the pipeline.
+ * @return void* Always NULL.
+ */
+static void *writer_main(void *arg)
+{
+    struct io_pipeline *pipeline = (struct io_pipeline *)arg;
+    struct pending_output *output;
+
+    pthread_mutex_lock(&pipeline->lock);
+    while (1)
+    {
+        while (pipeline->queue_head == NULL && !pipeline->stopping)
+        {
+            pthread_cond_wait(&pipeline->changed, &pipeline->lock);
+        }
+        if (pipeline->queue_head == NULL)
+        {
+            break; /* Stopping, and everything was written */
+        }
+
+        output = pipeline->queue_head;
+        pipeline->queue_head = output->next;
+        if (pipeline->queue_head == NULL)
+        {
+            pipeline->queue_tail = NULL;
+        }
+        pipeline->queue_length--;
+        pipeline->writing = 1;
+        pthread_cond_broadcast(&pipeline->changed);
+        pthread_mutex_unlock(&pipeline->lock);
+
+        flush_output(output);
+
+        pthread_mutex_lock(&pipeline->lock);
+        pipeline->writing = 0;
+        pthread_cond_broadcast(&pipeline->changed);
+    }
+    pthread_mutex_unlock(&pipeline->lock);
+    return NULL;
+}
+
+/**
+ * @brief Starts the reader and writer threads of a run.
+ *
+ * If a thread cannot be started the pipeline still works: the workers read
+ * their sources, or write their outputs, themselves.
+ *
+ * @param pipeline Pointer to the pipeline to start.
+ * @param files The input file names.
+ * @param order The order the workers take the files in (see sort_jobs_by_weight), or NULL for argument order.
+ * @param files_counter The number of input files.
+ */
+void start_io_pipeline(struct io_pipeline *pipeline, char **files, const int *order, int files_counter)
+{
+    int i;
+
+    pipeline->files = files;
+    pipeline->order = order;
+    pipeline->files_counter = files_counter;
+    pthread_mutex_init(&pipeline->lock, NULL);
+    pthread_cond_init(&pipeline->changed, NULL);
+    for (i = 0; i < PREFETCH_DEPTH; i++)
+    {
+        init_text_buffer(&pipeline->buffers[i].text);
+        pipeline->buffers[i].file_index = -1;
+        pipeline->buffers[i].state = PREFETCH_FREE;
+    }
+    pipeline->taken = (char *)allocateMemory(files_counter + 1, sizeof(char), CALLOC_ID);
+    pipeline->queue_head = NULL;
+    pipeline->queue_tail = NULL;
+    pipeline->queue_length = 0;
+    pipeline->writing = 0;
+    pipeline->stopping = 0;
+
+    pipeline->reader_started = pthread_create(&pipeline->reader, NULL, reader_main, pipeline) == 0;
+    pipeline->writer_started = pthread_create(&pipeline->writer, NULL, writer_main, pipeline) == 0;
+}
+
+/**
+ * @brief Stops the threads of a pipeline once every queued output is written.
+ *
+ * @param pipeline Pointer to the pipeline to stop.
+ */
+void stop_io_pipeline(struct io_pipeline *pipeline)
+{
+    int i;
+
+    pthread_mutex_lock(&pipeline->lock);
+    pipeline->stopping = 1;
+    pthread_cond_broadcast(&pipeline->changed);
+    pthread_mutex_unlock(&pipeline->lock);
+
+    if (pipeline->reader_started)
+    {
+        pthread_join(pipeline->reader, NULL);
+    }
+    if (pipeline->writer_started)
+    {
+        pthread_join(pipeline->writer, NULL);
+    }
+
+    for (i = 0; i < PREFETCH_DEPTH; i++)
+    {
+        release_text_buffer(&pipeline->buffers[i].text);
+    }
+    free(pipeline->taken);
+    pthread_cond_destroy(&pipeline->changed);
+    pthread_mutex_destroy(&pipeline->lock);
+}
+
+/**
+ * @brief Takes the source of a file read ahead by the reader thread.
+ *
+ * The buffers are swapped, so the memory of the worker's buffer is reused by the
+ * reader for a later file.
+ *
+ * @param pipeline The pipeline.
+ * @param file_index The index of the file.
+ * @param source The worker's buffer, which receives the source.
+ * @return int Returns 1 if source now holds the file, 0 if the worker must read it itself.
+ */
+int take_prefetched_source(struct io_pipeline *pipeline, int file_index, struct text_buffer *source)
+{
+    struct prefetch_buffer *buffer = NULL;
+    struct text_buffer swap;
+    int i, result = 0;
+
+    pthread_mutex_lock(&pipeline->lock);
+    pipeline->taken[file_index] = 1;
+    for (i = 0; i < PREFETCH_DEPTH && buffer == NULL; i++)
+    {
+        if (pipeline->buffers[i].file_index == file_index && pipeline->buffers[i].state != PREFETCH_FREE)
+        {
+            buffer = &pipeline->buffers[i];
+        }
+    }
+
+    if (buffer != NULL)
+    {
+        while (buffer->state == PREFETCH_LOADING)
+        {
+            pthread_cond_wait(&pipeline->changed, &pipeline->lock);
+        }
+        if (buffer->state == PREFETCH_READY)
+        {
+            swap = *source;
+            *source = buffer->text;
+            buffer->text = swap;
+            result = 1;
+        }
+        buffer->file_index = -1;
+        buffer->state = PREFETCH_FREE;
+        pthread_cond_broadcast(&pipeline->changed);
+    }
+    pthread_mutex_unlock(&pipeline->lock);
+    return result;
+}
+
+/**
+ * @brief Adds an output to the queue of the writer thread.
+ *
+ * @param pipeline The pipeline.
+ * @param output The output. It is written at once if the writer thread is not running.
+ */
+static void queue_output(struct io_pipeline *pipeline, struct pending_output *output)
+{
+    if (!pipeline->writer_started)
+    {
+        flush_output(output);
+        return;
+    }
+
+    pthread_mutex_lock(&pipeline->lock);
+    while (pipeline->queue_length >= WRITE_QUEUE_LIMIT)
+    {
+        pthread_cond_wait(&pipeline->changed, &pipeline->lock);
+    }
+    if (pipeline->queue_tail != NULL)
+    {
+        pipeline->queue_tail->next = output;
+    }
+    else
+    {
+        pipeline->queue_head = output;
+    }
+    pipeline->queue_tail = output;
+    pipeline->queue_length++;
+    pthread_cond_broadcast(&pipeline->changed);
+    pthread_mutex_unlock(&pipeline->lock);
+}
+
+/**
+ * @brief Creates an output for the queue of the writer thread.
+ *
+ * @param name The name of the output file.
+ * @param content The content, or NULL for a removal.
+ * @param size The size of the content.
+ * @param skip_unchanged Whether the existing file is kept if the content is unchanged.
+ * @param removal Set if the file is removed rather than written.
+ * @return struct pending_output* The new output.
+ */
+static struct pending_output *create_output(const char *name, char *content, size_t size, int skip_unchanged, int removal)
+{
+    struct pending_output *output = (struct pending_output *)allocateMemory(1, sizeof(struct pending_output), MALLOC_ID);
+
+    output->name = (char *)allocateMemory(strlen(name) + 1, sizeof(char), MALLOC_ID);
+    strcpy(output->name, name);
+    output->content = content;
+    output->size = size;
+    output->skip_unchanged = skip_unchanged;
+    output->removal = removal;
+    output->next = NULL;
+    return output;
+}
+
+/**
+ * @brief Queues the content of an output file for the writer thread.
+ *
+ * @param pipeline The pipeline.
+ * @param name The name of the output file.
+ * @param content The content, allocated with malloc. The pipeline frees it once written.
+ * @param size The size of the content.
+ * @param skip_unchanged Whether the existing file is kept if the content is unchanged.
+ */
+void queue_output_write(struct io_pipeline *pipeline, const char *name, char *content, size_t size, int skip_unchanged)
+{
+    queue_output(pipeline, create_output(name, content, size, skip_unchanged, 0));
+}
+
+/**
+ * @brief Queues the removal of an output file for the writer thread.
+ *
+ * @param pipeline The pipeline.
+ * @param name The name of the output file.
+ */
+void queue_output_removal(struct io_pipeline *pipeline, const char *name)
+{
+    queue_output(pipeline, create_output(name, NULL, 0, 0, 1));
+}
+
+/**
+ * @brief Waits until every queued output is written.
+ *
+ * @param pipeline The pipeline.
+ */
+void flush_io_pipeline(struct io_pipeline *pipeline)
+{
+    pthread_mutex_lock(&pipeline->lock);
+    while (pipeline->queue_head != NULL || pipeline->writing)
+    {
+        pthread_cond_wait(&pipeline->changed, &pipeline->lock);
+    }
+    pthread_mutex_unlock(&pipeline->lock);
+}
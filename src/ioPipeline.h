@@ -0,0 +1,81 @@
+#ifndef IOPIPELINE_H
+#define IOPIPELINE_H
+
+#include <stddef.h>
+#include <pthread.h>
+#include "textBuffer.h"
+
+#define PREFETCH_DEPTH 4     /* Number of sources read ahead of the workers */
+#define WRITE_QUEUE_LIMIT 64 /* Number of outputs waiting for the writer before the workers wait */
+
+/* State of a prefetch buffer */
+enum prefetch_state
+{
+    PREFETCH_FREE,    /* Not holding any file */
+    PREFETCH_LOADING, /* The reader thread is reading the file */
+    PREFETCH_READY,   /* The file was read into the buffer */
+    PREFETCH_ADVISED, /* The file is large, the kernel was asked to read it ahead instead */
+    PREFETCH_FAILED   /* The file could not be opened */
+};
+
+/**
+ * @brief A source read ahead by the reader thread.
+ */
+struct prefetch_buffer
+{
+    struct text_buffer text; /* The content of the file, when ready */
+    int file_index;          /* The index of the file, or -1 */
+    int state;               /* One of enum prefetch_state */
+};
+
+/**
+ * @brief An output waiting for the writer thread.
+ */
+struct pending_output
+{
+    char *name;                  /* The name of the output file */
+    char *content;               /* The content of the file, NULL for a removal */
+    size_t size;                 /* The size of the content */
+    int skip_unchanged;          /* Whether the existing file is kept if the content is unchanged */
+    int removal;                 /* Set if the file is removed rather than written */
+    struct pending_output *next; /* The next output in the queue */
+};
+
+/**
+ * @brief Overlaps the disk reads and writes of a run with the assembly of its files.
+ *
+ * A reader thread reads the sources of the next files, in the order the workers
+ * take them, while the
+ * workers assemble the current ones. A writer thread writes the outputs the
+ * workers produced, so a worker does not wait for the disk before starting
+ * its next file.
+ */
+struct io_pipeline
+{
+    char **files;                                   /* The input file names, without the .as extension */
+    const int *order;                               /* The order the files are read in, NULL for argument order */
+    int files_counter;                              /* Number of input files */
+    pthread_mutex_t lock;                           /* Protects everything below */
+    pthread_cond_t changed;                         /* Signaled whenever a buffer or the queue changes */
+    struct prefetch_buffer buffers[PREFETCH_DEPTH]; /* The sources read ahead */
+    char *taken;                                    /* taken[i] is set once a worker asked for file i */
+    struct pending_output *queue_head;              /* The next output to write */
+    struct pending_output *queue_tail;              /* The last output to write */
+    int queue_length;                               /* Number of outputs in the queue */
+    int writing;                                    /* Set while the writer thread writes an output */
+    int stopping;                                   /* Set once the run is done */
+    pthread_t reader;                               /* The reader thread */
+    pthread_t writer;                               /* The writer thread */
+    int reader_started;                             /* Set if the reader thread runs */
+    int writer_started;                             /* Set if the writer thread runs */
+};
+
+/* Prototypes */
+void start_io_pipeline(struct io_pipeline *pipeline, char **files, const int *order, int files_counter);
+void stop_io_pipeline(struct io_pipeline *pipeline);
+int take_prefetched_source(struct io_pipeline *pipeline, int file_index, struct text_buffer *source);
+void queue_output_write(struct io_pipeline *pipeline, const char *name, char *content, size_t size, int skip_unchanged);
+void queue_output_removal(struct io_pipeline *pipeline, const char *name);
+void flush_io_pipeline(struct io_pipeline *pipeline);
+
+#endif
@@ -0,0 +1,185 @@
+#define _POSIX_C_SOURCE 200809L /* mmap, open, fstat */
+#define ALLOC_CATEGORY ALLOC_TOKENIZER /* Allocations counted by TRACK_ALLOCATIONS builds */
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "lineIndex.h"
+#include "helpingFunction.h"
+
+/**
+ * @brief Initializes an empty line index.
+ *
+ * @param index Pointer to the index to initialize.
+ */
+void init_line_index(struct line_index *index)
+{
+    index->lines = NULL;
+    index->lines_counter = 0;
+    index->lines_capacity = 0;
+}
+
+/**
+ * @brief Finds the lines of a text, replacing the lines of the index.
+ *
+ * Lines longer than MAX_LINE_CHARS are flagged in the same pass, so the readers
+ * of the index do not need to measure them again.
+ *
+ * @param index Pointer to the index.
+ * @param text The text. It must stay in place while the index is used.
+ * @param length The number of characters in the text.
+ */
+void build_line_index(struct line_index *index, const char *text, size_t length)
+{
+    const char *position = text, *end = text + length, *new_line, *line_end;
+    struct line_view *line;
+
+    index->lines_counter = 0;
+    while (position < end)
+    {
+        new_line = (const char *)memchr(position, '\n', end - position);
+        line_end = (new_line != NULL) ? new_line + 1 : end;
+
+        if (index->lines_counter == index->lines_capacity)
+        {
+            index->lines_capacity = (index->lines_capacity > 0) ? index->lines_capacity * 2 : LINE_INDEX_INITIAL_SIZE;
+            index->lines = (struct line_view *)reallocateMemory(index->lines, index->lines_capacity, sizeof(struct line_view));
+        }
+
+        line = &index->lines[index->lines_counter++];
+        line->text = position;
+        line->length = line_end - position;
+        line->too_long = line->length - (new_line != NULL) > MAX_LINE_CHARS;
+        position = line_end;
+    }
+}
+
+/**
+ * @brief Empties a line index while keeping its memory for the next text.
+ *
+ * @param index Pointer to the index to clear.
+ */
+void clear_line_index(struct line_index *index)
+{
+    index->lines_counter = 0;
+}
+
+/**
+ * @brief Releases the memory held by a line index.
+ *
+ * @param index Pointer to the index to release.
+ */
+void release_line_index(struct line_index *index)
+{
+    free(index->lines);
+    init_line_index(index);
+}
+
+/**
+ * @brief Copies a line into a null terminated buffer, for the parsers.
+ *
+ * @param line The line to copy.
+ * @param dest The buffer the line is copied to.
+ * @param size The size of dest. A longer line is truncated.
+ */
+void copy_line(const struct line_view *line, char *dest, size_t size)
+{
+    size_t count = (line->length < size - 1) ? line->length : size - 1;
+
+    memcpy(dest, line->text, count);
+    dest[count] = '\0';
+}
+
+/**
+ * @brief Initializes an empty mapped text.
+ *
+ * @param mapped Pointer to the mapped text to initialize.
+ */
+void init_mapped_text(struct mapped_text *mapped)
+{
+    mapped->text = "";
+    mapped->length = 0;
+    mapped->mapping = NULL;
+    mapped->mapping_length = 0;
+}
+
+/**
+ * @brief Gives access to the content of a file.
+ *
+ * Large regular files are mapped in memory, so their content is never copied.
+ * Small files, and files that cannot be mapped, are read into the fallback buffer.
+ *
+ * @param mapped Pointer to the mapped text to fill. A previous content must have been unmapped.
+ * @param file_name The name of the file.
+ * @param fallback The buffer the file is read into when it is not mapped.
+ * @return int Returns 1 on success, 0 if the file cannot be opened.
+ */
+int map_text_file(struct mapped_text *mapped, const char *file_name, struct text_buffer *fallback)
+{
+    char chunk[TEXT_READ_CHUNK];
+    struct stat info;
+    ssize_t read_size;
+    void *mapping;
+    int fd = open(file_name, O_RDONLY);
+
+    if (fd < 0)
+    {
+        return 0;
+    }
+
+    init_mapped_text(mapped);
+    if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size >= MAP_MIN_SIZE)
+    {
+        mapping = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping != MAP_FAILED)
+        {
+            mapped->mapping = mapping;
+            mapped->mapping_length = (size_t)info.st_size;
+            mapped->text = (const char *)mapping;
+            mapped->length = mapped->mapping_length;
+            close(fd);
+            return 1;
+        }
+    }
+
+    clear_text_buffer(fallback);
+    while ((read_size = read(fd, chunk, sizeof(chunk))) > 0)
+    {
+        append_text(fallback, chunk, (size_t)read_size);
+    }
+    close(fd);
+
+    use_text_buffer(mapped, fallback);
+    return 1;
+}
+
+/**
+ * @brief Makes a mapped text refer to the content of a text buffer.
+ *
+ * @param mapped Pointer to the mapped text. A previous content must have been unmapped.
+ * @param buffer The buffer, which must stay in place while the mapped text is used.
+ */
+void use_text_buffer(struct mapped_text *mapped, const struct text_buffer *buffer)
+{
+    init_mapped_text(mapped);
+    if (buffer->length > 0)
+    {
+        mapped->text = buffer->text;
+        mapped->length = buffer->length;
+    }
+}
+
+/**
+ * @brief Releases the mapping of a mapped text, if any.
+ *
+ * @param mapped Pointer to the mapped text. It is left empty.
+ */
+void unmap_text(struct mapped_text *mapped)
+{
+    if (mapped->mapping != NULL)
+    {
+        munmap(mapped->mapping, mapped->mapping_length);
+    }
+    init_mapped_text(mapped);
+}
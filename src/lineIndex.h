@@ -0,0 +1,58 @@
+#ifndef LINEINDEX_H
+#define LINEINDEX_H
+
+#include <stddef.h>
+#include "textBuffer.h"
+
+#define MAX_LINE_CHARS 80           /* Longest line allowed in a source, without its new line */
+#define LINE_INDEX_INITIAL_SIZE 256 /* Initial capacity of a line index */
+#define MAP_MIN_SIZE 65536          /* Smaller files are read, mapping them costs more than it saves */
+
+/**
+ * @brief A line of a text, pointing into the text itself.
+ *
+ * The line is not null terminated. Its length includes the new line, if any.
+ */
+struct line_view
+{
+    const char *text; /* The first character of the line */
+    size_t length;    /* Number of characters in the line, with its new line */
+    int too_long;     /* Set if the line has more than MAX_LINE_CHARS characters */
+};
+
+/**
+ * @brief The lines of a text, found in a single pass over it.
+ *
+ * The views point into the text, which must not move or change while the index is used.
+ * Clearing an index keeps its memory for the next text.
+ */
+struct line_index
+{
+    struct line_view *lines; /* The lines, in order */
+    int lines_counter;       /* Number of lines */
+    int lines_capacity;      /* Number of lines allocated */
+};
+
+/**
+ * @brief The content of a file, mapped in memory or read into a buffer.
+ */
+struct mapped_text
+{
+    const char *text;      /* The content, not null terminated */
+    size_t length;         /* Number of characters in text */
+    void *mapping;         /* The mapping holding text, or NULL if text was read */
+    size_t mapping_length; /* Size of the mapping */
+};
+
+/* Prototypes */
+void init_line_index(struct line_index *index);
+void build_line_index(struct line_index *index, const char *text, size_t length);
+void clear_line_index(struct line_index *index);
+void release_line_index(struct line_index *index);
+void copy_line(const struct line_view *line, char *dest, size_t size);
+void init_mapped_text(struct mapped_text *mapped);
+int map_text_file(struct mapped_text *mapped, const char *file_name, struct text_buffer *fallback);
+void use_text_buffer(struct mapped_text *mapped, const struct text_buffer *buffer);
+void unmap_text(struct mapped_text *mapped);
+
+#endif
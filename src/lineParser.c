@@ -1,23 +1,52 @@
+#define ALLOC_CATEGORY ALLOC_PARSER /* Allocations counted by TRACK_ALLOCATIONS builds */
 #include "lineParser.h"
 
-/* Instructions Table init */
-struct inst inst_table[INST_SIZE] = {
-    {"mov", 0, "0123", "123"},
-    {"cmp", 1, "0123", "0123"},
-    {"add", 2, "0123", "123"},
-    {"sub", 3, "0123", "123"},
-    {"lea", 4, "1", "123"},
-    {"clr", 5, "", "123"},
-    {"not", 6, "", "123"},
-    {"inc", 7, "", "123"},
-    {"dec", 8, "", "123"},
-    {"jmp", 9, "", "12"},
-    {"bne", 10, "", "12"},
-    {"red", 11, "", "123"},
-    {"prn", 12, "", "0123"},
-    {"jsr", 13, "", "12"},
-    {"rts", 14, "", ""},
-    {"stop", 15, "", ""}};
+/* Instructions Table init, from the target description */
+struct inst inst_table[INST_SIZE] = {TARGET_INSTRUCTIONS};
+
+/* The message of every parse error, %s is the name of the instruction the error is about */
+static const char *parse_error_formats[PARSE_ERROR_COUNT] = {
+    "",
+    "Label must start with a letter",
+    "Label is too long.. Not more than 31 chars.",
+    "Label must contain only letters and digits",
+    "Label definition must end with ':'",
+    "Label name is a saved word",
+    "Label name is a already defined as macro name",
+    "String data is missing",
+    "String must start with \"",
+    "String must end with \"",
+    "Data is missing",
+    "Comma must not be at the start or end of the line",
+    "Comma must not be one after another",
+    "Number must be separated by comma",
+    "Invalid number",
+    "Number is too big",
+    "Number is too small",
+    "Invalid directive",
+    "Invalid directive or instruction",
+    "Instruction line syntax error",
+    "Comma must not come after the instruction",
+    "Comma must not be at the end of the line",
+    "Instruction must have two operands while separated by comma",
+    "Comma must be between operands",
+    "Instruction must have one operand only",
+    "Instruction must have no operands",
+    "Invalid source operand type in %s instruction",
+    "Invalid dest operand type in %s instruction",
+    "Invalid source operand type in Invalid dest operand type in %s instruction"};
+
+/**
+ * @brief Writes the message of a parse error, only done when the error is printed.
+ *
+ * @param error One of enum parse_error.
+ * @param inst The instruction the error is about, used by the operand type errors.
+ * @param message The buffer of ERROR_LINE characters the message is written to.
+ */
+void format_parse_error(int error, int inst, char *message)
+{
+    sprintf(message, parse_error_formats[error], inst_table[inst].name);
+}
 
 /**
  * @brief Validates if a string represents a number within a specified range.
@@ -78,7 +107,7 @@ int is_defined_macro(char *label, struct MacroContext *macro_table)
     int i;
     for (i = 0; i < macro_table->macro_counter; i++)
     {
-        if (strcmp(label, macro_table->macro_table[i]->name) == 0) /* If label is a macro name */
+        if (strcmp(label, macro_table->macro_table[i].name) == 0) /* If label is a macro name */
         {
             return 1;
         }
@@ -102,14 +131,14 @@ int fill_string(struct string_split const split_result, int const index, struct
     /* If string section isn't defined in file */
     if (split_result.size <= index)
     {
-        strcpy(ast->lineError, "String data is missing");
+        ast->error = PARSE_STRING_MISSING;
         return 0;
     }
 
     /* Check for opening " */
     if (split_result.string[index][0] != STRING_CHAR)
     {
-        strcpy(ast->lineError, "String must start with \"");
+        ast->error = PARSE_STRING_START;
         return 0;
     }
 
@@ -117,7 +146,7 @@ int fill_string(struct string_split const split_result, int const index, struct
     last_idx = split_result.size - 1;
     if (split_result.string[last_idx][strlen(split_result.string[last_idx]) - 1] != STRING_CHAR)
     {
-        strcpy(ast->lineError, "String must end with \"");
+        ast->error = PARSE_STRING_END;
         return 0;
     }
 
@@ -160,7 +189,8 @@ int fill_string(struct string_split const split_result, int const index, struct
 int validate_numbers(struct string_split const split_str, int const size, struct ast *ast, int const index)
 {
     int i, data_size_ = 0, flag_comma = 0, flag_number = 0, num, result, results[RESULT_ARR_SIZE] = {0};
-    char *concat_str = (char *)allocateMemory(MAX_LINE, sizeof(char), CALLOC_ID);
+    char concat_buffer[SPLIT_BUFFER_SIZE] = {0};
+    char *concat_str = concat_buffer;
     char *end_ptr;
 
     /* Concat substring to single string */
@@ -176,14 +206,14 @@ int validate_numbers(struct string_split const split_str, int const size, struct
     /* Check data is defined in .data */
     if (concat_str[0] == NULL_BYTE)
     {
-        strcpy(ast->lineError, "Data is missing");
+        ast->error = PARSE_DATA_MISSING;
         return 0;
     }
 
     /* If first or last char in .data is comma , */
     if (concat_str[0] == COMMA_CHAR || concat_str[strlen(concat_str) - 1] == COMMA_CHAR)
     {
-        strcpy(ast->lineError, "Comma must not be at the start or end of the line");
+        ast->error = PARSE_DATA_COMMA_EDGE;
         return 0;
     }
 
@@ -194,7 +224,7 @@ int validate_numbers(struct string_split const split_str, int const size, struct
         {
             if (flag_comma == 1)
             {
-                strcpy(ast->lineError, "Comma must not be one after another");
+                ast->error = PARSE_DATA_COMMA_REPEATED;
                 return 0;
             }
 
@@ -206,7 +236,7 @@ int validate_numbers(struct string_split const split_str, int const size, struct
         {
             if (flag_number == 1)
             {
-                strcpy(ast->lineError, "Number must be separated by comma");
+                ast->error = PARSE_DATA_COMMA_MISSING;
                 return 0;
             }
 
@@ -215,17 +245,17 @@ int validate_numbers(struct string_split const split_str, int const size, struct
             switch (result)
             {
             case 0:
-                strcpy(ast->lineError, "Invalid number");
+                ast->error = PARSE_INVALID_NUMBER;
                 return 0;
             case 1:
                 concat_str = end_ptr;        /* Skip number */
                 results[data_size_++] = num; /* Add number to data section */
                 break;
             case 2:
-                strcpy(ast->lineError, "Number is too big");
+                ast->error = PARSE_NUMBER_TOO_BIG;
                 return 0;
             case 3:
-                strcpy(ast->lineError, "Number is too small");
+                ast->error = PARSE_NUMBER_TOO_SMALL;
                 return 0;
             }
         }
@@ -287,7 +317,7 @@ int get_operand_type(char *operand, struct ast *ast)
     }
     else
     {
-        strcpy(ast->lineError, "Instruction line syntax error"); /* Invalid operand */
+        ast->error = PARSE_OPERAND_SYNTAX; /* Invalid operand */
         ast->ast_type = ast_error;
         return -1;
     }
@@ -335,15 +365,15 @@ void update_ast_operands(char *value, struct ast *ast, int operand_type, int ope
     switch (result) /* Check if number is valid after calling is_number function (if called) */
     {
     case 0:
-        strcpy(ast->lineError, "Invalid number");
+        ast->error = PARSE_INVALID_NUMBER;
         ast->ast_type = ast_error;
         break;
     case 2:
-        strcpy(ast->lineError, "Number is too big");
+        ast->error = PARSE_NUMBER_TOO_BIG;
         ast->ast_type = ast_error;
         break;
     case 3:
-        strcpy(ast->lineError, "Number is too small");
+        ast->error = PARSE_NUMBER_TOO_SMALL;
         ast->ast_type = ast_error;
         break;
     default:
@@ -359,31 +389,20 @@ void update_ast_operands(char *value, struct ast *ast, int operand_type, int ope
  *
  * @return void This function does not return a value.
  *
- * @details This function updates the AST with the source and destination operands based on the split result of an instruction line. It performs validation of operand types and updates the AST with the correct operand values. If any operand type is invalid, it sets an error message in the AST.
+ * @details This function updates the AST with the source and destination operands based on the split result of an instruction line. It performs validation of operand types and updates the AST with the correct operand values. If any operand type is invalid, it sets an error code in the AST.
  */
 void set_ast_inst_two_operands(struct ast *ast, struct string_split split_result)
 {
     struct inst inst = inst_table[ast->ast_options.inst.inst_type];
-    char line_error[MAX_LINE] = {0}, operand_type[MAX_LINE] = {0};
     int source_type = get_operand_type(split_result.string[0], ast);
     int dest_type = get_operand_type(split_result.string[1], ast);
+    int source_valid = is_op_valid(source_type, inst.source); /* Check if source operand is valid */
+    int dest_valid = is_op_valid(dest_type, inst.dest);       /* Check if dest operand is valid */
 
-    if (is_op_valid(source_type, inst.source) == 0) /* Check if source operand is valid */
-    {
-        strcpy(operand_type, "Invalid source operand type in ");
-    }
-
-    if (is_op_valid(dest_type, inst.dest) == 0) /* Check if dest operand is valid */
+    if (!source_valid || !dest_valid) /* If operand type is invalid */
     {
-        strcat(operand_type, "Invalid dest operand type in ");
-    }
-
-    if (strlen(operand_type) > 0) /* If operand type is invalid */
-    {
-        strcat(line_error, operand_type);
-        strcat(line_error, inst.name);
-        strcat(line_error, " instruction");
-        strcpy(ast->lineError, line_error);
+        ast->error = source_valid ? PARSE_DEST_TYPE : (dest_valid ? PARSE_SOURCE_TYPE : PARSE_OPERAND_TYPES);
+        ast->error_inst = ast->ast_options.inst.inst_type;
         ast->ast_type = ast_error;
         return;
     }
@@ -400,20 +419,17 @@ void set_ast_inst_two_operands(struct ast *ast, struct string_split split_result
  *
  * @return void This function does not return a value.
  *
- * @details This function updates the AST with the destination operand based on the split result of an instruction line. It validates the operand type and updates the AST with the correct operand value. If the operand type is invalid, it sets an error message in the AST.
+ * @details This function updates the AST with the destination operand based on the split result of an instruction line. It validates the operand type and updates the AST with the correct operand value. If the operand type is invalid, it sets an error code in the AST.
  */
 void set_ast_inst_one_operands(struct ast *ast, struct string_split split_result)
 {
     struct inst inst = inst_table[ast->ast_options.inst.inst_type];
-    char line_error[MAX_LINE] = {0};
     int dest_type = get_operand_type(split_result.string[0], ast); /* Get operand type */
 
     if (is_op_valid(dest_type, inst.dest) == 0) /* Check if dest operand is valid */
     {
-        strcat(line_error, "Invalid dest operand type in ");
-        strcat(line_error, inst.name);
-        strcat(line_error, " instruction");
-        strcpy(ast->lineError, line_error);
+        ast->error = PARSE_DEST_TYPE;
+        ast->error_inst = ast->ast_options.inst.inst_type;
         ast->ast_type = ast_error;
         return;
     }
@@ -428,16 +444,19 @@ void set_ast_inst_one_operands(struct ast *ast, struct string_split split_result
  * @param index The starting index of the subset to be concatenated.
  * @param size The number of strings to concatenate from the starting index.
  *
- * @return char* A pointer to the newly allocated and concatenated string.
+ * @param concat_string The buffer the strings are concatenated into, at least SPLIT_BUFFER_SIZE long.
+ *
+ * @return char* A pointer to the concatenated string, which is concat_string.
  */
-char *concat_string_split(struct string_split split_result, int const index, int const size)
+char *concat_string_split(struct string_split const *split_result, int const index, int const size, char *concat_string)
 {
-    char *concat_string = (char *)allocateMemory(MAX_LINE, sizeof(char), CALLOC_ID);
     int i = 0;
 
+    concat_string[0] = NULL_BYTE;
+
     for (i = index; i < size; i++)
     {
-        strcat(concat_string, split_result.string[i]);
+        strcat(concat_string, split_result->string[i]);
         if (i != size - 1)
         {
             strcat(concat_string, SPACE);
@@ -501,28 +520,29 @@ int has_comma_between_operands(const char *string, const char *first_operand, co
  */
 void parse_operands(struct string_split operands, int index, struct ast *ast)
 {
-    struct string_split temp_split_str = {0};
+    struct string_split temp_split_str;
     struct inst inst = inst_table[ast->ast_options.inst.inst_type];
-    char *concat_string = (char *)allocateMemory(MAX_LINE, sizeof(char), CALLOC_ID);
-    char *original_concat_string = (char *)allocateMemory(MAX_LINE, sizeof(char), CALLOC_ID);
-    char *temp_concat;
+    char concat_string[SPLIT_BUFFER_SIZE];
+    char original_concat_string[SPLIT_BUFFER_SIZE];
+    char temp_concat[SPLIT_BUFFER_SIZE];
     int i = 0;
 
+    temp_split_str.size = 0;
+
     /* Concat string */
-    strcpy(concat_string, concat_string_split(operands, index, operands.size));
+    concat_string_split(&operands, index, operands.size, concat_string);
     strcpy(original_concat_string, concat_string);
 
     /* If comma in string and instruction only source and dest operands, we need to split string by comma */
     if ((operands.size > index) && strchr(concat_string, COMMA_CHAR) != NULL && inst.source[0] && inst.dest[0])
     {
         /* First part: Split by comma */
-        temp_split_str = split_string(concat_string, COMMA);
+        split_string(&temp_split_str, concat_string, COMMA);
 
         /* Second part: Remove spaces if exists (just in case) */
         if (temp_split_str.size == 2)
         {
-            temp_concat = (char *)allocateMemory(MAX_LINE, sizeof(char), CALLOC_ID); /* Init temp_concat */
-            strcpy(temp_concat, concat_string_split(temp_split_str, 0, temp_split_str.size));
+            concat_string_split(&temp_split_str, 0, temp_split_str.size, temp_concat);
 
             for (i = 0; i < temp_split_str.size; i++)
             {
@@ -530,27 +550,26 @@ void parse_operands(struct string_split operands, int index, struct ast *ast)
             }
             temp_split_str.size = 0;
 
-            temp_split_str = split_string(temp_concat, SPACES);
+            split_string(&temp_split_str, temp_concat, SPACES);
 
             memset(concat_string, 0, strlen(concat_string));
             strcpy(concat_string, temp_concat);
-            free(temp_concat);
         }
     }
 
     /* If comma not in string, split by SPACE */
     if (!temp_split_str.size)
-        temp_split_str = split_string(concat_string, SPACE);
+        split_string(&temp_split_str, concat_string, SPACE);
 
     if (index < operands.size && operands.string[index][0] == COMMA_CHAR)
     {
-        strcpy(ast->lineError, "Comma must not come after the instruction");
+        ast->error = PARSE_COMMA_AFTER_INSTRUCTION;
         ast->ast_type = ast_error;
         return;
     }
     else if (operands.string[operands.size - 1][0] == COMMA_CHAR)
     {
-        strcpy(ast->lineError, "Comma must not be at the end of the line");
+        ast->error = PARSE_COMMA_AT_END;
         ast->ast_type = ast_error;
         return;
     }
@@ -560,14 +579,14 @@ void parse_operands(struct string_split operands, int index, struct ast *ast)
     {
         if (temp_split_str.size != 2)
         {
-            strcpy(ast->lineError, "Instruction must have two operands while separated by comma");
+            ast->error = PARSE_TWO_OPERANDS;
             ast->ast_type = ast_error;
             return;
         }
 
         if ((index + 1) < operands.size && !has_comma_between_operands(original_concat_string, temp_split_str.string[0], temp_split_str.string[1]))
         {
-            strcpy(ast->lineError, "Comma must be between operands");
+            ast->error = PARSE_COMMA_BETWEEN_OPERANDS;
             ast->ast_type = ast_error;
             return;
         }
@@ -579,7 +598,7 @@ void parse_operands(struct string_split operands, int index, struct ast *ast)
     {
         if (temp_split_str.size != 1)
         {
-            strcpy(ast->lineError, "Instruction must have one operand only");
+            ast->error = PARSE_ONE_OPERAND;
             ast->ast_type = ast_error;
             return;
         }
@@ -591,14 +610,12 @@ void parse_operands(struct string_split operands, int index, struct ast *ast)
     {
         if (temp_split_str.size != 0)
         {
-            strcpy(ast->lineError, "Instruction must have no operands");
+            ast->error = PARSE_NO_OPERANDS;
             ast->ast_type = ast_error;
             return;
         }
         /* None action needed cause no operands in these instruction type */
     }
-
-    free(concat_string);
 }
 
 /**
@@ -642,7 +659,7 @@ void fill_directive_ast(struct ast *ast, struct string_split split_result, int i
     }
     else
     {
-        strcpy(ast->lineError, "Invalid directive"); /* Invalid directive */
+        ast->error = PARSE_INVALID_DIRECTIVE; /* Invalid directive */
         ast->ast_type = ast_error;
     }
 }
@@ -666,7 +683,9 @@ struct ast get_ast_from_line(char *line, struct MacroContext *macro_table)
     struct ast ast = {0}; /* Init ast type */
     int index = 0;        /* index init */
 
-    struct string_split split_result = split_string(line, SPACES); /* Split line into substrings */
+    struct string_split split_result;
+
+    split_string(&split_result, line, SPACES); /* Split line into substrings */
 
     /* Empty line case */
     if (split_result.size == 0)
@@ -693,7 +712,7 @@ struct ast get_ast_from_line(char *line, struct MacroContext *macro_table)
         if (ast.labelName[strlen(ast.labelName) - 1] != LABEL_CHAR)
         {
             ast.ast_type = ast_error;
-            strcpy(ast.lineError, "Label definition must end with ':'");
+            ast.error = PARSE_LABEL_COLON;
             return ast;
         }
 
@@ -701,27 +720,27 @@ struct ast get_ast_from_line(char *line, struct MacroContext *macro_table)
 
         if (is_saved_word(ast.labelName))
         {
-            strcpy(ast.lineError, "Label name is a saved word");
+            ast.error = PARSE_LABEL_SAVED_WORD;
             ast.ast_type = ast_error;
             return ast;
         }
         else if (macro_table != NULL && is_defined_macro(ast.labelName, macro_table))
         {
-            strcpy(ast.lineError, "Label name is a already defined as macro name");
+            ast.error = PARSE_LABEL_MACRO;
             ast.ast_type = ast_error;
             return ast;
         }
     }
 
     /* If current line is directive line with . */
-    if (ast.lineError[0] == NULL_BYTE && split_result.string[index][0] == DIRECTIVE_CHAR)
+    if (ast.error == PARSE_OK && split_result.string[index][0] == DIRECTIVE_CHAR)
     {
         fill_directive_ast(&ast, split_result, index);
         return ast;
     }
 
     /* If current line is instruction line */
-    if (ast.lineError[0] == NULL_BYTE && is_instruction(split_result.string[index++], &ast))
+    if (ast.error == PARSE_OK && is_instruction(split_result.string[index++], &ast))
     {
         parse_operands(split_result, index, &ast);
         return ast;
@@ -729,12 +748,12 @@ struct ast get_ast_from_line(char *line, struct MacroContext *macro_table)
 
     /* First Error case */
     ast.ast_type = ast_error;
-    if (ast.lineError[0] != NULL_BYTE)
+    if (ast.error != PARSE_OK)
     {
         return ast;
     }
 
     /* Second Error case */
-    strcpy(ast.lineError, "Invalid directive or instruction");
+    ast.error = PARSE_UNKNOWN_STATEMENT;
     return ast;
 }
@@ -9,8 +9,9 @@
 #include <string.h>
 #include "helpingFunction.h"
 #include <stdlib.h>
+#include "targetDesc.h"
 
-#define ERROR_LINE 200
+#define ERROR_LINE 200 /* Size of the message of a parse error */
 #define SPACES " \t\v\f"
 #define COMMA ","
 #define COMMENT_CHAR ';'
@@ -18,13 +19,13 @@
 #define LABEL_CHAR ':'
 #define MAX_LABEL_SIZE 31
 #define COMMA_CHAR ','
-#define MIN_NUM -16384
-#define MAX_NUM 16383
-#define MIN_NUM_IMMID -2048
-#define MAX_NUM_IMMID 2047
+#define MIN_NUM TARGET_DATA_MIN
+#define MAX_NUM TARGET_DATA_MAX
+#define MIN_NUM_IMMID TARGET_IMMEDIATE_MIN
+#define MAX_NUM_IMMID TARGET_IMMEDIATE_MAX
 #define SPACE_CHAR ' '
 #define SPACE " "
-#define INST_SIZE 16
+#define INST_SIZE TARGET_INSTRUCTION_COUNT
 #define DECIMAL_BASE 10
 #define RESULT_ARR_SIZE 250
 #define DIRECTIVE_DATA ".data"
@@ -33,11 +34,46 @@
 #define DIRECTIVE_ENTRY ".entry"
 #define STRING_CHAR '"'
 #define REGISTER_MIN 0
-#define REGISTER_MAX 7
+#define REGISTER_MAX (TARGET_REGISTERS - 1)
 #define REGISTER_CHAR 'r'
 #define DEFINITION_LABEL 1
 #define NOT_DEFINITION_LABEL 0
 
+/* The errors the parser finds in a line, in the order of their messages in lineParser.c */
+enum parse_error
+{
+    PARSE_OK,                      /* The line is valid */
+    PARSE_LABEL_START,             /* A label starts with something else than a letter */
+    PARSE_LABEL_TOO_LONG,          /* A label is longer than MAX_LABEL_SIZE */
+    PARSE_LABEL_CHARACTERS,        /* A label holds something else than letters and digits */
+    PARSE_LABEL_COLON,             /* A label definition does not end with ':' */
+    PARSE_LABEL_SAVED_WORD,        /* A label definition is a saved word */
+    PARSE_LABEL_MACRO,             /* A label definition is the name of a macro */
+    PARSE_STRING_MISSING,          /* .string without a string */
+    PARSE_STRING_START,            /* The string does not start with '"' */
+    PARSE_STRING_END,              /* The string does not end with '"' */
+    PARSE_DATA_MISSING,            /* .data without numbers */
+    PARSE_DATA_COMMA_EDGE,         /* The numbers of .data start or end with a comma */
+    PARSE_DATA_COMMA_REPEATED,     /* Two commas between numbers of .data */
+    PARSE_DATA_COMMA_MISSING,      /* Two numbers of .data without a comma between them */
+    PARSE_INVALID_NUMBER,          /* A number has characters that are not digits */
+    PARSE_NUMBER_TOO_BIG,          /* A number is above its range */
+    PARSE_NUMBER_TOO_SMALL,        /* A number is below its range */
+    PARSE_INVALID_DIRECTIVE,       /* A word starting with '.' is no directive */
+    PARSE_UNKNOWN_STATEMENT,       /* The line is neither a directive nor an instruction */
+    PARSE_OPERAND_SYNTAX,          /* An operand is of no addressing mode */
+    PARSE_COMMA_AFTER_INSTRUCTION, /* A comma right after the instruction */
+    PARSE_COMMA_AT_END,            /* A comma at the end of the line */
+    PARSE_TWO_OPERANDS,            /* An instruction of two operands has another number of them */
+    PARSE_COMMA_BETWEEN_OPERANDS,  /* No comma between the two operands */
+    PARSE_ONE_OPERAND,             /* An instruction of one operand has another number of them */
+    PARSE_NO_OPERANDS,             /* An instruction without operands has some */
+    PARSE_SOURCE_TYPE,             /* The instruction does not take the mode of its source */
+    PARSE_DEST_TYPE,               /* The instruction does not take the mode of its destination */
+    PARSE_OPERAND_TYPES,           /* The instruction takes neither mode of its operands */
+    PARSE_ERROR_COUNT
+};
+
 /**
  * @brief Structure to represent an instruction.
  */
@@ -56,7 +92,8 @@ extern struct inst inst_table[INST_SIZE];
  */
 struct ast
 {
-    char lineError[ERROR_LINE];     /**< Error message for the line */
+    int error;                      /**< One of enum parse_error, formatted only when printed */
+    int error_inst;                 /**< Instruction the operand type errors are about */
     char labelName[MAX_LABEL_SIZE]; /**< Label name, if applicable */
     enum
     {
@@ -139,7 +176,8 @@ void set_ast_inst_one_operands(struct ast *ast, struct string_split split_result
 int get_operand_type(char *operand, struct ast *ast);
 void update_ast_operands(char *value, struct ast *ast, int operand_type, int operand_index);
 int is_defined_macro(char *label, struct MacroContext *macro_table);
-char *concat_string_split(struct string_split split_result, int const index, int const size);
+char *concat_string_split(struct string_split const *split_result, int const index, int const size, char *concat_string);
 int has_comma_between_operands(const char *string, const char *first_operand, const char *second_operand);
+void format_parse_error(int error, int inst, char *message);
 
 #endif
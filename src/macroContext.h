@@ -1,11 +1,30 @@
 #ifndef MACROCONTEXT_H
 #define MACROCONTEXT_H
 
-/* MacroContext structure holding macro_table and macro counter */
+#include <stddef.h>
+#include "constants.h"
+#include "textBuffer.h"
+
+/* Macro Structure */
+struct Macro
+{
+    char name[MAX_LINE];
+    size_t body_start;  /* Index of the first line of the macro in the macro text */
+    size_t body_length; /* Number of characters of the macro lines in the macro text */
+};
+
+/**
+ * @brief MacroContext structure holding the macro table and the macro bodies.
+ *
+ * The lines of all the macros are stored one after another in macro_text, so
+ * defining a macro does not allocate memory once the table and the text are large enough.
+ */
 struct MacroContext
 {
-    struct Macro **macro_table;
-    int macro_counter;
+    struct Macro *macro_table;     /* The defined macros */
+    int macro_counter;             /* Number of macros in macro_table */
+    int macro_capacity;            /* Number of macros allocated for macro_table */
+    struct text_buffer macro_text; /* The lines of all the macros */
 };
 
 #endif
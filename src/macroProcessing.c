@@ -1,4 +1,8 @@
+#define ALLOC_CATEGORY ALLOC_MACROS /* Allocations counted by TRACK_ALLOCATIONS builds */
 #include "macroProcessing.h"
+#include "assemblerContext.h"
+#include "output.h"
+#include "stats.h"
 
 /**
  * @brief Opens a file with the specified mode.
@@ -22,17 +26,16 @@ FILE *open_file(char *file_name, char *mode)
  * @brief Checks if a macro with the specified name already exists in the macro table.
  *
  * @param macro_name The name of the macro to check for duplicates.
- * @param macro_table The array of pointers to macro structures.
- * @param macro_counter The number of macros in the macro table.
+ * @param macros The macro table.
  *
  * @return 1 if a duplicate macro is found, 0 otherwise.
  */
-int check_duplicate_macro(const char *macro_name, struct Macro **macro_table, const int macro_counter)
+int check_duplicate_macro(const char *macro_name, const struct MacroContext *macros)
 {
     int i;
-    for (i = 0; i < macro_counter; i++)
+    for (i = 0; i < macros->macro_counter; i++)
     {
-        if (macro_table[i] != NULL && strcmp(macro_table[i]->name, macro_name) == 0)
+        if (strcmp(macros->macro_table[i].name, macro_name) == 0)
         {
             return 1;
         }
@@ -41,32 +44,30 @@ int check_duplicate_macro(const char *macro_name, struct Macro **macro_table, co
 }
 
 /**
- * @brief Creates a new macro structure and initializes it based on the provided token.
+ * @brief Initializes a new macro based on the provided token.
  *
  * @param token The token from which to extract the macro name.
+ * @param save_ptr The tokenizer position after the token, used to check for additional data.
  * @param result Pointer to an integer that will be set to indicate the outcome of the macro creation.
- * @param macro_table Array of pointers to existing macro structures.
- * @param macro_counter The number of macros currently in the macro table.
+ * @param macros The macro table, used to check for duplicates. The body of the new macro starts at the end of its text.
+ * @param new_macro The macro structure to initialize.
+ * @param diagnostics The stream errors are written to.
  *
- * @return A pointer to the newly created macro structure, or NULL if the creation fails.
+ * @return A pointer to the new macro, or NULL if the creation fails.
  */
-struct Macro *create_macro(char *token, int *result, struct Macro **macro_table, const int macro_counter)
+struct Macro *create_macro(char *token, char **save_ptr, int *result, struct MacroContext *macros, struct Macro *new_macro, FILE *diagnostics)
 {
-    char *macro_name = NULL;
-    struct Macro *macro_ptr = (struct Macro *)allocateMemory(1, sizeof(struct Macro), CALLOC_ID);
+    char macro_name[MAX_LINE];
 
-    macro_ptr->lines_counter = 0;
-    macro_name = get_macro_name(token);
-    if (macro_name == NULL)
+    if (!get_macro_name(token, save_ptr, macro_name))
     {
-        macro_ptr = NULL;
-        printf("Error: Unable to create macro because of additional data\n");
-        printf("Moving to the next file\n");
+        fprintf(diagnostics, "Error: Unable to create macro because of additional data\n");
+        fprintf(diagnostics, "Moving to the next file\n");
         *result = -1;
         return NULL;
     }
 
-    if (check_duplicate_macro(macro_name, macro_table, macro_counter) == 1)
+    if (check_duplicate_macro(macro_name, macros) == 1)
     {
         *result = -2;
         return NULL;
@@ -78,116 +79,95 @@ struct Macro *create_macro(char *token, int *result, struct Macro **macro_table,
         return NULL;
     }
 
-    macro_ptr->context = (char **)allocateMemory(DEF_MAT_SIZE, sizeof(char *), CALLOC_ID);
-    strcpy(macro_ptr->name, macro_name);
-    if (macro_name != NULL)
-    {
-        free(macro_name);
-    }
+    strcpy(new_macro->name, macro_name);
+    new_macro->body_start = macros->macro_text.length;
+    new_macro->body_length = 0;
 
     *result = 1;
-    return macro_ptr;
+    return new_macro;
 }
 
 /**
  * @brief Updates the context of a macro by adding a new line to it.
  *
+ * The lines of a macro are defined one after another, so the line is appended
+ * to the macro text right after the previous line of the macro.
+ *
  * @param line The line to be added to the macro's context.
  * @param macro_ptr Pointer to the macro structure to be updated.
+ * @param macros The macro table holding the macro text.
  *
  * @return void
  */
-void update_macro_context(char *line, struct Macro **macro_ptr)
+void update_macro_context(char *line, struct Macro **macro_ptr, struct MacroContext *macros)
 {
-    char **temp_ptr = NULL;
+    size_t length;
 
-    if (macro_ptr == NULL)
+    if (macro_ptr == NULL || *macro_ptr == NULL)
         return;
 
-    if ((*macro_ptr)->lines_counter >= DEF_MAT_SIZE)
-    {
-        temp_ptr = (char **)realloc((*macro_ptr)->context, ((*macro_ptr)->lines_counter + 1) * sizeof(char *));
-        if (*temp_ptr == NULL)
-        {
-            *macro_ptr = NULL;
-            failureExit("Unable to allocate memory");
-        }
-        (*macro_ptr)->context = temp_ptr;
-    }
-
-    (*macro_ptr)->context[(*macro_ptr)->lines_counter] = (char *)allocateMemory(MAX_LINE, sizeof(char), CALLOC_ID);
-
     while (isspace(*line))
     {
         line++;
     }
-    strcpy((*macro_ptr)->context[(*macro_ptr)->lines_counter++], line);
+
+    length = strlen(line);
+    append_text(&macros->macro_text, line, length);
+    (*macro_ptr)->body_length += length;
 }
 
 /**
  * @brief Extracts the macro name from a given token.
  *
  * @param token The token from which the macro name is extracted.
+ * @param save_ptr The tokenizer position after the token, used to check for additional data.
+ * @param name The buffer the name is copied to, at least MAX_LINE long.
  *
- * @return char* The extracted macro name or NULL if the token is empty or contains additional data.
+ * @return int 1 if the name was extracted, 0 if the token is empty or there is additional data.
  */
-char *get_macro_name(char *token)
+int get_macro_name(char *token, char **save_ptr, char *name)
 {
-    char *name = (char *)allocateMemory(MAX_LINE, sizeof(char), CALLOC_ID);
-
     /* If current row is empty */
-    if (strcmp(token, "\n") == 0)
+    if (token == NULL || strcmp(token, "\n") == 0)
     {
-        return NULL;
+        return 0;
     }
 
-    strcpy(name, token);
-
-    token = strtok(NULL, " ");
-    if (token != NULL) /* This is not a macro call */
+    if (next_token(NULL, " ", save_ptr) != NULL) /* This is not a macro call */
     {
-        return NULL;
+        return 0;
     }
 
+    strcpy(name, token);
+
     if (name[strlen(name) - 1] == '\n')
     {
         name[strlen(name) - 1] = '\0';
     }
 
-    return name;
+    return 1;
 }
 
 /**
- * @brief Appends a macro to the macro table.
+ * @brief Appends a macro to the macro table, growing the table if needed.
  *
- * @param macro_table Pointer to the macro table.
+ * @param macros The macro table.
  * @param macro_ptr Pointer to the macro to be appended.
- * @param macro_counter Current count of macros in the table.
  */
-void append_macro_table(struct Macro **macro_table, struct Macro *macro_ptr, int macro_counter)
+void append_macro_table(struct MacroContext *macros, struct Macro *macro_ptr)
 {
-    struct Macro *temp_ptr = NULL;
-    struct Macro *temp_macro = NULL;
-
     if (macro_ptr == NULL)
     {
         return;
     }
 
-    if (macro_counter >= MACRO_TABLE_SIZE)
+    if (macros->macro_counter >= macros->macro_capacity)
     {
-        temp_ptr = (struct Macro *)realloc(*macro_table, (macro_counter + 1) * sizeof(struct Macro *));
-        if (temp_ptr == NULL)
-        {
-            failureExit("Unable to allocate memory");
-        }
-        *macro_table = temp_ptr;
+        macros->macro_capacity = (macros->macro_capacity > 0) ? macros->macro_capacity * 2 : MACRO_TABLE_SIZE;
+        macros->macro_table = (struct Macro *)reallocateMemory(macros->macro_table, macros->macro_capacity, sizeof(struct Macro));
     }
 
-    temp_macro = (struct Macro *)allocateMemory(1, sizeof(struct Macro), CALLOC_ID);
-
-    memcpy(temp_macro, macro_ptr, sizeof(struct Macro));
-    macro_table[macro_counter] = temp_macro;
+    macros->macro_table[macros->macro_counter++] = *macro_ptr;
 }
 
 /**
@@ -195,27 +175,28 @@ void append_macro_table(struct Macro **macro_table, struct Macro *macro_ptr, int
  *
  * @param line The line of text to check.
  * @param macro_ptr Pointer to the macro pointer to be updated.
- * @param macro_table Pointer to the macro table.
- * @param macro_counter Current count of macros in the table.
+ * @param new_macro The structure the defined macro is kept in until its end.
+ * @param macros The macro table.
+ * @param diagnostics The stream errors are written to.
  * @return 1 if a macro is defined, -1 if there is additional data, -2 if the macro is duplicated,
  *         -3 if the macro name is a saved word, and 0 otherwise.
  */
-int is_macro_def(char *line, struct Macro **macro_ptr, struct Macro **macro_table, const int macro_counter)
+int is_macro_def(char *line, struct Macro **macro_ptr, struct Macro *new_macro, struct MacroContext *macros, FILE *diagnostics)
 {
     int result;
 
-    char *token = NULL, temp_line[MAX_LINE] = {0};
+    char *token = NULL, *save_ptr = NULL, temp_line[MAX_LINE] = {0};
     if (*macro_ptr != NULL)
     {
         return 0;
     }
 
     strcpy(temp_line, line);
-    token = strtok(temp_line, " ");
-    if (strncmp(token, STARTMACR, strlen(STARTMACR)) == 0)
+    token = next_token(temp_line, " ", &save_ptr);
+    if (token != NULL && strncmp(token, STARTMACR, strlen(STARTMACR)) == 0)
     {
-        token = strtok(NULL, " ");
-        (*macro_ptr) = create_macro(token, &result, macro_table, macro_counter);
+        token = next_token(NULL, " ", &save_ptr);
+        (*macro_ptr) = create_macro(token, &save_ptr, &result, macros, new_macro, diagnostics);
         return result;
     }
     return 0;
@@ -226,16 +207,17 @@ int is_macro_def(char *line, struct Macro **macro_ptr, struct Macro **macro_tabl
  *
  * @param line The line of text to add to the macro body.
  * @param macro_ptr Pointer to the macro being updated.
+ * @param macros The macro table holding the macro text.
  * @return 1 if the line was added successfully, 0 if no macro is being defined.
  */
-int is_macro_body(char *line, struct Macro **macro_ptr)
+int is_macro_body(char *line, struct Macro **macro_ptr, struct MacroContext *macros)
 {
     if (*macro_ptr == NULL)
     {
         return 0;
     }
 
-    update_macro_context(line, macro_ptr);
+    update_macro_context(line, macro_ptr, macros);
     return 1;
 }
 
@@ -243,16 +225,15 @@ int is_macro_body(char *line, struct Macro **macro_ptr)
  * @brief Checks if the given line is a macro call and updates the macro pointer if it is.
  *
  * @param line The line of text to check for a macro call.
- * @param macro_table Pointer to the macro table containing defined macros.
+ * @param macros The macro table containing defined macros.
  * @param macro_ptr Pointer to the macro that matches the call, if found.
- * @param macro_counter Number of macros in the macro table.
  * @return 1 if a macro call was found and the macro pointer was updated, 0 otherwise.
  */
-int is_macro_call(char *line, struct Macro **macro_table, struct Macro **macro_ptr, const int macro_counter)
+int is_macro_call(char *line, struct MacroContext *macros, struct Macro **macro_ptr)
 {
-    char *token = NULL;
+    char *token = NULL, *save_ptr = NULL;
     int i = 0;
-    char *macro_name = NULL;
+    char macro_name[MAX_LINE];
     char temp_line[MAX_LINE] = {0};
 
     if (*macro_ptr != NULL)
@@ -261,21 +242,19 @@ int is_macro_call(char *line, struct Macro **macro_table, struct Macro **macro_p
     }
 
     strcpy(temp_line, line);
-    token = strtok(temp_line, " ");
-
-    macro_name = get_macro_name(token);
+    token = next_token(temp_line, " ", &save_ptr);
 
-    if (macro_name == NULL)
+    if (!get_macro_name(token, &save_ptr, macro_name))
     {
         return 0;
     }
 
     /*need to find macro name in macro table*/
-    for (i = 0; i < macro_counter; i++)
+    for (i = 0; i < macros->macro_counter; i++)
     {
-        if (strcmp(macro_table[i]->name, macro_name) == 0)
+        if (strcmp(macros->macro_table[i].name, macro_name) == 0)
         {
-            *macro_ptr = macro_table[i];
+            *macro_ptr = &macros->macro_table[i];
             return 1;
         }
     }
@@ -288,17 +267,22 @@ int is_macro_call(char *line, struct Macro **macro_table, struct Macro **macro_p
  *
  * @param line A pointer to the line to be checked.
  * @param macro_ptr A pointer to a pointer to a `Macro` structure (unused).
+ * @param diagnostics The stream errors are written to.
  *
  * @return 1 if the end-of-macro directive is correctly defined, 0 otherwise.
  */
-int is_macro_end(char *line, struct Macro **macro_ptr)
+int is_macro_end(char *line, struct Macro **macro_ptr, FILE *diagnostics)
 {
-    char *token = NULL;
+    char *token = NULL, *save_ptr = NULL;
     char temp_line[MAX_LINE] = {0};
 
     strcpy(temp_line, line);
 
-    token = strtok(temp_line, " ");
+    token = next_token(temp_line, " ", &save_ptr);
+    if (token == NULL)
+    {
+        return 0;
+    }
 
     if (token[strlen(token) - 1] == '\n')
     {
@@ -307,10 +291,10 @@ int is_macro_end(char *line, struct Macro **macro_ptr)
 
     if (strncmp(token, ENDMACR, strlen(ENDMACR)) == 0)
     {
-        token = strtok(NULL, " ");
+        token = next_token(NULL, " ", &save_ptr);
         if (token != NULL)
         {
-            printf("Error: Macro end isn't defined well!\n");
+            fprintf(diagnostics, "Error: Macro end isn't defined well!\n");
             return 0;
         }
 
@@ -324,9 +308,10 @@ int is_macro_end(char *line, struct Macro **macro_ptr)
  * @brief Determines the type of a line based on macro definitions and usage.
  *
  * @param line A pointer to the line to be checked.
- * @param macro_table A pointer to a pointer to a `Macro` table.
+ * @param macros The macro table.
  * @param macro_ptr A pointer to a pointer to a `Macro` structure.
- * @param macro_counter The count of macros currently defined.
+ * @param new_macro The structure a macro is kept in while it is being defined.
+ * @param diagnostics The stream errors are written to.
  *
  * @return An integer representing the type of the line:
  *         - `MACRO_DEF` for macro definitions
@@ -336,22 +321,22 @@ int is_macro_end(char *line, struct Macro **macro_ptr)
  *         - `-1`, `-2`, or `-3` for specific error conditions
  *         - `REGULAR_LINE` for regular lines not related to macros.
  */
-int determine_line_type(char *line, struct Macro **macro_table, struct Macro **macro_ptr, const int macro_counter)
+int determine_line_type(char *line, struct MacroContext *macros, struct Macro **macro_ptr, struct Macro *new_macro, FILE *diagnostics)
 {
     int def_result, body_result, call_result, end_result;
-    if ((def_result = is_macro_def(line, macro_ptr, macro_table, macro_counter)) == 1)
+    if ((def_result = is_macro_def(line, macro_ptr, new_macro, macros, diagnostics)) == 1)
     {
         return MACRO_DEF;
     }
-    else if ((end_result = is_macro_end(line, macro_ptr)) == 1)
+    else if ((end_result = is_macro_end(line, macro_ptr, diagnostics)) == 1)
     {
         return MACRO_END;
     }
-    else if ((body_result = is_macro_body(line, macro_ptr)) == 1)
+    else if ((body_result = is_macro_body(line, macro_ptr, macros)) == 1)
     {
         return MACRO_BODY;
     }
-    else if ((call_result = is_macro_call(line, macro_table, macro_ptr, macro_counter)) == 1)
+    else if ((call_result = is_macro_call(line, macros, macro_ptr)) == 1)
     {
         return MACRO_CALL;
     }
@@ -374,184 +359,274 @@ int determine_line_type(char *line, struct Macro **macro_table, struct Macro **m
 }
 
 /**
- * @brief Processes an assembly file and fills a macro file based on macro definitions and calls.
+ * @brief Counts the lines of a text.
  *
- * @param am_file A pointer to the file where the processed macro content is written.
- * @param as_file A pointer to the file containing the macro definitions and calls.
- * @param result A pointer to an integer where the function stores the result status:
+ * @param text The text.
+ * @param length The number of characters in text.
+ * @return long The number of new lines in text.
+ */
+static long count_lines(const char *text, size_t length)
+{
+    long lines = 0;
+    size_t i;
+
+    for (i = 0; i < length; i++)
+    {
+        lines += text[i] == '\n';
+    }
+    return lines;
+}
+
+/**
+ * @brief Expands the macros of an assembly source into the text of the macro file.
+ *
+ * Regular lines are appended straight from the source, without an intermediate copy.
+ *
+ * @param am_text The buffer the expanded text is appended to.
+ * @param source_lines The lines of the assembly source containing the macro definitions and calls.
+ * @param macros The macro table, filled with the macros defined in the source.
+ * @param diagnostics The stream errors are written to.
+ *
+ * @return int The result status:
  *               - `0` for success
  *               - `-1`, `-2`, or `-3` for specific error conditions.
- * @param macro_counter A pointer to an integer where the function stores the count of macros.
- *
- * @return A `MacroContext` structure containing:
- *         - `macro_table`: A table of macros processed.
- *         - `macro_counter`: The count of macros processed.
  */
-struct MacroContext fill_am_file(FILE *am_file, FILE *as_file, int *result, int *macro_counter)
+int fill_am_text(struct text_buffer *am_text, const struct line_index *source_lines, struct MacroContext *macros, FILE *diagnostics)
 {
     struct Macro *macro_ptr = NULL;
-    struct MacroContext macro_context = {NULL, 0};
+    struct Macro new_macro; /* The macro being defined */
+    const struct line_view *view;
     char line[MAX_LINE] = {0};
-    int mcr_counter = 0, i;
-    struct Macro **macro_table = (struct Macro **)allocateMemory(MACRO_TABLE_SIZE, sizeof(struct Macro *), CALLOC_ID);
+    size_t offset, count;
+    int result = 0;
+    int i;
 
-    while (fgets(line, MAX_LINE, as_file) != NULL)
+    for (i = 0; i < source_lines->lines_counter; i++)
     {
-        switch (determine_line_type(line, macro_table, &macro_ptr, mcr_counter))
+        view = &source_lines->lines[i];
+
+        /* A line longer than the line buffer is handled in parts, the first pass reports it */
+        for (offset = 0; offset < view->length; offset += count)
         {
-        case MACRO_DEF:
-            break;
-        case MACRO_CALL:
-            for (i = 0; i < macro_ptr->lines_counter; i++)
+            count = view->length - offset;
+            if (count > MAX_LINE - 1)
             {
-                fputs(macro_ptr->context[i], am_file);
+                count = MAX_LINE - 1;
             }
-            macro_ptr = NULL;
-            break;
-        case MACRO_END:
-            append_macro_table(macro_table, macro_ptr, mcr_counter);
-            mcr_counter++;
-            macro_ptr = NULL;
-            break;
-        case REGULAR_LINE:
-            fputs(line, am_file);
-            break;
-        case MACRO_BODY:
-            break;
-        case -1:
-            *result = -1;
-            break;
-        case -2:
-            *result = -2;
-            break;
-        case -3:
-            *result = -3;
-            break;
-        }
+            memcpy(line, view->text + offset, count);
+            line[count] = '\0';
 
-        if (*result == -1 || *result == -2 || *result == -3)
-        {
-            mcr_counter--;
-            *macro_counter = mcr_counter;
-            return macro_context;
-        }
+            switch (determine_line_type(line, macros, &macro_ptr, &new_macro, diagnostics))
+            {
+            case MACRO_DEF:
+                break;
+            case MACRO_CALL:
+                append_text(am_text, macros->macro_text.text + macro_ptr->body_start, macro_ptr->body_length);
+                COUNT_STAT(lines_expanded, count_lines(macros->macro_text.text + macro_ptr->body_start, macro_ptr->body_length));
+                macro_ptr = NULL;
+                break;
+            case MACRO_END:
+                append_macro_table(macros, macro_ptr);
+                macro_ptr = NULL;
+                break;
+            case REGULAR_LINE:
+                append_text(am_text, view->text + offset, count);
+                break;
+            case MACRO_BODY:
+                break;
+            case -1:
+                result = -1;
+                break;
+            case -2:
+                result = -2;
+                break;
+            case -3:
+                result = -3;
+                break;
+            }
 
-        if (line[0] != '\0')
-        {
-            memset(line, 0, MAX_LINE); /* initalize line variable */
+            if (result == -1 || result == -2 || result == -3)
+            {
+                return result;
+            }
         }
     }
 
-    if (macro_ptr != NULL)
+    return 0;
+}
+
+/**
+ * @brief Prints the error a failed pre-processing ended with.
+ *
+ * @param result The result returned by fill_am_text.
+ * @param diagnostics The stream the error is written to.
+ */
+void print_macro_error(int result, FILE *diagnostics)
+{
+    if (result == -1)
+    {
+        fprintf(diagnostics, "Error: Unable to create macro because of additional data\n");
+    }
+    else if (result == -2)
     {
-        free(macro_ptr);
+        fprintf(diagnostics, "Error: Duplicate macro name\n");
     }
+    else if (result == -3)
+    {
+        fprintf(diagnostics, "Error: Macro call can't be saved word\n");
+    }
+}
 
-    *result = 0;
-    macro_context.macro_table = macro_table;
-    macro_context.macro_counter = mcr_counter;
+/**
+ * @brief Initializes an empty macro table.
+ *
+ * @param macros The macro table to initialize.
+ */
+void init_macro_ctx_table(struct MacroContext *macros)
+{
+    macros->macro_table = NULL;
+    macros->macro_counter = 0;
+    macros->macro_capacity = 0;
+    init_text_buffer(&macros->macro_text);
+}
 
-    return macro_context;
+/**
+ * @brief Empties the macro table while keeping its memory for the next file.
+ *
+ * @param macros The macro table to empty.
+ */
+void free_macro_ctx_table(struct MacroContext *macros)
+{
+    macros->macro_counter = 0;
+    clear_text_buffer(&macros->macro_text);
 }
 
 /**
  * @brief Frees the memory allocated for the macro table and its contents.
  *
- * @param macro_table A pointer to a `MacroContext` structure containing the macro table to be freed.
+ * @param macros The macro table to release.
  */
-void free_macro_ctx_table(struct MacroContext *macro_table)
+void release_macro_ctx_table(struct MacroContext *macros)
 {
-    int i;
-    for (i = 0; i < macro_table->macro_counter; i++)
-    {
-        free_macro_table(macro_table->macro_table[i]);
-    }
-    macro_table->macro_table = NULL;
-    macro_table->macro_counter = 0;
-    free(macro_table->macro_table);
+    free(macros->macro_table);
+    release_text_buffer(&macros->macro_text);
+    init_macro_ctx_table(macros);
 }
 
 /**
- * @brief Frees the memory allocated for the macro table and its contents.
+ * @brief Gives the context access to the source of an assembly file.
+ *
+ * Large sources are mapped in memory rather than read (see map_text_file). With
+ * a pipeline, the source may already have been read by its reader thread.
  *
- * @param macro_table A pointer to a `Macro` structure containing the macro table to be freed.
+ * @param ctx The context of the file. Its source is set to the content of the file.
+ * @param file_name The name of the file, without the .as extension.
  */
-void free_macro_table(struct Macro *macro_table)
+void read_source_file(struct assembler_context *ctx, char *file_name)
 {
-    int i;
-    for (i = 0; i < macro_table->lines_counter; i++)
+    char *asFileName;
+
+    /* Copy read file name with ending */
+    asFileName = (char *)allocateMemory(strlen(file_name) + 4, sizeof(char), CALLOC_ID);
+    strcpy(asFileName, file_name);
+    strcat(asFileName, ".as");
+
+    unmap_text(&ctx->source);
+    if (ctx->pipeline != NULL && take_prefetched_source(ctx->pipeline, ctx->file_index, &ctx->source_text))
     {
-        free(macro_table->context[i]);
+        use_text_buffer(&ctx->source, &ctx->source_text);
     }
-    macro_table->context = NULL;
-    free(macro_table->context);
-    macro_table->lines_counter = 0;
-    memset(macro_table->name, 0, MAX_LINE);
-    free(macro_table);
+    else if (!map_text_file(&ctx->source, asFileName, &ctx->source_text))
+    {
+        /* The outputs of the previous files are written before leaving */
+        if (ctx->pipeline != NULL)
+        {
+            flush_io_pipeline(ctx->pipeline);
+        }
+        failureExit("Unable to open / create file");
+    }
+
+    free(asFileName);
+}
+
+/**
+ * @brief Expands the macros of a source into the context's am_text.
+ *
+ * @param ctx The context of the file. Its macro table is filled with the macros defined in the source.
+ * @param source The assembly source. It must stay in place until the expansion is done.
+ * @param length The number of characters in the source.
+ * @return int The result of fill_am_text.
+ */
+int expand_macros(struct assembler_context *ctx, const char *source, size_t length)
+{
+    build_line_index(&ctx->source_lines, source, length);
+    COUNT_STAT(lines_read, ctx->source_lines.lines_counter);
+    clear_text_buffer(&ctx->am_text);
+    return fill_am_text(&ctx->am_text, &ctx->source_lines, &ctx->macro_table, ctx->diagnostics);
 }
 
-char *macro_processing(char *file_name, struct MacroContext *macro_table)
+/**
+ * @brief Pre-processes an assembly file: expands its macros into a new .am file.
+ *
+ * The source, read by read_source_file, is expanded into the context's am_text,
+ * which the passes read. The .am file is written from it.
+ *
+ * @param ctx The context of the file, holding its source. Its macro table is filled with the macros defined in the file.
+ * @param file_name The name of the file, without the .as extension.
+ *
+ * @return int 1 if the pre-processing succeeded, otherwise 0.
+ */
+int macro_processing(struct assembler_context *ctx, char *file_name)
 {
-    int result, macro_counter = 0;
+    int result;
 
-    /* Files define */
-    FILE *as_file;
+    /* File define */
     FILE *am_file;
+    struct output_file am_output;
 
     /* File name define char */
-    char *asFileName;
     char *amFileName;
 
     /* Allocate data memory */
-    asFileName = (char *)allocateMemory(MAX_LINE, sizeof(char), CALLOC_ID);
-    amFileName = (char *)allocateMemory(MAX_LINE, sizeof(char), CALLOC_ID);
-
-    /* Copy read file name with ending */
-    strcpy(asFileName, file_name);
-    strcat(asFileName, ".as");
+    amFileName = (char *)allocateMemory(strlen(file_name) + 4, sizeof(char), CALLOC_ID);
 
     /* Copy write file name with ending */
     strcpy(amFileName, file_name);
     strcat(amFileName, ".am");
 
-    /* Read & Create file */
-    as_file = open_file(asFileName, "r");
-    am_file = open_file(amFileName, "w");
+    /* Create file */
+    am_file = open_output_file(&am_output, amFileName, 0, ctx->pipeline);
+    if (am_file == NULL)
+    {
+        failureExit("Unable to open / create file");
+    }
+
+    /* Expand the macros of the source in memory */
+    result = expand_macros(ctx, ctx->source.text, ctx->source.length);
 
-    /* Creating new am file and getting macro table */
-    *macro_table = fill_am_file(am_file, as_file, &result, &macro_counter);
+    /* Creating new am file */
+    if (ctx->am_text.length > 0)
+    {
+        fwrite(ctx->am_text.text, 1, ctx->am_text.length, am_file);
+        COUNT_STAT(bytes_written[STATS_OUTPUT_AM], (long)ctx->am_text.length);
+    }
 
     /* Check for error - delete file */
     if (result == -1 || result == -2 || result == -3)
     {
-        if (remove(amFileName) == 0)
-        {
-            printf("File deleted successfully\n");
-        }
-        if (result == -1)
-        {
-            printf("Error: Unable to create macro because of additional data\n");
-        }
-        else if (result == -2)
+        if (discard_output_file(&am_output))
         {
-            printf("Error: Duplicate macro name\n");
+            fprintf(ctx->diagnostics, "File deleted successfully\n");
         }
-        else if (result == -3)
-        {
-            printf("Error: Macro call can't be saved word\n");
-        }
-        amFileName = NULL;
+        print_macro_error(result, ctx->diagnostics);
+    }
+    else
+    {
+        close_output_file(&am_output);
     }
-
-    /* Close files */
-    if (as_file != NULL)
-        fclose(as_file);
-    if (am_file != NULL)
-        fclose(am_file);
 
     /* Free memory */
-    free(asFileName);
+    free(amFileName);
 
-    /* Return file name */
-    return amFileName;
+    return result == 0;
 }
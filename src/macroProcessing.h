@@ -7,21 +7,13 @@
 #include "constants.h"
 #include "helpingFunction.h"
 #include "macroContext.h"
+#include "lineIndex.h"
 
-#define DEF_MAT_SIZE 15
-#define MACRO_TABLE_SIZE 200
+#define MACRO_TABLE_SIZE 16 /* Initial capacity of the macro table */
 #define SIZE_EOF 3
 #define STARTMACR "macr"
 #define ENDMACR "endmacr"
 
-/* Macro Structure */
-struct Macro
-{
-    char name[MAX_LINE];
-    char **context;
-    int lines_counter;
-};
-
 /* Macro State Enumeration */
 enum MacroState
 {
@@ -32,21 +24,27 @@ enum MacroState
     MACRO_BODY
 };
 
+struct assembler_context; /* Forward declaration of struct assembler_context */
+
 /* Functions Prototype */
 FILE *open_file(char *file_name, char *mode);
-struct MacroContext fill_am_file(FILE *am_file, FILE *as_file, int *result, int *macro_counter);
-char *macro_processing(char *file_name, struct MacroContext *macro_table);
-int determine_line_type(char *line, struct Macro **macro_table, struct Macro **macro_ptr, const int macro_counter);
-int is_macro_def(char *line, struct Macro **macro_ptr, struct Macro **macro_table, const int macro_counter);
-int is_macro_body(char *line, struct Macro **macro_ptr);
-int is_macro_call(char *line, struct Macro **macro_table, struct Macro **macro_ptr, const int macro_counter);
-int is_macro_end(char *line, struct Macro **macro_ptr);
-struct Macro *create_macro(char *token, int *result, struct Macro **macro_table, const int macro_counter);
-char *get_macro_name(char *token);
-void update_macro_context(char *line, struct Macro **macro_ptr);
-void free_macro_ctx_table(struct MacroContext *macro_table);
-void free_macro_table(struct Macro *macro_table);
-void append_macro_table(struct Macro **macro_table, struct Macro *macro_ptr, int macro_counter);
-int check_duplicate_macro(const char *macro_name, struct Macro **macro_table, const int macro_counter);
+int fill_am_text(struct text_buffer *am_text, const struct line_index *source_lines, struct MacroContext *macros, FILE *diagnostics);
+void print_macro_error(int result, FILE *diagnostics);
+void read_source_file(struct assembler_context *ctx, char *file_name);
+int expand_macros(struct assembler_context *ctx, const char *source, size_t length);
+int macro_processing(struct assembler_context *ctx, char *file_name);
+int determine_line_type(char *line, struct MacroContext *macros, struct Macro **macro_ptr, struct Macro *new_macro, FILE *diagnostics);
+int is_macro_def(char *line, struct Macro **macro_ptr, struct Macro *new_macro, struct MacroContext *macros, FILE *diagnostics);
+int is_macro_body(char *line, struct Macro **macro_ptr, struct MacroContext *macros);
+int is_macro_call(char *line, struct MacroContext *macros, struct Macro **macro_ptr);
+int is_macro_end(char *line, struct Macro **macro_ptr, FILE *diagnostics);
+struct Macro *create_macro(char *token, char **save_ptr, int *result, struct MacroContext *macros, struct Macro *new_macro, FILE *diagnostics);
+int get_macro_name(char *token, char **save_ptr, char *name);
+void update_macro_context(char *line, struct Macro **macro_ptr, struct MacroContext *macros);
+void init_macro_ctx_table(struct MacroContext *macros);
+void free_macro_ctx_table(struct MacroContext *macros);
+void release_macro_ctx_table(struct MacroContext *macros);
+void append_macro_table(struct MacroContext *macros, struct Macro *macro_ptr);
+int check_duplicate_macro(const char *macro_name, const struct MacroContext *macros);
 
 #endif
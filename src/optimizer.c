@@ -0,0 +1,832 @@
+#define ALLOC_CATEGORY ALLOC_PARSER /* Allocations counted by TRACK_ALLOCATIONS builds */
+#include <stdio.h>
+#include "optimizer.h"
+#include "assemblerContext.h"
+
+/*
+ * The optimizations run between the passes. The first pass has collected the symbols
+ * and the addresses of the unchanged code, the optimizations remove or rewrite lines of
+ * the line index and move the symbols to the addresses of the smaller code, and the
+ * second pass encodes the lines that are left.
+ */
+
+#define NO_INSTRUCTION -1 /* In by_address: no instruction starts at the address */
+#define POOL_MIN_SIZE 64  /* Smallest table of --pool-constants */
+#define HASH_BASIS 2166136261UL /* FNV-1a, over the words of the data */
+#define HASH_PRIME 16777619UL
+
+/**
+ * @brief Initializes an empty optimizer.
+ *
+ * @param optimizer Pointer to the optimizer to initialize.
+ */
+void init_optimizer(struct optimizer *optimizer)
+{
+    optimizer->code = NULL;
+    optimizer->code_counter = 0;
+    optimizer->code_capacity = 0;
+    optimizer->by_address = NULL;
+    optimizer->addresses_capacity = 0;
+    optimizer->data = NULL;
+    optimizer->data_counter = 0;
+    optimizer->data_capacity = 0;
+    optimizer->worklist = NULL;
+    optimizer->worklist_capacity = 0;
+    optimizer->blocks = NULL;
+    optimizer->blocks_capacity = 0;
+    optimizer->pool = NULL;
+    optimizer->pool_capacity = 0;
+    init_text_buffer(&optimizer->text);
+}
+
+/**
+ * @brief Empties an optimizer while keeping its memory for the next file.
+ *
+ * @param optimizer Pointer to the optimizer to clear.
+ */
+void clear_optimizer(struct optimizer *optimizer)
+{
+    optimizer->code_counter = 0;
+    optimizer->data_counter = 0;
+    clear_text_buffer(&optimizer->text);
+}
+
+/**
+ * @brief Releases the memory held by an optimizer.
+ *
+ * @param optimizer Pointer to the optimizer to release.
+ */
+void release_optimizer(struct optimizer *optimizer)
+{
+    free(optimizer->code);
+    free(optimizer->by_address);
+    free(optimizer->data);
+    free(optimizer->worklist);
+    free(optimizer->blocks);
+    free(optimizer->pool);
+    release_text_buffer(&optimizer->text);
+    init_optimizer(optimizer);
+}
+
+/**
+ * @brief Collects the instructions and the data lines of the line index, with the addresses of the first pass.
+ *
+ * @param ctx The context, after a first pass without errors.
+ * @param optimizer The optimizer the lines are collected into.
+ */
+static void collect_code(struct assembler_context *ctx, struct optimizer *optimizer)
+{
+    char read_line[MAX_BUFFER_LENGTH];
+    struct ast answer;
+    struct code_line *code;
+    struct data_line *data;
+    int line_index, address = TARGET_LOAD_BASE, offset = 0, i;
+
+    for (line_index = 0; line_index < ctx->am_lines.lines_counter; line_index++)
+    {
+        copy_line(&ctx->am_lines.lines[line_index], read_line, MAX_BUFFER_LENGTH);
+        answer = get_ast_from_line(read_line, NULL);
+        if (answer.ast_type == ast_dir &&
+            (answer.ast_options.dir.dir_type == ast_data || answer.ast_options.dir.dir_type == ast_string))
+        {
+            if (optimizer->data_counter == optimizer->data_capacity)
+            {
+                optimizer->data_capacity = (optimizer->data_capacity > 0) ? optimizer->data_capacity * 2 : LINE_INDEX_INITIAL_SIZE;
+                optimizer->data = (struct data_line *)reallocateMemory(optimizer->data, optimizer->data_capacity, sizeof(struct data_line));
+            }
+            data = &optimizer->data[optimizer->data_counter++];
+            data->line = line_index;
+            data->offset = offset;
+            data->moved_to = offset;
+            data->words = answer.ast_options.dir.dir_options.data_size;
+            data->removed = 0;
+            data->live = 0;
+            data->written = 0;
+            data->block_words = 0;
+            data->pooled_in = -1;
+            data->pooled_at = 0;
+            strcpy(data->label, answer.labelName);
+            offset += data->words;
+            continue;
+        }
+        if (answer.ast_type != ast_inst)
+        {
+            continue;
+        }
+
+        if (optimizer->code_counter == optimizer->code_capacity)
+        {
+            optimizer->code_capacity = (optimizer->code_capacity > 0) ? optimizer->code_capacity * 2 : LINE_INDEX_INITIAL_SIZE;
+            optimizer->code = (struct code_line *)reallocateMemory(optimizer->code, optimizer->code_capacity, sizeof(struct code_line));
+        }
+        code = &optimizer->code[optimizer->code_counter++];
+        code->line = line_index;
+        code->address = address;
+        code->words = 1;
+        code->removed = 0;
+        code->rewritten = 0;
+        code->live = 0;
+        code->opcode = answer.ast_options.inst.inst_type;
+        strcpy(code->label, answer.labelName);
+        for (i = 0; i < 2; i++)
+        {
+            code->modes[i] = answer.ast_options.inst.operands[i].operand_type;
+            code->values[i] = 0;
+            code->operands[i][0] = NULL_BYTE;
+            if (code->modes[i] == ast_label)
+            {
+                strcpy(code->operands[i], answer.ast_options.inst.operands[i].operand_option.label);
+            }
+            else if (code->modes[i] == ast_immidiate)
+            {
+                code->values[i] = answer.ast_options.inst.operands[i].operand_option.immed;
+            }
+            else if (code->modes[i] != ast_none)
+            {
+                code->values[i] = answer.ast_options.inst.operands[i].operand_option.reg;
+            }
+            if (code->modes[i] != ast_none)
+            {
+                code->words++;
+            }
+        }
+
+        /* Two register operands share a word, as in the first pass */
+        if ((code->modes[0] == ast_register_direct || code->modes[0] == ast_register_address) &&
+            (code->modes[1] == ast_register_direct || code->modes[1] == ast_register_address))
+        {
+            code->words--;
+        }
+        address += code->words;
+    }
+
+    /* Map the addresses to the instructions starting there */
+    if (optimizer->addresses_capacity < address - TARGET_LOAD_BASE)
+    {
+        optimizer->addresses_capacity = address - TARGET_LOAD_BASE;
+        optimizer->by_address = (int *)reallocateMemory(optimizer->by_address, optimizer->addresses_capacity, sizeof(int));
+    }
+    for (i = 0; i < address - TARGET_LOAD_BASE; i++)
+    {
+        optimizer->by_address[i] = NO_INSTRUCTION;
+    }
+    for (i = 0; i < optimizer->code_counter; i++)
+    {
+        optimizer->by_address[optimizer->code[i].address - TARGET_LOAD_BASE] = i;
+    }
+}
+
+/**
+ * @brief Returns the first instruction at or after an index that was not removed.
+ *
+ * @return int The index of the instruction, or code_counter when all the following ones were removed.
+ */
+static int next_kept(const struct optimizer *optimizer, int index)
+{
+    while (index < optimizer->code_counter && optimizer->code[index].removed)
+    {
+        index++;
+    }
+    return index;
+}
+
+/**
+ * @brief Finds the instruction a label operand leads to.
+ *
+ * Only labels of the code of the file are followed: externals, data and registers are left alone.
+ *
+ * @return int The index of the first instruction kept at or after the label, code_counter when none
+ *             is left, or NO_INSTRUCTION if the operand is not a label of the code.
+ */
+static int label_target(struct assembler_context *ctx, const struct optimizer *optimizer, const char *label)
+{
+    table_ptr symbol = symbol_search(ctx->symbol_table, label);
+    int offset;
+
+    if (symbol == NULL || (symbol->symbol_type != code_symbol && symbol->symbol_type != entry_code))
+    {
+        return NO_INSTRUCTION;
+    }
+    offset = symbol->symbol_address - TARGET_LOAD_BASE;
+    if (offset < 0 || offset >= optimizer->addresses_capacity || optimizer->by_address[offset] == NO_INSTRUCTION)
+    {
+        return NO_INSTRUCTION;
+    }
+    return next_kept(optimizer, optimizer->by_address[offset]);
+}
+
+/**
+ * @brief Tells whether an instruction does nothing: mov X, X, or add or sub of #0.
+ */
+static int is_no_op(const struct code_line *code)
+{
+    if (code->opcode == ast_move && code->modes[0] == code->modes[1] &&
+        (code->modes[0] == ast_register_direct || code->modes[0] == ast_register_address))
+    {
+        return code->values[0] == code->values[1];
+    }
+    return (code->opcode == ast_add || code->opcode == ast_sub) && code->modes[0] == ast_immidiate && code->values[0] == 0;
+}
+
+/**
+ * @brief Tells whether an instruction is a jump to a label: jmp, bne or jsr.
+ */
+static int is_label_jump(const struct code_line *code)
+{
+    return (code->opcode == ast_jmp || code->opcode == ast_bne || code->opcode == ast_jsr) && code->modes[0] == ast_label;
+}
+
+/**
+ * @brief Removes the no-op instructions and the jumps to the next instruction, and retargets
+ * the jumps to a jmp to its own target, until nothing changes.
+ *
+ * @param ctx The context, holding the symbols of the first pass.
+ * @param optimizer The optimizer holding the instructions.
+ */
+static void run_peephole(struct assembler_context *ctx, struct optimizer *optimizer)
+{
+    char label[MAX_LABEL_SIZE];
+    struct code_line *code, *hop;
+    int changed = 1, i, target, next, steps;
+
+    while (changed)
+    {
+        changed = 0;
+        for (i = 0; i < optimizer->code_counter; i++)
+        {
+            code = &optimizer->code[i];
+            if (code->removed)
+            {
+                continue;
+            }
+            if (is_no_op(code))
+            {
+                code->removed = 1;
+                changed = 1;
+                continue;
+            }
+            if (!is_label_jump(code) || (target = label_target(ctx, optimizer, code->operands[0])) == NO_INSTRUCTION)
+            {
+                continue;
+            }
+
+            /* Follow the chain of jmp, a chain longer than the code is a cycle and is left alone */
+            strcpy(label, code->operands[0]);
+            for (steps = 0; target < optimizer->code_counter; steps++)
+            {
+                hop = &optimizer->code[target];
+                if (hop->opcode != ast_jmp || hop->modes[0] != ast_label || hop == code ||
+                    (next = label_target(ctx, optimizer, hop->operands[0])) == NO_INSTRUCTION || next == target)
+                {
+                    break;
+                }
+                if (steps == optimizer->code_counter)
+                {
+                    strcpy(label, code->operands[0]);
+                    target = label_target(ctx, optimizer, label);
+                    break;
+                }
+                strcpy(label, hop->operands[0]);
+                target = next;
+            }
+            if (strcmp(label, code->operands[0]) != 0)
+            {
+                strcpy(code->operands[0], label);
+                code->rewritten = 1;
+                changed = 1;
+            }
+
+            /* A jump to where execution goes anyway, jsr still pushes a return address */
+            if (code->opcode != ast_jsr && target == next_kept(optimizer, i + 1))
+            {
+                code->removed = 1;
+                changed = 1;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Finds the data line starting at an index of the data image.
+ *
+ * @return int The index of the data line, or NO_INSTRUCTION if no line starts there.
+ */
+static int find_data_line(const struct optimizer *optimizer, int offset)
+{
+    int low = 0, high = optimizer->data_counter - 1, middle;
+
+    /* The lines are in the order of their offsets */
+    while (low <= high)
+    {
+        middle = (low + high) / 2;
+        if (optimizer->data[middle].offset < offset)
+        {
+            low = middle + 1;
+        }
+        else if (optimizer->data[middle].offset > offset)
+        {
+            high = middle - 1;
+        }
+        else
+        {
+            return middle;
+        }
+    }
+    return NO_INSTRUCTION;
+}
+
+/**
+ * @brief Marks an instruction reachable, queuing it so its successors are marked too.
+ *
+ * @param pending The number of instructions in the worklist.
+ */
+static void mark_reachable(struct optimizer *optimizer, int index, int *pending)
+{
+    if (index >= 0 && index < optimizer->code_counter && !optimizer->code[index].live)
+    {
+        optimizer->code[index].live = 1;
+        optimizer->worklist[(*pending)++] = index;
+    }
+}
+
+/**
+ * @brief Marks the instruction or the data line a symbol of the file labels.
+ *
+ * @param pending The number of instructions in the worklist.
+ */
+static void mark_symbol(struct assembler_context *ctx, struct optimizer *optimizer, table_ptr symbol, int *pending)
+{
+    int data_start = ctx->machine_code.IC ? ctx->machine_code.IC : TARGET_LOAD_BASE, offset, index;
+
+    if (symbol == NULL)
+    {
+        return;
+    }
+    if (symbol->symbol_type == code_symbol || symbol->symbol_type == entry_code)
+    {
+        offset = symbol->symbol_address - TARGET_LOAD_BASE;
+        if (offset >= 0 && offset < optimizer->addresses_capacity)
+        {
+            mark_reachable(optimizer, optimizer->by_address[offset], pending);
+        }
+    }
+    else if (symbol->symbol_type == data_symbol || symbol->symbol_type == entry_data)
+    {
+        if ((index = find_data_line(optimizer, symbol->symbol_address - data_start)) != NO_INSTRUCTION)
+        {
+            optimizer->data[index].live = 1;
+        }
+    }
+}
+
+/**
+ * @brief Removes the instructions no path of the program reaches and the data no kept instruction uses.
+ *
+ * The program starts at its first instruction and the entries are used by other files. From
+ * there, an instruction reaches the labels of its operands and, unless it is jmp, rts or stop,
+ * the instruction after it. A data line without a label continues the table of the label before it.
+ *
+ * @param ctx The context, holding the symbols of the first pass.
+ * @param optimizer The optimizer holding the instructions and the data lines.
+ */
+static void collect_garbage(struct assembler_context *ctx, struct optimizer *optimizer)
+{
+    struct code_line *code;
+    table_ptr symbol;
+    int pending = 0, live = 1, i;
+
+    if (optimizer->worklist_capacity < optimizer->code_counter)
+    {
+        optimizer->worklist_capacity = optimizer->code_counter;
+        optimizer->worklist = (int *)reallocateMemory(optimizer->worklist, optimizer->worklist_capacity, sizeof(int));
+    }
+
+    mark_reachable(optimizer, 0, &pending);
+    for (symbol = ctx->symbol_table; symbol != NULL; symbol = symbol->next)
+    {
+        if (symbol->symbol_type == entry_code || symbol->symbol_type == entry_data)
+        {
+            mark_symbol(ctx, optimizer, symbol, &pending);
+        }
+    }
+
+    /* Every instruction is queued once, when it is marked */
+    while (pending > 0)
+    {
+        code = &optimizer->code[optimizer->worklist[--pending]];
+        if (!code->removed)
+        {
+            for (i = 0; i < 2; i++)
+            {
+                if (code->modes[i] == ast_label)
+                {
+                    mark_symbol(ctx, optimizer, symbol_search(ctx->symbol_table, code->operands[i]), &pending);
+                }
+            }
+            if (code->opcode == ast_jmp || code->opcode == ast_rts || code->opcode == ast_stop)
+            {
+                continue;
+            }
+        }
+        mark_reachable(optimizer, (int)(code - optimizer->code) + 1, &pending);
+    }
+
+    for (i = 0; i < optimizer->code_counter; i++)
+    {
+        if (!optimizer->code[i].live)
+        {
+            optimizer->code[i].removed = 1;
+        }
+    }
+    for (i = 0; i < optimizer->data_counter; i++)
+    {
+        if (optimizer->data[i].label[0] != NULL_BYTE)
+        {
+            live = optimizer->data[i].live;
+        }
+        optimizer->data[i].removed = !live;
+    }
+}
+
+/**
+ * @brief Marks the data line of a symbol as written, if it is a data symbol.
+ */
+static void mark_written_symbol(struct optimizer *optimizer, table_ptr symbol, int data_start)
+{
+    int index;
+
+    if (symbol != NULL && (symbol->symbol_type == data_symbol || symbol->symbol_type == entry_data) &&
+        (index = find_data_line(optimizer, symbol->symbol_address - data_start)) != NO_INSTRUCTION)
+    {
+        optimizer->data[index].written = 1;
+    }
+}
+
+/**
+ * @brief Marks the data lines that may be written to: the destinations of mov, add, sub,
+ * clr, not, inc, dec and red, the sources of lea and the entries.
+ *
+ * The address lea loads can be written through a register, and an entry can be written
+ * by the modules linked with the file, so neither is ever shared.
+ */
+static void mark_written_data(struct assembler_context *ctx, struct optimizer *optimizer)
+{
+    int data_start = ctx->machine_code.IC ? ctx->machine_code.IC : TARGET_LOAD_BASE, i, operand;
+    struct code_line *code;
+    table_ptr symbol;
+
+    for (i = 0; i < optimizer->code_counter; i++)
+    {
+        code = &optimizer->code[i];
+        if (code->removed || code->opcode == ast_cmp || (code->opcode > ast_dec && code->opcode != ast_red))
+        {
+            continue;
+        }
+        operand = (code->opcode < ast_lea) ? 1 : 0; /* The destination, or the source of lea */
+        if (code->modes[operand] == ast_label)
+        {
+            mark_written_symbol(optimizer, symbol_search(ctx->symbol_table, code->operands[operand]), data_start);
+        }
+    }
+    for (symbol = ctx->symbol_table; symbol != NULL; symbol = symbol->next)
+    {
+        if (symbol->symbol_type == entry_data)
+        {
+            mark_written_symbol(optimizer, symbol, data_start);
+        }
+    }
+}
+
+/**
+ * @brief Orders blocks from the longest, then in the order of the source, for qsort.
+ */
+static int compare_blocks(const void *a, const void *b)
+{
+    const struct pool_block *x = (const struct pool_block *)a;
+    const struct pool_block *y = (const struct pool_block *)b;
+
+    if (x->words != y->words)
+    {
+        return y->words - x->words;
+    }
+    return x->line - y->line;
+}
+
+/**
+ * @brief Adds a word to the hash of the words after it.
+ *
+ * The words of a block are hashed from the last one, so the hashes of all its suffixes
+ * are found in a single walk over it.
+ */
+static unsigned long hash_word(unsigned long hash, uint16_t word)
+{
+    return ((hash ^ word) * HASH_PRIME) & 0xFFFFFFFFUL;
+}
+
+/**
+ * @brief Stores each block of data once: a block whose words are the same as another block,
+ * or as the end of a longer one, has its label moved into that block.
+ *
+ * The blocks are pooled from the longest, so a block is looked up among the suffixes of the
+ * blocks kept before it. Blocks that may be written to are left alone.
+ *
+ * @param ctx The context, holding the data image and the symbols.
+ * @param optimizer The optimizer holding the instructions and the data lines.
+ */
+static void pool_constants(struct assembler_context *ctx, struct optimizer *optimizer)
+{
+    const uint16_t *image = ctx->machine_code.data_image, *words;
+    struct pool_entry *entry;
+    int blocks = 0, total = 0, size = POOL_MIN_SIZE, i, j, mask, slot, length;
+    unsigned long hash;
+
+    mark_written_data(ctx, optimizer);
+    if (optimizer->blocks_capacity < optimizer->data_counter)
+    {
+        optimizer->blocks_capacity = optimizer->data_counter;
+        optimizer->blocks = (struct pool_block *)reallocateMemory(optimizer->blocks, optimizer->blocks_capacity, sizeof(struct pool_block));
+    }
+    for (i = 0; i < optimizer->data_counter; i++)
+    {
+        if (optimizer->data[i].label[0] == NULL_BYTE || optimizer->data[i].removed)
+        {
+            continue;
+        }
+        for (j = i; j < optimizer->data_counter && (j == i || optimizer->data[j].label[0] == NULL_BYTE); j++)
+        {
+            optimizer->data[i].block_words += optimizer->data[j].words;
+        }
+        if (!optimizer->data[i].written)
+        {
+            optimizer->blocks[blocks].line = i;
+            optimizer->blocks[blocks++].words = optimizer->data[i].block_words;
+            total += optimizer->data[i].block_words;
+        }
+    }
+    if (blocks > 1)
+    {
+        qsort(optimizer->blocks, blocks, sizeof(struct pool_block), compare_blocks);
+    }
+
+    /* At most one entry per word, the table is kept at most half full */
+    while (size < 2 * total)
+    {
+        size *= 2;
+    }
+    if (optimizer->pool_capacity < size)
+    {
+        optimizer->pool_capacity = size;
+        optimizer->pool = (struct pool_entry *)reallocateMemory(optimizer->pool, optimizer->pool_capacity, sizeof(struct pool_entry));
+    }
+    mask = size - 1;
+    for (i = 0; i < size; i++)
+    {
+        optimizer->pool[i].line = -1;
+    }
+
+    for (i = 0; i < blocks; i++)
+    {
+        words = image + optimizer->data[optimizer->blocks[i].line].offset;
+        length = optimizer->blocks[i].words;
+        hash = HASH_BASIS;
+        for (j = length - 1; j >= 0; j--)
+        {
+            hash = hash_word(hash, words[j]);
+        }
+        for (slot = hash & mask; (entry = &optimizer->pool[slot])->line >= 0; slot = (slot + 1) & mask)
+        {
+            if (entry->hash == hash && optimizer->data[entry->line].block_words - entry->position == length &&
+                memcmp(image + optimizer->data[entry->line].offset + entry->position, words, length * sizeof(uint16_t)) == 0)
+            {
+                break;
+            }
+        }
+        if (entry->line >= 0)
+        {
+            optimizer->data[optimizer->blocks[i].line].pooled_in = entry->line;
+            optimizer->data[optimizer->blocks[i].line].pooled_at = entry->position;
+            for (j = optimizer->blocks[i].line; j < optimizer->data_counter && (j == optimizer->blocks[i].line || optimizer->data[j].label[0] == NULL_BYTE); j++)
+            {
+                optimizer->data[j].removed = 1;
+            }
+            continue;
+        }
+
+        /* The block is kept, the blocks after it may end up in any of its suffixes */
+        hash = HASH_BASIS;
+        for (j = length - 1; j >= 0; j--)
+        {
+            hash = hash_word(hash, words[j]);
+            for (slot = hash & mask; optimizer->pool[slot].line >= 0; slot = (slot + 1) & mask)
+            {
+                continue;
+            }
+            optimizer->pool[slot].hash = hash;
+            optimizer->pool[slot].line = optimizer->blocks[i].line;
+            optimizer->pool[slot].position = j;
+        }
+    }
+}
+
+/**
+ * @brief Replaces the lines of the removed and retargeted instructions and of the removed data in the line index.
+ *
+ * A removed line becomes empty, so the lines keep their numbers in the errors of the second pass.
+ *
+ * @param ctx The context whose line index is changed.
+ * @param optimizer The optimizer holding the instructions and the data lines.
+ */
+static void rewrite_lines(struct assembler_context *ctx, struct optimizer *optimizer)
+{
+    char line[MAX_BUFFER_LENGTH];
+    struct code_line *code;
+    struct line_view *view;
+    size_t start;
+    int i;
+
+    for (i = 0; i < optimizer->code_counter; i++)
+    {
+        code = &optimizer->code[i];
+        view = &ctx->am_lines.lines[code->line];
+        if (code->removed)
+        {
+            view->text = "";
+            view->length = 0;
+        }
+        else if (code->rewritten)
+        {
+            /* Only the offset is kept for now, the buffer may move while the next lines are appended */
+            sprintf(line, "%s%s%s %s\n", code->label, code->label[0] ? ": " : "", inst_table[code->opcode].name, code->operands[0]);
+            start = optimizer->text.length;
+            append_text(&optimizer->text, line, strlen(line));
+            view->length = start;
+        }
+    }
+    for (i = 0; i < optimizer->code_counter; i++)
+    {
+        view = &ctx->am_lines.lines[optimizer->code[i].line];
+        if (optimizer->code[i].rewritten && !optimizer->code[i].removed)
+        {
+            view->text = optimizer->text.text + view->length;
+            view->length = strchr(view->text, '\n') + 1 - view->text;
+        }
+    }
+    for (i = 0; i < optimizer->data_counter; i++)
+    {
+        if (optimizer->data[i].removed)
+        {
+            ctx->am_lines.lines[optimizer->data[i].line].text = "";
+            ctx->am_lines.lines[optimizer->data[i].line].length = 0;
+        }
+    }
+}
+
+/**
+ * @brief Moves the kept data down over the removed data in the data image.
+ *
+ * @param ctx The context holding the data image.
+ * @param optimizer The optimizer holding the data lines, their moved_to is set.
+ * @return int The number of words removed.
+ */
+static int compact_data(struct assembler_context *ctx, struct optimizer *optimizer)
+{
+    translation_ptr machine_code_ptr = &ctx->machine_code;
+    struct data_line *data;
+    int i, offset = 0, removed;
+
+    for (i = 0; i < optimizer->data_counter; i++)
+    {
+        data = &optimizer->data[i];
+        if (data->removed)
+        {
+            continue;
+        }
+        if (offset != data->offset)
+        {
+            memmove(machine_code_ptr->data_image + offset, machine_code_ptr->data_image + data->offset, data->words * sizeof(uint16_t));
+        }
+        data->moved_to = offset;
+        offset += data->words;
+    }
+
+    /* The pooled blocks move into the blocks holding their words, once those moved */
+    for (i = 0; i < optimizer->data_counter; i++)
+    {
+        data = &optimizer->data[i];
+        if (data->pooled_in >= 0)
+        {
+            data->moved_to = optimizer->data[data->pooled_in].moved_to + data->pooled_at;
+        }
+    }
+    removed = machine_code_ptr->DC - offset;
+    machine_code_ptr->DC = offset;
+    return removed;
+}
+
+/**
+ * @brief Moves the symbols to the addresses of the code and of the data once the removed lines are gone.
+ *
+ * @param ctx The context holding the symbols.
+ * @param optimizer The optimizer holding the instructions and the compacted data lines.
+ * @return int The number of code words removed.
+ */
+static int relocate_symbols(struct assembler_context *ctx, struct optimizer *optimizer)
+{
+    int data_start = ctx->machine_code.IC ? ctx->machine_code.IC : TARGET_LOAD_BASE, i, removed = 0;
+    table_ptr symbol;
+
+    /* The new address of every instruction, a removed one takes the address of the next kept one */
+    for (i = 0; i < optimizer->code_counter; i++)
+    {
+        optimizer->by_address[optimizer->code[i].address - TARGET_LOAD_BASE] = optimizer->code[i].address - removed;
+        if (optimizer->code[i].removed)
+        {
+            removed += optimizer->code[i].words;
+        }
+    }
+
+    for (symbol = ctx->symbol_table; symbol != NULL; symbol = symbol->next)
+    {
+        if (symbol->symbol_type == code_symbol || symbol->symbol_type == entry_code)
+        {
+            symbol->symbol_address = optimizer->by_address[symbol->symbol_address - TARGET_LOAD_BASE];
+        }
+        else if (symbol->symbol_type == data_symbol || symbol->symbol_type == entry_data)
+        {
+            /* The data follows the code, the lines are still found by the offsets of the first pass */
+            i = find_data_line(optimizer, symbol->symbol_address - data_start);
+            symbol->symbol_address = data_start - removed +
+                                     ((i != NO_INSTRUCTION) ? optimizer->data[i].moved_to : symbol->symbol_address - data_start);
+        }
+    }
+    return removed;
+}
+
+/**
+ * @brief Checks that the optimized program fits in the memory.
+ *
+ * With optimizations the first pass leaves this check to them, so a program only has to fit once it is smaller.
+ * The second pass still checks every instruction.
+ *
+ * @param code_words The number of code words left.
+ * @return int Returns 1 if the data fits after the code, otherwise 0 after reporting the line that does not fit.
+ */
+static int check_memory(struct assembler_context *ctx, struct optimizer *optimizer, const char *file_name, int code_words)
+{
+    int i, words = code_words;
+
+    for (i = 0; i < optimizer->data_counter; i++)
+    {
+        if (!optimizer->data[i].removed && (words += optimizer->data[i].words) > ctx->machine_code.mem_size)
+        {
+            report_error(&ctx->errors, ERROR_MEMORY_FULL, file_name, optimizer->data[i].line + 1, NULL);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief Runs the optimizations of the context on a file, between its passes.
+ *
+ * Lines are removed from or rewritten in the line index of the context, the data image is
+ * compacted and the symbols are moved to their new addresses. Address arithmetic on labels
+ * is not preserved, only the labels themselves are.
+ *
+ * @param ctx The context, after a first pass without errors.
+ * @param file_name The name of the file, used in the errors.
+ * @return int The number of words saved, or -1 if the program does not fit in the memory.
+ */
+int optimize_code(struct assembler_context *ctx, const char *file_name)
+{
+    struct optimizer *optimizer = &ctx->optimizer;
+    int code_words = ctx->machine_code.IC ? ctx->machine_code.IC - TARGET_LOAD_BASE : 0, data_saved, code_saved;
+
+    clear_optimizer(optimizer);
+    collect_code(ctx, optimizer);
+    if (ctx->optimizations & OPTIMIZE_PEEPHOLE)
+    {
+        run_peephole(ctx, optimizer);
+    }
+    if (ctx->optimizations & OPTIMIZE_GC_SECTIONS)
+    {
+        collect_garbage(ctx, optimizer);
+        if (ctx->optimizations & OPTIMIZE_PEEPHOLE)
+        {
+            /* Removing dead code can leave jumps to the next instruction */
+            run_peephole(ctx, optimizer);
+        }
+    }
+    if (ctx->optimizations & OPTIMIZE_POOL_CONSTANTS)
+    {
+        pool_constants(ctx, optimizer);
+    }
+    rewrite_lines(ctx, optimizer);
+    data_saved = compact_data(ctx, optimizer);
+    code_saved = relocate_symbols(ctx, optimizer);
+    if (!check_memory(ctx, optimizer, file_name, code_words - code_saved))
+    {
+        return -1;
+    }
+    return code_saved + data_saved;
+}
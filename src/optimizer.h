@@ -0,0 +1,98 @@
+#ifndef OPTIMIZER_H
+#define OPTIMIZER_H
+
+#include "lineParser.h"
+#include "textBuffer.h"
+
+#define OPTIMIZE_PEEPHOLE 1     /* -O: remove no-op instructions and jumps, shorten jump chains */
+#define OPTIMIZE_GC_SECTIONS 2  /* --gc-sections: remove unreachable code and unreferenced data */
+#define OPTIMIZE_POOL_CONSTANTS 4 /* --pool-constants: store identical data, or data ending another, once */
+
+/**
+ * @brief An instruction of the file, as the optimizations see it.
+ */
+struct code_line
+{
+    int line;                            /* Index of its line in am_lines */
+    int address;                         /* Address the first pass gave it */
+    int words;                           /* Number of words it takes */
+    int removed;                         /* Set once an optimization removed it */
+    int rewritten;                       /* Set once an optimization changed its operands */
+    int live;                            /* Set once --gc-sections found it reachable */
+    int opcode;                          /* inst_type of the ast */
+    int modes[2];                        /* Operand types, ast_none for a missing operand */
+    int values[2];                       /* Register or immediate of each operand */
+    char operands[2][MAX_LABEL_SIZE];    /* Label of each label operand */
+    char label[MAX_LABEL_SIZE];          /* Label defined by the line, or empty */
+};
+
+/**
+ * @brief A .data or .string line of the file, as the optimizations see it.
+ */
+struct data_line
+{
+    int line;                   /* Index of its line in am_lines */
+    int offset;                 /* Index of its first word in the data image */
+    int moved_to;               /* Index of its first word once the data image is compacted */
+    int words;                  /* Number of words it takes */
+    int removed;                /* Set once an optimization removed it */
+    int live;                   /* Set once --gc-sections found it referenced */
+    int written;                /* Set if an instruction writes to its label, it is then never pooled */
+    int block_words;            /* Words of its label and the lines without a label after it, 0 without a label */
+    int pooled_in;              /* Data line whose block holds the content of its block, or -1 */
+    int pooled_at;              /* Index of that content in that block */
+    char label[MAX_LABEL_SIZE]; /* Label defined by the line, or empty */
+};
+
+/**
+ * @brief A block of data: a labeled data line and the lines without a label after it.
+ */
+struct pool_block
+{
+    int line;  /* Data line starting the block */
+    int words; /* Number of words in the block */
+};
+
+/**
+ * @brief A suffix of a block of data, in the table --pool-constants looks the blocks up in.
+ */
+struct pool_entry
+{
+    unsigned long hash; /* Hash of the words of the suffix */
+    int line;           /* Data line starting the block, or -1 for an empty entry */
+    int position;       /* Index of the first word of the suffix in the block */
+};
+
+/**
+ * @brief The state of the optimizations of a file, kept in its context.
+ *
+ * Clearing it keeps its memory for the next file.
+ */
+struct optimizer
+{
+    struct code_line *code;     /* The instructions, in order */
+    int code_counter;           /* Number of instructions */
+    int code_capacity;          /* Number of instructions allocated */
+    int *by_address;            /* Index of the instruction starting at each address from the load base, or -1 */
+    int addresses_capacity;     /* Number of addresses allocated */
+    struct data_line *data;     /* The data lines, in order */
+    int data_counter;           /* Number of data lines */
+    int data_capacity;          /* Number of data lines allocated */
+    int *worklist;              /* Instructions found reachable whose successors are not marked yet */
+    int worklist_capacity;      /* Number of instructions allocated in worklist */
+    struct pool_block *blocks;  /* The blocks of data --pool-constants may pool, the longest first */
+    int blocks_capacity;        /* Number of blocks allocated */
+    struct pool_entry *pool;    /* Open addressing table of the suffixes of the pooled blocks */
+    int pool_capacity;          /* Number of entries allocated in pool, a power of 2 */
+    struct text_buffer text;    /* The rewritten lines, the line index points into it */
+};
+
+struct assembler_context;
+
+/* Prototypes */
+void init_optimizer(struct optimizer *optimizer);
+void clear_optimizer(struct optimizer *optimizer);
+void release_optimizer(struct optimizer *optimizer);
+int optimize_code(struct assembler_context *ctx, const char *file_name);
+
+#endif
@@ -0,0 +1,365 @@
+#include "options.h"
+#include "helpingFunction.h"
+
+/**
+ * @brief Parses a strictly positive decimal number.
+ *
+ * @param str The string to parse.
+ * @param result Pointer to where the parsed number is stored.
+ * @return int Returns 1 if the string is a positive number, otherwise 0.
+ */
+int parse_positive_number(const char *str, int *result)
+{
+    char *end_ptr = NULL;
+    long num;
+
+    if (str == NULL)
+    {
+        return 0;
+    }
+
+    num = strtol(str, &end_ptr, 10);
+    if (end_ptr == str || *end_ptr != '\0' || num <= 0 || num > 0x7FFFFFFFL)
+    {
+        return 0;
+    }
+
+    *result = (int)num;
+    return 1;
+}
+
+/**
+ * @brief Parses a strictly positive size in bytes, with an optional K, M or G suffix.
+ *
+ * @param str The string to parse.
+ * @param result Pointer to where the parsed size is stored.
+ * @return int Returns 1 if the string is a valid size, otherwise 0.
+ */
+int parse_size(const char *str, long *result)
+{
+    char *end_ptr = NULL;
+    long num, scale = 1;
+
+    if (str == NULL)
+    {
+        return 0;
+    }
+
+    num = strtol(str, &end_ptr, 10);
+    if (end_ptr == str || num <= 0)
+    {
+        return 0;
+    }
+
+    switch (*end_ptr)
+    {
+    case 'K':
+        scale = 1024L;
+        end_ptr++;
+        break;
+    case 'M':
+        scale = 1024L * 1024L;
+        end_ptr++;
+        break;
+    case 'G':
+        scale = 1024L * 1024L * 1024L;
+        end_ptr++;
+        break;
+    }
+    if (*end_ptr != '\0' || num > 0x7FFFFFFFL / scale)
+    {
+        return 0;
+    }
+
+    *result = num * scale;
+    return 1;
+}
+
+/**
+ * @brief Appends the input file names listed in the manifest to the options.
+ *
+ * The manifest holds one name per line. Surrounding blanks are ignored, as are
+ * empty lines and lines starting with '#'.
+ *
+ * @param options Pointer to the options structure, with manifest_path set.
+ * @return int Returns 1 if the manifest was read, otherwise prints an error and returns 0.
+ */
+int read_manifest(struct assembler_options *options)
+{
+    FILE *file = stdin;
+    char *line, *end, *next;
+    int lines_counter = 1;
+    size_t i;
+
+    if (strcmp(options->manifest_path, MANIFEST_STDIN) != 0)
+    {
+        file = fopen(options->manifest_path, "r");
+        if (file == NULL)
+        {
+            printf("Error: Unable to open the manifest %s\n", options->manifest_path);
+            return 0;
+        }
+    }
+    read_text_file(&options->manifest, file);
+    if (file != stdin)
+    {
+        fclose(file);
+    }
+    if (options->manifest.length == 0)
+    {
+        return 1;
+    }
+
+    /* Every line may hold a name */
+    for (i = 0; i < options->manifest.length; i++)
+    {
+        lines_counter += options->manifest.text[i] == '\n';
+    }
+    options->files = (char **)reallocateMemory(options->files, options->files_counter + lines_counter, sizeof(char *));
+
+    /* Split the lines in place */
+    for (line = options->manifest.text; line != NULL; line = next)
+    {
+        next = strchr(line, '\n');
+        if (next != NULL)
+        {
+            *next++ = '\0';
+        }
+
+        while (isspace((unsigned char)*line))
+        {
+            line++;
+        }
+        end = line + strlen(line);
+        while (end > line && isspace((unsigned char)end[-1]))
+        {
+            *--end = '\0';
+        }
+
+        if (*line != '\0' && *line != '#')
+        {
+            options->files[options->files_counter++] = line;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief Parses the command line arguments into an options structure.
+ *
+ * Options may appear anywhere on the command line. Every other argument is
+ * collected as an input file name.
+ *
+ * @param argc Number of command line arguments.
+ * @param argv The command line arguments.
+ * @param options Pointer to the options structure to fill.
+ * @return int Returns 1 if the arguments are valid, otherwise prints an error and returns 0.
+ */
+int parse_options(int argc, char **argv, struct assembler_options *options)
+{
+    int i;
+
+    options->mem_size = MAX_MEM_SIZE;
+    options->skip_unchanged = 0;
+    options->jobs = 1;
+    options->serve_path = NULL;
+    options->client_path = NULL;
+    options->shutdown = 0;
+    options->cache_dir = NULL;
+    options->cache_size = CACHE_DEFAULT_SIZE;
+    options->cache_stats = 0;
+    options->manifest_path = NULL;
+    init_text_buffer(&options->manifest);
+    options->timings = 0;
+    options->prefetch = 0;
+    options->stream = 0;
+    options->output_fd = STREAM_DEFAULT_FD;
+    options->stats = 0;
+    options->trace_path = NULL;
+    options->max_errors = 0;
+    options->optimizations = 0;
+    options->files = (char **)allocateMemory(argc, sizeof(char *), CALLOC_ID);
+    options->files_counter = 0;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], OPTION_MEM_SIZE) == 0)
+        {
+            if (!parse_positive_number(argv[++i], &options->mem_size) || options->mem_size > MAX_MEM_SIZE)
+            {
+                printf("Error: %s expects a positive number of words, at most the %d words an operand of the %s target addresses\n",
+                       OPTION_MEM_SIZE, MAX_MEM_SIZE, TARGET_NAME);
+                return 0;
+            }
+        }
+        else if (strcmp(argv[i], OPTION_SKIP_UNCHANGED) == 0)
+        {
+            options->skip_unchanged = 1;
+        }
+        else if (strncmp(argv[i], OPTION_JOBS, strlen(OPTION_JOBS)) == 0)
+        {
+            /* Both "-j N" and "-jN" are accepted */
+            if (!parse_positive_number(argv[i][2] ? argv[i] + 2 : argv[++i], &options->jobs))
+            {
+                printf("Error: %s expects a positive number of jobs\n", OPTION_JOBS);
+                return 0;
+            }
+        }
+        else if (strcmp(argv[i], OPTION_SERVE) == 0 || strcmp(argv[i], OPTION_CLIENT) == 0)
+        {
+            if (argv[i + 1] == NULL)
+            {
+                printf("Error: %s expects a socket path\n", argv[i]);
+                return 0;
+            }
+            if (strcmp(argv[i], OPTION_SERVE) == 0)
+            {
+                options->serve_path = argv[++i];
+            }
+            else
+            {
+                options->client_path = argv[++i];
+            }
+        }
+        else if (strcmp(argv[i], OPTION_SHUTDOWN) == 0)
+        {
+            options->shutdown = 1;
+        }
+        else if (strcmp(argv[i], OPTION_CACHE) == 0)
+        {
+            if (argv[i + 1] == NULL)
+            {
+                printf("Error: %s expects a directory\n", OPTION_CACHE);
+                return 0;
+            }
+            options->cache_dir = argv[++i];
+        }
+        else if (strcmp(argv[i], OPTION_CACHE_SIZE) == 0)
+        {
+            if (!parse_size(argv[++i], &options->cache_size))
+            {
+                printf("Error: %s expects a positive size in bytes, with an optional K, M or G suffix\n", OPTION_CACHE_SIZE);
+                return 0;
+            }
+        }
+        else if (strcmp(argv[i], OPTION_CACHE_STATS) == 0)
+        {
+            options->cache_stats = 1;
+        }
+        else if (strcmp(argv[i], OPTION_MANIFEST) == 0)
+        {
+            if (argv[i + 1] == NULL)
+            {
+                printf("Error: %s expects a file, or %s for stdin\n", OPTION_MANIFEST, MANIFEST_STDIN);
+                return 0;
+            }
+            options->manifest_path = argv[++i];
+        }
+        else if (strcmp(argv[i], OPTION_TIMINGS) == 0)
+        {
+            options->timings = 1;
+        }
+        else if (strcmp(argv[i], OPTION_PREFETCH) == 0)
+        {
+            options->prefetch = 1;
+        }
+        else if (strcmp(argv[i], OPTION_STATS) == 0 || strcmp(argv[i], OPTION_STATS_JSON) == 0)
+        {
+            options->stats = (strcmp(argv[i], OPTION_STATS_JSON) == 0) ? STATS_FORMAT_JSON : STATS_FORMAT_TABLE;
+        }
+        else if (strcmp(argv[i], OPTION_MAX_ERRORS) == 0)
+        {
+            if (!parse_positive_number(argv[++i], &options->max_errors))
+            {
+                printf("Error: %s expects a positive number of errors\n", OPTION_MAX_ERRORS);
+                return 0;
+            }
+        }
+        else if (strcmp(argv[i], OPTION_OPTIMIZE) == 0)
+        {
+            options->optimizations |= OPTIMIZE_PEEPHOLE;
+        }
+        else if (strcmp(argv[i], OPTION_GC_SECTIONS) == 0)
+        {
+            options->optimizations |= OPTIMIZE_GC_SECTIONS;
+        }
+        else if (strcmp(argv[i], OPTION_POOL_CONSTANTS) == 0)
+        {
+            options->optimizations |= OPTIMIZE_POOL_CONSTANTS;
+        }
+        else if (strcmp(argv[i], OPTION_TRACE) == 0)
+        {
+            if (argv[i + 1] == NULL)
+            {
+                printf("Error: %s expects a file\n", OPTION_TRACE);
+                return 0;
+            }
+            options->trace_path = argv[++i];
+        }
+        else if (strcmp(argv[i], OPTION_OUTPUT_FD) == 0)
+        {
+            if (!parse_positive_number(argv[++i], &options->output_fd))
+            {
+                printf("Error: %s expects a file descriptor\n", OPTION_OUTPUT_FD);
+                return 0;
+            }
+        }
+        else if (strncmp(argv[i], "--", 2) == 0)
+        {
+            printf("Error: Unknown option %s\n", argv[i]);
+            return 0;
+        }
+        else
+        {
+            options->files[options->files_counter++] = argv[i];
+        }
+    }
+
+    if (options->manifest_path != NULL && !read_manifest(options))
+    {
+        return 0;
+    }
+
+    for (i = 0; i < options->files_counter; i++)
+    {
+        options->stream |= strcmp(options->files[i], STREAM_INPUT) == 0;
+    }
+    if (options->stream && (options->files_counter > 1 || options->manifest_path != NULL || options->serve_path != NULL ||
+                            options->client_path != NULL || options->cache_dir != NULL))
+    {
+        printf("Error: %s reads a single source from stdin and cannot be combined with other inputs, %s, %s, %s or %s\n",
+               STREAM_INPUT, OPTION_MANIFEST, OPTION_SERVE, OPTION_CLIENT, OPTION_CACHE);
+        return 0;
+    }
+
+    if (options->serve_path != NULL && (options->client_path != NULL || options->files_counter > 0))
+    {
+        printf("Error: %s does not take input files\n", OPTION_SERVE);
+        return 0;
+    }
+    if (options->cache_dir != NULL && options->client_path != NULL)
+    {
+        printf("Error: %s is given to the server, not to %s\n", OPTION_CACHE, OPTION_CLIENT);
+        return 0;
+    }
+    if (options->shutdown && options->client_path == NULL)
+    {
+        printf("Error: %s requires %s\n", OPTION_SHUTDOWN, OPTION_CLIENT);
+        return 0;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Frees the memory held by an options structure.
+ *
+ * @param options Pointer to the options structure to free.
+ */
+void free_options(struct assembler_options *options)
+{
+    free(options->files);
+    options->files = NULL;
+    release_text_buffer(&options->manifest);
+    options->files_counter = 0;
+}
@@ -0,0 +1,75 @@
+#ifndef OPTIONS_H
+#define OPTIONS_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "translate.h"
+#include "buildCache.h"
+#include "textBuffer.h"
+#include "stats.h"
+#include "optimizer.h"
+
+#define OPTION_MEM_SIZE "--mem-size"
+#define OPTION_SKIP_UNCHANGED "--skip-unchanged"
+#define OPTION_JOBS "-j"
+#define OPTION_SERVE "--serve"
+#define OPTION_CLIENT "--client"
+#define OPTION_SHUTDOWN "--shutdown"
+#define OPTION_CACHE "--cache"
+#define OPTION_CACHE_SIZE "--cache-size"
+#define OPTION_CACHE_STATS "--cache-stats"
+#define OPTION_MANIFEST "--manifest"
+#define OPTION_TIMINGS "--timings"
+#define OPTION_PREFETCH "--prefetch"
+#define OPTION_OUTPUT_FD "--output-fd"
+#define OPTION_STATS "--stats"
+#define OPTION_STATS_JSON "--stats=json"
+#define OPTION_TRACE "--trace"
+#define OPTION_MAX_ERRORS "--max-errors"
+#define OPTION_OPTIMIZE "-O"
+#define OPTION_GC_SECTIONS "--gc-sections"
+#define OPTION_POOL_CONSTANTS "--pool-constants"
+#define MANIFEST_STDIN "-"  /* Manifest path reading the manifest from stdin */
+#define STREAM_INPUT "-"    /* Input file name reading the source from stdin */
+#define STREAM_DEFAULT_FD 1 /* The bundle of the stream mode goes to stdout by default */
+
+/**
+ * @brief Structure holding the command line options of the assembler.
+ *
+ * Every argument that is not an option is an input file name (without the .as extension).
+ * The names listed in a manifest follow the names given as arguments.
+ */
+struct assembler_options
+{
+    int mem_size;                /**< Maximum number of words a program may occupy */
+    int skip_unchanged;          /**< Only replace output files whose content changed */
+    int jobs;                    /**< Number of files assembled at the same time */
+    char *serve_path;            /**< Socket path to serve requests on, or NULL */
+    char *client_path;           /**< Socket path of the server to send the files to, or NULL */
+    int shutdown;                /**< Ask the server at client_path to stop */
+    char *cache_dir;             /**< Build cache directory, or NULL */
+    long cache_size;             /**< Bound of the size of the build cache, in bytes */
+    int cache_stats;             /**< Print the hits and misses of the build cache */
+    char *manifest_path;         /**< File listing input file names, one per line, or NULL */
+    struct text_buffer manifest; /**< The content of the manifest, the names point into it */
+    int timings;                 /**< Print the time taken by every file */
+    int prefetch;                /**< Read the sources ahead and write the outputs on I/O threads */
+    int stream;                  /**< The input is STREAM_INPUT: read stdin, write a bundle to output_fd */
+    int output_fd;               /**< File descriptor the bundle of the stream mode is written to */
+    int stats;                   /**< 0, or the format of the per phase statistics (see stats.h) */
+    char *trace_path;            /**< File the trace events of the run are written to, or NULL */
+    int max_errors;              /**< A file stops being assembled at this many errors, 0 for no limit */
+    int optimizations;           /**< The optimizations run between the passes, a mask of the OPTIMIZE_ flags */
+    char **files;                /**< Input file names, in argument order */
+    int files_counter;           /**< Number of input file names */
+};
+
+/* Prototypes */
+int parse_options(int argc, char **argv, struct assembler_options *options);
+int parse_positive_number(const char *str, int *result);
+int parse_size(const char *str, long *result);
+int read_manifest(struct assembler_options *options);
+void free_options(struct assembler_options *options);
+
+#endif
@@ -1,4 +1,361 @@
+#define _POSIX_C_SOURCE 200809L /* open_memstream */
+#define ALLOC_CATEGORY ALLOC_OUTPUT /* Allocations counted by TRACK_ALLOCATIONS builds */
 #include "output.h"
+#include "assemblerContext.h"
+#include "protocol.h"
+#include "stats.h"
+
+/**
+ * @brief Checks if a file already holds exactly the given content.
+ *
+ * @param file_name The name of the file to compare.
+ * @param content The expected content.
+ * @param size The size of the expected content.
+ * @return int Returns 1 if the file exists and its content is identical, otherwise 0.
+ */
+static int file_has_content(const char *file_name, const char *content, size_t size)
+{
+    char chunk[OUTPUT_CHUNK_SIZE];
+    size_t offset = 0, read_size;
+    int same = 1;
+    FILE *file = fopen(file_name, "rb");
+
+    if (!file)
+    {
+        return 0;
+    }
+
+    /* Different sizes can never match, so avoid reading the file */
+    if (fseek(file, 0, SEEK_END) != 0 || ftell(file) != (long)size)
+    {
+        fclose(file);
+        return 0;
+    }
+    rewind(file);
+
+    while (same && (read_size = fread(chunk, 1, sizeof(chunk), file)) > 0)
+    {
+        same = (offset + read_size <= size) && memcmp(chunk, content + offset, read_size) == 0;
+        offset += read_size;
+    }
+
+    fclose(file);
+    return same && offset == size;
+}
+
+/**
+ * @brief Opens an output file for writing.
+ *
+ * When skip_unchanged is set the content is collected in memory, and the file
+ * is only written by close_output_file if it differs from the existing one.
+ * With a pipeline the content is also collected in memory, and its writer thread
+ * writes the file.
+ *
+ * @param output Pointer to the output file structure to initialize.
+ * @param file_name The name of the output file.
+ * @param skip_unchanged Whether to keep the existing file if its content is unchanged.
+ * @param pipeline The pipeline writing the outputs, or NULL to write them here.
+ * @return FILE* The stream to write the content to, or NULL if it could not be opened.
+ */
+FILE *open_output_file(struct output_file *output, const char *file_name, int skip_unchanged, struct io_pipeline *pipeline)
+{
+    output->name = file_name;
+    output->buffer = NULL;
+    output->size = 0;
+    output->skip_unchanged = skip_unchanged;
+    output->pipeline = pipeline;
+
+    if (skip_unchanged || pipeline != NULL)
+    {
+        output->file = open_memstream(&output->buffer, &output->size);
+    }
+    else
+    {
+        output->file = fopen(file_name, "w");
+    }
+    return output->file;
+}
+
+/**
+ * @brief Writes the content of an output file collected in memory.
+ *
+ * In skip_unchanged mode the content is compared with the existing file. A changed
+ * file is written to a temporary file which is then renamed over the old one, so
+ * readers never see a partially written output.
+ *
+ * @param file_name The name of the output file.
+ * @param content The content of the file.
+ * @param size The size of the content.
+ * @param skip_unchanged Whether to keep the existing file if its content is unchanged.
+ * @return int Returns 1 on success, otherwise 0.
+ */
+int write_output_content(const char *file_name, const char *content, size_t size, int skip_unchanged)
+{
+    char *temp_name;
+    FILE *file;
+    int result = 1;
+
+    if (!skip_unchanged)
+    {
+        file = fopen(file_name, "w");
+        if (!file || fwrite(content, 1, size, file) != size)
+        {
+            fprintf(stderr, "Could not open the file %s for writing\n", file_name);
+            result = 0;
+        }
+        if (file && fclose(file) != 0)
+        {
+            result = 0;
+        }
+        return result;
+    }
+
+    if (file_has_content(file_name, content, size))
+    {
+        return 1;
+    }
+
+    temp_name = (char *)allocateMemory(strlen(file_name) + strlen(TEMP_SUFFIX) + 1, sizeof(char), MALLOC_ID);
+    strcpy(temp_name, file_name);
+    strcat(temp_name, TEMP_SUFFIX);
+
+    file = fopen(temp_name, "w");
+    if (!file || fwrite(content, 1, size, file) != size)
+    {
+        fprintf(stderr, "Could not open the file %s for writing\n", temp_name);
+        result = 0;
+    }
+    if (file && fclose(file) != 0)
+    {
+        result = 0;
+    }
+    if (result && rename(temp_name, file_name) != 0)
+    {
+        fprintf(stderr, "Could not replace the file %s\n", file_name);
+        result = 0;
+    }
+    if (!result)
+    {
+        remove(temp_name);
+    }
+
+    free(temp_name);
+    return result;
+}
+
+/**
+ * @brief Closes an output file opened by open_output_file.
+ *
+ * Content collected in memory is written by write_output_content, or handed to the
+ * writer thread of the pipeline.
+ *
+ * @param output Pointer to the output file structure.
+ * @return int Returns 1 on success, otherwise 0.
+ */
+int close_output_file(struct output_file *output)
+{
+    int result = 1;
+
+    fclose(output->file);
+    output->file = NULL;
+
+    if (output->pipeline != NULL)
+    {
+        queue_output_write(output->pipeline, output->name, output->buffer, output->size, output->skip_unchanged);
+        output->buffer = NULL; /* Owned by the pipeline now */
+        return 1;
+    }
+
+    if (output->skip_unchanged)
+    {
+        result = write_output_content(output->name, output->buffer, output->size, 1);
+    }
+
+    free(output->buffer);
+    output->buffer = NULL;
+    return result;
+}
+
+/**
+ * @brief Closes an output file opened by open_output_file without producing it.
+ *
+ * A file already written by open_output_file, or left by a previous run, is removed.
+ *
+ * @param output Pointer to the output file structure.
+ * @return int Returns 1 if the file was removed, otherwise 0.
+ */
+int discard_output_file(struct output_file *output)
+{
+    fclose(output->file);
+    output->file = NULL;
+    free(output->buffer);
+    output->buffer = NULL;
+
+    if (output->pipeline != NULL)
+    {
+        queue_output_removal(output->pipeline, output->name);
+        return 1;
+    }
+    return remove(output->name) == 0;
+}
+
+/**
+ * @brief Writes the content of the entry file: every entry symbol and its address.
+ *
+ * @param ctx The context of the assembled file.
+ * @param file The stream the content is written to.
+ */
+void write_ent_content(struct assembler_context *ctx, FILE *file)
+{
+    table_ptr find = ctx->symbol_table;
+    table_ptr current_entry;
+
+    /* Writing the symbol names and addresses */
+    while ((current_entry = find_entry(find)) != NULL)
+    {
+        find = current_entry->next;
+
+        /* Write the symbol name and address */
+        fprintf(file, "%s %d", current_entry->symbol_name, current_entry->symbol_address);
+
+        /* Check if this is the last entry */
+        if (find_entry(find) != NULL)
+        {
+            fprintf(file, "\n");
+        }
+    }
+}
+
+/**
+ * @brief Writes the content of the extern file: every use of an external symbol.
+ *
+ * @param ctx The context of the assembled file, holding the extern usage information.
+ * @param file The stream the content is written to.
+ */
+void write_ext_content(struct assembler_context *ctx, FILE *file)
+{
+    extern_addresses_ptr current_extern = ctx->extern_usage;
+    int i;
+
+    /* Writing the symbol names and the addresses they have been used */
+    while (current_extern != NULL)
+    {
+        /* Write each address */
+        for (i = 0; i < current_extern->used_counter; i++)
+        {
+            fprintf(file, "%s\t%04d", current_extern->name, current_extern->used_addresses[i]);
+            /* Avoid adding a newline if it's the last entry */
+            if (current_extern->next != NULL || i < current_extern->used_counter - 1)
+            {
+                fprintf(file, "\n");
+            }
+        }
+        current_extern = current_extern->next;
+    }
+}
+
+/**
+ * @brief Writes the content of the object file: the header, the code image and the data image.
+ *
+ * @param ctx The context of the assembled file, holding the machine code.
+ * @param file The stream the content is written to.
+ */
+void write_ob_content(struct assembler_context *ctx, FILE *file)
+{
+    translation_ptr machine_code_ptr = &ctx->machine_code;
+
+    /* Writing the header (number of instructions and number of directive) */
+    if((machine_code_ptr->IC) == 0) 
+    {
+        fprintf(file, "%d\t%d\n", (machine_code_ptr->IC),  (machine_code_ptr->DC));
+    }
+    else 
+    {
+        fprintf(file, "%d\t%d\n", (machine_code_ptr->IC) - TARGET_LOAD_BASE,  (machine_code_ptr->DC));
+    }
+    /* Writing the code_image */
+    fprint_code_image(machine_code_ptr, file);
+    fprint_data_image(machine_code_ptr, file);
+}
+
+/**
+ * @brief Checks if an entry file is created for the assembled file.
+ *
+ * @param ctx The context of the assembled file.
+ * @return int Returns 1 if there are entry symbols, otherwise 0.
+ */
+int has_ent_file(struct assembler_context *ctx)
+{
+    return find_entry(ctx->symbol_table) != NULL;
+}
+
+/**
+ * @brief Checks if an extern file is created for the assembled file.
+ *
+ * @param ctx The context of the assembled file.
+ * @return int Returns 1 if there are extern symbols, otherwise 0.
+ */
+int has_ext_file(struct assembler_context *ctx)
+{
+    return find_extern_in_symbol_table(ctx->symbol_table) != NULL;
+}
+
+/**
+ * @brief Checks if an object file is created for the assembled file.
+ *
+ * @param ctx The context of the assembled file.
+ * @return int Returns 1 if there is any code or data, otherwise 0.
+ */
+int has_ob_file(struct assembler_context *ctx)
+{
+    return (ctx->machine_code.DC != 0) || (ctx->machine_code.IC != 0);
+}
+
+/**
+ * @brief Appends the content of the output files of an assembled source to a message,
+ * as RECORD_OB, RECORD_ENT and RECORD_EXT records.
+ *
+ * @param ctx The context of the assembled file.
+ * @param outputs A memory stream the contents are written to first.
+ * @param outputs_buffer Pointer to the buffer of the memory stream.
+ * @param message The message the records are appended to.
+ */
+void append_output_records(struct assembler_context *ctx, FILE *outputs, char *const *outputs_buffer, struct text_buffer *message)
+{
+    long ob_end, ent_end, ext_end;
+
+    /* Write all the outputs first, the stream may move its buffer while growing */
+    rewind(outputs);
+    if (has_ob_file(ctx))
+    {
+        write_ob_content(ctx, outputs);
+    }
+    ob_end = ftell(outputs);
+    if (has_ent_file(ctx))
+    {
+        write_ent_content(ctx, outputs);
+    }
+    ent_end = ftell(outputs);
+    if (has_ext_file(ctx))
+    {
+        write_ext_content(ctx, outputs);
+    }
+    ext_end = ftell(outputs);
+    fflush(outputs);
+
+    if (has_ob_file(ctx))
+    {
+        append_record(message, RECORD_OB, *outputs_buffer, ob_end);
+    }
+    if (has_ent_file(ctx))
+    {
+        append_record(message, RECORD_ENT, *outputs_buffer + ob_end, ent_end - ob_end);
+    }
+    if (has_ext_file(ctx))
+    {
+        append_record(message, RECORD_EXT, *outputs_buffer + ent_end, ext_end - ent_end);
+    }
+}
 
 /**
  * @brief Creates the entry file (.ent) for the given input file.
@@ -6,17 +363,17 @@
  * This function generates a .ent file containing all the entry symbols from the symbol table
  * and their corresponding addresses. The file is named after the input file with a .ent extension.
  *
+ * @param ctx The context of the assembled file.
  * @param input_file_name The name of the original input file (without the .ent extension).
  */
-void createEntFile(const char *input_file_name)
+void createEntFile(struct assembler_context *ctx, const char *input_file_name)
 {
     char *ent_file_name;
     FILE *ent_file;
-    table_ptr find = head_ptr;
-    table_ptr current_entry;
+    struct output_file ent_output;
 
     /* Check if there are entry symbols */
-    if(find_entry(find) == NULL)
+    if(!has_ent_file(ctx))
     {
         return;
     }
@@ -29,7 +386,7 @@ void createEntFile(const char *input_file_name)
     strcat(ent_file_name, ".ent");
 
     /* Open .ent file for writing */
-    ent_file = fopen(ent_file_name, "w");
+    ent_file = open_output_file(&ent_output, ent_file_name, ctx->skip_unchanged, ctx->pipeline);
     if(!ent_file)
     {
         fprintf(stderr, "Could not open the file %s for writing\n", ent_file_name);
@@ -37,22 +394,10 @@ void createEntFile(const char *input_file_name)
         return;
     }
 
-    /* Writing the symbol names and addresses */
-    while ((current_entry = find_entry(find)) != NULL)
-    {
-        find = current_entry->next;
+    write_ent_content(ctx, ent_file);
 
-        /* Write the symbol name and address */
-        fprintf(ent_file, "%s %d", current_entry->symbol_name, current_entry->symbol_address);
-
-        /* Check if this is the last entry */
-        if (find_entry(find) != NULL)
-        {
-            fprintf(ent_file, "\n");
-        }
-    }
-
-    fclose(ent_file);
+    COUNT_STAT(bytes_written[STATS_OUTPUT_ENT], ftell(ent_file));
+    close_output_file(&ent_output);
     free(ent_file_name);
 }
 
@@ -62,19 +407,17 @@ void createEntFile(const char *input_file_name)
  * This function generates a .ext file containing all the external symbols from the symbol table
  * and their usage addresses. The file is named after the input file with a .ext extension.
  *
+ * @param ctx The context of the assembled file, holding the extern usage information.
  * @param input_file_name The name of the original input file (without the .ext extension).
- * @param extern_usage_head_ptr A pointer to the head of the linked list containing extern usage information.
  */
-void createExtFile(const char *input_file_name, extern_addresses_ptr extern_usage_head_ptr)
+void createExtFile(struct assembler_context *ctx, const char *input_file_name)
 {
     char *ext_file_name;
     FILE *ext_file;
-    table_ptr find = head_ptr;
-    extern_addresses_ptr current_extern = extern_usage_head_ptr;
-    int i;
+    struct output_file ext_output;
 
     /* Check if there are extern symbols */
-    if (!find_extern_in_symbol_table(find))
+    if (!has_ext_file(ctx))
     {
         return;
     }
@@ -87,7 +430,7 @@ void createExtFile(const char *input_file_name, extern_addresses_ptr extern_usag
     strcat(ext_file_name, ".ext");
 
     /* Open .ext file for writing */
-    ext_file = fopen(ext_file_name, "w");
+    ext_file = open_output_file(&ext_output, ext_file_name, ctx->skip_unchanged, ctx->pipeline);
     if (!ext_file)
     {
         fprintf(stderr, "Could not open the file %s for writing\n", ext_file_name);
@@ -95,24 +438,12 @@ void createExtFile(const char *input_file_name, extern_addresses_ptr extern_usag
         return;
     }
 
-    /* Writing the symbol names and the addresses they have been used */
-    while (current_extern != NULL)
-    {
-        /* Write each address */
-        for (i = 0; i < current_extern->used_counter; i++)
-        {
-            fprintf(ext_file, "%s\t%04d", current_extern->name, current_extern->used_addresses[i]);
-            /* Avoid adding a newline if it's the last entry */
-            if (current_extern->next != NULL || i < current_extern->used_counter - 1)
-            {
-                fprintf(ext_file, "\n");
-            }
-        }
-        current_extern = current_extern->next;
-    }
+    write_ext_content(ctx, ext_file);
+
+    COUNT_STAT(bytes_written[STATS_OUTPUT_EXT], ftell(ext_file));
 
     /* Clean up */
-    fclose(ext_file);
+    close_output_file(&ext_output);
     free(ext_file_name);
 }
 
@@ -123,14 +454,16 @@ void createExtFile(const char *input_file_name, extern_addresses_ptr extern_usag
  * The file is named after the input file with a .ob extension and includes the number of instructions
  * and directives.
  *
+ * @param ctx The context of the assembled file, holding the machine code.
  * @param input_file_name The name of the original input file (without the .ob extension).
  */
-void createObFile(const char *input_file_name) {
+void createObFile(struct assembler_context *ctx, const char *input_file_name) {
     char *ob_file_name;
     FILE *ob_file;
+    struct output_file ob_output;
 
     /* Check if there is any code  */
-    if((machine_code_ptr->DC == 0) && (machine_code_ptr->IC == 0))
+    if(!has_ob_file(ctx))
     {
         return;
     }
@@ -143,7 +476,7 @@ void createObFile(const char *input_file_name) {
     strcat(ob_file_name, ".ob");
 
     /* Open .ob file for writing */
-    ob_file = fopen(ob_file_name, "w");
+    ob_file = open_output_file(&ob_output, ob_file_name, ctx->skip_unchanged, ctx->pipeline);
     if (!ob_file) 
     {
         fprintf(stderr, "Could not open the file %s for writing\n", ob_file_name);
@@ -151,20 +484,11 @@ void createObFile(const char *input_file_name) {
         return;
     }
 
-    /* Writing the header (number of instructions and number of directive) */
-    if((machine_code_ptr->IC) == 0) 
-    {
-        fprintf(ob_file, "%d\t%d\n", (machine_code_ptr->IC),  (machine_code_ptr->DC));
-    }
-    else 
-    {
-        fprintf(ob_file, "%d\t%d\n", (machine_code_ptr->IC) - 100,  (machine_code_ptr->DC));
-    }
-    /* Writing the code_image */
-    fprint_code_image(machine_code_ptr, ob_file);
-    fprint_data_image(machine_code_ptr, ob_file);
+    write_ob_content(ctx, ob_file);
     
+    COUNT_STAT(bytes_written[STATS_OUTPUT_OB], ftell(ob_file));
+
     /* Clean up */
-    fclose(ob_file);
+    close_output_file(&ob_output);
     free(ob_file_name);
 }
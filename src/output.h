@@ -4,10 +4,44 @@
 #include <stdio.h>
 #include "firstPass.h"
 #include "secondPass.h"
+#include "ioPipeline.h"
+#include "textBuffer.h"
+
+#define OUTPUT_CHUNK_SIZE 4096 /* Size of the chunks compared against an existing output */
+#define TEMP_SUFFIX ".tmp"
+
+/**
+ * @brief Structure representing an output file being written.
+ *
+ * When outputs are only replaced if changed, or written by a pipeline, the content
+ * is collected in buffer and written to the file by close_output_file or the pipeline.
+ */
+struct output_file
+{
+    const char *name;             /* The name of the output file */
+    FILE *file;                   /* The stream the content is written to */
+    char *buffer;                 /* The collected content */
+    size_t size;                  /* The size of the collected content */
+    int skip_unchanged;           /* Whether the existing file is kept if the content is unchanged */
+    struct io_pipeline *pipeline; /* The pipeline writing the file, or NULL */
+};
+
+struct assembler_context; /* Forward declaration of struct assembler_context */
 
 /* Prototypes */
-void createEntFile(const char *input_file_name);
-void createExtFile(const char *input_file_name,  extern_addresses_ptr extern_usage_head_ptr);
-void createObFile(const char *input_file_name);
+FILE *open_output_file(struct output_file *output, const char *file_name, int skip_unchanged, struct io_pipeline *pipeline);
+int write_output_content(const char *file_name, const char *content, size_t size, int skip_unchanged);
+int close_output_file(struct output_file *output);
+int discard_output_file(struct output_file *output);
+void write_ent_content(struct assembler_context *ctx, FILE *file);
+void write_ext_content(struct assembler_context *ctx, FILE *file);
+void write_ob_content(struct assembler_context *ctx, FILE *file);
+int has_ent_file(struct assembler_context *ctx);
+int has_ext_file(struct assembler_context *ctx);
+int has_ob_file(struct assembler_context *ctx);
+void append_output_records(struct assembler_context *ctx, FILE *outputs, char *const *outputs_buffer, struct text_buffer *message);
+void createEntFile(struct assembler_context *ctx, const char *input_file_name);
+void createExtFile(struct assembler_context *ctx, const char *input_file_name);
+void createObFile(struct assembler_context *ctx, const char *input_file_name);
 
 #endif
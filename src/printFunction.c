@@ -24,7 +24,7 @@ void intToOctalString(int n, char *octalStr, int size) {
  * @brief Prints the code image to the specified file.
  *
  * This function writes the code image stored in the translation structure to the specified file.
- * The code image is converted to a 5-digit octal format, and each line contains the address and
+ * The code image is converted to the octal format of the target, and each line contains the address and
  * the corresponding octal code.
  *
  * @param p A pointer to the translation structure containing the code image.
@@ -32,11 +32,11 @@ void intToOctalString(int n, char *octalStr, int size) {
  */
 void fprint_code_image(const translation_ptr p, FILE *file) {
     int i;
-    char octalStr[6];  /* Adjusted to 6 to accommodate 5 octal digits plus the null terminator */
+    char octalStr[TARGET_OCTAL_DIGITS + 1];  /* The octal digits of a word plus the null terminator */
 
-    for (i = 0; i < machine_code_ptr->IC; i++) {
+    for (i = 0; i < p->IC; i++) {
         if (p->code_image[i] != '\0') {
-            intToOctalString(p->code_image[i], octalStr, 5);  /* Using 5 for 5-digit octal */
+            intToOctalString(p->code_image[i], octalStr, TARGET_OCTAL_DIGITS);
             fprintf(file, "%04d %s\n", i, octalStr);
         }
     }
@@ -46,7 +46,7 @@ void fprint_code_image(const translation_ptr p, FILE *file) {
  * @brief Prints the data image to the specified file.
  *
  * This function writes the data image stored in the translation structure to the specified file.
- * The data image is converted to a 5-digit octal format, and each line contains the address and
+ * The data image is converted to the octal format of the target, and each line contains the address and
  * the corresponding octal data. The address is printed with a 4-digit format.
  *
  * @param p A pointer to the translation structure containing the data image.
@@ -54,23 +54,23 @@ void fprint_code_image(const translation_ptr p, FILE *file) {
  */
 void fprint_data_image(const translation_ptr p, FILE *file) {
     int i;
-    char octalStr[6];  /* 5 digits plus the null terminator */
+    char octalStr[TARGET_OCTAL_DIGITS + 1];  /* The octal digits of a word plus the null terminator */
 
-    for (i = 0; i < machine_code_ptr->DC; i++) {
+    for (i = 0; i < p->DC; i++) {
         if ((p->data_image[i] != '\0') || (p->data_image[i] == 0)) {
-            intToOctalString(p->data_image[i], octalStr, 5);  /* Convert to 5-digit octal */
-            if(machine_code_ptr->IC == 0) 
+            intToOctalString(p->data_image[i], octalStr, TARGET_OCTAL_DIGITS);  /* Convert to octal */
+            if(p->IC == 0) 
             {
-                fprintf(file, "%04d %s", i + 100, octalStr);  /* Print the address with 4 digits and octal with 5 digits */
-                if(i < (machine_code_ptr->DC + 100) - 1) 
+                fprintf(file, "%04d %s", i + TARGET_LOAD_BASE, octalStr);  /* Print the address with 4 digits and the word in octal */
+                if(i < (p->DC + TARGET_LOAD_BASE) - 1) 
                 {
                     fprintf(file, "\n");
                 }
             }
             else 
             {
-                fprintf(file, "%04d %s", i + machine_code_ptr->IC, octalStr);  /* Print the address with 4 digits and octal with 5 digits */
-                if(i < machine_code_ptr->DC - 1) 
+                fprintf(file, "%04d %s", i + p->IC, octalStr);  /* Print the address with 4 digits and the word in octal */
+                if(i < p->DC - 1) 
                 {
                     fprintf(file, "\n");
                 }
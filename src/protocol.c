@@ -0,0 +1,226 @@
+#define _POSIX_C_SOURCE 200809L /* read, write */
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "protocol.h"
+
+#define FRAME_READ_CHUNK 4096 /* Size of the chunks a frame is read in */
+
+/**
+ * @brief Writes all the bytes of a buffer, retrying on partial writes.
+ *
+ * @param fd The file descriptor to write to.
+ * @param data The bytes to write.
+ * @param length The number of bytes to write.
+ * @return int Returns 1 on success, otherwise 0.
+ */
+static int write_all(int fd, const char *data, size_t length)
+{
+    ssize_t written;
+
+    while (length > 0)
+    {
+        written = write(fd, data, length);
+        if (written < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (written <= 0)
+        {
+            return 0;
+        }
+        data += written;
+        length -= written;
+    }
+    return 1;
+}
+
+/**
+ * @brief Reads exactly the given number of bytes, retrying on partial reads.
+ *
+ * @param fd The file descriptor to read from.
+ * @param data The buffer the bytes are read into.
+ * @param length The number of bytes to read.
+ * @return size_t The number of bytes read, less than length only at the end of the stream or on an error.
+ */
+static size_t read_all(int fd, char *data, size_t length)
+{
+    size_t total = 0;
+    ssize_t count;
+
+    while (total < length)
+    {
+        count = read(fd, data + total, length - total);
+        if (count < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (count <= 0)
+        {
+            break;
+        }
+        total += count;
+    }
+    return total;
+}
+
+/**
+ * @brief Writes a frame: the length of the data as 4 big endian bytes, then the data.
+ *
+ * @param fd The file descriptor to write to.
+ * @param data The content of the frame.
+ * @param length The number of bytes of the content.
+ * @return int Returns 1 on success, otherwise 0.
+ */
+int write_frame(int fd, const char *data, size_t length)
+{
+    unsigned char header[FRAME_HEADER_SIZE];
+
+    if (length > (size_t)FRAME_MAX_SIZE)
+    {
+        return 0;
+    }
+
+    header[0] = (unsigned char)(length >> 24);
+    header[1] = (unsigned char)(length >> 16);
+    header[2] = (unsigned char)(length >> 8);
+    header[3] = (unsigned char)length;
+
+    return write_all(fd, (const char *)header, FRAME_HEADER_SIZE) && write_all(fd, data, length);
+}
+
+/**
+ * @brief Reads a frame written by write_frame.
+ *
+ * @param fd The file descriptor to read from.
+ * @param frame The buffer the content of the frame replaces.
+ * @return int Returns 1 if a frame was read, 0 at the end of the stream, and -1 on an error or a frame that is too large.
+ */
+int read_frame(int fd, struct text_buffer *frame)
+{
+    unsigned char header[FRAME_HEADER_SIZE];
+    char chunk[FRAME_READ_CHUNK];
+    size_t length, count, header_read;
+
+    clear_text_buffer(frame);
+
+    header_read = read_all(fd, (char *)header, FRAME_HEADER_SIZE);
+    if (header_read == 0)
+    {
+        return 0;
+    }
+    if (header_read < FRAME_HEADER_SIZE)
+    {
+        return -1;
+    }
+
+    length = ((size_t)header[0] << 24) | ((size_t)header[1] << 16) | ((size_t)header[2] << 8) | (size_t)header[3];
+    if (length > (size_t)FRAME_MAX_SIZE)
+    {
+        return -1;
+    }
+
+    while (length > 0)
+    {
+        count = (length < sizeof(chunk)) ? length : sizeof(chunk);
+        if (read_all(fd, chunk, count) != count)
+        {
+            return -1;
+        }
+        append_text(frame, chunk, count);
+        length -= count;
+    }
+
+    /* An empty frame still gets a null terminated text */
+    append_text(frame, "", 0);
+    return 1;
+}
+
+/**
+ * @brief Appends a record to a message: a line with the tag and the length, the data and a new line.
+ *
+ * @param message The message the record is appended to.
+ * @param tag The tag of the record, without spaces.
+ * @param data The data of the record. May be NULL if length is 0.
+ * @param length The number of bytes of the data.
+ */
+void append_record(struct text_buffer *message, const char *tag, const char *data, size_t length)
+{
+    char header[RECORD_TAG_SIZE + 24];
+
+    sprintf(header, "%.*s %lu\n", RECORD_TAG_SIZE - 1, tag, (unsigned long)length);
+    append_text(message, header, strlen(header));
+    if (length > 0)
+    {
+        append_text(message, data, length);
+    }
+    append_text(message, "\n", 1);
+}
+
+/**
+ * @brief Reads the next record of a message.
+ *
+ * @param reader A reader over the message.
+ * @param tag The buffer the tag is copied to, RECORD_TAG_SIZE long.
+ * @param data Pointer to where a pointer to the data, inside the message, is stored.
+ * @param length Pointer to where the number of bytes of the data is stored.
+ * @return int Returns 1 if a record was read, 0 at the end of the message, and -1 if the message is malformed.
+ */
+int read_record(struct text_reader *reader, char *tag, const char **data, size_t *length)
+{
+    const char *start = reader->text + reader->position;
+    size_t left = reader->length - reader->position;
+    size_t i = 0, tag_length;
+    unsigned long value = 0;
+
+    if (left == 0)
+    {
+        return 0;
+    }
+
+    /* The tag, up to the space */
+    while (i < left && start[i] != ' ' && start[i] != '\n')
+    {
+        i++;
+    }
+    tag_length = i;
+    if (i == left || start[i] != ' ' || tag_length == 0 || tag_length >= RECORD_TAG_SIZE)
+    {
+        return -1;
+    }
+
+    /* The length, up to the new line */
+    for (i++; i < left && start[i] >= '0' && start[i] <= '9'; i++)
+    {
+        value = value * 10 + (start[i] - '0');
+        if (value > (unsigned long)FRAME_MAX_SIZE)
+        {
+            return -1;
+        }
+    }
+    if (i == tag_length + 1 || i == left || start[i] != '\n' || left - i - 1 < value + 1 || start[i + 1 + value] != '\n')
+    {
+        return -1;
+    }
+
+    memcpy(tag, start, tag_length);
+    tag[tag_length] = '\0';
+    *data = start + i + 1;
+    *length = value;
+    reader->position += i + 1 + value + 1;
+    return 1;
+}
+
+/**
+ * @brief Checks if the data of a record is exactly the given text.
+ *
+ * @param data The data of the record.
+ * @param length The number of bytes of the data.
+ * @param value The text to compare with.
+ * @return int Returns 1 if they are equal, otherwise 0.
+ */
+int record_equals(const char *data, size_t length, const char *value)
+{
+    return strlen(value) == length && memcmp(data, value, length) == 0;
+}
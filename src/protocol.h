@@ -0,0 +1,37 @@
+#ifndef PROTOCOL_H
+#define PROTOCOL_H
+
+#include <stddef.h>
+#include "textBuffer.h"
+
+#define FRAME_HEADER_SIZE 4                  /* Big endian length before every frame */
+#define FRAME_MAX_SIZE (64L * 1024L * 1024L) /* Larger frames are rejected */
+#define RECORD_TAG_SIZE 32                   /* Maximum size of a record tag, including the null terminator */
+
+/* Request records */
+#define RECORD_PATH "path"                     /* Assemble the file path.as, like the command line does */
+#define RECORD_SOURCE "source"                 /* Assemble this source and return the outputs */
+#define RECORD_NAME "name"                     /* Name of an inline source, used in the diagnostics */
+#define RECORD_MEM_SIZE "mem-size"             /* Same as --mem-size */
+#define RECORD_SKIP_UNCHANGED "skip-unchanged" /* Same as --skip-unchanged */
+#define RECORD_SHUTDOWN "shutdown"             /* Stop the server */
+
+/* Response records */
+#define RECORD_STATUS "status"           /* STATUS_OK, STATUS_FAILED or STATUS_INVALID */
+#define RECORD_DIAGNOSTICS "diagnostics" /* The errors, as the assembler prints them */
+#define RECORD_OB "ob"                   /* Content of the .ob file */
+#define RECORD_ENT "ent"                 /* Content of the .ent file */
+#define RECORD_EXT "ext"                 /* Content of the .ext file */
+
+#define STATUS_OK "ok"
+#define STATUS_FAILED "failed"
+#define STATUS_INVALID "invalid"
+
+/* Prototypes */
+int write_frame(int fd, const char *data, size_t length);
+int read_frame(int fd, struct text_buffer *frame);
+void append_record(struct text_buffer *message, const char *tag, const char *data, size_t length);
+int read_record(struct text_reader *reader, char *tag, const char **data, size_t *length);
+int record_equals(const char *data, size_t length, const char *value);
+
+#endif
@@ -1,4 +1,6 @@
+#define ALLOC_CATEGORY ALLOC_PARSER /* Allocations counted by TRACK_ALLOCATIONS builds */
 #include "secondPass.h"
+#include "assemblerContext.h"
 
 /**
  * @brief Performs the second pass over the assembly file, processing instructions and tracking external symbol usage.
@@ -6,30 +8,33 @@
  * This function processes the given assembly file in the second pass. It calculates the number of words needed
  * for instructions, codes the instructions into the code image, and tracks the usage of external symbols.
  * If an error occurs (such as exceeding the maximum memory size or using undefined symbols), it will set
- * an error flag and return NULL. The function also updates the `extern_usage_head_ptr` with external symbol usage.
+ * the error flag. The function also records every usage of an external symbol in the context.
  *
+ * @param ctx The context of the file: its pre-processed text, symbol table, machine code and external symbols usage list.
  * @param file_name The name of the assembly file being processed.
- * @param file A pointer to the file stream of the assembly file.
- * @param extern_usage_head_ptr A pointer to the head of the external symbols usage list.
- * @param err_flag A pointer to an integer that will be set to 1 if any errors are encountered.
- * @return A pointer to the updated external symbols usage list, or NULL if an error occurs.
+ * @return An integer error flag: 0 if no errors occurred, 1 if errors were detected.
  */
-extern_addresses_ptr secondPass(char *file_name, FILE *file, extern_addresses_ptr extern_usage_head_ptr, int *err_flag)
+int secondPass(struct assembler_context *ctx, const char *file_name)
 {
     /* Declarations */
+    translation_ptr machine_code_ptr = &ctx->machine_code; /* Pointer to the machine code structure */
+    table_ptr found = NULL; /* Recive the address of the symbol inside the table*/
     int error_flag = 0;
     int skip_to_next_line; /* Indicate that the current line should be skipped if an error occurs */
     int am_line_counter = 1; /* After macro line counter */
     int L; /* Words counter */
     int i;
     int two_op_reg; /* Flag that indicates if the there are 2 operands of type register*/
+    int word; /* The word being coded */
     char line[MAX_LINE_LENGTH] = {0}; /* The line muber of the source file after macro */
-    extern_addresses_ptr extern_ptr = extern_usage_head_ptr;
     struct ast answer_line = {0};
+    int line_index;
     machine_code_ptr->IC = 0; /* Restart inst counter */
-    
-    while (fgets(line, MAX_LINE_LENGTH, file))
+
+    /* The first pass found the lines of the am text */
+    for (line_index = 0; line_index < ctx->am_lines.lines_counter; line_index++)
     {
+        copy_line(&ctx->am_lines.lines[line_index], line, MAX_LINE_LENGTH);
         answer_line = get_ast_from_line(line, NULL);
         two_op_reg = 0;
         L = 1;
@@ -38,38 +43,22 @@ extern_addresses_ptr secondPass(char *file_name, FILE *file, extern_addresses_pt
         /* Calculate words and code the code into code_image */
         if (answer_line.ast_type == ast_inst)
         {
-            /* Calculate words */
-            for (i = 0; i < 2; i++)
-            {
-                if (answer_line.ast_options.inst.operands[i].operand_type != ast_none)
-                {
-                    L++;
-                }
-                /* if there are 2 operands both registers */
-                if (L == 3)
-                {
-                    if (((answer_line.ast_options.inst.operands[0].operand_type == ast_register_direct) || (answer_line.ast_options.inst.operands[0].operand_type == ast_register_address)) &&
-                        ((answer_line.ast_options.inst.operands[1].operand_type == ast_register_direct) || (answer_line.ast_options.inst.operands[1].operand_type == ast_register_address)))
-                    {
-                        two_op_reg = 1;
-                        L--;
-                    }
-                }
-            }
+            /* Calculate words, the target decides if two register operands share a word */
+            L = TARGET_INSTRUCTION_WORDS(answer_line.ast_options.inst.operands[0].operand_type, answer_line.ast_options.inst.operands[1].operand_type);
+            two_op_reg = (L == 2 && answer_line.ast_options.inst.operands[1].operand_type != ast_none);
 
             /* Check that the program has not reached maximum memmory size */
-            if (((machine_code_ptr->DC) + (machine_code_ptr->IC) + L - 100) > MAX_MEM_SIZE)
+            if (((machine_code_ptr->DC) + (machine_code_ptr->IC) + L - TARGET_LOAD_BASE) > machine_code_ptr->mem_size)
             {
                 error_flag = 1;
-                printf("Error: the program has reached maximum memmory size allowed.\n ");
-                *err_flag = error_flag;
-                return NULL;
+                report_error(&ctx->errors, ERROR_MEMORY_FULL, file_name, am_line_counter, NULL);
+                return error_flag;
             }
 
             /* Initialize IC if needed */
             if (machine_code_ptr->IC == 0)
             {
-                machine_code_ptr->IC = 100;
+                machine_code_ptr->IC = TARGET_LOAD_BASE;
             }
 
             /* Initialzie the extern_usage struct and checks if there is a label that been used without a declaration*/
@@ -79,48 +68,24 @@ extern_addresses_ptr secondPass(char *file_name, FILE *file, extern_addresses_pt
                 {
                     if(answer_line.ast_options.inst.operands[i].operand_type == ast_label) 
                     {
-                        found = symbol_search(head_ptr, answer_line.ast_options.inst.operands[i].operand_option.label);
+                        found = symbol_search(ctx->symbol_table, answer_line.ast_options.inst.operands[i].operand_option.label);
                         if(found) 
                         {
+                            /* Record the usage of the external symbol, in order of use */
                             if (found->symbol_type == extern_symbol) 
                             {
-                                extern_ptr = find_extern(extern_ptr, answer_line.ast_options.inst.operands[i].operand_option.label);
-                                if (extern_ptr)
-                                {
-                                    /* Assign addresses */
-                                    if (i == 0) 
-                                    {
-                                        extern_ptr->used_addresses[extern_ptr->used_counter] = (machine_code_ptr->IC) + 1;
-                                    }
-                                    else 
-                                    {
-                                        extern_ptr->used_addresses[extern_ptr->used_counter] = (machine_code_ptr->IC) + 2;
-                                    }
-                                    /* Increasing the used counter */
-                                    (extern_ptr->used_counter)++;
-                                }
-
-                                /* Adding a new extern symbol for a symbol that has been used for the first time */
-                                else 
-                                {
-                                    if(i == 0)
-                                    {
-                                        add_symbol_to_extern_usage(answer_line.ast_options.inst.operands[i].operand_option.label, (machine_code_ptr->IC) + 1, &extern_usage_head_ptr);
-                                    }
-                                    else 
-                                    {
-                                        add_symbol_to_extern_usage(answer_line.ast_options.inst.operands[i].operand_option.label, (machine_code_ptr->IC) + 2, &extern_usage_head_ptr);
-
-                                    }
-                                }
+                                add_symbol_to_extern_usage(answer_line.ast_options.inst.operands[i].operand_option.label, (machine_code_ptr->IC) + 1 + i, &ctx->extern_usage, &ctx->extern_pool);
                             }
 
                         }
                         else /* there is a usage of a label and it is not defiend */
                         {
-                            printf("Error: In file %s at line %d the symbol %s has been never defined.\n", file_name, am_line_counter, answer_line.ast_options.inst.operands[i].operand_option.label);
                             error_flag = 1;
-                            skip_to_next_line = 1; 
+                            skip_to_next_line = 1;
+                            if (report_error(&ctx->errors, ERROR_UNDEFINED, file_name, am_line_counter, answer_line.ast_options.inst.operands[i].operand_option.label))
+                            {
+                                return error_flag;
+                            }
                         }
                     }
                 }
@@ -131,13 +96,13 @@ extern_addresses_ptr secondPass(char *file_name, FILE *file, extern_addresses_pt
             }
 
             /* Code the first word inside of code_image */
-            machine_code_ptr->code_image[machine_code_ptr->IC] = 1 << A; /* A,R,E */
+            word = 1 << A; /* A,R,E */
 
             /* Destination operand and source operand*/
             if (L == 3)
             {
-                machine_code_ptr->code_image[machine_code_ptr->IC] |= (1 << (3 + answer_line.ast_options.inst.operands[1].operand_type)); /* Destenation operand */
-                machine_code_ptr->code_image[machine_code_ptr->IC] |= (1 << (7 + answer_line.ast_options.inst.operands[0].operand_type)); /* Source opernand*/
+                word |= (1 << (TARGET_DEST_MODE_SHIFT + answer_line.ast_options.inst.operands[1].operand_type)); /* Destenation operand */
+                word |= (1 << (TARGET_SOURCE_MODE_SHIFT + answer_line.ast_options.inst.operands[0].operand_type)); /* Source opernand*/
             }
             /* Only destination operand or 2 registers operands*/
             else if (L == 2)
@@ -145,48 +110,49 @@ extern_addresses_ptr secondPass(char *file_name, FILE *file, extern_addresses_pt
                 /* 2 operands both registers */
                 if (two_op_reg)
                 {
-                    machine_code_ptr->code_image[machine_code_ptr->IC] |= (1 << (3 + answer_line.ast_options.inst.operands[1].operand_type)); /* Destenation operand */
-                    machine_code_ptr->code_image[machine_code_ptr->IC] |= (1 << (7 + answer_line.ast_options.inst.operands[0].operand_type)); /* Source opernand*/
+                    word |= (1 << (TARGET_DEST_MODE_SHIFT + answer_line.ast_options.inst.operands[1].operand_type)); /* Destenation operand */
+                    word |= (1 << (TARGET_SOURCE_MODE_SHIFT + answer_line.ast_options.inst.operands[0].operand_type)); /* Source opernand*/
                 }
                 /* Only destination */
                 else
                 {
-                    machine_code_ptr->code_image[machine_code_ptr->IC] |= (1 << (3 + answer_line.ast_options.inst.operands[0].operand_type)); /* Destenation operand */
+                    word |= (1 << (TARGET_DEST_MODE_SHIFT + answer_line.ast_options.inst.operands[0].operand_type)); /* Destenation operand */
                 }
             }
 
             /* Opcode */
-            machine_code_ptr->code_image[machine_code_ptr->IC] |= answer_line.ast_options.inst.inst_type << 11;
+            word |= TARGET_OPCODE(answer_line.ast_options.inst.inst_type) << TARGET_OPCODE_SHIFT;
+            store_code_word(machine_code_ptr, machine_code_ptr->IC, word);
             (machine_code_ptr->IC)++;
 
             /* Code the second and third word*/
             if (L == 3)
             {
                 /* If there are 2 operands and at least one of them is not register */
-                codeWords(L, answer_line, &error_flag, file_name, am_line_counter);
+                codeWords(ctx, L, answer_line, &error_flag, file_name, am_line_counter);
             }
             else if (L == 2)
             { /* If there is only one operand or two register operands */
                 /* Two register operands*/
                 if (two_op_reg)
                 {
-                    machine_code_ptr->code_image[machine_code_ptr->IC] = 1 << A;
-                    machine_code_ptr->code_image[machine_code_ptr->IC] |= answer_line.ast_options.inst.operands[1].operand_option.reg << 3; /* Destination reg num*/
-                    machine_code_ptr->code_image[machine_code_ptr->IC] |= answer_line.ast_options.inst.operands[0].operand_option.reg << 6; /* Source reg num*/
+                    word = 1 << A;
+                    word |= answer_line.ast_options.inst.operands[1].operand_option.reg << TARGET_OPERAND_SHIFT; /* Destination reg num*/
+                    word |= answer_line.ast_options.inst.operands[0].operand_option.reg << TARGET_SOURCE_REGISTER_SHIFT; /* Source reg num*/
+                    store_code_word(machine_code_ptr, machine_code_ptr->IC, word);
                     (machine_code_ptr->IC)++;                                                                                               /* Move to next IC */
                 }
                 /* Only destination operand*/
                 else
                 {
-                    codeWords(L, answer_line, &error_flag, file_name, am_line_counter);
+                    codeWords(ctx, L, answer_line, &error_flag, file_name, am_line_counter);
                 }
             }
         }
 
         am_line_counter++;
     }
-    *err_flag = error_flag;
-    return extern_usage_head_ptr;
+    return error_flag;
 }
 
 
@@ -197,16 +163,20 @@ extern_addresses_ptr secondPass(char *file_name, FILE *file, extern_addresses_pt
  * (immediate, label, or register). The function adjusts the bit positions based on the type of operand and
  * the number of words being encoded. If an error occurs during encoding, the error flag is set.
  *
+ * @param ctx The context of the file: its symbol table and machine code.
  * @param num_of_words The number of words to encode (usually 2 or 3).
  * @param a The abstract syntax tree (AST) node representing the instruction to encode.
  * @param flag A pointer to an integer that will be set to 1 if any errors are encountered.
  * @param name_of_file The name of the assembly file being processed.
  * @param current_am_line The current line number in the assembly file after macro expansion.
  */
-void codeWords(int num_of_words, struct ast a, int *flag, const char *name_of_file, int current_am_line)
+void codeWords(struct assembler_context *ctx, int num_of_words, struct ast a, int *flag, const char *name_of_file, int current_am_line)
 {
+    translation_ptr machine_code_ptr = &ctx->machine_code;
+    table_ptr found;
     int i;
     int val;
+    int word;
 
     for (i = 0; i < num_of_words - 1; i++, (machine_code_ptr->IC)++) 
     {
@@ -214,40 +184,50 @@ void codeWords(int num_of_words, struct ast a, int *flag, const char *name_of_fi
         /* Checking how much to move the bits */
         if((i == 0 && (num_of_words == 2)) || (i == 1) || (a.ast_options.inst.operands[i].operand_type == ast_immidiate || (a.ast_options.inst.operands[i].operand_type == ast_label))) 
         {
-            val = 3;
+            val = TARGET_OPERAND_SHIFT;
         }
         else 
         {
-            val = 6;
+            val = TARGET_SOURCE_REGISTER_SHIFT;
         }
         /* If the addressing method is immidiate */
         if (a.ast_options.inst.operands[i].operand_type == ast_immidiate)
         {
-            machine_code_ptr->code_image[machine_code_ptr->IC] = 1 << A; /* A,R,E */
-            machine_code_ptr->code_image[machine_code_ptr->IC] |= a.ast_options.inst.operands[i].operand_option.immed << val; /* Operand */
+            word = 1 << A; /* A,R,E */
+            word |= a.ast_options.inst.operands[i].operand_option.immed << val; /* Operand */
         }
 
         /* If the addressing method is label*/
         else if (a.ast_options.inst.operands[i].operand_type == ast_label)
         {
-            found = symbol_search(head_ptr, a.ast_options.inst.operands[i].operand_option.label);
+            found = symbol_search(ctx->symbol_table, a.ast_options.inst.operands[i].operand_option.label);
             if (found->symbol_type == extern_symbol)
             {
-                machine_code_ptr->code_image[machine_code_ptr->IC] = 1 << E; /* A,R,E */
+                word = 1 << E; /* A,R,E */
             }
             else
             {
-                machine_code_ptr -> code_image[machine_code_ptr->IC] = 1 << R; /* A,R,E */
+                word = 1 << R; /* A,R,E */
+            }
+            if (found->symbol_address >= TARGET_ADDRESS_SPACE) /* The address would wrap in the operand */
+            {
+                *flag = 1;
+                report_error(&ctx->errors, ERROR_ADDRESS_RANGE, name_of_file, current_am_line, found->symbol_name);
             }
-            machine_code_ptr -> code_image[machine_code_ptr->IC] |= found -> symbol_address << val; /*Address of the label*/
+            word |= found -> symbol_address << val; /*Address of the label*/
         }
 
         /* If the addressing method is register_address or register_direct*/
         else if ((a.ast_options.inst.operands[i].operand_type == ast_register_address) || (a.ast_options.inst.operands[i].operand_type == ast_register_direct)) 
         {
-            machine_code_ptr->code_image[machine_code_ptr->IC] = 1 << A; /* A,R,E */
-            machine_code_ptr->code_image[machine_code_ptr->IC] |= a.ast_options.inst.operands[i].operand_option.reg << val; /* Register number */
+            word = 1 << A; /* A,R,E */
+            word |= a.ast_options.inst.operands[i].operand_option.reg << val; /* Register number */
         }
+        else
+        {
+            continue;
+        }
+        store_code_word(machine_code_ptr, machine_code_ptr->IC, word);
     }
 }
 
@@ -255,27 +235,19 @@ void codeWords(int num_of_words, struct ast a, int *flag, const char *name_of_fi
  * @brief Frees the memory allocated for the external symbols usage list.
  *
  * This function iterates through the external symbols usage list and frees the memory allocated
- * for each node. It also resets the symbol names and usage addresses within each node to ensure
- * proper cleanup.
+ * for each node, setting the head pointer to NULL once the list is empty.
  *
  * @param head A pointer to the head of the external symbols usage list.
  */
-void free_extern_table(extern_addresses_ptr head){
-    int i;
-    extern_addresses_ptr current = head;
+void free_extern_table(extern_addresses_ptr *head){
+    extern_addresses_ptr current = *head;
     extern_addresses_ptr next;
 
     while (current != NULL) {
         next = current->next;
-        current->name[0] = '\0';
-        for(i = 0; i < current->used_counter; i++) {
-            current->used_addresses[i] = 0;
-        }
-        current->used_counter = 0;
-        free(current->next);
-        current->next = NULL;
+        free(current);
         current = next;
     }
 
-    head = NULL;
+    *head = NULL;
 }
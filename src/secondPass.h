@@ -3,13 +3,13 @@
 
 #include "firstPass.h"
 
-#define A 2
-#define R 1
-#define E 0
+#define A TARGET_ARE_ABSOLUTE
+#define R TARGET_ARE_RELOCATABLE
+#define E TARGET_ARE_EXTERNAL
 
 /* Prototypes */
-extern_addresses_ptr secondPass(char *file_name, FILE *file, extern_addresses_ptr extern_usage_head_ptr, int *err_flag);
-void codeWords(int num_of_words, struct ast a, int *flag, const char *name_of_file, int current_am_line);
-void free_extern_table(extern_addresses_ptr head);
+int secondPass(struct assembler_context *ctx, const char *file_name);
+void codeWords(struct assembler_context *ctx, int num_of_words, struct ast a, int *flag, const char *name_of_file, int current_am_line);
+void free_extern_table(extern_addresses_ptr *head);
 
 #endif
@@ -0,0 +1,587 @@
+#define _POSIX_C_SOURCE 200809L /* sockets, open_memstream */
+#include <errno.h>
+#include <signal.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "server.h"
+#include "assemblerContext.h"
+#include "assemblerLib.h"
+#include "macroProcessing.h"
+#include "output.h"
+#include "protocol.h"
+#include "threadPool.h"
+
+#define NUMBER_SIZE 16     /* Size of a buffer holding a decimal int */
+#define CLIENT_CWD_SIZE 4096 /* Size of the buffer holding the working directory of the client */
+
+/**
+ * @brief State of a server worker. Everything is reused between requests,
+ * so a warm worker does not allocate memory for requests like the ones it already served.
+ */
+struct server_worker
+{
+    assembler_context ctx;       /* The context the requests are assembled with */
+    FILE *diagnostics;           /* Memory stream the errors of a request are written to */
+    char *diagnostics_buffer;    /* The buffer of the diagnostics stream */
+    size_t diagnostics_size;     /* The size of the diagnostics stream */
+    FILE *outputs;               /* Memory stream the output files of an inline source are written to */
+    char *outputs_buffer;        /* The buffer of the outputs stream */
+    size_t outputs_size;         /* The size of the outputs stream */
+    struct text_buffer request;  /* The frame of the current request */
+    struct text_buffer response; /* The frame of the current response */
+    struct text_buffer name;     /* The name and the path of the current request, each null terminated */
+};
+
+/**
+ * @brief State shared by all the server workers.
+ */
+struct server
+{
+    const struct assembler_options *options; /* The command line options, the defaults of every request */
+    int listen_fd;                           /* The listening socket */
+    pthread_mutex_t lock;                    /* Protects stopping */
+    int stopping;                            /* Set once a shutdown request was received */
+    struct server_worker *workers;           /* One worker per job */
+    struct build_cache cache;                /* The build cache of path requests, when --cache is given */
+};
+
+/**
+ * @brief The records of a request.
+ */
+struct server_request
+{
+    const char *path;      /* The file to assemble, without the .as extension */
+    size_t path_length;
+    const char *source;    /* The inline source to assemble */
+    size_t source_length;
+    const char *name;      /* The name used in the errors */
+    size_t name_length;
+    int mem_size;          /* Maximum number of words the program may occupy */
+    int skip_unchanged;    /* Only replace output files whose content changed */
+    int shutdown;          /* Stop the server */
+};
+
+/**
+ * @brief Parses the records of a request.
+ *
+ * @param frame The request frame.
+ * @param request The structure the request is parsed into. The defaults must already be set.
+ * @return int Returns 1 if the request is valid, otherwise 0.
+ */
+static int parse_request(const struct text_buffer *frame, struct server_request *request)
+{
+    struct text_reader reader;
+    char tag[RECORD_TAG_SIZE];
+    char number[NUMBER_SIZE];
+    const char *data;
+    size_t length;
+    int result;
+
+    init_text_reader(&reader, frame->text, frame->length);
+    while ((result = read_record(&reader, tag, &data, &length)) == 1)
+    {
+        if (strcmp(tag, RECORD_PATH) == 0)
+        {
+            request->path = data;
+            request->path_length = length;
+        }
+        else if (strcmp(tag, RECORD_SOURCE) == 0)
+        {
+            request->source = data;
+            request->source_length = length;
+        }
+        else if (strcmp(tag, RECORD_NAME) == 0)
+        {
+            request->name = data;
+            request->name_length = length;
+        }
+        else if (strcmp(tag, RECORD_MEM_SIZE) == 0)
+        {
+            if (length >= NUMBER_SIZE)
+            {
+                return 0;
+            }
+            memcpy(number, data, length);
+            number[length] = '\0';
+            if (!parse_positive_number(number, &request->mem_size) || request->mem_size > MAX_MEM_SIZE)
+            {
+                return 0;
+            }
+        }
+        else if (strcmp(tag, RECORD_SKIP_UNCHANGED) == 0)
+        {
+            request->skip_unchanged = 1;
+        }
+        else if (strcmp(tag, RECORD_SHUTDOWN) == 0)
+        {
+            request->shutdown = 1;
+        }
+        /* Unknown records are ignored, so newer clients keep working */
+    }
+
+    /* Exactly one of a path or a source, unless the server is stopped */
+    return result == 0 && (request->shutdown || ((request->path != NULL) != (request->source != NULL)));
+}
+
+/**
+ * @brief Assembles an inline source and appends the content of its output files to the response.
+ *
+ * @param worker The worker serving the request.
+ * @param request The request.
+ * @return int Returns 1 if the source was assembled, otherwise 0.
+ */
+static int assemble_inline(struct server_worker *worker, const struct server_request *request)
+{
+    context_ptr ctx = &worker->ctx;
+    int result;
+
+    result = expand_macros(ctx, request->source, request->source_length);
+    if (result != 0)
+    {
+        print_macro_error(result, ctx->diagnostics);
+        return 0;
+    }
+    if (!assemble_text(ctx, worker->name.text))
+    {
+        return 0;
+    }
+
+    append_output_records(ctx, worker->outputs, &worker->outputs_buffer, &worker->response);
+    return 1;
+}
+
+/**
+ * @brief Serves a single request and builds its response.
+ *
+ * @param server The server.
+ * @param worker The worker serving the request.
+ * @return int Returns 0 if the request stops the server, otherwise 1.
+ */
+static int handle_request(struct server *server, struct server_worker *worker)
+{
+    context_ptr ctx = &worker->ctx;
+    struct server_request request = {0};
+    const char *status = STATUS_OK;
+    FILE *as_file;
+    char *path;
+    size_t name_length;
+    long diagnostics_length;
+
+    request.mem_size = server->options->mem_size;
+    request.skip_unchanged = server->options->skip_unchanged;
+
+    clear_text_buffer(&worker->response);
+    if (!parse_request(&worker->request, &request))
+    {
+        append_record(&worker->response, RECORD_STATUS, STATUS_INVALID, strlen(STATUS_INVALID));
+        return 1;
+    }
+    if (request.shutdown)
+    {
+        append_record(&worker->response, RECORD_STATUS, STATUS_OK, strlen(STATUS_OK));
+        return 0;
+    }
+
+    ctx->machine_code.mem_size = request.mem_size;
+    ctx->skip_unchanged = request.skip_unchanged;
+    rewind(worker->diagnostics);
+    clear_text_buffer(&worker->name);
+
+    if (request.path != NULL)
+    {
+        /* The name of the request, when given, is the name used in the errors */
+        if (request.name != NULL)
+        {
+            append_text(&worker->name, request.name, request.name_length);
+            append_text(&worker->name, "", 1);
+        }
+        name_length = worker->name.length;
+
+        /* Check the source exists first, a missing file must not stop the server */
+        append_text(&worker->name, request.path, request.path_length);
+        append_text(&worker->name, ".as", 3);
+        path = worker->name.text + name_length; /* The text may move while it grows */
+        as_file = fopen(path, "r");
+        worker->name.text[name_length + request.path_length] = '\0';
+
+        if (as_file == NULL)
+        {
+            fprintf(ctx->diagnostics, "Error: Unable to open the file %s.as\n", (request.name != NULL) ? worker->name.text : path);
+            status = STATUS_FAILED;
+        }
+        else
+        {
+            fclose(as_file);
+            if (!assemble_file(ctx, path, (request.name != NULL) ? worker->name.text : NULL))
+            {
+                status = STATUS_FAILED;
+            }
+        }
+    }
+    else
+    {
+        if (request.name != NULL)
+        {
+            append_text(&worker->name, request.name, request.name_length);
+        }
+        else
+        {
+            append_text(&worker->name, ASM_DEFAULT_NAME, strlen(ASM_DEFAULT_NAME));
+        }
+        if (!assemble_inline(worker, &request))
+        {
+            status = STATUS_FAILED;
+        }
+        reset_context(ctx);
+    }
+
+    fflush(worker->diagnostics);
+    diagnostics_length = ftell(worker->diagnostics);
+    append_record(&worker->response, RECORD_STATUS, status, strlen(status));
+    append_record(&worker->response, RECORD_DIAGNOSTICS, worker->diagnostics_buffer, diagnostics_length);
+    return 1;
+}
+
+/**
+ * @brief Stops the server: no new connection is accepted by any worker.
+ *
+ * @param server The server.
+ */
+static void stop_server(struct server *server)
+{
+    pthread_mutex_lock(&server->lock);
+    if (!server->stopping)
+    {
+        server->stopping = 1;
+        shutdown(server->listen_fd, SHUT_RDWR); /* Wakes up the workers waiting in accept */
+    }
+    pthread_mutex_unlock(&server->lock);
+}
+
+/**
+ * @brief Checks if the server is stopping.
+ *
+ * @param server The server.
+ * @return int Returns 1 if a shutdown request was received, otherwise 0.
+ */
+static int is_stopping(struct server *server)
+{
+    int stopping;
+
+    pthread_mutex_lock(&server->lock);
+    stopping = server->stopping;
+    pthread_mutex_unlock(&server->lock);
+    return stopping;
+}
+
+/**
+ * @brief Serves the requests of a connection until the client closes it.
+ *
+ * @param server The server.
+ * @param worker The worker serving the connection.
+ * @param fd The connected socket.
+ */
+static void serve_connection(struct server *server, struct server_worker *worker, int fd)
+{
+    int keep_running;
+
+    while (read_frame(fd, &worker->request) == 1)
+    {
+        keep_running = handle_request(server, worker);
+        if (!write_frame(fd, worker->response.text, worker->response.length))
+        {
+            break;
+        }
+        if (!keep_running)
+        {
+            stop_server(server);
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Worker loop: accepts connections and serves them until the server stops.
+ *
+ * @param job_index The index of the worker.
+ * @param worker_index Unused.
+ * @param arg Pointer to the server.
+ */
+static void serve_worker(int job_index, int worker_index, void *arg)
+{
+    struct server *server = (struct server *)arg;
+    struct server_worker *worker = &server->workers[job_index];
+    int fd;
+
+    while (!is_stopping(server))
+    {
+        fd = accept(server->listen_fd, NULL, NULL);
+        if (fd < 0)
+        {
+            if (errno == EINTR || errno == ECONNABORTED)
+            {
+                continue;
+            }
+            break;
+        }
+        serve_connection(server, worker, fd);
+        close(fd);
+    }
+}
+
+/**
+ * @brief Fills the address of a Unix socket.
+ *
+ * @param address The address to fill.
+ * @param path The path of the socket.
+ * @return int Returns 1 on success, 0 if the path is too long.
+ */
+static int socket_address(struct sockaddr_un *address, const char *path)
+{
+    memset(address, 0, sizeof(struct sockaddr_un));
+    address->sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(address->sun_path))
+    {
+        printf("Error: The socket path %s is too long\n", path);
+        return 0;
+    }
+    strcpy(address->sun_path, path);
+    return 1;
+}
+
+/**
+ * @brief Runs the assembler as a server on a Unix socket until a shutdown request.
+ *
+ * Every request is one frame of records (see protocol.h). It either names a file,
+ * which is assembled as if it were given on the command line, or holds an inline
+ * source, whose output files are returned in the response. One worker is started per job,
+ * each with its own warm context. With --cache, the workers share a build cache for
+ * path requests.
+ *
+ * @param options The command line options. serve_path is the socket path and jobs the number of workers.
+ * @return int Returns 0 on a clean shutdown, otherwise 1.
+ */
+int run_server(const struct assembler_options *options)
+{
+    struct server server;
+    struct sockaddr_un address;
+    struct server_worker *worker;
+    int i;
+
+    if (!socket_address(&address, options->serve_path))
+    {
+        return 1;
+    }
+
+    signal(SIGPIPE, SIG_IGN); /* A client that goes away must not stop the server */
+    if (options->cache_dir != NULL && !init_build_cache(&server.cache, options->cache_dir, options->cache_size))
+    {
+        return 1;
+    }
+
+    server.options = options;
+    server.stopping = 0;
+    server.listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    unlink(options->serve_path); /* Remove the socket of a previous server */
+    if (server.listen_fd < 0 ||
+        bind(server.listen_fd, (struct sockaddr *)&address, sizeof(address)) != 0 ||
+        listen(server.listen_fd, SERVER_BACKLOG) != 0)
+    {
+        printf("Error: Unable to listen on %s\n", options->serve_path);
+        if (server.listen_fd >= 0)
+        {
+            close(server.listen_fd);
+        }
+        if (options->cache_dir != NULL)
+        {
+            release_build_cache(&server.cache);
+        }
+        return 1;
+    }
+
+    pthread_mutex_init(&server.lock, NULL);
+    server.workers = (struct server_worker *)allocateMemory(options->jobs, sizeof(struct server_worker), CALLOC_ID);
+    for (i = 0; i < options->jobs; i++)
+    {
+        worker = &server.workers[i];
+        worker->diagnostics = open_memstream(&worker->diagnostics_buffer, &worker->diagnostics_size);
+        worker->outputs = open_memstream(&worker->outputs_buffer, &worker->outputs_size);
+        if (worker->diagnostics == NULL || worker->outputs == NULL)
+        {
+            failureExit("Memory allocation failed");
+        }
+        init_context(&worker->ctx, options, worker->diagnostics);
+        if (options->cache_dir != NULL)
+        {
+            worker->ctx.cache = &server.cache;
+        }
+        init_text_buffer(&worker->request);
+        init_text_buffer(&worker->response);
+        init_text_buffer(&worker->name);
+    }
+
+    run_jobs(options->jobs, options->jobs, serve_worker, NULL, &server);
+
+    for (i = 0; i < options->jobs; i++)
+    {
+        worker = &server.workers[i];
+        release_context(&worker->ctx);
+        fclose(worker->diagnostics);
+        free(worker->diagnostics_buffer);
+        fclose(worker->outputs);
+        free(worker->outputs_buffer);
+        release_text_buffer(&worker->request);
+        release_text_buffer(&worker->response);
+        release_text_buffer(&worker->name);
+    }
+    free(server.workers);
+    pthread_mutex_destroy(&server.lock);
+    if (options->cache_dir != NULL)
+    {
+        evict_build_cache(&server.cache);
+        if (options->cache_stats)
+        {
+            print_cache_stats(&server.cache, stderr);
+        }
+        release_build_cache(&server.cache);
+    }
+    close(server.listen_fd);
+    unlink(options->serve_path);
+    return 0;
+}
+
+/**
+ * @brief Sends a request to the server and waits for its response.
+ *
+ * @param fd The connected socket.
+ * @param request The request frame.
+ * @param response The buffer the response frame is read into.
+ * @return int Returns 1 on success, otherwise 0.
+ */
+static int send_request(int fd, const struct text_buffer *request, struct text_buffer *response)
+{
+    return write_frame(fd, request->text, request->length) && read_frame(fd, response) == 1;
+}
+
+/**
+ * @brief Prints the diagnostics of a response and returns whether it succeeded.
+ *
+ * @param response The response frame.
+ * @return int Returns 1 if the status of the response is ok, otherwise 0.
+ */
+static int print_response(const struct text_buffer *response)
+{
+    struct text_reader reader;
+    char tag[RECORD_TAG_SIZE];
+    const char *data;
+    size_t length;
+    int success = 0;
+
+    init_text_reader(&reader, response->text, response->length);
+    while (read_record(&reader, tag, &data, &length) == 1)
+    {
+        if (strcmp(tag, RECORD_STATUS) == 0)
+        {
+            success = record_equals(data, length, STATUS_OK);
+        }
+        else if (strcmp(tag, RECORD_DIAGNOSTICS) == 0)
+        {
+            fwrite(data, 1, length, stdout);
+        }
+    }
+    return success;
+}
+
+/**
+ * @brief Runs the assembler as a client of a server started with --serve.
+ *
+ * Every input file is sent to the server, which assembles it exactly like the
+ * command line would. The diagnostics are printed in argument order.
+ *
+ * @param options The command line options. client_path is the socket path.
+ * @return int Returns 0 if every file was assembled without errors, otherwise 1.
+ */
+int run_client(const struct assembler_options *options)
+{
+    struct sockaddr_un address;
+    struct text_buffer request, response, path;
+    char cwd[CLIENT_CWD_SIZE];
+    char number[NUMBER_SIZE];
+    int fd, i, result = 0, failed = 0;
+    int has_cwd = getcwd(cwd, sizeof(cwd)) != NULL;
+
+    if (!socket_address(&address, options->client_path))
+    {
+        return 1;
+    }
+
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, (struct sockaddr *)&address, sizeof(address)) != 0)
+    {
+        printf("Error: Unable to connect to %s\n", options->client_path);
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+        return 1;
+    }
+
+    init_text_buffer(&request);
+    init_text_buffer(&response);
+    init_text_buffer(&path);
+
+    if (options->shutdown)
+    {
+        append_record(&request, RECORD_SHUTDOWN, NULL, 0);
+        if (!send_request(fd, &request, &response))
+        {
+            result = 1;
+        }
+    }
+
+    for (i = 0; i < options->files_counter && result == 0; i++)
+    {
+        /* The server may run in another directory, so a relative path cannot be sent as it is */
+        clear_text_buffer(&path);
+        if (options->files[i][0] != '/')
+        {
+            if (!has_cwd)
+            {
+                printf("Error: Unable to resolve %s without the current directory\n", options->files[i]);
+                failed = 1;
+                continue;
+            }
+            append_text(&path, cwd, strlen(cwd));
+            append_text(&path, "/", 1);
+        }
+        append_text(&path, options->files[i], strlen(options->files[i]));
+
+        clear_text_buffer(&request);
+        append_record(&request, RECORD_PATH, path.text, path.length);
+        append_record(&request, RECORD_NAME, options->files[i], strlen(options->files[i]));
+        sprintf(number, "%d", options->mem_size);
+        append_record(&request, RECORD_MEM_SIZE, number, strlen(number));
+        if (options->skip_unchanged)
+        {
+            append_record(&request, RECORD_SKIP_UNCHANGED, NULL, 0);
+        }
+
+        if (!send_request(fd, &request, &response))
+        {
+            printf("Error: The server at %s did not answer\n", options->client_path);
+            result = 1;
+        }
+        else if (!print_response(&response))
+        {
+            failed = 1;
+        }
+    }
+
+    release_text_buffer(&request);
+    release_text_buffer(&response);
+    release_text_buffer(&path);
+    close(fd);
+    return result || failed;
+}
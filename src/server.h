@@ -0,0 +1,12 @@
+#ifndef SERVER_H
+#define SERVER_H
+
+#include "options.h"
+
+#define SERVER_BACKLOG 64 /* Connections waiting to be accepted */
+
+/* Prototypes */
+int run_server(const struct assembler_options *options);
+int run_client(const struct assembler_options *options);
+
+#endif
@@ -0,0 +1,162 @@
+#include <string.h>
+#include "sha256.h"
+
+#define ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+#define CH(x, y, z) (((x) & (y)) ^ (~(x) & (z)))
+#define MAJ(x, y, z) (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
+#define SIGMA0(x) (ROTR(x, 2) ^ ROTR(x, 13) ^ ROTR(x, 22))
+#define SIGMA1(x) (ROTR(x, 6) ^ ROTR(x, 11) ^ ROTR(x, 25))
+#define GAMMA0(x) (ROTR(x, 7) ^ ROTR(x, 18) ^ ((x) >> 3))
+#define GAMMA1(x) (ROTR(x, 17) ^ ROTR(x, 19) ^ ((x) >> 10))
+
+/* Round constants: the first 32 bits of the fractional parts of the cube roots of the first 64 primes */
+static const uint32_t round_constants[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+/**
+ * @brief Hashes the current block into the state.
+ *
+ * @param sha The SHA-256 state.
+ */
+static void sha256_transform(struct sha256_context *sha)
+{
+    uint32_t w[64];
+    uint32_t a, b, c, d, e, f, g, h, t1, t2;
+    int i;
+
+    for (i = 0; i < 16; i++)
+    {
+        w[i] = ((uint32_t)sha->block[i * 4] << 24) | ((uint32_t)sha->block[i * 4 + 1] << 16) |
+               ((uint32_t)sha->block[i * 4 + 2] << 8) | (uint32_t)sha->block[i * 4 + 3];
+    }
+    for (i = 16; i < 64; i++)
+    {
+        w[i] = GAMMA1(w[i - 2]) + w[i - 7] + GAMMA0(w[i - 15]) + w[i - 16];
+    }
+
+    a = sha->state[0];
+    b = sha->state[1];
+    c = sha->state[2];
+    d = sha->state[3];
+    e = sha->state[4];
+    f = sha->state[5];
+    g = sha->state[6];
+    h = sha->state[7];
+
+    for (i = 0; i < 64; i++)
+    {
+        t1 = h + SIGMA1(e) + CH(e, f, g) + round_constants[i] + w[i];
+        t2 = SIGMA0(a) + MAJ(a, b, c);
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+
+    sha->state[0] += a;
+    sha->state[1] += b;
+    sha->state[2] += c;
+    sha->state[3] += d;
+    sha->state[4] += e;
+    sha->state[5] += f;
+    sha->state[6] += g;
+    sha->state[7] += h;
+}
+
+/**
+ * @brief Starts a new SHA-256 computation.
+ *
+ * @param sha The SHA-256 state to initialize.
+ */
+void sha256_init(struct sha256_context *sha)
+{
+    sha->state[0] = 0x6a09e667;
+    sha->state[1] = 0xbb67ae85;
+    sha->state[2] = 0x3c6ef372;
+    sha->state[3] = 0xa54ff53a;
+    sha->state[4] = 0x510e527f;
+    sha->state[5] = 0x9b05688c;
+    sha->state[6] = 0x1f83d9ab;
+    sha->state[7] = 0x5be0cd19;
+    sha->block_length = 0;
+    sha->total_length = 0;
+}
+
+/**
+ * @brief Hashes more bytes.
+ *
+ * @param sha The SHA-256 state.
+ * @param data The bytes to hash.
+ * @param length The number of bytes.
+ */
+void sha256_update(struct sha256_context *sha, const void *data, size_t length)
+{
+    const unsigned char *bytes = (const unsigned char *)data;
+    size_t count;
+
+    sha->total_length += length;
+    while (length > 0)
+    {
+        count = SHA256_BLOCK_SIZE - sha->block_length;
+        if (count > length)
+        {
+            count = length;
+        }
+        memcpy(sha->block + sha->block_length, bytes, count);
+        sha->block_length += count;
+        bytes += count;
+        length -= count;
+
+        if (sha->block_length == SHA256_BLOCK_SIZE)
+        {
+            sha256_transform(sha);
+            sha->block_length = 0;
+        }
+    }
+}
+
+/**
+ * @brief Ends the computation and returns the digest.
+ *
+ * @param sha The SHA-256 state.
+ * @param digest The buffer the 32 bytes of the digest are written to.
+ */
+void sha256_final(struct sha256_context *sha, unsigned char digest[SHA256_DIGEST_SIZE])
+{
+    unsigned long high_bits = (unsigned long)(sha->total_length >> 29); /* Length in bits, split in two 32 bit halves */
+    unsigned long low_bits = (unsigned long)(sha->total_length << 3) & 0xFFFFFFFFUL;
+    int i;
+
+    /* Padding: a single 1 bit, zeros, then the length in bits */
+    sha->block[sha->block_length++] = 0x80;
+    if (sha->block_length > SHA256_BLOCK_SIZE - 8)
+    {
+        memset(sha->block + sha->block_length, 0, SHA256_BLOCK_SIZE - sha->block_length);
+        sha256_transform(sha);
+        sha->block_length = 0;
+    }
+    memset(sha->block + sha->block_length, 0, SHA256_BLOCK_SIZE - 8 - sha->block_length);
+
+    for (i = 0; i < 4; i++)
+    {
+        sha->block[SHA256_BLOCK_SIZE - 8 + i] = (unsigned char)(high_bits >> (24 - i * 8));
+        sha->block[SHA256_BLOCK_SIZE - 4 + i] = (unsigned char)(low_bits >> (24 - i * 8));
+    }
+    sha256_transform(sha);
+
+    for (i = 0; i < 32; i++)
+    {
+        digest[i] = (unsigned char)(sha->state[i / 4] >> (24 - (i % 4) * 8));
+    }
+}
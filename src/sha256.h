@@ -0,0 +1,26 @@
+#ifndef SHA256_H
+#define SHA256_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SHA256_BLOCK_SIZE 64  /* Size of a block, in bytes */
+#define SHA256_DIGEST_SIZE 32 /* Size of a digest, in bytes */
+
+/**
+ * @brief State of a SHA-256 computation (FIPS 180-4).
+ */
+struct sha256_context
+{
+    uint32_t state[8];                       /* The intermediate hash */
+    unsigned char block[SHA256_BLOCK_SIZE];  /* The bytes of the current block */
+    size_t block_length;                     /* Number of bytes in block */
+    size_t total_length;                     /* Number of bytes hashed so far */
+};
+
+/* Prototypes */
+void sha256_init(struct sha256_context *sha);
+void sha256_update(struct sha256_context *sha, const void *data, size_t length);
+void sha256_final(struct sha256_context *sha, unsigned char digest[SHA256_DIGEST_SIZE]);
+
+#endif
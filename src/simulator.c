@@ -0,0 +1,504 @@
+#include <string.h>
+#include <stdlib.h>
+#include <limits.h>
+#include "simulator.h"
+
+/* Labels as values are a GNU extension: strict ANSI builds dispatch with a switch instead */
+#if defined(__GNUC__) && !defined(__STRICT_ANSI__)
+#define SIM_COMPUTED_GOTO
+#endif
+
+#define SIGN_BIT (1 << (WORD_BITS - 1))
+#define IMMEDIATE_SIGN_BIT (SIM_MEMORY_SIZE >> 1) /* The top bit of an operand */
+#define ARE_ABSOLUTE (1 << TARGET_ARE_ABSOLUTE)
+#define ARE_EXTERNAL (1 << TARGET_ARE_EXTERNAL)
+#define ARE_MASK (ARE_ABSOLUTE | (1 << TARGET_ARE_RELOCATABLE) | ARE_EXTERNAL)
+#define NO_MODE (-1)
+#define WORDS_MODE(mode) (((mode) == NO_MODE) ? 4 : (mode)) /* A mode as TARGET_INSTRUCTION_WORDS takes it */
+
+/**
+ * @brief Sign extends a word of the target.
+ */
+static int sign_extend(int word)
+{
+    return ((word & WORD_MASK) ^ SIGN_BIT) - SIGN_BIT;
+}
+
+/**
+ * @brief Finds the addressing mode of a one-hot field of a first word.
+ *
+ * @param bits The 4 bits of the field.
+ * @return int The mode, NO_MODE if no bit is set, or -2 if more than one is.
+ */
+static int one_hot_mode(int bits)
+{
+    int mode;
+
+    if (bits == 0)
+    {
+        return NO_MODE;
+    }
+    for (mode = 0; !(bits & (1 << mode)); mode++)
+        ;
+    return (bits == (1 << mode)) ? mode : -2;
+}
+
+/**
+ * @brief Decodes an operand from its extra word, laid out as codeWords writes it.
+ *
+ * @param word The extra word.
+ * @param mode The addressing mode of the operand, from the first word.
+ * @param shift The bit the register number starts at: TARGET_SOURCE_REGISTER_SHIFT for a register source,
+ * otherwise TARGET_OPERAND_SHIFT.
+ * @param operand The decoded operand.
+ */
+static void decode_operand(int word, int mode, int shift, struct sim_operand *operand)
+{
+    switch (mode)
+    {
+    case 0: /* Immediate */
+        operand->kind = SIM_IMMEDIATE;
+        operand->value = (((word >> TARGET_OPERAND_SHIFT) & SIM_ADDRESS_MASK) ^ IMMEDIATE_SIGN_BIT) - IMMEDIATE_SIGN_BIT;
+        break;
+    case 1: /* Label, relocatable or external */
+        operand->kind = ((word & ARE_MASK) == ARE_EXTERNAL) ? SIM_EXTERNAL : SIM_DIRECT;
+        operand->value = (word >> TARGET_OPERAND_SHIFT) & SIM_ADDRESS_MASK;
+        break;
+    case 2: /* Register address */
+        operand->kind = SIM_INDIRECT;
+        operand->value = SIM_REGISTER_BASE + ((word >> shift) & TARGET_REGISTER_MASK);
+        break;
+    default: /* Register direct */
+        operand->kind = SIM_REGISTER;
+        operand->value = SIM_REGISTER_BASE + ((word >> shift) & TARGET_REGISTER_MASK);
+        break;
+    }
+}
+
+/**
+ * @brief Checks that the operands of a decoded instruction are valid for its opcode.
+ */
+static int valid_operands(const struct sim_instruction *instruction)
+{
+    int source = instruction->source.kind, target = instruction->target.kind;
+
+    if (source == SIM_EXTERNAL || target == SIM_EXTERNAL)
+    {
+        return 0;
+    }
+    switch (instruction->opcode)
+    {
+    case SIM_CMP:
+    case SIM_PRN:
+        return 1;
+    case SIM_LEA:
+        return source == SIM_DIRECT && target != SIM_IMMEDIATE;
+    case SIM_JMP:
+    case SIM_BNE:
+    case SIM_JSR:
+        return target == SIM_DIRECT || target == SIM_INDIRECT;
+    default:
+        return target != SIM_IMMEDIATE;
+    }
+}
+
+/**
+ * @brief Decodes the instruction starting at an address, the reverse of secondPass.
+ *
+ * Instructions that cannot be executed, including those using an external symbol,
+ * are stored as SIM_INVALID with their operands, so the fault can be explained.
+ *
+ * @param machine The machine, its code loaded.
+ * @param address The address of the first word.
+ * @return int The number of words of the instruction, at least 1.
+ */
+static int decode_instruction(struct sim_machine *machine, int address)
+{
+    struct sim_instruction *instruction = &machine->decoded[address];
+    int word = machine->memory[address];
+    int source_mode = one_hot_mode((word >> TARGET_SOURCE_MODE_SHIFT) & 0xF);
+    int target_mode = one_hot_mode((word >> TARGET_DEST_MODE_SHIFT) & 0xF);
+    int opcode = TARGET_OPERATION(word >> TARGET_OPCODE_SHIFT);
+    int operands = (opcode <= SIM_LEA) ? 2 : (opcode <= SIM_JSR) ? 1 : 0;
+    int length = TARGET_INSTRUCTION_WORDS(WORDS_MODE(source_mode), WORDS_MODE(target_mode));
+    int extra;
+
+    instruction->opcode = SIM_INVALID;
+    instruction->length = 1;
+    instruction->source.kind = instruction->target.kind = SIM_NONE;
+    instruction->source.value = instruction->target.value = 0;
+
+    if ((word & ARE_MASK) != ARE_ABSOLUTE || opcode < 0 || source_mode == -2 || target_mode == -2 ||
+        (source_mode != NO_MODE) != (operands == 2) || (target_mode != NO_MODE) != (operands >= 1) ||
+        address + length > machine->code_end)
+    {
+        return 1;
+    }
+
+    extra = (length > 1) ? machine->memory[address + 1] : 0;
+    if (length == 2 && operands == 2)
+    {
+        /* Both operands are registers and share a word */
+        decode_operand(extra, source_mode, TARGET_SOURCE_REGISTER_SHIFT, &instruction->source);
+        decode_operand(extra, target_mode, TARGET_OPERAND_SHIFT, &instruction->target);
+    }
+    else if (operands == 2)
+    {
+        decode_operand(extra, source_mode, TARGET_SOURCE_REGISTER_SHIFT, &instruction->source);
+        decode_operand(machine->memory[address + 2], target_mode, TARGET_OPERAND_SHIFT, &instruction->target);
+    }
+    else if (operands == 1)
+    {
+        decode_operand(extra, target_mode, TARGET_OPERAND_SHIFT, &instruction->target);
+    }
+
+    instruction->opcode = opcode;
+    if (!valid_operands(instruction))
+    {
+        instruction->opcode = SIM_INVALID;
+    }
+    instruction->length = length;
+    return length;
+}
+
+/**
+ * @brief Predecodes the whole code, one instruction after the other from the load address.
+ */
+static void predecode(struct sim_machine *machine)
+{
+    int address;
+
+    for (address = 0; address <= SIM_MEMORY_SIZE; address++)
+    {
+        machine->decoded[address].opcode = SIM_INVALID;
+        machine->decoded[address].length = 1;
+        machine->decoded[address].source.kind = machine->decoded[address].target.kind = SIM_NONE;
+    }
+    for (address = SIM_LOAD_ADDRESS; address < machine->code_end;)
+    {
+        address += decode_instruction(machine, address);
+    }
+}
+
+/**
+ * @brief Empties the machine and checks that a program of the given size fits in its memory.
+ *
+ * @return int Returns 1 if the program fits, otherwise 0 with the reason in machine->error.
+ */
+static int reset_machine(struct sim_machine *machine, int code_length, int data_length)
+{
+    memset(machine->memory, 0, sizeof(machine->memory));
+    machine->stack_depth = 0;
+    machine->zero = 0;
+    machine->pc = SIM_LOAD_ADDRESS;
+    machine->code_end = SIM_LOAD_ADDRESS + code_length;
+    machine->executed = 0;
+    machine->input = stdin;
+    machine->output = stdout;
+    machine->error[0] = '\0';
+
+    if (code_length < 0 || data_length < 0 || code_length + data_length > SIM_MEMORY_SIZE - SIM_LOAD_ADDRESS)
+    {
+        sprintf(machine->error, "A program of %d code and %d data words does not fit in memory", code_length,
+                data_length);
+        machine->code_end = SIM_LOAD_ADDRESS;
+        predecode(machine);
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief Loads code and data images, such as the words of an asm_result, and predecodes the code.
+ *
+ * The code is loaded at SIM_LOAD_ADDRESS and the data right after it, as createObFile lays
+ * them out. Reads come from stdin and prn writes to stdout until the caller changes them.
+ *
+ * @param machine The machine to load.
+ * @param code The code words. May be NULL if code_length is 0.
+ * @param code_length Number of code words.
+ * @param data The data words. May be NULL if data_length is 0.
+ * @param data_length Number of data words.
+ * @return int Returns 1 if the images were loaded, otherwise 0 with the reason in machine->error.
+ */
+int sim_load_images(struct sim_machine *machine, const uint16_t *code, int code_length, const uint16_t *data,
+                    int data_length)
+{
+    int i;
+
+    if (!reset_machine(machine, code_length, data_length))
+    {
+        return 0;
+    }
+    for (i = 0; i < code_length; i++)
+    {
+        machine->memory[SIM_LOAD_ADDRESS + i] = code[i] & WORD_MASK;
+    }
+    for (i = 0; i < data_length; i++)
+    {
+        machine->memory[machine->code_end + i] = data[i] & WORD_MASK;
+    }
+    predecode(machine);
+    return 1;
+}
+
+/**
+ * @brief Loads the images of a file assembled in this process.
+ *
+ * @param machine The machine to load.
+ * @param machine_code The translation left by secondPass.
+ * @return int Returns 1 if the images were loaded, otherwise 0 with the reason in machine->error.
+ */
+int sim_load_translation(struct sim_machine *machine, const translation *machine_code)
+{
+    int code_length = (machine_code->IC != 0) ? machine_code->IC - SIM_LOAD_ADDRESS : 0;
+
+    return sim_load_images(machine, machine_code->code_image + SIM_LOAD_ADDRESS, code_length,
+                           machine_code->data_image, machine_code->DC);
+}
+
+/**
+ * @brief Loads an object file written by createObFile.
+ *
+ * Words missing from the file are zero, as createObFile skips them.
+ *
+ * @param machine The machine to load.
+ * @param file The .ob file, opened for reading.
+ * @return int Returns 1 if the file was loaded, otherwise 0 with the reason in machine->error.
+ */
+int sim_load_ob(struct sim_machine *machine, FILE *file)
+{
+    char octal[16], *end;
+    int code_length, data_length, address, line = 1;
+    long word;
+
+    if (fscanf(file, "%d %d", &code_length, &data_length) != 2)
+    {
+        reset_machine(machine, 0, 0);
+        strcpy(machine->error, "The object file has no header");
+        return 0;
+    }
+    if (!reset_machine(machine, code_length, data_length))
+    {
+        return 0;
+    }
+
+    while (fscanf(file, "%d %15s", &address, octal) == 2)
+    {
+        line++;
+        word = strtol(octal, &end, 8);
+        if (*end != '\0' || word < 0 || word > WORD_MASK || address < SIM_LOAD_ADDRESS ||
+            address >= machine->code_end + data_length)
+        {
+            sprintf(machine->error, "Line %d of the object file is not a word of the program", line);
+            return 0;
+        }
+        machine->memory[address] = (uint16_t)word;
+    }
+    if (!feof(file))
+    {
+        sprintf(machine->error, "Line %d of the object file cannot be read", line + 1);
+        return 0;
+    }
+
+    predecode(machine);
+    return 1;
+}
+
+/**
+ * @brief Reads the value of an operand.
+ */
+static int read_operand(const struct sim_machine *machine, const struct sim_operand *operand)
+{
+    if (operand->kind == SIM_IMMEDIATE)
+    {
+        return operand->value;
+    }
+    if (operand->kind == SIM_INDIRECT)
+    {
+        return sign_extend(machine->memory[machine->memory[operand->value] & SIM_ADDRESS_MASK]);
+    }
+    return sign_extend(machine->memory[operand->value]);
+}
+
+/**
+ * @brief Writes the destination of an instruction, truncating the value to a word.
+ *
+ * A store into the code decodes it again, so the predecoded instructions never go stale.
+ */
+static void write_operand(struct sim_machine *machine, const struct sim_operand *operand, int value)
+{
+    int index = (operand->kind == SIM_INDIRECT) ? machine->memory[operand->value] & SIM_ADDRESS_MASK : operand->value;
+
+    machine->memory[index] = (uint16_t)(value & WORD_MASK);
+    if (index >= SIM_LOAD_ADDRESS && index < machine->code_end)
+    {
+        predecode(machine);
+    }
+}
+
+/**
+ * @brief Finds the address a jump goes to.
+ */
+static int jump_address(const struct sim_machine *machine, const struct sim_operand *operand)
+{
+    return (operand->kind == SIM_DIRECT) ? operand->value : machine->memory[operand->value] & SIM_ADDRESS_MASK;
+}
+
+/**
+ * @brief Explains why the instruction at an address cannot be executed.
+ */
+static void describe_fault(struct sim_machine *machine, int pc)
+{
+    const struct sim_instruction *instruction = &machine->decoded[pc];
+
+    if (instruction->source.kind == SIM_EXTERNAL || instruction->target.kind == SIM_EXTERNAL)
+    {
+        sprintf(machine->error, "The instruction at address %d uses an external symbol that is not linked", pc);
+    }
+    else
+    {
+        sprintf(machine->error, "There is no instruction at address %d", pc);
+    }
+}
+
+#ifdef SIM_COMPUTED_GOTO
+#define HANDLER(opcode, label) label:
+#define DISPATCH()                                        \
+    {                                                     \
+        if (remaining == 0)                               \
+        {                                                 \
+            goto exhausted;                               \
+        }                                                 \
+        remaining--;                                      \
+        instruction = &machine->decoded[pc];              \
+        goto *handlers[instruction->opcode];              \
+    }
+#else
+#define HANDLER(opcode, label) case opcode:
+#define DISPATCH() continue
+#endif
+#define NEXT()                          \
+    {                                   \
+        pc += instruction->length;      \
+        DISPATCH();                     \
+    }
+
+/**
+ * @brief Runs the loaded program from machine->pc until it stops, faults or runs out of budget.
+ *
+ * Every instruction was decoded at load time, so executing one is a jump to its handler
+ * through a table of label addresses (a switch in strict ANSI builds) and the access
+ * of its operands. red reads a character of machine->input, -1 at its end, and prn
+ * writes its operand to machine->output as a decimal number on a line of its own.
+ *
+ * @param machine The loaded machine. machine->executed counts the instructions executed.
+ * @param budget The most instructions to execute, or 0 for no limit.
+ * @return int One of enum sim_status. machine->pc is the instruction that stopped or was next.
+ */
+int sim_run(struct sim_machine *machine, long budget)
+{
+    const struct sim_instruction *instruction;
+    long remaining = (budget > 0) ? budget : LONG_MAX, initial = remaining;
+    int pc = machine->pc, value, status;
+#ifdef SIM_COMPUTED_GOTO
+    static void *const handlers[SIM_OPCODE_COUNT] = {
+        &&op_mov, &&op_cmp, &&op_add, &&op_sub, &&op_lea, &&op_clr, &&op_not, &&op_inc,
+        &&op_dec, &&op_jmp, &&op_bne, &&op_red, &&op_prn, &&op_jsr, &&op_rts, &&op_stop,
+        &&op_invalid};
+
+    DISPATCH();
+#else
+    for (;;)
+    {
+        if (remaining == 0)
+        {
+            goto exhausted;
+        }
+        remaining--;
+        instruction = &machine->decoded[pc];
+        switch (instruction->opcode)
+        {
+#endif
+
+    HANDLER(SIM_MOV, op_mov)
+        write_operand(machine, &instruction->target, read_operand(machine, &instruction->source));
+        NEXT();
+    HANDLER(SIM_CMP, op_cmp)
+        machine->zero = read_operand(machine, &instruction->source) == read_operand(machine, &instruction->target);
+        NEXT();
+    HANDLER(SIM_ADD, op_add)
+        value = read_operand(machine, &instruction->target) + read_operand(machine, &instruction->source);
+        write_operand(machine, &instruction->target, value);
+        NEXT();
+    HANDLER(SIM_SUB, op_sub)
+        value = read_operand(machine, &instruction->target) - read_operand(machine, &instruction->source);
+        write_operand(machine, &instruction->target, value);
+        NEXT();
+    HANDLER(SIM_LEA, op_lea)
+        write_operand(machine, &instruction->target, instruction->source.value);
+        NEXT();
+    HANDLER(SIM_CLR, op_clr)
+        write_operand(machine, &instruction->target, 0);
+        NEXT();
+    HANDLER(SIM_NOT, op_not)
+        write_operand(machine, &instruction->target, ~read_operand(machine, &instruction->target));
+        NEXT();
+    HANDLER(SIM_INC, op_inc)
+        write_operand(machine, &instruction->target, read_operand(machine, &instruction->target) + 1);
+        NEXT();
+    HANDLER(SIM_DEC, op_dec)
+        write_operand(machine, &instruction->target, read_operand(machine, &instruction->target) - 1);
+        NEXT();
+    HANDLER(SIM_JMP, op_jmp)
+        pc = jump_address(machine, &instruction->target);
+        DISPATCH();
+    HANDLER(SIM_BNE, op_bne)
+        pc = machine->zero ? pc + instruction->length : jump_address(machine, &instruction->target);
+        DISPATCH();
+    HANDLER(SIM_RED, op_red)
+        value = getc(machine->input);
+        write_operand(machine, &instruction->target, (value == EOF) ? -1 : value);
+        NEXT();
+    HANDLER(SIM_PRN, op_prn)
+        fprintf(machine->output, "%d\n", read_operand(machine, &instruction->target));
+        NEXT();
+    HANDLER(SIM_JSR, op_jsr)
+        if (machine->stack_depth == SIM_STACK_SIZE)
+        {
+            sprintf(machine->error, "jsr at address %d overflows the stack of %d returns", pc, SIM_STACK_SIZE);
+            goto fault;
+        }
+        machine->stack[machine->stack_depth++] = pc + instruction->length;
+        pc = jump_address(machine, &instruction->target);
+        DISPATCH();
+    HANDLER(SIM_RTS, op_rts)
+        if (machine->stack_depth == 0)
+        {
+            sprintf(machine->error, "rts at address %d has no jsr to return to", pc);
+            goto fault;
+        }
+        pc = machine->stack[--machine->stack_depth];
+        DISPATCH();
+    HANDLER(SIM_STOP, op_stop)
+        status = SIM_STOPPED;
+        goto done;
+    HANDLER(SIM_INVALID, op_invalid)
+        describe_fault(machine, pc);
+        goto fault;
+
+#ifndef SIM_COMPUTED_GOTO
+        }
+    }
+#endif
+
+exhausted:
+    status = SIM_EXHAUSTED;
+    goto done;
+fault:
+    status = SIM_FAULT;
+done:
+    machine->pc = pc;
+    machine->executed += initial - remaining;
+    return status;
+}
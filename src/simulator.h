@@ -0,0 +1,93 @@
+#ifndef SIMULATOR_H
+#define SIMULATOR_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include "translate.h"
+
+#define SIM_LOAD_ADDRESS TARGET_LOAD_BASE /* Address of the first code word, as in secondPass */
+#define SIM_MEMORY_SIZE TARGET_ADDRESS_SPACE /* Words addressable by the bits of an operand */
+#define SIM_ADDRESS_MASK (SIM_MEMORY_SIZE - 1)
+#define SIM_REGISTERS (TARGET_REGISTER_MASK + 1) /* Every register number a word can hold */
+#define SIM_REGISTER_BASE SIM_MEMORY_SIZE /* The registers are stored after the memory */
+#define SIM_STACK_SIZE 1024            /* Deepest nesting of jsr */
+#define SIM_ERROR_SIZE 128             /* Size of the message of a failed run */
+
+/* The opcodes, in the order of inst_type. SIM_INVALID marks words that do not start an instruction */
+enum sim_opcode
+{
+    SIM_MOV, SIM_CMP, SIM_ADD, SIM_SUB, SIM_LEA, SIM_CLR, SIM_NOT, SIM_INC,
+    SIM_DEC, SIM_JMP, SIM_BNE, SIM_RED, SIM_PRN, SIM_JSR, SIM_RTS, SIM_STOP,
+    SIM_INVALID,
+    SIM_OPCODE_COUNT
+};
+
+/* Where a predecoded operand is read from or written to */
+enum sim_operand_kind
+{
+    SIM_NONE,      /* The instruction has no such operand */
+    SIM_IMMEDIATE, /* #value */
+    SIM_DIRECT,    /* A label: the word at an address */
+    SIM_INDIRECT,  /* *rN: the word at the address held by a register */
+    SIM_REGISTER,  /* rN */
+    SIM_EXTERNAL   /* A label of another file, left for the linker */
+};
+
+/* The outcome of sim_run */
+enum sim_status
+{
+    SIM_STOPPED,   /* The program executed stop */
+    SIM_EXHAUSTED, /* The instruction budget ran out */
+    SIM_FAULT      /* The program did something the machine cannot do, see sim_machine.error */
+};
+
+/**
+ * @brief An operand decoded from the extra words of an instruction.
+ */
+struct sim_operand
+{
+    int kind;  /* One of enum sim_operand_kind */
+    int value; /* The immediate, or the index of the word in sim_machine.memory: an address or a register */
+};
+
+/**
+ * @brief An instruction decoded once at load time, stored at the address of its first word.
+ */
+struct sim_instruction
+{
+    int opcode;                /* One of enum sim_opcode */
+    int length;                /* Number of words, to step to the next instruction */
+    struct sim_operand source; /* Only set for the two operand instructions */
+    struct sim_operand target; /* The destination, or the single operand */
+};
+
+/**
+ * @brief The state of the simulated machine.
+ *
+ * Words are TARGET_WORD_BITS wide. The registers are words stored after the memory, out of reach of
+ * the addresses of the operands, so reading an operand that is not immediate is a single index.
+ */
+struct sim_machine
+{
+    uint16_t memory[SIM_MEMORY_SIZE + SIM_REGISTERS];   /* Code from SIM_LOAD_ADDRESS, the data, then the registers */
+    struct sim_instruction decoded[SIM_MEMORY_SIZE + 1]; /* The predecoded code, indexed by address, then a
+                                                            SIM_INVALID past the end of memory */
+    int stack[SIM_STACK_SIZE];                          /* Return addresses of jsr */
+    int stack_depth;
+    int zero;                                           /* Set by cmp when its operands are equal */
+    int pc;                                             /* Address of the next instruction */
+    int code_end;                                       /* Address after the last code word */
+    long executed;                                      /* Instructions executed by sim_run */
+    FILE *input;                                        /* Read by red */
+    FILE *output;                                       /* Written by prn */
+    char error[SIM_ERROR_SIZE];                         /* Why the last run faulted */
+};
+
+/* Prototypes */
+int sim_load_images(struct sim_machine *machine, const uint16_t *code, int code_length, const uint16_t *data,
+                    int data_length);
+int sim_load_translation(struct sim_machine *machine, const translation *machine_code);
+int sim_load_ob(struct sim_machine *machine, FILE *file);
+int sim_run(struct sim_machine *machine, long budget);
+
+#endif
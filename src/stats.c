@@ -0,0 +1,310 @@
+#define _POSIX_C_SOURCE 200809L /* clock_gettime, CLOCK_THREAD_CPUTIME_ID */
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+#include "stats.h"
+#include "trace.h"
+
+#define STATS_NAME_WIDTH 24 /* Narrowest name column of the tables, longer names widen it */
+
+int stats_enabled = 0;
+
+static pthread_key_t stats_key; /* The statistics each thread counts into */
+
+static const char *phase_names[PHASE_COUNT] = {"preprocess", "first_pass", "optimize", "second_pass", "output", "cache"};
+static const char *output_names[STATS_OUTPUT_COUNT] = {"am", "ob", "ent", "ext"};
+
+/**
+ * @brief Starts counting. Must be called before any thread binds its statistics.
+ */
+void enable_stats(void)
+{
+    if (!stats_enabled && pthread_key_create(&stats_key, NULL) == 0)
+    {
+        stats_enabled = 1;
+    }
+}
+
+/**
+ * @brief Selects the statistics the current thread counts into.
+ *
+ * @param stats The statistics of the file the thread assembles, or NULL to stop counting.
+ */
+void bind_stats(struct file_stats *stats)
+{
+    if (stats_enabled)
+    {
+        pthread_setspecific(stats_key, stats);
+    }
+}
+
+/**
+ * @brief Returns the statistics the current thread counts into, or NULL.
+ */
+struct file_stats *current_stats(void)
+{
+    return (struct file_stats *)pthread_getspecific(stats_key);
+}
+
+/**
+ * @brief Reads a clock in milliseconds.
+ */
+static double clock_ms(clockid_t clock)
+{
+    struct timespec ts;
+
+    clock_gettime(clock, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+/**
+ * @brief Starts timing a phase.
+ *
+ * @param timer The timer to start.
+ */
+void start_phase(struct phase_timer *timer)
+{
+    if (stats_enabled || trace_enabled)
+    {
+        timer->wall_start = clock_ms(CLOCK_MONOTONIC);
+    }
+    if (stats_enabled)
+    {
+        timer->cpu_start = clock_ms(CLOCK_THREAD_CPUTIME_ID);
+    }
+}
+
+/**
+ * @brief Adds the time since start_phase to a phase of the current statistics.
+ *
+ * @param timer The timer given to start_phase.
+ * @param phase The phase, one of enum stats_phase.
+ */
+void end_phase(struct phase_timer *timer, int phase)
+{
+    end_named_phase(timer, phase, phase_names[phase]);
+}
+
+/**
+ * @brief Like end_phase, naming the span of the trace after a part of the phase.
+ *
+ * @param timer The timer given to start_phase.
+ * @param phase The phase, one of enum stats_phase.
+ * @param span The name of the span recorded with --trace.
+ */
+void end_named_phase(struct phase_timer *timer, int phase, const char *span)
+{
+    struct file_stats *stats;
+    double wall_end;
+
+    if (!stats_enabled && !trace_enabled)
+    {
+        return;
+    }
+    wall_end = clock_ms(CLOCK_MONOTONIC);
+    if (stats_enabled && (stats = current_stats()) != NULL)
+    {
+        stats->wall_ms[phase] += wall_end - timer->wall_start;
+        stats->cpu_ms[phase] += clock_ms(CLOCK_THREAD_CPUTIME_ID) - timer->cpu_start;
+    }
+    trace_span(span, timer->wall_start, wall_end);
+}
+
+/**
+ * @brief Returns the output kind of an extension.
+ *
+ * @param extension The extension, without the dot.
+ * @return int One of enum stats_output. Unknown extensions count as STATS_OUTPUT_OB.
+ */
+int stats_output_kind(const char *extension)
+{
+    int i;
+
+    for (i = 0; i < STATS_OUTPUT_COUNT; i++)
+    {
+        if (strcmp(extension, output_names[i]) == 0)
+        {
+            return i;
+        }
+    }
+    return STATS_OUTPUT_OB;
+}
+
+/**
+ * @brief Adds the statistics of a file to a total.
+ */
+static void add_stats(struct file_stats *total, const struct file_stats *stats)
+{
+    int i;
+
+    for (i = 0; i < PHASE_COUNT; i++)
+    {
+        total->wall_ms[i] += stats->wall_ms[i];
+        total->cpu_ms[i] += stats->cpu_ms[i];
+    }
+    for (i = 0; i < STATS_OUTPUT_COUNT; i++)
+    {
+        total->bytes_written[i] += stats->bytes_written[i];
+    }
+    total->lines_read += stats->lines_read;
+    total->lines_expanded += stats->lines_expanded;
+    total->symbol_lookups += stats->symbol_lookups;
+    total->symbol_inserts += stats->symbol_inserts;
+    total->allocations += stats->allocations;
+    total->allocated_bytes += stats->allocated_bytes;
+}
+
+/**
+ * @brief Prints a string as a JSON string.
+ *
+ * @param stream The stream to print to.
+ * @param text The string.
+ */
+void print_json_string(FILE *stream, const char *text)
+{
+    fputc('"', stream);
+    for (; *text != '\0'; text++)
+    {
+        if (*text == '"' || *text == '\\')
+        {
+            fputc('\\', stream);
+        }
+        if ((unsigned char)*text < 0x20)
+        {
+            fprintf(stream, "\\u%04x", (unsigned char)*text);
+        }
+        else
+        {
+            fputc(*text, stream);
+        }
+    }
+    fputc('"', stream);
+}
+
+/**
+ * @brief Prints the statistics of a file as a JSON object.
+ */
+static void print_stats_json(FILE *stream, const char *name, const struct file_stats *stats)
+{
+    int i;
+
+    fprintf(stream, "{\"name\": ");
+    print_json_string(stream, name);
+    fprintf(stream, ", \"phases\": {");
+    for (i = 0; i < PHASE_COUNT; i++)
+    {
+        fprintf(stream, "%s\"%s\": {\"wall_ms\": %.3f, \"cpu_ms\": %.3f}", (i == 0) ? "" : ", ",
+                phase_names[i], stats->wall_ms[i], stats->cpu_ms[i]);
+    }
+    fprintf(stream, "}, \"lines_read\": %ld, \"lines_expanded\": %ld, \"symbol_lookups\": %ld, \"symbol_inserts\": %ld",
+            stats->lines_read, stats->lines_expanded, stats->symbol_lookups, stats->symbol_inserts);
+    fprintf(stream, ", \"allocations\": %ld, \"allocated_bytes\": %ld, \"bytes_written\": {",
+            stats->allocations, stats->allocated_bytes);
+    for (i = 0; i < STATS_OUTPUT_COUNT; i++)
+    {
+        fprintf(stream, "%s\"%s\": %ld", (i == 0) ? "" : ", ", output_names[i], stats->bytes_written[i]);
+    }
+    fprintf(stream, "}}");
+}
+
+/**
+ * @brief Prints the row of a file in the phases table.
+ *
+ * @param width The width of the name column, at least the length of every name.
+ */
+static void print_phases_row(FILE *stream, int width, const char *name, const struct file_stats *stats)
+{
+    double wall = 0, cpu = 0;
+    int i;
+
+    fprintf(stream, "%-*s", width, name);
+    for (i = 0; i < PHASE_COUNT; i++)
+    {
+        fprintf(stream, " %9.2f/%-9.2f", stats->wall_ms[i], stats->cpu_ms[i]);
+        wall += stats->wall_ms[i];
+        cpu += stats->cpu_ms[i];
+    }
+    fprintf(stream, " %9.2f/%-9.2f\n", wall, cpu);
+}
+
+/**
+ * @brief Prints the row of a file in the counters table.
+ *
+ * @param width The width of the name column, at least the length of every name.
+ */
+static void print_counters_row(FILE *stream, int width, const char *name, const struct file_stats *stats)
+{
+    int i;
+
+    fprintf(stream, "%-*s %9ld %9ld %9ld %9ld %9ld %12ld", width, name, stats->lines_read, stats->lines_expanded,
+            stats->symbol_lookups, stats->symbol_inserts, stats->allocations, stats->allocated_bytes);
+    for (i = 0; i < STATS_OUTPUT_COUNT; i++)
+    {
+        fprintf(stream, " %9ld", stats->bytes_written[i]);
+    }
+    fprintf(stream, "\n");
+}
+
+/**
+ * @brief Prints the statistics of every file and their total.
+ *
+ * @param stream The stream to print to.
+ * @param format STATS_FORMAT_TABLE or STATS_FORMAT_JSON.
+ * @param names The names of the files.
+ * @param stats The statistics of every file.
+ * @param counter The number of files.
+ */
+void print_stats(FILE *stream, int format, char **names, const struct file_stats *stats, int counter)
+{
+    struct file_stats total;
+    int width = STATS_NAME_WIDTH, i;
+
+    memset(&total, 0, sizeof(total));
+    for (i = 0; i < counter; i++)
+    {
+        add_stats(&total, &stats[i]);
+        if ((int)strlen(names[i]) > width)
+        {
+            width = (int)strlen(names[i]);
+        }
+    }
+
+    if (format == STATS_FORMAT_JSON)
+    {
+        fprintf(stream, "{\"files\": [");
+        for (i = 0; i < counter; i++)
+        {
+            fprintf(stream, (i == 0) ? "\n  " : ",\n  ");
+            print_stats_json(stream, names[i], &stats[i]);
+        }
+        fprintf(stream, "\n], \"total\": ");
+        print_stats_json(stream, "total", &total);
+        fprintf(stream, "}\n");
+        return;
+    }
+
+    fprintf(stream, "%-*s", width, "Time (wall/cpu ms)");
+    for (i = 0; i < PHASE_COUNT; i++)
+    {
+        fprintf(stream, " %-19s", phase_names[i]);
+    }
+    fprintf(stream, " %-19s\n", "total");
+    for (i = 0; i < counter; i++)
+    {
+        print_phases_row(stream, width, names[i], &stats[i]);
+    }
+    print_phases_row(stream, width, "total", &total);
+
+    fprintf(stream, "\n%-*s %9s %9s %9s %9s %9s %12s", width, "Counters", "lines", "expanded", "lookups", "inserts",
+            "allocs", "alloc bytes");
+    for (i = 0; i < STATS_OUTPUT_COUNT; i++)
+    {
+        fprintf(stream, " %5s.%-3s", "bytes", output_names[i]);
+    }
+    fprintf(stream, "\n");
+    for (i = 0; i < counter; i++)
+    {
+        print_counters_row(stream, width, names[i], &stats[i]);
+    }
+    print_counters_row(stream, width, "total", &total);
+}
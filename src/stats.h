@@ -0,0 +1,84 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include <stdio.h>
+
+#define STATS_FORMAT_TABLE 1 /* --stats: human readable tables */
+#define STATS_FORMAT_JSON 2  /* --stats=json */
+
+/* The phases of assembling a file */
+enum stats_phase
+{
+    PHASE_PREPROCESS,  /* Reading the source and expanding its macros */
+    PHASE_FIRST_PASS,  /* firstPass */
+    PHASE_OPTIMIZE,    /* The optimizations of -O */
+    PHASE_SECOND_PASS, /* secondPass */
+    PHASE_OUTPUT,      /* Writing the .ob, .ent and .ext files */
+    PHASE_CACHE,       /* Looking up, restoring and storing build cache entries */
+    PHASE_COUNT
+};
+
+/* The output files */
+enum stats_output
+{
+    STATS_OUTPUT_AM,
+    STATS_OUTPUT_OB,
+    STATS_OUTPUT_ENT,
+    STATS_OUTPUT_EXT,
+    STATS_OUTPUT_COUNT
+};
+
+/**
+ * @brief The time and the counters of assembling a single file.
+ */
+struct file_stats
+{
+    double wall_ms[PHASE_COUNT];             /* Wall clock time of every phase */
+    double cpu_ms[PHASE_COUNT];              /* CPU time of the thread in every phase */
+    long lines_read;                         /* Lines of the source */
+    long lines_expanded;                     /* Lines added by macro calls */
+    long symbol_lookups;                     /* Symbols and externs looked up by name */
+    long symbol_inserts;                     /* Symbols and extern uses added */
+    long allocations;                        /* Calls to allocateMemory and reallocateMemory */
+    long allocated_bytes;                    /* Bytes requested by those calls */
+    long bytes_written[STATS_OUTPUT_COUNT];  /* Size of every output file written */
+};
+
+/**
+ * @brief The start of a phase being timed.
+ */
+struct phase_timer
+{
+    double wall_start; /* Wall clock time at the start, in milliseconds */
+    double cpu_start;  /* Thread CPU time at the start, in milliseconds */
+};
+
+extern int stats_enabled; /* Set by enable_stats, nothing is counted otherwise */
+
+/**
+ * @brief Adds n to a counter of the statistics of the current thread.
+ *
+ * When --stats is not given this is a single test of stats_enabled, and n is not evaluated.
+ */
+#define COUNT_STAT(field, n)                                 \
+    do                                                       \
+    {                                                        \
+        struct file_stats *stats_;                           \
+        if (stats_enabled && (stats_ = current_stats()) != NULL) \
+        {                                                    \
+            stats_->field += (n);                            \
+        }                                                    \
+    } while (0)
+
+/* Prototypes */
+void enable_stats(void);
+void bind_stats(struct file_stats *stats);
+struct file_stats *current_stats(void);
+void start_phase(struct phase_timer *timer);
+void end_phase(struct phase_timer *timer, int phase);
+void end_named_phase(struct phase_timer *timer, int phase, const char *span);
+int stats_output_kind(const char *extension);
+void print_json_string(FILE *stream, const char *text);
+void print_stats(FILE *stream, int format, char **names, const struct file_stats *stats, int counter);
+
+#endif
@@ -0,0 +1,73 @@
+#define _POSIX_C_SOURCE 200809L /* open_memstream */
+#include "streamMode.h"
+#include "assemblerContext.h"
+#include "macroProcessing.h"
+#include "output.h"
+#include "protocol.h"
+
+/**
+ * @brief Assembles a source read from stdin and writes its outputs as a single frame.
+ *
+ * Nothing is read from or written to the file system: no .am file is created, and
+ * the frame holds the records of a server response (see protocol.h): the status,
+ * the diagnostics and, when the source was assembled, its ob, ent and ext records.
+ * The diagnostics are also printed on stderr, for the user of the pipeline.
+ *
+ * @param options The command line options. output_fd is where the frame goes.
+ * @return int Returns 0 if the frame was written, otherwise 1.
+ */
+int run_stream(const struct assembler_options *options)
+{
+    assembler_context ctx;
+    struct text_buffer source, message;
+    FILE *diagnostics, *outputs;
+    char *diagnostics_buffer = NULL, *outputs_buffer = NULL;
+    size_t diagnostics_size = 0, outputs_size = 0;
+    const char *status = STATUS_FAILED;
+    long diagnostics_length;
+    int result;
+
+    diagnostics = open_memstream(&diagnostics_buffer, &diagnostics_size);
+    outputs = open_memstream(&outputs_buffer, &outputs_size);
+    if (diagnostics == NULL || outputs == NULL)
+    {
+        failureExit("Memory allocation failed");
+    }
+
+    init_text_buffer(&source);
+    init_text_buffer(&message);
+    init_context(&ctx, options, diagnostics);
+    read_text_file(&source, stdin);
+
+    result = expand_macros(&ctx, source.text, source.length);
+    if (result != 0)
+    {
+        print_macro_error(result, ctx.diagnostics);
+    }
+    else if (assemble_text(&ctx, STREAM_NAME))
+    {
+        append_output_records(&ctx, outputs, &outputs_buffer, &message);
+        status = STATUS_OK;
+    }
+
+    fflush(diagnostics);
+    diagnostics_length = ftell(diagnostics);
+    append_record(&message, RECORD_STATUS, status, strlen(status));
+    append_record(&message, RECORD_DIAGNOSTICS, diagnostics_buffer, diagnostics_length);
+    fwrite(diagnostics_buffer, 1, diagnostics_length, stderr);
+
+    result = write_frame(options->output_fd, message.text, message.length);
+    if (!result)
+    {
+        fprintf(stderr, "Error: Unable to write the output to file descriptor %d\n", options->output_fd);
+    }
+
+    release_context(&ctx);
+    release_text_buffer(&source);
+    release_text_buffer(&message);
+    fclose(diagnostics);
+    fclose(outputs);
+    free(diagnostics_buffer);
+    free(outputs_buffer);
+    return !result;
+}
@@ -0,0 +1,11 @@
+#ifndef STREAMMODE_H
+#define STREAMMODE_H
+
+#include "options.h"
+
+#define STREAM_NAME "stdin" /* Name of the source read from stdin, used in the errors */
+
+/* Prototypes */
+int run_stream(const struct assembler_options *options);
+
+#endif
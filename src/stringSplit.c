@@ -1,18 +1,25 @@
+#define ALLOC_CATEGORY ALLOC_TOKENIZER /* Allocations counted by TRACK_ALLOCATIONS builds */
 #include "stringSplit.h"
 
 /**
  * @brief Split a string into substrings using a delimiter
  * 
+ * The string is copied into the buffer of the result, so the original string is
+ * left untouched and no memory is allocated. A string longer than the buffer is truncated.
+ *
+ * @param split_result The structure filled with the split strings
  * @param str The string to split
  * @param delimiter The delimiter to split the string by
- * @return struct string_split A structure containing the split strings
  */
-struct string_split split_string(char *str, const char *delimiter)
+void split_string(struct string_split *split_result, const char *str, const char *delimiter)
 {
     int strings_count = 0, in_quotes = 0;
-    struct string_split split_result = {0};
-    char *temp_str = (char *)allocateMemory(strlen(str) + 1, sizeof(char), MALLOC_ID);
-    strcpy(temp_str, str);
+    char *temp_str = split_result->buffer;
+
+    memset(split_result->string, 0, sizeof(split_result->string));
+    split_result->size = 0;
+    strncpy(temp_str, str, SPLIT_BUFFER_SIZE - 1);
+    temp_str[SPLIT_BUFFER_SIZE - 1] = NULL_BYTE;
 
     /** Skip leading whitespaces **/
     while (isspace((unsigned char)*temp_str))
@@ -20,7 +27,7 @@ struct string_split split_string(char *str, const char *delimiter)
 
     /** If the string is empty after removing whitespaces **/
     if (*temp_str == NULL_BYTE)
-        return split_result;
+        return;
 
     /*while (str && *str != '\0')*/
     while (temp_str)
@@ -39,7 +46,7 @@ struct string_split split_string(char *str, const char *delimiter)
         /** Store current string in the list **/
         if (*temp_str != NULL_BYTE)
         {
-            split_result.string[strings_count++] = temp_str;
+            split_result->string[strings_count++] = temp_str;
         }
 
         if (in_quotes)
@@ -73,14 +80,51 @@ struct string_split split_string(char *str, const char *delimiter)
     }
 
     /** Update strings counter in the list **/
-    split_result.size = strings_count;
+    split_result->size = strings_count;
 
     /* Remove '\n' from end of string if exists */
-    if (split_result.string[strings_count - 1][strlen(split_result.string[strings_count - 1]) - 1] == '\n')
+    if (split_result->string[strings_count - 1][strlen(split_result->string[strings_count - 1]) - 1] == '\n')
+    {
+        split_result->string[strings_count - 1][strlen(split_result->string[strings_count - 1]) - 1] = '\0';
+    }
+
+}
+
+/**
+ * @brief Returns the next token of a string, like strtok but reentrant
+ *
+ * @param str The string to tokenize on the first call, NULL to continue the previous one
+ * @param delimiter The characters separating the tokens
+ * @param save_ptr Pointer to where the position after the token is kept between calls
+ * @return char* The next token, or NULL if there are no more tokens
+ */
+char *next_token(char *str, const char *delimiter, char **save_ptr)
+{
+    char *token;
+
+    if (str == NULL)
+        str = *save_ptr;
+
+    /** Skip leading delimiters **/
+    str += strspn(str, delimiter);
+    if (*str == NULL_BYTE)
+    {
+        *save_ptr = str;
+        return NULL;
+    }
+
+    /** Null terminate the token and remember where the next one starts **/
+    token = str;
+    str = strpbrk(token, delimiter);
+    if (str == NULL)
+    {
+        *save_ptr = token + strlen(token);
+    }
+    else
     {
-        split_result.string[strings_count - 1][strlen(split_result.string[strings_count - 1]) - 1] = '\0';
+        *str = NULL_BYTE;
+        *save_ptr = str + 1;
     }
 
-    /** Return string_split structure **/
-    return split_result;
+    return token;
 }
@@ -5,15 +5,19 @@
 #include <ctype.h>
 #include "constants.h"
 
+#define SPLIT_BUFFER_SIZE (MAX_LINE + 2) /* Room for a line of 81 chars, '\n' and '\0' */
+
 /* Structure to hold the splitted string */
 struct string_split{
     char * string[81];
     int size;
+    char buffer[SPLIT_BUFFER_SIZE]; /* Copy of the splitted string, the strings point into it */
 };
 
 #include "helpingFunction.h"
 
 /* Functions Prototypes */
-struct string_split split_string(char * str, const char * delimiter);
+void split_string(struct string_split *split_result, const char *str, const char *delimiter);
+char *next_token(char *str, const char *delimiter, char **save_ptr);
 
 #endif
@@ -1,4 +1,5 @@
 #include "symbolTable.h"
+#include "stats.h"
 
 /**
  * @brief Searches for a symbol in the symbol table by its name.
@@ -12,6 +13,7 @@
  * @return A pointer to the symbol table node if found, otherwise NULL.
  */
 table_ptr symbol_search(table_ptr ptr, const char search_name[MAX_SYMBOL_NAME]) {
+    COUNT_STAT(symbol_lookups, 1);
     while(ptr) {
         if(strcmp(search_name, ptr -> symbol_name) == 0) {
             return ptr;
@@ -75,6 +77,7 @@ table_ptr find_extern_in_symbol_table(table_ptr ptr) {
  * @return A pointer to the external addresses node if found, otherwise NULL.
  */
 extern_addresses_ptr find_extern(extern_addresses_ptr ptr, const char search_name[MAX_SYMBOL_NAME]) {
+    COUNT_STAT(symbol_lookups, 1);
     while(ptr) {
         if(strcmp(ptr->name, search_name) == 0) {
             return ptr;
@@ -47,8 +47,8 @@ typedef struct extern_adresses {
 } extern_addresses, * extern_addresses_ptr;
 
 /* Prototypes */
-void add_symbol_to_table(char new_name[MAX_SYMBOL_NAME], int new_type, int new_address, table_ptr *ptr);
-void add_symbol_to_extern_usage(char new_name[MAX_SYMBOL_NAME], int new_address, extern_addresses_ptr * ptr);
+void add_symbol_to_table(char new_name[MAX_SYMBOL_NAME], int new_type, int new_address, table_ptr *ptr, table_ptr *pool);
+void add_symbol_to_extern_usage(char new_name[MAX_SYMBOL_NAME], int new_address, extern_addresses_ptr * ptr, extern_addresses_ptr *pool);
 table_ptr symbol_search(table_ptr ptr, const char search_name[MAX_SYMBOL_NAME]);
 table_ptr find_extern_in_symbol_table(table_ptr ptr);
 extern_addresses_ptr find_extern(extern_addresses_ptr ptr, const char search_name[MAX_SYMBOL_NAME]);
@@ -56,5 +56,7 @@ table_ptr find_entry(table_ptr ptr);
 void fprint_code_image(const translation_ptr p, FILE *file);
 void fprint_data_image(const translation_ptr p, FILE *file);
 void free_symbol_table(table_ptr *head);
+void recycle_symbol_table(table_ptr *head, table_ptr *pool);
+void recycle_extern_table(extern_addresses_ptr *head, extern_addresses_ptr *pool);
 
 #endif 
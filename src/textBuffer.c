@@ -0,0 +1,101 @@
+#define ALLOC_CATEGORY ALLOC_TEXT /* Allocations counted by TRACK_ALLOCATIONS builds */
+#include <string.h>
+#include "textBuffer.h"
+#include "helpingFunction.h"
+
+/**
+ * @brief Initializes an empty text buffer.
+ *
+ * The text is allocated lazily by the first append.
+ *
+ * @param buffer Pointer to the buffer to initialize.
+ */
+void init_text_buffer(struct text_buffer *buffer)
+{
+    buffer->text = NULL;
+    buffer->length = 0;
+    buffer->capacity = 0;
+}
+
+/**
+ * @brief Appends text to the end of a buffer, growing it if needed.
+ *
+ * @param buffer Pointer to the buffer.
+ * @param text The text to append.
+ * @param length The number of characters to append.
+ */
+void append_text(struct text_buffer *buffer, const char *text, size_t length)
+{
+    size_t new_capacity = (buffer->capacity > 0) ? buffer->capacity : TEXT_INITIAL_SIZE;
+
+    /* Keep room for the null terminator */
+    if (buffer->length + length + 1 > buffer->capacity)
+    {
+        while (buffer->length + length + 1 > new_capacity)
+        {
+            new_capacity *= 2;
+        }
+        buffer->text = (char *)reallocateMemory(buffer->text, new_capacity, sizeof(char));
+        buffer->capacity = new_capacity;
+    }
+
+    memcpy(buffer->text + buffer->length, text, length);
+    buffer->length += length;
+    buffer->text[buffer->length] = '\0';
+}
+
+/**
+ * @brief Empties a buffer while keeping its memory for the next use.
+ *
+ * @param buffer Pointer to the buffer to clear.
+ */
+void clear_text_buffer(struct text_buffer *buffer)
+{
+    buffer->length = 0;
+    if (buffer->text != NULL)
+    {
+        buffer->text[0] = '\0';
+    }
+}
+
+/**
+ * @brief Releases the memory held by a buffer.
+ *
+ * @param buffer Pointer to the buffer to release.
+ */
+void release_text_buffer(struct text_buffer *buffer)
+{
+    free(buffer->text);
+    init_text_buffer(buffer);
+}
+
+/**
+ * @brief Appends the whole content of a file to a buffer.
+ *
+ * @param buffer Pointer to the buffer.
+ * @param file The file to read, from its current position to its end.
+ */
+void read_text_file(struct text_buffer *buffer, FILE *file)
+{
+    char chunk[TEXT_READ_CHUNK];
+    size_t read_size;
+
+    while ((read_size = fread(chunk, 1, sizeof(chunk), file)) > 0)
+    {
+        append_text(buffer, chunk, read_size);
+    }
+}
+
+/**
+ * @brief Initializes a reader at the start of a text.
+ *
+ * @param reader Pointer to the reader to initialize.
+ * @param text The text to read.
+ * @param length The number of characters in the text.
+ */
+void init_text_reader(struct text_reader *reader, const char *text, size_t length)
+{
+    reader->text = text;
+    reader->length = length;
+    reader->position = 0;
+}
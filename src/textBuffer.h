@@ -0,0 +1,41 @@
+#ifndef TEXTBUFFER_H
+#define TEXTBUFFER_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+#define TEXT_INITIAL_SIZE 1024 /* Initial capacity of a text buffer */
+#define TEXT_READ_CHUNK 4096   /* Size of the chunks a file is read in */
+
+/**
+ * @brief A growable buffer of text.
+ *
+ * The text is always null terminated. Clearing a buffer only resets its length,
+ * so a buffer that is reused for the next file does not allocate again.
+ */
+struct text_buffer
+{
+    char *text;      /* The text, null terminated */
+    size_t length;   /* Number of characters in text */
+    size_t capacity; /* Number of characters allocated for text */
+};
+
+/**
+ * @brief A position in a text held in memory, for the readers of its content.
+ */
+struct text_reader
+{
+    const char *text; /* The text being read, it does not have to be null terminated */
+    size_t length;    /* Number of characters in text */
+    size_t position;  /* Index of the next character to read */
+};
+
+/* Prototypes */
+void init_text_buffer(struct text_buffer *buffer);
+void append_text(struct text_buffer *buffer, const char *text, size_t length);
+void clear_text_buffer(struct text_buffer *buffer);
+void release_text_buffer(struct text_buffer *buffer);
+void read_text_file(struct text_buffer *buffer, FILE *file);
+void init_text_reader(struct text_reader *reader, const char *text, size_t length);
+
+#endif
@@ -0,0 +1,297 @@
+#define _POSIX_C_SOURCE 200809L
+#include <pthread.h>
+#include "threadPool.h"
+#include "helpingFunction.h"
+
+/**
+ * @brief A deque of jobs owned by a worker.
+ *
+ * The owner takes jobs from the head, other workers steal from the tail once
+ * their own deque is empty.
+ */
+struct job_deque
+{
+    pthread_mutex_t lock; /* Protects head and tail */
+    int *jobs;            /* The jobs dealt to the worker, heaviest first */
+    int head;             /* Index of the next job of the owner */
+    int tail;             /* One past the index of the last job */
+};
+
+/**
+ * @brief Structure holding the state shared by the workers of run_jobs.
+ */
+struct thread_pool
+{
+    pthread_mutex_t lock;      /* Protects finished */
+    pthread_cond_t changed;    /* Signaled whenever a job finishes */
+    int jobs_counter;          /* The number of jobs */
+    struct job_deque *deques;  /* One deque per worker */
+    int deques_counter;        /* The number of deques */
+    char *finished;            /* finished[i] is set once job i is done */
+    job_function work;         /* The function run for every job */
+    void *arg;                 /* The argument passed to work */
+};
+
+/**
+ * @brief Structure holding the arguments of a single worker thread.
+ */
+struct worker
+{
+    struct thread_pool *pool; /* The shared state */
+    int index;                /* The index of the worker */
+};
+
+/**
+ * @brief A job and its weight, while the jobs are sorted.
+ */
+struct weighted_job
+{
+    long weight; /* The expected cost of the job */
+    int job;     /* The index of the job */
+};
+
+/**
+ * @brief Orders jobs from the heaviest, then by index, for qsort.
+ */
+static int compare_job_weights(const void *a, const void *b)
+{
+    const struct weighted_job *x = (const struct weighted_job *)a;
+    const struct weighted_job *y = (const struct weighted_job *)b;
+
+    if (x->weight != y->weight)
+    {
+        return (x->weight < y->weight) - (x->weight > y->weight);
+    }
+    return (x->job > y->job) - (x->job < y->job);
+}
+
+/**
+ * @brief Sorts job indexes from the heaviest, then by index.
+ *
+ * This is the order in which run_weighted_jobs starts the jobs of several workers.
+ *
+ * @param jobs_counter The number of jobs.
+ * @param weights The expected cost of every job, or NULL.
+ * @param order Receives the jobs_counter sorted job indexes.
+ */
+void sort_jobs_by_weight(int jobs_counter, const long *weights, int *order)
+{
+    struct weighted_job *sorted;
+    int i;
+
+    if (jobs_counter <= 0)
+    {
+        return;
+    }
+    sorted = (struct weighted_job *)allocateMemory(jobs_counter, sizeof(struct weighted_job), MALLOC_ID);
+    for (i = 0; i < jobs_counter; i++)
+    {
+        sorted[i].weight = (weights != NULL) ? weights[i] : 0;
+        sorted[i].job = i;
+    }
+    qsort(sorted, jobs_counter, sizeof(struct weighted_job), compare_job_weights);
+    for (i = 0; i < jobs_counter; i++)
+    {
+        order[i] = sorted[i].job;
+    }
+    free(sorted);
+}
+
+/**
+ * @brief Takes the next job of a worker: from the head of its own deque, otherwise
+ * from the tail of the deque of another worker.
+ *
+ * @param pool The shared state.
+ * @param index The index of the worker.
+ * @return int The job, or -1 once every deque is empty.
+ */
+static int take_job(struct thread_pool *pool, int index)
+{
+    struct job_deque *deque = &pool->deques[index];
+    int job = -1, i;
+
+    pthread_mutex_lock(&deque->lock);
+    if (deque->head < deque->tail)
+    {
+        job = deque->jobs[deque->head++];
+    }
+    pthread_mutex_unlock(&deque->lock);
+
+    /* Jobs are never added, so once every deque was seen empty the work is done */
+    for (i = 1; job < 0 && i < pool->deques_counter; i++)
+    {
+        deque = &pool->deques[(index + i) % pool->deques_counter];
+        pthread_mutex_lock(&deque->lock);
+        if (deque->head < deque->tail)
+        {
+            job = deque->jobs[--deque->tail];
+        }
+        pthread_mutex_unlock(&deque->lock);
+    }
+    return job;
+}
+
+/**
+ * @brief Worker thread: takes jobs until there are no jobs left.
+ *
+ * @param arg Pointer to the worker structure.
+ * @return void* Always NULL.
+ */
+static void *worker_main(void *arg)
+{
+    struct worker *worker = (struct worker *)arg;
+    struct thread_pool *pool = worker->pool;
+    int job;
+
+    while ((job = take_job(pool, worker->index)) >= 0)
+    {
+        pool->work(job, worker->index, pool->arg);
+
+        pthread_mutex_lock(&pool->lock);
+        pool->finished[job] = 1;
+        pthread_cond_broadcast(&pool->changed);
+        pthread_mutex_unlock(&pool->lock);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Runs jobs on a pool of worker threads, in index order.
+ *
+ * See run_weighted_jobs.
+ *
+ * @param jobs_counter The number of jobs to run.
+ * @param workers_counter The number of worker threads. With one worker the jobs run on the calling thread.
+ * @param work The function run for every job, on a worker thread.
+ * @param done The function called for every finished job, on the calling thread. May be NULL.
+ * @param arg The argument passed to work and done.
+ */
+void run_jobs(int jobs_counter, int workers_counter, job_function work, job_function done, void *arg)
+{
+    run_weighted_jobs(jobs_counter, workers_counter, NULL, work, done, arg);
+}
+
+/**
+ * @brief Runs jobs on a pool of worker threads, the heaviest first.
+ *
+ * The jobs are sorted by weight and dealt in turn to one deque per worker. A worker
+ * runs the jobs of its own deque, heaviest first, then steals the lightest jobs left
+ * in the deques of the others, so no worker is idle while jobs are waiting.
+ *
+ * The done function is called on the calling thread for every job, in index order,
+ * as soon as the job and all the jobs before it have finished, so anything it prints
+ * keeps the order of the jobs whatever order they ran in.
+ *
+ * @param jobs_counter The number of jobs to run.
+ * @param workers_counter The number of worker threads. With one worker the jobs run on the calling thread, in index order.
+ * @param weights The expected cost of every job, or NULL to run the jobs in index order.
+ * @param work The function run for every job, on a worker thread.
+ * @param done The function called for every finished job, on the calling thread. May be NULL.
+ * @param arg The argument passed to work and done.
+ */
+void run_weighted_jobs(int jobs_counter, int workers_counter, const long *weights, job_function work, job_function done, void *arg)
+{
+    struct thread_pool pool;
+    int *order;
+    struct worker *workers;
+    pthread_t *threads;
+    int i, j, started = 0;
+
+    if (workers_counter > jobs_counter)
+    {
+        workers_counter = jobs_counter;
+    }
+
+    /* Nothing to run in parallel */
+    if (workers_counter <= 1)
+    {
+        for (i = 0; i < jobs_counter; i++)
+        {
+            work(i, 0, arg);
+            if (done)
+            {
+                done(i, -1, arg);
+            }
+        }
+        return;
+    }
+
+    pthread_mutex_init(&pool.lock, NULL);
+    pthread_cond_init(&pool.changed, NULL);
+    pool.jobs_counter = jobs_counter;
+    pool.finished = (char *)allocateMemory(jobs_counter, sizeof(char), CALLOC_ID);
+    pool.work = work;
+    pool.arg = arg;
+
+    /* Sort the jobs, heaviest first */
+    order = (int *)allocateMemory(jobs_counter, sizeof(int), MALLOC_ID);
+    sort_jobs_by_weight(jobs_counter, weights, order);
+
+    /* Deal the jobs in turn: deque i gets jobs i, i + workers, i + 2 * workers... */
+    pool.deques_counter = workers_counter;
+    pool.deques = (struct job_deque *)allocateMemory(workers_counter, sizeof(struct job_deque), MALLOC_ID);
+    for (i = 0; i < workers_counter; i++)
+    {
+        pthread_mutex_init(&pool.deques[i].lock, NULL);
+        pool.deques[i].jobs = (int *)allocateMemory(jobs_counter / workers_counter + 1, sizeof(int), MALLOC_ID);
+        pool.deques[i].head = 0;
+        pool.deques[i].tail = 0;
+        for (j = i; j < jobs_counter; j += workers_counter)
+        {
+            pool.deques[i].jobs[pool.deques[i].tail++] = order[j];
+        }
+    }
+
+    workers = (struct worker *)allocateMemory(workers_counter, sizeof(struct worker), MALLOC_ID);
+    threads = (pthread_t *)allocateMemory(workers_counter, sizeof(pthread_t), MALLOC_ID);
+    for (i = 0; i < workers_counter; i++)
+    {
+        workers[i].pool = &pool;
+        workers[i].index = i;
+        if (pthread_create(&threads[i], NULL, worker_main, &workers[i]) != 0)
+        {
+            break;
+        }
+        started++;
+    }
+
+    /* Could not start any thread, run everything here */
+    if (started == 0)
+    {
+        worker_main(&workers[0]);
+    }
+
+    /* Report the finished jobs in order */
+    for (i = 0; i < jobs_counter; i++)
+    {
+        pthread_mutex_lock(&pool.lock);
+        while (!pool.finished[i])
+        {
+            pthread_cond_wait(&pool.changed, &pool.lock);
+        }
+        pthread_mutex_unlock(&pool.lock);
+
+        if (done)
+        {
+            done(i, -1, arg);
+        }
+    }
+
+    for (i = 0; i < started; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+
+    for (i = 0; i < workers_counter; i++)
+    {
+        pthread_mutex_destroy(&pool.deques[i].lock);
+        free(pool.deques[i].jobs);
+    }
+    pthread_cond_destroy(&pool.changed);
+    pthread_mutex_destroy(&pool.lock);
+    free(pool.deques);
+    free(order);
+    free(pool.finished);
+    free(workers);
+    free(threads);
+}
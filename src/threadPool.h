@@ -0,0 +1,18 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+/**
+ * @brief Function run for a single job.
+ *
+ * @param job_index The index of the job.
+ * @param worker_index The index of the worker running the job, -1 when called on the calling thread.
+ * @param arg The argument given to run_jobs.
+ */
+typedef void (*job_function)(int job_index, int worker_index, void *arg);
+
+/* Prototypes */
+void run_jobs(int jobs_counter, int workers_counter, job_function work, job_function done, void *arg);
+void sort_jobs_by_weight(int jobs_counter, const long *weights, int *order);
+void run_weighted_jobs(int jobs_counter, int workers_counter, const long *weights, job_function work, job_function done, void *arg);
+
+#endif
@@ -0,0 +1,194 @@
+#define _POSIX_C_SOURCE 200809L /* clock_gettime */
+#include <pthread.h>
+#include <time.h>
+#include "trace.h"
+#include "stats.h"
+#include "helpingFunction.h"
+
+int trace_enabled = 0;
+
+static pthread_key_t trace_key;                 /* The trace_thread of each thread */
+static pthread_mutex_t trace_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct trace_event *events = NULL;       /* The events recorded so far */
+static int events_counter = 0;                  /* Number of events recorded */
+static int events_capacity = 0;                 /* Number of events allocated */
+static int max_tid = 0;                         /* The highest thread ID seen */
+static double trace_origin_ms = 0;              /* Time of the start of the run, the zero of the trace */
+
+/**
+ * @brief Starts recording. Must be called before any thread binds its trace_thread.
+ *
+ * @param origin_ms The start of the run, read from CLOCK_MONOTONIC in milliseconds.
+ */
+void enable_trace(double origin_ms)
+{
+    if (!trace_enabled && pthread_key_create(&trace_key, NULL) == 0)
+    {
+        trace_origin_ms = origin_ms;
+        trace_enabled = 1;
+    }
+}
+
+/**
+ * @brief Selects the file and the thread ID the events of the current thread are recorded with.
+ *
+ * @param thread What the thread is doing, or NULL once it is done. It must stay valid until then.
+ */
+void bind_trace(const struct trace_thread *thread)
+{
+    if (trace_enabled)
+    {
+        pthread_setspecific(trace_key, thread);
+    }
+}
+
+/**
+ * @brief Appends an event, filling in the file and the thread ID of the current thread.
+ */
+static void record_event(struct trace_event *event)
+{
+    const struct trace_thread *thread = (const struct trace_thread *)pthread_getspecific(trace_key);
+
+    event->file = (thread != NULL) ? thread->file : NULL;
+    event->tid = (thread != NULL) ? thread->tid : 0;
+
+    pthread_mutex_lock(&trace_lock);
+    if (events_counter == events_capacity)
+    {
+        events_capacity = (events_capacity == 0) ? TRACE_INITIAL_EVENTS : events_capacity * 2;
+        events = (struct trace_event *)reallocateMemory(events, events_capacity, sizeof(struct trace_event));
+    }
+    events[events_counter++] = *event;
+    if (event->tid > max_tid)
+    {
+        max_tid = event->tid;
+    }
+    pthread_mutex_unlock(&trace_lock);
+}
+
+/**
+ * @brief Records a span of the current thread.
+ *
+ * @param name The name of the span.
+ * @param start_ms Its start, read from CLOCK_MONOTONIC in milliseconds.
+ * @param end_ms Its end, from the same clock.
+ */
+void trace_span(const char *name, double start_ms, double end_ms)
+{
+    struct trace_event event;
+
+    if (trace_enabled)
+    {
+        event.kind = TRACE_SPAN;
+        event.name = name;
+        event.series = NULL;
+        event.start_ms = start_ms;
+        event.end_ms = end_ms;
+        event.value = 0;
+        record_event(&event);
+    }
+}
+
+/**
+ * @brief Records the current value of a counter.
+ *
+ * @param name The name of the counter.
+ * @param series The series of the counter the value belongs to.
+ * @param value The value.
+ */
+void trace_counter(const char *name, const char *series, long value)
+{
+    struct trace_event event;
+    struct timespec ts;
+
+    if (trace_enabled)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        event.kind = TRACE_COUNTER;
+        event.name = name;
+        event.series = series;
+        event.start_ms = event.end_ms = ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+        event.value = value;
+        record_event(&event);
+    }
+}
+
+/**
+ * @brief Prints an event in the trace event format.
+ */
+static void print_event(FILE *stream, const struct trace_event *event)
+{
+    fprintf(stream, "{\"name\": ");
+    print_json_string(stream, event->name);
+    if (event->kind == TRACE_COUNTER)
+    {
+        fprintf(stream, ", \"ph\": \"C\", \"ts\": %.3f, \"pid\": %d, \"args\": {", (event->start_ms - trace_origin_ms) * 1e3,
+                TRACE_PID);
+        print_json_string(stream, event->series);
+        fprintf(stream, ": %ld}}", event->value);
+        return;
+    }
+
+    fprintf(stream, ", \"cat\": \"assembler\", \"ph\": \"X\", \"ts\": %.3f, \"dur\": %.3f, \"pid\": %d, \"tid\": %d",
+            (event->start_ms - trace_origin_ms) * 1e3, (event->end_ms - event->start_ms) * 1e3, TRACE_PID, event->tid);
+    if (event->file != NULL)
+    {
+        fprintf(stream, ", \"args\": {\"file\": ");
+        print_json_string(stream, event->file);
+        fprintf(stream, "}");
+    }
+    fprintf(stream, "}");
+}
+
+/**
+ * @brief Writes the recorded events as Chrome trace event JSON, then frees them.
+ *
+ * The file loads in chrome://tracing and in Perfetto. Each worker is a thread of its own.
+ *
+ * @param path The file to write.
+ * @return int Returns 1 if the trace was written, otherwise 0.
+ */
+int write_trace(const char *path)
+{
+    FILE *file = fopen(path, "w");
+    int i, success;
+
+    if (file == NULL)
+    {
+        fprintf(stderr, "Error: Unable to create the trace %s\n", path);
+        return 0;
+    }
+
+    fprintf(file, "{\"traceEvents\": [\n");
+    for (i = 0; i < events_counter; i++)
+    {
+        print_event(file, &events[i]);
+        fprintf(file, ",\n");
+    }
+    for (i = 0; i <= max_tid; i++)
+    {
+        fprintf(file, "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": %d, \"tid\": %d, \"args\": {\"name\": ", TRACE_PID, i);
+        if (i == 0)
+        {
+            fprintf(file, "\"main\"}},\n");
+        }
+        else
+        {
+            fprintf(file, "\"worker %d\"}},\n", i);
+        }
+    }
+    fprintf(file, "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": %d, \"args\": {\"name\": \"assembler\"}}\n", TRACE_PID);
+    fprintf(file, "], \"displayTimeUnit\": \"ms\"}\n");
+
+    success = !ferror(file);
+    if (fclose(file) != 0 || !success)
+    {
+        fprintf(stderr, "Error: Unable to write the trace %s\n", path);
+        success = 0;
+    }
+
+    free(events);
+    events = NULL;
+    events_counter = events_capacity = 0;
+    return success;
+}
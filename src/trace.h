@@ -0,0 +1,51 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdio.h>
+
+#define TRACE_INITIAL_EVENTS 1024 /* Initial capacity of the buffer of events */
+#define TRACE_PID 1               /* Process ID of every event, the trace covers a single run */
+
+/* The kinds of trace events */
+enum trace_kind
+{
+    TRACE_SPAN,   /* A complete event, "X" */
+    TRACE_COUNTER /* A counter event, "C" */
+};
+
+/**
+ * @brief An event of the trace, kept in memory until write_trace.
+ *
+ * Names are not copied: they must stay valid until the trace is written.
+ */
+struct trace_event
+{
+    int kind;           /* One of enum trace_kind */
+    const char *name;   /* Name of the span or of the counter */
+    const char *file;   /* The file being assembled, or NULL */
+    const char *series; /* The series of a counter */
+    double start_ms;    /* Start of the span, or time of the counter */
+    double end_ms;      /* End of the span */
+    long value;         /* Value of a counter */
+    int tid;            /* The thread the event happened on */
+};
+
+/**
+ * @brief What a thread is doing, set by bind_trace.
+ */
+struct trace_thread
+{
+    const char *file; /* The file the thread assembles */
+    int tid;          /* Thread ID in the trace: 0 for the main thread, then one per worker */
+};
+
+extern int trace_enabled; /* Set by enable_trace, nothing is recorded otherwise */
+
+/* Prototypes */
+void enable_trace(double origin_ms);
+void bind_trace(const struct trace_thread *thread);
+void trace_span(const char *name, double start_ms, double end_ms);
+void trace_counter(const char *name, const char *series, long value);
+int write_trace(const char *path);
+
+#endif
@@ -1,23 +1,106 @@
+#define ALLOC_CATEGORY ALLOC_CODE /* Allocations counted by TRACK_ALLOCATIONS builds */
 #include "translate.h"
+#include "helpingFunction.h"
 
 /**
- * @brief Frees the memory used by the machine code and data image arrays.
+ * @brief Grows an image so that it can hold the word at the given index.
  *
- * This function resets the machine code and data image arrays to zero,
- * effectively freeing the resources used by these arrays. It also resets
- * the instruction counter (IC) and data counter (DC) to zero.
+ * The capacity is doubled until the index fits, and the new words are zeroed
+ * so that unused addresses keep reading as empty words.
+ *
+ * @param image    Pointer to the image to grow.
+ * @param capacity Pointer to the current capacity of the image, in words.
+ * @param index    The index that must fit inside the image.
+ */
+static void grow_image(uint16_t **image, int *capacity, int index)
+{
+    int new_capacity = (*capacity > 0) ? *capacity : IMAGE_INITIAL_SIZE;
+
+    while (index >= new_capacity)
+    {
+        new_capacity *= 2;
+    }
+
+    *image = (uint16_t *)reallocateMemory(*image, new_capacity, sizeof(uint16_t));
+    memset(*image + *capacity, 0, (new_capacity - *capacity) * sizeof(uint16_t));
+    *capacity = new_capacity;
+}
+
+/**
+ * @brief Initializes an empty translation with the given memory limit.
+ *
+ * The images are allocated lazily by the first store, so an empty program
+ * does not cost any memory.
+ *
+ * @param machine_code_ptr Pointer to the translation structure to initialize.
+ * @param mem_size         Maximum number of words the program may occupy.
+ */
+void init_machine_code(translation_ptr machine_code_ptr, int mem_size)
+{
+    machine_code_ptr->code_image = NULL;
+    machine_code_ptr->code_capacity = 0;
+    machine_code_ptr->IC = 0;
+    machine_code_ptr->data_image = NULL;
+    machine_code_ptr->data_capacity = 0;
+    machine_code_ptr->DC = 0;
+    machine_code_ptr->mem_size = mem_size;
+}
+
+/**
+ * @brief Stores a word in the code image, growing it if needed.
+ *
+ * @param machine_code_ptr Pointer to the translation structure.
+ * @param address          The address of the word (the IC it was coded at).
+ * @param word             The word to store. Only the low WORD_BITS bits are kept.
+ */
+void store_code_word(translation_ptr machine_code_ptr, int address, int word)
+{
+    if (address >= machine_code_ptr->code_capacity)
+    {
+        grow_image(&machine_code_ptr->code_image, &machine_code_ptr->code_capacity, address);
+    }
+    machine_code_ptr->code_image[address] = (uint16_t)(word & WORD_MASK);
+}
+
+/**
+ * @brief Stores a word in the data image, growing it if needed.
+ *
+ * @param machine_code_ptr Pointer to the translation structure.
+ * @param address          The index of the word in the data image (the DC it was coded at).
+ * @param word             The word to store. Only the low WORD_BITS bits are kept.
+ */
+void store_data_word(translation_ptr machine_code_ptr, int address, int word)
+{
+    if (address >= machine_code_ptr->data_capacity)
+    {
+        grow_image(&machine_code_ptr->data_image, &machine_code_ptr->data_capacity, address);
+    }
+    machine_code_ptr->data_image[address] = (uint16_t)(word & WORD_MASK);
+}
+
+/**
+ * @brief Resets the machine code so the next file starts with empty images.
+ *
+ * Only the instruction counter (IC) and data counter (DC) are reset. Every word
+ * below the counters is rewritten before it is read again, so the images keep
+ * their memory and contents for the next file.
  *
  * @param machine_code_ptr Pointer to the translation structure that holds
  *                         the machine code and data image arrays.
  */
 void free_machine_code(translation_ptr machine_code_ptr) {
-    int i = 0;
-    for (i = 0; i < (machine_code_ptr->IC - 100); i++) {
-        machine_code_ptr->code_image[i] = 0;
-    }
-    for (i = 0; i < machine_code_ptr->DC; i++) {
-        machine_code_ptr->data_image[i] = 0;
-    }
     machine_code_ptr->IC = 0;
     machine_code_ptr->DC = 0;
 }
+
+/**
+ * @brief Releases the memory held by the code and data images.
+ *
+ * @param machine_code_ptr Pointer to the translation structure to release.
+ */
+void release_machine_code(translation_ptr machine_code_ptr)
+{
+    free(machine_code_ptr->code_image);
+    free(machine_code_ptr->data_image);
+    init_machine_code(machine_code_ptr, machine_code_ptr->mem_size);
+}
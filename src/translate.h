@@ -1,25 +1,37 @@
 #ifndef TRANSLATION_H
 #define TRANSLATION_H
 
-#define MAX_MEM_SIZE 4096
+#include <stdint.h>
+#include "targetDesc.h"
+
+/* Words an operand of the target addresses: the default --mem-size and its largest value */
+#define MAX_MEM_SIZE (1 << TARGET_ADDRESS_BITS)
+#define IMAGE_INITIAL_SIZE 256 /* Initial capacity of the code and data images */
+#define WORD_BITS TARGET_WORD_BITS /* Width of a machine word */
+#define WORD_MASK TARGET_WORD_MASK
 
 /**
  * @brief A structure to hold the translation of machine code and data.
  *
- * This structure contains arrays for storing the machine code and data image,
- * as well as Instruction counter and Data counter.
+ * This structure contains growable images for storing the machine code and data,
+ * as well as Instruction counter and Data counter. Words are packed as 16-bit
+ * values since a machine word is only 15 bits wide. The images keep their
+ * capacity between files, so resetting them only resets the counters.
  */
 typedef struct translation {
-    int code_image[MAX_MEM_SIZE];
+    uint16_t *code_image; /* Code words, indexed by address */
+    int code_capacity;    /* Number of words allocated for code_image */
     int IC;
-    int data_image[MAX_MEM_SIZE];
+    uint16_t *data_image; /* Data words, indexed by DC */
+    int data_capacity;    /* Number of words allocated for data_image */
     int DC;
+    int mem_size;         /* Maximum number of words the program may occupy */
 } translation, * translation_ptr;
 
-/* External references to the machine code and its pointer */
-extern translation machine_code;
-extern translation_ptr machine_code_ptr;
-
+void init_machine_code(translation_ptr machine_code_ptr, int mem_size);
+void store_code_word(translation_ptr machine_code_ptr, int address, int word);
+void store_data_word(translation_ptr machine_code_ptr, int address, int word);
 void free_machine_code(translation_ptr machine_code_ptr);
+void release_machine_code(translation_ptr machine_code_ptr);
 
 #endif
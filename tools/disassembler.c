@@ -0,0 +1,615 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lineParser.h"
+#include "symbolTable.h"
+
+/*
+ * Turns an object file back into a source that assembles to the same image.
+ *
+ * Usage: disassembler [-o OUTPUT.as] FILE
+ *
+ * FILE is given without extension, as to the assembler: FILE.ob is read with FILE.ent
+ * and FILE.ext when they exist. The entries give their names back to their addresses and
+ * the external uses name the words they are patched into. Every other address a word
+ * refers to gets a generated label. The first word of an instruction is decoded with a
+ * table indexed by its opcode and mode bits, built from inst_table, so only the operands
+ * the assembler accepts are decoded. The source is written to OUTPUT.as, or to stdout.
+ */
+
+#define DIS_LOAD_ADDRESS TARGET_LOAD_BASE      /* Address of the first code word, as in secondPass */
+#define DIS_ADDRESS_LIMIT TARGET_ADDRESS_SPACE /* Addresses are the bits of an operand word */
+#define DIS_LINE_LENGTH (MAX_LINE_LENGTH - 2) /* Characters of a line, without '\n' and '\0' */
+#define DIS_NAME_SIZE 64         /* Size of the buffer a name is read into */
+#define DECODE_TABLE_SIZE (1 << (WORD_BITS - TARGET_DEST_MODE_SHIFT)) /* Every first word, without its A/R/E bits */
+#define DECODE_INDEX(word) ((word) >> TARGET_DEST_MODE_SHIFT)
+#define IMMEDIATE_SIGN_BIT (DIS_ADDRESS_LIMIT >> 1) /* The top bit of an operand */
+#define DATA_SIGN_BIT (1 << (WORD_BITS - 1))
+#define ARE_ABSOLUTE (1 << TARGET_ARE_ABSOLUTE)
+#define ARE_RELOCATABLE (1 << TARGET_ARE_RELOCATABLE)
+#define ARE_EXTERNAL (1 << TARGET_ARE_EXTERNAL)
+#define ARE_MASK (ARE_ABSOLUTE | ARE_RELOCATABLE | ARE_EXTERNAL)
+#define DIS_EXTERN_SLOTS (2 * DIS_ADDRESS_LIMIT) /* Slots of the set of declared externs, at most half full */
+#define NO_OPERAND (-1)
+#define REGISTER_MODE(mode) ((mode) == ast_register_address || (mode) == ast_register_direct)
+#define WORDS_MODE(mode) (((mode) == NO_OPERAND) ? ast_none : (mode)) /* A mode as TARGET_INSTRUCTION_WORDS takes it */
+
+/**
+ * @brief What the first word of an instruction decodes to.
+ */
+struct decode_entry
+{
+    const char *name; /* Name of the instruction, NULL if the word does not start one */
+    int source_mode;  /* Type of the source operand (enum of the ast), or NO_OPERAND */
+    int target_mode;  /* Type of the destination or single operand, or NO_OPERAND */
+    int length;       /* Number of words of the instruction */
+};
+
+/**
+ * @brief The image being disassembled and the names found for its addresses.
+ */
+struct program
+{
+    uint16_t words[DIS_ADDRESS_LIMIT];
+    int code_end;                                     /* Address after the last code word */
+    int data_end;                                     /* Address after the last data word */
+    char labels[DIS_ADDRESS_LIMIT][MAX_SYMBOL_NAME];  /* Label of an address, empty if it has none */
+    char externs[DIS_ADDRESS_LIMIT][MAX_SYMBOL_NAME]; /* External symbol used by a word, empty if none */
+    char is_entry[DIS_ADDRESS_LIMIT];                 /* 1 if the label of the address is an entry */
+    char is_start[DIS_ADDRESS_LIMIT];                 /* 1 if an instruction starts at the address */
+};
+
+static struct decode_entry decode_table[DECODE_TABLE_SIZE];
+
+/**
+ * @brief Finds the addressing mode of a one-hot field of a first word.
+ *
+ * @return int The mode, NO_OPERAND if no bit is set, or -2 if more than one is.
+ */
+static int one_hot_mode(int bits)
+{
+    int mode;
+
+    if (bits == 0)
+    {
+        return NO_OPERAND;
+    }
+    for (mode = 0; !(bits & (1 << mode)); mode++)
+        ;
+    return (bits == (1 << mode)) ? mode : -2;
+}
+
+/**
+ * @brief Checks that an operand has a mode the instruction accepts, or is absent when none is.
+ *
+ * @param modes The valid modes of inst_table, as digits.
+ * @param mode The decoded mode.
+ */
+static int valid_mode(const char *modes, int mode)
+{
+    return (mode == NO_OPERAND) ? modes[0] == '\0' : mode >= 0 && modes[0] != '\0' && strchr(modes, '0' + mode) != NULL;
+}
+
+/**
+ * @brief Decodes every possible first word once, as secondPass encodes them.
+ */
+static void build_decode_table(void)
+{
+    struct decode_entry *entry;
+    const struct inst *inst;
+    int index, operation;
+
+    for (index = 0; index < DECODE_TABLE_SIZE; index++)
+    {
+        entry = &decode_table[index];
+        operation = TARGET_OPERATION(index >> (TARGET_OPCODE_SHIFT - TARGET_DEST_MODE_SHIFT));
+        entry->source_mode = one_hot_mode((index >> (TARGET_SOURCE_MODE_SHIFT - TARGET_DEST_MODE_SHIFT)) & 0xF);
+        entry->target_mode = one_hot_mode(index & 0xF);
+        inst = &inst_table[(operation < 0) ? 0 : operation];
+        if (operation < 0 || !valid_mode(inst->source, entry->source_mode) || !valid_mode(inst->dest, entry->target_mode))
+        {
+            entry->name = NULL;
+            continue;
+        }
+        entry->name = inst->name;
+        entry->length = TARGET_INSTRUCTION_WORDS(WORDS_MODE(entry->source_mode), WORDS_MODE(entry->target_mode));
+    }
+}
+
+/**
+ * @brief Reads an object file written by createObFile.
+ *
+ * @return int Returns 1 if the file was read, otherwise 0 after printing why.
+ */
+static int load_object(struct program *program, const char *path)
+{
+    char octal[16], *end;
+    int code_length, data_length, address, line = 1, valid = 1;
+    long word;
+    FILE *file;
+
+    if ((file = fopen(path, "r")) == NULL)
+    {
+        printf("Error: Unable to read %s\n", path);
+        return 0;
+    }
+    if (fscanf(file, "%d %d", &code_length, &data_length) != 2 || code_length < 0 || data_length < 0 ||
+        DIS_LOAD_ADDRESS + code_length + data_length > DIS_ADDRESS_LIMIT)
+    {
+        printf("Error: In file %s the header is not valid\n", path);
+        fclose(file);
+        return 0;
+    }
+    program->code_end = DIS_LOAD_ADDRESS + code_length;
+    program->data_end = program->code_end + data_length;
+
+    /* Words missing from the file are zero, as createObFile skips them */
+    while (valid && fscanf(file, "%d %15s", &address, octal) == 2)
+    {
+        line++;
+        word = strtol(octal, &end, 8);
+        if (*end != '\0' || word < 0 || word > WORD_MASK || address < DIS_LOAD_ADDRESS || address >= program->data_end)
+        {
+            printf("Error: In file %s line %d is not a word of the program\n", path, line);
+            valid = 0;
+        }
+        else
+        {
+            program->words[address] = (uint16_t)word;
+        }
+    }
+    if (valid && !feof(file))
+    {
+        printf("Error: In file %s line %d cannot be read\n", path, line + 1);
+        valid = 0;
+    }
+    fclose(file);
+    return valid;
+}
+
+/**
+ * @brief Reads the names and addresses of a .ent or .ext file into a table of names by address.
+ *
+ * A missing file has no names.
+ *
+ * @param names The table the names are stored in.
+ * @param flags Set to 1 at the address of every name read, may be NULL.
+ * @return int The number of errors found.
+ */
+static int load_names(const struct program *program, const char *path, char names[][MAX_SYMBOL_NAME], char *flags)
+{
+    char name[DIS_NAME_SIZE];
+    int address, errors = 0;
+    FILE *file = fopen(path, "r");
+
+    if (file == NULL)
+    {
+        return 0;
+    }
+    while (fscanf(file, "%63s %d", name, &address) == 2)
+    {
+        if (strlen(name) >= MAX_SYMBOL_NAME || address < DIS_LOAD_ADDRESS || address >= program->data_end)
+        {
+            printf("Error: In file %s the symbol %s at address %d is not valid\n", path, name, address);
+            errors++;
+            continue;
+        }
+        strcpy(names[address], name);
+        if (flags != NULL)
+        {
+            flags[address] = 1;
+        }
+    }
+    fclose(file);
+    return errors;
+}
+
+/**
+ * @brief Picks a prefix for the generated labels that no entry or external symbol can clash with.
+ *
+ * The generated labels are the prefix followed by 4 digits of the address. The prefix
+ * grows until no name read from the .ent and .ext files has that form.
+ */
+static void pick_label_prefix(const struct program *program, char *prefix, int size)
+{
+    const char *name;
+    int address, table, length, clash;
+
+    strcpy(prefix, "L");
+    do
+    {
+        clash = 0;
+        length = (int)strlen(prefix);
+        for (table = 0; table < 2 && !clash; table++)
+        {
+            for (address = DIS_LOAD_ADDRESS; address < program->data_end && !clash; address++)
+            {
+                name = table ? program->externs[address] : program->labels[address];
+                clash = strncmp(name, prefix, length) == 0 && strlen(name) == (size_t)length + 4 &&
+                        strspn(name + length, "0123456789") == 4;
+            }
+        }
+        if (clash && length < size - 1)
+        {
+            strcat(prefix, "L");
+        }
+    } while (clash && length < size - 1);
+}
+
+/**
+ * @brief Checks the word of an operand and names the address it refers to.
+ *
+ * A label is a relocatable word, which gets a label at its address, or an external word
+ * listed in the .ext file. Any other operand is an absolute word.
+ *
+ * @return int The number of errors found.
+ */
+static int scan_operand(struct program *program, const char *path, const char *prefix, int mode, int address)
+{
+    int word = program->words[address], tag = word & ARE_MASK, target = word >> TARGET_OPERAND_SHIFT;
+
+    if (mode != ast_label && tag != ARE_ABSOLUTE)
+    {
+        printf("Error: In file %s the word at address %d is not an absolute operand\n", path, address);
+        return 1;
+    }
+    if (mode == ast_label && tag == ARE_EXTERNAL && program->externs[address][0] == '\0')
+    {
+        printf("Error: In file %s the external word at address %d has no symbol in the .ext file\n", path, address);
+        return 1;
+    }
+    if (mode == ast_label && tag == ARE_RELOCATABLE)
+    {
+        if (target < DIS_LOAD_ADDRESS || target >= program->data_end)
+        {
+            printf("Error: In file %s the word at address %d refers to %d, outside the program\n", path, address,
+                   target);
+            return 1;
+        }
+        if (program->labels[target][0] == '\0')
+        {
+            sprintf(program->labels[target], "%s%04d", prefix, target);
+        }
+        return 0;
+    }
+    if (mode == ast_label && tag != ARE_EXTERNAL)
+    {
+        printf("Error: In file %s the word at address %d is not a label operand\n", path, address);
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Decodes the code, checks the words of the operands and names the addresses they refer to.
+ *
+ * @return int The number of errors found.
+ */
+static int scan_code(struct program *program, const char *path, const char *prefix)
+{
+    const struct decode_entry *entry;
+    int address, word, errors = 0;
+
+    for (address = DIS_LOAD_ADDRESS; address < program->code_end; address += entry->length)
+    {
+        word = program->words[address];
+        entry = &decode_table[DECODE_INDEX(word)];
+        if ((word & ARE_MASK) != ARE_ABSOLUTE || entry->name == NULL || address + entry->length > program->code_end)
+        {
+            printf("Error: In file %s the word at address %d does not start an instruction\n", path, address);
+            return errors + 1;
+        }
+        program->is_start[address] = 1;
+
+        if (entry->source_mode != NO_OPERAND)
+        {
+            errors += scan_operand(program, path, prefix, entry->source_mode, address + 1);
+        }
+        if (entry->target_mode != NO_OPERAND && entry->length > 2)
+        {
+            errors += scan_operand(program, path, prefix, entry->target_mode, address + 2);
+        }
+        else if (entry->target_mode != NO_OPERAND && entry->source_mode == NO_OPERAND)
+        {
+            errors += scan_operand(program, path, prefix, entry->target_mode, address + 1);
+        }
+    }
+
+    /* A label in the code must be on the first word of an instruction */
+    for (address = DIS_LOAD_ADDRESS; address < program->code_end; address++)
+    {
+        if (program->labels[address][0] != '\0' && !program->is_start[address])
+        {
+            printf("Error: In file %s the label %s is inside the instruction before address %d\n", path,
+                   program->labels[address], address);
+            errors++;
+        }
+    }
+    return errors;
+}
+
+/**
+ * @brief Writes a line of the source, its label first.
+ *
+ * @return int Returns 1 if the line fits in a source line, otherwise 0.
+ */
+static int write_line(FILE *output, const struct program *program, int address, const char *text)
+{
+    const char *label = (address > 0) ? program->labels[address] : "";
+
+    if (label[0] != '\0')
+    {
+        fprintf(output, "%s:\t%s\n", label, text);
+    }
+    else
+    {
+        fprintf(output, "\t%s\n", text);
+    }
+    return strlen(label) + 2 + strlen(text) <= DIS_LINE_LENGTH;
+}
+
+/**
+ * @brief Appends an operand to the text of an instruction.
+ *
+ * @param word The word the operand is coded in.
+ * @param shift The bit its register number starts at: TARGET_SOURCE_REGISTER_SHIFT for a register source,
+ * otherwise TARGET_OPERAND_SHIFT.
+ */
+static void append_operand(char *text, const struct program *program, int mode, int address, int shift)
+{
+    int word = program->words[address];
+
+    text += strlen(text);
+    switch (mode)
+    {
+    case ast_immidiate:
+        sprintf(text, "#%d", ((((word >> TARGET_OPERAND_SHIFT) & (DIS_ADDRESS_LIMIT - 1)) ^ IMMEDIATE_SIGN_BIT) - IMMEDIATE_SIGN_BIT));
+        break;
+    case ast_label:
+        strcpy(text, ((word & ARE_MASK) == ARE_EXTERNAL) ? program->externs[address] : program->labels[word >> TARGET_OPERAND_SHIFT]);
+        break;
+    case ast_register_address:
+        sprintf(text, "*r%d", (word >> shift) & TARGET_REGISTER_MASK);
+        break;
+    default:
+        sprintf(text, "r%d", (word >> shift) & TARGET_REGISTER_MASK);
+        break;
+    }
+}
+
+/**
+ * @brief Writes an instruction.
+ *
+ * @return int Returns 1 if the line fits in a source line, otherwise 0.
+ */
+static int write_instruction(FILE *output, const struct program *program, int address, const struct decode_entry *entry)
+{
+    char text[4 * MAX_SYMBOL_NAME];
+
+    sprintf(text, "%s", entry->name);
+    if (entry->source_mode != NO_OPERAND)
+    {
+        strcat(text, " ");
+        append_operand(text, program, entry->source_mode, address + 1,
+                       REGISTER_MODE(entry->source_mode) ? TARGET_SOURCE_REGISTER_SHIFT : TARGET_OPERAND_SHIFT);
+        strcat(text, ", ");
+        append_operand(text, program, entry->target_mode, address + entry->length - 1, TARGET_OPERAND_SHIFT);
+    }
+    else if (entry->target_mode != NO_OPERAND)
+    {
+        strcat(text, " ");
+        append_operand(text, program, entry->target_mode, address + 1, TARGET_OPERAND_SHIFT);
+    }
+    return write_line(output, program, address, text);
+}
+
+/**
+ * @brief Finds the length of a string that can be written as .string at an address.
+ *
+ * @return int The number of characters before its terminating zero, or 0 if there is no such string.
+ */
+static int string_length(const struct program *program, int address)
+{
+    int end;
+
+    for (end = address; end < program->data_end; end++)
+    {
+        if (end > address && program->labels[end][0] != '\0')
+        {
+            return 0; /* A label inside the string */
+        }
+        if (program->words[end] == 0)
+        {
+            return end - address;
+        }
+        /* Printable, without the quote and the separators of the parser */
+        if (program->words[end] < ' ' || program->words[end] > '~' || strchr("\",;", program->words[end]) != NULL)
+        {
+            return 0;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Writes the data, as .string where the words are a string and as .data otherwise.
+ *
+ * @return int The number of lines too long for a source line.
+ */
+static int write_data(FILE *output, const struct program *program)
+{
+    char text[DIS_LINE_LENGTH * 2], number[16];
+    int address = program->code_end, length, prefix, i, too_long = 0;
+
+    while (address < program->data_end)
+    {
+        prefix = (int)strlen(program->labels[address]) + 2;
+        length = string_length(program, address);
+        if (length > 0 && prefix + length + (int)strlen(".string \"\"") <= DIS_LINE_LENGTH)
+        {
+            strcpy(text, ".string \"");
+            for (i = 0; i < length; i++)
+            {
+                text[9 + i] = (char)program->words[address + i];
+            }
+            strcpy(text + 9 + length, "\"");
+            too_long += !write_line(output, program, address, text);
+            address += length + 1;
+            continue;
+        }
+
+        /* As many numbers as fit in the line, up to the next label */
+        strcpy(text, ".data ");
+        for (i = address; i < program->data_end && (i == address || program->labels[i][0] == '\0'); i++)
+        {
+            sprintf(number, "%s%d", (i == address) ? "" : ", ", ((program->words[i] ^ DATA_SIGN_BIT) - DATA_SIGN_BIT));
+            if (i > address && prefix + strlen(text) + strlen(number) > DIS_LINE_LENGTH)
+            {
+                break;
+            }
+            strcat(text, number);
+        }
+        too_long += !write_line(output, program, address, text);
+        address = i;
+    }
+    return too_long;
+}
+
+/**
+ * @brief Hashes a name with FNV-1a, like the entry table of tools/linker.c.
+ */
+static unsigned long hash_name(const char *name)
+{
+    unsigned long hash = 2166136261UL;
+
+    while (*name != '\0')
+    {
+        hash = ((hash ^ (unsigned char)*name++) * 16777619UL) & 0xFFFFFFFFUL;
+    }
+    return hash;
+}
+
+/**
+ * @brief Adds the external symbol used at an address to the set of the declared ones.
+ *
+ * @param slots The set: the address of the first use of every symbol declared plus one,
+ *              or 0 for a free slot, probed linearly from the hash of the name.
+ * @return int Returns 1 if the symbol was not declared yet, otherwise 0.
+ */
+static int declare_extern(int *slots, const struct program *program, int address)
+{
+    const char *name = program->externs[address];
+    unsigned long i = hash_name(name) & (DIS_EXTERN_SLOTS - 1);
+
+    while (slots[i] != 0)
+    {
+        if (strcmp(program->externs[slots[i] - 1], name) == 0)
+        {
+            return 0;
+        }
+        i = (i + 1) & (DIS_EXTERN_SLOTS - 1);
+    }
+    slots[i] = address + 1;
+    return 1;
+}
+
+/**
+ * @brief Writes the source: the externs, the entries, the code and the data.
+ *
+ * @return int The number of lines too long for a source line.
+ */
+static int write_source(FILE *output, const struct program *program, const char *path)
+{
+    char text[2 * MAX_SYMBOL_NAME];
+    const struct decode_entry *entry;
+    static int declared[DIS_EXTERN_SLOTS]; /* The external symbols declared, see declare_extern */
+    int address, too_long = 0;
+
+    fprintf(output, "; Disassembled from %s\n", path);
+
+    /* Declare every external symbol once, in the order of its first use */
+    for (address = DIS_LOAD_ADDRESS; address < program->code_end; address++)
+    {
+        if (program->externs[address][0] != '\0' && declare_extern(declared, program, address))
+        {
+            sprintf(text, ".extern %s", program->externs[address]);
+            too_long += !write_line(output, program, 0, text);
+        }
+    }
+    for (address = DIS_LOAD_ADDRESS; address < program->data_end; address++)
+    {
+        if (program->is_entry[address])
+        {
+            sprintf(text, ".entry %s", program->labels[address]);
+            too_long += !write_line(output, program, 0, text);
+        }
+    }
+
+    for (address = DIS_LOAD_ADDRESS; address < program->code_end; address += entry->length)
+    {
+        entry = &decode_table[DECODE_INDEX(program->words[address])];
+        too_long += !write_instruction(output, program, address, entry);
+    }
+    return too_long + write_data(output, program);
+}
+
+int main(int argc, char **argv)
+{
+    static struct program program; /* Too large for the stack */
+    char prefix[MAX_SYMBOL_NAME - 4], *path;
+    const char *base, *output_path = NULL;
+    FILE *output = stdout;
+    int errors, too_long;
+
+    if (argc == 4 && strcmp(argv[1], "-o") == 0)
+    {
+        output_path = argv[2];
+    }
+    else if (argc != 2)
+    {
+        fprintf(stderr, "Usage: %s [-o OUTPUT.as] FILE\n", argv[0]);
+        return 2;
+    }
+    base = argv[argc - 1];
+    path = (char *)allocateMemory(strlen(base) + 5, sizeof(char), MALLOC_ID);
+    build_decode_table();
+
+    sprintf(path, "%s.ob", base);
+    if (!load_object(&program, path))
+    {
+        free(path);
+        return 1;
+    }
+    sprintf(path, "%s.ent", base);
+    errors = load_names(&program, path, program.labels, program.is_entry);
+    sprintf(path, "%s.ext", base);
+    errors += load_names(&program, path, program.externs, NULL);
+    pick_label_prefix(&program, prefix, sizeof(prefix));
+    sprintf(path, "%s.ob", base);
+    errors += scan_code(&program, path, prefix);
+
+    if (errors == 0 && output_path != NULL && (output = fopen(output_path, "w")) == NULL)
+    {
+        fprintf(stderr, "Could not open the file %s for writing\n", output_path);
+        errors++;
+    }
+    if (errors > 0)
+    {
+        free(path);
+        return 1;
+    }
+
+    too_long = write_source(output, &program, path);
+    if (too_long > 0)
+    {
+        printf("Error: In file %s %d lines are longer than %d characters and will not assemble\n", path, too_long,
+               DIS_LINE_LENGTH);
+    }
+    if (output != stdout && fclose(output) != 0)
+    {
+        fprintf(stderr, "Error: Unable to write %s\n", output_path);
+        too_long++;
+    }
+    free(path);
+    return too_long ? 1 : 0;
+}
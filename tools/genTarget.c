@@ -0,0 +1,379 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Generates the target description header of the assembler from a target file.
+ *
+ * Usage: genTarget TARGET.tgt [OUTPUT.h]
+ *
+ * A target file has one setting per line, "key value", and one "instruction NAME OPCODE
+ * SOURCE_MODES DEST_MODES" line per operation of the parser, in its order (mov, cmp, add,
+ * sub, lea, clr, not, inc, dec, jmp, bne, red, prn, jsr, rts, stop). Lines starting with #
+ * are comments. The layout of the words is checked, and the ranges of the immediates and
+ * of the data, the size of the address space and the octal width of a word are derived
+ * from it. The header is written to OUTPUT.h, or to stdout.
+ */
+
+#define TGT_LINE_SIZE 256       /* Longest line of a target file */
+#define TGT_NAME_SIZE 32        /* Longest target or instruction name, with its null byte */
+#define TGT_INSTRUCTIONS 16     /* The operations of the parser, see inst_type in lineParser.h */
+#define TGT_MODES 4             /* Immediate, label, indirect register, register */
+#define TGT_MAX_WORD_BITS 16    /* The images hold 16-bit words */
+
+/* The numeric settings of a target, in the order of setting_names */
+enum setting
+{
+    WORD_BITS, LOAD_BASE, REGISTERS, ARE_ABSOLUTE, ARE_RELOCATABLE, ARE_EXTERNAL, DEST_MODE_SHIFT,
+    SOURCE_MODE_SHIFT, OPCODE_SHIFT, OPERAND_SHIFT, SOURCE_REGISTER_SHIFT, SHARED_REGISTER_WORD,
+    SETTING_COUNT
+};
+
+static const char *setting_names[SETTING_COUNT] = {
+    "word_bits", "load_base", "registers", "are_absolute", "are_relocatable", "are_external", "dest_mode_shift",
+    "source_mode_shift", "opcode_shift", "operand_shift", "source_register_shift", "shared_register_word"};
+
+/**
+ * @brief An instruction of a target file.
+ */
+struct tgt_instruction
+{
+    char name[TGT_NAME_SIZE];
+    int opcode;
+    char source[TGT_MODES + 1]; /* The digits of the modes, empty for no operand */
+    char dest[TGT_MODES + 1];
+};
+
+/**
+ * @brief The content of a target file.
+ */
+struct target
+{
+    char name[TGT_NAME_SIZE];
+    long settings[SETTING_COUNT];
+    int set[SETTING_COUNT]; /* Whether each setting was given */
+    struct tgt_instruction instructions[TGT_INSTRUCTIONS];
+    int instructions_counter;
+};
+
+/**
+ * @brief Returns the number of bits needed to hold the values 0 to max.
+ */
+static int bits_for(long max)
+{
+    int bits = 0;
+
+    while (max > 0)
+    {
+        bits++;
+        max >>= 1;
+    }
+    return bits;
+}
+
+/**
+ * @brief Reads the modes of an operand: digits 0 to 3, or - for none.
+ *
+ * @return int Returns 1 if the modes are valid, otherwise 0.
+ */
+static int read_modes(const char *text, char *modes)
+{
+    int i;
+
+    if (strcmp(text, "-") == 0)
+    {
+        modes[0] = '\0';
+        return 1;
+    }
+    if (strlen(text) > TGT_MODES)
+    {
+        return 0;
+    }
+    for (i = 0; text[i] != '\0'; i++)
+    {
+        if (text[i] < '0' || text[i] >= '0' + TGT_MODES || strchr(text + i + 1, text[i]) != NULL)
+        {
+            return 0;
+        }
+    }
+    strcpy(modes, text);
+    return 1;
+}
+
+/**
+ * @brief Reads a target file.
+ *
+ * @return int Returns 1 if it was read, otherwise 0 after printing why.
+ */
+static int read_target(FILE *file, const char *path, struct target *target)
+{
+    char line[TGT_LINE_SIZE], key[TGT_LINE_SIZE], value[TGT_LINE_SIZE], source[TGT_LINE_SIZE], dest[TGT_LINE_SIZE];
+    struct tgt_instruction *instruction;
+    int line_number = 0, fields, i;
+    char *end;
+
+    memset(target, 0, sizeof(struct target));
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        line_number++;
+        fields = sscanf(line, "%255s %255s", key, value);
+        if (fields <= 0 || key[0] == '#')
+        {
+            continue;
+        }
+        if (strcmp(key, "instruction") == 0)
+        {
+            if (target->instructions_counter == TGT_INSTRUCTIONS)
+            {
+                printf("Error: In file %s at line %d there are more than %d instructions\n", path, line_number, TGT_INSTRUCTIONS);
+                return 0;
+            }
+            instruction = &target->instructions[target->instructions_counter];
+            if (sscanf(line, "%*s %31s %d %255s %255s", instruction->name, &instruction->opcode, source, dest) != 4 ||
+                instruction->opcode < 0 || !read_modes(source, instruction->source) || !read_modes(dest, instruction->dest))
+            {
+                printf("Error: In file %s at line %d expected instruction NAME OPCODE SOURCE_MODES DEST_MODES\n", path, line_number);
+                return 0;
+            }
+            target->instructions_counter++;
+            continue;
+        }
+        if (fields != 2)
+        {
+            printf("Error: In file %s at line %d the setting %s has no value\n", path, line_number, key);
+            return 0;
+        }
+        if (strcmp(key, "name") == 0)
+        {
+            if (strlen(value) >= TGT_NAME_SIZE)
+            {
+                printf("Error: In file %s at line %d the name is too long\n", path, line_number);
+                return 0;
+            }
+            strcpy(target->name, value);
+            continue;
+        }
+        for (i = 0; i < SETTING_COUNT && strcmp(key, setting_names[i]) != 0; i++)
+        {
+            continue;
+        }
+        if (i == SETTING_COUNT)
+        {
+            printf("Error: In file %s at line %d unknown setting %s\n", path, line_number, key);
+            return 0;
+        }
+        target->settings[i] = strtol(value, &end, 10);
+        if (*end != '\0' || target->settings[i] < 0)
+        {
+            printf("Error: In file %s at line %d %s expects a number\n", path, line_number, key);
+            return 0;
+        }
+        target->set[i] = 1;
+    }
+    return 1;
+}
+
+/**
+ * @brief Checks that the settings are complete and that the fields of the words do not overlap.
+ *
+ * @return int Returns 1 if the target is valid, otherwise 0 after printing why.
+ */
+static int check_target(const struct target *target, const char *path)
+{
+    const long *s = target->settings;
+    long max_opcode = 0;
+    int i, j;
+
+    if (target->name[0] == '\0')
+    {
+        printf("Error: In file %s the name is missing\n", path);
+        return 0;
+    }
+    for (i = 0; i < SETTING_COUNT; i++)
+    {
+        if (!target->set[i])
+        {
+            printf("Error: In file %s the setting %s is missing\n", path, setting_names[i]);
+            return 0;
+        }
+    }
+    if (target->instructions_counter != TGT_INSTRUCTIONS)
+    {
+        printf("Error: In file %s there are %d instructions instead of %d\n", path, target->instructions_counter, TGT_INSTRUCTIONS);
+        return 0;
+    }
+    for (i = 0; i < TGT_INSTRUCTIONS; i++)
+    {
+        for (j = 0; j < i; j++)
+        {
+            if (strcmp(target->instructions[i].name, target->instructions[j].name) == 0 ||
+                target->instructions[i].opcode == target->instructions[j].opcode)
+            {
+                printf("Error: In file %s the instructions %s and %s have the same name or opcode\n", path,
+                       target->instructions[j].name, target->instructions[i].name);
+                return 0;
+            }
+        }
+        if (target->instructions[i].opcode > max_opcode)
+        {
+            max_opcode = target->instructions[i].opcode;
+        }
+    }
+
+    if (s[WORD_BITS] < 1 || s[WORD_BITS] > TGT_MAX_WORD_BITS)
+    {
+        printf("Error: In file %s word_bits must be from 1 to %d\n", path, TGT_MAX_WORD_BITS);
+        return 0;
+    }
+    if (s[ARE_ABSOLUTE] == s[ARE_RELOCATABLE] || s[ARE_ABSOLUTE] == s[ARE_EXTERNAL] || s[ARE_RELOCATABLE] == s[ARE_EXTERNAL] ||
+        s[ARE_ABSOLUTE] >= s[DEST_MODE_SHIFT] || s[ARE_RELOCATABLE] >= s[DEST_MODE_SHIFT] || s[ARE_EXTERNAL] >= s[DEST_MODE_SHIFT] ||
+        s[ARE_ABSOLUTE] >= s[OPERAND_SHIFT] || s[ARE_RELOCATABLE] >= s[OPERAND_SHIFT] || s[ARE_EXTERNAL] >= s[OPERAND_SHIFT])
+    {
+        printf("Error: In file %s the A/R/E bits must be distinct and below the modes and the operands\n", path);
+        return 0;
+    }
+    if (s[DEST_MODE_SHIFT] + TGT_MODES > s[SOURCE_MODE_SHIFT] || s[SOURCE_MODE_SHIFT] + TGT_MODES > s[OPCODE_SHIFT] ||
+        s[OPCODE_SHIFT] + bits_for(max_opcode) > s[WORD_BITS])
+    {
+        printf("Error: In file %s the destination modes, source modes and opcode must follow each other in the word\n", path);
+        return 0;
+    }
+    if (s[REGISTERS] < 1 || s[OPERAND_SHIFT] + bits_for(s[REGISTERS] - 1) > s[SOURCE_REGISTER_SHIFT] ||
+        s[SOURCE_REGISTER_SHIFT] + bits_for(s[REGISTERS] - 1) > s[WORD_BITS])
+    {
+        printf("Error: In file %s the registers do not fit between operand_shift, source_register_shift and the word\n", path);
+        return 0;
+    }
+    if (s[SHARED_REGISTER_WORD] > 1)
+    {
+        printf("Error: In file %s shared_register_word must be 0 or 1\n", path);
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief Writes the header of a valid target.
+ */
+static void write_header(FILE *out, const struct target *target, const char *path)
+{
+    const long *s = target->settings;
+    int operand_bits = (int)(s[WORD_BITS] - s[OPERAND_SHIFT]), identity = 1, i;
+
+    for (i = 0; i < TGT_INSTRUCTIONS; i++)
+    {
+        identity = identity && target->instructions[i].opcode == i;
+    }
+
+    fprintf(out, "/* Generated by tools/genTarget from %s, do not edit. make TARGET=NAME regenerates it */\n", path);
+    fprintf(out, "#ifndef TARGETDESC_H\n#define TARGETDESC_H\n\n");
+    fprintf(out, "#define TARGET_NAME \"%s\"\n", target->name);
+    fprintf(out, "#define TARGET_WORD_BITS %ld\n", s[WORD_BITS]);
+    fprintf(out, "#define TARGET_WORD_MASK 0x%lX\n", (1L << s[WORD_BITS]) - 1);
+    fprintf(out, "#define TARGET_OCTAL_DIGITS %ld /* Octal digits of a word in the .ob file */\n", (s[WORD_BITS] + 2) / 3);
+    fprintf(out, "#define TARGET_LOAD_BASE %ld /* Address of the first code word */\n", s[LOAD_BASE]);
+    fprintf(out, "#define TARGET_ADDRESS_BITS %d /* Bits of an address in an operand */\n", operand_bits);
+    fprintf(out, "#define TARGET_ADDRESS_SPACE %ld /* Words an operand can address */\n", 1L << operand_bits);
+    fprintf(out, "#define TARGET_REGISTERS %ld\n", s[REGISTERS]);
+    fprintf(out, "#define TARGET_REGISTER_MASK 0x%lX /* The bits of a register number */\n\n", (1L << bits_for(s[REGISTERS] - 1)) - 1);
+
+    fprintf(out, "/* Bits of the A/R/E field */\n");
+    fprintf(out, "#define TARGET_ARE_ABSOLUTE %ld\n", s[ARE_ABSOLUTE]);
+    fprintf(out, "#define TARGET_ARE_RELOCATABLE %ld\n", s[ARE_RELOCATABLE]);
+    fprintf(out, "#define TARGET_ARE_EXTERNAL %ld\n\n", s[ARE_EXTERNAL]);
+
+    fprintf(out, "/* Positions of the fields of the words */\n");
+    fprintf(out, "#define TARGET_DEST_MODE_SHIFT %ld\n", s[DEST_MODE_SHIFT]);
+    fprintf(out, "#define TARGET_SOURCE_MODE_SHIFT %ld\n", s[SOURCE_MODE_SHIFT]);
+    fprintf(out, "#define TARGET_OPCODE_SHIFT %ld\n", s[OPCODE_SHIFT]);
+    fprintf(out, "#define TARGET_OPERAND_SHIFT %ld\n", s[OPERAND_SHIFT]);
+    fprintf(out, "#define TARGET_SOURCE_REGISTER_SHIFT %ld /* A source register sharing its word or alone in it */\n\n",
+            s[SOURCE_REGISTER_SHIFT]);
+
+    fprintf(out, "/* Ranges of the values, signed in their fields */\n");
+    fprintf(out, "#define TARGET_IMMEDIATE_MIN (%ld)\n", -(1L << (operand_bits - 1)));
+    fprintf(out, "#define TARGET_IMMEDIATE_MAX %ld\n", (1L << (operand_bits - 1)) - 1);
+    fprintf(out, "#define TARGET_DATA_MIN (%ld)\n", -(1L << (s[WORD_BITS] - 1)));
+    fprintf(out, "#define TARGET_DATA_MAX %ld\n\n", (1L << (s[WORD_BITS] - 1)) - 1);
+
+    fprintf(out, "/* Words of an instruction by the modes of its operands, 4 for no operand */\n");
+    fprintf(out, "#define TARGET_REGISTER_MODE(mode) ((mode) == 2 || (mode) == 3)\n");
+    if (s[SHARED_REGISTER_WORD])
+    {
+        fprintf(out, "#define TARGET_INSTRUCTION_WORDS(source, dest) \\\n"
+                     "    (1 + ((source) != 4) + ((dest) != 4) - (TARGET_REGISTER_MODE(source) && TARGET_REGISTER_MODE(dest)))\n\n");
+    }
+    else
+    {
+        fprintf(out, "#define TARGET_INSTRUCTION_WORDS(source, dest) (1 + ((source) != 4) + ((dest) != 4))\n\n");
+    }
+
+    fprintf(out, "/* The opcode of an operation of the parser, and the operation of an opcode or -1 */\n");
+    if (identity)
+    {
+        fprintf(out, "#define TARGET_OPCODE(type) (type)\n");
+        fprintf(out, "#define TARGET_OPERATION(opcode) ((opcode) < %d ? (int)(opcode) : -1)\n\n", TGT_INSTRUCTIONS);
+    }
+    else
+    {
+        fprintf(out, "#define TARGET_OPCODE(type) \\\n    (");
+        for (i = 0; i < TGT_INSTRUCTIONS - 1; i++)
+        {
+            fprintf(out, "(type) == %d ? %d : %s", i, target->instructions[i].opcode, (i % 4 == 3) ? "\\\n     " : "");
+        }
+        fprintf(out, "%d)\n", target->instructions[i].opcode);
+        fprintf(out, "#define TARGET_OPERATION(opcode) \\\n    (");
+        for (i = 0; i < TGT_INSTRUCTIONS; i++)
+        {
+            fprintf(out, "(opcode) == %d ? %d : %s", target->instructions[i].opcode, i, (i % 4 == 3) ? "\\\n     " : "");
+        }
+        fprintf(out, "-1)\n\n");
+    }
+
+    fprintf(out, "/* The initializer of inst_table: name, opcode, source modes, destination modes */\n");
+    fprintf(out, "#define TARGET_INSTRUCTION_COUNT %d\n", TGT_INSTRUCTIONS);
+    fprintf(out, "#define TARGET_INSTRUCTIONS");
+    for (i = 0; i < TGT_INSTRUCTIONS; i++)
+    {
+        fprintf(out, " \\\n    {\"%s\", %d, \"%s\", \"%s\"}%s", target->instructions[i].name, target->instructions[i].opcode,
+                target->instructions[i].source, target->instructions[i].dest, (i < TGT_INSTRUCTIONS - 1) ? "," : "");
+    }
+    fprintf(out, "\n\n#endif\n");
+}
+
+int main(int argc, char **argv)
+{
+    struct target target;
+    FILE *file, *out = stdout;
+    int valid;
+
+    if (argc != 2 && argc != 3)
+    {
+        fprintf(stderr, "Usage: %s TARGET.tgt [OUTPUT.h]\n", argv[0]);
+        return 2;
+    }
+    if ((file = fopen(argv[1], "r")) == NULL)
+    {
+        printf("Error: Unable to read %s\n", argv[1]);
+        return 1;
+    }
+    valid = read_target(file, argv[1], &target) && check_target(&target, argv[1]);
+    fclose(file);
+    if (!valid)
+    {
+        return 1;
+    }
+
+    if (argc == 3 && (out = fopen(argv[2], "w")) == NULL)
+    {
+        fprintf(stderr, "Could not open the file %s for writing\n", argv[2]);
+        return 1;
+    }
+    write_header(out, &target, argv[1]);
+    if (out != stdout && fclose(out) != 0)
+    {
+        fprintf(stderr, "Could not write the file %s\n", argv[2]);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,161 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "assemblerLib.h"
+#include "symbolTable.h"
+
+/*
+ * Assembles sources through the in-memory library, as the assembler program does from files.
+ *
+ * Usage: libAssembler [-O] [--gc-sections] [--pool-constants] FILE...
+ *
+ * Every FILE is given without extension: FILE.as is read, assembled by asm_assemble with
+ * the optimizations given, and its image is written to FILE.ob in the format of
+ * createObFile. The diagnostics are printed to stdout. make libcheck compares both with
+ * the outputs of the assembler program.
+ */
+
+/**
+ * @brief Reads a whole file.
+ *
+ * @param length The number of characters read.
+ * @return char* The content, to be freed by the caller, or NULL if it cannot be read.
+ */
+static char *read_file(const char *path, size_t *length)
+{
+    FILE *file = fopen(path, "rb");
+    char *content;
+    long size;
+
+    if (file == NULL)
+    {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    rewind(file);
+    content = (char *)malloc(size + 1);
+    if (content != NULL)
+    {
+        *length = fread(content, 1, size, file);
+    }
+    fclose(file);
+    return content;
+}
+
+/**
+ * @brief Writes the images of an assembled source, as createObFile writes them.
+ *
+ * @return int Returns 1 if the file was written, otherwise 0.
+ */
+static int write_object(const struct asm_result *result, const char *path)
+{
+    translation image;
+    FILE *file;
+    size_t i;
+    int success;
+
+    if (result->code_length == 0 && result->data_length == 0)
+    {
+        return 1; /* The assembler writes no .ob file either */
+    }
+    init_machine_code(&image, MAX_MEM_SIZE);
+    for (i = 0; i < result->code_length; i++)
+    {
+        store_code_word(&image, ASM_LOAD_ADDRESS + (int)i, result->code[i]);
+    }
+    for (i = 0; i < result->data_length; i++)
+    {
+        store_data_word(&image, (int)i, result->data[i]);
+    }
+    image.IC = (result->code_length > 0) ? ASM_LOAD_ADDRESS + (int)result->code_length : 0;
+    image.DC = (int)result->data_length;
+
+    if ((file = fopen(path, "w")) == NULL)
+    {
+        fprintf(stderr, "Could not open the file %s for writing\n", path);
+        release_machine_code(&image);
+        return 0;
+    }
+    fprintf(file, "%d\t%d\n", (int)result->code_length, (int)result->data_length);
+    fprint_code_image(&image, file);
+    fprint_data_image(&image, file);
+    success = !ferror(file);
+    if (fclose(file) != 0 || !success)
+    {
+        fprintf(stderr, "Error: Unable to write %s\n", path);
+        success = 0;
+    }
+    release_machine_code(&image);
+    return success;
+}
+
+int main(int argc, char **argv)
+{
+    struct asm_result result;
+    asm_handle *handle;
+    int optimizations = 0, failed = 0, i;
+    size_t length = 0;
+    char *path, *source;
+
+    for (i = 1; i < argc && argv[i][0] == '-'; i++)
+    {
+        if (strcmp(argv[i], "-O") == 0)
+        {
+            optimizations |= ASM_OPTIMIZE_PEEPHOLE;
+        }
+        else if (strcmp(argv[i], "--gc-sections") == 0)
+        {
+            optimizations |= ASM_OPTIMIZE_GC_SECTIONS;
+        }
+        else if (strcmp(argv[i], "--pool-constants") == 0)
+        {
+            optimizations |= ASM_OPTIMIZE_POOL_CONSTANTS;
+        }
+        else
+        {
+            break;
+        }
+    }
+    if (i == argc || argv[i][0] == '-')
+    {
+        fprintf(stderr, "Usage: %s [-O] [--gc-sections] [--pool-constants] FILE...\n", argv[0]);
+        return 2;
+    }
+    if ((handle = asm_create(0)) == NULL || asm_set_optimizations(handle, optimizations) != ASM_OK)
+    {
+        printf("Error: Memory allocation failed\n");
+        return 1;
+    }
+
+    for (; i < argc; i++)
+    {
+        path = (char *)malloc(strlen(argv[i]) + 4);
+        if (path == NULL)
+        {
+            printf("Error: Memory allocation failed\n");
+            failed = 1;
+            break;
+        }
+        sprintf(path, "%s.as", argv[i]);
+        if ((source = read_file(path, &length)) == NULL)
+        {
+            printf("Error: Unable to read %s\n", path);
+            failed = 1;
+        }
+        else
+        {
+            if (asm_assemble(handle, argv[i], source, length, &result) == ASM_OK)
+            {
+                sprintf(path, "%s.ob", argv[i]);
+                failed |= !write_object(&result, path);
+            }
+            fputs(result.diagnostics, stdout);
+            free(source);
+        }
+        free(path);
+    }
+
+    asm_destroy(handle);
+    return failed;
+}
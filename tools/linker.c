@@ -0,0 +1,464 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "symbolTable.h"
+
+/*
+ * Links modules assembled separately into one executable image.
+ *
+ * Usage: linker [-o OUTPUT] MODULE...
+ *
+ * Every MODULE is given without extension, as to the assembler: MODULE.ob is loaded with
+ * MODULE.ent and MODULE.ext when they exist. The code of the modules is laid out first, in
+ * the order given, from LINK_LOAD_ADDRESS, then their data. The entries of all the modules
+ * go into one hash table. Every relocatable word is moved with its module. Every external
+ * use listed in a .ext file is then patched with the address of the entry it names, as a
+ * relocatable word. The image is written to OUTPUT.ob, in the format of createObFile. Each
+ * symbol and each word is handled a constant number of times, so linking is linear in the
+ * size of the modules.
+ */
+
+#define LINK_LOAD_ADDRESS TARGET_LOAD_BASE      /* Address of the first code word, as in secondPass */
+#define LINK_ADDRESS_LIMIT TARGET_ADDRESS_SPACE /* Addresses are the bits of an operand word */
+#define LINK_INITIAL_SLOTS 64   /* Initial capacity of the entry table, a power of 2 */
+#define LINK_NAME_SIZE 64       /* Size of the buffer a name is read into */
+#define DEFAULT_OUTPUT "linked" /* Base name of the image when -o is not given */
+#define ARE_RELOCATABLE (1 << TARGET_ARE_RELOCATABLE)
+#define ARE_EXTERNAL (1 << TARGET_ARE_EXTERNAL)
+#define ARE_MASK ((1 << TARGET_ARE_ABSOLUTE) | ARE_RELOCATABLE | ARE_EXTERNAL)
+#define ADDRESS_SHIFT TARGET_OPERAND_SHIFT /* An address is stored above the A/R/E bits */
+
+/**
+ * @brief A module: its images, read from its .ob file, and where they are placed.
+ */
+struct module
+{
+    const char *name;  /* Base name of its files */
+    uint16_t *code;    /* Code words, code[i] assembled at LINK_LOAD_ADDRESS + i */
+    int code_length;
+    uint16_t *data;    /* Data words, assembled right after the code */
+    int data_length;
+    int code_base;     /* Address of its first code word in the image */
+    int data_base;     /* Address of its first data word in the image */
+};
+
+/**
+ * @brief An entry of a module, in the global entry table.
+ */
+struct global_entry
+{
+    char name[MAX_SYMBOL_NAME]; /* Empty for a free slot */
+    int address;                /* Address in the image */
+    int module;                 /* Index of the module that defines it */
+};
+
+/**
+ * @brief The entries of all the modules, in an open addressing hash table.
+ */
+struct entry_table
+{
+    struct global_entry *slots;
+    int capacity; /* A power of 2 */
+    int counter;
+};
+
+/**
+ * @brief Hashes a name with FNV-1a.
+ */
+static unsigned long hash_name(const char *name)
+{
+    unsigned long hash = 2166136261UL;
+
+    while (*name != '\0')
+    {
+        hash = ((hash ^ (unsigned char)*name++) * 16777619UL) & 0xFFFFFFFFUL;
+    }
+    return hash;
+}
+
+/**
+ * @brief Finds the slot of a name: the slot that holds it, or the free slot it would go to.
+ */
+static struct global_entry *find_slot(const struct entry_table *table, const char *name)
+{
+    unsigned long i = hash_name(name) & (table->capacity - 1);
+
+    while (table->slots[i].name[0] != '\0' && strcmp(table->slots[i].name, name) != 0)
+    {
+        i = (i + 1) & (table->capacity - 1);
+    }
+    return &table->slots[i];
+}
+
+/**
+ * @brief Finds the entry of a name.
+ *
+ * @return const struct global_entry* The entry, or NULL if no module has an entry of that name.
+ */
+static const struct global_entry *find_entry_by_name(const struct entry_table *table, const char *name)
+{
+    const struct global_entry *slot;
+
+    if (table->capacity == 0)
+    {
+        return NULL;
+    }
+    slot = find_slot(table, name);
+    return (slot->name[0] != '\0') ? slot : NULL;
+}
+
+/**
+ * @brief Doubles the capacity of the table and moves its entries.
+ */
+static void grow_table(struct entry_table *table)
+{
+    struct global_entry *old = table->slots;
+    int old_capacity = table->capacity, i;
+
+    table->capacity = old_capacity ? old_capacity * 2 : LINK_INITIAL_SLOTS;
+    table->slots = (struct global_entry *)allocateMemory(table->capacity, sizeof(struct global_entry), CALLOC_ID);
+    for (i = 0; i < old_capacity; i++)
+    {
+        if (old[i].name[0] != '\0')
+        {
+            *find_slot(table, old[i].name) = old[i];
+        }
+    }
+    free(old);
+}
+
+/**
+ * @brief Reads the .ob file of a module into its images.
+ *
+ * @return int Returns 1 if the file was read, otherwise 0 after printing why.
+ */
+static int load_object(struct module *module, char *path)
+{
+    char octal[16], *end;
+    int address, line = 1, valid = 1;
+    long word;
+    FILE *file;
+
+    sprintf(path, "%s.ob", module->name);
+    if ((file = fopen(path, "r")) == NULL)
+    {
+        printf("Error: Unable to read %s\n", path);
+        return 0;
+    }
+    if (fscanf(file, "%d %d", &module->code_length, &module->data_length) != 2 || module->code_length < 0 ||
+        module->data_length < 0 || LINK_LOAD_ADDRESS + module->code_length + module->data_length > LINK_ADDRESS_LIMIT)
+    {
+        printf("Error: In file %s the header is not valid\n", path);
+        fclose(file);
+        return 0;
+    }
+
+    /* Words missing from the file are zero, as createObFile skips them */
+    module->code = (uint16_t *)allocateMemory(module->code_length + 1, sizeof(uint16_t), CALLOC_ID);
+    module->data = (uint16_t *)allocateMemory(module->data_length + 1, sizeof(uint16_t), CALLOC_ID);
+    while (valid && fscanf(file, "%d %15s", &address, octal) == 2)
+    {
+        line++;
+        word = strtol(octal, &end, 8);
+        address -= LINK_LOAD_ADDRESS;
+        if (*end != '\0' || word < 0 || word > WORD_MASK || address < 0 ||
+            address >= module->code_length + module->data_length)
+        {
+            printf("Error: In file %s line %d is not a word of the module\n", path, line);
+            valid = 0;
+        }
+        else if (address < module->code_length)
+        {
+            module->code[address] = (uint16_t)word;
+        }
+        else
+        {
+            module->data[address - module->code_length] = (uint16_t)word;
+        }
+    }
+    if (valid && !feof(file))
+    {
+        printf("Error: In file %s line %d cannot be read\n", path, line + 1);
+        valid = 0;
+    }
+    fclose(file);
+    return valid;
+}
+
+/**
+ * @brief Moves an address the module was assembled with to its address in the image.
+ *
+ * @return int The address in the image, or -1 if the address is not inside the module.
+ */
+static int relocate(const struct module *module, int address)
+{
+    address -= LINK_LOAD_ADDRESS;
+    if (address >= 0 && address < module->code_length)
+    {
+        return module->code_base + address;
+    }
+    address -= module->code_length;
+    if (address >= 0 && address < module->data_length)
+    {
+        return module->data_base + address;
+    }
+    return -1;
+}
+
+/**
+ * @brief Adds the entries of a module, read from its .ent file, to the table.
+ *
+ * @return int The number of errors found.
+ */
+static int load_entries(struct entry_table *table, const struct module *modules, int index, char *path)
+{
+    const struct module *module = &modules[index];
+    char name[LINK_NAME_SIZE];
+    struct global_entry *slot;
+    int address, errors = 0;
+    FILE *file;
+
+    sprintf(path, "%s.ent", module->name);
+    if ((file = fopen(path, "r")) == NULL)
+    {
+        return 0; /* The module has no entries */
+    }
+    while (fscanf(file, "%63s %d", name, &address) == 2)
+    {
+        if (strlen(name) >= MAX_SYMBOL_NAME || (address = relocate(module, address)) < 0)
+        {
+            printf("Error: In file %s the entry %s is not valid\n", path, name);
+            errors++;
+            continue;
+        }
+        if ((table->counter + 1) * 2 > table->capacity)
+        {
+            grow_table(table);
+        }
+        slot = find_slot(table, name);
+        if (slot->name[0] != '\0')
+        {
+            printf("Error: The entry %s of module %s is already an entry of module %s\n", name, module->name,
+                   modules[slot->module].name);
+            errors++;
+            continue;
+        }
+        strcpy(slot->name, name);
+        slot->address = address;
+        slot->module = index;
+        table->counter++;
+    }
+    fclose(file);
+    return errors;
+}
+
+/**
+ * @brief Moves the relocatable words of the code of a module with it.
+ *
+ * @return int The number of errors found.
+ */
+static int relocate_code(struct module *module)
+{
+    int i, address, errors = 0;
+
+    for (i = 0; i < module->code_length; i++)
+    {
+        if ((module->code[i] & ARE_MASK) == ARE_RELOCATABLE)
+        {
+            address = relocate(module, module->code[i] >> ADDRESS_SHIFT);
+            if (address < 0)
+            {
+                printf("Error: In module %s the word at address %d points to address %d, outside the module\n",
+                       module->name, LINK_LOAD_ADDRESS + i, module->code[i] >> ADDRESS_SHIFT);
+                errors++;
+                continue;
+            }
+            module->code[i] = (uint16_t)((address << ADDRESS_SHIFT) | ARE_RELOCATABLE);
+        }
+    }
+    return errors;
+}
+
+/**
+ * @brief Patches the external uses of a module, read from its .ext file, with the addresses of their entries.
+ *
+ * @return int The number of errors found.
+ */
+static int patch_externs(const struct entry_table *table, struct module *module, char *path)
+{
+    char name[LINK_NAME_SIZE];
+    const struct global_entry *slot;
+    int address, index, errors = 0;
+    FILE *file;
+
+    sprintf(path, "%s.ext", module->name);
+    if ((file = fopen(path, "r")) == NULL)
+    {
+        return 0; /* The module uses no external symbol */
+    }
+    while (fscanf(file, "%63s %d", name, &address) == 2)
+    {
+        index = address - LINK_LOAD_ADDRESS;
+        if (index < 0 || index >= module->code_length || (module->code[index] & ARE_MASK) != ARE_EXTERNAL)
+        {
+            printf("Error: In file %s the use of %s at address %d is not an external word\n", path, name, address);
+            errors++;
+            continue;
+        }
+        if ((slot = find_entry_by_name(table, name)) == NULL)
+        {
+            printf("Error: In module %s the external symbol %s is not an entry of any module\n", module->name, name);
+            errors++;
+            continue;
+        }
+        module->code[index] = (uint16_t)((slot->address << ADDRESS_SHIFT) | ARE_RELOCATABLE);
+    }
+    fclose(file);
+    return errors;
+}
+
+/**
+ * @brief Checks that no external word of a module was left unpatched.
+ *
+ * @return int The number of errors found.
+ */
+static int check_patched(const struct module *module)
+{
+    int i, errors = 0;
+
+    for (i = 0; i < module->code_length; i++)
+    {
+        if ((module->code[i] & ARE_MASK) == ARE_EXTERNAL)
+        {
+            printf("Error: In module %s the word at address %d uses an external symbol missing from %s.ext\n",
+                   module->name, LINK_LOAD_ADDRESS + i, module->name);
+            errors++;
+        }
+    }
+    return errors;
+}
+
+/**
+ * @brief Writes the image of the linked modules, as createObFile writes a single file.
+ *
+ * @return int Returns 1 if the image was written, otherwise 0.
+ */
+static int write_image(const struct module *modules, int counter, int code_length, int data_length, char *path)
+{
+    translation image;
+    FILE *file;
+    int i, j, success;
+
+    init_machine_code(&image, MAX_MEM_SIZE);
+    for (i = 0; i < counter; i++)
+    {
+        for (j = 0; j < modules[i].code_length; j++)
+        {
+            store_code_word(&image, modules[i].code_base + j, modules[i].code[j]);
+        }
+        for (j = 0; j < modules[i].data_length; j++)
+        {
+            store_data_word(&image, modules[i].data_base - LINK_LOAD_ADDRESS - code_length + j, modules[i].data[j]);
+        }
+    }
+    image.IC = (code_length > 0) ? LINK_LOAD_ADDRESS + code_length : 0;
+    image.DC = data_length;
+
+    if ((file = fopen(path, "w")) == NULL)
+    {
+        fprintf(stderr, "Could not open the file %s for writing\n", path);
+        release_machine_code(&image);
+        return 0;
+    }
+    fprintf(file, "%d\t%d\n", code_length, data_length);
+    fprint_code_image(&image, file);
+    fprint_data_image(&image, file);
+    success = !ferror(file);
+    if (fclose(file) != 0 || !success)
+    {
+        fprintf(stderr, "Error: Unable to write %s\n", path);
+        success = 0;
+    }
+    release_machine_code(&image);
+    return success;
+}
+
+int main(int argc, char **argv)
+{
+    struct entry_table table = {NULL, 0, 0};
+    struct module *modules;
+    const char *output = DEFAULT_OUTPUT;
+    int first = 1, counter, code_length = 0, data_length = 0, errors = 0, module_errors, linked, i;
+    size_t longest = strlen(DEFAULT_OUTPUT);
+    char *path;
+
+    if (argc > 2 && strcmp(argv[1], "-o") == 0)
+    {
+        output = argv[2];
+        first = 3;
+    }
+    counter = argc - first;
+    if (counter < 1)
+    {
+        fprintf(stderr, "Usage: %s [-o OUTPUT] MODULE...\n", argv[0]);
+        return 2;
+    }
+    for (i = 1; i < argc; i++)
+    {
+        longest = (strlen(argv[i]) > longest) ? strlen(argv[i]) : longest;
+    }
+    path = (char *)allocateMemory(longest + 5, sizeof(char), MALLOC_ID);
+    modules = (struct module *)allocateMemory(counter, sizeof(struct module), CALLOC_ID);
+
+    /* Read the images and lay them out: all the code, then all the data */
+    for (i = 0; i < counter; i++)
+    {
+        modules[i].name = argv[first + i];
+        if (!load_object(&modules[i], path))
+        {
+            errors++;
+            continue;
+        }
+        modules[i].code_base = LINK_LOAD_ADDRESS + code_length;
+        code_length += modules[i].code_length;
+        data_length += modules[i].data_length;
+    }
+    if (errors == 0 && LINK_LOAD_ADDRESS + code_length + data_length > LINK_ADDRESS_LIMIT)
+    {
+        printf("Error: The %d code and %d data words of the modules do not fit in memory\n", code_length, data_length);
+        errors++;
+    }
+    for (i = 0, data_length = 0; errors == 0 && i < counter; i++)
+    {
+        modules[i].data_base = LINK_LOAD_ADDRESS + code_length + data_length;
+        data_length += modules[i].data_length;
+    }
+
+    /* The entries of every module must be known before any external use is patched */
+    for (i = 0, linked = (errors == 0); linked && i < counter; i++)
+    {
+        errors += load_entries(&table, modules, i, path);
+    }
+    for (i = 0, linked = (errors == 0); linked && i < counter; i++)
+    {
+        module_errors = relocate_code(&modules[i]);
+        module_errors += patch_externs(&table, &modules[i], path);
+        errors += module_errors ? module_errors : check_patched(&modules[i]);
+    }
+
+    if (errors == 0)
+    {
+        sprintf(path, "%s.ob", output);
+        errors = !write_image(modules, counter, code_length, data_length, path);
+    }
+
+    for (i = 0; i < counter; i++)
+    {
+        free(modules[i].code);
+        free(modules[i].data);
+    }
+    free(modules);
+    free(table.slots);
+    free(path);
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,18 @@
+; A, B and C hold the same words, so --pool-constants could share them.
+; B has its address taken by lea and is written through r1, and C is an
+; entry, so neither may be shared: the program prints 0, 5, 0 and 7.
+    .entry C
+
+MAIN:   lea B, r1
+        mov #5, *r1
+        prn A
+        prn B
+        prn C
+        prn D
+        stop
+
+A:      .data 0
+B:      .data 0
+C:      .data 0
+D:      .data 7
+E:      .data 7
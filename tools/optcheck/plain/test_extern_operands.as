@@ -0,0 +1,10 @@
+; External symbols used as the source and as the destination operand,
+; interleaved. Every use is a line of the .ext file, in the order of use.
+.extern IN
+.extern OUT
+START: mov IN, OUT
+add IN, r1
+mov r1, OUT
+cmp OUT, IN
+jmp OUT
+stop
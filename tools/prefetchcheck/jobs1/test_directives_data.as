@@ -0,0 +1,14 @@
+; file guidance_only
+
+.entry buff1
+.entry buff2
+
+.string "[]ffd"
+
+buff2: .string ""
+        
+
+buff1: .data 55, 69, -9845
+        .string "abccd"
+
+
@@ -0,0 +1,22 @@
+; Disassembled from tests/test_addressing_modes.ob
+	.extern XYZ
+	.entry MAIN
+	sub *r4, *r3
+MAIN:	mov *r3, L0136
+L0105:	jmp L0115
+	prn #-5
+	bne L0105
+	sub *r1, *r4
+	bne L0119
+L0115:	inc L0139
+	bne L0105
+L0119:	stop
+	mov L0145, L0153
+	add L0149, L0145
+	mov XYZ, *r3
+	.string "abcdef"
+L0136:	.data 6, -9, 15
+L0139:	.data 4, -55, 4, 4, 4, 6
+L0145:	.data 6, 5, -555, 66
+L0149:	.data 6, 5, -555, 66
+L0153:	.string "asfas   %%dfjk"
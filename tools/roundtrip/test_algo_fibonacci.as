@@ -0,0 +1,24 @@
+; Disassembled from tests/test_algo_fibonacci.ob
+	.extern PRINT
+	.entry MAIN
+	.entry FIBONACCI
+MAIN:	mov #10, r0
+	jsr FIBONACCI
+	stop
+	prn r4
+	lea PRINT, r4
+FIBONACCI:	clr r1
+	mov #1, r2
+	clr r3
+	clr r4
+	jmp L0122
+L0122:	cmp r3, r0
+	bne L0141
+	prn r1
+	add r1, r2
+	mov r2, r4
+	mov r4, r2
+	sub r1, r2
+	add #1, r3
+	jmp L0122
+L0141:	rts
@@ -0,0 +1,6 @@
+; Disassembled from tests/test_directives_data.ob
+	.entry buff2
+	.entry buff1
+	.string "[]ffd"
+buff2:	.data 0
+buff1:	.data 55, 69, -9845, 97, 98, 99, 99, 100, 0
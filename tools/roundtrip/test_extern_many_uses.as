@@ -0,0 +1,14 @@
+; Disassembled from tests/test_extern_many_uses.ob
+	.extern COUNT
+	.extern PRINT
+	.extern TABLE
+	mov COUNT, r1
+	jsr PRINT
+L0105:	add TABLE, r2
+	cmp COUNT, #0
+	dec r1
+	bne L0105
+	jsr PRINT
+	lea TABLE, r3
+	prn COUNT
+	stop
@@ -0,0 +1,9 @@
+; Disassembled from tests/test_extern_operands.ob
+	.extern IN
+	.extern OUT
+	mov IN, OUT
+	add IN, r1
+	mov r1, OUT
+	cmp OUT, IN
+	jmp OUT
+	stop
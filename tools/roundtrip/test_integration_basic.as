@@ -0,0 +1,22 @@
+; Disassembled from tests/test_integration_basic.ob
+	.extern fn1
+	.extern L3
+	.entry MAIN
+	.entry LIST
+MAIN:	add r3, LIST
+	jsr fn1
+L0105:	prn #48
+	lea L0132, r6
+	inc r6
+	mov *r6, L3
+	sub r1, r4
+	cmp r3, #-6
+	bne L0131
+	add r7, *r6
+	clr L0140
+	sub L3, L3
+	jmp L0105
+L0131:	stop
+L0132:	.string "abcd"
+LIST:	.data 6, -9, -100
+L0140:	.data 31
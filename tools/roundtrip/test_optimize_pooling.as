@@ -0,0 +1,13 @@
+; Disassembled from tests/test_optimize_pooling.ob
+	.entry C
+	lea L0116, r1
+	mov #5, *r1
+	prn L0115
+	prn L0116
+	prn C
+	prn L0118
+	stop
+L0115:	.data 0
+L0116:	.data 0
+C:	.data 0
+L0118:	.data 7, 7
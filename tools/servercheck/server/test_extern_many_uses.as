@@ -0,0 +1,15 @@
+; Several external symbols, each used more than once. Freeing the list of
+; their uses read nodes it had already freed.
+.extern PRINT
+.extern COUNT
+.extern TABLE
+MAIN: mov COUNT, r1
+jsr PRINT
+LOOP: add TABLE, r2
+cmp COUNT, #0
+dec r1
+bne LOOP
+jsr PRINT
+lea TABLE, r3
+prn COUNT
+stop
@@ -0,0 +1,182 @@
+#define _POSIX_C_SOURCE 200809L /* clock_gettime */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "simulator.h"
+#include "assemblerLib.h"
+
+/*
+ * Runs an assembled program on the simulator of src/simulator.c.
+ *
+ * Usage: simulator [--budget N] [--assemble] [--timing] FILE
+ *
+ * FILE is given without extension, as to the assembler: FILE.ob is loaded, or with
+ * --assemble FILE.as is assembled in memory and its images are run directly. red reads
+ * stdin and prn writes stdout. Exits with 0 when the program stops, 1 when it faults
+ * or cannot be loaded, and 3 when it runs out of budget.
+ */
+
+#define EXIT_EXHAUSTED 3 /* Exit status when the budget runs out */
+
+/**
+ * @brief Reads a whole file.
+ *
+ * @param length The number of characters read.
+ * @return char* The content, to be freed by the caller, or NULL if it cannot be read.
+ */
+static char *read_file(const char *path, size_t *length)
+{
+    FILE *file = fopen(path, "rb");
+    char *content;
+    long size;
+
+    if (file == NULL)
+    {
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    rewind(file);
+    content = (char *)malloc(size + 1);
+    if (content != NULL)
+    {
+        *length = fread(content, 1, size, file);
+    }
+    fclose(file);
+    return content;
+}
+
+/**
+ * @brief Assembles FILE.as in memory and loads its images.
+ *
+ * @return int Returns 1 if the program was loaded, otherwise 0 after printing why.
+ */
+static int load_source(struct sim_machine *machine, const char *base, char *path)
+{
+    struct asm_result result;
+    asm_handle *handle;
+    size_t length = 0;
+    char *source;
+    int loaded = 0;
+
+    sprintf(path, "%s.as", base);
+    if ((source = read_file(path, &length)) == NULL)
+    {
+        printf("Error: Unable to read %s\n", path);
+        return 0;
+    }
+    if ((handle = asm_create(0)) == NULL)
+    {
+        printf("Error: Memory allocation failed\n");
+    }
+    else if (asm_assemble(handle, base, source, length, &result) != ASM_OK)
+    {
+        fputs(result.diagnostics, stdout);
+    }
+    else if (!(loaded = sim_load_images(machine, result.code, result.code_length, result.data, result.data_length)))
+    {
+        printf("Error: %s\n", machine->error);
+    }
+    asm_destroy(handle);
+    free(source);
+    return loaded;
+}
+
+/**
+ * @brief Loads FILE.ob.
+ *
+ * @return int Returns 1 if the program was loaded, otherwise 0 after printing why.
+ */
+static int load_object(struct sim_machine *machine, const char *base, char *path)
+{
+    FILE *file;
+    int loaded;
+
+    sprintf(path, "%s.ob", base);
+    if ((file = fopen(path, "r")) == NULL)
+    {
+        printf("Error: Unable to read %s\n", path);
+        return 0;
+    }
+    if (!(loaded = sim_load_ob(machine, file)))
+    {
+        printf("Error: In file %s: %s\n", path, machine->error);
+    }
+    fclose(file);
+    return loaded;
+}
+
+/**
+ * @brief Reads CLOCK_MONOTONIC in seconds.
+ */
+static double now_seconds(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv)
+{
+    static struct sim_machine machine; /* Too large for the stack */
+    long budget = 0;
+    int assemble = 0, timing = 0, status, i;
+    double start, seconds;
+    char *path;
+
+    for (i = 1; i < argc - 1; i++)
+    {
+        if (strcmp(argv[i], "--budget") == 0 && i + 1 < argc - 1)
+        {
+            budget = atol(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--assemble") == 0)
+        {
+            assemble = 1;
+        }
+        else if (strcmp(argv[i], "--timing") == 0)
+        {
+            timing = 1;
+        }
+        else
+        {
+            break;
+        }
+    }
+    if (i != argc - 1 || budget < 0)
+    {
+        fprintf(stderr, "Usage: %s [--budget N] [--assemble] [--timing] FILE\n", argv[0]);
+        return 2;
+    }
+
+    path = (char *)malloc(strlen(argv[i]) + 4);
+    if (path == NULL || !(assemble ? load_source(&machine, argv[i], path) : load_object(&machine, argv[i], path)))
+    {
+        free(path);
+        return 1;
+    }
+
+    start = now_seconds();
+    status = sim_run(&machine, budget);
+    seconds = now_seconds() - start;
+    fflush(stdout);
+
+    if (status == SIM_FAULT)
+    {
+        printf("Error: In file %s: %s\n", path, machine.error);
+    }
+    else if (status == SIM_EXHAUSTED)
+    {
+        printf("Error: In file %s the budget of %ld instructions ran out at address %d\n", path, budget, machine.pc);
+    }
+    if (timing)
+    {
+        fprintf(stderr, "%ld instructions in %.3f s, %.1f million per second\n", machine.executed, seconds,
+                seconds > 0 ? machine.executed / seconds / 1e6 : 0);
+    }
+
+    free(path);
+    return (status == SIM_STOPPED) ? 0 : (status == SIM_EXHAUSTED) ? EXIT_EXHAUSTED : 1;
+}
@@ -0,0 +1,68 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "protocol.h"
+
+/*
+ * Splits a frame written by the stream mode or the server into one file per record.
+ *
+ * Usage: splitFrame PREFIX < FRAME
+ *
+ * The frame is read from stdin, and the data of every record is written to PREFIX.TAG:
+ * PREFIX.ob, PREFIX.ent and PREFIX.ext hold the outputs as the assembler writes them to
+ * files, PREFIX.status and PREFIX.diagnostics the rest of the response. make streamcheck
+ * compares them with the outputs of the assembler program.
+ */
+
+#define SPLIT_PATH_SIZE 512 /* Longest path of a record file, with its null byte */
+
+int main(int argc, char **argv)
+{
+    struct text_buffer frame;
+    struct text_reader reader;
+    char tag[RECORD_TAG_SIZE], path[SPLIT_PATH_SIZE];
+    const char *data;
+    size_t length;
+    FILE *file;
+    int failed = 0, result;
+
+    if (argc != 2 || strlen(argv[1]) + RECORD_TAG_SIZE + 1 > sizeof(path))
+    {
+        fprintf(stderr, "Usage: %s PREFIX < FRAME\n", argv[0]);
+        return 2;
+    }
+
+    init_text_buffer(&frame);
+    if (read_frame(0, &frame) != 1)
+    {
+        printf("Error: Unable to read a frame from stdin\n");
+        release_text_buffer(&frame);
+        return 1;
+    }
+
+    init_text_reader(&reader, frame.text, frame.length);
+    while ((result = read_record(&reader, tag, &data, &length)) == 1)
+    {
+        sprintf(path, "%s.%s", argv[1], tag);
+        if ((file = fopen(path, "w")) == NULL)
+        {
+            printf("Error: Unable to write %s\n", path);
+            failed = 1;
+            continue;
+        }
+        fwrite(data, 1, length, file);
+        if (fclose(file) != 0)
+        {
+            printf("Error: Unable to write %s\n", path);
+            failed = 1;
+        }
+    }
+    if (result < 0)
+    {
+        printf("Error: The frame holds a malformed record\n");
+        failed = 1;
+    }
+
+    release_text_buffer(&frame);
+    return failed;
+}